@@ -0,0 +1,8141 @@
+
+obj/user/signedoverflow:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 28 00 00 00       	call   80004b <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+/* Test for UBSAN support - signed integer overflow */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    /* Creating a 32-bit integer variable with the maximum integer value it can contain */
+    int a = 2147483647;
+    /* Trying to add 1 to the "a" variable and print its contents (which causes undefined behavior). */
+    /* The "cprintf" function is sanitized by UBSAN because lib/Makefrag accesses the USER_SAN_CFLAGS variable. */
+    cprintf("%d\n", a + 1);
+  800029:	be 00 00 00 80       	mov    $0x80000000,%esi
+  80002e:	48 bf a8 46 80 00 00 	movabs $0x8046a8,%rdi
+  800035:	00 00 00 
+  800038:	b8 00 00 00 00       	mov    $0x0,%eax
+  80003d:	48 ba ce 01 80 00 00 	movabs $0x8001ce,%rdx
+  800044:	00 00 00 
+  800047:	ff d2                	call   *%rdx
+}
+  800049:	5d                   	pop    %rbp
+  80004a:	c3                   	ret
+
+000000000080004b <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80004b:	55                   	push   %rbp
+  80004c:	48 89 e5             	mov    %rsp,%rbp
+  80004f:	41 56                	push   %r14
+  800051:	41 55                	push   %r13
+  800053:	41 54                	push   %r12
+  800055:	53                   	push   %rbx
+  800056:	41 89 fd             	mov    %edi,%r13d
+  800059:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80005c:	48 ba e0 50 80 00 00 	movabs $0x8050e0,%rdx
+  800063:	00 00 00 
+  800066:	48 b8 e0 50 80 00 00 	movabs $0x8050e0,%rax
+  80006d:	00 00 00 
+  800070:	48 39 c2             	cmp    %rax,%rdx
+  800073:	73 17                	jae    80008c <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800075:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800078:	49 89 c4             	mov    %rax,%r12
+  80007b:	48 83 c3 08          	add    $0x8,%rbx
+  80007f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800084:	ff 53 f8             	call   *-0x8(%rbx)
+  800087:	4c 39 e3             	cmp    %r12,%rbx
+  80008a:	72 ef                	jb     80007b <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  80008c:	48 b8 c5 0f 80 00 00 	movabs $0x800fc5,%rax
+  800093:	00 00 00 
+  800096:	ff d0                	call   *%rax
+  800098:	89 c2                	mov    %eax,%edx
+  80009a:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  8000a0:	48 89 d0             	mov    %rdx,%rax
+  8000a3:	48 c1 e0 04          	shl    $0x4,%rax
+  8000a7:	48 29 d0             	sub    %rdx,%rax
+  8000aa:	48 c1 e0 05          	shl    $0x5,%rax
+  8000ae:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000b5:	00 00 00 
+  8000b8:	48 01 d0             	add    %rdx,%rax
+  8000bb:	48 a3 00 00 81 00 00 	movabs %rax,0x810000
+  8000c2:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000c5:	45 85 ed             	test   %r13d,%r13d
+  8000c8:	7e 0d                	jle    8000d7 <libmain+0x8c>
+  8000ca:	49 8b 06             	mov    (%r14),%rax
+  8000cd:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000d4:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000d7:	4c 89 f6             	mov    %r14,%rsi
+  8000da:	44 89 ef             	mov    %r13d,%edi
+  8000dd:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000e4:	00 00 00 
+  8000e7:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000e9:	48 b8 fe 00 80 00 00 	movabs $0x8000fe,%rax
+  8000f0:	00 00 00 
+  8000f3:	ff d0                	call   *%rax
+#endif
+}
+  8000f5:	5b                   	pop    %rbx
+  8000f6:	41 5c                	pop    %r12
+  8000f8:	41 5d                	pop    %r13
+  8000fa:	41 5e                	pop    %r14
+  8000fc:	5d                   	pop    %rbp
+  8000fd:	c3                   	ret
+
+00000000008000fe <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000fe:	55                   	push   %rbp
+  8000ff:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800102:	48 b8 ab 16 80 00 00 	movabs $0x8016ab,%rax
+  800109:	00 00 00 
+  80010c:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80010e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800113:	48 b8 62 0f 80 00 00 	movabs $0x800f62,%rax
+  80011a:	00 00 00 
+  80011d:	ff d0                	call   *%rax
+}
+  80011f:	5d                   	pop    %rbp
+  800120:	c3                   	ret
+
+0000000000800121 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800121:	55                   	push   %rbp
+  800122:	48 89 e5             	mov    %rsp,%rbp
+  800125:	53                   	push   %rbx
+  800126:	48 83 ec 08          	sub    $0x8,%rsp
+  80012a:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80012d:	8b 06                	mov    (%rsi),%eax
+  80012f:	8d 50 01             	lea    0x1(%rax),%edx
+  800132:	89 16                	mov    %edx,(%rsi)
+  800134:	48 98                	cltq
+  800136:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80013b:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800141:	74 0a                	je     80014d <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800143:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800147:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80014b:	c9                   	leave
+  80014c:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80014d:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800151:	be ff 00 00 00       	mov    $0xff,%esi
+  800156:	48 b8 1a 0f 80 00 00 	movabs $0x800f1a,%rax
+  80015d:	00 00 00 
+  800160:	ff d0                	call   *%rax
+        state->offset = 0;
+  800162:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800168:	eb d9                	jmp    800143 <putch+0x22>
+
+000000000080016a <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80016a:	55                   	push   %rbp
+  80016b:	48 89 e5             	mov    %rsp,%rbp
+  80016e:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800175:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800178:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80017f:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800184:	b8 00 00 00 00       	mov    $0x0,%eax
+  800189:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80018c:	48 89 f1             	mov    %rsi,%rcx
+  80018f:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800196:	48 bf 21 01 80 00 00 	movabs $0x800121,%rdi
+  80019d:	00 00 00 
+  8001a0:	48 b8 1e 03 80 00 00 	movabs $0x80031e,%rax
+  8001a7:	00 00 00 
+  8001aa:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8001ac:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8001b3:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8001ba:	48 b8 1a 0f 80 00 00 	movabs $0x800f1a,%rax
+  8001c1:	00 00 00 
+  8001c4:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8001c6:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8001cc:	c9                   	leave
+  8001cd:	c3                   	ret
+
+00000000008001ce <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8001ce:	55                   	push   %rbp
+  8001cf:	48 89 e5             	mov    %rsp,%rbp
+  8001d2:	48 83 ec 50          	sub    $0x50,%rsp
+  8001d6:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8001da:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8001de:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8001e2:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8001e6:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8001ea:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8001f1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8001f5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8001f9:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8001fd:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800201:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800205:	48 b8 6a 01 80 00 00 	movabs $0x80016a,%rax
+  80020c:	00 00 00 
+  80020f:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800211:	c9                   	leave
+  800212:	c3                   	ret
+
+0000000000800213 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800213:	55                   	push   %rbp
+  800214:	48 89 e5             	mov    %rsp,%rbp
+  800217:	41 57                	push   %r15
+  800219:	41 56                	push   %r14
+  80021b:	41 55                	push   %r13
+  80021d:	41 54                	push   %r12
+  80021f:	53                   	push   %rbx
+  800220:	48 83 ec 18          	sub    $0x18,%rsp
+  800224:	49 89 fc             	mov    %rdi,%r12
+  800227:	49 89 f5             	mov    %rsi,%r13
+  80022a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80022e:	8b 45 10             	mov    0x10(%rbp),%eax
+  800231:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800234:	41 89 cf             	mov    %ecx,%r15d
+  800237:	4c 39 fa             	cmp    %r15,%rdx
+  80023a:	73 5b                	jae    800297 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80023c:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800240:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800244:	85 db                	test   %ebx,%ebx
+  800246:	7e 0e                	jle    800256 <print_num+0x43>
+            putch(padc, put_arg);
+  800248:	4c 89 ee             	mov    %r13,%rsi
+  80024b:	44 89 f7             	mov    %r14d,%edi
+  80024e:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800251:	83 eb 01             	sub    $0x1,%ebx
+  800254:	75 f2                	jne    800248 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800256:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80025a:	48 b9 c7 46 80 00 00 	movabs $0x8046c7,%rcx
+  800261:	00 00 00 
+  800264:	48 b8 b6 46 80 00 00 	movabs $0x8046b6,%rax
+  80026b:	00 00 00 
+  80026e:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800272:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800276:	ba 00 00 00 00       	mov    $0x0,%edx
+  80027b:	49 f7 f7             	div    %r15
+  80027e:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800282:	4c 89 ee             	mov    %r13,%rsi
+  800285:	41 ff d4             	call   *%r12
+}
+  800288:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80028c:	5b                   	pop    %rbx
+  80028d:	41 5c                	pop    %r12
+  80028f:	41 5d                	pop    %r13
+  800291:	41 5e                	pop    %r14
+  800293:	41 5f                	pop    %r15
+  800295:	5d                   	pop    %rbp
+  800296:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800297:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80029b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002a0:	49 f7 f7             	div    %r15
+  8002a3:	48 83 ec 08          	sub    $0x8,%rsp
+  8002a7:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8002ab:	52                   	push   %rdx
+  8002ac:	45 0f be c9          	movsbl %r9b,%r9d
+  8002b0:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8002b4:	48 89 c2             	mov    %rax,%rdx
+  8002b7:	48 b8 13 02 80 00 00 	movabs $0x800213,%rax
+  8002be:	00 00 00 
+  8002c1:	ff d0                	call   *%rax
+  8002c3:	48 83 c4 10          	add    $0x10,%rsp
+  8002c7:	eb 8d                	jmp    800256 <print_num+0x43>
+
+00000000008002c9 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8002c9:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8002cd:	48 8b 06             	mov    (%rsi),%rax
+  8002d0:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8002d4:	73 0a                	jae    8002e0 <sprintputch+0x17>
+        *state->start++ = ch;
+  8002d6:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8002da:	48 89 16             	mov    %rdx,(%rsi)
+  8002dd:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8002e0:	c3                   	ret
+
+00000000008002e1 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8002e1:	55                   	push   %rbp
+  8002e2:	48 89 e5             	mov    %rsp,%rbp
+  8002e5:	48 83 ec 50          	sub    $0x50,%rsp
+  8002e9:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8002ed:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8002f1:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8002f5:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8002fc:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800300:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800304:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800308:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80030c:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800310:	48 b8 1e 03 80 00 00 	movabs $0x80031e,%rax
+  800317:	00 00 00 
+  80031a:	ff d0                	call   *%rax
+}
+  80031c:	c9                   	leave
+  80031d:	c3                   	ret
+
+000000000080031e <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80031e:	55                   	push   %rbp
+  80031f:	48 89 e5             	mov    %rsp,%rbp
+  800322:	41 57                	push   %r15
+  800324:	41 56                	push   %r14
+  800326:	41 55                	push   %r13
+  800328:	41 54                	push   %r12
+  80032a:	53                   	push   %rbx
+  80032b:	48 83 ec 38          	sub    $0x38,%rsp
+  80032f:	49 89 fe             	mov    %rdi,%r14
+  800332:	49 89 f5             	mov    %rsi,%r13
+  800335:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800338:	48 8b 01             	mov    (%rcx),%rax
+  80033b:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80033f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800343:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800347:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80034b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80034f:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800353:	0f b6 3b             	movzbl (%rbx),%edi
+  800356:	40 80 ff 25          	cmp    $0x25,%dil
+  80035a:	74 18                	je     800374 <vprintfmt+0x56>
+            if (!ch) return;
+  80035c:	40 84 ff             	test   %dil,%dil
+  80035f:	0f 84 b1 06 00 00    	je     800a16 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800365:	40 0f b6 ff          	movzbl %dil,%edi
+  800369:	4c 89 ee             	mov    %r13,%rsi
+  80036c:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80036f:	4c 89 e3             	mov    %r12,%rbx
+  800372:	eb db                	jmp    80034f <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800374:	be 00 00 00 00       	mov    $0x0,%esi
+  800379:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80037d:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800382:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800388:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80038f:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800393:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800398:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80039d:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8003a0:	83 e8 23             	sub    $0x23,%eax
+  8003a3:	3c 57                	cmp    $0x57,%al
+  8003a5:	0f 87 51 06 00 00    	ja     8009fc <vprintfmt+0x6de>
+  8003ab:	0f b6 c0             	movzbl %al,%eax
+  8003ae:	48 b9 80 48 80 00 00 	movabs $0x804880,%rcx
+  8003b5:	00 00 00 
+  8003b8:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8003bb:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8003be:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8003c2:	eb cf                	jmp    800393 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8003c4:	49 89 dc             	mov    %rbx,%r12
+  8003c7:	be 01 00 00 00       	mov    $0x1,%esi
+  8003cc:	eb c5                	jmp    800393 <vprintfmt+0x75>
+            padc = ch;
+  8003ce:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8003d2:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8003d5:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8003d8:	eb b9                	jmp    800393 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8003da:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8003dd:	83 f8 2f             	cmp    $0x2f,%eax
+  8003e0:	77 24                	ja     800406 <vprintfmt+0xe8>
+  8003e2:	89 c1                	mov    %eax,%ecx
+  8003e4:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8003e8:	83 c0 08             	add    $0x8,%eax
+  8003eb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8003ee:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8003f1:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8003f4:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8003f8:	79 99                	jns    800393 <vprintfmt+0x75>
+                width = precision;
+  8003fa:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8003fe:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800404:	eb 8d                	jmp    800393 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800406:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80040a:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80040e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800412:	eb da                	jmp    8003ee <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800414:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800419:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80041d:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800423:	3c 39                	cmp    $0x39,%al
+  800425:	77 1c                	ja     800443 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800427:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80042b:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80042f:	0f b6 c0             	movzbl %al,%eax
+  800432:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800437:	0f b6 03             	movzbl (%rbx),%eax
+  80043a:	3c 39                	cmp    $0x39,%al
+  80043c:	76 e9                	jbe    800427 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80043e:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800441:	eb b1                	jmp    8003f4 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800443:	49 89 dc             	mov    %rbx,%r12
+  800446:	eb ac                	jmp    8003f4 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800448:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80044b:	85 c9                	test   %ecx,%ecx
+  80044d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800452:	0f 49 c1             	cmovns %ecx,%eax
+  800455:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800458:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80045b:	e9 33 ff ff ff       	jmp    800393 <vprintfmt+0x75>
+            lflag++;
+  800460:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800463:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800466:	e9 28 ff ff ff       	jmp    800393 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80046b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80046e:	83 f8 2f             	cmp    $0x2f,%eax
+  800471:	77 19                	ja     80048c <vprintfmt+0x16e>
+  800473:	89 c2                	mov    %eax,%edx
+  800475:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800479:	83 c0 08             	add    $0x8,%eax
+  80047c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80047f:	8b 3a                	mov    (%rdx),%edi
+  800481:	4c 89 ee             	mov    %r13,%rsi
+  800484:	41 ff d6             	call   *%r14
+            break;
+  800487:	e9 c3 fe ff ff       	jmp    80034f <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80048c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800490:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800494:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800498:	eb e5                	jmp    80047f <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80049a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80049d:	83 f8 2f             	cmp    $0x2f,%eax
+  8004a0:	77 5a                	ja     8004fc <vprintfmt+0x1de>
+  8004a2:	89 c2                	mov    %eax,%edx
+  8004a4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8004a8:	83 c0 08             	add    $0x8,%eax
+  8004ab:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8004ae:	8b 02                	mov    (%rdx),%eax
+  8004b0:	89 c1                	mov    %eax,%ecx
+  8004b2:	f7 d9                	neg    %ecx
+  8004b4:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8004b7:	83 f9 16             	cmp    $0x16,%ecx
+  8004ba:	7f 4e                	jg     80050a <vprintfmt+0x1ec>
+  8004bc:	48 63 c1             	movslq %ecx,%rax
+  8004bf:	48 ba 40 4b 80 00 00 	movabs $0x804b40,%rdx
+  8004c6:	00 00 00 
+  8004c9:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8004cd:	48 85 c0             	test   %rax,%rax
+  8004d0:	74 38                	je     80050a <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8004d2:	48 89 c1             	mov    %rax,%rcx
+  8004d5:	48 ba 19 4d 80 00 00 	movabs $0x804d19,%rdx
+  8004dc:	00 00 00 
+  8004df:	4c 89 ee             	mov    %r13,%rsi
+  8004e2:	4c 89 f7             	mov    %r14,%rdi
+  8004e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004ea:	49 b8 e1 02 80 00 00 	movabs $0x8002e1,%r8
+  8004f1:	00 00 00 
+  8004f4:	41 ff d0             	call   *%r8
+  8004f7:	e9 53 fe ff ff       	jmp    80034f <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8004fc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800500:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800504:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800508:	eb a4                	jmp    8004ae <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80050a:	48 ba df 46 80 00 00 	movabs $0x8046df,%rdx
+  800511:	00 00 00 
+  800514:	4c 89 ee             	mov    %r13,%rsi
+  800517:	4c 89 f7             	mov    %r14,%rdi
+  80051a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80051f:	49 b8 e1 02 80 00 00 	movabs $0x8002e1,%r8
+  800526:	00 00 00 
+  800529:	41 ff d0             	call   *%r8
+  80052c:	e9 1e fe ff ff       	jmp    80034f <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800531:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800534:	83 f8 2f             	cmp    $0x2f,%eax
+  800537:	77 6c                	ja     8005a5 <vprintfmt+0x287>
+  800539:	89 c2                	mov    %eax,%edx
+  80053b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80053f:	83 c0 08             	add    $0x8,%eax
+  800542:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800545:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800548:	48 85 d2             	test   %rdx,%rdx
+  80054b:	48 b8 d8 46 80 00 00 	movabs $0x8046d8,%rax
+  800552:	00 00 00 
+  800555:	48 0f 45 c2          	cmovne %rdx,%rax
+  800559:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80055d:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800561:	7e 06                	jle    800569 <vprintfmt+0x24b>
+  800563:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800567:	75 4a                	jne    8005b3 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800569:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80056d:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800571:	0f b6 00             	movzbl (%rax),%eax
+  800574:	84 c0                	test   %al,%al
+  800576:	0f 85 9a 00 00 00    	jne    800616 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80057c:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80057f:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800583:	85 c0                	test   %eax,%eax
+  800585:	0f 8e c4 fd ff ff    	jle    80034f <vprintfmt+0x31>
+  80058b:	4c 89 ee             	mov    %r13,%rsi
+  80058e:	bf 20 00 00 00       	mov    $0x20,%edi
+  800593:	41 ff d6             	call   *%r14
+  800596:	41 83 ec 01          	sub    $0x1,%r12d
+  80059a:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80059e:	75 eb                	jne    80058b <vprintfmt+0x26d>
+  8005a0:	e9 aa fd ff ff       	jmp    80034f <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8005a5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005a9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005ad:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005b1:	eb 92                	jmp    800545 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8005b3:	49 63 f7             	movslq %r15d,%rsi
+  8005b6:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8005ba:	48 b8 d0 0a 80 00 00 	movabs $0x800ad0,%rax
+  8005c1:	00 00 00 
+  8005c4:	ff d0                	call   *%rax
+  8005c6:	48 89 c2             	mov    %rax,%rdx
+  8005c9:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005cc:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8005ce:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8005d1:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8005d4:	85 c0                	test   %eax,%eax
+  8005d6:	7e 91                	jle    800569 <vprintfmt+0x24b>
+  8005d8:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8005dd:	4c 89 ee             	mov    %r13,%rsi
+  8005e0:	44 89 e7             	mov    %r12d,%edi
+  8005e3:	41 ff d6             	call   *%r14
+  8005e6:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8005ea:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005ed:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8005f0:	75 eb                	jne    8005dd <vprintfmt+0x2bf>
+  8005f2:	e9 72 ff ff ff       	jmp    800569 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8005f7:	0f b6 f8             	movzbl %al,%edi
+  8005fa:	4c 89 ee             	mov    %r13,%rsi
+  8005fd:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800600:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800604:	49 83 c4 01          	add    $0x1,%r12
+  800608:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80060e:	84 c0                	test   %al,%al
+  800610:	0f 84 66 ff ff ff    	je     80057c <vprintfmt+0x25e>
+  800616:	45 85 ff             	test   %r15d,%r15d
+  800619:	78 0a                	js     800625 <vprintfmt+0x307>
+  80061b:	41 83 ef 01          	sub    $0x1,%r15d
+  80061f:	0f 88 57 ff ff ff    	js     80057c <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800625:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800629:	74 cc                	je     8005f7 <vprintfmt+0x2d9>
+  80062b:	8d 50 e0             	lea    -0x20(%rax),%edx
+  80062e:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800633:	80 fa 5e             	cmp    $0x5e,%dl
+  800636:	77 c2                	ja     8005fa <vprintfmt+0x2dc>
+  800638:	eb bd                	jmp    8005f7 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  80063a:	40 84 f6             	test   %sil,%sil
+  80063d:	75 26                	jne    800665 <vprintfmt+0x347>
+    switch (lflag) {
+  80063f:	85 d2                	test   %edx,%edx
+  800641:	74 59                	je     80069c <vprintfmt+0x37e>
+  800643:	83 fa 01             	cmp    $0x1,%edx
+  800646:	74 7b                	je     8006c3 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800648:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80064b:	83 f8 2f             	cmp    $0x2f,%eax
+  80064e:	0f 87 96 00 00 00    	ja     8006ea <vprintfmt+0x3cc>
+  800654:	89 c2                	mov    %eax,%edx
+  800656:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80065a:	83 c0 08             	add    $0x8,%eax
+  80065d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800660:	4c 8b 22             	mov    (%rdx),%r12
+  800663:	eb 17                	jmp    80067c <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800665:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800668:	83 f8 2f             	cmp    $0x2f,%eax
+  80066b:	77 21                	ja     80068e <vprintfmt+0x370>
+  80066d:	89 c2                	mov    %eax,%edx
+  80066f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800673:	83 c0 08             	add    $0x8,%eax
+  800676:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800679:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80067c:	4d 85 e4             	test   %r12,%r12
+  80067f:	78 7a                	js     8006fb <vprintfmt+0x3dd>
+            num = i;
+  800681:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800684:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800689:	e9 50 02 00 00       	jmp    8008de <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80068e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800692:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800696:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80069a:	eb dd                	jmp    800679 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  80069c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80069f:	83 f8 2f             	cmp    $0x2f,%eax
+  8006a2:	77 11                	ja     8006b5 <vprintfmt+0x397>
+  8006a4:	89 c2                	mov    %eax,%edx
+  8006a6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006aa:	83 c0 08             	add    $0x8,%eax
+  8006ad:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006b0:	4c 63 22             	movslq (%rdx),%r12
+  8006b3:	eb c7                	jmp    80067c <vprintfmt+0x35e>
+  8006b5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006b9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006bd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006c1:	eb ed                	jmp    8006b0 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8006c3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006c6:	83 f8 2f             	cmp    $0x2f,%eax
+  8006c9:	77 11                	ja     8006dc <vprintfmt+0x3be>
+  8006cb:	89 c2                	mov    %eax,%edx
+  8006cd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006d1:	83 c0 08             	add    $0x8,%eax
+  8006d4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006d7:	4c 8b 22             	mov    (%rdx),%r12
+  8006da:	eb a0                	jmp    80067c <vprintfmt+0x35e>
+  8006dc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006e0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006e4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006e8:	eb ed                	jmp    8006d7 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8006ea:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006ee:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006f2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006f6:	e9 65 ff ff ff       	jmp    800660 <vprintfmt+0x342>
+                putch('-', put_arg);
+  8006fb:	4c 89 ee             	mov    %r13,%rsi
+  8006fe:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800703:	41 ff d6             	call   *%r14
+                i = -i;
+  800706:	49 f7 dc             	neg    %r12
+  800709:	e9 73 ff ff ff       	jmp    800681 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  80070e:	40 84 f6             	test   %sil,%sil
+  800711:	75 32                	jne    800745 <vprintfmt+0x427>
+    switch (lflag) {
+  800713:	85 d2                	test   %edx,%edx
+  800715:	74 5d                	je     800774 <vprintfmt+0x456>
+  800717:	83 fa 01             	cmp    $0x1,%edx
+  80071a:	0f 84 82 00 00 00    	je     8007a2 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800720:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800723:	83 f8 2f             	cmp    $0x2f,%eax
+  800726:	0f 87 a5 00 00 00    	ja     8007d1 <vprintfmt+0x4b3>
+  80072c:	89 c2                	mov    %eax,%edx
+  80072e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800732:	83 c0 08             	add    $0x8,%eax
+  800735:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800738:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80073b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800740:	e9 99 01 00 00       	jmp    8008de <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800745:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800748:	83 f8 2f             	cmp    $0x2f,%eax
+  80074b:	77 19                	ja     800766 <vprintfmt+0x448>
+  80074d:	89 c2                	mov    %eax,%edx
+  80074f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800753:	83 c0 08             	add    $0x8,%eax
+  800756:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800759:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80075c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800761:	e9 78 01 00 00       	jmp    8008de <vprintfmt+0x5c0>
+  800766:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80076a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80076e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800772:	eb e5                	jmp    800759 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800774:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800777:	83 f8 2f             	cmp    $0x2f,%eax
+  80077a:	77 18                	ja     800794 <vprintfmt+0x476>
+  80077c:	89 c2                	mov    %eax,%edx
+  80077e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800782:	83 c0 08             	add    $0x8,%eax
+  800785:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800788:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80078a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80078f:	e9 4a 01 00 00       	jmp    8008de <vprintfmt+0x5c0>
+  800794:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800798:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80079c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007a0:	eb e6                	jmp    800788 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8007a2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007a5:	83 f8 2f             	cmp    $0x2f,%eax
+  8007a8:	77 19                	ja     8007c3 <vprintfmt+0x4a5>
+  8007aa:	89 c2                	mov    %eax,%edx
+  8007ac:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007b0:	83 c0 08             	add    $0x8,%eax
+  8007b3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007b6:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007b9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8007be:	e9 1b 01 00 00       	jmp    8008de <vprintfmt+0x5c0>
+  8007c3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007c7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007cb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007cf:	eb e5                	jmp    8007b6 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8007d1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007d5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007d9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007dd:	e9 56 ff ff ff       	jmp    800738 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8007e2:	40 84 f6             	test   %sil,%sil
+  8007e5:	75 2e                	jne    800815 <vprintfmt+0x4f7>
+    switch (lflag) {
+  8007e7:	85 d2                	test   %edx,%edx
+  8007e9:	74 59                	je     800844 <vprintfmt+0x526>
+  8007eb:	83 fa 01             	cmp    $0x1,%edx
+  8007ee:	74 7f                	je     80086f <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8007f0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007f3:	83 f8 2f             	cmp    $0x2f,%eax
+  8007f6:	0f 87 9f 00 00 00    	ja     80089b <vprintfmt+0x57d>
+  8007fc:	89 c2                	mov    %eax,%edx
+  8007fe:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800802:	83 c0 08             	add    $0x8,%eax
+  800805:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800808:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80080b:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800810:	e9 c9 00 00 00       	jmp    8008de <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800815:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800818:	83 f8 2f             	cmp    $0x2f,%eax
+  80081b:	77 19                	ja     800836 <vprintfmt+0x518>
+  80081d:	89 c2                	mov    %eax,%edx
+  80081f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800823:	83 c0 08             	add    $0x8,%eax
+  800826:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800829:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80082c:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800831:	e9 a8 00 00 00       	jmp    8008de <vprintfmt+0x5c0>
+  800836:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80083a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80083e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800842:	eb e5                	jmp    800829 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800844:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800847:	83 f8 2f             	cmp    $0x2f,%eax
+  80084a:	77 15                	ja     800861 <vprintfmt+0x543>
+  80084c:	89 c2                	mov    %eax,%edx
+  80084e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800852:	83 c0 08             	add    $0x8,%eax
+  800855:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800858:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  80085a:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  80085f:	eb 7d                	jmp    8008de <vprintfmt+0x5c0>
+  800861:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800865:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800869:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80086d:	eb e9                	jmp    800858 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  80086f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800872:	83 f8 2f             	cmp    $0x2f,%eax
+  800875:	77 16                	ja     80088d <vprintfmt+0x56f>
+  800877:	89 c2                	mov    %eax,%edx
+  800879:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80087d:	83 c0 08             	add    $0x8,%eax
+  800880:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800883:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800886:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  80088b:	eb 51                	jmp    8008de <vprintfmt+0x5c0>
+  80088d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800891:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800895:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800899:	eb e8                	jmp    800883 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  80089b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80089f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008a3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008a7:	e9 5c ff ff ff       	jmp    800808 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8008ac:	4c 89 ee             	mov    %r13,%rsi
+  8008af:	bf 30 00 00 00       	mov    $0x30,%edi
+  8008b4:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8008b7:	4c 89 ee             	mov    %r13,%rsi
+  8008ba:	bf 78 00 00 00       	mov    $0x78,%edi
+  8008bf:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8008c2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008c5:	83 f8 2f             	cmp    $0x2f,%eax
+  8008c8:	77 47                	ja     800911 <vprintfmt+0x5f3>
+  8008ca:	89 c2                	mov    %eax,%edx
+  8008cc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008d0:	83 c0 08             	add    $0x8,%eax
+  8008d3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008d6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8008d9:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8008de:	48 83 ec 08          	sub    $0x8,%rsp
+  8008e2:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8008e6:	0f 94 c0             	sete   %al
+  8008e9:	0f b6 c0             	movzbl %al,%eax
+  8008ec:	50                   	push   %rax
+  8008ed:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8008f2:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8008f6:	4c 89 ee             	mov    %r13,%rsi
+  8008f9:	4c 89 f7             	mov    %r14,%rdi
+  8008fc:	48 b8 13 02 80 00 00 	movabs $0x800213,%rax
+  800903:	00 00 00 
+  800906:	ff d0                	call   *%rax
+            break;
+  800908:	48 83 c4 10          	add    $0x10,%rsp
+  80090c:	e9 3e fa ff ff       	jmp    80034f <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800911:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800915:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800919:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80091d:	eb b7                	jmp    8008d6 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  80091f:	40 84 f6             	test   %sil,%sil
+  800922:	75 2b                	jne    80094f <vprintfmt+0x631>
+    switch (lflag) {
+  800924:	85 d2                	test   %edx,%edx
+  800926:	74 56                	je     80097e <vprintfmt+0x660>
+  800928:	83 fa 01             	cmp    $0x1,%edx
+  80092b:	74 7f                	je     8009ac <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  80092d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800930:	83 f8 2f             	cmp    $0x2f,%eax
+  800933:	0f 87 a2 00 00 00    	ja     8009db <vprintfmt+0x6bd>
+  800939:	89 c2                	mov    %eax,%edx
+  80093b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80093f:	83 c0 08             	add    $0x8,%eax
+  800942:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800945:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800948:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  80094d:	eb 8f                	jmp    8008de <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80094f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800952:	83 f8 2f             	cmp    $0x2f,%eax
+  800955:	77 19                	ja     800970 <vprintfmt+0x652>
+  800957:	89 c2                	mov    %eax,%edx
+  800959:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80095d:	83 c0 08             	add    $0x8,%eax
+  800960:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800963:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800966:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80096b:	e9 6e ff ff ff       	jmp    8008de <vprintfmt+0x5c0>
+  800970:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800974:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800978:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80097c:	eb e5                	jmp    800963 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  80097e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800981:	83 f8 2f             	cmp    $0x2f,%eax
+  800984:	77 18                	ja     80099e <vprintfmt+0x680>
+  800986:	89 c2                	mov    %eax,%edx
+  800988:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80098c:	83 c0 08             	add    $0x8,%eax
+  80098f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800992:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800994:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800999:	e9 40 ff ff ff       	jmp    8008de <vprintfmt+0x5c0>
+  80099e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009a2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009a6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009aa:	eb e6                	jmp    800992 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  8009ac:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009af:	83 f8 2f             	cmp    $0x2f,%eax
+  8009b2:	77 19                	ja     8009cd <vprintfmt+0x6af>
+  8009b4:	89 c2                	mov    %eax,%edx
+  8009b6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009ba:	83 c0 08             	add    $0x8,%eax
+  8009bd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009c0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009c3:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  8009c8:	e9 11 ff ff ff       	jmp    8008de <vprintfmt+0x5c0>
+  8009cd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009d1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009d5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009d9:	eb e5                	jmp    8009c0 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  8009db:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009df:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009e3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009e7:	e9 59 ff ff ff       	jmp    800945 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  8009ec:	4c 89 ee             	mov    %r13,%rsi
+  8009ef:	bf 25 00 00 00       	mov    $0x25,%edi
+  8009f4:	41 ff d6             	call   *%r14
+            break;
+  8009f7:	e9 53 f9 ff ff       	jmp    80034f <vprintfmt+0x31>
+            putch('%', put_arg);
+  8009fc:	4c 89 ee             	mov    %r13,%rsi
+  8009ff:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a04:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800a07:	48 83 eb 01          	sub    $0x1,%rbx
+  800a0b:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800a0f:	75 f6                	jne    800a07 <vprintfmt+0x6e9>
+  800a11:	e9 39 f9 ff ff       	jmp    80034f <vprintfmt+0x31>
+}
+  800a16:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800a1a:	5b                   	pop    %rbx
+  800a1b:	41 5c                	pop    %r12
+  800a1d:	41 5d                	pop    %r13
+  800a1f:	41 5e                	pop    %r14
+  800a21:	41 5f                	pop    %r15
+  800a23:	5d                   	pop    %rbp
+  800a24:	c3                   	ret
+
+0000000000800a25 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800a25:	55                   	push   %rbp
+  800a26:	48 89 e5             	mov    %rsp,%rbp
+  800a29:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800a2d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a31:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800a36:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800a3a:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800a41:	48 85 ff             	test   %rdi,%rdi
+  800a44:	74 2b                	je     800a71 <vsnprintf+0x4c>
+  800a46:	48 85 f6             	test   %rsi,%rsi
+  800a49:	74 26                	je     800a71 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800a4b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800a4f:	48 bf c9 02 80 00 00 	movabs $0x8002c9,%rdi
+  800a56:	00 00 00 
+  800a59:	48 b8 1e 03 80 00 00 	movabs $0x80031e,%rax
+  800a60:	00 00 00 
+  800a63:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800a65:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a69:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800a6c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800a6f:	c9                   	leave
+  800a70:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800a71:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a76:	eb f7                	jmp    800a6f <vsnprintf+0x4a>
+
+0000000000800a78 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800a78:	55                   	push   %rbp
+  800a79:	48 89 e5             	mov    %rsp,%rbp
+  800a7c:	48 83 ec 50          	sub    $0x50,%rsp
+  800a80:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800a84:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800a88:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800a8c:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800a93:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800a97:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a9b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800a9f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800aa3:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800aa7:	48 b8 25 0a 80 00 00 	movabs $0x800a25,%rax
+  800aae:	00 00 00 
+  800ab1:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800ab3:	c9                   	leave
+  800ab4:	c3                   	ret
+
+0000000000800ab5 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800ab5:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800ab8:	74 10                	je     800aca <strlen+0x15>
+    size_t n = 0;
+  800aba:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800abf:	48 83 c0 01          	add    $0x1,%rax
+  800ac3:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800ac7:	75 f6                	jne    800abf <strlen+0xa>
+  800ac9:	c3                   	ret
+    size_t n = 0;
+  800aca:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800acf:	c3                   	ret
+
+0000000000800ad0 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800ad0:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800ad3:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800ad8:	48 85 f6             	test   %rsi,%rsi
+  800adb:	74 11                	je     800aee <strnlen+0x1e>
+  800add:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800ae1:	74 0c                	je     800aef <strnlen+0x1f>
+  800ae3:	48 83 c2 01          	add    $0x1,%rdx
+  800ae7:	48 39 d0             	cmp    %rdx,%rax
+  800aea:	75 f1                	jne    800add <strnlen+0xd>
+  800aec:	eb 04                	jmp    800af2 <strnlen+0x22>
+  800aee:	c3                   	ret
+  800aef:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800af2:	c3                   	ret
+
+0000000000800af3 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800af3:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800af6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800afb:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800aff:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800b02:	48 83 c2 01          	add    $0x1,%rdx
+  800b06:	84 c9                	test   %cl,%cl
+  800b08:	75 f1                	jne    800afb <strcpy+0x8>
+        ;
+    return res;
+}
+  800b0a:	c3                   	ret
+
+0000000000800b0b <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800b0b:	55                   	push   %rbp
+  800b0c:	48 89 e5             	mov    %rsp,%rbp
+  800b0f:	41 54                	push   %r12
+  800b11:	53                   	push   %rbx
+  800b12:	48 89 fb             	mov    %rdi,%rbx
+  800b15:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800b18:	48 b8 b5 0a 80 00 00 	movabs $0x800ab5,%rax
+  800b1f:	00 00 00 
+  800b22:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800b24:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800b28:	4c 89 e6             	mov    %r12,%rsi
+  800b2b:	48 b8 f3 0a 80 00 00 	movabs $0x800af3,%rax
+  800b32:	00 00 00 
+  800b35:	ff d0                	call   *%rax
+    return dst;
+}
+  800b37:	48 89 d8             	mov    %rbx,%rax
+  800b3a:	5b                   	pop    %rbx
+  800b3b:	41 5c                	pop    %r12
+  800b3d:	5d                   	pop    %rbp
+  800b3e:	c3                   	ret
+
+0000000000800b3f <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800b3f:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800b42:	48 85 d2             	test   %rdx,%rdx
+  800b45:	74 1f                	je     800b66 <strncpy+0x27>
+  800b47:	48 01 fa             	add    %rdi,%rdx
+  800b4a:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800b4d:	48 83 c1 01          	add    $0x1,%rcx
+  800b51:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800b55:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800b59:	41 80 f8 01          	cmp    $0x1,%r8b
+  800b5d:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800b61:	48 39 ca             	cmp    %rcx,%rdx
+  800b64:	75 e7                	jne    800b4d <strncpy+0xe>
+    }
+    return ret;
+}
+  800b66:	c3                   	ret
+
+0000000000800b67 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800b67:	48 89 f8             	mov    %rdi,%rax
+  800b6a:	48 85 d2             	test   %rdx,%rdx
+  800b6d:	74 24                	je     800b93 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800b6f:	48 83 ea 01          	sub    $0x1,%rdx
+  800b73:	74 1b                	je     800b90 <strlcpy+0x29>
+  800b75:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800b79:	0f b6 16             	movzbl (%rsi),%edx
+  800b7c:	84 d2                	test   %dl,%dl
+  800b7e:	74 10                	je     800b90 <strlcpy+0x29>
+            *dst++ = *src++;
+  800b80:	48 83 c6 01          	add    $0x1,%rsi
+  800b84:	48 83 c0 01          	add    $0x1,%rax
+  800b88:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800b8b:	48 39 c8             	cmp    %rcx,%rax
+  800b8e:	75 e9                	jne    800b79 <strlcpy+0x12>
+        *dst = '\0';
+  800b90:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800b93:	48 29 f8             	sub    %rdi,%rax
+}
+  800b96:	c3                   	ret
+
+0000000000800b97 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800b97:	0f b6 07             	movzbl (%rdi),%eax
+  800b9a:	84 c0                	test   %al,%al
+  800b9c:	74 13                	je     800bb1 <strcmp+0x1a>
+  800b9e:	38 06                	cmp    %al,(%rsi)
+  800ba0:	75 0f                	jne    800bb1 <strcmp+0x1a>
+  800ba2:	48 83 c7 01          	add    $0x1,%rdi
+  800ba6:	48 83 c6 01          	add    $0x1,%rsi
+  800baa:	0f b6 07             	movzbl (%rdi),%eax
+  800bad:	84 c0                	test   %al,%al
+  800baf:	75 ed                	jne    800b9e <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800bb1:	0f b6 c0             	movzbl %al,%eax
+  800bb4:	0f b6 16             	movzbl (%rsi),%edx
+  800bb7:	29 d0                	sub    %edx,%eax
+}
+  800bb9:	c3                   	ret
+
+0000000000800bba <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800bba:	48 85 d2             	test   %rdx,%rdx
+  800bbd:	74 1f                	je     800bde <strncmp+0x24>
+  800bbf:	0f b6 07             	movzbl (%rdi),%eax
+  800bc2:	84 c0                	test   %al,%al
+  800bc4:	74 1e                	je     800be4 <strncmp+0x2a>
+  800bc6:	3a 06                	cmp    (%rsi),%al
+  800bc8:	75 1a                	jne    800be4 <strncmp+0x2a>
+  800bca:	48 83 c7 01          	add    $0x1,%rdi
+  800bce:	48 83 c6 01          	add    $0x1,%rsi
+  800bd2:	48 83 ea 01          	sub    $0x1,%rdx
+  800bd6:	75 e7                	jne    800bbf <strncmp+0x5>
+
+    if (!n) return 0;
+  800bd8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bdd:	c3                   	ret
+  800bde:	b8 00 00 00 00       	mov    $0x0,%eax
+  800be3:	c3                   	ret
+  800be4:	48 85 d2             	test   %rdx,%rdx
+  800be7:	74 09                	je     800bf2 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800be9:	0f b6 07             	movzbl (%rdi),%eax
+  800bec:	0f b6 16             	movzbl (%rsi),%edx
+  800bef:	29 d0                	sub    %edx,%eax
+  800bf1:	c3                   	ret
+    if (!n) return 0;
+  800bf2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800bf7:	c3                   	ret
+
+0000000000800bf8 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800bf8:	0f b6 17             	movzbl (%rdi),%edx
+  800bfb:	84 d2                	test   %dl,%dl
+  800bfd:	74 18                	je     800c17 <strchr+0x1f>
+        if (*str == c) {
+  800bff:	0f be d2             	movsbl %dl,%edx
+  800c02:	39 f2                	cmp    %esi,%edx
+  800c04:	74 17                	je     800c1d <strchr+0x25>
+    for (; *str; str++) {
+  800c06:	48 83 c7 01          	add    $0x1,%rdi
+  800c0a:	0f b6 17             	movzbl (%rdi),%edx
+  800c0d:	84 d2                	test   %dl,%dl
+  800c0f:	75 ee                	jne    800bff <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800c11:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c16:	c3                   	ret
+  800c17:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c1c:	c3                   	ret
+  800c1d:	48 89 f8             	mov    %rdi,%rax
+}
+  800c20:	c3                   	ret
+
+0000000000800c21 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800c21:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800c24:	0f b6 17             	movzbl (%rdi),%edx
+  800c27:	84 d2                	test   %dl,%dl
+  800c29:	74 13                	je     800c3e <strfind+0x1d>
+  800c2b:	0f be d2             	movsbl %dl,%edx
+  800c2e:	39 f2                	cmp    %esi,%edx
+  800c30:	74 0b                	je     800c3d <strfind+0x1c>
+  800c32:	48 83 c0 01          	add    $0x1,%rax
+  800c36:	0f b6 10             	movzbl (%rax),%edx
+  800c39:	84 d2                	test   %dl,%dl
+  800c3b:	75 ee                	jne    800c2b <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800c3d:	c3                   	ret
+  800c3e:	c3                   	ret
+
+0000000000800c3f <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800c3f:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800c42:	48 89 f8             	mov    %rdi,%rax
+  800c45:	48 f7 d8             	neg    %rax
+  800c48:	83 e0 07             	and    $0x7,%eax
+  800c4b:	49 89 d1             	mov    %rdx,%r9
+  800c4e:	49 29 c1             	sub    %rax,%r9
+  800c51:	78 36                	js     800c89 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800c53:	40 0f b6 c6          	movzbl %sil,%eax
+  800c57:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800c5e:	01 01 01 
+  800c61:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800c65:	40 f6 c7 07          	test   $0x7,%dil
+  800c69:	75 38                	jne    800ca3 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800c6b:	4c 89 c9             	mov    %r9,%rcx
+  800c6e:	48 c1 f9 03          	sar    $0x3,%rcx
+  800c72:	74 0c                	je     800c80 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800c74:	fc                   	cld
+  800c75:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800c78:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800c7c:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800c80:	4d 85 c9             	test   %r9,%r9
+  800c83:	75 45                	jne    800cca <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800c85:	4c 89 c0             	mov    %r8,%rax
+  800c88:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800c89:	48 85 d2             	test   %rdx,%rdx
+  800c8c:	74 f7                	je     800c85 <memset+0x46>
+  800c8e:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800c91:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800c94:	48 83 c0 01          	add    $0x1,%rax
+  800c98:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800c9c:	48 39 c2             	cmp    %rax,%rdx
+  800c9f:	75 f3                	jne    800c94 <memset+0x55>
+  800ca1:	eb e2                	jmp    800c85 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800ca3:	40 f6 c7 01          	test   $0x1,%dil
+  800ca7:	74 06                	je     800caf <memset+0x70>
+  800ca9:	88 07                	mov    %al,(%rdi)
+  800cab:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800caf:	40 f6 c7 02          	test   $0x2,%dil
+  800cb3:	74 07                	je     800cbc <memset+0x7d>
+  800cb5:	66 89 07             	mov    %ax,(%rdi)
+  800cb8:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800cbc:	40 f6 c7 04          	test   $0x4,%dil
+  800cc0:	74 a9                	je     800c6b <memset+0x2c>
+  800cc2:	89 07                	mov    %eax,(%rdi)
+  800cc4:	48 83 c7 04          	add    $0x4,%rdi
+  800cc8:	eb a1                	jmp    800c6b <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800cca:	41 f6 c1 04          	test   $0x4,%r9b
+  800cce:	74 06                	je     800cd6 <memset+0x97>
+  800cd0:	89 07                	mov    %eax,(%rdi)
+  800cd2:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800cd6:	41 f6 c1 02          	test   $0x2,%r9b
+  800cda:	74 07                	je     800ce3 <memset+0xa4>
+  800cdc:	66 89 07             	mov    %ax,(%rdi)
+  800cdf:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800ce3:	41 f6 c1 01          	test   $0x1,%r9b
+  800ce7:	74 9c                	je     800c85 <memset+0x46>
+  800ce9:	88 07                	mov    %al,(%rdi)
+  800ceb:	eb 98                	jmp    800c85 <memset+0x46>
+
+0000000000800ced <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800ced:	48 89 f8             	mov    %rdi,%rax
+  800cf0:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800cf3:	48 39 fe             	cmp    %rdi,%rsi
+  800cf6:	73 3b                	jae    800d33 <memmove+0x46>
+  800cf8:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800cfc:	48 39 d7             	cmp    %rdx,%rdi
+  800cff:	73 32                	jae    800d33 <memmove+0x46>
+        s += n;
+        d += n;
+  800d01:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d05:	48 89 d6             	mov    %rdx,%rsi
+  800d08:	48 09 fe             	or     %rdi,%rsi
+  800d0b:	48 09 ce             	or     %rcx,%rsi
+  800d0e:	40 f6 c6 07          	test   $0x7,%sil
+  800d12:	75 12                	jne    800d26 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800d14:	48 83 ef 08          	sub    $0x8,%rdi
+  800d18:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800d1c:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d20:	fd                   	std
+  800d21:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800d24:	fc                   	cld
+  800d25:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800d26:	48 83 ef 01          	sub    $0x1,%rdi
+  800d2a:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800d2e:	fd                   	std
+  800d2f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800d31:	eb f1                	jmp    800d24 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d33:	48 89 f2             	mov    %rsi,%rdx
+  800d36:	48 09 c2             	or     %rax,%rdx
+  800d39:	48 09 ca             	or     %rcx,%rdx
+  800d3c:	f6 c2 07             	test   $0x7,%dl
+  800d3f:	75 0c                	jne    800d4d <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800d41:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d45:	48 89 c7             	mov    %rax,%rdi
+  800d48:	fc                   	cld
+  800d49:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800d4c:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800d4d:	48 89 c7             	mov    %rax,%rdi
+  800d50:	fc                   	cld
+  800d51:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800d53:	c3                   	ret
+
+0000000000800d54 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800d54:	55                   	push   %rbp
+  800d55:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800d58:	48 b8 ed 0c 80 00 00 	movabs $0x800ced,%rax
+  800d5f:	00 00 00 
+  800d62:	ff d0                	call   *%rax
+}
+  800d64:	5d                   	pop    %rbp
+  800d65:	c3                   	ret
+
+0000000000800d66 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800d66:	55                   	push   %rbp
+  800d67:	48 89 e5             	mov    %rsp,%rbp
+  800d6a:	41 57                	push   %r15
+  800d6c:	41 56                	push   %r14
+  800d6e:	41 55                	push   %r13
+  800d70:	41 54                	push   %r12
+  800d72:	53                   	push   %rbx
+  800d73:	48 83 ec 08          	sub    $0x8,%rsp
+  800d77:	49 89 fe             	mov    %rdi,%r14
+  800d7a:	49 89 f7             	mov    %rsi,%r15
+  800d7d:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800d80:	48 89 f7             	mov    %rsi,%rdi
+  800d83:	48 b8 b5 0a 80 00 00 	movabs $0x800ab5,%rax
+  800d8a:	00 00 00 
+  800d8d:	ff d0                	call   *%rax
+  800d8f:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800d92:	48 89 de             	mov    %rbx,%rsi
+  800d95:	4c 89 f7             	mov    %r14,%rdi
+  800d98:	48 b8 d0 0a 80 00 00 	movabs $0x800ad0,%rax
+  800d9f:	00 00 00 
+  800da2:	ff d0                	call   *%rax
+  800da4:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800da7:	48 39 c3             	cmp    %rax,%rbx
+  800daa:	74 36                	je     800de2 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800dac:	48 89 d8             	mov    %rbx,%rax
+  800daf:	4c 29 e8             	sub    %r13,%rax
+  800db2:	49 39 c4             	cmp    %rax,%r12
+  800db5:	73 31                	jae    800de8 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800db7:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800dbc:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800dc0:	4c 89 fe             	mov    %r15,%rsi
+  800dc3:	48 b8 54 0d 80 00 00 	movabs $0x800d54,%rax
+  800dca:	00 00 00 
+  800dcd:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800dcf:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800dd3:	48 83 c4 08          	add    $0x8,%rsp
+  800dd7:	5b                   	pop    %rbx
+  800dd8:	41 5c                	pop    %r12
+  800dda:	41 5d                	pop    %r13
+  800ddc:	41 5e                	pop    %r14
+  800dde:	41 5f                	pop    %r15
+  800de0:	5d                   	pop    %rbp
+  800de1:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800de2:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800de6:	eb eb                	jmp    800dd3 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800de8:	48 83 eb 01          	sub    $0x1,%rbx
+  800dec:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800df0:	48 89 da             	mov    %rbx,%rdx
+  800df3:	4c 89 fe             	mov    %r15,%rsi
+  800df6:	48 b8 54 0d 80 00 00 	movabs $0x800d54,%rax
+  800dfd:	00 00 00 
+  800e00:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800e02:	49 01 de             	add    %rbx,%r14
+  800e05:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800e0a:	eb c3                	jmp    800dcf <strlcat+0x69>
+
+0000000000800e0c <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800e0c:	48 85 d2             	test   %rdx,%rdx
+  800e0f:	74 2d                	je     800e3e <memcmp+0x32>
+  800e11:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800e16:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800e1a:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800e1f:	44 38 c1             	cmp    %r8b,%cl
+  800e22:	75 0f                	jne    800e33 <memcmp+0x27>
+    while (n-- > 0) {
+  800e24:	48 83 c0 01          	add    $0x1,%rax
+  800e28:	48 39 c2             	cmp    %rax,%rdx
+  800e2b:	75 e9                	jne    800e16 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800e2d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e32:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800e33:	0f b6 c1             	movzbl %cl,%eax
+  800e36:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800e3a:	44 29 c0             	sub    %r8d,%eax
+  800e3d:	c3                   	ret
+    return 0;
+  800e3e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e43:	c3                   	ret
+
+0000000000800e44 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800e44:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800e48:	48 39 c7             	cmp    %rax,%rdi
+  800e4b:	73 0f                	jae    800e5c <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800e4d:	40 38 37             	cmp    %sil,(%rdi)
+  800e50:	74 0e                	je     800e60 <memfind+0x1c>
+    for (; src < end; src++) {
+  800e52:	48 83 c7 01          	add    $0x1,%rdi
+  800e56:	48 39 f8             	cmp    %rdi,%rax
+  800e59:	75 f2                	jne    800e4d <memfind+0x9>
+  800e5b:	c3                   	ret
+  800e5c:	48 89 f8             	mov    %rdi,%rax
+  800e5f:	c3                   	ret
+  800e60:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800e63:	c3                   	ret
+
+0000000000800e64 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800e64:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800e67:	0f b6 37             	movzbl (%rdi),%esi
+  800e6a:	40 80 fe 20          	cmp    $0x20,%sil
+  800e6e:	74 06                	je     800e76 <strtol+0x12>
+  800e70:	40 80 fe 09          	cmp    $0x9,%sil
+  800e74:	75 13                	jne    800e89 <strtol+0x25>
+  800e76:	48 83 c7 01          	add    $0x1,%rdi
+  800e7a:	0f b6 37             	movzbl (%rdi),%esi
+  800e7d:	40 80 fe 20          	cmp    $0x20,%sil
+  800e81:	74 f3                	je     800e76 <strtol+0x12>
+  800e83:	40 80 fe 09          	cmp    $0x9,%sil
+  800e87:	74 ed                	je     800e76 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800e89:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800e8c:	83 e0 fd             	and    $0xfffffffd,%eax
+  800e8f:	3c 01                	cmp    $0x1,%al
+  800e91:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800e95:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800e9b:	75 0f                	jne    800eac <strtol+0x48>
+  800e9d:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800ea0:	74 14                	je     800eb6 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800ea2:	85 d2                	test   %edx,%edx
+  800ea4:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ea9:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800eac:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800eb1:	4c 63 ca             	movslq %edx,%r9
+  800eb4:	eb 36                	jmp    800eec <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800eb6:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800eba:	74 0f                	je     800ecb <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800ebc:	85 d2                	test   %edx,%edx
+  800ebe:	75 ec                	jne    800eac <strtol+0x48>
+        s++;
+  800ec0:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800ec4:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800ec9:	eb e1                	jmp    800eac <strtol+0x48>
+        s += 2;
+  800ecb:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800ecf:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800ed4:	eb d6                	jmp    800eac <strtol+0x48>
+            dig -= '0';
+  800ed6:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800ed9:	44 0f b6 c1          	movzbl %cl,%r8d
+  800edd:	41 39 d0             	cmp    %edx,%r8d
+  800ee0:	7d 21                	jge    800f03 <strtol+0x9f>
+        val = val * base + dig;
+  800ee2:	49 0f af c1          	imul   %r9,%rax
+  800ee6:	0f b6 c9             	movzbl %cl,%ecx
+  800ee9:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800eec:	48 83 c7 01          	add    $0x1,%rdi
+  800ef0:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800ef4:	80 f9 39             	cmp    $0x39,%cl
+  800ef7:	76 dd                	jbe    800ed6 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800ef9:	80 f9 7b             	cmp    $0x7b,%cl
+  800efc:	77 05                	ja     800f03 <strtol+0x9f>
+            dig -= 'a' - 10;
+  800efe:	83 e9 57             	sub    $0x57,%ecx
+  800f01:	eb d6                	jmp    800ed9 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800f03:	4d 85 d2             	test   %r10,%r10
+  800f06:	74 03                	je     800f0b <strtol+0xa7>
+  800f08:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800f0b:	48 89 c2             	mov    %rax,%rdx
+  800f0e:	48 f7 da             	neg    %rdx
+  800f11:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800f15:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800f19:	c3                   	ret
+
+0000000000800f1a <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  800f1a:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800f1f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f24:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800f2a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800f30:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  800f36:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800f38:	c3                   	ret
+
+0000000000800f39 <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  800f39:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800f3e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f43:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800f48:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f4d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800f53:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800f59:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800f5f:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800f61:	c3                   	ret
+
+0000000000800f62 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800f62:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800f65:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800f6a:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800f6f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f74:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800f7a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800f80:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800f86:	0f 05                	syscall
+    if (check && ret > 0) {
+  800f88:	48 85 c0             	test   %rax,%rax
+  800f8b:	7f 01                	jg     800f8e <sys_env_destroy+0x2c>
+}
+  800f8d:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  800f8e:	55                   	push   %rbp
+  800f8f:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800f92:	49 89 c0             	mov    %rax,%r8
+  800f95:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800f9a:	48 ba 18 4c 80 00 00 	movabs $0x804c18,%rdx
+  800fa1:	00 00 00 
+  800fa4:	be 29 00 00 00       	mov    $0x29,%esi
+  800fa9:	48 bf 37 4c 80 00 00 	movabs $0x804c37,%rdi
+  800fb0:	00 00 00 
+  800fb3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fb8:	49 b9 70 41 80 00 00 	movabs $0x804170,%r9
+  800fbf:	00 00 00 
+  800fc2:	41 ff d1             	call   *%r9
+
+0000000000800fc5 <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  800fc5:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800fca:	bf 00 00 00 00       	mov    $0x0,%edi
+  800fcf:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800fd4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fd9:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800fdf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800fe5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800feb:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  800fed:	c3                   	ret
+
+0000000000800fee <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  800fee:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800ff3:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ff8:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800ffd:	ba 00 00 00 00       	mov    $0x0,%edx
+  801002:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801008:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80100e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801014:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801016:	c3                   	ret
+
+0000000000801017 <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  801017:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80101c:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  801023:	00 00 00 
+  801026:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80102c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801032:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801038:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80103a:	c3                   	ret
+
+000000000080103b <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80103b:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  80103e:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801043:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801049:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80104f:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801051:	c3                   	ret
+
+0000000000801052 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801052:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801055:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80105a:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80105d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801063:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801069:	0f 05                	syscall
+    if (check && ret > 0) {
+  80106b:	48 85 c0             	test   %rax,%rax
+  80106e:	7f 01                	jg     801071 <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801070:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801071:	55                   	push   %rbp
+  801072:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801075:	49 89 c0             	mov    %rax,%r8
+  801078:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80107d:	48 ba 18 4c 80 00 00 	movabs $0x804c18,%rdx
+  801084:	00 00 00 
+  801087:	be 29 00 00 00       	mov    $0x29,%esi
+  80108c:	48 bf 37 4c 80 00 00 	movabs $0x804c37,%rdi
+  801093:	00 00 00 
+  801096:	b8 00 00 00 00       	mov    $0x0,%eax
+  80109b:	49 b9 70 41 80 00 00 	movabs $0x804170,%r9
+  8010a2:	00 00 00 
+  8010a5:	41 ff d1             	call   *%r9
+
+00000000008010a8 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8010a8:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8010ab:	48 63 d2             	movslq %edx,%rdx
+  8010ae:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8010b1:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8010b6:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  8010b9:	0f 05                	syscall
+    if (check && ret > 0) {
+  8010bb:	48 85 c0             	test   %rax,%rax
+  8010be:	7f 01                	jg     8010c1 <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8010c0:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8010c1:	55                   	push   %rbp
+  8010c2:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8010c5:	49 89 c0             	mov    %rax,%r8
+  8010c8:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8010cd:	48 ba 18 4c 80 00 00 	movabs $0x804c18,%rdx
+  8010d4:	00 00 00 
+  8010d7:	be 29 00 00 00       	mov    $0x29,%esi
+  8010dc:	48 bf 37 4c 80 00 00 	movabs $0x804c37,%rdi
+  8010e3:	00 00 00 
+  8010e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010eb:	49 b9 70 41 80 00 00 	movabs $0x804170,%r9
+  8010f2:	00 00 00 
+  8010f5:	41 ff d1             	call   *%r9
+
+00000000008010f8 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8010f8:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8010fb:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801100:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801106:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80110c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801112:	0f 05                	syscall
+    if (check && ret > 0) {
+  801114:	48 85 c0             	test   %rax,%rax
+  801117:	7f 01                	jg     80111a <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801119:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80111a:	55                   	push   %rbp
+  80111b:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80111e:	49 89 c0             	mov    %rax,%r8
+  801121:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801126:	48 ba 18 4c 80 00 00 	movabs $0x804c18,%rdx
+  80112d:	00 00 00 
+  801130:	be 29 00 00 00       	mov    $0x29,%esi
+  801135:	48 bf 37 4c 80 00 00 	movabs $0x804c37,%rdi
+  80113c:	00 00 00 
+  80113f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801144:	49 b9 70 41 80 00 00 	movabs $0x804170,%r9
+  80114b:	00 00 00 
+  80114e:	41 ff d1             	call   *%r9
+
+0000000000801151 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801151:	48 63 f6             	movslq %esi,%rsi
+  801154:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801157:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80115c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801161:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801167:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80116d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801173:	0f 05                	syscall
+    if (check && ret > 0) {
+  801175:	48 85 c0             	test   %rax,%rax
+  801178:	7f 01                	jg     80117b <sys_env_set_status+0x2a>
+}
+  80117a:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  80117b:	55                   	push   %rbp
+  80117c:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80117f:	49 89 c0             	mov    %rax,%r8
+  801182:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801187:	48 ba 18 4c 80 00 00 	movabs $0x804c18,%rdx
+  80118e:	00 00 00 
+  801191:	be 29 00 00 00       	mov    $0x29,%esi
+  801196:	48 bf 37 4c 80 00 00 	movabs $0x804c37,%rdi
+  80119d:	00 00 00 
+  8011a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011a5:	49 b9 70 41 80 00 00 	movabs $0x804170,%r9
+  8011ac:	00 00 00 
+  8011af:	41 ff d1             	call   *%r9
+
+00000000008011b2 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8011b2:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8011b5:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8011ba:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011bf:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8011c5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011cb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8011d1:	0f 05                	syscall
+    if (check && ret > 0) {
+  8011d3:	48 85 c0             	test   %rax,%rax
+  8011d6:	7f 01                	jg     8011d9 <sys_env_set_trapframe+0x27>
+}
+  8011d8:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8011d9:	55                   	push   %rbp
+  8011da:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011dd:	49 89 c0             	mov    %rax,%r8
+  8011e0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8011e5:	48 ba 18 4c 80 00 00 	movabs $0x804c18,%rdx
+  8011ec:	00 00 00 
+  8011ef:	be 29 00 00 00       	mov    $0x29,%esi
+  8011f4:	48 bf 37 4c 80 00 00 	movabs $0x804c37,%rdi
+  8011fb:	00 00 00 
+  8011fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  801203:	49 b9 70 41 80 00 00 	movabs $0x804170,%r9
+  80120a:	00 00 00 
+  80120d:	41 ff d1             	call   *%r9
+
+0000000000801210 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801210:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801213:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801218:	ba 00 00 00 00       	mov    $0x0,%edx
+  80121d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801223:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801229:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80122f:	0f 05                	syscall
+    if (check && ret > 0) {
+  801231:	48 85 c0             	test   %rax,%rax
+  801234:	7f 01                	jg     801237 <sys_env_set_pgfault_upcall+0x27>
+}
+  801236:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801237:	55                   	push   %rbp
+  801238:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80123b:	49 89 c0             	mov    %rax,%r8
+  80123e:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801243:	48 ba 18 4c 80 00 00 	movabs $0x804c18,%rdx
+  80124a:	00 00 00 
+  80124d:	be 29 00 00 00       	mov    $0x29,%esi
+  801252:	48 bf 37 4c 80 00 00 	movabs $0x804c37,%rdi
+  801259:	00 00 00 
+  80125c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801261:	49 b9 70 41 80 00 00 	movabs $0x804170,%r9
+  801268:	00 00 00 
+  80126b:	41 ff d1             	call   *%r9
+
+000000000080126e <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80126e:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801271:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801274:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801279:	4d 63 c0             	movslq %r8d,%r8
+  80127c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801282:	0f 05                	syscall
+}
+  801284:	c3                   	ret
+
+0000000000801285 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801285:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801288:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80128b:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801290:	4d 63 c0             	movslq %r8d,%r8
+  801293:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801299:	0f 05                	syscall
+}
+  80129b:	c3                   	ret
+
+000000000080129c <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  80129c:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8012a1:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8012a4:	45 89 c0             	mov    %r8d,%r8d
+  8012a7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8012ad:	0f 05                	syscall
+    if (check && ret > 0) {
+  8012af:	48 85 c0             	test   %rax,%rax
+  8012b2:	7f 01                	jg     8012b5 <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8012b4:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8012b5:	55                   	push   %rbp
+  8012b6:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012b9:	49 89 c0             	mov    %rax,%r8
+  8012bc:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8012c1:	48 ba 18 4c 80 00 00 	movabs $0x804c18,%rdx
+  8012c8:	00 00 00 
+  8012cb:	be 29 00 00 00       	mov    $0x29,%esi
+  8012d0:	48 bf 37 4c 80 00 00 	movabs $0x804c37,%rdi
+  8012d7:	00 00 00 
+  8012da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012df:	49 b9 70 41 80 00 00 	movabs $0x804170,%r9
+  8012e6:	00 00 00 
+  8012e9:	41 ff d1             	call   *%r9
+
+00000000008012ec <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  8012ec:	55                   	push   %rbp
+  8012ed:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  8012f0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8012f6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012fb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801300:	48 b8 9c 12 80 00 00 	movabs $0x80129c,%rax
+  801307:	00 00 00 
+  80130a:	ff d0                	call   *%rax
+}
+  80130c:	5d                   	pop    %rbp
+  80130d:	c3                   	ret
+
+000000000080130e <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  80130e:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801313:	bf 00 00 00 00       	mov    $0x0,%edi
+  801318:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80131d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801322:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801328:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80132e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801334:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801336:	c3                   	ret
+
+0000000000801337 <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  801337:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80133c:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801341:	ba 00 00 00 00       	mov    $0x0,%edx
+  801346:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80134c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801352:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801358:	0f 05                	syscall
+    if (check && ret > 0) {
+  80135a:	48 85 c0             	test   %rax,%rax
+  80135d:	7f 01                	jg     801360 <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  80135f:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  801360:	55                   	push   %rbp
+  801361:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801364:	49 89 c0             	mov    %rax,%r8
+  801367:	b9 10 00 00 00       	mov    $0x10,%ecx
+  80136c:	48 ba 18 4c 80 00 00 	movabs $0x804c18,%rdx
+  801373:	00 00 00 
+  801376:	be 29 00 00 00       	mov    $0x29,%esi
+  80137b:	48 bf 37 4c 80 00 00 	movabs $0x804c37,%rdi
+  801382:	00 00 00 
+  801385:	b8 00 00 00 00       	mov    $0x0,%eax
+  80138a:	49 b9 70 41 80 00 00 	movabs $0x804170,%r9
+  801391:	00 00 00 
+  801394:	41 ff d1             	call   *%r9
+
+0000000000801397 <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  801397:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80139c:	bf 00 00 00 00       	mov    $0x0,%edi
+  8013a1:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8013a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013ab:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013b1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013b7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013bd:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  8013bf:	c3                   	ret
+
+00000000008013c0 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  8013c0:	89 d2                	mov    %edx,%edx
+  8013c2:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  8013c4:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8013c9:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013cf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013d5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013db:	0f 05                	syscall
+}
+  8013dd:	c3                   	ret
+
+00000000008013de <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  8013de:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  8013e1:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8013e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013eb:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013f1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013fd:	0f 05                	syscall
+}
+  8013ff:	c3                   	ret
+
+0000000000801400 <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  801400:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  801403:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801408:	ba 00 00 00 00       	mov    $0x0,%edx
+  80140d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801413:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801419:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80141f:	0f 05                	syscall
+}
+  801421:	c3                   	ret
+
+0000000000801422 <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  801422:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801425:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80142a:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80142f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801434:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80143a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801440:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801446:	0f 05                	syscall
+    if (check && ret > 0) {
+  801448:	48 85 c0             	test   %rax,%rax
+  80144b:	7f 01                	jg     80144e <sys_irq_ack+0x2c>
+}
+  80144d:	c3                   	ret
+sys_irq_ack(int irq) {
+  80144e:	55                   	push   %rbp
+  80144f:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801452:	49 89 c0             	mov    %rax,%r8
+  801455:	b9 16 00 00 00       	mov    $0x16,%ecx
+  80145a:	48 ba 18 4c 80 00 00 	movabs $0x804c18,%rdx
+  801461:	00 00 00 
+  801464:	be 29 00 00 00       	mov    $0x29,%esi
+  801469:	48 bf 37 4c 80 00 00 	movabs $0x804c37,%rdi
+  801470:	00 00 00 
+  801473:	b8 00 00 00 00       	mov    $0x0,%eax
+  801478:	49 b9 70 41 80 00 00 	movabs $0x804170,%r9
+  80147f:	00 00 00 
+  801482:	41 ff d1             	call   *%r9
+
+0000000000801485 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801485:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80148c:	ff ff ff 
+  80148f:	48 01 f8             	add    %rdi,%rax
+  801492:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801496:	c3                   	ret
+
+0000000000801497 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801497:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80149e:	ff ff ff 
+  8014a1:	48 01 f8             	add    %rdi,%rax
+  8014a4:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8014a8:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8014ae:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8014b2:	c3                   	ret
+
+00000000008014b3 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8014b3:	55                   	push   %rbp
+  8014b4:	48 89 e5             	mov    %rsp,%rbp
+  8014b7:	41 57                	push   %r15
+  8014b9:	41 56                	push   %r14
+  8014bb:	41 55                	push   %r13
+  8014bd:	41 54                	push   %r12
+  8014bf:	53                   	push   %rbx
+  8014c0:	48 83 ec 08          	sub    $0x8,%rsp
+  8014c4:	49 89 ff             	mov    %rdi,%r15
+  8014c7:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8014cc:	49 bd 42 3c 80 00 00 	movabs $0x803c42,%r13
+  8014d3:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8014d6:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8014dc:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8014df:	48 89 df             	mov    %rbx,%rdi
+  8014e2:	41 ff d5             	call   *%r13
+  8014e5:	83 e0 04             	and    $0x4,%eax
+  8014e8:	74 17                	je     801501 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8014ea:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8014f1:	4c 39 f3             	cmp    %r14,%rbx
+  8014f4:	75 e6                	jne    8014dc <fd_alloc+0x29>
+  8014f6:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8014fc:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801501:	4d 89 27             	mov    %r12,(%r15)
+}
+  801504:	48 83 c4 08          	add    $0x8,%rsp
+  801508:	5b                   	pop    %rbx
+  801509:	41 5c                	pop    %r12
+  80150b:	41 5d                	pop    %r13
+  80150d:	41 5e                	pop    %r14
+  80150f:	41 5f                	pop    %r15
+  801511:	5d                   	pop    %rbp
+  801512:	c3                   	ret
+
+0000000000801513 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801513:	83 ff 1f             	cmp    $0x1f,%edi
+  801516:	77 39                	ja     801551 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801518:	55                   	push   %rbp
+  801519:	48 89 e5             	mov    %rsp,%rbp
+  80151c:	41 54                	push   %r12
+  80151e:	53                   	push   %rbx
+  80151f:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801522:	48 63 df             	movslq %edi,%rbx
+  801525:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80152c:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801530:	48 89 df             	mov    %rbx,%rdi
+  801533:	48 b8 42 3c 80 00 00 	movabs $0x803c42,%rax
+  80153a:	00 00 00 
+  80153d:	ff d0                	call   *%rax
+  80153f:	a8 04                	test   $0x4,%al
+  801541:	74 14                	je     801557 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801543:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801547:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80154c:	5b                   	pop    %rbx
+  80154d:	41 5c                	pop    %r12
+  80154f:	5d                   	pop    %rbp
+  801550:	c3                   	ret
+        return -E_INVAL;
+  801551:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801556:	c3                   	ret
+        return -E_INVAL;
+  801557:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80155c:	eb ee                	jmp    80154c <fd_lookup+0x39>
+
+000000000080155e <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80155e:	55                   	push   %rbp
+  80155f:	48 89 e5             	mov    %rsp,%rbp
+  801562:	41 54                	push   %r12
+  801564:	53                   	push   %rbx
+  801565:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801568:	48 b8 e0 4c 80 00 00 	movabs $0x804ce0,%rax
+  80156f:	00 00 00 
+  801572:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  801579:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  80157c:	39 3b                	cmp    %edi,(%rbx)
+  80157e:	74 47                	je     8015c7 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801580:	48 83 c0 08          	add    $0x8,%rax
+  801584:	48 8b 18             	mov    (%rax),%rbx
+  801587:	48 85 db             	test   %rbx,%rbx
+  80158a:	75 f0                	jne    80157c <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80158c:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801593:	00 00 00 
+  801596:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80159c:	89 fa                	mov    %edi,%edx
+  80159e:	48 bf 48 4c 80 00 00 	movabs $0x804c48,%rdi
+  8015a5:	00 00 00 
+  8015a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015ad:	48 b9 ce 01 80 00 00 	movabs $0x8001ce,%rcx
+  8015b4:	00 00 00 
+  8015b7:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8015b9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8015be:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8015c2:	5b                   	pop    %rbx
+  8015c3:	41 5c                	pop    %r12
+  8015c5:	5d                   	pop    %rbp
+  8015c6:	c3                   	ret
+            return 0;
+  8015c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015cc:	eb f0                	jmp    8015be <dev_lookup+0x60>
+
+00000000008015ce <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8015ce:	55                   	push   %rbp
+  8015cf:	48 89 e5             	mov    %rsp,%rbp
+  8015d2:	41 55                	push   %r13
+  8015d4:	41 54                	push   %r12
+  8015d6:	53                   	push   %rbx
+  8015d7:	48 83 ec 18          	sub    $0x18,%rsp
+  8015db:	48 89 fb             	mov    %rdi,%rbx
+  8015de:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8015e1:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8015e8:	ff ff ff 
+  8015eb:	48 01 df             	add    %rbx,%rdi
+  8015ee:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8015f2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8015f6:	48 b8 13 15 80 00 00 	movabs $0x801513,%rax
+  8015fd:	00 00 00 
+  801600:	ff d0                	call   *%rax
+  801602:	41 89 c5             	mov    %eax,%r13d
+  801605:	85 c0                	test   %eax,%eax
+  801607:	78 06                	js     80160f <fd_close+0x41>
+  801609:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  80160d:	74 1a                	je     801629 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  80160f:	45 84 e4             	test   %r12b,%r12b
+  801612:	b8 00 00 00 00       	mov    $0x0,%eax
+  801617:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80161b:	44 89 e8             	mov    %r13d,%eax
+  80161e:	48 83 c4 18          	add    $0x18,%rsp
+  801622:	5b                   	pop    %rbx
+  801623:	41 5c                	pop    %r12
+  801625:	41 5d                	pop    %r13
+  801627:	5d                   	pop    %rbp
+  801628:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801629:	8b 3b                	mov    (%rbx),%edi
+  80162b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80162f:	48 b8 5e 15 80 00 00 	movabs $0x80155e,%rax
+  801636:	00 00 00 
+  801639:	ff d0                	call   *%rax
+  80163b:	41 89 c5             	mov    %eax,%r13d
+  80163e:	85 c0                	test   %eax,%eax
+  801640:	78 1b                	js     80165d <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801642:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801646:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80164a:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801650:	48 85 c0             	test   %rax,%rax
+  801653:	74 08                	je     80165d <fd_close+0x8f>
+  801655:	48 89 df             	mov    %rbx,%rdi
+  801658:	ff d0                	call   *%rax
+  80165a:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80165d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801662:	48 89 de             	mov    %rbx,%rsi
+  801665:	bf 00 00 00 00       	mov    $0x0,%edi
+  80166a:	48 b8 f8 10 80 00 00 	movabs $0x8010f8,%rax
+  801671:	00 00 00 
+  801674:	ff d0                	call   *%rax
+    return res;
+  801676:	eb a3                	jmp    80161b <fd_close+0x4d>
+
+0000000000801678 <close>:
+
+int
+close(int fdnum) {
+  801678:	55                   	push   %rbp
+  801679:	48 89 e5             	mov    %rsp,%rbp
+  80167c:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801680:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801684:	48 b8 13 15 80 00 00 	movabs $0x801513,%rax
+  80168b:	00 00 00 
+  80168e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801690:	85 c0                	test   %eax,%eax
+  801692:	78 15                	js     8016a9 <close+0x31>
+
+    return fd_close(fd, 1);
+  801694:	be 01 00 00 00       	mov    $0x1,%esi
+  801699:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80169d:	48 b8 ce 15 80 00 00 	movabs $0x8015ce,%rax
+  8016a4:	00 00 00 
+  8016a7:	ff d0                	call   *%rax
+}
+  8016a9:	c9                   	leave
+  8016aa:	c3                   	ret
+
+00000000008016ab <close_all>:
+
+void
+close_all(void) {
+  8016ab:	55                   	push   %rbp
+  8016ac:	48 89 e5             	mov    %rsp,%rbp
+  8016af:	41 54                	push   %r12
+  8016b1:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8016b2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016b7:	49 bc 78 16 80 00 00 	movabs $0x801678,%r12
+  8016be:	00 00 00 
+  8016c1:	89 df                	mov    %ebx,%edi
+  8016c3:	41 ff d4             	call   *%r12
+  8016c6:	83 c3 01             	add    $0x1,%ebx
+  8016c9:	83 fb 20             	cmp    $0x20,%ebx
+  8016cc:	75 f3                	jne    8016c1 <close_all+0x16>
+}
+  8016ce:	5b                   	pop    %rbx
+  8016cf:	41 5c                	pop    %r12
+  8016d1:	5d                   	pop    %rbp
+  8016d2:	c3                   	ret
+
+00000000008016d3 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8016d3:	55                   	push   %rbp
+  8016d4:	48 89 e5             	mov    %rsp,%rbp
+  8016d7:	41 57                	push   %r15
+  8016d9:	41 56                	push   %r14
+  8016db:	41 55                	push   %r13
+  8016dd:	41 54                	push   %r12
+  8016df:	53                   	push   %rbx
+  8016e0:	48 83 ec 18          	sub    $0x18,%rsp
+  8016e4:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8016e7:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8016eb:	48 b8 13 15 80 00 00 	movabs $0x801513,%rax
+  8016f2:	00 00 00 
+  8016f5:	ff d0                	call   *%rax
+  8016f7:	89 c3                	mov    %eax,%ebx
+  8016f9:	85 c0                	test   %eax,%eax
+  8016fb:	0f 88 b8 00 00 00    	js     8017b9 <dup+0xe6>
+    close(newfdnum);
+  801701:	44 89 e7             	mov    %r12d,%edi
+  801704:	48 b8 78 16 80 00 00 	movabs $0x801678,%rax
+  80170b:	00 00 00 
+  80170e:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801710:	4d 63 ec             	movslq %r12d,%r13
+  801713:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80171a:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  80171e:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801722:	4c 89 ff             	mov    %r15,%rdi
+  801725:	49 be 97 14 80 00 00 	movabs $0x801497,%r14
+  80172c:	00 00 00 
+  80172f:	41 ff d6             	call   *%r14
+  801732:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801735:	4c 89 ef             	mov    %r13,%rdi
+  801738:	41 ff d6             	call   *%r14
+  80173b:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  80173e:	48 89 df             	mov    %rbx,%rdi
+  801741:	48 b8 42 3c 80 00 00 	movabs $0x803c42,%rax
+  801748:	00 00 00 
+  80174b:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  80174d:	a8 04                	test   $0x4,%al
+  80174f:	74 2b                	je     80177c <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801751:	41 89 c1             	mov    %eax,%r9d
+  801754:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80175a:	4c 89 f1             	mov    %r14,%rcx
+  80175d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801762:	48 89 de             	mov    %rbx,%rsi
+  801765:	bf 00 00 00 00       	mov    $0x0,%edi
+  80176a:	48 b8 a8 10 80 00 00 	movabs $0x8010a8,%rax
+  801771:	00 00 00 
+  801774:	ff d0                	call   *%rax
+  801776:	89 c3                	mov    %eax,%ebx
+  801778:	85 c0                	test   %eax,%eax
+  80177a:	78 4e                	js     8017ca <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  80177c:	4c 89 ff             	mov    %r15,%rdi
+  80177f:	48 b8 42 3c 80 00 00 	movabs $0x803c42,%rax
+  801786:	00 00 00 
+  801789:	ff d0                	call   *%rax
+  80178b:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  80178e:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801794:	4c 89 e9             	mov    %r13,%rcx
+  801797:	ba 00 00 00 00       	mov    $0x0,%edx
+  80179c:	4c 89 fe             	mov    %r15,%rsi
+  80179f:	bf 00 00 00 00       	mov    $0x0,%edi
+  8017a4:	48 b8 a8 10 80 00 00 	movabs $0x8010a8,%rax
+  8017ab:	00 00 00 
+  8017ae:	ff d0                	call   *%rax
+  8017b0:	89 c3                	mov    %eax,%ebx
+  8017b2:	85 c0                	test   %eax,%eax
+  8017b4:	78 14                	js     8017ca <dup+0xf7>
+
+    return newfdnum;
+  8017b6:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8017b9:	89 d8                	mov    %ebx,%eax
+  8017bb:	48 83 c4 18          	add    $0x18,%rsp
+  8017bf:	5b                   	pop    %rbx
+  8017c0:	41 5c                	pop    %r12
+  8017c2:	41 5d                	pop    %r13
+  8017c4:	41 5e                	pop    %r14
+  8017c6:	41 5f                	pop    %r15
+  8017c8:	5d                   	pop    %rbp
+  8017c9:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8017ca:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8017cf:	4c 89 ee             	mov    %r13,%rsi
+  8017d2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8017d7:	49 bc f8 10 80 00 00 	movabs $0x8010f8,%r12
+  8017de:	00 00 00 
+  8017e1:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8017e4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8017e9:	4c 89 f6             	mov    %r14,%rsi
+  8017ec:	bf 00 00 00 00       	mov    $0x0,%edi
+  8017f1:	41 ff d4             	call   *%r12
+    return res;
+  8017f4:	eb c3                	jmp    8017b9 <dup+0xe6>
+
+00000000008017f6 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8017f6:	55                   	push   %rbp
+  8017f7:	48 89 e5             	mov    %rsp,%rbp
+  8017fa:	41 56                	push   %r14
+  8017fc:	41 55                	push   %r13
+  8017fe:	41 54                	push   %r12
+  801800:	53                   	push   %rbx
+  801801:	48 83 ec 10          	sub    $0x10,%rsp
+  801805:	89 fb                	mov    %edi,%ebx
+  801807:	49 89 f4             	mov    %rsi,%r12
+  80180a:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80180d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801811:	48 b8 13 15 80 00 00 	movabs $0x801513,%rax
+  801818:	00 00 00 
+  80181b:	ff d0                	call   *%rax
+  80181d:	85 c0                	test   %eax,%eax
+  80181f:	78 4c                	js     80186d <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801821:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801825:	41 8b 3e             	mov    (%r14),%edi
+  801828:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80182c:	48 b8 5e 15 80 00 00 	movabs $0x80155e,%rax
+  801833:	00 00 00 
+  801836:	ff d0                	call   *%rax
+  801838:	85 c0                	test   %eax,%eax
+  80183a:	78 35                	js     801871 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80183c:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801840:	83 e0 03             	and    $0x3,%eax
+  801843:	83 f8 01             	cmp    $0x1,%eax
+  801846:	74 2d                	je     801875 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801848:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80184c:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801850:	48 85 c0             	test   %rax,%rax
+  801853:	74 56                	je     8018ab <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801855:	4c 89 ea             	mov    %r13,%rdx
+  801858:	4c 89 e6             	mov    %r12,%rsi
+  80185b:	4c 89 f7             	mov    %r14,%rdi
+  80185e:	ff d0                	call   *%rax
+}
+  801860:	48 83 c4 10          	add    $0x10,%rsp
+  801864:	5b                   	pop    %rbx
+  801865:	41 5c                	pop    %r12
+  801867:	41 5d                	pop    %r13
+  801869:	41 5e                	pop    %r14
+  80186b:	5d                   	pop    %rbp
+  80186c:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80186d:	48 98                	cltq
+  80186f:	eb ef                	jmp    801860 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801871:	48 98                	cltq
+  801873:	eb eb                	jmp    801860 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801875:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80187c:	00 00 00 
+  80187f:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801885:	89 da                	mov    %ebx,%edx
+  801887:	48 bf 89 4c 80 00 00 	movabs $0x804c89,%rdi
+  80188e:	00 00 00 
+  801891:	b8 00 00 00 00       	mov    $0x0,%eax
+  801896:	48 b9 ce 01 80 00 00 	movabs $0x8001ce,%rcx
+  80189d:	00 00 00 
+  8018a0:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8018a2:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8018a9:	eb b5                	jmp    801860 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8018ab:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8018b2:	eb ac                	jmp    801860 <read+0x6a>
+
+00000000008018b4 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8018b4:	55                   	push   %rbp
+  8018b5:	48 89 e5             	mov    %rsp,%rbp
+  8018b8:	41 57                	push   %r15
+  8018ba:	41 56                	push   %r14
+  8018bc:	41 55                	push   %r13
+  8018be:	41 54                	push   %r12
+  8018c0:	53                   	push   %rbx
+  8018c1:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8018c5:	48 85 d2             	test   %rdx,%rdx
+  8018c8:	74 54                	je     80191e <readn+0x6a>
+  8018ca:	41 89 fd             	mov    %edi,%r13d
+  8018cd:	49 89 f6             	mov    %rsi,%r14
+  8018d0:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8018d3:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8018d8:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8018dd:	49 bf f6 17 80 00 00 	movabs $0x8017f6,%r15
+  8018e4:	00 00 00 
+  8018e7:	4c 89 e2             	mov    %r12,%rdx
+  8018ea:	48 29 f2             	sub    %rsi,%rdx
+  8018ed:	4c 01 f6             	add    %r14,%rsi
+  8018f0:	44 89 ef             	mov    %r13d,%edi
+  8018f3:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  8018f6:	85 c0                	test   %eax,%eax
+  8018f8:	78 20                	js     80191a <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  8018fa:	01 c3                	add    %eax,%ebx
+  8018fc:	85 c0                	test   %eax,%eax
+  8018fe:	74 08                	je     801908 <readn+0x54>
+  801900:	48 63 f3             	movslq %ebx,%rsi
+  801903:	4c 39 e6             	cmp    %r12,%rsi
+  801906:	72 df                	jb     8018e7 <readn+0x33>
+    }
+    return res;
+  801908:	48 63 c3             	movslq %ebx,%rax
+}
+  80190b:	48 83 c4 08          	add    $0x8,%rsp
+  80190f:	5b                   	pop    %rbx
+  801910:	41 5c                	pop    %r12
+  801912:	41 5d                	pop    %r13
+  801914:	41 5e                	pop    %r14
+  801916:	41 5f                	pop    %r15
+  801918:	5d                   	pop    %rbp
+  801919:	c3                   	ret
+        if (inc < 0) return inc;
+  80191a:	48 98                	cltq
+  80191c:	eb ed                	jmp    80190b <readn+0x57>
+    int inc = 1, res = 0;
+  80191e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801923:	eb e3                	jmp    801908 <readn+0x54>
+
+0000000000801925 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801925:	55                   	push   %rbp
+  801926:	48 89 e5             	mov    %rsp,%rbp
+  801929:	41 56                	push   %r14
+  80192b:	41 55                	push   %r13
+  80192d:	41 54                	push   %r12
+  80192f:	53                   	push   %rbx
+  801930:	48 83 ec 10          	sub    $0x10,%rsp
+  801934:	89 fb                	mov    %edi,%ebx
+  801936:	49 89 f4             	mov    %rsi,%r12
+  801939:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80193c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801940:	48 b8 13 15 80 00 00 	movabs $0x801513,%rax
+  801947:	00 00 00 
+  80194a:	ff d0                	call   *%rax
+  80194c:	85 c0                	test   %eax,%eax
+  80194e:	78 47                	js     801997 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801950:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801954:	41 8b 3e             	mov    (%r14),%edi
+  801957:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80195b:	48 b8 5e 15 80 00 00 	movabs $0x80155e,%rax
+  801962:	00 00 00 
+  801965:	ff d0                	call   *%rax
+  801967:	85 c0                	test   %eax,%eax
+  801969:	78 30                	js     80199b <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80196b:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801970:	74 2d                	je     80199f <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801972:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801976:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80197a:	48 85 c0             	test   %rax,%rax
+  80197d:	74 56                	je     8019d5 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  80197f:	4c 89 ea             	mov    %r13,%rdx
+  801982:	4c 89 e6             	mov    %r12,%rsi
+  801985:	4c 89 f7             	mov    %r14,%rdi
+  801988:	ff d0                	call   *%rax
+}
+  80198a:	48 83 c4 10          	add    $0x10,%rsp
+  80198e:	5b                   	pop    %rbx
+  80198f:	41 5c                	pop    %r12
+  801991:	41 5d                	pop    %r13
+  801993:	41 5e                	pop    %r14
+  801995:	5d                   	pop    %rbp
+  801996:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801997:	48 98                	cltq
+  801999:	eb ef                	jmp    80198a <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80199b:	48 98                	cltq
+  80199d:	eb eb                	jmp    80198a <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80199f:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8019a6:	00 00 00 
+  8019a9:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8019af:	89 da                	mov    %ebx,%edx
+  8019b1:	48 bf a5 4c 80 00 00 	movabs $0x804ca5,%rdi
+  8019b8:	00 00 00 
+  8019bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019c0:	48 b9 ce 01 80 00 00 	movabs $0x8001ce,%rcx
+  8019c7:	00 00 00 
+  8019ca:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8019cc:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8019d3:	eb b5                	jmp    80198a <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8019d5:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8019dc:	eb ac                	jmp    80198a <write+0x65>
+
+00000000008019de <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8019de:	55                   	push   %rbp
+  8019df:	48 89 e5             	mov    %rsp,%rbp
+  8019e2:	41 54                	push   %r12
+  8019e4:	53                   	push   %rbx
+  8019e5:	48 83 ec 10          	sub    $0x10,%rsp
+  8019e9:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8019eb:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8019ef:	48 b8 13 15 80 00 00 	movabs $0x801513,%rax
+  8019f6:	00 00 00 
+  8019f9:	ff d0                	call   *%rax
+  8019fb:	85 c0                	test   %eax,%eax
+  8019fd:	78 3e                	js     801a3d <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8019ff:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801a03:	41 8b 3c 24          	mov    (%r12),%edi
+  801a07:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801a0b:	48 b8 5e 15 80 00 00 	movabs $0x80155e,%rax
+  801a12:	00 00 00 
+  801a15:	ff d0                	call   *%rax
+  801a17:	85 c0                	test   %eax,%eax
+  801a19:	78 22                	js     801a3d <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  801a1b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801a1f:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801a23:	48 85 c0             	test   %rax,%rax
+  801a26:	74 0b                	je     801a33 <seek+0x55>
+  801a28:	89 de                	mov    %ebx,%esi
+  801a2a:	4c 89 e7             	mov    %r12,%rdi
+  801a2d:	ff d0                	call   *%rax
+  801a2f:	85 c0                	test   %eax,%eax
+  801a31:	78 0a                	js     801a3d <seek+0x5f>
+
+    fd->fd_offset = offset;
+  801a33:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  801a38:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a3d:	48 83 c4 10          	add    $0x10,%rsp
+  801a41:	5b                   	pop    %rbx
+  801a42:	41 5c                	pop    %r12
+  801a44:	5d                   	pop    %rbp
+  801a45:	c3                   	ret
+
+0000000000801a46 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801a46:	55                   	push   %rbp
+  801a47:	48 89 e5             	mov    %rsp,%rbp
+  801a4a:	41 55                	push   %r13
+  801a4c:	41 54                	push   %r12
+  801a4e:	53                   	push   %rbx
+  801a4f:	48 83 ec 18          	sub    $0x18,%rsp
+  801a53:	89 fb                	mov    %edi,%ebx
+  801a55:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a58:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801a5c:	48 b8 13 15 80 00 00 	movabs $0x801513,%rax
+  801a63:	00 00 00 
+  801a66:	ff d0                	call   *%rax
+  801a68:	85 c0                	test   %eax,%eax
+  801a6a:	78 38                	js     801aa4 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801a6c:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801a70:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801a74:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801a78:	48 b8 5e 15 80 00 00 	movabs $0x80155e,%rax
+  801a7f:	00 00 00 
+  801a82:	ff d0                	call   *%rax
+  801a84:	85 c0                	test   %eax,%eax
+  801a86:	78 1c                	js     801aa4 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801a88:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801a8d:	74 20                	je     801aaf <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801a8f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a93:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801a97:	48 85 c0             	test   %rax,%rax
+  801a9a:	74 47                	je     801ae3 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801a9c:	44 89 e6             	mov    %r12d,%esi
+  801a9f:	4c 89 ef             	mov    %r13,%rdi
+  801aa2:	ff d0                	call   *%rax
+}
+  801aa4:	48 83 c4 18          	add    $0x18,%rsp
+  801aa8:	5b                   	pop    %rbx
+  801aa9:	41 5c                	pop    %r12
+  801aab:	41 5d                	pop    %r13
+  801aad:	5d                   	pop    %rbp
+  801aae:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801aaf:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801ab6:	00 00 00 
+  801ab9:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801abf:	89 da                	mov    %ebx,%edx
+  801ac1:	48 bf 68 4c 80 00 00 	movabs $0x804c68,%rdi
+  801ac8:	00 00 00 
+  801acb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ad0:	48 b9 ce 01 80 00 00 	movabs $0x8001ce,%rcx
+  801ad7:	00 00 00 
+  801ada:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801adc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ae1:	eb c1                	jmp    801aa4 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801ae3:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801ae8:	eb ba                	jmp    801aa4 <ftruncate+0x5e>
+
+0000000000801aea <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801aea:	55                   	push   %rbp
+  801aeb:	48 89 e5             	mov    %rsp,%rbp
+  801aee:	41 54                	push   %r12
+  801af0:	53                   	push   %rbx
+  801af1:	48 83 ec 10          	sub    $0x10,%rsp
+  801af5:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801af8:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801afc:	48 b8 13 15 80 00 00 	movabs $0x801513,%rax
+  801b03:	00 00 00 
+  801b06:	ff d0                	call   *%rax
+  801b08:	85 c0                	test   %eax,%eax
+  801b0a:	78 4e                	js     801b5a <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b0c:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801b10:	41 8b 3c 24          	mov    (%r12),%edi
+  801b14:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801b18:	48 b8 5e 15 80 00 00 	movabs $0x80155e,%rax
+  801b1f:	00 00 00 
+  801b22:	ff d0                	call   *%rax
+  801b24:	85 c0                	test   %eax,%eax
+  801b26:	78 32                	js     801b5a <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801b28:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801b2c:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801b31:	74 30                	je     801b63 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801b33:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801b36:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801b3d:	00 00 00 
+    stat->st_isdir = 0;
+  801b40:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801b47:	00 00 00 
+    stat->st_dev = dev;
+  801b4a:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801b51:	48 89 de             	mov    %rbx,%rsi
+  801b54:	4c 89 e7             	mov    %r12,%rdi
+  801b57:	ff 50 28             	call   *0x28(%rax)
+}
+  801b5a:	48 83 c4 10          	add    $0x10,%rsp
+  801b5e:	5b                   	pop    %rbx
+  801b5f:	41 5c                	pop    %r12
+  801b61:	5d                   	pop    %rbp
+  801b62:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801b63:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801b68:	eb f0                	jmp    801b5a <fstat+0x70>
+
+0000000000801b6a <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801b6a:	55                   	push   %rbp
+  801b6b:	48 89 e5             	mov    %rsp,%rbp
+  801b6e:	41 54                	push   %r12
+  801b70:	53                   	push   %rbx
+  801b71:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801b74:	be 00 00 00 00       	mov    $0x0,%esi
+  801b79:	48 b8 d8 2c 80 00 00 	movabs $0x802cd8,%rax
+  801b80:	00 00 00 
+  801b83:	ff d0                	call   *%rax
+  801b85:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801b87:	85 c0                	test   %eax,%eax
+  801b89:	78 25                	js     801bb0 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801b8b:	4c 89 e6             	mov    %r12,%rsi
+  801b8e:	89 c7                	mov    %eax,%edi
+  801b90:	48 b8 ea 1a 80 00 00 	movabs $0x801aea,%rax
+  801b97:	00 00 00 
+  801b9a:	ff d0                	call   *%rax
+  801b9c:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801b9f:	89 df                	mov    %ebx,%edi
+  801ba1:	48 b8 78 16 80 00 00 	movabs $0x801678,%rax
+  801ba8:	00 00 00 
+  801bab:	ff d0                	call   *%rax
+
+    return res;
+  801bad:	44 89 e3             	mov    %r12d,%ebx
+}
+  801bb0:	89 d8                	mov    %ebx,%eax
+  801bb2:	5b                   	pop    %rbx
+  801bb3:	41 5c                	pop    %r12
+  801bb5:	5d                   	pop    %rbp
+  801bb6:	c3                   	ret
+
+0000000000801bb7 <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  801bb7:	48 b8 08 00 82 00 00 	movabs $0x820008,%rax
+  801bbe:	00 00 00 
+  801bc1:	83 38 00             	cmpl   $0x0,(%rax)
+  801bc4:	74 0a                	je     801bd0 <fsenv+0x19>
+    return envid;
+}
+  801bc6:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  801bcd:	00 00 
+  801bcf:	c3                   	ret
+fsenv(void) {
+  801bd0:	55                   	push   %rbp
+  801bd1:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  801bd4:	bf 03 00 00 00       	mov    $0x3,%edi
+  801bd9:	48 b8 48 46 80 00 00 	movabs $0x804648,%rax
+  801be0:	00 00 00 
+  801be3:	ff d0                	call   *%rax
+  801be5:	a3 08 00 82 00 00 00 	movabs %eax,0x820008
+  801bec:	00 00 
+}
+  801bee:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  801bf5:	00 00 
+  801bf7:	5d                   	pop    %rbp
+  801bf8:	c3                   	ret
+
+0000000000801bf9 <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  801bf9:	55                   	push   %rbp
+  801bfa:	48 89 e5             	mov    %rsp,%rbp
+  801bfd:	41 54                	push   %r12
+  801bff:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  801c00:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801c05:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801c0a:	48 89 de             	mov    %rbx,%rsi
+  801c0d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c12:	48 b8 f8 10 80 00 00 	movabs $0x8010f8,%rax
+  801c19:	00 00 00 
+  801c1c:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  801c1e:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  801c25:	00 00 00 
+  801c28:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  801c2e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801c33:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801c38:	48 89 de             	mov    %rbx,%rsi
+  801c3b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c40:	48 b8 52 10 80 00 00 	movabs $0x801052,%rax
+  801c47:	00 00 00 
+  801c4a:	ff d0                	call   *%rax
+  801c4c:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  801c4e:	85 c0                	test   %eax,%eax
+  801c50:	0f 88 a2 00 00 00    	js     801cf8 <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  801c56:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801c5d:	00 00 00 
+  801c60:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801c66:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801c6b:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  801c6d:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  801c72:	49 bc 0a 3e 80 00 00 	movabs $0x803e0a,%r12
+  801c79:	00 00 00 
+  801c7c:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  801c7f:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  801c84:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  801c87:	48 b8 b7 1b 80 00 00 	movabs $0x801bb7,%rax
+  801c8e:	00 00 00 
+  801c91:	ff d0                	call   *%rax
+  801c93:	89 c7                	mov    %eax,%edi
+  801c95:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  801c9b:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  801ca0:	48 89 da             	mov    %rbx,%rdx
+  801ca3:	be 09 00 00 00       	mov    $0x9,%esi
+  801ca8:	48 b8 f2 45 80 00 00 	movabs $0x8045f2,%rax
+  801caf:	00 00 00 
+  801cb2:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  801cb4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801cb9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cbe:	be 00 00 00 00       	mov    $0x0,%esi
+  801cc3:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cc8:	48 b8 ce 45 80 00 00 	movabs $0x8045ce,%rax
+  801ccf:	00 00 00 
+  801cd2:	ff d0                	call   *%rax
+  801cd4:	89 c3                	mov    %eax,%ebx
+  801cd6:	85 c0                	test   %eax,%eax
+  801cd8:	78 25                	js     801cff <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  801cda:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801ce1:	00 00 00 
+  801ce4:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801cea:	a3 00 26 82 00 00 00 	movabs %eax,0x822600
+  801cf1:	00 00 
+    return 0;
+  801cf3:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  801cf8:	89 d8                	mov    %ebx,%eax
+  801cfa:	5b                   	pop    %rbx
+  801cfb:	41 5c                	pop    %r12
+  801cfd:	5d                   	pop    %rbp
+  801cfe:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  801cff:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801d04:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  801d09:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d0e:	48 b8 f8 10 80 00 00 	movabs $0x8010f8,%rax
+  801d15:	00 00 00 
+  801d18:	ff d0                	call   *%rax
+        return res;
+  801d1a:	eb dc                	jmp    801cf8 <fschan_setup+0xff>
+
+0000000000801d1c <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  801d1c:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  801d23:	00 00 00 
+  801d26:	80 38 00             	cmpb   $0x0,(%rax)
+  801d29:	74 55                	je     801d80 <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801d2b:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801d32:	00 00 00 
+  801d35:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  801d3b:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801d40:	48 ba 00 26 82 00 00 	movabs $0x822600,%rdx
+  801d47:	00 00 00 
+  801d4a:	3b 0a                	cmp    (%rdx),%ecx
+  801d4c:	75 01                	jne    801d4f <fschan+0x33>
+}
+  801d4e:	c3                   	ret
+fschan(void) {
+  801d4f:	55                   	push   %rbp
+  801d50:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801d53:	48 b8 f9 1b 80 00 00 	movabs $0x801bf9,%rax
+  801d5a:	00 00 00 
+  801d5d:	ff d0                	call   *%rax
+  801d5f:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  801d61:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801d66:	85 d2                	test   %edx,%edx
+  801d68:	78 02                	js     801d6c <fschan+0x50>
+}
+  801d6a:	5d                   	pop    %rbp
+  801d6b:	c3                   	ret
+        fschan_enabled = 0;
+  801d6c:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  801d73:	00 00 00 
+  801d76:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  801d79:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d7e:	eb ea                	jmp    801d6a <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  801d80:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d85:	c3                   	ret
+
+0000000000801d86 <fbuf>:
+fbuf(struct Fd *fd) {
+  801d86:	55                   	push   %rbp
+  801d87:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  801d8a:	48 b8 85 14 80 00 00 	movabs $0x801485,%rax
+  801d91:	00 00 00 
+  801d94:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  801d96:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d9b:	48 83 f8 1f          	cmp    $0x1f,%rax
+  801d9f:	77 12                	ja     801db3 <fbuf+0x2d>
+  801da1:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  801da5:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  801dac:	00 00 00 
+  801daf:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  801db3:	48 89 d0             	mov    %rdx,%rax
+  801db6:	5d                   	pop    %rbp
+  801db7:	c3                   	ret
+
+0000000000801db8 <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  801db8:	55                   	push   %rbp
+  801db9:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  801dbc:	48 83 c7 40          	add    $0x40,%rdi
+  801dc0:	48 b8 44 3e 80 00 00 	movabs $0x803e44,%rax
+  801dc7:	00 00 00 
+  801dca:	ff d0                	call   *%rax
+  801dcc:	84 c0                	test   %al,%al
+  801dce:	75 02                	jne    801dd2 <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  801dd0:	5d                   	pop    %rbp
+  801dd1:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  801dd2:	48 b8 b7 1b 80 00 00 	movabs $0x801bb7,%rax
+  801dd9:	00 00 00 
+  801ddc:	ff d0                	call   *%rax
+  801dde:	89 c7                	mov    %eax,%edi
+  801de0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801de6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801deb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801df0:	be 0a 00 00 00       	mov    $0xa,%esi
+  801df5:	48 b8 f2 45 80 00 00 	movabs $0x8045f2,%rax
+  801dfc:	00 00 00 
+  801dff:	ff d0                	call   *%rax
+}
+  801e01:	eb cd                	jmp    801dd0 <fschan_publish+0x18>
+
+0000000000801e03 <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  801e03:	55                   	push   %rbp
+  801e04:	48 89 e5             	mov    %rsp,%rbp
+  801e07:	41 57                	push   %r15
+  801e09:	41 56                	push   %r14
+  801e0b:	41 55                	push   %r13
+  801e0d:	41 54                	push   %r12
+  801e0f:	53                   	push   %rbx
+  801e10:	48 83 ec 48          	sub    $0x48,%rsp
+  801e14:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801e18:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  801e1c:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  801e1f:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  801e23:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  801e26:	48 ba 04 00 82 00 00 	movabs $0x820004,%rdx
+  801e2d:	00 00 00 
+  801e30:	8b 02                	mov    (%rdx),%eax
+  801e32:	83 c0 01             	add    $0x1,%eax
+  801e35:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801e3a:	0f 44 c1             	cmove  %ecx,%eax
+  801e3d:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  801e3f:	4d 85 c0             	test   %r8,%r8
+  801e42:	74 2c                	je     801e70 <fschan_rw+0x6d>
+  801e44:	45 89 ce             	mov    %r9d,%r14d
+  801e47:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  801e4e:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  801e52:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801e58:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  801e5f:	00 
+  801e60:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801e66:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e6b:	e9 41 01 00 00       	jmp    801fb1 <fschan_rw+0x1ae>
+  801e70:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  801e74:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801e78:	e9 9c 01 00 00       	jmp    802019 <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  801e7d:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  801e81:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  801e84:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  801e87:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  801e8a:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  801e8e:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  801e92:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  801e96:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  801e9a:	48 89 da             	mov    %rbx,%rdx
+  801e9d:	48 b8 54 0d 80 00 00 	movabs $0x800d54,%rax
+  801ea4:	00 00 00 
+  801ea7:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  801ea9:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801ead:	48 b8 b8 1d 80 00 00 	movabs $0x801db8,%rax
+  801eb4:	00 00 00 
+  801eb7:	ff d0                	call   *%rax
+            queued += blk;
+  801eb9:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  801ebc:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  801ec0:	4d 39 fc             	cmp    %r15,%r12
+  801ec3:	73 6b                	jae    801f30 <fschan_rw+0x12d>
+  801ec5:	41 83 fd 0f          	cmp    $0xf,%r13d
+  801ec9:	77 65                	ja     801f30 <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  801ecb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ecf:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  801ed3:	48 b8 1f 3e 80 00 00 	movabs $0x803e1f,%rax
+  801eda:	00 00 00 
+  801edd:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  801edf:	4c 89 fb             	mov    %r15,%rbx
+  801ee2:	4c 29 e3             	sub    %r12,%rbx
+  801ee5:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  801eea:	48 39 d3             	cmp    %rdx,%rbx
+  801eed:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  801ef1:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  801ef5:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  801ef9:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  801efd:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  801f00:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  801f02:	48 b9 04 00 82 00 00 	movabs $0x820004,%rcx
+  801f09:	00 00 00 
+  801f0c:	8b 09                	mov    (%rcx),%ecx
+  801f0e:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  801f11:	83 fe 03             	cmp    $0x3,%esi
+  801f14:	0f 85 63 ff ff ff    	jne    801e7d <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  801f1a:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801f1e:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  801f21:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  801f24:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  801f27:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  801f2b:	e9 79 ff ff ff       	jmp    801ea9 <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  801f30:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f34:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  801f3b:	48 89 df             	mov    %rbx,%rdi
+  801f3e:	48 b8 e2 3e 80 00 00 	movabs $0x803ee2,%rax
+  801f45:	00 00 00 
+  801f48:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  801f4a:	48 89 df             	mov    %rbx,%rdi
+  801f4d:	48 b8 70 3e 80 00 00 	movabs $0x803e70,%rax
+  801f54:	00 00 00 
+  801f57:	ff d0                	call   *%rax
+  801f59:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  801f5d:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  801f61:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  801f65:	75 25                	jne    801f8c <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  801f67:	8b 40 04             	mov    0x4(%rax),%eax
+  801f6a:	85 c0                	test   %eax,%eax
+  801f6c:	0f 88 86 00 00 00    	js     801ff8 <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  801f72:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  801f76:	74 5b                	je     801fd3 <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  801f78:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801f7c:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  801f80:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  801f84:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  801f88:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  801f8c:	48 89 df             	mov    %rbx,%rdi
+  801f8f:	48 b8 97 3e 80 00 00 	movabs $0x803e97,%rax
+  801f96:	00 00 00 
+  801f99:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  801f9b:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  801f9f:	83 f0 01             	xor    $0x1,%eax
+  801fa2:	4d 39 fc             	cmp    %r15,%r12
+  801fa5:	0f 92 c2             	setb   %dl
+  801fa8:	84 c2                	test   %al,%dl
+  801faa:	75 05                	jne    801fb1 <fschan_rw+0x1ae>
+  801fac:	45 85 ed             	test   %r13d,%r13d
+  801faf:	74 50                	je     802001 <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  801fb1:	4d 39 fc             	cmp    %r15,%r12
+  801fb4:	0f 92 c1             	setb   %cl
+  801fb7:	41 83 fd 0f          	cmp    $0xf,%r13d
+  801fbb:	0f 96 c2             	setbe  %dl
+  801fbe:	84 d1                	test   %dl,%cl
+  801fc0:	0f 84 6a ff ff ff    	je     801f30 <fschan_rw+0x12d>
+  801fc6:	84 c0                	test   %al,%al
+  801fc8:	0f 85 fd fe ff ff    	jne    801ecb <fschan_rw+0xc8>
+  801fce:	e9 5d ff ff ff       	jmp    801f30 <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  801fd3:	48 63 d0             	movslq %eax,%rdx
+  801fd6:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801fda:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  801fde:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801fe2:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  801fe6:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  801fea:	48 b8 54 0d 80 00 00 	movabs $0x800d54,%rax
+  801ff1:	00 00 00 
+  801ff4:	ff d0                	call   *%rax
+  801ff6:	eb 80                	jmp    801f78 <fschan_rw+0x175>
+                err = msg->fm_res;
+  801ff8:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  801ffb:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  801fff:	eb 8b                	jmp    801f8c <fschan_rw+0x189>
+    return done || !err ? done : err;
+  802001:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  802006:	0f 85 68 fe ff ff    	jne    801e74 <fschan_rw+0x71>
+  80200c:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  80200f:	85 c0                	test   %eax,%eax
+  802011:	0f 84 5d fe ff ff    	je     801e74 <fschan_rw+0x71>
+  802017:	48 98                	cltq
+}
+  802019:	48 83 c4 48          	add    $0x48,%rsp
+  80201d:	5b                   	pop    %rbx
+  80201e:	41 5c                	pop    %r12
+  802020:	41 5d                	pop    %r13
+  802022:	41 5e                	pop    %r14
+  802024:	41 5f                	pop    %r15
+  802026:	5d                   	pop    %rbp
+  802027:	c3                   	ret
+
+0000000000802028 <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  802028:	55                   	push   %rbp
+  802029:	48 89 e5             	mov    %rsp,%rbp
+  80202c:	41 56                	push   %r14
+  80202e:	41 55                	push   %r13
+  802030:	41 54                	push   %r12
+  802032:	53                   	push   %rbx
+  802033:	48 83 ec 10          	sub    $0x10,%rsp
+  802037:	49 89 fe             	mov    %rdi,%r14
+  80203a:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  80203d:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  802041:	48 29 f3             	sub    %rsi,%rbx
+  802044:	48 39 d3             	cmp    %rdx,%rbx
+  802047:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  80204b:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  802052:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  802053:	bf 00 10 00 00       	mov    $0x1000,%edi
+  802058:	49 bd a1 3c 80 00 00 	movabs $0x803ca1,%r13
+  80205f:	00 00 00 
+  802062:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  802069:	76 1e                	jbe    802089 <mmap_fault+0x61>
+  80206b:	4c 01 e7             	add    %r12,%rdi
+  80206e:	41 ff d5             	call   *%r13
+  802071:	84 c0                	test   %al,%al
+  802073:	75 14                	jne    802089 <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  802075:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802079:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  802080:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  802084:	48 39 df             	cmp    %rbx,%rdi
+  802087:	72 e2                	jb     80206b <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  802089:	48 bb 00 10 82 00 00 	movabs $0x821000,%rbx
+  802090:	00 00 00 
+  802093:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  80209a:	00 00 00 
+  80209d:	4c 89 f0             	mov    %r14,%rax
+  8020a0:	48 29 d0             	sub    %rdx,%rax
+  8020a3:	48 c1 f8 03          	sar    $0x3,%rax
+  8020a7:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  8020ae:	aa aa aa 
+  8020b1:	48 0f af c2          	imul   %rdx,%rax
+  8020b5:	48 c1 e0 0c          	shl    $0xc,%rax
+  8020b9:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  8020be:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  8020c2:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  8020c4:	44 89 e0             	mov    %r12d,%eax
+  8020c7:	41 03 46 10          	add    0x10(%r14),%eax
+  8020cb:	41 2b 06             	sub    (%r14),%eax
+  8020ce:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  8020d1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8020d5:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  8020d9:	41 8b 46 14          	mov    0x14(%r14),%eax
+  8020dd:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  8020e0:	48 b8 b7 1b 80 00 00 	movabs $0x801bb7,%rax
+  8020e7:	00 00 00 
+  8020ea:	ff d0                	call   *%rax
+  8020ec:	89 c7                	mov    %eax,%edi
+  8020ee:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8020f4:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8020f9:	48 89 da             	mov    %rbx,%rdx
+  8020fc:	be 0f 00 00 00       	mov    $0xf,%esi
+  802101:	48 b8 f2 45 80 00 00 	movabs $0x8045f2,%rax
+  802108:	00 00 00 
+  80210b:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  80210d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802112:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802116:	4c 89 e6             	mov    %r12,%rsi
+  802119:	bf 00 00 00 00       	mov    $0x0,%edi
+  80211e:	48 b8 ce 45 80 00 00 	movabs $0x8045ce,%rax
+  802125:	00 00 00 
+  802128:	ff d0                	call   *%rax
+  80212a:	48 98                	cltq
+}
+  80212c:	48 83 c4 10          	add    $0x10,%rsp
+  802130:	5b                   	pop    %rbx
+  802131:	41 5c                	pop    %r12
+  802133:	41 5d                	pop    %r13
+  802135:	41 5e                	pop    %r14
+  802137:	5d                   	pop    %rbp
+  802138:	c3                   	ret
+
+0000000000802139 <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  802139:	48 8b 37             	mov    (%rdi),%rsi
+  80213c:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  802143:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  80214a:	00 00 00 
+  80214d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802152:	eb 0f                	jmp    802163 <mmap_pgfault+0x2a>
+  802154:	c3                   	ret
+  802155:	48 83 c1 01          	add    $0x1,%rcx
+  802159:	48 83 c2 18          	add    $0x18,%rdx
+  80215d:	48 83 f9 20          	cmp    $0x20,%rcx
+  802161:	74 6e                	je     8021d1 <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  802163:	48 8b 02             	mov    (%rdx),%rax
+  802166:	48 83 e8 01          	sub    $0x1,%rax
+  80216a:	48 39 f0             	cmp    %rsi,%rax
+  80216d:	73 e6                	jae    802155 <mmap_pgfault+0x1c>
+  80216f:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  802173:	73 e0                	jae    802155 <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  802175:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  802179:	b8 00 00 00 00       	mov    $0x0,%eax
+  80217e:	f6 c2 01             	test   $0x1,%dl
+  802181:	75 d1                	jne    802154 <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  802183:	f6 c2 02             	test   $0x2,%dl
+  802186:	74 1a                	je     8021a2 <mmap_pgfault+0x69>
+  802188:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  80218c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802191:	48 bf 00 20 82 00 00 	movabs $0x822000,%rdi
+  802198:	00 00 00 
+  80219b:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  8021a0:	74 35                	je     8021d7 <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  8021a2:	55                   	push   %rbp
+  8021a3:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  8021a6:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  8021aa:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8021b1:	00 00 00 
+  8021b4:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  8021b8:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8021bd:	48 b8 28 20 80 00 00 	movabs $0x802028,%rax
+  8021c4:	00 00 00 
+  8021c7:	ff d0                	call   *%rax
+  8021c9:	48 85 c0             	test   %rax,%rax
+  8021cc:	0f 9f c0             	setg   %al
+}
+  8021cf:	5d                   	pop    %rbp
+  8021d0:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  8021d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021d6:	c3                   	ret
+}
+  8021d7:	c3                   	ret
+
+00000000008021d8 <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  8021d8:	55                   	push   %rbp
+  8021d9:	48 89 e5             	mov    %rsp,%rbp
+  8021dc:	41 54                	push   %r12
+  8021de:	53                   	push   %rbx
+  8021df:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8021e2:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8021e9:	00 00 00 
+  8021ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  8021f1:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8021f5:	74 15                	je     80220c <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8021f7:	48 83 c3 01          	add    $0x1,%rbx
+  8021fb:	48 83 c0 18          	add    $0x18,%rax
+  8021ff:	48 83 fb 20          	cmp    $0x20,%rbx
+  802203:	75 ec                	jne    8021f1 <mmap_alloc+0x19>
+    return NULL;
+  802205:	b8 00 00 00 00       	mov    $0x0,%eax
+  80220a:	eb 52                	jmp    80225e <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  80220c:	4c 89 e7             	mov    %r12,%rdi
+  80220f:	48 b8 42 3c 80 00 00 	movabs $0x803c42,%rax
+  802216:	00 00 00 
+  802219:	ff d0                	call   *%rax
+  80221b:	41 89 c1             	mov    %eax,%r9d
+  80221e:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  802225:	48 c1 e1 0c          	shl    $0xc,%rcx
+  802229:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80222f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802234:	4c 89 e6             	mov    %r12,%rsi
+  802237:	bf 00 00 00 00       	mov    $0x0,%edi
+  80223c:	48 b8 a8 10 80 00 00 	movabs $0x8010a8,%rax
+  802243:	00 00 00 
+  802246:	ff d0                	call   *%rax
+  802248:	85 c0                	test   %eax,%eax
+  80224a:	78 17                	js     802263 <mmap_alloc+0x8b>
+        return &mmaps[i];
+  80224c:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  802250:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  802257:	00 00 00 
+  80225a:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  80225e:	5b                   	pop    %rbx
+  80225f:	41 5c                	pop    %r12
+  802261:	5d                   	pop    %rbp
+  802262:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  802263:	b8 00 00 00 00       	mov    $0x0,%eax
+  802268:	eb f4                	jmp    80225e <mmap_alloc+0x86>
+
+000000000080226a <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  80226a:	55                   	push   %rbp
+  80226b:	48 89 e5             	mov    %rsp,%rbp
+  80226e:	41 56                	push   %r14
+  802270:	41 55                	push   %r13
+  802272:	41 54                	push   %r12
+  802274:	53                   	push   %rbx
+  802275:	48 83 ec 10          	sub    $0x10,%rsp
+  802279:	41 89 fc             	mov    %edi,%r12d
+  80227c:	49 89 f5             	mov    %rsi,%r13
+  80227f:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  802282:	48 89 f0             	mov    %rsi,%rax
+  802285:	48 09 d0             	or     %rdx,%rax
+  802288:	75 0d                	jne    802297 <fsipc+0x2d>
+  80228a:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  80228d:	83 f8 04             	cmp    $0x4,%eax
+  802290:	76 7d                	jbe    80230f <fsipc+0xa5>
+  802292:	83 ff 0d             	cmp    $0xd,%edi
+  802295:	74 78                	je     80230f <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  802297:	48 b8 b7 1b 80 00 00 	movabs $0x801bb7,%rax
+  80229e:	00 00 00 
+  8022a1:	ff d0                	call   *%rax
+  8022a3:	89 c7                	mov    %eax,%edi
+  8022a5:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  8022ac:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  8022b3:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  8022ba:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8022c0:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  8022c7:	00 00 00 
+  8022ca:	44 89 e6             	mov    %r12d,%esi
+  8022cd:	48 b8 f2 45 80 00 00 	movabs $0x8045f2,%rax
+  8022d4:	00 00 00 
+  8022d7:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  8022d9:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8022e0:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  8022e1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022e6:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8022ea:	4c 89 ee             	mov    %r13,%rsi
+  8022ed:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022f2:	48 b8 ce 45 80 00 00 	movabs $0x8045ce,%rax
+  8022f9:	00 00 00 
+  8022fc:	ff d0                	call   *%rax
+  8022fe:	89 c3                	mov    %eax,%ebx
+}
+  802300:	89 d8                	mov    %ebx,%eax
+  802302:	48 83 c4 10          	add    $0x10,%rsp
+  802306:	5b                   	pop    %rbx
+  802307:	41 5c                	pop    %r12
+  802309:	41 5d                	pop    %r13
+  80230b:	41 5e                	pop    %r14
+  80230d:	5d                   	pop    %rbp
+  80230e:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  80230f:	48 b8 1c 1d 80 00 00 	movabs $0x801d1c,%rax
+  802316:	00 00 00 
+  802319:	ff d0                	call   *%rax
+  80231b:	49 89 c6             	mov    %rax,%r14
+  80231e:	48 85 c0             	test   %rax,%rax
+  802321:	0f 84 70 ff ff ff    	je     802297 <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  802327:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  80232b:	48 b8 1f 3e 80 00 00 	movabs $0x803e1f,%rax
+  802332:	00 00 00 
+  802335:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  802337:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  80233a:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  802341:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  802345:	ba 10 00 00 00       	mov    $0x10,%edx
+  80234a:	48 be 00 00 83 00 00 	movabs $0x830000,%rsi
+  802351:	00 00 00 
+  802354:	48 b8 54 0d 80 00 00 	movabs $0x800d54,%rax
+  80235b:	00 00 00 
+  80235e:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  802360:	4c 89 f7             	mov    %r14,%rdi
+  802363:	48 b8 b8 1d 80 00 00 	movabs $0x801db8,%rax
+  80236a:	00 00 00 
+  80236d:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  80236f:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  802376:	4c 89 f7             	mov    %r14,%rdi
+  802379:	48 b8 e2 3e 80 00 00 	movabs $0x803ee2,%rax
+  802380:	00 00 00 
+  802383:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  802385:	4c 89 f7             	mov    %r14,%rdi
+  802388:	48 b8 70 3e 80 00 00 	movabs $0x803e70,%rax
+  80238f:	00 00 00 
+  802392:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  802394:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  802397:	41 83 fc 05          	cmp    $0x5,%r12d
+  80239b:	75 04                	jne    8023a1 <fsipc+0x137>
+  80239d:	85 db                	test   %ebx,%ebx
+  80239f:	79 14                	jns    8023b5 <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  8023a1:	4c 89 f7             	mov    %r14,%rdi
+  8023a4:	48 b8 97 3e 80 00 00 	movabs $0x803e97,%rax
+  8023ab:	00 00 00 
+  8023ae:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  8023b0:	e9 4b ff ff ff       	jmp    802300 <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  8023b5:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  8023b9:	ba 88 00 00 00       	mov    $0x88,%edx
+  8023be:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  8023c5:	00 00 00 
+  8023c8:	48 b8 54 0d 80 00 00 	movabs $0x800d54,%rax
+  8023cf:	00 00 00 
+  8023d2:	ff d0                	call   *%rax
+  8023d4:	eb cb                	jmp    8023a1 <fsipc+0x137>
+
+00000000008023d6 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  8023d6:	55                   	push   %rbp
+  8023d7:	48 89 e5             	mov    %rsp,%rbp
+  8023da:	41 57                	push   %r15
+  8023dc:	41 56                	push   %r14
+  8023de:	41 55                	push   %r13
+  8023e0:	41 54                	push   %r12
+  8023e2:	53                   	push   %rbx
+  8023e3:	48 83 ec 18          	sub    $0x18,%rsp
+  8023e7:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  8023eb:	49 89 f6             	mov    %rsi,%r14
+  8023ee:	49 89 d4             	mov    %rdx,%r12
+  8023f1:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  8023f4:	48 b8 1c 1d 80 00 00 	movabs $0x801d1c,%rax
+  8023fb:	00 00 00 
+  8023fe:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  802400:	48 85 c0             	test   %rax,%rax
+  802403:	0f 85 96 00 00 00    	jne    80249f <devfile_write_direct+0xc9>
+    size_t write = 0;
+  802409:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802410:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802411:	49 bf 00 00 83 00 00 	movabs $0x830000,%r15
+  802418:	00 00 00 
+    while (n) {
+  80241b:	4d 85 e4             	test   %r12,%r12
+  80241e:	74 79                	je     802499 <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802420:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  802425:	49 39 dc             	cmp    %rbx,%r12
+  802428:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  80242c:	48 89 da             	mov    %rbx,%rdx
+  80242f:	4c 89 f6             	mov    %r14,%rsi
+  802432:	48 bf 00 10 83 00 00 	movabs $0x831000,%rdi
+  802439:	00 00 00 
+  80243c:	48 b8 54 0d 80 00 00 	movabs $0x800d54,%rax
+  802443:	00 00 00 
+  802446:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802448:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80244c:	8b 40 0c             	mov    0xc(%rax),%eax
+  80244f:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  802452:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802455:	44 01 e8             	add    %r13d,%eax
+  802458:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  80245c:	41 0f 44 c5          	cmove  %r13d,%eax
+  802460:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  802464:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  802468:	48 89 da             	mov    %rbx,%rdx
+  80246b:	be 00 00 00 00       	mov    $0x0,%esi
+  802470:	bf 04 00 00 00       	mov    $0x4,%edi
+  802475:	48 b8 6a 22 80 00 00 	movabs $0x80226a,%rax
+  80247c:	00 00 00 
+  80247f:	ff d0                	call   *%rax
+        if (res < 0)
+  802481:	85 c0                	test   %eax,%eax
+  802483:	78 4a                	js     8024cf <devfile_write_direct+0xf9>
+        buf += res;
+  802485:	48 98                	cltq
+  802487:	49 01 c6             	add    %rax,%r14
+        write += res;
+  80248a:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  80248e:	49 29 c4             	sub    %rax,%r12
+  802491:	75 8d                	jne    802420 <devfile_write_direct+0x4a>
+    return write;
+  802493:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802497:	eb 27                	jmp    8024c0 <devfile_write_direct+0xea>
+    size_t write = 0;
+  802499:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  80249d:	eb f4                	jmp    802493 <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  80249f:	45 89 e9             	mov    %r13d,%r9d
+  8024a2:	4d 89 e0             	mov    %r12,%r8
+  8024a5:	4c 89 f1             	mov    %r14,%rcx
+  8024a8:	ba 04 00 00 00       	mov    $0x4,%edx
+  8024ad:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8024b1:	48 89 c7             	mov    %rax,%rdi
+  8024b4:	48 b8 03 1e 80 00 00 	movabs $0x801e03,%rax
+  8024bb:	00 00 00 
+  8024be:	ff d0                	call   *%rax
+}
+  8024c0:	48 83 c4 18          	add    $0x18,%rsp
+  8024c4:	5b                   	pop    %rbx
+  8024c5:	41 5c                	pop    %r12
+  8024c7:	41 5d                	pop    %r13
+  8024c9:	41 5e                	pop    %r14
+  8024cb:	41 5f                	pop    %r15
+  8024cd:	5d                   	pop    %rbp
+  8024ce:	c3                   	ret
+            return res;
+  8024cf:	48 98                	cltq
+  8024d1:	eb ed                	jmp    8024c0 <devfile_write_direct+0xea>
+
+00000000008024d3 <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  8024d3:	55                   	push   %rbp
+  8024d4:	48 89 e5             	mov    %rsp,%rbp
+  8024d7:	41 54                	push   %r12
+  8024d9:	53                   	push   %rbx
+  8024da:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  8024dd:	48 b8 86 1d 80 00 00 	movabs $0x801d86,%rax
+  8024e4:	00 00 00 
+  8024e7:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  8024e9:	48 85 c0             	test   %rax,%rax
+  8024ec:	74 71                	je     80255f <fbuf_flush+0x8c>
+  8024ee:	48 89 c3             	mov    %rax,%rbx
+  8024f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024f6:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  8024fa:	75 05                	jne    802501 <fbuf_flush+0x2e>
+}
+  8024fc:	5b                   	pop    %rbx
+  8024fd:	41 5c                	pop    %r12
+  8024ff:	5d                   	pop    %rbp
+  802500:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  802501:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  802504:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  802508:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  80250f:	00 00 00 
+  802512:	48 89 de             	mov    %rbx,%rsi
+  802515:	48 29 c6             	sub    %rax,%rsi
+  802518:	48 c1 fe 03          	sar    $0x3,%rsi
+  80251c:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802523:	aa aa aa 
+  802526:	48 0f af f0          	imul   %rax,%rsi
+  80252a:	48 c1 e6 0e          	shl    $0xe,%rsi
+  80252e:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802533:	48 01 c6             	add    %rax,%rsi
+  802536:	4c 89 e7             	mov    %r12,%rdi
+  802539:	48 b8 d6 23 80 00 00 	movabs $0x8023d6,%rax
+  802540:	00 00 00 
+  802543:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  802545:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  802549:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802550:	00 
+    return res < 0 ? res : 0;
+  802551:	48 85 c0             	test   %rax,%rax
+  802554:	ba 00 00 00 00       	mov    $0x0,%edx
+  802559:	48 0f 4f c2          	cmovg  %rdx,%rax
+  80255d:	eb 9d                	jmp    8024fc <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  80255f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802564:	eb 96                	jmp    8024fc <fbuf_flush+0x29>
+
+0000000000802566 <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  802566:	55                   	push   %rbp
+  802567:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  80256a:	48 b8 d3 24 80 00 00 	movabs $0x8024d3,%rax
+  802571:	00 00 00 
+  802574:	ff d0                	call   *%rax
+}
+  802576:	5d                   	pop    %rbp
+  802577:	c3                   	ret
+
+0000000000802578 <devfile_write>:
+    if (!fd || !buf)
+  802578:	48 85 ff             	test   %rdi,%rdi
+  80257b:	0f 84 d3 01 00 00    	je     802754 <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802581:	55                   	push   %rbp
+  802582:	48 89 e5             	mov    %rsp,%rbp
+  802585:	41 57                	push   %r15
+  802587:	41 56                	push   %r14
+  802589:	41 55                	push   %r13
+  80258b:	41 54                	push   %r12
+  80258d:	53                   	push   %rbx
+  80258e:	48 83 ec 08          	sub    $0x8,%rsp
+  802592:	49 89 fc             	mov    %rdi,%r12
+  802595:	49 89 f6             	mov    %rsi,%r14
+  802598:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  80259b:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  8025a0:	48 85 f6             	test   %rsi,%rsi
+  8025a3:	0f 84 9c 01 00 00    	je     802745 <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  8025a9:	48 b8 86 1d 80 00 00 	movabs $0x801d86,%rax
+  8025b0:	00 00 00 
+  8025b3:	ff d0                	call   *%rax
+  8025b5:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  8025b8:	48 85 c0             	test   %rax,%rax
+  8025bb:	0f 84 a2 00 00 00    	je     802663 <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  8025c1:	be 00 10 00 00       	mov    $0x1000,%esi
+  8025c6:	4c 89 e7             	mov    %r12,%rdi
+  8025c9:	48 b8 17 10 80 00 00 	movabs $0x801017,%rax
+  8025d0:	00 00 00 
+  8025d3:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  8025d5:	83 f8 02             	cmp    $0x2,%eax
+  8025d8:	0f 8f 85 00 00 00    	jg     802663 <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  8025de:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8025e5:	00 00 00 
+  8025e8:	4d 89 ef             	mov    %r13,%r15
+  8025eb:	49 29 c7             	sub    %rax,%r15
+  8025ee:	49 c1 ff 03          	sar    $0x3,%r15
+  8025f2:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8025f9:	aa aa aa 
+  8025fc:	4c 0f af f8          	imul   %rax,%r15
+  802600:	49 c1 e7 0e          	shl    $0xe,%r15
+  802604:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802609:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  80260c:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802611:	0f 84 d7 00 00 00    	je     8026ee <devfile_write+0x176>
+  802617:	49 8b 45 10          	mov    0x10(%r13),%rax
+  80261b:	89 c2                	mov    %eax,%edx
+  80261d:	41 03 55 0c          	add    0xc(%r13),%edx
+  802621:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  802626:	75 0f                	jne    802637 <devfile_write+0xbf>
+  802628:	48 01 d8             	add    %rbx,%rax
+  80262b:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  802631:	0f 86 92 00 00 00    	jbe    8026c9 <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802637:	4c 89 e7             	mov    %r12,%rdi
+  80263a:	48 b8 d3 24 80 00 00 	movabs $0x8024d3,%rax
+  802641:	00 00 00 
+  802644:	ff d0                	call   *%rax
+  802646:	85 c0                	test   %eax,%eax
+  802648:	78 52                	js     80269c <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  80264a:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802651:	77 7f                	ja     8026d2 <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  802653:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802658:	0f 85 c2 00 00 00    	jne    802720 <devfile_write+0x1a8>
+  80265e:	e9 94 00 00 00       	jmp    8026f7 <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  802663:	4c 89 e7             	mov    %r12,%rdi
+  802666:	48 b8 d3 24 80 00 00 	movabs $0x8024d3,%rax
+  80266d:	00 00 00 
+  802670:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802672:	85 c0                	test   %eax,%eax
+  802674:	79 07                	jns    80267d <devfile_write+0x105>
+  802676:	48 98                	cltq
+  802678:	e9 c8 00 00 00       	jmp    802745 <devfile_write+0x1cd>
+  80267d:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802682:	48 89 da             	mov    %rbx,%rdx
+  802685:	4c 89 f6             	mov    %r14,%rsi
+  802688:	4c 89 e7             	mov    %r12,%rdi
+  80268b:	48 b8 d6 23 80 00 00 	movabs $0x8023d6,%rax
+  802692:	00 00 00 
+  802695:	ff d0                	call   *%rax
+  802697:	e9 a9 00 00 00       	jmp    802745 <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  80269c:	48 98                	cltq
+  80269e:	e9 a2 00 00 00       	jmp    802745 <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8026a3:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8026a8:	ba 00 40 00 00       	mov    $0x4000,%edx
+  8026ad:	4c 89 fe             	mov    %r15,%rsi
+  8026b0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8026b5:	48 b8 52 10 80 00 00 	movabs $0x801052,%rax
+  8026bc:	00 00 00 
+  8026bf:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  8026c1:	85 c0                	test   %eax,%eax
+  8026c3:	79 45                	jns    80270a <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8026c5:	48 98                	cltq
+  8026c7:	eb 7c                	jmp    802745 <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  8026c9:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  8026d0:	76 4e                	jbe    802720 <devfile_write+0x1a8>
+  8026d2:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  8026d7:	48 89 da             	mov    %rbx,%rdx
+  8026da:	4c 89 f6             	mov    %r14,%rsi
+  8026dd:	4c 89 e7             	mov    %r12,%rdi
+  8026e0:	48 b8 d6 23 80 00 00 	movabs $0x8023d6,%rax
+  8026e7:	00 00 00 
+  8026ea:	ff d0                	call   *%rax
+  8026ec:	eb 57                	jmp    802745 <devfile_write+0x1cd>
+  8026ee:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  8026f5:	77 db                	ja     8026d2 <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  8026f7:	4c 89 ff             	mov    %r15,%rdi
+  8026fa:	48 b8 a1 3c 80 00 00 	movabs $0x803ca1,%rax
+  802701:	00 00 00 
+  802704:	ff d0                	call   *%rax
+  802706:	84 c0                	test   %al,%al
+  802708:	74 99                	je     8026a3 <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  80270a:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  80270f:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802714:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  802718:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  80271f:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  802720:	4c 89 ff             	mov    %r15,%rdi
+  802723:	49 03 7d 10          	add    0x10(%r13),%rdi
+  802727:	48 89 da             	mov    %rbx,%rdx
+  80272a:	4c 89 f6             	mov    %r14,%rsi
+  80272d:	48 b8 54 0d 80 00 00 	movabs $0x800d54,%rax
+  802734:	00 00 00 
+  802737:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  802739:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  80273d:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  802742:	48 89 d8             	mov    %rbx,%rax
+}
+  802745:	48 83 c4 08          	add    $0x8,%rsp
+  802749:	5b                   	pop    %rbx
+  80274a:	41 5c                	pop    %r12
+  80274c:	41 5d                	pop    %r13
+  80274e:	41 5e                	pop    %r14
+  802750:	41 5f                	pop    %r15
+  802752:	5d                   	pop    %rbp
+  802753:	c3                   	ret
+        return E_INVAL;
+  802754:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802759:	c3                   	ret
+
+000000000080275a <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80275a:	55                   	push   %rbp
+  80275b:	48 89 e5             	mov    %rsp,%rbp
+  80275e:	41 54                	push   %r12
+  802760:	53                   	push   %rbx
+  802761:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  802764:	48 b8 d3 24 80 00 00 	movabs $0x8024d3,%rax
+  80276b:	00 00 00 
+  80276e:	ff d0                	call   *%rax
+  802770:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  802773:	48 89 df             	mov    %rbx,%rdi
+  802776:	48 b8 86 1d 80 00 00 	movabs $0x801d86,%rax
+  80277d:	00 00 00 
+  802780:	ff d0                	call   *%rax
+  802782:	48 85 c0             	test   %rax,%rax
+  802785:	74 17                	je     80279e <devfile_flush+0x44>
+  802787:	48 89 df             	mov    %rbx,%rdi
+  80278a:	48 b8 86 1d 80 00 00 	movabs $0x801d86,%rax
+  802791:	00 00 00 
+  802794:	ff d0                	call   *%rax
+  802796:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  80279d:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80279e:	8b 43 0c             	mov    0xc(%rbx),%eax
+  8027a1:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  8027a8:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  8027aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027af:	be 00 00 00 00       	mov    $0x0,%esi
+  8027b4:	bf 06 00 00 00       	mov    $0x6,%edi
+  8027b9:	48 b8 6a 22 80 00 00 	movabs $0x80226a,%rax
+  8027c0:	00 00 00 
+  8027c3:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  8027c5:	45 85 e4             	test   %r12d,%r12d
+  8027c8:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  8027cc:	5b                   	pop    %rbx
+  8027cd:	41 5c                	pop    %r12
+  8027cf:	5d                   	pop    %rbp
+  8027d0:	c3                   	ret
+
+00000000008027d1 <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  8027d1:	55                   	push   %rbp
+  8027d2:	48 89 e5             	mov    %rsp,%rbp
+  8027d5:	41 57                	push   %r15
+  8027d7:	41 56                	push   %r14
+  8027d9:	41 55                	push   %r13
+  8027db:	41 54                	push   %r12
+  8027dd:	53                   	push   %rbx
+  8027de:	48 83 ec 38          	sub    $0x38,%rsp
+  8027e2:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8027e6:	49 89 f7             	mov    %rsi,%r15
+  8027e9:	48 89 d3             	mov    %rdx,%rbx
+  8027ec:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  8027ef:	48 b8 1c 1d 80 00 00 	movabs $0x801d1c,%rax
+  8027f6:	00 00 00 
+  8027f9:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  8027fb:	48 85 c0             	test   %rax,%rax
+  8027fe:	75 20                	jne    802820 <devfile_read_direct+0x4f>
+    bool map = 1;
+  802800:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  802805:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  80280c:	00 
+    while (n) {
+  80280d:	48 85 db             	test   %rbx,%rbx
+  802810:	0f 85 df 00 00 00    	jne    8028f5 <devfile_read_direct+0x124>
+    size_t read = 0;
+  802816:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  80281a:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80281e:	eb 21                	jmp    802841 <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802820:	45 89 f1             	mov    %r14d,%r9d
+  802823:	49 89 d8             	mov    %rbx,%r8
+  802826:	4c 89 f9             	mov    %r15,%rcx
+  802829:	ba 03 00 00 00       	mov    $0x3,%edx
+  80282e:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802832:	48 89 c7             	mov    %rax,%rdi
+  802835:	48 b8 03 1e 80 00 00 	movabs $0x801e03,%rax
+  80283c:	00 00 00 
+  80283f:	ff d0                	call   *%rax
+}
+  802841:	48 83 c4 38          	add    $0x38,%rsp
+  802845:	5b                   	pop    %rbx
+  802846:	41 5c                	pop    %r12
+  802848:	41 5d                	pop    %r13
+  80284a:	41 5e                	pop    %r14
+  80284c:	41 5f                	pop    %r15
+  80284e:	5d                   	pop    %rbp
+  80284f:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802850:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802854:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  80285a:	75 1e                	jne    80287a <devfile_read_direct+0xa9>
+  80285c:	e9 e2 00 00 00       	jmp    802943 <devfile_read_direct+0x172>
+            if (!res) return read;
+  802861:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802865:	eb da                	jmp    802841 <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  802867:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  80286b:	0f 85 d0 01 00 00    	jne    802a41 <devfile_read_direct+0x270>
+            map = 0;
+  802871:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802875:	eb 03                	jmp    80287a <devfile_read_direct+0xa9>
+  802877:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  80287a:	ba 00 00 01 00       	mov    $0x10000,%edx
+  80287f:	48 39 d3             	cmp    %rdx,%rbx
+  802882:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802886:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80288a:	8b 40 0c             	mov    0xc(%rax),%eax
+  80288d:	48 b9 00 00 83 00 00 	movabs $0x830000,%rcx
+  802894:	00 00 00 
+  802897:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  802899:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  80289d:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  8028a1:	be 00 00 00 00       	mov    $0x0,%esi
+  8028a6:	bf 03 00 00 00       	mov    $0x3,%edi
+  8028ab:	48 b8 6a 22 80 00 00 	movabs $0x80226a,%rax
+  8028b2:	00 00 00 
+  8028b5:	ff d0                	call   *%rax
+        if (res <= 0)
+  8028b7:	85 c0                	test   %eax,%eax
+  8028b9:	0f 8e 63 01 00 00    	jle    802a22 <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  8028bf:	4c 63 e0             	movslq %eax,%r12
+  8028c2:	4c 89 e2             	mov    %r12,%rdx
+  8028c5:	48 be 00 10 83 00 00 	movabs $0x831000,%rsi
+  8028cc:	00 00 00 
+  8028cf:	4c 89 ff             	mov    %r15,%rdi
+  8028d2:	48 b8 54 0d 80 00 00 	movabs $0x800d54,%rax
+  8028d9:	00 00 00 
+  8028dc:	ff d0                	call   *%rax
+        buf += res;
+  8028de:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  8028e1:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  8028e4:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  8028e8:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  8028ec:	48 85 db             	test   %rbx,%rbx
+  8028ef:	0f 84 25 ff ff ff    	je     80281a <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  8028f5:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  8028f8:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  8028fc:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802900:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802904:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  80290b:	0f 97 c2             	seta   %dl
+  80290e:	20 c2                	and    %al,%dl
+  802910:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  802913:	0f 84 5e ff ff ff    	je     802877 <devfile_read_direct+0xa6>
+  802919:	4c 89 fa             	mov    %r15,%rdx
+  80291c:	4d 89 fd             	mov    %r15,%r13
+  80291f:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  802926:	0f 85 4e ff ff ff    	jne    80287a <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  80292c:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802930:	0f 84 1a ff ff ff    	je     802850 <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802936:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  80293d:	0f 85 37 ff ff ff    	jne    80287a <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  802943:	48 89 d8             	mov    %rbx,%rax
+  802946:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  80294c:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802951:	48 39 c8             	cmp    %rcx,%rax
+  802954:	48 0f 47 c1          	cmova  %rcx,%rax
+  802958:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  80295c:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  802960:	49 89 d4             	mov    %rdx,%r12
+  802963:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  802967:	48 b8 42 3c 80 00 00 	movabs $0x803c42,%rax
+  80296e:	00 00 00 
+  802971:	ff d0                	call   *%rax
+  802973:	a8 40                	test   $0x40,%al
+  802975:	0f 85 b9 00 00 00    	jne    802a34 <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  80297b:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  802982:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802986:	49 39 c5             	cmp    %rax,%r13
+  802989:	72 d8                	jb     802963 <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80298b:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  80298f:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802996:	00 00 00 
+  802999:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  80299d:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  8029a0:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  8029a2:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  8029a6:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  8029aa:	48 b8 b7 1b 80 00 00 	movabs $0x801bb7,%rax
+  8029b1:	00 00 00 
+  8029b4:	ff d0                	call   *%rax
+  8029b6:	89 c7                	mov    %eax,%edi
+  8029b8:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8029be:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8029c3:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  8029ca:	00 00 00 
+  8029cd:	be 0e 00 00 00       	mov    $0xe,%esi
+  8029d2:	48 b8 f2 45 80 00 00 	movabs $0x8045f2,%rax
+  8029d9:	00 00 00 
+  8029dc:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  8029de:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8029e3:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  8029e7:	4c 89 fe             	mov    %r15,%rsi
+  8029ea:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029ef:	48 b8 ce 45 80 00 00 	movabs $0x8045ce,%rax
+  8029f6:	00 00 00 
+  8029f9:	ff d0                	call   *%rax
+  8029fb:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  8029fe:	48 85 d2             	test   %rdx,%rdx
+  802a01:	0f 84 5a fe ff ff    	je     802861 <devfile_read_direct+0x90>
+            if (res > 0) {
+  802a07:	0f 8e 5a fe ff ff    	jle    802867 <devfile_read_direct+0x96>
+                buf += res;
+  802a0d:	48 98                	cltq
+  802a0f:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  802a12:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  802a15:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  802a19:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  802a1d:	e9 ca fe ff ff       	jmp    8028ec <devfile_read_direct+0x11b>
+            return res ? res : read;
+  802a22:	41 89 c5             	mov    %eax,%r13d
+  802a25:	48 98                	cltq
+  802a27:	45 85 ed             	test   %r13d,%r13d
+  802a2a:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  802a2f:	e9 0d fe ff ff       	jmp    802841 <devfile_read_direct+0x70>
+            map = 0;
+  802a34:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802a38:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802a3c:	e9 39 fe ff ff       	jmp    80287a <devfile_read_direct+0xa9>
+  802a41:	48 89 d0             	mov    %rdx,%rax
+  802a44:	e9 f8 fd ff ff       	jmp    802841 <devfile_read_direct+0x70>
+
+0000000000802a49 <devfile_read>:
+    if (!fd || !buf)
+  802a49:	48 85 ff             	test   %rdi,%rdi
+  802a4c:	0f 84 21 02 00 00    	je     802c73 <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802a52:	55                   	push   %rbp
+  802a53:	48 89 e5             	mov    %rsp,%rbp
+  802a56:	41 57                	push   %r15
+  802a58:	41 56                	push   %r14
+  802a5a:	41 55                	push   %r13
+  802a5c:	41 54                	push   %r12
+  802a5e:	53                   	push   %rbx
+  802a5f:	48 83 ec 28          	sub    $0x28,%rsp
+  802a63:	48 89 fb             	mov    %rdi,%rbx
+  802a66:	49 89 f4             	mov    %rsi,%r12
+  802a69:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  802a6c:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802a71:	48 85 f6             	test   %rsi,%rsi
+  802a74:	74 4b                	je     802ac1 <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  802a76:	48 b8 86 1d 80 00 00 	movabs $0x801d86,%rax
+  802a7d:	00 00 00 
+  802a80:	ff d0                	call   *%rax
+  802a82:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802a85:	48 85 c0             	test   %rax,%rax
+  802a88:	74 22                	je     802aac <devfile_read+0x63>
+  802a8a:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  802a91:	77 19                	ja     802aac <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802a93:	be 00 10 00 00       	mov    $0x1000,%esi
+  802a98:	48 89 df             	mov    %rbx,%rdi
+  802a9b:	48 b8 17 10 80 00 00 	movabs $0x801017,%rax
+  802aa2:	00 00 00 
+  802aa5:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802aa7:	83 f8 02             	cmp    $0x2,%eax
+  802aaa:	7e 40                	jle    802aec <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  802aac:	48 89 df             	mov    %rbx,%rdi
+  802aaf:	48 b8 d3 24 80 00 00 	movabs $0x8024d3,%rax
+  802ab6:	00 00 00 
+  802ab9:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802abb:	85 c0                	test   %eax,%eax
+  802abd:	79 11                	jns    802ad0 <devfile_read+0x87>
+  802abf:	48 98                	cltq
+}
+  802ac1:	48 83 c4 28          	add    $0x28,%rsp
+  802ac5:	5b                   	pop    %rbx
+  802ac6:	41 5c                	pop    %r12
+  802ac8:	41 5d                	pop    %r13
+  802aca:	41 5e                	pop    %r14
+  802acc:	41 5f                	pop    %r15
+  802ace:	5d                   	pop    %rbp
+  802acf:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802ad0:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802ad5:	4c 89 ea             	mov    %r13,%rdx
+  802ad8:	4c 89 e6             	mov    %r12,%rsi
+  802adb:	48 89 df             	mov    %rbx,%rdi
+  802ade:	48 b8 d1 27 80 00 00 	movabs $0x8027d1,%rax
+  802ae5:	00 00 00 
+  802ae8:	ff d0                	call   *%rax
+  802aea:	eb d5                	jmp    802ac1 <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  802aec:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802af0:	48 89 df             	mov    %rbx,%rdi
+  802af3:	48 b8 d3 24 80 00 00 	movabs $0x8024d3,%rax
+  802afa:	00 00 00 
+  802afd:	ff d0                	call   *%rax
+  802aff:	85 c0                	test   %eax,%eax
+  802b01:	0f 88 33 01 00 00    	js     802c3a <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  802b07:	48 ba 00 23 82 00 00 	movabs $0x822300,%rdx
+  802b0e:	00 00 00 
+  802b11:	4c 89 f0             	mov    %r14,%rax
+  802b14:	48 29 d0             	sub    %rdx,%rax
+  802b17:	48 c1 f8 03          	sar    $0x3,%rax
+  802b1b:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  802b22:	aa aa aa 
+  802b25:	48 0f af c2          	imul   %rdx,%rax
+  802b29:	48 c1 e0 0e          	shl    $0xe,%rax
+  802b2d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  802b31:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802b34:	41 39 06             	cmp    %eax,(%r14)
+  802b37:	75 0d                	jne    802b46 <devfile_read+0xfd>
+  802b39:	8b 43 10             	mov    0x10(%rbx),%eax
+  802b3c:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  802b40:	0f 84 fb 00 00 00    	je     802c41 <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  802b46:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802b4b:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802b4f:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  802b52:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802b56:	48 89 c7             	mov    %rax,%rdi
+  802b59:	48 b8 a1 3c 80 00 00 	movabs $0x803ca1,%rax
+  802b60:	00 00 00 
+  802b63:	ff d0                	call   *%rax
+  802b65:	84 c0                	test   %al,%al
+  802b67:	75 27                	jne    802b90 <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802b69:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802b6e:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802b73:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802b77:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b7c:	48 b8 52 10 80 00 00 	movabs $0x801052,%rax
+  802b83:	00 00 00 
+  802b86:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  802b88:	85 c0                	test   %eax,%eax
+  802b8a:	0f 88 dc 00 00 00    	js     802c6c <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  802b90:	44 89 f8             	mov    %r15d,%eax
+  802b93:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802b98:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  802b9a:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  802ba1:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  802ba2:	8b 43 10             	mov    0x10(%rbx),%eax
+  802ba5:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  802ba9:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  802bac:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802bb1:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802bb5:	48 89 df             	mov    %rbx,%rdi
+  802bb8:	48 b8 d1 27 80 00 00 	movabs $0x8027d1,%rax
+  802bbf:	00 00 00 
+  802bc2:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  802bc4:	48 85 c0             	test   %rax,%rax
+  802bc7:	0f 88 f4 fe ff ff    	js     802ac1 <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  802bcd:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802bd0:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  802bd3:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  802bd6:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  802bda:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  802bde:	48 63 d1             	movslq %ecx,%rdx
+  802be1:	48 01 d0             	add    %rdx,%rax
+  802be4:	4d 63 ff             	movslq %r15d,%r15
+  802be7:	4c 29 f8             	sub    %r15,%rax
+  802bea:	ba 00 00 00 00       	mov    $0x0,%edx
+  802bef:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  802bf3:	48 85 c0             	test   %rax,%rax
+  802bf6:	0f 8e c5 fe ff ff    	jle    802ac1 <devfile_read+0x78>
+    n = MIN(n, res);
+  802bfc:	4c 39 e8             	cmp    %r13,%rax
+  802bff:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  802c03:	8b 73 04             	mov    0x4(%rbx),%esi
+  802c06:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  802c0a:	48 63 f6             	movslq %esi,%rsi
+  802c0d:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802c12:	48 01 c6             	add    %rax,%rsi
+  802c15:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c19:	48 01 c6             	add    %rax,%rsi
+  802c1c:	4c 89 ea             	mov    %r13,%rdx
+  802c1f:	4c 89 e7             	mov    %r12,%rdi
+  802c22:	48 b8 54 0d 80 00 00 	movabs $0x800d54,%rax
+  802c29:	00 00 00 
+  802c2c:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  802c2e:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  802c32:	4c 89 e8             	mov    %r13,%rax
+  802c35:	e9 87 fe ff ff       	jmp    802ac1 <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802c3a:	48 98                	cltq
+  802c3c:	e9 80 fe ff ff       	jmp    802ac1 <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  802c41:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  802c45:	41 39 d7             	cmp    %edx,%r15d
+  802c48:	0f 8c f8 fe ff ff    	jl     802b46 <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  802c4e:	49 8b 46 10          	mov    0x10(%r14),%rax
+  802c52:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  802c55:	41 39 cf             	cmp    %ecx,%r15d
+  802c58:	0f 8d e8 fe ff ff    	jge    802b46 <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  802c5e:	4d 63 ff             	movslq %r15d,%r15
+  802c61:	4c 29 f8             	sub    %r15,%rax
+  802c64:	48 63 d2             	movslq %edx,%rdx
+  802c67:	48 01 d0             	add    %rdx,%rax
+  802c6a:	eb 87                	jmp    802bf3 <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802c6c:	48 98                	cltq
+  802c6e:	e9 4e fe ff ff       	jmp    802ac1 <devfile_read+0x78>
+        return E_INVAL;
+  802c73:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802c78:	c3                   	ret
+
+0000000000802c79 <fs_channel>:
+fs_channel(bool enable) {
+  802c79:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  802c7b:	a2 04 26 82 00 00 00 	movabs %al,0x822604
+  802c82:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  802c84:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c89:	40 84 ff             	test   %dil,%dil
+  802c8c:	74 47                	je     802cd5 <fs_channel+0x5c>
+  802c8e:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  802c95:	00 00 00 
+  802c98:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  802c9e:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  802ca5:	00 00 00 
+  802ca8:	3b 08                	cmp    (%rax),%ecx
+  802caa:	74 29                	je     802cd5 <fs_channel+0x5c>
+fs_channel(bool enable) {
+  802cac:	55                   	push   %rbp
+  802cad:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  802cb0:	48 b8 f9 1b 80 00 00 	movabs $0x801bf9,%rax
+  802cb7:	00 00 00 
+  802cba:	ff d0                	call   *%rax
+  802cbc:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  802cbe:	85 c0                	test   %eax,%eax
+  802cc0:	78 04                	js     802cc6 <fs_channel+0x4d>
+}
+  802cc2:	89 d0                	mov    %edx,%eax
+  802cc4:	5d                   	pop    %rbp
+  802cc5:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  802cc6:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  802ccd:	00 00 00 
+  802cd0:	c6 00 00             	movb   $0x0,(%rax)
+  802cd3:	eb ed                	jmp    802cc2 <fs_channel+0x49>
+}
+  802cd5:	89 d0                	mov    %edx,%eax
+  802cd7:	c3                   	ret
+
+0000000000802cd8 <open>:
+open(const char *path, int mode) {
+  802cd8:	55                   	push   %rbp
+  802cd9:	48 89 e5             	mov    %rsp,%rbp
+  802cdc:	41 55                	push   %r13
+  802cde:	41 54                	push   %r12
+  802ce0:	53                   	push   %rbx
+  802ce1:	48 83 ec 18          	sub    $0x18,%rsp
+  802ce5:	49 89 fc             	mov    %rdi,%r12
+  802ce8:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802ceb:	48 b8 b5 0a 80 00 00 	movabs $0x800ab5,%rax
+  802cf2:	00 00 00 
+  802cf5:	ff d0                	call   *%rax
+  802cf7:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802cfd:	0f 87 8f 00 00 00    	ja     802d92 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802d03:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802d07:	48 b8 b3 14 80 00 00 	movabs $0x8014b3,%rax
+  802d0e:	00 00 00 
+  802d11:	ff d0                	call   *%rax
+  802d13:	89 c3                	mov    %eax,%ebx
+  802d15:	85 c0                	test   %eax,%eax
+  802d17:	78 55                	js     802d6e <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  802d19:	4c 89 e6             	mov    %r12,%rsi
+  802d1c:	48 bb 00 00 83 00 00 	movabs $0x830000,%rbx
+  802d23:	00 00 00 
+  802d26:	48 89 df             	mov    %rbx,%rdi
+  802d29:	48 b8 f3 0a 80 00 00 	movabs $0x800af3,%rax
+  802d30:	00 00 00 
+  802d33:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802d35:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  802d3c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d41:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802d45:	bf 01 00 00 00       	mov    $0x1,%edi
+  802d4a:	48 b8 6a 22 80 00 00 	movabs $0x80226a,%rax
+  802d51:	00 00 00 
+  802d54:	ff d0                	call   *%rax
+  802d56:	89 c3                	mov    %eax,%ebx
+  802d58:	85 c0                	test   %eax,%eax
+  802d5a:	78 1f                	js     802d7b <open+0xa3>
+    return fd2num(fd);
+  802d5c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802d60:	48 b8 85 14 80 00 00 	movabs $0x801485,%rax
+  802d67:	00 00 00 
+  802d6a:	ff d0                	call   *%rax
+  802d6c:	89 c3                	mov    %eax,%ebx
+}
+  802d6e:	89 d8                	mov    %ebx,%eax
+  802d70:	48 83 c4 18          	add    $0x18,%rsp
+  802d74:	5b                   	pop    %rbx
+  802d75:	41 5c                	pop    %r12
+  802d77:	41 5d                	pop    %r13
+  802d79:	5d                   	pop    %rbp
+  802d7a:	c3                   	ret
+        fd_close(fd, 0);
+  802d7b:	be 00 00 00 00       	mov    $0x0,%esi
+  802d80:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802d84:	48 b8 ce 15 80 00 00 	movabs $0x8015ce,%rax
+  802d8b:	00 00 00 
+  802d8e:	ff d0                	call   *%rax
+        return res;
+  802d90:	eb dc                	jmp    802d6e <open+0x96>
+        return -E_BAD_PATH;
+  802d92:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802d97:	eb d5                	jmp    802d6e <open+0x96>
+
+0000000000802d99 <file_flush_buffers>:
+file_flush_buffers(void) {
+  802d99:	55                   	push   %rbp
+  802d9a:	48 89 e5             	mov    %rsp,%rbp
+  802d9d:	41 56                	push   %r14
+  802d9f:	41 55                	push   %r13
+  802da1:	41 54                	push   %r12
+  802da3:	53                   	push   %rbx
+  802da4:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  802da8:	49 bc 08 23 82 00 00 	movabs $0x822308,%r12
+  802daf:	00 00 00 
+  802db2:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  802db7:	49 bd 13 15 80 00 00 	movabs $0x801513,%r13
+  802dbe:	00 00 00 
+  802dc1:	49 be d3 24 80 00 00 	movabs $0x8024d3,%r14
+  802dc8:	00 00 00 
+  802dcb:	eb 0c                	jmp    802dd9 <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  802dcd:	83 c3 01             	add    $0x1,%ebx
+  802dd0:	49 83 c4 18          	add    $0x18,%r12
+  802dd4:	83 fb 20             	cmp    $0x20,%ebx
+  802dd7:	74 1d                	je     802df6 <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  802dd9:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  802dde:	74 ed                	je     802dcd <file_flush_buffers+0x34>
+  802de0:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802de4:	89 df                	mov    %ebx,%edi
+  802de6:	41 ff d5             	call   *%r13
+  802de9:	85 c0                	test   %eax,%eax
+  802deb:	78 e0                	js     802dcd <file_flush_buffers+0x34>
+  802ded:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802df1:	41 ff d6             	call   *%r14
+  802df4:	eb d7                	jmp    802dcd <file_flush_buffers+0x34>
+}
+  802df6:	48 83 c4 10          	add    $0x10,%rsp
+  802dfa:	5b                   	pop    %rbx
+  802dfb:	41 5c                	pop    %r12
+  802dfd:	41 5d                	pop    %r13
+  802dff:	41 5e                	pop    %r14
+  802e01:	5d                   	pop    %rbp
+  802e02:	c3                   	ret
+
+0000000000802e03 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802e03:	55                   	push   %rbp
+  802e04:	48 89 e5             	mov    %rsp,%rbp
+  802e07:	41 54                	push   %r12
+  802e09:	53                   	push   %rbx
+  802e0a:	49 89 fc             	mov    %rdi,%r12
+  802e0d:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  802e0f:	48 b8 99 2d 80 00 00 	movabs $0x802d99,%rax
+  802e16:	00 00 00 
+  802e19:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802e1b:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  802e22:	00 00 00 
+  802e25:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  802e2a:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802e2c:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  802e2f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e34:	be 00 00 00 00       	mov    $0x0,%esi
+  802e39:	bf 02 00 00 00       	mov    $0x2,%edi
+  802e3e:	48 b8 6a 22 80 00 00 	movabs $0x80226a,%rax
+  802e45:	00 00 00 
+  802e48:	ff d0                	call   *%rax
+}
+  802e4a:	5b                   	pop    %rbx
+  802e4b:	41 5c                	pop    %r12
+  802e4d:	5d                   	pop    %rbp
+  802e4e:	c3                   	ret
+
+0000000000802e4f <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802e4f:	55                   	push   %rbp
+  802e50:	48 89 e5             	mov    %rsp,%rbp
+  802e53:	41 54                	push   %r12
+  802e55:	53                   	push   %rbx
+  802e56:	49 89 fc             	mov    %rdi,%r12
+  802e59:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  802e5c:	48 b8 99 2d 80 00 00 	movabs $0x802d99,%rax
+  802e63:	00 00 00 
+  802e66:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802e68:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  802e6d:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  802e74:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  802e76:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e7b:	be 00 00 00 00       	mov    $0x0,%esi
+  802e80:	bf 05 00 00 00       	mov    $0x5,%edi
+  802e85:	48 b8 6a 22 80 00 00 	movabs $0x80226a,%rax
+  802e8c:	00 00 00 
+  802e8f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802e91:	85 c0                	test   %eax,%eax
+  802e93:	78 3d                	js     802ed2 <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802e95:	49 bc 00 00 83 00 00 	movabs $0x830000,%r12
+  802e9c:	00 00 00 
+  802e9f:	4c 89 e6             	mov    %r12,%rsi
+  802ea2:	48 89 df             	mov    %rbx,%rdi
+  802ea5:	48 b8 f3 0a 80 00 00 	movabs $0x800af3,%rax
+  802eac:	00 00 00 
+  802eaf:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802eb1:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802eb8:	00 
+  802eb9:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802ebf:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802ec6:	00 
+  802ec7:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802ecd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ed2:	5b                   	pop    %rbx
+  802ed3:	41 5c                	pop    %r12
+  802ed5:	5d                   	pop    %rbp
+  802ed6:	c3                   	ret
+
+0000000000802ed7 <remove>:
+remove(const char *path) {
+  802ed7:	55                   	push   %rbp
+  802ed8:	48 89 e5             	mov    %rsp,%rbp
+  802edb:	53                   	push   %rbx
+  802edc:	48 83 ec 08          	sub    $0x8,%rsp
+  802ee0:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  802ee3:	48 b8 b5 0a 80 00 00 	movabs $0x800ab5,%rax
+  802eea:	00 00 00 
+  802eed:	ff d0                	call   *%rax
+  802eef:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802ef5:	77 3a                	ja     802f31 <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  802ef7:	48 89 de             	mov    %rbx,%rsi
+  802efa:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  802f01:	00 00 00 
+  802f04:	48 b8 f3 0a 80 00 00 	movabs $0x800af3,%rax
+  802f0b:	00 00 00 
+  802f0e:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  802f10:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f15:	be 00 00 00 00       	mov    $0x0,%esi
+  802f1a:	bf 07 00 00 00       	mov    $0x7,%edi
+  802f1f:	48 b8 6a 22 80 00 00 	movabs $0x80226a,%rax
+  802f26:	00 00 00 
+  802f29:	ff d0                	call   *%rax
+}
+  802f2b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f2f:	c9                   	leave
+  802f30:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  802f31:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  802f36:	eb f3                	jmp    802f2b <remove+0x54>
+
+0000000000802f38 <sync>:
+sync(void) {
+  802f38:	55                   	push   %rbp
+  802f39:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  802f3c:	48 b8 99 2d 80 00 00 	movabs $0x802d99,%rax
+  802f43:	00 00 00 
+  802f46:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  802f48:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f4d:	be 00 00 00 00       	mov    $0x0,%esi
+  802f52:	bf 08 00 00 00       	mov    $0x8,%edi
+  802f57:	48 b8 6a 22 80 00 00 	movabs $0x80226a,%rax
+  802f5e:	00 00 00 
+  802f61:	ff d0                	call   *%rax
+}
+  802f63:	5d                   	pop    %rbp
+  802f64:	c3                   	ret
+
+0000000000802f65 <fsync>:
+fsync(int fdnum) {
+  802f65:	55                   	push   %rbp
+  802f66:	48 89 e5             	mov    %rsp,%rbp
+  802f69:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802f6d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802f71:	48 b8 13 15 80 00 00 	movabs $0x801513,%rax
+  802f78:	00 00 00 
+  802f7b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802f7d:	85 c0                	test   %eax,%eax
+  802f7f:	78 4b                	js     802fcc <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802f81:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802f85:	48 b8 20 50 80 00 00 	movabs $0x805020,%rax
+  802f8c:	00 00 00 
+  802f8f:	8b 00                	mov    (%rax),%eax
+  802f91:	39 02                	cmp    %eax,(%rdx)
+  802f93:	75 39                	jne    802fce <fsync+0x69>
+    file_flush_buffers();
+  802f95:	48 b8 99 2d 80 00 00 	movabs $0x802d99,%rax
+  802f9c:	00 00 00 
+  802f9f:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  802fa1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802fa5:	8b 40 0c             	mov    0xc(%rax),%eax
+  802fa8:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  802faf:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  802fb1:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fb6:	be 00 00 00 00       	mov    $0x0,%esi
+  802fbb:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802fc0:	48 b8 6a 22 80 00 00 	movabs $0x80226a,%rax
+  802fc7:	00 00 00 
+  802fca:	ff d0                	call   *%rax
+}
+  802fcc:	c9                   	leave
+  802fcd:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802fce:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802fd3:	eb f7                	jmp    802fcc <fsync+0x67>
+
+0000000000802fd5 <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  802fd5:	55                   	push   %rbp
+  802fd6:	48 89 e5             	mov    %rsp,%rbp
+  802fd9:	53                   	push   %rbx
+  802fda:	48 83 ec 08          	sub    $0x8,%rsp
+  802fde:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  802fe1:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fe6:	be 00 00 00 00       	mov    $0x0,%esi
+  802feb:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802ff0:	48 b8 6a 22 80 00 00 	movabs $0x80226a,%rax
+  802ff7:	00 00 00 
+  802ffa:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802ffc:	85 c0                	test   %eax,%eax
+  802ffe:	78 2d                	js     80302d <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  803000:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803007:	00 00 00 
+  80300a:	48 8b 10             	mov    (%rax),%rdx
+  80300d:	48 89 13             	mov    %rdx,(%rbx)
+  803010:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  803014:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  803018:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80301c:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  803020:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803024:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  803028:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80302d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803031:	c9                   	leave
+  803032:	c3                   	ret
+
+0000000000803033 <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  803033:	55                   	push   %rbp
+  803034:	48 89 e5             	mov    %rsp,%rbp
+  803037:	53                   	push   %rbx
+  803038:	48 83 ec 08          	sub    $0x8,%rsp
+  80303c:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  80303f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803044:	be 00 00 00 00       	mov    $0x0,%esi
+  803049:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80304e:	48 b8 6a 22 80 00 00 	movabs $0x80226a,%rax
+  803055:	00 00 00 
+  803058:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80305a:	85 c0                	test   %eax,%eax
+  80305c:	78 3d                	js     80309b <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  80305e:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803065:	00 00 00 
+  803068:	48 8b 10             	mov    (%rax),%rdx
+  80306b:	48 89 13             	mov    %rdx,(%rbx)
+  80306e:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  803072:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  803076:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80307a:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  80307e:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  803082:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  803086:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  80308a:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  80308e:	48 8b 40 28          	mov    0x28(%rax),%rax
+  803092:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  803096:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80309b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80309f:	c9                   	leave
+  8030a0:	c3                   	ret
+
+00000000008030a1 <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  8030a1:	55                   	push   %rbp
+  8030a2:	48 89 e5             	mov    %rsp,%rbp
+  8030a5:	41 57                	push   %r15
+  8030a7:	41 56                	push   %r14
+  8030a9:	41 55                	push   %r13
+  8030ab:	41 54                	push   %r12
+  8030ad:	53                   	push   %rbx
+  8030ae:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  8030b2:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  8030b9:	00 
+  8030ba:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  8030c1:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8030c7:	0f 85 43 01 00 00    	jne    803210 <munmap+0x16f>
+  8030cd:	49 89 ff             	mov    %rdi,%r15
+  8030d0:	4c 39 f7             	cmp    %r14,%rdi
+  8030d3:	0f 87 37 01 00 00    	ja     803210 <munmap+0x16f>
+  8030d9:	48 bb 00 20 82 00 00 	movabs $0x822000,%rbx
+  8030e0:	00 00 00 
+  8030e3:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  8030e9:	eb 2c                	jmp    803117 <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  8030eb:	4c 39 f8             	cmp    %r15,%rax
+  8030ee:	0f 83 85 00 00 00    	jae    803179 <munmap+0xd8>
+            m->mm_end = start;
+  8030f4:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8030f9:	48 83 c3 18          	add    $0x18,%rbx
+  8030fd:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  803104:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  80310b:	00 00 00 
+  80310e:	48 39 c3             	cmp    %rax,%rbx
+  803111:	0f 84 d0 00 00 00    	je     8031e7 <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  803117:	49 89 dc             	mov    %rbx,%r12
+  80311a:	48 8b 03             	mov    (%rbx),%rax
+  80311d:	4c 39 f0             	cmp    %r14,%rax
+  803120:	73 d7                	jae    8030f9 <munmap+0x58>
+  803122:	48 85 c0             	test   %rax,%rax
+  803125:	74 d2                	je     8030f9 <munmap+0x58>
+  803127:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  80312b:	49 39 d7             	cmp    %rdx,%r15
+  80312e:	73 c9                	jae    8030f9 <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  803130:	49 39 d6             	cmp    %rdx,%r14
+  803133:	73 b6                	jae    8030eb <munmap+0x4a>
+  803135:	49 39 c7             	cmp    %rax,%r15
+  803138:	76 b1                	jbe    8030eb <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  80313a:	4c 89 ef             	mov    %r13,%rdi
+  80313d:	48 b8 d8 21 80 00 00 	movabs $0x8021d8,%rax
+  803144:	00 00 00 
+  803147:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  803149:	48 85 c0             	test   %rax,%rax
+  80314c:	0f 84 c5 00 00 00    	je     803217 <munmap+0x176>
+            *tail = *m;
+  803152:	48 8b 13             	mov    (%rbx),%rdx
+  803155:	48 89 10             	mov    %rdx,(%rax)
+  803158:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  80315c:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  803160:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  803164:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  803168:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  80316b:	44 89 f2             	mov    %r14d,%edx
+  80316e:	2b 13                	sub    (%rbx),%edx
+  803170:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  803173:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  803177:	eb 80                	jmp    8030f9 <munmap+0x58>
+        } else if (m->mm_end > end) {
+  803179:	49 39 d6             	cmp    %rdx,%r14
+  80317c:	73 18                	jae    803196 <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  80317e:	44 89 f2             	mov    %r14d,%edx
+  803181:	41 03 54 24 10       	add    0x10(%r12),%edx
+  803186:	29 c2                	sub    %eax,%edx
+  803188:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  80318d:	4d 89 34 24          	mov    %r14,(%r12)
+  803191:	e9 63 ff ff ff       	jmp    8030f9 <munmap+0x58>
+    m->mm_start = 0;
+  803196:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  80319d:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  80319e:	4c 89 e6             	mov    %r12,%rsi
+  8031a1:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8031a8:	00 00 00 
+  8031ab:	48 29 c6             	sub    %rax,%rsi
+  8031ae:	48 c1 fe 03          	sar    $0x3,%rsi
+  8031b2:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8031b9:	aa aa aa 
+  8031bc:	48 0f af f0          	imul   %rax,%rsi
+  8031c0:	48 c1 e6 0c          	shl    $0xc,%rsi
+  8031c4:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  8031c9:	48 01 c6             	add    %rax,%rsi
+  8031cc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8031d1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031d6:	48 b8 f8 10 80 00 00 	movabs $0x8010f8,%rax
+  8031dd:	00 00 00 
+  8031e0:	ff d0                	call   *%rax
+}
+  8031e2:	e9 12 ff ff ff       	jmp    8030f9 <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  8031e7:	4c 89 f2             	mov    %r14,%rdx
+  8031ea:	4c 29 fa             	sub    %r15,%rdx
+  8031ed:	4c 89 fe             	mov    %r15,%rsi
+  8031f0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031f5:	48 b8 f8 10 80 00 00 	movabs $0x8010f8,%rax
+  8031fc:	00 00 00 
+  8031ff:	ff d0                	call   *%rax
+}
+  803201:	48 83 c4 08          	add    $0x8,%rsp
+  803205:	5b                   	pop    %rbx
+  803206:	41 5c                	pop    %r12
+  803208:	41 5d                	pop    %r13
+  80320a:	41 5e                	pop    %r14
+  80320c:	41 5f                	pop    %r15
+  80320e:	5d                   	pop    %rbp
+  80320f:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  803210:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803215:	eb ea                	jmp    803201 <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  803217:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  80321c:	eb e3                	jmp    803201 <munmap+0x160>
+
+000000000080321e <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  80321e:	55                   	push   %rbp
+  80321f:	48 89 e5             	mov    %rsp,%rbp
+  803222:	41 57                	push   %r15
+  803224:	41 56                	push   %r14
+  803226:	41 55                	push   %r13
+  803228:	41 54                	push   %r12
+  80322a:	53                   	push   %rbx
+  80322b:	48 83 ec 28          	sub    $0x28,%rsp
+  80322f:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  803233:	49 89 f5             	mov    %rsi,%r13
+  803236:	41 89 d6             	mov    %edx,%r14d
+  803239:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  80323c:	41 89 cc             	mov    %ecx,%r12d
+  80323f:	44 89 c7             	mov    %r8d,%edi
+  803242:	44 89 cb             	mov    %r9d,%ebx
+  803245:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803249:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80324d:	48 b8 13 15 80 00 00 	movabs $0x801513,%rax
+  803254:	00 00 00 
+  803257:	ff d0                	call   *%rax
+  803259:	41 89 c7             	mov    %eax,%r15d
+  80325c:	85 c0                	test   %eax,%eax
+  80325e:	0f 88 ae 01 00 00    	js     803412 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803264:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803268:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  80326f:	00 00 00 
+  803272:	8b 32                	mov    (%rdx),%esi
+  803274:	39 30                	cmp    %esi,(%rax)
+  803276:	0f 85 7a 02 00 00    	jne    8034f6 <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  80327c:	8b 40 08             	mov    0x8(%rax),%eax
+  80327f:	83 e0 03             	and    $0x3,%eax
+  803282:	83 f8 01             	cmp    $0x1,%eax
+  803285:	0f 84 76 02 00 00    	je     803501 <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  80328b:	4d 85 ed             	test   %r13,%r13
+  80328e:	0f 84 78 02 00 00    	je     80350c <mmap+0x2ee>
+  803294:	85 db                	test   %ebx,%ebx
+  803296:	0f 88 70 02 00 00    	js     80350c <mmap+0x2ee>
+  80329c:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  8032a2:	41 89 df             	mov    %ebx,%r15d
+  8032a5:	0f 85 6c 02 00 00    	jne    803517 <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  8032ab:	44 89 f0             	mov    %r14d,%eax
+  8032ae:	83 e0 fd             	and    $0xfffffffd,%eax
+  8032b1:	83 f8 04             	cmp    $0x4,%eax
+  8032b4:	0f 85 68 02 00 00    	jne    803522 <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  8032ba:	44 89 e1             	mov    %r12d,%ecx
+  8032bd:	83 e1 01             	and    $0x1,%ecx
+  8032c0:	0f 95 c2             	setne  %dl
+  8032c3:	44 89 e0             	mov    %r12d,%eax
+  8032c6:	d1 e8                	shr    %eax
+  8032c8:	83 f0 01             	xor    $0x1,%eax
+  8032cb:	83 e0 01             	and    $0x1,%eax
+  8032ce:	38 c2                	cmp    %al,%dl
+  8032d0:	0f 85 57 02 00 00    	jne    80352d <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  8032d6:	85 c9                	test   %ecx,%ecx
+  8032d8:	74 0a                	je     8032e4 <mmap+0xc6>
+  8032da:	41 f6 c6 02          	test   $0x2,%r14b
+  8032de:	0f 85 54 02 00 00    	jne    803538 <mmap+0x31a>
+    file_flush_buffers();
+  8032e4:	48 b8 99 2d 80 00 00 	movabs $0x802d99,%rax
+  8032eb:	00 00 00 
+  8032ee:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  8032f0:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  8032f7:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  8032fe:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803302:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  803305:	41 f6 c4 04          	test   $0x4,%r12b
+  803309:	0f 84 15 01 00 00    	je     803424 <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  80330f:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  803312:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  803318:	0f 85 25 02 00 00    	jne    803543 <mmap+0x325>
+  80331e:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  803322:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  803329:	00 00 00 
+  80332c:	48 39 c2             	cmp    %rax,%rdx
+  80332f:	0f 82 19 02 00 00    	jb     80354e <mmap+0x330>
+  803335:	48 39 c7             	cmp    %rax,%rdi
+  803338:	0f 87 10 02 00 00    	ja     80354e <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  80333e:	4c 89 ee             	mov    %r13,%rsi
+  803341:	48 b8 a1 30 80 00 00 	movabs $0x8030a1,%rax
+  803348:	00 00 00 
+  80334b:	ff d0                	call   *%rax
+  80334d:	85 c0                	test   %eax,%eax
+  80334f:	0f 88 04 02 00 00    	js     803559 <mmap+0x33b>
+    if (!handler) {
+  803355:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  80335c:	00 00 00 
+  80335f:	80 38 00             	cmpb   $0x0,(%rax)
+  803362:	75 2b                	jne    80338f <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  803364:	48 bf 39 21 80 00 00 	movabs $0x802139,%rdi
+  80336b:	00 00 00 
+  80336e:	48 b8 9d 42 80 00 00 	movabs $0x80429d,%rax
+  803375:	00 00 00 
+  803378:	ff d0                	call   *%rax
+  80337a:	85 c0                	test   %eax,%eax
+  80337c:	0f 88 ea 01 00 00    	js     80356c <mmap+0x34e>
+        handler = 1;
+  803382:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  803389:	00 00 00 
+  80338c:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  80338f:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803393:	48 b8 d8 21 80 00 00 	movabs $0x8021d8,%rax
+  80339a:	00 00 00 
+  80339d:	ff d0                	call   *%rax
+  80339f:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  8033a2:	48 85 c0             	test   %rax,%rax
+  8033a5:	0f 84 c9 01 00 00    	je     803574 <mmap+0x356>
+    m->mm_start = va;
+  8033ab:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  8033ae:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  8033b2:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  8033b6:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  8033b9:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  8033bd:	44 89 e0             	mov    %r12d,%eax
+  8033c0:	c1 e0 06             	shl    $0x6,%eax
+  8033c3:	25 80 00 00 00       	and    $0x80,%eax
+  8033c8:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  8033cb:	09 f0                	or     %esi,%eax
+  8033cd:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  8033d1:	41 f6 c4 08          	test   $0x8,%r12b
+  8033d5:	74 31                	je     803408 <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  8033d7:	48 39 d3             	cmp    %rdx,%rbx
+  8033da:	73 2c                	jae    803408 <mmap+0x1ea>
+  8033dc:	ba 00 00 04 00       	mov    $0x40000,%edx
+  8033e1:	48 89 de             	mov    %rbx,%rsi
+  8033e4:	4c 89 f7             	mov    %r14,%rdi
+  8033e7:	48 b8 28 20 80 00 00 	movabs $0x802028,%rax
+  8033ee:	00 00 00 
+  8033f1:	ff d0                	call   *%rax
+  8033f3:	49 89 c4             	mov    %rax,%r12
+  8033f6:	48 85 c0             	test   %rax,%rax
+  8033f9:	0f 8e d7 00 00 00    	jle    8034d6 <mmap+0x2b8>
+            va += n;
+  8033ff:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  803402:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  803406:	72 d4                	jb     8033dc <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  803408:	49 8b 06             	mov    (%r14),%rax
+  80340b:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  80340f:	48 89 06             	mov    %rax,(%rsi)
+}
+  803412:	44 89 f8             	mov    %r15d,%eax
+  803415:	48 83 c4 28          	add    $0x28,%rsp
+  803419:	5b                   	pop    %rbx
+  80341a:	41 5c                	pop    %r12
+  80341c:	41 5d                	pop    %r13
+  80341e:	41 5e                	pop    %r14
+  803420:	41 5f                	pop    %r15
+  803422:	5d                   	pop    %rbp
+  803423:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803424:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  80342b:	00 00 00 
+  80342e:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  803431:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  803438:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80343b:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  803440:	48 be 00 20 82 00 00 	movabs $0x822000,%rsi
+  803447:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80344a:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  803451:	00 00 00 
+  803454:	48 39 d7             	cmp    %rdx,%rdi
+  803457:	73 1c                	jae    803475 <mmap+0x257>
+        return -E_NO_MEM;
+  803459:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80345f:	eb b1                	jmp    803412 <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803461:	48 83 c0 01          	add    $0x1,%rax
+  803465:	48 83 f8 1f          	cmp    $0x1f,%rax
+  803469:	77 3f                	ja     8034aa <mmap+0x28c>
+  80346b:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  803470:	48 39 d7             	cmp    %rdx,%rdi
+  803473:	72 2a                	jb     80349f <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  803475:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  803479:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  80347d:	48 39 d1             	cmp    %rdx,%rcx
+  803480:	73 df                	jae    803461 <mmap+0x243>
+  803482:	48 85 c9             	test   %rcx,%rcx
+  803485:	74 da                	je     803461 <mmap+0x243>
+  803487:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  80348b:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  803490:	48 39 d3             	cmp    %rdx,%rbx
+  803493:	73 cc                	jae    803461 <mmap+0x243>
+            va = mmaps[i].mm_end;
+  803495:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803498:	b8 00 00 00 00       	mov    $0x0,%eax
+  80349d:	eb cc                	jmp    80346b <mmap+0x24d>
+        return -E_NO_MEM;
+  80349f:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8034a5:	e9 68 ff ff ff       	jmp    803412 <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  8034aa:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  8034af:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  8034b6:	00 00 00 
+  8034b9:	48 39 c2             	cmp    %rax,%rdx
+  8034bc:	0f 82 9f 00 00 00    	jb     803561 <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  8034c2:	48 85 db             	test   %rbx,%rbx
+  8034c5:	0f 85 8a fe ff ff    	jne    803355 <mmap+0x137>
+        return -E_NO_MEM;
+  8034cb:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8034d1:	e9 3c ff ff ff       	jmp    803412 <mmap+0x1f4>
+        if (n < 0) {
+  8034d6:	0f 89 2c ff ff ff    	jns    803408 <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  8034dc:	49 8b 3e             	mov    (%r14),%rdi
+  8034df:	4c 89 ee             	mov    %r13,%rsi
+  8034e2:	48 b8 a1 30 80 00 00 	movabs $0x8030a1,%rax
+  8034e9:	00 00 00 
+  8034ec:	ff d0                	call   *%rax
+            return n;
+  8034ee:	45 89 e7             	mov    %r12d,%r15d
+  8034f1:	e9 1c ff ff ff       	jmp    803412 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8034f6:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8034fc:	e9 11 ff ff ff       	jmp    803412 <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  803501:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803507:	e9 06 ff ff ff       	jmp    803412 <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  80350c:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803512:	e9 fb fe ff ff       	jmp    803412 <mmap+0x1f4>
+  803517:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80351d:	e9 f0 fe ff ff       	jmp    803412 <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  803522:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803528:	e9 e5 fe ff ff       	jmp    803412 <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  80352d:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803533:	e9 da fe ff ff       	jmp    803412 <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  803538:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  80353e:	e9 cf fe ff ff       	jmp    803412 <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  803543:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803549:	e9 c4 fe ff ff       	jmp    803412 <mmap+0x1f4>
+  80354e:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803554:	e9 b9 fe ff ff       	jmp    803412 <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  803559:	41 89 c7             	mov    %eax,%r15d
+  80355c:	e9 b1 fe ff ff       	jmp    803412 <mmap+0x1f4>
+        return -E_NO_MEM;
+  803561:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803567:	e9 a6 fe ff ff       	jmp    803412 <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  80356c:	41 89 c7             	mov    %eax,%r15d
+  80356f:	e9 9e fe ff ff       	jmp    803412 <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  803574:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80357a:	e9 93 fe ff ff       	jmp    803412 <mmap+0x1f4>
+
+000000000080357f <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80357f:	55                   	push   %rbp
+  803580:	48 89 e5             	mov    %rsp,%rbp
+  803583:	41 54                	push   %r12
+  803585:	53                   	push   %rbx
+  803586:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803589:	48 b8 97 14 80 00 00 	movabs $0x801497,%rax
+  803590:	00 00 00 
+  803593:	ff d0                	call   *%rax
+  803595:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803598:	48 be 00 4d 80 00 00 	movabs $0x804d00,%rsi
+  80359f:	00 00 00 
+  8035a2:	48 89 df             	mov    %rbx,%rdi
+  8035a5:	48 b8 f3 0a 80 00 00 	movabs $0x800af3,%rax
+  8035ac:	00 00 00 
+  8035af:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8035b1:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8035b6:	41 2b 04 24          	sub    (%r12),%eax
+  8035ba:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8035c0:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8035c7:	00 00 00 
+    stat->st_dev = &devpipe;
+  8035ca:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  8035d1:	00 00 00 
+  8035d4:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8035db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035e0:	5b                   	pop    %rbx
+  8035e1:	41 5c                	pop    %r12
+  8035e3:	5d                   	pop    %rbp
+  8035e4:	c3                   	ret
+
+00000000008035e5 <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  8035e5:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8035e8:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  8035ee:	8b 17                	mov    (%rdi),%edx
+  8035f0:	85 d2                	test   %edx,%edx
+  8035f2:	75 01                	jne    8035f5 <pipe_wakeup+0x10>
+  8035f4:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  8035f5:	55                   	push   %rbp
+  8035f6:	48 89 e5             	mov    %rsp,%rbp
+  8035f9:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  8035fc:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  803602:	be 00 04 00 00       	mov    $0x400,%esi
+  803607:	48 b8 de 13 80 00 00 	movabs $0x8013de,%rax
+  80360e:	00 00 00 
+  803611:	ff d0                	call   *%rax
+}
+  803613:	5d                   	pop    %rbp
+  803614:	c3                   	ret
+
+0000000000803615 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803615:	55                   	push   %rbp
+  803616:	48 89 e5             	mov    %rsp,%rbp
+  803619:	41 55                	push   %r13
+  80361b:	41 54                	push   %r12
+  80361d:	53                   	push   %rbx
+  80361e:	48 83 ec 08          	sub    $0x8,%rsp
+  803622:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803625:	48 b8 97 14 80 00 00 	movabs $0x801497,%rax
+  80362c:	00 00 00 
+  80362f:	ff d0                	call   *%rax
+  803631:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803634:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803639:	4c 89 e6             	mov    %r12,%rsi
+  80363c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803641:	49 bc f8 10 80 00 00 	movabs $0x8010f8,%r12
+  803648:	00 00 00 
+  80364b:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  80364e:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803652:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803656:	49 bd e5 35 80 00 00 	movabs $0x8035e5,%r13
+  80365d:	00 00 00 
+  803660:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803663:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803667:	48 89 de             	mov    %rbx,%rsi
+  80366a:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  80366d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803672:	48 89 de             	mov    %rbx,%rsi
+  803675:	bf 00 00 00 00       	mov    $0x0,%edi
+  80367a:	41 ff d4             	call   *%r12
+  80367d:	48 83 c4 08          	add    $0x8,%rsp
+  803681:	5b                   	pop    %rbx
+  803682:	41 5c                	pop    %r12
+  803684:	41 5d                	pop    %r13
+  803686:	5d                   	pop    %rbp
+  803687:	c3                   	ret
+
+0000000000803688 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  803688:	55                   	push   %rbp
+  803689:	48 89 e5             	mov    %rsp,%rbp
+  80368c:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80368f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803694:	be 00 10 00 00       	mov    $0x1000,%esi
+  803699:	48 b8 3b 10 80 00 00 	movabs $0x80103b,%rax
+  8036a0:	00 00 00 
+  8036a3:	ff d0                	call   *%rax
+  8036a5:	85 c0                	test   %eax,%eax
+  8036a7:	0f 94 c0             	sete   %al
+  8036aa:	0f b6 c0             	movzbl %al,%eax
+}
+  8036ad:	5d                   	pop    %rbp
+  8036ae:	c3                   	ret
+
+00000000008036af <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8036af:	55                   	push   %rbp
+  8036b0:	48 89 e5             	mov    %rsp,%rbp
+  8036b3:	41 57                	push   %r15
+  8036b5:	41 56                	push   %r14
+  8036b7:	41 55                	push   %r13
+  8036b9:	41 54                	push   %r12
+  8036bb:	53                   	push   %rbx
+  8036bc:	48 83 ec 38          	sub    $0x38,%rsp
+  8036c0:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8036c4:	49 89 f4             	mov    %rsi,%r12
+  8036c7:	49 89 d7             	mov    %rdx,%r15
+  8036ca:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8036ce:	48 b8 97 14 80 00 00 	movabs $0x801497,%rax
+  8036d5:	00 00 00 
+  8036d8:	ff d0                	call   *%rax
+  8036da:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8036dd:	4d 85 ff             	test   %r15,%r15
+  8036e0:	0f 84 f1 00 00 00    	je     8037d7 <devpipe_write+0x128>
+  8036e6:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  8036ea:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  8036ee:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  8036f2:	49 bd 88 36 80 00 00 	movabs $0x803688,%r13
+  8036f9:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8036fc:	49 bf e5 35 80 00 00 	movabs $0x8035e5,%r15
+  803703:	00 00 00 
+  803706:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  80370a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80370e:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803712:	8b 73 04             	mov    0x4(%rbx),%esi
+  803715:	48 63 ce             	movslq %esi,%rcx
+  803718:	48 63 03             	movslq (%rbx),%rax
+  80371b:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  803721:	48 39 c1             	cmp    %rax,%rcx
+  803724:	72 64                	jb     80378a <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  803726:	48 89 de             	mov    %rbx,%rsi
+  803729:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80372d:	41 ff d5             	call   *%r13
+  803730:	85 c0                	test   %eax,%eax
+  803732:	0f 85 b9 00 00 00    	jne    8037f1 <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803738:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80373c:	4c 89 f7             	mov    %r14,%rdi
+  80373f:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  803742:	8b 43 04             	mov    0x4(%rbx),%eax
+  803745:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  80374c:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803753:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803759:	8b 03                	mov    (%rbx),%eax
+  80375b:	41 39 c4             	cmp    %eax,%r12d
+  80375e:	75 b2                	jne    803712 <devpipe_write+0x63>
+  803760:	48 89 de             	mov    %rbx,%rsi
+  803763:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803767:	41 ff d5             	call   *%r13
+  80376a:	85 c0                	test   %eax,%eax
+  80376c:	75 a0                	jne    80370e <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  80376e:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803773:	44 89 e6             	mov    %r12d,%esi
+  803776:	48 89 df             	mov    %rbx,%rdi
+  803779:	48 b8 c0 13 80 00 00 	movabs $0x8013c0,%rax
+  803780:	00 00 00 
+  803783:	ff d0                	call   *%rax
+  803785:	e9 7c ff ff ff       	jmp    803706 <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80378a:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  80378e:	41 0f b6 38          	movzbl (%r8),%edi
+  803792:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803799:	80 80 80 
+  80379c:	48 89 c8             	mov    %rcx,%rax
+  80379f:	48 f7 e2             	mul    %rdx
+  8037a2:	48 c1 ea 0b          	shr    $0xb,%rdx
+  8037a6:	48 89 d0             	mov    %rdx,%rax
+  8037a9:	48 c1 e0 08          	shl    $0x8,%rax
+  8037ad:	48 29 d0             	sub    %rdx,%rax
+  8037b0:	48 c1 e0 04          	shl    $0x4,%rax
+  8037b4:	48 29 c1             	sub    %rax,%rcx
+  8037b7:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  8037bc:	83 c6 01             	add    $0x1,%esi
+  8037bf:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8037c2:	49 83 c0 01          	add    $0x1,%r8
+  8037c6:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  8037ca:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8037ce:	49 39 c0             	cmp    %rax,%r8
+  8037d1:	0f 85 2f ff ff ff    	jne    803706 <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8037d7:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  8037db:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  8037df:	48 b8 e5 35 80 00 00 	movabs $0x8035e5,%rax
+  8037e6:	00 00 00 
+  8037e9:	ff d0                	call   *%rax
+    return n;
+  8037eb:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8037ef:	eb 05                	jmp    8037f6 <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  8037f1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8037f6:	48 83 c4 38          	add    $0x38,%rsp
+  8037fa:	5b                   	pop    %rbx
+  8037fb:	41 5c                	pop    %r12
+  8037fd:	41 5d                	pop    %r13
+  8037ff:	41 5e                	pop    %r14
+  803801:	41 5f                	pop    %r15
+  803803:	5d                   	pop    %rbp
+  803804:	c3                   	ret
+
+0000000000803805 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803805:	55                   	push   %rbp
+  803806:	48 89 e5             	mov    %rsp,%rbp
+  803809:	41 57                	push   %r15
+  80380b:	41 56                	push   %r14
+  80380d:	41 55                	push   %r13
+  80380f:	41 54                	push   %r12
+  803811:	53                   	push   %rbx
+  803812:	48 83 ec 28          	sub    $0x28,%rsp
+  803816:	49 89 fd             	mov    %rdi,%r13
+  803819:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  80381d:	49 89 d4             	mov    %rdx,%r12
+  803820:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803824:	48 b8 97 14 80 00 00 	movabs $0x801497,%rax
+  80382b:	00 00 00 
+  80382e:	ff d0                	call   *%rax
+  803830:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803833:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  803839:	49 bf 88 36 80 00 00 	movabs $0x803688,%r15
+  803840:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803843:	4d 85 e4             	test   %r12,%r12
+  803846:	0f 84 d5 00 00 00    	je     803921 <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  80384c:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803850:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803854:	8b 03                	mov    (%rbx),%eax
+  803856:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803859:	75 7a                	jne    8038d5 <devpipe_read+0xd0>
+            if (i > 0) {
+  80385b:	4d 85 f6             	test   %r14,%r14
+  80385e:	75 50                	jne    8038b0 <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  803860:	48 89 de             	mov    %rbx,%rsi
+  803863:	4c 89 ef             	mov    %r13,%rdi
+  803866:	41 ff d7             	call   *%r15
+  803869:	85 c0                	test   %eax,%eax
+  80386b:	0f 85 c9 00 00 00    	jne    80393a <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803871:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  803874:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  80387b:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803881:	8b 43 04             	mov    0x4(%rbx),%eax
+  803884:	41 39 c4             	cmp    %eax,%r12d
+  803887:	75 cb                	jne    803854 <devpipe_read+0x4f>
+  803889:	48 89 de             	mov    %rbx,%rsi
+  80388c:	4c 89 ef             	mov    %r13,%rdi
+  80388f:	41 ff d7             	call   *%r15
+  803892:	85 c0                	test   %eax,%eax
+  803894:	75 be                	jne    803854 <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803896:	ba 0a 00 00 00       	mov    $0xa,%edx
+  80389b:	44 89 e6             	mov    %r12d,%esi
+  80389e:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8038a2:	48 b8 c0 13 80 00 00 	movabs $0x8013c0,%rax
+  8038a9:	00 00 00 
+  8038ac:	ff d0                	call   *%rax
+  8038ae:	eb a4                	jmp    803854 <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  8038b0:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  8038b4:	48 89 de             	mov    %rbx,%rsi
+  8038b7:	48 b8 e5 35 80 00 00 	movabs $0x8035e5,%rax
+  8038be:	00 00 00 
+  8038c1:	ff d0                	call   *%rax
+                return i;
+  8038c3:	4c 89 f0             	mov    %r14,%rax
+}
+  8038c6:	48 83 c4 28          	add    $0x28,%rsp
+  8038ca:	5b                   	pop    %rbx
+  8038cb:	41 5c                	pop    %r12
+  8038cd:	41 5d                	pop    %r13
+  8038cf:	41 5e                	pop    %r14
+  8038d1:	41 5f                	pop    %r15
+  8038d3:	5d                   	pop    %rbp
+  8038d4:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8038d5:	48 63 c8             	movslq %eax,%rcx
+  8038d8:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  8038df:	80 80 80 
+  8038e2:	48 89 c8             	mov    %rcx,%rax
+  8038e5:	48 f7 e2             	mul    %rdx
+  8038e8:	48 c1 ea 0b          	shr    $0xb,%rdx
+  8038ec:	48 89 d0             	mov    %rdx,%rax
+  8038ef:	48 c1 e0 08          	shl    $0x8,%rax
+  8038f3:	48 29 d0             	sub    %rdx,%rax
+  8038f6:	48 c1 e0 04          	shl    $0x4,%rax
+  8038fa:	48 89 c2             	mov    %rax,%rdx
+  8038fd:	48 89 c8             	mov    %rcx,%rax
+  803900:	48 29 d0             	sub    %rdx,%rax
+  803903:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  803908:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80390c:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  803910:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803913:	49 83 c6 01          	add    $0x1,%r14
+  803917:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  80391b:	0f 85 2b ff ff ff    	jne    80384c <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803921:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803925:	48 89 de             	mov    %rbx,%rsi
+  803928:	48 b8 e5 35 80 00 00 	movabs $0x8035e5,%rax
+  80392f:	00 00 00 
+  803932:	ff d0                	call   *%rax
+    return n;
+  803934:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803938:	eb 8c                	jmp    8038c6 <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  80393a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80393f:	eb 85                	jmp    8038c6 <devpipe_read+0xc1>
+
+0000000000803941 <pipe>:
+pipe(int pfd[2]) {
+  803941:	55                   	push   %rbp
+  803942:	48 89 e5             	mov    %rsp,%rbp
+  803945:	41 55                	push   %r13
+  803947:	41 54                	push   %r12
+  803949:	53                   	push   %rbx
+  80394a:	48 83 ec 18          	sub    $0x18,%rsp
+  80394e:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803951:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803955:	48 b8 b3 14 80 00 00 	movabs $0x8014b3,%rax
+  80395c:	00 00 00 
+  80395f:	ff d0                	call   *%rax
+  803961:	89 c3                	mov    %eax,%ebx
+  803963:	85 c0                	test   %eax,%eax
+  803965:	0f 88 a0 01 00 00    	js     803b0b <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  80396b:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803970:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803975:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803979:	bf 00 00 00 00       	mov    $0x0,%edi
+  80397e:	48 b8 52 10 80 00 00 	movabs $0x801052,%rax
+  803985:	00 00 00 
+  803988:	ff d0                	call   *%rax
+  80398a:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80398c:	85 c0                	test   %eax,%eax
+  80398e:	0f 88 77 01 00 00    	js     803b0b <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803994:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803998:	48 b8 b3 14 80 00 00 	movabs $0x8014b3,%rax
+  80399f:	00 00 00 
+  8039a2:	ff d0                	call   *%rax
+  8039a4:	89 c3                	mov    %eax,%ebx
+  8039a6:	85 c0                	test   %eax,%eax
+  8039a8:	0f 88 43 01 00 00    	js     803af1 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8039ae:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8039b3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8039b8:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8039bc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039c1:	48 b8 52 10 80 00 00 	movabs $0x801052,%rax
+  8039c8:	00 00 00 
+  8039cb:	ff d0                	call   *%rax
+  8039cd:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8039cf:	85 c0                	test   %eax,%eax
+  8039d1:	0f 88 1a 01 00 00    	js     803af1 <pipe+0x1b0>
+    va = fd2data(fd0);
+  8039d7:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8039db:	48 b8 97 14 80 00 00 	movabs $0x801497,%rax
+  8039e2:	00 00 00 
+  8039e5:	ff d0                	call   *%rax
+  8039e7:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8039ea:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8039ef:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8039f4:	48 89 c6             	mov    %rax,%rsi
+  8039f7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039fc:	48 b8 52 10 80 00 00 	movabs $0x801052,%rax
+  803a03:	00 00 00 
+  803a06:	ff d0                	call   *%rax
+  803a08:	89 c3                	mov    %eax,%ebx
+  803a0a:	85 c0                	test   %eax,%eax
+  803a0c:	0f 88 c5 00 00 00    	js     803ad7 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803a12:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803a16:	48 b8 97 14 80 00 00 	movabs $0x801497,%rax
+  803a1d:	00 00 00 
+  803a20:	ff d0                	call   *%rax
+  803a22:	48 89 c1             	mov    %rax,%rcx
+  803a25:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803a2b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803a31:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a36:	4c 89 ee             	mov    %r13,%rsi
+  803a39:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a3e:	48 b8 a8 10 80 00 00 	movabs $0x8010a8,%rax
+  803a45:	00 00 00 
+  803a48:	ff d0                	call   *%rax
+  803a4a:	89 c3                	mov    %eax,%ebx
+  803a4c:	85 c0                	test   %eax,%eax
+  803a4e:	78 6e                	js     803abe <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803a50:	be 00 10 00 00       	mov    $0x1000,%esi
+  803a55:	4c 89 ef             	mov    %r13,%rdi
+  803a58:	48 b8 17 10 80 00 00 	movabs $0x801017,%rax
+  803a5f:	00 00 00 
+  803a62:	ff d0                	call   *%rax
+  803a64:	83 f8 02             	cmp    $0x2,%eax
+  803a67:	0f 85 ab 00 00 00    	jne    803b18 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803a6d:	a1 60 50 80 00 00 00 	movabs 0x805060,%eax
+  803a74:	00 00 
+  803a76:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803a7a:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803a7c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803a80:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803a87:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803a8b:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803a8d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803a91:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803a98:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803a9c:	48 bb 85 14 80 00 00 	movabs $0x801485,%rbx
+  803aa3:	00 00 00 
+  803aa6:	ff d3                	call   *%rbx
+  803aa8:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803aac:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803ab0:	ff d3                	call   *%rbx
+  803ab2:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803ab7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803abc:	eb 4d                	jmp    803b0b <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803abe:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ac3:	4c 89 ee             	mov    %r13,%rsi
+  803ac6:	bf 00 00 00 00       	mov    $0x0,%edi
+  803acb:	48 b8 f8 10 80 00 00 	movabs $0x8010f8,%rax
+  803ad2:	00 00 00 
+  803ad5:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803ad7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803adc:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803ae0:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ae5:	48 b8 f8 10 80 00 00 	movabs $0x8010f8,%rax
+  803aec:	00 00 00 
+  803aef:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803af1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803af6:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803afa:	bf 00 00 00 00       	mov    $0x0,%edi
+  803aff:	48 b8 f8 10 80 00 00 	movabs $0x8010f8,%rax
+  803b06:	00 00 00 
+  803b09:	ff d0                	call   *%rax
+}
+  803b0b:	89 d8                	mov    %ebx,%eax
+  803b0d:	48 83 c4 18          	add    $0x18,%rsp
+  803b11:	5b                   	pop    %rbx
+  803b12:	41 5c                	pop    %r12
+  803b14:	41 5d                	pop    %r13
+  803b16:	5d                   	pop    %rbp
+  803b17:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803b18:	48 b9 30 4d 80 00 00 	movabs $0x804d30,%rcx
+  803b1f:	00 00 00 
+  803b22:	48 ba 07 4d 80 00 00 	movabs $0x804d07,%rdx
+  803b29:	00 00 00 
+  803b2c:	be 50 00 00 00       	mov    $0x50,%esi
+  803b31:	48 bf 1c 4d 80 00 00 	movabs $0x804d1c,%rdi
+  803b38:	00 00 00 
+  803b3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b40:	49 b8 70 41 80 00 00 	movabs $0x804170,%r8
+  803b47:	00 00 00 
+  803b4a:	41 ff d0             	call   *%r8
+
+0000000000803b4d <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803b4d:	55                   	push   %rbp
+  803b4e:	48 89 e5             	mov    %rsp,%rbp
+  803b51:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803b55:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803b59:	48 b8 13 15 80 00 00 	movabs $0x801513,%rax
+  803b60:	00 00 00 
+  803b63:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803b65:	85 c0                	test   %eax,%eax
+  803b67:	78 23                	js     803b8c <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803b69:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803b6d:	48 b8 97 14 80 00 00 	movabs $0x801497,%rax
+  803b74:	00 00 00 
+  803b77:	ff d0                	call   *%rax
+  803b79:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  803b7c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803b80:	48 b8 88 36 80 00 00 	movabs $0x803688,%rax
+  803b87:	00 00 00 
+  803b8a:	ff d0                	call   *%rax
+}
+  803b8c:	c9                   	leave
+  803b8d:	c3                   	ret
+
+0000000000803b8e <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803b8e:	48 89 f8             	mov    %rdi,%rax
+  803b91:	48 c1 e8 27          	shr    $0x27,%rax
+  803b95:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803b9c:	01 00 00 
+  803b9f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803ba3:	f6 c2 01             	test   $0x1,%dl
+  803ba6:	74 6d                	je     803c15 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803ba8:	48 89 f8             	mov    %rdi,%rax
+  803bab:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803baf:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803bb6:	01 00 00 
+  803bb9:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803bbd:	f6 c2 01             	test   $0x1,%dl
+  803bc0:	74 62                	je     803c24 <get_uvpt_entry+0x96>
+  803bc2:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803bc9:	01 00 00 
+  803bcc:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803bd0:	f6 c2 80             	test   $0x80,%dl
+  803bd3:	75 4f                	jne    803c24 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803bd5:	48 89 f8             	mov    %rdi,%rax
+  803bd8:	48 c1 e8 15          	shr    $0x15,%rax
+  803bdc:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803be3:	01 00 00 
+  803be6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803bea:	f6 c2 01             	test   $0x1,%dl
+  803bed:	74 44                	je     803c33 <get_uvpt_entry+0xa5>
+  803bef:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803bf6:	01 00 00 
+  803bf9:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803bfd:	f6 c2 80             	test   $0x80,%dl
+  803c00:	75 31                	jne    803c33 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803c02:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803c06:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803c0d:	01 00 00 
+  803c10:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803c14:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803c15:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803c1c:	01 00 00 
+  803c1f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803c23:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803c24:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803c2b:	01 00 00 
+  803c2e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803c32:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803c33:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803c3a:	01 00 00 
+  803c3d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803c41:	c3                   	ret
+
+0000000000803c42 <get_prot>:
+
+int
+get_prot(void *va) {
+  803c42:	55                   	push   %rbp
+  803c43:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803c46:	48 b8 8e 3b 80 00 00 	movabs $0x803b8e,%rax
+  803c4d:	00 00 00 
+  803c50:	ff d0                	call   *%rax
+  803c52:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803c55:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803c5a:	89 c1                	mov    %eax,%ecx
+  803c5c:	83 c9 04             	or     $0x4,%ecx
+  803c5f:	f6 c2 01             	test   $0x1,%dl
+  803c62:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803c65:	89 c1                	mov    %eax,%ecx
+  803c67:	83 c9 02             	or     $0x2,%ecx
+  803c6a:	f6 c2 02             	test   $0x2,%dl
+  803c6d:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803c70:	89 c1                	mov    %eax,%ecx
+  803c72:	83 c9 01             	or     $0x1,%ecx
+  803c75:	48 85 d2             	test   %rdx,%rdx
+  803c78:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803c7b:	89 c1                	mov    %eax,%ecx
+  803c7d:	83 c9 40             	or     $0x40,%ecx
+  803c80:	f6 c6 04             	test   $0x4,%dh
+  803c83:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803c86:	5d                   	pop    %rbp
+  803c87:	c3                   	ret
+
+0000000000803c88 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803c88:	55                   	push   %rbp
+  803c89:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803c8c:	48 b8 8e 3b 80 00 00 	movabs $0x803b8e,%rax
+  803c93:	00 00 00 
+  803c96:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803c98:	48 c1 e8 06          	shr    $0x6,%rax
+  803c9c:	83 e0 01             	and    $0x1,%eax
+}
+  803c9f:	5d                   	pop    %rbp
+  803ca0:	c3                   	ret
+
+0000000000803ca1 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803ca1:	55                   	push   %rbp
+  803ca2:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803ca5:	48 b8 8e 3b 80 00 00 	movabs $0x803b8e,%rax
+  803cac:	00 00 00 
+  803caf:	ff d0                	call   *%rax
+  803cb1:	83 e0 01             	and    $0x1,%eax
+}
+  803cb4:	5d                   	pop    %rbp
+  803cb5:	c3                   	ret
+
+0000000000803cb6 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  803cb6:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  803cbd:	01 00 00 
+  803cc0:	a8 01                	test   $0x1,%al
+  803cc2:	75 06                	jne    803cca <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  803cc4:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cc9:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803cca:	55                   	push   %rbp
+  803ccb:	48 89 e5             	mov    %rsp,%rbp
+  803cce:	41 57                	push   %r15
+  803cd0:	41 56                	push   %r14
+  803cd2:	41 55                	push   %r13
+  803cd4:	41 54                	push   %r12
+  803cd6:	53                   	push   %rbx
+  803cd7:	48 83 ec 28          	sub    $0x28,%rsp
+  803cdb:	49 89 fe             	mov    %rdi,%r14
+  803cde:	49 89 f7             	mov    %rsi,%r15
+  803ce1:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  803ce8:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  803ce9:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  803cf0:	01 00 00 
+  803cf3:	e9 ae 00 00 00       	jmp    803da6 <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  803cf8:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803cff:	49 83 ec 01          	sub    $0x1,%r12
+  803d03:	74 2d                	je     803d32 <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  803d05:	48 89 d8             	mov    %rbx,%rax
+  803d08:	48 c1 e8 0c          	shr    $0xc,%rax
+  803d0c:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  803d11:	f6 c2 01             	test   $0x1,%dl
+  803d14:	74 e2                	je     803cf8 <foreach_shared_region+0x42>
+  803d16:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  803d1b:	f6 c4 04             	test   $0x4,%ah
+  803d1e:	74 d8                	je     803cf8 <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  803d20:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803d27:	4c 89 fa             	mov    %r15,%rdx
+  803d2a:	48 89 df             	mov    %rbx,%rdi
+  803d2d:	41 ff d6             	call   *%r14
+  803d30:	eb c6                	jmp    803cf8 <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  803d32:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  803d39:	00 
+  803d3a:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  803d3f:	74 4a                	je     803d8b <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  803d41:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803d45:	48 c1 e8 15          	shr    $0x15,%rax
+  803d49:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  803d50:	01 00 00 
+  803d53:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  803d57:	a8 01                	test   $0x1,%al
+  803d59:	74 d7                	je     803d32 <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  803d5b:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  803d5f:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  803d66:	48 39 c3             	cmp    %rax,%rbx
+  803d69:	73 c7                	jae    803d32 <foreach_shared_region+0x7c>
+  803d6b:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  803d72:	48 39 d0             	cmp    %rdx,%rax
+  803d75:	4d 19 e4             	sbb    %r12,%r12
+  803d78:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  803d7f:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  803d86:	e9 7a ff ff ff       	jmp    803d05 <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  803d8b:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  803d92:	40 
+  803d93:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803d97:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803d9e:	00 00 00 
+  803da1:	48 39 c1             	cmp    %rax,%rcx
+  803da4:	74 50                	je     803df6 <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  803da6:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803daa:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803dae:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  803db5:	01 00 00 
+  803db8:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  803dbc:	a8 01                	test   $0x1,%al
+  803dbe:	74 cb                	je     803d8b <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  803dc0:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803dc4:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  803dcb:	48 39 c1             	cmp    %rax,%rcx
+  803dce:	73 bb                	jae    803d8b <foreach_shared_region+0xd5>
+  803dd0:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  803dd7:	48 39 d0             	cmp    %rdx,%rax
+  803dda:	48 19 c0             	sbb    %rax,%rax
+  803ddd:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  803de3:	48 05 00 02 00 00    	add    $0x200,%rax
+  803de9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803ded:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803df1:	e9 4b ff ff ff       	jmp    803d41 <foreach_shared_region+0x8b>
+  803df6:	b8 00 00 00 00       	mov    $0x0,%eax
+  803dfb:	48 83 c4 28          	add    $0x28,%rsp
+  803dff:	5b                   	pop    %rbx
+  803e00:	41 5c                	pop    %r12
+  803e02:	41 5d                	pop    %r13
+  803e04:	41 5e                	pop    %r14
+  803e06:	41 5f                	pop    %r15
+  803e08:	5d                   	pop    %rbp
+  803e09:	c3                   	ret
+
+0000000000803e0a <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  803e0a:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  803e10:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  803e17:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  803e1e:	c3                   	ret
+
+0000000000803e1f <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  803e1f:	8b 47 40             	mov    0x40(%rdi),%eax
+  803e22:	8b 17                	mov    (%rdi),%edx
+  803e24:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  803e26:	83 f8 0f             	cmp    $0xf,%eax
+  803e29:	77 13                	ja     803e3e <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  803e2b:	8b 47 40             	mov    0x40(%rdi),%eax
+  803e2e:	83 e0 0f             	and    $0xf,%eax
+  803e31:	48 c1 e0 09          	shl    $0x9,%rax
+  803e35:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  803e3c:	00 
+  803e3d:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  803e3e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e43:	c3                   	ret
+
+0000000000803e44 <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  803e44:	8b 47 40             	mov    0x40(%rdi),%eax
+  803e47:	83 c0 01             	add    $0x1,%eax
+  803e4a:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803e4d:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  803e53:	8b 57 04             	mov    0x4(%rdi),%edx
+  803e56:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e5b:	85 d2                	test   %edx,%edx
+  803e5d:	75 04                	jne    803e63 <chan_publish+0x1f>
+  803e5f:	83 e0 01             	and    $0x1,%eax
+}
+  803e62:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  803e63:	87 47 04             	xchg   %eax,0x4(%rdi)
+  803e66:	85 c0                	test   %eax,%eax
+  803e68:	0f 95 c0             	setne  %al
+  803e6b:	0f b6 c0             	movzbl %al,%eax
+  803e6e:	eb ef                	jmp    803e5f <chan_publish+0x1b>
+
+0000000000803e70 <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  803e70:	8b 47 40             	mov    0x40(%rdi),%eax
+  803e73:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  803e75:	29 d0                	sub    %edx,%eax
+  803e77:	83 e8 01             	sub    $0x1,%eax
+  803e7a:	83 f8 0f             	cmp    $0xf,%eax
+  803e7d:	77 12                	ja     803e91 <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  803e7f:	8b 07                	mov    (%rdi),%eax
+  803e81:	83 e0 0f             	and    $0xf,%eax
+  803e84:	48 c1 e0 09          	shl    $0x9,%rax
+  803e88:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  803e8f:	00 
+  803e90:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  803e91:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e96:	c3                   	ret
+
+0000000000803e97 <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  803e97:	8b 07                	mov    (%rdi),%eax
+  803e99:	83 c0 01             	add    $0x1,%eax
+  803e9c:	89 07                	mov    %eax,(%rdi)
+}
+  803e9e:	c3                   	ret
+
+0000000000803e9f <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  803e9f:	55                   	push   %rbp
+  803ea0:	48 89 e5             	mov    %rsp,%rbp
+  803ea3:	53                   	push   %rbx
+  803ea4:	48 83 ec 08          	sub    $0x8,%rsp
+  803ea8:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  803eab:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803eb2:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  803eb8:	48 b8 70 3e 80 00 00 	movabs $0x803e70,%rax
+  803ebf:	00 00 00 
+  803ec2:	ff d0                	call   *%rax
+  803ec4:	48 85 c0             	test   %rax,%rax
+  803ec7:	74 12                	je     803edb <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  803ec9:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  803ed0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ed5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803ed9:	c9                   	leave
+  803eda:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  803edb:	b8 01 00 00 00       	mov    $0x1,%eax
+  803ee0:	eb f3                	jmp    803ed5 <chan_arm+0x36>
+
+0000000000803ee2 <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  803ee2:	55                   	push   %rbp
+  803ee3:	48 89 e5             	mov    %rsp,%rbp
+  803ee6:	41 56                	push   %r14
+  803ee8:	41 55                	push   %r13
+  803eea:	41 54                	push   %r12
+  803eec:	53                   	push   %rbx
+  803eed:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  803ef0:	49 bc 9f 3e 80 00 00 	movabs $0x803e9f,%r12
+  803ef7:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  803efa:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  803efe:	49 bd c0 13 80 00 00 	movabs $0x8013c0,%r13
+  803f05:	00 00 00 
+    while (chan_arm(r))
+  803f08:	eb 0d                	jmp    803f17 <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  803f0a:	8b 33                	mov    (%rbx),%esi
+  803f0c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803f11:	4c 89 f7             	mov    %r14,%rdi
+  803f14:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  803f17:	48 89 df             	mov    %rbx,%rdi
+  803f1a:	41 ff d4             	call   *%r12
+  803f1d:	84 c0                	test   %al,%al
+  803f1f:	75 e9                	jne    803f0a <chan_wait+0x28>
+}
+  803f21:	5b                   	pop    %rbx
+  803f22:	41 5c                	pop    %r12
+  803f24:	41 5d                	pop    %r13
+  803f26:	41 5e                	pop    %r14
+  803f28:	5d                   	pop    %rbp
+  803f29:	c3                   	ret
+
+0000000000803f2a <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  803f2a:	55                   	push   %rbp
+  803f2b:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  803f2e:	48 83 c7 40          	add    $0x40,%rdi
+  803f32:	be 01 00 00 00       	mov    $0x1,%esi
+  803f37:	48 b8 de 13 80 00 00 	movabs $0x8013de,%rax
+  803f3e:	00 00 00 
+  803f41:	ff d0                	call   *%rax
+}
+  803f43:	5d                   	pop    %rbp
+  803f44:	c3                   	ret
+
+0000000000803f45 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803f45:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f4a:	c3                   	ret
+
+0000000000803f4b <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803f4b:	55                   	push   %rbp
+  803f4c:	48 89 e5             	mov    %rsp,%rbp
+  803f4f:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803f52:	48 be 54 4d 80 00 00 	movabs $0x804d54,%rsi
+  803f59:	00 00 00 
+  803f5c:	48 b8 f3 0a 80 00 00 	movabs $0x800af3,%rax
+  803f63:	00 00 00 
+  803f66:	ff d0                	call   *%rax
+    return 0;
+}
+  803f68:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f6d:	5d                   	pop    %rbp
+  803f6e:	c3                   	ret
+
+0000000000803f6f <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803f6f:	55                   	push   %rbp
+  803f70:	48 89 e5             	mov    %rsp,%rbp
+  803f73:	41 57                	push   %r15
+  803f75:	41 56                	push   %r14
+  803f77:	41 55                	push   %r13
+  803f79:	41 54                	push   %r12
+  803f7b:	53                   	push   %rbx
+  803f7c:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803f83:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803f8a:	48 85 d2             	test   %rdx,%rdx
+  803f8d:	74 7a                	je     804009 <devcons_write+0x9a>
+  803f8f:	49 89 d6             	mov    %rdx,%r14
+  803f92:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803f98:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803f9d:	49 bf ed 0c 80 00 00 	movabs $0x800ced,%r15
+  803fa4:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803fa7:	4c 89 f3             	mov    %r14,%rbx
+  803faa:	48 29 f3             	sub    %rsi,%rbx
+  803fad:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803fb2:	48 39 c3             	cmp    %rax,%rbx
+  803fb5:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803fb9:	4c 63 eb             	movslq %ebx,%r13
+  803fbc:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803fc3:	48 01 c6             	add    %rax,%rsi
+  803fc6:	4c 89 ea             	mov    %r13,%rdx
+  803fc9:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803fd0:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803fd3:	4c 89 ee             	mov    %r13,%rsi
+  803fd6:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803fdd:	48 b8 1a 0f 80 00 00 	movabs $0x800f1a,%rax
+  803fe4:	00 00 00 
+  803fe7:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803fe9:	41 01 dc             	add    %ebx,%r12d
+  803fec:	49 63 f4             	movslq %r12d,%rsi
+  803fef:	4c 39 f6             	cmp    %r14,%rsi
+  803ff2:	72 b3                	jb     803fa7 <devcons_write+0x38>
+    return res;
+  803ff4:	49 63 c4             	movslq %r12d,%rax
+}
+  803ff7:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803ffe:	5b                   	pop    %rbx
+  803fff:	41 5c                	pop    %r12
+  804001:	41 5d                	pop    %r13
+  804003:	41 5e                	pop    %r14
+  804005:	41 5f                	pop    %r15
+  804007:	5d                   	pop    %rbp
+  804008:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804009:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80400f:	eb e3                	jmp    803ff4 <devcons_write+0x85>
+
+0000000000804011 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804011:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804014:	ba 00 00 00 00       	mov    $0x0,%edx
+  804019:	48 85 c0             	test   %rax,%rax
+  80401c:	74 55                	je     804073 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80401e:	55                   	push   %rbp
+  80401f:	48 89 e5             	mov    %rsp,%rbp
+  804022:	41 55                	push   %r13
+  804024:	41 54                	push   %r12
+  804026:	53                   	push   %rbx
+  804027:	48 83 ec 08          	sub    $0x8,%rsp
+  80402b:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  80402e:	48 bb 39 0f 80 00 00 	movabs $0x800f39,%rbx
+  804035:	00 00 00 
+  804038:	49 bc ee 0f 80 00 00 	movabs $0x800fee,%r12
+  80403f:	00 00 00 
+  804042:	eb 03                	jmp    804047 <devcons_read+0x36>
+  804044:	41 ff d4             	call   *%r12
+  804047:	ff d3                	call   *%rbx
+  804049:	85 c0                	test   %eax,%eax
+  80404b:	74 f7                	je     804044 <devcons_read+0x33>
+    if (c < 0) return c;
+  80404d:	48 63 d0             	movslq %eax,%rdx
+  804050:	78 13                	js     804065 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  804052:	ba 00 00 00 00       	mov    $0x0,%edx
+  804057:	83 f8 04             	cmp    $0x4,%eax
+  80405a:	74 09                	je     804065 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  80405c:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804060:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804065:	48 89 d0             	mov    %rdx,%rax
+  804068:	48 83 c4 08          	add    $0x8,%rsp
+  80406c:	5b                   	pop    %rbx
+  80406d:	41 5c                	pop    %r12
+  80406f:	41 5d                	pop    %r13
+  804071:	5d                   	pop    %rbp
+  804072:	c3                   	ret
+  804073:	48 89 d0             	mov    %rdx,%rax
+  804076:	c3                   	ret
+
+0000000000804077 <cputchar>:
+cputchar(int ch) {
+  804077:	55                   	push   %rbp
+  804078:	48 89 e5             	mov    %rsp,%rbp
+  80407b:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  80407f:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  804083:	be 01 00 00 00       	mov    $0x1,%esi
+  804088:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  80408c:	48 b8 1a 0f 80 00 00 	movabs $0x800f1a,%rax
+  804093:	00 00 00 
+  804096:	ff d0                	call   *%rax
+}
+  804098:	c9                   	leave
+  804099:	c3                   	ret
+
+000000000080409a <getchar>:
+getchar(void) {
+  80409a:	55                   	push   %rbp
+  80409b:	48 89 e5             	mov    %rsp,%rbp
+  80409e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8040a2:	ba 01 00 00 00       	mov    $0x1,%edx
+  8040a7:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8040ab:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040b0:	48 b8 f6 17 80 00 00 	movabs $0x8017f6,%rax
+  8040b7:	00 00 00 
+  8040ba:	ff d0                	call   *%rax
+  8040bc:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8040be:	85 c0                	test   %eax,%eax
+  8040c0:	78 06                	js     8040c8 <getchar+0x2e>
+  8040c2:	74 08                	je     8040cc <getchar+0x32>
+  8040c4:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8040c8:	89 d0                	mov    %edx,%eax
+  8040ca:	c9                   	leave
+  8040cb:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8040cc:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8040d1:	eb f5                	jmp    8040c8 <getchar+0x2e>
+
+00000000008040d3 <iscons>:
+iscons(int fdnum) {
+  8040d3:	55                   	push   %rbp
+  8040d4:	48 89 e5             	mov    %rsp,%rbp
+  8040d7:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8040db:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8040df:	48 b8 13 15 80 00 00 	movabs $0x801513,%rax
+  8040e6:	00 00 00 
+  8040e9:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8040eb:	85 c0                	test   %eax,%eax
+  8040ed:	78 18                	js     804107 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8040ef:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8040f3:	48 b8 a0 50 80 00 00 	movabs $0x8050a0,%rax
+  8040fa:	00 00 00 
+  8040fd:	8b 00                	mov    (%rax),%eax
+  8040ff:	39 02                	cmp    %eax,(%rdx)
+  804101:	0f 94 c0             	sete   %al
+  804104:	0f b6 c0             	movzbl %al,%eax
+}
+  804107:	c9                   	leave
+  804108:	c3                   	ret
+
+0000000000804109 <opencons>:
+opencons(void) {
+  804109:	55                   	push   %rbp
+  80410a:	48 89 e5             	mov    %rsp,%rbp
+  80410d:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  804111:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  804115:	48 b8 b3 14 80 00 00 	movabs $0x8014b3,%rax
+  80411c:	00 00 00 
+  80411f:	ff d0                	call   *%rax
+  804121:	85 c0                	test   %eax,%eax
+  804123:	78 49                	js     80416e <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  804125:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80412a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80412f:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  804133:	bf 00 00 00 00       	mov    $0x0,%edi
+  804138:	48 b8 52 10 80 00 00 	movabs $0x801052,%rax
+  80413f:	00 00 00 
+  804142:	ff d0                	call   *%rax
+  804144:	85 c0                	test   %eax,%eax
+  804146:	78 26                	js     80416e <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  804148:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80414c:	a1 a0 50 80 00 00 00 	movabs 0x8050a0,%eax
+  804153:	00 00 
+  804155:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  804157:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80415b:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  804162:	48 b8 85 14 80 00 00 	movabs $0x801485,%rax
+  804169:	00 00 00 
+  80416c:	ff d0                	call   *%rax
+}
+  80416e:	c9                   	leave
+  80416f:	c3                   	ret
+
+0000000000804170 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  804170:	55                   	push   %rbp
+  804171:	48 89 e5             	mov    %rsp,%rbp
+  804174:	41 56                	push   %r14
+  804176:	41 55                	push   %r13
+  804178:	41 54                	push   %r12
+  80417a:	53                   	push   %rbx
+  80417b:	48 83 ec 50          	sub    $0x50,%rsp
+  80417f:	49 89 fc             	mov    %rdi,%r12
+  804182:	41 89 f5             	mov    %esi,%r13d
+  804185:	48 89 d3             	mov    %rdx,%rbx
+  804188:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80418c:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  804190:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  804194:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80419b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80419f:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8041a3:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8041a7:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8041ab:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  8041b2:	00 00 00 
+  8041b5:	4c 8b 30             	mov    (%rax),%r14
+  8041b8:	48 b8 c5 0f 80 00 00 	movabs $0x800fc5,%rax
+  8041bf:	00 00 00 
+  8041c2:	ff d0                	call   *%rax
+  8041c4:	89 c6                	mov    %eax,%esi
+  8041c6:	45 89 e8             	mov    %r13d,%r8d
+  8041c9:	4c 89 e1             	mov    %r12,%rcx
+  8041cc:	4c 89 f2             	mov    %r14,%rdx
+  8041cf:	48 bf 60 4d 80 00 00 	movabs $0x804d60,%rdi
+  8041d6:	00 00 00 
+  8041d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041de:	49 bc ce 01 80 00 00 	movabs $0x8001ce,%r12
+  8041e5:	00 00 00 
+  8041e8:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8041eb:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8041ef:	48 89 df             	mov    %rbx,%rdi
+  8041f2:	48 b8 6a 01 80 00 00 	movabs $0x80016a,%rax
+  8041f9:	00 00 00 
+  8041fc:	ff d0                	call   *%rax
+    cprintf("\n");
+  8041fe:	48 bf aa 46 80 00 00 	movabs $0x8046aa,%rdi
+  804205:	00 00 00 
+  804208:	b8 00 00 00 00       	mov    $0x0,%eax
+  80420d:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  804210:	cc                   	int3
+  804211:	eb fd                	jmp    804210 <_panic+0xa0>
+
+0000000000804213 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  804213:	55                   	push   %rbp
+  804214:	48 89 e5             	mov    %rsp,%rbp
+  804217:	41 56                	push   %r14
+  804219:	41 55                	push   %r13
+  80421b:	41 54                	push   %r12
+  80421d:	53                   	push   %rbx
+  80421e:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804221:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  804228:	00 00 00 
+  80422b:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80422f:	74 27                	je     804258 <_handle_vectored_pagefault+0x45>
+  804231:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  804236:	49 bd 00 10 84 00 00 	movabs $0x841000,%r13
+  80423d:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804240:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  804243:	4c 89 e7             	mov    %r12,%rdi
+  804246:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  80424b:	84 c0                	test   %al,%al
+  80424d:	75 45                	jne    804294 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80424f:	48 83 c3 01          	add    $0x1,%rbx
+  804253:	49 3b 1e             	cmp    (%r14),%rbx
+  804256:	72 eb                	jb     804243 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  804258:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  80425f:	00 
+  804260:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  804265:	4d 8b 04 24          	mov    (%r12),%r8
+  804269:	48 ba 88 4d 80 00 00 	movabs $0x804d88,%rdx
+  804270:	00 00 00 
+  804273:	be 1d 00 00 00       	mov    $0x1d,%esi
+  804278:	48 bf b8 4d 80 00 00 	movabs $0x804db8,%rdi
+  80427f:	00 00 00 
+  804282:	b8 00 00 00 00       	mov    $0x0,%eax
+  804287:	49 ba 70 41 80 00 00 	movabs $0x804170,%r10
+  80428e:	00 00 00 
+  804291:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  804294:	5b                   	pop    %rbx
+  804295:	41 5c                	pop    %r12
+  804297:	41 5d                	pop    %r13
+  804299:	41 5e                	pop    %r14
+  80429b:	5d                   	pop    %rbp
+  80429c:	c3                   	ret
+
+000000000080429d <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  80429d:	55                   	push   %rbp
+  80429e:	48 89 e5             	mov    %rsp,%rbp
+  8042a1:	53                   	push   %rbx
+  8042a2:	48 83 ec 08          	sub    $0x8,%rsp
+  8042a6:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  8042a9:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8042b0:	00 00 00 
+  8042b3:	80 38 00             	cmpb   $0x0,(%rax)
+  8042b6:	0f 84 84 00 00 00    	je     804340 <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8042bc:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  8042c3:	00 00 00 
+  8042c6:	48 8b 10             	mov    (%rax),%rdx
+  8042c9:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  8042ce:	48 b9 00 10 84 00 00 	movabs $0x841000,%rcx
+  8042d5:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8042d8:	48 85 d2             	test   %rdx,%rdx
+  8042db:	74 19                	je     8042f6 <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  8042dd:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  8042e1:	0f 84 e8 00 00 00    	je     8043cf <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8042e7:	48 83 c0 01          	add    $0x1,%rax
+  8042eb:	48 39 d0             	cmp    %rdx,%rax
+  8042ee:	75 ed                	jne    8042dd <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  8042f0:	48 83 fa 08          	cmp    $0x8,%rdx
+  8042f4:	74 1c                	je     804312 <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8042f6:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8042fa:	48 a3 48 10 84 00 00 	movabs %rax,0x841048
+  804301:	00 00 00 
+  804304:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  80430b:	00 00 00 
+  80430e:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  804312:	48 b8 c5 0f 80 00 00 	movabs $0x800fc5,%rax
+  804319:	00 00 00 
+  80431c:	ff d0                	call   *%rax
+  80431e:	89 c7                	mov    %eax,%edi
+  804320:	48 be 95 44 80 00 00 	movabs $0x804495,%rsi
+  804327:	00 00 00 
+  80432a:	48 b8 10 12 80 00 00 	movabs $0x801210,%rax
+  804331:	00 00 00 
+  804334:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  804336:	85 c0                	test   %eax,%eax
+  804338:	78 68                	js     8043a2 <add_pgfault_handler+0x105>
+    return res;
+}
+  80433a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80433e:	c9                   	leave
+  80433f:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  804340:	48 b8 c5 0f 80 00 00 	movabs $0x800fc5,%rax
+  804347:	00 00 00 
+  80434a:	ff d0                	call   *%rax
+  80434c:	89 c7                	mov    %eax,%edi
+  80434e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804353:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804358:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  80435f:	00 00 00 
+  804362:	48 b8 52 10 80 00 00 	movabs $0x801052,%rax
+  804369:	00 00 00 
+  80436c:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  80436e:	48 ba 48 10 84 00 00 	movabs $0x841048,%rdx
+  804375:	00 00 00 
+  804378:	48 8b 02             	mov    (%rdx),%rax
+  80437b:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80437f:	48 89 0a             	mov    %rcx,(%rdx)
+  804382:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  804389:	00 00 00 
+  80438c:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  804390:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  804397:	00 00 00 
+  80439a:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  80439d:	e9 70 ff ff ff       	jmp    804312 <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8043a2:	89 c1                	mov    %eax,%ecx
+  8043a4:	48 ba c6 4d 80 00 00 	movabs $0x804dc6,%rdx
+  8043ab:	00 00 00 
+  8043ae:	be 3d 00 00 00       	mov    $0x3d,%esi
+  8043b3:	48 bf b8 4d 80 00 00 	movabs $0x804db8,%rdi
+  8043ba:	00 00 00 
+  8043bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043c2:	49 b8 70 41 80 00 00 	movabs $0x804170,%r8
+  8043c9:	00 00 00 
+  8043cc:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8043cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043d4:	e9 61 ff ff ff       	jmp    80433a <add_pgfault_handler+0x9d>
+
+00000000008043d9 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  8043d9:	55                   	push   %rbp
+  8043da:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  8043dd:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8043e4:	00 00 00 
+  8043e7:	80 38 00             	cmpb   $0x0,(%rax)
+  8043ea:	74 33                	je     80441f <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8043ec:	48 a1 48 10 84 00 00 	movabs 0x841048,%rax
+  8043f3:	00 00 00 
+  8043f6:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  8043fb:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  804402:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804405:	48 85 c0             	test   %rax,%rax
+  804408:	0f 84 85 00 00 00    	je     804493 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  80440e:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  804412:	74 40                	je     804454 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804414:	48 83 c1 01          	add    $0x1,%rcx
+  804418:	48 39 c1             	cmp    %rax,%rcx
+  80441b:	75 f1                	jne    80440e <remove_pgfault_handler+0x35>
+  80441d:	eb 74                	jmp    804493 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  80441f:	48 b9 de 4d 80 00 00 	movabs $0x804dde,%rcx
+  804426:	00 00 00 
+  804429:	48 ba 07 4d 80 00 00 	movabs $0x804d07,%rdx
+  804430:	00 00 00 
+  804433:	be 43 00 00 00       	mov    $0x43,%esi
+  804438:	48 bf b8 4d 80 00 00 	movabs $0x804db8,%rdi
+  80443f:	00 00 00 
+  804442:	b8 00 00 00 00       	mov    $0x0,%eax
+  804447:	49 b8 70 41 80 00 00 	movabs $0x804170,%r8
+  80444e:	00 00 00 
+  804451:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  804454:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  80445b:	00 
+  80445c:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804460:	48 29 ca             	sub    %rcx,%rdx
+  804463:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  80446a:	00 00 00 
+  80446d:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  804471:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  804476:	48 89 ce             	mov    %rcx,%rsi
+  804479:	48 b8 ed 0c 80 00 00 	movabs $0x800ced,%rax
+  804480:	00 00 00 
+  804483:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  804485:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  80448c:	00 00 00 
+  80448f:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  804493:	5d                   	pop    %rbp
+  804494:	c3                   	ret
+
+0000000000804495 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  804495:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  804498:	48 b8 13 42 80 00 00 	movabs $0x804213,%rax
+  80449f:	00 00 00 
+    call *%rax
+  8044a2:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  8044a4:	41 5f                	pop    %r15
+	popq %r15
+  8044a6:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  8044a8:	41 5f                	pop    %r15
+	popq %r14
+  8044aa:	41 5e                	pop    %r14
+	popq %r13
+  8044ac:	41 5d                	pop    %r13
+	popq %r12
+  8044ae:	41 5c                	pop    %r12
+	popq %r11
+  8044b0:	41 5b                	pop    %r11
+	popq %r10
+  8044b2:	41 5a                	pop    %r10
+	popq %r9
+  8044b4:	41 59                	pop    %r9
+	popq %r8
+  8044b6:	41 58                	pop    %r8
+	popq %rsi
+  8044b8:	5e                   	pop    %rsi
+	popq %rdi
+  8044b9:	5f                   	pop    %rdi
+	popq %rbp
+  8044ba:	5d                   	pop    %rbp
+	popq %rdx
+  8044bb:	5a                   	pop    %rdx
+	popq %rcx
+  8044bc:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  8044bd:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  8044c2:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  8044c7:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  8044cb:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  8044ce:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  8044d3:	5b                   	pop    %rbx
+	popq %rax
+  8044d4:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  8044d5:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  8044d9:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  8044da:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  8044df:	c3                   	ret
+
+00000000008044e0 <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8044e0:	55                   	push   %rbp
+  8044e1:	48 89 e5             	mov    %rsp,%rbp
+  8044e4:	41 55                	push   %r13
+  8044e6:	41 54                	push   %r12
+  8044e8:	53                   	push   %rbx
+  8044e9:	48 83 ec 08          	sub    $0x8,%rsp
+  8044ed:	49 89 fd             	mov    %rdi,%r13
+  8044f0:	48 89 f7             	mov    %rsi,%rdi
+  8044f3:	48 89 d3             	mov    %rdx,%rbx
+  8044f6:	49 89 cc             	mov    %rcx,%r12
+  8044f9:	4c 89 c2             	mov    %r8,%rdx
+  8044fc:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8044ff:	48 85 f6             	test   %rsi,%rsi
+  804502:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804509:	00 00 00 
+  80450c:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  804510:	be 00 10 00 00       	mov    $0x1000,%esi
+  804515:	48 85 db             	test   %rbx,%rbx
+  804518:	74 03                	je     80451d <ipc_recv_futex+0x3d>
+  80451a:	48 8b 33             	mov    (%rbx),%rsi
+  80451d:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  804521:	48 b8 9c 12 80 00 00 	movabs $0x80129c,%rax
+  804528:	00 00 00 
+  80452b:	ff d0                	call   *%rax
+    if (res < 0) {
+  80452d:	85 c0                	test   %eax,%eax
+  80452f:	78 75                	js     8045a6 <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  804531:	4d 85 ed             	test   %r13,%r13
+  804534:	74 14                	je     80454a <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  804536:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80453d:	00 00 00 
+  804540:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  804546:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  80454a:	4d 85 e4             	test   %r12,%r12
+  80454d:	74 14                	je     804563 <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  80454f:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804556:	00 00 00 
+  804559:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  80455f:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  804563:	48 85 db             	test   %rbx,%rbx
+  804566:	74 23                	je     80458b <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804568:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80456f:	00 00 00 
+  804572:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  804578:	ba 00 00 00 00       	mov    $0x0,%edx
+  80457d:	85 c9                	test   %ecx,%ecx
+  80457f:	74 07                	je     804588 <ipc_recv_futex+0xa8>
+  804581:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  804588:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  80458b:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804592:	00 00 00 
+  804595:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  80459b:	48 83 c4 08          	add    $0x8,%rsp
+  80459f:	5b                   	pop    %rbx
+  8045a0:	41 5c                	pop    %r12
+  8045a2:	41 5d                	pop    %r13
+  8045a4:	5d                   	pop    %rbp
+  8045a5:	c3                   	ret
+        if (from_env_store != NULL) {
+  8045a6:	4d 85 ed             	test   %r13,%r13
+  8045a9:	74 08                	je     8045b3 <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  8045ab:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8045b2:	00 
+        if (perm_store != NULL) {
+  8045b3:	4d 85 e4             	test   %r12,%r12
+  8045b6:	74 08                	je     8045c0 <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  8045b8:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8045bf:	00 
+        if (size != NULL) {
+  8045c0:	48 85 db             	test   %rbx,%rbx
+  8045c3:	74 d6                	je     80459b <ipc_recv_futex+0xbb>
+            *size = 0;
+  8045c5:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  8045cc:	eb cd                	jmp    80459b <ipc_recv_futex+0xbb>
+
+00000000008045ce <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8045ce:	55                   	push   %rbp
+  8045cf:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  8045d2:	48 83 ec 08          	sub    $0x8,%rsp
+  8045d6:	6a 00                	push   $0x0
+  8045d8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8045de:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8045e4:	48 b8 e0 44 80 00 00 	movabs $0x8044e0,%rax
+  8045eb:	00 00 00 
+  8045ee:	ff d0                	call   *%rax
+}
+  8045f0:	c9                   	leave
+  8045f1:	c3                   	ret
+
+00000000008045f2 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8045f2:	55                   	push   %rbp
+  8045f3:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8045f6:	48 85 d2             	test   %rdx,%rdx
+  8045f9:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804600:	00 00 00 
+  804603:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  804607:	89 f6                	mov    %esi,%esi
+  804609:	48 b8 85 12 80 00 00 	movabs $0x801285,%rax
+  804610:	00 00 00 
+  804613:	ff d0                	call   *%rax
+    if (res < 0) {
+  804615:	85 c0                	test   %eax,%eax
+  804617:	78 02                	js     80461b <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  804619:	5d                   	pop    %rbp
+  80461a:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  80461b:	89 c1                	mov    %eax,%ecx
+  80461d:	48 ba f8 4d 80 00 00 	movabs $0x804df8,%rdx
+  804624:	00 00 00 
+  804627:	be 50 00 00 00       	mov    $0x50,%esi
+  80462c:	48 bf 0c 4e 80 00 00 	movabs $0x804e0c,%rdi
+  804633:	00 00 00 
+  804636:	b8 00 00 00 00       	mov    $0x0,%eax
+  80463b:	49 b8 70 41 80 00 00 	movabs $0x804170,%r8
+  804642:	00 00 00 
+  804645:	41 ff d0             	call   *%r8
+
+0000000000804648 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804648:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  80464d:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804654:	00 00 00 
+  804657:	48 89 d0             	mov    %rdx,%rax
+  80465a:	48 c1 e0 04          	shl    $0x4,%rax
+  80465e:	48 29 d0             	sub    %rdx,%rax
+  804661:	48 c1 e0 05          	shl    $0x5,%rax
+  804665:	48 01 c8             	add    %rcx,%rax
+  804668:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  80466e:	39 f8                	cmp    %edi,%eax
+  804670:	74 13                	je     804685 <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  804672:	48 83 c2 01          	add    $0x1,%rdx
+  804676:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  80467d:	75 d8                	jne    804657 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80467f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804684:	c3                   	ret
+            return envs[i].env_id;
+  804685:	48 89 d0             	mov    %rdx,%rax
+  804688:	48 c1 e0 04          	shl    $0x4,%rax
+  80468c:	48 29 d0             	sub    %rdx,%rax
+  80468f:	48 c1 e0 05          	shl    $0x5,%rax
+  804693:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80469a:	00 00 00 
+  80469d:	48 01 d0             	add    %rdx,%rax
+  8046a0:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8046a6:	c3                   	ret
+  8046a7:	90                   	nop
+
+00000000008046a8 <__rodata_start>:
+  8046a8:	25 64 0a 00 3c       	and    $0x3c000a64,%eax
+  8046ad:	75 6e                	jne    80471d <__rodata_start+0x75>
+  8046af:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8046b3:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8046b4:	3e 00 30             	ds add %dh,(%rax)
+  8046b7:	31 32                	xor    %esi,(%rdx)
+  8046b9:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8046c0:	41                   	rex.B
+  8046c1:	42                   	rex.X
+  8046c2:	43                   	rex.XB
+  8046c3:	44                   	rex.R
+  8046c4:	45                   	rex.RB
+  8046c5:	46 00 30             	rex.RX add %r14b,(%rax)
+  8046c8:	31 32                	xor    %esi,(%rdx)
+  8046ca:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8046d1:	61                   	(bad)
+  8046d2:	62 63 64 65 66       	(bad)
+  8046d7:	00 28                	add    %ch,(%rax)
+  8046d9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8046da:	75 6c                	jne    804748 <__rodata_start+0xa0>
+  8046dc:	6c                   	insb   (%dx),%es:(%rdi)
+  8046dd:	29 00                	sub    %eax,(%rax)
+  8046df:	65 72 72             	gs jb  804754 <__rodata_start+0xac>
+  8046e2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8046e3:	72 20                	jb     804705 <__rodata_start+0x5d>
+  8046e5:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  8046ea:	73 70                	jae    80475c <__rodata_start+0xb4>
+  8046ec:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  8046f0:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  8046f7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8046f8:	72 00                	jb     8046fa <__rodata_start+0x52>
+  8046fa:	62 61 64 20 65       	(bad)
+  8046ff:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804700:	76 69                	jbe    80476b <__rodata_start+0xc3>
+  804702:	72 6f                	jb     804773 <__rodata_start+0xcb>
+  804704:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804705:	6d                   	insl   (%dx),%es:(%rdi)
+  804706:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804708:	74 00                	je     80470a <__rodata_start+0x62>
+  80470a:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  804711:	20 70 61             	and    %dh,0x61(%rax)
+  804714:	72 61                	jb     804777 <__rodata_start+0xcf>
+  804716:	6d                   	insl   (%dx),%es:(%rdi)
+  804717:	65 74 65             	gs je  80477f <__rodata_start+0xd7>
+  80471a:	72 00                	jb     80471c <__rodata_start+0x74>
+  80471c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80471d:	75 74                	jne    804793 <__rodata_start+0xeb>
+  80471f:	20 6f 66             	and    %ch,0x66(%rdi)
+  804722:	20 6d 65             	and    %ch,0x65(%rbp)
+  804725:	6d                   	insl   (%dx),%es:(%rdi)
+  804726:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804727:	72 79                	jb     8047a2 <__rodata_start+0xfa>
+  804729:	00 6f 75             	add    %ch,0x75(%rdi)
+  80472c:	74 20                	je     80474e <__rodata_start+0xa6>
+  80472e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80472f:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  804733:	76 69                	jbe    80479e <__rodata_start+0xf6>
+  804735:	72 6f                	jb     8047a6 <__rodata_start+0xfe>
+  804737:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804738:	6d                   	insl   (%dx),%es:(%rdi)
+  804739:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80473b:	74 73                	je     8047b0 <__rodata_start+0x108>
+  80473d:	00 63 6f             	add    %ah,0x6f(%rbx)
+  804740:	72 72                	jb     8047b4 <__rodata_start+0x10c>
+  804742:	75 70                	jne    8047b4 <__rodata_start+0x10c>
+  804744:	74 65                	je     8047ab <__rodata_start+0x103>
+  804746:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  80474b:	75 67                	jne    8047b4 <__rodata_start+0x10c>
+  80474d:	20 69 6e             	and    %ch,0x6e(%rcx)
+  804750:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804752:	00 73 65             	add    %dh,0x65(%rbx)
+  804755:	67 6d                	insl   (%dx),%es:(%edi)
+  804757:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804759:	74 61                	je     8047bc <__rodata_start+0x114>
+  80475b:	74 69                	je     8047c6 <__rodata_start+0x11e>
+  80475d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80475e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80475f:	20 66 61             	and    %ah,0x61(%rsi)
+  804762:	75 6c                	jne    8047d0 <__rodata_start+0x128>
+  804764:	74 00                	je     804766 <__rodata_start+0xbe>
+  804766:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80476d:	20 45 4c             	and    %al,0x4c(%rbp)
+  804770:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  804774:	61                   	(bad)
+  804775:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  80477a:	20 73 75             	and    %dh,0x75(%rbx)
+  80477d:	63 68 20             	movsxd 0x20(%rax),%ebp
+  804780:	73 79                	jae    8047fb <__rodata_start+0x153>
+  804782:	73 74                	jae    8047f8 <__rodata_start+0x150>
+  804784:	65 6d                	gs insl (%dx),%es:(%rdi)
+  804786:	20 63 61             	and    %ah,0x61(%rbx)
+  804789:	6c                   	insb   (%dx),%es:(%rdi)
+  80478a:	6c                   	insb   (%dx),%es:(%rdi)
+  80478b:	00 65 6e             	add    %ah,0x6e(%rbp)
+  80478e:	74 72                	je     804802 <__rodata_start+0x15a>
+  804790:	79 20                	jns    8047b2 <__rodata_start+0x10a>
+  804792:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804793:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804794:	74 20                	je     8047b6 <__rodata_start+0x10e>
+  804796:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804798:	75 6e                	jne    804808 <__rodata_start+0x160>
+  80479a:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  80479e:	76 20                	jbe    8047c0 <__rodata_start+0x118>
+  8047a0:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  8047a7:	72 65                	jb     80480e <__rodata_start+0x166>
+  8047a9:	63 76 69             	movsxd 0x69(%rsi),%esi
+  8047ac:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8047ad:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  8047b1:	65 78 70             	gs js  804824 <__rodata_start+0x17c>
+  8047b4:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  8047b9:	20 65 6e             	and    %ah,0x6e(%rbp)
+  8047bc:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  8047c0:	20 66 69             	and    %ah,0x69(%rsi)
+  8047c3:	6c                   	insb   (%dx),%es:(%rdi)
+  8047c4:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  8047c8:	20 66 72             	and    %ah,0x72(%rsi)
+  8047cb:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  8047d0:	61                   	(bad)
+  8047d1:	63 65 20             	movsxd 0x20(%rbp),%esp
+  8047d4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8047d5:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8047d6:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  8047da:	6b 00 74             	imul   $0x74,(%rax),%eax
+  8047dd:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8047de:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8047df:	20 6d 61             	and    %ch,0x61(%rbp)
+  8047e2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8047e3:	79 20                	jns    804805 <__rodata_start+0x15d>
+  8047e5:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  8047ec:	72 65                	jb     804853 <__rodata_start+0x1ab>
+  8047ee:	20 6f 70             	and    %ch,0x70(%rdi)
+  8047f1:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8047f3:	00 66 69             	add    %ah,0x69(%rsi)
+  8047f6:	6c                   	insb   (%dx),%es:(%rdi)
+  8047f7:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  8047fb:	20 62 6c             	and    %ah,0x6c(%rdx)
+  8047fe:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8047ff:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  804802:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804803:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804804:	74 20                	je     804826 <__rodata_start+0x17e>
+  804806:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804808:	75 6e                	jne    804878 <__rodata_start+0x1d0>
+  80480a:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  80480e:	76 61                	jbe    804871 <__rodata_start+0x1c9>
+  804810:	6c                   	insb   (%dx),%es:(%rdi)
+  804811:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  804818:	00 
+  804819:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  804820:	72 65                	jb     804887 <__rodata_start+0x1df>
+  804822:	61                   	(bad)
+  804823:	64 79 20             	fs jns 804846 <__rodata_start+0x19e>
+  804826:	65 78 69             	gs js  804892 <__rodata_start+0x1ea>
+  804829:	73 74                	jae    80489f <__rodata_start+0x1f7>
+  80482b:	73 00                	jae    80482d <__rodata_start+0x185>
+  80482d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80482e:	70 65                	jo     804895 <__rodata_start+0x1ed>
+  804830:	72 61                	jb     804893 <__rodata_start+0x1eb>
+  804832:	74 69                	je     80489d <__rodata_start+0x1f5>
+  804834:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804835:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804836:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  804839:	74 20                	je     80485b <__rodata_start+0x1b3>
+  80483b:	73 75                	jae    8048b2 <__rodata_start+0x20a>
+  80483d:	70 70                	jo     8048af <__rodata_start+0x207>
+  80483f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804840:	72 74                	jb     8048b6 <__rodata_start+0x20e>
+  804842:	65 64 00 74 72 79    	gs add %dh,%fs:0x79(%rdx,%rsi,2)
+  804848:	20 61 67             	and    %ah,0x67(%rcx)
+  80484b:	61                   	(bad)
+  80484c:	69 6e 00 74 69 6d 65 	imul   $0x656d6974,0x0(%rsi),%ebp
+  804853:	64 20 6f 75          	and    %ch,%fs:0x75(%rdi)
+  804857:	74 00                	je     804859 <__rodata_start+0x1b1>
+  804859:	66 69 6c 65 20 69 73 	imul   $0x7369,0x20(%rbp,%riz,2),%bp
+  804860:	20 69 6e             	and    %ch,0x6e(%rcx)
+  804863:	20 75 73             	and    %dh,0x73(%rbp)
+  804866:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  80486a:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  804871:	00 
+  804872:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804879:	00 00 00 
+  80487c:	0f 1f 40 00          	nopl   0x0(%rax)
+  804880:	bb 03 80 00 00       	mov    $0x8003,%ebx
+  804885:	00 00                	add    %al,(%rax)
+  804887:	00 fc                	add    %bh,%ah
+  804889:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80488f:	00 ec                	add    %ch,%ah
+  804891:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804897:	00 fc                	add    %bh,%ah
+  804899:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80489f:	00 fc                	add    %bh,%ah
+  8048a1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8048a7:	00 fc                	add    %bh,%ah
+  8048a9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8048af:	00 fc                	add    %bh,%ah
+  8048b1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8048b7:	00 da                	add    %bl,%dl
+  8048b9:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  8048bf:	00 fc                	add    %bh,%ah
+  8048c1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8048c7:	00 fc                	add    %bh,%ah
+  8048c9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8048cf:	00 ce                	add    %cl,%dh
+  8048d1:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  8048d7:	00 48 04             	add    %cl,0x4(%rax)
+  8048da:	80 00 00             	addb   $0x0,(%rax)
+  8048dd:	00 00                	add    %al,(%rax)
+  8048df:	00 fc                	add    %bh,%ah
+  8048e1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8048e7:	00 ce                	add    %cl,%dh
+  8048e9:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  8048ef:	00 14 04             	add    %dl,(%rsp,%rax,1)
+  8048f2:	80 00 00             	addb   $0x0,(%rax)
+  8048f5:	00 00                	add    %al,(%rax)
+  8048f7:	00 14 04             	add    %dl,(%rsp,%rax,1)
+  8048fa:	80 00 00             	addb   $0x0,(%rax)
+  8048fd:	00 00                	add    %al,(%rax)
+  8048ff:	00 14 04             	add    %dl,(%rsp,%rax,1)
+  804902:	80 00 00             	addb   $0x0,(%rax)
+  804905:	00 00                	add    %al,(%rax)
+  804907:	00 14 04             	add    %dl,(%rsp,%rax,1)
+  80490a:	80 00 00             	addb   $0x0,(%rax)
+  80490d:	00 00                	add    %al,(%rax)
+  80490f:	00 14 04             	add    %dl,(%rsp,%rax,1)
+  804912:	80 00 00             	addb   $0x0,(%rax)
+  804915:	00 00                	add    %al,(%rax)
+  804917:	00 14 04             	add    %dl,(%rsp,%rax,1)
+  80491a:	80 00 00             	addb   $0x0,(%rax)
+  80491d:	00 00                	add    %al,(%rax)
+  80491f:	00 14 04             	add    %dl,(%rsp,%rax,1)
+  804922:	80 00 00             	addb   $0x0,(%rax)
+  804925:	00 00                	add    %al,(%rax)
+  804927:	00 14 04             	add    %dl,(%rsp,%rax,1)
+  80492a:	80 00 00             	addb   $0x0,(%rax)
+  80492d:	00 00                	add    %al,(%rax)
+  80492f:	00 14 04             	add    %dl,(%rsp,%rax,1)
+  804932:	80 00 00             	addb   $0x0,(%rax)
+  804935:	00 00                	add    %al,(%rax)
+  804937:	00 fc                	add    %bh,%ah
+  804939:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80493f:	00 fc                	add    %bh,%ah
+  804941:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804947:	00 fc                	add    %bh,%ah
+  804949:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80494f:	00 fc                	add    %bh,%ah
+  804951:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804957:	00 fc                	add    %bh,%ah
+  804959:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80495f:	00 fc                	add    %bh,%ah
+  804961:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804967:	00 fc                	add    %bh,%ah
+  804969:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80496f:	00 fc                	add    %bh,%ah
+  804971:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804977:	00 fc                	add    %bh,%ah
+  804979:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80497f:	00 fc                	add    %bh,%ah
+  804981:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804987:	00 fc                	add    %bh,%ah
+  804989:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80498f:	00 fc                	add    %bh,%ah
+  804991:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804997:	00 fc                	add    %bh,%ah
+  804999:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80499f:	00 fc                	add    %bh,%ah
+  8049a1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8049a7:	00 fc                	add    %bh,%ah
+  8049a9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8049af:	00 fc                	add    %bh,%ah
+  8049b1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8049b7:	00 fc                	add    %bh,%ah
+  8049b9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8049bf:	00 fc                	add    %bh,%ah
+  8049c1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8049c7:	00 fc                	add    %bh,%ah
+  8049c9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8049cf:	00 fc                	add    %bh,%ah
+  8049d1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8049d7:	00 fc                	add    %bh,%ah
+  8049d9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8049df:	00 fc                	add    %bh,%ah
+  8049e1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8049e7:	00 fc                	add    %bh,%ah
+  8049e9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8049ef:	00 fc                	add    %bh,%ah
+  8049f1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8049f7:	00 fc                	add    %bh,%ah
+  8049f9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8049ff:	00 fc                	add    %bh,%ah
+  804a01:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804a07:	00 fc                	add    %bh,%ah
+  804a09:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804a0f:	00 fc                	add    %bh,%ah
+  804a11:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804a17:	00 fc                	add    %bh,%ah
+  804a19:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804a1f:	00 fc                	add    %bh,%ah
+  804a21:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804a27:	00 1f                	add    %bl,(%rdi)
+  804a29:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804a2f:	00 fc                	add    %bh,%ah
+  804a31:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804a37:	00 fc                	add    %bh,%ah
+  804a39:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804a3f:	00 fc                	add    %bh,%ah
+  804a41:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804a47:	00 fc                	add    %bh,%ah
+  804a49:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804a4f:	00 fc                	add    %bh,%ah
+  804a51:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804a57:	00 fc                	add    %bh,%ah
+  804a59:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804a5f:	00 fc                	add    %bh,%ah
+  804a61:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804a67:	00 fc                	add    %bh,%ah
+  804a69:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804a6f:	00 fc                	add    %bh,%ah
+  804a71:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804a77:	00 fc                	add    %bh,%ah
+  804a79:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804a7f:	00 6b 04             	add    %ch,0x4(%rbx)
+  804a82:	80 00 00             	addb   $0x0,(%rax)
+  804a85:	00 00                	add    %al,(%rax)
+  804a87:	00 3a                	add    %bh,(%rdx)
+  804a89:	06                   	(bad)
+  804a8a:	80 00 00             	addb   $0x0,(%rax)
+  804a8d:	00 00                	add    %al,(%rax)
+  804a8f:	00 fc                	add    %bh,%ah
+  804a91:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804a97:	00 fc                	add    %bh,%ah
+  804a99:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804a9f:	00 fc                	add    %bh,%ah
+  804aa1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804aa7:	00 fc                	add    %bh,%ah
+  804aa9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804aaf:	00 9a 04 80 00 00    	add    %bl,0x8004(%rdx)
+  804ab5:	00 00                	add    %al,(%rax)
+  804ab7:	00 fc                	add    %bh,%ah
+  804ab9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804abf:	00 fc                	add    %bh,%ah
+  804ac1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804ac7:	00 60 04             	add    %ah,0x4(%rax)
+  804aca:	80 00 00             	addb   $0x0,(%rax)
+  804acd:	00 00                	add    %al,(%rax)
+  804acf:	00 fc                	add    %bh,%ah
+  804ad1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804ad7:	00 fc                	add    %bh,%ah
+  804ad9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804adf:	00 e2                	add    %ah,%dl
+  804ae1:	07                   	(bad)
+  804ae2:	80 00 00             	addb   $0x0,(%rax)
+  804ae5:	00 00                	add    %al,(%rax)
+  804ae7:	00 ac 08 80 00 00 00 	add    %ch,0x80(%rax,%rcx,1)
+  804aee:	00 00                	add    %al,(%rax)
+  804af0:	fc                   	cld
+  804af1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804af7:	00 fc                	add    %bh,%ah
+  804af9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804aff:	00 31                	add    %dh,(%rcx)
+  804b01:	05 80 00 00 00       	add    $0x80,%eax
+  804b06:	00 00                	add    %al,(%rax)
+  804b08:	fc                   	cld
+  804b09:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804b0f:	00 0e                	add    %cl,(%rsi)
+  804b11:	07                   	(bad)
+  804b12:	80 00 00             	addb   $0x0,(%rax)
+  804b15:	00 00                	add    %al,(%rax)
+  804b17:	00 fc                	add    %bh,%ah
+  804b19:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804b1f:	00 fc                	add    %bh,%ah
+  804b21:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804b27:	00 1f                	add    %bl,(%rdi)
+  804b29:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804b2f:	00 fc                	add    %bh,%ah
+  804b31:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804b37:	00 c4                	add    %al,%ah
+  804b39:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+	...
+
+0000000000804b40 <error_string>:
+	...
+  804b48:	e8 46 80 00 00 00 00 00 fa 46 80 00 00 00 00 00     .F.......F......
+  804b58:	0a 47 80 00 00 00 00 00 1c 47 80 00 00 00 00 00     .G.......G......
+  804b68:	2a 47 80 00 00 00 00 00 3e 47 80 00 00 00 00 00     *G......>G......
+  804b78:	53 47 80 00 00 00 00 00 66 47 80 00 00 00 00 00     SG......fG......
+  804b88:	78 47 80 00 00 00 00 00 8c 47 80 00 00 00 00 00     xG.......G......
+  804b98:	9c 47 80 00 00 00 00 00 af 47 80 00 00 00 00 00     .G.......G......
+  804ba8:	c6 47 80 00 00 00 00 00 dc 47 80 00 00 00 00 00     .G.......G......
+  804bb8:	f4 47 80 00 00 00 00 00 0c 48 80 00 00 00 00 00     .G.......H......
+  804bc8:	19 48 80 00 00 00 00 00 f8 4b 80 00 00 00 00 00     .H.......K......
+  804bd8:	2d 48 80 00 00 00 00 00 45 48 80 00 00 00 00 00     -H......EH......
+  804be8:	4f 48 80 00 00 00 00 00 59 48 80 00 00 00 00 00     OH......YH......
+  804bf8:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  804c08:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  804c18:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  804c28:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  804c38:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  804c48:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  804c58:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  804c68:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  804c78:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  804c88:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  804c98:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  804ca8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  804cb8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  804cc8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804cd8:	0f 1f 84 00 00 00 00 00                             ........
+
+0000000000804ce0 <devtab>:
+  804ce0:	20 50 80 00 00 00 00 00 60 50 80 00 00 00 00 00      P......`P......
+  804cf0:	a0 50 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .P..............
+  804d00:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  804d10:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  804d20:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  804d30:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  804d40:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  804d50:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  804d60:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  804d70:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  804d80:	3a 20 00 0f 1f 44 00 00 55 73 65 72 73 70 61 63     : ...D..Userspac
+  804d90:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  804da0:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  804db0:	65 72 72 3d 25 78 0a 00 6c 69 62 2f 70 67 66 61     err=%x..lib/pgfa
+  804dc0:	75 6c 74 2e 63 00 73 65 74 5f 70 67 66 61 75 6c     ult.c.set_pgfaul
+  804dd0:	74 5f 68 61 6e 64 6c 65 72 3a 20 25 69 00 5f 70     t_handler: %i._p
+  804de0:	66 68 61 6e 64 6c 65 72 5f 69 6e 69 74 69 74 69     fhandler_inititi
+  804df0:	61 6c 6c 69 7a 65 64 00 69 70 63 5f 73 65 6e 64     allized.ipc_send
+  804e00:	20 65 72 72 6f 72 3a 20 25 69 0a 00 6c 69 62 2f      error: %i..lib/
+  804e10:	69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00 00     ipc.c.f.........
+  804e20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ea0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804eb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ec0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ed0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ee0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ef0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804fa0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804fb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804fc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804fd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804fe0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ff0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
@@ -0,0 +1,8797 @@
+
+obj/user/smpbench:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 8b 01 00 00       	call   8001ae <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+    }
+    return cpus;
+}
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 56                	push   %r14
+  80002b:	41 55                	push   %r13
+  80002d:	41 54                	push   %r12
+  80002f:	53                   	push   %rbx
+  800030:	48 83 ec 10          	sub    $0x10,%rsp
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  800034:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800036:	48 c1 e2 20          	shl    $0x20,%rdx
+  80003a:	89 c0                	mov    %eax,%eax
+  80003c:	48 09 c2             	or     %rax,%rdx
+  80003f:	49 89 d4             	mov    %rdx,%r12
+  800042:	bb 08 00 00 00       	mov    $0x8,%ebx
+    uint32_t cpus = 0;
+    int i;
+
+    uint64_t start = read_tsc();
+    for (i = 0; i < NWORKERS; i++) {
+        envid_t id = fork();
+  800047:	49 bd 8b 16 80 00 00 	movabs $0x80168b,%r13
+  80004e:	00 00 00 
+  800051:	41 ff d5             	call   *%r13
+  800054:	89 c6                	mov    %eax,%esi
+        if (id < 0) panic("fork: %i", id);
+  800056:	85 c0                	test   %eax,%eax
+  800058:	0f 88 a9 00 00 00    	js     800107 <umain+0xe2>
+        if (!id) {
+  80005e:	0f 84 d0 00 00 00    	je     800134 <umain+0x10f>
+    for (i = 0; i < NWORKERS; i++) {
+  800064:	83 eb 01             	sub    $0x1,%ebx
+  800067:	75 e8                	jne    800051 <umain+0x2c>
+  800069:	41 bd 08 00 00 00    	mov    $0x8,%r13d
+            return;
+        }
+    }
+
+    for (i = 0; i < NWORKERS; i++)
+        cpus |= ipc_recv(NULL, NULL, NULL, NULL);
+  80006f:	49 be 99 18 80 00 00 	movabs $0x801899,%r14
+  800076:	00 00 00 
+  800079:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80007e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800083:	be 00 00 00 00       	mov    $0x0,%esi
+  800088:	bf 00 00 00 00       	mov    $0x0,%edi
+  80008d:	41 ff d6             	call   *%r14
+  800090:	09 c3                	or     %eax,%ebx
+    for (i = 0; i < NWORKERS; i++)
+  800092:	41 83 ed 01          	sub    $0x1,%r13d
+  800096:	75 e1                	jne    800079 <umain+0x54>
+    asm volatile("rdtsc"
+  800098:	0f 31                	rdtsc
+  80009a:	41 89 d5             	mov    %edx,%r13d
+  80009d:	41 89 c6             	mov    %eax,%r14d
+    uint64_t cycles = read_tsc() - start;
+
+    cprintf("smpbench: %d workers used %d CPUs in %lu Mcycles\n",
+  8000a0:	89 df                	mov    %ebx,%edi
+  8000a2:	48 b8 30 49 80 00 00 	movabs $0x804930,%rax
+  8000a9:	00 00 00 
+  8000ac:	ff d0                	call   *%rax
+  8000ae:	89 c6                	mov    %eax,%esi
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8000b0:	4c 89 ea             	mov    %r13,%rdx
+  8000b3:	48 c1 e2 20          	shl    $0x20,%rdx
+  8000b7:	45 89 f6             	mov    %r14d,%r14d
+  8000ba:	4c 09 f2             	or     %r14,%rdx
+    uint64_t cycles = read_tsc() - start;
+  8000bd:	4c 29 e2             	sub    %r12,%rdx
+            NWORKERS, __builtin_popcount(cpus), (unsigned long)(cycles / 1000000));
+  8000c0:	48 b9 db 34 b6 d7 82 	movabs $0x431bde82d7b634db,%rcx
+  8000c7:	de 1b 43 
+  8000ca:	48 89 d0             	mov    %rdx,%rax
+  8000cd:	48 f7 e1             	mul    %rcx
+  8000d0:	48 89 d1             	mov    %rdx,%rcx
+  8000d3:	48 c1 e9 12          	shr    $0x12,%rcx
+    cprintf("smpbench: %d workers used %d CPUs in %lu Mcycles\n",
+  8000d7:	89 f2                	mov    %esi,%edx
+  8000d9:	be 08 00 00 00       	mov    $0x8,%esi
+  8000de:	48 bf b0 49 80 00 00 	movabs $0x8049b0,%rdi
+  8000e5:	00 00 00 
+  8000e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ed:	49 b8 d4 03 80 00 00 	movabs $0x8003d4,%r8
+  8000f4:	00 00 00 
+  8000f7:	41 ff d0             	call   *%r8
+}
+  8000fa:	48 83 c4 10          	add    $0x10,%rsp
+  8000fe:	5b                   	pop    %rbx
+  8000ff:	41 5c                	pop    %r12
+  800101:	41 5d                	pop    %r13
+  800103:	41 5e                	pop    %r14
+  800105:	5d                   	pop    %rbp
+  800106:	c3                   	ret
+        if (id < 0) panic("fork: %i", id);
+  800107:	89 c1                	mov    %eax,%ecx
+  800109:	48 ba 90 49 80 00 00 	movabs $0x804990,%rdx
+  800110:	00 00 00 
+  800113:	be 1f 00 00 00       	mov    $0x1f,%esi
+  800118:	48 bf 99 49 80 00 00 	movabs $0x804999,%rdi
+  80011f:	00 00 00 
+  800122:	b8 00 00 00 00       	mov    $0x0,%eax
+  800127:	49 b8 84 02 80 00 00 	movabs $0x800284,%r8
+  80012e:	00 00 00 
+  800131:	41 ff d0             	call   *%r8
+    volatile uint32_t x = 1;
+  800134:	c7 45 dc 01 00 00 00 	movl   $0x1,-0x24(%rbp)
+        if (!(i & 0xFFFF)) cpus |= 1U << thisenv->env_cpunum;
+  80013b:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800142:	00 00 00 
+    uint32_t cpus = 0;
+  800145:	bf 00 00 00 00       	mov    $0x0,%edi
+        if (!(i & 0xFFFF)) cpus |= 1U << thisenv->env_cpunum;
+  80014a:	41 b8 01 00 00 00    	mov    $0x1,%r8d
+  800150:	eb 0b                	jmp    80015d <umain+0x138>
+    for (int i = 0; i < NITERS; i++) {
+  800152:	83 c6 01             	add    $0x1,%esi
+  800155:	81 fe 00 00 00 01    	cmp    $0x1000000,%esi
+  80015b:	74 26                	je     800183 <umain+0x15e>
+        x = x * 1103515245 + 12345;
+  80015d:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  800160:	69 d2 6d 4e c6 41    	imul   $0x41c64e6d,%edx,%edx
+  800166:	81 c2 39 30 00 00    	add    $0x3039,%edx
+  80016c:	89 55 dc             	mov    %edx,-0x24(%rbp)
+        if (!(i & 0xFFFF)) cpus |= 1U << thisenv->env_cpunum;
+  80016f:	66 85 f6             	test   %si,%si
+  800172:	75 de                	jne    800152 <umain+0x12d>
+  800174:	8b 88 dc 00 00 00    	mov    0xdc(%rax),%ecx
+  80017a:	44 89 c2             	mov    %r8d,%edx
+  80017d:	d3 e2                	shl    %cl,%edx
+  80017f:	09 d7                	or     %edx,%edi
+  800181:	eb cf                	jmp    800152 <umain+0x12d>
+            ipc_send(thisenv->env_parent_id, work(), NULL, 0, 0);
+  800183:	8b 80 cc 00 00 00    	mov    0xcc(%rax),%eax
+  800189:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80018f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800194:	ba 00 00 00 00       	mov    $0x0,%edx
+  800199:	89 fe                	mov    %edi,%esi
+  80019b:	89 c7                	mov    %eax,%edi
+  80019d:	48 b8 bd 18 80 00 00 	movabs $0x8018bd,%rax
+  8001a4:	00 00 00 
+  8001a7:	ff d0                	call   *%rax
+            return;
+  8001a9:	e9 4c ff ff ff       	jmp    8000fa <umain+0xd5>
+
+00000000008001ae <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8001ae:	55                   	push   %rbp
+  8001af:	48 89 e5             	mov    %rsp,%rbp
+  8001b2:	41 56                	push   %r14
+  8001b4:	41 55                	push   %r13
+  8001b6:	41 54                	push   %r12
+  8001b8:	53                   	push   %rbx
+  8001b9:	41 89 fd             	mov    %edi,%r13d
+  8001bc:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8001bf:	48 ba e0 60 80 00 00 	movabs $0x8060e0,%rdx
+  8001c6:	00 00 00 
+  8001c9:	48 b8 e0 60 80 00 00 	movabs $0x8060e0,%rax
+  8001d0:	00 00 00 
+  8001d3:	48 39 c2             	cmp    %rax,%rdx
+  8001d6:	73 17                	jae    8001ef <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8001d8:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8001db:	49 89 c4             	mov    %rax,%r12
+  8001de:	48 83 c3 08          	add    $0x8,%rbx
+  8001e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001e7:	ff 53 f8             	call   *-0x8(%rbx)
+  8001ea:	4c 39 e3             	cmp    %r12,%rbx
+  8001ed:	72 ef                	jb     8001de <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8001ef:	48 b8 cb 11 80 00 00 	movabs $0x8011cb,%rax
+  8001f6:	00 00 00 
+  8001f9:	ff d0                	call   *%rax
+  8001fb:	89 c2                	mov    %eax,%edx
+  8001fd:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  800203:	48 89 d0             	mov    %rdx,%rax
+  800206:	48 c1 e0 04          	shl    $0x4,%rax
+  80020a:	48 29 d0             	sub    %rdx,%rax
+  80020d:	48 c1 e0 05          	shl    $0x5,%rax
+  800211:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800218:	00 00 00 
+  80021b:	48 01 d0             	add    %rdx,%rax
+  80021e:	48 a3 00 00 81 00 00 	movabs %rax,0x810000
+  800225:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800228:	45 85 ed             	test   %r13d,%r13d
+  80022b:	7e 0d                	jle    80023a <libmain+0x8c>
+  80022d:	49 8b 06             	mov    (%r14),%rax
+  800230:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  800237:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80023a:	4c 89 f6             	mov    %r14,%rsi
+  80023d:	44 89 ef             	mov    %r13d,%edi
+  800240:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800247:	00 00 00 
+  80024a:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80024c:	48 b8 61 02 80 00 00 	movabs $0x800261,%rax
+  800253:	00 00 00 
+  800256:	ff d0                	call   *%rax
+#endif
+}
+  800258:	5b                   	pop    %rbx
+  800259:	41 5c                	pop    %r12
+  80025b:	41 5d                	pop    %r13
+  80025d:	41 5e                	pop    %r14
+  80025f:	5d                   	pop    %rbp
+  800260:	c3                   	ret
+
+0000000000800261 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800261:	55                   	push   %rbp
+  800262:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800265:	48 b8 98 1b 80 00 00 	movabs $0x801b98,%rax
+  80026c:	00 00 00 
+  80026f:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800271:	bf 00 00 00 00       	mov    $0x0,%edi
+  800276:	48 b8 68 11 80 00 00 	movabs $0x801168,%rax
+  80027d:	00 00 00 
+  800280:	ff d0                	call   *%rax
+}
+  800282:	5d                   	pop    %rbp
+  800283:	c3                   	ret
+
+0000000000800284 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800284:	55                   	push   %rbp
+  800285:	48 89 e5             	mov    %rsp,%rbp
+  800288:	41 56                	push   %r14
+  80028a:	41 55                	push   %r13
+  80028c:	41 54                	push   %r12
+  80028e:	53                   	push   %rbx
+  80028f:	48 83 ec 50          	sub    $0x50,%rsp
+  800293:	49 89 fc             	mov    %rdi,%r12
+  800296:	41 89 f5             	mov    %esi,%r13d
+  800299:	48 89 d3             	mov    %rdx,%rbx
+  80029c:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8002a0:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8002a4:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8002a8:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8002af:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002b3:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8002b7:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8002bb:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8002bf:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8002c6:	00 00 00 
+  8002c9:	4c 8b 30             	mov    (%rax),%r14
+  8002cc:	48 b8 cb 11 80 00 00 	movabs $0x8011cb,%rax
+  8002d3:	00 00 00 
+  8002d6:	ff d0                	call   *%rax
+  8002d8:	89 c6                	mov    %eax,%esi
+  8002da:	45 89 e8             	mov    %r13d,%r8d
+  8002dd:	4c 89 e1             	mov    %r12,%rcx
+  8002e0:	4c 89 f2             	mov    %r14,%rdx
+  8002e3:	48 bf f0 49 80 00 00 	movabs $0x8049f0,%rdi
+  8002ea:	00 00 00 
+  8002ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002f2:	49 bc d4 03 80 00 00 	movabs $0x8003d4,%r12
+  8002f9:	00 00 00 
+  8002fc:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8002ff:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800303:	48 89 df             	mov    %rbx,%rdi
+  800306:	48 b8 70 03 80 00 00 	movabs $0x800370,%rax
+  80030d:	00 00 00 
+  800310:	ff d0                	call   *%rax
+    cprintf("\n");
+  800312:	48 bf 4b 50 80 00 00 	movabs $0x80504b,%rdi
+  800319:	00 00 00 
+  80031c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800321:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800324:	cc                   	int3
+  800325:	eb fd                	jmp    800324 <_panic+0xa0>
+
+0000000000800327 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800327:	55                   	push   %rbp
+  800328:	48 89 e5             	mov    %rsp,%rbp
+  80032b:	53                   	push   %rbx
+  80032c:	48 83 ec 08          	sub    $0x8,%rsp
+  800330:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800333:	8b 06                	mov    (%rsi),%eax
+  800335:	8d 50 01             	lea    0x1(%rax),%edx
+  800338:	89 16                	mov    %edx,(%rsi)
+  80033a:	48 98                	cltq
+  80033c:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800341:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800347:	74 0a                	je     800353 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800349:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80034d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800351:	c9                   	leave
+  800352:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800353:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800357:	be ff 00 00 00       	mov    $0xff,%esi
+  80035c:	48 b8 20 11 80 00 00 	movabs $0x801120,%rax
+  800363:	00 00 00 
+  800366:	ff d0                	call   *%rax
+        state->offset = 0;
+  800368:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80036e:	eb d9                	jmp    800349 <putch+0x22>
+
+0000000000800370 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800370:	55                   	push   %rbp
+  800371:	48 89 e5             	mov    %rsp,%rbp
+  800374:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80037b:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80037e:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800385:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80038a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80038f:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800392:	48 89 f1             	mov    %rsi,%rcx
+  800395:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80039c:	48 bf 27 03 80 00 00 	movabs $0x800327,%rdi
+  8003a3:	00 00 00 
+  8003a6:	48 b8 24 05 80 00 00 	movabs $0x800524,%rax
+  8003ad:	00 00 00 
+  8003b0:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8003b2:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8003b9:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8003c0:	48 b8 20 11 80 00 00 	movabs $0x801120,%rax
+  8003c7:	00 00 00 
+  8003ca:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8003cc:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8003d2:	c9                   	leave
+  8003d3:	c3                   	ret
+
+00000000008003d4 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8003d4:	55                   	push   %rbp
+  8003d5:	48 89 e5             	mov    %rsp,%rbp
+  8003d8:	48 83 ec 50          	sub    $0x50,%rsp
+  8003dc:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8003e0:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8003e4:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8003e8:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8003ec:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8003f0:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8003f7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003fb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003ff:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800403:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800407:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80040b:	48 b8 70 03 80 00 00 	movabs $0x800370,%rax
+  800412:	00 00 00 
+  800415:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800417:	c9                   	leave
+  800418:	c3                   	ret
+
+0000000000800419 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800419:	55                   	push   %rbp
+  80041a:	48 89 e5             	mov    %rsp,%rbp
+  80041d:	41 57                	push   %r15
+  80041f:	41 56                	push   %r14
+  800421:	41 55                	push   %r13
+  800423:	41 54                	push   %r12
+  800425:	53                   	push   %rbx
+  800426:	48 83 ec 18          	sub    $0x18,%rsp
+  80042a:	49 89 fc             	mov    %rdi,%r12
+  80042d:	49 89 f5             	mov    %rsi,%r13
+  800430:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800434:	8b 45 10             	mov    0x10(%rbp),%eax
+  800437:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80043a:	41 89 cf             	mov    %ecx,%r15d
+  80043d:	4c 39 fa             	cmp    %r15,%rdx
+  800440:	73 5b                	jae    80049d <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800442:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800446:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80044a:	85 db                	test   %ebx,%ebx
+  80044c:	7e 0e                	jle    80045c <print_num+0x43>
+            putch(padc, put_arg);
+  80044e:	4c 89 ee             	mov    %r13,%rsi
+  800451:	44 89 f7             	mov    %r14d,%edi
+  800454:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800457:	83 eb 01             	sub    $0x1,%ebx
+  80045a:	75 f2                	jne    80044e <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80045c:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800460:	48 b9 24 4a 80 00 00 	movabs $0x804a24,%rcx
+  800467:	00 00 00 
+  80046a:	48 b8 13 4a 80 00 00 	movabs $0x804a13,%rax
+  800471:	00 00 00 
+  800474:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800478:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80047c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800481:	49 f7 f7             	div    %r15
+  800484:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800488:	4c 89 ee             	mov    %r13,%rsi
+  80048b:	41 ff d4             	call   *%r12
+}
+  80048e:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800492:	5b                   	pop    %rbx
+  800493:	41 5c                	pop    %r12
+  800495:	41 5d                	pop    %r13
+  800497:	41 5e                	pop    %r14
+  800499:	41 5f                	pop    %r15
+  80049b:	5d                   	pop    %rbp
+  80049c:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80049d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8004a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004a6:	49 f7 f7             	div    %r15
+  8004a9:	48 83 ec 08          	sub    $0x8,%rsp
+  8004ad:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8004b1:	52                   	push   %rdx
+  8004b2:	45 0f be c9          	movsbl %r9b,%r9d
+  8004b6:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8004ba:	48 89 c2             	mov    %rax,%rdx
+  8004bd:	48 b8 19 04 80 00 00 	movabs $0x800419,%rax
+  8004c4:	00 00 00 
+  8004c7:	ff d0                	call   *%rax
+  8004c9:	48 83 c4 10          	add    $0x10,%rsp
+  8004cd:	eb 8d                	jmp    80045c <print_num+0x43>
+
+00000000008004cf <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8004cf:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8004d3:	48 8b 06             	mov    (%rsi),%rax
+  8004d6:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8004da:	73 0a                	jae    8004e6 <sprintputch+0x17>
+        *state->start++ = ch;
+  8004dc:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8004e0:	48 89 16             	mov    %rdx,(%rsi)
+  8004e3:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8004e6:	c3                   	ret
+
+00000000008004e7 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8004e7:	55                   	push   %rbp
+  8004e8:	48 89 e5             	mov    %rsp,%rbp
+  8004eb:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ef:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f3:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004f7:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8004fb:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800502:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800506:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80050a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80050e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800512:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800516:	48 b8 24 05 80 00 00 	movabs $0x800524,%rax
+  80051d:	00 00 00 
+  800520:	ff d0                	call   *%rax
+}
+  800522:	c9                   	leave
+  800523:	c3                   	ret
+
+0000000000800524 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800524:	55                   	push   %rbp
+  800525:	48 89 e5             	mov    %rsp,%rbp
+  800528:	41 57                	push   %r15
+  80052a:	41 56                	push   %r14
+  80052c:	41 55                	push   %r13
+  80052e:	41 54                	push   %r12
+  800530:	53                   	push   %rbx
+  800531:	48 83 ec 38          	sub    $0x38,%rsp
+  800535:	49 89 fe             	mov    %rdi,%r14
+  800538:	49 89 f5             	mov    %rsi,%r13
+  80053b:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80053e:	48 8b 01             	mov    (%rcx),%rax
+  800541:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800545:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800549:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80054d:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800551:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800555:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800559:	0f b6 3b             	movzbl (%rbx),%edi
+  80055c:	40 80 ff 25          	cmp    $0x25,%dil
+  800560:	74 18                	je     80057a <vprintfmt+0x56>
+            if (!ch) return;
+  800562:	40 84 ff             	test   %dil,%dil
+  800565:	0f 84 b1 06 00 00    	je     800c1c <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80056b:	40 0f b6 ff          	movzbl %dil,%edi
+  80056f:	4c 89 ee             	mov    %r13,%rsi
+  800572:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800575:	4c 89 e3             	mov    %r12,%rbx
+  800578:	eb db                	jmp    800555 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80057a:	be 00 00 00 00       	mov    $0x0,%esi
+  80057f:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800583:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800588:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80058e:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800595:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800599:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80059e:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8005a3:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8005a6:	83 e8 23             	sub    $0x23,%eax
+  8005a9:	3c 57                	cmp    $0x57,%al
+  8005ab:	0f 87 51 06 00 00    	ja     800c02 <vprintfmt+0x6de>
+  8005b1:	0f b6 c0             	movzbl %al,%eax
+  8005b4:	48 b9 e0 4b 80 00 00 	movabs $0x804be0,%rcx
+  8005bb:	00 00 00 
+  8005be:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8005c1:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8005c4:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8005c8:	eb cf                	jmp    800599 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8005ca:	49 89 dc             	mov    %rbx,%r12
+  8005cd:	be 01 00 00 00       	mov    $0x1,%esi
+  8005d2:	eb c5                	jmp    800599 <vprintfmt+0x75>
+            padc = ch;
+  8005d4:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8005d8:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8005db:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005de:	eb b9                	jmp    800599 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8005e0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005e3:	83 f8 2f             	cmp    $0x2f,%eax
+  8005e6:	77 24                	ja     80060c <vprintfmt+0xe8>
+  8005e8:	89 c1                	mov    %eax,%ecx
+  8005ea:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8005ee:	83 c0 08             	add    $0x8,%eax
+  8005f1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005f4:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8005f7:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8005fa:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8005fe:	79 99                	jns    800599 <vprintfmt+0x75>
+                width = precision;
+  800600:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800604:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80060a:	eb 8d                	jmp    800599 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80060c:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800610:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800614:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800618:	eb da                	jmp    8005f4 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80061a:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  80061f:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800623:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800629:	3c 39                	cmp    $0x39,%al
+  80062b:	77 1c                	ja     800649 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  80062d:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800631:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800635:	0f b6 c0             	movzbl %al,%eax
+  800638:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80063d:	0f b6 03             	movzbl (%rbx),%eax
+  800640:	3c 39                	cmp    $0x39,%al
+  800642:	76 e9                	jbe    80062d <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800644:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800647:	eb b1                	jmp    8005fa <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800649:	49 89 dc             	mov    %rbx,%r12
+  80064c:	eb ac                	jmp    8005fa <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80064e:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800651:	85 c9                	test   %ecx,%ecx
+  800653:	b8 00 00 00 00       	mov    $0x0,%eax
+  800658:	0f 49 c1             	cmovns %ecx,%eax
+  80065b:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80065e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800661:	e9 33 ff ff ff       	jmp    800599 <vprintfmt+0x75>
+            lflag++;
+  800666:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800669:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80066c:	e9 28 ff ff ff       	jmp    800599 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800671:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800674:	83 f8 2f             	cmp    $0x2f,%eax
+  800677:	77 19                	ja     800692 <vprintfmt+0x16e>
+  800679:	89 c2                	mov    %eax,%edx
+  80067b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80067f:	83 c0 08             	add    $0x8,%eax
+  800682:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800685:	8b 3a                	mov    (%rdx),%edi
+  800687:	4c 89 ee             	mov    %r13,%rsi
+  80068a:	41 ff d6             	call   *%r14
+            break;
+  80068d:	e9 c3 fe ff ff       	jmp    800555 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800692:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800696:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80069a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80069e:	eb e5                	jmp    800685 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8006a0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006a3:	83 f8 2f             	cmp    $0x2f,%eax
+  8006a6:	77 5a                	ja     800702 <vprintfmt+0x1de>
+  8006a8:	89 c2                	mov    %eax,%edx
+  8006aa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006ae:	83 c0 08             	add    $0x8,%eax
+  8006b1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8006b4:	8b 02                	mov    (%rdx),%eax
+  8006b6:	89 c1                	mov    %eax,%ecx
+  8006b8:	f7 d9                	neg    %ecx
+  8006ba:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8006bd:	83 f9 16             	cmp    $0x16,%ecx
+  8006c0:	7f 4e                	jg     800710 <vprintfmt+0x1ec>
+  8006c2:	48 63 c1             	movslq %ecx,%rax
+  8006c5:	48 ba a0 4e 80 00 00 	movabs $0x804ea0,%rdx
+  8006cc:	00 00 00 
+  8006cf:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8006d3:	48 85 c0             	test   %rax,%rax
+  8006d6:	74 38                	je     800710 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8006d8:	48 89 c1             	mov    %rax,%rcx
+  8006db:	48 ba b9 50 80 00 00 	movabs $0x8050b9,%rdx
+  8006e2:	00 00 00 
+  8006e5:	4c 89 ee             	mov    %r13,%rsi
+  8006e8:	4c 89 f7             	mov    %r14,%rdi
+  8006eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006f0:	49 b8 e7 04 80 00 00 	movabs $0x8004e7,%r8
+  8006f7:	00 00 00 
+  8006fa:	41 ff d0             	call   *%r8
+  8006fd:	e9 53 fe ff ff       	jmp    800555 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800702:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800706:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80070a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80070e:	eb a4                	jmp    8006b4 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800710:	48 ba 3c 4a 80 00 00 	movabs $0x804a3c,%rdx
+  800717:	00 00 00 
+  80071a:	4c 89 ee             	mov    %r13,%rsi
+  80071d:	4c 89 f7             	mov    %r14,%rdi
+  800720:	b8 00 00 00 00       	mov    $0x0,%eax
+  800725:	49 b8 e7 04 80 00 00 	movabs $0x8004e7,%r8
+  80072c:	00 00 00 
+  80072f:	41 ff d0             	call   *%r8
+  800732:	e9 1e fe ff ff       	jmp    800555 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800737:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80073a:	83 f8 2f             	cmp    $0x2f,%eax
+  80073d:	77 6c                	ja     8007ab <vprintfmt+0x287>
+  80073f:	89 c2                	mov    %eax,%edx
+  800741:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800745:	83 c0 08             	add    $0x8,%eax
+  800748:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80074b:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  80074e:	48 85 d2             	test   %rdx,%rdx
+  800751:	48 b8 35 4a 80 00 00 	movabs $0x804a35,%rax
+  800758:	00 00 00 
+  80075b:	48 0f 45 c2          	cmovne %rdx,%rax
+  80075f:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800763:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800767:	7e 06                	jle    80076f <vprintfmt+0x24b>
+  800769:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80076d:	75 4a                	jne    8007b9 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80076f:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800773:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800777:	0f b6 00             	movzbl (%rax),%eax
+  80077a:	84 c0                	test   %al,%al
+  80077c:	0f 85 9a 00 00 00    	jne    80081c <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800782:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800785:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800789:	85 c0                	test   %eax,%eax
+  80078b:	0f 8e c4 fd ff ff    	jle    800555 <vprintfmt+0x31>
+  800791:	4c 89 ee             	mov    %r13,%rsi
+  800794:	bf 20 00 00 00       	mov    $0x20,%edi
+  800799:	41 ff d6             	call   *%r14
+  80079c:	41 83 ec 01          	sub    $0x1,%r12d
+  8007a0:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8007a4:	75 eb                	jne    800791 <vprintfmt+0x26d>
+  8007a6:	e9 aa fd ff ff       	jmp    800555 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8007ab:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007af:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007b3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007b7:	eb 92                	jmp    80074b <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8007b9:	49 63 f7             	movslq %r15d,%rsi
+  8007bc:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8007c0:	48 b8 d6 0c 80 00 00 	movabs $0x800cd6,%rax
+  8007c7:	00 00 00 
+  8007ca:	ff d0                	call   *%rax
+  8007cc:	48 89 c2             	mov    %rax,%rdx
+  8007cf:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8007d2:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8007d4:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8007d7:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8007da:	85 c0                	test   %eax,%eax
+  8007dc:	7e 91                	jle    80076f <vprintfmt+0x24b>
+  8007de:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8007e3:	4c 89 ee             	mov    %r13,%rsi
+  8007e6:	44 89 e7             	mov    %r12d,%edi
+  8007e9:	41 ff d6             	call   *%r14
+  8007ec:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8007f0:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8007f3:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8007f6:	75 eb                	jne    8007e3 <vprintfmt+0x2bf>
+  8007f8:	e9 72 ff ff ff       	jmp    80076f <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8007fd:	0f b6 f8             	movzbl %al,%edi
+  800800:	4c 89 ee             	mov    %r13,%rsi
+  800803:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800806:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80080a:	49 83 c4 01          	add    $0x1,%r12
+  80080e:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800814:	84 c0                	test   %al,%al
+  800816:	0f 84 66 ff ff ff    	je     800782 <vprintfmt+0x25e>
+  80081c:	45 85 ff             	test   %r15d,%r15d
+  80081f:	78 0a                	js     80082b <vprintfmt+0x307>
+  800821:	41 83 ef 01          	sub    $0x1,%r15d
+  800825:	0f 88 57 ff ff ff    	js     800782 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80082b:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  80082f:	74 cc                	je     8007fd <vprintfmt+0x2d9>
+  800831:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800834:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800839:	80 fa 5e             	cmp    $0x5e,%dl
+  80083c:	77 c2                	ja     800800 <vprintfmt+0x2dc>
+  80083e:	eb bd                	jmp    8007fd <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800840:	40 84 f6             	test   %sil,%sil
+  800843:	75 26                	jne    80086b <vprintfmt+0x347>
+    switch (lflag) {
+  800845:	85 d2                	test   %edx,%edx
+  800847:	74 59                	je     8008a2 <vprintfmt+0x37e>
+  800849:	83 fa 01             	cmp    $0x1,%edx
+  80084c:	74 7b                	je     8008c9 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  80084e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800851:	83 f8 2f             	cmp    $0x2f,%eax
+  800854:	0f 87 96 00 00 00    	ja     8008f0 <vprintfmt+0x3cc>
+  80085a:	89 c2                	mov    %eax,%edx
+  80085c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800860:	83 c0 08             	add    $0x8,%eax
+  800863:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800866:	4c 8b 22             	mov    (%rdx),%r12
+  800869:	eb 17                	jmp    800882 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  80086b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80086e:	83 f8 2f             	cmp    $0x2f,%eax
+  800871:	77 21                	ja     800894 <vprintfmt+0x370>
+  800873:	89 c2                	mov    %eax,%edx
+  800875:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800879:	83 c0 08             	add    $0x8,%eax
+  80087c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80087f:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800882:	4d 85 e4             	test   %r12,%r12
+  800885:	78 7a                	js     800901 <vprintfmt+0x3dd>
+            num = i;
+  800887:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80088a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80088f:	e9 50 02 00 00       	jmp    800ae4 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800894:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800898:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80089c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008a0:	eb dd                	jmp    80087f <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8008a2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008a5:	83 f8 2f             	cmp    $0x2f,%eax
+  8008a8:	77 11                	ja     8008bb <vprintfmt+0x397>
+  8008aa:	89 c2                	mov    %eax,%edx
+  8008ac:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008b0:	83 c0 08             	add    $0x8,%eax
+  8008b3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008b6:	4c 63 22             	movslq (%rdx),%r12
+  8008b9:	eb c7                	jmp    800882 <vprintfmt+0x35e>
+  8008bb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008bf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008c3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008c7:	eb ed                	jmp    8008b6 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8008c9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008cc:	83 f8 2f             	cmp    $0x2f,%eax
+  8008cf:	77 11                	ja     8008e2 <vprintfmt+0x3be>
+  8008d1:	89 c2                	mov    %eax,%edx
+  8008d3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008d7:	83 c0 08             	add    $0x8,%eax
+  8008da:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008dd:	4c 8b 22             	mov    (%rdx),%r12
+  8008e0:	eb a0                	jmp    800882 <vprintfmt+0x35e>
+  8008e2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008e6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008ea:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008ee:	eb ed                	jmp    8008dd <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8008f0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008f4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008f8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008fc:	e9 65 ff ff ff       	jmp    800866 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800901:	4c 89 ee             	mov    %r13,%rsi
+  800904:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800909:	41 ff d6             	call   *%r14
+                i = -i;
+  80090c:	49 f7 dc             	neg    %r12
+  80090f:	e9 73 ff ff ff       	jmp    800887 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800914:	40 84 f6             	test   %sil,%sil
+  800917:	75 32                	jne    80094b <vprintfmt+0x427>
+    switch (lflag) {
+  800919:	85 d2                	test   %edx,%edx
+  80091b:	74 5d                	je     80097a <vprintfmt+0x456>
+  80091d:	83 fa 01             	cmp    $0x1,%edx
+  800920:	0f 84 82 00 00 00    	je     8009a8 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800926:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800929:	83 f8 2f             	cmp    $0x2f,%eax
+  80092c:	0f 87 a5 00 00 00    	ja     8009d7 <vprintfmt+0x4b3>
+  800932:	89 c2                	mov    %eax,%edx
+  800934:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800938:	83 c0 08             	add    $0x8,%eax
+  80093b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80093e:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800941:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800946:	e9 99 01 00 00       	jmp    800ae4 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80094b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80094e:	83 f8 2f             	cmp    $0x2f,%eax
+  800951:	77 19                	ja     80096c <vprintfmt+0x448>
+  800953:	89 c2                	mov    %eax,%edx
+  800955:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800959:	83 c0 08             	add    $0x8,%eax
+  80095c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80095f:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800962:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800967:	e9 78 01 00 00       	jmp    800ae4 <vprintfmt+0x5c0>
+  80096c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800970:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800974:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800978:	eb e5                	jmp    80095f <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  80097a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80097d:	83 f8 2f             	cmp    $0x2f,%eax
+  800980:	77 18                	ja     80099a <vprintfmt+0x476>
+  800982:	89 c2                	mov    %eax,%edx
+  800984:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800988:	83 c0 08             	add    $0x8,%eax
+  80098b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80098e:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800990:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800995:	e9 4a 01 00 00       	jmp    800ae4 <vprintfmt+0x5c0>
+  80099a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80099e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009a2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009a6:	eb e6                	jmp    80098e <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8009a8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009ab:	83 f8 2f             	cmp    $0x2f,%eax
+  8009ae:	77 19                	ja     8009c9 <vprintfmt+0x4a5>
+  8009b0:	89 c2                	mov    %eax,%edx
+  8009b2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009b6:	83 c0 08             	add    $0x8,%eax
+  8009b9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009bc:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8009bf:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8009c4:	e9 1b 01 00 00       	jmp    800ae4 <vprintfmt+0x5c0>
+  8009c9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009cd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009d1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009d5:	eb e5                	jmp    8009bc <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8009d7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009db:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009df:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009e3:	e9 56 ff ff ff       	jmp    80093e <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8009e8:	40 84 f6             	test   %sil,%sil
+  8009eb:	75 2e                	jne    800a1b <vprintfmt+0x4f7>
+    switch (lflag) {
+  8009ed:	85 d2                	test   %edx,%edx
+  8009ef:	74 59                	je     800a4a <vprintfmt+0x526>
+  8009f1:	83 fa 01             	cmp    $0x1,%edx
+  8009f4:	74 7f                	je     800a75 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8009f6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009f9:	83 f8 2f             	cmp    $0x2f,%eax
+  8009fc:	0f 87 9f 00 00 00    	ja     800aa1 <vprintfmt+0x57d>
+  800a02:	89 c2                	mov    %eax,%edx
+  800a04:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a08:	83 c0 08             	add    $0x8,%eax
+  800a0b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a0e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a11:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a16:	e9 c9 00 00 00       	jmp    800ae4 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a1b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a1e:	83 f8 2f             	cmp    $0x2f,%eax
+  800a21:	77 19                	ja     800a3c <vprintfmt+0x518>
+  800a23:	89 c2                	mov    %eax,%edx
+  800a25:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a29:	83 c0 08             	add    $0x8,%eax
+  800a2c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a2f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a32:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a37:	e9 a8 00 00 00       	jmp    800ae4 <vprintfmt+0x5c0>
+  800a3c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a40:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a44:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a48:	eb e5                	jmp    800a2f <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800a4a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a4d:	83 f8 2f             	cmp    $0x2f,%eax
+  800a50:	77 15                	ja     800a67 <vprintfmt+0x543>
+  800a52:	89 c2                	mov    %eax,%edx
+  800a54:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a58:	83 c0 08             	add    $0x8,%eax
+  800a5b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a5e:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800a60:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800a65:	eb 7d                	jmp    800ae4 <vprintfmt+0x5c0>
+  800a67:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a6b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a6f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a73:	eb e9                	jmp    800a5e <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800a75:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a78:	83 f8 2f             	cmp    $0x2f,%eax
+  800a7b:	77 16                	ja     800a93 <vprintfmt+0x56f>
+  800a7d:	89 c2                	mov    %eax,%edx
+  800a7f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a83:	83 c0 08             	add    $0x8,%eax
+  800a86:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a89:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a8c:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800a91:	eb 51                	jmp    800ae4 <vprintfmt+0x5c0>
+  800a93:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a97:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a9b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a9f:	eb e8                	jmp    800a89 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800aa1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aa5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aa9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aad:	e9 5c ff ff ff       	jmp    800a0e <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800ab2:	4c 89 ee             	mov    %r13,%rsi
+  800ab5:	bf 30 00 00 00       	mov    $0x30,%edi
+  800aba:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800abd:	4c 89 ee             	mov    %r13,%rsi
+  800ac0:	bf 78 00 00 00       	mov    $0x78,%edi
+  800ac5:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800ac8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800acb:	83 f8 2f             	cmp    $0x2f,%eax
+  800ace:	77 47                	ja     800b17 <vprintfmt+0x5f3>
+  800ad0:	89 c2                	mov    %eax,%edx
+  800ad2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ad6:	83 c0 08             	add    $0x8,%eax
+  800ad9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800adc:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800adf:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800ae4:	48 83 ec 08          	sub    $0x8,%rsp
+  800ae8:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800aec:	0f 94 c0             	sete   %al
+  800aef:	0f b6 c0             	movzbl %al,%eax
+  800af2:	50                   	push   %rax
+  800af3:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800af8:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800afc:	4c 89 ee             	mov    %r13,%rsi
+  800aff:	4c 89 f7             	mov    %r14,%rdi
+  800b02:	48 b8 19 04 80 00 00 	movabs $0x800419,%rax
+  800b09:	00 00 00 
+  800b0c:	ff d0                	call   *%rax
+            break;
+  800b0e:	48 83 c4 10          	add    $0x10,%rsp
+  800b12:	e9 3e fa ff ff       	jmp    800555 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800b17:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b1b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b1f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b23:	eb b7                	jmp    800adc <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800b25:	40 84 f6             	test   %sil,%sil
+  800b28:	75 2b                	jne    800b55 <vprintfmt+0x631>
+    switch (lflag) {
+  800b2a:	85 d2                	test   %edx,%edx
+  800b2c:	74 56                	je     800b84 <vprintfmt+0x660>
+  800b2e:	83 fa 01             	cmp    $0x1,%edx
+  800b31:	74 7f                	je     800bb2 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800b33:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b36:	83 f8 2f             	cmp    $0x2f,%eax
+  800b39:	0f 87 a2 00 00 00    	ja     800be1 <vprintfmt+0x6bd>
+  800b3f:	89 c2                	mov    %eax,%edx
+  800b41:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b45:	83 c0 08             	add    $0x8,%eax
+  800b48:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b4b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b4e:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b53:	eb 8f                	jmp    800ae4 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b55:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b58:	83 f8 2f             	cmp    $0x2f,%eax
+  800b5b:	77 19                	ja     800b76 <vprintfmt+0x652>
+  800b5d:	89 c2                	mov    %eax,%edx
+  800b5f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b63:	83 c0 08             	add    $0x8,%eax
+  800b66:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b69:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b6c:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b71:	e9 6e ff ff ff       	jmp    800ae4 <vprintfmt+0x5c0>
+  800b76:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b7a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b7e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b82:	eb e5                	jmp    800b69 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800b84:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b87:	83 f8 2f             	cmp    $0x2f,%eax
+  800b8a:	77 18                	ja     800ba4 <vprintfmt+0x680>
+  800b8c:	89 c2                	mov    %eax,%edx
+  800b8e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b92:	83 c0 08             	add    $0x8,%eax
+  800b95:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b98:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800b9a:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800b9f:	e9 40 ff ff ff       	jmp    800ae4 <vprintfmt+0x5c0>
+  800ba4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ba8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bac:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bb0:	eb e6                	jmp    800b98 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800bb2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bb5:	83 f8 2f             	cmp    $0x2f,%eax
+  800bb8:	77 19                	ja     800bd3 <vprintfmt+0x6af>
+  800bba:	89 c2                	mov    %eax,%edx
+  800bbc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bc0:	83 c0 08             	add    $0x8,%eax
+  800bc3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bc6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800bc9:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800bce:	e9 11 ff ff ff       	jmp    800ae4 <vprintfmt+0x5c0>
+  800bd3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bd7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bdb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bdf:	eb e5                	jmp    800bc6 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800be1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800be5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800be9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bed:	e9 59 ff ff ff       	jmp    800b4b <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800bf2:	4c 89 ee             	mov    %r13,%rsi
+  800bf5:	bf 25 00 00 00       	mov    $0x25,%edi
+  800bfa:	41 ff d6             	call   *%r14
+            break;
+  800bfd:	e9 53 f9 ff ff       	jmp    800555 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800c02:	4c 89 ee             	mov    %r13,%rsi
+  800c05:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c0a:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800c0d:	48 83 eb 01          	sub    $0x1,%rbx
+  800c11:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800c15:	75 f6                	jne    800c0d <vprintfmt+0x6e9>
+  800c17:	e9 39 f9 ff ff       	jmp    800555 <vprintfmt+0x31>
+}
+  800c1c:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800c20:	5b                   	pop    %rbx
+  800c21:	41 5c                	pop    %r12
+  800c23:	41 5d                	pop    %r13
+  800c25:	41 5e                	pop    %r14
+  800c27:	41 5f                	pop    %r15
+  800c29:	5d                   	pop    %rbp
+  800c2a:	c3                   	ret
+
+0000000000800c2b <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800c2b:	55                   	push   %rbp
+  800c2c:	48 89 e5             	mov    %rsp,%rbp
+  800c2f:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800c33:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800c37:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800c3c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800c40:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800c47:	48 85 ff             	test   %rdi,%rdi
+  800c4a:	74 2b                	je     800c77 <vsnprintf+0x4c>
+  800c4c:	48 85 f6             	test   %rsi,%rsi
+  800c4f:	74 26                	je     800c77 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800c51:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800c55:	48 bf cf 04 80 00 00 	movabs $0x8004cf,%rdi
+  800c5c:	00 00 00 
+  800c5f:	48 b8 24 05 80 00 00 	movabs $0x800524,%rax
+  800c66:	00 00 00 
+  800c69:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800c6b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c6f:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800c72:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800c75:	c9                   	leave
+  800c76:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800c77:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c7c:	eb f7                	jmp    800c75 <vsnprintf+0x4a>
+
+0000000000800c7e <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800c7e:	55                   	push   %rbp
+  800c7f:	48 89 e5             	mov    %rsp,%rbp
+  800c82:	48 83 ec 50          	sub    $0x50,%rsp
+  800c86:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800c8a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800c8e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800c92:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800c99:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800c9d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ca1:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800ca5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800ca9:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800cad:	48 b8 2b 0c 80 00 00 	movabs $0x800c2b,%rax
+  800cb4:	00 00 00 
+  800cb7:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800cb9:	c9                   	leave
+  800cba:	c3                   	ret
+
+0000000000800cbb <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800cbb:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800cbe:	74 10                	je     800cd0 <strlen+0x15>
+    size_t n = 0;
+  800cc0:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800cc5:	48 83 c0 01          	add    $0x1,%rax
+  800cc9:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800ccd:	75 f6                	jne    800cc5 <strlen+0xa>
+  800ccf:	c3                   	ret
+    size_t n = 0;
+  800cd0:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800cd5:	c3                   	ret
+
+0000000000800cd6 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800cd6:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800cd9:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800cde:	48 85 f6             	test   %rsi,%rsi
+  800ce1:	74 11                	je     800cf4 <strnlen+0x1e>
+  800ce3:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800ce7:	74 0c                	je     800cf5 <strnlen+0x1f>
+  800ce9:	48 83 c2 01          	add    $0x1,%rdx
+  800ced:	48 39 d0             	cmp    %rdx,%rax
+  800cf0:	75 f1                	jne    800ce3 <strnlen+0xd>
+  800cf2:	eb 04                	jmp    800cf8 <strnlen+0x22>
+  800cf4:	c3                   	ret
+  800cf5:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800cf8:	c3                   	ret
+
+0000000000800cf9 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800cf9:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800cfc:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d01:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800d05:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800d08:	48 83 c2 01          	add    $0x1,%rdx
+  800d0c:	84 c9                	test   %cl,%cl
+  800d0e:	75 f1                	jne    800d01 <strcpy+0x8>
+        ;
+    return res;
+}
+  800d10:	c3                   	ret
+
+0000000000800d11 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800d11:	55                   	push   %rbp
+  800d12:	48 89 e5             	mov    %rsp,%rbp
+  800d15:	41 54                	push   %r12
+  800d17:	53                   	push   %rbx
+  800d18:	48 89 fb             	mov    %rdi,%rbx
+  800d1b:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800d1e:	48 b8 bb 0c 80 00 00 	movabs $0x800cbb,%rax
+  800d25:	00 00 00 
+  800d28:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800d2a:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800d2e:	4c 89 e6             	mov    %r12,%rsi
+  800d31:	48 b8 f9 0c 80 00 00 	movabs $0x800cf9,%rax
+  800d38:	00 00 00 
+  800d3b:	ff d0                	call   *%rax
+    return dst;
+}
+  800d3d:	48 89 d8             	mov    %rbx,%rax
+  800d40:	5b                   	pop    %rbx
+  800d41:	41 5c                	pop    %r12
+  800d43:	5d                   	pop    %rbp
+  800d44:	c3                   	ret
+
+0000000000800d45 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800d45:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800d48:	48 85 d2             	test   %rdx,%rdx
+  800d4b:	74 1f                	je     800d6c <strncpy+0x27>
+  800d4d:	48 01 fa             	add    %rdi,%rdx
+  800d50:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800d53:	48 83 c1 01          	add    $0x1,%rcx
+  800d57:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800d5b:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800d5f:	41 80 f8 01          	cmp    $0x1,%r8b
+  800d63:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800d67:	48 39 ca             	cmp    %rcx,%rdx
+  800d6a:	75 e7                	jne    800d53 <strncpy+0xe>
+    }
+    return ret;
+}
+  800d6c:	c3                   	ret
+
+0000000000800d6d <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800d6d:	48 89 f8             	mov    %rdi,%rax
+  800d70:	48 85 d2             	test   %rdx,%rdx
+  800d73:	74 24                	je     800d99 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800d75:	48 83 ea 01          	sub    $0x1,%rdx
+  800d79:	74 1b                	je     800d96 <strlcpy+0x29>
+  800d7b:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800d7f:	0f b6 16             	movzbl (%rsi),%edx
+  800d82:	84 d2                	test   %dl,%dl
+  800d84:	74 10                	je     800d96 <strlcpy+0x29>
+            *dst++ = *src++;
+  800d86:	48 83 c6 01          	add    $0x1,%rsi
+  800d8a:	48 83 c0 01          	add    $0x1,%rax
+  800d8e:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800d91:	48 39 c8             	cmp    %rcx,%rax
+  800d94:	75 e9                	jne    800d7f <strlcpy+0x12>
+        *dst = '\0';
+  800d96:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800d99:	48 29 f8             	sub    %rdi,%rax
+}
+  800d9c:	c3                   	ret
+
+0000000000800d9d <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800d9d:	0f b6 07             	movzbl (%rdi),%eax
+  800da0:	84 c0                	test   %al,%al
+  800da2:	74 13                	je     800db7 <strcmp+0x1a>
+  800da4:	38 06                	cmp    %al,(%rsi)
+  800da6:	75 0f                	jne    800db7 <strcmp+0x1a>
+  800da8:	48 83 c7 01          	add    $0x1,%rdi
+  800dac:	48 83 c6 01          	add    $0x1,%rsi
+  800db0:	0f b6 07             	movzbl (%rdi),%eax
+  800db3:	84 c0                	test   %al,%al
+  800db5:	75 ed                	jne    800da4 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800db7:	0f b6 c0             	movzbl %al,%eax
+  800dba:	0f b6 16             	movzbl (%rsi),%edx
+  800dbd:	29 d0                	sub    %edx,%eax
+}
+  800dbf:	c3                   	ret
+
+0000000000800dc0 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800dc0:	48 85 d2             	test   %rdx,%rdx
+  800dc3:	74 1f                	je     800de4 <strncmp+0x24>
+  800dc5:	0f b6 07             	movzbl (%rdi),%eax
+  800dc8:	84 c0                	test   %al,%al
+  800dca:	74 1e                	je     800dea <strncmp+0x2a>
+  800dcc:	3a 06                	cmp    (%rsi),%al
+  800dce:	75 1a                	jne    800dea <strncmp+0x2a>
+  800dd0:	48 83 c7 01          	add    $0x1,%rdi
+  800dd4:	48 83 c6 01          	add    $0x1,%rsi
+  800dd8:	48 83 ea 01          	sub    $0x1,%rdx
+  800ddc:	75 e7                	jne    800dc5 <strncmp+0x5>
+
+    if (!n) return 0;
+  800dde:	b8 00 00 00 00       	mov    $0x0,%eax
+  800de3:	c3                   	ret
+  800de4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800de9:	c3                   	ret
+  800dea:	48 85 d2             	test   %rdx,%rdx
+  800ded:	74 09                	je     800df8 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800def:	0f b6 07             	movzbl (%rdi),%eax
+  800df2:	0f b6 16             	movzbl (%rsi),%edx
+  800df5:	29 d0                	sub    %edx,%eax
+  800df7:	c3                   	ret
+    if (!n) return 0;
+  800df8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800dfd:	c3                   	ret
+
+0000000000800dfe <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800dfe:	0f b6 17             	movzbl (%rdi),%edx
+  800e01:	84 d2                	test   %dl,%dl
+  800e03:	74 18                	je     800e1d <strchr+0x1f>
+        if (*str == c) {
+  800e05:	0f be d2             	movsbl %dl,%edx
+  800e08:	39 f2                	cmp    %esi,%edx
+  800e0a:	74 17                	je     800e23 <strchr+0x25>
+    for (; *str; str++) {
+  800e0c:	48 83 c7 01          	add    $0x1,%rdi
+  800e10:	0f b6 17             	movzbl (%rdi),%edx
+  800e13:	84 d2                	test   %dl,%dl
+  800e15:	75 ee                	jne    800e05 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800e17:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e1c:	c3                   	ret
+  800e1d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e22:	c3                   	ret
+  800e23:	48 89 f8             	mov    %rdi,%rax
+}
+  800e26:	c3                   	ret
+
+0000000000800e27 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800e27:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800e2a:	0f b6 17             	movzbl (%rdi),%edx
+  800e2d:	84 d2                	test   %dl,%dl
+  800e2f:	74 13                	je     800e44 <strfind+0x1d>
+  800e31:	0f be d2             	movsbl %dl,%edx
+  800e34:	39 f2                	cmp    %esi,%edx
+  800e36:	74 0b                	je     800e43 <strfind+0x1c>
+  800e38:	48 83 c0 01          	add    $0x1,%rax
+  800e3c:	0f b6 10             	movzbl (%rax),%edx
+  800e3f:	84 d2                	test   %dl,%dl
+  800e41:	75 ee                	jne    800e31 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800e43:	c3                   	ret
+  800e44:	c3                   	ret
+
+0000000000800e45 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800e45:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800e48:	48 89 f8             	mov    %rdi,%rax
+  800e4b:	48 f7 d8             	neg    %rax
+  800e4e:	83 e0 07             	and    $0x7,%eax
+  800e51:	49 89 d1             	mov    %rdx,%r9
+  800e54:	49 29 c1             	sub    %rax,%r9
+  800e57:	78 36                	js     800e8f <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800e59:	40 0f b6 c6          	movzbl %sil,%eax
+  800e5d:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800e64:	01 01 01 
+  800e67:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800e6b:	40 f6 c7 07          	test   $0x7,%dil
+  800e6f:	75 38                	jne    800ea9 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800e71:	4c 89 c9             	mov    %r9,%rcx
+  800e74:	48 c1 f9 03          	sar    $0x3,%rcx
+  800e78:	74 0c                	je     800e86 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800e7a:	fc                   	cld
+  800e7b:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800e7e:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800e82:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800e86:	4d 85 c9             	test   %r9,%r9
+  800e89:	75 45                	jne    800ed0 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800e8b:	4c 89 c0             	mov    %r8,%rax
+  800e8e:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800e8f:	48 85 d2             	test   %rdx,%rdx
+  800e92:	74 f7                	je     800e8b <memset+0x46>
+  800e94:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800e97:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800e9a:	48 83 c0 01          	add    $0x1,%rax
+  800e9e:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800ea2:	48 39 c2             	cmp    %rax,%rdx
+  800ea5:	75 f3                	jne    800e9a <memset+0x55>
+  800ea7:	eb e2                	jmp    800e8b <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800ea9:	40 f6 c7 01          	test   $0x1,%dil
+  800ead:	74 06                	je     800eb5 <memset+0x70>
+  800eaf:	88 07                	mov    %al,(%rdi)
+  800eb1:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800eb5:	40 f6 c7 02          	test   $0x2,%dil
+  800eb9:	74 07                	je     800ec2 <memset+0x7d>
+  800ebb:	66 89 07             	mov    %ax,(%rdi)
+  800ebe:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800ec2:	40 f6 c7 04          	test   $0x4,%dil
+  800ec6:	74 a9                	je     800e71 <memset+0x2c>
+  800ec8:	89 07                	mov    %eax,(%rdi)
+  800eca:	48 83 c7 04          	add    $0x4,%rdi
+  800ece:	eb a1                	jmp    800e71 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800ed0:	41 f6 c1 04          	test   $0x4,%r9b
+  800ed4:	74 06                	je     800edc <memset+0x97>
+  800ed6:	89 07                	mov    %eax,(%rdi)
+  800ed8:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800edc:	41 f6 c1 02          	test   $0x2,%r9b
+  800ee0:	74 07                	je     800ee9 <memset+0xa4>
+  800ee2:	66 89 07             	mov    %ax,(%rdi)
+  800ee5:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800ee9:	41 f6 c1 01          	test   $0x1,%r9b
+  800eed:	74 9c                	je     800e8b <memset+0x46>
+  800eef:	88 07                	mov    %al,(%rdi)
+  800ef1:	eb 98                	jmp    800e8b <memset+0x46>
+
+0000000000800ef3 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800ef3:	48 89 f8             	mov    %rdi,%rax
+  800ef6:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800ef9:	48 39 fe             	cmp    %rdi,%rsi
+  800efc:	73 3b                	jae    800f39 <memmove+0x46>
+  800efe:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800f02:	48 39 d7             	cmp    %rdx,%rdi
+  800f05:	73 32                	jae    800f39 <memmove+0x46>
+        s += n;
+        d += n;
+  800f07:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f0b:	48 89 d6             	mov    %rdx,%rsi
+  800f0e:	48 09 fe             	or     %rdi,%rsi
+  800f11:	48 09 ce             	or     %rcx,%rsi
+  800f14:	40 f6 c6 07          	test   $0x7,%sil
+  800f18:	75 12                	jne    800f2c <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800f1a:	48 83 ef 08          	sub    $0x8,%rdi
+  800f1e:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800f22:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f26:	fd                   	std
+  800f27:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800f2a:	fc                   	cld
+  800f2b:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800f2c:	48 83 ef 01          	sub    $0x1,%rdi
+  800f30:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800f34:	fd                   	std
+  800f35:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800f37:	eb f1                	jmp    800f2a <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f39:	48 89 f2             	mov    %rsi,%rdx
+  800f3c:	48 09 c2             	or     %rax,%rdx
+  800f3f:	48 09 ca             	or     %rcx,%rdx
+  800f42:	f6 c2 07             	test   $0x7,%dl
+  800f45:	75 0c                	jne    800f53 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800f47:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f4b:	48 89 c7             	mov    %rax,%rdi
+  800f4e:	fc                   	cld
+  800f4f:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800f52:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800f53:	48 89 c7             	mov    %rax,%rdi
+  800f56:	fc                   	cld
+  800f57:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800f59:	c3                   	ret
+
+0000000000800f5a <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800f5a:	55                   	push   %rbp
+  800f5b:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800f5e:	48 b8 f3 0e 80 00 00 	movabs $0x800ef3,%rax
+  800f65:	00 00 00 
+  800f68:	ff d0                	call   *%rax
+}
+  800f6a:	5d                   	pop    %rbp
+  800f6b:	c3                   	ret
+
+0000000000800f6c <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800f6c:	55                   	push   %rbp
+  800f6d:	48 89 e5             	mov    %rsp,%rbp
+  800f70:	41 57                	push   %r15
+  800f72:	41 56                	push   %r14
+  800f74:	41 55                	push   %r13
+  800f76:	41 54                	push   %r12
+  800f78:	53                   	push   %rbx
+  800f79:	48 83 ec 08          	sub    $0x8,%rsp
+  800f7d:	49 89 fe             	mov    %rdi,%r14
+  800f80:	49 89 f7             	mov    %rsi,%r15
+  800f83:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800f86:	48 89 f7             	mov    %rsi,%rdi
+  800f89:	48 b8 bb 0c 80 00 00 	movabs $0x800cbb,%rax
+  800f90:	00 00 00 
+  800f93:	ff d0                	call   *%rax
+  800f95:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800f98:	48 89 de             	mov    %rbx,%rsi
+  800f9b:	4c 89 f7             	mov    %r14,%rdi
+  800f9e:	48 b8 d6 0c 80 00 00 	movabs $0x800cd6,%rax
+  800fa5:	00 00 00 
+  800fa8:	ff d0                	call   *%rax
+  800faa:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800fad:	48 39 c3             	cmp    %rax,%rbx
+  800fb0:	74 36                	je     800fe8 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800fb2:	48 89 d8             	mov    %rbx,%rax
+  800fb5:	4c 29 e8             	sub    %r13,%rax
+  800fb8:	49 39 c4             	cmp    %rax,%r12
+  800fbb:	73 31                	jae    800fee <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800fbd:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800fc2:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800fc6:	4c 89 fe             	mov    %r15,%rsi
+  800fc9:	48 b8 5a 0f 80 00 00 	movabs $0x800f5a,%rax
+  800fd0:	00 00 00 
+  800fd3:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800fd5:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800fd9:	48 83 c4 08          	add    $0x8,%rsp
+  800fdd:	5b                   	pop    %rbx
+  800fde:	41 5c                	pop    %r12
+  800fe0:	41 5d                	pop    %r13
+  800fe2:	41 5e                	pop    %r14
+  800fe4:	41 5f                	pop    %r15
+  800fe6:	5d                   	pop    %rbp
+  800fe7:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800fe8:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800fec:	eb eb                	jmp    800fd9 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800fee:	48 83 eb 01          	sub    $0x1,%rbx
+  800ff2:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800ff6:	48 89 da             	mov    %rbx,%rdx
+  800ff9:	4c 89 fe             	mov    %r15,%rsi
+  800ffc:	48 b8 5a 0f 80 00 00 	movabs $0x800f5a,%rax
+  801003:	00 00 00 
+  801006:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801008:	49 01 de             	add    %rbx,%r14
+  80100b:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801010:	eb c3                	jmp    800fd5 <strlcat+0x69>
+
+0000000000801012 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801012:	48 85 d2             	test   %rdx,%rdx
+  801015:	74 2d                	je     801044 <memcmp+0x32>
+  801017:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80101c:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801020:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801025:	44 38 c1             	cmp    %r8b,%cl
+  801028:	75 0f                	jne    801039 <memcmp+0x27>
+    while (n-- > 0) {
+  80102a:	48 83 c0 01          	add    $0x1,%rax
+  80102e:	48 39 c2             	cmp    %rax,%rdx
+  801031:	75 e9                	jne    80101c <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801033:	b8 00 00 00 00       	mov    $0x0,%eax
+  801038:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801039:	0f b6 c1             	movzbl %cl,%eax
+  80103c:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801040:	44 29 c0             	sub    %r8d,%eax
+  801043:	c3                   	ret
+    return 0;
+  801044:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801049:	c3                   	ret
+
+000000000080104a <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80104a:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80104e:	48 39 c7             	cmp    %rax,%rdi
+  801051:	73 0f                	jae    801062 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801053:	40 38 37             	cmp    %sil,(%rdi)
+  801056:	74 0e                	je     801066 <memfind+0x1c>
+    for (; src < end; src++) {
+  801058:	48 83 c7 01          	add    $0x1,%rdi
+  80105c:	48 39 f8             	cmp    %rdi,%rax
+  80105f:	75 f2                	jne    801053 <memfind+0x9>
+  801061:	c3                   	ret
+  801062:	48 89 f8             	mov    %rdi,%rax
+  801065:	c3                   	ret
+  801066:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801069:	c3                   	ret
+
+000000000080106a <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80106a:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80106d:	0f b6 37             	movzbl (%rdi),%esi
+  801070:	40 80 fe 20          	cmp    $0x20,%sil
+  801074:	74 06                	je     80107c <strtol+0x12>
+  801076:	40 80 fe 09          	cmp    $0x9,%sil
+  80107a:	75 13                	jne    80108f <strtol+0x25>
+  80107c:	48 83 c7 01          	add    $0x1,%rdi
+  801080:	0f b6 37             	movzbl (%rdi),%esi
+  801083:	40 80 fe 20          	cmp    $0x20,%sil
+  801087:	74 f3                	je     80107c <strtol+0x12>
+  801089:	40 80 fe 09          	cmp    $0x9,%sil
+  80108d:	74 ed                	je     80107c <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80108f:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801092:	83 e0 fd             	and    $0xfffffffd,%eax
+  801095:	3c 01                	cmp    $0x1,%al
+  801097:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80109b:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8010a1:	75 0f                	jne    8010b2 <strtol+0x48>
+  8010a3:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8010a6:	74 14                	je     8010bc <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8010a8:	85 d2                	test   %edx,%edx
+  8010aa:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010af:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8010b2:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8010b7:	4c 63 ca             	movslq %edx,%r9
+  8010ba:	eb 36                	jmp    8010f2 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8010bc:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8010c0:	74 0f                	je     8010d1 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8010c2:	85 d2                	test   %edx,%edx
+  8010c4:	75 ec                	jne    8010b2 <strtol+0x48>
+        s++;
+  8010c6:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8010ca:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8010cf:	eb e1                	jmp    8010b2 <strtol+0x48>
+        s += 2;
+  8010d1:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8010d5:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8010da:	eb d6                	jmp    8010b2 <strtol+0x48>
+            dig -= '0';
+  8010dc:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8010df:	44 0f b6 c1          	movzbl %cl,%r8d
+  8010e3:	41 39 d0             	cmp    %edx,%r8d
+  8010e6:	7d 21                	jge    801109 <strtol+0x9f>
+        val = val * base + dig;
+  8010e8:	49 0f af c1          	imul   %r9,%rax
+  8010ec:	0f b6 c9             	movzbl %cl,%ecx
+  8010ef:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8010f2:	48 83 c7 01          	add    $0x1,%rdi
+  8010f6:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8010fa:	80 f9 39             	cmp    $0x39,%cl
+  8010fd:	76 dd                	jbe    8010dc <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8010ff:	80 f9 7b             	cmp    $0x7b,%cl
+  801102:	77 05                	ja     801109 <strtol+0x9f>
+            dig -= 'a' - 10;
+  801104:	83 e9 57             	sub    $0x57,%ecx
+  801107:	eb d6                	jmp    8010df <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801109:	4d 85 d2             	test   %r10,%r10
+  80110c:	74 03                	je     801111 <strtol+0xa7>
+  80110e:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801111:	48 89 c2             	mov    %rax,%rdx
+  801114:	48 f7 da             	neg    %rdx
+  801117:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80111b:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80111f:	c3                   	ret
+
+0000000000801120 <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  801120:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801125:	ba 00 00 00 00       	mov    $0x0,%edx
+  80112a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801130:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801136:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  80113c:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80113e:	c3                   	ret
+
+000000000080113f <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  80113f:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801144:	bf 00 00 00 00       	mov    $0x0,%edi
+  801149:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80114e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801153:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801159:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80115f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801165:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801167:	c3                   	ret
+
+0000000000801168 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801168:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80116b:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801170:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801175:	ba 00 00 00 00       	mov    $0x0,%edx
+  80117a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801180:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801186:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80118c:	0f 05                	syscall
+    if (check && ret > 0) {
+  80118e:	48 85 c0             	test   %rax,%rax
+  801191:	7f 01                	jg     801194 <sys_env_destroy+0x2c>
+}
+  801193:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  801194:	55                   	push   %rbp
+  801195:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801198:	49 89 c0             	mov    %rax,%r8
+  80119b:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8011a0:	48 ba 78 4f 80 00 00 	movabs $0x804f78,%rdx
+  8011a7:	00 00 00 
+  8011aa:	be 29 00 00 00       	mov    $0x29,%esi
+  8011af:	48 bf 97 4f 80 00 00 	movabs $0x804f97,%rdi
+  8011b6:	00 00 00 
+  8011b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011be:	49 b9 84 02 80 00 00 	movabs $0x800284,%r9
+  8011c5:	00 00 00 
+  8011c8:	41 ff d1             	call   *%r9
+
+00000000008011cb <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  8011cb:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8011d0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8011d5:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8011da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011df:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8011e5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011eb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8011f1:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8011f3:	c3                   	ret
+
+00000000008011f4 <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  8011f4:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8011f9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8011fe:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801203:	ba 00 00 00 00       	mov    $0x0,%edx
+  801208:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80120e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801214:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80121a:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80121c:	c3                   	ret
+
+000000000080121d <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  80121d:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801222:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  801229:	00 00 00 
+  80122c:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801232:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801238:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80123e:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801240:	c3                   	ret
+
+0000000000801241 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801241:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  801244:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801249:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80124f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801255:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801257:	c3                   	ret
+
+0000000000801258 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801258:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80125b:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801260:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801263:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801269:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80126f:	0f 05                	syscall
+    if (check && ret > 0) {
+  801271:	48 85 c0             	test   %rax,%rax
+  801274:	7f 01                	jg     801277 <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801276:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801277:	55                   	push   %rbp
+  801278:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80127b:	49 89 c0             	mov    %rax,%r8
+  80127e:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801283:	48 ba 78 4f 80 00 00 	movabs $0x804f78,%rdx
+  80128a:	00 00 00 
+  80128d:	be 29 00 00 00       	mov    $0x29,%esi
+  801292:	48 bf 97 4f 80 00 00 	movabs $0x804f97,%rdi
+  801299:	00 00 00 
+  80129c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012a1:	49 b9 84 02 80 00 00 	movabs $0x800284,%r9
+  8012a8:	00 00 00 
+  8012ab:	41 ff d1             	call   *%r9
+
+00000000008012ae <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8012ae:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8012b1:	48 63 d2             	movslq %edx,%rdx
+  8012b4:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8012b7:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8012bc:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  8012bf:	0f 05                	syscall
+    if (check && ret > 0) {
+  8012c1:	48 85 c0             	test   %rax,%rax
+  8012c4:	7f 01                	jg     8012c7 <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8012c6:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8012c7:	55                   	push   %rbp
+  8012c8:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012cb:	49 89 c0             	mov    %rax,%r8
+  8012ce:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8012d3:	48 ba 78 4f 80 00 00 	movabs $0x804f78,%rdx
+  8012da:	00 00 00 
+  8012dd:	be 29 00 00 00       	mov    $0x29,%esi
+  8012e2:	48 bf 97 4f 80 00 00 	movabs $0x804f97,%rdi
+  8012e9:	00 00 00 
+  8012ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012f1:	49 b9 84 02 80 00 00 	movabs $0x800284,%r9
+  8012f8:	00 00 00 
+  8012fb:	41 ff d1             	call   *%r9
+
+00000000008012fe <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8012fe:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801301:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801306:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80130c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801312:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801318:	0f 05                	syscall
+    if (check && ret > 0) {
+  80131a:	48 85 c0             	test   %rax,%rax
+  80131d:	7f 01                	jg     801320 <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80131f:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801320:	55                   	push   %rbp
+  801321:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801324:	49 89 c0             	mov    %rax,%r8
+  801327:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80132c:	48 ba 78 4f 80 00 00 	movabs $0x804f78,%rdx
+  801333:	00 00 00 
+  801336:	be 29 00 00 00       	mov    $0x29,%esi
+  80133b:	48 bf 97 4f 80 00 00 	movabs $0x804f97,%rdi
+  801342:	00 00 00 
+  801345:	b8 00 00 00 00       	mov    $0x0,%eax
+  80134a:	49 b9 84 02 80 00 00 	movabs $0x800284,%r9
+  801351:	00 00 00 
+  801354:	41 ff d1             	call   *%r9
+
+0000000000801357 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801357:	48 63 f6             	movslq %esi,%rsi
+  80135a:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80135d:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801362:	ba 00 00 00 00       	mov    $0x0,%edx
+  801367:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80136d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801373:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801379:	0f 05                	syscall
+    if (check && ret > 0) {
+  80137b:	48 85 c0             	test   %rax,%rax
+  80137e:	7f 01                	jg     801381 <sys_env_set_status+0x2a>
+}
+  801380:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  801381:	55                   	push   %rbp
+  801382:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801385:	49 89 c0             	mov    %rax,%r8
+  801388:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80138d:	48 ba 78 4f 80 00 00 	movabs $0x804f78,%rdx
+  801394:	00 00 00 
+  801397:	be 29 00 00 00       	mov    $0x29,%esi
+  80139c:	48 bf 97 4f 80 00 00 	movabs $0x804f97,%rdi
+  8013a3:	00 00 00 
+  8013a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013ab:	49 b9 84 02 80 00 00 	movabs $0x800284,%r9
+  8013b2:	00 00 00 
+  8013b5:	41 ff d1             	call   *%r9
+
+00000000008013b8 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8013b8:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8013bb:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8013c0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013c5:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013cb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013d1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013d7:	0f 05                	syscall
+    if (check && ret > 0) {
+  8013d9:	48 85 c0             	test   %rax,%rax
+  8013dc:	7f 01                	jg     8013df <sys_env_set_trapframe+0x27>
+}
+  8013de:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8013df:	55                   	push   %rbp
+  8013e0:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013e3:	49 89 c0             	mov    %rax,%r8
+  8013e6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8013eb:	48 ba 78 4f 80 00 00 	movabs $0x804f78,%rdx
+  8013f2:	00 00 00 
+  8013f5:	be 29 00 00 00       	mov    $0x29,%esi
+  8013fa:	48 bf 97 4f 80 00 00 	movabs $0x804f97,%rdi
+  801401:	00 00 00 
+  801404:	b8 00 00 00 00       	mov    $0x0,%eax
+  801409:	49 b9 84 02 80 00 00 	movabs $0x800284,%r9
+  801410:	00 00 00 
+  801413:	41 ff d1             	call   *%r9
+
+0000000000801416 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801416:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801419:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80141e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801423:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801429:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80142f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801435:	0f 05                	syscall
+    if (check && ret > 0) {
+  801437:	48 85 c0             	test   %rax,%rax
+  80143a:	7f 01                	jg     80143d <sys_env_set_pgfault_upcall+0x27>
+}
+  80143c:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80143d:	55                   	push   %rbp
+  80143e:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801441:	49 89 c0             	mov    %rax,%r8
+  801444:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801449:	48 ba 78 4f 80 00 00 	movabs $0x804f78,%rdx
+  801450:	00 00 00 
+  801453:	be 29 00 00 00       	mov    $0x29,%esi
+  801458:	48 bf 97 4f 80 00 00 	movabs $0x804f97,%rdi
+  80145f:	00 00 00 
+  801462:	b8 00 00 00 00       	mov    $0x0,%eax
+  801467:	49 b9 84 02 80 00 00 	movabs $0x800284,%r9
+  80146e:	00 00 00 
+  801471:	41 ff d1             	call   *%r9
+
+0000000000801474 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801474:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801477:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80147a:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80147f:	4d 63 c0             	movslq %r8d,%r8
+  801482:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801488:	0f 05                	syscall
+}
+  80148a:	c3                   	ret
+
+000000000080148b <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80148b:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80148e:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801491:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801496:	4d 63 c0             	movslq %r8d,%r8
+  801499:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80149f:	0f 05                	syscall
+}
+  8014a1:	c3                   	ret
+
+00000000008014a2 <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  8014a2:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8014a7:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014aa:	45 89 c0             	mov    %r8d,%r8d
+  8014ad:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8014b3:	0f 05                	syscall
+    if (check && ret > 0) {
+  8014b5:	48 85 c0             	test   %rax,%rax
+  8014b8:	7f 01                	jg     8014bb <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8014ba:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8014bb:	55                   	push   %rbp
+  8014bc:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014bf:	49 89 c0             	mov    %rax,%r8
+  8014c2:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8014c7:	48 ba 78 4f 80 00 00 	movabs $0x804f78,%rdx
+  8014ce:	00 00 00 
+  8014d1:	be 29 00 00 00       	mov    $0x29,%esi
+  8014d6:	48 bf 97 4f 80 00 00 	movabs $0x804f97,%rdi
+  8014dd:	00 00 00 
+  8014e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014e5:	49 b9 84 02 80 00 00 	movabs $0x800284,%r9
+  8014ec:	00 00 00 
+  8014ef:	41 ff d1             	call   *%r9
+
+00000000008014f2 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  8014f2:	55                   	push   %rbp
+  8014f3:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  8014f6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014fc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801501:	ba 00 00 00 00       	mov    $0x0,%edx
+  801506:	48 b8 a2 14 80 00 00 	movabs $0x8014a2,%rax
+  80150d:	00 00 00 
+  801510:	ff d0                	call   *%rax
+}
+  801512:	5d                   	pop    %rbp
+  801513:	c3                   	ret
+
+0000000000801514 <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  801514:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801519:	bf 00 00 00 00       	mov    $0x0,%edi
+  80151e:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801523:	ba 00 00 00 00       	mov    $0x0,%edx
+  801528:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80152e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801534:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80153a:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80153c:	c3                   	ret
+
+000000000080153d <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  80153d:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801542:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801547:	ba 00 00 00 00       	mov    $0x0,%edx
+  80154c:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801552:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801558:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80155e:	0f 05                	syscall
+    if (check && ret > 0) {
+  801560:	48 85 c0             	test   %rax,%rax
+  801563:	7f 01                	jg     801566 <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  801565:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  801566:	55                   	push   %rbp
+  801567:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80156a:	49 89 c0             	mov    %rax,%r8
+  80156d:	b9 10 00 00 00       	mov    $0x10,%ecx
+  801572:	48 ba 78 4f 80 00 00 	movabs $0x804f78,%rdx
+  801579:	00 00 00 
+  80157c:	be 29 00 00 00       	mov    $0x29,%esi
+  801581:	48 bf 97 4f 80 00 00 	movabs $0x804f97,%rdi
+  801588:	00 00 00 
+  80158b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801590:	49 b9 84 02 80 00 00 	movabs $0x800284,%r9
+  801597:	00 00 00 
+  80159a:	41 ff d1             	call   *%r9
+
+000000000080159d <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  80159d:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8015a2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015a7:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8015ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015b1:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8015b7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8015bd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8015c3:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  8015c5:	c3                   	ret
+
+00000000008015c6 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  8015c6:	89 d2                	mov    %edx,%edx
+  8015c8:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  8015ca:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8015cf:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8015d5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8015db:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8015e1:	0f 05                	syscall
+}
+  8015e3:	c3                   	ret
+
+00000000008015e4 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  8015e4:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  8015e7:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8015ec:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015f1:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8015f7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8015fd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801603:	0f 05                	syscall
+}
+  801605:	c3                   	ret
+
+0000000000801606 <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  801606:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  801609:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80160e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801613:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801619:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80161f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801625:	0f 05                	syscall
+}
+  801627:	c3                   	ret
+
+0000000000801628 <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  801628:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80162b:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801630:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801635:	ba 00 00 00 00       	mov    $0x0,%edx
+  80163a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801640:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801646:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80164c:	0f 05                	syscall
+    if (check && ret > 0) {
+  80164e:	48 85 c0             	test   %rax,%rax
+  801651:	7f 01                	jg     801654 <sys_irq_ack+0x2c>
+}
+  801653:	c3                   	ret
+sys_irq_ack(int irq) {
+  801654:	55                   	push   %rbp
+  801655:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801658:	49 89 c0             	mov    %rax,%r8
+  80165b:	b9 16 00 00 00       	mov    $0x16,%ecx
+  801660:	48 ba 78 4f 80 00 00 	movabs $0x804f78,%rdx
+  801667:	00 00 00 
+  80166a:	be 29 00 00 00       	mov    $0x29,%esi
+  80166f:	48 bf 97 4f 80 00 00 	movabs $0x804f97,%rdi
+  801676:	00 00 00 
+  801679:	b8 00 00 00 00       	mov    $0x0,%eax
+  80167e:	49 b9 84 02 80 00 00 	movabs $0x800284,%r9
+  801685:	00 00 00 
+  801688:	41 ff d1             	call   *%r9
+
+000000000080168b <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  80168b:	55                   	push   %rbp
+  80168c:	48 89 e5             	mov    %rsp,%rbp
+  80168f:	41 54                	push   %r12
+  801691:	53                   	push   %rbx
+    // LAB 9: Your code here
+    /* The child would write them out once more */
+    file_flush_buffers();
+  801692:	48 b8 86 32 80 00 00 	movabs $0x803286,%rax
+  801699:	00 00 00 
+  80169c:	ff d0                	call   *%rax
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("syscall"
+  80169e:	b8 08 00 00 00       	mov    $0x8,%eax
+  8016a3:	0f 05                	syscall
+  8016a5:	41 89 c4             	mov    %eax,%r12d
+
+	envid_t envid = sys_exofork();
+    if (envid < 0)
+  8016a8:	85 c0                	test   %eax,%eax
+  8016aa:	78 7e                	js     80172a <fork+0x9f>
+        return envid;
+    if (envid == 0) {
+  8016ac:	0f 84 80 00 00 00    	je     801732 <fork+0xa7>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE) < 0) {
+  8016b2:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  8016b8:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  8016bf:	00 00 00 
+  8016c2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016c7:	89 c2                	mov    %eax,%edx
+  8016c9:	be 00 00 00 00       	mov    $0x0,%esi
+  8016ce:	bf 00 00 00 00       	mov    $0x0,%edi
+  8016d3:	48 b8 ae 12 80 00 00 	movabs $0x8012ae,%rax
+  8016da:	00 00 00 
+  8016dd:	ff d0                	call   *%rax
+  8016df:	85 c0                	test   %eax,%eax
+  8016e1:	0f 88 86 00 00 00    	js     80176d <fork+0xe2>
+		return -1;
+	}
+    if (sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall) < 0) {
+  8016e7:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8016ee:	00 00 00 
+  8016f1:	48 8b b0 28 01 00 00 	mov    0x128(%rax),%rsi
+  8016f8:	44 89 e7             	mov    %r12d,%edi
+  8016fb:	48 b8 16 14 80 00 00 	movabs $0x801416,%rax
+  801702:	00 00 00 
+  801705:	ff d0                	call   *%rax
+  801707:	85 c0                	test   %eax,%eax
+  801709:	78 6a                	js     801775 <fork+0xea>
+		return -1;
+	}
+    if (sys_env_set_status(envid, ENV_RUNNABLE) < 0) {
+  80170b:	be 02 00 00 00       	mov    $0x2,%esi
+  801710:	44 89 e7             	mov    %r12d,%edi
+  801713:	48 b8 57 13 80 00 00 	movabs $0x801357,%rax
+  80171a:	00 00 00 
+  80171d:	ff d0                	call   *%rax
+		return -1;
+  80171f:	85 c0                	test   %eax,%eax
+  801721:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801726:	44 0f 48 e0          	cmovs  %eax,%r12d
+	}
+    return envid;
+}
+  80172a:	44 89 e0             	mov    %r12d,%eax
+  80172d:	5b                   	pop    %rbx
+  80172e:	41 5c                	pop    %r12
+  801730:	5d                   	pop    %rbp
+  801731:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801732:	48 b8 cb 11 80 00 00 	movabs $0x8011cb,%rax
+  801739:	00 00 00 
+  80173c:	ff d0                	call   *%rax
+  80173e:	89 c2                	mov    %eax,%edx
+  801740:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  801746:	48 89 d0             	mov    %rdx,%rax
+  801749:	48 c1 e0 04          	shl    $0x4,%rax
+  80174d:	48 29 d0             	sub    %rdx,%rax
+  801750:	48 c1 e0 05          	shl    $0x5,%rax
+  801754:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80175b:	00 00 00 
+  80175e:	48 01 d0             	add    %rdx,%rax
+  801761:	48 a3 00 00 81 00 00 	movabs %rax,0x810000
+  801768:	00 00 00 
+        return 0;
+  80176b:	eb bd                	jmp    80172a <fork+0x9f>
+		return -1;
+  80176d:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801773:	eb b5                	jmp    80172a <fork+0x9f>
+		return -1;
+  801775:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  80177b:	eb ad                	jmp    80172a <fork+0x9f>
+
+000000000080177d <sfork>:
+
+envid_t
+sfork() {
+  80177d:	55                   	push   %rbp
+  80177e:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  801781:	48 ba a5 4f 80 00 00 	movabs $0x804fa5,%rdx
+  801788:	00 00 00 
+  80178b:	be 2d 00 00 00       	mov    $0x2d,%esi
+  801790:	48 bf c0 4f 80 00 00 	movabs $0x804fc0,%rdi
+  801797:	00 00 00 
+  80179a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80179f:	48 b9 84 02 80 00 00 	movabs $0x800284,%rcx
+  8017a6:	00 00 00 
+  8017a9:	ff d1                	call   *%rcx
+
+00000000008017ab <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8017ab:	55                   	push   %rbp
+  8017ac:	48 89 e5             	mov    %rsp,%rbp
+  8017af:	41 55                	push   %r13
+  8017b1:	41 54                	push   %r12
+  8017b3:	53                   	push   %rbx
+  8017b4:	48 83 ec 08          	sub    $0x8,%rsp
+  8017b8:	49 89 fd             	mov    %rdi,%r13
+  8017bb:	48 89 f7             	mov    %rsi,%rdi
+  8017be:	48 89 d3             	mov    %rdx,%rbx
+  8017c1:	49 89 cc             	mov    %rcx,%r12
+  8017c4:	4c 89 c2             	mov    %r8,%rdx
+  8017c7:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8017ca:	48 85 f6             	test   %rsi,%rsi
+  8017cd:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8017d4:	00 00 00 
+  8017d7:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  8017db:	be 00 10 00 00       	mov    $0x1000,%esi
+  8017e0:	48 85 db             	test   %rbx,%rbx
+  8017e3:	74 03                	je     8017e8 <ipc_recv_futex+0x3d>
+  8017e5:	48 8b 33             	mov    (%rbx),%rsi
+  8017e8:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  8017ec:	48 b8 a2 14 80 00 00 	movabs $0x8014a2,%rax
+  8017f3:	00 00 00 
+  8017f6:	ff d0                	call   *%rax
+    if (res < 0) {
+  8017f8:	85 c0                	test   %eax,%eax
+  8017fa:	78 75                	js     801871 <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  8017fc:	4d 85 ed             	test   %r13,%r13
+  8017ff:	74 14                	je     801815 <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  801801:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801808:	00 00 00 
+  80180b:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  801811:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  801815:	4d 85 e4             	test   %r12,%r12
+  801818:	74 14                	je     80182e <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  80181a:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801821:	00 00 00 
+  801824:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  80182a:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  80182e:	48 85 db             	test   %rbx,%rbx
+  801831:	74 23                	je     801856 <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  801833:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80183a:	00 00 00 
+  80183d:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  801843:	ba 00 00 00 00       	mov    $0x0,%edx
+  801848:	85 c9                	test   %ecx,%ecx
+  80184a:	74 07                	je     801853 <ipc_recv_futex+0xa8>
+  80184c:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  801853:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  801856:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80185d:	00 00 00 
+  801860:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  801866:	48 83 c4 08          	add    $0x8,%rsp
+  80186a:	5b                   	pop    %rbx
+  80186b:	41 5c                	pop    %r12
+  80186d:	41 5d                	pop    %r13
+  80186f:	5d                   	pop    %rbp
+  801870:	c3                   	ret
+        if (from_env_store != NULL) {
+  801871:	4d 85 ed             	test   %r13,%r13
+  801874:	74 08                	je     80187e <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  801876:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80187d:	00 
+        if (perm_store != NULL) {
+  80187e:	4d 85 e4             	test   %r12,%r12
+  801881:	74 08                	je     80188b <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  801883:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80188a:	00 
+        if (size != NULL) {
+  80188b:	48 85 db             	test   %rbx,%rbx
+  80188e:	74 d6                	je     801866 <ipc_recv_futex+0xbb>
+            *size = 0;
+  801890:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  801897:	eb cd                	jmp    801866 <ipc_recv_futex+0xbb>
+
+0000000000801899 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  801899:	55                   	push   %rbp
+  80189a:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  80189d:	48 83 ec 08          	sub    $0x8,%rsp
+  8018a1:	6a 00                	push   $0x0
+  8018a3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8018a9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8018af:	48 b8 ab 17 80 00 00 	movabs $0x8017ab,%rax
+  8018b6:	00 00 00 
+  8018b9:	ff d0                	call   *%rax
+}
+  8018bb:	c9                   	leave
+  8018bc:	c3                   	ret
+
+00000000008018bd <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8018bd:	55                   	push   %rbp
+  8018be:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8018c1:	48 85 d2             	test   %rdx,%rdx
+  8018c4:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8018cb:	00 00 00 
+  8018ce:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  8018d2:	89 f6                	mov    %esi,%esi
+  8018d4:	48 b8 8b 14 80 00 00 	movabs $0x80148b,%rax
+  8018db:	00 00 00 
+  8018de:	ff d0                	call   *%rax
+    if (res < 0) {
+  8018e0:	85 c0                	test   %eax,%eax
+  8018e2:	78 02                	js     8018e6 <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  8018e4:	5d                   	pop    %rbp
+  8018e5:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  8018e6:	89 c1                	mov    %eax,%ecx
+  8018e8:	48 ba cb 4f 80 00 00 	movabs $0x804fcb,%rdx
+  8018ef:	00 00 00 
+  8018f2:	be 50 00 00 00       	mov    $0x50,%esi
+  8018f7:	48 bf df 4f 80 00 00 	movabs $0x804fdf,%rdi
+  8018fe:	00 00 00 
+  801901:	b8 00 00 00 00       	mov    $0x0,%eax
+  801906:	49 b8 84 02 80 00 00 	movabs $0x800284,%r8
+  80190d:	00 00 00 
+  801910:	41 ff d0             	call   *%r8
+
+0000000000801913 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  801913:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  801918:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80191f:	00 00 00 
+  801922:	48 89 d0             	mov    %rdx,%rax
+  801925:	48 c1 e0 04          	shl    $0x4,%rax
+  801929:	48 29 d0             	sub    %rdx,%rax
+  80192c:	48 c1 e0 05          	shl    $0x5,%rax
+  801930:	48 01 c8             	add    %rcx,%rax
+  801933:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  801939:	39 f8                	cmp    %edi,%eax
+  80193b:	74 13                	je     801950 <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  80193d:	48 83 c2 01          	add    $0x1,%rdx
+  801941:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  801948:	75 d8                	jne    801922 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80194a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80194f:	c3                   	ret
+            return envs[i].env_id;
+  801950:	48 89 d0             	mov    %rdx,%rax
+  801953:	48 c1 e0 04          	shl    $0x4,%rax
+  801957:	48 29 d0             	sub    %rdx,%rax
+  80195a:	48 c1 e0 05          	shl    $0x5,%rax
+  80195e:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801965:	00 00 00 
+  801968:	48 01 d0             	add    %rdx,%rax
+  80196b:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801971:	c3                   	ret
+
+0000000000801972 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801972:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801979:	ff ff ff 
+  80197c:	48 01 f8             	add    %rdi,%rax
+  80197f:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801983:	c3                   	ret
+
+0000000000801984 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801984:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80198b:	ff ff ff 
+  80198e:	48 01 f8             	add    %rdi,%rax
+  801991:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801995:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  80199b:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80199f:	c3                   	ret
+
+00000000008019a0 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8019a0:	55                   	push   %rbp
+  8019a1:	48 89 e5             	mov    %rsp,%rbp
+  8019a4:	41 57                	push   %r15
+  8019a6:	41 56                	push   %r14
+  8019a8:	41 55                	push   %r13
+  8019aa:	41 54                	push   %r12
+  8019ac:	53                   	push   %rbx
+  8019ad:	48 83 ec 08          	sub    $0x8,%rsp
+  8019b1:	49 89 ff             	mov    %rdi,%r15
+  8019b4:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8019b9:	49 bd 2f 41 80 00 00 	movabs $0x80412f,%r13
+  8019c0:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8019c3:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8019c9:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8019cc:	48 89 df             	mov    %rbx,%rdi
+  8019cf:	41 ff d5             	call   *%r13
+  8019d2:	83 e0 04             	and    $0x4,%eax
+  8019d5:	74 17                	je     8019ee <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8019d7:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8019de:	4c 39 f3             	cmp    %r14,%rbx
+  8019e1:	75 e6                	jne    8019c9 <fd_alloc+0x29>
+  8019e3:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8019e9:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8019ee:	4d 89 27             	mov    %r12,(%r15)
+}
+  8019f1:	48 83 c4 08          	add    $0x8,%rsp
+  8019f5:	5b                   	pop    %rbx
+  8019f6:	41 5c                	pop    %r12
+  8019f8:	41 5d                	pop    %r13
+  8019fa:	41 5e                	pop    %r14
+  8019fc:	41 5f                	pop    %r15
+  8019fe:	5d                   	pop    %rbp
+  8019ff:	c3                   	ret
+
+0000000000801a00 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801a00:	83 ff 1f             	cmp    $0x1f,%edi
+  801a03:	77 39                	ja     801a3e <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801a05:	55                   	push   %rbp
+  801a06:	48 89 e5             	mov    %rsp,%rbp
+  801a09:	41 54                	push   %r12
+  801a0b:	53                   	push   %rbx
+  801a0c:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801a0f:	48 63 df             	movslq %edi,%rbx
+  801a12:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801a19:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801a1d:	48 89 df             	mov    %rbx,%rdi
+  801a20:	48 b8 2f 41 80 00 00 	movabs $0x80412f,%rax
+  801a27:	00 00 00 
+  801a2a:	ff d0                	call   *%rax
+  801a2c:	a8 04                	test   $0x4,%al
+  801a2e:	74 14                	je     801a44 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801a30:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801a34:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a39:	5b                   	pop    %rbx
+  801a3a:	41 5c                	pop    %r12
+  801a3c:	5d                   	pop    %rbp
+  801a3d:	c3                   	ret
+        return -E_INVAL;
+  801a3e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801a43:	c3                   	ret
+        return -E_INVAL;
+  801a44:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a49:	eb ee                	jmp    801a39 <fd_lookup+0x39>
+
+0000000000801a4b <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801a4b:	55                   	push   %rbp
+  801a4c:	48 89 e5             	mov    %rsp,%rbp
+  801a4f:	41 54                	push   %r12
+  801a51:	53                   	push   %rbx
+  801a52:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801a55:	48 b8 80 50 80 00 00 	movabs $0x805080,%rax
+  801a5c:	00 00 00 
+  801a5f:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  801a66:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801a69:	39 3b                	cmp    %edi,(%rbx)
+  801a6b:	74 47                	je     801ab4 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801a6d:	48 83 c0 08          	add    $0x8,%rax
+  801a71:	48 8b 18             	mov    (%rax),%rbx
+  801a74:	48 85 db             	test   %rbx,%rbx
+  801a77:	75 f0                	jne    801a69 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801a79:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801a80:	00 00 00 
+  801a83:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801a89:	89 fa                	mov    %edi,%edx
+  801a8b:	48 bf f0 4f 80 00 00 	movabs $0x804ff0,%rdi
+  801a92:	00 00 00 
+  801a95:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a9a:	48 b9 d4 03 80 00 00 	movabs $0x8003d4,%rcx
+  801aa1:	00 00 00 
+  801aa4:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801aa6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801aab:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801aaf:	5b                   	pop    %rbx
+  801ab0:	41 5c                	pop    %r12
+  801ab2:	5d                   	pop    %rbp
+  801ab3:	c3                   	ret
+            return 0;
+  801ab4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ab9:	eb f0                	jmp    801aab <dev_lookup+0x60>
+
+0000000000801abb <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801abb:	55                   	push   %rbp
+  801abc:	48 89 e5             	mov    %rsp,%rbp
+  801abf:	41 55                	push   %r13
+  801ac1:	41 54                	push   %r12
+  801ac3:	53                   	push   %rbx
+  801ac4:	48 83 ec 18          	sub    $0x18,%rsp
+  801ac8:	48 89 fb             	mov    %rdi,%rbx
+  801acb:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801ace:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801ad5:	ff ff ff 
+  801ad8:	48 01 df             	add    %rbx,%rdi
+  801adb:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801adf:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ae3:	48 b8 00 1a 80 00 00 	movabs $0x801a00,%rax
+  801aea:	00 00 00 
+  801aed:	ff d0                	call   *%rax
+  801aef:	41 89 c5             	mov    %eax,%r13d
+  801af2:	85 c0                	test   %eax,%eax
+  801af4:	78 06                	js     801afc <fd_close+0x41>
+  801af6:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801afa:	74 1a                	je     801b16 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801afc:	45 84 e4             	test   %r12b,%r12b
+  801aff:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b04:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801b08:	44 89 e8             	mov    %r13d,%eax
+  801b0b:	48 83 c4 18          	add    $0x18,%rsp
+  801b0f:	5b                   	pop    %rbx
+  801b10:	41 5c                	pop    %r12
+  801b12:	41 5d                	pop    %r13
+  801b14:	5d                   	pop    %rbp
+  801b15:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801b16:	8b 3b                	mov    (%rbx),%edi
+  801b18:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801b1c:	48 b8 4b 1a 80 00 00 	movabs $0x801a4b,%rax
+  801b23:	00 00 00 
+  801b26:	ff d0                	call   *%rax
+  801b28:	41 89 c5             	mov    %eax,%r13d
+  801b2b:	85 c0                	test   %eax,%eax
+  801b2d:	78 1b                	js     801b4a <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801b2f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b33:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801b37:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801b3d:	48 85 c0             	test   %rax,%rax
+  801b40:	74 08                	je     801b4a <fd_close+0x8f>
+  801b42:	48 89 df             	mov    %rbx,%rdi
+  801b45:	ff d0                	call   *%rax
+  801b47:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801b4a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801b4f:	48 89 de             	mov    %rbx,%rsi
+  801b52:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b57:	48 b8 fe 12 80 00 00 	movabs $0x8012fe,%rax
+  801b5e:	00 00 00 
+  801b61:	ff d0                	call   *%rax
+    return res;
+  801b63:	eb a3                	jmp    801b08 <fd_close+0x4d>
+
+0000000000801b65 <close>:
+
+int
+close(int fdnum) {
+  801b65:	55                   	push   %rbp
+  801b66:	48 89 e5             	mov    %rsp,%rbp
+  801b69:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801b6d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801b71:	48 b8 00 1a 80 00 00 	movabs $0x801a00,%rax
+  801b78:	00 00 00 
+  801b7b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801b7d:	85 c0                	test   %eax,%eax
+  801b7f:	78 15                	js     801b96 <close+0x31>
+
+    return fd_close(fd, 1);
+  801b81:	be 01 00 00 00       	mov    $0x1,%esi
+  801b86:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801b8a:	48 b8 bb 1a 80 00 00 	movabs $0x801abb,%rax
+  801b91:	00 00 00 
+  801b94:	ff d0                	call   *%rax
+}
+  801b96:	c9                   	leave
+  801b97:	c3                   	ret
+
+0000000000801b98 <close_all>:
+
+void
+close_all(void) {
+  801b98:	55                   	push   %rbp
+  801b99:	48 89 e5             	mov    %rsp,%rbp
+  801b9c:	41 54                	push   %r12
+  801b9e:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801b9f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ba4:	49 bc 65 1b 80 00 00 	movabs $0x801b65,%r12
+  801bab:	00 00 00 
+  801bae:	89 df                	mov    %ebx,%edi
+  801bb0:	41 ff d4             	call   *%r12
+  801bb3:	83 c3 01             	add    $0x1,%ebx
+  801bb6:	83 fb 20             	cmp    $0x20,%ebx
+  801bb9:	75 f3                	jne    801bae <close_all+0x16>
+}
+  801bbb:	5b                   	pop    %rbx
+  801bbc:	41 5c                	pop    %r12
+  801bbe:	5d                   	pop    %rbp
+  801bbf:	c3                   	ret
+
+0000000000801bc0 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801bc0:	55                   	push   %rbp
+  801bc1:	48 89 e5             	mov    %rsp,%rbp
+  801bc4:	41 57                	push   %r15
+  801bc6:	41 56                	push   %r14
+  801bc8:	41 55                	push   %r13
+  801bca:	41 54                	push   %r12
+  801bcc:	53                   	push   %rbx
+  801bcd:	48 83 ec 18          	sub    $0x18,%rsp
+  801bd1:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801bd4:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801bd8:	48 b8 00 1a 80 00 00 	movabs $0x801a00,%rax
+  801bdf:	00 00 00 
+  801be2:	ff d0                	call   *%rax
+  801be4:	89 c3                	mov    %eax,%ebx
+  801be6:	85 c0                	test   %eax,%eax
+  801be8:	0f 88 b8 00 00 00    	js     801ca6 <dup+0xe6>
+    close(newfdnum);
+  801bee:	44 89 e7             	mov    %r12d,%edi
+  801bf1:	48 b8 65 1b 80 00 00 	movabs $0x801b65,%rax
+  801bf8:	00 00 00 
+  801bfb:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801bfd:	4d 63 ec             	movslq %r12d,%r13
+  801c00:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801c07:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801c0b:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801c0f:	4c 89 ff             	mov    %r15,%rdi
+  801c12:	49 be 84 19 80 00 00 	movabs $0x801984,%r14
+  801c19:	00 00 00 
+  801c1c:	41 ff d6             	call   *%r14
+  801c1f:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801c22:	4c 89 ef             	mov    %r13,%rdi
+  801c25:	41 ff d6             	call   *%r14
+  801c28:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801c2b:	48 89 df             	mov    %rbx,%rdi
+  801c2e:	48 b8 2f 41 80 00 00 	movabs $0x80412f,%rax
+  801c35:	00 00 00 
+  801c38:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801c3a:	a8 04                	test   $0x4,%al
+  801c3c:	74 2b                	je     801c69 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801c3e:	41 89 c1             	mov    %eax,%r9d
+  801c41:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c47:	4c 89 f1             	mov    %r14,%rcx
+  801c4a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c4f:	48 89 de             	mov    %rbx,%rsi
+  801c52:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c57:	48 b8 ae 12 80 00 00 	movabs $0x8012ae,%rax
+  801c5e:	00 00 00 
+  801c61:	ff d0                	call   *%rax
+  801c63:	89 c3                	mov    %eax,%ebx
+  801c65:	85 c0                	test   %eax,%eax
+  801c67:	78 4e                	js     801cb7 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801c69:	4c 89 ff             	mov    %r15,%rdi
+  801c6c:	48 b8 2f 41 80 00 00 	movabs $0x80412f,%rax
+  801c73:	00 00 00 
+  801c76:	ff d0                	call   *%rax
+  801c78:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801c7b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c81:	4c 89 e9             	mov    %r13,%rcx
+  801c84:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c89:	4c 89 fe             	mov    %r15,%rsi
+  801c8c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c91:	48 b8 ae 12 80 00 00 	movabs $0x8012ae,%rax
+  801c98:	00 00 00 
+  801c9b:	ff d0                	call   *%rax
+  801c9d:	89 c3                	mov    %eax,%ebx
+  801c9f:	85 c0                	test   %eax,%eax
+  801ca1:	78 14                	js     801cb7 <dup+0xf7>
+
+    return newfdnum;
+  801ca3:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801ca6:	89 d8                	mov    %ebx,%eax
+  801ca8:	48 83 c4 18          	add    $0x18,%rsp
+  801cac:	5b                   	pop    %rbx
+  801cad:	41 5c                	pop    %r12
+  801caf:	41 5d                	pop    %r13
+  801cb1:	41 5e                	pop    %r14
+  801cb3:	41 5f                	pop    %r15
+  801cb5:	5d                   	pop    %rbp
+  801cb6:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801cb7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801cbc:	4c 89 ee             	mov    %r13,%rsi
+  801cbf:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cc4:	49 bc fe 12 80 00 00 	movabs $0x8012fe,%r12
+  801ccb:	00 00 00 
+  801cce:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801cd1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801cd6:	4c 89 f6             	mov    %r14,%rsi
+  801cd9:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cde:	41 ff d4             	call   *%r12
+    return res;
+  801ce1:	eb c3                	jmp    801ca6 <dup+0xe6>
+
+0000000000801ce3 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801ce3:	55                   	push   %rbp
+  801ce4:	48 89 e5             	mov    %rsp,%rbp
+  801ce7:	41 56                	push   %r14
+  801ce9:	41 55                	push   %r13
+  801ceb:	41 54                	push   %r12
+  801ced:	53                   	push   %rbx
+  801cee:	48 83 ec 10          	sub    $0x10,%rsp
+  801cf2:	89 fb                	mov    %edi,%ebx
+  801cf4:	49 89 f4             	mov    %rsi,%r12
+  801cf7:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801cfa:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801cfe:	48 b8 00 1a 80 00 00 	movabs $0x801a00,%rax
+  801d05:	00 00 00 
+  801d08:	ff d0                	call   *%rax
+  801d0a:	85 c0                	test   %eax,%eax
+  801d0c:	78 4c                	js     801d5a <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d0e:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801d12:	41 8b 3e             	mov    (%r14),%edi
+  801d15:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d19:	48 b8 4b 1a 80 00 00 	movabs $0x801a4b,%rax
+  801d20:	00 00 00 
+  801d23:	ff d0                	call   *%rax
+  801d25:	85 c0                	test   %eax,%eax
+  801d27:	78 35                	js     801d5e <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801d29:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801d2d:	83 e0 03             	and    $0x3,%eax
+  801d30:	83 f8 01             	cmp    $0x1,%eax
+  801d33:	74 2d                	je     801d62 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801d35:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d39:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801d3d:	48 85 c0             	test   %rax,%rax
+  801d40:	74 56                	je     801d98 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801d42:	4c 89 ea             	mov    %r13,%rdx
+  801d45:	4c 89 e6             	mov    %r12,%rsi
+  801d48:	4c 89 f7             	mov    %r14,%rdi
+  801d4b:	ff d0                	call   *%rax
+}
+  801d4d:	48 83 c4 10          	add    $0x10,%rsp
+  801d51:	5b                   	pop    %rbx
+  801d52:	41 5c                	pop    %r12
+  801d54:	41 5d                	pop    %r13
+  801d56:	41 5e                	pop    %r14
+  801d58:	5d                   	pop    %rbp
+  801d59:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d5a:	48 98                	cltq
+  801d5c:	eb ef                	jmp    801d4d <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d5e:	48 98                	cltq
+  801d60:	eb eb                	jmp    801d4d <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d62:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801d69:	00 00 00 
+  801d6c:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801d72:	89 da                	mov    %ebx,%edx
+  801d74:	48 bf 31 50 80 00 00 	movabs $0x805031,%rdi
+  801d7b:	00 00 00 
+  801d7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d83:	48 b9 d4 03 80 00 00 	movabs $0x8003d4,%rcx
+  801d8a:	00 00 00 
+  801d8d:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801d8f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801d96:	eb b5                	jmp    801d4d <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801d98:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801d9f:	eb ac                	jmp    801d4d <read+0x6a>
+
+0000000000801da1 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801da1:	55                   	push   %rbp
+  801da2:	48 89 e5             	mov    %rsp,%rbp
+  801da5:	41 57                	push   %r15
+  801da7:	41 56                	push   %r14
+  801da9:	41 55                	push   %r13
+  801dab:	41 54                	push   %r12
+  801dad:	53                   	push   %rbx
+  801dae:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801db2:	48 85 d2             	test   %rdx,%rdx
+  801db5:	74 54                	je     801e0b <readn+0x6a>
+  801db7:	41 89 fd             	mov    %edi,%r13d
+  801dba:	49 89 f6             	mov    %rsi,%r14
+  801dbd:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801dc0:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801dc5:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801dca:	49 bf e3 1c 80 00 00 	movabs $0x801ce3,%r15
+  801dd1:	00 00 00 
+  801dd4:	4c 89 e2             	mov    %r12,%rdx
+  801dd7:	48 29 f2             	sub    %rsi,%rdx
+  801dda:	4c 01 f6             	add    %r14,%rsi
+  801ddd:	44 89 ef             	mov    %r13d,%edi
+  801de0:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801de3:	85 c0                	test   %eax,%eax
+  801de5:	78 20                	js     801e07 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801de7:	01 c3                	add    %eax,%ebx
+  801de9:	85 c0                	test   %eax,%eax
+  801deb:	74 08                	je     801df5 <readn+0x54>
+  801ded:	48 63 f3             	movslq %ebx,%rsi
+  801df0:	4c 39 e6             	cmp    %r12,%rsi
+  801df3:	72 df                	jb     801dd4 <readn+0x33>
+    }
+    return res;
+  801df5:	48 63 c3             	movslq %ebx,%rax
+}
+  801df8:	48 83 c4 08          	add    $0x8,%rsp
+  801dfc:	5b                   	pop    %rbx
+  801dfd:	41 5c                	pop    %r12
+  801dff:	41 5d                	pop    %r13
+  801e01:	41 5e                	pop    %r14
+  801e03:	41 5f                	pop    %r15
+  801e05:	5d                   	pop    %rbp
+  801e06:	c3                   	ret
+        if (inc < 0) return inc;
+  801e07:	48 98                	cltq
+  801e09:	eb ed                	jmp    801df8 <readn+0x57>
+    int inc = 1, res = 0;
+  801e0b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e10:	eb e3                	jmp    801df5 <readn+0x54>
+
+0000000000801e12 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801e12:	55                   	push   %rbp
+  801e13:	48 89 e5             	mov    %rsp,%rbp
+  801e16:	41 56                	push   %r14
+  801e18:	41 55                	push   %r13
+  801e1a:	41 54                	push   %r12
+  801e1c:	53                   	push   %rbx
+  801e1d:	48 83 ec 10          	sub    $0x10,%rsp
+  801e21:	89 fb                	mov    %edi,%ebx
+  801e23:	49 89 f4             	mov    %rsi,%r12
+  801e26:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e29:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e2d:	48 b8 00 1a 80 00 00 	movabs $0x801a00,%rax
+  801e34:	00 00 00 
+  801e37:	ff d0                	call   *%rax
+  801e39:	85 c0                	test   %eax,%eax
+  801e3b:	78 47                	js     801e84 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e3d:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801e41:	41 8b 3e             	mov    (%r14),%edi
+  801e44:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e48:	48 b8 4b 1a 80 00 00 	movabs $0x801a4b,%rax
+  801e4f:	00 00 00 
+  801e52:	ff d0                	call   *%rax
+  801e54:	85 c0                	test   %eax,%eax
+  801e56:	78 30                	js     801e88 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e58:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801e5d:	74 2d                	je     801e8c <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801e5f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e63:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801e67:	48 85 c0             	test   %rax,%rax
+  801e6a:	74 56                	je     801ec2 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801e6c:	4c 89 ea             	mov    %r13,%rdx
+  801e6f:	4c 89 e6             	mov    %r12,%rsi
+  801e72:	4c 89 f7             	mov    %r14,%rdi
+  801e75:	ff d0                	call   *%rax
+}
+  801e77:	48 83 c4 10          	add    $0x10,%rsp
+  801e7b:	5b                   	pop    %rbx
+  801e7c:	41 5c                	pop    %r12
+  801e7e:	41 5d                	pop    %r13
+  801e80:	41 5e                	pop    %r14
+  801e82:	5d                   	pop    %rbp
+  801e83:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e84:	48 98                	cltq
+  801e86:	eb ef                	jmp    801e77 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e88:	48 98                	cltq
+  801e8a:	eb eb                	jmp    801e77 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e8c:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801e93:	00 00 00 
+  801e96:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801e9c:	89 da                	mov    %ebx,%edx
+  801e9e:	48 bf 4d 50 80 00 00 	movabs $0x80504d,%rdi
+  801ea5:	00 00 00 
+  801ea8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ead:	48 b9 d4 03 80 00 00 	movabs $0x8003d4,%rcx
+  801eb4:	00 00 00 
+  801eb7:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801eb9:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801ec0:	eb b5                	jmp    801e77 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801ec2:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801ec9:	eb ac                	jmp    801e77 <write+0x65>
+
+0000000000801ecb <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801ecb:	55                   	push   %rbp
+  801ecc:	48 89 e5             	mov    %rsp,%rbp
+  801ecf:	41 54                	push   %r12
+  801ed1:	53                   	push   %rbx
+  801ed2:	48 83 ec 10          	sub    $0x10,%rsp
+  801ed6:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ed8:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801edc:	48 b8 00 1a 80 00 00 	movabs $0x801a00,%rax
+  801ee3:	00 00 00 
+  801ee6:	ff d0                	call   *%rax
+  801ee8:	85 c0                	test   %eax,%eax
+  801eea:	78 3e                	js     801f2a <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801eec:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801ef0:	41 8b 3c 24          	mov    (%r12),%edi
+  801ef4:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801ef8:	48 b8 4b 1a 80 00 00 	movabs $0x801a4b,%rax
+  801eff:	00 00 00 
+  801f02:	ff d0                	call   *%rax
+  801f04:	85 c0                	test   %eax,%eax
+  801f06:	78 22                	js     801f2a <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  801f08:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801f0c:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801f10:	48 85 c0             	test   %rax,%rax
+  801f13:	74 0b                	je     801f20 <seek+0x55>
+  801f15:	89 de                	mov    %ebx,%esi
+  801f17:	4c 89 e7             	mov    %r12,%rdi
+  801f1a:	ff d0                	call   *%rax
+  801f1c:	85 c0                	test   %eax,%eax
+  801f1e:	78 0a                	js     801f2a <seek+0x5f>
+
+    fd->fd_offset = offset;
+  801f20:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  801f25:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f2a:	48 83 c4 10          	add    $0x10,%rsp
+  801f2e:	5b                   	pop    %rbx
+  801f2f:	41 5c                	pop    %r12
+  801f31:	5d                   	pop    %rbp
+  801f32:	c3                   	ret
+
+0000000000801f33 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801f33:	55                   	push   %rbp
+  801f34:	48 89 e5             	mov    %rsp,%rbp
+  801f37:	41 55                	push   %r13
+  801f39:	41 54                	push   %r12
+  801f3b:	53                   	push   %rbx
+  801f3c:	48 83 ec 18          	sub    $0x18,%rsp
+  801f40:	89 fb                	mov    %edi,%ebx
+  801f42:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f45:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f49:	48 b8 00 1a 80 00 00 	movabs $0x801a00,%rax
+  801f50:	00 00 00 
+  801f53:	ff d0                	call   *%rax
+  801f55:	85 c0                	test   %eax,%eax
+  801f57:	78 38                	js     801f91 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f59:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801f5d:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801f61:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f65:	48 b8 4b 1a 80 00 00 	movabs $0x801a4b,%rax
+  801f6c:	00 00 00 
+  801f6f:	ff d0                	call   *%rax
+  801f71:	85 c0                	test   %eax,%eax
+  801f73:	78 1c                	js     801f91 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801f75:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801f7a:	74 20                	je     801f9c <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801f7c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f80:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801f84:	48 85 c0             	test   %rax,%rax
+  801f87:	74 47                	je     801fd0 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801f89:	44 89 e6             	mov    %r12d,%esi
+  801f8c:	4c 89 ef             	mov    %r13,%rdi
+  801f8f:	ff d0                	call   *%rax
+}
+  801f91:	48 83 c4 18          	add    $0x18,%rsp
+  801f95:	5b                   	pop    %rbx
+  801f96:	41 5c                	pop    %r12
+  801f98:	41 5d                	pop    %r13
+  801f9a:	5d                   	pop    %rbp
+  801f9b:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801f9c:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801fa3:	00 00 00 
+  801fa6:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801fac:	89 da                	mov    %ebx,%edx
+  801fae:	48 bf 10 50 80 00 00 	movabs $0x805010,%rdi
+  801fb5:	00 00 00 
+  801fb8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fbd:	48 b9 d4 03 80 00 00 	movabs $0x8003d4,%rcx
+  801fc4:	00 00 00 
+  801fc7:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801fc9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801fce:	eb c1                	jmp    801f91 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801fd0:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801fd5:	eb ba                	jmp    801f91 <ftruncate+0x5e>
+
+0000000000801fd7 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801fd7:	55                   	push   %rbp
+  801fd8:	48 89 e5             	mov    %rsp,%rbp
+  801fdb:	41 54                	push   %r12
+  801fdd:	53                   	push   %rbx
+  801fde:	48 83 ec 10          	sub    $0x10,%rsp
+  801fe2:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801fe5:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801fe9:	48 b8 00 1a 80 00 00 	movabs $0x801a00,%rax
+  801ff0:	00 00 00 
+  801ff3:	ff d0                	call   *%rax
+  801ff5:	85 c0                	test   %eax,%eax
+  801ff7:	78 4e                	js     802047 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ff9:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801ffd:	41 8b 3c 24          	mov    (%r12),%edi
+  802001:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802005:	48 b8 4b 1a 80 00 00 	movabs $0x801a4b,%rax
+  80200c:	00 00 00 
+  80200f:	ff d0                	call   *%rax
+  802011:	85 c0                	test   %eax,%eax
+  802013:	78 32                	js     802047 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802015:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802019:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80201e:	74 30                	je     802050 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802020:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802023:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80202a:	00 00 00 
+    stat->st_isdir = 0;
+  80202d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802034:	00 00 00 
+    stat->st_dev = dev;
+  802037:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80203e:	48 89 de             	mov    %rbx,%rsi
+  802041:	4c 89 e7             	mov    %r12,%rdi
+  802044:	ff 50 28             	call   *0x28(%rax)
+}
+  802047:	48 83 c4 10          	add    $0x10,%rsp
+  80204b:	5b                   	pop    %rbx
+  80204c:	41 5c                	pop    %r12
+  80204e:	5d                   	pop    %rbp
+  80204f:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802050:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802055:	eb f0                	jmp    802047 <fstat+0x70>
+
+0000000000802057 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802057:	55                   	push   %rbp
+  802058:	48 89 e5             	mov    %rsp,%rbp
+  80205b:	41 54                	push   %r12
+  80205d:	53                   	push   %rbx
+  80205e:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802061:	be 00 00 00 00       	mov    $0x0,%esi
+  802066:	48 b8 c5 31 80 00 00 	movabs $0x8031c5,%rax
+  80206d:	00 00 00 
+  802070:	ff d0                	call   *%rax
+  802072:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802074:	85 c0                	test   %eax,%eax
+  802076:	78 25                	js     80209d <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802078:	4c 89 e6             	mov    %r12,%rsi
+  80207b:	89 c7                	mov    %eax,%edi
+  80207d:	48 b8 d7 1f 80 00 00 	movabs $0x801fd7,%rax
+  802084:	00 00 00 
+  802087:	ff d0                	call   *%rax
+  802089:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80208c:	89 df                	mov    %ebx,%edi
+  80208e:	48 b8 65 1b 80 00 00 	movabs $0x801b65,%rax
+  802095:	00 00 00 
+  802098:	ff d0                	call   *%rax
+
+    return res;
+  80209a:	44 89 e3             	mov    %r12d,%ebx
+}
+  80209d:	89 d8                	mov    %ebx,%eax
+  80209f:	5b                   	pop    %rbx
+  8020a0:	41 5c                	pop    %r12
+  8020a2:	5d                   	pop    %rbp
+  8020a3:	c3                   	ret
+
+00000000008020a4 <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  8020a4:	48 b8 08 00 82 00 00 	movabs $0x820008,%rax
+  8020ab:	00 00 00 
+  8020ae:	83 38 00             	cmpl   $0x0,(%rax)
+  8020b1:	74 0a                	je     8020bd <fsenv+0x19>
+    return envid;
+}
+  8020b3:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  8020ba:	00 00 
+  8020bc:	c3                   	ret
+fsenv(void) {
+  8020bd:	55                   	push   %rbp
+  8020be:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  8020c1:	bf 03 00 00 00       	mov    $0x3,%edi
+  8020c6:	48 b8 13 19 80 00 00 	movabs $0x801913,%rax
+  8020cd:	00 00 00 
+  8020d0:	ff d0                	call   *%rax
+  8020d2:	a3 08 00 82 00 00 00 	movabs %eax,0x820008
+  8020d9:	00 00 
+}
+  8020db:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  8020e2:	00 00 
+  8020e4:	5d                   	pop    %rbp
+  8020e5:	c3                   	ret
+
+00000000008020e6 <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  8020e6:	55                   	push   %rbp
+  8020e7:	48 89 e5             	mov    %rsp,%rbp
+  8020ea:	41 54                	push   %r12
+  8020ec:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  8020ed:	ba 00 50 00 00       	mov    $0x5000,%edx
+  8020f2:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  8020f7:	48 89 de             	mov    %rbx,%rsi
+  8020fa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020ff:	48 b8 fe 12 80 00 00 	movabs $0x8012fe,%rax
+  802106:	00 00 00 
+  802109:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  80210b:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  802112:	00 00 00 
+  802115:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  80211b:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802120:	ba 00 50 00 00       	mov    $0x5000,%edx
+  802125:	48 89 de             	mov    %rbx,%rsi
+  802128:	bf 00 00 00 00       	mov    $0x0,%edi
+  80212d:	48 b8 58 12 80 00 00 	movabs $0x801258,%rax
+  802134:	00 00 00 
+  802137:	ff d0                	call   *%rax
+  802139:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  80213b:	85 c0                	test   %eax,%eax
+  80213d:	0f 88 a2 00 00 00    	js     8021e5 <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  802143:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80214a:	00 00 00 
+  80214d:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802153:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  802158:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  80215a:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  80215f:	49 bc f7 42 80 00 00 	movabs $0x8042f7,%r12
+  802166:	00 00 00 
+  802169:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  80216c:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  802171:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  802174:	48 b8 a4 20 80 00 00 	movabs $0x8020a4,%rax
+  80217b:	00 00 00 
+  80217e:	ff d0                	call   *%rax
+  802180:	89 c7                	mov    %eax,%edi
+  802182:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  802188:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  80218d:	48 89 da             	mov    %rbx,%rdx
+  802190:	be 09 00 00 00       	mov    $0x9,%esi
+  802195:	48 b8 bd 18 80 00 00 	movabs $0x8018bd,%rax
+  80219c:	00 00 00 
+  80219f:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  8021a1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8021b0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021b5:	48 b8 99 18 80 00 00 	movabs $0x801899,%rax
+  8021bc:	00 00 00 
+  8021bf:	ff d0                	call   *%rax
+  8021c1:	89 c3                	mov    %eax,%ebx
+  8021c3:	85 c0                	test   %eax,%eax
+  8021c5:	78 25                	js     8021ec <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  8021c7:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8021ce:	00 00 00 
+  8021d1:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8021d7:	a3 00 26 82 00 00 00 	movabs %eax,0x822600
+  8021de:	00 00 
+    return 0;
+  8021e0:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  8021e5:	89 d8                	mov    %ebx,%eax
+  8021e7:	5b                   	pop    %rbx
+  8021e8:	41 5c                	pop    %r12
+  8021ea:	5d                   	pop    %rbp
+  8021eb:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  8021ec:	ba 00 50 00 00       	mov    $0x5000,%edx
+  8021f1:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  8021f6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021fb:	48 b8 fe 12 80 00 00 	movabs $0x8012fe,%rax
+  802202:	00 00 00 
+  802205:	ff d0                	call   *%rax
+        return res;
+  802207:	eb dc                	jmp    8021e5 <fschan_setup+0xff>
+
+0000000000802209 <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  802209:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  802210:	00 00 00 
+  802213:	80 38 00             	cmpb   $0x0,(%rax)
+  802216:	74 55                	je     80226d <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802218:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80221f:	00 00 00 
+  802222:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  802228:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  80222d:	48 ba 00 26 82 00 00 	movabs $0x822600,%rdx
+  802234:	00 00 00 
+  802237:	3b 0a                	cmp    (%rdx),%ecx
+  802239:	75 01                	jne    80223c <fschan+0x33>
+}
+  80223b:	c3                   	ret
+fschan(void) {
+  80223c:	55                   	push   %rbp
+  80223d:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802240:	48 b8 e6 20 80 00 00 	movabs $0x8020e6,%rax
+  802247:	00 00 00 
+  80224a:	ff d0                	call   *%rax
+  80224c:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  80224e:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802253:	85 d2                	test   %edx,%edx
+  802255:	78 02                	js     802259 <fschan+0x50>
+}
+  802257:	5d                   	pop    %rbp
+  802258:	c3                   	ret
+        fschan_enabled = 0;
+  802259:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  802260:	00 00 00 
+  802263:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  802266:	b8 00 00 00 00       	mov    $0x0,%eax
+  80226b:	eb ea                	jmp    802257 <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  80226d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802272:	c3                   	ret
+
+0000000000802273 <fbuf>:
+fbuf(struct Fd *fd) {
+  802273:	55                   	push   %rbp
+  802274:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  802277:	48 b8 72 19 80 00 00 	movabs $0x801972,%rax
+  80227e:	00 00 00 
+  802281:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  802283:	ba 00 00 00 00       	mov    $0x0,%edx
+  802288:	48 83 f8 1f          	cmp    $0x1f,%rax
+  80228c:	77 12                	ja     8022a0 <fbuf+0x2d>
+  80228e:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  802292:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802299:	00 00 00 
+  80229c:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  8022a0:	48 89 d0             	mov    %rdx,%rax
+  8022a3:	5d                   	pop    %rbp
+  8022a4:	c3                   	ret
+
+00000000008022a5 <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  8022a5:	55                   	push   %rbp
+  8022a6:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  8022a9:	48 83 c7 40          	add    $0x40,%rdi
+  8022ad:	48 b8 31 43 80 00 00 	movabs $0x804331,%rax
+  8022b4:	00 00 00 
+  8022b7:	ff d0                	call   *%rax
+  8022b9:	84 c0                	test   %al,%al
+  8022bb:	75 02                	jne    8022bf <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  8022bd:	5d                   	pop    %rbp
+  8022be:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  8022bf:	48 b8 a4 20 80 00 00 	movabs $0x8020a4,%rax
+  8022c6:	00 00 00 
+  8022c9:	ff d0                	call   *%rax
+  8022cb:	89 c7                	mov    %eax,%edi
+  8022cd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022d3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022d8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022dd:	be 0a 00 00 00       	mov    $0xa,%esi
+  8022e2:	48 b8 bd 18 80 00 00 	movabs $0x8018bd,%rax
+  8022e9:	00 00 00 
+  8022ec:	ff d0                	call   *%rax
+}
+  8022ee:	eb cd                	jmp    8022bd <fschan_publish+0x18>
+
+00000000008022f0 <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  8022f0:	55                   	push   %rbp
+  8022f1:	48 89 e5             	mov    %rsp,%rbp
+  8022f4:	41 57                	push   %r15
+  8022f6:	41 56                	push   %r14
+  8022f8:	41 55                	push   %r13
+  8022fa:	41 54                	push   %r12
+  8022fc:	53                   	push   %rbx
+  8022fd:	48 83 ec 48          	sub    $0x48,%rsp
+  802301:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802305:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  802309:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  80230c:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  802310:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  802313:	48 ba 04 00 82 00 00 	movabs $0x820004,%rdx
+  80231a:	00 00 00 
+  80231d:	8b 02                	mov    (%rdx),%eax
+  80231f:	83 c0 01             	add    $0x1,%eax
+  802322:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802327:	0f 44 c1             	cmove  %ecx,%eax
+  80232a:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  80232c:	4d 85 c0             	test   %r8,%r8
+  80232f:	74 2c                	je     80235d <fschan_rw+0x6d>
+  802331:	45 89 ce             	mov    %r9d,%r14d
+  802334:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  80233b:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  80233f:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802345:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  80234c:	00 
+  80234d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802353:	b8 01 00 00 00       	mov    $0x1,%eax
+  802358:	e9 41 01 00 00       	jmp    80249e <fschan_rw+0x1ae>
+  80235d:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  802361:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802365:	e9 9c 01 00 00       	jmp    802506 <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  80236a:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80236e:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  802371:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  802374:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  802377:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  80237b:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  80237f:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  802383:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  802387:	48 89 da             	mov    %rbx,%rdx
+  80238a:	48 b8 5a 0f 80 00 00 	movabs $0x800f5a,%rax
+  802391:	00 00 00 
+  802394:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  802396:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80239a:	48 b8 a5 22 80 00 00 	movabs $0x8022a5,%rax
+  8023a1:	00 00 00 
+  8023a4:	ff d0                	call   *%rax
+            queued += blk;
+  8023a6:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  8023a9:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  8023ad:	4d 39 fc             	cmp    %r15,%r12
+  8023b0:	73 6b                	jae    80241d <fschan_rw+0x12d>
+  8023b2:	41 83 fd 0f          	cmp    $0xf,%r13d
+  8023b6:	77 65                	ja     80241d <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  8023b8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8023bc:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  8023c0:	48 b8 0c 43 80 00 00 	movabs $0x80430c,%rax
+  8023c7:	00 00 00 
+  8023ca:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  8023cc:	4c 89 fb             	mov    %r15,%rbx
+  8023cf:	4c 29 e3             	sub    %r12,%rbx
+  8023d2:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  8023d7:	48 39 d3             	cmp    %rdx,%rbx
+  8023da:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  8023de:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  8023e2:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  8023e6:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  8023ea:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  8023ed:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  8023ef:	48 b9 04 00 82 00 00 	movabs $0x820004,%rcx
+  8023f6:	00 00 00 
+  8023f9:	8b 09                	mov    (%rcx),%ecx
+  8023fb:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  8023fe:	83 fe 03             	cmp    $0x3,%esi
+  802401:	0f 85 63 ff ff ff    	jne    80236a <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  802407:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80240b:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  80240e:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  802411:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  802414:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  802418:	e9 79 ff ff ff       	jmp    802396 <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  80241d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802421:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  802428:	48 89 df             	mov    %rbx,%rdi
+  80242b:	48 b8 cf 43 80 00 00 	movabs $0x8043cf,%rax
+  802432:	00 00 00 
+  802435:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  802437:	48 89 df             	mov    %rbx,%rdi
+  80243a:	48 b8 5d 43 80 00 00 	movabs $0x80435d,%rax
+  802441:	00 00 00 
+  802444:	ff d0                	call   *%rax
+  802446:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  80244a:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  80244e:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  802452:	75 25                	jne    802479 <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  802454:	8b 40 04             	mov    0x4(%rax),%eax
+  802457:	85 c0                	test   %eax,%eax
+  802459:	0f 88 86 00 00 00    	js     8024e5 <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  80245f:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  802463:	74 5b                	je     8024c0 <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  802465:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802469:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  80246d:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  802471:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  802475:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  802479:	48 89 df             	mov    %rbx,%rdi
+  80247c:	48 b8 84 43 80 00 00 	movabs $0x804384,%rax
+  802483:	00 00 00 
+  802486:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  802488:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  80248c:	83 f0 01             	xor    $0x1,%eax
+  80248f:	4d 39 fc             	cmp    %r15,%r12
+  802492:	0f 92 c2             	setb   %dl
+  802495:	84 c2                	test   %al,%dl
+  802497:	75 05                	jne    80249e <fschan_rw+0x1ae>
+  802499:	45 85 ed             	test   %r13d,%r13d
+  80249c:	74 50                	je     8024ee <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  80249e:	4d 39 fc             	cmp    %r15,%r12
+  8024a1:	0f 92 c1             	setb   %cl
+  8024a4:	41 83 fd 0f          	cmp    $0xf,%r13d
+  8024a8:	0f 96 c2             	setbe  %dl
+  8024ab:	84 d1                	test   %dl,%cl
+  8024ad:	0f 84 6a ff ff ff    	je     80241d <fschan_rw+0x12d>
+  8024b3:	84 c0                	test   %al,%al
+  8024b5:	0f 85 fd fe ff ff    	jne    8023b8 <fschan_rw+0xc8>
+  8024bb:	e9 5d ff ff ff       	jmp    80241d <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  8024c0:	48 63 d0             	movslq %eax,%rdx
+  8024c3:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8024c7:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  8024cb:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8024cf:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  8024d3:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  8024d7:	48 b8 5a 0f 80 00 00 	movabs $0x800f5a,%rax
+  8024de:	00 00 00 
+  8024e1:	ff d0                	call   *%rax
+  8024e3:	eb 80                	jmp    802465 <fschan_rw+0x175>
+                err = msg->fm_res;
+  8024e5:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  8024e8:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  8024ec:	eb 8b                	jmp    802479 <fschan_rw+0x189>
+    return done || !err ? done : err;
+  8024ee:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  8024f3:	0f 85 68 fe ff ff    	jne    802361 <fschan_rw+0x71>
+  8024f9:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  8024fc:	85 c0                	test   %eax,%eax
+  8024fe:	0f 84 5d fe ff ff    	je     802361 <fschan_rw+0x71>
+  802504:	48 98                	cltq
+}
+  802506:	48 83 c4 48          	add    $0x48,%rsp
+  80250a:	5b                   	pop    %rbx
+  80250b:	41 5c                	pop    %r12
+  80250d:	41 5d                	pop    %r13
+  80250f:	41 5e                	pop    %r14
+  802511:	41 5f                	pop    %r15
+  802513:	5d                   	pop    %rbp
+  802514:	c3                   	ret
+
+0000000000802515 <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  802515:	55                   	push   %rbp
+  802516:	48 89 e5             	mov    %rsp,%rbp
+  802519:	41 56                	push   %r14
+  80251b:	41 55                	push   %r13
+  80251d:	41 54                	push   %r12
+  80251f:	53                   	push   %rbx
+  802520:	48 83 ec 10          	sub    $0x10,%rsp
+  802524:	49 89 fe             	mov    %rdi,%r14
+  802527:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  80252a:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  80252e:	48 29 f3             	sub    %rsi,%rbx
+  802531:	48 39 d3             	cmp    %rdx,%rbx
+  802534:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  802538:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  80253f:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  802540:	bf 00 10 00 00       	mov    $0x1000,%edi
+  802545:	49 bd 8e 41 80 00 00 	movabs $0x80418e,%r13
+  80254c:	00 00 00 
+  80254f:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  802556:	76 1e                	jbe    802576 <mmap_fault+0x61>
+  802558:	4c 01 e7             	add    %r12,%rdi
+  80255b:	41 ff d5             	call   *%r13
+  80255e:	84 c0                	test   %al,%al
+  802560:	75 14                	jne    802576 <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  802562:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802566:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  80256d:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  802571:	48 39 df             	cmp    %rbx,%rdi
+  802574:	72 e2                	jb     802558 <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  802576:	48 bb 00 10 82 00 00 	movabs $0x821000,%rbx
+  80257d:	00 00 00 
+  802580:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  802587:	00 00 00 
+  80258a:	4c 89 f0             	mov    %r14,%rax
+  80258d:	48 29 d0             	sub    %rdx,%rax
+  802590:	48 c1 f8 03          	sar    $0x3,%rax
+  802594:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  80259b:	aa aa aa 
+  80259e:	48 0f af c2          	imul   %rdx,%rax
+  8025a2:	48 c1 e0 0c          	shl    $0xc,%rax
+  8025a6:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  8025ab:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  8025af:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  8025b1:	44 89 e0             	mov    %r12d,%eax
+  8025b4:	41 03 46 10          	add    0x10(%r14),%eax
+  8025b8:	41 2b 06             	sub    (%r14),%eax
+  8025bb:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  8025be:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8025c2:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  8025c6:	41 8b 46 14          	mov    0x14(%r14),%eax
+  8025ca:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  8025cd:	48 b8 a4 20 80 00 00 	movabs $0x8020a4,%rax
+  8025d4:	00 00 00 
+  8025d7:	ff d0                	call   *%rax
+  8025d9:	89 c7                	mov    %eax,%edi
+  8025db:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8025e1:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8025e6:	48 89 da             	mov    %rbx,%rdx
+  8025e9:	be 0f 00 00 00       	mov    $0xf,%esi
+  8025ee:	48 b8 bd 18 80 00 00 	movabs $0x8018bd,%rax
+  8025f5:	00 00 00 
+  8025f8:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  8025fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025ff:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802603:	4c 89 e6             	mov    %r12,%rsi
+  802606:	bf 00 00 00 00       	mov    $0x0,%edi
+  80260b:	48 b8 99 18 80 00 00 	movabs $0x801899,%rax
+  802612:	00 00 00 
+  802615:	ff d0                	call   *%rax
+  802617:	48 98                	cltq
+}
+  802619:	48 83 c4 10          	add    $0x10,%rsp
+  80261d:	5b                   	pop    %rbx
+  80261e:	41 5c                	pop    %r12
+  802620:	41 5d                	pop    %r13
+  802622:	41 5e                	pop    %r14
+  802624:	5d                   	pop    %rbp
+  802625:	c3                   	ret
+
+0000000000802626 <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  802626:	48 8b 37             	mov    (%rdi),%rsi
+  802629:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  802630:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  802637:	00 00 00 
+  80263a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80263f:	eb 0f                	jmp    802650 <mmap_pgfault+0x2a>
+  802641:	c3                   	ret
+  802642:	48 83 c1 01          	add    $0x1,%rcx
+  802646:	48 83 c2 18          	add    $0x18,%rdx
+  80264a:	48 83 f9 20          	cmp    $0x20,%rcx
+  80264e:	74 6e                	je     8026be <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  802650:	48 8b 02             	mov    (%rdx),%rax
+  802653:	48 83 e8 01          	sub    $0x1,%rax
+  802657:	48 39 f0             	cmp    %rsi,%rax
+  80265a:	73 e6                	jae    802642 <mmap_pgfault+0x1c>
+  80265c:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  802660:	73 e0                	jae    802642 <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  802662:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  802666:	b8 00 00 00 00       	mov    $0x0,%eax
+  80266b:	f6 c2 01             	test   $0x1,%dl
+  80266e:	75 d1                	jne    802641 <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  802670:	f6 c2 02             	test   $0x2,%dl
+  802673:	74 1a                	je     80268f <mmap_pgfault+0x69>
+  802675:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  802679:	b8 00 00 00 00       	mov    $0x0,%eax
+  80267e:	48 bf 00 20 82 00 00 	movabs $0x822000,%rdi
+  802685:	00 00 00 
+  802688:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  80268d:	74 35                	je     8026c4 <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  80268f:	55                   	push   %rbp
+  802690:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  802693:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  802697:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  80269e:	00 00 00 
+  8026a1:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  8026a5:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8026aa:	48 b8 15 25 80 00 00 	movabs $0x802515,%rax
+  8026b1:	00 00 00 
+  8026b4:	ff d0                	call   *%rax
+  8026b6:	48 85 c0             	test   %rax,%rax
+  8026b9:	0f 9f c0             	setg   %al
+}
+  8026bc:	5d                   	pop    %rbp
+  8026bd:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  8026be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026c3:	c3                   	ret
+}
+  8026c4:	c3                   	ret
+
+00000000008026c5 <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  8026c5:	55                   	push   %rbp
+  8026c6:	48 89 e5             	mov    %rsp,%rbp
+  8026c9:	41 54                	push   %r12
+  8026cb:	53                   	push   %rbx
+  8026cc:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8026cf:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8026d6:	00 00 00 
+  8026d9:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  8026de:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8026e2:	74 15                	je     8026f9 <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8026e4:	48 83 c3 01          	add    $0x1,%rbx
+  8026e8:	48 83 c0 18          	add    $0x18,%rax
+  8026ec:	48 83 fb 20          	cmp    $0x20,%rbx
+  8026f0:	75 ec                	jne    8026de <mmap_alloc+0x19>
+    return NULL;
+  8026f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026f7:	eb 52                	jmp    80274b <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  8026f9:	4c 89 e7             	mov    %r12,%rdi
+  8026fc:	48 b8 2f 41 80 00 00 	movabs $0x80412f,%rax
+  802703:	00 00 00 
+  802706:	ff d0                	call   *%rax
+  802708:	41 89 c1             	mov    %eax,%r9d
+  80270b:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  802712:	48 c1 e1 0c          	shl    $0xc,%rcx
+  802716:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80271c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802721:	4c 89 e6             	mov    %r12,%rsi
+  802724:	bf 00 00 00 00       	mov    $0x0,%edi
+  802729:	48 b8 ae 12 80 00 00 	movabs $0x8012ae,%rax
+  802730:	00 00 00 
+  802733:	ff d0                	call   *%rax
+  802735:	85 c0                	test   %eax,%eax
+  802737:	78 17                	js     802750 <mmap_alloc+0x8b>
+        return &mmaps[i];
+  802739:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  80273d:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  802744:	00 00 00 
+  802747:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  80274b:	5b                   	pop    %rbx
+  80274c:	41 5c                	pop    %r12
+  80274e:	5d                   	pop    %rbp
+  80274f:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  802750:	b8 00 00 00 00       	mov    $0x0,%eax
+  802755:	eb f4                	jmp    80274b <mmap_alloc+0x86>
+
+0000000000802757 <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  802757:	55                   	push   %rbp
+  802758:	48 89 e5             	mov    %rsp,%rbp
+  80275b:	41 56                	push   %r14
+  80275d:	41 55                	push   %r13
+  80275f:	41 54                	push   %r12
+  802761:	53                   	push   %rbx
+  802762:	48 83 ec 10          	sub    $0x10,%rsp
+  802766:	41 89 fc             	mov    %edi,%r12d
+  802769:	49 89 f5             	mov    %rsi,%r13
+  80276c:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  80276f:	48 89 f0             	mov    %rsi,%rax
+  802772:	48 09 d0             	or     %rdx,%rax
+  802775:	75 0d                	jne    802784 <fsipc+0x2d>
+  802777:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  80277a:	83 f8 04             	cmp    $0x4,%eax
+  80277d:	76 7d                	jbe    8027fc <fsipc+0xa5>
+  80277f:	83 ff 0d             	cmp    $0xd,%edi
+  802782:	74 78                	je     8027fc <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  802784:	48 b8 a4 20 80 00 00 	movabs $0x8020a4,%rax
+  80278b:	00 00 00 
+  80278e:	ff d0                	call   *%rax
+  802790:	89 c7                	mov    %eax,%edi
+  802792:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  802799:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  8027a0:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  8027a7:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8027ad:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  8027b4:	00 00 00 
+  8027b7:	44 89 e6             	mov    %r12d,%esi
+  8027ba:	48 b8 bd 18 80 00 00 	movabs $0x8018bd,%rax
+  8027c1:	00 00 00 
+  8027c4:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  8027c6:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8027cd:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  8027ce:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8027d3:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8027d7:	4c 89 ee             	mov    %r13,%rsi
+  8027da:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027df:	48 b8 99 18 80 00 00 	movabs $0x801899,%rax
+  8027e6:	00 00 00 
+  8027e9:	ff d0                	call   *%rax
+  8027eb:	89 c3                	mov    %eax,%ebx
+}
+  8027ed:	89 d8                	mov    %ebx,%eax
+  8027ef:	48 83 c4 10          	add    $0x10,%rsp
+  8027f3:	5b                   	pop    %rbx
+  8027f4:	41 5c                	pop    %r12
+  8027f6:	41 5d                	pop    %r13
+  8027f8:	41 5e                	pop    %r14
+  8027fa:	5d                   	pop    %rbp
+  8027fb:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  8027fc:	48 b8 09 22 80 00 00 	movabs $0x802209,%rax
+  802803:	00 00 00 
+  802806:	ff d0                	call   *%rax
+  802808:	49 89 c6             	mov    %rax,%r14
+  80280b:	48 85 c0             	test   %rax,%rax
+  80280e:	0f 84 70 ff ff ff    	je     802784 <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  802814:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  802818:	48 b8 0c 43 80 00 00 	movabs $0x80430c,%rax
+  80281f:	00 00 00 
+  802822:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  802824:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  802827:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  80282e:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  802832:	ba 10 00 00 00       	mov    $0x10,%edx
+  802837:	48 be 00 00 83 00 00 	movabs $0x830000,%rsi
+  80283e:	00 00 00 
+  802841:	48 b8 5a 0f 80 00 00 	movabs $0x800f5a,%rax
+  802848:	00 00 00 
+  80284b:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  80284d:	4c 89 f7             	mov    %r14,%rdi
+  802850:	48 b8 a5 22 80 00 00 	movabs $0x8022a5,%rax
+  802857:	00 00 00 
+  80285a:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  80285c:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  802863:	4c 89 f7             	mov    %r14,%rdi
+  802866:	48 b8 cf 43 80 00 00 	movabs $0x8043cf,%rax
+  80286d:	00 00 00 
+  802870:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  802872:	4c 89 f7             	mov    %r14,%rdi
+  802875:	48 b8 5d 43 80 00 00 	movabs $0x80435d,%rax
+  80287c:	00 00 00 
+  80287f:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  802881:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  802884:	41 83 fc 05          	cmp    $0x5,%r12d
+  802888:	75 04                	jne    80288e <fsipc+0x137>
+  80288a:	85 db                	test   %ebx,%ebx
+  80288c:	79 14                	jns    8028a2 <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  80288e:	4c 89 f7             	mov    %r14,%rdi
+  802891:	48 b8 84 43 80 00 00 	movabs $0x804384,%rax
+  802898:	00 00 00 
+  80289b:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  80289d:	e9 4b ff ff ff       	jmp    8027ed <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  8028a2:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  8028a6:	ba 88 00 00 00       	mov    $0x88,%edx
+  8028ab:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  8028b2:	00 00 00 
+  8028b5:	48 b8 5a 0f 80 00 00 	movabs $0x800f5a,%rax
+  8028bc:	00 00 00 
+  8028bf:	ff d0                	call   *%rax
+  8028c1:	eb cb                	jmp    80288e <fsipc+0x137>
+
+00000000008028c3 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  8028c3:	55                   	push   %rbp
+  8028c4:	48 89 e5             	mov    %rsp,%rbp
+  8028c7:	41 57                	push   %r15
+  8028c9:	41 56                	push   %r14
+  8028cb:	41 55                	push   %r13
+  8028cd:	41 54                	push   %r12
+  8028cf:	53                   	push   %rbx
+  8028d0:	48 83 ec 18          	sub    $0x18,%rsp
+  8028d4:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  8028d8:	49 89 f6             	mov    %rsi,%r14
+  8028db:	49 89 d4             	mov    %rdx,%r12
+  8028de:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  8028e1:	48 b8 09 22 80 00 00 	movabs $0x802209,%rax
+  8028e8:	00 00 00 
+  8028eb:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  8028ed:	48 85 c0             	test   %rax,%rax
+  8028f0:	0f 85 96 00 00 00    	jne    80298c <devfile_write_direct+0xc9>
+    size_t write = 0;
+  8028f6:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8028fd:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8028fe:	49 bf 00 00 83 00 00 	movabs $0x830000,%r15
+  802905:	00 00 00 
+    while (n) {
+  802908:	4d 85 e4             	test   %r12,%r12
+  80290b:	74 79                	je     802986 <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  80290d:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  802912:	49 39 dc             	cmp    %rbx,%r12
+  802915:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  802919:	48 89 da             	mov    %rbx,%rdx
+  80291c:	4c 89 f6             	mov    %r14,%rsi
+  80291f:	48 bf 00 10 83 00 00 	movabs $0x831000,%rdi
+  802926:	00 00 00 
+  802929:	48 b8 5a 0f 80 00 00 	movabs $0x800f5a,%rax
+  802930:	00 00 00 
+  802933:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802935:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802939:	8b 40 0c             	mov    0xc(%rax),%eax
+  80293c:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  80293f:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802942:	44 01 e8             	add    %r13d,%eax
+  802945:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  802949:	41 0f 44 c5          	cmove  %r13d,%eax
+  80294d:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  802951:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  802955:	48 89 da             	mov    %rbx,%rdx
+  802958:	be 00 00 00 00       	mov    $0x0,%esi
+  80295d:	bf 04 00 00 00       	mov    $0x4,%edi
+  802962:	48 b8 57 27 80 00 00 	movabs $0x802757,%rax
+  802969:	00 00 00 
+  80296c:	ff d0                	call   *%rax
+        if (res < 0)
+  80296e:	85 c0                	test   %eax,%eax
+  802970:	78 4a                	js     8029bc <devfile_write_direct+0xf9>
+        buf += res;
+  802972:	48 98                	cltq
+  802974:	49 01 c6             	add    %rax,%r14
+        write += res;
+  802977:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  80297b:	49 29 c4             	sub    %rax,%r12
+  80297e:	75 8d                	jne    80290d <devfile_write_direct+0x4a>
+    return write;
+  802980:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802984:	eb 27                	jmp    8029ad <devfile_write_direct+0xea>
+    size_t write = 0;
+  802986:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  80298a:	eb f4                	jmp    802980 <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  80298c:	45 89 e9             	mov    %r13d,%r9d
+  80298f:	4d 89 e0             	mov    %r12,%r8
+  802992:	4c 89 f1             	mov    %r14,%rcx
+  802995:	ba 04 00 00 00       	mov    $0x4,%edx
+  80299a:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80299e:	48 89 c7             	mov    %rax,%rdi
+  8029a1:	48 b8 f0 22 80 00 00 	movabs $0x8022f0,%rax
+  8029a8:	00 00 00 
+  8029ab:	ff d0                	call   *%rax
+}
+  8029ad:	48 83 c4 18          	add    $0x18,%rsp
+  8029b1:	5b                   	pop    %rbx
+  8029b2:	41 5c                	pop    %r12
+  8029b4:	41 5d                	pop    %r13
+  8029b6:	41 5e                	pop    %r14
+  8029b8:	41 5f                	pop    %r15
+  8029ba:	5d                   	pop    %rbp
+  8029bb:	c3                   	ret
+            return res;
+  8029bc:	48 98                	cltq
+  8029be:	eb ed                	jmp    8029ad <devfile_write_direct+0xea>
+
+00000000008029c0 <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  8029c0:	55                   	push   %rbp
+  8029c1:	48 89 e5             	mov    %rsp,%rbp
+  8029c4:	41 54                	push   %r12
+  8029c6:	53                   	push   %rbx
+  8029c7:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  8029ca:	48 b8 73 22 80 00 00 	movabs $0x802273,%rax
+  8029d1:	00 00 00 
+  8029d4:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  8029d6:	48 85 c0             	test   %rax,%rax
+  8029d9:	74 71                	je     802a4c <fbuf_flush+0x8c>
+  8029db:	48 89 c3             	mov    %rax,%rbx
+  8029de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029e3:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  8029e7:	75 05                	jne    8029ee <fbuf_flush+0x2e>
+}
+  8029e9:	5b                   	pop    %rbx
+  8029ea:	41 5c                	pop    %r12
+  8029ec:	5d                   	pop    %rbp
+  8029ed:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  8029ee:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  8029f1:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  8029f5:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8029fc:	00 00 00 
+  8029ff:	48 89 de             	mov    %rbx,%rsi
+  802a02:	48 29 c6             	sub    %rax,%rsi
+  802a05:	48 c1 fe 03          	sar    $0x3,%rsi
+  802a09:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802a10:	aa aa aa 
+  802a13:	48 0f af f0          	imul   %rax,%rsi
+  802a17:	48 c1 e6 0e          	shl    $0xe,%rsi
+  802a1b:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802a20:	48 01 c6             	add    %rax,%rsi
+  802a23:	4c 89 e7             	mov    %r12,%rdi
+  802a26:	48 b8 c3 28 80 00 00 	movabs $0x8028c3,%rax
+  802a2d:	00 00 00 
+  802a30:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  802a32:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  802a36:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802a3d:	00 
+    return res < 0 ? res : 0;
+  802a3e:	48 85 c0             	test   %rax,%rax
+  802a41:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a46:	48 0f 4f c2          	cmovg  %rdx,%rax
+  802a4a:	eb 9d                	jmp    8029e9 <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  802a4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a51:	eb 96                	jmp    8029e9 <fbuf_flush+0x29>
+
+0000000000802a53 <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  802a53:	55                   	push   %rbp
+  802a54:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  802a57:	48 b8 c0 29 80 00 00 	movabs $0x8029c0,%rax
+  802a5e:	00 00 00 
+  802a61:	ff d0                	call   *%rax
+}
+  802a63:	5d                   	pop    %rbp
+  802a64:	c3                   	ret
+
+0000000000802a65 <devfile_write>:
+    if (!fd || !buf)
+  802a65:	48 85 ff             	test   %rdi,%rdi
+  802a68:	0f 84 d3 01 00 00    	je     802c41 <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802a6e:	55                   	push   %rbp
+  802a6f:	48 89 e5             	mov    %rsp,%rbp
+  802a72:	41 57                	push   %r15
+  802a74:	41 56                	push   %r14
+  802a76:	41 55                	push   %r13
+  802a78:	41 54                	push   %r12
+  802a7a:	53                   	push   %rbx
+  802a7b:	48 83 ec 08          	sub    $0x8,%rsp
+  802a7f:	49 89 fc             	mov    %rdi,%r12
+  802a82:	49 89 f6             	mov    %rsi,%r14
+  802a85:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  802a88:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802a8d:	48 85 f6             	test   %rsi,%rsi
+  802a90:	0f 84 9c 01 00 00    	je     802c32 <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  802a96:	48 b8 73 22 80 00 00 	movabs $0x802273,%rax
+  802a9d:	00 00 00 
+  802aa0:	ff d0                	call   *%rax
+  802aa2:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  802aa5:	48 85 c0             	test   %rax,%rax
+  802aa8:	0f 84 a2 00 00 00    	je     802b50 <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802aae:	be 00 10 00 00       	mov    $0x1000,%esi
+  802ab3:	4c 89 e7             	mov    %r12,%rdi
+  802ab6:	48 b8 1d 12 80 00 00 	movabs $0x80121d,%rax
+  802abd:	00 00 00 
+  802ac0:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  802ac2:	83 f8 02             	cmp    $0x2,%eax
+  802ac5:	0f 8f 85 00 00 00    	jg     802b50 <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  802acb:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802ad2:	00 00 00 
+  802ad5:	4d 89 ef             	mov    %r13,%r15
+  802ad8:	49 29 c7             	sub    %rax,%r15
+  802adb:	49 c1 ff 03          	sar    $0x3,%r15
+  802adf:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802ae6:	aa aa aa 
+  802ae9:	4c 0f af f8          	imul   %rax,%r15
+  802aed:	49 c1 e7 0e          	shl    $0xe,%r15
+  802af1:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802af6:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  802af9:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802afe:	0f 84 d7 00 00 00    	je     802bdb <devfile_write+0x176>
+  802b04:	49 8b 45 10          	mov    0x10(%r13),%rax
+  802b08:	89 c2                	mov    %eax,%edx
+  802b0a:	41 03 55 0c          	add    0xc(%r13),%edx
+  802b0e:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  802b13:	75 0f                	jne    802b24 <devfile_write+0xbf>
+  802b15:	48 01 d8             	add    %rbx,%rax
+  802b18:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  802b1e:	0f 86 92 00 00 00    	jbe    802bb6 <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802b24:	4c 89 e7             	mov    %r12,%rdi
+  802b27:	48 b8 c0 29 80 00 00 	movabs $0x8029c0,%rax
+  802b2e:	00 00 00 
+  802b31:	ff d0                	call   *%rax
+  802b33:	85 c0                	test   %eax,%eax
+  802b35:	78 52                	js     802b89 <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802b37:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802b3e:	77 7f                	ja     802bbf <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  802b40:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802b45:	0f 85 c2 00 00 00    	jne    802c0d <devfile_write+0x1a8>
+  802b4b:	e9 94 00 00 00       	jmp    802be4 <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  802b50:	4c 89 e7             	mov    %r12,%rdi
+  802b53:	48 b8 c0 29 80 00 00 	movabs $0x8029c0,%rax
+  802b5a:	00 00 00 
+  802b5d:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802b5f:	85 c0                	test   %eax,%eax
+  802b61:	79 07                	jns    802b6a <devfile_write+0x105>
+  802b63:	48 98                	cltq
+  802b65:	e9 c8 00 00 00       	jmp    802c32 <devfile_write+0x1cd>
+  802b6a:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802b6f:	48 89 da             	mov    %rbx,%rdx
+  802b72:	4c 89 f6             	mov    %r14,%rsi
+  802b75:	4c 89 e7             	mov    %r12,%rdi
+  802b78:	48 b8 c3 28 80 00 00 	movabs $0x8028c3,%rax
+  802b7f:	00 00 00 
+  802b82:	ff d0                	call   *%rax
+  802b84:	e9 a9 00 00 00       	jmp    802c32 <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802b89:	48 98                	cltq
+  802b8b:	e9 a2 00 00 00       	jmp    802c32 <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802b90:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802b95:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802b9a:	4c 89 fe             	mov    %r15,%rsi
+  802b9d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ba2:	48 b8 58 12 80 00 00 	movabs $0x801258,%rax
+  802ba9:	00 00 00 
+  802bac:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  802bae:	85 c0                	test   %eax,%eax
+  802bb0:	79 45                	jns    802bf7 <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802bb2:	48 98                	cltq
+  802bb4:	eb 7c                	jmp    802c32 <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802bb6:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802bbd:	76 4e                	jbe    802c0d <devfile_write+0x1a8>
+  802bbf:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802bc4:	48 89 da             	mov    %rbx,%rdx
+  802bc7:	4c 89 f6             	mov    %r14,%rsi
+  802bca:	4c 89 e7             	mov    %r12,%rdi
+  802bcd:	48 b8 c3 28 80 00 00 	movabs $0x8028c3,%rax
+  802bd4:	00 00 00 
+  802bd7:	ff d0                	call   *%rax
+  802bd9:	eb 57                	jmp    802c32 <devfile_write+0x1cd>
+  802bdb:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802be2:	77 db                	ja     802bbf <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  802be4:	4c 89 ff             	mov    %r15,%rdi
+  802be7:	48 b8 8e 41 80 00 00 	movabs $0x80418e,%rax
+  802bee:	00 00 00 
+  802bf1:	ff d0                	call   *%rax
+  802bf3:	84 c0                	test   %al,%al
+  802bf5:	74 99                	je     802b90 <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  802bf7:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  802bfc:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802c01:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  802c05:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  802c0c:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  802c0d:	4c 89 ff             	mov    %r15,%rdi
+  802c10:	49 03 7d 10          	add    0x10(%r13),%rdi
+  802c14:	48 89 da             	mov    %rbx,%rdx
+  802c17:	4c 89 f6             	mov    %r14,%rsi
+  802c1a:	48 b8 5a 0f 80 00 00 	movabs $0x800f5a,%rax
+  802c21:	00 00 00 
+  802c24:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  802c26:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  802c2a:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  802c2f:	48 89 d8             	mov    %rbx,%rax
+}
+  802c32:	48 83 c4 08          	add    $0x8,%rsp
+  802c36:	5b                   	pop    %rbx
+  802c37:	41 5c                	pop    %r12
+  802c39:	41 5d                	pop    %r13
+  802c3b:	41 5e                	pop    %r14
+  802c3d:	41 5f                	pop    %r15
+  802c3f:	5d                   	pop    %rbp
+  802c40:	c3                   	ret
+        return E_INVAL;
+  802c41:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802c46:	c3                   	ret
+
+0000000000802c47 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802c47:	55                   	push   %rbp
+  802c48:	48 89 e5             	mov    %rsp,%rbp
+  802c4b:	41 54                	push   %r12
+  802c4d:	53                   	push   %rbx
+  802c4e:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  802c51:	48 b8 c0 29 80 00 00 	movabs $0x8029c0,%rax
+  802c58:	00 00 00 
+  802c5b:	ff d0                	call   *%rax
+  802c5d:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  802c60:	48 89 df             	mov    %rbx,%rdi
+  802c63:	48 b8 73 22 80 00 00 	movabs $0x802273,%rax
+  802c6a:	00 00 00 
+  802c6d:	ff d0                	call   *%rax
+  802c6f:	48 85 c0             	test   %rax,%rax
+  802c72:	74 17                	je     802c8b <devfile_flush+0x44>
+  802c74:	48 89 df             	mov    %rbx,%rdi
+  802c77:	48 b8 73 22 80 00 00 	movabs $0x802273,%rax
+  802c7e:	00 00 00 
+  802c81:	ff d0                	call   *%rax
+  802c83:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  802c8a:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802c8b:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802c8e:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  802c95:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  802c97:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c9c:	be 00 00 00 00       	mov    $0x0,%esi
+  802ca1:	bf 06 00 00 00       	mov    $0x6,%edi
+  802ca6:	48 b8 57 27 80 00 00 	movabs $0x802757,%rax
+  802cad:	00 00 00 
+  802cb0:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802cb2:	45 85 e4             	test   %r12d,%r12d
+  802cb5:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802cb9:	5b                   	pop    %rbx
+  802cba:	41 5c                	pop    %r12
+  802cbc:	5d                   	pop    %rbp
+  802cbd:	c3                   	ret
+
+0000000000802cbe <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  802cbe:	55                   	push   %rbp
+  802cbf:	48 89 e5             	mov    %rsp,%rbp
+  802cc2:	41 57                	push   %r15
+  802cc4:	41 56                	push   %r14
+  802cc6:	41 55                	push   %r13
+  802cc8:	41 54                	push   %r12
+  802cca:	53                   	push   %rbx
+  802ccb:	48 83 ec 38          	sub    $0x38,%rsp
+  802ccf:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  802cd3:	49 89 f7             	mov    %rsi,%r15
+  802cd6:	48 89 d3             	mov    %rdx,%rbx
+  802cd9:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  802cdc:	48 b8 09 22 80 00 00 	movabs $0x802209,%rax
+  802ce3:	00 00 00 
+  802ce6:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802ce8:	48 85 c0             	test   %rax,%rax
+  802ceb:	75 20                	jne    802d0d <devfile_read_direct+0x4f>
+    bool map = 1;
+  802ced:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  802cf2:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802cf9:	00 
+    while (n) {
+  802cfa:	48 85 db             	test   %rbx,%rbx
+  802cfd:	0f 85 df 00 00 00    	jne    802de2 <devfile_read_direct+0x124>
+    size_t read = 0;
+  802d03:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  802d07:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802d0b:	eb 21                	jmp    802d2e <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802d0d:	45 89 f1             	mov    %r14d,%r9d
+  802d10:	49 89 d8             	mov    %rbx,%r8
+  802d13:	4c 89 f9             	mov    %r15,%rcx
+  802d16:	ba 03 00 00 00       	mov    $0x3,%edx
+  802d1b:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802d1f:	48 89 c7             	mov    %rax,%rdi
+  802d22:	48 b8 f0 22 80 00 00 	movabs $0x8022f0,%rax
+  802d29:	00 00 00 
+  802d2c:	ff d0                	call   *%rax
+}
+  802d2e:	48 83 c4 38          	add    $0x38,%rsp
+  802d32:	5b                   	pop    %rbx
+  802d33:	41 5c                	pop    %r12
+  802d35:	41 5d                	pop    %r13
+  802d37:	41 5e                	pop    %r14
+  802d39:	41 5f                	pop    %r15
+  802d3b:	5d                   	pop    %rbp
+  802d3c:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802d3d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802d41:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802d47:	75 1e                	jne    802d67 <devfile_read_direct+0xa9>
+  802d49:	e9 e2 00 00 00       	jmp    802e30 <devfile_read_direct+0x172>
+            if (!res) return read;
+  802d4e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802d52:	eb da                	jmp    802d2e <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  802d54:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  802d58:	0f 85 d0 01 00 00    	jne    802f2e <devfile_read_direct+0x270>
+            map = 0;
+  802d5e:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802d62:	eb 03                	jmp    802d67 <devfile_read_direct+0xa9>
+  802d64:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802d67:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802d6c:	48 39 d3             	cmp    %rdx,%rbx
+  802d6f:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802d73:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802d77:	8b 40 0c             	mov    0xc(%rax),%eax
+  802d7a:	48 b9 00 00 83 00 00 	movabs $0x830000,%rcx
+  802d81:	00 00 00 
+  802d84:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  802d86:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  802d8a:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  802d8e:	be 00 00 00 00       	mov    $0x0,%esi
+  802d93:	bf 03 00 00 00       	mov    $0x3,%edi
+  802d98:	48 b8 57 27 80 00 00 	movabs $0x802757,%rax
+  802d9f:	00 00 00 
+  802da2:	ff d0                	call   *%rax
+        if (res <= 0)
+  802da4:	85 c0                	test   %eax,%eax
+  802da6:	0f 8e 63 01 00 00    	jle    802f0f <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  802dac:	4c 63 e0             	movslq %eax,%r12
+  802daf:	4c 89 e2             	mov    %r12,%rdx
+  802db2:	48 be 00 10 83 00 00 	movabs $0x831000,%rsi
+  802db9:	00 00 00 
+  802dbc:	4c 89 ff             	mov    %r15,%rdi
+  802dbf:	48 b8 5a 0f 80 00 00 	movabs $0x800f5a,%rax
+  802dc6:	00 00 00 
+  802dc9:	ff d0                	call   *%rax
+        buf += res;
+  802dcb:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  802dce:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  802dd1:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  802dd5:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  802dd9:	48 85 db             	test   %rbx,%rbx
+  802ddc:	0f 84 25 ff ff ff    	je     802d07 <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  802de2:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  802de5:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  802de9:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802ded:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802df1:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  802df8:	0f 97 c2             	seta   %dl
+  802dfb:	20 c2                	and    %al,%dl
+  802dfd:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  802e00:	0f 84 5e ff ff ff    	je     802d64 <devfile_read_direct+0xa6>
+  802e06:	4c 89 fa             	mov    %r15,%rdx
+  802e09:	4d 89 fd             	mov    %r15,%r13
+  802e0c:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  802e13:	0f 85 4e ff ff ff    	jne    802d67 <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  802e19:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802e1d:	0f 84 1a ff ff ff    	je     802d3d <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802e23:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802e2a:	0f 85 37 ff ff ff    	jne    802d67 <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  802e30:	48 89 d8             	mov    %rbx,%rax
+  802e33:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802e39:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802e3e:	48 39 c8             	cmp    %rcx,%rax
+  802e41:	48 0f 47 c1          	cmova  %rcx,%rax
+  802e45:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  802e49:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  802e4d:	49 89 d4             	mov    %rdx,%r12
+  802e50:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  802e54:	48 b8 2f 41 80 00 00 	movabs $0x80412f,%rax
+  802e5b:	00 00 00 
+  802e5e:	ff d0                	call   *%rax
+  802e60:	a8 40                	test   $0x40,%al
+  802e62:	0f 85 b9 00 00 00    	jne    802f21 <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  802e68:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  802e6f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e73:	49 39 c5             	cmp    %rax,%r13
+  802e76:	72 d8                	jb     802e50 <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802e78:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802e7c:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802e83:	00 00 00 
+  802e86:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802e8a:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  802e8d:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  802e8f:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  802e93:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  802e97:	48 b8 a4 20 80 00 00 	movabs $0x8020a4,%rax
+  802e9e:	00 00 00 
+  802ea1:	ff d0                	call   *%rax
+  802ea3:	89 c7                	mov    %eax,%edi
+  802ea5:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802eab:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802eb0:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802eb7:	00 00 00 
+  802eba:	be 0e 00 00 00       	mov    $0xe,%esi
+  802ebf:	48 b8 bd 18 80 00 00 	movabs $0x8018bd,%rax
+  802ec6:	00 00 00 
+  802ec9:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  802ecb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802ed0:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802ed4:	4c 89 fe             	mov    %r15,%rsi
+  802ed7:	bf 00 00 00 00       	mov    $0x0,%edi
+  802edc:	48 b8 99 18 80 00 00 	movabs $0x801899,%rax
+  802ee3:	00 00 00 
+  802ee6:	ff d0                	call   *%rax
+  802ee8:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  802eeb:	48 85 d2             	test   %rdx,%rdx
+  802eee:	0f 84 5a fe ff ff    	je     802d4e <devfile_read_direct+0x90>
+            if (res > 0) {
+  802ef4:	0f 8e 5a fe ff ff    	jle    802d54 <devfile_read_direct+0x96>
+                buf += res;
+  802efa:	48 98                	cltq
+  802efc:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  802eff:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  802f02:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  802f06:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  802f0a:	e9 ca fe ff ff       	jmp    802dd9 <devfile_read_direct+0x11b>
+            return res ? res : read;
+  802f0f:	41 89 c5             	mov    %eax,%r13d
+  802f12:	48 98                	cltq
+  802f14:	45 85 ed             	test   %r13d,%r13d
+  802f17:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  802f1c:	e9 0d fe ff ff       	jmp    802d2e <devfile_read_direct+0x70>
+            map = 0;
+  802f21:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802f25:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802f29:	e9 39 fe ff ff       	jmp    802d67 <devfile_read_direct+0xa9>
+  802f2e:	48 89 d0             	mov    %rdx,%rax
+  802f31:	e9 f8 fd ff ff       	jmp    802d2e <devfile_read_direct+0x70>
+
+0000000000802f36 <devfile_read>:
+    if (!fd || !buf)
+  802f36:	48 85 ff             	test   %rdi,%rdi
+  802f39:	0f 84 21 02 00 00    	je     803160 <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802f3f:	55                   	push   %rbp
+  802f40:	48 89 e5             	mov    %rsp,%rbp
+  802f43:	41 57                	push   %r15
+  802f45:	41 56                	push   %r14
+  802f47:	41 55                	push   %r13
+  802f49:	41 54                	push   %r12
+  802f4b:	53                   	push   %rbx
+  802f4c:	48 83 ec 28          	sub    $0x28,%rsp
+  802f50:	48 89 fb             	mov    %rdi,%rbx
+  802f53:	49 89 f4             	mov    %rsi,%r12
+  802f56:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  802f59:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802f5e:	48 85 f6             	test   %rsi,%rsi
+  802f61:	74 4b                	je     802fae <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  802f63:	48 b8 73 22 80 00 00 	movabs $0x802273,%rax
+  802f6a:	00 00 00 
+  802f6d:	ff d0                	call   *%rax
+  802f6f:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802f72:	48 85 c0             	test   %rax,%rax
+  802f75:	74 22                	je     802f99 <devfile_read+0x63>
+  802f77:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  802f7e:	77 19                	ja     802f99 <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802f80:	be 00 10 00 00       	mov    $0x1000,%esi
+  802f85:	48 89 df             	mov    %rbx,%rdi
+  802f88:	48 b8 1d 12 80 00 00 	movabs $0x80121d,%rax
+  802f8f:	00 00 00 
+  802f92:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802f94:	83 f8 02             	cmp    $0x2,%eax
+  802f97:	7e 40                	jle    802fd9 <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  802f99:	48 89 df             	mov    %rbx,%rdi
+  802f9c:	48 b8 c0 29 80 00 00 	movabs $0x8029c0,%rax
+  802fa3:	00 00 00 
+  802fa6:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802fa8:	85 c0                	test   %eax,%eax
+  802faa:	79 11                	jns    802fbd <devfile_read+0x87>
+  802fac:	48 98                	cltq
+}
+  802fae:	48 83 c4 28          	add    $0x28,%rsp
+  802fb2:	5b                   	pop    %rbx
+  802fb3:	41 5c                	pop    %r12
+  802fb5:	41 5d                	pop    %r13
+  802fb7:	41 5e                	pop    %r14
+  802fb9:	41 5f                	pop    %r15
+  802fbb:	5d                   	pop    %rbp
+  802fbc:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802fbd:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802fc2:	4c 89 ea             	mov    %r13,%rdx
+  802fc5:	4c 89 e6             	mov    %r12,%rsi
+  802fc8:	48 89 df             	mov    %rbx,%rdi
+  802fcb:	48 b8 be 2c 80 00 00 	movabs $0x802cbe,%rax
+  802fd2:	00 00 00 
+  802fd5:	ff d0                	call   *%rax
+  802fd7:	eb d5                	jmp    802fae <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  802fd9:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802fdd:	48 89 df             	mov    %rbx,%rdi
+  802fe0:	48 b8 c0 29 80 00 00 	movabs $0x8029c0,%rax
+  802fe7:	00 00 00 
+  802fea:	ff d0                	call   *%rax
+  802fec:	85 c0                	test   %eax,%eax
+  802fee:	0f 88 33 01 00 00    	js     803127 <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  802ff4:	48 ba 00 23 82 00 00 	movabs $0x822300,%rdx
+  802ffb:	00 00 00 
+  802ffe:	4c 89 f0             	mov    %r14,%rax
+  803001:	48 29 d0             	sub    %rdx,%rax
+  803004:	48 c1 f8 03          	sar    $0x3,%rax
+  803008:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  80300f:	aa aa aa 
+  803012:	48 0f af c2          	imul   %rdx,%rax
+  803016:	48 c1 e0 0e          	shl    $0xe,%rax
+  80301a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  80301e:	8b 43 0c             	mov    0xc(%rbx),%eax
+  803021:	41 39 06             	cmp    %eax,(%r14)
+  803024:	75 0d                	jne    803033 <devfile_read+0xfd>
+  803026:	8b 43 10             	mov    0x10(%rbx),%eax
+  803029:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  80302d:	0f 84 fb 00 00 00    	je     80312e <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  803033:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  803038:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80303c:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  80303f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803043:	48 89 c7             	mov    %rax,%rdi
+  803046:	48 b8 8e 41 80 00 00 	movabs $0x80418e,%rax
+  80304d:	00 00 00 
+  803050:	ff d0                	call   *%rax
+  803052:	84 c0                	test   %al,%al
+  803054:	75 27                	jne    80307d <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  803056:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80305b:	ba 00 40 00 00       	mov    $0x4000,%edx
+  803060:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803064:	bf 00 00 00 00       	mov    $0x0,%edi
+  803069:	48 b8 58 12 80 00 00 	movabs $0x801258,%rax
+  803070:	00 00 00 
+  803073:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  803075:	85 c0                	test   %eax,%eax
+  803077:	0f 88 dc 00 00 00    	js     803159 <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  80307d:	44 89 f8             	mov    %r15d,%eax
+  803080:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  803085:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  803087:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  80308e:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  80308f:	8b 43 10             	mov    0x10(%rbx),%eax
+  803092:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  803096:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  803099:	ba 00 40 00 00       	mov    $0x4000,%edx
+  80309e:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8030a2:	48 89 df             	mov    %rbx,%rdi
+  8030a5:	48 b8 be 2c 80 00 00 	movabs $0x802cbe,%rax
+  8030ac:	00 00 00 
+  8030af:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  8030b1:	48 85 c0             	test   %rax,%rax
+  8030b4:	0f 88 f4 fe ff ff    	js     802fae <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  8030ba:	8b 53 0c             	mov    0xc(%rbx),%edx
+  8030bd:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  8030c0:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  8030c3:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  8030c7:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  8030cb:	48 63 d1             	movslq %ecx,%rdx
+  8030ce:	48 01 d0             	add    %rdx,%rax
+  8030d1:	4d 63 ff             	movslq %r15d,%r15
+  8030d4:	4c 29 f8             	sub    %r15,%rax
+  8030d7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030dc:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  8030e0:	48 85 c0             	test   %rax,%rax
+  8030e3:	0f 8e c5 fe ff ff    	jle    802fae <devfile_read+0x78>
+    n = MIN(n, res);
+  8030e9:	4c 39 e8             	cmp    %r13,%rax
+  8030ec:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  8030f0:	8b 73 04             	mov    0x4(%rbx),%esi
+  8030f3:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  8030f7:	48 63 f6             	movslq %esi,%rsi
+  8030fa:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  8030ff:	48 01 c6             	add    %rax,%rsi
+  803102:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803106:	48 01 c6             	add    %rax,%rsi
+  803109:	4c 89 ea             	mov    %r13,%rdx
+  80310c:	4c 89 e7             	mov    %r12,%rdi
+  80310f:	48 b8 5a 0f 80 00 00 	movabs $0x800f5a,%rax
+  803116:	00 00 00 
+  803119:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  80311b:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  80311f:	4c 89 e8             	mov    %r13,%rax
+  803122:	e9 87 fe ff ff       	jmp    802fae <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  803127:	48 98                	cltq
+  803129:	e9 80 fe ff ff       	jmp    802fae <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  80312e:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  803132:	41 39 d7             	cmp    %edx,%r15d
+  803135:	0f 8c f8 fe ff ff    	jl     803033 <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  80313b:	49 8b 46 10          	mov    0x10(%r14),%rax
+  80313f:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  803142:	41 39 cf             	cmp    %ecx,%r15d
+  803145:	0f 8d e8 fe ff ff    	jge    803033 <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  80314b:	4d 63 ff             	movslq %r15d,%r15
+  80314e:	4c 29 f8             	sub    %r15,%rax
+  803151:	48 63 d2             	movslq %edx,%rdx
+  803154:	48 01 d0             	add    %rdx,%rax
+  803157:	eb 87                	jmp    8030e0 <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  803159:	48 98                	cltq
+  80315b:	e9 4e fe ff ff       	jmp    802fae <devfile_read+0x78>
+        return E_INVAL;
+  803160:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  803165:	c3                   	ret
+
+0000000000803166 <fs_channel>:
+fs_channel(bool enable) {
+  803166:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  803168:	a2 04 26 82 00 00 00 	movabs %al,0x822604
+  80316f:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  803171:	ba 00 00 00 00       	mov    $0x0,%edx
+  803176:	40 84 ff             	test   %dil,%dil
+  803179:	74 47                	je     8031c2 <fs_channel+0x5c>
+  80317b:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  803182:	00 00 00 
+  803185:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  80318b:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  803192:	00 00 00 
+  803195:	3b 08                	cmp    (%rax),%ecx
+  803197:	74 29                	je     8031c2 <fs_channel+0x5c>
+fs_channel(bool enable) {
+  803199:	55                   	push   %rbp
+  80319a:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  80319d:	48 b8 e6 20 80 00 00 	movabs $0x8020e6,%rax
+  8031a4:	00 00 00 
+  8031a7:	ff d0                	call   *%rax
+  8031a9:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  8031ab:	85 c0                	test   %eax,%eax
+  8031ad:	78 04                	js     8031b3 <fs_channel+0x4d>
+}
+  8031af:	89 d0                	mov    %edx,%eax
+  8031b1:	5d                   	pop    %rbp
+  8031b2:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  8031b3:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  8031ba:	00 00 00 
+  8031bd:	c6 00 00             	movb   $0x0,(%rax)
+  8031c0:	eb ed                	jmp    8031af <fs_channel+0x49>
+}
+  8031c2:	89 d0                	mov    %edx,%eax
+  8031c4:	c3                   	ret
+
+00000000008031c5 <open>:
+open(const char *path, int mode) {
+  8031c5:	55                   	push   %rbp
+  8031c6:	48 89 e5             	mov    %rsp,%rbp
+  8031c9:	41 55                	push   %r13
+  8031cb:	41 54                	push   %r12
+  8031cd:	53                   	push   %rbx
+  8031ce:	48 83 ec 18          	sub    $0x18,%rsp
+  8031d2:	49 89 fc             	mov    %rdi,%r12
+  8031d5:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8031d8:	48 b8 bb 0c 80 00 00 	movabs $0x800cbb,%rax
+  8031df:	00 00 00 
+  8031e2:	ff d0                	call   *%rax
+  8031e4:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8031ea:	0f 87 8f 00 00 00    	ja     80327f <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8031f0:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8031f4:	48 b8 a0 19 80 00 00 	movabs $0x8019a0,%rax
+  8031fb:	00 00 00 
+  8031fe:	ff d0                	call   *%rax
+  803200:	89 c3                	mov    %eax,%ebx
+  803202:	85 c0                	test   %eax,%eax
+  803204:	78 55                	js     80325b <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  803206:	4c 89 e6             	mov    %r12,%rsi
+  803209:	48 bb 00 00 83 00 00 	movabs $0x830000,%rbx
+  803210:	00 00 00 
+  803213:	48 89 df             	mov    %rbx,%rdi
+  803216:	48 b8 f9 0c 80 00 00 	movabs $0x800cf9,%rax
+  80321d:	00 00 00 
+  803220:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803222:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  803229:	ba 00 00 00 00       	mov    $0x0,%edx
+  80322e:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803232:	bf 01 00 00 00       	mov    $0x1,%edi
+  803237:	48 b8 57 27 80 00 00 	movabs $0x802757,%rax
+  80323e:	00 00 00 
+  803241:	ff d0                	call   *%rax
+  803243:	89 c3                	mov    %eax,%ebx
+  803245:	85 c0                	test   %eax,%eax
+  803247:	78 1f                	js     803268 <open+0xa3>
+    return fd2num(fd);
+  803249:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80324d:	48 b8 72 19 80 00 00 	movabs $0x801972,%rax
+  803254:	00 00 00 
+  803257:	ff d0                	call   *%rax
+  803259:	89 c3                	mov    %eax,%ebx
+}
+  80325b:	89 d8                	mov    %ebx,%eax
+  80325d:	48 83 c4 18          	add    $0x18,%rsp
+  803261:	5b                   	pop    %rbx
+  803262:	41 5c                	pop    %r12
+  803264:	41 5d                	pop    %r13
+  803266:	5d                   	pop    %rbp
+  803267:	c3                   	ret
+        fd_close(fd, 0);
+  803268:	be 00 00 00 00       	mov    $0x0,%esi
+  80326d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803271:	48 b8 bb 1a 80 00 00 	movabs $0x801abb,%rax
+  803278:	00 00 00 
+  80327b:	ff d0                	call   *%rax
+        return res;
+  80327d:	eb dc                	jmp    80325b <open+0x96>
+        return -E_BAD_PATH;
+  80327f:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803284:	eb d5                	jmp    80325b <open+0x96>
+
+0000000000803286 <file_flush_buffers>:
+file_flush_buffers(void) {
+  803286:	55                   	push   %rbp
+  803287:	48 89 e5             	mov    %rsp,%rbp
+  80328a:	41 56                	push   %r14
+  80328c:	41 55                	push   %r13
+  80328e:	41 54                	push   %r12
+  803290:	53                   	push   %rbx
+  803291:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  803295:	49 bc 08 23 82 00 00 	movabs $0x822308,%r12
+  80329c:	00 00 00 
+  80329f:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  8032a4:	49 bd 00 1a 80 00 00 	movabs $0x801a00,%r13
+  8032ab:	00 00 00 
+  8032ae:	49 be c0 29 80 00 00 	movabs $0x8029c0,%r14
+  8032b5:	00 00 00 
+  8032b8:	eb 0c                	jmp    8032c6 <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  8032ba:	83 c3 01             	add    $0x1,%ebx
+  8032bd:	49 83 c4 18          	add    $0x18,%r12
+  8032c1:	83 fb 20             	cmp    $0x20,%ebx
+  8032c4:	74 1d                	je     8032e3 <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  8032c6:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  8032cb:	74 ed                	je     8032ba <file_flush_buffers+0x34>
+  8032cd:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8032d1:	89 df                	mov    %ebx,%edi
+  8032d3:	41 ff d5             	call   *%r13
+  8032d6:	85 c0                	test   %eax,%eax
+  8032d8:	78 e0                	js     8032ba <file_flush_buffers+0x34>
+  8032da:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8032de:	41 ff d6             	call   *%r14
+  8032e1:	eb d7                	jmp    8032ba <file_flush_buffers+0x34>
+}
+  8032e3:	48 83 c4 10          	add    $0x10,%rsp
+  8032e7:	5b                   	pop    %rbx
+  8032e8:	41 5c                	pop    %r12
+  8032ea:	41 5d                	pop    %r13
+  8032ec:	41 5e                	pop    %r14
+  8032ee:	5d                   	pop    %rbp
+  8032ef:	c3                   	ret
+
+00000000008032f0 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8032f0:	55                   	push   %rbp
+  8032f1:	48 89 e5             	mov    %rsp,%rbp
+  8032f4:	41 54                	push   %r12
+  8032f6:	53                   	push   %rbx
+  8032f7:	49 89 fc             	mov    %rdi,%r12
+  8032fa:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  8032fc:	48 b8 86 32 80 00 00 	movabs $0x803286,%rax
+  803303:	00 00 00 
+  803306:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  803308:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  80330f:	00 00 00 
+  803312:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  803317:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  803319:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  80331c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803321:	be 00 00 00 00       	mov    $0x0,%esi
+  803326:	bf 02 00 00 00       	mov    $0x2,%edi
+  80332b:	48 b8 57 27 80 00 00 	movabs $0x802757,%rax
+  803332:	00 00 00 
+  803335:	ff d0                	call   *%rax
+}
+  803337:	5b                   	pop    %rbx
+  803338:	41 5c                	pop    %r12
+  80333a:	5d                   	pop    %rbp
+  80333b:	c3                   	ret
+
+000000000080333c <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80333c:	55                   	push   %rbp
+  80333d:	48 89 e5             	mov    %rsp,%rbp
+  803340:	41 54                	push   %r12
+  803342:	53                   	push   %rbx
+  803343:	49 89 fc             	mov    %rdi,%r12
+  803346:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  803349:	48 b8 86 32 80 00 00 	movabs $0x803286,%rax
+  803350:	00 00 00 
+  803353:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803355:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  80335a:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  803361:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  803363:	ba 00 00 00 00       	mov    $0x0,%edx
+  803368:	be 00 00 00 00       	mov    $0x0,%esi
+  80336d:	bf 05 00 00 00       	mov    $0x5,%edi
+  803372:	48 b8 57 27 80 00 00 	movabs $0x802757,%rax
+  803379:	00 00 00 
+  80337c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80337e:	85 c0                	test   %eax,%eax
+  803380:	78 3d                	js     8033bf <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803382:	49 bc 00 00 83 00 00 	movabs $0x830000,%r12
+  803389:	00 00 00 
+  80338c:	4c 89 e6             	mov    %r12,%rsi
+  80338f:	48 89 df             	mov    %rbx,%rdi
+  803392:	48 b8 f9 0c 80 00 00 	movabs $0x800cf9,%rax
+  803399:	00 00 00 
+  80339c:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80339e:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8033a5:	00 
+  8033a6:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8033ac:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8033b3:	00 
+  8033b4:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8033ba:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8033bf:	5b                   	pop    %rbx
+  8033c0:	41 5c                	pop    %r12
+  8033c2:	5d                   	pop    %rbp
+  8033c3:	c3                   	ret
+
+00000000008033c4 <remove>:
+remove(const char *path) {
+  8033c4:	55                   	push   %rbp
+  8033c5:	48 89 e5             	mov    %rsp,%rbp
+  8033c8:	53                   	push   %rbx
+  8033c9:	48 83 ec 08          	sub    $0x8,%rsp
+  8033cd:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  8033d0:	48 b8 bb 0c 80 00 00 	movabs $0x800cbb,%rax
+  8033d7:	00 00 00 
+  8033da:	ff d0                	call   *%rax
+  8033dc:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8033e2:	77 3a                	ja     80341e <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  8033e4:	48 89 de             	mov    %rbx,%rsi
+  8033e7:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  8033ee:	00 00 00 
+  8033f1:	48 b8 f9 0c 80 00 00 	movabs $0x800cf9,%rax
+  8033f8:	00 00 00 
+  8033fb:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  8033fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  803402:	be 00 00 00 00       	mov    $0x0,%esi
+  803407:	bf 07 00 00 00       	mov    $0x7,%edi
+  80340c:	48 b8 57 27 80 00 00 	movabs $0x802757,%rax
+  803413:	00 00 00 
+  803416:	ff d0                	call   *%rax
+}
+  803418:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80341c:	c9                   	leave
+  80341d:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  80341e:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803423:	eb f3                	jmp    803418 <remove+0x54>
+
+0000000000803425 <sync>:
+sync(void) {
+  803425:	55                   	push   %rbp
+  803426:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  803429:	48 b8 86 32 80 00 00 	movabs $0x803286,%rax
+  803430:	00 00 00 
+  803433:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  803435:	ba 00 00 00 00       	mov    $0x0,%edx
+  80343a:	be 00 00 00 00       	mov    $0x0,%esi
+  80343f:	bf 08 00 00 00       	mov    $0x8,%edi
+  803444:	48 b8 57 27 80 00 00 	movabs $0x802757,%rax
+  80344b:	00 00 00 
+  80344e:	ff d0                	call   *%rax
+}
+  803450:	5d                   	pop    %rbp
+  803451:	c3                   	ret
+
+0000000000803452 <fsync>:
+fsync(int fdnum) {
+  803452:	55                   	push   %rbp
+  803453:	48 89 e5             	mov    %rsp,%rbp
+  803456:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80345a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80345e:	48 b8 00 1a 80 00 00 	movabs $0x801a00,%rax
+  803465:	00 00 00 
+  803468:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80346a:	85 c0                	test   %eax,%eax
+  80346c:	78 4b                	js     8034b9 <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80346e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803472:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  803479:	00 00 00 
+  80347c:	8b 00                	mov    (%rax),%eax
+  80347e:	39 02                	cmp    %eax,(%rdx)
+  803480:	75 39                	jne    8034bb <fsync+0x69>
+    file_flush_buffers();
+  803482:	48 b8 86 32 80 00 00 	movabs $0x803286,%rax
+  803489:	00 00 00 
+  80348c:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  80348e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803492:	8b 40 0c             	mov    0xc(%rax),%eax
+  803495:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  80349c:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  80349e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8034a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8034a8:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8034ad:	48 b8 57 27 80 00 00 	movabs $0x802757,%rax
+  8034b4:	00 00 00 
+  8034b7:	ff d0                	call   *%rax
+}
+  8034b9:	c9                   	leave
+  8034ba:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8034bb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8034c0:	eb f7                	jmp    8034b9 <fsync+0x67>
+
+00000000008034c2 <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  8034c2:	55                   	push   %rbp
+  8034c3:	48 89 e5             	mov    %rsp,%rbp
+  8034c6:	53                   	push   %rbx
+  8034c7:	48 83 ec 08          	sub    $0x8,%rsp
+  8034cb:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  8034ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8034d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8034d8:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8034dd:	48 b8 57 27 80 00 00 	movabs $0x802757,%rax
+  8034e4:	00 00 00 
+  8034e7:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8034e9:	85 c0                	test   %eax,%eax
+  8034eb:	78 2d                	js     80351a <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  8034ed:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  8034f4:	00 00 00 
+  8034f7:	48 8b 10             	mov    (%rax),%rdx
+  8034fa:	48 89 13             	mov    %rdx,(%rbx)
+  8034fd:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  803501:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  803505:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803509:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  80350d:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803511:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  803515:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80351a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80351e:	c9                   	leave
+  80351f:	c3                   	ret
+
+0000000000803520 <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  803520:	55                   	push   %rbp
+  803521:	48 89 e5             	mov    %rsp,%rbp
+  803524:	53                   	push   %rbx
+  803525:	48 83 ec 08          	sub    $0x8,%rsp
+  803529:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  80352c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803531:	be 00 00 00 00       	mov    $0x0,%esi
+  803536:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80353b:	48 b8 57 27 80 00 00 	movabs $0x802757,%rax
+  803542:	00 00 00 
+  803545:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803547:	85 c0                	test   %eax,%eax
+  803549:	78 3d                	js     803588 <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  80354b:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803552:	00 00 00 
+  803555:	48 8b 10             	mov    (%rax),%rdx
+  803558:	48 89 13             	mov    %rdx,(%rbx)
+  80355b:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80355f:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  803563:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803567:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  80356b:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  80356f:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  803573:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  803577:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  80357b:	48 8b 40 28          	mov    0x28(%rax),%rax
+  80357f:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  803583:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803588:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80358c:	c9                   	leave
+  80358d:	c3                   	ret
+
+000000000080358e <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  80358e:	55                   	push   %rbp
+  80358f:	48 89 e5             	mov    %rsp,%rbp
+  803592:	41 57                	push   %r15
+  803594:	41 56                	push   %r14
+  803596:	41 55                	push   %r13
+  803598:	41 54                	push   %r12
+  80359a:	53                   	push   %rbx
+  80359b:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  80359f:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  8035a6:	00 
+  8035a7:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  8035ae:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8035b4:	0f 85 43 01 00 00    	jne    8036fd <munmap+0x16f>
+  8035ba:	49 89 ff             	mov    %rdi,%r15
+  8035bd:	4c 39 f7             	cmp    %r14,%rdi
+  8035c0:	0f 87 37 01 00 00    	ja     8036fd <munmap+0x16f>
+  8035c6:	48 bb 00 20 82 00 00 	movabs $0x822000,%rbx
+  8035cd:	00 00 00 
+  8035d0:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  8035d6:	eb 2c                	jmp    803604 <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  8035d8:	4c 39 f8             	cmp    %r15,%rax
+  8035db:	0f 83 85 00 00 00    	jae    803666 <munmap+0xd8>
+            m->mm_end = start;
+  8035e1:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8035e6:	48 83 c3 18          	add    $0x18,%rbx
+  8035ea:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  8035f1:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8035f8:	00 00 00 
+  8035fb:	48 39 c3             	cmp    %rax,%rbx
+  8035fe:	0f 84 d0 00 00 00    	je     8036d4 <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  803604:	49 89 dc             	mov    %rbx,%r12
+  803607:	48 8b 03             	mov    (%rbx),%rax
+  80360a:	4c 39 f0             	cmp    %r14,%rax
+  80360d:	73 d7                	jae    8035e6 <munmap+0x58>
+  80360f:	48 85 c0             	test   %rax,%rax
+  803612:	74 d2                	je     8035e6 <munmap+0x58>
+  803614:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  803618:	49 39 d7             	cmp    %rdx,%r15
+  80361b:	73 c9                	jae    8035e6 <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  80361d:	49 39 d6             	cmp    %rdx,%r14
+  803620:	73 b6                	jae    8035d8 <munmap+0x4a>
+  803622:	49 39 c7             	cmp    %rax,%r15
+  803625:	76 b1                	jbe    8035d8 <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  803627:	4c 89 ef             	mov    %r13,%rdi
+  80362a:	48 b8 c5 26 80 00 00 	movabs $0x8026c5,%rax
+  803631:	00 00 00 
+  803634:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  803636:	48 85 c0             	test   %rax,%rax
+  803639:	0f 84 c5 00 00 00    	je     803704 <munmap+0x176>
+            *tail = *m;
+  80363f:	48 8b 13             	mov    (%rbx),%rdx
+  803642:	48 89 10             	mov    %rdx,(%rax)
+  803645:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  803649:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  80364d:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  803651:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  803655:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  803658:	44 89 f2             	mov    %r14d,%edx
+  80365b:	2b 13                	sub    (%rbx),%edx
+  80365d:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  803660:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  803664:	eb 80                	jmp    8035e6 <munmap+0x58>
+        } else if (m->mm_end > end) {
+  803666:	49 39 d6             	cmp    %rdx,%r14
+  803669:	73 18                	jae    803683 <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  80366b:	44 89 f2             	mov    %r14d,%edx
+  80366e:	41 03 54 24 10       	add    0x10(%r12),%edx
+  803673:	29 c2                	sub    %eax,%edx
+  803675:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  80367a:	4d 89 34 24          	mov    %r14,(%r12)
+  80367e:	e9 63 ff ff ff       	jmp    8035e6 <munmap+0x58>
+    m->mm_start = 0;
+  803683:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  80368a:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  80368b:	4c 89 e6             	mov    %r12,%rsi
+  80368e:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  803695:	00 00 00 
+  803698:	48 29 c6             	sub    %rax,%rsi
+  80369b:	48 c1 fe 03          	sar    $0x3,%rsi
+  80369f:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8036a6:	aa aa aa 
+  8036a9:	48 0f af f0          	imul   %rax,%rsi
+  8036ad:	48 c1 e6 0c          	shl    $0xc,%rsi
+  8036b1:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  8036b6:	48 01 c6             	add    %rax,%rsi
+  8036b9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8036be:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036c3:	48 b8 fe 12 80 00 00 	movabs $0x8012fe,%rax
+  8036ca:	00 00 00 
+  8036cd:	ff d0                	call   *%rax
+}
+  8036cf:	e9 12 ff ff ff       	jmp    8035e6 <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  8036d4:	4c 89 f2             	mov    %r14,%rdx
+  8036d7:	4c 29 fa             	sub    %r15,%rdx
+  8036da:	4c 89 fe             	mov    %r15,%rsi
+  8036dd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036e2:	48 b8 fe 12 80 00 00 	movabs $0x8012fe,%rax
+  8036e9:	00 00 00 
+  8036ec:	ff d0                	call   *%rax
+}
+  8036ee:	48 83 c4 08          	add    $0x8,%rsp
+  8036f2:	5b                   	pop    %rbx
+  8036f3:	41 5c                	pop    %r12
+  8036f5:	41 5d                	pop    %r13
+  8036f7:	41 5e                	pop    %r14
+  8036f9:	41 5f                	pop    %r15
+  8036fb:	5d                   	pop    %rbp
+  8036fc:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  8036fd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803702:	eb ea                	jmp    8036ee <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  803704:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  803709:	eb e3                	jmp    8036ee <munmap+0x160>
+
+000000000080370b <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  80370b:	55                   	push   %rbp
+  80370c:	48 89 e5             	mov    %rsp,%rbp
+  80370f:	41 57                	push   %r15
+  803711:	41 56                	push   %r14
+  803713:	41 55                	push   %r13
+  803715:	41 54                	push   %r12
+  803717:	53                   	push   %rbx
+  803718:	48 83 ec 28          	sub    $0x28,%rsp
+  80371c:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  803720:	49 89 f5             	mov    %rsi,%r13
+  803723:	41 89 d6             	mov    %edx,%r14d
+  803726:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  803729:	41 89 cc             	mov    %ecx,%r12d
+  80372c:	44 89 c7             	mov    %r8d,%edi
+  80372f:	44 89 cb             	mov    %r9d,%ebx
+  803732:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803736:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80373a:	48 b8 00 1a 80 00 00 	movabs $0x801a00,%rax
+  803741:	00 00 00 
+  803744:	ff d0                	call   *%rax
+  803746:	41 89 c7             	mov    %eax,%r15d
+  803749:	85 c0                	test   %eax,%eax
+  80374b:	0f 88 ae 01 00 00    	js     8038ff <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803751:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803755:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  80375c:	00 00 00 
+  80375f:	8b 32                	mov    (%rdx),%esi
+  803761:	39 30                	cmp    %esi,(%rax)
+  803763:	0f 85 7a 02 00 00    	jne    8039e3 <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  803769:	8b 40 08             	mov    0x8(%rax),%eax
+  80376c:	83 e0 03             	and    $0x3,%eax
+  80376f:	83 f8 01             	cmp    $0x1,%eax
+  803772:	0f 84 76 02 00 00    	je     8039ee <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  803778:	4d 85 ed             	test   %r13,%r13
+  80377b:	0f 84 78 02 00 00    	je     8039f9 <mmap+0x2ee>
+  803781:	85 db                	test   %ebx,%ebx
+  803783:	0f 88 70 02 00 00    	js     8039f9 <mmap+0x2ee>
+  803789:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  80378f:	41 89 df             	mov    %ebx,%r15d
+  803792:	0f 85 6c 02 00 00    	jne    803a04 <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  803798:	44 89 f0             	mov    %r14d,%eax
+  80379b:	83 e0 fd             	and    $0xfffffffd,%eax
+  80379e:	83 f8 04             	cmp    $0x4,%eax
+  8037a1:	0f 85 68 02 00 00    	jne    803a0f <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  8037a7:	44 89 e1             	mov    %r12d,%ecx
+  8037aa:	83 e1 01             	and    $0x1,%ecx
+  8037ad:	0f 95 c2             	setne  %dl
+  8037b0:	44 89 e0             	mov    %r12d,%eax
+  8037b3:	d1 e8                	shr    %eax
+  8037b5:	83 f0 01             	xor    $0x1,%eax
+  8037b8:	83 e0 01             	and    $0x1,%eax
+  8037bb:	38 c2                	cmp    %al,%dl
+  8037bd:	0f 85 57 02 00 00    	jne    803a1a <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  8037c3:	85 c9                	test   %ecx,%ecx
+  8037c5:	74 0a                	je     8037d1 <mmap+0xc6>
+  8037c7:	41 f6 c6 02          	test   $0x2,%r14b
+  8037cb:	0f 85 54 02 00 00    	jne    803a25 <mmap+0x31a>
+    file_flush_buffers();
+  8037d1:	48 b8 86 32 80 00 00 	movabs $0x803286,%rax
+  8037d8:	00 00 00 
+  8037db:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  8037dd:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  8037e4:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  8037eb:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8037ef:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  8037f2:	41 f6 c4 04          	test   $0x4,%r12b
+  8037f6:	0f 84 15 01 00 00    	je     803911 <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  8037fc:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  8037ff:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  803805:	0f 85 25 02 00 00    	jne    803a30 <mmap+0x325>
+  80380b:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  80380f:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  803816:	00 00 00 
+  803819:	48 39 c2             	cmp    %rax,%rdx
+  80381c:	0f 82 19 02 00 00    	jb     803a3b <mmap+0x330>
+  803822:	48 39 c7             	cmp    %rax,%rdi
+  803825:	0f 87 10 02 00 00    	ja     803a3b <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  80382b:	4c 89 ee             	mov    %r13,%rsi
+  80382e:	48 b8 8e 35 80 00 00 	movabs $0x80358e,%rax
+  803835:	00 00 00 
+  803838:	ff d0                	call   *%rax
+  80383a:	85 c0                	test   %eax,%eax
+  80383c:	0f 88 04 02 00 00    	js     803a46 <mmap+0x33b>
+    if (!handler) {
+  803842:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  803849:	00 00 00 
+  80384c:	80 38 00             	cmpb   $0x0,(%rax)
+  80384f:	75 2b                	jne    80387c <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  803851:	48 bf 26 26 80 00 00 	movabs $0x802626,%rdi
+  803858:	00 00 00 
+  80385b:	48 b8 e7 46 80 00 00 	movabs $0x8046e7,%rax
+  803862:	00 00 00 
+  803865:	ff d0                	call   *%rax
+  803867:	85 c0                	test   %eax,%eax
+  803869:	0f 88 ea 01 00 00    	js     803a59 <mmap+0x34e>
+        handler = 1;
+  80386f:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  803876:	00 00 00 
+  803879:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  80387c:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803880:	48 b8 c5 26 80 00 00 	movabs $0x8026c5,%rax
+  803887:	00 00 00 
+  80388a:	ff d0                	call   *%rax
+  80388c:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  80388f:	48 85 c0             	test   %rax,%rax
+  803892:	0f 84 c9 01 00 00    	je     803a61 <mmap+0x356>
+    m->mm_start = va;
+  803898:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  80389b:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  80389f:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  8038a3:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  8038a6:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  8038aa:	44 89 e0             	mov    %r12d,%eax
+  8038ad:	c1 e0 06             	shl    $0x6,%eax
+  8038b0:	25 80 00 00 00       	and    $0x80,%eax
+  8038b5:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  8038b8:	09 f0                	or     %esi,%eax
+  8038ba:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  8038be:	41 f6 c4 08          	test   $0x8,%r12b
+  8038c2:	74 31                	je     8038f5 <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  8038c4:	48 39 d3             	cmp    %rdx,%rbx
+  8038c7:	73 2c                	jae    8038f5 <mmap+0x1ea>
+  8038c9:	ba 00 00 04 00       	mov    $0x40000,%edx
+  8038ce:	48 89 de             	mov    %rbx,%rsi
+  8038d1:	4c 89 f7             	mov    %r14,%rdi
+  8038d4:	48 b8 15 25 80 00 00 	movabs $0x802515,%rax
+  8038db:	00 00 00 
+  8038de:	ff d0                	call   *%rax
+  8038e0:	49 89 c4             	mov    %rax,%r12
+  8038e3:	48 85 c0             	test   %rax,%rax
+  8038e6:	0f 8e d7 00 00 00    	jle    8039c3 <mmap+0x2b8>
+            va += n;
+  8038ec:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  8038ef:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  8038f3:	72 d4                	jb     8038c9 <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  8038f5:	49 8b 06             	mov    (%r14),%rax
+  8038f8:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  8038fc:	48 89 06             	mov    %rax,(%rsi)
+}
+  8038ff:	44 89 f8             	mov    %r15d,%eax
+  803902:	48 83 c4 28          	add    $0x28,%rsp
+  803906:	5b                   	pop    %rbx
+  803907:	41 5c                	pop    %r12
+  803909:	41 5d                	pop    %r13
+  80390b:	41 5e                	pop    %r14
+  80390d:	41 5f                	pop    %r15
+  80390f:	5d                   	pop    %rbp
+  803910:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803911:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  803918:	00 00 00 
+  80391b:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  80391e:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  803925:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803928:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  80392d:	48 be 00 20 82 00 00 	movabs $0x822000,%rsi
+  803934:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803937:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  80393e:	00 00 00 
+  803941:	48 39 d7             	cmp    %rdx,%rdi
+  803944:	73 1c                	jae    803962 <mmap+0x257>
+        return -E_NO_MEM;
+  803946:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80394c:	eb b1                	jmp    8038ff <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80394e:	48 83 c0 01          	add    $0x1,%rax
+  803952:	48 83 f8 1f          	cmp    $0x1f,%rax
+  803956:	77 3f                	ja     803997 <mmap+0x28c>
+  803958:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  80395d:	48 39 d7             	cmp    %rdx,%rdi
+  803960:	72 2a                	jb     80398c <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  803962:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  803966:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  80396a:	48 39 d1             	cmp    %rdx,%rcx
+  80396d:	73 df                	jae    80394e <mmap+0x243>
+  80396f:	48 85 c9             	test   %rcx,%rcx
+  803972:	74 da                	je     80394e <mmap+0x243>
+  803974:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  803978:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  80397d:	48 39 d3             	cmp    %rdx,%rbx
+  803980:	73 cc                	jae    80394e <mmap+0x243>
+            va = mmaps[i].mm_end;
+  803982:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803985:	b8 00 00 00 00       	mov    $0x0,%eax
+  80398a:	eb cc                	jmp    803958 <mmap+0x24d>
+        return -E_NO_MEM;
+  80398c:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803992:	e9 68 ff ff ff       	jmp    8038ff <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  803997:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  80399c:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  8039a3:	00 00 00 
+  8039a6:	48 39 c2             	cmp    %rax,%rdx
+  8039a9:	0f 82 9f 00 00 00    	jb     803a4e <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  8039af:	48 85 db             	test   %rbx,%rbx
+  8039b2:	0f 85 8a fe ff ff    	jne    803842 <mmap+0x137>
+        return -E_NO_MEM;
+  8039b8:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8039be:	e9 3c ff ff ff       	jmp    8038ff <mmap+0x1f4>
+        if (n < 0) {
+  8039c3:	0f 89 2c ff ff ff    	jns    8038f5 <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  8039c9:	49 8b 3e             	mov    (%r14),%rdi
+  8039cc:	4c 89 ee             	mov    %r13,%rsi
+  8039cf:	48 b8 8e 35 80 00 00 	movabs $0x80358e,%rax
+  8039d6:	00 00 00 
+  8039d9:	ff d0                	call   *%rax
+            return n;
+  8039db:	45 89 e7             	mov    %r12d,%r15d
+  8039de:	e9 1c ff ff ff       	jmp    8038ff <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8039e3:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8039e9:	e9 11 ff ff ff       	jmp    8038ff <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  8039ee:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8039f4:	e9 06 ff ff ff       	jmp    8038ff <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  8039f9:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8039ff:	e9 fb fe ff ff       	jmp    8038ff <mmap+0x1f4>
+  803a04:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803a0a:	e9 f0 fe ff ff       	jmp    8038ff <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  803a0f:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803a15:	e9 e5 fe ff ff       	jmp    8038ff <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  803a1a:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803a20:	e9 da fe ff ff       	jmp    8038ff <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  803a25:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  803a2b:	e9 cf fe ff ff       	jmp    8038ff <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  803a30:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803a36:	e9 c4 fe ff ff       	jmp    8038ff <mmap+0x1f4>
+  803a3b:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803a41:	e9 b9 fe ff ff       	jmp    8038ff <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  803a46:	41 89 c7             	mov    %eax,%r15d
+  803a49:	e9 b1 fe ff ff       	jmp    8038ff <mmap+0x1f4>
+        return -E_NO_MEM;
+  803a4e:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803a54:	e9 a6 fe ff ff       	jmp    8038ff <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  803a59:	41 89 c7             	mov    %eax,%r15d
+  803a5c:	e9 9e fe ff ff       	jmp    8038ff <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  803a61:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803a67:	e9 93 fe ff ff       	jmp    8038ff <mmap+0x1f4>
+
+0000000000803a6c <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803a6c:	55                   	push   %rbp
+  803a6d:	48 89 e5             	mov    %rsp,%rbp
+  803a70:	41 54                	push   %r12
+  803a72:	53                   	push   %rbx
+  803a73:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803a76:	48 b8 84 19 80 00 00 	movabs $0x801984,%rax
+  803a7d:	00 00 00 
+  803a80:	ff d0                	call   *%rax
+  803a82:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803a85:	48 be a0 50 80 00 00 	movabs $0x8050a0,%rsi
+  803a8c:	00 00 00 
+  803a8f:	48 89 df             	mov    %rbx,%rdi
+  803a92:	48 b8 f9 0c 80 00 00 	movabs $0x800cf9,%rax
+  803a99:	00 00 00 
+  803a9c:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803a9e:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803aa3:	41 2b 04 24          	sub    (%r12),%eax
+  803aa7:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803aad:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803ab4:	00 00 00 
+    stat->st_dev = &devpipe;
+  803ab7:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803abe:	00 00 00 
+  803ac1:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803ac8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803acd:	5b                   	pop    %rbx
+  803ace:	41 5c                	pop    %r12
+  803ad0:	5d                   	pop    %rbp
+  803ad1:	c3                   	ret
+
+0000000000803ad2 <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  803ad2:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803ad5:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  803adb:	8b 17                	mov    (%rdi),%edx
+  803add:	85 d2                	test   %edx,%edx
+  803adf:	75 01                	jne    803ae2 <pipe_wakeup+0x10>
+  803ae1:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  803ae2:	55                   	push   %rbp
+  803ae3:	48 89 e5             	mov    %rsp,%rbp
+  803ae6:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  803ae9:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  803aef:	be 00 04 00 00       	mov    $0x400,%esi
+  803af4:	48 b8 e4 15 80 00 00 	movabs $0x8015e4,%rax
+  803afb:	00 00 00 
+  803afe:	ff d0                	call   *%rax
+}
+  803b00:	5d                   	pop    %rbp
+  803b01:	c3                   	ret
+
+0000000000803b02 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803b02:	55                   	push   %rbp
+  803b03:	48 89 e5             	mov    %rsp,%rbp
+  803b06:	41 55                	push   %r13
+  803b08:	41 54                	push   %r12
+  803b0a:	53                   	push   %rbx
+  803b0b:	48 83 ec 08          	sub    $0x8,%rsp
+  803b0f:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803b12:	48 b8 84 19 80 00 00 	movabs $0x801984,%rax
+  803b19:	00 00 00 
+  803b1c:	ff d0                	call   *%rax
+  803b1e:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803b21:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b26:	4c 89 e6             	mov    %r12,%rsi
+  803b29:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b2e:	49 bc fe 12 80 00 00 	movabs $0x8012fe,%r12
+  803b35:	00 00 00 
+  803b38:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803b3b:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803b3f:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803b43:	49 bd d2 3a 80 00 00 	movabs $0x803ad2,%r13
+  803b4a:	00 00 00 
+  803b4d:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803b50:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803b54:	48 89 de             	mov    %rbx,%rsi
+  803b57:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  803b5a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b5f:	48 89 de             	mov    %rbx,%rsi
+  803b62:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b67:	41 ff d4             	call   *%r12
+  803b6a:	48 83 c4 08          	add    $0x8,%rsp
+  803b6e:	5b                   	pop    %rbx
+  803b6f:	41 5c                	pop    %r12
+  803b71:	41 5d                	pop    %r13
+  803b73:	5d                   	pop    %rbp
+  803b74:	c3                   	ret
+
+0000000000803b75 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  803b75:	55                   	push   %rbp
+  803b76:	48 89 e5             	mov    %rsp,%rbp
+  803b79:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803b7c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803b81:	be 00 10 00 00       	mov    $0x1000,%esi
+  803b86:	48 b8 41 12 80 00 00 	movabs $0x801241,%rax
+  803b8d:	00 00 00 
+  803b90:	ff d0                	call   *%rax
+  803b92:	85 c0                	test   %eax,%eax
+  803b94:	0f 94 c0             	sete   %al
+  803b97:	0f b6 c0             	movzbl %al,%eax
+}
+  803b9a:	5d                   	pop    %rbp
+  803b9b:	c3                   	ret
+
+0000000000803b9c <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803b9c:	55                   	push   %rbp
+  803b9d:	48 89 e5             	mov    %rsp,%rbp
+  803ba0:	41 57                	push   %r15
+  803ba2:	41 56                	push   %r14
+  803ba4:	41 55                	push   %r13
+  803ba6:	41 54                	push   %r12
+  803ba8:	53                   	push   %rbx
+  803ba9:	48 83 ec 38          	sub    $0x38,%rsp
+  803bad:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803bb1:	49 89 f4             	mov    %rsi,%r12
+  803bb4:	49 89 d7             	mov    %rdx,%r15
+  803bb7:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803bbb:	48 b8 84 19 80 00 00 	movabs $0x801984,%rax
+  803bc2:	00 00 00 
+  803bc5:	ff d0                	call   *%rax
+  803bc7:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803bca:	4d 85 ff             	test   %r15,%r15
+  803bcd:	0f 84 f1 00 00 00    	je     803cc4 <devpipe_write+0x128>
+  803bd3:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  803bd7:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  803bdb:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  803bdf:	49 bd 75 3b 80 00 00 	movabs $0x803b75,%r13
+  803be6:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803be9:	49 bf d2 3a 80 00 00 	movabs $0x803ad2,%r15
+  803bf0:	00 00 00 
+  803bf3:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803bf7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803bfb:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803bff:	8b 73 04             	mov    0x4(%rbx),%esi
+  803c02:	48 63 ce             	movslq %esi,%rcx
+  803c05:	48 63 03             	movslq (%rbx),%rax
+  803c08:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  803c0e:	48 39 c1             	cmp    %rax,%rcx
+  803c11:	72 64                	jb     803c77 <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  803c13:	48 89 de             	mov    %rbx,%rsi
+  803c16:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803c1a:	41 ff d5             	call   *%r13
+  803c1d:	85 c0                	test   %eax,%eax
+  803c1f:	0f 85 b9 00 00 00    	jne    803cde <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803c25:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803c29:	4c 89 f7             	mov    %r14,%rdi
+  803c2c:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  803c2f:	8b 43 04             	mov    0x4(%rbx),%eax
+  803c32:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  803c39:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803c40:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803c46:	8b 03                	mov    (%rbx),%eax
+  803c48:	41 39 c4             	cmp    %eax,%r12d
+  803c4b:	75 b2                	jne    803bff <devpipe_write+0x63>
+  803c4d:	48 89 de             	mov    %rbx,%rsi
+  803c50:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803c54:	41 ff d5             	call   *%r13
+  803c57:	85 c0                	test   %eax,%eax
+  803c59:	75 a0                	jne    803bfb <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803c5b:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803c60:	44 89 e6             	mov    %r12d,%esi
+  803c63:	48 89 df             	mov    %rbx,%rdi
+  803c66:	48 b8 c6 15 80 00 00 	movabs $0x8015c6,%rax
+  803c6d:	00 00 00 
+  803c70:	ff d0                	call   *%rax
+  803c72:	e9 7c ff ff ff       	jmp    803bf3 <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803c77:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  803c7b:	41 0f b6 38          	movzbl (%r8),%edi
+  803c7f:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803c86:	80 80 80 
+  803c89:	48 89 c8             	mov    %rcx,%rax
+  803c8c:	48 f7 e2             	mul    %rdx
+  803c8f:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803c93:	48 89 d0             	mov    %rdx,%rax
+  803c96:	48 c1 e0 08          	shl    $0x8,%rax
+  803c9a:	48 29 d0             	sub    %rdx,%rax
+  803c9d:	48 c1 e0 04          	shl    $0x4,%rax
+  803ca1:	48 29 c1             	sub    %rax,%rcx
+  803ca4:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  803ca9:	83 c6 01             	add    $0x1,%esi
+  803cac:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803caf:	49 83 c0 01          	add    $0x1,%r8
+  803cb3:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  803cb7:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803cbb:	49 39 c0             	cmp    %rax,%r8
+  803cbe:	0f 85 2f ff ff ff    	jne    803bf3 <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803cc4:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803cc8:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803ccc:	48 b8 d2 3a 80 00 00 	movabs $0x803ad2,%rax
+  803cd3:	00 00 00 
+  803cd6:	ff d0                	call   *%rax
+    return n;
+  803cd8:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803cdc:	eb 05                	jmp    803ce3 <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  803cde:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ce3:	48 83 c4 38          	add    $0x38,%rsp
+  803ce7:	5b                   	pop    %rbx
+  803ce8:	41 5c                	pop    %r12
+  803cea:	41 5d                	pop    %r13
+  803cec:	41 5e                	pop    %r14
+  803cee:	41 5f                	pop    %r15
+  803cf0:	5d                   	pop    %rbp
+  803cf1:	c3                   	ret
+
+0000000000803cf2 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803cf2:	55                   	push   %rbp
+  803cf3:	48 89 e5             	mov    %rsp,%rbp
+  803cf6:	41 57                	push   %r15
+  803cf8:	41 56                	push   %r14
+  803cfa:	41 55                	push   %r13
+  803cfc:	41 54                	push   %r12
+  803cfe:	53                   	push   %rbx
+  803cff:	48 83 ec 28          	sub    $0x28,%rsp
+  803d03:	49 89 fd             	mov    %rdi,%r13
+  803d06:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  803d0a:	49 89 d4             	mov    %rdx,%r12
+  803d0d:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803d11:	48 b8 84 19 80 00 00 	movabs $0x801984,%rax
+  803d18:	00 00 00 
+  803d1b:	ff d0                	call   *%rax
+  803d1d:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803d20:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  803d26:	49 bf 75 3b 80 00 00 	movabs $0x803b75,%r15
+  803d2d:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803d30:	4d 85 e4             	test   %r12,%r12
+  803d33:	0f 84 d5 00 00 00    	je     803e0e <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803d39:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803d3d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803d41:	8b 03                	mov    (%rbx),%eax
+  803d43:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803d46:	75 7a                	jne    803dc2 <devpipe_read+0xd0>
+            if (i > 0) {
+  803d48:	4d 85 f6             	test   %r14,%r14
+  803d4b:	75 50                	jne    803d9d <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  803d4d:	48 89 de             	mov    %rbx,%rsi
+  803d50:	4c 89 ef             	mov    %r13,%rdi
+  803d53:	41 ff d7             	call   *%r15
+  803d56:	85 c0                	test   %eax,%eax
+  803d58:	0f 85 c9 00 00 00    	jne    803e27 <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803d5e:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  803d61:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803d68:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803d6e:	8b 43 04             	mov    0x4(%rbx),%eax
+  803d71:	41 39 c4             	cmp    %eax,%r12d
+  803d74:	75 cb                	jne    803d41 <devpipe_read+0x4f>
+  803d76:	48 89 de             	mov    %rbx,%rsi
+  803d79:	4c 89 ef             	mov    %r13,%rdi
+  803d7c:	41 ff d7             	call   *%r15
+  803d7f:	85 c0                	test   %eax,%eax
+  803d81:	75 be                	jne    803d41 <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803d83:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803d88:	44 89 e6             	mov    %r12d,%esi
+  803d8b:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803d8f:	48 b8 c6 15 80 00 00 	movabs $0x8015c6,%rax
+  803d96:	00 00 00 
+  803d99:	ff d0                	call   *%rax
+  803d9b:	eb a4                	jmp    803d41 <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803d9d:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803da1:	48 89 de             	mov    %rbx,%rsi
+  803da4:	48 b8 d2 3a 80 00 00 	movabs $0x803ad2,%rax
+  803dab:	00 00 00 
+  803dae:	ff d0                	call   *%rax
+                return i;
+  803db0:	4c 89 f0             	mov    %r14,%rax
+}
+  803db3:	48 83 c4 28          	add    $0x28,%rsp
+  803db7:	5b                   	pop    %rbx
+  803db8:	41 5c                	pop    %r12
+  803dba:	41 5d                	pop    %r13
+  803dbc:	41 5e                	pop    %r14
+  803dbe:	41 5f                	pop    %r15
+  803dc0:	5d                   	pop    %rbp
+  803dc1:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803dc2:	48 63 c8             	movslq %eax,%rcx
+  803dc5:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803dcc:	80 80 80 
+  803dcf:	48 89 c8             	mov    %rcx,%rax
+  803dd2:	48 f7 e2             	mul    %rdx
+  803dd5:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803dd9:	48 89 d0             	mov    %rdx,%rax
+  803ddc:	48 c1 e0 08          	shl    $0x8,%rax
+  803de0:	48 29 d0             	sub    %rdx,%rax
+  803de3:	48 c1 e0 04          	shl    $0x4,%rax
+  803de7:	48 89 c2             	mov    %rax,%rdx
+  803dea:	48 89 c8             	mov    %rcx,%rax
+  803ded:	48 29 d0             	sub    %rdx,%rax
+  803df0:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  803df5:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803df9:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  803dfd:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803e00:	49 83 c6 01          	add    $0x1,%r14
+  803e04:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  803e08:	0f 85 2b ff ff ff    	jne    803d39 <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803e0e:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803e12:	48 89 de             	mov    %rbx,%rsi
+  803e15:	48 b8 d2 3a 80 00 00 	movabs $0x803ad2,%rax
+  803e1c:	00 00 00 
+  803e1f:	ff d0                	call   *%rax
+    return n;
+  803e21:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803e25:	eb 8c                	jmp    803db3 <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  803e27:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e2c:	eb 85                	jmp    803db3 <devpipe_read+0xc1>
+
+0000000000803e2e <pipe>:
+pipe(int pfd[2]) {
+  803e2e:	55                   	push   %rbp
+  803e2f:	48 89 e5             	mov    %rsp,%rbp
+  803e32:	41 55                	push   %r13
+  803e34:	41 54                	push   %r12
+  803e36:	53                   	push   %rbx
+  803e37:	48 83 ec 18          	sub    $0x18,%rsp
+  803e3b:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803e3e:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803e42:	48 b8 a0 19 80 00 00 	movabs $0x8019a0,%rax
+  803e49:	00 00 00 
+  803e4c:	ff d0                	call   *%rax
+  803e4e:	89 c3                	mov    %eax,%ebx
+  803e50:	85 c0                	test   %eax,%eax
+  803e52:	0f 88 a0 01 00 00    	js     803ff8 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803e58:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803e5d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803e62:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803e66:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e6b:	48 b8 58 12 80 00 00 	movabs $0x801258,%rax
+  803e72:	00 00 00 
+  803e75:	ff d0                	call   *%rax
+  803e77:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803e79:	85 c0                	test   %eax,%eax
+  803e7b:	0f 88 77 01 00 00    	js     803ff8 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803e81:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803e85:	48 b8 a0 19 80 00 00 	movabs $0x8019a0,%rax
+  803e8c:	00 00 00 
+  803e8f:	ff d0                	call   *%rax
+  803e91:	89 c3                	mov    %eax,%ebx
+  803e93:	85 c0                	test   %eax,%eax
+  803e95:	0f 88 43 01 00 00    	js     803fde <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803e9b:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803ea0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ea5:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803ea9:	bf 00 00 00 00       	mov    $0x0,%edi
+  803eae:	48 b8 58 12 80 00 00 	movabs $0x801258,%rax
+  803eb5:	00 00 00 
+  803eb8:	ff d0                	call   *%rax
+  803eba:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803ebc:	85 c0                	test   %eax,%eax
+  803ebe:	0f 88 1a 01 00 00    	js     803fde <pipe+0x1b0>
+    va = fd2data(fd0);
+  803ec4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803ec8:	48 b8 84 19 80 00 00 	movabs $0x801984,%rax
+  803ecf:	00 00 00 
+  803ed2:	ff d0                	call   *%rax
+  803ed4:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803ed7:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803edc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ee1:	48 89 c6             	mov    %rax,%rsi
+  803ee4:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ee9:	48 b8 58 12 80 00 00 	movabs $0x801258,%rax
+  803ef0:	00 00 00 
+  803ef3:	ff d0                	call   *%rax
+  803ef5:	89 c3                	mov    %eax,%ebx
+  803ef7:	85 c0                	test   %eax,%eax
+  803ef9:	0f 88 c5 00 00 00    	js     803fc4 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803eff:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803f03:	48 b8 84 19 80 00 00 	movabs $0x801984,%rax
+  803f0a:	00 00 00 
+  803f0d:	ff d0                	call   *%rax
+  803f0f:	48 89 c1             	mov    %rax,%rcx
+  803f12:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803f18:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803f1e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803f23:	4c 89 ee             	mov    %r13,%rsi
+  803f26:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f2b:	48 b8 ae 12 80 00 00 	movabs $0x8012ae,%rax
+  803f32:	00 00 00 
+  803f35:	ff d0                	call   *%rax
+  803f37:	89 c3                	mov    %eax,%ebx
+  803f39:	85 c0                	test   %eax,%eax
+  803f3b:	78 6e                	js     803fab <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803f3d:	be 00 10 00 00       	mov    $0x1000,%esi
+  803f42:	4c 89 ef             	mov    %r13,%rdi
+  803f45:	48 b8 1d 12 80 00 00 	movabs $0x80121d,%rax
+  803f4c:	00 00 00 
+  803f4f:	ff d0                	call   *%rax
+  803f51:	83 f8 02             	cmp    $0x2,%eax
+  803f54:	0f 85 ab 00 00 00    	jne    804005 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803f5a:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803f61:	00 00 
+  803f63:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803f67:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803f69:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803f6d:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803f74:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803f78:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803f7a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803f7e:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803f85:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803f89:	48 bb 72 19 80 00 00 	movabs $0x801972,%rbx
+  803f90:	00 00 00 
+  803f93:	ff d3                	call   *%rbx
+  803f95:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803f99:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803f9d:	ff d3                	call   *%rbx
+  803f9f:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803fa4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803fa9:	eb 4d                	jmp    803ff8 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803fab:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803fb0:	4c 89 ee             	mov    %r13,%rsi
+  803fb3:	bf 00 00 00 00       	mov    $0x0,%edi
+  803fb8:	48 b8 fe 12 80 00 00 	movabs $0x8012fe,%rax
+  803fbf:	00 00 00 
+  803fc2:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803fc4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803fc9:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803fcd:	bf 00 00 00 00       	mov    $0x0,%edi
+  803fd2:	48 b8 fe 12 80 00 00 	movabs $0x8012fe,%rax
+  803fd9:	00 00 00 
+  803fdc:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803fde:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803fe3:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803fe7:	bf 00 00 00 00       	mov    $0x0,%edi
+  803fec:	48 b8 fe 12 80 00 00 	movabs $0x8012fe,%rax
+  803ff3:	00 00 00 
+  803ff6:	ff d0                	call   *%rax
+}
+  803ff8:	89 d8                	mov    %ebx,%eax
+  803ffa:	48 83 c4 18          	add    $0x18,%rsp
+  803ffe:	5b                   	pop    %rbx
+  803fff:	41 5c                	pop    %r12
+  804001:	41 5d                	pop    %r13
+  804003:	5d                   	pop    %rbp
+  804004:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804005:	48 b9 d0 50 80 00 00 	movabs $0x8050d0,%rcx
+  80400c:	00 00 00 
+  80400f:	48 ba a7 50 80 00 00 	movabs $0x8050a7,%rdx
+  804016:	00 00 00 
+  804019:	be 50 00 00 00       	mov    $0x50,%esi
+  80401e:	48 bf bc 50 80 00 00 	movabs $0x8050bc,%rdi
+  804025:	00 00 00 
+  804028:	b8 00 00 00 00       	mov    $0x0,%eax
+  80402d:	49 b8 84 02 80 00 00 	movabs $0x800284,%r8
+  804034:	00 00 00 
+  804037:	41 ff d0             	call   *%r8
+
+000000000080403a <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80403a:	55                   	push   %rbp
+  80403b:	48 89 e5             	mov    %rsp,%rbp
+  80403e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804042:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804046:	48 b8 00 1a 80 00 00 	movabs $0x801a00,%rax
+  80404d:	00 00 00 
+  804050:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804052:	85 c0                	test   %eax,%eax
+  804054:	78 23                	js     804079 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  804056:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80405a:	48 b8 84 19 80 00 00 	movabs $0x801984,%rax
+  804061:	00 00 00 
+  804064:	ff d0                	call   *%rax
+  804066:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  804069:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80406d:	48 b8 75 3b 80 00 00 	movabs $0x803b75,%rax
+  804074:	00 00 00 
+  804077:	ff d0                	call   *%rax
+}
+  804079:	c9                   	leave
+  80407a:	c3                   	ret
+
+000000000080407b <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80407b:	48 89 f8             	mov    %rdi,%rax
+  80407e:	48 c1 e8 27          	shr    $0x27,%rax
+  804082:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804089:	01 00 00 
+  80408c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804090:	f6 c2 01             	test   $0x1,%dl
+  804093:	74 6d                	je     804102 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804095:	48 89 f8             	mov    %rdi,%rax
+  804098:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80409c:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8040a3:	01 00 00 
+  8040a6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8040aa:	f6 c2 01             	test   $0x1,%dl
+  8040ad:	74 62                	je     804111 <get_uvpt_entry+0x96>
+  8040af:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8040b6:	01 00 00 
+  8040b9:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8040bd:	f6 c2 80             	test   $0x80,%dl
+  8040c0:	75 4f                	jne    804111 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8040c2:	48 89 f8             	mov    %rdi,%rax
+  8040c5:	48 c1 e8 15          	shr    $0x15,%rax
+  8040c9:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8040d0:	01 00 00 
+  8040d3:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8040d7:	f6 c2 01             	test   $0x1,%dl
+  8040da:	74 44                	je     804120 <get_uvpt_entry+0xa5>
+  8040dc:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8040e3:	01 00 00 
+  8040e6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8040ea:	f6 c2 80             	test   $0x80,%dl
+  8040ed:	75 31                	jne    804120 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8040ef:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8040f3:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8040fa:	01 00 00 
+  8040fd:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  804101:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804102:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804109:	01 00 00 
+  80410c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804110:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804111:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804118:	01 00 00 
+  80411b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80411f:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804120:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804127:	01 00 00 
+  80412a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80412e:	c3                   	ret
+
+000000000080412f <get_prot>:
+
+int
+get_prot(void *va) {
+  80412f:	55                   	push   %rbp
+  804130:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804133:	48 b8 7b 40 80 00 00 	movabs $0x80407b,%rax
+  80413a:	00 00 00 
+  80413d:	ff d0                	call   *%rax
+  80413f:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  804142:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  804147:	89 c1                	mov    %eax,%ecx
+  804149:	83 c9 04             	or     $0x4,%ecx
+  80414c:	f6 c2 01             	test   $0x1,%dl
+  80414f:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  804152:	89 c1                	mov    %eax,%ecx
+  804154:	83 c9 02             	or     $0x2,%ecx
+  804157:	f6 c2 02             	test   $0x2,%dl
+  80415a:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80415d:	89 c1                	mov    %eax,%ecx
+  80415f:	83 c9 01             	or     $0x1,%ecx
+  804162:	48 85 d2             	test   %rdx,%rdx
+  804165:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804168:	89 c1                	mov    %eax,%ecx
+  80416a:	83 c9 40             	or     $0x40,%ecx
+  80416d:	f6 c6 04             	test   $0x4,%dh
+  804170:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804173:	5d                   	pop    %rbp
+  804174:	c3                   	ret
+
+0000000000804175 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804175:	55                   	push   %rbp
+  804176:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804179:	48 b8 7b 40 80 00 00 	movabs $0x80407b,%rax
+  804180:	00 00 00 
+  804183:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804185:	48 c1 e8 06          	shr    $0x6,%rax
+  804189:	83 e0 01             	and    $0x1,%eax
+}
+  80418c:	5d                   	pop    %rbp
+  80418d:	c3                   	ret
+
+000000000080418e <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80418e:	55                   	push   %rbp
+  80418f:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804192:	48 b8 7b 40 80 00 00 	movabs $0x80407b,%rax
+  804199:	00 00 00 
+  80419c:	ff d0                	call   *%rax
+  80419e:	83 e0 01             	and    $0x1,%eax
+}
+  8041a1:	5d                   	pop    %rbp
+  8041a2:	c3                   	ret
+
+00000000008041a3 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  8041a3:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  8041aa:	01 00 00 
+  8041ad:	a8 01                	test   $0x1,%al
+  8041af:	75 06                	jne    8041b7 <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  8041b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041b6:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8041b7:	55                   	push   %rbp
+  8041b8:	48 89 e5             	mov    %rsp,%rbp
+  8041bb:	41 57                	push   %r15
+  8041bd:	41 56                	push   %r14
+  8041bf:	41 55                	push   %r13
+  8041c1:	41 54                	push   %r12
+  8041c3:	53                   	push   %rbx
+  8041c4:	48 83 ec 28          	sub    $0x28,%rsp
+  8041c8:	49 89 fe             	mov    %rdi,%r14
+  8041cb:	49 89 f7             	mov    %rsi,%r15
+  8041ce:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  8041d5:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  8041d6:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  8041dd:	01 00 00 
+  8041e0:	e9 ae 00 00 00       	jmp    804293 <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  8041e5:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8041ec:	49 83 ec 01          	sub    $0x1,%r12
+  8041f0:	74 2d                	je     80421f <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  8041f2:	48 89 d8             	mov    %rbx,%rax
+  8041f5:	48 c1 e8 0c          	shr    $0xc,%rax
+  8041f9:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  8041fe:	f6 c2 01             	test   $0x1,%dl
+  804201:	74 e2                	je     8041e5 <foreach_shared_region+0x42>
+  804203:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  804208:	f6 c4 04             	test   $0x4,%ah
+  80420b:	74 d8                	je     8041e5 <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  80420d:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  804214:	4c 89 fa             	mov    %r15,%rdx
+  804217:	48 89 df             	mov    %rbx,%rdi
+  80421a:	41 ff d6             	call   *%r14
+  80421d:	eb c6                	jmp    8041e5 <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  80421f:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  804226:	00 
+  804227:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  80422c:	74 4a                	je     804278 <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  80422e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804232:	48 c1 e8 15          	shr    $0x15,%rax
+  804236:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  80423d:	01 00 00 
+  804240:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804244:	a8 01                	test   $0x1,%al
+  804246:	74 d7                	je     80421f <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  804248:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  80424c:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  804253:	48 39 c3             	cmp    %rax,%rbx
+  804256:	73 c7                	jae    80421f <foreach_shared_region+0x7c>
+  804258:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  80425f:	48 39 d0             	cmp    %rdx,%rax
+  804262:	4d 19 e4             	sbb    %r12,%r12
+  804265:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  80426c:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  804273:	e9 7a ff ff ff       	jmp    8041f2 <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  804278:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  80427f:	40 
+  804280:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804284:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80428b:	00 00 00 
+  80428e:	48 39 c1             	cmp    %rax,%rcx
+  804291:	74 50                	je     8042e3 <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  804293:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804297:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80429b:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  8042a2:	01 00 00 
+  8042a5:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  8042a9:	a8 01                	test   $0x1,%al
+  8042ab:	74 cb                	je     804278 <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  8042ad:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8042b1:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  8042b8:	48 39 c1             	cmp    %rax,%rcx
+  8042bb:	73 bb                	jae    804278 <foreach_shared_region+0xd5>
+  8042bd:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  8042c4:	48 39 d0             	cmp    %rdx,%rax
+  8042c7:	48 19 c0             	sbb    %rax,%rax
+  8042ca:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  8042d0:	48 05 00 02 00 00    	add    $0x200,%rax
+  8042d6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8042da:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8042de:	e9 4b ff ff ff       	jmp    80422e <foreach_shared_region+0x8b>
+  8042e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042e8:	48 83 c4 28          	add    $0x28,%rsp
+  8042ec:	5b                   	pop    %rbx
+  8042ed:	41 5c                	pop    %r12
+  8042ef:	41 5d                	pop    %r13
+  8042f1:	41 5e                	pop    %r14
+  8042f3:	41 5f                	pop    %r15
+  8042f5:	5d                   	pop    %rbp
+  8042f6:	c3                   	ret
+
+00000000008042f7 <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  8042f7:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  8042fd:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  804304:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  80430b:	c3                   	ret
+
+000000000080430c <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  80430c:	8b 47 40             	mov    0x40(%rdi),%eax
+  80430f:	8b 17                	mov    (%rdi),%edx
+  804311:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  804313:	83 f8 0f             	cmp    $0xf,%eax
+  804316:	77 13                	ja     80432b <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  804318:	8b 47 40             	mov    0x40(%rdi),%eax
+  80431b:	83 e0 0f             	and    $0xf,%eax
+  80431e:	48 c1 e0 09          	shl    $0x9,%rax
+  804322:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  804329:	00 
+  80432a:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  80432b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804330:	c3                   	ret
+
+0000000000804331 <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  804331:	8b 47 40             	mov    0x40(%rdi),%eax
+  804334:	83 c0 01             	add    $0x1,%eax
+  804337:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  80433a:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  804340:	8b 57 04             	mov    0x4(%rdi),%edx
+  804343:	b8 00 00 00 00       	mov    $0x0,%eax
+  804348:	85 d2                	test   %edx,%edx
+  80434a:	75 04                	jne    804350 <chan_publish+0x1f>
+  80434c:	83 e0 01             	and    $0x1,%eax
+}
+  80434f:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  804350:	87 47 04             	xchg   %eax,0x4(%rdi)
+  804353:	85 c0                	test   %eax,%eax
+  804355:	0f 95 c0             	setne  %al
+  804358:	0f b6 c0             	movzbl %al,%eax
+  80435b:	eb ef                	jmp    80434c <chan_publish+0x1b>
+
+000000000080435d <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  80435d:	8b 47 40             	mov    0x40(%rdi),%eax
+  804360:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  804362:	29 d0                	sub    %edx,%eax
+  804364:	83 e8 01             	sub    $0x1,%eax
+  804367:	83 f8 0f             	cmp    $0xf,%eax
+  80436a:	77 12                	ja     80437e <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  80436c:	8b 07                	mov    (%rdi),%eax
+  80436e:	83 e0 0f             	and    $0xf,%eax
+  804371:	48 c1 e0 09          	shl    $0x9,%rax
+  804375:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  80437c:	00 
+  80437d:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  80437e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804383:	c3                   	ret
+
+0000000000804384 <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  804384:	8b 07                	mov    (%rdi),%eax
+  804386:	83 c0 01             	add    $0x1,%eax
+  804389:	89 07                	mov    %eax,(%rdi)
+}
+  80438b:	c3                   	ret
+
+000000000080438c <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  80438c:	55                   	push   %rbp
+  80438d:	48 89 e5             	mov    %rsp,%rbp
+  804390:	53                   	push   %rbx
+  804391:	48 83 ec 08          	sub    $0x8,%rsp
+  804395:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  804398:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  80439f:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  8043a5:	48 b8 5d 43 80 00 00 	movabs $0x80435d,%rax
+  8043ac:	00 00 00 
+  8043af:	ff d0                	call   *%rax
+  8043b1:	48 85 c0             	test   %rax,%rax
+  8043b4:	74 12                	je     8043c8 <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  8043b6:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  8043bd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8043c2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8043c6:	c9                   	leave
+  8043c7:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  8043c8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8043cd:	eb f3                	jmp    8043c2 <chan_arm+0x36>
+
+00000000008043cf <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  8043cf:	55                   	push   %rbp
+  8043d0:	48 89 e5             	mov    %rsp,%rbp
+  8043d3:	41 56                	push   %r14
+  8043d5:	41 55                	push   %r13
+  8043d7:	41 54                	push   %r12
+  8043d9:	53                   	push   %rbx
+  8043da:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  8043dd:	49 bc 8c 43 80 00 00 	movabs $0x80438c,%r12
+  8043e4:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  8043e7:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  8043eb:	49 bd c6 15 80 00 00 	movabs $0x8015c6,%r13
+  8043f2:	00 00 00 
+    while (chan_arm(r))
+  8043f5:	eb 0d                	jmp    804404 <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  8043f7:	8b 33                	mov    (%rbx),%esi
+  8043f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8043fe:	4c 89 f7             	mov    %r14,%rdi
+  804401:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  804404:	48 89 df             	mov    %rbx,%rdi
+  804407:	41 ff d4             	call   *%r12
+  80440a:	84 c0                	test   %al,%al
+  80440c:	75 e9                	jne    8043f7 <chan_wait+0x28>
+}
+  80440e:	5b                   	pop    %rbx
+  80440f:	41 5c                	pop    %r12
+  804411:	41 5d                	pop    %r13
+  804413:	41 5e                	pop    %r14
+  804415:	5d                   	pop    %rbp
+  804416:	c3                   	ret
+
+0000000000804417 <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  804417:	55                   	push   %rbp
+  804418:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  80441b:	48 83 c7 40          	add    $0x40,%rdi
+  80441f:	be 01 00 00 00       	mov    $0x1,%esi
+  804424:	48 b8 e4 15 80 00 00 	movabs $0x8015e4,%rax
+  80442b:	00 00 00 
+  80442e:	ff d0                	call   *%rax
+}
+  804430:	5d                   	pop    %rbp
+  804431:	c3                   	ret
+
+0000000000804432 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804432:	b8 00 00 00 00       	mov    $0x0,%eax
+  804437:	c3                   	ret
+
+0000000000804438 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804438:	55                   	push   %rbp
+  804439:	48 89 e5             	mov    %rsp,%rbp
+  80443c:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  80443f:	48 be f4 50 80 00 00 	movabs $0x8050f4,%rsi
+  804446:	00 00 00 
+  804449:	48 b8 f9 0c 80 00 00 	movabs $0x800cf9,%rax
+  804450:	00 00 00 
+  804453:	ff d0                	call   *%rax
+    return 0;
+}
+  804455:	b8 00 00 00 00       	mov    $0x0,%eax
+  80445a:	5d                   	pop    %rbp
+  80445b:	c3                   	ret
+
+000000000080445c <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80445c:	55                   	push   %rbp
+  80445d:	48 89 e5             	mov    %rsp,%rbp
+  804460:	41 57                	push   %r15
+  804462:	41 56                	push   %r14
+  804464:	41 55                	push   %r13
+  804466:	41 54                	push   %r12
+  804468:	53                   	push   %rbx
+  804469:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  804470:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  804477:	48 85 d2             	test   %rdx,%rdx
+  80447a:	74 7a                	je     8044f6 <devcons_write+0x9a>
+  80447c:	49 89 d6             	mov    %rdx,%r14
+  80447f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804485:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80448a:	49 bf f3 0e 80 00 00 	movabs $0x800ef3,%r15
+  804491:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804494:	4c 89 f3             	mov    %r14,%rbx
+  804497:	48 29 f3             	sub    %rsi,%rbx
+  80449a:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80449f:	48 39 c3             	cmp    %rax,%rbx
+  8044a2:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8044a6:	4c 63 eb             	movslq %ebx,%r13
+  8044a9:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8044b0:	48 01 c6             	add    %rax,%rsi
+  8044b3:	4c 89 ea             	mov    %r13,%rdx
+  8044b6:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8044bd:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8044c0:	4c 89 ee             	mov    %r13,%rsi
+  8044c3:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8044ca:	48 b8 20 11 80 00 00 	movabs $0x801120,%rax
+  8044d1:	00 00 00 
+  8044d4:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8044d6:	41 01 dc             	add    %ebx,%r12d
+  8044d9:	49 63 f4             	movslq %r12d,%rsi
+  8044dc:	4c 39 f6             	cmp    %r14,%rsi
+  8044df:	72 b3                	jb     804494 <devcons_write+0x38>
+    return res;
+  8044e1:	49 63 c4             	movslq %r12d,%rax
+}
+  8044e4:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8044eb:	5b                   	pop    %rbx
+  8044ec:	41 5c                	pop    %r12
+  8044ee:	41 5d                	pop    %r13
+  8044f0:	41 5e                	pop    %r14
+  8044f2:	41 5f                	pop    %r15
+  8044f4:	5d                   	pop    %rbp
+  8044f5:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8044f6:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8044fc:	eb e3                	jmp    8044e1 <devcons_write+0x85>
+
+00000000008044fe <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8044fe:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804501:	ba 00 00 00 00       	mov    $0x0,%edx
+  804506:	48 85 c0             	test   %rax,%rax
+  804509:	74 55                	je     804560 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80450b:	55                   	push   %rbp
+  80450c:	48 89 e5             	mov    %rsp,%rbp
+  80450f:	41 55                	push   %r13
+  804511:	41 54                	push   %r12
+  804513:	53                   	push   %rbx
+  804514:	48 83 ec 08          	sub    $0x8,%rsp
+  804518:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  80451b:	48 bb 3f 11 80 00 00 	movabs $0x80113f,%rbx
+  804522:	00 00 00 
+  804525:	49 bc f4 11 80 00 00 	movabs $0x8011f4,%r12
+  80452c:	00 00 00 
+  80452f:	eb 03                	jmp    804534 <devcons_read+0x36>
+  804531:	41 ff d4             	call   *%r12
+  804534:	ff d3                	call   *%rbx
+  804536:	85 c0                	test   %eax,%eax
+  804538:	74 f7                	je     804531 <devcons_read+0x33>
+    if (c < 0) return c;
+  80453a:	48 63 d0             	movslq %eax,%rdx
+  80453d:	78 13                	js     804552 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  80453f:	ba 00 00 00 00       	mov    $0x0,%edx
+  804544:	83 f8 04             	cmp    $0x4,%eax
+  804547:	74 09                	je     804552 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  804549:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  80454d:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804552:	48 89 d0             	mov    %rdx,%rax
+  804555:	48 83 c4 08          	add    $0x8,%rsp
+  804559:	5b                   	pop    %rbx
+  80455a:	41 5c                	pop    %r12
+  80455c:	41 5d                	pop    %r13
+  80455e:	5d                   	pop    %rbp
+  80455f:	c3                   	ret
+  804560:	48 89 d0             	mov    %rdx,%rax
+  804563:	c3                   	ret
+
+0000000000804564 <cputchar>:
+cputchar(int ch) {
+  804564:	55                   	push   %rbp
+  804565:	48 89 e5             	mov    %rsp,%rbp
+  804568:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  80456c:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  804570:	be 01 00 00 00       	mov    $0x1,%esi
+  804575:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  804579:	48 b8 20 11 80 00 00 	movabs $0x801120,%rax
+  804580:	00 00 00 
+  804583:	ff d0                	call   *%rax
+}
+  804585:	c9                   	leave
+  804586:	c3                   	ret
+
+0000000000804587 <getchar>:
+getchar(void) {
+  804587:	55                   	push   %rbp
+  804588:	48 89 e5             	mov    %rsp,%rbp
+  80458b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80458f:	ba 01 00 00 00       	mov    $0x1,%edx
+  804594:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  804598:	bf 00 00 00 00       	mov    $0x0,%edi
+  80459d:	48 b8 e3 1c 80 00 00 	movabs $0x801ce3,%rax
+  8045a4:	00 00 00 
+  8045a7:	ff d0                	call   *%rax
+  8045a9:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8045ab:	85 c0                	test   %eax,%eax
+  8045ad:	78 06                	js     8045b5 <getchar+0x2e>
+  8045af:	74 08                	je     8045b9 <getchar+0x32>
+  8045b1:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8045b5:	89 d0                	mov    %edx,%eax
+  8045b7:	c9                   	leave
+  8045b8:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8045b9:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8045be:	eb f5                	jmp    8045b5 <getchar+0x2e>
+
+00000000008045c0 <iscons>:
+iscons(int fdnum) {
+  8045c0:	55                   	push   %rbp
+  8045c1:	48 89 e5             	mov    %rsp,%rbp
+  8045c4:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8045c8:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8045cc:	48 b8 00 1a 80 00 00 	movabs $0x801a00,%rax
+  8045d3:	00 00 00 
+  8045d6:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8045d8:	85 c0                	test   %eax,%eax
+  8045da:	78 18                	js     8045f4 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8045dc:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8045e0:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  8045e7:	00 00 00 
+  8045ea:	8b 00                	mov    (%rax),%eax
+  8045ec:	39 02                	cmp    %eax,(%rdx)
+  8045ee:	0f 94 c0             	sete   %al
+  8045f1:	0f b6 c0             	movzbl %al,%eax
+}
+  8045f4:	c9                   	leave
+  8045f5:	c3                   	ret
+
+00000000008045f6 <opencons>:
+opencons(void) {
+  8045f6:	55                   	push   %rbp
+  8045f7:	48 89 e5             	mov    %rsp,%rbp
+  8045fa:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8045fe:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  804602:	48 b8 a0 19 80 00 00 	movabs $0x8019a0,%rax
+  804609:	00 00 00 
+  80460c:	ff d0                	call   *%rax
+  80460e:	85 c0                	test   %eax,%eax
+  804610:	78 49                	js     80465b <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  804612:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804617:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80461c:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  804620:	bf 00 00 00 00       	mov    $0x0,%edi
+  804625:	48 b8 58 12 80 00 00 	movabs $0x801258,%rax
+  80462c:	00 00 00 
+  80462f:	ff d0                	call   *%rax
+  804631:	85 c0                	test   %eax,%eax
+  804633:	78 26                	js     80465b <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  804635:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804639:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  804640:	00 00 
+  804642:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  804644:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804648:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  80464f:	48 b8 72 19 80 00 00 	movabs $0x801972,%rax
+  804656:	00 00 00 
+  804659:	ff d0                	call   *%rax
+}
+  80465b:	c9                   	leave
+  80465c:	c3                   	ret
+
+000000000080465d <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  80465d:	55                   	push   %rbp
+  80465e:	48 89 e5             	mov    %rsp,%rbp
+  804661:	41 56                	push   %r14
+  804663:	41 55                	push   %r13
+  804665:	41 54                	push   %r12
+  804667:	53                   	push   %rbx
+  804668:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80466b:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  804672:	00 00 00 
+  804675:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804679:	74 27                	je     8046a2 <_handle_vectored_pagefault+0x45>
+  80467b:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  804680:	49 bd 00 10 84 00 00 	movabs $0x841000,%r13
+  804687:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80468a:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  80468d:	4c 89 e7             	mov    %r12,%rdi
+  804690:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  804695:	84 c0                	test   %al,%al
+  804697:	75 45                	jne    8046de <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804699:	48 83 c3 01          	add    $0x1,%rbx
+  80469d:	49 3b 1e             	cmp    (%r14),%rbx
+  8046a0:	72 eb                	jb     80468d <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  8046a2:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  8046a9:	00 
+  8046aa:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  8046af:	4d 8b 04 24          	mov    (%r12),%r8
+  8046b3:	48 ba 00 51 80 00 00 	movabs $0x805100,%rdx
+  8046ba:	00 00 00 
+  8046bd:	be 1d 00 00 00       	mov    $0x1d,%esi
+  8046c2:	48 bf 30 51 80 00 00 	movabs $0x805130,%rdi
+  8046c9:	00 00 00 
+  8046cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046d1:	49 ba 84 02 80 00 00 	movabs $0x800284,%r10
+  8046d8:	00 00 00 
+  8046db:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  8046de:	5b                   	pop    %rbx
+  8046df:	41 5c                	pop    %r12
+  8046e1:	41 5d                	pop    %r13
+  8046e3:	41 5e                	pop    %r14
+  8046e5:	5d                   	pop    %rbp
+  8046e6:	c3                   	ret
+
+00000000008046e7 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  8046e7:	55                   	push   %rbp
+  8046e8:	48 89 e5             	mov    %rsp,%rbp
+  8046eb:	53                   	push   %rbx
+  8046ec:	48 83 ec 08          	sub    $0x8,%rsp
+  8046f0:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  8046f3:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8046fa:	00 00 00 
+  8046fd:	80 38 00             	cmpb   $0x0,(%rax)
+  804700:	0f 84 84 00 00 00    	je     80478a <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804706:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  80470d:	00 00 00 
+  804710:	48 8b 10             	mov    (%rax),%rdx
+  804713:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  804718:	48 b9 00 10 84 00 00 	movabs $0x841000,%rcx
+  80471f:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804722:	48 85 d2             	test   %rdx,%rdx
+  804725:	74 19                	je     804740 <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  804727:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  80472b:	0f 84 e8 00 00 00    	je     804819 <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804731:	48 83 c0 01          	add    $0x1,%rax
+  804735:	48 39 d0             	cmp    %rdx,%rax
+  804738:	75 ed                	jne    804727 <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  80473a:	48 83 fa 08          	cmp    $0x8,%rdx
+  80473e:	74 1c                	je     80475c <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  804740:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  804744:	48 a3 48 10 84 00 00 	movabs %rax,0x841048
+  80474b:	00 00 00 
+  80474e:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  804755:	00 00 00 
+  804758:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  80475c:	48 b8 cb 11 80 00 00 	movabs $0x8011cb,%rax
+  804763:	00 00 00 
+  804766:	ff d0                	call   *%rax
+  804768:	89 c7                	mov    %eax,%edi
+  80476a:	48 be df 48 80 00 00 	movabs $0x8048df,%rsi
+  804771:	00 00 00 
+  804774:	48 b8 16 14 80 00 00 	movabs $0x801416,%rax
+  80477b:	00 00 00 
+  80477e:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  804780:	85 c0                	test   %eax,%eax
+  804782:	78 68                	js     8047ec <add_pgfault_handler+0x105>
+    return res;
+}
+  804784:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804788:	c9                   	leave
+  804789:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  80478a:	48 b8 cb 11 80 00 00 	movabs $0x8011cb,%rax
+  804791:	00 00 00 
+  804794:	ff d0                	call   *%rax
+  804796:	89 c7                	mov    %eax,%edi
+  804798:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80479d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8047a2:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  8047a9:	00 00 00 
+  8047ac:	48 b8 58 12 80 00 00 	movabs $0x801258,%rax
+  8047b3:	00 00 00 
+  8047b6:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8047b8:	48 ba 48 10 84 00 00 	movabs $0x841048,%rdx
+  8047bf:	00 00 00 
+  8047c2:	48 8b 02             	mov    (%rdx),%rax
+  8047c5:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8047c9:	48 89 0a             	mov    %rcx,(%rdx)
+  8047cc:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  8047d3:	00 00 00 
+  8047d6:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  8047da:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8047e1:	00 00 00 
+  8047e4:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  8047e7:	e9 70 ff ff ff       	jmp    80475c <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8047ec:	89 c1                	mov    %eax,%ecx
+  8047ee:	48 ba 3e 51 80 00 00 	movabs $0x80513e,%rdx
+  8047f5:	00 00 00 
+  8047f8:	be 3d 00 00 00       	mov    $0x3d,%esi
+  8047fd:	48 bf 30 51 80 00 00 	movabs $0x805130,%rdi
+  804804:	00 00 00 
+  804807:	b8 00 00 00 00       	mov    $0x0,%eax
+  80480c:	49 b8 84 02 80 00 00 	movabs $0x800284,%r8
+  804813:	00 00 00 
+  804816:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  804819:	b8 00 00 00 00       	mov    $0x0,%eax
+  80481e:	e9 61 ff ff ff       	jmp    804784 <add_pgfault_handler+0x9d>
+
+0000000000804823 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  804823:	55                   	push   %rbp
+  804824:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  804827:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  80482e:	00 00 00 
+  804831:	80 38 00             	cmpb   $0x0,(%rax)
+  804834:	74 33                	je     804869 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804836:	48 a1 48 10 84 00 00 	movabs 0x841048,%rax
+  80483d:	00 00 00 
+  804840:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  804845:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  80484c:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80484f:	48 85 c0             	test   %rax,%rax
+  804852:	0f 84 85 00 00 00    	je     8048dd <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  804858:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  80485c:	74 40                	je     80489e <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80485e:	48 83 c1 01          	add    $0x1,%rcx
+  804862:	48 39 c1             	cmp    %rax,%rcx
+  804865:	75 f1                	jne    804858 <remove_pgfault_handler+0x35>
+  804867:	eb 74                	jmp    8048dd <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  804869:	48 b9 56 51 80 00 00 	movabs $0x805156,%rcx
+  804870:	00 00 00 
+  804873:	48 ba a7 50 80 00 00 	movabs $0x8050a7,%rdx
+  80487a:	00 00 00 
+  80487d:	be 43 00 00 00       	mov    $0x43,%esi
+  804882:	48 bf 30 51 80 00 00 	movabs $0x805130,%rdi
+  804889:	00 00 00 
+  80488c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804891:	49 b8 84 02 80 00 00 	movabs $0x800284,%r8
+  804898:	00 00 00 
+  80489b:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  80489e:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  8048a5:	00 
+  8048a6:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8048aa:	48 29 ca             	sub    %rcx,%rdx
+  8048ad:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  8048b4:	00 00 00 
+  8048b7:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  8048bb:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  8048c0:	48 89 ce             	mov    %rcx,%rsi
+  8048c3:	48 b8 f3 0e 80 00 00 	movabs $0x800ef3,%rax
+  8048ca:	00 00 00 
+  8048cd:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  8048cf:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  8048d6:	00 00 00 
+  8048d9:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  8048dd:	5d                   	pop    %rbp
+  8048de:	c3                   	ret
+
+00000000008048df <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  8048df:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  8048e2:	48 b8 5d 46 80 00 00 	movabs $0x80465d,%rax
+  8048e9:	00 00 00 
+    call *%rax
+  8048ec:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  8048ee:	41 5f                	pop    %r15
+	popq %r15
+  8048f0:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  8048f2:	41 5f                	pop    %r15
+	popq %r14
+  8048f4:	41 5e                	pop    %r14
+	popq %r13
+  8048f6:	41 5d                	pop    %r13
+	popq %r12
+  8048f8:	41 5c                	pop    %r12
+	popq %r11
+  8048fa:	41 5b                	pop    %r11
+	popq %r10
+  8048fc:	41 5a                	pop    %r10
+	popq %r9
+  8048fe:	41 59                	pop    %r9
+	popq %r8
+  804900:	41 58                	pop    %r8
+	popq %rsi
+  804902:	5e                   	pop    %rsi
+	popq %rdi
+  804903:	5f                   	pop    %rdi
+	popq %rbp
+  804904:	5d                   	pop    %rbp
+	popq %rdx
+  804905:	5a                   	pop    %rdx
+	popq %rcx
+  804906:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  804907:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  80490c:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  804911:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  804915:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  804918:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  80491d:	5b                   	pop    %rbx
+	popq %rax
+  80491e:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  80491f:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  804923:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  804924:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  804929:	c3                   	ret
+  80492a:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000804930 <__popcountdi2>:
+  804930:	f3 0f 1e fa          	endbr64
+  804934:	48 ba 55 55 55 55 55 	movabs $0x5555555555555555,%rdx
+  80493b:	55 55 55 
+  80493e:	48 89 f8             	mov    %rdi,%rax
+  804941:	48 d1 e8             	shr    %rax
+  804944:	48 21 d0             	and    %rdx,%rax
+  804947:	48 29 c7             	sub    %rax,%rdi
+  80494a:	48 b8 33 33 33 33 33 	movabs $0x3333333333333333,%rax
+  804951:	33 33 33 
+  804954:	48 89 fa             	mov    %rdi,%rdx
+  804957:	48 c1 ef 02          	shr    $0x2,%rdi
+  80495b:	48 21 c2             	and    %rax,%rdx
+  80495e:	48 21 c7             	and    %rax,%rdi
+  804961:	48 01 fa             	add    %rdi,%rdx
+  804964:	48 89 d0             	mov    %rdx,%rax
+  804967:	48 c1 e8 04          	shr    $0x4,%rax
+  80496b:	48 01 d0             	add    %rdx,%rax
+  80496e:	48 ba 0f 0f 0f 0f 0f 	movabs $0xf0f0f0f0f0f0f0f,%rdx
+  804975:	0f 0f 0f 
+  804978:	48 21 d0             	and    %rdx,%rax
+  80497b:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  804982:	01 01 01 
+  804985:	48 0f af c2          	imul   %rdx,%rax
+  804989:	48 c1 e8 38          	shr    $0x38,%rax
+  80498d:	c3                   	ret
+  80498e:	66 90                	xchg   %ax,%ax
+
+0000000000804990 <__rodata_start>:
+  804990:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804992:	72 6b                	jb     8049ff <__rodata_start+0x6f>
+  804994:	3a 20                	cmp    (%rax),%ah
+  804996:	25 69 00 75 73       	and    $0x73750069,%eax
+  80499b:	65 72 2f             	gs jb  8049cd <__rodata_start+0x3d>
+  80499e:	73 6d                	jae    804a0d <__rodata_start+0x7d>
+  8049a0:	70 62                	jo     804a04 <__rodata_start+0x74>
+  8049a2:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8049a4:	63 68 2e             	movsxd 0x2e(%rax),%ebp
+  8049a7:	63 00                	movsxd (%rax),%eax
+  8049a9:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+  8049b0:	73 6d                	jae    804a1f <__rodata_start+0x8f>
+  8049b2:	70 62                	jo     804a16 <__rodata_start+0x86>
+  8049b4:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8049b6:	63 68 3a             	movsxd 0x3a(%rax),%ebp
+  8049b9:	20 25 64 20 77 6f    	and    %ah,0x6f772064(%rip)        # 6ff76a23 <__bss_end+0x6f734a23>
+  8049bf:	72 6b                	jb     804a2c <__rodata_start+0x9c>
+  8049c1:	65 72 73             	gs jb  804a37 <__rodata_start+0xa7>
+  8049c4:	20 75 73             	and    %dh,0x73(%rbp)
+  8049c7:	65 64 20 25 64 20 43 	gs and %ah,%fs:0x50432064(%rip)        # 50c36a33 <__bss_end+0x503f4a33>
+  8049ce:	50 
+  8049cf:	55                   	push   %rbp
+  8049d0:	73 20                	jae    8049f2 <__rodata_start+0x62>
+  8049d2:	69 6e 20 25 6c 75 20 	imul   $0x20756c25,0x20(%rsi),%ebp
+  8049d9:	4d 63 79 63          	movslq 0x63(%r9),%r15
+  8049dd:	6c                   	insb   (%dx),%es:(%rdi)
+  8049de:	65 73 0a             	gs jae 8049eb <__rodata_start+0x5b>
+  8049e1:	00 3c 75 6e 6b 6e 6f 	add    %bh,0x6f6e6b6e(,%rsi,2)
+  8049e8:	77 6e                	ja     804a58 <__rodata_start+0xc8>
+  8049ea:	3e 00 0f             	ds add %cl,(%rdi)
+  8049ed:	1f                   	(bad)
+  8049ee:	40 00 5b 25          	rex add %bl,0x25(%rbx)
+  8049f2:	30 38                	xor    %bh,(%rax)
+  8049f4:	78 5d                	js     804a53 <__rodata_start+0xc3>
+  8049f6:	20 75 73             	and    %dh,0x73(%rbp)
+  8049f9:	65 72 20             	gs jb  804a1c <__rodata_start+0x8c>
+  8049fc:	70 61                	jo     804a5f <__rodata_start+0xcf>
+  8049fe:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8049ff:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  804a06:	73 20                	jae    804a28 <__rodata_start+0x98>
+  804a08:	61                   	(bad)
+  804a09:	74 20                	je     804a2b <__rodata_start+0x9b>
+  804a0b:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  804a10:	3a 20                	cmp    (%rax),%ah
+  804a12:	00 30                	add    %dh,(%rax)
+  804a14:	31 32                	xor    %esi,(%rdx)
+  804a16:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  804a1d:	41                   	rex.B
+  804a1e:	42                   	rex.X
+  804a1f:	43                   	rex.XB
+  804a20:	44                   	rex.R
+  804a21:	45                   	rex.RB
+  804a22:	46 00 30             	rex.RX add %r14b,(%rax)
+  804a25:	31 32                	xor    %esi,(%rdx)
+  804a27:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  804a2e:	61                   	(bad)
+  804a2f:	62 63 64 65 66       	(bad)
+  804a34:	00 28                	add    %ch,(%rax)
+  804a36:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a37:	75 6c                	jne    804aa5 <__rodata_start+0x115>
+  804a39:	6c                   	insb   (%dx),%es:(%rdi)
+  804a3a:	29 00                	sub    %eax,(%rax)
+  804a3c:	65 72 72             	gs jb  804ab1 <__rodata_start+0x121>
+  804a3f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a40:	72 20                	jb     804a62 <__rodata_start+0xd2>
+  804a42:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  804a47:	73 70                	jae    804ab9 <__rodata_start+0x129>
+  804a49:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  804a4d:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  804a54:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a55:	72 00                	jb     804a57 <__rodata_start+0xc7>
+  804a57:	62 61 64 20 65       	(bad)
+  804a5c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a5d:	76 69                	jbe    804ac8 <__rodata_start+0x138>
+  804a5f:	72 6f                	jb     804ad0 <__rodata_start+0x140>
+  804a61:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a62:	6d                   	insl   (%dx),%es:(%rdi)
+  804a63:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804a65:	74 00                	je     804a67 <__rodata_start+0xd7>
+  804a67:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  804a6e:	20 70 61             	and    %dh,0x61(%rax)
+  804a71:	72 61                	jb     804ad4 <__rodata_start+0x144>
+  804a73:	6d                   	insl   (%dx),%es:(%rdi)
+  804a74:	65 74 65             	gs je  804adc <__rodata_start+0x14c>
+  804a77:	72 00                	jb     804a79 <__rodata_start+0xe9>
+  804a79:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a7a:	75 74                	jne    804af0 <__rodata_start+0x160>
+  804a7c:	20 6f 66             	and    %ch,0x66(%rdi)
+  804a7f:	20 6d 65             	and    %ch,0x65(%rbp)
+  804a82:	6d                   	insl   (%dx),%es:(%rdi)
+  804a83:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a84:	72 79                	jb     804aff <__rodata_start+0x16f>
+  804a86:	00 6f 75             	add    %ch,0x75(%rdi)
+  804a89:	74 20                	je     804aab <__rodata_start+0x11b>
+  804a8b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a8c:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  804a90:	76 69                	jbe    804afb <__rodata_start+0x16b>
+  804a92:	72 6f                	jb     804b03 <__rodata_start+0x173>
+  804a94:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a95:	6d                   	insl   (%dx),%es:(%rdi)
+  804a96:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804a98:	74 73                	je     804b0d <__rodata_start+0x17d>
+  804a9a:	00 63 6f             	add    %ah,0x6f(%rbx)
+  804a9d:	72 72                	jb     804b11 <__rodata_start+0x181>
+  804a9f:	75 70                	jne    804b11 <__rodata_start+0x181>
+  804aa1:	74 65                	je     804b08 <__rodata_start+0x178>
+  804aa3:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  804aa8:	75 67                	jne    804b11 <__rodata_start+0x181>
+  804aaa:	20 69 6e             	and    %ch,0x6e(%rcx)
+  804aad:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804aaf:	00 73 65             	add    %dh,0x65(%rbx)
+  804ab2:	67 6d                	insl   (%dx),%es:(%edi)
+  804ab4:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804ab6:	74 61                	je     804b19 <__rodata_start+0x189>
+  804ab8:	74 69                	je     804b23 <__rodata_start+0x193>
+  804aba:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804abb:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804abc:	20 66 61             	and    %ah,0x61(%rsi)
+  804abf:	75 6c                	jne    804b2d <__rodata_start+0x19d>
+  804ac1:	74 00                	je     804ac3 <__rodata_start+0x133>
+  804ac3:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  804aca:	20 45 4c             	and    %al,0x4c(%rbp)
+  804acd:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  804ad1:	61                   	(bad)
+  804ad2:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  804ad7:	20 73 75             	and    %dh,0x75(%rbx)
+  804ada:	63 68 20             	movsxd 0x20(%rax),%ebp
+  804add:	73 79                	jae    804b58 <__rodata_start+0x1c8>
+  804adf:	73 74                	jae    804b55 <__rodata_start+0x1c5>
+  804ae1:	65 6d                	gs insl (%dx),%es:(%rdi)
+  804ae3:	20 63 61             	and    %ah,0x61(%rbx)
+  804ae6:	6c                   	insb   (%dx),%es:(%rdi)
+  804ae7:	6c                   	insb   (%dx),%es:(%rdi)
+  804ae8:	00 65 6e             	add    %ah,0x6e(%rbp)
+  804aeb:	74 72                	je     804b5f <__rodata_start+0x1cf>
+  804aed:	79 20                	jns    804b0f <__rodata_start+0x17f>
+  804aef:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804af0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804af1:	74 20                	je     804b13 <__rodata_start+0x183>
+  804af3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804af5:	75 6e                	jne    804b65 <__rodata_start+0x1d5>
+  804af7:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  804afb:	76 20                	jbe    804b1d <__rodata_start+0x18d>
+  804afd:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  804b04:	72 65                	jb     804b6b <__rodata_start+0x1db>
+  804b06:	63 76 69             	movsxd 0x69(%rsi),%esi
+  804b09:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804b0a:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  804b0e:	65 78 70             	gs js  804b81 <__rodata_start+0x1f1>
+  804b11:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  804b16:	20 65 6e             	and    %ah,0x6e(%rbp)
+  804b19:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  804b1d:	20 66 69             	and    %ah,0x69(%rsi)
+  804b20:	6c                   	insb   (%dx),%es:(%rdi)
+  804b21:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  804b25:	20 66 72             	and    %ah,0x72(%rsi)
+  804b28:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  804b2d:	61                   	(bad)
+  804b2e:	63 65 20             	movsxd 0x20(%rbp),%esp
+  804b31:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b32:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804b33:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  804b37:	6b 00 74             	imul   $0x74,(%rax),%eax
+  804b3a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b3b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b3c:	20 6d 61             	and    %ch,0x61(%rbp)
+  804b3f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804b40:	79 20                	jns    804b62 <__rodata_start+0x1d2>
+  804b42:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  804b49:	72 65                	jb     804bb0 <__rodata_start+0x220>
+  804b4b:	20 6f 70             	and    %ch,0x70(%rdi)
+  804b4e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804b50:	00 66 69             	add    %ah,0x69(%rsi)
+  804b53:	6c                   	insb   (%dx),%es:(%rdi)
+  804b54:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  804b58:	20 62 6c             	and    %ah,0x6c(%rdx)
+  804b5b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b5c:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  804b5f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804b60:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b61:	74 20                	je     804b83 <__rodata_start+0x1f3>
+  804b63:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804b65:	75 6e                	jne    804bd5 <__rodata_start+0x245>
+  804b67:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  804b6b:	76 61                	jbe    804bce <__rodata_start+0x23e>
+  804b6d:	6c                   	insb   (%dx),%es:(%rdi)
+  804b6e:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  804b75:	00 
+  804b76:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  804b7d:	72 65                	jb     804be4 <__rodata_start+0x254>
+  804b7f:	61                   	(bad)
+  804b80:	64 79 20             	fs jns 804ba3 <__rodata_start+0x213>
+  804b83:	65 78 69             	gs js  804bef <__rodata_start+0x25f>
+  804b86:	73 74                	jae    804bfc <__rodata_start+0x26c>
+  804b88:	73 00                	jae    804b8a <__rodata_start+0x1fa>
+  804b8a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b8b:	70 65                	jo     804bf2 <__rodata_start+0x262>
+  804b8d:	72 61                	jb     804bf0 <__rodata_start+0x260>
+  804b8f:	74 69                	je     804bfa <__rodata_start+0x26a>
+  804b91:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b92:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804b93:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  804b96:	74 20                	je     804bb8 <__rodata_start+0x228>
+  804b98:	73 75                	jae    804c0f <__rodata_start+0x27f>
+  804b9a:	70 70                	jo     804c0c <__rodata_start+0x27c>
+  804b9c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b9d:	72 74                	jb     804c13 <__rodata_start+0x283>
+  804b9f:	65 64 00 74 72 79    	gs add %dh,%fs:0x79(%rdx,%rsi,2)
+  804ba5:	20 61 67             	and    %ah,0x67(%rcx)
+  804ba8:	61                   	(bad)
+  804ba9:	69 6e 00 74 69 6d 65 	imul   $0x656d6974,0x0(%rsi),%ebp
+  804bb0:	64 20 6f 75          	and    %ch,%fs:0x75(%rdi)
+  804bb4:	74 00                	je     804bb6 <__rodata_start+0x226>
+  804bb6:	66 69 6c 65 20 69 73 	imul   $0x7369,0x20(%rbp,%riz,2),%bp
+  804bbd:	20 69 6e             	and    %ch,0x6e(%rcx)
+  804bc0:	20 75 73             	and    %dh,0x73(%rbp)
+  804bc3:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  804bc7:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  804bce:	00 
+  804bcf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804bd6:	00 00 00 
+  804bd9:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+  804be0:	c1 05 80 00 00 00 00 	roll   $0x0,0x80(%rip)        # 804c67 <__rodata_start+0x2d7>
+  804be7:	00 02                	add    %al,(%rdx)
+  804be9:	0c 80                	or     $0x80,%al
+  804beb:	00 00                	add    %al,(%rax)
+  804bed:	00 00                	add    %al,(%rax)
+  804bef:	00 f2                	add    %dh,%dl
+  804bf1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804bf7:	00 02                	add    %al,(%rdx)
+  804bf9:	0c 80                	or     $0x80,%al
+  804bfb:	00 00                	add    %al,(%rax)
+  804bfd:	00 00                	add    %al,(%rax)
+  804bff:	00 02                	add    %al,(%rdx)
+  804c01:	0c 80                	or     $0x80,%al
+  804c03:	00 00                	add    %al,(%rax)
+  804c05:	00 00                	add    %al,(%rax)
+  804c07:	00 02                	add    %al,(%rdx)
+  804c09:	0c 80                	or     $0x80,%al
+  804c0b:	00 00                	add    %al,(%rax)
+  804c0d:	00 00                	add    %al,(%rax)
+  804c0f:	00 02                	add    %al,(%rdx)
+  804c11:	0c 80                	or     $0x80,%al
+  804c13:	00 00                	add    %al,(%rax)
+  804c15:	00 00                	add    %al,(%rax)
+  804c17:	00 e0                	add    %ah,%al
+  804c19:	05 80 00 00 00       	add    $0x80,%eax
+  804c1e:	00 00                	add    %al,(%rax)
+  804c20:	02 0c 80             	add    (%rax,%rax,4),%cl
+  804c23:	00 00                	add    %al,(%rax)
+  804c25:	00 00                	add    %al,(%rax)
+  804c27:	00 02                	add    %al,(%rdx)
+  804c29:	0c 80                	or     $0x80,%al
+  804c2b:	00 00                	add    %al,(%rax)
+  804c2d:	00 00                	add    %al,(%rax)
+  804c2f:	00 d4                	add    %dl,%ah
+  804c31:	05 80 00 00 00       	add    $0x80,%eax
+  804c36:	00 00                	add    %al,(%rax)
+  804c38:	4e 06                	rex.WRX (bad)
+  804c3a:	80 00 00             	addb   $0x0,(%rax)
+  804c3d:	00 00                	add    %al,(%rax)
+  804c3f:	00 02                	add    %al,(%rdx)
+  804c41:	0c 80                	or     $0x80,%al
+  804c43:	00 00                	add    %al,(%rax)
+  804c45:	00 00                	add    %al,(%rax)
+  804c47:	00 d4                	add    %dl,%ah
+  804c49:	05 80 00 00 00       	add    $0x80,%eax
+  804c4e:	00 00                	add    %al,(%rax)
+  804c50:	1a 06                	sbb    (%rsi),%al
+  804c52:	80 00 00             	addb   $0x0,(%rax)
+  804c55:	00 00                	add    %al,(%rax)
+  804c57:	00 1a                	add    %bl,(%rdx)
+  804c59:	06                   	(bad)
+  804c5a:	80 00 00             	addb   $0x0,(%rax)
+  804c5d:	00 00                	add    %al,(%rax)
+  804c5f:	00 1a                	add    %bl,(%rdx)
+  804c61:	06                   	(bad)
+  804c62:	80 00 00             	addb   $0x0,(%rax)
+  804c65:	00 00                	add    %al,(%rax)
+  804c67:	00 1a                	add    %bl,(%rdx)
+  804c69:	06                   	(bad)
+  804c6a:	80 00 00             	addb   $0x0,(%rax)
+  804c6d:	00 00                	add    %al,(%rax)
+  804c6f:	00 1a                	add    %bl,(%rdx)
+  804c71:	06                   	(bad)
+  804c72:	80 00 00             	addb   $0x0,(%rax)
+  804c75:	00 00                	add    %al,(%rax)
+  804c77:	00 1a                	add    %bl,(%rdx)
+  804c79:	06                   	(bad)
+  804c7a:	80 00 00             	addb   $0x0,(%rax)
+  804c7d:	00 00                	add    %al,(%rax)
+  804c7f:	00 1a                	add    %bl,(%rdx)
+  804c81:	06                   	(bad)
+  804c82:	80 00 00             	addb   $0x0,(%rax)
+  804c85:	00 00                	add    %al,(%rax)
+  804c87:	00 1a                	add    %bl,(%rdx)
+  804c89:	06                   	(bad)
+  804c8a:	80 00 00             	addb   $0x0,(%rax)
+  804c8d:	00 00                	add    %al,(%rax)
+  804c8f:	00 1a                	add    %bl,(%rdx)
+  804c91:	06                   	(bad)
+  804c92:	80 00 00             	addb   $0x0,(%rax)
+  804c95:	00 00                	add    %al,(%rax)
+  804c97:	00 02                	add    %al,(%rdx)
+  804c99:	0c 80                	or     $0x80,%al
+  804c9b:	00 00                	add    %al,(%rax)
+  804c9d:	00 00                	add    %al,(%rax)
+  804c9f:	00 02                	add    %al,(%rdx)
+  804ca1:	0c 80                	or     $0x80,%al
+  804ca3:	00 00                	add    %al,(%rax)
+  804ca5:	00 00                	add    %al,(%rax)
+  804ca7:	00 02                	add    %al,(%rdx)
+  804ca9:	0c 80                	or     $0x80,%al
+  804cab:	00 00                	add    %al,(%rax)
+  804cad:	00 00                	add    %al,(%rax)
+  804caf:	00 02                	add    %al,(%rdx)
+  804cb1:	0c 80                	or     $0x80,%al
+  804cb3:	00 00                	add    %al,(%rax)
+  804cb5:	00 00                	add    %al,(%rax)
+  804cb7:	00 02                	add    %al,(%rdx)
+  804cb9:	0c 80                	or     $0x80,%al
+  804cbb:	00 00                	add    %al,(%rax)
+  804cbd:	00 00                	add    %al,(%rax)
+  804cbf:	00 02                	add    %al,(%rdx)
+  804cc1:	0c 80                	or     $0x80,%al
+  804cc3:	00 00                	add    %al,(%rax)
+  804cc5:	00 00                	add    %al,(%rax)
+  804cc7:	00 02                	add    %al,(%rdx)
+  804cc9:	0c 80                	or     $0x80,%al
+  804ccb:	00 00                	add    %al,(%rax)
+  804ccd:	00 00                	add    %al,(%rax)
+  804ccf:	00 02                	add    %al,(%rdx)
+  804cd1:	0c 80                	or     $0x80,%al
+  804cd3:	00 00                	add    %al,(%rax)
+  804cd5:	00 00                	add    %al,(%rax)
+  804cd7:	00 02                	add    %al,(%rdx)
+  804cd9:	0c 80                	or     $0x80,%al
+  804cdb:	00 00                	add    %al,(%rax)
+  804cdd:	00 00                	add    %al,(%rax)
+  804cdf:	00 02                	add    %al,(%rdx)
+  804ce1:	0c 80                	or     $0x80,%al
+  804ce3:	00 00                	add    %al,(%rax)
+  804ce5:	00 00                	add    %al,(%rax)
+  804ce7:	00 02                	add    %al,(%rdx)
+  804ce9:	0c 80                	or     $0x80,%al
+  804ceb:	00 00                	add    %al,(%rax)
+  804ced:	00 00                	add    %al,(%rax)
+  804cef:	00 02                	add    %al,(%rdx)
+  804cf1:	0c 80                	or     $0x80,%al
+  804cf3:	00 00                	add    %al,(%rax)
+  804cf5:	00 00                	add    %al,(%rax)
+  804cf7:	00 02                	add    %al,(%rdx)
+  804cf9:	0c 80                	or     $0x80,%al
+  804cfb:	00 00                	add    %al,(%rax)
+  804cfd:	00 00                	add    %al,(%rax)
+  804cff:	00 02                	add    %al,(%rdx)
+  804d01:	0c 80                	or     $0x80,%al
+  804d03:	00 00                	add    %al,(%rax)
+  804d05:	00 00                	add    %al,(%rax)
+  804d07:	00 02                	add    %al,(%rdx)
+  804d09:	0c 80                	or     $0x80,%al
+  804d0b:	00 00                	add    %al,(%rax)
+  804d0d:	00 00                	add    %al,(%rax)
+  804d0f:	00 02                	add    %al,(%rdx)
+  804d11:	0c 80                	or     $0x80,%al
+  804d13:	00 00                	add    %al,(%rax)
+  804d15:	00 00                	add    %al,(%rax)
+  804d17:	00 02                	add    %al,(%rdx)
+  804d19:	0c 80                	or     $0x80,%al
+  804d1b:	00 00                	add    %al,(%rax)
+  804d1d:	00 00                	add    %al,(%rax)
+  804d1f:	00 02                	add    %al,(%rdx)
+  804d21:	0c 80                	or     $0x80,%al
+  804d23:	00 00                	add    %al,(%rax)
+  804d25:	00 00                	add    %al,(%rax)
+  804d27:	00 02                	add    %al,(%rdx)
+  804d29:	0c 80                	or     $0x80,%al
+  804d2b:	00 00                	add    %al,(%rax)
+  804d2d:	00 00                	add    %al,(%rax)
+  804d2f:	00 02                	add    %al,(%rdx)
+  804d31:	0c 80                	or     $0x80,%al
+  804d33:	00 00                	add    %al,(%rax)
+  804d35:	00 00                	add    %al,(%rax)
+  804d37:	00 02                	add    %al,(%rdx)
+  804d39:	0c 80                	or     $0x80,%al
+  804d3b:	00 00                	add    %al,(%rax)
+  804d3d:	00 00                	add    %al,(%rax)
+  804d3f:	00 02                	add    %al,(%rdx)
+  804d41:	0c 80                	or     $0x80,%al
+  804d43:	00 00                	add    %al,(%rax)
+  804d45:	00 00                	add    %al,(%rax)
+  804d47:	00 02                	add    %al,(%rdx)
+  804d49:	0c 80                	or     $0x80,%al
+  804d4b:	00 00                	add    %al,(%rax)
+  804d4d:	00 00                	add    %al,(%rax)
+  804d4f:	00 02                	add    %al,(%rdx)
+  804d51:	0c 80                	or     $0x80,%al
+  804d53:	00 00                	add    %al,(%rax)
+  804d55:	00 00                	add    %al,(%rax)
+  804d57:	00 02                	add    %al,(%rdx)
+  804d59:	0c 80                	or     $0x80,%al
+  804d5b:	00 00                	add    %al,(%rax)
+  804d5d:	00 00                	add    %al,(%rax)
+  804d5f:	00 02                	add    %al,(%rdx)
+  804d61:	0c 80                	or     $0x80,%al
+  804d63:	00 00                	add    %al,(%rax)
+  804d65:	00 00                	add    %al,(%rax)
+  804d67:	00 02                	add    %al,(%rdx)
+  804d69:	0c 80                	or     $0x80,%al
+  804d6b:	00 00                	add    %al,(%rax)
+  804d6d:	00 00                	add    %al,(%rax)
+  804d6f:	00 02                	add    %al,(%rdx)
+  804d71:	0c 80                	or     $0x80,%al
+  804d73:	00 00                	add    %al,(%rax)
+  804d75:	00 00                	add    %al,(%rax)
+  804d77:	00 02                	add    %al,(%rdx)
+  804d79:	0c 80                	or     $0x80,%al
+  804d7b:	00 00                	add    %al,(%rax)
+  804d7d:	00 00                	add    %al,(%rax)
+  804d7f:	00 02                	add    %al,(%rdx)
+  804d81:	0c 80                	or     $0x80,%al
+  804d83:	00 00                	add    %al,(%rax)
+  804d85:	00 00                	add    %al,(%rax)
+  804d87:	00 25 0b 80 00 00    	add    %ah,0x800b(%rip)        # 80cd98 <__ctors_end+0x6cb8>
+  804d8d:	00 00                	add    %al,(%rax)
+  804d8f:	00 02                	add    %al,(%rdx)
+  804d91:	0c 80                	or     $0x80,%al
+  804d93:	00 00                	add    %al,(%rax)
+  804d95:	00 00                	add    %al,(%rax)
+  804d97:	00 02                	add    %al,(%rdx)
+  804d99:	0c 80                	or     $0x80,%al
+  804d9b:	00 00                	add    %al,(%rax)
+  804d9d:	00 00                	add    %al,(%rax)
+  804d9f:	00 02                	add    %al,(%rdx)
+  804da1:	0c 80                	or     $0x80,%al
+  804da3:	00 00                	add    %al,(%rax)
+  804da5:	00 00                	add    %al,(%rax)
+  804da7:	00 02                	add    %al,(%rdx)
+  804da9:	0c 80                	or     $0x80,%al
+  804dab:	00 00                	add    %al,(%rax)
+  804dad:	00 00                	add    %al,(%rax)
+  804daf:	00 02                	add    %al,(%rdx)
+  804db1:	0c 80                	or     $0x80,%al
+  804db3:	00 00                	add    %al,(%rax)
+  804db5:	00 00                	add    %al,(%rax)
+  804db7:	00 02                	add    %al,(%rdx)
+  804db9:	0c 80                	or     $0x80,%al
+  804dbb:	00 00                	add    %al,(%rax)
+  804dbd:	00 00                	add    %al,(%rax)
+  804dbf:	00 02                	add    %al,(%rdx)
+  804dc1:	0c 80                	or     $0x80,%al
+  804dc3:	00 00                	add    %al,(%rax)
+  804dc5:	00 00                	add    %al,(%rax)
+  804dc7:	00 02                	add    %al,(%rdx)
+  804dc9:	0c 80                	or     $0x80,%al
+  804dcb:	00 00                	add    %al,(%rax)
+  804dcd:	00 00                	add    %al,(%rax)
+  804dcf:	00 02                	add    %al,(%rdx)
+  804dd1:	0c 80                	or     $0x80,%al
+  804dd3:	00 00                	add    %al,(%rax)
+  804dd5:	00 00                	add    %al,(%rax)
+  804dd7:	00 02                	add    %al,(%rdx)
+  804dd9:	0c 80                	or     $0x80,%al
+  804ddb:	00 00                	add    %al,(%rax)
+  804ddd:	00 00                	add    %al,(%rax)
+  804ddf:	00 71 06             	add    %dh,0x6(%rcx)
+  804de2:	80 00 00             	addb   $0x0,(%rax)
+  804de5:	00 00                	add    %al,(%rax)
+  804de7:	00 40 08             	add    %al,0x8(%rax)
+  804dea:	80 00 00             	addb   $0x0,(%rax)
+  804ded:	00 00                	add    %al,(%rax)
+  804def:	00 02                	add    %al,(%rdx)
+  804df1:	0c 80                	or     $0x80,%al
+  804df3:	00 00                	add    %al,(%rax)
+  804df5:	00 00                	add    %al,(%rax)
+  804df7:	00 02                	add    %al,(%rdx)
+  804df9:	0c 80                	or     $0x80,%al
+  804dfb:	00 00                	add    %al,(%rax)
+  804dfd:	00 00                	add    %al,(%rax)
+  804dff:	00 02                	add    %al,(%rdx)
+  804e01:	0c 80                	or     $0x80,%al
+  804e03:	00 00                	add    %al,(%rax)
+  804e05:	00 00                	add    %al,(%rax)
+  804e07:	00 02                	add    %al,(%rdx)
+  804e09:	0c 80                	or     $0x80,%al
+  804e0b:	00 00                	add    %al,(%rax)
+  804e0d:	00 00                	add    %al,(%rax)
+  804e0f:	00 a0 06 80 00 00    	add    %ah,0x8006(%rax)
+  804e15:	00 00                	add    %al,(%rax)
+  804e17:	00 02                	add    %al,(%rdx)
+  804e19:	0c 80                	or     $0x80,%al
+  804e1b:	00 00                	add    %al,(%rax)
+  804e1d:	00 00                	add    %al,(%rax)
+  804e1f:	00 02                	add    %al,(%rdx)
+  804e21:	0c 80                	or     $0x80,%al
+  804e23:	00 00                	add    %al,(%rax)
+  804e25:	00 00                	add    %al,(%rax)
+  804e27:	00 66 06             	add    %ah,0x6(%rsi)
+  804e2a:	80 00 00             	addb   $0x0,(%rax)
+  804e2d:	00 00                	add    %al,(%rax)
+  804e2f:	00 02                	add    %al,(%rdx)
+  804e31:	0c 80                	or     $0x80,%al
+  804e33:	00 00                	add    %al,(%rax)
+  804e35:	00 00                	add    %al,(%rax)
+  804e37:	00 02                	add    %al,(%rdx)
+  804e39:	0c 80                	or     $0x80,%al
+  804e3b:	00 00                	add    %al,(%rax)
+  804e3d:	00 00                	add    %al,(%rax)
+  804e3f:	00 e8                	add    %ch,%al
+  804e41:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804e47:	00 b2 0a 80 00 00    	add    %dh,0x800a(%rdx)
+  804e4d:	00 00                	add    %al,(%rax)
+  804e4f:	00 02                	add    %al,(%rdx)
+  804e51:	0c 80                	or     $0x80,%al
+  804e53:	00 00                	add    %al,(%rax)
+  804e55:	00 00                	add    %al,(%rax)
+  804e57:	00 02                	add    %al,(%rdx)
+  804e59:	0c 80                	or     $0x80,%al
+  804e5b:	00 00                	add    %al,(%rax)
+  804e5d:	00 00                	add    %al,(%rax)
+  804e5f:	00 37                	add    %dh,(%rdi)
+  804e61:	07                   	(bad)
+  804e62:	80 00 00             	addb   $0x0,(%rax)
+  804e65:	00 00                	add    %al,(%rax)
+  804e67:	00 02                	add    %al,(%rdx)
+  804e69:	0c 80                	or     $0x80,%al
+  804e6b:	00 00                	add    %al,(%rax)
+  804e6d:	00 00                	add    %al,(%rax)
+  804e6f:	00 14 09             	add    %dl,(%rcx,%rcx,1)
+  804e72:	80 00 00             	addb   $0x0,(%rax)
+  804e75:	00 00                	add    %al,(%rax)
+  804e77:	00 02                	add    %al,(%rdx)
+  804e79:	0c 80                	or     $0x80,%al
+  804e7b:	00 00                	add    %al,(%rax)
+  804e7d:	00 00                	add    %al,(%rax)
+  804e7f:	00 02                	add    %al,(%rdx)
+  804e81:	0c 80                	or     $0x80,%al
+  804e83:	00 00                	add    %al,(%rax)
+  804e85:	00 00                	add    %al,(%rax)
+  804e87:	00 25 0b 80 00 00    	add    %ah,0x800b(%rip)        # 80ce98 <__ctors_end+0x6db8>
+  804e8d:	00 00                	add    %al,(%rax)
+  804e8f:	00 02                	add    %al,(%rdx)
+  804e91:	0c 80                	or     $0x80,%al
+  804e93:	00 00                	add    %al,(%rax)
+  804e95:	00 00                	add    %al,(%rax)
+  804e97:	00 ca                	add    %cl,%dl
+  804e99:	05 80 00 00 00       	add    $0x80,%eax
+	...
+
+0000000000804ea0 <error_string>:
+	...
+  804ea8:	45 4a 80 00 00 00 00 00 57 4a 80 00 00 00 00 00     EJ......WJ......
+  804eb8:	67 4a 80 00 00 00 00 00 79 4a 80 00 00 00 00 00     gJ......yJ......
+  804ec8:	87 4a 80 00 00 00 00 00 9b 4a 80 00 00 00 00 00     .J.......J......
+  804ed8:	b0 4a 80 00 00 00 00 00 c3 4a 80 00 00 00 00 00     .J.......J......
+  804ee8:	d5 4a 80 00 00 00 00 00 e9 4a 80 00 00 00 00 00     .J.......J......
+  804ef8:	f9 4a 80 00 00 00 00 00 0c 4b 80 00 00 00 00 00     .J.......K......
+  804f08:	23 4b 80 00 00 00 00 00 39 4b 80 00 00 00 00 00     #K......9K......
+  804f18:	51 4b 80 00 00 00 00 00 69 4b 80 00 00 00 00 00     QK......iK......
+  804f28:	76 4b 80 00 00 00 00 00 58 4f 80 00 00 00 00 00     vK......XO......
+  804f38:	8a 4b 80 00 00 00 00 00 a2 4b 80 00 00 00 00 00     .K.......K......
+  804f48:	ac 4b 80 00 00 00 00 00 b6 4b 80 00 00 00 00 00     .K.......K......
+  804f58:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  804f68:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  804f78:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  804f88:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  804f98:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 73 66 6f     ib/syscall.c.sfo
+  804fa8:	72 6b 28 29 20 69 73 20 6e 6f 74 20 69 6d 70 6c     rk() is not impl
+  804fb8:	65 6d 65 6e 74 65 64 00 6c 69 62 2f 66 6f 72 6b     emented.lib/fork
+  804fc8:	2e 63 00 69 70 63 5f 73 65 6e 64 20 65 72 72 6f     .c.ipc_send erro
+  804fd8:	72 3a 20 25 69 0a 00 6c 69 62 2f 69 70 63 2e 63     r: %i..lib/ipc.c
+  804fe8:	00 0f 1f 80 00 00 00 00 5b 25 30 38 78 5d 20 75     ........[%08x] u
+  804ff8:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  805008:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  805018:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  805028:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  805038:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  805048:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  805058:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  805068:	0a 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805078:	84 00 00 00 00 00 66 90                             ......f.
+
+0000000000805080 <devtab>:
+  805080:	20 60 80 00 00 00 00 00 60 60 80 00 00 00 00 00      `......``......
+  805090:	a0 60 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .`..............
+  8050a0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  8050b0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8050c0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8050d0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8050e0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8050f0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  805100:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  805110:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  805120:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  805130:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  805140:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  805150:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  805160:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  805170:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805180:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805190:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8051a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8051b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8051c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8051d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8051e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8051f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805200:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805210:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805220:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805230:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805240:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805250:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805260:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805270:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805280:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805290:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8052a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8052b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8052c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8052d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8052e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8052f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805300:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805310:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805320:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805330:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805340:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805350:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805360:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805370:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805380:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805390:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8053a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8053b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8053c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8053d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8053e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8053f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805400:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805410:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805420:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805430:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805440:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805450:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805460:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805470:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805480:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805490:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8054a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8054b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8054c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8054d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8054e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8054f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805500:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805510:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805520:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805530:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805540:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805550:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805560:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805570:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805580:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805590:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8055a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8055b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8055c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8055d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8055e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8055f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805600:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805610:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805620:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805630:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805640:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805650:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805660:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805670:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805680:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805690:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8056a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8056b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8056c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8056d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8056e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8056f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805700:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805710:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805720:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805730:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805740:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805750:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805760:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805770:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805780:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805790:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8057a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8057b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8057c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8057d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8057e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8057f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805800:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805810:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805820:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805830:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805840:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805850:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805860:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805870:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805880:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805890:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8058a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8058b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8058c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8058d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8058e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8058f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805900:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805910:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805920:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805930:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805940:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805950:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805960:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805970:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805980:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805990:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8059a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8059b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8059c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8059d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8059e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8059f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805aa0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ab0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ac0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ad0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ae0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805af0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ba0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805bb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805bc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805bd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805be0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805bf0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ca0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805cb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805cc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805cd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ce0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805cf0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805da0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805db0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805dc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805dd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805de0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805df0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ea0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805eb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ec0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ed0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ee0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ef0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805fa0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805fb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805fc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805fd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805fe0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ff0:	0f 1f 84 00 00 00 00 00 0f 1f 84 00 00 00 00 00     ................
@@ -0,0 +1,9421 @@
+
+obj/user/spawnbench:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 30 01 00 00       	call   800153 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/x86.h>
+
+#define NSPAWNS 20
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 18          	sub    $0x18,%rsp
+  800036:	c7 45 cc 14 00 00 00 	movl   $0x14,-0x34(%rbp)
+    uint64_t entries = 0, cycles = 0;
+  80003d:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800043:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+
+    for (int i = 0; i < NSPAWNS; i++) {
+        uint64_t start_entries = thisenv->env_syscalls;
+  800049:	49 be 00 00 81 00 00 	movabs $0x810000,%r14
+  800050:	00 00 00 
+  800053:	49 8b 06             	mov    (%r14),%rax
+  800056:	4c 8b b8 c8 01 00 00 	mov    0x1c8(%rax),%r15
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  80005d:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  80005f:	48 c1 e2 20          	shl    $0x20,%rdx
+  800063:	89 c0                	mov    %eax,%eax
+  800065:	48 89 d3             	mov    %rdx,%rbx
+  800068:	48 09 c3             	or     %rax,%rbx
+        uint64_t start = read_tsc();
+
+        envid_t child = spawnl("hello", "hello", NULL);
+  80006b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800070:	48 be f8 53 80 00 00 	movabs $0x8053f8,%rsi
+  800077:	00 00 00 
+  80007a:	48 89 f7             	mov    %rsi,%rdi
+  80007d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800082:	48 b9 da 3e 80 00 00 	movabs $0x803eda,%rcx
+  800089:	00 00 00 
+  80008c:	ff d1                	call   *%rcx
+  80008e:	89 c7                	mov    %eax,%edi
+        if (child < 0) panic("spawn(hello): %i", child);
+  800090:	85 c0                	test   %eax,%eax
+  800092:	0f 88 8e 00 00 00    	js     800126 <umain+0x101>
+    asm volatile("rdtsc"
+  800098:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  80009a:	48 c1 e2 20          	shl    $0x20,%rdx
+  80009e:	89 c0                	mov    %eax,%eax
+  8000a0:	48 09 c2             	or     %rax,%rdx
+
+        cycles += read_tsc() - start;
+  8000a3:	48 29 da             	sub    %rbx,%rdx
+  8000a6:	49 01 d5             	add    %rdx,%r13
+        entries += thisenv->env_syscalls - start_entries;
+  8000a9:	49 8b 06             	mov    (%r14),%rax
+  8000ac:	48 8b 80 c8 01 00 00 	mov    0x1c8(%rax),%rax
+  8000b3:	4c 29 f8             	sub    %r15,%rax
+  8000b6:	49 01 c4             	add    %rax,%r12
+        wait(child);
+  8000b9:	48 b8 f3 45 80 00 00 	movabs $0x8045f3,%rax
+  8000c0:	00 00 00 
+  8000c3:	ff d0                	call   *%rax
+    for (int i = 0; i < NSPAWNS; i++) {
+  8000c5:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  8000c9:	75 88                	jne    800053 <umain+0x2e>
+    }
+
+    cprintf("spawnbench: %lu kernel entries, %lu Kcycles per spawn\n",
+            (unsigned long)(entries / NSPAWNS), (unsigned long)(cycles / NSPAWNS / 1000));
+  8000cb:	48 ba 4b 59 86 38 d6 	movabs $0x346dc5d63886594b,%rdx
+  8000d2:	c5 6d 34 
+  8000d5:	4c 89 e8             	mov    %r13,%rax
+  8000d8:	48 f7 e2             	mul    %rdx
+  8000db:	49 89 d5             	mov    %rdx,%r13
+  8000de:	49 c1 ed 0c          	shr    $0xc,%r13
+  8000e2:	48 ba cd cc cc cc cc 	movabs $0xcccccccccccccccd,%rdx
+  8000e9:	cc cc cc 
+  8000ec:	4c 89 e0             	mov    %r12,%rax
+  8000ef:	48 f7 e2             	mul    %rdx
+  8000f2:	48 89 d6             	mov    %rdx,%rsi
+  8000f5:	48 c1 ee 04          	shr    $0x4,%rsi
+    cprintf("spawnbench: %lu kernel entries, %lu Kcycles per spawn\n",
+  8000f9:	4c 89 ea             	mov    %r13,%rdx
+  8000fc:	48 bf 28 54 80 00 00 	movabs $0x805428,%rdi
+  800103:	00 00 00 
+  800106:	b8 00 00 00 00       	mov    $0x0,%eax
+  80010b:	48 b9 79 03 80 00 00 	movabs $0x800379,%rcx
+  800112:	00 00 00 
+  800115:	ff d1                	call   *%rcx
+}
+  800117:	48 83 c4 18          	add    $0x18,%rsp
+  80011b:	5b                   	pop    %rbx
+  80011c:	41 5c                	pop    %r12
+  80011e:	41 5d                	pop    %r13
+  800120:	41 5e                	pop    %r14
+  800122:	41 5f                	pop    %r15
+  800124:	5d                   	pop    %rbp
+  800125:	c3                   	ret
+        if (child < 0) panic("spawn(hello): %i", child);
+  800126:	89 c1                	mov    %eax,%ecx
+  800128:	48 ba fe 53 80 00 00 	movabs $0x8053fe,%rdx
+  80012f:	00 00 00 
+  800132:	be 14 00 00 00       	mov    $0x14,%esi
+  800137:	48 bf 0f 54 80 00 00 	movabs $0x80540f,%rdi
+  80013e:	00 00 00 
+  800141:	b8 00 00 00 00       	mov    $0x0,%eax
+  800146:	49 b8 29 02 80 00 00 	movabs $0x800229,%r8
+  80014d:	00 00 00 
+  800150:	41 ff d0             	call   *%r8
+
+0000000000800153 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800153:	55                   	push   %rbp
+  800154:	48 89 e5             	mov    %rsp,%rbp
+  800157:	41 56                	push   %r14
+  800159:	41 55                	push   %r13
+  80015b:	41 54                	push   %r12
+  80015d:	53                   	push   %rbx
+  80015e:	41 89 fd             	mov    %edi,%r13d
+  800161:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800164:	48 ba e0 60 80 00 00 	movabs $0x8060e0,%rdx
+  80016b:	00 00 00 
+  80016e:	48 b8 e0 60 80 00 00 	movabs $0x8060e0,%rax
+  800175:	00 00 00 
+  800178:	48 39 c2             	cmp    %rax,%rdx
+  80017b:	73 17                	jae    800194 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80017d:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800180:	49 89 c4             	mov    %rax,%r12
+  800183:	48 83 c3 08          	add    $0x8,%rbx
+  800187:	b8 00 00 00 00       	mov    $0x0,%eax
+  80018c:	ff 53 f8             	call   *-0x8(%rbx)
+  80018f:	4c 39 e3             	cmp    %r12,%rbx
+  800192:	72 ef                	jb     800183 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800194:	48 b8 70 11 80 00 00 	movabs $0x801170,%rax
+  80019b:	00 00 00 
+  80019e:	ff d0                	call   *%rax
+  8001a0:	89 c2                	mov    %eax,%edx
+  8001a2:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  8001a8:	48 89 d0             	mov    %rdx,%rax
+  8001ab:	48 c1 e0 04          	shl    $0x4,%rax
+  8001af:	48 29 d0             	sub    %rdx,%rax
+  8001b2:	48 c1 e0 05          	shl    $0x5,%rax
+  8001b6:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8001bd:	00 00 00 
+  8001c0:	48 01 d0             	add    %rdx,%rax
+  8001c3:	48 a3 00 00 81 00 00 	movabs %rax,0x810000
+  8001ca:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8001cd:	45 85 ed             	test   %r13d,%r13d
+  8001d0:	7e 0d                	jle    8001df <libmain+0x8c>
+  8001d2:	49 8b 06             	mov    (%r14),%rax
+  8001d5:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8001dc:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8001df:	4c 89 f6             	mov    %r14,%rsi
+  8001e2:	44 89 ef             	mov    %r13d,%edi
+  8001e5:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8001ec:	00 00 00 
+  8001ef:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8001f1:	48 b8 06 02 80 00 00 	movabs $0x800206,%rax
+  8001f8:	00 00 00 
+  8001fb:	ff d0                	call   *%rax
+#endif
+}
+  8001fd:	5b                   	pop    %rbx
+  8001fe:	41 5c                	pop    %r12
+  800200:	41 5d                	pop    %r13
+  800202:	41 5e                	pop    %r14
+  800204:	5d                   	pop    %rbp
+  800205:	c3                   	ret
+
+0000000000800206 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800206:	55                   	push   %rbp
+  800207:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80020a:	48 b8 56 18 80 00 00 	movabs $0x801856,%rax
+  800211:	00 00 00 
+  800214:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800216:	bf 00 00 00 00       	mov    $0x0,%edi
+  80021b:	48 b8 0d 11 80 00 00 	movabs $0x80110d,%rax
+  800222:	00 00 00 
+  800225:	ff d0                	call   *%rax
+}
+  800227:	5d                   	pop    %rbp
+  800228:	c3                   	ret
+
+0000000000800229 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800229:	55                   	push   %rbp
+  80022a:	48 89 e5             	mov    %rsp,%rbp
+  80022d:	41 56                	push   %r14
+  80022f:	41 55                	push   %r13
+  800231:	41 54                	push   %r12
+  800233:	53                   	push   %rbx
+  800234:	48 83 ec 50          	sub    $0x50,%rsp
+  800238:	49 89 fc             	mov    %rdi,%r12
+  80023b:	41 89 f5             	mov    %esi,%r13d
+  80023e:	48 89 d3             	mov    %rdx,%rbx
+  800241:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800245:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800249:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80024d:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800254:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800258:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80025c:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800260:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800264:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80026b:	00 00 00 
+  80026e:	4c 8b 30             	mov    (%rax),%r14
+  800271:	48 b8 70 11 80 00 00 	movabs $0x801170,%rax
+  800278:	00 00 00 
+  80027b:	ff d0                	call   *%rax
+  80027d:	89 c6                	mov    %eax,%esi
+  80027f:	45 89 e8             	mov    %r13d,%r8d
+  800282:	4c 89 e1             	mov    %r12,%rcx
+  800285:	4c 89 f2             	mov    %r14,%rdx
+  800288:	48 bf 70 54 80 00 00 	movabs $0x805470,%rdi
+  80028f:	00 00 00 
+  800292:	b8 00 00 00 00       	mov    $0x0,%eax
+  800297:	49 bc 79 03 80 00 00 	movabs $0x800379,%r12
+  80029e:	00 00 00 
+  8002a1:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8002a4:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8002a8:	48 89 df             	mov    %rbx,%rdi
+  8002ab:	48 b8 15 03 80 00 00 	movabs $0x800315,%rax
+  8002b2:	00 00 00 
+  8002b5:	ff d0                	call   *%rax
+    cprintf("\n");
+  8002b7:	48 bf 83 5a 80 00 00 	movabs $0x805a83,%rdi
+  8002be:	00 00 00 
+  8002c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002c6:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8002c9:	cc                   	int3
+  8002ca:	eb fd                	jmp    8002c9 <_panic+0xa0>
+
+00000000008002cc <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8002cc:	55                   	push   %rbp
+  8002cd:	48 89 e5             	mov    %rsp,%rbp
+  8002d0:	53                   	push   %rbx
+  8002d1:	48 83 ec 08          	sub    $0x8,%rsp
+  8002d5:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8002d8:	8b 06                	mov    (%rsi),%eax
+  8002da:	8d 50 01             	lea    0x1(%rax),%edx
+  8002dd:	89 16                	mov    %edx,(%rsi)
+  8002df:	48 98                	cltq
+  8002e1:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8002e6:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8002ec:	74 0a                	je     8002f8 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8002ee:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8002f2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002f6:	c9                   	leave
+  8002f7:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8002f8:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8002fc:	be ff 00 00 00       	mov    $0xff,%esi
+  800301:	48 b8 c5 10 80 00 00 	movabs $0x8010c5,%rax
+  800308:	00 00 00 
+  80030b:	ff d0                	call   *%rax
+        state->offset = 0;
+  80030d:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800313:	eb d9                	jmp    8002ee <putch+0x22>
+
+0000000000800315 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800315:	55                   	push   %rbp
+  800316:	48 89 e5             	mov    %rsp,%rbp
+  800319:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800320:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800323:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80032a:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80032f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800334:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800337:	48 89 f1             	mov    %rsi,%rcx
+  80033a:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800341:	48 bf cc 02 80 00 00 	movabs $0x8002cc,%rdi
+  800348:	00 00 00 
+  80034b:	48 b8 c9 04 80 00 00 	movabs $0x8004c9,%rax
+  800352:	00 00 00 
+  800355:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800357:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80035e:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800365:	48 b8 c5 10 80 00 00 	movabs $0x8010c5,%rax
+  80036c:	00 00 00 
+  80036f:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800371:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800377:	c9                   	leave
+  800378:	c3                   	ret
+
+0000000000800379 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800379:	55                   	push   %rbp
+  80037a:	48 89 e5             	mov    %rsp,%rbp
+  80037d:	48 83 ec 50          	sub    $0x50,%rsp
+  800381:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800385:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800389:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80038d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800391:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800395:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80039c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003a0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003a4:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8003a8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8003ac:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8003b0:	48 b8 15 03 80 00 00 	movabs $0x800315,%rax
+  8003b7:	00 00 00 
+  8003ba:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8003bc:	c9                   	leave
+  8003bd:	c3                   	ret
+
+00000000008003be <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8003be:	55                   	push   %rbp
+  8003bf:	48 89 e5             	mov    %rsp,%rbp
+  8003c2:	41 57                	push   %r15
+  8003c4:	41 56                	push   %r14
+  8003c6:	41 55                	push   %r13
+  8003c8:	41 54                	push   %r12
+  8003ca:	53                   	push   %rbx
+  8003cb:	48 83 ec 18          	sub    $0x18,%rsp
+  8003cf:	49 89 fc             	mov    %rdi,%r12
+  8003d2:	49 89 f5             	mov    %rsi,%r13
+  8003d5:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8003d9:	8b 45 10             	mov    0x10(%rbp),%eax
+  8003dc:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8003df:	41 89 cf             	mov    %ecx,%r15d
+  8003e2:	4c 39 fa             	cmp    %r15,%rdx
+  8003e5:	73 5b                	jae    800442 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8003e7:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8003eb:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8003ef:	85 db                	test   %ebx,%ebx
+  8003f1:	7e 0e                	jle    800401 <print_num+0x43>
+            putch(padc, put_arg);
+  8003f3:	4c 89 ee             	mov    %r13,%rsi
+  8003f6:	44 89 f7             	mov    %r14d,%edi
+  8003f9:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8003fc:	83 eb 01             	sub    $0x1,%ebx
+  8003ff:	75 f2                	jne    8003f3 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800401:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800405:	48 b9 a4 54 80 00 00 	movabs $0x8054a4,%rcx
+  80040c:	00 00 00 
+  80040f:	48 b8 93 54 80 00 00 	movabs $0x805493,%rax
+  800416:	00 00 00 
+  800419:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80041d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800421:	ba 00 00 00 00       	mov    $0x0,%edx
+  800426:	49 f7 f7             	div    %r15
+  800429:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80042d:	4c 89 ee             	mov    %r13,%rsi
+  800430:	41 ff d4             	call   *%r12
+}
+  800433:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800437:	5b                   	pop    %rbx
+  800438:	41 5c                	pop    %r12
+  80043a:	41 5d                	pop    %r13
+  80043c:	41 5e                	pop    %r14
+  80043e:	41 5f                	pop    %r15
+  800440:	5d                   	pop    %rbp
+  800441:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800442:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800446:	ba 00 00 00 00       	mov    $0x0,%edx
+  80044b:	49 f7 f7             	div    %r15
+  80044e:	48 83 ec 08          	sub    $0x8,%rsp
+  800452:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800456:	52                   	push   %rdx
+  800457:	45 0f be c9          	movsbl %r9b,%r9d
+  80045b:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80045f:	48 89 c2             	mov    %rax,%rdx
+  800462:	48 b8 be 03 80 00 00 	movabs $0x8003be,%rax
+  800469:	00 00 00 
+  80046c:	ff d0                	call   *%rax
+  80046e:	48 83 c4 10          	add    $0x10,%rsp
+  800472:	eb 8d                	jmp    800401 <print_num+0x43>
+
+0000000000800474 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800474:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800478:	48 8b 06             	mov    (%rsi),%rax
+  80047b:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80047f:	73 0a                	jae    80048b <sprintputch+0x17>
+        *state->start++ = ch;
+  800481:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800485:	48 89 16             	mov    %rdx,(%rsi)
+  800488:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80048b:	c3                   	ret
+
+000000000080048c <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80048c:	55                   	push   %rbp
+  80048d:	48 89 e5             	mov    %rsp,%rbp
+  800490:	48 83 ec 50          	sub    $0x50,%rsp
+  800494:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800498:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80049c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8004a0:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8004a7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8004ab:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004af:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8004b3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8004b7:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8004bb:	48 b8 c9 04 80 00 00 	movabs $0x8004c9,%rax
+  8004c2:	00 00 00 
+  8004c5:	ff d0                	call   *%rax
+}
+  8004c7:	c9                   	leave
+  8004c8:	c3                   	ret
+
+00000000008004c9 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8004c9:	55                   	push   %rbp
+  8004ca:	48 89 e5             	mov    %rsp,%rbp
+  8004cd:	41 57                	push   %r15
+  8004cf:	41 56                	push   %r14
+  8004d1:	41 55                	push   %r13
+  8004d3:	41 54                	push   %r12
+  8004d5:	53                   	push   %rbx
+  8004d6:	48 83 ec 38          	sub    $0x38,%rsp
+  8004da:	49 89 fe             	mov    %rdi,%r14
+  8004dd:	49 89 f5             	mov    %rsi,%r13
+  8004e0:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8004e3:	48 8b 01             	mov    (%rcx),%rax
+  8004e6:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8004ea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8004ee:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004f2:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8004f6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8004fa:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8004fe:	0f b6 3b             	movzbl (%rbx),%edi
+  800501:	40 80 ff 25          	cmp    $0x25,%dil
+  800505:	74 18                	je     80051f <vprintfmt+0x56>
+            if (!ch) return;
+  800507:	40 84 ff             	test   %dil,%dil
+  80050a:	0f 84 b1 06 00 00    	je     800bc1 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800510:	40 0f b6 ff          	movzbl %dil,%edi
+  800514:	4c 89 ee             	mov    %r13,%rsi
+  800517:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80051a:	4c 89 e3             	mov    %r12,%rbx
+  80051d:	eb db                	jmp    8004fa <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80051f:	be 00 00 00 00       	mov    $0x0,%esi
+  800524:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800528:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80052d:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800533:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80053a:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80053e:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800543:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800548:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80054b:	83 e8 23             	sub    $0x23,%eax
+  80054e:	3c 57                	cmp    $0x57,%al
+  800550:	0f 87 51 06 00 00    	ja     800ba7 <vprintfmt+0x6de>
+  800556:	0f b6 c0             	movzbl %al,%eax
+  800559:	48 b9 60 56 80 00 00 	movabs $0x805660,%rcx
+  800560:	00 00 00 
+  800563:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800566:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800569:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80056d:	eb cf                	jmp    80053e <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  80056f:	49 89 dc             	mov    %rbx,%r12
+  800572:	be 01 00 00 00       	mov    $0x1,%esi
+  800577:	eb c5                	jmp    80053e <vprintfmt+0x75>
+            padc = ch;
+  800579:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80057d:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800580:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800583:	eb b9                	jmp    80053e <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800585:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800588:	83 f8 2f             	cmp    $0x2f,%eax
+  80058b:	77 24                	ja     8005b1 <vprintfmt+0xe8>
+  80058d:	89 c1                	mov    %eax,%ecx
+  80058f:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800593:	83 c0 08             	add    $0x8,%eax
+  800596:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800599:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80059c:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80059f:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8005a3:	79 99                	jns    80053e <vprintfmt+0x75>
+                width = precision;
+  8005a5:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8005a9:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8005af:	eb 8d                	jmp    80053e <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8005b1:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8005b5:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8005b9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005bd:	eb da                	jmp    800599 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8005bf:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8005c4:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8005c8:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8005ce:	3c 39                	cmp    $0x39,%al
+  8005d0:	77 1c                	ja     8005ee <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8005d2:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8005d6:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8005da:	0f b6 c0             	movzbl %al,%eax
+  8005dd:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8005e2:	0f b6 03             	movzbl (%rbx),%eax
+  8005e5:	3c 39                	cmp    $0x39,%al
+  8005e7:	76 e9                	jbe    8005d2 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8005e9:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8005ec:	eb b1                	jmp    80059f <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8005ee:	49 89 dc             	mov    %rbx,%r12
+  8005f1:	eb ac                	jmp    80059f <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8005f3:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8005f6:	85 c9                	test   %ecx,%ecx
+  8005f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005fd:	0f 49 c1             	cmovns %ecx,%eax
+  800600:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800603:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800606:	e9 33 ff ff ff       	jmp    80053e <vprintfmt+0x75>
+            lflag++;
+  80060b:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80060e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800611:	e9 28 ff ff ff       	jmp    80053e <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800616:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800619:	83 f8 2f             	cmp    $0x2f,%eax
+  80061c:	77 19                	ja     800637 <vprintfmt+0x16e>
+  80061e:	89 c2                	mov    %eax,%edx
+  800620:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800624:	83 c0 08             	add    $0x8,%eax
+  800627:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80062a:	8b 3a                	mov    (%rdx),%edi
+  80062c:	4c 89 ee             	mov    %r13,%rsi
+  80062f:	41 ff d6             	call   *%r14
+            break;
+  800632:	e9 c3 fe ff ff       	jmp    8004fa <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800637:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80063b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80063f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800643:	eb e5                	jmp    80062a <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800645:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800648:	83 f8 2f             	cmp    $0x2f,%eax
+  80064b:	77 5a                	ja     8006a7 <vprintfmt+0x1de>
+  80064d:	89 c2                	mov    %eax,%edx
+  80064f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800653:	83 c0 08             	add    $0x8,%eax
+  800656:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800659:	8b 02                	mov    (%rdx),%eax
+  80065b:	89 c1                	mov    %eax,%ecx
+  80065d:	f7 d9                	neg    %ecx
+  80065f:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800662:	83 f9 16             	cmp    $0x16,%ecx
+  800665:	7f 4e                	jg     8006b5 <vprintfmt+0x1ec>
+  800667:	48 63 c1             	movslq %ecx,%rax
+  80066a:	48 ba 20 59 80 00 00 	movabs $0x805920,%rdx
+  800671:	00 00 00 
+  800674:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800678:	48 85 c0             	test   %rax,%rax
+  80067b:	74 38                	je     8006b5 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80067d:	48 89 c1             	mov    %rax,%rcx
+  800680:	48 ba c3 5b 80 00 00 	movabs $0x805bc3,%rdx
+  800687:	00 00 00 
+  80068a:	4c 89 ee             	mov    %r13,%rsi
+  80068d:	4c 89 f7             	mov    %r14,%rdi
+  800690:	b8 00 00 00 00       	mov    $0x0,%eax
+  800695:	49 b8 8c 04 80 00 00 	movabs $0x80048c,%r8
+  80069c:	00 00 00 
+  80069f:	41 ff d0             	call   *%r8
+  8006a2:	e9 53 fe ff ff       	jmp    8004fa <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8006a7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006ab:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006af:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006b3:	eb a4                	jmp    800659 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8006b5:	48 ba bc 54 80 00 00 	movabs $0x8054bc,%rdx
+  8006bc:	00 00 00 
+  8006bf:	4c 89 ee             	mov    %r13,%rsi
+  8006c2:	4c 89 f7             	mov    %r14,%rdi
+  8006c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006ca:	49 b8 8c 04 80 00 00 	movabs $0x80048c,%r8
+  8006d1:	00 00 00 
+  8006d4:	41 ff d0             	call   *%r8
+  8006d7:	e9 1e fe ff ff       	jmp    8004fa <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8006dc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006df:	83 f8 2f             	cmp    $0x2f,%eax
+  8006e2:	77 6c                	ja     800750 <vprintfmt+0x287>
+  8006e4:	89 c2                	mov    %eax,%edx
+  8006e6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006ea:	83 c0 08             	add    $0x8,%eax
+  8006ed:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006f0:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8006f3:	48 85 d2             	test   %rdx,%rdx
+  8006f6:	48 b8 b5 54 80 00 00 	movabs $0x8054b5,%rax
+  8006fd:	00 00 00 
+  800700:	48 0f 45 c2          	cmovne %rdx,%rax
+  800704:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800708:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80070c:	7e 06                	jle    800714 <vprintfmt+0x24b>
+  80070e:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800712:	75 4a                	jne    80075e <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800714:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800718:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80071c:	0f b6 00             	movzbl (%rax),%eax
+  80071f:	84 c0                	test   %al,%al
+  800721:	0f 85 9a 00 00 00    	jne    8007c1 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800727:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80072a:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80072e:	85 c0                	test   %eax,%eax
+  800730:	0f 8e c4 fd ff ff    	jle    8004fa <vprintfmt+0x31>
+  800736:	4c 89 ee             	mov    %r13,%rsi
+  800739:	bf 20 00 00 00       	mov    $0x20,%edi
+  80073e:	41 ff d6             	call   *%r14
+  800741:	41 83 ec 01          	sub    $0x1,%r12d
+  800745:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800749:	75 eb                	jne    800736 <vprintfmt+0x26d>
+  80074b:	e9 aa fd ff ff       	jmp    8004fa <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800750:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800754:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800758:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80075c:	eb 92                	jmp    8006f0 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80075e:	49 63 f7             	movslq %r15d,%rsi
+  800761:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800765:	48 b8 7b 0c 80 00 00 	movabs $0x800c7b,%rax
+  80076c:	00 00 00 
+  80076f:	ff d0                	call   *%rax
+  800771:	48 89 c2             	mov    %rax,%rdx
+  800774:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800777:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800779:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80077c:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80077f:	85 c0                	test   %eax,%eax
+  800781:	7e 91                	jle    800714 <vprintfmt+0x24b>
+  800783:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800788:	4c 89 ee             	mov    %r13,%rsi
+  80078b:	44 89 e7             	mov    %r12d,%edi
+  80078e:	41 ff d6             	call   *%r14
+  800791:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800795:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800798:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80079b:	75 eb                	jne    800788 <vprintfmt+0x2bf>
+  80079d:	e9 72 ff ff ff       	jmp    800714 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8007a2:	0f b6 f8             	movzbl %al,%edi
+  8007a5:	4c 89 ee             	mov    %r13,%rsi
+  8007a8:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8007ab:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8007af:	49 83 c4 01          	add    $0x1,%r12
+  8007b3:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8007b9:	84 c0                	test   %al,%al
+  8007bb:	0f 84 66 ff ff ff    	je     800727 <vprintfmt+0x25e>
+  8007c1:	45 85 ff             	test   %r15d,%r15d
+  8007c4:	78 0a                	js     8007d0 <vprintfmt+0x307>
+  8007c6:	41 83 ef 01          	sub    $0x1,%r15d
+  8007ca:	0f 88 57 ff ff ff    	js     800727 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8007d0:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8007d4:	74 cc                	je     8007a2 <vprintfmt+0x2d9>
+  8007d6:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8007d9:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8007de:	80 fa 5e             	cmp    $0x5e,%dl
+  8007e1:	77 c2                	ja     8007a5 <vprintfmt+0x2dc>
+  8007e3:	eb bd                	jmp    8007a2 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8007e5:	40 84 f6             	test   %sil,%sil
+  8007e8:	75 26                	jne    800810 <vprintfmt+0x347>
+    switch (lflag) {
+  8007ea:	85 d2                	test   %edx,%edx
+  8007ec:	74 59                	je     800847 <vprintfmt+0x37e>
+  8007ee:	83 fa 01             	cmp    $0x1,%edx
+  8007f1:	74 7b                	je     80086e <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8007f3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007f6:	83 f8 2f             	cmp    $0x2f,%eax
+  8007f9:	0f 87 96 00 00 00    	ja     800895 <vprintfmt+0x3cc>
+  8007ff:	89 c2                	mov    %eax,%edx
+  800801:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800805:	83 c0 08             	add    $0x8,%eax
+  800808:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80080b:	4c 8b 22             	mov    (%rdx),%r12
+  80080e:	eb 17                	jmp    800827 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800810:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800813:	83 f8 2f             	cmp    $0x2f,%eax
+  800816:	77 21                	ja     800839 <vprintfmt+0x370>
+  800818:	89 c2                	mov    %eax,%edx
+  80081a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80081e:	83 c0 08             	add    $0x8,%eax
+  800821:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800824:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800827:	4d 85 e4             	test   %r12,%r12
+  80082a:	78 7a                	js     8008a6 <vprintfmt+0x3dd>
+            num = i;
+  80082c:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80082f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800834:	e9 50 02 00 00       	jmp    800a89 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800839:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80083d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800841:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800845:	eb dd                	jmp    800824 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800847:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80084a:	83 f8 2f             	cmp    $0x2f,%eax
+  80084d:	77 11                	ja     800860 <vprintfmt+0x397>
+  80084f:	89 c2                	mov    %eax,%edx
+  800851:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800855:	83 c0 08             	add    $0x8,%eax
+  800858:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80085b:	4c 63 22             	movslq (%rdx),%r12
+  80085e:	eb c7                	jmp    800827 <vprintfmt+0x35e>
+  800860:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800864:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800868:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80086c:	eb ed                	jmp    80085b <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  80086e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800871:	83 f8 2f             	cmp    $0x2f,%eax
+  800874:	77 11                	ja     800887 <vprintfmt+0x3be>
+  800876:	89 c2                	mov    %eax,%edx
+  800878:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80087c:	83 c0 08             	add    $0x8,%eax
+  80087f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800882:	4c 8b 22             	mov    (%rdx),%r12
+  800885:	eb a0                	jmp    800827 <vprintfmt+0x35e>
+  800887:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80088b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80088f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800893:	eb ed                	jmp    800882 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800895:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800899:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80089d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008a1:	e9 65 ff ff ff       	jmp    80080b <vprintfmt+0x342>
+                putch('-', put_arg);
+  8008a6:	4c 89 ee             	mov    %r13,%rsi
+  8008a9:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8008ae:	41 ff d6             	call   *%r14
+                i = -i;
+  8008b1:	49 f7 dc             	neg    %r12
+  8008b4:	e9 73 ff ff ff       	jmp    80082c <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8008b9:	40 84 f6             	test   %sil,%sil
+  8008bc:	75 32                	jne    8008f0 <vprintfmt+0x427>
+    switch (lflag) {
+  8008be:	85 d2                	test   %edx,%edx
+  8008c0:	74 5d                	je     80091f <vprintfmt+0x456>
+  8008c2:	83 fa 01             	cmp    $0x1,%edx
+  8008c5:	0f 84 82 00 00 00    	je     80094d <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8008cb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008ce:	83 f8 2f             	cmp    $0x2f,%eax
+  8008d1:	0f 87 a5 00 00 00    	ja     80097c <vprintfmt+0x4b3>
+  8008d7:	89 c2                	mov    %eax,%edx
+  8008d9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008dd:	83 c0 08             	add    $0x8,%eax
+  8008e0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008e3:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8008e6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8008eb:	e9 99 01 00 00       	jmp    800a89 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8008f0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008f3:	83 f8 2f             	cmp    $0x2f,%eax
+  8008f6:	77 19                	ja     800911 <vprintfmt+0x448>
+  8008f8:	89 c2                	mov    %eax,%edx
+  8008fa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008fe:	83 c0 08             	add    $0x8,%eax
+  800901:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800904:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800907:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80090c:	e9 78 01 00 00       	jmp    800a89 <vprintfmt+0x5c0>
+  800911:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800915:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800919:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80091d:	eb e5                	jmp    800904 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  80091f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800922:	83 f8 2f             	cmp    $0x2f,%eax
+  800925:	77 18                	ja     80093f <vprintfmt+0x476>
+  800927:	89 c2                	mov    %eax,%edx
+  800929:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80092d:	83 c0 08             	add    $0x8,%eax
+  800930:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800933:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800935:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80093a:	e9 4a 01 00 00       	jmp    800a89 <vprintfmt+0x5c0>
+  80093f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800943:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800947:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80094b:	eb e6                	jmp    800933 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  80094d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800950:	83 f8 2f             	cmp    $0x2f,%eax
+  800953:	77 19                	ja     80096e <vprintfmt+0x4a5>
+  800955:	89 c2                	mov    %eax,%edx
+  800957:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80095b:	83 c0 08             	add    $0x8,%eax
+  80095e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800961:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800964:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800969:	e9 1b 01 00 00       	jmp    800a89 <vprintfmt+0x5c0>
+  80096e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800972:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800976:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80097a:	eb e5                	jmp    800961 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  80097c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800980:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800984:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800988:	e9 56 ff ff ff       	jmp    8008e3 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  80098d:	40 84 f6             	test   %sil,%sil
+  800990:	75 2e                	jne    8009c0 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800992:	85 d2                	test   %edx,%edx
+  800994:	74 59                	je     8009ef <vprintfmt+0x526>
+  800996:	83 fa 01             	cmp    $0x1,%edx
+  800999:	74 7f                	je     800a1a <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  80099b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80099e:	83 f8 2f             	cmp    $0x2f,%eax
+  8009a1:	0f 87 9f 00 00 00    	ja     800a46 <vprintfmt+0x57d>
+  8009a7:	89 c2                	mov    %eax,%edx
+  8009a9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009ad:	83 c0 08             	add    $0x8,%eax
+  8009b0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009b3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8009b6:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8009bb:	e9 c9 00 00 00       	jmp    800a89 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009c0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009c3:	83 f8 2f             	cmp    $0x2f,%eax
+  8009c6:	77 19                	ja     8009e1 <vprintfmt+0x518>
+  8009c8:	89 c2                	mov    %eax,%edx
+  8009ca:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009ce:	83 c0 08             	add    $0x8,%eax
+  8009d1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009d4:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8009d7:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8009dc:	e9 a8 00 00 00       	jmp    800a89 <vprintfmt+0x5c0>
+  8009e1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009e5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009e9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009ed:	eb e5                	jmp    8009d4 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8009ef:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009f2:	83 f8 2f             	cmp    $0x2f,%eax
+  8009f5:	77 15                	ja     800a0c <vprintfmt+0x543>
+  8009f7:	89 c2                	mov    %eax,%edx
+  8009f9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009fd:	83 c0 08             	add    $0x8,%eax
+  800a00:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a03:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800a05:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800a0a:	eb 7d                	jmp    800a89 <vprintfmt+0x5c0>
+  800a0c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a10:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a14:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a18:	eb e9                	jmp    800a03 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800a1a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a1d:	83 f8 2f             	cmp    $0x2f,%eax
+  800a20:	77 16                	ja     800a38 <vprintfmt+0x56f>
+  800a22:	89 c2                	mov    %eax,%edx
+  800a24:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a28:	83 c0 08             	add    $0x8,%eax
+  800a2b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a2e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a31:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800a36:	eb 51                	jmp    800a89 <vprintfmt+0x5c0>
+  800a38:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a3c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a40:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a44:	eb e8                	jmp    800a2e <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800a46:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a4a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a4e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a52:	e9 5c ff ff ff       	jmp    8009b3 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800a57:	4c 89 ee             	mov    %r13,%rsi
+  800a5a:	bf 30 00 00 00       	mov    $0x30,%edi
+  800a5f:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800a62:	4c 89 ee             	mov    %r13,%rsi
+  800a65:	bf 78 00 00 00       	mov    $0x78,%edi
+  800a6a:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800a6d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a70:	83 f8 2f             	cmp    $0x2f,%eax
+  800a73:	77 47                	ja     800abc <vprintfmt+0x5f3>
+  800a75:	89 c2                	mov    %eax,%edx
+  800a77:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a7b:	83 c0 08             	add    $0x8,%eax
+  800a7e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a81:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a84:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800a89:	48 83 ec 08          	sub    $0x8,%rsp
+  800a8d:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800a91:	0f 94 c0             	sete   %al
+  800a94:	0f b6 c0             	movzbl %al,%eax
+  800a97:	50                   	push   %rax
+  800a98:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800a9d:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800aa1:	4c 89 ee             	mov    %r13,%rsi
+  800aa4:	4c 89 f7             	mov    %r14,%rdi
+  800aa7:	48 b8 be 03 80 00 00 	movabs $0x8003be,%rax
+  800aae:	00 00 00 
+  800ab1:	ff d0                	call   *%rax
+            break;
+  800ab3:	48 83 c4 10          	add    $0x10,%rsp
+  800ab7:	e9 3e fa ff ff       	jmp    8004fa <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800abc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ac0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ac4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ac8:	eb b7                	jmp    800a81 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800aca:	40 84 f6             	test   %sil,%sil
+  800acd:	75 2b                	jne    800afa <vprintfmt+0x631>
+    switch (lflag) {
+  800acf:	85 d2                	test   %edx,%edx
+  800ad1:	74 56                	je     800b29 <vprintfmt+0x660>
+  800ad3:	83 fa 01             	cmp    $0x1,%edx
+  800ad6:	74 7f                	je     800b57 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800ad8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800adb:	83 f8 2f             	cmp    $0x2f,%eax
+  800ade:	0f 87 a2 00 00 00    	ja     800b86 <vprintfmt+0x6bd>
+  800ae4:	89 c2                	mov    %eax,%edx
+  800ae6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aea:	83 c0 08             	add    $0x8,%eax
+  800aed:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800af0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800af3:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800af8:	eb 8f                	jmp    800a89 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800afa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800afd:	83 f8 2f             	cmp    $0x2f,%eax
+  800b00:	77 19                	ja     800b1b <vprintfmt+0x652>
+  800b02:	89 c2                	mov    %eax,%edx
+  800b04:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b08:	83 c0 08             	add    $0x8,%eax
+  800b0b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b0e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b11:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b16:	e9 6e ff ff ff       	jmp    800a89 <vprintfmt+0x5c0>
+  800b1b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b1f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b23:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b27:	eb e5                	jmp    800b0e <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800b29:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b2c:	83 f8 2f             	cmp    $0x2f,%eax
+  800b2f:	77 18                	ja     800b49 <vprintfmt+0x680>
+  800b31:	89 c2                	mov    %eax,%edx
+  800b33:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b37:	83 c0 08             	add    $0x8,%eax
+  800b3a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b3d:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800b3f:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800b44:	e9 40 ff ff ff       	jmp    800a89 <vprintfmt+0x5c0>
+  800b49:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b4d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b51:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b55:	eb e6                	jmp    800b3d <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800b57:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b5a:	83 f8 2f             	cmp    $0x2f,%eax
+  800b5d:	77 19                	ja     800b78 <vprintfmt+0x6af>
+  800b5f:	89 c2                	mov    %eax,%edx
+  800b61:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b65:	83 c0 08             	add    $0x8,%eax
+  800b68:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b6b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b6e:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800b73:	e9 11 ff ff ff       	jmp    800a89 <vprintfmt+0x5c0>
+  800b78:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b7c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b80:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b84:	eb e5                	jmp    800b6b <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800b86:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b8a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b8e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b92:	e9 59 ff ff ff       	jmp    800af0 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800b97:	4c 89 ee             	mov    %r13,%rsi
+  800b9a:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b9f:	41 ff d6             	call   *%r14
+            break;
+  800ba2:	e9 53 f9 ff ff       	jmp    8004fa <vprintfmt+0x31>
+            putch('%', put_arg);
+  800ba7:	4c 89 ee             	mov    %r13,%rsi
+  800baa:	bf 25 00 00 00       	mov    $0x25,%edi
+  800baf:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800bb2:	48 83 eb 01          	sub    $0x1,%rbx
+  800bb6:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800bba:	75 f6                	jne    800bb2 <vprintfmt+0x6e9>
+  800bbc:	e9 39 f9 ff ff       	jmp    8004fa <vprintfmt+0x31>
+}
+  800bc1:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800bc5:	5b                   	pop    %rbx
+  800bc6:	41 5c                	pop    %r12
+  800bc8:	41 5d                	pop    %r13
+  800bca:	41 5e                	pop    %r14
+  800bcc:	41 5f                	pop    %r15
+  800bce:	5d                   	pop    %rbp
+  800bcf:	c3                   	ret
+
+0000000000800bd0 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800bd0:	55                   	push   %rbp
+  800bd1:	48 89 e5             	mov    %rsp,%rbp
+  800bd4:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800bd8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800bdc:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800be1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800be5:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800bec:	48 85 ff             	test   %rdi,%rdi
+  800bef:	74 2b                	je     800c1c <vsnprintf+0x4c>
+  800bf1:	48 85 f6             	test   %rsi,%rsi
+  800bf4:	74 26                	je     800c1c <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800bf6:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800bfa:	48 bf 74 04 80 00 00 	movabs $0x800474,%rdi
+  800c01:	00 00 00 
+  800c04:	48 b8 c9 04 80 00 00 	movabs $0x8004c9,%rax
+  800c0b:	00 00 00 
+  800c0e:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800c10:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c14:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800c17:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800c1a:	c9                   	leave
+  800c1b:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800c1c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c21:	eb f7                	jmp    800c1a <vsnprintf+0x4a>
+
+0000000000800c23 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800c23:	55                   	push   %rbp
+  800c24:	48 89 e5             	mov    %rsp,%rbp
+  800c27:	48 83 ec 50          	sub    $0x50,%rsp
+  800c2b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800c2f:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800c33:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800c37:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800c3e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800c42:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c46:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800c4a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800c4e:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800c52:	48 b8 d0 0b 80 00 00 	movabs $0x800bd0,%rax
+  800c59:	00 00 00 
+  800c5c:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800c5e:	c9                   	leave
+  800c5f:	c3                   	ret
+
+0000000000800c60 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800c60:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800c63:	74 10                	je     800c75 <strlen+0x15>
+    size_t n = 0;
+  800c65:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800c6a:	48 83 c0 01          	add    $0x1,%rax
+  800c6e:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800c72:	75 f6                	jne    800c6a <strlen+0xa>
+  800c74:	c3                   	ret
+    size_t n = 0;
+  800c75:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800c7a:	c3                   	ret
+
+0000000000800c7b <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800c7b:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800c7e:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800c83:	48 85 f6             	test   %rsi,%rsi
+  800c86:	74 11                	je     800c99 <strnlen+0x1e>
+  800c88:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800c8c:	74 0c                	je     800c9a <strnlen+0x1f>
+  800c8e:	48 83 c2 01          	add    $0x1,%rdx
+  800c92:	48 39 d0             	cmp    %rdx,%rax
+  800c95:	75 f1                	jne    800c88 <strnlen+0xd>
+  800c97:	eb 04                	jmp    800c9d <strnlen+0x22>
+  800c99:	c3                   	ret
+  800c9a:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800c9d:	c3                   	ret
+
+0000000000800c9e <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800c9e:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800ca1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ca6:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800caa:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800cad:	48 83 c2 01          	add    $0x1,%rdx
+  800cb1:	84 c9                	test   %cl,%cl
+  800cb3:	75 f1                	jne    800ca6 <strcpy+0x8>
+        ;
+    return res;
+}
+  800cb5:	c3                   	ret
+
+0000000000800cb6 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800cb6:	55                   	push   %rbp
+  800cb7:	48 89 e5             	mov    %rsp,%rbp
+  800cba:	41 54                	push   %r12
+  800cbc:	53                   	push   %rbx
+  800cbd:	48 89 fb             	mov    %rdi,%rbx
+  800cc0:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800cc3:	48 b8 60 0c 80 00 00 	movabs $0x800c60,%rax
+  800cca:	00 00 00 
+  800ccd:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800ccf:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800cd3:	4c 89 e6             	mov    %r12,%rsi
+  800cd6:	48 b8 9e 0c 80 00 00 	movabs $0x800c9e,%rax
+  800cdd:	00 00 00 
+  800ce0:	ff d0                	call   *%rax
+    return dst;
+}
+  800ce2:	48 89 d8             	mov    %rbx,%rax
+  800ce5:	5b                   	pop    %rbx
+  800ce6:	41 5c                	pop    %r12
+  800ce8:	5d                   	pop    %rbp
+  800ce9:	c3                   	ret
+
+0000000000800cea <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800cea:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800ced:	48 85 d2             	test   %rdx,%rdx
+  800cf0:	74 1f                	je     800d11 <strncpy+0x27>
+  800cf2:	48 01 fa             	add    %rdi,%rdx
+  800cf5:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800cf8:	48 83 c1 01          	add    $0x1,%rcx
+  800cfc:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800d00:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800d04:	41 80 f8 01          	cmp    $0x1,%r8b
+  800d08:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800d0c:	48 39 ca             	cmp    %rcx,%rdx
+  800d0f:	75 e7                	jne    800cf8 <strncpy+0xe>
+    }
+    return ret;
+}
+  800d11:	c3                   	ret
+
+0000000000800d12 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800d12:	48 89 f8             	mov    %rdi,%rax
+  800d15:	48 85 d2             	test   %rdx,%rdx
+  800d18:	74 24                	je     800d3e <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800d1a:	48 83 ea 01          	sub    $0x1,%rdx
+  800d1e:	74 1b                	je     800d3b <strlcpy+0x29>
+  800d20:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800d24:	0f b6 16             	movzbl (%rsi),%edx
+  800d27:	84 d2                	test   %dl,%dl
+  800d29:	74 10                	je     800d3b <strlcpy+0x29>
+            *dst++ = *src++;
+  800d2b:	48 83 c6 01          	add    $0x1,%rsi
+  800d2f:	48 83 c0 01          	add    $0x1,%rax
+  800d33:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800d36:	48 39 c8             	cmp    %rcx,%rax
+  800d39:	75 e9                	jne    800d24 <strlcpy+0x12>
+        *dst = '\0';
+  800d3b:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800d3e:	48 29 f8             	sub    %rdi,%rax
+}
+  800d41:	c3                   	ret
+
+0000000000800d42 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800d42:	0f b6 07             	movzbl (%rdi),%eax
+  800d45:	84 c0                	test   %al,%al
+  800d47:	74 13                	je     800d5c <strcmp+0x1a>
+  800d49:	38 06                	cmp    %al,(%rsi)
+  800d4b:	75 0f                	jne    800d5c <strcmp+0x1a>
+  800d4d:	48 83 c7 01          	add    $0x1,%rdi
+  800d51:	48 83 c6 01          	add    $0x1,%rsi
+  800d55:	0f b6 07             	movzbl (%rdi),%eax
+  800d58:	84 c0                	test   %al,%al
+  800d5a:	75 ed                	jne    800d49 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d5c:	0f b6 c0             	movzbl %al,%eax
+  800d5f:	0f b6 16             	movzbl (%rsi),%edx
+  800d62:	29 d0                	sub    %edx,%eax
+}
+  800d64:	c3                   	ret
+
+0000000000800d65 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800d65:	48 85 d2             	test   %rdx,%rdx
+  800d68:	74 1f                	je     800d89 <strncmp+0x24>
+  800d6a:	0f b6 07             	movzbl (%rdi),%eax
+  800d6d:	84 c0                	test   %al,%al
+  800d6f:	74 1e                	je     800d8f <strncmp+0x2a>
+  800d71:	3a 06                	cmp    (%rsi),%al
+  800d73:	75 1a                	jne    800d8f <strncmp+0x2a>
+  800d75:	48 83 c7 01          	add    $0x1,%rdi
+  800d79:	48 83 c6 01          	add    $0x1,%rsi
+  800d7d:	48 83 ea 01          	sub    $0x1,%rdx
+  800d81:	75 e7                	jne    800d6a <strncmp+0x5>
+
+    if (!n) return 0;
+  800d83:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d88:	c3                   	ret
+  800d89:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d8e:	c3                   	ret
+  800d8f:	48 85 d2             	test   %rdx,%rdx
+  800d92:	74 09                	je     800d9d <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d94:	0f b6 07             	movzbl (%rdi),%eax
+  800d97:	0f b6 16             	movzbl (%rsi),%edx
+  800d9a:	29 d0                	sub    %edx,%eax
+  800d9c:	c3                   	ret
+    if (!n) return 0;
+  800d9d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800da2:	c3                   	ret
+
+0000000000800da3 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800da3:	0f b6 17             	movzbl (%rdi),%edx
+  800da6:	84 d2                	test   %dl,%dl
+  800da8:	74 18                	je     800dc2 <strchr+0x1f>
+        if (*str == c) {
+  800daa:	0f be d2             	movsbl %dl,%edx
+  800dad:	39 f2                	cmp    %esi,%edx
+  800daf:	74 17                	je     800dc8 <strchr+0x25>
+    for (; *str; str++) {
+  800db1:	48 83 c7 01          	add    $0x1,%rdi
+  800db5:	0f b6 17             	movzbl (%rdi),%edx
+  800db8:	84 d2                	test   %dl,%dl
+  800dba:	75 ee                	jne    800daa <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800dbc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dc1:	c3                   	ret
+  800dc2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dc7:	c3                   	ret
+  800dc8:	48 89 f8             	mov    %rdi,%rax
+}
+  800dcb:	c3                   	ret
+
+0000000000800dcc <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800dcc:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800dcf:	0f b6 17             	movzbl (%rdi),%edx
+  800dd2:	84 d2                	test   %dl,%dl
+  800dd4:	74 13                	je     800de9 <strfind+0x1d>
+  800dd6:	0f be d2             	movsbl %dl,%edx
+  800dd9:	39 f2                	cmp    %esi,%edx
+  800ddb:	74 0b                	je     800de8 <strfind+0x1c>
+  800ddd:	48 83 c0 01          	add    $0x1,%rax
+  800de1:	0f b6 10             	movzbl (%rax),%edx
+  800de4:	84 d2                	test   %dl,%dl
+  800de6:	75 ee                	jne    800dd6 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800de8:	c3                   	ret
+  800de9:	c3                   	ret
+
+0000000000800dea <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800dea:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800ded:	48 89 f8             	mov    %rdi,%rax
+  800df0:	48 f7 d8             	neg    %rax
+  800df3:	83 e0 07             	and    $0x7,%eax
+  800df6:	49 89 d1             	mov    %rdx,%r9
+  800df9:	49 29 c1             	sub    %rax,%r9
+  800dfc:	78 36                	js     800e34 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800dfe:	40 0f b6 c6          	movzbl %sil,%eax
+  800e02:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800e09:	01 01 01 
+  800e0c:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800e10:	40 f6 c7 07          	test   $0x7,%dil
+  800e14:	75 38                	jne    800e4e <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800e16:	4c 89 c9             	mov    %r9,%rcx
+  800e19:	48 c1 f9 03          	sar    $0x3,%rcx
+  800e1d:	74 0c                	je     800e2b <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800e1f:	fc                   	cld
+  800e20:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800e23:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800e27:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800e2b:	4d 85 c9             	test   %r9,%r9
+  800e2e:	75 45                	jne    800e75 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800e30:	4c 89 c0             	mov    %r8,%rax
+  800e33:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800e34:	48 85 d2             	test   %rdx,%rdx
+  800e37:	74 f7                	je     800e30 <memset+0x46>
+  800e39:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800e3c:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800e3f:	48 83 c0 01          	add    $0x1,%rax
+  800e43:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800e47:	48 39 c2             	cmp    %rax,%rdx
+  800e4a:	75 f3                	jne    800e3f <memset+0x55>
+  800e4c:	eb e2                	jmp    800e30 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800e4e:	40 f6 c7 01          	test   $0x1,%dil
+  800e52:	74 06                	je     800e5a <memset+0x70>
+  800e54:	88 07                	mov    %al,(%rdi)
+  800e56:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e5a:	40 f6 c7 02          	test   $0x2,%dil
+  800e5e:	74 07                	je     800e67 <memset+0x7d>
+  800e60:	66 89 07             	mov    %ax,(%rdi)
+  800e63:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e67:	40 f6 c7 04          	test   $0x4,%dil
+  800e6b:	74 a9                	je     800e16 <memset+0x2c>
+  800e6d:	89 07                	mov    %eax,(%rdi)
+  800e6f:	48 83 c7 04          	add    $0x4,%rdi
+  800e73:	eb a1                	jmp    800e16 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e75:	41 f6 c1 04          	test   $0x4,%r9b
+  800e79:	74 06                	je     800e81 <memset+0x97>
+  800e7b:	89 07                	mov    %eax,(%rdi)
+  800e7d:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e81:	41 f6 c1 02          	test   $0x2,%r9b
+  800e85:	74 07                	je     800e8e <memset+0xa4>
+  800e87:	66 89 07             	mov    %ax,(%rdi)
+  800e8a:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800e8e:	41 f6 c1 01          	test   $0x1,%r9b
+  800e92:	74 9c                	je     800e30 <memset+0x46>
+  800e94:	88 07                	mov    %al,(%rdi)
+  800e96:	eb 98                	jmp    800e30 <memset+0x46>
+
+0000000000800e98 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800e98:	48 89 f8             	mov    %rdi,%rax
+  800e9b:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800e9e:	48 39 fe             	cmp    %rdi,%rsi
+  800ea1:	73 3b                	jae    800ede <memmove+0x46>
+  800ea3:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800ea7:	48 39 d7             	cmp    %rdx,%rdi
+  800eaa:	73 32                	jae    800ede <memmove+0x46>
+        s += n;
+        d += n;
+  800eac:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800eb0:	48 89 d6             	mov    %rdx,%rsi
+  800eb3:	48 09 fe             	or     %rdi,%rsi
+  800eb6:	48 09 ce             	or     %rcx,%rsi
+  800eb9:	40 f6 c6 07          	test   $0x7,%sil
+  800ebd:	75 12                	jne    800ed1 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800ebf:	48 83 ef 08          	sub    $0x8,%rdi
+  800ec3:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800ec7:	48 c1 e9 03          	shr    $0x3,%rcx
+  800ecb:	fd                   	std
+  800ecc:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800ecf:	fc                   	cld
+  800ed0:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800ed1:	48 83 ef 01          	sub    $0x1,%rdi
+  800ed5:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800ed9:	fd                   	std
+  800eda:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800edc:	eb f1                	jmp    800ecf <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800ede:	48 89 f2             	mov    %rsi,%rdx
+  800ee1:	48 09 c2             	or     %rax,%rdx
+  800ee4:	48 09 ca             	or     %rcx,%rdx
+  800ee7:	f6 c2 07             	test   $0x7,%dl
+  800eea:	75 0c                	jne    800ef8 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800eec:	48 c1 e9 03          	shr    $0x3,%rcx
+  800ef0:	48 89 c7             	mov    %rax,%rdi
+  800ef3:	fc                   	cld
+  800ef4:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800ef7:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800ef8:	48 89 c7             	mov    %rax,%rdi
+  800efb:	fc                   	cld
+  800efc:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800efe:	c3                   	ret
+
+0000000000800eff <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800eff:	55                   	push   %rbp
+  800f00:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800f03:	48 b8 98 0e 80 00 00 	movabs $0x800e98,%rax
+  800f0a:	00 00 00 
+  800f0d:	ff d0                	call   *%rax
+}
+  800f0f:	5d                   	pop    %rbp
+  800f10:	c3                   	ret
+
+0000000000800f11 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800f11:	55                   	push   %rbp
+  800f12:	48 89 e5             	mov    %rsp,%rbp
+  800f15:	41 57                	push   %r15
+  800f17:	41 56                	push   %r14
+  800f19:	41 55                	push   %r13
+  800f1b:	41 54                	push   %r12
+  800f1d:	53                   	push   %rbx
+  800f1e:	48 83 ec 08          	sub    $0x8,%rsp
+  800f22:	49 89 fe             	mov    %rdi,%r14
+  800f25:	49 89 f7             	mov    %rsi,%r15
+  800f28:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800f2b:	48 89 f7             	mov    %rsi,%rdi
+  800f2e:	48 b8 60 0c 80 00 00 	movabs $0x800c60,%rax
+  800f35:	00 00 00 
+  800f38:	ff d0                	call   *%rax
+  800f3a:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800f3d:	48 89 de             	mov    %rbx,%rsi
+  800f40:	4c 89 f7             	mov    %r14,%rdi
+  800f43:	48 b8 7b 0c 80 00 00 	movabs $0x800c7b,%rax
+  800f4a:	00 00 00 
+  800f4d:	ff d0                	call   *%rax
+  800f4f:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f52:	48 39 c3             	cmp    %rax,%rbx
+  800f55:	74 36                	je     800f8d <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800f57:	48 89 d8             	mov    %rbx,%rax
+  800f5a:	4c 29 e8             	sub    %r13,%rax
+  800f5d:	49 39 c4             	cmp    %rax,%r12
+  800f60:	73 31                	jae    800f93 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800f62:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800f67:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f6b:	4c 89 fe             	mov    %r15,%rsi
+  800f6e:	48 b8 ff 0e 80 00 00 	movabs $0x800eff,%rax
+  800f75:	00 00 00 
+  800f78:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800f7a:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800f7e:	48 83 c4 08          	add    $0x8,%rsp
+  800f82:	5b                   	pop    %rbx
+  800f83:	41 5c                	pop    %r12
+  800f85:	41 5d                	pop    %r13
+  800f87:	41 5e                	pop    %r14
+  800f89:	41 5f                	pop    %r15
+  800f8b:	5d                   	pop    %rbp
+  800f8c:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f8d:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800f91:	eb eb                	jmp    800f7e <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800f93:	48 83 eb 01          	sub    $0x1,%rbx
+  800f97:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f9b:	48 89 da             	mov    %rbx,%rdx
+  800f9e:	4c 89 fe             	mov    %r15,%rsi
+  800fa1:	48 b8 ff 0e 80 00 00 	movabs $0x800eff,%rax
+  800fa8:	00 00 00 
+  800fab:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800fad:	49 01 de             	add    %rbx,%r14
+  800fb0:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800fb5:	eb c3                	jmp    800f7a <strlcat+0x69>
+
+0000000000800fb7 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800fb7:	48 85 d2             	test   %rdx,%rdx
+  800fba:	74 2d                	je     800fe9 <memcmp+0x32>
+  800fbc:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800fc1:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800fc5:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800fca:	44 38 c1             	cmp    %r8b,%cl
+  800fcd:	75 0f                	jne    800fde <memcmp+0x27>
+    while (n-- > 0) {
+  800fcf:	48 83 c0 01          	add    $0x1,%rax
+  800fd3:	48 39 c2             	cmp    %rax,%rdx
+  800fd6:	75 e9                	jne    800fc1 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800fd8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fdd:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800fde:	0f b6 c1             	movzbl %cl,%eax
+  800fe1:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800fe5:	44 29 c0             	sub    %r8d,%eax
+  800fe8:	c3                   	ret
+    return 0;
+  800fe9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fee:	c3                   	ret
+
+0000000000800fef <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800fef:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800ff3:	48 39 c7             	cmp    %rax,%rdi
+  800ff6:	73 0f                	jae    801007 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800ff8:	40 38 37             	cmp    %sil,(%rdi)
+  800ffb:	74 0e                	je     80100b <memfind+0x1c>
+    for (; src < end; src++) {
+  800ffd:	48 83 c7 01          	add    $0x1,%rdi
+  801001:	48 39 f8             	cmp    %rdi,%rax
+  801004:	75 f2                	jne    800ff8 <memfind+0x9>
+  801006:	c3                   	ret
+  801007:	48 89 f8             	mov    %rdi,%rax
+  80100a:	c3                   	ret
+  80100b:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80100e:	c3                   	ret
+
+000000000080100f <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80100f:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801012:	0f b6 37             	movzbl (%rdi),%esi
+  801015:	40 80 fe 20          	cmp    $0x20,%sil
+  801019:	74 06                	je     801021 <strtol+0x12>
+  80101b:	40 80 fe 09          	cmp    $0x9,%sil
+  80101f:	75 13                	jne    801034 <strtol+0x25>
+  801021:	48 83 c7 01          	add    $0x1,%rdi
+  801025:	0f b6 37             	movzbl (%rdi),%esi
+  801028:	40 80 fe 20          	cmp    $0x20,%sil
+  80102c:	74 f3                	je     801021 <strtol+0x12>
+  80102e:	40 80 fe 09          	cmp    $0x9,%sil
+  801032:	74 ed                	je     801021 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801034:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801037:	83 e0 fd             	and    $0xfffffffd,%eax
+  80103a:	3c 01                	cmp    $0x1,%al
+  80103c:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801040:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801046:	75 0f                	jne    801057 <strtol+0x48>
+  801048:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80104b:	74 14                	je     801061 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80104d:	85 d2                	test   %edx,%edx
+  80104f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801054:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801057:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80105c:	4c 63 ca             	movslq %edx,%r9
+  80105f:	eb 36                	jmp    801097 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801061:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801065:	74 0f                	je     801076 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801067:	85 d2                	test   %edx,%edx
+  801069:	75 ec                	jne    801057 <strtol+0x48>
+        s++;
+  80106b:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80106f:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801074:	eb e1                	jmp    801057 <strtol+0x48>
+        s += 2;
+  801076:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80107a:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80107f:	eb d6                	jmp    801057 <strtol+0x48>
+            dig -= '0';
+  801081:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801084:	44 0f b6 c1          	movzbl %cl,%r8d
+  801088:	41 39 d0             	cmp    %edx,%r8d
+  80108b:	7d 21                	jge    8010ae <strtol+0x9f>
+        val = val * base + dig;
+  80108d:	49 0f af c1          	imul   %r9,%rax
+  801091:	0f b6 c9             	movzbl %cl,%ecx
+  801094:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801097:	48 83 c7 01          	add    $0x1,%rdi
+  80109b:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80109f:	80 f9 39             	cmp    $0x39,%cl
+  8010a2:	76 dd                	jbe    801081 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8010a4:	80 f9 7b             	cmp    $0x7b,%cl
+  8010a7:	77 05                	ja     8010ae <strtol+0x9f>
+            dig -= 'a' - 10;
+  8010a9:	83 e9 57             	sub    $0x57,%ecx
+  8010ac:	eb d6                	jmp    801084 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8010ae:	4d 85 d2             	test   %r10,%r10
+  8010b1:	74 03                	je     8010b6 <strtol+0xa7>
+  8010b3:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8010b6:	48 89 c2             	mov    %rax,%rdx
+  8010b9:	48 f7 da             	neg    %rdx
+  8010bc:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8010c0:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8010c4:	c3                   	ret
+
+00000000008010c5 <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  8010c5:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8010ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010cf:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8010d5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8010db:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  8010e1:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8010e3:	c3                   	ret
+
+00000000008010e4 <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  8010e4:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8010e9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010ee:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8010f3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010f8:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8010fe:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801104:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80110a:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80110c:	c3                   	ret
+
+000000000080110d <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80110d:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801110:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801115:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80111a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80111f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801125:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80112b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801131:	0f 05                	syscall
+    if (check && ret > 0) {
+  801133:	48 85 c0             	test   %rax,%rax
+  801136:	7f 01                	jg     801139 <sys_env_destroy+0x2c>
+}
+  801138:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  801139:	55                   	push   %rbp
+  80113a:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80113d:	49 89 c0             	mov    %rax,%r8
+  801140:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801145:	48 ba f8 59 80 00 00 	movabs $0x8059f8,%rdx
+  80114c:	00 00 00 
+  80114f:	be 29 00 00 00       	mov    $0x29,%esi
+  801154:	48 bf 17 5a 80 00 00 	movabs $0x805a17,%rdi
+  80115b:	00 00 00 
+  80115e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801163:	49 b9 29 02 80 00 00 	movabs $0x800229,%r9
+  80116a:	00 00 00 
+  80116d:	41 ff d1             	call   *%r9
+
+0000000000801170 <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  801170:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801175:	bf 00 00 00 00       	mov    $0x0,%edi
+  80117a:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80117f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801184:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80118a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801190:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801196:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801198:	c3                   	ret
+
+0000000000801199 <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  801199:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80119e:	bf 00 00 00 00       	mov    $0x0,%edi
+  8011a3:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8011a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011ad:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8011b3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011b9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8011bf:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8011c1:	c3                   	ret
+
+00000000008011c2 <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  8011c2:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8011c7:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  8011ce:	00 00 00 
+  8011d1:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8011d7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011dd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8011e3:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8011e5:	c3                   	ret
+
+00000000008011e6 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8011e6:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  8011e9:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8011ee:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011f4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8011fa:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8011fc:	c3                   	ret
+
+00000000008011fd <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8011fd:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801200:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801205:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801208:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80120e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801214:	0f 05                	syscall
+    if (check && ret > 0) {
+  801216:	48 85 c0             	test   %rax,%rax
+  801219:	7f 01                	jg     80121c <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80121b:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80121c:	55                   	push   %rbp
+  80121d:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801220:	49 89 c0             	mov    %rax,%r8
+  801223:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801228:	48 ba f8 59 80 00 00 	movabs $0x8059f8,%rdx
+  80122f:	00 00 00 
+  801232:	be 29 00 00 00       	mov    $0x29,%esi
+  801237:	48 bf 17 5a 80 00 00 	movabs $0x805a17,%rdi
+  80123e:	00 00 00 
+  801241:	b8 00 00 00 00       	mov    $0x0,%eax
+  801246:	49 b9 29 02 80 00 00 	movabs $0x800229,%r9
+  80124d:	00 00 00 
+  801250:	41 ff d1             	call   *%r9
+
+0000000000801253 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801253:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801256:	48 63 d2             	movslq %edx,%rdx
+  801259:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80125c:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801261:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  801264:	0f 05                	syscall
+    if (check && ret > 0) {
+  801266:	48 85 c0             	test   %rax,%rax
+  801269:	7f 01                	jg     80126c <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80126b:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80126c:	55                   	push   %rbp
+  80126d:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801270:	49 89 c0             	mov    %rax,%r8
+  801273:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801278:	48 ba f8 59 80 00 00 	movabs $0x8059f8,%rdx
+  80127f:	00 00 00 
+  801282:	be 29 00 00 00       	mov    $0x29,%esi
+  801287:	48 bf 17 5a 80 00 00 	movabs $0x805a17,%rdi
+  80128e:	00 00 00 
+  801291:	b8 00 00 00 00       	mov    $0x0,%eax
+  801296:	49 b9 29 02 80 00 00 	movabs $0x800229,%r9
+  80129d:	00 00 00 
+  8012a0:	41 ff d1             	call   *%r9
+
+00000000008012a3 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8012a3:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8012a6:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8012ab:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8012b1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8012b7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8012bd:	0f 05                	syscall
+    if (check && ret > 0) {
+  8012bf:	48 85 c0             	test   %rax,%rax
+  8012c2:	7f 01                	jg     8012c5 <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8012c4:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8012c5:	55                   	push   %rbp
+  8012c6:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012c9:	49 89 c0             	mov    %rax,%r8
+  8012cc:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8012d1:	48 ba f8 59 80 00 00 	movabs $0x8059f8,%rdx
+  8012d8:	00 00 00 
+  8012db:	be 29 00 00 00       	mov    $0x29,%esi
+  8012e0:	48 bf 17 5a 80 00 00 	movabs $0x805a17,%rdi
+  8012e7:	00 00 00 
+  8012ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012ef:	49 b9 29 02 80 00 00 	movabs $0x800229,%r9
+  8012f6:	00 00 00 
+  8012f9:	41 ff d1             	call   *%r9
+
+00000000008012fc <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8012fc:	48 63 f6             	movslq %esi,%rsi
+  8012ff:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801302:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801307:	ba 00 00 00 00       	mov    $0x0,%edx
+  80130c:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801312:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801318:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80131e:	0f 05                	syscall
+    if (check && ret > 0) {
+  801320:	48 85 c0             	test   %rax,%rax
+  801323:	7f 01                	jg     801326 <sys_env_set_status+0x2a>
+}
+  801325:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  801326:	55                   	push   %rbp
+  801327:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80132a:	49 89 c0             	mov    %rax,%r8
+  80132d:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801332:	48 ba f8 59 80 00 00 	movabs $0x8059f8,%rdx
+  801339:	00 00 00 
+  80133c:	be 29 00 00 00       	mov    $0x29,%esi
+  801341:	48 bf 17 5a 80 00 00 	movabs $0x805a17,%rdi
+  801348:	00 00 00 
+  80134b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801350:	49 b9 29 02 80 00 00 	movabs $0x800229,%r9
+  801357:	00 00 00 
+  80135a:	41 ff d1             	call   *%r9
+
+000000000080135d <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80135d:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801360:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801365:	ba 00 00 00 00       	mov    $0x0,%edx
+  80136a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801370:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801376:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80137c:	0f 05                	syscall
+    if (check && ret > 0) {
+  80137e:	48 85 c0             	test   %rax,%rax
+  801381:	7f 01                	jg     801384 <sys_env_set_trapframe+0x27>
+}
+  801383:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801384:	55                   	push   %rbp
+  801385:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801388:	49 89 c0             	mov    %rax,%r8
+  80138b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801390:	48 ba f8 59 80 00 00 	movabs $0x8059f8,%rdx
+  801397:	00 00 00 
+  80139a:	be 29 00 00 00       	mov    $0x29,%esi
+  80139f:	48 bf 17 5a 80 00 00 	movabs $0x805a17,%rdi
+  8013a6:	00 00 00 
+  8013a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013ae:	49 b9 29 02 80 00 00 	movabs $0x800229,%r9
+  8013b5:	00 00 00 
+  8013b8:	41 ff d1             	call   *%r9
+
+00000000008013bb <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8013bb:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8013be:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8013c3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013c8:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013ce:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013d4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013da:	0f 05                	syscall
+    if (check && ret > 0) {
+  8013dc:	48 85 c0             	test   %rax,%rax
+  8013df:	7f 01                	jg     8013e2 <sys_env_set_pgfault_upcall+0x27>
+}
+  8013e1:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8013e2:	55                   	push   %rbp
+  8013e3:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013e6:	49 89 c0             	mov    %rax,%r8
+  8013e9:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8013ee:	48 ba f8 59 80 00 00 	movabs $0x8059f8,%rdx
+  8013f5:	00 00 00 
+  8013f8:	be 29 00 00 00       	mov    $0x29,%esi
+  8013fd:	48 bf 17 5a 80 00 00 	movabs $0x805a17,%rdi
+  801404:	00 00 00 
+  801407:	b8 00 00 00 00       	mov    $0x0,%eax
+  80140c:	49 b9 29 02 80 00 00 	movabs $0x800229,%r9
+  801413:	00 00 00 
+  801416:	41 ff d1             	call   *%r9
+
+0000000000801419 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801419:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80141c:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80141f:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801424:	4d 63 c0             	movslq %r8d,%r8
+  801427:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80142d:	0f 05                	syscall
+}
+  80142f:	c3                   	ret
+
+0000000000801430 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801430:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801433:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801436:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80143b:	4d 63 c0             	movslq %r8d,%r8
+  80143e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801444:	0f 05                	syscall
+}
+  801446:	c3                   	ret
+
+0000000000801447 <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  801447:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80144c:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80144f:	45 89 c0             	mov    %r8d,%r8d
+  801452:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801458:	0f 05                	syscall
+    if (check && ret > 0) {
+  80145a:	48 85 c0             	test   %rax,%rax
+  80145d:	7f 01                	jg     801460 <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80145f:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  801460:	55                   	push   %rbp
+  801461:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801464:	49 89 c0             	mov    %rax,%r8
+  801467:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  80146c:	48 ba f8 59 80 00 00 	movabs $0x8059f8,%rdx
+  801473:	00 00 00 
+  801476:	be 29 00 00 00       	mov    $0x29,%esi
+  80147b:	48 bf 17 5a 80 00 00 	movabs $0x805a17,%rdi
+  801482:	00 00 00 
+  801485:	b8 00 00 00 00       	mov    $0x0,%eax
+  80148a:	49 b9 29 02 80 00 00 	movabs $0x800229,%r9
+  801491:	00 00 00 
+  801494:	41 ff d1             	call   *%r9
+
+0000000000801497 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  801497:	55                   	push   %rbp
+  801498:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  80149b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014a1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014ab:	48 b8 47 14 80 00 00 	movabs $0x801447,%rax
+  8014b2:	00 00 00 
+  8014b5:	ff d0                	call   *%rax
+}
+  8014b7:	5d                   	pop    %rbp
+  8014b8:	c3                   	ret
+
+00000000008014b9 <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  8014b9:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8014be:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014c3:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8014c8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014cd:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014d3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014d9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8014df:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8014e1:	c3                   	ret
+
+00000000008014e2 <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  8014e2:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8014e7:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8014ec:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014f1:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014f7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014fd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801503:	0f 05                	syscall
+    if (check && ret > 0) {
+  801505:	48 85 c0             	test   %rax,%rax
+  801508:	7f 01                	jg     80150b <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  80150a:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  80150b:	55                   	push   %rbp
+  80150c:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80150f:	49 89 c0             	mov    %rax,%r8
+  801512:	b9 10 00 00 00       	mov    $0x10,%ecx
+  801517:	48 ba f8 59 80 00 00 	movabs $0x8059f8,%rdx
+  80151e:	00 00 00 
+  801521:	be 29 00 00 00       	mov    $0x29,%esi
+  801526:	48 bf 17 5a 80 00 00 	movabs $0x805a17,%rdi
+  80152d:	00 00 00 
+  801530:	b8 00 00 00 00       	mov    $0x0,%eax
+  801535:	49 b9 29 02 80 00 00 	movabs $0x800229,%r9
+  80153c:	00 00 00 
+  80153f:	41 ff d1             	call   *%r9
+
+0000000000801542 <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  801542:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801547:	bf 00 00 00 00       	mov    $0x0,%edi
+  80154c:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801551:	ba 00 00 00 00       	mov    $0x0,%edx
+  801556:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80155c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801562:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801568:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  80156a:	c3                   	ret
+
+000000000080156b <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  80156b:	89 d2                	mov    %edx,%edx
+  80156d:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  80156f:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801574:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80157a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801580:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801586:	0f 05                	syscall
+}
+  801588:	c3                   	ret
+
+0000000000801589 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  801589:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  80158c:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801591:	ba 00 00 00 00       	mov    $0x0,%edx
+  801596:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80159c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8015a2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8015a8:	0f 05                	syscall
+}
+  8015aa:	c3                   	ret
+
+00000000008015ab <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  8015ab:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  8015ae:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8015b3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015b8:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8015be:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8015c4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8015ca:	0f 05                	syscall
+}
+  8015cc:	c3                   	ret
+
+00000000008015cd <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  8015cd:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8015d0:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8015d5:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8015da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015df:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8015e5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8015eb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8015f1:	0f 05                	syscall
+    if (check && ret > 0) {
+  8015f3:	48 85 c0             	test   %rax,%rax
+  8015f6:	7f 01                	jg     8015f9 <sys_irq_ack+0x2c>
+}
+  8015f8:	c3                   	ret
+sys_irq_ack(int irq) {
+  8015f9:	55                   	push   %rbp
+  8015fa:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015fd:	49 89 c0             	mov    %rax,%r8
+  801600:	b9 16 00 00 00       	mov    $0x16,%ecx
+  801605:	48 ba f8 59 80 00 00 	movabs $0x8059f8,%rdx
+  80160c:	00 00 00 
+  80160f:	be 29 00 00 00       	mov    $0x29,%esi
+  801614:	48 bf 17 5a 80 00 00 	movabs $0x805a17,%rdi
+  80161b:	00 00 00 
+  80161e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801623:	49 b9 29 02 80 00 00 	movabs $0x800229,%r9
+  80162a:	00 00 00 
+  80162d:	41 ff d1             	call   *%r9
+
+0000000000801630 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801630:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801637:	ff ff ff 
+  80163a:	48 01 f8             	add    %rdi,%rax
+  80163d:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801641:	c3                   	ret
+
+0000000000801642 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801642:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801649:	ff ff ff 
+  80164c:	48 01 f8             	add    %rdi,%rax
+  80164f:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801653:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801659:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80165d:	c3                   	ret
+
+000000000080165e <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  80165e:	55                   	push   %rbp
+  80165f:	48 89 e5             	mov    %rsp,%rbp
+  801662:	41 57                	push   %r15
+  801664:	41 56                	push   %r14
+  801666:	41 55                	push   %r13
+  801668:	41 54                	push   %r12
+  80166a:	53                   	push   %rbx
+  80166b:	48 83 ec 08          	sub    $0x8,%rsp
+  80166f:	49 89 ff             	mov    %rdi,%r15
+  801672:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801677:	49 bd a6 47 80 00 00 	movabs $0x8047a6,%r13
+  80167e:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801681:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801687:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  80168a:	48 89 df             	mov    %rbx,%rdi
+  80168d:	41 ff d5             	call   *%r13
+  801690:	83 e0 04             	and    $0x4,%eax
+  801693:	74 17                	je     8016ac <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801695:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80169c:	4c 39 f3             	cmp    %r14,%rbx
+  80169f:	75 e6                	jne    801687 <fd_alloc+0x29>
+  8016a1:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8016a7:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8016ac:	4d 89 27             	mov    %r12,(%r15)
+}
+  8016af:	48 83 c4 08          	add    $0x8,%rsp
+  8016b3:	5b                   	pop    %rbx
+  8016b4:	41 5c                	pop    %r12
+  8016b6:	41 5d                	pop    %r13
+  8016b8:	41 5e                	pop    %r14
+  8016ba:	41 5f                	pop    %r15
+  8016bc:	5d                   	pop    %rbp
+  8016bd:	c3                   	ret
+
+00000000008016be <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8016be:	83 ff 1f             	cmp    $0x1f,%edi
+  8016c1:	77 39                	ja     8016fc <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8016c3:	55                   	push   %rbp
+  8016c4:	48 89 e5             	mov    %rsp,%rbp
+  8016c7:	41 54                	push   %r12
+  8016c9:	53                   	push   %rbx
+  8016ca:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8016cd:	48 63 df             	movslq %edi,%rbx
+  8016d0:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8016d7:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8016db:	48 89 df             	mov    %rbx,%rdi
+  8016de:	48 b8 a6 47 80 00 00 	movabs $0x8047a6,%rax
+  8016e5:	00 00 00 
+  8016e8:	ff d0                	call   *%rax
+  8016ea:	a8 04                	test   $0x4,%al
+  8016ec:	74 14                	je     801702 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8016ee:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8016f2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8016f7:	5b                   	pop    %rbx
+  8016f8:	41 5c                	pop    %r12
+  8016fa:	5d                   	pop    %rbp
+  8016fb:	c3                   	ret
+        return -E_INVAL;
+  8016fc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801701:	c3                   	ret
+        return -E_INVAL;
+  801702:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801707:	eb ee                	jmp    8016f7 <fd_lookup+0x39>
+
+0000000000801709 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801709:	55                   	push   %rbp
+  80170a:	48 89 e5             	mov    %rsp,%rbp
+  80170d:	41 54                	push   %r12
+  80170f:	53                   	push   %rbx
+  801710:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801713:	48 b8 c0 5a 80 00 00 	movabs $0x805ac0,%rax
+  80171a:	00 00 00 
+  80171d:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  801724:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801727:	39 3b                	cmp    %edi,(%rbx)
+  801729:	74 47                	je     801772 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  80172b:	48 83 c0 08          	add    $0x8,%rax
+  80172f:	48 8b 18             	mov    (%rax),%rbx
+  801732:	48 85 db             	test   %rbx,%rbx
+  801735:	75 f0                	jne    801727 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801737:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80173e:	00 00 00 
+  801741:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801747:	89 fa                	mov    %edi,%edx
+  801749:	48 bf 28 5a 80 00 00 	movabs $0x805a28,%rdi
+  801750:	00 00 00 
+  801753:	b8 00 00 00 00       	mov    $0x0,%eax
+  801758:	48 b9 79 03 80 00 00 	movabs $0x800379,%rcx
+  80175f:	00 00 00 
+  801762:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801764:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801769:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  80176d:	5b                   	pop    %rbx
+  80176e:	41 5c                	pop    %r12
+  801770:	5d                   	pop    %rbp
+  801771:	c3                   	ret
+            return 0;
+  801772:	b8 00 00 00 00       	mov    $0x0,%eax
+  801777:	eb f0                	jmp    801769 <dev_lookup+0x60>
+
+0000000000801779 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801779:	55                   	push   %rbp
+  80177a:	48 89 e5             	mov    %rsp,%rbp
+  80177d:	41 55                	push   %r13
+  80177f:	41 54                	push   %r12
+  801781:	53                   	push   %rbx
+  801782:	48 83 ec 18          	sub    $0x18,%rsp
+  801786:	48 89 fb             	mov    %rdi,%rbx
+  801789:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80178c:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801793:	ff ff ff 
+  801796:	48 01 df             	add    %rbx,%rdi
+  801799:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  80179d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8017a1:	48 b8 be 16 80 00 00 	movabs $0x8016be,%rax
+  8017a8:	00 00 00 
+  8017ab:	ff d0                	call   *%rax
+  8017ad:	41 89 c5             	mov    %eax,%r13d
+  8017b0:	85 c0                	test   %eax,%eax
+  8017b2:	78 06                	js     8017ba <fd_close+0x41>
+  8017b4:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8017b8:	74 1a                	je     8017d4 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8017ba:	45 84 e4             	test   %r12b,%r12b
+  8017bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017c2:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8017c6:	44 89 e8             	mov    %r13d,%eax
+  8017c9:	48 83 c4 18          	add    $0x18,%rsp
+  8017cd:	5b                   	pop    %rbx
+  8017ce:	41 5c                	pop    %r12
+  8017d0:	41 5d                	pop    %r13
+  8017d2:	5d                   	pop    %rbp
+  8017d3:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8017d4:	8b 3b                	mov    (%rbx),%edi
+  8017d6:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8017da:	48 b8 09 17 80 00 00 	movabs $0x801709,%rax
+  8017e1:	00 00 00 
+  8017e4:	ff d0                	call   *%rax
+  8017e6:	41 89 c5             	mov    %eax,%r13d
+  8017e9:	85 c0                	test   %eax,%eax
+  8017eb:	78 1b                	js     801808 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8017ed:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8017f1:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8017f5:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8017fb:	48 85 c0             	test   %rax,%rax
+  8017fe:	74 08                	je     801808 <fd_close+0x8f>
+  801800:	48 89 df             	mov    %rbx,%rdi
+  801803:	ff d0                	call   *%rax
+  801805:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801808:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80180d:	48 89 de             	mov    %rbx,%rsi
+  801810:	bf 00 00 00 00       	mov    $0x0,%edi
+  801815:	48 b8 a3 12 80 00 00 	movabs $0x8012a3,%rax
+  80181c:	00 00 00 
+  80181f:	ff d0                	call   *%rax
+    return res;
+  801821:	eb a3                	jmp    8017c6 <fd_close+0x4d>
+
+0000000000801823 <close>:
+
+int
+close(int fdnum) {
+  801823:	55                   	push   %rbp
+  801824:	48 89 e5             	mov    %rsp,%rbp
+  801827:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80182b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80182f:	48 b8 be 16 80 00 00 	movabs $0x8016be,%rax
+  801836:	00 00 00 
+  801839:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80183b:	85 c0                	test   %eax,%eax
+  80183d:	78 15                	js     801854 <close+0x31>
+
+    return fd_close(fd, 1);
+  80183f:	be 01 00 00 00       	mov    $0x1,%esi
+  801844:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801848:	48 b8 79 17 80 00 00 	movabs $0x801779,%rax
+  80184f:	00 00 00 
+  801852:	ff d0                	call   *%rax
+}
+  801854:	c9                   	leave
+  801855:	c3                   	ret
+
+0000000000801856 <close_all>:
+
+void
+close_all(void) {
+  801856:	55                   	push   %rbp
+  801857:	48 89 e5             	mov    %rsp,%rbp
+  80185a:	41 54                	push   %r12
+  80185c:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  80185d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801862:	49 bc 23 18 80 00 00 	movabs $0x801823,%r12
+  801869:	00 00 00 
+  80186c:	89 df                	mov    %ebx,%edi
+  80186e:	41 ff d4             	call   *%r12
+  801871:	83 c3 01             	add    $0x1,%ebx
+  801874:	83 fb 20             	cmp    $0x20,%ebx
+  801877:	75 f3                	jne    80186c <close_all+0x16>
+}
+  801879:	5b                   	pop    %rbx
+  80187a:	41 5c                	pop    %r12
+  80187c:	5d                   	pop    %rbp
+  80187d:	c3                   	ret
+
+000000000080187e <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  80187e:	55                   	push   %rbp
+  80187f:	48 89 e5             	mov    %rsp,%rbp
+  801882:	41 57                	push   %r15
+  801884:	41 56                	push   %r14
+  801886:	41 55                	push   %r13
+  801888:	41 54                	push   %r12
+  80188a:	53                   	push   %rbx
+  80188b:	48 83 ec 18          	sub    $0x18,%rsp
+  80188f:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801892:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801896:	48 b8 be 16 80 00 00 	movabs $0x8016be,%rax
+  80189d:	00 00 00 
+  8018a0:	ff d0                	call   *%rax
+  8018a2:	89 c3                	mov    %eax,%ebx
+  8018a4:	85 c0                	test   %eax,%eax
+  8018a6:	0f 88 b8 00 00 00    	js     801964 <dup+0xe6>
+    close(newfdnum);
+  8018ac:	44 89 e7             	mov    %r12d,%edi
+  8018af:	48 b8 23 18 80 00 00 	movabs $0x801823,%rax
+  8018b6:	00 00 00 
+  8018b9:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8018bb:	4d 63 ec             	movslq %r12d,%r13
+  8018be:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8018c5:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8018c9:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8018cd:	4c 89 ff             	mov    %r15,%rdi
+  8018d0:	49 be 42 16 80 00 00 	movabs $0x801642,%r14
+  8018d7:	00 00 00 
+  8018da:	41 ff d6             	call   *%r14
+  8018dd:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8018e0:	4c 89 ef             	mov    %r13,%rdi
+  8018e3:	41 ff d6             	call   *%r14
+  8018e6:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8018e9:	48 89 df             	mov    %rbx,%rdi
+  8018ec:	48 b8 a6 47 80 00 00 	movabs $0x8047a6,%rax
+  8018f3:	00 00 00 
+  8018f6:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8018f8:	a8 04                	test   $0x4,%al
+  8018fa:	74 2b                	je     801927 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8018fc:	41 89 c1             	mov    %eax,%r9d
+  8018ff:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801905:	4c 89 f1             	mov    %r14,%rcx
+  801908:	ba 00 00 00 00       	mov    $0x0,%edx
+  80190d:	48 89 de             	mov    %rbx,%rsi
+  801910:	bf 00 00 00 00       	mov    $0x0,%edi
+  801915:	48 b8 53 12 80 00 00 	movabs $0x801253,%rax
+  80191c:	00 00 00 
+  80191f:	ff d0                	call   *%rax
+  801921:	89 c3                	mov    %eax,%ebx
+  801923:	85 c0                	test   %eax,%eax
+  801925:	78 4e                	js     801975 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801927:	4c 89 ff             	mov    %r15,%rdi
+  80192a:	48 b8 a6 47 80 00 00 	movabs $0x8047a6,%rax
+  801931:	00 00 00 
+  801934:	ff d0                	call   *%rax
+  801936:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801939:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80193f:	4c 89 e9             	mov    %r13,%rcx
+  801942:	ba 00 00 00 00       	mov    $0x0,%edx
+  801947:	4c 89 fe             	mov    %r15,%rsi
+  80194a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80194f:	48 b8 53 12 80 00 00 	movabs $0x801253,%rax
+  801956:	00 00 00 
+  801959:	ff d0                	call   *%rax
+  80195b:	89 c3                	mov    %eax,%ebx
+  80195d:	85 c0                	test   %eax,%eax
+  80195f:	78 14                	js     801975 <dup+0xf7>
+
+    return newfdnum;
+  801961:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801964:	89 d8                	mov    %ebx,%eax
+  801966:	48 83 c4 18          	add    $0x18,%rsp
+  80196a:	5b                   	pop    %rbx
+  80196b:	41 5c                	pop    %r12
+  80196d:	41 5d                	pop    %r13
+  80196f:	41 5e                	pop    %r14
+  801971:	41 5f                	pop    %r15
+  801973:	5d                   	pop    %rbp
+  801974:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801975:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80197a:	4c 89 ee             	mov    %r13,%rsi
+  80197d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801982:	49 bc a3 12 80 00 00 	movabs $0x8012a3,%r12
+  801989:	00 00 00 
+  80198c:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  80198f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801994:	4c 89 f6             	mov    %r14,%rsi
+  801997:	bf 00 00 00 00       	mov    $0x0,%edi
+  80199c:	41 ff d4             	call   *%r12
+    return res;
+  80199f:	eb c3                	jmp    801964 <dup+0xe6>
+
+00000000008019a1 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8019a1:	55                   	push   %rbp
+  8019a2:	48 89 e5             	mov    %rsp,%rbp
+  8019a5:	41 56                	push   %r14
+  8019a7:	41 55                	push   %r13
+  8019a9:	41 54                	push   %r12
+  8019ab:	53                   	push   %rbx
+  8019ac:	48 83 ec 10          	sub    $0x10,%rsp
+  8019b0:	89 fb                	mov    %edi,%ebx
+  8019b2:	49 89 f4             	mov    %rsi,%r12
+  8019b5:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8019b8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8019bc:	48 b8 be 16 80 00 00 	movabs $0x8016be,%rax
+  8019c3:	00 00 00 
+  8019c6:	ff d0                	call   *%rax
+  8019c8:	85 c0                	test   %eax,%eax
+  8019ca:	78 4c                	js     801a18 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8019cc:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8019d0:	41 8b 3e             	mov    (%r14),%edi
+  8019d3:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8019d7:	48 b8 09 17 80 00 00 	movabs $0x801709,%rax
+  8019de:	00 00 00 
+  8019e1:	ff d0                	call   *%rax
+  8019e3:	85 c0                	test   %eax,%eax
+  8019e5:	78 35                	js     801a1c <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8019e7:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8019eb:	83 e0 03             	and    $0x3,%eax
+  8019ee:	83 f8 01             	cmp    $0x1,%eax
+  8019f1:	74 2d                	je     801a20 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8019f3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8019f7:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8019fb:	48 85 c0             	test   %rax,%rax
+  8019fe:	74 56                	je     801a56 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801a00:	4c 89 ea             	mov    %r13,%rdx
+  801a03:	4c 89 e6             	mov    %r12,%rsi
+  801a06:	4c 89 f7             	mov    %r14,%rdi
+  801a09:	ff d0                	call   *%rax
+}
+  801a0b:	48 83 c4 10          	add    $0x10,%rsp
+  801a0f:	5b                   	pop    %rbx
+  801a10:	41 5c                	pop    %r12
+  801a12:	41 5d                	pop    %r13
+  801a14:	41 5e                	pop    %r14
+  801a16:	5d                   	pop    %rbp
+  801a17:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a18:	48 98                	cltq
+  801a1a:	eb ef                	jmp    801a0b <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801a1c:	48 98                	cltq
+  801a1e:	eb eb                	jmp    801a0b <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801a20:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801a27:	00 00 00 
+  801a2a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801a30:	89 da                	mov    %ebx,%edx
+  801a32:	48 bf 69 5a 80 00 00 	movabs $0x805a69,%rdi
+  801a39:	00 00 00 
+  801a3c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a41:	48 b9 79 03 80 00 00 	movabs $0x800379,%rcx
+  801a48:	00 00 00 
+  801a4b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801a4d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801a54:	eb b5                	jmp    801a0b <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801a56:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801a5d:	eb ac                	jmp    801a0b <read+0x6a>
+
+0000000000801a5f <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801a5f:	55                   	push   %rbp
+  801a60:	48 89 e5             	mov    %rsp,%rbp
+  801a63:	41 57                	push   %r15
+  801a65:	41 56                	push   %r14
+  801a67:	41 55                	push   %r13
+  801a69:	41 54                	push   %r12
+  801a6b:	53                   	push   %rbx
+  801a6c:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801a70:	48 85 d2             	test   %rdx,%rdx
+  801a73:	74 54                	je     801ac9 <readn+0x6a>
+  801a75:	41 89 fd             	mov    %edi,%r13d
+  801a78:	49 89 f6             	mov    %rsi,%r14
+  801a7b:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801a7e:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801a83:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801a88:	49 bf a1 19 80 00 00 	movabs $0x8019a1,%r15
+  801a8f:	00 00 00 
+  801a92:	4c 89 e2             	mov    %r12,%rdx
+  801a95:	48 29 f2             	sub    %rsi,%rdx
+  801a98:	4c 01 f6             	add    %r14,%rsi
+  801a9b:	44 89 ef             	mov    %r13d,%edi
+  801a9e:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801aa1:	85 c0                	test   %eax,%eax
+  801aa3:	78 20                	js     801ac5 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801aa5:	01 c3                	add    %eax,%ebx
+  801aa7:	85 c0                	test   %eax,%eax
+  801aa9:	74 08                	je     801ab3 <readn+0x54>
+  801aab:	48 63 f3             	movslq %ebx,%rsi
+  801aae:	4c 39 e6             	cmp    %r12,%rsi
+  801ab1:	72 df                	jb     801a92 <readn+0x33>
+    }
+    return res;
+  801ab3:	48 63 c3             	movslq %ebx,%rax
+}
+  801ab6:	48 83 c4 08          	add    $0x8,%rsp
+  801aba:	5b                   	pop    %rbx
+  801abb:	41 5c                	pop    %r12
+  801abd:	41 5d                	pop    %r13
+  801abf:	41 5e                	pop    %r14
+  801ac1:	41 5f                	pop    %r15
+  801ac3:	5d                   	pop    %rbp
+  801ac4:	c3                   	ret
+        if (inc < 0) return inc;
+  801ac5:	48 98                	cltq
+  801ac7:	eb ed                	jmp    801ab6 <readn+0x57>
+    int inc = 1, res = 0;
+  801ac9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ace:	eb e3                	jmp    801ab3 <readn+0x54>
+
+0000000000801ad0 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801ad0:	55                   	push   %rbp
+  801ad1:	48 89 e5             	mov    %rsp,%rbp
+  801ad4:	41 56                	push   %r14
+  801ad6:	41 55                	push   %r13
+  801ad8:	41 54                	push   %r12
+  801ada:	53                   	push   %rbx
+  801adb:	48 83 ec 10          	sub    $0x10,%rsp
+  801adf:	89 fb                	mov    %edi,%ebx
+  801ae1:	49 89 f4             	mov    %rsi,%r12
+  801ae4:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ae7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801aeb:	48 b8 be 16 80 00 00 	movabs $0x8016be,%rax
+  801af2:	00 00 00 
+  801af5:	ff d0                	call   *%rax
+  801af7:	85 c0                	test   %eax,%eax
+  801af9:	78 47                	js     801b42 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801afb:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801aff:	41 8b 3e             	mov    (%r14),%edi
+  801b02:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801b06:	48 b8 09 17 80 00 00 	movabs $0x801709,%rax
+  801b0d:	00 00 00 
+  801b10:	ff d0                	call   *%rax
+  801b12:	85 c0                	test   %eax,%eax
+  801b14:	78 30                	js     801b46 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801b16:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801b1b:	74 2d                	je     801b4a <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801b1d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b21:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801b25:	48 85 c0             	test   %rax,%rax
+  801b28:	74 56                	je     801b80 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801b2a:	4c 89 ea             	mov    %r13,%rdx
+  801b2d:	4c 89 e6             	mov    %r12,%rsi
+  801b30:	4c 89 f7             	mov    %r14,%rdi
+  801b33:	ff d0                	call   *%rax
+}
+  801b35:	48 83 c4 10          	add    $0x10,%rsp
+  801b39:	5b                   	pop    %rbx
+  801b3a:	41 5c                	pop    %r12
+  801b3c:	41 5d                	pop    %r13
+  801b3e:	41 5e                	pop    %r14
+  801b40:	5d                   	pop    %rbp
+  801b41:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b42:	48 98                	cltq
+  801b44:	eb ef                	jmp    801b35 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b46:	48 98                	cltq
+  801b48:	eb eb                	jmp    801b35 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b4a:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801b51:	00 00 00 
+  801b54:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801b5a:	89 da                	mov    %ebx,%edx
+  801b5c:	48 bf 85 5a 80 00 00 	movabs $0x805a85,%rdi
+  801b63:	00 00 00 
+  801b66:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b6b:	48 b9 79 03 80 00 00 	movabs $0x800379,%rcx
+  801b72:	00 00 00 
+  801b75:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801b77:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801b7e:	eb b5                	jmp    801b35 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801b80:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801b87:	eb ac                	jmp    801b35 <write+0x65>
+
+0000000000801b89 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801b89:	55                   	push   %rbp
+  801b8a:	48 89 e5             	mov    %rsp,%rbp
+  801b8d:	41 54                	push   %r12
+  801b8f:	53                   	push   %rbx
+  801b90:	48 83 ec 10          	sub    $0x10,%rsp
+  801b94:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b96:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801b9a:	48 b8 be 16 80 00 00 	movabs $0x8016be,%rax
+  801ba1:	00 00 00 
+  801ba4:	ff d0                	call   *%rax
+  801ba6:	85 c0                	test   %eax,%eax
+  801ba8:	78 3e                	js     801be8 <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801baa:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801bae:	41 8b 3c 24          	mov    (%r12),%edi
+  801bb2:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801bb6:	48 b8 09 17 80 00 00 	movabs $0x801709,%rax
+  801bbd:	00 00 00 
+  801bc0:	ff d0                	call   *%rax
+  801bc2:	85 c0                	test   %eax,%eax
+  801bc4:	78 22                	js     801be8 <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  801bc6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801bca:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801bce:	48 85 c0             	test   %rax,%rax
+  801bd1:	74 0b                	je     801bde <seek+0x55>
+  801bd3:	89 de                	mov    %ebx,%esi
+  801bd5:	4c 89 e7             	mov    %r12,%rdi
+  801bd8:	ff d0                	call   *%rax
+  801bda:	85 c0                	test   %eax,%eax
+  801bdc:	78 0a                	js     801be8 <seek+0x5f>
+
+    fd->fd_offset = offset;
+  801bde:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  801be3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801be8:	48 83 c4 10          	add    $0x10,%rsp
+  801bec:	5b                   	pop    %rbx
+  801bed:	41 5c                	pop    %r12
+  801bef:	5d                   	pop    %rbp
+  801bf0:	c3                   	ret
+
+0000000000801bf1 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801bf1:	55                   	push   %rbp
+  801bf2:	48 89 e5             	mov    %rsp,%rbp
+  801bf5:	41 55                	push   %r13
+  801bf7:	41 54                	push   %r12
+  801bf9:	53                   	push   %rbx
+  801bfa:	48 83 ec 18          	sub    $0x18,%rsp
+  801bfe:	89 fb                	mov    %edi,%ebx
+  801c00:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c03:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c07:	48 b8 be 16 80 00 00 	movabs $0x8016be,%rax
+  801c0e:	00 00 00 
+  801c11:	ff d0                	call   *%rax
+  801c13:	85 c0                	test   %eax,%eax
+  801c15:	78 38                	js     801c4f <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c17:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801c1b:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801c1f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c23:	48 b8 09 17 80 00 00 	movabs $0x801709,%rax
+  801c2a:	00 00 00 
+  801c2d:	ff d0                	call   *%rax
+  801c2f:	85 c0                	test   %eax,%eax
+  801c31:	78 1c                	js     801c4f <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801c33:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801c38:	74 20                	je     801c5a <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801c3a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c3e:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801c42:	48 85 c0             	test   %rax,%rax
+  801c45:	74 47                	je     801c8e <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801c47:	44 89 e6             	mov    %r12d,%esi
+  801c4a:	4c 89 ef             	mov    %r13,%rdi
+  801c4d:	ff d0                	call   *%rax
+}
+  801c4f:	48 83 c4 18          	add    $0x18,%rsp
+  801c53:	5b                   	pop    %rbx
+  801c54:	41 5c                	pop    %r12
+  801c56:	41 5d                	pop    %r13
+  801c58:	5d                   	pop    %rbp
+  801c59:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801c5a:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801c61:	00 00 00 
+  801c64:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801c6a:	89 da                	mov    %ebx,%edx
+  801c6c:	48 bf 48 5a 80 00 00 	movabs $0x805a48,%rdi
+  801c73:	00 00 00 
+  801c76:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c7b:	48 b9 79 03 80 00 00 	movabs $0x800379,%rcx
+  801c82:	00 00 00 
+  801c85:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801c87:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c8c:	eb c1                	jmp    801c4f <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801c8e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801c93:	eb ba                	jmp    801c4f <ftruncate+0x5e>
+
+0000000000801c95 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801c95:	55                   	push   %rbp
+  801c96:	48 89 e5             	mov    %rsp,%rbp
+  801c99:	41 54                	push   %r12
+  801c9b:	53                   	push   %rbx
+  801c9c:	48 83 ec 10          	sub    $0x10,%rsp
+  801ca0:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ca3:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801ca7:	48 b8 be 16 80 00 00 	movabs $0x8016be,%rax
+  801cae:	00 00 00 
+  801cb1:	ff d0                	call   *%rax
+  801cb3:	85 c0                	test   %eax,%eax
+  801cb5:	78 4e                	js     801d05 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801cb7:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801cbb:	41 8b 3c 24          	mov    (%r12),%edi
+  801cbf:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801cc3:	48 b8 09 17 80 00 00 	movabs $0x801709,%rax
+  801cca:	00 00 00 
+  801ccd:	ff d0                	call   *%rax
+  801ccf:	85 c0                	test   %eax,%eax
+  801cd1:	78 32                	js     801d05 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801cd3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801cd7:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801cdc:	74 30                	je     801d0e <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801cde:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801ce1:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801ce8:	00 00 00 
+    stat->st_isdir = 0;
+  801ceb:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801cf2:	00 00 00 
+    stat->st_dev = dev;
+  801cf5:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801cfc:	48 89 de             	mov    %rbx,%rsi
+  801cff:	4c 89 e7             	mov    %r12,%rdi
+  801d02:	ff 50 28             	call   *0x28(%rax)
+}
+  801d05:	48 83 c4 10          	add    $0x10,%rsp
+  801d09:	5b                   	pop    %rbx
+  801d0a:	41 5c                	pop    %r12
+  801d0c:	5d                   	pop    %rbp
+  801d0d:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801d0e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801d13:	eb f0                	jmp    801d05 <fstat+0x70>
+
+0000000000801d15 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801d15:	55                   	push   %rbp
+  801d16:	48 89 e5             	mov    %rsp,%rbp
+  801d19:	41 54                	push   %r12
+  801d1b:	53                   	push   %rbx
+  801d1c:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801d1f:	be 00 00 00 00       	mov    $0x0,%esi
+  801d24:	48 b8 83 2e 80 00 00 	movabs $0x802e83,%rax
+  801d2b:	00 00 00 
+  801d2e:	ff d0                	call   *%rax
+  801d30:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801d32:	85 c0                	test   %eax,%eax
+  801d34:	78 25                	js     801d5b <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801d36:	4c 89 e6             	mov    %r12,%rsi
+  801d39:	89 c7                	mov    %eax,%edi
+  801d3b:	48 b8 95 1c 80 00 00 	movabs $0x801c95,%rax
+  801d42:	00 00 00 
+  801d45:	ff d0                	call   *%rax
+  801d47:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801d4a:	89 df                	mov    %ebx,%edi
+  801d4c:	48 b8 23 18 80 00 00 	movabs $0x801823,%rax
+  801d53:	00 00 00 
+  801d56:	ff d0                	call   *%rax
+
+    return res;
+  801d58:	44 89 e3             	mov    %r12d,%ebx
+}
+  801d5b:	89 d8                	mov    %ebx,%eax
+  801d5d:	5b                   	pop    %rbx
+  801d5e:	41 5c                	pop    %r12
+  801d60:	5d                   	pop    %rbp
+  801d61:	c3                   	ret
+
+0000000000801d62 <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  801d62:	48 b8 08 00 82 00 00 	movabs $0x820008,%rax
+  801d69:	00 00 00 
+  801d6c:	83 38 00             	cmpl   $0x0,(%rax)
+  801d6f:	74 0a                	je     801d7b <fsenv+0x19>
+    return envid;
+}
+  801d71:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  801d78:	00 00 
+  801d7a:	c3                   	ret
+fsenv(void) {
+  801d7b:	55                   	push   %rbp
+  801d7c:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  801d7f:	bf 03 00 00 00       	mov    $0x3,%edi
+  801d84:	48 b8 98 53 80 00 00 	movabs $0x805398,%rax
+  801d8b:	00 00 00 
+  801d8e:	ff d0                	call   *%rax
+  801d90:	a3 08 00 82 00 00 00 	movabs %eax,0x820008
+  801d97:	00 00 
+}
+  801d99:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  801da0:	00 00 
+  801da2:	5d                   	pop    %rbp
+  801da3:	c3                   	ret
+
+0000000000801da4 <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  801da4:	55                   	push   %rbp
+  801da5:	48 89 e5             	mov    %rsp,%rbp
+  801da8:	41 54                	push   %r12
+  801daa:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  801dab:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801db0:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801db5:	48 89 de             	mov    %rbx,%rsi
+  801db8:	bf 00 00 00 00       	mov    $0x0,%edi
+  801dbd:	48 b8 a3 12 80 00 00 	movabs $0x8012a3,%rax
+  801dc4:	00 00 00 
+  801dc7:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  801dc9:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  801dd0:	00 00 00 
+  801dd3:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  801dd9:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801dde:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801de3:	48 89 de             	mov    %rbx,%rsi
+  801de6:	bf 00 00 00 00       	mov    $0x0,%edi
+  801deb:	48 b8 fd 11 80 00 00 	movabs $0x8011fd,%rax
+  801df2:	00 00 00 
+  801df5:	ff d0                	call   *%rax
+  801df7:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  801df9:	85 c0                	test   %eax,%eax
+  801dfb:	0f 88 a2 00 00 00    	js     801ea3 <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  801e01:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801e08:	00 00 00 
+  801e0b:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801e11:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801e16:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  801e18:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  801e1d:	49 bc fd 4b 80 00 00 	movabs $0x804bfd,%r12
+  801e24:	00 00 00 
+  801e27:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  801e2a:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  801e2f:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  801e32:	48 b8 62 1d 80 00 00 	movabs $0x801d62,%rax
+  801e39:	00 00 00 
+  801e3c:	ff d0                	call   *%rax
+  801e3e:	89 c7                	mov    %eax,%edi
+  801e40:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  801e46:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  801e4b:	48 89 da             	mov    %rbx,%rdx
+  801e4e:	be 09 00 00 00       	mov    $0x9,%esi
+  801e53:	48 b8 42 53 80 00 00 	movabs $0x805342,%rax
+  801e5a:	00 00 00 
+  801e5d:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  801e5f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e64:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e69:	be 00 00 00 00       	mov    $0x0,%esi
+  801e6e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e73:	48 b8 1e 53 80 00 00 	movabs $0x80531e,%rax
+  801e7a:	00 00 00 
+  801e7d:	ff d0                	call   *%rax
+  801e7f:	89 c3                	mov    %eax,%ebx
+  801e81:	85 c0                	test   %eax,%eax
+  801e83:	78 25                	js     801eaa <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  801e85:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801e8c:	00 00 00 
+  801e8f:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801e95:	a3 00 26 82 00 00 00 	movabs %eax,0x822600
+  801e9c:	00 00 
+    return 0;
+  801e9e:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  801ea3:	89 d8                	mov    %ebx,%eax
+  801ea5:	5b                   	pop    %rbx
+  801ea6:	41 5c                	pop    %r12
+  801ea8:	5d                   	pop    %rbp
+  801ea9:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  801eaa:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801eaf:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  801eb4:	bf 00 00 00 00       	mov    $0x0,%edi
+  801eb9:	48 b8 a3 12 80 00 00 	movabs $0x8012a3,%rax
+  801ec0:	00 00 00 
+  801ec3:	ff d0                	call   *%rax
+        return res;
+  801ec5:	eb dc                	jmp    801ea3 <fschan_setup+0xff>
+
+0000000000801ec7 <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  801ec7:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  801ece:	00 00 00 
+  801ed1:	80 38 00             	cmpb   $0x0,(%rax)
+  801ed4:	74 55                	je     801f2b <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801ed6:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801edd:	00 00 00 
+  801ee0:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  801ee6:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801eeb:	48 ba 00 26 82 00 00 	movabs $0x822600,%rdx
+  801ef2:	00 00 00 
+  801ef5:	3b 0a                	cmp    (%rdx),%ecx
+  801ef7:	75 01                	jne    801efa <fschan+0x33>
+}
+  801ef9:	c3                   	ret
+fschan(void) {
+  801efa:	55                   	push   %rbp
+  801efb:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801efe:	48 b8 a4 1d 80 00 00 	movabs $0x801da4,%rax
+  801f05:	00 00 00 
+  801f08:	ff d0                	call   *%rax
+  801f0a:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  801f0c:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801f11:	85 d2                	test   %edx,%edx
+  801f13:	78 02                	js     801f17 <fschan+0x50>
+}
+  801f15:	5d                   	pop    %rbp
+  801f16:	c3                   	ret
+        fschan_enabled = 0;
+  801f17:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  801f1e:	00 00 00 
+  801f21:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  801f24:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f29:	eb ea                	jmp    801f15 <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  801f2b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f30:	c3                   	ret
+
+0000000000801f31 <fbuf>:
+fbuf(struct Fd *fd) {
+  801f31:	55                   	push   %rbp
+  801f32:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  801f35:	48 b8 30 16 80 00 00 	movabs $0x801630,%rax
+  801f3c:	00 00 00 
+  801f3f:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  801f41:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f46:	48 83 f8 1f          	cmp    $0x1f,%rax
+  801f4a:	77 12                	ja     801f5e <fbuf+0x2d>
+  801f4c:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  801f50:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  801f57:	00 00 00 
+  801f5a:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  801f5e:	48 89 d0             	mov    %rdx,%rax
+  801f61:	5d                   	pop    %rbp
+  801f62:	c3                   	ret
+
+0000000000801f63 <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  801f63:	55                   	push   %rbp
+  801f64:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  801f67:	48 83 c7 40          	add    $0x40,%rdi
+  801f6b:	48 b8 37 4c 80 00 00 	movabs $0x804c37,%rax
+  801f72:	00 00 00 
+  801f75:	ff d0                	call   *%rax
+  801f77:	84 c0                	test   %al,%al
+  801f79:	75 02                	jne    801f7d <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  801f7b:	5d                   	pop    %rbp
+  801f7c:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  801f7d:	48 b8 62 1d 80 00 00 	movabs $0x801d62,%rax
+  801f84:	00 00 00 
+  801f87:	ff d0                	call   *%rax
+  801f89:	89 c7                	mov    %eax,%edi
+  801f8b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f91:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f96:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f9b:	be 0a 00 00 00       	mov    $0xa,%esi
+  801fa0:	48 b8 42 53 80 00 00 	movabs $0x805342,%rax
+  801fa7:	00 00 00 
+  801faa:	ff d0                	call   *%rax
+}
+  801fac:	eb cd                	jmp    801f7b <fschan_publish+0x18>
+
+0000000000801fae <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  801fae:	55                   	push   %rbp
+  801faf:	48 89 e5             	mov    %rsp,%rbp
+  801fb2:	41 57                	push   %r15
+  801fb4:	41 56                	push   %r14
+  801fb6:	41 55                	push   %r13
+  801fb8:	41 54                	push   %r12
+  801fba:	53                   	push   %rbx
+  801fbb:	48 83 ec 48          	sub    $0x48,%rsp
+  801fbf:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801fc3:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  801fc7:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  801fca:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  801fce:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  801fd1:	48 ba 04 00 82 00 00 	movabs $0x820004,%rdx
+  801fd8:	00 00 00 
+  801fdb:	8b 02                	mov    (%rdx),%eax
+  801fdd:	83 c0 01             	add    $0x1,%eax
+  801fe0:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801fe5:	0f 44 c1             	cmove  %ecx,%eax
+  801fe8:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  801fea:	4d 85 c0             	test   %r8,%r8
+  801fed:	74 2c                	je     80201b <fschan_rw+0x6d>
+  801fef:	45 89 ce             	mov    %r9d,%r14d
+  801ff2:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  801ff9:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  801ffd:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802003:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  80200a:	00 
+  80200b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802011:	b8 01 00 00 00       	mov    $0x1,%eax
+  802016:	e9 41 01 00 00       	jmp    80215c <fschan_rw+0x1ae>
+  80201b:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  80201f:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802023:	e9 9c 01 00 00       	jmp    8021c4 <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  802028:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80202c:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  80202f:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  802032:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  802035:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  802039:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  80203d:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  802041:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  802045:	48 89 da             	mov    %rbx,%rdx
+  802048:	48 b8 ff 0e 80 00 00 	movabs $0x800eff,%rax
+  80204f:	00 00 00 
+  802052:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  802054:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802058:	48 b8 63 1f 80 00 00 	movabs $0x801f63,%rax
+  80205f:	00 00 00 
+  802062:	ff d0                	call   *%rax
+            queued += blk;
+  802064:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  802067:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  80206b:	4d 39 fc             	cmp    %r15,%r12
+  80206e:	73 6b                	jae    8020db <fschan_rw+0x12d>
+  802070:	41 83 fd 0f          	cmp    $0xf,%r13d
+  802074:	77 65                	ja     8020db <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  802076:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80207a:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  80207e:	48 b8 12 4c 80 00 00 	movabs $0x804c12,%rax
+  802085:	00 00 00 
+  802088:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  80208a:	4c 89 fb             	mov    %r15,%rbx
+  80208d:	4c 29 e3             	sub    %r12,%rbx
+  802090:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  802095:	48 39 d3             	cmp    %rdx,%rbx
+  802098:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  80209c:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  8020a0:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  8020a4:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  8020a8:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  8020ab:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  8020ad:	48 b9 04 00 82 00 00 	movabs $0x820004,%rcx
+  8020b4:	00 00 00 
+  8020b7:	8b 09                	mov    (%rcx),%ecx
+  8020b9:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  8020bc:	83 fe 03             	cmp    $0x3,%esi
+  8020bf:	0f 85 63 ff ff ff    	jne    802028 <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  8020c5:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8020c9:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  8020cc:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  8020cf:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  8020d2:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  8020d6:	e9 79 ff ff ff       	jmp    802054 <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  8020db:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8020df:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  8020e6:	48 89 df             	mov    %rbx,%rdi
+  8020e9:	48 b8 d5 4c 80 00 00 	movabs $0x804cd5,%rax
+  8020f0:	00 00 00 
+  8020f3:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  8020f5:	48 89 df             	mov    %rbx,%rdi
+  8020f8:	48 b8 63 4c 80 00 00 	movabs $0x804c63,%rax
+  8020ff:	00 00 00 
+  802102:	ff d0                	call   *%rax
+  802104:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  802108:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  80210c:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  802110:	75 25                	jne    802137 <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  802112:	8b 40 04             	mov    0x4(%rax),%eax
+  802115:	85 c0                	test   %eax,%eax
+  802117:	0f 88 86 00 00 00    	js     8021a3 <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  80211d:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  802121:	74 5b                	je     80217e <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  802123:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802127:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  80212b:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  80212f:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  802133:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  802137:	48 89 df             	mov    %rbx,%rdi
+  80213a:	48 b8 8a 4c 80 00 00 	movabs $0x804c8a,%rax
+  802141:	00 00 00 
+  802144:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  802146:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  80214a:	83 f0 01             	xor    $0x1,%eax
+  80214d:	4d 39 fc             	cmp    %r15,%r12
+  802150:	0f 92 c2             	setb   %dl
+  802153:	84 c2                	test   %al,%dl
+  802155:	75 05                	jne    80215c <fschan_rw+0x1ae>
+  802157:	45 85 ed             	test   %r13d,%r13d
+  80215a:	74 50                	je     8021ac <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  80215c:	4d 39 fc             	cmp    %r15,%r12
+  80215f:	0f 92 c1             	setb   %cl
+  802162:	41 83 fd 0f          	cmp    $0xf,%r13d
+  802166:	0f 96 c2             	setbe  %dl
+  802169:	84 d1                	test   %dl,%cl
+  80216b:	0f 84 6a ff ff ff    	je     8020db <fschan_rw+0x12d>
+  802171:	84 c0                	test   %al,%al
+  802173:	0f 85 fd fe ff ff    	jne    802076 <fschan_rw+0xc8>
+  802179:	e9 5d ff ff ff       	jmp    8020db <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  80217e:	48 63 d0             	movslq %eax,%rdx
+  802181:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802185:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  802189:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80218d:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  802191:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  802195:	48 b8 ff 0e 80 00 00 	movabs $0x800eff,%rax
+  80219c:	00 00 00 
+  80219f:	ff d0                	call   *%rax
+  8021a1:	eb 80                	jmp    802123 <fschan_rw+0x175>
+                err = msg->fm_res;
+  8021a3:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  8021a6:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  8021aa:	eb 8b                	jmp    802137 <fschan_rw+0x189>
+    return done || !err ? done : err;
+  8021ac:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  8021b1:	0f 85 68 fe ff ff    	jne    80201f <fschan_rw+0x71>
+  8021b7:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  8021ba:	85 c0                	test   %eax,%eax
+  8021bc:	0f 84 5d fe ff ff    	je     80201f <fschan_rw+0x71>
+  8021c2:	48 98                	cltq
+}
+  8021c4:	48 83 c4 48          	add    $0x48,%rsp
+  8021c8:	5b                   	pop    %rbx
+  8021c9:	41 5c                	pop    %r12
+  8021cb:	41 5d                	pop    %r13
+  8021cd:	41 5e                	pop    %r14
+  8021cf:	41 5f                	pop    %r15
+  8021d1:	5d                   	pop    %rbp
+  8021d2:	c3                   	ret
+
+00000000008021d3 <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  8021d3:	55                   	push   %rbp
+  8021d4:	48 89 e5             	mov    %rsp,%rbp
+  8021d7:	41 56                	push   %r14
+  8021d9:	41 55                	push   %r13
+  8021db:	41 54                	push   %r12
+  8021dd:	53                   	push   %rbx
+  8021de:	48 83 ec 10          	sub    $0x10,%rsp
+  8021e2:	49 89 fe             	mov    %rdi,%r14
+  8021e5:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  8021e8:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  8021ec:	48 29 f3             	sub    %rsi,%rbx
+  8021ef:	48 39 d3             	cmp    %rdx,%rbx
+  8021f2:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  8021f6:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8021fd:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  8021fe:	bf 00 10 00 00       	mov    $0x1000,%edi
+  802203:	49 bd 05 48 80 00 00 	movabs $0x804805,%r13
+  80220a:	00 00 00 
+  80220d:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  802214:	76 1e                	jbe    802234 <mmap_fault+0x61>
+  802216:	4c 01 e7             	add    %r12,%rdi
+  802219:	41 ff d5             	call   *%r13
+  80221c:	84 c0                	test   %al,%al
+  80221e:	75 14                	jne    802234 <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  802220:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802224:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  80222b:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  80222f:	48 39 df             	cmp    %rbx,%rdi
+  802232:	72 e2                	jb     802216 <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  802234:	48 bb 00 10 82 00 00 	movabs $0x821000,%rbx
+  80223b:	00 00 00 
+  80223e:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  802245:	00 00 00 
+  802248:	4c 89 f0             	mov    %r14,%rax
+  80224b:	48 29 d0             	sub    %rdx,%rax
+  80224e:	48 c1 f8 03          	sar    $0x3,%rax
+  802252:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  802259:	aa aa aa 
+  80225c:	48 0f af c2          	imul   %rdx,%rax
+  802260:	48 c1 e0 0c          	shl    $0xc,%rax
+  802264:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  802269:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  80226d:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  80226f:	44 89 e0             	mov    %r12d,%eax
+  802272:	41 03 46 10          	add    0x10(%r14),%eax
+  802276:	41 2b 06             	sub    (%r14),%eax
+  802279:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  80227c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802280:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  802284:	41 8b 46 14          	mov    0x14(%r14),%eax
+  802288:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  80228b:	48 b8 62 1d 80 00 00 	movabs $0x801d62,%rax
+  802292:	00 00 00 
+  802295:	ff d0                	call   *%rax
+  802297:	89 c7                	mov    %eax,%edi
+  802299:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80229f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8022a4:	48 89 da             	mov    %rbx,%rdx
+  8022a7:	be 0f 00 00 00       	mov    $0xf,%esi
+  8022ac:	48 b8 42 53 80 00 00 	movabs $0x805342,%rax
+  8022b3:	00 00 00 
+  8022b6:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  8022b8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022bd:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8022c1:	4c 89 e6             	mov    %r12,%rsi
+  8022c4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022c9:	48 b8 1e 53 80 00 00 	movabs $0x80531e,%rax
+  8022d0:	00 00 00 
+  8022d3:	ff d0                	call   *%rax
+  8022d5:	48 98                	cltq
+}
+  8022d7:	48 83 c4 10          	add    $0x10,%rsp
+  8022db:	5b                   	pop    %rbx
+  8022dc:	41 5c                	pop    %r12
+  8022de:	41 5d                	pop    %r13
+  8022e0:	41 5e                	pop    %r14
+  8022e2:	5d                   	pop    %rbp
+  8022e3:	c3                   	ret
+
+00000000008022e4 <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  8022e4:	48 8b 37             	mov    (%rdi),%rsi
+  8022e7:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  8022ee:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  8022f5:	00 00 00 
+  8022f8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022fd:	eb 0f                	jmp    80230e <mmap_pgfault+0x2a>
+  8022ff:	c3                   	ret
+  802300:	48 83 c1 01          	add    $0x1,%rcx
+  802304:	48 83 c2 18          	add    $0x18,%rdx
+  802308:	48 83 f9 20          	cmp    $0x20,%rcx
+  80230c:	74 6e                	je     80237c <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  80230e:	48 8b 02             	mov    (%rdx),%rax
+  802311:	48 83 e8 01          	sub    $0x1,%rax
+  802315:	48 39 f0             	cmp    %rsi,%rax
+  802318:	73 e6                	jae    802300 <mmap_pgfault+0x1c>
+  80231a:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  80231e:	73 e0                	jae    802300 <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  802320:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  802324:	b8 00 00 00 00       	mov    $0x0,%eax
+  802329:	f6 c2 01             	test   $0x1,%dl
+  80232c:	75 d1                	jne    8022ff <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  80232e:	f6 c2 02             	test   $0x2,%dl
+  802331:	74 1a                	je     80234d <mmap_pgfault+0x69>
+  802333:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  802337:	b8 00 00 00 00       	mov    $0x0,%eax
+  80233c:	48 bf 00 20 82 00 00 	movabs $0x822000,%rdi
+  802343:	00 00 00 
+  802346:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  80234b:	74 35                	je     802382 <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  80234d:	55                   	push   %rbp
+  80234e:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  802351:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  802355:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  80235c:	00 00 00 
+  80235f:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  802363:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802368:	48 b8 d3 21 80 00 00 	movabs $0x8021d3,%rax
+  80236f:	00 00 00 
+  802372:	ff d0                	call   *%rax
+  802374:	48 85 c0             	test   %rax,%rax
+  802377:	0f 9f c0             	setg   %al
+}
+  80237a:	5d                   	pop    %rbp
+  80237b:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  80237c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802381:	c3                   	ret
+}
+  802382:	c3                   	ret
+
+0000000000802383 <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  802383:	55                   	push   %rbp
+  802384:	48 89 e5             	mov    %rsp,%rbp
+  802387:	41 54                	push   %r12
+  802389:	53                   	push   %rbx
+  80238a:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80238d:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  802394:	00 00 00 
+  802397:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  80239c:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8023a0:	74 15                	je     8023b7 <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8023a2:	48 83 c3 01          	add    $0x1,%rbx
+  8023a6:	48 83 c0 18          	add    $0x18,%rax
+  8023aa:	48 83 fb 20          	cmp    $0x20,%rbx
+  8023ae:	75 ec                	jne    80239c <mmap_alloc+0x19>
+    return NULL;
+  8023b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023b5:	eb 52                	jmp    802409 <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  8023b7:	4c 89 e7             	mov    %r12,%rdi
+  8023ba:	48 b8 a6 47 80 00 00 	movabs $0x8047a6,%rax
+  8023c1:	00 00 00 
+  8023c4:	ff d0                	call   *%rax
+  8023c6:	41 89 c1             	mov    %eax,%r9d
+  8023c9:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  8023d0:	48 c1 e1 0c          	shl    $0xc,%rcx
+  8023d4:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8023da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023df:	4c 89 e6             	mov    %r12,%rsi
+  8023e2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023e7:	48 b8 53 12 80 00 00 	movabs $0x801253,%rax
+  8023ee:	00 00 00 
+  8023f1:	ff d0                	call   *%rax
+  8023f3:	85 c0                	test   %eax,%eax
+  8023f5:	78 17                	js     80240e <mmap_alloc+0x8b>
+        return &mmaps[i];
+  8023f7:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  8023fb:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  802402:	00 00 00 
+  802405:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  802409:	5b                   	pop    %rbx
+  80240a:	41 5c                	pop    %r12
+  80240c:	5d                   	pop    %rbp
+  80240d:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  80240e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802413:	eb f4                	jmp    802409 <mmap_alloc+0x86>
+
+0000000000802415 <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  802415:	55                   	push   %rbp
+  802416:	48 89 e5             	mov    %rsp,%rbp
+  802419:	41 56                	push   %r14
+  80241b:	41 55                	push   %r13
+  80241d:	41 54                	push   %r12
+  80241f:	53                   	push   %rbx
+  802420:	48 83 ec 10          	sub    $0x10,%rsp
+  802424:	41 89 fc             	mov    %edi,%r12d
+  802427:	49 89 f5             	mov    %rsi,%r13
+  80242a:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  80242d:	48 89 f0             	mov    %rsi,%rax
+  802430:	48 09 d0             	or     %rdx,%rax
+  802433:	75 0d                	jne    802442 <fsipc+0x2d>
+  802435:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  802438:	83 f8 04             	cmp    $0x4,%eax
+  80243b:	76 7d                	jbe    8024ba <fsipc+0xa5>
+  80243d:	83 ff 0d             	cmp    $0xd,%edi
+  802440:	74 78                	je     8024ba <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  802442:	48 b8 62 1d 80 00 00 	movabs $0x801d62,%rax
+  802449:	00 00 00 
+  80244c:	ff d0                	call   *%rax
+  80244e:	89 c7                	mov    %eax,%edi
+  802450:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  802457:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  80245e:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  802465:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80246b:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802472:	00 00 00 
+  802475:	44 89 e6             	mov    %r12d,%esi
+  802478:	48 b8 42 53 80 00 00 	movabs $0x805342,%rax
+  80247f:	00 00 00 
+  802482:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  802484:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  80248b:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  80248c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802491:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802495:	4c 89 ee             	mov    %r13,%rsi
+  802498:	bf 00 00 00 00       	mov    $0x0,%edi
+  80249d:	48 b8 1e 53 80 00 00 	movabs $0x80531e,%rax
+  8024a4:	00 00 00 
+  8024a7:	ff d0                	call   *%rax
+  8024a9:	89 c3                	mov    %eax,%ebx
+}
+  8024ab:	89 d8                	mov    %ebx,%eax
+  8024ad:	48 83 c4 10          	add    $0x10,%rsp
+  8024b1:	5b                   	pop    %rbx
+  8024b2:	41 5c                	pop    %r12
+  8024b4:	41 5d                	pop    %r13
+  8024b6:	41 5e                	pop    %r14
+  8024b8:	5d                   	pop    %rbp
+  8024b9:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  8024ba:	48 b8 c7 1e 80 00 00 	movabs $0x801ec7,%rax
+  8024c1:	00 00 00 
+  8024c4:	ff d0                	call   *%rax
+  8024c6:	49 89 c6             	mov    %rax,%r14
+  8024c9:	48 85 c0             	test   %rax,%rax
+  8024cc:	0f 84 70 ff ff ff    	je     802442 <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  8024d2:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  8024d6:	48 b8 12 4c 80 00 00 	movabs $0x804c12,%rax
+  8024dd:	00 00 00 
+  8024e0:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  8024e2:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  8024e5:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  8024ec:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  8024f0:	ba 10 00 00 00       	mov    $0x10,%edx
+  8024f5:	48 be 00 00 83 00 00 	movabs $0x830000,%rsi
+  8024fc:	00 00 00 
+  8024ff:	48 b8 ff 0e 80 00 00 	movabs $0x800eff,%rax
+  802506:	00 00 00 
+  802509:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  80250b:	4c 89 f7             	mov    %r14,%rdi
+  80250e:	48 b8 63 1f 80 00 00 	movabs $0x801f63,%rax
+  802515:	00 00 00 
+  802518:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  80251a:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  802521:	4c 89 f7             	mov    %r14,%rdi
+  802524:	48 b8 d5 4c 80 00 00 	movabs $0x804cd5,%rax
+  80252b:	00 00 00 
+  80252e:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  802530:	4c 89 f7             	mov    %r14,%rdi
+  802533:	48 b8 63 4c 80 00 00 	movabs $0x804c63,%rax
+  80253a:	00 00 00 
+  80253d:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  80253f:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  802542:	41 83 fc 05          	cmp    $0x5,%r12d
+  802546:	75 04                	jne    80254c <fsipc+0x137>
+  802548:	85 db                	test   %ebx,%ebx
+  80254a:	79 14                	jns    802560 <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  80254c:	4c 89 f7             	mov    %r14,%rdi
+  80254f:	48 b8 8a 4c 80 00 00 	movabs $0x804c8a,%rax
+  802556:	00 00 00 
+  802559:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  80255b:	e9 4b ff ff ff       	jmp    8024ab <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  802560:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  802564:	ba 88 00 00 00       	mov    $0x88,%edx
+  802569:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  802570:	00 00 00 
+  802573:	48 b8 ff 0e 80 00 00 	movabs $0x800eff,%rax
+  80257a:	00 00 00 
+  80257d:	ff d0                	call   *%rax
+  80257f:	eb cb                	jmp    80254c <fsipc+0x137>
+
+0000000000802581 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  802581:	55                   	push   %rbp
+  802582:	48 89 e5             	mov    %rsp,%rbp
+  802585:	41 57                	push   %r15
+  802587:	41 56                	push   %r14
+  802589:	41 55                	push   %r13
+  80258b:	41 54                	push   %r12
+  80258d:	53                   	push   %rbx
+  80258e:	48 83 ec 18          	sub    $0x18,%rsp
+  802592:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  802596:	49 89 f6             	mov    %rsi,%r14
+  802599:	49 89 d4             	mov    %rdx,%r12
+  80259c:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  80259f:	48 b8 c7 1e 80 00 00 	movabs $0x801ec7,%rax
+  8025a6:	00 00 00 
+  8025a9:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  8025ab:	48 85 c0             	test   %rax,%rax
+  8025ae:	0f 85 96 00 00 00    	jne    80264a <devfile_write_direct+0xc9>
+    size_t write = 0;
+  8025b4:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8025bb:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8025bc:	49 bf 00 00 83 00 00 	movabs $0x830000,%r15
+  8025c3:	00 00 00 
+    while (n) {
+  8025c6:	4d 85 e4             	test   %r12,%r12
+  8025c9:	74 79                	je     802644 <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  8025cb:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  8025d0:	49 39 dc             	cmp    %rbx,%r12
+  8025d3:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  8025d7:	48 89 da             	mov    %rbx,%rdx
+  8025da:	4c 89 f6             	mov    %r14,%rsi
+  8025dd:	48 bf 00 10 83 00 00 	movabs $0x831000,%rdi
+  8025e4:	00 00 00 
+  8025e7:	48 b8 ff 0e 80 00 00 	movabs $0x800eff,%rax
+  8025ee:	00 00 00 
+  8025f1:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8025f3:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8025f7:	8b 40 0c             	mov    0xc(%rax),%eax
+  8025fa:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  8025fd:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802600:	44 01 e8             	add    %r13d,%eax
+  802603:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  802607:	41 0f 44 c5          	cmove  %r13d,%eax
+  80260b:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  80260f:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  802613:	48 89 da             	mov    %rbx,%rdx
+  802616:	be 00 00 00 00       	mov    $0x0,%esi
+  80261b:	bf 04 00 00 00       	mov    $0x4,%edi
+  802620:	48 b8 15 24 80 00 00 	movabs $0x802415,%rax
+  802627:	00 00 00 
+  80262a:	ff d0                	call   *%rax
+        if (res < 0)
+  80262c:	85 c0                	test   %eax,%eax
+  80262e:	78 4a                	js     80267a <devfile_write_direct+0xf9>
+        buf += res;
+  802630:	48 98                	cltq
+  802632:	49 01 c6             	add    %rax,%r14
+        write += res;
+  802635:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  802639:	49 29 c4             	sub    %rax,%r12
+  80263c:	75 8d                	jne    8025cb <devfile_write_direct+0x4a>
+    return write;
+  80263e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802642:	eb 27                	jmp    80266b <devfile_write_direct+0xea>
+    size_t write = 0;
+  802644:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  802648:	eb f4                	jmp    80263e <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  80264a:	45 89 e9             	mov    %r13d,%r9d
+  80264d:	4d 89 e0             	mov    %r12,%r8
+  802650:	4c 89 f1             	mov    %r14,%rcx
+  802653:	ba 04 00 00 00       	mov    $0x4,%edx
+  802658:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80265c:	48 89 c7             	mov    %rax,%rdi
+  80265f:	48 b8 ae 1f 80 00 00 	movabs $0x801fae,%rax
+  802666:	00 00 00 
+  802669:	ff d0                	call   *%rax
+}
+  80266b:	48 83 c4 18          	add    $0x18,%rsp
+  80266f:	5b                   	pop    %rbx
+  802670:	41 5c                	pop    %r12
+  802672:	41 5d                	pop    %r13
+  802674:	41 5e                	pop    %r14
+  802676:	41 5f                	pop    %r15
+  802678:	5d                   	pop    %rbp
+  802679:	c3                   	ret
+            return res;
+  80267a:	48 98                	cltq
+  80267c:	eb ed                	jmp    80266b <devfile_write_direct+0xea>
+
+000000000080267e <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  80267e:	55                   	push   %rbp
+  80267f:	48 89 e5             	mov    %rsp,%rbp
+  802682:	41 54                	push   %r12
+  802684:	53                   	push   %rbx
+  802685:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  802688:	48 b8 31 1f 80 00 00 	movabs $0x801f31,%rax
+  80268f:	00 00 00 
+  802692:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  802694:	48 85 c0             	test   %rax,%rax
+  802697:	74 71                	je     80270a <fbuf_flush+0x8c>
+  802699:	48 89 c3             	mov    %rax,%rbx
+  80269c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026a1:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  8026a5:	75 05                	jne    8026ac <fbuf_flush+0x2e>
+}
+  8026a7:	5b                   	pop    %rbx
+  8026a8:	41 5c                	pop    %r12
+  8026aa:	5d                   	pop    %rbp
+  8026ab:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  8026ac:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  8026af:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  8026b3:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8026ba:	00 00 00 
+  8026bd:	48 89 de             	mov    %rbx,%rsi
+  8026c0:	48 29 c6             	sub    %rax,%rsi
+  8026c3:	48 c1 fe 03          	sar    $0x3,%rsi
+  8026c7:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8026ce:	aa aa aa 
+  8026d1:	48 0f af f0          	imul   %rax,%rsi
+  8026d5:	48 c1 e6 0e          	shl    $0xe,%rsi
+  8026d9:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  8026de:	48 01 c6             	add    %rax,%rsi
+  8026e1:	4c 89 e7             	mov    %r12,%rdi
+  8026e4:	48 b8 81 25 80 00 00 	movabs $0x802581,%rax
+  8026eb:	00 00 00 
+  8026ee:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  8026f0:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  8026f4:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  8026fb:	00 
+    return res < 0 ? res : 0;
+  8026fc:	48 85 c0             	test   %rax,%rax
+  8026ff:	ba 00 00 00 00       	mov    $0x0,%edx
+  802704:	48 0f 4f c2          	cmovg  %rdx,%rax
+  802708:	eb 9d                	jmp    8026a7 <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  80270a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80270f:	eb 96                	jmp    8026a7 <fbuf_flush+0x29>
+
+0000000000802711 <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  802711:	55                   	push   %rbp
+  802712:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  802715:	48 b8 7e 26 80 00 00 	movabs $0x80267e,%rax
+  80271c:	00 00 00 
+  80271f:	ff d0                	call   *%rax
+}
+  802721:	5d                   	pop    %rbp
+  802722:	c3                   	ret
+
+0000000000802723 <devfile_write>:
+    if (!fd || !buf)
+  802723:	48 85 ff             	test   %rdi,%rdi
+  802726:	0f 84 d3 01 00 00    	je     8028ff <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80272c:	55                   	push   %rbp
+  80272d:	48 89 e5             	mov    %rsp,%rbp
+  802730:	41 57                	push   %r15
+  802732:	41 56                	push   %r14
+  802734:	41 55                	push   %r13
+  802736:	41 54                	push   %r12
+  802738:	53                   	push   %rbx
+  802739:	48 83 ec 08          	sub    $0x8,%rsp
+  80273d:	49 89 fc             	mov    %rdi,%r12
+  802740:	49 89 f6             	mov    %rsi,%r14
+  802743:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  802746:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  80274b:	48 85 f6             	test   %rsi,%rsi
+  80274e:	0f 84 9c 01 00 00    	je     8028f0 <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  802754:	48 b8 31 1f 80 00 00 	movabs $0x801f31,%rax
+  80275b:	00 00 00 
+  80275e:	ff d0                	call   *%rax
+  802760:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  802763:	48 85 c0             	test   %rax,%rax
+  802766:	0f 84 a2 00 00 00    	je     80280e <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  80276c:	be 00 10 00 00       	mov    $0x1000,%esi
+  802771:	4c 89 e7             	mov    %r12,%rdi
+  802774:	48 b8 c2 11 80 00 00 	movabs $0x8011c2,%rax
+  80277b:	00 00 00 
+  80277e:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  802780:	83 f8 02             	cmp    $0x2,%eax
+  802783:	0f 8f 85 00 00 00    	jg     80280e <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  802789:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802790:	00 00 00 
+  802793:	4d 89 ef             	mov    %r13,%r15
+  802796:	49 29 c7             	sub    %rax,%r15
+  802799:	49 c1 ff 03          	sar    $0x3,%r15
+  80279d:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8027a4:	aa aa aa 
+  8027a7:	4c 0f af f8          	imul   %rax,%r15
+  8027ab:	49 c1 e7 0e          	shl    $0xe,%r15
+  8027af:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  8027b4:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  8027b7:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  8027bc:	0f 84 d7 00 00 00    	je     802899 <devfile_write+0x176>
+  8027c2:	49 8b 45 10          	mov    0x10(%r13),%rax
+  8027c6:	89 c2                	mov    %eax,%edx
+  8027c8:	41 03 55 0c          	add    0xc(%r13),%edx
+  8027cc:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  8027d1:	75 0f                	jne    8027e2 <devfile_write+0xbf>
+  8027d3:	48 01 d8             	add    %rbx,%rax
+  8027d6:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  8027dc:	0f 86 92 00 00 00    	jbe    802874 <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  8027e2:	4c 89 e7             	mov    %r12,%rdi
+  8027e5:	48 b8 7e 26 80 00 00 	movabs $0x80267e,%rax
+  8027ec:	00 00 00 
+  8027ef:	ff d0                	call   *%rax
+  8027f1:	85 c0                	test   %eax,%eax
+  8027f3:	78 52                	js     802847 <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  8027f5:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  8027fc:	77 7f                	ja     80287d <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  8027fe:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802803:	0f 85 c2 00 00 00    	jne    8028cb <devfile_write+0x1a8>
+  802809:	e9 94 00 00 00       	jmp    8028a2 <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  80280e:	4c 89 e7             	mov    %r12,%rdi
+  802811:	48 b8 7e 26 80 00 00 	movabs $0x80267e,%rax
+  802818:	00 00 00 
+  80281b:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  80281d:	85 c0                	test   %eax,%eax
+  80281f:	79 07                	jns    802828 <devfile_write+0x105>
+  802821:	48 98                	cltq
+  802823:	e9 c8 00 00 00       	jmp    8028f0 <devfile_write+0x1cd>
+  802828:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  80282d:	48 89 da             	mov    %rbx,%rdx
+  802830:	4c 89 f6             	mov    %r14,%rsi
+  802833:	4c 89 e7             	mov    %r12,%rdi
+  802836:	48 b8 81 25 80 00 00 	movabs $0x802581,%rax
+  80283d:	00 00 00 
+  802840:	ff d0                	call   *%rax
+  802842:	e9 a9 00 00 00       	jmp    8028f0 <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802847:	48 98                	cltq
+  802849:	e9 a2 00 00 00       	jmp    8028f0 <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  80284e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802853:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802858:	4c 89 fe             	mov    %r15,%rsi
+  80285b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802860:	48 b8 fd 11 80 00 00 	movabs $0x8011fd,%rax
+  802867:	00 00 00 
+  80286a:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  80286c:	85 c0                	test   %eax,%eax
+  80286e:	79 45                	jns    8028b5 <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802870:	48 98                	cltq
+  802872:	eb 7c                	jmp    8028f0 <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802874:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  80287b:	76 4e                	jbe    8028cb <devfile_write+0x1a8>
+  80287d:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802882:	48 89 da             	mov    %rbx,%rdx
+  802885:	4c 89 f6             	mov    %r14,%rsi
+  802888:	4c 89 e7             	mov    %r12,%rdi
+  80288b:	48 b8 81 25 80 00 00 	movabs $0x802581,%rax
+  802892:	00 00 00 
+  802895:	ff d0                	call   *%rax
+  802897:	eb 57                	jmp    8028f0 <devfile_write+0x1cd>
+  802899:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  8028a0:	77 db                	ja     80287d <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  8028a2:	4c 89 ff             	mov    %r15,%rdi
+  8028a5:	48 b8 05 48 80 00 00 	movabs $0x804805,%rax
+  8028ac:	00 00 00 
+  8028af:	ff d0                	call   *%rax
+  8028b1:	84 c0                	test   %al,%al
+  8028b3:	74 99                	je     80284e <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  8028b5:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  8028ba:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8028bf:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  8028c3:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  8028ca:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  8028cb:	4c 89 ff             	mov    %r15,%rdi
+  8028ce:	49 03 7d 10          	add    0x10(%r13),%rdi
+  8028d2:	48 89 da             	mov    %rbx,%rdx
+  8028d5:	4c 89 f6             	mov    %r14,%rsi
+  8028d8:	48 b8 ff 0e 80 00 00 	movabs $0x800eff,%rax
+  8028df:	00 00 00 
+  8028e2:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  8028e4:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  8028e8:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  8028ed:	48 89 d8             	mov    %rbx,%rax
+}
+  8028f0:	48 83 c4 08          	add    $0x8,%rsp
+  8028f4:	5b                   	pop    %rbx
+  8028f5:	41 5c                	pop    %r12
+  8028f7:	41 5d                	pop    %r13
+  8028f9:	41 5e                	pop    %r14
+  8028fb:	41 5f                	pop    %r15
+  8028fd:	5d                   	pop    %rbp
+  8028fe:	c3                   	ret
+        return E_INVAL;
+  8028ff:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802904:	c3                   	ret
+
+0000000000802905 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802905:	55                   	push   %rbp
+  802906:	48 89 e5             	mov    %rsp,%rbp
+  802909:	41 54                	push   %r12
+  80290b:	53                   	push   %rbx
+  80290c:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  80290f:	48 b8 7e 26 80 00 00 	movabs $0x80267e,%rax
+  802916:	00 00 00 
+  802919:	ff d0                	call   *%rax
+  80291b:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  80291e:	48 89 df             	mov    %rbx,%rdi
+  802921:	48 b8 31 1f 80 00 00 	movabs $0x801f31,%rax
+  802928:	00 00 00 
+  80292b:	ff d0                	call   *%rax
+  80292d:	48 85 c0             	test   %rax,%rax
+  802930:	74 17                	je     802949 <devfile_flush+0x44>
+  802932:	48 89 df             	mov    %rbx,%rdi
+  802935:	48 b8 31 1f 80 00 00 	movabs $0x801f31,%rax
+  80293c:	00 00 00 
+  80293f:	ff d0                	call   *%rax
+  802941:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  802948:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802949:	8b 43 0c             	mov    0xc(%rbx),%eax
+  80294c:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  802953:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  802955:	ba 00 00 00 00       	mov    $0x0,%edx
+  80295a:	be 00 00 00 00       	mov    $0x0,%esi
+  80295f:	bf 06 00 00 00       	mov    $0x6,%edi
+  802964:	48 b8 15 24 80 00 00 	movabs $0x802415,%rax
+  80296b:	00 00 00 
+  80296e:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802970:	45 85 e4             	test   %r12d,%r12d
+  802973:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802977:	5b                   	pop    %rbx
+  802978:	41 5c                	pop    %r12
+  80297a:	5d                   	pop    %rbp
+  80297b:	c3                   	ret
+
+000000000080297c <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  80297c:	55                   	push   %rbp
+  80297d:	48 89 e5             	mov    %rsp,%rbp
+  802980:	41 57                	push   %r15
+  802982:	41 56                	push   %r14
+  802984:	41 55                	push   %r13
+  802986:	41 54                	push   %r12
+  802988:	53                   	push   %rbx
+  802989:	48 83 ec 38          	sub    $0x38,%rsp
+  80298d:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  802991:	49 89 f7             	mov    %rsi,%r15
+  802994:	48 89 d3             	mov    %rdx,%rbx
+  802997:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  80299a:	48 b8 c7 1e 80 00 00 	movabs $0x801ec7,%rax
+  8029a1:	00 00 00 
+  8029a4:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  8029a6:	48 85 c0             	test   %rax,%rax
+  8029a9:	75 20                	jne    8029cb <devfile_read_direct+0x4f>
+    bool map = 1;
+  8029ab:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  8029b0:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  8029b7:	00 
+    while (n) {
+  8029b8:	48 85 db             	test   %rbx,%rbx
+  8029bb:	0f 85 df 00 00 00    	jne    802aa0 <devfile_read_direct+0x124>
+    size_t read = 0;
+  8029c1:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  8029c5:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8029c9:	eb 21                	jmp    8029ec <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  8029cb:	45 89 f1             	mov    %r14d,%r9d
+  8029ce:	49 89 d8             	mov    %rbx,%r8
+  8029d1:	4c 89 f9             	mov    %r15,%rcx
+  8029d4:	ba 03 00 00 00       	mov    $0x3,%edx
+  8029d9:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  8029dd:	48 89 c7             	mov    %rax,%rdi
+  8029e0:	48 b8 ae 1f 80 00 00 	movabs $0x801fae,%rax
+  8029e7:	00 00 00 
+  8029ea:	ff d0                	call   *%rax
+}
+  8029ec:	48 83 c4 38          	add    $0x38,%rsp
+  8029f0:	5b                   	pop    %rbx
+  8029f1:	41 5c                	pop    %r12
+  8029f3:	41 5d                	pop    %r13
+  8029f5:	41 5e                	pop    %r14
+  8029f7:	41 5f                	pop    %r15
+  8029f9:	5d                   	pop    %rbp
+  8029fa:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  8029fb:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8029ff:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802a05:	75 1e                	jne    802a25 <devfile_read_direct+0xa9>
+  802a07:	e9 e2 00 00 00       	jmp    802aee <devfile_read_direct+0x172>
+            if (!res) return read;
+  802a0c:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802a10:	eb da                	jmp    8029ec <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  802a12:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  802a16:	0f 85 d0 01 00 00    	jne    802bec <devfile_read_direct+0x270>
+            map = 0;
+  802a1c:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802a20:	eb 03                	jmp    802a25 <devfile_read_direct+0xa9>
+  802a22:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802a25:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802a2a:	48 39 d3             	cmp    %rdx,%rbx
+  802a2d:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802a31:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802a35:	8b 40 0c             	mov    0xc(%rax),%eax
+  802a38:	48 b9 00 00 83 00 00 	movabs $0x830000,%rcx
+  802a3f:	00 00 00 
+  802a42:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  802a44:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  802a48:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  802a4c:	be 00 00 00 00       	mov    $0x0,%esi
+  802a51:	bf 03 00 00 00       	mov    $0x3,%edi
+  802a56:	48 b8 15 24 80 00 00 	movabs $0x802415,%rax
+  802a5d:	00 00 00 
+  802a60:	ff d0                	call   *%rax
+        if (res <= 0)
+  802a62:	85 c0                	test   %eax,%eax
+  802a64:	0f 8e 63 01 00 00    	jle    802bcd <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  802a6a:	4c 63 e0             	movslq %eax,%r12
+  802a6d:	4c 89 e2             	mov    %r12,%rdx
+  802a70:	48 be 00 10 83 00 00 	movabs $0x831000,%rsi
+  802a77:	00 00 00 
+  802a7a:	4c 89 ff             	mov    %r15,%rdi
+  802a7d:	48 b8 ff 0e 80 00 00 	movabs $0x800eff,%rax
+  802a84:	00 00 00 
+  802a87:	ff d0                	call   *%rax
+        buf += res;
+  802a89:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  802a8c:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  802a8f:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  802a93:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  802a97:	48 85 db             	test   %rbx,%rbx
+  802a9a:	0f 84 25 ff ff ff    	je     8029c5 <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  802aa0:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  802aa3:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  802aa7:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802aab:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802aaf:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  802ab6:	0f 97 c2             	seta   %dl
+  802ab9:	20 c2                	and    %al,%dl
+  802abb:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  802abe:	0f 84 5e ff ff ff    	je     802a22 <devfile_read_direct+0xa6>
+  802ac4:	4c 89 fa             	mov    %r15,%rdx
+  802ac7:	4d 89 fd             	mov    %r15,%r13
+  802aca:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  802ad1:	0f 85 4e ff ff ff    	jne    802a25 <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  802ad7:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802adb:	0f 84 1a ff ff ff    	je     8029fb <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802ae1:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802ae8:	0f 85 37 ff ff ff    	jne    802a25 <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  802aee:	48 89 d8             	mov    %rbx,%rax
+  802af1:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802af7:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802afc:	48 39 c8             	cmp    %rcx,%rax
+  802aff:	48 0f 47 c1          	cmova  %rcx,%rax
+  802b03:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  802b07:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  802b0b:	49 89 d4             	mov    %rdx,%r12
+  802b0e:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  802b12:	48 b8 a6 47 80 00 00 	movabs $0x8047a6,%rax
+  802b19:	00 00 00 
+  802b1c:	ff d0                	call   *%rax
+  802b1e:	a8 40                	test   $0x40,%al
+  802b20:	0f 85 b9 00 00 00    	jne    802bdf <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  802b26:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  802b2d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802b31:	49 39 c5             	cmp    %rax,%r13
+  802b34:	72 d8                	jb     802b0e <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802b36:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802b3a:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802b41:	00 00 00 
+  802b44:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802b48:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  802b4b:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  802b4d:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  802b51:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  802b55:	48 b8 62 1d 80 00 00 	movabs $0x801d62,%rax
+  802b5c:	00 00 00 
+  802b5f:	ff d0                	call   *%rax
+  802b61:	89 c7                	mov    %eax,%edi
+  802b63:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802b69:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802b6e:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802b75:	00 00 00 
+  802b78:	be 0e 00 00 00       	mov    $0xe,%esi
+  802b7d:	48 b8 42 53 80 00 00 	movabs $0x805342,%rax
+  802b84:	00 00 00 
+  802b87:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  802b89:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802b8e:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802b92:	4c 89 fe             	mov    %r15,%rsi
+  802b95:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b9a:	48 b8 1e 53 80 00 00 	movabs $0x80531e,%rax
+  802ba1:	00 00 00 
+  802ba4:	ff d0                	call   *%rax
+  802ba6:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  802ba9:	48 85 d2             	test   %rdx,%rdx
+  802bac:	0f 84 5a fe ff ff    	je     802a0c <devfile_read_direct+0x90>
+            if (res > 0) {
+  802bb2:	0f 8e 5a fe ff ff    	jle    802a12 <devfile_read_direct+0x96>
+                buf += res;
+  802bb8:	48 98                	cltq
+  802bba:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  802bbd:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  802bc0:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  802bc4:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  802bc8:	e9 ca fe ff ff       	jmp    802a97 <devfile_read_direct+0x11b>
+            return res ? res : read;
+  802bcd:	41 89 c5             	mov    %eax,%r13d
+  802bd0:	48 98                	cltq
+  802bd2:	45 85 ed             	test   %r13d,%r13d
+  802bd5:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  802bda:	e9 0d fe ff ff       	jmp    8029ec <devfile_read_direct+0x70>
+            map = 0;
+  802bdf:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802be3:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802be7:	e9 39 fe ff ff       	jmp    802a25 <devfile_read_direct+0xa9>
+  802bec:	48 89 d0             	mov    %rdx,%rax
+  802bef:	e9 f8 fd ff ff       	jmp    8029ec <devfile_read_direct+0x70>
+
+0000000000802bf4 <devfile_read>:
+    if (!fd || !buf)
+  802bf4:	48 85 ff             	test   %rdi,%rdi
+  802bf7:	0f 84 21 02 00 00    	je     802e1e <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802bfd:	55                   	push   %rbp
+  802bfe:	48 89 e5             	mov    %rsp,%rbp
+  802c01:	41 57                	push   %r15
+  802c03:	41 56                	push   %r14
+  802c05:	41 55                	push   %r13
+  802c07:	41 54                	push   %r12
+  802c09:	53                   	push   %rbx
+  802c0a:	48 83 ec 28          	sub    $0x28,%rsp
+  802c0e:	48 89 fb             	mov    %rdi,%rbx
+  802c11:	49 89 f4             	mov    %rsi,%r12
+  802c14:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  802c17:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802c1c:	48 85 f6             	test   %rsi,%rsi
+  802c1f:	74 4b                	je     802c6c <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  802c21:	48 b8 31 1f 80 00 00 	movabs $0x801f31,%rax
+  802c28:	00 00 00 
+  802c2b:	ff d0                	call   *%rax
+  802c2d:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802c30:	48 85 c0             	test   %rax,%rax
+  802c33:	74 22                	je     802c57 <devfile_read+0x63>
+  802c35:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  802c3c:	77 19                	ja     802c57 <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802c3e:	be 00 10 00 00       	mov    $0x1000,%esi
+  802c43:	48 89 df             	mov    %rbx,%rdi
+  802c46:	48 b8 c2 11 80 00 00 	movabs $0x8011c2,%rax
+  802c4d:	00 00 00 
+  802c50:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802c52:	83 f8 02             	cmp    $0x2,%eax
+  802c55:	7e 40                	jle    802c97 <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  802c57:	48 89 df             	mov    %rbx,%rdi
+  802c5a:	48 b8 7e 26 80 00 00 	movabs $0x80267e,%rax
+  802c61:	00 00 00 
+  802c64:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802c66:	85 c0                	test   %eax,%eax
+  802c68:	79 11                	jns    802c7b <devfile_read+0x87>
+  802c6a:	48 98                	cltq
+}
+  802c6c:	48 83 c4 28          	add    $0x28,%rsp
+  802c70:	5b                   	pop    %rbx
+  802c71:	41 5c                	pop    %r12
+  802c73:	41 5d                	pop    %r13
+  802c75:	41 5e                	pop    %r14
+  802c77:	41 5f                	pop    %r15
+  802c79:	5d                   	pop    %rbp
+  802c7a:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802c7b:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802c80:	4c 89 ea             	mov    %r13,%rdx
+  802c83:	4c 89 e6             	mov    %r12,%rsi
+  802c86:	48 89 df             	mov    %rbx,%rdi
+  802c89:	48 b8 7c 29 80 00 00 	movabs $0x80297c,%rax
+  802c90:	00 00 00 
+  802c93:	ff d0                	call   *%rax
+  802c95:	eb d5                	jmp    802c6c <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  802c97:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802c9b:	48 89 df             	mov    %rbx,%rdi
+  802c9e:	48 b8 7e 26 80 00 00 	movabs $0x80267e,%rax
+  802ca5:	00 00 00 
+  802ca8:	ff d0                	call   *%rax
+  802caa:	85 c0                	test   %eax,%eax
+  802cac:	0f 88 33 01 00 00    	js     802de5 <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  802cb2:	48 ba 00 23 82 00 00 	movabs $0x822300,%rdx
+  802cb9:	00 00 00 
+  802cbc:	4c 89 f0             	mov    %r14,%rax
+  802cbf:	48 29 d0             	sub    %rdx,%rax
+  802cc2:	48 c1 f8 03          	sar    $0x3,%rax
+  802cc6:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  802ccd:	aa aa aa 
+  802cd0:	48 0f af c2          	imul   %rdx,%rax
+  802cd4:	48 c1 e0 0e          	shl    $0xe,%rax
+  802cd8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  802cdc:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802cdf:	41 39 06             	cmp    %eax,(%r14)
+  802ce2:	75 0d                	jne    802cf1 <devfile_read+0xfd>
+  802ce4:	8b 43 10             	mov    0x10(%rbx),%eax
+  802ce7:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  802ceb:	0f 84 fb 00 00 00    	je     802dec <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  802cf1:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802cf6:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802cfa:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  802cfd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802d01:	48 89 c7             	mov    %rax,%rdi
+  802d04:	48 b8 05 48 80 00 00 	movabs $0x804805,%rax
+  802d0b:	00 00 00 
+  802d0e:	ff d0                	call   *%rax
+  802d10:	84 c0                	test   %al,%al
+  802d12:	75 27                	jne    802d3b <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802d14:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802d19:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802d1e:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802d22:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d27:	48 b8 fd 11 80 00 00 	movabs $0x8011fd,%rax
+  802d2e:	00 00 00 
+  802d31:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  802d33:	85 c0                	test   %eax,%eax
+  802d35:	0f 88 dc 00 00 00    	js     802e17 <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  802d3b:	44 89 f8             	mov    %r15d,%eax
+  802d3e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802d43:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  802d45:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  802d4c:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  802d4d:	8b 43 10             	mov    0x10(%rbx),%eax
+  802d50:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  802d54:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  802d57:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802d5c:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802d60:	48 89 df             	mov    %rbx,%rdi
+  802d63:	48 b8 7c 29 80 00 00 	movabs $0x80297c,%rax
+  802d6a:	00 00 00 
+  802d6d:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  802d6f:	48 85 c0             	test   %rax,%rax
+  802d72:	0f 88 f4 fe ff ff    	js     802c6c <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  802d78:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802d7b:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  802d7e:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  802d81:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  802d85:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  802d89:	48 63 d1             	movslq %ecx,%rdx
+  802d8c:	48 01 d0             	add    %rdx,%rax
+  802d8f:	4d 63 ff             	movslq %r15d,%r15
+  802d92:	4c 29 f8             	sub    %r15,%rax
+  802d95:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d9a:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  802d9e:	48 85 c0             	test   %rax,%rax
+  802da1:	0f 8e c5 fe ff ff    	jle    802c6c <devfile_read+0x78>
+    n = MIN(n, res);
+  802da7:	4c 39 e8             	cmp    %r13,%rax
+  802daa:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  802dae:	8b 73 04             	mov    0x4(%rbx),%esi
+  802db1:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  802db5:	48 63 f6             	movslq %esi,%rsi
+  802db8:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802dbd:	48 01 c6             	add    %rax,%rsi
+  802dc0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802dc4:	48 01 c6             	add    %rax,%rsi
+  802dc7:	4c 89 ea             	mov    %r13,%rdx
+  802dca:	4c 89 e7             	mov    %r12,%rdi
+  802dcd:	48 b8 ff 0e 80 00 00 	movabs $0x800eff,%rax
+  802dd4:	00 00 00 
+  802dd7:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  802dd9:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  802ddd:	4c 89 e8             	mov    %r13,%rax
+  802de0:	e9 87 fe ff ff       	jmp    802c6c <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802de5:	48 98                	cltq
+  802de7:	e9 80 fe ff ff       	jmp    802c6c <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  802dec:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  802df0:	41 39 d7             	cmp    %edx,%r15d
+  802df3:	0f 8c f8 fe ff ff    	jl     802cf1 <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  802df9:	49 8b 46 10          	mov    0x10(%r14),%rax
+  802dfd:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  802e00:	41 39 cf             	cmp    %ecx,%r15d
+  802e03:	0f 8d e8 fe ff ff    	jge    802cf1 <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  802e09:	4d 63 ff             	movslq %r15d,%r15
+  802e0c:	4c 29 f8             	sub    %r15,%rax
+  802e0f:	48 63 d2             	movslq %edx,%rdx
+  802e12:	48 01 d0             	add    %rdx,%rax
+  802e15:	eb 87                	jmp    802d9e <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802e17:	48 98                	cltq
+  802e19:	e9 4e fe ff ff       	jmp    802c6c <devfile_read+0x78>
+        return E_INVAL;
+  802e1e:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802e23:	c3                   	ret
+
+0000000000802e24 <fs_channel>:
+fs_channel(bool enable) {
+  802e24:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  802e26:	a2 04 26 82 00 00 00 	movabs %al,0x822604
+  802e2d:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  802e2f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e34:	40 84 ff             	test   %dil,%dil
+  802e37:	74 47                	je     802e80 <fs_channel+0x5c>
+  802e39:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  802e40:	00 00 00 
+  802e43:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  802e49:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  802e50:	00 00 00 
+  802e53:	3b 08                	cmp    (%rax),%ecx
+  802e55:	74 29                	je     802e80 <fs_channel+0x5c>
+fs_channel(bool enable) {
+  802e57:	55                   	push   %rbp
+  802e58:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  802e5b:	48 b8 a4 1d 80 00 00 	movabs $0x801da4,%rax
+  802e62:	00 00 00 
+  802e65:	ff d0                	call   *%rax
+  802e67:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  802e69:	85 c0                	test   %eax,%eax
+  802e6b:	78 04                	js     802e71 <fs_channel+0x4d>
+}
+  802e6d:	89 d0                	mov    %edx,%eax
+  802e6f:	5d                   	pop    %rbp
+  802e70:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  802e71:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  802e78:	00 00 00 
+  802e7b:	c6 00 00             	movb   $0x0,(%rax)
+  802e7e:	eb ed                	jmp    802e6d <fs_channel+0x49>
+}
+  802e80:	89 d0                	mov    %edx,%eax
+  802e82:	c3                   	ret
+
+0000000000802e83 <open>:
+open(const char *path, int mode) {
+  802e83:	55                   	push   %rbp
+  802e84:	48 89 e5             	mov    %rsp,%rbp
+  802e87:	41 55                	push   %r13
+  802e89:	41 54                	push   %r12
+  802e8b:	53                   	push   %rbx
+  802e8c:	48 83 ec 18          	sub    $0x18,%rsp
+  802e90:	49 89 fc             	mov    %rdi,%r12
+  802e93:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802e96:	48 b8 60 0c 80 00 00 	movabs $0x800c60,%rax
+  802e9d:	00 00 00 
+  802ea0:	ff d0                	call   *%rax
+  802ea2:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802ea8:	0f 87 8f 00 00 00    	ja     802f3d <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802eae:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802eb2:	48 b8 5e 16 80 00 00 	movabs $0x80165e,%rax
+  802eb9:	00 00 00 
+  802ebc:	ff d0                	call   *%rax
+  802ebe:	89 c3                	mov    %eax,%ebx
+  802ec0:	85 c0                	test   %eax,%eax
+  802ec2:	78 55                	js     802f19 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  802ec4:	4c 89 e6             	mov    %r12,%rsi
+  802ec7:	48 bb 00 00 83 00 00 	movabs $0x830000,%rbx
+  802ece:	00 00 00 
+  802ed1:	48 89 df             	mov    %rbx,%rdi
+  802ed4:	48 b8 9e 0c 80 00 00 	movabs $0x800c9e,%rax
+  802edb:	00 00 00 
+  802ede:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802ee0:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  802ee7:	ba 00 00 00 00       	mov    $0x0,%edx
+  802eec:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802ef0:	bf 01 00 00 00       	mov    $0x1,%edi
+  802ef5:	48 b8 15 24 80 00 00 	movabs $0x802415,%rax
+  802efc:	00 00 00 
+  802eff:	ff d0                	call   *%rax
+  802f01:	89 c3                	mov    %eax,%ebx
+  802f03:	85 c0                	test   %eax,%eax
+  802f05:	78 1f                	js     802f26 <open+0xa3>
+    return fd2num(fd);
+  802f07:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802f0b:	48 b8 30 16 80 00 00 	movabs $0x801630,%rax
+  802f12:	00 00 00 
+  802f15:	ff d0                	call   *%rax
+  802f17:	89 c3                	mov    %eax,%ebx
+}
+  802f19:	89 d8                	mov    %ebx,%eax
+  802f1b:	48 83 c4 18          	add    $0x18,%rsp
+  802f1f:	5b                   	pop    %rbx
+  802f20:	41 5c                	pop    %r12
+  802f22:	41 5d                	pop    %r13
+  802f24:	5d                   	pop    %rbp
+  802f25:	c3                   	ret
+        fd_close(fd, 0);
+  802f26:	be 00 00 00 00       	mov    $0x0,%esi
+  802f2b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802f2f:	48 b8 79 17 80 00 00 	movabs $0x801779,%rax
+  802f36:	00 00 00 
+  802f39:	ff d0                	call   *%rax
+        return res;
+  802f3b:	eb dc                	jmp    802f19 <open+0x96>
+        return -E_BAD_PATH;
+  802f3d:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802f42:	eb d5                	jmp    802f19 <open+0x96>
+
+0000000000802f44 <file_flush_buffers>:
+file_flush_buffers(void) {
+  802f44:	55                   	push   %rbp
+  802f45:	48 89 e5             	mov    %rsp,%rbp
+  802f48:	41 56                	push   %r14
+  802f4a:	41 55                	push   %r13
+  802f4c:	41 54                	push   %r12
+  802f4e:	53                   	push   %rbx
+  802f4f:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  802f53:	49 bc 08 23 82 00 00 	movabs $0x822308,%r12
+  802f5a:	00 00 00 
+  802f5d:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  802f62:	49 bd be 16 80 00 00 	movabs $0x8016be,%r13
+  802f69:	00 00 00 
+  802f6c:	49 be 7e 26 80 00 00 	movabs $0x80267e,%r14
+  802f73:	00 00 00 
+  802f76:	eb 0c                	jmp    802f84 <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  802f78:	83 c3 01             	add    $0x1,%ebx
+  802f7b:	49 83 c4 18          	add    $0x18,%r12
+  802f7f:	83 fb 20             	cmp    $0x20,%ebx
+  802f82:	74 1d                	je     802fa1 <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  802f84:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  802f89:	74 ed                	je     802f78 <file_flush_buffers+0x34>
+  802f8b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802f8f:	89 df                	mov    %ebx,%edi
+  802f91:	41 ff d5             	call   *%r13
+  802f94:	85 c0                	test   %eax,%eax
+  802f96:	78 e0                	js     802f78 <file_flush_buffers+0x34>
+  802f98:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802f9c:	41 ff d6             	call   *%r14
+  802f9f:	eb d7                	jmp    802f78 <file_flush_buffers+0x34>
+}
+  802fa1:	48 83 c4 10          	add    $0x10,%rsp
+  802fa5:	5b                   	pop    %rbx
+  802fa6:	41 5c                	pop    %r12
+  802fa8:	41 5d                	pop    %r13
+  802faa:	41 5e                	pop    %r14
+  802fac:	5d                   	pop    %rbp
+  802fad:	c3                   	ret
+
+0000000000802fae <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802fae:	55                   	push   %rbp
+  802faf:	48 89 e5             	mov    %rsp,%rbp
+  802fb2:	41 54                	push   %r12
+  802fb4:	53                   	push   %rbx
+  802fb5:	49 89 fc             	mov    %rdi,%r12
+  802fb8:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  802fba:	48 b8 44 2f 80 00 00 	movabs $0x802f44,%rax
+  802fc1:	00 00 00 
+  802fc4:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802fc6:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  802fcd:	00 00 00 
+  802fd0:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  802fd5:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802fd7:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  802fda:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fdf:	be 00 00 00 00       	mov    $0x0,%esi
+  802fe4:	bf 02 00 00 00       	mov    $0x2,%edi
+  802fe9:	48 b8 15 24 80 00 00 	movabs $0x802415,%rax
+  802ff0:	00 00 00 
+  802ff3:	ff d0                	call   *%rax
+}
+  802ff5:	5b                   	pop    %rbx
+  802ff6:	41 5c                	pop    %r12
+  802ff8:	5d                   	pop    %rbp
+  802ff9:	c3                   	ret
+
+0000000000802ffa <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802ffa:	55                   	push   %rbp
+  802ffb:	48 89 e5             	mov    %rsp,%rbp
+  802ffe:	41 54                	push   %r12
+  803000:	53                   	push   %rbx
+  803001:	49 89 fc             	mov    %rdi,%r12
+  803004:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  803007:	48 b8 44 2f 80 00 00 	movabs $0x802f44,%rax
+  80300e:	00 00 00 
+  803011:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803013:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  803018:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  80301f:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  803021:	ba 00 00 00 00       	mov    $0x0,%edx
+  803026:	be 00 00 00 00       	mov    $0x0,%esi
+  80302b:	bf 05 00 00 00       	mov    $0x5,%edi
+  803030:	48 b8 15 24 80 00 00 	movabs $0x802415,%rax
+  803037:	00 00 00 
+  80303a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80303c:	85 c0                	test   %eax,%eax
+  80303e:	78 3d                	js     80307d <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803040:	49 bc 00 00 83 00 00 	movabs $0x830000,%r12
+  803047:	00 00 00 
+  80304a:	4c 89 e6             	mov    %r12,%rsi
+  80304d:	48 89 df             	mov    %rbx,%rdi
+  803050:	48 b8 9e 0c 80 00 00 	movabs $0x800c9e,%rax
+  803057:	00 00 00 
+  80305a:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80305c:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  803063:	00 
+  803064:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80306a:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  803071:	00 
+  803072:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  803078:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80307d:	5b                   	pop    %rbx
+  80307e:	41 5c                	pop    %r12
+  803080:	5d                   	pop    %rbp
+  803081:	c3                   	ret
+
+0000000000803082 <remove>:
+remove(const char *path) {
+  803082:	55                   	push   %rbp
+  803083:	48 89 e5             	mov    %rsp,%rbp
+  803086:	53                   	push   %rbx
+  803087:	48 83 ec 08          	sub    $0x8,%rsp
+  80308b:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  80308e:	48 b8 60 0c 80 00 00 	movabs $0x800c60,%rax
+  803095:	00 00 00 
+  803098:	ff d0                	call   *%rax
+  80309a:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8030a0:	77 3a                	ja     8030dc <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  8030a2:	48 89 de             	mov    %rbx,%rsi
+  8030a5:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  8030ac:	00 00 00 
+  8030af:	48 b8 9e 0c 80 00 00 	movabs $0x800c9e,%rax
+  8030b6:	00 00 00 
+  8030b9:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  8030bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030c0:	be 00 00 00 00       	mov    $0x0,%esi
+  8030c5:	bf 07 00 00 00       	mov    $0x7,%edi
+  8030ca:	48 b8 15 24 80 00 00 	movabs $0x802415,%rax
+  8030d1:	00 00 00 
+  8030d4:	ff d0                	call   *%rax
+}
+  8030d6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8030da:	c9                   	leave
+  8030db:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  8030dc:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8030e1:	eb f3                	jmp    8030d6 <remove+0x54>
+
+00000000008030e3 <sync>:
+sync(void) {
+  8030e3:	55                   	push   %rbp
+  8030e4:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  8030e7:	48 b8 44 2f 80 00 00 	movabs $0x802f44,%rax
+  8030ee:	00 00 00 
+  8030f1:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  8030f3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030f8:	be 00 00 00 00       	mov    $0x0,%esi
+  8030fd:	bf 08 00 00 00       	mov    $0x8,%edi
+  803102:	48 b8 15 24 80 00 00 	movabs $0x802415,%rax
+  803109:	00 00 00 
+  80310c:	ff d0                	call   *%rax
+}
+  80310e:	5d                   	pop    %rbp
+  80310f:	c3                   	ret
+
+0000000000803110 <fsync>:
+fsync(int fdnum) {
+  803110:	55                   	push   %rbp
+  803111:	48 89 e5             	mov    %rsp,%rbp
+  803114:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803118:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80311c:	48 b8 be 16 80 00 00 	movabs $0x8016be,%rax
+  803123:	00 00 00 
+  803126:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803128:	85 c0                	test   %eax,%eax
+  80312a:	78 4b                	js     803177 <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80312c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803130:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  803137:	00 00 00 
+  80313a:	8b 00                	mov    (%rax),%eax
+  80313c:	39 02                	cmp    %eax,(%rdx)
+  80313e:	75 39                	jne    803179 <fsync+0x69>
+    file_flush_buffers();
+  803140:	48 b8 44 2f 80 00 00 	movabs $0x802f44,%rax
+  803147:	00 00 00 
+  80314a:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  80314c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803150:	8b 40 0c             	mov    0xc(%rax),%eax
+  803153:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  80315a:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  80315c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803161:	be 00 00 00 00       	mov    $0x0,%esi
+  803166:	bf 0d 00 00 00       	mov    $0xd,%edi
+  80316b:	48 b8 15 24 80 00 00 	movabs $0x802415,%rax
+  803172:	00 00 00 
+  803175:	ff d0                	call   *%rax
+}
+  803177:	c9                   	leave
+  803178:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803179:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80317e:	eb f7                	jmp    803177 <fsync+0x67>
+
+0000000000803180 <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  803180:	55                   	push   %rbp
+  803181:	48 89 e5             	mov    %rsp,%rbp
+  803184:	53                   	push   %rbx
+  803185:	48 83 ec 08          	sub    $0x8,%rsp
+  803189:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  80318c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803191:	be 00 00 00 00       	mov    $0x0,%esi
+  803196:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80319b:	48 b8 15 24 80 00 00 	movabs $0x802415,%rax
+  8031a2:	00 00 00 
+  8031a5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8031a7:	85 c0                	test   %eax,%eax
+  8031a9:	78 2d                	js     8031d8 <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  8031ab:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  8031b2:	00 00 00 
+  8031b5:	48 8b 10             	mov    (%rax),%rdx
+  8031b8:	48 89 13             	mov    %rdx,(%rbx)
+  8031bb:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8031bf:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  8031c3:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8031c7:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  8031cb:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8031cf:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  8031d3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8031d8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8031dc:	c9                   	leave
+  8031dd:	c3                   	ret
+
+00000000008031de <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  8031de:	55                   	push   %rbp
+  8031df:	48 89 e5             	mov    %rsp,%rbp
+  8031e2:	53                   	push   %rbx
+  8031e3:	48 83 ec 08          	sub    $0x8,%rsp
+  8031e7:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  8031ea:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8031f4:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8031f9:	48 b8 15 24 80 00 00 	movabs $0x802415,%rax
+  803200:	00 00 00 
+  803203:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803205:	85 c0                	test   %eax,%eax
+  803207:	78 3d                	js     803246 <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  803209:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803210:	00 00 00 
+  803213:	48 8b 10             	mov    (%rax),%rdx
+  803216:	48 89 13             	mov    %rdx,(%rbx)
+  803219:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80321d:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  803221:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803225:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  803229:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  80322d:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  803231:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  803235:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  803239:	48 8b 40 28          	mov    0x28(%rax),%rax
+  80323d:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  803241:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803246:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80324a:	c9                   	leave
+  80324b:	c3                   	ret
+
+000000000080324c <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  80324c:	55                   	push   %rbp
+  80324d:	48 89 e5             	mov    %rsp,%rbp
+  803250:	41 57                	push   %r15
+  803252:	41 56                	push   %r14
+  803254:	41 55                	push   %r13
+  803256:	41 54                	push   %r12
+  803258:	53                   	push   %rbx
+  803259:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  80325d:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  803264:	00 
+  803265:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  80326c:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  803272:	0f 85 43 01 00 00    	jne    8033bb <munmap+0x16f>
+  803278:	49 89 ff             	mov    %rdi,%r15
+  80327b:	4c 39 f7             	cmp    %r14,%rdi
+  80327e:	0f 87 37 01 00 00    	ja     8033bb <munmap+0x16f>
+  803284:	48 bb 00 20 82 00 00 	movabs $0x822000,%rbx
+  80328b:	00 00 00 
+  80328e:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  803294:	eb 2c                	jmp    8032c2 <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  803296:	4c 39 f8             	cmp    %r15,%rax
+  803299:	0f 83 85 00 00 00    	jae    803324 <munmap+0xd8>
+            m->mm_end = start;
+  80329f:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8032a4:	48 83 c3 18          	add    $0x18,%rbx
+  8032a8:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  8032af:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8032b6:	00 00 00 
+  8032b9:	48 39 c3             	cmp    %rax,%rbx
+  8032bc:	0f 84 d0 00 00 00    	je     803392 <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  8032c2:	49 89 dc             	mov    %rbx,%r12
+  8032c5:	48 8b 03             	mov    (%rbx),%rax
+  8032c8:	4c 39 f0             	cmp    %r14,%rax
+  8032cb:	73 d7                	jae    8032a4 <munmap+0x58>
+  8032cd:	48 85 c0             	test   %rax,%rax
+  8032d0:	74 d2                	je     8032a4 <munmap+0x58>
+  8032d2:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8032d6:	49 39 d7             	cmp    %rdx,%r15
+  8032d9:	73 c9                	jae    8032a4 <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  8032db:	49 39 d6             	cmp    %rdx,%r14
+  8032de:	73 b6                	jae    803296 <munmap+0x4a>
+  8032e0:	49 39 c7             	cmp    %rax,%r15
+  8032e3:	76 b1                	jbe    803296 <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  8032e5:	4c 89 ef             	mov    %r13,%rdi
+  8032e8:	48 b8 83 23 80 00 00 	movabs $0x802383,%rax
+  8032ef:	00 00 00 
+  8032f2:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  8032f4:	48 85 c0             	test   %rax,%rax
+  8032f7:	0f 84 c5 00 00 00    	je     8033c2 <munmap+0x176>
+            *tail = *m;
+  8032fd:	48 8b 13             	mov    (%rbx),%rdx
+  803300:	48 89 10             	mov    %rdx,(%rax)
+  803303:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  803307:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  80330b:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  80330f:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  803313:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  803316:	44 89 f2             	mov    %r14d,%edx
+  803319:	2b 13                	sub    (%rbx),%edx
+  80331b:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  80331e:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  803322:	eb 80                	jmp    8032a4 <munmap+0x58>
+        } else if (m->mm_end > end) {
+  803324:	49 39 d6             	cmp    %rdx,%r14
+  803327:	73 18                	jae    803341 <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  803329:	44 89 f2             	mov    %r14d,%edx
+  80332c:	41 03 54 24 10       	add    0x10(%r12),%edx
+  803331:	29 c2                	sub    %eax,%edx
+  803333:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  803338:	4d 89 34 24          	mov    %r14,(%r12)
+  80333c:	e9 63 ff ff ff       	jmp    8032a4 <munmap+0x58>
+    m->mm_start = 0;
+  803341:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  803348:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  803349:	4c 89 e6             	mov    %r12,%rsi
+  80334c:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  803353:	00 00 00 
+  803356:	48 29 c6             	sub    %rax,%rsi
+  803359:	48 c1 fe 03          	sar    $0x3,%rsi
+  80335d:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  803364:	aa aa aa 
+  803367:	48 0f af f0          	imul   %rax,%rsi
+  80336b:	48 c1 e6 0c          	shl    $0xc,%rsi
+  80336f:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  803374:	48 01 c6             	add    %rax,%rsi
+  803377:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80337c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803381:	48 b8 a3 12 80 00 00 	movabs $0x8012a3,%rax
+  803388:	00 00 00 
+  80338b:	ff d0                	call   *%rax
+}
+  80338d:	e9 12 ff ff ff       	jmp    8032a4 <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  803392:	4c 89 f2             	mov    %r14,%rdx
+  803395:	4c 29 fa             	sub    %r15,%rdx
+  803398:	4c 89 fe             	mov    %r15,%rsi
+  80339b:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033a0:	48 b8 a3 12 80 00 00 	movabs $0x8012a3,%rax
+  8033a7:	00 00 00 
+  8033aa:	ff d0                	call   *%rax
+}
+  8033ac:	48 83 c4 08          	add    $0x8,%rsp
+  8033b0:	5b                   	pop    %rbx
+  8033b1:	41 5c                	pop    %r12
+  8033b3:	41 5d                	pop    %r13
+  8033b5:	41 5e                	pop    %r14
+  8033b7:	41 5f                	pop    %r15
+  8033b9:	5d                   	pop    %rbp
+  8033ba:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  8033bb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8033c0:	eb ea                	jmp    8033ac <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  8033c2:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  8033c7:	eb e3                	jmp    8033ac <munmap+0x160>
+
+00000000008033c9 <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  8033c9:	55                   	push   %rbp
+  8033ca:	48 89 e5             	mov    %rsp,%rbp
+  8033cd:	41 57                	push   %r15
+  8033cf:	41 56                	push   %r14
+  8033d1:	41 55                	push   %r13
+  8033d3:	41 54                	push   %r12
+  8033d5:	53                   	push   %rbx
+  8033d6:	48 83 ec 28          	sub    $0x28,%rsp
+  8033da:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8033de:	49 89 f5             	mov    %rsi,%r13
+  8033e1:	41 89 d6             	mov    %edx,%r14d
+  8033e4:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  8033e7:	41 89 cc             	mov    %ecx,%r12d
+  8033ea:	44 89 c7             	mov    %r8d,%edi
+  8033ed:	44 89 cb             	mov    %r9d,%ebx
+  8033f0:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8033f4:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8033f8:	48 b8 be 16 80 00 00 	movabs $0x8016be,%rax
+  8033ff:	00 00 00 
+  803402:	ff d0                	call   *%rax
+  803404:	41 89 c7             	mov    %eax,%r15d
+  803407:	85 c0                	test   %eax,%eax
+  803409:	0f 88 ae 01 00 00    	js     8035bd <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80340f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803413:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  80341a:	00 00 00 
+  80341d:	8b 32                	mov    (%rdx),%esi
+  80341f:	39 30                	cmp    %esi,(%rax)
+  803421:	0f 85 7a 02 00 00    	jne    8036a1 <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  803427:	8b 40 08             	mov    0x8(%rax),%eax
+  80342a:	83 e0 03             	and    $0x3,%eax
+  80342d:	83 f8 01             	cmp    $0x1,%eax
+  803430:	0f 84 76 02 00 00    	je     8036ac <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  803436:	4d 85 ed             	test   %r13,%r13
+  803439:	0f 84 78 02 00 00    	je     8036b7 <mmap+0x2ee>
+  80343f:	85 db                	test   %ebx,%ebx
+  803441:	0f 88 70 02 00 00    	js     8036b7 <mmap+0x2ee>
+  803447:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  80344d:	41 89 df             	mov    %ebx,%r15d
+  803450:	0f 85 6c 02 00 00    	jne    8036c2 <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  803456:	44 89 f0             	mov    %r14d,%eax
+  803459:	83 e0 fd             	and    $0xfffffffd,%eax
+  80345c:	83 f8 04             	cmp    $0x4,%eax
+  80345f:	0f 85 68 02 00 00    	jne    8036cd <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  803465:	44 89 e1             	mov    %r12d,%ecx
+  803468:	83 e1 01             	and    $0x1,%ecx
+  80346b:	0f 95 c2             	setne  %dl
+  80346e:	44 89 e0             	mov    %r12d,%eax
+  803471:	d1 e8                	shr    %eax
+  803473:	83 f0 01             	xor    $0x1,%eax
+  803476:	83 e0 01             	and    $0x1,%eax
+  803479:	38 c2                	cmp    %al,%dl
+  80347b:	0f 85 57 02 00 00    	jne    8036d8 <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  803481:	85 c9                	test   %ecx,%ecx
+  803483:	74 0a                	je     80348f <mmap+0xc6>
+  803485:	41 f6 c6 02          	test   $0x2,%r14b
+  803489:	0f 85 54 02 00 00    	jne    8036e3 <mmap+0x31a>
+    file_flush_buffers();
+  80348f:	48 b8 44 2f 80 00 00 	movabs $0x802f44,%rax
+  803496:	00 00 00 
+  803499:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  80349b:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  8034a2:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  8034a9:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8034ad:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  8034b0:	41 f6 c4 04          	test   $0x4,%r12b
+  8034b4:	0f 84 15 01 00 00    	je     8035cf <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  8034ba:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  8034bd:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8034c3:	0f 85 25 02 00 00    	jne    8036ee <mmap+0x325>
+  8034c9:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  8034cd:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  8034d4:	00 00 00 
+  8034d7:	48 39 c2             	cmp    %rax,%rdx
+  8034da:	0f 82 19 02 00 00    	jb     8036f9 <mmap+0x330>
+  8034e0:	48 39 c7             	cmp    %rax,%rdi
+  8034e3:	0f 87 10 02 00 00    	ja     8036f9 <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  8034e9:	4c 89 ee             	mov    %r13,%rsi
+  8034ec:	48 b8 4c 32 80 00 00 	movabs $0x80324c,%rax
+  8034f3:	00 00 00 
+  8034f6:	ff d0                	call   *%rax
+  8034f8:	85 c0                	test   %eax,%eax
+  8034fa:	0f 88 04 02 00 00    	js     803704 <mmap+0x33b>
+    if (!handler) {
+  803500:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  803507:	00 00 00 
+  80350a:	80 38 00             	cmpb   $0x0,(%rax)
+  80350d:	75 2b                	jne    80353a <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  80350f:	48 bf e4 22 80 00 00 	movabs $0x8022e4,%rdi
+  803516:	00 00 00 
+  803519:	48 b8 ed 4f 80 00 00 	movabs $0x804fed,%rax
+  803520:	00 00 00 
+  803523:	ff d0                	call   *%rax
+  803525:	85 c0                	test   %eax,%eax
+  803527:	0f 88 ea 01 00 00    	js     803717 <mmap+0x34e>
+        handler = 1;
+  80352d:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  803534:	00 00 00 
+  803537:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  80353a:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80353e:	48 b8 83 23 80 00 00 	movabs $0x802383,%rax
+  803545:	00 00 00 
+  803548:	ff d0                	call   *%rax
+  80354a:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  80354d:	48 85 c0             	test   %rax,%rax
+  803550:	0f 84 c9 01 00 00    	je     80371f <mmap+0x356>
+    m->mm_start = va;
+  803556:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  803559:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  80355d:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  803561:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  803564:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  803568:	44 89 e0             	mov    %r12d,%eax
+  80356b:	c1 e0 06             	shl    $0x6,%eax
+  80356e:	25 80 00 00 00       	and    $0x80,%eax
+  803573:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  803576:	09 f0                	or     %esi,%eax
+  803578:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  80357c:	41 f6 c4 08          	test   $0x8,%r12b
+  803580:	74 31                	je     8035b3 <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  803582:	48 39 d3             	cmp    %rdx,%rbx
+  803585:	73 2c                	jae    8035b3 <mmap+0x1ea>
+  803587:	ba 00 00 04 00       	mov    $0x40000,%edx
+  80358c:	48 89 de             	mov    %rbx,%rsi
+  80358f:	4c 89 f7             	mov    %r14,%rdi
+  803592:	48 b8 d3 21 80 00 00 	movabs $0x8021d3,%rax
+  803599:	00 00 00 
+  80359c:	ff d0                	call   *%rax
+  80359e:	49 89 c4             	mov    %rax,%r12
+  8035a1:	48 85 c0             	test   %rax,%rax
+  8035a4:	0f 8e d7 00 00 00    	jle    803681 <mmap+0x2b8>
+            va += n;
+  8035aa:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  8035ad:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  8035b1:	72 d4                	jb     803587 <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  8035b3:	49 8b 06             	mov    (%r14),%rax
+  8035b6:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  8035ba:	48 89 06             	mov    %rax,(%rsi)
+}
+  8035bd:	44 89 f8             	mov    %r15d,%eax
+  8035c0:	48 83 c4 28          	add    $0x28,%rsp
+  8035c4:	5b                   	pop    %rbx
+  8035c5:	41 5c                	pop    %r12
+  8035c7:	41 5d                	pop    %r13
+  8035c9:	41 5e                	pop    %r14
+  8035cb:	41 5f                	pop    %r15
+  8035cd:	5d                   	pop    %rbp
+  8035ce:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8035cf:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  8035d6:	00 00 00 
+  8035d9:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  8035dc:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  8035e3:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8035e6:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  8035eb:	48 be 00 20 82 00 00 	movabs $0x822000,%rsi
+  8035f2:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8035f5:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  8035fc:	00 00 00 
+  8035ff:	48 39 d7             	cmp    %rdx,%rdi
+  803602:	73 1c                	jae    803620 <mmap+0x257>
+        return -E_NO_MEM;
+  803604:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80360a:	eb b1                	jmp    8035bd <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80360c:	48 83 c0 01          	add    $0x1,%rax
+  803610:	48 83 f8 1f          	cmp    $0x1f,%rax
+  803614:	77 3f                	ja     803655 <mmap+0x28c>
+  803616:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  80361b:	48 39 d7             	cmp    %rdx,%rdi
+  80361e:	72 2a                	jb     80364a <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  803620:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  803624:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  803628:	48 39 d1             	cmp    %rdx,%rcx
+  80362b:	73 df                	jae    80360c <mmap+0x243>
+  80362d:	48 85 c9             	test   %rcx,%rcx
+  803630:	74 da                	je     80360c <mmap+0x243>
+  803632:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  803636:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  80363b:	48 39 d3             	cmp    %rdx,%rbx
+  80363e:	73 cc                	jae    80360c <mmap+0x243>
+            va = mmaps[i].mm_end;
+  803640:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803643:	b8 00 00 00 00       	mov    $0x0,%eax
+  803648:	eb cc                	jmp    803616 <mmap+0x24d>
+        return -E_NO_MEM;
+  80364a:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803650:	e9 68 ff ff ff       	jmp    8035bd <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  803655:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  80365a:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  803661:	00 00 00 
+  803664:	48 39 c2             	cmp    %rax,%rdx
+  803667:	0f 82 9f 00 00 00    	jb     80370c <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  80366d:	48 85 db             	test   %rbx,%rbx
+  803670:	0f 85 8a fe ff ff    	jne    803500 <mmap+0x137>
+        return -E_NO_MEM;
+  803676:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80367c:	e9 3c ff ff ff       	jmp    8035bd <mmap+0x1f4>
+        if (n < 0) {
+  803681:	0f 89 2c ff ff ff    	jns    8035b3 <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  803687:	49 8b 3e             	mov    (%r14),%rdi
+  80368a:	4c 89 ee             	mov    %r13,%rsi
+  80368d:	48 b8 4c 32 80 00 00 	movabs $0x80324c,%rax
+  803694:	00 00 00 
+  803697:	ff d0                	call   *%rax
+            return n;
+  803699:	45 89 e7             	mov    %r12d,%r15d
+  80369c:	e9 1c ff ff ff       	jmp    8035bd <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8036a1:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8036a7:	e9 11 ff ff ff       	jmp    8035bd <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  8036ac:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8036b2:	e9 06 ff ff ff       	jmp    8035bd <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  8036b7:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8036bd:	e9 fb fe ff ff       	jmp    8035bd <mmap+0x1f4>
+  8036c2:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8036c8:	e9 f0 fe ff ff       	jmp    8035bd <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  8036cd:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8036d3:	e9 e5 fe ff ff       	jmp    8035bd <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  8036d8:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8036de:	e9 da fe ff ff       	jmp    8035bd <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  8036e3:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  8036e9:	e9 cf fe ff ff       	jmp    8035bd <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  8036ee:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8036f4:	e9 c4 fe ff ff       	jmp    8035bd <mmap+0x1f4>
+  8036f9:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8036ff:	e9 b9 fe ff ff       	jmp    8035bd <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  803704:	41 89 c7             	mov    %eax,%r15d
+  803707:	e9 b1 fe ff ff       	jmp    8035bd <mmap+0x1f4>
+        return -E_NO_MEM;
+  80370c:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803712:	e9 a6 fe ff ff       	jmp    8035bd <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  803717:	41 89 c7             	mov    %eax,%r15d
+  80371a:	e9 9e fe ff ff       	jmp    8035bd <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  80371f:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803725:	e9 93 fe ff ff       	jmp    8035bd <mmap+0x1f4>
+
+000000000080372a <copy_shared_region>:
+    scring_unmap_region(0, UTEMP, USER_STACK_SIZE);
+    return 0;
+}
+
+static int
+copy_shared_region(void *start, void *end, void *arg) {
+  80372a:	55                   	push   %rbp
+  80372b:	48 89 e5             	mov    %rsp,%rbp
+  80372e:	41 55                	push   %r13
+  803730:	41 54                	push   %r12
+  803732:	53                   	push   %rbx
+  803733:	48 83 ec 08          	sub    $0x8,%rsp
+  803737:	48 89 fb             	mov    %rdi,%rbx
+  80373a:	49 89 f4             	mov    %rsi,%r12
+    envid_t child = *(envid_t *)arg;
+  80373d:	44 8b 2a             	mov    (%rdx),%r13d
+    scring_map_region(0, start, child, start, end - start, get_prot(start));
+  803740:	48 b8 a6 47 80 00 00 	movabs $0x8047a6,%rax
+  803747:	00 00 00 
+  80374a:	ff d0                	call   *%rax
+  80374c:	41 89 c1             	mov    %eax,%r9d
+  80374f:	4d 89 e0             	mov    %r12,%r8
+  803752:	49 29 d8             	sub    %rbx,%r8
+  803755:	48 89 d9             	mov    %rbx,%rcx
+  803758:	44 89 ea             	mov    %r13d,%edx
+  80375b:	48 89 de             	mov    %rbx,%rsi
+  80375e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803763:	48 b8 1b 4b 80 00 00 	movabs $0x804b1b,%rax
+  80376a:	00 00 00 
+  80376d:	ff d0                	call   *%rax
+    return 0;
+}
+  80376f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803774:	48 83 c4 08          	add    $0x8,%rsp
+  803778:	5b                   	pop    %rbx
+  803779:	41 5c                	pop    %r12
+  80377b:	41 5d                	pop    %r13
+  80377d:	5d                   	pop    %rbp
+  80377e:	c3                   	ret
+
+000000000080377f <spawn>:
+spawn(const char *prog, const char **argv) {
+  80377f:	55                   	push   %rbp
+  803780:	48 89 e5             	mov    %rsp,%rbp
+  803783:	41 57                	push   %r15
+  803785:	41 56                	push   %r14
+  803787:	41 55                	push   %r13
+  803789:	41 54                	push   %r12
+  80378b:	53                   	push   %rbx
+  80378c:	48 81 ec 08 03 00 00 	sub    $0x308,%rsp
+  803793:	48 89 fb             	mov    %rdi,%rbx
+  803796:	49 89 f4             	mov    %rsi,%r12
+    file_flush_buffers();
+  803799:	48 b8 44 2f 80 00 00 	movabs $0x802f44,%rax
+  8037a0:	00 00 00 
+  8037a3:	ff d0                	call   *%rax
+    int fd = open(prog, O_RDONLY);
+  8037a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8037aa:	48 89 df             	mov    %rbx,%rdi
+  8037ad:	48 b8 83 2e 80 00 00 	movabs $0x802e83,%rax
+  8037b4:	00 00 00 
+  8037b7:	ff d0                	call   *%rax
+  8037b9:	89 85 e4 fc ff ff    	mov    %eax,-0x31c(%rbp)
+    if (fd < 0) return fd;
+  8037bf:	85 c0                	test   %eax,%eax
+  8037c1:	0f 88 06 04 00 00    	js     803bcd <spawn+0x44e>
+  8037c7:	89 c7                	mov    %eax,%edi
+    res = readn(fd, elf_buf, sizeof(elf_buf));
+  8037c9:	ba 00 02 00 00       	mov    $0x200,%edx
+  8037ce:	48 8d b5 d0 fd ff ff 	lea    -0x230(%rbp),%rsi
+  8037d5:	48 b8 5f 1a 80 00 00 	movabs $0x801a5f,%rax
+  8037dc:	00 00 00 
+  8037df:	ff d0                	call   *%rax
+  8037e1:	89 c6                	mov    %eax,%esi
+    if (res != sizeof(elf_buf)) {
+  8037e3:	3d 00 02 00 00       	cmp    $0x200,%eax
+  8037e8:	0f 85 93 02 00 00    	jne    803a81 <spawn+0x302>
+        elf->e_elf[1] != 1 /* little endian */ ||
+  8037ee:	48 b8 ff ff ff ff ff 	movabs $0xffffffffffffff,%rax
+  8037f5:	ff ff 00 
+  8037f8:	48 23 85 d0 fd ff ff 	and    -0x230(%rbp),%rax
+    if (elf->e_magic != ELF_MAGIC ||
+  8037ff:	48 ba 7f 45 4c 46 02 	movabs $0x10102464c457f,%rdx
+  803806:	01 01 00 
+  803809:	48 39 d0             	cmp    %rdx,%rax
+  80380c:	0f 85 ab 02 00 00    	jne    803abd <spawn+0x33e>
+        elf->e_type != ET_EXEC /* executable */ ||
+  803812:	81 bd e0 fd ff ff 02 	cmpl   $0x3e0002,-0x220(%rbp)
+  803819:	00 3e 00 
+  80381c:	0f 85 9b 02 00 00    	jne    803abd <spawn+0x33e>
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("syscall"
+  803822:	b8 08 00 00 00       	mov    $0x8,%eax
+  803827:	0f 05                	syscall
+  803829:	41 89 c6             	mov    %eax,%r14d
+  80382c:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+    if ((int)(res = sys_exofork()) < 0) goto error2;
+  803832:	85 c0                	test   %eax,%eax
+  803834:	0f 88 75 03 00 00    	js     803baf <spawn+0x430>
+    envid_t child = res;
+  80383a:	89 85 cc fd ff ff    	mov    %eax,-0x234(%rbp)
+    struct Trapframe child_tf = envs[ENVX(child)].env_tf;
+  803840:	89 c2                	mov    %eax,%edx
+  803842:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  803848:	48 89 d0             	mov    %rdx,%rax
+  80384b:	48 c1 e0 04          	shl    $0x4,%rax
+  80384f:	48 29 d0             	sub    %rdx,%rax
+  803852:	48 c1 e0 05          	shl    $0x5,%rax
+  803856:	48 be 00 00 c0 1f 80 	movabs $0x801fc00000,%rsi
+  80385d:	00 00 00 
+  803860:	48 01 c6             	add    %rax,%rsi
+  803863:	48 8b 06             	mov    (%rsi),%rax
+  803866:	48 89 85 0c fd ff ff 	mov    %rax,-0x2f4(%rbp)
+  80386d:	48 8b 86 b8 00 00 00 	mov    0xb8(%rsi),%rax
+  803874:	48 89 85 c4 fd ff ff 	mov    %rax,-0x23c(%rbp)
+  80387b:	48 8d bd 10 fd ff ff 	lea    -0x2f0(%rbp),%rdi
+  803882:	48 c7 c1 fc ff ff ff 	mov    $0xfffffffffffffffc,%rcx
+  803889:	48 29 ce             	sub    %rcx,%rsi
+  80388c:	81 c1 c0 00 00 00    	add    $0xc0,%ecx
+  803892:	c1 e9 03             	shr    $0x3,%ecx
+  803895:	89 c9                	mov    %ecx,%ecx
+  803897:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    child_tf.tf_rip = elf->e_entry;
+  80389a:	48 8b 85 e8 fd ff ff 	mov    -0x218(%rbp),%rax
+  8038a1:	48 89 85 a4 fd ff ff 	mov    %rax,-0x25c(%rbp)
+    for (argc = 0; argv[argc] != 0; argc++)
+  8038a8:	49 8b 3c 24          	mov    (%r12),%rdi
+  8038ac:	48 85 ff             	test   %rdi,%rdi
+  8038af:	0f 84 d6 05 00 00    	je     803e8b <spawn+0x70c>
+  8038b5:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    string_size = 0;
+  8038bb:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        string_size += strlen(argv[argc]) + 1;
+  8038c1:	48 bb 60 0c 80 00 00 	movabs $0x800c60,%rbx
+  8038c8:	00 00 00 
+  8038cb:	ff d3                	call   *%rbx
+  8038cd:	4c 01 f8             	add    %r15,%rax
+  8038d0:	4c 8d 78 01          	lea    0x1(%rax),%r15
+    for (argc = 0; argv[argc] != 0; argc++)
+  8038d4:	4c 89 ea             	mov    %r13,%rdx
+  8038d7:	49 83 c5 01          	add    $0x1,%r13
+  8038db:	4b 8b 7c ec f8       	mov    -0x8(%r12,%r13,8),%rdi
+  8038e0:	48 85 ff             	test   %rdi,%rdi
+  8038e3:	75 e6                	jne    8038cb <spawn+0x14c>
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  8038e5:	49 89 d5             	mov    %rdx,%r13
+  8038e8:	48 89 95 f8 fc ff ff 	mov    %rdx,-0x308(%rbp)
+  8038ef:	48 f7 d0             	not    %rax
+  8038f2:	48 8d 98 00 00 41 00 	lea    0x410000(%rax),%rbx
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  8038f9:	49 89 df             	mov    %rbx,%r15
+  8038fc:	49 83 e7 f8          	and    $0xfffffffffffffff8,%r15
+  803900:	4c 89 bd e8 fc ff ff 	mov    %r15,-0x318(%rbp)
+  803907:	89 d0                	mov    %edx,%eax
+  803909:	83 c0 01             	add    $0x1,%eax
+  80390c:	48 98                	cltq
+  80390e:	48 c1 e0 03          	shl    $0x3,%rax
+  803912:	49 29 c7             	sub    %rax,%r15
+  803915:	4c 89 bd f0 fc ff ff 	mov    %r15,-0x310(%rbp)
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  80391c:	49 8d 47 f0          	lea    -0x10(%r15),%rax
+  803920:	48 3d ff ff 3f 00    	cmp    $0x3fffff,%rax
+  803926:	0f 86 4f 05 00 00    	jbe    803e7b <spawn+0x6fc>
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  80392c:	b9 06 00 00 00       	mov    $0x6,%ecx
+  803931:	ba 00 00 01 00       	mov    $0x10000,%edx
+  803936:	be 00 00 40 00       	mov    $0x400000,%esi
+  80393b:	48 b8 fd 11 80 00 00 	movabs $0x8011fd,%rax
+  803942:	00 00 00 
+  803945:	ff d0                	call   *%rax
+  803947:	85 c0                	test   %eax,%eax
+  803949:	0f 88 31 05 00 00    	js     803e80 <spawn+0x701>
+    for (i = 0; i < argc; i++) {
+  80394f:	4c 89 e8             	mov    %r13,%rax
+  803952:	45 85 ed             	test   %r13d,%r13d
+  803955:	7e 65                	jle    8039bc <spawn+0x23d>
+  803957:	4d 89 fd             	mov    %r15,%r13
+  80395a:	48 98                	cltq
+  80395c:	49 8d 04 c7          	lea    (%r15,%rax,8),%rax
+        argv_store[i] = UTEMP2USTACK(string_store);
+  803960:	49 bf 00 70 fe ff 7f 	movabs $0x7ffffe7000,%r15
+  803967:	00 00 00 
+        string_store += strlen(argv[i]) + 1;
+  80396a:	44 89 b5 e0 fc ff ff 	mov    %r14d,-0x320(%rbp)
+  803971:	49 89 c6             	mov    %rax,%r14
+        argv_store[i] = UTEMP2USTACK(string_store);
+  803974:	4a 8d 84 3b 00 00 c0 	lea    -0x400000(%rbx,%r15,1),%rax
+  80397b:	ff 
+  80397c:	49 89 45 00          	mov    %rax,0x0(%r13)
+        strcpy(string_store, argv[i]);
+  803980:	49 8b 34 24          	mov    (%r12),%rsi
+  803984:	48 89 df             	mov    %rbx,%rdi
+  803987:	48 b8 9e 0c 80 00 00 	movabs $0x800c9e,%rax
+  80398e:	00 00 00 
+  803991:	ff d0                	call   *%rax
+        string_store += strlen(argv[i]) + 1;
+  803993:	49 8b 3c 24          	mov    (%r12),%rdi
+  803997:	48 b8 60 0c 80 00 00 	movabs $0x800c60,%rax
+  80399e:	00 00 00 
+  8039a1:	ff d0                	call   *%rax
+  8039a3:	48 8d 5c 03 01       	lea    0x1(%rbx,%rax,1),%rbx
+    for (i = 0; i < argc; i++) {
+  8039a8:	49 83 c5 08          	add    $0x8,%r13
+  8039ac:	49 83 c4 08          	add    $0x8,%r12
+  8039b0:	4d 39 ee             	cmp    %r13,%r14
+  8039b3:	75 bf                	jne    803974 <spawn+0x1f5>
+  8039b5:	44 8b b5 e0 fc ff ff 	mov    -0x320(%rbp),%r14d
+    argv_store[argc] = 0;
+  8039bc:	48 8b 85 e8 fc ff ff 	mov    -0x318(%rbp),%rax
+  8039c3:	48 c7 40 f8 00 00 00 	movq   $0x0,-0x8(%rax)
+  8039ca:	00 
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  8039cb:	48 81 fb 00 00 41 00 	cmp    $0x410000,%rbx
+  8039d2:	0f 85 2c 01 00 00    	jne    803b04 <spawn+0x385>
+    argv_store[-1] = UTEMP2USTACK(argv_store);
+  8039d8:	48 b9 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rcx
+  8039df:	00 00 00 
+  8039e2:	48 8b 9d f0 fc ff ff 	mov    -0x310(%rbp),%rbx
+  8039e9:	48 8d 84 0b 00 00 c0 	lea    -0x400000(%rbx,%rcx,1),%rax
+  8039f0:	ff 
+  8039f1:	48 89 43 f8          	mov    %rax,-0x8(%rbx)
+    argv_store[-2] = argc;
+  8039f5:	48 8b 85 f8 fc ff ff 	mov    -0x308(%rbp),%rax
+  8039fc:	48 89 43 f0          	mov    %rax,-0x10(%rbx)
+    tf->tf_rsp = UTEMP2USTACK(&argv_store[-2]);
+  803a00:	48 b8 f0 6f fe ff 7f 	movabs $0x7ffffe6ff0,%rax
+  803a07:	00 00 00 
+  803a0a:	48 8d 84 03 00 00 c0 	lea    -0x400000(%rbx,%rax,1),%rax
+  803a11:	ff 
+  803a12:	48 89 85 bc fd ff ff 	mov    %rax,-0x244(%rbp)
+    scring_map_region(0, UTEMP, child, (void *)(USER_STACK_TOP - USER_STACK_SIZE),
+  803a19:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  803a1f:	41 b8 00 00 01 00    	mov    $0x10000,%r8d
+  803a25:	44 89 f2             	mov    %r14d,%edx
+  803a28:	be 00 00 40 00       	mov    $0x400000,%esi
+  803a2d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a32:	48 b8 1b 4b 80 00 00 	movabs $0x804b1b,%rax
+  803a39:	00 00 00 
+  803a3c:	ff d0                	call   *%rax
+    scring_unmap_region(0, UTEMP, USER_STACK_SIZE);
+  803a3e:	ba 00 00 01 00       	mov    $0x10000,%edx
+  803a43:	be 00 00 40 00       	mov    $0x400000,%esi
+  803a48:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a4d:	48 b8 54 4b 80 00 00 	movabs $0x804b54,%rax
+  803a54:	00 00 00 
+  803a57:	ff d0                	call   *%rax
+    struct Proghdr *ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+  803a59:	48 8b 85 f0 fd ff ff 	mov    -0x210(%rbp),%rax
+  803a60:	4c 8d ac 05 d0 fd ff 	lea    -0x230(%rbp,%rax,1),%r13
+  803a67:	ff 
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  803a68:	66 83 bd 08 fe ff ff 	cmpw   $0x0,-0x1f8(%rbp)
+  803a6f:	00 
+  803a70:	0f 84 5d 03 00 00    	je     803dd3 <spawn+0x654>
+  803a76:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  803a7c:	e9 1b 02 00 00       	jmp    803c9c <spawn+0x51d>
+        cprintf("Wrong ELF header size or read error: %i\n", res);
+  803a81:	48 bf e0 5a 80 00 00 	movabs $0x805ae0,%rdi
+  803a88:	00 00 00 
+  803a8b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a90:	48 ba 79 03 80 00 00 	movabs $0x800379,%rdx
+  803a97:	00 00 00 
+  803a9a:	ff d2                	call   *%rdx
+        close(fd);
+  803a9c:	8b bd e4 fc ff ff    	mov    -0x31c(%rbp),%edi
+  803aa2:	48 b8 23 18 80 00 00 	movabs $0x801823,%rax
+  803aa9:	00 00 00 
+  803aac:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  803aae:	c7 85 e4 fc ff ff ee 	movl   $0xffffffee,-0x31c(%rbp)
+  803ab5:	ff ff ff 
+  803ab8:	e9 10 01 00 00       	jmp    803bcd <spawn+0x44e>
+        cprintf("Elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  803abd:	ba 7f 45 4c 46       	mov    $0x464c457f,%edx
+  803ac2:	8b b5 d0 fd ff ff    	mov    -0x230(%rbp),%esi
+  803ac8:	48 bf 97 5b 80 00 00 	movabs $0x805b97,%rdi
+  803acf:	00 00 00 
+  803ad2:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ad7:	48 b9 79 03 80 00 00 	movabs $0x800379,%rcx
+  803ade:	00 00 00 
+  803ae1:	ff d1                	call   *%rcx
+        close(fd);
+  803ae3:	8b bd e4 fc ff ff    	mov    -0x31c(%rbp),%edi
+  803ae9:	48 b8 23 18 80 00 00 	movabs $0x801823,%rax
+  803af0:	00 00 00 
+  803af3:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  803af5:	c7 85 e4 fc ff ff ee 	movl   $0xffffffee,-0x31c(%rbp)
+  803afc:	ff ff ff 
+  803aff:	e9 c9 00 00 00       	jmp    803bcd <spawn+0x44e>
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  803b04:	48 b9 10 5b 80 00 00 	movabs $0x805b10,%rcx
+  803b0b:	00 00 00 
+  803b0e:	48 ba b1 5b 80 00 00 	movabs $0x805bb1,%rdx
+  803b15:	00 00 00 
+  803b18:	be f9 00 00 00       	mov    $0xf9,%esi
+  803b1d:	48 bf c6 5b 80 00 00 	movabs $0x805bc6,%rdi
+  803b24:	00 00 00 
+  803b27:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b2c:	49 b8 29 02 80 00 00 	movabs $0x800229,%r8
+  803b33:	00 00 00 
+  803b36:	41 ff d0             	call   *%r8
+    /* Map them to child */
+    /* Unmap them from parent */
+    size_t datasz = filesz;
+    filesz = ROUNDUP(va + filesz, PAGE_SIZE) - va;
+    if (memsz > filesz)
+        scring_alloc_region(child, (void *)va + filesz, memsz - filesz, perm);
+  803b39:	49 8d 14 06          	lea    (%r14,%rax,1),%rdx
+  803b3d:	48 29 f2             	sub    %rsi,%rdx
+  803b40:	89 d9                	mov    %ebx,%ecx
+  803b42:	8b bd dc fc ff ff    	mov    -0x324(%rbp),%edi
+  803b48:	48 b8 e5 4a 80 00 00 	movabs $0x804ae5,%rax
+  803b4f:	00 00 00 
+  803b52:	ff d0                	call   *%rax
+  803b54:	e9 f0 01 00 00       	jmp    803d49 <spawn+0x5ca>
+
+    /* Everything queued so far (including the unmap of
+     * the previous segment) has to be executed first */
+    res = scring_submit();
+    if (res < 0) {
+        cprintf("map_segment.sys_alloc_region failed: %i\n", res);
+  803b59:	89 c6                	mov    %eax,%esi
+  803b5b:	48 bf 40 5b 80 00 00 	movabs $0x805b40,%rdi
+  803b62:	00 00 00 
+  803b65:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b6a:	48 ba 79 03 80 00 00 	movabs $0x800379,%rdx
+  803b71:	00 00 00 
+  803b74:	ff d2                	call   *%rdx
+    scring_discard();
+  803b76:	48 b8 c5 4a 80 00 00 	movabs $0x804ac5,%rax
+  803b7d:	00 00 00 
+  803b80:	ff d0                	call   *%rax
+    sys_unmap_region(0, UTEMP, USER_STACK_SIZE);
+  803b82:	ba 00 00 01 00       	mov    $0x10000,%edx
+  803b87:	be 00 00 40 00       	mov    $0x400000,%esi
+  803b8c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b91:	48 b8 a3 12 80 00 00 	movabs $0x8012a3,%rax
+  803b98:	00 00 00 
+  803b9b:	ff d0                	call   *%rax
+    sys_env_destroy(child);
+  803b9d:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  803ba3:	48 b8 0d 11 80 00 00 	movabs $0x80110d,%rax
+  803baa:	00 00 00 
+  803bad:	ff d0                	call   *%rax
+    close(fd);
+  803baf:	8b bd e4 fc ff ff    	mov    -0x31c(%rbp),%edi
+  803bb5:	48 b8 23 18 80 00 00 	movabs $0x801823,%rax
+  803bbc:	00 00 00 
+  803bbf:	ff d0                	call   *%rax
+    return res;
+  803bc1:	8b 85 f0 fc ff ff    	mov    -0x310(%rbp),%eax
+  803bc7:	89 85 e4 fc ff ff    	mov    %eax,-0x31c(%rbp)
+}
+  803bcd:	8b 85 e4 fc ff ff    	mov    -0x31c(%rbp),%eax
+  803bd3:	48 81 c4 08 03 00 00 	add    $0x308,%rsp
+  803bda:	5b                   	pop    %rbx
+  803bdb:	41 5c                	pop    %r12
+  803bdd:	41 5d                	pop    %r13
+  803bdf:	41 5e                	pop    %r14
+  803be1:	41 5f                	pop    %r15
+  803be3:	5d                   	pop    %rbp
+  803be4:	c3                   	ret
+    /* Text pages stay shared with the block cache
+     * and with other instances of the program */
+    void *addr = UTEMP;
+    res = mmap(&addr, filesz, PROT_RW, MAP_PRIVATE | MAP_FIXED | MAP_POPULATE, fd, fileoffset);
+    if (res < 0) {
+        cprintf("map_segment.mmap failed: %i\n", res);
+  803be5:	89 c6                	mov    %eax,%esi
+  803be7:	48 bf d2 5b 80 00 00 	movabs $0x805bd2,%rdi
+  803bee:	00 00 00 
+  803bf1:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bf6:	48 ba 79 03 80 00 00 	movabs $0x800379,%rdx
+  803bfd:	00 00 00 
+  803c00:	ff d2                	call   *%rdx
+        return res;
+  803c02:	e9 6f ff ff ff       	jmp    803b76 <spawn+0x3f7>
+    }
+
+    /* The rest of the last page belongs to bss */
+    if (memsz > datasz && filesz > datasz)
+        memset(UTEMP + datasz, 0, filesz - datasz);
+  803c07:	4c 89 e2             	mov    %r12,%rdx
+  803c0a:	48 8b 85 e8 fc ff ff 	mov    -0x318(%rbp),%rax
+  803c11:	48 29 c2             	sub    %rax,%rdx
+  803c14:	48 8d b8 00 00 40 00 	lea    0x400000(%rax),%rdi
+  803c1b:	be 00 00 00 00       	mov    $0x0,%esi
+  803c20:	48 b8 ea 0d 80 00 00 	movabs $0x800dea,%rax
+  803c27:	00 00 00 
+  803c2a:	ff d0                	call   *%rax
+
+    scring_map_region(CURENVID, UTEMP, child, (void *)va, filesz, perm | PROT_LAZY);
+  803c2c:	80 cb 80             	or     $0x80,%bl
+  803c2f:	41 89 d9             	mov    %ebx,%r9d
+  803c32:	4d 89 e0             	mov    %r12,%r8
+  803c35:	4c 89 f1             	mov    %r14,%rcx
+  803c38:	8b 95 dc fc ff ff    	mov    -0x324(%rbp),%edx
+  803c3e:	be 00 00 40 00       	mov    $0x400000,%esi
+  803c43:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c48:	48 b8 1b 4b 80 00 00 	movabs $0x804b1b,%rax
+  803c4f:	00 00 00 
+  803c52:	ff d0                	call   *%rax
+    res = scring_submit();
+  803c54:	48 b8 79 4a 80 00 00 	movabs $0x804a79,%rax
+  803c5b:	00 00 00 
+  803c5e:	ff d0                	call   *%rax
+  803c60:	89 c3                	mov    %eax,%ebx
+  803c62:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+    munmap(UTEMP, filesz);
+  803c68:	4c 89 e6             	mov    %r12,%rsi
+  803c6b:	bf 00 00 40 00       	mov    $0x400000,%edi
+  803c70:	48 b8 4c 32 80 00 00 	movabs $0x80324c,%rax
+  803c77:	00 00 00 
+  803c7a:	ff d0                	call   *%rax
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  803c7c:	85 db                	test   %ebx,%ebx
+  803c7e:	0f 88 f2 fe ff ff    	js     803b76 <spawn+0x3f7>
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  803c84:	49 83 c7 01          	add    $0x1,%r15
+  803c88:	49 83 c5 38          	add    $0x38,%r13
+  803c8c:	0f b7 85 08 fe ff ff 	movzwl -0x1f8(%rbp),%eax
+  803c93:	49 39 c7             	cmp    %rax,%r15
+  803c96:	0f 83 37 01 00 00    	jae    803dd3 <spawn+0x654>
+        if (ph->p_type != ELF_PROG_LOAD) continue;
+  803c9c:	41 83 7d 00 01       	cmpl   $0x1,0x0(%r13)
+  803ca1:	75 e1                	jne    803c84 <spawn+0x505>
+        if (ph->p_flags & ELF_PROG_FLAG_WRITE) perm |= PROT_W;
+  803ca3:	41 8b 45 04          	mov    0x4(%r13),%eax
+  803ca7:	89 c3                	mov    %eax,%ebx
+  803ca9:	83 e3 02             	and    $0x2,%ebx
+        if (ph->p_flags & ELF_PROG_FLAG_READ) perm |= PROT_R;
+  803cac:	89 da                	mov    %ebx,%edx
+  803cae:	83 ca 04             	or     $0x4,%edx
+  803cb1:	a8 04                	test   $0x4,%al
+  803cb3:	0f 45 da             	cmovne %edx,%ebx
+        if (ph->p_flags & ELF_PROG_FLAG_EXEC) perm |= PROT_X;
+  803cb6:	89 da                	mov    %ebx,%edx
+  803cb8:	83 ca 01             	or     $0x1,%edx
+  803cbb:	a8 01                	test   $0x1,%al
+  803cbd:	0f 45 da             	cmovne %edx,%ebx
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  803cc0:	49 8b 45 08          	mov    0x8(%r13),%rax
+  803cc4:	89 85 e0 fc ff ff    	mov    %eax,-0x320(%rbp)
+  803cca:	49 8b 75 20          	mov    0x20(%r13),%rsi
+  803cce:	48 89 b5 e8 fc ff ff 	mov    %rsi,-0x318(%rbp)
+  803cd5:	49 8b 7d 28          	mov    0x28(%r13),%rdi
+  803cd9:	48 89 bd f8 fc ff ff 	mov    %rdi,-0x308(%rbp)
+  803ce0:	4d 8b 75 10          	mov    0x10(%r13),%r14
+  803ce4:	8b 8d cc fd ff ff    	mov    -0x234(%rbp),%ecx
+  803cea:	89 8d dc fc ff ff    	mov    %ecx,-0x324(%rbp)
+    if (res) {
+  803cf0:	44 89 f2             	mov    %r14d,%edx
+  803cf3:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803cf9:	74 22                	je     803d1d <spawn+0x59e>
+        va -= res;
+  803cfb:	48 63 ca             	movslq %edx,%rcx
+  803cfe:	49 29 ce             	sub    %rcx,%r14
+        memsz += res;
+  803d01:	48 01 cf             	add    %rcx,%rdi
+  803d04:	48 89 bd f8 fc ff ff 	mov    %rdi,-0x308(%rbp)
+        filesz += res;
+  803d0b:	48 01 ce             	add    %rcx,%rsi
+  803d0e:	48 89 b5 e8 fc ff ff 	mov    %rsi,-0x318(%rbp)
+        fileoffset -= res;
+  803d15:	29 d0                	sub    %edx,%eax
+  803d17:	89 85 e0 fc ff ff    	mov    %eax,-0x320(%rbp)
+    filesz = ROUNDUP(va + filesz, PAGE_SIZE) - va;
+  803d1d:	48 8b 85 e8 fc ff ff 	mov    -0x318(%rbp),%rax
+  803d24:	4a 8d b4 30 ff 0f 00 	lea    0xfff(%rax,%r14,1),%rsi
+  803d2b:	00 
+  803d2c:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  803d33:	49 89 f4             	mov    %rsi,%r12
+  803d36:	4d 29 f4             	sub    %r14,%r12
+    if (memsz > filesz)
+  803d39:	48 8b 85 f8 fc ff ff 	mov    -0x308(%rbp),%rax
+  803d40:	49 39 c4             	cmp    %rax,%r12
+  803d43:	0f 82 f0 fd ff ff    	jb     803b39 <spawn+0x3ba>
+    res = scring_submit();
+  803d49:	48 b8 79 4a 80 00 00 	movabs $0x804a79,%rax
+  803d50:	00 00 00 
+  803d53:	ff d0                	call   *%rax
+  803d55:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+    if (res < 0) {
+  803d5b:	85 c0                	test   %eax,%eax
+  803d5d:	0f 88 f6 fd ff ff    	js     803b59 <spawn+0x3da>
+    if (!filesz) return 0;
+  803d63:	4d 85 e4             	test   %r12,%r12
+  803d66:	0f 84 18 ff ff ff    	je     803c84 <spawn+0x505>
+    void *addr = UTEMP;
+  803d6c:	48 c7 85 00 fd ff ff 	movq   $0x400000,-0x300(%rbp)
+  803d73:	00 00 40 00 
+    res = mmap(&addr, filesz, PROT_RW, MAP_PRIVATE | MAP_FIXED | MAP_POPULATE, fd, fileoffset);
+  803d77:	44 8b 8d e0 fc ff ff 	mov    -0x320(%rbp),%r9d
+  803d7e:	44 8b 85 e4 fc ff ff 	mov    -0x31c(%rbp),%r8d
+  803d85:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  803d8a:	ba 06 00 00 00       	mov    $0x6,%edx
+  803d8f:	4c 89 e6             	mov    %r12,%rsi
+  803d92:	48 8d bd 00 fd ff ff 	lea    -0x300(%rbp),%rdi
+  803d99:	48 b8 c9 33 80 00 00 	movabs $0x8033c9,%rax
+  803da0:	00 00 00 
+  803da3:	ff d0                	call   *%rax
+  803da5:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+    if (res < 0) {
+  803dab:	85 c0                	test   %eax,%eax
+  803dad:	0f 88 32 fe ff ff    	js     803be5 <spawn+0x466>
+    if (memsz > datasz && filesz > datasz)
+  803db3:	48 8b 85 f8 fc ff ff 	mov    -0x308(%rbp),%rax
+  803dba:	49 39 c4             	cmp    %rax,%r12
+  803dbd:	49 0f 46 c4          	cmovbe %r12,%rax
+  803dc1:	48 39 85 e8 fc ff ff 	cmp    %rax,-0x318(%rbp)
+  803dc8:	0f 83 5e fe ff ff    	jae    803c2c <spawn+0x4ad>
+  803dce:	e9 34 fe ff ff       	jmp    803c07 <spawn+0x488>
+    close(fd);
+  803dd3:	8b bd e4 fc ff ff    	mov    -0x31c(%rbp),%edi
+  803dd9:	48 b8 23 18 80 00 00 	movabs $0x801823,%rax
+  803de0:	00 00 00 
+  803de3:	ff d0                	call   *%rax
+    foreach_shared_region(copy_shared_region, &child);
+  803de5:	48 8d b5 cc fd ff ff 	lea    -0x234(%rbp),%rsi
+  803dec:	48 bf 2a 37 80 00 00 	movabs $0x80372a,%rdi
+  803df3:	00 00 00 
+  803df6:	48 b8 1a 48 80 00 00 	movabs $0x80481a,%rax
+  803dfd:	00 00 00 
+  803e00:	ff d0                	call   *%rax
+    scring_env_set_trapframe(child, &child_tf);
+  803e02:	48 8d b5 0c fd ff ff 	lea    -0x2f4(%rbp),%rsi
+  803e09:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  803e0f:	48 b8 c5 4b 80 00 00 	movabs $0x804bc5,%rax
+  803e16:	00 00 00 
+  803e19:	ff d0                	call   *%rax
+    scring_env_set_status(child, ENV_RUNNABLE);
+  803e1b:	be 02 00 00 00       	mov    $0x2,%esi
+  803e20:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  803e26:	48 b8 8d 4b 80 00 00 	movabs $0x804b8d,%rax
+  803e2d:	00 00 00 
+  803e30:	ff d0                	call   *%rax
+    if ((res = scring_submit()) < 0) {
+  803e32:	48 b8 79 4a 80 00 00 	movabs $0x804a79,%rax
+  803e39:	00 00 00 
+  803e3c:	ff d0                	call   *%rax
+  803e3e:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+  803e44:	85 c0                	test   %eax,%eax
+  803e46:	78 11                	js     803e59 <spawn+0x6da>
+    return child;
+  803e48:	8b 85 cc fd ff ff    	mov    -0x234(%rbp),%eax
+  803e4e:	89 85 e4 fc ff ff    	mov    %eax,-0x31c(%rbp)
+  803e54:	e9 74 fd ff ff       	jmp    803bcd <spawn+0x44e>
+        cprintf("spawn: batched system call failed: %i\n", res);
+  803e59:	89 c6                	mov    %eax,%esi
+  803e5b:	48 bf 70 5b 80 00 00 	movabs $0x805b70,%rdi
+  803e62:	00 00 00 
+  803e65:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e6a:	48 ba 79 03 80 00 00 	movabs $0x800379,%rdx
+  803e71:	00 00 00 
+  803e74:	ff d2                	call   *%rdx
+        goto error;
+  803e76:	e9 fb fc ff ff       	jmp    803b76 <spawn+0x3f7>
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  803e7b:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  803e80:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+  803e86:	e9 eb fc ff ff       	jmp    803b76 <spawn+0x3f7>
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  803e8b:	b9 06 00 00 00       	mov    $0x6,%ecx
+  803e90:	ba 00 00 01 00       	mov    $0x10000,%edx
+  803e95:	be 00 00 40 00       	mov    $0x400000,%esi
+  803e9a:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e9f:	48 b8 fd 11 80 00 00 	movabs $0x8011fd,%rax
+  803ea6:	00 00 00 
+  803ea9:	ff d0                	call   *%rax
+  803eab:	85 c0                	test   %eax,%eax
+  803ead:	78 d1                	js     803e80 <spawn+0x701>
+    for (argc = 0; argv[argc] != 0; argc++)
+  803eaf:	48 c7 85 f8 fc ff ff 	movq   $0x0,-0x308(%rbp)
+  803eb6:	00 00 00 00 
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  803eba:	48 c7 85 f0 fc ff ff 	movq   $0x40fff8,-0x310(%rbp)
+  803ec1:	f8 ff 40 00 
+  803ec5:	48 c7 85 e8 fc ff ff 	movq   $0x410000,-0x318(%rbp)
+  803ecc:	00 00 41 00 
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  803ed0:	bb 00 00 41 00       	mov    $0x410000,%ebx
+  803ed5:	e9 e2 fa ff ff       	jmp    8039bc <spawn+0x23d>
+
+0000000000803eda <spawnl>:
+spawnl(const char *prog, const char *arg0, ...) {
+  803eda:	55                   	push   %rbp
+  803edb:	48 89 e5             	mov    %rsp,%rbp
+  803ede:	48 83 ec 50          	sub    $0x50,%rsp
+  803ee2:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803ee6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803eea:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803eee:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(vl, arg0);
+  803ef2:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803ef9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803efd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803f01:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803f05:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int argc = 0;
+  803f09:	b9 00 00 00 00       	mov    $0x0,%ecx
+    while (va_arg(vl, void *) != NULL) argc++;
+  803f0e:	eb 15                	jmp    803f25 <spawnl+0x4b>
+  803f10:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803f14:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803f18:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803f1c:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  803f20:	74 1c                	je     803f3e <spawnl+0x64>
+  803f22:	83 c1 01             	add    $0x1,%ecx
+  803f25:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803f28:	83 f8 2f             	cmp    $0x2f,%eax
+  803f2b:	77 e3                	ja     803f10 <spawnl+0x36>
+  803f2d:	89 c2                	mov    %eax,%edx
+  803f2f:	4c 8d 55 d0          	lea    -0x30(%rbp),%r10
+  803f33:	4c 01 d2             	add    %r10,%rdx
+  803f36:	83 c0 08             	add    $0x8,%eax
+  803f39:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803f3c:	eb de                	jmp    803f1c <spawnl+0x42>
+    const char *argv[argc + 2];
+  803f3e:	8d 41 02             	lea    0x2(%rcx),%eax
+  803f41:	48 98                	cltq
+  803f43:	48 8d 04 c5 0f 00 00 	lea    0xf(,%rax,8),%rax
+  803f4a:	00 
+  803f4b:	48 83 e0 f0          	and    $0xfffffffffffffff0,%rax
+  803f4f:	48 29 c4             	sub    %rax,%rsp
+  803f52:	4c 8d 44 24 07       	lea    0x7(%rsp),%r8
+  803f57:	4c 89 c0             	mov    %r8,%rax
+  803f5a:	48 c1 e8 03          	shr    $0x3,%rax
+  803f5e:	49 83 e0 f8          	and    $0xfffffffffffffff8,%r8
+    argv[0] = arg0;
+  803f62:	48 89 34 c5 00 00 00 	mov    %rsi,0x0(,%rax,8)
+  803f69:	00 
+    argv[argc + 1] = NULL;
+  803f6a:	8d 41 01             	lea    0x1(%rcx),%eax
+  803f6d:	48 98                	cltq
+  803f6f:	49 c7 04 c0 00 00 00 	movq   $0x0,(%r8,%rax,8)
+  803f76:	00 
+    va_start(vl, arg0);
+  803f77:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803f7e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803f82:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803f86:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803f8a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    for (i = 0; i < argc; i++) {
+  803f8e:	85 c9                	test   %ecx,%ecx
+  803f90:	74 41                	je     803fd3 <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  803f92:	49 89 c1             	mov    %rax,%r9
+  803f95:	49 8d 40 08          	lea    0x8(%r8),%rax
+  803f99:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  803f9c:	49 8d 74 d0 10       	lea    0x10(%r8,%rdx,8),%rsi
+  803fa1:	eb 1b                	jmp    803fbe <spawnl+0xe4>
+  803fa3:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803fa7:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  803fab:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  803faf:	48 8b 11             	mov    (%rcx),%rdx
+  803fb2:	48 89 10             	mov    %rdx,(%rax)
+    for (i = 0; i < argc; i++) {
+  803fb5:	48 83 c0 08          	add    $0x8,%rax
+  803fb9:	48 39 f0             	cmp    %rsi,%rax
+  803fbc:	74 15                	je     803fd3 <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  803fbe:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803fc1:	83 fa 2f             	cmp    $0x2f,%edx
+  803fc4:	77 dd                	ja     803fa3 <spawnl+0xc9>
+  803fc6:	89 d1                	mov    %edx,%ecx
+  803fc8:	4c 01 c9             	add    %r9,%rcx
+  803fcb:	83 c2 08             	add    $0x8,%edx
+  803fce:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  803fd1:	eb dc                	jmp    803faf <spawnl+0xd5>
+    return spawn(prog, argv);
+  803fd3:	4c 89 c6             	mov    %r8,%rsi
+  803fd6:	48 b8 7f 37 80 00 00 	movabs $0x80377f,%rax
+  803fdd:	00 00 00 
+  803fe0:	ff d0                	call   *%rax
+}
+  803fe2:	c9                   	leave
+  803fe3:	c3                   	ret
+
+0000000000803fe4 <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803fe4:	55                   	push   %rbp
+  803fe5:	48 89 e5             	mov    %rsp,%rbp
+  803fe8:	41 54                	push   %r12
+  803fea:	53                   	push   %rbx
+  803feb:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803fee:	48 b8 42 16 80 00 00 	movabs $0x801642,%rax
+  803ff5:	00 00 00 
+  803ff8:	ff d0                	call   *%rax
+  803ffa:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803ffd:	48 be ef 5b 80 00 00 	movabs $0x805bef,%rsi
+  804004:	00 00 00 
+  804007:	48 89 df             	mov    %rbx,%rdi
+  80400a:	48 b8 9e 0c 80 00 00 	movabs $0x800c9e,%rax
+  804011:	00 00 00 
+  804014:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  804016:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80401b:	41 2b 04 24          	sub    (%r12),%eax
+  80401f:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  804025:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80402c:	00 00 00 
+    stat->st_dev = &devpipe;
+  80402f:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  804036:	00 00 00 
+  804039:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  804040:	b8 00 00 00 00       	mov    $0x0,%eax
+  804045:	5b                   	pop    %rbx
+  804046:	41 5c                	pop    %r12
+  804048:	5d                   	pop    %rbp
+  804049:	c3                   	ret
+
+000000000080404a <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  80404a:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  80404d:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  804053:	8b 17                	mov    (%rdi),%edx
+  804055:	85 d2                	test   %edx,%edx
+  804057:	75 01                	jne    80405a <pipe_wakeup+0x10>
+  804059:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  80405a:	55                   	push   %rbp
+  80405b:	48 89 e5             	mov    %rsp,%rbp
+  80405e:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  804061:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  804067:	be 00 04 00 00       	mov    $0x400,%esi
+  80406c:	48 b8 89 15 80 00 00 	movabs $0x801589,%rax
+  804073:	00 00 00 
+  804076:	ff d0                	call   *%rax
+}
+  804078:	5d                   	pop    %rbp
+  804079:	c3                   	ret
+
+000000000080407a <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80407a:	55                   	push   %rbp
+  80407b:	48 89 e5             	mov    %rsp,%rbp
+  80407e:	41 55                	push   %r13
+  804080:	41 54                	push   %r12
+  804082:	53                   	push   %rbx
+  804083:	48 83 ec 08          	sub    $0x8,%rsp
+  804087:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80408a:	48 b8 42 16 80 00 00 	movabs $0x801642,%rax
+  804091:	00 00 00 
+  804094:	ff d0                	call   *%rax
+  804096:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  804099:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80409e:	4c 89 e6             	mov    %r12,%rsi
+  8040a1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040a6:	49 bc a3 12 80 00 00 	movabs $0x8012a3,%r12
+  8040ad:	00 00 00 
+  8040b0:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8040b3:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  8040b7:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  8040bb:	49 bd 4a 40 80 00 00 	movabs $0x80404a,%r13
+  8040c2:	00 00 00 
+  8040c5:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  8040c8:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  8040cc:	48 89 de             	mov    %rbx,%rsi
+  8040cf:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  8040d2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8040d7:	48 89 de             	mov    %rbx,%rsi
+  8040da:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040df:	41 ff d4             	call   *%r12
+  8040e2:	48 83 c4 08          	add    $0x8,%rsp
+  8040e6:	5b                   	pop    %rbx
+  8040e7:	41 5c                	pop    %r12
+  8040e9:	41 5d                	pop    %r13
+  8040eb:	5d                   	pop    %rbp
+  8040ec:	c3                   	ret
+
+00000000008040ed <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  8040ed:	55                   	push   %rbp
+  8040ee:	48 89 e5             	mov    %rsp,%rbp
+  8040f1:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8040f4:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8040f9:	be 00 10 00 00       	mov    $0x1000,%esi
+  8040fe:	48 b8 e6 11 80 00 00 	movabs $0x8011e6,%rax
+  804105:	00 00 00 
+  804108:	ff d0                	call   *%rax
+  80410a:	85 c0                	test   %eax,%eax
+  80410c:	0f 94 c0             	sete   %al
+  80410f:	0f b6 c0             	movzbl %al,%eax
+}
+  804112:	5d                   	pop    %rbp
+  804113:	c3                   	ret
+
+0000000000804114 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804114:	55                   	push   %rbp
+  804115:	48 89 e5             	mov    %rsp,%rbp
+  804118:	41 57                	push   %r15
+  80411a:	41 56                	push   %r14
+  80411c:	41 55                	push   %r13
+  80411e:	41 54                	push   %r12
+  804120:	53                   	push   %rbx
+  804121:	48 83 ec 38          	sub    $0x38,%rsp
+  804125:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  804129:	49 89 f4             	mov    %rsi,%r12
+  80412c:	49 89 d7             	mov    %rdx,%r15
+  80412f:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804133:	48 b8 42 16 80 00 00 	movabs $0x801642,%rax
+  80413a:	00 00 00 
+  80413d:	ff d0                	call   *%rax
+  80413f:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  804142:	4d 85 ff             	test   %r15,%r15
+  804145:	0f 84 f1 00 00 00    	je     80423c <devpipe_write+0x128>
+  80414b:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  80414f:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  804153:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  804157:	49 bd ed 40 80 00 00 	movabs $0x8040ed,%r13
+  80415e:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  804161:	49 bf 4a 40 80 00 00 	movabs $0x80404a,%r15
+  804168:	00 00 00 
+  80416b:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  80416f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804173:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804177:	8b 73 04             	mov    0x4(%rbx),%esi
+  80417a:	48 63 ce             	movslq %esi,%rcx
+  80417d:	48 63 03             	movslq (%rbx),%rax
+  804180:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  804186:	48 39 c1             	cmp    %rax,%rcx
+  804189:	72 64                	jb     8041ef <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  80418b:	48 89 de             	mov    %rbx,%rsi
+  80418e:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  804192:	41 ff d5             	call   *%r13
+  804195:	85 c0                	test   %eax,%eax
+  804197:	0f 85 b9 00 00 00    	jne    804256 <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  80419d:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8041a1:	4c 89 f7             	mov    %r14,%rdi
+  8041a4:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  8041a7:	8b 43 04             	mov    0x4(%rbx),%eax
+  8041aa:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  8041b1:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8041b8:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  8041be:	8b 03                	mov    (%rbx),%eax
+  8041c0:	41 39 c4             	cmp    %eax,%r12d
+  8041c3:	75 b2                	jne    804177 <devpipe_write+0x63>
+  8041c5:	48 89 de             	mov    %rbx,%rsi
+  8041c8:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8041cc:	41 ff d5             	call   *%r13
+  8041cf:	85 c0                	test   %eax,%eax
+  8041d1:	75 a0                	jne    804173 <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  8041d3:	ba 0a 00 00 00       	mov    $0xa,%edx
+  8041d8:	44 89 e6             	mov    %r12d,%esi
+  8041db:	48 89 df             	mov    %rbx,%rdi
+  8041de:	48 b8 6b 15 80 00 00 	movabs $0x80156b,%rax
+  8041e5:	00 00 00 
+  8041e8:	ff d0                	call   *%rax
+  8041ea:	e9 7c ff ff ff       	jmp    80416b <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8041ef:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  8041f3:	41 0f b6 38          	movzbl (%r8),%edi
+  8041f7:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  8041fe:	80 80 80 
+  804201:	48 89 c8             	mov    %rcx,%rax
+  804204:	48 f7 e2             	mul    %rdx
+  804207:	48 c1 ea 0b          	shr    $0xb,%rdx
+  80420b:	48 89 d0             	mov    %rdx,%rax
+  80420e:	48 c1 e0 08          	shl    $0x8,%rax
+  804212:	48 29 d0             	sub    %rdx,%rax
+  804215:	48 c1 e0 04          	shl    $0x4,%rax
+  804219:	48 29 c1             	sub    %rax,%rcx
+  80421c:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  804221:	83 c6 01             	add    $0x1,%esi
+  804224:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  804227:	49 83 c0 01          	add    $0x1,%r8
+  80422b:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  80422f:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804233:	49 39 c0             	cmp    %rax,%r8
+  804236:	0f 85 2f ff ff ff    	jne    80416b <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  80423c:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  804240:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  804244:	48 b8 4a 40 80 00 00 	movabs $0x80404a,%rax
+  80424b:	00 00 00 
+  80424e:	ff d0                	call   *%rax
+    return n;
+  804250:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804254:	eb 05                	jmp    80425b <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  804256:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80425b:	48 83 c4 38          	add    $0x38,%rsp
+  80425f:	5b                   	pop    %rbx
+  804260:	41 5c                	pop    %r12
+  804262:	41 5d                	pop    %r13
+  804264:	41 5e                	pop    %r14
+  804266:	41 5f                	pop    %r15
+  804268:	5d                   	pop    %rbp
+  804269:	c3                   	ret
+
+000000000080426a <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80426a:	55                   	push   %rbp
+  80426b:	48 89 e5             	mov    %rsp,%rbp
+  80426e:	41 57                	push   %r15
+  804270:	41 56                	push   %r14
+  804272:	41 55                	push   %r13
+  804274:	41 54                	push   %r12
+  804276:	53                   	push   %rbx
+  804277:	48 83 ec 28          	sub    $0x28,%rsp
+  80427b:	49 89 fd             	mov    %rdi,%r13
+  80427e:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  804282:	49 89 d4             	mov    %rdx,%r12
+  804285:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804289:	48 b8 42 16 80 00 00 	movabs $0x801642,%rax
+  804290:	00 00 00 
+  804293:	ff d0                	call   *%rax
+  804295:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  804298:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  80429e:	49 bf ed 40 80 00 00 	movabs $0x8040ed,%r15
+  8042a5:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8042a8:	4d 85 e4             	test   %r12,%r12
+  8042ab:	0f 84 d5 00 00 00    	je     804386 <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  8042b1:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  8042b5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8042b9:	8b 03                	mov    (%rbx),%eax
+  8042bb:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8042be:	75 7a                	jne    80433a <devpipe_read+0xd0>
+            if (i > 0) {
+  8042c0:	4d 85 f6             	test   %r14,%r14
+  8042c3:	75 50                	jne    804315 <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  8042c5:	48 89 de             	mov    %rbx,%rsi
+  8042c8:	4c 89 ef             	mov    %r13,%rdi
+  8042cb:	41 ff d7             	call   *%r15
+  8042ce:	85 c0                	test   %eax,%eax
+  8042d0:	0f 85 c9 00 00 00    	jne    80439f <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  8042d6:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  8042d9:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8042e0:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  8042e6:	8b 43 04             	mov    0x4(%rbx),%eax
+  8042e9:	41 39 c4             	cmp    %eax,%r12d
+  8042ec:	75 cb                	jne    8042b9 <devpipe_read+0x4f>
+  8042ee:	48 89 de             	mov    %rbx,%rsi
+  8042f1:	4c 89 ef             	mov    %r13,%rdi
+  8042f4:	41 ff d7             	call   *%r15
+  8042f7:	85 c0                	test   %eax,%eax
+  8042f9:	75 be                	jne    8042b9 <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  8042fb:	ba 0a 00 00 00       	mov    $0xa,%edx
+  804300:	44 89 e6             	mov    %r12d,%esi
+  804303:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  804307:	48 b8 6b 15 80 00 00 	movabs $0x80156b,%rax
+  80430e:	00 00 00 
+  804311:	ff d0                	call   *%rax
+  804313:	eb a4                	jmp    8042b9 <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  804315:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  804319:	48 89 de             	mov    %rbx,%rsi
+  80431c:	48 b8 4a 40 80 00 00 	movabs $0x80404a,%rax
+  804323:	00 00 00 
+  804326:	ff d0                	call   *%rax
+                return i;
+  804328:	4c 89 f0             	mov    %r14,%rax
+}
+  80432b:	48 83 c4 28          	add    $0x28,%rsp
+  80432f:	5b                   	pop    %rbx
+  804330:	41 5c                	pop    %r12
+  804332:	41 5d                	pop    %r13
+  804334:	41 5e                	pop    %r14
+  804336:	41 5f                	pop    %r15
+  804338:	5d                   	pop    %rbp
+  804339:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80433a:	48 63 c8             	movslq %eax,%rcx
+  80433d:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  804344:	80 80 80 
+  804347:	48 89 c8             	mov    %rcx,%rax
+  80434a:	48 f7 e2             	mul    %rdx
+  80434d:	48 c1 ea 0b          	shr    $0xb,%rdx
+  804351:	48 89 d0             	mov    %rdx,%rax
+  804354:	48 c1 e0 08          	shl    $0x8,%rax
+  804358:	48 29 d0             	sub    %rdx,%rax
+  80435b:	48 c1 e0 04          	shl    $0x4,%rax
+  80435f:	48 89 c2             	mov    %rax,%rdx
+  804362:	48 89 c8             	mov    %rcx,%rax
+  804365:	48 29 d0             	sub    %rdx,%rax
+  804368:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  80436d:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804371:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  804375:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  804378:	49 83 c6 01          	add    $0x1,%r14
+  80437c:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  804380:	0f 85 2b ff ff ff    	jne    8042b1 <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  804386:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  80438a:	48 89 de             	mov    %rbx,%rsi
+  80438d:	48 b8 4a 40 80 00 00 	movabs $0x80404a,%rax
+  804394:	00 00 00 
+  804397:	ff d0                	call   *%rax
+    return n;
+  804399:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80439d:	eb 8c                	jmp    80432b <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  80439f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043a4:	eb 85                	jmp    80432b <devpipe_read+0xc1>
+
+00000000008043a6 <pipe>:
+pipe(int pfd[2]) {
+  8043a6:	55                   	push   %rbp
+  8043a7:	48 89 e5             	mov    %rsp,%rbp
+  8043aa:	41 55                	push   %r13
+  8043ac:	41 54                	push   %r12
+  8043ae:	53                   	push   %rbx
+  8043af:	48 83 ec 18          	sub    $0x18,%rsp
+  8043b3:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8043b6:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8043ba:	48 b8 5e 16 80 00 00 	movabs $0x80165e,%rax
+  8043c1:	00 00 00 
+  8043c4:	ff d0                	call   *%rax
+  8043c6:	89 c3                	mov    %eax,%ebx
+  8043c8:	85 c0                	test   %eax,%eax
+  8043ca:	0f 88 a0 01 00 00    	js     804570 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8043d0:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8043d5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8043da:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8043de:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043e3:	48 b8 fd 11 80 00 00 	movabs $0x8011fd,%rax
+  8043ea:	00 00 00 
+  8043ed:	ff d0                	call   *%rax
+  8043ef:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8043f1:	85 c0                	test   %eax,%eax
+  8043f3:	0f 88 77 01 00 00    	js     804570 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8043f9:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8043fd:	48 b8 5e 16 80 00 00 	movabs $0x80165e,%rax
+  804404:	00 00 00 
+  804407:	ff d0                	call   *%rax
+  804409:	89 c3                	mov    %eax,%ebx
+  80440b:	85 c0                	test   %eax,%eax
+  80440d:	0f 88 43 01 00 00    	js     804556 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  804413:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804418:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80441d:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804421:	bf 00 00 00 00       	mov    $0x0,%edi
+  804426:	48 b8 fd 11 80 00 00 	movabs $0x8011fd,%rax
+  80442d:	00 00 00 
+  804430:	ff d0                	call   *%rax
+  804432:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804434:	85 c0                	test   %eax,%eax
+  804436:	0f 88 1a 01 00 00    	js     804556 <pipe+0x1b0>
+    va = fd2data(fd0);
+  80443c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804440:	48 b8 42 16 80 00 00 	movabs $0x801642,%rax
+  804447:	00 00 00 
+  80444a:	ff d0                	call   *%rax
+  80444c:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80444f:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804454:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804459:	48 89 c6             	mov    %rax,%rsi
+  80445c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804461:	48 b8 fd 11 80 00 00 	movabs $0x8011fd,%rax
+  804468:	00 00 00 
+  80446b:	ff d0                	call   *%rax
+  80446d:	89 c3                	mov    %eax,%ebx
+  80446f:	85 c0                	test   %eax,%eax
+  804471:	0f 88 c5 00 00 00    	js     80453c <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  804477:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80447b:	48 b8 42 16 80 00 00 	movabs $0x801642,%rax
+  804482:	00 00 00 
+  804485:	ff d0                	call   *%rax
+  804487:	48 89 c1             	mov    %rax,%rcx
+  80448a:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  804490:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804496:	ba 00 00 00 00       	mov    $0x0,%edx
+  80449b:	4c 89 ee             	mov    %r13,%rsi
+  80449e:	bf 00 00 00 00       	mov    $0x0,%edi
+  8044a3:	48 b8 53 12 80 00 00 	movabs $0x801253,%rax
+  8044aa:	00 00 00 
+  8044ad:	ff d0                	call   *%rax
+  8044af:	89 c3                	mov    %eax,%ebx
+  8044b1:	85 c0                	test   %eax,%eax
+  8044b3:	78 6e                	js     804523 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8044b5:	be 00 10 00 00       	mov    $0x1000,%esi
+  8044ba:	4c 89 ef             	mov    %r13,%rdi
+  8044bd:	48 b8 c2 11 80 00 00 	movabs $0x8011c2,%rax
+  8044c4:	00 00 00 
+  8044c7:	ff d0                	call   *%rax
+  8044c9:	83 f8 02             	cmp    $0x2,%eax
+  8044cc:	0f 85 ab 00 00 00    	jne    80457d <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8044d2:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  8044d9:	00 00 
+  8044db:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8044df:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8044e1:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8044e5:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8044ec:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8044f0:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8044f2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8044f6:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8044fd:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804501:	48 bb 30 16 80 00 00 	movabs $0x801630,%rbx
+  804508:	00 00 00 
+  80450b:	ff d3                	call   *%rbx
+  80450d:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  804511:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804515:	ff d3                	call   *%rbx
+  804517:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80451c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804521:	eb 4d                	jmp    804570 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  804523:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804528:	4c 89 ee             	mov    %r13,%rsi
+  80452b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804530:	48 b8 a3 12 80 00 00 	movabs $0x8012a3,%rax
+  804537:	00 00 00 
+  80453a:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80453c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804541:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804545:	bf 00 00 00 00       	mov    $0x0,%edi
+  80454a:	48 b8 a3 12 80 00 00 	movabs $0x8012a3,%rax
+  804551:	00 00 00 
+  804554:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  804556:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80455b:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80455f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804564:	48 b8 a3 12 80 00 00 	movabs $0x8012a3,%rax
+  80456b:	00 00 00 
+  80456e:	ff d0                	call   *%rax
+}
+  804570:	89 d8                	mov    %ebx,%eax
+  804572:	48 83 c4 18          	add    $0x18,%rsp
+  804576:	5b                   	pop    %rbx
+  804577:	41 5c                	pop    %r12
+  804579:	41 5d                	pop    %r13
+  80457b:	5d                   	pop    %rbp
+  80457c:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80457d:	48 b9 08 5c 80 00 00 	movabs $0x805c08,%rcx
+  804584:	00 00 00 
+  804587:	48 ba b1 5b 80 00 00 	movabs $0x805bb1,%rdx
+  80458e:	00 00 00 
+  804591:	be 50 00 00 00       	mov    $0x50,%esi
+  804596:	48 bf f6 5b 80 00 00 	movabs $0x805bf6,%rdi
+  80459d:	00 00 00 
+  8045a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045a5:	49 b8 29 02 80 00 00 	movabs $0x800229,%r8
+  8045ac:	00 00 00 
+  8045af:	41 ff d0             	call   *%r8
+
+00000000008045b2 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8045b2:	55                   	push   %rbp
+  8045b3:	48 89 e5             	mov    %rsp,%rbp
+  8045b6:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8045ba:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8045be:	48 b8 be 16 80 00 00 	movabs $0x8016be,%rax
+  8045c5:	00 00 00 
+  8045c8:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8045ca:	85 c0                	test   %eax,%eax
+  8045cc:	78 23                	js     8045f1 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8045ce:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8045d2:	48 b8 42 16 80 00 00 	movabs $0x801642,%rax
+  8045d9:	00 00 00 
+  8045dc:	ff d0                	call   *%rax
+  8045de:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  8045e1:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8045e5:	48 b8 ed 40 80 00 00 	movabs $0x8040ed,%rax
+  8045ec:	00 00 00 
+  8045ef:	ff d0                	call   *%rax
+}
+  8045f1:	c9                   	leave
+  8045f2:	c3                   	ret
+
+00000000008045f3 <wait>:
+#include <inc/lib.h>
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  8045f3:	55                   	push   %rbp
+  8045f4:	48 89 e5             	mov    %rsp,%rbp
+  8045f7:	41 56                	push   %r14
+  8045f9:	41 55                	push   %r13
+  8045fb:	41 54                	push   %r12
+  8045fd:	53                   	push   %rbx
+    assert(envid != 0);
+  8045fe:	85 ff                	test   %edi,%edi
+  804600:	0f 84 b7 00 00 00    	je     8046bd <wait+0xca>
+  804606:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  804609:	89 f9                	mov    %edi,%ecx
+  80460b:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+
+    for (;;) {
+        uint32_t seq = env->env_wait_seq;
+  804611:	48 bf 00 00 c0 1f 80 	movabs $0x801fc00000,%rdi
+  804618:	00 00 00 
+  80461b:	45 89 e0             	mov    %r12d,%r8d
+  80461e:	41 81 e0 ff 03 00 00 	and    $0x3ff,%r8d
+  804625:	4c 89 c0             	mov    %r8,%rax
+  804628:	48 c1 e0 04          	shl    $0x4,%rax
+  80462c:	48 89 c2             	mov    %rax,%rdx
+  80462f:	4c 29 c2             	sub    %r8,%rdx
+  804632:	48 c1 e2 05          	shl    $0x5,%rdx
+  804636:	48 01 fa             	add    %rdi,%rdx
+  804639:	8b b2 b8 01 00 00    	mov    0x1b8(%rdx),%esi
+        if (env->env_id != envid || env->env_status == ENV_FREE) break;
+  80463f:	8b 82 c8 00 00 00    	mov    0xc8(%rdx),%eax
+  804645:	41 39 c4             	cmp    %eax,%r12d
+  804648:	75 6a                	jne    8046b4 <wait+0xc1>
+
+        /* The kernel wakes us up when the environment is freed */
+        sys_futex_wait(&env->env_wait_seq, seq, 0);
+  80464a:	48 63 d1             	movslq %ecx,%rdx
+  80464d:	48 89 d0             	mov    %rdx,%rax
+  804650:	48 c1 e0 04          	shl    $0x4,%rax
+  804654:	48 29 d0             	sub    %rdx,%rax
+  804657:	48 c1 e0 05          	shl    $0x5,%rax
+  80465b:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804662:	00 00 00 
+  804665:	4c 8d b4 02 b8 01 00 	lea    0x1b8(%rdx,%rax,1),%r14
+  80466c:	00 
+        if (env->env_id != envid || env->env_status == ENV_FREE) break;
+  80466d:	48 63 c9             	movslq %ecx,%rcx
+  804670:	48 89 c8             	mov    %rcx,%rax
+  804673:	48 c1 e0 04          	shl    $0x4,%rax
+  804677:	48 29 c8             	sub    %rcx,%rax
+  80467a:	48 c1 e0 05          	shl    $0x5,%rax
+  80467e:	48 89 d3             	mov    %rdx,%rbx
+  804681:	48 01 c3             	add    %rax,%rbx
+        sys_futex_wait(&env->env_wait_seq, seq, 0);
+  804684:	49 bd 6b 15 80 00 00 	movabs $0x80156b,%r13
+  80468b:	00 00 00 
+        if (env->env_id != envid || env->env_status == ENV_FREE) break;
+  80468e:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+  804694:	85 c0                	test   %eax,%eax
+  804696:	74 1c                	je     8046b4 <wait+0xc1>
+        sys_futex_wait(&env->env_wait_seq, seq, 0);
+  804698:	ba 00 00 00 00       	mov    $0x0,%edx
+  80469d:	4c 89 f7             	mov    %r14,%rdi
+  8046a0:	41 ff d5             	call   *%r13
+        uint32_t seq = env->env_wait_seq;
+  8046a3:	8b b3 b8 01 00 00    	mov    0x1b8(%rbx),%esi
+        if (env->env_id != envid || env->env_status == ENV_FREE) break;
+  8046a9:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  8046af:	44 39 e0             	cmp    %r12d,%eax
+  8046b2:	74 da                	je     80468e <wait+0x9b>
+    }
+}
+  8046b4:	5b                   	pop    %rbx
+  8046b5:	41 5c                	pop    %r12
+  8046b7:	41 5d                	pop    %r13
+  8046b9:	41 5e                	pop    %r14
+  8046bb:	5d                   	pop    %rbp
+  8046bc:	c3                   	ret
+    assert(envid != 0);
+  8046bd:	48 b9 2c 5c 80 00 00 	movabs $0x805c2c,%rcx
+  8046c4:	00 00 00 
+  8046c7:	48 ba b1 5b 80 00 00 	movabs $0x805bb1,%rdx
+  8046ce:	00 00 00 
+  8046d1:	be 06 00 00 00       	mov    $0x6,%esi
+  8046d6:	48 bf 37 5c 80 00 00 	movabs $0x805c37,%rdi
+  8046dd:	00 00 00 
+  8046e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046e5:	49 b8 29 02 80 00 00 	movabs $0x800229,%r8
+  8046ec:	00 00 00 
+  8046ef:	41 ff d0             	call   *%r8
+
+00000000008046f2 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8046f2:	48 89 f8             	mov    %rdi,%rax
+  8046f5:	48 c1 e8 27          	shr    $0x27,%rax
+  8046f9:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804700:	01 00 00 
+  804703:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804707:	f6 c2 01             	test   $0x1,%dl
+  80470a:	74 6d                	je     804779 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80470c:	48 89 f8             	mov    %rdi,%rax
+  80470f:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804713:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80471a:	01 00 00 
+  80471d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804721:	f6 c2 01             	test   $0x1,%dl
+  804724:	74 62                	je     804788 <get_uvpt_entry+0x96>
+  804726:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80472d:	01 00 00 
+  804730:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804734:	f6 c2 80             	test   $0x80,%dl
+  804737:	75 4f                	jne    804788 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804739:	48 89 f8             	mov    %rdi,%rax
+  80473c:	48 c1 e8 15          	shr    $0x15,%rax
+  804740:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804747:	01 00 00 
+  80474a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80474e:	f6 c2 01             	test   $0x1,%dl
+  804751:	74 44                	je     804797 <get_uvpt_entry+0xa5>
+  804753:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80475a:	01 00 00 
+  80475d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804761:	f6 c2 80             	test   $0x80,%dl
+  804764:	75 31                	jne    804797 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  804766:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80476a:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804771:	01 00 00 
+  804774:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  804778:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804779:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804780:	01 00 00 
+  804783:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804787:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804788:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80478f:	01 00 00 
+  804792:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804796:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804797:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80479e:	01 00 00 
+  8047a1:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8047a5:	c3                   	ret
+
+00000000008047a6 <get_prot>:
+
+int
+get_prot(void *va) {
+  8047a6:	55                   	push   %rbp
+  8047a7:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8047aa:	48 b8 f2 46 80 00 00 	movabs $0x8046f2,%rax
+  8047b1:	00 00 00 
+  8047b4:	ff d0                	call   *%rax
+  8047b6:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8047b9:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8047be:	89 c1                	mov    %eax,%ecx
+  8047c0:	83 c9 04             	or     $0x4,%ecx
+  8047c3:	f6 c2 01             	test   $0x1,%dl
+  8047c6:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8047c9:	89 c1                	mov    %eax,%ecx
+  8047cb:	83 c9 02             	or     $0x2,%ecx
+  8047ce:	f6 c2 02             	test   $0x2,%dl
+  8047d1:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8047d4:	89 c1                	mov    %eax,%ecx
+  8047d6:	83 c9 01             	or     $0x1,%ecx
+  8047d9:	48 85 d2             	test   %rdx,%rdx
+  8047dc:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8047df:	89 c1                	mov    %eax,%ecx
+  8047e1:	83 c9 40             	or     $0x40,%ecx
+  8047e4:	f6 c6 04             	test   $0x4,%dh
+  8047e7:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8047ea:	5d                   	pop    %rbp
+  8047eb:	c3                   	ret
+
+00000000008047ec <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8047ec:	55                   	push   %rbp
+  8047ed:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8047f0:	48 b8 f2 46 80 00 00 	movabs $0x8046f2,%rax
+  8047f7:	00 00 00 
+  8047fa:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8047fc:	48 c1 e8 06          	shr    $0x6,%rax
+  804800:	83 e0 01             	and    $0x1,%eax
+}
+  804803:	5d                   	pop    %rbp
+  804804:	c3                   	ret
+
+0000000000804805 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804805:	55                   	push   %rbp
+  804806:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804809:	48 b8 f2 46 80 00 00 	movabs $0x8046f2,%rax
+  804810:	00 00 00 
+  804813:	ff d0                	call   *%rax
+  804815:	83 e0 01             	and    $0x1,%eax
+}
+  804818:	5d                   	pop    %rbp
+  804819:	c3                   	ret
+
+000000000080481a <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  80481a:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  804821:	01 00 00 
+  804824:	a8 01                	test   $0x1,%al
+  804826:	75 06                	jne    80482e <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  804828:	b8 00 00 00 00       	mov    $0x0,%eax
+  80482d:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80482e:	55                   	push   %rbp
+  80482f:	48 89 e5             	mov    %rsp,%rbp
+  804832:	41 57                	push   %r15
+  804834:	41 56                	push   %r14
+  804836:	41 55                	push   %r13
+  804838:	41 54                	push   %r12
+  80483a:	53                   	push   %rbx
+  80483b:	48 83 ec 28          	sub    $0x28,%rsp
+  80483f:	49 89 fe             	mov    %rdi,%r14
+  804842:	49 89 f7             	mov    %rsi,%r15
+  804845:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  80484c:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  80484d:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  804854:	01 00 00 
+  804857:	e9 ae 00 00 00       	jmp    80490a <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  80485c:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804863:	49 83 ec 01          	sub    $0x1,%r12
+  804867:	74 2d                	je     804896 <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  804869:	48 89 d8             	mov    %rbx,%rax
+  80486c:	48 c1 e8 0c          	shr    $0xc,%rax
+  804870:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  804875:	f6 c2 01             	test   $0x1,%dl
+  804878:	74 e2                	je     80485c <foreach_shared_region+0x42>
+  80487a:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  80487f:	f6 c4 04             	test   $0x4,%ah
+  804882:	74 d8                	je     80485c <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  804884:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  80488b:	4c 89 fa             	mov    %r15,%rdx
+  80488e:	48 89 df             	mov    %rbx,%rdi
+  804891:	41 ff d6             	call   *%r14
+  804894:	eb c6                	jmp    80485c <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  804896:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  80489d:	00 
+  80489e:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  8048a3:	74 4a                	je     8048ef <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  8048a5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8048a9:	48 c1 e8 15          	shr    $0x15,%rax
+  8048ad:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  8048b4:	01 00 00 
+  8048b7:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  8048bb:	a8 01                	test   $0x1,%al
+  8048bd:	74 d7                	je     804896 <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  8048bf:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  8048c3:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  8048ca:	48 39 c3             	cmp    %rax,%rbx
+  8048cd:	73 c7                	jae    804896 <foreach_shared_region+0x7c>
+  8048cf:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  8048d6:	48 39 d0             	cmp    %rdx,%rax
+  8048d9:	4d 19 e4             	sbb    %r12,%r12
+  8048dc:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  8048e3:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  8048ea:	e9 7a ff ff ff       	jmp    804869 <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  8048ef:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  8048f6:	40 
+  8048f7:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8048fb:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804902:	00 00 00 
+  804905:	48 39 c1             	cmp    %rax,%rcx
+  804908:	74 50                	je     80495a <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  80490a:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80490e:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804912:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  804919:	01 00 00 
+  80491c:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804920:	a8 01                	test   $0x1,%al
+  804922:	74 cb                	je     8048ef <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  804924:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804928:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  80492f:	48 39 c1             	cmp    %rax,%rcx
+  804932:	73 bb                	jae    8048ef <foreach_shared_region+0xd5>
+  804934:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  80493b:	48 39 d0             	cmp    %rdx,%rax
+  80493e:	48 19 c0             	sbb    %rax,%rax
+  804941:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  804947:	48 05 00 02 00 00    	add    $0x200,%rax
+  80494d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804951:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  804955:	e9 4b ff ff ff       	jmp    8048a5 <foreach_shared_region+0x8b>
+  80495a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80495f:	48 83 c4 28          	add    $0x28,%rsp
+  804963:	5b                   	pop    %rbx
+  804964:	41 5c                	pop    %r12
+  804966:	41 5d                	pop    %r13
+  804968:	41 5e                	pop    %r14
+  80496a:	41 5f                	pop    %r15
+  80496c:	5d                   	pop    %rbp
+  80496d:	c3                   	ret
+
+000000000080496e <ring_enter>:
+    }
+}
+#endif
+
+static int
+ring_enter(void) {
+  80496e:	55                   	push   %rbp
+  80496f:	48 89 e5             	mov    %rsp,%rbp
+    int res;
+
+    /* Forked children inherit the ring but not its registration */
+    if (thisenv->env_sc_ring != &ring &&
+  804972:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804979:	00 00 00 
+  80497c:	48 8b 90 c0 01 00 00 	mov    0x1c0(%rax),%rdx
+  804983:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  80498a:	00 00 00 
+  80498d:	48 39 c2             	cmp    %rax,%rdx
+  804990:	74 13                	je     8049a5 <ring_enter+0x37>
+        (res = sys_ring_register(&ring)) < 0) goto out;
+  804992:	48 89 c7             	mov    %rax,%rdi
+  804995:	48 b8 e2 14 80 00 00 	movabs $0x8014e2,%rax
+  80499c:	00 00 00 
+  80499f:	ff d0                	call   *%rax
+    if (thisenv->env_sc_ring != &ring &&
+  8049a1:	85 c0                	test   %eax,%eax
+  8049a3:	78 0c                	js     8049b1 <ring_enter+0x43>
+
+#ifdef SANITIZE_USER_SHADOW_BASE
+    uint32_t head = ring.sr_head;
+#endif
+
+    res = sys_ring_enter();
+  8049a5:	48 b8 42 15 80 00 00 	movabs $0x801542,%rax
+  8049ac:	00 00 00 
+  8049af:	ff d0                	call   *%rax
+    }
+#endif
+
+out:
+    /* Calls queued after the failed one are dropped */
+    ring.sr_tail = ring.sr_head;
+  8049b1:	48 ba 40 10 84 00 00 	movabs $0x841040,%rdx
+  8049b8:	00 00 00 
+  8049bb:	8b 0a                	mov    (%rdx),%ecx
+  8049bd:	89 4a 04             	mov    %ecx,0x4(%rdx)
+    return res;
+}
+  8049c0:	5d                   	pop    %rbp
+  8049c1:	c3                   	ret
+
+00000000008049c2 <scring_push>:
+
+/* Queue system call num, the ring is submitted
+ * automatically when it is full. Errors are reported
+ * by scring_submit(), calls queued after an error are dropped */
+void
+scring_push(uintptr_t num, uintptr_t a1, uintptr_t a2, uintptr_t a3, uintptr_t a4, uintptr_t a5, uintptr_t a6) {
+  8049c2:	55                   	push   %rbp
+  8049c3:	48 89 e5             	mov    %rsp,%rbp
+  8049c6:	41 57                	push   %r15
+  8049c8:	41 56                	push   %r14
+  8049ca:	41 55                	push   %r13
+  8049cc:	41 54                	push   %r12
+  8049ce:	53                   	push   %rbx
+  8049cf:	48 83 ec 18          	sub    $0x18,%rsp
+  8049d3:	4c 89 4d c8          	mov    %r9,-0x38(%rbp)
+    if (pending_error) return;
+  8049d7:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  8049de:	00 00 00 
+  8049e1:	83 38 00             	cmpl   $0x0,(%rax)
+  8049e4:	75 69                	jne    804a4f <scring_push+0x8d>
+  8049e6:	49 89 ff             	mov    %rdi,%r15
+  8049e9:	49 89 f6             	mov    %rsi,%r14
+  8049ec:	49 89 d5             	mov    %rdx,%r13
+  8049ef:	49 89 cc             	mov    %rcx,%r12
+  8049f2:	4c 89 c3             	mov    %r8,%rbx
+    if (ring.sr_tail - ring.sr_head == SCRING_SIZE &&
+  8049f5:	48 ba 40 10 84 00 00 	movabs $0x841040,%rdx
+  8049fc:	00 00 00 
+  8049ff:	8b 42 04             	mov    0x4(%rdx),%eax
+  804a02:	8b 12                	mov    (%rdx),%edx
+  804a04:	29 d0                	sub    %edx,%eax
+  804a06:	83 f8 20             	cmp    $0x20,%eax
+  804a09:	74 53                	je     804a5e <scring_push+0x9c>
+        (pending_error = ring_enter()) < 0) return;
+
+    struct SyscallDesc *sd = &ring.sr_desc[ring.sr_tail % SCRING_SIZE];
+  804a0b:	48 ba 40 10 84 00 00 	movabs $0x841040,%rdx
+  804a12:	00 00 00 
+  804a15:	8b 42 04             	mov    0x4(%rdx),%eax
+    sd->sd_num = num;
+  804a18:	83 e0 1f             	and    $0x1f,%eax
+  804a1b:	48 c1 e0 06          	shl    $0x6,%rax
+  804a1f:	48 01 d0             	add    %rdx,%rax
+  804a22:	4c 89 78 08          	mov    %r15,0x8(%rax)
+    sd->sd_args[0] = a1;
+  804a26:	4c 89 70 10          	mov    %r14,0x10(%rax)
+    sd->sd_args[1] = a2;
+  804a2a:	4c 89 68 18          	mov    %r13,0x18(%rax)
+    sd->sd_args[2] = a3;
+  804a2e:	4c 89 60 20          	mov    %r12,0x20(%rax)
+    sd->sd_args[3] = a4;
+  804a32:	48 89 58 28          	mov    %rbx,0x28(%rax)
+    sd->sd_args[4] = a5;
+  804a36:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  804a3a:	48 89 58 30          	mov    %rbx,0x30(%rax)
+    sd->sd_args[5] = a6;
+  804a3e:	48 8b 4d 10          	mov    0x10(%rbp),%rcx
+  804a42:	48 89 48 38          	mov    %rcx,0x38(%rax)
+    ring.sr_tail++;
+  804a46:	8b 42 04             	mov    0x4(%rdx),%eax
+  804a49:	83 c0 01             	add    $0x1,%eax
+  804a4c:	89 42 04             	mov    %eax,0x4(%rdx)
+}
+  804a4f:	48 83 c4 18          	add    $0x18,%rsp
+  804a53:	5b                   	pop    %rbx
+  804a54:	41 5c                	pop    %r12
+  804a56:	41 5d                	pop    %r13
+  804a58:	41 5e                	pop    %r14
+  804a5a:	41 5f                	pop    %r15
+  804a5c:	5d                   	pop    %rbp
+  804a5d:	c3                   	ret
+        (pending_error = ring_enter()) < 0) return;
+  804a5e:	48 b8 6e 49 80 00 00 	movabs $0x80496e,%rax
+  804a65:	00 00 00 
+  804a68:	ff d0                	call   *%rax
+  804a6a:	a3 00 10 84 00 00 00 	movabs %eax,0x841000
+  804a71:	00 00 
+    if (ring.sr_tail - ring.sr_head == SCRING_SIZE &&
+  804a73:	85 c0                	test   %eax,%eax
+  804a75:	79 94                	jns    804a0b <scring_push+0x49>
+  804a77:	eb d6                	jmp    804a4f <scring_push+0x8d>
+
+0000000000804a79 <scring_submit>:
+
+/* Execute all queued calls.
+ * Returns 0 on success or the error of the first failed call */
+int
+scring_submit(void) {
+    int res = pending_error;
+  804a79:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  804a80:	00 00 00 
+  804a83:	8b 02                	mov    (%rdx),%eax
+    pending_error = 0;
+  804a85:	c7 02 00 00 00 00    	movl   $0x0,(%rdx)
+
+    if (res < 0)
+  804a8b:	85 c0                	test   %eax,%eax
+  804a8d:	78 14                	js     804aa3 <scring_submit+0x2a>
+        ring.sr_tail = ring.sr_head;
+    else if (ring.sr_tail != ring.sr_head)
+  804a8f:	48 ba 40 10 84 00 00 	movabs $0x841040,%rdx
+  804a96:	00 00 00 
+  804a99:	8b 4a 04             	mov    0x4(%rdx),%ecx
+  804a9c:	8b 12                	mov    (%rdx),%edx
+  804a9e:	39 d1                	cmp    %edx,%ecx
+  804aa0:	75 11                	jne    804ab3 <scring_submit+0x3a>
+        res = ring_enter();
+
+    return res;
+}
+  804aa2:	c3                   	ret
+        ring.sr_tail = ring.sr_head;
+  804aa3:	48 ba 40 10 84 00 00 	movabs $0x841040,%rdx
+  804aaa:	00 00 00 
+  804aad:	8b 0a                	mov    (%rdx),%ecx
+  804aaf:	89 4a 04             	mov    %ecx,0x4(%rdx)
+  804ab2:	c3                   	ret
+scring_submit(void) {
+  804ab3:	55                   	push   %rbp
+  804ab4:	48 89 e5             	mov    %rsp,%rbp
+        res = ring_enter();
+  804ab7:	48 b8 6e 49 80 00 00 	movabs $0x80496e,%rax
+  804abe:	00 00 00 
+  804ac1:	ff d0                	call   *%rax
+}
+  804ac3:	5d                   	pop    %rbp
+  804ac4:	c3                   	ret
+
+0000000000804ac5 <scring_discard>:
+
+/* Drop all queued calls without executing them,
+ * along with an error scring_submit() would report */
+void
+scring_discard(void) {
+    pending_error = 0;
+  804ac5:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  804acc:	00 00 00 
+  804acf:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    ring.sr_tail = ring.sr_head;
+  804ad5:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  804adc:	00 00 00 
+  804adf:	8b 10                	mov    (%rax),%edx
+  804ae1:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  804ae4:	c3                   	ret
+
+0000000000804ae5 <scring_alloc_region>:
+
+void
+scring_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  804ae5:	55                   	push   %rbp
+  804ae6:	48 89 e5             	mov    %rsp,%rbp
+  804ae9:	48 89 f0             	mov    %rsi,%rax
+    scring_push(SYS_alloc_region, envid, (uintptr_t)va, size, perm, 0, 0);
+  804aec:	48 63 f7             	movslq %edi,%rsi
+  804aef:	48 83 ec 08          	sub    $0x8,%rsp
+  804af3:	6a 00                	push   $0x0
+  804af5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804afb:	4c 63 c1             	movslq %ecx,%r8
+  804afe:	48 89 d1             	mov    %rdx,%rcx
+  804b01:	48 89 c2             	mov    %rax,%rdx
+  804b04:	bf 04 00 00 00       	mov    $0x4,%edi
+  804b09:	48 b8 c2 49 80 00 00 	movabs $0x8049c2,%rax
+  804b10:	00 00 00 
+  804b13:	ff d0                	call   *%rax
+}
+  804b15:	48 83 c4 10          	add    $0x10,%rsp
+  804b19:	c9                   	leave
+  804b1a:	c3                   	ret
+
+0000000000804b1b <scring_map_region>:
+
+void
+scring_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  804b1b:	55                   	push   %rbp
+  804b1c:	48 89 e5             	mov    %rsp,%rbp
+  804b1f:	48 89 f0             	mov    %rsi,%rax
+  804b22:	49 89 ca             	mov    %rcx,%r10
+    scring_push(SYS_map_region, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  804b25:	48 63 ca             	movslq %edx,%rcx
+  804b28:	48 63 f7             	movslq %edi,%rsi
+  804b2b:	48 83 ec 08          	sub    $0x8,%rsp
+  804b2f:	4d 63 c9             	movslq %r9d,%r9
+  804b32:	41 51                	push   %r9
+  804b34:	4d 89 c1             	mov    %r8,%r9
+  804b37:	4d 89 d0             	mov    %r10,%r8
+  804b3a:	48 89 c2             	mov    %rax,%rdx
+  804b3d:	bf 05 00 00 00       	mov    $0x5,%edi
+  804b42:	48 b8 c2 49 80 00 00 	movabs $0x8049c2,%rax
+  804b49:	00 00 00 
+  804b4c:	ff d0                	call   *%rax
+}
+  804b4e:	48 83 c4 10          	add    $0x10,%rsp
+  804b52:	c9                   	leave
+  804b53:	c3                   	ret
+
+0000000000804b54 <scring_unmap_region>:
+
+void
+scring_unmap_region(envid_t envid, void *va, size_t size) {
+  804b54:	55                   	push   %rbp
+  804b55:	48 89 e5             	mov    %rsp,%rbp
+  804b58:	48 89 f0             	mov    %rsi,%rax
+  804b5b:	48 89 d1             	mov    %rdx,%rcx
+    scring_push(SYS_unmap_region, envid, (uintptr_t)va, size, 0, 0, 0);
+  804b5e:	48 63 f7             	movslq %edi,%rsi
+  804b61:	48 83 ec 08          	sub    $0x8,%rsp
+  804b65:	6a 00                	push   $0x0
+  804b67:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804b6d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804b73:	48 89 c2             	mov    %rax,%rdx
+  804b76:	bf 06 00 00 00       	mov    $0x6,%edi
+  804b7b:	48 b8 c2 49 80 00 00 	movabs $0x8049c2,%rax
+  804b82:	00 00 00 
+  804b85:	ff d0                	call   *%rax
+}
+  804b87:	48 83 c4 10          	add    $0x10,%rsp
+  804b8b:	c9                   	leave
+  804b8c:	c3                   	ret
+
+0000000000804b8d <scring_env_set_status>:
+
+void
+scring_env_set_status(envid_t envid, int status) {
+  804b8d:	55                   	push   %rbp
+  804b8e:	48 89 e5             	mov    %rsp,%rbp
+    scring_push(SYS_env_set_status, envid, status, 0, 0, 0, 0);
+  804b91:	48 63 d6             	movslq %esi,%rdx
+  804b94:	48 63 f7             	movslq %edi,%rsi
+  804b97:	48 83 ec 08          	sub    $0x8,%rsp
+  804b9b:	6a 00                	push   $0x0
+  804b9d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804ba3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804ba9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804bae:	bf 09 00 00 00       	mov    $0x9,%edi
+  804bb3:	48 b8 c2 49 80 00 00 	movabs $0x8049c2,%rax
+  804bba:	00 00 00 
+  804bbd:	ff d0                	call   *%rax
+}
+  804bbf:	48 83 c4 10          	add    $0x10,%rsp
+  804bc3:	c9                   	leave
+  804bc4:	c3                   	ret
+
+0000000000804bc5 <scring_env_set_trapframe>:
+
+void
+scring_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  804bc5:	55                   	push   %rbp
+  804bc6:	48 89 e5             	mov    %rsp,%rbp
+  804bc9:	48 89 f2             	mov    %rsi,%rdx
+    scring_push(SYS_env_set_trapframe, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  804bcc:	48 63 f7             	movslq %edi,%rsi
+  804bcf:	48 83 ec 08          	sub    $0x8,%rsp
+  804bd3:	6a 00                	push   $0x0
+  804bd5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804bdb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804be1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804be6:	bf 0a 00 00 00       	mov    $0xa,%edi
+  804beb:	48 b8 c2 49 80 00 00 	movabs $0x8049c2,%rax
+  804bf2:	00 00 00 
+  804bf5:	ff d0                	call   *%rax
+}
+  804bf7:	48 83 c4 10          	add    $0x10,%rsp
+  804bfb:	c9                   	leave
+  804bfc:	c3                   	ret
+
+0000000000804bfd <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  804bfd:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  804c03:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  804c0a:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  804c11:	c3                   	ret
+
+0000000000804c12 <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  804c12:	8b 47 40             	mov    0x40(%rdi),%eax
+  804c15:	8b 17                	mov    (%rdi),%edx
+  804c17:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  804c19:	83 f8 0f             	cmp    $0xf,%eax
+  804c1c:	77 13                	ja     804c31 <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  804c1e:	8b 47 40             	mov    0x40(%rdi),%eax
+  804c21:	83 e0 0f             	and    $0xf,%eax
+  804c24:	48 c1 e0 09          	shl    $0x9,%rax
+  804c28:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  804c2f:	00 
+  804c30:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  804c31:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804c36:	c3                   	ret
+
+0000000000804c37 <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  804c37:	8b 47 40             	mov    0x40(%rdi),%eax
+  804c3a:	83 c0 01             	add    $0x1,%eax
+  804c3d:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  804c40:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  804c46:	8b 57 04             	mov    0x4(%rdi),%edx
+  804c49:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c4e:	85 d2                	test   %edx,%edx
+  804c50:	75 04                	jne    804c56 <chan_publish+0x1f>
+  804c52:	83 e0 01             	and    $0x1,%eax
+}
+  804c55:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  804c56:	87 47 04             	xchg   %eax,0x4(%rdi)
+  804c59:	85 c0                	test   %eax,%eax
+  804c5b:	0f 95 c0             	setne  %al
+  804c5e:	0f b6 c0             	movzbl %al,%eax
+  804c61:	eb ef                	jmp    804c52 <chan_publish+0x1b>
+
+0000000000804c63 <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  804c63:	8b 47 40             	mov    0x40(%rdi),%eax
+  804c66:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  804c68:	29 d0                	sub    %edx,%eax
+  804c6a:	83 e8 01             	sub    $0x1,%eax
+  804c6d:	83 f8 0f             	cmp    $0xf,%eax
+  804c70:	77 12                	ja     804c84 <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  804c72:	8b 07                	mov    (%rdi),%eax
+  804c74:	83 e0 0f             	and    $0xf,%eax
+  804c77:	48 c1 e0 09          	shl    $0x9,%rax
+  804c7b:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  804c82:	00 
+  804c83:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  804c84:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804c89:	c3                   	ret
+
+0000000000804c8a <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  804c8a:	8b 07                	mov    (%rdi),%eax
+  804c8c:	83 c0 01             	add    $0x1,%eax
+  804c8f:	89 07                	mov    %eax,(%rdi)
+}
+  804c91:	c3                   	ret
+
+0000000000804c92 <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  804c92:	55                   	push   %rbp
+  804c93:	48 89 e5             	mov    %rsp,%rbp
+  804c96:	53                   	push   %rbx
+  804c97:	48 83 ec 08          	sub    $0x8,%rsp
+  804c9b:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  804c9e:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  804ca5:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  804cab:	48 b8 63 4c 80 00 00 	movabs $0x804c63,%rax
+  804cb2:	00 00 00 
+  804cb5:	ff d0                	call   *%rax
+  804cb7:	48 85 c0             	test   %rax,%rax
+  804cba:	74 12                	je     804cce <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  804cbc:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  804cc3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804cc8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804ccc:	c9                   	leave
+  804ccd:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  804cce:	b8 01 00 00 00       	mov    $0x1,%eax
+  804cd3:	eb f3                	jmp    804cc8 <chan_arm+0x36>
+
+0000000000804cd5 <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  804cd5:	55                   	push   %rbp
+  804cd6:	48 89 e5             	mov    %rsp,%rbp
+  804cd9:	41 56                	push   %r14
+  804cdb:	41 55                	push   %r13
+  804cdd:	41 54                	push   %r12
+  804cdf:	53                   	push   %rbx
+  804ce0:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  804ce3:	49 bc 92 4c 80 00 00 	movabs $0x804c92,%r12
+  804cea:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  804ced:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  804cf1:	49 bd 6b 15 80 00 00 	movabs $0x80156b,%r13
+  804cf8:	00 00 00 
+    while (chan_arm(r))
+  804cfb:	eb 0d                	jmp    804d0a <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  804cfd:	8b 33                	mov    (%rbx),%esi
+  804cff:	ba 00 00 00 00       	mov    $0x0,%edx
+  804d04:	4c 89 f7             	mov    %r14,%rdi
+  804d07:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  804d0a:	48 89 df             	mov    %rbx,%rdi
+  804d0d:	41 ff d4             	call   *%r12
+  804d10:	84 c0                	test   %al,%al
+  804d12:	75 e9                	jne    804cfd <chan_wait+0x28>
+}
+  804d14:	5b                   	pop    %rbx
+  804d15:	41 5c                	pop    %r12
+  804d17:	41 5d                	pop    %r13
+  804d19:	41 5e                	pop    %r14
+  804d1b:	5d                   	pop    %rbp
+  804d1c:	c3                   	ret
+
+0000000000804d1d <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  804d1d:	55                   	push   %rbp
+  804d1e:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  804d21:	48 83 c7 40          	add    $0x40,%rdi
+  804d25:	be 01 00 00 00       	mov    $0x1,%esi
+  804d2a:	48 b8 89 15 80 00 00 	movabs $0x801589,%rax
+  804d31:	00 00 00 
+  804d34:	ff d0                	call   *%rax
+}
+  804d36:	5d                   	pop    %rbp
+  804d37:	c3                   	ret
+
+0000000000804d38 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804d38:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d3d:	c3                   	ret
+
+0000000000804d3e <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804d3e:	55                   	push   %rbp
+  804d3f:	48 89 e5             	mov    %rsp,%rbp
+  804d42:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804d45:	48 be 42 5c 80 00 00 	movabs $0x805c42,%rsi
+  804d4c:	00 00 00 
+  804d4f:	48 b8 9e 0c 80 00 00 	movabs $0x800c9e,%rax
+  804d56:	00 00 00 
+  804d59:	ff d0                	call   *%rax
+    return 0;
+}
+  804d5b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d60:	5d                   	pop    %rbp
+  804d61:	c3                   	ret
+
+0000000000804d62 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804d62:	55                   	push   %rbp
+  804d63:	48 89 e5             	mov    %rsp,%rbp
+  804d66:	41 57                	push   %r15
+  804d68:	41 56                	push   %r14
+  804d6a:	41 55                	push   %r13
+  804d6c:	41 54                	push   %r12
+  804d6e:	53                   	push   %rbx
+  804d6f:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  804d76:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  804d7d:	48 85 d2             	test   %rdx,%rdx
+  804d80:	74 7a                	je     804dfc <devcons_write+0x9a>
+  804d82:	49 89 d6             	mov    %rdx,%r14
+  804d85:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804d8b:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  804d90:	49 bf 98 0e 80 00 00 	movabs $0x800e98,%r15
+  804d97:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804d9a:	4c 89 f3             	mov    %r14,%rbx
+  804d9d:	48 29 f3             	sub    %rsi,%rbx
+  804da0:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804da5:	48 39 c3             	cmp    %rax,%rbx
+  804da8:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804dac:	4c 63 eb             	movslq %ebx,%r13
+  804daf:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804db6:	48 01 c6             	add    %rax,%rsi
+  804db9:	4c 89 ea             	mov    %r13,%rdx
+  804dbc:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804dc3:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  804dc6:	4c 89 ee             	mov    %r13,%rsi
+  804dc9:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804dd0:	48 b8 c5 10 80 00 00 	movabs $0x8010c5,%rax
+  804dd7:	00 00 00 
+  804dda:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804ddc:	41 01 dc             	add    %ebx,%r12d
+  804ddf:	49 63 f4             	movslq %r12d,%rsi
+  804de2:	4c 39 f6             	cmp    %r14,%rsi
+  804de5:	72 b3                	jb     804d9a <devcons_write+0x38>
+    return res;
+  804de7:	49 63 c4             	movslq %r12d,%rax
+}
+  804dea:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804df1:	5b                   	pop    %rbx
+  804df2:	41 5c                	pop    %r12
+  804df4:	41 5d                	pop    %r13
+  804df6:	41 5e                	pop    %r14
+  804df8:	41 5f                	pop    %r15
+  804dfa:	5d                   	pop    %rbp
+  804dfb:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804dfc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804e02:	eb e3                	jmp    804de7 <devcons_write+0x85>
+
+0000000000804e04 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804e04:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804e07:	ba 00 00 00 00       	mov    $0x0,%edx
+  804e0c:	48 85 c0             	test   %rax,%rax
+  804e0f:	74 55                	je     804e66 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804e11:	55                   	push   %rbp
+  804e12:	48 89 e5             	mov    %rsp,%rbp
+  804e15:	41 55                	push   %r13
+  804e17:	41 54                	push   %r12
+  804e19:	53                   	push   %rbx
+  804e1a:	48 83 ec 08          	sub    $0x8,%rsp
+  804e1e:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  804e21:	48 bb e4 10 80 00 00 	movabs $0x8010e4,%rbx
+  804e28:	00 00 00 
+  804e2b:	49 bc 99 11 80 00 00 	movabs $0x801199,%r12
+  804e32:	00 00 00 
+  804e35:	eb 03                	jmp    804e3a <devcons_read+0x36>
+  804e37:	41 ff d4             	call   *%r12
+  804e3a:	ff d3                	call   *%rbx
+  804e3c:	85 c0                	test   %eax,%eax
+  804e3e:	74 f7                	je     804e37 <devcons_read+0x33>
+    if (c < 0) return c;
+  804e40:	48 63 d0             	movslq %eax,%rdx
+  804e43:	78 13                	js     804e58 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  804e45:	ba 00 00 00 00       	mov    $0x0,%edx
+  804e4a:	83 f8 04             	cmp    $0x4,%eax
+  804e4d:	74 09                	je     804e58 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  804e4f:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804e53:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804e58:	48 89 d0             	mov    %rdx,%rax
+  804e5b:	48 83 c4 08          	add    $0x8,%rsp
+  804e5f:	5b                   	pop    %rbx
+  804e60:	41 5c                	pop    %r12
+  804e62:	41 5d                	pop    %r13
+  804e64:	5d                   	pop    %rbp
+  804e65:	c3                   	ret
+  804e66:	48 89 d0             	mov    %rdx,%rax
+  804e69:	c3                   	ret
+
+0000000000804e6a <cputchar>:
+cputchar(int ch) {
+  804e6a:	55                   	push   %rbp
+  804e6b:	48 89 e5             	mov    %rsp,%rbp
+  804e6e:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  804e72:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  804e76:	be 01 00 00 00       	mov    $0x1,%esi
+  804e7b:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  804e7f:	48 b8 c5 10 80 00 00 	movabs $0x8010c5,%rax
+  804e86:	00 00 00 
+  804e89:	ff d0                	call   *%rax
+}
+  804e8b:	c9                   	leave
+  804e8c:	c3                   	ret
+
+0000000000804e8d <getchar>:
+getchar(void) {
+  804e8d:	55                   	push   %rbp
+  804e8e:	48 89 e5             	mov    %rsp,%rbp
+  804e91:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  804e95:	ba 01 00 00 00       	mov    $0x1,%edx
+  804e9a:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  804e9e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804ea3:	48 b8 a1 19 80 00 00 	movabs $0x8019a1,%rax
+  804eaa:	00 00 00 
+  804ead:	ff d0                	call   *%rax
+  804eaf:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  804eb1:	85 c0                	test   %eax,%eax
+  804eb3:	78 06                	js     804ebb <getchar+0x2e>
+  804eb5:	74 08                	je     804ebf <getchar+0x32>
+  804eb7:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804ebb:	89 d0                	mov    %edx,%eax
+  804ebd:	c9                   	leave
+  804ebe:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  804ebf:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  804ec4:	eb f5                	jmp    804ebb <getchar+0x2e>
+
+0000000000804ec6 <iscons>:
+iscons(int fdnum) {
+  804ec6:	55                   	push   %rbp
+  804ec7:	48 89 e5             	mov    %rsp,%rbp
+  804eca:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804ece:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804ed2:	48 b8 be 16 80 00 00 	movabs $0x8016be,%rax
+  804ed9:	00 00 00 
+  804edc:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804ede:	85 c0                	test   %eax,%eax
+  804ee0:	78 18                	js     804efa <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  804ee2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804ee6:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  804eed:	00 00 00 
+  804ef0:	8b 00                	mov    (%rax),%eax
+  804ef2:	39 02                	cmp    %eax,(%rdx)
+  804ef4:	0f 94 c0             	sete   %al
+  804ef7:	0f b6 c0             	movzbl %al,%eax
+}
+  804efa:	c9                   	leave
+  804efb:	c3                   	ret
+
+0000000000804efc <opencons>:
+opencons(void) {
+  804efc:	55                   	push   %rbp
+  804efd:	48 89 e5             	mov    %rsp,%rbp
+  804f00:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  804f04:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  804f08:	48 b8 5e 16 80 00 00 	movabs $0x80165e,%rax
+  804f0f:	00 00 00 
+  804f12:	ff d0                	call   *%rax
+  804f14:	85 c0                	test   %eax,%eax
+  804f16:	78 49                	js     804f61 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  804f18:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804f1d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804f22:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  804f26:	bf 00 00 00 00       	mov    $0x0,%edi
+  804f2b:	48 b8 fd 11 80 00 00 	movabs $0x8011fd,%rax
+  804f32:	00 00 00 
+  804f35:	ff d0                	call   *%rax
+  804f37:	85 c0                	test   %eax,%eax
+  804f39:	78 26                	js     804f61 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  804f3b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804f3f:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  804f46:	00 00 
+  804f48:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  804f4a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804f4e:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  804f55:	48 b8 30 16 80 00 00 	movabs $0x801630,%rax
+  804f5c:	00 00 00 
+  804f5f:	ff d0                	call   *%rax
+}
+  804f61:	c9                   	leave
+  804f62:	c3                   	ret
+
+0000000000804f63 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  804f63:	55                   	push   %rbp
+  804f64:	48 89 e5             	mov    %rsp,%rbp
+  804f67:	41 56                	push   %r14
+  804f69:	41 55                	push   %r13
+  804f6b:	41 54                	push   %r12
+  804f6d:	53                   	push   %rbx
+  804f6e:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804f71:	48 b8 a8 18 84 00 00 	movabs $0x8418a8,%rax
+  804f78:	00 00 00 
+  804f7b:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804f7f:	74 27                	je     804fa8 <_handle_vectored_pagefault+0x45>
+  804f81:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  804f86:	49 bd 60 18 84 00 00 	movabs $0x841860,%r13
+  804f8d:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804f90:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  804f93:	4c 89 e7             	mov    %r12,%rdi
+  804f96:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  804f9b:	84 c0                	test   %al,%al
+  804f9d:	75 45                	jne    804fe4 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804f9f:	48 83 c3 01          	add    $0x1,%rbx
+  804fa3:	49 3b 1e             	cmp    (%r14),%rbx
+  804fa6:	72 eb                	jb     804f93 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  804fa8:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  804faf:	00 
+  804fb0:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  804fb5:	4d 8b 04 24          	mov    (%r12),%r8
+  804fb9:	48 ba 50 5c 80 00 00 	movabs $0x805c50,%rdx
+  804fc0:	00 00 00 
+  804fc3:	be 1d 00 00 00       	mov    $0x1d,%esi
+  804fc8:	48 bf 80 5c 80 00 00 	movabs $0x805c80,%rdi
+  804fcf:	00 00 00 
+  804fd2:	b8 00 00 00 00       	mov    $0x0,%eax
+  804fd7:	49 ba 29 02 80 00 00 	movabs $0x800229,%r10
+  804fde:	00 00 00 
+  804fe1:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  804fe4:	5b                   	pop    %rbx
+  804fe5:	41 5c                	pop    %r12
+  804fe7:	41 5d                	pop    %r13
+  804fe9:	41 5e                	pop    %r14
+  804feb:	5d                   	pop    %rbp
+  804fec:	c3                   	ret
+
+0000000000804fed <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  804fed:	55                   	push   %rbp
+  804fee:	48 89 e5             	mov    %rsp,%rbp
+  804ff1:	53                   	push   %rbx
+  804ff2:	48 83 ec 08          	sub    $0x8,%rsp
+  804ff6:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  804ff9:	48 b8 a0 18 84 00 00 	movabs $0x8418a0,%rax
+  805000:	00 00 00 
+  805003:	80 38 00             	cmpb   $0x0,(%rax)
+  805006:	0f 84 84 00 00 00    	je     805090 <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80500c:	48 b8 a8 18 84 00 00 	movabs $0x8418a8,%rax
+  805013:	00 00 00 
+  805016:	48 8b 10             	mov    (%rax),%rdx
+  805019:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  80501e:	48 b9 60 18 84 00 00 	movabs $0x841860,%rcx
+  805025:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805028:	48 85 d2             	test   %rdx,%rdx
+  80502b:	74 19                	je     805046 <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  80502d:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  805031:	0f 84 e8 00 00 00    	je     80511f <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805037:	48 83 c0 01          	add    $0x1,%rax
+  80503b:	48 39 d0             	cmp    %rdx,%rax
+  80503e:	75 ed                	jne    80502d <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  805040:	48 83 fa 08          	cmp    $0x8,%rdx
+  805044:	74 1c                	je     805062 <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  805046:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80504a:	48 a3 a8 18 84 00 00 	movabs %rax,0x8418a8
+  805051:	00 00 00 
+  805054:	48 b8 60 18 84 00 00 	movabs $0x841860,%rax
+  80505b:	00 00 00 
+  80505e:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  805062:	48 b8 70 11 80 00 00 	movabs $0x801170,%rax
+  805069:	00 00 00 
+  80506c:	ff d0                	call   *%rax
+  80506e:	89 c7                	mov    %eax,%edi
+  805070:	48 be e5 51 80 00 00 	movabs $0x8051e5,%rsi
+  805077:	00 00 00 
+  80507a:	48 b8 bb 13 80 00 00 	movabs $0x8013bb,%rax
+  805081:	00 00 00 
+  805084:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805086:	85 c0                	test   %eax,%eax
+  805088:	78 68                	js     8050f2 <add_pgfault_handler+0x105>
+    return res;
+}
+  80508a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80508e:	c9                   	leave
+  80508f:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  805090:	48 b8 70 11 80 00 00 	movabs $0x801170,%rax
+  805097:	00 00 00 
+  80509a:	ff d0                	call   *%rax
+  80509c:	89 c7                	mov    %eax,%edi
+  80509e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8050a3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8050a8:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  8050af:	00 00 00 
+  8050b2:	48 b8 fd 11 80 00 00 	movabs $0x8011fd,%rax
+  8050b9:	00 00 00 
+  8050bc:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8050be:	48 ba a8 18 84 00 00 	movabs $0x8418a8,%rdx
+  8050c5:	00 00 00 
+  8050c8:	48 8b 02             	mov    (%rdx),%rax
+  8050cb:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8050cf:	48 89 0a             	mov    %rcx,(%rdx)
+  8050d2:	48 ba 60 18 84 00 00 	movabs $0x841860,%rdx
+  8050d9:	00 00 00 
+  8050dc:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  8050e0:	48 b8 a0 18 84 00 00 	movabs $0x8418a0,%rax
+  8050e7:	00 00 00 
+  8050ea:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  8050ed:	e9 70 ff ff ff       	jmp    805062 <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8050f2:	89 c1                	mov    %eax,%ecx
+  8050f4:	48 ba 8e 5c 80 00 00 	movabs $0x805c8e,%rdx
+  8050fb:	00 00 00 
+  8050fe:	be 3d 00 00 00       	mov    $0x3d,%esi
+  805103:	48 bf 80 5c 80 00 00 	movabs $0x805c80,%rdi
+  80510a:	00 00 00 
+  80510d:	b8 00 00 00 00       	mov    $0x0,%eax
+  805112:	49 b8 29 02 80 00 00 	movabs $0x800229,%r8
+  805119:	00 00 00 
+  80511c:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  80511f:	b8 00 00 00 00       	mov    $0x0,%eax
+  805124:	e9 61 ff ff ff       	jmp    80508a <add_pgfault_handler+0x9d>
+
+0000000000805129 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  805129:	55                   	push   %rbp
+  80512a:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  80512d:	48 b8 a0 18 84 00 00 	movabs $0x8418a0,%rax
+  805134:	00 00 00 
+  805137:	80 38 00             	cmpb   $0x0,(%rax)
+  80513a:	74 33                	je     80516f <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80513c:	48 a1 a8 18 84 00 00 	movabs 0x8418a8,%rax
+  805143:	00 00 00 
+  805146:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  80514b:	48 ba 60 18 84 00 00 	movabs $0x841860,%rdx
+  805152:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805155:	48 85 c0             	test   %rax,%rax
+  805158:	0f 84 85 00 00 00    	je     8051e3 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  80515e:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  805162:	74 40                	je     8051a4 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805164:	48 83 c1 01          	add    $0x1,%rcx
+  805168:	48 39 c1             	cmp    %rax,%rcx
+  80516b:	75 f1                	jne    80515e <remove_pgfault_handler+0x35>
+  80516d:	eb 74                	jmp    8051e3 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  80516f:	48 b9 a6 5c 80 00 00 	movabs $0x805ca6,%rcx
+  805176:	00 00 00 
+  805179:	48 ba b1 5b 80 00 00 	movabs $0x805bb1,%rdx
+  805180:	00 00 00 
+  805183:	be 43 00 00 00       	mov    $0x43,%esi
+  805188:	48 bf 80 5c 80 00 00 	movabs $0x805c80,%rdi
+  80518f:	00 00 00 
+  805192:	b8 00 00 00 00       	mov    $0x0,%eax
+  805197:	49 b8 29 02 80 00 00 	movabs $0x800229,%r8
+  80519e:	00 00 00 
+  8051a1:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  8051a4:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  8051ab:	00 
+  8051ac:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8051b0:	48 29 ca             	sub    %rcx,%rdx
+  8051b3:	48 b8 60 18 84 00 00 	movabs $0x841860,%rax
+  8051ba:	00 00 00 
+  8051bd:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  8051c1:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  8051c6:	48 89 ce             	mov    %rcx,%rsi
+  8051c9:	48 b8 98 0e 80 00 00 	movabs $0x800e98,%rax
+  8051d0:	00 00 00 
+  8051d3:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  8051d5:	48 b8 a8 18 84 00 00 	movabs $0x8418a8,%rax
+  8051dc:	00 00 00 
+  8051df:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  8051e3:	5d                   	pop    %rbp
+  8051e4:	c3                   	ret
+
+00000000008051e5 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  8051e5:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  8051e8:	48 b8 63 4f 80 00 00 	movabs $0x804f63,%rax
+  8051ef:	00 00 00 
+    call *%rax
+  8051f2:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  8051f4:	41 5f                	pop    %r15
+	popq %r15
+  8051f6:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  8051f8:	41 5f                	pop    %r15
+	popq %r14
+  8051fa:	41 5e                	pop    %r14
+	popq %r13
+  8051fc:	41 5d                	pop    %r13
+	popq %r12
+  8051fe:	41 5c                	pop    %r12
+	popq %r11
+  805200:	41 5b                	pop    %r11
+	popq %r10
+  805202:	41 5a                	pop    %r10
+	popq %r9
+  805204:	41 59                	pop    %r9
+	popq %r8
+  805206:	41 58                	pop    %r8
+	popq %rsi
+  805208:	5e                   	pop    %rsi
+	popq %rdi
+  805209:	5f                   	pop    %rdi
+	popq %rbp
+  80520a:	5d                   	pop    %rbp
+	popq %rdx
+  80520b:	5a                   	pop    %rdx
+	popq %rcx
+  80520c:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  80520d:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  805212:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  805217:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  80521b:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  80521e:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  805223:	5b                   	pop    %rbx
+	popq %rax
+  805224:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  805225:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  805229:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  80522a:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  80522f:	c3                   	ret
+
+0000000000805230 <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  805230:	55                   	push   %rbp
+  805231:	48 89 e5             	mov    %rsp,%rbp
+  805234:	41 55                	push   %r13
+  805236:	41 54                	push   %r12
+  805238:	53                   	push   %rbx
+  805239:	48 83 ec 08          	sub    $0x8,%rsp
+  80523d:	49 89 fd             	mov    %rdi,%r13
+  805240:	48 89 f7             	mov    %rsi,%rdi
+  805243:	48 89 d3             	mov    %rdx,%rbx
+  805246:	49 89 cc             	mov    %rcx,%r12
+  805249:	4c 89 c2             	mov    %r8,%rdx
+  80524c:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80524f:	48 85 f6             	test   %rsi,%rsi
+  805252:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805259:	00 00 00 
+  80525c:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  805260:	be 00 10 00 00       	mov    $0x1000,%esi
+  805265:	48 85 db             	test   %rbx,%rbx
+  805268:	74 03                	je     80526d <ipc_recv_futex+0x3d>
+  80526a:	48 8b 33             	mov    (%rbx),%rsi
+  80526d:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  805271:	48 b8 47 14 80 00 00 	movabs $0x801447,%rax
+  805278:	00 00 00 
+  80527b:	ff d0                	call   *%rax
+    if (res < 0) {
+  80527d:	85 c0                	test   %eax,%eax
+  80527f:	78 75                	js     8052f6 <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  805281:	4d 85 ed             	test   %r13,%r13
+  805284:	74 14                	je     80529a <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  805286:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80528d:	00 00 00 
+  805290:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  805296:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  80529a:	4d 85 e4             	test   %r12,%r12
+  80529d:	74 14                	je     8052b3 <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  80529f:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8052a6:	00 00 00 
+  8052a9:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  8052af:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  8052b3:	48 85 db             	test   %rbx,%rbx
+  8052b6:	74 23                	je     8052db <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8052b8:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8052bf:	00 00 00 
+  8052c2:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  8052c8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8052cd:	85 c9                	test   %ecx,%ecx
+  8052cf:	74 07                	je     8052d8 <ipc_recv_futex+0xa8>
+  8052d1:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  8052d8:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  8052db:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8052e2:	00 00 00 
+  8052e5:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  8052eb:	48 83 c4 08          	add    $0x8,%rsp
+  8052ef:	5b                   	pop    %rbx
+  8052f0:	41 5c                	pop    %r12
+  8052f2:	41 5d                	pop    %r13
+  8052f4:	5d                   	pop    %rbp
+  8052f5:	c3                   	ret
+        if (from_env_store != NULL) {
+  8052f6:	4d 85 ed             	test   %r13,%r13
+  8052f9:	74 08                	je     805303 <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  8052fb:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  805302:	00 
+        if (perm_store != NULL) {
+  805303:	4d 85 e4             	test   %r12,%r12
+  805306:	74 08                	je     805310 <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  805308:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80530f:	00 
+        if (size != NULL) {
+  805310:	48 85 db             	test   %rbx,%rbx
+  805313:	74 d6                	je     8052eb <ipc_recv_futex+0xbb>
+            *size = 0;
+  805315:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  80531c:	eb cd                	jmp    8052eb <ipc_recv_futex+0xbb>
+
+000000000080531e <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80531e:	55                   	push   %rbp
+  80531f:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  805322:	48 83 ec 08          	sub    $0x8,%rsp
+  805326:	6a 00                	push   $0x0
+  805328:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80532e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  805334:	48 b8 30 52 80 00 00 	movabs $0x805230,%rax
+  80533b:	00 00 00 
+  80533e:	ff d0                	call   *%rax
+}
+  805340:	c9                   	leave
+  805341:	c3                   	ret
+
+0000000000805342 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  805342:	55                   	push   %rbp
+  805343:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  805346:	48 85 d2             	test   %rdx,%rdx
+  805349:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805350:	00 00 00 
+  805353:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  805357:	89 f6                	mov    %esi,%esi
+  805359:	48 b8 30 14 80 00 00 	movabs $0x801430,%rax
+  805360:	00 00 00 
+  805363:	ff d0                	call   *%rax
+    if (res < 0) {
+  805365:	85 c0                	test   %eax,%eax
+  805367:	78 02                	js     80536b <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  805369:	5d                   	pop    %rbp
+  80536a:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  80536b:	89 c1                	mov    %eax,%ecx
+  80536d:	48 ba c0 5c 80 00 00 	movabs $0x805cc0,%rdx
+  805374:	00 00 00 
+  805377:	be 50 00 00 00       	mov    $0x50,%esi
+  80537c:	48 bf d4 5c 80 00 00 	movabs $0x805cd4,%rdi
+  805383:	00 00 00 
+  805386:	b8 00 00 00 00       	mov    $0x0,%eax
+  80538b:	49 b8 29 02 80 00 00 	movabs $0x800229,%r8
+  805392:	00 00 00 
+  805395:	41 ff d0             	call   *%r8
+
+0000000000805398 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  805398:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  80539d:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8053a4:	00 00 00 
+  8053a7:	48 89 d0             	mov    %rdx,%rax
+  8053aa:	48 c1 e0 04          	shl    $0x4,%rax
+  8053ae:	48 29 d0             	sub    %rdx,%rax
+  8053b1:	48 c1 e0 05          	shl    $0x5,%rax
+  8053b5:	48 01 c8             	add    %rcx,%rax
+  8053b8:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  8053be:	39 f8                	cmp    %edi,%eax
+  8053c0:	74 13                	je     8053d5 <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  8053c2:	48 83 c2 01          	add    $0x1,%rdx
+  8053c6:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  8053cd:	75 d8                	jne    8053a7 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8053cf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8053d4:	c3                   	ret
+            return envs[i].env_id;
+  8053d5:	48 89 d0             	mov    %rdx,%rax
+  8053d8:	48 c1 e0 04          	shl    $0x4,%rax
+  8053dc:	48 29 d0             	sub    %rdx,%rax
+  8053df:	48 c1 e0 05          	shl    $0x5,%rax
+  8053e3:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8053ea:	00 00 00 
+  8053ed:	48 01 d0             	add    %rdx,%rax
+  8053f0:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8053f6:	c3                   	ret
+  8053f7:	90                   	nop
+
+00000000008053f8 <__rodata_start>:
+  8053f8:	68 65 6c 6c 6f       	push   $0x6f6c6c65
+  8053fd:	00 73 70             	add    %dh,0x70(%rbx)
+  805400:	61                   	(bad)
+  805401:	77 6e                	ja     805471 <__rodata_start+0x79>
+  805403:	28 68 65             	sub    %ch,0x65(%rax)
+  805406:	6c                   	insb   (%dx),%es:(%rdi)
+  805407:	6c                   	insb   (%dx),%es:(%rdi)
+  805408:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805409:	29 3a                	sub    %edi,(%rdx)
+  80540b:	20 25 69 00 75 73    	and    %ah,0x73750069(%rip)        # 73f5547a <__bss_end+0x7371347a>
+  805411:	65 72 2f             	gs jb  805443 <__rodata_start+0x4b>
+  805414:	73 70                	jae    805486 <__rodata_start+0x8e>
+  805416:	61                   	(bad)
+  805417:	77 6e                	ja     805487 <__rodata_start+0x8f>
+  805419:	62 65 6e 63 68       	(bad)
+  80541e:	2e 63 00             	cs movsxd (%rax),%eax
+  805421:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+  805428:	73 70                	jae    80549a <__rodata_start+0xa2>
+  80542a:	61                   	(bad)
+  80542b:	77 6e                	ja     80549b <__rodata_start+0xa3>
+  80542d:	62 65 6e 63 68       	(bad)
+  805432:	3a 20                	cmp    (%rax),%ah
+  805434:	25 6c 75 20 6b       	and    $0x6b20756c,%eax
+  805439:	65 72 6e             	gs jb  8054aa <__rodata_start+0xb2>
+  80543c:	65 6c                	gs insb (%dx),%es:(%rdi)
+  80543e:	20 65 6e             	and    %ah,0x6e(%rbp)
+  805441:	74 72                	je     8054b5 <__rodata_start+0xbd>
+  805443:	69 65 73 2c 20 25 6c 	imul   $0x6c25202c,0x73(%rbp),%esp
+  80544a:	75 20                	jne    80546c <__rodata_start+0x74>
+  80544c:	4b 63 79 63          	rex.WXB movslq 0x63(%r9),%rdi
+  805450:	6c                   	insb   (%dx),%es:(%rdi)
+  805451:	65 73 20             	gs jae 805474 <__rodata_start+0x7c>
+  805454:	70 65                	jo     8054bb <__rodata_start+0xc3>
+  805456:	72 20                	jb     805478 <__rodata_start+0x80>
+  805458:	73 70                	jae    8054ca <__rodata_start+0xd2>
+  80545a:	61                   	(bad)
+  80545b:	77 6e                	ja     8054cb <__rodata_start+0xd3>
+  80545d:	0a 00                	or     (%rax),%al
+  80545f:	3c 75                	cmp    $0x75,%al
+  805461:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805462:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  805466:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805467:	3e 00 0f             	ds add %cl,(%rdi)
+  80546a:	1f                   	(bad)
+  80546b:	80 00 00             	addb   $0x0,(%rax)
+  80546e:	00 00                	add    %al,(%rax)
+  805470:	5b                   	pop    %rbx
+  805471:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  805476:	20 75 73             	and    %dh,0x73(%rbp)
+  805479:	65 72 20             	gs jb  80549c <__rodata_start+0xa4>
+  80547c:	70 61                	jo     8054df <__rodata_start+0xe7>
+  80547e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80547f:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  805486:	73 20                	jae    8054a8 <__rodata_start+0xb0>
+  805488:	61                   	(bad)
+  805489:	74 20                	je     8054ab <__rodata_start+0xb3>
+  80548b:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  805490:	3a 20                	cmp    (%rax),%ah
+  805492:	00 30                	add    %dh,(%rax)
+  805494:	31 32                	xor    %esi,(%rdx)
+  805496:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  80549d:	41                   	rex.B
+  80549e:	42                   	rex.X
+  80549f:	43                   	rex.XB
+  8054a0:	44                   	rex.R
+  8054a1:	45                   	rex.RB
+  8054a2:	46 00 30             	rex.RX add %r14b,(%rax)
+  8054a5:	31 32                	xor    %esi,(%rdx)
+  8054a7:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8054ae:	61                   	(bad)
+  8054af:	62 63 64 65 66       	(bad)
+  8054b4:	00 28                	add    %ch,(%rax)
+  8054b6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8054b7:	75 6c                	jne    805525 <__rodata_start+0x12d>
+  8054b9:	6c                   	insb   (%dx),%es:(%rdi)
+  8054ba:	29 00                	sub    %eax,(%rax)
+  8054bc:	65 72 72             	gs jb  805531 <__rodata_start+0x139>
+  8054bf:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8054c0:	72 20                	jb     8054e2 <__rodata_start+0xea>
+  8054c2:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  8054c7:	73 70                	jae    805539 <__rodata_start+0x141>
+  8054c9:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  8054cd:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  8054d4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8054d5:	72 00                	jb     8054d7 <__rodata_start+0xdf>
+  8054d7:	62 61 64 20 65       	(bad)
+  8054dc:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8054dd:	76 69                	jbe    805548 <__rodata_start+0x150>
+  8054df:	72 6f                	jb     805550 <__rodata_start+0x158>
+  8054e1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8054e2:	6d                   	insl   (%dx),%es:(%rdi)
+  8054e3:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8054e5:	74 00                	je     8054e7 <__rodata_start+0xef>
+  8054e7:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8054ee:	20 70 61             	and    %dh,0x61(%rax)
+  8054f1:	72 61                	jb     805554 <__rodata_start+0x15c>
+  8054f3:	6d                   	insl   (%dx),%es:(%rdi)
+  8054f4:	65 74 65             	gs je  80555c <__rodata_start+0x164>
+  8054f7:	72 00                	jb     8054f9 <__rodata_start+0x101>
+  8054f9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8054fa:	75 74                	jne    805570 <__rodata_start+0x178>
+  8054fc:	20 6f 66             	and    %ch,0x66(%rdi)
+  8054ff:	20 6d 65             	and    %ch,0x65(%rbp)
+  805502:	6d                   	insl   (%dx),%es:(%rdi)
+  805503:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805504:	72 79                	jb     80557f <__rodata_start+0x187>
+  805506:	00 6f 75             	add    %ch,0x75(%rdi)
+  805509:	74 20                	je     80552b <__rodata_start+0x133>
+  80550b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80550c:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  805510:	76 69                	jbe    80557b <__rodata_start+0x183>
+  805512:	72 6f                	jb     805583 <__rodata_start+0x18b>
+  805514:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805515:	6d                   	insl   (%dx),%es:(%rdi)
+  805516:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  805518:	74 73                	je     80558d <__rodata_start+0x195>
+  80551a:	00 63 6f             	add    %ah,0x6f(%rbx)
+  80551d:	72 72                	jb     805591 <__rodata_start+0x199>
+  80551f:	75 70                	jne    805591 <__rodata_start+0x199>
+  805521:	74 65                	je     805588 <__rodata_start+0x190>
+  805523:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  805528:	75 67                	jne    805591 <__rodata_start+0x199>
+  80552a:	20 69 6e             	and    %ch,0x6e(%rcx)
+  80552d:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80552f:	00 73 65             	add    %dh,0x65(%rbx)
+  805532:	67 6d                	insl   (%dx),%es:(%edi)
+  805534:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  805536:	74 61                	je     805599 <__rodata_start+0x1a1>
+  805538:	74 69                	je     8055a3 <__rodata_start+0x1ab>
+  80553a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80553b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80553c:	20 66 61             	and    %ah,0x61(%rsi)
+  80553f:	75 6c                	jne    8055ad <__rodata_start+0x1b5>
+  805541:	74 00                	je     805543 <__rodata_start+0x14b>
+  805543:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80554a:	20 45 4c             	and    %al,0x4c(%rbp)
+  80554d:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  805551:	61                   	(bad)
+  805552:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  805557:	20 73 75             	and    %dh,0x75(%rbx)
+  80555a:	63 68 20             	movsxd 0x20(%rax),%ebp
+  80555d:	73 79                	jae    8055d8 <__rodata_start+0x1e0>
+  80555f:	73 74                	jae    8055d5 <__rodata_start+0x1dd>
+  805561:	65 6d                	gs insl (%dx),%es:(%rdi)
+  805563:	20 63 61             	and    %ah,0x61(%rbx)
+  805566:	6c                   	insb   (%dx),%es:(%rdi)
+  805567:	6c                   	insb   (%dx),%es:(%rdi)
+  805568:	00 65 6e             	add    %ah,0x6e(%rbp)
+  80556b:	74 72                	je     8055df <__rodata_start+0x1e7>
+  80556d:	79 20                	jns    80558f <__rodata_start+0x197>
+  80556f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805570:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805571:	74 20                	je     805593 <__rodata_start+0x19b>
+  805573:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  805575:	75 6e                	jne    8055e5 <__rodata_start+0x1ed>
+  805577:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  80557b:	76 20                	jbe    80559d <__rodata_start+0x1a5>
+  80557d:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  805584:	72 65                	jb     8055eb <__rodata_start+0x1f3>
+  805586:	63 76 69             	movsxd 0x69(%rsi),%esi
+  805589:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80558a:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  80558e:	65 78 70             	gs js  805601 <__rodata_start+0x209>
+  805591:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  805596:	20 65 6e             	and    %ah,0x6e(%rbp)
+  805599:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  80559d:	20 66 69             	and    %ah,0x69(%rsi)
+  8055a0:	6c                   	insb   (%dx),%es:(%rdi)
+  8055a1:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  8055a5:	20 66 72             	and    %ah,0x72(%rsi)
+  8055a8:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  8055ad:	61                   	(bad)
+  8055ae:	63 65 20             	movsxd 0x20(%rbp),%esp
+  8055b1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8055b2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8055b3:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  8055b7:	6b 00 74             	imul   $0x74,(%rax),%eax
+  8055ba:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8055bb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8055bc:	20 6d 61             	and    %ch,0x61(%rbp)
+  8055bf:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8055c0:	79 20                	jns    8055e2 <__rodata_start+0x1ea>
+  8055c2:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  8055c9:	72 65                	jb     805630 <__rodata_start+0x238>
+  8055cb:	20 6f 70             	and    %ch,0x70(%rdi)
+  8055ce:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8055d0:	00 66 69             	add    %ah,0x69(%rsi)
+  8055d3:	6c                   	insb   (%dx),%es:(%rdi)
+  8055d4:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  8055d8:	20 62 6c             	and    %ah,0x6c(%rdx)
+  8055db:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8055dc:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  8055df:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8055e0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8055e1:	74 20                	je     805603 <__rodata_start+0x20b>
+  8055e3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8055e5:	75 6e                	jne    805655 <__rodata_start+0x25d>
+  8055e7:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  8055eb:	76 61                	jbe    80564e <__rodata_start+0x256>
+  8055ed:	6c                   	insb   (%dx),%es:(%rdi)
+  8055ee:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  8055f5:	00 
+  8055f6:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  8055fd:	72 65                	jb     805664 <__rodata_start+0x26c>
+  8055ff:	61                   	(bad)
+  805600:	64 79 20             	fs jns 805623 <__rodata_start+0x22b>
+  805603:	65 78 69             	gs js  80566f <__rodata_start+0x277>
+  805606:	73 74                	jae    80567c <__rodata_start+0x284>
+  805608:	73 00                	jae    80560a <__rodata_start+0x212>
+  80560a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80560b:	70 65                	jo     805672 <__rodata_start+0x27a>
+  80560d:	72 61                	jb     805670 <__rodata_start+0x278>
+  80560f:	74 69                	je     80567a <__rodata_start+0x282>
+  805611:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805612:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805613:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  805616:	74 20                	je     805638 <__rodata_start+0x240>
+  805618:	73 75                	jae    80568f <__rodata_start+0x297>
+  80561a:	70 70                	jo     80568c <__rodata_start+0x294>
+  80561c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80561d:	72 74                	jb     805693 <__rodata_start+0x29b>
+  80561f:	65 64 00 74 72 79    	gs add %dh,%fs:0x79(%rdx,%rsi,2)
+  805625:	20 61 67             	and    %ah,0x67(%rcx)
+  805628:	61                   	(bad)
+  805629:	69 6e 00 74 69 6d 65 	imul   $0x656d6974,0x0(%rsi),%ebp
+  805630:	64 20 6f 75          	and    %ch,%fs:0x75(%rdi)
+  805634:	74 00                	je     805636 <__rodata_start+0x23e>
+  805636:	66 69 6c 65 20 69 73 	imul   $0x7369,0x20(%rbp,%riz,2),%bp
+  80563d:	20 69 6e             	and    %ch,0x6e(%rcx)
+  805640:	20 75 73             	and    %dh,0x73(%rbp)
+  805643:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  805647:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  80564e:	00 
+  80564f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805656:	00 00 00 
+  805659:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+  805660:	66 05 80 00          	add    $0x80,%ax
+  805664:	00 00                	add    %al,(%rax)
+  805666:	00 00                	add    %al,(%rax)
+  805668:	a7                   	cmpsl  %es:(%rdi),%ds:(%rsi)
+  805669:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80566f:	00 97 0b 80 00 00    	add    %dl,0x800b(%rdi)
+  805675:	00 00                	add    %al,(%rax)
+  805677:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  80567d:	00 00                	add    %al,(%rax)
+  80567f:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  805685:	00 00                	add    %al,(%rax)
+  805687:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  80568d:	00 00                	add    %al,(%rax)
+  80568f:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  805695:	00 00                	add    %al,(%rax)
+  805697:	00 85 05 80 00 00    	add    %al,0x8005(%rbp)
+  80569d:	00 00                	add    %al,(%rax)
+  80569f:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  8056a5:	00 00                	add    %al,(%rax)
+  8056a7:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  8056ad:	00 00                	add    %al,(%rax)
+  8056af:	00 79 05             	add    %bh,0x5(%rcx)
+  8056b2:	80 00 00             	addb   $0x0,(%rax)
+  8056b5:	00 00                	add    %al,(%rax)
+  8056b7:	00 f3                	add    %dh,%bl
+  8056b9:	05 80 00 00 00       	add    $0x80,%eax
+  8056be:	00 00                	add    %al,(%rax)
+  8056c0:	a7                   	cmpsl  %es:(%rdi),%ds:(%rsi)
+  8056c1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8056c7:	00 79 05             	add    %bh,0x5(%rcx)
+  8056ca:	80 00 00             	addb   $0x0,(%rax)
+  8056cd:	00 00                	add    %al,(%rax)
+  8056cf:	00 bf 05 80 00 00    	add    %bh,0x8005(%rdi)
+  8056d5:	00 00                	add    %al,(%rax)
+  8056d7:	00 bf 05 80 00 00    	add    %bh,0x8005(%rdi)
+  8056dd:	00 00                	add    %al,(%rax)
+  8056df:	00 bf 05 80 00 00    	add    %bh,0x8005(%rdi)
+  8056e5:	00 00                	add    %al,(%rax)
+  8056e7:	00 bf 05 80 00 00    	add    %bh,0x8005(%rdi)
+  8056ed:	00 00                	add    %al,(%rax)
+  8056ef:	00 bf 05 80 00 00    	add    %bh,0x8005(%rdi)
+  8056f5:	00 00                	add    %al,(%rax)
+  8056f7:	00 bf 05 80 00 00    	add    %bh,0x8005(%rdi)
+  8056fd:	00 00                	add    %al,(%rax)
+  8056ff:	00 bf 05 80 00 00    	add    %bh,0x8005(%rdi)
+  805705:	00 00                	add    %al,(%rax)
+  805707:	00 bf 05 80 00 00    	add    %bh,0x8005(%rdi)
+  80570d:	00 00                	add    %al,(%rax)
+  80570f:	00 bf 05 80 00 00    	add    %bh,0x8005(%rdi)
+  805715:	00 00                	add    %al,(%rax)
+  805717:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  80571d:	00 00                	add    %al,(%rax)
+  80571f:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  805725:	00 00                	add    %al,(%rax)
+  805727:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  80572d:	00 00                	add    %al,(%rax)
+  80572f:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  805735:	00 00                	add    %al,(%rax)
+  805737:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  80573d:	00 00                	add    %al,(%rax)
+  80573f:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  805745:	00 00                	add    %al,(%rax)
+  805747:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  80574d:	00 00                	add    %al,(%rax)
+  80574f:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  805755:	00 00                	add    %al,(%rax)
+  805757:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  80575d:	00 00                	add    %al,(%rax)
+  80575f:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  805765:	00 00                	add    %al,(%rax)
+  805767:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  80576d:	00 00                	add    %al,(%rax)
+  80576f:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  805775:	00 00                	add    %al,(%rax)
+  805777:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  80577d:	00 00                	add    %al,(%rax)
+  80577f:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  805785:	00 00                	add    %al,(%rax)
+  805787:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  80578d:	00 00                	add    %al,(%rax)
+  80578f:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  805795:	00 00                	add    %al,(%rax)
+  805797:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  80579d:	00 00                	add    %al,(%rax)
+  80579f:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  8057a5:	00 00                	add    %al,(%rax)
+  8057a7:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  8057ad:	00 00                	add    %al,(%rax)
+  8057af:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  8057b5:	00 00                	add    %al,(%rax)
+  8057b7:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  8057bd:	00 00                	add    %al,(%rax)
+  8057bf:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  8057c5:	00 00                	add    %al,(%rax)
+  8057c7:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  8057cd:	00 00                	add    %al,(%rax)
+  8057cf:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  8057d5:	00 00                	add    %al,(%rax)
+  8057d7:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  8057dd:	00 00                	add    %al,(%rax)
+  8057df:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  8057e5:	00 00                	add    %al,(%rax)
+  8057e7:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  8057ed:	00 00                	add    %al,(%rax)
+  8057ef:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  8057f5:	00 00                	add    %al,(%rax)
+  8057f7:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  8057fd:	00 00                	add    %al,(%rax)
+  8057ff:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  805805:	00 00                	add    %al,(%rax)
+  805807:	00 ca                	add    %cl,%dl
+  805809:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80580f:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  805815:	00 00                	add    %al,(%rax)
+  805817:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  80581d:	00 00                	add    %al,(%rax)
+  80581f:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  805825:	00 00                	add    %al,(%rax)
+  805827:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  80582d:	00 00                	add    %al,(%rax)
+  80582f:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  805835:	00 00                	add    %al,(%rax)
+  805837:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  80583d:	00 00                	add    %al,(%rax)
+  80583f:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  805845:	00 00                	add    %al,(%rax)
+  805847:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  80584d:	00 00                	add    %al,(%rax)
+  80584f:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  805855:	00 00                	add    %al,(%rax)
+  805857:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  80585d:	00 00                	add    %al,(%rax)
+  80585f:	00 16                	add    %dl,(%rsi)
+  805861:	06                   	(bad)
+  805862:	80 00 00             	addb   $0x0,(%rax)
+  805865:	00 00                	add    %al,(%rax)
+  805867:	00 e5                	add    %ah,%ch
+  805869:	07                   	(bad)
+  80586a:	80 00 00             	addb   $0x0,(%rax)
+  80586d:	00 00                	add    %al,(%rax)
+  80586f:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  805875:	00 00                	add    %al,(%rax)
+  805877:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  80587d:	00 00                	add    %al,(%rax)
+  80587f:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  805885:	00 00                	add    %al,(%rax)
+  805887:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  80588d:	00 00                	add    %al,(%rax)
+  80588f:	00 45 06             	add    %al,0x6(%rbp)
+  805892:	80 00 00             	addb   $0x0,(%rax)
+  805895:	00 00                	add    %al,(%rax)
+  805897:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  80589d:	00 00                	add    %al,(%rax)
+  80589f:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  8058a5:	00 00                	add    %al,(%rax)
+  8058a7:	00 0b                	add    %cl,(%rbx)
+  8058a9:	06                   	(bad)
+  8058aa:	80 00 00             	addb   $0x0,(%rax)
+  8058ad:	00 00                	add    %al,(%rax)
+  8058af:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  8058b5:	00 00                	add    %al,(%rax)
+  8058b7:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  8058bd:	00 00                	add    %al,(%rax)
+  8058bf:	00 8d 09 80 00 00    	add    %cl,0x8009(%rbp)
+  8058c5:	00 00                	add    %al,(%rax)
+  8058c7:	00 57 0a             	add    %dl,0xa(%rdi)
+  8058ca:	80 00 00             	addb   $0x0,(%rax)
+  8058cd:	00 00                	add    %al,(%rax)
+  8058cf:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  8058d5:	00 00                	add    %al,(%rax)
+  8058d7:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  8058dd:	00 00                	add    %al,(%rax)
+  8058df:	00 dc                	add    %bl,%ah
+  8058e1:	06                   	(bad)
+  8058e2:	80 00 00             	addb   $0x0,(%rax)
+  8058e5:	00 00                	add    %al,(%rax)
+  8058e7:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  8058ed:	00 00                	add    %al,(%rax)
+  8058ef:	00 b9 08 80 00 00    	add    %bh,0x8008(%rcx)
+  8058f5:	00 00                	add    %al,(%rax)
+  8058f7:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  8058fd:	00 00                	add    %al,(%rax)
+  8058ff:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  805905:	00 00                	add    %al,(%rax)
+  805907:	00 ca                	add    %cl,%dl
+  805909:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80590f:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  805915:	00 00                	add    %al,(%rax)
+  805917:	00 6f 05             	add    %ch,0x5(%rdi)
+  80591a:	80 00 00             	addb   $0x0,(%rax)
+  80591d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000805920 <error_string>:
+	...
+  805928:	c5 54 80 00 00 00 00 00 d7 54 80 00 00 00 00 00     .T.......T......
+  805938:	e7 54 80 00 00 00 00 00 f9 54 80 00 00 00 00 00     .T.......T......
+  805948:	07 55 80 00 00 00 00 00 1b 55 80 00 00 00 00 00     .U.......U......
+  805958:	30 55 80 00 00 00 00 00 43 55 80 00 00 00 00 00     0U......CU......
+  805968:	55 55 80 00 00 00 00 00 69 55 80 00 00 00 00 00     UU......iU......
+  805978:	79 55 80 00 00 00 00 00 8c 55 80 00 00 00 00 00     yU.......U......
+  805988:	a3 55 80 00 00 00 00 00 b9 55 80 00 00 00 00 00     .U.......U......
+  805998:	d1 55 80 00 00 00 00 00 e9 55 80 00 00 00 00 00     .U.......U......
+  8059a8:	f6 55 80 00 00 00 00 00 d8 59 80 00 00 00 00 00     .U.......Y......
+  8059b8:	0a 56 80 00 00 00 00 00 22 56 80 00 00 00 00 00     .V......"V......
+  8059c8:	2c 56 80 00 00 00 00 00 36 56 80 00 00 00 00 00     ,V......6V......
+  8059d8:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  8059e8:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  8059f8:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  805a08:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  805a18:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  805a28:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  805a38:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  805a48:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  805a58:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  805a68:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  805a78:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  805a88:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  805a98:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  805aa8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ab8:	0f 1f 84 00 00 00 00 00                             ........
+
+0000000000805ac0 <devtab>:
+  805ac0:	20 60 80 00 00 00 00 00 60 60 80 00 00 00 00 00      `......``......
+  805ad0:	a0 60 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .`..............
+  805ae0:	57 72 6f 6e 67 20 45 4c 46 20 68 65 61 64 65 72     Wrong ELF header
+  805af0:	20 73 69 7a 65 20 6f 72 20 72 65 61 64 20 65 72      size or read er
+  805b00:	72 6f 72 3a 20 25 69 0a 00 00 00 00 00 00 00 00     ror: %i.........
+  805b10:	73 74 72 69 6e 67 5f 73 74 6f 72 65 20 3d 3d 20     string_store == 
+  805b20:	28 63 68 61 72 20 2a 29 55 54 45 4d 50 20 2b 20     (char *)UTEMP + 
+  805b30:	55 53 45 52 5f 53 54 41 43 4b 5f 53 49 5a 45 00     USER_STACK_SIZE.
+  805b40:	6d 61 70 5f 73 65 67 6d 65 6e 74 2e 73 79 73 5f     map_segment.sys_
+  805b50:	61 6c 6c 6f 63 5f 72 65 67 69 6f 6e 20 66 61 69     alloc_region fai
+  805b60:	6c 65 64 3a 20 25 69 0a 00 00 00 00 00 00 00 00     led: %i.........
+  805b70:	73 70 61 77 6e 3a 20 62 61 74 63 68 65 64 20 73     spawn: batched s
+  805b80:	79 73 74 65 6d 20 63 61 6c 6c 20 66 61 69 6c 65     ystem call faile
+  805b90:	64 3a 20 25 69 0a 00 45 6c 66 20 6d 61 67 69 63     d: %i..Elf magic
+  805ba0:	20 25 30 38 78 20 77 61 6e 74 20 25 30 38 78 0a      %08x want %08x.
+  805bb0:	00 61 73 73 65 72 74 69 6f 6e 20 66 61 69 6c 65     .assertion faile
+  805bc0:	64 3a 20 25 73 00 6c 69 62 2f 73 70 61 77 6e 2e     d: %s.lib/spawn.
+  805bd0:	63 00 6d 61 70 5f 73 65 67 6d 65 6e 74 2e 6d 6d     c.map_segment.mm
+  805be0:	61 70 20 66 61 69 6c 65 64 3a 20 25 69 0a 00 3c     ap failed: %i..<
+  805bf0:	70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e 63     pipe>.lib/pipe.c
+  805c00:	00 70 69 70 65 00 66 90 73 79 73 5f 72 65 67 69     .pipe.f.sys_regi
+  805c10:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  805c20:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 65 6e 76 69     _SIZE) == 2.envi
+  805c30:	64 20 21 3d 20 30 00 6c 69 62 2f 77 61 69 74 2e     d != 0.lib/wait.
+  805c40:	63 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00 66 90     c.<cons>.cons.f.
+  805c50:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  805c60:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  805c70:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  805c80:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  805c90:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  805ca0:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  805cb0:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  805cc0:	69 70 63 5f 73 65 6e 64 20 65 72 72 6f 72 3a 20     ipc_send error: 
+  805cd0:	25 69 0a 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e     %i..lib/ipc.c.f.
+  805ce0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805cf0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805da0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805db0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805dc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805dd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805de0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805df0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ea0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805eb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ec0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ed0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ee0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ef0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805fa0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805fb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805fc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805fd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805fe0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ff0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 90     ....f.........f.
@@ -0,0 +1,9279 @@
+
+obj/user/spawnhello:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 87 00 00 00       	call   8000aa <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    int r;
+    cprintf("i am parent environment %08x\n", thisenv->env_id);
+  800029:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800030:	00 00 00 
+  800033:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800039:	48 bf 50 52 80 00 00 	movabs $0x805250,%rdi
+  800040:	00 00 00 
+  800043:	b8 00 00 00 00       	mov    $0x0,%eax
+  800048:	48 ba d0 02 80 00 00 	movabs $0x8002d0,%rdx
+  80004f:	00 00 00 
+  800052:	ff d2                	call   *%rdx
+    if ((r = spawnl("hello", "hello", 0)) < 0)
+  800054:	ba 00 00 00 00       	mov    $0x0,%edx
+  800059:	48 bf 6e 52 80 00 00 	movabs $0x80526e,%rdi
+  800060:	00 00 00 
+  800063:	48 89 fe             	mov    %rdi,%rsi
+  800066:	b8 00 00 00 00       	mov    $0x0,%eax
+  80006b:	48 b9 31 3e 80 00 00 	movabs $0x803e31,%rcx
+  800072:	00 00 00 
+  800075:	ff d1                	call   *%rcx
+  800077:	85 c0                	test   %eax,%eax
+  800079:	78 02                	js     80007d <umain+0x58>
+        panic("spawn(hello) failed: %i", r);
+}
+  80007b:	5d                   	pop    %rbp
+  80007c:	c3                   	ret
+        panic("spawn(hello) failed: %i", r);
+  80007d:	89 c1                	mov    %eax,%ecx
+  80007f:	48 ba 74 52 80 00 00 	movabs $0x805274,%rdx
+  800086:	00 00 00 
+  800089:	be 08 00 00 00       	mov    $0x8,%esi
+  80008e:	48 bf 8c 52 80 00 00 	movabs $0x80528c,%rdi
+  800095:	00 00 00 
+  800098:	b8 00 00 00 00       	mov    $0x0,%eax
+  80009d:	49 b8 80 01 80 00 00 	movabs $0x800180,%r8
+  8000a4:	00 00 00 
+  8000a7:	41 ff d0             	call   *%r8
+
+00000000008000aa <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8000aa:	55                   	push   %rbp
+  8000ab:	48 89 e5             	mov    %rsp,%rbp
+  8000ae:	41 56                	push   %r14
+  8000b0:	41 55                	push   %r13
+  8000b2:	41 54                	push   %r12
+  8000b4:	53                   	push   %rbx
+  8000b5:	41 89 fd             	mov    %edi,%r13d
+  8000b8:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8000bb:	48 ba e0 60 80 00 00 	movabs $0x8060e0,%rdx
+  8000c2:	00 00 00 
+  8000c5:	48 b8 e0 60 80 00 00 	movabs $0x8060e0,%rax
+  8000cc:	00 00 00 
+  8000cf:	48 39 c2             	cmp    %rax,%rdx
+  8000d2:	73 17                	jae    8000eb <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8000d4:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8000d7:	49 89 c4             	mov    %rax,%r12
+  8000da:	48 83 c3 08          	add    $0x8,%rbx
+  8000de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000e3:	ff 53 f8             	call   *-0x8(%rbx)
+  8000e6:	4c 39 e3             	cmp    %r12,%rbx
+  8000e9:	72 ef                	jb     8000da <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8000eb:	48 b8 c7 10 80 00 00 	movabs $0x8010c7,%rax
+  8000f2:	00 00 00 
+  8000f5:	ff d0                	call   *%rax
+  8000f7:	89 c2                	mov    %eax,%edx
+  8000f9:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  8000ff:	48 89 d0             	mov    %rdx,%rax
+  800102:	48 c1 e0 04          	shl    $0x4,%rax
+  800106:	48 29 d0             	sub    %rdx,%rax
+  800109:	48 c1 e0 05          	shl    $0x5,%rax
+  80010d:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800114:	00 00 00 
+  800117:	48 01 d0             	add    %rdx,%rax
+  80011a:	48 a3 00 00 81 00 00 	movabs %rax,0x810000
+  800121:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800124:	45 85 ed             	test   %r13d,%r13d
+  800127:	7e 0d                	jle    800136 <libmain+0x8c>
+  800129:	49 8b 06             	mov    (%r14),%rax
+  80012c:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  800133:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800136:	4c 89 f6             	mov    %r14,%rsi
+  800139:	44 89 ef             	mov    %r13d,%edi
+  80013c:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800143:	00 00 00 
+  800146:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800148:	48 b8 5d 01 80 00 00 	movabs $0x80015d,%rax
+  80014f:	00 00 00 
+  800152:	ff d0                	call   *%rax
+#endif
+}
+  800154:	5b                   	pop    %rbx
+  800155:	41 5c                	pop    %r12
+  800157:	41 5d                	pop    %r13
+  800159:	41 5e                	pop    %r14
+  80015b:	5d                   	pop    %rbp
+  80015c:	c3                   	ret
+
+000000000080015d <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80015d:	55                   	push   %rbp
+  80015e:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800161:	48 b8 ad 17 80 00 00 	movabs $0x8017ad,%rax
+  800168:	00 00 00 
+  80016b:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80016d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800172:	48 b8 64 10 80 00 00 	movabs $0x801064,%rax
+  800179:	00 00 00 
+  80017c:	ff d0                	call   *%rax
+}
+  80017e:	5d                   	pop    %rbp
+  80017f:	c3                   	ret
+
+0000000000800180 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800180:	55                   	push   %rbp
+  800181:	48 89 e5             	mov    %rsp,%rbp
+  800184:	41 56                	push   %r14
+  800186:	41 55                	push   %r13
+  800188:	41 54                	push   %r12
+  80018a:	53                   	push   %rbx
+  80018b:	48 83 ec 50          	sub    $0x50,%rsp
+  80018f:	49 89 fc             	mov    %rdi,%r12
+  800192:	41 89 f5             	mov    %esi,%r13d
+  800195:	48 89 d3             	mov    %rdx,%rbx
+  800198:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80019c:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8001a0:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8001a4:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8001ab:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8001af:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8001b3:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8001b7:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8001bb:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8001c2:	00 00 00 
+  8001c5:	4c 8b 30             	mov    (%rax),%r14
+  8001c8:	48 b8 c7 10 80 00 00 	movabs $0x8010c7,%rax
+  8001cf:	00 00 00 
+  8001d2:	ff d0                	call   *%rax
+  8001d4:	89 c6                	mov    %eax,%esi
+  8001d6:	45 89 e8             	mov    %r13d,%r8d
+  8001d9:	4c 89 e1             	mov    %r12,%rcx
+  8001dc:	4c 89 f2             	mov    %r14,%rdx
+  8001df:	48 bf a8 52 80 00 00 	movabs $0x8052a8,%rdi
+  8001e6:	00 00 00 
+  8001e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001ee:	49 bc d0 02 80 00 00 	movabs $0x8002d0,%r12
+  8001f5:	00 00 00 
+  8001f8:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8001fb:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8001ff:	48 89 df             	mov    %rbx,%rdi
+  800202:	48 b8 6c 02 80 00 00 	movabs $0x80026c,%rax
+  800209:	00 00 00 
+  80020c:	ff d0                	call   *%rax
+    cprintf("\n");
+  80020e:	48 bf a3 58 80 00 00 	movabs $0x8058a3,%rdi
+  800215:	00 00 00 
+  800218:	b8 00 00 00 00       	mov    $0x0,%eax
+  80021d:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800220:	cc                   	int3
+  800221:	eb fd                	jmp    800220 <_panic+0xa0>
+
+0000000000800223 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800223:	55                   	push   %rbp
+  800224:	48 89 e5             	mov    %rsp,%rbp
+  800227:	53                   	push   %rbx
+  800228:	48 83 ec 08          	sub    $0x8,%rsp
+  80022c:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80022f:	8b 06                	mov    (%rsi),%eax
+  800231:	8d 50 01             	lea    0x1(%rax),%edx
+  800234:	89 16                	mov    %edx,(%rsi)
+  800236:	48 98                	cltq
+  800238:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80023d:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800243:	74 0a                	je     80024f <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800245:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800249:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80024d:	c9                   	leave
+  80024e:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80024f:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800253:	be ff 00 00 00       	mov    $0xff,%esi
+  800258:	48 b8 1c 10 80 00 00 	movabs $0x80101c,%rax
+  80025f:	00 00 00 
+  800262:	ff d0                	call   *%rax
+        state->offset = 0;
+  800264:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80026a:	eb d9                	jmp    800245 <putch+0x22>
+
+000000000080026c <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80026c:	55                   	push   %rbp
+  80026d:	48 89 e5             	mov    %rsp,%rbp
+  800270:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800277:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80027a:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800281:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800286:	b8 00 00 00 00       	mov    $0x0,%eax
+  80028b:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80028e:	48 89 f1             	mov    %rsi,%rcx
+  800291:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800298:	48 bf 23 02 80 00 00 	movabs $0x800223,%rdi
+  80029f:	00 00 00 
+  8002a2:	48 b8 20 04 80 00 00 	movabs $0x800420,%rax
+  8002a9:	00 00 00 
+  8002ac:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8002ae:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8002b5:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8002bc:	48 b8 1c 10 80 00 00 	movabs $0x80101c,%rax
+  8002c3:	00 00 00 
+  8002c6:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8002c8:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8002ce:	c9                   	leave
+  8002cf:	c3                   	ret
+
+00000000008002d0 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8002d0:	55                   	push   %rbp
+  8002d1:	48 89 e5             	mov    %rsp,%rbp
+  8002d4:	48 83 ec 50          	sub    $0x50,%rsp
+  8002d8:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8002dc:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8002e0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8002e4:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8002e8:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8002ec:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8002f3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002f7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8002fb:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8002ff:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800303:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800307:	48 b8 6c 02 80 00 00 	movabs $0x80026c,%rax
+  80030e:	00 00 00 
+  800311:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800313:	c9                   	leave
+  800314:	c3                   	ret
+
+0000000000800315 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800315:	55                   	push   %rbp
+  800316:	48 89 e5             	mov    %rsp,%rbp
+  800319:	41 57                	push   %r15
+  80031b:	41 56                	push   %r14
+  80031d:	41 55                	push   %r13
+  80031f:	41 54                	push   %r12
+  800321:	53                   	push   %rbx
+  800322:	48 83 ec 18          	sub    $0x18,%rsp
+  800326:	49 89 fc             	mov    %rdi,%r12
+  800329:	49 89 f5             	mov    %rsi,%r13
+  80032c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800330:	8b 45 10             	mov    0x10(%rbp),%eax
+  800333:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800336:	41 89 cf             	mov    %ecx,%r15d
+  800339:	4c 39 fa             	cmp    %r15,%rdx
+  80033c:	73 5b                	jae    800399 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80033e:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800342:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800346:	85 db                	test   %ebx,%ebx
+  800348:	7e 0e                	jle    800358 <print_num+0x43>
+            putch(padc, put_arg);
+  80034a:	4c 89 ee             	mov    %r13,%rsi
+  80034d:	44 89 f7             	mov    %r14d,%edi
+  800350:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800353:	83 eb 01             	sub    $0x1,%ebx
+  800356:	75 f2                	jne    80034a <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800358:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80035c:	48 b9 dc 52 80 00 00 	movabs $0x8052dc,%rcx
+  800363:	00 00 00 
+  800366:	48 b8 cb 52 80 00 00 	movabs $0x8052cb,%rax
+  80036d:	00 00 00 
+  800370:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800374:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800378:	ba 00 00 00 00       	mov    $0x0,%edx
+  80037d:	49 f7 f7             	div    %r15
+  800380:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800384:	4c 89 ee             	mov    %r13,%rsi
+  800387:	41 ff d4             	call   *%r12
+}
+  80038a:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80038e:	5b                   	pop    %rbx
+  80038f:	41 5c                	pop    %r12
+  800391:	41 5d                	pop    %r13
+  800393:	41 5e                	pop    %r14
+  800395:	41 5f                	pop    %r15
+  800397:	5d                   	pop    %rbp
+  800398:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800399:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80039d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003a2:	49 f7 f7             	div    %r15
+  8003a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8003a9:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8003ad:	52                   	push   %rdx
+  8003ae:	45 0f be c9          	movsbl %r9b,%r9d
+  8003b2:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8003b6:	48 89 c2             	mov    %rax,%rdx
+  8003b9:	48 b8 15 03 80 00 00 	movabs $0x800315,%rax
+  8003c0:	00 00 00 
+  8003c3:	ff d0                	call   *%rax
+  8003c5:	48 83 c4 10          	add    $0x10,%rsp
+  8003c9:	eb 8d                	jmp    800358 <print_num+0x43>
+
+00000000008003cb <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8003cb:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8003cf:	48 8b 06             	mov    (%rsi),%rax
+  8003d2:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8003d6:	73 0a                	jae    8003e2 <sprintputch+0x17>
+        *state->start++ = ch;
+  8003d8:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8003dc:	48 89 16             	mov    %rdx,(%rsi)
+  8003df:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8003e2:	c3                   	ret
+
+00000000008003e3 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8003e3:	55                   	push   %rbp
+  8003e4:	48 89 e5             	mov    %rsp,%rbp
+  8003e7:	48 83 ec 50          	sub    $0x50,%rsp
+  8003eb:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8003ef:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8003f3:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8003f7:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8003fe:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800402:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800406:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80040a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80040e:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800412:	48 b8 20 04 80 00 00 	movabs $0x800420,%rax
+  800419:	00 00 00 
+  80041c:	ff d0                	call   *%rax
+}
+  80041e:	c9                   	leave
+  80041f:	c3                   	ret
+
+0000000000800420 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800420:	55                   	push   %rbp
+  800421:	48 89 e5             	mov    %rsp,%rbp
+  800424:	41 57                	push   %r15
+  800426:	41 56                	push   %r14
+  800428:	41 55                	push   %r13
+  80042a:	41 54                	push   %r12
+  80042c:	53                   	push   %rbx
+  80042d:	48 83 ec 38          	sub    $0x38,%rsp
+  800431:	49 89 fe             	mov    %rdi,%r14
+  800434:	49 89 f5             	mov    %rsi,%r13
+  800437:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80043a:	48 8b 01             	mov    (%rcx),%rax
+  80043d:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800441:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800445:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800449:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80044d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800451:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800455:	0f b6 3b             	movzbl (%rbx),%edi
+  800458:	40 80 ff 25          	cmp    $0x25,%dil
+  80045c:	74 18                	je     800476 <vprintfmt+0x56>
+            if (!ch) return;
+  80045e:	40 84 ff             	test   %dil,%dil
+  800461:	0f 84 b1 06 00 00    	je     800b18 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800467:	40 0f b6 ff          	movzbl %dil,%edi
+  80046b:	4c 89 ee             	mov    %r13,%rsi
+  80046e:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800471:	4c 89 e3             	mov    %r12,%rbx
+  800474:	eb db                	jmp    800451 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800476:	be 00 00 00 00       	mov    $0x0,%esi
+  80047b:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80047f:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800484:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80048a:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800491:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800495:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80049a:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80049f:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8004a2:	83 e8 23             	sub    $0x23,%eax
+  8004a5:	3c 57                	cmp    $0x57,%al
+  8004a7:	0f 87 51 06 00 00    	ja     800afe <vprintfmt+0x6de>
+  8004ad:	0f b6 c0             	movzbl %al,%eax
+  8004b0:	48 b9 80 54 80 00 00 	movabs $0x805480,%rcx
+  8004b7:	00 00 00 
+  8004ba:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8004bd:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8004c0:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8004c4:	eb cf                	jmp    800495 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8004c6:	49 89 dc             	mov    %rbx,%r12
+  8004c9:	be 01 00 00 00       	mov    $0x1,%esi
+  8004ce:	eb c5                	jmp    800495 <vprintfmt+0x75>
+            padc = ch;
+  8004d0:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8004d4:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8004d7:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004da:	eb b9                	jmp    800495 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8004dc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004df:	83 f8 2f             	cmp    $0x2f,%eax
+  8004e2:	77 24                	ja     800508 <vprintfmt+0xe8>
+  8004e4:	89 c1                	mov    %eax,%ecx
+  8004e6:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8004ea:	83 c0 08             	add    $0x8,%eax
+  8004ed:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8004f0:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8004f3:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8004f6:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8004fa:	79 99                	jns    800495 <vprintfmt+0x75>
+                width = precision;
+  8004fc:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800500:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800506:	eb 8d                	jmp    800495 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800508:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80050c:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800510:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800514:	eb da                	jmp    8004f0 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800516:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  80051b:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80051f:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800525:	3c 39                	cmp    $0x39,%al
+  800527:	77 1c                	ja     800545 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800529:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80052d:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800531:	0f b6 c0             	movzbl %al,%eax
+  800534:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800539:	0f b6 03             	movzbl (%rbx),%eax
+  80053c:	3c 39                	cmp    $0x39,%al
+  80053e:	76 e9                	jbe    800529 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800540:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800543:	eb b1                	jmp    8004f6 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800545:	49 89 dc             	mov    %rbx,%r12
+  800548:	eb ac                	jmp    8004f6 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80054a:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80054d:	85 c9                	test   %ecx,%ecx
+  80054f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800554:	0f 49 c1             	cmovns %ecx,%eax
+  800557:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80055a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80055d:	e9 33 ff ff ff       	jmp    800495 <vprintfmt+0x75>
+            lflag++;
+  800562:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800565:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800568:	e9 28 ff ff ff       	jmp    800495 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80056d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800570:	83 f8 2f             	cmp    $0x2f,%eax
+  800573:	77 19                	ja     80058e <vprintfmt+0x16e>
+  800575:	89 c2                	mov    %eax,%edx
+  800577:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80057b:	83 c0 08             	add    $0x8,%eax
+  80057e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800581:	8b 3a                	mov    (%rdx),%edi
+  800583:	4c 89 ee             	mov    %r13,%rsi
+  800586:	41 ff d6             	call   *%r14
+            break;
+  800589:	e9 c3 fe ff ff       	jmp    800451 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80058e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800592:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800596:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80059a:	eb e5                	jmp    800581 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80059c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80059f:	83 f8 2f             	cmp    $0x2f,%eax
+  8005a2:	77 5a                	ja     8005fe <vprintfmt+0x1de>
+  8005a4:	89 c2                	mov    %eax,%edx
+  8005a6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005aa:	83 c0 08             	add    $0x8,%eax
+  8005ad:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8005b0:	8b 02                	mov    (%rdx),%eax
+  8005b2:	89 c1                	mov    %eax,%ecx
+  8005b4:	f7 d9                	neg    %ecx
+  8005b6:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8005b9:	83 f9 16             	cmp    $0x16,%ecx
+  8005bc:	7f 4e                	jg     80060c <vprintfmt+0x1ec>
+  8005be:	48 63 c1             	movslq %ecx,%rax
+  8005c1:	48 ba 40 57 80 00 00 	movabs $0x805740,%rdx
+  8005c8:	00 00 00 
+  8005cb:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8005cf:	48 85 c0             	test   %rax,%rax
+  8005d2:	74 38                	je     80060c <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8005d4:	48 89 c1             	mov    %rax,%rcx
+  8005d7:	48 ba e3 59 80 00 00 	movabs $0x8059e3,%rdx
+  8005de:	00 00 00 
+  8005e1:	4c 89 ee             	mov    %r13,%rsi
+  8005e4:	4c 89 f7             	mov    %r14,%rdi
+  8005e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005ec:	49 b8 e3 03 80 00 00 	movabs $0x8003e3,%r8
+  8005f3:	00 00 00 
+  8005f6:	41 ff d0             	call   *%r8
+  8005f9:	e9 53 fe ff ff       	jmp    800451 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8005fe:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800602:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800606:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80060a:	eb a4                	jmp    8005b0 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80060c:	48 ba f4 52 80 00 00 	movabs $0x8052f4,%rdx
+  800613:	00 00 00 
+  800616:	4c 89 ee             	mov    %r13,%rsi
+  800619:	4c 89 f7             	mov    %r14,%rdi
+  80061c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800621:	49 b8 e3 03 80 00 00 	movabs $0x8003e3,%r8
+  800628:	00 00 00 
+  80062b:	41 ff d0             	call   *%r8
+  80062e:	e9 1e fe ff ff       	jmp    800451 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800633:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800636:	83 f8 2f             	cmp    $0x2f,%eax
+  800639:	77 6c                	ja     8006a7 <vprintfmt+0x287>
+  80063b:	89 c2                	mov    %eax,%edx
+  80063d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800641:	83 c0 08             	add    $0x8,%eax
+  800644:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800647:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  80064a:	48 85 d2             	test   %rdx,%rdx
+  80064d:	48 b8 ed 52 80 00 00 	movabs $0x8052ed,%rax
+  800654:	00 00 00 
+  800657:	48 0f 45 c2          	cmovne %rdx,%rax
+  80065b:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80065f:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800663:	7e 06                	jle    80066b <vprintfmt+0x24b>
+  800665:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800669:	75 4a                	jne    8006b5 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80066b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80066f:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800673:	0f b6 00             	movzbl (%rax),%eax
+  800676:	84 c0                	test   %al,%al
+  800678:	0f 85 9a 00 00 00    	jne    800718 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80067e:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800681:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800685:	85 c0                	test   %eax,%eax
+  800687:	0f 8e c4 fd ff ff    	jle    800451 <vprintfmt+0x31>
+  80068d:	4c 89 ee             	mov    %r13,%rsi
+  800690:	bf 20 00 00 00       	mov    $0x20,%edi
+  800695:	41 ff d6             	call   *%r14
+  800698:	41 83 ec 01          	sub    $0x1,%r12d
+  80069c:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8006a0:	75 eb                	jne    80068d <vprintfmt+0x26d>
+  8006a2:	e9 aa fd ff ff       	jmp    800451 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8006a7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006ab:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006af:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006b3:	eb 92                	jmp    800647 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8006b5:	49 63 f7             	movslq %r15d,%rsi
+  8006b8:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8006bc:	48 b8 d2 0b 80 00 00 	movabs $0x800bd2,%rax
+  8006c3:	00 00 00 
+  8006c6:	ff d0                	call   *%rax
+  8006c8:	48 89 c2             	mov    %rax,%rdx
+  8006cb:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006ce:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8006d0:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8006d3:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8006d6:	85 c0                	test   %eax,%eax
+  8006d8:	7e 91                	jle    80066b <vprintfmt+0x24b>
+  8006da:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8006df:	4c 89 ee             	mov    %r13,%rsi
+  8006e2:	44 89 e7             	mov    %r12d,%edi
+  8006e5:	41 ff d6             	call   *%r14
+  8006e8:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8006ec:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006ef:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8006f2:	75 eb                	jne    8006df <vprintfmt+0x2bf>
+  8006f4:	e9 72 ff ff ff       	jmp    80066b <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8006f9:	0f b6 f8             	movzbl %al,%edi
+  8006fc:	4c 89 ee             	mov    %r13,%rsi
+  8006ff:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800702:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800706:	49 83 c4 01          	add    $0x1,%r12
+  80070a:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800710:	84 c0                	test   %al,%al
+  800712:	0f 84 66 ff ff ff    	je     80067e <vprintfmt+0x25e>
+  800718:	45 85 ff             	test   %r15d,%r15d
+  80071b:	78 0a                	js     800727 <vprintfmt+0x307>
+  80071d:	41 83 ef 01          	sub    $0x1,%r15d
+  800721:	0f 88 57 ff ff ff    	js     80067e <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800727:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  80072b:	74 cc                	je     8006f9 <vprintfmt+0x2d9>
+  80072d:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800730:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800735:	80 fa 5e             	cmp    $0x5e,%dl
+  800738:	77 c2                	ja     8006fc <vprintfmt+0x2dc>
+  80073a:	eb bd                	jmp    8006f9 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  80073c:	40 84 f6             	test   %sil,%sil
+  80073f:	75 26                	jne    800767 <vprintfmt+0x347>
+    switch (lflag) {
+  800741:	85 d2                	test   %edx,%edx
+  800743:	74 59                	je     80079e <vprintfmt+0x37e>
+  800745:	83 fa 01             	cmp    $0x1,%edx
+  800748:	74 7b                	je     8007c5 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  80074a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80074d:	83 f8 2f             	cmp    $0x2f,%eax
+  800750:	0f 87 96 00 00 00    	ja     8007ec <vprintfmt+0x3cc>
+  800756:	89 c2                	mov    %eax,%edx
+  800758:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80075c:	83 c0 08             	add    $0x8,%eax
+  80075f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800762:	4c 8b 22             	mov    (%rdx),%r12
+  800765:	eb 17                	jmp    80077e <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800767:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80076a:	83 f8 2f             	cmp    $0x2f,%eax
+  80076d:	77 21                	ja     800790 <vprintfmt+0x370>
+  80076f:	89 c2                	mov    %eax,%edx
+  800771:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800775:	83 c0 08             	add    $0x8,%eax
+  800778:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80077b:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80077e:	4d 85 e4             	test   %r12,%r12
+  800781:	78 7a                	js     8007fd <vprintfmt+0x3dd>
+            num = i;
+  800783:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800786:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80078b:	e9 50 02 00 00       	jmp    8009e0 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800790:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800794:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800798:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80079c:	eb dd                	jmp    80077b <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  80079e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007a1:	83 f8 2f             	cmp    $0x2f,%eax
+  8007a4:	77 11                	ja     8007b7 <vprintfmt+0x397>
+  8007a6:	89 c2                	mov    %eax,%edx
+  8007a8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007ac:	83 c0 08             	add    $0x8,%eax
+  8007af:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007b2:	4c 63 22             	movslq (%rdx),%r12
+  8007b5:	eb c7                	jmp    80077e <vprintfmt+0x35e>
+  8007b7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007bb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007bf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007c3:	eb ed                	jmp    8007b2 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8007c5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007c8:	83 f8 2f             	cmp    $0x2f,%eax
+  8007cb:	77 11                	ja     8007de <vprintfmt+0x3be>
+  8007cd:	89 c2                	mov    %eax,%edx
+  8007cf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007d3:	83 c0 08             	add    $0x8,%eax
+  8007d6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007d9:	4c 8b 22             	mov    (%rdx),%r12
+  8007dc:	eb a0                	jmp    80077e <vprintfmt+0x35e>
+  8007de:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007e2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007e6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007ea:	eb ed                	jmp    8007d9 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8007ec:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007f0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007f4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007f8:	e9 65 ff ff ff       	jmp    800762 <vprintfmt+0x342>
+                putch('-', put_arg);
+  8007fd:	4c 89 ee             	mov    %r13,%rsi
+  800800:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800805:	41 ff d6             	call   *%r14
+                i = -i;
+  800808:	49 f7 dc             	neg    %r12
+  80080b:	e9 73 ff ff ff       	jmp    800783 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800810:	40 84 f6             	test   %sil,%sil
+  800813:	75 32                	jne    800847 <vprintfmt+0x427>
+    switch (lflag) {
+  800815:	85 d2                	test   %edx,%edx
+  800817:	74 5d                	je     800876 <vprintfmt+0x456>
+  800819:	83 fa 01             	cmp    $0x1,%edx
+  80081c:	0f 84 82 00 00 00    	je     8008a4 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800822:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800825:	83 f8 2f             	cmp    $0x2f,%eax
+  800828:	0f 87 a5 00 00 00    	ja     8008d3 <vprintfmt+0x4b3>
+  80082e:	89 c2                	mov    %eax,%edx
+  800830:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800834:	83 c0 08             	add    $0x8,%eax
+  800837:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80083a:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80083d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800842:	e9 99 01 00 00       	jmp    8009e0 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800847:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80084a:	83 f8 2f             	cmp    $0x2f,%eax
+  80084d:	77 19                	ja     800868 <vprintfmt+0x448>
+  80084f:	89 c2                	mov    %eax,%edx
+  800851:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800855:	83 c0 08             	add    $0x8,%eax
+  800858:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80085b:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80085e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800863:	e9 78 01 00 00       	jmp    8009e0 <vprintfmt+0x5c0>
+  800868:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80086c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800870:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800874:	eb e5                	jmp    80085b <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800876:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800879:	83 f8 2f             	cmp    $0x2f,%eax
+  80087c:	77 18                	ja     800896 <vprintfmt+0x476>
+  80087e:	89 c2                	mov    %eax,%edx
+  800880:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800884:	83 c0 08             	add    $0x8,%eax
+  800887:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80088a:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80088c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800891:	e9 4a 01 00 00       	jmp    8009e0 <vprintfmt+0x5c0>
+  800896:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80089a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80089e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008a2:	eb e6                	jmp    80088a <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8008a4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008a7:	83 f8 2f             	cmp    $0x2f,%eax
+  8008aa:	77 19                	ja     8008c5 <vprintfmt+0x4a5>
+  8008ac:	89 c2                	mov    %eax,%edx
+  8008ae:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008b2:	83 c0 08             	add    $0x8,%eax
+  8008b5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008b8:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8008bb:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8008c0:	e9 1b 01 00 00       	jmp    8009e0 <vprintfmt+0x5c0>
+  8008c5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008c9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008cd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008d1:	eb e5                	jmp    8008b8 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8008d3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008d7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008db:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008df:	e9 56 ff ff ff       	jmp    80083a <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8008e4:	40 84 f6             	test   %sil,%sil
+  8008e7:	75 2e                	jne    800917 <vprintfmt+0x4f7>
+    switch (lflag) {
+  8008e9:	85 d2                	test   %edx,%edx
+  8008eb:	74 59                	je     800946 <vprintfmt+0x526>
+  8008ed:	83 fa 01             	cmp    $0x1,%edx
+  8008f0:	74 7f                	je     800971 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8008f2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008f5:	83 f8 2f             	cmp    $0x2f,%eax
+  8008f8:	0f 87 9f 00 00 00    	ja     80099d <vprintfmt+0x57d>
+  8008fe:	89 c2                	mov    %eax,%edx
+  800900:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800904:	83 c0 08             	add    $0x8,%eax
+  800907:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80090a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80090d:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800912:	e9 c9 00 00 00       	jmp    8009e0 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800917:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80091a:	83 f8 2f             	cmp    $0x2f,%eax
+  80091d:	77 19                	ja     800938 <vprintfmt+0x518>
+  80091f:	89 c2                	mov    %eax,%edx
+  800921:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800925:	83 c0 08             	add    $0x8,%eax
+  800928:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80092b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80092e:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800933:	e9 a8 00 00 00       	jmp    8009e0 <vprintfmt+0x5c0>
+  800938:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80093c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800940:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800944:	eb e5                	jmp    80092b <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800946:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800949:	83 f8 2f             	cmp    $0x2f,%eax
+  80094c:	77 15                	ja     800963 <vprintfmt+0x543>
+  80094e:	89 c2                	mov    %eax,%edx
+  800950:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800954:	83 c0 08             	add    $0x8,%eax
+  800957:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80095a:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  80095c:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800961:	eb 7d                	jmp    8009e0 <vprintfmt+0x5c0>
+  800963:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800967:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80096b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80096f:	eb e9                	jmp    80095a <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800971:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800974:	83 f8 2f             	cmp    $0x2f,%eax
+  800977:	77 16                	ja     80098f <vprintfmt+0x56f>
+  800979:	89 c2                	mov    %eax,%edx
+  80097b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80097f:	83 c0 08             	add    $0x8,%eax
+  800982:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800985:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800988:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  80098d:	eb 51                	jmp    8009e0 <vprintfmt+0x5c0>
+  80098f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800993:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800997:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80099b:	eb e8                	jmp    800985 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  80099d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009a1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009a5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009a9:	e9 5c ff ff ff       	jmp    80090a <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8009ae:	4c 89 ee             	mov    %r13,%rsi
+  8009b1:	bf 30 00 00 00       	mov    $0x30,%edi
+  8009b6:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8009b9:	4c 89 ee             	mov    %r13,%rsi
+  8009bc:	bf 78 00 00 00       	mov    $0x78,%edi
+  8009c1:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8009c4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009c7:	83 f8 2f             	cmp    $0x2f,%eax
+  8009ca:	77 47                	ja     800a13 <vprintfmt+0x5f3>
+  8009cc:	89 c2                	mov    %eax,%edx
+  8009ce:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009d2:	83 c0 08             	add    $0x8,%eax
+  8009d5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009d8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009db:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8009e0:	48 83 ec 08          	sub    $0x8,%rsp
+  8009e4:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8009e8:	0f 94 c0             	sete   %al
+  8009eb:	0f b6 c0             	movzbl %al,%eax
+  8009ee:	50                   	push   %rax
+  8009ef:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8009f4:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8009f8:	4c 89 ee             	mov    %r13,%rsi
+  8009fb:	4c 89 f7             	mov    %r14,%rdi
+  8009fe:	48 b8 15 03 80 00 00 	movabs $0x800315,%rax
+  800a05:	00 00 00 
+  800a08:	ff d0                	call   *%rax
+            break;
+  800a0a:	48 83 c4 10          	add    $0x10,%rsp
+  800a0e:	e9 3e fa ff ff       	jmp    800451 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800a13:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a17:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a1b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a1f:	eb b7                	jmp    8009d8 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800a21:	40 84 f6             	test   %sil,%sil
+  800a24:	75 2b                	jne    800a51 <vprintfmt+0x631>
+    switch (lflag) {
+  800a26:	85 d2                	test   %edx,%edx
+  800a28:	74 56                	je     800a80 <vprintfmt+0x660>
+  800a2a:	83 fa 01             	cmp    $0x1,%edx
+  800a2d:	74 7f                	je     800aae <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800a2f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a32:	83 f8 2f             	cmp    $0x2f,%eax
+  800a35:	0f 87 a2 00 00 00    	ja     800add <vprintfmt+0x6bd>
+  800a3b:	89 c2                	mov    %eax,%edx
+  800a3d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a41:	83 c0 08             	add    $0x8,%eax
+  800a44:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a47:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a4a:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a4f:	eb 8f                	jmp    8009e0 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a51:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a54:	83 f8 2f             	cmp    $0x2f,%eax
+  800a57:	77 19                	ja     800a72 <vprintfmt+0x652>
+  800a59:	89 c2                	mov    %eax,%edx
+  800a5b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a5f:	83 c0 08             	add    $0x8,%eax
+  800a62:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a65:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a68:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a6d:	e9 6e ff ff ff       	jmp    8009e0 <vprintfmt+0x5c0>
+  800a72:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a76:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a7a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a7e:	eb e5                	jmp    800a65 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800a80:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a83:	83 f8 2f             	cmp    $0x2f,%eax
+  800a86:	77 18                	ja     800aa0 <vprintfmt+0x680>
+  800a88:	89 c2                	mov    %eax,%edx
+  800a8a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a8e:	83 c0 08             	add    $0x8,%eax
+  800a91:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a94:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800a96:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800a9b:	e9 40 ff ff ff       	jmp    8009e0 <vprintfmt+0x5c0>
+  800aa0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aa4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aa8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aac:	eb e6                	jmp    800a94 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800aae:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ab1:	83 f8 2f             	cmp    $0x2f,%eax
+  800ab4:	77 19                	ja     800acf <vprintfmt+0x6af>
+  800ab6:	89 c2                	mov    %eax,%edx
+  800ab8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800abc:	83 c0 08             	add    $0x8,%eax
+  800abf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ac2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ac5:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800aca:	e9 11 ff ff ff       	jmp    8009e0 <vprintfmt+0x5c0>
+  800acf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ad3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ad7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800adb:	eb e5                	jmp    800ac2 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800add:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ae1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ae5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ae9:	e9 59 ff ff ff       	jmp    800a47 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800aee:	4c 89 ee             	mov    %r13,%rsi
+  800af1:	bf 25 00 00 00       	mov    $0x25,%edi
+  800af6:	41 ff d6             	call   *%r14
+            break;
+  800af9:	e9 53 f9 ff ff       	jmp    800451 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800afe:	4c 89 ee             	mov    %r13,%rsi
+  800b01:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b06:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800b09:	48 83 eb 01          	sub    $0x1,%rbx
+  800b0d:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800b11:	75 f6                	jne    800b09 <vprintfmt+0x6e9>
+  800b13:	e9 39 f9 ff ff       	jmp    800451 <vprintfmt+0x31>
+}
+  800b18:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800b1c:	5b                   	pop    %rbx
+  800b1d:	41 5c                	pop    %r12
+  800b1f:	41 5d                	pop    %r13
+  800b21:	41 5e                	pop    %r14
+  800b23:	41 5f                	pop    %r15
+  800b25:	5d                   	pop    %rbp
+  800b26:	c3                   	ret
+
+0000000000800b27 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800b27:	55                   	push   %rbp
+  800b28:	48 89 e5             	mov    %rsp,%rbp
+  800b2b:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800b2f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800b33:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800b38:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800b3c:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800b43:	48 85 ff             	test   %rdi,%rdi
+  800b46:	74 2b                	je     800b73 <vsnprintf+0x4c>
+  800b48:	48 85 f6             	test   %rsi,%rsi
+  800b4b:	74 26                	je     800b73 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800b4d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800b51:	48 bf cb 03 80 00 00 	movabs $0x8003cb,%rdi
+  800b58:	00 00 00 
+  800b5b:	48 b8 20 04 80 00 00 	movabs $0x800420,%rax
+  800b62:	00 00 00 
+  800b65:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800b67:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b6b:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800b6e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800b71:	c9                   	leave
+  800b72:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800b73:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b78:	eb f7                	jmp    800b71 <vsnprintf+0x4a>
+
+0000000000800b7a <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800b7a:	55                   	push   %rbp
+  800b7b:	48 89 e5             	mov    %rsp,%rbp
+  800b7e:	48 83 ec 50          	sub    $0x50,%rsp
+  800b82:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800b86:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800b8a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800b8e:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800b95:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800b99:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b9d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800ba1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800ba5:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800ba9:	48 b8 27 0b 80 00 00 	movabs $0x800b27,%rax
+  800bb0:	00 00 00 
+  800bb3:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800bb5:	c9                   	leave
+  800bb6:	c3                   	ret
+
+0000000000800bb7 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800bb7:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800bba:	74 10                	je     800bcc <strlen+0x15>
+    size_t n = 0;
+  800bbc:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800bc1:	48 83 c0 01          	add    $0x1,%rax
+  800bc5:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800bc9:	75 f6                	jne    800bc1 <strlen+0xa>
+  800bcb:	c3                   	ret
+    size_t n = 0;
+  800bcc:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800bd1:	c3                   	ret
+
+0000000000800bd2 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800bd2:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800bd5:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800bda:	48 85 f6             	test   %rsi,%rsi
+  800bdd:	74 11                	je     800bf0 <strnlen+0x1e>
+  800bdf:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800be3:	74 0c                	je     800bf1 <strnlen+0x1f>
+  800be5:	48 83 c2 01          	add    $0x1,%rdx
+  800be9:	48 39 d0             	cmp    %rdx,%rax
+  800bec:	75 f1                	jne    800bdf <strnlen+0xd>
+  800bee:	eb 04                	jmp    800bf4 <strnlen+0x22>
+  800bf0:	c3                   	ret
+  800bf1:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800bf4:	c3                   	ret
+
+0000000000800bf5 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800bf5:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800bf8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bfd:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800c01:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800c04:	48 83 c2 01          	add    $0x1,%rdx
+  800c08:	84 c9                	test   %cl,%cl
+  800c0a:	75 f1                	jne    800bfd <strcpy+0x8>
+        ;
+    return res;
+}
+  800c0c:	c3                   	ret
+
+0000000000800c0d <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800c0d:	55                   	push   %rbp
+  800c0e:	48 89 e5             	mov    %rsp,%rbp
+  800c11:	41 54                	push   %r12
+  800c13:	53                   	push   %rbx
+  800c14:	48 89 fb             	mov    %rdi,%rbx
+  800c17:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800c1a:	48 b8 b7 0b 80 00 00 	movabs $0x800bb7,%rax
+  800c21:	00 00 00 
+  800c24:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800c26:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800c2a:	4c 89 e6             	mov    %r12,%rsi
+  800c2d:	48 b8 f5 0b 80 00 00 	movabs $0x800bf5,%rax
+  800c34:	00 00 00 
+  800c37:	ff d0                	call   *%rax
+    return dst;
+}
+  800c39:	48 89 d8             	mov    %rbx,%rax
+  800c3c:	5b                   	pop    %rbx
+  800c3d:	41 5c                	pop    %r12
+  800c3f:	5d                   	pop    %rbp
+  800c40:	c3                   	ret
+
+0000000000800c41 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800c41:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800c44:	48 85 d2             	test   %rdx,%rdx
+  800c47:	74 1f                	je     800c68 <strncpy+0x27>
+  800c49:	48 01 fa             	add    %rdi,%rdx
+  800c4c:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800c4f:	48 83 c1 01          	add    $0x1,%rcx
+  800c53:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800c57:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800c5b:	41 80 f8 01          	cmp    $0x1,%r8b
+  800c5f:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800c63:	48 39 ca             	cmp    %rcx,%rdx
+  800c66:	75 e7                	jne    800c4f <strncpy+0xe>
+    }
+    return ret;
+}
+  800c68:	c3                   	ret
+
+0000000000800c69 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800c69:	48 89 f8             	mov    %rdi,%rax
+  800c6c:	48 85 d2             	test   %rdx,%rdx
+  800c6f:	74 24                	je     800c95 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800c71:	48 83 ea 01          	sub    $0x1,%rdx
+  800c75:	74 1b                	je     800c92 <strlcpy+0x29>
+  800c77:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800c7b:	0f b6 16             	movzbl (%rsi),%edx
+  800c7e:	84 d2                	test   %dl,%dl
+  800c80:	74 10                	je     800c92 <strlcpy+0x29>
+            *dst++ = *src++;
+  800c82:	48 83 c6 01          	add    $0x1,%rsi
+  800c86:	48 83 c0 01          	add    $0x1,%rax
+  800c8a:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800c8d:	48 39 c8             	cmp    %rcx,%rax
+  800c90:	75 e9                	jne    800c7b <strlcpy+0x12>
+        *dst = '\0';
+  800c92:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800c95:	48 29 f8             	sub    %rdi,%rax
+}
+  800c98:	c3                   	ret
+
+0000000000800c99 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800c99:	0f b6 07             	movzbl (%rdi),%eax
+  800c9c:	84 c0                	test   %al,%al
+  800c9e:	74 13                	je     800cb3 <strcmp+0x1a>
+  800ca0:	38 06                	cmp    %al,(%rsi)
+  800ca2:	75 0f                	jne    800cb3 <strcmp+0x1a>
+  800ca4:	48 83 c7 01          	add    $0x1,%rdi
+  800ca8:	48 83 c6 01          	add    $0x1,%rsi
+  800cac:	0f b6 07             	movzbl (%rdi),%eax
+  800caf:	84 c0                	test   %al,%al
+  800cb1:	75 ed                	jne    800ca0 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800cb3:	0f b6 c0             	movzbl %al,%eax
+  800cb6:	0f b6 16             	movzbl (%rsi),%edx
+  800cb9:	29 d0                	sub    %edx,%eax
+}
+  800cbb:	c3                   	ret
+
+0000000000800cbc <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800cbc:	48 85 d2             	test   %rdx,%rdx
+  800cbf:	74 1f                	je     800ce0 <strncmp+0x24>
+  800cc1:	0f b6 07             	movzbl (%rdi),%eax
+  800cc4:	84 c0                	test   %al,%al
+  800cc6:	74 1e                	je     800ce6 <strncmp+0x2a>
+  800cc8:	3a 06                	cmp    (%rsi),%al
+  800cca:	75 1a                	jne    800ce6 <strncmp+0x2a>
+  800ccc:	48 83 c7 01          	add    $0x1,%rdi
+  800cd0:	48 83 c6 01          	add    $0x1,%rsi
+  800cd4:	48 83 ea 01          	sub    $0x1,%rdx
+  800cd8:	75 e7                	jne    800cc1 <strncmp+0x5>
+
+    if (!n) return 0;
+  800cda:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cdf:	c3                   	ret
+  800ce0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ce5:	c3                   	ret
+  800ce6:	48 85 d2             	test   %rdx,%rdx
+  800ce9:	74 09                	je     800cf4 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800ceb:	0f b6 07             	movzbl (%rdi),%eax
+  800cee:	0f b6 16             	movzbl (%rsi),%edx
+  800cf1:	29 d0                	sub    %edx,%eax
+  800cf3:	c3                   	ret
+    if (!n) return 0;
+  800cf4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800cf9:	c3                   	ret
+
+0000000000800cfa <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800cfa:	0f b6 17             	movzbl (%rdi),%edx
+  800cfd:	84 d2                	test   %dl,%dl
+  800cff:	74 18                	je     800d19 <strchr+0x1f>
+        if (*str == c) {
+  800d01:	0f be d2             	movsbl %dl,%edx
+  800d04:	39 f2                	cmp    %esi,%edx
+  800d06:	74 17                	je     800d1f <strchr+0x25>
+    for (; *str; str++) {
+  800d08:	48 83 c7 01          	add    $0x1,%rdi
+  800d0c:	0f b6 17             	movzbl (%rdi),%edx
+  800d0f:	84 d2                	test   %dl,%dl
+  800d11:	75 ee                	jne    800d01 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800d13:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d18:	c3                   	ret
+  800d19:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d1e:	c3                   	ret
+  800d1f:	48 89 f8             	mov    %rdi,%rax
+}
+  800d22:	c3                   	ret
+
+0000000000800d23 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800d23:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800d26:	0f b6 17             	movzbl (%rdi),%edx
+  800d29:	84 d2                	test   %dl,%dl
+  800d2b:	74 13                	je     800d40 <strfind+0x1d>
+  800d2d:	0f be d2             	movsbl %dl,%edx
+  800d30:	39 f2                	cmp    %esi,%edx
+  800d32:	74 0b                	je     800d3f <strfind+0x1c>
+  800d34:	48 83 c0 01          	add    $0x1,%rax
+  800d38:	0f b6 10             	movzbl (%rax),%edx
+  800d3b:	84 d2                	test   %dl,%dl
+  800d3d:	75 ee                	jne    800d2d <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800d3f:	c3                   	ret
+  800d40:	c3                   	ret
+
+0000000000800d41 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800d41:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800d44:	48 89 f8             	mov    %rdi,%rax
+  800d47:	48 f7 d8             	neg    %rax
+  800d4a:	83 e0 07             	and    $0x7,%eax
+  800d4d:	49 89 d1             	mov    %rdx,%r9
+  800d50:	49 29 c1             	sub    %rax,%r9
+  800d53:	78 36                	js     800d8b <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800d55:	40 0f b6 c6          	movzbl %sil,%eax
+  800d59:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800d60:	01 01 01 
+  800d63:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800d67:	40 f6 c7 07          	test   $0x7,%dil
+  800d6b:	75 38                	jne    800da5 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800d6d:	4c 89 c9             	mov    %r9,%rcx
+  800d70:	48 c1 f9 03          	sar    $0x3,%rcx
+  800d74:	74 0c                	je     800d82 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800d76:	fc                   	cld
+  800d77:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800d7a:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800d7e:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800d82:	4d 85 c9             	test   %r9,%r9
+  800d85:	75 45                	jne    800dcc <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800d87:	4c 89 c0             	mov    %r8,%rax
+  800d8a:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800d8b:	48 85 d2             	test   %rdx,%rdx
+  800d8e:	74 f7                	je     800d87 <memset+0x46>
+  800d90:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800d93:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800d96:	48 83 c0 01          	add    $0x1,%rax
+  800d9a:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800d9e:	48 39 c2             	cmp    %rax,%rdx
+  800da1:	75 f3                	jne    800d96 <memset+0x55>
+  800da3:	eb e2                	jmp    800d87 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800da5:	40 f6 c7 01          	test   $0x1,%dil
+  800da9:	74 06                	je     800db1 <memset+0x70>
+  800dab:	88 07                	mov    %al,(%rdi)
+  800dad:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800db1:	40 f6 c7 02          	test   $0x2,%dil
+  800db5:	74 07                	je     800dbe <memset+0x7d>
+  800db7:	66 89 07             	mov    %ax,(%rdi)
+  800dba:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800dbe:	40 f6 c7 04          	test   $0x4,%dil
+  800dc2:	74 a9                	je     800d6d <memset+0x2c>
+  800dc4:	89 07                	mov    %eax,(%rdi)
+  800dc6:	48 83 c7 04          	add    $0x4,%rdi
+  800dca:	eb a1                	jmp    800d6d <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800dcc:	41 f6 c1 04          	test   $0x4,%r9b
+  800dd0:	74 06                	je     800dd8 <memset+0x97>
+  800dd2:	89 07                	mov    %eax,(%rdi)
+  800dd4:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800dd8:	41 f6 c1 02          	test   $0x2,%r9b
+  800ddc:	74 07                	je     800de5 <memset+0xa4>
+  800dde:	66 89 07             	mov    %ax,(%rdi)
+  800de1:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800de5:	41 f6 c1 01          	test   $0x1,%r9b
+  800de9:	74 9c                	je     800d87 <memset+0x46>
+  800deb:	88 07                	mov    %al,(%rdi)
+  800ded:	eb 98                	jmp    800d87 <memset+0x46>
+
+0000000000800def <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800def:	48 89 f8             	mov    %rdi,%rax
+  800df2:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800df5:	48 39 fe             	cmp    %rdi,%rsi
+  800df8:	73 3b                	jae    800e35 <memmove+0x46>
+  800dfa:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800dfe:	48 39 d7             	cmp    %rdx,%rdi
+  800e01:	73 32                	jae    800e35 <memmove+0x46>
+        s += n;
+        d += n;
+  800e03:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800e07:	48 89 d6             	mov    %rdx,%rsi
+  800e0a:	48 09 fe             	or     %rdi,%rsi
+  800e0d:	48 09 ce             	or     %rcx,%rsi
+  800e10:	40 f6 c6 07          	test   $0x7,%sil
+  800e14:	75 12                	jne    800e28 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800e16:	48 83 ef 08          	sub    $0x8,%rdi
+  800e1a:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800e1e:	48 c1 e9 03          	shr    $0x3,%rcx
+  800e22:	fd                   	std
+  800e23:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800e26:	fc                   	cld
+  800e27:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800e28:	48 83 ef 01          	sub    $0x1,%rdi
+  800e2c:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800e30:	fd                   	std
+  800e31:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800e33:	eb f1                	jmp    800e26 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800e35:	48 89 f2             	mov    %rsi,%rdx
+  800e38:	48 09 c2             	or     %rax,%rdx
+  800e3b:	48 09 ca             	or     %rcx,%rdx
+  800e3e:	f6 c2 07             	test   $0x7,%dl
+  800e41:	75 0c                	jne    800e4f <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800e43:	48 c1 e9 03          	shr    $0x3,%rcx
+  800e47:	48 89 c7             	mov    %rax,%rdi
+  800e4a:	fc                   	cld
+  800e4b:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800e4e:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800e4f:	48 89 c7             	mov    %rax,%rdi
+  800e52:	fc                   	cld
+  800e53:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800e55:	c3                   	ret
+
+0000000000800e56 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800e56:	55                   	push   %rbp
+  800e57:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800e5a:	48 b8 ef 0d 80 00 00 	movabs $0x800def,%rax
+  800e61:	00 00 00 
+  800e64:	ff d0                	call   *%rax
+}
+  800e66:	5d                   	pop    %rbp
+  800e67:	c3                   	ret
+
+0000000000800e68 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800e68:	55                   	push   %rbp
+  800e69:	48 89 e5             	mov    %rsp,%rbp
+  800e6c:	41 57                	push   %r15
+  800e6e:	41 56                	push   %r14
+  800e70:	41 55                	push   %r13
+  800e72:	41 54                	push   %r12
+  800e74:	53                   	push   %rbx
+  800e75:	48 83 ec 08          	sub    $0x8,%rsp
+  800e79:	49 89 fe             	mov    %rdi,%r14
+  800e7c:	49 89 f7             	mov    %rsi,%r15
+  800e7f:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800e82:	48 89 f7             	mov    %rsi,%rdi
+  800e85:	48 b8 b7 0b 80 00 00 	movabs $0x800bb7,%rax
+  800e8c:	00 00 00 
+  800e8f:	ff d0                	call   *%rax
+  800e91:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800e94:	48 89 de             	mov    %rbx,%rsi
+  800e97:	4c 89 f7             	mov    %r14,%rdi
+  800e9a:	48 b8 d2 0b 80 00 00 	movabs $0x800bd2,%rax
+  800ea1:	00 00 00 
+  800ea4:	ff d0                	call   *%rax
+  800ea6:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800ea9:	48 39 c3             	cmp    %rax,%rbx
+  800eac:	74 36                	je     800ee4 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800eae:	48 89 d8             	mov    %rbx,%rax
+  800eb1:	4c 29 e8             	sub    %r13,%rax
+  800eb4:	49 39 c4             	cmp    %rax,%r12
+  800eb7:	73 31                	jae    800eea <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800eb9:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800ebe:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800ec2:	4c 89 fe             	mov    %r15,%rsi
+  800ec5:	48 b8 56 0e 80 00 00 	movabs $0x800e56,%rax
+  800ecc:	00 00 00 
+  800ecf:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800ed1:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800ed5:	48 83 c4 08          	add    $0x8,%rsp
+  800ed9:	5b                   	pop    %rbx
+  800eda:	41 5c                	pop    %r12
+  800edc:	41 5d                	pop    %r13
+  800ede:	41 5e                	pop    %r14
+  800ee0:	41 5f                	pop    %r15
+  800ee2:	5d                   	pop    %rbp
+  800ee3:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800ee4:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800ee8:	eb eb                	jmp    800ed5 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800eea:	48 83 eb 01          	sub    $0x1,%rbx
+  800eee:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800ef2:	48 89 da             	mov    %rbx,%rdx
+  800ef5:	4c 89 fe             	mov    %r15,%rsi
+  800ef8:	48 b8 56 0e 80 00 00 	movabs $0x800e56,%rax
+  800eff:	00 00 00 
+  800f02:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800f04:	49 01 de             	add    %rbx,%r14
+  800f07:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800f0c:	eb c3                	jmp    800ed1 <strlcat+0x69>
+
+0000000000800f0e <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800f0e:	48 85 d2             	test   %rdx,%rdx
+  800f11:	74 2d                	je     800f40 <memcmp+0x32>
+  800f13:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800f18:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800f1c:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800f21:	44 38 c1             	cmp    %r8b,%cl
+  800f24:	75 0f                	jne    800f35 <memcmp+0x27>
+    while (n-- > 0) {
+  800f26:	48 83 c0 01          	add    $0x1,%rax
+  800f2a:	48 39 c2             	cmp    %rax,%rdx
+  800f2d:	75 e9                	jne    800f18 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800f2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f34:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800f35:	0f b6 c1             	movzbl %cl,%eax
+  800f38:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800f3c:	44 29 c0             	sub    %r8d,%eax
+  800f3f:	c3                   	ret
+    return 0;
+  800f40:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f45:	c3                   	ret
+
+0000000000800f46 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800f46:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800f4a:	48 39 c7             	cmp    %rax,%rdi
+  800f4d:	73 0f                	jae    800f5e <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800f4f:	40 38 37             	cmp    %sil,(%rdi)
+  800f52:	74 0e                	je     800f62 <memfind+0x1c>
+    for (; src < end; src++) {
+  800f54:	48 83 c7 01          	add    $0x1,%rdi
+  800f58:	48 39 f8             	cmp    %rdi,%rax
+  800f5b:	75 f2                	jne    800f4f <memfind+0x9>
+  800f5d:	c3                   	ret
+  800f5e:	48 89 f8             	mov    %rdi,%rax
+  800f61:	c3                   	ret
+  800f62:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800f65:	c3                   	ret
+
+0000000000800f66 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800f66:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800f69:	0f b6 37             	movzbl (%rdi),%esi
+  800f6c:	40 80 fe 20          	cmp    $0x20,%sil
+  800f70:	74 06                	je     800f78 <strtol+0x12>
+  800f72:	40 80 fe 09          	cmp    $0x9,%sil
+  800f76:	75 13                	jne    800f8b <strtol+0x25>
+  800f78:	48 83 c7 01          	add    $0x1,%rdi
+  800f7c:	0f b6 37             	movzbl (%rdi),%esi
+  800f7f:	40 80 fe 20          	cmp    $0x20,%sil
+  800f83:	74 f3                	je     800f78 <strtol+0x12>
+  800f85:	40 80 fe 09          	cmp    $0x9,%sil
+  800f89:	74 ed                	je     800f78 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800f8b:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800f8e:	83 e0 fd             	and    $0xfffffffd,%eax
+  800f91:	3c 01                	cmp    $0x1,%al
+  800f93:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f97:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800f9d:	75 0f                	jne    800fae <strtol+0x48>
+  800f9f:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800fa2:	74 14                	je     800fb8 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800fa4:	85 d2                	test   %edx,%edx
+  800fa6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800fab:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800fae:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800fb3:	4c 63 ca             	movslq %edx,%r9
+  800fb6:	eb 36                	jmp    800fee <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800fb8:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800fbc:	74 0f                	je     800fcd <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800fbe:	85 d2                	test   %edx,%edx
+  800fc0:	75 ec                	jne    800fae <strtol+0x48>
+        s++;
+  800fc2:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800fc6:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800fcb:	eb e1                	jmp    800fae <strtol+0x48>
+        s += 2;
+  800fcd:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800fd1:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800fd6:	eb d6                	jmp    800fae <strtol+0x48>
+            dig -= '0';
+  800fd8:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800fdb:	44 0f b6 c1          	movzbl %cl,%r8d
+  800fdf:	41 39 d0             	cmp    %edx,%r8d
+  800fe2:	7d 21                	jge    801005 <strtol+0x9f>
+        val = val * base + dig;
+  800fe4:	49 0f af c1          	imul   %r9,%rax
+  800fe8:	0f b6 c9             	movzbl %cl,%ecx
+  800feb:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800fee:	48 83 c7 01          	add    $0x1,%rdi
+  800ff2:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800ff6:	80 f9 39             	cmp    $0x39,%cl
+  800ff9:	76 dd                	jbe    800fd8 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800ffb:	80 f9 7b             	cmp    $0x7b,%cl
+  800ffe:	77 05                	ja     801005 <strtol+0x9f>
+            dig -= 'a' - 10;
+  801000:	83 e9 57             	sub    $0x57,%ecx
+  801003:	eb d6                	jmp    800fdb <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801005:	4d 85 d2             	test   %r10,%r10
+  801008:	74 03                	je     80100d <strtol+0xa7>
+  80100a:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80100d:	48 89 c2             	mov    %rax,%rdx
+  801010:	48 f7 da             	neg    %rdx
+  801013:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801017:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80101b:	c3                   	ret
+
+000000000080101c <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  80101c:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801021:	ba 00 00 00 00       	mov    $0x0,%edx
+  801026:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80102c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801032:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  801038:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80103a:	c3                   	ret
+
+000000000080103b <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  80103b:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801040:	bf 00 00 00 00       	mov    $0x0,%edi
+  801045:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80104a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80104f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801055:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80105b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801061:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801063:	c3                   	ret
+
+0000000000801064 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801064:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801067:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80106c:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801071:	ba 00 00 00 00       	mov    $0x0,%edx
+  801076:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80107c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801082:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801088:	0f 05                	syscall
+    if (check && ret > 0) {
+  80108a:	48 85 c0             	test   %rax,%rax
+  80108d:	7f 01                	jg     801090 <sys_env_destroy+0x2c>
+}
+  80108f:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  801090:	55                   	push   %rbp
+  801091:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801094:	49 89 c0             	mov    %rax,%r8
+  801097:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80109c:	48 ba 18 58 80 00 00 	movabs $0x805818,%rdx
+  8010a3:	00 00 00 
+  8010a6:	be 29 00 00 00       	mov    $0x29,%esi
+  8010ab:	48 bf 37 58 80 00 00 	movabs $0x805837,%rdi
+  8010b2:	00 00 00 
+  8010b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010ba:	49 b9 80 01 80 00 00 	movabs $0x800180,%r9
+  8010c1:	00 00 00 
+  8010c4:	41 ff d1             	call   *%r9
+
+00000000008010c7 <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  8010c7:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8010cc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010d1:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8010d6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010db:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8010e1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8010e7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8010ed:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8010ef:	c3                   	ret
+
+00000000008010f0 <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  8010f0:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8010f5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010fa:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8010ff:	ba 00 00 00 00       	mov    $0x0,%edx
+  801104:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80110a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801110:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801116:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801118:	c3                   	ret
+
+0000000000801119 <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  801119:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80111e:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  801125:	00 00 00 
+  801128:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80112e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801134:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80113a:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80113c:	c3                   	ret
+
+000000000080113d <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80113d:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  801140:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801145:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80114b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801151:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801153:	c3                   	ret
+
+0000000000801154 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801154:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801157:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80115c:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80115f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801165:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80116b:	0f 05                	syscall
+    if (check && ret > 0) {
+  80116d:	48 85 c0             	test   %rax,%rax
+  801170:	7f 01                	jg     801173 <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801172:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801173:	55                   	push   %rbp
+  801174:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801177:	49 89 c0             	mov    %rax,%r8
+  80117a:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80117f:	48 ba 18 58 80 00 00 	movabs $0x805818,%rdx
+  801186:	00 00 00 
+  801189:	be 29 00 00 00       	mov    $0x29,%esi
+  80118e:	48 bf 37 58 80 00 00 	movabs $0x805837,%rdi
+  801195:	00 00 00 
+  801198:	b8 00 00 00 00       	mov    $0x0,%eax
+  80119d:	49 b9 80 01 80 00 00 	movabs $0x800180,%r9
+  8011a4:	00 00 00 
+  8011a7:	41 ff d1             	call   *%r9
+
+00000000008011aa <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8011aa:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8011ad:	48 63 d2             	movslq %edx,%rdx
+  8011b0:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8011b3:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8011b8:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  8011bb:	0f 05                	syscall
+    if (check && ret > 0) {
+  8011bd:	48 85 c0             	test   %rax,%rax
+  8011c0:	7f 01                	jg     8011c3 <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8011c2:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8011c3:	55                   	push   %rbp
+  8011c4:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011c7:	49 89 c0             	mov    %rax,%r8
+  8011ca:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8011cf:	48 ba 18 58 80 00 00 	movabs $0x805818,%rdx
+  8011d6:	00 00 00 
+  8011d9:	be 29 00 00 00       	mov    $0x29,%esi
+  8011de:	48 bf 37 58 80 00 00 	movabs $0x805837,%rdi
+  8011e5:	00 00 00 
+  8011e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011ed:	49 b9 80 01 80 00 00 	movabs $0x800180,%r9
+  8011f4:	00 00 00 
+  8011f7:	41 ff d1             	call   *%r9
+
+00000000008011fa <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8011fa:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8011fd:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801202:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801208:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80120e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801214:	0f 05                	syscall
+    if (check && ret > 0) {
+  801216:	48 85 c0             	test   %rax,%rax
+  801219:	7f 01                	jg     80121c <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80121b:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80121c:	55                   	push   %rbp
+  80121d:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801220:	49 89 c0             	mov    %rax,%r8
+  801223:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801228:	48 ba 18 58 80 00 00 	movabs $0x805818,%rdx
+  80122f:	00 00 00 
+  801232:	be 29 00 00 00       	mov    $0x29,%esi
+  801237:	48 bf 37 58 80 00 00 	movabs $0x805837,%rdi
+  80123e:	00 00 00 
+  801241:	b8 00 00 00 00       	mov    $0x0,%eax
+  801246:	49 b9 80 01 80 00 00 	movabs $0x800180,%r9
+  80124d:	00 00 00 
+  801250:	41 ff d1             	call   *%r9
+
+0000000000801253 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801253:	48 63 f6             	movslq %esi,%rsi
+  801256:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801259:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80125e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801263:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801269:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80126f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801275:	0f 05                	syscall
+    if (check && ret > 0) {
+  801277:	48 85 c0             	test   %rax,%rax
+  80127a:	7f 01                	jg     80127d <sys_env_set_status+0x2a>
+}
+  80127c:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  80127d:	55                   	push   %rbp
+  80127e:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801281:	49 89 c0             	mov    %rax,%r8
+  801284:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801289:	48 ba 18 58 80 00 00 	movabs $0x805818,%rdx
+  801290:	00 00 00 
+  801293:	be 29 00 00 00       	mov    $0x29,%esi
+  801298:	48 bf 37 58 80 00 00 	movabs $0x805837,%rdi
+  80129f:	00 00 00 
+  8012a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012a7:	49 b9 80 01 80 00 00 	movabs $0x800180,%r9
+  8012ae:	00 00 00 
+  8012b1:	41 ff d1             	call   *%r9
+
+00000000008012b4 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8012b4:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8012b7:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8012bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012c1:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8012c7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8012cd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8012d3:	0f 05                	syscall
+    if (check && ret > 0) {
+  8012d5:	48 85 c0             	test   %rax,%rax
+  8012d8:	7f 01                	jg     8012db <sys_env_set_trapframe+0x27>
+}
+  8012da:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8012db:	55                   	push   %rbp
+  8012dc:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012df:	49 89 c0             	mov    %rax,%r8
+  8012e2:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8012e7:	48 ba 18 58 80 00 00 	movabs $0x805818,%rdx
+  8012ee:	00 00 00 
+  8012f1:	be 29 00 00 00       	mov    $0x29,%esi
+  8012f6:	48 bf 37 58 80 00 00 	movabs $0x805837,%rdi
+  8012fd:	00 00 00 
+  801300:	b8 00 00 00 00       	mov    $0x0,%eax
+  801305:	49 b9 80 01 80 00 00 	movabs $0x800180,%r9
+  80130c:	00 00 00 
+  80130f:	41 ff d1             	call   *%r9
+
+0000000000801312 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801312:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801315:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80131a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80131f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801325:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80132b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801331:	0f 05                	syscall
+    if (check && ret > 0) {
+  801333:	48 85 c0             	test   %rax,%rax
+  801336:	7f 01                	jg     801339 <sys_env_set_pgfault_upcall+0x27>
+}
+  801338:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801339:	55                   	push   %rbp
+  80133a:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80133d:	49 89 c0             	mov    %rax,%r8
+  801340:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801345:	48 ba 18 58 80 00 00 	movabs $0x805818,%rdx
+  80134c:	00 00 00 
+  80134f:	be 29 00 00 00       	mov    $0x29,%esi
+  801354:	48 bf 37 58 80 00 00 	movabs $0x805837,%rdi
+  80135b:	00 00 00 
+  80135e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801363:	49 b9 80 01 80 00 00 	movabs $0x800180,%r9
+  80136a:	00 00 00 
+  80136d:	41 ff d1             	call   *%r9
+
+0000000000801370 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801370:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801373:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801376:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80137b:	4d 63 c0             	movslq %r8d,%r8
+  80137e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801384:	0f 05                	syscall
+}
+  801386:	c3                   	ret
+
+0000000000801387 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801387:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80138a:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80138d:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801392:	4d 63 c0             	movslq %r8d,%r8
+  801395:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80139b:	0f 05                	syscall
+}
+  80139d:	c3                   	ret
+
+000000000080139e <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  80139e:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8013a3:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013a6:	45 89 c0             	mov    %r8d,%r8d
+  8013a9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013af:	0f 05                	syscall
+    if (check && ret > 0) {
+  8013b1:	48 85 c0             	test   %rax,%rax
+  8013b4:	7f 01                	jg     8013b7 <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8013b6:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8013b7:	55                   	push   %rbp
+  8013b8:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013bb:	49 89 c0             	mov    %rax,%r8
+  8013be:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8013c3:	48 ba 18 58 80 00 00 	movabs $0x805818,%rdx
+  8013ca:	00 00 00 
+  8013cd:	be 29 00 00 00       	mov    $0x29,%esi
+  8013d2:	48 bf 37 58 80 00 00 	movabs $0x805837,%rdi
+  8013d9:	00 00 00 
+  8013dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013e1:	49 b9 80 01 80 00 00 	movabs $0x800180,%r9
+  8013e8:	00 00 00 
+  8013eb:	41 ff d1             	call   *%r9
+
+00000000008013ee <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  8013ee:	55                   	push   %rbp
+  8013ef:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  8013f2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013f8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  801402:	48 b8 9e 13 80 00 00 	movabs $0x80139e,%rax
+  801409:	00 00 00 
+  80140c:	ff d0                	call   *%rax
+}
+  80140e:	5d                   	pop    %rbp
+  80140f:	c3                   	ret
+
+0000000000801410 <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  801410:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801415:	bf 00 00 00 00       	mov    $0x0,%edi
+  80141a:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80141f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801424:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80142a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801430:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801436:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801438:	c3                   	ret
+
+0000000000801439 <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  801439:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80143e:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801443:	ba 00 00 00 00       	mov    $0x0,%edx
+  801448:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80144e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801454:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80145a:	0f 05                	syscall
+    if (check && ret > 0) {
+  80145c:	48 85 c0             	test   %rax,%rax
+  80145f:	7f 01                	jg     801462 <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  801461:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  801462:	55                   	push   %rbp
+  801463:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801466:	49 89 c0             	mov    %rax,%r8
+  801469:	b9 10 00 00 00       	mov    $0x10,%ecx
+  80146e:	48 ba 18 58 80 00 00 	movabs $0x805818,%rdx
+  801475:	00 00 00 
+  801478:	be 29 00 00 00       	mov    $0x29,%esi
+  80147d:	48 bf 37 58 80 00 00 	movabs $0x805837,%rdi
+  801484:	00 00 00 
+  801487:	b8 00 00 00 00       	mov    $0x0,%eax
+  80148c:	49 b9 80 01 80 00 00 	movabs $0x800180,%r9
+  801493:	00 00 00 
+  801496:	41 ff d1             	call   *%r9
+
+0000000000801499 <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  801499:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80149e:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014a3:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8014a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014ad:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014b3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014b9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8014bf:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  8014c1:	c3                   	ret
+
+00000000008014c2 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  8014c2:	89 d2                	mov    %edx,%edx
+  8014c4:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  8014c6:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8014cb:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014d1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014d7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8014dd:	0f 05                	syscall
+}
+  8014df:	c3                   	ret
+
+00000000008014e0 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  8014e0:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  8014e3:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8014e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014ed:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014f3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014f9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8014ff:	0f 05                	syscall
+}
+  801501:	c3                   	ret
+
+0000000000801502 <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  801502:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  801505:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80150a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80150f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801515:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80151b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801521:	0f 05                	syscall
+}
+  801523:	c3                   	ret
+
+0000000000801524 <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  801524:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801527:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80152c:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801531:	ba 00 00 00 00       	mov    $0x0,%edx
+  801536:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80153c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801542:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801548:	0f 05                	syscall
+    if (check && ret > 0) {
+  80154a:	48 85 c0             	test   %rax,%rax
+  80154d:	7f 01                	jg     801550 <sys_irq_ack+0x2c>
+}
+  80154f:	c3                   	ret
+sys_irq_ack(int irq) {
+  801550:	55                   	push   %rbp
+  801551:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801554:	49 89 c0             	mov    %rax,%r8
+  801557:	b9 16 00 00 00       	mov    $0x16,%ecx
+  80155c:	48 ba 18 58 80 00 00 	movabs $0x805818,%rdx
+  801563:	00 00 00 
+  801566:	be 29 00 00 00       	mov    $0x29,%esi
+  80156b:	48 bf 37 58 80 00 00 	movabs $0x805837,%rdi
+  801572:	00 00 00 
+  801575:	b8 00 00 00 00       	mov    $0x0,%eax
+  80157a:	49 b9 80 01 80 00 00 	movabs $0x800180,%r9
+  801581:	00 00 00 
+  801584:	41 ff d1             	call   *%r9
+
+0000000000801587 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801587:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80158e:	ff ff ff 
+  801591:	48 01 f8             	add    %rdi,%rax
+  801594:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801598:	c3                   	ret
+
+0000000000801599 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801599:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8015a0:	ff ff ff 
+  8015a3:	48 01 f8             	add    %rdi,%rax
+  8015a6:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8015aa:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8015b0:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8015b4:	c3                   	ret
+
+00000000008015b5 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8015b5:	55                   	push   %rbp
+  8015b6:	48 89 e5             	mov    %rsp,%rbp
+  8015b9:	41 57                	push   %r15
+  8015bb:	41 56                	push   %r14
+  8015bd:	41 55                	push   %r13
+  8015bf:	41 54                	push   %r12
+  8015c1:	53                   	push   %rbx
+  8015c2:	48 83 ec 08          	sub    $0x8,%rsp
+  8015c6:	49 89 ff             	mov    %rdi,%r15
+  8015c9:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8015ce:	49 bd fe 45 80 00 00 	movabs $0x8045fe,%r13
+  8015d5:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8015d8:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8015de:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8015e1:	48 89 df             	mov    %rbx,%rdi
+  8015e4:	41 ff d5             	call   *%r13
+  8015e7:	83 e0 04             	and    $0x4,%eax
+  8015ea:	74 17                	je     801603 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8015ec:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8015f3:	4c 39 f3             	cmp    %r14,%rbx
+  8015f6:	75 e6                	jne    8015de <fd_alloc+0x29>
+  8015f8:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8015fe:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801603:	4d 89 27             	mov    %r12,(%r15)
+}
+  801606:	48 83 c4 08          	add    $0x8,%rsp
+  80160a:	5b                   	pop    %rbx
+  80160b:	41 5c                	pop    %r12
+  80160d:	41 5d                	pop    %r13
+  80160f:	41 5e                	pop    %r14
+  801611:	41 5f                	pop    %r15
+  801613:	5d                   	pop    %rbp
+  801614:	c3                   	ret
+
+0000000000801615 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801615:	83 ff 1f             	cmp    $0x1f,%edi
+  801618:	77 39                	ja     801653 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80161a:	55                   	push   %rbp
+  80161b:	48 89 e5             	mov    %rsp,%rbp
+  80161e:	41 54                	push   %r12
+  801620:	53                   	push   %rbx
+  801621:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801624:	48 63 df             	movslq %edi,%rbx
+  801627:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80162e:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801632:	48 89 df             	mov    %rbx,%rdi
+  801635:	48 b8 fe 45 80 00 00 	movabs $0x8045fe,%rax
+  80163c:	00 00 00 
+  80163f:	ff d0                	call   *%rax
+  801641:	a8 04                	test   $0x4,%al
+  801643:	74 14                	je     801659 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801645:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801649:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80164e:	5b                   	pop    %rbx
+  80164f:	41 5c                	pop    %r12
+  801651:	5d                   	pop    %rbp
+  801652:	c3                   	ret
+        return -E_INVAL;
+  801653:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801658:	c3                   	ret
+        return -E_INVAL;
+  801659:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80165e:	eb ee                	jmp    80164e <fd_lookup+0x39>
+
+0000000000801660 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801660:	55                   	push   %rbp
+  801661:	48 89 e5             	mov    %rsp,%rbp
+  801664:	41 54                	push   %r12
+  801666:	53                   	push   %rbx
+  801667:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  80166a:	48 b8 e0 58 80 00 00 	movabs $0x8058e0,%rax
+  801671:	00 00 00 
+  801674:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  80167b:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  80167e:	39 3b                	cmp    %edi,(%rbx)
+  801680:	74 47                	je     8016c9 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801682:	48 83 c0 08          	add    $0x8,%rax
+  801686:	48 8b 18             	mov    (%rax),%rbx
+  801689:	48 85 db             	test   %rbx,%rbx
+  80168c:	75 f0                	jne    80167e <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80168e:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801695:	00 00 00 
+  801698:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80169e:	89 fa                	mov    %edi,%edx
+  8016a0:	48 bf 48 58 80 00 00 	movabs $0x805848,%rdi
+  8016a7:	00 00 00 
+  8016aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016af:	48 b9 d0 02 80 00 00 	movabs $0x8002d0,%rcx
+  8016b6:	00 00 00 
+  8016b9:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8016bb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8016c0:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8016c4:	5b                   	pop    %rbx
+  8016c5:	41 5c                	pop    %r12
+  8016c7:	5d                   	pop    %rbp
+  8016c8:	c3                   	ret
+            return 0;
+  8016c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016ce:	eb f0                	jmp    8016c0 <dev_lookup+0x60>
+
+00000000008016d0 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8016d0:	55                   	push   %rbp
+  8016d1:	48 89 e5             	mov    %rsp,%rbp
+  8016d4:	41 55                	push   %r13
+  8016d6:	41 54                	push   %r12
+  8016d8:	53                   	push   %rbx
+  8016d9:	48 83 ec 18          	sub    $0x18,%rsp
+  8016dd:	48 89 fb             	mov    %rdi,%rbx
+  8016e0:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8016e3:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8016ea:	ff ff ff 
+  8016ed:	48 01 df             	add    %rbx,%rdi
+  8016f0:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8016f4:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8016f8:	48 b8 15 16 80 00 00 	movabs $0x801615,%rax
+  8016ff:	00 00 00 
+  801702:	ff d0                	call   *%rax
+  801704:	41 89 c5             	mov    %eax,%r13d
+  801707:	85 c0                	test   %eax,%eax
+  801709:	78 06                	js     801711 <fd_close+0x41>
+  80170b:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  80170f:	74 1a                	je     80172b <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801711:	45 84 e4             	test   %r12b,%r12b
+  801714:	b8 00 00 00 00       	mov    $0x0,%eax
+  801719:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80171d:	44 89 e8             	mov    %r13d,%eax
+  801720:	48 83 c4 18          	add    $0x18,%rsp
+  801724:	5b                   	pop    %rbx
+  801725:	41 5c                	pop    %r12
+  801727:	41 5d                	pop    %r13
+  801729:	5d                   	pop    %rbp
+  80172a:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80172b:	8b 3b                	mov    (%rbx),%edi
+  80172d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801731:	48 b8 60 16 80 00 00 	movabs $0x801660,%rax
+  801738:	00 00 00 
+  80173b:	ff d0                	call   *%rax
+  80173d:	41 89 c5             	mov    %eax,%r13d
+  801740:	85 c0                	test   %eax,%eax
+  801742:	78 1b                	js     80175f <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801744:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801748:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80174c:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801752:	48 85 c0             	test   %rax,%rax
+  801755:	74 08                	je     80175f <fd_close+0x8f>
+  801757:	48 89 df             	mov    %rbx,%rdi
+  80175a:	ff d0                	call   *%rax
+  80175c:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80175f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801764:	48 89 de             	mov    %rbx,%rsi
+  801767:	bf 00 00 00 00       	mov    $0x0,%edi
+  80176c:	48 b8 fa 11 80 00 00 	movabs $0x8011fa,%rax
+  801773:	00 00 00 
+  801776:	ff d0                	call   *%rax
+    return res;
+  801778:	eb a3                	jmp    80171d <fd_close+0x4d>
+
+000000000080177a <close>:
+
+int
+close(int fdnum) {
+  80177a:	55                   	push   %rbp
+  80177b:	48 89 e5             	mov    %rsp,%rbp
+  80177e:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801782:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801786:	48 b8 15 16 80 00 00 	movabs $0x801615,%rax
+  80178d:	00 00 00 
+  801790:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801792:	85 c0                	test   %eax,%eax
+  801794:	78 15                	js     8017ab <close+0x31>
+
+    return fd_close(fd, 1);
+  801796:	be 01 00 00 00       	mov    $0x1,%esi
+  80179b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80179f:	48 b8 d0 16 80 00 00 	movabs $0x8016d0,%rax
+  8017a6:	00 00 00 
+  8017a9:	ff d0                	call   *%rax
+}
+  8017ab:	c9                   	leave
+  8017ac:	c3                   	ret
+
+00000000008017ad <close_all>:
+
+void
+close_all(void) {
+  8017ad:	55                   	push   %rbp
+  8017ae:	48 89 e5             	mov    %rsp,%rbp
+  8017b1:	41 54                	push   %r12
+  8017b3:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8017b4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017b9:	49 bc 7a 17 80 00 00 	movabs $0x80177a,%r12
+  8017c0:	00 00 00 
+  8017c3:	89 df                	mov    %ebx,%edi
+  8017c5:	41 ff d4             	call   *%r12
+  8017c8:	83 c3 01             	add    $0x1,%ebx
+  8017cb:	83 fb 20             	cmp    $0x20,%ebx
+  8017ce:	75 f3                	jne    8017c3 <close_all+0x16>
+}
+  8017d0:	5b                   	pop    %rbx
+  8017d1:	41 5c                	pop    %r12
+  8017d3:	5d                   	pop    %rbp
+  8017d4:	c3                   	ret
+
+00000000008017d5 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8017d5:	55                   	push   %rbp
+  8017d6:	48 89 e5             	mov    %rsp,%rbp
+  8017d9:	41 57                	push   %r15
+  8017db:	41 56                	push   %r14
+  8017dd:	41 55                	push   %r13
+  8017df:	41 54                	push   %r12
+  8017e1:	53                   	push   %rbx
+  8017e2:	48 83 ec 18          	sub    $0x18,%rsp
+  8017e6:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8017e9:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8017ed:	48 b8 15 16 80 00 00 	movabs $0x801615,%rax
+  8017f4:	00 00 00 
+  8017f7:	ff d0                	call   *%rax
+  8017f9:	89 c3                	mov    %eax,%ebx
+  8017fb:	85 c0                	test   %eax,%eax
+  8017fd:	0f 88 b8 00 00 00    	js     8018bb <dup+0xe6>
+    close(newfdnum);
+  801803:	44 89 e7             	mov    %r12d,%edi
+  801806:	48 b8 7a 17 80 00 00 	movabs $0x80177a,%rax
+  80180d:	00 00 00 
+  801810:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801812:	4d 63 ec             	movslq %r12d,%r13
+  801815:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80181c:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801820:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801824:	4c 89 ff             	mov    %r15,%rdi
+  801827:	49 be 99 15 80 00 00 	movabs $0x801599,%r14
+  80182e:	00 00 00 
+  801831:	41 ff d6             	call   *%r14
+  801834:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801837:	4c 89 ef             	mov    %r13,%rdi
+  80183a:	41 ff d6             	call   *%r14
+  80183d:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801840:	48 89 df             	mov    %rbx,%rdi
+  801843:	48 b8 fe 45 80 00 00 	movabs $0x8045fe,%rax
+  80184a:	00 00 00 
+  80184d:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  80184f:	a8 04                	test   $0x4,%al
+  801851:	74 2b                	je     80187e <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801853:	41 89 c1             	mov    %eax,%r9d
+  801856:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80185c:	4c 89 f1             	mov    %r14,%rcx
+  80185f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801864:	48 89 de             	mov    %rbx,%rsi
+  801867:	bf 00 00 00 00       	mov    $0x0,%edi
+  80186c:	48 b8 aa 11 80 00 00 	movabs $0x8011aa,%rax
+  801873:	00 00 00 
+  801876:	ff d0                	call   *%rax
+  801878:	89 c3                	mov    %eax,%ebx
+  80187a:	85 c0                	test   %eax,%eax
+  80187c:	78 4e                	js     8018cc <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  80187e:	4c 89 ff             	mov    %r15,%rdi
+  801881:	48 b8 fe 45 80 00 00 	movabs $0x8045fe,%rax
+  801888:	00 00 00 
+  80188b:	ff d0                	call   *%rax
+  80188d:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801890:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801896:	4c 89 e9             	mov    %r13,%rcx
+  801899:	ba 00 00 00 00       	mov    $0x0,%edx
+  80189e:	4c 89 fe             	mov    %r15,%rsi
+  8018a1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018a6:	48 b8 aa 11 80 00 00 	movabs $0x8011aa,%rax
+  8018ad:	00 00 00 
+  8018b0:	ff d0                	call   *%rax
+  8018b2:	89 c3                	mov    %eax,%ebx
+  8018b4:	85 c0                	test   %eax,%eax
+  8018b6:	78 14                	js     8018cc <dup+0xf7>
+
+    return newfdnum;
+  8018b8:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8018bb:	89 d8                	mov    %ebx,%eax
+  8018bd:	48 83 c4 18          	add    $0x18,%rsp
+  8018c1:	5b                   	pop    %rbx
+  8018c2:	41 5c                	pop    %r12
+  8018c4:	41 5d                	pop    %r13
+  8018c6:	41 5e                	pop    %r14
+  8018c8:	41 5f                	pop    %r15
+  8018ca:	5d                   	pop    %rbp
+  8018cb:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8018cc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8018d1:	4c 89 ee             	mov    %r13,%rsi
+  8018d4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018d9:	49 bc fa 11 80 00 00 	movabs $0x8011fa,%r12
+  8018e0:	00 00 00 
+  8018e3:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8018e6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8018eb:	4c 89 f6             	mov    %r14,%rsi
+  8018ee:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018f3:	41 ff d4             	call   *%r12
+    return res;
+  8018f6:	eb c3                	jmp    8018bb <dup+0xe6>
+
+00000000008018f8 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8018f8:	55                   	push   %rbp
+  8018f9:	48 89 e5             	mov    %rsp,%rbp
+  8018fc:	41 56                	push   %r14
+  8018fe:	41 55                	push   %r13
+  801900:	41 54                	push   %r12
+  801902:	53                   	push   %rbx
+  801903:	48 83 ec 10          	sub    $0x10,%rsp
+  801907:	89 fb                	mov    %edi,%ebx
+  801909:	49 89 f4             	mov    %rsi,%r12
+  80190c:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80190f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801913:	48 b8 15 16 80 00 00 	movabs $0x801615,%rax
+  80191a:	00 00 00 
+  80191d:	ff d0                	call   *%rax
+  80191f:	85 c0                	test   %eax,%eax
+  801921:	78 4c                	js     80196f <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801923:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801927:	41 8b 3e             	mov    (%r14),%edi
+  80192a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80192e:	48 b8 60 16 80 00 00 	movabs $0x801660,%rax
+  801935:	00 00 00 
+  801938:	ff d0                	call   *%rax
+  80193a:	85 c0                	test   %eax,%eax
+  80193c:	78 35                	js     801973 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80193e:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801942:	83 e0 03             	and    $0x3,%eax
+  801945:	83 f8 01             	cmp    $0x1,%eax
+  801948:	74 2d                	je     801977 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80194a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80194e:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801952:	48 85 c0             	test   %rax,%rax
+  801955:	74 56                	je     8019ad <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801957:	4c 89 ea             	mov    %r13,%rdx
+  80195a:	4c 89 e6             	mov    %r12,%rsi
+  80195d:	4c 89 f7             	mov    %r14,%rdi
+  801960:	ff d0                	call   *%rax
+}
+  801962:	48 83 c4 10          	add    $0x10,%rsp
+  801966:	5b                   	pop    %rbx
+  801967:	41 5c                	pop    %r12
+  801969:	41 5d                	pop    %r13
+  80196b:	41 5e                	pop    %r14
+  80196d:	5d                   	pop    %rbp
+  80196e:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80196f:	48 98                	cltq
+  801971:	eb ef                	jmp    801962 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801973:	48 98                	cltq
+  801975:	eb eb                	jmp    801962 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801977:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80197e:	00 00 00 
+  801981:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801987:	89 da                	mov    %ebx,%edx
+  801989:	48 bf 89 58 80 00 00 	movabs $0x805889,%rdi
+  801990:	00 00 00 
+  801993:	b8 00 00 00 00       	mov    $0x0,%eax
+  801998:	48 b9 d0 02 80 00 00 	movabs $0x8002d0,%rcx
+  80199f:	00 00 00 
+  8019a2:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8019a4:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8019ab:	eb b5                	jmp    801962 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8019ad:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8019b4:	eb ac                	jmp    801962 <read+0x6a>
+
+00000000008019b6 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8019b6:	55                   	push   %rbp
+  8019b7:	48 89 e5             	mov    %rsp,%rbp
+  8019ba:	41 57                	push   %r15
+  8019bc:	41 56                	push   %r14
+  8019be:	41 55                	push   %r13
+  8019c0:	41 54                	push   %r12
+  8019c2:	53                   	push   %rbx
+  8019c3:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8019c7:	48 85 d2             	test   %rdx,%rdx
+  8019ca:	74 54                	je     801a20 <readn+0x6a>
+  8019cc:	41 89 fd             	mov    %edi,%r13d
+  8019cf:	49 89 f6             	mov    %rsi,%r14
+  8019d2:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8019d5:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8019da:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8019df:	49 bf f8 18 80 00 00 	movabs $0x8018f8,%r15
+  8019e6:	00 00 00 
+  8019e9:	4c 89 e2             	mov    %r12,%rdx
+  8019ec:	48 29 f2             	sub    %rsi,%rdx
+  8019ef:	4c 01 f6             	add    %r14,%rsi
+  8019f2:	44 89 ef             	mov    %r13d,%edi
+  8019f5:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  8019f8:	85 c0                	test   %eax,%eax
+  8019fa:	78 20                	js     801a1c <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  8019fc:	01 c3                	add    %eax,%ebx
+  8019fe:	85 c0                	test   %eax,%eax
+  801a00:	74 08                	je     801a0a <readn+0x54>
+  801a02:	48 63 f3             	movslq %ebx,%rsi
+  801a05:	4c 39 e6             	cmp    %r12,%rsi
+  801a08:	72 df                	jb     8019e9 <readn+0x33>
+    }
+    return res;
+  801a0a:	48 63 c3             	movslq %ebx,%rax
+}
+  801a0d:	48 83 c4 08          	add    $0x8,%rsp
+  801a11:	5b                   	pop    %rbx
+  801a12:	41 5c                	pop    %r12
+  801a14:	41 5d                	pop    %r13
+  801a16:	41 5e                	pop    %r14
+  801a18:	41 5f                	pop    %r15
+  801a1a:	5d                   	pop    %rbp
+  801a1b:	c3                   	ret
+        if (inc < 0) return inc;
+  801a1c:	48 98                	cltq
+  801a1e:	eb ed                	jmp    801a0d <readn+0x57>
+    int inc = 1, res = 0;
+  801a20:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a25:	eb e3                	jmp    801a0a <readn+0x54>
+
+0000000000801a27 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801a27:	55                   	push   %rbp
+  801a28:	48 89 e5             	mov    %rsp,%rbp
+  801a2b:	41 56                	push   %r14
+  801a2d:	41 55                	push   %r13
+  801a2f:	41 54                	push   %r12
+  801a31:	53                   	push   %rbx
+  801a32:	48 83 ec 10          	sub    $0x10,%rsp
+  801a36:	89 fb                	mov    %edi,%ebx
+  801a38:	49 89 f4             	mov    %rsi,%r12
+  801a3b:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a3e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801a42:	48 b8 15 16 80 00 00 	movabs $0x801615,%rax
+  801a49:	00 00 00 
+  801a4c:	ff d0                	call   *%rax
+  801a4e:	85 c0                	test   %eax,%eax
+  801a50:	78 47                	js     801a99 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801a52:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801a56:	41 8b 3e             	mov    (%r14),%edi
+  801a59:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801a5d:	48 b8 60 16 80 00 00 	movabs $0x801660,%rax
+  801a64:	00 00 00 
+  801a67:	ff d0                	call   *%rax
+  801a69:	85 c0                	test   %eax,%eax
+  801a6b:	78 30                	js     801a9d <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801a6d:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801a72:	74 2d                	je     801aa1 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801a74:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a78:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801a7c:	48 85 c0             	test   %rax,%rax
+  801a7f:	74 56                	je     801ad7 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801a81:	4c 89 ea             	mov    %r13,%rdx
+  801a84:	4c 89 e6             	mov    %r12,%rsi
+  801a87:	4c 89 f7             	mov    %r14,%rdi
+  801a8a:	ff d0                	call   *%rax
+}
+  801a8c:	48 83 c4 10          	add    $0x10,%rsp
+  801a90:	5b                   	pop    %rbx
+  801a91:	41 5c                	pop    %r12
+  801a93:	41 5d                	pop    %r13
+  801a95:	41 5e                	pop    %r14
+  801a97:	5d                   	pop    %rbp
+  801a98:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a99:	48 98                	cltq
+  801a9b:	eb ef                	jmp    801a8c <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801a9d:	48 98                	cltq
+  801a9f:	eb eb                	jmp    801a8c <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801aa1:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801aa8:	00 00 00 
+  801aab:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801ab1:	89 da                	mov    %ebx,%edx
+  801ab3:	48 bf a5 58 80 00 00 	movabs $0x8058a5,%rdi
+  801aba:	00 00 00 
+  801abd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ac2:	48 b9 d0 02 80 00 00 	movabs $0x8002d0,%rcx
+  801ac9:	00 00 00 
+  801acc:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801ace:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801ad5:	eb b5                	jmp    801a8c <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801ad7:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801ade:	eb ac                	jmp    801a8c <write+0x65>
+
+0000000000801ae0 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801ae0:	55                   	push   %rbp
+  801ae1:	48 89 e5             	mov    %rsp,%rbp
+  801ae4:	41 54                	push   %r12
+  801ae6:	53                   	push   %rbx
+  801ae7:	48 83 ec 10          	sub    $0x10,%rsp
+  801aeb:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801aed:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801af1:	48 b8 15 16 80 00 00 	movabs $0x801615,%rax
+  801af8:	00 00 00 
+  801afb:	ff d0                	call   *%rax
+  801afd:	85 c0                	test   %eax,%eax
+  801aff:	78 3e                	js     801b3f <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b01:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801b05:	41 8b 3c 24          	mov    (%r12),%edi
+  801b09:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801b0d:	48 b8 60 16 80 00 00 	movabs $0x801660,%rax
+  801b14:	00 00 00 
+  801b17:	ff d0                	call   *%rax
+  801b19:	85 c0                	test   %eax,%eax
+  801b1b:	78 22                	js     801b3f <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  801b1d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801b21:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801b25:	48 85 c0             	test   %rax,%rax
+  801b28:	74 0b                	je     801b35 <seek+0x55>
+  801b2a:	89 de                	mov    %ebx,%esi
+  801b2c:	4c 89 e7             	mov    %r12,%rdi
+  801b2f:	ff d0                	call   *%rax
+  801b31:	85 c0                	test   %eax,%eax
+  801b33:	78 0a                	js     801b3f <seek+0x5f>
+
+    fd->fd_offset = offset;
+  801b35:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  801b3a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b3f:	48 83 c4 10          	add    $0x10,%rsp
+  801b43:	5b                   	pop    %rbx
+  801b44:	41 5c                	pop    %r12
+  801b46:	5d                   	pop    %rbp
+  801b47:	c3                   	ret
+
+0000000000801b48 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801b48:	55                   	push   %rbp
+  801b49:	48 89 e5             	mov    %rsp,%rbp
+  801b4c:	41 55                	push   %r13
+  801b4e:	41 54                	push   %r12
+  801b50:	53                   	push   %rbx
+  801b51:	48 83 ec 18          	sub    $0x18,%rsp
+  801b55:	89 fb                	mov    %edi,%ebx
+  801b57:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b5a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801b5e:	48 b8 15 16 80 00 00 	movabs $0x801615,%rax
+  801b65:	00 00 00 
+  801b68:	ff d0                	call   *%rax
+  801b6a:	85 c0                	test   %eax,%eax
+  801b6c:	78 38                	js     801ba6 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b6e:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801b72:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801b76:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801b7a:	48 b8 60 16 80 00 00 	movabs $0x801660,%rax
+  801b81:	00 00 00 
+  801b84:	ff d0                	call   *%rax
+  801b86:	85 c0                	test   %eax,%eax
+  801b88:	78 1c                	js     801ba6 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801b8a:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801b8f:	74 20                	je     801bb1 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801b91:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b95:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801b99:	48 85 c0             	test   %rax,%rax
+  801b9c:	74 47                	je     801be5 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801b9e:	44 89 e6             	mov    %r12d,%esi
+  801ba1:	4c 89 ef             	mov    %r13,%rdi
+  801ba4:	ff d0                	call   *%rax
+}
+  801ba6:	48 83 c4 18          	add    $0x18,%rsp
+  801baa:	5b                   	pop    %rbx
+  801bab:	41 5c                	pop    %r12
+  801bad:	41 5d                	pop    %r13
+  801baf:	5d                   	pop    %rbp
+  801bb0:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801bb1:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801bb8:	00 00 00 
+  801bbb:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801bc1:	89 da                	mov    %ebx,%edx
+  801bc3:	48 bf 68 58 80 00 00 	movabs $0x805868,%rdi
+  801bca:	00 00 00 
+  801bcd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bd2:	48 b9 d0 02 80 00 00 	movabs $0x8002d0,%rcx
+  801bd9:	00 00 00 
+  801bdc:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801bde:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801be3:	eb c1                	jmp    801ba6 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801be5:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801bea:	eb ba                	jmp    801ba6 <ftruncate+0x5e>
+
+0000000000801bec <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801bec:	55                   	push   %rbp
+  801bed:	48 89 e5             	mov    %rsp,%rbp
+  801bf0:	41 54                	push   %r12
+  801bf2:	53                   	push   %rbx
+  801bf3:	48 83 ec 10          	sub    $0x10,%rsp
+  801bf7:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801bfa:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801bfe:	48 b8 15 16 80 00 00 	movabs $0x801615,%rax
+  801c05:	00 00 00 
+  801c08:	ff d0                	call   *%rax
+  801c0a:	85 c0                	test   %eax,%eax
+  801c0c:	78 4e                	js     801c5c <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c0e:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801c12:	41 8b 3c 24          	mov    (%r12),%edi
+  801c16:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801c1a:	48 b8 60 16 80 00 00 	movabs $0x801660,%rax
+  801c21:	00 00 00 
+  801c24:	ff d0                	call   *%rax
+  801c26:	85 c0                	test   %eax,%eax
+  801c28:	78 32                	js     801c5c <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801c2a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801c2e:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801c33:	74 30                	je     801c65 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801c35:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801c38:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801c3f:	00 00 00 
+    stat->st_isdir = 0;
+  801c42:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801c49:	00 00 00 
+    stat->st_dev = dev;
+  801c4c:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801c53:	48 89 de             	mov    %rbx,%rsi
+  801c56:	4c 89 e7             	mov    %r12,%rdi
+  801c59:	ff 50 28             	call   *0x28(%rax)
+}
+  801c5c:	48 83 c4 10          	add    $0x10,%rsp
+  801c60:	5b                   	pop    %rbx
+  801c61:	41 5c                	pop    %r12
+  801c63:	5d                   	pop    %rbp
+  801c64:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801c65:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801c6a:	eb f0                	jmp    801c5c <fstat+0x70>
+
+0000000000801c6c <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801c6c:	55                   	push   %rbp
+  801c6d:	48 89 e5             	mov    %rsp,%rbp
+  801c70:	41 54                	push   %r12
+  801c72:	53                   	push   %rbx
+  801c73:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801c76:	be 00 00 00 00       	mov    $0x0,%esi
+  801c7b:	48 b8 da 2d 80 00 00 	movabs $0x802dda,%rax
+  801c82:	00 00 00 
+  801c85:	ff d0                	call   *%rax
+  801c87:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801c89:	85 c0                	test   %eax,%eax
+  801c8b:	78 25                	js     801cb2 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801c8d:	4c 89 e6             	mov    %r12,%rsi
+  801c90:	89 c7                	mov    %eax,%edi
+  801c92:	48 b8 ec 1b 80 00 00 	movabs $0x801bec,%rax
+  801c99:	00 00 00 
+  801c9c:	ff d0                	call   *%rax
+  801c9e:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801ca1:	89 df                	mov    %ebx,%edi
+  801ca3:	48 b8 7a 17 80 00 00 	movabs $0x80177a,%rax
+  801caa:	00 00 00 
+  801cad:	ff d0                	call   *%rax
+
+    return res;
+  801caf:	44 89 e3             	mov    %r12d,%ebx
+}
+  801cb2:	89 d8                	mov    %ebx,%eax
+  801cb4:	5b                   	pop    %rbx
+  801cb5:	41 5c                	pop    %r12
+  801cb7:	5d                   	pop    %rbp
+  801cb8:	c3                   	ret
+
+0000000000801cb9 <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  801cb9:	48 b8 08 00 82 00 00 	movabs $0x820008,%rax
+  801cc0:	00 00 00 
+  801cc3:	83 38 00             	cmpl   $0x0,(%rax)
+  801cc6:	74 0a                	je     801cd2 <fsenv+0x19>
+    return envid;
+}
+  801cc8:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  801ccf:	00 00 
+  801cd1:	c3                   	ret
+fsenv(void) {
+  801cd2:	55                   	push   %rbp
+  801cd3:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  801cd6:	bf 03 00 00 00       	mov    $0x3,%edi
+  801cdb:	48 b8 f0 51 80 00 00 	movabs $0x8051f0,%rax
+  801ce2:	00 00 00 
+  801ce5:	ff d0                	call   *%rax
+  801ce7:	a3 08 00 82 00 00 00 	movabs %eax,0x820008
+  801cee:	00 00 
+}
+  801cf0:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  801cf7:	00 00 
+  801cf9:	5d                   	pop    %rbp
+  801cfa:	c3                   	ret
+
+0000000000801cfb <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  801cfb:	55                   	push   %rbp
+  801cfc:	48 89 e5             	mov    %rsp,%rbp
+  801cff:	41 54                	push   %r12
+  801d01:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  801d02:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801d07:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801d0c:	48 89 de             	mov    %rbx,%rsi
+  801d0f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d14:	48 b8 fa 11 80 00 00 	movabs $0x8011fa,%rax
+  801d1b:	00 00 00 
+  801d1e:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  801d20:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  801d27:	00 00 00 
+  801d2a:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  801d30:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801d35:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801d3a:	48 89 de             	mov    %rbx,%rsi
+  801d3d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d42:	48 b8 54 11 80 00 00 	movabs $0x801154,%rax
+  801d49:	00 00 00 
+  801d4c:	ff d0                	call   *%rax
+  801d4e:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  801d50:	85 c0                	test   %eax,%eax
+  801d52:	0f 88 a2 00 00 00    	js     801dfa <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  801d58:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801d5f:	00 00 00 
+  801d62:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801d68:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801d6d:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  801d6f:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  801d74:	49 bc 55 4a 80 00 00 	movabs $0x804a55,%r12
+  801d7b:	00 00 00 
+  801d7e:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  801d81:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  801d86:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  801d89:	48 b8 b9 1c 80 00 00 	movabs $0x801cb9,%rax
+  801d90:	00 00 00 
+  801d93:	ff d0                	call   *%rax
+  801d95:	89 c7                	mov    %eax,%edi
+  801d97:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  801d9d:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  801da2:	48 89 da             	mov    %rbx,%rdx
+  801da5:	be 09 00 00 00       	mov    $0x9,%esi
+  801daa:	48 b8 9a 51 80 00 00 	movabs $0x80519a,%rax
+  801db1:	00 00 00 
+  801db4:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  801db6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801dbb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dc0:	be 00 00 00 00       	mov    $0x0,%esi
+  801dc5:	bf 00 00 00 00       	mov    $0x0,%edi
+  801dca:	48 b8 76 51 80 00 00 	movabs $0x805176,%rax
+  801dd1:	00 00 00 
+  801dd4:	ff d0                	call   *%rax
+  801dd6:	89 c3                	mov    %eax,%ebx
+  801dd8:	85 c0                	test   %eax,%eax
+  801dda:	78 25                	js     801e01 <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  801ddc:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801de3:	00 00 00 
+  801de6:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801dec:	a3 00 26 82 00 00 00 	movabs %eax,0x822600
+  801df3:	00 00 
+    return 0;
+  801df5:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  801dfa:	89 d8                	mov    %ebx,%eax
+  801dfc:	5b                   	pop    %rbx
+  801dfd:	41 5c                	pop    %r12
+  801dff:	5d                   	pop    %rbp
+  801e00:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  801e01:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801e06:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  801e0b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e10:	48 b8 fa 11 80 00 00 	movabs $0x8011fa,%rax
+  801e17:	00 00 00 
+  801e1a:	ff d0                	call   *%rax
+        return res;
+  801e1c:	eb dc                	jmp    801dfa <fschan_setup+0xff>
+
+0000000000801e1e <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  801e1e:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  801e25:	00 00 00 
+  801e28:	80 38 00             	cmpb   $0x0,(%rax)
+  801e2b:	74 55                	je     801e82 <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801e2d:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801e34:	00 00 00 
+  801e37:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  801e3d:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801e42:	48 ba 00 26 82 00 00 	movabs $0x822600,%rdx
+  801e49:	00 00 00 
+  801e4c:	3b 0a                	cmp    (%rdx),%ecx
+  801e4e:	75 01                	jne    801e51 <fschan+0x33>
+}
+  801e50:	c3                   	ret
+fschan(void) {
+  801e51:	55                   	push   %rbp
+  801e52:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801e55:	48 b8 fb 1c 80 00 00 	movabs $0x801cfb,%rax
+  801e5c:	00 00 00 
+  801e5f:	ff d0                	call   *%rax
+  801e61:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  801e63:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801e68:	85 d2                	test   %edx,%edx
+  801e6a:	78 02                	js     801e6e <fschan+0x50>
+}
+  801e6c:	5d                   	pop    %rbp
+  801e6d:	c3                   	ret
+        fschan_enabled = 0;
+  801e6e:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  801e75:	00 00 00 
+  801e78:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  801e7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e80:	eb ea                	jmp    801e6c <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  801e82:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e87:	c3                   	ret
+
+0000000000801e88 <fbuf>:
+fbuf(struct Fd *fd) {
+  801e88:	55                   	push   %rbp
+  801e89:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  801e8c:	48 b8 87 15 80 00 00 	movabs $0x801587,%rax
+  801e93:	00 00 00 
+  801e96:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  801e98:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e9d:	48 83 f8 1f          	cmp    $0x1f,%rax
+  801ea1:	77 12                	ja     801eb5 <fbuf+0x2d>
+  801ea3:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  801ea7:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  801eae:	00 00 00 
+  801eb1:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  801eb5:	48 89 d0             	mov    %rdx,%rax
+  801eb8:	5d                   	pop    %rbp
+  801eb9:	c3                   	ret
+
+0000000000801eba <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  801eba:	55                   	push   %rbp
+  801ebb:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  801ebe:	48 83 c7 40          	add    $0x40,%rdi
+  801ec2:	48 b8 8f 4a 80 00 00 	movabs $0x804a8f,%rax
+  801ec9:	00 00 00 
+  801ecc:	ff d0                	call   *%rax
+  801ece:	84 c0                	test   %al,%al
+  801ed0:	75 02                	jne    801ed4 <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  801ed2:	5d                   	pop    %rbp
+  801ed3:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  801ed4:	48 b8 b9 1c 80 00 00 	movabs $0x801cb9,%rax
+  801edb:	00 00 00 
+  801ede:	ff d0                	call   *%rax
+  801ee0:	89 c7                	mov    %eax,%edi
+  801ee2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801ee8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801eed:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ef2:	be 0a 00 00 00       	mov    $0xa,%esi
+  801ef7:	48 b8 9a 51 80 00 00 	movabs $0x80519a,%rax
+  801efe:	00 00 00 
+  801f01:	ff d0                	call   *%rax
+}
+  801f03:	eb cd                	jmp    801ed2 <fschan_publish+0x18>
+
+0000000000801f05 <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  801f05:	55                   	push   %rbp
+  801f06:	48 89 e5             	mov    %rsp,%rbp
+  801f09:	41 57                	push   %r15
+  801f0b:	41 56                	push   %r14
+  801f0d:	41 55                	push   %r13
+  801f0f:	41 54                	push   %r12
+  801f11:	53                   	push   %rbx
+  801f12:	48 83 ec 48          	sub    $0x48,%rsp
+  801f16:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801f1a:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  801f1e:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  801f21:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  801f25:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  801f28:	48 ba 04 00 82 00 00 	movabs $0x820004,%rdx
+  801f2f:	00 00 00 
+  801f32:	8b 02                	mov    (%rdx),%eax
+  801f34:	83 c0 01             	add    $0x1,%eax
+  801f37:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801f3c:	0f 44 c1             	cmove  %ecx,%eax
+  801f3f:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  801f41:	4d 85 c0             	test   %r8,%r8
+  801f44:	74 2c                	je     801f72 <fschan_rw+0x6d>
+  801f46:	45 89 ce             	mov    %r9d,%r14d
+  801f49:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  801f50:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  801f54:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801f5a:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  801f61:	00 
+  801f62:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801f68:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f6d:	e9 41 01 00 00       	jmp    8020b3 <fschan_rw+0x1ae>
+  801f72:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  801f76:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801f7a:	e9 9c 01 00 00       	jmp    80211b <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  801f7f:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  801f83:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  801f86:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  801f89:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  801f8c:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  801f90:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  801f94:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  801f98:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  801f9c:	48 89 da             	mov    %rbx,%rdx
+  801f9f:	48 b8 56 0e 80 00 00 	movabs $0x800e56,%rax
+  801fa6:	00 00 00 
+  801fa9:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  801fab:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801faf:	48 b8 ba 1e 80 00 00 	movabs $0x801eba,%rax
+  801fb6:	00 00 00 
+  801fb9:	ff d0                	call   *%rax
+            queued += blk;
+  801fbb:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  801fbe:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  801fc2:	4d 39 fc             	cmp    %r15,%r12
+  801fc5:	73 6b                	jae    802032 <fschan_rw+0x12d>
+  801fc7:	41 83 fd 0f          	cmp    $0xf,%r13d
+  801fcb:	77 65                	ja     802032 <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  801fcd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801fd1:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  801fd5:	48 b8 6a 4a 80 00 00 	movabs $0x804a6a,%rax
+  801fdc:	00 00 00 
+  801fdf:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  801fe1:	4c 89 fb             	mov    %r15,%rbx
+  801fe4:	4c 29 e3             	sub    %r12,%rbx
+  801fe7:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  801fec:	48 39 d3             	cmp    %rdx,%rbx
+  801fef:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  801ff3:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  801ff7:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  801ffb:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  801fff:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  802002:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  802004:	48 b9 04 00 82 00 00 	movabs $0x820004,%rcx
+  80200b:	00 00 00 
+  80200e:	8b 09                	mov    (%rcx),%ecx
+  802010:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  802013:	83 fe 03             	cmp    $0x3,%esi
+  802016:	0f 85 63 ff ff ff    	jne    801f7f <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  80201c:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802020:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  802023:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  802026:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  802029:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  80202d:	e9 79 ff ff ff       	jmp    801fab <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  802032:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802036:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  80203d:	48 89 df             	mov    %rbx,%rdi
+  802040:	48 b8 2d 4b 80 00 00 	movabs $0x804b2d,%rax
+  802047:	00 00 00 
+  80204a:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  80204c:	48 89 df             	mov    %rbx,%rdi
+  80204f:	48 b8 bb 4a 80 00 00 	movabs $0x804abb,%rax
+  802056:	00 00 00 
+  802059:	ff d0                	call   *%rax
+  80205b:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  80205f:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  802063:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  802067:	75 25                	jne    80208e <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  802069:	8b 40 04             	mov    0x4(%rax),%eax
+  80206c:	85 c0                	test   %eax,%eax
+  80206e:	0f 88 86 00 00 00    	js     8020fa <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  802074:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  802078:	74 5b                	je     8020d5 <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  80207a:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  80207e:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  802082:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  802086:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  80208a:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  80208e:	48 89 df             	mov    %rbx,%rdi
+  802091:	48 b8 e2 4a 80 00 00 	movabs $0x804ae2,%rax
+  802098:	00 00 00 
+  80209b:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  80209d:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  8020a1:	83 f0 01             	xor    $0x1,%eax
+  8020a4:	4d 39 fc             	cmp    %r15,%r12
+  8020a7:	0f 92 c2             	setb   %dl
+  8020aa:	84 c2                	test   %al,%dl
+  8020ac:	75 05                	jne    8020b3 <fschan_rw+0x1ae>
+  8020ae:	45 85 ed             	test   %r13d,%r13d
+  8020b1:	74 50                	je     802103 <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  8020b3:	4d 39 fc             	cmp    %r15,%r12
+  8020b6:	0f 92 c1             	setb   %cl
+  8020b9:	41 83 fd 0f          	cmp    $0xf,%r13d
+  8020bd:	0f 96 c2             	setbe  %dl
+  8020c0:	84 d1                	test   %dl,%cl
+  8020c2:	0f 84 6a ff ff ff    	je     802032 <fschan_rw+0x12d>
+  8020c8:	84 c0                	test   %al,%al
+  8020ca:	0f 85 fd fe ff ff    	jne    801fcd <fschan_rw+0xc8>
+  8020d0:	e9 5d ff ff ff       	jmp    802032 <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  8020d5:	48 63 d0             	movslq %eax,%rdx
+  8020d8:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8020dc:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  8020e0:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8020e4:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  8020e8:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  8020ec:	48 b8 56 0e 80 00 00 	movabs $0x800e56,%rax
+  8020f3:	00 00 00 
+  8020f6:	ff d0                	call   *%rax
+  8020f8:	eb 80                	jmp    80207a <fschan_rw+0x175>
+                err = msg->fm_res;
+  8020fa:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  8020fd:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  802101:	eb 8b                	jmp    80208e <fschan_rw+0x189>
+    return done || !err ? done : err;
+  802103:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  802108:	0f 85 68 fe ff ff    	jne    801f76 <fschan_rw+0x71>
+  80210e:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  802111:	85 c0                	test   %eax,%eax
+  802113:	0f 84 5d fe ff ff    	je     801f76 <fschan_rw+0x71>
+  802119:	48 98                	cltq
+}
+  80211b:	48 83 c4 48          	add    $0x48,%rsp
+  80211f:	5b                   	pop    %rbx
+  802120:	41 5c                	pop    %r12
+  802122:	41 5d                	pop    %r13
+  802124:	41 5e                	pop    %r14
+  802126:	41 5f                	pop    %r15
+  802128:	5d                   	pop    %rbp
+  802129:	c3                   	ret
+
+000000000080212a <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  80212a:	55                   	push   %rbp
+  80212b:	48 89 e5             	mov    %rsp,%rbp
+  80212e:	41 56                	push   %r14
+  802130:	41 55                	push   %r13
+  802132:	41 54                	push   %r12
+  802134:	53                   	push   %rbx
+  802135:	48 83 ec 10          	sub    $0x10,%rsp
+  802139:	49 89 fe             	mov    %rdi,%r14
+  80213c:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  80213f:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  802143:	48 29 f3             	sub    %rsi,%rbx
+  802146:	48 39 d3             	cmp    %rdx,%rbx
+  802149:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  80214d:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  802154:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  802155:	bf 00 10 00 00       	mov    $0x1000,%edi
+  80215a:	49 bd 5d 46 80 00 00 	movabs $0x80465d,%r13
+  802161:	00 00 00 
+  802164:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  80216b:	76 1e                	jbe    80218b <mmap_fault+0x61>
+  80216d:	4c 01 e7             	add    %r12,%rdi
+  802170:	41 ff d5             	call   *%r13
+  802173:	84 c0                	test   %al,%al
+  802175:	75 14                	jne    80218b <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  802177:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80217b:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  802182:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  802186:	48 39 df             	cmp    %rbx,%rdi
+  802189:	72 e2                	jb     80216d <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  80218b:	48 bb 00 10 82 00 00 	movabs $0x821000,%rbx
+  802192:	00 00 00 
+  802195:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  80219c:	00 00 00 
+  80219f:	4c 89 f0             	mov    %r14,%rax
+  8021a2:	48 29 d0             	sub    %rdx,%rax
+  8021a5:	48 c1 f8 03          	sar    $0x3,%rax
+  8021a9:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  8021b0:	aa aa aa 
+  8021b3:	48 0f af c2          	imul   %rdx,%rax
+  8021b7:	48 c1 e0 0c          	shl    $0xc,%rax
+  8021bb:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  8021c0:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  8021c4:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  8021c6:	44 89 e0             	mov    %r12d,%eax
+  8021c9:	41 03 46 10          	add    0x10(%r14),%eax
+  8021cd:	41 2b 06             	sub    (%r14),%eax
+  8021d0:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  8021d3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8021d7:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  8021db:	41 8b 46 14          	mov    0x14(%r14),%eax
+  8021df:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  8021e2:	48 b8 b9 1c 80 00 00 	movabs $0x801cb9,%rax
+  8021e9:	00 00 00 
+  8021ec:	ff d0                	call   *%rax
+  8021ee:	89 c7                	mov    %eax,%edi
+  8021f0:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8021f6:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8021fb:	48 89 da             	mov    %rbx,%rdx
+  8021fe:	be 0f 00 00 00       	mov    $0xf,%esi
+  802203:	48 b8 9a 51 80 00 00 	movabs $0x80519a,%rax
+  80220a:	00 00 00 
+  80220d:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  80220f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802214:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802218:	4c 89 e6             	mov    %r12,%rsi
+  80221b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802220:	48 b8 76 51 80 00 00 	movabs $0x805176,%rax
+  802227:	00 00 00 
+  80222a:	ff d0                	call   *%rax
+  80222c:	48 98                	cltq
+}
+  80222e:	48 83 c4 10          	add    $0x10,%rsp
+  802232:	5b                   	pop    %rbx
+  802233:	41 5c                	pop    %r12
+  802235:	41 5d                	pop    %r13
+  802237:	41 5e                	pop    %r14
+  802239:	5d                   	pop    %rbp
+  80223a:	c3                   	ret
+
+000000000080223b <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  80223b:	48 8b 37             	mov    (%rdi),%rsi
+  80223e:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  802245:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  80224c:	00 00 00 
+  80224f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802254:	eb 0f                	jmp    802265 <mmap_pgfault+0x2a>
+  802256:	c3                   	ret
+  802257:	48 83 c1 01          	add    $0x1,%rcx
+  80225b:	48 83 c2 18          	add    $0x18,%rdx
+  80225f:	48 83 f9 20          	cmp    $0x20,%rcx
+  802263:	74 6e                	je     8022d3 <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  802265:	48 8b 02             	mov    (%rdx),%rax
+  802268:	48 83 e8 01          	sub    $0x1,%rax
+  80226c:	48 39 f0             	cmp    %rsi,%rax
+  80226f:	73 e6                	jae    802257 <mmap_pgfault+0x1c>
+  802271:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  802275:	73 e0                	jae    802257 <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  802277:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  80227b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802280:	f6 c2 01             	test   $0x1,%dl
+  802283:	75 d1                	jne    802256 <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  802285:	f6 c2 02             	test   $0x2,%dl
+  802288:	74 1a                	je     8022a4 <mmap_pgfault+0x69>
+  80228a:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  80228e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802293:	48 bf 00 20 82 00 00 	movabs $0x822000,%rdi
+  80229a:	00 00 00 
+  80229d:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  8022a2:	74 35                	je     8022d9 <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  8022a4:	55                   	push   %rbp
+  8022a5:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  8022a8:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  8022ac:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8022b3:	00 00 00 
+  8022b6:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  8022ba:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8022bf:	48 b8 2a 21 80 00 00 	movabs $0x80212a,%rax
+  8022c6:	00 00 00 
+  8022c9:	ff d0                	call   *%rax
+  8022cb:	48 85 c0             	test   %rax,%rax
+  8022ce:	0f 9f c0             	setg   %al
+}
+  8022d1:	5d                   	pop    %rbp
+  8022d2:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  8022d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022d8:	c3                   	ret
+}
+  8022d9:	c3                   	ret
+
+00000000008022da <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  8022da:	55                   	push   %rbp
+  8022db:	48 89 e5             	mov    %rsp,%rbp
+  8022de:	41 54                	push   %r12
+  8022e0:	53                   	push   %rbx
+  8022e1:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8022e4:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8022eb:	00 00 00 
+  8022ee:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  8022f3:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8022f7:	74 15                	je     80230e <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8022f9:	48 83 c3 01          	add    $0x1,%rbx
+  8022fd:	48 83 c0 18          	add    $0x18,%rax
+  802301:	48 83 fb 20          	cmp    $0x20,%rbx
+  802305:	75 ec                	jne    8022f3 <mmap_alloc+0x19>
+    return NULL;
+  802307:	b8 00 00 00 00       	mov    $0x0,%eax
+  80230c:	eb 52                	jmp    802360 <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  80230e:	4c 89 e7             	mov    %r12,%rdi
+  802311:	48 b8 fe 45 80 00 00 	movabs $0x8045fe,%rax
+  802318:	00 00 00 
+  80231b:	ff d0                	call   *%rax
+  80231d:	41 89 c1             	mov    %eax,%r9d
+  802320:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  802327:	48 c1 e1 0c          	shl    $0xc,%rcx
+  80232b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802331:	ba 00 00 00 00       	mov    $0x0,%edx
+  802336:	4c 89 e6             	mov    %r12,%rsi
+  802339:	bf 00 00 00 00       	mov    $0x0,%edi
+  80233e:	48 b8 aa 11 80 00 00 	movabs $0x8011aa,%rax
+  802345:	00 00 00 
+  802348:	ff d0                	call   *%rax
+  80234a:	85 c0                	test   %eax,%eax
+  80234c:	78 17                	js     802365 <mmap_alloc+0x8b>
+        return &mmaps[i];
+  80234e:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  802352:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  802359:	00 00 00 
+  80235c:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  802360:	5b                   	pop    %rbx
+  802361:	41 5c                	pop    %r12
+  802363:	5d                   	pop    %rbp
+  802364:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  802365:	b8 00 00 00 00       	mov    $0x0,%eax
+  80236a:	eb f4                	jmp    802360 <mmap_alloc+0x86>
+
+000000000080236c <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  80236c:	55                   	push   %rbp
+  80236d:	48 89 e5             	mov    %rsp,%rbp
+  802370:	41 56                	push   %r14
+  802372:	41 55                	push   %r13
+  802374:	41 54                	push   %r12
+  802376:	53                   	push   %rbx
+  802377:	48 83 ec 10          	sub    $0x10,%rsp
+  80237b:	41 89 fc             	mov    %edi,%r12d
+  80237e:	49 89 f5             	mov    %rsi,%r13
+  802381:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  802384:	48 89 f0             	mov    %rsi,%rax
+  802387:	48 09 d0             	or     %rdx,%rax
+  80238a:	75 0d                	jne    802399 <fsipc+0x2d>
+  80238c:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  80238f:	83 f8 04             	cmp    $0x4,%eax
+  802392:	76 7d                	jbe    802411 <fsipc+0xa5>
+  802394:	83 ff 0d             	cmp    $0xd,%edi
+  802397:	74 78                	je     802411 <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  802399:	48 b8 b9 1c 80 00 00 	movabs $0x801cb9,%rax
+  8023a0:	00 00 00 
+  8023a3:	ff d0                	call   *%rax
+  8023a5:	89 c7                	mov    %eax,%edi
+  8023a7:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  8023ae:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  8023b5:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  8023bc:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8023c2:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  8023c9:	00 00 00 
+  8023cc:	44 89 e6             	mov    %r12d,%esi
+  8023cf:	48 b8 9a 51 80 00 00 	movabs $0x80519a,%rax
+  8023d6:	00 00 00 
+  8023d9:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  8023db:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8023e2:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  8023e3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023e8:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8023ec:	4c 89 ee             	mov    %r13,%rsi
+  8023ef:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023f4:	48 b8 76 51 80 00 00 	movabs $0x805176,%rax
+  8023fb:	00 00 00 
+  8023fe:	ff d0                	call   *%rax
+  802400:	89 c3                	mov    %eax,%ebx
+}
+  802402:	89 d8                	mov    %ebx,%eax
+  802404:	48 83 c4 10          	add    $0x10,%rsp
+  802408:	5b                   	pop    %rbx
+  802409:	41 5c                	pop    %r12
+  80240b:	41 5d                	pop    %r13
+  80240d:	41 5e                	pop    %r14
+  80240f:	5d                   	pop    %rbp
+  802410:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  802411:	48 b8 1e 1e 80 00 00 	movabs $0x801e1e,%rax
+  802418:	00 00 00 
+  80241b:	ff d0                	call   *%rax
+  80241d:	49 89 c6             	mov    %rax,%r14
+  802420:	48 85 c0             	test   %rax,%rax
+  802423:	0f 84 70 ff ff ff    	je     802399 <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  802429:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  80242d:	48 b8 6a 4a 80 00 00 	movabs $0x804a6a,%rax
+  802434:	00 00 00 
+  802437:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  802439:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  80243c:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  802443:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  802447:	ba 10 00 00 00       	mov    $0x10,%edx
+  80244c:	48 be 00 00 83 00 00 	movabs $0x830000,%rsi
+  802453:	00 00 00 
+  802456:	48 b8 56 0e 80 00 00 	movabs $0x800e56,%rax
+  80245d:	00 00 00 
+  802460:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  802462:	4c 89 f7             	mov    %r14,%rdi
+  802465:	48 b8 ba 1e 80 00 00 	movabs $0x801eba,%rax
+  80246c:	00 00 00 
+  80246f:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  802471:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  802478:	4c 89 f7             	mov    %r14,%rdi
+  80247b:	48 b8 2d 4b 80 00 00 	movabs $0x804b2d,%rax
+  802482:	00 00 00 
+  802485:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  802487:	4c 89 f7             	mov    %r14,%rdi
+  80248a:	48 b8 bb 4a 80 00 00 	movabs $0x804abb,%rax
+  802491:	00 00 00 
+  802494:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  802496:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  802499:	41 83 fc 05          	cmp    $0x5,%r12d
+  80249d:	75 04                	jne    8024a3 <fsipc+0x137>
+  80249f:	85 db                	test   %ebx,%ebx
+  8024a1:	79 14                	jns    8024b7 <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  8024a3:	4c 89 f7             	mov    %r14,%rdi
+  8024a6:	48 b8 e2 4a 80 00 00 	movabs $0x804ae2,%rax
+  8024ad:	00 00 00 
+  8024b0:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  8024b2:	e9 4b ff ff ff       	jmp    802402 <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  8024b7:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  8024bb:	ba 88 00 00 00       	mov    $0x88,%edx
+  8024c0:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  8024c7:	00 00 00 
+  8024ca:	48 b8 56 0e 80 00 00 	movabs $0x800e56,%rax
+  8024d1:	00 00 00 
+  8024d4:	ff d0                	call   *%rax
+  8024d6:	eb cb                	jmp    8024a3 <fsipc+0x137>
+
+00000000008024d8 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  8024d8:	55                   	push   %rbp
+  8024d9:	48 89 e5             	mov    %rsp,%rbp
+  8024dc:	41 57                	push   %r15
+  8024de:	41 56                	push   %r14
+  8024e0:	41 55                	push   %r13
+  8024e2:	41 54                	push   %r12
+  8024e4:	53                   	push   %rbx
+  8024e5:	48 83 ec 18          	sub    $0x18,%rsp
+  8024e9:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  8024ed:	49 89 f6             	mov    %rsi,%r14
+  8024f0:	49 89 d4             	mov    %rdx,%r12
+  8024f3:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  8024f6:	48 b8 1e 1e 80 00 00 	movabs $0x801e1e,%rax
+  8024fd:	00 00 00 
+  802500:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  802502:	48 85 c0             	test   %rax,%rax
+  802505:	0f 85 96 00 00 00    	jne    8025a1 <devfile_write_direct+0xc9>
+    size_t write = 0;
+  80250b:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802512:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802513:	49 bf 00 00 83 00 00 	movabs $0x830000,%r15
+  80251a:	00 00 00 
+    while (n) {
+  80251d:	4d 85 e4             	test   %r12,%r12
+  802520:	74 79                	je     80259b <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802522:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  802527:	49 39 dc             	cmp    %rbx,%r12
+  80252a:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  80252e:	48 89 da             	mov    %rbx,%rdx
+  802531:	4c 89 f6             	mov    %r14,%rsi
+  802534:	48 bf 00 10 83 00 00 	movabs $0x831000,%rdi
+  80253b:	00 00 00 
+  80253e:	48 b8 56 0e 80 00 00 	movabs $0x800e56,%rax
+  802545:	00 00 00 
+  802548:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80254a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80254e:	8b 40 0c             	mov    0xc(%rax),%eax
+  802551:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  802554:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802557:	44 01 e8             	add    %r13d,%eax
+  80255a:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  80255e:	41 0f 44 c5          	cmove  %r13d,%eax
+  802562:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  802566:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  80256a:	48 89 da             	mov    %rbx,%rdx
+  80256d:	be 00 00 00 00       	mov    $0x0,%esi
+  802572:	bf 04 00 00 00       	mov    $0x4,%edi
+  802577:	48 b8 6c 23 80 00 00 	movabs $0x80236c,%rax
+  80257e:	00 00 00 
+  802581:	ff d0                	call   *%rax
+        if (res < 0)
+  802583:	85 c0                	test   %eax,%eax
+  802585:	78 4a                	js     8025d1 <devfile_write_direct+0xf9>
+        buf += res;
+  802587:	48 98                	cltq
+  802589:	49 01 c6             	add    %rax,%r14
+        write += res;
+  80258c:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  802590:	49 29 c4             	sub    %rax,%r12
+  802593:	75 8d                	jne    802522 <devfile_write_direct+0x4a>
+    return write;
+  802595:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802599:	eb 27                	jmp    8025c2 <devfile_write_direct+0xea>
+    size_t write = 0;
+  80259b:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  80259f:	eb f4                	jmp    802595 <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  8025a1:	45 89 e9             	mov    %r13d,%r9d
+  8025a4:	4d 89 e0             	mov    %r12,%r8
+  8025a7:	4c 89 f1             	mov    %r14,%rcx
+  8025aa:	ba 04 00 00 00       	mov    $0x4,%edx
+  8025af:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8025b3:	48 89 c7             	mov    %rax,%rdi
+  8025b6:	48 b8 05 1f 80 00 00 	movabs $0x801f05,%rax
+  8025bd:	00 00 00 
+  8025c0:	ff d0                	call   *%rax
+}
+  8025c2:	48 83 c4 18          	add    $0x18,%rsp
+  8025c6:	5b                   	pop    %rbx
+  8025c7:	41 5c                	pop    %r12
+  8025c9:	41 5d                	pop    %r13
+  8025cb:	41 5e                	pop    %r14
+  8025cd:	41 5f                	pop    %r15
+  8025cf:	5d                   	pop    %rbp
+  8025d0:	c3                   	ret
+            return res;
+  8025d1:	48 98                	cltq
+  8025d3:	eb ed                	jmp    8025c2 <devfile_write_direct+0xea>
+
+00000000008025d5 <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  8025d5:	55                   	push   %rbp
+  8025d6:	48 89 e5             	mov    %rsp,%rbp
+  8025d9:	41 54                	push   %r12
+  8025db:	53                   	push   %rbx
+  8025dc:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  8025df:	48 b8 88 1e 80 00 00 	movabs $0x801e88,%rax
+  8025e6:	00 00 00 
+  8025e9:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  8025eb:	48 85 c0             	test   %rax,%rax
+  8025ee:	74 71                	je     802661 <fbuf_flush+0x8c>
+  8025f0:	48 89 c3             	mov    %rax,%rbx
+  8025f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025f8:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  8025fc:	75 05                	jne    802603 <fbuf_flush+0x2e>
+}
+  8025fe:	5b                   	pop    %rbx
+  8025ff:	41 5c                	pop    %r12
+  802601:	5d                   	pop    %rbp
+  802602:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  802603:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  802606:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  80260a:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802611:	00 00 00 
+  802614:	48 89 de             	mov    %rbx,%rsi
+  802617:	48 29 c6             	sub    %rax,%rsi
+  80261a:	48 c1 fe 03          	sar    $0x3,%rsi
+  80261e:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802625:	aa aa aa 
+  802628:	48 0f af f0          	imul   %rax,%rsi
+  80262c:	48 c1 e6 0e          	shl    $0xe,%rsi
+  802630:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802635:	48 01 c6             	add    %rax,%rsi
+  802638:	4c 89 e7             	mov    %r12,%rdi
+  80263b:	48 b8 d8 24 80 00 00 	movabs $0x8024d8,%rax
+  802642:	00 00 00 
+  802645:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  802647:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  80264b:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802652:	00 
+    return res < 0 ? res : 0;
+  802653:	48 85 c0             	test   %rax,%rax
+  802656:	ba 00 00 00 00       	mov    $0x0,%edx
+  80265b:	48 0f 4f c2          	cmovg  %rdx,%rax
+  80265f:	eb 9d                	jmp    8025fe <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  802661:	b8 00 00 00 00       	mov    $0x0,%eax
+  802666:	eb 96                	jmp    8025fe <fbuf_flush+0x29>
+
+0000000000802668 <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  802668:	55                   	push   %rbp
+  802669:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  80266c:	48 b8 d5 25 80 00 00 	movabs $0x8025d5,%rax
+  802673:	00 00 00 
+  802676:	ff d0                	call   *%rax
+}
+  802678:	5d                   	pop    %rbp
+  802679:	c3                   	ret
+
+000000000080267a <devfile_write>:
+    if (!fd || !buf)
+  80267a:	48 85 ff             	test   %rdi,%rdi
+  80267d:	0f 84 d3 01 00 00    	je     802856 <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802683:	55                   	push   %rbp
+  802684:	48 89 e5             	mov    %rsp,%rbp
+  802687:	41 57                	push   %r15
+  802689:	41 56                	push   %r14
+  80268b:	41 55                	push   %r13
+  80268d:	41 54                	push   %r12
+  80268f:	53                   	push   %rbx
+  802690:	48 83 ec 08          	sub    $0x8,%rsp
+  802694:	49 89 fc             	mov    %rdi,%r12
+  802697:	49 89 f6             	mov    %rsi,%r14
+  80269a:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  80269d:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  8026a2:	48 85 f6             	test   %rsi,%rsi
+  8026a5:	0f 84 9c 01 00 00    	je     802847 <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  8026ab:	48 b8 88 1e 80 00 00 	movabs $0x801e88,%rax
+  8026b2:	00 00 00 
+  8026b5:	ff d0                	call   *%rax
+  8026b7:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  8026ba:	48 85 c0             	test   %rax,%rax
+  8026bd:	0f 84 a2 00 00 00    	je     802765 <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  8026c3:	be 00 10 00 00       	mov    $0x1000,%esi
+  8026c8:	4c 89 e7             	mov    %r12,%rdi
+  8026cb:	48 b8 19 11 80 00 00 	movabs $0x801119,%rax
+  8026d2:	00 00 00 
+  8026d5:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  8026d7:	83 f8 02             	cmp    $0x2,%eax
+  8026da:	0f 8f 85 00 00 00    	jg     802765 <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  8026e0:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8026e7:	00 00 00 
+  8026ea:	4d 89 ef             	mov    %r13,%r15
+  8026ed:	49 29 c7             	sub    %rax,%r15
+  8026f0:	49 c1 ff 03          	sar    $0x3,%r15
+  8026f4:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8026fb:	aa aa aa 
+  8026fe:	4c 0f af f8          	imul   %rax,%r15
+  802702:	49 c1 e7 0e          	shl    $0xe,%r15
+  802706:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  80270b:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  80270e:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802713:	0f 84 d7 00 00 00    	je     8027f0 <devfile_write+0x176>
+  802719:	49 8b 45 10          	mov    0x10(%r13),%rax
+  80271d:	89 c2                	mov    %eax,%edx
+  80271f:	41 03 55 0c          	add    0xc(%r13),%edx
+  802723:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  802728:	75 0f                	jne    802739 <devfile_write+0xbf>
+  80272a:	48 01 d8             	add    %rbx,%rax
+  80272d:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  802733:	0f 86 92 00 00 00    	jbe    8027cb <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802739:	4c 89 e7             	mov    %r12,%rdi
+  80273c:	48 b8 d5 25 80 00 00 	movabs $0x8025d5,%rax
+  802743:	00 00 00 
+  802746:	ff d0                	call   *%rax
+  802748:	85 c0                	test   %eax,%eax
+  80274a:	78 52                	js     80279e <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  80274c:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802753:	77 7f                	ja     8027d4 <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  802755:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  80275a:	0f 85 c2 00 00 00    	jne    802822 <devfile_write+0x1a8>
+  802760:	e9 94 00 00 00       	jmp    8027f9 <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  802765:	4c 89 e7             	mov    %r12,%rdi
+  802768:	48 b8 d5 25 80 00 00 	movabs $0x8025d5,%rax
+  80276f:	00 00 00 
+  802772:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802774:	85 c0                	test   %eax,%eax
+  802776:	79 07                	jns    80277f <devfile_write+0x105>
+  802778:	48 98                	cltq
+  80277a:	e9 c8 00 00 00       	jmp    802847 <devfile_write+0x1cd>
+  80277f:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802784:	48 89 da             	mov    %rbx,%rdx
+  802787:	4c 89 f6             	mov    %r14,%rsi
+  80278a:	4c 89 e7             	mov    %r12,%rdi
+  80278d:	48 b8 d8 24 80 00 00 	movabs $0x8024d8,%rax
+  802794:	00 00 00 
+  802797:	ff d0                	call   *%rax
+  802799:	e9 a9 00 00 00       	jmp    802847 <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  80279e:	48 98                	cltq
+  8027a0:	e9 a2 00 00 00       	jmp    802847 <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8027a5:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8027aa:	ba 00 40 00 00       	mov    $0x4000,%edx
+  8027af:	4c 89 fe             	mov    %r15,%rsi
+  8027b2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027b7:	48 b8 54 11 80 00 00 	movabs $0x801154,%rax
+  8027be:	00 00 00 
+  8027c1:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  8027c3:	85 c0                	test   %eax,%eax
+  8027c5:	79 45                	jns    80280c <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8027c7:	48 98                	cltq
+  8027c9:	eb 7c                	jmp    802847 <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  8027cb:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  8027d2:	76 4e                	jbe    802822 <devfile_write+0x1a8>
+  8027d4:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  8027d9:	48 89 da             	mov    %rbx,%rdx
+  8027dc:	4c 89 f6             	mov    %r14,%rsi
+  8027df:	4c 89 e7             	mov    %r12,%rdi
+  8027e2:	48 b8 d8 24 80 00 00 	movabs $0x8024d8,%rax
+  8027e9:	00 00 00 
+  8027ec:	ff d0                	call   *%rax
+  8027ee:	eb 57                	jmp    802847 <devfile_write+0x1cd>
+  8027f0:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  8027f7:	77 db                	ja     8027d4 <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  8027f9:	4c 89 ff             	mov    %r15,%rdi
+  8027fc:	48 b8 5d 46 80 00 00 	movabs $0x80465d,%rax
+  802803:	00 00 00 
+  802806:	ff d0                	call   *%rax
+  802808:	84 c0                	test   %al,%al
+  80280a:	74 99                	je     8027a5 <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  80280c:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  802811:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802816:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  80281a:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  802821:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  802822:	4c 89 ff             	mov    %r15,%rdi
+  802825:	49 03 7d 10          	add    0x10(%r13),%rdi
+  802829:	48 89 da             	mov    %rbx,%rdx
+  80282c:	4c 89 f6             	mov    %r14,%rsi
+  80282f:	48 b8 56 0e 80 00 00 	movabs $0x800e56,%rax
+  802836:	00 00 00 
+  802839:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  80283b:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  80283f:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  802844:	48 89 d8             	mov    %rbx,%rax
+}
+  802847:	48 83 c4 08          	add    $0x8,%rsp
+  80284b:	5b                   	pop    %rbx
+  80284c:	41 5c                	pop    %r12
+  80284e:	41 5d                	pop    %r13
+  802850:	41 5e                	pop    %r14
+  802852:	41 5f                	pop    %r15
+  802854:	5d                   	pop    %rbp
+  802855:	c3                   	ret
+        return E_INVAL;
+  802856:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  80285b:	c3                   	ret
+
+000000000080285c <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80285c:	55                   	push   %rbp
+  80285d:	48 89 e5             	mov    %rsp,%rbp
+  802860:	41 54                	push   %r12
+  802862:	53                   	push   %rbx
+  802863:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  802866:	48 b8 d5 25 80 00 00 	movabs $0x8025d5,%rax
+  80286d:	00 00 00 
+  802870:	ff d0                	call   *%rax
+  802872:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  802875:	48 89 df             	mov    %rbx,%rdi
+  802878:	48 b8 88 1e 80 00 00 	movabs $0x801e88,%rax
+  80287f:	00 00 00 
+  802882:	ff d0                	call   *%rax
+  802884:	48 85 c0             	test   %rax,%rax
+  802887:	74 17                	je     8028a0 <devfile_flush+0x44>
+  802889:	48 89 df             	mov    %rbx,%rdi
+  80288c:	48 b8 88 1e 80 00 00 	movabs $0x801e88,%rax
+  802893:	00 00 00 
+  802896:	ff d0                	call   *%rax
+  802898:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  80289f:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8028a0:	8b 43 0c             	mov    0xc(%rbx),%eax
+  8028a3:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  8028aa:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  8028ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8028b6:	bf 06 00 00 00       	mov    $0x6,%edi
+  8028bb:	48 b8 6c 23 80 00 00 	movabs $0x80236c,%rax
+  8028c2:	00 00 00 
+  8028c5:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  8028c7:	45 85 e4             	test   %r12d,%r12d
+  8028ca:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  8028ce:	5b                   	pop    %rbx
+  8028cf:	41 5c                	pop    %r12
+  8028d1:	5d                   	pop    %rbp
+  8028d2:	c3                   	ret
+
+00000000008028d3 <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  8028d3:	55                   	push   %rbp
+  8028d4:	48 89 e5             	mov    %rsp,%rbp
+  8028d7:	41 57                	push   %r15
+  8028d9:	41 56                	push   %r14
+  8028db:	41 55                	push   %r13
+  8028dd:	41 54                	push   %r12
+  8028df:	53                   	push   %rbx
+  8028e0:	48 83 ec 38          	sub    $0x38,%rsp
+  8028e4:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8028e8:	49 89 f7             	mov    %rsi,%r15
+  8028eb:	48 89 d3             	mov    %rdx,%rbx
+  8028ee:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  8028f1:	48 b8 1e 1e 80 00 00 	movabs $0x801e1e,%rax
+  8028f8:	00 00 00 
+  8028fb:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  8028fd:	48 85 c0             	test   %rax,%rax
+  802900:	75 20                	jne    802922 <devfile_read_direct+0x4f>
+    bool map = 1;
+  802902:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  802907:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  80290e:	00 
+    while (n) {
+  80290f:	48 85 db             	test   %rbx,%rbx
+  802912:	0f 85 df 00 00 00    	jne    8029f7 <devfile_read_direct+0x124>
+    size_t read = 0;
+  802918:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  80291c:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802920:	eb 21                	jmp    802943 <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802922:	45 89 f1             	mov    %r14d,%r9d
+  802925:	49 89 d8             	mov    %rbx,%r8
+  802928:	4c 89 f9             	mov    %r15,%rcx
+  80292b:	ba 03 00 00 00       	mov    $0x3,%edx
+  802930:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802934:	48 89 c7             	mov    %rax,%rdi
+  802937:	48 b8 05 1f 80 00 00 	movabs $0x801f05,%rax
+  80293e:	00 00 00 
+  802941:	ff d0                	call   *%rax
+}
+  802943:	48 83 c4 38          	add    $0x38,%rsp
+  802947:	5b                   	pop    %rbx
+  802948:	41 5c                	pop    %r12
+  80294a:	41 5d                	pop    %r13
+  80294c:	41 5e                	pop    %r14
+  80294e:	41 5f                	pop    %r15
+  802950:	5d                   	pop    %rbp
+  802951:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802952:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802956:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  80295c:	75 1e                	jne    80297c <devfile_read_direct+0xa9>
+  80295e:	e9 e2 00 00 00       	jmp    802a45 <devfile_read_direct+0x172>
+            if (!res) return read;
+  802963:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802967:	eb da                	jmp    802943 <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  802969:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  80296d:	0f 85 d0 01 00 00    	jne    802b43 <devfile_read_direct+0x270>
+            map = 0;
+  802973:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802977:	eb 03                	jmp    80297c <devfile_read_direct+0xa9>
+  802979:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  80297c:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802981:	48 39 d3             	cmp    %rdx,%rbx
+  802984:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802988:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80298c:	8b 40 0c             	mov    0xc(%rax),%eax
+  80298f:	48 b9 00 00 83 00 00 	movabs $0x830000,%rcx
+  802996:	00 00 00 
+  802999:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  80299b:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  80299f:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  8029a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8029a8:	bf 03 00 00 00       	mov    $0x3,%edi
+  8029ad:	48 b8 6c 23 80 00 00 	movabs $0x80236c,%rax
+  8029b4:	00 00 00 
+  8029b7:	ff d0                	call   *%rax
+        if (res <= 0)
+  8029b9:	85 c0                	test   %eax,%eax
+  8029bb:	0f 8e 63 01 00 00    	jle    802b24 <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  8029c1:	4c 63 e0             	movslq %eax,%r12
+  8029c4:	4c 89 e2             	mov    %r12,%rdx
+  8029c7:	48 be 00 10 83 00 00 	movabs $0x831000,%rsi
+  8029ce:	00 00 00 
+  8029d1:	4c 89 ff             	mov    %r15,%rdi
+  8029d4:	48 b8 56 0e 80 00 00 	movabs $0x800e56,%rax
+  8029db:	00 00 00 
+  8029de:	ff d0                	call   *%rax
+        buf += res;
+  8029e0:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  8029e3:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  8029e6:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  8029ea:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  8029ee:	48 85 db             	test   %rbx,%rbx
+  8029f1:	0f 84 25 ff ff ff    	je     80291c <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  8029f7:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  8029fa:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  8029fe:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802a02:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802a06:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  802a0d:	0f 97 c2             	seta   %dl
+  802a10:	20 c2                	and    %al,%dl
+  802a12:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  802a15:	0f 84 5e ff ff ff    	je     802979 <devfile_read_direct+0xa6>
+  802a1b:	4c 89 fa             	mov    %r15,%rdx
+  802a1e:	4d 89 fd             	mov    %r15,%r13
+  802a21:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  802a28:	0f 85 4e ff ff ff    	jne    80297c <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  802a2e:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802a32:	0f 84 1a ff ff ff    	je     802952 <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802a38:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802a3f:	0f 85 37 ff ff ff    	jne    80297c <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  802a45:	48 89 d8             	mov    %rbx,%rax
+  802a48:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802a4e:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802a53:	48 39 c8             	cmp    %rcx,%rax
+  802a56:	48 0f 47 c1          	cmova  %rcx,%rax
+  802a5a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  802a5e:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  802a62:	49 89 d4             	mov    %rdx,%r12
+  802a65:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  802a69:	48 b8 fe 45 80 00 00 	movabs $0x8045fe,%rax
+  802a70:	00 00 00 
+  802a73:	ff d0                	call   *%rax
+  802a75:	a8 40                	test   $0x40,%al
+  802a77:	0f 85 b9 00 00 00    	jne    802b36 <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  802a7d:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  802a84:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a88:	49 39 c5             	cmp    %rax,%r13
+  802a8b:	72 d8                	jb     802a65 <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802a8d:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802a91:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802a98:	00 00 00 
+  802a9b:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802a9f:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  802aa2:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  802aa4:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  802aa8:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  802aac:	48 b8 b9 1c 80 00 00 	movabs $0x801cb9,%rax
+  802ab3:	00 00 00 
+  802ab6:	ff d0                	call   *%rax
+  802ab8:	89 c7                	mov    %eax,%edi
+  802aba:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802ac0:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802ac5:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802acc:	00 00 00 
+  802acf:	be 0e 00 00 00       	mov    $0xe,%esi
+  802ad4:	48 b8 9a 51 80 00 00 	movabs $0x80519a,%rax
+  802adb:	00 00 00 
+  802ade:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  802ae0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802ae5:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802ae9:	4c 89 fe             	mov    %r15,%rsi
+  802aec:	bf 00 00 00 00       	mov    $0x0,%edi
+  802af1:	48 b8 76 51 80 00 00 	movabs $0x805176,%rax
+  802af8:	00 00 00 
+  802afb:	ff d0                	call   *%rax
+  802afd:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  802b00:	48 85 d2             	test   %rdx,%rdx
+  802b03:	0f 84 5a fe ff ff    	je     802963 <devfile_read_direct+0x90>
+            if (res > 0) {
+  802b09:	0f 8e 5a fe ff ff    	jle    802969 <devfile_read_direct+0x96>
+                buf += res;
+  802b0f:	48 98                	cltq
+  802b11:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  802b14:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  802b17:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  802b1b:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  802b1f:	e9 ca fe ff ff       	jmp    8029ee <devfile_read_direct+0x11b>
+            return res ? res : read;
+  802b24:	41 89 c5             	mov    %eax,%r13d
+  802b27:	48 98                	cltq
+  802b29:	45 85 ed             	test   %r13d,%r13d
+  802b2c:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  802b31:	e9 0d fe ff ff       	jmp    802943 <devfile_read_direct+0x70>
+            map = 0;
+  802b36:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802b3a:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802b3e:	e9 39 fe ff ff       	jmp    80297c <devfile_read_direct+0xa9>
+  802b43:	48 89 d0             	mov    %rdx,%rax
+  802b46:	e9 f8 fd ff ff       	jmp    802943 <devfile_read_direct+0x70>
+
+0000000000802b4b <devfile_read>:
+    if (!fd || !buf)
+  802b4b:	48 85 ff             	test   %rdi,%rdi
+  802b4e:	0f 84 21 02 00 00    	je     802d75 <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802b54:	55                   	push   %rbp
+  802b55:	48 89 e5             	mov    %rsp,%rbp
+  802b58:	41 57                	push   %r15
+  802b5a:	41 56                	push   %r14
+  802b5c:	41 55                	push   %r13
+  802b5e:	41 54                	push   %r12
+  802b60:	53                   	push   %rbx
+  802b61:	48 83 ec 28          	sub    $0x28,%rsp
+  802b65:	48 89 fb             	mov    %rdi,%rbx
+  802b68:	49 89 f4             	mov    %rsi,%r12
+  802b6b:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  802b6e:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802b73:	48 85 f6             	test   %rsi,%rsi
+  802b76:	74 4b                	je     802bc3 <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  802b78:	48 b8 88 1e 80 00 00 	movabs $0x801e88,%rax
+  802b7f:	00 00 00 
+  802b82:	ff d0                	call   *%rax
+  802b84:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802b87:	48 85 c0             	test   %rax,%rax
+  802b8a:	74 22                	je     802bae <devfile_read+0x63>
+  802b8c:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  802b93:	77 19                	ja     802bae <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802b95:	be 00 10 00 00       	mov    $0x1000,%esi
+  802b9a:	48 89 df             	mov    %rbx,%rdi
+  802b9d:	48 b8 19 11 80 00 00 	movabs $0x801119,%rax
+  802ba4:	00 00 00 
+  802ba7:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802ba9:	83 f8 02             	cmp    $0x2,%eax
+  802bac:	7e 40                	jle    802bee <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  802bae:	48 89 df             	mov    %rbx,%rdi
+  802bb1:	48 b8 d5 25 80 00 00 	movabs $0x8025d5,%rax
+  802bb8:	00 00 00 
+  802bbb:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802bbd:	85 c0                	test   %eax,%eax
+  802bbf:	79 11                	jns    802bd2 <devfile_read+0x87>
+  802bc1:	48 98                	cltq
+}
+  802bc3:	48 83 c4 28          	add    $0x28,%rsp
+  802bc7:	5b                   	pop    %rbx
+  802bc8:	41 5c                	pop    %r12
+  802bca:	41 5d                	pop    %r13
+  802bcc:	41 5e                	pop    %r14
+  802bce:	41 5f                	pop    %r15
+  802bd0:	5d                   	pop    %rbp
+  802bd1:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802bd2:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802bd7:	4c 89 ea             	mov    %r13,%rdx
+  802bda:	4c 89 e6             	mov    %r12,%rsi
+  802bdd:	48 89 df             	mov    %rbx,%rdi
+  802be0:	48 b8 d3 28 80 00 00 	movabs $0x8028d3,%rax
+  802be7:	00 00 00 
+  802bea:	ff d0                	call   *%rax
+  802bec:	eb d5                	jmp    802bc3 <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  802bee:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802bf2:	48 89 df             	mov    %rbx,%rdi
+  802bf5:	48 b8 d5 25 80 00 00 	movabs $0x8025d5,%rax
+  802bfc:	00 00 00 
+  802bff:	ff d0                	call   *%rax
+  802c01:	85 c0                	test   %eax,%eax
+  802c03:	0f 88 33 01 00 00    	js     802d3c <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  802c09:	48 ba 00 23 82 00 00 	movabs $0x822300,%rdx
+  802c10:	00 00 00 
+  802c13:	4c 89 f0             	mov    %r14,%rax
+  802c16:	48 29 d0             	sub    %rdx,%rax
+  802c19:	48 c1 f8 03          	sar    $0x3,%rax
+  802c1d:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  802c24:	aa aa aa 
+  802c27:	48 0f af c2          	imul   %rdx,%rax
+  802c2b:	48 c1 e0 0e          	shl    $0xe,%rax
+  802c2f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  802c33:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802c36:	41 39 06             	cmp    %eax,(%r14)
+  802c39:	75 0d                	jne    802c48 <devfile_read+0xfd>
+  802c3b:	8b 43 10             	mov    0x10(%rbx),%eax
+  802c3e:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  802c42:	0f 84 fb 00 00 00    	je     802d43 <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  802c48:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802c4d:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802c51:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  802c54:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802c58:	48 89 c7             	mov    %rax,%rdi
+  802c5b:	48 b8 5d 46 80 00 00 	movabs $0x80465d,%rax
+  802c62:	00 00 00 
+  802c65:	ff d0                	call   *%rax
+  802c67:	84 c0                	test   %al,%al
+  802c69:	75 27                	jne    802c92 <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802c6b:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802c70:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802c75:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802c79:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c7e:	48 b8 54 11 80 00 00 	movabs $0x801154,%rax
+  802c85:	00 00 00 
+  802c88:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  802c8a:	85 c0                	test   %eax,%eax
+  802c8c:	0f 88 dc 00 00 00    	js     802d6e <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  802c92:	44 89 f8             	mov    %r15d,%eax
+  802c95:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802c9a:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  802c9c:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  802ca3:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  802ca4:	8b 43 10             	mov    0x10(%rbx),%eax
+  802ca7:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  802cab:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  802cae:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802cb3:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802cb7:	48 89 df             	mov    %rbx,%rdi
+  802cba:	48 b8 d3 28 80 00 00 	movabs $0x8028d3,%rax
+  802cc1:	00 00 00 
+  802cc4:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  802cc6:	48 85 c0             	test   %rax,%rax
+  802cc9:	0f 88 f4 fe ff ff    	js     802bc3 <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  802ccf:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802cd2:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  802cd5:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  802cd8:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  802cdc:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  802ce0:	48 63 d1             	movslq %ecx,%rdx
+  802ce3:	48 01 d0             	add    %rdx,%rax
+  802ce6:	4d 63 ff             	movslq %r15d,%r15
+  802ce9:	4c 29 f8             	sub    %r15,%rax
+  802cec:	ba 00 00 00 00       	mov    $0x0,%edx
+  802cf1:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  802cf5:	48 85 c0             	test   %rax,%rax
+  802cf8:	0f 8e c5 fe ff ff    	jle    802bc3 <devfile_read+0x78>
+    n = MIN(n, res);
+  802cfe:	4c 39 e8             	cmp    %r13,%rax
+  802d01:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  802d05:	8b 73 04             	mov    0x4(%rbx),%esi
+  802d08:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  802d0c:	48 63 f6             	movslq %esi,%rsi
+  802d0f:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802d14:	48 01 c6             	add    %rax,%rsi
+  802d17:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802d1b:	48 01 c6             	add    %rax,%rsi
+  802d1e:	4c 89 ea             	mov    %r13,%rdx
+  802d21:	4c 89 e7             	mov    %r12,%rdi
+  802d24:	48 b8 56 0e 80 00 00 	movabs $0x800e56,%rax
+  802d2b:	00 00 00 
+  802d2e:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  802d30:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  802d34:	4c 89 e8             	mov    %r13,%rax
+  802d37:	e9 87 fe ff ff       	jmp    802bc3 <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802d3c:	48 98                	cltq
+  802d3e:	e9 80 fe ff ff       	jmp    802bc3 <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  802d43:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  802d47:	41 39 d7             	cmp    %edx,%r15d
+  802d4a:	0f 8c f8 fe ff ff    	jl     802c48 <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  802d50:	49 8b 46 10          	mov    0x10(%r14),%rax
+  802d54:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  802d57:	41 39 cf             	cmp    %ecx,%r15d
+  802d5a:	0f 8d e8 fe ff ff    	jge    802c48 <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  802d60:	4d 63 ff             	movslq %r15d,%r15
+  802d63:	4c 29 f8             	sub    %r15,%rax
+  802d66:	48 63 d2             	movslq %edx,%rdx
+  802d69:	48 01 d0             	add    %rdx,%rax
+  802d6c:	eb 87                	jmp    802cf5 <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802d6e:	48 98                	cltq
+  802d70:	e9 4e fe ff ff       	jmp    802bc3 <devfile_read+0x78>
+        return E_INVAL;
+  802d75:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802d7a:	c3                   	ret
+
+0000000000802d7b <fs_channel>:
+fs_channel(bool enable) {
+  802d7b:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  802d7d:	a2 04 26 82 00 00 00 	movabs %al,0x822604
+  802d84:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  802d86:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d8b:	40 84 ff             	test   %dil,%dil
+  802d8e:	74 47                	je     802dd7 <fs_channel+0x5c>
+  802d90:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  802d97:	00 00 00 
+  802d9a:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  802da0:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  802da7:	00 00 00 
+  802daa:	3b 08                	cmp    (%rax),%ecx
+  802dac:	74 29                	je     802dd7 <fs_channel+0x5c>
+fs_channel(bool enable) {
+  802dae:	55                   	push   %rbp
+  802daf:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  802db2:	48 b8 fb 1c 80 00 00 	movabs $0x801cfb,%rax
+  802db9:	00 00 00 
+  802dbc:	ff d0                	call   *%rax
+  802dbe:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  802dc0:	85 c0                	test   %eax,%eax
+  802dc2:	78 04                	js     802dc8 <fs_channel+0x4d>
+}
+  802dc4:	89 d0                	mov    %edx,%eax
+  802dc6:	5d                   	pop    %rbp
+  802dc7:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  802dc8:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  802dcf:	00 00 00 
+  802dd2:	c6 00 00             	movb   $0x0,(%rax)
+  802dd5:	eb ed                	jmp    802dc4 <fs_channel+0x49>
+}
+  802dd7:	89 d0                	mov    %edx,%eax
+  802dd9:	c3                   	ret
+
+0000000000802dda <open>:
+open(const char *path, int mode) {
+  802dda:	55                   	push   %rbp
+  802ddb:	48 89 e5             	mov    %rsp,%rbp
+  802dde:	41 55                	push   %r13
+  802de0:	41 54                	push   %r12
+  802de2:	53                   	push   %rbx
+  802de3:	48 83 ec 18          	sub    $0x18,%rsp
+  802de7:	49 89 fc             	mov    %rdi,%r12
+  802dea:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802ded:	48 b8 b7 0b 80 00 00 	movabs $0x800bb7,%rax
+  802df4:	00 00 00 
+  802df7:	ff d0                	call   *%rax
+  802df9:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802dff:	0f 87 8f 00 00 00    	ja     802e94 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802e05:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802e09:	48 b8 b5 15 80 00 00 	movabs $0x8015b5,%rax
+  802e10:	00 00 00 
+  802e13:	ff d0                	call   *%rax
+  802e15:	89 c3                	mov    %eax,%ebx
+  802e17:	85 c0                	test   %eax,%eax
+  802e19:	78 55                	js     802e70 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  802e1b:	4c 89 e6             	mov    %r12,%rsi
+  802e1e:	48 bb 00 00 83 00 00 	movabs $0x830000,%rbx
+  802e25:	00 00 00 
+  802e28:	48 89 df             	mov    %rbx,%rdi
+  802e2b:	48 b8 f5 0b 80 00 00 	movabs $0x800bf5,%rax
+  802e32:	00 00 00 
+  802e35:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802e37:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  802e3e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e43:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802e47:	bf 01 00 00 00       	mov    $0x1,%edi
+  802e4c:	48 b8 6c 23 80 00 00 	movabs $0x80236c,%rax
+  802e53:	00 00 00 
+  802e56:	ff d0                	call   *%rax
+  802e58:	89 c3                	mov    %eax,%ebx
+  802e5a:	85 c0                	test   %eax,%eax
+  802e5c:	78 1f                	js     802e7d <open+0xa3>
+    return fd2num(fd);
+  802e5e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802e62:	48 b8 87 15 80 00 00 	movabs $0x801587,%rax
+  802e69:	00 00 00 
+  802e6c:	ff d0                	call   *%rax
+  802e6e:	89 c3                	mov    %eax,%ebx
+}
+  802e70:	89 d8                	mov    %ebx,%eax
+  802e72:	48 83 c4 18          	add    $0x18,%rsp
+  802e76:	5b                   	pop    %rbx
+  802e77:	41 5c                	pop    %r12
+  802e79:	41 5d                	pop    %r13
+  802e7b:	5d                   	pop    %rbp
+  802e7c:	c3                   	ret
+        fd_close(fd, 0);
+  802e7d:	be 00 00 00 00       	mov    $0x0,%esi
+  802e82:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802e86:	48 b8 d0 16 80 00 00 	movabs $0x8016d0,%rax
+  802e8d:	00 00 00 
+  802e90:	ff d0                	call   *%rax
+        return res;
+  802e92:	eb dc                	jmp    802e70 <open+0x96>
+        return -E_BAD_PATH;
+  802e94:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802e99:	eb d5                	jmp    802e70 <open+0x96>
+
+0000000000802e9b <file_flush_buffers>:
+file_flush_buffers(void) {
+  802e9b:	55                   	push   %rbp
+  802e9c:	48 89 e5             	mov    %rsp,%rbp
+  802e9f:	41 56                	push   %r14
+  802ea1:	41 55                	push   %r13
+  802ea3:	41 54                	push   %r12
+  802ea5:	53                   	push   %rbx
+  802ea6:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  802eaa:	49 bc 08 23 82 00 00 	movabs $0x822308,%r12
+  802eb1:	00 00 00 
+  802eb4:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  802eb9:	49 bd 15 16 80 00 00 	movabs $0x801615,%r13
+  802ec0:	00 00 00 
+  802ec3:	49 be d5 25 80 00 00 	movabs $0x8025d5,%r14
+  802eca:	00 00 00 
+  802ecd:	eb 0c                	jmp    802edb <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  802ecf:	83 c3 01             	add    $0x1,%ebx
+  802ed2:	49 83 c4 18          	add    $0x18,%r12
+  802ed6:	83 fb 20             	cmp    $0x20,%ebx
+  802ed9:	74 1d                	je     802ef8 <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  802edb:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  802ee0:	74 ed                	je     802ecf <file_flush_buffers+0x34>
+  802ee2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802ee6:	89 df                	mov    %ebx,%edi
+  802ee8:	41 ff d5             	call   *%r13
+  802eeb:	85 c0                	test   %eax,%eax
+  802eed:	78 e0                	js     802ecf <file_flush_buffers+0x34>
+  802eef:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802ef3:	41 ff d6             	call   *%r14
+  802ef6:	eb d7                	jmp    802ecf <file_flush_buffers+0x34>
+}
+  802ef8:	48 83 c4 10          	add    $0x10,%rsp
+  802efc:	5b                   	pop    %rbx
+  802efd:	41 5c                	pop    %r12
+  802eff:	41 5d                	pop    %r13
+  802f01:	41 5e                	pop    %r14
+  802f03:	5d                   	pop    %rbp
+  802f04:	c3                   	ret
+
+0000000000802f05 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802f05:	55                   	push   %rbp
+  802f06:	48 89 e5             	mov    %rsp,%rbp
+  802f09:	41 54                	push   %r12
+  802f0b:	53                   	push   %rbx
+  802f0c:	49 89 fc             	mov    %rdi,%r12
+  802f0f:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  802f11:	48 b8 9b 2e 80 00 00 	movabs $0x802e9b,%rax
+  802f18:	00 00 00 
+  802f1b:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802f1d:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  802f24:	00 00 00 
+  802f27:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  802f2c:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802f2e:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  802f31:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f36:	be 00 00 00 00       	mov    $0x0,%esi
+  802f3b:	bf 02 00 00 00       	mov    $0x2,%edi
+  802f40:	48 b8 6c 23 80 00 00 	movabs $0x80236c,%rax
+  802f47:	00 00 00 
+  802f4a:	ff d0                	call   *%rax
+}
+  802f4c:	5b                   	pop    %rbx
+  802f4d:	41 5c                	pop    %r12
+  802f4f:	5d                   	pop    %rbp
+  802f50:	c3                   	ret
+
+0000000000802f51 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802f51:	55                   	push   %rbp
+  802f52:	48 89 e5             	mov    %rsp,%rbp
+  802f55:	41 54                	push   %r12
+  802f57:	53                   	push   %rbx
+  802f58:	49 89 fc             	mov    %rdi,%r12
+  802f5b:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  802f5e:	48 b8 9b 2e 80 00 00 	movabs $0x802e9b,%rax
+  802f65:	00 00 00 
+  802f68:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802f6a:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  802f6f:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  802f76:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  802f78:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f7d:	be 00 00 00 00       	mov    $0x0,%esi
+  802f82:	bf 05 00 00 00       	mov    $0x5,%edi
+  802f87:	48 b8 6c 23 80 00 00 	movabs $0x80236c,%rax
+  802f8e:	00 00 00 
+  802f91:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802f93:	85 c0                	test   %eax,%eax
+  802f95:	78 3d                	js     802fd4 <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802f97:	49 bc 00 00 83 00 00 	movabs $0x830000,%r12
+  802f9e:	00 00 00 
+  802fa1:	4c 89 e6             	mov    %r12,%rsi
+  802fa4:	48 89 df             	mov    %rbx,%rdi
+  802fa7:	48 b8 f5 0b 80 00 00 	movabs $0x800bf5,%rax
+  802fae:	00 00 00 
+  802fb1:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802fb3:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802fba:	00 
+  802fbb:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802fc1:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802fc8:	00 
+  802fc9:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802fcf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802fd4:	5b                   	pop    %rbx
+  802fd5:	41 5c                	pop    %r12
+  802fd7:	5d                   	pop    %rbp
+  802fd8:	c3                   	ret
+
+0000000000802fd9 <remove>:
+remove(const char *path) {
+  802fd9:	55                   	push   %rbp
+  802fda:	48 89 e5             	mov    %rsp,%rbp
+  802fdd:	53                   	push   %rbx
+  802fde:	48 83 ec 08          	sub    $0x8,%rsp
+  802fe2:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  802fe5:	48 b8 b7 0b 80 00 00 	movabs $0x800bb7,%rax
+  802fec:	00 00 00 
+  802fef:	ff d0                	call   *%rax
+  802ff1:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802ff7:	77 3a                	ja     803033 <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  802ff9:	48 89 de             	mov    %rbx,%rsi
+  802ffc:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  803003:	00 00 00 
+  803006:	48 b8 f5 0b 80 00 00 	movabs $0x800bf5,%rax
+  80300d:	00 00 00 
+  803010:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  803012:	ba 00 00 00 00       	mov    $0x0,%edx
+  803017:	be 00 00 00 00       	mov    $0x0,%esi
+  80301c:	bf 07 00 00 00       	mov    $0x7,%edi
+  803021:	48 b8 6c 23 80 00 00 	movabs $0x80236c,%rax
+  803028:	00 00 00 
+  80302b:	ff d0                	call   *%rax
+}
+  80302d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803031:	c9                   	leave
+  803032:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  803033:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803038:	eb f3                	jmp    80302d <remove+0x54>
+
+000000000080303a <sync>:
+sync(void) {
+  80303a:	55                   	push   %rbp
+  80303b:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  80303e:	48 b8 9b 2e 80 00 00 	movabs $0x802e9b,%rax
+  803045:	00 00 00 
+  803048:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  80304a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80304f:	be 00 00 00 00       	mov    $0x0,%esi
+  803054:	bf 08 00 00 00       	mov    $0x8,%edi
+  803059:	48 b8 6c 23 80 00 00 	movabs $0x80236c,%rax
+  803060:	00 00 00 
+  803063:	ff d0                	call   *%rax
+}
+  803065:	5d                   	pop    %rbp
+  803066:	c3                   	ret
+
+0000000000803067 <fsync>:
+fsync(int fdnum) {
+  803067:	55                   	push   %rbp
+  803068:	48 89 e5             	mov    %rsp,%rbp
+  80306b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80306f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803073:	48 b8 15 16 80 00 00 	movabs $0x801615,%rax
+  80307a:	00 00 00 
+  80307d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80307f:	85 c0                	test   %eax,%eax
+  803081:	78 4b                	js     8030ce <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803083:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803087:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  80308e:	00 00 00 
+  803091:	8b 00                	mov    (%rax),%eax
+  803093:	39 02                	cmp    %eax,(%rdx)
+  803095:	75 39                	jne    8030d0 <fsync+0x69>
+    file_flush_buffers();
+  803097:	48 b8 9b 2e 80 00 00 	movabs $0x802e9b,%rax
+  80309e:	00 00 00 
+  8030a1:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  8030a3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8030a7:	8b 40 0c             	mov    0xc(%rax),%eax
+  8030aa:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  8030b1:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  8030b3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8030bd:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8030c2:	48 b8 6c 23 80 00 00 	movabs $0x80236c,%rax
+  8030c9:	00 00 00 
+  8030cc:	ff d0                	call   *%rax
+}
+  8030ce:	c9                   	leave
+  8030cf:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8030d0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8030d5:	eb f7                	jmp    8030ce <fsync+0x67>
+
+00000000008030d7 <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  8030d7:	55                   	push   %rbp
+  8030d8:	48 89 e5             	mov    %rsp,%rbp
+  8030db:	53                   	push   %rbx
+  8030dc:	48 83 ec 08          	sub    $0x8,%rsp
+  8030e0:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  8030e3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8030ed:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8030f2:	48 b8 6c 23 80 00 00 	movabs $0x80236c,%rax
+  8030f9:	00 00 00 
+  8030fc:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8030fe:	85 c0                	test   %eax,%eax
+  803100:	78 2d                	js     80312f <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  803102:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803109:	00 00 00 
+  80310c:	48 8b 10             	mov    (%rax),%rdx
+  80310f:	48 89 13             	mov    %rdx,(%rbx)
+  803112:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  803116:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  80311a:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80311e:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  803122:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803126:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  80312a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80312f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803133:	c9                   	leave
+  803134:	c3                   	ret
+
+0000000000803135 <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  803135:	55                   	push   %rbp
+  803136:	48 89 e5             	mov    %rsp,%rbp
+  803139:	53                   	push   %rbx
+  80313a:	48 83 ec 08          	sub    $0x8,%rsp
+  80313e:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  803141:	ba 00 00 00 00       	mov    $0x0,%edx
+  803146:	be 00 00 00 00       	mov    $0x0,%esi
+  80314b:	bf 0c 00 00 00       	mov    $0xc,%edi
+  803150:	48 b8 6c 23 80 00 00 	movabs $0x80236c,%rax
+  803157:	00 00 00 
+  80315a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80315c:	85 c0                	test   %eax,%eax
+  80315e:	78 3d                	js     80319d <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  803160:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803167:	00 00 00 
+  80316a:	48 8b 10             	mov    (%rax),%rdx
+  80316d:	48 89 13             	mov    %rdx,(%rbx)
+  803170:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  803174:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  803178:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80317c:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  803180:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  803184:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  803188:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  80318c:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  803190:	48 8b 40 28          	mov    0x28(%rax),%rax
+  803194:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  803198:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80319d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8031a1:	c9                   	leave
+  8031a2:	c3                   	ret
+
+00000000008031a3 <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  8031a3:	55                   	push   %rbp
+  8031a4:	48 89 e5             	mov    %rsp,%rbp
+  8031a7:	41 57                	push   %r15
+  8031a9:	41 56                	push   %r14
+  8031ab:	41 55                	push   %r13
+  8031ad:	41 54                	push   %r12
+  8031af:	53                   	push   %rbx
+  8031b0:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  8031b4:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  8031bb:	00 
+  8031bc:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  8031c3:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8031c9:	0f 85 43 01 00 00    	jne    803312 <munmap+0x16f>
+  8031cf:	49 89 ff             	mov    %rdi,%r15
+  8031d2:	4c 39 f7             	cmp    %r14,%rdi
+  8031d5:	0f 87 37 01 00 00    	ja     803312 <munmap+0x16f>
+  8031db:	48 bb 00 20 82 00 00 	movabs $0x822000,%rbx
+  8031e2:	00 00 00 
+  8031e5:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  8031eb:	eb 2c                	jmp    803219 <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  8031ed:	4c 39 f8             	cmp    %r15,%rax
+  8031f0:	0f 83 85 00 00 00    	jae    80327b <munmap+0xd8>
+            m->mm_end = start;
+  8031f6:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8031fb:	48 83 c3 18          	add    $0x18,%rbx
+  8031ff:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  803206:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  80320d:	00 00 00 
+  803210:	48 39 c3             	cmp    %rax,%rbx
+  803213:	0f 84 d0 00 00 00    	je     8032e9 <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  803219:	49 89 dc             	mov    %rbx,%r12
+  80321c:	48 8b 03             	mov    (%rbx),%rax
+  80321f:	4c 39 f0             	cmp    %r14,%rax
+  803222:	73 d7                	jae    8031fb <munmap+0x58>
+  803224:	48 85 c0             	test   %rax,%rax
+  803227:	74 d2                	je     8031fb <munmap+0x58>
+  803229:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  80322d:	49 39 d7             	cmp    %rdx,%r15
+  803230:	73 c9                	jae    8031fb <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  803232:	49 39 d6             	cmp    %rdx,%r14
+  803235:	73 b6                	jae    8031ed <munmap+0x4a>
+  803237:	49 39 c7             	cmp    %rax,%r15
+  80323a:	76 b1                	jbe    8031ed <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  80323c:	4c 89 ef             	mov    %r13,%rdi
+  80323f:	48 b8 da 22 80 00 00 	movabs $0x8022da,%rax
+  803246:	00 00 00 
+  803249:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  80324b:	48 85 c0             	test   %rax,%rax
+  80324e:	0f 84 c5 00 00 00    	je     803319 <munmap+0x176>
+            *tail = *m;
+  803254:	48 8b 13             	mov    (%rbx),%rdx
+  803257:	48 89 10             	mov    %rdx,(%rax)
+  80325a:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  80325e:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  803262:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  803266:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  80326a:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  80326d:	44 89 f2             	mov    %r14d,%edx
+  803270:	2b 13                	sub    (%rbx),%edx
+  803272:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  803275:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  803279:	eb 80                	jmp    8031fb <munmap+0x58>
+        } else if (m->mm_end > end) {
+  80327b:	49 39 d6             	cmp    %rdx,%r14
+  80327e:	73 18                	jae    803298 <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  803280:	44 89 f2             	mov    %r14d,%edx
+  803283:	41 03 54 24 10       	add    0x10(%r12),%edx
+  803288:	29 c2                	sub    %eax,%edx
+  80328a:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  80328f:	4d 89 34 24          	mov    %r14,(%r12)
+  803293:	e9 63 ff ff ff       	jmp    8031fb <munmap+0x58>
+    m->mm_start = 0;
+  803298:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  80329f:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  8032a0:	4c 89 e6             	mov    %r12,%rsi
+  8032a3:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8032aa:	00 00 00 
+  8032ad:	48 29 c6             	sub    %rax,%rsi
+  8032b0:	48 c1 fe 03          	sar    $0x3,%rsi
+  8032b4:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8032bb:	aa aa aa 
+  8032be:	48 0f af f0          	imul   %rax,%rsi
+  8032c2:	48 c1 e6 0c          	shl    $0xc,%rsi
+  8032c6:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  8032cb:	48 01 c6             	add    %rax,%rsi
+  8032ce:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8032d3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032d8:	48 b8 fa 11 80 00 00 	movabs $0x8011fa,%rax
+  8032df:	00 00 00 
+  8032e2:	ff d0                	call   *%rax
+}
+  8032e4:	e9 12 ff ff ff       	jmp    8031fb <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  8032e9:	4c 89 f2             	mov    %r14,%rdx
+  8032ec:	4c 29 fa             	sub    %r15,%rdx
+  8032ef:	4c 89 fe             	mov    %r15,%rsi
+  8032f2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032f7:	48 b8 fa 11 80 00 00 	movabs $0x8011fa,%rax
+  8032fe:	00 00 00 
+  803301:	ff d0                	call   *%rax
+}
+  803303:	48 83 c4 08          	add    $0x8,%rsp
+  803307:	5b                   	pop    %rbx
+  803308:	41 5c                	pop    %r12
+  80330a:	41 5d                	pop    %r13
+  80330c:	41 5e                	pop    %r14
+  80330e:	41 5f                	pop    %r15
+  803310:	5d                   	pop    %rbp
+  803311:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  803312:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803317:	eb ea                	jmp    803303 <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  803319:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  80331e:	eb e3                	jmp    803303 <munmap+0x160>
+
+0000000000803320 <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  803320:	55                   	push   %rbp
+  803321:	48 89 e5             	mov    %rsp,%rbp
+  803324:	41 57                	push   %r15
+  803326:	41 56                	push   %r14
+  803328:	41 55                	push   %r13
+  80332a:	41 54                	push   %r12
+  80332c:	53                   	push   %rbx
+  80332d:	48 83 ec 28          	sub    $0x28,%rsp
+  803331:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  803335:	49 89 f5             	mov    %rsi,%r13
+  803338:	41 89 d6             	mov    %edx,%r14d
+  80333b:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  80333e:	41 89 cc             	mov    %ecx,%r12d
+  803341:	44 89 c7             	mov    %r8d,%edi
+  803344:	44 89 cb             	mov    %r9d,%ebx
+  803347:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80334b:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80334f:	48 b8 15 16 80 00 00 	movabs $0x801615,%rax
+  803356:	00 00 00 
+  803359:	ff d0                	call   *%rax
+  80335b:	41 89 c7             	mov    %eax,%r15d
+  80335e:	85 c0                	test   %eax,%eax
+  803360:	0f 88 ae 01 00 00    	js     803514 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803366:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80336a:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  803371:	00 00 00 
+  803374:	8b 32                	mov    (%rdx),%esi
+  803376:	39 30                	cmp    %esi,(%rax)
+  803378:	0f 85 7a 02 00 00    	jne    8035f8 <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  80337e:	8b 40 08             	mov    0x8(%rax),%eax
+  803381:	83 e0 03             	and    $0x3,%eax
+  803384:	83 f8 01             	cmp    $0x1,%eax
+  803387:	0f 84 76 02 00 00    	je     803603 <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  80338d:	4d 85 ed             	test   %r13,%r13
+  803390:	0f 84 78 02 00 00    	je     80360e <mmap+0x2ee>
+  803396:	85 db                	test   %ebx,%ebx
+  803398:	0f 88 70 02 00 00    	js     80360e <mmap+0x2ee>
+  80339e:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  8033a4:	41 89 df             	mov    %ebx,%r15d
+  8033a7:	0f 85 6c 02 00 00    	jne    803619 <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  8033ad:	44 89 f0             	mov    %r14d,%eax
+  8033b0:	83 e0 fd             	and    $0xfffffffd,%eax
+  8033b3:	83 f8 04             	cmp    $0x4,%eax
+  8033b6:	0f 85 68 02 00 00    	jne    803624 <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  8033bc:	44 89 e1             	mov    %r12d,%ecx
+  8033bf:	83 e1 01             	and    $0x1,%ecx
+  8033c2:	0f 95 c2             	setne  %dl
+  8033c5:	44 89 e0             	mov    %r12d,%eax
+  8033c8:	d1 e8                	shr    %eax
+  8033ca:	83 f0 01             	xor    $0x1,%eax
+  8033cd:	83 e0 01             	and    $0x1,%eax
+  8033d0:	38 c2                	cmp    %al,%dl
+  8033d2:	0f 85 57 02 00 00    	jne    80362f <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  8033d8:	85 c9                	test   %ecx,%ecx
+  8033da:	74 0a                	je     8033e6 <mmap+0xc6>
+  8033dc:	41 f6 c6 02          	test   $0x2,%r14b
+  8033e0:	0f 85 54 02 00 00    	jne    80363a <mmap+0x31a>
+    file_flush_buffers();
+  8033e6:	48 b8 9b 2e 80 00 00 	movabs $0x802e9b,%rax
+  8033ed:	00 00 00 
+  8033f0:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  8033f2:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  8033f9:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  803400:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803404:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  803407:	41 f6 c4 04          	test   $0x4,%r12b
+  80340b:	0f 84 15 01 00 00    	je     803526 <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  803411:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  803414:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  80341a:	0f 85 25 02 00 00    	jne    803645 <mmap+0x325>
+  803420:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  803424:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  80342b:	00 00 00 
+  80342e:	48 39 c2             	cmp    %rax,%rdx
+  803431:	0f 82 19 02 00 00    	jb     803650 <mmap+0x330>
+  803437:	48 39 c7             	cmp    %rax,%rdi
+  80343a:	0f 87 10 02 00 00    	ja     803650 <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  803440:	4c 89 ee             	mov    %r13,%rsi
+  803443:	48 b8 a3 31 80 00 00 	movabs $0x8031a3,%rax
+  80344a:	00 00 00 
+  80344d:	ff d0                	call   *%rax
+  80344f:	85 c0                	test   %eax,%eax
+  803451:	0f 88 04 02 00 00    	js     80365b <mmap+0x33b>
+    if (!handler) {
+  803457:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  80345e:	00 00 00 
+  803461:	80 38 00             	cmpb   $0x0,(%rax)
+  803464:	75 2b                	jne    803491 <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  803466:	48 bf 3b 22 80 00 00 	movabs $0x80223b,%rdi
+  80346d:	00 00 00 
+  803470:	48 b8 45 4e 80 00 00 	movabs $0x804e45,%rax
+  803477:	00 00 00 
+  80347a:	ff d0                	call   *%rax
+  80347c:	85 c0                	test   %eax,%eax
+  80347e:	0f 88 ea 01 00 00    	js     80366e <mmap+0x34e>
+        handler = 1;
+  803484:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  80348b:	00 00 00 
+  80348e:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  803491:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803495:	48 b8 da 22 80 00 00 	movabs $0x8022da,%rax
+  80349c:	00 00 00 
+  80349f:	ff d0                	call   *%rax
+  8034a1:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  8034a4:	48 85 c0             	test   %rax,%rax
+  8034a7:	0f 84 c9 01 00 00    	je     803676 <mmap+0x356>
+    m->mm_start = va;
+  8034ad:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  8034b0:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  8034b4:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  8034b8:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  8034bb:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  8034bf:	44 89 e0             	mov    %r12d,%eax
+  8034c2:	c1 e0 06             	shl    $0x6,%eax
+  8034c5:	25 80 00 00 00       	and    $0x80,%eax
+  8034ca:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  8034cd:	09 f0                	or     %esi,%eax
+  8034cf:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  8034d3:	41 f6 c4 08          	test   $0x8,%r12b
+  8034d7:	74 31                	je     80350a <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  8034d9:	48 39 d3             	cmp    %rdx,%rbx
+  8034dc:	73 2c                	jae    80350a <mmap+0x1ea>
+  8034de:	ba 00 00 04 00       	mov    $0x40000,%edx
+  8034e3:	48 89 de             	mov    %rbx,%rsi
+  8034e6:	4c 89 f7             	mov    %r14,%rdi
+  8034e9:	48 b8 2a 21 80 00 00 	movabs $0x80212a,%rax
+  8034f0:	00 00 00 
+  8034f3:	ff d0                	call   *%rax
+  8034f5:	49 89 c4             	mov    %rax,%r12
+  8034f8:	48 85 c0             	test   %rax,%rax
+  8034fb:	0f 8e d7 00 00 00    	jle    8035d8 <mmap+0x2b8>
+            va += n;
+  803501:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  803504:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  803508:	72 d4                	jb     8034de <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  80350a:	49 8b 06             	mov    (%r14),%rax
+  80350d:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  803511:	48 89 06             	mov    %rax,(%rsi)
+}
+  803514:	44 89 f8             	mov    %r15d,%eax
+  803517:	48 83 c4 28          	add    $0x28,%rsp
+  80351b:	5b                   	pop    %rbx
+  80351c:	41 5c                	pop    %r12
+  80351e:	41 5d                	pop    %r13
+  803520:	41 5e                	pop    %r14
+  803522:	41 5f                	pop    %r15
+  803524:	5d                   	pop    %rbp
+  803525:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803526:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  80352d:	00 00 00 
+  803530:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  803533:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  80353a:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80353d:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  803542:	48 be 00 20 82 00 00 	movabs $0x822000,%rsi
+  803549:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80354c:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  803553:	00 00 00 
+  803556:	48 39 d7             	cmp    %rdx,%rdi
+  803559:	73 1c                	jae    803577 <mmap+0x257>
+        return -E_NO_MEM;
+  80355b:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803561:	eb b1                	jmp    803514 <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803563:	48 83 c0 01          	add    $0x1,%rax
+  803567:	48 83 f8 1f          	cmp    $0x1f,%rax
+  80356b:	77 3f                	ja     8035ac <mmap+0x28c>
+  80356d:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  803572:	48 39 d7             	cmp    %rdx,%rdi
+  803575:	72 2a                	jb     8035a1 <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  803577:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  80357b:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  80357f:	48 39 d1             	cmp    %rdx,%rcx
+  803582:	73 df                	jae    803563 <mmap+0x243>
+  803584:	48 85 c9             	test   %rcx,%rcx
+  803587:	74 da                	je     803563 <mmap+0x243>
+  803589:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  80358d:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  803592:	48 39 d3             	cmp    %rdx,%rbx
+  803595:	73 cc                	jae    803563 <mmap+0x243>
+            va = mmaps[i].mm_end;
+  803597:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80359a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80359f:	eb cc                	jmp    80356d <mmap+0x24d>
+        return -E_NO_MEM;
+  8035a1:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8035a7:	e9 68 ff ff ff       	jmp    803514 <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  8035ac:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  8035b1:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  8035b8:	00 00 00 
+  8035bb:	48 39 c2             	cmp    %rax,%rdx
+  8035be:	0f 82 9f 00 00 00    	jb     803663 <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  8035c4:	48 85 db             	test   %rbx,%rbx
+  8035c7:	0f 85 8a fe ff ff    	jne    803457 <mmap+0x137>
+        return -E_NO_MEM;
+  8035cd:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8035d3:	e9 3c ff ff ff       	jmp    803514 <mmap+0x1f4>
+        if (n < 0) {
+  8035d8:	0f 89 2c ff ff ff    	jns    80350a <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  8035de:	49 8b 3e             	mov    (%r14),%rdi
+  8035e1:	4c 89 ee             	mov    %r13,%rsi
+  8035e4:	48 b8 a3 31 80 00 00 	movabs $0x8031a3,%rax
+  8035eb:	00 00 00 
+  8035ee:	ff d0                	call   *%rax
+            return n;
+  8035f0:	45 89 e7             	mov    %r12d,%r15d
+  8035f3:	e9 1c ff ff ff       	jmp    803514 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8035f8:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8035fe:	e9 11 ff ff ff       	jmp    803514 <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  803603:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803609:	e9 06 ff ff ff       	jmp    803514 <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  80360e:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803614:	e9 fb fe ff ff       	jmp    803514 <mmap+0x1f4>
+  803619:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80361f:	e9 f0 fe ff ff       	jmp    803514 <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  803624:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80362a:	e9 e5 fe ff ff       	jmp    803514 <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  80362f:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803635:	e9 da fe ff ff       	jmp    803514 <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  80363a:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  803640:	e9 cf fe ff ff       	jmp    803514 <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  803645:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80364b:	e9 c4 fe ff ff       	jmp    803514 <mmap+0x1f4>
+  803650:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803656:	e9 b9 fe ff ff       	jmp    803514 <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  80365b:	41 89 c7             	mov    %eax,%r15d
+  80365e:	e9 b1 fe ff ff       	jmp    803514 <mmap+0x1f4>
+        return -E_NO_MEM;
+  803663:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803669:	e9 a6 fe ff ff       	jmp    803514 <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  80366e:	41 89 c7             	mov    %eax,%r15d
+  803671:	e9 9e fe ff ff       	jmp    803514 <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  803676:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80367c:	e9 93 fe ff ff       	jmp    803514 <mmap+0x1f4>
+
+0000000000803681 <copy_shared_region>:
+    scring_unmap_region(0, UTEMP, USER_STACK_SIZE);
+    return 0;
+}
+
+static int
+copy_shared_region(void *start, void *end, void *arg) {
+  803681:	55                   	push   %rbp
+  803682:	48 89 e5             	mov    %rsp,%rbp
+  803685:	41 55                	push   %r13
+  803687:	41 54                	push   %r12
+  803689:	53                   	push   %rbx
+  80368a:	48 83 ec 08          	sub    $0x8,%rsp
+  80368e:	48 89 fb             	mov    %rdi,%rbx
+  803691:	49 89 f4             	mov    %rsi,%r12
+    envid_t child = *(envid_t *)arg;
+  803694:	44 8b 2a             	mov    (%rdx),%r13d
+    scring_map_region(0, start, child, start, end - start, get_prot(start));
+  803697:	48 b8 fe 45 80 00 00 	movabs $0x8045fe,%rax
+  80369e:	00 00 00 
+  8036a1:	ff d0                	call   *%rax
+  8036a3:	41 89 c1             	mov    %eax,%r9d
+  8036a6:	4d 89 e0             	mov    %r12,%r8
+  8036a9:	49 29 d8             	sub    %rbx,%r8
+  8036ac:	48 89 d9             	mov    %rbx,%rcx
+  8036af:	44 89 ea             	mov    %r13d,%edx
+  8036b2:	48 89 de             	mov    %rbx,%rsi
+  8036b5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036ba:	48 b8 73 49 80 00 00 	movabs $0x804973,%rax
+  8036c1:	00 00 00 
+  8036c4:	ff d0                	call   *%rax
+    return 0;
+}
+  8036c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036cb:	48 83 c4 08          	add    $0x8,%rsp
+  8036cf:	5b                   	pop    %rbx
+  8036d0:	41 5c                	pop    %r12
+  8036d2:	41 5d                	pop    %r13
+  8036d4:	5d                   	pop    %rbp
+  8036d5:	c3                   	ret
+
+00000000008036d6 <spawn>:
+spawn(const char *prog, const char **argv) {
+  8036d6:	55                   	push   %rbp
+  8036d7:	48 89 e5             	mov    %rsp,%rbp
+  8036da:	41 57                	push   %r15
+  8036dc:	41 56                	push   %r14
+  8036de:	41 55                	push   %r13
+  8036e0:	41 54                	push   %r12
+  8036e2:	53                   	push   %rbx
+  8036e3:	48 81 ec 08 03 00 00 	sub    $0x308,%rsp
+  8036ea:	48 89 fb             	mov    %rdi,%rbx
+  8036ed:	49 89 f4             	mov    %rsi,%r12
+    file_flush_buffers();
+  8036f0:	48 b8 9b 2e 80 00 00 	movabs $0x802e9b,%rax
+  8036f7:	00 00 00 
+  8036fa:	ff d0                	call   *%rax
+    int fd = open(prog, O_RDONLY);
+  8036fc:	be 00 00 00 00       	mov    $0x0,%esi
+  803701:	48 89 df             	mov    %rbx,%rdi
+  803704:	48 b8 da 2d 80 00 00 	movabs $0x802dda,%rax
+  80370b:	00 00 00 
+  80370e:	ff d0                	call   *%rax
+  803710:	89 85 e4 fc ff ff    	mov    %eax,-0x31c(%rbp)
+    if (fd < 0) return fd;
+  803716:	85 c0                	test   %eax,%eax
+  803718:	0f 88 06 04 00 00    	js     803b24 <spawn+0x44e>
+  80371e:	89 c7                	mov    %eax,%edi
+    res = readn(fd, elf_buf, sizeof(elf_buf));
+  803720:	ba 00 02 00 00       	mov    $0x200,%edx
+  803725:	48 8d b5 d0 fd ff ff 	lea    -0x230(%rbp),%rsi
+  80372c:	48 b8 b6 19 80 00 00 	movabs $0x8019b6,%rax
+  803733:	00 00 00 
+  803736:	ff d0                	call   *%rax
+  803738:	89 c6                	mov    %eax,%esi
+    if (res != sizeof(elf_buf)) {
+  80373a:	3d 00 02 00 00       	cmp    $0x200,%eax
+  80373f:	0f 85 93 02 00 00    	jne    8039d8 <spawn+0x302>
+        elf->e_elf[1] != 1 /* little endian */ ||
+  803745:	48 b8 ff ff ff ff ff 	movabs $0xffffffffffffff,%rax
+  80374c:	ff ff 00 
+  80374f:	48 23 85 d0 fd ff ff 	and    -0x230(%rbp),%rax
+    if (elf->e_magic != ELF_MAGIC ||
+  803756:	48 ba 7f 45 4c 46 02 	movabs $0x10102464c457f,%rdx
+  80375d:	01 01 00 
+  803760:	48 39 d0             	cmp    %rdx,%rax
+  803763:	0f 85 ab 02 00 00    	jne    803a14 <spawn+0x33e>
+        elf->e_type != ET_EXEC /* executable */ ||
+  803769:	81 bd e0 fd ff ff 02 	cmpl   $0x3e0002,-0x220(%rbp)
+  803770:	00 3e 00 
+  803773:	0f 85 9b 02 00 00    	jne    803a14 <spawn+0x33e>
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("syscall"
+  803779:	b8 08 00 00 00       	mov    $0x8,%eax
+  80377e:	0f 05                	syscall
+  803780:	41 89 c6             	mov    %eax,%r14d
+  803783:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+    if ((int)(res = sys_exofork()) < 0) goto error2;
+  803789:	85 c0                	test   %eax,%eax
+  80378b:	0f 88 75 03 00 00    	js     803b06 <spawn+0x430>
+    envid_t child = res;
+  803791:	89 85 cc fd ff ff    	mov    %eax,-0x234(%rbp)
+    struct Trapframe child_tf = envs[ENVX(child)].env_tf;
+  803797:	89 c2                	mov    %eax,%edx
+  803799:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  80379f:	48 89 d0             	mov    %rdx,%rax
+  8037a2:	48 c1 e0 04          	shl    $0x4,%rax
+  8037a6:	48 29 d0             	sub    %rdx,%rax
+  8037a9:	48 c1 e0 05          	shl    $0x5,%rax
+  8037ad:	48 be 00 00 c0 1f 80 	movabs $0x801fc00000,%rsi
+  8037b4:	00 00 00 
+  8037b7:	48 01 c6             	add    %rax,%rsi
+  8037ba:	48 8b 06             	mov    (%rsi),%rax
+  8037bd:	48 89 85 0c fd ff ff 	mov    %rax,-0x2f4(%rbp)
+  8037c4:	48 8b 86 b8 00 00 00 	mov    0xb8(%rsi),%rax
+  8037cb:	48 89 85 c4 fd ff ff 	mov    %rax,-0x23c(%rbp)
+  8037d2:	48 8d bd 10 fd ff ff 	lea    -0x2f0(%rbp),%rdi
+  8037d9:	48 c7 c1 fc ff ff ff 	mov    $0xfffffffffffffffc,%rcx
+  8037e0:	48 29 ce             	sub    %rcx,%rsi
+  8037e3:	81 c1 c0 00 00 00    	add    $0xc0,%ecx
+  8037e9:	c1 e9 03             	shr    $0x3,%ecx
+  8037ec:	89 c9                	mov    %ecx,%ecx
+  8037ee:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    child_tf.tf_rip = elf->e_entry;
+  8037f1:	48 8b 85 e8 fd ff ff 	mov    -0x218(%rbp),%rax
+  8037f8:	48 89 85 a4 fd ff ff 	mov    %rax,-0x25c(%rbp)
+    for (argc = 0; argv[argc] != 0; argc++)
+  8037ff:	49 8b 3c 24          	mov    (%r12),%rdi
+  803803:	48 85 ff             	test   %rdi,%rdi
+  803806:	0f 84 d6 05 00 00    	je     803de2 <spawn+0x70c>
+  80380c:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    string_size = 0;
+  803812:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        string_size += strlen(argv[argc]) + 1;
+  803818:	48 bb b7 0b 80 00 00 	movabs $0x800bb7,%rbx
+  80381f:	00 00 00 
+  803822:	ff d3                	call   *%rbx
+  803824:	4c 01 f8             	add    %r15,%rax
+  803827:	4c 8d 78 01          	lea    0x1(%rax),%r15
+    for (argc = 0; argv[argc] != 0; argc++)
+  80382b:	4c 89 ea             	mov    %r13,%rdx
+  80382e:	49 83 c5 01          	add    $0x1,%r13
+  803832:	4b 8b 7c ec f8       	mov    -0x8(%r12,%r13,8),%rdi
+  803837:	48 85 ff             	test   %rdi,%rdi
+  80383a:	75 e6                	jne    803822 <spawn+0x14c>
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  80383c:	49 89 d5             	mov    %rdx,%r13
+  80383f:	48 89 95 f8 fc ff ff 	mov    %rdx,-0x308(%rbp)
+  803846:	48 f7 d0             	not    %rax
+  803849:	48 8d 98 00 00 41 00 	lea    0x410000(%rax),%rbx
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  803850:	49 89 df             	mov    %rbx,%r15
+  803853:	49 83 e7 f8          	and    $0xfffffffffffffff8,%r15
+  803857:	4c 89 bd e8 fc ff ff 	mov    %r15,-0x318(%rbp)
+  80385e:	89 d0                	mov    %edx,%eax
+  803860:	83 c0 01             	add    $0x1,%eax
+  803863:	48 98                	cltq
+  803865:	48 c1 e0 03          	shl    $0x3,%rax
+  803869:	49 29 c7             	sub    %rax,%r15
+  80386c:	4c 89 bd f0 fc ff ff 	mov    %r15,-0x310(%rbp)
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  803873:	49 8d 47 f0          	lea    -0x10(%r15),%rax
+  803877:	48 3d ff ff 3f 00    	cmp    $0x3fffff,%rax
+  80387d:	0f 86 4f 05 00 00    	jbe    803dd2 <spawn+0x6fc>
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  803883:	b9 06 00 00 00       	mov    $0x6,%ecx
+  803888:	ba 00 00 01 00       	mov    $0x10000,%edx
+  80388d:	be 00 00 40 00       	mov    $0x400000,%esi
+  803892:	48 b8 54 11 80 00 00 	movabs $0x801154,%rax
+  803899:	00 00 00 
+  80389c:	ff d0                	call   *%rax
+  80389e:	85 c0                	test   %eax,%eax
+  8038a0:	0f 88 31 05 00 00    	js     803dd7 <spawn+0x701>
+    for (i = 0; i < argc; i++) {
+  8038a6:	4c 89 e8             	mov    %r13,%rax
+  8038a9:	45 85 ed             	test   %r13d,%r13d
+  8038ac:	7e 65                	jle    803913 <spawn+0x23d>
+  8038ae:	4d 89 fd             	mov    %r15,%r13
+  8038b1:	48 98                	cltq
+  8038b3:	49 8d 04 c7          	lea    (%r15,%rax,8),%rax
+        argv_store[i] = UTEMP2USTACK(string_store);
+  8038b7:	49 bf 00 70 fe ff 7f 	movabs $0x7ffffe7000,%r15
+  8038be:	00 00 00 
+        string_store += strlen(argv[i]) + 1;
+  8038c1:	44 89 b5 e0 fc ff ff 	mov    %r14d,-0x320(%rbp)
+  8038c8:	49 89 c6             	mov    %rax,%r14
+        argv_store[i] = UTEMP2USTACK(string_store);
+  8038cb:	4a 8d 84 3b 00 00 c0 	lea    -0x400000(%rbx,%r15,1),%rax
+  8038d2:	ff 
+  8038d3:	49 89 45 00          	mov    %rax,0x0(%r13)
+        strcpy(string_store, argv[i]);
+  8038d7:	49 8b 34 24          	mov    (%r12),%rsi
+  8038db:	48 89 df             	mov    %rbx,%rdi
+  8038de:	48 b8 f5 0b 80 00 00 	movabs $0x800bf5,%rax
+  8038e5:	00 00 00 
+  8038e8:	ff d0                	call   *%rax
+        string_store += strlen(argv[i]) + 1;
+  8038ea:	49 8b 3c 24          	mov    (%r12),%rdi
+  8038ee:	48 b8 b7 0b 80 00 00 	movabs $0x800bb7,%rax
+  8038f5:	00 00 00 
+  8038f8:	ff d0                	call   *%rax
+  8038fa:	48 8d 5c 03 01       	lea    0x1(%rbx,%rax,1),%rbx
+    for (i = 0; i < argc; i++) {
+  8038ff:	49 83 c5 08          	add    $0x8,%r13
+  803903:	49 83 c4 08          	add    $0x8,%r12
+  803907:	4d 39 ee             	cmp    %r13,%r14
+  80390a:	75 bf                	jne    8038cb <spawn+0x1f5>
+  80390c:	44 8b b5 e0 fc ff ff 	mov    -0x320(%rbp),%r14d
+    argv_store[argc] = 0;
+  803913:	48 8b 85 e8 fc ff ff 	mov    -0x318(%rbp),%rax
+  80391a:	48 c7 40 f8 00 00 00 	movq   $0x0,-0x8(%rax)
+  803921:	00 
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  803922:	48 81 fb 00 00 41 00 	cmp    $0x410000,%rbx
+  803929:	0f 85 2c 01 00 00    	jne    803a5b <spawn+0x385>
+    argv_store[-1] = UTEMP2USTACK(argv_store);
+  80392f:	48 b9 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rcx
+  803936:	00 00 00 
+  803939:	48 8b 9d f0 fc ff ff 	mov    -0x310(%rbp),%rbx
+  803940:	48 8d 84 0b 00 00 c0 	lea    -0x400000(%rbx,%rcx,1),%rax
+  803947:	ff 
+  803948:	48 89 43 f8          	mov    %rax,-0x8(%rbx)
+    argv_store[-2] = argc;
+  80394c:	48 8b 85 f8 fc ff ff 	mov    -0x308(%rbp),%rax
+  803953:	48 89 43 f0          	mov    %rax,-0x10(%rbx)
+    tf->tf_rsp = UTEMP2USTACK(&argv_store[-2]);
+  803957:	48 b8 f0 6f fe ff 7f 	movabs $0x7ffffe6ff0,%rax
+  80395e:	00 00 00 
+  803961:	48 8d 84 03 00 00 c0 	lea    -0x400000(%rbx,%rax,1),%rax
+  803968:	ff 
+  803969:	48 89 85 bc fd ff ff 	mov    %rax,-0x244(%rbp)
+    scring_map_region(0, UTEMP, child, (void *)(USER_STACK_TOP - USER_STACK_SIZE),
+  803970:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  803976:	41 b8 00 00 01 00    	mov    $0x10000,%r8d
+  80397c:	44 89 f2             	mov    %r14d,%edx
+  80397f:	be 00 00 40 00       	mov    $0x400000,%esi
+  803984:	bf 00 00 00 00       	mov    $0x0,%edi
+  803989:	48 b8 73 49 80 00 00 	movabs $0x804973,%rax
+  803990:	00 00 00 
+  803993:	ff d0                	call   *%rax
+    scring_unmap_region(0, UTEMP, USER_STACK_SIZE);
+  803995:	ba 00 00 01 00       	mov    $0x10000,%edx
+  80399a:	be 00 00 40 00       	mov    $0x400000,%esi
+  80399f:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039a4:	48 b8 ac 49 80 00 00 	movabs $0x8049ac,%rax
+  8039ab:	00 00 00 
+  8039ae:	ff d0                	call   *%rax
+    struct Proghdr *ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+  8039b0:	48 8b 85 f0 fd ff ff 	mov    -0x210(%rbp),%rax
+  8039b7:	4c 8d ac 05 d0 fd ff 	lea    -0x230(%rbp,%rax,1),%r13
+  8039be:	ff 
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  8039bf:	66 83 bd 08 fe ff ff 	cmpw   $0x0,-0x1f8(%rbp)
+  8039c6:	00 
+  8039c7:	0f 84 5d 03 00 00    	je     803d2a <spawn+0x654>
+  8039cd:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  8039d3:	e9 1b 02 00 00       	jmp    803bf3 <spawn+0x51d>
+        cprintf("Wrong ELF header size or read error: %i\n", res);
+  8039d8:	48 bf 00 59 80 00 00 	movabs $0x805900,%rdi
+  8039df:	00 00 00 
+  8039e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039e7:	48 ba d0 02 80 00 00 	movabs $0x8002d0,%rdx
+  8039ee:	00 00 00 
+  8039f1:	ff d2                	call   *%rdx
+        close(fd);
+  8039f3:	8b bd e4 fc ff ff    	mov    -0x31c(%rbp),%edi
+  8039f9:	48 b8 7a 17 80 00 00 	movabs $0x80177a,%rax
+  803a00:	00 00 00 
+  803a03:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  803a05:	c7 85 e4 fc ff ff ee 	movl   $0xffffffee,-0x31c(%rbp)
+  803a0c:	ff ff ff 
+  803a0f:	e9 10 01 00 00       	jmp    803b24 <spawn+0x44e>
+        cprintf("Elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  803a14:	ba 7f 45 4c 46       	mov    $0x464c457f,%edx
+  803a19:	8b b5 d0 fd ff ff    	mov    -0x230(%rbp),%esi
+  803a1f:	48 bf b7 59 80 00 00 	movabs $0x8059b7,%rdi
+  803a26:	00 00 00 
+  803a29:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a2e:	48 b9 d0 02 80 00 00 	movabs $0x8002d0,%rcx
+  803a35:	00 00 00 
+  803a38:	ff d1                	call   *%rcx
+        close(fd);
+  803a3a:	8b bd e4 fc ff ff    	mov    -0x31c(%rbp),%edi
+  803a40:	48 b8 7a 17 80 00 00 	movabs $0x80177a,%rax
+  803a47:	00 00 00 
+  803a4a:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  803a4c:	c7 85 e4 fc ff ff ee 	movl   $0xffffffee,-0x31c(%rbp)
+  803a53:	ff ff ff 
+  803a56:	e9 c9 00 00 00       	jmp    803b24 <spawn+0x44e>
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  803a5b:	48 b9 30 59 80 00 00 	movabs $0x805930,%rcx
+  803a62:	00 00 00 
+  803a65:	48 ba d1 59 80 00 00 	movabs $0x8059d1,%rdx
+  803a6c:	00 00 00 
+  803a6f:	be f9 00 00 00       	mov    $0xf9,%esi
+  803a74:	48 bf e6 59 80 00 00 	movabs $0x8059e6,%rdi
+  803a7b:	00 00 00 
+  803a7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a83:	49 b8 80 01 80 00 00 	movabs $0x800180,%r8
+  803a8a:	00 00 00 
+  803a8d:	41 ff d0             	call   *%r8
+    /* Map them to child */
+    /* Unmap them from parent */
+    size_t datasz = filesz;
+    filesz = ROUNDUP(va + filesz, PAGE_SIZE) - va;
+    if (memsz > filesz)
+        scring_alloc_region(child, (void *)va + filesz, memsz - filesz, perm);
+  803a90:	49 8d 14 06          	lea    (%r14,%rax,1),%rdx
+  803a94:	48 29 f2             	sub    %rsi,%rdx
+  803a97:	89 d9                	mov    %ebx,%ecx
+  803a99:	8b bd dc fc ff ff    	mov    -0x324(%rbp),%edi
+  803a9f:	48 b8 3d 49 80 00 00 	movabs $0x80493d,%rax
+  803aa6:	00 00 00 
+  803aa9:	ff d0                	call   *%rax
+  803aab:	e9 f0 01 00 00       	jmp    803ca0 <spawn+0x5ca>
+
+    /* Everything queued so far (including the unmap of
+     * the previous segment) has to be executed first */
+    res = scring_submit();
+    if (res < 0) {
+        cprintf("map_segment.sys_alloc_region failed: %i\n", res);
+  803ab0:	89 c6                	mov    %eax,%esi
+  803ab2:	48 bf 60 59 80 00 00 	movabs $0x805960,%rdi
+  803ab9:	00 00 00 
+  803abc:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ac1:	48 ba d0 02 80 00 00 	movabs $0x8002d0,%rdx
+  803ac8:	00 00 00 
+  803acb:	ff d2                	call   *%rdx
+    scring_discard();
+  803acd:	48 b8 1d 49 80 00 00 	movabs $0x80491d,%rax
+  803ad4:	00 00 00 
+  803ad7:	ff d0                	call   *%rax
+    sys_unmap_region(0, UTEMP, USER_STACK_SIZE);
+  803ad9:	ba 00 00 01 00       	mov    $0x10000,%edx
+  803ade:	be 00 00 40 00       	mov    $0x400000,%esi
+  803ae3:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ae8:	48 b8 fa 11 80 00 00 	movabs $0x8011fa,%rax
+  803aef:	00 00 00 
+  803af2:	ff d0                	call   *%rax
+    sys_env_destroy(child);
+  803af4:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  803afa:	48 b8 64 10 80 00 00 	movabs $0x801064,%rax
+  803b01:	00 00 00 
+  803b04:	ff d0                	call   *%rax
+    close(fd);
+  803b06:	8b bd e4 fc ff ff    	mov    -0x31c(%rbp),%edi
+  803b0c:	48 b8 7a 17 80 00 00 	movabs $0x80177a,%rax
+  803b13:	00 00 00 
+  803b16:	ff d0                	call   *%rax
+    return res;
+  803b18:	8b 85 f0 fc ff ff    	mov    -0x310(%rbp),%eax
+  803b1e:	89 85 e4 fc ff ff    	mov    %eax,-0x31c(%rbp)
+}
+  803b24:	8b 85 e4 fc ff ff    	mov    -0x31c(%rbp),%eax
+  803b2a:	48 81 c4 08 03 00 00 	add    $0x308,%rsp
+  803b31:	5b                   	pop    %rbx
+  803b32:	41 5c                	pop    %r12
+  803b34:	41 5d                	pop    %r13
+  803b36:	41 5e                	pop    %r14
+  803b38:	41 5f                	pop    %r15
+  803b3a:	5d                   	pop    %rbp
+  803b3b:	c3                   	ret
+    /* Text pages stay shared with the block cache
+     * and with other instances of the program */
+    void *addr = UTEMP;
+    res = mmap(&addr, filesz, PROT_RW, MAP_PRIVATE | MAP_FIXED | MAP_POPULATE, fd, fileoffset);
+    if (res < 0) {
+        cprintf("map_segment.mmap failed: %i\n", res);
+  803b3c:	89 c6                	mov    %eax,%esi
+  803b3e:	48 bf f2 59 80 00 00 	movabs $0x8059f2,%rdi
+  803b45:	00 00 00 
+  803b48:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b4d:	48 ba d0 02 80 00 00 	movabs $0x8002d0,%rdx
+  803b54:	00 00 00 
+  803b57:	ff d2                	call   *%rdx
+        return res;
+  803b59:	e9 6f ff ff ff       	jmp    803acd <spawn+0x3f7>
+    }
+
+    /* The rest of the last page belongs to bss */
+    if (memsz > datasz && filesz > datasz)
+        memset(UTEMP + datasz, 0, filesz - datasz);
+  803b5e:	4c 89 e2             	mov    %r12,%rdx
+  803b61:	48 8b 85 e8 fc ff ff 	mov    -0x318(%rbp),%rax
+  803b68:	48 29 c2             	sub    %rax,%rdx
+  803b6b:	48 8d b8 00 00 40 00 	lea    0x400000(%rax),%rdi
+  803b72:	be 00 00 00 00       	mov    $0x0,%esi
+  803b77:	48 b8 41 0d 80 00 00 	movabs $0x800d41,%rax
+  803b7e:	00 00 00 
+  803b81:	ff d0                	call   *%rax
+
+    scring_map_region(CURENVID, UTEMP, child, (void *)va, filesz, perm | PROT_LAZY);
+  803b83:	80 cb 80             	or     $0x80,%bl
+  803b86:	41 89 d9             	mov    %ebx,%r9d
+  803b89:	4d 89 e0             	mov    %r12,%r8
+  803b8c:	4c 89 f1             	mov    %r14,%rcx
+  803b8f:	8b 95 dc fc ff ff    	mov    -0x324(%rbp),%edx
+  803b95:	be 00 00 40 00       	mov    $0x400000,%esi
+  803b9a:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b9f:	48 b8 73 49 80 00 00 	movabs $0x804973,%rax
+  803ba6:	00 00 00 
+  803ba9:	ff d0                	call   *%rax
+    res = scring_submit();
+  803bab:	48 b8 d1 48 80 00 00 	movabs $0x8048d1,%rax
+  803bb2:	00 00 00 
+  803bb5:	ff d0                	call   *%rax
+  803bb7:	89 c3                	mov    %eax,%ebx
+  803bb9:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+    munmap(UTEMP, filesz);
+  803bbf:	4c 89 e6             	mov    %r12,%rsi
+  803bc2:	bf 00 00 40 00       	mov    $0x400000,%edi
+  803bc7:	48 b8 a3 31 80 00 00 	movabs $0x8031a3,%rax
+  803bce:	00 00 00 
+  803bd1:	ff d0                	call   *%rax
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  803bd3:	85 db                	test   %ebx,%ebx
+  803bd5:	0f 88 f2 fe ff ff    	js     803acd <spawn+0x3f7>
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  803bdb:	49 83 c7 01          	add    $0x1,%r15
+  803bdf:	49 83 c5 38          	add    $0x38,%r13
+  803be3:	0f b7 85 08 fe ff ff 	movzwl -0x1f8(%rbp),%eax
+  803bea:	49 39 c7             	cmp    %rax,%r15
+  803bed:	0f 83 37 01 00 00    	jae    803d2a <spawn+0x654>
+        if (ph->p_type != ELF_PROG_LOAD) continue;
+  803bf3:	41 83 7d 00 01       	cmpl   $0x1,0x0(%r13)
+  803bf8:	75 e1                	jne    803bdb <spawn+0x505>
+        if (ph->p_flags & ELF_PROG_FLAG_WRITE) perm |= PROT_W;
+  803bfa:	41 8b 45 04          	mov    0x4(%r13),%eax
+  803bfe:	89 c3                	mov    %eax,%ebx
+  803c00:	83 e3 02             	and    $0x2,%ebx
+        if (ph->p_flags & ELF_PROG_FLAG_READ) perm |= PROT_R;
+  803c03:	89 da                	mov    %ebx,%edx
+  803c05:	83 ca 04             	or     $0x4,%edx
+  803c08:	a8 04                	test   $0x4,%al
+  803c0a:	0f 45 da             	cmovne %edx,%ebx
+        if (ph->p_flags & ELF_PROG_FLAG_EXEC) perm |= PROT_X;
+  803c0d:	89 da                	mov    %ebx,%edx
+  803c0f:	83 ca 01             	or     $0x1,%edx
+  803c12:	a8 01                	test   $0x1,%al
+  803c14:	0f 45 da             	cmovne %edx,%ebx
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  803c17:	49 8b 45 08          	mov    0x8(%r13),%rax
+  803c1b:	89 85 e0 fc ff ff    	mov    %eax,-0x320(%rbp)
+  803c21:	49 8b 75 20          	mov    0x20(%r13),%rsi
+  803c25:	48 89 b5 e8 fc ff ff 	mov    %rsi,-0x318(%rbp)
+  803c2c:	49 8b 7d 28          	mov    0x28(%r13),%rdi
+  803c30:	48 89 bd f8 fc ff ff 	mov    %rdi,-0x308(%rbp)
+  803c37:	4d 8b 75 10          	mov    0x10(%r13),%r14
+  803c3b:	8b 8d cc fd ff ff    	mov    -0x234(%rbp),%ecx
+  803c41:	89 8d dc fc ff ff    	mov    %ecx,-0x324(%rbp)
+    if (res) {
+  803c47:	44 89 f2             	mov    %r14d,%edx
+  803c4a:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803c50:	74 22                	je     803c74 <spawn+0x59e>
+        va -= res;
+  803c52:	48 63 ca             	movslq %edx,%rcx
+  803c55:	49 29 ce             	sub    %rcx,%r14
+        memsz += res;
+  803c58:	48 01 cf             	add    %rcx,%rdi
+  803c5b:	48 89 bd f8 fc ff ff 	mov    %rdi,-0x308(%rbp)
+        filesz += res;
+  803c62:	48 01 ce             	add    %rcx,%rsi
+  803c65:	48 89 b5 e8 fc ff ff 	mov    %rsi,-0x318(%rbp)
+        fileoffset -= res;
+  803c6c:	29 d0                	sub    %edx,%eax
+  803c6e:	89 85 e0 fc ff ff    	mov    %eax,-0x320(%rbp)
+    filesz = ROUNDUP(va + filesz, PAGE_SIZE) - va;
+  803c74:	48 8b 85 e8 fc ff ff 	mov    -0x318(%rbp),%rax
+  803c7b:	4a 8d b4 30 ff 0f 00 	lea    0xfff(%rax,%r14,1),%rsi
+  803c82:	00 
+  803c83:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  803c8a:	49 89 f4             	mov    %rsi,%r12
+  803c8d:	4d 29 f4             	sub    %r14,%r12
+    if (memsz > filesz)
+  803c90:	48 8b 85 f8 fc ff ff 	mov    -0x308(%rbp),%rax
+  803c97:	49 39 c4             	cmp    %rax,%r12
+  803c9a:	0f 82 f0 fd ff ff    	jb     803a90 <spawn+0x3ba>
+    res = scring_submit();
+  803ca0:	48 b8 d1 48 80 00 00 	movabs $0x8048d1,%rax
+  803ca7:	00 00 00 
+  803caa:	ff d0                	call   *%rax
+  803cac:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+    if (res < 0) {
+  803cb2:	85 c0                	test   %eax,%eax
+  803cb4:	0f 88 f6 fd ff ff    	js     803ab0 <spawn+0x3da>
+    if (!filesz) return 0;
+  803cba:	4d 85 e4             	test   %r12,%r12
+  803cbd:	0f 84 18 ff ff ff    	je     803bdb <spawn+0x505>
+    void *addr = UTEMP;
+  803cc3:	48 c7 85 00 fd ff ff 	movq   $0x400000,-0x300(%rbp)
+  803cca:	00 00 40 00 
+    res = mmap(&addr, filesz, PROT_RW, MAP_PRIVATE | MAP_FIXED | MAP_POPULATE, fd, fileoffset);
+  803cce:	44 8b 8d e0 fc ff ff 	mov    -0x320(%rbp),%r9d
+  803cd5:	44 8b 85 e4 fc ff ff 	mov    -0x31c(%rbp),%r8d
+  803cdc:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  803ce1:	ba 06 00 00 00       	mov    $0x6,%edx
+  803ce6:	4c 89 e6             	mov    %r12,%rsi
+  803ce9:	48 8d bd 00 fd ff ff 	lea    -0x300(%rbp),%rdi
+  803cf0:	48 b8 20 33 80 00 00 	movabs $0x803320,%rax
+  803cf7:	00 00 00 
+  803cfa:	ff d0                	call   *%rax
+  803cfc:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+    if (res < 0) {
+  803d02:	85 c0                	test   %eax,%eax
+  803d04:	0f 88 32 fe ff ff    	js     803b3c <spawn+0x466>
+    if (memsz > datasz && filesz > datasz)
+  803d0a:	48 8b 85 f8 fc ff ff 	mov    -0x308(%rbp),%rax
+  803d11:	49 39 c4             	cmp    %rax,%r12
+  803d14:	49 0f 46 c4          	cmovbe %r12,%rax
+  803d18:	48 39 85 e8 fc ff ff 	cmp    %rax,-0x318(%rbp)
+  803d1f:	0f 83 5e fe ff ff    	jae    803b83 <spawn+0x4ad>
+  803d25:	e9 34 fe ff ff       	jmp    803b5e <spawn+0x488>
+    close(fd);
+  803d2a:	8b bd e4 fc ff ff    	mov    -0x31c(%rbp),%edi
+  803d30:	48 b8 7a 17 80 00 00 	movabs $0x80177a,%rax
+  803d37:	00 00 00 
+  803d3a:	ff d0                	call   *%rax
+    foreach_shared_region(copy_shared_region, &child);
+  803d3c:	48 8d b5 cc fd ff ff 	lea    -0x234(%rbp),%rsi
+  803d43:	48 bf 81 36 80 00 00 	movabs $0x803681,%rdi
+  803d4a:	00 00 00 
+  803d4d:	48 b8 72 46 80 00 00 	movabs $0x804672,%rax
+  803d54:	00 00 00 
+  803d57:	ff d0                	call   *%rax
+    scring_env_set_trapframe(child, &child_tf);
+  803d59:	48 8d b5 0c fd ff ff 	lea    -0x2f4(%rbp),%rsi
+  803d60:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  803d66:	48 b8 1d 4a 80 00 00 	movabs $0x804a1d,%rax
+  803d6d:	00 00 00 
+  803d70:	ff d0                	call   *%rax
+    scring_env_set_status(child, ENV_RUNNABLE);
+  803d72:	be 02 00 00 00       	mov    $0x2,%esi
+  803d77:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  803d7d:	48 b8 e5 49 80 00 00 	movabs $0x8049e5,%rax
+  803d84:	00 00 00 
+  803d87:	ff d0                	call   *%rax
+    if ((res = scring_submit()) < 0) {
+  803d89:	48 b8 d1 48 80 00 00 	movabs $0x8048d1,%rax
+  803d90:	00 00 00 
+  803d93:	ff d0                	call   *%rax
+  803d95:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+  803d9b:	85 c0                	test   %eax,%eax
+  803d9d:	78 11                	js     803db0 <spawn+0x6da>
+    return child;
+  803d9f:	8b 85 cc fd ff ff    	mov    -0x234(%rbp),%eax
+  803da5:	89 85 e4 fc ff ff    	mov    %eax,-0x31c(%rbp)
+  803dab:	e9 74 fd ff ff       	jmp    803b24 <spawn+0x44e>
+        cprintf("spawn: batched system call failed: %i\n", res);
+  803db0:	89 c6                	mov    %eax,%esi
+  803db2:	48 bf 90 59 80 00 00 	movabs $0x805990,%rdi
+  803db9:	00 00 00 
+  803dbc:	b8 00 00 00 00       	mov    $0x0,%eax
+  803dc1:	48 ba d0 02 80 00 00 	movabs $0x8002d0,%rdx
+  803dc8:	00 00 00 
+  803dcb:	ff d2                	call   *%rdx
+        goto error;
+  803dcd:	e9 fb fc ff ff       	jmp    803acd <spawn+0x3f7>
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  803dd2:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  803dd7:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+  803ddd:	e9 eb fc ff ff       	jmp    803acd <spawn+0x3f7>
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  803de2:	b9 06 00 00 00       	mov    $0x6,%ecx
+  803de7:	ba 00 00 01 00       	mov    $0x10000,%edx
+  803dec:	be 00 00 40 00       	mov    $0x400000,%esi
+  803df1:	bf 00 00 00 00       	mov    $0x0,%edi
+  803df6:	48 b8 54 11 80 00 00 	movabs $0x801154,%rax
+  803dfd:	00 00 00 
+  803e00:	ff d0                	call   *%rax
+  803e02:	85 c0                	test   %eax,%eax
+  803e04:	78 d1                	js     803dd7 <spawn+0x701>
+    for (argc = 0; argv[argc] != 0; argc++)
+  803e06:	48 c7 85 f8 fc ff ff 	movq   $0x0,-0x308(%rbp)
+  803e0d:	00 00 00 00 
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  803e11:	48 c7 85 f0 fc ff ff 	movq   $0x40fff8,-0x310(%rbp)
+  803e18:	f8 ff 40 00 
+  803e1c:	48 c7 85 e8 fc ff ff 	movq   $0x410000,-0x318(%rbp)
+  803e23:	00 00 41 00 
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  803e27:	bb 00 00 41 00       	mov    $0x410000,%ebx
+  803e2c:	e9 e2 fa ff ff       	jmp    803913 <spawn+0x23d>
+
+0000000000803e31 <spawnl>:
+spawnl(const char *prog, const char *arg0, ...) {
+  803e31:	55                   	push   %rbp
+  803e32:	48 89 e5             	mov    %rsp,%rbp
+  803e35:	48 83 ec 50          	sub    $0x50,%rsp
+  803e39:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803e3d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803e41:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803e45:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(vl, arg0);
+  803e49:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803e50:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803e54:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803e58:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803e5c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int argc = 0;
+  803e60:	b9 00 00 00 00       	mov    $0x0,%ecx
+    while (va_arg(vl, void *) != NULL) argc++;
+  803e65:	eb 15                	jmp    803e7c <spawnl+0x4b>
+  803e67:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803e6b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803e6f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803e73:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  803e77:	74 1c                	je     803e95 <spawnl+0x64>
+  803e79:	83 c1 01             	add    $0x1,%ecx
+  803e7c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803e7f:	83 f8 2f             	cmp    $0x2f,%eax
+  803e82:	77 e3                	ja     803e67 <spawnl+0x36>
+  803e84:	89 c2                	mov    %eax,%edx
+  803e86:	4c 8d 55 d0          	lea    -0x30(%rbp),%r10
+  803e8a:	4c 01 d2             	add    %r10,%rdx
+  803e8d:	83 c0 08             	add    $0x8,%eax
+  803e90:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803e93:	eb de                	jmp    803e73 <spawnl+0x42>
+    const char *argv[argc + 2];
+  803e95:	8d 41 02             	lea    0x2(%rcx),%eax
+  803e98:	48 98                	cltq
+  803e9a:	48 8d 04 c5 0f 00 00 	lea    0xf(,%rax,8),%rax
+  803ea1:	00 
+  803ea2:	48 83 e0 f0          	and    $0xfffffffffffffff0,%rax
+  803ea6:	48 29 c4             	sub    %rax,%rsp
+  803ea9:	4c 8d 44 24 07       	lea    0x7(%rsp),%r8
+  803eae:	4c 89 c0             	mov    %r8,%rax
+  803eb1:	48 c1 e8 03          	shr    $0x3,%rax
+  803eb5:	49 83 e0 f8          	and    $0xfffffffffffffff8,%r8
+    argv[0] = arg0;
+  803eb9:	48 89 34 c5 00 00 00 	mov    %rsi,0x0(,%rax,8)
+  803ec0:	00 
+    argv[argc + 1] = NULL;
+  803ec1:	8d 41 01             	lea    0x1(%rcx),%eax
+  803ec4:	48 98                	cltq
+  803ec6:	49 c7 04 c0 00 00 00 	movq   $0x0,(%r8,%rax,8)
+  803ecd:	00 
+    va_start(vl, arg0);
+  803ece:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803ed5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803ed9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803edd:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803ee1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    for (i = 0; i < argc; i++) {
+  803ee5:	85 c9                	test   %ecx,%ecx
+  803ee7:	74 41                	je     803f2a <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  803ee9:	49 89 c1             	mov    %rax,%r9
+  803eec:	49 8d 40 08          	lea    0x8(%r8),%rax
+  803ef0:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  803ef3:	49 8d 74 d0 10       	lea    0x10(%r8,%rdx,8),%rsi
+  803ef8:	eb 1b                	jmp    803f15 <spawnl+0xe4>
+  803efa:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803efe:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  803f02:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  803f06:	48 8b 11             	mov    (%rcx),%rdx
+  803f09:	48 89 10             	mov    %rdx,(%rax)
+    for (i = 0; i < argc; i++) {
+  803f0c:	48 83 c0 08          	add    $0x8,%rax
+  803f10:	48 39 f0             	cmp    %rsi,%rax
+  803f13:	74 15                	je     803f2a <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  803f15:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  803f18:	83 fa 2f             	cmp    $0x2f,%edx
+  803f1b:	77 dd                	ja     803efa <spawnl+0xc9>
+  803f1d:	89 d1                	mov    %edx,%ecx
+  803f1f:	4c 01 c9             	add    %r9,%rcx
+  803f22:	83 c2 08             	add    $0x8,%edx
+  803f25:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  803f28:	eb dc                	jmp    803f06 <spawnl+0xd5>
+    return spawn(prog, argv);
+  803f2a:	4c 89 c6             	mov    %r8,%rsi
+  803f2d:	48 b8 d6 36 80 00 00 	movabs $0x8036d6,%rax
+  803f34:	00 00 00 
+  803f37:	ff d0                	call   *%rax
+}
+  803f39:	c9                   	leave
+  803f3a:	c3                   	ret
+
+0000000000803f3b <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803f3b:	55                   	push   %rbp
+  803f3c:	48 89 e5             	mov    %rsp,%rbp
+  803f3f:	41 54                	push   %r12
+  803f41:	53                   	push   %rbx
+  803f42:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803f45:	48 b8 99 15 80 00 00 	movabs $0x801599,%rax
+  803f4c:	00 00 00 
+  803f4f:	ff d0                	call   *%rax
+  803f51:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803f54:	48 be 0f 5a 80 00 00 	movabs $0x805a0f,%rsi
+  803f5b:	00 00 00 
+  803f5e:	48 89 df             	mov    %rbx,%rdi
+  803f61:	48 b8 f5 0b 80 00 00 	movabs $0x800bf5,%rax
+  803f68:	00 00 00 
+  803f6b:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803f6d:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803f72:	41 2b 04 24          	sub    (%r12),%eax
+  803f76:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803f7c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803f83:	00 00 00 
+    stat->st_dev = &devpipe;
+  803f86:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803f8d:	00 00 00 
+  803f90:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803f97:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f9c:	5b                   	pop    %rbx
+  803f9d:	41 5c                	pop    %r12
+  803f9f:	5d                   	pop    %rbp
+  803fa0:	c3                   	ret
+
+0000000000803fa1 <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  803fa1:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803fa4:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  803faa:	8b 17                	mov    (%rdi),%edx
+  803fac:	85 d2                	test   %edx,%edx
+  803fae:	75 01                	jne    803fb1 <pipe_wakeup+0x10>
+  803fb0:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  803fb1:	55                   	push   %rbp
+  803fb2:	48 89 e5             	mov    %rsp,%rbp
+  803fb5:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  803fb8:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  803fbe:	be 00 04 00 00       	mov    $0x400,%esi
+  803fc3:	48 b8 e0 14 80 00 00 	movabs $0x8014e0,%rax
+  803fca:	00 00 00 
+  803fcd:	ff d0                	call   *%rax
+}
+  803fcf:	5d                   	pop    %rbp
+  803fd0:	c3                   	ret
+
+0000000000803fd1 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803fd1:	55                   	push   %rbp
+  803fd2:	48 89 e5             	mov    %rsp,%rbp
+  803fd5:	41 55                	push   %r13
+  803fd7:	41 54                	push   %r12
+  803fd9:	53                   	push   %rbx
+  803fda:	48 83 ec 08          	sub    $0x8,%rsp
+  803fde:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803fe1:	48 b8 99 15 80 00 00 	movabs $0x801599,%rax
+  803fe8:	00 00 00 
+  803feb:	ff d0                	call   *%rax
+  803fed:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803ff0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ff5:	4c 89 e6             	mov    %r12,%rsi
+  803ff8:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ffd:	49 bc fa 11 80 00 00 	movabs $0x8011fa,%r12
+  804004:	00 00 00 
+  804007:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  80400a:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  80400e:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  804012:	49 bd a1 3f 80 00 00 	movabs $0x803fa1,%r13
+  804019:	00 00 00 
+  80401c:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  80401f:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  804023:	48 89 de             	mov    %rbx,%rsi
+  804026:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  804029:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80402e:	48 89 de             	mov    %rbx,%rsi
+  804031:	bf 00 00 00 00       	mov    $0x0,%edi
+  804036:	41 ff d4             	call   *%r12
+  804039:	48 83 c4 08          	add    $0x8,%rsp
+  80403d:	5b                   	pop    %rbx
+  80403e:	41 5c                	pop    %r12
+  804040:	41 5d                	pop    %r13
+  804042:	5d                   	pop    %rbp
+  804043:	c3                   	ret
+
+0000000000804044 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  804044:	55                   	push   %rbp
+  804045:	48 89 e5             	mov    %rsp,%rbp
+  804048:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80404b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804050:	be 00 10 00 00       	mov    $0x1000,%esi
+  804055:	48 b8 3d 11 80 00 00 	movabs $0x80113d,%rax
+  80405c:	00 00 00 
+  80405f:	ff d0                	call   *%rax
+  804061:	85 c0                	test   %eax,%eax
+  804063:	0f 94 c0             	sete   %al
+  804066:	0f b6 c0             	movzbl %al,%eax
+}
+  804069:	5d                   	pop    %rbp
+  80406a:	c3                   	ret
+
+000000000080406b <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80406b:	55                   	push   %rbp
+  80406c:	48 89 e5             	mov    %rsp,%rbp
+  80406f:	41 57                	push   %r15
+  804071:	41 56                	push   %r14
+  804073:	41 55                	push   %r13
+  804075:	41 54                	push   %r12
+  804077:	53                   	push   %rbx
+  804078:	48 83 ec 38          	sub    $0x38,%rsp
+  80407c:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  804080:	49 89 f4             	mov    %rsi,%r12
+  804083:	49 89 d7             	mov    %rdx,%r15
+  804086:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80408a:	48 b8 99 15 80 00 00 	movabs $0x801599,%rax
+  804091:	00 00 00 
+  804094:	ff d0                	call   *%rax
+  804096:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  804099:	4d 85 ff             	test   %r15,%r15
+  80409c:	0f 84 f1 00 00 00    	je     804193 <devpipe_write+0x128>
+  8040a2:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  8040a6:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  8040aa:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  8040ae:	49 bd 44 40 80 00 00 	movabs $0x804044,%r13
+  8040b5:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8040b8:	49 bf a1 3f 80 00 00 	movabs $0x803fa1,%r15
+  8040bf:	00 00 00 
+  8040c2:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  8040c6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8040ca:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8040ce:	8b 73 04             	mov    0x4(%rbx),%esi
+  8040d1:	48 63 ce             	movslq %esi,%rcx
+  8040d4:	48 63 03             	movslq (%rbx),%rax
+  8040d7:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  8040dd:	48 39 c1             	cmp    %rax,%rcx
+  8040e0:	72 64                	jb     804146 <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  8040e2:	48 89 de             	mov    %rbx,%rsi
+  8040e5:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8040e9:	41 ff d5             	call   *%r13
+  8040ec:	85 c0                	test   %eax,%eax
+  8040ee:	0f 85 b9 00 00 00    	jne    8041ad <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8040f4:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8040f8:	4c 89 f7             	mov    %r14,%rdi
+  8040fb:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  8040fe:	8b 43 04             	mov    0x4(%rbx),%eax
+  804101:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  804108:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  80410f:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  804115:	8b 03                	mov    (%rbx),%eax
+  804117:	41 39 c4             	cmp    %eax,%r12d
+  80411a:	75 b2                	jne    8040ce <devpipe_write+0x63>
+  80411c:	48 89 de             	mov    %rbx,%rsi
+  80411f:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  804123:	41 ff d5             	call   *%r13
+  804126:	85 c0                	test   %eax,%eax
+  804128:	75 a0                	jne    8040ca <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  80412a:	ba 0a 00 00 00       	mov    $0xa,%edx
+  80412f:	44 89 e6             	mov    %r12d,%esi
+  804132:	48 89 df             	mov    %rbx,%rdi
+  804135:	48 b8 c2 14 80 00 00 	movabs $0x8014c2,%rax
+  80413c:	00 00 00 
+  80413f:	ff d0                	call   *%rax
+  804141:	e9 7c ff ff ff       	jmp    8040c2 <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  804146:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  80414a:	41 0f b6 38          	movzbl (%r8),%edi
+  80414e:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  804155:	80 80 80 
+  804158:	48 89 c8             	mov    %rcx,%rax
+  80415b:	48 f7 e2             	mul    %rdx
+  80415e:	48 c1 ea 0b          	shr    $0xb,%rdx
+  804162:	48 89 d0             	mov    %rdx,%rax
+  804165:	48 c1 e0 08          	shl    $0x8,%rax
+  804169:	48 29 d0             	sub    %rdx,%rax
+  80416c:	48 c1 e0 04          	shl    $0x4,%rax
+  804170:	48 29 c1             	sub    %rax,%rcx
+  804173:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  804178:	83 c6 01             	add    $0x1,%esi
+  80417b:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80417e:	49 83 c0 01          	add    $0x1,%r8
+  804182:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  804186:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80418a:	49 39 c0             	cmp    %rax,%r8
+  80418d:	0f 85 2f ff ff ff    	jne    8040c2 <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  804193:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  804197:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  80419b:	48 b8 a1 3f 80 00 00 	movabs $0x803fa1,%rax
+  8041a2:	00 00 00 
+  8041a5:	ff d0                	call   *%rax
+    return n;
+  8041a7:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8041ab:	eb 05                	jmp    8041b2 <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  8041ad:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8041b2:	48 83 c4 38          	add    $0x38,%rsp
+  8041b6:	5b                   	pop    %rbx
+  8041b7:	41 5c                	pop    %r12
+  8041b9:	41 5d                	pop    %r13
+  8041bb:	41 5e                	pop    %r14
+  8041bd:	41 5f                	pop    %r15
+  8041bf:	5d                   	pop    %rbp
+  8041c0:	c3                   	ret
+
+00000000008041c1 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8041c1:	55                   	push   %rbp
+  8041c2:	48 89 e5             	mov    %rsp,%rbp
+  8041c5:	41 57                	push   %r15
+  8041c7:	41 56                	push   %r14
+  8041c9:	41 55                	push   %r13
+  8041cb:	41 54                	push   %r12
+  8041cd:	53                   	push   %rbx
+  8041ce:	48 83 ec 28          	sub    $0x28,%rsp
+  8041d2:	49 89 fd             	mov    %rdi,%r13
+  8041d5:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  8041d9:	49 89 d4             	mov    %rdx,%r12
+  8041dc:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8041e0:	48 b8 99 15 80 00 00 	movabs $0x801599,%rax
+  8041e7:	00 00 00 
+  8041ea:	ff d0                	call   *%rax
+  8041ec:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8041ef:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  8041f5:	49 bf 44 40 80 00 00 	movabs $0x804044,%r15
+  8041fc:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8041ff:	4d 85 e4             	test   %r12,%r12
+  804202:	0f 84 d5 00 00 00    	je     8042dd <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  804208:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  80420c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  804210:	8b 03                	mov    (%rbx),%eax
+  804212:	3b 43 04             	cmp    0x4(%rbx),%eax
+  804215:	75 7a                	jne    804291 <devpipe_read+0xd0>
+            if (i > 0) {
+  804217:	4d 85 f6             	test   %r14,%r14
+  80421a:	75 50                	jne    80426c <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  80421c:	48 89 de             	mov    %rbx,%rsi
+  80421f:	4c 89 ef             	mov    %r13,%rdi
+  804222:	41 ff d7             	call   *%r15
+  804225:	85 c0                	test   %eax,%eax
+  804227:	0f 85 c9 00 00 00    	jne    8042f6 <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  80422d:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  804230:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  804237:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  80423d:	8b 43 04             	mov    0x4(%rbx),%eax
+  804240:	41 39 c4             	cmp    %eax,%r12d
+  804243:	75 cb                	jne    804210 <devpipe_read+0x4f>
+  804245:	48 89 de             	mov    %rbx,%rsi
+  804248:	4c 89 ef             	mov    %r13,%rdi
+  80424b:	41 ff d7             	call   *%r15
+  80424e:	85 c0                	test   %eax,%eax
+  804250:	75 be                	jne    804210 <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  804252:	ba 0a 00 00 00       	mov    $0xa,%edx
+  804257:	44 89 e6             	mov    %r12d,%esi
+  80425a:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80425e:	48 b8 c2 14 80 00 00 	movabs $0x8014c2,%rax
+  804265:	00 00 00 
+  804268:	ff d0                	call   *%rax
+  80426a:	eb a4                	jmp    804210 <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  80426c:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  804270:	48 89 de             	mov    %rbx,%rsi
+  804273:	48 b8 a1 3f 80 00 00 	movabs $0x803fa1,%rax
+  80427a:	00 00 00 
+  80427d:	ff d0                	call   *%rax
+                return i;
+  80427f:	4c 89 f0             	mov    %r14,%rax
+}
+  804282:	48 83 c4 28          	add    $0x28,%rsp
+  804286:	5b                   	pop    %rbx
+  804287:	41 5c                	pop    %r12
+  804289:	41 5d                	pop    %r13
+  80428b:	41 5e                	pop    %r14
+  80428d:	41 5f                	pop    %r15
+  80428f:	5d                   	pop    %rbp
+  804290:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  804291:	48 63 c8             	movslq %eax,%rcx
+  804294:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  80429b:	80 80 80 
+  80429e:	48 89 c8             	mov    %rcx,%rax
+  8042a1:	48 f7 e2             	mul    %rdx
+  8042a4:	48 c1 ea 0b          	shr    $0xb,%rdx
+  8042a8:	48 89 d0             	mov    %rdx,%rax
+  8042ab:	48 c1 e0 08          	shl    $0x8,%rax
+  8042af:	48 29 d0             	sub    %rdx,%rax
+  8042b2:	48 c1 e0 04          	shl    $0x4,%rax
+  8042b6:	48 89 c2             	mov    %rax,%rdx
+  8042b9:	48 89 c8             	mov    %rcx,%rax
+  8042bc:	48 29 d0             	sub    %rdx,%rax
+  8042bf:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  8042c4:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8042c8:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  8042cc:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8042cf:	49 83 c6 01          	add    $0x1,%r14
+  8042d3:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  8042d7:	0f 85 2b ff ff ff    	jne    804208 <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  8042dd:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  8042e1:	48 89 de             	mov    %rbx,%rsi
+  8042e4:	48 b8 a1 3f 80 00 00 	movabs $0x803fa1,%rax
+  8042eb:	00 00 00 
+  8042ee:	ff d0                	call   *%rax
+    return n;
+  8042f0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8042f4:	eb 8c                	jmp    804282 <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  8042f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042fb:	eb 85                	jmp    804282 <devpipe_read+0xc1>
+
+00000000008042fd <pipe>:
+pipe(int pfd[2]) {
+  8042fd:	55                   	push   %rbp
+  8042fe:	48 89 e5             	mov    %rsp,%rbp
+  804301:	41 55                	push   %r13
+  804303:	41 54                	push   %r12
+  804305:	53                   	push   %rbx
+  804306:	48 83 ec 18          	sub    $0x18,%rsp
+  80430a:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80430d:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  804311:	48 b8 b5 15 80 00 00 	movabs $0x8015b5,%rax
+  804318:	00 00 00 
+  80431b:	ff d0                	call   *%rax
+  80431d:	89 c3                	mov    %eax,%ebx
+  80431f:	85 c0                	test   %eax,%eax
+  804321:	0f 88 a0 01 00 00    	js     8044c7 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  804327:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80432c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804331:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804335:	bf 00 00 00 00       	mov    $0x0,%edi
+  80433a:	48 b8 54 11 80 00 00 	movabs $0x801154,%rax
+  804341:	00 00 00 
+  804344:	ff d0                	call   *%rax
+  804346:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804348:	85 c0                	test   %eax,%eax
+  80434a:	0f 88 77 01 00 00    	js     8044c7 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804350:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  804354:	48 b8 b5 15 80 00 00 	movabs $0x8015b5,%rax
+  80435b:	00 00 00 
+  80435e:	ff d0                	call   *%rax
+  804360:	89 c3                	mov    %eax,%ebx
+  804362:	85 c0                	test   %eax,%eax
+  804364:	0f 88 43 01 00 00    	js     8044ad <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  80436a:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80436f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804374:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804378:	bf 00 00 00 00       	mov    $0x0,%edi
+  80437d:	48 b8 54 11 80 00 00 	movabs $0x801154,%rax
+  804384:	00 00 00 
+  804387:	ff d0                	call   *%rax
+  804389:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80438b:	85 c0                	test   %eax,%eax
+  80438d:	0f 88 1a 01 00 00    	js     8044ad <pipe+0x1b0>
+    va = fd2data(fd0);
+  804393:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804397:	48 b8 99 15 80 00 00 	movabs $0x801599,%rax
+  80439e:	00 00 00 
+  8043a1:	ff d0                	call   *%rax
+  8043a3:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8043a6:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8043ab:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8043b0:	48 89 c6             	mov    %rax,%rsi
+  8043b3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043b8:	48 b8 54 11 80 00 00 	movabs $0x801154,%rax
+  8043bf:	00 00 00 
+  8043c2:	ff d0                	call   *%rax
+  8043c4:	89 c3                	mov    %eax,%ebx
+  8043c6:	85 c0                	test   %eax,%eax
+  8043c8:	0f 88 c5 00 00 00    	js     804493 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8043ce:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8043d2:	48 b8 99 15 80 00 00 	movabs $0x801599,%rax
+  8043d9:	00 00 00 
+  8043dc:	ff d0                	call   *%rax
+  8043de:	48 89 c1             	mov    %rax,%rcx
+  8043e1:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8043e7:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8043ed:	ba 00 00 00 00       	mov    $0x0,%edx
+  8043f2:	4c 89 ee             	mov    %r13,%rsi
+  8043f5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043fa:	48 b8 aa 11 80 00 00 	movabs $0x8011aa,%rax
+  804401:	00 00 00 
+  804404:	ff d0                	call   *%rax
+  804406:	89 c3                	mov    %eax,%ebx
+  804408:	85 c0                	test   %eax,%eax
+  80440a:	78 6e                	js     80447a <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80440c:	be 00 10 00 00       	mov    $0x1000,%esi
+  804411:	4c 89 ef             	mov    %r13,%rdi
+  804414:	48 b8 19 11 80 00 00 	movabs $0x801119,%rax
+  80441b:	00 00 00 
+  80441e:	ff d0                	call   *%rax
+  804420:	83 f8 02             	cmp    $0x2,%eax
+  804423:	0f 85 ab 00 00 00    	jne    8044d4 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  804429:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  804430:	00 00 
+  804432:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804436:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  804438:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80443c:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  804443:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804447:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  804449:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80444d:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  804454:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804458:	48 bb 87 15 80 00 00 	movabs $0x801587,%rbx
+  80445f:	00 00 00 
+  804462:	ff d3                	call   *%rbx
+  804464:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  804468:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80446c:	ff d3                	call   *%rbx
+  80446e:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  804473:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804478:	eb 4d                	jmp    8044c7 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  80447a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80447f:	4c 89 ee             	mov    %r13,%rsi
+  804482:	bf 00 00 00 00       	mov    $0x0,%edi
+  804487:	48 b8 fa 11 80 00 00 	movabs $0x8011fa,%rax
+  80448e:	00 00 00 
+  804491:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  804493:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804498:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80449c:	bf 00 00 00 00       	mov    $0x0,%edi
+  8044a1:	48 b8 fa 11 80 00 00 	movabs $0x8011fa,%rax
+  8044a8:	00 00 00 
+  8044ab:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8044ad:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8044b2:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8044b6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8044bb:	48 b8 fa 11 80 00 00 	movabs $0x8011fa,%rax
+  8044c2:	00 00 00 
+  8044c5:	ff d0                	call   *%rax
+}
+  8044c7:	89 d8                	mov    %ebx,%eax
+  8044c9:	48 83 c4 18          	add    $0x18,%rsp
+  8044cd:	5b                   	pop    %rbx
+  8044ce:	41 5c                	pop    %r12
+  8044d0:	41 5d                	pop    %r13
+  8044d2:	5d                   	pop    %rbp
+  8044d3:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8044d4:	48 b9 28 5a 80 00 00 	movabs $0x805a28,%rcx
+  8044db:	00 00 00 
+  8044de:	48 ba d1 59 80 00 00 	movabs $0x8059d1,%rdx
+  8044e5:	00 00 00 
+  8044e8:	be 50 00 00 00       	mov    $0x50,%esi
+  8044ed:	48 bf 16 5a 80 00 00 	movabs $0x805a16,%rdi
+  8044f4:	00 00 00 
+  8044f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044fc:	49 b8 80 01 80 00 00 	movabs $0x800180,%r8
+  804503:	00 00 00 
+  804506:	41 ff d0             	call   *%r8
+
+0000000000804509 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  804509:	55                   	push   %rbp
+  80450a:	48 89 e5             	mov    %rsp,%rbp
+  80450d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804511:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804515:	48 b8 15 16 80 00 00 	movabs $0x801615,%rax
+  80451c:	00 00 00 
+  80451f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804521:	85 c0                	test   %eax,%eax
+  804523:	78 23                	js     804548 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  804525:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804529:	48 b8 99 15 80 00 00 	movabs $0x801599,%rax
+  804530:	00 00 00 
+  804533:	ff d0                	call   *%rax
+  804535:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  804538:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80453c:	48 b8 44 40 80 00 00 	movabs $0x804044,%rax
+  804543:	00 00 00 
+  804546:	ff d0                	call   *%rax
+}
+  804548:	c9                   	leave
+  804549:	c3                   	ret
+
+000000000080454a <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80454a:	48 89 f8             	mov    %rdi,%rax
+  80454d:	48 c1 e8 27          	shr    $0x27,%rax
+  804551:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804558:	01 00 00 
+  80455b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80455f:	f6 c2 01             	test   $0x1,%dl
+  804562:	74 6d                	je     8045d1 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804564:	48 89 f8             	mov    %rdi,%rax
+  804567:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80456b:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804572:	01 00 00 
+  804575:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804579:	f6 c2 01             	test   $0x1,%dl
+  80457c:	74 62                	je     8045e0 <get_uvpt_entry+0x96>
+  80457e:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804585:	01 00 00 
+  804588:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80458c:	f6 c2 80             	test   $0x80,%dl
+  80458f:	75 4f                	jne    8045e0 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804591:	48 89 f8             	mov    %rdi,%rax
+  804594:	48 c1 e8 15          	shr    $0x15,%rax
+  804598:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80459f:	01 00 00 
+  8045a2:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8045a6:	f6 c2 01             	test   $0x1,%dl
+  8045a9:	74 44                	je     8045ef <get_uvpt_entry+0xa5>
+  8045ab:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8045b2:	01 00 00 
+  8045b5:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8045b9:	f6 c2 80             	test   $0x80,%dl
+  8045bc:	75 31                	jne    8045ef <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8045be:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8045c2:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8045c9:	01 00 00 
+  8045cc:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8045d0:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8045d1:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8045d8:	01 00 00 
+  8045db:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8045df:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8045e0:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8045e7:	01 00 00 
+  8045ea:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8045ee:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8045ef:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8045f6:	01 00 00 
+  8045f9:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8045fd:	c3                   	ret
+
+00000000008045fe <get_prot>:
+
+int
+get_prot(void *va) {
+  8045fe:	55                   	push   %rbp
+  8045ff:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804602:	48 b8 4a 45 80 00 00 	movabs $0x80454a,%rax
+  804609:	00 00 00 
+  80460c:	ff d0                	call   *%rax
+  80460e:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  804611:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  804616:	89 c1                	mov    %eax,%ecx
+  804618:	83 c9 04             	or     $0x4,%ecx
+  80461b:	f6 c2 01             	test   $0x1,%dl
+  80461e:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  804621:	89 c1                	mov    %eax,%ecx
+  804623:	83 c9 02             	or     $0x2,%ecx
+  804626:	f6 c2 02             	test   $0x2,%dl
+  804629:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80462c:	89 c1                	mov    %eax,%ecx
+  80462e:	83 c9 01             	or     $0x1,%ecx
+  804631:	48 85 d2             	test   %rdx,%rdx
+  804634:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804637:	89 c1                	mov    %eax,%ecx
+  804639:	83 c9 40             	or     $0x40,%ecx
+  80463c:	f6 c6 04             	test   $0x4,%dh
+  80463f:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804642:	5d                   	pop    %rbp
+  804643:	c3                   	ret
+
+0000000000804644 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804644:	55                   	push   %rbp
+  804645:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804648:	48 b8 4a 45 80 00 00 	movabs $0x80454a,%rax
+  80464f:	00 00 00 
+  804652:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804654:	48 c1 e8 06          	shr    $0x6,%rax
+  804658:	83 e0 01             	and    $0x1,%eax
+}
+  80465b:	5d                   	pop    %rbp
+  80465c:	c3                   	ret
+
+000000000080465d <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80465d:	55                   	push   %rbp
+  80465e:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804661:	48 b8 4a 45 80 00 00 	movabs $0x80454a,%rax
+  804668:	00 00 00 
+  80466b:	ff d0                	call   *%rax
+  80466d:	83 e0 01             	and    $0x1,%eax
+}
+  804670:	5d                   	pop    %rbp
+  804671:	c3                   	ret
+
+0000000000804672 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  804672:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  804679:	01 00 00 
+  80467c:	a8 01                	test   $0x1,%al
+  80467e:	75 06                	jne    804686 <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  804680:	b8 00 00 00 00       	mov    $0x0,%eax
+  804685:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804686:	55                   	push   %rbp
+  804687:	48 89 e5             	mov    %rsp,%rbp
+  80468a:	41 57                	push   %r15
+  80468c:	41 56                	push   %r14
+  80468e:	41 55                	push   %r13
+  804690:	41 54                	push   %r12
+  804692:	53                   	push   %rbx
+  804693:	48 83 ec 28          	sub    $0x28,%rsp
+  804697:	49 89 fe             	mov    %rdi,%r14
+  80469a:	49 89 f7             	mov    %rsi,%r15
+  80469d:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  8046a4:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  8046a5:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  8046ac:	01 00 00 
+  8046af:	e9 ae 00 00 00       	jmp    804762 <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  8046b4:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8046bb:	49 83 ec 01          	sub    $0x1,%r12
+  8046bf:	74 2d                	je     8046ee <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  8046c1:	48 89 d8             	mov    %rbx,%rax
+  8046c4:	48 c1 e8 0c          	shr    $0xc,%rax
+  8046c8:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  8046cd:	f6 c2 01             	test   $0x1,%dl
+  8046d0:	74 e2                	je     8046b4 <foreach_shared_region+0x42>
+  8046d2:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8046d7:	f6 c4 04             	test   $0x4,%ah
+  8046da:	74 d8                	je     8046b4 <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  8046dc:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8046e3:	4c 89 fa             	mov    %r15,%rdx
+  8046e6:	48 89 df             	mov    %rbx,%rdi
+  8046e9:	41 ff d6             	call   *%r14
+  8046ec:	eb c6                	jmp    8046b4 <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  8046ee:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  8046f5:	00 
+  8046f6:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  8046fb:	74 4a                	je     804747 <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  8046fd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804701:	48 c1 e8 15          	shr    $0x15,%rax
+  804705:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  80470c:	01 00 00 
+  80470f:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804713:	a8 01                	test   $0x1,%al
+  804715:	74 d7                	je     8046ee <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  804717:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  80471b:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  804722:	48 39 c3             	cmp    %rax,%rbx
+  804725:	73 c7                	jae    8046ee <foreach_shared_region+0x7c>
+  804727:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  80472e:	48 39 d0             	cmp    %rdx,%rax
+  804731:	4d 19 e4             	sbb    %r12,%r12
+  804734:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  80473b:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  804742:	e9 7a ff ff ff       	jmp    8046c1 <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  804747:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  80474e:	40 
+  80474f:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804753:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80475a:	00 00 00 
+  80475d:	48 39 c1             	cmp    %rax,%rcx
+  804760:	74 50                	je     8047b2 <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  804762:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804766:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80476a:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  804771:	01 00 00 
+  804774:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804778:	a8 01                	test   $0x1,%al
+  80477a:	74 cb                	je     804747 <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  80477c:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804780:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  804787:	48 39 c1             	cmp    %rax,%rcx
+  80478a:	73 bb                	jae    804747 <foreach_shared_region+0xd5>
+  80478c:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  804793:	48 39 d0             	cmp    %rdx,%rax
+  804796:	48 19 c0             	sbb    %rax,%rax
+  804799:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  80479f:	48 05 00 02 00 00    	add    $0x200,%rax
+  8047a5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8047a9:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8047ad:	e9 4b ff ff ff       	jmp    8046fd <foreach_shared_region+0x8b>
+  8047b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047b7:	48 83 c4 28          	add    $0x28,%rsp
+  8047bb:	5b                   	pop    %rbx
+  8047bc:	41 5c                	pop    %r12
+  8047be:	41 5d                	pop    %r13
+  8047c0:	41 5e                	pop    %r14
+  8047c2:	41 5f                	pop    %r15
+  8047c4:	5d                   	pop    %rbp
+  8047c5:	c3                   	ret
+
+00000000008047c6 <ring_enter>:
+    }
+}
+#endif
+
+static int
+ring_enter(void) {
+  8047c6:	55                   	push   %rbp
+  8047c7:	48 89 e5             	mov    %rsp,%rbp
+    int res;
+
+    /* Forked children inherit the ring but not its registration */
+    if (thisenv->env_sc_ring != &ring &&
+  8047ca:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8047d1:	00 00 00 
+  8047d4:	48 8b 90 c0 01 00 00 	mov    0x1c0(%rax),%rdx
+  8047db:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8047e2:	00 00 00 
+  8047e5:	48 39 c2             	cmp    %rax,%rdx
+  8047e8:	74 13                	je     8047fd <ring_enter+0x37>
+        (res = sys_ring_register(&ring)) < 0) goto out;
+  8047ea:	48 89 c7             	mov    %rax,%rdi
+  8047ed:	48 b8 39 14 80 00 00 	movabs $0x801439,%rax
+  8047f4:	00 00 00 
+  8047f7:	ff d0                	call   *%rax
+    if (thisenv->env_sc_ring != &ring &&
+  8047f9:	85 c0                	test   %eax,%eax
+  8047fb:	78 0c                	js     804809 <ring_enter+0x43>
+
+#ifdef SANITIZE_USER_SHADOW_BASE
+    uint32_t head = ring.sr_head;
+#endif
+
+    res = sys_ring_enter();
+  8047fd:	48 b8 99 14 80 00 00 	movabs $0x801499,%rax
+  804804:	00 00 00 
+  804807:	ff d0                	call   *%rax
+    }
+#endif
+
+out:
+    /* Calls queued after the failed one are dropped */
+    ring.sr_tail = ring.sr_head;
+  804809:	48 ba 40 10 84 00 00 	movabs $0x841040,%rdx
+  804810:	00 00 00 
+  804813:	8b 0a                	mov    (%rdx),%ecx
+  804815:	89 4a 04             	mov    %ecx,0x4(%rdx)
+    return res;
+}
+  804818:	5d                   	pop    %rbp
+  804819:	c3                   	ret
+
+000000000080481a <scring_push>:
+
+/* Queue system call num, the ring is submitted
+ * automatically when it is full. Errors are reported
+ * by scring_submit(), calls queued after an error are dropped */
+void
+scring_push(uintptr_t num, uintptr_t a1, uintptr_t a2, uintptr_t a3, uintptr_t a4, uintptr_t a5, uintptr_t a6) {
+  80481a:	55                   	push   %rbp
+  80481b:	48 89 e5             	mov    %rsp,%rbp
+  80481e:	41 57                	push   %r15
+  804820:	41 56                	push   %r14
+  804822:	41 55                	push   %r13
+  804824:	41 54                	push   %r12
+  804826:	53                   	push   %rbx
+  804827:	48 83 ec 18          	sub    $0x18,%rsp
+  80482b:	4c 89 4d c8          	mov    %r9,-0x38(%rbp)
+    if (pending_error) return;
+  80482f:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  804836:	00 00 00 
+  804839:	83 38 00             	cmpl   $0x0,(%rax)
+  80483c:	75 69                	jne    8048a7 <scring_push+0x8d>
+  80483e:	49 89 ff             	mov    %rdi,%r15
+  804841:	49 89 f6             	mov    %rsi,%r14
+  804844:	49 89 d5             	mov    %rdx,%r13
+  804847:	49 89 cc             	mov    %rcx,%r12
+  80484a:	4c 89 c3             	mov    %r8,%rbx
+    if (ring.sr_tail - ring.sr_head == SCRING_SIZE &&
+  80484d:	48 ba 40 10 84 00 00 	movabs $0x841040,%rdx
+  804854:	00 00 00 
+  804857:	8b 42 04             	mov    0x4(%rdx),%eax
+  80485a:	8b 12                	mov    (%rdx),%edx
+  80485c:	29 d0                	sub    %edx,%eax
+  80485e:	83 f8 20             	cmp    $0x20,%eax
+  804861:	74 53                	je     8048b6 <scring_push+0x9c>
+        (pending_error = ring_enter()) < 0) return;
+
+    struct SyscallDesc *sd = &ring.sr_desc[ring.sr_tail % SCRING_SIZE];
+  804863:	48 ba 40 10 84 00 00 	movabs $0x841040,%rdx
+  80486a:	00 00 00 
+  80486d:	8b 42 04             	mov    0x4(%rdx),%eax
+    sd->sd_num = num;
+  804870:	83 e0 1f             	and    $0x1f,%eax
+  804873:	48 c1 e0 06          	shl    $0x6,%rax
+  804877:	48 01 d0             	add    %rdx,%rax
+  80487a:	4c 89 78 08          	mov    %r15,0x8(%rax)
+    sd->sd_args[0] = a1;
+  80487e:	4c 89 70 10          	mov    %r14,0x10(%rax)
+    sd->sd_args[1] = a2;
+  804882:	4c 89 68 18          	mov    %r13,0x18(%rax)
+    sd->sd_args[2] = a3;
+  804886:	4c 89 60 20          	mov    %r12,0x20(%rax)
+    sd->sd_args[3] = a4;
+  80488a:	48 89 58 28          	mov    %rbx,0x28(%rax)
+    sd->sd_args[4] = a5;
+  80488e:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  804892:	48 89 58 30          	mov    %rbx,0x30(%rax)
+    sd->sd_args[5] = a6;
+  804896:	48 8b 4d 10          	mov    0x10(%rbp),%rcx
+  80489a:	48 89 48 38          	mov    %rcx,0x38(%rax)
+    ring.sr_tail++;
+  80489e:	8b 42 04             	mov    0x4(%rdx),%eax
+  8048a1:	83 c0 01             	add    $0x1,%eax
+  8048a4:	89 42 04             	mov    %eax,0x4(%rdx)
+}
+  8048a7:	48 83 c4 18          	add    $0x18,%rsp
+  8048ab:	5b                   	pop    %rbx
+  8048ac:	41 5c                	pop    %r12
+  8048ae:	41 5d                	pop    %r13
+  8048b0:	41 5e                	pop    %r14
+  8048b2:	41 5f                	pop    %r15
+  8048b4:	5d                   	pop    %rbp
+  8048b5:	c3                   	ret
+        (pending_error = ring_enter()) < 0) return;
+  8048b6:	48 b8 c6 47 80 00 00 	movabs $0x8047c6,%rax
+  8048bd:	00 00 00 
+  8048c0:	ff d0                	call   *%rax
+  8048c2:	a3 00 10 84 00 00 00 	movabs %eax,0x841000
+  8048c9:	00 00 
+    if (ring.sr_tail - ring.sr_head == SCRING_SIZE &&
+  8048cb:	85 c0                	test   %eax,%eax
+  8048cd:	79 94                	jns    804863 <scring_push+0x49>
+  8048cf:	eb d6                	jmp    8048a7 <scring_push+0x8d>
+
+00000000008048d1 <scring_submit>:
+
+/* Execute all queued calls.
+ * Returns 0 on success or the error of the first failed call */
+int
+scring_submit(void) {
+    int res = pending_error;
+  8048d1:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  8048d8:	00 00 00 
+  8048db:	8b 02                	mov    (%rdx),%eax
+    pending_error = 0;
+  8048dd:	c7 02 00 00 00 00    	movl   $0x0,(%rdx)
+
+    if (res < 0)
+  8048e3:	85 c0                	test   %eax,%eax
+  8048e5:	78 14                	js     8048fb <scring_submit+0x2a>
+        ring.sr_tail = ring.sr_head;
+    else if (ring.sr_tail != ring.sr_head)
+  8048e7:	48 ba 40 10 84 00 00 	movabs $0x841040,%rdx
+  8048ee:	00 00 00 
+  8048f1:	8b 4a 04             	mov    0x4(%rdx),%ecx
+  8048f4:	8b 12                	mov    (%rdx),%edx
+  8048f6:	39 d1                	cmp    %edx,%ecx
+  8048f8:	75 11                	jne    80490b <scring_submit+0x3a>
+        res = ring_enter();
+
+    return res;
+}
+  8048fa:	c3                   	ret
+        ring.sr_tail = ring.sr_head;
+  8048fb:	48 ba 40 10 84 00 00 	movabs $0x841040,%rdx
+  804902:	00 00 00 
+  804905:	8b 0a                	mov    (%rdx),%ecx
+  804907:	89 4a 04             	mov    %ecx,0x4(%rdx)
+  80490a:	c3                   	ret
+scring_submit(void) {
+  80490b:	55                   	push   %rbp
+  80490c:	48 89 e5             	mov    %rsp,%rbp
+        res = ring_enter();
+  80490f:	48 b8 c6 47 80 00 00 	movabs $0x8047c6,%rax
+  804916:	00 00 00 
+  804919:	ff d0                	call   *%rax
+}
+  80491b:	5d                   	pop    %rbp
+  80491c:	c3                   	ret
+
+000000000080491d <scring_discard>:
+
+/* Drop all queued calls without executing them,
+ * along with an error scring_submit() would report */
+void
+scring_discard(void) {
+    pending_error = 0;
+  80491d:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  804924:	00 00 00 
+  804927:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    ring.sr_tail = ring.sr_head;
+  80492d:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  804934:	00 00 00 
+  804937:	8b 10                	mov    (%rax),%edx
+  804939:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  80493c:	c3                   	ret
+
+000000000080493d <scring_alloc_region>:
+
+void
+scring_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80493d:	55                   	push   %rbp
+  80493e:	48 89 e5             	mov    %rsp,%rbp
+  804941:	48 89 f0             	mov    %rsi,%rax
+    scring_push(SYS_alloc_region, envid, (uintptr_t)va, size, perm, 0, 0);
+  804944:	48 63 f7             	movslq %edi,%rsi
+  804947:	48 83 ec 08          	sub    $0x8,%rsp
+  80494b:	6a 00                	push   $0x0
+  80494d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804953:	4c 63 c1             	movslq %ecx,%r8
+  804956:	48 89 d1             	mov    %rdx,%rcx
+  804959:	48 89 c2             	mov    %rax,%rdx
+  80495c:	bf 04 00 00 00       	mov    $0x4,%edi
+  804961:	48 b8 1a 48 80 00 00 	movabs $0x80481a,%rax
+  804968:	00 00 00 
+  80496b:	ff d0                	call   *%rax
+}
+  80496d:	48 83 c4 10          	add    $0x10,%rsp
+  804971:	c9                   	leave
+  804972:	c3                   	ret
+
+0000000000804973 <scring_map_region>:
+
+void
+scring_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  804973:	55                   	push   %rbp
+  804974:	48 89 e5             	mov    %rsp,%rbp
+  804977:	48 89 f0             	mov    %rsi,%rax
+  80497a:	49 89 ca             	mov    %rcx,%r10
+    scring_push(SYS_map_region, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80497d:	48 63 ca             	movslq %edx,%rcx
+  804980:	48 63 f7             	movslq %edi,%rsi
+  804983:	48 83 ec 08          	sub    $0x8,%rsp
+  804987:	4d 63 c9             	movslq %r9d,%r9
+  80498a:	41 51                	push   %r9
+  80498c:	4d 89 c1             	mov    %r8,%r9
+  80498f:	4d 89 d0             	mov    %r10,%r8
+  804992:	48 89 c2             	mov    %rax,%rdx
+  804995:	bf 05 00 00 00       	mov    $0x5,%edi
+  80499a:	48 b8 1a 48 80 00 00 	movabs $0x80481a,%rax
+  8049a1:	00 00 00 
+  8049a4:	ff d0                	call   *%rax
+}
+  8049a6:	48 83 c4 10          	add    $0x10,%rsp
+  8049aa:	c9                   	leave
+  8049ab:	c3                   	ret
+
+00000000008049ac <scring_unmap_region>:
+
+void
+scring_unmap_region(envid_t envid, void *va, size_t size) {
+  8049ac:	55                   	push   %rbp
+  8049ad:	48 89 e5             	mov    %rsp,%rbp
+  8049b0:	48 89 f0             	mov    %rsi,%rax
+  8049b3:	48 89 d1             	mov    %rdx,%rcx
+    scring_push(SYS_unmap_region, envid, (uintptr_t)va, size, 0, 0, 0);
+  8049b6:	48 63 f7             	movslq %edi,%rsi
+  8049b9:	48 83 ec 08          	sub    $0x8,%rsp
+  8049bd:	6a 00                	push   $0x0
+  8049bf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8049c5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8049cb:	48 89 c2             	mov    %rax,%rdx
+  8049ce:	bf 06 00 00 00       	mov    $0x6,%edi
+  8049d3:	48 b8 1a 48 80 00 00 	movabs $0x80481a,%rax
+  8049da:	00 00 00 
+  8049dd:	ff d0                	call   *%rax
+}
+  8049df:	48 83 c4 10          	add    $0x10,%rsp
+  8049e3:	c9                   	leave
+  8049e4:	c3                   	ret
+
+00000000008049e5 <scring_env_set_status>:
+
+void
+scring_env_set_status(envid_t envid, int status) {
+  8049e5:	55                   	push   %rbp
+  8049e6:	48 89 e5             	mov    %rsp,%rbp
+    scring_push(SYS_env_set_status, envid, status, 0, 0, 0, 0);
+  8049e9:	48 63 d6             	movslq %esi,%rdx
+  8049ec:	48 63 f7             	movslq %edi,%rsi
+  8049ef:	48 83 ec 08          	sub    $0x8,%rsp
+  8049f3:	6a 00                	push   $0x0
+  8049f5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8049fb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804a01:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804a06:	bf 09 00 00 00       	mov    $0x9,%edi
+  804a0b:	48 b8 1a 48 80 00 00 	movabs $0x80481a,%rax
+  804a12:	00 00 00 
+  804a15:	ff d0                	call   *%rax
+}
+  804a17:	48 83 c4 10          	add    $0x10,%rsp
+  804a1b:	c9                   	leave
+  804a1c:	c3                   	ret
+
+0000000000804a1d <scring_env_set_trapframe>:
+
+void
+scring_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  804a1d:	55                   	push   %rbp
+  804a1e:	48 89 e5             	mov    %rsp,%rbp
+  804a21:	48 89 f2             	mov    %rsi,%rdx
+    scring_push(SYS_env_set_trapframe, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  804a24:	48 63 f7             	movslq %edi,%rsi
+  804a27:	48 83 ec 08          	sub    $0x8,%rsp
+  804a2b:	6a 00                	push   $0x0
+  804a2d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804a33:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804a39:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804a3e:	bf 0a 00 00 00       	mov    $0xa,%edi
+  804a43:	48 b8 1a 48 80 00 00 	movabs $0x80481a,%rax
+  804a4a:	00 00 00 
+  804a4d:	ff d0                	call   *%rax
+}
+  804a4f:	48 83 c4 10          	add    $0x10,%rsp
+  804a53:	c9                   	leave
+  804a54:	c3                   	ret
+
+0000000000804a55 <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  804a55:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  804a5b:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  804a62:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  804a69:	c3                   	ret
+
+0000000000804a6a <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  804a6a:	8b 47 40             	mov    0x40(%rdi),%eax
+  804a6d:	8b 17                	mov    (%rdi),%edx
+  804a6f:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  804a71:	83 f8 0f             	cmp    $0xf,%eax
+  804a74:	77 13                	ja     804a89 <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  804a76:	8b 47 40             	mov    0x40(%rdi),%eax
+  804a79:	83 e0 0f             	and    $0xf,%eax
+  804a7c:	48 c1 e0 09          	shl    $0x9,%rax
+  804a80:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  804a87:	00 
+  804a88:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  804a89:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804a8e:	c3                   	ret
+
+0000000000804a8f <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  804a8f:	8b 47 40             	mov    0x40(%rdi),%eax
+  804a92:	83 c0 01             	add    $0x1,%eax
+  804a95:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  804a98:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  804a9e:	8b 57 04             	mov    0x4(%rdi),%edx
+  804aa1:	b8 00 00 00 00       	mov    $0x0,%eax
+  804aa6:	85 d2                	test   %edx,%edx
+  804aa8:	75 04                	jne    804aae <chan_publish+0x1f>
+  804aaa:	83 e0 01             	and    $0x1,%eax
+}
+  804aad:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  804aae:	87 47 04             	xchg   %eax,0x4(%rdi)
+  804ab1:	85 c0                	test   %eax,%eax
+  804ab3:	0f 95 c0             	setne  %al
+  804ab6:	0f b6 c0             	movzbl %al,%eax
+  804ab9:	eb ef                	jmp    804aaa <chan_publish+0x1b>
+
+0000000000804abb <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  804abb:	8b 47 40             	mov    0x40(%rdi),%eax
+  804abe:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  804ac0:	29 d0                	sub    %edx,%eax
+  804ac2:	83 e8 01             	sub    $0x1,%eax
+  804ac5:	83 f8 0f             	cmp    $0xf,%eax
+  804ac8:	77 12                	ja     804adc <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  804aca:	8b 07                	mov    (%rdi),%eax
+  804acc:	83 e0 0f             	and    $0xf,%eax
+  804acf:	48 c1 e0 09          	shl    $0x9,%rax
+  804ad3:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  804ada:	00 
+  804adb:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  804adc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804ae1:	c3                   	ret
+
+0000000000804ae2 <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  804ae2:	8b 07                	mov    (%rdi),%eax
+  804ae4:	83 c0 01             	add    $0x1,%eax
+  804ae7:	89 07                	mov    %eax,(%rdi)
+}
+  804ae9:	c3                   	ret
+
+0000000000804aea <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  804aea:	55                   	push   %rbp
+  804aeb:	48 89 e5             	mov    %rsp,%rbp
+  804aee:	53                   	push   %rbx
+  804aef:	48 83 ec 08          	sub    $0x8,%rsp
+  804af3:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  804af6:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  804afd:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  804b03:	48 b8 bb 4a 80 00 00 	movabs $0x804abb,%rax
+  804b0a:	00 00 00 
+  804b0d:	ff d0                	call   *%rax
+  804b0f:	48 85 c0             	test   %rax,%rax
+  804b12:	74 12                	je     804b26 <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  804b14:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  804b1b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804b20:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804b24:	c9                   	leave
+  804b25:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  804b26:	b8 01 00 00 00       	mov    $0x1,%eax
+  804b2b:	eb f3                	jmp    804b20 <chan_arm+0x36>
+
+0000000000804b2d <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  804b2d:	55                   	push   %rbp
+  804b2e:	48 89 e5             	mov    %rsp,%rbp
+  804b31:	41 56                	push   %r14
+  804b33:	41 55                	push   %r13
+  804b35:	41 54                	push   %r12
+  804b37:	53                   	push   %rbx
+  804b38:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  804b3b:	49 bc ea 4a 80 00 00 	movabs $0x804aea,%r12
+  804b42:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  804b45:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  804b49:	49 bd c2 14 80 00 00 	movabs $0x8014c2,%r13
+  804b50:	00 00 00 
+    while (chan_arm(r))
+  804b53:	eb 0d                	jmp    804b62 <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  804b55:	8b 33                	mov    (%rbx),%esi
+  804b57:	ba 00 00 00 00       	mov    $0x0,%edx
+  804b5c:	4c 89 f7             	mov    %r14,%rdi
+  804b5f:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  804b62:	48 89 df             	mov    %rbx,%rdi
+  804b65:	41 ff d4             	call   *%r12
+  804b68:	84 c0                	test   %al,%al
+  804b6a:	75 e9                	jne    804b55 <chan_wait+0x28>
+}
+  804b6c:	5b                   	pop    %rbx
+  804b6d:	41 5c                	pop    %r12
+  804b6f:	41 5d                	pop    %r13
+  804b71:	41 5e                	pop    %r14
+  804b73:	5d                   	pop    %rbp
+  804b74:	c3                   	ret
+
+0000000000804b75 <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  804b75:	55                   	push   %rbp
+  804b76:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  804b79:	48 83 c7 40          	add    $0x40,%rdi
+  804b7d:	be 01 00 00 00       	mov    $0x1,%esi
+  804b82:	48 b8 e0 14 80 00 00 	movabs $0x8014e0,%rax
+  804b89:	00 00 00 
+  804b8c:	ff d0                	call   *%rax
+}
+  804b8e:	5d                   	pop    %rbp
+  804b8f:	c3                   	ret
+
+0000000000804b90 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804b90:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b95:	c3                   	ret
+
+0000000000804b96 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804b96:	55                   	push   %rbp
+  804b97:	48 89 e5             	mov    %rsp,%rbp
+  804b9a:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804b9d:	48 be 4c 5a 80 00 00 	movabs $0x805a4c,%rsi
+  804ba4:	00 00 00 
+  804ba7:	48 b8 f5 0b 80 00 00 	movabs $0x800bf5,%rax
+  804bae:	00 00 00 
+  804bb1:	ff d0                	call   *%rax
+    return 0;
+}
+  804bb3:	b8 00 00 00 00       	mov    $0x0,%eax
+  804bb8:	5d                   	pop    %rbp
+  804bb9:	c3                   	ret
+
+0000000000804bba <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804bba:	55                   	push   %rbp
+  804bbb:	48 89 e5             	mov    %rsp,%rbp
+  804bbe:	41 57                	push   %r15
+  804bc0:	41 56                	push   %r14
+  804bc2:	41 55                	push   %r13
+  804bc4:	41 54                	push   %r12
+  804bc6:	53                   	push   %rbx
+  804bc7:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  804bce:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  804bd5:	48 85 d2             	test   %rdx,%rdx
+  804bd8:	74 7a                	je     804c54 <devcons_write+0x9a>
+  804bda:	49 89 d6             	mov    %rdx,%r14
+  804bdd:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804be3:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  804be8:	49 bf ef 0d 80 00 00 	movabs $0x800def,%r15
+  804bef:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804bf2:	4c 89 f3             	mov    %r14,%rbx
+  804bf5:	48 29 f3             	sub    %rsi,%rbx
+  804bf8:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804bfd:	48 39 c3             	cmp    %rax,%rbx
+  804c00:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804c04:	4c 63 eb             	movslq %ebx,%r13
+  804c07:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804c0e:	48 01 c6             	add    %rax,%rsi
+  804c11:	4c 89 ea             	mov    %r13,%rdx
+  804c14:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804c1b:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  804c1e:	4c 89 ee             	mov    %r13,%rsi
+  804c21:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804c28:	48 b8 1c 10 80 00 00 	movabs $0x80101c,%rax
+  804c2f:	00 00 00 
+  804c32:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804c34:	41 01 dc             	add    %ebx,%r12d
+  804c37:	49 63 f4             	movslq %r12d,%rsi
+  804c3a:	4c 39 f6             	cmp    %r14,%rsi
+  804c3d:	72 b3                	jb     804bf2 <devcons_write+0x38>
+    return res;
+  804c3f:	49 63 c4             	movslq %r12d,%rax
+}
+  804c42:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804c49:	5b                   	pop    %rbx
+  804c4a:	41 5c                	pop    %r12
+  804c4c:	41 5d                	pop    %r13
+  804c4e:	41 5e                	pop    %r14
+  804c50:	41 5f                	pop    %r15
+  804c52:	5d                   	pop    %rbp
+  804c53:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804c54:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804c5a:	eb e3                	jmp    804c3f <devcons_write+0x85>
+
+0000000000804c5c <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804c5c:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804c5f:	ba 00 00 00 00       	mov    $0x0,%edx
+  804c64:	48 85 c0             	test   %rax,%rax
+  804c67:	74 55                	je     804cbe <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804c69:	55                   	push   %rbp
+  804c6a:	48 89 e5             	mov    %rsp,%rbp
+  804c6d:	41 55                	push   %r13
+  804c6f:	41 54                	push   %r12
+  804c71:	53                   	push   %rbx
+  804c72:	48 83 ec 08          	sub    $0x8,%rsp
+  804c76:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  804c79:	48 bb 3b 10 80 00 00 	movabs $0x80103b,%rbx
+  804c80:	00 00 00 
+  804c83:	49 bc f0 10 80 00 00 	movabs $0x8010f0,%r12
+  804c8a:	00 00 00 
+  804c8d:	eb 03                	jmp    804c92 <devcons_read+0x36>
+  804c8f:	41 ff d4             	call   *%r12
+  804c92:	ff d3                	call   *%rbx
+  804c94:	85 c0                	test   %eax,%eax
+  804c96:	74 f7                	je     804c8f <devcons_read+0x33>
+    if (c < 0) return c;
+  804c98:	48 63 d0             	movslq %eax,%rdx
+  804c9b:	78 13                	js     804cb0 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  804c9d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804ca2:	83 f8 04             	cmp    $0x4,%eax
+  804ca5:	74 09                	je     804cb0 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  804ca7:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804cab:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804cb0:	48 89 d0             	mov    %rdx,%rax
+  804cb3:	48 83 c4 08          	add    $0x8,%rsp
+  804cb7:	5b                   	pop    %rbx
+  804cb8:	41 5c                	pop    %r12
+  804cba:	41 5d                	pop    %r13
+  804cbc:	5d                   	pop    %rbp
+  804cbd:	c3                   	ret
+  804cbe:	48 89 d0             	mov    %rdx,%rax
+  804cc1:	c3                   	ret
+
+0000000000804cc2 <cputchar>:
+cputchar(int ch) {
+  804cc2:	55                   	push   %rbp
+  804cc3:	48 89 e5             	mov    %rsp,%rbp
+  804cc6:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  804cca:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  804cce:	be 01 00 00 00       	mov    $0x1,%esi
+  804cd3:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  804cd7:	48 b8 1c 10 80 00 00 	movabs $0x80101c,%rax
+  804cde:	00 00 00 
+  804ce1:	ff d0                	call   *%rax
+}
+  804ce3:	c9                   	leave
+  804ce4:	c3                   	ret
+
+0000000000804ce5 <getchar>:
+getchar(void) {
+  804ce5:	55                   	push   %rbp
+  804ce6:	48 89 e5             	mov    %rsp,%rbp
+  804ce9:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  804ced:	ba 01 00 00 00       	mov    $0x1,%edx
+  804cf2:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  804cf6:	bf 00 00 00 00       	mov    $0x0,%edi
+  804cfb:	48 b8 f8 18 80 00 00 	movabs $0x8018f8,%rax
+  804d02:	00 00 00 
+  804d05:	ff d0                	call   *%rax
+  804d07:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  804d09:	85 c0                	test   %eax,%eax
+  804d0b:	78 06                	js     804d13 <getchar+0x2e>
+  804d0d:	74 08                	je     804d17 <getchar+0x32>
+  804d0f:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804d13:	89 d0                	mov    %edx,%eax
+  804d15:	c9                   	leave
+  804d16:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  804d17:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  804d1c:	eb f5                	jmp    804d13 <getchar+0x2e>
+
+0000000000804d1e <iscons>:
+iscons(int fdnum) {
+  804d1e:	55                   	push   %rbp
+  804d1f:	48 89 e5             	mov    %rsp,%rbp
+  804d22:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804d26:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804d2a:	48 b8 15 16 80 00 00 	movabs $0x801615,%rax
+  804d31:	00 00 00 
+  804d34:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804d36:	85 c0                	test   %eax,%eax
+  804d38:	78 18                	js     804d52 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  804d3a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804d3e:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  804d45:	00 00 00 
+  804d48:	8b 00                	mov    (%rax),%eax
+  804d4a:	39 02                	cmp    %eax,(%rdx)
+  804d4c:	0f 94 c0             	sete   %al
+  804d4f:	0f b6 c0             	movzbl %al,%eax
+}
+  804d52:	c9                   	leave
+  804d53:	c3                   	ret
+
+0000000000804d54 <opencons>:
+opencons(void) {
+  804d54:	55                   	push   %rbp
+  804d55:	48 89 e5             	mov    %rsp,%rbp
+  804d58:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  804d5c:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  804d60:	48 b8 b5 15 80 00 00 	movabs $0x8015b5,%rax
+  804d67:	00 00 00 
+  804d6a:	ff d0                	call   *%rax
+  804d6c:	85 c0                	test   %eax,%eax
+  804d6e:	78 49                	js     804db9 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  804d70:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804d75:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804d7a:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  804d7e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d83:	48 b8 54 11 80 00 00 	movabs $0x801154,%rax
+  804d8a:	00 00 00 
+  804d8d:	ff d0                	call   *%rax
+  804d8f:	85 c0                	test   %eax,%eax
+  804d91:	78 26                	js     804db9 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  804d93:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804d97:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  804d9e:	00 00 
+  804da0:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  804da2:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804da6:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  804dad:	48 b8 87 15 80 00 00 	movabs $0x801587,%rax
+  804db4:	00 00 00 
+  804db7:	ff d0                	call   *%rax
+}
+  804db9:	c9                   	leave
+  804dba:	c3                   	ret
+
+0000000000804dbb <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  804dbb:	55                   	push   %rbp
+  804dbc:	48 89 e5             	mov    %rsp,%rbp
+  804dbf:	41 56                	push   %r14
+  804dc1:	41 55                	push   %r13
+  804dc3:	41 54                	push   %r12
+  804dc5:	53                   	push   %rbx
+  804dc6:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804dc9:	48 b8 a8 18 84 00 00 	movabs $0x8418a8,%rax
+  804dd0:	00 00 00 
+  804dd3:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804dd7:	74 27                	je     804e00 <_handle_vectored_pagefault+0x45>
+  804dd9:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  804dde:	49 bd 60 18 84 00 00 	movabs $0x841860,%r13
+  804de5:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804de8:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  804deb:	4c 89 e7             	mov    %r12,%rdi
+  804dee:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  804df3:	84 c0                	test   %al,%al
+  804df5:	75 45                	jne    804e3c <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804df7:	48 83 c3 01          	add    $0x1,%rbx
+  804dfb:	49 3b 1e             	cmp    (%r14),%rbx
+  804dfe:	72 eb                	jb     804deb <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  804e00:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  804e07:	00 
+  804e08:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  804e0d:	4d 8b 04 24          	mov    (%r12),%r8
+  804e11:	48 ba 58 5a 80 00 00 	movabs $0x805a58,%rdx
+  804e18:	00 00 00 
+  804e1b:	be 1d 00 00 00       	mov    $0x1d,%esi
+  804e20:	48 bf 88 5a 80 00 00 	movabs $0x805a88,%rdi
+  804e27:	00 00 00 
+  804e2a:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e2f:	49 ba 80 01 80 00 00 	movabs $0x800180,%r10
+  804e36:	00 00 00 
+  804e39:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  804e3c:	5b                   	pop    %rbx
+  804e3d:	41 5c                	pop    %r12
+  804e3f:	41 5d                	pop    %r13
+  804e41:	41 5e                	pop    %r14
+  804e43:	5d                   	pop    %rbp
+  804e44:	c3                   	ret
+
+0000000000804e45 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  804e45:	55                   	push   %rbp
+  804e46:	48 89 e5             	mov    %rsp,%rbp
+  804e49:	53                   	push   %rbx
+  804e4a:	48 83 ec 08          	sub    $0x8,%rsp
+  804e4e:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  804e51:	48 b8 a0 18 84 00 00 	movabs $0x8418a0,%rax
+  804e58:	00 00 00 
+  804e5b:	80 38 00             	cmpb   $0x0,(%rax)
+  804e5e:	0f 84 84 00 00 00    	je     804ee8 <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804e64:	48 b8 a8 18 84 00 00 	movabs $0x8418a8,%rax
+  804e6b:	00 00 00 
+  804e6e:	48 8b 10             	mov    (%rax),%rdx
+  804e71:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  804e76:	48 b9 60 18 84 00 00 	movabs $0x841860,%rcx
+  804e7d:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804e80:	48 85 d2             	test   %rdx,%rdx
+  804e83:	74 19                	je     804e9e <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  804e85:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  804e89:	0f 84 e8 00 00 00    	je     804f77 <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804e8f:	48 83 c0 01          	add    $0x1,%rax
+  804e93:	48 39 d0             	cmp    %rdx,%rax
+  804e96:	75 ed                	jne    804e85 <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  804e98:	48 83 fa 08          	cmp    $0x8,%rdx
+  804e9c:	74 1c                	je     804eba <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  804e9e:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  804ea2:	48 a3 a8 18 84 00 00 	movabs %rax,0x8418a8
+  804ea9:	00 00 00 
+  804eac:	48 b8 60 18 84 00 00 	movabs $0x841860,%rax
+  804eb3:	00 00 00 
+  804eb6:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  804eba:	48 b8 c7 10 80 00 00 	movabs $0x8010c7,%rax
+  804ec1:	00 00 00 
+  804ec4:	ff d0                	call   *%rax
+  804ec6:	89 c7                	mov    %eax,%edi
+  804ec8:	48 be 3d 50 80 00 00 	movabs $0x80503d,%rsi
+  804ecf:	00 00 00 
+  804ed2:	48 b8 12 13 80 00 00 	movabs $0x801312,%rax
+  804ed9:	00 00 00 
+  804edc:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  804ede:	85 c0                	test   %eax,%eax
+  804ee0:	78 68                	js     804f4a <add_pgfault_handler+0x105>
+    return res;
+}
+  804ee2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804ee6:	c9                   	leave
+  804ee7:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  804ee8:	48 b8 c7 10 80 00 00 	movabs $0x8010c7,%rax
+  804eef:	00 00 00 
+  804ef2:	ff d0                	call   *%rax
+  804ef4:	89 c7                	mov    %eax,%edi
+  804ef6:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804efb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804f00:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  804f07:	00 00 00 
+  804f0a:	48 b8 54 11 80 00 00 	movabs $0x801154,%rax
+  804f11:	00 00 00 
+  804f14:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  804f16:	48 ba a8 18 84 00 00 	movabs $0x8418a8,%rdx
+  804f1d:	00 00 00 
+  804f20:	48 8b 02             	mov    (%rdx),%rax
+  804f23:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804f27:	48 89 0a             	mov    %rcx,(%rdx)
+  804f2a:	48 ba 60 18 84 00 00 	movabs $0x841860,%rdx
+  804f31:	00 00 00 
+  804f34:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  804f38:	48 b8 a0 18 84 00 00 	movabs $0x8418a0,%rax
+  804f3f:	00 00 00 
+  804f42:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  804f45:	e9 70 ff ff ff       	jmp    804eba <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  804f4a:	89 c1                	mov    %eax,%ecx
+  804f4c:	48 ba 96 5a 80 00 00 	movabs $0x805a96,%rdx
+  804f53:	00 00 00 
+  804f56:	be 3d 00 00 00       	mov    $0x3d,%esi
+  804f5b:	48 bf 88 5a 80 00 00 	movabs $0x805a88,%rdi
+  804f62:	00 00 00 
+  804f65:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f6a:	49 b8 80 01 80 00 00 	movabs $0x800180,%r8
+  804f71:	00 00 00 
+  804f74:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  804f77:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f7c:	e9 61 ff ff ff       	jmp    804ee2 <add_pgfault_handler+0x9d>
+
+0000000000804f81 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  804f81:	55                   	push   %rbp
+  804f82:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  804f85:	48 b8 a0 18 84 00 00 	movabs $0x8418a0,%rax
+  804f8c:	00 00 00 
+  804f8f:	80 38 00             	cmpb   $0x0,(%rax)
+  804f92:	74 33                	je     804fc7 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804f94:	48 a1 a8 18 84 00 00 	movabs 0x8418a8,%rax
+  804f9b:	00 00 00 
+  804f9e:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  804fa3:	48 ba 60 18 84 00 00 	movabs $0x841860,%rdx
+  804faa:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804fad:	48 85 c0             	test   %rax,%rax
+  804fb0:	0f 84 85 00 00 00    	je     80503b <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  804fb6:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  804fba:	74 40                	je     804ffc <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804fbc:	48 83 c1 01          	add    $0x1,%rcx
+  804fc0:	48 39 c1             	cmp    %rax,%rcx
+  804fc3:	75 f1                	jne    804fb6 <remove_pgfault_handler+0x35>
+  804fc5:	eb 74                	jmp    80503b <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  804fc7:	48 b9 ae 5a 80 00 00 	movabs $0x805aae,%rcx
+  804fce:	00 00 00 
+  804fd1:	48 ba d1 59 80 00 00 	movabs $0x8059d1,%rdx
+  804fd8:	00 00 00 
+  804fdb:	be 43 00 00 00       	mov    $0x43,%esi
+  804fe0:	48 bf 88 5a 80 00 00 	movabs $0x805a88,%rdi
+  804fe7:	00 00 00 
+  804fea:	b8 00 00 00 00       	mov    $0x0,%eax
+  804fef:	49 b8 80 01 80 00 00 	movabs $0x800180,%r8
+  804ff6:	00 00 00 
+  804ff9:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  804ffc:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  805003:	00 
+  805004:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  805008:	48 29 ca             	sub    %rcx,%rdx
+  80500b:	48 b8 60 18 84 00 00 	movabs $0x841860,%rax
+  805012:	00 00 00 
+  805015:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  805019:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  80501e:	48 89 ce             	mov    %rcx,%rsi
+  805021:	48 b8 ef 0d 80 00 00 	movabs $0x800def,%rax
+  805028:	00 00 00 
+  80502b:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  80502d:	48 b8 a8 18 84 00 00 	movabs $0x8418a8,%rax
+  805034:	00 00 00 
+  805037:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  80503b:	5d                   	pop    %rbp
+  80503c:	c3                   	ret
+
+000000000080503d <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  80503d:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  805040:	48 b8 bb 4d 80 00 00 	movabs $0x804dbb,%rax
+  805047:	00 00 00 
+    call *%rax
+  80504a:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  80504c:	41 5f                	pop    %r15
+	popq %r15
+  80504e:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  805050:	41 5f                	pop    %r15
+	popq %r14
+  805052:	41 5e                	pop    %r14
+	popq %r13
+  805054:	41 5d                	pop    %r13
+	popq %r12
+  805056:	41 5c                	pop    %r12
+	popq %r11
+  805058:	41 5b                	pop    %r11
+	popq %r10
+  80505a:	41 5a                	pop    %r10
+	popq %r9
+  80505c:	41 59                	pop    %r9
+	popq %r8
+  80505e:	41 58                	pop    %r8
+	popq %rsi
+  805060:	5e                   	pop    %rsi
+	popq %rdi
+  805061:	5f                   	pop    %rdi
+	popq %rbp
+  805062:	5d                   	pop    %rbp
+	popq %rdx
+  805063:	5a                   	pop    %rdx
+	popq %rcx
+  805064:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  805065:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  80506a:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  80506f:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  805073:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  805076:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  80507b:	5b                   	pop    %rbx
+	popq %rax
+  80507c:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  80507d:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  805081:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  805082:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  805087:	c3                   	ret
+
+0000000000805088 <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  805088:	55                   	push   %rbp
+  805089:	48 89 e5             	mov    %rsp,%rbp
+  80508c:	41 55                	push   %r13
+  80508e:	41 54                	push   %r12
+  805090:	53                   	push   %rbx
+  805091:	48 83 ec 08          	sub    $0x8,%rsp
+  805095:	49 89 fd             	mov    %rdi,%r13
+  805098:	48 89 f7             	mov    %rsi,%rdi
+  80509b:	48 89 d3             	mov    %rdx,%rbx
+  80509e:	49 89 cc             	mov    %rcx,%r12
+  8050a1:	4c 89 c2             	mov    %r8,%rdx
+  8050a4:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8050a7:	48 85 f6             	test   %rsi,%rsi
+  8050aa:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8050b1:	00 00 00 
+  8050b4:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  8050b8:	be 00 10 00 00       	mov    $0x1000,%esi
+  8050bd:	48 85 db             	test   %rbx,%rbx
+  8050c0:	74 03                	je     8050c5 <ipc_recv_futex+0x3d>
+  8050c2:	48 8b 33             	mov    (%rbx),%rsi
+  8050c5:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  8050c9:	48 b8 9e 13 80 00 00 	movabs $0x80139e,%rax
+  8050d0:	00 00 00 
+  8050d3:	ff d0                	call   *%rax
+    if (res < 0) {
+  8050d5:	85 c0                	test   %eax,%eax
+  8050d7:	78 75                	js     80514e <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  8050d9:	4d 85 ed             	test   %r13,%r13
+  8050dc:	74 14                	je     8050f2 <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  8050de:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8050e5:	00 00 00 
+  8050e8:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  8050ee:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  8050f2:	4d 85 e4             	test   %r12,%r12
+  8050f5:	74 14                	je     80510b <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  8050f7:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8050fe:	00 00 00 
+  805101:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  805107:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  80510b:	48 85 db             	test   %rbx,%rbx
+  80510e:	74 23                	je     805133 <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  805110:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  805117:	00 00 00 
+  80511a:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  805120:	ba 00 00 00 00       	mov    $0x0,%edx
+  805125:	85 c9                	test   %ecx,%ecx
+  805127:	74 07                	je     805130 <ipc_recv_futex+0xa8>
+  805129:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  805130:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  805133:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80513a:	00 00 00 
+  80513d:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  805143:	48 83 c4 08          	add    $0x8,%rsp
+  805147:	5b                   	pop    %rbx
+  805148:	41 5c                	pop    %r12
+  80514a:	41 5d                	pop    %r13
+  80514c:	5d                   	pop    %rbp
+  80514d:	c3                   	ret
+        if (from_env_store != NULL) {
+  80514e:	4d 85 ed             	test   %r13,%r13
+  805151:	74 08                	je     80515b <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  805153:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80515a:	00 
+        if (perm_store != NULL) {
+  80515b:	4d 85 e4             	test   %r12,%r12
+  80515e:	74 08                	je     805168 <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  805160:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  805167:	00 
+        if (size != NULL) {
+  805168:	48 85 db             	test   %rbx,%rbx
+  80516b:	74 d6                	je     805143 <ipc_recv_futex+0xbb>
+            *size = 0;
+  80516d:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  805174:	eb cd                	jmp    805143 <ipc_recv_futex+0xbb>
+
+0000000000805176 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  805176:	55                   	push   %rbp
+  805177:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  80517a:	48 83 ec 08          	sub    $0x8,%rsp
+  80517e:	6a 00                	push   $0x0
+  805180:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  805186:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80518c:	48 b8 88 50 80 00 00 	movabs $0x805088,%rax
+  805193:	00 00 00 
+  805196:	ff d0                	call   *%rax
+}
+  805198:	c9                   	leave
+  805199:	c3                   	ret
+
+000000000080519a <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80519a:	55                   	push   %rbp
+  80519b:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80519e:	48 85 d2             	test   %rdx,%rdx
+  8051a1:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8051a8:	00 00 00 
+  8051ab:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  8051af:	89 f6                	mov    %esi,%esi
+  8051b1:	48 b8 87 13 80 00 00 	movabs $0x801387,%rax
+  8051b8:	00 00 00 
+  8051bb:	ff d0                	call   *%rax
+    if (res < 0) {
+  8051bd:	85 c0                	test   %eax,%eax
+  8051bf:	78 02                	js     8051c3 <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  8051c1:	5d                   	pop    %rbp
+  8051c2:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  8051c3:	89 c1                	mov    %eax,%ecx
+  8051c5:	48 ba c8 5a 80 00 00 	movabs $0x805ac8,%rdx
+  8051cc:	00 00 00 
+  8051cf:	be 50 00 00 00       	mov    $0x50,%esi
+  8051d4:	48 bf dc 5a 80 00 00 	movabs $0x805adc,%rdi
+  8051db:	00 00 00 
+  8051de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051e3:	49 b8 80 01 80 00 00 	movabs $0x800180,%r8
+  8051ea:	00 00 00 
+  8051ed:	41 ff d0             	call   *%r8
+
+00000000008051f0 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8051f0:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  8051f5:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8051fc:	00 00 00 
+  8051ff:	48 89 d0             	mov    %rdx,%rax
+  805202:	48 c1 e0 04          	shl    $0x4,%rax
+  805206:	48 29 d0             	sub    %rdx,%rax
+  805209:	48 c1 e0 05          	shl    $0x5,%rax
+  80520d:	48 01 c8             	add    %rcx,%rax
+  805210:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  805216:	39 f8                	cmp    %edi,%eax
+  805218:	74 13                	je     80522d <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  80521a:	48 83 c2 01          	add    $0x1,%rdx
+  80521e:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  805225:	75 d8                	jne    8051ff <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  805227:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80522c:	c3                   	ret
+            return envs[i].env_id;
+  80522d:	48 89 d0             	mov    %rdx,%rax
+  805230:	48 c1 e0 04          	shl    $0x4,%rax
+  805234:	48 29 d0             	sub    %rdx,%rax
+  805237:	48 c1 e0 05          	shl    $0x5,%rax
+  80523b:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  805242:	00 00 00 
+  805245:	48 01 d0             	add    %rdx,%rax
+  805248:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80524e:	c3                   	ret
+  80524f:	90                   	nop
+
+0000000000805250 <__rodata_start>:
+  805250:	69 20 61 6d 20 70    	imul   $0x70206d61,(%rax),%esp
+  805256:	61                   	(bad)
+  805257:	72 65                	jb     8052be <__rodata_start+0x6e>
+  805259:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80525a:	74 20                	je     80527c <__rodata_start+0x2c>
+  80525c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80525e:	76 69                	jbe    8052c9 <__rodata_start+0x79>
+  805260:	72 6f                	jb     8052d1 <__rodata_start+0x81>
+  805262:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805263:	6d                   	insl   (%dx),%es:(%rdi)
+  805264:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  805266:	74 20                	je     805288 <__rodata_start+0x38>
+  805268:	25 30 38 78 0a       	and    $0xa783830,%eax
+  80526d:	00 68 65             	add    %ch,0x65(%rax)
+  805270:	6c                   	insb   (%dx),%es:(%rdi)
+  805271:	6c                   	insb   (%dx),%es:(%rdi)
+  805272:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805273:	00 73 70             	add    %dh,0x70(%rbx)
+  805276:	61                   	(bad)
+  805277:	77 6e                	ja     8052e7 <__rodata_start+0x97>
+  805279:	28 68 65             	sub    %ch,0x65(%rax)
+  80527c:	6c                   	insb   (%dx),%es:(%rdi)
+  80527d:	6c                   	insb   (%dx),%es:(%rdi)
+  80527e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80527f:	29 20                	sub    %esp,(%rax)
+  805281:	66 61                	data16 (bad)
+  805283:	69 6c 65 64 3a 20 25 	imul   $0x6925203a,0x64(%rbp,%riz,2),%ebp
+  80528a:	69 
+  80528b:	00 75 73             	add    %dh,0x73(%rbp)
+  80528e:	65 72 2f             	gs jb  8052c0 <__rodata_start+0x70>
+  805291:	73 70                	jae    805303 <__rodata_start+0xb3>
+  805293:	61                   	(bad)
+  805294:	77 6e                	ja     805304 <__rodata_start+0xb4>
+  805296:	68 65 6c 6c 6f       	push   $0x6f6c6c65
+  80529b:	2e 63 00             	cs movsxd (%rax),%eax
+  80529e:	3c 75                	cmp    $0x75,%al
+  8052a0:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8052a1:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8052a5:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8052a6:	3e 00 5b 25          	ds add %bl,0x25(%rbx)
+  8052aa:	30 38                	xor    %bh,(%rax)
+  8052ac:	78 5d                	js     80530b <__rodata_start+0xbb>
+  8052ae:	20 75 73             	and    %dh,0x73(%rbp)
+  8052b1:	65 72 20             	gs jb  8052d4 <__rodata_start+0x84>
+  8052b4:	70 61                	jo     805317 <__rodata_start+0xc7>
+  8052b6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8052b7:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  8052be:	73 20                	jae    8052e0 <__rodata_start+0x90>
+  8052c0:	61                   	(bad)
+  8052c1:	74 20                	je     8052e3 <__rodata_start+0x93>
+  8052c3:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  8052c8:	3a 20                	cmp    (%rax),%ah
+  8052ca:	00 30                	add    %dh,(%rax)
+  8052cc:	31 32                	xor    %esi,(%rdx)
+  8052ce:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8052d5:	41                   	rex.B
+  8052d6:	42                   	rex.X
+  8052d7:	43                   	rex.XB
+  8052d8:	44                   	rex.R
+  8052d9:	45                   	rex.RB
+  8052da:	46 00 30             	rex.RX add %r14b,(%rax)
+  8052dd:	31 32                	xor    %esi,(%rdx)
+  8052df:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8052e6:	61                   	(bad)
+  8052e7:	62 63 64 65 66       	(bad)
+  8052ec:	00 28                	add    %ch,(%rax)
+  8052ee:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8052ef:	75 6c                	jne    80535d <__rodata_start+0x10d>
+  8052f1:	6c                   	insb   (%dx),%es:(%rdi)
+  8052f2:	29 00                	sub    %eax,(%rax)
+  8052f4:	65 72 72             	gs jb  805369 <__rodata_start+0x119>
+  8052f7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8052f8:	72 20                	jb     80531a <__rodata_start+0xca>
+  8052fa:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  8052ff:	73 70                	jae    805371 <__rodata_start+0x121>
+  805301:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  805305:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  80530c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80530d:	72 00                	jb     80530f <__rodata_start+0xbf>
+  80530f:	62 61 64 20 65       	(bad)
+  805314:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805315:	76 69                	jbe    805380 <__rodata_start+0x130>
+  805317:	72 6f                	jb     805388 <__rodata_start+0x138>
+  805319:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80531a:	6d                   	insl   (%dx),%es:(%rdi)
+  80531b:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80531d:	74 00                	je     80531f <__rodata_start+0xcf>
+  80531f:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  805326:	20 70 61             	and    %dh,0x61(%rax)
+  805329:	72 61                	jb     80538c <__rodata_start+0x13c>
+  80532b:	6d                   	insl   (%dx),%es:(%rdi)
+  80532c:	65 74 65             	gs je  805394 <__rodata_start+0x144>
+  80532f:	72 00                	jb     805331 <__rodata_start+0xe1>
+  805331:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805332:	75 74                	jne    8053a8 <__rodata_start+0x158>
+  805334:	20 6f 66             	and    %ch,0x66(%rdi)
+  805337:	20 6d 65             	and    %ch,0x65(%rbp)
+  80533a:	6d                   	insl   (%dx),%es:(%rdi)
+  80533b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80533c:	72 79                	jb     8053b7 <__rodata_start+0x167>
+  80533e:	00 6f 75             	add    %ch,0x75(%rdi)
+  805341:	74 20                	je     805363 <__rodata_start+0x113>
+  805343:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805344:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  805348:	76 69                	jbe    8053b3 <__rodata_start+0x163>
+  80534a:	72 6f                	jb     8053bb <__rodata_start+0x16b>
+  80534c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80534d:	6d                   	insl   (%dx),%es:(%rdi)
+  80534e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  805350:	74 73                	je     8053c5 <__rodata_start+0x175>
+  805352:	00 63 6f             	add    %ah,0x6f(%rbx)
+  805355:	72 72                	jb     8053c9 <__rodata_start+0x179>
+  805357:	75 70                	jne    8053c9 <__rodata_start+0x179>
+  805359:	74 65                	je     8053c0 <__rodata_start+0x170>
+  80535b:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  805360:	75 67                	jne    8053c9 <__rodata_start+0x179>
+  805362:	20 69 6e             	and    %ch,0x6e(%rcx)
+  805365:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  805367:	00 73 65             	add    %dh,0x65(%rbx)
+  80536a:	67 6d                	insl   (%dx),%es:(%edi)
+  80536c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80536e:	74 61                	je     8053d1 <__rodata_start+0x181>
+  805370:	74 69                	je     8053db <__rodata_start+0x18b>
+  805372:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805373:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805374:	20 66 61             	and    %ah,0x61(%rsi)
+  805377:	75 6c                	jne    8053e5 <__rodata_start+0x195>
+  805379:	74 00                	je     80537b <__rodata_start+0x12b>
+  80537b:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  805382:	20 45 4c             	and    %al,0x4c(%rbp)
+  805385:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  805389:	61                   	(bad)
+  80538a:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  80538f:	20 73 75             	and    %dh,0x75(%rbx)
+  805392:	63 68 20             	movsxd 0x20(%rax),%ebp
+  805395:	73 79                	jae    805410 <__rodata_start+0x1c0>
+  805397:	73 74                	jae    80540d <__rodata_start+0x1bd>
+  805399:	65 6d                	gs insl (%dx),%es:(%rdi)
+  80539b:	20 63 61             	and    %ah,0x61(%rbx)
+  80539e:	6c                   	insb   (%dx),%es:(%rdi)
+  80539f:	6c                   	insb   (%dx),%es:(%rdi)
+  8053a0:	00 65 6e             	add    %ah,0x6e(%rbp)
+  8053a3:	74 72                	je     805417 <__rodata_start+0x1c7>
+  8053a5:	79 20                	jns    8053c7 <__rodata_start+0x177>
+  8053a7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8053a8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8053a9:	74 20                	je     8053cb <__rodata_start+0x17b>
+  8053ab:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8053ad:	75 6e                	jne    80541d <__rodata_start+0x1cd>
+  8053af:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  8053b3:	76 20                	jbe    8053d5 <__rodata_start+0x185>
+  8053b5:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  8053bc:	72 65                	jb     805423 <__rodata_start+0x1d3>
+  8053be:	63 76 69             	movsxd 0x69(%rsi),%esi
+  8053c1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8053c2:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  8053c6:	65 78 70             	gs js  805439 <__rodata_start+0x1e9>
+  8053c9:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  8053ce:	20 65 6e             	and    %ah,0x6e(%rbp)
+  8053d1:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  8053d5:	20 66 69             	and    %ah,0x69(%rsi)
+  8053d8:	6c                   	insb   (%dx),%es:(%rdi)
+  8053d9:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  8053dd:	20 66 72             	and    %ah,0x72(%rsi)
+  8053e0:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  8053e5:	61                   	(bad)
+  8053e6:	63 65 20             	movsxd 0x20(%rbp),%esp
+  8053e9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8053ea:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8053eb:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  8053ef:	6b 00 74             	imul   $0x74,(%rax),%eax
+  8053f2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8053f3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8053f4:	20 6d 61             	and    %ch,0x61(%rbp)
+  8053f7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8053f8:	79 20                	jns    80541a <__rodata_start+0x1ca>
+  8053fa:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  805401:	72 65                	jb     805468 <__rodata_start+0x218>
+  805403:	20 6f 70             	and    %ch,0x70(%rdi)
+  805406:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  805408:	00 66 69             	add    %ah,0x69(%rsi)
+  80540b:	6c                   	insb   (%dx),%es:(%rdi)
+  80540c:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  805410:	20 62 6c             	and    %ah,0x6c(%rdx)
+  805413:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805414:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  805417:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805418:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805419:	74 20                	je     80543b <__rodata_start+0x1eb>
+  80541b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80541d:	75 6e                	jne    80548d <__rodata_start+0x23d>
+  80541f:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  805423:	76 61                	jbe    805486 <__rodata_start+0x236>
+  805425:	6c                   	insb   (%dx),%es:(%rdi)
+  805426:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  80542d:	00 
+  80542e:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  805435:	72 65                	jb     80549c <__rodata_start+0x24c>
+  805437:	61                   	(bad)
+  805438:	64 79 20             	fs jns 80545b <__rodata_start+0x20b>
+  80543b:	65 78 69             	gs js  8054a7 <__rodata_start+0x257>
+  80543e:	73 74                	jae    8054b4 <__rodata_start+0x264>
+  805440:	73 00                	jae    805442 <__rodata_start+0x1f2>
+  805442:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805443:	70 65                	jo     8054aa <__rodata_start+0x25a>
+  805445:	72 61                	jb     8054a8 <__rodata_start+0x258>
+  805447:	74 69                	je     8054b2 <__rodata_start+0x262>
+  805449:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80544a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80544b:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  80544e:	74 20                	je     805470 <__rodata_start+0x220>
+  805450:	73 75                	jae    8054c7 <__rodata_start+0x277>
+  805452:	70 70                	jo     8054c4 <__rodata_start+0x274>
+  805454:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805455:	72 74                	jb     8054cb <__rodata_start+0x27b>
+  805457:	65 64 00 74 72 79    	gs add %dh,%fs:0x79(%rdx,%rsi,2)
+  80545d:	20 61 67             	and    %ah,0x67(%rcx)
+  805460:	61                   	(bad)
+  805461:	69 6e 00 74 69 6d 65 	imul   $0x656d6974,0x0(%rsi),%ebp
+  805468:	64 20 6f 75          	and    %ch,%fs:0x75(%rdi)
+  80546c:	74 00                	je     80546e <__rodata_start+0x21e>
+  80546e:	66 69 6c 65 20 69 73 	imul   $0x7369,0x20(%rbp,%riz,2),%bp
+  805475:	20 69 6e             	and    %ch,0x6e(%rcx)
+  805478:	20 75 73             	and    %dh,0x73(%rbp)
+  80547b:	65 00 0f             	add    %cl,%gs:(%rdi)
+  80547e:	1f                   	(bad)
+  80547f:	00 bd 04 80 00 00    	add    %bh,0x8004(%rbp)
+  805485:	00 00                	add    %al,(%rax)
+  805487:	00 fe                	add    %bh,%dh
+  805489:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80548f:	00 ee                	add    %ch,%dh
+  805491:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805497:	00 fe                	add    %bh,%dh
+  805499:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80549f:	00 fe                	add    %bh,%dh
+  8054a1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8054a7:	00 fe                	add    %bh,%dh
+  8054a9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8054af:	00 fe                	add    %bh,%dh
+  8054b1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8054b7:	00 dc                	add    %bl,%ah
+  8054b9:	04 80                	add    $0x80,%al
+  8054bb:	00 00                	add    %al,(%rax)
+  8054bd:	00 00                	add    %al,(%rax)
+  8054bf:	00 fe                	add    %bh,%dh
+  8054c1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8054c7:	00 fe                	add    %bh,%dh
+  8054c9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8054cf:	00 d0                	add    %dl,%al
+  8054d1:	04 80                	add    $0x80,%al
+  8054d3:	00 00                	add    %al,(%rax)
+  8054d5:	00 00                	add    %al,(%rax)
+  8054d7:	00 4a 05             	add    %cl,0x5(%rdx)
+  8054da:	80 00 00             	addb   $0x0,(%rax)
+  8054dd:	00 00                	add    %al,(%rax)
+  8054df:	00 fe                	add    %bh,%dh
+  8054e1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8054e7:	00 d0                	add    %dl,%al
+  8054e9:	04 80                	add    $0x80,%al
+  8054eb:	00 00                	add    %al,(%rax)
+  8054ed:	00 00                	add    %al,(%rax)
+  8054ef:	00 16                	add    %dl,(%rsi)
+  8054f1:	05 80 00 00 00       	add    $0x80,%eax
+  8054f6:	00 00                	add    %al,(%rax)
+  8054f8:	16                   	(bad)
+  8054f9:	05 80 00 00 00       	add    $0x80,%eax
+  8054fe:	00 00                	add    %al,(%rax)
+  805500:	16                   	(bad)
+  805501:	05 80 00 00 00       	add    $0x80,%eax
+  805506:	00 00                	add    %al,(%rax)
+  805508:	16                   	(bad)
+  805509:	05 80 00 00 00       	add    $0x80,%eax
+  80550e:	00 00                	add    %al,(%rax)
+  805510:	16                   	(bad)
+  805511:	05 80 00 00 00       	add    $0x80,%eax
+  805516:	00 00                	add    %al,(%rax)
+  805518:	16                   	(bad)
+  805519:	05 80 00 00 00       	add    $0x80,%eax
+  80551e:	00 00                	add    %al,(%rax)
+  805520:	16                   	(bad)
+  805521:	05 80 00 00 00       	add    $0x80,%eax
+  805526:	00 00                	add    %al,(%rax)
+  805528:	16                   	(bad)
+  805529:	05 80 00 00 00       	add    $0x80,%eax
+  80552e:	00 00                	add    %al,(%rax)
+  805530:	16                   	(bad)
+  805531:	05 80 00 00 00       	add    $0x80,%eax
+  805536:	00 00                	add    %al,(%rax)
+  805538:	fe 0a                	decb   (%rdx)
+  80553a:	80 00 00             	addb   $0x0,(%rax)
+  80553d:	00 00                	add    %al,(%rax)
+  80553f:	00 fe                	add    %bh,%dh
+  805541:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805547:	00 fe                	add    %bh,%dh
+  805549:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80554f:	00 fe                	add    %bh,%dh
+  805551:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805557:	00 fe                	add    %bh,%dh
+  805559:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80555f:	00 fe                	add    %bh,%dh
+  805561:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805567:	00 fe                	add    %bh,%dh
+  805569:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80556f:	00 fe                	add    %bh,%dh
+  805571:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805577:	00 fe                	add    %bh,%dh
+  805579:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80557f:	00 fe                	add    %bh,%dh
+  805581:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805587:	00 fe                	add    %bh,%dh
+  805589:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80558f:	00 fe                	add    %bh,%dh
+  805591:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805597:	00 fe                	add    %bh,%dh
+  805599:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80559f:	00 fe                	add    %bh,%dh
+  8055a1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8055a7:	00 fe                	add    %bh,%dh
+  8055a9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8055af:	00 fe                	add    %bh,%dh
+  8055b1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8055b7:	00 fe                	add    %bh,%dh
+  8055b9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8055bf:	00 fe                	add    %bh,%dh
+  8055c1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8055c7:	00 fe                	add    %bh,%dh
+  8055c9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8055cf:	00 fe                	add    %bh,%dh
+  8055d1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8055d7:	00 fe                	add    %bh,%dh
+  8055d9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8055df:	00 fe                	add    %bh,%dh
+  8055e1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8055e7:	00 fe                	add    %bh,%dh
+  8055e9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8055ef:	00 fe                	add    %bh,%dh
+  8055f1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8055f7:	00 fe                	add    %bh,%dh
+  8055f9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8055ff:	00 fe                	add    %bh,%dh
+  805601:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805607:	00 fe                	add    %bh,%dh
+  805609:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80560f:	00 fe                	add    %bh,%dh
+  805611:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805617:	00 fe                	add    %bh,%dh
+  805619:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80561f:	00 fe                	add    %bh,%dh
+  805621:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805627:	00 21                	add    %ah,(%rcx)
+  805629:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80562f:	00 fe                	add    %bh,%dh
+  805631:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805637:	00 fe                	add    %bh,%dh
+  805639:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80563f:	00 fe                	add    %bh,%dh
+  805641:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805647:	00 fe                	add    %bh,%dh
+  805649:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80564f:	00 fe                	add    %bh,%dh
+  805651:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805657:	00 fe                	add    %bh,%dh
+  805659:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80565f:	00 fe                	add    %bh,%dh
+  805661:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805667:	00 fe                	add    %bh,%dh
+  805669:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80566f:	00 fe                	add    %bh,%dh
+  805671:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805677:	00 fe                	add    %bh,%dh
+  805679:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80567f:	00 6d 05             	add    %ch,0x5(%rbp)
+  805682:	80 00 00             	addb   $0x0,(%rax)
+  805685:	00 00                	add    %al,(%rax)
+  805687:	00 3c 07             	add    %bh,(%rdi,%rax,1)
+  80568a:	80 00 00             	addb   $0x0,(%rax)
+  80568d:	00 00                	add    %al,(%rax)
+  80568f:	00 fe                	add    %bh,%dh
+  805691:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805697:	00 fe                	add    %bh,%dh
+  805699:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80569f:	00 fe                	add    %bh,%dh
+  8056a1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8056a7:	00 fe                	add    %bh,%dh
+  8056a9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8056af:	00 9c 05 80 00 00 00 	add    %bl,0x80(%rbp,%rax,1)
+  8056b6:	00 00                	add    %al,(%rax)
+  8056b8:	fe 0a                	decb   (%rdx)
+  8056ba:	80 00 00             	addb   $0x0,(%rax)
+  8056bd:	00 00                	add    %al,(%rax)
+  8056bf:	00 fe                	add    %bh,%dh
+  8056c1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8056c7:	00 62 05             	add    %ah,0x5(%rdx)
+  8056ca:	80 00 00             	addb   $0x0,(%rax)
+  8056cd:	00 00                	add    %al,(%rax)
+  8056cf:	00 fe                	add    %bh,%dh
+  8056d1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8056d7:	00 fe                	add    %bh,%dh
+  8056d9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8056df:	00 e4                	add    %ah,%ah
+  8056e1:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  8056e7:	00 ae 09 80 00 00    	add    %ch,0x8009(%rsi)
+  8056ed:	00 00                	add    %al,(%rax)
+  8056ef:	00 fe                	add    %bh,%dh
+  8056f1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8056f7:	00 fe                	add    %bh,%dh
+  8056f9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8056ff:	00 33                	add    %dh,(%rbx)
+  805701:	06                   	(bad)
+  805702:	80 00 00             	addb   $0x0,(%rax)
+  805705:	00 00                	add    %al,(%rax)
+  805707:	00 fe                	add    %bh,%dh
+  805709:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80570f:	00 10                	add    %dl,(%rax)
+  805711:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  805717:	00 fe                	add    %bh,%dh
+  805719:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80571f:	00 fe                	add    %bh,%dh
+  805721:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805727:	00 21                	add    %ah,(%rcx)
+  805729:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80572f:	00 fe                	add    %bh,%dh
+  805731:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805737:	00 c6                	add    %al,%dh
+  805739:	04 80                	add    $0x80,%al
+  80573b:	00 00                	add    %al,(%rax)
+  80573d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000805740 <error_string>:
+	...
+  805748:	fd 52 80 00 00 00 00 00 0f 53 80 00 00 00 00 00     .R.......S......
+  805758:	1f 53 80 00 00 00 00 00 31 53 80 00 00 00 00 00     .S......1S......
+  805768:	3f 53 80 00 00 00 00 00 53 53 80 00 00 00 00 00     ?S......SS......
+  805778:	68 53 80 00 00 00 00 00 7b 53 80 00 00 00 00 00     hS......{S......
+  805788:	8d 53 80 00 00 00 00 00 a1 53 80 00 00 00 00 00     .S.......S......
+  805798:	b1 53 80 00 00 00 00 00 c4 53 80 00 00 00 00 00     .S.......S......
+  8057a8:	db 53 80 00 00 00 00 00 f1 53 80 00 00 00 00 00     .S.......S......
+  8057b8:	09 54 80 00 00 00 00 00 21 54 80 00 00 00 00 00     .T......!T......
+  8057c8:	2e 54 80 00 00 00 00 00 f8 57 80 00 00 00 00 00     .T.......W......
+  8057d8:	42 54 80 00 00 00 00 00 5a 54 80 00 00 00 00 00     BT......ZT......
+  8057e8:	64 54 80 00 00 00 00 00 6e 54 80 00 00 00 00 00     dT......nT......
+  8057f8:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  805808:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  805818:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  805828:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  805838:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  805848:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  805858:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  805868:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  805878:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  805888:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  805898:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  8058a8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  8058b8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  8058c8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8058d8:	0f 1f 84 00 00 00 00 00                             ........
+
+00000000008058e0 <devtab>:
+  8058e0:	20 60 80 00 00 00 00 00 60 60 80 00 00 00 00 00      `......``......
+  8058f0:	a0 60 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .`..............
+  805900:	57 72 6f 6e 67 20 45 4c 46 20 68 65 61 64 65 72     Wrong ELF header
+  805910:	20 73 69 7a 65 20 6f 72 20 72 65 61 64 20 65 72      size or read er
+  805920:	72 6f 72 3a 20 25 69 0a 00 00 00 00 00 00 00 00     ror: %i.........
+  805930:	73 74 72 69 6e 67 5f 73 74 6f 72 65 20 3d 3d 20     string_store == 
+  805940:	28 63 68 61 72 20 2a 29 55 54 45 4d 50 20 2b 20     (char *)UTEMP + 
+  805950:	55 53 45 52 5f 53 54 41 43 4b 5f 53 49 5a 45 00     USER_STACK_SIZE.
+  805960:	6d 61 70 5f 73 65 67 6d 65 6e 74 2e 73 79 73 5f     map_segment.sys_
+  805970:	61 6c 6c 6f 63 5f 72 65 67 69 6f 6e 20 66 61 69     alloc_region fai
+  805980:	6c 65 64 3a 20 25 69 0a 00 00 00 00 00 00 00 00     led: %i.........
+  805990:	73 70 61 77 6e 3a 20 62 61 74 63 68 65 64 20 73     spawn: batched s
+  8059a0:	79 73 74 65 6d 20 63 61 6c 6c 20 66 61 69 6c 65     ystem call faile
+  8059b0:	64 3a 20 25 69 0a 00 45 6c 66 20 6d 61 67 69 63     d: %i..Elf magic
+  8059c0:	20 25 30 38 78 20 77 61 6e 74 20 25 30 38 78 0a      %08x want %08x.
+  8059d0:	00 61 73 73 65 72 74 69 6f 6e 20 66 61 69 6c 65     .assertion faile
+  8059e0:	64 3a 20 25 73 00 6c 69 62 2f 73 70 61 77 6e 2e     d: %s.lib/spawn.
+  8059f0:	63 00 6d 61 70 5f 73 65 67 6d 65 6e 74 2e 6d 6d     c.map_segment.mm
+  805a00:	61 70 20 66 61 69 6c 65 64 3a 20 25 69 0a 00 3c     ap failed: %i..<
+  805a10:	70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e 63     pipe>.lib/pipe.c
+  805a20:	00 70 69 70 65 00 66 90 73 79 73 5f 72 65 67 69     .pipe.f.sys_regi
+  805a30:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  805a40:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 3c 63 6f 6e     _SIZE) == 2.<con
+  805a50:	73 3e 00 63 6f 6e 73 00 55 73 65 72 73 70 61 63     s>.cons.Userspac
+  805a60:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  805a70:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  805a80:	65 72 72 3d 25 78 0a 00 6c 69 62 2f 70 67 66 61     err=%x..lib/pgfa
+  805a90:	75 6c 74 2e 63 00 73 65 74 5f 70 67 66 61 75 6c     ult.c.set_pgfaul
+  805aa0:	74 5f 68 61 6e 64 6c 65 72 3a 20 25 69 00 5f 70     t_handler: %i._p
+  805ab0:	66 68 61 6e 64 6c 65 72 5f 69 6e 69 74 69 74 69     fhandler_inititi
+  805ac0:	61 6c 6c 69 7a 65 64 00 69 70 63 5f 73 65 6e 64     allized.ipc_send
+  805ad0:	20 65 72 72 6f 72 3a 20 25 69 0a 00 6c 69 62 2f      error: %i..lib/
+  805ae0:	69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00 00     ipc.c.f.........
+  805af0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ba0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805bb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805bc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805bd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805be0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805bf0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ca0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805cb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805cc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805cd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ce0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805cf0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805da0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805db0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805dc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805dd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805de0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805df0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ea0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805eb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ec0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ed0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ee0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ef0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805fa0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805fb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805fc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805fd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805fe0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ff0:	66 2e 0f 1f 84 00 00 00 00 00 66 0f 1f 44 00 00     f.........f..D..
@@ -0,0 +1,8583 @@
+
+obj/user/spin:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 c2 00 00 00       	call   8000e5 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+ * Let it run for a couple time slices, then kill it. */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 55                	push   %r13
+  80002b:	41 54                	push   %r12
+  80002d:	53                   	push   %rbx
+  80002e:	48 83 ec 08          	sub    $0x8,%rsp
+    envid_t env;
+
+    cprintf("I am the parent.  Forking the child...\n");
+  800032:	48 bf 68 48 80 00 00 	movabs $0x804868,%rdi
+  800039:	00 00 00 
+  80003c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800041:	48 ba 68 02 80 00 00 	movabs $0x800268,%rdx
+  800048:	00 00 00 
+  80004b:	ff d2                	call   *%rdx
+    if ((env = fork()) == 0) {
+  80004d:	48 b8 1f 15 80 00 00 	movabs $0x80151f,%rax
+  800054:	00 00 00 
+  800057:	ff d0                	call   *%rax
+  800059:	85 c0                	test   %eax,%eax
+  80005b:	75 1d                	jne    80007a <umain+0x55>
+        cprintf("I am the child.  Spinning...\n");
+  80005d:	48 bf e0 48 80 00 00 	movabs $0x8048e0,%rdi
+  800064:	00 00 00 
+  800067:	b8 00 00 00 00       	mov    $0x0,%eax
+  80006c:	48 ba 68 02 80 00 00 	movabs $0x800268,%rdx
+  800073:	00 00 00 
+  800076:	ff d2                	call   *%rdx
+        while (1) /* do nothing */
+  800078:	eb fe                	jmp    800078 <umain+0x53>
+  80007a:	89 c3                	mov    %eax,%ebx
+            ;
+    }
+
+    cprintf("I am the parent.  Running the child...\n");
+  80007c:	48 bf 90 48 80 00 00 	movabs $0x804890,%rdi
+  800083:	00 00 00 
+  800086:	b8 00 00 00 00       	mov    $0x0,%eax
+  80008b:	49 bd 68 02 80 00 00 	movabs $0x800268,%r13
+  800092:	00 00 00 
+  800095:	41 ff d5             	call   *%r13
+    sys_yield();
+  800098:	49 bc 88 10 80 00 00 	movabs $0x801088,%r12
+  80009f:	00 00 00 
+  8000a2:	41 ff d4             	call   *%r12
+    sys_yield();
+  8000a5:	41 ff d4             	call   *%r12
+    sys_yield();
+  8000a8:	41 ff d4             	call   *%r12
+    sys_yield();
+  8000ab:	41 ff d4             	call   *%r12
+    sys_yield();
+  8000ae:	41 ff d4             	call   *%r12
+    sys_yield();
+  8000b1:	41 ff d4             	call   *%r12
+    sys_yield();
+  8000b4:	41 ff d4             	call   *%r12
+    sys_yield();
+  8000b7:	41 ff d4             	call   *%r12
+
+    cprintf("I am the parent.  Killing the child...\n");
+  8000ba:	48 bf b8 48 80 00 00 	movabs $0x8048b8,%rdi
+  8000c1:	00 00 00 
+  8000c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000c9:	41 ff d5             	call   *%r13
+    sys_env_destroy(env);
+  8000cc:	89 df                	mov    %ebx,%edi
+  8000ce:	48 b8 fc 0f 80 00 00 	movabs $0x800ffc,%rax
+  8000d5:	00 00 00 
+  8000d8:	ff d0                	call   *%rax
+}
+  8000da:	48 83 c4 08          	add    $0x8,%rsp
+  8000de:	5b                   	pop    %rbx
+  8000df:	41 5c                	pop    %r12
+  8000e1:	41 5d                	pop    %r13
+  8000e3:	5d                   	pop    %rbp
+  8000e4:	c3                   	ret
+
+00000000008000e5 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8000e5:	55                   	push   %rbp
+  8000e6:	48 89 e5             	mov    %rsp,%rbp
+  8000e9:	41 56                	push   %r14
+  8000eb:	41 55                	push   %r13
+  8000ed:	41 54                	push   %r12
+  8000ef:	53                   	push   %rbx
+  8000f0:	41 89 fd             	mov    %edi,%r13d
+  8000f3:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8000f6:	48 ba e0 60 80 00 00 	movabs $0x8060e0,%rdx
+  8000fd:	00 00 00 
+  800100:	48 b8 e0 60 80 00 00 	movabs $0x8060e0,%rax
+  800107:	00 00 00 
+  80010a:	48 39 c2             	cmp    %rax,%rdx
+  80010d:	73 17                	jae    800126 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80010f:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800112:	49 89 c4             	mov    %rax,%r12
+  800115:	48 83 c3 08          	add    $0x8,%rbx
+  800119:	b8 00 00 00 00       	mov    $0x0,%eax
+  80011e:	ff 53 f8             	call   *-0x8(%rbx)
+  800121:	4c 39 e3             	cmp    %r12,%rbx
+  800124:	72 ef                	jb     800115 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800126:	48 b8 5f 10 80 00 00 	movabs $0x80105f,%rax
+  80012d:	00 00 00 
+  800130:	ff d0                	call   *%rax
+  800132:	89 c2                	mov    %eax,%edx
+  800134:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  80013a:	48 89 d0             	mov    %rdx,%rax
+  80013d:	48 c1 e0 04          	shl    $0x4,%rax
+  800141:	48 29 d0             	sub    %rdx,%rax
+  800144:	48 c1 e0 05          	shl    $0x5,%rax
+  800148:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80014f:	00 00 00 
+  800152:	48 01 d0             	add    %rdx,%rax
+  800155:	48 a3 00 00 81 00 00 	movabs %rax,0x810000
+  80015c:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80015f:	45 85 ed             	test   %r13d,%r13d
+  800162:	7e 0d                	jle    800171 <libmain+0x8c>
+  800164:	49 8b 06             	mov    (%r14),%rax
+  800167:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  80016e:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800171:	4c 89 f6             	mov    %r14,%rsi
+  800174:	44 89 ef             	mov    %r13d,%edi
+  800177:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80017e:	00 00 00 
+  800181:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800183:	48 b8 98 01 80 00 00 	movabs $0x800198,%rax
+  80018a:	00 00 00 
+  80018d:	ff d0                	call   *%rax
+#endif
+}
+  80018f:	5b                   	pop    %rbx
+  800190:	41 5c                	pop    %r12
+  800192:	41 5d                	pop    %r13
+  800194:	41 5e                	pop    %r14
+  800196:	5d                   	pop    %rbp
+  800197:	c3                   	ret
+
+0000000000800198 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800198:	55                   	push   %rbp
+  800199:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80019c:	48 b8 65 18 80 00 00 	movabs $0x801865,%rax
+  8001a3:	00 00 00 
+  8001a6:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8001a8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001ad:	48 b8 fc 0f 80 00 00 	movabs $0x800ffc,%rax
+  8001b4:	00 00 00 
+  8001b7:	ff d0                	call   *%rax
+}
+  8001b9:	5d                   	pop    %rbp
+  8001ba:	c3                   	ret
+
+00000000008001bb <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8001bb:	55                   	push   %rbp
+  8001bc:	48 89 e5             	mov    %rsp,%rbp
+  8001bf:	53                   	push   %rbx
+  8001c0:	48 83 ec 08          	sub    $0x8,%rsp
+  8001c4:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8001c7:	8b 06                	mov    (%rsi),%eax
+  8001c9:	8d 50 01             	lea    0x1(%rax),%edx
+  8001cc:	89 16                	mov    %edx,(%rsi)
+  8001ce:	48 98                	cltq
+  8001d0:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8001d5:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8001db:	74 0a                	je     8001e7 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8001dd:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8001e1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001e5:	c9                   	leave
+  8001e6:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8001e7:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8001eb:	be ff 00 00 00       	mov    $0xff,%esi
+  8001f0:	48 b8 b4 0f 80 00 00 	movabs $0x800fb4,%rax
+  8001f7:	00 00 00 
+  8001fa:	ff d0                	call   *%rax
+        state->offset = 0;
+  8001fc:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800202:	eb d9                	jmp    8001dd <putch+0x22>
+
+0000000000800204 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800204:	55                   	push   %rbp
+  800205:	48 89 e5             	mov    %rsp,%rbp
+  800208:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80020f:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800212:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800219:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80021e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800223:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800226:	48 89 f1             	mov    %rsi,%rcx
+  800229:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800230:	48 bf bb 01 80 00 00 	movabs $0x8001bb,%rdi
+  800237:	00 00 00 
+  80023a:	48 b8 b8 03 80 00 00 	movabs $0x8003b8,%rax
+  800241:	00 00 00 
+  800244:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800246:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80024d:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800254:	48 b8 b4 0f 80 00 00 	movabs $0x800fb4,%rax
+  80025b:	00 00 00 
+  80025e:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800260:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800266:	c9                   	leave
+  800267:	c3                   	ret
+
+0000000000800268 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800268:	55                   	push   %rbp
+  800269:	48 89 e5             	mov    %rsp,%rbp
+  80026c:	48 83 ec 50          	sub    $0x50,%rsp
+  800270:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800274:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800278:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80027c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800280:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800284:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80028b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80028f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800293:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800297:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80029b:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80029f:	48 b8 04 02 80 00 00 	movabs $0x800204,%rax
+  8002a6:	00 00 00 
+  8002a9:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8002ab:	c9                   	leave
+  8002ac:	c3                   	ret
+
+00000000008002ad <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8002ad:	55                   	push   %rbp
+  8002ae:	48 89 e5             	mov    %rsp,%rbp
+  8002b1:	41 57                	push   %r15
+  8002b3:	41 56                	push   %r14
+  8002b5:	41 55                	push   %r13
+  8002b7:	41 54                	push   %r12
+  8002b9:	53                   	push   %rbx
+  8002ba:	48 83 ec 18          	sub    $0x18,%rsp
+  8002be:	49 89 fc             	mov    %rdi,%r12
+  8002c1:	49 89 f5             	mov    %rsi,%r13
+  8002c4:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8002c8:	8b 45 10             	mov    0x10(%rbp),%eax
+  8002cb:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8002ce:	41 89 cf             	mov    %ecx,%r15d
+  8002d1:	4c 39 fa             	cmp    %r15,%rdx
+  8002d4:	73 5b                	jae    800331 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8002d6:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8002da:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8002de:	85 db                	test   %ebx,%ebx
+  8002e0:	7e 0e                	jle    8002f0 <print_num+0x43>
+            putch(padc, put_arg);
+  8002e2:	4c 89 ee             	mov    %r13,%rsi
+  8002e5:	44 89 f7             	mov    %r14d,%edi
+  8002e8:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8002eb:	83 eb 01             	sub    $0x1,%ebx
+  8002ee:	75 f2                	jne    8002e2 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8002f0:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8002f4:	48 b9 19 49 80 00 00 	movabs $0x804919,%rcx
+  8002fb:	00 00 00 
+  8002fe:	48 b8 08 49 80 00 00 	movabs $0x804908,%rax
+  800305:	00 00 00 
+  800308:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80030c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800310:	ba 00 00 00 00       	mov    $0x0,%edx
+  800315:	49 f7 f7             	div    %r15
+  800318:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80031c:	4c 89 ee             	mov    %r13,%rsi
+  80031f:	41 ff d4             	call   *%r12
+}
+  800322:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800326:	5b                   	pop    %rbx
+  800327:	41 5c                	pop    %r12
+  800329:	41 5d                	pop    %r13
+  80032b:	41 5e                	pop    %r14
+  80032d:	41 5f                	pop    %r15
+  80032f:	5d                   	pop    %rbp
+  800330:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800331:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800335:	ba 00 00 00 00       	mov    $0x0,%edx
+  80033a:	49 f7 f7             	div    %r15
+  80033d:	48 83 ec 08          	sub    $0x8,%rsp
+  800341:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800345:	52                   	push   %rdx
+  800346:	45 0f be c9          	movsbl %r9b,%r9d
+  80034a:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80034e:	48 89 c2             	mov    %rax,%rdx
+  800351:	48 b8 ad 02 80 00 00 	movabs $0x8002ad,%rax
+  800358:	00 00 00 
+  80035b:	ff d0                	call   *%rax
+  80035d:	48 83 c4 10          	add    $0x10,%rsp
+  800361:	eb 8d                	jmp    8002f0 <print_num+0x43>
+
+0000000000800363 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800363:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800367:	48 8b 06             	mov    (%rsi),%rax
+  80036a:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80036e:	73 0a                	jae    80037a <sprintputch+0x17>
+        *state->start++ = ch;
+  800370:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800374:	48 89 16             	mov    %rdx,(%rsi)
+  800377:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80037a:	c3                   	ret
+
+000000000080037b <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80037b:	55                   	push   %rbp
+  80037c:	48 89 e5             	mov    %rsp,%rbp
+  80037f:	48 83 ec 50          	sub    $0x50,%rsp
+  800383:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800387:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80038b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80038f:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800396:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80039a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80039e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8003a2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8003a6:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8003aa:	48 b8 b8 03 80 00 00 	movabs $0x8003b8,%rax
+  8003b1:	00 00 00 
+  8003b4:	ff d0                	call   *%rax
+}
+  8003b6:	c9                   	leave
+  8003b7:	c3                   	ret
+
+00000000008003b8 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8003b8:	55                   	push   %rbp
+  8003b9:	48 89 e5             	mov    %rsp,%rbp
+  8003bc:	41 57                	push   %r15
+  8003be:	41 56                	push   %r14
+  8003c0:	41 55                	push   %r13
+  8003c2:	41 54                	push   %r12
+  8003c4:	53                   	push   %rbx
+  8003c5:	48 83 ec 38          	sub    $0x38,%rsp
+  8003c9:	49 89 fe             	mov    %rdi,%r14
+  8003cc:	49 89 f5             	mov    %rsi,%r13
+  8003cf:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8003d2:	48 8b 01             	mov    (%rcx),%rax
+  8003d5:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8003d9:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8003dd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003e1:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8003e5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8003e9:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8003ed:	0f b6 3b             	movzbl (%rbx),%edi
+  8003f0:	40 80 ff 25          	cmp    $0x25,%dil
+  8003f4:	74 18                	je     80040e <vprintfmt+0x56>
+            if (!ch) return;
+  8003f6:	40 84 ff             	test   %dil,%dil
+  8003f9:	0f 84 b1 06 00 00    	je     800ab0 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8003ff:	40 0f b6 ff          	movzbl %dil,%edi
+  800403:	4c 89 ee             	mov    %r13,%rsi
+  800406:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800409:	4c 89 e3             	mov    %r12,%rbx
+  80040c:	eb db                	jmp    8003e9 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80040e:	be 00 00 00 00       	mov    $0x0,%esi
+  800413:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800417:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80041c:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800422:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800429:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80042d:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800432:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800437:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80043a:	83 e8 23             	sub    $0x23,%eax
+  80043d:	3c 57                	cmp    $0x57,%al
+  80043f:	0f 87 51 06 00 00    	ja     800a96 <vprintfmt+0x6de>
+  800445:	0f b6 c0             	movzbl %al,%eax
+  800448:	48 b9 c0 4a 80 00 00 	movabs $0x804ac0,%rcx
+  80044f:	00 00 00 
+  800452:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800455:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800458:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80045c:	eb cf                	jmp    80042d <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  80045e:	49 89 dc             	mov    %rbx,%r12
+  800461:	be 01 00 00 00       	mov    $0x1,%esi
+  800466:	eb c5                	jmp    80042d <vprintfmt+0x75>
+            padc = ch;
+  800468:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80046c:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80046f:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800472:	eb b9                	jmp    80042d <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800474:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800477:	83 f8 2f             	cmp    $0x2f,%eax
+  80047a:	77 24                	ja     8004a0 <vprintfmt+0xe8>
+  80047c:	89 c1                	mov    %eax,%ecx
+  80047e:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800482:	83 c0 08             	add    $0x8,%eax
+  800485:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800488:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80048b:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80048e:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800492:	79 99                	jns    80042d <vprintfmt+0x75>
+                width = precision;
+  800494:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800498:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80049e:	eb 8d                	jmp    80042d <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8004a0:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8004a4:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8004a8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004ac:	eb da                	jmp    800488 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8004ae:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8004b3:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8004b7:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8004bd:	3c 39                	cmp    $0x39,%al
+  8004bf:	77 1c                	ja     8004dd <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8004c1:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8004c5:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8004c9:	0f b6 c0             	movzbl %al,%eax
+  8004cc:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8004d1:	0f b6 03             	movzbl (%rbx),%eax
+  8004d4:	3c 39                	cmp    $0x39,%al
+  8004d6:	76 e9                	jbe    8004c1 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8004d8:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8004db:	eb b1                	jmp    80048e <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8004dd:	49 89 dc             	mov    %rbx,%r12
+  8004e0:	eb ac                	jmp    80048e <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8004e2:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8004e5:	85 c9                	test   %ecx,%ecx
+  8004e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004ec:	0f 49 c1             	cmovns %ecx,%eax
+  8004ef:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8004f2:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004f5:	e9 33 ff ff ff       	jmp    80042d <vprintfmt+0x75>
+            lflag++;
+  8004fa:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8004fd:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800500:	e9 28 ff ff ff       	jmp    80042d <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800505:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800508:	83 f8 2f             	cmp    $0x2f,%eax
+  80050b:	77 19                	ja     800526 <vprintfmt+0x16e>
+  80050d:	89 c2                	mov    %eax,%edx
+  80050f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800513:	83 c0 08             	add    $0x8,%eax
+  800516:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800519:	8b 3a                	mov    (%rdx),%edi
+  80051b:	4c 89 ee             	mov    %r13,%rsi
+  80051e:	41 ff d6             	call   *%r14
+            break;
+  800521:	e9 c3 fe ff ff       	jmp    8003e9 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800526:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80052a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80052e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800532:	eb e5                	jmp    800519 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800534:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800537:	83 f8 2f             	cmp    $0x2f,%eax
+  80053a:	77 5a                	ja     800596 <vprintfmt+0x1de>
+  80053c:	89 c2                	mov    %eax,%edx
+  80053e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800542:	83 c0 08             	add    $0x8,%eax
+  800545:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800548:	8b 02                	mov    (%rdx),%eax
+  80054a:	89 c1                	mov    %eax,%ecx
+  80054c:	f7 d9                	neg    %ecx
+  80054e:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800551:	83 f9 16             	cmp    $0x16,%ecx
+  800554:	7f 4e                	jg     8005a4 <vprintfmt+0x1ec>
+  800556:	48 63 c1             	movslq %ecx,%rax
+  800559:	48 ba 80 4d 80 00 00 	movabs $0x804d80,%rdx
+  800560:	00 00 00 
+  800563:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800567:	48 85 c0             	test   %rax,%rax
+  80056a:	74 38                	je     8005a4 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80056c:	48 89 c1             	mov    %rax,%rcx
+  80056f:	48 ba 79 4f 80 00 00 	movabs $0x804f79,%rdx
+  800576:	00 00 00 
+  800579:	4c 89 ee             	mov    %r13,%rsi
+  80057c:	4c 89 f7             	mov    %r14,%rdi
+  80057f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800584:	49 b8 7b 03 80 00 00 	movabs $0x80037b,%r8
+  80058b:	00 00 00 
+  80058e:	41 ff d0             	call   *%r8
+  800591:	e9 53 fe ff ff       	jmp    8003e9 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800596:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80059a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80059e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005a2:	eb a4                	jmp    800548 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8005a4:	48 ba 31 49 80 00 00 	movabs $0x804931,%rdx
+  8005ab:	00 00 00 
+  8005ae:	4c 89 ee             	mov    %r13,%rsi
+  8005b1:	4c 89 f7             	mov    %r14,%rdi
+  8005b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005b9:	49 b8 7b 03 80 00 00 	movabs $0x80037b,%r8
+  8005c0:	00 00 00 
+  8005c3:	41 ff d0             	call   *%r8
+  8005c6:	e9 1e fe ff ff       	jmp    8003e9 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8005cb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005ce:	83 f8 2f             	cmp    $0x2f,%eax
+  8005d1:	77 6c                	ja     80063f <vprintfmt+0x287>
+  8005d3:	89 c2                	mov    %eax,%edx
+  8005d5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005d9:	83 c0 08             	add    $0x8,%eax
+  8005dc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005df:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8005e2:	48 85 d2             	test   %rdx,%rdx
+  8005e5:	48 b8 2a 49 80 00 00 	movabs $0x80492a,%rax
+  8005ec:	00 00 00 
+  8005ef:	48 0f 45 c2          	cmovne %rdx,%rax
+  8005f3:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8005f7:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8005fb:	7e 06                	jle    800603 <vprintfmt+0x24b>
+  8005fd:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800601:	75 4a                	jne    80064d <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800603:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800607:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80060b:	0f b6 00             	movzbl (%rax),%eax
+  80060e:	84 c0                	test   %al,%al
+  800610:	0f 85 9a 00 00 00    	jne    8006b0 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800616:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800619:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80061d:	85 c0                	test   %eax,%eax
+  80061f:	0f 8e c4 fd ff ff    	jle    8003e9 <vprintfmt+0x31>
+  800625:	4c 89 ee             	mov    %r13,%rsi
+  800628:	bf 20 00 00 00       	mov    $0x20,%edi
+  80062d:	41 ff d6             	call   *%r14
+  800630:	41 83 ec 01          	sub    $0x1,%r12d
+  800634:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800638:	75 eb                	jne    800625 <vprintfmt+0x26d>
+  80063a:	e9 aa fd ff ff       	jmp    8003e9 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80063f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800643:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800647:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80064b:	eb 92                	jmp    8005df <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80064d:	49 63 f7             	movslq %r15d,%rsi
+  800650:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800654:	48 b8 6a 0b 80 00 00 	movabs $0x800b6a,%rax
+  80065b:	00 00 00 
+  80065e:	ff d0                	call   *%rax
+  800660:	48 89 c2             	mov    %rax,%rdx
+  800663:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800666:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800668:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80066b:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80066e:	85 c0                	test   %eax,%eax
+  800670:	7e 91                	jle    800603 <vprintfmt+0x24b>
+  800672:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800677:	4c 89 ee             	mov    %r13,%rsi
+  80067a:	44 89 e7             	mov    %r12d,%edi
+  80067d:	41 ff d6             	call   *%r14
+  800680:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800684:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800687:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80068a:	75 eb                	jne    800677 <vprintfmt+0x2bf>
+  80068c:	e9 72 ff ff ff       	jmp    800603 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800691:	0f b6 f8             	movzbl %al,%edi
+  800694:	4c 89 ee             	mov    %r13,%rsi
+  800697:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80069a:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80069e:	49 83 c4 01          	add    $0x1,%r12
+  8006a2:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8006a8:	84 c0                	test   %al,%al
+  8006aa:	0f 84 66 ff ff ff    	je     800616 <vprintfmt+0x25e>
+  8006b0:	45 85 ff             	test   %r15d,%r15d
+  8006b3:	78 0a                	js     8006bf <vprintfmt+0x307>
+  8006b5:	41 83 ef 01          	sub    $0x1,%r15d
+  8006b9:	0f 88 57 ff ff ff    	js     800616 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8006bf:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8006c3:	74 cc                	je     800691 <vprintfmt+0x2d9>
+  8006c5:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8006c8:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8006cd:	80 fa 5e             	cmp    $0x5e,%dl
+  8006d0:	77 c2                	ja     800694 <vprintfmt+0x2dc>
+  8006d2:	eb bd                	jmp    800691 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8006d4:	40 84 f6             	test   %sil,%sil
+  8006d7:	75 26                	jne    8006ff <vprintfmt+0x347>
+    switch (lflag) {
+  8006d9:	85 d2                	test   %edx,%edx
+  8006db:	74 59                	je     800736 <vprintfmt+0x37e>
+  8006dd:	83 fa 01             	cmp    $0x1,%edx
+  8006e0:	74 7b                	je     80075d <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8006e2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006e5:	83 f8 2f             	cmp    $0x2f,%eax
+  8006e8:	0f 87 96 00 00 00    	ja     800784 <vprintfmt+0x3cc>
+  8006ee:	89 c2                	mov    %eax,%edx
+  8006f0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006f4:	83 c0 08             	add    $0x8,%eax
+  8006f7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006fa:	4c 8b 22             	mov    (%rdx),%r12
+  8006fd:	eb 17                	jmp    800716 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8006ff:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800702:	83 f8 2f             	cmp    $0x2f,%eax
+  800705:	77 21                	ja     800728 <vprintfmt+0x370>
+  800707:	89 c2                	mov    %eax,%edx
+  800709:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80070d:	83 c0 08             	add    $0x8,%eax
+  800710:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800713:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800716:	4d 85 e4             	test   %r12,%r12
+  800719:	78 7a                	js     800795 <vprintfmt+0x3dd>
+            num = i;
+  80071b:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80071e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800723:	e9 50 02 00 00       	jmp    800978 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800728:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80072c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800730:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800734:	eb dd                	jmp    800713 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800736:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800739:	83 f8 2f             	cmp    $0x2f,%eax
+  80073c:	77 11                	ja     80074f <vprintfmt+0x397>
+  80073e:	89 c2                	mov    %eax,%edx
+  800740:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800744:	83 c0 08             	add    $0x8,%eax
+  800747:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80074a:	4c 63 22             	movslq (%rdx),%r12
+  80074d:	eb c7                	jmp    800716 <vprintfmt+0x35e>
+  80074f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800753:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800757:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80075b:	eb ed                	jmp    80074a <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  80075d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800760:	83 f8 2f             	cmp    $0x2f,%eax
+  800763:	77 11                	ja     800776 <vprintfmt+0x3be>
+  800765:	89 c2                	mov    %eax,%edx
+  800767:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80076b:	83 c0 08             	add    $0x8,%eax
+  80076e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800771:	4c 8b 22             	mov    (%rdx),%r12
+  800774:	eb a0                	jmp    800716 <vprintfmt+0x35e>
+  800776:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80077a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80077e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800782:	eb ed                	jmp    800771 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800784:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800788:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80078c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800790:	e9 65 ff ff ff       	jmp    8006fa <vprintfmt+0x342>
+                putch('-', put_arg);
+  800795:	4c 89 ee             	mov    %r13,%rsi
+  800798:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80079d:	41 ff d6             	call   *%r14
+                i = -i;
+  8007a0:	49 f7 dc             	neg    %r12
+  8007a3:	e9 73 ff ff ff       	jmp    80071b <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8007a8:	40 84 f6             	test   %sil,%sil
+  8007ab:	75 32                	jne    8007df <vprintfmt+0x427>
+    switch (lflag) {
+  8007ad:	85 d2                	test   %edx,%edx
+  8007af:	74 5d                	je     80080e <vprintfmt+0x456>
+  8007b1:	83 fa 01             	cmp    $0x1,%edx
+  8007b4:	0f 84 82 00 00 00    	je     80083c <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8007ba:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007bd:	83 f8 2f             	cmp    $0x2f,%eax
+  8007c0:	0f 87 a5 00 00 00    	ja     80086b <vprintfmt+0x4b3>
+  8007c6:	89 c2                	mov    %eax,%edx
+  8007c8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007cc:	83 c0 08             	add    $0x8,%eax
+  8007cf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007d2:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007d5:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8007da:	e9 99 01 00 00       	jmp    800978 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8007df:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007e2:	83 f8 2f             	cmp    $0x2f,%eax
+  8007e5:	77 19                	ja     800800 <vprintfmt+0x448>
+  8007e7:	89 c2                	mov    %eax,%edx
+  8007e9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007ed:	83 c0 08             	add    $0x8,%eax
+  8007f0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007f3:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007f6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8007fb:	e9 78 01 00 00       	jmp    800978 <vprintfmt+0x5c0>
+  800800:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800804:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800808:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80080c:	eb e5                	jmp    8007f3 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  80080e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800811:	83 f8 2f             	cmp    $0x2f,%eax
+  800814:	77 18                	ja     80082e <vprintfmt+0x476>
+  800816:	89 c2                	mov    %eax,%edx
+  800818:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80081c:	83 c0 08             	add    $0x8,%eax
+  80081f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800822:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800824:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800829:	e9 4a 01 00 00       	jmp    800978 <vprintfmt+0x5c0>
+  80082e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800832:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800836:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80083a:	eb e6                	jmp    800822 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  80083c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80083f:	83 f8 2f             	cmp    $0x2f,%eax
+  800842:	77 19                	ja     80085d <vprintfmt+0x4a5>
+  800844:	89 c2                	mov    %eax,%edx
+  800846:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80084a:	83 c0 08             	add    $0x8,%eax
+  80084d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800850:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800853:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800858:	e9 1b 01 00 00       	jmp    800978 <vprintfmt+0x5c0>
+  80085d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800861:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800865:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800869:	eb e5                	jmp    800850 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  80086b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80086f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800873:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800877:	e9 56 ff ff ff       	jmp    8007d2 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  80087c:	40 84 f6             	test   %sil,%sil
+  80087f:	75 2e                	jne    8008af <vprintfmt+0x4f7>
+    switch (lflag) {
+  800881:	85 d2                	test   %edx,%edx
+  800883:	74 59                	je     8008de <vprintfmt+0x526>
+  800885:	83 fa 01             	cmp    $0x1,%edx
+  800888:	74 7f                	je     800909 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  80088a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80088d:	83 f8 2f             	cmp    $0x2f,%eax
+  800890:	0f 87 9f 00 00 00    	ja     800935 <vprintfmt+0x57d>
+  800896:	89 c2                	mov    %eax,%edx
+  800898:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80089c:	83 c0 08             	add    $0x8,%eax
+  80089f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008a2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8008a5:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8008aa:	e9 c9 00 00 00       	jmp    800978 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8008af:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008b2:	83 f8 2f             	cmp    $0x2f,%eax
+  8008b5:	77 19                	ja     8008d0 <vprintfmt+0x518>
+  8008b7:	89 c2                	mov    %eax,%edx
+  8008b9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008bd:	83 c0 08             	add    $0x8,%eax
+  8008c0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008c3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8008c6:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8008cb:	e9 a8 00 00 00       	jmp    800978 <vprintfmt+0x5c0>
+  8008d0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008d4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008d8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008dc:	eb e5                	jmp    8008c3 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8008de:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008e1:	83 f8 2f             	cmp    $0x2f,%eax
+  8008e4:	77 15                	ja     8008fb <vprintfmt+0x543>
+  8008e6:	89 c2                	mov    %eax,%edx
+  8008e8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008ec:	83 c0 08             	add    $0x8,%eax
+  8008ef:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008f2:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8008f4:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8008f9:	eb 7d                	jmp    800978 <vprintfmt+0x5c0>
+  8008fb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008ff:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800903:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800907:	eb e9                	jmp    8008f2 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800909:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80090c:	83 f8 2f             	cmp    $0x2f,%eax
+  80090f:	77 16                	ja     800927 <vprintfmt+0x56f>
+  800911:	89 c2                	mov    %eax,%edx
+  800913:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800917:	83 c0 08             	add    $0x8,%eax
+  80091a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80091d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800920:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800925:	eb 51                	jmp    800978 <vprintfmt+0x5c0>
+  800927:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80092b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80092f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800933:	eb e8                	jmp    80091d <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800935:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800939:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80093d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800941:	e9 5c ff ff ff       	jmp    8008a2 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800946:	4c 89 ee             	mov    %r13,%rsi
+  800949:	bf 30 00 00 00       	mov    $0x30,%edi
+  80094e:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800951:	4c 89 ee             	mov    %r13,%rsi
+  800954:	bf 78 00 00 00       	mov    $0x78,%edi
+  800959:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  80095c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80095f:	83 f8 2f             	cmp    $0x2f,%eax
+  800962:	77 47                	ja     8009ab <vprintfmt+0x5f3>
+  800964:	89 c2                	mov    %eax,%edx
+  800966:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80096a:	83 c0 08             	add    $0x8,%eax
+  80096d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800970:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800973:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800978:	48 83 ec 08          	sub    $0x8,%rsp
+  80097c:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800980:	0f 94 c0             	sete   %al
+  800983:	0f b6 c0             	movzbl %al,%eax
+  800986:	50                   	push   %rax
+  800987:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  80098c:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800990:	4c 89 ee             	mov    %r13,%rsi
+  800993:	4c 89 f7             	mov    %r14,%rdi
+  800996:	48 b8 ad 02 80 00 00 	movabs $0x8002ad,%rax
+  80099d:	00 00 00 
+  8009a0:	ff d0                	call   *%rax
+            break;
+  8009a2:	48 83 c4 10          	add    $0x10,%rsp
+  8009a6:	e9 3e fa ff ff       	jmp    8003e9 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  8009ab:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009af:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009b3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009b7:	eb b7                	jmp    800970 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  8009b9:	40 84 f6             	test   %sil,%sil
+  8009bc:	75 2b                	jne    8009e9 <vprintfmt+0x631>
+    switch (lflag) {
+  8009be:	85 d2                	test   %edx,%edx
+  8009c0:	74 56                	je     800a18 <vprintfmt+0x660>
+  8009c2:	83 fa 01             	cmp    $0x1,%edx
+  8009c5:	74 7f                	je     800a46 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  8009c7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009ca:	83 f8 2f             	cmp    $0x2f,%eax
+  8009cd:	0f 87 a2 00 00 00    	ja     800a75 <vprintfmt+0x6bd>
+  8009d3:	89 c2                	mov    %eax,%edx
+  8009d5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009d9:	83 c0 08             	add    $0x8,%eax
+  8009dc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009df:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009e2:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8009e7:	eb 8f                	jmp    800978 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009e9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009ec:	83 f8 2f             	cmp    $0x2f,%eax
+  8009ef:	77 19                	ja     800a0a <vprintfmt+0x652>
+  8009f1:	89 c2                	mov    %eax,%edx
+  8009f3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009f7:	83 c0 08             	add    $0x8,%eax
+  8009fa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009fd:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a00:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a05:	e9 6e ff ff ff       	jmp    800978 <vprintfmt+0x5c0>
+  800a0a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a0e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a12:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a16:	eb e5                	jmp    8009fd <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800a18:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a1b:	83 f8 2f             	cmp    $0x2f,%eax
+  800a1e:	77 18                	ja     800a38 <vprintfmt+0x680>
+  800a20:	89 c2                	mov    %eax,%edx
+  800a22:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a26:	83 c0 08             	add    $0x8,%eax
+  800a29:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a2c:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800a2e:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800a33:	e9 40 ff ff ff       	jmp    800978 <vprintfmt+0x5c0>
+  800a38:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a3c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a40:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a44:	eb e6                	jmp    800a2c <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800a46:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a49:	83 f8 2f             	cmp    $0x2f,%eax
+  800a4c:	77 19                	ja     800a67 <vprintfmt+0x6af>
+  800a4e:	89 c2                	mov    %eax,%edx
+  800a50:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a54:	83 c0 08             	add    $0x8,%eax
+  800a57:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a5a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a5d:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800a62:	e9 11 ff ff ff       	jmp    800978 <vprintfmt+0x5c0>
+  800a67:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a6b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a6f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a73:	eb e5                	jmp    800a5a <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800a75:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a79:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a7d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a81:	e9 59 ff ff ff       	jmp    8009df <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800a86:	4c 89 ee             	mov    %r13,%rsi
+  800a89:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a8e:	41 ff d6             	call   *%r14
+            break;
+  800a91:	e9 53 f9 ff ff       	jmp    8003e9 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800a96:	4c 89 ee             	mov    %r13,%rsi
+  800a99:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a9e:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800aa1:	48 83 eb 01          	sub    $0x1,%rbx
+  800aa5:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800aa9:	75 f6                	jne    800aa1 <vprintfmt+0x6e9>
+  800aab:	e9 39 f9 ff ff       	jmp    8003e9 <vprintfmt+0x31>
+}
+  800ab0:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800ab4:	5b                   	pop    %rbx
+  800ab5:	41 5c                	pop    %r12
+  800ab7:	41 5d                	pop    %r13
+  800ab9:	41 5e                	pop    %r14
+  800abb:	41 5f                	pop    %r15
+  800abd:	5d                   	pop    %rbp
+  800abe:	c3                   	ret
+
+0000000000800abf <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800abf:	55                   	push   %rbp
+  800ac0:	48 89 e5             	mov    %rsp,%rbp
+  800ac3:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800ac7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800acb:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800ad0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800ad4:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800adb:	48 85 ff             	test   %rdi,%rdi
+  800ade:	74 2b                	je     800b0b <vsnprintf+0x4c>
+  800ae0:	48 85 f6             	test   %rsi,%rsi
+  800ae3:	74 26                	je     800b0b <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800ae5:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800ae9:	48 bf 63 03 80 00 00 	movabs $0x800363,%rdi
+  800af0:	00 00 00 
+  800af3:	48 b8 b8 03 80 00 00 	movabs $0x8003b8,%rax
+  800afa:	00 00 00 
+  800afd:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800aff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b03:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800b06:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800b09:	c9                   	leave
+  800b0a:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800b0b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b10:	eb f7                	jmp    800b09 <vsnprintf+0x4a>
+
+0000000000800b12 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800b12:	55                   	push   %rbp
+  800b13:	48 89 e5             	mov    %rsp,%rbp
+  800b16:	48 83 ec 50          	sub    $0x50,%rsp
+  800b1a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800b1e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800b22:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800b26:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800b2d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800b31:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b35:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800b39:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800b3d:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800b41:	48 b8 bf 0a 80 00 00 	movabs $0x800abf,%rax
+  800b48:	00 00 00 
+  800b4b:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800b4d:	c9                   	leave
+  800b4e:	c3                   	ret
+
+0000000000800b4f <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800b4f:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800b52:	74 10                	je     800b64 <strlen+0x15>
+    size_t n = 0;
+  800b54:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800b59:	48 83 c0 01          	add    $0x1,%rax
+  800b5d:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800b61:	75 f6                	jne    800b59 <strlen+0xa>
+  800b63:	c3                   	ret
+    size_t n = 0;
+  800b64:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800b69:	c3                   	ret
+
+0000000000800b6a <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800b6a:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800b6d:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800b72:	48 85 f6             	test   %rsi,%rsi
+  800b75:	74 11                	je     800b88 <strnlen+0x1e>
+  800b77:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800b7b:	74 0c                	je     800b89 <strnlen+0x1f>
+  800b7d:	48 83 c2 01          	add    $0x1,%rdx
+  800b81:	48 39 d0             	cmp    %rdx,%rax
+  800b84:	75 f1                	jne    800b77 <strnlen+0xd>
+  800b86:	eb 04                	jmp    800b8c <strnlen+0x22>
+  800b88:	c3                   	ret
+  800b89:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800b8c:	c3                   	ret
+
+0000000000800b8d <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800b8d:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800b90:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b95:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800b99:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800b9c:	48 83 c2 01          	add    $0x1,%rdx
+  800ba0:	84 c9                	test   %cl,%cl
+  800ba2:	75 f1                	jne    800b95 <strcpy+0x8>
+        ;
+    return res;
+}
+  800ba4:	c3                   	ret
+
+0000000000800ba5 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800ba5:	55                   	push   %rbp
+  800ba6:	48 89 e5             	mov    %rsp,%rbp
+  800ba9:	41 54                	push   %r12
+  800bab:	53                   	push   %rbx
+  800bac:	48 89 fb             	mov    %rdi,%rbx
+  800baf:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800bb2:	48 b8 4f 0b 80 00 00 	movabs $0x800b4f,%rax
+  800bb9:	00 00 00 
+  800bbc:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800bbe:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800bc2:	4c 89 e6             	mov    %r12,%rsi
+  800bc5:	48 b8 8d 0b 80 00 00 	movabs $0x800b8d,%rax
+  800bcc:	00 00 00 
+  800bcf:	ff d0                	call   *%rax
+    return dst;
+}
+  800bd1:	48 89 d8             	mov    %rbx,%rax
+  800bd4:	5b                   	pop    %rbx
+  800bd5:	41 5c                	pop    %r12
+  800bd7:	5d                   	pop    %rbp
+  800bd8:	c3                   	ret
+
+0000000000800bd9 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800bd9:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800bdc:	48 85 d2             	test   %rdx,%rdx
+  800bdf:	74 1f                	je     800c00 <strncpy+0x27>
+  800be1:	48 01 fa             	add    %rdi,%rdx
+  800be4:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800be7:	48 83 c1 01          	add    $0x1,%rcx
+  800beb:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800bef:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800bf3:	41 80 f8 01          	cmp    $0x1,%r8b
+  800bf7:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800bfb:	48 39 ca             	cmp    %rcx,%rdx
+  800bfe:	75 e7                	jne    800be7 <strncpy+0xe>
+    }
+    return ret;
+}
+  800c00:	c3                   	ret
+
+0000000000800c01 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800c01:	48 89 f8             	mov    %rdi,%rax
+  800c04:	48 85 d2             	test   %rdx,%rdx
+  800c07:	74 24                	je     800c2d <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800c09:	48 83 ea 01          	sub    $0x1,%rdx
+  800c0d:	74 1b                	je     800c2a <strlcpy+0x29>
+  800c0f:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800c13:	0f b6 16             	movzbl (%rsi),%edx
+  800c16:	84 d2                	test   %dl,%dl
+  800c18:	74 10                	je     800c2a <strlcpy+0x29>
+            *dst++ = *src++;
+  800c1a:	48 83 c6 01          	add    $0x1,%rsi
+  800c1e:	48 83 c0 01          	add    $0x1,%rax
+  800c22:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800c25:	48 39 c8             	cmp    %rcx,%rax
+  800c28:	75 e9                	jne    800c13 <strlcpy+0x12>
+        *dst = '\0';
+  800c2a:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800c2d:	48 29 f8             	sub    %rdi,%rax
+}
+  800c30:	c3                   	ret
+
+0000000000800c31 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800c31:	0f b6 07             	movzbl (%rdi),%eax
+  800c34:	84 c0                	test   %al,%al
+  800c36:	74 13                	je     800c4b <strcmp+0x1a>
+  800c38:	38 06                	cmp    %al,(%rsi)
+  800c3a:	75 0f                	jne    800c4b <strcmp+0x1a>
+  800c3c:	48 83 c7 01          	add    $0x1,%rdi
+  800c40:	48 83 c6 01          	add    $0x1,%rsi
+  800c44:	0f b6 07             	movzbl (%rdi),%eax
+  800c47:	84 c0                	test   %al,%al
+  800c49:	75 ed                	jne    800c38 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c4b:	0f b6 c0             	movzbl %al,%eax
+  800c4e:	0f b6 16             	movzbl (%rsi),%edx
+  800c51:	29 d0                	sub    %edx,%eax
+}
+  800c53:	c3                   	ret
+
+0000000000800c54 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800c54:	48 85 d2             	test   %rdx,%rdx
+  800c57:	74 1f                	je     800c78 <strncmp+0x24>
+  800c59:	0f b6 07             	movzbl (%rdi),%eax
+  800c5c:	84 c0                	test   %al,%al
+  800c5e:	74 1e                	je     800c7e <strncmp+0x2a>
+  800c60:	3a 06                	cmp    (%rsi),%al
+  800c62:	75 1a                	jne    800c7e <strncmp+0x2a>
+  800c64:	48 83 c7 01          	add    $0x1,%rdi
+  800c68:	48 83 c6 01          	add    $0x1,%rsi
+  800c6c:	48 83 ea 01          	sub    $0x1,%rdx
+  800c70:	75 e7                	jne    800c59 <strncmp+0x5>
+
+    if (!n) return 0;
+  800c72:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c77:	c3                   	ret
+  800c78:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c7d:	c3                   	ret
+  800c7e:	48 85 d2             	test   %rdx,%rdx
+  800c81:	74 09                	je     800c8c <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c83:	0f b6 07             	movzbl (%rdi),%eax
+  800c86:	0f b6 16             	movzbl (%rsi),%edx
+  800c89:	29 d0                	sub    %edx,%eax
+  800c8b:	c3                   	ret
+    if (!n) return 0;
+  800c8c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c91:	c3                   	ret
+
+0000000000800c92 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800c92:	0f b6 17             	movzbl (%rdi),%edx
+  800c95:	84 d2                	test   %dl,%dl
+  800c97:	74 18                	je     800cb1 <strchr+0x1f>
+        if (*str == c) {
+  800c99:	0f be d2             	movsbl %dl,%edx
+  800c9c:	39 f2                	cmp    %esi,%edx
+  800c9e:	74 17                	je     800cb7 <strchr+0x25>
+    for (; *str; str++) {
+  800ca0:	48 83 c7 01          	add    $0x1,%rdi
+  800ca4:	0f b6 17             	movzbl (%rdi),%edx
+  800ca7:	84 d2                	test   %dl,%dl
+  800ca9:	75 ee                	jne    800c99 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800cab:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cb0:	c3                   	ret
+  800cb1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cb6:	c3                   	ret
+  800cb7:	48 89 f8             	mov    %rdi,%rax
+}
+  800cba:	c3                   	ret
+
+0000000000800cbb <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800cbb:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800cbe:	0f b6 17             	movzbl (%rdi),%edx
+  800cc1:	84 d2                	test   %dl,%dl
+  800cc3:	74 13                	je     800cd8 <strfind+0x1d>
+  800cc5:	0f be d2             	movsbl %dl,%edx
+  800cc8:	39 f2                	cmp    %esi,%edx
+  800cca:	74 0b                	je     800cd7 <strfind+0x1c>
+  800ccc:	48 83 c0 01          	add    $0x1,%rax
+  800cd0:	0f b6 10             	movzbl (%rax),%edx
+  800cd3:	84 d2                	test   %dl,%dl
+  800cd5:	75 ee                	jne    800cc5 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800cd7:	c3                   	ret
+  800cd8:	c3                   	ret
+
+0000000000800cd9 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800cd9:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800cdc:	48 89 f8             	mov    %rdi,%rax
+  800cdf:	48 f7 d8             	neg    %rax
+  800ce2:	83 e0 07             	and    $0x7,%eax
+  800ce5:	49 89 d1             	mov    %rdx,%r9
+  800ce8:	49 29 c1             	sub    %rax,%r9
+  800ceb:	78 36                	js     800d23 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800ced:	40 0f b6 c6          	movzbl %sil,%eax
+  800cf1:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800cf8:	01 01 01 
+  800cfb:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800cff:	40 f6 c7 07          	test   $0x7,%dil
+  800d03:	75 38                	jne    800d3d <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800d05:	4c 89 c9             	mov    %r9,%rcx
+  800d08:	48 c1 f9 03          	sar    $0x3,%rcx
+  800d0c:	74 0c                	je     800d1a <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800d0e:	fc                   	cld
+  800d0f:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800d12:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800d16:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800d1a:	4d 85 c9             	test   %r9,%r9
+  800d1d:	75 45                	jne    800d64 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800d1f:	4c 89 c0             	mov    %r8,%rax
+  800d22:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800d23:	48 85 d2             	test   %rdx,%rdx
+  800d26:	74 f7                	je     800d1f <memset+0x46>
+  800d28:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800d2b:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800d2e:	48 83 c0 01          	add    $0x1,%rax
+  800d32:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800d36:	48 39 c2             	cmp    %rax,%rdx
+  800d39:	75 f3                	jne    800d2e <memset+0x55>
+  800d3b:	eb e2                	jmp    800d1f <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800d3d:	40 f6 c7 01          	test   $0x1,%dil
+  800d41:	74 06                	je     800d49 <memset+0x70>
+  800d43:	88 07                	mov    %al,(%rdi)
+  800d45:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800d49:	40 f6 c7 02          	test   $0x2,%dil
+  800d4d:	74 07                	je     800d56 <memset+0x7d>
+  800d4f:	66 89 07             	mov    %ax,(%rdi)
+  800d52:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800d56:	40 f6 c7 04          	test   $0x4,%dil
+  800d5a:	74 a9                	je     800d05 <memset+0x2c>
+  800d5c:	89 07                	mov    %eax,(%rdi)
+  800d5e:	48 83 c7 04          	add    $0x4,%rdi
+  800d62:	eb a1                	jmp    800d05 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800d64:	41 f6 c1 04          	test   $0x4,%r9b
+  800d68:	74 06                	je     800d70 <memset+0x97>
+  800d6a:	89 07                	mov    %eax,(%rdi)
+  800d6c:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800d70:	41 f6 c1 02          	test   $0x2,%r9b
+  800d74:	74 07                	je     800d7d <memset+0xa4>
+  800d76:	66 89 07             	mov    %ax,(%rdi)
+  800d79:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800d7d:	41 f6 c1 01          	test   $0x1,%r9b
+  800d81:	74 9c                	je     800d1f <memset+0x46>
+  800d83:	88 07                	mov    %al,(%rdi)
+  800d85:	eb 98                	jmp    800d1f <memset+0x46>
+
+0000000000800d87 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800d87:	48 89 f8             	mov    %rdi,%rax
+  800d8a:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800d8d:	48 39 fe             	cmp    %rdi,%rsi
+  800d90:	73 3b                	jae    800dcd <memmove+0x46>
+  800d92:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800d96:	48 39 d7             	cmp    %rdx,%rdi
+  800d99:	73 32                	jae    800dcd <memmove+0x46>
+        s += n;
+        d += n;
+  800d9b:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d9f:	48 89 d6             	mov    %rdx,%rsi
+  800da2:	48 09 fe             	or     %rdi,%rsi
+  800da5:	48 09 ce             	or     %rcx,%rsi
+  800da8:	40 f6 c6 07          	test   $0x7,%sil
+  800dac:	75 12                	jne    800dc0 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800dae:	48 83 ef 08          	sub    $0x8,%rdi
+  800db2:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800db6:	48 c1 e9 03          	shr    $0x3,%rcx
+  800dba:	fd                   	std
+  800dbb:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800dbe:	fc                   	cld
+  800dbf:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800dc0:	48 83 ef 01          	sub    $0x1,%rdi
+  800dc4:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800dc8:	fd                   	std
+  800dc9:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800dcb:	eb f1                	jmp    800dbe <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800dcd:	48 89 f2             	mov    %rsi,%rdx
+  800dd0:	48 09 c2             	or     %rax,%rdx
+  800dd3:	48 09 ca             	or     %rcx,%rdx
+  800dd6:	f6 c2 07             	test   $0x7,%dl
+  800dd9:	75 0c                	jne    800de7 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800ddb:	48 c1 e9 03          	shr    $0x3,%rcx
+  800ddf:	48 89 c7             	mov    %rax,%rdi
+  800de2:	fc                   	cld
+  800de3:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800de6:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800de7:	48 89 c7             	mov    %rax,%rdi
+  800dea:	fc                   	cld
+  800deb:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800ded:	c3                   	ret
+
+0000000000800dee <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800dee:	55                   	push   %rbp
+  800def:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800df2:	48 b8 87 0d 80 00 00 	movabs $0x800d87,%rax
+  800df9:	00 00 00 
+  800dfc:	ff d0                	call   *%rax
+}
+  800dfe:	5d                   	pop    %rbp
+  800dff:	c3                   	ret
+
+0000000000800e00 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800e00:	55                   	push   %rbp
+  800e01:	48 89 e5             	mov    %rsp,%rbp
+  800e04:	41 57                	push   %r15
+  800e06:	41 56                	push   %r14
+  800e08:	41 55                	push   %r13
+  800e0a:	41 54                	push   %r12
+  800e0c:	53                   	push   %rbx
+  800e0d:	48 83 ec 08          	sub    $0x8,%rsp
+  800e11:	49 89 fe             	mov    %rdi,%r14
+  800e14:	49 89 f7             	mov    %rsi,%r15
+  800e17:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800e1a:	48 89 f7             	mov    %rsi,%rdi
+  800e1d:	48 b8 4f 0b 80 00 00 	movabs $0x800b4f,%rax
+  800e24:	00 00 00 
+  800e27:	ff d0                	call   *%rax
+  800e29:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800e2c:	48 89 de             	mov    %rbx,%rsi
+  800e2f:	4c 89 f7             	mov    %r14,%rdi
+  800e32:	48 b8 6a 0b 80 00 00 	movabs $0x800b6a,%rax
+  800e39:	00 00 00 
+  800e3c:	ff d0                	call   *%rax
+  800e3e:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800e41:	48 39 c3             	cmp    %rax,%rbx
+  800e44:	74 36                	je     800e7c <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800e46:	48 89 d8             	mov    %rbx,%rax
+  800e49:	4c 29 e8             	sub    %r13,%rax
+  800e4c:	49 39 c4             	cmp    %rax,%r12
+  800e4f:	73 31                	jae    800e82 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800e51:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800e56:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e5a:	4c 89 fe             	mov    %r15,%rsi
+  800e5d:	48 b8 ee 0d 80 00 00 	movabs $0x800dee,%rax
+  800e64:	00 00 00 
+  800e67:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800e69:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800e6d:	48 83 c4 08          	add    $0x8,%rsp
+  800e71:	5b                   	pop    %rbx
+  800e72:	41 5c                	pop    %r12
+  800e74:	41 5d                	pop    %r13
+  800e76:	41 5e                	pop    %r14
+  800e78:	41 5f                	pop    %r15
+  800e7a:	5d                   	pop    %rbp
+  800e7b:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800e7c:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800e80:	eb eb                	jmp    800e6d <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800e82:	48 83 eb 01          	sub    $0x1,%rbx
+  800e86:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e8a:	48 89 da             	mov    %rbx,%rdx
+  800e8d:	4c 89 fe             	mov    %r15,%rsi
+  800e90:	48 b8 ee 0d 80 00 00 	movabs $0x800dee,%rax
+  800e97:	00 00 00 
+  800e9a:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800e9c:	49 01 de             	add    %rbx,%r14
+  800e9f:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800ea4:	eb c3                	jmp    800e69 <strlcat+0x69>
+
+0000000000800ea6 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800ea6:	48 85 d2             	test   %rdx,%rdx
+  800ea9:	74 2d                	je     800ed8 <memcmp+0x32>
+  800eab:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800eb0:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800eb4:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800eb9:	44 38 c1             	cmp    %r8b,%cl
+  800ebc:	75 0f                	jne    800ecd <memcmp+0x27>
+    while (n-- > 0) {
+  800ebe:	48 83 c0 01          	add    $0x1,%rax
+  800ec2:	48 39 c2             	cmp    %rax,%rdx
+  800ec5:	75 e9                	jne    800eb0 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800ec7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ecc:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800ecd:	0f b6 c1             	movzbl %cl,%eax
+  800ed0:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800ed4:	44 29 c0             	sub    %r8d,%eax
+  800ed7:	c3                   	ret
+    return 0;
+  800ed8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800edd:	c3                   	ret
+
+0000000000800ede <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800ede:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800ee2:	48 39 c7             	cmp    %rax,%rdi
+  800ee5:	73 0f                	jae    800ef6 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800ee7:	40 38 37             	cmp    %sil,(%rdi)
+  800eea:	74 0e                	je     800efa <memfind+0x1c>
+    for (; src < end; src++) {
+  800eec:	48 83 c7 01          	add    $0x1,%rdi
+  800ef0:	48 39 f8             	cmp    %rdi,%rax
+  800ef3:	75 f2                	jne    800ee7 <memfind+0x9>
+  800ef5:	c3                   	ret
+  800ef6:	48 89 f8             	mov    %rdi,%rax
+  800ef9:	c3                   	ret
+  800efa:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800efd:	c3                   	ret
+
+0000000000800efe <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800efe:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800f01:	0f b6 37             	movzbl (%rdi),%esi
+  800f04:	40 80 fe 20          	cmp    $0x20,%sil
+  800f08:	74 06                	je     800f10 <strtol+0x12>
+  800f0a:	40 80 fe 09          	cmp    $0x9,%sil
+  800f0e:	75 13                	jne    800f23 <strtol+0x25>
+  800f10:	48 83 c7 01          	add    $0x1,%rdi
+  800f14:	0f b6 37             	movzbl (%rdi),%esi
+  800f17:	40 80 fe 20          	cmp    $0x20,%sil
+  800f1b:	74 f3                	je     800f10 <strtol+0x12>
+  800f1d:	40 80 fe 09          	cmp    $0x9,%sil
+  800f21:	74 ed                	je     800f10 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800f23:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800f26:	83 e0 fd             	and    $0xfffffffd,%eax
+  800f29:	3c 01                	cmp    $0x1,%al
+  800f2b:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f2f:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800f35:	75 0f                	jne    800f46 <strtol+0x48>
+  800f37:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800f3a:	74 14                	je     800f50 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800f3c:	85 d2                	test   %edx,%edx
+  800f3e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f43:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800f46:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800f4b:	4c 63 ca             	movslq %edx,%r9
+  800f4e:	eb 36                	jmp    800f86 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f50:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800f54:	74 0f                	je     800f65 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800f56:	85 d2                	test   %edx,%edx
+  800f58:	75 ec                	jne    800f46 <strtol+0x48>
+        s++;
+  800f5a:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800f5e:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800f63:	eb e1                	jmp    800f46 <strtol+0x48>
+        s += 2;
+  800f65:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800f69:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800f6e:	eb d6                	jmp    800f46 <strtol+0x48>
+            dig -= '0';
+  800f70:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800f73:	44 0f b6 c1          	movzbl %cl,%r8d
+  800f77:	41 39 d0             	cmp    %edx,%r8d
+  800f7a:	7d 21                	jge    800f9d <strtol+0x9f>
+        val = val * base + dig;
+  800f7c:	49 0f af c1          	imul   %r9,%rax
+  800f80:	0f b6 c9             	movzbl %cl,%ecx
+  800f83:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800f86:	48 83 c7 01          	add    $0x1,%rdi
+  800f8a:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800f8e:	80 f9 39             	cmp    $0x39,%cl
+  800f91:	76 dd                	jbe    800f70 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800f93:	80 f9 7b             	cmp    $0x7b,%cl
+  800f96:	77 05                	ja     800f9d <strtol+0x9f>
+            dig -= 'a' - 10;
+  800f98:	83 e9 57             	sub    $0x57,%ecx
+  800f9b:	eb d6                	jmp    800f73 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800f9d:	4d 85 d2             	test   %r10,%r10
+  800fa0:	74 03                	je     800fa5 <strtol+0xa7>
+  800fa2:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800fa5:	48 89 c2             	mov    %rax,%rdx
+  800fa8:	48 f7 da             	neg    %rdx
+  800fab:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800faf:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800fb3:	c3                   	ret
+
+0000000000800fb4 <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  800fb4:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800fb9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fbe:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800fc4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800fca:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  800fd0:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800fd2:	c3                   	ret
+
+0000000000800fd3 <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  800fd3:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800fd8:	bf 00 00 00 00       	mov    $0x0,%edi
+  800fdd:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800fe2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fe7:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800fed:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800ff3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800ff9:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800ffb:	c3                   	ret
+
+0000000000800ffc <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800ffc:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800fff:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801004:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801009:	ba 00 00 00 00       	mov    $0x0,%edx
+  80100e:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801014:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80101a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801020:	0f 05                	syscall
+    if (check && ret > 0) {
+  801022:	48 85 c0             	test   %rax,%rax
+  801025:	7f 01                	jg     801028 <sys_env_destroy+0x2c>
+}
+  801027:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  801028:	55                   	push   %rbp
+  801029:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80102c:	49 89 c0             	mov    %rax,%r8
+  80102f:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801034:	48 ba 58 4e 80 00 00 	movabs $0x804e58,%rdx
+  80103b:	00 00 00 
+  80103e:	be 29 00 00 00       	mov    $0x29,%esi
+  801043:	48 bf 77 4e 80 00 00 	movabs $0x804e77,%rdi
+  80104a:	00 00 00 
+  80104d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801052:	49 b9 2a 43 80 00 00 	movabs $0x80432a,%r9
+  801059:	00 00 00 
+  80105c:	41 ff d1             	call   *%r9
+
+000000000080105f <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  80105f:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801064:	bf 00 00 00 00       	mov    $0x0,%edi
+  801069:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80106e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801073:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801079:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80107f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801085:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801087:	c3                   	ret
+
+0000000000801088 <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  801088:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80108d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801092:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801097:	ba 00 00 00 00       	mov    $0x0,%edx
+  80109c:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8010a2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8010a8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8010ae:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8010b0:	c3                   	ret
+
+00000000008010b1 <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  8010b1:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8010b6:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  8010bd:	00 00 00 
+  8010c0:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8010c6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8010cc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8010d2:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8010d4:	c3                   	ret
+
+00000000008010d5 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8010d5:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  8010d8:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8010dd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8010e3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8010e9:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8010eb:	c3                   	ret
+
+00000000008010ec <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8010ec:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8010ef:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8010f4:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8010f7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8010fd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801103:	0f 05                	syscall
+    if (check && ret > 0) {
+  801105:	48 85 c0             	test   %rax,%rax
+  801108:	7f 01                	jg     80110b <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80110a:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80110b:	55                   	push   %rbp
+  80110c:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80110f:	49 89 c0             	mov    %rax,%r8
+  801112:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801117:	48 ba 58 4e 80 00 00 	movabs $0x804e58,%rdx
+  80111e:	00 00 00 
+  801121:	be 29 00 00 00       	mov    $0x29,%esi
+  801126:	48 bf 77 4e 80 00 00 	movabs $0x804e77,%rdi
+  80112d:	00 00 00 
+  801130:	b8 00 00 00 00       	mov    $0x0,%eax
+  801135:	49 b9 2a 43 80 00 00 	movabs $0x80432a,%r9
+  80113c:	00 00 00 
+  80113f:	41 ff d1             	call   *%r9
+
+0000000000801142 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801142:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801145:	48 63 d2             	movslq %edx,%rdx
+  801148:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80114b:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801150:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  801153:	0f 05                	syscall
+    if (check && ret > 0) {
+  801155:	48 85 c0             	test   %rax,%rax
+  801158:	7f 01                	jg     80115b <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80115a:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80115b:	55                   	push   %rbp
+  80115c:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80115f:	49 89 c0             	mov    %rax,%r8
+  801162:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801167:	48 ba 58 4e 80 00 00 	movabs $0x804e58,%rdx
+  80116e:	00 00 00 
+  801171:	be 29 00 00 00       	mov    $0x29,%esi
+  801176:	48 bf 77 4e 80 00 00 	movabs $0x804e77,%rdi
+  80117d:	00 00 00 
+  801180:	b8 00 00 00 00       	mov    $0x0,%eax
+  801185:	49 b9 2a 43 80 00 00 	movabs $0x80432a,%r9
+  80118c:	00 00 00 
+  80118f:	41 ff d1             	call   *%r9
+
+0000000000801192 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801192:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801195:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80119a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8011a0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011a6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8011ac:	0f 05                	syscall
+    if (check && ret > 0) {
+  8011ae:	48 85 c0             	test   %rax,%rax
+  8011b1:	7f 01                	jg     8011b4 <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8011b3:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8011b4:	55                   	push   %rbp
+  8011b5:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011b8:	49 89 c0             	mov    %rax,%r8
+  8011bb:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8011c0:	48 ba 58 4e 80 00 00 	movabs $0x804e58,%rdx
+  8011c7:	00 00 00 
+  8011ca:	be 29 00 00 00       	mov    $0x29,%esi
+  8011cf:	48 bf 77 4e 80 00 00 	movabs $0x804e77,%rdi
+  8011d6:	00 00 00 
+  8011d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011de:	49 b9 2a 43 80 00 00 	movabs $0x80432a,%r9
+  8011e5:	00 00 00 
+  8011e8:	41 ff d1             	call   *%r9
+
+00000000008011eb <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8011eb:	48 63 f6             	movslq %esi,%rsi
+  8011ee:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8011f1:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8011f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011fb:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801201:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801207:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80120d:	0f 05                	syscall
+    if (check && ret > 0) {
+  80120f:	48 85 c0             	test   %rax,%rax
+  801212:	7f 01                	jg     801215 <sys_env_set_status+0x2a>
+}
+  801214:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  801215:	55                   	push   %rbp
+  801216:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801219:	49 89 c0             	mov    %rax,%r8
+  80121c:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801221:	48 ba 58 4e 80 00 00 	movabs $0x804e58,%rdx
+  801228:	00 00 00 
+  80122b:	be 29 00 00 00       	mov    $0x29,%esi
+  801230:	48 bf 77 4e 80 00 00 	movabs $0x804e77,%rdi
+  801237:	00 00 00 
+  80123a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80123f:	49 b9 2a 43 80 00 00 	movabs $0x80432a,%r9
+  801246:	00 00 00 
+  801249:	41 ff d1             	call   *%r9
+
+000000000080124c <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80124c:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80124f:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801254:	ba 00 00 00 00       	mov    $0x0,%edx
+  801259:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80125f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801265:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80126b:	0f 05                	syscall
+    if (check && ret > 0) {
+  80126d:	48 85 c0             	test   %rax,%rax
+  801270:	7f 01                	jg     801273 <sys_env_set_trapframe+0x27>
+}
+  801272:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801273:	55                   	push   %rbp
+  801274:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801277:	49 89 c0             	mov    %rax,%r8
+  80127a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80127f:	48 ba 58 4e 80 00 00 	movabs $0x804e58,%rdx
+  801286:	00 00 00 
+  801289:	be 29 00 00 00       	mov    $0x29,%esi
+  80128e:	48 bf 77 4e 80 00 00 	movabs $0x804e77,%rdi
+  801295:	00 00 00 
+  801298:	b8 00 00 00 00       	mov    $0x0,%eax
+  80129d:	49 b9 2a 43 80 00 00 	movabs $0x80432a,%r9
+  8012a4:	00 00 00 
+  8012a7:	41 ff d1             	call   *%r9
+
+00000000008012aa <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8012aa:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8012ad:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8012b2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012b7:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8012bd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8012c3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8012c9:	0f 05                	syscall
+    if (check && ret > 0) {
+  8012cb:	48 85 c0             	test   %rax,%rax
+  8012ce:	7f 01                	jg     8012d1 <sys_env_set_pgfault_upcall+0x27>
+}
+  8012d0:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8012d1:	55                   	push   %rbp
+  8012d2:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012d5:	49 89 c0             	mov    %rax,%r8
+  8012d8:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8012dd:	48 ba 58 4e 80 00 00 	movabs $0x804e58,%rdx
+  8012e4:	00 00 00 
+  8012e7:	be 29 00 00 00       	mov    $0x29,%esi
+  8012ec:	48 bf 77 4e 80 00 00 	movabs $0x804e77,%rdi
+  8012f3:	00 00 00 
+  8012f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012fb:	49 b9 2a 43 80 00 00 	movabs $0x80432a,%r9
+  801302:	00 00 00 
+  801305:	41 ff d1             	call   *%r9
+
+0000000000801308 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801308:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80130b:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80130e:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801313:	4d 63 c0             	movslq %r8d,%r8
+  801316:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80131c:	0f 05                	syscall
+}
+  80131e:	c3                   	ret
+
+000000000080131f <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80131f:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801322:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801325:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80132a:	4d 63 c0             	movslq %r8d,%r8
+  80132d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801333:	0f 05                	syscall
+}
+  801335:	c3                   	ret
+
+0000000000801336 <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  801336:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80133b:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80133e:	45 89 c0             	mov    %r8d,%r8d
+  801341:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801347:	0f 05                	syscall
+    if (check && ret > 0) {
+  801349:	48 85 c0             	test   %rax,%rax
+  80134c:	7f 01                	jg     80134f <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80134e:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  80134f:	55                   	push   %rbp
+  801350:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801353:	49 89 c0             	mov    %rax,%r8
+  801356:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  80135b:	48 ba 58 4e 80 00 00 	movabs $0x804e58,%rdx
+  801362:	00 00 00 
+  801365:	be 29 00 00 00       	mov    $0x29,%esi
+  80136a:	48 bf 77 4e 80 00 00 	movabs $0x804e77,%rdi
+  801371:	00 00 00 
+  801374:	b8 00 00 00 00       	mov    $0x0,%eax
+  801379:	49 b9 2a 43 80 00 00 	movabs $0x80432a,%r9
+  801380:	00 00 00 
+  801383:	41 ff d1             	call   *%r9
+
+0000000000801386 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  801386:	55                   	push   %rbp
+  801387:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  80138a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801390:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801395:	ba 00 00 00 00       	mov    $0x0,%edx
+  80139a:	48 b8 36 13 80 00 00 	movabs $0x801336,%rax
+  8013a1:	00 00 00 
+  8013a4:	ff d0                	call   *%rax
+}
+  8013a6:	5d                   	pop    %rbp
+  8013a7:	c3                   	ret
+
+00000000008013a8 <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  8013a8:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8013ad:	bf 00 00 00 00       	mov    $0x0,%edi
+  8013b2:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8013b7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013bc:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013c2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013c8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013ce:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8013d0:	c3                   	ret
+
+00000000008013d1 <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  8013d1:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8013d6:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8013db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013e0:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013e6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013ec:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013f2:	0f 05                	syscall
+    if (check && ret > 0) {
+  8013f4:	48 85 c0             	test   %rax,%rax
+  8013f7:	7f 01                	jg     8013fa <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  8013f9:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  8013fa:	55                   	push   %rbp
+  8013fb:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013fe:	49 89 c0             	mov    %rax,%r8
+  801401:	b9 10 00 00 00       	mov    $0x10,%ecx
+  801406:	48 ba 58 4e 80 00 00 	movabs $0x804e58,%rdx
+  80140d:	00 00 00 
+  801410:	be 29 00 00 00       	mov    $0x29,%esi
+  801415:	48 bf 77 4e 80 00 00 	movabs $0x804e77,%rdi
+  80141c:	00 00 00 
+  80141f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801424:	49 b9 2a 43 80 00 00 	movabs $0x80432a,%r9
+  80142b:	00 00 00 
+  80142e:	41 ff d1             	call   *%r9
+
+0000000000801431 <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  801431:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801436:	bf 00 00 00 00       	mov    $0x0,%edi
+  80143b:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801440:	ba 00 00 00 00       	mov    $0x0,%edx
+  801445:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80144b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801451:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801457:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  801459:	c3                   	ret
+
+000000000080145a <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  80145a:	89 d2                	mov    %edx,%edx
+  80145c:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  80145e:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801463:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801469:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80146f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801475:	0f 05                	syscall
+}
+  801477:	c3                   	ret
+
+0000000000801478 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  801478:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  80147b:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801480:	ba 00 00 00 00       	mov    $0x0,%edx
+  801485:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80148b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801491:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801497:	0f 05                	syscall
+}
+  801499:	c3                   	ret
+
+000000000080149a <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  80149a:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  80149d:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8014a2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014a7:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014ad:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014b3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8014b9:	0f 05                	syscall
+}
+  8014bb:	c3                   	ret
+
+00000000008014bc <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  8014bc:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8014bf:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8014c4:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8014c9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014ce:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014d4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014da:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8014e0:	0f 05                	syscall
+    if (check && ret > 0) {
+  8014e2:	48 85 c0             	test   %rax,%rax
+  8014e5:	7f 01                	jg     8014e8 <sys_irq_ack+0x2c>
+}
+  8014e7:	c3                   	ret
+sys_irq_ack(int irq) {
+  8014e8:	55                   	push   %rbp
+  8014e9:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014ec:	49 89 c0             	mov    %rax,%r8
+  8014ef:	b9 16 00 00 00       	mov    $0x16,%ecx
+  8014f4:	48 ba 58 4e 80 00 00 	movabs $0x804e58,%rdx
+  8014fb:	00 00 00 
+  8014fe:	be 29 00 00 00       	mov    $0x29,%esi
+  801503:	48 bf 77 4e 80 00 00 	movabs $0x804e77,%rdi
+  80150a:	00 00 00 
+  80150d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801512:	49 b9 2a 43 80 00 00 	movabs $0x80432a,%r9
+  801519:	00 00 00 
+  80151c:	41 ff d1             	call   *%r9
+
+000000000080151f <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  80151f:	55                   	push   %rbp
+  801520:	48 89 e5             	mov    %rsp,%rbp
+  801523:	41 54                	push   %r12
+  801525:	53                   	push   %rbx
+    // LAB 9: Your code here
+    /* The child would write them out once more */
+    file_flush_buffers();
+  801526:	48 b8 53 2f 80 00 00 	movabs $0x802f53,%rax
+  80152d:	00 00 00 
+  801530:	ff d0                	call   *%rax
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("syscall"
+  801532:	b8 08 00 00 00       	mov    $0x8,%eax
+  801537:	0f 05                	syscall
+  801539:	41 89 c4             	mov    %eax,%r12d
+
+	envid_t envid = sys_exofork();
+    if (envid < 0)
+  80153c:	85 c0                	test   %eax,%eax
+  80153e:	78 7e                	js     8015be <fork+0x9f>
+        return envid;
+    if (envid == 0) {
+  801540:	0f 84 80 00 00 00    	je     8015c6 <fork+0xa7>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE) < 0) {
+  801546:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  80154c:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801553:	00 00 00 
+  801556:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80155b:	89 c2                	mov    %eax,%edx
+  80155d:	be 00 00 00 00       	mov    $0x0,%esi
+  801562:	bf 00 00 00 00       	mov    $0x0,%edi
+  801567:	48 b8 42 11 80 00 00 	movabs $0x801142,%rax
+  80156e:	00 00 00 
+  801571:	ff d0                	call   *%rax
+  801573:	85 c0                	test   %eax,%eax
+  801575:	0f 88 86 00 00 00    	js     801601 <fork+0xe2>
+		return -1;
+	}
+    if (sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall) < 0) {
+  80157b:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801582:	00 00 00 
+  801585:	48 8b b0 28 01 00 00 	mov    0x128(%rax),%rsi
+  80158c:	44 89 e7             	mov    %r12d,%edi
+  80158f:	48 b8 aa 12 80 00 00 	movabs $0x8012aa,%rax
+  801596:	00 00 00 
+  801599:	ff d0                	call   *%rax
+  80159b:	85 c0                	test   %eax,%eax
+  80159d:	78 6a                	js     801609 <fork+0xea>
+		return -1;
+	}
+    if (sys_env_set_status(envid, ENV_RUNNABLE) < 0) {
+  80159f:	be 02 00 00 00       	mov    $0x2,%esi
+  8015a4:	44 89 e7             	mov    %r12d,%edi
+  8015a7:	48 b8 eb 11 80 00 00 	movabs $0x8011eb,%rax
+  8015ae:	00 00 00 
+  8015b1:	ff d0                	call   *%rax
+		return -1;
+  8015b3:	85 c0                	test   %eax,%eax
+  8015b5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8015ba:	44 0f 48 e0          	cmovs  %eax,%r12d
+	}
+    return envid;
+}
+  8015be:	44 89 e0             	mov    %r12d,%eax
+  8015c1:	5b                   	pop    %rbx
+  8015c2:	41 5c                	pop    %r12
+  8015c4:	5d                   	pop    %rbp
+  8015c5:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  8015c6:	48 b8 5f 10 80 00 00 	movabs $0x80105f,%rax
+  8015cd:	00 00 00 
+  8015d0:	ff d0                	call   *%rax
+  8015d2:	89 c2                	mov    %eax,%edx
+  8015d4:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  8015da:	48 89 d0             	mov    %rdx,%rax
+  8015dd:	48 c1 e0 04          	shl    $0x4,%rax
+  8015e1:	48 29 d0             	sub    %rdx,%rax
+  8015e4:	48 c1 e0 05          	shl    $0x5,%rax
+  8015e8:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8015ef:	00 00 00 
+  8015f2:	48 01 d0             	add    %rdx,%rax
+  8015f5:	48 a3 00 00 81 00 00 	movabs %rax,0x810000
+  8015fc:	00 00 00 
+        return 0;
+  8015ff:	eb bd                	jmp    8015be <fork+0x9f>
+		return -1;
+  801601:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801607:	eb b5                	jmp    8015be <fork+0x9f>
+		return -1;
+  801609:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  80160f:	eb ad                	jmp    8015be <fork+0x9f>
+
+0000000000801611 <sfork>:
+
+envid_t
+sfork() {
+  801611:	55                   	push   %rbp
+  801612:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  801615:	48 ba 85 4e 80 00 00 	movabs $0x804e85,%rdx
+  80161c:	00 00 00 
+  80161f:	be 2d 00 00 00       	mov    $0x2d,%esi
+  801624:	48 bf a0 4e 80 00 00 	movabs $0x804ea0,%rdi
+  80162b:	00 00 00 
+  80162e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801633:	48 b9 2a 43 80 00 00 	movabs $0x80432a,%rcx
+  80163a:	00 00 00 
+  80163d:	ff d1                	call   *%rcx
+
+000000000080163f <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80163f:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801646:	ff ff ff 
+  801649:	48 01 f8             	add    %rdi,%rax
+  80164c:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801650:	c3                   	ret
+
+0000000000801651 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801651:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801658:	ff ff ff 
+  80165b:	48 01 f8             	add    %rdi,%rax
+  80165e:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801662:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801668:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80166c:	c3                   	ret
+
+000000000080166d <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  80166d:	55                   	push   %rbp
+  80166e:	48 89 e5             	mov    %rsp,%rbp
+  801671:	41 57                	push   %r15
+  801673:	41 56                	push   %r14
+  801675:	41 55                	push   %r13
+  801677:	41 54                	push   %r12
+  801679:	53                   	push   %rbx
+  80167a:	48 83 ec 08          	sub    $0x8,%rsp
+  80167e:	49 89 ff             	mov    %rdi,%r15
+  801681:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801686:	49 bd fc 3d 80 00 00 	movabs $0x803dfc,%r13
+  80168d:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801690:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801696:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801699:	48 89 df             	mov    %rbx,%rdi
+  80169c:	41 ff d5             	call   *%r13
+  80169f:	83 e0 04             	and    $0x4,%eax
+  8016a2:	74 17                	je     8016bb <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8016a4:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8016ab:	4c 39 f3             	cmp    %r14,%rbx
+  8016ae:	75 e6                	jne    801696 <fd_alloc+0x29>
+  8016b0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8016b6:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8016bb:	4d 89 27             	mov    %r12,(%r15)
+}
+  8016be:	48 83 c4 08          	add    $0x8,%rsp
+  8016c2:	5b                   	pop    %rbx
+  8016c3:	41 5c                	pop    %r12
+  8016c5:	41 5d                	pop    %r13
+  8016c7:	41 5e                	pop    %r14
+  8016c9:	41 5f                	pop    %r15
+  8016cb:	5d                   	pop    %rbp
+  8016cc:	c3                   	ret
+
+00000000008016cd <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8016cd:	83 ff 1f             	cmp    $0x1f,%edi
+  8016d0:	77 39                	ja     80170b <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8016d2:	55                   	push   %rbp
+  8016d3:	48 89 e5             	mov    %rsp,%rbp
+  8016d6:	41 54                	push   %r12
+  8016d8:	53                   	push   %rbx
+  8016d9:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8016dc:	48 63 df             	movslq %edi,%rbx
+  8016df:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8016e6:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8016ea:	48 89 df             	mov    %rbx,%rdi
+  8016ed:	48 b8 fc 3d 80 00 00 	movabs $0x803dfc,%rax
+  8016f4:	00 00 00 
+  8016f7:	ff d0                	call   *%rax
+  8016f9:	a8 04                	test   $0x4,%al
+  8016fb:	74 14                	je     801711 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8016fd:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801701:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801706:	5b                   	pop    %rbx
+  801707:	41 5c                	pop    %r12
+  801709:	5d                   	pop    %rbp
+  80170a:	c3                   	ret
+        return -E_INVAL;
+  80170b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801710:	c3                   	ret
+        return -E_INVAL;
+  801711:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801716:	eb ee                	jmp    801706 <fd_lookup+0x39>
+
+0000000000801718 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801718:	55                   	push   %rbp
+  801719:	48 89 e5             	mov    %rsp,%rbp
+  80171c:	41 54                	push   %r12
+  80171e:	53                   	push   %rbx
+  80171f:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801722:	48 b8 40 4f 80 00 00 	movabs $0x804f40,%rax
+  801729:	00 00 00 
+  80172c:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  801733:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801736:	39 3b                	cmp    %edi,(%rbx)
+  801738:	74 47                	je     801781 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  80173a:	48 83 c0 08          	add    $0x8,%rax
+  80173e:	48 8b 18             	mov    (%rax),%rbx
+  801741:	48 85 db             	test   %rbx,%rbx
+  801744:	75 f0                	jne    801736 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801746:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80174d:	00 00 00 
+  801750:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801756:	89 fa                	mov    %edi,%edx
+  801758:	48 bf b0 4e 80 00 00 	movabs $0x804eb0,%rdi
+  80175f:	00 00 00 
+  801762:	b8 00 00 00 00       	mov    $0x0,%eax
+  801767:	48 b9 68 02 80 00 00 	movabs $0x800268,%rcx
+  80176e:	00 00 00 
+  801771:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801773:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801778:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  80177c:	5b                   	pop    %rbx
+  80177d:	41 5c                	pop    %r12
+  80177f:	5d                   	pop    %rbp
+  801780:	c3                   	ret
+            return 0;
+  801781:	b8 00 00 00 00       	mov    $0x0,%eax
+  801786:	eb f0                	jmp    801778 <dev_lookup+0x60>
+
+0000000000801788 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801788:	55                   	push   %rbp
+  801789:	48 89 e5             	mov    %rsp,%rbp
+  80178c:	41 55                	push   %r13
+  80178e:	41 54                	push   %r12
+  801790:	53                   	push   %rbx
+  801791:	48 83 ec 18          	sub    $0x18,%rsp
+  801795:	48 89 fb             	mov    %rdi,%rbx
+  801798:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80179b:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8017a2:	ff ff ff 
+  8017a5:	48 01 df             	add    %rbx,%rdi
+  8017a8:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8017ac:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8017b0:	48 b8 cd 16 80 00 00 	movabs $0x8016cd,%rax
+  8017b7:	00 00 00 
+  8017ba:	ff d0                	call   *%rax
+  8017bc:	41 89 c5             	mov    %eax,%r13d
+  8017bf:	85 c0                	test   %eax,%eax
+  8017c1:	78 06                	js     8017c9 <fd_close+0x41>
+  8017c3:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8017c7:	74 1a                	je     8017e3 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8017c9:	45 84 e4             	test   %r12b,%r12b
+  8017cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017d1:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8017d5:	44 89 e8             	mov    %r13d,%eax
+  8017d8:	48 83 c4 18          	add    $0x18,%rsp
+  8017dc:	5b                   	pop    %rbx
+  8017dd:	41 5c                	pop    %r12
+  8017df:	41 5d                	pop    %r13
+  8017e1:	5d                   	pop    %rbp
+  8017e2:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8017e3:	8b 3b                	mov    (%rbx),%edi
+  8017e5:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8017e9:	48 b8 18 17 80 00 00 	movabs $0x801718,%rax
+  8017f0:	00 00 00 
+  8017f3:	ff d0                	call   *%rax
+  8017f5:	41 89 c5             	mov    %eax,%r13d
+  8017f8:	85 c0                	test   %eax,%eax
+  8017fa:	78 1b                	js     801817 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8017fc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801800:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801804:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80180a:	48 85 c0             	test   %rax,%rax
+  80180d:	74 08                	je     801817 <fd_close+0x8f>
+  80180f:	48 89 df             	mov    %rbx,%rdi
+  801812:	ff d0                	call   *%rax
+  801814:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801817:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80181c:	48 89 de             	mov    %rbx,%rsi
+  80181f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801824:	48 b8 92 11 80 00 00 	movabs $0x801192,%rax
+  80182b:	00 00 00 
+  80182e:	ff d0                	call   *%rax
+    return res;
+  801830:	eb a3                	jmp    8017d5 <fd_close+0x4d>
+
+0000000000801832 <close>:
+
+int
+close(int fdnum) {
+  801832:	55                   	push   %rbp
+  801833:	48 89 e5             	mov    %rsp,%rbp
+  801836:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80183a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80183e:	48 b8 cd 16 80 00 00 	movabs $0x8016cd,%rax
+  801845:	00 00 00 
+  801848:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80184a:	85 c0                	test   %eax,%eax
+  80184c:	78 15                	js     801863 <close+0x31>
+
+    return fd_close(fd, 1);
+  80184e:	be 01 00 00 00       	mov    $0x1,%esi
+  801853:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801857:	48 b8 88 17 80 00 00 	movabs $0x801788,%rax
+  80185e:	00 00 00 
+  801861:	ff d0                	call   *%rax
+}
+  801863:	c9                   	leave
+  801864:	c3                   	ret
+
+0000000000801865 <close_all>:
+
+void
+close_all(void) {
+  801865:	55                   	push   %rbp
+  801866:	48 89 e5             	mov    %rsp,%rbp
+  801869:	41 54                	push   %r12
+  80186b:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  80186c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801871:	49 bc 32 18 80 00 00 	movabs $0x801832,%r12
+  801878:	00 00 00 
+  80187b:	89 df                	mov    %ebx,%edi
+  80187d:	41 ff d4             	call   *%r12
+  801880:	83 c3 01             	add    $0x1,%ebx
+  801883:	83 fb 20             	cmp    $0x20,%ebx
+  801886:	75 f3                	jne    80187b <close_all+0x16>
+}
+  801888:	5b                   	pop    %rbx
+  801889:	41 5c                	pop    %r12
+  80188b:	5d                   	pop    %rbp
+  80188c:	c3                   	ret
+
+000000000080188d <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  80188d:	55                   	push   %rbp
+  80188e:	48 89 e5             	mov    %rsp,%rbp
+  801891:	41 57                	push   %r15
+  801893:	41 56                	push   %r14
+  801895:	41 55                	push   %r13
+  801897:	41 54                	push   %r12
+  801899:	53                   	push   %rbx
+  80189a:	48 83 ec 18          	sub    $0x18,%rsp
+  80189e:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8018a1:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8018a5:	48 b8 cd 16 80 00 00 	movabs $0x8016cd,%rax
+  8018ac:	00 00 00 
+  8018af:	ff d0                	call   *%rax
+  8018b1:	89 c3                	mov    %eax,%ebx
+  8018b3:	85 c0                	test   %eax,%eax
+  8018b5:	0f 88 b8 00 00 00    	js     801973 <dup+0xe6>
+    close(newfdnum);
+  8018bb:	44 89 e7             	mov    %r12d,%edi
+  8018be:	48 b8 32 18 80 00 00 	movabs $0x801832,%rax
+  8018c5:	00 00 00 
+  8018c8:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8018ca:	4d 63 ec             	movslq %r12d,%r13
+  8018cd:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8018d4:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8018d8:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8018dc:	4c 89 ff             	mov    %r15,%rdi
+  8018df:	49 be 51 16 80 00 00 	movabs $0x801651,%r14
+  8018e6:	00 00 00 
+  8018e9:	41 ff d6             	call   *%r14
+  8018ec:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8018ef:	4c 89 ef             	mov    %r13,%rdi
+  8018f2:	41 ff d6             	call   *%r14
+  8018f5:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8018f8:	48 89 df             	mov    %rbx,%rdi
+  8018fb:	48 b8 fc 3d 80 00 00 	movabs $0x803dfc,%rax
+  801902:	00 00 00 
+  801905:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801907:	a8 04                	test   $0x4,%al
+  801909:	74 2b                	je     801936 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  80190b:	41 89 c1             	mov    %eax,%r9d
+  80190e:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801914:	4c 89 f1             	mov    %r14,%rcx
+  801917:	ba 00 00 00 00       	mov    $0x0,%edx
+  80191c:	48 89 de             	mov    %rbx,%rsi
+  80191f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801924:	48 b8 42 11 80 00 00 	movabs $0x801142,%rax
+  80192b:	00 00 00 
+  80192e:	ff d0                	call   *%rax
+  801930:	89 c3                	mov    %eax,%ebx
+  801932:	85 c0                	test   %eax,%eax
+  801934:	78 4e                	js     801984 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801936:	4c 89 ff             	mov    %r15,%rdi
+  801939:	48 b8 fc 3d 80 00 00 	movabs $0x803dfc,%rax
+  801940:	00 00 00 
+  801943:	ff d0                	call   *%rax
+  801945:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801948:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80194e:	4c 89 e9             	mov    %r13,%rcx
+  801951:	ba 00 00 00 00       	mov    $0x0,%edx
+  801956:	4c 89 fe             	mov    %r15,%rsi
+  801959:	bf 00 00 00 00       	mov    $0x0,%edi
+  80195e:	48 b8 42 11 80 00 00 	movabs $0x801142,%rax
+  801965:	00 00 00 
+  801968:	ff d0                	call   *%rax
+  80196a:	89 c3                	mov    %eax,%ebx
+  80196c:	85 c0                	test   %eax,%eax
+  80196e:	78 14                	js     801984 <dup+0xf7>
+
+    return newfdnum;
+  801970:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801973:	89 d8                	mov    %ebx,%eax
+  801975:	48 83 c4 18          	add    $0x18,%rsp
+  801979:	5b                   	pop    %rbx
+  80197a:	41 5c                	pop    %r12
+  80197c:	41 5d                	pop    %r13
+  80197e:	41 5e                	pop    %r14
+  801980:	41 5f                	pop    %r15
+  801982:	5d                   	pop    %rbp
+  801983:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801984:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801989:	4c 89 ee             	mov    %r13,%rsi
+  80198c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801991:	49 bc 92 11 80 00 00 	movabs $0x801192,%r12
+  801998:	00 00 00 
+  80199b:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  80199e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8019a3:	4c 89 f6             	mov    %r14,%rsi
+  8019a6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019ab:	41 ff d4             	call   *%r12
+    return res;
+  8019ae:	eb c3                	jmp    801973 <dup+0xe6>
+
+00000000008019b0 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8019b0:	55                   	push   %rbp
+  8019b1:	48 89 e5             	mov    %rsp,%rbp
+  8019b4:	41 56                	push   %r14
+  8019b6:	41 55                	push   %r13
+  8019b8:	41 54                	push   %r12
+  8019ba:	53                   	push   %rbx
+  8019bb:	48 83 ec 10          	sub    $0x10,%rsp
+  8019bf:	89 fb                	mov    %edi,%ebx
+  8019c1:	49 89 f4             	mov    %rsi,%r12
+  8019c4:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8019c7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8019cb:	48 b8 cd 16 80 00 00 	movabs $0x8016cd,%rax
+  8019d2:	00 00 00 
+  8019d5:	ff d0                	call   *%rax
+  8019d7:	85 c0                	test   %eax,%eax
+  8019d9:	78 4c                	js     801a27 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8019db:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8019df:	41 8b 3e             	mov    (%r14),%edi
+  8019e2:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8019e6:	48 b8 18 17 80 00 00 	movabs $0x801718,%rax
+  8019ed:	00 00 00 
+  8019f0:	ff d0                	call   *%rax
+  8019f2:	85 c0                	test   %eax,%eax
+  8019f4:	78 35                	js     801a2b <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8019f6:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8019fa:	83 e0 03             	and    $0x3,%eax
+  8019fd:	83 f8 01             	cmp    $0x1,%eax
+  801a00:	74 2d                	je     801a2f <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801a02:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a06:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801a0a:	48 85 c0             	test   %rax,%rax
+  801a0d:	74 56                	je     801a65 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801a0f:	4c 89 ea             	mov    %r13,%rdx
+  801a12:	4c 89 e6             	mov    %r12,%rsi
+  801a15:	4c 89 f7             	mov    %r14,%rdi
+  801a18:	ff d0                	call   *%rax
+}
+  801a1a:	48 83 c4 10          	add    $0x10,%rsp
+  801a1e:	5b                   	pop    %rbx
+  801a1f:	41 5c                	pop    %r12
+  801a21:	41 5d                	pop    %r13
+  801a23:	41 5e                	pop    %r14
+  801a25:	5d                   	pop    %rbp
+  801a26:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a27:	48 98                	cltq
+  801a29:	eb ef                	jmp    801a1a <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801a2b:	48 98                	cltq
+  801a2d:	eb eb                	jmp    801a1a <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801a2f:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801a36:	00 00 00 
+  801a39:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801a3f:	89 da                	mov    %ebx,%edx
+  801a41:	48 bf f1 4e 80 00 00 	movabs $0x804ef1,%rdi
+  801a48:	00 00 00 
+  801a4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a50:	48 b9 68 02 80 00 00 	movabs $0x800268,%rcx
+  801a57:	00 00 00 
+  801a5a:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801a5c:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801a63:	eb b5                	jmp    801a1a <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801a65:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801a6c:	eb ac                	jmp    801a1a <read+0x6a>
+
+0000000000801a6e <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801a6e:	55                   	push   %rbp
+  801a6f:	48 89 e5             	mov    %rsp,%rbp
+  801a72:	41 57                	push   %r15
+  801a74:	41 56                	push   %r14
+  801a76:	41 55                	push   %r13
+  801a78:	41 54                	push   %r12
+  801a7a:	53                   	push   %rbx
+  801a7b:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801a7f:	48 85 d2             	test   %rdx,%rdx
+  801a82:	74 54                	je     801ad8 <readn+0x6a>
+  801a84:	41 89 fd             	mov    %edi,%r13d
+  801a87:	49 89 f6             	mov    %rsi,%r14
+  801a8a:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801a8d:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801a92:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801a97:	49 bf b0 19 80 00 00 	movabs $0x8019b0,%r15
+  801a9e:	00 00 00 
+  801aa1:	4c 89 e2             	mov    %r12,%rdx
+  801aa4:	48 29 f2             	sub    %rsi,%rdx
+  801aa7:	4c 01 f6             	add    %r14,%rsi
+  801aaa:	44 89 ef             	mov    %r13d,%edi
+  801aad:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801ab0:	85 c0                	test   %eax,%eax
+  801ab2:	78 20                	js     801ad4 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801ab4:	01 c3                	add    %eax,%ebx
+  801ab6:	85 c0                	test   %eax,%eax
+  801ab8:	74 08                	je     801ac2 <readn+0x54>
+  801aba:	48 63 f3             	movslq %ebx,%rsi
+  801abd:	4c 39 e6             	cmp    %r12,%rsi
+  801ac0:	72 df                	jb     801aa1 <readn+0x33>
+    }
+    return res;
+  801ac2:	48 63 c3             	movslq %ebx,%rax
+}
+  801ac5:	48 83 c4 08          	add    $0x8,%rsp
+  801ac9:	5b                   	pop    %rbx
+  801aca:	41 5c                	pop    %r12
+  801acc:	41 5d                	pop    %r13
+  801ace:	41 5e                	pop    %r14
+  801ad0:	41 5f                	pop    %r15
+  801ad2:	5d                   	pop    %rbp
+  801ad3:	c3                   	ret
+        if (inc < 0) return inc;
+  801ad4:	48 98                	cltq
+  801ad6:	eb ed                	jmp    801ac5 <readn+0x57>
+    int inc = 1, res = 0;
+  801ad8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801add:	eb e3                	jmp    801ac2 <readn+0x54>
+
+0000000000801adf <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801adf:	55                   	push   %rbp
+  801ae0:	48 89 e5             	mov    %rsp,%rbp
+  801ae3:	41 56                	push   %r14
+  801ae5:	41 55                	push   %r13
+  801ae7:	41 54                	push   %r12
+  801ae9:	53                   	push   %rbx
+  801aea:	48 83 ec 10          	sub    $0x10,%rsp
+  801aee:	89 fb                	mov    %edi,%ebx
+  801af0:	49 89 f4             	mov    %rsi,%r12
+  801af3:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801af6:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801afa:	48 b8 cd 16 80 00 00 	movabs $0x8016cd,%rax
+  801b01:	00 00 00 
+  801b04:	ff d0                	call   *%rax
+  801b06:	85 c0                	test   %eax,%eax
+  801b08:	78 47                	js     801b51 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b0a:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801b0e:	41 8b 3e             	mov    (%r14),%edi
+  801b11:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801b15:	48 b8 18 17 80 00 00 	movabs $0x801718,%rax
+  801b1c:	00 00 00 
+  801b1f:	ff d0                	call   *%rax
+  801b21:	85 c0                	test   %eax,%eax
+  801b23:	78 30                	js     801b55 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801b25:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801b2a:	74 2d                	je     801b59 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801b2c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b30:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801b34:	48 85 c0             	test   %rax,%rax
+  801b37:	74 56                	je     801b8f <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801b39:	4c 89 ea             	mov    %r13,%rdx
+  801b3c:	4c 89 e6             	mov    %r12,%rsi
+  801b3f:	4c 89 f7             	mov    %r14,%rdi
+  801b42:	ff d0                	call   *%rax
+}
+  801b44:	48 83 c4 10          	add    $0x10,%rsp
+  801b48:	5b                   	pop    %rbx
+  801b49:	41 5c                	pop    %r12
+  801b4b:	41 5d                	pop    %r13
+  801b4d:	41 5e                	pop    %r14
+  801b4f:	5d                   	pop    %rbp
+  801b50:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b51:	48 98                	cltq
+  801b53:	eb ef                	jmp    801b44 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b55:	48 98                	cltq
+  801b57:	eb eb                	jmp    801b44 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b59:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801b60:	00 00 00 
+  801b63:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801b69:	89 da                	mov    %ebx,%edx
+  801b6b:	48 bf 0d 4f 80 00 00 	movabs $0x804f0d,%rdi
+  801b72:	00 00 00 
+  801b75:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b7a:	48 b9 68 02 80 00 00 	movabs $0x800268,%rcx
+  801b81:	00 00 00 
+  801b84:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801b86:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801b8d:	eb b5                	jmp    801b44 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801b8f:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801b96:	eb ac                	jmp    801b44 <write+0x65>
+
+0000000000801b98 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801b98:	55                   	push   %rbp
+  801b99:	48 89 e5             	mov    %rsp,%rbp
+  801b9c:	41 54                	push   %r12
+  801b9e:	53                   	push   %rbx
+  801b9f:	48 83 ec 10          	sub    $0x10,%rsp
+  801ba3:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ba5:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801ba9:	48 b8 cd 16 80 00 00 	movabs $0x8016cd,%rax
+  801bb0:	00 00 00 
+  801bb3:	ff d0                	call   *%rax
+  801bb5:	85 c0                	test   %eax,%eax
+  801bb7:	78 3e                	js     801bf7 <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801bb9:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801bbd:	41 8b 3c 24          	mov    (%r12),%edi
+  801bc1:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801bc5:	48 b8 18 17 80 00 00 	movabs $0x801718,%rax
+  801bcc:	00 00 00 
+  801bcf:	ff d0                	call   *%rax
+  801bd1:	85 c0                	test   %eax,%eax
+  801bd3:	78 22                	js     801bf7 <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  801bd5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801bd9:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801bdd:	48 85 c0             	test   %rax,%rax
+  801be0:	74 0b                	je     801bed <seek+0x55>
+  801be2:	89 de                	mov    %ebx,%esi
+  801be4:	4c 89 e7             	mov    %r12,%rdi
+  801be7:	ff d0                	call   *%rax
+  801be9:	85 c0                	test   %eax,%eax
+  801beb:	78 0a                	js     801bf7 <seek+0x5f>
+
+    fd->fd_offset = offset;
+  801bed:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  801bf2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801bf7:	48 83 c4 10          	add    $0x10,%rsp
+  801bfb:	5b                   	pop    %rbx
+  801bfc:	41 5c                	pop    %r12
+  801bfe:	5d                   	pop    %rbp
+  801bff:	c3                   	ret
+
+0000000000801c00 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801c00:	55                   	push   %rbp
+  801c01:	48 89 e5             	mov    %rsp,%rbp
+  801c04:	41 55                	push   %r13
+  801c06:	41 54                	push   %r12
+  801c08:	53                   	push   %rbx
+  801c09:	48 83 ec 18          	sub    $0x18,%rsp
+  801c0d:	89 fb                	mov    %edi,%ebx
+  801c0f:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c12:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c16:	48 b8 cd 16 80 00 00 	movabs $0x8016cd,%rax
+  801c1d:	00 00 00 
+  801c20:	ff d0                	call   *%rax
+  801c22:	85 c0                	test   %eax,%eax
+  801c24:	78 38                	js     801c5e <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c26:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801c2a:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801c2e:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c32:	48 b8 18 17 80 00 00 	movabs $0x801718,%rax
+  801c39:	00 00 00 
+  801c3c:	ff d0                	call   *%rax
+  801c3e:	85 c0                	test   %eax,%eax
+  801c40:	78 1c                	js     801c5e <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801c42:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801c47:	74 20                	je     801c69 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801c49:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c4d:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801c51:	48 85 c0             	test   %rax,%rax
+  801c54:	74 47                	je     801c9d <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801c56:	44 89 e6             	mov    %r12d,%esi
+  801c59:	4c 89 ef             	mov    %r13,%rdi
+  801c5c:	ff d0                	call   *%rax
+}
+  801c5e:	48 83 c4 18          	add    $0x18,%rsp
+  801c62:	5b                   	pop    %rbx
+  801c63:	41 5c                	pop    %r12
+  801c65:	41 5d                	pop    %r13
+  801c67:	5d                   	pop    %rbp
+  801c68:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801c69:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801c70:	00 00 00 
+  801c73:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801c79:	89 da                	mov    %ebx,%edx
+  801c7b:	48 bf d0 4e 80 00 00 	movabs $0x804ed0,%rdi
+  801c82:	00 00 00 
+  801c85:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c8a:	48 b9 68 02 80 00 00 	movabs $0x800268,%rcx
+  801c91:	00 00 00 
+  801c94:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801c96:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c9b:	eb c1                	jmp    801c5e <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801c9d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801ca2:	eb ba                	jmp    801c5e <ftruncate+0x5e>
+
+0000000000801ca4 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801ca4:	55                   	push   %rbp
+  801ca5:	48 89 e5             	mov    %rsp,%rbp
+  801ca8:	41 54                	push   %r12
+  801caa:	53                   	push   %rbx
+  801cab:	48 83 ec 10          	sub    $0x10,%rsp
+  801caf:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801cb2:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801cb6:	48 b8 cd 16 80 00 00 	movabs $0x8016cd,%rax
+  801cbd:	00 00 00 
+  801cc0:	ff d0                	call   *%rax
+  801cc2:	85 c0                	test   %eax,%eax
+  801cc4:	78 4e                	js     801d14 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801cc6:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801cca:	41 8b 3c 24          	mov    (%r12),%edi
+  801cce:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801cd2:	48 b8 18 17 80 00 00 	movabs $0x801718,%rax
+  801cd9:	00 00 00 
+  801cdc:	ff d0                	call   *%rax
+  801cde:	85 c0                	test   %eax,%eax
+  801ce0:	78 32                	js     801d14 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801ce2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801ce6:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801ceb:	74 30                	je     801d1d <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801ced:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801cf0:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801cf7:	00 00 00 
+    stat->st_isdir = 0;
+  801cfa:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801d01:	00 00 00 
+    stat->st_dev = dev;
+  801d04:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801d0b:	48 89 de             	mov    %rbx,%rsi
+  801d0e:	4c 89 e7             	mov    %r12,%rdi
+  801d11:	ff 50 28             	call   *0x28(%rax)
+}
+  801d14:	48 83 c4 10          	add    $0x10,%rsp
+  801d18:	5b                   	pop    %rbx
+  801d19:	41 5c                	pop    %r12
+  801d1b:	5d                   	pop    %rbp
+  801d1c:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801d1d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801d22:	eb f0                	jmp    801d14 <fstat+0x70>
+
+0000000000801d24 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801d24:	55                   	push   %rbp
+  801d25:	48 89 e5             	mov    %rsp,%rbp
+  801d28:	41 54                	push   %r12
+  801d2a:	53                   	push   %rbx
+  801d2b:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801d2e:	be 00 00 00 00       	mov    $0x0,%esi
+  801d33:	48 b8 92 2e 80 00 00 	movabs $0x802e92,%rax
+  801d3a:	00 00 00 
+  801d3d:	ff d0                	call   *%rax
+  801d3f:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801d41:	85 c0                	test   %eax,%eax
+  801d43:	78 25                	js     801d6a <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801d45:	4c 89 e6             	mov    %r12,%rsi
+  801d48:	89 c7                	mov    %eax,%edi
+  801d4a:	48 b8 a4 1c 80 00 00 	movabs $0x801ca4,%rax
+  801d51:	00 00 00 
+  801d54:	ff d0                	call   *%rax
+  801d56:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801d59:	89 df                	mov    %ebx,%edi
+  801d5b:	48 b8 32 18 80 00 00 	movabs $0x801832,%rax
+  801d62:	00 00 00 
+  801d65:	ff d0                	call   *%rax
+
+    return res;
+  801d67:	44 89 e3             	mov    %r12d,%ebx
+}
+  801d6a:	89 d8                	mov    %ebx,%eax
+  801d6c:	5b                   	pop    %rbx
+  801d6d:	41 5c                	pop    %r12
+  801d6f:	5d                   	pop    %rbp
+  801d70:	c3                   	ret
+
+0000000000801d71 <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  801d71:	48 b8 08 00 82 00 00 	movabs $0x820008,%rax
+  801d78:	00 00 00 
+  801d7b:	83 38 00             	cmpl   $0x0,(%rax)
+  801d7e:	74 0a                	je     801d8a <fsenv+0x19>
+    return envid;
+}
+  801d80:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  801d87:	00 00 
+  801d89:	c3                   	ret
+fsenv(void) {
+  801d8a:	55                   	push   %rbp
+  801d8b:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  801d8e:	bf 03 00 00 00       	mov    $0x3,%edi
+  801d93:	48 b8 02 48 80 00 00 	movabs $0x804802,%rax
+  801d9a:	00 00 00 
+  801d9d:	ff d0                	call   *%rax
+  801d9f:	a3 08 00 82 00 00 00 	movabs %eax,0x820008
+  801da6:	00 00 
+}
+  801da8:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  801daf:	00 00 
+  801db1:	5d                   	pop    %rbp
+  801db2:	c3                   	ret
+
+0000000000801db3 <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  801db3:	55                   	push   %rbp
+  801db4:	48 89 e5             	mov    %rsp,%rbp
+  801db7:	41 54                	push   %r12
+  801db9:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  801dba:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801dbf:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801dc4:	48 89 de             	mov    %rbx,%rsi
+  801dc7:	bf 00 00 00 00       	mov    $0x0,%edi
+  801dcc:	48 b8 92 11 80 00 00 	movabs $0x801192,%rax
+  801dd3:	00 00 00 
+  801dd6:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  801dd8:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  801ddf:	00 00 00 
+  801de2:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  801de8:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801ded:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801df2:	48 89 de             	mov    %rbx,%rsi
+  801df5:	bf 00 00 00 00       	mov    $0x0,%edi
+  801dfa:	48 b8 ec 10 80 00 00 	movabs $0x8010ec,%rax
+  801e01:	00 00 00 
+  801e04:	ff d0                	call   *%rax
+  801e06:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  801e08:	85 c0                	test   %eax,%eax
+  801e0a:	0f 88 a2 00 00 00    	js     801eb2 <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  801e10:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801e17:	00 00 00 
+  801e1a:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801e20:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801e25:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  801e27:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  801e2c:	49 bc c4 3f 80 00 00 	movabs $0x803fc4,%r12
+  801e33:	00 00 00 
+  801e36:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  801e39:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  801e3e:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  801e41:	48 b8 71 1d 80 00 00 	movabs $0x801d71,%rax
+  801e48:	00 00 00 
+  801e4b:	ff d0                	call   *%rax
+  801e4d:	89 c7                	mov    %eax,%edi
+  801e4f:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  801e55:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  801e5a:	48 89 da             	mov    %rbx,%rdx
+  801e5d:	be 09 00 00 00       	mov    $0x9,%esi
+  801e62:	48 b8 ac 47 80 00 00 	movabs $0x8047ac,%rax
+  801e69:	00 00 00 
+  801e6c:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  801e6e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e73:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e78:	be 00 00 00 00       	mov    $0x0,%esi
+  801e7d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e82:	48 b8 88 47 80 00 00 	movabs $0x804788,%rax
+  801e89:	00 00 00 
+  801e8c:	ff d0                	call   *%rax
+  801e8e:	89 c3                	mov    %eax,%ebx
+  801e90:	85 c0                	test   %eax,%eax
+  801e92:	78 25                	js     801eb9 <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  801e94:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801e9b:	00 00 00 
+  801e9e:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801ea4:	a3 00 26 82 00 00 00 	movabs %eax,0x822600
+  801eab:	00 00 
+    return 0;
+  801ead:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  801eb2:	89 d8                	mov    %ebx,%eax
+  801eb4:	5b                   	pop    %rbx
+  801eb5:	41 5c                	pop    %r12
+  801eb7:	5d                   	pop    %rbp
+  801eb8:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  801eb9:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801ebe:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  801ec3:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ec8:	48 b8 92 11 80 00 00 	movabs $0x801192,%rax
+  801ecf:	00 00 00 
+  801ed2:	ff d0                	call   *%rax
+        return res;
+  801ed4:	eb dc                	jmp    801eb2 <fschan_setup+0xff>
+
+0000000000801ed6 <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  801ed6:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  801edd:	00 00 00 
+  801ee0:	80 38 00             	cmpb   $0x0,(%rax)
+  801ee3:	74 55                	je     801f3a <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801ee5:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801eec:	00 00 00 
+  801eef:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  801ef5:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801efa:	48 ba 00 26 82 00 00 	movabs $0x822600,%rdx
+  801f01:	00 00 00 
+  801f04:	3b 0a                	cmp    (%rdx),%ecx
+  801f06:	75 01                	jne    801f09 <fschan+0x33>
+}
+  801f08:	c3                   	ret
+fschan(void) {
+  801f09:	55                   	push   %rbp
+  801f0a:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801f0d:	48 b8 b3 1d 80 00 00 	movabs $0x801db3,%rax
+  801f14:	00 00 00 
+  801f17:	ff d0                	call   *%rax
+  801f19:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  801f1b:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801f20:	85 d2                	test   %edx,%edx
+  801f22:	78 02                	js     801f26 <fschan+0x50>
+}
+  801f24:	5d                   	pop    %rbp
+  801f25:	c3                   	ret
+        fschan_enabled = 0;
+  801f26:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  801f2d:	00 00 00 
+  801f30:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  801f33:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f38:	eb ea                	jmp    801f24 <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  801f3a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f3f:	c3                   	ret
+
+0000000000801f40 <fbuf>:
+fbuf(struct Fd *fd) {
+  801f40:	55                   	push   %rbp
+  801f41:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  801f44:	48 b8 3f 16 80 00 00 	movabs $0x80163f,%rax
+  801f4b:	00 00 00 
+  801f4e:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  801f50:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f55:	48 83 f8 1f          	cmp    $0x1f,%rax
+  801f59:	77 12                	ja     801f6d <fbuf+0x2d>
+  801f5b:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  801f5f:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  801f66:	00 00 00 
+  801f69:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  801f6d:	48 89 d0             	mov    %rdx,%rax
+  801f70:	5d                   	pop    %rbp
+  801f71:	c3                   	ret
+
+0000000000801f72 <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  801f72:	55                   	push   %rbp
+  801f73:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  801f76:	48 83 c7 40          	add    $0x40,%rdi
+  801f7a:	48 b8 fe 3f 80 00 00 	movabs $0x803ffe,%rax
+  801f81:	00 00 00 
+  801f84:	ff d0                	call   *%rax
+  801f86:	84 c0                	test   %al,%al
+  801f88:	75 02                	jne    801f8c <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  801f8a:	5d                   	pop    %rbp
+  801f8b:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  801f8c:	48 b8 71 1d 80 00 00 	movabs $0x801d71,%rax
+  801f93:	00 00 00 
+  801f96:	ff d0                	call   *%rax
+  801f98:	89 c7                	mov    %eax,%edi
+  801f9a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801fa0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801fa5:	ba 00 00 00 00       	mov    $0x0,%edx
+  801faa:	be 0a 00 00 00       	mov    $0xa,%esi
+  801faf:	48 b8 ac 47 80 00 00 	movabs $0x8047ac,%rax
+  801fb6:	00 00 00 
+  801fb9:	ff d0                	call   *%rax
+}
+  801fbb:	eb cd                	jmp    801f8a <fschan_publish+0x18>
+
+0000000000801fbd <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  801fbd:	55                   	push   %rbp
+  801fbe:	48 89 e5             	mov    %rsp,%rbp
+  801fc1:	41 57                	push   %r15
+  801fc3:	41 56                	push   %r14
+  801fc5:	41 55                	push   %r13
+  801fc7:	41 54                	push   %r12
+  801fc9:	53                   	push   %rbx
+  801fca:	48 83 ec 48          	sub    $0x48,%rsp
+  801fce:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801fd2:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  801fd6:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  801fd9:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  801fdd:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  801fe0:	48 ba 04 00 82 00 00 	movabs $0x820004,%rdx
+  801fe7:	00 00 00 
+  801fea:	8b 02                	mov    (%rdx),%eax
+  801fec:	83 c0 01             	add    $0x1,%eax
+  801fef:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801ff4:	0f 44 c1             	cmove  %ecx,%eax
+  801ff7:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  801ff9:	4d 85 c0             	test   %r8,%r8
+  801ffc:	74 2c                	je     80202a <fschan_rw+0x6d>
+  801ffe:	45 89 ce             	mov    %r9d,%r14d
+  802001:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  802008:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  80200c:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802012:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  802019:	00 
+  80201a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802020:	b8 01 00 00 00       	mov    $0x1,%eax
+  802025:	e9 41 01 00 00       	jmp    80216b <fschan_rw+0x1ae>
+  80202a:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  80202e:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802032:	e9 9c 01 00 00       	jmp    8021d3 <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  802037:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80203b:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  80203e:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  802041:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  802044:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  802048:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  80204c:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  802050:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  802054:	48 89 da             	mov    %rbx,%rdx
+  802057:	48 b8 ee 0d 80 00 00 	movabs $0x800dee,%rax
+  80205e:	00 00 00 
+  802061:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  802063:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802067:	48 b8 72 1f 80 00 00 	movabs $0x801f72,%rax
+  80206e:	00 00 00 
+  802071:	ff d0                	call   *%rax
+            queued += blk;
+  802073:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  802076:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  80207a:	4d 39 fc             	cmp    %r15,%r12
+  80207d:	73 6b                	jae    8020ea <fschan_rw+0x12d>
+  80207f:	41 83 fd 0f          	cmp    $0xf,%r13d
+  802083:	77 65                	ja     8020ea <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  802085:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802089:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  80208d:	48 b8 d9 3f 80 00 00 	movabs $0x803fd9,%rax
+  802094:	00 00 00 
+  802097:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  802099:	4c 89 fb             	mov    %r15,%rbx
+  80209c:	4c 29 e3             	sub    %r12,%rbx
+  80209f:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  8020a4:	48 39 d3             	cmp    %rdx,%rbx
+  8020a7:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  8020ab:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  8020af:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  8020b3:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  8020b7:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  8020ba:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  8020bc:	48 b9 04 00 82 00 00 	movabs $0x820004,%rcx
+  8020c3:	00 00 00 
+  8020c6:	8b 09                	mov    (%rcx),%ecx
+  8020c8:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  8020cb:	83 fe 03             	cmp    $0x3,%esi
+  8020ce:	0f 85 63 ff ff ff    	jne    802037 <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  8020d4:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8020d8:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  8020db:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  8020de:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  8020e1:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  8020e5:	e9 79 ff ff ff       	jmp    802063 <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  8020ea:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8020ee:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  8020f5:	48 89 df             	mov    %rbx,%rdi
+  8020f8:	48 b8 9c 40 80 00 00 	movabs $0x80409c,%rax
+  8020ff:	00 00 00 
+  802102:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  802104:	48 89 df             	mov    %rbx,%rdi
+  802107:	48 b8 2a 40 80 00 00 	movabs $0x80402a,%rax
+  80210e:	00 00 00 
+  802111:	ff d0                	call   *%rax
+  802113:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  802117:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  80211b:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  80211f:	75 25                	jne    802146 <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  802121:	8b 40 04             	mov    0x4(%rax),%eax
+  802124:	85 c0                	test   %eax,%eax
+  802126:	0f 88 86 00 00 00    	js     8021b2 <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  80212c:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  802130:	74 5b                	je     80218d <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  802132:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802136:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  80213a:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  80213e:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  802142:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  802146:	48 89 df             	mov    %rbx,%rdi
+  802149:	48 b8 51 40 80 00 00 	movabs $0x804051,%rax
+  802150:	00 00 00 
+  802153:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  802155:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  802159:	83 f0 01             	xor    $0x1,%eax
+  80215c:	4d 39 fc             	cmp    %r15,%r12
+  80215f:	0f 92 c2             	setb   %dl
+  802162:	84 c2                	test   %al,%dl
+  802164:	75 05                	jne    80216b <fschan_rw+0x1ae>
+  802166:	45 85 ed             	test   %r13d,%r13d
+  802169:	74 50                	je     8021bb <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  80216b:	4d 39 fc             	cmp    %r15,%r12
+  80216e:	0f 92 c1             	setb   %cl
+  802171:	41 83 fd 0f          	cmp    $0xf,%r13d
+  802175:	0f 96 c2             	setbe  %dl
+  802178:	84 d1                	test   %dl,%cl
+  80217a:	0f 84 6a ff ff ff    	je     8020ea <fschan_rw+0x12d>
+  802180:	84 c0                	test   %al,%al
+  802182:	0f 85 fd fe ff ff    	jne    802085 <fschan_rw+0xc8>
+  802188:	e9 5d ff ff ff       	jmp    8020ea <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  80218d:	48 63 d0             	movslq %eax,%rdx
+  802190:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802194:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  802198:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80219c:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  8021a0:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  8021a4:	48 b8 ee 0d 80 00 00 	movabs $0x800dee,%rax
+  8021ab:	00 00 00 
+  8021ae:	ff d0                	call   *%rax
+  8021b0:	eb 80                	jmp    802132 <fschan_rw+0x175>
+                err = msg->fm_res;
+  8021b2:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  8021b5:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  8021b9:	eb 8b                	jmp    802146 <fschan_rw+0x189>
+    return done || !err ? done : err;
+  8021bb:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  8021c0:	0f 85 68 fe ff ff    	jne    80202e <fschan_rw+0x71>
+  8021c6:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  8021c9:	85 c0                	test   %eax,%eax
+  8021cb:	0f 84 5d fe ff ff    	je     80202e <fschan_rw+0x71>
+  8021d1:	48 98                	cltq
+}
+  8021d3:	48 83 c4 48          	add    $0x48,%rsp
+  8021d7:	5b                   	pop    %rbx
+  8021d8:	41 5c                	pop    %r12
+  8021da:	41 5d                	pop    %r13
+  8021dc:	41 5e                	pop    %r14
+  8021de:	41 5f                	pop    %r15
+  8021e0:	5d                   	pop    %rbp
+  8021e1:	c3                   	ret
+
+00000000008021e2 <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  8021e2:	55                   	push   %rbp
+  8021e3:	48 89 e5             	mov    %rsp,%rbp
+  8021e6:	41 56                	push   %r14
+  8021e8:	41 55                	push   %r13
+  8021ea:	41 54                	push   %r12
+  8021ec:	53                   	push   %rbx
+  8021ed:	48 83 ec 10          	sub    $0x10,%rsp
+  8021f1:	49 89 fe             	mov    %rdi,%r14
+  8021f4:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  8021f7:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  8021fb:	48 29 f3             	sub    %rsi,%rbx
+  8021fe:	48 39 d3             	cmp    %rdx,%rbx
+  802201:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  802205:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  80220c:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  80220d:	bf 00 10 00 00       	mov    $0x1000,%edi
+  802212:	49 bd 5b 3e 80 00 00 	movabs $0x803e5b,%r13
+  802219:	00 00 00 
+  80221c:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  802223:	76 1e                	jbe    802243 <mmap_fault+0x61>
+  802225:	4c 01 e7             	add    %r12,%rdi
+  802228:	41 ff d5             	call   *%r13
+  80222b:	84 c0                	test   %al,%al
+  80222d:	75 14                	jne    802243 <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  80222f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802233:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  80223a:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  80223e:	48 39 df             	cmp    %rbx,%rdi
+  802241:	72 e2                	jb     802225 <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  802243:	48 bb 00 10 82 00 00 	movabs $0x821000,%rbx
+  80224a:	00 00 00 
+  80224d:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  802254:	00 00 00 
+  802257:	4c 89 f0             	mov    %r14,%rax
+  80225a:	48 29 d0             	sub    %rdx,%rax
+  80225d:	48 c1 f8 03          	sar    $0x3,%rax
+  802261:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  802268:	aa aa aa 
+  80226b:	48 0f af c2          	imul   %rdx,%rax
+  80226f:	48 c1 e0 0c          	shl    $0xc,%rax
+  802273:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  802278:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  80227c:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  80227e:	44 89 e0             	mov    %r12d,%eax
+  802281:	41 03 46 10          	add    0x10(%r14),%eax
+  802285:	41 2b 06             	sub    (%r14),%eax
+  802288:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  80228b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80228f:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  802293:	41 8b 46 14          	mov    0x14(%r14),%eax
+  802297:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  80229a:	48 b8 71 1d 80 00 00 	movabs $0x801d71,%rax
+  8022a1:	00 00 00 
+  8022a4:	ff d0                	call   *%rax
+  8022a6:	89 c7                	mov    %eax,%edi
+  8022a8:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8022ae:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8022b3:	48 89 da             	mov    %rbx,%rdx
+  8022b6:	be 0f 00 00 00       	mov    $0xf,%esi
+  8022bb:	48 b8 ac 47 80 00 00 	movabs $0x8047ac,%rax
+  8022c2:	00 00 00 
+  8022c5:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  8022c7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022cc:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8022d0:	4c 89 e6             	mov    %r12,%rsi
+  8022d3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022d8:	48 b8 88 47 80 00 00 	movabs $0x804788,%rax
+  8022df:	00 00 00 
+  8022e2:	ff d0                	call   *%rax
+  8022e4:	48 98                	cltq
+}
+  8022e6:	48 83 c4 10          	add    $0x10,%rsp
+  8022ea:	5b                   	pop    %rbx
+  8022eb:	41 5c                	pop    %r12
+  8022ed:	41 5d                	pop    %r13
+  8022ef:	41 5e                	pop    %r14
+  8022f1:	5d                   	pop    %rbp
+  8022f2:	c3                   	ret
+
+00000000008022f3 <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  8022f3:	48 8b 37             	mov    (%rdi),%rsi
+  8022f6:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  8022fd:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  802304:	00 00 00 
+  802307:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80230c:	eb 0f                	jmp    80231d <mmap_pgfault+0x2a>
+  80230e:	c3                   	ret
+  80230f:	48 83 c1 01          	add    $0x1,%rcx
+  802313:	48 83 c2 18          	add    $0x18,%rdx
+  802317:	48 83 f9 20          	cmp    $0x20,%rcx
+  80231b:	74 6e                	je     80238b <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  80231d:	48 8b 02             	mov    (%rdx),%rax
+  802320:	48 83 e8 01          	sub    $0x1,%rax
+  802324:	48 39 f0             	cmp    %rsi,%rax
+  802327:	73 e6                	jae    80230f <mmap_pgfault+0x1c>
+  802329:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  80232d:	73 e0                	jae    80230f <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  80232f:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  802333:	b8 00 00 00 00       	mov    $0x0,%eax
+  802338:	f6 c2 01             	test   $0x1,%dl
+  80233b:	75 d1                	jne    80230e <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  80233d:	f6 c2 02             	test   $0x2,%dl
+  802340:	74 1a                	je     80235c <mmap_pgfault+0x69>
+  802342:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  802346:	b8 00 00 00 00       	mov    $0x0,%eax
+  80234b:	48 bf 00 20 82 00 00 	movabs $0x822000,%rdi
+  802352:	00 00 00 
+  802355:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  80235a:	74 35                	je     802391 <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  80235c:	55                   	push   %rbp
+  80235d:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  802360:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  802364:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  80236b:	00 00 00 
+  80236e:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  802372:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802377:	48 b8 e2 21 80 00 00 	movabs $0x8021e2,%rax
+  80237e:	00 00 00 
+  802381:	ff d0                	call   *%rax
+  802383:	48 85 c0             	test   %rax,%rax
+  802386:	0f 9f c0             	setg   %al
+}
+  802389:	5d                   	pop    %rbp
+  80238a:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  80238b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802390:	c3                   	ret
+}
+  802391:	c3                   	ret
+
+0000000000802392 <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  802392:	55                   	push   %rbp
+  802393:	48 89 e5             	mov    %rsp,%rbp
+  802396:	41 54                	push   %r12
+  802398:	53                   	push   %rbx
+  802399:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80239c:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8023a3:	00 00 00 
+  8023a6:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  8023ab:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8023af:	74 15                	je     8023c6 <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8023b1:	48 83 c3 01          	add    $0x1,%rbx
+  8023b5:	48 83 c0 18          	add    $0x18,%rax
+  8023b9:	48 83 fb 20          	cmp    $0x20,%rbx
+  8023bd:	75 ec                	jne    8023ab <mmap_alloc+0x19>
+    return NULL;
+  8023bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023c4:	eb 52                	jmp    802418 <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  8023c6:	4c 89 e7             	mov    %r12,%rdi
+  8023c9:	48 b8 fc 3d 80 00 00 	movabs $0x803dfc,%rax
+  8023d0:	00 00 00 
+  8023d3:	ff d0                	call   *%rax
+  8023d5:	41 89 c1             	mov    %eax,%r9d
+  8023d8:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  8023df:	48 c1 e1 0c          	shl    $0xc,%rcx
+  8023e3:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8023e9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023ee:	4c 89 e6             	mov    %r12,%rsi
+  8023f1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023f6:	48 b8 42 11 80 00 00 	movabs $0x801142,%rax
+  8023fd:	00 00 00 
+  802400:	ff d0                	call   *%rax
+  802402:	85 c0                	test   %eax,%eax
+  802404:	78 17                	js     80241d <mmap_alloc+0x8b>
+        return &mmaps[i];
+  802406:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  80240a:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  802411:	00 00 00 
+  802414:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  802418:	5b                   	pop    %rbx
+  802419:	41 5c                	pop    %r12
+  80241b:	5d                   	pop    %rbp
+  80241c:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  80241d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802422:	eb f4                	jmp    802418 <mmap_alloc+0x86>
+
+0000000000802424 <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  802424:	55                   	push   %rbp
+  802425:	48 89 e5             	mov    %rsp,%rbp
+  802428:	41 56                	push   %r14
+  80242a:	41 55                	push   %r13
+  80242c:	41 54                	push   %r12
+  80242e:	53                   	push   %rbx
+  80242f:	48 83 ec 10          	sub    $0x10,%rsp
+  802433:	41 89 fc             	mov    %edi,%r12d
+  802436:	49 89 f5             	mov    %rsi,%r13
+  802439:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  80243c:	48 89 f0             	mov    %rsi,%rax
+  80243f:	48 09 d0             	or     %rdx,%rax
+  802442:	75 0d                	jne    802451 <fsipc+0x2d>
+  802444:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  802447:	83 f8 04             	cmp    $0x4,%eax
+  80244a:	76 7d                	jbe    8024c9 <fsipc+0xa5>
+  80244c:	83 ff 0d             	cmp    $0xd,%edi
+  80244f:	74 78                	je     8024c9 <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  802451:	48 b8 71 1d 80 00 00 	movabs $0x801d71,%rax
+  802458:	00 00 00 
+  80245b:	ff d0                	call   *%rax
+  80245d:	89 c7                	mov    %eax,%edi
+  80245f:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  802466:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  80246d:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  802474:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80247a:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802481:	00 00 00 
+  802484:	44 89 e6             	mov    %r12d,%esi
+  802487:	48 b8 ac 47 80 00 00 	movabs $0x8047ac,%rax
+  80248e:	00 00 00 
+  802491:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  802493:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  80249a:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  80249b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8024a0:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8024a4:	4c 89 ee             	mov    %r13,%rsi
+  8024a7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024ac:	48 b8 88 47 80 00 00 	movabs $0x804788,%rax
+  8024b3:	00 00 00 
+  8024b6:	ff d0                	call   *%rax
+  8024b8:	89 c3                	mov    %eax,%ebx
+}
+  8024ba:	89 d8                	mov    %ebx,%eax
+  8024bc:	48 83 c4 10          	add    $0x10,%rsp
+  8024c0:	5b                   	pop    %rbx
+  8024c1:	41 5c                	pop    %r12
+  8024c3:	41 5d                	pop    %r13
+  8024c5:	41 5e                	pop    %r14
+  8024c7:	5d                   	pop    %rbp
+  8024c8:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  8024c9:	48 b8 d6 1e 80 00 00 	movabs $0x801ed6,%rax
+  8024d0:	00 00 00 
+  8024d3:	ff d0                	call   *%rax
+  8024d5:	49 89 c6             	mov    %rax,%r14
+  8024d8:	48 85 c0             	test   %rax,%rax
+  8024db:	0f 84 70 ff ff ff    	je     802451 <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  8024e1:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  8024e5:	48 b8 d9 3f 80 00 00 	movabs $0x803fd9,%rax
+  8024ec:	00 00 00 
+  8024ef:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  8024f1:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  8024f4:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  8024fb:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  8024ff:	ba 10 00 00 00       	mov    $0x10,%edx
+  802504:	48 be 00 00 83 00 00 	movabs $0x830000,%rsi
+  80250b:	00 00 00 
+  80250e:	48 b8 ee 0d 80 00 00 	movabs $0x800dee,%rax
+  802515:	00 00 00 
+  802518:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  80251a:	4c 89 f7             	mov    %r14,%rdi
+  80251d:	48 b8 72 1f 80 00 00 	movabs $0x801f72,%rax
+  802524:	00 00 00 
+  802527:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  802529:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  802530:	4c 89 f7             	mov    %r14,%rdi
+  802533:	48 b8 9c 40 80 00 00 	movabs $0x80409c,%rax
+  80253a:	00 00 00 
+  80253d:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  80253f:	4c 89 f7             	mov    %r14,%rdi
+  802542:	48 b8 2a 40 80 00 00 	movabs $0x80402a,%rax
+  802549:	00 00 00 
+  80254c:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  80254e:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  802551:	41 83 fc 05          	cmp    $0x5,%r12d
+  802555:	75 04                	jne    80255b <fsipc+0x137>
+  802557:	85 db                	test   %ebx,%ebx
+  802559:	79 14                	jns    80256f <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  80255b:	4c 89 f7             	mov    %r14,%rdi
+  80255e:	48 b8 51 40 80 00 00 	movabs $0x804051,%rax
+  802565:	00 00 00 
+  802568:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  80256a:	e9 4b ff ff ff       	jmp    8024ba <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  80256f:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  802573:	ba 88 00 00 00       	mov    $0x88,%edx
+  802578:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  80257f:	00 00 00 
+  802582:	48 b8 ee 0d 80 00 00 	movabs $0x800dee,%rax
+  802589:	00 00 00 
+  80258c:	ff d0                	call   *%rax
+  80258e:	eb cb                	jmp    80255b <fsipc+0x137>
+
+0000000000802590 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  802590:	55                   	push   %rbp
+  802591:	48 89 e5             	mov    %rsp,%rbp
+  802594:	41 57                	push   %r15
+  802596:	41 56                	push   %r14
+  802598:	41 55                	push   %r13
+  80259a:	41 54                	push   %r12
+  80259c:	53                   	push   %rbx
+  80259d:	48 83 ec 18          	sub    $0x18,%rsp
+  8025a1:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  8025a5:	49 89 f6             	mov    %rsi,%r14
+  8025a8:	49 89 d4             	mov    %rdx,%r12
+  8025ab:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  8025ae:	48 b8 d6 1e 80 00 00 	movabs $0x801ed6,%rax
+  8025b5:	00 00 00 
+  8025b8:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  8025ba:	48 85 c0             	test   %rax,%rax
+  8025bd:	0f 85 96 00 00 00    	jne    802659 <devfile_write_direct+0xc9>
+    size_t write = 0;
+  8025c3:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8025ca:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8025cb:	49 bf 00 00 83 00 00 	movabs $0x830000,%r15
+  8025d2:	00 00 00 
+    while (n) {
+  8025d5:	4d 85 e4             	test   %r12,%r12
+  8025d8:	74 79                	je     802653 <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  8025da:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  8025df:	49 39 dc             	cmp    %rbx,%r12
+  8025e2:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  8025e6:	48 89 da             	mov    %rbx,%rdx
+  8025e9:	4c 89 f6             	mov    %r14,%rsi
+  8025ec:	48 bf 00 10 83 00 00 	movabs $0x831000,%rdi
+  8025f3:	00 00 00 
+  8025f6:	48 b8 ee 0d 80 00 00 	movabs $0x800dee,%rax
+  8025fd:	00 00 00 
+  802600:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802602:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802606:	8b 40 0c             	mov    0xc(%rax),%eax
+  802609:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  80260c:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  80260f:	44 01 e8             	add    %r13d,%eax
+  802612:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  802616:	41 0f 44 c5          	cmove  %r13d,%eax
+  80261a:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  80261e:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  802622:	48 89 da             	mov    %rbx,%rdx
+  802625:	be 00 00 00 00       	mov    $0x0,%esi
+  80262a:	bf 04 00 00 00       	mov    $0x4,%edi
+  80262f:	48 b8 24 24 80 00 00 	movabs $0x802424,%rax
+  802636:	00 00 00 
+  802639:	ff d0                	call   *%rax
+        if (res < 0)
+  80263b:	85 c0                	test   %eax,%eax
+  80263d:	78 4a                	js     802689 <devfile_write_direct+0xf9>
+        buf += res;
+  80263f:	48 98                	cltq
+  802641:	49 01 c6             	add    %rax,%r14
+        write += res;
+  802644:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  802648:	49 29 c4             	sub    %rax,%r12
+  80264b:	75 8d                	jne    8025da <devfile_write_direct+0x4a>
+    return write;
+  80264d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802651:	eb 27                	jmp    80267a <devfile_write_direct+0xea>
+    size_t write = 0;
+  802653:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  802657:	eb f4                	jmp    80264d <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  802659:	45 89 e9             	mov    %r13d,%r9d
+  80265c:	4d 89 e0             	mov    %r12,%r8
+  80265f:	4c 89 f1             	mov    %r14,%rcx
+  802662:	ba 04 00 00 00       	mov    $0x4,%edx
+  802667:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80266b:	48 89 c7             	mov    %rax,%rdi
+  80266e:	48 b8 bd 1f 80 00 00 	movabs $0x801fbd,%rax
+  802675:	00 00 00 
+  802678:	ff d0                	call   *%rax
+}
+  80267a:	48 83 c4 18          	add    $0x18,%rsp
+  80267e:	5b                   	pop    %rbx
+  80267f:	41 5c                	pop    %r12
+  802681:	41 5d                	pop    %r13
+  802683:	41 5e                	pop    %r14
+  802685:	41 5f                	pop    %r15
+  802687:	5d                   	pop    %rbp
+  802688:	c3                   	ret
+            return res;
+  802689:	48 98                	cltq
+  80268b:	eb ed                	jmp    80267a <devfile_write_direct+0xea>
+
+000000000080268d <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  80268d:	55                   	push   %rbp
+  80268e:	48 89 e5             	mov    %rsp,%rbp
+  802691:	41 54                	push   %r12
+  802693:	53                   	push   %rbx
+  802694:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  802697:	48 b8 40 1f 80 00 00 	movabs $0x801f40,%rax
+  80269e:	00 00 00 
+  8026a1:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  8026a3:	48 85 c0             	test   %rax,%rax
+  8026a6:	74 71                	je     802719 <fbuf_flush+0x8c>
+  8026a8:	48 89 c3             	mov    %rax,%rbx
+  8026ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026b0:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  8026b4:	75 05                	jne    8026bb <fbuf_flush+0x2e>
+}
+  8026b6:	5b                   	pop    %rbx
+  8026b7:	41 5c                	pop    %r12
+  8026b9:	5d                   	pop    %rbp
+  8026ba:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  8026bb:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  8026be:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  8026c2:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8026c9:	00 00 00 
+  8026cc:	48 89 de             	mov    %rbx,%rsi
+  8026cf:	48 29 c6             	sub    %rax,%rsi
+  8026d2:	48 c1 fe 03          	sar    $0x3,%rsi
+  8026d6:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8026dd:	aa aa aa 
+  8026e0:	48 0f af f0          	imul   %rax,%rsi
+  8026e4:	48 c1 e6 0e          	shl    $0xe,%rsi
+  8026e8:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  8026ed:	48 01 c6             	add    %rax,%rsi
+  8026f0:	4c 89 e7             	mov    %r12,%rdi
+  8026f3:	48 b8 90 25 80 00 00 	movabs $0x802590,%rax
+  8026fa:	00 00 00 
+  8026fd:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  8026ff:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  802703:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  80270a:	00 
+    return res < 0 ? res : 0;
+  80270b:	48 85 c0             	test   %rax,%rax
+  80270e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802713:	48 0f 4f c2          	cmovg  %rdx,%rax
+  802717:	eb 9d                	jmp    8026b6 <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  802719:	b8 00 00 00 00       	mov    $0x0,%eax
+  80271e:	eb 96                	jmp    8026b6 <fbuf_flush+0x29>
+
+0000000000802720 <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  802720:	55                   	push   %rbp
+  802721:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  802724:	48 b8 8d 26 80 00 00 	movabs $0x80268d,%rax
+  80272b:	00 00 00 
+  80272e:	ff d0                	call   *%rax
+}
+  802730:	5d                   	pop    %rbp
+  802731:	c3                   	ret
+
+0000000000802732 <devfile_write>:
+    if (!fd || !buf)
+  802732:	48 85 ff             	test   %rdi,%rdi
+  802735:	0f 84 d3 01 00 00    	je     80290e <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80273b:	55                   	push   %rbp
+  80273c:	48 89 e5             	mov    %rsp,%rbp
+  80273f:	41 57                	push   %r15
+  802741:	41 56                	push   %r14
+  802743:	41 55                	push   %r13
+  802745:	41 54                	push   %r12
+  802747:	53                   	push   %rbx
+  802748:	48 83 ec 08          	sub    $0x8,%rsp
+  80274c:	49 89 fc             	mov    %rdi,%r12
+  80274f:	49 89 f6             	mov    %rsi,%r14
+  802752:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  802755:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  80275a:	48 85 f6             	test   %rsi,%rsi
+  80275d:	0f 84 9c 01 00 00    	je     8028ff <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  802763:	48 b8 40 1f 80 00 00 	movabs $0x801f40,%rax
+  80276a:	00 00 00 
+  80276d:	ff d0                	call   *%rax
+  80276f:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  802772:	48 85 c0             	test   %rax,%rax
+  802775:	0f 84 a2 00 00 00    	je     80281d <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  80277b:	be 00 10 00 00       	mov    $0x1000,%esi
+  802780:	4c 89 e7             	mov    %r12,%rdi
+  802783:	48 b8 b1 10 80 00 00 	movabs $0x8010b1,%rax
+  80278a:	00 00 00 
+  80278d:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  80278f:	83 f8 02             	cmp    $0x2,%eax
+  802792:	0f 8f 85 00 00 00    	jg     80281d <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  802798:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  80279f:	00 00 00 
+  8027a2:	4d 89 ef             	mov    %r13,%r15
+  8027a5:	49 29 c7             	sub    %rax,%r15
+  8027a8:	49 c1 ff 03          	sar    $0x3,%r15
+  8027ac:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8027b3:	aa aa aa 
+  8027b6:	4c 0f af f8          	imul   %rax,%r15
+  8027ba:	49 c1 e7 0e          	shl    $0xe,%r15
+  8027be:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  8027c3:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  8027c6:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  8027cb:	0f 84 d7 00 00 00    	je     8028a8 <devfile_write+0x176>
+  8027d1:	49 8b 45 10          	mov    0x10(%r13),%rax
+  8027d5:	89 c2                	mov    %eax,%edx
+  8027d7:	41 03 55 0c          	add    0xc(%r13),%edx
+  8027db:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  8027e0:	75 0f                	jne    8027f1 <devfile_write+0xbf>
+  8027e2:	48 01 d8             	add    %rbx,%rax
+  8027e5:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  8027eb:	0f 86 92 00 00 00    	jbe    802883 <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  8027f1:	4c 89 e7             	mov    %r12,%rdi
+  8027f4:	48 b8 8d 26 80 00 00 	movabs $0x80268d,%rax
+  8027fb:	00 00 00 
+  8027fe:	ff d0                	call   *%rax
+  802800:	85 c0                	test   %eax,%eax
+  802802:	78 52                	js     802856 <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802804:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  80280b:	77 7f                	ja     80288c <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  80280d:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802812:	0f 85 c2 00 00 00    	jne    8028da <devfile_write+0x1a8>
+  802818:	e9 94 00 00 00       	jmp    8028b1 <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  80281d:	4c 89 e7             	mov    %r12,%rdi
+  802820:	48 b8 8d 26 80 00 00 	movabs $0x80268d,%rax
+  802827:	00 00 00 
+  80282a:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  80282c:	85 c0                	test   %eax,%eax
+  80282e:	79 07                	jns    802837 <devfile_write+0x105>
+  802830:	48 98                	cltq
+  802832:	e9 c8 00 00 00       	jmp    8028ff <devfile_write+0x1cd>
+  802837:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  80283c:	48 89 da             	mov    %rbx,%rdx
+  80283f:	4c 89 f6             	mov    %r14,%rsi
+  802842:	4c 89 e7             	mov    %r12,%rdi
+  802845:	48 b8 90 25 80 00 00 	movabs $0x802590,%rax
+  80284c:	00 00 00 
+  80284f:	ff d0                	call   *%rax
+  802851:	e9 a9 00 00 00       	jmp    8028ff <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802856:	48 98                	cltq
+  802858:	e9 a2 00 00 00       	jmp    8028ff <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  80285d:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802862:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802867:	4c 89 fe             	mov    %r15,%rsi
+  80286a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80286f:	48 b8 ec 10 80 00 00 	movabs $0x8010ec,%rax
+  802876:	00 00 00 
+  802879:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  80287b:	85 c0                	test   %eax,%eax
+  80287d:	79 45                	jns    8028c4 <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  80287f:	48 98                	cltq
+  802881:	eb 7c                	jmp    8028ff <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802883:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  80288a:	76 4e                	jbe    8028da <devfile_write+0x1a8>
+  80288c:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802891:	48 89 da             	mov    %rbx,%rdx
+  802894:	4c 89 f6             	mov    %r14,%rsi
+  802897:	4c 89 e7             	mov    %r12,%rdi
+  80289a:	48 b8 90 25 80 00 00 	movabs $0x802590,%rax
+  8028a1:	00 00 00 
+  8028a4:	ff d0                	call   *%rax
+  8028a6:	eb 57                	jmp    8028ff <devfile_write+0x1cd>
+  8028a8:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  8028af:	77 db                	ja     80288c <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  8028b1:	4c 89 ff             	mov    %r15,%rdi
+  8028b4:	48 b8 5b 3e 80 00 00 	movabs $0x803e5b,%rax
+  8028bb:	00 00 00 
+  8028be:	ff d0                	call   *%rax
+  8028c0:	84 c0                	test   %al,%al
+  8028c2:	74 99                	je     80285d <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  8028c4:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  8028c9:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8028ce:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  8028d2:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  8028d9:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  8028da:	4c 89 ff             	mov    %r15,%rdi
+  8028dd:	49 03 7d 10          	add    0x10(%r13),%rdi
+  8028e1:	48 89 da             	mov    %rbx,%rdx
+  8028e4:	4c 89 f6             	mov    %r14,%rsi
+  8028e7:	48 b8 ee 0d 80 00 00 	movabs $0x800dee,%rax
+  8028ee:	00 00 00 
+  8028f1:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  8028f3:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  8028f7:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  8028fc:	48 89 d8             	mov    %rbx,%rax
+}
+  8028ff:	48 83 c4 08          	add    $0x8,%rsp
+  802903:	5b                   	pop    %rbx
+  802904:	41 5c                	pop    %r12
+  802906:	41 5d                	pop    %r13
+  802908:	41 5e                	pop    %r14
+  80290a:	41 5f                	pop    %r15
+  80290c:	5d                   	pop    %rbp
+  80290d:	c3                   	ret
+        return E_INVAL;
+  80290e:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802913:	c3                   	ret
+
+0000000000802914 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802914:	55                   	push   %rbp
+  802915:	48 89 e5             	mov    %rsp,%rbp
+  802918:	41 54                	push   %r12
+  80291a:	53                   	push   %rbx
+  80291b:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  80291e:	48 b8 8d 26 80 00 00 	movabs $0x80268d,%rax
+  802925:	00 00 00 
+  802928:	ff d0                	call   *%rax
+  80292a:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  80292d:	48 89 df             	mov    %rbx,%rdi
+  802930:	48 b8 40 1f 80 00 00 	movabs $0x801f40,%rax
+  802937:	00 00 00 
+  80293a:	ff d0                	call   *%rax
+  80293c:	48 85 c0             	test   %rax,%rax
+  80293f:	74 17                	je     802958 <devfile_flush+0x44>
+  802941:	48 89 df             	mov    %rbx,%rdi
+  802944:	48 b8 40 1f 80 00 00 	movabs $0x801f40,%rax
+  80294b:	00 00 00 
+  80294e:	ff d0                	call   *%rax
+  802950:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  802957:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802958:	8b 43 0c             	mov    0xc(%rbx),%eax
+  80295b:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  802962:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  802964:	ba 00 00 00 00       	mov    $0x0,%edx
+  802969:	be 00 00 00 00       	mov    $0x0,%esi
+  80296e:	bf 06 00 00 00       	mov    $0x6,%edi
+  802973:	48 b8 24 24 80 00 00 	movabs $0x802424,%rax
+  80297a:	00 00 00 
+  80297d:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  80297f:	45 85 e4             	test   %r12d,%r12d
+  802982:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802986:	5b                   	pop    %rbx
+  802987:	41 5c                	pop    %r12
+  802989:	5d                   	pop    %rbp
+  80298a:	c3                   	ret
+
+000000000080298b <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  80298b:	55                   	push   %rbp
+  80298c:	48 89 e5             	mov    %rsp,%rbp
+  80298f:	41 57                	push   %r15
+  802991:	41 56                	push   %r14
+  802993:	41 55                	push   %r13
+  802995:	41 54                	push   %r12
+  802997:	53                   	push   %rbx
+  802998:	48 83 ec 38          	sub    $0x38,%rsp
+  80299c:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8029a0:	49 89 f7             	mov    %rsi,%r15
+  8029a3:	48 89 d3             	mov    %rdx,%rbx
+  8029a6:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  8029a9:	48 b8 d6 1e 80 00 00 	movabs $0x801ed6,%rax
+  8029b0:	00 00 00 
+  8029b3:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  8029b5:	48 85 c0             	test   %rax,%rax
+  8029b8:	75 20                	jne    8029da <devfile_read_direct+0x4f>
+    bool map = 1;
+  8029ba:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  8029bf:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  8029c6:	00 
+    while (n) {
+  8029c7:	48 85 db             	test   %rbx,%rbx
+  8029ca:	0f 85 df 00 00 00    	jne    802aaf <devfile_read_direct+0x124>
+    size_t read = 0;
+  8029d0:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  8029d4:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8029d8:	eb 21                	jmp    8029fb <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  8029da:	45 89 f1             	mov    %r14d,%r9d
+  8029dd:	49 89 d8             	mov    %rbx,%r8
+  8029e0:	4c 89 f9             	mov    %r15,%rcx
+  8029e3:	ba 03 00 00 00       	mov    $0x3,%edx
+  8029e8:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  8029ec:	48 89 c7             	mov    %rax,%rdi
+  8029ef:	48 b8 bd 1f 80 00 00 	movabs $0x801fbd,%rax
+  8029f6:	00 00 00 
+  8029f9:	ff d0                	call   *%rax
+}
+  8029fb:	48 83 c4 38          	add    $0x38,%rsp
+  8029ff:	5b                   	pop    %rbx
+  802a00:	41 5c                	pop    %r12
+  802a02:	41 5d                	pop    %r13
+  802a04:	41 5e                	pop    %r14
+  802a06:	41 5f                	pop    %r15
+  802a08:	5d                   	pop    %rbp
+  802a09:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802a0a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802a0e:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802a14:	75 1e                	jne    802a34 <devfile_read_direct+0xa9>
+  802a16:	e9 e2 00 00 00       	jmp    802afd <devfile_read_direct+0x172>
+            if (!res) return read;
+  802a1b:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802a1f:	eb da                	jmp    8029fb <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  802a21:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  802a25:	0f 85 d0 01 00 00    	jne    802bfb <devfile_read_direct+0x270>
+            map = 0;
+  802a2b:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802a2f:	eb 03                	jmp    802a34 <devfile_read_direct+0xa9>
+  802a31:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802a34:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802a39:	48 39 d3             	cmp    %rdx,%rbx
+  802a3c:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802a40:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802a44:	8b 40 0c             	mov    0xc(%rax),%eax
+  802a47:	48 b9 00 00 83 00 00 	movabs $0x830000,%rcx
+  802a4e:	00 00 00 
+  802a51:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  802a53:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  802a57:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  802a5b:	be 00 00 00 00       	mov    $0x0,%esi
+  802a60:	bf 03 00 00 00       	mov    $0x3,%edi
+  802a65:	48 b8 24 24 80 00 00 	movabs $0x802424,%rax
+  802a6c:	00 00 00 
+  802a6f:	ff d0                	call   *%rax
+        if (res <= 0)
+  802a71:	85 c0                	test   %eax,%eax
+  802a73:	0f 8e 63 01 00 00    	jle    802bdc <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  802a79:	4c 63 e0             	movslq %eax,%r12
+  802a7c:	4c 89 e2             	mov    %r12,%rdx
+  802a7f:	48 be 00 10 83 00 00 	movabs $0x831000,%rsi
+  802a86:	00 00 00 
+  802a89:	4c 89 ff             	mov    %r15,%rdi
+  802a8c:	48 b8 ee 0d 80 00 00 	movabs $0x800dee,%rax
+  802a93:	00 00 00 
+  802a96:	ff d0                	call   *%rax
+        buf += res;
+  802a98:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  802a9b:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  802a9e:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  802aa2:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  802aa6:	48 85 db             	test   %rbx,%rbx
+  802aa9:	0f 84 25 ff ff ff    	je     8029d4 <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  802aaf:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  802ab2:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  802ab6:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802aba:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802abe:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  802ac5:	0f 97 c2             	seta   %dl
+  802ac8:	20 c2                	and    %al,%dl
+  802aca:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  802acd:	0f 84 5e ff ff ff    	je     802a31 <devfile_read_direct+0xa6>
+  802ad3:	4c 89 fa             	mov    %r15,%rdx
+  802ad6:	4d 89 fd             	mov    %r15,%r13
+  802ad9:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  802ae0:	0f 85 4e ff ff ff    	jne    802a34 <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  802ae6:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802aea:	0f 84 1a ff ff ff    	je     802a0a <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802af0:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802af7:	0f 85 37 ff ff ff    	jne    802a34 <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  802afd:	48 89 d8             	mov    %rbx,%rax
+  802b00:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802b06:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802b0b:	48 39 c8             	cmp    %rcx,%rax
+  802b0e:	48 0f 47 c1          	cmova  %rcx,%rax
+  802b12:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  802b16:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  802b1a:	49 89 d4             	mov    %rdx,%r12
+  802b1d:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  802b21:	48 b8 fc 3d 80 00 00 	movabs $0x803dfc,%rax
+  802b28:	00 00 00 
+  802b2b:	ff d0                	call   *%rax
+  802b2d:	a8 40                	test   $0x40,%al
+  802b2f:	0f 85 b9 00 00 00    	jne    802bee <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  802b35:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  802b3c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802b40:	49 39 c5             	cmp    %rax,%r13
+  802b43:	72 d8                	jb     802b1d <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802b45:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802b49:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802b50:	00 00 00 
+  802b53:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802b57:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  802b5a:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  802b5c:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  802b60:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  802b64:	48 b8 71 1d 80 00 00 	movabs $0x801d71,%rax
+  802b6b:	00 00 00 
+  802b6e:	ff d0                	call   *%rax
+  802b70:	89 c7                	mov    %eax,%edi
+  802b72:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802b78:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802b7d:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802b84:	00 00 00 
+  802b87:	be 0e 00 00 00       	mov    $0xe,%esi
+  802b8c:	48 b8 ac 47 80 00 00 	movabs $0x8047ac,%rax
+  802b93:	00 00 00 
+  802b96:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  802b98:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802b9d:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802ba1:	4c 89 fe             	mov    %r15,%rsi
+  802ba4:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ba9:	48 b8 88 47 80 00 00 	movabs $0x804788,%rax
+  802bb0:	00 00 00 
+  802bb3:	ff d0                	call   *%rax
+  802bb5:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  802bb8:	48 85 d2             	test   %rdx,%rdx
+  802bbb:	0f 84 5a fe ff ff    	je     802a1b <devfile_read_direct+0x90>
+            if (res > 0) {
+  802bc1:	0f 8e 5a fe ff ff    	jle    802a21 <devfile_read_direct+0x96>
+                buf += res;
+  802bc7:	48 98                	cltq
+  802bc9:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  802bcc:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  802bcf:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  802bd3:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  802bd7:	e9 ca fe ff ff       	jmp    802aa6 <devfile_read_direct+0x11b>
+            return res ? res : read;
+  802bdc:	41 89 c5             	mov    %eax,%r13d
+  802bdf:	48 98                	cltq
+  802be1:	45 85 ed             	test   %r13d,%r13d
+  802be4:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  802be9:	e9 0d fe ff ff       	jmp    8029fb <devfile_read_direct+0x70>
+            map = 0;
+  802bee:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802bf2:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802bf6:	e9 39 fe ff ff       	jmp    802a34 <devfile_read_direct+0xa9>
+  802bfb:	48 89 d0             	mov    %rdx,%rax
+  802bfe:	e9 f8 fd ff ff       	jmp    8029fb <devfile_read_direct+0x70>
+
+0000000000802c03 <devfile_read>:
+    if (!fd || !buf)
+  802c03:	48 85 ff             	test   %rdi,%rdi
+  802c06:	0f 84 21 02 00 00    	je     802e2d <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802c0c:	55                   	push   %rbp
+  802c0d:	48 89 e5             	mov    %rsp,%rbp
+  802c10:	41 57                	push   %r15
+  802c12:	41 56                	push   %r14
+  802c14:	41 55                	push   %r13
+  802c16:	41 54                	push   %r12
+  802c18:	53                   	push   %rbx
+  802c19:	48 83 ec 28          	sub    $0x28,%rsp
+  802c1d:	48 89 fb             	mov    %rdi,%rbx
+  802c20:	49 89 f4             	mov    %rsi,%r12
+  802c23:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  802c26:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802c2b:	48 85 f6             	test   %rsi,%rsi
+  802c2e:	74 4b                	je     802c7b <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  802c30:	48 b8 40 1f 80 00 00 	movabs $0x801f40,%rax
+  802c37:	00 00 00 
+  802c3a:	ff d0                	call   *%rax
+  802c3c:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802c3f:	48 85 c0             	test   %rax,%rax
+  802c42:	74 22                	je     802c66 <devfile_read+0x63>
+  802c44:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  802c4b:	77 19                	ja     802c66 <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802c4d:	be 00 10 00 00       	mov    $0x1000,%esi
+  802c52:	48 89 df             	mov    %rbx,%rdi
+  802c55:	48 b8 b1 10 80 00 00 	movabs $0x8010b1,%rax
+  802c5c:	00 00 00 
+  802c5f:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802c61:	83 f8 02             	cmp    $0x2,%eax
+  802c64:	7e 40                	jle    802ca6 <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  802c66:	48 89 df             	mov    %rbx,%rdi
+  802c69:	48 b8 8d 26 80 00 00 	movabs $0x80268d,%rax
+  802c70:	00 00 00 
+  802c73:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802c75:	85 c0                	test   %eax,%eax
+  802c77:	79 11                	jns    802c8a <devfile_read+0x87>
+  802c79:	48 98                	cltq
+}
+  802c7b:	48 83 c4 28          	add    $0x28,%rsp
+  802c7f:	5b                   	pop    %rbx
+  802c80:	41 5c                	pop    %r12
+  802c82:	41 5d                	pop    %r13
+  802c84:	41 5e                	pop    %r14
+  802c86:	41 5f                	pop    %r15
+  802c88:	5d                   	pop    %rbp
+  802c89:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802c8a:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802c8f:	4c 89 ea             	mov    %r13,%rdx
+  802c92:	4c 89 e6             	mov    %r12,%rsi
+  802c95:	48 89 df             	mov    %rbx,%rdi
+  802c98:	48 b8 8b 29 80 00 00 	movabs $0x80298b,%rax
+  802c9f:	00 00 00 
+  802ca2:	ff d0                	call   *%rax
+  802ca4:	eb d5                	jmp    802c7b <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  802ca6:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802caa:	48 89 df             	mov    %rbx,%rdi
+  802cad:	48 b8 8d 26 80 00 00 	movabs $0x80268d,%rax
+  802cb4:	00 00 00 
+  802cb7:	ff d0                	call   *%rax
+  802cb9:	85 c0                	test   %eax,%eax
+  802cbb:	0f 88 33 01 00 00    	js     802df4 <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  802cc1:	48 ba 00 23 82 00 00 	movabs $0x822300,%rdx
+  802cc8:	00 00 00 
+  802ccb:	4c 89 f0             	mov    %r14,%rax
+  802cce:	48 29 d0             	sub    %rdx,%rax
+  802cd1:	48 c1 f8 03          	sar    $0x3,%rax
+  802cd5:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  802cdc:	aa aa aa 
+  802cdf:	48 0f af c2          	imul   %rdx,%rax
+  802ce3:	48 c1 e0 0e          	shl    $0xe,%rax
+  802ce7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  802ceb:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802cee:	41 39 06             	cmp    %eax,(%r14)
+  802cf1:	75 0d                	jne    802d00 <devfile_read+0xfd>
+  802cf3:	8b 43 10             	mov    0x10(%rbx),%eax
+  802cf6:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  802cfa:	0f 84 fb 00 00 00    	je     802dfb <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  802d00:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802d05:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802d09:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  802d0c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802d10:	48 89 c7             	mov    %rax,%rdi
+  802d13:	48 b8 5b 3e 80 00 00 	movabs $0x803e5b,%rax
+  802d1a:	00 00 00 
+  802d1d:	ff d0                	call   *%rax
+  802d1f:	84 c0                	test   %al,%al
+  802d21:	75 27                	jne    802d4a <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802d23:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802d28:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802d2d:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802d31:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d36:	48 b8 ec 10 80 00 00 	movabs $0x8010ec,%rax
+  802d3d:	00 00 00 
+  802d40:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  802d42:	85 c0                	test   %eax,%eax
+  802d44:	0f 88 dc 00 00 00    	js     802e26 <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  802d4a:	44 89 f8             	mov    %r15d,%eax
+  802d4d:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802d52:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  802d54:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  802d5b:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  802d5c:	8b 43 10             	mov    0x10(%rbx),%eax
+  802d5f:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  802d63:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  802d66:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802d6b:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802d6f:	48 89 df             	mov    %rbx,%rdi
+  802d72:	48 b8 8b 29 80 00 00 	movabs $0x80298b,%rax
+  802d79:	00 00 00 
+  802d7c:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  802d7e:	48 85 c0             	test   %rax,%rax
+  802d81:	0f 88 f4 fe ff ff    	js     802c7b <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  802d87:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802d8a:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  802d8d:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  802d90:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  802d94:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  802d98:	48 63 d1             	movslq %ecx,%rdx
+  802d9b:	48 01 d0             	add    %rdx,%rax
+  802d9e:	4d 63 ff             	movslq %r15d,%r15
+  802da1:	4c 29 f8             	sub    %r15,%rax
+  802da4:	ba 00 00 00 00       	mov    $0x0,%edx
+  802da9:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  802dad:	48 85 c0             	test   %rax,%rax
+  802db0:	0f 8e c5 fe ff ff    	jle    802c7b <devfile_read+0x78>
+    n = MIN(n, res);
+  802db6:	4c 39 e8             	cmp    %r13,%rax
+  802db9:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  802dbd:	8b 73 04             	mov    0x4(%rbx),%esi
+  802dc0:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  802dc4:	48 63 f6             	movslq %esi,%rsi
+  802dc7:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802dcc:	48 01 c6             	add    %rax,%rsi
+  802dcf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802dd3:	48 01 c6             	add    %rax,%rsi
+  802dd6:	4c 89 ea             	mov    %r13,%rdx
+  802dd9:	4c 89 e7             	mov    %r12,%rdi
+  802ddc:	48 b8 ee 0d 80 00 00 	movabs $0x800dee,%rax
+  802de3:	00 00 00 
+  802de6:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  802de8:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  802dec:	4c 89 e8             	mov    %r13,%rax
+  802def:	e9 87 fe ff ff       	jmp    802c7b <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802df4:	48 98                	cltq
+  802df6:	e9 80 fe ff ff       	jmp    802c7b <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  802dfb:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  802dff:	41 39 d7             	cmp    %edx,%r15d
+  802e02:	0f 8c f8 fe ff ff    	jl     802d00 <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  802e08:	49 8b 46 10          	mov    0x10(%r14),%rax
+  802e0c:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  802e0f:	41 39 cf             	cmp    %ecx,%r15d
+  802e12:	0f 8d e8 fe ff ff    	jge    802d00 <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  802e18:	4d 63 ff             	movslq %r15d,%r15
+  802e1b:	4c 29 f8             	sub    %r15,%rax
+  802e1e:	48 63 d2             	movslq %edx,%rdx
+  802e21:	48 01 d0             	add    %rdx,%rax
+  802e24:	eb 87                	jmp    802dad <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802e26:	48 98                	cltq
+  802e28:	e9 4e fe ff ff       	jmp    802c7b <devfile_read+0x78>
+        return E_INVAL;
+  802e2d:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802e32:	c3                   	ret
+
+0000000000802e33 <fs_channel>:
+fs_channel(bool enable) {
+  802e33:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  802e35:	a2 04 26 82 00 00 00 	movabs %al,0x822604
+  802e3c:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  802e3e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e43:	40 84 ff             	test   %dil,%dil
+  802e46:	74 47                	je     802e8f <fs_channel+0x5c>
+  802e48:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  802e4f:	00 00 00 
+  802e52:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  802e58:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  802e5f:	00 00 00 
+  802e62:	3b 08                	cmp    (%rax),%ecx
+  802e64:	74 29                	je     802e8f <fs_channel+0x5c>
+fs_channel(bool enable) {
+  802e66:	55                   	push   %rbp
+  802e67:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  802e6a:	48 b8 b3 1d 80 00 00 	movabs $0x801db3,%rax
+  802e71:	00 00 00 
+  802e74:	ff d0                	call   *%rax
+  802e76:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  802e78:	85 c0                	test   %eax,%eax
+  802e7a:	78 04                	js     802e80 <fs_channel+0x4d>
+}
+  802e7c:	89 d0                	mov    %edx,%eax
+  802e7e:	5d                   	pop    %rbp
+  802e7f:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  802e80:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  802e87:	00 00 00 
+  802e8a:	c6 00 00             	movb   $0x0,(%rax)
+  802e8d:	eb ed                	jmp    802e7c <fs_channel+0x49>
+}
+  802e8f:	89 d0                	mov    %edx,%eax
+  802e91:	c3                   	ret
+
+0000000000802e92 <open>:
+open(const char *path, int mode) {
+  802e92:	55                   	push   %rbp
+  802e93:	48 89 e5             	mov    %rsp,%rbp
+  802e96:	41 55                	push   %r13
+  802e98:	41 54                	push   %r12
+  802e9a:	53                   	push   %rbx
+  802e9b:	48 83 ec 18          	sub    $0x18,%rsp
+  802e9f:	49 89 fc             	mov    %rdi,%r12
+  802ea2:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802ea5:	48 b8 4f 0b 80 00 00 	movabs $0x800b4f,%rax
+  802eac:	00 00 00 
+  802eaf:	ff d0                	call   *%rax
+  802eb1:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802eb7:	0f 87 8f 00 00 00    	ja     802f4c <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802ebd:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802ec1:	48 b8 6d 16 80 00 00 	movabs $0x80166d,%rax
+  802ec8:	00 00 00 
+  802ecb:	ff d0                	call   *%rax
+  802ecd:	89 c3                	mov    %eax,%ebx
+  802ecf:	85 c0                	test   %eax,%eax
+  802ed1:	78 55                	js     802f28 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  802ed3:	4c 89 e6             	mov    %r12,%rsi
+  802ed6:	48 bb 00 00 83 00 00 	movabs $0x830000,%rbx
+  802edd:	00 00 00 
+  802ee0:	48 89 df             	mov    %rbx,%rdi
+  802ee3:	48 b8 8d 0b 80 00 00 	movabs $0x800b8d,%rax
+  802eea:	00 00 00 
+  802eed:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802eef:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  802ef6:	ba 00 00 00 00       	mov    $0x0,%edx
+  802efb:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802eff:	bf 01 00 00 00       	mov    $0x1,%edi
+  802f04:	48 b8 24 24 80 00 00 	movabs $0x802424,%rax
+  802f0b:	00 00 00 
+  802f0e:	ff d0                	call   *%rax
+  802f10:	89 c3                	mov    %eax,%ebx
+  802f12:	85 c0                	test   %eax,%eax
+  802f14:	78 1f                	js     802f35 <open+0xa3>
+    return fd2num(fd);
+  802f16:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802f1a:	48 b8 3f 16 80 00 00 	movabs $0x80163f,%rax
+  802f21:	00 00 00 
+  802f24:	ff d0                	call   *%rax
+  802f26:	89 c3                	mov    %eax,%ebx
+}
+  802f28:	89 d8                	mov    %ebx,%eax
+  802f2a:	48 83 c4 18          	add    $0x18,%rsp
+  802f2e:	5b                   	pop    %rbx
+  802f2f:	41 5c                	pop    %r12
+  802f31:	41 5d                	pop    %r13
+  802f33:	5d                   	pop    %rbp
+  802f34:	c3                   	ret
+        fd_close(fd, 0);
+  802f35:	be 00 00 00 00       	mov    $0x0,%esi
+  802f3a:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802f3e:	48 b8 88 17 80 00 00 	movabs $0x801788,%rax
+  802f45:	00 00 00 
+  802f48:	ff d0                	call   *%rax
+        return res;
+  802f4a:	eb dc                	jmp    802f28 <open+0x96>
+        return -E_BAD_PATH;
+  802f4c:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802f51:	eb d5                	jmp    802f28 <open+0x96>
+
+0000000000802f53 <file_flush_buffers>:
+file_flush_buffers(void) {
+  802f53:	55                   	push   %rbp
+  802f54:	48 89 e5             	mov    %rsp,%rbp
+  802f57:	41 56                	push   %r14
+  802f59:	41 55                	push   %r13
+  802f5b:	41 54                	push   %r12
+  802f5d:	53                   	push   %rbx
+  802f5e:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  802f62:	49 bc 08 23 82 00 00 	movabs $0x822308,%r12
+  802f69:	00 00 00 
+  802f6c:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  802f71:	49 bd cd 16 80 00 00 	movabs $0x8016cd,%r13
+  802f78:	00 00 00 
+  802f7b:	49 be 8d 26 80 00 00 	movabs $0x80268d,%r14
+  802f82:	00 00 00 
+  802f85:	eb 0c                	jmp    802f93 <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  802f87:	83 c3 01             	add    $0x1,%ebx
+  802f8a:	49 83 c4 18          	add    $0x18,%r12
+  802f8e:	83 fb 20             	cmp    $0x20,%ebx
+  802f91:	74 1d                	je     802fb0 <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  802f93:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  802f98:	74 ed                	je     802f87 <file_flush_buffers+0x34>
+  802f9a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802f9e:	89 df                	mov    %ebx,%edi
+  802fa0:	41 ff d5             	call   *%r13
+  802fa3:	85 c0                	test   %eax,%eax
+  802fa5:	78 e0                	js     802f87 <file_flush_buffers+0x34>
+  802fa7:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802fab:	41 ff d6             	call   *%r14
+  802fae:	eb d7                	jmp    802f87 <file_flush_buffers+0x34>
+}
+  802fb0:	48 83 c4 10          	add    $0x10,%rsp
+  802fb4:	5b                   	pop    %rbx
+  802fb5:	41 5c                	pop    %r12
+  802fb7:	41 5d                	pop    %r13
+  802fb9:	41 5e                	pop    %r14
+  802fbb:	5d                   	pop    %rbp
+  802fbc:	c3                   	ret
+
+0000000000802fbd <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802fbd:	55                   	push   %rbp
+  802fbe:	48 89 e5             	mov    %rsp,%rbp
+  802fc1:	41 54                	push   %r12
+  802fc3:	53                   	push   %rbx
+  802fc4:	49 89 fc             	mov    %rdi,%r12
+  802fc7:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  802fc9:	48 b8 53 2f 80 00 00 	movabs $0x802f53,%rax
+  802fd0:	00 00 00 
+  802fd3:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802fd5:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  802fdc:	00 00 00 
+  802fdf:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  802fe4:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802fe6:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  802fe9:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fee:	be 00 00 00 00       	mov    $0x0,%esi
+  802ff3:	bf 02 00 00 00       	mov    $0x2,%edi
+  802ff8:	48 b8 24 24 80 00 00 	movabs $0x802424,%rax
+  802fff:	00 00 00 
+  803002:	ff d0                	call   *%rax
+}
+  803004:	5b                   	pop    %rbx
+  803005:	41 5c                	pop    %r12
+  803007:	5d                   	pop    %rbp
+  803008:	c3                   	ret
+
+0000000000803009 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803009:	55                   	push   %rbp
+  80300a:	48 89 e5             	mov    %rsp,%rbp
+  80300d:	41 54                	push   %r12
+  80300f:	53                   	push   %rbx
+  803010:	49 89 fc             	mov    %rdi,%r12
+  803013:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  803016:	48 b8 53 2f 80 00 00 	movabs $0x802f53,%rax
+  80301d:	00 00 00 
+  803020:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803022:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  803027:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  80302e:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  803030:	ba 00 00 00 00       	mov    $0x0,%edx
+  803035:	be 00 00 00 00       	mov    $0x0,%esi
+  80303a:	bf 05 00 00 00       	mov    $0x5,%edi
+  80303f:	48 b8 24 24 80 00 00 	movabs $0x802424,%rax
+  803046:	00 00 00 
+  803049:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80304b:	85 c0                	test   %eax,%eax
+  80304d:	78 3d                	js     80308c <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80304f:	49 bc 00 00 83 00 00 	movabs $0x830000,%r12
+  803056:	00 00 00 
+  803059:	4c 89 e6             	mov    %r12,%rsi
+  80305c:	48 89 df             	mov    %rbx,%rdi
+  80305f:	48 b8 8d 0b 80 00 00 	movabs $0x800b8d,%rax
+  803066:	00 00 00 
+  803069:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80306b:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  803072:	00 
+  803073:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803079:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  803080:	00 
+  803081:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  803087:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80308c:	5b                   	pop    %rbx
+  80308d:	41 5c                	pop    %r12
+  80308f:	5d                   	pop    %rbp
+  803090:	c3                   	ret
+
+0000000000803091 <remove>:
+remove(const char *path) {
+  803091:	55                   	push   %rbp
+  803092:	48 89 e5             	mov    %rsp,%rbp
+  803095:	53                   	push   %rbx
+  803096:	48 83 ec 08          	sub    $0x8,%rsp
+  80309a:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  80309d:	48 b8 4f 0b 80 00 00 	movabs $0x800b4f,%rax
+  8030a4:	00 00 00 
+  8030a7:	ff d0                	call   *%rax
+  8030a9:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8030af:	77 3a                	ja     8030eb <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  8030b1:	48 89 de             	mov    %rbx,%rsi
+  8030b4:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  8030bb:	00 00 00 
+  8030be:	48 b8 8d 0b 80 00 00 	movabs $0x800b8d,%rax
+  8030c5:	00 00 00 
+  8030c8:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  8030ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030cf:	be 00 00 00 00       	mov    $0x0,%esi
+  8030d4:	bf 07 00 00 00       	mov    $0x7,%edi
+  8030d9:	48 b8 24 24 80 00 00 	movabs $0x802424,%rax
+  8030e0:	00 00 00 
+  8030e3:	ff d0                	call   *%rax
+}
+  8030e5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8030e9:	c9                   	leave
+  8030ea:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  8030eb:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8030f0:	eb f3                	jmp    8030e5 <remove+0x54>
+
+00000000008030f2 <sync>:
+sync(void) {
+  8030f2:	55                   	push   %rbp
+  8030f3:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  8030f6:	48 b8 53 2f 80 00 00 	movabs $0x802f53,%rax
+  8030fd:	00 00 00 
+  803100:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  803102:	ba 00 00 00 00       	mov    $0x0,%edx
+  803107:	be 00 00 00 00       	mov    $0x0,%esi
+  80310c:	bf 08 00 00 00       	mov    $0x8,%edi
+  803111:	48 b8 24 24 80 00 00 	movabs $0x802424,%rax
+  803118:	00 00 00 
+  80311b:	ff d0                	call   *%rax
+}
+  80311d:	5d                   	pop    %rbp
+  80311e:	c3                   	ret
+
+000000000080311f <fsync>:
+fsync(int fdnum) {
+  80311f:	55                   	push   %rbp
+  803120:	48 89 e5             	mov    %rsp,%rbp
+  803123:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803127:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80312b:	48 b8 cd 16 80 00 00 	movabs $0x8016cd,%rax
+  803132:	00 00 00 
+  803135:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803137:	85 c0                	test   %eax,%eax
+  803139:	78 4b                	js     803186 <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80313b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80313f:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  803146:	00 00 00 
+  803149:	8b 00                	mov    (%rax),%eax
+  80314b:	39 02                	cmp    %eax,(%rdx)
+  80314d:	75 39                	jne    803188 <fsync+0x69>
+    file_flush_buffers();
+  80314f:	48 b8 53 2f 80 00 00 	movabs $0x802f53,%rax
+  803156:	00 00 00 
+  803159:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  80315b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80315f:	8b 40 0c             	mov    0xc(%rax),%eax
+  803162:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  803169:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  80316b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803170:	be 00 00 00 00       	mov    $0x0,%esi
+  803175:	bf 0d 00 00 00       	mov    $0xd,%edi
+  80317a:	48 b8 24 24 80 00 00 	movabs $0x802424,%rax
+  803181:	00 00 00 
+  803184:	ff d0                	call   *%rax
+}
+  803186:	c9                   	leave
+  803187:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803188:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80318d:	eb f7                	jmp    803186 <fsync+0x67>
+
+000000000080318f <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  80318f:	55                   	push   %rbp
+  803190:	48 89 e5             	mov    %rsp,%rbp
+  803193:	53                   	push   %rbx
+  803194:	48 83 ec 08          	sub    $0x8,%rsp
+  803198:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  80319b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8031a5:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8031aa:	48 b8 24 24 80 00 00 	movabs $0x802424,%rax
+  8031b1:	00 00 00 
+  8031b4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8031b6:	85 c0                	test   %eax,%eax
+  8031b8:	78 2d                	js     8031e7 <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  8031ba:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  8031c1:	00 00 00 
+  8031c4:	48 8b 10             	mov    (%rax),%rdx
+  8031c7:	48 89 13             	mov    %rdx,(%rbx)
+  8031ca:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8031ce:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  8031d2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8031d6:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  8031da:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8031de:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  8031e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8031e7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8031eb:	c9                   	leave
+  8031ec:	c3                   	ret
+
+00000000008031ed <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  8031ed:	55                   	push   %rbp
+  8031ee:	48 89 e5             	mov    %rsp,%rbp
+  8031f1:	53                   	push   %rbx
+  8031f2:	48 83 ec 08          	sub    $0x8,%rsp
+  8031f6:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  8031f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031fe:	be 00 00 00 00       	mov    $0x0,%esi
+  803203:	bf 0c 00 00 00       	mov    $0xc,%edi
+  803208:	48 b8 24 24 80 00 00 	movabs $0x802424,%rax
+  80320f:	00 00 00 
+  803212:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803214:	85 c0                	test   %eax,%eax
+  803216:	78 3d                	js     803255 <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  803218:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  80321f:	00 00 00 
+  803222:	48 8b 10             	mov    (%rax),%rdx
+  803225:	48 89 13             	mov    %rdx,(%rbx)
+  803228:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80322c:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  803230:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803234:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  803238:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  80323c:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  803240:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  803244:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  803248:	48 8b 40 28          	mov    0x28(%rax),%rax
+  80324c:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  803250:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803255:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803259:	c9                   	leave
+  80325a:	c3                   	ret
+
+000000000080325b <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  80325b:	55                   	push   %rbp
+  80325c:	48 89 e5             	mov    %rsp,%rbp
+  80325f:	41 57                	push   %r15
+  803261:	41 56                	push   %r14
+  803263:	41 55                	push   %r13
+  803265:	41 54                	push   %r12
+  803267:	53                   	push   %rbx
+  803268:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  80326c:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  803273:	00 
+  803274:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  80327b:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  803281:	0f 85 43 01 00 00    	jne    8033ca <munmap+0x16f>
+  803287:	49 89 ff             	mov    %rdi,%r15
+  80328a:	4c 39 f7             	cmp    %r14,%rdi
+  80328d:	0f 87 37 01 00 00    	ja     8033ca <munmap+0x16f>
+  803293:	48 bb 00 20 82 00 00 	movabs $0x822000,%rbx
+  80329a:	00 00 00 
+  80329d:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  8032a3:	eb 2c                	jmp    8032d1 <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  8032a5:	4c 39 f8             	cmp    %r15,%rax
+  8032a8:	0f 83 85 00 00 00    	jae    803333 <munmap+0xd8>
+            m->mm_end = start;
+  8032ae:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8032b3:	48 83 c3 18          	add    $0x18,%rbx
+  8032b7:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  8032be:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8032c5:	00 00 00 
+  8032c8:	48 39 c3             	cmp    %rax,%rbx
+  8032cb:	0f 84 d0 00 00 00    	je     8033a1 <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  8032d1:	49 89 dc             	mov    %rbx,%r12
+  8032d4:	48 8b 03             	mov    (%rbx),%rax
+  8032d7:	4c 39 f0             	cmp    %r14,%rax
+  8032da:	73 d7                	jae    8032b3 <munmap+0x58>
+  8032dc:	48 85 c0             	test   %rax,%rax
+  8032df:	74 d2                	je     8032b3 <munmap+0x58>
+  8032e1:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8032e5:	49 39 d7             	cmp    %rdx,%r15
+  8032e8:	73 c9                	jae    8032b3 <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  8032ea:	49 39 d6             	cmp    %rdx,%r14
+  8032ed:	73 b6                	jae    8032a5 <munmap+0x4a>
+  8032ef:	49 39 c7             	cmp    %rax,%r15
+  8032f2:	76 b1                	jbe    8032a5 <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  8032f4:	4c 89 ef             	mov    %r13,%rdi
+  8032f7:	48 b8 92 23 80 00 00 	movabs $0x802392,%rax
+  8032fe:	00 00 00 
+  803301:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  803303:	48 85 c0             	test   %rax,%rax
+  803306:	0f 84 c5 00 00 00    	je     8033d1 <munmap+0x176>
+            *tail = *m;
+  80330c:	48 8b 13             	mov    (%rbx),%rdx
+  80330f:	48 89 10             	mov    %rdx,(%rax)
+  803312:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  803316:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  80331a:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  80331e:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  803322:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  803325:	44 89 f2             	mov    %r14d,%edx
+  803328:	2b 13                	sub    (%rbx),%edx
+  80332a:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  80332d:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  803331:	eb 80                	jmp    8032b3 <munmap+0x58>
+        } else if (m->mm_end > end) {
+  803333:	49 39 d6             	cmp    %rdx,%r14
+  803336:	73 18                	jae    803350 <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  803338:	44 89 f2             	mov    %r14d,%edx
+  80333b:	41 03 54 24 10       	add    0x10(%r12),%edx
+  803340:	29 c2                	sub    %eax,%edx
+  803342:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  803347:	4d 89 34 24          	mov    %r14,(%r12)
+  80334b:	e9 63 ff ff ff       	jmp    8032b3 <munmap+0x58>
+    m->mm_start = 0;
+  803350:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  803357:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  803358:	4c 89 e6             	mov    %r12,%rsi
+  80335b:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  803362:	00 00 00 
+  803365:	48 29 c6             	sub    %rax,%rsi
+  803368:	48 c1 fe 03          	sar    $0x3,%rsi
+  80336c:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  803373:	aa aa aa 
+  803376:	48 0f af f0          	imul   %rax,%rsi
+  80337a:	48 c1 e6 0c          	shl    $0xc,%rsi
+  80337e:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  803383:	48 01 c6             	add    %rax,%rsi
+  803386:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80338b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803390:	48 b8 92 11 80 00 00 	movabs $0x801192,%rax
+  803397:	00 00 00 
+  80339a:	ff d0                	call   *%rax
+}
+  80339c:	e9 12 ff ff ff       	jmp    8032b3 <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  8033a1:	4c 89 f2             	mov    %r14,%rdx
+  8033a4:	4c 29 fa             	sub    %r15,%rdx
+  8033a7:	4c 89 fe             	mov    %r15,%rsi
+  8033aa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033af:	48 b8 92 11 80 00 00 	movabs $0x801192,%rax
+  8033b6:	00 00 00 
+  8033b9:	ff d0                	call   *%rax
+}
+  8033bb:	48 83 c4 08          	add    $0x8,%rsp
+  8033bf:	5b                   	pop    %rbx
+  8033c0:	41 5c                	pop    %r12
+  8033c2:	41 5d                	pop    %r13
+  8033c4:	41 5e                	pop    %r14
+  8033c6:	41 5f                	pop    %r15
+  8033c8:	5d                   	pop    %rbp
+  8033c9:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  8033ca:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8033cf:	eb ea                	jmp    8033bb <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  8033d1:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  8033d6:	eb e3                	jmp    8033bb <munmap+0x160>
+
+00000000008033d8 <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  8033d8:	55                   	push   %rbp
+  8033d9:	48 89 e5             	mov    %rsp,%rbp
+  8033dc:	41 57                	push   %r15
+  8033de:	41 56                	push   %r14
+  8033e0:	41 55                	push   %r13
+  8033e2:	41 54                	push   %r12
+  8033e4:	53                   	push   %rbx
+  8033e5:	48 83 ec 28          	sub    $0x28,%rsp
+  8033e9:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8033ed:	49 89 f5             	mov    %rsi,%r13
+  8033f0:	41 89 d6             	mov    %edx,%r14d
+  8033f3:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  8033f6:	41 89 cc             	mov    %ecx,%r12d
+  8033f9:	44 89 c7             	mov    %r8d,%edi
+  8033fc:	44 89 cb             	mov    %r9d,%ebx
+  8033ff:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803403:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803407:	48 b8 cd 16 80 00 00 	movabs $0x8016cd,%rax
+  80340e:	00 00 00 
+  803411:	ff d0                	call   *%rax
+  803413:	41 89 c7             	mov    %eax,%r15d
+  803416:	85 c0                	test   %eax,%eax
+  803418:	0f 88 ae 01 00 00    	js     8035cc <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80341e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803422:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  803429:	00 00 00 
+  80342c:	8b 32                	mov    (%rdx),%esi
+  80342e:	39 30                	cmp    %esi,(%rax)
+  803430:	0f 85 7a 02 00 00    	jne    8036b0 <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  803436:	8b 40 08             	mov    0x8(%rax),%eax
+  803439:	83 e0 03             	and    $0x3,%eax
+  80343c:	83 f8 01             	cmp    $0x1,%eax
+  80343f:	0f 84 76 02 00 00    	je     8036bb <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  803445:	4d 85 ed             	test   %r13,%r13
+  803448:	0f 84 78 02 00 00    	je     8036c6 <mmap+0x2ee>
+  80344e:	85 db                	test   %ebx,%ebx
+  803450:	0f 88 70 02 00 00    	js     8036c6 <mmap+0x2ee>
+  803456:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  80345c:	41 89 df             	mov    %ebx,%r15d
+  80345f:	0f 85 6c 02 00 00    	jne    8036d1 <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  803465:	44 89 f0             	mov    %r14d,%eax
+  803468:	83 e0 fd             	and    $0xfffffffd,%eax
+  80346b:	83 f8 04             	cmp    $0x4,%eax
+  80346e:	0f 85 68 02 00 00    	jne    8036dc <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  803474:	44 89 e1             	mov    %r12d,%ecx
+  803477:	83 e1 01             	and    $0x1,%ecx
+  80347a:	0f 95 c2             	setne  %dl
+  80347d:	44 89 e0             	mov    %r12d,%eax
+  803480:	d1 e8                	shr    %eax
+  803482:	83 f0 01             	xor    $0x1,%eax
+  803485:	83 e0 01             	and    $0x1,%eax
+  803488:	38 c2                	cmp    %al,%dl
+  80348a:	0f 85 57 02 00 00    	jne    8036e7 <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  803490:	85 c9                	test   %ecx,%ecx
+  803492:	74 0a                	je     80349e <mmap+0xc6>
+  803494:	41 f6 c6 02          	test   $0x2,%r14b
+  803498:	0f 85 54 02 00 00    	jne    8036f2 <mmap+0x31a>
+    file_flush_buffers();
+  80349e:	48 b8 53 2f 80 00 00 	movabs $0x802f53,%rax
+  8034a5:	00 00 00 
+  8034a8:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  8034aa:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  8034b1:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  8034b8:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8034bc:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  8034bf:	41 f6 c4 04          	test   $0x4,%r12b
+  8034c3:	0f 84 15 01 00 00    	je     8035de <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  8034c9:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  8034cc:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8034d2:	0f 85 25 02 00 00    	jne    8036fd <mmap+0x325>
+  8034d8:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  8034dc:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  8034e3:	00 00 00 
+  8034e6:	48 39 c2             	cmp    %rax,%rdx
+  8034e9:	0f 82 19 02 00 00    	jb     803708 <mmap+0x330>
+  8034ef:	48 39 c7             	cmp    %rax,%rdi
+  8034f2:	0f 87 10 02 00 00    	ja     803708 <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  8034f8:	4c 89 ee             	mov    %r13,%rsi
+  8034fb:	48 b8 5b 32 80 00 00 	movabs $0x80325b,%rax
+  803502:	00 00 00 
+  803505:	ff d0                	call   *%rax
+  803507:	85 c0                	test   %eax,%eax
+  803509:	0f 88 04 02 00 00    	js     803713 <mmap+0x33b>
+    if (!handler) {
+  80350f:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  803516:	00 00 00 
+  803519:	80 38 00             	cmpb   $0x0,(%rax)
+  80351c:	75 2b                	jne    803549 <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  80351e:	48 bf f3 22 80 00 00 	movabs $0x8022f3,%rdi
+  803525:	00 00 00 
+  803528:	48 b8 57 44 80 00 00 	movabs $0x804457,%rax
+  80352f:	00 00 00 
+  803532:	ff d0                	call   *%rax
+  803534:	85 c0                	test   %eax,%eax
+  803536:	0f 88 ea 01 00 00    	js     803726 <mmap+0x34e>
+        handler = 1;
+  80353c:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  803543:	00 00 00 
+  803546:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  803549:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80354d:	48 b8 92 23 80 00 00 	movabs $0x802392,%rax
+  803554:	00 00 00 
+  803557:	ff d0                	call   *%rax
+  803559:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  80355c:	48 85 c0             	test   %rax,%rax
+  80355f:	0f 84 c9 01 00 00    	je     80372e <mmap+0x356>
+    m->mm_start = va;
+  803565:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  803568:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  80356c:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  803570:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  803573:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  803577:	44 89 e0             	mov    %r12d,%eax
+  80357a:	c1 e0 06             	shl    $0x6,%eax
+  80357d:	25 80 00 00 00       	and    $0x80,%eax
+  803582:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  803585:	09 f0                	or     %esi,%eax
+  803587:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  80358b:	41 f6 c4 08          	test   $0x8,%r12b
+  80358f:	74 31                	je     8035c2 <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  803591:	48 39 d3             	cmp    %rdx,%rbx
+  803594:	73 2c                	jae    8035c2 <mmap+0x1ea>
+  803596:	ba 00 00 04 00       	mov    $0x40000,%edx
+  80359b:	48 89 de             	mov    %rbx,%rsi
+  80359e:	4c 89 f7             	mov    %r14,%rdi
+  8035a1:	48 b8 e2 21 80 00 00 	movabs $0x8021e2,%rax
+  8035a8:	00 00 00 
+  8035ab:	ff d0                	call   *%rax
+  8035ad:	49 89 c4             	mov    %rax,%r12
+  8035b0:	48 85 c0             	test   %rax,%rax
+  8035b3:	0f 8e d7 00 00 00    	jle    803690 <mmap+0x2b8>
+            va += n;
+  8035b9:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  8035bc:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  8035c0:	72 d4                	jb     803596 <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  8035c2:	49 8b 06             	mov    (%r14),%rax
+  8035c5:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  8035c9:	48 89 06             	mov    %rax,(%rsi)
+}
+  8035cc:	44 89 f8             	mov    %r15d,%eax
+  8035cf:	48 83 c4 28          	add    $0x28,%rsp
+  8035d3:	5b                   	pop    %rbx
+  8035d4:	41 5c                	pop    %r12
+  8035d6:	41 5d                	pop    %r13
+  8035d8:	41 5e                	pop    %r14
+  8035da:	41 5f                	pop    %r15
+  8035dc:	5d                   	pop    %rbp
+  8035dd:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8035de:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  8035e5:	00 00 00 
+  8035e8:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  8035eb:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  8035f2:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8035f5:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  8035fa:	48 be 00 20 82 00 00 	movabs $0x822000,%rsi
+  803601:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803604:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  80360b:	00 00 00 
+  80360e:	48 39 d7             	cmp    %rdx,%rdi
+  803611:	73 1c                	jae    80362f <mmap+0x257>
+        return -E_NO_MEM;
+  803613:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803619:	eb b1                	jmp    8035cc <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80361b:	48 83 c0 01          	add    $0x1,%rax
+  80361f:	48 83 f8 1f          	cmp    $0x1f,%rax
+  803623:	77 3f                	ja     803664 <mmap+0x28c>
+  803625:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  80362a:	48 39 d7             	cmp    %rdx,%rdi
+  80362d:	72 2a                	jb     803659 <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  80362f:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  803633:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  803637:	48 39 d1             	cmp    %rdx,%rcx
+  80363a:	73 df                	jae    80361b <mmap+0x243>
+  80363c:	48 85 c9             	test   %rcx,%rcx
+  80363f:	74 da                	je     80361b <mmap+0x243>
+  803641:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  803645:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  80364a:	48 39 d3             	cmp    %rdx,%rbx
+  80364d:	73 cc                	jae    80361b <mmap+0x243>
+            va = mmaps[i].mm_end;
+  80364f:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803652:	b8 00 00 00 00       	mov    $0x0,%eax
+  803657:	eb cc                	jmp    803625 <mmap+0x24d>
+        return -E_NO_MEM;
+  803659:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80365f:	e9 68 ff ff ff       	jmp    8035cc <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  803664:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  803669:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  803670:	00 00 00 
+  803673:	48 39 c2             	cmp    %rax,%rdx
+  803676:	0f 82 9f 00 00 00    	jb     80371b <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  80367c:	48 85 db             	test   %rbx,%rbx
+  80367f:	0f 85 8a fe ff ff    	jne    80350f <mmap+0x137>
+        return -E_NO_MEM;
+  803685:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80368b:	e9 3c ff ff ff       	jmp    8035cc <mmap+0x1f4>
+        if (n < 0) {
+  803690:	0f 89 2c ff ff ff    	jns    8035c2 <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  803696:	49 8b 3e             	mov    (%r14),%rdi
+  803699:	4c 89 ee             	mov    %r13,%rsi
+  80369c:	48 b8 5b 32 80 00 00 	movabs $0x80325b,%rax
+  8036a3:	00 00 00 
+  8036a6:	ff d0                	call   *%rax
+            return n;
+  8036a8:	45 89 e7             	mov    %r12d,%r15d
+  8036ab:	e9 1c ff ff ff       	jmp    8035cc <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8036b0:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8036b6:	e9 11 ff ff ff       	jmp    8035cc <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  8036bb:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8036c1:	e9 06 ff ff ff       	jmp    8035cc <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  8036c6:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8036cc:	e9 fb fe ff ff       	jmp    8035cc <mmap+0x1f4>
+  8036d1:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8036d7:	e9 f0 fe ff ff       	jmp    8035cc <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  8036dc:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8036e2:	e9 e5 fe ff ff       	jmp    8035cc <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  8036e7:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8036ed:	e9 da fe ff ff       	jmp    8035cc <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  8036f2:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  8036f8:	e9 cf fe ff ff       	jmp    8035cc <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  8036fd:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803703:	e9 c4 fe ff ff       	jmp    8035cc <mmap+0x1f4>
+  803708:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80370e:	e9 b9 fe ff ff       	jmp    8035cc <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  803713:	41 89 c7             	mov    %eax,%r15d
+  803716:	e9 b1 fe ff ff       	jmp    8035cc <mmap+0x1f4>
+        return -E_NO_MEM;
+  80371b:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803721:	e9 a6 fe ff ff       	jmp    8035cc <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  803726:	41 89 c7             	mov    %eax,%r15d
+  803729:	e9 9e fe ff ff       	jmp    8035cc <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  80372e:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803734:	e9 93 fe ff ff       	jmp    8035cc <mmap+0x1f4>
+
+0000000000803739 <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803739:	55                   	push   %rbp
+  80373a:	48 89 e5             	mov    %rsp,%rbp
+  80373d:	41 54                	push   %r12
+  80373f:	53                   	push   %rbx
+  803740:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803743:	48 b8 51 16 80 00 00 	movabs $0x801651,%rax
+  80374a:	00 00 00 
+  80374d:	ff d0                	call   *%rax
+  80374f:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803752:	48 be 60 4f 80 00 00 	movabs $0x804f60,%rsi
+  803759:	00 00 00 
+  80375c:	48 89 df             	mov    %rbx,%rdi
+  80375f:	48 b8 8d 0b 80 00 00 	movabs $0x800b8d,%rax
+  803766:	00 00 00 
+  803769:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  80376b:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803770:	41 2b 04 24          	sub    (%r12),%eax
+  803774:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  80377a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803781:	00 00 00 
+    stat->st_dev = &devpipe;
+  803784:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  80378b:	00 00 00 
+  80378e:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803795:	b8 00 00 00 00       	mov    $0x0,%eax
+  80379a:	5b                   	pop    %rbx
+  80379b:	41 5c                	pop    %r12
+  80379d:	5d                   	pop    %rbp
+  80379e:	c3                   	ret
+
+000000000080379f <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  80379f:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8037a2:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  8037a8:	8b 17                	mov    (%rdi),%edx
+  8037aa:	85 d2                	test   %edx,%edx
+  8037ac:	75 01                	jne    8037af <pipe_wakeup+0x10>
+  8037ae:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  8037af:	55                   	push   %rbp
+  8037b0:	48 89 e5             	mov    %rsp,%rbp
+  8037b3:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  8037b6:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  8037bc:	be 00 04 00 00       	mov    $0x400,%esi
+  8037c1:	48 b8 78 14 80 00 00 	movabs $0x801478,%rax
+  8037c8:	00 00 00 
+  8037cb:	ff d0                	call   *%rax
+}
+  8037cd:	5d                   	pop    %rbp
+  8037ce:	c3                   	ret
+
+00000000008037cf <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8037cf:	55                   	push   %rbp
+  8037d0:	48 89 e5             	mov    %rsp,%rbp
+  8037d3:	41 55                	push   %r13
+  8037d5:	41 54                	push   %r12
+  8037d7:	53                   	push   %rbx
+  8037d8:	48 83 ec 08          	sub    $0x8,%rsp
+  8037dc:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8037df:	48 b8 51 16 80 00 00 	movabs $0x801651,%rax
+  8037e6:	00 00 00 
+  8037e9:	ff d0                	call   *%rax
+  8037eb:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8037ee:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8037f3:	4c 89 e6             	mov    %r12,%rsi
+  8037f6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037fb:	49 bc 92 11 80 00 00 	movabs $0x801192,%r12
+  803802:	00 00 00 
+  803805:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803808:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  80380c:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803810:	49 bd 9f 37 80 00 00 	movabs $0x80379f,%r13
+  803817:	00 00 00 
+  80381a:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  80381d:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803821:	48 89 de             	mov    %rbx,%rsi
+  803824:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  803827:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80382c:	48 89 de             	mov    %rbx,%rsi
+  80382f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803834:	41 ff d4             	call   *%r12
+  803837:	48 83 c4 08          	add    $0x8,%rsp
+  80383b:	5b                   	pop    %rbx
+  80383c:	41 5c                	pop    %r12
+  80383e:	41 5d                	pop    %r13
+  803840:	5d                   	pop    %rbp
+  803841:	c3                   	ret
+
+0000000000803842 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  803842:	55                   	push   %rbp
+  803843:	48 89 e5             	mov    %rsp,%rbp
+  803846:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803849:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80384e:	be 00 10 00 00       	mov    $0x1000,%esi
+  803853:	48 b8 d5 10 80 00 00 	movabs $0x8010d5,%rax
+  80385a:	00 00 00 
+  80385d:	ff d0                	call   *%rax
+  80385f:	85 c0                	test   %eax,%eax
+  803861:	0f 94 c0             	sete   %al
+  803864:	0f b6 c0             	movzbl %al,%eax
+}
+  803867:	5d                   	pop    %rbp
+  803868:	c3                   	ret
+
+0000000000803869 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803869:	55                   	push   %rbp
+  80386a:	48 89 e5             	mov    %rsp,%rbp
+  80386d:	41 57                	push   %r15
+  80386f:	41 56                	push   %r14
+  803871:	41 55                	push   %r13
+  803873:	41 54                	push   %r12
+  803875:	53                   	push   %rbx
+  803876:	48 83 ec 38          	sub    $0x38,%rsp
+  80387a:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80387e:	49 89 f4             	mov    %rsi,%r12
+  803881:	49 89 d7             	mov    %rdx,%r15
+  803884:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803888:	48 b8 51 16 80 00 00 	movabs $0x801651,%rax
+  80388f:	00 00 00 
+  803892:	ff d0                	call   *%rax
+  803894:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803897:	4d 85 ff             	test   %r15,%r15
+  80389a:	0f 84 f1 00 00 00    	je     803991 <devpipe_write+0x128>
+  8038a0:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  8038a4:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  8038a8:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  8038ac:	49 bd 42 38 80 00 00 	movabs $0x803842,%r13
+  8038b3:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8038b6:	49 bf 9f 37 80 00 00 	movabs $0x80379f,%r15
+  8038bd:	00 00 00 
+  8038c0:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  8038c4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8038c8:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8038cc:	8b 73 04             	mov    0x4(%rbx),%esi
+  8038cf:	48 63 ce             	movslq %esi,%rcx
+  8038d2:	48 63 03             	movslq (%rbx),%rax
+  8038d5:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  8038db:	48 39 c1             	cmp    %rax,%rcx
+  8038de:	72 64                	jb     803944 <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  8038e0:	48 89 de             	mov    %rbx,%rsi
+  8038e3:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8038e7:	41 ff d5             	call   *%r13
+  8038ea:	85 c0                	test   %eax,%eax
+  8038ec:	0f 85 b9 00 00 00    	jne    8039ab <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8038f2:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8038f6:	4c 89 f7             	mov    %r14,%rdi
+  8038f9:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  8038fc:	8b 43 04             	mov    0x4(%rbx),%eax
+  8038ff:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  803906:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  80390d:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803913:	8b 03                	mov    (%rbx),%eax
+  803915:	41 39 c4             	cmp    %eax,%r12d
+  803918:	75 b2                	jne    8038cc <devpipe_write+0x63>
+  80391a:	48 89 de             	mov    %rbx,%rsi
+  80391d:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803921:	41 ff d5             	call   *%r13
+  803924:	85 c0                	test   %eax,%eax
+  803926:	75 a0                	jne    8038c8 <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803928:	ba 0a 00 00 00       	mov    $0xa,%edx
+  80392d:	44 89 e6             	mov    %r12d,%esi
+  803930:	48 89 df             	mov    %rbx,%rdi
+  803933:	48 b8 5a 14 80 00 00 	movabs $0x80145a,%rax
+  80393a:	00 00 00 
+  80393d:	ff d0                	call   *%rax
+  80393f:	e9 7c ff ff ff       	jmp    8038c0 <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803944:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  803948:	41 0f b6 38          	movzbl (%r8),%edi
+  80394c:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803953:	80 80 80 
+  803956:	48 89 c8             	mov    %rcx,%rax
+  803959:	48 f7 e2             	mul    %rdx
+  80395c:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803960:	48 89 d0             	mov    %rdx,%rax
+  803963:	48 c1 e0 08          	shl    $0x8,%rax
+  803967:	48 29 d0             	sub    %rdx,%rax
+  80396a:	48 c1 e0 04          	shl    $0x4,%rax
+  80396e:	48 29 c1             	sub    %rax,%rcx
+  803971:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  803976:	83 c6 01             	add    $0x1,%esi
+  803979:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80397c:	49 83 c0 01          	add    $0x1,%r8
+  803980:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  803984:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803988:	49 39 c0             	cmp    %rax,%r8
+  80398b:	0f 85 2f ff ff ff    	jne    8038c0 <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803991:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803995:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803999:	48 b8 9f 37 80 00 00 	movabs $0x80379f,%rax
+  8039a0:	00 00 00 
+  8039a3:	ff d0                	call   *%rax
+    return n;
+  8039a5:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8039a9:	eb 05                	jmp    8039b0 <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  8039ab:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8039b0:	48 83 c4 38          	add    $0x38,%rsp
+  8039b4:	5b                   	pop    %rbx
+  8039b5:	41 5c                	pop    %r12
+  8039b7:	41 5d                	pop    %r13
+  8039b9:	41 5e                	pop    %r14
+  8039bb:	41 5f                	pop    %r15
+  8039bd:	5d                   	pop    %rbp
+  8039be:	c3                   	ret
+
+00000000008039bf <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8039bf:	55                   	push   %rbp
+  8039c0:	48 89 e5             	mov    %rsp,%rbp
+  8039c3:	41 57                	push   %r15
+  8039c5:	41 56                	push   %r14
+  8039c7:	41 55                	push   %r13
+  8039c9:	41 54                	push   %r12
+  8039cb:	53                   	push   %rbx
+  8039cc:	48 83 ec 28          	sub    $0x28,%rsp
+  8039d0:	49 89 fd             	mov    %rdi,%r13
+  8039d3:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  8039d7:	49 89 d4             	mov    %rdx,%r12
+  8039da:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8039de:	48 b8 51 16 80 00 00 	movabs $0x801651,%rax
+  8039e5:	00 00 00 
+  8039e8:	ff d0                	call   *%rax
+  8039ea:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8039ed:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  8039f3:	49 bf 42 38 80 00 00 	movabs $0x803842,%r15
+  8039fa:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8039fd:	4d 85 e4             	test   %r12,%r12
+  803a00:	0f 84 d5 00 00 00    	je     803adb <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803a06:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803a0a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803a0e:	8b 03                	mov    (%rbx),%eax
+  803a10:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803a13:	75 7a                	jne    803a8f <devpipe_read+0xd0>
+            if (i > 0) {
+  803a15:	4d 85 f6             	test   %r14,%r14
+  803a18:	75 50                	jne    803a6a <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  803a1a:	48 89 de             	mov    %rbx,%rsi
+  803a1d:	4c 89 ef             	mov    %r13,%rdi
+  803a20:	41 ff d7             	call   *%r15
+  803a23:	85 c0                	test   %eax,%eax
+  803a25:	0f 85 c9 00 00 00    	jne    803af4 <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803a2b:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  803a2e:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803a35:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803a3b:	8b 43 04             	mov    0x4(%rbx),%eax
+  803a3e:	41 39 c4             	cmp    %eax,%r12d
+  803a41:	75 cb                	jne    803a0e <devpipe_read+0x4f>
+  803a43:	48 89 de             	mov    %rbx,%rsi
+  803a46:	4c 89 ef             	mov    %r13,%rdi
+  803a49:	41 ff d7             	call   *%r15
+  803a4c:	85 c0                	test   %eax,%eax
+  803a4e:	75 be                	jne    803a0e <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803a50:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803a55:	44 89 e6             	mov    %r12d,%esi
+  803a58:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803a5c:	48 b8 5a 14 80 00 00 	movabs $0x80145a,%rax
+  803a63:	00 00 00 
+  803a66:	ff d0                	call   *%rax
+  803a68:	eb a4                	jmp    803a0e <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803a6a:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803a6e:	48 89 de             	mov    %rbx,%rsi
+  803a71:	48 b8 9f 37 80 00 00 	movabs $0x80379f,%rax
+  803a78:	00 00 00 
+  803a7b:	ff d0                	call   *%rax
+                return i;
+  803a7d:	4c 89 f0             	mov    %r14,%rax
+}
+  803a80:	48 83 c4 28          	add    $0x28,%rsp
+  803a84:	5b                   	pop    %rbx
+  803a85:	41 5c                	pop    %r12
+  803a87:	41 5d                	pop    %r13
+  803a89:	41 5e                	pop    %r14
+  803a8b:	41 5f                	pop    %r15
+  803a8d:	5d                   	pop    %rbp
+  803a8e:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803a8f:	48 63 c8             	movslq %eax,%rcx
+  803a92:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803a99:	80 80 80 
+  803a9c:	48 89 c8             	mov    %rcx,%rax
+  803a9f:	48 f7 e2             	mul    %rdx
+  803aa2:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803aa6:	48 89 d0             	mov    %rdx,%rax
+  803aa9:	48 c1 e0 08          	shl    $0x8,%rax
+  803aad:	48 29 d0             	sub    %rdx,%rax
+  803ab0:	48 c1 e0 04          	shl    $0x4,%rax
+  803ab4:	48 89 c2             	mov    %rax,%rdx
+  803ab7:	48 89 c8             	mov    %rcx,%rax
+  803aba:	48 29 d0             	sub    %rdx,%rax
+  803abd:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  803ac2:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803ac6:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  803aca:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803acd:	49 83 c6 01          	add    $0x1,%r14
+  803ad1:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  803ad5:	0f 85 2b ff ff ff    	jne    803a06 <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803adb:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803adf:	48 89 de             	mov    %rbx,%rsi
+  803ae2:	48 b8 9f 37 80 00 00 	movabs $0x80379f,%rax
+  803ae9:	00 00 00 
+  803aec:	ff d0                	call   *%rax
+    return n;
+  803aee:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803af2:	eb 8c                	jmp    803a80 <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  803af4:	b8 00 00 00 00       	mov    $0x0,%eax
+  803af9:	eb 85                	jmp    803a80 <devpipe_read+0xc1>
+
+0000000000803afb <pipe>:
+pipe(int pfd[2]) {
+  803afb:	55                   	push   %rbp
+  803afc:	48 89 e5             	mov    %rsp,%rbp
+  803aff:	41 55                	push   %r13
+  803b01:	41 54                	push   %r12
+  803b03:	53                   	push   %rbx
+  803b04:	48 83 ec 18          	sub    $0x18,%rsp
+  803b08:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803b0b:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803b0f:	48 b8 6d 16 80 00 00 	movabs $0x80166d,%rax
+  803b16:	00 00 00 
+  803b19:	ff d0                	call   *%rax
+  803b1b:	89 c3                	mov    %eax,%ebx
+  803b1d:	85 c0                	test   %eax,%eax
+  803b1f:	0f 88 a0 01 00 00    	js     803cc5 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803b25:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803b2a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b2f:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803b33:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b38:	48 b8 ec 10 80 00 00 	movabs $0x8010ec,%rax
+  803b3f:	00 00 00 
+  803b42:	ff d0                	call   *%rax
+  803b44:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803b46:	85 c0                	test   %eax,%eax
+  803b48:	0f 88 77 01 00 00    	js     803cc5 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803b4e:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803b52:	48 b8 6d 16 80 00 00 	movabs $0x80166d,%rax
+  803b59:	00 00 00 
+  803b5c:	ff d0                	call   *%rax
+  803b5e:	89 c3                	mov    %eax,%ebx
+  803b60:	85 c0                	test   %eax,%eax
+  803b62:	0f 88 43 01 00 00    	js     803cab <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803b68:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803b6d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b72:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803b76:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b7b:	48 b8 ec 10 80 00 00 	movabs $0x8010ec,%rax
+  803b82:	00 00 00 
+  803b85:	ff d0                	call   *%rax
+  803b87:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803b89:	85 c0                	test   %eax,%eax
+  803b8b:	0f 88 1a 01 00 00    	js     803cab <pipe+0x1b0>
+    va = fd2data(fd0);
+  803b91:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803b95:	48 b8 51 16 80 00 00 	movabs $0x801651,%rax
+  803b9c:	00 00 00 
+  803b9f:	ff d0                	call   *%rax
+  803ba1:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803ba4:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803ba9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803bae:	48 89 c6             	mov    %rax,%rsi
+  803bb1:	bf 00 00 00 00       	mov    $0x0,%edi
+  803bb6:	48 b8 ec 10 80 00 00 	movabs $0x8010ec,%rax
+  803bbd:	00 00 00 
+  803bc0:	ff d0                	call   *%rax
+  803bc2:	89 c3                	mov    %eax,%ebx
+  803bc4:	85 c0                	test   %eax,%eax
+  803bc6:	0f 88 c5 00 00 00    	js     803c91 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803bcc:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803bd0:	48 b8 51 16 80 00 00 	movabs $0x801651,%rax
+  803bd7:	00 00 00 
+  803bda:	ff d0                	call   *%rax
+  803bdc:	48 89 c1             	mov    %rax,%rcx
+  803bdf:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803be5:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803beb:	ba 00 00 00 00       	mov    $0x0,%edx
+  803bf0:	4c 89 ee             	mov    %r13,%rsi
+  803bf3:	bf 00 00 00 00       	mov    $0x0,%edi
+  803bf8:	48 b8 42 11 80 00 00 	movabs $0x801142,%rax
+  803bff:	00 00 00 
+  803c02:	ff d0                	call   *%rax
+  803c04:	89 c3                	mov    %eax,%ebx
+  803c06:	85 c0                	test   %eax,%eax
+  803c08:	78 6e                	js     803c78 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803c0a:	be 00 10 00 00       	mov    $0x1000,%esi
+  803c0f:	4c 89 ef             	mov    %r13,%rdi
+  803c12:	48 b8 b1 10 80 00 00 	movabs $0x8010b1,%rax
+  803c19:	00 00 00 
+  803c1c:	ff d0                	call   *%rax
+  803c1e:	83 f8 02             	cmp    $0x2,%eax
+  803c21:	0f 85 ab 00 00 00    	jne    803cd2 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803c27:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803c2e:	00 00 
+  803c30:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803c34:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803c36:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803c3a:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803c41:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803c45:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803c47:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803c4b:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803c52:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803c56:	48 bb 3f 16 80 00 00 	movabs $0x80163f,%rbx
+  803c5d:	00 00 00 
+  803c60:	ff d3                	call   *%rbx
+  803c62:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803c66:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803c6a:	ff d3                	call   *%rbx
+  803c6c:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803c71:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803c76:	eb 4d                	jmp    803cc5 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803c78:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c7d:	4c 89 ee             	mov    %r13,%rsi
+  803c80:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c85:	48 b8 92 11 80 00 00 	movabs $0x801192,%rax
+  803c8c:	00 00 00 
+  803c8f:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803c91:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c96:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803c9a:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c9f:	48 b8 92 11 80 00 00 	movabs $0x801192,%rax
+  803ca6:	00 00 00 
+  803ca9:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803cab:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803cb0:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803cb4:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cb9:	48 b8 92 11 80 00 00 	movabs $0x801192,%rax
+  803cc0:	00 00 00 
+  803cc3:	ff d0                	call   *%rax
+}
+  803cc5:	89 d8                	mov    %ebx,%eax
+  803cc7:	48 83 c4 18          	add    $0x18,%rsp
+  803ccb:	5b                   	pop    %rbx
+  803ccc:	41 5c                	pop    %r12
+  803cce:	41 5d                	pop    %r13
+  803cd0:	5d                   	pop    %rbp
+  803cd1:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803cd2:	48 b9 90 4f 80 00 00 	movabs $0x804f90,%rcx
+  803cd9:	00 00 00 
+  803cdc:	48 ba 67 4f 80 00 00 	movabs $0x804f67,%rdx
+  803ce3:	00 00 00 
+  803ce6:	be 50 00 00 00       	mov    $0x50,%esi
+  803ceb:	48 bf 7c 4f 80 00 00 	movabs $0x804f7c,%rdi
+  803cf2:	00 00 00 
+  803cf5:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cfa:	49 b8 2a 43 80 00 00 	movabs $0x80432a,%r8
+  803d01:	00 00 00 
+  803d04:	41 ff d0             	call   *%r8
+
+0000000000803d07 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803d07:	55                   	push   %rbp
+  803d08:	48 89 e5             	mov    %rsp,%rbp
+  803d0b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803d0f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803d13:	48 b8 cd 16 80 00 00 	movabs $0x8016cd,%rax
+  803d1a:	00 00 00 
+  803d1d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803d1f:	85 c0                	test   %eax,%eax
+  803d21:	78 23                	js     803d46 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803d23:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803d27:	48 b8 51 16 80 00 00 	movabs $0x801651,%rax
+  803d2e:	00 00 00 
+  803d31:	ff d0                	call   *%rax
+  803d33:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  803d36:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803d3a:	48 b8 42 38 80 00 00 	movabs $0x803842,%rax
+  803d41:	00 00 00 
+  803d44:	ff d0                	call   *%rax
+}
+  803d46:	c9                   	leave
+  803d47:	c3                   	ret
+
+0000000000803d48 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803d48:	48 89 f8             	mov    %rdi,%rax
+  803d4b:	48 c1 e8 27          	shr    $0x27,%rax
+  803d4f:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803d56:	01 00 00 
+  803d59:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803d5d:	f6 c2 01             	test   $0x1,%dl
+  803d60:	74 6d                	je     803dcf <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803d62:	48 89 f8             	mov    %rdi,%rax
+  803d65:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803d69:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803d70:	01 00 00 
+  803d73:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803d77:	f6 c2 01             	test   $0x1,%dl
+  803d7a:	74 62                	je     803dde <get_uvpt_entry+0x96>
+  803d7c:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803d83:	01 00 00 
+  803d86:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803d8a:	f6 c2 80             	test   $0x80,%dl
+  803d8d:	75 4f                	jne    803dde <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803d8f:	48 89 f8             	mov    %rdi,%rax
+  803d92:	48 c1 e8 15          	shr    $0x15,%rax
+  803d96:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803d9d:	01 00 00 
+  803da0:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803da4:	f6 c2 01             	test   $0x1,%dl
+  803da7:	74 44                	je     803ded <get_uvpt_entry+0xa5>
+  803da9:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803db0:	01 00 00 
+  803db3:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803db7:	f6 c2 80             	test   $0x80,%dl
+  803dba:	75 31                	jne    803ded <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803dbc:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803dc0:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803dc7:	01 00 00 
+  803dca:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803dce:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803dcf:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803dd6:	01 00 00 
+  803dd9:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803ddd:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803dde:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803de5:	01 00 00 
+  803de8:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803dec:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803ded:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803df4:	01 00 00 
+  803df7:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803dfb:	c3                   	ret
+
+0000000000803dfc <get_prot>:
+
+int
+get_prot(void *va) {
+  803dfc:	55                   	push   %rbp
+  803dfd:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803e00:	48 b8 48 3d 80 00 00 	movabs $0x803d48,%rax
+  803e07:	00 00 00 
+  803e0a:	ff d0                	call   *%rax
+  803e0c:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803e0f:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803e14:	89 c1                	mov    %eax,%ecx
+  803e16:	83 c9 04             	or     $0x4,%ecx
+  803e19:	f6 c2 01             	test   $0x1,%dl
+  803e1c:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803e1f:	89 c1                	mov    %eax,%ecx
+  803e21:	83 c9 02             	or     $0x2,%ecx
+  803e24:	f6 c2 02             	test   $0x2,%dl
+  803e27:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803e2a:	89 c1                	mov    %eax,%ecx
+  803e2c:	83 c9 01             	or     $0x1,%ecx
+  803e2f:	48 85 d2             	test   %rdx,%rdx
+  803e32:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803e35:	89 c1                	mov    %eax,%ecx
+  803e37:	83 c9 40             	or     $0x40,%ecx
+  803e3a:	f6 c6 04             	test   $0x4,%dh
+  803e3d:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803e40:	5d                   	pop    %rbp
+  803e41:	c3                   	ret
+
+0000000000803e42 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803e42:	55                   	push   %rbp
+  803e43:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803e46:	48 b8 48 3d 80 00 00 	movabs $0x803d48,%rax
+  803e4d:	00 00 00 
+  803e50:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803e52:	48 c1 e8 06          	shr    $0x6,%rax
+  803e56:	83 e0 01             	and    $0x1,%eax
+}
+  803e59:	5d                   	pop    %rbp
+  803e5a:	c3                   	ret
+
+0000000000803e5b <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803e5b:	55                   	push   %rbp
+  803e5c:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803e5f:	48 b8 48 3d 80 00 00 	movabs $0x803d48,%rax
+  803e66:	00 00 00 
+  803e69:	ff d0                	call   *%rax
+  803e6b:	83 e0 01             	and    $0x1,%eax
+}
+  803e6e:	5d                   	pop    %rbp
+  803e6f:	c3                   	ret
+
+0000000000803e70 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  803e70:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  803e77:	01 00 00 
+  803e7a:	a8 01                	test   $0x1,%al
+  803e7c:	75 06                	jne    803e84 <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  803e7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e83:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803e84:	55                   	push   %rbp
+  803e85:	48 89 e5             	mov    %rsp,%rbp
+  803e88:	41 57                	push   %r15
+  803e8a:	41 56                	push   %r14
+  803e8c:	41 55                	push   %r13
+  803e8e:	41 54                	push   %r12
+  803e90:	53                   	push   %rbx
+  803e91:	48 83 ec 28          	sub    $0x28,%rsp
+  803e95:	49 89 fe             	mov    %rdi,%r14
+  803e98:	49 89 f7             	mov    %rsi,%r15
+  803e9b:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  803ea2:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  803ea3:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  803eaa:	01 00 00 
+  803ead:	e9 ae 00 00 00       	jmp    803f60 <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  803eb2:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803eb9:	49 83 ec 01          	sub    $0x1,%r12
+  803ebd:	74 2d                	je     803eec <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  803ebf:	48 89 d8             	mov    %rbx,%rax
+  803ec2:	48 c1 e8 0c          	shr    $0xc,%rax
+  803ec6:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  803ecb:	f6 c2 01             	test   $0x1,%dl
+  803ece:	74 e2                	je     803eb2 <foreach_shared_region+0x42>
+  803ed0:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  803ed5:	f6 c4 04             	test   $0x4,%ah
+  803ed8:	74 d8                	je     803eb2 <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  803eda:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803ee1:	4c 89 fa             	mov    %r15,%rdx
+  803ee4:	48 89 df             	mov    %rbx,%rdi
+  803ee7:	41 ff d6             	call   *%r14
+  803eea:	eb c6                	jmp    803eb2 <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  803eec:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  803ef3:	00 
+  803ef4:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  803ef9:	74 4a                	je     803f45 <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  803efb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803eff:	48 c1 e8 15          	shr    $0x15,%rax
+  803f03:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  803f0a:	01 00 00 
+  803f0d:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  803f11:	a8 01                	test   $0x1,%al
+  803f13:	74 d7                	je     803eec <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  803f15:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  803f19:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  803f20:	48 39 c3             	cmp    %rax,%rbx
+  803f23:	73 c7                	jae    803eec <foreach_shared_region+0x7c>
+  803f25:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  803f2c:	48 39 d0             	cmp    %rdx,%rax
+  803f2f:	4d 19 e4             	sbb    %r12,%r12
+  803f32:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  803f39:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  803f40:	e9 7a ff ff ff       	jmp    803ebf <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  803f45:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  803f4c:	40 
+  803f4d:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803f51:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803f58:	00 00 00 
+  803f5b:	48 39 c1             	cmp    %rax,%rcx
+  803f5e:	74 50                	je     803fb0 <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  803f60:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803f64:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803f68:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  803f6f:	01 00 00 
+  803f72:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  803f76:	a8 01                	test   $0x1,%al
+  803f78:	74 cb                	je     803f45 <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  803f7a:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803f7e:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  803f85:	48 39 c1             	cmp    %rax,%rcx
+  803f88:	73 bb                	jae    803f45 <foreach_shared_region+0xd5>
+  803f8a:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  803f91:	48 39 d0             	cmp    %rdx,%rax
+  803f94:	48 19 c0             	sbb    %rax,%rax
+  803f97:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  803f9d:	48 05 00 02 00 00    	add    $0x200,%rax
+  803fa3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803fa7:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803fab:	e9 4b ff ff ff       	jmp    803efb <foreach_shared_region+0x8b>
+  803fb0:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fb5:	48 83 c4 28          	add    $0x28,%rsp
+  803fb9:	5b                   	pop    %rbx
+  803fba:	41 5c                	pop    %r12
+  803fbc:	41 5d                	pop    %r13
+  803fbe:	41 5e                	pop    %r14
+  803fc0:	41 5f                	pop    %r15
+  803fc2:	5d                   	pop    %rbp
+  803fc3:	c3                   	ret
+
+0000000000803fc4 <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  803fc4:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  803fca:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  803fd1:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  803fd8:	c3                   	ret
+
+0000000000803fd9 <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  803fd9:	8b 47 40             	mov    0x40(%rdi),%eax
+  803fdc:	8b 17                	mov    (%rdi),%edx
+  803fde:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  803fe0:	83 f8 0f             	cmp    $0xf,%eax
+  803fe3:	77 13                	ja     803ff8 <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  803fe5:	8b 47 40             	mov    0x40(%rdi),%eax
+  803fe8:	83 e0 0f             	and    $0xf,%eax
+  803feb:	48 c1 e0 09          	shl    $0x9,%rax
+  803fef:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  803ff6:	00 
+  803ff7:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  803ff8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ffd:	c3                   	ret
+
+0000000000803ffe <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  803ffe:	8b 47 40             	mov    0x40(%rdi),%eax
+  804001:	83 c0 01             	add    $0x1,%eax
+  804004:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  804007:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  80400d:	8b 57 04             	mov    0x4(%rdi),%edx
+  804010:	b8 00 00 00 00       	mov    $0x0,%eax
+  804015:	85 d2                	test   %edx,%edx
+  804017:	75 04                	jne    80401d <chan_publish+0x1f>
+  804019:	83 e0 01             	and    $0x1,%eax
+}
+  80401c:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  80401d:	87 47 04             	xchg   %eax,0x4(%rdi)
+  804020:	85 c0                	test   %eax,%eax
+  804022:	0f 95 c0             	setne  %al
+  804025:	0f b6 c0             	movzbl %al,%eax
+  804028:	eb ef                	jmp    804019 <chan_publish+0x1b>
+
+000000000080402a <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  80402a:	8b 47 40             	mov    0x40(%rdi),%eax
+  80402d:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  80402f:	29 d0                	sub    %edx,%eax
+  804031:	83 e8 01             	sub    $0x1,%eax
+  804034:	83 f8 0f             	cmp    $0xf,%eax
+  804037:	77 12                	ja     80404b <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  804039:	8b 07                	mov    (%rdi),%eax
+  80403b:	83 e0 0f             	and    $0xf,%eax
+  80403e:	48 c1 e0 09          	shl    $0x9,%rax
+  804042:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  804049:	00 
+  80404a:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  80404b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804050:	c3                   	ret
+
+0000000000804051 <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  804051:	8b 07                	mov    (%rdi),%eax
+  804053:	83 c0 01             	add    $0x1,%eax
+  804056:	89 07                	mov    %eax,(%rdi)
+}
+  804058:	c3                   	ret
+
+0000000000804059 <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  804059:	55                   	push   %rbp
+  80405a:	48 89 e5             	mov    %rsp,%rbp
+  80405d:	53                   	push   %rbx
+  80405e:	48 83 ec 08          	sub    $0x8,%rsp
+  804062:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  804065:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  80406c:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  804072:	48 b8 2a 40 80 00 00 	movabs $0x80402a,%rax
+  804079:	00 00 00 
+  80407c:	ff d0                	call   *%rax
+  80407e:	48 85 c0             	test   %rax,%rax
+  804081:	74 12                	je     804095 <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  804083:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  80408a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80408f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804093:	c9                   	leave
+  804094:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  804095:	b8 01 00 00 00       	mov    $0x1,%eax
+  80409a:	eb f3                	jmp    80408f <chan_arm+0x36>
+
+000000000080409c <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  80409c:	55                   	push   %rbp
+  80409d:	48 89 e5             	mov    %rsp,%rbp
+  8040a0:	41 56                	push   %r14
+  8040a2:	41 55                	push   %r13
+  8040a4:	41 54                	push   %r12
+  8040a6:	53                   	push   %rbx
+  8040a7:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  8040aa:	49 bc 59 40 80 00 00 	movabs $0x804059,%r12
+  8040b1:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  8040b4:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  8040b8:	49 bd 5a 14 80 00 00 	movabs $0x80145a,%r13
+  8040bf:	00 00 00 
+    while (chan_arm(r))
+  8040c2:	eb 0d                	jmp    8040d1 <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  8040c4:	8b 33                	mov    (%rbx),%esi
+  8040c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8040cb:	4c 89 f7             	mov    %r14,%rdi
+  8040ce:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  8040d1:	48 89 df             	mov    %rbx,%rdi
+  8040d4:	41 ff d4             	call   *%r12
+  8040d7:	84 c0                	test   %al,%al
+  8040d9:	75 e9                	jne    8040c4 <chan_wait+0x28>
+}
+  8040db:	5b                   	pop    %rbx
+  8040dc:	41 5c                	pop    %r12
+  8040de:	41 5d                	pop    %r13
+  8040e0:	41 5e                	pop    %r14
+  8040e2:	5d                   	pop    %rbp
+  8040e3:	c3                   	ret
+
+00000000008040e4 <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  8040e4:	55                   	push   %rbp
+  8040e5:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  8040e8:	48 83 c7 40          	add    $0x40,%rdi
+  8040ec:	be 01 00 00 00       	mov    $0x1,%esi
+  8040f1:	48 b8 78 14 80 00 00 	movabs $0x801478,%rax
+  8040f8:	00 00 00 
+  8040fb:	ff d0                	call   *%rax
+}
+  8040fd:	5d                   	pop    %rbp
+  8040fe:	c3                   	ret
+
+00000000008040ff <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8040ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  804104:	c3                   	ret
+
+0000000000804105 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804105:	55                   	push   %rbp
+  804106:	48 89 e5             	mov    %rsp,%rbp
+  804109:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  80410c:	48 be b4 4f 80 00 00 	movabs $0x804fb4,%rsi
+  804113:	00 00 00 
+  804116:	48 b8 8d 0b 80 00 00 	movabs $0x800b8d,%rax
+  80411d:	00 00 00 
+  804120:	ff d0                	call   *%rax
+    return 0;
+}
+  804122:	b8 00 00 00 00       	mov    $0x0,%eax
+  804127:	5d                   	pop    %rbp
+  804128:	c3                   	ret
+
+0000000000804129 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804129:	55                   	push   %rbp
+  80412a:	48 89 e5             	mov    %rsp,%rbp
+  80412d:	41 57                	push   %r15
+  80412f:	41 56                	push   %r14
+  804131:	41 55                	push   %r13
+  804133:	41 54                	push   %r12
+  804135:	53                   	push   %rbx
+  804136:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80413d:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  804144:	48 85 d2             	test   %rdx,%rdx
+  804147:	74 7a                	je     8041c3 <devcons_write+0x9a>
+  804149:	49 89 d6             	mov    %rdx,%r14
+  80414c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804152:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  804157:	49 bf 87 0d 80 00 00 	movabs $0x800d87,%r15
+  80415e:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804161:	4c 89 f3             	mov    %r14,%rbx
+  804164:	48 29 f3             	sub    %rsi,%rbx
+  804167:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80416c:	48 39 c3             	cmp    %rax,%rbx
+  80416f:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804173:	4c 63 eb             	movslq %ebx,%r13
+  804176:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80417d:	48 01 c6             	add    %rax,%rsi
+  804180:	4c 89 ea             	mov    %r13,%rdx
+  804183:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80418a:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80418d:	4c 89 ee             	mov    %r13,%rsi
+  804190:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804197:	48 b8 b4 0f 80 00 00 	movabs $0x800fb4,%rax
+  80419e:	00 00 00 
+  8041a1:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8041a3:	41 01 dc             	add    %ebx,%r12d
+  8041a6:	49 63 f4             	movslq %r12d,%rsi
+  8041a9:	4c 39 f6             	cmp    %r14,%rsi
+  8041ac:	72 b3                	jb     804161 <devcons_write+0x38>
+    return res;
+  8041ae:	49 63 c4             	movslq %r12d,%rax
+}
+  8041b1:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8041b8:	5b                   	pop    %rbx
+  8041b9:	41 5c                	pop    %r12
+  8041bb:	41 5d                	pop    %r13
+  8041bd:	41 5e                	pop    %r14
+  8041bf:	41 5f                	pop    %r15
+  8041c1:	5d                   	pop    %rbp
+  8041c2:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8041c3:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8041c9:	eb e3                	jmp    8041ae <devcons_write+0x85>
+
+00000000008041cb <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8041cb:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8041ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8041d3:	48 85 c0             	test   %rax,%rax
+  8041d6:	74 55                	je     80422d <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8041d8:	55                   	push   %rbp
+  8041d9:	48 89 e5             	mov    %rsp,%rbp
+  8041dc:	41 55                	push   %r13
+  8041de:	41 54                	push   %r12
+  8041e0:	53                   	push   %rbx
+  8041e1:	48 83 ec 08          	sub    $0x8,%rsp
+  8041e5:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8041e8:	48 bb d3 0f 80 00 00 	movabs $0x800fd3,%rbx
+  8041ef:	00 00 00 
+  8041f2:	49 bc 88 10 80 00 00 	movabs $0x801088,%r12
+  8041f9:	00 00 00 
+  8041fc:	eb 03                	jmp    804201 <devcons_read+0x36>
+  8041fe:	41 ff d4             	call   *%r12
+  804201:	ff d3                	call   *%rbx
+  804203:	85 c0                	test   %eax,%eax
+  804205:	74 f7                	je     8041fe <devcons_read+0x33>
+    if (c < 0) return c;
+  804207:	48 63 d0             	movslq %eax,%rdx
+  80420a:	78 13                	js     80421f <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  80420c:	ba 00 00 00 00       	mov    $0x0,%edx
+  804211:	83 f8 04             	cmp    $0x4,%eax
+  804214:	74 09                	je     80421f <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  804216:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  80421a:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  80421f:	48 89 d0             	mov    %rdx,%rax
+  804222:	48 83 c4 08          	add    $0x8,%rsp
+  804226:	5b                   	pop    %rbx
+  804227:	41 5c                	pop    %r12
+  804229:	41 5d                	pop    %r13
+  80422b:	5d                   	pop    %rbp
+  80422c:	c3                   	ret
+  80422d:	48 89 d0             	mov    %rdx,%rax
+  804230:	c3                   	ret
+
+0000000000804231 <cputchar>:
+cputchar(int ch) {
+  804231:	55                   	push   %rbp
+  804232:	48 89 e5             	mov    %rsp,%rbp
+  804235:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  804239:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80423d:	be 01 00 00 00       	mov    $0x1,%esi
+  804242:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  804246:	48 b8 b4 0f 80 00 00 	movabs $0x800fb4,%rax
+  80424d:	00 00 00 
+  804250:	ff d0                	call   *%rax
+}
+  804252:	c9                   	leave
+  804253:	c3                   	ret
+
+0000000000804254 <getchar>:
+getchar(void) {
+  804254:	55                   	push   %rbp
+  804255:	48 89 e5             	mov    %rsp,%rbp
+  804258:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80425c:	ba 01 00 00 00       	mov    $0x1,%edx
+  804261:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  804265:	bf 00 00 00 00       	mov    $0x0,%edi
+  80426a:	48 b8 b0 19 80 00 00 	movabs $0x8019b0,%rax
+  804271:	00 00 00 
+  804274:	ff d0                	call   *%rax
+  804276:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  804278:	85 c0                	test   %eax,%eax
+  80427a:	78 06                	js     804282 <getchar+0x2e>
+  80427c:	74 08                	je     804286 <getchar+0x32>
+  80427e:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804282:	89 d0                	mov    %edx,%eax
+  804284:	c9                   	leave
+  804285:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  804286:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80428b:	eb f5                	jmp    804282 <getchar+0x2e>
+
+000000000080428d <iscons>:
+iscons(int fdnum) {
+  80428d:	55                   	push   %rbp
+  80428e:	48 89 e5             	mov    %rsp,%rbp
+  804291:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804295:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804299:	48 b8 cd 16 80 00 00 	movabs $0x8016cd,%rax
+  8042a0:	00 00 00 
+  8042a3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8042a5:	85 c0                	test   %eax,%eax
+  8042a7:	78 18                	js     8042c1 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8042a9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8042ad:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  8042b4:	00 00 00 
+  8042b7:	8b 00                	mov    (%rax),%eax
+  8042b9:	39 02                	cmp    %eax,(%rdx)
+  8042bb:	0f 94 c0             	sete   %al
+  8042be:	0f b6 c0             	movzbl %al,%eax
+}
+  8042c1:	c9                   	leave
+  8042c2:	c3                   	ret
+
+00000000008042c3 <opencons>:
+opencons(void) {
+  8042c3:	55                   	push   %rbp
+  8042c4:	48 89 e5             	mov    %rsp,%rbp
+  8042c7:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8042cb:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8042cf:	48 b8 6d 16 80 00 00 	movabs $0x80166d,%rax
+  8042d6:	00 00 00 
+  8042d9:	ff d0                	call   *%rax
+  8042db:	85 c0                	test   %eax,%eax
+  8042dd:	78 49                	js     804328 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8042df:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8042e4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8042e9:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8042ed:	bf 00 00 00 00       	mov    $0x0,%edi
+  8042f2:	48 b8 ec 10 80 00 00 	movabs $0x8010ec,%rax
+  8042f9:	00 00 00 
+  8042fc:	ff d0                	call   *%rax
+  8042fe:	85 c0                	test   %eax,%eax
+  804300:	78 26                	js     804328 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  804302:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804306:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  80430d:	00 00 
+  80430f:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  804311:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804315:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  80431c:	48 b8 3f 16 80 00 00 	movabs $0x80163f,%rax
+  804323:	00 00 00 
+  804326:	ff d0                	call   *%rax
+}
+  804328:	c9                   	leave
+  804329:	c3                   	ret
+
+000000000080432a <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80432a:	55                   	push   %rbp
+  80432b:	48 89 e5             	mov    %rsp,%rbp
+  80432e:	41 56                	push   %r14
+  804330:	41 55                	push   %r13
+  804332:	41 54                	push   %r12
+  804334:	53                   	push   %rbx
+  804335:	48 83 ec 50          	sub    $0x50,%rsp
+  804339:	49 89 fc             	mov    %rdi,%r12
+  80433c:	41 89 f5             	mov    %esi,%r13d
+  80433f:	48 89 d3             	mov    %rdx,%rbx
+  804342:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  804346:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80434a:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80434e:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  804355:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804359:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80435d:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  804361:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  804365:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80436c:	00 00 00 
+  80436f:	4c 8b 30             	mov    (%rax),%r14
+  804372:	48 b8 5f 10 80 00 00 	movabs $0x80105f,%rax
+  804379:	00 00 00 
+  80437c:	ff d0                	call   *%rax
+  80437e:	89 c6                	mov    %eax,%esi
+  804380:	45 89 e8             	mov    %r13d,%r8d
+  804383:	4c 89 e1             	mov    %r12,%rcx
+  804386:	4c 89 f2             	mov    %r14,%rdx
+  804389:	48 bf c0 4f 80 00 00 	movabs $0x804fc0,%rdi
+  804390:	00 00 00 
+  804393:	b8 00 00 00 00       	mov    $0x0,%eax
+  804398:	49 bc 68 02 80 00 00 	movabs $0x800268,%r12
+  80439f:	00 00 00 
+  8043a2:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8043a5:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8043a9:	48 89 df             	mov    %rbx,%rdi
+  8043ac:	48 b8 04 02 80 00 00 	movabs $0x800204,%rax
+  8043b3:	00 00 00 
+  8043b6:	ff d0                	call   *%rax
+    cprintf("\n");
+  8043b8:	48 bf fc 48 80 00 00 	movabs $0x8048fc,%rdi
+  8043bf:	00 00 00 
+  8043c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043c7:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8043ca:	cc                   	int3
+  8043cb:	eb fd                	jmp    8043ca <_panic+0xa0>
+
+00000000008043cd <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  8043cd:	55                   	push   %rbp
+  8043ce:	48 89 e5             	mov    %rsp,%rbp
+  8043d1:	41 56                	push   %r14
+  8043d3:	41 55                	push   %r13
+  8043d5:	41 54                	push   %r12
+  8043d7:	53                   	push   %rbx
+  8043d8:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8043db:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  8043e2:	00 00 00 
+  8043e5:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8043e9:	74 27                	je     804412 <_handle_vectored_pagefault+0x45>
+  8043eb:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  8043f0:	49 bd 00 10 84 00 00 	movabs $0x841000,%r13
+  8043f7:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8043fa:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  8043fd:	4c 89 e7             	mov    %r12,%rdi
+  804400:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  804405:	84 c0                	test   %al,%al
+  804407:	75 45                	jne    80444e <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804409:	48 83 c3 01          	add    $0x1,%rbx
+  80440d:	49 3b 1e             	cmp    (%r14),%rbx
+  804410:	72 eb                	jb     8043fd <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  804412:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  804419:	00 
+  80441a:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  80441f:	4d 8b 04 24          	mov    (%r12),%r8
+  804423:	48 ba e8 4f 80 00 00 	movabs $0x804fe8,%rdx
+  80442a:	00 00 00 
+  80442d:	be 1d 00 00 00       	mov    $0x1d,%esi
+  804432:	48 bf 18 50 80 00 00 	movabs $0x805018,%rdi
+  804439:	00 00 00 
+  80443c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804441:	49 ba 2a 43 80 00 00 	movabs $0x80432a,%r10
+  804448:	00 00 00 
+  80444b:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  80444e:	5b                   	pop    %rbx
+  80444f:	41 5c                	pop    %r12
+  804451:	41 5d                	pop    %r13
+  804453:	41 5e                	pop    %r14
+  804455:	5d                   	pop    %rbp
+  804456:	c3                   	ret
+
+0000000000804457 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  804457:	55                   	push   %rbp
+  804458:	48 89 e5             	mov    %rsp,%rbp
+  80445b:	53                   	push   %rbx
+  80445c:	48 83 ec 08          	sub    $0x8,%rsp
+  804460:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  804463:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  80446a:	00 00 00 
+  80446d:	80 38 00             	cmpb   $0x0,(%rax)
+  804470:	0f 84 84 00 00 00    	je     8044fa <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804476:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  80447d:	00 00 00 
+  804480:	48 8b 10             	mov    (%rax),%rdx
+  804483:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  804488:	48 b9 00 10 84 00 00 	movabs $0x841000,%rcx
+  80448f:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804492:	48 85 d2             	test   %rdx,%rdx
+  804495:	74 19                	je     8044b0 <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  804497:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  80449b:	0f 84 e8 00 00 00    	je     804589 <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8044a1:	48 83 c0 01          	add    $0x1,%rax
+  8044a5:	48 39 d0             	cmp    %rdx,%rax
+  8044a8:	75 ed                	jne    804497 <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  8044aa:	48 83 fa 08          	cmp    $0x8,%rdx
+  8044ae:	74 1c                	je     8044cc <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8044b0:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8044b4:	48 a3 48 10 84 00 00 	movabs %rax,0x841048
+  8044bb:	00 00 00 
+  8044be:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  8044c5:	00 00 00 
+  8044c8:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  8044cc:	48 b8 5f 10 80 00 00 	movabs $0x80105f,%rax
+  8044d3:	00 00 00 
+  8044d6:	ff d0                	call   *%rax
+  8044d8:	89 c7                	mov    %eax,%edi
+  8044da:	48 be 4f 46 80 00 00 	movabs $0x80464f,%rsi
+  8044e1:	00 00 00 
+  8044e4:	48 b8 aa 12 80 00 00 	movabs $0x8012aa,%rax
+  8044eb:	00 00 00 
+  8044ee:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8044f0:	85 c0                	test   %eax,%eax
+  8044f2:	78 68                	js     80455c <add_pgfault_handler+0x105>
+    return res;
+}
+  8044f4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8044f8:	c9                   	leave
+  8044f9:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  8044fa:	48 b8 5f 10 80 00 00 	movabs $0x80105f,%rax
+  804501:	00 00 00 
+  804504:	ff d0                	call   *%rax
+  804506:	89 c7                	mov    %eax,%edi
+  804508:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80450d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804512:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  804519:	00 00 00 
+  80451c:	48 b8 ec 10 80 00 00 	movabs $0x8010ec,%rax
+  804523:	00 00 00 
+  804526:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  804528:	48 ba 48 10 84 00 00 	movabs $0x841048,%rdx
+  80452f:	00 00 00 
+  804532:	48 8b 02             	mov    (%rdx),%rax
+  804535:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804539:	48 89 0a             	mov    %rcx,(%rdx)
+  80453c:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  804543:	00 00 00 
+  804546:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  80454a:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  804551:	00 00 00 
+  804554:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  804557:	e9 70 ff ff ff       	jmp    8044cc <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80455c:	89 c1                	mov    %eax,%ecx
+  80455e:	48 ba 26 50 80 00 00 	movabs $0x805026,%rdx
+  804565:	00 00 00 
+  804568:	be 3d 00 00 00       	mov    $0x3d,%esi
+  80456d:	48 bf 18 50 80 00 00 	movabs $0x805018,%rdi
+  804574:	00 00 00 
+  804577:	b8 00 00 00 00       	mov    $0x0,%eax
+  80457c:	49 b8 2a 43 80 00 00 	movabs $0x80432a,%r8
+  804583:	00 00 00 
+  804586:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  804589:	b8 00 00 00 00       	mov    $0x0,%eax
+  80458e:	e9 61 ff ff ff       	jmp    8044f4 <add_pgfault_handler+0x9d>
+
+0000000000804593 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  804593:	55                   	push   %rbp
+  804594:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  804597:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  80459e:	00 00 00 
+  8045a1:	80 38 00             	cmpb   $0x0,(%rax)
+  8045a4:	74 33                	je     8045d9 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8045a6:	48 a1 48 10 84 00 00 	movabs 0x841048,%rax
+  8045ad:	00 00 00 
+  8045b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  8045b5:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  8045bc:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8045bf:	48 85 c0             	test   %rax,%rax
+  8045c2:	0f 84 85 00 00 00    	je     80464d <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  8045c8:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  8045cc:	74 40                	je     80460e <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8045ce:	48 83 c1 01          	add    $0x1,%rcx
+  8045d2:	48 39 c1             	cmp    %rax,%rcx
+  8045d5:	75 f1                	jne    8045c8 <remove_pgfault_handler+0x35>
+  8045d7:	eb 74                	jmp    80464d <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  8045d9:	48 b9 3e 50 80 00 00 	movabs $0x80503e,%rcx
+  8045e0:	00 00 00 
+  8045e3:	48 ba 67 4f 80 00 00 	movabs $0x804f67,%rdx
+  8045ea:	00 00 00 
+  8045ed:	be 43 00 00 00       	mov    $0x43,%esi
+  8045f2:	48 bf 18 50 80 00 00 	movabs $0x805018,%rdi
+  8045f9:	00 00 00 
+  8045fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  804601:	49 b8 2a 43 80 00 00 	movabs $0x80432a,%r8
+  804608:	00 00 00 
+  80460b:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  80460e:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  804615:	00 
+  804616:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80461a:	48 29 ca             	sub    %rcx,%rdx
+  80461d:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  804624:	00 00 00 
+  804627:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  80462b:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  804630:	48 89 ce             	mov    %rcx,%rsi
+  804633:	48 b8 87 0d 80 00 00 	movabs $0x800d87,%rax
+  80463a:	00 00 00 
+  80463d:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  80463f:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  804646:	00 00 00 
+  804649:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  80464d:	5d                   	pop    %rbp
+  80464e:	c3                   	ret
+
+000000000080464f <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  80464f:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  804652:	48 b8 cd 43 80 00 00 	movabs $0x8043cd,%rax
+  804659:	00 00 00 
+    call *%rax
+  80465c:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  80465e:	41 5f                	pop    %r15
+	popq %r15
+  804660:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  804662:	41 5f                	pop    %r15
+	popq %r14
+  804664:	41 5e                	pop    %r14
+	popq %r13
+  804666:	41 5d                	pop    %r13
+	popq %r12
+  804668:	41 5c                	pop    %r12
+	popq %r11
+  80466a:	41 5b                	pop    %r11
+	popq %r10
+  80466c:	41 5a                	pop    %r10
+	popq %r9
+  80466e:	41 59                	pop    %r9
+	popq %r8
+  804670:	41 58                	pop    %r8
+	popq %rsi
+  804672:	5e                   	pop    %rsi
+	popq %rdi
+  804673:	5f                   	pop    %rdi
+	popq %rbp
+  804674:	5d                   	pop    %rbp
+	popq %rdx
+  804675:	5a                   	pop    %rdx
+	popq %rcx
+  804676:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  804677:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  80467c:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  804681:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  804685:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  804688:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  80468d:	5b                   	pop    %rbx
+	popq %rax
+  80468e:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  80468f:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  804693:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  804694:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  804699:	c3                   	ret
+
+000000000080469a <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  80469a:	55                   	push   %rbp
+  80469b:	48 89 e5             	mov    %rsp,%rbp
+  80469e:	41 55                	push   %r13
+  8046a0:	41 54                	push   %r12
+  8046a2:	53                   	push   %rbx
+  8046a3:	48 83 ec 08          	sub    $0x8,%rsp
+  8046a7:	49 89 fd             	mov    %rdi,%r13
+  8046aa:	48 89 f7             	mov    %rsi,%rdi
+  8046ad:	48 89 d3             	mov    %rdx,%rbx
+  8046b0:	49 89 cc             	mov    %rcx,%r12
+  8046b3:	4c 89 c2             	mov    %r8,%rdx
+  8046b6:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8046b9:	48 85 f6             	test   %rsi,%rsi
+  8046bc:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8046c3:	00 00 00 
+  8046c6:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  8046ca:	be 00 10 00 00       	mov    $0x1000,%esi
+  8046cf:	48 85 db             	test   %rbx,%rbx
+  8046d2:	74 03                	je     8046d7 <ipc_recv_futex+0x3d>
+  8046d4:	48 8b 33             	mov    (%rbx),%rsi
+  8046d7:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  8046db:	48 b8 36 13 80 00 00 	movabs $0x801336,%rax
+  8046e2:	00 00 00 
+  8046e5:	ff d0                	call   *%rax
+    if (res < 0) {
+  8046e7:	85 c0                	test   %eax,%eax
+  8046e9:	78 75                	js     804760 <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  8046eb:	4d 85 ed             	test   %r13,%r13
+  8046ee:	74 14                	je     804704 <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  8046f0:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8046f7:	00 00 00 
+  8046fa:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  804700:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  804704:	4d 85 e4             	test   %r12,%r12
+  804707:	74 14                	je     80471d <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  804709:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804710:	00 00 00 
+  804713:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  804719:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  80471d:	48 85 db             	test   %rbx,%rbx
+  804720:	74 23                	je     804745 <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804722:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804729:	00 00 00 
+  80472c:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  804732:	ba 00 00 00 00       	mov    $0x0,%edx
+  804737:	85 c9                	test   %ecx,%ecx
+  804739:	74 07                	je     804742 <ipc_recv_futex+0xa8>
+  80473b:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  804742:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  804745:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80474c:	00 00 00 
+  80474f:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  804755:	48 83 c4 08          	add    $0x8,%rsp
+  804759:	5b                   	pop    %rbx
+  80475a:	41 5c                	pop    %r12
+  80475c:	41 5d                	pop    %r13
+  80475e:	5d                   	pop    %rbp
+  80475f:	c3                   	ret
+        if (from_env_store != NULL) {
+  804760:	4d 85 ed             	test   %r13,%r13
+  804763:	74 08                	je     80476d <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  804765:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80476c:	00 
+        if (perm_store != NULL) {
+  80476d:	4d 85 e4             	test   %r12,%r12
+  804770:	74 08                	je     80477a <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  804772:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804779:	00 
+        if (size != NULL) {
+  80477a:	48 85 db             	test   %rbx,%rbx
+  80477d:	74 d6                	je     804755 <ipc_recv_futex+0xbb>
+            *size = 0;
+  80477f:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  804786:	eb cd                	jmp    804755 <ipc_recv_futex+0xbb>
+
+0000000000804788 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804788:	55                   	push   %rbp
+  804789:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  80478c:	48 83 ec 08          	sub    $0x8,%rsp
+  804790:	6a 00                	push   $0x0
+  804792:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804798:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80479e:	48 b8 9a 46 80 00 00 	movabs $0x80469a,%rax
+  8047a5:	00 00 00 
+  8047a8:	ff d0                	call   *%rax
+}
+  8047aa:	c9                   	leave
+  8047ab:	c3                   	ret
+
+00000000008047ac <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8047ac:	55                   	push   %rbp
+  8047ad:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8047b0:	48 85 d2             	test   %rdx,%rdx
+  8047b3:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8047ba:	00 00 00 
+  8047bd:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  8047c1:	89 f6                	mov    %esi,%esi
+  8047c3:	48 b8 1f 13 80 00 00 	movabs $0x80131f,%rax
+  8047ca:	00 00 00 
+  8047cd:	ff d0                	call   *%rax
+    if (res < 0) {
+  8047cf:	85 c0                	test   %eax,%eax
+  8047d1:	78 02                	js     8047d5 <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  8047d3:	5d                   	pop    %rbp
+  8047d4:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  8047d5:	89 c1                	mov    %eax,%ecx
+  8047d7:	48 ba 58 50 80 00 00 	movabs $0x805058,%rdx
+  8047de:	00 00 00 
+  8047e1:	be 50 00 00 00       	mov    $0x50,%esi
+  8047e6:	48 bf 6c 50 80 00 00 	movabs $0x80506c,%rdi
+  8047ed:	00 00 00 
+  8047f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047f5:	49 b8 2a 43 80 00 00 	movabs $0x80432a,%r8
+  8047fc:	00 00 00 
+  8047ff:	41 ff d0             	call   *%r8
+
+0000000000804802 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804802:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  804807:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80480e:	00 00 00 
+  804811:	48 89 d0             	mov    %rdx,%rax
+  804814:	48 c1 e0 04          	shl    $0x4,%rax
+  804818:	48 29 d0             	sub    %rdx,%rax
+  80481b:	48 c1 e0 05          	shl    $0x5,%rax
+  80481f:	48 01 c8             	add    %rcx,%rax
+  804822:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  804828:	39 f8                	cmp    %edi,%eax
+  80482a:	74 13                	je     80483f <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  80482c:	48 83 c2 01          	add    $0x1,%rdx
+  804830:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  804837:	75 d8                	jne    804811 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804839:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80483e:	c3                   	ret
+            return envs[i].env_id;
+  80483f:	48 89 d0             	mov    %rdx,%rax
+  804842:	48 c1 e0 04          	shl    $0x4,%rax
+  804846:	48 29 d0             	sub    %rdx,%rax
+  804849:	48 c1 e0 05          	shl    $0x5,%rax
+  80484d:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804854:	00 00 00 
+  804857:	48 01 d0             	add    %rdx,%rax
+  80485a:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804860:	c3                   	ret
+  804861:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000804868 <__rodata_start>:
+  804868:	49 20 61 6d          	rex.WB and %spl,0x6d(%r9)
+  80486c:	20 74 68 65          	and    %dh,0x65(%rax,%rbp,2)
+  804870:	20 70 61             	and    %dh,0x61(%rax)
+  804873:	72 65                	jb     8048da <__rodata_start+0x72>
+  804875:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804876:	74 2e                	je     8048a6 <__rodata_start+0x3e>
+  804878:	20 20                	and    %ah,(%rax)
+  80487a:	46 6f                	rex.RX outsl %ds:(%rsi),(%dx)
+  80487c:	72 6b                	jb     8048e9 <__rodata_start+0x81>
+  80487e:	69 6e 67 20 74 68 65 	imul   $0x65687420,0x67(%rsi),%ebp
+  804885:	20 63 68             	and    %ah,0x68(%rbx)
+  804888:	69 6c 64 2e 2e 2e 0a 	imul   $0xa2e2e,0x2e(%rsp,%riz,2),%ebp
+  80488f:	00 
+  804890:	49 20 61 6d          	rex.WB and %spl,0x6d(%r9)
+  804894:	20 74 68 65          	and    %dh,0x65(%rax,%rbp,2)
+  804898:	20 70 61             	and    %dh,0x61(%rax)
+  80489b:	72 65                	jb     804902 <__rodata_start+0x9a>
+  80489d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80489e:	74 2e                	je     8048ce <__rodata_start+0x66>
+  8048a0:	20 20                	and    %ah,(%rax)
+  8048a2:	52                   	push   %rdx
+  8048a3:	75 6e                	jne    804913 <__rodata_start+0xab>
+  8048a5:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8048a6:	69 6e 67 20 74 68 65 	imul   $0x65687420,0x67(%rsi),%ebp
+  8048ad:	20 63 68             	and    %ah,0x68(%rbx)
+  8048b0:	69 6c 64 2e 2e 2e 0a 	imul   $0xa2e2e,0x2e(%rsp,%riz,2),%ebp
+  8048b7:	00 
+  8048b8:	49 20 61 6d          	rex.WB and %spl,0x6d(%r9)
+  8048bc:	20 74 68 65          	and    %dh,0x65(%rax,%rbp,2)
+  8048c0:	20 70 61             	and    %dh,0x61(%rax)
+  8048c3:	72 65                	jb     80492a <__rodata_start+0xc2>
+  8048c5:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8048c6:	74 2e                	je     8048f6 <__rodata_start+0x8e>
+  8048c8:	20 20                	and    %ah,(%rax)
+  8048ca:	4b 69 6c 6c 69 6e 67 	imul   $0x7420676e,0x69(%r12,%r13,2),%rbp
+  8048d1:	20 74 
+  8048d3:	68 65 20 63 68       	push   $0x68632065
+  8048d8:	69 6c 64 2e 2e 2e 0a 	imul   $0xa2e2e,0x2e(%rsp,%riz,2),%ebp
+  8048df:	00 
+  8048e0:	49 20 61 6d          	rex.WB and %spl,0x6d(%r9)
+  8048e4:	20 74 68 65          	and    %dh,0x65(%rax,%rbp,2)
+  8048e8:	20 63 68             	and    %ah,0x68(%rbx)
+  8048eb:	69 6c 64 2e 20 20 53 	imul   $0x70532020,0x2e(%rsp,%riz,2),%ebp
+  8048f2:	70 
+  8048f3:	69 6e 6e 69 6e 67 2e 	imul   $0x2e676e69,0x6e(%rsi),%ebp
+  8048fa:	2e 2e 0a 00          	cs cs or (%rax),%al
+  8048fe:	3c 75                	cmp    $0x75,%al
+  804900:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804901:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  804905:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804906:	3e 00 30             	ds add %dh,(%rax)
+  804909:	31 32                	xor    %esi,(%rdx)
+  80490b:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  804912:	41                   	rex.B
+  804913:	42                   	rex.X
+  804914:	43                   	rex.XB
+  804915:	44                   	rex.R
+  804916:	45                   	rex.RB
+  804917:	46 00 30             	rex.RX add %r14b,(%rax)
+  80491a:	31 32                	xor    %esi,(%rdx)
+  80491c:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  804923:	61                   	(bad)
+  804924:	62 63 64 65 66       	(bad)
+  804929:	00 28                	add    %ch,(%rax)
+  80492b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80492c:	75 6c                	jne    80499a <__rodata_start+0x132>
+  80492e:	6c                   	insb   (%dx),%es:(%rdi)
+  80492f:	29 00                	sub    %eax,(%rax)
+  804931:	65 72 72             	gs jb  8049a6 <__rodata_start+0x13e>
+  804934:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804935:	72 20                	jb     804957 <__rodata_start+0xef>
+  804937:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  80493c:	73 70                	jae    8049ae <__rodata_start+0x146>
+  80493e:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  804942:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  804949:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80494a:	72 00                	jb     80494c <__rodata_start+0xe4>
+  80494c:	62 61 64 20 65       	(bad)
+  804951:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804952:	76 69                	jbe    8049bd <__rodata_start+0x155>
+  804954:	72 6f                	jb     8049c5 <__rodata_start+0x15d>
+  804956:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804957:	6d                   	insl   (%dx),%es:(%rdi)
+  804958:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80495a:	74 00                	je     80495c <__rodata_start+0xf4>
+  80495c:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  804963:	20 70 61             	and    %dh,0x61(%rax)
+  804966:	72 61                	jb     8049c9 <__rodata_start+0x161>
+  804968:	6d                   	insl   (%dx),%es:(%rdi)
+  804969:	65 74 65             	gs je  8049d1 <__rodata_start+0x169>
+  80496c:	72 00                	jb     80496e <__rodata_start+0x106>
+  80496e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80496f:	75 74                	jne    8049e5 <__rodata_start+0x17d>
+  804971:	20 6f 66             	and    %ch,0x66(%rdi)
+  804974:	20 6d 65             	and    %ch,0x65(%rbp)
+  804977:	6d                   	insl   (%dx),%es:(%rdi)
+  804978:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804979:	72 79                	jb     8049f4 <__rodata_start+0x18c>
+  80497b:	00 6f 75             	add    %ch,0x75(%rdi)
+  80497e:	74 20                	je     8049a0 <__rodata_start+0x138>
+  804980:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804981:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  804985:	76 69                	jbe    8049f0 <__rodata_start+0x188>
+  804987:	72 6f                	jb     8049f8 <__rodata_start+0x190>
+  804989:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80498a:	6d                   	insl   (%dx),%es:(%rdi)
+  80498b:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80498d:	74 73                	je     804a02 <__rodata_start+0x19a>
+  80498f:	00 63 6f             	add    %ah,0x6f(%rbx)
+  804992:	72 72                	jb     804a06 <__rodata_start+0x19e>
+  804994:	75 70                	jne    804a06 <__rodata_start+0x19e>
+  804996:	74 65                	je     8049fd <__rodata_start+0x195>
+  804998:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  80499d:	75 67                	jne    804a06 <__rodata_start+0x19e>
+  80499f:	20 69 6e             	and    %ch,0x6e(%rcx)
+  8049a2:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8049a4:	00 73 65             	add    %dh,0x65(%rbx)
+  8049a7:	67 6d                	insl   (%dx),%es:(%edi)
+  8049a9:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8049ab:	74 61                	je     804a0e <__rodata_start+0x1a6>
+  8049ad:	74 69                	je     804a18 <__rodata_start+0x1b0>
+  8049af:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8049b0:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8049b1:	20 66 61             	and    %ah,0x61(%rsi)
+  8049b4:	75 6c                	jne    804a22 <__rodata_start+0x1ba>
+  8049b6:	74 00                	je     8049b8 <__rodata_start+0x150>
+  8049b8:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8049bf:	20 45 4c             	and    %al,0x4c(%rbp)
+  8049c2:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  8049c6:	61                   	(bad)
+  8049c7:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  8049cc:	20 73 75             	and    %dh,0x75(%rbx)
+  8049cf:	63 68 20             	movsxd 0x20(%rax),%ebp
+  8049d2:	73 79                	jae    804a4d <__rodata_start+0x1e5>
+  8049d4:	73 74                	jae    804a4a <__rodata_start+0x1e2>
+  8049d6:	65 6d                	gs insl (%dx),%es:(%rdi)
+  8049d8:	20 63 61             	and    %ah,0x61(%rbx)
+  8049db:	6c                   	insb   (%dx),%es:(%rdi)
+  8049dc:	6c                   	insb   (%dx),%es:(%rdi)
+  8049dd:	00 65 6e             	add    %ah,0x6e(%rbp)
+  8049e0:	74 72                	je     804a54 <__rodata_start+0x1ec>
+  8049e2:	79 20                	jns    804a04 <__rodata_start+0x19c>
+  8049e4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8049e5:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8049e6:	74 20                	je     804a08 <__rodata_start+0x1a0>
+  8049e8:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8049ea:	75 6e                	jne    804a5a <__rodata_start+0x1f2>
+  8049ec:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  8049f0:	76 20                	jbe    804a12 <__rodata_start+0x1aa>
+  8049f2:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  8049f9:	72 65                	jb     804a60 <__rodata_start+0x1f8>
+  8049fb:	63 76 69             	movsxd 0x69(%rsi),%esi
+  8049fe:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8049ff:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  804a03:	65 78 70             	gs js  804a76 <__rodata_start+0x20e>
+  804a06:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  804a0b:	20 65 6e             	and    %ah,0x6e(%rbp)
+  804a0e:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  804a12:	20 66 69             	and    %ah,0x69(%rsi)
+  804a15:	6c                   	insb   (%dx),%es:(%rdi)
+  804a16:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  804a1a:	20 66 72             	and    %ah,0x72(%rsi)
+  804a1d:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  804a22:	61                   	(bad)
+  804a23:	63 65 20             	movsxd 0x20(%rbp),%esp
+  804a26:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a27:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a28:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  804a2c:	6b 00 74             	imul   $0x74,(%rax),%eax
+  804a2f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a30:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a31:	20 6d 61             	and    %ch,0x61(%rbp)
+  804a34:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a35:	79 20                	jns    804a57 <__rodata_start+0x1ef>
+  804a37:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  804a3e:	72 65                	jb     804aa5 <__rodata_start+0x23d>
+  804a40:	20 6f 70             	and    %ch,0x70(%rdi)
+  804a43:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804a45:	00 66 69             	add    %ah,0x69(%rsi)
+  804a48:	6c                   	insb   (%dx),%es:(%rdi)
+  804a49:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  804a4d:	20 62 6c             	and    %ah,0x6c(%rdx)
+  804a50:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a51:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  804a54:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a55:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a56:	74 20                	je     804a78 <__rodata_start+0x210>
+  804a58:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804a5a:	75 6e                	jne    804aca <__rodata_start+0x262>
+  804a5c:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  804a60:	76 61                	jbe    804ac3 <__rodata_start+0x25b>
+  804a62:	6c                   	insb   (%dx),%es:(%rdi)
+  804a63:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  804a6a:	00 
+  804a6b:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  804a72:	72 65                	jb     804ad9 <__rodata_start+0x271>
+  804a74:	61                   	(bad)
+  804a75:	64 79 20             	fs jns 804a98 <__rodata_start+0x230>
+  804a78:	65 78 69             	gs js  804ae4 <__rodata_start+0x27c>
+  804a7b:	73 74                	jae    804af1 <__rodata_start+0x289>
+  804a7d:	73 00                	jae    804a7f <__rodata_start+0x217>
+  804a7f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a80:	70 65                	jo     804ae7 <__rodata_start+0x27f>
+  804a82:	72 61                	jb     804ae5 <__rodata_start+0x27d>
+  804a84:	74 69                	je     804aef <__rodata_start+0x287>
+  804a86:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a87:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a88:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  804a8b:	74 20                	je     804aad <__rodata_start+0x245>
+  804a8d:	73 75                	jae    804b04 <__rodata_start+0x29c>
+  804a8f:	70 70                	jo     804b01 <__rodata_start+0x299>
+  804a91:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a92:	72 74                	jb     804b08 <__rodata_start+0x2a0>
+  804a94:	65 64 00 74 72 79    	gs add %dh,%fs:0x79(%rdx,%rsi,2)
+  804a9a:	20 61 67             	and    %ah,0x67(%rcx)
+  804a9d:	61                   	(bad)
+  804a9e:	69 6e 00 74 69 6d 65 	imul   $0x656d6974,0x0(%rsi),%ebp
+  804aa5:	64 20 6f 75          	and    %ch,%fs:0x75(%rdi)
+  804aa9:	74 00                	je     804aab <__rodata_start+0x243>
+  804aab:	66 69 6c 65 20 69 73 	imul   $0x7369,0x20(%rbp,%riz,2),%bp
+  804ab2:	20 69 6e             	and    %ch,0x6e(%rcx)
+  804ab5:	20 75 73             	and    %dh,0x73(%rbp)
+  804ab8:	65 00 66 0f          	add    %ah,%gs:0xf(%rsi)
+  804abc:	1f                   	(bad)
+  804abd:	44 00 00             	add    %r8b,(%rax)
+  804ac0:	55                   	push   %rbp
+  804ac1:	04 80                	add    $0x80,%al
+  804ac3:	00 00                	add    %al,(%rax)
+  804ac5:	00 00                	add    %al,(%rax)
+  804ac7:	00 96 0a 80 00 00    	add    %dl,0x800a(%rsi)
+  804acd:	00 00                	add    %al,(%rax)
+  804acf:	00 86 0a 80 00 00    	add    %al,0x800a(%rsi)
+  804ad5:	00 00                	add    %al,(%rax)
+  804ad7:	00 96 0a 80 00 00    	add    %dl,0x800a(%rsi)
+  804add:	00 00                	add    %al,(%rax)
+  804adf:	00 96 0a 80 00 00    	add    %dl,0x800a(%rsi)
+  804ae5:	00 00                	add    %al,(%rax)
+  804ae7:	00 96 0a 80 00 00    	add    %dl,0x800a(%rsi)
+  804aed:	00 00                	add    %al,(%rax)
+  804aef:	00 96 0a 80 00 00    	add    %dl,0x800a(%rsi)
+  804af5:	00 00                	add    %al,(%rax)
+  804af7:	00 74 04 80          	add    %dh,-0x80(%rsp,%rax,1)
+  804afb:	00 00                	add    %al,(%rax)
+  804afd:	00 00                	add    %al,(%rax)
+  804aff:	00 96 0a 80 00 00    	add    %dl,0x800a(%rsi)
+  804b05:	00 00                	add    %al,(%rax)
+  804b07:	00 96 0a 80 00 00    	add    %dl,0x800a(%rsi)
+  804b0d:	00 00                	add    %al,(%rax)
+  804b0f:	00 68 04             	add    %ch,0x4(%rax)
+  804b12:	80 00 00             	addb   $0x0,(%rax)
+  804b15:	00 00                	add    %al,(%rax)
+  804b17:	00 e2                	add    %ah,%dl
+  804b19:	04 80                	add    $0x80,%al
+  804b1b:	00 00                	add    %al,(%rax)
+  804b1d:	00 00                	add    %al,(%rax)
+  804b1f:	00 96 0a 80 00 00    	add    %dl,0x800a(%rsi)
+  804b25:	00 00                	add    %al,(%rax)
+  804b27:	00 68 04             	add    %ch,0x4(%rax)
+  804b2a:	80 00 00             	addb   $0x0,(%rax)
+  804b2d:	00 00                	add    %al,(%rax)
+  804b2f:	00 ae 04 80 00 00    	add    %ch,0x8004(%rsi)
+  804b35:	00 00                	add    %al,(%rax)
+  804b37:	00 ae 04 80 00 00    	add    %ch,0x8004(%rsi)
+  804b3d:	00 00                	add    %al,(%rax)
+  804b3f:	00 ae 04 80 00 00    	add    %ch,0x8004(%rsi)
+  804b45:	00 00                	add    %al,(%rax)
+  804b47:	00 ae 04 80 00 00    	add    %ch,0x8004(%rsi)
+  804b4d:	00 00                	add    %al,(%rax)
+  804b4f:	00 ae 04 80 00 00    	add    %ch,0x8004(%rsi)
+  804b55:	00 00                	add    %al,(%rax)
+  804b57:	00 ae 04 80 00 00    	add    %ch,0x8004(%rsi)
+  804b5d:	00 00                	add    %al,(%rax)
+  804b5f:	00 ae 04 80 00 00    	add    %ch,0x8004(%rsi)
+  804b65:	00 00                	add    %al,(%rax)
+  804b67:	00 ae 04 80 00 00    	add    %ch,0x8004(%rsi)
+  804b6d:	00 00                	add    %al,(%rax)
+  804b6f:	00 ae 04 80 00 00    	add    %ch,0x8004(%rsi)
+  804b75:	00 00                	add    %al,(%rax)
+  804b77:	00 96 0a 80 00 00    	add    %dl,0x800a(%rsi)
+  804b7d:	00 00                	add    %al,(%rax)
+  804b7f:	00 96 0a 80 00 00    	add    %dl,0x800a(%rsi)
+  804b85:	00 00                	add    %al,(%rax)
+  804b87:	00 96 0a 80 00 00    	add    %dl,0x800a(%rsi)
+  804b8d:	00 00                	add    %al,(%rax)
+  804b8f:	00 96 0a 80 00 00    	add    %dl,0x800a(%rsi)
+  804b95:	00 00                	add    %al,(%rax)
+  804b97:	00 96 0a 80 00 00    	add    %dl,0x800a(%rsi)
+  804b9d:	00 00                	add    %al,(%rax)
+  804b9f:	00 96 0a 80 00 00    	add    %dl,0x800a(%rsi)
+  804ba5:	00 00                	add    %al,(%rax)
+  804ba7:	00 96 0a 80 00 00    	add    %dl,0x800a(%rsi)
+  804bad:	00 00                	add    %al,(%rax)
+  804baf:	00 96 0a 80 00 00    	add    %dl,0x800a(%rsi)
+  804bb5:	00 00                	add    %al,(%rax)
+  804bb7:	00 96 0a 80 00 00    	add    %dl,0x800a(%rsi)
+  804bbd:	00 00                	add    %al,(%rax)
+  804bbf:	00 96 0a 80 00 00    	add    %dl,0x800a(%rsi)
+  804bc5:	00 00                	add    %al,(%rax)
+  804bc7:	00 96 0a 80 00 00    	add    %dl,0x800a(%rsi)
+  804bcd:	00 00                	add    %al,(%rax)
+  804bcf:	00 96 0a 80 00 00    	add    %dl,0x800a(%rsi)
+  804bd5:	00 00                	add    %al,(%rax)
+  804bd7:	00 96 0a 80 00 00    	add    %dl,0x800a(%rsi)
+  804bdd:	00 00                	add    %al,(%rax)
+  804bdf:	00 96 0a 80 00 00    	add    %dl,0x800a(%rsi)
+  804be5:	00 00                	add    %al,(%rax)
+  804be7:	00 96 0a 80 00 00    	add    %dl,0x800a(%rsi)
+  804bed:	00 00                	add    %al,(%rax)
+  804bef:	00 96 0a 80 00 00    	add    %dl,0x800a(%rsi)
+  804bf5:	00 00                	add    %al,(%rax)
+  804bf7:	00 96 0a 80 00 00    	add    %dl,0x800a(%rsi)
+  804bfd:	00 00                	add    %al,(%rax)
+  804bff:	00 96 0a 80 00 00    	add    %dl,0x800a(%rsi)
+  804c05:	00 00                	add    %al,(%rax)
+  804c07:	00 96 0a 80 00 00    	add    %dl,0x800a(%rsi)
+  804c0d:	00 00                	add    %al,(%rax)
+  804c0f:	00 96 0a 80 00 00    	add    %dl,0x800a(%rsi)
+  804c15:	00 00                	add    %al,(%rax)
+  804c17:	00 96 0a 80 00 00    	add    %dl,0x800a(%rsi)
+  804c1d:	00 00                	add    %al,(%rax)
+  804c1f:	00 96 0a 80 00 00    	add    %dl,0x800a(%rsi)
+  804c25:	00 00                	add    %al,(%rax)
+  804c27:	00 96 0a 80 00 00    	add    %dl,0x800a(%rsi)
+  804c2d:	00 00                	add    %al,(%rax)
+  804c2f:	00 96 0a 80 00 00    	add    %dl,0x800a(%rsi)
+  804c35:	00 00                	add    %al,(%rax)
+  804c37:	00 96 0a 80 00 00    	add    %dl,0x800a(%rsi)
+  804c3d:	00 00                	add    %al,(%rax)
+  804c3f:	00 96 0a 80 00 00    	add    %dl,0x800a(%rsi)
+  804c45:	00 00                	add    %al,(%rax)
+  804c47:	00 96 0a 80 00 00    	add    %dl,0x800a(%rsi)
+  804c4d:	00 00                	add    %al,(%rax)
+  804c4f:	00 96 0a 80 00 00    	add    %dl,0x800a(%rsi)
+  804c55:	00 00                	add    %al,(%rax)
+  804c57:	00 96 0a 80 00 00    	add    %dl,0x800a(%rsi)
+  804c5d:	00 00                	add    %al,(%rax)
+  804c5f:	00 96 0a 80 00 00    	add    %dl,0x800a(%rsi)
+  804c65:	00 00                	add    %al,(%rax)
+  804c67:	00 b9 09 80 00 00    	add    %bh,0x8009(%rcx)
+  804c6d:	00 00                	add    %al,(%rax)
+  804c6f:	00 96 0a 80 00 00    	add    %dl,0x800a(%rsi)
+  804c75:	00 00                	add    %al,(%rax)
+  804c77:	00 96 0a 80 00 00    	add    %dl,0x800a(%rsi)
+  804c7d:	00 00                	add    %al,(%rax)
+  804c7f:	00 96 0a 80 00 00    	add    %dl,0x800a(%rsi)
+  804c85:	00 00                	add    %al,(%rax)
+  804c87:	00 96 0a 80 00 00    	add    %dl,0x800a(%rsi)
+  804c8d:	00 00                	add    %al,(%rax)
+  804c8f:	00 96 0a 80 00 00    	add    %dl,0x800a(%rsi)
+  804c95:	00 00                	add    %al,(%rax)
+  804c97:	00 96 0a 80 00 00    	add    %dl,0x800a(%rsi)
+  804c9d:	00 00                	add    %al,(%rax)
+  804c9f:	00 96 0a 80 00 00    	add    %dl,0x800a(%rsi)
+  804ca5:	00 00                	add    %al,(%rax)
+  804ca7:	00 96 0a 80 00 00    	add    %dl,0x800a(%rsi)
+  804cad:	00 00                	add    %al,(%rax)
+  804caf:	00 96 0a 80 00 00    	add    %dl,0x800a(%rsi)
+  804cb5:	00 00                	add    %al,(%rax)
+  804cb7:	00 96 0a 80 00 00    	add    %dl,0x800a(%rsi)
+  804cbd:	00 00                	add    %al,(%rax)
+  804cbf:	00 05 05 80 00 00    	add    %al,0x8005(%rip)        # 80ccca <__ctors_end+0x6bea>
+  804cc5:	00 00                	add    %al,(%rax)
+  804cc7:	00 d4                	add    %dl,%ah
+  804cc9:	06                   	(bad)
+  804cca:	80 00 00             	addb   $0x0,(%rax)
+  804ccd:	00 00                	add    %al,(%rax)
+  804ccf:	00 96 0a 80 00 00    	add    %dl,0x800a(%rsi)
+  804cd5:	00 00                	add    %al,(%rax)
+  804cd7:	00 96 0a 80 00 00    	add    %dl,0x800a(%rsi)
+  804cdd:	00 00                	add    %al,(%rax)
+  804cdf:	00 96 0a 80 00 00    	add    %dl,0x800a(%rsi)
+  804ce5:	00 00                	add    %al,(%rax)
+  804ce7:	00 96 0a 80 00 00    	add    %dl,0x800a(%rsi)
+  804ced:	00 00                	add    %al,(%rax)
+  804cef:	00 34 05 80 00 00 00 	add    %dh,0x80(,%rax,1)
+  804cf6:	00 00                	add    %al,(%rax)
+  804cf8:	96                   	xchg   %eax,%esi
+  804cf9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804cff:	00 96 0a 80 00 00    	add    %dl,0x800a(%rsi)
+  804d05:	00 00                	add    %al,(%rax)
+  804d07:	00 fa                	add    %bh,%dl
+  804d09:	04 80                	add    $0x80,%al
+  804d0b:	00 00                	add    %al,(%rax)
+  804d0d:	00 00                	add    %al,(%rax)
+  804d0f:	00 96 0a 80 00 00    	add    %dl,0x800a(%rsi)
+  804d15:	00 00                	add    %al,(%rax)
+  804d17:	00 96 0a 80 00 00    	add    %dl,0x800a(%rsi)
+  804d1d:	00 00                	add    %al,(%rax)
+  804d1f:	00 7c 08 80          	add    %bh,-0x80(%rax,%rcx,1)
+  804d23:	00 00                	add    %al,(%rax)
+  804d25:	00 00                	add    %al,(%rax)
+  804d27:	00 46 09             	add    %al,0x9(%rsi)
+  804d2a:	80 00 00             	addb   $0x0,(%rax)
+  804d2d:	00 00                	add    %al,(%rax)
+  804d2f:	00 96 0a 80 00 00    	add    %dl,0x800a(%rsi)
+  804d35:	00 00                	add    %al,(%rax)
+  804d37:	00 96 0a 80 00 00    	add    %dl,0x800a(%rsi)
+  804d3d:	00 00                	add    %al,(%rax)
+  804d3f:	00 cb                	add    %cl,%bl
+  804d41:	05 80 00 00 00       	add    $0x80,%eax
+  804d46:	00 00                	add    %al,(%rax)
+  804d48:	96                   	xchg   %eax,%esi
+  804d49:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804d4f:	00 a8 07 80 00 00    	add    %ch,0x8007(%rax)
+  804d55:	00 00                	add    %al,(%rax)
+  804d57:	00 96 0a 80 00 00    	add    %dl,0x800a(%rsi)
+  804d5d:	00 00                	add    %al,(%rax)
+  804d5f:	00 96 0a 80 00 00    	add    %dl,0x800a(%rsi)
+  804d65:	00 00                	add    %al,(%rax)
+  804d67:	00 b9 09 80 00 00    	add    %bh,0x8009(%rcx)
+  804d6d:	00 00                	add    %al,(%rax)
+  804d6f:	00 96 0a 80 00 00    	add    %dl,0x800a(%rsi)
+  804d75:	00 00                	add    %al,(%rax)
+  804d77:	00 5e 04             	add    %bl,0x4(%rsi)
+  804d7a:	80 00 00             	addb   $0x0,(%rax)
+  804d7d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000804d80 <error_string>:
+	...
+  804d88:	3a 49 80 00 00 00 00 00 4c 49 80 00 00 00 00 00     :I......LI......
+  804d98:	5c 49 80 00 00 00 00 00 6e 49 80 00 00 00 00 00     \I......nI......
+  804da8:	7c 49 80 00 00 00 00 00 90 49 80 00 00 00 00 00     |I.......I......
+  804db8:	a5 49 80 00 00 00 00 00 b8 49 80 00 00 00 00 00     .I.......I......
+  804dc8:	ca 49 80 00 00 00 00 00 de 49 80 00 00 00 00 00     .I.......I......
+  804dd8:	ee 49 80 00 00 00 00 00 01 4a 80 00 00 00 00 00     .I.......J......
+  804de8:	18 4a 80 00 00 00 00 00 2e 4a 80 00 00 00 00 00     .J.......J......
+  804df8:	46 4a 80 00 00 00 00 00 5e 4a 80 00 00 00 00 00     FJ......^J......
+  804e08:	6b 4a 80 00 00 00 00 00 38 4e 80 00 00 00 00 00     kJ......8N......
+  804e18:	7f 4a 80 00 00 00 00 00 97 4a 80 00 00 00 00 00     .J.......J......
+  804e28:	a1 4a 80 00 00 00 00 00 ab 4a 80 00 00 00 00 00     .J.......J......
+  804e38:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  804e48:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  804e58:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  804e68:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  804e78:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 73 66 6f     ib/syscall.c.sfo
+  804e88:	72 6b 28 29 20 69 73 20 6e 6f 74 20 69 6d 70 6c     rk() is not impl
+  804e98:	65 6d 65 6e 74 65 64 00 6c 69 62 2f 66 6f 72 6b     emented.lib/fork
+  804ea8:	2e 63 00 0f 1f 44 00 00 5b 25 30 38 78 5d 20 75     .c...D..[%08x] u
+  804eb8:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  804ec8:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  804ed8:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  804ee8:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  804ef8:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  804f08:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  804f18:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  804f28:	0a 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f38:	84 00 00 00 00 00 66 90                             ......f.
+
+0000000000804f40 <devtab>:
+  804f40:	20 60 80 00 00 00 00 00 60 60 80 00 00 00 00 00      `......``......
+  804f50:	a0 60 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .`..............
+  804f60:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  804f70:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  804f80:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  804f90:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  804fa0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  804fb0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  804fc0:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  804fd0:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  804fe0:	3a 20 00 0f 1f 44 00 00 55 73 65 72 73 70 61 63     : ...D..Userspac
+  804ff0:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  805000:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  805010:	65 72 72 3d 25 78 0a 00 6c 69 62 2f 70 67 66 61     err=%x..lib/pgfa
+  805020:	75 6c 74 2e 63 00 73 65 74 5f 70 67 66 61 75 6c     ult.c.set_pgfaul
+  805030:	74 5f 68 61 6e 64 6c 65 72 3a 20 25 69 00 5f 70     t_handler: %i._p
+  805040:	66 68 61 6e 64 6c 65 72 5f 69 6e 69 74 69 74 69     fhandler_inititi
+  805050:	61 6c 6c 69 7a 65 64 00 69 70 63 5f 73 65 6e 64     allized.ipc_send
+  805060:	20 65 72 72 6f 72 3a 20 25 69 0a 00 6c 69 62 2f      error: %i..lib/
+  805070:	69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00 00     ipc.c.f.........
+  805080:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805090:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8050a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8050b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8050c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8050d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8050e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8050f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805100:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805110:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805120:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805130:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805140:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805150:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805160:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805170:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805180:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805190:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8051a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8051b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8051c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8051d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8051e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8051f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805200:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805210:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805220:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805230:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805240:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805250:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805260:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805270:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805280:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805290:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8052a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8052b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8052c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8052d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8052e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8052f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805300:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805310:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805320:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805330:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805340:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805350:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805360:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805370:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805380:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805390:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8053a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8053b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8053c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8053d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8053e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8053f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805400:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805410:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805420:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805430:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805440:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805450:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805460:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805470:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805480:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805490:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8054a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8054b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8054c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8054d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8054e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8054f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805500:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805510:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805520:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805530:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805540:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805550:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805560:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805570:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805580:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805590:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8055a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8055b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8055c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8055d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8055e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8055f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805600:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805610:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805620:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805630:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805640:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805650:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805660:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805670:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805680:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805690:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8056a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8056b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8056c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8056d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8056e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8056f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805700:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805710:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805720:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805730:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805740:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805750:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805760:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805770:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805780:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805790:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8057a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8057b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8057c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8057d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8057e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8057f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805800:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805810:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805820:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805830:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805840:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805850:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805860:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805870:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805880:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805890:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8058a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8058b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8058c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8058d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8058e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8058f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805900:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805910:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805920:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805930:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805940:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805950:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805960:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805970:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805980:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805990:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8059a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8059b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8059c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8059d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8059e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8059f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805aa0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ab0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ac0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ad0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ae0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805af0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ba0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805bb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805bc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805bd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805be0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805bf0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ca0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805cb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805cc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805cd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ce0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805cf0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805da0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805db0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805dc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805dd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805de0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805df0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ea0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805eb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ec0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ed0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ee0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ef0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805fa0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805fb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805fc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805fd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805fe0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ff0:	0f 1f 84 00 00 00 00 00 0f 1f 84 00 00 00 00 00     ................
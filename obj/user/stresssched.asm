@@ -0,0 +1,8618 @@
+
+obj/user/stresssched:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 30 01 00 00       	call   800153 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+volatile int counter;
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 55                	push   %r13
+  80002b:	41 54                	push   %r12
+  80002d:	53                   	push   %rbx
+  80002e:	48 83 ec 08          	sub    $0x8,%rsp
+    int i, j;
+    envid_t parent = sys_getenvid();
+  800032:	48 b8 70 11 80 00 00 	movabs $0x801170,%rax
+  800039:	00 00 00 
+  80003c:	ff d0                	call   *%rax
+  80003e:	41 89 c5             	mov    %eax,%r13d
+
+    /* Fork several environments */
+    for (i = 0; i < 20; i++)
+  800041:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fork() == 0)
+  800046:	49 bc 30 16 80 00 00 	movabs $0x801630,%r12
+  80004d:	00 00 00 
+  800050:	41 ff d4             	call   *%r12
+  800053:	85 c0                	test   %eax,%eax
+  800055:	74 19                	je     800070 <umain+0x4b>
+    for (i = 0; i < 20; i++)
+  800057:	83 c3 01             	add    $0x1,%ebx
+  80005a:	83 fb 14             	cmp    $0x14,%ebx
+  80005d:	75 f1                	jne    800050 <umain+0x2b>
+            break;
+    if (i == 20) {
+        sys_yield();
+  80005f:	48 b8 99 11 80 00 00 	movabs $0x801199,%rax
+  800066:	00 00 00 
+  800069:	ff d0                	call   *%rax
+        return;
+  80006b:	e9 a1 00 00 00       	jmp    800111 <umain+0xec>
+    if (i == 20) {
+  800070:	83 fb 14             	cmp    $0x14,%ebx
+  800073:	74 ea                	je     80005f <umain+0x3a>
+    }
+
+    /* Wait for the parent to finish forking */
+    while (envs[ENVX(parent)].env_status != ENV_FREE)
+  800075:	44 89 ea             	mov    %r13d,%edx
+  800078:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  80007e:	41 81 e5 ff 03 00 00 	and    $0x3ff,%r13d
+  800085:	4c 89 e8             	mov    %r13,%rax
+  800088:	48 c1 e0 04          	shl    $0x4,%rax
+  80008c:	4c 29 e8             	sub    %r13,%rax
+  80008f:	48 c1 e0 05          	shl    $0x5,%rax
+  800093:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80009a:	00 00 00 
+  80009d:	48 01 c8             	add    %rcx,%rax
+  8000a0:	8b 80 d4 00 00 00    	mov    0xd4(%rax),%eax
+  8000a6:	85 c0                	test   %eax,%eax
+  8000a8:	74 23                	je     8000cd <umain+0xa8>
+  8000aa:	48 63 d2             	movslq %edx,%rdx
+  8000ad:	48 89 d0             	mov    %rdx,%rax
+  8000b0:	48 c1 e0 04          	shl    $0x4,%rax
+  8000b4:	48 29 d0             	sub    %rdx,%rax
+  8000b7:	48 c1 e0 05          	shl    $0x5,%rax
+  8000bb:	48 89 ca             	mov    %rcx,%rdx
+  8000be:	48 01 c2             	add    %rax,%rdx
+        asm volatile("pause");
+  8000c1:	f3 90                	pause
+    while (envs[ENVX(parent)].env_status != ENV_FREE)
+  8000c3:	8b 82 d4 00 00 00    	mov    0xd4(%rdx),%eax
+  8000c9:	85 c0                	test   %eax,%eax
+  8000cb:	75 f4                	jne    8000c1 <umain+0x9c>
+    for (i = 0; i < 20; i++)
+  8000cd:	41 bc 0a 00 00 00    	mov    $0xa,%r12d
+
+    /* Check that one environment doesn't run on two CPUs at once */
+    for (i = 0; i < 10; i++) {
+        sys_yield();
+  8000d3:	49 bd 99 11 80 00 00 	movabs $0x801199,%r13
+  8000da:	00 00 00 
+        for (j = 0; j < 10000; j++)
+            counter++;
+  8000dd:	48 bb 00 00 81 00 00 	movabs $0x810000,%rbx
+  8000e4:	00 00 00 
+        sys_yield();
+  8000e7:	41 ff d5             	call   *%r13
+  8000ea:	ba 10 27 00 00       	mov    $0x2710,%edx
+            counter++;
+  8000ef:	8b 03                	mov    (%rbx),%eax
+  8000f1:	83 c0 01             	add    $0x1,%eax
+  8000f4:	89 03                	mov    %eax,(%rbx)
+        for (j = 0; j < 10000; j++)
+  8000f6:	83 ea 01             	sub    $0x1,%edx
+  8000f9:	75 f4                	jne    8000ef <umain+0xca>
+    for (i = 0; i < 10; i++) {
+  8000fb:	41 83 ec 01          	sub    $0x1,%r12d
+  8000ff:	75 e6                	jne    8000e7 <umain+0xc2>
+    }
+
+    if (counter != 10 * 10000)
+  800101:	a1 00 00 81 00 00 00 	movabs 0x810000,%eax
+  800108:	00 00 
+  80010a:	3d a0 86 01 00       	cmp    $0x186a0,%eax
+  80010f:	75 0b                	jne    80011c <umain+0xf7>
+        panic("ran on two CPUs at once (counter is %d)", counter);
+
+    /* Check that we see environments running on different CPUs */
+    //cprintf("[%08x] stresssched on CPU %d\n", thisenv->env_id, thisenv->env_cpunum);
+}
+  800111:	48 83 c4 08          	add    $0x8,%rsp
+  800115:	5b                   	pop    %rbx
+  800116:	41 5c                	pop    %r12
+  800118:	41 5d                	pop    %r13
+  80011a:	5d                   	pop    %rbp
+  80011b:	c3                   	ret
+        panic("ran on two CPUs at once (counter is %d)", counter);
+  80011c:	48 b8 00 00 81 00 00 	movabs $0x810000,%rax
+  800123:	00 00 00 
+  800126:	8b 08                	mov    (%rax),%ecx
+  800128:	48 ba d0 48 80 00 00 	movabs $0x8048d0,%rdx
+  80012f:	00 00 00 
+  800132:	be 1f 00 00 00       	mov    $0x1f,%esi
+  800137:	48 bf f8 48 80 00 00 	movabs $0x8048f8,%rdi
+  80013e:	00 00 00 
+  800141:	b8 00 00 00 00       	mov    $0x0,%eax
+  800146:	49 b8 29 02 80 00 00 	movabs $0x800229,%r8
+  80014d:	00 00 00 
+  800150:	41 ff d0             	call   *%r8
+
+0000000000800153 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800153:	55                   	push   %rbp
+  800154:	48 89 e5             	mov    %rsp,%rbp
+  800157:	41 56                	push   %r14
+  800159:	41 55                	push   %r13
+  80015b:	41 54                	push   %r12
+  80015d:	53                   	push   %rbx
+  80015e:	41 89 fd             	mov    %edi,%r13d
+  800161:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800164:	48 ba e0 60 80 00 00 	movabs $0x8060e0,%rdx
+  80016b:	00 00 00 
+  80016e:	48 b8 e0 60 80 00 00 	movabs $0x8060e0,%rax
+  800175:	00 00 00 
+  800178:	48 39 c2             	cmp    %rax,%rdx
+  80017b:	73 17                	jae    800194 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80017d:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800180:	49 89 c4             	mov    %rax,%r12
+  800183:	48 83 c3 08          	add    $0x8,%rbx
+  800187:	b8 00 00 00 00       	mov    $0x0,%eax
+  80018c:	ff 53 f8             	call   *-0x8(%rbx)
+  80018f:	4c 39 e3             	cmp    %r12,%rbx
+  800192:	72 ef                	jb     800183 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800194:	48 b8 70 11 80 00 00 	movabs $0x801170,%rax
+  80019b:	00 00 00 
+  80019e:	ff d0                	call   *%rax
+  8001a0:	89 c2                	mov    %eax,%edx
+  8001a2:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  8001a8:	48 89 d0             	mov    %rdx,%rax
+  8001ab:	48 c1 e0 04          	shl    $0x4,%rax
+  8001af:	48 29 d0             	sub    %rdx,%rax
+  8001b2:	48 c1 e0 05          	shl    $0x5,%rax
+  8001b6:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8001bd:	00 00 00 
+  8001c0:	48 01 d0             	add    %rdx,%rax
+  8001c3:	48 a3 08 00 81 00 00 	movabs %rax,0x810008
+  8001ca:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8001cd:	45 85 ed             	test   %r13d,%r13d
+  8001d0:	7e 0d                	jle    8001df <libmain+0x8c>
+  8001d2:	49 8b 06             	mov    (%r14),%rax
+  8001d5:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8001dc:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8001df:	4c 89 f6             	mov    %r14,%rsi
+  8001e2:	44 89 ef             	mov    %r13d,%edi
+  8001e5:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8001ec:	00 00 00 
+  8001ef:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8001f1:	48 b8 06 02 80 00 00 	movabs $0x800206,%rax
+  8001f8:	00 00 00 
+  8001fb:	ff d0                	call   *%rax
+#endif
+}
+  8001fd:	5b                   	pop    %rbx
+  8001fe:	41 5c                	pop    %r12
+  800200:	41 5d                	pop    %r13
+  800202:	41 5e                	pop    %r14
+  800204:	5d                   	pop    %rbp
+  800205:	c3                   	ret
+
+0000000000800206 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800206:	55                   	push   %rbp
+  800207:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80020a:	48 b8 76 19 80 00 00 	movabs $0x801976,%rax
+  800211:	00 00 00 
+  800214:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800216:	bf 00 00 00 00       	mov    $0x0,%edi
+  80021b:	48 b8 0d 11 80 00 00 	movabs $0x80110d,%rax
+  800222:	00 00 00 
+  800225:	ff d0                	call   *%rax
+}
+  800227:	5d                   	pop    %rbp
+  800228:	c3                   	ret
+
+0000000000800229 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800229:	55                   	push   %rbp
+  80022a:	48 89 e5             	mov    %rsp,%rbp
+  80022d:	41 56                	push   %r14
+  80022f:	41 55                	push   %r13
+  800231:	41 54                	push   %r12
+  800233:	53                   	push   %rbx
+  800234:	48 83 ec 50          	sub    $0x50,%rsp
+  800238:	49 89 fc             	mov    %rdi,%r12
+  80023b:	41 89 f5             	mov    %esi,%r13d
+  80023e:	48 89 d3             	mov    %rdx,%rbx
+  800241:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800245:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800249:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80024d:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800254:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800258:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80025c:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800260:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800264:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80026b:	00 00 00 
+  80026e:	4c 8b 30             	mov    (%rax),%r14
+  800271:	48 b8 70 11 80 00 00 	movabs $0x801170,%rax
+  800278:	00 00 00 
+  80027b:	ff d0                	call   *%rax
+  80027d:	89 c6                	mov    %eax,%esi
+  80027f:	45 89 e8             	mov    %r13d,%r8d
+  800282:	4c 89 e1             	mov    %r12,%rcx
+  800285:	4c 89 f2             	mov    %r14,%rdx
+  800288:	48 bf 18 49 80 00 00 	movabs $0x804918,%rdi
+  80028f:	00 00 00 
+  800292:	b8 00 00 00 00       	mov    $0x0,%eax
+  800297:	49 bc 79 03 80 00 00 	movabs $0x800379,%r12
+  80029e:	00 00 00 
+  8002a1:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8002a4:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8002a8:	48 89 df             	mov    %rbx,%rdi
+  8002ab:	48 b8 15 03 80 00 00 	movabs $0x800315,%rax
+  8002b2:	00 00 00 
+  8002b5:	ff d0                	call   *%rax
+    cprintf("\n");
+  8002b7:	48 bf 4b 4f 80 00 00 	movabs $0x804f4b,%rdi
+  8002be:	00 00 00 
+  8002c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002c6:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8002c9:	cc                   	int3
+  8002ca:	eb fd                	jmp    8002c9 <_panic+0xa0>
+
+00000000008002cc <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8002cc:	55                   	push   %rbp
+  8002cd:	48 89 e5             	mov    %rsp,%rbp
+  8002d0:	53                   	push   %rbx
+  8002d1:	48 83 ec 08          	sub    $0x8,%rsp
+  8002d5:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8002d8:	8b 06                	mov    (%rsi),%eax
+  8002da:	8d 50 01             	lea    0x1(%rax),%edx
+  8002dd:	89 16                	mov    %edx,(%rsi)
+  8002df:	48 98                	cltq
+  8002e1:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8002e6:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8002ec:	74 0a                	je     8002f8 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8002ee:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8002f2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002f6:	c9                   	leave
+  8002f7:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8002f8:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8002fc:	be ff 00 00 00       	mov    $0xff,%esi
+  800301:	48 b8 c5 10 80 00 00 	movabs $0x8010c5,%rax
+  800308:	00 00 00 
+  80030b:	ff d0                	call   *%rax
+        state->offset = 0;
+  80030d:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800313:	eb d9                	jmp    8002ee <putch+0x22>
+
+0000000000800315 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800315:	55                   	push   %rbp
+  800316:	48 89 e5             	mov    %rsp,%rbp
+  800319:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800320:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800323:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80032a:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80032f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800334:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800337:	48 89 f1             	mov    %rsi,%rcx
+  80033a:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800341:	48 bf cc 02 80 00 00 	movabs $0x8002cc,%rdi
+  800348:	00 00 00 
+  80034b:	48 b8 c9 04 80 00 00 	movabs $0x8004c9,%rax
+  800352:	00 00 00 
+  800355:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800357:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80035e:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800365:	48 b8 c5 10 80 00 00 	movabs $0x8010c5,%rax
+  80036c:	00 00 00 
+  80036f:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800371:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800377:	c9                   	leave
+  800378:	c3                   	ret
+
+0000000000800379 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800379:	55                   	push   %rbp
+  80037a:	48 89 e5             	mov    %rsp,%rbp
+  80037d:	48 83 ec 50          	sub    $0x50,%rsp
+  800381:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800385:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800389:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80038d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800391:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800395:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80039c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003a0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003a4:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8003a8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8003ac:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8003b0:	48 b8 15 03 80 00 00 	movabs $0x800315,%rax
+  8003b7:	00 00 00 
+  8003ba:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8003bc:	c9                   	leave
+  8003bd:	c3                   	ret
+
+00000000008003be <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8003be:	55                   	push   %rbp
+  8003bf:	48 89 e5             	mov    %rsp,%rbp
+  8003c2:	41 57                	push   %r15
+  8003c4:	41 56                	push   %r14
+  8003c6:	41 55                	push   %r13
+  8003c8:	41 54                	push   %r12
+  8003ca:	53                   	push   %rbx
+  8003cb:	48 83 ec 18          	sub    $0x18,%rsp
+  8003cf:	49 89 fc             	mov    %rdi,%r12
+  8003d2:	49 89 f5             	mov    %rsi,%r13
+  8003d5:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8003d9:	8b 45 10             	mov    0x10(%rbp),%eax
+  8003dc:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8003df:	41 89 cf             	mov    %ecx,%r15d
+  8003e2:	4c 39 fa             	cmp    %r15,%rdx
+  8003e5:	73 5b                	jae    800442 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8003e7:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8003eb:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8003ef:	85 db                	test   %ebx,%ebx
+  8003f1:	7e 0e                	jle    800401 <print_num+0x43>
+            putch(padc, put_arg);
+  8003f3:	4c 89 ee             	mov    %r13,%rsi
+  8003f6:	44 89 f7             	mov    %r14d,%edi
+  8003f9:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8003fc:	83 eb 01             	sub    $0x1,%ebx
+  8003ff:	75 f2                	jne    8003f3 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800401:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800405:	48 b9 4c 49 80 00 00 	movabs $0x80494c,%rcx
+  80040c:	00 00 00 
+  80040f:	48 b8 3b 49 80 00 00 	movabs $0x80493b,%rax
+  800416:	00 00 00 
+  800419:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80041d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800421:	ba 00 00 00 00       	mov    $0x0,%edx
+  800426:	49 f7 f7             	div    %r15
+  800429:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80042d:	4c 89 ee             	mov    %r13,%rsi
+  800430:	41 ff d4             	call   *%r12
+}
+  800433:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800437:	5b                   	pop    %rbx
+  800438:	41 5c                	pop    %r12
+  80043a:	41 5d                	pop    %r13
+  80043c:	41 5e                	pop    %r14
+  80043e:	41 5f                	pop    %r15
+  800440:	5d                   	pop    %rbp
+  800441:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800442:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800446:	ba 00 00 00 00       	mov    $0x0,%edx
+  80044b:	49 f7 f7             	div    %r15
+  80044e:	48 83 ec 08          	sub    $0x8,%rsp
+  800452:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800456:	52                   	push   %rdx
+  800457:	45 0f be c9          	movsbl %r9b,%r9d
+  80045b:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80045f:	48 89 c2             	mov    %rax,%rdx
+  800462:	48 b8 be 03 80 00 00 	movabs $0x8003be,%rax
+  800469:	00 00 00 
+  80046c:	ff d0                	call   *%rax
+  80046e:	48 83 c4 10          	add    $0x10,%rsp
+  800472:	eb 8d                	jmp    800401 <print_num+0x43>
+
+0000000000800474 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800474:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800478:	48 8b 06             	mov    (%rsi),%rax
+  80047b:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80047f:	73 0a                	jae    80048b <sprintputch+0x17>
+        *state->start++ = ch;
+  800481:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800485:	48 89 16             	mov    %rdx,(%rsi)
+  800488:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80048b:	c3                   	ret
+
+000000000080048c <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80048c:	55                   	push   %rbp
+  80048d:	48 89 e5             	mov    %rsp,%rbp
+  800490:	48 83 ec 50          	sub    $0x50,%rsp
+  800494:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800498:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80049c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8004a0:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8004a7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8004ab:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004af:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8004b3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8004b7:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8004bb:	48 b8 c9 04 80 00 00 	movabs $0x8004c9,%rax
+  8004c2:	00 00 00 
+  8004c5:	ff d0                	call   *%rax
+}
+  8004c7:	c9                   	leave
+  8004c8:	c3                   	ret
+
+00000000008004c9 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8004c9:	55                   	push   %rbp
+  8004ca:	48 89 e5             	mov    %rsp,%rbp
+  8004cd:	41 57                	push   %r15
+  8004cf:	41 56                	push   %r14
+  8004d1:	41 55                	push   %r13
+  8004d3:	41 54                	push   %r12
+  8004d5:	53                   	push   %rbx
+  8004d6:	48 83 ec 38          	sub    $0x38,%rsp
+  8004da:	49 89 fe             	mov    %rdi,%r14
+  8004dd:	49 89 f5             	mov    %rsi,%r13
+  8004e0:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8004e3:	48 8b 01             	mov    (%rcx),%rax
+  8004e6:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8004ea:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8004ee:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004f2:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8004f6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8004fa:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8004fe:	0f b6 3b             	movzbl (%rbx),%edi
+  800501:	40 80 ff 25          	cmp    $0x25,%dil
+  800505:	74 18                	je     80051f <vprintfmt+0x56>
+            if (!ch) return;
+  800507:	40 84 ff             	test   %dil,%dil
+  80050a:	0f 84 b1 06 00 00    	je     800bc1 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800510:	40 0f b6 ff          	movzbl %dil,%edi
+  800514:	4c 89 ee             	mov    %r13,%rsi
+  800517:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80051a:	4c 89 e3             	mov    %r12,%rbx
+  80051d:	eb db                	jmp    8004fa <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80051f:	be 00 00 00 00       	mov    $0x0,%esi
+  800524:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800528:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80052d:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800533:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80053a:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80053e:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800543:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800548:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80054b:	83 e8 23             	sub    $0x23,%eax
+  80054e:	3c 57                	cmp    $0x57,%al
+  800550:	0f 87 51 06 00 00    	ja     800ba7 <vprintfmt+0x6de>
+  800556:	0f b6 c0             	movzbl %al,%eax
+  800559:	48 b9 00 4b 80 00 00 	movabs $0x804b00,%rcx
+  800560:	00 00 00 
+  800563:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800566:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800569:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80056d:	eb cf                	jmp    80053e <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  80056f:	49 89 dc             	mov    %rbx,%r12
+  800572:	be 01 00 00 00       	mov    $0x1,%esi
+  800577:	eb c5                	jmp    80053e <vprintfmt+0x75>
+            padc = ch;
+  800579:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80057d:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800580:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800583:	eb b9                	jmp    80053e <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800585:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800588:	83 f8 2f             	cmp    $0x2f,%eax
+  80058b:	77 24                	ja     8005b1 <vprintfmt+0xe8>
+  80058d:	89 c1                	mov    %eax,%ecx
+  80058f:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800593:	83 c0 08             	add    $0x8,%eax
+  800596:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800599:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80059c:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80059f:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8005a3:	79 99                	jns    80053e <vprintfmt+0x75>
+                width = precision;
+  8005a5:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8005a9:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8005af:	eb 8d                	jmp    80053e <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8005b1:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8005b5:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8005b9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005bd:	eb da                	jmp    800599 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8005bf:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8005c4:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8005c8:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8005ce:	3c 39                	cmp    $0x39,%al
+  8005d0:	77 1c                	ja     8005ee <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8005d2:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8005d6:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8005da:	0f b6 c0             	movzbl %al,%eax
+  8005dd:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8005e2:	0f b6 03             	movzbl (%rbx),%eax
+  8005e5:	3c 39                	cmp    $0x39,%al
+  8005e7:	76 e9                	jbe    8005d2 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8005e9:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8005ec:	eb b1                	jmp    80059f <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8005ee:	49 89 dc             	mov    %rbx,%r12
+  8005f1:	eb ac                	jmp    80059f <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8005f3:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8005f6:	85 c9                	test   %ecx,%ecx
+  8005f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005fd:	0f 49 c1             	cmovns %ecx,%eax
+  800600:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800603:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800606:	e9 33 ff ff ff       	jmp    80053e <vprintfmt+0x75>
+            lflag++;
+  80060b:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80060e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800611:	e9 28 ff ff ff       	jmp    80053e <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800616:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800619:	83 f8 2f             	cmp    $0x2f,%eax
+  80061c:	77 19                	ja     800637 <vprintfmt+0x16e>
+  80061e:	89 c2                	mov    %eax,%edx
+  800620:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800624:	83 c0 08             	add    $0x8,%eax
+  800627:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80062a:	8b 3a                	mov    (%rdx),%edi
+  80062c:	4c 89 ee             	mov    %r13,%rsi
+  80062f:	41 ff d6             	call   *%r14
+            break;
+  800632:	e9 c3 fe ff ff       	jmp    8004fa <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800637:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80063b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80063f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800643:	eb e5                	jmp    80062a <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800645:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800648:	83 f8 2f             	cmp    $0x2f,%eax
+  80064b:	77 5a                	ja     8006a7 <vprintfmt+0x1de>
+  80064d:	89 c2                	mov    %eax,%edx
+  80064f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800653:	83 c0 08             	add    $0x8,%eax
+  800656:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800659:	8b 02                	mov    (%rdx),%eax
+  80065b:	89 c1                	mov    %eax,%ecx
+  80065d:	f7 d9                	neg    %ecx
+  80065f:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800662:	83 f9 16             	cmp    $0x16,%ecx
+  800665:	7f 4e                	jg     8006b5 <vprintfmt+0x1ec>
+  800667:	48 63 c1             	movslq %ecx,%rax
+  80066a:	48 ba c0 4d 80 00 00 	movabs $0x804dc0,%rdx
+  800671:	00 00 00 
+  800674:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800678:	48 85 c0             	test   %rax,%rax
+  80067b:	74 38                	je     8006b5 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80067d:	48 89 c1             	mov    %rax,%rcx
+  800680:	48 ba b9 4f 80 00 00 	movabs $0x804fb9,%rdx
+  800687:	00 00 00 
+  80068a:	4c 89 ee             	mov    %r13,%rsi
+  80068d:	4c 89 f7             	mov    %r14,%rdi
+  800690:	b8 00 00 00 00       	mov    $0x0,%eax
+  800695:	49 b8 8c 04 80 00 00 	movabs $0x80048c,%r8
+  80069c:	00 00 00 
+  80069f:	41 ff d0             	call   *%r8
+  8006a2:	e9 53 fe ff ff       	jmp    8004fa <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8006a7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006ab:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006af:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006b3:	eb a4                	jmp    800659 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8006b5:	48 ba 64 49 80 00 00 	movabs $0x804964,%rdx
+  8006bc:	00 00 00 
+  8006bf:	4c 89 ee             	mov    %r13,%rsi
+  8006c2:	4c 89 f7             	mov    %r14,%rdi
+  8006c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006ca:	49 b8 8c 04 80 00 00 	movabs $0x80048c,%r8
+  8006d1:	00 00 00 
+  8006d4:	41 ff d0             	call   *%r8
+  8006d7:	e9 1e fe ff ff       	jmp    8004fa <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8006dc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006df:	83 f8 2f             	cmp    $0x2f,%eax
+  8006e2:	77 6c                	ja     800750 <vprintfmt+0x287>
+  8006e4:	89 c2                	mov    %eax,%edx
+  8006e6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006ea:	83 c0 08             	add    $0x8,%eax
+  8006ed:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006f0:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8006f3:	48 85 d2             	test   %rdx,%rdx
+  8006f6:	48 b8 5d 49 80 00 00 	movabs $0x80495d,%rax
+  8006fd:	00 00 00 
+  800700:	48 0f 45 c2          	cmovne %rdx,%rax
+  800704:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800708:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80070c:	7e 06                	jle    800714 <vprintfmt+0x24b>
+  80070e:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800712:	75 4a                	jne    80075e <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800714:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800718:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80071c:	0f b6 00             	movzbl (%rax),%eax
+  80071f:	84 c0                	test   %al,%al
+  800721:	0f 85 9a 00 00 00    	jne    8007c1 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800727:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80072a:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80072e:	85 c0                	test   %eax,%eax
+  800730:	0f 8e c4 fd ff ff    	jle    8004fa <vprintfmt+0x31>
+  800736:	4c 89 ee             	mov    %r13,%rsi
+  800739:	bf 20 00 00 00       	mov    $0x20,%edi
+  80073e:	41 ff d6             	call   *%r14
+  800741:	41 83 ec 01          	sub    $0x1,%r12d
+  800745:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800749:	75 eb                	jne    800736 <vprintfmt+0x26d>
+  80074b:	e9 aa fd ff ff       	jmp    8004fa <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800750:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800754:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800758:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80075c:	eb 92                	jmp    8006f0 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80075e:	49 63 f7             	movslq %r15d,%rsi
+  800761:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800765:	48 b8 7b 0c 80 00 00 	movabs $0x800c7b,%rax
+  80076c:	00 00 00 
+  80076f:	ff d0                	call   *%rax
+  800771:	48 89 c2             	mov    %rax,%rdx
+  800774:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800777:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800779:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80077c:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80077f:	85 c0                	test   %eax,%eax
+  800781:	7e 91                	jle    800714 <vprintfmt+0x24b>
+  800783:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800788:	4c 89 ee             	mov    %r13,%rsi
+  80078b:	44 89 e7             	mov    %r12d,%edi
+  80078e:	41 ff d6             	call   *%r14
+  800791:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800795:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800798:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80079b:	75 eb                	jne    800788 <vprintfmt+0x2bf>
+  80079d:	e9 72 ff ff ff       	jmp    800714 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8007a2:	0f b6 f8             	movzbl %al,%edi
+  8007a5:	4c 89 ee             	mov    %r13,%rsi
+  8007a8:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8007ab:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8007af:	49 83 c4 01          	add    $0x1,%r12
+  8007b3:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8007b9:	84 c0                	test   %al,%al
+  8007bb:	0f 84 66 ff ff ff    	je     800727 <vprintfmt+0x25e>
+  8007c1:	45 85 ff             	test   %r15d,%r15d
+  8007c4:	78 0a                	js     8007d0 <vprintfmt+0x307>
+  8007c6:	41 83 ef 01          	sub    $0x1,%r15d
+  8007ca:	0f 88 57 ff ff ff    	js     800727 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8007d0:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8007d4:	74 cc                	je     8007a2 <vprintfmt+0x2d9>
+  8007d6:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8007d9:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8007de:	80 fa 5e             	cmp    $0x5e,%dl
+  8007e1:	77 c2                	ja     8007a5 <vprintfmt+0x2dc>
+  8007e3:	eb bd                	jmp    8007a2 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8007e5:	40 84 f6             	test   %sil,%sil
+  8007e8:	75 26                	jne    800810 <vprintfmt+0x347>
+    switch (lflag) {
+  8007ea:	85 d2                	test   %edx,%edx
+  8007ec:	74 59                	je     800847 <vprintfmt+0x37e>
+  8007ee:	83 fa 01             	cmp    $0x1,%edx
+  8007f1:	74 7b                	je     80086e <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8007f3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007f6:	83 f8 2f             	cmp    $0x2f,%eax
+  8007f9:	0f 87 96 00 00 00    	ja     800895 <vprintfmt+0x3cc>
+  8007ff:	89 c2                	mov    %eax,%edx
+  800801:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800805:	83 c0 08             	add    $0x8,%eax
+  800808:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80080b:	4c 8b 22             	mov    (%rdx),%r12
+  80080e:	eb 17                	jmp    800827 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800810:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800813:	83 f8 2f             	cmp    $0x2f,%eax
+  800816:	77 21                	ja     800839 <vprintfmt+0x370>
+  800818:	89 c2                	mov    %eax,%edx
+  80081a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80081e:	83 c0 08             	add    $0x8,%eax
+  800821:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800824:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800827:	4d 85 e4             	test   %r12,%r12
+  80082a:	78 7a                	js     8008a6 <vprintfmt+0x3dd>
+            num = i;
+  80082c:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80082f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800834:	e9 50 02 00 00       	jmp    800a89 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800839:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80083d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800841:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800845:	eb dd                	jmp    800824 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800847:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80084a:	83 f8 2f             	cmp    $0x2f,%eax
+  80084d:	77 11                	ja     800860 <vprintfmt+0x397>
+  80084f:	89 c2                	mov    %eax,%edx
+  800851:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800855:	83 c0 08             	add    $0x8,%eax
+  800858:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80085b:	4c 63 22             	movslq (%rdx),%r12
+  80085e:	eb c7                	jmp    800827 <vprintfmt+0x35e>
+  800860:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800864:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800868:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80086c:	eb ed                	jmp    80085b <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  80086e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800871:	83 f8 2f             	cmp    $0x2f,%eax
+  800874:	77 11                	ja     800887 <vprintfmt+0x3be>
+  800876:	89 c2                	mov    %eax,%edx
+  800878:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80087c:	83 c0 08             	add    $0x8,%eax
+  80087f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800882:	4c 8b 22             	mov    (%rdx),%r12
+  800885:	eb a0                	jmp    800827 <vprintfmt+0x35e>
+  800887:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80088b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80088f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800893:	eb ed                	jmp    800882 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800895:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800899:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80089d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008a1:	e9 65 ff ff ff       	jmp    80080b <vprintfmt+0x342>
+                putch('-', put_arg);
+  8008a6:	4c 89 ee             	mov    %r13,%rsi
+  8008a9:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8008ae:	41 ff d6             	call   *%r14
+                i = -i;
+  8008b1:	49 f7 dc             	neg    %r12
+  8008b4:	e9 73 ff ff ff       	jmp    80082c <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8008b9:	40 84 f6             	test   %sil,%sil
+  8008bc:	75 32                	jne    8008f0 <vprintfmt+0x427>
+    switch (lflag) {
+  8008be:	85 d2                	test   %edx,%edx
+  8008c0:	74 5d                	je     80091f <vprintfmt+0x456>
+  8008c2:	83 fa 01             	cmp    $0x1,%edx
+  8008c5:	0f 84 82 00 00 00    	je     80094d <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8008cb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008ce:	83 f8 2f             	cmp    $0x2f,%eax
+  8008d1:	0f 87 a5 00 00 00    	ja     80097c <vprintfmt+0x4b3>
+  8008d7:	89 c2                	mov    %eax,%edx
+  8008d9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008dd:	83 c0 08             	add    $0x8,%eax
+  8008e0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008e3:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8008e6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8008eb:	e9 99 01 00 00       	jmp    800a89 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8008f0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008f3:	83 f8 2f             	cmp    $0x2f,%eax
+  8008f6:	77 19                	ja     800911 <vprintfmt+0x448>
+  8008f8:	89 c2                	mov    %eax,%edx
+  8008fa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008fe:	83 c0 08             	add    $0x8,%eax
+  800901:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800904:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800907:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80090c:	e9 78 01 00 00       	jmp    800a89 <vprintfmt+0x5c0>
+  800911:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800915:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800919:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80091d:	eb e5                	jmp    800904 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  80091f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800922:	83 f8 2f             	cmp    $0x2f,%eax
+  800925:	77 18                	ja     80093f <vprintfmt+0x476>
+  800927:	89 c2                	mov    %eax,%edx
+  800929:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80092d:	83 c0 08             	add    $0x8,%eax
+  800930:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800933:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800935:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80093a:	e9 4a 01 00 00       	jmp    800a89 <vprintfmt+0x5c0>
+  80093f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800943:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800947:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80094b:	eb e6                	jmp    800933 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  80094d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800950:	83 f8 2f             	cmp    $0x2f,%eax
+  800953:	77 19                	ja     80096e <vprintfmt+0x4a5>
+  800955:	89 c2                	mov    %eax,%edx
+  800957:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80095b:	83 c0 08             	add    $0x8,%eax
+  80095e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800961:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800964:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800969:	e9 1b 01 00 00       	jmp    800a89 <vprintfmt+0x5c0>
+  80096e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800972:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800976:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80097a:	eb e5                	jmp    800961 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  80097c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800980:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800984:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800988:	e9 56 ff ff ff       	jmp    8008e3 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  80098d:	40 84 f6             	test   %sil,%sil
+  800990:	75 2e                	jne    8009c0 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800992:	85 d2                	test   %edx,%edx
+  800994:	74 59                	je     8009ef <vprintfmt+0x526>
+  800996:	83 fa 01             	cmp    $0x1,%edx
+  800999:	74 7f                	je     800a1a <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  80099b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80099e:	83 f8 2f             	cmp    $0x2f,%eax
+  8009a1:	0f 87 9f 00 00 00    	ja     800a46 <vprintfmt+0x57d>
+  8009a7:	89 c2                	mov    %eax,%edx
+  8009a9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009ad:	83 c0 08             	add    $0x8,%eax
+  8009b0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009b3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8009b6:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8009bb:	e9 c9 00 00 00       	jmp    800a89 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009c0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009c3:	83 f8 2f             	cmp    $0x2f,%eax
+  8009c6:	77 19                	ja     8009e1 <vprintfmt+0x518>
+  8009c8:	89 c2                	mov    %eax,%edx
+  8009ca:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009ce:	83 c0 08             	add    $0x8,%eax
+  8009d1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009d4:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8009d7:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8009dc:	e9 a8 00 00 00       	jmp    800a89 <vprintfmt+0x5c0>
+  8009e1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009e5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009e9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009ed:	eb e5                	jmp    8009d4 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8009ef:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009f2:	83 f8 2f             	cmp    $0x2f,%eax
+  8009f5:	77 15                	ja     800a0c <vprintfmt+0x543>
+  8009f7:	89 c2                	mov    %eax,%edx
+  8009f9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009fd:	83 c0 08             	add    $0x8,%eax
+  800a00:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a03:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800a05:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800a0a:	eb 7d                	jmp    800a89 <vprintfmt+0x5c0>
+  800a0c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a10:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a14:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a18:	eb e9                	jmp    800a03 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800a1a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a1d:	83 f8 2f             	cmp    $0x2f,%eax
+  800a20:	77 16                	ja     800a38 <vprintfmt+0x56f>
+  800a22:	89 c2                	mov    %eax,%edx
+  800a24:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a28:	83 c0 08             	add    $0x8,%eax
+  800a2b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a2e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a31:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800a36:	eb 51                	jmp    800a89 <vprintfmt+0x5c0>
+  800a38:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a3c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a40:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a44:	eb e8                	jmp    800a2e <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800a46:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a4a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a4e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a52:	e9 5c ff ff ff       	jmp    8009b3 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800a57:	4c 89 ee             	mov    %r13,%rsi
+  800a5a:	bf 30 00 00 00       	mov    $0x30,%edi
+  800a5f:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800a62:	4c 89 ee             	mov    %r13,%rsi
+  800a65:	bf 78 00 00 00       	mov    $0x78,%edi
+  800a6a:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800a6d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a70:	83 f8 2f             	cmp    $0x2f,%eax
+  800a73:	77 47                	ja     800abc <vprintfmt+0x5f3>
+  800a75:	89 c2                	mov    %eax,%edx
+  800a77:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a7b:	83 c0 08             	add    $0x8,%eax
+  800a7e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a81:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a84:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800a89:	48 83 ec 08          	sub    $0x8,%rsp
+  800a8d:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800a91:	0f 94 c0             	sete   %al
+  800a94:	0f b6 c0             	movzbl %al,%eax
+  800a97:	50                   	push   %rax
+  800a98:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800a9d:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800aa1:	4c 89 ee             	mov    %r13,%rsi
+  800aa4:	4c 89 f7             	mov    %r14,%rdi
+  800aa7:	48 b8 be 03 80 00 00 	movabs $0x8003be,%rax
+  800aae:	00 00 00 
+  800ab1:	ff d0                	call   *%rax
+            break;
+  800ab3:	48 83 c4 10          	add    $0x10,%rsp
+  800ab7:	e9 3e fa ff ff       	jmp    8004fa <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800abc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ac0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ac4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ac8:	eb b7                	jmp    800a81 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800aca:	40 84 f6             	test   %sil,%sil
+  800acd:	75 2b                	jne    800afa <vprintfmt+0x631>
+    switch (lflag) {
+  800acf:	85 d2                	test   %edx,%edx
+  800ad1:	74 56                	je     800b29 <vprintfmt+0x660>
+  800ad3:	83 fa 01             	cmp    $0x1,%edx
+  800ad6:	74 7f                	je     800b57 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800ad8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800adb:	83 f8 2f             	cmp    $0x2f,%eax
+  800ade:	0f 87 a2 00 00 00    	ja     800b86 <vprintfmt+0x6bd>
+  800ae4:	89 c2                	mov    %eax,%edx
+  800ae6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aea:	83 c0 08             	add    $0x8,%eax
+  800aed:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800af0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800af3:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800af8:	eb 8f                	jmp    800a89 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800afa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800afd:	83 f8 2f             	cmp    $0x2f,%eax
+  800b00:	77 19                	ja     800b1b <vprintfmt+0x652>
+  800b02:	89 c2                	mov    %eax,%edx
+  800b04:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b08:	83 c0 08             	add    $0x8,%eax
+  800b0b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b0e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b11:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b16:	e9 6e ff ff ff       	jmp    800a89 <vprintfmt+0x5c0>
+  800b1b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b1f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b23:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b27:	eb e5                	jmp    800b0e <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800b29:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b2c:	83 f8 2f             	cmp    $0x2f,%eax
+  800b2f:	77 18                	ja     800b49 <vprintfmt+0x680>
+  800b31:	89 c2                	mov    %eax,%edx
+  800b33:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b37:	83 c0 08             	add    $0x8,%eax
+  800b3a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b3d:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800b3f:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800b44:	e9 40 ff ff ff       	jmp    800a89 <vprintfmt+0x5c0>
+  800b49:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b4d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b51:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b55:	eb e6                	jmp    800b3d <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800b57:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b5a:	83 f8 2f             	cmp    $0x2f,%eax
+  800b5d:	77 19                	ja     800b78 <vprintfmt+0x6af>
+  800b5f:	89 c2                	mov    %eax,%edx
+  800b61:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b65:	83 c0 08             	add    $0x8,%eax
+  800b68:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b6b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b6e:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800b73:	e9 11 ff ff ff       	jmp    800a89 <vprintfmt+0x5c0>
+  800b78:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b7c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b80:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b84:	eb e5                	jmp    800b6b <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800b86:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b8a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b8e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b92:	e9 59 ff ff ff       	jmp    800af0 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800b97:	4c 89 ee             	mov    %r13,%rsi
+  800b9a:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b9f:	41 ff d6             	call   *%r14
+            break;
+  800ba2:	e9 53 f9 ff ff       	jmp    8004fa <vprintfmt+0x31>
+            putch('%', put_arg);
+  800ba7:	4c 89 ee             	mov    %r13,%rsi
+  800baa:	bf 25 00 00 00       	mov    $0x25,%edi
+  800baf:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800bb2:	48 83 eb 01          	sub    $0x1,%rbx
+  800bb6:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800bba:	75 f6                	jne    800bb2 <vprintfmt+0x6e9>
+  800bbc:	e9 39 f9 ff ff       	jmp    8004fa <vprintfmt+0x31>
+}
+  800bc1:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800bc5:	5b                   	pop    %rbx
+  800bc6:	41 5c                	pop    %r12
+  800bc8:	41 5d                	pop    %r13
+  800bca:	41 5e                	pop    %r14
+  800bcc:	41 5f                	pop    %r15
+  800bce:	5d                   	pop    %rbp
+  800bcf:	c3                   	ret
+
+0000000000800bd0 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800bd0:	55                   	push   %rbp
+  800bd1:	48 89 e5             	mov    %rsp,%rbp
+  800bd4:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800bd8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800bdc:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800be1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800be5:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800bec:	48 85 ff             	test   %rdi,%rdi
+  800bef:	74 2b                	je     800c1c <vsnprintf+0x4c>
+  800bf1:	48 85 f6             	test   %rsi,%rsi
+  800bf4:	74 26                	je     800c1c <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800bf6:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800bfa:	48 bf 74 04 80 00 00 	movabs $0x800474,%rdi
+  800c01:	00 00 00 
+  800c04:	48 b8 c9 04 80 00 00 	movabs $0x8004c9,%rax
+  800c0b:	00 00 00 
+  800c0e:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800c10:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c14:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800c17:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800c1a:	c9                   	leave
+  800c1b:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800c1c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c21:	eb f7                	jmp    800c1a <vsnprintf+0x4a>
+
+0000000000800c23 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800c23:	55                   	push   %rbp
+  800c24:	48 89 e5             	mov    %rsp,%rbp
+  800c27:	48 83 ec 50          	sub    $0x50,%rsp
+  800c2b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800c2f:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800c33:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800c37:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800c3e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800c42:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c46:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800c4a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800c4e:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800c52:	48 b8 d0 0b 80 00 00 	movabs $0x800bd0,%rax
+  800c59:	00 00 00 
+  800c5c:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800c5e:	c9                   	leave
+  800c5f:	c3                   	ret
+
+0000000000800c60 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800c60:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800c63:	74 10                	je     800c75 <strlen+0x15>
+    size_t n = 0;
+  800c65:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800c6a:	48 83 c0 01          	add    $0x1,%rax
+  800c6e:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800c72:	75 f6                	jne    800c6a <strlen+0xa>
+  800c74:	c3                   	ret
+    size_t n = 0;
+  800c75:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800c7a:	c3                   	ret
+
+0000000000800c7b <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800c7b:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800c7e:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800c83:	48 85 f6             	test   %rsi,%rsi
+  800c86:	74 11                	je     800c99 <strnlen+0x1e>
+  800c88:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800c8c:	74 0c                	je     800c9a <strnlen+0x1f>
+  800c8e:	48 83 c2 01          	add    $0x1,%rdx
+  800c92:	48 39 d0             	cmp    %rdx,%rax
+  800c95:	75 f1                	jne    800c88 <strnlen+0xd>
+  800c97:	eb 04                	jmp    800c9d <strnlen+0x22>
+  800c99:	c3                   	ret
+  800c9a:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800c9d:	c3                   	ret
+
+0000000000800c9e <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800c9e:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800ca1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ca6:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800caa:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800cad:	48 83 c2 01          	add    $0x1,%rdx
+  800cb1:	84 c9                	test   %cl,%cl
+  800cb3:	75 f1                	jne    800ca6 <strcpy+0x8>
+        ;
+    return res;
+}
+  800cb5:	c3                   	ret
+
+0000000000800cb6 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800cb6:	55                   	push   %rbp
+  800cb7:	48 89 e5             	mov    %rsp,%rbp
+  800cba:	41 54                	push   %r12
+  800cbc:	53                   	push   %rbx
+  800cbd:	48 89 fb             	mov    %rdi,%rbx
+  800cc0:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800cc3:	48 b8 60 0c 80 00 00 	movabs $0x800c60,%rax
+  800cca:	00 00 00 
+  800ccd:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800ccf:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800cd3:	4c 89 e6             	mov    %r12,%rsi
+  800cd6:	48 b8 9e 0c 80 00 00 	movabs $0x800c9e,%rax
+  800cdd:	00 00 00 
+  800ce0:	ff d0                	call   *%rax
+    return dst;
+}
+  800ce2:	48 89 d8             	mov    %rbx,%rax
+  800ce5:	5b                   	pop    %rbx
+  800ce6:	41 5c                	pop    %r12
+  800ce8:	5d                   	pop    %rbp
+  800ce9:	c3                   	ret
+
+0000000000800cea <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800cea:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800ced:	48 85 d2             	test   %rdx,%rdx
+  800cf0:	74 1f                	je     800d11 <strncpy+0x27>
+  800cf2:	48 01 fa             	add    %rdi,%rdx
+  800cf5:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800cf8:	48 83 c1 01          	add    $0x1,%rcx
+  800cfc:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800d00:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800d04:	41 80 f8 01          	cmp    $0x1,%r8b
+  800d08:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800d0c:	48 39 ca             	cmp    %rcx,%rdx
+  800d0f:	75 e7                	jne    800cf8 <strncpy+0xe>
+    }
+    return ret;
+}
+  800d11:	c3                   	ret
+
+0000000000800d12 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800d12:	48 89 f8             	mov    %rdi,%rax
+  800d15:	48 85 d2             	test   %rdx,%rdx
+  800d18:	74 24                	je     800d3e <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800d1a:	48 83 ea 01          	sub    $0x1,%rdx
+  800d1e:	74 1b                	je     800d3b <strlcpy+0x29>
+  800d20:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800d24:	0f b6 16             	movzbl (%rsi),%edx
+  800d27:	84 d2                	test   %dl,%dl
+  800d29:	74 10                	je     800d3b <strlcpy+0x29>
+            *dst++ = *src++;
+  800d2b:	48 83 c6 01          	add    $0x1,%rsi
+  800d2f:	48 83 c0 01          	add    $0x1,%rax
+  800d33:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800d36:	48 39 c8             	cmp    %rcx,%rax
+  800d39:	75 e9                	jne    800d24 <strlcpy+0x12>
+        *dst = '\0';
+  800d3b:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800d3e:	48 29 f8             	sub    %rdi,%rax
+}
+  800d41:	c3                   	ret
+
+0000000000800d42 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800d42:	0f b6 07             	movzbl (%rdi),%eax
+  800d45:	84 c0                	test   %al,%al
+  800d47:	74 13                	je     800d5c <strcmp+0x1a>
+  800d49:	38 06                	cmp    %al,(%rsi)
+  800d4b:	75 0f                	jne    800d5c <strcmp+0x1a>
+  800d4d:	48 83 c7 01          	add    $0x1,%rdi
+  800d51:	48 83 c6 01          	add    $0x1,%rsi
+  800d55:	0f b6 07             	movzbl (%rdi),%eax
+  800d58:	84 c0                	test   %al,%al
+  800d5a:	75 ed                	jne    800d49 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d5c:	0f b6 c0             	movzbl %al,%eax
+  800d5f:	0f b6 16             	movzbl (%rsi),%edx
+  800d62:	29 d0                	sub    %edx,%eax
+}
+  800d64:	c3                   	ret
+
+0000000000800d65 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800d65:	48 85 d2             	test   %rdx,%rdx
+  800d68:	74 1f                	je     800d89 <strncmp+0x24>
+  800d6a:	0f b6 07             	movzbl (%rdi),%eax
+  800d6d:	84 c0                	test   %al,%al
+  800d6f:	74 1e                	je     800d8f <strncmp+0x2a>
+  800d71:	3a 06                	cmp    (%rsi),%al
+  800d73:	75 1a                	jne    800d8f <strncmp+0x2a>
+  800d75:	48 83 c7 01          	add    $0x1,%rdi
+  800d79:	48 83 c6 01          	add    $0x1,%rsi
+  800d7d:	48 83 ea 01          	sub    $0x1,%rdx
+  800d81:	75 e7                	jne    800d6a <strncmp+0x5>
+
+    if (!n) return 0;
+  800d83:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d88:	c3                   	ret
+  800d89:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d8e:	c3                   	ret
+  800d8f:	48 85 d2             	test   %rdx,%rdx
+  800d92:	74 09                	je     800d9d <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d94:	0f b6 07             	movzbl (%rdi),%eax
+  800d97:	0f b6 16             	movzbl (%rsi),%edx
+  800d9a:	29 d0                	sub    %edx,%eax
+  800d9c:	c3                   	ret
+    if (!n) return 0;
+  800d9d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800da2:	c3                   	ret
+
+0000000000800da3 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800da3:	0f b6 17             	movzbl (%rdi),%edx
+  800da6:	84 d2                	test   %dl,%dl
+  800da8:	74 18                	je     800dc2 <strchr+0x1f>
+        if (*str == c) {
+  800daa:	0f be d2             	movsbl %dl,%edx
+  800dad:	39 f2                	cmp    %esi,%edx
+  800daf:	74 17                	je     800dc8 <strchr+0x25>
+    for (; *str; str++) {
+  800db1:	48 83 c7 01          	add    $0x1,%rdi
+  800db5:	0f b6 17             	movzbl (%rdi),%edx
+  800db8:	84 d2                	test   %dl,%dl
+  800dba:	75 ee                	jne    800daa <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800dbc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dc1:	c3                   	ret
+  800dc2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dc7:	c3                   	ret
+  800dc8:	48 89 f8             	mov    %rdi,%rax
+}
+  800dcb:	c3                   	ret
+
+0000000000800dcc <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800dcc:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800dcf:	0f b6 17             	movzbl (%rdi),%edx
+  800dd2:	84 d2                	test   %dl,%dl
+  800dd4:	74 13                	je     800de9 <strfind+0x1d>
+  800dd6:	0f be d2             	movsbl %dl,%edx
+  800dd9:	39 f2                	cmp    %esi,%edx
+  800ddb:	74 0b                	je     800de8 <strfind+0x1c>
+  800ddd:	48 83 c0 01          	add    $0x1,%rax
+  800de1:	0f b6 10             	movzbl (%rax),%edx
+  800de4:	84 d2                	test   %dl,%dl
+  800de6:	75 ee                	jne    800dd6 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800de8:	c3                   	ret
+  800de9:	c3                   	ret
+
+0000000000800dea <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800dea:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800ded:	48 89 f8             	mov    %rdi,%rax
+  800df0:	48 f7 d8             	neg    %rax
+  800df3:	83 e0 07             	and    $0x7,%eax
+  800df6:	49 89 d1             	mov    %rdx,%r9
+  800df9:	49 29 c1             	sub    %rax,%r9
+  800dfc:	78 36                	js     800e34 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800dfe:	40 0f b6 c6          	movzbl %sil,%eax
+  800e02:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800e09:	01 01 01 
+  800e0c:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800e10:	40 f6 c7 07          	test   $0x7,%dil
+  800e14:	75 38                	jne    800e4e <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800e16:	4c 89 c9             	mov    %r9,%rcx
+  800e19:	48 c1 f9 03          	sar    $0x3,%rcx
+  800e1d:	74 0c                	je     800e2b <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800e1f:	fc                   	cld
+  800e20:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800e23:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800e27:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800e2b:	4d 85 c9             	test   %r9,%r9
+  800e2e:	75 45                	jne    800e75 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800e30:	4c 89 c0             	mov    %r8,%rax
+  800e33:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800e34:	48 85 d2             	test   %rdx,%rdx
+  800e37:	74 f7                	je     800e30 <memset+0x46>
+  800e39:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800e3c:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800e3f:	48 83 c0 01          	add    $0x1,%rax
+  800e43:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800e47:	48 39 c2             	cmp    %rax,%rdx
+  800e4a:	75 f3                	jne    800e3f <memset+0x55>
+  800e4c:	eb e2                	jmp    800e30 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800e4e:	40 f6 c7 01          	test   $0x1,%dil
+  800e52:	74 06                	je     800e5a <memset+0x70>
+  800e54:	88 07                	mov    %al,(%rdi)
+  800e56:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e5a:	40 f6 c7 02          	test   $0x2,%dil
+  800e5e:	74 07                	je     800e67 <memset+0x7d>
+  800e60:	66 89 07             	mov    %ax,(%rdi)
+  800e63:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e67:	40 f6 c7 04          	test   $0x4,%dil
+  800e6b:	74 a9                	je     800e16 <memset+0x2c>
+  800e6d:	89 07                	mov    %eax,(%rdi)
+  800e6f:	48 83 c7 04          	add    $0x4,%rdi
+  800e73:	eb a1                	jmp    800e16 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e75:	41 f6 c1 04          	test   $0x4,%r9b
+  800e79:	74 06                	je     800e81 <memset+0x97>
+  800e7b:	89 07                	mov    %eax,(%rdi)
+  800e7d:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e81:	41 f6 c1 02          	test   $0x2,%r9b
+  800e85:	74 07                	je     800e8e <memset+0xa4>
+  800e87:	66 89 07             	mov    %ax,(%rdi)
+  800e8a:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800e8e:	41 f6 c1 01          	test   $0x1,%r9b
+  800e92:	74 9c                	je     800e30 <memset+0x46>
+  800e94:	88 07                	mov    %al,(%rdi)
+  800e96:	eb 98                	jmp    800e30 <memset+0x46>
+
+0000000000800e98 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800e98:	48 89 f8             	mov    %rdi,%rax
+  800e9b:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800e9e:	48 39 fe             	cmp    %rdi,%rsi
+  800ea1:	73 3b                	jae    800ede <memmove+0x46>
+  800ea3:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800ea7:	48 39 d7             	cmp    %rdx,%rdi
+  800eaa:	73 32                	jae    800ede <memmove+0x46>
+        s += n;
+        d += n;
+  800eac:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800eb0:	48 89 d6             	mov    %rdx,%rsi
+  800eb3:	48 09 fe             	or     %rdi,%rsi
+  800eb6:	48 09 ce             	or     %rcx,%rsi
+  800eb9:	40 f6 c6 07          	test   $0x7,%sil
+  800ebd:	75 12                	jne    800ed1 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800ebf:	48 83 ef 08          	sub    $0x8,%rdi
+  800ec3:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800ec7:	48 c1 e9 03          	shr    $0x3,%rcx
+  800ecb:	fd                   	std
+  800ecc:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800ecf:	fc                   	cld
+  800ed0:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800ed1:	48 83 ef 01          	sub    $0x1,%rdi
+  800ed5:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800ed9:	fd                   	std
+  800eda:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800edc:	eb f1                	jmp    800ecf <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800ede:	48 89 f2             	mov    %rsi,%rdx
+  800ee1:	48 09 c2             	or     %rax,%rdx
+  800ee4:	48 09 ca             	or     %rcx,%rdx
+  800ee7:	f6 c2 07             	test   $0x7,%dl
+  800eea:	75 0c                	jne    800ef8 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800eec:	48 c1 e9 03          	shr    $0x3,%rcx
+  800ef0:	48 89 c7             	mov    %rax,%rdi
+  800ef3:	fc                   	cld
+  800ef4:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800ef7:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800ef8:	48 89 c7             	mov    %rax,%rdi
+  800efb:	fc                   	cld
+  800efc:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800efe:	c3                   	ret
+
+0000000000800eff <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800eff:	55                   	push   %rbp
+  800f00:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800f03:	48 b8 98 0e 80 00 00 	movabs $0x800e98,%rax
+  800f0a:	00 00 00 
+  800f0d:	ff d0                	call   *%rax
+}
+  800f0f:	5d                   	pop    %rbp
+  800f10:	c3                   	ret
+
+0000000000800f11 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800f11:	55                   	push   %rbp
+  800f12:	48 89 e5             	mov    %rsp,%rbp
+  800f15:	41 57                	push   %r15
+  800f17:	41 56                	push   %r14
+  800f19:	41 55                	push   %r13
+  800f1b:	41 54                	push   %r12
+  800f1d:	53                   	push   %rbx
+  800f1e:	48 83 ec 08          	sub    $0x8,%rsp
+  800f22:	49 89 fe             	mov    %rdi,%r14
+  800f25:	49 89 f7             	mov    %rsi,%r15
+  800f28:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800f2b:	48 89 f7             	mov    %rsi,%rdi
+  800f2e:	48 b8 60 0c 80 00 00 	movabs $0x800c60,%rax
+  800f35:	00 00 00 
+  800f38:	ff d0                	call   *%rax
+  800f3a:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800f3d:	48 89 de             	mov    %rbx,%rsi
+  800f40:	4c 89 f7             	mov    %r14,%rdi
+  800f43:	48 b8 7b 0c 80 00 00 	movabs $0x800c7b,%rax
+  800f4a:	00 00 00 
+  800f4d:	ff d0                	call   *%rax
+  800f4f:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f52:	48 39 c3             	cmp    %rax,%rbx
+  800f55:	74 36                	je     800f8d <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800f57:	48 89 d8             	mov    %rbx,%rax
+  800f5a:	4c 29 e8             	sub    %r13,%rax
+  800f5d:	49 39 c4             	cmp    %rax,%r12
+  800f60:	73 31                	jae    800f93 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800f62:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800f67:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f6b:	4c 89 fe             	mov    %r15,%rsi
+  800f6e:	48 b8 ff 0e 80 00 00 	movabs $0x800eff,%rax
+  800f75:	00 00 00 
+  800f78:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800f7a:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800f7e:	48 83 c4 08          	add    $0x8,%rsp
+  800f82:	5b                   	pop    %rbx
+  800f83:	41 5c                	pop    %r12
+  800f85:	41 5d                	pop    %r13
+  800f87:	41 5e                	pop    %r14
+  800f89:	41 5f                	pop    %r15
+  800f8b:	5d                   	pop    %rbp
+  800f8c:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f8d:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800f91:	eb eb                	jmp    800f7e <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800f93:	48 83 eb 01          	sub    $0x1,%rbx
+  800f97:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f9b:	48 89 da             	mov    %rbx,%rdx
+  800f9e:	4c 89 fe             	mov    %r15,%rsi
+  800fa1:	48 b8 ff 0e 80 00 00 	movabs $0x800eff,%rax
+  800fa8:	00 00 00 
+  800fab:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800fad:	49 01 de             	add    %rbx,%r14
+  800fb0:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800fb5:	eb c3                	jmp    800f7a <strlcat+0x69>
+
+0000000000800fb7 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800fb7:	48 85 d2             	test   %rdx,%rdx
+  800fba:	74 2d                	je     800fe9 <memcmp+0x32>
+  800fbc:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800fc1:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800fc5:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800fca:	44 38 c1             	cmp    %r8b,%cl
+  800fcd:	75 0f                	jne    800fde <memcmp+0x27>
+    while (n-- > 0) {
+  800fcf:	48 83 c0 01          	add    $0x1,%rax
+  800fd3:	48 39 c2             	cmp    %rax,%rdx
+  800fd6:	75 e9                	jne    800fc1 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800fd8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fdd:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800fde:	0f b6 c1             	movzbl %cl,%eax
+  800fe1:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800fe5:	44 29 c0             	sub    %r8d,%eax
+  800fe8:	c3                   	ret
+    return 0;
+  800fe9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fee:	c3                   	ret
+
+0000000000800fef <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800fef:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800ff3:	48 39 c7             	cmp    %rax,%rdi
+  800ff6:	73 0f                	jae    801007 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800ff8:	40 38 37             	cmp    %sil,(%rdi)
+  800ffb:	74 0e                	je     80100b <memfind+0x1c>
+    for (; src < end; src++) {
+  800ffd:	48 83 c7 01          	add    $0x1,%rdi
+  801001:	48 39 f8             	cmp    %rdi,%rax
+  801004:	75 f2                	jne    800ff8 <memfind+0x9>
+  801006:	c3                   	ret
+  801007:	48 89 f8             	mov    %rdi,%rax
+  80100a:	c3                   	ret
+  80100b:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80100e:	c3                   	ret
+
+000000000080100f <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80100f:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801012:	0f b6 37             	movzbl (%rdi),%esi
+  801015:	40 80 fe 20          	cmp    $0x20,%sil
+  801019:	74 06                	je     801021 <strtol+0x12>
+  80101b:	40 80 fe 09          	cmp    $0x9,%sil
+  80101f:	75 13                	jne    801034 <strtol+0x25>
+  801021:	48 83 c7 01          	add    $0x1,%rdi
+  801025:	0f b6 37             	movzbl (%rdi),%esi
+  801028:	40 80 fe 20          	cmp    $0x20,%sil
+  80102c:	74 f3                	je     801021 <strtol+0x12>
+  80102e:	40 80 fe 09          	cmp    $0x9,%sil
+  801032:	74 ed                	je     801021 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801034:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801037:	83 e0 fd             	and    $0xfffffffd,%eax
+  80103a:	3c 01                	cmp    $0x1,%al
+  80103c:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801040:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801046:	75 0f                	jne    801057 <strtol+0x48>
+  801048:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80104b:	74 14                	je     801061 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80104d:	85 d2                	test   %edx,%edx
+  80104f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801054:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801057:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80105c:	4c 63 ca             	movslq %edx,%r9
+  80105f:	eb 36                	jmp    801097 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801061:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801065:	74 0f                	je     801076 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801067:	85 d2                	test   %edx,%edx
+  801069:	75 ec                	jne    801057 <strtol+0x48>
+        s++;
+  80106b:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80106f:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801074:	eb e1                	jmp    801057 <strtol+0x48>
+        s += 2;
+  801076:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80107a:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80107f:	eb d6                	jmp    801057 <strtol+0x48>
+            dig -= '0';
+  801081:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801084:	44 0f b6 c1          	movzbl %cl,%r8d
+  801088:	41 39 d0             	cmp    %edx,%r8d
+  80108b:	7d 21                	jge    8010ae <strtol+0x9f>
+        val = val * base + dig;
+  80108d:	49 0f af c1          	imul   %r9,%rax
+  801091:	0f b6 c9             	movzbl %cl,%ecx
+  801094:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801097:	48 83 c7 01          	add    $0x1,%rdi
+  80109b:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80109f:	80 f9 39             	cmp    $0x39,%cl
+  8010a2:	76 dd                	jbe    801081 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8010a4:	80 f9 7b             	cmp    $0x7b,%cl
+  8010a7:	77 05                	ja     8010ae <strtol+0x9f>
+            dig -= 'a' - 10;
+  8010a9:	83 e9 57             	sub    $0x57,%ecx
+  8010ac:	eb d6                	jmp    801084 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8010ae:	4d 85 d2             	test   %r10,%r10
+  8010b1:	74 03                	je     8010b6 <strtol+0xa7>
+  8010b3:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8010b6:	48 89 c2             	mov    %rax,%rdx
+  8010b9:	48 f7 da             	neg    %rdx
+  8010bc:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8010c0:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8010c4:	c3                   	ret
+
+00000000008010c5 <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  8010c5:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8010ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010cf:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8010d5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8010db:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  8010e1:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8010e3:	c3                   	ret
+
+00000000008010e4 <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  8010e4:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8010e9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010ee:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8010f3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010f8:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8010fe:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801104:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80110a:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80110c:	c3                   	ret
+
+000000000080110d <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80110d:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801110:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801115:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80111a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80111f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801125:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80112b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801131:	0f 05                	syscall
+    if (check && ret > 0) {
+  801133:	48 85 c0             	test   %rax,%rax
+  801136:	7f 01                	jg     801139 <sys_env_destroy+0x2c>
+}
+  801138:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  801139:	55                   	push   %rbp
+  80113a:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80113d:	49 89 c0             	mov    %rax,%r8
+  801140:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801145:	48 ba 98 4e 80 00 00 	movabs $0x804e98,%rdx
+  80114c:	00 00 00 
+  80114f:	be 29 00 00 00       	mov    $0x29,%esi
+  801154:	48 bf b7 4e 80 00 00 	movabs $0x804eb7,%rdi
+  80115b:	00 00 00 
+  80115e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801163:	49 b9 29 02 80 00 00 	movabs $0x800229,%r9
+  80116a:	00 00 00 
+  80116d:	41 ff d1             	call   *%r9
+
+0000000000801170 <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  801170:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801175:	bf 00 00 00 00       	mov    $0x0,%edi
+  80117a:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80117f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801184:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80118a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801190:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801196:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801198:	c3                   	ret
+
+0000000000801199 <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  801199:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80119e:	bf 00 00 00 00       	mov    $0x0,%edi
+  8011a3:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8011a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011ad:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8011b3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011b9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8011bf:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8011c1:	c3                   	ret
+
+00000000008011c2 <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  8011c2:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8011c7:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  8011ce:	00 00 00 
+  8011d1:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8011d7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011dd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8011e3:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8011e5:	c3                   	ret
+
+00000000008011e6 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8011e6:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  8011e9:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8011ee:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011f4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8011fa:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8011fc:	c3                   	ret
+
+00000000008011fd <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8011fd:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801200:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801205:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801208:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80120e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801214:	0f 05                	syscall
+    if (check && ret > 0) {
+  801216:	48 85 c0             	test   %rax,%rax
+  801219:	7f 01                	jg     80121c <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80121b:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80121c:	55                   	push   %rbp
+  80121d:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801220:	49 89 c0             	mov    %rax,%r8
+  801223:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801228:	48 ba 98 4e 80 00 00 	movabs $0x804e98,%rdx
+  80122f:	00 00 00 
+  801232:	be 29 00 00 00       	mov    $0x29,%esi
+  801237:	48 bf b7 4e 80 00 00 	movabs $0x804eb7,%rdi
+  80123e:	00 00 00 
+  801241:	b8 00 00 00 00       	mov    $0x0,%eax
+  801246:	49 b9 29 02 80 00 00 	movabs $0x800229,%r9
+  80124d:	00 00 00 
+  801250:	41 ff d1             	call   *%r9
+
+0000000000801253 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801253:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801256:	48 63 d2             	movslq %edx,%rdx
+  801259:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80125c:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801261:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  801264:	0f 05                	syscall
+    if (check && ret > 0) {
+  801266:	48 85 c0             	test   %rax,%rax
+  801269:	7f 01                	jg     80126c <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80126b:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80126c:	55                   	push   %rbp
+  80126d:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801270:	49 89 c0             	mov    %rax,%r8
+  801273:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801278:	48 ba 98 4e 80 00 00 	movabs $0x804e98,%rdx
+  80127f:	00 00 00 
+  801282:	be 29 00 00 00       	mov    $0x29,%esi
+  801287:	48 bf b7 4e 80 00 00 	movabs $0x804eb7,%rdi
+  80128e:	00 00 00 
+  801291:	b8 00 00 00 00       	mov    $0x0,%eax
+  801296:	49 b9 29 02 80 00 00 	movabs $0x800229,%r9
+  80129d:	00 00 00 
+  8012a0:	41 ff d1             	call   *%r9
+
+00000000008012a3 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8012a3:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8012a6:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8012ab:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8012b1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8012b7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8012bd:	0f 05                	syscall
+    if (check && ret > 0) {
+  8012bf:	48 85 c0             	test   %rax,%rax
+  8012c2:	7f 01                	jg     8012c5 <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8012c4:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8012c5:	55                   	push   %rbp
+  8012c6:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012c9:	49 89 c0             	mov    %rax,%r8
+  8012cc:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8012d1:	48 ba 98 4e 80 00 00 	movabs $0x804e98,%rdx
+  8012d8:	00 00 00 
+  8012db:	be 29 00 00 00       	mov    $0x29,%esi
+  8012e0:	48 bf b7 4e 80 00 00 	movabs $0x804eb7,%rdi
+  8012e7:	00 00 00 
+  8012ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012ef:	49 b9 29 02 80 00 00 	movabs $0x800229,%r9
+  8012f6:	00 00 00 
+  8012f9:	41 ff d1             	call   *%r9
+
+00000000008012fc <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8012fc:	48 63 f6             	movslq %esi,%rsi
+  8012ff:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801302:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801307:	ba 00 00 00 00       	mov    $0x0,%edx
+  80130c:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801312:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801318:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80131e:	0f 05                	syscall
+    if (check && ret > 0) {
+  801320:	48 85 c0             	test   %rax,%rax
+  801323:	7f 01                	jg     801326 <sys_env_set_status+0x2a>
+}
+  801325:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  801326:	55                   	push   %rbp
+  801327:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80132a:	49 89 c0             	mov    %rax,%r8
+  80132d:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801332:	48 ba 98 4e 80 00 00 	movabs $0x804e98,%rdx
+  801339:	00 00 00 
+  80133c:	be 29 00 00 00       	mov    $0x29,%esi
+  801341:	48 bf b7 4e 80 00 00 	movabs $0x804eb7,%rdi
+  801348:	00 00 00 
+  80134b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801350:	49 b9 29 02 80 00 00 	movabs $0x800229,%r9
+  801357:	00 00 00 
+  80135a:	41 ff d1             	call   *%r9
+
+000000000080135d <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80135d:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801360:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801365:	ba 00 00 00 00       	mov    $0x0,%edx
+  80136a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801370:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801376:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80137c:	0f 05                	syscall
+    if (check && ret > 0) {
+  80137e:	48 85 c0             	test   %rax,%rax
+  801381:	7f 01                	jg     801384 <sys_env_set_trapframe+0x27>
+}
+  801383:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801384:	55                   	push   %rbp
+  801385:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801388:	49 89 c0             	mov    %rax,%r8
+  80138b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801390:	48 ba 98 4e 80 00 00 	movabs $0x804e98,%rdx
+  801397:	00 00 00 
+  80139a:	be 29 00 00 00       	mov    $0x29,%esi
+  80139f:	48 bf b7 4e 80 00 00 	movabs $0x804eb7,%rdi
+  8013a6:	00 00 00 
+  8013a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013ae:	49 b9 29 02 80 00 00 	movabs $0x800229,%r9
+  8013b5:	00 00 00 
+  8013b8:	41 ff d1             	call   *%r9
+
+00000000008013bb <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8013bb:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8013be:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8013c3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013c8:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013ce:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013d4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013da:	0f 05                	syscall
+    if (check && ret > 0) {
+  8013dc:	48 85 c0             	test   %rax,%rax
+  8013df:	7f 01                	jg     8013e2 <sys_env_set_pgfault_upcall+0x27>
+}
+  8013e1:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8013e2:	55                   	push   %rbp
+  8013e3:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013e6:	49 89 c0             	mov    %rax,%r8
+  8013e9:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8013ee:	48 ba 98 4e 80 00 00 	movabs $0x804e98,%rdx
+  8013f5:	00 00 00 
+  8013f8:	be 29 00 00 00       	mov    $0x29,%esi
+  8013fd:	48 bf b7 4e 80 00 00 	movabs $0x804eb7,%rdi
+  801404:	00 00 00 
+  801407:	b8 00 00 00 00       	mov    $0x0,%eax
+  80140c:	49 b9 29 02 80 00 00 	movabs $0x800229,%r9
+  801413:	00 00 00 
+  801416:	41 ff d1             	call   *%r9
+
+0000000000801419 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801419:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80141c:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80141f:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801424:	4d 63 c0             	movslq %r8d,%r8
+  801427:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80142d:	0f 05                	syscall
+}
+  80142f:	c3                   	ret
+
+0000000000801430 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801430:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801433:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801436:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80143b:	4d 63 c0             	movslq %r8d,%r8
+  80143e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801444:	0f 05                	syscall
+}
+  801446:	c3                   	ret
+
+0000000000801447 <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  801447:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80144c:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80144f:	45 89 c0             	mov    %r8d,%r8d
+  801452:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801458:	0f 05                	syscall
+    if (check && ret > 0) {
+  80145a:	48 85 c0             	test   %rax,%rax
+  80145d:	7f 01                	jg     801460 <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80145f:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  801460:	55                   	push   %rbp
+  801461:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801464:	49 89 c0             	mov    %rax,%r8
+  801467:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  80146c:	48 ba 98 4e 80 00 00 	movabs $0x804e98,%rdx
+  801473:	00 00 00 
+  801476:	be 29 00 00 00       	mov    $0x29,%esi
+  80147b:	48 bf b7 4e 80 00 00 	movabs $0x804eb7,%rdi
+  801482:	00 00 00 
+  801485:	b8 00 00 00 00       	mov    $0x0,%eax
+  80148a:	49 b9 29 02 80 00 00 	movabs $0x800229,%r9
+  801491:	00 00 00 
+  801494:	41 ff d1             	call   *%r9
+
+0000000000801497 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  801497:	55                   	push   %rbp
+  801498:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  80149b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014a1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014ab:	48 b8 47 14 80 00 00 	movabs $0x801447,%rax
+  8014b2:	00 00 00 
+  8014b5:	ff d0                	call   *%rax
+}
+  8014b7:	5d                   	pop    %rbp
+  8014b8:	c3                   	ret
+
+00000000008014b9 <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  8014b9:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8014be:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014c3:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8014c8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014cd:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014d3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014d9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8014df:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8014e1:	c3                   	ret
+
+00000000008014e2 <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  8014e2:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8014e7:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8014ec:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014f1:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014f7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014fd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801503:	0f 05                	syscall
+    if (check && ret > 0) {
+  801505:	48 85 c0             	test   %rax,%rax
+  801508:	7f 01                	jg     80150b <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  80150a:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  80150b:	55                   	push   %rbp
+  80150c:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80150f:	49 89 c0             	mov    %rax,%r8
+  801512:	b9 10 00 00 00       	mov    $0x10,%ecx
+  801517:	48 ba 98 4e 80 00 00 	movabs $0x804e98,%rdx
+  80151e:	00 00 00 
+  801521:	be 29 00 00 00       	mov    $0x29,%esi
+  801526:	48 bf b7 4e 80 00 00 	movabs $0x804eb7,%rdi
+  80152d:	00 00 00 
+  801530:	b8 00 00 00 00       	mov    $0x0,%eax
+  801535:	49 b9 29 02 80 00 00 	movabs $0x800229,%r9
+  80153c:	00 00 00 
+  80153f:	41 ff d1             	call   *%r9
+
+0000000000801542 <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  801542:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801547:	bf 00 00 00 00       	mov    $0x0,%edi
+  80154c:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801551:	ba 00 00 00 00       	mov    $0x0,%edx
+  801556:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80155c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801562:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801568:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  80156a:	c3                   	ret
+
+000000000080156b <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  80156b:	89 d2                	mov    %edx,%edx
+  80156d:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  80156f:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801574:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80157a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801580:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801586:	0f 05                	syscall
+}
+  801588:	c3                   	ret
+
+0000000000801589 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  801589:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  80158c:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801591:	ba 00 00 00 00       	mov    $0x0,%edx
+  801596:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80159c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8015a2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8015a8:	0f 05                	syscall
+}
+  8015aa:	c3                   	ret
+
+00000000008015ab <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  8015ab:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  8015ae:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8015b3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015b8:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8015be:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8015c4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8015ca:	0f 05                	syscall
+}
+  8015cc:	c3                   	ret
+
+00000000008015cd <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  8015cd:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8015d0:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8015d5:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8015da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015df:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8015e5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8015eb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8015f1:	0f 05                	syscall
+    if (check && ret > 0) {
+  8015f3:	48 85 c0             	test   %rax,%rax
+  8015f6:	7f 01                	jg     8015f9 <sys_irq_ack+0x2c>
+}
+  8015f8:	c3                   	ret
+sys_irq_ack(int irq) {
+  8015f9:	55                   	push   %rbp
+  8015fa:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015fd:	49 89 c0             	mov    %rax,%r8
+  801600:	b9 16 00 00 00       	mov    $0x16,%ecx
+  801605:	48 ba 98 4e 80 00 00 	movabs $0x804e98,%rdx
+  80160c:	00 00 00 
+  80160f:	be 29 00 00 00       	mov    $0x29,%esi
+  801614:	48 bf b7 4e 80 00 00 	movabs $0x804eb7,%rdi
+  80161b:	00 00 00 
+  80161e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801623:	49 b9 29 02 80 00 00 	movabs $0x800229,%r9
+  80162a:	00 00 00 
+  80162d:	41 ff d1             	call   *%r9
+
+0000000000801630 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  801630:	55                   	push   %rbp
+  801631:	48 89 e5             	mov    %rsp,%rbp
+  801634:	41 54                	push   %r12
+  801636:	53                   	push   %rbx
+    // LAB 9: Your code here
+    /* The child would write them out once more */
+    file_flush_buffers();
+  801637:	48 b8 64 30 80 00 00 	movabs $0x803064,%rax
+  80163e:	00 00 00 
+  801641:	ff d0                	call   *%rax
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("syscall"
+  801643:	b8 08 00 00 00       	mov    $0x8,%eax
+  801648:	0f 05                	syscall
+  80164a:	41 89 c4             	mov    %eax,%r12d
+
+	envid_t envid = sys_exofork();
+    if (envid < 0)
+  80164d:	85 c0                	test   %eax,%eax
+  80164f:	78 7e                	js     8016cf <fork+0x9f>
+        return envid;
+    if (envid == 0) {
+  801651:	0f 84 80 00 00 00    	je     8016d7 <fork+0xa7>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE) < 0) {
+  801657:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  80165d:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801664:	00 00 00 
+  801667:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80166c:	89 c2                	mov    %eax,%edx
+  80166e:	be 00 00 00 00       	mov    $0x0,%esi
+  801673:	bf 00 00 00 00       	mov    $0x0,%edi
+  801678:	48 b8 53 12 80 00 00 	movabs $0x801253,%rax
+  80167f:	00 00 00 
+  801682:	ff d0                	call   *%rax
+  801684:	85 c0                	test   %eax,%eax
+  801686:	0f 88 86 00 00 00    	js     801712 <fork+0xe2>
+		return -1;
+	}
+    if (sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall) < 0) {
+  80168c:	48 a1 08 00 81 00 00 	movabs 0x810008,%rax
+  801693:	00 00 00 
+  801696:	48 8b b0 28 01 00 00 	mov    0x128(%rax),%rsi
+  80169d:	44 89 e7             	mov    %r12d,%edi
+  8016a0:	48 b8 bb 13 80 00 00 	movabs $0x8013bb,%rax
+  8016a7:	00 00 00 
+  8016aa:	ff d0                	call   *%rax
+  8016ac:	85 c0                	test   %eax,%eax
+  8016ae:	78 6a                	js     80171a <fork+0xea>
+		return -1;
+	}
+    if (sys_env_set_status(envid, ENV_RUNNABLE) < 0) {
+  8016b0:	be 02 00 00 00       	mov    $0x2,%esi
+  8016b5:	44 89 e7             	mov    %r12d,%edi
+  8016b8:	48 b8 fc 12 80 00 00 	movabs $0x8012fc,%rax
+  8016bf:	00 00 00 
+  8016c2:	ff d0                	call   *%rax
+		return -1;
+  8016c4:	85 c0                	test   %eax,%eax
+  8016c6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8016cb:	44 0f 48 e0          	cmovs  %eax,%r12d
+	}
+    return envid;
+}
+  8016cf:	44 89 e0             	mov    %r12d,%eax
+  8016d2:	5b                   	pop    %rbx
+  8016d3:	41 5c                	pop    %r12
+  8016d5:	5d                   	pop    %rbp
+  8016d6:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  8016d7:	48 b8 70 11 80 00 00 	movabs $0x801170,%rax
+  8016de:	00 00 00 
+  8016e1:	ff d0                	call   *%rax
+  8016e3:	89 c2                	mov    %eax,%edx
+  8016e5:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  8016eb:	48 89 d0             	mov    %rdx,%rax
+  8016ee:	48 c1 e0 04          	shl    $0x4,%rax
+  8016f2:	48 29 d0             	sub    %rdx,%rax
+  8016f5:	48 c1 e0 05          	shl    $0x5,%rax
+  8016f9:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801700:	00 00 00 
+  801703:	48 01 d0             	add    %rdx,%rax
+  801706:	48 a3 08 00 81 00 00 	movabs %rax,0x810008
+  80170d:	00 00 00 
+        return 0;
+  801710:	eb bd                	jmp    8016cf <fork+0x9f>
+		return -1;
+  801712:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801718:	eb b5                	jmp    8016cf <fork+0x9f>
+		return -1;
+  80171a:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801720:	eb ad                	jmp    8016cf <fork+0x9f>
+
+0000000000801722 <sfork>:
+
+envid_t
+sfork() {
+  801722:	55                   	push   %rbp
+  801723:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  801726:	48 ba c5 4e 80 00 00 	movabs $0x804ec5,%rdx
+  80172d:	00 00 00 
+  801730:	be 2d 00 00 00       	mov    $0x2d,%esi
+  801735:	48 bf e0 4e 80 00 00 	movabs $0x804ee0,%rdi
+  80173c:	00 00 00 
+  80173f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801744:	48 b9 29 02 80 00 00 	movabs $0x800229,%rcx
+  80174b:	00 00 00 
+  80174e:	ff d1                	call   *%rcx
+
+0000000000801750 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801750:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801757:	ff ff ff 
+  80175a:	48 01 f8             	add    %rdi,%rax
+  80175d:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801761:	c3                   	ret
+
+0000000000801762 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801762:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801769:	ff ff ff 
+  80176c:	48 01 f8             	add    %rdi,%rax
+  80176f:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801773:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801779:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80177d:	c3                   	ret
+
+000000000080177e <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  80177e:	55                   	push   %rbp
+  80177f:	48 89 e5             	mov    %rsp,%rbp
+  801782:	41 57                	push   %r15
+  801784:	41 56                	push   %r14
+  801786:	41 55                	push   %r13
+  801788:	41 54                	push   %r12
+  80178a:	53                   	push   %rbx
+  80178b:	48 83 ec 08          	sub    $0x8,%rsp
+  80178f:	49 89 ff             	mov    %rdi,%r15
+  801792:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801797:	49 bd 0d 3f 80 00 00 	movabs $0x803f0d,%r13
+  80179e:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8017a1:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8017a7:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8017aa:	48 89 df             	mov    %rbx,%rdi
+  8017ad:	41 ff d5             	call   *%r13
+  8017b0:	83 e0 04             	and    $0x4,%eax
+  8017b3:	74 17                	je     8017cc <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8017b5:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8017bc:	4c 39 f3             	cmp    %r14,%rbx
+  8017bf:	75 e6                	jne    8017a7 <fd_alloc+0x29>
+  8017c1:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8017c7:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8017cc:	4d 89 27             	mov    %r12,(%r15)
+}
+  8017cf:	48 83 c4 08          	add    $0x8,%rsp
+  8017d3:	5b                   	pop    %rbx
+  8017d4:	41 5c                	pop    %r12
+  8017d6:	41 5d                	pop    %r13
+  8017d8:	41 5e                	pop    %r14
+  8017da:	41 5f                	pop    %r15
+  8017dc:	5d                   	pop    %rbp
+  8017dd:	c3                   	ret
+
+00000000008017de <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8017de:	83 ff 1f             	cmp    $0x1f,%edi
+  8017e1:	77 39                	ja     80181c <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8017e3:	55                   	push   %rbp
+  8017e4:	48 89 e5             	mov    %rsp,%rbp
+  8017e7:	41 54                	push   %r12
+  8017e9:	53                   	push   %rbx
+  8017ea:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8017ed:	48 63 df             	movslq %edi,%rbx
+  8017f0:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8017f7:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8017fb:	48 89 df             	mov    %rbx,%rdi
+  8017fe:	48 b8 0d 3f 80 00 00 	movabs $0x803f0d,%rax
+  801805:	00 00 00 
+  801808:	ff d0                	call   *%rax
+  80180a:	a8 04                	test   $0x4,%al
+  80180c:	74 14                	je     801822 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  80180e:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801812:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801817:	5b                   	pop    %rbx
+  801818:	41 5c                	pop    %r12
+  80181a:	5d                   	pop    %rbp
+  80181b:	c3                   	ret
+        return -E_INVAL;
+  80181c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801821:	c3                   	ret
+        return -E_INVAL;
+  801822:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801827:	eb ee                	jmp    801817 <fd_lookup+0x39>
+
+0000000000801829 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801829:	55                   	push   %rbp
+  80182a:	48 89 e5             	mov    %rsp,%rbp
+  80182d:	41 54                	push   %r12
+  80182f:	53                   	push   %rbx
+  801830:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801833:	48 b8 80 4f 80 00 00 	movabs $0x804f80,%rax
+  80183a:	00 00 00 
+  80183d:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  801844:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801847:	39 3b                	cmp    %edi,(%rbx)
+  801849:	74 47                	je     801892 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  80184b:	48 83 c0 08          	add    $0x8,%rax
+  80184f:	48 8b 18             	mov    (%rax),%rbx
+  801852:	48 85 db             	test   %rbx,%rbx
+  801855:	75 f0                	jne    801847 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801857:	48 a1 08 00 81 00 00 	movabs 0x810008,%rax
+  80185e:	00 00 00 
+  801861:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801867:	89 fa                	mov    %edi,%edx
+  801869:	48 bf f0 4e 80 00 00 	movabs $0x804ef0,%rdi
+  801870:	00 00 00 
+  801873:	b8 00 00 00 00       	mov    $0x0,%eax
+  801878:	48 b9 79 03 80 00 00 	movabs $0x800379,%rcx
+  80187f:	00 00 00 
+  801882:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801884:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801889:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  80188d:	5b                   	pop    %rbx
+  80188e:	41 5c                	pop    %r12
+  801890:	5d                   	pop    %rbp
+  801891:	c3                   	ret
+            return 0;
+  801892:	b8 00 00 00 00       	mov    $0x0,%eax
+  801897:	eb f0                	jmp    801889 <dev_lookup+0x60>
+
+0000000000801899 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801899:	55                   	push   %rbp
+  80189a:	48 89 e5             	mov    %rsp,%rbp
+  80189d:	41 55                	push   %r13
+  80189f:	41 54                	push   %r12
+  8018a1:	53                   	push   %rbx
+  8018a2:	48 83 ec 18          	sub    $0x18,%rsp
+  8018a6:	48 89 fb             	mov    %rdi,%rbx
+  8018a9:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8018ac:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8018b3:	ff ff ff 
+  8018b6:	48 01 df             	add    %rbx,%rdi
+  8018b9:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8018bd:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8018c1:	48 b8 de 17 80 00 00 	movabs $0x8017de,%rax
+  8018c8:	00 00 00 
+  8018cb:	ff d0                	call   *%rax
+  8018cd:	41 89 c5             	mov    %eax,%r13d
+  8018d0:	85 c0                	test   %eax,%eax
+  8018d2:	78 06                	js     8018da <fd_close+0x41>
+  8018d4:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8018d8:	74 1a                	je     8018f4 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8018da:	45 84 e4             	test   %r12b,%r12b
+  8018dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018e2:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8018e6:	44 89 e8             	mov    %r13d,%eax
+  8018e9:	48 83 c4 18          	add    $0x18,%rsp
+  8018ed:	5b                   	pop    %rbx
+  8018ee:	41 5c                	pop    %r12
+  8018f0:	41 5d                	pop    %r13
+  8018f2:	5d                   	pop    %rbp
+  8018f3:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8018f4:	8b 3b                	mov    (%rbx),%edi
+  8018f6:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8018fa:	48 b8 29 18 80 00 00 	movabs $0x801829,%rax
+  801901:	00 00 00 
+  801904:	ff d0                	call   *%rax
+  801906:	41 89 c5             	mov    %eax,%r13d
+  801909:	85 c0                	test   %eax,%eax
+  80190b:	78 1b                	js     801928 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  80190d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801911:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801915:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80191b:	48 85 c0             	test   %rax,%rax
+  80191e:	74 08                	je     801928 <fd_close+0x8f>
+  801920:	48 89 df             	mov    %rbx,%rdi
+  801923:	ff d0                	call   *%rax
+  801925:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801928:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80192d:	48 89 de             	mov    %rbx,%rsi
+  801930:	bf 00 00 00 00       	mov    $0x0,%edi
+  801935:	48 b8 a3 12 80 00 00 	movabs $0x8012a3,%rax
+  80193c:	00 00 00 
+  80193f:	ff d0                	call   *%rax
+    return res;
+  801941:	eb a3                	jmp    8018e6 <fd_close+0x4d>
+
+0000000000801943 <close>:
+
+int
+close(int fdnum) {
+  801943:	55                   	push   %rbp
+  801944:	48 89 e5             	mov    %rsp,%rbp
+  801947:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80194b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80194f:	48 b8 de 17 80 00 00 	movabs $0x8017de,%rax
+  801956:	00 00 00 
+  801959:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80195b:	85 c0                	test   %eax,%eax
+  80195d:	78 15                	js     801974 <close+0x31>
+
+    return fd_close(fd, 1);
+  80195f:	be 01 00 00 00       	mov    $0x1,%esi
+  801964:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801968:	48 b8 99 18 80 00 00 	movabs $0x801899,%rax
+  80196f:	00 00 00 
+  801972:	ff d0                	call   *%rax
+}
+  801974:	c9                   	leave
+  801975:	c3                   	ret
+
+0000000000801976 <close_all>:
+
+void
+close_all(void) {
+  801976:	55                   	push   %rbp
+  801977:	48 89 e5             	mov    %rsp,%rbp
+  80197a:	41 54                	push   %r12
+  80197c:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  80197d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801982:	49 bc 43 19 80 00 00 	movabs $0x801943,%r12
+  801989:	00 00 00 
+  80198c:	89 df                	mov    %ebx,%edi
+  80198e:	41 ff d4             	call   *%r12
+  801991:	83 c3 01             	add    $0x1,%ebx
+  801994:	83 fb 20             	cmp    $0x20,%ebx
+  801997:	75 f3                	jne    80198c <close_all+0x16>
+}
+  801999:	5b                   	pop    %rbx
+  80199a:	41 5c                	pop    %r12
+  80199c:	5d                   	pop    %rbp
+  80199d:	c3                   	ret
+
+000000000080199e <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  80199e:	55                   	push   %rbp
+  80199f:	48 89 e5             	mov    %rsp,%rbp
+  8019a2:	41 57                	push   %r15
+  8019a4:	41 56                	push   %r14
+  8019a6:	41 55                	push   %r13
+  8019a8:	41 54                	push   %r12
+  8019aa:	53                   	push   %rbx
+  8019ab:	48 83 ec 18          	sub    $0x18,%rsp
+  8019af:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8019b2:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8019b6:	48 b8 de 17 80 00 00 	movabs $0x8017de,%rax
+  8019bd:	00 00 00 
+  8019c0:	ff d0                	call   *%rax
+  8019c2:	89 c3                	mov    %eax,%ebx
+  8019c4:	85 c0                	test   %eax,%eax
+  8019c6:	0f 88 b8 00 00 00    	js     801a84 <dup+0xe6>
+    close(newfdnum);
+  8019cc:	44 89 e7             	mov    %r12d,%edi
+  8019cf:	48 b8 43 19 80 00 00 	movabs $0x801943,%rax
+  8019d6:	00 00 00 
+  8019d9:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8019db:	4d 63 ec             	movslq %r12d,%r13
+  8019de:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8019e5:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8019e9:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8019ed:	4c 89 ff             	mov    %r15,%rdi
+  8019f0:	49 be 62 17 80 00 00 	movabs $0x801762,%r14
+  8019f7:	00 00 00 
+  8019fa:	41 ff d6             	call   *%r14
+  8019fd:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801a00:	4c 89 ef             	mov    %r13,%rdi
+  801a03:	41 ff d6             	call   *%r14
+  801a06:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801a09:	48 89 df             	mov    %rbx,%rdi
+  801a0c:	48 b8 0d 3f 80 00 00 	movabs $0x803f0d,%rax
+  801a13:	00 00 00 
+  801a16:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801a18:	a8 04                	test   $0x4,%al
+  801a1a:	74 2b                	je     801a47 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801a1c:	41 89 c1             	mov    %eax,%r9d
+  801a1f:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801a25:	4c 89 f1             	mov    %r14,%rcx
+  801a28:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a2d:	48 89 de             	mov    %rbx,%rsi
+  801a30:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a35:	48 b8 53 12 80 00 00 	movabs $0x801253,%rax
+  801a3c:	00 00 00 
+  801a3f:	ff d0                	call   *%rax
+  801a41:	89 c3                	mov    %eax,%ebx
+  801a43:	85 c0                	test   %eax,%eax
+  801a45:	78 4e                	js     801a95 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801a47:	4c 89 ff             	mov    %r15,%rdi
+  801a4a:	48 b8 0d 3f 80 00 00 	movabs $0x803f0d,%rax
+  801a51:	00 00 00 
+  801a54:	ff d0                	call   *%rax
+  801a56:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801a59:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801a5f:	4c 89 e9             	mov    %r13,%rcx
+  801a62:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a67:	4c 89 fe             	mov    %r15,%rsi
+  801a6a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a6f:	48 b8 53 12 80 00 00 	movabs $0x801253,%rax
+  801a76:	00 00 00 
+  801a79:	ff d0                	call   *%rax
+  801a7b:	89 c3                	mov    %eax,%ebx
+  801a7d:	85 c0                	test   %eax,%eax
+  801a7f:	78 14                	js     801a95 <dup+0xf7>
+
+    return newfdnum;
+  801a81:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801a84:	89 d8                	mov    %ebx,%eax
+  801a86:	48 83 c4 18          	add    $0x18,%rsp
+  801a8a:	5b                   	pop    %rbx
+  801a8b:	41 5c                	pop    %r12
+  801a8d:	41 5d                	pop    %r13
+  801a8f:	41 5e                	pop    %r14
+  801a91:	41 5f                	pop    %r15
+  801a93:	5d                   	pop    %rbp
+  801a94:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801a95:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a9a:	4c 89 ee             	mov    %r13,%rsi
+  801a9d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801aa2:	49 bc a3 12 80 00 00 	movabs $0x8012a3,%r12
+  801aa9:	00 00 00 
+  801aac:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801aaf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ab4:	4c 89 f6             	mov    %r14,%rsi
+  801ab7:	bf 00 00 00 00       	mov    $0x0,%edi
+  801abc:	41 ff d4             	call   *%r12
+    return res;
+  801abf:	eb c3                	jmp    801a84 <dup+0xe6>
+
+0000000000801ac1 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801ac1:	55                   	push   %rbp
+  801ac2:	48 89 e5             	mov    %rsp,%rbp
+  801ac5:	41 56                	push   %r14
+  801ac7:	41 55                	push   %r13
+  801ac9:	41 54                	push   %r12
+  801acb:	53                   	push   %rbx
+  801acc:	48 83 ec 10          	sub    $0x10,%rsp
+  801ad0:	89 fb                	mov    %edi,%ebx
+  801ad2:	49 89 f4             	mov    %rsi,%r12
+  801ad5:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ad8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801adc:	48 b8 de 17 80 00 00 	movabs $0x8017de,%rax
+  801ae3:	00 00 00 
+  801ae6:	ff d0                	call   *%rax
+  801ae8:	85 c0                	test   %eax,%eax
+  801aea:	78 4c                	js     801b38 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801aec:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801af0:	41 8b 3e             	mov    (%r14),%edi
+  801af3:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801af7:	48 b8 29 18 80 00 00 	movabs $0x801829,%rax
+  801afe:	00 00 00 
+  801b01:	ff d0                	call   *%rax
+  801b03:	85 c0                	test   %eax,%eax
+  801b05:	78 35                	js     801b3c <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801b07:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801b0b:	83 e0 03             	and    $0x3,%eax
+  801b0e:	83 f8 01             	cmp    $0x1,%eax
+  801b11:	74 2d                	je     801b40 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801b13:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b17:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801b1b:	48 85 c0             	test   %rax,%rax
+  801b1e:	74 56                	je     801b76 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801b20:	4c 89 ea             	mov    %r13,%rdx
+  801b23:	4c 89 e6             	mov    %r12,%rsi
+  801b26:	4c 89 f7             	mov    %r14,%rdi
+  801b29:	ff d0                	call   *%rax
+}
+  801b2b:	48 83 c4 10          	add    $0x10,%rsp
+  801b2f:	5b                   	pop    %rbx
+  801b30:	41 5c                	pop    %r12
+  801b32:	41 5d                	pop    %r13
+  801b34:	41 5e                	pop    %r14
+  801b36:	5d                   	pop    %rbp
+  801b37:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b38:	48 98                	cltq
+  801b3a:	eb ef                	jmp    801b2b <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b3c:	48 98                	cltq
+  801b3e:	eb eb                	jmp    801b2b <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b40:	48 a1 08 00 81 00 00 	movabs 0x810008,%rax
+  801b47:	00 00 00 
+  801b4a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801b50:	89 da                	mov    %ebx,%edx
+  801b52:	48 bf 31 4f 80 00 00 	movabs $0x804f31,%rdi
+  801b59:	00 00 00 
+  801b5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b61:	48 b9 79 03 80 00 00 	movabs $0x800379,%rcx
+  801b68:	00 00 00 
+  801b6b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801b6d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801b74:	eb b5                	jmp    801b2b <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801b76:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801b7d:	eb ac                	jmp    801b2b <read+0x6a>
+
+0000000000801b7f <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801b7f:	55                   	push   %rbp
+  801b80:	48 89 e5             	mov    %rsp,%rbp
+  801b83:	41 57                	push   %r15
+  801b85:	41 56                	push   %r14
+  801b87:	41 55                	push   %r13
+  801b89:	41 54                	push   %r12
+  801b8b:	53                   	push   %rbx
+  801b8c:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801b90:	48 85 d2             	test   %rdx,%rdx
+  801b93:	74 54                	je     801be9 <readn+0x6a>
+  801b95:	41 89 fd             	mov    %edi,%r13d
+  801b98:	49 89 f6             	mov    %rsi,%r14
+  801b9b:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801b9e:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801ba3:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801ba8:	49 bf c1 1a 80 00 00 	movabs $0x801ac1,%r15
+  801baf:	00 00 00 
+  801bb2:	4c 89 e2             	mov    %r12,%rdx
+  801bb5:	48 29 f2             	sub    %rsi,%rdx
+  801bb8:	4c 01 f6             	add    %r14,%rsi
+  801bbb:	44 89 ef             	mov    %r13d,%edi
+  801bbe:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801bc1:	85 c0                	test   %eax,%eax
+  801bc3:	78 20                	js     801be5 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801bc5:	01 c3                	add    %eax,%ebx
+  801bc7:	85 c0                	test   %eax,%eax
+  801bc9:	74 08                	je     801bd3 <readn+0x54>
+  801bcb:	48 63 f3             	movslq %ebx,%rsi
+  801bce:	4c 39 e6             	cmp    %r12,%rsi
+  801bd1:	72 df                	jb     801bb2 <readn+0x33>
+    }
+    return res;
+  801bd3:	48 63 c3             	movslq %ebx,%rax
+}
+  801bd6:	48 83 c4 08          	add    $0x8,%rsp
+  801bda:	5b                   	pop    %rbx
+  801bdb:	41 5c                	pop    %r12
+  801bdd:	41 5d                	pop    %r13
+  801bdf:	41 5e                	pop    %r14
+  801be1:	41 5f                	pop    %r15
+  801be3:	5d                   	pop    %rbp
+  801be4:	c3                   	ret
+        if (inc < 0) return inc;
+  801be5:	48 98                	cltq
+  801be7:	eb ed                	jmp    801bd6 <readn+0x57>
+    int inc = 1, res = 0;
+  801be9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bee:	eb e3                	jmp    801bd3 <readn+0x54>
+
+0000000000801bf0 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801bf0:	55                   	push   %rbp
+  801bf1:	48 89 e5             	mov    %rsp,%rbp
+  801bf4:	41 56                	push   %r14
+  801bf6:	41 55                	push   %r13
+  801bf8:	41 54                	push   %r12
+  801bfa:	53                   	push   %rbx
+  801bfb:	48 83 ec 10          	sub    $0x10,%rsp
+  801bff:	89 fb                	mov    %edi,%ebx
+  801c01:	49 89 f4             	mov    %rsi,%r12
+  801c04:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c07:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c0b:	48 b8 de 17 80 00 00 	movabs $0x8017de,%rax
+  801c12:	00 00 00 
+  801c15:	ff d0                	call   *%rax
+  801c17:	85 c0                	test   %eax,%eax
+  801c19:	78 47                	js     801c62 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c1b:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801c1f:	41 8b 3e             	mov    (%r14),%edi
+  801c22:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c26:	48 b8 29 18 80 00 00 	movabs $0x801829,%rax
+  801c2d:	00 00 00 
+  801c30:	ff d0                	call   *%rax
+  801c32:	85 c0                	test   %eax,%eax
+  801c34:	78 30                	js     801c66 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801c36:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801c3b:	74 2d                	je     801c6a <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801c3d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c41:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801c45:	48 85 c0             	test   %rax,%rax
+  801c48:	74 56                	je     801ca0 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801c4a:	4c 89 ea             	mov    %r13,%rdx
+  801c4d:	4c 89 e6             	mov    %r12,%rsi
+  801c50:	4c 89 f7             	mov    %r14,%rdi
+  801c53:	ff d0                	call   *%rax
+}
+  801c55:	48 83 c4 10          	add    $0x10,%rsp
+  801c59:	5b                   	pop    %rbx
+  801c5a:	41 5c                	pop    %r12
+  801c5c:	41 5d                	pop    %r13
+  801c5e:	41 5e                	pop    %r14
+  801c60:	5d                   	pop    %rbp
+  801c61:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c62:	48 98                	cltq
+  801c64:	eb ef                	jmp    801c55 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c66:	48 98                	cltq
+  801c68:	eb eb                	jmp    801c55 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c6a:	48 a1 08 00 81 00 00 	movabs 0x810008,%rax
+  801c71:	00 00 00 
+  801c74:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801c7a:	89 da                	mov    %ebx,%edx
+  801c7c:	48 bf 4d 4f 80 00 00 	movabs $0x804f4d,%rdi
+  801c83:	00 00 00 
+  801c86:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c8b:	48 b9 79 03 80 00 00 	movabs $0x800379,%rcx
+  801c92:	00 00 00 
+  801c95:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801c97:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801c9e:	eb b5                	jmp    801c55 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801ca0:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801ca7:	eb ac                	jmp    801c55 <write+0x65>
+
+0000000000801ca9 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801ca9:	55                   	push   %rbp
+  801caa:	48 89 e5             	mov    %rsp,%rbp
+  801cad:	41 54                	push   %r12
+  801caf:	53                   	push   %rbx
+  801cb0:	48 83 ec 10          	sub    $0x10,%rsp
+  801cb4:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801cb6:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801cba:	48 b8 de 17 80 00 00 	movabs $0x8017de,%rax
+  801cc1:	00 00 00 
+  801cc4:	ff d0                	call   *%rax
+  801cc6:	85 c0                	test   %eax,%eax
+  801cc8:	78 3e                	js     801d08 <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801cca:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801cce:	41 8b 3c 24          	mov    (%r12),%edi
+  801cd2:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801cd6:	48 b8 29 18 80 00 00 	movabs $0x801829,%rax
+  801cdd:	00 00 00 
+  801ce0:	ff d0                	call   *%rax
+  801ce2:	85 c0                	test   %eax,%eax
+  801ce4:	78 22                	js     801d08 <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  801ce6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801cea:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801cee:	48 85 c0             	test   %rax,%rax
+  801cf1:	74 0b                	je     801cfe <seek+0x55>
+  801cf3:	89 de                	mov    %ebx,%esi
+  801cf5:	4c 89 e7             	mov    %r12,%rdi
+  801cf8:	ff d0                	call   *%rax
+  801cfa:	85 c0                	test   %eax,%eax
+  801cfc:	78 0a                	js     801d08 <seek+0x5f>
+
+    fd->fd_offset = offset;
+  801cfe:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  801d03:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d08:	48 83 c4 10          	add    $0x10,%rsp
+  801d0c:	5b                   	pop    %rbx
+  801d0d:	41 5c                	pop    %r12
+  801d0f:	5d                   	pop    %rbp
+  801d10:	c3                   	ret
+
+0000000000801d11 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801d11:	55                   	push   %rbp
+  801d12:	48 89 e5             	mov    %rsp,%rbp
+  801d15:	41 55                	push   %r13
+  801d17:	41 54                	push   %r12
+  801d19:	53                   	push   %rbx
+  801d1a:	48 83 ec 18          	sub    $0x18,%rsp
+  801d1e:	89 fb                	mov    %edi,%ebx
+  801d20:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d23:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d27:	48 b8 de 17 80 00 00 	movabs $0x8017de,%rax
+  801d2e:	00 00 00 
+  801d31:	ff d0                	call   *%rax
+  801d33:	85 c0                	test   %eax,%eax
+  801d35:	78 38                	js     801d6f <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d37:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801d3b:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801d3f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d43:	48 b8 29 18 80 00 00 	movabs $0x801829,%rax
+  801d4a:	00 00 00 
+  801d4d:	ff d0                	call   *%rax
+  801d4f:	85 c0                	test   %eax,%eax
+  801d51:	78 1c                	js     801d6f <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d53:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801d58:	74 20                	je     801d7a <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801d5a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d5e:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801d62:	48 85 c0             	test   %rax,%rax
+  801d65:	74 47                	je     801dae <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801d67:	44 89 e6             	mov    %r12d,%esi
+  801d6a:	4c 89 ef             	mov    %r13,%rdi
+  801d6d:	ff d0                	call   *%rax
+}
+  801d6f:	48 83 c4 18          	add    $0x18,%rsp
+  801d73:	5b                   	pop    %rbx
+  801d74:	41 5c                	pop    %r12
+  801d76:	41 5d                	pop    %r13
+  801d78:	5d                   	pop    %rbp
+  801d79:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801d7a:	48 a1 08 00 81 00 00 	movabs 0x810008,%rax
+  801d81:	00 00 00 
+  801d84:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801d8a:	89 da                	mov    %ebx,%edx
+  801d8c:	48 bf 10 4f 80 00 00 	movabs $0x804f10,%rdi
+  801d93:	00 00 00 
+  801d96:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d9b:	48 b9 79 03 80 00 00 	movabs $0x800379,%rcx
+  801da2:	00 00 00 
+  801da5:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801da7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801dac:	eb c1                	jmp    801d6f <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801dae:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801db3:	eb ba                	jmp    801d6f <ftruncate+0x5e>
+
+0000000000801db5 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801db5:	55                   	push   %rbp
+  801db6:	48 89 e5             	mov    %rsp,%rbp
+  801db9:	41 54                	push   %r12
+  801dbb:	53                   	push   %rbx
+  801dbc:	48 83 ec 10          	sub    $0x10,%rsp
+  801dc0:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801dc3:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801dc7:	48 b8 de 17 80 00 00 	movabs $0x8017de,%rax
+  801dce:	00 00 00 
+  801dd1:	ff d0                	call   *%rax
+  801dd3:	85 c0                	test   %eax,%eax
+  801dd5:	78 4e                	js     801e25 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801dd7:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801ddb:	41 8b 3c 24          	mov    (%r12),%edi
+  801ddf:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801de3:	48 b8 29 18 80 00 00 	movabs $0x801829,%rax
+  801dea:	00 00 00 
+  801ded:	ff d0                	call   *%rax
+  801def:	85 c0                	test   %eax,%eax
+  801df1:	78 32                	js     801e25 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801df3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801df7:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801dfc:	74 30                	je     801e2e <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801dfe:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801e01:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801e08:	00 00 00 
+    stat->st_isdir = 0;
+  801e0b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801e12:	00 00 00 
+    stat->st_dev = dev;
+  801e15:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801e1c:	48 89 de             	mov    %rbx,%rsi
+  801e1f:	4c 89 e7             	mov    %r12,%rdi
+  801e22:	ff 50 28             	call   *0x28(%rax)
+}
+  801e25:	48 83 c4 10          	add    $0x10,%rsp
+  801e29:	5b                   	pop    %rbx
+  801e2a:	41 5c                	pop    %r12
+  801e2c:	5d                   	pop    %rbp
+  801e2d:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801e2e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801e33:	eb f0                	jmp    801e25 <fstat+0x70>
+
+0000000000801e35 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801e35:	55                   	push   %rbp
+  801e36:	48 89 e5             	mov    %rsp,%rbp
+  801e39:	41 54                	push   %r12
+  801e3b:	53                   	push   %rbx
+  801e3c:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801e3f:	be 00 00 00 00       	mov    $0x0,%esi
+  801e44:	48 b8 a3 2f 80 00 00 	movabs $0x802fa3,%rax
+  801e4b:	00 00 00 
+  801e4e:	ff d0                	call   *%rax
+  801e50:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801e52:	85 c0                	test   %eax,%eax
+  801e54:	78 25                	js     801e7b <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801e56:	4c 89 e6             	mov    %r12,%rsi
+  801e59:	89 c7                	mov    %eax,%edi
+  801e5b:	48 b8 b5 1d 80 00 00 	movabs $0x801db5,%rax
+  801e62:	00 00 00 
+  801e65:	ff d0                	call   *%rax
+  801e67:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801e6a:	89 df                	mov    %ebx,%edi
+  801e6c:	48 b8 43 19 80 00 00 	movabs $0x801943,%rax
+  801e73:	00 00 00 
+  801e76:	ff d0                	call   *%rax
+
+    return res;
+  801e78:	44 89 e3             	mov    %r12d,%ebx
+}
+  801e7b:	89 d8                	mov    %ebx,%eax
+  801e7d:	5b                   	pop    %rbx
+  801e7e:	41 5c                	pop    %r12
+  801e80:	5d                   	pop    %rbp
+  801e81:	c3                   	ret
+
+0000000000801e82 <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  801e82:	48 b8 08 00 82 00 00 	movabs $0x820008,%rax
+  801e89:	00 00 00 
+  801e8c:	83 38 00             	cmpl   $0x0,(%rax)
+  801e8f:	74 0a                	je     801e9b <fsenv+0x19>
+    return envid;
+}
+  801e91:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  801e98:	00 00 
+  801e9a:	c3                   	ret
+fsenv(void) {
+  801e9b:	55                   	push   %rbp
+  801e9c:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  801e9f:	bf 03 00 00 00       	mov    $0x3,%edi
+  801ea4:	48 b8 70 48 80 00 00 	movabs $0x804870,%rax
+  801eab:	00 00 00 
+  801eae:	ff d0                	call   *%rax
+  801eb0:	a3 08 00 82 00 00 00 	movabs %eax,0x820008
+  801eb7:	00 00 
+}
+  801eb9:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  801ec0:	00 00 
+  801ec2:	5d                   	pop    %rbp
+  801ec3:	c3                   	ret
+
+0000000000801ec4 <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  801ec4:	55                   	push   %rbp
+  801ec5:	48 89 e5             	mov    %rsp,%rbp
+  801ec8:	41 54                	push   %r12
+  801eca:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  801ecb:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801ed0:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801ed5:	48 89 de             	mov    %rbx,%rsi
+  801ed8:	bf 00 00 00 00       	mov    $0x0,%edi
+  801edd:	48 b8 a3 12 80 00 00 	movabs $0x8012a3,%rax
+  801ee4:	00 00 00 
+  801ee7:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  801ee9:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  801ef0:	00 00 00 
+  801ef3:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  801ef9:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801efe:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801f03:	48 89 de             	mov    %rbx,%rsi
+  801f06:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f0b:	48 b8 fd 11 80 00 00 	movabs $0x8011fd,%rax
+  801f12:	00 00 00 
+  801f15:	ff d0                	call   *%rax
+  801f17:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  801f19:	85 c0                	test   %eax,%eax
+  801f1b:	0f 88 a2 00 00 00    	js     801fc3 <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  801f21:	48 a1 08 00 81 00 00 	movabs 0x810008,%rax
+  801f28:	00 00 00 
+  801f2b:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801f31:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801f36:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  801f38:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  801f3d:	49 bc d5 40 80 00 00 	movabs $0x8040d5,%r12
+  801f44:	00 00 00 
+  801f47:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  801f4a:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  801f4f:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  801f52:	48 b8 82 1e 80 00 00 	movabs $0x801e82,%rax
+  801f59:	00 00 00 
+  801f5c:	ff d0                	call   *%rax
+  801f5e:	89 c7                	mov    %eax,%edi
+  801f60:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  801f66:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  801f6b:	48 89 da             	mov    %rbx,%rdx
+  801f6e:	be 09 00 00 00       	mov    $0x9,%esi
+  801f73:	48 b8 1a 48 80 00 00 	movabs $0x80481a,%rax
+  801f7a:	00 00 00 
+  801f7d:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  801f7f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f84:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f89:	be 00 00 00 00       	mov    $0x0,%esi
+  801f8e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f93:	48 b8 f6 47 80 00 00 	movabs $0x8047f6,%rax
+  801f9a:	00 00 00 
+  801f9d:	ff d0                	call   *%rax
+  801f9f:	89 c3                	mov    %eax,%ebx
+  801fa1:	85 c0                	test   %eax,%eax
+  801fa3:	78 25                	js     801fca <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  801fa5:	48 a1 08 00 81 00 00 	movabs 0x810008,%rax
+  801fac:	00 00 00 
+  801faf:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801fb5:	a3 00 26 82 00 00 00 	movabs %eax,0x822600
+  801fbc:	00 00 
+    return 0;
+  801fbe:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  801fc3:	89 d8                	mov    %ebx,%eax
+  801fc5:	5b                   	pop    %rbx
+  801fc6:	41 5c                	pop    %r12
+  801fc8:	5d                   	pop    %rbp
+  801fc9:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  801fca:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801fcf:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  801fd4:	bf 00 00 00 00       	mov    $0x0,%edi
+  801fd9:	48 b8 a3 12 80 00 00 	movabs $0x8012a3,%rax
+  801fe0:	00 00 00 
+  801fe3:	ff d0                	call   *%rax
+        return res;
+  801fe5:	eb dc                	jmp    801fc3 <fschan_setup+0xff>
+
+0000000000801fe7 <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  801fe7:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  801fee:	00 00 00 
+  801ff1:	80 38 00             	cmpb   $0x0,(%rax)
+  801ff4:	74 55                	je     80204b <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801ff6:	48 a1 08 00 81 00 00 	movabs 0x810008,%rax
+  801ffd:	00 00 00 
+  802000:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  802006:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  80200b:	48 ba 00 26 82 00 00 	movabs $0x822600,%rdx
+  802012:	00 00 00 
+  802015:	3b 0a                	cmp    (%rdx),%ecx
+  802017:	75 01                	jne    80201a <fschan+0x33>
+}
+  802019:	c3                   	ret
+fschan(void) {
+  80201a:	55                   	push   %rbp
+  80201b:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  80201e:	48 b8 c4 1e 80 00 00 	movabs $0x801ec4,%rax
+  802025:	00 00 00 
+  802028:	ff d0                	call   *%rax
+  80202a:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  80202c:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802031:	85 d2                	test   %edx,%edx
+  802033:	78 02                	js     802037 <fschan+0x50>
+}
+  802035:	5d                   	pop    %rbp
+  802036:	c3                   	ret
+        fschan_enabled = 0;
+  802037:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  80203e:	00 00 00 
+  802041:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  802044:	b8 00 00 00 00       	mov    $0x0,%eax
+  802049:	eb ea                	jmp    802035 <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  80204b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802050:	c3                   	ret
+
+0000000000802051 <fbuf>:
+fbuf(struct Fd *fd) {
+  802051:	55                   	push   %rbp
+  802052:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  802055:	48 b8 50 17 80 00 00 	movabs $0x801750,%rax
+  80205c:	00 00 00 
+  80205f:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  802061:	ba 00 00 00 00       	mov    $0x0,%edx
+  802066:	48 83 f8 1f          	cmp    $0x1f,%rax
+  80206a:	77 12                	ja     80207e <fbuf+0x2d>
+  80206c:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  802070:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802077:	00 00 00 
+  80207a:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  80207e:	48 89 d0             	mov    %rdx,%rax
+  802081:	5d                   	pop    %rbp
+  802082:	c3                   	ret
+
+0000000000802083 <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  802083:	55                   	push   %rbp
+  802084:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  802087:	48 83 c7 40          	add    $0x40,%rdi
+  80208b:	48 b8 0f 41 80 00 00 	movabs $0x80410f,%rax
+  802092:	00 00 00 
+  802095:	ff d0                	call   *%rax
+  802097:	84 c0                	test   %al,%al
+  802099:	75 02                	jne    80209d <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  80209b:	5d                   	pop    %rbp
+  80209c:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  80209d:	48 b8 82 1e 80 00 00 	movabs $0x801e82,%rax
+  8020a4:	00 00 00 
+  8020a7:	ff d0                	call   *%rax
+  8020a9:	89 c7                	mov    %eax,%edi
+  8020ab:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8020b1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020bb:	be 0a 00 00 00       	mov    $0xa,%esi
+  8020c0:	48 b8 1a 48 80 00 00 	movabs $0x80481a,%rax
+  8020c7:	00 00 00 
+  8020ca:	ff d0                	call   *%rax
+}
+  8020cc:	eb cd                	jmp    80209b <fschan_publish+0x18>
+
+00000000008020ce <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  8020ce:	55                   	push   %rbp
+  8020cf:	48 89 e5             	mov    %rsp,%rbp
+  8020d2:	41 57                	push   %r15
+  8020d4:	41 56                	push   %r14
+  8020d6:	41 55                	push   %r13
+  8020d8:	41 54                	push   %r12
+  8020da:	53                   	push   %rbx
+  8020db:	48 83 ec 48          	sub    $0x48,%rsp
+  8020df:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8020e3:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  8020e7:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  8020ea:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  8020ee:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  8020f1:	48 ba 04 00 82 00 00 	movabs $0x820004,%rdx
+  8020f8:	00 00 00 
+  8020fb:	8b 02                	mov    (%rdx),%eax
+  8020fd:	83 c0 01             	add    $0x1,%eax
+  802100:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802105:	0f 44 c1             	cmove  %ecx,%eax
+  802108:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  80210a:	4d 85 c0             	test   %r8,%r8
+  80210d:	74 2c                	je     80213b <fschan_rw+0x6d>
+  80210f:	45 89 ce             	mov    %r9d,%r14d
+  802112:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  802119:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  80211d:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802123:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  80212a:	00 
+  80212b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802131:	b8 01 00 00 00       	mov    $0x1,%eax
+  802136:	e9 41 01 00 00       	jmp    80227c <fschan_rw+0x1ae>
+  80213b:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  80213f:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802143:	e9 9c 01 00 00       	jmp    8022e4 <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  802148:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80214c:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  80214f:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  802152:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  802155:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  802159:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  80215d:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  802161:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  802165:	48 89 da             	mov    %rbx,%rdx
+  802168:	48 b8 ff 0e 80 00 00 	movabs $0x800eff,%rax
+  80216f:	00 00 00 
+  802172:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  802174:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802178:	48 b8 83 20 80 00 00 	movabs $0x802083,%rax
+  80217f:	00 00 00 
+  802182:	ff d0                	call   *%rax
+            queued += blk;
+  802184:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  802187:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  80218b:	4d 39 fc             	cmp    %r15,%r12
+  80218e:	73 6b                	jae    8021fb <fschan_rw+0x12d>
+  802190:	41 83 fd 0f          	cmp    $0xf,%r13d
+  802194:	77 65                	ja     8021fb <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  802196:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80219a:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  80219e:	48 b8 ea 40 80 00 00 	movabs $0x8040ea,%rax
+  8021a5:	00 00 00 
+  8021a8:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  8021aa:	4c 89 fb             	mov    %r15,%rbx
+  8021ad:	4c 29 e3             	sub    %r12,%rbx
+  8021b0:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  8021b5:	48 39 d3             	cmp    %rdx,%rbx
+  8021b8:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  8021bc:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  8021c0:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  8021c4:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  8021c8:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  8021cb:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  8021cd:	48 b9 04 00 82 00 00 	movabs $0x820004,%rcx
+  8021d4:	00 00 00 
+  8021d7:	8b 09                	mov    (%rcx),%ecx
+  8021d9:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  8021dc:	83 fe 03             	cmp    $0x3,%esi
+  8021df:	0f 85 63 ff ff ff    	jne    802148 <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  8021e5:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8021e9:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  8021ec:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  8021ef:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  8021f2:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  8021f6:	e9 79 ff ff ff       	jmp    802174 <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  8021fb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8021ff:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  802206:	48 89 df             	mov    %rbx,%rdi
+  802209:	48 b8 ad 41 80 00 00 	movabs $0x8041ad,%rax
+  802210:	00 00 00 
+  802213:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  802215:	48 89 df             	mov    %rbx,%rdi
+  802218:	48 b8 3b 41 80 00 00 	movabs $0x80413b,%rax
+  80221f:	00 00 00 
+  802222:	ff d0                	call   *%rax
+  802224:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  802228:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  80222c:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  802230:	75 25                	jne    802257 <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  802232:	8b 40 04             	mov    0x4(%rax),%eax
+  802235:	85 c0                	test   %eax,%eax
+  802237:	0f 88 86 00 00 00    	js     8022c3 <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  80223d:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  802241:	74 5b                	je     80229e <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  802243:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802247:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  80224b:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  80224f:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  802253:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  802257:	48 89 df             	mov    %rbx,%rdi
+  80225a:	48 b8 62 41 80 00 00 	movabs $0x804162,%rax
+  802261:	00 00 00 
+  802264:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  802266:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  80226a:	83 f0 01             	xor    $0x1,%eax
+  80226d:	4d 39 fc             	cmp    %r15,%r12
+  802270:	0f 92 c2             	setb   %dl
+  802273:	84 c2                	test   %al,%dl
+  802275:	75 05                	jne    80227c <fschan_rw+0x1ae>
+  802277:	45 85 ed             	test   %r13d,%r13d
+  80227a:	74 50                	je     8022cc <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  80227c:	4d 39 fc             	cmp    %r15,%r12
+  80227f:	0f 92 c1             	setb   %cl
+  802282:	41 83 fd 0f          	cmp    $0xf,%r13d
+  802286:	0f 96 c2             	setbe  %dl
+  802289:	84 d1                	test   %dl,%cl
+  80228b:	0f 84 6a ff ff ff    	je     8021fb <fschan_rw+0x12d>
+  802291:	84 c0                	test   %al,%al
+  802293:	0f 85 fd fe ff ff    	jne    802196 <fschan_rw+0xc8>
+  802299:	e9 5d ff ff ff       	jmp    8021fb <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  80229e:	48 63 d0             	movslq %eax,%rdx
+  8022a1:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8022a5:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  8022a9:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8022ad:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  8022b1:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  8022b5:	48 b8 ff 0e 80 00 00 	movabs $0x800eff,%rax
+  8022bc:	00 00 00 
+  8022bf:	ff d0                	call   *%rax
+  8022c1:	eb 80                	jmp    802243 <fschan_rw+0x175>
+                err = msg->fm_res;
+  8022c3:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  8022c6:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  8022ca:	eb 8b                	jmp    802257 <fschan_rw+0x189>
+    return done || !err ? done : err;
+  8022cc:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  8022d1:	0f 85 68 fe ff ff    	jne    80213f <fschan_rw+0x71>
+  8022d7:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  8022da:	85 c0                	test   %eax,%eax
+  8022dc:	0f 84 5d fe ff ff    	je     80213f <fschan_rw+0x71>
+  8022e2:	48 98                	cltq
+}
+  8022e4:	48 83 c4 48          	add    $0x48,%rsp
+  8022e8:	5b                   	pop    %rbx
+  8022e9:	41 5c                	pop    %r12
+  8022eb:	41 5d                	pop    %r13
+  8022ed:	41 5e                	pop    %r14
+  8022ef:	41 5f                	pop    %r15
+  8022f1:	5d                   	pop    %rbp
+  8022f2:	c3                   	ret
+
+00000000008022f3 <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  8022f3:	55                   	push   %rbp
+  8022f4:	48 89 e5             	mov    %rsp,%rbp
+  8022f7:	41 56                	push   %r14
+  8022f9:	41 55                	push   %r13
+  8022fb:	41 54                	push   %r12
+  8022fd:	53                   	push   %rbx
+  8022fe:	48 83 ec 10          	sub    $0x10,%rsp
+  802302:	49 89 fe             	mov    %rdi,%r14
+  802305:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  802308:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  80230c:	48 29 f3             	sub    %rsi,%rbx
+  80230f:	48 39 d3             	cmp    %rdx,%rbx
+  802312:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  802316:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  80231d:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  80231e:	bf 00 10 00 00       	mov    $0x1000,%edi
+  802323:	49 bd 6c 3f 80 00 00 	movabs $0x803f6c,%r13
+  80232a:	00 00 00 
+  80232d:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  802334:	76 1e                	jbe    802354 <mmap_fault+0x61>
+  802336:	4c 01 e7             	add    %r12,%rdi
+  802339:	41 ff d5             	call   *%r13
+  80233c:	84 c0                	test   %al,%al
+  80233e:	75 14                	jne    802354 <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  802340:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802344:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  80234b:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  80234f:	48 39 df             	cmp    %rbx,%rdi
+  802352:	72 e2                	jb     802336 <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  802354:	48 bb 00 10 82 00 00 	movabs $0x821000,%rbx
+  80235b:	00 00 00 
+  80235e:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  802365:	00 00 00 
+  802368:	4c 89 f0             	mov    %r14,%rax
+  80236b:	48 29 d0             	sub    %rdx,%rax
+  80236e:	48 c1 f8 03          	sar    $0x3,%rax
+  802372:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  802379:	aa aa aa 
+  80237c:	48 0f af c2          	imul   %rdx,%rax
+  802380:	48 c1 e0 0c          	shl    $0xc,%rax
+  802384:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  802389:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  80238d:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  80238f:	44 89 e0             	mov    %r12d,%eax
+  802392:	41 03 46 10          	add    0x10(%r14),%eax
+  802396:	41 2b 06             	sub    (%r14),%eax
+  802399:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  80239c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8023a0:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  8023a4:	41 8b 46 14          	mov    0x14(%r14),%eax
+  8023a8:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  8023ab:	48 b8 82 1e 80 00 00 	movabs $0x801e82,%rax
+  8023b2:	00 00 00 
+  8023b5:	ff d0                	call   *%rax
+  8023b7:	89 c7                	mov    %eax,%edi
+  8023b9:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8023bf:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8023c4:	48 89 da             	mov    %rbx,%rdx
+  8023c7:	be 0f 00 00 00       	mov    $0xf,%esi
+  8023cc:	48 b8 1a 48 80 00 00 	movabs $0x80481a,%rax
+  8023d3:	00 00 00 
+  8023d6:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  8023d8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023dd:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8023e1:	4c 89 e6             	mov    %r12,%rsi
+  8023e4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023e9:	48 b8 f6 47 80 00 00 	movabs $0x8047f6,%rax
+  8023f0:	00 00 00 
+  8023f3:	ff d0                	call   *%rax
+  8023f5:	48 98                	cltq
+}
+  8023f7:	48 83 c4 10          	add    $0x10,%rsp
+  8023fb:	5b                   	pop    %rbx
+  8023fc:	41 5c                	pop    %r12
+  8023fe:	41 5d                	pop    %r13
+  802400:	41 5e                	pop    %r14
+  802402:	5d                   	pop    %rbp
+  802403:	c3                   	ret
+
+0000000000802404 <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  802404:	48 8b 37             	mov    (%rdi),%rsi
+  802407:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  80240e:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  802415:	00 00 00 
+  802418:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80241d:	eb 0f                	jmp    80242e <mmap_pgfault+0x2a>
+  80241f:	c3                   	ret
+  802420:	48 83 c1 01          	add    $0x1,%rcx
+  802424:	48 83 c2 18          	add    $0x18,%rdx
+  802428:	48 83 f9 20          	cmp    $0x20,%rcx
+  80242c:	74 6e                	je     80249c <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  80242e:	48 8b 02             	mov    (%rdx),%rax
+  802431:	48 83 e8 01          	sub    $0x1,%rax
+  802435:	48 39 f0             	cmp    %rsi,%rax
+  802438:	73 e6                	jae    802420 <mmap_pgfault+0x1c>
+  80243a:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  80243e:	73 e0                	jae    802420 <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  802440:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  802444:	b8 00 00 00 00       	mov    $0x0,%eax
+  802449:	f6 c2 01             	test   $0x1,%dl
+  80244c:	75 d1                	jne    80241f <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  80244e:	f6 c2 02             	test   $0x2,%dl
+  802451:	74 1a                	je     80246d <mmap_pgfault+0x69>
+  802453:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  802457:	b8 00 00 00 00       	mov    $0x0,%eax
+  80245c:	48 bf 00 20 82 00 00 	movabs $0x822000,%rdi
+  802463:	00 00 00 
+  802466:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  80246b:	74 35                	je     8024a2 <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  80246d:	55                   	push   %rbp
+  80246e:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  802471:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  802475:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  80247c:	00 00 00 
+  80247f:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  802483:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802488:	48 b8 f3 22 80 00 00 	movabs $0x8022f3,%rax
+  80248f:	00 00 00 
+  802492:	ff d0                	call   *%rax
+  802494:	48 85 c0             	test   %rax,%rax
+  802497:	0f 9f c0             	setg   %al
+}
+  80249a:	5d                   	pop    %rbp
+  80249b:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  80249c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024a1:	c3                   	ret
+}
+  8024a2:	c3                   	ret
+
+00000000008024a3 <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  8024a3:	55                   	push   %rbp
+  8024a4:	48 89 e5             	mov    %rsp,%rbp
+  8024a7:	41 54                	push   %r12
+  8024a9:	53                   	push   %rbx
+  8024aa:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8024ad:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8024b4:	00 00 00 
+  8024b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  8024bc:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8024c0:	74 15                	je     8024d7 <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8024c2:	48 83 c3 01          	add    $0x1,%rbx
+  8024c6:	48 83 c0 18          	add    $0x18,%rax
+  8024ca:	48 83 fb 20          	cmp    $0x20,%rbx
+  8024ce:	75 ec                	jne    8024bc <mmap_alloc+0x19>
+    return NULL;
+  8024d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024d5:	eb 52                	jmp    802529 <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  8024d7:	4c 89 e7             	mov    %r12,%rdi
+  8024da:	48 b8 0d 3f 80 00 00 	movabs $0x803f0d,%rax
+  8024e1:	00 00 00 
+  8024e4:	ff d0                	call   *%rax
+  8024e6:	41 89 c1             	mov    %eax,%r9d
+  8024e9:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  8024f0:	48 c1 e1 0c          	shl    $0xc,%rcx
+  8024f4:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8024fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024ff:	4c 89 e6             	mov    %r12,%rsi
+  802502:	bf 00 00 00 00       	mov    $0x0,%edi
+  802507:	48 b8 53 12 80 00 00 	movabs $0x801253,%rax
+  80250e:	00 00 00 
+  802511:	ff d0                	call   *%rax
+  802513:	85 c0                	test   %eax,%eax
+  802515:	78 17                	js     80252e <mmap_alloc+0x8b>
+        return &mmaps[i];
+  802517:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  80251b:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  802522:	00 00 00 
+  802525:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  802529:	5b                   	pop    %rbx
+  80252a:	41 5c                	pop    %r12
+  80252c:	5d                   	pop    %rbp
+  80252d:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  80252e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802533:	eb f4                	jmp    802529 <mmap_alloc+0x86>
+
+0000000000802535 <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  802535:	55                   	push   %rbp
+  802536:	48 89 e5             	mov    %rsp,%rbp
+  802539:	41 56                	push   %r14
+  80253b:	41 55                	push   %r13
+  80253d:	41 54                	push   %r12
+  80253f:	53                   	push   %rbx
+  802540:	48 83 ec 10          	sub    $0x10,%rsp
+  802544:	41 89 fc             	mov    %edi,%r12d
+  802547:	49 89 f5             	mov    %rsi,%r13
+  80254a:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  80254d:	48 89 f0             	mov    %rsi,%rax
+  802550:	48 09 d0             	or     %rdx,%rax
+  802553:	75 0d                	jne    802562 <fsipc+0x2d>
+  802555:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  802558:	83 f8 04             	cmp    $0x4,%eax
+  80255b:	76 7d                	jbe    8025da <fsipc+0xa5>
+  80255d:	83 ff 0d             	cmp    $0xd,%edi
+  802560:	74 78                	je     8025da <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  802562:	48 b8 82 1e 80 00 00 	movabs $0x801e82,%rax
+  802569:	00 00 00 
+  80256c:	ff d0                	call   *%rax
+  80256e:	89 c7                	mov    %eax,%edi
+  802570:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  802577:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  80257e:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  802585:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80258b:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802592:	00 00 00 
+  802595:	44 89 e6             	mov    %r12d,%esi
+  802598:	48 b8 1a 48 80 00 00 	movabs $0x80481a,%rax
+  80259f:	00 00 00 
+  8025a2:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  8025a4:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8025ab:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  8025ac:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025b1:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8025b5:	4c 89 ee             	mov    %r13,%rsi
+  8025b8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025bd:	48 b8 f6 47 80 00 00 	movabs $0x8047f6,%rax
+  8025c4:	00 00 00 
+  8025c7:	ff d0                	call   *%rax
+  8025c9:	89 c3                	mov    %eax,%ebx
+}
+  8025cb:	89 d8                	mov    %ebx,%eax
+  8025cd:	48 83 c4 10          	add    $0x10,%rsp
+  8025d1:	5b                   	pop    %rbx
+  8025d2:	41 5c                	pop    %r12
+  8025d4:	41 5d                	pop    %r13
+  8025d6:	41 5e                	pop    %r14
+  8025d8:	5d                   	pop    %rbp
+  8025d9:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  8025da:	48 b8 e7 1f 80 00 00 	movabs $0x801fe7,%rax
+  8025e1:	00 00 00 
+  8025e4:	ff d0                	call   *%rax
+  8025e6:	49 89 c6             	mov    %rax,%r14
+  8025e9:	48 85 c0             	test   %rax,%rax
+  8025ec:	0f 84 70 ff ff ff    	je     802562 <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  8025f2:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  8025f6:	48 b8 ea 40 80 00 00 	movabs $0x8040ea,%rax
+  8025fd:	00 00 00 
+  802600:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  802602:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  802605:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  80260c:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  802610:	ba 10 00 00 00       	mov    $0x10,%edx
+  802615:	48 be 00 00 83 00 00 	movabs $0x830000,%rsi
+  80261c:	00 00 00 
+  80261f:	48 b8 ff 0e 80 00 00 	movabs $0x800eff,%rax
+  802626:	00 00 00 
+  802629:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  80262b:	4c 89 f7             	mov    %r14,%rdi
+  80262e:	48 b8 83 20 80 00 00 	movabs $0x802083,%rax
+  802635:	00 00 00 
+  802638:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  80263a:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  802641:	4c 89 f7             	mov    %r14,%rdi
+  802644:	48 b8 ad 41 80 00 00 	movabs $0x8041ad,%rax
+  80264b:	00 00 00 
+  80264e:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  802650:	4c 89 f7             	mov    %r14,%rdi
+  802653:	48 b8 3b 41 80 00 00 	movabs $0x80413b,%rax
+  80265a:	00 00 00 
+  80265d:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  80265f:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  802662:	41 83 fc 05          	cmp    $0x5,%r12d
+  802666:	75 04                	jne    80266c <fsipc+0x137>
+  802668:	85 db                	test   %ebx,%ebx
+  80266a:	79 14                	jns    802680 <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  80266c:	4c 89 f7             	mov    %r14,%rdi
+  80266f:	48 b8 62 41 80 00 00 	movabs $0x804162,%rax
+  802676:	00 00 00 
+  802679:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  80267b:	e9 4b ff ff ff       	jmp    8025cb <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  802680:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  802684:	ba 88 00 00 00       	mov    $0x88,%edx
+  802689:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  802690:	00 00 00 
+  802693:	48 b8 ff 0e 80 00 00 	movabs $0x800eff,%rax
+  80269a:	00 00 00 
+  80269d:	ff d0                	call   *%rax
+  80269f:	eb cb                	jmp    80266c <fsipc+0x137>
+
+00000000008026a1 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  8026a1:	55                   	push   %rbp
+  8026a2:	48 89 e5             	mov    %rsp,%rbp
+  8026a5:	41 57                	push   %r15
+  8026a7:	41 56                	push   %r14
+  8026a9:	41 55                	push   %r13
+  8026ab:	41 54                	push   %r12
+  8026ad:	53                   	push   %rbx
+  8026ae:	48 83 ec 18          	sub    $0x18,%rsp
+  8026b2:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  8026b6:	49 89 f6             	mov    %rsi,%r14
+  8026b9:	49 89 d4             	mov    %rdx,%r12
+  8026bc:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  8026bf:	48 b8 e7 1f 80 00 00 	movabs $0x801fe7,%rax
+  8026c6:	00 00 00 
+  8026c9:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  8026cb:	48 85 c0             	test   %rax,%rax
+  8026ce:	0f 85 96 00 00 00    	jne    80276a <devfile_write_direct+0xc9>
+    size_t write = 0;
+  8026d4:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8026db:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8026dc:	49 bf 00 00 83 00 00 	movabs $0x830000,%r15
+  8026e3:	00 00 00 
+    while (n) {
+  8026e6:	4d 85 e4             	test   %r12,%r12
+  8026e9:	74 79                	je     802764 <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  8026eb:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  8026f0:	49 39 dc             	cmp    %rbx,%r12
+  8026f3:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  8026f7:	48 89 da             	mov    %rbx,%rdx
+  8026fa:	4c 89 f6             	mov    %r14,%rsi
+  8026fd:	48 bf 00 10 83 00 00 	movabs $0x831000,%rdi
+  802704:	00 00 00 
+  802707:	48 b8 ff 0e 80 00 00 	movabs $0x800eff,%rax
+  80270e:	00 00 00 
+  802711:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802713:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802717:	8b 40 0c             	mov    0xc(%rax),%eax
+  80271a:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  80271d:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802720:	44 01 e8             	add    %r13d,%eax
+  802723:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  802727:	41 0f 44 c5          	cmove  %r13d,%eax
+  80272b:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  80272f:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  802733:	48 89 da             	mov    %rbx,%rdx
+  802736:	be 00 00 00 00       	mov    $0x0,%esi
+  80273b:	bf 04 00 00 00       	mov    $0x4,%edi
+  802740:	48 b8 35 25 80 00 00 	movabs $0x802535,%rax
+  802747:	00 00 00 
+  80274a:	ff d0                	call   *%rax
+        if (res < 0)
+  80274c:	85 c0                	test   %eax,%eax
+  80274e:	78 4a                	js     80279a <devfile_write_direct+0xf9>
+        buf += res;
+  802750:	48 98                	cltq
+  802752:	49 01 c6             	add    %rax,%r14
+        write += res;
+  802755:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  802759:	49 29 c4             	sub    %rax,%r12
+  80275c:	75 8d                	jne    8026eb <devfile_write_direct+0x4a>
+    return write;
+  80275e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802762:	eb 27                	jmp    80278b <devfile_write_direct+0xea>
+    size_t write = 0;
+  802764:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  802768:	eb f4                	jmp    80275e <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  80276a:	45 89 e9             	mov    %r13d,%r9d
+  80276d:	4d 89 e0             	mov    %r12,%r8
+  802770:	4c 89 f1             	mov    %r14,%rcx
+  802773:	ba 04 00 00 00       	mov    $0x4,%edx
+  802778:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80277c:	48 89 c7             	mov    %rax,%rdi
+  80277f:	48 b8 ce 20 80 00 00 	movabs $0x8020ce,%rax
+  802786:	00 00 00 
+  802789:	ff d0                	call   *%rax
+}
+  80278b:	48 83 c4 18          	add    $0x18,%rsp
+  80278f:	5b                   	pop    %rbx
+  802790:	41 5c                	pop    %r12
+  802792:	41 5d                	pop    %r13
+  802794:	41 5e                	pop    %r14
+  802796:	41 5f                	pop    %r15
+  802798:	5d                   	pop    %rbp
+  802799:	c3                   	ret
+            return res;
+  80279a:	48 98                	cltq
+  80279c:	eb ed                	jmp    80278b <devfile_write_direct+0xea>
+
+000000000080279e <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  80279e:	55                   	push   %rbp
+  80279f:	48 89 e5             	mov    %rsp,%rbp
+  8027a2:	41 54                	push   %r12
+  8027a4:	53                   	push   %rbx
+  8027a5:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  8027a8:	48 b8 51 20 80 00 00 	movabs $0x802051,%rax
+  8027af:	00 00 00 
+  8027b2:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  8027b4:	48 85 c0             	test   %rax,%rax
+  8027b7:	74 71                	je     80282a <fbuf_flush+0x8c>
+  8027b9:	48 89 c3             	mov    %rax,%rbx
+  8027bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027c1:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  8027c5:	75 05                	jne    8027cc <fbuf_flush+0x2e>
+}
+  8027c7:	5b                   	pop    %rbx
+  8027c8:	41 5c                	pop    %r12
+  8027ca:	5d                   	pop    %rbp
+  8027cb:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  8027cc:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  8027cf:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  8027d3:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8027da:	00 00 00 
+  8027dd:	48 89 de             	mov    %rbx,%rsi
+  8027e0:	48 29 c6             	sub    %rax,%rsi
+  8027e3:	48 c1 fe 03          	sar    $0x3,%rsi
+  8027e7:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8027ee:	aa aa aa 
+  8027f1:	48 0f af f0          	imul   %rax,%rsi
+  8027f5:	48 c1 e6 0e          	shl    $0xe,%rsi
+  8027f9:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  8027fe:	48 01 c6             	add    %rax,%rsi
+  802801:	4c 89 e7             	mov    %r12,%rdi
+  802804:	48 b8 a1 26 80 00 00 	movabs $0x8026a1,%rax
+  80280b:	00 00 00 
+  80280e:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  802810:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  802814:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  80281b:	00 
+    return res < 0 ? res : 0;
+  80281c:	48 85 c0             	test   %rax,%rax
+  80281f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802824:	48 0f 4f c2          	cmovg  %rdx,%rax
+  802828:	eb 9d                	jmp    8027c7 <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  80282a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80282f:	eb 96                	jmp    8027c7 <fbuf_flush+0x29>
+
+0000000000802831 <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  802831:	55                   	push   %rbp
+  802832:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  802835:	48 b8 9e 27 80 00 00 	movabs $0x80279e,%rax
+  80283c:	00 00 00 
+  80283f:	ff d0                	call   *%rax
+}
+  802841:	5d                   	pop    %rbp
+  802842:	c3                   	ret
+
+0000000000802843 <devfile_write>:
+    if (!fd || !buf)
+  802843:	48 85 ff             	test   %rdi,%rdi
+  802846:	0f 84 d3 01 00 00    	je     802a1f <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80284c:	55                   	push   %rbp
+  80284d:	48 89 e5             	mov    %rsp,%rbp
+  802850:	41 57                	push   %r15
+  802852:	41 56                	push   %r14
+  802854:	41 55                	push   %r13
+  802856:	41 54                	push   %r12
+  802858:	53                   	push   %rbx
+  802859:	48 83 ec 08          	sub    $0x8,%rsp
+  80285d:	49 89 fc             	mov    %rdi,%r12
+  802860:	49 89 f6             	mov    %rsi,%r14
+  802863:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  802866:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  80286b:	48 85 f6             	test   %rsi,%rsi
+  80286e:	0f 84 9c 01 00 00    	je     802a10 <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  802874:	48 b8 51 20 80 00 00 	movabs $0x802051,%rax
+  80287b:	00 00 00 
+  80287e:	ff d0                	call   *%rax
+  802880:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  802883:	48 85 c0             	test   %rax,%rax
+  802886:	0f 84 a2 00 00 00    	je     80292e <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  80288c:	be 00 10 00 00       	mov    $0x1000,%esi
+  802891:	4c 89 e7             	mov    %r12,%rdi
+  802894:	48 b8 c2 11 80 00 00 	movabs $0x8011c2,%rax
+  80289b:	00 00 00 
+  80289e:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  8028a0:	83 f8 02             	cmp    $0x2,%eax
+  8028a3:	0f 8f 85 00 00 00    	jg     80292e <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  8028a9:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8028b0:	00 00 00 
+  8028b3:	4d 89 ef             	mov    %r13,%r15
+  8028b6:	49 29 c7             	sub    %rax,%r15
+  8028b9:	49 c1 ff 03          	sar    $0x3,%r15
+  8028bd:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8028c4:	aa aa aa 
+  8028c7:	4c 0f af f8          	imul   %rax,%r15
+  8028cb:	49 c1 e7 0e          	shl    $0xe,%r15
+  8028cf:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  8028d4:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  8028d7:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  8028dc:	0f 84 d7 00 00 00    	je     8029b9 <devfile_write+0x176>
+  8028e2:	49 8b 45 10          	mov    0x10(%r13),%rax
+  8028e6:	89 c2                	mov    %eax,%edx
+  8028e8:	41 03 55 0c          	add    0xc(%r13),%edx
+  8028ec:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  8028f1:	75 0f                	jne    802902 <devfile_write+0xbf>
+  8028f3:	48 01 d8             	add    %rbx,%rax
+  8028f6:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  8028fc:	0f 86 92 00 00 00    	jbe    802994 <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802902:	4c 89 e7             	mov    %r12,%rdi
+  802905:	48 b8 9e 27 80 00 00 	movabs $0x80279e,%rax
+  80290c:	00 00 00 
+  80290f:	ff d0                	call   *%rax
+  802911:	85 c0                	test   %eax,%eax
+  802913:	78 52                	js     802967 <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802915:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  80291c:	77 7f                	ja     80299d <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  80291e:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802923:	0f 85 c2 00 00 00    	jne    8029eb <devfile_write+0x1a8>
+  802929:	e9 94 00 00 00       	jmp    8029c2 <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  80292e:	4c 89 e7             	mov    %r12,%rdi
+  802931:	48 b8 9e 27 80 00 00 	movabs $0x80279e,%rax
+  802938:	00 00 00 
+  80293b:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  80293d:	85 c0                	test   %eax,%eax
+  80293f:	79 07                	jns    802948 <devfile_write+0x105>
+  802941:	48 98                	cltq
+  802943:	e9 c8 00 00 00       	jmp    802a10 <devfile_write+0x1cd>
+  802948:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  80294d:	48 89 da             	mov    %rbx,%rdx
+  802950:	4c 89 f6             	mov    %r14,%rsi
+  802953:	4c 89 e7             	mov    %r12,%rdi
+  802956:	48 b8 a1 26 80 00 00 	movabs $0x8026a1,%rax
+  80295d:	00 00 00 
+  802960:	ff d0                	call   *%rax
+  802962:	e9 a9 00 00 00       	jmp    802a10 <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802967:	48 98                	cltq
+  802969:	e9 a2 00 00 00       	jmp    802a10 <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  80296e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802973:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802978:	4c 89 fe             	mov    %r15,%rsi
+  80297b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802980:	48 b8 fd 11 80 00 00 	movabs $0x8011fd,%rax
+  802987:	00 00 00 
+  80298a:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  80298c:	85 c0                	test   %eax,%eax
+  80298e:	79 45                	jns    8029d5 <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802990:	48 98                	cltq
+  802992:	eb 7c                	jmp    802a10 <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802994:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  80299b:	76 4e                	jbe    8029eb <devfile_write+0x1a8>
+  80299d:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  8029a2:	48 89 da             	mov    %rbx,%rdx
+  8029a5:	4c 89 f6             	mov    %r14,%rsi
+  8029a8:	4c 89 e7             	mov    %r12,%rdi
+  8029ab:	48 b8 a1 26 80 00 00 	movabs $0x8026a1,%rax
+  8029b2:	00 00 00 
+  8029b5:	ff d0                	call   *%rax
+  8029b7:	eb 57                	jmp    802a10 <devfile_write+0x1cd>
+  8029b9:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  8029c0:	77 db                	ja     80299d <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  8029c2:	4c 89 ff             	mov    %r15,%rdi
+  8029c5:	48 b8 6c 3f 80 00 00 	movabs $0x803f6c,%rax
+  8029cc:	00 00 00 
+  8029cf:	ff d0                	call   *%rax
+  8029d1:	84 c0                	test   %al,%al
+  8029d3:	74 99                	je     80296e <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  8029d5:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  8029da:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8029df:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  8029e3:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  8029ea:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  8029eb:	4c 89 ff             	mov    %r15,%rdi
+  8029ee:	49 03 7d 10          	add    0x10(%r13),%rdi
+  8029f2:	48 89 da             	mov    %rbx,%rdx
+  8029f5:	4c 89 f6             	mov    %r14,%rsi
+  8029f8:	48 b8 ff 0e 80 00 00 	movabs $0x800eff,%rax
+  8029ff:	00 00 00 
+  802a02:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  802a04:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  802a08:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  802a0d:	48 89 d8             	mov    %rbx,%rax
+}
+  802a10:	48 83 c4 08          	add    $0x8,%rsp
+  802a14:	5b                   	pop    %rbx
+  802a15:	41 5c                	pop    %r12
+  802a17:	41 5d                	pop    %r13
+  802a19:	41 5e                	pop    %r14
+  802a1b:	41 5f                	pop    %r15
+  802a1d:	5d                   	pop    %rbp
+  802a1e:	c3                   	ret
+        return E_INVAL;
+  802a1f:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802a24:	c3                   	ret
+
+0000000000802a25 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802a25:	55                   	push   %rbp
+  802a26:	48 89 e5             	mov    %rsp,%rbp
+  802a29:	41 54                	push   %r12
+  802a2b:	53                   	push   %rbx
+  802a2c:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  802a2f:	48 b8 9e 27 80 00 00 	movabs $0x80279e,%rax
+  802a36:	00 00 00 
+  802a39:	ff d0                	call   *%rax
+  802a3b:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  802a3e:	48 89 df             	mov    %rbx,%rdi
+  802a41:	48 b8 51 20 80 00 00 	movabs $0x802051,%rax
+  802a48:	00 00 00 
+  802a4b:	ff d0                	call   *%rax
+  802a4d:	48 85 c0             	test   %rax,%rax
+  802a50:	74 17                	je     802a69 <devfile_flush+0x44>
+  802a52:	48 89 df             	mov    %rbx,%rdi
+  802a55:	48 b8 51 20 80 00 00 	movabs $0x802051,%rax
+  802a5c:	00 00 00 
+  802a5f:	ff d0                	call   *%rax
+  802a61:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  802a68:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802a69:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802a6c:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  802a73:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  802a75:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a7a:	be 00 00 00 00       	mov    $0x0,%esi
+  802a7f:	bf 06 00 00 00       	mov    $0x6,%edi
+  802a84:	48 b8 35 25 80 00 00 	movabs $0x802535,%rax
+  802a8b:	00 00 00 
+  802a8e:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802a90:	45 85 e4             	test   %r12d,%r12d
+  802a93:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802a97:	5b                   	pop    %rbx
+  802a98:	41 5c                	pop    %r12
+  802a9a:	5d                   	pop    %rbp
+  802a9b:	c3                   	ret
+
+0000000000802a9c <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  802a9c:	55                   	push   %rbp
+  802a9d:	48 89 e5             	mov    %rsp,%rbp
+  802aa0:	41 57                	push   %r15
+  802aa2:	41 56                	push   %r14
+  802aa4:	41 55                	push   %r13
+  802aa6:	41 54                	push   %r12
+  802aa8:	53                   	push   %rbx
+  802aa9:	48 83 ec 38          	sub    $0x38,%rsp
+  802aad:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  802ab1:	49 89 f7             	mov    %rsi,%r15
+  802ab4:	48 89 d3             	mov    %rdx,%rbx
+  802ab7:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  802aba:	48 b8 e7 1f 80 00 00 	movabs $0x801fe7,%rax
+  802ac1:	00 00 00 
+  802ac4:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802ac6:	48 85 c0             	test   %rax,%rax
+  802ac9:	75 20                	jne    802aeb <devfile_read_direct+0x4f>
+    bool map = 1;
+  802acb:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  802ad0:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802ad7:	00 
+    while (n) {
+  802ad8:	48 85 db             	test   %rbx,%rbx
+  802adb:	0f 85 df 00 00 00    	jne    802bc0 <devfile_read_direct+0x124>
+    size_t read = 0;
+  802ae1:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  802ae5:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802ae9:	eb 21                	jmp    802b0c <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802aeb:	45 89 f1             	mov    %r14d,%r9d
+  802aee:	49 89 d8             	mov    %rbx,%r8
+  802af1:	4c 89 f9             	mov    %r15,%rcx
+  802af4:	ba 03 00 00 00       	mov    $0x3,%edx
+  802af9:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802afd:	48 89 c7             	mov    %rax,%rdi
+  802b00:	48 b8 ce 20 80 00 00 	movabs $0x8020ce,%rax
+  802b07:	00 00 00 
+  802b0a:	ff d0                	call   *%rax
+}
+  802b0c:	48 83 c4 38          	add    $0x38,%rsp
+  802b10:	5b                   	pop    %rbx
+  802b11:	41 5c                	pop    %r12
+  802b13:	41 5d                	pop    %r13
+  802b15:	41 5e                	pop    %r14
+  802b17:	41 5f                	pop    %r15
+  802b19:	5d                   	pop    %rbp
+  802b1a:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802b1b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802b1f:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802b25:	75 1e                	jne    802b45 <devfile_read_direct+0xa9>
+  802b27:	e9 e2 00 00 00       	jmp    802c0e <devfile_read_direct+0x172>
+            if (!res) return read;
+  802b2c:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802b30:	eb da                	jmp    802b0c <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  802b32:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  802b36:	0f 85 d0 01 00 00    	jne    802d0c <devfile_read_direct+0x270>
+            map = 0;
+  802b3c:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802b40:	eb 03                	jmp    802b45 <devfile_read_direct+0xa9>
+  802b42:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802b45:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802b4a:	48 39 d3             	cmp    %rdx,%rbx
+  802b4d:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802b51:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802b55:	8b 40 0c             	mov    0xc(%rax),%eax
+  802b58:	48 b9 00 00 83 00 00 	movabs $0x830000,%rcx
+  802b5f:	00 00 00 
+  802b62:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  802b64:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  802b68:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  802b6c:	be 00 00 00 00       	mov    $0x0,%esi
+  802b71:	bf 03 00 00 00       	mov    $0x3,%edi
+  802b76:	48 b8 35 25 80 00 00 	movabs $0x802535,%rax
+  802b7d:	00 00 00 
+  802b80:	ff d0                	call   *%rax
+        if (res <= 0)
+  802b82:	85 c0                	test   %eax,%eax
+  802b84:	0f 8e 63 01 00 00    	jle    802ced <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  802b8a:	4c 63 e0             	movslq %eax,%r12
+  802b8d:	4c 89 e2             	mov    %r12,%rdx
+  802b90:	48 be 00 10 83 00 00 	movabs $0x831000,%rsi
+  802b97:	00 00 00 
+  802b9a:	4c 89 ff             	mov    %r15,%rdi
+  802b9d:	48 b8 ff 0e 80 00 00 	movabs $0x800eff,%rax
+  802ba4:	00 00 00 
+  802ba7:	ff d0                	call   *%rax
+        buf += res;
+  802ba9:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  802bac:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  802baf:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  802bb3:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  802bb7:	48 85 db             	test   %rbx,%rbx
+  802bba:	0f 84 25 ff ff ff    	je     802ae5 <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  802bc0:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  802bc3:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  802bc7:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802bcb:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802bcf:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  802bd6:	0f 97 c2             	seta   %dl
+  802bd9:	20 c2                	and    %al,%dl
+  802bdb:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  802bde:	0f 84 5e ff ff ff    	je     802b42 <devfile_read_direct+0xa6>
+  802be4:	4c 89 fa             	mov    %r15,%rdx
+  802be7:	4d 89 fd             	mov    %r15,%r13
+  802bea:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  802bf1:	0f 85 4e ff ff ff    	jne    802b45 <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  802bf7:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802bfb:	0f 84 1a ff ff ff    	je     802b1b <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802c01:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802c08:	0f 85 37 ff ff ff    	jne    802b45 <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  802c0e:	48 89 d8             	mov    %rbx,%rax
+  802c11:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802c17:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802c1c:	48 39 c8             	cmp    %rcx,%rax
+  802c1f:	48 0f 47 c1          	cmova  %rcx,%rax
+  802c23:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  802c27:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  802c2b:	49 89 d4             	mov    %rdx,%r12
+  802c2e:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  802c32:	48 b8 0d 3f 80 00 00 	movabs $0x803f0d,%rax
+  802c39:	00 00 00 
+  802c3c:	ff d0                	call   *%rax
+  802c3e:	a8 40                	test   $0x40,%al
+  802c40:	0f 85 b9 00 00 00    	jne    802cff <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  802c46:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  802c4d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c51:	49 39 c5             	cmp    %rax,%r13
+  802c54:	72 d8                	jb     802c2e <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802c56:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802c5a:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802c61:	00 00 00 
+  802c64:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802c68:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  802c6b:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  802c6d:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  802c71:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  802c75:	48 b8 82 1e 80 00 00 	movabs $0x801e82,%rax
+  802c7c:	00 00 00 
+  802c7f:	ff d0                	call   *%rax
+  802c81:	89 c7                	mov    %eax,%edi
+  802c83:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802c89:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802c8e:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802c95:	00 00 00 
+  802c98:	be 0e 00 00 00       	mov    $0xe,%esi
+  802c9d:	48 b8 1a 48 80 00 00 	movabs $0x80481a,%rax
+  802ca4:	00 00 00 
+  802ca7:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  802ca9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802cae:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802cb2:	4c 89 fe             	mov    %r15,%rsi
+  802cb5:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cba:	48 b8 f6 47 80 00 00 	movabs $0x8047f6,%rax
+  802cc1:	00 00 00 
+  802cc4:	ff d0                	call   *%rax
+  802cc6:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  802cc9:	48 85 d2             	test   %rdx,%rdx
+  802ccc:	0f 84 5a fe ff ff    	je     802b2c <devfile_read_direct+0x90>
+            if (res > 0) {
+  802cd2:	0f 8e 5a fe ff ff    	jle    802b32 <devfile_read_direct+0x96>
+                buf += res;
+  802cd8:	48 98                	cltq
+  802cda:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  802cdd:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  802ce0:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  802ce4:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  802ce8:	e9 ca fe ff ff       	jmp    802bb7 <devfile_read_direct+0x11b>
+            return res ? res : read;
+  802ced:	41 89 c5             	mov    %eax,%r13d
+  802cf0:	48 98                	cltq
+  802cf2:	45 85 ed             	test   %r13d,%r13d
+  802cf5:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  802cfa:	e9 0d fe ff ff       	jmp    802b0c <devfile_read_direct+0x70>
+            map = 0;
+  802cff:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802d03:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802d07:	e9 39 fe ff ff       	jmp    802b45 <devfile_read_direct+0xa9>
+  802d0c:	48 89 d0             	mov    %rdx,%rax
+  802d0f:	e9 f8 fd ff ff       	jmp    802b0c <devfile_read_direct+0x70>
+
+0000000000802d14 <devfile_read>:
+    if (!fd || !buf)
+  802d14:	48 85 ff             	test   %rdi,%rdi
+  802d17:	0f 84 21 02 00 00    	je     802f3e <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802d1d:	55                   	push   %rbp
+  802d1e:	48 89 e5             	mov    %rsp,%rbp
+  802d21:	41 57                	push   %r15
+  802d23:	41 56                	push   %r14
+  802d25:	41 55                	push   %r13
+  802d27:	41 54                	push   %r12
+  802d29:	53                   	push   %rbx
+  802d2a:	48 83 ec 28          	sub    $0x28,%rsp
+  802d2e:	48 89 fb             	mov    %rdi,%rbx
+  802d31:	49 89 f4             	mov    %rsi,%r12
+  802d34:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  802d37:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802d3c:	48 85 f6             	test   %rsi,%rsi
+  802d3f:	74 4b                	je     802d8c <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  802d41:	48 b8 51 20 80 00 00 	movabs $0x802051,%rax
+  802d48:	00 00 00 
+  802d4b:	ff d0                	call   *%rax
+  802d4d:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802d50:	48 85 c0             	test   %rax,%rax
+  802d53:	74 22                	je     802d77 <devfile_read+0x63>
+  802d55:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  802d5c:	77 19                	ja     802d77 <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802d5e:	be 00 10 00 00       	mov    $0x1000,%esi
+  802d63:	48 89 df             	mov    %rbx,%rdi
+  802d66:	48 b8 c2 11 80 00 00 	movabs $0x8011c2,%rax
+  802d6d:	00 00 00 
+  802d70:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802d72:	83 f8 02             	cmp    $0x2,%eax
+  802d75:	7e 40                	jle    802db7 <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  802d77:	48 89 df             	mov    %rbx,%rdi
+  802d7a:	48 b8 9e 27 80 00 00 	movabs $0x80279e,%rax
+  802d81:	00 00 00 
+  802d84:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802d86:	85 c0                	test   %eax,%eax
+  802d88:	79 11                	jns    802d9b <devfile_read+0x87>
+  802d8a:	48 98                	cltq
+}
+  802d8c:	48 83 c4 28          	add    $0x28,%rsp
+  802d90:	5b                   	pop    %rbx
+  802d91:	41 5c                	pop    %r12
+  802d93:	41 5d                	pop    %r13
+  802d95:	41 5e                	pop    %r14
+  802d97:	41 5f                	pop    %r15
+  802d99:	5d                   	pop    %rbp
+  802d9a:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802d9b:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802da0:	4c 89 ea             	mov    %r13,%rdx
+  802da3:	4c 89 e6             	mov    %r12,%rsi
+  802da6:	48 89 df             	mov    %rbx,%rdi
+  802da9:	48 b8 9c 2a 80 00 00 	movabs $0x802a9c,%rax
+  802db0:	00 00 00 
+  802db3:	ff d0                	call   *%rax
+  802db5:	eb d5                	jmp    802d8c <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  802db7:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802dbb:	48 89 df             	mov    %rbx,%rdi
+  802dbe:	48 b8 9e 27 80 00 00 	movabs $0x80279e,%rax
+  802dc5:	00 00 00 
+  802dc8:	ff d0                	call   *%rax
+  802dca:	85 c0                	test   %eax,%eax
+  802dcc:	0f 88 33 01 00 00    	js     802f05 <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  802dd2:	48 ba 00 23 82 00 00 	movabs $0x822300,%rdx
+  802dd9:	00 00 00 
+  802ddc:	4c 89 f0             	mov    %r14,%rax
+  802ddf:	48 29 d0             	sub    %rdx,%rax
+  802de2:	48 c1 f8 03          	sar    $0x3,%rax
+  802de6:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  802ded:	aa aa aa 
+  802df0:	48 0f af c2          	imul   %rdx,%rax
+  802df4:	48 c1 e0 0e          	shl    $0xe,%rax
+  802df8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  802dfc:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802dff:	41 39 06             	cmp    %eax,(%r14)
+  802e02:	75 0d                	jne    802e11 <devfile_read+0xfd>
+  802e04:	8b 43 10             	mov    0x10(%rbx),%eax
+  802e07:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  802e0b:	0f 84 fb 00 00 00    	je     802f0c <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  802e11:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802e16:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802e1a:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  802e1d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e21:	48 89 c7             	mov    %rax,%rdi
+  802e24:	48 b8 6c 3f 80 00 00 	movabs $0x803f6c,%rax
+  802e2b:	00 00 00 
+  802e2e:	ff d0                	call   *%rax
+  802e30:	84 c0                	test   %al,%al
+  802e32:	75 27                	jne    802e5b <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802e34:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802e39:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802e3e:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802e42:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e47:	48 b8 fd 11 80 00 00 	movabs $0x8011fd,%rax
+  802e4e:	00 00 00 
+  802e51:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  802e53:	85 c0                	test   %eax,%eax
+  802e55:	0f 88 dc 00 00 00    	js     802f37 <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  802e5b:	44 89 f8             	mov    %r15d,%eax
+  802e5e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802e63:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  802e65:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  802e6c:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  802e6d:	8b 43 10             	mov    0x10(%rbx),%eax
+  802e70:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  802e74:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  802e77:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802e7c:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802e80:	48 89 df             	mov    %rbx,%rdi
+  802e83:	48 b8 9c 2a 80 00 00 	movabs $0x802a9c,%rax
+  802e8a:	00 00 00 
+  802e8d:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  802e8f:	48 85 c0             	test   %rax,%rax
+  802e92:	0f 88 f4 fe ff ff    	js     802d8c <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  802e98:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802e9b:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  802e9e:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  802ea1:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  802ea5:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  802ea9:	48 63 d1             	movslq %ecx,%rdx
+  802eac:	48 01 d0             	add    %rdx,%rax
+  802eaf:	4d 63 ff             	movslq %r15d,%r15
+  802eb2:	4c 29 f8             	sub    %r15,%rax
+  802eb5:	ba 00 00 00 00       	mov    $0x0,%edx
+  802eba:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  802ebe:	48 85 c0             	test   %rax,%rax
+  802ec1:	0f 8e c5 fe ff ff    	jle    802d8c <devfile_read+0x78>
+    n = MIN(n, res);
+  802ec7:	4c 39 e8             	cmp    %r13,%rax
+  802eca:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  802ece:	8b 73 04             	mov    0x4(%rbx),%esi
+  802ed1:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  802ed5:	48 63 f6             	movslq %esi,%rsi
+  802ed8:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802edd:	48 01 c6             	add    %rax,%rsi
+  802ee0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802ee4:	48 01 c6             	add    %rax,%rsi
+  802ee7:	4c 89 ea             	mov    %r13,%rdx
+  802eea:	4c 89 e7             	mov    %r12,%rdi
+  802eed:	48 b8 ff 0e 80 00 00 	movabs $0x800eff,%rax
+  802ef4:	00 00 00 
+  802ef7:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  802ef9:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  802efd:	4c 89 e8             	mov    %r13,%rax
+  802f00:	e9 87 fe ff ff       	jmp    802d8c <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802f05:	48 98                	cltq
+  802f07:	e9 80 fe ff ff       	jmp    802d8c <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  802f0c:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  802f10:	41 39 d7             	cmp    %edx,%r15d
+  802f13:	0f 8c f8 fe ff ff    	jl     802e11 <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  802f19:	49 8b 46 10          	mov    0x10(%r14),%rax
+  802f1d:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  802f20:	41 39 cf             	cmp    %ecx,%r15d
+  802f23:	0f 8d e8 fe ff ff    	jge    802e11 <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  802f29:	4d 63 ff             	movslq %r15d,%r15
+  802f2c:	4c 29 f8             	sub    %r15,%rax
+  802f2f:	48 63 d2             	movslq %edx,%rdx
+  802f32:	48 01 d0             	add    %rdx,%rax
+  802f35:	eb 87                	jmp    802ebe <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802f37:	48 98                	cltq
+  802f39:	e9 4e fe ff ff       	jmp    802d8c <devfile_read+0x78>
+        return E_INVAL;
+  802f3e:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802f43:	c3                   	ret
+
+0000000000802f44 <fs_channel>:
+fs_channel(bool enable) {
+  802f44:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  802f46:	a2 04 26 82 00 00 00 	movabs %al,0x822604
+  802f4d:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  802f4f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f54:	40 84 ff             	test   %dil,%dil
+  802f57:	74 47                	je     802fa0 <fs_channel+0x5c>
+  802f59:	48 a1 08 00 81 00 00 	movabs 0x810008,%rax
+  802f60:	00 00 00 
+  802f63:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  802f69:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  802f70:	00 00 00 
+  802f73:	3b 08                	cmp    (%rax),%ecx
+  802f75:	74 29                	je     802fa0 <fs_channel+0x5c>
+fs_channel(bool enable) {
+  802f77:	55                   	push   %rbp
+  802f78:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  802f7b:	48 b8 c4 1e 80 00 00 	movabs $0x801ec4,%rax
+  802f82:	00 00 00 
+  802f85:	ff d0                	call   *%rax
+  802f87:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  802f89:	85 c0                	test   %eax,%eax
+  802f8b:	78 04                	js     802f91 <fs_channel+0x4d>
+}
+  802f8d:	89 d0                	mov    %edx,%eax
+  802f8f:	5d                   	pop    %rbp
+  802f90:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  802f91:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  802f98:	00 00 00 
+  802f9b:	c6 00 00             	movb   $0x0,(%rax)
+  802f9e:	eb ed                	jmp    802f8d <fs_channel+0x49>
+}
+  802fa0:	89 d0                	mov    %edx,%eax
+  802fa2:	c3                   	ret
+
+0000000000802fa3 <open>:
+open(const char *path, int mode) {
+  802fa3:	55                   	push   %rbp
+  802fa4:	48 89 e5             	mov    %rsp,%rbp
+  802fa7:	41 55                	push   %r13
+  802fa9:	41 54                	push   %r12
+  802fab:	53                   	push   %rbx
+  802fac:	48 83 ec 18          	sub    $0x18,%rsp
+  802fb0:	49 89 fc             	mov    %rdi,%r12
+  802fb3:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802fb6:	48 b8 60 0c 80 00 00 	movabs $0x800c60,%rax
+  802fbd:	00 00 00 
+  802fc0:	ff d0                	call   *%rax
+  802fc2:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802fc8:	0f 87 8f 00 00 00    	ja     80305d <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802fce:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802fd2:	48 b8 7e 17 80 00 00 	movabs $0x80177e,%rax
+  802fd9:	00 00 00 
+  802fdc:	ff d0                	call   *%rax
+  802fde:	89 c3                	mov    %eax,%ebx
+  802fe0:	85 c0                	test   %eax,%eax
+  802fe2:	78 55                	js     803039 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  802fe4:	4c 89 e6             	mov    %r12,%rsi
+  802fe7:	48 bb 00 00 83 00 00 	movabs $0x830000,%rbx
+  802fee:	00 00 00 
+  802ff1:	48 89 df             	mov    %rbx,%rdi
+  802ff4:	48 b8 9e 0c 80 00 00 	movabs $0x800c9e,%rax
+  802ffb:	00 00 00 
+  802ffe:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803000:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  803007:	ba 00 00 00 00       	mov    $0x0,%edx
+  80300c:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803010:	bf 01 00 00 00       	mov    $0x1,%edi
+  803015:	48 b8 35 25 80 00 00 	movabs $0x802535,%rax
+  80301c:	00 00 00 
+  80301f:	ff d0                	call   *%rax
+  803021:	89 c3                	mov    %eax,%ebx
+  803023:	85 c0                	test   %eax,%eax
+  803025:	78 1f                	js     803046 <open+0xa3>
+    return fd2num(fd);
+  803027:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80302b:	48 b8 50 17 80 00 00 	movabs $0x801750,%rax
+  803032:	00 00 00 
+  803035:	ff d0                	call   *%rax
+  803037:	89 c3                	mov    %eax,%ebx
+}
+  803039:	89 d8                	mov    %ebx,%eax
+  80303b:	48 83 c4 18          	add    $0x18,%rsp
+  80303f:	5b                   	pop    %rbx
+  803040:	41 5c                	pop    %r12
+  803042:	41 5d                	pop    %r13
+  803044:	5d                   	pop    %rbp
+  803045:	c3                   	ret
+        fd_close(fd, 0);
+  803046:	be 00 00 00 00       	mov    $0x0,%esi
+  80304b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80304f:	48 b8 99 18 80 00 00 	movabs $0x801899,%rax
+  803056:	00 00 00 
+  803059:	ff d0                	call   *%rax
+        return res;
+  80305b:	eb dc                	jmp    803039 <open+0x96>
+        return -E_BAD_PATH;
+  80305d:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803062:	eb d5                	jmp    803039 <open+0x96>
+
+0000000000803064 <file_flush_buffers>:
+file_flush_buffers(void) {
+  803064:	55                   	push   %rbp
+  803065:	48 89 e5             	mov    %rsp,%rbp
+  803068:	41 56                	push   %r14
+  80306a:	41 55                	push   %r13
+  80306c:	41 54                	push   %r12
+  80306e:	53                   	push   %rbx
+  80306f:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  803073:	49 bc 08 23 82 00 00 	movabs $0x822308,%r12
+  80307a:	00 00 00 
+  80307d:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  803082:	49 bd de 17 80 00 00 	movabs $0x8017de,%r13
+  803089:	00 00 00 
+  80308c:	49 be 9e 27 80 00 00 	movabs $0x80279e,%r14
+  803093:	00 00 00 
+  803096:	eb 0c                	jmp    8030a4 <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  803098:	83 c3 01             	add    $0x1,%ebx
+  80309b:	49 83 c4 18          	add    $0x18,%r12
+  80309f:	83 fb 20             	cmp    $0x20,%ebx
+  8030a2:	74 1d                	je     8030c1 <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  8030a4:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  8030a9:	74 ed                	je     803098 <file_flush_buffers+0x34>
+  8030ab:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8030af:	89 df                	mov    %ebx,%edi
+  8030b1:	41 ff d5             	call   *%r13
+  8030b4:	85 c0                	test   %eax,%eax
+  8030b6:	78 e0                	js     803098 <file_flush_buffers+0x34>
+  8030b8:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8030bc:	41 ff d6             	call   *%r14
+  8030bf:	eb d7                	jmp    803098 <file_flush_buffers+0x34>
+}
+  8030c1:	48 83 c4 10          	add    $0x10,%rsp
+  8030c5:	5b                   	pop    %rbx
+  8030c6:	41 5c                	pop    %r12
+  8030c8:	41 5d                	pop    %r13
+  8030ca:	41 5e                	pop    %r14
+  8030cc:	5d                   	pop    %rbp
+  8030cd:	c3                   	ret
+
+00000000008030ce <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8030ce:	55                   	push   %rbp
+  8030cf:	48 89 e5             	mov    %rsp,%rbp
+  8030d2:	41 54                	push   %r12
+  8030d4:	53                   	push   %rbx
+  8030d5:	49 89 fc             	mov    %rdi,%r12
+  8030d8:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  8030da:	48 b8 64 30 80 00 00 	movabs $0x803064,%rax
+  8030e1:	00 00 00 
+  8030e4:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8030e6:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  8030ed:	00 00 00 
+  8030f0:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  8030f5:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  8030f7:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  8030fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030ff:	be 00 00 00 00       	mov    $0x0,%esi
+  803104:	bf 02 00 00 00       	mov    $0x2,%edi
+  803109:	48 b8 35 25 80 00 00 	movabs $0x802535,%rax
+  803110:	00 00 00 
+  803113:	ff d0                	call   *%rax
+}
+  803115:	5b                   	pop    %rbx
+  803116:	41 5c                	pop    %r12
+  803118:	5d                   	pop    %rbp
+  803119:	c3                   	ret
+
+000000000080311a <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80311a:	55                   	push   %rbp
+  80311b:	48 89 e5             	mov    %rsp,%rbp
+  80311e:	41 54                	push   %r12
+  803120:	53                   	push   %rbx
+  803121:	49 89 fc             	mov    %rdi,%r12
+  803124:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  803127:	48 b8 64 30 80 00 00 	movabs $0x803064,%rax
+  80312e:	00 00 00 
+  803131:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803133:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  803138:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  80313f:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  803141:	ba 00 00 00 00       	mov    $0x0,%edx
+  803146:	be 00 00 00 00       	mov    $0x0,%esi
+  80314b:	bf 05 00 00 00       	mov    $0x5,%edi
+  803150:	48 b8 35 25 80 00 00 	movabs $0x802535,%rax
+  803157:	00 00 00 
+  80315a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80315c:	85 c0                	test   %eax,%eax
+  80315e:	78 3d                	js     80319d <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803160:	49 bc 00 00 83 00 00 	movabs $0x830000,%r12
+  803167:	00 00 00 
+  80316a:	4c 89 e6             	mov    %r12,%rsi
+  80316d:	48 89 df             	mov    %rbx,%rdi
+  803170:	48 b8 9e 0c 80 00 00 	movabs $0x800c9e,%rax
+  803177:	00 00 00 
+  80317a:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80317c:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  803183:	00 
+  803184:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80318a:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  803191:	00 
+  803192:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  803198:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80319d:	5b                   	pop    %rbx
+  80319e:	41 5c                	pop    %r12
+  8031a0:	5d                   	pop    %rbp
+  8031a1:	c3                   	ret
+
+00000000008031a2 <remove>:
+remove(const char *path) {
+  8031a2:	55                   	push   %rbp
+  8031a3:	48 89 e5             	mov    %rsp,%rbp
+  8031a6:	53                   	push   %rbx
+  8031a7:	48 83 ec 08          	sub    $0x8,%rsp
+  8031ab:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  8031ae:	48 b8 60 0c 80 00 00 	movabs $0x800c60,%rax
+  8031b5:	00 00 00 
+  8031b8:	ff d0                	call   *%rax
+  8031ba:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8031c0:	77 3a                	ja     8031fc <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  8031c2:	48 89 de             	mov    %rbx,%rsi
+  8031c5:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  8031cc:	00 00 00 
+  8031cf:	48 b8 9e 0c 80 00 00 	movabs $0x800c9e,%rax
+  8031d6:	00 00 00 
+  8031d9:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  8031db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8031e5:	bf 07 00 00 00       	mov    $0x7,%edi
+  8031ea:	48 b8 35 25 80 00 00 	movabs $0x802535,%rax
+  8031f1:	00 00 00 
+  8031f4:	ff d0                	call   *%rax
+}
+  8031f6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8031fa:	c9                   	leave
+  8031fb:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  8031fc:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803201:	eb f3                	jmp    8031f6 <remove+0x54>
+
+0000000000803203 <sync>:
+sync(void) {
+  803203:	55                   	push   %rbp
+  803204:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  803207:	48 b8 64 30 80 00 00 	movabs $0x803064,%rax
+  80320e:	00 00 00 
+  803211:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  803213:	ba 00 00 00 00       	mov    $0x0,%edx
+  803218:	be 00 00 00 00       	mov    $0x0,%esi
+  80321d:	bf 08 00 00 00       	mov    $0x8,%edi
+  803222:	48 b8 35 25 80 00 00 	movabs $0x802535,%rax
+  803229:	00 00 00 
+  80322c:	ff d0                	call   *%rax
+}
+  80322e:	5d                   	pop    %rbp
+  80322f:	c3                   	ret
+
+0000000000803230 <fsync>:
+fsync(int fdnum) {
+  803230:	55                   	push   %rbp
+  803231:	48 89 e5             	mov    %rsp,%rbp
+  803234:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803238:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80323c:	48 b8 de 17 80 00 00 	movabs $0x8017de,%rax
+  803243:	00 00 00 
+  803246:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803248:	85 c0                	test   %eax,%eax
+  80324a:	78 4b                	js     803297 <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80324c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803250:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  803257:	00 00 00 
+  80325a:	8b 00                	mov    (%rax),%eax
+  80325c:	39 02                	cmp    %eax,(%rdx)
+  80325e:	75 39                	jne    803299 <fsync+0x69>
+    file_flush_buffers();
+  803260:	48 b8 64 30 80 00 00 	movabs $0x803064,%rax
+  803267:	00 00 00 
+  80326a:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  80326c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803270:	8b 40 0c             	mov    0xc(%rax),%eax
+  803273:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  80327a:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  80327c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803281:	be 00 00 00 00       	mov    $0x0,%esi
+  803286:	bf 0d 00 00 00       	mov    $0xd,%edi
+  80328b:	48 b8 35 25 80 00 00 	movabs $0x802535,%rax
+  803292:	00 00 00 
+  803295:	ff d0                	call   *%rax
+}
+  803297:	c9                   	leave
+  803298:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803299:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80329e:	eb f7                	jmp    803297 <fsync+0x67>
+
+00000000008032a0 <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  8032a0:	55                   	push   %rbp
+  8032a1:	48 89 e5             	mov    %rsp,%rbp
+  8032a4:	53                   	push   %rbx
+  8032a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8032a9:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  8032ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8032b6:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8032bb:	48 b8 35 25 80 00 00 	movabs $0x802535,%rax
+  8032c2:	00 00 00 
+  8032c5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8032c7:	85 c0                	test   %eax,%eax
+  8032c9:	78 2d                	js     8032f8 <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  8032cb:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  8032d2:	00 00 00 
+  8032d5:	48 8b 10             	mov    (%rax),%rdx
+  8032d8:	48 89 13             	mov    %rdx,(%rbx)
+  8032db:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8032df:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  8032e3:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8032e7:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  8032eb:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8032ef:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  8032f3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032f8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8032fc:	c9                   	leave
+  8032fd:	c3                   	ret
+
+00000000008032fe <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  8032fe:	55                   	push   %rbp
+  8032ff:	48 89 e5             	mov    %rsp,%rbp
+  803302:	53                   	push   %rbx
+  803303:	48 83 ec 08          	sub    $0x8,%rsp
+  803307:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  80330a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80330f:	be 00 00 00 00       	mov    $0x0,%esi
+  803314:	bf 0c 00 00 00       	mov    $0xc,%edi
+  803319:	48 b8 35 25 80 00 00 	movabs $0x802535,%rax
+  803320:	00 00 00 
+  803323:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803325:	85 c0                	test   %eax,%eax
+  803327:	78 3d                	js     803366 <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  803329:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803330:	00 00 00 
+  803333:	48 8b 10             	mov    (%rax),%rdx
+  803336:	48 89 13             	mov    %rdx,(%rbx)
+  803339:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80333d:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  803341:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803345:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  803349:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  80334d:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  803351:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  803355:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  803359:	48 8b 40 28          	mov    0x28(%rax),%rax
+  80335d:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  803361:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803366:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80336a:	c9                   	leave
+  80336b:	c3                   	ret
+
+000000000080336c <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  80336c:	55                   	push   %rbp
+  80336d:	48 89 e5             	mov    %rsp,%rbp
+  803370:	41 57                	push   %r15
+  803372:	41 56                	push   %r14
+  803374:	41 55                	push   %r13
+  803376:	41 54                	push   %r12
+  803378:	53                   	push   %rbx
+  803379:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  80337d:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  803384:	00 
+  803385:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  80338c:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  803392:	0f 85 43 01 00 00    	jne    8034db <munmap+0x16f>
+  803398:	49 89 ff             	mov    %rdi,%r15
+  80339b:	4c 39 f7             	cmp    %r14,%rdi
+  80339e:	0f 87 37 01 00 00    	ja     8034db <munmap+0x16f>
+  8033a4:	48 bb 00 20 82 00 00 	movabs $0x822000,%rbx
+  8033ab:	00 00 00 
+  8033ae:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  8033b4:	eb 2c                	jmp    8033e2 <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  8033b6:	4c 39 f8             	cmp    %r15,%rax
+  8033b9:	0f 83 85 00 00 00    	jae    803444 <munmap+0xd8>
+            m->mm_end = start;
+  8033bf:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8033c4:	48 83 c3 18          	add    $0x18,%rbx
+  8033c8:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  8033cf:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8033d6:	00 00 00 
+  8033d9:	48 39 c3             	cmp    %rax,%rbx
+  8033dc:	0f 84 d0 00 00 00    	je     8034b2 <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  8033e2:	49 89 dc             	mov    %rbx,%r12
+  8033e5:	48 8b 03             	mov    (%rbx),%rax
+  8033e8:	4c 39 f0             	cmp    %r14,%rax
+  8033eb:	73 d7                	jae    8033c4 <munmap+0x58>
+  8033ed:	48 85 c0             	test   %rax,%rax
+  8033f0:	74 d2                	je     8033c4 <munmap+0x58>
+  8033f2:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8033f6:	49 39 d7             	cmp    %rdx,%r15
+  8033f9:	73 c9                	jae    8033c4 <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  8033fb:	49 39 d6             	cmp    %rdx,%r14
+  8033fe:	73 b6                	jae    8033b6 <munmap+0x4a>
+  803400:	49 39 c7             	cmp    %rax,%r15
+  803403:	76 b1                	jbe    8033b6 <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  803405:	4c 89 ef             	mov    %r13,%rdi
+  803408:	48 b8 a3 24 80 00 00 	movabs $0x8024a3,%rax
+  80340f:	00 00 00 
+  803412:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  803414:	48 85 c0             	test   %rax,%rax
+  803417:	0f 84 c5 00 00 00    	je     8034e2 <munmap+0x176>
+            *tail = *m;
+  80341d:	48 8b 13             	mov    (%rbx),%rdx
+  803420:	48 89 10             	mov    %rdx,(%rax)
+  803423:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  803427:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  80342b:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  80342f:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  803433:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  803436:	44 89 f2             	mov    %r14d,%edx
+  803439:	2b 13                	sub    (%rbx),%edx
+  80343b:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  80343e:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  803442:	eb 80                	jmp    8033c4 <munmap+0x58>
+        } else if (m->mm_end > end) {
+  803444:	49 39 d6             	cmp    %rdx,%r14
+  803447:	73 18                	jae    803461 <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  803449:	44 89 f2             	mov    %r14d,%edx
+  80344c:	41 03 54 24 10       	add    0x10(%r12),%edx
+  803451:	29 c2                	sub    %eax,%edx
+  803453:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  803458:	4d 89 34 24          	mov    %r14,(%r12)
+  80345c:	e9 63 ff ff ff       	jmp    8033c4 <munmap+0x58>
+    m->mm_start = 0;
+  803461:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  803468:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  803469:	4c 89 e6             	mov    %r12,%rsi
+  80346c:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  803473:	00 00 00 
+  803476:	48 29 c6             	sub    %rax,%rsi
+  803479:	48 c1 fe 03          	sar    $0x3,%rsi
+  80347d:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  803484:	aa aa aa 
+  803487:	48 0f af f0          	imul   %rax,%rsi
+  80348b:	48 c1 e6 0c          	shl    $0xc,%rsi
+  80348f:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  803494:	48 01 c6             	add    %rax,%rsi
+  803497:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80349c:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034a1:	48 b8 a3 12 80 00 00 	movabs $0x8012a3,%rax
+  8034a8:	00 00 00 
+  8034ab:	ff d0                	call   *%rax
+}
+  8034ad:	e9 12 ff ff ff       	jmp    8033c4 <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  8034b2:	4c 89 f2             	mov    %r14,%rdx
+  8034b5:	4c 29 fa             	sub    %r15,%rdx
+  8034b8:	4c 89 fe             	mov    %r15,%rsi
+  8034bb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034c0:	48 b8 a3 12 80 00 00 	movabs $0x8012a3,%rax
+  8034c7:	00 00 00 
+  8034ca:	ff d0                	call   *%rax
+}
+  8034cc:	48 83 c4 08          	add    $0x8,%rsp
+  8034d0:	5b                   	pop    %rbx
+  8034d1:	41 5c                	pop    %r12
+  8034d3:	41 5d                	pop    %r13
+  8034d5:	41 5e                	pop    %r14
+  8034d7:	41 5f                	pop    %r15
+  8034d9:	5d                   	pop    %rbp
+  8034da:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  8034db:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8034e0:	eb ea                	jmp    8034cc <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  8034e2:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  8034e7:	eb e3                	jmp    8034cc <munmap+0x160>
+
+00000000008034e9 <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  8034e9:	55                   	push   %rbp
+  8034ea:	48 89 e5             	mov    %rsp,%rbp
+  8034ed:	41 57                	push   %r15
+  8034ef:	41 56                	push   %r14
+  8034f1:	41 55                	push   %r13
+  8034f3:	41 54                	push   %r12
+  8034f5:	53                   	push   %rbx
+  8034f6:	48 83 ec 28          	sub    $0x28,%rsp
+  8034fa:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8034fe:	49 89 f5             	mov    %rsi,%r13
+  803501:	41 89 d6             	mov    %edx,%r14d
+  803504:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  803507:	41 89 cc             	mov    %ecx,%r12d
+  80350a:	44 89 c7             	mov    %r8d,%edi
+  80350d:	44 89 cb             	mov    %r9d,%ebx
+  803510:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803514:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803518:	48 b8 de 17 80 00 00 	movabs $0x8017de,%rax
+  80351f:	00 00 00 
+  803522:	ff d0                	call   *%rax
+  803524:	41 89 c7             	mov    %eax,%r15d
+  803527:	85 c0                	test   %eax,%eax
+  803529:	0f 88 ae 01 00 00    	js     8036dd <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80352f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803533:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  80353a:	00 00 00 
+  80353d:	8b 32                	mov    (%rdx),%esi
+  80353f:	39 30                	cmp    %esi,(%rax)
+  803541:	0f 85 7a 02 00 00    	jne    8037c1 <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  803547:	8b 40 08             	mov    0x8(%rax),%eax
+  80354a:	83 e0 03             	and    $0x3,%eax
+  80354d:	83 f8 01             	cmp    $0x1,%eax
+  803550:	0f 84 76 02 00 00    	je     8037cc <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  803556:	4d 85 ed             	test   %r13,%r13
+  803559:	0f 84 78 02 00 00    	je     8037d7 <mmap+0x2ee>
+  80355f:	85 db                	test   %ebx,%ebx
+  803561:	0f 88 70 02 00 00    	js     8037d7 <mmap+0x2ee>
+  803567:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  80356d:	41 89 df             	mov    %ebx,%r15d
+  803570:	0f 85 6c 02 00 00    	jne    8037e2 <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  803576:	44 89 f0             	mov    %r14d,%eax
+  803579:	83 e0 fd             	and    $0xfffffffd,%eax
+  80357c:	83 f8 04             	cmp    $0x4,%eax
+  80357f:	0f 85 68 02 00 00    	jne    8037ed <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  803585:	44 89 e1             	mov    %r12d,%ecx
+  803588:	83 e1 01             	and    $0x1,%ecx
+  80358b:	0f 95 c2             	setne  %dl
+  80358e:	44 89 e0             	mov    %r12d,%eax
+  803591:	d1 e8                	shr    %eax
+  803593:	83 f0 01             	xor    $0x1,%eax
+  803596:	83 e0 01             	and    $0x1,%eax
+  803599:	38 c2                	cmp    %al,%dl
+  80359b:	0f 85 57 02 00 00    	jne    8037f8 <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  8035a1:	85 c9                	test   %ecx,%ecx
+  8035a3:	74 0a                	je     8035af <mmap+0xc6>
+  8035a5:	41 f6 c6 02          	test   $0x2,%r14b
+  8035a9:	0f 85 54 02 00 00    	jne    803803 <mmap+0x31a>
+    file_flush_buffers();
+  8035af:	48 b8 64 30 80 00 00 	movabs $0x803064,%rax
+  8035b6:	00 00 00 
+  8035b9:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  8035bb:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  8035c2:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  8035c9:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8035cd:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  8035d0:	41 f6 c4 04          	test   $0x4,%r12b
+  8035d4:	0f 84 15 01 00 00    	je     8036ef <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  8035da:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  8035dd:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8035e3:	0f 85 25 02 00 00    	jne    80380e <mmap+0x325>
+  8035e9:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  8035ed:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  8035f4:	00 00 00 
+  8035f7:	48 39 c2             	cmp    %rax,%rdx
+  8035fa:	0f 82 19 02 00 00    	jb     803819 <mmap+0x330>
+  803600:	48 39 c7             	cmp    %rax,%rdi
+  803603:	0f 87 10 02 00 00    	ja     803819 <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  803609:	4c 89 ee             	mov    %r13,%rsi
+  80360c:	48 b8 6c 33 80 00 00 	movabs $0x80336c,%rax
+  803613:	00 00 00 
+  803616:	ff d0                	call   *%rax
+  803618:	85 c0                	test   %eax,%eax
+  80361a:	0f 88 04 02 00 00    	js     803824 <mmap+0x33b>
+    if (!handler) {
+  803620:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  803627:	00 00 00 
+  80362a:	80 38 00             	cmpb   $0x0,(%rax)
+  80362d:	75 2b                	jne    80365a <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  80362f:	48 bf 04 24 80 00 00 	movabs $0x802404,%rdi
+  803636:	00 00 00 
+  803639:	48 b8 c5 44 80 00 00 	movabs $0x8044c5,%rax
+  803640:	00 00 00 
+  803643:	ff d0                	call   *%rax
+  803645:	85 c0                	test   %eax,%eax
+  803647:	0f 88 ea 01 00 00    	js     803837 <mmap+0x34e>
+        handler = 1;
+  80364d:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  803654:	00 00 00 
+  803657:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  80365a:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80365e:	48 b8 a3 24 80 00 00 	movabs $0x8024a3,%rax
+  803665:	00 00 00 
+  803668:	ff d0                	call   *%rax
+  80366a:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  80366d:	48 85 c0             	test   %rax,%rax
+  803670:	0f 84 c9 01 00 00    	je     80383f <mmap+0x356>
+    m->mm_start = va;
+  803676:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  803679:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  80367d:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  803681:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  803684:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  803688:	44 89 e0             	mov    %r12d,%eax
+  80368b:	c1 e0 06             	shl    $0x6,%eax
+  80368e:	25 80 00 00 00       	and    $0x80,%eax
+  803693:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  803696:	09 f0                	or     %esi,%eax
+  803698:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  80369c:	41 f6 c4 08          	test   $0x8,%r12b
+  8036a0:	74 31                	je     8036d3 <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  8036a2:	48 39 d3             	cmp    %rdx,%rbx
+  8036a5:	73 2c                	jae    8036d3 <mmap+0x1ea>
+  8036a7:	ba 00 00 04 00       	mov    $0x40000,%edx
+  8036ac:	48 89 de             	mov    %rbx,%rsi
+  8036af:	4c 89 f7             	mov    %r14,%rdi
+  8036b2:	48 b8 f3 22 80 00 00 	movabs $0x8022f3,%rax
+  8036b9:	00 00 00 
+  8036bc:	ff d0                	call   *%rax
+  8036be:	49 89 c4             	mov    %rax,%r12
+  8036c1:	48 85 c0             	test   %rax,%rax
+  8036c4:	0f 8e d7 00 00 00    	jle    8037a1 <mmap+0x2b8>
+            va += n;
+  8036ca:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  8036cd:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  8036d1:	72 d4                	jb     8036a7 <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  8036d3:	49 8b 06             	mov    (%r14),%rax
+  8036d6:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  8036da:	48 89 06             	mov    %rax,(%rsi)
+}
+  8036dd:	44 89 f8             	mov    %r15d,%eax
+  8036e0:	48 83 c4 28          	add    $0x28,%rsp
+  8036e4:	5b                   	pop    %rbx
+  8036e5:	41 5c                	pop    %r12
+  8036e7:	41 5d                	pop    %r13
+  8036e9:	41 5e                	pop    %r14
+  8036eb:	41 5f                	pop    %r15
+  8036ed:	5d                   	pop    %rbp
+  8036ee:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8036ef:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  8036f6:	00 00 00 
+  8036f9:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  8036fc:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  803703:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803706:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  80370b:	48 be 00 20 82 00 00 	movabs $0x822000,%rsi
+  803712:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803715:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  80371c:	00 00 00 
+  80371f:	48 39 d7             	cmp    %rdx,%rdi
+  803722:	73 1c                	jae    803740 <mmap+0x257>
+        return -E_NO_MEM;
+  803724:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80372a:	eb b1                	jmp    8036dd <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80372c:	48 83 c0 01          	add    $0x1,%rax
+  803730:	48 83 f8 1f          	cmp    $0x1f,%rax
+  803734:	77 3f                	ja     803775 <mmap+0x28c>
+  803736:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  80373b:	48 39 d7             	cmp    %rdx,%rdi
+  80373e:	72 2a                	jb     80376a <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  803740:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  803744:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  803748:	48 39 d1             	cmp    %rdx,%rcx
+  80374b:	73 df                	jae    80372c <mmap+0x243>
+  80374d:	48 85 c9             	test   %rcx,%rcx
+  803750:	74 da                	je     80372c <mmap+0x243>
+  803752:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  803756:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  80375b:	48 39 d3             	cmp    %rdx,%rbx
+  80375e:	73 cc                	jae    80372c <mmap+0x243>
+            va = mmaps[i].mm_end;
+  803760:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803763:	b8 00 00 00 00       	mov    $0x0,%eax
+  803768:	eb cc                	jmp    803736 <mmap+0x24d>
+        return -E_NO_MEM;
+  80376a:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803770:	e9 68 ff ff ff       	jmp    8036dd <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  803775:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  80377a:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  803781:	00 00 00 
+  803784:	48 39 c2             	cmp    %rax,%rdx
+  803787:	0f 82 9f 00 00 00    	jb     80382c <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  80378d:	48 85 db             	test   %rbx,%rbx
+  803790:	0f 85 8a fe ff ff    	jne    803620 <mmap+0x137>
+        return -E_NO_MEM;
+  803796:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80379c:	e9 3c ff ff ff       	jmp    8036dd <mmap+0x1f4>
+        if (n < 0) {
+  8037a1:	0f 89 2c ff ff ff    	jns    8036d3 <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  8037a7:	49 8b 3e             	mov    (%r14),%rdi
+  8037aa:	4c 89 ee             	mov    %r13,%rsi
+  8037ad:	48 b8 6c 33 80 00 00 	movabs $0x80336c,%rax
+  8037b4:	00 00 00 
+  8037b7:	ff d0                	call   *%rax
+            return n;
+  8037b9:	45 89 e7             	mov    %r12d,%r15d
+  8037bc:	e9 1c ff ff ff       	jmp    8036dd <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8037c1:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8037c7:	e9 11 ff ff ff       	jmp    8036dd <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  8037cc:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8037d2:	e9 06 ff ff ff       	jmp    8036dd <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  8037d7:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8037dd:	e9 fb fe ff ff       	jmp    8036dd <mmap+0x1f4>
+  8037e2:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8037e8:	e9 f0 fe ff ff       	jmp    8036dd <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  8037ed:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8037f3:	e9 e5 fe ff ff       	jmp    8036dd <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  8037f8:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8037fe:	e9 da fe ff ff       	jmp    8036dd <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  803803:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  803809:	e9 cf fe ff ff       	jmp    8036dd <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  80380e:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803814:	e9 c4 fe ff ff       	jmp    8036dd <mmap+0x1f4>
+  803819:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80381f:	e9 b9 fe ff ff       	jmp    8036dd <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  803824:	41 89 c7             	mov    %eax,%r15d
+  803827:	e9 b1 fe ff ff       	jmp    8036dd <mmap+0x1f4>
+        return -E_NO_MEM;
+  80382c:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803832:	e9 a6 fe ff ff       	jmp    8036dd <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  803837:	41 89 c7             	mov    %eax,%r15d
+  80383a:	e9 9e fe ff ff       	jmp    8036dd <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  80383f:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803845:	e9 93 fe ff ff       	jmp    8036dd <mmap+0x1f4>
+
+000000000080384a <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80384a:	55                   	push   %rbp
+  80384b:	48 89 e5             	mov    %rsp,%rbp
+  80384e:	41 54                	push   %r12
+  803850:	53                   	push   %rbx
+  803851:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803854:	48 b8 62 17 80 00 00 	movabs $0x801762,%rax
+  80385b:	00 00 00 
+  80385e:	ff d0                	call   *%rax
+  803860:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803863:	48 be a0 4f 80 00 00 	movabs $0x804fa0,%rsi
+  80386a:	00 00 00 
+  80386d:	48 89 df             	mov    %rbx,%rdi
+  803870:	48 b8 9e 0c 80 00 00 	movabs $0x800c9e,%rax
+  803877:	00 00 00 
+  80387a:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  80387c:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803881:	41 2b 04 24          	sub    (%r12),%eax
+  803885:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  80388b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803892:	00 00 00 
+    stat->st_dev = &devpipe;
+  803895:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  80389c:	00 00 00 
+  80389f:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8038a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038ab:	5b                   	pop    %rbx
+  8038ac:	41 5c                	pop    %r12
+  8038ae:	5d                   	pop    %rbp
+  8038af:	c3                   	ret
+
+00000000008038b0 <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  8038b0:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8038b3:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  8038b9:	8b 17                	mov    (%rdi),%edx
+  8038bb:	85 d2                	test   %edx,%edx
+  8038bd:	75 01                	jne    8038c0 <pipe_wakeup+0x10>
+  8038bf:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  8038c0:	55                   	push   %rbp
+  8038c1:	48 89 e5             	mov    %rsp,%rbp
+  8038c4:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  8038c7:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  8038cd:	be 00 04 00 00       	mov    $0x400,%esi
+  8038d2:	48 b8 89 15 80 00 00 	movabs $0x801589,%rax
+  8038d9:	00 00 00 
+  8038dc:	ff d0                	call   *%rax
+}
+  8038de:	5d                   	pop    %rbp
+  8038df:	c3                   	ret
+
+00000000008038e0 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8038e0:	55                   	push   %rbp
+  8038e1:	48 89 e5             	mov    %rsp,%rbp
+  8038e4:	41 55                	push   %r13
+  8038e6:	41 54                	push   %r12
+  8038e8:	53                   	push   %rbx
+  8038e9:	48 83 ec 08          	sub    $0x8,%rsp
+  8038ed:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8038f0:	48 b8 62 17 80 00 00 	movabs $0x801762,%rax
+  8038f7:	00 00 00 
+  8038fa:	ff d0                	call   *%rax
+  8038fc:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8038ff:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803904:	4c 89 e6             	mov    %r12,%rsi
+  803907:	bf 00 00 00 00       	mov    $0x0,%edi
+  80390c:	49 bc a3 12 80 00 00 	movabs $0x8012a3,%r12
+  803913:	00 00 00 
+  803916:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803919:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  80391d:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803921:	49 bd b0 38 80 00 00 	movabs $0x8038b0,%r13
+  803928:	00 00 00 
+  80392b:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  80392e:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803932:	48 89 de             	mov    %rbx,%rsi
+  803935:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  803938:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80393d:	48 89 de             	mov    %rbx,%rsi
+  803940:	bf 00 00 00 00       	mov    $0x0,%edi
+  803945:	41 ff d4             	call   *%r12
+  803948:	48 83 c4 08          	add    $0x8,%rsp
+  80394c:	5b                   	pop    %rbx
+  80394d:	41 5c                	pop    %r12
+  80394f:	41 5d                	pop    %r13
+  803951:	5d                   	pop    %rbp
+  803952:	c3                   	ret
+
+0000000000803953 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  803953:	55                   	push   %rbp
+  803954:	48 89 e5             	mov    %rsp,%rbp
+  803957:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80395a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80395f:	be 00 10 00 00       	mov    $0x1000,%esi
+  803964:	48 b8 e6 11 80 00 00 	movabs $0x8011e6,%rax
+  80396b:	00 00 00 
+  80396e:	ff d0                	call   *%rax
+  803970:	85 c0                	test   %eax,%eax
+  803972:	0f 94 c0             	sete   %al
+  803975:	0f b6 c0             	movzbl %al,%eax
+}
+  803978:	5d                   	pop    %rbp
+  803979:	c3                   	ret
+
+000000000080397a <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80397a:	55                   	push   %rbp
+  80397b:	48 89 e5             	mov    %rsp,%rbp
+  80397e:	41 57                	push   %r15
+  803980:	41 56                	push   %r14
+  803982:	41 55                	push   %r13
+  803984:	41 54                	push   %r12
+  803986:	53                   	push   %rbx
+  803987:	48 83 ec 38          	sub    $0x38,%rsp
+  80398b:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80398f:	49 89 f4             	mov    %rsi,%r12
+  803992:	49 89 d7             	mov    %rdx,%r15
+  803995:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803999:	48 b8 62 17 80 00 00 	movabs $0x801762,%rax
+  8039a0:	00 00 00 
+  8039a3:	ff d0                	call   *%rax
+  8039a5:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8039a8:	4d 85 ff             	test   %r15,%r15
+  8039ab:	0f 84 f1 00 00 00    	je     803aa2 <devpipe_write+0x128>
+  8039b1:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  8039b5:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  8039b9:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  8039bd:	49 bd 53 39 80 00 00 	movabs $0x803953,%r13
+  8039c4:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8039c7:	49 bf b0 38 80 00 00 	movabs $0x8038b0,%r15
+  8039ce:	00 00 00 
+  8039d1:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  8039d5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8039d9:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8039dd:	8b 73 04             	mov    0x4(%rbx),%esi
+  8039e0:	48 63 ce             	movslq %esi,%rcx
+  8039e3:	48 63 03             	movslq (%rbx),%rax
+  8039e6:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  8039ec:	48 39 c1             	cmp    %rax,%rcx
+  8039ef:	72 64                	jb     803a55 <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  8039f1:	48 89 de             	mov    %rbx,%rsi
+  8039f4:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8039f8:	41 ff d5             	call   *%r13
+  8039fb:	85 c0                	test   %eax,%eax
+  8039fd:	0f 85 b9 00 00 00    	jne    803abc <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803a03:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803a07:	4c 89 f7             	mov    %r14,%rdi
+  803a0a:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  803a0d:	8b 43 04             	mov    0x4(%rbx),%eax
+  803a10:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  803a17:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803a1e:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803a24:	8b 03                	mov    (%rbx),%eax
+  803a26:	41 39 c4             	cmp    %eax,%r12d
+  803a29:	75 b2                	jne    8039dd <devpipe_write+0x63>
+  803a2b:	48 89 de             	mov    %rbx,%rsi
+  803a2e:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803a32:	41 ff d5             	call   *%r13
+  803a35:	85 c0                	test   %eax,%eax
+  803a37:	75 a0                	jne    8039d9 <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803a39:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803a3e:	44 89 e6             	mov    %r12d,%esi
+  803a41:	48 89 df             	mov    %rbx,%rdi
+  803a44:	48 b8 6b 15 80 00 00 	movabs $0x80156b,%rax
+  803a4b:	00 00 00 
+  803a4e:	ff d0                	call   *%rax
+  803a50:	e9 7c ff ff ff       	jmp    8039d1 <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803a55:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  803a59:	41 0f b6 38          	movzbl (%r8),%edi
+  803a5d:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803a64:	80 80 80 
+  803a67:	48 89 c8             	mov    %rcx,%rax
+  803a6a:	48 f7 e2             	mul    %rdx
+  803a6d:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803a71:	48 89 d0             	mov    %rdx,%rax
+  803a74:	48 c1 e0 08          	shl    $0x8,%rax
+  803a78:	48 29 d0             	sub    %rdx,%rax
+  803a7b:	48 c1 e0 04          	shl    $0x4,%rax
+  803a7f:	48 29 c1             	sub    %rax,%rcx
+  803a82:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  803a87:	83 c6 01             	add    $0x1,%esi
+  803a8a:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803a8d:	49 83 c0 01          	add    $0x1,%r8
+  803a91:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  803a95:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803a99:	49 39 c0             	cmp    %rax,%r8
+  803a9c:	0f 85 2f ff ff ff    	jne    8039d1 <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803aa2:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803aa6:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803aaa:	48 b8 b0 38 80 00 00 	movabs $0x8038b0,%rax
+  803ab1:	00 00 00 
+  803ab4:	ff d0                	call   *%rax
+    return n;
+  803ab6:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803aba:	eb 05                	jmp    803ac1 <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  803abc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ac1:	48 83 c4 38          	add    $0x38,%rsp
+  803ac5:	5b                   	pop    %rbx
+  803ac6:	41 5c                	pop    %r12
+  803ac8:	41 5d                	pop    %r13
+  803aca:	41 5e                	pop    %r14
+  803acc:	41 5f                	pop    %r15
+  803ace:	5d                   	pop    %rbp
+  803acf:	c3                   	ret
+
+0000000000803ad0 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803ad0:	55                   	push   %rbp
+  803ad1:	48 89 e5             	mov    %rsp,%rbp
+  803ad4:	41 57                	push   %r15
+  803ad6:	41 56                	push   %r14
+  803ad8:	41 55                	push   %r13
+  803ada:	41 54                	push   %r12
+  803adc:	53                   	push   %rbx
+  803add:	48 83 ec 28          	sub    $0x28,%rsp
+  803ae1:	49 89 fd             	mov    %rdi,%r13
+  803ae4:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  803ae8:	49 89 d4             	mov    %rdx,%r12
+  803aeb:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803aef:	48 b8 62 17 80 00 00 	movabs $0x801762,%rax
+  803af6:	00 00 00 
+  803af9:	ff d0                	call   *%rax
+  803afb:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803afe:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  803b04:	49 bf 53 39 80 00 00 	movabs $0x803953,%r15
+  803b0b:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803b0e:	4d 85 e4             	test   %r12,%r12
+  803b11:	0f 84 d5 00 00 00    	je     803bec <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803b17:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803b1b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803b1f:	8b 03                	mov    (%rbx),%eax
+  803b21:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803b24:	75 7a                	jne    803ba0 <devpipe_read+0xd0>
+            if (i > 0) {
+  803b26:	4d 85 f6             	test   %r14,%r14
+  803b29:	75 50                	jne    803b7b <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  803b2b:	48 89 de             	mov    %rbx,%rsi
+  803b2e:	4c 89 ef             	mov    %r13,%rdi
+  803b31:	41 ff d7             	call   *%r15
+  803b34:	85 c0                	test   %eax,%eax
+  803b36:	0f 85 c9 00 00 00    	jne    803c05 <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803b3c:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  803b3f:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803b46:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803b4c:	8b 43 04             	mov    0x4(%rbx),%eax
+  803b4f:	41 39 c4             	cmp    %eax,%r12d
+  803b52:	75 cb                	jne    803b1f <devpipe_read+0x4f>
+  803b54:	48 89 de             	mov    %rbx,%rsi
+  803b57:	4c 89 ef             	mov    %r13,%rdi
+  803b5a:	41 ff d7             	call   *%r15
+  803b5d:	85 c0                	test   %eax,%eax
+  803b5f:	75 be                	jne    803b1f <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803b61:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803b66:	44 89 e6             	mov    %r12d,%esi
+  803b69:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803b6d:	48 b8 6b 15 80 00 00 	movabs $0x80156b,%rax
+  803b74:	00 00 00 
+  803b77:	ff d0                	call   *%rax
+  803b79:	eb a4                	jmp    803b1f <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803b7b:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803b7f:	48 89 de             	mov    %rbx,%rsi
+  803b82:	48 b8 b0 38 80 00 00 	movabs $0x8038b0,%rax
+  803b89:	00 00 00 
+  803b8c:	ff d0                	call   *%rax
+                return i;
+  803b8e:	4c 89 f0             	mov    %r14,%rax
+}
+  803b91:	48 83 c4 28          	add    $0x28,%rsp
+  803b95:	5b                   	pop    %rbx
+  803b96:	41 5c                	pop    %r12
+  803b98:	41 5d                	pop    %r13
+  803b9a:	41 5e                	pop    %r14
+  803b9c:	41 5f                	pop    %r15
+  803b9e:	5d                   	pop    %rbp
+  803b9f:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803ba0:	48 63 c8             	movslq %eax,%rcx
+  803ba3:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803baa:	80 80 80 
+  803bad:	48 89 c8             	mov    %rcx,%rax
+  803bb0:	48 f7 e2             	mul    %rdx
+  803bb3:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803bb7:	48 89 d0             	mov    %rdx,%rax
+  803bba:	48 c1 e0 08          	shl    $0x8,%rax
+  803bbe:	48 29 d0             	sub    %rdx,%rax
+  803bc1:	48 c1 e0 04          	shl    $0x4,%rax
+  803bc5:	48 89 c2             	mov    %rax,%rdx
+  803bc8:	48 89 c8             	mov    %rcx,%rax
+  803bcb:	48 29 d0             	sub    %rdx,%rax
+  803bce:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  803bd3:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803bd7:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  803bdb:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803bde:	49 83 c6 01          	add    $0x1,%r14
+  803be2:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  803be6:	0f 85 2b ff ff ff    	jne    803b17 <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803bec:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803bf0:	48 89 de             	mov    %rbx,%rsi
+  803bf3:	48 b8 b0 38 80 00 00 	movabs $0x8038b0,%rax
+  803bfa:	00 00 00 
+  803bfd:	ff d0                	call   *%rax
+    return n;
+  803bff:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803c03:	eb 8c                	jmp    803b91 <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  803c05:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c0a:	eb 85                	jmp    803b91 <devpipe_read+0xc1>
+
+0000000000803c0c <pipe>:
+pipe(int pfd[2]) {
+  803c0c:	55                   	push   %rbp
+  803c0d:	48 89 e5             	mov    %rsp,%rbp
+  803c10:	41 55                	push   %r13
+  803c12:	41 54                	push   %r12
+  803c14:	53                   	push   %rbx
+  803c15:	48 83 ec 18          	sub    $0x18,%rsp
+  803c19:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803c1c:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803c20:	48 b8 7e 17 80 00 00 	movabs $0x80177e,%rax
+  803c27:	00 00 00 
+  803c2a:	ff d0                	call   *%rax
+  803c2c:	89 c3                	mov    %eax,%ebx
+  803c2e:	85 c0                	test   %eax,%eax
+  803c30:	0f 88 a0 01 00 00    	js     803dd6 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803c36:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803c3b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c40:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803c44:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c49:	48 b8 fd 11 80 00 00 	movabs $0x8011fd,%rax
+  803c50:	00 00 00 
+  803c53:	ff d0                	call   *%rax
+  803c55:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803c57:	85 c0                	test   %eax,%eax
+  803c59:	0f 88 77 01 00 00    	js     803dd6 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803c5f:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803c63:	48 b8 7e 17 80 00 00 	movabs $0x80177e,%rax
+  803c6a:	00 00 00 
+  803c6d:	ff d0                	call   *%rax
+  803c6f:	89 c3                	mov    %eax,%ebx
+  803c71:	85 c0                	test   %eax,%eax
+  803c73:	0f 88 43 01 00 00    	js     803dbc <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803c79:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803c7e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c83:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803c87:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c8c:	48 b8 fd 11 80 00 00 	movabs $0x8011fd,%rax
+  803c93:	00 00 00 
+  803c96:	ff d0                	call   *%rax
+  803c98:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803c9a:	85 c0                	test   %eax,%eax
+  803c9c:	0f 88 1a 01 00 00    	js     803dbc <pipe+0x1b0>
+    va = fd2data(fd0);
+  803ca2:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803ca6:	48 b8 62 17 80 00 00 	movabs $0x801762,%rax
+  803cad:	00 00 00 
+  803cb0:	ff d0                	call   *%rax
+  803cb2:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803cb5:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803cba:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803cbf:	48 89 c6             	mov    %rax,%rsi
+  803cc2:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cc7:	48 b8 fd 11 80 00 00 	movabs $0x8011fd,%rax
+  803cce:	00 00 00 
+  803cd1:	ff d0                	call   *%rax
+  803cd3:	89 c3                	mov    %eax,%ebx
+  803cd5:	85 c0                	test   %eax,%eax
+  803cd7:	0f 88 c5 00 00 00    	js     803da2 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803cdd:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803ce1:	48 b8 62 17 80 00 00 	movabs $0x801762,%rax
+  803ce8:	00 00 00 
+  803ceb:	ff d0                	call   *%rax
+  803ced:	48 89 c1             	mov    %rax,%rcx
+  803cf0:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803cf6:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803cfc:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d01:	4c 89 ee             	mov    %r13,%rsi
+  803d04:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d09:	48 b8 53 12 80 00 00 	movabs $0x801253,%rax
+  803d10:	00 00 00 
+  803d13:	ff d0                	call   *%rax
+  803d15:	89 c3                	mov    %eax,%ebx
+  803d17:	85 c0                	test   %eax,%eax
+  803d19:	78 6e                	js     803d89 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803d1b:	be 00 10 00 00       	mov    $0x1000,%esi
+  803d20:	4c 89 ef             	mov    %r13,%rdi
+  803d23:	48 b8 c2 11 80 00 00 	movabs $0x8011c2,%rax
+  803d2a:	00 00 00 
+  803d2d:	ff d0                	call   *%rax
+  803d2f:	83 f8 02             	cmp    $0x2,%eax
+  803d32:	0f 85 ab 00 00 00    	jne    803de3 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803d38:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803d3f:	00 00 
+  803d41:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803d45:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803d47:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803d4b:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803d52:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803d56:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803d58:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803d5c:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803d63:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803d67:	48 bb 50 17 80 00 00 	movabs $0x801750,%rbx
+  803d6e:	00 00 00 
+  803d71:	ff d3                	call   *%rbx
+  803d73:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803d77:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803d7b:	ff d3                	call   *%rbx
+  803d7d:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803d82:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803d87:	eb 4d                	jmp    803dd6 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803d89:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d8e:	4c 89 ee             	mov    %r13,%rsi
+  803d91:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d96:	48 b8 a3 12 80 00 00 	movabs $0x8012a3,%rax
+  803d9d:	00 00 00 
+  803da0:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803da2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803da7:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803dab:	bf 00 00 00 00       	mov    $0x0,%edi
+  803db0:	48 b8 a3 12 80 00 00 	movabs $0x8012a3,%rax
+  803db7:	00 00 00 
+  803dba:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803dbc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803dc1:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803dc5:	bf 00 00 00 00       	mov    $0x0,%edi
+  803dca:	48 b8 a3 12 80 00 00 	movabs $0x8012a3,%rax
+  803dd1:	00 00 00 
+  803dd4:	ff d0                	call   *%rax
+}
+  803dd6:	89 d8                	mov    %ebx,%eax
+  803dd8:	48 83 c4 18          	add    $0x18,%rsp
+  803ddc:	5b                   	pop    %rbx
+  803ddd:	41 5c                	pop    %r12
+  803ddf:	41 5d                	pop    %r13
+  803de1:	5d                   	pop    %rbp
+  803de2:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803de3:	48 b9 d0 4f 80 00 00 	movabs $0x804fd0,%rcx
+  803dea:	00 00 00 
+  803ded:	48 ba a7 4f 80 00 00 	movabs $0x804fa7,%rdx
+  803df4:	00 00 00 
+  803df7:	be 50 00 00 00       	mov    $0x50,%esi
+  803dfc:	48 bf bc 4f 80 00 00 	movabs $0x804fbc,%rdi
+  803e03:	00 00 00 
+  803e06:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e0b:	49 b8 29 02 80 00 00 	movabs $0x800229,%r8
+  803e12:	00 00 00 
+  803e15:	41 ff d0             	call   *%r8
+
+0000000000803e18 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803e18:	55                   	push   %rbp
+  803e19:	48 89 e5             	mov    %rsp,%rbp
+  803e1c:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803e20:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803e24:	48 b8 de 17 80 00 00 	movabs $0x8017de,%rax
+  803e2b:	00 00 00 
+  803e2e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803e30:	85 c0                	test   %eax,%eax
+  803e32:	78 23                	js     803e57 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803e34:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803e38:	48 b8 62 17 80 00 00 	movabs $0x801762,%rax
+  803e3f:	00 00 00 
+  803e42:	ff d0                	call   *%rax
+  803e44:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  803e47:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803e4b:	48 b8 53 39 80 00 00 	movabs $0x803953,%rax
+  803e52:	00 00 00 
+  803e55:	ff d0                	call   *%rax
+}
+  803e57:	c9                   	leave
+  803e58:	c3                   	ret
+
+0000000000803e59 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803e59:	48 89 f8             	mov    %rdi,%rax
+  803e5c:	48 c1 e8 27          	shr    $0x27,%rax
+  803e60:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803e67:	01 00 00 
+  803e6a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e6e:	f6 c2 01             	test   $0x1,%dl
+  803e71:	74 6d                	je     803ee0 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803e73:	48 89 f8             	mov    %rdi,%rax
+  803e76:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803e7a:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803e81:	01 00 00 
+  803e84:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e88:	f6 c2 01             	test   $0x1,%dl
+  803e8b:	74 62                	je     803eef <get_uvpt_entry+0x96>
+  803e8d:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803e94:	01 00 00 
+  803e97:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e9b:	f6 c2 80             	test   $0x80,%dl
+  803e9e:	75 4f                	jne    803eef <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803ea0:	48 89 f8             	mov    %rdi,%rax
+  803ea3:	48 c1 e8 15          	shr    $0x15,%rax
+  803ea7:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803eae:	01 00 00 
+  803eb1:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803eb5:	f6 c2 01             	test   $0x1,%dl
+  803eb8:	74 44                	je     803efe <get_uvpt_entry+0xa5>
+  803eba:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803ec1:	01 00 00 
+  803ec4:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803ec8:	f6 c2 80             	test   $0x80,%dl
+  803ecb:	75 31                	jne    803efe <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803ecd:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803ed1:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803ed8:	01 00 00 
+  803edb:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803edf:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803ee0:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803ee7:	01 00 00 
+  803eea:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803eee:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803eef:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803ef6:	01 00 00 
+  803ef9:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803efd:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803efe:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803f05:	01 00 00 
+  803f08:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803f0c:	c3                   	ret
+
+0000000000803f0d <get_prot>:
+
+int
+get_prot(void *va) {
+  803f0d:	55                   	push   %rbp
+  803f0e:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803f11:	48 b8 59 3e 80 00 00 	movabs $0x803e59,%rax
+  803f18:	00 00 00 
+  803f1b:	ff d0                	call   *%rax
+  803f1d:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803f20:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803f25:	89 c1                	mov    %eax,%ecx
+  803f27:	83 c9 04             	or     $0x4,%ecx
+  803f2a:	f6 c2 01             	test   $0x1,%dl
+  803f2d:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803f30:	89 c1                	mov    %eax,%ecx
+  803f32:	83 c9 02             	or     $0x2,%ecx
+  803f35:	f6 c2 02             	test   $0x2,%dl
+  803f38:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803f3b:	89 c1                	mov    %eax,%ecx
+  803f3d:	83 c9 01             	or     $0x1,%ecx
+  803f40:	48 85 d2             	test   %rdx,%rdx
+  803f43:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803f46:	89 c1                	mov    %eax,%ecx
+  803f48:	83 c9 40             	or     $0x40,%ecx
+  803f4b:	f6 c6 04             	test   $0x4,%dh
+  803f4e:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803f51:	5d                   	pop    %rbp
+  803f52:	c3                   	ret
+
+0000000000803f53 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803f53:	55                   	push   %rbp
+  803f54:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803f57:	48 b8 59 3e 80 00 00 	movabs $0x803e59,%rax
+  803f5e:	00 00 00 
+  803f61:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803f63:	48 c1 e8 06          	shr    $0x6,%rax
+  803f67:	83 e0 01             	and    $0x1,%eax
+}
+  803f6a:	5d                   	pop    %rbp
+  803f6b:	c3                   	ret
+
+0000000000803f6c <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803f6c:	55                   	push   %rbp
+  803f6d:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803f70:	48 b8 59 3e 80 00 00 	movabs $0x803e59,%rax
+  803f77:	00 00 00 
+  803f7a:	ff d0                	call   *%rax
+  803f7c:	83 e0 01             	and    $0x1,%eax
+}
+  803f7f:	5d                   	pop    %rbp
+  803f80:	c3                   	ret
+
+0000000000803f81 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  803f81:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  803f88:	01 00 00 
+  803f8b:	a8 01                	test   $0x1,%al
+  803f8d:	75 06                	jne    803f95 <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  803f8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f94:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803f95:	55                   	push   %rbp
+  803f96:	48 89 e5             	mov    %rsp,%rbp
+  803f99:	41 57                	push   %r15
+  803f9b:	41 56                	push   %r14
+  803f9d:	41 55                	push   %r13
+  803f9f:	41 54                	push   %r12
+  803fa1:	53                   	push   %rbx
+  803fa2:	48 83 ec 28          	sub    $0x28,%rsp
+  803fa6:	49 89 fe             	mov    %rdi,%r14
+  803fa9:	49 89 f7             	mov    %rsi,%r15
+  803fac:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  803fb3:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  803fb4:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  803fbb:	01 00 00 
+  803fbe:	e9 ae 00 00 00       	jmp    804071 <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  803fc3:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803fca:	49 83 ec 01          	sub    $0x1,%r12
+  803fce:	74 2d                	je     803ffd <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  803fd0:	48 89 d8             	mov    %rbx,%rax
+  803fd3:	48 c1 e8 0c          	shr    $0xc,%rax
+  803fd7:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  803fdc:	f6 c2 01             	test   $0x1,%dl
+  803fdf:	74 e2                	je     803fc3 <foreach_shared_region+0x42>
+  803fe1:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  803fe6:	f6 c4 04             	test   $0x4,%ah
+  803fe9:	74 d8                	je     803fc3 <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  803feb:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803ff2:	4c 89 fa             	mov    %r15,%rdx
+  803ff5:	48 89 df             	mov    %rbx,%rdi
+  803ff8:	41 ff d6             	call   *%r14
+  803ffb:	eb c6                	jmp    803fc3 <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  803ffd:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  804004:	00 
+  804005:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  80400a:	74 4a                	je     804056 <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  80400c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804010:	48 c1 e8 15          	shr    $0x15,%rax
+  804014:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  80401b:	01 00 00 
+  80401e:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804022:	a8 01                	test   $0x1,%al
+  804024:	74 d7                	je     803ffd <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  804026:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  80402a:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  804031:	48 39 c3             	cmp    %rax,%rbx
+  804034:	73 c7                	jae    803ffd <foreach_shared_region+0x7c>
+  804036:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  80403d:	48 39 d0             	cmp    %rdx,%rax
+  804040:	4d 19 e4             	sbb    %r12,%r12
+  804043:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  80404a:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  804051:	e9 7a ff ff ff       	jmp    803fd0 <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  804056:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  80405d:	40 
+  80405e:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804062:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804069:	00 00 00 
+  80406c:	48 39 c1             	cmp    %rax,%rcx
+  80406f:	74 50                	je     8040c1 <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  804071:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804075:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804079:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  804080:	01 00 00 
+  804083:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804087:	a8 01                	test   $0x1,%al
+  804089:	74 cb                	je     804056 <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  80408b:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80408f:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  804096:	48 39 c1             	cmp    %rax,%rcx
+  804099:	73 bb                	jae    804056 <foreach_shared_region+0xd5>
+  80409b:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  8040a2:	48 39 d0             	cmp    %rdx,%rax
+  8040a5:	48 19 c0             	sbb    %rax,%rax
+  8040a8:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  8040ae:	48 05 00 02 00 00    	add    $0x200,%rax
+  8040b4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8040b8:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8040bc:	e9 4b ff ff ff       	jmp    80400c <foreach_shared_region+0x8b>
+  8040c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040c6:	48 83 c4 28          	add    $0x28,%rsp
+  8040ca:	5b                   	pop    %rbx
+  8040cb:	41 5c                	pop    %r12
+  8040cd:	41 5d                	pop    %r13
+  8040cf:	41 5e                	pop    %r14
+  8040d1:	41 5f                	pop    %r15
+  8040d3:	5d                   	pop    %rbp
+  8040d4:	c3                   	ret
+
+00000000008040d5 <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  8040d5:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  8040db:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  8040e2:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  8040e9:	c3                   	ret
+
+00000000008040ea <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  8040ea:	8b 47 40             	mov    0x40(%rdi),%eax
+  8040ed:	8b 17                	mov    (%rdi),%edx
+  8040ef:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  8040f1:	83 f8 0f             	cmp    $0xf,%eax
+  8040f4:	77 13                	ja     804109 <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  8040f6:	8b 47 40             	mov    0x40(%rdi),%eax
+  8040f9:	83 e0 0f             	and    $0xf,%eax
+  8040fc:	48 c1 e0 09          	shl    $0x9,%rax
+  804100:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  804107:	00 
+  804108:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  804109:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80410e:	c3                   	ret
+
+000000000080410f <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  80410f:	8b 47 40             	mov    0x40(%rdi),%eax
+  804112:	83 c0 01             	add    $0x1,%eax
+  804115:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  804118:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  80411e:	8b 57 04             	mov    0x4(%rdi),%edx
+  804121:	b8 00 00 00 00       	mov    $0x0,%eax
+  804126:	85 d2                	test   %edx,%edx
+  804128:	75 04                	jne    80412e <chan_publish+0x1f>
+  80412a:	83 e0 01             	and    $0x1,%eax
+}
+  80412d:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  80412e:	87 47 04             	xchg   %eax,0x4(%rdi)
+  804131:	85 c0                	test   %eax,%eax
+  804133:	0f 95 c0             	setne  %al
+  804136:	0f b6 c0             	movzbl %al,%eax
+  804139:	eb ef                	jmp    80412a <chan_publish+0x1b>
+
+000000000080413b <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  80413b:	8b 47 40             	mov    0x40(%rdi),%eax
+  80413e:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  804140:	29 d0                	sub    %edx,%eax
+  804142:	83 e8 01             	sub    $0x1,%eax
+  804145:	83 f8 0f             	cmp    $0xf,%eax
+  804148:	77 12                	ja     80415c <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  80414a:	8b 07                	mov    (%rdi),%eax
+  80414c:	83 e0 0f             	and    $0xf,%eax
+  80414f:	48 c1 e0 09          	shl    $0x9,%rax
+  804153:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  80415a:	00 
+  80415b:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  80415c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804161:	c3                   	ret
+
+0000000000804162 <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  804162:	8b 07                	mov    (%rdi),%eax
+  804164:	83 c0 01             	add    $0x1,%eax
+  804167:	89 07                	mov    %eax,(%rdi)
+}
+  804169:	c3                   	ret
+
+000000000080416a <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  80416a:	55                   	push   %rbp
+  80416b:	48 89 e5             	mov    %rsp,%rbp
+  80416e:	53                   	push   %rbx
+  80416f:	48 83 ec 08          	sub    $0x8,%rsp
+  804173:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  804176:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  80417d:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  804183:	48 b8 3b 41 80 00 00 	movabs $0x80413b,%rax
+  80418a:	00 00 00 
+  80418d:	ff d0                	call   *%rax
+  80418f:	48 85 c0             	test   %rax,%rax
+  804192:	74 12                	je     8041a6 <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  804194:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  80419b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8041a0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8041a4:	c9                   	leave
+  8041a5:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  8041a6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8041ab:	eb f3                	jmp    8041a0 <chan_arm+0x36>
+
+00000000008041ad <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  8041ad:	55                   	push   %rbp
+  8041ae:	48 89 e5             	mov    %rsp,%rbp
+  8041b1:	41 56                	push   %r14
+  8041b3:	41 55                	push   %r13
+  8041b5:	41 54                	push   %r12
+  8041b7:	53                   	push   %rbx
+  8041b8:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  8041bb:	49 bc 6a 41 80 00 00 	movabs $0x80416a,%r12
+  8041c2:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  8041c5:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  8041c9:	49 bd 6b 15 80 00 00 	movabs $0x80156b,%r13
+  8041d0:	00 00 00 
+    while (chan_arm(r))
+  8041d3:	eb 0d                	jmp    8041e2 <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  8041d5:	8b 33                	mov    (%rbx),%esi
+  8041d7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8041dc:	4c 89 f7             	mov    %r14,%rdi
+  8041df:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  8041e2:	48 89 df             	mov    %rbx,%rdi
+  8041e5:	41 ff d4             	call   *%r12
+  8041e8:	84 c0                	test   %al,%al
+  8041ea:	75 e9                	jne    8041d5 <chan_wait+0x28>
+}
+  8041ec:	5b                   	pop    %rbx
+  8041ed:	41 5c                	pop    %r12
+  8041ef:	41 5d                	pop    %r13
+  8041f1:	41 5e                	pop    %r14
+  8041f3:	5d                   	pop    %rbp
+  8041f4:	c3                   	ret
+
+00000000008041f5 <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  8041f5:	55                   	push   %rbp
+  8041f6:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  8041f9:	48 83 c7 40          	add    $0x40,%rdi
+  8041fd:	be 01 00 00 00       	mov    $0x1,%esi
+  804202:	48 b8 89 15 80 00 00 	movabs $0x801589,%rax
+  804209:	00 00 00 
+  80420c:	ff d0                	call   *%rax
+}
+  80420e:	5d                   	pop    %rbp
+  80420f:	c3                   	ret
+
+0000000000804210 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804210:	b8 00 00 00 00       	mov    $0x0,%eax
+  804215:	c3                   	ret
+
+0000000000804216 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804216:	55                   	push   %rbp
+  804217:	48 89 e5             	mov    %rsp,%rbp
+  80421a:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  80421d:	48 be f4 4f 80 00 00 	movabs $0x804ff4,%rsi
+  804224:	00 00 00 
+  804227:	48 b8 9e 0c 80 00 00 	movabs $0x800c9e,%rax
+  80422e:	00 00 00 
+  804231:	ff d0                	call   *%rax
+    return 0;
+}
+  804233:	b8 00 00 00 00       	mov    $0x0,%eax
+  804238:	5d                   	pop    %rbp
+  804239:	c3                   	ret
+
+000000000080423a <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80423a:	55                   	push   %rbp
+  80423b:	48 89 e5             	mov    %rsp,%rbp
+  80423e:	41 57                	push   %r15
+  804240:	41 56                	push   %r14
+  804242:	41 55                	push   %r13
+  804244:	41 54                	push   %r12
+  804246:	53                   	push   %rbx
+  804247:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80424e:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  804255:	48 85 d2             	test   %rdx,%rdx
+  804258:	74 7a                	je     8042d4 <devcons_write+0x9a>
+  80425a:	49 89 d6             	mov    %rdx,%r14
+  80425d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804263:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  804268:	49 bf 98 0e 80 00 00 	movabs $0x800e98,%r15
+  80426f:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804272:	4c 89 f3             	mov    %r14,%rbx
+  804275:	48 29 f3             	sub    %rsi,%rbx
+  804278:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80427d:	48 39 c3             	cmp    %rax,%rbx
+  804280:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804284:	4c 63 eb             	movslq %ebx,%r13
+  804287:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80428e:	48 01 c6             	add    %rax,%rsi
+  804291:	4c 89 ea             	mov    %r13,%rdx
+  804294:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80429b:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80429e:	4c 89 ee             	mov    %r13,%rsi
+  8042a1:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8042a8:	48 b8 c5 10 80 00 00 	movabs $0x8010c5,%rax
+  8042af:	00 00 00 
+  8042b2:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8042b4:	41 01 dc             	add    %ebx,%r12d
+  8042b7:	49 63 f4             	movslq %r12d,%rsi
+  8042ba:	4c 39 f6             	cmp    %r14,%rsi
+  8042bd:	72 b3                	jb     804272 <devcons_write+0x38>
+    return res;
+  8042bf:	49 63 c4             	movslq %r12d,%rax
+}
+  8042c2:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8042c9:	5b                   	pop    %rbx
+  8042ca:	41 5c                	pop    %r12
+  8042cc:	41 5d                	pop    %r13
+  8042ce:	41 5e                	pop    %r14
+  8042d0:	41 5f                	pop    %r15
+  8042d2:	5d                   	pop    %rbp
+  8042d3:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8042d4:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8042da:	eb e3                	jmp    8042bf <devcons_write+0x85>
+
+00000000008042dc <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8042dc:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8042df:	ba 00 00 00 00       	mov    $0x0,%edx
+  8042e4:	48 85 c0             	test   %rax,%rax
+  8042e7:	74 55                	je     80433e <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8042e9:	55                   	push   %rbp
+  8042ea:	48 89 e5             	mov    %rsp,%rbp
+  8042ed:	41 55                	push   %r13
+  8042ef:	41 54                	push   %r12
+  8042f1:	53                   	push   %rbx
+  8042f2:	48 83 ec 08          	sub    $0x8,%rsp
+  8042f6:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8042f9:	48 bb e4 10 80 00 00 	movabs $0x8010e4,%rbx
+  804300:	00 00 00 
+  804303:	49 bc 99 11 80 00 00 	movabs $0x801199,%r12
+  80430a:	00 00 00 
+  80430d:	eb 03                	jmp    804312 <devcons_read+0x36>
+  80430f:	41 ff d4             	call   *%r12
+  804312:	ff d3                	call   *%rbx
+  804314:	85 c0                	test   %eax,%eax
+  804316:	74 f7                	je     80430f <devcons_read+0x33>
+    if (c < 0) return c;
+  804318:	48 63 d0             	movslq %eax,%rdx
+  80431b:	78 13                	js     804330 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  80431d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804322:	83 f8 04             	cmp    $0x4,%eax
+  804325:	74 09                	je     804330 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  804327:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  80432b:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804330:	48 89 d0             	mov    %rdx,%rax
+  804333:	48 83 c4 08          	add    $0x8,%rsp
+  804337:	5b                   	pop    %rbx
+  804338:	41 5c                	pop    %r12
+  80433a:	41 5d                	pop    %r13
+  80433c:	5d                   	pop    %rbp
+  80433d:	c3                   	ret
+  80433e:	48 89 d0             	mov    %rdx,%rax
+  804341:	c3                   	ret
+
+0000000000804342 <cputchar>:
+cputchar(int ch) {
+  804342:	55                   	push   %rbp
+  804343:	48 89 e5             	mov    %rsp,%rbp
+  804346:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  80434a:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80434e:	be 01 00 00 00       	mov    $0x1,%esi
+  804353:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  804357:	48 b8 c5 10 80 00 00 	movabs $0x8010c5,%rax
+  80435e:	00 00 00 
+  804361:	ff d0                	call   *%rax
+}
+  804363:	c9                   	leave
+  804364:	c3                   	ret
+
+0000000000804365 <getchar>:
+getchar(void) {
+  804365:	55                   	push   %rbp
+  804366:	48 89 e5             	mov    %rsp,%rbp
+  804369:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80436d:	ba 01 00 00 00       	mov    $0x1,%edx
+  804372:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  804376:	bf 00 00 00 00       	mov    $0x0,%edi
+  80437b:	48 b8 c1 1a 80 00 00 	movabs $0x801ac1,%rax
+  804382:	00 00 00 
+  804385:	ff d0                	call   *%rax
+  804387:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  804389:	85 c0                	test   %eax,%eax
+  80438b:	78 06                	js     804393 <getchar+0x2e>
+  80438d:	74 08                	je     804397 <getchar+0x32>
+  80438f:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804393:	89 d0                	mov    %edx,%eax
+  804395:	c9                   	leave
+  804396:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  804397:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80439c:	eb f5                	jmp    804393 <getchar+0x2e>
+
+000000000080439e <iscons>:
+iscons(int fdnum) {
+  80439e:	55                   	push   %rbp
+  80439f:	48 89 e5             	mov    %rsp,%rbp
+  8043a2:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8043a6:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8043aa:	48 b8 de 17 80 00 00 	movabs $0x8017de,%rax
+  8043b1:	00 00 00 
+  8043b4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8043b6:	85 c0                	test   %eax,%eax
+  8043b8:	78 18                	js     8043d2 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8043ba:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8043be:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  8043c5:	00 00 00 
+  8043c8:	8b 00                	mov    (%rax),%eax
+  8043ca:	39 02                	cmp    %eax,(%rdx)
+  8043cc:	0f 94 c0             	sete   %al
+  8043cf:	0f b6 c0             	movzbl %al,%eax
+}
+  8043d2:	c9                   	leave
+  8043d3:	c3                   	ret
+
+00000000008043d4 <opencons>:
+opencons(void) {
+  8043d4:	55                   	push   %rbp
+  8043d5:	48 89 e5             	mov    %rsp,%rbp
+  8043d8:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8043dc:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8043e0:	48 b8 7e 17 80 00 00 	movabs $0x80177e,%rax
+  8043e7:	00 00 00 
+  8043ea:	ff d0                	call   *%rax
+  8043ec:	85 c0                	test   %eax,%eax
+  8043ee:	78 49                	js     804439 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8043f0:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8043f5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8043fa:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8043fe:	bf 00 00 00 00       	mov    $0x0,%edi
+  804403:	48 b8 fd 11 80 00 00 	movabs $0x8011fd,%rax
+  80440a:	00 00 00 
+  80440d:	ff d0                	call   *%rax
+  80440f:	85 c0                	test   %eax,%eax
+  804411:	78 26                	js     804439 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  804413:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804417:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  80441e:	00 00 
+  804420:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  804422:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804426:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  80442d:	48 b8 50 17 80 00 00 	movabs $0x801750,%rax
+  804434:	00 00 00 
+  804437:	ff d0                	call   *%rax
+}
+  804439:	c9                   	leave
+  80443a:	c3                   	ret
+
+000000000080443b <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  80443b:	55                   	push   %rbp
+  80443c:	48 89 e5             	mov    %rsp,%rbp
+  80443f:	41 56                	push   %r14
+  804441:	41 55                	push   %r13
+  804443:	41 54                	push   %r12
+  804445:	53                   	push   %rbx
+  804446:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804449:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  804450:	00 00 00 
+  804453:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804457:	74 27                	je     804480 <_handle_vectored_pagefault+0x45>
+  804459:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  80445e:	49 bd 00 10 84 00 00 	movabs $0x841000,%r13
+  804465:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804468:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  80446b:	4c 89 e7             	mov    %r12,%rdi
+  80446e:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  804473:	84 c0                	test   %al,%al
+  804475:	75 45                	jne    8044bc <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804477:	48 83 c3 01          	add    $0x1,%rbx
+  80447b:	49 3b 1e             	cmp    (%r14),%rbx
+  80447e:	72 eb                	jb     80446b <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  804480:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  804487:	00 
+  804488:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  80448d:	4d 8b 04 24          	mov    (%r12),%r8
+  804491:	48 ba 00 50 80 00 00 	movabs $0x805000,%rdx
+  804498:	00 00 00 
+  80449b:	be 1d 00 00 00       	mov    $0x1d,%esi
+  8044a0:	48 bf 30 50 80 00 00 	movabs $0x805030,%rdi
+  8044a7:	00 00 00 
+  8044aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044af:	49 ba 29 02 80 00 00 	movabs $0x800229,%r10
+  8044b6:	00 00 00 
+  8044b9:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  8044bc:	5b                   	pop    %rbx
+  8044bd:	41 5c                	pop    %r12
+  8044bf:	41 5d                	pop    %r13
+  8044c1:	41 5e                	pop    %r14
+  8044c3:	5d                   	pop    %rbp
+  8044c4:	c3                   	ret
+
+00000000008044c5 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  8044c5:	55                   	push   %rbp
+  8044c6:	48 89 e5             	mov    %rsp,%rbp
+  8044c9:	53                   	push   %rbx
+  8044ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8044ce:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  8044d1:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8044d8:	00 00 00 
+  8044db:	80 38 00             	cmpb   $0x0,(%rax)
+  8044de:	0f 84 84 00 00 00    	je     804568 <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8044e4:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  8044eb:	00 00 00 
+  8044ee:	48 8b 10             	mov    (%rax),%rdx
+  8044f1:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  8044f6:	48 b9 00 10 84 00 00 	movabs $0x841000,%rcx
+  8044fd:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804500:	48 85 d2             	test   %rdx,%rdx
+  804503:	74 19                	je     80451e <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  804505:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  804509:	0f 84 e8 00 00 00    	je     8045f7 <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80450f:	48 83 c0 01          	add    $0x1,%rax
+  804513:	48 39 d0             	cmp    %rdx,%rax
+  804516:	75 ed                	jne    804505 <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  804518:	48 83 fa 08          	cmp    $0x8,%rdx
+  80451c:	74 1c                	je     80453a <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  80451e:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  804522:	48 a3 48 10 84 00 00 	movabs %rax,0x841048
+  804529:	00 00 00 
+  80452c:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  804533:	00 00 00 
+  804536:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  80453a:	48 b8 70 11 80 00 00 	movabs $0x801170,%rax
+  804541:	00 00 00 
+  804544:	ff d0                	call   *%rax
+  804546:	89 c7                	mov    %eax,%edi
+  804548:	48 be bd 46 80 00 00 	movabs $0x8046bd,%rsi
+  80454f:	00 00 00 
+  804552:	48 b8 bb 13 80 00 00 	movabs $0x8013bb,%rax
+  804559:	00 00 00 
+  80455c:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80455e:	85 c0                	test   %eax,%eax
+  804560:	78 68                	js     8045ca <add_pgfault_handler+0x105>
+    return res;
+}
+  804562:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804566:	c9                   	leave
+  804567:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  804568:	48 b8 70 11 80 00 00 	movabs $0x801170,%rax
+  80456f:	00 00 00 
+  804572:	ff d0                	call   *%rax
+  804574:	89 c7                	mov    %eax,%edi
+  804576:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80457b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804580:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  804587:	00 00 00 
+  80458a:	48 b8 fd 11 80 00 00 	movabs $0x8011fd,%rax
+  804591:	00 00 00 
+  804594:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  804596:	48 ba 48 10 84 00 00 	movabs $0x841048,%rdx
+  80459d:	00 00 00 
+  8045a0:	48 8b 02             	mov    (%rdx),%rax
+  8045a3:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8045a7:	48 89 0a             	mov    %rcx,(%rdx)
+  8045aa:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  8045b1:	00 00 00 
+  8045b4:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  8045b8:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8045bf:	00 00 00 
+  8045c2:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  8045c5:	e9 70 ff ff ff       	jmp    80453a <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8045ca:	89 c1                	mov    %eax,%ecx
+  8045cc:	48 ba 3e 50 80 00 00 	movabs $0x80503e,%rdx
+  8045d3:	00 00 00 
+  8045d6:	be 3d 00 00 00       	mov    $0x3d,%esi
+  8045db:	48 bf 30 50 80 00 00 	movabs $0x805030,%rdi
+  8045e2:	00 00 00 
+  8045e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045ea:	49 b8 29 02 80 00 00 	movabs $0x800229,%r8
+  8045f1:	00 00 00 
+  8045f4:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8045f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045fc:	e9 61 ff ff ff       	jmp    804562 <add_pgfault_handler+0x9d>
+
+0000000000804601 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  804601:	55                   	push   %rbp
+  804602:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  804605:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  80460c:	00 00 00 
+  80460f:	80 38 00             	cmpb   $0x0,(%rax)
+  804612:	74 33                	je     804647 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804614:	48 a1 48 10 84 00 00 	movabs 0x841048,%rax
+  80461b:	00 00 00 
+  80461e:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  804623:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  80462a:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80462d:	48 85 c0             	test   %rax,%rax
+  804630:	0f 84 85 00 00 00    	je     8046bb <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  804636:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  80463a:	74 40                	je     80467c <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80463c:	48 83 c1 01          	add    $0x1,%rcx
+  804640:	48 39 c1             	cmp    %rax,%rcx
+  804643:	75 f1                	jne    804636 <remove_pgfault_handler+0x35>
+  804645:	eb 74                	jmp    8046bb <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  804647:	48 b9 56 50 80 00 00 	movabs $0x805056,%rcx
+  80464e:	00 00 00 
+  804651:	48 ba a7 4f 80 00 00 	movabs $0x804fa7,%rdx
+  804658:	00 00 00 
+  80465b:	be 43 00 00 00       	mov    $0x43,%esi
+  804660:	48 bf 30 50 80 00 00 	movabs $0x805030,%rdi
+  804667:	00 00 00 
+  80466a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80466f:	49 b8 29 02 80 00 00 	movabs $0x800229,%r8
+  804676:	00 00 00 
+  804679:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  80467c:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  804683:	00 
+  804684:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804688:	48 29 ca             	sub    %rcx,%rdx
+  80468b:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  804692:	00 00 00 
+  804695:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  804699:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  80469e:	48 89 ce             	mov    %rcx,%rsi
+  8046a1:	48 b8 98 0e 80 00 00 	movabs $0x800e98,%rax
+  8046a8:	00 00 00 
+  8046ab:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  8046ad:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  8046b4:	00 00 00 
+  8046b7:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  8046bb:	5d                   	pop    %rbp
+  8046bc:	c3                   	ret
+
+00000000008046bd <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  8046bd:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  8046c0:	48 b8 3b 44 80 00 00 	movabs $0x80443b,%rax
+  8046c7:	00 00 00 
+    call *%rax
+  8046ca:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  8046cc:	41 5f                	pop    %r15
+	popq %r15
+  8046ce:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  8046d0:	41 5f                	pop    %r15
+	popq %r14
+  8046d2:	41 5e                	pop    %r14
+	popq %r13
+  8046d4:	41 5d                	pop    %r13
+	popq %r12
+  8046d6:	41 5c                	pop    %r12
+	popq %r11
+  8046d8:	41 5b                	pop    %r11
+	popq %r10
+  8046da:	41 5a                	pop    %r10
+	popq %r9
+  8046dc:	41 59                	pop    %r9
+	popq %r8
+  8046de:	41 58                	pop    %r8
+	popq %rsi
+  8046e0:	5e                   	pop    %rsi
+	popq %rdi
+  8046e1:	5f                   	pop    %rdi
+	popq %rbp
+  8046e2:	5d                   	pop    %rbp
+	popq %rdx
+  8046e3:	5a                   	pop    %rdx
+	popq %rcx
+  8046e4:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  8046e5:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  8046ea:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  8046ef:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  8046f3:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  8046f6:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  8046fb:	5b                   	pop    %rbx
+	popq %rax
+  8046fc:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  8046fd:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  804701:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  804702:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  804707:	c3                   	ret
+
+0000000000804708 <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  804708:	55                   	push   %rbp
+  804709:	48 89 e5             	mov    %rsp,%rbp
+  80470c:	41 55                	push   %r13
+  80470e:	41 54                	push   %r12
+  804710:	53                   	push   %rbx
+  804711:	48 83 ec 08          	sub    $0x8,%rsp
+  804715:	49 89 fd             	mov    %rdi,%r13
+  804718:	48 89 f7             	mov    %rsi,%rdi
+  80471b:	48 89 d3             	mov    %rdx,%rbx
+  80471e:	49 89 cc             	mov    %rcx,%r12
+  804721:	4c 89 c2             	mov    %r8,%rdx
+  804724:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804727:	48 85 f6             	test   %rsi,%rsi
+  80472a:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804731:	00 00 00 
+  804734:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  804738:	be 00 10 00 00       	mov    $0x1000,%esi
+  80473d:	48 85 db             	test   %rbx,%rbx
+  804740:	74 03                	je     804745 <ipc_recv_futex+0x3d>
+  804742:	48 8b 33             	mov    (%rbx),%rsi
+  804745:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  804749:	48 b8 47 14 80 00 00 	movabs $0x801447,%rax
+  804750:	00 00 00 
+  804753:	ff d0                	call   *%rax
+    if (res < 0) {
+  804755:	85 c0                	test   %eax,%eax
+  804757:	78 75                	js     8047ce <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  804759:	4d 85 ed             	test   %r13,%r13
+  80475c:	74 14                	je     804772 <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  80475e:	48 a1 08 00 81 00 00 	movabs 0x810008,%rax
+  804765:	00 00 00 
+  804768:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  80476e:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  804772:	4d 85 e4             	test   %r12,%r12
+  804775:	74 14                	je     80478b <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  804777:	48 a1 08 00 81 00 00 	movabs 0x810008,%rax
+  80477e:	00 00 00 
+  804781:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  804787:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  80478b:	48 85 db             	test   %rbx,%rbx
+  80478e:	74 23                	je     8047b3 <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804790:	48 a1 08 00 81 00 00 	movabs 0x810008,%rax
+  804797:	00 00 00 
+  80479a:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  8047a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8047a5:	85 c9                	test   %ecx,%ecx
+  8047a7:	74 07                	je     8047b0 <ipc_recv_futex+0xa8>
+  8047a9:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  8047b0:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  8047b3:	48 a1 08 00 81 00 00 	movabs 0x810008,%rax
+  8047ba:	00 00 00 
+  8047bd:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  8047c3:	48 83 c4 08          	add    $0x8,%rsp
+  8047c7:	5b                   	pop    %rbx
+  8047c8:	41 5c                	pop    %r12
+  8047ca:	41 5d                	pop    %r13
+  8047cc:	5d                   	pop    %rbp
+  8047cd:	c3                   	ret
+        if (from_env_store != NULL) {
+  8047ce:	4d 85 ed             	test   %r13,%r13
+  8047d1:	74 08                	je     8047db <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  8047d3:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8047da:	00 
+        if (perm_store != NULL) {
+  8047db:	4d 85 e4             	test   %r12,%r12
+  8047de:	74 08                	je     8047e8 <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  8047e0:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8047e7:	00 
+        if (size != NULL) {
+  8047e8:	48 85 db             	test   %rbx,%rbx
+  8047eb:	74 d6                	je     8047c3 <ipc_recv_futex+0xbb>
+            *size = 0;
+  8047ed:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  8047f4:	eb cd                	jmp    8047c3 <ipc_recv_futex+0xbb>
+
+00000000008047f6 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8047f6:	55                   	push   %rbp
+  8047f7:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  8047fa:	48 83 ec 08          	sub    $0x8,%rsp
+  8047fe:	6a 00                	push   $0x0
+  804800:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804806:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80480c:	48 b8 08 47 80 00 00 	movabs $0x804708,%rax
+  804813:	00 00 00 
+  804816:	ff d0                	call   *%rax
+}
+  804818:	c9                   	leave
+  804819:	c3                   	ret
+
+000000000080481a <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80481a:	55                   	push   %rbp
+  80481b:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80481e:	48 85 d2             	test   %rdx,%rdx
+  804821:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804828:	00 00 00 
+  80482b:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  80482f:	89 f6                	mov    %esi,%esi
+  804831:	48 b8 30 14 80 00 00 	movabs $0x801430,%rax
+  804838:	00 00 00 
+  80483b:	ff d0                	call   *%rax
+    if (res < 0) {
+  80483d:	85 c0                	test   %eax,%eax
+  80483f:	78 02                	js     804843 <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  804841:	5d                   	pop    %rbp
+  804842:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  804843:	89 c1                	mov    %eax,%ecx
+  804845:	48 ba 70 50 80 00 00 	movabs $0x805070,%rdx
+  80484c:	00 00 00 
+  80484f:	be 50 00 00 00       	mov    $0x50,%esi
+  804854:	48 bf 84 50 80 00 00 	movabs $0x805084,%rdi
+  80485b:	00 00 00 
+  80485e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804863:	49 b8 29 02 80 00 00 	movabs $0x800229,%r8
+  80486a:	00 00 00 
+  80486d:	41 ff d0             	call   *%r8
+
+0000000000804870 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804870:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  804875:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80487c:	00 00 00 
+  80487f:	48 89 d0             	mov    %rdx,%rax
+  804882:	48 c1 e0 04          	shl    $0x4,%rax
+  804886:	48 29 d0             	sub    %rdx,%rax
+  804889:	48 c1 e0 05          	shl    $0x5,%rax
+  80488d:	48 01 c8             	add    %rcx,%rax
+  804890:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  804896:	39 f8                	cmp    %edi,%eax
+  804898:	74 13                	je     8048ad <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  80489a:	48 83 c2 01          	add    $0x1,%rdx
+  80489e:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  8048a5:	75 d8                	jne    80487f <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8048a7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8048ac:	c3                   	ret
+            return envs[i].env_id;
+  8048ad:	48 89 d0             	mov    %rdx,%rax
+  8048b0:	48 c1 e0 04          	shl    $0x4,%rax
+  8048b4:	48 29 d0             	sub    %rdx,%rax
+  8048b7:	48 c1 e0 05          	shl    $0x5,%rax
+  8048bb:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8048c2:	00 00 00 
+  8048c5:	48 01 d0             	add    %rdx,%rax
+  8048c8:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8048ce:	c3                   	ret
+  8048cf:	90                   	nop
+
+00000000008048d0 <__rodata_start>:
+  8048d0:	72 61                	jb     804933 <__rodata_start+0x63>
+  8048d2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8048d3:	20 6f 6e             	and    %ch,0x6e(%rdi)
+  8048d6:	20 74 77 6f          	and    %dh,0x6f(%rdi,%rsi,2)
+  8048da:	20 43 50             	and    %al,0x50(%rbx)
+  8048dd:	55                   	push   %rbp
+  8048de:	73 20                	jae    804900 <__rodata_start+0x30>
+  8048e0:	61                   	(bad)
+  8048e1:	74 20                	je     804903 <__rodata_start+0x33>
+  8048e3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8048e4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8048e5:	63 65 20             	movsxd 0x20(%rbp),%esp
+  8048e8:	28 63 6f             	sub    %ah,0x6f(%rbx)
+  8048eb:	75 6e                	jne    80495b <__rodata_start+0x8b>
+  8048ed:	74 65                	je     804954 <__rodata_start+0x84>
+  8048ef:	72 20                	jb     804911 <__rodata_start+0x41>
+  8048f1:	69 73 20 25 64 29 00 	imul   $0x296425,0x20(%rbx),%esi
+  8048f8:	75 73                	jne    80496d <__rodata_start+0x9d>
+  8048fa:	65 72 2f             	gs jb  80492c <__rodata_start+0x5c>
+  8048fd:	73 74                	jae    804973 <__rodata_start+0xa3>
+  8048ff:	72 65                	jb     804966 <__rodata_start+0x96>
+  804901:	73 73                	jae    804976 <__rodata_start+0xa6>
+  804903:	73 63                	jae    804968 <__rodata_start+0x98>
+  804905:	68 65 64 2e 63       	push   $0x632e6465
+  80490a:	00 3c 75 6e 6b 6e 6f 	add    %bh,0x6f6e6b6e(,%rsi,2)
+  804911:	77 6e                	ja     804981 <__rodata_start+0xb1>
+  804913:	3e 00 0f             	ds add %cl,(%rdi)
+  804916:	1f                   	(bad)
+  804917:	00 5b 25             	add    %bl,0x25(%rbx)
+  80491a:	30 38                	xor    %bh,(%rax)
+  80491c:	78 5d                	js     80497b <__rodata_start+0xab>
+  80491e:	20 75 73             	and    %dh,0x73(%rbp)
+  804921:	65 72 20             	gs jb  804944 <__rodata_start+0x74>
+  804924:	70 61                	jo     804987 <__rodata_start+0xb7>
+  804926:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804927:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  80492e:	73 20                	jae    804950 <__rodata_start+0x80>
+  804930:	61                   	(bad)
+  804931:	74 20                	je     804953 <__rodata_start+0x83>
+  804933:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  804938:	3a 20                	cmp    (%rax),%ah
+  80493a:	00 30                	add    %dh,(%rax)
+  80493c:	31 32                	xor    %esi,(%rdx)
+  80493e:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  804945:	41                   	rex.B
+  804946:	42                   	rex.X
+  804947:	43                   	rex.XB
+  804948:	44                   	rex.R
+  804949:	45                   	rex.RB
+  80494a:	46 00 30             	rex.RX add %r14b,(%rax)
+  80494d:	31 32                	xor    %esi,(%rdx)
+  80494f:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  804956:	61                   	(bad)
+  804957:	62 63 64 65 66       	(bad)
+  80495c:	00 28                	add    %ch,(%rax)
+  80495e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80495f:	75 6c                	jne    8049cd <__rodata_start+0xfd>
+  804961:	6c                   	insb   (%dx),%es:(%rdi)
+  804962:	29 00                	sub    %eax,(%rax)
+  804964:	65 72 72             	gs jb  8049d9 <__rodata_start+0x109>
+  804967:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804968:	72 20                	jb     80498a <__rodata_start+0xba>
+  80496a:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  80496f:	73 70                	jae    8049e1 <__rodata_start+0x111>
+  804971:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  804975:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  80497c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80497d:	72 00                	jb     80497f <__rodata_start+0xaf>
+  80497f:	62 61 64 20 65       	(bad)
+  804984:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804985:	76 69                	jbe    8049f0 <__rodata_start+0x120>
+  804987:	72 6f                	jb     8049f8 <__rodata_start+0x128>
+  804989:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80498a:	6d                   	insl   (%dx),%es:(%rdi)
+  80498b:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80498d:	74 00                	je     80498f <__rodata_start+0xbf>
+  80498f:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  804996:	20 70 61             	and    %dh,0x61(%rax)
+  804999:	72 61                	jb     8049fc <__rodata_start+0x12c>
+  80499b:	6d                   	insl   (%dx),%es:(%rdi)
+  80499c:	65 74 65             	gs je  804a04 <__rodata_start+0x134>
+  80499f:	72 00                	jb     8049a1 <__rodata_start+0xd1>
+  8049a1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8049a2:	75 74                	jne    804a18 <__rodata_start+0x148>
+  8049a4:	20 6f 66             	and    %ch,0x66(%rdi)
+  8049a7:	20 6d 65             	and    %ch,0x65(%rbp)
+  8049aa:	6d                   	insl   (%dx),%es:(%rdi)
+  8049ab:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8049ac:	72 79                	jb     804a27 <__rodata_start+0x157>
+  8049ae:	00 6f 75             	add    %ch,0x75(%rdi)
+  8049b1:	74 20                	je     8049d3 <__rodata_start+0x103>
+  8049b3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8049b4:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  8049b8:	76 69                	jbe    804a23 <__rodata_start+0x153>
+  8049ba:	72 6f                	jb     804a2b <__rodata_start+0x15b>
+  8049bc:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8049bd:	6d                   	insl   (%dx),%es:(%rdi)
+  8049be:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8049c0:	74 73                	je     804a35 <__rodata_start+0x165>
+  8049c2:	00 63 6f             	add    %ah,0x6f(%rbx)
+  8049c5:	72 72                	jb     804a39 <__rodata_start+0x169>
+  8049c7:	75 70                	jne    804a39 <__rodata_start+0x169>
+  8049c9:	74 65                	je     804a30 <__rodata_start+0x160>
+  8049cb:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  8049d0:	75 67                	jne    804a39 <__rodata_start+0x169>
+  8049d2:	20 69 6e             	and    %ch,0x6e(%rcx)
+  8049d5:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8049d7:	00 73 65             	add    %dh,0x65(%rbx)
+  8049da:	67 6d                	insl   (%dx),%es:(%edi)
+  8049dc:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8049de:	74 61                	je     804a41 <__rodata_start+0x171>
+  8049e0:	74 69                	je     804a4b <__rodata_start+0x17b>
+  8049e2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8049e3:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8049e4:	20 66 61             	and    %ah,0x61(%rsi)
+  8049e7:	75 6c                	jne    804a55 <__rodata_start+0x185>
+  8049e9:	74 00                	je     8049eb <__rodata_start+0x11b>
+  8049eb:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8049f2:	20 45 4c             	and    %al,0x4c(%rbp)
+  8049f5:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  8049f9:	61                   	(bad)
+  8049fa:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  8049ff:	20 73 75             	and    %dh,0x75(%rbx)
+  804a02:	63 68 20             	movsxd 0x20(%rax),%ebp
+  804a05:	73 79                	jae    804a80 <__rodata_start+0x1b0>
+  804a07:	73 74                	jae    804a7d <__rodata_start+0x1ad>
+  804a09:	65 6d                	gs insl (%dx),%es:(%rdi)
+  804a0b:	20 63 61             	and    %ah,0x61(%rbx)
+  804a0e:	6c                   	insb   (%dx),%es:(%rdi)
+  804a0f:	6c                   	insb   (%dx),%es:(%rdi)
+  804a10:	00 65 6e             	add    %ah,0x6e(%rbp)
+  804a13:	74 72                	je     804a87 <__rodata_start+0x1b7>
+  804a15:	79 20                	jns    804a37 <__rodata_start+0x167>
+  804a17:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a18:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a19:	74 20                	je     804a3b <__rodata_start+0x16b>
+  804a1b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804a1d:	75 6e                	jne    804a8d <__rodata_start+0x1bd>
+  804a1f:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  804a23:	76 20                	jbe    804a45 <__rodata_start+0x175>
+  804a25:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  804a2c:	72 65                	jb     804a93 <__rodata_start+0x1c3>
+  804a2e:	63 76 69             	movsxd 0x69(%rsi),%esi
+  804a31:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a32:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  804a36:	65 78 70             	gs js  804aa9 <__rodata_start+0x1d9>
+  804a39:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  804a3e:	20 65 6e             	and    %ah,0x6e(%rbp)
+  804a41:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  804a45:	20 66 69             	and    %ah,0x69(%rsi)
+  804a48:	6c                   	insb   (%dx),%es:(%rdi)
+  804a49:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  804a4d:	20 66 72             	and    %ah,0x72(%rsi)
+  804a50:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  804a55:	61                   	(bad)
+  804a56:	63 65 20             	movsxd 0x20(%rbp),%esp
+  804a59:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a5a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a5b:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  804a5f:	6b 00 74             	imul   $0x74,(%rax),%eax
+  804a62:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a63:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a64:	20 6d 61             	and    %ch,0x61(%rbp)
+  804a67:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a68:	79 20                	jns    804a8a <__rodata_start+0x1ba>
+  804a6a:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  804a71:	72 65                	jb     804ad8 <__rodata_start+0x208>
+  804a73:	20 6f 70             	and    %ch,0x70(%rdi)
+  804a76:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804a78:	00 66 69             	add    %ah,0x69(%rsi)
+  804a7b:	6c                   	insb   (%dx),%es:(%rdi)
+  804a7c:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  804a80:	20 62 6c             	and    %ah,0x6c(%rdx)
+  804a83:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a84:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  804a87:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a88:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a89:	74 20                	je     804aab <__rodata_start+0x1db>
+  804a8b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804a8d:	75 6e                	jne    804afd <__rodata_start+0x22d>
+  804a8f:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  804a93:	76 61                	jbe    804af6 <__rodata_start+0x226>
+  804a95:	6c                   	insb   (%dx),%es:(%rdi)
+  804a96:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  804a9d:	00 
+  804a9e:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  804aa5:	72 65                	jb     804b0c <__rodata_start+0x23c>
+  804aa7:	61                   	(bad)
+  804aa8:	64 79 20             	fs jns 804acb <__rodata_start+0x1fb>
+  804aab:	65 78 69             	gs js  804b17 <__rodata_start+0x247>
+  804aae:	73 74                	jae    804b24 <__rodata_start+0x254>
+  804ab0:	73 00                	jae    804ab2 <__rodata_start+0x1e2>
+  804ab2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804ab3:	70 65                	jo     804b1a <__rodata_start+0x24a>
+  804ab5:	72 61                	jb     804b18 <__rodata_start+0x248>
+  804ab7:	74 69                	je     804b22 <__rodata_start+0x252>
+  804ab9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804aba:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804abb:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  804abe:	74 20                	je     804ae0 <__rodata_start+0x210>
+  804ac0:	73 75                	jae    804b37 <__rodata_start+0x267>
+  804ac2:	70 70                	jo     804b34 <__rodata_start+0x264>
+  804ac4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804ac5:	72 74                	jb     804b3b <__rodata_start+0x26b>
+  804ac7:	65 64 00 74 72 79    	gs add %dh,%fs:0x79(%rdx,%rsi,2)
+  804acd:	20 61 67             	and    %ah,0x67(%rcx)
+  804ad0:	61                   	(bad)
+  804ad1:	69 6e 00 74 69 6d 65 	imul   $0x656d6974,0x0(%rsi),%ebp
+  804ad8:	64 20 6f 75          	and    %ch,%fs:0x75(%rdi)
+  804adc:	74 00                	je     804ade <__rodata_start+0x20e>
+  804ade:	66 69 6c 65 20 69 73 	imul   $0x7369,0x20(%rbp,%riz,2),%bp
+  804ae5:	20 69 6e             	and    %ch,0x6e(%rcx)
+  804ae8:	20 75 73             	and    %dh,0x73(%rbp)
+  804aeb:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  804aef:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  804af6:	00 
+  804af7:	66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+  804afe:	00 00 
+  804b00:	66 05 80 00          	add    $0x80,%ax
+  804b04:	00 00                	add    %al,(%rax)
+  804b06:	00 00                	add    %al,(%rax)
+  804b08:	a7                   	cmpsl  %es:(%rdi),%ds:(%rsi)
+  804b09:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804b0f:	00 97 0b 80 00 00    	add    %dl,0x800b(%rdi)
+  804b15:	00 00                	add    %al,(%rax)
+  804b17:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  804b1d:	00 00                	add    %al,(%rax)
+  804b1f:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  804b25:	00 00                	add    %al,(%rax)
+  804b27:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  804b2d:	00 00                	add    %al,(%rax)
+  804b2f:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  804b35:	00 00                	add    %al,(%rax)
+  804b37:	00 85 05 80 00 00    	add    %al,0x8005(%rbp)
+  804b3d:	00 00                	add    %al,(%rax)
+  804b3f:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  804b45:	00 00                	add    %al,(%rax)
+  804b47:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  804b4d:	00 00                	add    %al,(%rax)
+  804b4f:	00 79 05             	add    %bh,0x5(%rcx)
+  804b52:	80 00 00             	addb   $0x0,(%rax)
+  804b55:	00 00                	add    %al,(%rax)
+  804b57:	00 f3                	add    %dh,%bl
+  804b59:	05 80 00 00 00       	add    $0x80,%eax
+  804b5e:	00 00                	add    %al,(%rax)
+  804b60:	a7                   	cmpsl  %es:(%rdi),%ds:(%rsi)
+  804b61:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804b67:	00 79 05             	add    %bh,0x5(%rcx)
+  804b6a:	80 00 00             	addb   $0x0,(%rax)
+  804b6d:	00 00                	add    %al,(%rax)
+  804b6f:	00 bf 05 80 00 00    	add    %bh,0x8005(%rdi)
+  804b75:	00 00                	add    %al,(%rax)
+  804b77:	00 bf 05 80 00 00    	add    %bh,0x8005(%rdi)
+  804b7d:	00 00                	add    %al,(%rax)
+  804b7f:	00 bf 05 80 00 00    	add    %bh,0x8005(%rdi)
+  804b85:	00 00                	add    %al,(%rax)
+  804b87:	00 bf 05 80 00 00    	add    %bh,0x8005(%rdi)
+  804b8d:	00 00                	add    %al,(%rax)
+  804b8f:	00 bf 05 80 00 00    	add    %bh,0x8005(%rdi)
+  804b95:	00 00                	add    %al,(%rax)
+  804b97:	00 bf 05 80 00 00    	add    %bh,0x8005(%rdi)
+  804b9d:	00 00                	add    %al,(%rax)
+  804b9f:	00 bf 05 80 00 00    	add    %bh,0x8005(%rdi)
+  804ba5:	00 00                	add    %al,(%rax)
+  804ba7:	00 bf 05 80 00 00    	add    %bh,0x8005(%rdi)
+  804bad:	00 00                	add    %al,(%rax)
+  804baf:	00 bf 05 80 00 00    	add    %bh,0x8005(%rdi)
+  804bb5:	00 00                	add    %al,(%rax)
+  804bb7:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  804bbd:	00 00                	add    %al,(%rax)
+  804bbf:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  804bc5:	00 00                	add    %al,(%rax)
+  804bc7:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  804bcd:	00 00                	add    %al,(%rax)
+  804bcf:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  804bd5:	00 00                	add    %al,(%rax)
+  804bd7:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  804bdd:	00 00                	add    %al,(%rax)
+  804bdf:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  804be5:	00 00                	add    %al,(%rax)
+  804be7:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  804bed:	00 00                	add    %al,(%rax)
+  804bef:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  804bf5:	00 00                	add    %al,(%rax)
+  804bf7:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  804bfd:	00 00                	add    %al,(%rax)
+  804bff:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  804c05:	00 00                	add    %al,(%rax)
+  804c07:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  804c0d:	00 00                	add    %al,(%rax)
+  804c0f:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  804c15:	00 00                	add    %al,(%rax)
+  804c17:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  804c1d:	00 00                	add    %al,(%rax)
+  804c1f:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  804c25:	00 00                	add    %al,(%rax)
+  804c27:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  804c2d:	00 00                	add    %al,(%rax)
+  804c2f:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  804c35:	00 00                	add    %al,(%rax)
+  804c37:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  804c3d:	00 00                	add    %al,(%rax)
+  804c3f:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  804c45:	00 00                	add    %al,(%rax)
+  804c47:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  804c4d:	00 00                	add    %al,(%rax)
+  804c4f:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  804c55:	00 00                	add    %al,(%rax)
+  804c57:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  804c5d:	00 00                	add    %al,(%rax)
+  804c5f:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  804c65:	00 00                	add    %al,(%rax)
+  804c67:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  804c6d:	00 00                	add    %al,(%rax)
+  804c6f:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  804c75:	00 00                	add    %al,(%rax)
+  804c77:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  804c7d:	00 00                	add    %al,(%rax)
+  804c7f:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  804c85:	00 00                	add    %al,(%rax)
+  804c87:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  804c8d:	00 00                	add    %al,(%rax)
+  804c8f:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  804c95:	00 00                	add    %al,(%rax)
+  804c97:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  804c9d:	00 00                	add    %al,(%rax)
+  804c9f:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  804ca5:	00 00                	add    %al,(%rax)
+  804ca7:	00 ca                	add    %cl,%dl
+  804ca9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804caf:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  804cb5:	00 00                	add    %al,(%rax)
+  804cb7:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  804cbd:	00 00                	add    %al,(%rax)
+  804cbf:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  804cc5:	00 00                	add    %al,(%rax)
+  804cc7:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  804ccd:	00 00                	add    %al,(%rax)
+  804ccf:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  804cd5:	00 00                	add    %al,(%rax)
+  804cd7:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  804cdd:	00 00                	add    %al,(%rax)
+  804cdf:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  804ce5:	00 00                	add    %al,(%rax)
+  804ce7:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  804ced:	00 00                	add    %al,(%rax)
+  804cef:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  804cf5:	00 00                	add    %al,(%rax)
+  804cf7:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  804cfd:	00 00                	add    %al,(%rax)
+  804cff:	00 16                	add    %dl,(%rsi)
+  804d01:	06                   	(bad)
+  804d02:	80 00 00             	addb   $0x0,(%rax)
+  804d05:	00 00                	add    %al,(%rax)
+  804d07:	00 e5                	add    %ah,%ch
+  804d09:	07                   	(bad)
+  804d0a:	80 00 00             	addb   $0x0,(%rax)
+  804d0d:	00 00                	add    %al,(%rax)
+  804d0f:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  804d15:	00 00                	add    %al,(%rax)
+  804d17:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  804d1d:	00 00                	add    %al,(%rax)
+  804d1f:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  804d25:	00 00                	add    %al,(%rax)
+  804d27:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  804d2d:	00 00                	add    %al,(%rax)
+  804d2f:	00 45 06             	add    %al,0x6(%rbp)
+  804d32:	80 00 00             	addb   $0x0,(%rax)
+  804d35:	00 00                	add    %al,(%rax)
+  804d37:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  804d3d:	00 00                	add    %al,(%rax)
+  804d3f:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  804d45:	00 00                	add    %al,(%rax)
+  804d47:	00 0b                	add    %cl,(%rbx)
+  804d49:	06                   	(bad)
+  804d4a:	80 00 00             	addb   $0x0,(%rax)
+  804d4d:	00 00                	add    %al,(%rax)
+  804d4f:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  804d55:	00 00                	add    %al,(%rax)
+  804d57:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  804d5d:	00 00                	add    %al,(%rax)
+  804d5f:	00 8d 09 80 00 00    	add    %cl,0x8009(%rbp)
+  804d65:	00 00                	add    %al,(%rax)
+  804d67:	00 57 0a             	add    %dl,0xa(%rdi)
+  804d6a:	80 00 00             	addb   $0x0,(%rax)
+  804d6d:	00 00                	add    %al,(%rax)
+  804d6f:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  804d75:	00 00                	add    %al,(%rax)
+  804d77:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  804d7d:	00 00                	add    %al,(%rax)
+  804d7f:	00 dc                	add    %bl,%ah
+  804d81:	06                   	(bad)
+  804d82:	80 00 00             	addb   $0x0,(%rax)
+  804d85:	00 00                	add    %al,(%rax)
+  804d87:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  804d8d:	00 00                	add    %al,(%rax)
+  804d8f:	00 b9 08 80 00 00    	add    %bh,0x8008(%rcx)
+  804d95:	00 00                	add    %al,(%rax)
+  804d97:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  804d9d:	00 00                	add    %al,(%rax)
+  804d9f:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  804da5:	00 00                	add    %al,(%rax)
+  804da7:	00 ca                	add    %cl,%dl
+  804da9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804daf:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  804db5:	00 00                	add    %al,(%rax)
+  804db7:	00 6f 05             	add    %ch,0x5(%rdi)
+  804dba:	80 00 00             	addb   $0x0,(%rax)
+  804dbd:	00 00                	add    %al,(%rax)
+	...
+
+0000000000804dc0 <error_string>:
+	...
+  804dc8:	6d 49 80 00 00 00 00 00 7f 49 80 00 00 00 00 00     mI.......I......
+  804dd8:	8f 49 80 00 00 00 00 00 a1 49 80 00 00 00 00 00     .I.......I......
+  804de8:	af 49 80 00 00 00 00 00 c3 49 80 00 00 00 00 00     .I.......I......
+  804df8:	d8 49 80 00 00 00 00 00 eb 49 80 00 00 00 00 00     .I.......I......
+  804e08:	fd 49 80 00 00 00 00 00 11 4a 80 00 00 00 00 00     .I.......J......
+  804e18:	21 4a 80 00 00 00 00 00 34 4a 80 00 00 00 00 00     !J......4J......
+  804e28:	4b 4a 80 00 00 00 00 00 61 4a 80 00 00 00 00 00     KJ......aJ......
+  804e38:	79 4a 80 00 00 00 00 00 91 4a 80 00 00 00 00 00     yJ.......J......
+  804e48:	9e 4a 80 00 00 00 00 00 78 4e 80 00 00 00 00 00     .J......xN......
+  804e58:	b2 4a 80 00 00 00 00 00 ca 4a 80 00 00 00 00 00     .J.......J......
+  804e68:	d4 4a 80 00 00 00 00 00 de 4a 80 00 00 00 00 00     .J.......J......
+  804e78:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  804e88:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  804e98:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  804ea8:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  804eb8:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 73 66 6f     ib/syscall.c.sfo
+  804ec8:	72 6b 28 29 20 69 73 20 6e 6f 74 20 69 6d 70 6c     rk() is not impl
+  804ed8:	65 6d 65 6e 74 65 64 00 6c 69 62 2f 66 6f 72 6b     emented.lib/fork
+  804ee8:	2e 63 00 0f 1f 44 00 00 5b 25 30 38 78 5d 20 75     .c...D..[%08x] u
+  804ef8:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  804f08:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  804f18:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  804f28:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  804f38:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  804f48:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  804f58:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  804f68:	0a 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f78:	84 00 00 00 00 00 66 90                             ......f.
+
+0000000000804f80 <devtab>:
+  804f80:	20 60 80 00 00 00 00 00 60 60 80 00 00 00 00 00      `......``......
+  804f90:	a0 60 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .`..............
+  804fa0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  804fb0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  804fc0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  804fd0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  804fe0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  804ff0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  805000:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  805010:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  805020:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  805030:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  805040:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  805050:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  805060:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  805070:	69 70 63 5f 73 65 6e 64 20 65 72 72 6f 72 3a 20     ipc_send error: 
+  805080:	25 69 0a 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e     %i..lib/ipc.c.f.
+  805090:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8050a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8050b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8050c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8050d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8050e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8050f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805100:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805110:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805120:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805130:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805140:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805150:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805160:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805170:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805180:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805190:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8051a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8051b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8051c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8051d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8051e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8051f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805200:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805210:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805220:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805230:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805240:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805250:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805260:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805270:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805280:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805290:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8052a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8052b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8052c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8052d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8052e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8052f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805300:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805310:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805320:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805330:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805340:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805350:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805360:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805370:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805380:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805390:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8053a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8053b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8053c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8053d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8053e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8053f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805400:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805410:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805420:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805430:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805440:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805450:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805460:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805470:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805480:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805490:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8054a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8054b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8054c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8054d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8054e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8054f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805500:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805510:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805520:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805530:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805540:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805550:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805560:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805570:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805580:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805590:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8055a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8055b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8055c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8055d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8055e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8055f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805600:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805610:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805620:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805630:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805640:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805650:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805660:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805670:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805680:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805690:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8056a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8056b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8056c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8056d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8056e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8056f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805700:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805710:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805720:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805730:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805740:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805750:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805760:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805770:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805780:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805790:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8057a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8057b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8057c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8057d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8057e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8057f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805800:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805810:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805820:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805830:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805840:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805850:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805860:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805870:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805880:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805890:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8058a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8058b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8058c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8058d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8058e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8058f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805900:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805910:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805920:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805930:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805940:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805950:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805960:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805970:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805980:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805990:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8059a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8059b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8059c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8059d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8059e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8059f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805aa0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ab0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ac0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ad0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ae0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805af0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ba0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805bb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805bc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805bd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805be0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805bf0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ca0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805cb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805cc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805cd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ce0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805cf0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805da0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805db0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805dc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805dd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805de0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805df0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ea0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805eb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ec0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ed0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ee0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ef0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805fa0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805fb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805fc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805fd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805fe0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ff0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 40 00     ..f...........@.
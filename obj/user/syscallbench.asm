@@ -0,0 +1,8281 @@
+
+obj/user/syscallbench:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 18 01 00 00       	call   80013b <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+                 : "cc", "memory");
+    return ret;
+}
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 56                	push   %r14
+  80002b:	41 55                	push   %r13
+  80002d:	41 54                	push   %r12
+  80002f:	53                   	push   %rbx
+    envid_t id = sys_getenvid();
+  800030:	48 b8 58 11 80 00 00 	movabs $0x801158,%rax
+  800037:	00 00 00 
+  80003a:	ff d0                	call   *%rax
+  80003c:	41 89 c0             	mov    %eax,%r8d
+    asm volatile("int %1"
+  80003f:	b8 02 00 00 00       	mov    $0x2,%eax
+  800044:	cd 30                	int    $0x30
+    if (getenvid_int() != id) panic("int $T_SYSCALL returned %08x instead of %08x", getenvid_int(), id);
+  800046:	41 39 c0             	cmp    %eax,%r8d
+  800049:	0f 85 b8 00 00 00    	jne    800107 <umain+0xe2>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  80004f:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800051:	48 c1 e2 20          	shl    $0x20,%rdx
+  800055:	89 c0                	mov    %eax,%eax
+  800057:	48 89 d6             	mov    %rdx,%rsi
+  80005a:	48 09 c6             	or     %rax,%rsi
+  80005d:	ba a0 86 01 00       	mov    $0x186a0,%edx
+    asm volatile("int %1"
+  800062:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800067:	89 c8                	mov    %ecx,%eax
+  800069:	cd 30                	int    $0x30
+
+    uint64_t start = read_tsc();
+    for (int i = 0; i < NITERS; i++) getenvid_int();
+  80006b:	83 ea 01             	sub    $0x1,%edx
+  80006e:	75 f7                	jne    800067 <umain+0x42>
+    asm volatile("rdtsc"
+  800070:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800072:	48 c1 e2 20          	shl    $0x20,%rdx
+  800076:	89 c0                	mov    %eax,%eax
+  800078:	48 09 c2             	or     %rax,%rdx
+    uint64_t trap = read_tsc() - start;
+  80007b:	48 29 f2             	sub    %rsi,%rdx
+  80007e:	49 89 d5             	mov    %rdx,%r13
+    asm volatile("rdtsc"
+  800081:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800083:	48 c1 e2 20          	shl    $0x20,%rdx
+  800087:	89 c0                	mov    %eax,%eax
+  800089:	48 09 c2             	or     %rax,%rdx
+  80008c:	49 89 d6             	mov    %rdx,%r14
+  80008f:	bb a0 86 01 00       	mov    $0x186a0,%ebx
+
+    start = read_tsc();
+    for (int i = 0; i < NITERS; i++) sys_getenvid();
+  800094:	49 bc 58 11 80 00 00 	movabs $0x801158,%r12
+  80009b:	00 00 00 
+  80009e:	41 ff d4             	call   *%r12
+  8000a1:	83 eb 01             	sub    $0x1,%ebx
+  8000a4:	75 f8                	jne    80009e <umain+0x79>
+    asm volatile("rdtsc"
+  8000a6:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8000a8:	48 c1 e2 20          	shl    $0x20,%rdx
+  8000ac:	89 c0                	mov    %eax,%eax
+  8000ae:	48 09 c2             	or     %rax,%rdx
+    uint64_t fast = read_tsc() - start;
+  8000b1:	4c 29 f2             	sub    %r14,%rdx
+
+    cprintf("syscallbench: sys_getenvid takes %lu cycles with int, %lu cycles with syscall\n",
+            (unsigned long)(trap / NITERS), (unsigned long)(fast / NITERS));
+  8000b4:	48 c1 ea 05          	shr    $0x5,%rdx
+  8000b8:	48 be 43 78 b4 71 c4 	movabs $0xa7c5ac471b47843,%rsi
+  8000bf:	5a 7c 0a 
+  8000c2:	48 89 d0             	mov    %rdx,%rax
+  8000c5:	48 f7 e6             	mul    %rsi
+  8000c8:	48 89 d1             	mov    %rdx,%rcx
+  8000cb:	48 c1 e9 07          	shr    $0x7,%rcx
+  8000cf:	49 c1 ed 05          	shr    $0x5,%r13
+  8000d3:	4c 89 e8             	mov    %r13,%rax
+  8000d6:	48 f7 e6             	mul    %rsi
+  8000d9:	48 89 d6             	mov    %rdx,%rsi
+  8000dc:	48 c1 ee 07          	shr    $0x7,%rsi
+    cprintf("syscallbench: sys_getenvid takes %lu cycles with int, %lu cycles with syscall\n",
+  8000e0:	48 89 ca             	mov    %rcx,%rdx
+  8000e3:	48 bf c8 47 80 00 00 	movabs $0x8047c8,%rdi
+  8000ea:	00 00 00 
+  8000ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000f2:	48 b9 61 03 80 00 00 	movabs $0x800361,%rcx
+  8000f9:	00 00 00 
+  8000fc:	ff d1                	call   *%rcx
+}
+  8000fe:	5b                   	pop    %rbx
+  8000ff:	41 5c                	pop    %r12
+  800101:	41 5d                	pop    %r13
+  800103:	41 5e                	pop    %r14
+  800105:	5d                   	pop    %rbp
+  800106:	c3                   	ret
+    asm volatile("int %1"
+  800107:	b8 02 00 00 00       	mov    $0x2,%eax
+  80010c:	cd 30                	int    $0x30
+    if (getenvid_int() != id) panic("int $T_SYSCALL returned %08x instead of %08x", getenvid_int(), id);
+  80010e:	89 c1                	mov    %eax,%ecx
+  800110:	48 ba 98 47 80 00 00 	movabs $0x804798,%rdx
+  800117:	00 00 00 
+  80011a:	be 18 00 00 00       	mov    $0x18,%esi
+  80011f:	48 bf 17 48 80 00 00 	movabs $0x804817,%rdi
+  800126:	00 00 00 
+  800129:	b8 00 00 00 00       	mov    $0x0,%eax
+  80012e:	49 b9 11 02 80 00 00 	movabs $0x800211,%r9
+  800135:	00 00 00 
+  800138:	41 ff d1             	call   *%r9
+
+000000000080013b <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80013b:	55                   	push   %rbp
+  80013c:	48 89 e5             	mov    %rsp,%rbp
+  80013f:	41 56                	push   %r14
+  800141:	41 55                	push   %r13
+  800143:	41 54                	push   %r12
+  800145:	53                   	push   %rbx
+  800146:	41 89 fd             	mov    %edi,%r13d
+  800149:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80014c:	48 ba e0 50 80 00 00 	movabs $0x8050e0,%rdx
+  800153:	00 00 00 
+  800156:	48 b8 e0 50 80 00 00 	movabs $0x8050e0,%rax
+  80015d:	00 00 00 
+  800160:	48 39 c2             	cmp    %rax,%rdx
+  800163:	73 17                	jae    80017c <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800165:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800168:	49 89 c4             	mov    %rax,%r12
+  80016b:	48 83 c3 08          	add    $0x8,%rbx
+  80016f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800174:	ff 53 f8             	call   *-0x8(%rbx)
+  800177:	4c 39 e3             	cmp    %r12,%rbx
+  80017a:	72 ef                	jb     80016b <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  80017c:	48 b8 58 11 80 00 00 	movabs $0x801158,%rax
+  800183:	00 00 00 
+  800186:	ff d0                	call   *%rax
+  800188:	89 c2                	mov    %eax,%edx
+  80018a:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  800190:	48 89 d0             	mov    %rdx,%rax
+  800193:	48 c1 e0 04          	shl    $0x4,%rax
+  800197:	48 29 d0             	sub    %rdx,%rax
+  80019a:	48 c1 e0 05          	shl    $0x5,%rax
+  80019e:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8001a5:	00 00 00 
+  8001a8:	48 01 d0             	add    %rdx,%rax
+  8001ab:	48 a3 00 00 81 00 00 	movabs %rax,0x810000
+  8001b2:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8001b5:	45 85 ed             	test   %r13d,%r13d
+  8001b8:	7e 0d                	jle    8001c7 <libmain+0x8c>
+  8001ba:	49 8b 06             	mov    (%r14),%rax
+  8001bd:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8001c4:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8001c7:	4c 89 f6             	mov    %r14,%rsi
+  8001ca:	44 89 ef             	mov    %r13d,%edi
+  8001cd:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8001d4:	00 00 00 
+  8001d7:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8001d9:	48 b8 ee 01 80 00 00 	movabs $0x8001ee,%rax
+  8001e0:	00 00 00 
+  8001e3:	ff d0                	call   *%rax
+#endif
+}
+  8001e5:	5b                   	pop    %rbx
+  8001e6:	41 5c                	pop    %r12
+  8001e8:	41 5d                	pop    %r13
+  8001ea:	41 5e                	pop    %r14
+  8001ec:	5d                   	pop    %rbp
+  8001ed:	c3                   	ret
+
+00000000008001ee <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8001ee:	55                   	push   %rbp
+  8001ef:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8001f2:	48 b8 3e 18 80 00 00 	movabs $0x80183e,%rax
+  8001f9:	00 00 00 
+  8001fc:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8001fe:	bf 00 00 00 00       	mov    $0x0,%edi
+  800203:	48 b8 f5 10 80 00 00 	movabs $0x8010f5,%rax
+  80020a:	00 00 00 
+  80020d:	ff d0                	call   *%rax
+}
+  80020f:	5d                   	pop    %rbp
+  800210:	c3                   	ret
+
+0000000000800211 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800211:	55                   	push   %rbp
+  800212:	48 89 e5             	mov    %rsp,%rbp
+  800215:	41 56                	push   %r14
+  800217:	41 55                	push   %r13
+  800219:	41 54                	push   %r12
+  80021b:	53                   	push   %rbx
+  80021c:	48 83 ec 50          	sub    $0x50,%rsp
+  800220:	49 89 fc             	mov    %rdi,%r12
+  800223:	41 89 f5             	mov    %esi,%r13d
+  800226:	48 89 d3             	mov    %rdx,%rbx
+  800229:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80022d:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800231:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800235:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80023c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800240:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800244:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800248:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80024c:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  800253:	00 00 00 
+  800256:	4c 8b 30             	mov    (%rax),%r14
+  800259:	48 b8 58 11 80 00 00 	movabs $0x801158,%rax
+  800260:	00 00 00 
+  800263:	ff d0                	call   *%rax
+  800265:	89 c6                	mov    %eax,%esi
+  800267:	45 89 e8             	mov    %r13d,%r8d
+  80026a:	4c 89 e1             	mov    %r12,%rcx
+  80026d:	4c 89 f2             	mov    %r14,%rdx
+  800270:	48 bf 38 48 80 00 00 	movabs $0x804838,%rdi
+  800277:	00 00 00 
+  80027a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80027f:	49 bc 61 03 80 00 00 	movabs $0x800361,%r12
+  800286:	00 00 00 
+  800289:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80028c:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800290:	48 89 df             	mov    %rbx,%rdi
+  800293:	48 b8 fd 02 80 00 00 	movabs $0x8002fd,%rax
+  80029a:	00 00 00 
+  80029d:	ff d0                	call   *%rax
+    cprintf("\n");
+  80029f:	48 bf 43 4e 80 00 00 	movabs $0x804e43,%rdi
+  8002a6:	00 00 00 
+  8002a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002ae:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8002b1:	cc                   	int3
+  8002b2:	eb fd                	jmp    8002b1 <_panic+0xa0>
+
+00000000008002b4 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8002b4:	55                   	push   %rbp
+  8002b5:	48 89 e5             	mov    %rsp,%rbp
+  8002b8:	53                   	push   %rbx
+  8002b9:	48 83 ec 08          	sub    $0x8,%rsp
+  8002bd:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8002c0:	8b 06                	mov    (%rsi),%eax
+  8002c2:	8d 50 01             	lea    0x1(%rax),%edx
+  8002c5:	89 16                	mov    %edx,(%rsi)
+  8002c7:	48 98                	cltq
+  8002c9:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8002ce:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8002d4:	74 0a                	je     8002e0 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8002d6:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8002da:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002de:	c9                   	leave
+  8002df:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8002e0:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8002e4:	be ff 00 00 00       	mov    $0xff,%esi
+  8002e9:	48 b8 ad 10 80 00 00 	movabs $0x8010ad,%rax
+  8002f0:	00 00 00 
+  8002f3:	ff d0                	call   *%rax
+        state->offset = 0;
+  8002f5:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8002fb:	eb d9                	jmp    8002d6 <putch+0x22>
+
+00000000008002fd <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8002fd:	55                   	push   %rbp
+  8002fe:	48 89 e5             	mov    %rsp,%rbp
+  800301:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800308:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80030b:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800312:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800317:	b8 00 00 00 00       	mov    $0x0,%eax
+  80031c:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80031f:	48 89 f1             	mov    %rsi,%rcx
+  800322:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800329:	48 bf b4 02 80 00 00 	movabs $0x8002b4,%rdi
+  800330:	00 00 00 
+  800333:	48 b8 b1 04 80 00 00 	movabs $0x8004b1,%rax
+  80033a:	00 00 00 
+  80033d:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80033f:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800346:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80034d:	48 b8 ad 10 80 00 00 	movabs $0x8010ad,%rax
+  800354:	00 00 00 
+  800357:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800359:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80035f:	c9                   	leave
+  800360:	c3                   	ret
+
+0000000000800361 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800361:	55                   	push   %rbp
+  800362:	48 89 e5             	mov    %rsp,%rbp
+  800365:	48 83 ec 50          	sub    $0x50,%rsp
+  800369:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80036d:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800371:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800375:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800379:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80037d:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800384:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800388:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80038c:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800390:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800394:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800398:	48 b8 fd 02 80 00 00 	movabs $0x8002fd,%rax
+  80039f:	00 00 00 
+  8003a2:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8003a4:	c9                   	leave
+  8003a5:	c3                   	ret
+
+00000000008003a6 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8003a6:	55                   	push   %rbp
+  8003a7:	48 89 e5             	mov    %rsp,%rbp
+  8003aa:	41 57                	push   %r15
+  8003ac:	41 56                	push   %r14
+  8003ae:	41 55                	push   %r13
+  8003b0:	41 54                	push   %r12
+  8003b2:	53                   	push   %rbx
+  8003b3:	48 83 ec 18          	sub    $0x18,%rsp
+  8003b7:	49 89 fc             	mov    %rdi,%r12
+  8003ba:	49 89 f5             	mov    %rsi,%r13
+  8003bd:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8003c1:	8b 45 10             	mov    0x10(%rbp),%eax
+  8003c4:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8003c7:	41 89 cf             	mov    %ecx,%r15d
+  8003ca:	4c 39 fa             	cmp    %r15,%rdx
+  8003cd:	73 5b                	jae    80042a <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8003cf:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8003d3:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8003d7:	85 db                	test   %ebx,%ebx
+  8003d9:	7e 0e                	jle    8003e9 <print_num+0x43>
+            putch(padc, put_arg);
+  8003db:	4c 89 ee             	mov    %r13,%rsi
+  8003de:	44 89 f7             	mov    %r14d,%edi
+  8003e1:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8003e4:	83 eb 01             	sub    $0x1,%ebx
+  8003e7:	75 f2                	jne    8003db <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8003e9:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8003ed:	48 b9 6c 48 80 00 00 	movabs $0x80486c,%rcx
+  8003f4:	00 00 00 
+  8003f7:	48 b8 5b 48 80 00 00 	movabs $0x80485b,%rax
+  8003fe:	00 00 00 
+  800401:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800405:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800409:	ba 00 00 00 00       	mov    $0x0,%edx
+  80040e:	49 f7 f7             	div    %r15
+  800411:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800415:	4c 89 ee             	mov    %r13,%rsi
+  800418:	41 ff d4             	call   *%r12
+}
+  80041b:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80041f:	5b                   	pop    %rbx
+  800420:	41 5c                	pop    %r12
+  800422:	41 5d                	pop    %r13
+  800424:	41 5e                	pop    %r14
+  800426:	41 5f                	pop    %r15
+  800428:	5d                   	pop    %rbp
+  800429:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80042a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80042e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800433:	49 f7 f7             	div    %r15
+  800436:	48 83 ec 08          	sub    $0x8,%rsp
+  80043a:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80043e:	52                   	push   %rdx
+  80043f:	45 0f be c9          	movsbl %r9b,%r9d
+  800443:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800447:	48 89 c2             	mov    %rax,%rdx
+  80044a:	48 b8 a6 03 80 00 00 	movabs $0x8003a6,%rax
+  800451:	00 00 00 
+  800454:	ff d0                	call   *%rax
+  800456:	48 83 c4 10          	add    $0x10,%rsp
+  80045a:	eb 8d                	jmp    8003e9 <print_num+0x43>
+
+000000000080045c <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80045c:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800460:	48 8b 06             	mov    (%rsi),%rax
+  800463:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800467:	73 0a                	jae    800473 <sprintputch+0x17>
+        *state->start++ = ch;
+  800469:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80046d:	48 89 16             	mov    %rdx,(%rsi)
+  800470:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800473:	c3                   	ret
+
+0000000000800474 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800474:	55                   	push   %rbp
+  800475:	48 89 e5             	mov    %rsp,%rbp
+  800478:	48 83 ec 50          	sub    $0x50,%rsp
+  80047c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800480:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800484:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800488:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80048f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800493:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800497:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80049b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80049f:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8004a3:	48 b8 b1 04 80 00 00 	movabs $0x8004b1,%rax
+  8004aa:	00 00 00 
+  8004ad:	ff d0                	call   *%rax
+}
+  8004af:	c9                   	leave
+  8004b0:	c3                   	ret
+
+00000000008004b1 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8004b1:	55                   	push   %rbp
+  8004b2:	48 89 e5             	mov    %rsp,%rbp
+  8004b5:	41 57                	push   %r15
+  8004b7:	41 56                	push   %r14
+  8004b9:	41 55                	push   %r13
+  8004bb:	41 54                	push   %r12
+  8004bd:	53                   	push   %rbx
+  8004be:	48 83 ec 38          	sub    $0x38,%rsp
+  8004c2:	49 89 fe             	mov    %rdi,%r14
+  8004c5:	49 89 f5             	mov    %rsi,%r13
+  8004c8:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8004cb:	48 8b 01             	mov    (%rcx),%rax
+  8004ce:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8004d2:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8004d6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004da:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8004de:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8004e2:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8004e6:	0f b6 3b             	movzbl (%rbx),%edi
+  8004e9:	40 80 ff 25          	cmp    $0x25,%dil
+  8004ed:	74 18                	je     800507 <vprintfmt+0x56>
+            if (!ch) return;
+  8004ef:	40 84 ff             	test   %dil,%dil
+  8004f2:	0f 84 b1 06 00 00    	je     800ba9 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8004f8:	40 0f b6 ff          	movzbl %dil,%edi
+  8004fc:	4c 89 ee             	mov    %r13,%rsi
+  8004ff:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800502:	4c 89 e3             	mov    %r12,%rbx
+  800505:	eb db                	jmp    8004e2 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800507:	be 00 00 00 00       	mov    $0x0,%esi
+  80050c:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800510:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800515:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80051b:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800522:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800526:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80052b:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800530:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800533:	83 e8 23             	sub    $0x23,%eax
+  800536:	3c 57                	cmp    $0x57,%al
+  800538:	0f 87 51 06 00 00    	ja     800b8f <vprintfmt+0x6de>
+  80053e:	0f b6 c0             	movzbl %al,%eax
+  800541:	48 b9 20 4a 80 00 00 	movabs $0x804a20,%rcx
+  800548:	00 00 00 
+  80054b:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80054e:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800551:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800555:	eb cf                	jmp    800526 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800557:	49 89 dc             	mov    %rbx,%r12
+  80055a:	be 01 00 00 00       	mov    $0x1,%esi
+  80055f:	eb c5                	jmp    800526 <vprintfmt+0x75>
+            padc = ch;
+  800561:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800565:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800568:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80056b:	eb b9                	jmp    800526 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80056d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800570:	83 f8 2f             	cmp    $0x2f,%eax
+  800573:	77 24                	ja     800599 <vprintfmt+0xe8>
+  800575:	89 c1                	mov    %eax,%ecx
+  800577:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  80057b:	83 c0 08             	add    $0x8,%eax
+  80057e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800581:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800584:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800587:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80058b:	79 99                	jns    800526 <vprintfmt+0x75>
+                width = precision;
+  80058d:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800591:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800597:	eb 8d                	jmp    800526 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800599:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80059d:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8005a1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005a5:	eb da                	jmp    800581 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8005a7:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8005ac:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8005b0:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8005b6:	3c 39                	cmp    $0x39,%al
+  8005b8:	77 1c                	ja     8005d6 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8005ba:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8005be:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8005c2:	0f b6 c0             	movzbl %al,%eax
+  8005c5:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8005ca:	0f b6 03             	movzbl (%rbx),%eax
+  8005cd:	3c 39                	cmp    $0x39,%al
+  8005cf:	76 e9                	jbe    8005ba <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8005d1:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8005d4:	eb b1                	jmp    800587 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8005d6:	49 89 dc             	mov    %rbx,%r12
+  8005d9:	eb ac                	jmp    800587 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8005db:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8005de:	85 c9                	test   %ecx,%ecx
+  8005e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005e5:	0f 49 c1             	cmovns %ecx,%eax
+  8005e8:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8005eb:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005ee:	e9 33 ff ff ff       	jmp    800526 <vprintfmt+0x75>
+            lflag++;
+  8005f3:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8005f6:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005f9:	e9 28 ff ff ff       	jmp    800526 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8005fe:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800601:	83 f8 2f             	cmp    $0x2f,%eax
+  800604:	77 19                	ja     80061f <vprintfmt+0x16e>
+  800606:	89 c2                	mov    %eax,%edx
+  800608:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80060c:	83 c0 08             	add    $0x8,%eax
+  80060f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800612:	8b 3a                	mov    (%rdx),%edi
+  800614:	4c 89 ee             	mov    %r13,%rsi
+  800617:	41 ff d6             	call   *%r14
+            break;
+  80061a:	e9 c3 fe ff ff       	jmp    8004e2 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80061f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800623:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800627:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80062b:	eb e5                	jmp    800612 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80062d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800630:	83 f8 2f             	cmp    $0x2f,%eax
+  800633:	77 5a                	ja     80068f <vprintfmt+0x1de>
+  800635:	89 c2                	mov    %eax,%edx
+  800637:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80063b:	83 c0 08             	add    $0x8,%eax
+  80063e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800641:	8b 02                	mov    (%rdx),%eax
+  800643:	89 c1                	mov    %eax,%ecx
+  800645:	f7 d9                	neg    %ecx
+  800647:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80064a:	83 f9 16             	cmp    $0x16,%ecx
+  80064d:	7f 4e                	jg     80069d <vprintfmt+0x1ec>
+  80064f:	48 63 c1             	movslq %ecx,%rax
+  800652:	48 ba e0 4c 80 00 00 	movabs $0x804ce0,%rdx
+  800659:	00 00 00 
+  80065c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800660:	48 85 c0             	test   %rax,%rax
+  800663:	74 38                	je     80069d <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800665:	48 89 c1             	mov    %rax,%rcx
+  800668:	48 ba b9 4e 80 00 00 	movabs $0x804eb9,%rdx
+  80066f:	00 00 00 
+  800672:	4c 89 ee             	mov    %r13,%rsi
+  800675:	4c 89 f7             	mov    %r14,%rdi
+  800678:	b8 00 00 00 00       	mov    $0x0,%eax
+  80067d:	49 b8 74 04 80 00 00 	movabs $0x800474,%r8
+  800684:	00 00 00 
+  800687:	41 ff d0             	call   *%r8
+  80068a:	e9 53 fe ff ff       	jmp    8004e2 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80068f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800693:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800697:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80069b:	eb a4                	jmp    800641 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80069d:	48 ba 84 48 80 00 00 	movabs $0x804884,%rdx
+  8006a4:	00 00 00 
+  8006a7:	4c 89 ee             	mov    %r13,%rsi
+  8006aa:	4c 89 f7             	mov    %r14,%rdi
+  8006ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006b2:	49 b8 74 04 80 00 00 	movabs $0x800474,%r8
+  8006b9:	00 00 00 
+  8006bc:	41 ff d0             	call   *%r8
+  8006bf:	e9 1e fe ff ff       	jmp    8004e2 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8006c4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006c7:	83 f8 2f             	cmp    $0x2f,%eax
+  8006ca:	77 6c                	ja     800738 <vprintfmt+0x287>
+  8006cc:	89 c2                	mov    %eax,%edx
+  8006ce:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006d2:	83 c0 08             	add    $0x8,%eax
+  8006d5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006d8:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8006db:	48 85 d2             	test   %rdx,%rdx
+  8006de:	48 b8 7d 48 80 00 00 	movabs $0x80487d,%rax
+  8006e5:	00 00 00 
+  8006e8:	48 0f 45 c2          	cmovne %rdx,%rax
+  8006ec:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8006f0:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8006f4:	7e 06                	jle    8006fc <vprintfmt+0x24b>
+  8006f6:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8006fa:	75 4a                	jne    800746 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8006fc:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800700:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800704:	0f b6 00             	movzbl (%rax),%eax
+  800707:	84 c0                	test   %al,%al
+  800709:	0f 85 9a 00 00 00    	jne    8007a9 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80070f:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800712:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800716:	85 c0                	test   %eax,%eax
+  800718:	0f 8e c4 fd ff ff    	jle    8004e2 <vprintfmt+0x31>
+  80071e:	4c 89 ee             	mov    %r13,%rsi
+  800721:	bf 20 00 00 00       	mov    $0x20,%edi
+  800726:	41 ff d6             	call   *%r14
+  800729:	41 83 ec 01          	sub    $0x1,%r12d
+  80072d:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800731:	75 eb                	jne    80071e <vprintfmt+0x26d>
+  800733:	e9 aa fd ff ff       	jmp    8004e2 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800738:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80073c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800740:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800744:	eb 92                	jmp    8006d8 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800746:	49 63 f7             	movslq %r15d,%rsi
+  800749:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80074d:	48 b8 63 0c 80 00 00 	movabs $0x800c63,%rax
+  800754:	00 00 00 
+  800757:	ff d0                	call   *%rax
+  800759:	48 89 c2             	mov    %rax,%rdx
+  80075c:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80075f:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800761:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800764:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800767:	85 c0                	test   %eax,%eax
+  800769:	7e 91                	jle    8006fc <vprintfmt+0x24b>
+  80076b:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800770:	4c 89 ee             	mov    %r13,%rsi
+  800773:	44 89 e7             	mov    %r12d,%edi
+  800776:	41 ff d6             	call   *%r14
+  800779:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80077d:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800780:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800783:	75 eb                	jne    800770 <vprintfmt+0x2bf>
+  800785:	e9 72 ff ff ff       	jmp    8006fc <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80078a:	0f b6 f8             	movzbl %al,%edi
+  80078d:	4c 89 ee             	mov    %r13,%rsi
+  800790:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800793:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800797:	49 83 c4 01          	add    $0x1,%r12
+  80079b:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8007a1:	84 c0                	test   %al,%al
+  8007a3:	0f 84 66 ff ff ff    	je     80070f <vprintfmt+0x25e>
+  8007a9:	45 85 ff             	test   %r15d,%r15d
+  8007ac:	78 0a                	js     8007b8 <vprintfmt+0x307>
+  8007ae:	41 83 ef 01          	sub    $0x1,%r15d
+  8007b2:	0f 88 57 ff ff ff    	js     80070f <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8007b8:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8007bc:	74 cc                	je     80078a <vprintfmt+0x2d9>
+  8007be:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8007c1:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8007c6:	80 fa 5e             	cmp    $0x5e,%dl
+  8007c9:	77 c2                	ja     80078d <vprintfmt+0x2dc>
+  8007cb:	eb bd                	jmp    80078a <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8007cd:	40 84 f6             	test   %sil,%sil
+  8007d0:	75 26                	jne    8007f8 <vprintfmt+0x347>
+    switch (lflag) {
+  8007d2:	85 d2                	test   %edx,%edx
+  8007d4:	74 59                	je     80082f <vprintfmt+0x37e>
+  8007d6:	83 fa 01             	cmp    $0x1,%edx
+  8007d9:	74 7b                	je     800856 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8007db:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007de:	83 f8 2f             	cmp    $0x2f,%eax
+  8007e1:	0f 87 96 00 00 00    	ja     80087d <vprintfmt+0x3cc>
+  8007e7:	89 c2                	mov    %eax,%edx
+  8007e9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007ed:	83 c0 08             	add    $0x8,%eax
+  8007f0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007f3:	4c 8b 22             	mov    (%rdx),%r12
+  8007f6:	eb 17                	jmp    80080f <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8007f8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007fb:	83 f8 2f             	cmp    $0x2f,%eax
+  8007fe:	77 21                	ja     800821 <vprintfmt+0x370>
+  800800:	89 c2                	mov    %eax,%edx
+  800802:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800806:	83 c0 08             	add    $0x8,%eax
+  800809:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80080c:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80080f:	4d 85 e4             	test   %r12,%r12
+  800812:	78 7a                	js     80088e <vprintfmt+0x3dd>
+            num = i;
+  800814:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800817:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80081c:	e9 50 02 00 00       	jmp    800a71 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800821:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800825:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800829:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80082d:	eb dd                	jmp    80080c <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  80082f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800832:	83 f8 2f             	cmp    $0x2f,%eax
+  800835:	77 11                	ja     800848 <vprintfmt+0x397>
+  800837:	89 c2                	mov    %eax,%edx
+  800839:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80083d:	83 c0 08             	add    $0x8,%eax
+  800840:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800843:	4c 63 22             	movslq (%rdx),%r12
+  800846:	eb c7                	jmp    80080f <vprintfmt+0x35e>
+  800848:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80084c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800850:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800854:	eb ed                	jmp    800843 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800856:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800859:	83 f8 2f             	cmp    $0x2f,%eax
+  80085c:	77 11                	ja     80086f <vprintfmt+0x3be>
+  80085e:	89 c2                	mov    %eax,%edx
+  800860:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800864:	83 c0 08             	add    $0x8,%eax
+  800867:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80086a:	4c 8b 22             	mov    (%rdx),%r12
+  80086d:	eb a0                	jmp    80080f <vprintfmt+0x35e>
+  80086f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800873:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800877:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80087b:	eb ed                	jmp    80086a <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  80087d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800881:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800885:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800889:	e9 65 ff ff ff       	jmp    8007f3 <vprintfmt+0x342>
+                putch('-', put_arg);
+  80088e:	4c 89 ee             	mov    %r13,%rsi
+  800891:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800896:	41 ff d6             	call   *%r14
+                i = -i;
+  800899:	49 f7 dc             	neg    %r12
+  80089c:	e9 73 ff ff ff       	jmp    800814 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8008a1:	40 84 f6             	test   %sil,%sil
+  8008a4:	75 32                	jne    8008d8 <vprintfmt+0x427>
+    switch (lflag) {
+  8008a6:	85 d2                	test   %edx,%edx
+  8008a8:	74 5d                	je     800907 <vprintfmt+0x456>
+  8008aa:	83 fa 01             	cmp    $0x1,%edx
+  8008ad:	0f 84 82 00 00 00    	je     800935 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8008b3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008b6:	83 f8 2f             	cmp    $0x2f,%eax
+  8008b9:	0f 87 a5 00 00 00    	ja     800964 <vprintfmt+0x4b3>
+  8008bf:	89 c2                	mov    %eax,%edx
+  8008c1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008c5:	83 c0 08             	add    $0x8,%eax
+  8008c8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008cb:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8008ce:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8008d3:	e9 99 01 00 00       	jmp    800a71 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8008d8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008db:	83 f8 2f             	cmp    $0x2f,%eax
+  8008de:	77 19                	ja     8008f9 <vprintfmt+0x448>
+  8008e0:	89 c2                	mov    %eax,%edx
+  8008e2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008e6:	83 c0 08             	add    $0x8,%eax
+  8008e9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008ec:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8008ef:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8008f4:	e9 78 01 00 00       	jmp    800a71 <vprintfmt+0x5c0>
+  8008f9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008fd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800901:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800905:	eb e5                	jmp    8008ec <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800907:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80090a:	83 f8 2f             	cmp    $0x2f,%eax
+  80090d:	77 18                	ja     800927 <vprintfmt+0x476>
+  80090f:	89 c2                	mov    %eax,%edx
+  800911:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800915:	83 c0 08             	add    $0x8,%eax
+  800918:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80091b:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80091d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800922:	e9 4a 01 00 00       	jmp    800a71 <vprintfmt+0x5c0>
+  800927:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80092b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80092f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800933:	eb e6                	jmp    80091b <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800935:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800938:	83 f8 2f             	cmp    $0x2f,%eax
+  80093b:	77 19                	ja     800956 <vprintfmt+0x4a5>
+  80093d:	89 c2                	mov    %eax,%edx
+  80093f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800943:	83 c0 08             	add    $0x8,%eax
+  800946:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800949:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80094c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800951:	e9 1b 01 00 00       	jmp    800a71 <vprintfmt+0x5c0>
+  800956:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80095a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80095e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800962:	eb e5                	jmp    800949 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800964:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800968:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80096c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800970:	e9 56 ff ff ff       	jmp    8008cb <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800975:	40 84 f6             	test   %sil,%sil
+  800978:	75 2e                	jne    8009a8 <vprintfmt+0x4f7>
+    switch (lflag) {
+  80097a:	85 d2                	test   %edx,%edx
+  80097c:	74 59                	je     8009d7 <vprintfmt+0x526>
+  80097e:	83 fa 01             	cmp    $0x1,%edx
+  800981:	74 7f                	je     800a02 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800983:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800986:	83 f8 2f             	cmp    $0x2f,%eax
+  800989:	0f 87 9f 00 00 00    	ja     800a2e <vprintfmt+0x57d>
+  80098f:	89 c2                	mov    %eax,%edx
+  800991:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800995:	83 c0 08             	add    $0x8,%eax
+  800998:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80099b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80099e:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8009a3:	e9 c9 00 00 00       	jmp    800a71 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009a8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009ab:	83 f8 2f             	cmp    $0x2f,%eax
+  8009ae:	77 19                	ja     8009c9 <vprintfmt+0x518>
+  8009b0:	89 c2                	mov    %eax,%edx
+  8009b2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009b6:	83 c0 08             	add    $0x8,%eax
+  8009b9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009bc:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8009bf:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8009c4:	e9 a8 00 00 00       	jmp    800a71 <vprintfmt+0x5c0>
+  8009c9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009cd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009d1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009d5:	eb e5                	jmp    8009bc <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8009d7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009da:	83 f8 2f             	cmp    $0x2f,%eax
+  8009dd:	77 15                	ja     8009f4 <vprintfmt+0x543>
+  8009df:	89 c2                	mov    %eax,%edx
+  8009e1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009e5:	83 c0 08             	add    $0x8,%eax
+  8009e8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009eb:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8009ed:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8009f2:	eb 7d                	jmp    800a71 <vprintfmt+0x5c0>
+  8009f4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009f8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009fc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a00:	eb e9                	jmp    8009eb <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800a02:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a05:	83 f8 2f             	cmp    $0x2f,%eax
+  800a08:	77 16                	ja     800a20 <vprintfmt+0x56f>
+  800a0a:	89 c2                	mov    %eax,%edx
+  800a0c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a10:	83 c0 08             	add    $0x8,%eax
+  800a13:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a16:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a19:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800a1e:	eb 51                	jmp    800a71 <vprintfmt+0x5c0>
+  800a20:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a24:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a28:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a2c:	eb e8                	jmp    800a16 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800a2e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a32:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a36:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a3a:	e9 5c ff ff ff       	jmp    80099b <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800a3f:	4c 89 ee             	mov    %r13,%rsi
+  800a42:	bf 30 00 00 00       	mov    $0x30,%edi
+  800a47:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800a4a:	4c 89 ee             	mov    %r13,%rsi
+  800a4d:	bf 78 00 00 00       	mov    $0x78,%edi
+  800a52:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800a55:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a58:	83 f8 2f             	cmp    $0x2f,%eax
+  800a5b:	77 47                	ja     800aa4 <vprintfmt+0x5f3>
+  800a5d:	89 c2                	mov    %eax,%edx
+  800a5f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a63:	83 c0 08             	add    $0x8,%eax
+  800a66:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a69:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a6c:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800a71:	48 83 ec 08          	sub    $0x8,%rsp
+  800a75:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800a79:	0f 94 c0             	sete   %al
+  800a7c:	0f b6 c0             	movzbl %al,%eax
+  800a7f:	50                   	push   %rax
+  800a80:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800a85:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800a89:	4c 89 ee             	mov    %r13,%rsi
+  800a8c:	4c 89 f7             	mov    %r14,%rdi
+  800a8f:	48 b8 a6 03 80 00 00 	movabs $0x8003a6,%rax
+  800a96:	00 00 00 
+  800a99:	ff d0                	call   *%rax
+            break;
+  800a9b:	48 83 c4 10          	add    $0x10,%rsp
+  800a9f:	e9 3e fa ff ff       	jmp    8004e2 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800aa4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aa8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aac:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ab0:	eb b7                	jmp    800a69 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800ab2:	40 84 f6             	test   %sil,%sil
+  800ab5:	75 2b                	jne    800ae2 <vprintfmt+0x631>
+    switch (lflag) {
+  800ab7:	85 d2                	test   %edx,%edx
+  800ab9:	74 56                	je     800b11 <vprintfmt+0x660>
+  800abb:	83 fa 01             	cmp    $0x1,%edx
+  800abe:	74 7f                	je     800b3f <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800ac0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ac3:	83 f8 2f             	cmp    $0x2f,%eax
+  800ac6:	0f 87 a2 00 00 00    	ja     800b6e <vprintfmt+0x6bd>
+  800acc:	89 c2                	mov    %eax,%edx
+  800ace:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ad2:	83 c0 08             	add    $0x8,%eax
+  800ad5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ad8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800adb:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800ae0:	eb 8f                	jmp    800a71 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800ae2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ae5:	83 f8 2f             	cmp    $0x2f,%eax
+  800ae8:	77 19                	ja     800b03 <vprintfmt+0x652>
+  800aea:	89 c2                	mov    %eax,%edx
+  800aec:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800af0:	83 c0 08             	add    $0x8,%eax
+  800af3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800af6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800af9:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800afe:	e9 6e ff ff ff       	jmp    800a71 <vprintfmt+0x5c0>
+  800b03:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b07:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b0b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b0f:	eb e5                	jmp    800af6 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800b11:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b14:	83 f8 2f             	cmp    $0x2f,%eax
+  800b17:	77 18                	ja     800b31 <vprintfmt+0x680>
+  800b19:	89 c2                	mov    %eax,%edx
+  800b1b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b1f:	83 c0 08             	add    $0x8,%eax
+  800b22:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b25:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800b27:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800b2c:	e9 40 ff ff ff       	jmp    800a71 <vprintfmt+0x5c0>
+  800b31:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b35:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b39:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b3d:	eb e6                	jmp    800b25 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800b3f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b42:	83 f8 2f             	cmp    $0x2f,%eax
+  800b45:	77 19                	ja     800b60 <vprintfmt+0x6af>
+  800b47:	89 c2                	mov    %eax,%edx
+  800b49:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b4d:	83 c0 08             	add    $0x8,%eax
+  800b50:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b53:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b56:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800b5b:	e9 11 ff ff ff       	jmp    800a71 <vprintfmt+0x5c0>
+  800b60:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b64:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b68:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b6c:	eb e5                	jmp    800b53 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800b6e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b72:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b76:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b7a:	e9 59 ff ff ff       	jmp    800ad8 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800b7f:	4c 89 ee             	mov    %r13,%rsi
+  800b82:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b87:	41 ff d6             	call   *%r14
+            break;
+  800b8a:	e9 53 f9 ff ff       	jmp    8004e2 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800b8f:	4c 89 ee             	mov    %r13,%rsi
+  800b92:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b97:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800b9a:	48 83 eb 01          	sub    $0x1,%rbx
+  800b9e:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800ba2:	75 f6                	jne    800b9a <vprintfmt+0x6e9>
+  800ba4:	e9 39 f9 ff ff       	jmp    8004e2 <vprintfmt+0x31>
+}
+  800ba9:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800bad:	5b                   	pop    %rbx
+  800bae:	41 5c                	pop    %r12
+  800bb0:	41 5d                	pop    %r13
+  800bb2:	41 5e                	pop    %r14
+  800bb4:	41 5f                	pop    %r15
+  800bb6:	5d                   	pop    %rbp
+  800bb7:	c3                   	ret
+
+0000000000800bb8 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800bb8:	55                   	push   %rbp
+  800bb9:	48 89 e5             	mov    %rsp,%rbp
+  800bbc:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800bc0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800bc4:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800bc9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800bcd:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800bd4:	48 85 ff             	test   %rdi,%rdi
+  800bd7:	74 2b                	je     800c04 <vsnprintf+0x4c>
+  800bd9:	48 85 f6             	test   %rsi,%rsi
+  800bdc:	74 26                	je     800c04 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800bde:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800be2:	48 bf 5c 04 80 00 00 	movabs $0x80045c,%rdi
+  800be9:	00 00 00 
+  800bec:	48 b8 b1 04 80 00 00 	movabs $0x8004b1,%rax
+  800bf3:	00 00 00 
+  800bf6:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800bf8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bfc:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800bff:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800c02:	c9                   	leave
+  800c03:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800c04:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c09:	eb f7                	jmp    800c02 <vsnprintf+0x4a>
+
+0000000000800c0b <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800c0b:	55                   	push   %rbp
+  800c0c:	48 89 e5             	mov    %rsp,%rbp
+  800c0f:	48 83 ec 50          	sub    $0x50,%rsp
+  800c13:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800c17:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800c1b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800c1f:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800c26:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800c2a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c2e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800c32:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800c36:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800c3a:	48 b8 b8 0b 80 00 00 	movabs $0x800bb8,%rax
+  800c41:	00 00 00 
+  800c44:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800c46:	c9                   	leave
+  800c47:	c3                   	ret
+
+0000000000800c48 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800c48:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800c4b:	74 10                	je     800c5d <strlen+0x15>
+    size_t n = 0;
+  800c4d:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800c52:	48 83 c0 01          	add    $0x1,%rax
+  800c56:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800c5a:	75 f6                	jne    800c52 <strlen+0xa>
+  800c5c:	c3                   	ret
+    size_t n = 0;
+  800c5d:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800c62:	c3                   	ret
+
+0000000000800c63 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800c63:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800c66:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800c6b:	48 85 f6             	test   %rsi,%rsi
+  800c6e:	74 11                	je     800c81 <strnlen+0x1e>
+  800c70:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800c74:	74 0c                	je     800c82 <strnlen+0x1f>
+  800c76:	48 83 c2 01          	add    $0x1,%rdx
+  800c7a:	48 39 d0             	cmp    %rdx,%rax
+  800c7d:	75 f1                	jne    800c70 <strnlen+0xd>
+  800c7f:	eb 04                	jmp    800c85 <strnlen+0x22>
+  800c81:	c3                   	ret
+  800c82:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800c85:	c3                   	ret
+
+0000000000800c86 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800c86:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800c89:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c8e:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800c92:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800c95:	48 83 c2 01          	add    $0x1,%rdx
+  800c99:	84 c9                	test   %cl,%cl
+  800c9b:	75 f1                	jne    800c8e <strcpy+0x8>
+        ;
+    return res;
+}
+  800c9d:	c3                   	ret
+
+0000000000800c9e <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800c9e:	55                   	push   %rbp
+  800c9f:	48 89 e5             	mov    %rsp,%rbp
+  800ca2:	41 54                	push   %r12
+  800ca4:	53                   	push   %rbx
+  800ca5:	48 89 fb             	mov    %rdi,%rbx
+  800ca8:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800cab:	48 b8 48 0c 80 00 00 	movabs $0x800c48,%rax
+  800cb2:	00 00 00 
+  800cb5:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800cb7:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800cbb:	4c 89 e6             	mov    %r12,%rsi
+  800cbe:	48 b8 86 0c 80 00 00 	movabs $0x800c86,%rax
+  800cc5:	00 00 00 
+  800cc8:	ff d0                	call   *%rax
+    return dst;
+}
+  800cca:	48 89 d8             	mov    %rbx,%rax
+  800ccd:	5b                   	pop    %rbx
+  800cce:	41 5c                	pop    %r12
+  800cd0:	5d                   	pop    %rbp
+  800cd1:	c3                   	ret
+
+0000000000800cd2 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800cd2:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800cd5:	48 85 d2             	test   %rdx,%rdx
+  800cd8:	74 1f                	je     800cf9 <strncpy+0x27>
+  800cda:	48 01 fa             	add    %rdi,%rdx
+  800cdd:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800ce0:	48 83 c1 01          	add    $0x1,%rcx
+  800ce4:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800ce8:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800cec:	41 80 f8 01          	cmp    $0x1,%r8b
+  800cf0:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800cf4:	48 39 ca             	cmp    %rcx,%rdx
+  800cf7:	75 e7                	jne    800ce0 <strncpy+0xe>
+    }
+    return ret;
+}
+  800cf9:	c3                   	ret
+
+0000000000800cfa <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800cfa:	48 89 f8             	mov    %rdi,%rax
+  800cfd:	48 85 d2             	test   %rdx,%rdx
+  800d00:	74 24                	je     800d26 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800d02:	48 83 ea 01          	sub    $0x1,%rdx
+  800d06:	74 1b                	je     800d23 <strlcpy+0x29>
+  800d08:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800d0c:	0f b6 16             	movzbl (%rsi),%edx
+  800d0f:	84 d2                	test   %dl,%dl
+  800d11:	74 10                	je     800d23 <strlcpy+0x29>
+            *dst++ = *src++;
+  800d13:	48 83 c6 01          	add    $0x1,%rsi
+  800d17:	48 83 c0 01          	add    $0x1,%rax
+  800d1b:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800d1e:	48 39 c8             	cmp    %rcx,%rax
+  800d21:	75 e9                	jne    800d0c <strlcpy+0x12>
+        *dst = '\0';
+  800d23:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800d26:	48 29 f8             	sub    %rdi,%rax
+}
+  800d29:	c3                   	ret
+
+0000000000800d2a <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800d2a:	0f b6 07             	movzbl (%rdi),%eax
+  800d2d:	84 c0                	test   %al,%al
+  800d2f:	74 13                	je     800d44 <strcmp+0x1a>
+  800d31:	38 06                	cmp    %al,(%rsi)
+  800d33:	75 0f                	jne    800d44 <strcmp+0x1a>
+  800d35:	48 83 c7 01          	add    $0x1,%rdi
+  800d39:	48 83 c6 01          	add    $0x1,%rsi
+  800d3d:	0f b6 07             	movzbl (%rdi),%eax
+  800d40:	84 c0                	test   %al,%al
+  800d42:	75 ed                	jne    800d31 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d44:	0f b6 c0             	movzbl %al,%eax
+  800d47:	0f b6 16             	movzbl (%rsi),%edx
+  800d4a:	29 d0                	sub    %edx,%eax
+}
+  800d4c:	c3                   	ret
+
+0000000000800d4d <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800d4d:	48 85 d2             	test   %rdx,%rdx
+  800d50:	74 1f                	je     800d71 <strncmp+0x24>
+  800d52:	0f b6 07             	movzbl (%rdi),%eax
+  800d55:	84 c0                	test   %al,%al
+  800d57:	74 1e                	je     800d77 <strncmp+0x2a>
+  800d59:	3a 06                	cmp    (%rsi),%al
+  800d5b:	75 1a                	jne    800d77 <strncmp+0x2a>
+  800d5d:	48 83 c7 01          	add    $0x1,%rdi
+  800d61:	48 83 c6 01          	add    $0x1,%rsi
+  800d65:	48 83 ea 01          	sub    $0x1,%rdx
+  800d69:	75 e7                	jne    800d52 <strncmp+0x5>
+
+    if (!n) return 0;
+  800d6b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d70:	c3                   	ret
+  800d71:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d76:	c3                   	ret
+  800d77:	48 85 d2             	test   %rdx,%rdx
+  800d7a:	74 09                	je     800d85 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d7c:	0f b6 07             	movzbl (%rdi),%eax
+  800d7f:	0f b6 16             	movzbl (%rsi),%edx
+  800d82:	29 d0                	sub    %edx,%eax
+  800d84:	c3                   	ret
+    if (!n) return 0;
+  800d85:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d8a:	c3                   	ret
+
+0000000000800d8b <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800d8b:	0f b6 17             	movzbl (%rdi),%edx
+  800d8e:	84 d2                	test   %dl,%dl
+  800d90:	74 18                	je     800daa <strchr+0x1f>
+        if (*str == c) {
+  800d92:	0f be d2             	movsbl %dl,%edx
+  800d95:	39 f2                	cmp    %esi,%edx
+  800d97:	74 17                	je     800db0 <strchr+0x25>
+    for (; *str; str++) {
+  800d99:	48 83 c7 01          	add    $0x1,%rdi
+  800d9d:	0f b6 17             	movzbl (%rdi),%edx
+  800da0:	84 d2                	test   %dl,%dl
+  800da2:	75 ee                	jne    800d92 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800da4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800da9:	c3                   	ret
+  800daa:	b8 00 00 00 00       	mov    $0x0,%eax
+  800daf:	c3                   	ret
+  800db0:	48 89 f8             	mov    %rdi,%rax
+}
+  800db3:	c3                   	ret
+
+0000000000800db4 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800db4:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800db7:	0f b6 17             	movzbl (%rdi),%edx
+  800dba:	84 d2                	test   %dl,%dl
+  800dbc:	74 13                	je     800dd1 <strfind+0x1d>
+  800dbe:	0f be d2             	movsbl %dl,%edx
+  800dc1:	39 f2                	cmp    %esi,%edx
+  800dc3:	74 0b                	je     800dd0 <strfind+0x1c>
+  800dc5:	48 83 c0 01          	add    $0x1,%rax
+  800dc9:	0f b6 10             	movzbl (%rax),%edx
+  800dcc:	84 d2                	test   %dl,%dl
+  800dce:	75 ee                	jne    800dbe <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800dd0:	c3                   	ret
+  800dd1:	c3                   	ret
+
+0000000000800dd2 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800dd2:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800dd5:	48 89 f8             	mov    %rdi,%rax
+  800dd8:	48 f7 d8             	neg    %rax
+  800ddb:	83 e0 07             	and    $0x7,%eax
+  800dde:	49 89 d1             	mov    %rdx,%r9
+  800de1:	49 29 c1             	sub    %rax,%r9
+  800de4:	78 36                	js     800e1c <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800de6:	40 0f b6 c6          	movzbl %sil,%eax
+  800dea:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800df1:	01 01 01 
+  800df4:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800df8:	40 f6 c7 07          	test   $0x7,%dil
+  800dfc:	75 38                	jne    800e36 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800dfe:	4c 89 c9             	mov    %r9,%rcx
+  800e01:	48 c1 f9 03          	sar    $0x3,%rcx
+  800e05:	74 0c                	je     800e13 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800e07:	fc                   	cld
+  800e08:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800e0b:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800e0f:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800e13:	4d 85 c9             	test   %r9,%r9
+  800e16:	75 45                	jne    800e5d <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800e18:	4c 89 c0             	mov    %r8,%rax
+  800e1b:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800e1c:	48 85 d2             	test   %rdx,%rdx
+  800e1f:	74 f7                	je     800e18 <memset+0x46>
+  800e21:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800e24:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800e27:	48 83 c0 01          	add    $0x1,%rax
+  800e2b:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800e2f:	48 39 c2             	cmp    %rax,%rdx
+  800e32:	75 f3                	jne    800e27 <memset+0x55>
+  800e34:	eb e2                	jmp    800e18 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800e36:	40 f6 c7 01          	test   $0x1,%dil
+  800e3a:	74 06                	je     800e42 <memset+0x70>
+  800e3c:	88 07                	mov    %al,(%rdi)
+  800e3e:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e42:	40 f6 c7 02          	test   $0x2,%dil
+  800e46:	74 07                	je     800e4f <memset+0x7d>
+  800e48:	66 89 07             	mov    %ax,(%rdi)
+  800e4b:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e4f:	40 f6 c7 04          	test   $0x4,%dil
+  800e53:	74 a9                	je     800dfe <memset+0x2c>
+  800e55:	89 07                	mov    %eax,(%rdi)
+  800e57:	48 83 c7 04          	add    $0x4,%rdi
+  800e5b:	eb a1                	jmp    800dfe <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e5d:	41 f6 c1 04          	test   $0x4,%r9b
+  800e61:	74 06                	je     800e69 <memset+0x97>
+  800e63:	89 07                	mov    %eax,(%rdi)
+  800e65:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e69:	41 f6 c1 02          	test   $0x2,%r9b
+  800e6d:	74 07                	je     800e76 <memset+0xa4>
+  800e6f:	66 89 07             	mov    %ax,(%rdi)
+  800e72:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800e76:	41 f6 c1 01          	test   $0x1,%r9b
+  800e7a:	74 9c                	je     800e18 <memset+0x46>
+  800e7c:	88 07                	mov    %al,(%rdi)
+  800e7e:	eb 98                	jmp    800e18 <memset+0x46>
+
+0000000000800e80 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800e80:	48 89 f8             	mov    %rdi,%rax
+  800e83:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800e86:	48 39 fe             	cmp    %rdi,%rsi
+  800e89:	73 3b                	jae    800ec6 <memmove+0x46>
+  800e8b:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800e8f:	48 39 d7             	cmp    %rdx,%rdi
+  800e92:	73 32                	jae    800ec6 <memmove+0x46>
+        s += n;
+        d += n;
+  800e94:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800e98:	48 89 d6             	mov    %rdx,%rsi
+  800e9b:	48 09 fe             	or     %rdi,%rsi
+  800e9e:	48 09 ce             	or     %rcx,%rsi
+  800ea1:	40 f6 c6 07          	test   $0x7,%sil
+  800ea5:	75 12                	jne    800eb9 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800ea7:	48 83 ef 08          	sub    $0x8,%rdi
+  800eab:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800eaf:	48 c1 e9 03          	shr    $0x3,%rcx
+  800eb3:	fd                   	std
+  800eb4:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800eb7:	fc                   	cld
+  800eb8:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800eb9:	48 83 ef 01          	sub    $0x1,%rdi
+  800ebd:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800ec1:	fd                   	std
+  800ec2:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800ec4:	eb f1                	jmp    800eb7 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800ec6:	48 89 f2             	mov    %rsi,%rdx
+  800ec9:	48 09 c2             	or     %rax,%rdx
+  800ecc:	48 09 ca             	or     %rcx,%rdx
+  800ecf:	f6 c2 07             	test   $0x7,%dl
+  800ed2:	75 0c                	jne    800ee0 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800ed4:	48 c1 e9 03          	shr    $0x3,%rcx
+  800ed8:	48 89 c7             	mov    %rax,%rdi
+  800edb:	fc                   	cld
+  800edc:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800edf:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800ee0:	48 89 c7             	mov    %rax,%rdi
+  800ee3:	fc                   	cld
+  800ee4:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800ee6:	c3                   	ret
+
+0000000000800ee7 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800ee7:	55                   	push   %rbp
+  800ee8:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800eeb:	48 b8 80 0e 80 00 00 	movabs $0x800e80,%rax
+  800ef2:	00 00 00 
+  800ef5:	ff d0                	call   *%rax
+}
+  800ef7:	5d                   	pop    %rbp
+  800ef8:	c3                   	ret
+
+0000000000800ef9 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800ef9:	55                   	push   %rbp
+  800efa:	48 89 e5             	mov    %rsp,%rbp
+  800efd:	41 57                	push   %r15
+  800eff:	41 56                	push   %r14
+  800f01:	41 55                	push   %r13
+  800f03:	41 54                	push   %r12
+  800f05:	53                   	push   %rbx
+  800f06:	48 83 ec 08          	sub    $0x8,%rsp
+  800f0a:	49 89 fe             	mov    %rdi,%r14
+  800f0d:	49 89 f7             	mov    %rsi,%r15
+  800f10:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800f13:	48 89 f7             	mov    %rsi,%rdi
+  800f16:	48 b8 48 0c 80 00 00 	movabs $0x800c48,%rax
+  800f1d:	00 00 00 
+  800f20:	ff d0                	call   *%rax
+  800f22:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800f25:	48 89 de             	mov    %rbx,%rsi
+  800f28:	4c 89 f7             	mov    %r14,%rdi
+  800f2b:	48 b8 63 0c 80 00 00 	movabs $0x800c63,%rax
+  800f32:	00 00 00 
+  800f35:	ff d0                	call   *%rax
+  800f37:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f3a:	48 39 c3             	cmp    %rax,%rbx
+  800f3d:	74 36                	je     800f75 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800f3f:	48 89 d8             	mov    %rbx,%rax
+  800f42:	4c 29 e8             	sub    %r13,%rax
+  800f45:	49 39 c4             	cmp    %rax,%r12
+  800f48:	73 31                	jae    800f7b <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800f4a:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800f4f:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f53:	4c 89 fe             	mov    %r15,%rsi
+  800f56:	48 b8 e7 0e 80 00 00 	movabs $0x800ee7,%rax
+  800f5d:	00 00 00 
+  800f60:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800f62:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800f66:	48 83 c4 08          	add    $0x8,%rsp
+  800f6a:	5b                   	pop    %rbx
+  800f6b:	41 5c                	pop    %r12
+  800f6d:	41 5d                	pop    %r13
+  800f6f:	41 5e                	pop    %r14
+  800f71:	41 5f                	pop    %r15
+  800f73:	5d                   	pop    %rbp
+  800f74:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f75:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800f79:	eb eb                	jmp    800f66 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800f7b:	48 83 eb 01          	sub    $0x1,%rbx
+  800f7f:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f83:	48 89 da             	mov    %rbx,%rdx
+  800f86:	4c 89 fe             	mov    %r15,%rsi
+  800f89:	48 b8 e7 0e 80 00 00 	movabs $0x800ee7,%rax
+  800f90:	00 00 00 
+  800f93:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800f95:	49 01 de             	add    %rbx,%r14
+  800f98:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800f9d:	eb c3                	jmp    800f62 <strlcat+0x69>
+
+0000000000800f9f <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800f9f:	48 85 d2             	test   %rdx,%rdx
+  800fa2:	74 2d                	je     800fd1 <memcmp+0x32>
+  800fa4:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800fa9:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800fad:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800fb2:	44 38 c1             	cmp    %r8b,%cl
+  800fb5:	75 0f                	jne    800fc6 <memcmp+0x27>
+    while (n-- > 0) {
+  800fb7:	48 83 c0 01          	add    $0x1,%rax
+  800fbb:	48 39 c2             	cmp    %rax,%rdx
+  800fbe:	75 e9                	jne    800fa9 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800fc0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fc5:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800fc6:	0f b6 c1             	movzbl %cl,%eax
+  800fc9:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800fcd:	44 29 c0             	sub    %r8d,%eax
+  800fd0:	c3                   	ret
+    return 0;
+  800fd1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fd6:	c3                   	ret
+
+0000000000800fd7 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800fd7:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800fdb:	48 39 c7             	cmp    %rax,%rdi
+  800fde:	73 0f                	jae    800fef <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800fe0:	40 38 37             	cmp    %sil,(%rdi)
+  800fe3:	74 0e                	je     800ff3 <memfind+0x1c>
+    for (; src < end; src++) {
+  800fe5:	48 83 c7 01          	add    $0x1,%rdi
+  800fe9:	48 39 f8             	cmp    %rdi,%rax
+  800fec:	75 f2                	jne    800fe0 <memfind+0x9>
+  800fee:	c3                   	ret
+  800fef:	48 89 f8             	mov    %rdi,%rax
+  800ff2:	c3                   	ret
+  800ff3:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800ff6:	c3                   	ret
+
+0000000000800ff7 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800ff7:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800ffa:	0f b6 37             	movzbl (%rdi),%esi
+  800ffd:	40 80 fe 20          	cmp    $0x20,%sil
+  801001:	74 06                	je     801009 <strtol+0x12>
+  801003:	40 80 fe 09          	cmp    $0x9,%sil
+  801007:	75 13                	jne    80101c <strtol+0x25>
+  801009:	48 83 c7 01          	add    $0x1,%rdi
+  80100d:	0f b6 37             	movzbl (%rdi),%esi
+  801010:	40 80 fe 20          	cmp    $0x20,%sil
+  801014:	74 f3                	je     801009 <strtol+0x12>
+  801016:	40 80 fe 09          	cmp    $0x9,%sil
+  80101a:	74 ed                	je     801009 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80101c:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80101f:	83 e0 fd             	and    $0xfffffffd,%eax
+  801022:	3c 01                	cmp    $0x1,%al
+  801024:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801028:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80102e:	75 0f                	jne    80103f <strtol+0x48>
+  801030:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801033:	74 14                	je     801049 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801035:	85 d2                	test   %edx,%edx
+  801037:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80103c:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80103f:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801044:	4c 63 ca             	movslq %edx,%r9
+  801047:	eb 36                	jmp    80107f <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801049:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80104d:	74 0f                	je     80105e <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80104f:	85 d2                	test   %edx,%edx
+  801051:	75 ec                	jne    80103f <strtol+0x48>
+        s++;
+  801053:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801057:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80105c:	eb e1                	jmp    80103f <strtol+0x48>
+        s += 2;
+  80105e:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801062:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801067:	eb d6                	jmp    80103f <strtol+0x48>
+            dig -= '0';
+  801069:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80106c:	44 0f b6 c1          	movzbl %cl,%r8d
+  801070:	41 39 d0             	cmp    %edx,%r8d
+  801073:	7d 21                	jge    801096 <strtol+0x9f>
+        val = val * base + dig;
+  801075:	49 0f af c1          	imul   %r9,%rax
+  801079:	0f b6 c9             	movzbl %cl,%ecx
+  80107c:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80107f:	48 83 c7 01          	add    $0x1,%rdi
+  801083:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801087:	80 f9 39             	cmp    $0x39,%cl
+  80108a:	76 dd                	jbe    801069 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80108c:	80 f9 7b             	cmp    $0x7b,%cl
+  80108f:	77 05                	ja     801096 <strtol+0x9f>
+            dig -= 'a' - 10;
+  801091:	83 e9 57             	sub    $0x57,%ecx
+  801094:	eb d6                	jmp    80106c <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801096:	4d 85 d2             	test   %r10,%r10
+  801099:	74 03                	je     80109e <strtol+0xa7>
+  80109b:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80109e:	48 89 c2             	mov    %rax,%rdx
+  8010a1:	48 f7 da             	neg    %rdx
+  8010a4:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8010a8:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8010ac:	c3                   	ret
+
+00000000008010ad <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  8010ad:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8010b2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010b7:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8010bd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8010c3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  8010c9:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8010cb:	c3                   	ret
+
+00000000008010cc <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  8010cc:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8010d1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010d6:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8010db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010e0:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8010e6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8010ec:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8010f2:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8010f4:	c3                   	ret
+
+00000000008010f5 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8010f5:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8010f8:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8010fd:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801102:	ba 00 00 00 00       	mov    $0x0,%edx
+  801107:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80110d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801113:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801119:	0f 05                	syscall
+    if (check && ret > 0) {
+  80111b:	48 85 c0             	test   %rax,%rax
+  80111e:	7f 01                	jg     801121 <sys_env_destroy+0x2c>
+}
+  801120:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  801121:	55                   	push   %rbp
+  801122:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801125:	49 89 c0             	mov    %rax,%r8
+  801128:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80112d:	48 ba b8 4d 80 00 00 	movabs $0x804db8,%rdx
+  801134:	00 00 00 
+  801137:	be 29 00 00 00       	mov    $0x29,%esi
+  80113c:	48 bf d7 4d 80 00 00 	movabs $0x804dd7,%rdi
+  801143:	00 00 00 
+  801146:	b8 00 00 00 00       	mov    $0x0,%eax
+  80114b:	49 b9 11 02 80 00 00 	movabs $0x800211,%r9
+  801152:	00 00 00 
+  801155:	41 ff d1             	call   *%r9
+
+0000000000801158 <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  801158:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80115d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801162:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801167:	ba 00 00 00 00       	mov    $0x0,%edx
+  80116c:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801172:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801178:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80117e:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801180:	c3                   	ret
+
+0000000000801181 <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  801181:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801186:	bf 00 00 00 00       	mov    $0x0,%edi
+  80118b:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801190:	ba 00 00 00 00       	mov    $0x0,%edx
+  801195:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80119b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011a1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8011a7:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8011a9:	c3                   	ret
+
+00000000008011aa <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  8011aa:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8011af:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  8011b6:	00 00 00 
+  8011b9:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8011bf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011c5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8011cb:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8011cd:	c3                   	ret
+
+00000000008011ce <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8011ce:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  8011d1:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8011d6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011dc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8011e2:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8011e4:	c3                   	ret
+
+00000000008011e5 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8011e5:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8011e8:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8011ed:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8011f0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011f6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8011fc:	0f 05                	syscall
+    if (check && ret > 0) {
+  8011fe:	48 85 c0             	test   %rax,%rax
+  801201:	7f 01                	jg     801204 <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801203:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801204:	55                   	push   %rbp
+  801205:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801208:	49 89 c0             	mov    %rax,%r8
+  80120b:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801210:	48 ba b8 4d 80 00 00 	movabs $0x804db8,%rdx
+  801217:	00 00 00 
+  80121a:	be 29 00 00 00       	mov    $0x29,%esi
+  80121f:	48 bf d7 4d 80 00 00 	movabs $0x804dd7,%rdi
+  801226:	00 00 00 
+  801229:	b8 00 00 00 00       	mov    $0x0,%eax
+  80122e:	49 b9 11 02 80 00 00 	movabs $0x800211,%r9
+  801235:	00 00 00 
+  801238:	41 ff d1             	call   *%r9
+
+000000000080123b <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80123b:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80123e:	48 63 d2             	movslq %edx,%rdx
+  801241:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801244:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801249:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  80124c:	0f 05                	syscall
+    if (check && ret > 0) {
+  80124e:	48 85 c0             	test   %rax,%rax
+  801251:	7f 01                	jg     801254 <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801253:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801254:	55                   	push   %rbp
+  801255:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801258:	49 89 c0             	mov    %rax,%r8
+  80125b:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801260:	48 ba b8 4d 80 00 00 	movabs $0x804db8,%rdx
+  801267:	00 00 00 
+  80126a:	be 29 00 00 00       	mov    $0x29,%esi
+  80126f:	48 bf d7 4d 80 00 00 	movabs $0x804dd7,%rdi
+  801276:	00 00 00 
+  801279:	b8 00 00 00 00       	mov    $0x0,%eax
+  80127e:	49 b9 11 02 80 00 00 	movabs $0x800211,%r9
+  801285:	00 00 00 
+  801288:	41 ff d1             	call   *%r9
+
+000000000080128b <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80128b:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80128e:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801293:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801299:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80129f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8012a5:	0f 05                	syscall
+    if (check && ret > 0) {
+  8012a7:	48 85 c0             	test   %rax,%rax
+  8012aa:	7f 01                	jg     8012ad <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8012ac:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8012ad:	55                   	push   %rbp
+  8012ae:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012b1:	49 89 c0             	mov    %rax,%r8
+  8012b4:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8012b9:	48 ba b8 4d 80 00 00 	movabs $0x804db8,%rdx
+  8012c0:	00 00 00 
+  8012c3:	be 29 00 00 00       	mov    $0x29,%esi
+  8012c8:	48 bf d7 4d 80 00 00 	movabs $0x804dd7,%rdi
+  8012cf:	00 00 00 
+  8012d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012d7:	49 b9 11 02 80 00 00 	movabs $0x800211,%r9
+  8012de:	00 00 00 
+  8012e1:	41 ff d1             	call   *%r9
+
+00000000008012e4 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8012e4:	48 63 f6             	movslq %esi,%rsi
+  8012e7:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8012ea:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8012ef:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012f4:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8012fa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801300:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801306:	0f 05                	syscall
+    if (check && ret > 0) {
+  801308:	48 85 c0             	test   %rax,%rax
+  80130b:	7f 01                	jg     80130e <sys_env_set_status+0x2a>
+}
+  80130d:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  80130e:	55                   	push   %rbp
+  80130f:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801312:	49 89 c0             	mov    %rax,%r8
+  801315:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80131a:	48 ba b8 4d 80 00 00 	movabs $0x804db8,%rdx
+  801321:	00 00 00 
+  801324:	be 29 00 00 00       	mov    $0x29,%esi
+  801329:	48 bf d7 4d 80 00 00 	movabs $0x804dd7,%rdi
+  801330:	00 00 00 
+  801333:	b8 00 00 00 00       	mov    $0x0,%eax
+  801338:	49 b9 11 02 80 00 00 	movabs $0x800211,%r9
+  80133f:	00 00 00 
+  801342:	41 ff d1             	call   *%r9
+
+0000000000801345 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801345:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801348:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80134d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801352:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801358:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80135e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801364:	0f 05                	syscall
+    if (check && ret > 0) {
+  801366:	48 85 c0             	test   %rax,%rax
+  801369:	7f 01                	jg     80136c <sys_env_set_trapframe+0x27>
+}
+  80136b:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80136c:	55                   	push   %rbp
+  80136d:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801370:	49 89 c0             	mov    %rax,%r8
+  801373:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801378:	48 ba b8 4d 80 00 00 	movabs $0x804db8,%rdx
+  80137f:	00 00 00 
+  801382:	be 29 00 00 00       	mov    $0x29,%esi
+  801387:	48 bf d7 4d 80 00 00 	movabs $0x804dd7,%rdi
+  80138e:	00 00 00 
+  801391:	b8 00 00 00 00       	mov    $0x0,%eax
+  801396:	49 b9 11 02 80 00 00 	movabs $0x800211,%r9
+  80139d:	00 00 00 
+  8013a0:	41 ff d1             	call   *%r9
+
+00000000008013a3 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8013a3:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8013a6:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8013ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013b0:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013b6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013bc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013c2:	0f 05                	syscall
+    if (check && ret > 0) {
+  8013c4:	48 85 c0             	test   %rax,%rax
+  8013c7:	7f 01                	jg     8013ca <sys_env_set_pgfault_upcall+0x27>
+}
+  8013c9:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8013ca:	55                   	push   %rbp
+  8013cb:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013ce:	49 89 c0             	mov    %rax,%r8
+  8013d1:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8013d6:	48 ba b8 4d 80 00 00 	movabs $0x804db8,%rdx
+  8013dd:	00 00 00 
+  8013e0:	be 29 00 00 00       	mov    $0x29,%esi
+  8013e5:	48 bf d7 4d 80 00 00 	movabs $0x804dd7,%rdi
+  8013ec:	00 00 00 
+  8013ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013f4:	49 b9 11 02 80 00 00 	movabs $0x800211,%r9
+  8013fb:	00 00 00 
+  8013fe:	41 ff d1             	call   *%r9
+
+0000000000801401 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801401:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801404:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801407:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80140c:	4d 63 c0             	movslq %r8d,%r8
+  80140f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801415:	0f 05                	syscall
+}
+  801417:	c3                   	ret
+
+0000000000801418 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801418:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80141b:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80141e:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801423:	4d 63 c0             	movslq %r8d,%r8
+  801426:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80142c:	0f 05                	syscall
+}
+  80142e:	c3                   	ret
+
+000000000080142f <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  80142f:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801434:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801437:	45 89 c0             	mov    %r8d,%r8d
+  80143a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801440:	0f 05                	syscall
+    if (check && ret > 0) {
+  801442:	48 85 c0             	test   %rax,%rax
+  801445:	7f 01                	jg     801448 <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801447:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  801448:	55                   	push   %rbp
+  801449:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80144c:	49 89 c0             	mov    %rax,%r8
+  80144f:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801454:	48 ba b8 4d 80 00 00 	movabs $0x804db8,%rdx
+  80145b:	00 00 00 
+  80145e:	be 29 00 00 00       	mov    $0x29,%esi
+  801463:	48 bf d7 4d 80 00 00 	movabs $0x804dd7,%rdi
+  80146a:	00 00 00 
+  80146d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801472:	49 b9 11 02 80 00 00 	movabs $0x800211,%r9
+  801479:	00 00 00 
+  80147c:	41 ff d1             	call   *%r9
+
+000000000080147f <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  80147f:	55                   	push   %rbp
+  801480:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  801483:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801489:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80148e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801493:	48 b8 2f 14 80 00 00 	movabs $0x80142f,%rax
+  80149a:	00 00 00 
+  80149d:	ff d0                	call   *%rax
+}
+  80149f:	5d                   	pop    %rbp
+  8014a0:	c3                   	ret
+
+00000000008014a1 <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  8014a1:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8014a6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014ab:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8014b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014b5:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014bb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014c1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8014c7:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8014c9:	c3                   	ret
+
+00000000008014ca <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  8014ca:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8014cf:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8014d4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014d9:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014df:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014e5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8014eb:	0f 05                	syscall
+    if (check && ret > 0) {
+  8014ed:	48 85 c0             	test   %rax,%rax
+  8014f0:	7f 01                	jg     8014f3 <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  8014f2:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  8014f3:	55                   	push   %rbp
+  8014f4:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014f7:	49 89 c0             	mov    %rax,%r8
+  8014fa:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8014ff:	48 ba b8 4d 80 00 00 	movabs $0x804db8,%rdx
+  801506:	00 00 00 
+  801509:	be 29 00 00 00       	mov    $0x29,%esi
+  80150e:	48 bf d7 4d 80 00 00 	movabs $0x804dd7,%rdi
+  801515:	00 00 00 
+  801518:	b8 00 00 00 00       	mov    $0x0,%eax
+  80151d:	49 b9 11 02 80 00 00 	movabs $0x800211,%r9
+  801524:	00 00 00 
+  801527:	41 ff d1             	call   *%r9
+
+000000000080152a <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  80152a:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80152f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801534:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801539:	ba 00 00 00 00       	mov    $0x0,%edx
+  80153e:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801544:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80154a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801550:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  801552:	c3                   	ret
+
+0000000000801553 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  801553:	89 d2                	mov    %edx,%edx
+  801555:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  801557:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80155c:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801562:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801568:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80156e:	0f 05                	syscall
+}
+  801570:	c3                   	ret
+
+0000000000801571 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  801571:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  801574:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801579:	ba 00 00 00 00       	mov    $0x0,%edx
+  80157e:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801584:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80158a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801590:	0f 05                	syscall
+}
+  801592:	c3                   	ret
+
+0000000000801593 <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  801593:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  801596:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80159b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015a0:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8015a6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8015ac:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8015b2:	0f 05                	syscall
+}
+  8015b4:	c3                   	ret
+
+00000000008015b5 <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  8015b5:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8015b8:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8015bd:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8015c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015c7:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8015cd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8015d3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8015d9:	0f 05                	syscall
+    if (check && ret > 0) {
+  8015db:	48 85 c0             	test   %rax,%rax
+  8015de:	7f 01                	jg     8015e1 <sys_irq_ack+0x2c>
+}
+  8015e0:	c3                   	ret
+sys_irq_ack(int irq) {
+  8015e1:	55                   	push   %rbp
+  8015e2:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015e5:	49 89 c0             	mov    %rax,%r8
+  8015e8:	b9 16 00 00 00       	mov    $0x16,%ecx
+  8015ed:	48 ba b8 4d 80 00 00 	movabs $0x804db8,%rdx
+  8015f4:	00 00 00 
+  8015f7:	be 29 00 00 00       	mov    $0x29,%esi
+  8015fc:	48 bf d7 4d 80 00 00 	movabs $0x804dd7,%rdi
+  801603:	00 00 00 
+  801606:	b8 00 00 00 00       	mov    $0x0,%eax
+  80160b:	49 b9 11 02 80 00 00 	movabs $0x800211,%r9
+  801612:	00 00 00 
+  801615:	41 ff d1             	call   *%r9
+
+0000000000801618 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801618:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80161f:	ff ff ff 
+  801622:	48 01 f8             	add    %rdi,%rax
+  801625:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801629:	c3                   	ret
+
+000000000080162a <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80162a:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801631:	ff ff ff 
+  801634:	48 01 f8             	add    %rdi,%rax
+  801637:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80163b:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801641:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801645:	c3                   	ret
+
+0000000000801646 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801646:	55                   	push   %rbp
+  801647:	48 89 e5             	mov    %rsp,%rbp
+  80164a:	41 57                	push   %r15
+  80164c:	41 56                	push   %r14
+  80164e:	41 55                	push   %r13
+  801650:	41 54                	push   %r12
+  801652:	53                   	push   %rbx
+  801653:	48 83 ec 08          	sub    $0x8,%rsp
+  801657:	49 89 ff             	mov    %rdi,%r15
+  80165a:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  80165f:	49 bd d5 3d 80 00 00 	movabs $0x803dd5,%r13
+  801666:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801669:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  80166f:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801672:	48 89 df             	mov    %rbx,%rdi
+  801675:	41 ff d5             	call   *%r13
+  801678:	83 e0 04             	and    $0x4,%eax
+  80167b:	74 17                	je     801694 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  80167d:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801684:	4c 39 f3             	cmp    %r14,%rbx
+  801687:	75 e6                	jne    80166f <fd_alloc+0x29>
+  801689:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  80168f:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801694:	4d 89 27             	mov    %r12,(%r15)
+}
+  801697:	48 83 c4 08          	add    $0x8,%rsp
+  80169b:	5b                   	pop    %rbx
+  80169c:	41 5c                	pop    %r12
+  80169e:	41 5d                	pop    %r13
+  8016a0:	41 5e                	pop    %r14
+  8016a2:	41 5f                	pop    %r15
+  8016a4:	5d                   	pop    %rbp
+  8016a5:	c3                   	ret
+
+00000000008016a6 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8016a6:	83 ff 1f             	cmp    $0x1f,%edi
+  8016a9:	77 39                	ja     8016e4 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8016ab:	55                   	push   %rbp
+  8016ac:	48 89 e5             	mov    %rsp,%rbp
+  8016af:	41 54                	push   %r12
+  8016b1:	53                   	push   %rbx
+  8016b2:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8016b5:	48 63 df             	movslq %edi,%rbx
+  8016b8:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8016bf:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8016c3:	48 89 df             	mov    %rbx,%rdi
+  8016c6:	48 b8 d5 3d 80 00 00 	movabs $0x803dd5,%rax
+  8016cd:	00 00 00 
+  8016d0:	ff d0                	call   *%rax
+  8016d2:	a8 04                	test   $0x4,%al
+  8016d4:	74 14                	je     8016ea <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8016d6:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8016da:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8016df:	5b                   	pop    %rbx
+  8016e0:	41 5c                	pop    %r12
+  8016e2:	5d                   	pop    %rbp
+  8016e3:	c3                   	ret
+        return -E_INVAL;
+  8016e4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8016e9:	c3                   	ret
+        return -E_INVAL;
+  8016ea:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016ef:	eb ee                	jmp    8016df <fd_lookup+0x39>
+
+00000000008016f1 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8016f1:	55                   	push   %rbp
+  8016f2:	48 89 e5             	mov    %rsp,%rbp
+  8016f5:	41 54                	push   %r12
+  8016f7:	53                   	push   %rbx
+  8016f8:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8016fb:	48 b8 80 4e 80 00 00 	movabs $0x804e80,%rax
+  801702:	00 00 00 
+  801705:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  80170c:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  80170f:	39 3b                	cmp    %edi,(%rbx)
+  801711:	74 47                	je     80175a <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801713:	48 83 c0 08          	add    $0x8,%rax
+  801717:	48 8b 18             	mov    (%rax),%rbx
+  80171a:	48 85 db             	test   %rbx,%rbx
+  80171d:	75 f0                	jne    80170f <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80171f:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801726:	00 00 00 
+  801729:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80172f:	89 fa                	mov    %edi,%edx
+  801731:	48 bf e8 4d 80 00 00 	movabs $0x804de8,%rdi
+  801738:	00 00 00 
+  80173b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801740:	48 b9 61 03 80 00 00 	movabs $0x800361,%rcx
+  801747:	00 00 00 
+  80174a:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80174c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801751:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801755:	5b                   	pop    %rbx
+  801756:	41 5c                	pop    %r12
+  801758:	5d                   	pop    %rbp
+  801759:	c3                   	ret
+            return 0;
+  80175a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80175f:	eb f0                	jmp    801751 <dev_lookup+0x60>
+
+0000000000801761 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801761:	55                   	push   %rbp
+  801762:	48 89 e5             	mov    %rsp,%rbp
+  801765:	41 55                	push   %r13
+  801767:	41 54                	push   %r12
+  801769:	53                   	push   %rbx
+  80176a:	48 83 ec 18          	sub    $0x18,%rsp
+  80176e:	48 89 fb             	mov    %rdi,%rbx
+  801771:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801774:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80177b:	ff ff ff 
+  80177e:	48 01 df             	add    %rbx,%rdi
+  801781:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801785:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801789:	48 b8 a6 16 80 00 00 	movabs $0x8016a6,%rax
+  801790:	00 00 00 
+  801793:	ff d0                	call   *%rax
+  801795:	41 89 c5             	mov    %eax,%r13d
+  801798:	85 c0                	test   %eax,%eax
+  80179a:	78 06                	js     8017a2 <fd_close+0x41>
+  80179c:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8017a0:	74 1a                	je     8017bc <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8017a2:	45 84 e4             	test   %r12b,%r12b
+  8017a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017aa:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8017ae:	44 89 e8             	mov    %r13d,%eax
+  8017b1:	48 83 c4 18          	add    $0x18,%rsp
+  8017b5:	5b                   	pop    %rbx
+  8017b6:	41 5c                	pop    %r12
+  8017b8:	41 5d                	pop    %r13
+  8017ba:	5d                   	pop    %rbp
+  8017bb:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8017bc:	8b 3b                	mov    (%rbx),%edi
+  8017be:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8017c2:	48 b8 f1 16 80 00 00 	movabs $0x8016f1,%rax
+  8017c9:	00 00 00 
+  8017cc:	ff d0                	call   *%rax
+  8017ce:	41 89 c5             	mov    %eax,%r13d
+  8017d1:	85 c0                	test   %eax,%eax
+  8017d3:	78 1b                	js     8017f0 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8017d5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8017d9:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8017dd:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8017e3:	48 85 c0             	test   %rax,%rax
+  8017e6:	74 08                	je     8017f0 <fd_close+0x8f>
+  8017e8:	48 89 df             	mov    %rbx,%rdi
+  8017eb:	ff d0                	call   *%rax
+  8017ed:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8017f0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8017f5:	48 89 de             	mov    %rbx,%rsi
+  8017f8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8017fd:	48 b8 8b 12 80 00 00 	movabs $0x80128b,%rax
+  801804:	00 00 00 
+  801807:	ff d0                	call   *%rax
+    return res;
+  801809:	eb a3                	jmp    8017ae <fd_close+0x4d>
+
+000000000080180b <close>:
+
+int
+close(int fdnum) {
+  80180b:	55                   	push   %rbp
+  80180c:	48 89 e5             	mov    %rsp,%rbp
+  80180f:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801813:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801817:	48 b8 a6 16 80 00 00 	movabs $0x8016a6,%rax
+  80181e:	00 00 00 
+  801821:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801823:	85 c0                	test   %eax,%eax
+  801825:	78 15                	js     80183c <close+0x31>
+
+    return fd_close(fd, 1);
+  801827:	be 01 00 00 00       	mov    $0x1,%esi
+  80182c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801830:	48 b8 61 17 80 00 00 	movabs $0x801761,%rax
+  801837:	00 00 00 
+  80183a:	ff d0                	call   *%rax
+}
+  80183c:	c9                   	leave
+  80183d:	c3                   	ret
+
+000000000080183e <close_all>:
+
+void
+close_all(void) {
+  80183e:	55                   	push   %rbp
+  80183f:	48 89 e5             	mov    %rsp,%rbp
+  801842:	41 54                	push   %r12
+  801844:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801845:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80184a:	49 bc 0b 18 80 00 00 	movabs $0x80180b,%r12
+  801851:	00 00 00 
+  801854:	89 df                	mov    %ebx,%edi
+  801856:	41 ff d4             	call   *%r12
+  801859:	83 c3 01             	add    $0x1,%ebx
+  80185c:	83 fb 20             	cmp    $0x20,%ebx
+  80185f:	75 f3                	jne    801854 <close_all+0x16>
+}
+  801861:	5b                   	pop    %rbx
+  801862:	41 5c                	pop    %r12
+  801864:	5d                   	pop    %rbp
+  801865:	c3                   	ret
+
+0000000000801866 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801866:	55                   	push   %rbp
+  801867:	48 89 e5             	mov    %rsp,%rbp
+  80186a:	41 57                	push   %r15
+  80186c:	41 56                	push   %r14
+  80186e:	41 55                	push   %r13
+  801870:	41 54                	push   %r12
+  801872:	53                   	push   %rbx
+  801873:	48 83 ec 18          	sub    $0x18,%rsp
+  801877:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  80187a:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80187e:	48 b8 a6 16 80 00 00 	movabs $0x8016a6,%rax
+  801885:	00 00 00 
+  801888:	ff d0                	call   *%rax
+  80188a:	89 c3                	mov    %eax,%ebx
+  80188c:	85 c0                	test   %eax,%eax
+  80188e:	0f 88 b8 00 00 00    	js     80194c <dup+0xe6>
+    close(newfdnum);
+  801894:	44 89 e7             	mov    %r12d,%edi
+  801897:	48 b8 0b 18 80 00 00 	movabs $0x80180b,%rax
+  80189e:	00 00 00 
+  8018a1:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8018a3:	4d 63 ec             	movslq %r12d,%r13
+  8018a6:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8018ad:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8018b1:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8018b5:	4c 89 ff             	mov    %r15,%rdi
+  8018b8:	49 be 2a 16 80 00 00 	movabs $0x80162a,%r14
+  8018bf:	00 00 00 
+  8018c2:	41 ff d6             	call   *%r14
+  8018c5:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8018c8:	4c 89 ef             	mov    %r13,%rdi
+  8018cb:	41 ff d6             	call   *%r14
+  8018ce:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8018d1:	48 89 df             	mov    %rbx,%rdi
+  8018d4:	48 b8 d5 3d 80 00 00 	movabs $0x803dd5,%rax
+  8018db:	00 00 00 
+  8018de:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8018e0:	a8 04                	test   $0x4,%al
+  8018e2:	74 2b                	je     80190f <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8018e4:	41 89 c1             	mov    %eax,%r9d
+  8018e7:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8018ed:	4c 89 f1             	mov    %r14,%rcx
+  8018f0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018f5:	48 89 de             	mov    %rbx,%rsi
+  8018f8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018fd:	48 b8 3b 12 80 00 00 	movabs $0x80123b,%rax
+  801904:	00 00 00 
+  801907:	ff d0                	call   *%rax
+  801909:	89 c3                	mov    %eax,%ebx
+  80190b:	85 c0                	test   %eax,%eax
+  80190d:	78 4e                	js     80195d <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  80190f:	4c 89 ff             	mov    %r15,%rdi
+  801912:	48 b8 d5 3d 80 00 00 	movabs $0x803dd5,%rax
+  801919:	00 00 00 
+  80191c:	ff d0                	call   *%rax
+  80191e:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801921:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801927:	4c 89 e9             	mov    %r13,%rcx
+  80192a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80192f:	4c 89 fe             	mov    %r15,%rsi
+  801932:	bf 00 00 00 00       	mov    $0x0,%edi
+  801937:	48 b8 3b 12 80 00 00 	movabs $0x80123b,%rax
+  80193e:	00 00 00 
+  801941:	ff d0                	call   *%rax
+  801943:	89 c3                	mov    %eax,%ebx
+  801945:	85 c0                	test   %eax,%eax
+  801947:	78 14                	js     80195d <dup+0xf7>
+
+    return newfdnum;
+  801949:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  80194c:	89 d8                	mov    %ebx,%eax
+  80194e:	48 83 c4 18          	add    $0x18,%rsp
+  801952:	5b                   	pop    %rbx
+  801953:	41 5c                	pop    %r12
+  801955:	41 5d                	pop    %r13
+  801957:	41 5e                	pop    %r14
+  801959:	41 5f                	pop    %r15
+  80195b:	5d                   	pop    %rbp
+  80195c:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  80195d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801962:	4c 89 ee             	mov    %r13,%rsi
+  801965:	bf 00 00 00 00       	mov    $0x0,%edi
+  80196a:	49 bc 8b 12 80 00 00 	movabs $0x80128b,%r12
+  801971:	00 00 00 
+  801974:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801977:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80197c:	4c 89 f6             	mov    %r14,%rsi
+  80197f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801984:	41 ff d4             	call   *%r12
+    return res;
+  801987:	eb c3                	jmp    80194c <dup+0xe6>
+
+0000000000801989 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801989:	55                   	push   %rbp
+  80198a:	48 89 e5             	mov    %rsp,%rbp
+  80198d:	41 56                	push   %r14
+  80198f:	41 55                	push   %r13
+  801991:	41 54                	push   %r12
+  801993:	53                   	push   %rbx
+  801994:	48 83 ec 10          	sub    $0x10,%rsp
+  801998:	89 fb                	mov    %edi,%ebx
+  80199a:	49 89 f4             	mov    %rsi,%r12
+  80199d:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8019a0:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8019a4:	48 b8 a6 16 80 00 00 	movabs $0x8016a6,%rax
+  8019ab:	00 00 00 
+  8019ae:	ff d0                	call   *%rax
+  8019b0:	85 c0                	test   %eax,%eax
+  8019b2:	78 4c                	js     801a00 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8019b4:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8019b8:	41 8b 3e             	mov    (%r14),%edi
+  8019bb:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8019bf:	48 b8 f1 16 80 00 00 	movabs $0x8016f1,%rax
+  8019c6:	00 00 00 
+  8019c9:	ff d0                	call   *%rax
+  8019cb:	85 c0                	test   %eax,%eax
+  8019cd:	78 35                	js     801a04 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8019cf:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8019d3:	83 e0 03             	and    $0x3,%eax
+  8019d6:	83 f8 01             	cmp    $0x1,%eax
+  8019d9:	74 2d                	je     801a08 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8019db:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8019df:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8019e3:	48 85 c0             	test   %rax,%rax
+  8019e6:	74 56                	je     801a3e <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8019e8:	4c 89 ea             	mov    %r13,%rdx
+  8019eb:	4c 89 e6             	mov    %r12,%rsi
+  8019ee:	4c 89 f7             	mov    %r14,%rdi
+  8019f1:	ff d0                	call   *%rax
+}
+  8019f3:	48 83 c4 10          	add    $0x10,%rsp
+  8019f7:	5b                   	pop    %rbx
+  8019f8:	41 5c                	pop    %r12
+  8019fa:	41 5d                	pop    %r13
+  8019fc:	41 5e                	pop    %r14
+  8019fe:	5d                   	pop    %rbp
+  8019ff:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a00:	48 98                	cltq
+  801a02:	eb ef                	jmp    8019f3 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801a04:	48 98                	cltq
+  801a06:	eb eb                	jmp    8019f3 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801a08:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801a0f:	00 00 00 
+  801a12:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801a18:	89 da                	mov    %ebx,%edx
+  801a1a:	48 bf 29 4e 80 00 00 	movabs $0x804e29,%rdi
+  801a21:	00 00 00 
+  801a24:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a29:	48 b9 61 03 80 00 00 	movabs $0x800361,%rcx
+  801a30:	00 00 00 
+  801a33:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801a35:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801a3c:	eb b5                	jmp    8019f3 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801a3e:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801a45:	eb ac                	jmp    8019f3 <read+0x6a>
+
+0000000000801a47 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801a47:	55                   	push   %rbp
+  801a48:	48 89 e5             	mov    %rsp,%rbp
+  801a4b:	41 57                	push   %r15
+  801a4d:	41 56                	push   %r14
+  801a4f:	41 55                	push   %r13
+  801a51:	41 54                	push   %r12
+  801a53:	53                   	push   %rbx
+  801a54:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801a58:	48 85 d2             	test   %rdx,%rdx
+  801a5b:	74 54                	je     801ab1 <readn+0x6a>
+  801a5d:	41 89 fd             	mov    %edi,%r13d
+  801a60:	49 89 f6             	mov    %rsi,%r14
+  801a63:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801a66:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801a6b:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801a70:	49 bf 89 19 80 00 00 	movabs $0x801989,%r15
+  801a77:	00 00 00 
+  801a7a:	4c 89 e2             	mov    %r12,%rdx
+  801a7d:	48 29 f2             	sub    %rsi,%rdx
+  801a80:	4c 01 f6             	add    %r14,%rsi
+  801a83:	44 89 ef             	mov    %r13d,%edi
+  801a86:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801a89:	85 c0                	test   %eax,%eax
+  801a8b:	78 20                	js     801aad <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801a8d:	01 c3                	add    %eax,%ebx
+  801a8f:	85 c0                	test   %eax,%eax
+  801a91:	74 08                	je     801a9b <readn+0x54>
+  801a93:	48 63 f3             	movslq %ebx,%rsi
+  801a96:	4c 39 e6             	cmp    %r12,%rsi
+  801a99:	72 df                	jb     801a7a <readn+0x33>
+    }
+    return res;
+  801a9b:	48 63 c3             	movslq %ebx,%rax
+}
+  801a9e:	48 83 c4 08          	add    $0x8,%rsp
+  801aa2:	5b                   	pop    %rbx
+  801aa3:	41 5c                	pop    %r12
+  801aa5:	41 5d                	pop    %r13
+  801aa7:	41 5e                	pop    %r14
+  801aa9:	41 5f                	pop    %r15
+  801aab:	5d                   	pop    %rbp
+  801aac:	c3                   	ret
+        if (inc < 0) return inc;
+  801aad:	48 98                	cltq
+  801aaf:	eb ed                	jmp    801a9e <readn+0x57>
+    int inc = 1, res = 0;
+  801ab1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ab6:	eb e3                	jmp    801a9b <readn+0x54>
+
+0000000000801ab8 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801ab8:	55                   	push   %rbp
+  801ab9:	48 89 e5             	mov    %rsp,%rbp
+  801abc:	41 56                	push   %r14
+  801abe:	41 55                	push   %r13
+  801ac0:	41 54                	push   %r12
+  801ac2:	53                   	push   %rbx
+  801ac3:	48 83 ec 10          	sub    $0x10,%rsp
+  801ac7:	89 fb                	mov    %edi,%ebx
+  801ac9:	49 89 f4             	mov    %rsi,%r12
+  801acc:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801acf:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ad3:	48 b8 a6 16 80 00 00 	movabs $0x8016a6,%rax
+  801ada:	00 00 00 
+  801add:	ff d0                	call   *%rax
+  801adf:	85 c0                	test   %eax,%eax
+  801ae1:	78 47                	js     801b2a <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ae3:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801ae7:	41 8b 3e             	mov    (%r14),%edi
+  801aea:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801aee:	48 b8 f1 16 80 00 00 	movabs $0x8016f1,%rax
+  801af5:	00 00 00 
+  801af8:	ff d0                	call   *%rax
+  801afa:	85 c0                	test   %eax,%eax
+  801afc:	78 30                	js     801b2e <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801afe:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801b03:	74 2d                	je     801b32 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801b05:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b09:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801b0d:	48 85 c0             	test   %rax,%rax
+  801b10:	74 56                	je     801b68 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801b12:	4c 89 ea             	mov    %r13,%rdx
+  801b15:	4c 89 e6             	mov    %r12,%rsi
+  801b18:	4c 89 f7             	mov    %r14,%rdi
+  801b1b:	ff d0                	call   *%rax
+}
+  801b1d:	48 83 c4 10          	add    $0x10,%rsp
+  801b21:	5b                   	pop    %rbx
+  801b22:	41 5c                	pop    %r12
+  801b24:	41 5d                	pop    %r13
+  801b26:	41 5e                	pop    %r14
+  801b28:	5d                   	pop    %rbp
+  801b29:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b2a:	48 98                	cltq
+  801b2c:	eb ef                	jmp    801b1d <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b2e:	48 98                	cltq
+  801b30:	eb eb                	jmp    801b1d <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b32:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801b39:	00 00 00 
+  801b3c:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801b42:	89 da                	mov    %ebx,%edx
+  801b44:	48 bf 45 4e 80 00 00 	movabs $0x804e45,%rdi
+  801b4b:	00 00 00 
+  801b4e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b53:	48 b9 61 03 80 00 00 	movabs $0x800361,%rcx
+  801b5a:	00 00 00 
+  801b5d:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801b5f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801b66:	eb b5                	jmp    801b1d <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801b68:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801b6f:	eb ac                	jmp    801b1d <write+0x65>
+
+0000000000801b71 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801b71:	55                   	push   %rbp
+  801b72:	48 89 e5             	mov    %rsp,%rbp
+  801b75:	41 54                	push   %r12
+  801b77:	53                   	push   %rbx
+  801b78:	48 83 ec 10          	sub    $0x10,%rsp
+  801b7c:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b7e:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801b82:	48 b8 a6 16 80 00 00 	movabs $0x8016a6,%rax
+  801b89:	00 00 00 
+  801b8c:	ff d0                	call   *%rax
+  801b8e:	85 c0                	test   %eax,%eax
+  801b90:	78 3e                	js     801bd0 <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b92:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801b96:	41 8b 3c 24          	mov    (%r12),%edi
+  801b9a:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801b9e:	48 b8 f1 16 80 00 00 	movabs $0x8016f1,%rax
+  801ba5:	00 00 00 
+  801ba8:	ff d0                	call   *%rax
+  801baa:	85 c0                	test   %eax,%eax
+  801bac:	78 22                	js     801bd0 <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  801bae:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801bb2:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801bb6:	48 85 c0             	test   %rax,%rax
+  801bb9:	74 0b                	je     801bc6 <seek+0x55>
+  801bbb:	89 de                	mov    %ebx,%esi
+  801bbd:	4c 89 e7             	mov    %r12,%rdi
+  801bc0:	ff d0                	call   *%rax
+  801bc2:	85 c0                	test   %eax,%eax
+  801bc4:	78 0a                	js     801bd0 <seek+0x5f>
+
+    fd->fd_offset = offset;
+  801bc6:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  801bcb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801bd0:	48 83 c4 10          	add    $0x10,%rsp
+  801bd4:	5b                   	pop    %rbx
+  801bd5:	41 5c                	pop    %r12
+  801bd7:	5d                   	pop    %rbp
+  801bd8:	c3                   	ret
+
+0000000000801bd9 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801bd9:	55                   	push   %rbp
+  801bda:	48 89 e5             	mov    %rsp,%rbp
+  801bdd:	41 55                	push   %r13
+  801bdf:	41 54                	push   %r12
+  801be1:	53                   	push   %rbx
+  801be2:	48 83 ec 18          	sub    $0x18,%rsp
+  801be6:	89 fb                	mov    %edi,%ebx
+  801be8:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801beb:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801bef:	48 b8 a6 16 80 00 00 	movabs $0x8016a6,%rax
+  801bf6:	00 00 00 
+  801bf9:	ff d0                	call   *%rax
+  801bfb:	85 c0                	test   %eax,%eax
+  801bfd:	78 38                	js     801c37 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801bff:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801c03:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801c07:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c0b:	48 b8 f1 16 80 00 00 	movabs $0x8016f1,%rax
+  801c12:	00 00 00 
+  801c15:	ff d0                	call   *%rax
+  801c17:	85 c0                	test   %eax,%eax
+  801c19:	78 1c                	js     801c37 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801c1b:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801c20:	74 20                	je     801c42 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801c22:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c26:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801c2a:	48 85 c0             	test   %rax,%rax
+  801c2d:	74 47                	je     801c76 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801c2f:	44 89 e6             	mov    %r12d,%esi
+  801c32:	4c 89 ef             	mov    %r13,%rdi
+  801c35:	ff d0                	call   *%rax
+}
+  801c37:	48 83 c4 18          	add    $0x18,%rsp
+  801c3b:	5b                   	pop    %rbx
+  801c3c:	41 5c                	pop    %r12
+  801c3e:	41 5d                	pop    %r13
+  801c40:	5d                   	pop    %rbp
+  801c41:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801c42:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801c49:	00 00 00 
+  801c4c:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801c52:	89 da                	mov    %ebx,%edx
+  801c54:	48 bf 08 4e 80 00 00 	movabs $0x804e08,%rdi
+  801c5b:	00 00 00 
+  801c5e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c63:	48 b9 61 03 80 00 00 	movabs $0x800361,%rcx
+  801c6a:	00 00 00 
+  801c6d:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801c6f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c74:	eb c1                	jmp    801c37 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801c76:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801c7b:	eb ba                	jmp    801c37 <ftruncate+0x5e>
+
+0000000000801c7d <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801c7d:	55                   	push   %rbp
+  801c7e:	48 89 e5             	mov    %rsp,%rbp
+  801c81:	41 54                	push   %r12
+  801c83:	53                   	push   %rbx
+  801c84:	48 83 ec 10          	sub    $0x10,%rsp
+  801c88:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c8b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801c8f:	48 b8 a6 16 80 00 00 	movabs $0x8016a6,%rax
+  801c96:	00 00 00 
+  801c99:	ff d0                	call   *%rax
+  801c9b:	85 c0                	test   %eax,%eax
+  801c9d:	78 4e                	js     801ced <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c9f:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801ca3:	41 8b 3c 24          	mov    (%r12),%edi
+  801ca7:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801cab:	48 b8 f1 16 80 00 00 	movabs $0x8016f1,%rax
+  801cb2:	00 00 00 
+  801cb5:	ff d0                	call   *%rax
+  801cb7:	85 c0                	test   %eax,%eax
+  801cb9:	78 32                	js     801ced <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801cbb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801cbf:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801cc4:	74 30                	je     801cf6 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801cc6:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801cc9:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801cd0:	00 00 00 
+    stat->st_isdir = 0;
+  801cd3:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801cda:	00 00 00 
+    stat->st_dev = dev;
+  801cdd:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801ce4:	48 89 de             	mov    %rbx,%rsi
+  801ce7:	4c 89 e7             	mov    %r12,%rdi
+  801cea:	ff 50 28             	call   *0x28(%rax)
+}
+  801ced:	48 83 c4 10          	add    $0x10,%rsp
+  801cf1:	5b                   	pop    %rbx
+  801cf2:	41 5c                	pop    %r12
+  801cf4:	5d                   	pop    %rbp
+  801cf5:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801cf6:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801cfb:	eb f0                	jmp    801ced <fstat+0x70>
+
+0000000000801cfd <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801cfd:	55                   	push   %rbp
+  801cfe:	48 89 e5             	mov    %rsp,%rbp
+  801d01:	41 54                	push   %r12
+  801d03:	53                   	push   %rbx
+  801d04:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801d07:	be 00 00 00 00       	mov    $0x0,%esi
+  801d0c:	48 b8 6b 2e 80 00 00 	movabs $0x802e6b,%rax
+  801d13:	00 00 00 
+  801d16:	ff d0                	call   *%rax
+  801d18:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801d1a:	85 c0                	test   %eax,%eax
+  801d1c:	78 25                	js     801d43 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801d1e:	4c 89 e6             	mov    %r12,%rsi
+  801d21:	89 c7                	mov    %eax,%edi
+  801d23:	48 b8 7d 1c 80 00 00 	movabs $0x801c7d,%rax
+  801d2a:	00 00 00 
+  801d2d:	ff d0                	call   *%rax
+  801d2f:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801d32:	89 df                	mov    %ebx,%edi
+  801d34:	48 b8 0b 18 80 00 00 	movabs $0x80180b,%rax
+  801d3b:	00 00 00 
+  801d3e:	ff d0                	call   *%rax
+
+    return res;
+  801d40:	44 89 e3             	mov    %r12d,%ebx
+}
+  801d43:	89 d8                	mov    %ebx,%eax
+  801d45:	5b                   	pop    %rbx
+  801d46:	41 5c                	pop    %r12
+  801d48:	5d                   	pop    %rbp
+  801d49:	c3                   	ret
+
+0000000000801d4a <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  801d4a:	48 b8 08 00 82 00 00 	movabs $0x820008,%rax
+  801d51:	00 00 00 
+  801d54:	83 38 00             	cmpl   $0x0,(%rax)
+  801d57:	74 0a                	je     801d63 <fsenv+0x19>
+    return envid;
+}
+  801d59:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  801d60:	00 00 
+  801d62:	c3                   	ret
+fsenv(void) {
+  801d63:	55                   	push   %rbp
+  801d64:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  801d67:	bf 03 00 00 00       	mov    $0x3,%edi
+  801d6c:	48 b8 38 47 80 00 00 	movabs $0x804738,%rax
+  801d73:	00 00 00 
+  801d76:	ff d0                	call   *%rax
+  801d78:	a3 08 00 82 00 00 00 	movabs %eax,0x820008
+  801d7f:	00 00 
+}
+  801d81:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  801d88:	00 00 
+  801d8a:	5d                   	pop    %rbp
+  801d8b:	c3                   	ret
+
+0000000000801d8c <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  801d8c:	55                   	push   %rbp
+  801d8d:	48 89 e5             	mov    %rsp,%rbp
+  801d90:	41 54                	push   %r12
+  801d92:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  801d93:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801d98:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801d9d:	48 89 de             	mov    %rbx,%rsi
+  801da0:	bf 00 00 00 00       	mov    $0x0,%edi
+  801da5:	48 b8 8b 12 80 00 00 	movabs $0x80128b,%rax
+  801dac:	00 00 00 
+  801daf:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  801db1:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  801db8:	00 00 00 
+  801dbb:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  801dc1:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801dc6:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801dcb:	48 89 de             	mov    %rbx,%rsi
+  801dce:	bf 00 00 00 00       	mov    $0x0,%edi
+  801dd3:	48 b8 e5 11 80 00 00 	movabs $0x8011e5,%rax
+  801dda:	00 00 00 
+  801ddd:	ff d0                	call   *%rax
+  801ddf:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  801de1:	85 c0                	test   %eax,%eax
+  801de3:	0f 88 a2 00 00 00    	js     801e8b <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  801de9:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801df0:	00 00 00 
+  801df3:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801df9:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801dfe:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  801e00:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  801e05:	49 bc 9d 3f 80 00 00 	movabs $0x803f9d,%r12
+  801e0c:	00 00 00 
+  801e0f:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  801e12:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  801e17:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  801e1a:	48 b8 4a 1d 80 00 00 	movabs $0x801d4a,%rax
+  801e21:	00 00 00 
+  801e24:	ff d0                	call   *%rax
+  801e26:	89 c7                	mov    %eax,%edi
+  801e28:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  801e2e:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  801e33:	48 89 da             	mov    %rbx,%rdx
+  801e36:	be 09 00 00 00       	mov    $0x9,%esi
+  801e3b:	48 b8 e2 46 80 00 00 	movabs $0x8046e2,%rax
+  801e42:	00 00 00 
+  801e45:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  801e47:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e4c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e51:	be 00 00 00 00       	mov    $0x0,%esi
+  801e56:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e5b:	48 b8 be 46 80 00 00 	movabs $0x8046be,%rax
+  801e62:	00 00 00 
+  801e65:	ff d0                	call   *%rax
+  801e67:	89 c3                	mov    %eax,%ebx
+  801e69:	85 c0                	test   %eax,%eax
+  801e6b:	78 25                	js     801e92 <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  801e6d:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801e74:	00 00 00 
+  801e77:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801e7d:	a3 00 26 82 00 00 00 	movabs %eax,0x822600
+  801e84:	00 00 
+    return 0;
+  801e86:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  801e8b:	89 d8                	mov    %ebx,%eax
+  801e8d:	5b                   	pop    %rbx
+  801e8e:	41 5c                	pop    %r12
+  801e90:	5d                   	pop    %rbp
+  801e91:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  801e92:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801e97:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  801e9c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ea1:	48 b8 8b 12 80 00 00 	movabs $0x80128b,%rax
+  801ea8:	00 00 00 
+  801eab:	ff d0                	call   *%rax
+        return res;
+  801ead:	eb dc                	jmp    801e8b <fschan_setup+0xff>
+
+0000000000801eaf <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  801eaf:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  801eb6:	00 00 00 
+  801eb9:	80 38 00             	cmpb   $0x0,(%rax)
+  801ebc:	74 55                	je     801f13 <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801ebe:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801ec5:	00 00 00 
+  801ec8:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  801ece:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801ed3:	48 ba 00 26 82 00 00 	movabs $0x822600,%rdx
+  801eda:	00 00 00 
+  801edd:	3b 0a                	cmp    (%rdx),%ecx
+  801edf:	75 01                	jne    801ee2 <fschan+0x33>
+}
+  801ee1:	c3                   	ret
+fschan(void) {
+  801ee2:	55                   	push   %rbp
+  801ee3:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801ee6:	48 b8 8c 1d 80 00 00 	movabs $0x801d8c,%rax
+  801eed:	00 00 00 
+  801ef0:	ff d0                	call   *%rax
+  801ef2:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  801ef4:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801ef9:	85 d2                	test   %edx,%edx
+  801efb:	78 02                	js     801eff <fschan+0x50>
+}
+  801efd:	5d                   	pop    %rbp
+  801efe:	c3                   	ret
+        fschan_enabled = 0;
+  801eff:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  801f06:	00 00 00 
+  801f09:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  801f0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f11:	eb ea                	jmp    801efd <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  801f13:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f18:	c3                   	ret
+
+0000000000801f19 <fbuf>:
+fbuf(struct Fd *fd) {
+  801f19:	55                   	push   %rbp
+  801f1a:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  801f1d:	48 b8 18 16 80 00 00 	movabs $0x801618,%rax
+  801f24:	00 00 00 
+  801f27:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  801f29:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f2e:	48 83 f8 1f          	cmp    $0x1f,%rax
+  801f32:	77 12                	ja     801f46 <fbuf+0x2d>
+  801f34:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  801f38:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  801f3f:	00 00 00 
+  801f42:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  801f46:	48 89 d0             	mov    %rdx,%rax
+  801f49:	5d                   	pop    %rbp
+  801f4a:	c3                   	ret
+
+0000000000801f4b <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  801f4b:	55                   	push   %rbp
+  801f4c:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  801f4f:	48 83 c7 40          	add    $0x40,%rdi
+  801f53:	48 b8 d7 3f 80 00 00 	movabs $0x803fd7,%rax
+  801f5a:	00 00 00 
+  801f5d:	ff d0                	call   *%rax
+  801f5f:	84 c0                	test   %al,%al
+  801f61:	75 02                	jne    801f65 <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  801f63:	5d                   	pop    %rbp
+  801f64:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  801f65:	48 b8 4a 1d 80 00 00 	movabs $0x801d4a,%rax
+  801f6c:	00 00 00 
+  801f6f:	ff d0                	call   *%rax
+  801f71:	89 c7                	mov    %eax,%edi
+  801f73:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f79:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f7e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f83:	be 0a 00 00 00       	mov    $0xa,%esi
+  801f88:	48 b8 e2 46 80 00 00 	movabs $0x8046e2,%rax
+  801f8f:	00 00 00 
+  801f92:	ff d0                	call   *%rax
+}
+  801f94:	eb cd                	jmp    801f63 <fschan_publish+0x18>
+
+0000000000801f96 <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  801f96:	55                   	push   %rbp
+  801f97:	48 89 e5             	mov    %rsp,%rbp
+  801f9a:	41 57                	push   %r15
+  801f9c:	41 56                	push   %r14
+  801f9e:	41 55                	push   %r13
+  801fa0:	41 54                	push   %r12
+  801fa2:	53                   	push   %rbx
+  801fa3:	48 83 ec 48          	sub    $0x48,%rsp
+  801fa7:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801fab:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  801faf:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  801fb2:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  801fb6:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  801fb9:	48 ba 04 00 82 00 00 	movabs $0x820004,%rdx
+  801fc0:	00 00 00 
+  801fc3:	8b 02                	mov    (%rdx),%eax
+  801fc5:	83 c0 01             	add    $0x1,%eax
+  801fc8:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801fcd:	0f 44 c1             	cmove  %ecx,%eax
+  801fd0:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  801fd2:	4d 85 c0             	test   %r8,%r8
+  801fd5:	74 2c                	je     802003 <fschan_rw+0x6d>
+  801fd7:	45 89 ce             	mov    %r9d,%r14d
+  801fda:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  801fe1:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  801fe5:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801feb:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  801ff2:	00 
+  801ff3:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801ff9:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ffe:	e9 41 01 00 00       	jmp    802144 <fschan_rw+0x1ae>
+  802003:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  802007:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80200b:	e9 9c 01 00 00       	jmp    8021ac <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  802010:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  802014:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  802017:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  80201a:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  80201d:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  802021:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  802025:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  802029:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  80202d:	48 89 da             	mov    %rbx,%rdx
+  802030:	48 b8 e7 0e 80 00 00 	movabs $0x800ee7,%rax
+  802037:	00 00 00 
+  80203a:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  80203c:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802040:	48 b8 4b 1f 80 00 00 	movabs $0x801f4b,%rax
+  802047:	00 00 00 
+  80204a:	ff d0                	call   *%rax
+            queued += blk;
+  80204c:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  80204f:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  802053:	4d 39 fc             	cmp    %r15,%r12
+  802056:	73 6b                	jae    8020c3 <fschan_rw+0x12d>
+  802058:	41 83 fd 0f          	cmp    $0xf,%r13d
+  80205c:	77 65                	ja     8020c3 <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  80205e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802062:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  802066:	48 b8 b2 3f 80 00 00 	movabs $0x803fb2,%rax
+  80206d:	00 00 00 
+  802070:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  802072:	4c 89 fb             	mov    %r15,%rbx
+  802075:	4c 29 e3             	sub    %r12,%rbx
+  802078:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  80207d:	48 39 d3             	cmp    %rdx,%rbx
+  802080:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  802084:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  802088:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  80208c:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  802090:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  802093:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  802095:	48 b9 04 00 82 00 00 	movabs $0x820004,%rcx
+  80209c:	00 00 00 
+  80209f:	8b 09                	mov    (%rcx),%ecx
+  8020a1:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  8020a4:	83 fe 03             	cmp    $0x3,%esi
+  8020a7:	0f 85 63 ff ff ff    	jne    802010 <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  8020ad:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8020b1:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  8020b4:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  8020b7:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  8020ba:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  8020be:	e9 79 ff ff ff       	jmp    80203c <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  8020c3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8020c7:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  8020ce:	48 89 df             	mov    %rbx,%rdi
+  8020d1:	48 b8 75 40 80 00 00 	movabs $0x804075,%rax
+  8020d8:	00 00 00 
+  8020db:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  8020dd:	48 89 df             	mov    %rbx,%rdi
+  8020e0:	48 b8 03 40 80 00 00 	movabs $0x804003,%rax
+  8020e7:	00 00 00 
+  8020ea:	ff d0                	call   *%rax
+  8020ec:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  8020f0:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  8020f4:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  8020f8:	75 25                	jne    80211f <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  8020fa:	8b 40 04             	mov    0x4(%rax),%eax
+  8020fd:	85 c0                	test   %eax,%eax
+  8020ff:	0f 88 86 00 00 00    	js     80218b <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  802105:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  802109:	74 5b                	je     802166 <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  80210b:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  80210f:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  802113:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  802117:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  80211b:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  80211f:	48 89 df             	mov    %rbx,%rdi
+  802122:	48 b8 2a 40 80 00 00 	movabs $0x80402a,%rax
+  802129:	00 00 00 
+  80212c:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  80212e:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  802132:	83 f0 01             	xor    $0x1,%eax
+  802135:	4d 39 fc             	cmp    %r15,%r12
+  802138:	0f 92 c2             	setb   %dl
+  80213b:	84 c2                	test   %al,%dl
+  80213d:	75 05                	jne    802144 <fschan_rw+0x1ae>
+  80213f:	45 85 ed             	test   %r13d,%r13d
+  802142:	74 50                	je     802194 <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  802144:	4d 39 fc             	cmp    %r15,%r12
+  802147:	0f 92 c1             	setb   %cl
+  80214a:	41 83 fd 0f          	cmp    $0xf,%r13d
+  80214e:	0f 96 c2             	setbe  %dl
+  802151:	84 d1                	test   %dl,%cl
+  802153:	0f 84 6a ff ff ff    	je     8020c3 <fschan_rw+0x12d>
+  802159:	84 c0                	test   %al,%al
+  80215b:	0f 85 fd fe ff ff    	jne    80205e <fschan_rw+0xc8>
+  802161:	e9 5d ff ff ff       	jmp    8020c3 <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  802166:	48 63 d0             	movslq %eax,%rdx
+  802169:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80216d:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  802171:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802175:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  802179:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  80217d:	48 b8 e7 0e 80 00 00 	movabs $0x800ee7,%rax
+  802184:	00 00 00 
+  802187:	ff d0                	call   *%rax
+  802189:	eb 80                	jmp    80210b <fschan_rw+0x175>
+                err = msg->fm_res;
+  80218b:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  80218e:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  802192:	eb 8b                	jmp    80211f <fschan_rw+0x189>
+    return done || !err ? done : err;
+  802194:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  802199:	0f 85 68 fe ff ff    	jne    802007 <fschan_rw+0x71>
+  80219f:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  8021a2:	85 c0                	test   %eax,%eax
+  8021a4:	0f 84 5d fe ff ff    	je     802007 <fschan_rw+0x71>
+  8021aa:	48 98                	cltq
+}
+  8021ac:	48 83 c4 48          	add    $0x48,%rsp
+  8021b0:	5b                   	pop    %rbx
+  8021b1:	41 5c                	pop    %r12
+  8021b3:	41 5d                	pop    %r13
+  8021b5:	41 5e                	pop    %r14
+  8021b7:	41 5f                	pop    %r15
+  8021b9:	5d                   	pop    %rbp
+  8021ba:	c3                   	ret
+
+00000000008021bb <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  8021bb:	55                   	push   %rbp
+  8021bc:	48 89 e5             	mov    %rsp,%rbp
+  8021bf:	41 56                	push   %r14
+  8021c1:	41 55                	push   %r13
+  8021c3:	41 54                	push   %r12
+  8021c5:	53                   	push   %rbx
+  8021c6:	48 83 ec 10          	sub    $0x10,%rsp
+  8021ca:	49 89 fe             	mov    %rdi,%r14
+  8021cd:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  8021d0:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  8021d4:	48 29 f3             	sub    %rsi,%rbx
+  8021d7:	48 39 d3             	cmp    %rdx,%rbx
+  8021da:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  8021de:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8021e5:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  8021e6:	bf 00 10 00 00       	mov    $0x1000,%edi
+  8021eb:	49 bd 34 3e 80 00 00 	movabs $0x803e34,%r13
+  8021f2:	00 00 00 
+  8021f5:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  8021fc:	76 1e                	jbe    80221c <mmap_fault+0x61>
+  8021fe:	4c 01 e7             	add    %r12,%rdi
+  802201:	41 ff d5             	call   *%r13
+  802204:	84 c0                	test   %al,%al
+  802206:	75 14                	jne    80221c <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  802208:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80220c:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  802213:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  802217:	48 39 df             	cmp    %rbx,%rdi
+  80221a:	72 e2                	jb     8021fe <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  80221c:	48 bb 00 10 82 00 00 	movabs $0x821000,%rbx
+  802223:	00 00 00 
+  802226:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  80222d:	00 00 00 
+  802230:	4c 89 f0             	mov    %r14,%rax
+  802233:	48 29 d0             	sub    %rdx,%rax
+  802236:	48 c1 f8 03          	sar    $0x3,%rax
+  80223a:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  802241:	aa aa aa 
+  802244:	48 0f af c2          	imul   %rdx,%rax
+  802248:	48 c1 e0 0c          	shl    $0xc,%rax
+  80224c:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  802251:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  802255:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  802257:	44 89 e0             	mov    %r12d,%eax
+  80225a:	41 03 46 10          	add    0x10(%r14),%eax
+  80225e:	41 2b 06             	sub    (%r14),%eax
+  802261:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  802264:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802268:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  80226c:	41 8b 46 14          	mov    0x14(%r14),%eax
+  802270:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  802273:	48 b8 4a 1d 80 00 00 	movabs $0x801d4a,%rax
+  80227a:	00 00 00 
+  80227d:	ff d0                	call   *%rax
+  80227f:	89 c7                	mov    %eax,%edi
+  802281:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802287:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80228c:	48 89 da             	mov    %rbx,%rdx
+  80228f:	be 0f 00 00 00       	mov    $0xf,%esi
+  802294:	48 b8 e2 46 80 00 00 	movabs $0x8046e2,%rax
+  80229b:	00 00 00 
+  80229e:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  8022a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022a5:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8022a9:	4c 89 e6             	mov    %r12,%rsi
+  8022ac:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022b1:	48 b8 be 46 80 00 00 	movabs $0x8046be,%rax
+  8022b8:	00 00 00 
+  8022bb:	ff d0                	call   *%rax
+  8022bd:	48 98                	cltq
+}
+  8022bf:	48 83 c4 10          	add    $0x10,%rsp
+  8022c3:	5b                   	pop    %rbx
+  8022c4:	41 5c                	pop    %r12
+  8022c6:	41 5d                	pop    %r13
+  8022c8:	41 5e                	pop    %r14
+  8022ca:	5d                   	pop    %rbp
+  8022cb:	c3                   	ret
+
+00000000008022cc <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  8022cc:	48 8b 37             	mov    (%rdi),%rsi
+  8022cf:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  8022d6:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  8022dd:	00 00 00 
+  8022e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022e5:	eb 0f                	jmp    8022f6 <mmap_pgfault+0x2a>
+  8022e7:	c3                   	ret
+  8022e8:	48 83 c1 01          	add    $0x1,%rcx
+  8022ec:	48 83 c2 18          	add    $0x18,%rdx
+  8022f0:	48 83 f9 20          	cmp    $0x20,%rcx
+  8022f4:	74 6e                	je     802364 <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  8022f6:	48 8b 02             	mov    (%rdx),%rax
+  8022f9:	48 83 e8 01          	sub    $0x1,%rax
+  8022fd:	48 39 f0             	cmp    %rsi,%rax
+  802300:	73 e6                	jae    8022e8 <mmap_pgfault+0x1c>
+  802302:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  802306:	73 e0                	jae    8022e8 <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  802308:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  80230c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802311:	f6 c2 01             	test   $0x1,%dl
+  802314:	75 d1                	jne    8022e7 <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  802316:	f6 c2 02             	test   $0x2,%dl
+  802319:	74 1a                	je     802335 <mmap_pgfault+0x69>
+  80231b:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  80231f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802324:	48 bf 00 20 82 00 00 	movabs $0x822000,%rdi
+  80232b:	00 00 00 
+  80232e:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  802333:	74 35                	je     80236a <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  802335:	55                   	push   %rbp
+  802336:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  802339:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  80233d:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  802344:	00 00 00 
+  802347:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  80234b:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802350:	48 b8 bb 21 80 00 00 	movabs $0x8021bb,%rax
+  802357:	00 00 00 
+  80235a:	ff d0                	call   *%rax
+  80235c:	48 85 c0             	test   %rax,%rax
+  80235f:	0f 9f c0             	setg   %al
+}
+  802362:	5d                   	pop    %rbp
+  802363:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  802364:	b8 00 00 00 00       	mov    $0x0,%eax
+  802369:	c3                   	ret
+}
+  80236a:	c3                   	ret
+
+000000000080236b <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  80236b:	55                   	push   %rbp
+  80236c:	48 89 e5             	mov    %rsp,%rbp
+  80236f:	41 54                	push   %r12
+  802371:	53                   	push   %rbx
+  802372:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802375:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  80237c:	00 00 00 
+  80237f:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  802384:	48 83 38 00          	cmpq   $0x0,(%rax)
+  802388:	74 15                	je     80239f <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80238a:	48 83 c3 01          	add    $0x1,%rbx
+  80238e:	48 83 c0 18          	add    $0x18,%rax
+  802392:	48 83 fb 20          	cmp    $0x20,%rbx
+  802396:	75 ec                	jne    802384 <mmap_alloc+0x19>
+    return NULL;
+  802398:	b8 00 00 00 00       	mov    $0x0,%eax
+  80239d:	eb 52                	jmp    8023f1 <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  80239f:	4c 89 e7             	mov    %r12,%rdi
+  8023a2:	48 b8 d5 3d 80 00 00 	movabs $0x803dd5,%rax
+  8023a9:	00 00 00 
+  8023ac:	ff d0                	call   *%rax
+  8023ae:	41 89 c1             	mov    %eax,%r9d
+  8023b1:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  8023b8:	48 c1 e1 0c          	shl    $0xc,%rcx
+  8023bc:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8023c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023c7:	4c 89 e6             	mov    %r12,%rsi
+  8023ca:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023cf:	48 b8 3b 12 80 00 00 	movabs $0x80123b,%rax
+  8023d6:	00 00 00 
+  8023d9:	ff d0                	call   *%rax
+  8023db:	85 c0                	test   %eax,%eax
+  8023dd:	78 17                	js     8023f6 <mmap_alloc+0x8b>
+        return &mmaps[i];
+  8023df:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  8023e3:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8023ea:	00 00 00 
+  8023ed:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  8023f1:	5b                   	pop    %rbx
+  8023f2:	41 5c                	pop    %r12
+  8023f4:	5d                   	pop    %rbp
+  8023f5:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  8023f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023fb:	eb f4                	jmp    8023f1 <mmap_alloc+0x86>
+
+00000000008023fd <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  8023fd:	55                   	push   %rbp
+  8023fe:	48 89 e5             	mov    %rsp,%rbp
+  802401:	41 56                	push   %r14
+  802403:	41 55                	push   %r13
+  802405:	41 54                	push   %r12
+  802407:	53                   	push   %rbx
+  802408:	48 83 ec 10          	sub    $0x10,%rsp
+  80240c:	41 89 fc             	mov    %edi,%r12d
+  80240f:	49 89 f5             	mov    %rsi,%r13
+  802412:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  802415:	48 89 f0             	mov    %rsi,%rax
+  802418:	48 09 d0             	or     %rdx,%rax
+  80241b:	75 0d                	jne    80242a <fsipc+0x2d>
+  80241d:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  802420:	83 f8 04             	cmp    $0x4,%eax
+  802423:	76 7d                	jbe    8024a2 <fsipc+0xa5>
+  802425:	83 ff 0d             	cmp    $0xd,%edi
+  802428:	74 78                	je     8024a2 <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  80242a:	48 b8 4a 1d 80 00 00 	movabs $0x801d4a,%rax
+  802431:	00 00 00 
+  802434:	ff d0                	call   *%rax
+  802436:	89 c7                	mov    %eax,%edi
+  802438:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  80243f:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  802446:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  80244d:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802453:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  80245a:	00 00 00 
+  80245d:	44 89 e6             	mov    %r12d,%esi
+  802460:	48 b8 e2 46 80 00 00 	movabs $0x8046e2,%rax
+  802467:	00 00 00 
+  80246a:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  80246c:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  802473:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  802474:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802479:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80247d:	4c 89 ee             	mov    %r13,%rsi
+  802480:	bf 00 00 00 00       	mov    $0x0,%edi
+  802485:	48 b8 be 46 80 00 00 	movabs $0x8046be,%rax
+  80248c:	00 00 00 
+  80248f:	ff d0                	call   *%rax
+  802491:	89 c3                	mov    %eax,%ebx
+}
+  802493:	89 d8                	mov    %ebx,%eax
+  802495:	48 83 c4 10          	add    $0x10,%rsp
+  802499:	5b                   	pop    %rbx
+  80249a:	41 5c                	pop    %r12
+  80249c:	41 5d                	pop    %r13
+  80249e:	41 5e                	pop    %r14
+  8024a0:	5d                   	pop    %rbp
+  8024a1:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  8024a2:	48 b8 af 1e 80 00 00 	movabs $0x801eaf,%rax
+  8024a9:	00 00 00 
+  8024ac:	ff d0                	call   *%rax
+  8024ae:	49 89 c6             	mov    %rax,%r14
+  8024b1:	48 85 c0             	test   %rax,%rax
+  8024b4:	0f 84 70 ff ff ff    	je     80242a <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  8024ba:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  8024be:	48 b8 b2 3f 80 00 00 	movabs $0x803fb2,%rax
+  8024c5:	00 00 00 
+  8024c8:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  8024ca:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  8024cd:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  8024d4:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  8024d8:	ba 10 00 00 00       	mov    $0x10,%edx
+  8024dd:	48 be 00 00 83 00 00 	movabs $0x830000,%rsi
+  8024e4:	00 00 00 
+  8024e7:	48 b8 e7 0e 80 00 00 	movabs $0x800ee7,%rax
+  8024ee:	00 00 00 
+  8024f1:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  8024f3:	4c 89 f7             	mov    %r14,%rdi
+  8024f6:	48 b8 4b 1f 80 00 00 	movabs $0x801f4b,%rax
+  8024fd:	00 00 00 
+  802500:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  802502:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  802509:	4c 89 f7             	mov    %r14,%rdi
+  80250c:	48 b8 75 40 80 00 00 	movabs $0x804075,%rax
+  802513:	00 00 00 
+  802516:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  802518:	4c 89 f7             	mov    %r14,%rdi
+  80251b:	48 b8 03 40 80 00 00 	movabs $0x804003,%rax
+  802522:	00 00 00 
+  802525:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  802527:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  80252a:	41 83 fc 05          	cmp    $0x5,%r12d
+  80252e:	75 04                	jne    802534 <fsipc+0x137>
+  802530:	85 db                	test   %ebx,%ebx
+  802532:	79 14                	jns    802548 <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  802534:	4c 89 f7             	mov    %r14,%rdi
+  802537:	48 b8 2a 40 80 00 00 	movabs $0x80402a,%rax
+  80253e:	00 00 00 
+  802541:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  802543:	e9 4b ff ff ff       	jmp    802493 <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  802548:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  80254c:	ba 88 00 00 00       	mov    $0x88,%edx
+  802551:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  802558:	00 00 00 
+  80255b:	48 b8 e7 0e 80 00 00 	movabs $0x800ee7,%rax
+  802562:	00 00 00 
+  802565:	ff d0                	call   *%rax
+  802567:	eb cb                	jmp    802534 <fsipc+0x137>
+
+0000000000802569 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  802569:	55                   	push   %rbp
+  80256a:	48 89 e5             	mov    %rsp,%rbp
+  80256d:	41 57                	push   %r15
+  80256f:	41 56                	push   %r14
+  802571:	41 55                	push   %r13
+  802573:	41 54                	push   %r12
+  802575:	53                   	push   %rbx
+  802576:	48 83 ec 18          	sub    $0x18,%rsp
+  80257a:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  80257e:	49 89 f6             	mov    %rsi,%r14
+  802581:	49 89 d4             	mov    %rdx,%r12
+  802584:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  802587:	48 b8 af 1e 80 00 00 	movabs $0x801eaf,%rax
+  80258e:	00 00 00 
+  802591:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  802593:	48 85 c0             	test   %rax,%rax
+  802596:	0f 85 96 00 00 00    	jne    802632 <devfile_write_direct+0xc9>
+    size_t write = 0;
+  80259c:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8025a3:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8025a4:	49 bf 00 00 83 00 00 	movabs $0x830000,%r15
+  8025ab:	00 00 00 
+    while (n) {
+  8025ae:	4d 85 e4             	test   %r12,%r12
+  8025b1:	74 79                	je     80262c <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  8025b3:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  8025b8:	49 39 dc             	cmp    %rbx,%r12
+  8025bb:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  8025bf:	48 89 da             	mov    %rbx,%rdx
+  8025c2:	4c 89 f6             	mov    %r14,%rsi
+  8025c5:	48 bf 00 10 83 00 00 	movabs $0x831000,%rdi
+  8025cc:	00 00 00 
+  8025cf:	48 b8 e7 0e 80 00 00 	movabs $0x800ee7,%rax
+  8025d6:	00 00 00 
+  8025d9:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8025db:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8025df:	8b 40 0c             	mov    0xc(%rax),%eax
+  8025e2:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  8025e5:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8025e8:	44 01 e8             	add    %r13d,%eax
+  8025eb:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  8025ef:	41 0f 44 c5          	cmove  %r13d,%eax
+  8025f3:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  8025f7:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  8025fb:	48 89 da             	mov    %rbx,%rdx
+  8025fe:	be 00 00 00 00       	mov    $0x0,%esi
+  802603:	bf 04 00 00 00       	mov    $0x4,%edi
+  802608:	48 b8 fd 23 80 00 00 	movabs $0x8023fd,%rax
+  80260f:	00 00 00 
+  802612:	ff d0                	call   *%rax
+        if (res < 0)
+  802614:	85 c0                	test   %eax,%eax
+  802616:	78 4a                	js     802662 <devfile_write_direct+0xf9>
+        buf += res;
+  802618:	48 98                	cltq
+  80261a:	49 01 c6             	add    %rax,%r14
+        write += res;
+  80261d:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  802621:	49 29 c4             	sub    %rax,%r12
+  802624:	75 8d                	jne    8025b3 <devfile_write_direct+0x4a>
+    return write;
+  802626:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80262a:	eb 27                	jmp    802653 <devfile_write_direct+0xea>
+    size_t write = 0;
+  80262c:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  802630:	eb f4                	jmp    802626 <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  802632:	45 89 e9             	mov    %r13d,%r9d
+  802635:	4d 89 e0             	mov    %r12,%r8
+  802638:	4c 89 f1             	mov    %r14,%rcx
+  80263b:	ba 04 00 00 00       	mov    $0x4,%edx
+  802640:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802644:	48 89 c7             	mov    %rax,%rdi
+  802647:	48 b8 96 1f 80 00 00 	movabs $0x801f96,%rax
+  80264e:	00 00 00 
+  802651:	ff d0                	call   *%rax
+}
+  802653:	48 83 c4 18          	add    $0x18,%rsp
+  802657:	5b                   	pop    %rbx
+  802658:	41 5c                	pop    %r12
+  80265a:	41 5d                	pop    %r13
+  80265c:	41 5e                	pop    %r14
+  80265e:	41 5f                	pop    %r15
+  802660:	5d                   	pop    %rbp
+  802661:	c3                   	ret
+            return res;
+  802662:	48 98                	cltq
+  802664:	eb ed                	jmp    802653 <devfile_write_direct+0xea>
+
+0000000000802666 <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  802666:	55                   	push   %rbp
+  802667:	48 89 e5             	mov    %rsp,%rbp
+  80266a:	41 54                	push   %r12
+  80266c:	53                   	push   %rbx
+  80266d:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  802670:	48 b8 19 1f 80 00 00 	movabs $0x801f19,%rax
+  802677:	00 00 00 
+  80267a:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  80267c:	48 85 c0             	test   %rax,%rax
+  80267f:	74 71                	je     8026f2 <fbuf_flush+0x8c>
+  802681:	48 89 c3             	mov    %rax,%rbx
+  802684:	b8 00 00 00 00       	mov    $0x0,%eax
+  802689:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  80268d:	75 05                	jne    802694 <fbuf_flush+0x2e>
+}
+  80268f:	5b                   	pop    %rbx
+  802690:	41 5c                	pop    %r12
+  802692:	5d                   	pop    %rbp
+  802693:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  802694:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  802697:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  80269b:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8026a2:	00 00 00 
+  8026a5:	48 89 de             	mov    %rbx,%rsi
+  8026a8:	48 29 c6             	sub    %rax,%rsi
+  8026ab:	48 c1 fe 03          	sar    $0x3,%rsi
+  8026af:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8026b6:	aa aa aa 
+  8026b9:	48 0f af f0          	imul   %rax,%rsi
+  8026bd:	48 c1 e6 0e          	shl    $0xe,%rsi
+  8026c1:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  8026c6:	48 01 c6             	add    %rax,%rsi
+  8026c9:	4c 89 e7             	mov    %r12,%rdi
+  8026cc:	48 b8 69 25 80 00 00 	movabs $0x802569,%rax
+  8026d3:	00 00 00 
+  8026d6:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  8026d8:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  8026dc:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  8026e3:	00 
+    return res < 0 ? res : 0;
+  8026e4:	48 85 c0             	test   %rax,%rax
+  8026e7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026ec:	48 0f 4f c2          	cmovg  %rdx,%rax
+  8026f0:	eb 9d                	jmp    80268f <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  8026f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026f7:	eb 96                	jmp    80268f <fbuf_flush+0x29>
+
+00000000008026f9 <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  8026f9:	55                   	push   %rbp
+  8026fa:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  8026fd:	48 b8 66 26 80 00 00 	movabs $0x802666,%rax
+  802704:	00 00 00 
+  802707:	ff d0                	call   *%rax
+}
+  802709:	5d                   	pop    %rbp
+  80270a:	c3                   	ret
+
+000000000080270b <devfile_write>:
+    if (!fd || !buf)
+  80270b:	48 85 ff             	test   %rdi,%rdi
+  80270e:	0f 84 d3 01 00 00    	je     8028e7 <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802714:	55                   	push   %rbp
+  802715:	48 89 e5             	mov    %rsp,%rbp
+  802718:	41 57                	push   %r15
+  80271a:	41 56                	push   %r14
+  80271c:	41 55                	push   %r13
+  80271e:	41 54                	push   %r12
+  802720:	53                   	push   %rbx
+  802721:	48 83 ec 08          	sub    $0x8,%rsp
+  802725:	49 89 fc             	mov    %rdi,%r12
+  802728:	49 89 f6             	mov    %rsi,%r14
+  80272b:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  80272e:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802733:	48 85 f6             	test   %rsi,%rsi
+  802736:	0f 84 9c 01 00 00    	je     8028d8 <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  80273c:	48 b8 19 1f 80 00 00 	movabs $0x801f19,%rax
+  802743:	00 00 00 
+  802746:	ff d0                	call   *%rax
+  802748:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  80274b:	48 85 c0             	test   %rax,%rax
+  80274e:	0f 84 a2 00 00 00    	je     8027f6 <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802754:	be 00 10 00 00       	mov    $0x1000,%esi
+  802759:	4c 89 e7             	mov    %r12,%rdi
+  80275c:	48 b8 aa 11 80 00 00 	movabs $0x8011aa,%rax
+  802763:	00 00 00 
+  802766:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  802768:	83 f8 02             	cmp    $0x2,%eax
+  80276b:	0f 8f 85 00 00 00    	jg     8027f6 <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  802771:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802778:	00 00 00 
+  80277b:	4d 89 ef             	mov    %r13,%r15
+  80277e:	49 29 c7             	sub    %rax,%r15
+  802781:	49 c1 ff 03          	sar    $0x3,%r15
+  802785:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  80278c:	aa aa aa 
+  80278f:	4c 0f af f8          	imul   %rax,%r15
+  802793:	49 c1 e7 0e          	shl    $0xe,%r15
+  802797:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  80279c:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  80279f:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  8027a4:	0f 84 d7 00 00 00    	je     802881 <devfile_write+0x176>
+  8027aa:	49 8b 45 10          	mov    0x10(%r13),%rax
+  8027ae:	89 c2                	mov    %eax,%edx
+  8027b0:	41 03 55 0c          	add    0xc(%r13),%edx
+  8027b4:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  8027b9:	75 0f                	jne    8027ca <devfile_write+0xbf>
+  8027bb:	48 01 d8             	add    %rbx,%rax
+  8027be:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  8027c4:	0f 86 92 00 00 00    	jbe    80285c <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  8027ca:	4c 89 e7             	mov    %r12,%rdi
+  8027cd:	48 b8 66 26 80 00 00 	movabs $0x802666,%rax
+  8027d4:	00 00 00 
+  8027d7:	ff d0                	call   *%rax
+  8027d9:	85 c0                	test   %eax,%eax
+  8027db:	78 52                	js     80282f <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  8027dd:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  8027e4:	77 7f                	ja     802865 <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  8027e6:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  8027eb:	0f 85 c2 00 00 00    	jne    8028b3 <devfile_write+0x1a8>
+  8027f1:	e9 94 00 00 00       	jmp    80288a <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  8027f6:	4c 89 e7             	mov    %r12,%rdi
+  8027f9:	48 b8 66 26 80 00 00 	movabs $0x802666,%rax
+  802800:	00 00 00 
+  802803:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802805:	85 c0                	test   %eax,%eax
+  802807:	79 07                	jns    802810 <devfile_write+0x105>
+  802809:	48 98                	cltq
+  80280b:	e9 c8 00 00 00       	jmp    8028d8 <devfile_write+0x1cd>
+  802810:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802815:	48 89 da             	mov    %rbx,%rdx
+  802818:	4c 89 f6             	mov    %r14,%rsi
+  80281b:	4c 89 e7             	mov    %r12,%rdi
+  80281e:	48 b8 69 25 80 00 00 	movabs $0x802569,%rax
+  802825:	00 00 00 
+  802828:	ff d0                	call   *%rax
+  80282a:	e9 a9 00 00 00       	jmp    8028d8 <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  80282f:	48 98                	cltq
+  802831:	e9 a2 00 00 00       	jmp    8028d8 <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802836:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80283b:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802840:	4c 89 fe             	mov    %r15,%rsi
+  802843:	bf 00 00 00 00       	mov    $0x0,%edi
+  802848:	48 b8 e5 11 80 00 00 	movabs $0x8011e5,%rax
+  80284f:	00 00 00 
+  802852:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  802854:	85 c0                	test   %eax,%eax
+  802856:	79 45                	jns    80289d <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802858:	48 98                	cltq
+  80285a:	eb 7c                	jmp    8028d8 <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  80285c:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802863:	76 4e                	jbe    8028b3 <devfile_write+0x1a8>
+  802865:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  80286a:	48 89 da             	mov    %rbx,%rdx
+  80286d:	4c 89 f6             	mov    %r14,%rsi
+  802870:	4c 89 e7             	mov    %r12,%rdi
+  802873:	48 b8 69 25 80 00 00 	movabs $0x802569,%rax
+  80287a:	00 00 00 
+  80287d:	ff d0                	call   *%rax
+  80287f:	eb 57                	jmp    8028d8 <devfile_write+0x1cd>
+  802881:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802888:	77 db                	ja     802865 <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  80288a:	4c 89 ff             	mov    %r15,%rdi
+  80288d:	48 b8 34 3e 80 00 00 	movabs $0x803e34,%rax
+  802894:	00 00 00 
+  802897:	ff d0                	call   *%rax
+  802899:	84 c0                	test   %al,%al
+  80289b:	74 99                	je     802836 <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  80289d:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  8028a2:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8028a7:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  8028ab:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  8028b2:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  8028b3:	4c 89 ff             	mov    %r15,%rdi
+  8028b6:	49 03 7d 10          	add    0x10(%r13),%rdi
+  8028ba:	48 89 da             	mov    %rbx,%rdx
+  8028bd:	4c 89 f6             	mov    %r14,%rsi
+  8028c0:	48 b8 e7 0e 80 00 00 	movabs $0x800ee7,%rax
+  8028c7:	00 00 00 
+  8028ca:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  8028cc:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  8028d0:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  8028d5:	48 89 d8             	mov    %rbx,%rax
+}
+  8028d8:	48 83 c4 08          	add    $0x8,%rsp
+  8028dc:	5b                   	pop    %rbx
+  8028dd:	41 5c                	pop    %r12
+  8028df:	41 5d                	pop    %r13
+  8028e1:	41 5e                	pop    %r14
+  8028e3:	41 5f                	pop    %r15
+  8028e5:	5d                   	pop    %rbp
+  8028e6:	c3                   	ret
+        return E_INVAL;
+  8028e7:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  8028ec:	c3                   	ret
+
+00000000008028ed <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8028ed:	55                   	push   %rbp
+  8028ee:	48 89 e5             	mov    %rsp,%rbp
+  8028f1:	41 54                	push   %r12
+  8028f3:	53                   	push   %rbx
+  8028f4:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  8028f7:	48 b8 66 26 80 00 00 	movabs $0x802666,%rax
+  8028fe:	00 00 00 
+  802901:	ff d0                	call   *%rax
+  802903:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  802906:	48 89 df             	mov    %rbx,%rdi
+  802909:	48 b8 19 1f 80 00 00 	movabs $0x801f19,%rax
+  802910:	00 00 00 
+  802913:	ff d0                	call   *%rax
+  802915:	48 85 c0             	test   %rax,%rax
+  802918:	74 17                	je     802931 <devfile_flush+0x44>
+  80291a:	48 89 df             	mov    %rbx,%rdi
+  80291d:	48 b8 19 1f 80 00 00 	movabs $0x801f19,%rax
+  802924:	00 00 00 
+  802927:	ff d0                	call   *%rax
+  802929:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  802930:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802931:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802934:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  80293b:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  80293d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802942:	be 00 00 00 00       	mov    $0x0,%esi
+  802947:	bf 06 00 00 00       	mov    $0x6,%edi
+  80294c:	48 b8 fd 23 80 00 00 	movabs $0x8023fd,%rax
+  802953:	00 00 00 
+  802956:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802958:	45 85 e4             	test   %r12d,%r12d
+  80295b:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  80295f:	5b                   	pop    %rbx
+  802960:	41 5c                	pop    %r12
+  802962:	5d                   	pop    %rbp
+  802963:	c3                   	ret
+
+0000000000802964 <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  802964:	55                   	push   %rbp
+  802965:	48 89 e5             	mov    %rsp,%rbp
+  802968:	41 57                	push   %r15
+  80296a:	41 56                	push   %r14
+  80296c:	41 55                	push   %r13
+  80296e:	41 54                	push   %r12
+  802970:	53                   	push   %rbx
+  802971:	48 83 ec 38          	sub    $0x38,%rsp
+  802975:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  802979:	49 89 f7             	mov    %rsi,%r15
+  80297c:	48 89 d3             	mov    %rdx,%rbx
+  80297f:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  802982:	48 b8 af 1e 80 00 00 	movabs $0x801eaf,%rax
+  802989:	00 00 00 
+  80298c:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  80298e:	48 85 c0             	test   %rax,%rax
+  802991:	75 20                	jne    8029b3 <devfile_read_direct+0x4f>
+    bool map = 1;
+  802993:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  802998:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  80299f:	00 
+    while (n) {
+  8029a0:	48 85 db             	test   %rbx,%rbx
+  8029a3:	0f 85 df 00 00 00    	jne    802a88 <devfile_read_direct+0x124>
+    size_t read = 0;
+  8029a9:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  8029ad:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8029b1:	eb 21                	jmp    8029d4 <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  8029b3:	45 89 f1             	mov    %r14d,%r9d
+  8029b6:	49 89 d8             	mov    %rbx,%r8
+  8029b9:	4c 89 f9             	mov    %r15,%rcx
+  8029bc:	ba 03 00 00 00       	mov    $0x3,%edx
+  8029c1:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  8029c5:	48 89 c7             	mov    %rax,%rdi
+  8029c8:	48 b8 96 1f 80 00 00 	movabs $0x801f96,%rax
+  8029cf:	00 00 00 
+  8029d2:	ff d0                	call   *%rax
+}
+  8029d4:	48 83 c4 38          	add    $0x38,%rsp
+  8029d8:	5b                   	pop    %rbx
+  8029d9:	41 5c                	pop    %r12
+  8029db:	41 5d                	pop    %r13
+  8029dd:	41 5e                	pop    %r14
+  8029df:	41 5f                	pop    %r15
+  8029e1:	5d                   	pop    %rbp
+  8029e2:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  8029e3:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8029e7:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  8029ed:	75 1e                	jne    802a0d <devfile_read_direct+0xa9>
+  8029ef:	e9 e2 00 00 00       	jmp    802ad6 <devfile_read_direct+0x172>
+            if (!res) return read;
+  8029f4:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8029f8:	eb da                	jmp    8029d4 <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  8029fa:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  8029fe:	0f 85 d0 01 00 00    	jne    802bd4 <devfile_read_direct+0x270>
+            map = 0;
+  802a04:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802a08:	eb 03                	jmp    802a0d <devfile_read_direct+0xa9>
+  802a0a:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802a0d:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802a12:	48 39 d3             	cmp    %rdx,%rbx
+  802a15:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802a19:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802a1d:	8b 40 0c             	mov    0xc(%rax),%eax
+  802a20:	48 b9 00 00 83 00 00 	movabs $0x830000,%rcx
+  802a27:	00 00 00 
+  802a2a:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  802a2c:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  802a30:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  802a34:	be 00 00 00 00       	mov    $0x0,%esi
+  802a39:	bf 03 00 00 00       	mov    $0x3,%edi
+  802a3e:	48 b8 fd 23 80 00 00 	movabs $0x8023fd,%rax
+  802a45:	00 00 00 
+  802a48:	ff d0                	call   *%rax
+        if (res <= 0)
+  802a4a:	85 c0                	test   %eax,%eax
+  802a4c:	0f 8e 63 01 00 00    	jle    802bb5 <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  802a52:	4c 63 e0             	movslq %eax,%r12
+  802a55:	4c 89 e2             	mov    %r12,%rdx
+  802a58:	48 be 00 10 83 00 00 	movabs $0x831000,%rsi
+  802a5f:	00 00 00 
+  802a62:	4c 89 ff             	mov    %r15,%rdi
+  802a65:	48 b8 e7 0e 80 00 00 	movabs $0x800ee7,%rax
+  802a6c:	00 00 00 
+  802a6f:	ff d0                	call   *%rax
+        buf += res;
+  802a71:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  802a74:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  802a77:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  802a7b:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  802a7f:	48 85 db             	test   %rbx,%rbx
+  802a82:	0f 84 25 ff ff ff    	je     8029ad <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  802a88:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  802a8b:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  802a8f:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802a93:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802a97:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  802a9e:	0f 97 c2             	seta   %dl
+  802aa1:	20 c2                	and    %al,%dl
+  802aa3:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  802aa6:	0f 84 5e ff ff ff    	je     802a0a <devfile_read_direct+0xa6>
+  802aac:	4c 89 fa             	mov    %r15,%rdx
+  802aaf:	4d 89 fd             	mov    %r15,%r13
+  802ab2:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  802ab9:	0f 85 4e ff ff ff    	jne    802a0d <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  802abf:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802ac3:	0f 84 1a ff ff ff    	je     8029e3 <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802ac9:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802ad0:	0f 85 37 ff ff ff    	jne    802a0d <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  802ad6:	48 89 d8             	mov    %rbx,%rax
+  802ad9:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802adf:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802ae4:	48 39 c8             	cmp    %rcx,%rax
+  802ae7:	48 0f 47 c1          	cmova  %rcx,%rax
+  802aeb:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  802aef:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  802af3:	49 89 d4             	mov    %rdx,%r12
+  802af6:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  802afa:	48 b8 d5 3d 80 00 00 	movabs $0x803dd5,%rax
+  802b01:	00 00 00 
+  802b04:	ff d0                	call   *%rax
+  802b06:	a8 40                	test   $0x40,%al
+  802b08:	0f 85 b9 00 00 00    	jne    802bc7 <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  802b0e:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  802b15:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802b19:	49 39 c5             	cmp    %rax,%r13
+  802b1c:	72 d8                	jb     802af6 <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802b1e:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802b22:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802b29:	00 00 00 
+  802b2c:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802b30:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  802b33:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  802b35:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  802b39:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  802b3d:	48 b8 4a 1d 80 00 00 	movabs $0x801d4a,%rax
+  802b44:	00 00 00 
+  802b47:	ff d0                	call   *%rax
+  802b49:	89 c7                	mov    %eax,%edi
+  802b4b:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802b51:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802b56:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802b5d:	00 00 00 
+  802b60:	be 0e 00 00 00       	mov    $0xe,%esi
+  802b65:	48 b8 e2 46 80 00 00 	movabs $0x8046e2,%rax
+  802b6c:	00 00 00 
+  802b6f:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  802b71:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802b76:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802b7a:	4c 89 fe             	mov    %r15,%rsi
+  802b7d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b82:	48 b8 be 46 80 00 00 	movabs $0x8046be,%rax
+  802b89:	00 00 00 
+  802b8c:	ff d0                	call   *%rax
+  802b8e:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  802b91:	48 85 d2             	test   %rdx,%rdx
+  802b94:	0f 84 5a fe ff ff    	je     8029f4 <devfile_read_direct+0x90>
+            if (res > 0) {
+  802b9a:	0f 8e 5a fe ff ff    	jle    8029fa <devfile_read_direct+0x96>
+                buf += res;
+  802ba0:	48 98                	cltq
+  802ba2:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  802ba5:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  802ba8:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  802bac:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  802bb0:	e9 ca fe ff ff       	jmp    802a7f <devfile_read_direct+0x11b>
+            return res ? res : read;
+  802bb5:	41 89 c5             	mov    %eax,%r13d
+  802bb8:	48 98                	cltq
+  802bba:	45 85 ed             	test   %r13d,%r13d
+  802bbd:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  802bc2:	e9 0d fe ff ff       	jmp    8029d4 <devfile_read_direct+0x70>
+            map = 0;
+  802bc7:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802bcb:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802bcf:	e9 39 fe ff ff       	jmp    802a0d <devfile_read_direct+0xa9>
+  802bd4:	48 89 d0             	mov    %rdx,%rax
+  802bd7:	e9 f8 fd ff ff       	jmp    8029d4 <devfile_read_direct+0x70>
+
+0000000000802bdc <devfile_read>:
+    if (!fd || !buf)
+  802bdc:	48 85 ff             	test   %rdi,%rdi
+  802bdf:	0f 84 21 02 00 00    	je     802e06 <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802be5:	55                   	push   %rbp
+  802be6:	48 89 e5             	mov    %rsp,%rbp
+  802be9:	41 57                	push   %r15
+  802beb:	41 56                	push   %r14
+  802bed:	41 55                	push   %r13
+  802bef:	41 54                	push   %r12
+  802bf1:	53                   	push   %rbx
+  802bf2:	48 83 ec 28          	sub    $0x28,%rsp
+  802bf6:	48 89 fb             	mov    %rdi,%rbx
+  802bf9:	49 89 f4             	mov    %rsi,%r12
+  802bfc:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  802bff:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802c04:	48 85 f6             	test   %rsi,%rsi
+  802c07:	74 4b                	je     802c54 <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  802c09:	48 b8 19 1f 80 00 00 	movabs $0x801f19,%rax
+  802c10:	00 00 00 
+  802c13:	ff d0                	call   *%rax
+  802c15:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802c18:	48 85 c0             	test   %rax,%rax
+  802c1b:	74 22                	je     802c3f <devfile_read+0x63>
+  802c1d:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  802c24:	77 19                	ja     802c3f <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802c26:	be 00 10 00 00       	mov    $0x1000,%esi
+  802c2b:	48 89 df             	mov    %rbx,%rdi
+  802c2e:	48 b8 aa 11 80 00 00 	movabs $0x8011aa,%rax
+  802c35:	00 00 00 
+  802c38:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802c3a:	83 f8 02             	cmp    $0x2,%eax
+  802c3d:	7e 40                	jle    802c7f <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  802c3f:	48 89 df             	mov    %rbx,%rdi
+  802c42:	48 b8 66 26 80 00 00 	movabs $0x802666,%rax
+  802c49:	00 00 00 
+  802c4c:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802c4e:	85 c0                	test   %eax,%eax
+  802c50:	79 11                	jns    802c63 <devfile_read+0x87>
+  802c52:	48 98                	cltq
+}
+  802c54:	48 83 c4 28          	add    $0x28,%rsp
+  802c58:	5b                   	pop    %rbx
+  802c59:	41 5c                	pop    %r12
+  802c5b:	41 5d                	pop    %r13
+  802c5d:	41 5e                	pop    %r14
+  802c5f:	41 5f                	pop    %r15
+  802c61:	5d                   	pop    %rbp
+  802c62:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802c63:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802c68:	4c 89 ea             	mov    %r13,%rdx
+  802c6b:	4c 89 e6             	mov    %r12,%rsi
+  802c6e:	48 89 df             	mov    %rbx,%rdi
+  802c71:	48 b8 64 29 80 00 00 	movabs $0x802964,%rax
+  802c78:	00 00 00 
+  802c7b:	ff d0                	call   *%rax
+  802c7d:	eb d5                	jmp    802c54 <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  802c7f:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802c83:	48 89 df             	mov    %rbx,%rdi
+  802c86:	48 b8 66 26 80 00 00 	movabs $0x802666,%rax
+  802c8d:	00 00 00 
+  802c90:	ff d0                	call   *%rax
+  802c92:	85 c0                	test   %eax,%eax
+  802c94:	0f 88 33 01 00 00    	js     802dcd <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  802c9a:	48 ba 00 23 82 00 00 	movabs $0x822300,%rdx
+  802ca1:	00 00 00 
+  802ca4:	4c 89 f0             	mov    %r14,%rax
+  802ca7:	48 29 d0             	sub    %rdx,%rax
+  802caa:	48 c1 f8 03          	sar    $0x3,%rax
+  802cae:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  802cb5:	aa aa aa 
+  802cb8:	48 0f af c2          	imul   %rdx,%rax
+  802cbc:	48 c1 e0 0e          	shl    $0xe,%rax
+  802cc0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  802cc4:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802cc7:	41 39 06             	cmp    %eax,(%r14)
+  802cca:	75 0d                	jne    802cd9 <devfile_read+0xfd>
+  802ccc:	8b 43 10             	mov    0x10(%rbx),%eax
+  802ccf:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  802cd3:	0f 84 fb 00 00 00    	je     802dd4 <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  802cd9:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802cde:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802ce2:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  802ce5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802ce9:	48 89 c7             	mov    %rax,%rdi
+  802cec:	48 b8 34 3e 80 00 00 	movabs $0x803e34,%rax
+  802cf3:	00 00 00 
+  802cf6:	ff d0                	call   *%rax
+  802cf8:	84 c0                	test   %al,%al
+  802cfa:	75 27                	jne    802d23 <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802cfc:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802d01:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802d06:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802d0a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d0f:	48 b8 e5 11 80 00 00 	movabs $0x8011e5,%rax
+  802d16:	00 00 00 
+  802d19:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  802d1b:	85 c0                	test   %eax,%eax
+  802d1d:	0f 88 dc 00 00 00    	js     802dff <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  802d23:	44 89 f8             	mov    %r15d,%eax
+  802d26:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802d2b:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  802d2d:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  802d34:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  802d35:	8b 43 10             	mov    0x10(%rbx),%eax
+  802d38:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  802d3c:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  802d3f:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802d44:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802d48:	48 89 df             	mov    %rbx,%rdi
+  802d4b:	48 b8 64 29 80 00 00 	movabs $0x802964,%rax
+  802d52:	00 00 00 
+  802d55:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  802d57:	48 85 c0             	test   %rax,%rax
+  802d5a:	0f 88 f4 fe ff ff    	js     802c54 <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  802d60:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802d63:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  802d66:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  802d69:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  802d6d:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  802d71:	48 63 d1             	movslq %ecx,%rdx
+  802d74:	48 01 d0             	add    %rdx,%rax
+  802d77:	4d 63 ff             	movslq %r15d,%r15
+  802d7a:	4c 29 f8             	sub    %r15,%rax
+  802d7d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d82:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  802d86:	48 85 c0             	test   %rax,%rax
+  802d89:	0f 8e c5 fe ff ff    	jle    802c54 <devfile_read+0x78>
+    n = MIN(n, res);
+  802d8f:	4c 39 e8             	cmp    %r13,%rax
+  802d92:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  802d96:	8b 73 04             	mov    0x4(%rbx),%esi
+  802d99:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  802d9d:	48 63 f6             	movslq %esi,%rsi
+  802da0:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802da5:	48 01 c6             	add    %rax,%rsi
+  802da8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802dac:	48 01 c6             	add    %rax,%rsi
+  802daf:	4c 89 ea             	mov    %r13,%rdx
+  802db2:	4c 89 e7             	mov    %r12,%rdi
+  802db5:	48 b8 e7 0e 80 00 00 	movabs $0x800ee7,%rax
+  802dbc:	00 00 00 
+  802dbf:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  802dc1:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  802dc5:	4c 89 e8             	mov    %r13,%rax
+  802dc8:	e9 87 fe ff ff       	jmp    802c54 <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802dcd:	48 98                	cltq
+  802dcf:	e9 80 fe ff ff       	jmp    802c54 <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  802dd4:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  802dd8:	41 39 d7             	cmp    %edx,%r15d
+  802ddb:	0f 8c f8 fe ff ff    	jl     802cd9 <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  802de1:	49 8b 46 10          	mov    0x10(%r14),%rax
+  802de5:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  802de8:	41 39 cf             	cmp    %ecx,%r15d
+  802deb:	0f 8d e8 fe ff ff    	jge    802cd9 <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  802df1:	4d 63 ff             	movslq %r15d,%r15
+  802df4:	4c 29 f8             	sub    %r15,%rax
+  802df7:	48 63 d2             	movslq %edx,%rdx
+  802dfa:	48 01 d0             	add    %rdx,%rax
+  802dfd:	eb 87                	jmp    802d86 <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802dff:	48 98                	cltq
+  802e01:	e9 4e fe ff ff       	jmp    802c54 <devfile_read+0x78>
+        return E_INVAL;
+  802e06:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802e0b:	c3                   	ret
+
+0000000000802e0c <fs_channel>:
+fs_channel(bool enable) {
+  802e0c:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  802e0e:	a2 04 26 82 00 00 00 	movabs %al,0x822604
+  802e15:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  802e17:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e1c:	40 84 ff             	test   %dil,%dil
+  802e1f:	74 47                	je     802e68 <fs_channel+0x5c>
+  802e21:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  802e28:	00 00 00 
+  802e2b:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  802e31:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  802e38:	00 00 00 
+  802e3b:	3b 08                	cmp    (%rax),%ecx
+  802e3d:	74 29                	je     802e68 <fs_channel+0x5c>
+fs_channel(bool enable) {
+  802e3f:	55                   	push   %rbp
+  802e40:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  802e43:	48 b8 8c 1d 80 00 00 	movabs $0x801d8c,%rax
+  802e4a:	00 00 00 
+  802e4d:	ff d0                	call   *%rax
+  802e4f:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  802e51:	85 c0                	test   %eax,%eax
+  802e53:	78 04                	js     802e59 <fs_channel+0x4d>
+}
+  802e55:	89 d0                	mov    %edx,%eax
+  802e57:	5d                   	pop    %rbp
+  802e58:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  802e59:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  802e60:	00 00 00 
+  802e63:	c6 00 00             	movb   $0x0,(%rax)
+  802e66:	eb ed                	jmp    802e55 <fs_channel+0x49>
+}
+  802e68:	89 d0                	mov    %edx,%eax
+  802e6a:	c3                   	ret
+
+0000000000802e6b <open>:
+open(const char *path, int mode) {
+  802e6b:	55                   	push   %rbp
+  802e6c:	48 89 e5             	mov    %rsp,%rbp
+  802e6f:	41 55                	push   %r13
+  802e71:	41 54                	push   %r12
+  802e73:	53                   	push   %rbx
+  802e74:	48 83 ec 18          	sub    $0x18,%rsp
+  802e78:	49 89 fc             	mov    %rdi,%r12
+  802e7b:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802e7e:	48 b8 48 0c 80 00 00 	movabs $0x800c48,%rax
+  802e85:	00 00 00 
+  802e88:	ff d0                	call   *%rax
+  802e8a:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802e90:	0f 87 8f 00 00 00    	ja     802f25 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802e96:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802e9a:	48 b8 46 16 80 00 00 	movabs $0x801646,%rax
+  802ea1:	00 00 00 
+  802ea4:	ff d0                	call   *%rax
+  802ea6:	89 c3                	mov    %eax,%ebx
+  802ea8:	85 c0                	test   %eax,%eax
+  802eaa:	78 55                	js     802f01 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  802eac:	4c 89 e6             	mov    %r12,%rsi
+  802eaf:	48 bb 00 00 83 00 00 	movabs $0x830000,%rbx
+  802eb6:	00 00 00 
+  802eb9:	48 89 df             	mov    %rbx,%rdi
+  802ebc:	48 b8 86 0c 80 00 00 	movabs $0x800c86,%rax
+  802ec3:	00 00 00 
+  802ec6:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802ec8:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  802ecf:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ed4:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802ed8:	bf 01 00 00 00       	mov    $0x1,%edi
+  802edd:	48 b8 fd 23 80 00 00 	movabs $0x8023fd,%rax
+  802ee4:	00 00 00 
+  802ee7:	ff d0                	call   *%rax
+  802ee9:	89 c3                	mov    %eax,%ebx
+  802eeb:	85 c0                	test   %eax,%eax
+  802eed:	78 1f                	js     802f0e <open+0xa3>
+    return fd2num(fd);
+  802eef:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802ef3:	48 b8 18 16 80 00 00 	movabs $0x801618,%rax
+  802efa:	00 00 00 
+  802efd:	ff d0                	call   *%rax
+  802eff:	89 c3                	mov    %eax,%ebx
+}
+  802f01:	89 d8                	mov    %ebx,%eax
+  802f03:	48 83 c4 18          	add    $0x18,%rsp
+  802f07:	5b                   	pop    %rbx
+  802f08:	41 5c                	pop    %r12
+  802f0a:	41 5d                	pop    %r13
+  802f0c:	5d                   	pop    %rbp
+  802f0d:	c3                   	ret
+        fd_close(fd, 0);
+  802f0e:	be 00 00 00 00       	mov    $0x0,%esi
+  802f13:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802f17:	48 b8 61 17 80 00 00 	movabs $0x801761,%rax
+  802f1e:	00 00 00 
+  802f21:	ff d0                	call   *%rax
+        return res;
+  802f23:	eb dc                	jmp    802f01 <open+0x96>
+        return -E_BAD_PATH;
+  802f25:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802f2a:	eb d5                	jmp    802f01 <open+0x96>
+
+0000000000802f2c <file_flush_buffers>:
+file_flush_buffers(void) {
+  802f2c:	55                   	push   %rbp
+  802f2d:	48 89 e5             	mov    %rsp,%rbp
+  802f30:	41 56                	push   %r14
+  802f32:	41 55                	push   %r13
+  802f34:	41 54                	push   %r12
+  802f36:	53                   	push   %rbx
+  802f37:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  802f3b:	49 bc 08 23 82 00 00 	movabs $0x822308,%r12
+  802f42:	00 00 00 
+  802f45:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  802f4a:	49 bd a6 16 80 00 00 	movabs $0x8016a6,%r13
+  802f51:	00 00 00 
+  802f54:	49 be 66 26 80 00 00 	movabs $0x802666,%r14
+  802f5b:	00 00 00 
+  802f5e:	eb 0c                	jmp    802f6c <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  802f60:	83 c3 01             	add    $0x1,%ebx
+  802f63:	49 83 c4 18          	add    $0x18,%r12
+  802f67:	83 fb 20             	cmp    $0x20,%ebx
+  802f6a:	74 1d                	je     802f89 <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  802f6c:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  802f71:	74 ed                	je     802f60 <file_flush_buffers+0x34>
+  802f73:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802f77:	89 df                	mov    %ebx,%edi
+  802f79:	41 ff d5             	call   *%r13
+  802f7c:	85 c0                	test   %eax,%eax
+  802f7e:	78 e0                	js     802f60 <file_flush_buffers+0x34>
+  802f80:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802f84:	41 ff d6             	call   *%r14
+  802f87:	eb d7                	jmp    802f60 <file_flush_buffers+0x34>
+}
+  802f89:	48 83 c4 10          	add    $0x10,%rsp
+  802f8d:	5b                   	pop    %rbx
+  802f8e:	41 5c                	pop    %r12
+  802f90:	41 5d                	pop    %r13
+  802f92:	41 5e                	pop    %r14
+  802f94:	5d                   	pop    %rbp
+  802f95:	c3                   	ret
+
+0000000000802f96 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802f96:	55                   	push   %rbp
+  802f97:	48 89 e5             	mov    %rsp,%rbp
+  802f9a:	41 54                	push   %r12
+  802f9c:	53                   	push   %rbx
+  802f9d:	49 89 fc             	mov    %rdi,%r12
+  802fa0:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  802fa2:	48 b8 2c 2f 80 00 00 	movabs $0x802f2c,%rax
+  802fa9:	00 00 00 
+  802fac:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802fae:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  802fb5:	00 00 00 
+  802fb8:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  802fbd:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802fbf:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  802fc2:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fc7:	be 00 00 00 00       	mov    $0x0,%esi
+  802fcc:	bf 02 00 00 00       	mov    $0x2,%edi
+  802fd1:	48 b8 fd 23 80 00 00 	movabs $0x8023fd,%rax
+  802fd8:	00 00 00 
+  802fdb:	ff d0                	call   *%rax
+}
+  802fdd:	5b                   	pop    %rbx
+  802fde:	41 5c                	pop    %r12
+  802fe0:	5d                   	pop    %rbp
+  802fe1:	c3                   	ret
+
+0000000000802fe2 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802fe2:	55                   	push   %rbp
+  802fe3:	48 89 e5             	mov    %rsp,%rbp
+  802fe6:	41 54                	push   %r12
+  802fe8:	53                   	push   %rbx
+  802fe9:	49 89 fc             	mov    %rdi,%r12
+  802fec:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  802fef:	48 b8 2c 2f 80 00 00 	movabs $0x802f2c,%rax
+  802ff6:	00 00 00 
+  802ff9:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802ffb:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  803000:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  803007:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  803009:	ba 00 00 00 00       	mov    $0x0,%edx
+  80300e:	be 00 00 00 00       	mov    $0x0,%esi
+  803013:	bf 05 00 00 00       	mov    $0x5,%edi
+  803018:	48 b8 fd 23 80 00 00 	movabs $0x8023fd,%rax
+  80301f:	00 00 00 
+  803022:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803024:	85 c0                	test   %eax,%eax
+  803026:	78 3d                	js     803065 <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803028:	49 bc 00 00 83 00 00 	movabs $0x830000,%r12
+  80302f:	00 00 00 
+  803032:	4c 89 e6             	mov    %r12,%rsi
+  803035:	48 89 df             	mov    %rbx,%rdi
+  803038:	48 b8 86 0c 80 00 00 	movabs $0x800c86,%rax
+  80303f:	00 00 00 
+  803042:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  803044:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  80304b:	00 
+  80304c:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803052:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  803059:	00 
+  80305a:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  803060:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803065:	5b                   	pop    %rbx
+  803066:	41 5c                	pop    %r12
+  803068:	5d                   	pop    %rbp
+  803069:	c3                   	ret
+
+000000000080306a <remove>:
+remove(const char *path) {
+  80306a:	55                   	push   %rbp
+  80306b:	48 89 e5             	mov    %rsp,%rbp
+  80306e:	53                   	push   %rbx
+  80306f:	48 83 ec 08          	sub    $0x8,%rsp
+  803073:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  803076:	48 b8 48 0c 80 00 00 	movabs $0x800c48,%rax
+  80307d:	00 00 00 
+  803080:	ff d0                	call   *%rax
+  803082:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803088:	77 3a                	ja     8030c4 <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  80308a:	48 89 de             	mov    %rbx,%rsi
+  80308d:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  803094:	00 00 00 
+  803097:	48 b8 86 0c 80 00 00 	movabs $0x800c86,%rax
+  80309e:	00 00 00 
+  8030a1:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  8030a3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030a8:	be 00 00 00 00       	mov    $0x0,%esi
+  8030ad:	bf 07 00 00 00       	mov    $0x7,%edi
+  8030b2:	48 b8 fd 23 80 00 00 	movabs $0x8023fd,%rax
+  8030b9:	00 00 00 
+  8030bc:	ff d0                	call   *%rax
+}
+  8030be:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8030c2:	c9                   	leave
+  8030c3:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  8030c4:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8030c9:	eb f3                	jmp    8030be <remove+0x54>
+
+00000000008030cb <sync>:
+sync(void) {
+  8030cb:	55                   	push   %rbp
+  8030cc:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  8030cf:	48 b8 2c 2f 80 00 00 	movabs $0x802f2c,%rax
+  8030d6:	00 00 00 
+  8030d9:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  8030db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8030e5:	bf 08 00 00 00       	mov    $0x8,%edi
+  8030ea:	48 b8 fd 23 80 00 00 	movabs $0x8023fd,%rax
+  8030f1:	00 00 00 
+  8030f4:	ff d0                	call   *%rax
+}
+  8030f6:	5d                   	pop    %rbp
+  8030f7:	c3                   	ret
+
+00000000008030f8 <fsync>:
+fsync(int fdnum) {
+  8030f8:	55                   	push   %rbp
+  8030f9:	48 89 e5             	mov    %rsp,%rbp
+  8030fc:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803100:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803104:	48 b8 a6 16 80 00 00 	movabs $0x8016a6,%rax
+  80310b:	00 00 00 
+  80310e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803110:	85 c0                	test   %eax,%eax
+  803112:	78 4b                	js     80315f <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803114:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803118:	48 b8 20 50 80 00 00 	movabs $0x805020,%rax
+  80311f:	00 00 00 
+  803122:	8b 00                	mov    (%rax),%eax
+  803124:	39 02                	cmp    %eax,(%rdx)
+  803126:	75 39                	jne    803161 <fsync+0x69>
+    file_flush_buffers();
+  803128:	48 b8 2c 2f 80 00 00 	movabs $0x802f2c,%rax
+  80312f:	00 00 00 
+  803132:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  803134:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803138:	8b 40 0c             	mov    0xc(%rax),%eax
+  80313b:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  803142:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  803144:	ba 00 00 00 00       	mov    $0x0,%edx
+  803149:	be 00 00 00 00       	mov    $0x0,%esi
+  80314e:	bf 0d 00 00 00       	mov    $0xd,%edi
+  803153:	48 b8 fd 23 80 00 00 	movabs $0x8023fd,%rax
+  80315a:	00 00 00 
+  80315d:	ff d0                	call   *%rax
+}
+  80315f:	c9                   	leave
+  803160:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803161:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803166:	eb f7                	jmp    80315f <fsync+0x67>
+
+0000000000803168 <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  803168:	55                   	push   %rbp
+  803169:	48 89 e5             	mov    %rsp,%rbp
+  80316c:	53                   	push   %rbx
+  80316d:	48 83 ec 08          	sub    $0x8,%rsp
+  803171:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  803174:	ba 00 00 00 00       	mov    $0x0,%edx
+  803179:	be 00 00 00 00       	mov    $0x0,%esi
+  80317e:	bf 0b 00 00 00       	mov    $0xb,%edi
+  803183:	48 b8 fd 23 80 00 00 	movabs $0x8023fd,%rax
+  80318a:	00 00 00 
+  80318d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80318f:	85 c0                	test   %eax,%eax
+  803191:	78 2d                	js     8031c0 <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  803193:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  80319a:	00 00 00 
+  80319d:	48 8b 10             	mov    (%rax),%rdx
+  8031a0:	48 89 13             	mov    %rdx,(%rbx)
+  8031a3:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8031a7:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  8031ab:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8031af:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  8031b3:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8031b7:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  8031bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8031c0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8031c4:	c9                   	leave
+  8031c5:	c3                   	ret
+
+00000000008031c6 <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  8031c6:	55                   	push   %rbp
+  8031c7:	48 89 e5             	mov    %rsp,%rbp
+  8031ca:	53                   	push   %rbx
+  8031cb:	48 83 ec 08          	sub    $0x8,%rsp
+  8031cf:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  8031d2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031d7:	be 00 00 00 00       	mov    $0x0,%esi
+  8031dc:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8031e1:	48 b8 fd 23 80 00 00 	movabs $0x8023fd,%rax
+  8031e8:	00 00 00 
+  8031eb:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8031ed:	85 c0                	test   %eax,%eax
+  8031ef:	78 3d                	js     80322e <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  8031f1:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  8031f8:	00 00 00 
+  8031fb:	48 8b 10             	mov    (%rax),%rdx
+  8031fe:	48 89 13             	mov    %rdx,(%rbx)
+  803201:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  803205:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  803209:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80320d:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  803211:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  803215:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  803219:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  80321d:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  803221:	48 8b 40 28          	mov    0x28(%rax),%rax
+  803225:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  803229:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80322e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803232:	c9                   	leave
+  803233:	c3                   	ret
+
+0000000000803234 <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  803234:	55                   	push   %rbp
+  803235:	48 89 e5             	mov    %rsp,%rbp
+  803238:	41 57                	push   %r15
+  80323a:	41 56                	push   %r14
+  80323c:	41 55                	push   %r13
+  80323e:	41 54                	push   %r12
+  803240:	53                   	push   %rbx
+  803241:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  803245:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  80324c:	00 
+  80324d:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  803254:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  80325a:	0f 85 43 01 00 00    	jne    8033a3 <munmap+0x16f>
+  803260:	49 89 ff             	mov    %rdi,%r15
+  803263:	4c 39 f7             	cmp    %r14,%rdi
+  803266:	0f 87 37 01 00 00    	ja     8033a3 <munmap+0x16f>
+  80326c:	48 bb 00 20 82 00 00 	movabs $0x822000,%rbx
+  803273:	00 00 00 
+  803276:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  80327c:	eb 2c                	jmp    8032aa <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  80327e:	4c 39 f8             	cmp    %r15,%rax
+  803281:	0f 83 85 00 00 00    	jae    80330c <munmap+0xd8>
+            m->mm_end = start;
+  803287:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80328c:	48 83 c3 18          	add    $0x18,%rbx
+  803290:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  803297:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  80329e:	00 00 00 
+  8032a1:	48 39 c3             	cmp    %rax,%rbx
+  8032a4:	0f 84 d0 00 00 00    	je     80337a <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  8032aa:	49 89 dc             	mov    %rbx,%r12
+  8032ad:	48 8b 03             	mov    (%rbx),%rax
+  8032b0:	4c 39 f0             	cmp    %r14,%rax
+  8032b3:	73 d7                	jae    80328c <munmap+0x58>
+  8032b5:	48 85 c0             	test   %rax,%rax
+  8032b8:	74 d2                	je     80328c <munmap+0x58>
+  8032ba:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8032be:	49 39 d7             	cmp    %rdx,%r15
+  8032c1:	73 c9                	jae    80328c <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  8032c3:	49 39 d6             	cmp    %rdx,%r14
+  8032c6:	73 b6                	jae    80327e <munmap+0x4a>
+  8032c8:	49 39 c7             	cmp    %rax,%r15
+  8032cb:	76 b1                	jbe    80327e <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  8032cd:	4c 89 ef             	mov    %r13,%rdi
+  8032d0:	48 b8 6b 23 80 00 00 	movabs $0x80236b,%rax
+  8032d7:	00 00 00 
+  8032da:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  8032dc:	48 85 c0             	test   %rax,%rax
+  8032df:	0f 84 c5 00 00 00    	je     8033aa <munmap+0x176>
+            *tail = *m;
+  8032e5:	48 8b 13             	mov    (%rbx),%rdx
+  8032e8:	48 89 10             	mov    %rdx,(%rax)
+  8032eb:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8032ef:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  8032f3:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  8032f7:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  8032fb:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  8032fe:	44 89 f2             	mov    %r14d,%edx
+  803301:	2b 13                	sub    (%rbx),%edx
+  803303:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  803306:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  80330a:	eb 80                	jmp    80328c <munmap+0x58>
+        } else if (m->mm_end > end) {
+  80330c:	49 39 d6             	cmp    %rdx,%r14
+  80330f:	73 18                	jae    803329 <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  803311:	44 89 f2             	mov    %r14d,%edx
+  803314:	41 03 54 24 10       	add    0x10(%r12),%edx
+  803319:	29 c2                	sub    %eax,%edx
+  80331b:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  803320:	4d 89 34 24          	mov    %r14,(%r12)
+  803324:	e9 63 ff ff ff       	jmp    80328c <munmap+0x58>
+    m->mm_start = 0;
+  803329:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  803330:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  803331:	4c 89 e6             	mov    %r12,%rsi
+  803334:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  80333b:	00 00 00 
+  80333e:	48 29 c6             	sub    %rax,%rsi
+  803341:	48 c1 fe 03          	sar    $0x3,%rsi
+  803345:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  80334c:	aa aa aa 
+  80334f:	48 0f af f0          	imul   %rax,%rsi
+  803353:	48 c1 e6 0c          	shl    $0xc,%rsi
+  803357:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  80335c:	48 01 c6             	add    %rax,%rsi
+  80335f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803364:	bf 00 00 00 00       	mov    $0x0,%edi
+  803369:	48 b8 8b 12 80 00 00 	movabs $0x80128b,%rax
+  803370:	00 00 00 
+  803373:	ff d0                	call   *%rax
+}
+  803375:	e9 12 ff ff ff       	jmp    80328c <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  80337a:	4c 89 f2             	mov    %r14,%rdx
+  80337d:	4c 29 fa             	sub    %r15,%rdx
+  803380:	4c 89 fe             	mov    %r15,%rsi
+  803383:	bf 00 00 00 00       	mov    $0x0,%edi
+  803388:	48 b8 8b 12 80 00 00 	movabs $0x80128b,%rax
+  80338f:	00 00 00 
+  803392:	ff d0                	call   *%rax
+}
+  803394:	48 83 c4 08          	add    $0x8,%rsp
+  803398:	5b                   	pop    %rbx
+  803399:	41 5c                	pop    %r12
+  80339b:	41 5d                	pop    %r13
+  80339d:	41 5e                	pop    %r14
+  80339f:	41 5f                	pop    %r15
+  8033a1:	5d                   	pop    %rbp
+  8033a2:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  8033a3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8033a8:	eb ea                	jmp    803394 <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  8033aa:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  8033af:	eb e3                	jmp    803394 <munmap+0x160>
+
+00000000008033b1 <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  8033b1:	55                   	push   %rbp
+  8033b2:	48 89 e5             	mov    %rsp,%rbp
+  8033b5:	41 57                	push   %r15
+  8033b7:	41 56                	push   %r14
+  8033b9:	41 55                	push   %r13
+  8033bb:	41 54                	push   %r12
+  8033bd:	53                   	push   %rbx
+  8033be:	48 83 ec 28          	sub    $0x28,%rsp
+  8033c2:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8033c6:	49 89 f5             	mov    %rsi,%r13
+  8033c9:	41 89 d6             	mov    %edx,%r14d
+  8033cc:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  8033cf:	41 89 cc             	mov    %ecx,%r12d
+  8033d2:	44 89 c7             	mov    %r8d,%edi
+  8033d5:	44 89 cb             	mov    %r9d,%ebx
+  8033d8:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8033dc:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8033e0:	48 b8 a6 16 80 00 00 	movabs $0x8016a6,%rax
+  8033e7:	00 00 00 
+  8033ea:	ff d0                	call   *%rax
+  8033ec:	41 89 c7             	mov    %eax,%r15d
+  8033ef:	85 c0                	test   %eax,%eax
+  8033f1:	0f 88 ae 01 00 00    	js     8035a5 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8033f7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8033fb:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  803402:	00 00 00 
+  803405:	8b 32                	mov    (%rdx),%esi
+  803407:	39 30                	cmp    %esi,(%rax)
+  803409:	0f 85 7a 02 00 00    	jne    803689 <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  80340f:	8b 40 08             	mov    0x8(%rax),%eax
+  803412:	83 e0 03             	and    $0x3,%eax
+  803415:	83 f8 01             	cmp    $0x1,%eax
+  803418:	0f 84 76 02 00 00    	je     803694 <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  80341e:	4d 85 ed             	test   %r13,%r13
+  803421:	0f 84 78 02 00 00    	je     80369f <mmap+0x2ee>
+  803427:	85 db                	test   %ebx,%ebx
+  803429:	0f 88 70 02 00 00    	js     80369f <mmap+0x2ee>
+  80342f:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  803435:	41 89 df             	mov    %ebx,%r15d
+  803438:	0f 85 6c 02 00 00    	jne    8036aa <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  80343e:	44 89 f0             	mov    %r14d,%eax
+  803441:	83 e0 fd             	and    $0xfffffffd,%eax
+  803444:	83 f8 04             	cmp    $0x4,%eax
+  803447:	0f 85 68 02 00 00    	jne    8036b5 <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  80344d:	44 89 e1             	mov    %r12d,%ecx
+  803450:	83 e1 01             	and    $0x1,%ecx
+  803453:	0f 95 c2             	setne  %dl
+  803456:	44 89 e0             	mov    %r12d,%eax
+  803459:	d1 e8                	shr    %eax
+  80345b:	83 f0 01             	xor    $0x1,%eax
+  80345e:	83 e0 01             	and    $0x1,%eax
+  803461:	38 c2                	cmp    %al,%dl
+  803463:	0f 85 57 02 00 00    	jne    8036c0 <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  803469:	85 c9                	test   %ecx,%ecx
+  80346b:	74 0a                	je     803477 <mmap+0xc6>
+  80346d:	41 f6 c6 02          	test   $0x2,%r14b
+  803471:	0f 85 54 02 00 00    	jne    8036cb <mmap+0x31a>
+    file_flush_buffers();
+  803477:	48 b8 2c 2f 80 00 00 	movabs $0x802f2c,%rax
+  80347e:	00 00 00 
+  803481:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  803483:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  80348a:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  803491:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803495:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  803498:	41 f6 c4 04          	test   $0x4,%r12b
+  80349c:	0f 84 15 01 00 00    	je     8035b7 <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  8034a2:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  8034a5:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8034ab:	0f 85 25 02 00 00    	jne    8036d6 <mmap+0x325>
+  8034b1:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  8034b5:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  8034bc:	00 00 00 
+  8034bf:	48 39 c2             	cmp    %rax,%rdx
+  8034c2:	0f 82 19 02 00 00    	jb     8036e1 <mmap+0x330>
+  8034c8:	48 39 c7             	cmp    %rax,%rdi
+  8034cb:	0f 87 10 02 00 00    	ja     8036e1 <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  8034d1:	4c 89 ee             	mov    %r13,%rsi
+  8034d4:	48 b8 34 32 80 00 00 	movabs $0x803234,%rax
+  8034db:	00 00 00 
+  8034de:	ff d0                	call   *%rax
+  8034e0:	85 c0                	test   %eax,%eax
+  8034e2:	0f 88 04 02 00 00    	js     8036ec <mmap+0x33b>
+    if (!handler) {
+  8034e8:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  8034ef:	00 00 00 
+  8034f2:	80 38 00             	cmpb   $0x0,(%rax)
+  8034f5:	75 2b                	jne    803522 <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  8034f7:	48 bf cc 22 80 00 00 	movabs $0x8022cc,%rdi
+  8034fe:	00 00 00 
+  803501:	48 b8 8d 43 80 00 00 	movabs $0x80438d,%rax
+  803508:	00 00 00 
+  80350b:	ff d0                	call   *%rax
+  80350d:	85 c0                	test   %eax,%eax
+  80350f:	0f 88 ea 01 00 00    	js     8036ff <mmap+0x34e>
+        handler = 1;
+  803515:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  80351c:	00 00 00 
+  80351f:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  803522:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803526:	48 b8 6b 23 80 00 00 	movabs $0x80236b,%rax
+  80352d:	00 00 00 
+  803530:	ff d0                	call   *%rax
+  803532:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  803535:	48 85 c0             	test   %rax,%rax
+  803538:	0f 84 c9 01 00 00    	je     803707 <mmap+0x356>
+    m->mm_start = va;
+  80353e:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  803541:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  803545:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  803549:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  80354c:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  803550:	44 89 e0             	mov    %r12d,%eax
+  803553:	c1 e0 06             	shl    $0x6,%eax
+  803556:	25 80 00 00 00       	and    $0x80,%eax
+  80355b:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  80355e:	09 f0                	or     %esi,%eax
+  803560:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  803564:	41 f6 c4 08          	test   $0x8,%r12b
+  803568:	74 31                	je     80359b <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  80356a:	48 39 d3             	cmp    %rdx,%rbx
+  80356d:	73 2c                	jae    80359b <mmap+0x1ea>
+  80356f:	ba 00 00 04 00       	mov    $0x40000,%edx
+  803574:	48 89 de             	mov    %rbx,%rsi
+  803577:	4c 89 f7             	mov    %r14,%rdi
+  80357a:	48 b8 bb 21 80 00 00 	movabs $0x8021bb,%rax
+  803581:	00 00 00 
+  803584:	ff d0                	call   *%rax
+  803586:	49 89 c4             	mov    %rax,%r12
+  803589:	48 85 c0             	test   %rax,%rax
+  80358c:	0f 8e d7 00 00 00    	jle    803669 <mmap+0x2b8>
+            va += n;
+  803592:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  803595:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  803599:	72 d4                	jb     80356f <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  80359b:	49 8b 06             	mov    (%r14),%rax
+  80359e:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  8035a2:	48 89 06             	mov    %rax,(%rsi)
+}
+  8035a5:	44 89 f8             	mov    %r15d,%eax
+  8035a8:	48 83 c4 28          	add    $0x28,%rsp
+  8035ac:	5b                   	pop    %rbx
+  8035ad:	41 5c                	pop    %r12
+  8035af:	41 5d                	pop    %r13
+  8035b1:	41 5e                	pop    %r14
+  8035b3:	41 5f                	pop    %r15
+  8035b5:	5d                   	pop    %rbp
+  8035b6:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8035b7:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  8035be:	00 00 00 
+  8035c1:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  8035c4:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  8035cb:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8035ce:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  8035d3:	48 be 00 20 82 00 00 	movabs $0x822000,%rsi
+  8035da:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8035dd:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  8035e4:	00 00 00 
+  8035e7:	48 39 d7             	cmp    %rdx,%rdi
+  8035ea:	73 1c                	jae    803608 <mmap+0x257>
+        return -E_NO_MEM;
+  8035ec:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8035f2:	eb b1                	jmp    8035a5 <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8035f4:	48 83 c0 01          	add    $0x1,%rax
+  8035f8:	48 83 f8 1f          	cmp    $0x1f,%rax
+  8035fc:	77 3f                	ja     80363d <mmap+0x28c>
+  8035fe:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  803603:	48 39 d7             	cmp    %rdx,%rdi
+  803606:	72 2a                	jb     803632 <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  803608:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  80360c:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  803610:	48 39 d1             	cmp    %rdx,%rcx
+  803613:	73 df                	jae    8035f4 <mmap+0x243>
+  803615:	48 85 c9             	test   %rcx,%rcx
+  803618:	74 da                	je     8035f4 <mmap+0x243>
+  80361a:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  80361e:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  803623:	48 39 d3             	cmp    %rdx,%rbx
+  803626:	73 cc                	jae    8035f4 <mmap+0x243>
+            va = mmaps[i].mm_end;
+  803628:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80362b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803630:	eb cc                	jmp    8035fe <mmap+0x24d>
+        return -E_NO_MEM;
+  803632:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803638:	e9 68 ff ff ff       	jmp    8035a5 <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  80363d:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  803642:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  803649:	00 00 00 
+  80364c:	48 39 c2             	cmp    %rax,%rdx
+  80364f:	0f 82 9f 00 00 00    	jb     8036f4 <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  803655:	48 85 db             	test   %rbx,%rbx
+  803658:	0f 85 8a fe ff ff    	jne    8034e8 <mmap+0x137>
+        return -E_NO_MEM;
+  80365e:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803664:	e9 3c ff ff ff       	jmp    8035a5 <mmap+0x1f4>
+        if (n < 0) {
+  803669:	0f 89 2c ff ff ff    	jns    80359b <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  80366f:	49 8b 3e             	mov    (%r14),%rdi
+  803672:	4c 89 ee             	mov    %r13,%rsi
+  803675:	48 b8 34 32 80 00 00 	movabs $0x803234,%rax
+  80367c:	00 00 00 
+  80367f:	ff d0                	call   *%rax
+            return n;
+  803681:	45 89 e7             	mov    %r12d,%r15d
+  803684:	e9 1c ff ff ff       	jmp    8035a5 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803689:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80368f:	e9 11 ff ff ff       	jmp    8035a5 <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  803694:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80369a:	e9 06 ff ff ff       	jmp    8035a5 <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  80369f:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8036a5:	e9 fb fe ff ff       	jmp    8035a5 <mmap+0x1f4>
+  8036aa:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8036b0:	e9 f0 fe ff ff       	jmp    8035a5 <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  8036b5:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8036bb:	e9 e5 fe ff ff       	jmp    8035a5 <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  8036c0:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8036c6:	e9 da fe ff ff       	jmp    8035a5 <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  8036cb:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  8036d1:	e9 cf fe ff ff       	jmp    8035a5 <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  8036d6:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8036dc:	e9 c4 fe ff ff       	jmp    8035a5 <mmap+0x1f4>
+  8036e1:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8036e7:	e9 b9 fe ff ff       	jmp    8035a5 <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  8036ec:	41 89 c7             	mov    %eax,%r15d
+  8036ef:	e9 b1 fe ff ff       	jmp    8035a5 <mmap+0x1f4>
+        return -E_NO_MEM;
+  8036f4:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8036fa:	e9 a6 fe ff ff       	jmp    8035a5 <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  8036ff:	41 89 c7             	mov    %eax,%r15d
+  803702:	e9 9e fe ff ff       	jmp    8035a5 <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  803707:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80370d:	e9 93 fe ff ff       	jmp    8035a5 <mmap+0x1f4>
+
+0000000000803712 <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803712:	55                   	push   %rbp
+  803713:	48 89 e5             	mov    %rsp,%rbp
+  803716:	41 54                	push   %r12
+  803718:	53                   	push   %rbx
+  803719:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80371c:	48 b8 2a 16 80 00 00 	movabs $0x80162a,%rax
+  803723:	00 00 00 
+  803726:	ff d0                	call   *%rax
+  803728:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80372b:	48 be a0 4e 80 00 00 	movabs $0x804ea0,%rsi
+  803732:	00 00 00 
+  803735:	48 89 df             	mov    %rbx,%rdi
+  803738:	48 b8 86 0c 80 00 00 	movabs $0x800c86,%rax
+  80373f:	00 00 00 
+  803742:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803744:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803749:	41 2b 04 24          	sub    (%r12),%eax
+  80374d:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803753:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80375a:	00 00 00 
+    stat->st_dev = &devpipe;
+  80375d:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  803764:	00 00 00 
+  803767:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80376e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803773:	5b                   	pop    %rbx
+  803774:	41 5c                	pop    %r12
+  803776:	5d                   	pop    %rbp
+  803777:	c3                   	ret
+
+0000000000803778 <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  803778:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  80377b:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  803781:	8b 17                	mov    (%rdi),%edx
+  803783:	85 d2                	test   %edx,%edx
+  803785:	75 01                	jne    803788 <pipe_wakeup+0x10>
+  803787:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  803788:	55                   	push   %rbp
+  803789:	48 89 e5             	mov    %rsp,%rbp
+  80378c:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  80378f:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  803795:	be 00 04 00 00       	mov    $0x400,%esi
+  80379a:	48 b8 71 15 80 00 00 	movabs $0x801571,%rax
+  8037a1:	00 00 00 
+  8037a4:	ff d0                	call   *%rax
+}
+  8037a6:	5d                   	pop    %rbp
+  8037a7:	c3                   	ret
+
+00000000008037a8 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8037a8:	55                   	push   %rbp
+  8037a9:	48 89 e5             	mov    %rsp,%rbp
+  8037ac:	41 55                	push   %r13
+  8037ae:	41 54                	push   %r12
+  8037b0:	53                   	push   %rbx
+  8037b1:	48 83 ec 08          	sub    $0x8,%rsp
+  8037b5:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8037b8:	48 b8 2a 16 80 00 00 	movabs $0x80162a,%rax
+  8037bf:	00 00 00 
+  8037c2:	ff d0                	call   *%rax
+  8037c4:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8037c7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8037cc:	4c 89 e6             	mov    %r12,%rsi
+  8037cf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037d4:	49 bc 8b 12 80 00 00 	movabs $0x80128b,%r12
+  8037db:	00 00 00 
+  8037de:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8037e1:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  8037e5:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  8037e9:	49 bd 78 37 80 00 00 	movabs $0x803778,%r13
+  8037f0:	00 00 00 
+  8037f3:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  8037f6:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  8037fa:	48 89 de             	mov    %rbx,%rsi
+  8037fd:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  803800:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803805:	48 89 de             	mov    %rbx,%rsi
+  803808:	bf 00 00 00 00       	mov    $0x0,%edi
+  80380d:	41 ff d4             	call   *%r12
+  803810:	48 83 c4 08          	add    $0x8,%rsp
+  803814:	5b                   	pop    %rbx
+  803815:	41 5c                	pop    %r12
+  803817:	41 5d                	pop    %r13
+  803819:	5d                   	pop    %rbp
+  80381a:	c3                   	ret
+
+000000000080381b <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  80381b:	55                   	push   %rbp
+  80381c:	48 89 e5             	mov    %rsp,%rbp
+  80381f:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803822:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803827:	be 00 10 00 00       	mov    $0x1000,%esi
+  80382c:	48 b8 ce 11 80 00 00 	movabs $0x8011ce,%rax
+  803833:	00 00 00 
+  803836:	ff d0                	call   *%rax
+  803838:	85 c0                	test   %eax,%eax
+  80383a:	0f 94 c0             	sete   %al
+  80383d:	0f b6 c0             	movzbl %al,%eax
+}
+  803840:	5d                   	pop    %rbp
+  803841:	c3                   	ret
+
+0000000000803842 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803842:	55                   	push   %rbp
+  803843:	48 89 e5             	mov    %rsp,%rbp
+  803846:	41 57                	push   %r15
+  803848:	41 56                	push   %r14
+  80384a:	41 55                	push   %r13
+  80384c:	41 54                	push   %r12
+  80384e:	53                   	push   %rbx
+  80384f:	48 83 ec 38          	sub    $0x38,%rsp
+  803853:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803857:	49 89 f4             	mov    %rsi,%r12
+  80385a:	49 89 d7             	mov    %rdx,%r15
+  80385d:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803861:	48 b8 2a 16 80 00 00 	movabs $0x80162a,%rax
+  803868:	00 00 00 
+  80386b:	ff d0                	call   *%rax
+  80386d:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803870:	4d 85 ff             	test   %r15,%r15
+  803873:	0f 84 f1 00 00 00    	je     80396a <devpipe_write+0x128>
+  803879:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  80387d:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  803881:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  803885:	49 bd 1b 38 80 00 00 	movabs $0x80381b,%r13
+  80388c:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  80388f:	49 bf 78 37 80 00 00 	movabs $0x803778,%r15
+  803896:	00 00 00 
+  803899:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  80389d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8038a1:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8038a5:	8b 73 04             	mov    0x4(%rbx),%esi
+  8038a8:	48 63 ce             	movslq %esi,%rcx
+  8038ab:	48 63 03             	movslq (%rbx),%rax
+  8038ae:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  8038b4:	48 39 c1             	cmp    %rax,%rcx
+  8038b7:	72 64                	jb     80391d <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  8038b9:	48 89 de             	mov    %rbx,%rsi
+  8038bc:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8038c0:	41 ff d5             	call   *%r13
+  8038c3:	85 c0                	test   %eax,%eax
+  8038c5:	0f 85 b9 00 00 00    	jne    803984 <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8038cb:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8038cf:	4c 89 f7             	mov    %r14,%rdi
+  8038d2:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  8038d5:	8b 43 04             	mov    0x4(%rbx),%eax
+  8038d8:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  8038df:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8038e6:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  8038ec:	8b 03                	mov    (%rbx),%eax
+  8038ee:	41 39 c4             	cmp    %eax,%r12d
+  8038f1:	75 b2                	jne    8038a5 <devpipe_write+0x63>
+  8038f3:	48 89 de             	mov    %rbx,%rsi
+  8038f6:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8038fa:	41 ff d5             	call   *%r13
+  8038fd:	85 c0                	test   %eax,%eax
+  8038ff:	75 a0                	jne    8038a1 <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803901:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803906:	44 89 e6             	mov    %r12d,%esi
+  803909:	48 89 df             	mov    %rbx,%rdi
+  80390c:	48 b8 53 15 80 00 00 	movabs $0x801553,%rax
+  803913:	00 00 00 
+  803916:	ff d0                	call   *%rax
+  803918:	e9 7c ff ff ff       	jmp    803899 <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80391d:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  803921:	41 0f b6 38          	movzbl (%r8),%edi
+  803925:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  80392c:	80 80 80 
+  80392f:	48 89 c8             	mov    %rcx,%rax
+  803932:	48 f7 e2             	mul    %rdx
+  803935:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803939:	48 89 d0             	mov    %rdx,%rax
+  80393c:	48 c1 e0 08          	shl    $0x8,%rax
+  803940:	48 29 d0             	sub    %rdx,%rax
+  803943:	48 c1 e0 04          	shl    $0x4,%rax
+  803947:	48 29 c1             	sub    %rax,%rcx
+  80394a:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  80394f:	83 c6 01             	add    $0x1,%esi
+  803952:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803955:	49 83 c0 01          	add    $0x1,%r8
+  803959:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  80395d:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803961:	49 39 c0             	cmp    %rax,%r8
+  803964:	0f 85 2f ff ff ff    	jne    803899 <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  80396a:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  80396e:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803972:	48 b8 78 37 80 00 00 	movabs $0x803778,%rax
+  803979:	00 00 00 
+  80397c:	ff d0                	call   *%rax
+    return n;
+  80397e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803982:	eb 05                	jmp    803989 <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  803984:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803989:	48 83 c4 38          	add    $0x38,%rsp
+  80398d:	5b                   	pop    %rbx
+  80398e:	41 5c                	pop    %r12
+  803990:	41 5d                	pop    %r13
+  803992:	41 5e                	pop    %r14
+  803994:	41 5f                	pop    %r15
+  803996:	5d                   	pop    %rbp
+  803997:	c3                   	ret
+
+0000000000803998 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803998:	55                   	push   %rbp
+  803999:	48 89 e5             	mov    %rsp,%rbp
+  80399c:	41 57                	push   %r15
+  80399e:	41 56                	push   %r14
+  8039a0:	41 55                	push   %r13
+  8039a2:	41 54                	push   %r12
+  8039a4:	53                   	push   %rbx
+  8039a5:	48 83 ec 28          	sub    $0x28,%rsp
+  8039a9:	49 89 fd             	mov    %rdi,%r13
+  8039ac:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  8039b0:	49 89 d4             	mov    %rdx,%r12
+  8039b3:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8039b7:	48 b8 2a 16 80 00 00 	movabs $0x80162a,%rax
+  8039be:	00 00 00 
+  8039c1:	ff d0                	call   *%rax
+  8039c3:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8039c6:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  8039cc:	49 bf 1b 38 80 00 00 	movabs $0x80381b,%r15
+  8039d3:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8039d6:	4d 85 e4             	test   %r12,%r12
+  8039d9:	0f 84 d5 00 00 00    	je     803ab4 <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  8039df:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  8039e3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8039e7:	8b 03                	mov    (%rbx),%eax
+  8039e9:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8039ec:	75 7a                	jne    803a68 <devpipe_read+0xd0>
+            if (i > 0) {
+  8039ee:	4d 85 f6             	test   %r14,%r14
+  8039f1:	75 50                	jne    803a43 <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  8039f3:	48 89 de             	mov    %rbx,%rsi
+  8039f6:	4c 89 ef             	mov    %r13,%rdi
+  8039f9:	41 ff d7             	call   *%r15
+  8039fc:	85 c0                	test   %eax,%eax
+  8039fe:	0f 85 c9 00 00 00    	jne    803acd <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803a04:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  803a07:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803a0e:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803a14:	8b 43 04             	mov    0x4(%rbx),%eax
+  803a17:	41 39 c4             	cmp    %eax,%r12d
+  803a1a:	75 cb                	jne    8039e7 <devpipe_read+0x4f>
+  803a1c:	48 89 de             	mov    %rbx,%rsi
+  803a1f:	4c 89 ef             	mov    %r13,%rdi
+  803a22:	41 ff d7             	call   *%r15
+  803a25:	85 c0                	test   %eax,%eax
+  803a27:	75 be                	jne    8039e7 <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803a29:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803a2e:	44 89 e6             	mov    %r12d,%esi
+  803a31:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803a35:	48 b8 53 15 80 00 00 	movabs $0x801553,%rax
+  803a3c:	00 00 00 
+  803a3f:	ff d0                	call   *%rax
+  803a41:	eb a4                	jmp    8039e7 <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803a43:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803a47:	48 89 de             	mov    %rbx,%rsi
+  803a4a:	48 b8 78 37 80 00 00 	movabs $0x803778,%rax
+  803a51:	00 00 00 
+  803a54:	ff d0                	call   *%rax
+                return i;
+  803a56:	4c 89 f0             	mov    %r14,%rax
+}
+  803a59:	48 83 c4 28          	add    $0x28,%rsp
+  803a5d:	5b                   	pop    %rbx
+  803a5e:	41 5c                	pop    %r12
+  803a60:	41 5d                	pop    %r13
+  803a62:	41 5e                	pop    %r14
+  803a64:	41 5f                	pop    %r15
+  803a66:	5d                   	pop    %rbp
+  803a67:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803a68:	48 63 c8             	movslq %eax,%rcx
+  803a6b:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803a72:	80 80 80 
+  803a75:	48 89 c8             	mov    %rcx,%rax
+  803a78:	48 f7 e2             	mul    %rdx
+  803a7b:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803a7f:	48 89 d0             	mov    %rdx,%rax
+  803a82:	48 c1 e0 08          	shl    $0x8,%rax
+  803a86:	48 29 d0             	sub    %rdx,%rax
+  803a89:	48 c1 e0 04          	shl    $0x4,%rax
+  803a8d:	48 89 c2             	mov    %rax,%rdx
+  803a90:	48 89 c8             	mov    %rcx,%rax
+  803a93:	48 29 d0             	sub    %rdx,%rax
+  803a96:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  803a9b:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803a9f:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  803aa3:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803aa6:	49 83 c6 01          	add    $0x1,%r14
+  803aaa:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  803aae:	0f 85 2b ff ff ff    	jne    8039df <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803ab4:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803ab8:	48 89 de             	mov    %rbx,%rsi
+  803abb:	48 b8 78 37 80 00 00 	movabs $0x803778,%rax
+  803ac2:	00 00 00 
+  803ac5:	ff d0                	call   *%rax
+    return n;
+  803ac7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803acb:	eb 8c                	jmp    803a59 <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  803acd:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ad2:	eb 85                	jmp    803a59 <devpipe_read+0xc1>
+
+0000000000803ad4 <pipe>:
+pipe(int pfd[2]) {
+  803ad4:	55                   	push   %rbp
+  803ad5:	48 89 e5             	mov    %rsp,%rbp
+  803ad8:	41 55                	push   %r13
+  803ada:	41 54                	push   %r12
+  803adc:	53                   	push   %rbx
+  803add:	48 83 ec 18          	sub    $0x18,%rsp
+  803ae1:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803ae4:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803ae8:	48 b8 46 16 80 00 00 	movabs $0x801646,%rax
+  803aef:	00 00 00 
+  803af2:	ff d0                	call   *%rax
+  803af4:	89 c3                	mov    %eax,%ebx
+  803af6:	85 c0                	test   %eax,%eax
+  803af8:	0f 88 a0 01 00 00    	js     803c9e <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803afe:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803b03:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b08:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803b0c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b11:	48 b8 e5 11 80 00 00 	movabs $0x8011e5,%rax
+  803b18:	00 00 00 
+  803b1b:	ff d0                	call   *%rax
+  803b1d:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803b1f:	85 c0                	test   %eax,%eax
+  803b21:	0f 88 77 01 00 00    	js     803c9e <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803b27:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803b2b:	48 b8 46 16 80 00 00 	movabs $0x801646,%rax
+  803b32:	00 00 00 
+  803b35:	ff d0                	call   *%rax
+  803b37:	89 c3                	mov    %eax,%ebx
+  803b39:	85 c0                	test   %eax,%eax
+  803b3b:	0f 88 43 01 00 00    	js     803c84 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803b41:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803b46:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b4b:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803b4f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b54:	48 b8 e5 11 80 00 00 	movabs $0x8011e5,%rax
+  803b5b:	00 00 00 
+  803b5e:	ff d0                	call   *%rax
+  803b60:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803b62:	85 c0                	test   %eax,%eax
+  803b64:	0f 88 1a 01 00 00    	js     803c84 <pipe+0x1b0>
+    va = fd2data(fd0);
+  803b6a:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803b6e:	48 b8 2a 16 80 00 00 	movabs $0x80162a,%rax
+  803b75:	00 00 00 
+  803b78:	ff d0                	call   *%rax
+  803b7a:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803b7d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803b82:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b87:	48 89 c6             	mov    %rax,%rsi
+  803b8a:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b8f:	48 b8 e5 11 80 00 00 	movabs $0x8011e5,%rax
+  803b96:	00 00 00 
+  803b99:	ff d0                	call   *%rax
+  803b9b:	89 c3                	mov    %eax,%ebx
+  803b9d:	85 c0                	test   %eax,%eax
+  803b9f:	0f 88 c5 00 00 00    	js     803c6a <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803ba5:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803ba9:	48 b8 2a 16 80 00 00 	movabs $0x80162a,%rax
+  803bb0:	00 00 00 
+  803bb3:	ff d0                	call   *%rax
+  803bb5:	48 89 c1             	mov    %rax,%rcx
+  803bb8:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803bbe:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803bc4:	ba 00 00 00 00       	mov    $0x0,%edx
+  803bc9:	4c 89 ee             	mov    %r13,%rsi
+  803bcc:	bf 00 00 00 00       	mov    $0x0,%edi
+  803bd1:	48 b8 3b 12 80 00 00 	movabs $0x80123b,%rax
+  803bd8:	00 00 00 
+  803bdb:	ff d0                	call   *%rax
+  803bdd:	89 c3                	mov    %eax,%ebx
+  803bdf:	85 c0                	test   %eax,%eax
+  803be1:	78 6e                	js     803c51 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803be3:	be 00 10 00 00       	mov    $0x1000,%esi
+  803be8:	4c 89 ef             	mov    %r13,%rdi
+  803beb:	48 b8 aa 11 80 00 00 	movabs $0x8011aa,%rax
+  803bf2:	00 00 00 
+  803bf5:	ff d0                	call   *%rax
+  803bf7:	83 f8 02             	cmp    $0x2,%eax
+  803bfa:	0f 85 ab 00 00 00    	jne    803cab <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803c00:	a1 60 50 80 00 00 00 	movabs 0x805060,%eax
+  803c07:	00 00 
+  803c09:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803c0d:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803c0f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803c13:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803c1a:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803c1e:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803c20:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803c24:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803c2b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803c2f:	48 bb 18 16 80 00 00 	movabs $0x801618,%rbx
+  803c36:	00 00 00 
+  803c39:	ff d3                	call   *%rbx
+  803c3b:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803c3f:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803c43:	ff d3                	call   *%rbx
+  803c45:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803c4a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803c4f:	eb 4d                	jmp    803c9e <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803c51:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c56:	4c 89 ee             	mov    %r13,%rsi
+  803c59:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c5e:	48 b8 8b 12 80 00 00 	movabs $0x80128b,%rax
+  803c65:	00 00 00 
+  803c68:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803c6a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c6f:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803c73:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c78:	48 b8 8b 12 80 00 00 	movabs $0x80128b,%rax
+  803c7f:	00 00 00 
+  803c82:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803c84:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c89:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803c8d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c92:	48 b8 8b 12 80 00 00 	movabs $0x80128b,%rax
+  803c99:	00 00 00 
+  803c9c:	ff d0                	call   *%rax
+}
+  803c9e:	89 d8                	mov    %ebx,%eax
+  803ca0:	48 83 c4 18          	add    $0x18,%rsp
+  803ca4:	5b                   	pop    %rbx
+  803ca5:	41 5c                	pop    %r12
+  803ca7:	41 5d                	pop    %r13
+  803ca9:	5d                   	pop    %rbp
+  803caa:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803cab:	48 b9 d0 4e 80 00 00 	movabs $0x804ed0,%rcx
+  803cb2:	00 00 00 
+  803cb5:	48 ba a7 4e 80 00 00 	movabs $0x804ea7,%rdx
+  803cbc:	00 00 00 
+  803cbf:	be 50 00 00 00       	mov    $0x50,%esi
+  803cc4:	48 bf bc 4e 80 00 00 	movabs $0x804ebc,%rdi
+  803ccb:	00 00 00 
+  803cce:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cd3:	49 b8 11 02 80 00 00 	movabs $0x800211,%r8
+  803cda:	00 00 00 
+  803cdd:	41 ff d0             	call   *%r8
+
+0000000000803ce0 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803ce0:	55                   	push   %rbp
+  803ce1:	48 89 e5             	mov    %rsp,%rbp
+  803ce4:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803ce8:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803cec:	48 b8 a6 16 80 00 00 	movabs $0x8016a6,%rax
+  803cf3:	00 00 00 
+  803cf6:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803cf8:	85 c0                	test   %eax,%eax
+  803cfa:	78 23                	js     803d1f <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803cfc:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803d00:	48 b8 2a 16 80 00 00 	movabs $0x80162a,%rax
+  803d07:	00 00 00 
+  803d0a:	ff d0                	call   *%rax
+  803d0c:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  803d0f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803d13:	48 b8 1b 38 80 00 00 	movabs $0x80381b,%rax
+  803d1a:	00 00 00 
+  803d1d:	ff d0                	call   *%rax
+}
+  803d1f:	c9                   	leave
+  803d20:	c3                   	ret
+
+0000000000803d21 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803d21:	48 89 f8             	mov    %rdi,%rax
+  803d24:	48 c1 e8 27          	shr    $0x27,%rax
+  803d28:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803d2f:	01 00 00 
+  803d32:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803d36:	f6 c2 01             	test   $0x1,%dl
+  803d39:	74 6d                	je     803da8 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803d3b:	48 89 f8             	mov    %rdi,%rax
+  803d3e:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803d42:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803d49:	01 00 00 
+  803d4c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803d50:	f6 c2 01             	test   $0x1,%dl
+  803d53:	74 62                	je     803db7 <get_uvpt_entry+0x96>
+  803d55:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803d5c:	01 00 00 
+  803d5f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803d63:	f6 c2 80             	test   $0x80,%dl
+  803d66:	75 4f                	jne    803db7 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803d68:	48 89 f8             	mov    %rdi,%rax
+  803d6b:	48 c1 e8 15          	shr    $0x15,%rax
+  803d6f:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803d76:	01 00 00 
+  803d79:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803d7d:	f6 c2 01             	test   $0x1,%dl
+  803d80:	74 44                	je     803dc6 <get_uvpt_entry+0xa5>
+  803d82:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803d89:	01 00 00 
+  803d8c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803d90:	f6 c2 80             	test   $0x80,%dl
+  803d93:	75 31                	jne    803dc6 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803d95:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803d99:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803da0:	01 00 00 
+  803da3:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803da7:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803da8:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803daf:	01 00 00 
+  803db2:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803db6:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803db7:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803dbe:	01 00 00 
+  803dc1:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803dc5:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803dc6:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803dcd:	01 00 00 
+  803dd0:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803dd4:	c3                   	ret
+
+0000000000803dd5 <get_prot>:
+
+int
+get_prot(void *va) {
+  803dd5:	55                   	push   %rbp
+  803dd6:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803dd9:	48 b8 21 3d 80 00 00 	movabs $0x803d21,%rax
+  803de0:	00 00 00 
+  803de3:	ff d0                	call   *%rax
+  803de5:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803de8:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803ded:	89 c1                	mov    %eax,%ecx
+  803def:	83 c9 04             	or     $0x4,%ecx
+  803df2:	f6 c2 01             	test   $0x1,%dl
+  803df5:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803df8:	89 c1                	mov    %eax,%ecx
+  803dfa:	83 c9 02             	or     $0x2,%ecx
+  803dfd:	f6 c2 02             	test   $0x2,%dl
+  803e00:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803e03:	89 c1                	mov    %eax,%ecx
+  803e05:	83 c9 01             	or     $0x1,%ecx
+  803e08:	48 85 d2             	test   %rdx,%rdx
+  803e0b:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803e0e:	89 c1                	mov    %eax,%ecx
+  803e10:	83 c9 40             	or     $0x40,%ecx
+  803e13:	f6 c6 04             	test   $0x4,%dh
+  803e16:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803e19:	5d                   	pop    %rbp
+  803e1a:	c3                   	ret
+
+0000000000803e1b <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803e1b:	55                   	push   %rbp
+  803e1c:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803e1f:	48 b8 21 3d 80 00 00 	movabs $0x803d21,%rax
+  803e26:	00 00 00 
+  803e29:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803e2b:	48 c1 e8 06          	shr    $0x6,%rax
+  803e2f:	83 e0 01             	and    $0x1,%eax
+}
+  803e32:	5d                   	pop    %rbp
+  803e33:	c3                   	ret
+
+0000000000803e34 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803e34:	55                   	push   %rbp
+  803e35:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803e38:	48 b8 21 3d 80 00 00 	movabs $0x803d21,%rax
+  803e3f:	00 00 00 
+  803e42:	ff d0                	call   *%rax
+  803e44:	83 e0 01             	and    $0x1,%eax
+}
+  803e47:	5d                   	pop    %rbp
+  803e48:	c3                   	ret
+
+0000000000803e49 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  803e49:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  803e50:	01 00 00 
+  803e53:	a8 01                	test   $0x1,%al
+  803e55:	75 06                	jne    803e5d <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  803e57:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e5c:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803e5d:	55                   	push   %rbp
+  803e5e:	48 89 e5             	mov    %rsp,%rbp
+  803e61:	41 57                	push   %r15
+  803e63:	41 56                	push   %r14
+  803e65:	41 55                	push   %r13
+  803e67:	41 54                	push   %r12
+  803e69:	53                   	push   %rbx
+  803e6a:	48 83 ec 28          	sub    $0x28,%rsp
+  803e6e:	49 89 fe             	mov    %rdi,%r14
+  803e71:	49 89 f7             	mov    %rsi,%r15
+  803e74:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  803e7b:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  803e7c:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  803e83:	01 00 00 
+  803e86:	e9 ae 00 00 00       	jmp    803f39 <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  803e8b:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803e92:	49 83 ec 01          	sub    $0x1,%r12
+  803e96:	74 2d                	je     803ec5 <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  803e98:	48 89 d8             	mov    %rbx,%rax
+  803e9b:	48 c1 e8 0c          	shr    $0xc,%rax
+  803e9f:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  803ea4:	f6 c2 01             	test   $0x1,%dl
+  803ea7:	74 e2                	je     803e8b <foreach_shared_region+0x42>
+  803ea9:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  803eae:	f6 c4 04             	test   $0x4,%ah
+  803eb1:	74 d8                	je     803e8b <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  803eb3:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803eba:	4c 89 fa             	mov    %r15,%rdx
+  803ebd:	48 89 df             	mov    %rbx,%rdi
+  803ec0:	41 ff d6             	call   *%r14
+  803ec3:	eb c6                	jmp    803e8b <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  803ec5:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  803ecc:	00 
+  803ecd:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  803ed2:	74 4a                	je     803f1e <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  803ed4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803ed8:	48 c1 e8 15          	shr    $0x15,%rax
+  803edc:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  803ee3:	01 00 00 
+  803ee6:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  803eea:	a8 01                	test   $0x1,%al
+  803eec:	74 d7                	je     803ec5 <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  803eee:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  803ef2:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  803ef9:	48 39 c3             	cmp    %rax,%rbx
+  803efc:	73 c7                	jae    803ec5 <foreach_shared_region+0x7c>
+  803efe:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  803f05:	48 39 d0             	cmp    %rdx,%rax
+  803f08:	4d 19 e4             	sbb    %r12,%r12
+  803f0b:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  803f12:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  803f19:	e9 7a ff ff ff       	jmp    803e98 <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  803f1e:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  803f25:	40 
+  803f26:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803f2a:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803f31:	00 00 00 
+  803f34:	48 39 c1             	cmp    %rax,%rcx
+  803f37:	74 50                	je     803f89 <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  803f39:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803f3d:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803f41:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  803f48:	01 00 00 
+  803f4b:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  803f4f:	a8 01                	test   $0x1,%al
+  803f51:	74 cb                	je     803f1e <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  803f53:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803f57:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  803f5e:	48 39 c1             	cmp    %rax,%rcx
+  803f61:	73 bb                	jae    803f1e <foreach_shared_region+0xd5>
+  803f63:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  803f6a:	48 39 d0             	cmp    %rdx,%rax
+  803f6d:	48 19 c0             	sbb    %rax,%rax
+  803f70:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  803f76:	48 05 00 02 00 00    	add    $0x200,%rax
+  803f7c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803f80:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803f84:	e9 4b ff ff ff       	jmp    803ed4 <foreach_shared_region+0x8b>
+  803f89:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f8e:	48 83 c4 28          	add    $0x28,%rsp
+  803f92:	5b                   	pop    %rbx
+  803f93:	41 5c                	pop    %r12
+  803f95:	41 5d                	pop    %r13
+  803f97:	41 5e                	pop    %r14
+  803f99:	41 5f                	pop    %r15
+  803f9b:	5d                   	pop    %rbp
+  803f9c:	c3                   	ret
+
+0000000000803f9d <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  803f9d:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  803fa3:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  803faa:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  803fb1:	c3                   	ret
+
+0000000000803fb2 <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  803fb2:	8b 47 40             	mov    0x40(%rdi),%eax
+  803fb5:	8b 17                	mov    (%rdi),%edx
+  803fb7:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  803fb9:	83 f8 0f             	cmp    $0xf,%eax
+  803fbc:	77 13                	ja     803fd1 <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  803fbe:	8b 47 40             	mov    0x40(%rdi),%eax
+  803fc1:	83 e0 0f             	and    $0xf,%eax
+  803fc4:	48 c1 e0 09          	shl    $0x9,%rax
+  803fc8:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  803fcf:	00 
+  803fd0:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  803fd1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803fd6:	c3                   	ret
+
+0000000000803fd7 <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  803fd7:	8b 47 40             	mov    0x40(%rdi),%eax
+  803fda:	83 c0 01             	add    $0x1,%eax
+  803fdd:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803fe0:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  803fe6:	8b 57 04             	mov    0x4(%rdi),%edx
+  803fe9:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fee:	85 d2                	test   %edx,%edx
+  803ff0:	75 04                	jne    803ff6 <chan_publish+0x1f>
+  803ff2:	83 e0 01             	and    $0x1,%eax
+}
+  803ff5:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  803ff6:	87 47 04             	xchg   %eax,0x4(%rdi)
+  803ff9:	85 c0                	test   %eax,%eax
+  803ffb:	0f 95 c0             	setne  %al
+  803ffe:	0f b6 c0             	movzbl %al,%eax
+  804001:	eb ef                	jmp    803ff2 <chan_publish+0x1b>
+
+0000000000804003 <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  804003:	8b 47 40             	mov    0x40(%rdi),%eax
+  804006:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  804008:	29 d0                	sub    %edx,%eax
+  80400a:	83 e8 01             	sub    $0x1,%eax
+  80400d:	83 f8 0f             	cmp    $0xf,%eax
+  804010:	77 12                	ja     804024 <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  804012:	8b 07                	mov    (%rdi),%eax
+  804014:	83 e0 0f             	and    $0xf,%eax
+  804017:	48 c1 e0 09          	shl    $0x9,%rax
+  80401b:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  804022:	00 
+  804023:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  804024:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804029:	c3                   	ret
+
+000000000080402a <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  80402a:	8b 07                	mov    (%rdi),%eax
+  80402c:	83 c0 01             	add    $0x1,%eax
+  80402f:	89 07                	mov    %eax,(%rdi)
+}
+  804031:	c3                   	ret
+
+0000000000804032 <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  804032:	55                   	push   %rbp
+  804033:	48 89 e5             	mov    %rsp,%rbp
+  804036:	53                   	push   %rbx
+  804037:	48 83 ec 08          	sub    $0x8,%rsp
+  80403b:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  80403e:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  804045:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  80404b:	48 b8 03 40 80 00 00 	movabs $0x804003,%rax
+  804052:	00 00 00 
+  804055:	ff d0                	call   *%rax
+  804057:	48 85 c0             	test   %rax,%rax
+  80405a:	74 12                	je     80406e <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  80405c:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  804063:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804068:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80406c:	c9                   	leave
+  80406d:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  80406e:	b8 01 00 00 00       	mov    $0x1,%eax
+  804073:	eb f3                	jmp    804068 <chan_arm+0x36>
+
+0000000000804075 <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  804075:	55                   	push   %rbp
+  804076:	48 89 e5             	mov    %rsp,%rbp
+  804079:	41 56                	push   %r14
+  80407b:	41 55                	push   %r13
+  80407d:	41 54                	push   %r12
+  80407f:	53                   	push   %rbx
+  804080:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  804083:	49 bc 32 40 80 00 00 	movabs $0x804032,%r12
+  80408a:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  80408d:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  804091:	49 bd 53 15 80 00 00 	movabs $0x801553,%r13
+  804098:	00 00 00 
+    while (chan_arm(r))
+  80409b:	eb 0d                	jmp    8040aa <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  80409d:	8b 33                	mov    (%rbx),%esi
+  80409f:	ba 00 00 00 00       	mov    $0x0,%edx
+  8040a4:	4c 89 f7             	mov    %r14,%rdi
+  8040a7:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  8040aa:	48 89 df             	mov    %rbx,%rdi
+  8040ad:	41 ff d4             	call   *%r12
+  8040b0:	84 c0                	test   %al,%al
+  8040b2:	75 e9                	jne    80409d <chan_wait+0x28>
+}
+  8040b4:	5b                   	pop    %rbx
+  8040b5:	41 5c                	pop    %r12
+  8040b7:	41 5d                	pop    %r13
+  8040b9:	41 5e                	pop    %r14
+  8040bb:	5d                   	pop    %rbp
+  8040bc:	c3                   	ret
+
+00000000008040bd <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  8040bd:	55                   	push   %rbp
+  8040be:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  8040c1:	48 83 c7 40          	add    $0x40,%rdi
+  8040c5:	be 01 00 00 00       	mov    $0x1,%esi
+  8040ca:	48 b8 71 15 80 00 00 	movabs $0x801571,%rax
+  8040d1:	00 00 00 
+  8040d4:	ff d0                	call   *%rax
+}
+  8040d6:	5d                   	pop    %rbp
+  8040d7:	c3                   	ret
+
+00000000008040d8 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8040d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040dd:	c3                   	ret
+
+00000000008040de <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8040de:	55                   	push   %rbp
+  8040df:	48 89 e5             	mov    %rsp,%rbp
+  8040e2:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8040e5:	48 be f4 4e 80 00 00 	movabs $0x804ef4,%rsi
+  8040ec:	00 00 00 
+  8040ef:	48 b8 86 0c 80 00 00 	movabs $0x800c86,%rax
+  8040f6:	00 00 00 
+  8040f9:	ff d0                	call   *%rax
+    return 0;
+}
+  8040fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  804100:	5d                   	pop    %rbp
+  804101:	c3                   	ret
+
+0000000000804102 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804102:	55                   	push   %rbp
+  804103:	48 89 e5             	mov    %rsp,%rbp
+  804106:	41 57                	push   %r15
+  804108:	41 56                	push   %r14
+  80410a:	41 55                	push   %r13
+  80410c:	41 54                	push   %r12
+  80410e:	53                   	push   %rbx
+  80410f:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  804116:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  80411d:	48 85 d2             	test   %rdx,%rdx
+  804120:	74 7a                	je     80419c <devcons_write+0x9a>
+  804122:	49 89 d6             	mov    %rdx,%r14
+  804125:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80412b:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  804130:	49 bf 80 0e 80 00 00 	movabs $0x800e80,%r15
+  804137:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80413a:	4c 89 f3             	mov    %r14,%rbx
+  80413d:	48 29 f3             	sub    %rsi,%rbx
+  804140:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804145:	48 39 c3             	cmp    %rax,%rbx
+  804148:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  80414c:	4c 63 eb             	movslq %ebx,%r13
+  80414f:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804156:	48 01 c6             	add    %rax,%rsi
+  804159:	4c 89 ea             	mov    %r13,%rdx
+  80415c:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804163:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  804166:	4c 89 ee             	mov    %r13,%rsi
+  804169:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804170:	48 b8 ad 10 80 00 00 	movabs $0x8010ad,%rax
+  804177:	00 00 00 
+  80417a:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80417c:	41 01 dc             	add    %ebx,%r12d
+  80417f:	49 63 f4             	movslq %r12d,%rsi
+  804182:	4c 39 f6             	cmp    %r14,%rsi
+  804185:	72 b3                	jb     80413a <devcons_write+0x38>
+    return res;
+  804187:	49 63 c4             	movslq %r12d,%rax
+}
+  80418a:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804191:	5b                   	pop    %rbx
+  804192:	41 5c                	pop    %r12
+  804194:	41 5d                	pop    %r13
+  804196:	41 5e                	pop    %r14
+  804198:	41 5f                	pop    %r15
+  80419a:	5d                   	pop    %rbp
+  80419b:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80419c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8041a2:	eb e3                	jmp    804187 <devcons_write+0x85>
+
+00000000008041a4 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8041a4:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8041a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8041ac:	48 85 c0             	test   %rax,%rax
+  8041af:	74 55                	je     804206 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8041b1:	55                   	push   %rbp
+  8041b2:	48 89 e5             	mov    %rsp,%rbp
+  8041b5:	41 55                	push   %r13
+  8041b7:	41 54                	push   %r12
+  8041b9:	53                   	push   %rbx
+  8041ba:	48 83 ec 08          	sub    $0x8,%rsp
+  8041be:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8041c1:	48 bb cc 10 80 00 00 	movabs $0x8010cc,%rbx
+  8041c8:	00 00 00 
+  8041cb:	49 bc 81 11 80 00 00 	movabs $0x801181,%r12
+  8041d2:	00 00 00 
+  8041d5:	eb 03                	jmp    8041da <devcons_read+0x36>
+  8041d7:	41 ff d4             	call   *%r12
+  8041da:	ff d3                	call   *%rbx
+  8041dc:	85 c0                	test   %eax,%eax
+  8041de:	74 f7                	je     8041d7 <devcons_read+0x33>
+    if (c < 0) return c;
+  8041e0:	48 63 d0             	movslq %eax,%rdx
+  8041e3:	78 13                	js     8041f8 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8041e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8041ea:	83 f8 04             	cmp    $0x4,%eax
+  8041ed:	74 09                	je     8041f8 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8041ef:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8041f3:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8041f8:	48 89 d0             	mov    %rdx,%rax
+  8041fb:	48 83 c4 08          	add    $0x8,%rsp
+  8041ff:	5b                   	pop    %rbx
+  804200:	41 5c                	pop    %r12
+  804202:	41 5d                	pop    %r13
+  804204:	5d                   	pop    %rbp
+  804205:	c3                   	ret
+  804206:	48 89 d0             	mov    %rdx,%rax
+  804209:	c3                   	ret
+
+000000000080420a <cputchar>:
+cputchar(int ch) {
+  80420a:	55                   	push   %rbp
+  80420b:	48 89 e5             	mov    %rsp,%rbp
+  80420e:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  804212:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  804216:	be 01 00 00 00       	mov    $0x1,%esi
+  80421b:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  80421f:	48 b8 ad 10 80 00 00 	movabs $0x8010ad,%rax
+  804226:	00 00 00 
+  804229:	ff d0                	call   *%rax
+}
+  80422b:	c9                   	leave
+  80422c:	c3                   	ret
+
+000000000080422d <getchar>:
+getchar(void) {
+  80422d:	55                   	push   %rbp
+  80422e:	48 89 e5             	mov    %rsp,%rbp
+  804231:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  804235:	ba 01 00 00 00       	mov    $0x1,%edx
+  80423a:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  80423e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804243:	48 b8 89 19 80 00 00 	movabs $0x801989,%rax
+  80424a:	00 00 00 
+  80424d:	ff d0                	call   *%rax
+  80424f:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  804251:	85 c0                	test   %eax,%eax
+  804253:	78 06                	js     80425b <getchar+0x2e>
+  804255:	74 08                	je     80425f <getchar+0x32>
+  804257:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  80425b:	89 d0                	mov    %edx,%eax
+  80425d:	c9                   	leave
+  80425e:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  80425f:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  804264:	eb f5                	jmp    80425b <getchar+0x2e>
+
+0000000000804266 <iscons>:
+iscons(int fdnum) {
+  804266:	55                   	push   %rbp
+  804267:	48 89 e5             	mov    %rsp,%rbp
+  80426a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80426e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804272:	48 b8 a6 16 80 00 00 	movabs $0x8016a6,%rax
+  804279:	00 00 00 
+  80427c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80427e:	85 c0                	test   %eax,%eax
+  804280:	78 18                	js     80429a <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  804282:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804286:	48 b8 a0 50 80 00 00 	movabs $0x8050a0,%rax
+  80428d:	00 00 00 
+  804290:	8b 00                	mov    (%rax),%eax
+  804292:	39 02                	cmp    %eax,(%rdx)
+  804294:	0f 94 c0             	sete   %al
+  804297:	0f b6 c0             	movzbl %al,%eax
+}
+  80429a:	c9                   	leave
+  80429b:	c3                   	ret
+
+000000000080429c <opencons>:
+opencons(void) {
+  80429c:	55                   	push   %rbp
+  80429d:	48 89 e5             	mov    %rsp,%rbp
+  8042a0:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8042a4:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8042a8:	48 b8 46 16 80 00 00 	movabs $0x801646,%rax
+  8042af:	00 00 00 
+  8042b2:	ff d0                	call   *%rax
+  8042b4:	85 c0                	test   %eax,%eax
+  8042b6:	78 49                	js     804301 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8042b8:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8042bd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8042c2:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8042c6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8042cb:	48 b8 e5 11 80 00 00 	movabs $0x8011e5,%rax
+  8042d2:	00 00 00 
+  8042d5:	ff d0                	call   *%rax
+  8042d7:	85 c0                	test   %eax,%eax
+  8042d9:	78 26                	js     804301 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8042db:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8042df:	a1 a0 50 80 00 00 00 	movabs 0x8050a0,%eax
+  8042e6:	00 00 
+  8042e8:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8042ea:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8042ee:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8042f5:	48 b8 18 16 80 00 00 	movabs $0x801618,%rax
+  8042fc:	00 00 00 
+  8042ff:	ff d0                	call   *%rax
+}
+  804301:	c9                   	leave
+  804302:	c3                   	ret
+
+0000000000804303 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  804303:	55                   	push   %rbp
+  804304:	48 89 e5             	mov    %rsp,%rbp
+  804307:	41 56                	push   %r14
+  804309:	41 55                	push   %r13
+  80430b:	41 54                	push   %r12
+  80430d:	53                   	push   %rbx
+  80430e:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804311:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  804318:	00 00 00 
+  80431b:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80431f:	74 27                	je     804348 <_handle_vectored_pagefault+0x45>
+  804321:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  804326:	49 bd 00 10 84 00 00 	movabs $0x841000,%r13
+  80432d:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804330:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  804333:	4c 89 e7             	mov    %r12,%rdi
+  804336:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  80433b:	84 c0                	test   %al,%al
+  80433d:	75 45                	jne    804384 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80433f:	48 83 c3 01          	add    $0x1,%rbx
+  804343:	49 3b 1e             	cmp    (%r14),%rbx
+  804346:	72 eb                	jb     804333 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  804348:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  80434f:	00 
+  804350:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  804355:	4d 8b 04 24          	mov    (%r12),%r8
+  804359:	48 ba 00 4f 80 00 00 	movabs $0x804f00,%rdx
+  804360:	00 00 00 
+  804363:	be 1d 00 00 00       	mov    $0x1d,%esi
+  804368:	48 bf 30 4f 80 00 00 	movabs $0x804f30,%rdi
+  80436f:	00 00 00 
+  804372:	b8 00 00 00 00       	mov    $0x0,%eax
+  804377:	49 ba 11 02 80 00 00 	movabs $0x800211,%r10
+  80437e:	00 00 00 
+  804381:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  804384:	5b                   	pop    %rbx
+  804385:	41 5c                	pop    %r12
+  804387:	41 5d                	pop    %r13
+  804389:	41 5e                	pop    %r14
+  80438b:	5d                   	pop    %rbp
+  80438c:	c3                   	ret
+
+000000000080438d <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  80438d:	55                   	push   %rbp
+  80438e:	48 89 e5             	mov    %rsp,%rbp
+  804391:	53                   	push   %rbx
+  804392:	48 83 ec 08          	sub    $0x8,%rsp
+  804396:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  804399:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8043a0:	00 00 00 
+  8043a3:	80 38 00             	cmpb   $0x0,(%rax)
+  8043a6:	0f 84 84 00 00 00    	je     804430 <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8043ac:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  8043b3:	00 00 00 
+  8043b6:	48 8b 10             	mov    (%rax),%rdx
+  8043b9:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  8043be:	48 b9 00 10 84 00 00 	movabs $0x841000,%rcx
+  8043c5:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8043c8:	48 85 d2             	test   %rdx,%rdx
+  8043cb:	74 19                	je     8043e6 <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  8043cd:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  8043d1:	0f 84 e8 00 00 00    	je     8044bf <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8043d7:	48 83 c0 01          	add    $0x1,%rax
+  8043db:	48 39 d0             	cmp    %rdx,%rax
+  8043de:	75 ed                	jne    8043cd <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  8043e0:	48 83 fa 08          	cmp    $0x8,%rdx
+  8043e4:	74 1c                	je     804402 <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8043e6:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8043ea:	48 a3 48 10 84 00 00 	movabs %rax,0x841048
+  8043f1:	00 00 00 
+  8043f4:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  8043fb:	00 00 00 
+  8043fe:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  804402:	48 b8 58 11 80 00 00 	movabs $0x801158,%rax
+  804409:	00 00 00 
+  80440c:	ff d0                	call   *%rax
+  80440e:	89 c7                	mov    %eax,%edi
+  804410:	48 be 85 45 80 00 00 	movabs $0x804585,%rsi
+  804417:	00 00 00 
+  80441a:	48 b8 a3 13 80 00 00 	movabs $0x8013a3,%rax
+  804421:	00 00 00 
+  804424:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  804426:	85 c0                	test   %eax,%eax
+  804428:	78 68                	js     804492 <add_pgfault_handler+0x105>
+    return res;
+}
+  80442a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80442e:	c9                   	leave
+  80442f:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  804430:	48 b8 58 11 80 00 00 	movabs $0x801158,%rax
+  804437:	00 00 00 
+  80443a:	ff d0                	call   *%rax
+  80443c:	89 c7                	mov    %eax,%edi
+  80443e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804443:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804448:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  80444f:	00 00 00 
+  804452:	48 b8 e5 11 80 00 00 	movabs $0x8011e5,%rax
+  804459:	00 00 00 
+  80445c:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  80445e:	48 ba 48 10 84 00 00 	movabs $0x841048,%rdx
+  804465:	00 00 00 
+  804468:	48 8b 02             	mov    (%rdx),%rax
+  80446b:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80446f:	48 89 0a             	mov    %rcx,(%rdx)
+  804472:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  804479:	00 00 00 
+  80447c:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  804480:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  804487:	00 00 00 
+  80448a:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  80448d:	e9 70 ff ff ff       	jmp    804402 <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  804492:	89 c1                	mov    %eax,%ecx
+  804494:	48 ba 3e 4f 80 00 00 	movabs $0x804f3e,%rdx
+  80449b:	00 00 00 
+  80449e:	be 3d 00 00 00       	mov    $0x3d,%esi
+  8044a3:	48 bf 30 4f 80 00 00 	movabs $0x804f30,%rdi
+  8044aa:	00 00 00 
+  8044ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044b2:	49 b8 11 02 80 00 00 	movabs $0x800211,%r8
+  8044b9:	00 00 00 
+  8044bc:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8044bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044c4:	e9 61 ff ff ff       	jmp    80442a <add_pgfault_handler+0x9d>
+
+00000000008044c9 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  8044c9:	55                   	push   %rbp
+  8044ca:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  8044cd:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8044d4:	00 00 00 
+  8044d7:	80 38 00             	cmpb   $0x0,(%rax)
+  8044da:	74 33                	je     80450f <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8044dc:	48 a1 48 10 84 00 00 	movabs 0x841048,%rax
+  8044e3:	00 00 00 
+  8044e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  8044eb:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  8044f2:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8044f5:	48 85 c0             	test   %rax,%rax
+  8044f8:	0f 84 85 00 00 00    	je     804583 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  8044fe:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  804502:	74 40                	je     804544 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804504:	48 83 c1 01          	add    $0x1,%rcx
+  804508:	48 39 c1             	cmp    %rax,%rcx
+  80450b:	75 f1                	jne    8044fe <remove_pgfault_handler+0x35>
+  80450d:	eb 74                	jmp    804583 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  80450f:	48 b9 56 4f 80 00 00 	movabs $0x804f56,%rcx
+  804516:	00 00 00 
+  804519:	48 ba a7 4e 80 00 00 	movabs $0x804ea7,%rdx
+  804520:	00 00 00 
+  804523:	be 43 00 00 00       	mov    $0x43,%esi
+  804528:	48 bf 30 4f 80 00 00 	movabs $0x804f30,%rdi
+  80452f:	00 00 00 
+  804532:	b8 00 00 00 00       	mov    $0x0,%eax
+  804537:	49 b8 11 02 80 00 00 	movabs $0x800211,%r8
+  80453e:	00 00 00 
+  804541:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  804544:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  80454b:	00 
+  80454c:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804550:	48 29 ca             	sub    %rcx,%rdx
+  804553:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  80455a:	00 00 00 
+  80455d:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  804561:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  804566:	48 89 ce             	mov    %rcx,%rsi
+  804569:	48 b8 80 0e 80 00 00 	movabs $0x800e80,%rax
+  804570:	00 00 00 
+  804573:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  804575:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  80457c:	00 00 00 
+  80457f:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  804583:	5d                   	pop    %rbp
+  804584:	c3                   	ret
+
+0000000000804585 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  804585:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  804588:	48 b8 03 43 80 00 00 	movabs $0x804303,%rax
+  80458f:	00 00 00 
+    call *%rax
+  804592:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  804594:	41 5f                	pop    %r15
+	popq %r15
+  804596:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  804598:	41 5f                	pop    %r15
+	popq %r14
+  80459a:	41 5e                	pop    %r14
+	popq %r13
+  80459c:	41 5d                	pop    %r13
+	popq %r12
+  80459e:	41 5c                	pop    %r12
+	popq %r11
+  8045a0:	41 5b                	pop    %r11
+	popq %r10
+  8045a2:	41 5a                	pop    %r10
+	popq %r9
+  8045a4:	41 59                	pop    %r9
+	popq %r8
+  8045a6:	41 58                	pop    %r8
+	popq %rsi
+  8045a8:	5e                   	pop    %rsi
+	popq %rdi
+  8045a9:	5f                   	pop    %rdi
+	popq %rbp
+  8045aa:	5d                   	pop    %rbp
+	popq %rdx
+  8045ab:	5a                   	pop    %rdx
+	popq %rcx
+  8045ac:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  8045ad:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  8045b2:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  8045b7:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  8045bb:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  8045be:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  8045c3:	5b                   	pop    %rbx
+	popq %rax
+  8045c4:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  8045c5:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  8045c9:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  8045ca:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  8045cf:	c3                   	ret
+
+00000000008045d0 <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8045d0:	55                   	push   %rbp
+  8045d1:	48 89 e5             	mov    %rsp,%rbp
+  8045d4:	41 55                	push   %r13
+  8045d6:	41 54                	push   %r12
+  8045d8:	53                   	push   %rbx
+  8045d9:	48 83 ec 08          	sub    $0x8,%rsp
+  8045dd:	49 89 fd             	mov    %rdi,%r13
+  8045e0:	48 89 f7             	mov    %rsi,%rdi
+  8045e3:	48 89 d3             	mov    %rdx,%rbx
+  8045e6:	49 89 cc             	mov    %rcx,%r12
+  8045e9:	4c 89 c2             	mov    %r8,%rdx
+  8045ec:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8045ef:	48 85 f6             	test   %rsi,%rsi
+  8045f2:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8045f9:	00 00 00 
+  8045fc:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  804600:	be 00 10 00 00       	mov    $0x1000,%esi
+  804605:	48 85 db             	test   %rbx,%rbx
+  804608:	74 03                	je     80460d <ipc_recv_futex+0x3d>
+  80460a:	48 8b 33             	mov    (%rbx),%rsi
+  80460d:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  804611:	48 b8 2f 14 80 00 00 	movabs $0x80142f,%rax
+  804618:	00 00 00 
+  80461b:	ff d0                	call   *%rax
+    if (res < 0) {
+  80461d:	85 c0                	test   %eax,%eax
+  80461f:	78 75                	js     804696 <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  804621:	4d 85 ed             	test   %r13,%r13
+  804624:	74 14                	je     80463a <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  804626:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80462d:	00 00 00 
+  804630:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  804636:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  80463a:	4d 85 e4             	test   %r12,%r12
+  80463d:	74 14                	je     804653 <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  80463f:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804646:	00 00 00 
+  804649:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  80464f:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  804653:	48 85 db             	test   %rbx,%rbx
+  804656:	74 23                	je     80467b <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804658:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80465f:	00 00 00 
+  804662:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  804668:	ba 00 00 00 00       	mov    $0x0,%edx
+  80466d:	85 c9                	test   %ecx,%ecx
+  80466f:	74 07                	je     804678 <ipc_recv_futex+0xa8>
+  804671:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  804678:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  80467b:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804682:	00 00 00 
+  804685:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  80468b:	48 83 c4 08          	add    $0x8,%rsp
+  80468f:	5b                   	pop    %rbx
+  804690:	41 5c                	pop    %r12
+  804692:	41 5d                	pop    %r13
+  804694:	5d                   	pop    %rbp
+  804695:	c3                   	ret
+        if (from_env_store != NULL) {
+  804696:	4d 85 ed             	test   %r13,%r13
+  804699:	74 08                	je     8046a3 <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  80469b:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8046a2:	00 
+        if (perm_store != NULL) {
+  8046a3:	4d 85 e4             	test   %r12,%r12
+  8046a6:	74 08                	je     8046b0 <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  8046a8:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8046af:	00 
+        if (size != NULL) {
+  8046b0:	48 85 db             	test   %rbx,%rbx
+  8046b3:	74 d6                	je     80468b <ipc_recv_futex+0xbb>
+            *size = 0;
+  8046b5:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  8046bc:	eb cd                	jmp    80468b <ipc_recv_futex+0xbb>
+
+00000000008046be <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8046be:	55                   	push   %rbp
+  8046bf:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  8046c2:	48 83 ec 08          	sub    $0x8,%rsp
+  8046c6:	6a 00                	push   $0x0
+  8046c8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8046ce:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8046d4:	48 b8 d0 45 80 00 00 	movabs $0x8045d0,%rax
+  8046db:	00 00 00 
+  8046de:	ff d0                	call   *%rax
+}
+  8046e0:	c9                   	leave
+  8046e1:	c3                   	ret
+
+00000000008046e2 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8046e2:	55                   	push   %rbp
+  8046e3:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8046e6:	48 85 d2             	test   %rdx,%rdx
+  8046e9:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8046f0:	00 00 00 
+  8046f3:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  8046f7:	89 f6                	mov    %esi,%esi
+  8046f9:	48 b8 18 14 80 00 00 	movabs $0x801418,%rax
+  804700:	00 00 00 
+  804703:	ff d0                	call   *%rax
+    if (res < 0) {
+  804705:	85 c0                	test   %eax,%eax
+  804707:	78 02                	js     80470b <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  804709:	5d                   	pop    %rbp
+  80470a:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  80470b:	89 c1                	mov    %eax,%ecx
+  80470d:	48 ba 70 4f 80 00 00 	movabs $0x804f70,%rdx
+  804714:	00 00 00 
+  804717:	be 50 00 00 00       	mov    $0x50,%esi
+  80471c:	48 bf 84 4f 80 00 00 	movabs $0x804f84,%rdi
+  804723:	00 00 00 
+  804726:	b8 00 00 00 00       	mov    $0x0,%eax
+  80472b:	49 b8 11 02 80 00 00 	movabs $0x800211,%r8
+  804732:	00 00 00 
+  804735:	41 ff d0             	call   *%r8
+
+0000000000804738 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804738:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  80473d:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804744:	00 00 00 
+  804747:	48 89 d0             	mov    %rdx,%rax
+  80474a:	48 c1 e0 04          	shl    $0x4,%rax
+  80474e:	48 29 d0             	sub    %rdx,%rax
+  804751:	48 c1 e0 05          	shl    $0x5,%rax
+  804755:	48 01 c8             	add    %rcx,%rax
+  804758:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  80475e:	39 f8                	cmp    %edi,%eax
+  804760:	74 13                	je     804775 <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  804762:	48 83 c2 01          	add    $0x1,%rdx
+  804766:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  80476d:	75 d8                	jne    804747 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80476f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804774:	c3                   	ret
+            return envs[i].env_id;
+  804775:	48 89 d0             	mov    %rdx,%rax
+  804778:	48 c1 e0 04          	shl    $0x4,%rax
+  80477c:	48 29 d0             	sub    %rdx,%rax
+  80477f:	48 c1 e0 05          	shl    $0x5,%rax
+  804783:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80478a:	00 00 00 
+  80478d:	48 01 d0             	add    %rdx,%rax
+  804790:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804796:	c3                   	ret
+  804797:	90                   	nop
+
+0000000000804798 <__rodata_start>:
+  804798:	69 6e 74 20 24 54 5f 	imul   $0x5f542420,0x74(%rsi),%ebp
+  80479f:	53                   	push   %rbx
+  8047a0:	59                   	pop    %rcx
+  8047a1:	53                   	push   %rbx
+  8047a2:	43                   	rex.XB
+  8047a3:	41                   	rex.B
+  8047a4:	4c                   	rex.WR
+  8047a5:	4c 20 72 65          	rex.WR and %r14b,0x65(%rdx)
+  8047a9:	74 75                	je     804820 <__rodata_start+0x88>
+  8047ab:	72 6e                	jb     80481b <__rodata_start+0x83>
+  8047ad:	65 64 20 25 30 38 78 	gs and %ah,%fs:0x20783830(%rip)        # 20f87fe5 <__bss_end+0x20745fe5>
+  8047b4:	20 
+  8047b5:	69 6e 73 74 65 61 64 	imul   $0x64616574,0x73(%rsi),%ebp
+  8047bc:	20 6f 66             	and    %ch,0x66(%rdi)
+  8047bf:	20 25 30 38 78 00    	and    %ah,0x783830(%rip)        # f87ff5 <__bss_end+0x745ff5>
+  8047c5:	00 00                	add    %al,(%rax)
+  8047c7:	00 73 79             	add    %dh,0x79(%rbx)
+  8047ca:	73 63                	jae    80482f <__rodata_start+0x97>
+  8047cc:	61                   	(bad)
+  8047cd:	6c                   	insb   (%dx),%es:(%rdi)
+  8047ce:	6c                   	insb   (%dx),%es:(%rdi)
+  8047cf:	62 65 6e 63 68       	(bad)
+  8047d4:	3a 20                	cmp    (%rax),%ah
+  8047d6:	73 79                	jae    804851 <__rodata_start+0xb9>
+  8047d8:	73 5f                	jae    804839 <__rodata_start+0xa1>
+  8047da:	67 65 74 65          	addr32 gs je 804843 <__rodata_start+0xab>
+  8047de:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8047df:	76 69                	jbe    80484a <__rodata_start+0xb2>
+  8047e1:	64 20 74 61 6b       	and    %dh,%fs:0x6b(%rcx,%riz,2)
+  8047e6:	65 73 20             	gs jae 804809 <__rodata_start+0x71>
+  8047e9:	25 6c 75 20 63       	and    $0x6320756c,%eax
+  8047ee:	79 63                	jns    804853 <__rodata_start+0xbb>
+  8047f0:	6c                   	insb   (%dx),%es:(%rdi)
+  8047f1:	65 73 20             	gs jae 804814 <__rodata_start+0x7c>
+  8047f4:	77 69                	ja     80485f <__rodata_start+0xc7>
+  8047f6:	74 68                	je     804860 <__rodata_start+0xc8>
+  8047f8:	20 69 6e             	and    %ch,0x6e(%rcx)
+  8047fb:	74 2c                	je     804829 <__rodata_start+0x91>
+  8047fd:	20 25 6c 75 20 63    	and    %ah,0x6320756c(%rip)        # 63a0bd6f <__bss_end+0x631c9d6f>
+  804803:	79 63                	jns    804868 <__rodata_start+0xd0>
+  804805:	6c                   	insb   (%dx),%es:(%rdi)
+  804806:	65 73 20             	gs jae 804829 <__rodata_start+0x91>
+  804809:	77 69                	ja     804874 <__rodata_start+0xdc>
+  80480b:	74 68                	je     804875 <__rodata_start+0xdd>
+  80480d:	20 73 79             	and    %dh,0x79(%rbx)
+  804810:	73 63                	jae    804875 <__rodata_start+0xdd>
+  804812:	61                   	(bad)
+  804813:	6c                   	insb   (%dx),%es:(%rdi)
+  804814:	6c                   	insb   (%dx),%es:(%rdi)
+  804815:	0a 00                	or     (%rax),%al
+  804817:	75 73                	jne    80488c <__rodata_start+0xf4>
+  804819:	65 72 2f             	gs jb  80484b <__rodata_start+0xb3>
+  80481c:	73 79                	jae    804897 <__rodata_start+0xff>
+  80481e:	73 63                	jae    804883 <__rodata_start+0xeb>
+  804820:	61                   	(bad)
+  804821:	6c                   	insb   (%dx),%es:(%rdi)
+  804822:	6c                   	insb   (%dx),%es:(%rdi)
+  804823:	62 65 6e 63 68       	(bad)
+  804828:	2e 63 00             	cs movsxd (%rax),%eax
+  80482b:	3c 75                	cmp    $0x75,%al
+  80482d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80482e:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  804832:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804833:	3e 00 0f             	ds add %cl,(%rdi)
+  804836:	1f                   	(bad)
+  804837:	00 5b 25             	add    %bl,0x25(%rbx)
+  80483a:	30 38                	xor    %bh,(%rax)
+  80483c:	78 5d                	js     80489b <__rodata_start+0x103>
+  80483e:	20 75 73             	and    %dh,0x73(%rbp)
+  804841:	65 72 20             	gs jb  804864 <__rodata_start+0xcc>
+  804844:	70 61                	jo     8048a7 <__rodata_start+0x10f>
+  804846:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804847:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  80484e:	73 20                	jae    804870 <__rodata_start+0xd8>
+  804850:	61                   	(bad)
+  804851:	74 20                	je     804873 <__rodata_start+0xdb>
+  804853:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  804858:	3a 20                	cmp    (%rax),%ah
+  80485a:	00 30                	add    %dh,(%rax)
+  80485c:	31 32                	xor    %esi,(%rdx)
+  80485e:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  804865:	41                   	rex.B
+  804866:	42                   	rex.X
+  804867:	43                   	rex.XB
+  804868:	44                   	rex.R
+  804869:	45                   	rex.RB
+  80486a:	46 00 30             	rex.RX add %r14b,(%rax)
+  80486d:	31 32                	xor    %esi,(%rdx)
+  80486f:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  804876:	61                   	(bad)
+  804877:	62 63 64 65 66       	(bad)
+  80487c:	00 28                	add    %ch,(%rax)
+  80487e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80487f:	75 6c                	jne    8048ed <__rodata_start+0x155>
+  804881:	6c                   	insb   (%dx),%es:(%rdi)
+  804882:	29 00                	sub    %eax,(%rax)
+  804884:	65 72 72             	gs jb  8048f9 <__rodata_start+0x161>
+  804887:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804888:	72 20                	jb     8048aa <__rodata_start+0x112>
+  80488a:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  80488f:	73 70                	jae    804901 <__rodata_start+0x169>
+  804891:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  804895:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  80489c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80489d:	72 00                	jb     80489f <__rodata_start+0x107>
+  80489f:	62 61 64 20 65       	(bad)
+  8048a4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8048a5:	76 69                	jbe    804910 <__rodata_start+0x178>
+  8048a7:	72 6f                	jb     804918 <__rodata_start+0x180>
+  8048a9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8048aa:	6d                   	insl   (%dx),%es:(%rdi)
+  8048ab:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8048ad:	74 00                	je     8048af <__rodata_start+0x117>
+  8048af:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8048b6:	20 70 61             	and    %dh,0x61(%rax)
+  8048b9:	72 61                	jb     80491c <__rodata_start+0x184>
+  8048bb:	6d                   	insl   (%dx),%es:(%rdi)
+  8048bc:	65 74 65             	gs je  804924 <__rodata_start+0x18c>
+  8048bf:	72 00                	jb     8048c1 <__rodata_start+0x129>
+  8048c1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8048c2:	75 74                	jne    804938 <__rodata_start+0x1a0>
+  8048c4:	20 6f 66             	and    %ch,0x66(%rdi)
+  8048c7:	20 6d 65             	and    %ch,0x65(%rbp)
+  8048ca:	6d                   	insl   (%dx),%es:(%rdi)
+  8048cb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8048cc:	72 79                	jb     804947 <__rodata_start+0x1af>
+  8048ce:	00 6f 75             	add    %ch,0x75(%rdi)
+  8048d1:	74 20                	je     8048f3 <__rodata_start+0x15b>
+  8048d3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8048d4:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  8048d8:	76 69                	jbe    804943 <__rodata_start+0x1ab>
+  8048da:	72 6f                	jb     80494b <__rodata_start+0x1b3>
+  8048dc:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8048dd:	6d                   	insl   (%dx),%es:(%rdi)
+  8048de:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8048e0:	74 73                	je     804955 <__rodata_start+0x1bd>
+  8048e2:	00 63 6f             	add    %ah,0x6f(%rbx)
+  8048e5:	72 72                	jb     804959 <__rodata_start+0x1c1>
+  8048e7:	75 70                	jne    804959 <__rodata_start+0x1c1>
+  8048e9:	74 65                	je     804950 <__rodata_start+0x1b8>
+  8048eb:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  8048f0:	75 67                	jne    804959 <__rodata_start+0x1c1>
+  8048f2:	20 69 6e             	and    %ch,0x6e(%rcx)
+  8048f5:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8048f7:	00 73 65             	add    %dh,0x65(%rbx)
+  8048fa:	67 6d                	insl   (%dx),%es:(%edi)
+  8048fc:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8048fe:	74 61                	je     804961 <__rodata_start+0x1c9>
+  804900:	74 69                	je     80496b <__rodata_start+0x1d3>
+  804902:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804903:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804904:	20 66 61             	and    %ah,0x61(%rsi)
+  804907:	75 6c                	jne    804975 <__rodata_start+0x1dd>
+  804909:	74 00                	je     80490b <__rodata_start+0x173>
+  80490b:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  804912:	20 45 4c             	and    %al,0x4c(%rbp)
+  804915:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  804919:	61                   	(bad)
+  80491a:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  80491f:	20 73 75             	and    %dh,0x75(%rbx)
+  804922:	63 68 20             	movsxd 0x20(%rax),%ebp
+  804925:	73 79                	jae    8049a0 <__rodata_start+0x208>
+  804927:	73 74                	jae    80499d <__rodata_start+0x205>
+  804929:	65 6d                	gs insl (%dx),%es:(%rdi)
+  80492b:	20 63 61             	and    %ah,0x61(%rbx)
+  80492e:	6c                   	insb   (%dx),%es:(%rdi)
+  80492f:	6c                   	insb   (%dx),%es:(%rdi)
+  804930:	00 65 6e             	add    %ah,0x6e(%rbp)
+  804933:	74 72                	je     8049a7 <__rodata_start+0x20f>
+  804935:	79 20                	jns    804957 <__rodata_start+0x1bf>
+  804937:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804938:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804939:	74 20                	je     80495b <__rodata_start+0x1c3>
+  80493b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80493d:	75 6e                	jne    8049ad <__rodata_start+0x215>
+  80493f:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  804943:	76 20                	jbe    804965 <__rodata_start+0x1cd>
+  804945:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  80494c:	72 65                	jb     8049b3 <__rodata_start+0x21b>
+  80494e:	63 76 69             	movsxd 0x69(%rsi),%esi
+  804951:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804952:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  804956:	65 78 70             	gs js  8049c9 <__rodata_start+0x231>
+  804959:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  80495e:	20 65 6e             	and    %ah,0x6e(%rbp)
+  804961:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  804965:	20 66 69             	and    %ah,0x69(%rsi)
+  804968:	6c                   	insb   (%dx),%es:(%rdi)
+  804969:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  80496d:	20 66 72             	and    %ah,0x72(%rsi)
+  804970:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  804975:	61                   	(bad)
+  804976:	63 65 20             	movsxd 0x20(%rbp),%esp
+  804979:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80497a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80497b:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  80497f:	6b 00 74             	imul   $0x74,(%rax),%eax
+  804982:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804983:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804984:	20 6d 61             	and    %ch,0x61(%rbp)
+  804987:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804988:	79 20                	jns    8049aa <__rodata_start+0x212>
+  80498a:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  804991:	72 65                	jb     8049f8 <__rodata_start+0x260>
+  804993:	20 6f 70             	and    %ch,0x70(%rdi)
+  804996:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804998:	00 66 69             	add    %ah,0x69(%rsi)
+  80499b:	6c                   	insb   (%dx),%es:(%rdi)
+  80499c:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  8049a0:	20 62 6c             	and    %ah,0x6c(%rdx)
+  8049a3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8049a4:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  8049a7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8049a8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8049a9:	74 20                	je     8049cb <__rodata_start+0x233>
+  8049ab:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8049ad:	75 6e                	jne    804a1d <__rodata_start+0x285>
+  8049af:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  8049b3:	76 61                	jbe    804a16 <__rodata_start+0x27e>
+  8049b5:	6c                   	insb   (%dx),%es:(%rdi)
+  8049b6:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  8049bd:	00 
+  8049be:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  8049c5:	72 65                	jb     804a2c <__rodata_start+0x294>
+  8049c7:	61                   	(bad)
+  8049c8:	64 79 20             	fs jns 8049eb <__rodata_start+0x253>
+  8049cb:	65 78 69             	gs js  804a37 <__rodata_start+0x29f>
+  8049ce:	73 74                	jae    804a44 <__rodata_start+0x2ac>
+  8049d0:	73 00                	jae    8049d2 <__rodata_start+0x23a>
+  8049d2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8049d3:	70 65                	jo     804a3a <__rodata_start+0x2a2>
+  8049d5:	72 61                	jb     804a38 <__rodata_start+0x2a0>
+  8049d7:	74 69                	je     804a42 <__rodata_start+0x2aa>
+  8049d9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8049da:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8049db:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  8049de:	74 20                	je     804a00 <__rodata_start+0x268>
+  8049e0:	73 75                	jae    804a57 <__rodata_start+0x2bf>
+  8049e2:	70 70                	jo     804a54 <__rodata_start+0x2bc>
+  8049e4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8049e5:	72 74                	jb     804a5b <__rodata_start+0x2c3>
+  8049e7:	65 64 00 74 72 79    	gs add %dh,%fs:0x79(%rdx,%rsi,2)
+  8049ed:	20 61 67             	and    %ah,0x67(%rcx)
+  8049f0:	61                   	(bad)
+  8049f1:	69 6e 00 74 69 6d 65 	imul   $0x656d6974,0x0(%rsi),%ebp
+  8049f8:	64 20 6f 75          	and    %ch,%fs:0x75(%rdi)
+  8049fc:	74 00                	je     8049fe <__rodata_start+0x266>
+  8049fe:	66 69 6c 65 20 69 73 	imul   $0x7369,0x20(%rbp,%riz,2),%bp
+  804a05:	20 69 6e             	and    %ch,0x6e(%rcx)
+  804a08:	20 75 73             	and    %dh,0x73(%rbp)
+  804a0b:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  804a0f:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  804a16:	00 
+  804a17:	66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+  804a1e:	00 00 
+  804a20:	4e 05 80 00 00 00    	rex.WRX add $0x80,%rax
+  804a26:	00 00                	add    %al,(%rax)
+  804a28:	8f                   	(bad)
+  804a29:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804a2f:	00 7f 0b             	add    %bh,0xb(%rdi)
+  804a32:	80 00 00             	addb   $0x0,(%rax)
+  804a35:	00 00                	add    %al,(%rax)
+  804a37:	00 8f 0b 80 00 00    	add    %cl,0x800b(%rdi)
+  804a3d:	00 00                	add    %al,(%rax)
+  804a3f:	00 8f 0b 80 00 00    	add    %cl,0x800b(%rdi)
+  804a45:	00 00                	add    %al,(%rax)
+  804a47:	00 8f 0b 80 00 00    	add    %cl,0x800b(%rdi)
+  804a4d:	00 00                	add    %al,(%rax)
+  804a4f:	00 8f 0b 80 00 00    	add    %cl,0x800b(%rdi)
+  804a55:	00 00                	add    %al,(%rax)
+  804a57:	00 6d 05             	add    %ch,0x5(%rbp)
+  804a5a:	80 00 00             	addb   $0x0,(%rax)
+  804a5d:	00 00                	add    %al,(%rax)
+  804a5f:	00 8f 0b 80 00 00    	add    %cl,0x800b(%rdi)
+  804a65:	00 00                	add    %al,(%rax)
+  804a67:	00 8f 0b 80 00 00    	add    %cl,0x800b(%rdi)
+  804a6d:	00 00                	add    %al,(%rax)
+  804a6f:	00 61 05             	add    %ah,0x5(%rcx)
+  804a72:	80 00 00             	addb   $0x0,(%rax)
+  804a75:	00 00                	add    %al,(%rax)
+  804a77:	00 db                	add    %bl,%bl
+  804a79:	05 80 00 00 00       	add    $0x80,%eax
+  804a7e:	00 00                	add    %al,(%rax)
+  804a80:	8f                   	(bad)
+  804a81:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804a87:	00 61 05             	add    %ah,0x5(%rcx)
+  804a8a:	80 00 00             	addb   $0x0,(%rax)
+  804a8d:	00 00                	add    %al,(%rax)
+  804a8f:	00 a7 05 80 00 00    	add    %ah,0x8005(%rdi)
+  804a95:	00 00                	add    %al,(%rax)
+  804a97:	00 a7 05 80 00 00    	add    %ah,0x8005(%rdi)
+  804a9d:	00 00                	add    %al,(%rax)
+  804a9f:	00 a7 05 80 00 00    	add    %ah,0x8005(%rdi)
+  804aa5:	00 00                	add    %al,(%rax)
+  804aa7:	00 a7 05 80 00 00    	add    %ah,0x8005(%rdi)
+  804aad:	00 00                	add    %al,(%rax)
+  804aaf:	00 a7 05 80 00 00    	add    %ah,0x8005(%rdi)
+  804ab5:	00 00                	add    %al,(%rax)
+  804ab7:	00 a7 05 80 00 00    	add    %ah,0x8005(%rdi)
+  804abd:	00 00                	add    %al,(%rax)
+  804abf:	00 a7 05 80 00 00    	add    %ah,0x8005(%rdi)
+  804ac5:	00 00                	add    %al,(%rax)
+  804ac7:	00 a7 05 80 00 00    	add    %ah,0x8005(%rdi)
+  804acd:	00 00                	add    %al,(%rax)
+  804acf:	00 a7 05 80 00 00    	add    %ah,0x8005(%rdi)
+  804ad5:	00 00                	add    %al,(%rax)
+  804ad7:	00 8f 0b 80 00 00    	add    %cl,0x800b(%rdi)
+  804add:	00 00                	add    %al,(%rax)
+  804adf:	00 8f 0b 80 00 00    	add    %cl,0x800b(%rdi)
+  804ae5:	00 00                	add    %al,(%rax)
+  804ae7:	00 8f 0b 80 00 00    	add    %cl,0x800b(%rdi)
+  804aed:	00 00                	add    %al,(%rax)
+  804aef:	00 8f 0b 80 00 00    	add    %cl,0x800b(%rdi)
+  804af5:	00 00                	add    %al,(%rax)
+  804af7:	00 8f 0b 80 00 00    	add    %cl,0x800b(%rdi)
+  804afd:	00 00                	add    %al,(%rax)
+  804aff:	00 8f 0b 80 00 00    	add    %cl,0x800b(%rdi)
+  804b05:	00 00                	add    %al,(%rax)
+  804b07:	00 8f 0b 80 00 00    	add    %cl,0x800b(%rdi)
+  804b0d:	00 00                	add    %al,(%rax)
+  804b0f:	00 8f 0b 80 00 00    	add    %cl,0x800b(%rdi)
+  804b15:	00 00                	add    %al,(%rax)
+  804b17:	00 8f 0b 80 00 00    	add    %cl,0x800b(%rdi)
+  804b1d:	00 00                	add    %al,(%rax)
+  804b1f:	00 8f 0b 80 00 00    	add    %cl,0x800b(%rdi)
+  804b25:	00 00                	add    %al,(%rax)
+  804b27:	00 8f 0b 80 00 00    	add    %cl,0x800b(%rdi)
+  804b2d:	00 00                	add    %al,(%rax)
+  804b2f:	00 8f 0b 80 00 00    	add    %cl,0x800b(%rdi)
+  804b35:	00 00                	add    %al,(%rax)
+  804b37:	00 8f 0b 80 00 00    	add    %cl,0x800b(%rdi)
+  804b3d:	00 00                	add    %al,(%rax)
+  804b3f:	00 8f 0b 80 00 00    	add    %cl,0x800b(%rdi)
+  804b45:	00 00                	add    %al,(%rax)
+  804b47:	00 8f 0b 80 00 00    	add    %cl,0x800b(%rdi)
+  804b4d:	00 00                	add    %al,(%rax)
+  804b4f:	00 8f 0b 80 00 00    	add    %cl,0x800b(%rdi)
+  804b55:	00 00                	add    %al,(%rax)
+  804b57:	00 8f 0b 80 00 00    	add    %cl,0x800b(%rdi)
+  804b5d:	00 00                	add    %al,(%rax)
+  804b5f:	00 8f 0b 80 00 00    	add    %cl,0x800b(%rdi)
+  804b65:	00 00                	add    %al,(%rax)
+  804b67:	00 8f 0b 80 00 00    	add    %cl,0x800b(%rdi)
+  804b6d:	00 00                	add    %al,(%rax)
+  804b6f:	00 8f 0b 80 00 00    	add    %cl,0x800b(%rdi)
+  804b75:	00 00                	add    %al,(%rax)
+  804b77:	00 8f 0b 80 00 00    	add    %cl,0x800b(%rdi)
+  804b7d:	00 00                	add    %al,(%rax)
+  804b7f:	00 8f 0b 80 00 00    	add    %cl,0x800b(%rdi)
+  804b85:	00 00                	add    %al,(%rax)
+  804b87:	00 8f 0b 80 00 00    	add    %cl,0x800b(%rdi)
+  804b8d:	00 00                	add    %al,(%rax)
+  804b8f:	00 8f 0b 80 00 00    	add    %cl,0x800b(%rdi)
+  804b95:	00 00                	add    %al,(%rax)
+  804b97:	00 8f 0b 80 00 00    	add    %cl,0x800b(%rdi)
+  804b9d:	00 00                	add    %al,(%rax)
+  804b9f:	00 8f 0b 80 00 00    	add    %cl,0x800b(%rdi)
+  804ba5:	00 00                	add    %al,(%rax)
+  804ba7:	00 8f 0b 80 00 00    	add    %cl,0x800b(%rdi)
+  804bad:	00 00                	add    %al,(%rax)
+  804baf:	00 8f 0b 80 00 00    	add    %cl,0x800b(%rdi)
+  804bb5:	00 00                	add    %al,(%rax)
+  804bb7:	00 8f 0b 80 00 00    	add    %cl,0x800b(%rdi)
+  804bbd:	00 00                	add    %al,(%rax)
+  804bbf:	00 8f 0b 80 00 00    	add    %cl,0x800b(%rdi)
+  804bc5:	00 00                	add    %al,(%rax)
+  804bc7:	00 b2 0a 80 00 00    	add    %dh,0x800a(%rdx)
+  804bcd:	00 00                	add    %al,(%rax)
+  804bcf:	00 8f 0b 80 00 00    	add    %cl,0x800b(%rdi)
+  804bd5:	00 00                	add    %al,(%rax)
+  804bd7:	00 8f 0b 80 00 00    	add    %cl,0x800b(%rdi)
+  804bdd:	00 00                	add    %al,(%rax)
+  804bdf:	00 8f 0b 80 00 00    	add    %cl,0x800b(%rdi)
+  804be5:	00 00                	add    %al,(%rax)
+  804be7:	00 8f 0b 80 00 00    	add    %cl,0x800b(%rdi)
+  804bed:	00 00                	add    %al,(%rax)
+  804bef:	00 8f 0b 80 00 00    	add    %cl,0x800b(%rdi)
+  804bf5:	00 00                	add    %al,(%rax)
+  804bf7:	00 8f 0b 80 00 00    	add    %cl,0x800b(%rdi)
+  804bfd:	00 00                	add    %al,(%rax)
+  804bff:	00 8f 0b 80 00 00    	add    %cl,0x800b(%rdi)
+  804c05:	00 00                	add    %al,(%rax)
+  804c07:	00 8f 0b 80 00 00    	add    %cl,0x800b(%rdi)
+  804c0d:	00 00                	add    %al,(%rax)
+  804c0f:	00 8f 0b 80 00 00    	add    %cl,0x800b(%rdi)
+  804c15:	00 00                	add    %al,(%rax)
+  804c17:	00 8f 0b 80 00 00    	add    %cl,0x800b(%rdi)
+  804c1d:	00 00                	add    %al,(%rax)
+  804c1f:	00 fe                	add    %bh,%dh
+  804c21:	05 80 00 00 00       	add    $0x80,%eax
+  804c26:	00 00                	add    %al,(%rax)
+  804c28:	cd 07                	int    $0x7
+  804c2a:	80 00 00             	addb   $0x0,(%rax)
+  804c2d:	00 00                	add    %al,(%rax)
+  804c2f:	00 8f 0b 80 00 00    	add    %cl,0x800b(%rdi)
+  804c35:	00 00                	add    %al,(%rax)
+  804c37:	00 8f 0b 80 00 00    	add    %cl,0x800b(%rdi)
+  804c3d:	00 00                	add    %al,(%rax)
+  804c3f:	00 8f 0b 80 00 00    	add    %cl,0x800b(%rdi)
+  804c45:	00 00                	add    %al,(%rax)
+  804c47:	00 8f 0b 80 00 00    	add    %cl,0x800b(%rdi)
+  804c4d:	00 00                	add    %al,(%rax)
+  804c4f:	00 2d 06 80 00 00    	add    %ch,0x8006(%rip)        # 80cc5b <__ctors_end+0x7b7b>
+  804c55:	00 00                	add    %al,(%rax)
+  804c57:	00 8f 0b 80 00 00    	add    %cl,0x800b(%rdi)
+  804c5d:	00 00                	add    %al,(%rax)
+  804c5f:	00 8f 0b 80 00 00    	add    %cl,0x800b(%rdi)
+  804c65:	00 00                	add    %al,(%rax)
+  804c67:	00 f3                	add    %dh,%bl
+  804c69:	05 80 00 00 00       	add    $0x80,%eax
+  804c6e:	00 00                	add    %al,(%rax)
+  804c70:	8f                   	(bad)
+  804c71:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804c77:	00 8f 0b 80 00 00    	add    %cl,0x800b(%rdi)
+  804c7d:	00 00                	add    %al,(%rax)
+  804c7f:	00 75 09             	add    %dh,0x9(%rbp)
+  804c82:	80 00 00             	addb   $0x0,(%rax)
+  804c85:	00 00                	add    %al,(%rax)
+  804c87:	00 3f                	add    %bh,(%rdi)
+  804c89:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c8f:	00 8f 0b 80 00 00    	add    %cl,0x800b(%rdi)
+  804c95:	00 00                	add    %al,(%rax)
+  804c97:	00 8f 0b 80 00 00    	add    %cl,0x800b(%rdi)
+  804c9d:	00 00                	add    %al,(%rax)
+  804c9f:	00 c4                	add    %al,%ah
+  804ca1:	06                   	(bad)
+  804ca2:	80 00 00             	addb   $0x0,(%rax)
+  804ca5:	00 00                	add    %al,(%rax)
+  804ca7:	00 8f 0b 80 00 00    	add    %cl,0x800b(%rdi)
+  804cad:	00 00                	add    %al,(%rax)
+  804caf:	00 a1 08 80 00 00    	add    %ah,0x8008(%rcx)
+  804cb5:	00 00                	add    %al,(%rax)
+  804cb7:	00 8f 0b 80 00 00    	add    %cl,0x800b(%rdi)
+  804cbd:	00 00                	add    %al,(%rax)
+  804cbf:	00 8f 0b 80 00 00    	add    %cl,0x800b(%rdi)
+  804cc5:	00 00                	add    %al,(%rax)
+  804cc7:	00 b2 0a 80 00 00    	add    %dh,0x800a(%rdx)
+  804ccd:	00 00                	add    %al,(%rax)
+  804ccf:	00 8f 0b 80 00 00    	add    %cl,0x800b(%rdi)
+  804cd5:	00 00                	add    %al,(%rax)
+  804cd7:	00 57 05             	add    %dl,0x5(%rdi)
+  804cda:	80 00 00             	addb   $0x0,(%rax)
+  804cdd:	00 00                	add    %al,(%rax)
+	...
+
+0000000000804ce0 <error_string>:
+	...
+  804ce8:	8d 48 80 00 00 00 00 00 9f 48 80 00 00 00 00 00     .H.......H......
+  804cf8:	af 48 80 00 00 00 00 00 c1 48 80 00 00 00 00 00     .H.......H......
+  804d08:	cf 48 80 00 00 00 00 00 e3 48 80 00 00 00 00 00     .H.......H......
+  804d18:	f8 48 80 00 00 00 00 00 0b 49 80 00 00 00 00 00     .H.......I......
+  804d28:	1d 49 80 00 00 00 00 00 31 49 80 00 00 00 00 00     .I......1I......
+  804d38:	41 49 80 00 00 00 00 00 54 49 80 00 00 00 00 00     AI......TI......
+  804d48:	6b 49 80 00 00 00 00 00 81 49 80 00 00 00 00 00     kI.......I......
+  804d58:	99 49 80 00 00 00 00 00 b1 49 80 00 00 00 00 00     .I.......I......
+  804d68:	be 49 80 00 00 00 00 00 98 4d 80 00 00 00 00 00     .I.......M......
+  804d78:	d2 49 80 00 00 00 00 00 ea 49 80 00 00 00 00 00     .I.......I......
+  804d88:	f4 49 80 00 00 00 00 00 fe 49 80 00 00 00 00 00     .I.......I......
+  804d98:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  804da8:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  804db8:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  804dc8:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  804dd8:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  804de8:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  804df8:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  804e08:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  804e18:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  804e28:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  804e38:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  804e48:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  804e58:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  804e68:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e78:	0f 1f 84 00 00 00 00 00                             ........
+
+0000000000804e80 <devtab>:
+  804e80:	20 50 80 00 00 00 00 00 60 50 80 00 00 00 00 00      P......`P......
+  804e90:	a0 50 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .P..............
+  804ea0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  804eb0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  804ec0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  804ed0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  804ee0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  804ef0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  804f00:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  804f10:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  804f20:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  804f30:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  804f40:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  804f50:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  804f60:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  804f70:	69 70 63 5f 73 65 6e 64 20 65 72 72 6f 72 3a 20     ipc_send error: 
+  804f80:	25 69 0a 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e     %i..lib/ipc.c.f.
+  804f90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804fa0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804fb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804fc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804fd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804fe0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ff0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 40 00     ..f...........@.
@@ -0,0 +1,8268 @@
+
+obj/user/testbss:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 35 01 00 00       	call   800158 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#define ARRAYSIZE (1024 * 1024)
+
+uint32_t bigarray[ARRAYSIZE];
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    int i;
+
+    cprintf("Making sure bss works right...\n");
+  800029:	48 bf b8 47 80 00 00 	movabs $0x8047b8,%rdi
+  800030:	00 00 00 
+  800033:	b8 00 00 00 00       	mov    $0x0,%eax
+  800038:	48 ba 7e 03 80 00 00 	movabs $0x80037e,%rdx
+  80003f:	00 00 00 
+  800042:	ff d2                	call   *%rdx
+  800044:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (i = 0; i < ARRAYSIZE; i++)
+        if (bigarray[i] != 0)
+  800049:	48 b8 00 00 81 00 00 	movabs $0x810000,%rax
+  800050:	00 00 00 
+  800053:	83 3c 88 00          	cmpl   $0x0,(%rax,%rcx,4)
+  800057:	0f 85 a5 00 00 00    	jne    800102 <umain+0xdd>
+    for (i = 0; i < ARRAYSIZE; i++)
+  80005d:	48 83 c1 01          	add    $0x1,%rcx
+  800061:	48 81 f9 00 00 10 00 	cmp    $0x100000,%rcx
+  800068:	75 e9                	jne    800053 <umain+0x2e>
+  80006a:	b8 00 00 00 00       	mov    $0x0,%eax
+            panic("bigarray[%d] isn't cleared!\n", i);
+    for (i = 0; i < ARRAYSIZE; i++)
+        bigarray[i] = i;
+  80006f:	48 ba 00 00 81 00 00 	movabs $0x810000,%rdx
+  800076:	00 00 00 
+  800079:	89 04 82             	mov    %eax,(%rdx,%rax,4)
+    for (i = 0; i < ARRAYSIZE; i++)
+  80007c:	48 83 c0 01          	add    $0x1,%rax
+  800080:	48 3d 00 00 10 00    	cmp    $0x100000,%rax
+  800086:	75 f1                	jne    800079 <umain+0x54>
+  800088:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (i = 0; i < ARRAYSIZE; i++)
+        if (bigarray[i] != i)
+  80008d:	48 b8 00 00 81 00 00 	movabs $0x810000,%rax
+  800094:	00 00 00 
+  800097:	39 0c 88             	cmp    %ecx,(%rax,%rcx,4)
+  80009a:	0f 85 8d 00 00 00    	jne    80012d <umain+0x108>
+    for (i = 0; i < ARRAYSIZE; i++)
+  8000a0:	48 83 c1 01          	add    $0x1,%rcx
+  8000a4:	48 81 f9 00 00 10 00 	cmp    $0x100000,%rcx
+  8000ab:	75 ea                	jne    800097 <umain+0x72>
+            panic("bigarray[%d] didn't hold its value!\n", i);
+
+    cprintf("Yes, good.  Now doing a wild write off the end...\n");
+  8000ad:	48 bf 00 48 80 00 00 	movabs $0x804800,%rdi
+  8000b4:	00 00 00 
+  8000b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000bc:	48 ba 7e 03 80 00 00 	movabs $0x80037e,%rdx
+  8000c3:	00 00 00 
+  8000c6:	ff d2                	call   *%rdx
+
+    /* Accessing via subscript operator ([]) will result in -Warray-bounds warning. */
+    *((volatile uint32_t *)bigarray + ARRAYSIZE + 0x800000) = 0;
+  8000c8:	48 b8 00 00 c1 02 00 	movabs $0x2c10000,%rax
+  8000cf:	00 00 00 
+  8000d2:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    panic("SHOULD HAVE TRAPPED!!!");
+  8000d8:	48 ba 5f 48 80 00 00 	movabs $0x80485f,%rdx
+  8000df:	00 00 00 
+  8000e2:	be 1b 00 00 00       	mov    $0x1b,%esi
+  8000e7:	48 bf 50 48 80 00 00 	movabs $0x804850,%rdi
+  8000ee:	00 00 00 
+  8000f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000f6:	48 b9 2e 02 80 00 00 	movabs $0x80022e,%rcx
+  8000fd:	00 00 00 
+  800100:	ff d1                	call   *%rcx
+            panic("bigarray[%d] isn't cleared!\n", i);
+  800102:	48 ba 33 48 80 00 00 	movabs $0x804833,%rdx
+  800109:	00 00 00 
+  80010c:	be 10 00 00 00       	mov    $0x10,%esi
+  800111:	48 bf 50 48 80 00 00 	movabs $0x804850,%rdi
+  800118:	00 00 00 
+  80011b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800120:	49 b8 2e 02 80 00 00 	movabs $0x80022e,%r8
+  800127:	00 00 00 
+  80012a:	41 ff d0             	call   *%r8
+            panic("bigarray[%d] didn't hold its value!\n", i);
+  80012d:	48 ba d8 47 80 00 00 	movabs $0x8047d8,%rdx
+  800134:	00 00 00 
+  800137:	be 15 00 00 00       	mov    $0x15,%esi
+  80013c:	48 bf 50 48 80 00 00 	movabs $0x804850,%rdi
+  800143:	00 00 00 
+  800146:	b8 00 00 00 00       	mov    $0x0,%eax
+  80014b:	49 b8 2e 02 80 00 00 	movabs $0x80022e,%r8
+  800152:	00 00 00 
+  800155:	41 ff d0             	call   *%r8
+
+0000000000800158 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800158:	55                   	push   %rbp
+  800159:	48 89 e5             	mov    %rsp,%rbp
+  80015c:	41 56                	push   %r14
+  80015e:	41 55                	push   %r13
+  800160:	41 54                	push   %r12
+  800162:	53                   	push   %rbx
+  800163:	41 89 fd             	mov    %edi,%r13d
+  800166:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800169:	48 ba e0 50 80 00 00 	movabs $0x8050e0,%rdx
+  800170:	00 00 00 
+  800173:	48 b8 e0 50 80 00 00 	movabs $0x8050e0,%rax
+  80017a:	00 00 00 
+  80017d:	48 39 c2             	cmp    %rax,%rdx
+  800180:	73 17                	jae    800199 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800182:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800185:	49 89 c4             	mov    %rax,%r12
+  800188:	48 83 c3 08          	add    $0x8,%rbx
+  80018c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800191:	ff 53 f8             	call   *-0x8(%rbx)
+  800194:	4c 39 e3             	cmp    %r12,%rbx
+  800197:	72 ef                	jb     800188 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800199:	48 b8 75 11 80 00 00 	movabs $0x801175,%rax
+  8001a0:	00 00 00 
+  8001a3:	ff d0                	call   *%rax
+  8001a5:	89 c2                	mov    %eax,%edx
+  8001a7:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  8001ad:	48 89 d0             	mov    %rdx,%rax
+  8001b0:	48 c1 e0 04          	shl    $0x4,%rax
+  8001b4:	48 29 d0             	sub    %rdx,%rax
+  8001b7:	48 c1 e0 05          	shl    $0x5,%rax
+  8001bb:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8001c2:	00 00 00 
+  8001c5:	48 01 d0             	add    %rdx,%rax
+  8001c8:	48 a3 00 00 c1 00 00 	movabs %rax,0xc10000
+  8001cf:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8001d2:	45 85 ed             	test   %r13d,%r13d
+  8001d5:	7e 0d                	jle    8001e4 <libmain+0x8c>
+  8001d7:	49 8b 06             	mov    (%r14),%rax
+  8001da:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8001e1:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8001e4:	4c 89 f6             	mov    %r14,%rsi
+  8001e7:	44 89 ef             	mov    %r13d,%edi
+  8001ea:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8001f1:	00 00 00 
+  8001f4:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8001f6:	48 b8 0b 02 80 00 00 	movabs $0x80020b,%rax
+  8001fd:	00 00 00 
+  800200:	ff d0                	call   *%rax
+#endif
+}
+  800202:	5b                   	pop    %rbx
+  800203:	41 5c                	pop    %r12
+  800205:	41 5d                	pop    %r13
+  800207:	41 5e                	pop    %r14
+  800209:	5d                   	pop    %rbp
+  80020a:	c3                   	ret
+
+000000000080020b <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80020b:	55                   	push   %rbp
+  80020c:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80020f:	48 b8 5b 18 80 00 00 	movabs $0x80185b,%rax
+  800216:	00 00 00 
+  800219:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80021b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800220:	48 b8 12 11 80 00 00 	movabs $0x801112,%rax
+  800227:	00 00 00 
+  80022a:	ff d0                	call   *%rax
+}
+  80022c:	5d                   	pop    %rbp
+  80022d:	c3                   	ret
+
+000000000080022e <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80022e:	55                   	push   %rbp
+  80022f:	48 89 e5             	mov    %rsp,%rbp
+  800232:	41 56                	push   %r14
+  800234:	41 55                	push   %r13
+  800236:	41 54                	push   %r12
+  800238:	53                   	push   %rbx
+  800239:	48 83 ec 50          	sub    $0x50,%rsp
+  80023d:	49 89 fc             	mov    %rdi,%r12
+  800240:	41 89 f5             	mov    %esi,%r13d
+  800243:	48 89 d3             	mov    %rdx,%rbx
+  800246:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80024a:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80024e:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800252:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800259:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80025d:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800261:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800265:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800269:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  800270:	00 00 00 
+  800273:	4c 8b 30             	mov    (%rax),%r14
+  800276:	48 b8 75 11 80 00 00 	movabs $0x801175,%rax
+  80027d:	00 00 00 
+  800280:	ff d0                	call   *%rax
+  800282:	89 c6                	mov    %eax,%esi
+  800284:	45 89 e8             	mov    %r13d,%r8d
+  800287:	4c 89 e1             	mov    %r12,%rcx
+  80028a:	4c 89 f2             	mov    %r14,%rdx
+  80028d:	48 bf 80 48 80 00 00 	movabs $0x804880,%rdi
+  800294:	00 00 00 
+  800297:	b8 00 00 00 00       	mov    $0x0,%eax
+  80029c:	49 bc 7e 03 80 00 00 	movabs $0x80037e,%r12
+  8002a3:	00 00 00 
+  8002a6:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8002a9:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8002ad:	48 89 df             	mov    %rbx,%rdi
+  8002b0:	48 b8 1a 03 80 00 00 	movabs $0x80031a,%rax
+  8002b7:	00 00 00 
+  8002ba:	ff d0                	call   *%rax
+    cprintf("\n");
+  8002bc:	48 bf 4e 48 80 00 00 	movabs $0x80484e,%rdi
+  8002c3:	00 00 00 
+  8002c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002cb:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8002ce:	cc                   	int3
+  8002cf:	eb fd                	jmp    8002ce <_panic+0xa0>
+
+00000000008002d1 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8002d1:	55                   	push   %rbp
+  8002d2:	48 89 e5             	mov    %rsp,%rbp
+  8002d5:	53                   	push   %rbx
+  8002d6:	48 83 ec 08          	sub    $0x8,%rsp
+  8002da:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8002dd:	8b 06                	mov    (%rsi),%eax
+  8002df:	8d 50 01             	lea    0x1(%rax),%edx
+  8002e2:	89 16                	mov    %edx,(%rsi)
+  8002e4:	48 98                	cltq
+  8002e6:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8002eb:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8002f1:	74 0a                	je     8002fd <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8002f3:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8002f7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002fb:	c9                   	leave
+  8002fc:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8002fd:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800301:	be ff 00 00 00       	mov    $0xff,%esi
+  800306:	48 b8 ca 10 80 00 00 	movabs $0x8010ca,%rax
+  80030d:	00 00 00 
+  800310:	ff d0                	call   *%rax
+        state->offset = 0;
+  800312:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800318:	eb d9                	jmp    8002f3 <putch+0x22>
+
+000000000080031a <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80031a:	55                   	push   %rbp
+  80031b:	48 89 e5             	mov    %rsp,%rbp
+  80031e:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800325:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800328:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80032f:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800334:	b8 00 00 00 00       	mov    $0x0,%eax
+  800339:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80033c:	48 89 f1             	mov    %rsi,%rcx
+  80033f:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800346:	48 bf d1 02 80 00 00 	movabs $0x8002d1,%rdi
+  80034d:	00 00 00 
+  800350:	48 b8 ce 04 80 00 00 	movabs $0x8004ce,%rax
+  800357:	00 00 00 
+  80035a:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80035c:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800363:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80036a:	48 b8 ca 10 80 00 00 	movabs $0x8010ca,%rax
+  800371:	00 00 00 
+  800374:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800376:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80037c:	c9                   	leave
+  80037d:	c3                   	ret
+
+000000000080037e <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80037e:	55                   	push   %rbp
+  80037f:	48 89 e5             	mov    %rsp,%rbp
+  800382:	48 83 ec 50          	sub    $0x50,%rsp
+  800386:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80038a:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80038e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800392:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800396:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80039a:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8003a1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003a5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003a9:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8003ad:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8003b1:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8003b5:	48 b8 1a 03 80 00 00 	movabs $0x80031a,%rax
+  8003bc:	00 00 00 
+  8003bf:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8003c1:	c9                   	leave
+  8003c2:	c3                   	ret
+
+00000000008003c3 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8003c3:	55                   	push   %rbp
+  8003c4:	48 89 e5             	mov    %rsp,%rbp
+  8003c7:	41 57                	push   %r15
+  8003c9:	41 56                	push   %r14
+  8003cb:	41 55                	push   %r13
+  8003cd:	41 54                	push   %r12
+  8003cf:	53                   	push   %rbx
+  8003d0:	48 83 ec 18          	sub    $0x18,%rsp
+  8003d4:	49 89 fc             	mov    %rdi,%r12
+  8003d7:	49 89 f5             	mov    %rsi,%r13
+  8003da:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8003de:	8b 45 10             	mov    0x10(%rbp),%eax
+  8003e1:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8003e4:	41 89 cf             	mov    %ecx,%r15d
+  8003e7:	4c 39 fa             	cmp    %r15,%rdx
+  8003ea:	73 5b                	jae    800447 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8003ec:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8003f0:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8003f4:	85 db                	test   %ebx,%ebx
+  8003f6:	7e 0e                	jle    800406 <print_num+0x43>
+            putch(padc, put_arg);
+  8003f8:	4c 89 ee             	mov    %r13,%rsi
+  8003fb:	44 89 f7             	mov    %r14d,%edi
+  8003fe:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800401:	83 eb 01             	sub    $0x1,%ebx
+  800404:	75 f2                	jne    8003f8 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800406:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80040a:	48 b9 b4 48 80 00 00 	movabs $0x8048b4,%rcx
+  800411:	00 00 00 
+  800414:	48 b8 a3 48 80 00 00 	movabs $0x8048a3,%rax
+  80041b:	00 00 00 
+  80041e:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800422:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800426:	ba 00 00 00 00       	mov    $0x0,%edx
+  80042b:	49 f7 f7             	div    %r15
+  80042e:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800432:	4c 89 ee             	mov    %r13,%rsi
+  800435:	41 ff d4             	call   *%r12
+}
+  800438:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80043c:	5b                   	pop    %rbx
+  80043d:	41 5c                	pop    %r12
+  80043f:	41 5d                	pop    %r13
+  800441:	41 5e                	pop    %r14
+  800443:	41 5f                	pop    %r15
+  800445:	5d                   	pop    %rbp
+  800446:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800447:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80044b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800450:	49 f7 f7             	div    %r15
+  800453:	48 83 ec 08          	sub    $0x8,%rsp
+  800457:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80045b:	52                   	push   %rdx
+  80045c:	45 0f be c9          	movsbl %r9b,%r9d
+  800460:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800464:	48 89 c2             	mov    %rax,%rdx
+  800467:	48 b8 c3 03 80 00 00 	movabs $0x8003c3,%rax
+  80046e:	00 00 00 
+  800471:	ff d0                	call   *%rax
+  800473:	48 83 c4 10          	add    $0x10,%rsp
+  800477:	eb 8d                	jmp    800406 <print_num+0x43>
+
+0000000000800479 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800479:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80047d:	48 8b 06             	mov    (%rsi),%rax
+  800480:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800484:	73 0a                	jae    800490 <sprintputch+0x17>
+        *state->start++ = ch;
+  800486:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80048a:	48 89 16             	mov    %rdx,(%rsi)
+  80048d:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800490:	c3                   	ret
+
+0000000000800491 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800491:	55                   	push   %rbp
+  800492:	48 89 e5             	mov    %rsp,%rbp
+  800495:	48 83 ec 50          	sub    $0x50,%rsp
+  800499:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80049d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004a1:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8004a5:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8004ac:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8004b0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004b4:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8004b8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8004bc:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8004c0:	48 b8 ce 04 80 00 00 	movabs $0x8004ce,%rax
+  8004c7:	00 00 00 
+  8004ca:	ff d0                	call   *%rax
+}
+  8004cc:	c9                   	leave
+  8004cd:	c3                   	ret
+
+00000000008004ce <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8004ce:	55                   	push   %rbp
+  8004cf:	48 89 e5             	mov    %rsp,%rbp
+  8004d2:	41 57                	push   %r15
+  8004d4:	41 56                	push   %r14
+  8004d6:	41 55                	push   %r13
+  8004d8:	41 54                	push   %r12
+  8004da:	53                   	push   %rbx
+  8004db:	48 83 ec 38          	sub    $0x38,%rsp
+  8004df:	49 89 fe             	mov    %rdi,%r14
+  8004e2:	49 89 f5             	mov    %rsi,%r13
+  8004e5:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8004e8:	48 8b 01             	mov    (%rcx),%rax
+  8004eb:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8004ef:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8004f3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004f7:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8004fb:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8004ff:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800503:	0f b6 3b             	movzbl (%rbx),%edi
+  800506:	40 80 ff 25          	cmp    $0x25,%dil
+  80050a:	74 18                	je     800524 <vprintfmt+0x56>
+            if (!ch) return;
+  80050c:	40 84 ff             	test   %dil,%dil
+  80050f:	0f 84 b1 06 00 00    	je     800bc6 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800515:	40 0f b6 ff          	movzbl %dil,%edi
+  800519:	4c 89 ee             	mov    %r13,%rsi
+  80051c:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80051f:	4c 89 e3             	mov    %r12,%rbx
+  800522:	eb db                	jmp    8004ff <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800524:	be 00 00 00 00       	mov    $0x0,%esi
+  800529:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80052d:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800532:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800538:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80053f:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800543:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800548:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80054d:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800550:	83 e8 23             	sub    $0x23,%eax
+  800553:	3c 57                	cmp    $0x57,%al
+  800555:	0f 87 51 06 00 00    	ja     800bac <vprintfmt+0x6de>
+  80055b:	0f b6 c0             	movzbl %al,%eax
+  80055e:	48 b9 60 4a 80 00 00 	movabs $0x804a60,%rcx
+  800565:	00 00 00 
+  800568:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80056b:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80056e:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800572:	eb cf                	jmp    800543 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800574:	49 89 dc             	mov    %rbx,%r12
+  800577:	be 01 00 00 00       	mov    $0x1,%esi
+  80057c:	eb c5                	jmp    800543 <vprintfmt+0x75>
+            padc = ch;
+  80057e:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800582:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800585:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800588:	eb b9                	jmp    800543 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80058a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80058d:	83 f8 2f             	cmp    $0x2f,%eax
+  800590:	77 24                	ja     8005b6 <vprintfmt+0xe8>
+  800592:	89 c1                	mov    %eax,%ecx
+  800594:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800598:	83 c0 08             	add    $0x8,%eax
+  80059b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80059e:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8005a1:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8005a4:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8005a8:	79 99                	jns    800543 <vprintfmt+0x75>
+                width = precision;
+  8005aa:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8005ae:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8005b4:	eb 8d                	jmp    800543 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8005b6:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8005ba:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8005be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005c2:	eb da                	jmp    80059e <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8005c4:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8005c9:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8005cd:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8005d3:	3c 39                	cmp    $0x39,%al
+  8005d5:	77 1c                	ja     8005f3 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8005d7:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8005db:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8005df:	0f b6 c0             	movzbl %al,%eax
+  8005e2:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8005e7:	0f b6 03             	movzbl (%rbx),%eax
+  8005ea:	3c 39                	cmp    $0x39,%al
+  8005ec:	76 e9                	jbe    8005d7 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8005ee:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8005f1:	eb b1                	jmp    8005a4 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8005f3:	49 89 dc             	mov    %rbx,%r12
+  8005f6:	eb ac                	jmp    8005a4 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8005f8:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8005fb:	85 c9                	test   %ecx,%ecx
+  8005fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800602:	0f 49 c1             	cmovns %ecx,%eax
+  800605:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800608:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80060b:	e9 33 ff ff ff       	jmp    800543 <vprintfmt+0x75>
+            lflag++;
+  800610:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800613:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800616:	e9 28 ff ff ff       	jmp    800543 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80061b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80061e:	83 f8 2f             	cmp    $0x2f,%eax
+  800621:	77 19                	ja     80063c <vprintfmt+0x16e>
+  800623:	89 c2                	mov    %eax,%edx
+  800625:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800629:	83 c0 08             	add    $0x8,%eax
+  80062c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80062f:	8b 3a                	mov    (%rdx),%edi
+  800631:	4c 89 ee             	mov    %r13,%rsi
+  800634:	41 ff d6             	call   *%r14
+            break;
+  800637:	e9 c3 fe ff ff       	jmp    8004ff <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80063c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800640:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800644:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800648:	eb e5                	jmp    80062f <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80064a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80064d:	83 f8 2f             	cmp    $0x2f,%eax
+  800650:	77 5a                	ja     8006ac <vprintfmt+0x1de>
+  800652:	89 c2                	mov    %eax,%edx
+  800654:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800658:	83 c0 08             	add    $0x8,%eax
+  80065b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80065e:	8b 02                	mov    (%rdx),%eax
+  800660:	89 c1                	mov    %eax,%ecx
+  800662:	f7 d9                	neg    %ecx
+  800664:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800667:	83 f9 16             	cmp    $0x16,%ecx
+  80066a:	7f 4e                	jg     8006ba <vprintfmt+0x1ec>
+  80066c:	48 63 c1             	movslq %ecx,%rax
+  80066f:	48 ba 20 4d 80 00 00 	movabs $0x804d20,%rdx
+  800676:	00 00 00 
+  800679:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80067d:	48 85 c0             	test   %rax,%rax
+  800680:	74 38                	je     8006ba <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800682:	48 89 c1             	mov    %rax,%rcx
+  800685:	48 ba f9 4e 80 00 00 	movabs $0x804ef9,%rdx
+  80068c:	00 00 00 
+  80068f:	4c 89 ee             	mov    %r13,%rsi
+  800692:	4c 89 f7             	mov    %r14,%rdi
+  800695:	b8 00 00 00 00       	mov    $0x0,%eax
+  80069a:	49 b8 91 04 80 00 00 	movabs $0x800491,%r8
+  8006a1:	00 00 00 
+  8006a4:	41 ff d0             	call   *%r8
+  8006a7:	e9 53 fe ff ff       	jmp    8004ff <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8006ac:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006b0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006b4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006b8:	eb a4                	jmp    80065e <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8006ba:	48 ba cc 48 80 00 00 	movabs $0x8048cc,%rdx
+  8006c1:	00 00 00 
+  8006c4:	4c 89 ee             	mov    %r13,%rsi
+  8006c7:	4c 89 f7             	mov    %r14,%rdi
+  8006ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006cf:	49 b8 91 04 80 00 00 	movabs $0x800491,%r8
+  8006d6:	00 00 00 
+  8006d9:	41 ff d0             	call   *%r8
+  8006dc:	e9 1e fe ff ff       	jmp    8004ff <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8006e1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006e4:	83 f8 2f             	cmp    $0x2f,%eax
+  8006e7:	77 6c                	ja     800755 <vprintfmt+0x287>
+  8006e9:	89 c2                	mov    %eax,%edx
+  8006eb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006ef:	83 c0 08             	add    $0x8,%eax
+  8006f2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006f5:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8006f8:	48 85 d2             	test   %rdx,%rdx
+  8006fb:	48 b8 c5 48 80 00 00 	movabs $0x8048c5,%rax
+  800702:	00 00 00 
+  800705:	48 0f 45 c2          	cmovne %rdx,%rax
+  800709:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80070d:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800711:	7e 06                	jle    800719 <vprintfmt+0x24b>
+  800713:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800717:	75 4a                	jne    800763 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800719:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80071d:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800721:	0f b6 00             	movzbl (%rax),%eax
+  800724:	84 c0                	test   %al,%al
+  800726:	0f 85 9a 00 00 00    	jne    8007c6 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80072c:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80072f:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800733:	85 c0                	test   %eax,%eax
+  800735:	0f 8e c4 fd ff ff    	jle    8004ff <vprintfmt+0x31>
+  80073b:	4c 89 ee             	mov    %r13,%rsi
+  80073e:	bf 20 00 00 00       	mov    $0x20,%edi
+  800743:	41 ff d6             	call   *%r14
+  800746:	41 83 ec 01          	sub    $0x1,%r12d
+  80074a:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80074e:	75 eb                	jne    80073b <vprintfmt+0x26d>
+  800750:	e9 aa fd ff ff       	jmp    8004ff <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800755:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800759:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80075d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800761:	eb 92                	jmp    8006f5 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800763:	49 63 f7             	movslq %r15d,%rsi
+  800766:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80076a:	48 b8 80 0c 80 00 00 	movabs $0x800c80,%rax
+  800771:	00 00 00 
+  800774:	ff d0                	call   *%rax
+  800776:	48 89 c2             	mov    %rax,%rdx
+  800779:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80077c:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80077e:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800781:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800784:	85 c0                	test   %eax,%eax
+  800786:	7e 91                	jle    800719 <vprintfmt+0x24b>
+  800788:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80078d:	4c 89 ee             	mov    %r13,%rsi
+  800790:	44 89 e7             	mov    %r12d,%edi
+  800793:	41 ff d6             	call   *%r14
+  800796:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80079a:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80079d:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8007a0:	75 eb                	jne    80078d <vprintfmt+0x2bf>
+  8007a2:	e9 72 ff ff ff       	jmp    800719 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8007a7:	0f b6 f8             	movzbl %al,%edi
+  8007aa:	4c 89 ee             	mov    %r13,%rsi
+  8007ad:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8007b0:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8007b4:	49 83 c4 01          	add    $0x1,%r12
+  8007b8:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8007be:	84 c0                	test   %al,%al
+  8007c0:	0f 84 66 ff ff ff    	je     80072c <vprintfmt+0x25e>
+  8007c6:	45 85 ff             	test   %r15d,%r15d
+  8007c9:	78 0a                	js     8007d5 <vprintfmt+0x307>
+  8007cb:	41 83 ef 01          	sub    $0x1,%r15d
+  8007cf:	0f 88 57 ff ff ff    	js     80072c <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8007d5:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8007d9:	74 cc                	je     8007a7 <vprintfmt+0x2d9>
+  8007db:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8007de:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8007e3:	80 fa 5e             	cmp    $0x5e,%dl
+  8007e6:	77 c2                	ja     8007aa <vprintfmt+0x2dc>
+  8007e8:	eb bd                	jmp    8007a7 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8007ea:	40 84 f6             	test   %sil,%sil
+  8007ed:	75 26                	jne    800815 <vprintfmt+0x347>
+    switch (lflag) {
+  8007ef:	85 d2                	test   %edx,%edx
+  8007f1:	74 59                	je     80084c <vprintfmt+0x37e>
+  8007f3:	83 fa 01             	cmp    $0x1,%edx
+  8007f6:	74 7b                	je     800873 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8007f8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007fb:	83 f8 2f             	cmp    $0x2f,%eax
+  8007fe:	0f 87 96 00 00 00    	ja     80089a <vprintfmt+0x3cc>
+  800804:	89 c2                	mov    %eax,%edx
+  800806:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80080a:	83 c0 08             	add    $0x8,%eax
+  80080d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800810:	4c 8b 22             	mov    (%rdx),%r12
+  800813:	eb 17                	jmp    80082c <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800815:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800818:	83 f8 2f             	cmp    $0x2f,%eax
+  80081b:	77 21                	ja     80083e <vprintfmt+0x370>
+  80081d:	89 c2                	mov    %eax,%edx
+  80081f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800823:	83 c0 08             	add    $0x8,%eax
+  800826:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800829:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80082c:	4d 85 e4             	test   %r12,%r12
+  80082f:	78 7a                	js     8008ab <vprintfmt+0x3dd>
+            num = i;
+  800831:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800834:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800839:	e9 50 02 00 00       	jmp    800a8e <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80083e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800842:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800846:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80084a:	eb dd                	jmp    800829 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  80084c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80084f:	83 f8 2f             	cmp    $0x2f,%eax
+  800852:	77 11                	ja     800865 <vprintfmt+0x397>
+  800854:	89 c2                	mov    %eax,%edx
+  800856:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80085a:	83 c0 08             	add    $0x8,%eax
+  80085d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800860:	4c 63 22             	movslq (%rdx),%r12
+  800863:	eb c7                	jmp    80082c <vprintfmt+0x35e>
+  800865:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800869:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80086d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800871:	eb ed                	jmp    800860 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800873:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800876:	83 f8 2f             	cmp    $0x2f,%eax
+  800879:	77 11                	ja     80088c <vprintfmt+0x3be>
+  80087b:	89 c2                	mov    %eax,%edx
+  80087d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800881:	83 c0 08             	add    $0x8,%eax
+  800884:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800887:	4c 8b 22             	mov    (%rdx),%r12
+  80088a:	eb a0                	jmp    80082c <vprintfmt+0x35e>
+  80088c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800890:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800894:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800898:	eb ed                	jmp    800887 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  80089a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80089e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008a2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008a6:	e9 65 ff ff ff       	jmp    800810 <vprintfmt+0x342>
+                putch('-', put_arg);
+  8008ab:	4c 89 ee             	mov    %r13,%rsi
+  8008ae:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8008b3:	41 ff d6             	call   *%r14
+                i = -i;
+  8008b6:	49 f7 dc             	neg    %r12
+  8008b9:	e9 73 ff ff ff       	jmp    800831 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8008be:	40 84 f6             	test   %sil,%sil
+  8008c1:	75 32                	jne    8008f5 <vprintfmt+0x427>
+    switch (lflag) {
+  8008c3:	85 d2                	test   %edx,%edx
+  8008c5:	74 5d                	je     800924 <vprintfmt+0x456>
+  8008c7:	83 fa 01             	cmp    $0x1,%edx
+  8008ca:	0f 84 82 00 00 00    	je     800952 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8008d0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008d3:	83 f8 2f             	cmp    $0x2f,%eax
+  8008d6:	0f 87 a5 00 00 00    	ja     800981 <vprintfmt+0x4b3>
+  8008dc:	89 c2                	mov    %eax,%edx
+  8008de:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008e2:	83 c0 08             	add    $0x8,%eax
+  8008e5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008e8:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8008eb:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8008f0:	e9 99 01 00 00       	jmp    800a8e <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8008f5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008f8:	83 f8 2f             	cmp    $0x2f,%eax
+  8008fb:	77 19                	ja     800916 <vprintfmt+0x448>
+  8008fd:	89 c2                	mov    %eax,%edx
+  8008ff:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800903:	83 c0 08             	add    $0x8,%eax
+  800906:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800909:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80090c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800911:	e9 78 01 00 00       	jmp    800a8e <vprintfmt+0x5c0>
+  800916:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80091a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80091e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800922:	eb e5                	jmp    800909 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800924:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800927:	83 f8 2f             	cmp    $0x2f,%eax
+  80092a:	77 18                	ja     800944 <vprintfmt+0x476>
+  80092c:	89 c2                	mov    %eax,%edx
+  80092e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800932:	83 c0 08             	add    $0x8,%eax
+  800935:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800938:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80093a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80093f:	e9 4a 01 00 00       	jmp    800a8e <vprintfmt+0x5c0>
+  800944:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800948:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80094c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800950:	eb e6                	jmp    800938 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800952:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800955:	83 f8 2f             	cmp    $0x2f,%eax
+  800958:	77 19                	ja     800973 <vprintfmt+0x4a5>
+  80095a:	89 c2                	mov    %eax,%edx
+  80095c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800960:	83 c0 08             	add    $0x8,%eax
+  800963:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800966:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800969:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  80096e:	e9 1b 01 00 00       	jmp    800a8e <vprintfmt+0x5c0>
+  800973:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800977:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80097b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80097f:	eb e5                	jmp    800966 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800981:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800985:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800989:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80098d:	e9 56 ff ff ff       	jmp    8008e8 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800992:	40 84 f6             	test   %sil,%sil
+  800995:	75 2e                	jne    8009c5 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800997:	85 d2                	test   %edx,%edx
+  800999:	74 59                	je     8009f4 <vprintfmt+0x526>
+  80099b:	83 fa 01             	cmp    $0x1,%edx
+  80099e:	74 7f                	je     800a1f <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8009a0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009a3:	83 f8 2f             	cmp    $0x2f,%eax
+  8009a6:	0f 87 9f 00 00 00    	ja     800a4b <vprintfmt+0x57d>
+  8009ac:	89 c2                	mov    %eax,%edx
+  8009ae:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009b2:	83 c0 08             	add    $0x8,%eax
+  8009b5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009b8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8009bb:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8009c0:	e9 c9 00 00 00       	jmp    800a8e <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009c5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009c8:	83 f8 2f             	cmp    $0x2f,%eax
+  8009cb:	77 19                	ja     8009e6 <vprintfmt+0x518>
+  8009cd:	89 c2                	mov    %eax,%edx
+  8009cf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009d3:	83 c0 08             	add    $0x8,%eax
+  8009d6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009d9:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8009dc:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8009e1:	e9 a8 00 00 00       	jmp    800a8e <vprintfmt+0x5c0>
+  8009e6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009ea:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009ee:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009f2:	eb e5                	jmp    8009d9 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8009f4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009f7:	83 f8 2f             	cmp    $0x2f,%eax
+  8009fa:	77 15                	ja     800a11 <vprintfmt+0x543>
+  8009fc:	89 c2                	mov    %eax,%edx
+  8009fe:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a02:	83 c0 08             	add    $0x8,%eax
+  800a05:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a08:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800a0a:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800a0f:	eb 7d                	jmp    800a8e <vprintfmt+0x5c0>
+  800a11:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a15:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a19:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a1d:	eb e9                	jmp    800a08 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800a1f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a22:	83 f8 2f             	cmp    $0x2f,%eax
+  800a25:	77 16                	ja     800a3d <vprintfmt+0x56f>
+  800a27:	89 c2                	mov    %eax,%edx
+  800a29:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a2d:	83 c0 08             	add    $0x8,%eax
+  800a30:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a33:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a36:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800a3b:	eb 51                	jmp    800a8e <vprintfmt+0x5c0>
+  800a3d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a41:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a45:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a49:	eb e8                	jmp    800a33 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800a4b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a4f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a53:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a57:	e9 5c ff ff ff       	jmp    8009b8 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800a5c:	4c 89 ee             	mov    %r13,%rsi
+  800a5f:	bf 30 00 00 00       	mov    $0x30,%edi
+  800a64:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800a67:	4c 89 ee             	mov    %r13,%rsi
+  800a6a:	bf 78 00 00 00       	mov    $0x78,%edi
+  800a6f:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800a72:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a75:	83 f8 2f             	cmp    $0x2f,%eax
+  800a78:	77 47                	ja     800ac1 <vprintfmt+0x5f3>
+  800a7a:	89 c2                	mov    %eax,%edx
+  800a7c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a80:	83 c0 08             	add    $0x8,%eax
+  800a83:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a86:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a89:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800a8e:	48 83 ec 08          	sub    $0x8,%rsp
+  800a92:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800a96:	0f 94 c0             	sete   %al
+  800a99:	0f b6 c0             	movzbl %al,%eax
+  800a9c:	50                   	push   %rax
+  800a9d:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800aa2:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800aa6:	4c 89 ee             	mov    %r13,%rsi
+  800aa9:	4c 89 f7             	mov    %r14,%rdi
+  800aac:	48 b8 c3 03 80 00 00 	movabs $0x8003c3,%rax
+  800ab3:	00 00 00 
+  800ab6:	ff d0                	call   *%rax
+            break;
+  800ab8:	48 83 c4 10          	add    $0x10,%rsp
+  800abc:	e9 3e fa ff ff       	jmp    8004ff <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800ac1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ac5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ac9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800acd:	eb b7                	jmp    800a86 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800acf:	40 84 f6             	test   %sil,%sil
+  800ad2:	75 2b                	jne    800aff <vprintfmt+0x631>
+    switch (lflag) {
+  800ad4:	85 d2                	test   %edx,%edx
+  800ad6:	74 56                	je     800b2e <vprintfmt+0x660>
+  800ad8:	83 fa 01             	cmp    $0x1,%edx
+  800adb:	74 7f                	je     800b5c <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800add:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ae0:	83 f8 2f             	cmp    $0x2f,%eax
+  800ae3:	0f 87 a2 00 00 00    	ja     800b8b <vprintfmt+0x6bd>
+  800ae9:	89 c2                	mov    %eax,%edx
+  800aeb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aef:	83 c0 08             	add    $0x8,%eax
+  800af2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800af5:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800af8:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800afd:	eb 8f                	jmp    800a8e <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800aff:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b02:	83 f8 2f             	cmp    $0x2f,%eax
+  800b05:	77 19                	ja     800b20 <vprintfmt+0x652>
+  800b07:	89 c2                	mov    %eax,%edx
+  800b09:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b0d:	83 c0 08             	add    $0x8,%eax
+  800b10:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b13:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b16:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b1b:	e9 6e ff ff ff       	jmp    800a8e <vprintfmt+0x5c0>
+  800b20:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b24:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b28:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b2c:	eb e5                	jmp    800b13 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800b2e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b31:	83 f8 2f             	cmp    $0x2f,%eax
+  800b34:	77 18                	ja     800b4e <vprintfmt+0x680>
+  800b36:	89 c2                	mov    %eax,%edx
+  800b38:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b3c:	83 c0 08             	add    $0x8,%eax
+  800b3f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b42:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800b44:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800b49:	e9 40 ff ff ff       	jmp    800a8e <vprintfmt+0x5c0>
+  800b4e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b52:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b56:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b5a:	eb e6                	jmp    800b42 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800b5c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b5f:	83 f8 2f             	cmp    $0x2f,%eax
+  800b62:	77 19                	ja     800b7d <vprintfmt+0x6af>
+  800b64:	89 c2                	mov    %eax,%edx
+  800b66:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b6a:	83 c0 08             	add    $0x8,%eax
+  800b6d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b70:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b73:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800b78:	e9 11 ff ff ff       	jmp    800a8e <vprintfmt+0x5c0>
+  800b7d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b81:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b85:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b89:	eb e5                	jmp    800b70 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800b8b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b8f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b93:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b97:	e9 59 ff ff ff       	jmp    800af5 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800b9c:	4c 89 ee             	mov    %r13,%rsi
+  800b9f:	bf 25 00 00 00       	mov    $0x25,%edi
+  800ba4:	41 ff d6             	call   *%r14
+            break;
+  800ba7:	e9 53 f9 ff ff       	jmp    8004ff <vprintfmt+0x31>
+            putch('%', put_arg);
+  800bac:	4c 89 ee             	mov    %r13,%rsi
+  800baf:	bf 25 00 00 00       	mov    $0x25,%edi
+  800bb4:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800bb7:	48 83 eb 01          	sub    $0x1,%rbx
+  800bbb:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800bbf:	75 f6                	jne    800bb7 <vprintfmt+0x6e9>
+  800bc1:	e9 39 f9 ff ff       	jmp    8004ff <vprintfmt+0x31>
+}
+  800bc6:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800bca:	5b                   	pop    %rbx
+  800bcb:	41 5c                	pop    %r12
+  800bcd:	41 5d                	pop    %r13
+  800bcf:	41 5e                	pop    %r14
+  800bd1:	41 5f                	pop    %r15
+  800bd3:	5d                   	pop    %rbp
+  800bd4:	c3                   	ret
+
+0000000000800bd5 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800bd5:	55                   	push   %rbp
+  800bd6:	48 89 e5             	mov    %rsp,%rbp
+  800bd9:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800bdd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800be1:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800be6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800bea:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800bf1:	48 85 ff             	test   %rdi,%rdi
+  800bf4:	74 2b                	je     800c21 <vsnprintf+0x4c>
+  800bf6:	48 85 f6             	test   %rsi,%rsi
+  800bf9:	74 26                	je     800c21 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800bfb:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800bff:	48 bf 79 04 80 00 00 	movabs $0x800479,%rdi
+  800c06:	00 00 00 
+  800c09:	48 b8 ce 04 80 00 00 	movabs $0x8004ce,%rax
+  800c10:	00 00 00 
+  800c13:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800c15:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c19:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800c1c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800c1f:	c9                   	leave
+  800c20:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800c21:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c26:	eb f7                	jmp    800c1f <vsnprintf+0x4a>
+
+0000000000800c28 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800c28:	55                   	push   %rbp
+  800c29:	48 89 e5             	mov    %rsp,%rbp
+  800c2c:	48 83 ec 50          	sub    $0x50,%rsp
+  800c30:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800c34:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800c38:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800c3c:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800c43:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800c47:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c4b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800c4f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800c53:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800c57:	48 b8 d5 0b 80 00 00 	movabs $0x800bd5,%rax
+  800c5e:	00 00 00 
+  800c61:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800c63:	c9                   	leave
+  800c64:	c3                   	ret
+
+0000000000800c65 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800c65:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800c68:	74 10                	je     800c7a <strlen+0x15>
+    size_t n = 0;
+  800c6a:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800c6f:	48 83 c0 01          	add    $0x1,%rax
+  800c73:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800c77:	75 f6                	jne    800c6f <strlen+0xa>
+  800c79:	c3                   	ret
+    size_t n = 0;
+  800c7a:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800c7f:	c3                   	ret
+
+0000000000800c80 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800c80:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800c83:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800c88:	48 85 f6             	test   %rsi,%rsi
+  800c8b:	74 11                	je     800c9e <strnlen+0x1e>
+  800c8d:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800c91:	74 0c                	je     800c9f <strnlen+0x1f>
+  800c93:	48 83 c2 01          	add    $0x1,%rdx
+  800c97:	48 39 d0             	cmp    %rdx,%rax
+  800c9a:	75 f1                	jne    800c8d <strnlen+0xd>
+  800c9c:	eb 04                	jmp    800ca2 <strnlen+0x22>
+  800c9e:	c3                   	ret
+  800c9f:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800ca2:	c3                   	ret
+
+0000000000800ca3 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800ca3:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800ca6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cab:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800caf:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800cb2:	48 83 c2 01          	add    $0x1,%rdx
+  800cb6:	84 c9                	test   %cl,%cl
+  800cb8:	75 f1                	jne    800cab <strcpy+0x8>
+        ;
+    return res;
+}
+  800cba:	c3                   	ret
+
+0000000000800cbb <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800cbb:	55                   	push   %rbp
+  800cbc:	48 89 e5             	mov    %rsp,%rbp
+  800cbf:	41 54                	push   %r12
+  800cc1:	53                   	push   %rbx
+  800cc2:	48 89 fb             	mov    %rdi,%rbx
+  800cc5:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800cc8:	48 b8 65 0c 80 00 00 	movabs $0x800c65,%rax
+  800ccf:	00 00 00 
+  800cd2:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800cd4:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800cd8:	4c 89 e6             	mov    %r12,%rsi
+  800cdb:	48 b8 a3 0c 80 00 00 	movabs $0x800ca3,%rax
+  800ce2:	00 00 00 
+  800ce5:	ff d0                	call   *%rax
+    return dst;
+}
+  800ce7:	48 89 d8             	mov    %rbx,%rax
+  800cea:	5b                   	pop    %rbx
+  800ceb:	41 5c                	pop    %r12
+  800ced:	5d                   	pop    %rbp
+  800cee:	c3                   	ret
+
+0000000000800cef <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800cef:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800cf2:	48 85 d2             	test   %rdx,%rdx
+  800cf5:	74 1f                	je     800d16 <strncpy+0x27>
+  800cf7:	48 01 fa             	add    %rdi,%rdx
+  800cfa:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800cfd:	48 83 c1 01          	add    $0x1,%rcx
+  800d01:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800d05:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800d09:	41 80 f8 01          	cmp    $0x1,%r8b
+  800d0d:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800d11:	48 39 ca             	cmp    %rcx,%rdx
+  800d14:	75 e7                	jne    800cfd <strncpy+0xe>
+    }
+    return ret;
+}
+  800d16:	c3                   	ret
+
+0000000000800d17 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800d17:	48 89 f8             	mov    %rdi,%rax
+  800d1a:	48 85 d2             	test   %rdx,%rdx
+  800d1d:	74 24                	je     800d43 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800d1f:	48 83 ea 01          	sub    $0x1,%rdx
+  800d23:	74 1b                	je     800d40 <strlcpy+0x29>
+  800d25:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800d29:	0f b6 16             	movzbl (%rsi),%edx
+  800d2c:	84 d2                	test   %dl,%dl
+  800d2e:	74 10                	je     800d40 <strlcpy+0x29>
+            *dst++ = *src++;
+  800d30:	48 83 c6 01          	add    $0x1,%rsi
+  800d34:	48 83 c0 01          	add    $0x1,%rax
+  800d38:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800d3b:	48 39 c8             	cmp    %rcx,%rax
+  800d3e:	75 e9                	jne    800d29 <strlcpy+0x12>
+        *dst = '\0';
+  800d40:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800d43:	48 29 f8             	sub    %rdi,%rax
+}
+  800d46:	c3                   	ret
+
+0000000000800d47 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800d47:	0f b6 07             	movzbl (%rdi),%eax
+  800d4a:	84 c0                	test   %al,%al
+  800d4c:	74 13                	je     800d61 <strcmp+0x1a>
+  800d4e:	38 06                	cmp    %al,(%rsi)
+  800d50:	75 0f                	jne    800d61 <strcmp+0x1a>
+  800d52:	48 83 c7 01          	add    $0x1,%rdi
+  800d56:	48 83 c6 01          	add    $0x1,%rsi
+  800d5a:	0f b6 07             	movzbl (%rdi),%eax
+  800d5d:	84 c0                	test   %al,%al
+  800d5f:	75 ed                	jne    800d4e <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d61:	0f b6 c0             	movzbl %al,%eax
+  800d64:	0f b6 16             	movzbl (%rsi),%edx
+  800d67:	29 d0                	sub    %edx,%eax
+}
+  800d69:	c3                   	ret
+
+0000000000800d6a <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800d6a:	48 85 d2             	test   %rdx,%rdx
+  800d6d:	74 1f                	je     800d8e <strncmp+0x24>
+  800d6f:	0f b6 07             	movzbl (%rdi),%eax
+  800d72:	84 c0                	test   %al,%al
+  800d74:	74 1e                	je     800d94 <strncmp+0x2a>
+  800d76:	3a 06                	cmp    (%rsi),%al
+  800d78:	75 1a                	jne    800d94 <strncmp+0x2a>
+  800d7a:	48 83 c7 01          	add    $0x1,%rdi
+  800d7e:	48 83 c6 01          	add    $0x1,%rsi
+  800d82:	48 83 ea 01          	sub    $0x1,%rdx
+  800d86:	75 e7                	jne    800d6f <strncmp+0x5>
+
+    if (!n) return 0;
+  800d88:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d8d:	c3                   	ret
+  800d8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d93:	c3                   	ret
+  800d94:	48 85 d2             	test   %rdx,%rdx
+  800d97:	74 09                	je     800da2 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d99:	0f b6 07             	movzbl (%rdi),%eax
+  800d9c:	0f b6 16             	movzbl (%rsi),%edx
+  800d9f:	29 d0                	sub    %edx,%eax
+  800da1:	c3                   	ret
+    if (!n) return 0;
+  800da2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800da7:	c3                   	ret
+
+0000000000800da8 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800da8:	0f b6 17             	movzbl (%rdi),%edx
+  800dab:	84 d2                	test   %dl,%dl
+  800dad:	74 18                	je     800dc7 <strchr+0x1f>
+        if (*str == c) {
+  800daf:	0f be d2             	movsbl %dl,%edx
+  800db2:	39 f2                	cmp    %esi,%edx
+  800db4:	74 17                	je     800dcd <strchr+0x25>
+    for (; *str; str++) {
+  800db6:	48 83 c7 01          	add    $0x1,%rdi
+  800dba:	0f b6 17             	movzbl (%rdi),%edx
+  800dbd:	84 d2                	test   %dl,%dl
+  800dbf:	75 ee                	jne    800daf <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800dc1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dc6:	c3                   	ret
+  800dc7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dcc:	c3                   	ret
+  800dcd:	48 89 f8             	mov    %rdi,%rax
+}
+  800dd0:	c3                   	ret
+
+0000000000800dd1 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800dd1:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800dd4:	0f b6 17             	movzbl (%rdi),%edx
+  800dd7:	84 d2                	test   %dl,%dl
+  800dd9:	74 13                	je     800dee <strfind+0x1d>
+  800ddb:	0f be d2             	movsbl %dl,%edx
+  800dde:	39 f2                	cmp    %esi,%edx
+  800de0:	74 0b                	je     800ded <strfind+0x1c>
+  800de2:	48 83 c0 01          	add    $0x1,%rax
+  800de6:	0f b6 10             	movzbl (%rax),%edx
+  800de9:	84 d2                	test   %dl,%dl
+  800deb:	75 ee                	jne    800ddb <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800ded:	c3                   	ret
+  800dee:	c3                   	ret
+
+0000000000800def <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800def:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800df2:	48 89 f8             	mov    %rdi,%rax
+  800df5:	48 f7 d8             	neg    %rax
+  800df8:	83 e0 07             	and    $0x7,%eax
+  800dfb:	49 89 d1             	mov    %rdx,%r9
+  800dfe:	49 29 c1             	sub    %rax,%r9
+  800e01:	78 36                	js     800e39 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800e03:	40 0f b6 c6          	movzbl %sil,%eax
+  800e07:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800e0e:	01 01 01 
+  800e11:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800e15:	40 f6 c7 07          	test   $0x7,%dil
+  800e19:	75 38                	jne    800e53 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800e1b:	4c 89 c9             	mov    %r9,%rcx
+  800e1e:	48 c1 f9 03          	sar    $0x3,%rcx
+  800e22:	74 0c                	je     800e30 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800e24:	fc                   	cld
+  800e25:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800e28:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800e2c:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800e30:	4d 85 c9             	test   %r9,%r9
+  800e33:	75 45                	jne    800e7a <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800e35:	4c 89 c0             	mov    %r8,%rax
+  800e38:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800e39:	48 85 d2             	test   %rdx,%rdx
+  800e3c:	74 f7                	je     800e35 <memset+0x46>
+  800e3e:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800e41:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800e44:	48 83 c0 01          	add    $0x1,%rax
+  800e48:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800e4c:	48 39 c2             	cmp    %rax,%rdx
+  800e4f:	75 f3                	jne    800e44 <memset+0x55>
+  800e51:	eb e2                	jmp    800e35 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800e53:	40 f6 c7 01          	test   $0x1,%dil
+  800e57:	74 06                	je     800e5f <memset+0x70>
+  800e59:	88 07                	mov    %al,(%rdi)
+  800e5b:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e5f:	40 f6 c7 02          	test   $0x2,%dil
+  800e63:	74 07                	je     800e6c <memset+0x7d>
+  800e65:	66 89 07             	mov    %ax,(%rdi)
+  800e68:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e6c:	40 f6 c7 04          	test   $0x4,%dil
+  800e70:	74 a9                	je     800e1b <memset+0x2c>
+  800e72:	89 07                	mov    %eax,(%rdi)
+  800e74:	48 83 c7 04          	add    $0x4,%rdi
+  800e78:	eb a1                	jmp    800e1b <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e7a:	41 f6 c1 04          	test   $0x4,%r9b
+  800e7e:	74 06                	je     800e86 <memset+0x97>
+  800e80:	89 07                	mov    %eax,(%rdi)
+  800e82:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e86:	41 f6 c1 02          	test   $0x2,%r9b
+  800e8a:	74 07                	je     800e93 <memset+0xa4>
+  800e8c:	66 89 07             	mov    %ax,(%rdi)
+  800e8f:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800e93:	41 f6 c1 01          	test   $0x1,%r9b
+  800e97:	74 9c                	je     800e35 <memset+0x46>
+  800e99:	88 07                	mov    %al,(%rdi)
+  800e9b:	eb 98                	jmp    800e35 <memset+0x46>
+
+0000000000800e9d <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800e9d:	48 89 f8             	mov    %rdi,%rax
+  800ea0:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800ea3:	48 39 fe             	cmp    %rdi,%rsi
+  800ea6:	73 3b                	jae    800ee3 <memmove+0x46>
+  800ea8:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800eac:	48 39 d7             	cmp    %rdx,%rdi
+  800eaf:	73 32                	jae    800ee3 <memmove+0x46>
+        s += n;
+        d += n;
+  800eb1:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800eb5:	48 89 d6             	mov    %rdx,%rsi
+  800eb8:	48 09 fe             	or     %rdi,%rsi
+  800ebb:	48 09 ce             	or     %rcx,%rsi
+  800ebe:	40 f6 c6 07          	test   $0x7,%sil
+  800ec2:	75 12                	jne    800ed6 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800ec4:	48 83 ef 08          	sub    $0x8,%rdi
+  800ec8:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800ecc:	48 c1 e9 03          	shr    $0x3,%rcx
+  800ed0:	fd                   	std
+  800ed1:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800ed4:	fc                   	cld
+  800ed5:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800ed6:	48 83 ef 01          	sub    $0x1,%rdi
+  800eda:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800ede:	fd                   	std
+  800edf:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800ee1:	eb f1                	jmp    800ed4 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800ee3:	48 89 f2             	mov    %rsi,%rdx
+  800ee6:	48 09 c2             	or     %rax,%rdx
+  800ee9:	48 09 ca             	or     %rcx,%rdx
+  800eec:	f6 c2 07             	test   $0x7,%dl
+  800eef:	75 0c                	jne    800efd <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800ef1:	48 c1 e9 03          	shr    $0x3,%rcx
+  800ef5:	48 89 c7             	mov    %rax,%rdi
+  800ef8:	fc                   	cld
+  800ef9:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800efc:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800efd:	48 89 c7             	mov    %rax,%rdi
+  800f00:	fc                   	cld
+  800f01:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800f03:	c3                   	ret
+
+0000000000800f04 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800f04:	55                   	push   %rbp
+  800f05:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800f08:	48 b8 9d 0e 80 00 00 	movabs $0x800e9d,%rax
+  800f0f:	00 00 00 
+  800f12:	ff d0                	call   *%rax
+}
+  800f14:	5d                   	pop    %rbp
+  800f15:	c3                   	ret
+
+0000000000800f16 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800f16:	55                   	push   %rbp
+  800f17:	48 89 e5             	mov    %rsp,%rbp
+  800f1a:	41 57                	push   %r15
+  800f1c:	41 56                	push   %r14
+  800f1e:	41 55                	push   %r13
+  800f20:	41 54                	push   %r12
+  800f22:	53                   	push   %rbx
+  800f23:	48 83 ec 08          	sub    $0x8,%rsp
+  800f27:	49 89 fe             	mov    %rdi,%r14
+  800f2a:	49 89 f7             	mov    %rsi,%r15
+  800f2d:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800f30:	48 89 f7             	mov    %rsi,%rdi
+  800f33:	48 b8 65 0c 80 00 00 	movabs $0x800c65,%rax
+  800f3a:	00 00 00 
+  800f3d:	ff d0                	call   *%rax
+  800f3f:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800f42:	48 89 de             	mov    %rbx,%rsi
+  800f45:	4c 89 f7             	mov    %r14,%rdi
+  800f48:	48 b8 80 0c 80 00 00 	movabs $0x800c80,%rax
+  800f4f:	00 00 00 
+  800f52:	ff d0                	call   *%rax
+  800f54:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f57:	48 39 c3             	cmp    %rax,%rbx
+  800f5a:	74 36                	je     800f92 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800f5c:	48 89 d8             	mov    %rbx,%rax
+  800f5f:	4c 29 e8             	sub    %r13,%rax
+  800f62:	49 39 c4             	cmp    %rax,%r12
+  800f65:	73 31                	jae    800f98 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800f67:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800f6c:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f70:	4c 89 fe             	mov    %r15,%rsi
+  800f73:	48 b8 04 0f 80 00 00 	movabs $0x800f04,%rax
+  800f7a:	00 00 00 
+  800f7d:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800f7f:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800f83:	48 83 c4 08          	add    $0x8,%rsp
+  800f87:	5b                   	pop    %rbx
+  800f88:	41 5c                	pop    %r12
+  800f8a:	41 5d                	pop    %r13
+  800f8c:	41 5e                	pop    %r14
+  800f8e:	41 5f                	pop    %r15
+  800f90:	5d                   	pop    %rbp
+  800f91:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f92:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800f96:	eb eb                	jmp    800f83 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800f98:	48 83 eb 01          	sub    $0x1,%rbx
+  800f9c:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800fa0:	48 89 da             	mov    %rbx,%rdx
+  800fa3:	4c 89 fe             	mov    %r15,%rsi
+  800fa6:	48 b8 04 0f 80 00 00 	movabs $0x800f04,%rax
+  800fad:	00 00 00 
+  800fb0:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800fb2:	49 01 de             	add    %rbx,%r14
+  800fb5:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800fba:	eb c3                	jmp    800f7f <strlcat+0x69>
+
+0000000000800fbc <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800fbc:	48 85 d2             	test   %rdx,%rdx
+  800fbf:	74 2d                	je     800fee <memcmp+0x32>
+  800fc1:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800fc6:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800fca:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800fcf:	44 38 c1             	cmp    %r8b,%cl
+  800fd2:	75 0f                	jne    800fe3 <memcmp+0x27>
+    while (n-- > 0) {
+  800fd4:	48 83 c0 01          	add    $0x1,%rax
+  800fd8:	48 39 c2             	cmp    %rax,%rdx
+  800fdb:	75 e9                	jne    800fc6 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800fdd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fe2:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800fe3:	0f b6 c1             	movzbl %cl,%eax
+  800fe6:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800fea:	44 29 c0             	sub    %r8d,%eax
+  800fed:	c3                   	ret
+    return 0;
+  800fee:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ff3:	c3                   	ret
+
+0000000000800ff4 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800ff4:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800ff8:	48 39 c7             	cmp    %rax,%rdi
+  800ffb:	73 0f                	jae    80100c <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800ffd:	40 38 37             	cmp    %sil,(%rdi)
+  801000:	74 0e                	je     801010 <memfind+0x1c>
+    for (; src < end; src++) {
+  801002:	48 83 c7 01          	add    $0x1,%rdi
+  801006:	48 39 f8             	cmp    %rdi,%rax
+  801009:	75 f2                	jne    800ffd <memfind+0x9>
+  80100b:	c3                   	ret
+  80100c:	48 89 f8             	mov    %rdi,%rax
+  80100f:	c3                   	ret
+  801010:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801013:	c3                   	ret
+
+0000000000801014 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801014:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801017:	0f b6 37             	movzbl (%rdi),%esi
+  80101a:	40 80 fe 20          	cmp    $0x20,%sil
+  80101e:	74 06                	je     801026 <strtol+0x12>
+  801020:	40 80 fe 09          	cmp    $0x9,%sil
+  801024:	75 13                	jne    801039 <strtol+0x25>
+  801026:	48 83 c7 01          	add    $0x1,%rdi
+  80102a:	0f b6 37             	movzbl (%rdi),%esi
+  80102d:	40 80 fe 20          	cmp    $0x20,%sil
+  801031:	74 f3                	je     801026 <strtol+0x12>
+  801033:	40 80 fe 09          	cmp    $0x9,%sil
+  801037:	74 ed                	je     801026 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801039:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80103c:	83 e0 fd             	and    $0xfffffffd,%eax
+  80103f:	3c 01                	cmp    $0x1,%al
+  801041:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801045:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80104b:	75 0f                	jne    80105c <strtol+0x48>
+  80104d:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801050:	74 14                	je     801066 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801052:	85 d2                	test   %edx,%edx
+  801054:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801059:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80105c:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801061:	4c 63 ca             	movslq %edx,%r9
+  801064:	eb 36                	jmp    80109c <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801066:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80106a:	74 0f                	je     80107b <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80106c:	85 d2                	test   %edx,%edx
+  80106e:	75 ec                	jne    80105c <strtol+0x48>
+        s++;
+  801070:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801074:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801079:	eb e1                	jmp    80105c <strtol+0x48>
+        s += 2;
+  80107b:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80107f:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801084:	eb d6                	jmp    80105c <strtol+0x48>
+            dig -= '0';
+  801086:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801089:	44 0f b6 c1          	movzbl %cl,%r8d
+  80108d:	41 39 d0             	cmp    %edx,%r8d
+  801090:	7d 21                	jge    8010b3 <strtol+0x9f>
+        val = val * base + dig;
+  801092:	49 0f af c1          	imul   %r9,%rax
+  801096:	0f b6 c9             	movzbl %cl,%ecx
+  801099:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80109c:	48 83 c7 01          	add    $0x1,%rdi
+  8010a0:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8010a4:	80 f9 39             	cmp    $0x39,%cl
+  8010a7:	76 dd                	jbe    801086 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8010a9:	80 f9 7b             	cmp    $0x7b,%cl
+  8010ac:	77 05                	ja     8010b3 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8010ae:	83 e9 57             	sub    $0x57,%ecx
+  8010b1:	eb d6                	jmp    801089 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8010b3:	4d 85 d2             	test   %r10,%r10
+  8010b6:	74 03                	je     8010bb <strtol+0xa7>
+  8010b8:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8010bb:	48 89 c2             	mov    %rax,%rdx
+  8010be:	48 f7 da             	neg    %rdx
+  8010c1:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8010c5:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8010c9:	c3                   	ret
+
+00000000008010ca <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  8010ca:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8010cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010d4:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8010da:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8010e0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  8010e6:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8010e8:	c3                   	ret
+
+00000000008010e9 <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  8010e9:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8010ee:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010f3:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8010f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010fd:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801103:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801109:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80110f:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801111:	c3                   	ret
+
+0000000000801112 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801112:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801115:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80111a:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80111f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801124:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80112a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801130:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801136:	0f 05                	syscall
+    if (check && ret > 0) {
+  801138:	48 85 c0             	test   %rax,%rax
+  80113b:	7f 01                	jg     80113e <sys_env_destroy+0x2c>
+}
+  80113d:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  80113e:	55                   	push   %rbp
+  80113f:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801142:	49 89 c0             	mov    %rax,%r8
+  801145:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80114a:	48 ba f8 4d 80 00 00 	movabs $0x804df8,%rdx
+  801151:	00 00 00 
+  801154:	be 29 00 00 00       	mov    $0x29,%esi
+  801159:	48 bf 17 4e 80 00 00 	movabs $0x804e17,%rdi
+  801160:	00 00 00 
+  801163:	b8 00 00 00 00       	mov    $0x0,%eax
+  801168:	49 b9 2e 02 80 00 00 	movabs $0x80022e,%r9
+  80116f:	00 00 00 
+  801172:	41 ff d1             	call   *%r9
+
+0000000000801175 <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  801175:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80117a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80117f:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801184:	ba 00 00 00 00       	mov    $0x0,%edx
+  801189:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80118f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801195:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80119b:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80119d:	c3                   	ret
+
+000000000080119e <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  80119e:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8011a3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8011a8:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8011ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011b2:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8011b8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011be:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8011c4:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8011c6:	c3                   	ret
+
+00000000008011c7 <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  8011c7:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8011cc:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  8011d3:	00 00 00 
+  8011d6:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8011dc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011e2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8011e8:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8011ea:	c3                   	ret
+
+00000000008011eb <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8011eb:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  8011ee:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8011f3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011f9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8011ff:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801201:	c3                   	ret
+
+0000000000801202 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801202:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801205:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80120a:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80120d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801213:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801219:	0f 05                	syscall
+    if (check && ret > 0) {
+  80121b:	48 85 c0             	test   %rax,%rax
+  80121e:	7f 01                	jg     801221 <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801220:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801221:	55                   	push   %rbp
+  801222:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801225:	49 89 c0             	mov    %rax,%r8
+  801228:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80122d:	48 ba f8 4d 80 00 00 	movabs $0x804df8,%rdx
+  801234:	00 00 00 
+  801237:	be 29 00 00 00       	mov    $0x29,%esi
+  80123c:	48 bf 17 4e 80 00 00 	movabs $0x804e17,%rdi
+  801243:	00 00 00 
+  801246:	b8 00 00 00 00       	mov    $0x0,%eax
+  80124b:	49 b9 2e 02 80 00 00 	movabs $0x80022e,%r9
+  801252:	00 00 00 
+  801255:	41 ff d1             	call   *%r9
+
+0000000000801258 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801258:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80125b:	48 63 d2             	movslq %edx,%rdx
+  80125e:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801261:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801266:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  801269:	0f 05                	syscall
+    if (check && ret > 0) {
+  80126b:	48 85 c0             	test   %rax,%rax
+  80126e:	7f 01                	jg     801271 <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801270:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801271:	55                   	push   %rbp
+  801272:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801275:	49 89 c0             	mov    %rax,%r8
+  801278:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80127d:	48 ba f8 4d 80 00 00 	movabs $0x804df8,%rdx
+  801284:	00 00 00 
+  801287:	be 29 00 00 00       	mov    $0x29,%esi
+  80128c:	48 bf 17 4e 80 00 00 	movabs $0x804e17,%rdi
+  801293:	00 00 00 
+  801296:	b8 00 00 00 00       	mov    $0x0,%eax
+  80129b:	49 b9 2e 02 80 00 00 	movabs $0x80022e,%r9
+  8012a2:	00 00 00 
+  8012a5:	41 ff d1             	call   *%r9
+
+00000000008012a8 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8012a8:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8012ab:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8012b0:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8012b6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8012bc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8012c2:	0f 05                	syscall
+    if (check && ret > 0) {
+  8012c4:	48 85 c0             	test   %rax,%rax
+  8012c7:	7f 01                	jg     8012ca <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8012c9:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8012ca:	55                   	push   %rbp
+  8012cb:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012ce:	49 89 c0             	mov    %rax,%r8
+  8012d1:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8012d6:	48 ba f8 4d 80 00 00 	movabs $0x804df8,%rdx
+  8012dd:	00 00 00 
+  8012e0:	be 29 00 00 00       	mov    $0x29,%esi
+  8012e5:	48 bf 17 4e 80 00 00 	movabs $0x804e17,%rdi
+  8012ec:	00 00 00 
+  8012ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012f4:	49 b9 2e 02 80 00 00 	movabs $0x80022e,%r9
+  8012fb:	00 00 00 
+  8012fe:	41 ff d1             	call   *%r9
+
+0000000000801301 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801301:	48 63 f6             	movslq %esi,%rsi
+  801304:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801307:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80130c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801311:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801317:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80131d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801323:	0f 05                	syscall
+    if (check && ret > 0) {
+  801325:	48 85 c0             	test   %rax,%rax
+  801328:	7f 01                	jg     80132b <sys_env_set_status+0x2a>
+}
+  80132a:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  80132b:	55                   	push   %rbp
+  80132c:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80132f:	49 89 c0             	mov    %rax,%r8
+  801332:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801337:	48 ba f8 4d 80 00 00 	movabs $0x804df8,%rdx
+  80133e:	00 00 00 
+  801341:	be 29 00 00 00       	mov    $0x29,%esi
+  801346:	48 bf 17 4e 80 00 00 	movabs $0x804e17,%rdi
+  80134d:	00 00 00 
+  801350:	b8 00 00 00 00       	mov    $0x0,%eax
+  801355:	49 b9 2e 02 80 00 00 	movabs $0x80022e,%r9
+  80135c:	00 00 00 
+  80135f:	41 ff d1             	call   *%r9
+
+0000000000801362 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801362:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801365:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80136a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80136f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801375:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80137b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801381:	0f 05                	syscall
+    if (check && ret > 0) {
+  801383:	48 85 c0             	test   %rax,%rax
+  801386:	7f 01                	jg     801389 <sys_env_set_trapframe+0x27>
+}
+  801388:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801389:	55                   	push   %rbp
+  80138a:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80138d:	49 89 c0             	mov    %rax,%r8
+  801390:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801395:	48 ba f8 4d 80 00 00 	movabs $0x804df8,%rdx
+  80139c:	00 00 00 
+  80139f:	be 29 00 00 00       	mov    $0x29,%esi
+  8013a4:	48 bf 17 4e 80 00 00 	movabs $0x804e17,%rdi
+  8013ab:	00 00 00 
+  8013ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013b3:	49 b9 2e 02 80 00 00 	movabs $0x80022e,%r9
+  8013ba:	00 00 00 
+  8013bd:	41 ff d1             	call   *%r9
+
+00000000008013c0 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8013c0:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8013c3:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8013c8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013cd:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013d3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013d9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013df:	0f 05                	syscall
+    if (check && ret > 0) {
+  8013e1:	48 85 c0             	test   %rax,%rax
+  8013e4:	7f 01                	jg     8013e7 <sys_env_set_pgfault_upcall+0x27>
+}
+  8013e6:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8013e7:	55                   	push   %rbp
+  8013e8:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013eb:	49 89 c0             	mov    %rax,%r8
+  8013ee:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8013f3:	48 ba f8 4d 80 00 00 	movabs $0x804df8,%rdx
+  8013fa:	00 00 00 
+  8013fd:	be 29 00 00 00       	mov    $0x29,%esi
+  801402:	48 bf 17 4e 80 00 00 	movabs $0x804e17,%rdi
+  801409:	00 00 00 
+  80140c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801411:	49 b9 2e 02 80 00 00 	movabs $0x80022e,%r9
+  801418:	00 00 00 
+  80141b:	41 ff d1             	call   *%r9
+
+000000000080141e <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80141e:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801421:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801424:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801429:	4d 63 c0             	movslq %r8d,%r8
+  80142c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801432:	0f 05                	syscall
+}
+  801434:	c3                   	ret
+
+0000000000801435 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801435:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801438:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80143b:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801440:	4d 63 c0             	movslq %r8d,%r8
+  801443:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801449:	0f 05                	syscall
+}
+  80144b:	c3                   	ret
+
+000000000080144c <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  80144c:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801451:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801454:	45 89 c0             	mov    %r8d,%r8d
+  801457:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80145d:	0f 05                	syscall
+    if (check && ret > 0) {
+  80145f:	48 85 c0             	test   %rax,%rax
+  801462:	7f 01                	jg     801465 <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801464:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  801465:	55                   	push   %rbp
+  801466:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801469:	49 89 c0             	mov    %rax,%r8
+  80146c:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801471:	48 ba f8 4d 80 00 00 	movabs $0x804df8,%rdx
+  801478:	00 00 00 
+  80147b:	be 29 00 00 00       	mov    $0x29,%esi
+  801480:	48 bf 17 4e 80 00 00 	movabs $0x804e17,%rdi
+  801487:	00 00 00 
+  80148a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80148f:	49 b9 2e 02 80 00 00 	movabs $0x80022e,%r9
+  801496:	00 00 00 
+  801499:	41 ff d1             	call   *%r9
+
+000000000080149c <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  80149c:	55                   	push   %rbp
+  80149d:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  8014a0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014a6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014b0:	48 b8 4c 14 80 00 00 	movabs $0x80144c,%rax
+  8014b7:	00 00 00 
+  8014ba:	ff d0                	call   *%rax
+}
+  8014bc:	5d                   	pop    %rbp
+  8014bd:	c3                   	ret
+
+00000000008014be <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  8014be:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8014c3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014c8:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8014cd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014d2:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014d8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014de:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8014e4:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8014e6:	c3                   	ret
+
+00000000008014e7 <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  8014e7:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8014ec:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8014f1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014f6:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014fc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801502:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801508:	0f 05                	syscall
+    if (check && ret > 0) {
+  80150a:	48 85 c0             	test   %rax,%rax
+  80150d:	7f 01                	jg     801510 <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  80150f:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  801510:	55                   	push   %rbp
+  801511:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801514:	49 89 c0             	mov    %rax,%r8
+  801517:	b9 10 00 00 00       	mov    $0x10,%ecx
+  80151c:	48 ba f8 4d 80 00 00 	movabs $0x804df8,%rdx
+  801523:	00 00 00 
+  801526:	be 29 00 00 00       	mov    $0x29,%esi
+  80152b:	48 bf 17 4e 80 00 00 	movabs $0x804e17,%rdi
+  801532:	00 00 00 
+  801535:	b8 00 00 00 00       	mov    $0x0,%eax
+  80153a:	49 b9 2e 02 80 00 00 	movabs $0x80022e,%r9
+  801541:	00 00 00 
+  801544:	41 ff d1             	call   *%r9
+
+0000000000801547 <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  801547:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80154c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801551:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801556:	ba 00 00 00 00       	mov    $0x0,%edx
+  80155b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801561:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801567:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80156d:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  80156f:	c3                   	ret
+
+0000000000801570 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  801570:	89 d2                	mov    %edx,%edx
+  801572:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  801574:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801579:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80157f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801585:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80158b:	0f 05                	syscall
+}
+  80158d:	c3                   	ret
+
+000000000080158e <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  80158e:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  801591:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801596:	ba 00 00 00 00       	mov    $0x0,%edx
+  80159b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8015a1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8015a7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8015ad:	0f 05                	syscall
+}
+  8015af:	c3                   	ret
+
+00000000008015b0 <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  8015b0:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  8015b3:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8015b8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015bd:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8015c3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8015c9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8015cf:	0f 05                	syscall
+}
+  8015d1:	c3                   	ret
+
+00000000008015d2 <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  8015d2:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8015d5:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8015da:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8015df:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015e4:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8015ea:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8015f0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8015f6:	0f 05                	syscall
+    if (check && ret > 0) {
+  8015f8:	48 85 c0             	test   %rax,%rax
+  8015fb:	7f 01                	jg     8015fe <sys_irq_ack+0x2c>
+}
+  8015fd:	c3                   	ret
+sys_irq_ack(int irq) {
+  8015fe:	55                   	push   %rbp
+  8015ff:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801602:	49 89 c0             	mov    %rax,%r8
+  801605:	b9 16 00 00 00       	mov    $0x16,%ecx
+  80160a:	48 ba f8 4d 80 00 00 	movabs $0x804df8,%rdx
+  801611:	00 00 00 
+  801614:	be 29 00 00 00       	mov    $0x29,%esi
+  801619:	48 bf 17 4e 80 00 00 	movabs $0x804e17,%rdi
+  801620:	00 00 00 
+  801623:	b8 00 00 00 00       	mov    $0x0,%eax
+  801628:	49 b9 2e 02 80 00 00 	movabs $0x80022e,%r9
+  80162f:	00 00 00 
+  801632:	41 ff d1             	call   *%r9
+
+0000000000801635 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801635:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80163c:	ff ff ff 
+  80163f:	48 01 f8             	add    %rdi,%rax
+  801642:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801646:	c3                   	ret
+
+0000000000801647 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801647:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80164e:	ff ff ff 
+  801651:	48 01 f8             	add    %rdi,%rax
+  801654:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801658:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  80165e:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801662:	c3                   	ret
+
+0000000000801663 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801663:	55                   	push   %rbp
+  801664:	48 89 e5             	mov    %rsp,%rbp
+  801667:	41 57                	push   %r15
+  801669:	41 56                	push   %r14
+  80166b:	41 55                	push   %r13
+  80166d:	41 54                	push   %r12
+  80166f:	53                   	push   %rbx
+  801670:	48 83 ec 08          	sub    $0x8,%rsp
+  801674:	49 89 ff             	mov    %rdi,%r15
+  801677:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  80167c:	49 bd f2 3d 80 00 00 	movabs $0x803df2,%r13
+  801683:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801686:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  80168c:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  80168f:	48 89 df             	mov    %rbx,%rdi
+  801692:	41 ff d5             	call   *%r13
+  801695:	83 e0 04             	and    $0x4,%eax
+  801698:	74 17                	je     8016b1 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  80169a:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8016a1:	4c 39 f3             	cmp    %r14,%rbx
+  8016a4:	75 e6                	jne    80168c <fd_alloc+0x29>
+  8016a6:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8016ac:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8016b1:	4d 89 27             	mov    %r12,(%r15)
+}
+  8016b4:	48 83 c4 08          	add    $0x8,%rsp
+  8016b8:	5b                   	pop    %rbx
+  8016b9:	41 5c                	pop    %r12
+  8016bb:	41 5d                	pop    %r13
+  8016bd:	41 5e                	pop    %r14
+  8016bf:	41 5f                	pop    %r15
+  8016c1:	5d                   	pop    %rbp
+  8016c2:	c3                   	ret
+
+00000000008016c3 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8016c3:	83 ff 1f             	cmp    $0x1f,%edi
+  8016c6:	77 39                	ja     801701 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8016c8:	55                   	push   %rbp
+  8016c9:	48 89 e5             	mov    %rsp,%rbp
+  8016cc:	41 54                	push   %r12
+  8016ce:	53                   	push   %rbx
+  8016cf:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8016d2:	48 63 df             	movslq %edi,%rbx
+  8016d5:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8016dc:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8016e0:	48 89 df             	mov    %rbx,%rdi
+  8016e3:	48 b8 f2 3d 80 00 00 	movabs $0x803df2,%rax
+  8016ea:	00 00 00 
+  8016ed:	ff d0                	call   *%rax
+  8016ef:	a8 04                	test   $0x4,%al
+  8016f1:	74 14                	je     801707 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8016f3:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8016f7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8016fc:	5b                   	pop    %rbx
+  8016fd:	41 5c                	pop    %r12
+  8016ff:	5d                   	pop    %rbp
+  801700:	c3                   	ret
+        return -E_INVAL;
+  801701:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801706:	c3                   	ret
+        return -E_INVAL;
+  801707:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80170c:	eb ee                	jmp    8016fc <fd_lookup+0x39>
+
+000000000080170e <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80170e:	55                   	push   %rbp
+  80170f:	48 89 e5             	mov    %rsp,%rbp
+  801712:	41 54                	push   %r12
+  801714:	53                   	push   %rbx
+  801715:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801718:	48 b8 c0 4e 80 00 00 	movabs $0x804ec0,%rax
+  80171f:	00 00 00 
+  801722:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  801729:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  80172c:	39 3b                	cmp    %edi,(%rbx)
+  80172e:	74 47                	je     801777 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801730:	48 83 c0 08          	add    $0x8,%rax
+  801734:	48 8b 18             	mov    (%rax),%rbx
+  801737:	48 85 db             	test   %rbx,%rbx
+  80173a:	75 f0                	jne    80172c <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80173c:	48 a1 00 00 c1 00 00 	movabs 0xc10000,%rax
+  801743:	00 00 00 
+  801746:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80174c:	89 fa                	mov    %edi,%edx
+  80174e:	48 bf 28 4e 80 00 00 	movabs $0x804e28,%rdi
+  801755:	00 00 00 
+  801758:	b8 00 00 00 00       	mov    $0x0,%eax
+  80175d:	48 b9 7e 03 80 00 00 	movabs $0x80037e,%rcx
+  801764:	00 00 00 
+  801767:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801769:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  80176e:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801772:	5b                   	pop    %rbx
+  801773:	41 5c                	pop    %r12
+  801775:	5d                   	pop    %rbp
+  801776:	c3                   	ret
+            return 0;
+  801777:	b8 00 00 00 00       	mov    $0x0,%eax
+  80177c:	eb f0                	jmp    80176e <dev_lookup+0x60>
+
+000000000080177e <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  80177e:	55                   	push   %rbp
+  80177f:	48 89 e5             	mov    %rsp,%rbp
+  801782:	41 55                	push   %r13
+  801784:	41 54                	push   %r12
+  801786:	53                   	push   %rbx
+  801787:	48 83 ec 18          	sub    $0x18,%rsp
+  80178b:	48 89 fb             	mov    %rdi,%rbx
+  80178e:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801791:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801798:	ff ff ff 
+  80179b:	48 01 df             	add    %rbx,%rdi
+  80179e:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8017a2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8017a6:	48 b8 c3 16 80 00 00 	movabs $0x8016c3,%rax
+  8017ad:	00 00 00 
+  8017b0:	ff d0                	call   *%rax
+  8017b2:	41 89 c5             	mov    %eax,%r13d
+  8017b5:	85 c0                	test   %eax,%eax
+  8017b7:	78 06                	js     8017bf <fd_close+0x41>
+  8017b9:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8017bd:	74 1a                	je     8017d9 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8017bf:	45 84 e4             	test   %r12b,%r12b
+  8017c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017c7:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8017cb:	44 89 e8             	mov    %r13d,%eax
+  8017ce:	48 83 c4 18          	add    $0x18,%rsp
+  8017d2:	5b                   	pop    %rbx
+  8017d3:	41 5c                	pop    %r12
+  8017d5:	41 5d                	pop    %r13
+  8017d7:	5d                   	pop    %rbp
+  8017d8:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8017d9:	8b 3b                	mov    (%rbx),%edi
+  8017db:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8017df:	48 b8 0e 17 80 00 00 	movabs $0x80170e,%rax
+  8017e6:	00 00 00 
+  8017e9:	ff d0                	call   *%rax
+  8017eb:	41 89 c5             	mov    %eax,%r13d
+  8017ee:	85 c0                	test   %eax,%eax
+  8017f0:	78 1b                	js     80180d <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8017f2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8017f6:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8017fa:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801800:	48 85 c0             	test   %rax,%rax
+  801803:	74 08                	je     80180d <fd_close+0x8f>
+  801805:	48 89 df             	mov    %rbx,%rdi
+  801808:	ff d0                	call   *%rax
+  80180a:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80180d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801812:	48 89 de             	mov    %rbx,%rsi
+  801815:	bf 00 00 00 00       	mov    $0x0,%edi
+  80181a:	48 b8 a8 12 80 00 00 	movabs $0x8012a8,%rax
+  801821:	00 00 00 
+  801824:	ff d0                	call   *%rax
+    return res;
+  801826:	eb a3                	jmp    8017cb <fd_close+0x4d>
+
+0000000000801828 <close>:
+
+int
+close(int fdnum) {
+  801828:	55                   	push   %rbp
+  801829:	48 89 e5             	mov    %rsp,%rbp
+  80182c:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801830:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801834:	48 b8 c3 16 80 00 00 	movabs $0x8016c3,%rax
+  80183b:	00 00 00 
+  80183e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801840:	85 c0                	test   %eax,%eax
+  801842:	78 15                	js     801859 <close+0x31>
+
+    return fd_close(fd, 1);
+  801844:	be 01 00 00 00       	mov    $0x1,%esi
+  801849:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80184d:	48 b8 7e 17 80 00 00 	movabs $0x80177e,%rax
+  801854:	00 00 00 
+  801857:	ff d0                	call   *%rax
+}
+  801859:	c9                   	leave
+  80185a:	c3                   	ret
+
+000000000080185b <close_all>:
+
+void
+close_all(void) {
+  80185b:	55                   	push   %rbp
+  80185c:	48 89 e5             	mov    %rsp,%rbp
+  80185f:	41 54                	push   %r12
+  801861:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801862:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801867:	49 bc 28 18 80 00 00 	movabs $0x801828,%r12
+  80186e:	00 00 00 
+  801871:	89 df                	mov    %ebx,%edi
+  801873:	41 ff d4             	call   *%r12
+  801876:	83 c3 01             	add    $0x1,%ebx
+  801879:	83 fb 20             	cmp    $0x20,%ebx
+  80187c:	75 f3                	jne    801871 <close_all+0x16>
+}
+  80187e:	5b                   	pop    %rbx
+  80187f:	41 5c                	pop    %r12
+  801881:	5d                   	pop    %rbp
+  801882:	c3                   	ret
+
+0000000000801883 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801883:	55                   	push   %rbp
+  801884:	48 89 e5             	mov    %rsp,%rbp
+  801887:	41 57                	push   %r15
+  801889:	41 56                	push   %r14
+  80188b:	41 55                	push   %r13
+  80188d:	41 54                	push   %r12
+  80188f:	53                   	push   %rbx
+  801890:	48 83 ec 18          	sub    $0x18,%rsp
+  801894:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801897:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80189b:	48 b8 c3 16 80 00 00 	movabs $0x8016c3,%rax
+  8018a2:	00 00 00 
+  8018a5:	ff d0                	call   *%rax
+  8018a7:	89 c3                	mov    %eax,%ebx
+  8018a9:	85 c0                	test   %eax,%eax
+  8018ab:	0f 88 b8 00 00 00    	js     801969 <dup+0xe6>
+    close(newfdnum);
+  8018b1:	44 89 e7             	mov    %r12d,%edi
+  8018b4:	48 b8 28 18 80 00 00 	movabs $0x801828,%rax
+  8018bb:	00 00 00 
+  8018be:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8018c0:	4d 63 ec             	movslq %r12d,%r13
+  8018c3:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8018ca:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8018ce:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8018d2:	4c 89 ff             	mov    %r15,%rdi
+  8018d5:	49 be 47 16 80 00 00 	movabs $0x801647,%r14
+  8018dc:	00 00 00 
+  8018df:	41 ff d6             	call   *%r14
+  8018e2:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8018e5:	4c 89 ef             	mov    %r13,%rdi
+  8018e8:	41 ff d6             	call   *%r14
+  8018eb:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8018ee:	48 89 df             	mov    %rbx,%rdi
+  8018f1:	48 b8 f2 3d 80 00 00 	movabs $0x803df2,%rax
+  8018f8:	00 00 00 
+  8018fb:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8018fd:	a8 04                	test   $0x4,%al
+  8018ff:	74 2b                	je     80192c <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801901:	41 89 c1             	mov    %eax,%r9d
+  801904:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80190a:	4c 89 f1             	mov    %r14,%rcx
+  80190d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801912:	48 89 de             	mov    %rbx,%rsi
+  801915:	bf 00 00 00 00       	mov    $0x0,%edi
+  80191a:	48 b8 58 12 80 00 00 	movabs $0x801258,%rax
+  801921:	00 00 00 
+  801924:	ff d0                	call   *%rax
+  801926:	89 c3                	mov    %eax,%ebx
+  801928:	85 c0                	test   %eax,%eax
+  80192a:	78 4e                	js     80197a <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  80192c:	4c 89 ff             	mov    %r15,%rdi
+  80192f:	48 b8 f2 3d 80 00 00 	movabs $0x803df2,%rax
+  801936:	00 00 00 
+  801939:	ff d0                	call   *%rax
+  80193b:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  80193e:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801944:	4c 89 e9             	mov    %r13,%rcx
+  801947:	ba 00 00 00 00       	mov    $0x0,%edx
+  80194c:	4c 89 fe             	mov    %r15,%rsi
+  80194f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801954:	48 b8 58 12 80 00 00 	movabs $0x801258,%rax
+  80195b:	00 00 00 
+  80195e:	ff d0                	call   *%rax
+  801960:	89 c3                	mov    %eax,%ebx
+  801962:	85 c0                	test   %eax,%eax
+  801964:	78 14                	js     80197a <dup+0xf7>
+
+    return newfdnum;
+  801966:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801969:	89 d8                	mov    %ebx,%eax
+  80196b:	48 83 c4 18          	add    $0x18,%rsp
+  80196f:	5b                   	pop    %rbx
+  801970:	41 5c                	pop    %r12
+  801972:	41 5d                	pop    %r13
+  801974:	41 5e                	pop    %r14
+  801976:	41 5f                	pop    %r15
+  801978:	5d                   	pop    %rbp
+  801979:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  80197a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80197f:	4c 89 ee             	mov    %r13,%rsi
+  801982:	bf 00 00 00 00       	mov    $0x0,%edi
+  801987:	49 bc a8 12 80 00 00 	movabs $0x8012a8,%r12
+  80198e:	00 00 00 
+  801991:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801994:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801999:	4c 89 f6             	mov    %r14,%rsi
+  80199c:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019a1:	41 ff d4             	call   *%r12
+    return res;
+  8019a4:	eb c3                	jmp    801969 <dup+0xe6>
+
+00000000008019a6 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8019a6:	55                   	push   %rbp
+  8019a7:	48 89 e5             	mov    %rsp,%rbp
+  8019aa:	41 56                	push   %r14
+  8019ac:	41 55                	push   %r13
+  8019ae:	41 54                	push   %r12
+  8019b0:	53                   	push   %rbx
+  8019b1:	48 83 ec 10          	sub    $0x10,%rsp
+  8019b5:	89 fb                	mov    %edi,%ebx
+  8019b7:	49 89 f4             	mov    %rsi,%r12
+  8019ba:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8019bd:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8019c1:	48 b8 c3 16 80 00 00 	movabs $0x8016c3,%rax
+  8019c8:	00 00 00 
+  8019cb:	ff d0                	call   *%rax
+  8019cd:	85 c0                	test   %eax,%eax
+  8019cf:	78 4c                	js     801a1d <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8019d1:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8019d5:	41 8b 3e             	mov    (%r14),%edi
+  8019d8:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8019dc:	48 b8 0e 17 80 00 00 	movabs $0x80170e,%rax
+  8019e3:	00 00 00 
+  8019e6:	ff d0                	call   *%rax
+  8019e8:	85 c0                	test   %eax,%eax
+  8019ea:	78 35                	js     801a21 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8019ec:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8019f0:	83 e0 03             	and    $0x3,%eax
+  8019f3:	83 f8 01             	cmp    $0x1,%eax
+  8019f6:	74 2d                	je     801a25 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8019f8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8019fc:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801a00:	48 85 c0             	test   %rax,%rax
+  801a03:	74 56                	je     801a5b <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801a05:	4c 89 ea             	mov    %r13,%rdx
+  801a08:	4c 89 e6             	mov    %r12,%rsi
+  801a0b:	4c 89 f7             	mov    %r14,%rdi
+  801a0e:	ff d0                	call   *%rax
+}
+  801a10:	48 83 c4 10          	add    $0x10,%rsp
+  801a14:	5b                   	pop    %rbx
+  801a15:	41 5c                	pop    %r12
+  801a17:	41 5d                	pop    %r13
+  801a19:	41 5e                	pop    %r14
+  801a1b:	5d                   	pop    %rbp
+  801a1c:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a1d:	48 98                	cltq
+  801a1f:	eb ef                	jmp    801a10 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801a21:	48 98                	cltq
+  801a23:	eb eb                	jmp    801a10 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801a25:	48 a1 00 00 c1 00 00 	movabs 0xc10000,%rax
+  801a2c:	00 00 00 
+  801a2f:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801a35:	89 da                	mov    %ebx,%edx
+  801a37:	48 bf 69 4e 80 00 00 	movabs $0x804e69,%rdi
+  801a3e:	00 00 00 
+  801a41:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a46:	48 b9 7e 03 80 00 00 	movabs $0x80037e,%rcx
+  801a4d:	00 00 00 
+  801a50:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801a52:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801a59:	eb b5                	jmp    801a10 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801a5b:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801a62:	eb ac                	jmp    801a10 <read+0x6a>
+
+0000000000801a64 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801a64:	55                   	push   %rbp
+  801a65:	48 89 e5             	mov    %rsp,%rbp
+  801a68:	41 57                	push   %r15
+  801a6a:	41 56                	push   %r14
+  801a6c:	41 55                	push   %r13
+  801a6e:	41 54                	push   %r12
+  801a70:	53                   	push   %rbx
+  801a71:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801a75:	48 85 d2             	test   %rdx,%rdx
+  801a78:	74 54                	je     801ace <readn+0x6a>
+  801a7a:	41 89 fd             	mov    %edi,%r13d
+  801a7d:	49 89 f6             	mov    %rsi,%r14
+  801a80:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801a83:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801a88:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801a8d:	49 bf a6 19 80 00 00 	movabs $0x8019a6,%r15
+  801a94:	00 00 00 
+  801a97:	4c 89 e2             	mov    %r12,%rdx
+  801a9a:	48 29 f2             	sub    %rsi,%rdx
+  801a9d:	4c 01 f6             	add    %r14,%rsi
+  801aa0:	44 89 ef             	mov    %r13d,%edi
+  801aa3:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801aa6:	85 c0                	test   %eax,%eax
+  801aa8:	78 20                	js     801aca <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801aaa:	01 c3                	add    %eax,%ebx
+  801aac:	85 c0                	test   %eax,%eax
+  801aae:	74 08                	je     801ab8 <readn+0x54>
+  801ab0:	48 63 f3             	movslq %ebx,%rsi
+  801ab3:	4c 39 e6             	cmp    %r12,%rsi
+  801ab6:	72 df                	jb     801a97 <readn+0x33>
+    }
+    return res;
+  801ab8:	48 63 c3             	movslq %ebx,%rax
+}
+  801abb:	48 83 c4 08          	add    $0x8,%rsp
+  801abf:	5b                   	pop    %rbx
+  801ac0:	41 5c                	pop    %r12
+  801ac2:	41 5d                	pop    %r13
+  801ac4:	41 5e                	pop    %r14
+  801ac6:	41 5f                	pop    %r15
+  801ac8:	5d                   	pop    %rbp
+  801ac9:	c3                   	ret
+        if (inc < 0) return inc;
+  801aca:	48 98                	cltq
+  801acc:	eb ed                	jmp    801abb <readn+0x57>
+    int inc = 1, res = 0;
+  801ace:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ad3:	eb e3                	jmp    801ab8 <readn+0x54>
+
+0000000000801ad5 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801ad5:	55                   	push   %rbp
+  801ad6:	48 89 e5             	mov    %rsp,%rbp
+  801ad9:	41 56                	push   %r14
+  801adb:	41 55                	push   %r13
+  801add:	41 54                	push   %r12
+  801adf:	53                   	push   %rbx
+  801ae0:	48 83 ec 10          	sub    $0x10,%rsp
+  801ae4:	89 fb                	mov    %edi,%ebx
+  801ae6:	49 89 f4             	mov    %rsi,%r12
+  801ae9:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801aec:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801af0:	48 b8 c3 16 80 00 00 	movabs $0x8016c3,%rax
+  801af7:	00 00 00 
+  801afa:	ff d0                	call   *%rax
+  801afc:	85 c0                	test   %eax,%eax
+  801afe:	78 47                	js     801b47 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b00:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801b04:	41 8b 3e             	mov    (%r14),%edi
+  801b07:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801b0b:	48 b8 0e 17 80 00 00 	movabs $0x80170e,%rax
+  801b12:	00 00 00 
+  801b15:	ff d0                	call   *%rax
+  801b17:	85 c0                	test   %eax,%eax
+  801b19:	78 30                	js     801b4b <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801b1b:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801b20:	74 2d                	je     801b4f <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801b22:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b26:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801b2a:	48 85 c0             	test   %rax,%rax
+  801b2d:	74 56                	je     801b85 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801b2f:	4c 89 ea             	mov    %r13,%rdx
+  801b32:	4c 89 e6             	mov    %r12,%rsi
+  801b35:	4c 89 f7             	mov    %r14,%rdi
+  801b38:	ff d0                	call   *%rax
+}
+  801b3a:	48 83 c4 10          	add    $0x10,%rsp
+  801b3e:	5b                   	pop    %rbx
+  801b3f:	41 5c                	pop    %r12
+  801b41:	41 5d                	pop    %r13
+  801b43:	41 5e                	pop    %r14
+  801b45:	5d                   	pop    %rbp
+  801b46:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b47:	48 98                	cltq
+  801b49:	eb ef                	jmp    801b3a <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b4b:	48 98                	cltq
+  801b4d:	eb eb                	jmp    801b3a <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b4f:	48 a1 00 00 c1 00 00 	movabs 0xc10000,%rax
+  801b56:	00 00 00 
+  801b59:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801b5f:	89 da                	mov    %ebx,%edx
+  801b61:	48 bf 85 4e 80 00 00 	movabs $0x804e85,%rdi
+  801b68:	00 00 00 
+  801b6b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b70:	48 b9 7e 03 80 00 00 	movabs $0x80037e,%rcx
+  801b77:	00 00 00 
+  801b7a:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801b7c:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801b83:	eb b5                	jmp    801b3a <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801b85:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801b8c:	eb ac                	jmp    801b3a <write+0x65>
+
+0000000000801b8e <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801b8e:	55                   	push   %rbp
+  801b8f:	48 89 e5             	mov    %rsp,%rbp
+  801b92:	41 54                	push   %r12
+  801b94:	53                   	push   %rbx
+  801b95:	48 83 ec 10          	sub    $0x10,%rsp
+  801b99:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b9b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801b9f:	48 b8 c3 16 80 00 00 	movabs $0x8016c3,%rax
+  801ba6:	00 00 00 
+  801ba9:	ff d0                	call   *%rax
+  801bab:	85 c0                	test   %eax,%eax
+  801bad:	78 3e                	js     801bed <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801baf:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801bb3:	41 8b 3c 24          	mov    (%r12),%edi
+  801bb7:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801bbb:	48 b8 0e 17 80 00 00 	movabs $0x80170e,%rax
+  801bc2:	00 00 00 
+  801bc5:	ff d0                	call   *%rax
+  801bc7:	85 c0                	test   %eax,%eax
+  801bc9:	78 22                	js     801bed <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  801bcb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801bcf:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801bd3:	48 85 c0             	test   %rax,%rax
+  801bd6:	74 0b                	je     801be3 <seek+0x55>
+  801bd8:	89 de                	mov    %ebx,%esi
+  801bda:	4c 89 e7             	mov    %r12,%rdi
+  801bdd:	ff d0                	call   *%rax
+  801bdf:	85 c0                	test   %eax,%eax
+  801be1:	78 0a                	js     801bed <seek+0x5f>
+
+    fd->fd_offset = offset;
+  801be3:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  801be8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801bed:	48 83 c4 10          	add    $0x10,%rsp
+  801bf1:	5b                   	pop    %rbx
+  801bf2:	41 5c                	pop    %r12
+  801bf4:	5d                   	pop    %rbp
+  801bf5:	c3                   	ret
+
+0000000000801bf6 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801bf6:	55                   	push   %rbp
+  801bf7:	48 89 e5             	mov    %rsp,%rbp
+  801bfa:	41 55                	push   %r13
+  801bfc:	41 54                	push   %r12
+  801bfe:	53                   	push   %rbx
+  801bff:	48 83 ec 18          	sub    $0x18,%rsp
+  801c03:	89 fb                	mov    %edi,%ebx
+  801c05:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c08:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c0c:	48 b8 c3 16 80 00 00 	movabs $0x8016c3,%rax
+  801c13:	00 00 00 
+  801c16:	ff d0                	call   *%rax
+  801c18:	85 c0                	test   %eax,%eax
+  801c1a:	78 38                	js     801c54 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c1c:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801c20:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801c24:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c28:	48 b8 0e 17 80 00 00 	movabs $0x80170e,%rax
+  801c2f:	00 00 00 
+  801c32:	ff d0                	call   *%rax
+  801c34:	85 c0                	test   %eax,%eax
+  801c36:	78 1c                	js     801c54 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801c38:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801c3d:	74 20                	je     801c5f <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801c3f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c43:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801c47:	48 85 c0             	test   %rax,%rax
+  801c4a:	74 47                	je     801c93 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801c4c:	44 89 e6             	mov    %r12d,%esi
+  801c4f:	4c 89 ef             	mov    %r13,%rdi
+  801c52:	ff d0                	call   *%rax
+}
+  801c54:	48 83 c4 18          	add    $0x18,%rsp
+  801c58:	5b                   	pop    %rbx
+  801c59:	41 5c                	pop    %r12
+  801c5b:	41 5d                	pop    %r13
+  801c5d:	5d                   	pop    %rbp
+  801c5e:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801c5f:	48 a1 00 00 c1 00 00 	movabs 0xc10000,%rax
+  801c66:	00 00 00 
+  801c69:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801c6f:	89 da                	mov    %ebx,%edx
+  801c71:	48 bf 48 4e 80 00 00 	movabs $0x804e48,%rdi
+  801c78:	00 00 00 
+  801c7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c80:	48 b9 7e 03 80 00 00 	movabs $0x80037e,%rcx
+  801c87:	00 00 00 
+  801c8a:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801c8c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c91:	eb c1                	jmp    801c54 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801c93:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801c98:	eb ba                	jmp    801c54 <ftruncate+0x5e>
+
+0000000000801c9a <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801c9a:	55                   	push   %rbp
+  801c9b:	48 89 e5             	mov    %rsp,%rbp
+  801c9e:	41 54                	push   %r12
+  801ca0:	53                   	push   %rbx
+  801ca1:	48 83 ec 10          	sub    $0x10,%rsp
+  801ca5:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ca8:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801cac:	48 b8 c3 16 80 00 00 	movabs $0x8016c3,%rax
+  801cb3:	00 00 00 
+  801cb6:	ff d0                	call   *%rax
+  801cb8:	85 c0                	test   %eax,%eax
+  801cba:	78 4e                	js     801d0a <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801cbc:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801cc0:	41 8b 3c 24          	mov    (%r12),%edi
+  801cc4:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801cc8:	48 b8 0e 17 80 00 00 	movabs $0x80170e,%rax
+  801ccf:	00 00 00 
+  801cd2:	ff d0                	call   *%rax
+  801cd4:	85 c0                	test   %eax,%eax
+  801cd6:	78 32                	js     801d0a <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801cd8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801cdc:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801ce1:	74 30                	je     801d13 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801ce3:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801ce6:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801ced:	00 00 00 
+    stat->st_isdir = 0;
+  801cf0:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801cf7:	00 00 00 
+    stat->st_dev = dev;
+  801cfa:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801d01:	48 89 de             	mov    %rbx,%rsi
+  801d04:	4c 89 e7             	mov    %r12,%rdi
+  801d07:	ff 50 28             	call   *0x28(%rax)
+}
+  801d0a:	48 83 c4 10          	add    $0x10,%rsp
+  801d0e:	5b                   	pop    %rbx
+  801d0f:	41 5c                	pop    %r12
+  801d11:	5d                   	pop    %rbp
+  801d12:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801d13:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801d18:	eb f0                	jmp    801d0a <fstat+0x70>
+
+0000000000801d1a <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801d1a:	55                   	push   %rbp
+  801d1b:	48 89 e5             	mov    %rsp,%rbp
+  801d1e:	41 54                	push   %r12
+  801d20:	53                   	push   %rbx
+  801d21:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801d24:	be 00 00 00 00       	mov    $0x0,%esi
+  801d29:	48 b8 88 2e 80 00 00 	movabs $0x802e88,%rax
+  801d30:	00 00 00 
+  801d33:	ff d0                	call   *%rax
+  801d35:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801d37:	85 c0                	test   %eax,%eax
+  801d39:	78 25                	js     801d60 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801d3b:	4c 89 e6             	mov    %r12,%rsi
+  801d3e:	89 c7                	mov    %eax,%edi
+  801d40:	48 b8 9a 1c 80 00 00 	movabs $0x801c9a,%rax
+  801d47:	00 00 00 
+  801d4a:	ff d0                	call   *%rax
+  801d4c:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801d4f:	89 df                	mov    %ebx,%edi
+  801d51:	48 b8 28 18 80 00 00 	movabs $0x801828,%rax
+  801d58:	00 00 00 
+  801d5b:	ff d0                	call   *%rax
+
+    return res;
+  801d5d:	44 89 e3             	mov    %r12d,%ebx
+}
+  801d60:	89 d8                	mov    %ebx,%eax
+  801d62:	5b                   	pop    %rbx
+  801d63:	41 5c                	pop    %r12
+  801d65:	5d                   	pop    %rbp
+  801d66:	c3                   	ret
+
+0000000000801d67 <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  801d67:	48 b8 08 00 c2 00 00 	movabs $0xc20008,%rax
+  801d6e:	00 00 00 
+  801d71:	83 38 00             	cmpl   $0x0,(%rax)
+  801d74:	74 0a                	je     801d80 <fsenv+0x19>
+    return envid;
+}
+  801d76:	a1 08 00 c2 00 00 00 	movabs 0xc20008,%eax
+  801d7d:	00 00 
+  801d7f:	c3                   	ret
+fsenv(void) {
+  801d80:	55                   	push   %rbp
+  801d81:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  801d84:	bf 03 00 00 00       	mov    $0x3,%edi
+  801d89:	48 b8 55 47 80 00 00 	movabs $0x804755,%rax
+  801d90:	00 00 00 
+  801d93:	ff d0                	call   *%rax
+  801d95:	a3 08 00 c2 00 00 00 	movabs %eax,0xc20008
+  801d9c:	00 00 
+}
+  801d9e:	a1 08 00 c2 00 00 00 	movabs 0xc20008,%eax
+  801da5:	00 00 
+  801da7:	5d                   	pop    %rbp
+  801da8:	c3                   	ret
+
+0000000000801da9 <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  801da9:	55                   	push   %rbp
+  801daa:	48 89 e5             	mov    %rsp,%rbp
+  801dad:	41 54                	push   %r12
+  801daf:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  801db0:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801db5:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801dba:	48 89 de             	mov    %rbx,%rsi
+  801dbd:	bf 00 00 00 00       	mov    $0x0,%edi
+  801dc2:	48 b8 a8 12 80 00 00 	movabs $0x8012a8,%rax
+  801dc9:	00 00 00 
+  801dcc:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  801dce:	48 b8 00 26 c2 00 00 	movabs $0xc22600,%rax
+  801dd5:	00 00 00 
+  801dd8:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  801dde:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801de3:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801de8:	48 89 de             	mov    %rbx,%rsi
+  801deb:	bf 00 00 00 00       	mov    $0x0,%edi
+  801df0:	48 b8 02 12 80 00 00 	movabs $0x801202,%rax
+  801df7:	00 00 00 
+  801dfa:	ff d0                	call   *%rax
+  801dfc:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  801dfe:	85 c0                	test   %eax,%eax
+  801e00:	0f 88 a2 00 00 00    	js     801ea8 <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  801e06:	48 a1 00 00 c1 00 00 	movabs 0xc10000,%rax
+  801e0d:	00 00 00 
+  801e10:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801e16:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801e1b:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  801e1d:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  801e22:	49 bc ba 3f 80 00 00 	movabs $0x803fba,%r12
+  801e29:	00 00 00 
+  801e2c:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  801e2f:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  801e34:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  801e37:	48 b8 67 1d 80 00 00 	movabs $0x801d67,%rax
+  801e3e:	00 00 00 
+  801e41:	ff d0                	call   *%rax
+  801e43:	89 c7                	mov    %eax,%edi
+  801e45:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  801e4b:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  801e50:	48 89 da             	mov    %rbx,%rdx
+  801e53:	be 09 00 00 00       	mov    $0x9,%esi
+  801e58:	48 b8 ff 46 80 00 00 	movabs $0x8046ff,%rax
+  801e5f:	00 00 00 
+  801e62:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  801e64:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e69:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e6e:	be 00 00 00 00       	mov    $0x0,%esi
+  801e73:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e78:	48 b8 db 46 80 00 00 	movabs $0x8046db,%rax
+  801e7f:	00 00 00 
+  801e82:	ff d0                	call   *%rax
+  801e84:	89 c3                	mov    %eax,%ebx
+  801e86:	85 c0                	test   %eax,%eax
+  801e88:	78 25                	js     801eaf <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  801e8a:	48 a1 00 00 c1 00 00 	movabs 0xc10000,%rax
+  801e91:	00 00 00 
+  801e94:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801e9a:	a3 00 26 c2 00 00 00 	movabs %eax,0xc22600
+  801ea1:	00 00 
+    return 0;
+  801ea3:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  801ea8:	89 d8                	mov    %ebx,%eax
+  801eaa:	5b                   	pop    %rbx
+  801eab:	41 5c                	pop    %r12
+  801ead:	5d                   	pop    %rbp
+  801eae:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  801eaf:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801eb4:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  801eb9:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ebe:	48 b8 a8 12 80 00 00 	movabs $0x8012a8,%rax
+  801ec5:	00 00 00 
+  801ec8:	ff d0                	call   *%rax
+        return res;
+  801eca:	eb dc                	jmp    801ea8 <fschan_setup+0xff>
+
+0000000000801ecc <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  801ecc:	48 b8 04 26 c2 00 00 	movabs $0xc22604,%rax
+  801ed3:	00 00 00 
+  801ed6:	80 38 00             	cmpb   $0x0,(%rax)
+  801ed9:	74 55                	je     801f30 <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801edb:	48 a1 00 00 c1 00 00 	movabs 0xc10000,%rax
+  801ee2:	00 00 00 
+  801ee5:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  801eeb:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801ef0:	48 ba 00 26 c2 00 00 	movabs $0xc22600,%rdx
+  801ef7:	00 00 00 
+  801efa:	3b 0a                	cmp    (%rdx),%ecx
+  801efc:	75 01                	jne    801eff <fschan+0x33>
+}
+  801efe:	c3                   	ret
+fschan(void) {
+  801eff:	55                   	push   %rbp
+  801f00:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801f03:	48 b8 a9 1d 80 00 00 	movabs $0x801da9,%rax
+  801f0a:	00 00 00 
+  801f0d:	ff d0                	call   *%rax
+  801f0f:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  801f11:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801f16:	85 d2                	test   %edx,%edx
+  801f18:	78 02                	js     801f1c <fschan+0x50>
+}
+  801f1a:	5d                   	pop    %rbp
+  801f1b:	c3                   	ret
+        fschan_enabled = 0;
+  801f1c:	48 b8 04 26 c2 00 00 	movabs $0xc22604,%rax
+  801f23:	00 00 00 
+  801f26:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  801f29:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f2e:	eb ea                	jmp    801f1a <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  801f30:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f35:	c3                   	ret
+
+0000000000801f36 <fbuf>:
+fbuf(struct Fd *fd) {
+  801f36:	55                   	push   %rbp
+  801f37:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  801f3a:	48 b8 35 16 80 00 00 	movabs $0x801635,%rax
+  801f41:	00 00 00 
+  801f44:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  801f46:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f4b:	48 83 f8 1f          	cmp    $0x1f,%rax
+  801f4f:	77 12                	ja     801f63 <fbuf+0x2d>
+  801f51:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  801f55:	48 b8 00 23 c2 00 00 	movabs $0xc22300,%rax
+  801f5c:	00 00 00 
+  801f5f:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  801f63:	48 89 d0             	mov    %rdx,%rax
+  801f66:	5d                   	pop    %rbp
+  801f67:	c3                   	ret
+
+0000000000801f68 <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  801f68:	55                   	push   %rbp
+  801f69:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  801f6c:	48 83 c7 40          	add    $0x40,%rdi
+  801f70:	48 b8 f4 3f 80 00 00 	movabs $0x803ff4,%rax
+  801f77:	00 00 00 
+  801f7a:	ff d0                	call   *%rax
+  801f7c:	84 c0                	test   %al,%al
+  801f7e:	75 02                	jne    801f82 <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  801f80:	5d                   	pop    %rbp
+  801f81:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  801f82:	48 b8 67 1d 80 00 00 	movabs $0x801d67,%rax
+  801f89:	00 00 00 
+  801f8c:	ff d0                	call   *%rax
+  801f8e:	89 c7                	mov    %eax,%edi
+  801f90:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f96:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f9b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fa0:	be 0a 00 00 00       	mov    $0xa,%esi
+  801fa5:	48 b8 ff 46 80 00 00 	movabs $0x8046ff,%rax
+  801fac:	00 00 00 
+  801faf:	ff d0                	call   *%rax
+}
+  801fb1:	eb cd                	jmp    801f80 <fschan_publish+0x18>
+
+0000000000801fb3 <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  801fb3:	55                   	push   %rbp
+  801fb4:	48 89 e5             	mov    %rsp,%rbp
+  801fb7:	41 57                	push   %r15
+  801fb9:	41 56                	push   %r14
+  801fbb:	41 55                	push   %r13
+  801fbd:	41 54                	push   %r12
+  801fbf:	53                   	push   %rbx
+  801fc0:	48 83 ec 48          	sub    $0x48,%rsp
+  801fc4:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801fc8:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  801fcc:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  801fcf:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  801fd3:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  801fd6:	48 ba 04 00 c2 00 00 	movabs $0xc20004,%rdx
+  801fdd:	00 00 00 
+  801fe0:	8b 02                	mov    (%rdx),%eax
+  801fe2:	83 c0 01             	add    $0x1,%eax
+  801fe5:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801fea:	0f 44 c1             	cmove  %ecx,%eax
+  801fed:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  801fef:	4d 85 c0             	test   %r8,%r8
+  801ff2:	74 2c                	je     802020 <fschan_rw+0x6d>
+  801ff4:	45 89 ce             	mov    %r9d,%r14d
+  801ff7:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  801ffe:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  802002:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802008:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  80200f:	00 
+  802010:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802016:	b8 01 00 00 00       	mov    $0x1,%eax
+  80201b:	e9 41 01 00 00       	jmp    802161 <fschan_rw+0x1ae>
+  802020:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  802024:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802028:	e9 9c 01 00 00       	jmp    8021c9 <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  80202d:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  802031:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  802034:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  802037:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  80203a:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  80203e:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  802042:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  802046:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  80204a:	48 89 da             	mov    %rbx,%rdx
+  80204d:	48 b8 04 0f 80 00 00 	movabs $0x800f04,%rax
+  802054:	00 00 00 
+  802057:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  802059:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80205d:	48 b8 68 1f 80 00 00 	movabs $0x801f68,%rax
+  802064:	00 00 00 
+  802067:	ff d0                	call   *%rax
+            queued += blk;
+  802069:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  80206c:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  802070:	4d 39 fc             	cmp    %r15,%r12
+  802073:	73 6b                	jae    8020e0 <fschan_rw+0x12d>
+  802075:	41 83 fd 0f          	cmp    $0xf,%r13d
+  802079:	77 65                	ja     8020e0 <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  80207b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80207f:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  802083:	48 b8 cf 3f 80 00 00 	movabs $0x803fcf,%rax
+  80208a:	00 00 00 
+  80208d:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  80208f:	4c 89 fb             	mov    %r15,%rbx
+  802092:	4c 29 e3             	sub    %r12,%rbx
+  802095:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  80209a:	48 39 d3             	cmp    %rdx,%rbx
+  80209d:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  8020a1:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  8020a5:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  8020a9:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  8020ad:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  8020b0:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  8020b2:	48 b9 04 00 c2 00 00 	movabs $0xc20004,%rcx
+  8020b9:	00 00 00 
+  8020bc:	8b 09                	mov    (%rcx),%ecx
+  8020be:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  8020c1:	83 fe 03             	cmp    $0x3,%esi
+  8020c4:	0f 85 63 ff ff ff    	jne    80202d <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  8020ca:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8020ce:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  8020d1:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  8020d4:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  8020d7:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  8020db:	e9 79 ff ff ff       	jmp    802059 <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  8020e0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8020e4:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  8020eb:	48 89 df             	mov    %rbx,%rdi
+  8020ee:	48 b8 92 40 80 00 00 	movabs $0x804092,%rax
+  8020f5:	00 00 00 
+  8020f8:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  8020fa:	48 89 df             	mov    %rbx,%rdi
+  8020fd:	48 b8 20 40 80 00 00 	movabs $0x804020,%rax
+  802104:	00 00 00 
+  802107:	ff d0                	call   *%rax
+  802109:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  80210d:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  802111:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  802115:	75 25                	jne    80213c <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  802117:	8b 40 04             	mov    0x4(%rax),%eax
+  80211a:	85 c0                	test   %eax,%eax
+  80211c:	0f 88 86 00 00 00    	js     8021a8 <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  802122:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  802126:	74 5b                	je     802183 <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  802128:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  80212c:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  802130:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  802134:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  802138:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  80213c:	48 89 df             	mov    %rbx,%rdi
+  80213f:	48 b8 47 40 80 00 00 	movabs $0x804047,%rax
+  802146:	00 00 00 
+  802149:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  80214b:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  80214f:	83 f0 01             	xor    $0x1,%eax
+  802152:	4d 39 fc             	cmp    %r15,%r12
+  802155:	0f 92 c2             	setb   %dl
+  802158:	84 c2                	test   %al,%dl
+  80215a:	75 05                	jne    802161 <fschan_rw+0x1ae>
+  80215c:	45 85 ed             	test   %r13d,%r13d
+  80215f:	74 50                	je     8021b1 <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  802161:	4d 39 fc             	cmp    %r15,%r12
+  802164:	0f 92 c1             	setb   %cl
+  802167:	41 83 fd 0f          	cmp    $0xf,%r13d
+  80216b:	0f 96 c2             	setbe  %dl
+  80216e:	84 d1                	test   %dl,%cl
+  802170:	0f 84 6a ff ff ff    	je     8020e0 <fschan_rw+0x12d>
+  802176:	84 c0                	test   %al,%al
+  802178:	0f 85 fd fe ff ff    	jne    80207b <fschan_rw+0xc8>
+  80217e:	e9 5d ff ff ff       	jmp    8020e0 <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  802183:	48 63 d0             	movslq %eax,%rdx
+  802186:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80218a:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  80218e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802192:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  802196:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  80219a:	48 b8 04 0f 80 00 00 	movabs $0x800f04,%rax
+  8021a1:	00 00 00 
+  8021a4:	ff d0                	call   *%rax
+  8021a6:	eb 80                	jmp    802128 <fschan_rw+0x175>
+                err = msg->fm_res;
+  8021a8:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  8021ab:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  8021af:	eb 8b                	jmp    80213c <fschan_rw+0x189>
+    return done || !err ? done : err;
+  8021b1:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  8021b6:	0f 85 68 fe ff ff    	jne    802024 <fschan_rw+0x71>
+  8021bc:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  8021bf:	85 c0                	test   %eax,%eax
+  8021c1:	0f 84 5d fe ff ff    	je     802024 <fschan_rw+0x71>
+  8021c7:	48 98                	cltq
+}
+  8021c9:	48 83 c4 48          	add    $0x48,%rsp
+  8021cd:	5b                   	pop    %rbx
+  8021ce:	41 5c                	pop    %r12
+  8021d0:	41 5d                	pop    %r13
+  8021d2:	41 5e                	pop    %r14
+  8021d4:	41 5f                	pop    %r15
+  8021d6:	5d                   	pop    %rbp
+  8021d7:	c3                   	ret
+
+00000000008021d8 <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  8021d8:	55                   	push   %rbp
+  8021d9:	48 89 e5             	mov    %rsp,%rbp
+  8021dc:	41 56                	push   %r14
+  8021de:	41 55                	push   %r13
+  8021e0:	41 54                	push   %r12
+  8021e2:	53                   	push   %rbx
+  8021e3:	48 83 ec 10          	sub    $0x10,%rsp
+  8021e7:	49 89 fe             	mov    %rdi,%r14
+  8021ea:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  8021ed:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  8021f1:	48 29 f3             	sub    %rsi,%rbx
+  8021f4:	48 39 d3             	cmp    %rdx,%rbx
+  8021f7:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  8021fb:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  802202:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  802203:	bf 00 10 00 00       	mov    $0x1000,%edi
+  802208:	49 bd 51 3e 80 00 00 	movabs $0x803e51,%r13
+  80220f:	00 00 00 
+  802212:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  802219:	76 1e                	jbe    802239 <mmap_fault+0x61>
+  80221b:	4c 01 e7             	add    %r12,%rdi
+  80221e:	41 ff d5             	call   *%r13
+  802221:	84 c0                	test   %al,%al
+  802223:	75 14                	jne    802239 <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  802225:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802229:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  802230:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  802234:	48 39 df             	cmp    %rbx,%rdi
+  802237:	72 e2                	jb     80221b <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  802239:	48 bb 00 10 c2 00 00 	movabs $0xc21000,%rbx
+  802240:	00 00 00 
+  802243:	48 ba 00 20 c2 00 00 	movabs $0xc22000,%rdx
+  80224a:	00 00 00 
+  80224d:	4c 89 f0             	mov    %r14,%rax
+  802250:	48 29 d0             	sub    %rdx,%rax
+  802253:	48 c1 f8 03          	sar    $0x3,%rax
+  802257:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  80225e:	aa aa aa 
+  802261:	48 0f af c2          	imul   %rdx,%rax
+  802265:	48 c1 e0 0c          	shl    $0xc,%rax
+  802269:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  80226e:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  802272:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  802274:	44 89 e0             	mov    %r12d,%eax
+  802277:	41 03 46 10          	add    0x10(%r14),%eax
+  80227b:	41 2b 06             	sub    (%r14),%eax
+  80227e:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  802281:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802285:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  802289:	41 8b 46 14          	mov    0x14(%r14),%eax
+  80228d:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  802290:	48 b8 67 1d 80 00 00 	movabs $0x801d67,%rax
+  802297:	00 00 00 
+  80229a:	ff d0                	call   *%rax
+  80229c:	89 c7                	mov    %eax,%edi
+  80229e:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8022a4:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8022a9:	48 89 da             	mov    %rbx,%rdx
+  8022ac:	be 0f 00 00 00       	mov    $0xf,%esi
+  8022b1:	48 b8 ff 46 80 00 00 	movabs $0x8046ff,%rax
+  8022b8:	00 00 00 
+  8022bb:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  8022bd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022c2:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8022c6:	4c 89 e6             	mov    %r12,%rsi
+  8022c9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022ce:	48 b8 db 46 80 00 00 	movabs $0x8046db,%rax
+  8022d5:	00 00 00 
+  8022d8:	ff d0                	call   *%rax
+  8022da:	48 98                	cltq
+}
+  8022dc:	48 83 c4 10          	add    $0x10,%rsp
+  8022e0:	5b                   	pop    %rbx
+  8022e1:	41 5c                	pop    %r12
+  8022e3:	41 5d                	pop    %r13
+  8022e5:	41 5e                	pop    %r14
+  8022e7:	5d                   	pop    %rbp
+  8022e8:	c3                   	ret
+
+00000000008022e9 <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  8022e9:	48 8b 37             	mov    (%rdi),%rsi
+  8022ec:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  8022f3:	48 ba 00 20 c2 00 00 	movabs $0xc22000,%rdx
+  8022fa:	00 00 00 
+  8022fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802302:	eb 0f                	jmp    802313 <mmap_pgfault+0x2a>
+  802304:	c3                   	ret
+  802305:	48 83 c1 01          	add    $0x1,%rcx
+  802309:	48 83 c2 18          	add    $0x18,%rdx
+  80230d:	48 83 f9 20          	cmp    $0x20,%rcx
+  802311:	74 6e                	je     802381 <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  802313:	48 8b 02             	mov    (%rdx),%rax
+  802316:	48 83 e8 01          	sub    $0x1,%rax
+  80231a:	48 39 f0             	cmp    %rsi,%rax
+  80231d:	73 e6                	jae    802305 <mmap_pgfault+0x1c>
+  80231f:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  802323:	73 e0                	jae    802305 <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  802325:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  802329:	b8 00 00 00 00       	mov    $0x0,%eax
+  80232e:	f6 c2 01             	test   $0x1,%dl
+  802331:	75 d1                	jne    802304 <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  802333:	f6 c2 02             	test   $0x2,%dl
+  802336:	74 1a                	je     802352 <mmap_pgfault+0x69>
+  802338:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  80233c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802341:	48 bf 00 20 c2 00 00 	movabs $0xc22000,%rdi
+  802348:	00 00 00 
+  80234b:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  802350:	74 35                	je     802387 <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  802352:	55                   	push   %rbp
+  802353:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  802356:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  80235a:	48 b8 00 20 c2 00 00 	movabs $0xc22000,%rax
+  802361:	00 00 00 
+  802364:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  802368:	ba 00 00 01 00       	mov    $0x10000,%edx
+  80236d:	48 b8 d8 21 80 00 00 	movabs $0x8021d8,%rax
+  802374:	00 00 00 
+  802377:	ff d0                	call   *%rax
+  802379:	48 85 c0             	test   %rax,%rax
+  80237c:	0f 9f c0             	setg   %al
+}
+  80237f:	5d                   	pop    %rbp
+  802380:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  802381:	b8 00 00 00 00       	mov    $0x0,%eax
+  802386:	c3                   	ret
+}
+  802387:	c3                   	ret
+
+0000000000802388 <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  802388:	55                   	push   %rbp
+  802389:	48 89 e5             	mov    %rsp,%rbp
+  80238c:	41 54                	push   %r12
+  80238e:	53                   	push   %rbx
+  80238f:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802392:	48 b8 00 20 c2 00 00 	movabs $0xc22000,%rax
+  802399:	00 00 00 
+  80239c:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  8023a1:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8023a5:	74 15                	je     8023bc <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8023a7:	48 83 c3 01          	add    $0x1,%rbx
+  8023ab:	48 83 c0 18          	add    $0x18,%rax
+  8023af:	48 83 fb 20          	cmp    $0x20,%rbx
+  8023b3:	75 ec                	jne    8023a1 <mmap_alloc+0x19>
+    return NULL;
+  8023b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023ba:	eb 52                	jmp    80240e <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  8023bc:	4c 89 e7             	mov    %r12,%rdi
+  8023bf:	48 b8 f2 3d 80 00 00 	movabs $0x803df2,%rax
+  8023c6:	00 00 00 
+  8023c9:	ff d0                	call   *%rax
+  8023cb:	41 89 c1             	mov    %eax,%r9d
+  8023ce:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  8023d5:	48 c1 e1 0c          	shl    $0xc,%rcx
+  8023d9:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8023df:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023e4:	4c 89 e6             	mov    %r12,%rsi
+  8023e7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023ec:	48 b8 58 12 80 00 00 	movabs $0x801258,%rax
+  8023f3:	00 00 00 
+  8023f6:	ff d0                	call   *%rax
+  8023f8:	85 c0                	test   %eax,%eax
+  8023fa:	78 17                	js     802413 <mmap_alloc+0x8b>
+        return &mmaps[i];
+  8023fc:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  802400:	48 b8 00 20 c2 00 00 	movabs $0xc22000,%rax
+  802407:	00 00 00 
+  80240a:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  80240e:	5b                   	pop    %rbx
+  80240f:	41 5c                	pop    %r12
+  802411:	5d                   	pop    %rbp
+  802412:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  802413:	b8 00 00 00 00       	mov    $0x0,%eax
+  802418:	eb f4                	jmp    80240e <mmap_alloc+0x86>
+
+000000000080241a <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  80241a:	55                   	push   %rbp
+  80241b:	48 89 e5             	mov    %rsp,%rbp
+  80241e:	41 56                	push   %r14
+  802420:	41 55                	push   %r13
+  802422:	41 54                	push   %r12
+  802424:	53                   	push   %rbx
+  802425:	48 83 ec 10          	sub    $0x10,%rsp
+  802429:	41 89 fc             	mov    %edi,%r12d
+  80242c:	49 89 f5             	mov    %rsi,%r13
+  80242f:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  802432:	48 89 f0             	mov    %rsi,%rax
+  802435:	48 09 d0             	or     %rdx,%rax
+  802438:	75 0d                	jne    802447 <fsipc+0x2d>
+  80243a:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  80243d:	83 f8 04             	cmp    $0x4,%eax
+  802440:	76 7d                	jbe    8024bf <fsipc+0xa5>
+  802442:	83 ff 0d             	cmp    $0xd,%edi
+  802445:	74 78                	je     8024bf <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  802447:	48 b8 67 1d 80 00 00 	movabs $0x801d67,%rax
+  80244e:	00 00 00 
+  802451:	ff d0                	call   *%rax
+  802453:	89 c7                	mov    %eax,%edi
+  802455:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  80245c:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  802463:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  80246a:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802470:	48 ba 00 00 c3 00 00 	movabs $0xc30000,%rdx
+  802477:	00 00 00 
+  80247a:	44 89 e6             	mov    %r12d,%esi
+  80247d:	48 b8 ff 46 80 00 00 	movabs $0x8046ff,%rax
+  802484:	00 00 00 
+  802487:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  802489:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  802490:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  802491:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802496:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80249a:	4c 89 ee             	mov    %r13,%rsi
+  80249d:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024a2:	48 b8 db 46 80 00 00 	movabs $0x8046db,%rax
+  8024a9:	00 00 00 
+  8024ac:	ff d0                	call   *%rax
+  8024ae:	89 c3                	mov    %eax,%ebx
+}
+  8024b0:	89 d8                	mov    %ebx,%eax
+  8024b2:	48 83 c4 10          	add    $0x10,%rsp
+  8024b6:	5b                   	pop    %rbx
+  8024b7:	41 5c                	pop    %r12
+  8024b9:	41 5d                	pop    %r13
+  8024bb:	41 5e                	pop    %r14
+  8024bd:	5d                   	pop    %rbp
+  8024be:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  8024bf:	48 b8 cc 1e 80 00 00 	movabs $0x801ecc,%rax
+  8024c6:	00 00 00 
+  8024c9:	ff d0                	call   *%rax
+  8024cb:	49 89 c6             	mov    %rax,%r14
+  8024ce:	48 85 c0             	test   %rax,%rax
+  8024d1:	0f 84 70 ff ff ff    	je     802447 <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  8024d7:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  8024db:	48 b8 cf 3f 80 00 00 	movabs $0x803fcf,%rax
+  8024e2:	00 00 00 
+  8024e5:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  8024e7:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  8024ea:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  8024f1:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  8024f5:	ba 10 00 00 00       	mov    $0x10,%edx
+  8024fa:	48 be 00 00 c3 00 00 	movabs $0xc30000,%rsi
+  802501:	00 00 00 
+  802504:	48 b8 04 0f 80 00 00 	movabs $0x800f04,%rax
+  80250b:	00 00 00 
+  80250e:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  802510:	4c 89 f7             	mov    %r14,%rdi
+  802513:	48 b8 68 1f 80 00 00 	movabs $0x801f68,%rax
+  80251a:	00 00 00 
+  80251d:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  80251f:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  802526:	4c 89 f7             	mov    %r14,%rdi
+  802529:	48 b8 92 40 80 00 00 	movabs $0x804092,%rax
+  802530:	00 00 00 
+  802533:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  802535:	4c 89 f7             	mov    %r14,%rdi
+  802538:	48 b8 20 40 80 00 00 	movabs $0x804020,%rax
+  80253f:	00 00 00 
+  802542:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  802544:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  802547:	41 83 fc 05          	cmp    $0x5,%r12d
+  80254b:	75 04                	jne    802551 <fsipc+0x137>
+  80254d:	85 db                	test   %ebx,%ebx
+  80254f:	79 14                	jns    802565 <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  802551:	4c 89 f7             	mov    %r14,%rdi
+  802554:	48 b8 47 40 80 00 00 	movabs $0x804047,%rax
+  80255b:	00 00 00 
+  80255e:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  802560:	e9 4b ff ff ff       	jmp    8024b0 <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  802565:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  802569:	ba 88 00 00 00       	mov    $0x88,%edx
+  80256e:	48 bf 00 00 c3 00 00 	movabs $0xc30000,%rdi
+  802575:	00 00 00 
+  802578:	48 b8 04 0f 80 00 00 	movabs $0x800f04,%rax
+  80257f:	00 00 00 
+  802582:	ff d0                	call   *%rax
+  802584:	eb cb                	jmp    802551 <fsipc+0x137>
+
+0000000000802586 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  802586:	55                   	push   %rbp
+  802587:	48 89 e5             	mov    %rsp,%rbp
+  80258a:	41 57                	push   %r15
+  80258c:	41 56                	push   %r14
+  80258e:	41 55                	push   %r13
+  802590:	41 54                	push   %r12
+  802592:	53                   	push   %rbx
+  802593:	48 83 ec 18          	sub    $0x18,%rsp
+  802597:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  80259b:	49 89 f6             	mov    %rsi,%r14
+  80259e:	49 89 d4             	mov    %rdx,%r12
+  8025a1:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  8025a4:	48 b8 cc 1e 80 00 00 	movabs $0x801ecc,%rax
+  8025ab:	00 00 00 
+  8025ae:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  8025b0:	48 85 c0             	test   %rax,%rax
+  8025b3:	0f 85 96 00 00 00    	jne    80264f <devfile_write_direct+0xc9>
+    size_t write = 0;
+  8025b9:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8025c0:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8025c1:	49 bf 00 00 c3 00 00 	movabs $0xc30000,%r15
+  8025c8:	00 00 00 
+    while (n) {
+  8025cb:	4d 85 e4             	test   %r12,%r12
+  8025ce:	74 79                	je     802649 <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  8025d0:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  8025d5:	49 39 dc             	cmp    %rbx,%r12
+  8025d8:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  8025dc:	48 89 da             	mov    %rbx,%rdx
+  8025df:	4c 89 f6             	mov    %r14,%rsi
+  8025e2:	48 bf 00 10 c3 00 00 	movabs $0xc31000,%rdi
+  8025e9:	00 00 00 
+  8025ec:	48 b8 04 0f 80 00 00 	movabs $0x800f04,%rax
+  8025f3:	00 00 00 
+  8025f6:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8025f8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8025fc:	8b 40 0c             	mov    0xc(%rax),%eax
+  8025ff:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  802602:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802605:	44 01 e8             	add    %r13d,%eax
+  802608:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  80260c:	41 0f 44 c5          	cmove  %r13d,%eax
+  802610:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  802614:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  802618:	48 89 da             	mov    %rbx,%rdx
+  80261b:	be 00 00 00 00       	mov    $0x0,%esi
+  802620:	bf 04 00 00 00       	mov    $0x4,%edi
+  802625:	48 b8 1a 24 80 00 00 	movabs $0x80241a,%rax
+  80262c:	00 00 00 
+  80262f:	ff d0                	call   *%rax
+        if (res < 0)
+  802631:	85 c0                	test   %eax,%eax
+  802633:	78 4a                	js     80267f <devfile_write_direct+0xf9>
+        buf += res;
+  802635:	48 98                	cltq
+  802637:	49 01 c6             	add    %rax,%r14
+        write += res;
+  80263a:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  80263e:	49 29 c4             	sub    %rax,%r12
+  802641:	75 8d                	jne    8025d0 <devfile_write_direct+0x4a>
+    return write;
+  802643:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802647:	eb 27                	jmp    802670 <devfile_write_direct+0xea>
+    size_t write = 0;
+  802649:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  80264d:	eb f4                	jmp    802643 <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  80264f:	45 89 e9             	mov    %r13d,%r9d
+  802652:	4d 89 e0             	mov    %r12,%r8
+  802655:	4c 89 f1             	mov    %r14,%rcx
+  802658:	ba 04 00 00 00       	mov    $0x4,%edx
+  80265d:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802661:	48 89 c7             	mov    %rax,%rdi
+  802664:	48 b8 b3 1f 80 00 00 	movabs $0x801fb3,%rax
+  80266b:	00 00 00 
+  80266e:	ff d0                	call   *%rax
+}
+  802670:	48 83 c4 18          	add    $0x18,%rsp
+  802674:	5b                   	pop    %rbx
+  802675:	41 5c                	pop    %r12
+  802677:	41 5d                	pop    %r13
+  802679:	41 5e                	pop    %r14
+  80267b:	41 5f                	pop    %r15
+  80267d:	5d                   	pop    %rbp
+  80267e:	c3                   	ret
+            return res;
+  80267f:	48 98                	cltq
+  802681:	eb ed                	jmp    802670 <devfile_write_direct+0xea>
+
+0000000000802683 <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  802683:	55                   	push   %rbp
+  802684:	48 89 e5             	mov    %rsp,%rbp
+  802687:	41 54                	push   %r12
+  802689:	53                   	push   %rbx
+  80268a:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  80268d:	48 b8 36 1f 80 00 00 	movabs $0x801f36,%rax
+  802694:	00 00 00 
+  802697:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  802699:	48 85 c0             	test   %rax,%rax
+  80269c:	74 71                	je     80270f <fbuf_flush+0x8c>
+  80269e:	48 89 c3             	mov    %rax,%rbx
+  8026a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026a6:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  8026aa:	75 05                	jne    8026b1 <fbuf_flush+0x2e>
+}
+  8026ac:	5b                   	pop    %rbx
+  8026ad:	41 5c                	pop    %r12
+  8026af:	5d                   	pop    %rbp
+  8026b0:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  8026b1:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  8026b4:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  8026b8:	48 b8 00 23 c2 00 00 	movabs $0xc22300,%rax
+  8026bf:	00 00 00 
+  8026c2:	48 89 de             	mov    %rbx,%rsi
+  8026c5:	48 29 c6             	sub    %rax,%rsi
+  8026c8:	48 c1 fe 03          	sar    $0x3,%rsi
+  8026cc:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8026d3:	aa aa aa 
+  8026d6:	48 0f af f0          	imul   %rax,%rsi
+  8026da:	48 c1 e6 0e          	shl    $0xe,%rsi
+  8026de:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  8026e3:	48 01 c6             	add    %rax,%rsi
+  8026e6:	4c 89 e7             	mov    %r12,%rdi
+  8026e9:	48 b8 86 25 80 00 00 	movabs $0x802586,%rax
+  8026f0:	00 00 00 
+  8026f3:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  8026f5:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  8026f9:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802700:	00 
+    return res < 0 ? res : 0;
+  802701:	48 85 c0             	test   %rax,%rax
+  802704:	ba 00 00 00 00       	mov    $0x0,%edx
+  802709:	48 0f 4f c2          	cmovg  %rdx,%rax
+  80270d:	eb 9d                	jmp    8026ac <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  80270f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802714:	eb 96                	jmp    8026ac <fbuf_flush+0x29>
+
+0000000000802716 <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  802716:	55                   	push   %rbp
+  802717:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  80271a:	48 b8 83 26 80 00 00 	movabs $0x802683,%rax
+  802721:	00 00 00 
+  802724:	ff d0                	call   *%rax
+}
+  802726:	5d                   	pop    %rbp
+  802727:	c3                   	ret
+
+0000000000802728 <devfile_write>:
+    if (!fd || !buf)
+  802728:	48 85 ff             	test   %rdi,%rdi
+  80272b:	0f 84 d3 01 00 00    	je     802904 <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802731:	55                   	push   %rbp
+  802732:	48 89 e5             	mov    %rsp,%rbp
+  802735:	41 57                	push   %r15
+  802737:	41 56                	push   %r14
+  802739:	41 55                	push   %r13
+  80273b:	41 54                	push   %r12
+  80273d:	53                   	push   %rbx
+  80273e:	48 83 ec 08          	sub    $0x8,%rsp
+  802742:	49 89 fc             	mov    %rdi,%r12
+  802745:	49 89 f6             	mov    %rsi,%r14
+  802748:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  80274b:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802750:	48 85 f6             	test   %rsi,%rsi
+  802753:	0f 84 9c 01 00 00    	je     8028f5 <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  802759:	48 b8 36 1f 80 00 00 	movabs $0x801f36,%rax
+  802760:	00 00 00 
+  802763:	ff d0                	call   *%rax
+  802765:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  802768:	48 85 c0             	test   %rax,%rax
+  80276b:	0f 84 a2 00 00 00    	je     802813 <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802771:	be 00 10 00 00       	mov    $0x1000,%esi
+  802776:	4c 89 e7             	mov    %r12,%rdi
+  802779:	48 b8 c7 11 80 00 00 	movabs $0x8011c7,%rax
+  802780:	00 00 00 
+  802783:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  802785:	83 f8 02             	cmp    $0x2,%eax
+  802788:	0f 8f 85 00 00 00    	jg     802813 <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  80278e:	48 b8 00 23 c2 00 00 	movabs $0xc22300,%rax
+  802795:	00 00 00 
+  802798:	4d 89 ef             	mov    %r13,%r15
+  80279b:	49 29 c7             	sub    %rax,%r15
+  80279e:	49 c1 ff 03          	sar    $0x3,%r15
+  8027a2:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8027a9:	aa aa aa 
+  8027ac:	4c 0f af f8          	imul   %rax,%r15
+  8027b0:	49 c1 e7 0e          	shl    $0xe,%r15
+  8027b4:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  8027b9:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  8027bc:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  8027c1:	0f 84 d7 00 00 00    	je     80289e <devfile_write+0x176>
+  8027c7:	49 8b 45 10          	mov    0x10(%r13),%rax
+  8027cb:	89 c2                	mov    %eax,%edx
+  8027cd:	41 03 55 0c          	add    0xc(%r13),%edx
+  8027d1:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  8027d6:	75 0f                	jne    8027e7 <devfile_write+0xbf>
+  8027d8:	48 01 d8             	add    %rbx,%rax
+  8027db:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  8027e1:	0f 86 92 00 00 00    	jbe    802879 <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  8027e7:	4c 89 e7             	mov    %r12,%rdi
+  8027ea:	48 b8 83 26 80 00 00 	movabs $0x802683,%rax
+  8027f1:	00 00 00 
+  8027f4:	ff d0                	call   *%rax
+  8027f6:	85 c0                	test   %eax,%eax
+  8027f8:	78 52                	js     80284c <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  8027fa:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802801:	77 7f                	ja     802882 <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  802803:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802808:	0f 85 c2 00 00 00    	jne    8028d0 <devfile_write+0x1a8>
+  80280e:	e9 94 00 00 00       	jmp    8028a7 <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  802813:	4c 89 e7             	mov    %r12,%rdi
+  802816:	48 b8 83 26 80 00 00 	movabs $0x802683,%rax
+  80281d:	00 00 00 
+  802820:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802822:	85 c0                	test   %eax,%eax
+  802824:	79 07                	jns    80282d <devfile_write+0x105>
+  802826:	48 98                	cltq
+  802828:	e9 c8 00 00 00       	jmp    8028f5 <devfile_write+0x1cd>
+  80282d:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802832:	48 89 da             	mov    %rbx,%rdx
+  802835:	4c 89 f6             	mov    %r14,%rsi
+  802838:	4c 89 e7             	mov    %r12,%rdi
+  80283b:	48 b8 86 25 80 00 00 	movabs $0x802586,%rax
+  802842:	00 00 00 
+  802845:	ff d0                	call   *%rax
+  802847:	e9 a9 00 00 00       	jmp    8028f5 <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  80284c:	48 98                	cltq
+  80284e:	e9 a2 00 00 00       	jmp    8028f5 <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802853:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802858:	ba 00 40 00 00       	mov    $0x4000,%edx
+  80285d:	4c 89 fe             	mov    %r15,%rsi
+  802860:	bf 00 00 00 00       	mov    $0x0,%edi
+  802865:	48 b8 02 12 80 00 00 	movabs $0x801202,%rax
+  80286c:	00 00 00 
+  80286f:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  802871:	85 c0                	test   %eax,%eax
+  802873:	79 45                	jns    8028ba <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802875:	48 98                	cltq
+  802877:	eb 7c                	jmp    8028f5 <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802879:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802880:	76 4e                	jbe    8028d0 <devfile_write+0x1a8>
+  802882:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802887:	48 89 da             	mov    %rbx,%rdx
+  80288a:	4c 89 f6             	mov    %r14,%rsi
+  80288d:	4c 89 e7             	mov    %r12,%rdi
+  802890:	48 b8 86 25 80 00 00 	movabs $0x802586,%rax
+  802897:	00 00 00 
+  80289a:	ff d0                	call   *%rax
+  80289c:	eb 57                	jmp    8028f5 <devfile_write+0x1cd>
+  80289e:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  8028a5:	77 db                	ja     802882 <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  8028a7:	4c 89 ff             	mov    %r15,%rdi
+  8028aa:	48 b8 51 3e 80 00 00 	movabs $0x803e51,%rax
+  8028b1:	00 00 00 
+  8028b4:	ff d0                	call   *%rax
+  8028b6:	84 c0                	test   %al,%al
+  8028b8:	74 99                	je     802853 <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  8028ba:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  8028bf:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8028c4:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  8028c8:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  8028cf:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  8028d0:	4c 89 ff             	mov    %r15,%rdi
+  8028d3:	49 03 7d 10          	add    0x10(%r13),%rdi
+  8028d7:	48 89 da             	mov    %rbx,%rdx
+  8028da:	4c 89 f6             	mov    %r14,%rsi
+  8028dd:	48 b8 04 0f 80 00 00 	movabs $0x800f04,%rax
+  8028e4:	00 00 00 
+  8028e7:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  8028e9:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  8028ed:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  8028f2:	48 89 d8             	mov    %rbx,%rax
+}
+  8028f5:	48 83 c4 08          	add    $0x8,%rsp
+  8028f9:	5b                   	pop    %rbx
+  8028fa:	41 5c                	pop    %r12
+  8028fc:	41 5d                	pop    %r13
+  8028fe:	41 5e                	pop    %r14
+  802900:	41 5f                	pop    %r15
+  802902:	5d                   	pop    %rbp
+  802903:	c3                   	ret
+        return E_INVAL;
+  802904:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802909:	c3                   	ret
+
+000000000080290a <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80290a:	55                   	push   %rbp
+  80290b:	48 89 e5             	mov    %rsp,%rbp
+  80290e:	41 54                	push   %r12
+  802910:	53                   	push   %rbx
+  802911:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  802914:	48 b8 83 26 80 00 00 	movabs $0x802683,%rax
+  80291b:	00 00 00 
+  80291e:	ff d0                	call   *%rax
+  802920:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  802923:	48 89 df             	mov    %rbx,%rdi
+  802926:	48 b8 36 1f 80 00 00 	movabs $0x801f36,%rax
+  80292d:	00 00 00 
+  802930:	ff d0                	call   *%rax
+  802932:	48 85 c0             	test   %rax,%rax
+  802935:	74 17                	je     80294e <devfile_flush+0x44>
+  802937:	48 89 df             	mov    %rbx,%rdi
+  80293a:	48 b8 36 1f 80 00 00 	movabs $0x801f36,%rax
+  802941:	00 00 00 
+  802944:	ff d0                	call   *%rax
+  802946:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  80294d:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80294e:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802951:	a3 00 00 c3 00 00 00 	movabs %eax,0xc30000
+  802958:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  80295a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80295f:	be 00 00 00 00       	mov    $0x0,%esi
+  802964:	bf 06 00 00 00       	mov    $0x6,%edi
+  802969:	48 b8 1a 24 80 00 00 	movabs $0x80241a,%rax
+  802970:	00 00 00 
+  802973:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802975:	45 85 e4             	test   %r12d,%r12d
+  802978:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  80297c:	5b                   	pop    %rbx
+  80297d:	41 5c                	pop    %r12
+  80297f:	5d                   	pop    %rbp
+  802980:	c3                   	ret
+
+0000000000802981 <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  802981:	55                   	push   %rbp
+  802982:	48 89 e5             	mov    %rsp,%rbp
+  802985:	41 57                	push   %r15
+  802987:	41 56                	push   %r14
+  802989:	41 55                	push   %r13
+  80298b:	41 54                	push   %r12
+  80298d:	53                   	push   %rbx
+  80298e:	48 83 ec 38          	sub    $0x38,%rsp
+  802992:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  802996:	49 89 f7             	mov    %rsi,%r15
+  802999:	48 89 d3             	mov    %rdx,%rbx
+  80299c:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  80299f:	48 b8 cc 1e 80 00 00 	movabs $0x801ecc,%rax
+  8029a6:	00 00 00 
+  8029a9:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  8029ab:	48 85 c0             	test   %rax,%rax
+  8029ae:	75 20                	jne    8029d0 <devfile_read_direct+0x4f>
+    bool map = 1;
+  8029b0:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  8029b5:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  8029bc:	00 
+    while (n) {
+  8029bd:	48 85 db             	test   %rbx,%rbx
+  8029c0:	0f 85 df 00 00 00    	jne    802aa5 <devfile_read_direct+0x124>
+    size_t read = 0;
+  8029c6:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  8029ca:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8029ce:	eb 21                	jmp    8029f1 <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  8029d0:	45 89 f1             	mov    %r14d,%r9d
+  8029d3:	49 89 d8             	mov    %rbx,%r8
+  8029d6:	4c 89 f9             	mov    %r15,%rcx
+  8029d9:	ba 03 00 00 00       	mov    $0x3,%edx
+  8029de:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  8029e2:	48 89 c7             	mov    %rax,%rdi
+  8029e5:	48 b8 b3 1f 80 00 00 	movabs $0x801fb3,%rax
+  8029ec:	00 00 00 
+  8029ef:	ff d0                	call   *%rax
+}
+  8029f1:	48 83 c4 38          	add    $0x38,%rsp
+  8029f5:	5b                   	pop    %rbx
+  8029f6:	41 5c                	pop    %r12
+  8029f8:	41 5d                	pop    %r13
+  8029fa:	41 5e                	pop    %r14
+  8029fc:	41 5f                	pop    %r15
+  8029fe:	5d                   	pop    %rbp
+  8029ff:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802a00:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802a04:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802a0a:	75 1e                	jne    802a2a <devfile_read_direct+0xa9>
+  802a0c:	e9 e2 00 00 00       	jmp    802af3 <devfile_read_direct+0x172>
+            if (!res) return read;
+  802a11:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802a15:	eb da                	jmp    8029f1 <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  802a17:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  802a1b:	0f 85 d0 01 00 00    	jne    802bf1 <devfile_read_direct+0x270>
+            map = 0;
+  802a21:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802a25:	eb 03                	jmp    802a2a <devfile_read_direct+0xa9>
+  802a27:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802a2a:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802a2f:	48 39 d3             	cmp    %rdx,%rbx
+  802a32:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802a36:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802a3a:	8b 40 0c             	mov    0xc(%rax),%eax
+  802a3d:	48 b9 00 00 c3 00 00 	movabs $0xc30000,%rcx
+  802a44:	00 00 00 
+  802a47:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  802a49:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  802a4d:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  802a51:	be 00 00 00 00       	mov    $0x0,%esi
+  802a56:	bf 03 00 00 00       	mov    $0x3,%edi
+  802a5b:	48 b8 1a 24 80 00 00 	movabs $0x80241a,%rax
+  802a62:	00 00 00 
+  802a65:	ff d0                	call   *%rax
+        if (res <= 0)
+  802a67:	85 c0                	test   %eax,%eax
+  802a69:	0f 8e 63 01 00 00    	jle    802bd2 <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  802a6f:	4c 63 e0             	movslq %eax,%r12
+  802a72:	4c 89 e2             	mov    %r12,%rdx
+  802a75:	48 be 00 10 c3 00 00 	movabs $0xc31000,%rsi
+  802a7c:	00 00 00 
+  802a7f:	4c 89 ff             	mov    %r15,%rdi
+  802a82:	48 b8 04 0f 80 00 00 	movabs $0x800f04,%rax
+  802a89:	00 00 00 
+  802a8c:	ff d0                	call   *%rax
+        buf += res;
+  802a8e:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  802a91:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  802a94:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  802a98:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  802a9c:	48 85 db             	test   %rbx,%rbx
+  802a9f:	0f 84 25 ff ff ff    	je     8029ca <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  802aa5:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  802aa8:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  802aac:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802ab0:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802ab4:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  802abb:	0f 97 c2             	seta   %dl
+  802abe:	20 c2                	and    %al,%dl
+  802ac0:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  802ac3:	0f 84 5e ff ff ff    	je     802a27 <devfile_read_direct+0xa6>
+  802ac9:	4c 89 fa             	mov    %r15,%rdx
+  802acc:	4d 89 fd             	mov    %r15,%r13
+  802acf:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  802ad6:	0f 85 4e ff ff ff    	jne    802a2a <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  802adc:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802ae0:	0f 84 1a ff ff ff    	je     802a00 <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802ae6:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802aed:	0f 85 37 ff ff ff    	jne    802a2a <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  802af3:	48 89 d8             	mov    %rbx,%rax
+  802af6:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802afc:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802b01:	48 39 c8             	cmp    %rcx,%rax
+  802b04:	48 0f 47 c1          	cmova  %rcx,%rax
+  802b08:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  802b0c:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  802b10:	49 89 d4             	mov    %rdx,%r12
+  802b13:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  802b17:	48 b8 f2 3d 80 00 00 	movabs $0x803df2,%rax
+  802b1e:	00 00 00 
+  802b21:	ff d0                	call   *%rax
+  802b23:	a8 40                	test   $0x40,%al
+  802b25:	0f 85 b9 00 00 00    	jne    802be4 <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  802b2b:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  802b32:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802b36:	49 39 c5             	cmp    %rax,%r13
+  802b39:	72 d8                	jb     802b13 <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802b3b:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802b3f:	48 ba 00 00 c3 00 00 	movabs $0xc30000,%rdx
+  802b46:	00 00 00 
+  802b49:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802b4d:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  802b50:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  802b52:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  802b56:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  802b5a:	48 b8 67 1d 80 00 00 	movabs $0x801d67,%rax
+  802b61:	00 00 00 
+  802b64:	ff d0                	call   *%rax
+  802b66:	89 c7                	mov    %eax,%edi
+  802b68:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802b6e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802b73:	48 ba 00 00 c3 00 00 	movabs $0xc30000,%rdx
+  802b7a:	00 00 00 
+  802b7d:	be 0e 00 00 00       	mov    $0xe,%esi
+  802b82:	48 b8 ff 46 80 00 00 	movabs $0x8046ff,%rax
+  802b89:	00 00 00 
+  802b8c:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  802b8e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802b93:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802b97:	4c 89 fe             	mov    %r15,%rsi
+  802b9a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b9f:	48 b8 db 46 80 00 00 	movabs $0x8046db,%rax
+  802ba6:	00 00 00 
+  802ba9:	ff d0                	call   *%rax
+  802bab:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  802bae:	48 85 d2             	test   %rdx,%rdx
+  802bb1:	0f 84 5a fe ff ff    	je     802a11 <devfile_read_direct+0x90>
+            if (res > 0) {
+  802bb7:	0f 8e 5a fe ff ff    	jle    802a17 <devfile_read_direct+0x96>
+                buf += res;
+  802bbd:	48 98                	cltq
+  802bbf:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  802bc2:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  802bc5:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  802bc9:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  802bcd:	e9 ca fe ff ff       	jmp    802a9c <devfile_read_direct+0x11b>
+            return res ? res : read;
+  802bd2:	41 89 c5             	mov    %eax,%r13d
+  802bd5:	48 98                	cltq
+  802bd7:	45 85 ed             	test   %r13d,%r13d
+  802bda:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  802bdf:	e9 0d fe ff ff       	jmp    8029f1 <devfile_read_direct+0x70>
+            map = 0;
+  802be4:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802be8:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802bec:	e9 39 fe ff ff       	jmp    802a2a <devfile_read_direct+0xa9>
+  802bf1:	48 89 d0             	mov    %rdx,%rax
+  802bf4:	e9 f8 fd ff ff       	jmp    8029f1 <devfile_read_direct+0x70>
+
+0000000000802bf9 <devfile_read>:
+    if (!fd || !buf)
+  802bf9:	48 85 ff             	test   %rdi,%rdi
+  802bfc:	0f 84 21 02 00 00    	je     802e23 <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802c02:	55                   	push   %rbp
+  802c03:	48 89 e5             	mov    %rsp,%rbp
+  802c06:	41 57                	push   %r15
+  802c08:	41 56                	push   %r14
+  802c0a:	41 55                	push   %r13
+  802c0c:	41 54                	push   %r12
+  802c0e:	53                   	push   %rbx
+  802c0f:	48 83 ec 28          	sub    $0x28,%rsp
+  802c13:	48 89 fb             	mov    %rdi,%rbx
+  802c16:	49 89 f4             	mov    %rsi,%r12
+  802c19:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  802c1c:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802c21:	48 85 f6             	test   %rsi,%rsi
+  802c24:	74 4b                	je     802c71 <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  802c26:	48 b8 36 1f 80 00 00 	movabs $0x801f36,%rax
+  802c2d:	00 00 00 
+  802c30:	ff d0                	call   *%rax
+  802c32:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802c35:	48 85 c0             	test   %rax,%rax
+  802c38:	74 22                	je     802c5c <devfile_read+0x63>
+  802c3a:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  802c41:	77 19                	ja     802c5c <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802c43:	be 00 10 00 00       	mov    $0x1000,%esi
+  802c48:	48 89 df             	mov    %rbx,%rdi
+  802c4b:	48 b8 c7 11 80 00 00 	movabs $0x8011c7,%rax
+  802c52:	00 00 00 
+  802c55:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802c57:	83 f8 02             	cmp    $0x2,%eax
+  802c5a:	7e 40                	jle    802c9c <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  802c5c:	48 89 df             	mov    %rbx,%rdi
+  802c5f:	48 b8 83 26 80 00 00 	movabs $0x802683,%rax
+  802c66:	00 00 00 
+  802c69:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802c6b:	85 c0                	test   %eax,%eax
+  802c6d:	79 11                	jns    802c80 <devfile_read+0x87>
+  802c6f:	48 98                	cltq
+}
+  802c71:	48 83 c4 28          	add    $0x28,%rsp
+  802c75:	5b                   	pop    %rbx
+  802c76:	41 5c                	pop    %r12
+  802c78:	41 5d                	pop    %r13
+  802c7a:	41 5e                	pop    %r14
+  802c7c:	41 5f                	pop    %r15
+  802c7e:	5d                   	pop    %rbp
+  802c7f:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802c80:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802c85:	4c 89 ea             	mov    %r13,%rdx
+  802c88:	4c 89 e6             	mov    %r12,%rsi
+  802c8b:	48 89 df             	mov    %rbx,%rdi
+  802c8e:	48 b8 81 29 80 00 00 	movabs $0x802981,%rax
+  802c95:	00 00 00 
+  802c98:	ff d0                	call   *%rax
+  802c9a:	eb d5                	jmp    802c71 <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  802c9c:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802ca0:	48 89 df             	mov    %rbx,%rdi
+  802ca3:	48 b8 83 26 80 00 00 	movabs $0x802683,%rax
+  802caa:	00 00 00 
+  802cad:	ff d0                	call   *%rax
+  802caf:	85 c0                	test   %eax,%eax
+  802cb1:	0f 88 33 01 00 00    	js     802dea <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  802cb7:	48 ba 00 23 c2 00 00 	movabs $0xc22300,%rdx
+  802cbe:	00 00 00 
+  802cc1:	4c 89 f0             	mov    %r14,%rax
+  802cc4:	48 29 d0             	sub    %rdx,%rax
+  802cc7:	48 c1 f8 03          	sar    $0x3,%rax
+  802ccb:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  802cd2:	aa aa aa 
+  802cd5:	48 0f af c2          	imul   %rdx,%rax
+  802cd9:	48 c1 e0 0e          	shl    $0xe,%rax
+  802cdd:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  802ce1:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802ce4:	41 39 06             	cmp    %eax,(%r14)
+  802ce7:	75 0d                	jne    802cf6 <devfile_read+0xfd>
+  802ce9:	8b 43 10             	mov    0x10(%rbx),%eax
+  802cec:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  802cf0:	0f 84 fb 00 00 00    	je     802df1 <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  802cf6:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802cfb:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802cff:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  802d02:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802d06:	48 89 c7             	mov    %rax,%rdi
+  802d09:	48 b8 51 3e 80 00 00 	movabs $0x803e51,%rax
+  802d10:	00 00 00 
+  802d13:	ff d0                	call   *%rax
+  802d15:	84 c0                	test   %al,%al
+  802d17:	75 27                	jne    802d40 <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802d19:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802d1e:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802d23:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802d27:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d2c:	48 b8 02 12 80 00 00 	movabs $0x801202,%rax
+  802d33:	00 00 00 
+  802d36:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  802d38:	85 c0                	test   %eax,%eax
+  802d3a:	0f 88 dc 00 00 00    	js     802e1c <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  802d40:	44 89 f8             	mov    %r15d,%eax
+  802d43:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802d48:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  802d4a:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  802d51:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  802d52:	8b 43 10             	mov    0x10(%rbx),%eax
+  802d55:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  802d59:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  802d5c:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802d61:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802d65:	48 89 df             	mov    %rbx,%rdi
+  802d68:	48 b8 81 29 80 00 00 	movabs $0x802981,%rax
+  802d6f:	00 00 00 
+  802d72:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  802d74:	48 85 c0             	test   %rax,%rax
+  802d77:	0f 88 f4 fe ff ff    	js     802c71 <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  802d7d:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802d80:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  802d83:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  802d86:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  802d8a:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  802d8e:	48 63 d1             	movslq %ecx,%rdx
+  802d91:	48 01 d0             	add    %rdx,%rax
+  802d94:	4d 63 ff             	movslq %r15d,%r15
+  802d97:	4c 29 f8             	sub    %r15,%rax
+  802d9a:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d9f:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  802da3:	48 85 c0             	test   %rax,%rax
+  802da6:	0f 8e c5 fe ff ff    	jle    802c71 <devfile_read+0x78>
+    n = MIN(n, res);
+  802dac:	4c 39 e8             	cmp    %r13,%rax
+  802daf:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  802db3:	8b 73 04             	mov    0x4(%rbx),%esi
+  802db6:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  802dba:	48 63 f6             	movslq %esi,%rsi
+  802dbd:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802dc2:	48 01 c6             	add    %rax,%rsi
+  802dc5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802dc9:	48 01 c6             	add    %rax,%rsi
+  802dcc:	4c 89 ea             	mov    %r13,%rdx
+  802dcf:	4c 89 e7             	mov    %r12,%rdi
+  802dd2:	48 b8 04 0f 80 00 00 	movabs $0x800f04,%rax
+  802dd9:	00 00 00 
+  802ddc:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  802dde:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  802de2:	4c 89 e8             	mov    %r13,%rax
+  802de5:	e9 87 fe ff ff       	jmp    802c71 <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802dea:	48 98                	cltq
+  802dec:	e9 80 fe ff ff       	jmp    802c71 <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  802df1:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  802df5:	41 39 d7             	cmp    %edx,%r15d
+  802df8:	0f 8c f8 fe ff ff    	jl     802cf6 <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  802dfe:	49 8b 46 10          	mov    0x10(%r14),%rax
+  802e02:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  802e05:	41 39 cf             	cmp    %ecx,%r15d
+  802e08:	0f 8d e8 fe ff ff    	jge    802cf6 <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  802e0e:	4d 63 ff             	movslq %r15d,%r15
+  802e11:	4c 29 f8             	sub    %r15,%rax
+  802e14:	48 63 d2             	movslq %edx,%rdx
+  802e17:	48 01 d0             	add    %rdx,%rax
+  802e1a:	eb 87                	jmp    802da3 <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802e1c:	48 98                	cltq
+  802e1e:	e9 4e fe ff ff       	jmp    802c71 <devfile_read+0x78>
+        return E_INVAL;
+  802e23:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802e28:	c3                   	ret
+
+0000000000802e29 <fs_channel>:
+fs_channel(bool enable) {
+  802e29:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  802e2b:	a2 04 26 c2 00 00 00 	movabs %al,0xc22604
+  802e32:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  802e34:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e39:	40 84 ff             	test   %dil,%dil
+  802e3c:	74 47                	je     802e85 <fs_channel+0x5c>
+  802e3e:	48 a1 00 00 c1 00 00 	movabs 0xc10000,%rax
+  802e45:	00 00 00 
+  802e48:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  802e4e:	48 b8 00 26 c2 00 00 	movabs $0xc22600,%rax
+  802e55:	00 00 00 
+  802e58:	3b 08                	cmp    (%rax),%ecx
+  802e5a:	74 29                	je     802e85 <fs_channel+0x5c>
+fs_channel(bool enable) {
+  802e5c:	55                   	push   %rbp
+  802e5d:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  802e60:	48 b8 a9 1d 80 00 00 	movabs $0x801da9,%rax
+  802e67:	00 00 00 
+  802e6a:	ff d0                	call   *%rax
+  802e6c:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  802e6e:	85 c0                	test   %eax,%eax
+  802e70:	78 04                	js     802e76 <fs_channel+0x4d>
+}
+  802e72:	89 d0                	mov    %edx,%eax
+  802e74:	5d                   	pop    %rbp
+  802e75:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  802e76:	48 b8 04 26 c2 00 00 	movabs $0xc22604,%rax
+  802e7d:	00 00 00 
+  802e80:	c6 00 00             	movb   $0x0,(%rax)
+  802e83:	eb ed                	jmp    802e72 <fs_channel+0x49>
+}
+  802e85:	89 d0                	mov    %edx,%eax
+  802e87:	c3                   	ret
+
+0000000000802e88 <open>:
+open(const char *path, int mode) {
+  802e88:	55                   	push   %rbp
+  802e89:	48 89 e5             	mov    %rsp,%rbp
+  802e8c:	41 55                	push   %r13
+  802e8e:	41 54                	push   %r12
+  802e90:	53                   	push   %rbx
+  802e91:	48 83 ec 18          	sub    $0x18,%rsp
+  802e95:	49 89 fc             	mov    %rdi,%r12
+  802e98:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802e9b:	48 b8 65 0c 80 00 00 	movabs $0x800c65,%rax
+  802ea2:	00 00 00 
+  802ea5:	ff d0                	call   *%rax
+  802ea7:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802ead:	0f 87 8f 00 00 00    	ja     802f42 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802eb3:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802eb7:	48 b8 63 16 80 00 00 	movabs $0x801663,%rax
+  802ebe:	00 00 00 
+  802ec1:	ff d0                	call   *%rax
+  802ec3:	89 c3                	mov    %eax,%ebx
+  802ec5:	85 c0                	test   %eax,%eax
+  802ec7:	78 55                	js     802f1e <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  802ec9:	4c 89 e6             	mov    %r12,%rsi
+  802ecc:	48 bb 00 00 c3 00 00 	movabs $0xc30000,%rbx
+  802ed3:	00 00 00 
+  802ed6:	48 89 df             	mov    %rbx,%rdi
+  802ed9:	48 b8 a3 0c 80 00 00 	movabs $0x800ca3,%rax
+  802ee0:	00 00 00 
+  802ee3:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802ee5:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  802eec:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ef1:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802ef5:	bf 01 00 00 00       	mov    $0x1,%edi
+  802efa:	48 b8 1a 24 80 00 00 	movabs $0x80241a,%rax
+  802f01:	00 00 00 
+  802f04:	ff d0                	call   *%rax
+  802f06:	89 c3                	mov    %eax,%ebx
+  802f08:	85 c0                	test   %eax,%eax
+  802f0a:	78 1f                	js     802f2b <open+0xa3>
+    return fd2num(fd);
+  802f0c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802f10:	48 b8 35 16 80 00 00 	movabs $0x801635,%rax
+  802f17:	00 00 00 
+  802f1a:	ff d0                	call   *%rax
+  802f1c:	89 c3                	mov    %eax,%ebx
+}
+  802f1e:	89 d8                	mov    %ebx,%eax
+  802f20:	48 83 c4 18          	add    $0x18,%rsp
+  802f24:	5b                   	pop    %rbx
+  802f25:	41 5c                	pop    %r12
+  802f27:	41 5d                	pop    %r13
+  802f29:	5d                   	pop    %rbp
+  802f2a:	c3                   	ret
+        fd_close(fd, 0);
+  802f2b:	be 00 00 00 00       	mov    $0x0,%esi
+  802f30:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802f34:	48 b8 7e 17 80 00 00 	movabs $0x80177e,%rax
+  802f3b:	00 00 00 
+  802f3e:	ff d0                	call   *%rax
+        return res;
+  802f40:	eb dc                	jmp    802f1e <open+0x96>
+        return -E_BAD_PATH;
+  802f42:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802f47:	eb d5                	jmp    802f1e <open+0x96>
+
+0000000000802f49 <file_flush_buffers>:
+file_flush_buffers(void) {
+  802f49:	55                   	push   %rbp
+  802f4a:	48 89 e5             	mov    %rsp,%rbp
+  802f4d:	41 56                	push   %r14
+  802f4f:	41 55                	push   %r13
+  802f51:	41 54                	push   %r12
+  802f53:	53                   	push   %rbx
+  802f54:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  802f58:	49 bc 08 23 c2 00 00 	movabs $0xc22308,%r12
+  802f5f:	00 00 00 
+  802f62:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  802f67:	49 bd c3 16 80 00 00 	movabs $0x8016c3,%r13
+  802f6e:	00 00 00 
+  802f71:	49 be 83 26 80 00 00 	movabs $0x802683,%r14
+  802f78:	00 00 00 
+  802f7b:	eb 0c                	jmp    802f89 <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  802f7d:	83 c3 01             	add    $0x1,%ebx
+  802f80:	49 83 c4 18          	add    $0x18,%r12
+  802f84:	83 fb 20             	cmp    $0x20,%ebx
+  802f87:	74 1d                	je     802fa6 <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  802f89:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  802f8e:	74 ed                	je     802f7d <file_flush_buffers+0x34>
+  802f90:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802f94:	89 df                	mov    %ebx,%edi
+  802f96:	41 ff d5             	call   *%r13
+  802f99:	85 c0                	test   %eax,%eax
+  802f9b:	78 e0                	js     802f7d <file_flush_buffers+0x34>
+  802f9d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802fa1:	41 ff d6             	call   *%r14
+  802fa4:	eb d7                	jmp    802f7d <file_flush_buffers+0x34>
+}
+  802fa6:	48 83 c4 10          	add    $0x10,%rsp
+  802faa:	5b                   	pop    %rbx
+  802fab:	41 5c                	pop    %r12
+  802fad:	41 5d                	pop    %r13
+  802faf:	41 5e                	pop    %r14
+  802fb1:	5d                   	pop    %rbp
+  802fb2:	c3                   	ret
+
+0000000000802fb3 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802fb3:	55                   	push   %rbp
+  802fb4:	48 89 e5             	mov    %rsp,%rbp
+  802fb7:	41 54                	push   %r12
+  802fb9:	53                   	push   %rbx
+  802fba:	49 89 fc             	mov    %rdi,%r12
+  802fbd:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  802fbf:	48 b8 49 2f 80 00 00 	movabs $0x802f49,%rax
+  802fc6:	00 00 00 
+  802fc9:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802fcb:	48 b8 00 00 c3 00 00 	movabs $0xc30000,%rax
+  802fd2:	00 00 00 
+  802fd5:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  802fda:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802fdc:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  802fdf:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fe4:	be 00 00 00 00       	mov    $0x0,%esi
+  802fe9:	bf 02 00 00 00       	mov    $0x2,%edi
+  802fee:	48 b8 1a 24 80 00 00 	movabs $0x80241a,%rax
+  802ff5:	00 00 00 
+  802ff8:	ff d0                	call   *%rax
+}
+  802ffa:	5b                   	pop    %rbx
+  802ffb:	41 5c                	pop    %r12
+  802ffd:	5d                   	pop    %rbp
+  802ffe:	c3                   	ret
+
+0000000000802fff <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802fff:	55                   	push   %rbp
+  803000:	48 89 e5             	mov    %rsp,%rbp
+  803003:	41 54                	push   %r12
+  803005:	53                   	push   %rbx
+  803006:	49 89 fc             	mov    %rdi,%r12
+  803009:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  80300c:	48 b8 49 2f 80 00 00 	movabs $0x802f49,%rax
+  803013:	00 00 00 
+  803016:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803018:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  80301d:	a3 00 00 c3 00 00 00 	movabs %eax,0xc30000
+  803024:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  803026:	ba 00 00 00 00       	mov    $0x0,%edx
+  80302b:	be 00 00 00 00       	mov    $0x0,%esi
+  803030:	bf 05 00 00 00       	mov    $0x5,%edi
+  803035:	48 b8 1a 24 80 00 00 	movabs $0x80241a,%rax
+  80303c:	00 00 00 
+  80303f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803041:	85 c0                	test   %eax,%eax
+  803043:	78 3d                	js     803082 <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803045:	49 bc 00 00 c3 00 00 	movabs $0xc30000,%r12
+  80304c:	00 00 00 
+  80304f:	4c 89 e6             	mov    %r12,%rsi
+  803052:	48 89 df             	mov    %rbx,%rdi
+  803055:	48 b8 a3 0c 80 00 00 	movabs $0x800ca3,%rax
+  80305c:	00 00 00 
+  80305f:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  803061:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  803068:	00 
+  803069:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80306f:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  803076:	00 
+  803077:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  80307d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803082:	5b                   	pop    %rbx
+  803083:	41 5c                	pop    %r12
+  803085:	5d                   	pop    %rbp
+  803086:	c3                   	ret
+
+0000000000803087 <remove>:
+remove(const char *path) {
+  803087:	55                   	push   %rbp
+  803088:	48 89 e5             	mov    %rsp,%rbp
+  80308b:	53                   	push   %rbx
+  80308c:	48 83 ec 08          	sub    $0x8,%rsp
+  803090:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  803093:	48 b8 65 0c 80 00 00 	movabs $0x800c65,%rax
+  80309a:	00 00 00 
+  80309d:	ff d0                	call   *%rax
+  80309f:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8030a5:	77 3a                	ja     8030e1 <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  8030a7:	48 89 de             	mov    %rbx,%rsi
+  8030aa:	48 bf 00 00 c3 00 00 	movabs $0xc30000,%rdi
+  8030b1:	00 00 00 
+  8030b4:	48 b8 a3 0c 80 00 00 	movabs $0x800ca3,%rax
+  8030bb:	00 00 00 
+  8030be:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  8030c0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030c5:	be 00 00 00 00       	mov    $0x0,%esi
+  8030ca:	bf 07 00 00 00       	mov    $0x7,%edi
+  8030cf:	48 b8 1a 24 80 00 00 	movabs $0x80241a,%rax
+  8030d6:	00 00 00 
+  8030d9:	ff d0                	call   *%rax
+}
+  8030db:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8030df:	c9                   	leave
+  8030e0:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  8030e1:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8030e6:	eb f3                	jmp    8030db <remove+0x54>
+
+00000000008030e8 <sync>:
+sync(void) {
+  8030e8:	55                   	push   %rbp
+  8030e9:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  8030ec:	48 b8 49 2f 80 00 00 	movabs $0x802f49,%rax
+  8030f3:	00 00 00 
+  8030f6:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  8030f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030fd:	be 00 00 00 00       	mov    $0x0,%esi
+  803102:	bf 08 00 00 00       	mov    $0x8,%edi
+  803107:	48 b8 1a 24 80 00 00 	movabs $0x80241a,%rax
+  80310e:	00 00 00 
+  803111:	ff d0                	call   *%rax
+}
+  803113:	5d                   	pop    %rbp
+  803114:	c3                   	ret
+
+0000000000803115 <fsync>:
+fsync(int fdnum) {
+  803115:	55                   	push   %rbp
+  803116:	48 89 e5             	mov    %rsp,%rbp
+  803119:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80311d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803121:	48 b8 c3 16 80 00 00 	movabs $0x8016c3,%rax
+  803128:	00 00 00 
+  80312b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80312d:	85 c0                	test   %eax,%eax
+  80312f:	78 4b                	js     80317c <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803131:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803135:	48 b8 20 50 80 00 00 	movabs $0x805020,%rax
+  80313c:	00 00 00 
+  80313f:	8b 00                	mov    (%rax),%eax
+  803141:	39 02                	cmp    %eax,(%rdx)
+  803143:	75 39                	jne    80317e <fsync+0x69>
+    file_flush_buffers();
+  803145:	48 b8 49 2f 80 00 00 	movabs $0x802f49,%rax
+  80314c:	00 00 00 
+  80314f:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  803151:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803155:	8b 40 0c             	mov    0xc(%rax),%eax
+  803158:	a3 00 00 c3 00 00 00 	movabs %eax,0xc30000
+  80315f:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  803161:	ba 00 00 00 00       	mov    $0x0,%edx
+  803166:	be 00 00 00 00       	mov    $0x0,%esi
+  80316b:	bf 0d 00 00 00       	mov    $0xd,%edi
+  803170:	48 b8 1a 24 80 00 00 	movabs $0x80241a,%rax
+  803177:	00 00 00 
+  80317a:	ff d0                	call   *%rax
+}
+  80317c:	c9                   	leave
+  80317d:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80317e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803183:	eb f7                	jmp    80317c <fsync+0x67>
+
+0000000000803185 <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  803185:	55                   	push   %rbp
+  803186:	48 89 e5             	mov    %rsp,%rbp
+  803189:	53                   	push   %rbx
+  80318a:	48 83 ec 08          	sub    $0x8,%rsp
+  80318e:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  803191:	ba 00 00 00 00       	mov    $0x0,%edx
+  803196:	be 00 00 00 00       	mov    $0x0,%esi
+  80319b:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8031a0:	48 b8 1a 24 80 00 00 	movabs $0x80241a,%rax
+  8031a7:	00 00 00 
+  8031aa:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8031ac:	85 c0                	test   %eax,%eax
+  8031ae:	78 2d                	js     8031dd <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  8031b0:	48 b8 00 00 c3 00 00 	movabs $0xc30000,%rax
+  8031b7:	00 00 00 
+  8031ba:	48 8b 10             	mov    (%rax),%rdx
+  8031bd:	48 89 13             	mov    %rdx,(%rbx)
+  8031c0:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8031c4:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  8031c8:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8031cc:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  8031d0:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8031d4:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  8031d8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8031dd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8031e1:	c9                   	leave
+  8031e2:	c3                   	ret
+
+00000000008031e3 <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  8031e3:	55                   	push   %rbp
+  8031e4:	48 89 e5             	mov    %rsp,%rbp
+  8031e7:	53                   	push   %rbx
+  8031e8:	48 83 ec 08          	sub    $0x8,%rsp
+  8031ec:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  8031ef:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031f4:	be 00 00 00 00       	mov    $0x0,%esi
+  8031f9:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8031fe:	48 b8 1a 24 80 00 00 	movabs $0x80241a,%rax
+  803205:	00 00 00 
+  803208:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80320a:	85 c0                	test   %eax,%eax
+  80320c:	78 3d                	js     80324b <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  80320e:	48 b8 00 00 c3 00 00 	movabs $0xc30000,%rax
+  803215:	00 00 00 
+  803218:	48 8b 10             	mov    (%rax),%rdx
+  80321b:	48 89 13             	mov    %rdx,(%rbx)
+  80321e:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  803222:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  803226:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80322a:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  80322e:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  803232:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  803236:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  80323a:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  80323e:	48 8b 40 28          	mov    0x28(%rax),%rax
+  803242:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  803246:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80324b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80324f:	c9                   	leave
+  803250:	c3                   	ret
+
+0000000000803251 <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  803251:	55                   	push   %rbp
+  803252:	48 89 e5             	mov    %rsp,%rbp
+  803255:	41 57                	push   %r15
+  803257:	41 56                	push   %r14
+  803259:	41 55                	push   %r13
+  80325b:	41 54                	push   %r12
+  80325d:	53                   	push   %rbx
+  80325e:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  803262:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  803269:	00 
+  80326a:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  803271:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  803277:	0f 85 43 01 00 00    	jne    8033c0 <munmap+0x16f>
+  80327d:	49 89 ff             	mov    %rdi,%r15
+  803280:	4c 39 f7             	cmp    %r14,%rdi
+  803283:	0f 87 37 01 00 00    	ja     8033c0 <munmap+0x16f>
+  803289:	48 bb 00 20 c2 00 00 	movabs $0xc22000,%rbx
+  803290:	00 00 00 
+  803293:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  803299:	eb 2c                	jmp    8032c7 <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  80329b:	4c 39 f8             	cmp    %r15,%rax
+  80329e:	0f 83 85 00 00 00    	jae    803329 <munmap+0xd8>
+            m->mm_end = start;
+  8032a4:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8032a9:	48 83 c3 18          	add    $0x18,%rbx
+  8032ad:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  8032b4:	48 b8 00 23 c2 00 00 	movabs $0xc22300,%rax
+  8032bb:	00 00 00 
+  8032be:	48 39 c3             	cmp    %rax,%rbx
+  8032c1:	0f 84 d0 00 00 00    	je     803397 <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  8032c7:	49 89 dc             	mov    %rbx,%r12
+  8032ca:	48 8b 03             	mov    (%rbx),%rax
+  8032cd:	4c 39 f0             	cmp    %r14,%rax
+  8032d0:	73 d7                	jae    8032a9 <munmap+0x58>
+  8032d2:	48 85 c0             	test   %rax,%rax
+  8032d5:	74 d2                	je     8032a9 <munmap+0x58>
+  8032d7:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8032db:	49 39 d7             	cmp    %rdx,%r15
+  8032de:	73 c9                	jae    8032a9 <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  8032e0:	49 39 d6             	cmp    %rdx,%r14
+  8032e3:	73 b6                	jae    80329b <munmap+0x4a>
+  8032e5:	49 39 c7             	cmp    %rax,%r15
+  8032e8:	76 b1                	jbe    80329b <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  8032ea:	4c 89 ef             	mov    %r13,%rdi
+  8032ed:	48 b8 88 23 80 00 00 	movabs $0x802388,%rax
+  8032f4:	00 00 00 
+  8032f7:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  8032f9:	48 85 c0             	test   %rax,%rax
+  8032fc:	0f 84 c5 00 00 00    	je     8033c7 <munmap+0x176>
+            *tail = *m;
+  803302:	48 8b 13             	mov    (%rbx),%rdx
+  803305:	48 89 10             	mov    %rdx,(%rax)
+  803308:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  80330c:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  803310:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  803314:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  803318:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  80331b:	44 89 f2             	mov    %r14d,%edx
+  80331e:	2b 13                	sub    (%rbx),%edx
+  803320:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  803323:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  803327:	eb 80                	jmp    8032a9 <munmap+0x58>
+        } else if (m->mm_end > end) {
+  803329:	49 39 d6             	cmp    %rdx,%r14
+  80332c:	73 18                	jae    803346 <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  80332e:	44 89 f2             	mov    %r14d,%edx
+  803331:	41 03 54 24 10       	add    0x10(%r12),%edx
+  803336:	29 c2                	sub    %eax,%edx
+  803338:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  80333d:	4d 89 34 24          	mov    %r14,(%r12)
+  803341:	e9 63 ff ff ff       	jmp    8032a9 <munmap+0x58>
+    m->mm_start = 0;
+  803346:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  80334d:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  80334e:	4c 89 e6             	mov    %r12,%rsi
+  803351:	48 b8 00 20 c2 00 00 	movabs $0xc22000,%rax
+  803358:	00 00 00 
+  80335b:	48 29 c6             	sub    %rax,%rsi
+  80335e:	48 c1 fe 03          	sar    $0x3,%rsi
+  803362:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  803369:	aa aa aa 
+  80336c:	48 0f af f0          	imul   %rax,%rsi
+  803370:	48 c1 e6 0c          	shl    $0xc,%rsi
+  803374:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  803379:	48 01 c6             	add    %rax,%rsi
+  80337c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803381:	bf 00 00 00 00       	mov    $0x0,%edi
+  803386:	48 b8 a8 12 80 00 00 	movabs $0x8012a8,%rax
+  80338d:	00 00 00 
+  803390:	ff d0                	call   *%rax
+}
+  803392:	e9 12 ff ff ff       	jmp    8032a9 <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  803397:	4c 89 f2             	mov    %r14,%rdx
+  80339a:	4c 29 fa             	sub    %r15,%rdx
+  80339d:	4c 89 fe             	mov    %r15,%rsi
+  8033a0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033a5:	48 b8 a8 12 80 00 00 	movabs $0x8012a8,%rax
+  8033ac:	00 00 00 
+  8033af:	ff d0                	call   *%rax
+}
+  8033b1:	48 83 c4 08          	add    $0x8,%rsp
+  8033b5:	5b                   	pop    %rbx
+  8033b6:	41 5c                	pop    %r12
+  8033b8:	41 5d                	pop    %r13
+  8033ba:	41 5e                	pop    %r14
+  8033bc:	41 5f                	pop    %r15
+  8033be:	5d                   	pop    %rbp
+  8033bf:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  8033c0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8033c5:	eb ea                	jmp    8033b1 <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  8033c7:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  8033cc:	eb e3                	jmp    8033b1 <munmap+0x160>
+
+00000000008033ce <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  8033ce:	55                   	push   %rbp
+  8033cf:	48 89 e5             	mov    %rsp,%rbp
+  8033d2:	41 57                	push   %r15
+  8033d4:	41 56                	push   %r14
+  8033d6:	41 55                	push   %r13
+  8033d8:	41 54                	push   %r12
+  8033da:	53                   	push   %rbx
+  8033db:	48 83 ec 28          	sub    $0x28,%rsp
+  8033df:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8033e3:	49 89 f5             	mov    %rsi,%r13
+  8033e6:	41 89 d6             	mov    %edx,%r14d
+  8033e9:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  8033ec:	41 89 cc             	mov    %ecx,%r12d
+  8033ef:	44 89 c7             	mov    %r8d,%edi
+  8033f2:	44 89 cb             	mov    %r9d,%ebx
+  8033f5:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8033f9:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8033fd:	48 b8 c3 16 80 00 00 	movabs $0x8016c3,%rax
+  803404:	00 00 00 
+  803407:	ff d0                	call   *%rax
+  803409:	41 89 c7             	mov    %eax,%r15d
+  80340c:	85 c0                	test   %eax,%eax
+  80340e:	0f 88 ae 01 00 00    	js     8035c2 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803414:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803418:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  80341f:	00 00 00 
+  803422:	8b 32                	mov    (%rdx),%esi
+  803424:	39 30                	cmp    %esi,(%rax)
+  803426:	0f 85 7a 02 00 00    	jne    8036a6 <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  80342c:	8b 40 08             	mov    0x8(%rax),%eax
+  80342f:	83 e0 03             	and    $0x3,%eax
+  803432:	83 f8 01             	cmp    $0x1,%eax
+  803435:	0f 84 76 02 00 00    	je     8036b1 <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  80343b:	4d 85 ed             	test   %r13,%r13
+  80343e:	0f 84 78 02 00 00    	je     8036bc <mmap+0x2ee>
+  803444:	85 db                	test   %ebx,%ebx
+  803446:	0f 88 70 02 00 00    	js     8036bc <mmap+0x2ee>
+  80344c:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  803452:	41 89 df             	mov    %ebx,%r15d
+  803455:	0f 85 6c 02 00 00    	jne    8036c7 <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  80345b:	44 89 f0             	mov    %r14d,%eax
+  80345e:	83 e0 fd             	and    $0xfffffffd,%eax
+  803461:	83 f8 04             	cmp    $0x4,%eax
+  803464:	0f 85 68 02 00 00    	jne    8036d2 <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  80346a:	44 89 e1             	mov    %r12d,%ecx
+  80346d:	83 e1 01             	and    $0x1,%ecx
+  803470:	0f 95 c2             	setne  %dl
+  803473:	44 89 e0             	mov    %r12d,%eax
+  803476:	d1 e8                	shr    %eax
+  803478:	83 f0 01             	xor    $0x1,%eax
+  80347b:	83 e0 01             	and    $0x1,%eax
+  80347e:	38 c2                	cmp    %al,%dl
+  803480:	0f 85 57 02 00 00    	jne    8036dd <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  803486:	85 c9                	test   %ecx,%ecx
+  803488:	74 0a                	je     803494 <mmap+0xc6>
+  80348a:	41 f6 c6 02          	test   $0x2,%r14b
+  80348e:	0f 85 54 02 00 00    	jne    8036e8 <mmap+0x31a>
+    file_flush_buffers();
+  803494:	48 b8 49 2f 80 00 00 	movabs $0x802f49,%rax
+  80349b:	00 00 00 
+  80349e:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  8034a0:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  8034a7:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  8034ae:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8034b2:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  8034b5:	41 f6 c4 04          	test   $0x4,%r12b
+  8034b9:	0f 84 15 01 00 00    	je     8035d4 <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  8034bf:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  8034c2:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8034c8:	0f 85 25 02 00 00    	jne    8036f3 <mmap+0x325>
+  8034ce:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  8034d2:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  8034d9:	00 00 00 
+  8034dc:	48 39 c2             	cmp    %rax,%rdx
+  8034df:	0f 82 19 02 00 00    	jb     8036fe <mmap+0x330>
+  8034e5:	48 39 c7             	cmp    %rax,%rdi
+  8034e8:	0f 87 10 02 00 00    	ja     8036fe <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  8034ee:	4c 89 ee             	mov    %r13,%rsi
+  8034f1:	48 b8 51 32 80 00 00 	movabs $0x803251,%rax
+  8034f8:	00 00 00 
+  8034fb:	ff d0                	call   *%rax
+  8034fd:	85 c0                	test   %eax,%eax
+  8034ff:	0f 88 04 02 00 00    	js     803709 <mmap+0x33b>
+    if (!handler) {
+  803505:	48 b8 00 00 c2 00 00 	movabs $0xc20000,%rax
+  80350c:	00 00 00 
+  80350f:	80 38 00             	cmpb   $0x0,(%rax)
+  803512:	75 2b                	jne    80353f <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  803514:	48 bf e9 22 80 00 00 	movabs $0x8022e9,%rdi
+  80351b:	00 00 00 
+  80351e:	48 b8 aa 43 80 00 00 	movabs $0x8043aa,%rax
+  803525:	00 00 00 
+  803528:	ff d0                	call   *%rax
+  80352a:	85 c0                	test   %eax,%eax
+  80352c:	0f 88 ea 01 00 00    	js     80371c <mmap+0x34e>
+        handler = 1;
+  803532:	48 b8 00 00 c2 00 00 	movabs $0xc20000,%rax
+  803539:	00 00 00 
+  80353c:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  80353f:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803543:	48 b8 88 23 80 00 00 	movabs $0x802388,%rax
+  80354a:	00 00 00 
+  80354d:	ff d0                	call   *%rax
+  80354f:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  803552:	48 85 c0             	test   %rax,%rax
+  803555:	0f 84 c9 01 00 00    	je     803724 <mmap+0x356>
+    m->mm_start = va;
+  80355b:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  80355e:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  803562:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  803566:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  803569:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  80356d:	44 89 e0             	mov    %r12d,%eax
+  803570:	c1 e0 06             	shl    $0x6,%eax
+  803573:	25 80 00 00 00       	and    $0x80,%eax
+  803578:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  80357b:	09 f0                	or     %esi,%eax
+  80357d:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  803581:	41 f6 c4 08          	test   $0x8,%r12b
+  803585:	74 31                	je     8035b8 <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  803587:	48 39 d3             	cmp    %rdx,%rbx
+  80358a:	73 2c                	jae    8035b8 <mmap+0x1ea>
+  80358c:	ba 00 00 04 00       	mov    $0x40000,%edx
+  803591:	48 89 de             	mov    %rbx,%rsi
+  803594:	4c 89 f7             	mov    %r14,%rdi
+  803597:	48 b8 d8 21 80 00 00 	movabs $0x8021d8,%rax
+  80359e:	00 00 00 
+  8035a1:	ff d0                	call   *%rax
+  8035a3:	49 89 c4             	mov    %rax,%r12
+  8035a6:	48 85 c0             	test   %rax,%rax
+  8035a9:	0f 8e d7 00 00 00    	jle    803686 <mmap+0x2b8>
+            va += n;
+  8035af:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  8035b2:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  8035b6:	72 d4                	jb     80358c <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  8035b8:	49 8b 06             	mov    (%r14),%rax
+  8035bb:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  8035bf:	48 89 06             	mov    %rax,(%rsi)
+}
+  8035c2:	44 89 f8             	mov    %r15d,%eax
+  8035c5:	48 83 c4 28          	add    $0x28,%rsp
+  8035c9:	5b                   	pop    %rbx
+  8035ca:	41 5c                	pop    %r12
+  8035cc:	41 5d                	pop    %r13
+  8035ce:	41 5e                	pop    %r14
+  8035d0:	41 5f                	pop    %r15
+  8035d2:	5d                   	pop    %rbp
+  8035d3:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8035d4:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  8035db:	00 00 00 
+  8035de:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  8035e1:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  8035e8:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8035eb:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  8035f0:	48 be 00 20 c2 00 00 	movabs $0xc22000,%rsi
+  8035f7:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8035fa:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  803601:	00 00 00 
+  803604:	48 39 d7             	cmp    %rdx,%rdi
+  803607:	73 1c                	jae    803625 <mmap+0x257>
+        return -E_NO_MEM;
+  803609:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80360f:	eb b1                	jmp    8035c2 <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803611:	48 83 c0 01          	add    $0x1,%rax
+  803615:	48 83 f8 1f          	cmp    $0x1f,%rax
+  803619:	77 3f                	ja     80365a <mmap+0x28c>
+  80361b:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  803620:	48 39 d7             	cmp    %rdx,%rdi
+  803623:	72 2a                	jb     80364f <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  803625:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  803629:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  80362d:	48 39 d1             	cmp    %rdx,%rcx
+  803630:	73 df                	jae    803611 <mmap+0x243>
+  803632:	48 85 c9             	test   %rcx,%rcx
+  803635:	74 da                	je     803611 <mmap+0x243>
+  803637:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  80363b:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  803640:	48 39 d3             	cmp    %rdx,%rbx
+  803643:	73 cc                	jae    803611 <mmap+0x243>
+            va = mmaps[i].mm_end;
+  803645:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803648:	b8 00 00 00 00       	mov    $0x0,%eax
+  80364d:	eb cc                	jmp    80361b <mmap+0x24d>
+        return -E_NO_MEM;
+  80364f:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803655:	e9 68 ff ff ff       	jmp    8035c2 <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  80365a:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  80365f:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  803666:	00 00 00 
+  803669:	48 39 c2             	cmp    %rax,%rdx
+  80366c:	0f 82 9f 00 00 00    	jb     803711 <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  803672:	48 85 db             	test   %rbx,%rbx
+  803675:	0f 85 8a fe ff ff    	jne    803505 <mmap+0x137>
+        return -E_NO_MEM;
+  80367b:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803681:	e9 3c ff ff ff       	jmp    8035c2 <mmap+0x1f4>
+        if (n < 0) {
+  803686:	0f 89 2c ff ff ff    	jns    8035b8 <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  80368c:	49 8b 3e             	mov    (%r14),%rdi
+  80368f:	4c 89 ee             	mov    %r13,%rsi
+  803692:	48 b8 51 32 80 00 00 	movabs $0x803251,%rax
+  803699:	00 00 00 
+  80369c:	ff d0                	call   *%rax
+            return n;
+  80369e:	45 89 e7             	mov    %r12d,%r15d
+  8036a1:	e9 1c ff ff ff       	jmp    8035c2 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8036a6:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8036ac:	e9 11 ff ff ff       	jmp    8035c2 <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  8036b1:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8036b7:	e9 06 ff ff ff       	jmp    8035c2 <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  8036bc:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8036c2:	e9 fb fe ff ff       	jmp    8035c2 <mmap+0x1f4>
+  8036c7:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8036cd:	e9 f0 fe ff ff       	jmp    8035c2 <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  8036d2:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8036d8:	e9 e5 fe ff ff       	jmp    8035c2 <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  8036dd:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8036e3:	e9 da fe ff ff       	jmp    8035c2 <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  8036e8:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  8036ee:	e9 cf fe ff ff       	jmp    8035c2 <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  8036f3:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8036f9:	e9 c4 fe ff ff       	jmp    8035c2 <mmap+0x1f4>
+  8036fe:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803704:	e9 b9 fe ff ff       	jmp    8035c2 <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  803709:	41 89 c7             	mov    %eax,%r15d
+  80370c:	e9 b1 fe ff ff       	jmp    8035c2 <mmap+0x1f4>
+        return -E_NO_MEM;
+  803711:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803717:	e9 a6 fe ff ff       	jmp    8035c2 <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  80371c:	41 89 c7             	mov    %eax,%r15d
+  80371f:	e9 9e fe ff ff       	jmp    8035c2 <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  803724:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80372a:	e9 93 fe ff ff       	jmp    8035c2 <mmap+0x1f4>
+
+000000000080372f <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80372f:	55                   	push   %rbp
+  803730:	48 89 e5             	mov    %rsp,%rbp
+  803733:	41 54                	push   %r12
+  803735:	53                   	push   %rbx
+  803736:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803739:	48 b8 47 16 80 00 00 	movabs $0x801647,%rax
+  803740:	00 00 00 
+  803743:	ff d0                	call   *%rax
+  803745:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803748:	48 be e0 4e 80 00 00 	movabs $0x804ee0,%rsi
+  80374f:	00 00 00 
+  803752:	48 89 df             	mov    %rbx,%rdi
+  803755:	48 b8 a3 0c 80 00 00 	movabs $0x800ca3,%rax
+  80375c:	00 00 00 
+  80375f:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803761:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803766:	41 2b 04 24          	sub    (%r12),%eax
+  80376a:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803770:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803777:	00 00 00 
+    stat->st_dev = &devpipe;
+  80377a:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  803781:	00 00 00 
+  803784:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80378b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803790:	5b                   	pop    %rbx
+  803791:	41 5c                	pop    %r12
+  803793:	5d                   	pop    %rbp
+  803794:	c3                   	ret
+
+0000000000803795 <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  803795:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803798:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  80379e:	8b 17                	mov    (%rdi),%edx
+  8037a0:	85 d2                	test   %edx,%edx
+  8037a2:	75 01                	jne    8037a5 <pipe_wakeup+0x10>
+  8037a4:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  8037a5:	55                   	push   %rbp
+  8037a6:	48 89 e5             	mov    %rsp,%rbp
+  8037a9:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  8037ac:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  8037b2:	be 00 04 00 00       	mov    $0x400,%esi
+  8037b7:	48 b8 8e 15 80 00 00 	movabs $0x80158e,%rax
+  8037be:	00 00 00 
+  8037c1:	ff d0                	call   *%rax
+}
+  8037c3:	5d                   	pop    %rbp
+  8037c4:	c3                   	ret
+
+00000000008037c5 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8037c5:	55                   	push   %rbp
+  8037c6:	48 89 e5             	mov    %rsp,%rbp
+  8037c9:	41 55                	push   %r13
+  8037cb:	41 54                	push   %r12
+  8037cd:	53                   	push   %rbx
+  8037ce:	48 83 ec 08          	sub    $0x8,%rsp
+  8037d2:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8037d5:	48 b8 47 16 80 00 00 	movabs $0x801647,%rax
+  8037dc:	00 00 00 
+  8037df:	ff d0                	call   *%rax
+  8037e1:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8037e4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8037e9:	4c 89 e6             	mov    %r12,%rsi
+  8037ec:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037f1:	49 bc a8 12 80 00 00 	movabs $0x8012a8,%r12
+  8037f8:	00 00 00 
+  8037fb:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8037fe:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803802:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803806:	49 bd 95 37 80 00 00 	movabs $0x803795,%r13
+  80380d:	00 00 00 
+  803810:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803813:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803817:	48 89 de             	mov    %rbx,%rsi
+  80381a:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  80381d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803822:	48 89 de             	mov    %rbx,%rsi
+  803825:	bf 00 00 00 00       	mov    $0x0,%edi
+  80382a:	41 ff d4             	call   *%r12
+  80382d:	48 83 c4 08          	add    $0x8,%rsp
+  803831:	5b                   	pop    %rbx
+  803832:	41 5c                	pop    %r12
+  803834:	41 5d                	pop    %r13
+  803836:	5d                   	pop    %rbp
+  803837:	c3                   	ret
+
+0000000000803838 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  803838:	55                   	push   %rbp
+  803839:	48 89 e5             	mov    %rsp,%rbp
+  80383c:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80383f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803844:	be 00 10 00 00       	mov    $0x1000,%esi
+  803849:	48 b8 eb 11 80 00 00 	movabs $0x8011eb,%rax
+  803850:	00 00 00 
+  803853:	ff d0                	call   *%rax
+  803855:	85 c0                	test   %eax,%eax
+  803857:	0f 94 c0             	sete   %al
+  80385a:	0f b6 c0             	movzbl %al,%eax
+}
+  80385d:	5d                   	pop    %rbp
+  80385e:	c3                   	ret
+
+000000000080385f <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80385f:	55                   	push   %rbp
+  803860:	48 89 e5             	mov    %rsp,%rbp
+  803863:	41 57                	push   %r15
+  803865:	41 56                	push   %r14
+  803867:	41 55                	push   %r13
+  803869:	41 54                	push   %r12
+  80386b:	53                   	push   %rbx
+  80386c:	48 83 ec 38          	sub    $0x38,%rsp
+  803870:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803874:	49 89 f4             	mov    %rsi,%r12
+  803877:	49 89 d7             	mov    %rdx,%r15
+  80387a:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80387e:	48 b8 47 16 80 00 00 	movabs $0x801647,%rax
+  803885:	00 00 00 
+  803888:	ff d0                	call   *%rax
+  80388a:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  80388d:	4d 85 ff             	test   %r15,%r15
+  803890:	0f 84 f1 00 00 00    	je     803987 <devpipe_write+0x128>
+  803896:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  80389a:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  80389e:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  8038a2:	49 bd 38 38 80 00 00 	movabs $0x803838,%r13
+  8038a9:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8038ac:	49 bf 95 37 80 00 00 	movabs $0x803795,%r15
+  8038b3:	00 00 00 
+  8038b6:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  8038ba:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8038be:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8038c2:	8b 73 04             	mov    0x4(%rbx),%esi
+  8038c5:	48 63 ce             	movslq %esi,%rcx
+  8038c8:	48 63 03             	movslq (%rbx),%rax
+  8038cb:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  8038d1:	48 39 c1             	cmp    %rax,%rcx
+  8038d4:	72 64                	jb     80393a <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  8038d6:	48 89 de             	mov    %rbx,%rsi
+  8038d9:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8038dd:	41 ff d5             	call   *%r13
+  8038e0:	85 c0                	test   %eax,%eax
+  8038e2:	0f 85 b9 00 00 00    	jne    8039a1 <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8038e8:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8038ec:	4c 89 f7             	mov    %r14,%rdi
+  8038ef:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  8038f2:	8b 43 04             	mov    0x4(%rbx),%eax
+  8038f5:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  8038fc:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803903:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803909:	8b 03                	mov    (%rbx),%eax
+  80390b:	41 39 c4             	cmp    %eax,%r12d
+  80390e:	75 b2                	jne    8038c2 <devpipe_write+0x63>
+  803910:	48 89 de             	mov    %rbx,%rsi
+  803913:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803917:	41 ff d5             	call   *%r13
+  80391a:	85 c0                	test   %eax,%eax
+  80391c:	75 a0                	jne    8038be <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  80391e:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803923:	44 89 e6             	mov    %r12d,%esi
+  803926:	48 89 df             	mov    %rbx,%rdi
+  803929:	48 b8 70 15 80 00 00 	movabs $0x801570,%rax
+  803930:	00 00 00 
+  803933:	ff d0                	call   *%rax
+  803935:	e9 7c ff ff ff       	jmp    8038b6 <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80393a:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  80393e:	41 0f b6 38          	movzbl (%r8),%edi
+  803942:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803949:	80 80 80 
+  80394c:	48 89 c8             	mov    %rcx,%rax
+  80394f:	48 f7 e2             	mul    %rdx
+  803952:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803956:	48 89 d0             	mov    %rdx,%rax
+  803959:	48 c1 e0 08          	shl    $0x8,%rax
+  80395d:	48 29 d0             	sub    %rdx,%rax
+  803960:	48 c1 e0 04          	shl    $0x4,%rax
+  803964:	48 29 c1             	sub    %rax,%rcx
+  803967:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  80396c:	83 c6 01             	add    $0x1,%esi
+  80396f:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803972:	49 83 c0 01          	add    $0x1,%r8
+  803976:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  80397a:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80397e:	49 39 c0             	cmp    %rax,%r8
+  803981:	0f 85 2f ff ff ff    	jne    8038b6 <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803987:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  80398b:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  80398f:	48 b8 95 37 80 00 00 	movabs $0x803795,%rax
+  803996:	00 00 00 
+  803999:	ff d0                	call   *%rax
+    return n;
+  80399b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80399f:	eb 05                	jmp    8039a6 <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  8039a1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8039a6:	48 83 c4 38          	add    $0x38,%rsp
+  8039aa:	5b                   	pop    %rbx
+  8039ab:	41 5c                	pop    %r12
+  8039ad:	41 5d                	pop    %r13
+  8039af:	41 5e                	pop    %r14
+  8039b1:	41 5f                	pop    %r15
+  8039b3:	5d                   	pop    %rbp
+  8039b4:	c3                   	ret
+
+00000000008039b5 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8039b5:	55                   	push   %rbp
+  8039b6:	48 89 e5             	mov    %rsp,%rbp
+  8039b9:	41 57                	push   %r15
+  8039bb:	41 56                	push   %r14
+  8039bd:	41 55                	push   %r13
+  8039bf:	41 54                	push   %r12
+  8039c1:	53                   	push   %rbx
+  8039c2:	48 83 ec 28          	sub    $0x28,%rsp
+  8039c6:	49 89 fd             	mov    %rdi,%r13
+  8039c9:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  8039cd:	49 89 d4             	mov    %rdx,%r12
+  8039d0:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8039d4:	48 b8 47 16 80 00 00 	movabs $0x801647,%rax
+  8039db:	00 00 00 
+  8039de:	ff d0                	call   *%rax
+  8039e0:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8039e3:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  8039e9:	49 bf 38 38 80 00 00 	movabs $0x803838,%r15
+  8039f0:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8039f3:	4d 85 e4             	test   %r12,%r12
+  8039f6:	0f 84 d5 00 00 00    	je     803ad1 <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  8039fc:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803a00:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803a04:	8b 03                	mov    (%rbx),%eax
+  803a06:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803a09:	75 7a                	jne    803a85 <devpipe_read+0xd0>
+            if (i > 0) {
+  803a0b:	4d 85 f6             	test   %r14,%r14
+  803a0e:	75 50                	jne    803a60 <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  803a10:	48 89 de             	mov    %rbx,%rsi
+  803a13:	4c 89 ef             	mov    %r13,%rdi
+  803a16:	41 ff d7             	call   *%r15
+  803a19:	85 c0                	test   %eax,%eax
+  803a1b:	0f 85 c9 00 00 00    	jne    803aea <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803a21:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  803a24:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803a2b:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803a31:	8b 43 04             	mov    0x4(%rbx),%eax
+  803a34:	41 39 c4             	cmp    %eax,%r12d
+  803a37:	75 cb                	jne    803a04 <devpipe_read+0x4f>
+  803a39:	48 89 de             	mov    %rbx,%rsi
+  803a3c:	4c 89 ef             	mov    %r13,%rdi
+  803a3f:	41 ff d7             	call   *%r15
+  803a42:	85 c0                	test   %eax,%eax
+  803a44:	75 be                	jne    803a04 <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803a46:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803a4b:	44 89 e6             	mov    %r12d,%esi
+  803a4e:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803a52:	48 b8 70 15 80 00 00 	movabs $0x801570,%rax
+  803a59:	00 00 00 
+  803a5c:	ff d0                	call   *%rax
+  803a5e:	eb a4                	jmp    803a04 <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803a60:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803a64:	48 89 de             	mov    %rbx,%rsi
+  803a67:	48 b8 95 37 80 00 00 	movabs $0x803795,%rax
+  803a6e:	00 00 00 
+  803a71:	ff d0                	call   *%rax
+                return i;
+  803a73:	4c 89 f0             	mov    %r14,%rax
+}
+  803a76:	48 83 c4 28          	add    $0x28,%rsp
+  803a7a:	5b                   	pop    %rbx
+  803a7b:	41 5c                	pop    %r12
+  803a7d:	41 5d                	pop    %r13
+  803a7f:	41 5e                	pop    %r14
+  803a81:	41 5f                	pop    %r15
+  803a83:	5d                   	pop    %rbp
+  803a84:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803a85:	48 63 c8             	movslq %eax,%rcx
+  803a88:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803a8f:	80 80 80 
+  803a92:	48 89 c8             	mov    %rcx,%rax
+  803a95:	48 f7 e2             	mul    %rdx
+  803a98:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803a9c:	48 89 d0             	mov    %rdx,%rax
+  803a9f:	48 c1 e0 08          	shl    $0x8,%rax
+  803aa3:	48 29 d0             	sub    %rdx,%rax
+  803aa6:	48 c1 e0 04          	shl    $0x4,%rax
+  803aaa:	48 89 c2             	mov    %rax,%rdx
+  803aad:	48 89 c8             	mov    %rcx,%rax
+  803ab0:	48 29 d0             	sub    %rdx,%rax
+  803ab3:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  803ab8:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803abc:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  803ac0:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803ac3:	49 83 c6 01          	add    $0x1,%r14
+  803ac7:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  803acb:	0f 85 2b ff ff ff    	jne    8039fc <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803ad1:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803ad5:	48 89 de             	mov    %rbx,%rsi
+  803ad8:	48 b8 95 37 80 00 00 	movabs $0x803795,%rax
+  803adf:	00 00 00 
+  803ae2:	ff d0                	call   *%rax
+    return n;
+  803ae4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803ae8:	eb 8c                	jmp    803a76 <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  803aea:	b8 00 00 00 00       	mov    $0x0,%eax
+  803aef:	eb 85                	jmp    803a76 <devpipe_read+0xc1>
+
+0000000000803af1 <pipe>:
+pipe(int pfd[2]) {
+  803af1:	55                   	push   %rbp
+  803af2:	48 89 e5             	mov    %rsp,%rbp
+  803af5:	41 55                	push   %r13
+  803af7:	41 54                	push   %r12
+  803af9:	53                   	push   %rbx
+  803afa:	48 83 ec 18          	sub    $0x18,%rsp
+  803afe:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803b01:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803b05:	48 b8 63 16 80 00 00 	movabs $0x801663,%rax
+  803b0c:	00 00 00 
+  803b0f:	ff d0                	call   *%rax
+  803b11:	89 c3                	mov    %eax,%ebx
+  803b13:	85 c0                	test   %eax,%eax
+  803b15:	0f 88 a0 01 00 00    	js     803cbb <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803b1b:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803b20:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b25:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803b29:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b2e:	48 b8 02 12 80 00 00 	movabs $0x801202,%rax
+  803b35:	00 00 00 
+  803b38:	ff d0                	call   *%rax
+  803b3a:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803b3c:	85 c0                	test   %eax,%eax
+  803b3e:	0f 88 77 01 00 00    	js     803cbb <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803b44:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803b48:	48 b8 63 16 80 00 00 	movabs $0x801663,%rax
+  803b4f:	00 00 00 
+  803b52:	ff d0                	call   *%rax
+  803b54:	89 c3                	mov    %eax,%ebx
+  803b56:	85 c0                	test   %eax,%eax
+  803b58:	0f 88 43 01 00 00    	js     803ca1 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803b5e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803b63:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b68:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803b6c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b71:	48 b8 02 12 80 00 00 	movabs $0x801202,%rax
+  803b78:	00 00 00 
+  803b7b:	ff d0                	call   *%rax
+  803b7d:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803b7f:	85 c0                	test   %eax,%eax
+  803b81:	0f 88 1a 01 00 00    	js     803ca1 <pipe+0x1b0>
+    va = fd2data(fd0);
+  803b87:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803b8b:	48 b8 47 16 80 00 00 	movabs $0x801647,%rax
+  803b92:	00 00 00 
+  803b95:	ff d0                	call   *%rax
+  803b97:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803b9a:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803b9f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ba4:	48 89 c6             	mov    %rax,%rsi
+  803ba7:	bf 00 00 00 00       	mov    $0x0,%edi
+  803bac:	48 b8 02 12 80 00 00 	movabs $0x801202,%rax
+  803bb3:	00 00 00 
+  803bb6:	ff d0                	call   *%rax
+  803bb8:	89 c3                	mov    %eax,%ebx
+  803bba:	85 c0                	test   %eax,%eax
+  803bbc:	0f 88 c5 00 00 00    	js     803c87 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803bc2:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803bc6:	48 b8 47 16 80 00 00 	movabs $0x801647,%rax
+  803bcd:	00 00 00 
+  803bd0:	ff d0                	call   *%rax
+  803bd2:	48 89 c1             	mov    %rax,%rcx
+  803bd5:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803bdb:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803be1:	ba 00 00 00 00       	mov    $0x0,%edx
+  803be6:	4c 89 ee             	mov    %r13,%rsi
+  803be9:	bf 00 00 00 00       	mov    $0x0,%edi
+  803bee:	48 b8 58 12 80 00 00 	movabs $0x801258,%rax
+  803bf5:	00 00 00 
+  803bf8:	ff d0                	call   *%rax
+  803bfa:	89 c3                	mov    %eax,%ebx
+  803bfc:	85 c0                	test   %eax,%eax
+  803bfe:	78 6e                	js     803c6e <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803c00:	be 00 10 00 00       	mov    $0x1000,%esi
+  803c05:	4c 89 ef             	mov    %r13,%rdi
+  803c08:	48 b8 c7 11 80 00 00 	movabs $0x8011c7,%rax
+  803c0f:	00 00 00 
+  803c12:	ff d0                	call   *%rax
+  803c14:	83 f8 02             	cmp    $0x2,%eax
+  803c17:	0f 85 ab 00 00 00    	jne    803cc8 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803c1d:	a1 60 50 80 00 00 00 	movabs 0x805060,%eax
+  803c24:	00 00 
+  803c26:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803c2a:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803c2c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803c30:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803c37:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803c3b:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803c3d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803c41:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803c48:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803c4c:	48 bb 35 16 80 00 00 	movabs $0x801635,%rbx
+  803c53:	00 00 00 
+  803c56:	ff d3                	call   *%rbx
+  803c58:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803c5c:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803c60:	ff d3                	call   *%rbx
+  803c62:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803c67:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803c6c:	eb 4d                	jmp    803cbb <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803c6e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c73:	4c 89 ee             	mov    %r13,%rsi
+  803c76:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c7b:	48 b8 a8 12 80 00 00 	movabs $0x8012a8,%rax
+  803c82:	00 00 00 
+  803c85:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803c87:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c8c:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803c90:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c95:	48 b8 a8 12 80 00 00 	movabs $0x8012a8,%rax
+  803c9c:	00 00 00 
+  803c9f:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803ca1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ca6:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803caa:	bf 00 00 00 00       	mov    $0x0,%edi
+  803caf:	48 b8 a8 12 80 00 00 	movabs $0x8012a8,%rax
+  803cb6:	00 00 00 
+  803cb9:	ff d0                	call   *%rax
+}
+  803cbb:	89 d8                	mov    %ebx,%eax
+  803cbd:	48 83 c4 18          	add    $0x18,%rsp
+  803cc1:	5b                   	pop    %rbx
+  803cc2:	41 5c                	pop    %r12
+  803cc4:	41 5d                	pop    %r13
+  803cc6:	5d                   	pop    %rbp
+  803cc7:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803cc8:	48 b9 10 4f 80 00 00 	movabs $0x804f10,%rcx
+  803ccf:	00 00 00 
+  803cd2:	48 ba e7 4e 80 00 00 	movabs $0x804ee7,%rdx
+  803cd9:	00 00 00 
+  803cdc:	be 50 00 00 00       	mov    $0x50,%esi
+  803ce1:	48 bf fc 4e 80 00 00 	movabs $0x804efc,%rdi
+  803ce8:	00 00 00 
+  803ceb:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cf0:	49 b8 2e 02 80 00 00 	movabs $0x80022e,%r8
+  803cf7:	00 00 00 
+  803cfa:	41 ff d0             	call   *%r8
+
+0000000000803cfd <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803cfd:	55                   	push   %rbp
+  803cfe:	48 89 e5             	mov    %rsp,%rbp
+  803d01:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803d05:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803d09:	48 b8 c3 16 80 00 00 	movabs $0x8016c3,%rax
+  803d10:	00 00 00 
+  803d13:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803d15:	85 c0                	test   %eax,%eax
+  803d17:	78 23                	js     803d3c <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803d19:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803d1d:	48 b8 47 16 80 00 00 	movabs $0x801647,%rax
+  803d24:	00 00 00 
+  803d27:	ff d0                	call   *%rax
+  803d29:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  803d2c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803d30:	48 b8 38 38 80 00 00 	movabs $0x803838,%rax
+  803d37:	00 00 00 
+  803d3a:	ff d0                	call   *%rax
+}
+  803d3c:	c9                   	leave
+  803d3d:	c3                   	ret
+
+0000000000803d3e <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803d3e:	48 89 f8             	mov    %rdi,%rax
+  803d41:	48 c1 e8 27          	shr    $0x27,%rax
+  803d45:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803d4c:	01 00 00 
+  803d4f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803d53:	f6 c2 01             	test   $0x1,%dl
+  803d56:	74 6d                	je     803dc5 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803d58:	48 89 f8             	mov    %rdi,%rax
+  803d5b:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803d5f:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803d66:	01 00 00 
+  803d69:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803d6d:	f6 c2 01             	test   $0x1,%dl
+  803d70:	74 62                	je     803dd4 <get_uvpt_entry+0x96>
+  803d72:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803d79:	01 00 00 
+  803d7c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803d80:	f6 c2 80             	test   $0x80,%dl
+  803d83:	75 4f                	jne    803dd4 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803d85:	48 89 f8             	mov    %rdi,%rax
+  803d88:	48 c1 e8 15          	shr    $0x15,%rax
+  803d8c:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803d93:	01 00 00 
+  803d96:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803d9a:	f6 c2 01             	test   $0x1,%dl
+  803d9d:	74 44                	je     803de3 <get_uvpt_entry+0xa5>
+  803d9f:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803da6:	01 00 00 
+  803da9:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803dad:	f6 c2 80             	test   $0x80,%dl
+  803db0:	75 31                	jne    803de3 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803db2:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803db6:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803dbd:	01 00 00 
+  803dc0:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803dc4:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803dc5:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803dcc:	01 00 00 
+  803dcf:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803dd3:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803dd4:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803ddb:	01 00 00 
+  803dde:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803de2:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803de3:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803dea:	01 00 00 
+  803ded:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803df1:	c3                   	ret
+
+0000000000803df2 <get_prot>:
+
+int
+get_prot(void *va) {
+  803df2:	55                   	push   %rbp
+  803df3:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803df6:	48 b8 3e 3d 80 00 00 	movabs $0x803d3e,%rax
+  803dfd:	00 00 00 
+  803e00:	ff d0                	call   *%rax
+  803e02:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803e05:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803e0a:	89 c1                	mov    %eax,%ecx
+  803e0c:	83 c9 04             	or     $0x4,%ecx
+  803e0f:	f6 c2 01             	test   $0x1,%dl
+  803e12:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803e15:	89 c1                	mov    %eax,%ecx
+  803e17:	83 c9 02             	or     $0x2,%ecx
+  803e1a:	f6 c2 02             	test   $0x2,%dl
+  803e1d:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803e20:	89 c1                	mov    %eax,%ecx
+  803e22:	83 c9 01             	or     $0x1,%ecx
+  803e25:	48 85 d2             	test   %rdx,%rdx
+  803e28:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803e2b:	89 c1                	mov    %eax,%ecx
+  803e2d:	83 c9 40             	or     $0x40,%ecx
+  803e30:	f6 c6 04             	test   $0x4,%dh
+  803e33:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803e36:	5d                   	pop    %rbp
+  803e37:	c3                   	ret
+
+0000000000803e38 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803e38:	55                   	push   %rbp
+  803e39:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803e3c:	48 b8 3e 3d 80 00 00 	movabs $0x803d3e,%rax
+  803e43:	00 00 00 
+  803e46:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803e48:	48 c1 e8 06          	shr    $0x6,%rax
+  803e4c:	83 e0 01             	and    $0x1,%eax
+}
+  803e4f:	5d                   	pop    %rbp
+  803e50:	c3                   	ret
+
+0000000000803e51 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803e51:	55                   	push   %rbp
+  803e52:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803e55:	48 b8 3e 3d 80 00 00 	movabs $0x803d3e,%rax
+  803e5c:	00 00 00 
+  803e5f:	ff d0                	call   *%rax
+  803e61:	83 e0 01             	and    $0x1,%eax
+}
+  803e64:	5d                   	pop    %rbp
+  803e65:	c3                   	ret
+
+0000000000803e66 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  803e66:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  803e6d:	01 00 00 
+  803e70:	a8 01                	test   $0x1,%al
+  803e72:	75 06                	jne    803e7a <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  803e74:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e79:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803e7a:	55                   	push   %rbp
+  803e7b:	48 89 e5             	mov    %rsp,%rbp
+  803e7e:	41 57                	push   %r15
+  803e80:	41 56                	push   %r14
+  803e82:	41 55                	push   %r13
+  803e84:	41 54                	push   %r12
+  803e86:	53                   	push   %rbx
+  803e87:	48 83 ec 28          	sub    $0x28,%rsp
+  803e8b:	49 89 fe             	mov    %rdi,%r14
+  803e8e:	49 89 f7             	mov    %rsi,%r15
+  803e91:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  803e98:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  803e99:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  803ea0:	01 00 00 
+  803ea3:	e9 ae 00 00 00       	jmp    803f56 <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  803ea8:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803eaf:	49 83 ec 01          	sub    $0x1,%r12
+  803eb3:	74 2d                	je     803ee2 <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  803eb5:	48 89 d8             	mov    %rbx,%rax
+  803eb8:	48 c1 e8 0c          	shr    $0xc,%rax
+  803ebc:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  803ec1:	f6 c2 01             	test   $0x1,%dl
+  803ec4:	74 e2                	je     803ea8 <foreach_shared_region+0x42>
+  803ec6:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  803ecb:	f6 c4 04             	test   $0x4,%ah
+  803ece:	74 d8                	je     803ea8 <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  803ed0:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803ed7:	4c 89 fa             	mov    %r15,%rdx
+  803eda:	48 89 df             	mov    %rbx,%rdi
+  803edd:	41 ff d6             	call   *%r14
+  803ee0:	eb c6                	jmp    803ea8 <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  803ee2:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  803ee9:	00 
+  803eea:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  803eef:	74 4a                	je     803f3b <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  803ef1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803ef5:	48 c1 e8 15          	shr    $0x15,%rax
+  803ef9:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  803f00:	01 00 00 
+  803f03:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  803f07:	a8 01                	test   $0x1,%al
+  803f09:	74 d7                	je     803ee2 <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  803f0b:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  803f0f:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  803f16:	48 39 c3             	cmp    %rax,%rbx
+  803f19:	73 c7                	jae    803ee2 <foreach_shared_region+0x7c>
+  803f1b:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  803f22:	48 39 d0             	cmp    %rdx,%rax
+  803f25:	4d 19 e4             	sbb    %r12,%r12
+  803f28:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  803f2f:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  803f36:	e9 7a ff ff ff       	jmp    803eb5 <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  803f3b:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  803f42:	40 
+  803f43:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803f47:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803f4e:	00 00 00 
+  803f51:	48 39 c1             	cmp    %rax,%rcx
+  803f54:	74 50                	je     803fa6 <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  803f56:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803f5a:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803f5e:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  803f65:	01 00 00 
+  803f68:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  803f6c:	a8 01                	test   $0x1,%al
+  803f6e:	74 cb                	je     803f3b <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  803f70:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803f74:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  803f7b:	48 39 c1             	cmp    %rax,%rcx
+  803f7e:	73 bb                	jae    803f3b <foreach_shared_region+0xd5>
+  803f80:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  803f87:	48 39 d0             	cmp    %rdx,%rax
+  803f8a:	48 19 c0             	sbb    %rax,%rax
+  803f8d:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  803f93:	48 05 00 02 00 00    	add    $0x200,%rax
+  803f99:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803f9d:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803fa1:	e9 4b ff ff ff       	jmp    803ef1 <foreach_shared_region+0x8b>
+  803fa6:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fab:	48 83 c4 28          	add    $0x28,%rsp
+  803faf:	5b                   	pop    %rbx
+  803fb0:	41 5c                	pop    %r12
+  803fb2:	41 5d                	pop    %r13
+  803fb4:	41 5e                	pop    %r14
+  803fb6:	41 5f                	pop    %r15
+  803fb8:	5d                   	pop    %rbp
+  803fb9:	c3                   	ret
+
+0000000000803fba <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  803fba:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  803fc0:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  803fc7:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  803fce:	c3                   	ret
+
+0000000000803fcf <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  803fcf:	8b 47 40             	mov    0x40(%rdi),%eax
+  803fd2:	8b 17                	mov    (%rdi),%edx
+  803fd4:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  803fd6:	83 f8 0f             	cmp    $0xf,%eax
+  803fd9:	77 13                	ja     803fee <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  803fdb:	8b 47 40             	mov    0x40(%rdi),%eax
+  803fde:	83 e0 0f             	and    $0xf,%eax
+  803fe1:	48 c1 e0 09          	shl    $0x9,%rax
+  803fe5:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  803fec:	00 
+  803fed:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  803fee:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ff3:	c3                   	ret
+
+0000000000803ff4 <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  803ff4:	8b 47 40             	mov    0x40(%rdi),%eax
+  803ff7:	83 c0 01             	add    $0x1,%eax
+  803ffa:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803ffd:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  804003:	8b 57 04             	mov    0x4(%rdi),%edx
+  804006:	b8 00 00 00 00       	mov    $0x0,%eax
+  80400b:	85 d2                	test   %edx,%edx
+  80400d:	75 04                	jne    804013 <chan_publish+0x1f>
+  80400f:	83 e0 01             	and    $0x1,%eax
+}
+  804012:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  804013:	87 47 04             	xchg   %eax,0x4(%rdi)
+  804016:	85 c0                	test   %eax,%eax
+  804018:	0f 95 c0             	setne  %al
+  80401b:	0f b6 c0             	movzbl %al,%eax
+  80401e:	eb ef                	jmp    80400f <chan_publish+0x1b>
+
+0000000000804020 <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  804020:	8b 47 40             	mov    0x40(%rdi),%eax
+  804023:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  804025:	29 d0                	sub    %edx,%eax
+  804027:	83 e8 01             	sub    $0x1,%eax
+  80402a:	83 f8 0f             	cmp    $0xf,%eax
+  80402d:	77 12                	ja     804041 <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  80402f:	8b 07                	mov    (%rdi),%eax
+  804031:	83 e0 0f             	and    $0xf,%eax
+  804034:	48 c1 e0 09          	shl    $0x9,%rax
+  804038:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  80403f:	00 
+  804040:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  804041:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804046:	c3                   	ret
+
+0000000000804047 <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  804047:	8b 07                	mov    (%rdi),%eax
+  804049:	83 c0 01             	add    $0x1,%eax
+  80404c:	89 07                	mov    %eax,(%rdi)
+}
+  80404e:	c3                   	ret
+
+000000000080404f <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  80404f:	55                   	push   %rbp
+  804050:	48 89 e5             	mov    %rsp,%rbp
+  804053:	53                   	push   %rbx
+  804054:	48 83 ec 08          	sub    $0x8,%rsp
+  804058:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  80405b:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  804062:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  804068:	48 b8 20 40 80 00 00 	movabs $0x804020,%rax
+  80406f:	00 00 00 
+  804072:	ff d0                	call   *%rax
+  804074:	48 85 c0             	test   %rax,%rax
+  804077:	74 12                	je     80408b <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  804079:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  804080:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804085:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804089:	c9                   	leave
+  80408a:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  80408b:	b8 01 00 00 00       	mov    $0x1,%eax
+  804090:	eb f3                	jmp    804085 <chan_arm+0x36>
+
+0000000000804092 <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  804092:	55                   	push   %rbp
+  804093:	48 89 e5             	mov    %rsp,%rbp
+  804096:	41 56                	push   %r14
+  804098:	41 55                	push   %r13
+  80409a:	41 54                	push   %r12
+  80409c:	53                   	push   %rbx
+  80409d:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  8040a0:	49 bc 4f 40 80 00 00 	movabs $0x80404f,%r12
+  8040a7:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  8040aa:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  8040ae:	49 bd 70 15 80 00 00 	movabs $0x801570,%r13
+  8040b5:	00 00 00 
+    while (chan_arm(r))
+  8040b8:	eb 0d                	jmp    8040c7 <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  8040ba:	8b 33                	mov    (%rbx),%esi
+  8040bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8040c1:	4c 89 f7             	mov    %r14,%rdi
+  8040c4:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  8040c7:	48 89 df             	mov    %rbx,%rdi
+  8040ca:	41 ff d4             	call   *%r12
+  8040cd:	84 c0                	test   %al,%al
+  8040cf:	75 e9                	jne    8040ba <chan_wait+0x28>
+}
+  8040d1:	5b                   	pop    %rbx
+  8040d2:	41 5c                	pop    %r12
+  8040d4:	41 5d                	pop    %r13
+  8040d6:	41 5e                	pop    %r14
+  8040d8:	5d                   	pop    %rbp
+  8040d9:	c3                   	ret
+
+00000000008040da <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  8040da:	55                   	push   %rbp
+  8040db:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  8040de:	48 83 c7 40          	add    $0x40,%rdi
+  8040e2:	be 01 00 00 00       	mov    $0x1,%esi
+  8040e7:	48 b8 8e 15 80 00 00 	movabs $0x80158e,%rax
+  8040ee:	00 00 00 
+  8040f1:	ff d0                	call   *%rax
+}
+  8040f3:	5d                   	pop    %rbp
+  8040f4:	c3                   	ret
+
+00000000008040f5 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8040f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040fa:	c3                   	ret
+
+00000000008040fb <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8040fb:	55                   	push   %rbp
+  8040fc:	48 89 e5             	mov    %rsp,%rbp
+  8040ff:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804102:	48 be 34 4f 80 00 00 	movabs $0x804f34,%rsi
+  804109:	00 00 00 
+  80410c:	48 b8 a3 0c 80 00 00 	movabs $0x800ca3,%rax
+  804113:	00 00 00 
+  804116:	ff d0                	call   *%rax
+    return 0;
+}
+  804118:	b8 00 00 00 00       	mov    $0x0,%eax
+  80411d:	5d                   	pop    %rbp
+  80411e:	c3                   	ret
+
+000000000080411f <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80411f:	55                   	push   %rbp
+  804120:	48 89 e5             	mov    %rsp,%rbp
+  804123:	41 57                	push   %r15
+  804125:	41 56                	push   %r14
+  804127:	41 55                	push   %r13
+  804129:	41 54                	push   %r12
+  80412b:	53                   	push   %rbx
+  80412c:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  804133:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  80413a:	48 85 d2             	test   %rdx,%rdx
+  80413d:	74 7a                	je     8041b9 <devcons_write+0x9a>
+  80413f:	49 89 d6             	mov    %rdx,%r14
+  804142:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804148:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80414d:	49 bf 9d 0e 80 00 00 	movabs $0x800e9d,%r15
+  804154:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804157:	4c 89 f3             	mov    %r14,%rbx
+  80415a:	48 29 f3             	sub    %rsi,%rbx
+  80415d:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804162:	48 39 c3             	cmp    %rax,%rbx
+  804165:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804169:	4c 63 eb             	movslq %ebx,%r13
+  80416c:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804173:	48 01 c6             	add    %rax,%rsi
+  804176:	4c 89 ea             	mov    %r13,%rdx
+  804179:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804180:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  804183:	4c 89 ee             	mov    %r13,%rsi
+  804186:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80418d:	48 b8 ca 10 80 00 00 	movabs $0x8010ca,%rax
+  804194:	00 00 00 
+  804197:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804199:	41 01 dc             	add    %ebx,%r12d
+  80419c:	49 63 f4             	movslq %r12d,%rsi
+  80419f:	4c 39 f6             	cmp    %r14,%rsi
+  8041a2:	72 b3                	jb     804157 <devcons_write+0x38>
+    return res;
+  8041a4:	49 63 c4             	movslq %r12d,%rax
+}
+  8041a7:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8041ae:	5b                   	pop    %rbx
+  8041af:	41 5c                	pop    %r12
+  8041b1:	41 5d                	pop    %r13
+  8041b3:	41 5e                	pop    %r14
+  8041b5:	41 5f                	pop    %r15
+  8041b7:	5d                   	pop    %rbp
+  8041b8:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8041b9:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8041bf:	eb e3                	jmp    8041a4 <devcons_write+0x85>
+
+00000000008041c1 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8041c1:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8041c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8041c9:	48 85 c0             	test   %rax,%rax
+  8041cc:	74 55                	je     804223 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8041ce:	55                   	push   %rbp
+  8041cf:	48 89 e5             	mov    %rsp,%rbp
+  8041d2:	41 55                	push   %r13
+  8041d4:	41 54                	push   %r12
+  8041d6:	53                   	push   %rbx
+  8041d7:	48 83 ec 08          	sub    $0x8,%rsp
+  8041db:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8041de:	48 bb e9 10 80 00 00 	movabs $0x8010e9,%rbx
+  8041e5:	00 00 00 
+  8041e8:	49 bc 9e 11 80 00 00 	movabs $0x80119e,%r12
+  8041ef:	00 00 00 
+  8041f2:	eb 03                	jmp    8041f7 <devcons_read+0x36>
+  8041f4:	41 ff d4             	call   *%r12
+  8041f7:	ff d3                	call   *%rbx
+  8041f9:	85 c0                	test   %eax,%eax
+  8041fb:	74 f7                	je     8041f4 <devcons_read+0x33>
+    if (c < 0) return c;
+  8041fd:	48 63 d0             	movslq %eax,%rdx
+  804200:	78 13                	js     804215 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  804202:	ba 00 00 00 00       	mov    $0x0,%edx
+  804207:	83 f8 04             	cmp    $0x4,%eax
+  80420a:	74 09                	je     804215 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  80420c:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804210:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804215:	48 89 d0             	mov    %rdx,%rax
+  804218:	48 83 c4 08          	add    $0x8,%rsp
+  80421c:	5b                   	pop    %rbx
+  80421d:	41 5c                	pop    %r12
+  80421f:	41 5d                	pop    %r13
+  804221:	5d                   	pop    %rbp
+  804222:	c3                   	ret
+  804223:	48 89 d0             	mov    %rdx,%rax
+  804226:	c3                   	ret
+
+0000000000804227 <cputchar>:
+cputchar(int ch) {
+  804227:	55                   	push   %rbp
+  804228:	48 89 e5             	mov    %rsp,%rbp
+  80422b:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  80422f:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  804233:	be 01 00 00 00       	mov    $0x1,%esi
+  804238:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  80423c:	48 b8 ca 10 80 00 00 	movabs $0x8010ca,%rax
+  804243:	00 00 00 
+  804246:	ff d0                	call   *%rax
+}
+  804248:	c9                   	leave
+  804249:	c3                   	ret
+
+000000000080424a <getchar>:
+getchar(void) {
+  80424a:	55                   	push   %rbp
+  80424b:	48 89 e5             	mov    %rsp,%rbp
+  80424e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  804252:	ba 01 00 00 00       	mov    $0x1,%edx
+  804257:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  80425b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804260:	48 b8 a6 19 80 00 00 	movabs $0x8019a6,%rax
+  804267:	00 00 00 
+  80426a:	ff d0                	call   *%rax
+  80426c:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80426e:	85 c0                	test   %eax,%eax
+  804270:	78 06                	js     804278 <getchar+0x2e>
+  804272:	74 08                	je     80427c <getchar+0x32>
+  804274:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804278:	89 d0                	mov    %edx,%eax
+  80427a:	c9                   	leave
+  80427b:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  80427c:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  804281:	eb f5                	jmp    804278 <getchar+0x2e>
+
+0000000000804283 <iscons>:
+iscons(int fdnum) {
+  804283:	55                   	push   %rbp
+  804284:	48 89 e5             	mov    %rsp,%rbp
+  804287:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80428b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80428f:	48 b8 c3 16 80 00 00 	movabs $0x8016c3,%rax
+  804296:	00 00 00 
+  804299:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80429b:	85 c0                	test   %eax,%eax
+  80429d:	78 18                	js     8042b7 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80429f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8042a3:	48 b8 a0 50 80 00 00 	movabs $0x8050a0,%rax
+  8042aa:	00 00 00 
+  8042ad:	8b 00                	mov    (%rax),%eax
+  8042af:	39 02                	cmp    %eax,(%rdx)
+  8042b1:	0f 94 c0             	sete   %al
+  8042b4:	0f b6 c0             	movzbl %al,%eax
+}
+  8042b7:	c9                   	leave
+  8042b8:	c3                   	ret
+
+00000000008042b9 <opencons>:
+opencons(void) {
+  8042b9:	55                   	push   %rbp
+  8042ba:	48 89 e5             	mov    %rsp,%rbp
+  8042bd:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8042c1:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8042c5:	48 b8 63 16 80 00 00 	movabs $0x801663,%rax
+  8042cc:	00 00 00 
+  8042cf:	ff d0                	call   *%rax
+  8042d1:	85 c0                	test   %eax,%eax
+  8042d3:	78 49                	js     80431e <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8042d5:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8042da:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8042df:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8042e3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8042e8:	48 b8 02 12 80 00 00 	movabs $0x801202,%rax
+  8042ef:	00 00 00 
+  8042f2:	ff d0                	call   *%rax
+  8042f4:	85 c0                	test   %eax,%eax
+  8042f6:	78 26                	js     80431e <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8042f8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8042fc:	a1 a0 50 80 00 00 00 	movabs 0x8050a0,%eax
+  804303:	00 00 
+  804305:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  804307:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80430b:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  804312:	48 b8 35 16 80 00 00 	movabs $0x801635,%rax
+  804319:	00 00 00 
+  80431c:	ff d0                	call   *%rax
+}
+  80431e:	c9                   	leave
+  80431f:	c3                   	ret
+
+0000000000804320 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  804320:	55                   	push   %rbp
+  804321:	48 89 e5             	mov    %rsp,%rbp
+  804324:	41 56                	push   %r14
+  804326:	41 55                	push   %r13
+  804328:	41 54                	push   %r12
+  80432a:	53                   	push   %rbx
+  80432b:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80432e:	48 b8 48 10 c4 00 00 	movabs $0xc41048,%rax
+  804335:	00 00 00 
+  804338:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80433c:	74 27                	je     804365 <_handle_vectored_pagefault+0x45>
+  80433e:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  804343:	49 bd 00 10 c4 00 00 	movabs $0xc41000,%r13
+  80434a:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80434d:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  804350:	4c 89 e7             	mov    %r12,%rdi
+  804353:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  804358:	84 c0                	test   %al,%al
+  80435a:	75 45                	jne    8043a1 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80435c:	48 83 c3 01          	add    $0x1,%rbx
+  804360:	49 3b 1e             	cmp    (%r14),%rbx
+  804363:	72 eb                	jb     804350 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  804365:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  80436c:	00 
+  80436d:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  804372:	4d 8b 04 24          	mov    (%r12),%r8
+  804376:	48 ba 40 4f 80 00 00 	movabs $0x804f40,%rdx
+  80437d:	00 00 00 
+  804380:	be 1d 00 00 00       	mov    $0x1d,%esi
+  804385:	48 bf 70 4f 80 00 00 	movabs $0x804f70,%rdi
+  80438c:	00 00 00 
+  80438f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804394:	49 ba 2e 02 80 00 00 	movabs $0x80022e,%r10
+  80439b:	00 00 00 
+  80439e:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  8043a1:	5b                   	pop    %rbx
+  8043a2:	41 5c                	pop    %r12
+  8043a4:	41 5d                	pop    %r13
+  8043a6:	41 5e                	pop    %r14
+  8043a8:	5d                   	pop    %rbp
+  8043a9:	c3                   	ret
+
+00000000008043aa <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  8043aa:	55                   	push   %rbp
+  8043ab:	48 89 e5             	mov    %rsp,%rbp
+  8043ae:	53                   	push   %rbx
+  8043af:	48 83 ec 08          	sub    $0x8,%rsp
+  8043b3:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  8043b6:	48 b8 40 10 c4 00 00 	movabs $0xc41040,%rax
+  8043bd:	00 00 00 
+  8043c0:	80 38 00             	cmpb   $0x0,(%rax)
+  8043c3:	0f 84 84 00 00 00    	je     80444d <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8043c9:	48 b8 48 10 c4 00 00 	movabs $0xc41048,%rax
+  8043d0:	00 00 00 
+  8043d3:	48 8b 10             	mov    (%rax),%rdx
+  8043d6:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  8043db:	48 b9 00 10 c4 00 00 	movabs $0xc41000,%rcx
+  8043e2:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8043e5:	48 85 d2             	test   %rdx,%rdx
+  8043e8:	74 19                	je     804403 <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  8043ea:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  8043ee:	0f 84 e8 00 00 00    	je     8044dc <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8043f4:	48 83 c0 01          	add    $0x1,%rax
+  8043f8:	48 39 d0             	cmp    %rdx,%rax
+  8043fb:	75 ed                	jne    8043ea <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  8043fd:	48 83 fa 08          	cmp    $0x8,%rdx
+  804401:	74 1c                	je     80441f <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  804403:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  804407:	48 a3 48 10 c4 00 00 	movabs %rax,0xc41048
+  80440e:	00 00 00 
+  804411:	48 b8 00 10 c4 00 00 	movabs $0xc41000,%rax
+  804418:	00 00 00 
+  80441b:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  80441f:	48 b8 75 11 80 00 00 	movabs $0x801175,%rax
+  804426:	00 00 00 
+  804429:	ff d0                	call   *%rax
+  80442b:	89 c7                	mov    %eax,%edi
+  80442d:	48 be a2 45 80 00 00 	movabs $0x8045a2,%rsi
+  804434:	00 00 00 
+  804437:	48 b8 c0 13 80 00 00 	movabs $0x8013c0,%rax
+  80443e:	00 00 00 
+  804441:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  804443:	85 c0                	test   %eax,%eax
+  804445:	78 68                	js     8044af <add_pgfault_handler+0x105>
+    return res;
+}
+  804447:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80444b:	c9                   	leave
+  80444c:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  80444d:	48 b8 75 11 80 00 00 	movabs $0x801175,%rax
+  804454:	00 00 00 
+  804457:	ff d0                	call   *%rax
+  804459:	89 c7                	mov    %eax,%edi
+  80445b:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804460:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804465:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  80446c:	00 00 00 
+  80446f:	48 b8 02 12 80 00 00 	movabs $0x801202,%rax
+  804476:	00 00 00 
+  804479:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  80447b:	48 ba 48 10 c4 00 00 	movabs $0xc41048,%rdx
+  804482:	00 00 00 
+  804485:	48 8b 02             	mov    (%rdx),%rax
+  804488:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80448c:	48 89 0a             	mov    %rcx,(%rdx)
+  80448f:	48 ba 00 10 c4 00 00 	movabs $0xc41000,%rdx
+  804496:	00 00 00 
+  804499:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  80449d:	48 b8 40 10 c4 00 00 	movabs $0xc41040,%rax
+  8044a4:	00 00 00 
+  8044a7:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  8044aa:	e9 70 ff ff ff       	jmp    80441f <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8044af:	89 c1                	mov    %eax,%ecx
+  8044b1:	48 ba 7e 4f 80 00 00 	movabs $0x804f7e,%rdx
+  8044b8:	00 00 00 
+  8044bb:	be 3d 00 00 00       	mov    $0x3d,%esi
+  8044c0:	48 bf 70 4f 80 00 00 	movabs $0x804f70,%rdi
+  8044c7:	00 00 00 
+  8044ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044cf:	49 b8 2e 02 80 00 00 	movabs $0x80022e,%r8
+  8044d6:	00 00 00 
+  8044d9:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8044dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044e1:	e9 61 ff ff ff       	jmp    804447 <add_pgfault_handler+0x9d>
+
+00000000008044e6 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  8044e6:	55                   	push   %rbp
+  8044e7:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  8044ea:	48 b8 40 10 c4 00 00 	movabs $0xc41040,%rax
+  8044f1:	00 00 00 
+  8044f4:	80 38 00             	cmpb   $0x0,(%rax)
+  8044f7:	74 33                	je     80452c <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8044f9:	48 a1 48 10 c4 00 00 	movabs 0xc41048,%rax
+  804500:	00 00 00 
+  804503:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  804508:	48 ba 00 10 c4 00 00 	movabs $0xc41000,%rdx
+  80450f:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804512:	48 85 c0             	test   %rax,%rax
+  804515:	0f 84 85 00 00 00    	je     8045a0 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  80451b:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  80451f:	74 40                	je     804561 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804521:	48 83 c1 01          	add    $0x1,%rcx
+  804525:	48 39 c1             	cmp    %rax,%rcx
+  804528:	75 f1                	jne    80451b <remove_pgfault_handler+0x35>
+  80452a:	eb 74                	jmp    8045a0 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  80452c:	48 b9 96 4f 80 00 00 	movabs $0x804f96,%rcx
+  804533:	00 00 00 
+  804536:	48 ba e7 4e 80 00 00 	movabs $0x804ee7,%rdx
+  80453d:	00 00 00 
+  804540:	be 43 00 00 00       	mov    $0x43,%esi
+  804545:	48 bf 70 4f 80 00 00 	movabs $0x804f70,%rdi
+  80454c:	00 00 00 
+  80454f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804554:	49 b8 2e 02 80 00 00 	movabs $0x80022e,%r8
+  80455b:	00 00 00 
+  80455e:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  804561:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  804568:	00 
+  804569:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80456d:	48 29 ca             	sub    %rcx,%rdx
+  804570:	48 b8 00 10 c4 00 00 	movabs $0xc41000,%rax
+  804577:	00 00 00 
+  80457a:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  80457e:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  804583:	48 89 ce             	mov    %rcx,%rsi
+  804586:	48 b8 9d 0e 80 00 00 	movabs $0x800e9d,%rax
+  80458d:	00 00 00 
+  804590:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  804592:	48 b8 48 10 c4 00 00 	movabs $0xc41048,%rax
+  804599:	00 00 00 
+  80459c:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  8045a0:	5d                   	pop    %rbp
+  8045a1:	c3                   	ret
+
+00000000008045a2 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  8045a2:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  8045a5:	48 b8 20 43 80 00 00 	movabs $0x804320,%rax
+  8045ac:	00 00 00 
+    call *%rax
+  8045af:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  8045b1:	41 5f                	pop    %r15
+	popq %r15
+  8045b3:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  8045b5:	41 5f                	pop    %r15
+	popq %r14
+  8045b7:	41 5e                	pop    %r14
+	popq %r13
+  8045b9:	41 5d                	pop    %r13
+	popq %r12
+  8045bb:	41 5c                	pop    %r12
+	popq %r11
+  8045bd:	41 5b                	pop    %r11
+	popq %r10
+  8045bf:	41 5a                	pop    %r10
+	popq %r9
+  8045c1:	41 59                	pop    %r9
+	popq %r8
+  8045c3:	41 58                	pop    %r8
+	popq %rsi
+  8045c5:	5e                   	pop    %rsi
+	popq %rdi
+  8045c6:	5f                   	pop    %rdi
+	popq %rbp
+  8045c7:	5d                   	pop    %rbp
+	popq %rdx
+  8045c8:	5a                   	pop    %rdx
+	popq %rcx
+  8045c9:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  8045ca:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  8045cf:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  8045d4:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  8045d8:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  8045db:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  8045e0:	5b                   	pop    %rbx
+	popq %rax
+  8045e1:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  8045e2:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  8045e6:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  8045e7:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  8045ec:	c3                   	ret
+
+00000000008045ed <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8045ed:	55                   	push   %rbp
+  8045ee:	48 89 e5             	mov    %rsp,%rbp
+  8045f1:	41 55                	push   %r13
+  8045f3:	41 54                	push   %r12
+  8045f5:	53                   	push   %rbx
+  8045f6:	48 83 ec 08          	sub    $0x8,%rsp
+  8045fa:	49 89 fd             	mov    %rdi,%r13
+  8045fd:	48 89 f7             	mov    %rsi,%rdi
+  804600:	48 89 d3             	mov    %rdx,%rbx
+  804603:	49 89 cc             	mov    %rcx,%r12
+  804606:	4c 89 c2             	mov    %r8,%rdx
+  804609:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80460c:	48 85 f6             	test   %rsi,%rsi
+  80460f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804616:	00 00 00 
+  804619:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  80461d:	be 00 10 00 00       	mov    $0x1000,%esi
+  804622:	48 85 db             	test   %rbx,%rbx
+  804625:	74 03                	je     80462a <ipc_recv_futex+0x3d>
+  804627:	48 8b 33             	mov    (%rbx),%rsi
+  80462a:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  80462e:	48 b8 4c 14 80 00 00 	movabs $0x80144c,%rax
+  804635:	00 00 00 
+  804638:	ff d0                	call   *%rax
+    if (res < 0) {
+  80463a:	85 c0                	test   %eax,%eax
+  80463c:	78 75                	js     8046b3 <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  80463e:	4d 85 ed             	test   %r13,%r13
+  804641:	74 14                	je     804657 <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  804643:	48 a1 00 00 c1 00 00 	movabs 0xc10000,%rax
+  80464a:	00 00 00 
+  80464d:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  804653:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  804657:	4d 85 e4             	test   %r12,%r12
+  80465a:	74 14                	je     804670 <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  80465c:	48 a1 00 00 c1 00 00 	movabs 0xc10000,%rax
+  804663:	00 00 00 
+  804666:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  80466c:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  804670:	48 85 db             	test   %rbx,%rbx
+  804673:	74 23                	je     804698 <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804675:	48 a1 00 00 c1 00 00 	movabs 0xc10000,%rax
+  80467c:	00 00 00 
+  80467f:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  804685:	ba 00 00 00 00       	mov    $0x0,%edx
+  80468a:	85 c9                	test   %ecx,%ecx
+  80468c:	74 07                	je     804695 <ipc_recv_futex+0xa8>
+  80468e:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  804695:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  804698:	48 a1 00 00 c1 00 00 	movabs 0xc10000,%rax
+  80469f:	00 00 00 
+  8046a2:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  8046a8:	48 83 c4 08          	add    $0x8,%rsp
+  8046ac:	5b                   	pop    %rbx
+  8046ad:	41 5c                	pop    %r12
+  8046af:	41 5d                	pop    %r13
+  8046b1:	5d                   	pop    %rbp
+  8046b2:	c3                   	ret
+        if (from_env_store != NULL) {
+  8046b3:	4d 85 ed             	test   %r13,%r13
+  8046b6:	74 08                	je     8046c0 <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  8046b8:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8046bf:	00 
+        if (perm_store != NULL) {
+  8046c0:	4d 85 e4             	test   %r12,%r12
+  8046c3:	74 08                	je     8046cd <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  8046c5:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8046cc:	00 
+        if (size != NULL) {
+  8046cd:	48 85 db             	test   %rbx,%rbx
+  8046d0:	74 d6                	je     8046a8 <ipc_recv_futex+0xbb>
+            *size = 0;
+  8046d2:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  8046d9:	eb cd                	jmp    8046a8 <ipc_recv_futex+0xbb>
+
+00000000008046db <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8046db:	55                   	push   %rbp
+  8046dc:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  8046df:	48 83 ec 08          	sub    $0x8,%rsp
+  8046e3:	6a 00                	push   $0x0
+  8046e5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8046eb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8046f1:	48 b8 ed 45 80 00 00 	movabs $0x8045ed,%rax
+  8046f8:	00 00 00 
+  8046fb:	ff d0                	call   *%rax
+}
+  8046fd:	c9                   	leave
+  8046fe:	c3                   	ret
+
+00000000008046ff <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8046ff:	55                   	push   %rbp
+  804700:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804703:	48 85 d2             	test   %rdx,%rdx
+  804706:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80470d:	00 00 00 
+  804710:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  804714:	89 f6                	mov    %esi,%esi
+  804716:	48 b8 35 14 80 00 00 	movabs $0x801435,%rax
+  80471d:	00 00 00 
+  804720:	ff d0                	call   *%rax
+    if (res < 0) {
+  804722:	85 c0                	test   %eax,%eax
+  804724:	78 02                	js     804728 <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  804726:	5d                   	pop    %rbp
+  804727:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  804728:	89 c1                	mov    %eax,%ecx
+  80472a:	48 ba b0 4f 80 00 00 	movabs $0x804fb0,%rdx
+  804731:	00 00 00 
+  804734:	be 50 00 00 00       	mov    $0x50,%esi
+  804739:	48 bf c4 4f 80 00 00 	movabs $0x804fc4,%rdi
+  804740:	00 00 00 
+  804743:	b8 00 00 00 00       	mov    $0x0,%eax
+  804748:	49 b8 2e 02 80 00 00 	movabs $0x80022e,%r8
+  80474f:	00 00 00 
+  804752:	41 ff d0             	call   *%r8
+
+0000000000804755 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804755:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  80475a:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804761:	00 00 00 
+  804764:	48 89 d0             	mov    %rdx,%rax
+  804767:	48 c1 e0 04          	shl    $0x4,%rax
+  80476b:	48 29 d0             	sub    %rdx,%rax
+  80476e:	48 c1 e0 05          	shl    $0x5,%rax
+  804772:	48 01 c8             	add    %rcx,%rax
+  804775:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  80477b:	39 f8                	cmp    %edi,%eax
+  80477d:	74 13                	je     804792 <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  80477f:	48 83 c2 01          	add    $0x1,%rdx
+  804783:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  80478a:	75 d8                	jne    804764 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80478c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804791:	c3                   	ret
+            return envs[i].env_id;
+  804792:	48 89 d0             	mov    %rdx,%rax
+  804795:	48 c1 e0 04          	shl    $0x4,%rax
+  804799:	48 29 d0             	sub    %rdx,%rax
+  80479c:	48 c1 e0 05          	shl    $0x5,%rax
+  8047a0:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8047a7:	00 00 00 
+  8047aa:	48 01 d0             	add    %rdx,%rax
+  8047ad:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8047b3:	c3                   	ret
+  8047b4:	0f 1f 40 00          	nopl   0x0(%rax)
+
+00000000008047b8 <__rodata_start>:
+  8047b8:	4d 61                	rex.WRB (bad)
+  8047ba:	6b 69 6e 67          	imul   $0x67,0x6e(%rcx),%ebp
+  8047be:	20 73 75             	and    %dh,0x75(%rbx)
+  8047c1:	72 65                	jb     804828 <__rodata_start+0x70>
+  8047c3:	20 62 73             	and    %ah,0x73(%rdx)
+  8047c6:	73 20                	jae    8047e8 <__rodata_start+0x30>
+  8047c8:	77 6f                	ja     804839 <__rodata_start+0x81>
+  8047ca:	72 6b                	jb     804837 <__rodata_start+0x7f>
+  8047cc:	73 20                	jae    8047ee <__rodata_start+0x36>
+  8047ce:	72 69                	jb     804839 <__rodata_start+0x81>
+  8047d0:	67 68 74 2e 2e 2e    	addr32 push $0x2e2e2e74
+  8047d6:	0a 00                	or     (%rax),%al
+  8047d8:	62                   	(bad)
+  8047d9:	69 67 61 72 72 61 79 	imul   $0x79617272,0x61(%rdi),%esp
+  8047e0:	5b                   	pop    %rbx
+  8047e1:	25 64 5d 20 64       	and    $0x64205d64,%eax
+  8047e6:	69 64 6e 27 74 20 68 	imul   $0x6f682074,0x27(%rsi,%rbp,2),%esp
+  8047ed:	6f 
+  8047ee:	6c                   	insb   (%dx),%es:(%rdi)
+  8047ef:	64 20 69 74          	and    %ch,%fs:0x74(%rcx)
+  8047f3:	73 20                	jae    804815 <__rodata_start+0x5d>
+  8047f5:	76 61                	jbe    804858 <__rodata_start+0xa0>
+  8047f7:	6c                   	insb   (%dx),%es:(%rdi)
+  8047f8:	75 65                	jne    80485f <__rodata_start+0xa7>
+  8047fa:	21 0a                	and    %ecx,(%rdx)
+  8047fc:	00 00                	add    %al,(%rax)
+  8047fe:	00 00                	add    %al,(%rax)
+  804800:	59                   	pop    %rcx
+  804801:	65 73 2c             	gs jae 804830 <__rodata_start+0x78>
+  804804:	20 67 6f             	and    %ah,0x6f(%rdi)
+  804807:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804808:	64 2e 20 20          	fs and %ah,%fs:(%rax)
+  80480c:	4e 6f                	rex.WRX outsl %ds:(%rsi),(%dx)
+  80480e:	77 20                	ja     804830 <__rodata_start+0x78>
+  804810:	64 6f                	outsl  %fs:(%rsi),(%dx)
+  804812:	69 6e 67 20 61 20 77 	imul   $0x77206120,0x67(%rsi),%ebp
+  804819:	69 6c 64 20 77 72 69 	imul   $0x74697277,0x20(%rsp,%riz,2),%ebp
+  804820:	74 
+  804821:	65 20 6f 66          	and    %ch,%gs:0x66(%rdi)
+  804825:	66 20 74 68 65       	data16 and %dh,0x65(%rax,%rbp,2)
+  80482a:	20 65 6e             	and    %ah,0x6e(%rbp)
+  80482d:	64 2e 2e 2e 0a 00    	fs cs cs or %fs:(%rax),%al
+  804833:	62                   	(bad)
+  804834:	69 67 61 72 72 61 79 	imul   $0x79617272,0x61(%rdi),%esp
+  80483b:	5b                   	pop    %rbx
+  80483c:	25 64 5d 20 69       	and    $0x69205d64,%eax
+  804841:	73 6e                	jae    8048b1 <__rodata_start+0xf9>
+  804843:	27                   	(bad)
+  804844:	74 20                	je     804866 <__rodata_start+0xae>
+  804846:	63 6c 65 61          	movsxd 0x61(%rbp,%riz,2),%ebp
+  80484a:	72 65                	jb     8048b1 <__rodata_start+0xf9>
+  80484c:	64 21 0a             	and    %ecx,%fs:(%rdx)
+  80484f:	00 75 73             	add    %dh,0x73(%rbp)
+  804852:	65 72 2f             	gs jb  804884 <__rodata_start+0xcc>
+  804855:	74 65                	je     8048bc <__rodata_start+0x104>
+  804857:	73 74                	jae    8048cd <__rodata_start+0x115>
+  804859:	62 73                	(bad)
+  80485b:	73 2e                	jae    80488b <__rodata_start+0xd3>
+  80485d:	63 00                	movsxd (%rax),%eax
+  80485f:	53                   	push   %rbx
+  804860:	48                   	rex.W
+  804861:	4f 55                	rex.WRXB push %r13
+  804863:	4c                   	rex.WR
+  804864:	44 20 48 41          	and    %r9b,0x41(%rax)
+  804868:	56                   	push   %rsi
+  804869:	45 20 54 52 41       	and    %r10b,0x41(%r10,%rdx,2)
+  80486e:	50                   	push   %rax
+  80486f:	50                   	push   %rax
+  804870:	45                   	rex.RB
+  804871:	44 21 21             	and    %r12d,(%rcx)
+  804874:	21 00                	and    %eax,(%rax)
+  804876:	3c 75                	cmp    $0x75,%al
+  804878:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804879:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  80487d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80487e:	3e 00 5b 25          	ds add %bl,0x25(%rbx)
+  804882:	30 38                	xor    %bh,(%rax)
+  804884:	78 5d                	js     8048e3 <__rodata_start+0x12b>
+  804886:	20 75 73             	and    %dh,0x73(%rbp)
+  804889:	65 72 20             	gs jb  8048ac <__rodata_start+0xf4>
+  80488c:	70 61                	jo     8048ef <__rodata_start+0x137>
+  80488e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80488f:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  804896:	73 20                	jae    8048b8 <__rodata_start+0x100>
+  804898:	61                   	(bad)
+  804899:	74 20                	je     8048bb <__rodata_start+0x103>
+  80489b:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  8048a0:	3a 20                	cmp    (%rax),%ah
+  8048a2:	00 30                	add    %dh,(%rax)
+  8048a4:	31 32                	xor    %esi,(%rdx)
+  8048a6:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8048ad:	41                   	rex.B
+  8048ae:	42                   	rex.X
+  8048af:	43                   	rex.XB
+  8048b0:	44                   	rex.R
+  8048b1:	45                   	rex.RB
+  8048b2:	46 00 30             	rex.RX add %r14b,(%rax)
+  8048b5:	31 32                	xor    %esi,(%rdx)
+  8048b7:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8048be:	61                   	(bad)
+  8048bf:	62 63 64 65 66       	(bad)
+  8048c4:	00 28                	add    %ch,(%rax)
+  8048c6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8048c7:	75 6c                	jne    804935 <__rodata_start+0x17d>
+  8048c9:	6c                   	insb   (%dx),%es:(%rdi)
+  8048ca:	29 00                	sub    %eax,(%rax)
+  8048cc:	65 72 72             	gs jb  804941 <__rodata_start+0x189>
+  8048cf:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8048d0:	72 20                	jb     8048f2 <__rodata_start+0x13a>
+  8048d2:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  8048d7:	73 70                	jae    804949 <__rodata_start+0x191>
+  8048d9:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  8048dd:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  8048e4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8048e5:	72 00                	jb     8048e7 <__rodata_start+0x12f>
+  8048e7:	62 61 64 20 65       	(bad)
+  8048ec:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8048ed:	76 69                	jbe    804958 <__rodata_start+0x1a0>
+  8048ef:	72 6f                	jb     804960 <__rodata_start+0x1a8>
+  8048f1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8048f2:	6d                   	insl   (%dx),%es:(%rdi)
+  8048f3:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8048f5:	74 00                	je     8048f7 <__rodata_start+0x13f>
+  8048f7:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8048fe:	20 70 61             	and    %dh,0x61(%rax)
+  804901:	72 61                	jb     804964 <__rodata_start+0x1ac>
+  804903:	6d                   	insl   (%dx),%es:(%rdi)
+  804904:	65 74 65             	gs je  80496c <__rodata_start+0x1b4>
+  804907:	72 00                	jb     804909 <__rodata_start+0x151>
+  804909:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80490a:	75 74                	jne    804980 <__rodata_start+0x1c8>
+  80490c:	20 6f 66             	and    %ch,0x66(%rdi)
+  80490f:	20 6d 65             	and    %ch,0x65(%rbp)
+  804912:	6d                   	insl   (%dx),%es:(%rdi)
+  804913:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804914:	72 79                	jb     80498f <__rodata_start+0x1d7>
+  804916:	00 6f 75             	add    %ch,0x75(%rdi)
+  804919:	74 20                	je     80493b <__rodata_start+0x183>
+  80491b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80491c:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  804920:	76 69                	jbe    80498b <__rodata_start+0x1d3>
+  804922:	72 6f                	jb     804993 <__rodata_start+0x1db>
+  804924:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804925:	6d                   	insl   (%dx),%es:(%rdi)
+  804926:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804928:	74 73                	je     80499d <__rodata_start+0x1e5>
+  80492a:	00 63 6f             	add    %ah,0x6f(%rbx)
+  80492d:	72 72                	jb     8049a1 <__rodata_start+0x1e9>
+  80492f:	75 70                	jne    8049a1 <__rodata_start+0x1e9>
+  804931:	74 65                	je     804998 <__rodata_start+0x1e0>
+  804933:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  804938:	75 67                	jne    8049a1 <__rodata_start+0x1e9>
+  80493a:	20 69 6e             	and    %ch,0x6e(%rcx)
+  80493d:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80493f:	00 73 65             	add    %dh,0x65(%rbx)
+  804942:	67 6d                	insl   (%dx),%es:(%edi)
+  804944:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804946:	74 61                	je     8049a9 <__rodata_start+0x1f1>
+  804948:	74 69                	je     8049b3 <__rodata_start+0x1fb>
+  80494a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80494b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80494c:	20 66 61             	and    %ah,0x61(%rsi)
+  80494f:	75 6c                	jne    8049bd <__rodata_start+0x205>
+  804951:	74 00                	je     804953 <__rodata_start+0x19b>
+  804953:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80495a:	20 45 4c             	and    %al,0x4c(%rbp)
+  80495d:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  804961:	61                   	(bad)
+  804962:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  804967:	20 73 75             	and    %dh,0x75(%rbx)
+  80496a:	63 68 20             	movsxd 0x20(%rax),%ebp
+  80496d:	73 79                	jae    8049e8 <__rodata_start+0x230>
+  80496f:	73 74                	jae    8049e5 <__rodata_start+0x22d>
+  804971:	65 6d                	gs insl (%dx),%es:(%rdi)
+  804973:	20 63 61             	and    %ah,0x61(%rbx)
+  804976:	6c                   	insb   (%dx),%es:(%rdi)
+  804977:	6c                   	insb   (%dx),%es:(%rdi)
+  804978:	00 65 6e             	add    %ah,0x6e(%rbp)
+  80497b:	74 72                	je     8049ef <__rodata_start+0x237>
+  80497d:	79 20                	jns    80499f <__rodata_start+0x1e7>
+  80497f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804980:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804981:	74 20                	je     8049a3 <__rodata_start+0x1eb>
+  804983:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804985:	75 6e                	jne    8049f5 <__rodata_start+0x23d>
+  804987:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  80498b:	76 20                	jbe    8049ad <__rodata_start+0x1f5>
+  80498d:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  804994:	72 65                	jb     8049fb <__rodata_start+0x243>
+  804996:	63 76 69             	movsxd 0x69(%rsi),%esi
+  804999:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80499a:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  80499e:	65 78 70             	gs js  804a11 <__rodata_start+0x259>
+  8049a1:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  8049a6:	20 65 6e             	and    %ah,0x6e(%rbp)
+  8049a9:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  8049ad:	20 66 69             	and    %ah,0x69(%rsi)
+  8049b0:	6c                   	insb   (%dx),%es:(%rdi)
+  8049b1:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  8049b5:	20 66 72             	and    %ah,0x72(%rsi)
+  8049b8:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  8049bd:	61                   	(bad)
+  8049be:	63 65 20             	movsxd 0x20(%rbp),%esp
+  8049c1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8049c2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8049c3:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  8049c7:	6b 00 74             	imul   $0x74,(%rax),%eax
+  8049ca:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8049cb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8049cc:	20 6d 61             	and    %ch,0x61(%rbp)
+  8049cf:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8049d0:	79 20                	jns    8049f2 <__rodata_start+0x23a>
+  8049d2:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  8049d9:	72 65                	jb     804a40 <__rodata_start+0x288>
+  8049db:	20 6f 70             	and    %ch,0x70(%rdi)
+  8049de:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8049e0:	00 66 69             	add    %ah,0x69(%rsi)
+  8049e3:	6c                   	insb   (%dx),%es:(%rdi)
+  8049e4:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  8049e8:	20 62 6c             	and    %ah,0x6c(%rdx)
+  8049eb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8049ec:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  8049ef:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8049f0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8049f1:	74 20                	je     804a13 <__rodata_start+0x25b>
+  8049f3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8049f5:	75 6e                	jne    804a65 <__rodata_start+0x2ad>
+  8049f7:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  8049fb:	76 61                	jbe    804a5e <__rodata_start+0x2a6>
+  8049fd:	6c                   	insb   (%dx),%es:(%rdi)
+  8049fe:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  804a05:	00 
+  804a06:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  804a0d:	72 65                	jb     804a74 <__rodata_start+0x2bc>
+  804a0f:	61                   	(bad)
+  804a10:	64 79 20             	fs jns 804a33 <__rodata_start+0x27b>
+  804a13:	65 78 69             	gs js  804a7f <__rodata_start+0x2c7>
+  804a16:	73 74                	jae    804a8c <__rodata_start+0x2d4>
+  804a18:	73 00                	jae    804a1a <__rodata_start+0x262>
+  804a1a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a1b:	70 65                	jo     804a82 <__rodata_start+0x2ca>
+  804a1d:	72 61                	jb     804a80 <__rodata_start+0x2c8>
+  804a1f:	74 69                	je     804a8a <__rodata_start+0x2d2>
+  804a21:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a22:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a23:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  804a26:	74 20                	je     804a48 <__rodata_start+0x290>
+  804a28:	73 75                	jae    804a9f <__rodata_start+0x2e7>
+  804a2a:	70 70                	jo     804a9c <__rodata_start+0x2e4>
+  804a2c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a2d:	72 74                	jb     804aa3 <__rodata_start+0x2eb>
+  804a2f:	65 64 00 74 72 79    	gs add %dh,%fs:0x79(%rdx,%rsi,2)
+  804a35:	20 61 67             	and    %ah,0x67(%rcx)
+  804a38:	61                   	(bad)
+  804a39:	69 6e 00 74 69 6d 65 	imul   $0x656d6974,0x0(%rsi),%ebp
+  804a40:	64 20 6f 75          	and    %ch,%fs:0x75(%rdi)
+  804a44:	74 00                	je     804a46 <__rodata_start+0x28e>
+  804a46:	66 69 6c 65 20 69 73 	imul   $0x7369,0x20(%rbp,%riz,2),%bp
+  804a4d:	20 69 6e             	and    %ch,0x6e(%rcx)
+  804a50:	20 75 73             	and    %dh,0x73(%rbp)
+  804a53:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  804a57:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  804a5e:	00 
+  804a5f:	90                   	nop
+  804a60:	6b 05 80 00 00 00 00 	imul   $0x0,0x80(%rip),%eax        # 804ae7 <__rodata_start+0x32f>
+  804a67:	00 ac 0b 80 00 00 00 	add    %ch,0x80(%rbx,%rcx,1)
+  804a6e:	00 00                	add    %al,(%rax)
+  804a70:	9c                   	pushf
+  804a71:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804a77:	00 ac 0b 80 00 00 00 	add    %ch,0x80(%rbx,%rcx,1)
+  804a7e:	00 00                	add    %al,(%rax)
+  804a80:	ac                   	lods   %ds:(%rsi),%al
+  804a81:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804a87:	00 ac 0b 80 00 00 00 	add    %ch,0x80(%rbx,%rcx,1)
+  804a8e:	00 00                	add    %al,(%rax)
+  804a90:	ac                   	lods   %ds:(%rsi),%al
+  804a91:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804a97:	00 8a 05 80 00 00    	add    %cl,0x8005(%rdx)
+  804a9d:	00 00                	add    %al,(%rax)
+  804a9f:	00 ac 0b 80 00 00 00 	add    %ch,0x80(%rbx,%rcx,1)
+  804aa6:	00 00                	add    %al,(%rax)
+  804aa8:	ac                   	lods   %ds:(%rsi),%al
+  804aa9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804aaf:	00 7e 05             	add    %bh,0x5(%rsi)
+  804ab2:	80 00 00             	addb   $0x0,(%rax)
+  804ab5:	00 00                	add    %al,(%rax)
+  804ab7:	00 f8                	add    %bh,%al
+  804ab9:	05 80 00 00 00       	add    $0x80,%eax
+  804abe:	00 00                	add    %al,(%rax)
+  804ac0:	ac                   	lods   %ds:(%rsi),%al
+  804ac1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804ac7:	00 7e 05             	add    %bh,0x5(%rsi)
+  804aca:	80 00 00             	addb   $0x0,(%rax)
+  804acd:	00 00                	add    %al,(%rax)
+  804acf:	00 c4                	add    %al,%ah
+  804ad1:	05 80 00 00 00       	add    $0x80,%eax
+  804ad6:	00 00                	add    %al,(%rax)
+  804ad8:	c4                   	(bad)
+  804ad9:	05 80 00 00 00       	add    $0x80,%eax
+  804ade:	00 00                	add    %al,(%rax)
+  804ae0:	c4                   	(bad)
+  804ae1:	05 80 00 00 00       	add    $0x80,%eax
+  804ae6:	00 00                	add    %al,(%rax)
+  804ae8:	c4                   	(bad)
+  804ae9:	05 80 00 00 00       	add    $0x80,%eax
+  804aee:	00 00                	add    %al,(%rax)
+  804af0:	c4                   	(bad)
+  804af1:	05 80 00 00 00       	add    $0x80,%eax
+  804af6:	00 00                	add    %al,(%rax)
+  804af8:	c4                   	(bad)
+  804af9:	05 80 00 00 00       	add    $0x80,%eax
+  804afe:	00 00                	add    %al,(%rax)
+  804b00:	c4                   	(bad)
+  804b01:	05 80 00 00 00       	add    $0x80,%eax
+  804b06:	00 00                	add    %al,(%rax)
+  804b08:	c4                   	(bad)
+  804b09:	05 80 00 00 00       	add    $0x80,%eax
+  804b0e:	00 00                	add    %al,(%rax)
+  804b10:	c4                   	(bad)
+  804b11:	05 80 00 00 00       	add    $0x80,%eax
+  804b16:	00 00                	add    %al,(%rax)
+  804b18:	ac                   	lods   %ds:(%rsi),%al
+  804b19:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804b1f:	00 ac 0b 80 00 00 00 	add    %ch,0x80(%rbx,%rcx,1)
+  804b26:	00 00                	add    %al,(%rax)
+  804b28:	ac                   	lods   %ds:(%rsi),%al
+  804b29:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804b2f:	00 ac 0b 80 00 00 00 	add    %ch,0x80(%rbx,%rcx,1)
+  804b36:	00 00                	add    %al,(%rax)
+  804b38:	ac                   	lods   %ds:(%rsi),%al
+  804b39:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804b3f:	00 ac 0b 80 00 00 00 	add    %ch,0x80(%rbx,%rcx,1)
+  804b46:	00 00                	add    %al,(%rax)
+  804b48:	ac                   	lods   %ds:(%rsi),%al
+  804b49:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804b4f:	00 ac 0b 80 00 00 00 	add    %ch,0x80(%rbx,%rcx,1)
+  804b56:	00 00                	add    %al,(%rax)
+  804b58:	ac                   	lods   %ds:(%rsi),%al
+  804b59:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804b5f:	00 ac 0b 80 00 00 00 	add    %ch,0x80(%rbx,%rcx,1)
+  804b66:	00 00                	add    %al,(%rax)
+  804b68:	ac                   	lods   %ds:(%rsi),%al
+  804b69:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804b6f:	00 ac 0b 80 00 00 00 	add    %ch,0x80(%rbx,%rcx,1)
+  804b76:	00 00                	add    %al,(%rax)
+  804b78:	ac                   	lods   %ds:(%rsi),%al
+  804b79:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804b7f:	00 ac 0b 80 00 00 00 	add    %ch,0x80(%rbx,%rcx,1)
+  804b86:	00 00                	add    %al,(%rax)
+  804b88:	ac                   	lods   %ds:(%rsi),%al
+  804b89:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804b8f:	00 ac 0b 80 00 00 00 	add    %ch,0x80(%rbx,%rcx,1)
+  804b96:	00 00                	add    %al,(%rax)
+  804b98:	ac                   	lods   %ds:(%rsi),%al
+  804b99:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804b9f:	00 ac 0b 80 00 00 00 	add    %ch,0x80(%rbx,%rcx,1)
+  804ba6:	00 00                	add    %al,(%rax)
+  804ba8:	ac                   	lods   %ds:(%rsi),%al
+  804ba9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804baf:	00 ac 0b 80 00 00 00 	add    %ch,0x80(%rbx,%rcx,1)
+  804bb6:	00 00                	add    %al,(%rax)
+  804bb8:	ac                   	lods   %ds:(%rsi),%al
+  804bb9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804bbf:	00 ac 0b 80 00 00 00 	add    %ch,0x80(%rbx,%rcx,1)
+  804bc6:	00 00                	add    %al,(%rax)
+  804bc8:	ac                   	lods   %ds:(%rsi),%al
+  804bc9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804bcf:	00 ac 0b 80 00 00 00 	add    %ch,0x80(%rbx,%rcx,1)
+  804bd6:	00 00                	add    %al,(%rax)
+  804bd8:	ac                   	lods   %ds:(%rsi),%al
+  804bd9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804bdf:	00 ac 0b 80 00 00 00 	add    %ch,0x80(%rbx,%rcx,1)
+  804be6:	00 00                	add    %al,(%rax)
+  804be8:	ac                   	lods   %ds:(%rsi),%al
+  804be9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804bef:	00 ac 0b 80 00 00 00 	add    %ch,0x80(%rbx,%rcx,1)
+  804bf6:	00 00                	add    %al,(%rax)
+  804bf8:	ac                   	lods   %ds:(%rsi),%al
+  804bf9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804bff:	00 ac 0b 80 00 00 00 	add    %ch,0x80(%rbx,%rcx,1)
+  804c06:	00 00                	add    %al,(%rax)
+  804c08:	cf                   	iret
+  804c09:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c0f:	00 ac 0b 80 00 00 00 	add    %ch,0x80(%rbx,%rcx,1)
+  804c16:	00 00                	add    %al,(%rax)
+  804c18:	ac                   	lods   %ds:(%rsi),%al
+  804c19:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804c1f:	00 ac 0b 80 00 00 00 	add    %ch,0x80(%rbx,%rcx,1)
+  804c26:	00 00                	add    %al,(%rax)
+  804c28:	ac                   	lods   %ds:(%rsi),%al
+  804c29:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804c2f:	00 ac 0b 80 00 00 00 	add    %ch,0x80(%rbx,%rcx,1)
+  804c36:	00 00                	add    %al,(%rax)
+  804c38:	ac                   	lods   %ds:(%rsi),%al
+  804c39:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804c3f:	00 ac 0b 80 00 00 00 	add    %ch,0x80(%rbx,%rcx,1)
+  804c46:	00 00                	add    %al,(%rax)
+  804c48:	ac                   	lods   %ds:(%rsi),%al
+  804c49:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804c4f:	00 ac 0b 80 00 00 00 	add    %ch,0x80(%rbx,%rcx,1)
+  804c56:	00 00                	add    %al,(%rax)
+  804c58:	ac                   	lods   %ds:(%rsi),%al
+  804c59:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804c5f:	00 1b                	add    %bl,(%rbx)
+  804c61:	06                   	(bad)
+  804c62:	80 00 00             	addb   $0x0,(%rax)
+  804c65:	00 00                	add    %al,(%rax)
+  804c67:	00 ea                	add    %ch,%dl
+  804c69:	07                   	(bad)
+  804c6a:	80 00 00             	addb   $0x0,(%rax)
+  804c6d:	00 00                	add    %al,(%rax)
+  804c6f:	00 ac 0b 80 00 00 00 	add    %ch,0x80(%rbx,%rcx,1)
+  804c76:	00 00                	add    %al,(%rax)
+  804c78:	ac                   	lods   %ds:(%rsi),%al
+  804c79:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804c7f:	00 ac 0b 80 00 00 00 	add    %ch,0x80(%rbx,%rcx,1)
+  804c86:	00 00                	add    %al,(%rax)
+  804c88:	ac                   	lods   %ds:(%rsi),%al
+  804c89:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804c8f:	00 4a 06             	add    %cl,0x6(%rdx)
+  804c92:	80 00 00             	addb   $0x0,(%rax)
+  804c95:	00 00                	add    %al,(%rax)
+  804c97:	00 ac 0b 80 00 00 00 	add    %ch,0x80(%rbx,%rcx,1)
+  804c9e:	00 00                	add    %al,(%rax)
+  804ca0:	ac                   	lods   %ds:(%rsi),%al
+  804ca1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804ca7:	00 10                	add    %dl,(%rax)
+  804ca9:	06                   	(bad)
+  804caa:	80 00 00             	addb   $0x0,(%rax)
+  804cad:	00 00                	add    %al,(%rax)
+  804caf:	00 ac 0b 80 00 00 00 	add    %ch,0x80(%rbx,%rcx,1)
+  804cb6:	00 00                	add    %al,(%rax)
+  804cb8:	ac                   	lods   %ds:(%rsi),%al
+  804cb9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804cbf:	00 92 09 80 00 00    	add    %dl,0x8009(%rdx)
+  804cc5:	00 00                	add    %al,(%rax)
+  804cc7:	00 5c 0a 80          	add    %bl,-0x80(%rdx,%rcx,1)
+  804ccb:	00 00                	add    %al,(%rax)
+  804ccd:	00 00                	add    %al,(%rax)
+  804ccf:	00 ac 0b 80 00 00 00 	add    %ch,0x80(%rbx,%rcx,1)
+  804cd6:	00 00                	add    %al,(%rax)
+  804cd8:	ac                   	lods   %ds:(%rsi),%al
+  804cd9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804cdf:	00 e1                	add    %ah,%cl
+  804ce1:	06                   	(bad)
+  804ce2:	80 00 00             	addb   $0x0,(%rax)
+  804ce5:	00 00                	add    %al,(%rax)
+  804ce7:	00 ac 0b 80 00 00 00 	add    %ch,0x80(%rbx,%rcx,1)
+  804cee:	00 00                	add    %al,(%rax)
+  804cf0:	be 08 80 00 00       	mov    $0x8008,%esi
+  804cf5:	00 00                	add    %al,(%rax)
+  804cf7:	00 ac 0b 80 00 00 00 	add    %ch,0x80(%rbx,%rcx,1)
+  804cfe:	00 00                	add    %al,(%rax)
+  804d00:	ac                   	lods   %ds:(%rsi),%al
+  804d01:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804d07:	00 cf                	add    %cl,%bh
+  804d09:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804d0f:	00 ac 0b 80 00 00 00 	add    %ch,0x80(%rbx,%rcx,1)
+  804d16:	00 00                	add    %al,(%rax)
+  804d18:	74 05                	je     804d1f <__rodata_start+0x567>
+  804d1a:	80 00 00             	addb   $0x0,(%rax)
+  804d1d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000804d20 <error_string>:
+	...
+  804d28:	d5 48 80 00 00 00 00 00 e7 48 80 00 00 00 00 00     .H.......H......
+  804d38:	f7 48 80 00 00 00 00 00 09 49 80 00 00 00 00 00     .H.......I......
+  804d48:	17 49 80 00 00 00 00 00 2b 49 80 00 00 00 00 00     .I......+I......
+  804d58:	40 49 80 00 00 00 00 00 53 49 80 00 00 00 00 00     @I......SI......
+  804d68:	65 49 80 00 00 00 00 00 79 49 80 00 00 00 00 00     eI......yI......
+  804d78:	89 49 80 00 00 00 00 00 9c 49 80 00 00 00 00 00     .I.......I......
+  804d88:	b3 49 80 00 00 00 00 00 c9 49 80 00 00 00 00 00     .I.......I......
+  804d98:	e1 49 80 00 00 00 00 00 f9 49 80 00 00 00 00 00     .I.......I......
+  804da8:	06 4a 80 00 00 00 00 00 d8 4d 80 00 00 00 00 00     .J.......M......
+  804db8:	1a 4a 80 00 00 00 00 00 32 4a 80 00 00 00 00 00     .J......2J......
+  804dc8:	3c 4a 80 00 00 00 00 00 46 4a 80 00 00 00 00 00     <J......FJ......
+  804dd8:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  804de8:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  804df8:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  804e08:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  804e18:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  804e28:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  804e38:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  804e48:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  804e58:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  804e68:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  804e78:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  804e88:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  804e98:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  804ea8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804eb8:	0f 1f 84 00 00 00 00 00                             ........
+
+0000000000804ec0 <devtab>:
+  804ec0:	20 50 80 00 00 00 00 00 60 50 80 00 00 00 00 00      P......`P......
+  804ed0:	a0 50 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .P..............
+  804ee0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  804ef0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  804f00:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  804f10:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  804f20:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  804f30:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  804f40:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  804f50:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  804f60:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  804f70:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  804f80:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  804f90:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  804fa0:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  804fb0:	69 70 63 5f 73 65 6e 64 20 65 72 72 6f 72 3a 20     ipc_send error: 
+  804fc0:	25 69 0a 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e     %i..lib/ipc.c.f.
+  804fd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804fe0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ff0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
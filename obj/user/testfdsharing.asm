@@ -0,0 +1,8908 @@
+
+obj/user/testfdsharing:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 cf 02 00 00       	call   8002f2 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+char buf[512], buf2[512];
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 56                	push   %r14
+  80002b:	41 55                	push   %r13
+  80002d:	41 54                	push   %r12
+  80002f:	53                   	push   %rbx
+    int fd, r, n, n2;
+
+    if ((fd = open("motd", O_RDONLY)) < 0)
+  800030:	be 00 00 00 00       	mov    $0x0,%esi
+  800035:	48 bf 70 4b 80 00 00 	movabs $0x804b70,%rdi
+  80003c:	00 00 00 
+  80003f:	48 b8 42 31 80 00 00 	movabs $0x803142,%rax
+  800046:	00 00 00 
+  800049:	ff d0                	call   *%rax
+  80004b:	89 c3                	mov    %eax,%ebx
+  80004d:	85 c0                	test   %eax,%eax
+  80004f:	0f 88 8a 01 00 00    	js     8001df <umain+0x1ba>
+        panic("open motd: %i", fd);
+    seek(fd, 0);
+  800055:	be 00 00 00 00       	mov    $0x0,%esi
+  80005a:	89 c7                	mov    %eax,%edi
+  80005c:	48 b8 48 1e 80 00 00 	movabs $0x801e48,%rax
+  800063:	00 00 00 
+  800066:	ff d0                	call   *%rax
+    if ((n = readn(fd, buf, sizeof buf)) <= 0)
+  800068:	ba 00 02 00 00       	mov    $0x200,%edx
+  80006d:	48 be 00 02 81 00 00 	movabs $0x810200,%rsi
+  800074:	00 00 00 
+  800077:	89 df                	mov    %ebx,%edi
+  800079:	48 b8 1e 1d 80 00 00 	movabs $0x801d1e,%rax
+  800080:	00 00 00 
+  800083:	ff d0                	call   *%rax
+  800085:	49 89 c4             	mov    %rax,%r12
+  800088:	41 89 c6             	mov    %eax,%r14d
+  80008b:	85 c0                	test   %eax,%eax
+  80008d:	0f 8e 79 01 00 00    	jle    80020c <umain+0x1e7>
+        panic("readn: %i", n);
+
+    if ((r = fork()) < 0)
+  800093:	48 b8 cf 17 80 00 00 	movabs $0x8017cf,%rax
+  80009a:	00 00 00 
+  80009d:	ff d0                	call   *%rax
+  80009f:	41 89 c5             	mov    %eax,%r13d
+  8000a2:	85 c0                	test   %eax,%eax
+  8000a4:	0f 88 8f 01 00 00    	js     800239 <umain+0x214>
+        panic("fork: %i", r);
+    if (r == 0) {
+  8000aa:	0f 85 c7 00 00 00    	jne    800177 <umain+0x152>
+        seek(fd, 0);
+  8000b0:	be 00 00 00 00       	mov    $0x0,%esi
+  8000b5:	89 df                	mov    %ebx,%edi
+  8000b7:	48 b8 48 1e 80 00 00 	movabs $0x801e48,%rax
+  8000be:	00 00 00 
+  8000c1:	ff d0                	call   *%rax
+        cprintf("going to read in child (might page fault if your sharing is buggy)\n");
+  8000c3:	48 bf e0 4b 80 00 00 	movabs $0x804be0,%rdi
+  8000ca:	00 00 00 
+  8000cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000d2:	48 ba 18 05 80 00 00 	movabs $0x800518,%rdx
+  8000d9:	00 00 00 
+  8000dc:	ff d2                	call   *%rdx
+        if ((n2 = readn(fd, buf2, sizeof buf2)) != n)
+  8000de:	ba 00 02 00 00       	mov    $0x200,%edx
+  8000e3:	48 be 00 00 81 00 00 	movabs $0x810000,%rsi
+  8000ea:	00 00 00 
+  8000ed:	89 df                	mov    %ebx,%edi
+  8000ef:	48 b8 1e 1d 80 00 00 	movabs $0x801d1e,%rax
+  8000f6:	00 00 00 
+  8000f9:	ff d0                	call   *%rax
+  8000fb:	41 39 c4             	cmp    %eax,%r12d
+  8000fe:	0f 85 62 01 00 00    	jne    800266 <umain+0x241>
+            panic("read in parent got %d, read in child got %d", n, n2);
+        if (memcmp(buf, buf2, n) != 0)
+  800104:	49 63 d4             	movslq %r12d,%rdx
+  800107:	48 be 00 00 81 00 00 	movabs $0x810000,%rsi
+  80010e:	00 00 00 
+  800111:	48 bf 00 02 81 00 00 	movabs $0x810200,%rdi
+  800118:	00 00 00 
+  80011b:	48 b8 56 11 80 00 00 	movabs $0x801156,%rax
+  800122:	00 00 00 
+  800125:	ff d0                	call   *%rax
+  800127:	85 c0                	test   %eax,%eax
+  800129:	0f 85 68 01 00 00    	jne    800297 <umain+0x272>
+            panic("read in parent got different bytes from read in child");
+        cprintf("read in child succeeded\n");
+  80012f:	48 bf ab 4b 80 00 00 	movabs $0x804bab,%rdi
+  800136:	00 00 00 
+  800139:	b8 00 00 00 00       	mov    $0x0,%eax
+  80013e:	48 ba 18 05 80 00 00 	movabs $0x800518,%rdx
+  800145:	00 00 00 
+  800148:	ff d2                	call   *%rdx
+        seek(fd, 0);
+  80014a:	be 00 00 00 00       	mov    $0x0,%esi
+  80014f:	89 df                	mov    %ebx,%edi
+  800151:	48 b8 48 1e 80 00 00 	movabs $0x801e48,%rax
+  800158:	00 00 00 
+  80015b:	ff d0                	call   *%rax
+        close(fd);
+  80015d:	89 df                	mov    %ebx,%edi
+  80015f:	48 b8 e2 1a 80 00 00 	movabs $0x801ae2,%rax
+  800166:	00 00 00 
+  800169:	ff d0                	call   *%rax
+        exit();
+  80016b:	48 b8 a5 03 80 00 00 	movabs $0x8003a5,%rax
+  800172:	00 00 00 
+  800175:	ff d0                	call   *%rax
+    }
+    wait(r);
+  800177:	44 89 ef             	mov    %r13d,%edi
+  80017a:	48 b8 f8 3f 80 00 00 	movabs $0x803ff8,%rax
+  800181:	00 00 00 
+  800184:	ff d0                	call   *%rax
+    if ((n2 = readn(fd, buf2, sizeof buf2)) != n)
+  800186:	ba 00 02 00 00       	mov    $0x200,%edx
+  80018b:	48 be 00 00 81 00 00 	movabs $0x810000,%rsi
+  800192:	00 00 00 
+  800195:	89 df                	mov    %ebx,%edi
+  800197:	48 b8 1e 1d 80 00 00 	movabs $0x801d1e,%rax
+  80019e:	00 00 00 
+  8001a1:	ff d0                	call   *%rax
+  8001a3:	41 39 c4             	cmp    %eax,%r12d
+  8001a6:	0f 85 15 01 00 00    	jne    8002c1 <umain+0x29c>
+        panic("read in parent got %d, then got %d", n, n2);
+    cprintf("read in parent succeeded\n");
+  8001ac:	48 bf c4 4b 80 00 00 	movabs $0x804bc4,%rdi
+  8001b3:	00 00 00 
+  8001b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001bb:	48 ba 18 05 80 00 00 	movabs $0x800518,%rdx
+  8001c2:	00 00 00 
+  8001c5:	ff d2                	call   *%rdx
+    close(fd);
+  8001c7:	89 df                	mov    %ebx,%edi
+  8001c9:	48 b8 e2 1a 80 00 00 	movabs $0x801ae2,%rax
+  8001d0:	00 00 00 
+  8001d3:	ff d0                	call   *%rax
+
+#include <inc/types.h>
+
+static inline void __attribute__((always_inline))
+breakpoint(void) {
+    asm volatile("int3");
+  8001d5:	cc                   	int3
+
+    breakpoint();
+}
+  8001d6:	5b                   	pop    %rbx
+  8001d7:	41 5c                	pop    %r12
+  8001d9:	41 5d                	pop    %r13
+  8001db:	41 5e                	pop    %r14
+  8001dd:	5d                   	pop    %rbp
+  8001de:	c3                   	ret
+        panic("open motd: %i", fd);
+  8001df:	89 c1                	mov    %eax,%ecx
+  8001e1:	48 ba 75 4b 80 00 00 	movabs $0x804b75,%rdx
+  8001e8:	00 00 00 
+  8001eb:	be 0b 00 00 00       	mov    $0xb,%esi
+  8001f0:	48 bf 83 4b 80 00 00 	movabs $0x804b83,%rdi
+  8001f7:	00 00 00 
+  8001fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001ff:	49 b8 c8 03 80 00 00 	movabs $0x8003c8,%r8
+  800206:	00 00 00 
+  800209:	41 ff d0             	call   *%r8
+        panic("readn: %i", n);
+  80020c:	89 c1                	mov    %eax,%ecx
+  80020e:	48 ba 98 4b 80 00 00 	movabs $0x804b98,%rdx
+  800215:	00 00 00 
+  800218:	be 0e 00 00 00       	mov    $0xe,%esi
+  80021d:	48 bf 83 4b 80 00 00 	movabs $0x804b83,%rdi
+  800224:	00 00 00 
+  800227:	b8 00 00 00 00       	mov    $0x0,%eax
+  80022c:	49 b8 c8 03 80 00 00 	movabs $0x8003c8,%r8
+  800233:	00 00 00 
+  800236:	41 ff d0             	call   *%r8
+        panic("fork: %i", r);
+  800239:	89 c1                	mov    %eax,%ecx
+  80023b:	48 ba a2 4b 80 00 00 	movabs $0x804ba2,%rdx
+  800242:	00 00 00 
+  800245:	be 11 00 00 00       	mov    $0x11,%esi
+  80024a:	48 bf 83 4b 80 00 00 	movabs $0x804b83,%rdi
+  800251:	00 00 00 
+  800254:	b8 00 00 00 00       	mov    $0x0,%eax
+  800259:	49 b8 c8 03 80 00 00 	movabs $0x8003c8,%r8
+  800260:	00 00 00 
+  800263:	41 ff d0             	call   *%r8
+            panic("read in parent got %d, read in child got %d", n, n2);
+  800266:	41 89 c0             	mov    %eax,%r8d
+  800269:	44 89 e1             	mov    %r12d,%ecx
+  80026c:	48 ba 28 4c 80 00 00 	movabs $0x804c28,%rdx
+  800273:	00 00 00 
+  800276:	be 16 00 00 00       	mov    $0x16,%esi
+  80027b:	48 bf 83 4b 80 00 00 	movabs $0x804b83,%rdi
+  800282:	00 00 00 
+  800285:	b8 00 00 00 00       	mov    $0x0,%eax
+  80028a:	49 b9 c8 03 80 00 00 	movabs $0x8003c8,%r9
+  800291:	00 00 00 
+  800294:	41 ff d1             	call   *%r9
+            panic("read in parent got different bytes from read in child");
+  800297:	48 ba 58 4c 80 00 00 	movabs $0x804c58,%rdx
+  80029e:	00 00 00 
+  8002a1:	be 18 00 00 00       	mov    $0x18,%esi
+  8002a6:	48 bf 83 4b 80 00 00 	movabs $0x804b83,%rdi
+  8002ad:	00 00 00 
+  8002b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002b5:	48 b9 c8 03 80 00 00 	movabs $0x8003c8,%rcx
+  8002bc:	00 00 00 
+  8002bf:	ff d1                	call   *%rcx
+        panic("read in parent got %d, then got %d", n, n2);
+  8002c1:	41 89 c0             	mov    %eax,%r8d
+  8002c4:	44 89 f1             	mov    %r14d,%ecx
+  8002c7:	48 ba 90 4c 80 00 00 	movabs $0x804c90,%rdx
+  8002ce:	00 00 00 
+  8002d1:	be 20 00 00 00       	mov    $0x20,%esi
+  8002d6:	48 bf 83 4b 80 00 00 	movabs $0x804b83,%rdi
+  8002dd:	00 00 00 
+  8002e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002e5:	49 b9 c8 03 80 00 00 	movabs $0x8003c8,%r9
+  8002ec:	00 00 00 
+  8002ef:	41 ff d1             	call   *%r9
+
+00000000008002f2 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8002f2:	55                   	push   %rbp
+  8002f3:	48 89 e5             	mov    %rsp,%rbp
+  8002f6:	41 56                	push   %r14
+  8002f8:	41 55                	push   %r13
+  8002fa:	41 54                	push   %r12
+  8002fc:	53                   	push   %rbx
+  8002fd:	41 89 fd             	mov    %edi,%r13d
+  800300:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800303:	48 ba e0 60 80 00 00 	movabs $0x8060e0,%rdx
+  80030a:	00 00 00 
+  80030d:	48 b8 e0 60 80 00 00 	movabs $0x8060e0,%rax
+  800314:	00 00 00 
+  800317:	48 39 c2             	cmp    %rax,%rdx
+  80031a:	73 17                	jae    800333 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80031c:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80031f:	49 89 c4             	mov    %rax,%r12
+  800322:	48 83 c3 08          	add    $0x8,%rbx
+  800326:	b8 00 00 00 00       	mov    $0x0,%eax
+  80032b:	ff 53 f8             	call   *-0x8(%rbx)
+  80032e:	4c 39 e3             	cmp    %r12,%rbx
+  800331:	72 ef                	jb     800322 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800333:	48 b8 0f 13 80 00 00 	movabs $0x80130f,%rax
+  80033a:	00 00 00 
+  80033d:	ff d0                	call   *%rax
+  80033f:	89 c2                	mov    %eax,%edx
+  800341:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  800347:	48 89 d0             	mov    %rdx,%rax
+  80034a:	48 c1 e0 04          	shl    $0x4,%rax
+  80034e:	48 29 d0             	sub    %rdx,%rax
+  800351:	48 c1 e0 05          	shl    $0x5,%rax
+  800355:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80035c:	00 00 00 
+  80035f:	48 01 d0             	add    %rdx,%rax
+  800362:	48 a3 00 04 81 00 00 	movabs %rax,0x810400
+  800369:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80036c:	45 85 ed             	test   %r13d,%r13d
+  80036f:	7e 0d                	jle    80037e <libmain+0x8c>
+  800371:	49 8b 06             	mov    (%r14),%rax
+  800374:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  80037b:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80037e:	4c 89 f6             	mov    %r14,%rsi
+  800381:	44 89 ef             	mov    %r13d,%edi
+  800384:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80038b:	00 00 00 
+  80038e:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800390:	48 b8 a5 03 80 00 00 	movabs $0x8003a5,%rax
+  800397:	00 00 00 
+  80039a:	ff d0                	call   *%rax
+#endif
+}
+  80039c:	5b                   	pop    %rbx
+  80039d:	41 5c                	pop    %r12
+  80039f:	41 5d                	pop    %r13
+  8003a1:	41 5e                	pop    %r14
+  8003a3:	5d                   	pop    %rbp
+  8003a4:	c3                   	ret
+
+00000000008003a5 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8003a5:	55                   	push   %rbp
+  8003a6:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8003a9:	48 b8 15 1b 80 00 00 	movabs $0x801b15,%rax
+  8003b0:	00 00 00 
+  8003b3:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8003b5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8003ba:	48 b8 ac 12 80 00 00 	movabs $0x8012ac,%rax
+  8003c1:	00 00 00 
+  8003c4:	ff d0                	call   *%rax
+}
+  8003c6:	5d                   	pop    %rbp
+  8003c7:	c3                   	ret
+
+00000000008003c8 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8003c8:	55                   	push   %rbp
+  8003c9:	48 89 e5             	mov    %rsp,%rbp
+  8003cc:	41 56                	push   %r14
+  8003ce:	41 55                	push   %r13
+  8003d0:	41 54                	push   %r12
+  8003d2:	53                   	push   %rbx
+  8003d3:	48 83 ec 50          	sub    $0x50,%rsp
+  8003d7:	49 89 fc             	mov    %rdi,%r12
+  8003da:	41 89 f5             	mov    %esi,%r13d
+  8003dd:	48 89 d3             	mov    %rdx,%rbx
+  8003e0:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8003e4:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8003e8:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8003ec:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8003f3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003f7:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8003fb:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8003ff:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800403:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80040a:	00 00 00 
+  80040d:	4c 8b 30             	mov    (%rax),%r14
+  800410:	48 b8 0f 13 80 00 00 	movabs $0x80130f,%rax
+  800417:	00 00 00 
+  80041a:	ff d0                	call   *%rax
+  80041c:	89 c6                	mov    %eax,%esi
+  80041e:	45 89 e8             	mov    %r13d,%r8d
+  800421:	4c 89 e1             	mov    %r12,%rcx
+  800424:	4c 89 f2             	mov    %r14,%rdx
+  800427:	48 bf c0 4c 80 00 00 	movabs $0x804cc0,%rdi
+  80042e:	00 00 00 
+  800431:	b8 00 00 00 00       	mov    $0x0,%eax
+  800436:	49 bc 18 05 80 00 00 	movabs $0x800518,%r12
+  80043d:	00 00 00 
+  800440:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800443:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800447:	48 89 df             	mov    %rbx,%rdi
+  80044a:	48 b8 b4 04 80 00 00 	movabs $0x8004b4,%rax
+  800451:	00 00 00 
+  800454:	ff d0                	call   *%rax
+    cprintf("\n");
+  800456:	48 bf c2 4b 80 00 00 	movabs $0x804bc2,%rdi
+  80045d:	00 00 00 
+  800460:	b8 00 00 00 00       	mov    $0x0,%eax
+  800465:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800468:	cc                   	int3
+  800469:	eb fd                	jmp    800468 <_panic+0xa0>
+
+000000000080046b <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80046b:	55                   	push   %rbp
+  80046c:	48 89 e5             	mov    %rsp,%rbp
+  80046f:	53                   	push   %rbx
+  800470:	48 83 ec 08          	sub    $0x8,%rsp
+  800474:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800477:	8b 06                	mov    (%rsi),%eax
+  800479:	8d 50 01             	lea    0x1(%rax),%edx
+  80047c:	89 16                	mov    %edx,(%rsi)
+  80047e:	48 98                	cltq
+  800480:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800485:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80048b:	74 0a                	je     800497 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80048d:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800491:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800495:	c9                   	leave
+  800496:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800497:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80049b:	be ff 00 00 00       	mov    $0xff,%esi
+  8004a0:	48 b8 64 12 80 00 00 	movabs $0x801264,%rax
+  8004a7:	00 00 00 
+  8004aa:	ff d0                	call   *%rax
+        state->offset = 0;
+  8004ac:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8004b2:	eb d9                	jmp    80048d <putch+0x22>
+
+00000000008004b4 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8004b4:	55                   	push   %rbp
+  8004b5:	48 89 e5             	mov    %rsp,%rbp
+  8004b8:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8004bf:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8004c2:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8004c9:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8004ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004d3:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8004d6:	48 89 f1             	mov    %rsi,%rcx
+  8004d9:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8004e0:	48 bf 6b 04 80 00 00 	movabs $0x80046b,%rdi
+  8004e7:	00 00 00 
+  8004ea:	48 b8 68 06 80 00 00 	movabs $0x800668,%rax
+  8004f1:	00 00 00 
+  8004f4:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8004f6:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8004fd:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800504:	48 b8 64 12 80 00 00 	movabs $0x801264,%rax
+  80050b:	00 00 00 
+  80050e:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800510:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800516:	c9                   	leave
+  800517:	c3                   	ret
+
+0000000000800518 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800518:	55                   	push   %rbp
+  800519:	48 89 e5             	mov    %rsp,%rbp
+  80051c:	48 83 ec 50          	sub    $0x50,%rsp
+  800520:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800524:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800528:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80052c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800530:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800534:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80053b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80053f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800543:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800547:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80054b:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80054f:	48 b8 b4 04 80 00 00 	movabs $0x8004b4,%rax
+  800556:	00 00 00 
+  800559:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80055b:	c9                   	leave
+  80055c:	c3                   	ret
+
+000000000080055d <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80055d:	55                   	push   %rbp
+  80055e:	48 89 e5             	mov    %rsp,%rbp
+  800561:	41 57                	push   %r15
+  800563:	41 56                	push   %r14
+  800565:	41 55                	push   %r13
+  800567:	41 54                	push   %r12
+  800569:	53                   	push   %rbx
+  80056a:	48 83 ec 18          	sub    $0x18,%rsp
+  80056e:	49 89 fc             	mov    %rdi,%r12
+  800571:	49 89 f5             	mov    %rsi,%r13
+  800574:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800578:	8b 45 10             	mov    0x10(%rbp),%eax
+  80057b:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80057e:	41 89 cf             	mov    %ecx,%r15d
+  800581:	4c 39 fa             	cmp    %r15,%rdx
+  800584:	73 5b                	jae    8005e1 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800586:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80058a:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80058e:	85 db                	test   %ebx,%ebx
+  800590:	7e 0e                	jle    8005a0 <print_num+0x43>
+            putch(padc, put_arg);
+  800592:	4c 89 ee             	mov    %r13,%rsi
+  800595:	44 89 f7             	mov    %r14d,%edi
+  800598:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80059b:	83 eb 01             	sub    $0x1,%ebx
+  80059e:	75 f2                	jne    800592 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8005a0:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8005a4:	48 b9 f4 4c 80 00 00 	movabs $0x804cf4,%rcx
+  8005ab:	00 00 00 
+  8005ae:	48 b8 e3 4c 80 00 00 	movabs $0x804ce3,%rax
+  8005b5:	00 00 00 
+  8005b8:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8005bc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8005c0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005c5:	49 f7 f7             	div    %r15
+  8005c8:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8005cc:	4c 89 ee             	mov    %r13,%rsi
+  8005cf:	41 ff d4             	call   *%r12
+}
+  8005d2:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8005d6:	5b                   	pop    %rbx
+  8005d7:	41 5c                	pop    %r12
+  8005d9:	41 5d                	pop    %r13
+  8005db:	41 5e                	pop    %r14
+  8005dd:	41 5f                	pop    %r15
+  8005df:	5d                   	pop    %rbp
+  8005e0:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8005e1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8005e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005ea:	49 f7 f7             	div    %r15
+  8005ed:	48 83 ec 08          	sub    $0x8,%rsp
+  8005f1:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8005f5:	52                   	push   %rdx
+  8005f6:	45 0f be c9          	movsbl %r9b,%r9d
+  8005fa:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8005fe:	48 89 c2             	mov    %rax,%rdx
+  800601:	48 b8 5d 05 80 00 00 	movabs $0x80055d,%rax
+  800608:	00 00 00 
+  80060b:	ff d0                	call   *%rax
+  80060d:	48 83 c4 10          	add    $0x10,%rsp
+  800611:	eb 8d                	jmp    8005a0 <print_num+0x43>
+
+0000000000800613 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800613:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800617:	48 8b 06             	mov    (%rsi),%rax
+  80061a:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80061e:	73 0a                	jae    80062a <sprintputch+0x17>
+        *state->start++ = ch;
+  800620:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800624:	48 89 16             	mov    %rdx,(%rsi)
+  800627:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80062a:	c3                   	ret
+
+000000000080062b <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80062b:	55                   	push   %rbp
+  80062c:	48 89 e5             	mov    %rsp,%rbp
+  80062f:	48 83 ec 50          	sub    $0x50,%rsp
+  800633:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800637:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80063b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80063f:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800646:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80064a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80064e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800652:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800656:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80065a:	48 b8 68 06 80 00 00 	movabs $0x800668,%rax
+  800661:	00 00 00 
+  800664:	ff d0                	call   *%rax
+}
+  800666:	c9                   	leave
+  800667:	c3                   	ret
+
+0000000000800668 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800668:	55                   	push   %rbp
+  800669:	48 89 e5             	mov    %rsp,%rbp
+  80066c:	41 57                	push   %r15
+  80066e:	41 56                	push   %r14
+  800670:	41 55                	push   %r13
+  800672:	41 54                	push   %r12
+  800674:	53                   	push   %rbx
+  800675:	48 83 ec 38          	sub    $0x38,%rsp
+  800679:	49 89 fe             	mov    %rdi,%r14
+  80067c:	49 89 f5             	mov    %rsi,%r13
+  80067f:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800682:	48 8b 01             	mov    (%rcx),%rax
+  800685:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800689:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80068d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800691:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800695:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800699:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80069d:	0f b6 3b             	movzbl (%rbx),%edi
+  8006a0:	40 80 ff 25          	cmp    $0x25,%dil
+  8006a4:	74 18                	je     8006be <vprintfmt+0x56>
+            if (!ch) return;
+  8006a6:	40 84 ff             	test   %dil,%dil
+  8006a9:	0f 84 b1 06 00 00    	je     800d60 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8006af:	40 0f b6 ff          	movzbl %dil,%edi
+  8006b3:	4c 89 ee             	mov    %r13,%rsi
+  8006b6:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8006b9:	4c 89 e3             	mov    %r12,%rbx
+  8006bc:	eb db                	jmp    800699 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8006be:	be 00 00 00 00       	mov    $0x0,%esi
+  8006c3:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8006c7:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8006cc:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8006d2:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8006d9:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8006dd:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8006e2:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8006e7:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8006ea:	83 e8 23             	sub    $0x23,%eax
+  8006ed:	3c 57                	cmp    $0x57,%al
+  8006ef:	0f 87 51 06 00 00    	ja     800d46 <vprintfmt+0x6de>
+  8006f5:	0f b6 c0             	movzbl %al,%eax
+  8006f8:	48 b9 a0 4e 80 00 00 	movabs $0x804ea0,%rcx
+  8006ff:	00 00 00 
+  800702:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800705:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800708:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80070c:	eb cf                	jmp    8006dd <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  80070e:	49 89 dc             	mov    %rbx,%r12
+  800711:	be 01 00 00 00       	mov    $0x1,%esi
+  800716:	eb c5                	jmp    8006dd <vprintfmt+0x75>
+            padc = ch;
+  800718:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80071c:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80071f:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800722:	eb b9                	jmp    8006dd <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800724:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800727:	83 f8 2f             	cmp    $0x2f,%eax
+  80072a:	77 24                	ja     800750 <vprintfmt+0xe8>
+  80072c:	89 c1                	mov    %eax,%ecx
+  80072e:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800732:	83 c0 08             	add    $0x8,%eax
+  800735:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800738:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80073b:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80073e:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800742:	79 99                	jns    8006dd <vprintfmt+0x75>
+                width = precision;
+  800744:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800748:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80074e:	eb 8d                	jmp    8006dd <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800750:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800754:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800758:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80075c:	eb da                	jmp    800738 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80075e:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800763:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800767:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80076d:	3c 39                	cmp    $0x39,%al
+  80076f:	77 1c                	ja     80078d <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800771:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800775:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800779:	0f b6 c0             	movzbl %al,%eax
+  80077c:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800781:	0f b6 03             	movzbl (%rbx),%eax
+  800784:	3c 39                	cmp    $0x39,%al
+  800786:	76 e9                	jbe    800771 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800788:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80078b:	eb b1                	jmp    80073e <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80078d:	49 89 dc             	mov    %rbx,%r12
+  800790:	eb ac                	jmp    80073e <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800792:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800795:	85 c9                	test   %ecx,%ecx
+  800797:	b8 00 00 00 00       	mov    $0x0,%eax
+  80079c:	0f 49 c1             	cmovns %ecx,%eax
+  80079f:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8007a2:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8007a5:	e9 33 ff ff ff       	jmp    8006dd <vprintfmt+0x75>
+            lflag++;
+  8007aa:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8007ad:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8007b0:	e9 28 ff ff ff       	jmp    8006dd <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8007b5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007b8:	83 f8 2f             	cmp    $0x2f,%eax
+  8007bb:	77 19                	ja     8007d6 <vprintfmt+0x16e>
+  8007bd:	89 c2                	mov    %eax,%edx
+  8007bf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007c3:	83 c0 08             	add    $0x8,%eax
+  8007c6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007c9:	8b 3a                	mov    (%rdx),%edi
+  8007cb:	4c 89 ee             	mov    %r13,%rsi
+  8007ce:	41 ff d6             	call   *%r14
+            break;
+  8007d1:	e9 c3 fe ff ff       	jmp    800699 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8007d6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007da:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007de:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007e2:	eb e5                	jmp    8007c9 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8007e4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007e7:	83 f8 2f             	cmp    $0x2f,%eax
+  8007ea:	77 5a                	ja     800846 <vprintfmt+0x1de>
+  8007ec:	89 c2                	mov    %eax,%edx
+  8007ee:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007f2:	83 c0 08             	add    $0x8,%eax
+  8007f5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8007f8:	8b 02                	mov    (%rdx),%eax
+  8007fa:	89 c1                	mov    %eax,%ecx
+  8007fc:	f7 d9                	neg    %ecx
+  8007fe:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800801:	83 f9 16             	cmp    $0x16,%ecx
+  800804:	7f 4e                	jg     800854 <vprintfmt+0x1ec>
+  800806:	48 63 c1             	movslq %ecx,%rax
+  800809:	48 ba 60 51 80 00 00 	movabs $0x805160,%rdx
+  800810:	00 00 00 
+  800813:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800817:	48 85 c0             	test   %rax,%rax
+  80081a:	74 38                	je     800854 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80081c:	48 89 c1             	mov    %rax,%rcx
+  80081f:	48 ba 59 53 80 00 00 	movabs $0x805359,%rdx
+  800826:	00 00 00 
+  800829:	4c 89 ee             	mov    %r13,%rsi
+  80082c:	4c 89 f7             	mov    %r14,%rdi
+  80082f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800834:	49 b8 2b 06 80 00 00 	movabs $0x80062b,%r8
+  80083b:	00 00 00 
+  80083e:	41 ff d0             	call   *%r8
+  800841:	e9 53 fe ff ff       	jmp    800699 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800846:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80084a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80084e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800852:	eb a4                	jmp    8007f8 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800854:	48 ba 0c 4d 80 00 00 	movabs $0x804d0c,%rdx
+  80085b:	00 00 00 
+  80085e:	4c 89 ee             	mov    %r13,%rsi
+  800861:	4c 89 f7             	mov    %r14,%rdi
+  800864:	b8 00 00 00 00       	mov    $0x0,%eax
+  800869:	49 b8 2b 06 80 00 00 	movabs $0x80062b,%r8
+  800870:	00 00 00 
+  800873:	41 ff d0             	call   *%r8
+  800876:	e9 1e fe ff ff       	jmp    800699 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80087b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80087e:	83 f8 2f             	cmp    $0x2f,%eax
+  800881:	77 6c                	ja     8008ef <vprintfmt+0x287>
+  800883:	89 c2                	mov    %eax,%edx
+  800885:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800889:	83 c0 08             	add    $0x8,%eax
+  80088c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80088f:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800892:	48 85 d2             	test   %rdx,%rdx
+  800895:	48 b8 05 4d 80 00 00 	movabs $0x804d05,%rax
+  80089c:	00 00 00 
+  80089f:	48 0f 45 c2          	cmovne %rdx,%rax
+  8008a3:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8008a7:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8008ab:	7e 06                	jle    8008b3 <vprintfmt+0x24b>
+  8008ad:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8008b1:	75 4a                	jne    8008fd <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8008b3:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8008b7:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8008bb:	0f b6 00             	movzbl (%rax),%eax
+  8008be:	84 c0                	test   %al,%al
+  8008c0:	0f 85 9a 00 00 00    	jne    800960 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8008c6:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8008c9:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8008cd:	85 c0                	test   %eax,%eax
+  8008cf:	0f 8e c4 fd ff ff    	jle    800699 <vprintfmt+0x31>
+  8008d5:	4c 89 ee             	mov    %r13,%rsi
+  8008d8:	bf 20 00 00 00       	mov    $0x20,%edi
+  8008dd:	41 ff d6             	call   *%r14
+  8008e0:	41 83 ec 01          	sub    $0x1,%r12d
+  8008e4:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8008e8:	75 eb                	jne    8008d5 <vprintfmt+0x26d>
+  8008ea:	e9 aa fd ff ff       	jmp    800699 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8008ef:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008f3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008f7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008fb:	eb 92                	jmp    80088f <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8008fd:	49 63 f7             	movslq %r15d,%rsi
+  800900:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800904:	48 b8 1a 0e 80 00 00 	movabs $0x800e1a,%rax
+  80090b:	00 00 00 
+  80090e:	ff d0                	call   *%rax
+  800910:	48 89 c2             	mov    %rax,%rdx
+  800913:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800916:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800918:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80091b:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80091e:	85 c0                	test   %eax,%eax
+  800920:	7e 91                	jle    8008b3 <vprintfmt+0x24b>
+  800922:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800927:	4c 89 ee             	mov    %r13,%rsi
+  80092a:	44 89 e7             	mov    %r12d,%edi
+  80092d:	41 ff d6             	call   *%r14
+  800930:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800934:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800937:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80093a:	75 eb                	jne    800927 <vprintfmt+0x2bf>
+  80093c:	e9 72 ff ff ff       	jmp    8008b3 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800941:	0f b6 f8             	movzbl %al,%edi
+  800944:	4c 89 ee             	mov    %r13,%rsi
+  800947:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80094a:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80094e:	49 83 c4 01          	add    $0x1,%r12
+  800952:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800958:	84 c0                	test   %al,%al
+  80095a:	0f 84 66 ff ff ff    	je     8008c6 <vprintfmt+0x25e>
+  800960:	45 85 ff             	test   %r15d,%r15d
+  800963:	78 0a                	js     80096f <vprintfmt+0x307>
+  800965:	41 83 ef 01          	sub    $0x1,%r15d
+  800969:	0f 88 57 ff ff ff    	js     8008c6 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80096f:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800973:	74 cc                	je     800941 <vprintfmt+0x2d9>
+  800975:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800978:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80097d:	80 fa 5e             	cmp    $0x5e,%dl
+  800980:	77 c2                	ja     800944 <vprintfmt+0x2dc>
+  800982:	eb bd                	jmp    800941 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800984:	40 84 f6             	test   %sil,%sil
+  800987:	75 26                	jne    8009af <vprintfmt+0x347>
+    switch (lflag) {
+  800989:	85 d2                	test   %edx,%edx
+  80098b:	74 59                	je     8009e6 <vprintfmt+0x37e>
+  80098d:	83 fa 01             	cmp    $0x1,%edx
+  800990:	74 7b                	je     800a0d <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800992:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800995:	83 f8 2f             	cmp    $0x2f,%eax
+  800998:	0f 87 96 00 00 00    	ja     800a34 <vprintfmt+0x3cc>
+  80099e:	89 c2                	mov    %eax,%edx
+  8009a0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009a4:	83 c0 08             	add    $0x8,%eax
+  8009a7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009aa:	4c 8b 22             	mov    (%rdx),%r12
+  8009ad:	eb 17                	jmp    8009c6 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8009af:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009b2:	83 f8 2f             	cmp    $0x2f,%eax
+  8009b5:	77 21                	ja     8009d8 <vprintfmt+0x370>
+  8009b7:	89 c2                	mov    %eax,%edx
+  8009b9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009bd:	83 c0 08             	add    $0x8,%eax
+  8009c0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009c3:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8009c6:	4d 85 e4             	test   %r12,%r12
+  8009c9:	78 7a                	js     800a45 <vprintfmt+0x3dd>
+            num = i;
+  8009cb:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8009ce:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8009d3:	e9 50 02 00 00       	jmp    800c28 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009d8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009dc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009e0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009e4:	eb dd                	jmp    8009c3 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8009e6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009e9:	83 f8 2f             	cmp    $0x2f,%eax
+  8009ec:	77 11                	ja     8009ff <vprintfmt+0x397>
+  8009ee:	89 c2                	mov    %eax,%edx
+  8009f0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009f4:	83 c0 08             	add    $0x8,%eax
+  8009f7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009fa:	4c 63 22             	movslq (%rdx),%r12
+  8009fd:	eb c7                	jmp    8009c6 <vprintfmt+0x35e>
+  8009ff:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a03:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a07:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a0b:	eb ed                	jmp    8009fa <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800a0d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a10:	83 f8 2f             	cmp    $0x2f,%eax
+  800a13:	77 11                	ja     800a26 <vprintfmt+0x3be>
+  800a15:	89 c2                	mov    %eax,%edx
+  800a17:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a1b:	83 c0 08             	add    $0x8,%eax
+  800a1e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a21:	4c 8b 22             	mov    (%rdx),%r12
+  800a24:	eb a0                	jmp    8009c6 <vprintfmt+0x35e>
+  800a26:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a2a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a2e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a32:	eb ed                	jmp    800a21 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800a34:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a38:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a3c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a40:	e9 65 ff ff ff       	jmp    8009aa <vprintfmt+0x342>
+                putch('-', put_arg);
+  800a45:	4c 89 ee             	mov    %r13,%rsi
+  800a48:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800a4d:	41 ff d6             	call   *%r14
+                i = -i;
+  800a50:	49 f7 dc             	neg    %r12
+  800a53:	e9 73 ff ff ff       	jmp    8009cb <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800a58:	40 84 f6             	test   %sil,%sil
+  800a5b:	75 32                	jne    800a8f <vprintfmt+0x427>
+    switch (lflag) {
+  800a5d:	85 d2                	test   %edx,%edx
+  800a5f:	74 5d                	je     800abe <vprintfmt+0x456>
+  800a61:	83 fa 01             	cmp    $0x1,%edx
+  800a64:	0f 84 82 00 00 00    	je     800aec <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800a6a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a6d:	83 f8 2f             	cmp    $0x2f,%eax
+  800a70:	0f 87 a5 00 00 00    	ja     800b1b <vprintfmt+0x4b3>
+  800a76:	89 c2                	mov    %eax,%edx
+  800a78:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a7c:	83 c0 08             	add    $0x8,%eax
+  800a7f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a82:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a85:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a8a:	e9 99 01 00 00       	jmp    800c28 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a8f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a92:	83 f8 2f             	cmp    $0x2f,%eax
+  800a95:	77 19                	ja     800ab0 <vprintfmt+0x448>
+  800a97:	89 c2                	mov    %eax,%edx
+  800a99:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a9d:	83 c0 08             	add    $0x8,%eax
+  800aa0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aa3:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800aa6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800aab:	e9 78 01 00 00       	jmp    800c28 <vprintfmt+0x5c0>
+  800ab0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ab4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ab8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800abc:	eb e5                	jmp    800aa3 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800abe:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ac1:	83 f8 2f             	cmp    $0x2f,%eax
+  800ac4:	77 18                	ja     800ade <vprintfmt+0x476>
+  800ac6:	89 c2                	mov    %eax,%edx
+  800ac8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800acc:	83 c0 08             	add    $0x8,%eax
+  800acf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ad2:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800ad4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800ad9:	e9 4a 01 00 00       	jmp    800c28 <vprintfmt+0x5c0>
+  800ade:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ae2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ae6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aea:	eb e6                	jmp    800ad2 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800aec:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aef:	83 f8 2f             	cmp    $0x2f,%eax
+  800af2:	77 19                	ja     800b0d <vprintfmt+0x4a5>
+  800af4:	89 c2                	mov    %eax,%edx
+  800af6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800afa:	83 c0 08             	add    $0x8,%eax
+  800afd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b00:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b03:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800b08:	e9 1b 01 00 00       	jmp    800c28 <vprintfmt+0x5c0>
+  800b0d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b11:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b15:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b19:	eb e5                	jmp    800b00 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800b1b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b1f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b23:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b27:	e9 56 ff ff ff       	jmp    800a82 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800b2c:	40 84 f6             	test   %sil,%sil
+  800b2f:	75 2e                	jne    800b5f <vprintfmt+0x4f7>
+    switch (lflag) {
+  800b31:	85 d2                	test   %edx,%edx
+  800b33:	74 59                	je     800b8e <vprintfmt+0x526>
+  800b35:	83 fa 01             	cmp    $0x1,%edx
+  800b38:	74 7f                	je     800bb9 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800b3a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b3d:	83 f8 2f             	cmp    $0x2f,%eax
+  800b40:	0f 87 9f 00 00 00    	ja     800be5 <vprintfmt+0x57d>
+  800b46:	89 c2                	mov    %eax,%edx
+  800b48:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b4c:	83 c0 08             	add    $0x8,%eax
+  800b4f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b52:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800b55:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b5a:	e9 c9 00 00 00       	jmp    800c28 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b5f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b62:	83 f8 2f             	cmp    $0x2f,%eax
+  800b65:	77 19                	ja     800b80 <vprintfmt+0x518>
+  800b67:	89 c2                	mov    %eax,%edx
+  800b69:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b6d:	83 c0 08             	add    $0x8,%eax
+  800b70:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b73:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800b76:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b7b:	e9 a8 00 00 00       	jmp    800c28 <vprintfmt+0x5c0>
+  800b80:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b84:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b88:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b8c:	eb e5                	jmp    800b73 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800b8e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b91:	83 f8 2f             	cmp    $0x2f,%eax
+  800b94:	77 15                	ja     800bab <vprintfmt+0x543>
+  800b96:	89 c2                	mov    %eax,%edx
+  800b98:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b9c:	83 c0 08             	add    $0x8,%eax
+  800b9f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ba2:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800ba4:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800ba9:	eb 7d                	jmp    800c28 <vprintfmt+0x5c0>
+  800bab:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800baf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bb3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bb7:	eb e9                	jmp    800ba2 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800bb9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bbc:	83 f8 2f             	cmp    $0x2f,%eax
+  800bbf:	77 16                	ja     800bd7 <vprintfmt+0x56f>
+  800bc1:	89 c2                	mov    %eax,%edx
+  800bc3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bc7:	83 c0 08             	add    $0x8,%eax
+  800bca:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bcd:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800bd0:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800bd5:	eb 51                	jmp    800c28 <vprintfmt+0x5c0>
+  800bd7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bdb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bdf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800be3:	eb e8                	jmp    800bcd <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800be5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800be9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bed:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bf1:	e9 5c ff ff ff       	jmp    800b52 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800bf6:	4c 89 ee             	mov    %r13,%rsi
+  800bf9:	bf 30 00 00 00       	mov    $0x30,%edi
+  800bfe:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800c01:	4c 89 ee             	mov    %r13,%rsi
+  800c04:	bf 78 00 00 00       	mov    $0x78,%edi
+  800c09:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800c0c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c0f:	83 f8 2f             	cmp    $0x2f,%eax
+  800c12:	77 47                	ja     800c5b <vprintfmt+0x5f3>
+  800c14:	89 c2                	mov    %eax,%edx
+  800c16:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c1a:	83 c0 08             	add    $0x8,%eax
+  800c1d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c20:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c23:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800c28:	48 83 ec 08          	sub    $0x8,%rsp
+  800c2c:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800c30:	0f 94 c0             	sete   %al
+  800c33:	0f b6 c0             	movzbl %al,%eax
+  800c36:	50                   	push   %rax
+  800c37:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800c3c:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800c40:	4c 89 ee             	mov    %r13,%rsi
+  800c43:	4c 89 f7             	mov    %r14,%rdi
+  800c46:	48 b8 5d 05 80 00 00 	movabs $0x80055d,%rax
+  800c4d:	00 00 00 
+  800c50:	ff d0                	call   *%rax
+            break;
+  800c52:	48 83 c4 10          	add    $0x10,%rsp
+  800c56:	e9 3e fa ff ff       	jmp    800699 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800c5b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c5f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c63:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c67:	eb b7                	jmp    800c20 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800c69:	40 84 f6             	test   %sil,%sil
+  800c6c:	75 2b                	jne    800c99 <vprintfmt+0x631>
+    switch (lflag) {
+  800c6e:	85 d2                	test   %edx,%edx
+  800c70:	74 56                	je     800cc8 <vprintfmt+0x660>
+  800c72:	83 fa 01             	cmp    $0x1,%edx
+  800c75:	74 7f                	je     800cf6 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800c77:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c7a:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7d:	0f 87 a2 00 00 00    	ja     800d25 <vprintfmt+0x6bd>
+  800c83:	89 c2                	mov    %eax,%edx
+  800c85:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c89:	83 c0 08             	add    $0x8,%eax
+  800c8c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c8f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c92:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800c97:	eb 8f                	jmp    800c28 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800c99:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c9c:	83 f8 2f             	cmp    $0x2f,%eax
+  800c9f:	77 19                	ja     800cba <vprintfmt+0x652>
+  800ca1:	89 c2                	mov    %eax,%edx
+  800ca3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ca7:	83 c0 08             	add    $0x8,%eax
+  800caa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cad:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800cb0:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800cb5:	e9 6e ff ff ff       	jmp    800c28 <vprintfmt+0x5c0>
+  800cba:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cbe:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cc2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cc6:	eb e5                	jmp    800cad <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800cc8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ccb:	83 f8 2f             	cmp    $0x2f,%eax
+  800cce:	77 18                	ja     800ce8 <vprintfmt+0x680>
+  800cd0:	89 c2                	mov    %eax,%edx
+  800cd2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cd6:	83 c0 08             	add    $0x8,%eax
+  800cd9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cdc:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800cde:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800ce3:	e9 40 ff ff ff       	jmp    800c28 <vprintfmt+0x5c0>
+  800ce8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cec:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cf0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cf4:	eb e6                	jmp    800cdc <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800cf6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cf9:	83 f8 2f             	cmp    $0x2f,%eax
+  800cfc:	77 19                	ja     800d17 <vprintfmt+0x6af>
+  800cfe:	89 c2                	mov    %eax,%edx
+  800d00:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d04:	83 c0 08             	add    $0x8,%eax
+  800d07:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d0a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d0d:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800d12:	e9 11 ff ff ff       	jmp    800c28 <vprintfmt+0x5c0>
+  800d17:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d1b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d1f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d23:	eb e5                	jmp    800d0a <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800d25:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d29:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d2d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d31:	e9 59 ff ff ff       	jmp    800c8f <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800d36:	4c 89 ee             	mov    %r13,%rsi
+  800d39:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d3e:	41 ff d6             	call   *%r14
+            break;
+  800d41:	e9 53 f9 ff ff       	jmp    800699 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800d46:	4c 89 ee             	mov    %r13,%rsi
+  800d49:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d4e:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800d51:	48 83 eb 01          	sub    $0x1,%rbx
+  800d55:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800d59:	75 f6                	jne    800d51 <vprintfmt+0x6e9>
+  800d5b:	e9 39 f9 ff ff       	jmp    800699 <vprintfmt+0x31>
+}
+  800d60:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800d64:	5b                   	pop    %rbx
+  800d65:	41 5c                	pop    %r12
+  800d67:	41 5d                	pop    %r13
+  800d69:	41 5e                	pop    %r14
+  800d6b:	41 5f                	pop    %r15
+  800d6d:	5d                   	pop    %rbp
+  800d6e:	c3                   	ret
+
+0000000000800d6f <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800d6f:	55                   	push   %rbp
+  800d70:	48 89 e5             	mov    %rsp,%rbp
+  800d73:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800d77:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800d7b:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800d80:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800d84:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800d8b:	48 85 ff             	test   %rdi,%rdi
+  800d8e:	74 2b                	je     800dbb <vsnprintf+0x4c>
+  800d90:	48 85 f6             	test   %rsi,%rsi
+  800d93:	74 26                	je     800dbb <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800d95:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800d99:	48 bf 13 06 80 00 00 	movabs $0x800613,%rdi
+  800da0:	00 00 00 
+  800da3:	48 b8 68 06 80 00 00 	movabs $0x800668,%rax
+  800daa:	00 00 00 
+  800dad:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800daf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800db3:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800db6:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800db9:	c9                   	leave
+  800dba:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800dbb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800dc0:	eb f7                	jmp    800db9 <vsnprintf+0x4a>
+
+0000000000800dc2 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800dc2:	55                   	push   %rbp
+  800dc3:	48 89 e5             	mov    %rsp,%rbp
+  800dc6:	48 83 ec 50          	sub    $0x50,%rsp
+  800dca:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800dce:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800dd2:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800dd6:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800ddd:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800de1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800de5:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800de9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800ded:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800df1:	48 b8 6f 0d 80 00 00 	movabs $0x800d6f,%rax
+  800df8:	00 00 00 
+  800dfb:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800dfd:	c9                   	leave
+  800dfe:	c3                   	ret
+
+0000000000800dff <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800dff:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800e02:	74 10                	je     800e14 <strlen+0x15>
+    size_t n = 0;
+  800e04:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800e09:	48 83 c0 01          	add    $0x1,%rax
+  800e0d:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800e11:	75 f6                	jne    800e09 <strlen+0xa>
+  800e13:	c3                   	ret
+    size_t n = 0;
+  800e14:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800e19:	c3                   	ret
+
+0000000000800e1a <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800e1a:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800e1d:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800e22:	48 85 f6             	test   %rsi,%rsi
+  800e25:	74 11                	je     800e38 <strnlen+0x1e>
+  800e27:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800e2b:	74 0c                	je     800e39 <strnlen+0x1f>
+  800e2d:	48 83 c2 01          	add    $0x1,%rdx
+  800e31:	48 39 d0             	cmp    %rdx,%rax
+  800e34:	75 f1                	jne    800e27 <strnlen+0xd>
+  800e36:	eb 04                	jmp    800e3c <strnlen+0x22>
+  800e38:	c3                   	ret
+  800e39:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800e3c:	c3                   	ret
+
+0000000000800e3d <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800e3d:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800e40:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e45:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800e49:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800e4c:	48 83 c2 01          	add    $0x1,%rdx
+  800e50:	84 c9                	test   %cl,%cl
+  800e52:	75 f1                	jne    800e45 <strcpy+0x8>
+        ;
+    return res;
+}
+  800e54:	c3                   	ret
+
+0000000000800e55 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800e55:	55                   	push   %rbp
+  800e56:	48 89 e5             	mov    %rsp,%rbp
+  800e59:	41 54                	push   %r12
+  800e5b:	53                   	push   %rbx
+  800e5c:	48 89 fb             	mov    %rdi,%rbx
+  800e5f:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800e62:	48 b8 ff 0d 80 00 00 	movabs $0x800dff,%rax
+  800e69:	00 00 00 
+  800e6c:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800e6e:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800e72:	4c 89 e6             	mov    %r12,%rsi
+  800e75:	48 b8 3d 0e 80 00 00 	movabs $0x800e3d,%rax
+  800e7c:	00 00 00 
+  800e7f:	ff d0                	call   *%rax
+    return dst;
+}
+  800e81:	48 89 d8             	mov    %rbx,%rax
+  800e84:	5b                   	pop    %rbx
+  800e85:	41 5c                	pop    %r12
+  800e87:	5d                   	pop    %rbp
+  800e88:	c3                   	ret
+
+0000000000800e89 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800e89:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800e8c:	48 85 d2             	test   %rdx,%rdx
+  800e8f:	74 1f                	je     800eb0 <strncpy+0x27>
+  800e91:	48 01 fa             	add    %rdi,%rdx
+  800e94:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800e97:	48 83 c1 01          	add    $0x1,%rcx
+  800e9b:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800e9f:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800ea3:	41 80 f8 01          	cmp    $0x1,%r8b
+  800ea7:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800eab:	48 39 ca             	cmp    %rcx,%rdx
+  800eae:	75 e7                	jne    800e97 <strncpy+0xe>
+    }
+    return ret;
+}
+  800eb0:	c3                   	ret
+
+0000000000800eb1 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800eb1:	48 89 f8             	mov    %rdi,%rax
+  800eb4:	48 85 d2             	test   %rdx,%rdx
+  800eb7:	74 24                	je     800edd <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800eb9:	48 83 ea 01          	sub    $0x1,%rdx
+  800ebd:	74 1b                	je     800eda <strlcpy+0x29>
+  800ebf:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800ec3:	0f b6 16             	movzbl (%rsi),%edx
+  800ec6:	84 d2                	test   %dl,%dl
+  800ec8:	74 10                	je     800eda <strlcpy+0x29>
+            *dst++ = *src++;
+  800eca:	48 83 c6 01          	add    $0x1,%rsi
+  800ece:	48 83 c0 01          	add    $0x1,%rax
+  800ed2:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800ed5:	48 39 c8             	cmp    %rcx,%rax
+  800ed8:	75 e9                	jne    800ec3 <strlcpy+0x12>
+        *dst = '\0';
+  800eda:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800edd:	48 29 f8             	sub    %rdi,%rax
+}
+  800ee0:	c3                   	ret
+
+0000000000800ee1 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800ee1:	0f b6 07             	movzbl (%rdi),%eax
+  800ee4:	84 c0                	test   %al,%al
+  800ee6:	74 13                	je     800efb <strcmp+0x1a>
+  800ee8:	38 06                	cmp    %al,(%rsi)
+  800eea:	75 0f                	jne    800efb <strcmp+0x1a>
+  800eec:	48 83 c7 01          	add    $0x1,%rdi
+  800ef0:	48 83 c6 01          	add    $0x1,%rsi
+  800ef4:	0f b6 07             	movzbl (%rdi),%eax
+  800ef7:	84 c0                	test   %al,%al
+  800ef9:	75 ed                	jne    800ee8 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800efb:	0f b6 c0             	movzbl %al,%eax
+  800efe:	0f b6 16             	movzbl (%rsi),%edx
+  800f01:	29 d0                	sub    %edx,%eax
+}
+  800f03:	c3                   	ret
+
+0000000000800f04 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800f04:	48 85 d2             	test   %rdx,%rdx
+  800f07:	74 1f                	je     800f28 <strncmp+0x24>
+  800f09:	0f b6 07             	movzbl (%rdi),%eax
+  800f0c:	84 c0                	test   %al,%al
+  800f0e:	74 1e                	je     800f2e <strncmp+0x2a>
+  800f10:	3a 06                	cmp    (%rsi),%al
+  800f12:	75 1a                	jne    800f2e <strncmp+0x2a>
+  800f14:	48 83 c7 01          	add    $0x1,%rdi
+  800f18:	48 83 c6 01          	add    $0x1,%rsi
+  800f1c:	48 83 ea 01          	sub    $0x1,%rdx
+  800f20:	75 e7                	jne    800f09 <strncmp+0x5>
+
+    if (!n) return 0;
+  800f22:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f27:	c3                   	ret
+  800f28:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f2d:	c3                   	ret
+  800f2e:	48 85 d2             	test   %rdx,%rdx
+  800f31:	74 09                	je     800f3c <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f33:	0f b6 07             	movzbl (%rdi),%eax
+  800f36:	0f b6 16             	movzbl (%rsi),%edx
+  800f39:	29 d0                	sub    %edx,%eax
+  800f3b:	c3                   	ret
+    if (!n) return 0;
+  800f3c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f41:	c3                   	ret
+
+0000000000800f42 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800f42:	0f b6 17             	movzbl (%rdi),%edx
+  800f45:	84 d2                	test   %dl,%dl
+  800f47:	74 18                	je     800f61 <strchr+0x1f>
+        if (*str == c) {
+  800f49:	0f be d2             	movsbl %dl,%edx
+  800f4c:	39 f2                	cmp    %esi,%edx
+  800f4e:	74 17                	je     800f67 <strchr+0x25>
+    for (; *str; str++) {
+  800f50:	48 83 c7 01          	add    $0x1,%rdi
+  800f54:	0f b6 17             	movzbl (%rdi),%edx
+  800f57:	84 d2                	test   %dl,%dl
+  800f59:	75 ee                	jne    800f49 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800f5b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f60:	c3                   	ret
+  800f61:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f66:	c3                   	ret
+  800f67:	48 89 f8             	mov    %rdi,%rax
+}
+  800f6a:	c3                   	ret
+
+0000000000800f6b <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800f6b:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800f6e:	0f b6 17             	movzbl (%rdi),%edx
+  800f71:	84 d2                	test   %dl,%dl
+  800f73:	74 13                	je     800f88 <strfind+0x1d>
+  800f75:	0f be d2             	movsbl %dl,%edx
+  800f78:	39 f2                	cmp    %esi,%edx
+  800f7a:	74 0b                	je     800f87 <strfind+0x1c>
+  800f7c:	48 83 c0 01          	add    $0x1,%rax
+  800f80:	0f b6 10             	movzbl (%rax),%edx
+  800f83:	84 d2                	test   %dl,%dl
+  800f85:	75 ee                	jne    800f75 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800f87:	c3                   	ret
+  800f88:	c3                   	ret
+
+0000000000800f89 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800f89:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800f8c:	48 89 f8             	mov    %rdi,%rax
+  800f8f:	48 f7 d8             	neg    %rax
+  800f92:	83 e0 07             	and    $0x7,%eax
+  800f95:	49 89 d1             	mov    %rdx,%r9
+  800f98:	49 29 c1             	sub    %rax,%r9
+  800f9b:	78 36                	js     800fd3 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800f9d:	40 0f b6 c6          	movzbl %sil,%eax
+  800fa1:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800fa8:	01 01 01 
+  800fab:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800faf:	40 f6 c7 07          	test   $0x7,%dil
+  800fb3:	75 38                	jne    800fed <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800fb5:	4c 89 c9             	mov    %r9,%rcx
+  800fb8:	48 c1 f9 03          	sar    $0x3,%rcx
+  800fbc:	74 0c                	je     800fca <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800fbe:	fc                   	cld
+  800fbf:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800fc2:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800fc6:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800fca:	4d 85 c9             	test   %r9,%r9
+  800fcd:	75 45                	jne    801014 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800fcf:	4c 89 c0             	mov    %r8,%rax
+  800fd2:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800fd3:	48 85 d2             	test   %rdx,%rdx
+  800fd6:	74 f7                	je     800fcf <memset+0x46>
+  800fd8:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800fdb:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800fde:	48 83 c0 01          	add    $0x1,%rax
+  800fe2:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800fe6:	48 39 c2             	cmp    %rax,%rdx
+  800fe9:	75 f3                	jne    800fde <memset+0x55>
+  800feb:	eb e2                	jmp    800fcf <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800fed:	40 f6 c7 01          	test   $0x1,%dil
+  800ff1:	74 06                	je     800ff9 <memset+0x70>
+  800ff3:	88 07                	mov    %al,(%rdi)
+  800ff5:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800ff9:	40 f6 c7 02          	test   $0x2,%dil
+  800ffd:	74 07                	je     801006 <memset+0x7d>
+  800fff:	66 89 07             	mov    %ax,(%rdi)
+  801002:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801006:	40 f6 c7 04          	test   $0x4,%dil
+  80100a:	74 a9                	je     800fb5 <memset+0x2c>
+  80100c:	89 07                	mov    %eax,(%rdi)
+  80100e:	48 83 c7 04          	add    $0x4,%rdi
+  801012:	eb a1                	jmp    800fb5 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801014:	41 f6 c1 04          	test   $0x4,%r9b
+  801018:	74 06                	je     801020 <memset+0x97>
+  80101a:	89 07                	mov    %eax,(%rdi)
+  80101c:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801020:	41 f6 c1 02          	test   $0x2,%r9b
+  801024:	74 07                	je     80102d <memset+0xa4>
+  801026:	66 89 07             	mov    %ax,(%rdi)
+  801029:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  80102d:	41 f6 c1 01          	test   $0x1,%r9b
+  801031:	74 9c                	je     800fcf <memset+0x46>
+  801033:	88 07                	mov    %al,(%rdi)
+  801035:	eb 98                	jmp    800fcf <memset+0x46>
+
+0000000000801037 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  801037:	48 89 f8             	mov    %rdi,%rax
+  80103a:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  80103d:	48 39 fe             	cmp    %rdi,%rsi
+  801040:	73 3b                	jae    80107d <memmove+0x46>
+  801042:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  801046:	48 39 d7             	cmp    %rdx,%rdi
+  801049:	73 32                	jae    80107d <memmove+0x46>
+        s += n;
+        d += n;
+  80104b:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80104f:	48 89 d6             	mov    %rdx,%rsi
+  801052:	48 09 fe             	or     %rdi,%rsi
+  801055:	48 09 ce             	or     %rcx,%rsi
+  801058:	40 f6 c6 07          	test   $0x7,%sil
+  80105c:	75 12                	jne    801070 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  80105e:	48 83 ef 08          	sub    $0x8,%rdi
+  801062:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  801066:	48 c1 e9 03          	shr    $0x3,%rcx
+  80106a:	fd                   	std
+  80106b:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  80106e:	fc                   	cld
+  80106f:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801070:	48 83 ef 01          	sub    $0x1,%rdi
+  801074:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  801078:	fd                   	std
+  801079:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80107b:	eb f1                	jmp    80106e <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80107d:	48 89 f2             	mov    %rsi,%rdx
+  801080:	48 09 c2             	or     %rax,%rdx
+  801083:	48 09 ca             	or     %rcx,%rdx
+  801086:	f6 c2 07             	test   $0x7,%dl
+  801089:	75 0c                	jne    801097 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  80108b:	48 c1 e9 03          	shr    $0x3,%rcx
+  80108f:	48 89 c7             	mov    %rax,%rdi
+  801092:	fc                   	cld
+  801093:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801096:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801097:	48 89 c7             	mov    %rax,%rdi
+  80109a:	fc                   	cld
+  80109b:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  80109d:	c3                   	ret
+
+000000000080109e <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80109e:	55                   	push   %rbp
+  80109f:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8010a2:	48 b8 37 10 80 00 00 	movabs $0x801037,%rax
+  8010a9:	00 00 00 
+  8010ac:	ff d0                	call   *%rax
+}
+  8010ae:	5d                   	pop    %rbp
+  8010af:	c3                   	ret
+
+00000000008010b0 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8010b0:	55                   	push   %rbp
+  8010b1:	48 89 e5             	mov    %rsp,%rbp
+  8010b4:	41 57                	push   %r15
+  8010b6:	41 56                	push   %r14
+  8010b8:	41 55                	push   %r13
+  8010ba:	41 54                	push   %r12
+  8010bc:	53                   	push   %rbx
+  8010bd:	48 83 ec 08          	sub    $0x8,%rsp
+  8010c1:	49 89 fe             	mov    %rdi,%r14
+  8010c4:	49 89 f7             	mov    %rsi,%r15
+  8010c7:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8010ca:	48 89 f7             	mov    %rsi,%rdi
+  8010cd:	48 b8 ff 0d 80 00 00 	movabs $0x800dff,%rax
+  8010d4:	00 00 00 
+  8010d7:	ff d0                	call   *%rax
+  8010d9:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8010dc:	48 89 de             	mov    %rbx,%rsi
+  8010df:	4c 89 f7             	mov    %r14,%rdi
+  8010e2:	48 b8 1a 0e 80 00 00 	movabs $0x800e1a,%rax
+  8010e9:	00 00 00 
+  8010ec:	ff d0                	call   *%rax
+  8010ee:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8010f1:	48 39 c3             	cmp    %rax,%rbx
+  8010f4:	74 36                	je     80112c <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8010f6:	48 89 d8             	mov    %rbx,%rax
+  8010f9:	4c 29 e8             	sub    %r13,%rax
+  8010fc:	49 39 c4             	cmp    %rax,%r12
+  8010ff:	73 31                	jae    801132 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801101:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801106:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80110a:	4c 89 fe             	mov    %r15,%rsi
+  80110d:	48 b8 9e 10 80 00 00 	movabs $0x80109e,%rax
+  801114:	00 00 00 
+  801117:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801119:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80111d:	48 83 c4 08          	add    $0x8,%rsp
+  801121:	5b                   	pop    %rbx
+  801122:	41 5c                	pop    %r12
+  801124:	41 5d                	pop    %r13
+  801126:	41 5e                	pop    %r14
+  801128:	41 5f                	pop    %r15
+  80112a:	5d                   	pop    %rbp
+  80112b:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80112c:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801130:	eb eb                	jmp    80111d <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801132:	48 83 eb 01          	sub    $0x1,%rbx
+  801136:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80113a:	48 89 da             	mov    %rbx,%rdx
+  80113d:	4c 89 fe             	mov    %r15,%rsi
+  801140:	48 b8 9e 10 80 00 00 	movabs $0x80109e,%rax
+  801147:	00 00 00 
+  80114a:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  80114c:	49 01 de             	add    %rbx,%r14
+  80114f:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801154:	eb c3                	jmp    801119 <strlcat+0x69>
+
+0000000000801156 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801156:	48 85 d2             	test   %rdx,%rdx
+  801159:	74 2d                	je     801188 <memcmp+0x32>
+  80115b:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801160:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801164:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801169:	44 38 c1             	cmp    %r8b,%cl
+  80116c:	75 0f                	jne    80117d <memcmp+0x27>
+    while (n-- > 0) {
+  80116e:	48 83 c0 01          	add    $0x1,%rax
+  801172:	48 39 c2             	cmp    %rax,%rdx
+  801175:	75 e9                	jne    801160 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801177:	b8 00 00 00 00       	mov    $0x0,%eax
+  80117c:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80117d:	0f b6 c1             	movzbl %cl,%eax
+  801180:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801184:	44 29 c0             	sub    %r8d,%eax
+  801187:	c3                   	ret
+    return 0;
+  801188:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80118d:	c3                   	ret
+
+000000000080118e <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80118e:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801192:	48 39 c7             	cmp    %rax,%rdi
+  801195:	73 0f                	jae    8011a6 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801197:	40 38 37             	cmp    %sil,(%rdi)
+  80119a:	74 0e                	je     8011aa <memfind+0x1c>
+    for (; src < end; src++) {
+  80119c:	48 83 c7 01          	add    $0x1,%rdi
+  8011a0:	48 39 f8             	cmp    %rdi,%rax
+  8011a3:	75 f2                	jne    801197 <memfind+0x9>
+  8011a5:	c3                   	ret
+  8011a6:	48 89 f8             	mov    %rdi,%rax
+  8011a9:	c3                   	ret
+  8011aa:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8011ad:	c3                   	ret
+
+00000000008011ae <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8011ae:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8011b1:	0f b6 37             	movzbl (%rdi),%esi
+  8011b4:	40 80 fe 20          	cmp    $0x20,%sil
+  8011b8:	74 06                	je     8011c0 <strtol+0x12>
+  8011ba:	40 80 fe 09          	cmp    $0x9,%sil
+  8011be:	75 13                	jne    8011d3 <strtol+0x25>
+  8011c0:	48 83 c7 01          	add    $0x1,%rdi
+  8011c4:	0f b6 37             	movzbl (%rdi),%esi
+  8011c7:	40 80 fe 20          	cmp    $0x20,%sil
+  8011cb:	74 f3                	je     8011c0 <strtol+0x12>
+  8011cd:	40 80 fe 09          	cmp    $0x9,%sil
+  8011d1:	74 ed                	je     8011c0 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8011d3:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8011d6:	83 e0 fd             	and    $0xfffffffd,%eax
+  8011d9:	3c 01                	cmp    $0x1,%al
+  8011db:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8011df:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8011e5:	75 0f                	jne    8011f6 <strtol+0x48>
+  8011e7:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8011ea:	74 14                	je     801200 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8011ec:	85 d2                	test   %edx,%edx
+  8011ee:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8011f3:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8011f6:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8011fb:	4c 63 ca             	movslq %edx,%r9
+  8011fe:	eb 36                	jmp    801236 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801200:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801204:	74 0f                	je     801215 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801206:	85 d2                	test   %edx,%edx
+  801208:	75 ec                	jne    8011f6 <strtol+0x48>
+        s++;
+  80120a:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80120e:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801213:	eb e1                	jmp    8011f6 <strtol+0x48>
+        s += 2;
+  801215:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801219:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80121e:	eb d6                	jmp    8011f6 <strtol+0x48>
+            dig -= '0';
+  801220:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801223:	44 0f b6 c1          	movzbl %cl,%r8d
+  801227:	41 39 d0             	cmp    %edx,%r8d
+  80122a:	7d 21                	jge    80124d <strtol+0x9f>
+        val = val * base + dig;
+  80122c:	49 0f af c1          	imul   %r9,%rax
+  801230:	0f b6 c9             	movzbl %cl,%ecx
+  801233:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801236:	48 83 c7 01          	add    $0x1,%rdi
+  80123a:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80123e:	80 f9 39             	cmp    $0x39,%cl
+  801241:	76 dd                	jbe    801220 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801243:	80 f9 7b             	cmp    $0x7b,%cl
+  801246:	77 05                	ja     80124d <strtol+0x9f>
+            dig -= 'a' - 10;
+  801248:	83 e9 57             	sub    $0x57,%ecx
+  80124b:	eb d6                	jmp    801223 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  80124d:	4d 85 d2             	test   %r10,%r10
+  801250:	74 03                	je     801255 <strtol+0xa7>
+  801252:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801255:	48 89 c2             	mov    %rax,%rdx
+  801258:	48 f7 da             	neg    %rdx
+  80125b:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80125f:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801263:	c3                   	ret
+
+0000000000801264 <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  801264:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801269:	ba 00 00 00 00       	mov    $0x0,%edx
+  80126e:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801274:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80127a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  801280:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801282:	c3                   	ret
+
+0000000000801283 <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  801283:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801288:	bf 00 00 00 00       	mov    $0x0,%edi
+  80128d:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801292:	ba 00 00 00 00       	mov    $0x0,%edx
+  801297:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80129d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8012a3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8012a9:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8012ab:	c3                   	ret
+
+00000000008012ac <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8012ac:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8012af:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8012b4:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8012b9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012be:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8012c4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8012ca:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8012d0:	0f 05                	syscall
+    if (check && ret > 0) {
+  8012d2:	48 85 c0             	test   %rax,%rax
+  8012d5:	7f 01                	jg     8012d8 <sys_env_destroy+0x2c>
+}
+  8012d7:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  8012d8:	55                   	push   %rbp
+  8012d9:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012dc:	49 89 c0             	mov    %rax,%r8
+  8012df:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8012e4:	48 ba 38 52 80 00 00 	movabs $0x805238,%rdx
+  8012eb:	00 00 00 
+  8012ee:	be 29 00 00 00       	mov    $0x29,%esi
+  8012f3:	48 bf 57 52 80 00 00 	movabs $0x805257,%rdi
+  8012fa:	00 00 00 
+  8012fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801302:	49 b9 c8 03 80 00 00 	movabs $0x8003c8,%r9
+  801309:	00 00 00 
+  80130c:	41 ff d1             	call   *%r9
+
+000000000080130f <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  80130f:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801314:	bf 00 00 00 00       	mov    $0x0,%edi
+  801319:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80131e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801323:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801329:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80132f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801335:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801337:	c3                   	ret
+
+0000000000801338 <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  801338:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80133d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801342:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801347:	ba 00 00 00 00       	mov    $0x0,%edx
+  80134c:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801352:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801358:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80135e:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801360:	c3                   	ret
+
+0000000000801361 <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  801361:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801366:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  80136d:	00 00 00 
+  801370:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801376:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80137c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801382:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801384:	c3                   	ret
+
+0000000000801385 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801385:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  801388:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80138d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801393:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801399:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80139b:	c3                   	ret
+
+000000000080139c <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80139c:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80139f:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8013a4:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013a7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013ad:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013b3:	0f 05                	syscall
+    if (check && ret > 0) {
+  8013b5:	48 85 c0             	test   %rax,%rax
+  8013b8:	7f 01                	jg     8013bb <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8013ba:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8013bb:	55                   	push   %rbp
+  8013bc:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013bf:	49 89 c0             	mov    %rax,%r8
+  8013c2:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8013c7:	48 ba 38 52 80 00 00 	movabs $0x805238,%rdx
+  8013ce:	00 00 00 
+  8013d1:	be 29 00 00 00       	mov    $0x29,%esi
+  8013d6:	48 bf 57 52 80 00 00 	movabs $0x805257,%rdi
+  8013dd:	00 00 00 
+  8013e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013e5:	49 b9 c8 03 80 00 00 	movabs $0x8003c8,%r9
+  8013ec:	00 00 00 
+  8013ef:	41 ff d1             	call   *%r9
+
+00000000008013f2 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8013f2:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8013f5:	48 63 d2             	movslq %edx,%rdx
+  8013f8:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8013fb:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801400:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  801403:	0f 05                	syscall
+    if (check && ret > 0) {
+  801405:	48 85 c0             	test   %rax,%rax
+  801408:	7f 01                	jg     80140b <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80140a:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80140b:	55                   	push   %rbp
+  80140c:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80140f:	49 89 c0             	mov    %rax,%r8
+  801412:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801417:	48 ba 38 52 80 00 00 	movabs $0x805238,%rdx
+  80141e:	00 00 00 
+  801421:	be 29 00 00 00       	mov    $0x29,%esi
+  801426:	48 bf 57 52 80 00 00 	movabs $0x805257,%rdi
+  80142d:	00 00 00 
+  801430:	b8 00 00 00 00       	mov    $0x0,%eax
+  801435:	49 b9 c8 03 80 00 00 	movabs $0x8003c8,%r9
+  80143c:	00 00 00 
+  80143f:	41 ff d1             	call   *%r9
+
+0000000000801442 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801442:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801445:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80144a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801450:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801456:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80145c:	0f 05                	syscall
+    if (check && ret > 0) {
+  80145e:	48 85 c0             	test   %rax,%rax
+  801461:	7f 01                	jg     801464 <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801463:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801464:	55                   	push   %rbp
+  801465:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801468:	49 89 c0             	mov    %rax,%r8
+  80146b:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801470:	48 ba 38 52 80 00 00 	movabs $0x805238,%rdx
+  801477:	00 00 00 
+  80147a:	be 29 00 00 00       	mov    $0x29,%esi
+  80147f:	48 bf 57 52 80 00 00 	movabs $0x805257,%rdi
+  801486:	00 00 00 
+  801489:	b8 00 00 00 00       	mov    $0x0,%eax
+  80148e:	49 b9 c8 03 80 00 00 	movabs $0x8003c8,%r9
+  801495:	00 00 00 
+  801498:	41 ff d1             	call   *%r9
+
+000000000080149b <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80149b:	48 63 f6             	movslq %esi,%rsi
+  80149e:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8014a1:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8014a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014ab:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014b1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014b7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8014bd:	0f 05                	syscall
+    if (check && ret > 0) {
+  8014bf:	48 85 c0             	test   %rax,%rax
+  8014c2:	7f 01                	jg     8014c5 <sys_env_set_status+0x2a>
+}
+  8014c4:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  8014c5:	55                   	push   %rbp
+  8014c6:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014c9:	49 89 c0             	mov    %rax,%r8
+  8014cc:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8014d1:	48 ba 38 52 80 00 00 	movabs $0x805238,%rdx
+  8014d8:	00 00 00 
+  8014db:	be 29 00 00 00       	mov    $0x29,%esi
+  8014e0:	48 bf 57 52 80 00 00 	movabs $0x805257,%rdi
+  8014e7:	00 00 00 
+  8014ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014ef:	49 b9 c8 03 80 00 00 	movabs $0x8003c8,%r9
+  8014f6:	00 00 00 
+  8014f9:	41 ff d1             	call   *%r9
+
+00000000008014fc <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8014fc:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8014ff:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801504:	ba 00 00 00 00       	mov    $0x0,%edx
+  801509:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80150f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801515:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80151b:	0f 05                	syscall
+    if (check && ret > 0) {
+  80151d:	48 85 c0             	test   %rax,%rax
+  801520:	7f 01                	jg     801523 <sys_env_set_trapframe+0x27>
+}
+  801522:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801523:	55                   	push   %rbp
+  801524:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801527:	49 89 c0             	mov    %rax,%r8
+  80152a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80152f:	48 ba 38 52 80 00 00 	movabs $0x805238,%rdx
+  801536:	00 00 00 
+  801539:	be 29 00 00 00       	mov    $0x29,%esi
+  80153e:	48 bf 57 52 80 00 00 	movabs $0x805257,%rdi
+  801545:	00 00 00 
+  801548:	b8 00 00 00 00       	mov    $0x0,%eax
+  80154d:	49 b9 c8 03 80 00 00 	movabs $0x8003c8,%r9
+  801554:	00 00 00 
+  801557:	41 ff d1             	call   *%r9
+
+000000000080155a <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80155a:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80155d:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801562:	ba 00 00 00 00       	mov    $0x0,%edx
+  801567:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80156d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801573:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801579:	0f 05                	syscall
+    if (check && ret > 0) {
+  80157b:	48 85 c0             	test   %rax,%rax
+  80157e:	7f 01                	jg     801581 <sys_env_set_pgfault_upcall+0x27>
+}
+  801580:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801581:	55                   	push   %rbp
+  801582:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801585:	49 89 c0             	mov    %rax,%r8
+  801588:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80158d:	48 ba 38 52 80 00 00 	movabs $0x805238,%rdx
+  801594:	00 00 00 
+  801597:	be 29 00 00 00       	mov    $0x29,%esi
+  80159c:	48 bf 57 52 80 00 00 	movabs $0x805257,%rdi
+  8015a3:	00 00 00 
+  8015a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015ab:	49 b9 c8 03 80 00 00 	movabs $0x8003c8,%r9
+  8015b2:	00 00 00 
+  8015b5:	41 ff d1             	call   *%r9
+
+00000000008015b8 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8015b8:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8015bb:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8015be:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8015c3:	4d 63 c0             	movslq %r8d,%r8
+  8015c6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8015cc:	0f 05                	syscall
+}
+  8015ce:	c3                   	ret
+
+00000000008015cf <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8015cf:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8015d2:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8015d5:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8015da:	4d 63 c0             	movslq %r8d,%r8
+  8015dd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8015e3:	0f 05                	syscall
+}
+  8015e5:	c3                   	ret
+
+00000000008015e6 <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  8015e6:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8015eb:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8015ee:	45 89 c0             	mov    %r8d,%r8d
+  8015f1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8015f7:	0f 05                	syscall
+    if (check && ret > 0) {
+  8015f9:	48 85 c0             	test   %rax,%rax
+  8015fc:	7f 01                	jg     8015ff <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8015fe:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8015ff:	55                   	push   %rbp
+  801600:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801603:	49 89 c0             	mov    %rax,%r8
+  801606:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  80160b:	48 ba 38 52 80 00 00 	movabs $0x805238,%rdx
+  801612:	00 00 00 
+  801615:	be 29 00 00 00       	mov    $0x29,%esi
+  80161a:	48 bf 57 52 80 00 00 	movabs $0x805257,%rdi
+  801621:	00 00 00 
+  801624:	b8 00 00 00 00       	mov    $0x0,%eax
+  801629:	49 b9 c8 03 80 00 00 	movabs $0x8003c8,%r9
+  801630:	00 00 00 
+  801633:	41 ff d1             	call   *%r9
+
+0000000000801636 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  801636:	55                   	push   %rbp
+  801637:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  80163a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801640:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801645:	ba 00 00 00 00       	mov    $0x0,%edx
+  80164a:	48 b8 e6 15 80 00 00 	movabs $0x8015e6,%rax
+  801651:	00 00 00 
+  801654:	ff d0                	call   *%rax
+}
+  801656:	5d                   	pop    %rbp
+  801657:	c3                   	ret
+
+0000000000801658 <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  801658:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80165d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801662:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801667:	ba 00 00 00 00       	mov    $0x0,%edx
+  80166c:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801672:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801678:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80167e:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801680:	c3                   	ret
+
+0000000000801681 <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  801681:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801686:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80168b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801690:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801696:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80169c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8016a2:	0f 05                	syscall
+    if (check && ret > 0) {
+  8016a4:	48 85 c0             	test   %rax,%rax
+  8016a7:	7f 01                	jg     8016aa <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  8016a9:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  8016aa:	55                   	push   %rbp
+  8016ab:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016ae:	49 89 c0             	mov    %rax,%r8
+  8016b1:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8016b6:	48 ba 38 52 80 00 00 	movabs $0x805238,%rdx
+  8016bd:	00 00 00 
+  8016c0:	be 29 00 00 00       	mov    $0x29,%esi
+  8016c5:	48 bf 57 52 80 00 00 	movabs $0x805257,%rdi
+  8016cc:	00 00 00 
+  8016cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016d4:	49 b9 c8 03 80 00 00 	movabs $0x8003c8,%r9
+  8016db:	00 00 00 
+  8016de:	41 ff d1             	call   *%r9
+
+00000000008016e1 <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  8016e1:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8016e6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8016eb:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8016f0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016f5:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8016fb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801701:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801707:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  801709:	c3                   	ret
+
+000000000080170a <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  80170a:	89 d2                	mov    %edx,%edx
+  80170c:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  80170e:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801713:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801719:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80171f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801725:	0f 05                	syscall
+}
+  801727:	c3                   	ret
+
+0000000000801728 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  801728:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  80172b:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801730:	ba 00 00 00 00       	mov    $0x0,%edx
+  801735:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80173b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801741:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801747:	0f 05                	syscall
+}
+  801749:	c3                   	ret
+
+000000000080174a <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  80174a:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  80174d:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801752:	ba 00 00 00 00       	mov    $0x0,%edx
+  801757:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80175d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801763:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801769:	0f 05                	syscall
+}
+  80176b:	c3                   	ret
+
+000000000080176c <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  80176c:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80176f:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801774:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801779:	ba 00 00 00 00       	mov    $0x0,%edx
+  80177e:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801784:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80178a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801790:	0f 05                	syscall
+    if (check && ret > 0) {
+  801792:	48 85 c0             	test   %rax,%rax
+  801795:	7f 01                	jg     801798 <sys_irq_ack+0x2c>
+}
+  801797:	c3                   	ret
+sys_irq_ack(int irq) {
+  801798:	55                   	push   %rbp
+  801799:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80179c:	49 89 c0             	mov    %rax,%r8
+  80179f:	b9 16 00 00 00       	mov    $0x16,%ecx
+  8017a4:	48 ba 38 52 80 00 00 	movabs $0x805238,%rdx
+  8017ab:	00 00 00 
+  8017ae:	be 29 00 00 00       	mov    $0x29,%esi
+  8017b3:	48 bf 57 52 80 00 00 	movabs $0x805257,%rdi
+  8017ba:	00 00 00 
+  8017bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017c2:	49 b9 c8 03 80 00 00 	movabs $0x8003c8,%r9
+  8017c9:	00 00 00 
+  8017cc:	41 ff d1             	call   *%r9
+
+00000000008017cf <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  8017cf:	55                   	push   %rbp
+  8017d0:	48 89 e5             	mov    %rsp,%rbp
+  8017d3:	41 54                	push   %r12
+  8017d5:	53                   	push   %rbx
+    // LAB 9: Your code here
+    /* The child would write them out once more */
+    file_flush_buffers();
+  8017d6:	48 b8 03 32 80 00 00 	movabs $0x803203,%rax
+  8017dd:	00 00 00 
+  8017e0:	ff d0                	call   *%rax
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("syscall"
+  8017e2:	b8 08 00 00 00       	mov    $0x8,%eax
+  8017e7:	0f 05                	syscall
+  8017e9:	41 89 c4             	mov    %eax,%r12d
+
+	envid_t envid = sys_exofork();
+    if (envid < 0)
+  8017ec:	85 c0                	test   %eax,%eax
+  8017ee:	78 7e                	js     80186e <fork+0x9f>
+        return envid;
+    if (envid == 0) {
+  8017f0:	0f 84 80 00 00 00    	je     801876 <fork+0xa7>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE) < 0) {
+  8017f6:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  8017fc:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801803:	00 00 00 
+  801806:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80180b:	89 c2                	mov    %eax,%edx
+  80180d:	be 00 00 00 00       	mov    $0x0,%esi
+  801812:	bf 00 00 00 00       	mov    $0x0,%edi
+  801817:	48 b8 f2 13 80 00 00 	movabs $0x8013f2,%rax
+  80181e:	00 00 00 
+  801821:	ff d0                	call   *%rax
+  801823:	85 c0                	test   %eax,%eax
+  801825:	0f 88 86 00 00 00    	js     8018b1 <fork+0xe2>
+		return -1;
+	}
+    if (sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall) < 0) {
+  80182b:	48 a1 00 04 81 00 00 	movabs 0x810400,%rax
+  801832:	00 00 00 
+  801835:	48 8b b0 28 01 00 00 	mov    0x128(%rax),%rsi
+  80183c:	44 89 e7             	mov    %r12d,%edi
+  80183f:	48 b8 5a 15 80 00 00 	movabs $0x80155a,%rax
+  801846:	00 00 00 
+  801849:	ff d0                	call   *%rax
+  80184b:	85 c0                	test   %eax,%eax
+  80184d:	78 6a                	js     8018b9 <fork+0xea>
+		return -1;
+	}
+    if (sys_env_set_status(envid, ENV_RUNNABLE) < 0) {
+  80184f:	be 02 00 00 00       	mov    $0x2,%esi
+  801854:	44 89 e7             	mov    %r12d,%edi
+  801857:	48 b8 9b 14 80 00 00 	movabs $0x80149b,%rax
+  80185e:	00 00 00 
+  801861:	ff d0                	call   *%rax
+		return -1;
+  801863:	85 c0                	test   %eax,%eax
+  801865:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80186a:	44 0f 48 e0          	cmovs  %eax,%r12d
+	}
+    return envid;
+}
+  80186e:	44 89 e0             	mov    %r12d,%eax
+  801871:	5b                   	pop    %rbx
+  801872:	41 5c                	pop    %r12
+  801874:	5d                   	pop    %rbp
+  801875:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801876:	48 b8 0f 13 80 00 00 	movabs $0x80130f,%rax
+  80187d:	00 00 00 
+  801880:	ff d0                	call   *%rax
+  801882:	89 c2                	mov    %eax,%edx
+  801884:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  80188a:	48 89 d0             	mov    %rdx,%rax
+  80188d:	48 c1 e0 04          	shl    $0x4,%rax
+  801891:	48 29 d0             	sub    %rdx,%rax
+  801894:	48 c1 e0 05          	shl    $0x5,%rax
+  801898:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80189f:	00 00 00 
+  8018a2:	48 01 d0             	add    %rdx,%rax
+  8018a5:	48 a3 00 04 81 00 00 	movabs %rax,0x810400
+  8018ac:	00 00 00 
+        return 0;
+  8018af:	eb bd                	jmp    80186e <fork+0x9f>
+		return -1;
+  8018b1:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  8018b7:	eb b5                	jmp    80186e <fork+0x9f>
+		return -1;
+  8018b9:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  8018bf:	eb ad                	jmp    80186e <fork+0x9f>
+
+00000000008018c1 <sfork>:
+
+envid_t
+sfork() {
+  8018c1:	55                   	push   %rbp
+  8018c2:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  8018c5:	48 ba 65 52 80 00 00 	movabs $0x805265,%rdx
+  8018cc:	00 00 00 
+  8018cf:	be 2d 00 00 00       	mov    $0x2d,%esi
+  8018d4:	48 bf 80 52 80 00 00 	movabs $0x805280,%rdi
+  8018db:	00 00 00 
+  8018de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018e3:	48 b9 c8 03 80 00 00 	movabs $0x8003c8,%rcx
+  8018ea:	00 00 00 
+  8018ed:	ff d1                	call   *%rcx
+
+00000000008018ef <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8018ef:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8018f6:	ff ff ff 
+  8018f9:	48 01 f8             	add    %rdi,%rax
+  8018fc:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801900:	c3                   	ret
+
+0000000000801901 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801901:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801908:	ff ff ff 
+  80190b:	48 01 f8             	add    %rdi,%rax
+  80190e:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801912:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801918:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80191c:	c3                   	ret
+
+000000000080191d <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  80191d:	55                   	push   %rbp
+  80191e:	48 89 e5             	mov    %rsp,%rbp
+  801921:	41 57                	push   %r15
+  801923:	41 56                	push   %r14
+  801925:	41 55                	push   %r13
+  801927:	41 54                	push   %r12
+  801929:	53                   	push   %rbx
+  80192a:	48 83 ec 08          	sub    $0x8,%rsp
+  80192e:	49 89 ff             	mov    %rdi,%r15
+  801931:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801936:	49 bd ab 41 80 00 00 	movabs $0x8041ab,%r13
+  80193d:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801940:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801946:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801949:	48 89 df             	mov    %rbx,%rdi
+  80194c:	41 ff d5             	call   *%r13
+  80194f:	83 e0 04             	and    $0x4,%eax
+  801952:	74 17                	je     80196b <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801954:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80195b:	4c 39 f3             	cmp    %r14,%rbx
+  80195e:	75 e6                	jne    801946 <fd_alloc+0x29>
+  801960:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801966:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  80196b:	4d 89 27             	mov    %r12,(%r15)
+}
+  80196e:	48 83 c4 08          	add    $0x8,%rsp
+  801972:	5b                   	pop    %rbx
+  801973:	41 5c                	pop    %r12
+  801975:	41 5d                	pop    %r13
+  801977:	41 5e                	pop    %r14
+  801979:	41 5f                	pop    %r15
+  80197b:	5d                   	pop    %rbp
+  80197c:	c3                   	ret
+
+000000000080197d <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  80197d:	83 ff 1f             	cmp    $0x1f,%edi
+  801980:	77 39                	ja     8019bb <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801982:	55                   	push   %rbp
+  801983:	48 89 e5             	mov    %rsp,%rbp
+  801986:	41 54                	push   %r12
+  801988:	53                   	push   %rbx
+  801989:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  80198c:	48 63 df             	movslq %edi,%rbx
+  80198f:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801996:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  80199a:	48 89 df             	mov    %rbx,%rdi
+  80199d:	48 b8 ab 41 80 00 00 	movabs $0x8041ab,%rax
+  8019a4:	00 00 00 
+  8019a7:	ff d0                	call   *%rax
+  8019a9:	a8 04                	test   $0x4,%al
+  8019ab:	74 14                	je     8019c1 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8019ad:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8019b1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019b6:	5b                   	pop    %rbx
+  8019b7:	41 5c                	pop    %r12
+  8019b9:	5d                   	pop    %rbp
+  8019ba:	c3                   	ret
+        return -E_INVAL;
+  8019bb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8019c0:	c3                   	ret
+        return -E_INVAL;
+  8019c1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019c6:	eb ee                	jmp    8019b6 <fd_lookup+0x39>
+
+00000000008019c8 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8019c8:	55                   	push   %rbp
+  8019c9:	48 89 e5             	mov    %rsp,%rbp
+  8019cc:	41 54                	push   %r12
+  8019ce:	53                   	push   %rbx
+  8019cf:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8019d2:	48 b8 20 53 80 00 00 	movabs $0x805320,%rax
+  8019d9:	00 00 00 
+  8019dc:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  8019e3:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8019e6:	39 3b                	cmp    %edi,(%rbx)
+  8019e8:	74 47                	je     801a31 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8019ea:	48 83 c0 08          	add    $0x8,%rax
+  8019ee:	48 8b 18             	mov    (%rax),%rbx
+  8019f1:	48 85 db             	test   %rbx,%rbx
+  8019f4:	75 f0                	jne    8019e6 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8019f6:	48 a1 00 04 81 00 00 	movabs 0x810400,%rax
+  8019fd:	00 00 00 
+  801a00:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801a06:	89 fa                	mov    %edi,%edx
+  801a08:	48 bf 90 52 80 00 00 	movabs $0x805290,%rdi
+  801a0f:	00 00 00 
+  801a12:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a17:	48 b9 18 05 80 00 00 	movabs $0x800518,%rcx
+  801a1e:	00 00 00 
+  801a21:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801a23:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801a28:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801a2c:	5b                   	pop    %rbx
+  801a2d:	41 5c                	pop    %r12
+  801a2f:	5d                   	pop    %rbp
+  801a30:	c3                   	ret
+            return 0;
+  801a31:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a36:	eb f0                	jmp    801a28 <dev_lookup+0x60>
+
+0000000000801a38 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801a38:	55                   	push   %rbp
+  801a39:	48 89 e5             	mov    %rsp,%rbp
+  801a3c:	41 55                	push   %r13
+  801a3e:	41 54                	push   %r12
+  801a40:	53                   	push   %rbx
+  801a41:	48 83 ec 18          	sub    $0x18,%rsp
+  801a45:	48 89 fb             	mov    %rdi,%rbx
+  801a48:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a4b:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801a52:	ff ff ff 
+  801a55:	48 01 df             	add    %rbx,%rdi
+  801a58:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801a5c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801a60:	48 b8 7d 19 80 00 00 	movabs $0x80197d,%rax
+  801a67:	00 00 00 
+  801a6a:	ff d0                	call   *%rax
+  801a6c:	41 89 c5             	mov    %eax,%r13d
+  801a6f:	85 c0                	test   %eax,%eax
+  801a71:	78 06                	js     801a79 <fd_close+0x41>
+  801a73:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801a77:	74 1a                	je     801a93 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801a79:	45 84 e4             	test   %r12b,%r12b
+  801a7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a81:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801a85:	44 89 e8             	mov    %r13d,%eax
+  801a88:	48 83 c4 18          	add    $0x18,%rsp
+  801a8c:	5b                   	pop    %rbx
+  801a8d:	41 5c                	pop    %r12
+  801a8f:	41 5d                	pop    %r13
+  801a91:	5d                   	pop    %rbp
+  801a92:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801a93:	8b 3b                	mov    (%rbx),%edi
+  801a95:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801a99:	48 b8 c8 19 80 00 00 	movabs $0x8019c8,%rax
+  801aa0:	00 00 00 
+  801aa3:	ff d0                	call   *%rax
+  801aa5:	41 89 c5             	mov    %eax,%r13d
+  801aa8:	85 c0                	test   %eax,%eax
+  801aaa:	78 1b                	js     801ac7 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801aac:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ab0:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801ab4:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801aba:	48 85 c0             	test   %rax,%rax
+  801abd:	74 08                	je     801ac7 <fd_close+0x8f>
+  801abf:	48 89 df             	mov    %rbx,%rdi
+  801ac2:	ff d0                	call   *%rax
+  801ac4:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801ac7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801acc:	48 89 de             	mov    %rbx,%rsi
+  801acf:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ad4:	48 b8 42 14 80 00 00 	movabs $0x801442,%rax
+  801adb:	00 00 00 
+  801ade:	ff d0                	call   *%rax
+    return res;
+  801ae0:	eb a3                	jmp    801a85 <fd_close+0x4d>
+
+0000000000801ae2 <close>:
+
+int
+close(int fdnum) {
+  801ae2:	55                   	push   %rbp
+  801ae3:	48 89 e5             	mov    %rsp,%rbp
+  801ae6:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801aea:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801aee:	48 b8 7d 19 80 00 00 	movabs $0x80197d,%rax
+  801af5:	00 00 00 
+  801af8:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801afa:	85 c0                	test   %eax,%eax
+  801afc:	78 15                	js     801b13 <close+0x31>
+
+    return fd_close(fd, 1);
+  801afe:	be 01 00 00 00       	mov    $0x1,%esi
+  801b03:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801b07:	48 b8 38 1a 80 00 00 	movabs $0x801a38,%rax
+  801b0e:	00 00 00 
+  801b11:	ff d0                	call   *%rax
+}
+  801b13:	c9                   	leave
+  801b14:	c3                   	ret
+
+0000000000801b15 <close_all>:
+
+void
+close_all(void) {
+  801b15:	55                   	push   %rbp
+  801b16:	48 89 e5             	mov    %rsp,%rbp
+  801b19:	41 54                	push   %r12
+  801b1b:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801b1c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b21:	49 bc e2 1a 80 00 00 	movabs $0x801ae2,%r12
+  801b28:	00 00 00 
+  801b2b:	89 df                	mov    %ebx,%edi
+  801b2d:	41 ff d4             	call   *%r12
+  801b30:	83 c3 01             	add    $0x1,%ebx
+  801b33:	83 fb 20             	cmp    $0x20,%ebx
+  801b36:	75 f3                	jne    801b2b <close_all+0x16>
+}
+  801b38:	5b                   	pop    %rbx
+  801b39:	41 5c                	pop    %r12
+  801b3b:	5d                   	pop    %rbp
+  801b3c:	c3                   	ret
+
+0000000000801b3d <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801b3d:	55                   	push   %rbp
+  801b3e:	48 89 e5             	mov    %rsp,%rbp
+  801b41:	41 57                	push   %r15
+  801b43:	41 56                	push   %r14
+  801b45:	41 55                	push   %r13
+  801b47:	41 54                	push   %r12
+  801b49:	53                   	push   %rbx
+  801b4a:	48 83 ec 18          	sub    $0x18,%rsp
+  801b4e:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801b51:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801b55:	48 b8 7d 19 80 00 00 	movabs $0x80197d,%rax
+  801b5c:	00 00 00 
+  801b5f:	ff d0                	call   *%rax
+  801b61:	89 c3                	mov    %eax,%ebx
+  801b63:	85 c0                	test   %eax,%eax
+  801b65:	0f 88 b8 00 00 00    	js     801c23 <dup+0xe6>
+    close(newfdnum);
+  801b6b:	44 89 e7             	mov    %r12d,%edi
+  801b6e:	48 b8 e2 1a 80 00 00 	movabs $0x801ae2,%rax
+  801b75:	00 00 00 
+  801b78:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801b7a:	4d 63 ec             	movslq %r12d,%r13
+  801b7d:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801b84:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801b88:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801b8c:	4c 89 ff             	mov    %r15,%rdi
+  801b8f:	49 be 01 19 80 00 00 	movabs $0x801901,%r14
+  801b96:	00 00 00 
+  801b99:	41 ff d6             	call   *%r14
+  801b9c:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801b9f:	4c 89 ef             	mov    %r13,%rdi
+  801ba2:	41 ff d6             	call   *%r14
+  801ba5:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801ba8:	48 89 df             	mov    %rbx,%rdi
+  801bab:	48 b8 ab 41 80 00 00 	movabs $0x8041ab,%rax
+  801bb2:	00 00 00 
+  801bb5:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801bb7:	a8 04                	test   $0x4,%al
+  801bb9:	74 2b                	je     801be6 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801bbb:	41 89 c1             	mov    %eax,%r9d
+  801bbe:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801bc4:	4c 89 f1             	mov    %r14,%rcx
+  801bc7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bcc:	48 89 de             	mov    %rbx,%rsi
+  801bcf:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bd4:	48 b8 f2 13 80 00 00 	movabs $0x8013f2,%rax
+  801bdb:	00 00 00 
+  801bde:	ff d0                	call   *%rax
+  801be0:	89 c3                	mov    %eax,%ebx
+  801be2:	85 c0                	test   %eax,%eax
+  801be4:	78 4e                	js     801c34 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801be6:	4c 89 ff             	mov    %r15,%rdi
+  801be9:	48 b8 ab 41 80 00 00 	movabs $0x8041ab,%rax
+  801bf0:	00 00 00 
+  801bf3:	ff d0                	call   *%rax
+  801bf5:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801bf8:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801bfe:	4c 89 e9             	mov    %r13,%rcx
+  801c01:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c06:	4c 89 fe             	mov    %r15,%rsi
+  801c09:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c0e:	48 b8 f2 13 80 00 00 	movabs $0x8013f2,%rax
+  801c15:	00 00 00 
+  801c18:	ff d0                	call   *%rax
+  801c1a:	89 c3                	mov    %eax,%ebx
+  801c1c:	85 c0                	test   %eax,%eax
+  801c1e:	78 14                	js     801c34 <dup+0xf7>
+
+    return newfdnum;
+  801c20:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801c23:	89 d8                	mov    %ebx,%eax
+  801c25:	48 83 c4 18          	add    $0x18,%rsp
+  801c29:	5b                   	pop    %rbx
+  801c2a:	41 5c                	pop    %r12
+  801c2c:	41 5d                	pop    %r13
+  801c2e:	41 5e                	pop    %r14
+  801c30:	41 5f                	pop    %r15
+  801c32:	5d                   	pop    %rbp
+  801c33:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801c34:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c39:	4c 89 ee             	mov    %r13,%rsi
+  801c3c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c41:	49 bc 42 14 80 00 00 	movabs $0x801442,%r12
+  801c48:	00 00 00 
+  801c4b:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801c4e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c53:	4c 89 f6             	mov    %r14,%rsi
+  801c56:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c5b:	41 ff d4             	call   *%r12
+    return res;
+  801c5e:	eb c3                	jmp    801c23 <dup+0xe6>
+
+0000000000801c60 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801c60:	55                   	push   %rbp
+  801c61:	48 89 e5             	mov    %rsp,%rbp
+  801c64:	41 56                	push   %r14
+  801c66:	41 55                	push   %r13
+  801c68:	41 54                	push   %r12
+  801c6a:	53                   	push   %rbx
+  801c6b:	48 83 ec 10          	sub    $0x10,%rsp
+  801c6f:	89 fb                	mov    %edi,%ebx
+  801c71:	49 89 f4             	mov    %rsi,%r12
+  801c74:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c77:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c7b:	48 b8 7d 19 80 00 00 	movabs $0x80197d,%rax
+  801c82:	00 00 00 
+  801c85:	ff d0                	call   *%rax
+  801c87:	85 c0                	test   %eax,%eax
+  801c89:	78 4c                	js     801cd7 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c8b:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801c8f:	41 8b 3e             	mov    (%r14),%edi
+  801c92:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c96:	48 b8 c8 19 80 00 00 	movabs $0x8019c8,%rax
+  801c9d:	00 00 00 
+  801ca0:	ff d0                	call   *%rax
+  801ca2:	85 c0                	test   %eax,%eax
+  801ca4:	78 35                	js     801cdb <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801ca6:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801caa:	83 e0 03             	and    $0x3,%eax
+  801cad:	83 f8 01             	cmp    $0x1,%eax
+  801cb0:	74 2d                	je     801cdf <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801cb2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801cb6:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801cba:	48 85 c0             	test   %rax,%rax
+  801cbd:	74 56                	je     801d15 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801cbf:	4c 89 ea             	mov    %r13,%rdx
+  801cc2:	4c 89 e6             	mov    %r12,%rsi
+  801cc5:	4c 89 f7             	mov    %r14,%rdi
+  801cc8:	ff d0                	call   *%rax
+}
+  801cca:	48 83 c4 10          	add    $0x10,%rsp
+  801cce:	5b                   	pop    %rbx
+  801ccf:	41 5c                	pop    %r12
+  801cd1:	41 5d                	pop    %r13
+  801cd3:	41 5e                	pop    %r14
+  801cd5:	5d                   	pop    %rbp
+  801cd6:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801cd7:	48 98                	cltq
+  801cd9:	eb ef                	jmp    801cca <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801cdb:	48 98                	cltq
+  801cdd:	eb eb                	jmp    801cca <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801cdf:	48 a1 00 04 81 00 00 	movabs 0x810400,%rax
+  801ce6:	00 00 00 
+  801ce9:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801cef:	89 da                	mov    %ebx,%edx
+  801cf1:	48 bf d1 52 80 00 00 	movabs $0x8052d1,%rdi
+  801cf8:	00 00 00 
+  801cfb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d00:	48 b9 18 05 80 00 00 	movabs $0x800518,%rcx
+  801d07:	00 00 00 
+  801d0a:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801d0c:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801d13:	eb b5                	jmp    801cca <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801d15:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801d1c:	eb ac                	jmp    801cca <read+0x6a>
+
+0000000000801d1e <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801d1e:	55                   	push   %rbp
+  801d1f:	48 89 e5             	mov    %rsp,%rbp
+  801d22:	41 57                	push   %r15
+  801d24:	41 56                	push   %r14
+  801d26:	41 55                	push   %r13
+  801d28:	41 54                	push   %r12
+  801d2a:	53                   	push   %rbx
+  801d2b:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801d2f:	48 85 d2             	test   %rdx,%rdx
+  801d32:	74 54                	je     801d88 <readn+0x6a>
+  801d34:	41 89 fd             	mov    %edi,%r13d
+  801d37:	49 89 f6             	mov    %rsi,%r14
+  801d3a:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801d3d:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801d42:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801d47:	49 bf 60 1c 80 00 00 	movabs $0x801c60,%r15
+  801d4e:	00 00 00 
+  801d51:	4c 89 e2             	mov    %r12,%rdx
+  801d54:	48 29 f2             	sub    %rsi,%rdx
+  801d57:	4c 01 f6             	add    %r14,%rsi
+  801d5a:	44 89 ef             	mov    %r13d,%edi
+  801d5d:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801d60:	85 c0                	test   %eax,%eax
+  801d62:	78 20                	js     801d84 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801d64:	01 c3                	add    %eax,%ebx
+  801d66:	85 c0                	test   %eax,%eax
+  801d68:	74 08                	je     801d72 <readn+0x54>
+  801d6a:	48 63 f3             	movslq %ebx,%rsi
+  801d6d:	4c 39 e6             	cmp    %r12,%rsi
+  801d70:	72 df                	jb     801d51 <readn+0x33>
+    }
+    return res;
+  801d72:	48 63 c3             	movslq %ebx,%rax
+}
+  801d75:	48 83 c4 08          	add    $0x8,%rsp
+  801d79:	5b                   	pop    %rbx
+  801d7a:	41 5c                	pop    %r12
+  801d7c:	41 5d                	pop    %r13
+  801d7e:	41 5e                	pop    %r14
+  801d80:	41 5f                	pop    %r15
+  801d82:	5d                   	pop    %rbp
+  801d83:	c3                   	ret
+        if (inc < 0) return inc;
+  801d84:	48 98                	cltq
+  801d86:	eb ed                	jmp    801d75 <readn+0x57>
+    int inc = 1, res = 0;
+  801d88:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d8d:	eb e3                	jmp    801d72 <readn+0x54>
+
+0000000000801d8f <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801d8f:	55                   	push   %rbp
+  801d90:	48 89 e5             	mov    %rsp,%rbp
+  801d93:	41 56                	push   %r14
+  801d95:	41 55                	push   %r13
+  801d97:	41 54                	push   %r12
+  801d99:	53                   	push   %rbx
+  801d9a:	48 83 ec 10          	sub    $0x10,%rsp
+  801d9e:	89 fb                	mov    %edi,%ebx
+  801da0:	49 89 f4             	mov    %rsi,%r12
+  801da3:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801da6:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801daa:	48 b8 7d 19 80 00 00 	movabs $0x80197d,%rax
+  801db1:	00 00 00 
+  801db4:	ff d0                	call   *%rax
+  801db6:	85 c0                	test   %eax,%eax
+  801db8:	78 47                	js     801e01 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801dba:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801dbe:	41 8b 3e             	mov    (%r14),%edi
+  801dc1:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801dc5:	48 b8 c8 19 80 00 00 	movabs $0x8019c8,%rax
+  801dcc:	00 00 00 
+  801dcf:	ff d0                	call   *%rax
+  801dd1:	85 c0                	test   %eax,%eax
+  801dd3:	78 30                	js     801e05 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801dd5:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801dda:	74 2d                	je     801e09 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801ddc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801de0:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801de4:	48 85 c0             	test   %rax,%rax
+  801de7:	74 56                	je     801e3f <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801de9:	4c 89 ea             	mov    %r13,%rdx
+  801dec:	4c 89 e6             	mov    %r12,%rsi
+  801def:	4c 89 f7             	mov    %r14,%rdi
+  801df2:	ff d0                	call   *%rax
+}
+  801df4:	48 83 c4 10          	add    $0x10,%rsp
+  801df8:	5b                   	pop    %rbx
+  801df9:	41 5c                	pop    %r12
+  801dfb:	41 5d                	pop    %r13
+  801dfd:	41 5e                	pop    %r14
+  801dff:	5d                   	pop    %rbp
+  801e00:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e01:	48 98                	cltq
+  801e03:	eb ef                	jmp    801df4 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e05:	48 98                	cltq
+  801e07:	eb eb                	jmp    801df4 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e09:	48 a1 00 04 81 00 00 	movabs 0x810400,%rax
+  801e10:	00 00 00 
+  801e13:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801e19:	89 da                	mov    %ebx,%edx
+  801e1b:	48 bf ed 52 80 00 00 	movabs $0x8052ed,%rdi
+  801e22:	00 00 00 
+  801e25:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e2a:	48 b9 18 05 80 00 00 	movabs $0x800518,%rcx
+  801e31:	00 00 00 
+  801e34:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e36:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801e3d:	eb b5                	jmp    801df4 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801e3f:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801e46:	eb ac                	jmp    801df4 <write+0x65>
+
+0000000000801e48 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801e48:	55                   	push   %rbp
+  801e49:	48 89 e5             	mov    %rsp,%rbp
+  801e4c:	41 54                	push   %r12
+  801e4e:	53                   	push   %rbx
+  801e4f:	48 83 ec 10          	sub    $0x10,%rsp
+  801e53:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e55:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801e59:	48 b8 7d 19 80 00 00 	movabs $0x80197d,%rax
+  801e60:	00 00 00 
+  801e63:	ff d0                	call   *%rax
+  801e65:	85 c0                	test   %eax,%eax
+  801e67:	78 3e                	js     801ea7 <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e69:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801e6d:	41 8b 3c 24          	mov    (%r12),%edi
+  801e71:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801e75:	48 b8 c8 19 80 00 00 	movabs $0x8019c8,%rax
+  801e7c:	00 00 00 
+  801e7f:	ff d0                	call   *%rax
+  801e81:	85 c0                	test   %eax,%eax
+  801e83:	78 22                	js     801ea7 <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  801e85:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801e89:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801e8d:	48 85 c0             	test   %rax,%rax
+  801e90:	74 0b                	je     801e9d <seek+0x55>
+  801e92:	89 de                	mov    %ebx,%esi
+  801e94:	4c 89 e7             	mov    %r12,%rdi
+  801e97:	ff d0                	call   *%rax
+  801e99:	85 c0                	test   %eax,%eax
+  801e9b:	78 0a                	js     801ea7 <seek+0x5f>
+
+    fd->fd_offset = offset;
+  801e9d:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  801ea2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ea7:	48 83 c4 10          	add    $0x10,%rsp
+  801eab:	5b                   	pop    %rbx
+  801eac:	41 5c                	pop    %r12
+  801eae:	5d                   	pop    %rbp
+  801eaf:	c3                   	ret
+
+0000000000801eb0 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801eb0:	55                   	push   %rbp
+  801eb1:	48 89 e5             	mov    %rsp,%rbp
+  801eb4:	41 55                	push   %r13
+  801eb6:	41 54                	push   %r12
+  801eb8:	53                   	push   %rbx
+  801eb9:	48 83 ec 18          	sub    $0x18,%rsp
+  801ebd:	89 fb                	mov    %edi,%ebx
+  801ebf:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ec2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ec6:	48 b8 7d 19 80 00 00 	movabs $0x80197d,%rax
+  801ecd:	00 00 00 
+  801ed0:	ff d0                	call   *%rax
+  801ed2:	85 c0                	test   %eax,%eax
+  801ed4:	78 38                	js     801f0e <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ed6:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801eda:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801ede:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ee2:	48 b8 c8 19 80 00 00 	movabs $0x8019c8,%rax
+  801ee9:	00 00 00 
+  801eec:	ff d0                	call   *%rax
+  801eee:	85 c0                	test   %eax,%eax
+  801ef0:	78 1c                	js     801f0e <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ef2:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801ef7:	74 20                	je     801f19 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801ef9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801efd:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801f01:	48 85 c0             	test   %rax,%rax
+  801f04:	74 47                	je     801f4d <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801f06:	44 89 e6             	mov    %r12d,%esi
+  801f09:	4c 89 ef             	mov    %r13,%rdi
+  801f0c:	ff d0                	call   *%rax
+}
+  801f0e:	48 83 c4 18          	add    $0x18,%rsp
+  801f12:	5b                   	pop    %rbx
+  801f13:	41 5c                	pop    %r12
+  801f15:	41 5d                	pop    %r13
+  801f17:	5d                   	pop    %rbp
+  801f18:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801f19:	48 a1 00 04 81 00 00 	movabs 0x810400,%rax
+  801f20:	00 00 00 
+  801f23:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801f29:	89 da                	mov    %ebx,%edx
+  801f2b:	48 bf b0 52 80 00 00 	movabs $0x8052b0,%rdi
+  801f32:	00 00 00 
+  801f35:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f3a:	48 b9 18 05 80 00 00 	movabs $0x800518,%rcx
+  801f41:	00 00 00 
+  801f44:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801f46:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f4b:	eb c1                	jmp    801f0e <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801f4d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f52:	eb ba                	jmp    801f0e <ftruncate+0x5e>
+
+0000000000801f54 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801f54:	55                   	push   %rbp
+  801f55:	48 89 e5             	mov    %rsp,%rbp
+  801f58:	41 54                	push   %r12
+  801f5a:	53                   	push   %rbx
+  801f5b:	48 83 ec 10          	sub    $0x10,%rsp
+  801f5f:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f62:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f66:	48 b8 7d 19 80 00 00 	movabs $0x80197d,%rax
+  801f6d:	00 00 00 
+  801f70:	ff d0                	call   *%rax
+  801f72:	85 c0                	test   %eax,%eax
+  801f74:	78 4e                	js     801fc4 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f76:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801f7a:	41 8b 3c 24          	mov    (%r12),%edi
+  801f7e:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801f82:	48 b8 c8 19 80 00 00 	movabs $0x8019c8,%rax
+  801f89:	00 00 00 
+  801f8c:	ff d0                	call   *%rax
+  801f8e:	85 c0                	test   %eax,%eax
+  801f90:	78 32                	js     801fc4 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801f92:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801f96:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801f9b:	74 30                	je     801fcd <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801f9d:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801fa0:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801fa7:	00 00 00 
+    stat->st_isdir = 0;
+  801faa:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801fb1:	00 00 00 
+    stat->st_dev = dev;
+  801fb4:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801fbb:	48 89 de             	mov    %rbx,%rsi
+  801fbe:	4c 89 e7             	mov    %r12,%rdi
+  801fc1:	ff 50 28             	call   *0x28(%rax)
+}
+  801fc4:	48 83 c4 10          	add    $0x10,%rsp
+  801fc8:	5b                   	pop    %rbx
+  801fc9:	41 5c                	pop    %r12
+  801fcb:	5d                   	pop    %rbp
+  801fcc:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801fcd:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801fd2:	eb f0                	jmp    801fc4 <fstat+0x70>
+
+0000000000801fd4 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801fd4:	55                   	push   %rbp
+  801fd5:	48 89 e5             	mov    %rsp,%rbp
+  801fd8:	41 54                	push   %r12
+  801fda:	53                   	push   %rbx
+  801fdb:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801fde:	be 00 00 00 00       	mov    $0x0,%esi
+  801fe3:	48 b8 42 31 80 00 00 	movabs $0x803142,%rax
+  801fea:	00 00 00 
+  801fed:	ff d0                	call   *%rax
+  801fef:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801ff1:	85 c0                	test   %eax,%eax
+  801ff3:	78 25                	js     80201a <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801ff5:	4c 89 e6             	mov    %r12,%rsi
+  801ff8:	89 c7                	mov    %eax,%edi
+  801ffa:	48 b8 54 1f 80 00 00 	movabs $0x801f54,%rax
+  802001:	00 00 00 
+  802004:	ff d0                	call   *%rax
+  802006:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802009:	89 df                	mov    %ebx,%edi
+  80200b:	48 b8 e2 1a 80 00 00 	movabs $0x801ae2,%rax
+  802012:	00 00 00 
+  802015:	ff d0                	call   *%rax
+
+    return res;
+  802017:	44 89 e3             	mov    %r12d,%ebx
+}
+  80201a:	89 d8                	mov    %ebx,%eax
+  80201c:	5b                   	pop    %rbx
+  80201d:	41 5c                	pop    %r12
+  80201f:	5d                   	pop    %rbp
+  802020:	c3                   	ret
+
+0000000000802021 <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  802021:	48 b8 08 00 82 00 00 	movabs $0x820008,%rax
+  802028:	00 00 00 
+  80202b:	83 38 00             	cmpl   $0x0,(%rax)
+  80202e:	74 0a                	je     80203a <fsenv+0x19>
+    return envid;
+}
+  802030:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  802037:	00 00 
+  802039:	c3                   	ret
+fsenv(void) {
+  80203a:	55                   	push   %rbp
+  80203b:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  80203e:	bf 03 00 00 00       	mov    $0x3,%edi
+  802043:	48 b8 0e 4b 80 00 00 	movabs $0x804b0e,%rax
+  80204a:	00 00 00 
+  80204d:	ff d0                	call   *%rax
+  80204f:	a3 08 00 82 00 00 00 	movabs %eax,0x820008
+  802056:	00 00 
+}
+  802058:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  80205f:	00 00 
+  802061:	5d                   	pop    %rbp
+  802062:	c3                   	ret
+
+0000000000802063 <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  802063:	55                   	push   %rbp
+  802064:	48 89 e5             	mov    %rsp,%rbp
+  802067:	41 54                	push   %r12
+  802069:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  80206a:	ba 00 50 00 00       	mov    $0x5000,%edx
+  80206f:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  802074:	48 89 de             	mov    %rbx,%rsi
+  802077:	bf 00 00 00 00       	mov    $0x0,%edi
+  80207c:	48 b8 42 14 80 00 00 	movabs $0x801442,%rax
+  802083:	00 00 00 
+  802086:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  802088:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  80208f:	00 00 00 
+  802092:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  802098:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80209d:	ba 00 50 00 00       	mov    $0x5000,%edx
+  8020a2:	48 89 de             	mov    %rbx,%rsi
+  8020a5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020aa:	48 b8 9c 13 80 00 00 	movabs $0x80139c,%rax
+  8020b1:	00 00 00 
+  8020b4:	ff d0                	call   *%rax
+  8020b6:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  8020b8:	85 c0                	test   %eax,%eax
+  8020ba:	0f 88 a2 00 00 00    	js     802162 <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  8020c0:	48 a1 00 04 81 00 00 	movabs 0x810400,%rax
+  8020c7:	00 00 00 
+  8020ca:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8020d0:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  8020d5:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  8020d7:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  8020dc:	49 bc 73 43 80 00 00 	movabs $0x804373,%r12
+  8020e3:	00 00 00 
+  8020e6:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  8020e9:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  8020ee:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  8020f1:	48 b8 21 20 80 00 00 	movabs $0x802021,%rax
+  8020f8:	00 00 00 
+  8020fb:	ff d0                	call   *%rax
+  8020fd:	89 c7                	mov    %eax,%edi
+  8020ff:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  802105:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  80210a:	48 89 da             	mov    %rbx,%rdx
+  80210d:	be 09 00 00 00       	mov    $0x9,%esi
+  802112:	48 b8 b8 4a 80 00 00 	movabs $0x804ab8,%rax
+  802119:	00 00 00 
+  80211c:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  80211e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802123:	ba 00 00 00 00       	mov    $0x0,%edx
+  802128:	be 00 00 00 00       	mov    $0x0,%esi
+  80212d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802132:	48 b8 94 4a 80 00 00 	movabs $0x804a94,%rax
+  802139:	00 00 00 
+  80213c:	ff d0                	call   *%rax
+  80213e:	89 c3                	mov    %eax,%ebx
+  802140:	85 c0                	test   %eax,%eax
+  802142:	78 25                	js     802169 <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  802144:	48 a1 00 04 81 00 00 	movabs 0x810400,%rax
+  80214b:	00 00 00 
+  80214e:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802154:	a3 00 26 82 00 00 00 	movabs %eax,0x822600
+  80215b:	00 00 
+    return 0;
+  80215d:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  802162:	89 d8                	mov    %ebx,%eax
+  802164:	5b                   	pop    %rbx
+  802165:	41 5c                	pop    %r12
+  802167:	5d                   	pop    %rbp
+  802168:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  802169:	ba 00 50 00 00       	mov    $0x5000,%edx
+  80216e:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  802173:	bf 00 00 00 00       	mov    $0x0,%edi
+  802178:	48 b8 42 14 80 00 00 	movabs $0x801442,%rax
+  80217f:	00 00 00 
+  802182:	ff d0                	call   *%rax
+        return res;
+  802184:	eb dc                	jmp    802162 <fschan_setup+0xff>
+
+0000000000802186 <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  802186:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  80218d:	00 00 00 
+  802190:	80 38 00             	cmpb   $0x0,(%rax)
+  802193:	74 55                	je     8021ea <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802195:	48 a1 00 04 81 00 00 	movabs 0x810400,%rax
+  80219c:	00 00 00 
+  80219f:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  8021a5:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  8021aa:	48 ba 00 26 82 00 00 	movabs $0x822600,%rdx
+  8021b1:	00 00 00 
+  8021b4:	3b 0a                	cmp    (%rdx),%ecx
+  8021b6:	75 01                	jne    8021b9 <fschan+0x33>
+}
+  8021b8:	c3                   	ret
+fschan(void) {
+  8021b9:	55                   	push   %rbp
+  8021ba:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  8021bd:	48 b8 63 20 80 00 00 	movabs $0x802063,%rax
+  8021c4:	00 00 00 
+  8021c7:	ff d0                	call   *%rax
+  8021c9:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  8021cb:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  8021d0:	85 d2                	test   %edx,%edx
+  8021d2:	78 02                	js     8021d6 <fschan+0x50>
+}
+  8021d4:	5d                   	pop    %rbp
+  8021d5:	c3                   	ret
+        fschan_enabled = 0;
+  8021d6:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  8021dd:	00 00 00 
+  8021e0:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  8021e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021e8:	eb ea                	jmp    8021d4 <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  8021ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021ef:	c3                   	ret
+
+00000000008021f0 <fbuf>:
+fbuf(struct Fd *fd) {
+  8021f0:	55                   	push   %rbp
+  8021f1:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  8021f4:	48 b8 ef 18 80 00 00 	movabs $0x8018ef,%rax
+  8021fb:	00 00 00 
+  8021fe:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  802200:	ba 00 00 00 00       	mov    $0x0,%edx
+  802205:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802209:	77 12                	ja     80221d <fbuf+0x2d>
+  80220b:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  80220f:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802216:	00 00 00 
+  802219:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  80221d:	48 89 d0             	mov    %rdx,%rax
+  802220:	5d                   	pop    %rbp
+  802221:	c3                   	ret
+
+0000000000802222 <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  802222:	55                   	push   %rbp
+  802223:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  802226:	48 83 c7 40          	add    $0x40,%rdi
+  80222a:	48 b8 ad 43 80 00 00 	movabs $0x8043ad,%rax
+  802231:	00 00 00 
+  802234:	ff d0                	call   *%rax
+  802236:	84 c0                	test   %al,%al
+  802238:	75 02                	jne    80223c <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  80223a:	5d                   	pop    %rbp
+  80223b:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  80223c:	48 b8 21 20 80 00 00 	movabs $0x802021,%rax
+  802243:	00 00 00 
+  802246:	ff d0                	call   *%rax
+  802248:	89 c7                	mov    %eax,%edi
+  80224a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802250:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802255:	ba 00 00 00 00       	mov    $0x0,%edx
+  80225a:	be 0a 00 00 00       	mov    $0xa,%esi
+  80225f:	48 b8 b8 4a 80 00 00 	movabs $0x804ab8,%rax
+  802266:	00 00 00 
+  802269:	ff d0                	call   *%rax
+}
+  80226b:	eb cd                	jmp    80223a <fschan_publish+0x18>
+
+000000000080226d <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  80226d:	55                   	push   %rbp
+  80226e:	48 89 e5             	mov    %rsp,%rbp
+  802271:	41 57                	push   %r15
+  802273:	41 56                	push   %r14
+  802275:	41 55                	push   %r13
+  802277:	41 54                	push   %r12
+  802279:	53                   	push   %rbx
+  80227a:	48 83 ec 48          	sub    $0x48,%rsp
+  80227e:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802282:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  802286:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  802289:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  80228d:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  802290:	48 ba 04 00 82 00 00 	movabs $0x820004,%rdx
+  802297:	00 00 00 
+  80229a:	8b 02                	mov    (%rdx),%eax
+  80229c:	83 c0 01             	add    $0x1,%eax
+  80229f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8022a4:	0f 44 c1             	cmove  %ecx,%eax
+  8022a7:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  8022a9:	4d 85 c0             	test   %r8,%r8
+  8022ac:	74 2c                	je     8022da <fschan_rw+0x6d>
+  8022ae:	45 89 ce             	mov    %r9d,%r14d
+  8022b1:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  8022b8:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  8022bc:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8022c2:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  8022c9:	00 
+  8022ca:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8022d0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022d5:	e9 41 01 00 00       	jmp    80241b <fschan_rw+0x1ae>
+  8022da:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  8022de:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8022e2:	e9 9c 01 00 00       	jmp    802483 <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  8022e7:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8022eb:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  8022ee:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  8022f1:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  8022f4:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  8022f8:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8022fc:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  802300:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  802304:	48 89 da             	mov    %rbx,%rdx
+  802307:	48 b8 9e 10 80 00 00 	movabs $0x80109e,%rax
+  80230e:	00 00 00 
+  802311:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  802313:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802317:	48 b8 22 22 80 00 00 	movabs $0x802222,%rax
+  80231e:	00 00 00 
+  802321:	ff d0                	call   *%rax
+            queued += blk;
+  802323:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  802326:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  80232a:	4d 39 fc             	cmp    %r15,%r12
+  80232d:	73 6b                	jae    80239a <fschan_rw+0x12d>
+  80232f:	41 83 fd 0f          	cmp    $0xf,%r13d
+  802333:	77 65                	ja     80239a <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  802335:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802339:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  80233d:	48 b8 88 43 80 00 00 	movabs $0x804388,%rax
+  802344:	00 00 00 
+  802347:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  802349:	4c 89 fb             	mov    %r15,%rbx
+  80234c:	4c 29 e3             	sub    %r12,%rbx
+  80234f:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  802354:	48 39 d3             	cmp    %rdx,%rbx
+  802357:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  80235b:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  80235f:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802363:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  802367:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  80236a:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  80236c:	48 b9 04 00 82 00 00 	movabs $0x820004,%rcx
+  802373:	00 00 00 
+  802376:	8b 09                	mov    (%rcx),%ecx
+  802378:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  80237b:	83 fe 03             	cmp    $0x3,%esi
+  80237e:	0f 85 63 ff ff ff    	jne    8022e7 <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  802384:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802388:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  80238b:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  80238e:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  802391:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  802395:	e9 79 ff ff ff       	jmp    802313 <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  80239a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80239e:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  8023a5:	48 89 df             	mov    %rbx,%rdi
+  8023a8:	48 b8 4b 44 80 00 00 	movabs $0x80444b,%rax
+  8023af:	00 00 00 
+  8023b2:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  8023b4:	48 89 df             	mov    %rbx,%rdi
+  8023b7:	48 b8 d9 43 80 00 00 	movabs $0x8043d9,%rax
+  8023be:	00 00 00 
+  8023c1:	ff d0                	call   *%rax
+  8023c3:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  8023c7:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  8023cb:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  8023cf:	75 25                	jne    8023f6 <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  8023d1:	8b 40 04             	mov    0x4(%rax),%eax
+  8023d4:	85 c0                	test   %eax,%eax
+  8023d6:	0f 88 86 00 00 00    	js     802462 <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  8023dc:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  8023e0:	74 5b                	je     80243d <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  8023e2:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8023e6:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  8023ea:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  8023ee:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  8023f2:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  8023f6:	48 89 df             	mov    %rbx,%rdi
+  8023f9:	48 b8 00 44 80 00 00 	movabs $0x804400,%rax
+  802400:	00 00 00 
+  802403:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  802405:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  802409:	83 f0 01             	xor    $0x1,%eax
+  80240c:	4d 39 fc             	cmp    %r15,%r12
+  80240f:	0f 92 c2             	setb   %dl
+  802412:	84 c2                	test   %al,%dl
+  802414:	75 05                	jne    80241b <fschan_rw+0x1ae>
+  802416:	45 85 ed             	test   %r13d,%r13d
+  802419:	74 50                	je     80246b <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  80241b:	4d 39 fc             	cmp    %r15,%r12
+  80241e:	0f 92 c1             	setb   %cl
+  802421:	41 83 fd 0f          	cmp    $0xf,%r13d
+  802425:	0f 96 c2             	setbe  %dl
+  802428:	84 d1                	test   %dl,%cl
+  80242a:	0f 84 6a ff ff ff    	je     80239a <fschan_rw+0x12d>
+  802430:	84 c0                	test   %al,%al
+  802432:	0f 85 fd fe ff ff    	jne    802335 <fschan_rw+0xc8>
+  802438:	e9 5d ff ff ff       	jmp    80239a <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  80243d:	48 63 d0             	movslq %eax,%rdx
+  802440:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802444:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  802448:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80244c:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  802450:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  802454:	48 b8 9e 10 80 00 00 	movabs $0x80109e,%rax
+  80245b:	00 00 00 
+  80245e:	ff d0                	call   *%rax
+  802460:	eb 80                	jmp    8023e2 <fschan_rw+0x175>
+                err = msg->fm_res;
+  802462:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  802465:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  802469:	eb 8b                	jmp    8023f6 <fschan_rw+0x189>
+    return done || !err ? done : err;
+  80246b:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  802470:	0f 85 68 fe ff ff    	jne    8022de <fschan_rw+0x71>
+  802476:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  802479:	85 c0                	test   %eax,%eax
+  80247b:	0f 84 5d fe ff ff    	je     8022de <fschan_rw+0x71>
+  802481:	48 98                	cltq
+}
+  802483:	48 83 c4 48          	add    $0x48,%rsp
+  802487:	5b                   	pop    %rbx
+  802488:	41 5c                	pop    %r12
+  80248a:	41 5d                	pop    %r13
+  80248c:	41 5e                	pop    %r14
+  80248e:	41 5f                	pop    %r15
+  802490:	5d                   	pop    %rbp
+  802491:	c3                   	ret
+
+0000000000802492 <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  802492:	55                   	push   %rbp
+  802493:	48 89 e5             	mov    %rsp,%rbp
+  802496:	41 56                	push   %r14
+  802498:	41 55                	push   %r13
+  80249a:	41 54                	push   %r12
+  80249c:	53                   	push   %rbx
+  80249d:	48 83 ec 10          	sub    $0x10,%rsp
+  8024a1:	49 89 fe             	mov    %rdi,%r14
+  8024a4:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  8024a7:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  8024ab:	48 29 f3             	sub    %rsi,%rbx
+  8024ae:	48 39 d3             	cmp    %rdx,%rbx
+  8024b1:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  8024b5:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8024bc:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  8024bd:	bf 00 10 00 00       	mov    $0x1000,%edi
+  8024c2:	49 bd 0a 42 80 00 00 	movabs $0x80420a,%r13
+  8024c9:	00 00 00 
+  8024cc:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  8024d3:	76 1e                	jbe    8024f3 <mmap_fault+0x61>
+  8024d5:	4c 01 e7             	add    %r12,%rdi
+  8024d8:	41 ff d5             	call   *%r13
+  8024db:	84 c0                	test   %al,%al
+  8024dd:	75 14                	jne    8024f3 <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  8024df:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8024e3:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  8024ea:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  8024ee:	48 39 df             	cmp    %rbx,%rdi
+  8024f1:	72 e2                	jb     8024d5 <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  8024f3:	48 bb 00 10 82 00 00 	movabs $0x821000,%rbx
+  8024fa:	00 00 00 
+  8024fd:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  802504:	00 00 00 
+  802507:	4c 89 f0             	mov    %r14,%rax
+  80250a:	48 29 d0             	sub    %rdx,%rax
+  80250d:	48 c1 f8 03          	sar    $0x3,%rax
+  802511:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  802518:	aa aa aa 
+  80251b:	48 0f af c2          	imul   %rdx,%rax
+  80251f:	48 c1 e0 0c          	shl    $0xc,%rax
+  802523:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  802528:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  80252c:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  80252e:	44 89 e0             	mov    %r12d,%eax
+  802531:	41 03 46 10          	add    0x10(%r14),%eax
+  802535:	41 2b 06             	sub    (%r14),%eax
+  802538:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  80253b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80253f:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  802543:	41 8b 46 14          	mov    0x14(%r14),%eax
+  802547:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  80254a:	48 b8 21 20 80 00 00 	movabs $0x802021,%rax
+  802551:	00 00 00 
+  802554:	ff d0                	call   *%rax
+  802556:	89 c7                	mov    %eax,%edi
+  802558:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80255e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802563:	48 89 da             	mov    %rbx,%rdx
+  802566:	be 0f 00 00 00       	mov    $0xf,%esi
+  80256b:	48 b8 b8 4a 80 00 00 	movabs $0x804ab8,%rax
+  802572:	00 00 00 
+  802575:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  802577:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80257c:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802580:	4c 89 e6             	mov    %r12,%rsi
+  802583:	bf 00 00 00 00       	mov    $0x0,%edi
+  802588:	48 b8 94 4a 80 00 00 	movabs $0x804a94,%rax
+  80258f:	00 00 00 
+  802592:	ff d0                	call   *%rax
+  802594:	48 98                	cltq
+}
+  802596:	48 83 c4 10          	add    $0x10,%rsp
+  80259a:	5b                   	pop    %rbx
+  80259b:	41 5c                	pop    %r12
+  80259d:	41 5d                	pop    %r13
+  80259f:	41 5e                	pop    %r14
+  8025a1:	5d                   	pop    %rbp
+  8025a2:	c3                   	ret
+
+00000000008025a3 <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  8025a3:	48 8b 37             	mov    (%rdi),%rsi
+  8025a6:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  8025ad:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  8025b4:	00 00 00 
+  8025b7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025bc:	eb 0f                	jmp    8025cd <mmap_pgfault+0x2a>
+  8025be:	c3                   	ret
+  8025bf:	48 83 c1 01          	add    $0x1,%rcx
+  8025c3:	48 83 c2 18          	add    $0x18,%rdx
+  8025c7:	48 83 f9 20          	cmp    $0x20,%rcx
+  8025cb:	74 6e                	je     80263b <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  8025cd:	48 8b 02             	mov    (%rdx),%rax
+  8025d0:	48 83 e8 01          	sub    $0x1,%rax
+  8025d4:	48 39 f0             	cmp    %rsi,%rax
+  8025d7:	73 e6                	jae    8025bf <mmap_pgfault+0x1c>
+  8025d9:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  8025dd:	73 e0                	jae    8025bf <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  8025df:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  8025e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025e8:	f6 c2 01             	test   $0x1,%dl
+  8025eb:	75 d1                	jne    8025be <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  8025ed:	f6 c2 02             	test   $0x2,%dl
+  8025f0:	74 1a                	je     80260c <mmap_pgfault+0x69>
+  8025f2:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  8025f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025fb:	48 bf 00 20 82 00 00 	movabs $0x822000,%rdi
+  802602:	00 00 00 
+  802605:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  80260a:	74 35                	je     802641 <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  80260c:	55                   	push   %rbp
+  80260d:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  802610:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  802614:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  80261b:	00 00 00 
+  80261e:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  802622:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802627:	48 b8 92 24 80 00 00 	movabs $0x802492,%rax
+  80262e:	00 00 00 
+  802631:	ff d0                	call   *%rax
+  802633:	48 85 c0             	test   %rax,%rax
+  802636:	0f 9f c0             	setg   %al
+}
+  802639:	5d                   	pop    %rbp
+  80263a:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  80263b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802640:	c3                   	ret
+}
+  802641:	c3                   	ret
+
+0000000000802642 <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  802642:	55                   	push   %rbp
+  802643:	48 89 e5             	mov    %rsp,%rbp
+  802646:	41 54                	push   %r12
+  802648:	53                   	push   %rbx
+  802649:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80264c:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  802653:	00 00 00 
+  802656:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  80265b:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80265f:	74 15                	je     802676 <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802661:	48 83 c3 01          	add    $0x1,%rbx
+  802665:	48 83 c0 18          	add    $0x18,%rax
+  802669:	48 83 fb 20          	cmp    $0x20,%rbx
+  80266d:	75 ec                	jne    80265b <mmap_alloc+0x19>
+    return NULL;
+  80266f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802674:	eb 52                	jmp    8026c8 <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  802676:	4c 89 e7             	mov    %r12,%rdi
+  802679:	48 b8 ab 41 80 00 00 	movabs $0x8041ab,%rax
+  802680:	00 00 00 
+  802683:	ff d0                	call   *%rax
+  802685:	41 89 c1             	mov    %eax,%r9d
+  802688:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  80268f:	48 c1 e1 0c          	shl    $0xc,%rcx
+  802693:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802699:	ba 00 00 00 00       	mov    $0x0,%edx
+  80269e:	4c 89 e6             	mov    %r12,%rsi
+  8026a1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8026a6:	48 b8 f2 13 80 00 00 	movabs $0x8013f2,%rax
+  8026ad:	00 00 00 
+  8026b0:	ff d0                	call   *%rax
+  8026b2:	85 c0                	test   %eax,%eax
+  8026b4:	78 17                	js     8026cd <mmap_alloc+0x8b>
+        return &mmaps[i];
+  8026b6:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  8026ba:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8026c1:	00 00 00 
+  8026c4:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  8026c8:	5b                   	pop    %rbx
+  8026c9:	41 5c                	pop    %r12
+  8026cb:	5d                   	pop    %rbp
+  8026cc:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  8026cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026d2:	eb f4                	jmp    8026c8 <mmap_alloc+0x86>
+
+00000000008026d4 <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  8026d4:	55                   	push   %rbp
+  8026d5:	48 89 e5             	mov    %rsp,%rbp
+  8026d8:	41 56                	push   %r14
+  8026da:	41 55                	push   %r13
+  8026dc:	41 54                	push   %r12
+  8026de:	53                   	push   %rbx
+  8026df:	48 83 ec 10          	sub    $0x10,%rsp
+  8026e3:	41 89 fc             	mov    %edi,%r12d
+  8026e6:	49 89 f5             	mov    %rsi,%r13
+  8026e9:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  8026ec:	48 89 f0             	mov    %rsi,%rax
+  8026ef:	48 09 d0             	or     %rdx,%rax
+  8026f2:	75 0d                	jne    802701 <fsipc+0x2d>
+  8026f4:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  8026f7:	83 f8 04             	cmp    $0x4,%eax
+  8026fa:	76 7d                	jbe    802779 <fsipc+0xa5>
+  8026fc:	83 ff 0d             	cmp    $0xd,%edi
+  8026ff:	74 78                	je     802779 <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  802701:	48 b8 21 20 80 00 00 	movabs $0x802021,%rax
+  802708:	00 00 00 
+  80270b:	ff d0                	call   *%rax
+  80270d:	89 c7                	mov    %eax,%edi
+  80270f:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  802716:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  80271d:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  802724:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80272a:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802731:	00 00 00 
+  802734:	44 89 e6             	mov    %r12d,%esi
+  802737:	48 b8 b8 4a 80 00 00 	movabs $0x804ab8,%rax
+  80273e:	00 00 00 
+  802741:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  802743:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  80274a:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  80274b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802750:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802754:	4c 89 ee             	mov    %r13,%rsi
+  802757:	bf 00 00 00 00       	mov    $0x0,%edi
+  80275c:	48 b8 94 4a 80 00 00 	movabs $0x804a94,%rax
+  802763:	00 00 00 
+  802766:	ff d0                	call   *%rax
+  802768:	89 c3                	mov    %eax,%ebx
+}
+  80276a:	89 d8                	mov    %ebx,%eax
+  80276c:	48 83 c4 10          	add    $0x10,%rsp
+  802770:	5b                   	pop    %rbx
+  802771:	41 5c                	pop    %r12
+  802773:	41 5d                	pop    %r13
+  802775:	41 5e                	pop    %r14
+  802777:	5d                   	pop    %rbp
+  802778:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  802779:	48 b8 86 21 80 00 00 	movabs $0x802186,%rax
+  802780:	00 00 00 
+  802783:	ff d0                	call   *%rax
+  802785:	49 89 c6             	mov    %rax,%r14
+  802788:	48 85 c0             	test   %rax,%rax
+  80278b:	0f 84 70 ff ff ff    	je     802701 <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  802791:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  802795:	48 b8 88 43 80 00 00 	movabs $0x804388,%rax
+  80279c:	00 00 00 
+  80279f:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  8027a1:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  8027a4:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  8027ab:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  8027af:	ba 10 00 00 00       	mov    $0x10,%edx
+  8027b4:	48 be 00 00 83 00 00 	movabs $0x830000,%rsi
+  8027bb:	00 00 00 
+  8027be:	48 b8 9e 10 80 00 00 	movabs $0x80109e,%rax
+  8027c5:	00 00 00 
+  8027c8:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  8027ca:	4c 89 f7             	mov    %r14,%rdi
+  8027cd:	48 b8 22 22 80 00 00 	movabs $0x802222,%rax
+  8027d4:	00 00 00 
+  8027d7:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  8027d9:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  8027e0:	4c 89 f7             	mov    %r14,%rdi
+  8027e3:	48 b8 4b 44 80 00 00 	movabs $0x80444b,%rax
+  8027ea:	00 00 00 
+  8027ed:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  8027ef:	4c 89 f7             	mov    %r14,%rdi
+  8027f2:	48 b8 d9 43 80 00 00 	movabs $0x8043d9,%rax
+  8027f9:	00 00 00 
+  8027fc:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  8027fe:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  802801:	41 83 fc 05          	cmp    $0x5,%r12d
+  802805:	75 04                	jne    80280b <fsipc+0x137>
+  802807:	85 db                	test   %ebx,%ebx
+  802809:	79 14                	jns    80281f <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  80280b:	4c 89 f7             	mov    %r14,%rdi
+  80280e:	48 b8 00 44 80 00 00 	movabs $0x804400,%rax
+  802815:	00 00 00 
+  802818:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  80281a:	e9 4b ff ff ff       	jmp    80276a <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  80281f:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  802823:	ba 88 00 00 00       	mov    $0x88,%edx
+  802828:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  80282f:	00 00 00 
+  802832:	48 b8 9e 10 80 00 00 	movabs $0x80109e,%rax
+  802839:	00 00 00 
+  80283c:	ff d0                	call   *%rax
+  80283e:	eb cb                	jmp    80280b <fsipc+0x137>
+
+0000000000802840 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  802840:	55                   	push   %rbp
+  802841:	48 89 e5             	mov    %rsp,%rbp
+  802844:	41 57                	push   %r15
+  802846:	41 56                	push   %r14
+  802848:	41 55                	push   %r13
+  80284a:	41 54                	push   %r12
+  80284c:	53                   	push   %rbx
+  80284d:	48 83 ec 18          	sub    $0x18,%rsp
+  802851:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  802855:	49 89 f6             	mov    %rsi,%r14
+  802858:	49 89 d4             	mov    %rdx,%r12
+  80285b:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  80285e:	48 b8 86 21 80 00 00 	movabs $0x802186,%rax
+  802865:	00 00 00 
+  802868:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  80286a:	48 85 c0             	test   %rax,%rax
+  80286d:	0f 85 96 00 00 00    	jne    802909 <devfile_write_direct+0xc9>
+    size_t write = 0;
+  802873:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80287a:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80287b:	49 bf 00 00 83 00 00 	movabs $0x830000,%r15
+  802882:	00 00 00 
+    while (n) {
+  802885:	4d 85 e4             	test   %r12,%r12
+  802888:	74 79                	je     802903 <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  80288a:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  80288f:	49 39 dc             	cmp    %rbx,%r12
+  802892:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  802896:	48 89 da             	mov    %rbx,%rdx
+  802899:	4c 89 f6             	mov    %r14,%rsi
+  80289c:	48 bf 00 10 83 00 00 	movabs $0x831000,%rdi
+  8028a3:	00 00 00 
+  8028a6:	48 b8 9e 10 80 00 00 	movabs $0x80109e,%rax
+  8028ad:	00 00 00 
+  8028b0:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8028b2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8028b6:	8b 40 0c             	mov    0xc(%rax),%eax
+  8028b9:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  8028bc:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8028bf:	44 01 e8             	add    %r13d,%eax
+  8028c2:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  8028c6:	41 0f 44 c5          	cmove  %r13d,%eax
+  8028ca:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  8028ce:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  8028d2:	48 89 da             	mov    %rbx,%rdx
+  8028d5:	be 00 00 00 00       	mov    $0x0,%esi
+  8028da:	bf 04 00 00 00       	mov    $0x4,%edi
+  8028df:	48 b8 d4 26 80 00 00 	movabs $0x8026d4,%rax
+  8028e6:	00 00 00 
+  8028e9:	ff d0                	call   *%rax
+        if (res < 0)
+  8028eb:	85 c0                	test   %eax,%eax
+  8028ed:	78 4a                	js     802939 <devfile_write_direct+0xf9>
+        buf += res;
+  8028ef:	48 98                	cltq
+  8028f1:	49 01 c6             	add    %rax,%r14
+        write += res;
+  8028f4:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  8028f8:	49 29 c4             	sub    %rax,%r12
+  8028fb:	75 8d                	jne    80288a <devfile_write_direct+0x4a>
+    return write;
+  8028fd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802901:	eb 27                	jmp    80292a <devfile_write_direct+0xea>
+    size_t write = 0;
+  802903:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  802907:	eb f4                	jmp    8028fd <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  802909:	45 89 e9             	mov    %r13d,%r9d
+  80290c:	4d 89 e0             	mov    %r12,%r8
+  80290f:	4c 89 f1             	mov    %r14,%rcx
+  802912:	ba 04 00 00 00       	mov    $0x4,%edx
+  802917:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80291b:	48 89 c7             	mov    %rax,%rdi
+  80291e:	48 b8 6d 22 80 00 00 	movabs $0x80226d,%rax
+  802925:	00 00 00 
+  802928:	ff d0                	call   *%rax
+}
+  80292a:	48 83 c4 18          	add    $0x18,%rsp
+  80292e:	5b                   	pop    %rbx
+  80292f:	41 5c                	pop    %r12
+  802931:	41 5d                	pop    %r13
+  802933:	41 5e                	pop    %r14
+  802935:	41 5f                	pop    %r15
+  802937:	5d                   	pop    %rbp
+  802938:	c3                   	ret
+            return res;
+  802939:	48 98                	cltq
+  80293b:	eb ed                	jmp    80292a <devfile_write_direct+0xea>
+
+000000000080293d <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  80293d:	55                   	push   %rbp
+  80293e:	48 89 e5             	mov    %rsp,%rbp
+  802941:	41 54                	push   %r12
+  802943:	53                   	push   %rbx
+  802944:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  802947:	48 b8 f0 21 80 00 00 	movabs $0x8021f0,%rax
+  80294e:	00 00 00 
+  802951:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  802953:	48 85 c0             	test   %rax,%rax
+  802956:	74 71                	je     8029c9 <fbuf_flush+0x8c>
+  802958:	48 89 c3             	mov    %rax,%rbx
+  80295b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802960:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  802964:	75 05                	jne    80296b <fbuf_flush+0x2e>
+}
+  802966:	5b                   	pop    %rbx
+  802967:	41 5c                	pop    %r12
+  802969:	5d                   	pop    %rbp
+  80296a:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  80296b:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  80296e:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  802972:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802979:	00 00 00 
+  80297c:	48 89 de             	mov    %rbx,%rsi
+  80297f:	48 29 c6             	sub    %rax,%rsi
+  802982:	48 c1 fe 03          	sar    $0x3,%rsi
+  802986:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  80298d:	aa aa aa 
+  802990:	48 0f af f0          	imul   %rax,%rsi
+  802994:	48 c1 e6 0e          	shl    $0xe,%rsi
+  802998:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  80299d:	48 01 c6             	add    %rax,%rsi
+  8029a0:	4c 89 e7             	mov    %r12,%rdi
+  8029a3:	48 b8 40 28 80 00 00 	movabs $0x802840,%rax
+  8029aa:	00 00 00 
+  8029ad:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  8029af:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  8029b3:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  8029ba:	00 
+    return res < 0 ? res : 0;
+  8029bb:	48 85 c0             	test   %rax,%rax
+  8029be:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029c3:	48 0f 4f c2          	cmovg  %rdx,%rax
+  8029c7:	eb 9d                	jmp    802966 <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  8029c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029ce:	eb 96                	jmp    802966 <fbuf_flush+0x29>
+
+00000000008029d0 <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  8029d0:	55                   	push   %rbp
+  8029d1:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  8029d4:	48 b8 3d 29 80 00 00 	movabs $0x80293d,%rax
+  8029db:	00 00 00 
+  8029de:	ff d0                	call   *%rax
+}
+  8029e0:	5d                   	pop    %rbp
+  8029e1:	c3                   	ret
+
+00000000008029e2 <devfile_write>:
+    if (!fd || !buf)
+  8029e2:	48 85 ff             	test   %rdi,%rdi
+  8029e5:	0f 84 d3 01 00 00    	je     802bbe <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8029eb:	55                   	push   %rbp
+  8029ec:	48 89 e5             	mov    %rsp,%rbp
+  8029ef:	41 57                	push   %r15
+  8029f1:	41 56                	push   %r14
+  8029f3:	41 55                	push   %r13
+  8029f5:	41 54                	push   %r12
+  8029f7:	53                   	push   %rbx
+  8029f8:	48 83 ec 08          	sub    $0x8,%rsp
+  8029fc:	49 89 fc             	mov    %rdi,%r12
+  8029ff:	49 89 f6             	mov    %rsi,%r14
+  802a02:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  802a05:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802a0a:	48 85 f6             	test   %rsi,%rsi
+  802a0d:	0f 84 9c 01 00 00    	je     802baf <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  802a13:	48 b8 f0 21 80 00 00 	movabs $0x8021f0,%rax
+  802a1a:	00 00 00 
+  802a1d:	ff d0                	call   *%rax
+  802a1f:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  802a22:	48 85 c0             	test   %rax,%rax
+  802a25:	0f 84 a2 00 00 00    	je     802acd <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802a2b:	be 00 10 00 00       	mov    $0x1000,%esi
+  802a30:	4c 89 e7             	mov    %r12,%rdi
+  802a33:	48 b8 61 13 80 00 00 	movabs $0x801361,%rax
+  802a3a:	00 00 00 
+  802a3d:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  802a3f:	83 f8 02             	cmp    $0x2,%eax
+  802a42:	0f 8f 85 00 00 00    	jg     802acd <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  802a48:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802a4f:	00 00 00 
+  802a52:	4d 89 ef             	mov    %r13,%r15
+  802a55:	49 29 c7             	sub    %rax,%r15
+  802a58:	49 c1 ff 03          	sar    $0x3,%r15
+  802a5c:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802a63:	aa aa aa 
+  802a66:	4c 0f af f8          	imul   %rax,%r15
+  802a6a:	49 c1 e7 0e          	shl    $0xe,%r15
+  802a6e:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802a73:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  802a76:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802a7b:	0f 84 d7 00 00 00    	je     802b58 <devfile_write+0x176>
+  802a81:	49 8b 45 10          	mov    0x10(%r13),%rax
+  802a85:	89 c2                	mov    %eax,%edx
+  802a87:	41 03 55 0c          	add    0xc(%r13),%edx
+  802a8b:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  802a90:	75 0f                	jne    802aa1 <devfile_write+0xbf>
+  802a92:	48 01 d8             	add    %rbx,%rax
+  802a95:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  802a9b:	0f 86 92 00 00 00    	jbe    802b33 <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802aa1:	4c 89 e7             	mov    %r12,%rdi
+  802aa4:	48 b8 3d 29 80 00 00 	movabs $0x80293d,%rax
+  802aab:	00 00 00 
+  802aae:	ff d0                	call   *%rax
+  802ab0:	85 c0                	test   %eax,%eax
+  802ab2:	78 52                	js     802b06 <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802ab4:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802abb:	77 7f                	ja     802b3c <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  802abd:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802ac2:	0f 85 c2 00 00 00    	jne    802b8a <devfile_write+0x1a8>
+  802ac8:	e9 94 00 00 00       	jmp    802b61 <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  802acd:	4c 89 e7             	mov    %r12,%rdi
+  802ad0:	48 b8 3d 29 80 00 00 	movabs $0x80293d,%rax
+  802ad7:	00 00 00 
+  802ada:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802adc:	85 c0                	test   %eax,%eax
+  802ade:	79 07                	jns    802ae7 <devfile_write+0x105>
+  802ae0:	48 98                	cltq
+  802ae2:	e9 c8 00 00 00       	jmp    802baf <devfile_write+0x1cd>
+  802ae7:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802aec:	48 89 da             	mov    %rbx,%rdx
+  802aef:	4c 89 f6             	mov    %r14,%rsi
+  802af2:	4c 89 e7             	mov    %r12,%rdi
+  802af5:	48 b8 40 28 80 00 00 	movabs $0x802840,%rax
+  802afc:	00 00 00 
+  802aff:	ff d0                	call   *%rax
+  802b01:	e9 a9 00 00 00       	jmp    802baf <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802b06:	48 98                	cltq
+  802b08:	e9 a2 00 00 00       	jmp    802baf <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802b0d:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802b12:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802b17:	4c 89 fe             	mov    %r15,%rsi
+  802b1a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b1f:	48 b8 9c 13 80 00 00 	movabs $0x80139c,%rax
+  802b26:	00 00 00 
+  802b29:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  802b2b:	85 c0                	test   %eax,%eax
+  802b2d:	79 45                	jns    802b74 <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802b2f:	48 98                	cltq
+  802b31:	eb 7c                	jmp    802baf <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802b33:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802b3a:	76 4e                	jbe    802b8a <devfile_write+0x1a8>
+  802b3c:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802b41:	48 89 da             	mov    %rbx,%rdx
+  802b44:	4c 89 f6             	mov    %r14,%rsi
+  802b47:	4c 89 e7             	mov    %r12,%rdi
+  802b4a:	48 b8 40 28 80 00 00 	movabs $0x802840,%rax
+  802b51:	00 00 00 
+  802b54:	ff d0                	call   *%rax
+  802b56:	eb 57                	jmp    802baf <devfile_write+0x1cd>
+  802b58:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802b5f:	77 db                	ja     802b3c <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  802b61:	4c 89 ff             	mov    %r15,%rdi
+  802b64:	48 b8 0a 42 80 00 00 	movabs $0x80420a,%rax
+  802b6b:	00 00 00 
+  802b6e:	ff d0                	call   *%rax
+  802b70:	84 c0                	test   %al,%al
+  802b72:	74 99                	je     802b0d <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  802b74:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  802b79:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802b7e:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  802b82:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  802b89:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  802b8a:	4c 89 ff             	mov    %r15,%rdi
+  802b8d:	49 03 7d 10          	add    0x10(%r13),%rdi
+  802b91:	48 89 da             	mov    %rbx,%rdx
+  802b94:	4c 89 f6             	mov    %r14,%rsi
+  802b97:	48 b8 9e 10 80 00 00 	movabs $0x80109e,%rax
+  802b9e:	00 00 00 
+  802ba1:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  802ba3:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  802ba7:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  802bac:	48 89 d8             	mov    %rbx,%rax
+}
+  802baf:	48 83 c4 08          	add    $0x8,%rsp
+  802bb3:	5b                   	pop    %rbx
+  802bb4:	41 5c                	pop    %r12
+  802bb6:	41 5d                	pop    %r13
+  802bb8:	41 5e                	pop    %r14
+  802bba:	41 5f                	pop    %r15
+  802bbc:	5d                   	pop    %rbp
+  802bbd:	c3                   	ret
+        return E_INVAL;
+  802bbe:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802bc3:	c3                   	ret
+
+0000000000802bc4 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802bc4:	55                   	push   %rbp
+  802bc5:	48 89 e5             	mov    %rsp,%rbp
+  802bc8:	41 54                	push   %r12
+  802bca:	53                   	push   %rbx
+  802bcb:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  802bce:	48 b8 3d 29 80 00 00 	movabs $0x80293d,%rax
+  802bd5:	00 00 00 
+  802bd8:	ff d0                	call   *%rax
+  802bda:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  802bdd:	48 89 df             	mov    %rbx,%rdi
+  802be0:	48 b8 f0 21 80 00 00 	movabs $0x8021f0,%rax
+  802be7:	00 00 00 
+  802bea:	ff d0                	call   *%rax
+  802bec:	48 85 c0             	test   %rax,%rax
+  802bef:	74 17                	je     802c08 <devfile_flush+0x44>
+  802bf1:	48 89 df             	mov    %rbx,%rdi
+  802bf4:	48 b8 f0 21 80 00 00 	movabs $0x8021f0,%rax
+  802bfb:	00 00 00 
+  802bfe:	ff d0                	call   *%rax
+  802c00:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  802c07:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802c08:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802c0b:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  802c12:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  802c14:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c19:	be 00 00 00 00       	mov    $0x0,%esi
+  802c1e:	bf 06 00 00 00       	mov    $0x6,%edi
+  802c23:	48 b8 d4 26 80 00 00 	movabs $0x8026d4,%rax
+  802c2a:	00 00 00 
+  802c2d:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802c2f:	45 85 e4             	test   %r12d,%r12d
+  802c32:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802c36:	5b                   	pop    %rbx
+  802c37:	41 5c                	pop    %r12
+  802c39:	5d                   	pop    %rbp
+  802c3a:	c3                   	ret
+
+0000000000802c3b <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  802c3b:	55                   	push   %rbp
+  802c3c:	48 89 e5             	mov    %rsp,%rbp
+  802c3f:	41 57                	push   %r15
+  802c41:	41 56                	push   %r14
+  802c43:	41 55                	push   %r13
+  802c45:	41 54                	push   %r12
+  802c47:	53                   	push   %rbx
+  802c48:	48 83 ec 38          	sub    $0x38,%rsp
+  802c4c:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  802c50:	49 89 f7             	mov    %rsi,%r15
+  802c53:	48 89 d3             	mov    %rdx,%rbx
+  802c56:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  802c59:	48 b8 86 21 80 00 00 	movabs $0x802186,%rax
+  802c60:	00 00 00 
+  802c63:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802c65:	48 85 c0             	test   %rax,%rax
+  802c68:	75 20                	jne    802c8a <devfile_read_direct+0x4f>
+    bool map = 1;
+  802c6a:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  802c6f:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802c76:	00 
+    while (n) {
+  802c77:	48 85 db             	test   %rbx,%rbx
+  802c7a:	0f 85 df 00 00 00    	jne    802d5f <devfile_read_direct+0x124>
+    size_t read = 0;
+  802c80:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  802c84:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802c88:	eb 21                	jmp    802cab <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802c8a:	45 89 f1             	mov    %r14d,%r9d
+  802c8d:	49 89 d8             	mov    %rbx,%r8
+  802c90:	4c 89 f9             	mov    %r15,%rcx
+  802c93:	ba 03 00 00 00       	mov    $0x3,%edx
+  802c98:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802c9c:	48 89 c7             	mov    %rax,%rdi
+  802c9f:	48 b8 6d 22 80 00 00 	movabs $0x80226d,%rax
+  802ca6:	00 00 00 
+  802ca9:	ff d0                	call   *%rax
+}
+  802cab:	48 83 c4 38          	add    $0x38,%rsp
+  802caf:	5b                   	pop    %rbx
+  802cb0:	41 5c                	pop    %r12
+  802cb2:	41 5d                	pop    %r13
+  802cb4:	41 5e                	pop    %r14
+  802cb6:	41 5f                	pop    %r15
+  802cb8:	5d                   	pop    %rbp
+  802cb9:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802cba:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802cbe:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802cc4:	75 1e                	jne    802ce4 <devfile_read_direct+0xa9>
+  802cc6:	e9 e2 00 00 00       	jmp    802dad <devfile_read_direct+0x172>
+            if (!res) return read;
+  802ccb:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802ccf:	eb da                	jmp    802cab <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  802cd1:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  802cd5:	0f 85 d0 01 00 00    	jne    802eab <devfile_read_direct+0x270>
+            map = 0;
+  802cdb:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802cdf:	eb 03                	jmp    802ce4 <devfile_read_direct+0xa9>
+  802ce1:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802ce4:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802ce9:	48 39 d3             	cmp    %rdx,%rbx
+  802cec:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802cf0:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802cf4:	8b 40 0c             	mov    0xc(%rax),%eax
+  802cf7:	48 b9 00 00 83 00 00 	movabs $0x830000,%rcx
+  802cfe:	00 00 00 
+  802d01:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  802d03:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  802d07:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  802d0b:	be 00 00 00 00       	mov    $0x0,%esi
+  802d10:	bf 03 00 00 00       	mov    $0x3,%edi
+  802d15:	48 b8 d4 26 80 00 00 	movabs $0x8026d4,%rax
+  802d1c:	00 00 00 
+  802d1f:	ff d0                	call   *%rax
+        if (res <= 0)
+  802d21:	85 c0                	test   %eax,%eax
+  802d23:	0f 8e 63 01 00 00    	jle    802e8c <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  802d29:	4c 63 e0             	movslq %eax,%r12
+  802d2c:	4c 89 e2             	mov    %r12,%rdx
+  802d2f:	48 be 00 10 83 00 00 	movabs $0x831000,%rsi
+  802d36:	00 00 00 
+  802d39:	4c 89 ff             	mov    %r15,%rdi
+  802d3c:	48 b8 9e 10 80 00 00 	movabs $0x80109e,%rax
+  802d43:	00 00 00 
+  802d46:	ff d0                	call   *%rax
+        buf += res;
+  802d48:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  802d4b:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  802d4e:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  802d52:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  802d56:	48 85 db             	test   %rbx,%rbx
+  802d59:	0f 84 25 ff ff ff    	je     802c84 <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  802d5f:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  802d62:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  802d66:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802d6a:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802d6e:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  802d75:	0f 97 c2             	seta   %dl
+  802d78:	20 c2                	and    %al,%dl
+  802d7a:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  802d7d:	0f 84 5e ff ff ff    	je     802ce1 <devfile_read_direct+0xa6>
+  802d83:	4c 89 fa             	mov    %r15,%rdx
+  802d86:	4d 89 fd             	mov    %r15,%r13
+  802d89:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  802d90:	0f 85 4e ff ff ff    	jne    802ce4 <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  802d96:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802d9a:	0f 84 1a ff ff ff    	je     802cba <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802da0:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802da7:	0f 85 37 ff ff ff    	jne    802ce4 <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  802dad:	48 89 d8             	mov    %rbx,%rax
+  802db0:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802db6:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802dbb:	48 39 c8             	cmp    %rcx,%rax
+  802dbe:	48 0f 47 c1          	cmova  %rcx,%rax
+  802dc2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  802dc6:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  802dca:	49 89 d4             	mov    %rdx,%r12
+  802dcd:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  802dd1:	48 b8 ab 41 80 00 00 	movabs $0x8041ab,%rax
+  802dd8:	00 00 00 
+  802ddb:	ff d0                	call   *%rax
+  802ddd:	a8 40                	test   $0x40,%al
+  802ddf:	0f 85 b9 00 00 00    	jne    802e9e <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  802de5:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  802dec:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802df0:	49 39 c5             	cmp    %rax,%r13
+  802df3:	72 d8                	jb     802dcd <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802df5:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802df9:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802e00:	00 00 00 
+  802e03:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802e07:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  802e0a:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  802e0c:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  802e10:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  802e14:	48 b8 21 20 80 00 00 	movabs $0x802021,%rax
+  802e1b:	00 00 00 
+  802e1e:	ff d0                	call   *%rax
+  802e20:	89 c7                	mov    %eax,%edi
+  802e22:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802e28:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802e2d:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802e34:	00 00 00 
+  802e37:	be 0e 00 00 00       	mov    $0xe,%esi
+  802e3c:	48 b8 b8 4a 80 00 00 	movabs $0x804ab8,%rax
+  802e43:	00 00 00 
+  802e46:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  802e48:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802e4d:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802e51:	4c 89 fe             	mov    %r15,%rsi
+  802e54:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e59:	48 b8 94 4a 80 00 00 	movabs $0x804a94,%rax
+  802e60:	00 00 00 
+  802e63:	ff d0                	call   *%rax
+  802e65:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  802e68:	48 85 d2             	test   %rdx,%rdx
+  802e6b:	0f 84 5a fe ff ff    	je     802ccb <devfile_read_direct+0x90>
+            if (res > 0) {
+  802e71:	0f 8e 5a fe ff ff    	jle    802cd1 <devfile_read_direct+0x96>
+                buf += res;
+  802e77:	48 98                	cltq
+  802e79:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  802e7c:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  802e7f:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  802e83:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  802e87:	e9 ca fe ff ff       	jmp    802d56 <devfile_read_direct+0x11b>
+            return res ? res : read;
+  802e8c:	41 89 c5             	mov    %eax,%r13d
+  802e8f:	48 98                	cltq
+  802e91:	45 85 ed             	test   %r13d,%r13d
+  802e94:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  802e99:	e9 0d fe ff ff       	jmp    802cab <devfile_read_direct+0x70>
+            map = 0;
+  802e9e:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802ea2:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802ea6:	e9 39 fe ff ff       	jmp    802ce4 <devfile_read_direct+0xa9>
+  802eab:	48 89 d0             	mov    %rdx,%rax
+  802eae:	e9 f8 fd ff ff       	jmp    802cab <devfile_read_direct+0x70>
+
+0000000000802eb3 <devfile_read>:
+    if (!fd || !buf)
+  802eb3:	48 85 ff             	test   %rdi,%rdi
+  802eb6:	0f 84 21 02 00 00    	je     8030dd <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802ebc:	55                   	push   %rbp
+  802ebd:	48 89 e5             	mov    %rsp,%rbp
+  802ec0:	41 57                	push   %r15
+  802ec2:	41 56                	push   %r14
+  802ec4:	41 55                	push   %r13
+  802ec6:	41 54                	push   %r12
+  802ec8:	53                   	push   %rbx
+  802ec9:	48 83 ec 28          	sub    $0x28,%rsp
+  802ecd:	48 89 fb             	mov    %rdi,%rbx
+  802ed0:	49 89 f4             	mov    %rsi,%r12
+  802ed3:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  802ed6:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802edb:	48 85 f6             	test   %rsi,%rsi
+  802ede:	74 4b                	je     802f2b <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  802ee0:	48 b8 f0 21 80 00 00 	movabs $0x8021f0,%rax
+  802ee7:	00 00 00 
+  802eea:	ff d0                	call   *%rax
+  802eec:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802eef:	48 85 c0             	test   %rax,%rax
+  802ef2:	74 22                	je     802f16 <devfile_read+0x63>
+  802ef4:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  802efb:	77 19                	ja     802f16 <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802efd:	be 00 10 00 00       	mov    $0x1000,%esi
+  802f02:	48 89 df             	mov    %rbx,%rdi
+  802f05:	48 b8 61 13 80 00 00 	movabs $0x801361,%rax
+  802f0c:	00 00 00 
+  802f0f:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802f11:	83 f8 02             	cmp    $0x2,%eax
+  802f14:	7e 40                	jle    802f56 <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  802f16:	48 89 df             	mov    %rbx,%rdi
+  802f19:	48 b8 3d 29 80 00 00 	movabs $0x80293d,%rax
+  802f20:	00 00 00 
+  802f23:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802f25:	85 c0                	test   %eax,%eax
+  802f27:	79 11                	jns    802f3a <devfile_read+0x87>
+  802f29:	48 98                	cltq
+}
+  802f2b:	48 83 c4 28          	add    $0x28,%rsp
+  802f2f:	5b                   	pop    %rbx
+  802f30:	41 5c                	pop    %r12
+  802f32:	41 5d                	pop    %r13
+  802f34:	41 5e                	pop    %r14
+  802f36:	41 5f                	pop    %r15
+  802f38:	5d                   	pop    %rbp
+  802f39:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802f3a:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802f3f:	4c 89 ea             	mov    %r13,%rdx
+  802f42:	4c 89 e6             	mov    %r12,%rsi
+  802f45:	48 89 df             	mov    %rbx,%rdi
+  802f48:	48 b8 3b 2c 80 00 00 	movabs $0x802c3b,%rax
+  802f4f:	00 00 00 
+  802f52:	ff d0                	call   *%rax
+  802f54:	eb d5                	jmp    802f2b <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  802f56:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802f5a:	48 89 df             	mov    %rbx,%rdi
+  802f5d:	48 b8 3d 29 80 00 00 	movabs $0x80293d,%rax
+  802f64:	00 00 00 
+  802f67:	ff d0                	call   *%rax
+  802f69:	85 c0                	test   %eax,%eax
+  802f6b:	0f 88 33 01 00 00    	js     8030a4 <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  802f71:	48 ba 00 23 82 00 00 	movabs $0x822300,%rdx
+  802f78:	00 00 00 
+  802f7b:	4c 89 f0             	mov    %r14,%rax
+  802f7e:	48 29 d0             	sub    %rdx,%rax
+  802f81:	48 c1 f8 03          	sar    $0x3,%rax
+  802f85:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  802f8c:	aa aa aa 
+  802f8f:	48 0f af c2          	imul   %rdx,%rax
+  802f93:	48 c1 e0 0e          	shl    $0xe,%rax
+  802f97:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  802f9b:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802f9e:	41 39 06             	cmp    %eax,(%r14)
+  802fa1:	75 0d                	jne    802fb0 <devfile_read+0xfd>
+  802fa3:	8b 43 10             	mov    0x10(%rbx),%eax
+  802fa6:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  802faa:	0f 84 fb 00 00 00    	je     8030ab <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  802fb0:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802fb5:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802fb9:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  802fbc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802fc0:	48 89 c7             	mov    %rax,%rdi
+  802fc3:	48 b8 0a 42 80 00 00 	movabs $0x80420a,%rax
+  802fca:	00 00 00 
+  802fcd:	ff d0                	call   *%rax
+  802fcf:	84 c0                	test   %al,%al
+  802fd1:	75 27                	jne    802ffa <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802fd3:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802fd8:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802fdd:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802fe1:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fe6:	48 b8 9c 13 80 00 00 	movabs $0x80139c,%rax
+  802fed:	00 00 00 
+  802ff0:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  802ff2:	85 c0                	test   %eax,%eax
+  802ff4:	0f 88 dc 00 00 00    	js     8030d6 <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  802ffa:	44 89 f8             	mov    %r15d,%eax
+  802ffd:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  803002:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  803004:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  80300b:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  80300c:	8b 43 10             	mov    0x10(%rbx),%eax
+  80300f:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  803013:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  803016:	ba 00 40 00 00       	mov    $0x4000,%edx
+  80301b:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80301f:	48 89 df             	mov    %rbx,%rdi
+  803022:	48 b8 3b 2c 80 00 00 	movabs $0x802c3b,%rax
+  803029:	00 00 00 
+  80302c:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  80302e:	48 85 c0             	test   %rax,%rax
+  803031:	0f 88 f4 fe ff ff    	js     802f2b <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  803037:	8b 53 0c             	mov    0xc(%rbx),%edx
+  80303a:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  80303d:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  803040:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  803044:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  803048:	48 63 d1             	movslq %ecx,%rdx
+  80304b:	48 01 d0             	add    %rdx,%rax
+  80304e:	4d 63 ff             	movslq %r15d,%r15
+  803051:	4c 29 f8             	sub    %r15,%rax
+  803054:	ba 00 00 00 00       	mov    $0x0,%edx
+  803059:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  80305d:	48 85 c0             	test   %rax,%rax
+  803060:	0f 8e c5 fe ff ff    	jle    802f2b <devfile_read+0x78>
+    n = MIN(n, res);
+  803066:	4c 39 e8             	cmp    %r13,%rax
+  803069:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  80306d:	8b 73 04             	mov    0x4(%rbx),%esi
+  803070:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  803074:	48 63 f6             	movslq %esi,%rsi
+  803077:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  80307c:	48 01 c6             	add    %rax,%rsi
+  80307f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803083:	48 01 c6             	add    %rax,%rsi
+  803086:	4c 89 ea             	mov    %r13,%rdx
+  803089:	4c 89 e7             	mov    %r12,%rdi
+  80308c:	48 b8 9e 10 80 00 00 	movabs $0x80109e,%rax
+  803093:	00 00 00 
+  803096:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  803098:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  80309c:	4c 89 e8             	mov    %r13,%rax
+  80309f:	e9 87 fe ff ff       	jmp    802f2b <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  8030a4:	48 98                	cltq
+  8030a6:	e9 80 fe ff ff       	jmp    802f2b <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  8030ab:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  8030af:	41 39 d7             	cmp    %edx,%r15d
+  8030b2:	0f 8c f8 fe ff ff    	jl     802fb0 <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  8030b8:	49 8b 46 10          	mov    0x10(%r14),%rax
+  8030bc:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  8030bf:	41 39 cf             	cmp    %ecx,%r15d
+  8030c2:	0f 8d e8 fe ff ff    	jge    802fb0 <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  8030c8:	4d 63 ff             	movslq %r15d,%r15
+  8030cb:	4c 29 f8             	sub    %r15,%rax
+  8030ce:	48 63 d2             	movslq %edx,%rdx
+  8030d1:	48 01 d0             	add    %rdx,%rax
+  8030d4:	eb 87                	jmp    80305d <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8030d6:	48 98                	cltq
+  8030d8:	e9 4e fe ff ff       	jmp    802f2b <devfile_read+0x78>
+        return E_INVAL;
+  8030dd:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  8030e2:	c3                   	ret
+
+00000000008030e3 <fs_channel>:
+fs_channel(bool enable) {
+  8030e3:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  8030e5:	a2 04 26 82 00 00 00 	movabs %al,0x822604
+  8030ec:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  8030ee:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030f3:	40 84 ff             	test   %dil,%dil
+  8030f6:	74 47                	je     80313f <fs_channel+0x5c>
+  8030f8:	48 a1 00 04 81 00 00 	movabs 0x810400,%rax
+  8030ff:	00 00 00 
+  803102:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  803108:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  80310f:	00 00 00 
+  803112:	3b 08                	cmp    (%rax),%ecx
+  803114:	74 29                	je     80313f <fs_channel+0x5c>
+fs_channel(bool enable) {
+  803116:	55                   	push   %rbp
+  803117:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  80311a:	48 b8 63 20 80 00 00 	movabs $0x802063,%rax
+  803121:	00 00 00 
+  803124:	ff d0                	call   *%rax
+  803126:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  803128:	85 c0                	test   %eax,%eax
+  80312a:	78 04                	js     803130 <fs_channel+0x4d>
+}
+  80312c:	89 d0                	mov    %edx,%eax
+  80312e:	5d                   	pop    %rbp
+  80312f:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  803130:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  803137:	00 00 00 
+  80313a:	c6 00 00             	movb   $0x0,(%rax)
+  80313d:	eb ed                	jmp    80312c <fs_channel+0x49>
+}
+  80313f:	89 d0                	mov    %edx,%eax
+  803141:	c3                   	ret
+
+0000000000803142 <open>:
+open(const char *path, int mode) {
+  803142:	55                   	push   %rbp
+  803143:	48 89 e5             	mov    %rsp,%rbp
+  803146:	41 55                	push   %r13
+  803148:	41 54                	push   %r12
+  80314a:	53                   	push   %rbx
+  80314b:	48 83 ec 18          	sub    $0x18,%rsp
+  80314f:	49 89 fc             	mov    %rdi,%r12
+  803152:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803155:	48 b8 ff 0d 80 00 00 	movabs $0x800dff,%rax
+  80315c:	00 00 00 
+  80315f:	ff d0                	call   *%rax
+  803161:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803167:	0f 87 8f 00 00 00    	ja     8031fc <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80316d:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803171:	48 b8 1d 19 80 00 00 	movabs $0x80191d,%rax
+  803178:	00 00 00 
+  80317b:	ff d0                	call   *%rax
+  80317d:	89 c3                	mov    %eax,%ebx
+  80317f:	85 c0                	test   %eax,%eax
+  803181:	78 55                	js     8031d8 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  803183:	4c 89 e6             	mov    %r12,%rsi
+  803186:	48 bb 00 00 83 00 00 	movabs $0x830000,%rbx
+  80318d:	00 00 00 
+  803190:	48 89 df             	mov    %rbx,%rdi
+  803193:	48 b8 3d 0e 80 00 00 	movabs $0x800e3d,%rax
+  80319a:	00 00 00 
+  80319d:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  80319f:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  8031a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031ab:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8031af:	bf 01 00 00 00       	mov    $0x1,%edi
+  8031b4:	48 b8 d4 26 80 00 00 	movabs $0x8026d4,%rax
+  8031bb:	00 00 00 
+  8031be:	ff d0                	call   *%rax
+  8031c0:	89 c3                	mov    %eax,%ebx
+  8031c2:	85 c0                	test   %eax,%eax
+  8031c4:	78 1f                	js     8031e5 <open+0xa3>
+    return fd2num(fd);
+  8031c6:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8031ca:	48 b8 ef 18 80 00 00 	movabs $0x8018ef,%rax
+  8031d1:	00 00 00 
+  8031d4:	ff d0                	call   *%rax
+  8031d6:	89 c3                	mov    %eax,%ebx
+}
+  8031d8:	89 d8                	mov    %ebx,%eax
+  8031da:	48 83 c4 18          	add    $0x18,%rsp
+  8031de:	5b                   	pop    %rbx
+  8031df:	41 5c                	pop    %r12
+  8031e1:	41 5d                	pop    %r13
+  8031e3:	5d                   	pop    %rbp
+  8031e4:	c3                   	ret
+        fd_close(fd, 0);
+  8031e5:	be 00 00 00 00       	mov    $0x0,%esi
+  8031ea:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8031ee:	48 b8 38 1a 80 00 00 	movabs $0x801a38,%rax
+  8031f5:	00 00 00 
+  8031f8:	ff d0                	call   *%rax
+        return res;
+  8031fa:	eb dc                	jmp    8031d8 <open+0x96>
+        return -E_BAD_PATH;
+  8031fc:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803201:	eb d5                	jmp    8031d8 <open+0x96>
+
+0000000000803203 <file_flush_buffers>:
+file_flush_buffers(void) {
+  803203:	55                   	push   %rbp
+  803204:	48 89 e5             	mov    %rsp,%rbp
+  803207:	41 56                	push   %r14
+  803209:	41 55                	push   %r13
+  80320b:	41 54                	push   %r12
+  80320d:	53                   	push   %rbx
+  80320e:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  803212:	49 bc 08 23 82 00 00 	movabs $0x822308,%r12
+  803219:	00 00 00 
+  80321c:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  803221:	49 bd 7d 19 80 00 00 	movabs $0x80197d,%r13
+  803228:	00 00 00 
+  80322b:	49 be 3d 29 80 00 00 	movabs $0x80293d,%r14
+  803232:	00 00 00 
+  803235:	eb 0c                	jmp    803243 <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  803237:	83 c3 01             	add    $0x1,%ebx
+  80323a:	49 83 c4 18          	add    $0x18,%r12
+  80323e:	83 fb 20             	cmp    $0x20,%ebx
+  803241:	74 1d                	je     803260 <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  803243:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  803248:	74 ed                	je     803237 <file_flush_buffers+0x34>
+  80324a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80324e:	89 df                	mov    %ebx,%edi
+  803250:	41 ff d5             	call   *%r13
+  803253:	85 c0                	test   %eax,%eax
+  803255:	78 e0                	js     803237 <file_flush_buffers+0x34>
+  803257:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80325b:	41 ff d6             	call   *%r14
+  80325e:	eb d7                	jmp    803237 <file_flush_buffers+0x34>
+}
+  803260:	48 83 c4 10          	add    $0x10,%rsp
+  803264:	5b                   	pop    %rbx
+  803265:	41 5c                	pop    %r12
+  803267:	41 5d                	pop    %r13
+  803269:	41 5e                	pop    %r14
+  80326b:	5d                   	pop    %rbp
+  80326c:	c3                   	ret
+
+000000000080326d <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80326d:	55                   	push   %rbp
+  80326e:	48 89 e5             	mov    %rsp,%rbp
+  803271:	41 54                	push   %r12
+  803273:	53                   	push   %rbx
+  803274:	49 89 fc             	mov    %rdi,%r12
+  803277:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  803279:	48 b8 03 32 80 00 00 	movabs $0x803203,%rax
+  803280:	00 00 00 
+  803283:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  803285:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  80328c:	00 00 00 
+  80328f:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  803294:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  803296:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  803299:	ba 00 00 00 00       	mov    $0x0,%edx
+  80329e:	be 00 00 00 00       	mov    $0x0,%esi
+  8032a3:	bf 02 00 00 00       	mov    $0x2,%edi
+  8032a8:	48 b8 d4 26 80 00 00 	movabs $0x8026d4,%rax
+  8032af:	00 00 00 
+  8032b2:	ff d0                	call   *%rax
+}
+  8032b4:	5b                   	pop    %rbx
+  8032b5:	41 5c                	pop    %r12
+  8032b7:	5d                   	pop    %rbp
+  8032b8:	c3                   	ret
+
+00000000008032b9 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8032b9:	55                   	push   %rbp
+  8032ba:	48 89 e5             	mov    %rsp,%rbp
+  8032bd:	41 54                	push   %r12
+  8032bf:	53                   	push   %rbx
+  8032c0:	49 89 fc             	mov    %rdi,%r12
+  8032c3:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  8032c6:	48 b8 03 32 80 00 00 	movabs $0x803203,%rax
+  8032cd:	00 00 00 
+  8032d0:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8032d2:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  8032d7:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  8032de:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  8032e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032e5:	be 00 00 00 00       	mov    $0x0,%esi
+  8032ea:	bf 05 00 00 00       	mov    $0x5,%edi
+  8032ef:	48 b8 d4 26 80 00 00 	movabs $0x8026d4,%rax
+  8032f6:	00 00 00 
+  8032f9:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8032fb:	85 c0                	test   %eax,%eax
+  8032fd:	78 3d                	js     80333c <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8032ff:	49 bc 00 00 83 00 00 	movabs $0x830000,%r12
+  803306:	00 00 00 
+  803309:	4c 89 e6             	mov    %r12,%rsi
+  80330c:	48 89 df             	mov    %rbx,%rdi
+  80330f:	48 b8 3d 0e 80 00 00 	movabs $0x800e3d,%rax
+  803316:	00 00 00 
+  803319:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80331b:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  803322:	00 
+  803323:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803329:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  803330:	00 
+  803331:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  803337:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80333c:	5b                   	pop    %rbx
+  80333d:	41 5c                	pop    %r12
+  80333f:	5d                   	pop    %rbp
+  803340:	c3                   	ret
+
+0000000000803341 <remove>:
+remove(const char *path) {
+  803341:	55                   	push   %rbp
+  803342:	48 89 e5             	mov    %rsp,%rbp
+  803345:	53                   	push   %rbx
+  803346:	48 83 ec 08          	sub    $0x8,%rsp
+  80334a:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  80334d:	48 b8 ff 0d 80 00 00 	movabs $0x800dff,%rax
+  803354:	00 00 00 
+  803357:	ff d0                	call   *%rax
+  803359:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80335f:	77 3a                	ja     80339b <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  803361:	48 89 de             	mov    %rbx,%rsi
+  803364:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  80336b:	00 00 00 
+  80336e:	48 b8 3d 0e 80 00 00 	movabs $0x800e3d,%rax
+  803375:	00 00 00 
+  803378:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  80337a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80337f:	be 00 00 00 00       	mov    $0x0,%esi
+  803384:	bf 07 00 00 00       	mov    $0x7,%edi
+  803389:	48 b8 d4 26 80 00 00 	movabs $0x8026d4,%rax
+  803390:	00 00 00 
+  803393:	ff d0                	call   *%rax
+}
+  803395:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803399:	c9                   	leave
+  80339a:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  80339b:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8033a0:	eb f3                	jmp    803395 <remove+0x54>
+
+00000000008033a2 <sync>:
+sync(void) {
+  8033a2:	55                   	push   %rbp
+  8033a3:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  8033a6:	48 b8 03 32 80 00 00 	movabs $0x803203,%rax
+  8033ad:	00 00 00 
+  8033b0:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  8033b2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8033b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8033bc:	bf 08 00 00 00       	mov    $0x8,%edi
+  8033c1:	48 b8 d4 26 80 00 00 	movabs $0x8026d4,%rax
+  8033c8:	00 00 00 
+  8033cb:	ff d0                	call   *%rax
+}
+  8033cd:	5d                   	pop    %rbp
+  8033ce:	c3                   	ret
+
+00000000008033cf <fsync>:
+fsync(int fdnum) {
+  8033cf:	55                   	push   %rbp
+  8033d0:	48 89 e5             	mov    %rsp,%rbp
+  8033d3:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8033d7:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8033db:	48 b8 7d 19 80 00 00 	movabs $0x80197d,%rax
+  8033e2:	00 00 00 
+  8033e5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8033e7:	85 c0                	test   %eax,%eax
+  8033e9:	78 4b                	js     803436 <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8033eb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8033ef:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  8033f6:	00 00 00 
+  8033f9:	8b 00                	mov    (%rax),%eax
+  8033fb:	39 02                	cmp    %eax,(%rdx)
+  8033fd:	75 39                	jne    803438 <fsync+0x69>
+    file_flush_buffers();
+  8033ff:	48 b8 03 32 80 00 00 	movabs $0x803203,%rax
+  803406:	00 00 00 
+  803409:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  80340b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80340f:	8b 40 0c             	mov    0xc(%rax),%eax
+  803412:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  803419:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  80341b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803420:	be 00 00 00 00       	mov    $0x0,%esi
+  803425:	bf 0d 00 00 00       	mov    $0xd,%edi
+  80342a:	48 b8 d4 26 80 00 00 	movabs $0x8026d4,%rax
+  803431:	00 00 00 
+  803434:	ff d0                	call   *%rax
+}
+  803436:	c9                   	leave
+  803437:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803438:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80343d:	eb f7                	jmp    803436 <fsync+0x67>
+
+000000000080343f <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  80343f:	55                   	push   %rbp
+  803440:	48 89 e5             	mov    %rsp,%rbp
+  803443:	53                   	push   %rbx
+  803444:	48 83 ec 08          	sub    $0x8,%rsp
+  803448:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  80344b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803450:	be 00 00 00 00       	mov    $0x0,%esi
+  803455:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80345a:	48 b8 d4 26 80 00 00 	movabs $0x8026d4,%rax
+  803461:	00 00 00 
+  803464:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803466:	85 c0                	test   %eax,%eax
+  803468:	78 2d                	js     803497 <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  80346a:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803471:	00 00 00 
+  803474:	48 8b 10             	mov    (%rax),%rdx
+  803477:	48 89 13             	mov    %rdx,(%rbx)
+  80347a:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80347e:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  803482:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803486:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  80348a:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80348e:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  803492:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803497:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80349b:	c9                   	leave
+  80349c:	c3                   	ret
+
+000000000080349d <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  80349d:	55                   	push   %rbp
+  80349e:	48 89 e5             	mov    %rsp,%rbp
+  8034a1:	53                   	push   %rbx
+  8034a2:	48 83 ec 08          	sub    $0x8,%rsp
+  8034a6:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  8034a9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8034ae:	be 00 00 00 00       	mov    $0x0,%esi
+  8034b3:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8034b8:	48 b8 d4 26 80 00 00 	movabs $0x8026d4,%rax
+  8034bf:	00 00 00 
+  8034c2:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8034c4:	85 c0                	test   %eax,%eax
+  8034c6:	78 3d                	js     803505 <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  8034c8:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  8034cf:	00 00 00 
+  8034d2:	48 8b 10             	mov    (%rax),%rdx
+  8034d5:	48 89 13             	mov    %rdx,(%rbx)
+  8034d8:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8034dc:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  8034e0:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8034e4:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  8034e8:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  8034ec:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  8034f0:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  8034f4:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  8034f8:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8034fc:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  803500:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803505:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803509:	c9                   	leave
+  80350a:	c3                   	ret
+
+000000000080350b <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  80350b:	55                   	push   %rbp
+  80350c:	48 89 e5             	mov    %rsp,%rbp
+  80350f:	41 57                	push   %r15
+  803511:	41 56                	push   %r14
+  803513:	41 55                	push   %r13
+  803515:	41 54                	push   %r12
+  803517:	53                   	push   %rbx
+  803518:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  80351c:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  803523:	00 
+  803524:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  80352b:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  803531:	0f 85 43 01 00 00    	jne    80367a <munmap+0x16f>
+  803537:	49 89 ff             	mov    %rdi,%r15
+  80353a:	4c 39 f7             	cmp    %r14,%rdi
+  80353d:	0f 87 37 01 00 00    	ja     80367a <munmap+0x16f>
+  803543:	48 bb 00 20 82 00 00 	movabs $0x822000,%rbx
+  80354a:	00 00 00 
+  80354d:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  803553:	eb 2c                	jmp    803581 <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  803555:	4c 39 f8             	cmp    %r15,%rax
+  803558:	0f 83 85 00 00 00    	jae    8035e3 <munmap+0xd8>
+            m->mm_end = start;
+  80355e:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  803563:	48 83 c3 18          	add    $0x18,%rbx
+  803567:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  80356e:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  803575:	00 00 00 
+  803578:	48 39 c3             	cmp    %rax,%rbx
+  80357b:	0f 84 d0 00 00 00    	je     803651 <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  803581:	49 89 dc             	mov    %rbx,%r12
+  803584:	48 8b 03             	mov    (%rbx),%rax
+  803587:	4c 39 f0             	cmp    %r14,%rax
+  80358a:	73 d7                	jae    803563 <munmap+0x58>
+  80358c:	48 85 c0             	test   %rax,%rax
+  80358f:	74 d2                	je     803563 <munmap+0x58>
+  803591:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  803595:	49 39 d7             	cmp    %rdx,%r15
+  803598:	73 c9                	jae    803563 <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  80359a:	49 39 d6             	cmp    %rdx,%r14
+  80359d:	73 b6                	jae    803555 <munmap+0x4a>
+  80359f:	49 39 c7             	cmp    %rax,%r15
+  8035a2:	76 b1                	jbe    803555 <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  8035a4:	4c 89 ef             	mov    %r13,%rdi
+  8035a7:	48 b8 42 26 80 00 00 	movabs $0x802642,%rax
+  8035ae:	00 00 00 
+  8035b1:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  8035b3:	48 85 c0             	test   %rax,%rax
+  8035b6:	0f 84 c5 00 00 00    	je     803681 <munmap+0x176>
+            *tail = *m;
+  8035bc:	48 8b 13             	mov    (%rbx),%rdx
+  8035bf:	48 89 10             	mov    %rdx,(%rax)
+  8035c2:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8035c6:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  8035ca:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  8035ce:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  8035d2:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  8035d5:	44 89 f2             	mov    %r14d,%edx
+  8035d8:	2b 13                	sub    (%rbx),%edx
+  8035da:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  8035dd:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  8035e1:	eb 80                	jmp    803563 <munmap+0x58>
+        } else if (m->mm_end > end) {
+  8035e3:	49 39 d6             	cmp    %rdx,%r14
+  8035e6:	73 18                	jae    803600 <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  8035e8:	44 89 f2             	mov    %r14d,%edx
+  8035eb:	41 03 54 24 10       	add    0x10(%r12),%edx
+  8035f0:	29 c2                	sub    %eax,%edx
+  8035f2:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  8035f7:	4d 89 34 24          	mov    %r14,(%r12)
+  8035fb:	e9 63 ff ff ff       	jmp    803563 <munmap+0x58>
+    m->mm_start = 0;
+  803600:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  803607:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  803608:	4c 89 e6             	mov    %r12,%rsi
+  80360b:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  803612:	00 00 00 
+  803615:	48 29 c6             	sub    %rax,%rsi
+  803618:	48 c1 fe 03          	sar    $0x3,%rsi
+  80361c:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  803623:	aa aa aa 
+  803626:	48 0f af f0          	imul   %rax,%rsi
+  80362a:	48 c1 e6 0c          	shl    $0xc,%rsi
+  80362e:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  803633:	48 01 c6             	add    %rax,%rsi
+  803636:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80363b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803640:	48 b8 42 14 80 00 00 	movabs $0x801442,%rax
+  803647:	00 00 00 
+  80364a:	ff d0                	call   *%rax
+}
+  80364c:	e9 12 ff ff ff       	jmp    803563 <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  803651:	4c 89 f2             	mov    %r14,%rdx
+  803654:	4c 29 fa             	sub    %r15,%rdx
+  803657:	4c 89 fe             	mov    %r15,%rsi
+  80365a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80365f:	48 b8 42 14 80 00 00 	movabs $0x801442,%rax
+  803666:	00 00 00 
+  803669:	ff d0                	call   *%rax
+}
+  80366b:	48 83 c4 08          	add    $0x8,%rsp
+  80366f:	5b                   	pop    %rbx
+  803670:	41 5c                	pop    %r12
+  803672:	41 5d                	pop    %r13
+  803674:	41 5e                	pop    %r14
+  803676:	41 5f                	pop    %r15
+  803678:	5d                   	pop    %rbp
+  803679:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  80367a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80367f:	eb ea                	jmp    80366b <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  803681:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  803686:	eb e3                	jmp    80366b <munmap+0x160>
+
+0000000000803688 <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  803688:	55                   	push   %rbp
+  803689:	48 89 e5             	mov    %rsp,%rbp
+  80368c:	41 57                	push   %r15
+  80368e:	41 56                	push   %r14
+  803690:	41 55                	push   %r13
+  803692:	41 54                	push   %r12
+  803694:	53                   	push   %rbx
+  803695:	48 83 ec 28          	sub    $0x28,%rsp
+  803699:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  80369d:	49 89 f5             	mov    %rsi,%r13
+  8036a0:	41 89 d6             	mov    %edx,%r14d
+  8036a3:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  8036a6:	41 89 cc             	mov    %ecx,%r12d
+  8036a9:	44 89 c7             	mov    %r8d,%edi
+  8036ac:	44 89 cb             	mov    %r9d,%ebx
+  8036af:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8036b3:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8036b7:	48 b8 7d 19 80 00 00 	movabs $0x80197d,%rax
+  8036be:	00 00 00 
+  8036c1:	ff d0                	call   *%rax
+  8036c3:	41 89 c7             	mov    %eax,%r15d
+  8036c6:	85 c0                	test   %eax,%eax
+  8036c8:	0f 88 ae 01 00 00    	js     80387c <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8036ce:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8036d2:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  8036d9:	00 00 00 
+  8036dc:	8b 32                	mov    (%rdx),%esi
+  8036de:	39 30                	cmp    %esi,(%rax)
+  8036e0:	0f 85 7a 02 00 00    	jne    803960 <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  8036e6:	8b 40 08             	mov    0x8(%rax),%eax
+  8036e9:	83 e0 03             	and    $0x3,%eax
+  8036ec:	83 f8 01             	cmp    $0x1,%eax
+  8036ef:	0f 84 76 02 00 00    	je     80396b <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  8036f5:	4d 85 ed             	test   %r13,%r13
+  8036f8:	0f 84 78 02 00 00    	je     803976 <mmap+0x2ee>
+  8036fe:	85 db                	test   %ebx,%ebx
+  803700:	0f 88 70 02 00 00    	js     803976 <mmap+0x2ee>
+  803706:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  80370c:	41 89 df             	mov    %ebx,%r15d
+  80370f:	0f 85 6c 02 00 00    	jne    803981 <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  803715:	44 89 f0             	mov    %r14d,%eax
+  803718:	83 e0 fd             	and    $0xfffffffd,%eax
+  80371b:	83 f8 04             	cmp    $0x4,%eax
+  80371e:	0f 85 68 02 00 00    	jne    80398c <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  803724:	44 89 e1             	mov    %r12d,%ecx
+  803727:	83 e1 01             	and    $0x1,%ecx
+  80372a:	0f 95 c2             	setne  %dl
+  80372d:	44 89 e0             	mov    %r12d,%eax
+  803730:	d1 e8                	shr    %eax
+  803732:	83 f0 01             	xor    $0x1,%eax
+  803735:	83 e0 01             	and    $0x1,%eax
+  803738:	38 c2                	cmp    %al,%dl
+  80373a:	0f 85 57 02 00 00    	jne    803997 <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  803740:	85 c9                	test   %ecx,%ecx
+  803742:	74 0a                	je     80374e <mmap+0xc6>
+  803744:	41 f6 c6 02          	test   $0x2,%r14b
+  803748:	0f 85 54 02 00 00    	jne    8039a2 <mmap+0x31a>
+    file_flush_buffers();
+  80374e:	48 b8 03 32 80 00 00 	movabs $0x803203,%rax
+  803755:	00 00 00 
+  803758:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  80375a:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  803761:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  803768:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80376c:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  80376f:	41 f6 c4 04          	test   $0x4,%r12b
+  803773:	0f 84 15 01 00 00    	je     80388e <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  803779:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  80377c:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  803782:	0f 85 25 02 00 00    	jne    8039ad <mmap+0x325>
+  803788:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  80378c:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  803793:	00 00 00 
+  803796:	48 39 c2             	cmp    %rax,%rdx
+  803799:	0f 82 19 02 00 00    	jb     8039b8 <mmap+0x330>
+  80379f:	48 39 c7             	cmp    %rax,%rdi
+  8037a2:	0f 87 10 02 00 00    	ja     8039b8 <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  8037a8:	4c 89 ee             	mov    %r13,%rsi
+  8037ab:	48 b8 0b 35 80 00 00 	movabs $0x80350b,%rax
+  8037b2:	00 00 00 
+  8037b5:	ff d0                	call   *%rax
+  8037b7:	85 c0                	test   %eax,%eax
+  8037b9:	0f 88 04 02 00 00    	js     8039c3 <mmap+0x33b>
+    if (!handler) {
+  8037bf:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  8037c6:	00 00 00 
+  8037c9:	80 38 00             	cmpb   $0x0,(%rax)
+  8037cc:	75 2b                	jne    8037f9 <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  8037ce:	48 bf a3 25 80 00 00 	movabs $0x8025a3,%rdi
+  8037d5:	00 00 00 
+  8037d8:	48 b8 63 47 80 00 00 	movabs $0x804763,%rax
+  8037df:	00 00 00 
+  8037e2:	ff d0                	call   *%rax
+  8037e4:	85 c0                	test   %eax,%eax
+  8037e6:	0f 88 ea 01 00 00    	js     8039d6 <mmap+0x34e>
+        handler = 1;
+  8037ec:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  8037f3:	00 00 00 
+  8037f6:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  8037f9:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8037fd:	48 b8 42 26 80 00 00 	movabs $0x802642,%rax
+  803804:	00 00 00 
+  803807:	ff d0                	call   *%rax
+  803809:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  80380c:	48 85 c0             	test   %rax,%rax
+  80380f:	0f 84 c9 01 00 00    	je     8039de <mmap+0x356>
+    m->mm_start = va;
+  803815:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  803818:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  80381c:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  803820:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  803823:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  803827:	44 89 e0             	mov    %r12d,%eax
+  80382a:	c1 e0 06             	shl    $0x6,%eax
+  80382d:	25 80 00 00 00       	and    $0x80,%eax
+  803832:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  803835:	09 f0                	or     %esi,%eax
+  803837:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  80383b:	41 f6 c4 08          	test   $0x8,%r12b
+  80383f:	74 31                	je     803872 <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  803841:	48 39 d3             	cmp    %rdx,%rbx
+  803844:	73 2c                	jae    803872 <mmap+0x1ea>
+  803846:	ba 00 00 04 00       	mov    $0x40000,%edx
+  80384b:	48 89 de             	mov    %rbx,%rsi
+  80384e:	4c 89 f7             	mov    %r14,%rdi
+  803851:	48 b8 92 24 80 00 00 	movabs $0x802492,%rax
+  803858:	00 00 00 
+  80385b:	ff d0                	call   *%rax
+  80385d:	49 89 c4             	mov    %rax,%r12
+  803860:	48 85 c0             	test   %rax,%rax
+  803863:	0f 8e d7 00 00 00    	jle    803940 <mmap+0x2b8>
+            va += n;
+  803869:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  80386c:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  803870:	72 d4                	jb     803846 <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  803872:	49 8b 06             	mov    (%r14),%rax
+  803875:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  803879:	48 89 06             	mov    %rax,(%rsi)
+}
+  80387c:	44 89 f8             	mov    %r15d,%eax
+  80387f:	48 83 c4 28          	add    $0x28,%rsp
+  803883:	5b                   	pop    %rbx
+  803884:	41 5c                	pop    %r12
+  803886:	41 5d                	pop    %r13
+  803888:	41 5e                	pop    %r14
+  80388a:	41 5f                	pop    %r15
+  80388c:	5d                   	pop    %rbp
+  80388d:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80388e:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  803895:	00 00 00 
+  803898:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  80389b:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  8038a2:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8038a5:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  8038aa:	48 be 00 20 82 00 00 	movabs $0x822000,%rsi
+  8038b1:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8038b4:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  8038bb:	00 00 00 
+  8038be:	48 39 d7             	cmp    %rdx,%rdi
+  8038c1:	73 1c                	jae    8038df <mmap+0x257>
+        return -E_NO_MEM;
+  8038c3:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8038c9:	eb b1                	jmp    80387c <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8038cb:	48 83 c0 01          	add    $0x1,%rax
+  8038cf:	48 83 f8 1f          	cmp    $0x1f,%rax
+  8038d3:	77 3f                	ja     803914 <mmap+0x28c>
+  8038d5:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  8038da:	48 39 d7             	cmp    %rdx,%rdi
+  8038dd:	72 2a                	jb     803909 <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  8038df:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  8038e3:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  8038e7:	48 39 d1             	cmp    %rdx,%rcx
+  8038ea:	73 df                	jae    8038cb <mmap+0x243>
+  8038ec:	48 85 c9             	test   %rcx,%rcx
+  8038ef:	74 da                	je     8038cb <mmap+0x243>
+  8038f1:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  8038f5:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  8038fa:	48 39 d3             	cmp    %rdx,%rbx
+  8038fd:	73 cc                	jae    8038cb <mmap+0x243>
+            va = mmaps[i].mm_end;
+  8038ff:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803902:	b8 00 00 00 00       	mov    $0x0,%eax
+  803907:	eb cc                	jmp    8038d5 <mmap+0x24d>
+        return -E_NO_MEM;
+  803909:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80390f:	e9 68 ff ff ff       	jmp    80387c <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  803914:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  803919:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  803920:	00 00 00 
+  803923:	48 39 c2             	cmp    %rax,%rdx
+  803926:	0f 82 9f 00 00 00    	jb     8039cb <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  80392c:	48 85 db             	test   %rbx,%rbx
+  80392f:	0f 85 8a fe ff ff    	jne    8037bf <mmap+0x137>
+        return -E_NO_MEM;
+  803935:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80393b:	e9 3c ff ff ff       	jmp    80387c <mmap+0x1f4>
+        if (n < 0) {
+  803940:	0f 89 2c ff ff ff    	jns    803872 <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  803946:	49 8b 3e             	mov    (%r14),%rdi
+  803949:	4c 89 ee             	mov    %r13,%rsi
+  80394c:	48 b8 0b 35 80 00 00 	movabs $0x80350b,%rax
+  803953:	00 00 00 
+  803956:	ff d0                	call   *%rax
+            return n;
+  803958:	45 89 e7             	mov    %r12d,%r15d
+  80395b:	e9 1c ff ff ff       	jmp    80387c <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803960:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803966:	e9 11 ff ff ff       	jmp    80387c <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  80396b:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803971:	e9 06 ff ff ff       	jmp    80387c <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  803976:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80397c:	e9 fb fe ff ff       	jmp    80387c <mmap+0x1f4>
+  803981:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803987:	e9 f0 fe ff ff       	jmp    80387c <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  80398c:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803992:	e9 e5 fe ff ff       	jmp    80387c <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  803997:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80399d:	e9 da fe ff ff       	jmp    80387c <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  8039a2:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  8039a8:	e9 cf fe ff ff       	jmp    80387c <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  8039ad:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8039b3:	e9 c4 fe ff ff       	jmp    80387c <mmap+0x1f4>
+  8039b8:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8039be:	e9 b9 fe ff ff       	jmp    80387c <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  8039c3:	41 89 c7             	mov    %eax,%r15d
+  8039c6:	e9 b1 fe ff ff       	jmp    80387c <mmap+0x1f4>
+        return -E_NO_MEM;
+  8039cb:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8039d1:	e9 a6 fe ff ff       	jmp    80387c <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  8039d6:	41 89 c7             	mov    %eax,%r15d
+  8039d9:	e9 9e fe ff ff       	jmp    80387c <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  8039de:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8039e4:	e9 93 fe ff ff       	jmp    80387c <mmap+0x1f4>
+
+00000000008039e9 <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8039e9:	55                   	push   %rbp
+  8039ea:	48 89 e5             	mov    %rsp,%rbp
+  8039ed:	41 54                	push   %r12
+  8039ef:	53                   	push   %rbx
+  8039f0:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8039f3:	48 b8 01 19 80 00 00 	movabs $0x801901,%rax
+  8039fa:	00 00 00 
+  8039fd:	ff d0                	call   *%rax
+  8039ff:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803a02:	48 be 40 53 80 00 00 	movabs $0x805340,%rsi
+  803a09:	00 00 00 
+  803a0c:	48 89 df             	mov    %rbx,%rdi
+  803a0f:	48 b8 3d 0e 80 00 00 	movabs $0x800e3d,%rax
+  803a16:	00 00 00 
+  803a19:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803a1b:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803a20:	41 2b 04 24          	sub    (%r12),%eax
+  803a24:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803a2a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803a31:	00 00 00 
+    stat->st_dev = &devpipe;
+  803a34:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803a3b:	00 00 00 
+  803a3e:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803a45:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a4a:	5b                   	pop    %rbx
+  803a4b:	41 5c                	pop    %r12
+  803a4d:	5d                   	pop    %rbp
+  803a4e:	c3                   	ret
+
+0000000000803a4f <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  803a4f:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803a52:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  803a58:	8b 17                	mov    (%rdi),%edx
+  803a5a:	85 d2                	test   %edx,%edx
+  803a5c:	75 01                	jne    803a5f <pipe_wakeup+0x10>
+  803a5e:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  803a5f:	55                   	push   %rbp
+  803a60:	48 89 e5             	mov    %rsp,%rbp
+  803a63:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  803a66:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  803a6c:	be 00 04 00 00       	mov    $0x400,%esi
+  803a71:	48 b8 28 17 80 00 00 	movabs $0x801728,%rax
+  803a78:	00 00 00 
+  803a7b:	ff d0                	call   *%rax
+}
+  803a7d:	5d                   	pop    %rbp
+  803a7e:	c3                   	ret
+
+0000000000803a7f <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803a7f:	55                   	push   %rbp
+  803a80:	48 89 e5             	mov    %rsp,%rbp
+  803a83:	41 55                	push   %r13
+  803a85:	41 54                	push   %r12
+  803a87:	53                   	push   %rbx
+  803a88:	48 83 ec 08          	sub    $0x8,%rsp
+  803a8c:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803a8f:	48 b8 01 19 80 00 00 	movabs $0x801901,%rax
+  803a96:	00 00 00 
+  803a99:	ff d0                	call   *%rax
+  803a9b:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803a9e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803aa3:	4c 89 e6             	mov    %r12,%rsi
+  803aa6:	bf 00 00 00 00       	mov    $0x0,%edi
+  803aab:	49 bc 42 14 80 00 00 	movabs $0x801442,%r12
+  803ab2:	00 00 00 
+  803ab5:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803ab8:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803abc:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803ac0:	49 bd 4f 3a 80 00 00 	movabs $0x803a4f,%r13
+  803ac7:	00 00 00 
+  803aca:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803acd:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803ad1:	48 89 de             	mov    %rbx,%rsi
+  803ad4:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  803ad7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803adc:	48 89 de             	mov    %rbx,%rsi
+  803adf:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ae4:	41 ff d4             	call   *%r12
+  803ae7:	48 83 c4 08          	add    $0x8,%rsp
+  803aeb:	5b                   	pop    %rbx
+  803aec:	41 5c                	pop    %r12
+  803aee:	41 5d                	pop    %r13
+  803af0:	5d                   	pop    %rbp
+  803af1:	c3                   	ret
+
+0000000000803af2 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  803af2:	55                   	push   %rbp
+  803af3:	48 89 e5             	mov    %rsp,%rbp
+  803af6:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803af9:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803afe:	be 00 10 00 00       	mov    $0x1000,%esi
+  803b03:	48 b8 85 13 80 00 00 	movabs $0x801385,%rax
+  803b0a:	00 00 00 
+  803b0d:	ff d0                	call   *%rax
+  803b0f:	85 c0                	test   %eax,%eax
+  803b11:	0f 94 c0             	sete   %al
+  803b14:	0f b6 c0             	movzbl %al,%eax
+}
+  803b17:	5d                   	pop    %rbp
+  803b18:	c3                   	ret
+
+0000000000803b19 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803b19:	55                   	push   %rbp
+  803b1a:	48 89 e5             	mov    %rsp,%rbp
+  803b1d:	41 57                	push   %r15
+  803b1f:	41 56                	push   %r14
+  803b21:	41 55                	push   %r13
+  803b23:	41 54                	push   %r12
+  803b25:	53                   	push   %rbx
+  803b26:	48 83 ec 38          	sub    $0x38,%rsp
+  803b2a:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803b2e:	49 89 f4             	mov    %rsi,%r12
+  803b31:	49 89 d7             	mov    %rdx,%r15
+  803b34:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803b38:	48 b8 01 19 80 00 00 	movabs $0x801901,%rax
+  803b3f:	00 00 00 
+  803b42:	ff d0                	call   *%rax
+  803b44:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803b47:	4d 85 ff             	test   %r15,%r15
+  803b4a:	0f 84 f1 00 00 00    	je     803c41 <devpipe_write+0x128>
+  803b50:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  803b54:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  803b58:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  803b5c:	49 bd f2 3a 80 00 00 	movabs $0x803af2,%r13
+  803b63:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803b66:	49 bf 4f 3a 80 00 00 	movabs $0x803a4f,%r15
+  803b6d:	00 00 00 
+  803b70:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803b74:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b78:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803b7c:	8b 73 04             	mov    0x4(%rbx),%esi
+  803b7f:	48 63 ce             	movslq %esi,%rcx
+  803b82:	48 63 03             	movslq (%rbx),%rax
+  803b85:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  803b8b:	48 39 c1             	cmp    %rax,%rcx
+  803b8e:	72 64                	jb     803bf4 <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  803b90:	48 89 de             	mov    %rbx,%rsi
+  803b93:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803b97:	41 ff d5             	call   *%r13
+  803b9a:	85 c0                	test   %eax,%eax
+  803b9c:	0f 85 b9 00 00 00    	jne    803c5b <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803ba2:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803ba6:	4c 89 f7             	mov    %r14,%rdi
+  803ba9:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  803bac:	8b 43 04             	mov    0x4(%rbx),%eax
+  803baf:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  803bb6:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803bbd:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803bc3:	8b 03                	mov    (%rbx),%eax
+  803bc5:	41 39 c4             	cmp    %eax,%r12d
+  803bc8:	75 b2                	jne    803b7c <devpipe_write+0x63>
+  803bca:	48 89 de             	mov    %rbx,%rsi
+  803bcd:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803bd1:	41 ff d5             	call   *%r13
+  803bd4:	85 c0                	test   %eax,%eax
+  803bd6:	75 a0                	jne    803b78 <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803bd8:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803bdd:	44 89 e6             	mov    %r12d,%esi
+  803be0:	48 89 df             	mov    %rbx,%rdi
+  803be3:	48 b8 0a 17 80 00 00 	movabs $0x80170a,%rax
+  803bea:	00 00 00 
+  803bed:	ff d0                	call   *%rax
+  803bef:	e9 7c ff ff ff       	jmp    803b70 <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803bf4:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  803bf8:	41 0f b6 38          	movzbl (%r8),%edi
+  803bfc:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803c03:	80 80 80 
+  803c06:	48 89 c8             	mov    %rcx,%rax
+  803c09:	48 f7 e2             	mul    %rdx
+  803c0c:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803c10:	48 89 d0             	mov    %rdx,%rax
+  803c13:	48 c1 e0 08          	shl    $0x8,%rax
+  803c17:	48 29 d0             	sub    %rdx,%rax
+  803c1a:	48 c1 e0 04          	shl    $0x4,%rax
+  803c1e:	48 29 c1             	sub    %rax,%rcx
+  803c21:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  803c26:	83 c6 01             	add    $0x1,%esi
+  803c29:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803c2c:	49 83 c0 01          	add    $0x1,%r8
+  803c30:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  803c34:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803c38:	49 39 c0             	cmp    %rax,%r8
+  803c3b:	0f 85 2f ff ff ff    	jne    803b70 <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803c41:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803c45:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803c49:	48 b8 4f 3a 80 00 00 	movabs $0x803a4f,%rax
+  803c50:	00 00 00 
+  803c53:	ff d0                	call   *%rax
+    return n;
+  803c55:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803c59:	eb 05                	jmp    803c60 <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  803c5b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803c60:	48 83 c4 38          	add    $0x38,%rsp
+  803c64:	5b                   	pop    %rbx
+  803c65:	41 5c                	pop    %r12
+  803c67:	41 5d                	pop    %r13
+  803c69:	41 5e                	pop    %r14
+  803c6b:	41 5f                	pop    %r15
+  803c6d:	5d                   	pop    %rbp
+  803c6e:	c3                   	ret
+
+0000000000803c6f <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803c6f:	55                   	push   %rbp
+  803c70:	48 89 e5             	mov    %rsp,%rbp
+  803c73:	41 57                	push   %r15
+  803c75:	41 56                	push   %r14
+  803c77:	41 55                	push   %r13
+  803c79:	41 54                	push   %r12
+  803c7b:	53                   	push   %rbx
+  803c7c:	48 83 ec 28          	sub    $0x28,%rsp
+  803c80:	49 89 fd             	mov    %rdi,%r13
+  803c83:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  803c87:	49 89 d4             	mov    %rdx,%r12
+  803c8a:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803c8e:	48 b8 01 19 80 00 00 	movabs $0x801901,%rax
+  803c95:	00 00 00 
+  803c98:	ff d0                	call   *%rax
+  803c9a:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803c9d:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  803ca3:	49 bf f2 3a 80 00 00 	movabs $0x803af2,%r15
+  803caa:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803cad:	4d 85 e4             	test   %r12,%r12
+  803cb0:	0f 84 d5 00 00 00    	je     803d8b <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803cb6:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803cba:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803cbe:	8b 03                	mov    (%rbx),%eax
+  803cc0:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803cc3:	75 7a                	jne    803d3f <devpipe_read+0xd0>
+            if (i > 0) {
+  803cc5:	4d 85 f6             	test   %r14,%r14
+  803cc8:	75 50                	jne    803d1a <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  803cca:	48 89 de             	mov    %rbx,%rsi
+  803ccd:	4c 89 ef             	mov    %r13,%rdi
+  803cd0:	41 ff d7             	call   *%r15
+  803cd3:	85 c0                	test   %eax,%eax
+  803cd5:	0f 85 c9 00 00 00    	jne    803da4 <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803cdb:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  803cde:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803ce5:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803ceb:	8b 43 04             	mov    0x4(%rbx),%eax
+  803cee:	41 39 c4             	cmp    %eax,%r12d
+  803cf1:	75 cb                	jne    803cbe <devpipe_read+0x4f>
+  803cf3:	48 89 de             	mov    %rbx,%rsi
+  803cf6:	4c 89 ef             	mov    %r13,%rdi
+  803cf9:	41 ff d7             	call   *%r15
+  803cfc:	85 c0                	test   %eax,%eax
+  803cfe:	75 be                	jne    803cbe <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803d00:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803d05:	44 89 e6             	mov    %r12d,%esi
+  803d08:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803d0c:	48 b8 0a 17 80 00 00 	movabs $0x80170a,%rax
+  803d13:	00 00 00 
+  803d16:	ff d0                	call   *%rax
+  803d18:	eb a4                	jmp    803cbe <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803d1a:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803d1e:	48 89 de             	mov    %rbx,%rsi
+  803d21:	48 b8 4f 3a 80 00 00 	movabs $0x803a4f,%rax
+  803d28:	00 00 00 
+  803d2b:	ff d0                	call   *%rax
+                return i;
+  803d2d:	4c 89 f0             	mov    %r14,%rax
+}
+  803d30:	48 83 c4 28          	add    $0x28,%rsp
+  803d34:	5b                   	pop    %rbx
+  803d35:	41 5c                	pop    %r12
+  803d37:	41 5d                	pop    %r13
+  803d39:	41 5e                	pop    %r14
+  803d3b:	41 5f                	pop    %r15
+  803d3d:	5d                   	pop    %rbp
+  803d3e:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803d3f:	48 63 c8             	movslq %eax,%rcx
+  803d42:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803d49:	80 80 80 
+  803d4c:	48 89 c8             	mov    %rcx,%rax
+  803d4f:	48 f7 e2             	mul    %rdx
+  803d52:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803d56:	48 89 d0             	mov    %rdx,%rax
+  803d59:	48 c1 e0 08          	shl    $0x8,%rax
+  803d5d:	48 29 d0             	sub    %rdx,%rax
+  803d60:	48 c1 e0 04          	shl    $0x4,%rax
+  803d64:	48 89 c2             	mov    %rax,%rdx
+  803d67:	48 89 c8             	mov    %rcx,%rax
+  803d6a:	48 29 d0             	sub    %rdx,%rax
+  803d6d:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  803d72:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803d76:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  803d7a:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803d7d:	49 83 c6 01          	add    $0x1,%r14
+  803d81:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  803d85:	0f 85 2b ff ff ff    	jne    803cb6 <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803d8b:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803d8f:	48 89 de             	mov    %rbx,%rsi
+  803d92:	48 b8 4f 3a 80 00 00 	movabs $0x803a4f,%rax
+  803d99:	00 00 00 
+  803d9c:	ff d0                	call   *%rax
+    return n;
+  803d9e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803da2:	eb 8c                	jmp    803d30 <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  803da4:	b8 00 00 00 00       	mov    $0x0,%eax
+  803da9:	eb 85                	jmp    803d30 <devpipe_read+0xc1>
+
+0000000000803dab <pipe>:
+pipe(int pfd[2]) {
+  803dab:	55                   	push   %rbp
+  803dac:	48 89 e5             	mov    %rsp,%rbp
+  803daf:	41 55                	push   %r13
+  803db1:	41 54                	push   %r12
+  803db3:	53                   	push   %rbx
+  803db4:	48 83 ec 18          	sub    $0x18,%rsp
+  803db8:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803dbb:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803dbf:	48 b8 1d 19 80 00 00 	movabs $0x80191d,%rax
+  803dc6:	00 00 00 
+  803dc9:	ff d0                	call   *%rax
+  803dcb:	89 c3                	mov    %eax,%ebx
+  803dcd:	85 c0                	test   %eax,%eax
+  803dcf:	0f 88 a0 01 00 00    	js     803f75 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803dd5:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803dda:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ddf:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803de3:	bf 00 00 00 00       	mov    $0x0,%edi
+  803de8:	48 b8 9c 13 80 00 00 	movabs $0x80139c,%rax
+  803def:	00 00 00 
+  803df2:	ff d0                	call   *%rax
+  803df4:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803df6:	85 c0                	test   %eax,%eax
+  803df8:	0f 88 77 01 00 00    	js     803f75 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803dfe:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803e02:	48 b8 1d 19 80 00 00 	movabs $0x80191d,%rax
+  803e09:	00 00 00 
+  803e0c:	ff d0                	call   *%rax
+  803e0e:	89 c3                	mov    %eax,%ebx
+  803e10:	85 c0                	test   %eax,%eax
+  803e12:	0f 88 43 01 00 00    	js     803f5b <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803e18:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803e1d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803e22:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803e26:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e2b:	48 b8 9c 13 80 00 00 	movabs $0x80139c,%rax
+  803e32:	00 00 00 
+  803e35:	ff d0                	call   *%rax
+  803e37:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803e39:	85 c0                	test   %eax,%eax
+  803e3b:	0f 88 1a 01 00 00    	js     803f5b <pipe+0x1b0>
+    va = fd2data(fd0);
+  803e41:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803e45:	48 b8 01 19 80 00 00 	movabs $0x801901,%rax
+  803e4c:	00 00 00 
+  803e4f:	ff d0                	call   *%rax
+  803e51:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803e54:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803e59:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803e5e:	48 89 c6             	mov    %rax,%rsi
+  803e61:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e66:	48 b8 9c 13 80 00 00 	movabs $0x80139c,%rax
+  803e6d:	00 00 00 
+  803e70:	ff d0                	call   *%rax
+  803e72:	89 c3                	mov    %eax,%ebx
+  803e74:	85 c0                	test   %eax,%eax
+  803e76:	0f 88 c5 00 00 00    	js     803f41 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803e7c:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803e80:	48 b8 01 19 80 00 00 	movabs $0x801901,%rax
+  803e87:	00 00 00 
+  803e8a:	ff d0                	call   *%rax
+  803e8c:	48 89 c1             	mov    %rax,%rcx
+  803e8f:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803e95:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803e9b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803ea0:	4c 89 ee             	mov    %r13,%rsi
+  803ea3:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ea8:	48 b8 f2 13 80 00 00 	movabs $0x8013f2,%rax
+  803eaf:	00 00 00 
+  803eb2:	ff d0                	call   *%rax
+  803eb4:	89 c3                	mov    %eax,%ebx
+  803eb6:	85 c0                	test   %eax,%eax
+  803eb8:	78 6e                	js     803f28 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803eba:	be 00 10 00 00       	mov    $0x1000,%esi
+  803ebf:	4c 89 ef             	mov    %r13,%rdi
+  803ec2:	48 b8 61 13 80 00 00 	movabs $0x801361,%rax
+  803ec9:	00 00 00 
+  803ecc:	ff d0                	call   *%rax
+  803ece:	83 f8 02             	cmp    $0x2,%eax
+  803ed1:	0f 85 ab 00 00 00    	jne    803f82 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803ed7:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803ede:	00 00 
+  803ee0:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803ee4:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803ee6:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803eea:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803ef1:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803ef5:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803ef7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803efb:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803f02:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803f06:	48 bb ef 18 80 00 00 	movabs $0x8018ef,%rbx
+  803f0d:	00 00 00 
+  803f10:	ff d3                	call   *%rbx
+  803f12:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803f16:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803f1a:	ff d3                	call   *%rbx
+  803f1c:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803f21:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803f26:	eb 4d                	jmp    803f75 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803f28:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f2d:	4c 89 ee             	mov    %r13,%rsi
+  803f30:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f35:	48 b8 42 14 80 00 00 	movabs $0x801442,%rax
+  803f3c:	00 00 00 
+  803f3f:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803f41:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f46:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803f4a:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f4f:	48 b8 42 14 80 00 00 	movabs $0x801442,%rax
+  803f56:	00 00 00 
+  803f59:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803f5b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f60:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803f64:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f69:	48 b8 42 14 80 00 00 	movabs $0x801442,%rax
+  803f70:	00 00 00 
+  803f73:	ff d0                	call   *%rax
+}
+  803f75:	89 d8                	mov    %ebx,%eax
+  803f77:	48 83 c4 18          	add    $0x18,%rsp
+  803f7b:	5b                   	pop    %rbx
+  803f7c:	41 5c                	pop    %r12
+  803f7e:	41 5d                	pop    %r13
+  803f80:	5d                   	pop    %rbp
+  803f81:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803f82:	48 b9 70 53 80 00 00 	movabs $0x805370,%rcx
+  803f89:	00 00 00 
+  803f8c:	48 ba 47 53 80 00 00 	movabs $0x805347,%rdx
+  803f93:	00 00 00 
+  803f96:	be 50 00 00 00       	mov    $0x50,%esi
+  803f9b:	48 bf 5c 53 80 00 00 	movabs $0x80535c,%rdi
+  803fa2:	00 00 00 
+  803fa5:	b8 00 00 00 00       	mov    $0x0,%eax
+  803faa:	49 b8 c8 03 80 00 00 	movabs $0x8003c8,%r8
+  803fb1:	00 00 00 
+  803fb4:	41 ff d0             	call   *%r8
+
+0000000000803fb7 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803fb7:	55                   	push   %rbp
+  803fb8:	48 89 e5             	mov    %rsp,%rbp
+  803fbb:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803fbf:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803fc3:	48 b8 7d 19 80 00 00 	movabs $0x80197d,%rax
+  803fca:	00 00 00 
+  803fcd:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803fcf:	85 c0                	test   %eax,%eax
+  803fd1:	78 23                	js     803ff6 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803fd3:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803fd7:	48 b8 01 19 80 00 00 	movabs $0x801901,%rax
+  803fde:	00 00 00 
+  803fe1:	ff d0                	call   *%rax
+  803fe3:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  803fe6:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803fea:	48 b8 f2 3a 80 00 00 	movabs $0x803af2,%rax
+  803ff1:	00 00 00 
+  803ff4:	ff d0                	call   *%rax
+}
+  803ff6:	c9                   	leave
+  803ff7:	c3                   	ret
+
+0000000000803ff8 <wait>:
+#include <inc/lib.h>
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  803ff8:	55                   	push   %rbp
+  803ff9:	48 89 e5             	mov    %rsp,%rbp
+  803ffc:	41 56                	push   %r14
+  803ffe:	41 55                	push   %r13
+  804000:	41 54                	push   %r12
+  804002:	53                   	push   %rbx
+    assert(envid != 0);
+  804003:	85 ff                	test   %edi,%edi
+  804005:	0f 84 b7 00 00 00    	je     8040c2 <wait+0xca>
+  80400b:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  80400e:	89 f9                	mov    %edi,%ecx
+  804010:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+
+    for (;;) {
+        uint32_t seq = env->env_wait_seq;
+  804016:	48 bf 00 00 c0 1f 80 	movabs $0x801fc00000,%rdi
+  80401d:	00 00 00 
+  804020:	45 89 e0             	mov    %r12d,%r8d
+  804023:	41 81 e0 ff 03 00 00 	and    $0x3ff,%r8d
+  80402a:	4c 89 c0             	mov    %r8,%rax
+  80402d:	48 c1 e0 04          	shl    $0x4,%rax
+  804031:	48 89 c2             	mov    %rax,%rdx
+  804034:	4c 29 c2             	sub    %r8,%rdx
+  804037:	48 c1 e2 05          	shl    $0x5,%rdx
+  80403b:	48 01 fa             	add    %rdi,%rdx
+  80403e:	8b b2 b8 01 00 00    	mov    0x1b8(%rdx),%esi
+        if (env->env_id != envid || env->env_status == ENV_FREE) break;
+  804044:	8b 82 c8 00 00 00    	mov    0xc8(%rdx),%eax
+  80404a:	41 39 c4             	cmp    %eax,%r12d
+  80404d:	75 6a                	jne    8040b9 <wait+0xc1>
+
+        /* The kernel wakes us up when the environment is freed */
+        sys_futex_wait(&env->env_wait_seq, seq, 0);
+  80404f:	48 63 d1             	movslq %ecx,%rdx
+  804052:	48 89 d0             	mov    %rdx,%rax
+  804055:	48 c1 e0 04          	shl    $0x4,%rax
+  804059:	48 29 d0             	sub    %rdx,%rax
+  80405c:	48 c1 e0 05          	shl    $0x5,%rax
+  804060:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804067:	00 00 00 
+  80406a:	4c 8d b4 02 b8 01 00 	lea    0x1b8(%rdx,%rax,1),%r14
+  804071:	00 
+        if (env->env_id != envid || env->env_status == ENV_FREE) break;
+  804072:	48 63 c9             	movslq %ecx,%rcx
+  804075:	48 89 c8             	mov    %rcx,%rax
+  804078:	48 c1 e0 04          	shl    $0x4,%rax
+  80407c:	48 29 c8             	sub    %rcx,%rax
+  80407f:	48 c1 e0 05          	shl    $0x5,%rax
+  804083:	48 89 d3             	mov    %rdx,%rbx
+  804086:	48 01 c3             	add    %rax,%rbx
+        sys_futex_wait(&env->env_wait_seq, seq, 0);
+  804089:	49 bd 0a 17 80 00 00 	movabs $0x80170a,%r13
+  804090:	00 00 00 
+        if (env->env_id != envid || env->env_status == ENV_FREE) break;
+  804093:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+  804099:	85 c0                	test   %eax,%eax
+  80409b:	74 1c                	je     8040b9 <wait+0xc1>
+        sys_futex_wait(&env->env_wait_seq, seq, 0);
+  80409d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8040a2:	4c 89 f7             	mov    %r14,%rdi
+  8040a5:	41 ff d5             	call   *%r13
+        uint32_t seq = env->env_wait_seq;
+  8040a8:	8b b3 b8 01 00 00    	mov    0x1b8(%rbx),%esi
+        if (env->env_id != envid || env->env_status == ENV_FREE) break;
+  8040ae:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  8040b4:	44 39 e0             	cmp    %r12d,%eax
+  8040b7:	74 da                	je     804093 <wait+0x9b>
+    }
+}
+  8040b9:	5b                   	pop    %rbx
+  8040ba:	41 5c                	pop    %r12
+  8040bc:	41 5d                	pop    %r13
+  8040be:	41 5e                	pop    %r14
+  8040c0:	5d                   	pop    %rbp
+  8040c1:	c3                   	ret
+    assert(envid != 0);
+  8040c2:	48 b9 94 53 80 00 00 	movabs $0x805394,%rcx
+  8040c9:	00 00 00 
+  8040cc:	48 ba 47 53 80 00 00 	movabs $0x805347,%rdx
+  8040d3:	00 00 00 
+  8040d6:	be 06 00 00 00       	mov    $0x6,%esi
+  8040db:	48 bf 9f 53 80 00 00 	movabs $0x80539f,%rdi
+  8040e2:	00 00 00 
+  8040e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040ea:	49 b8 c8 03 80 00 00 	movabs $0x8003c8,%r8
+  8040f1:	00 00 00 
+  8040f4:	41 ff d0             	call   *%r8
+
+00000000008040f7 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8040f7:	48 89 f8             	mov    %rdi,%rax
+  8040fa:	48 c1 e8 27          	shr    $0x27,%rax
+  8040fe:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804105:	01 00 00 
+  804108:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80410c:	f6 c2 01             	test   $0x1,%dl
+  80410f:	74 6d                	je     80417e <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804111:	48 89 f8             	mov    %rdi,%rax
+  804114:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804118:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80411f:	01 00 00 
+  804122:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804126:	f6 c2 01             	test   $0x1,%dl
+  804129:	74 62                	je     80418d <get_uvpt_entry+0x96>
+  80412b:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804132:	01 00 00 
+  804135:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804139:	f6 c2 80             	test   $0x80,%dl
+  80413c:	75 4f                	jne    80418d <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80413e:	48 89 f8             	mov    %rdi,%rax
+  804141:	48 c1 e8 15          	shr    $0x15,%rax
+  804145:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80414c:	01 00 00 
+  80414f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804153:	f6 c2 01             	test   $0x1,%dl
+  804156:	74 44                	je     80419c <get_uvpt_entry+0xa5>
+  804158:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80415f:	01 00 00 
+  804162:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804166:	f6 c2 80             	test   $0x80,%dl
+  804169:	75 31                	jne    80419c <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80416b:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80416f:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804176:	01 00 00 
+  804179:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80417d:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80417e:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804185:	01 00 00 
+  804188:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80418c:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80418d:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804194:	01 00 00 
+  804197:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80419b:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80419c:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8041a3:	01 00 00 
+  8041a6:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8041aa:	c3                   	ret
+
+00000000008041ab <get_prot>:
+
+int
+get_prot(void *va) {
+  8041ab:	55                   	push   %rbp
+  8041ac:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8041af:	48 b8 f7 40 80 00 00 	movabs $0x8040f7,%rax
+  8041b6:	00 00 00 
+  8041b9:	ff d0                	call   *%rax
+  8041bb:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8041be:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8041c3:	89 c1                	mov    %eax,%ecx
+  8041c5:	83 c9 04             	or     $0x4,%ecx
+  8041c8:	f6 c2 01             	test   $0x1,%dl
+  8041cb:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8041ce:	89 c1                	mov    %eax,%ecx
+  8041d0:	83 c9 02             	or     $0x2,%ecx
+  8041d3:	f6 c2 02             	test   $0x2,%dl
+  8041d6:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8041d9:	89 c1                	mov    %eax,%ecx
+  8041db:	83 c9 01             	or     $0x1,%ecx
+  8041de:	48 85 d2             	test   %rdx,%rdx
+  8041e1:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8041e4:	89 c1                	mov    %eax,%ecx
+  8041e6:	83 c9 40             	or     $0x40,%ecx
+  8041e9:	f6 c6 04             	test   $0x4,%dh
+  8041ec:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8041ef:	5d                   	pop    %rbp
+  8041f0:	c3                   	ret
+
+00000000008041f1 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8041f1:	55                   	push   %rbp
+  8041f2:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8041f5:	48 b8 f7 40 80 00 00 	movabs $0x8040f7,%rax
+  8041fc:	00 00 00 
+  8041ff:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804201:	48 c1 e8 06          	shr    $0x6,%rax
+  804205:	83 e0 01             	and    $0x1,%eax
+}
+  804208:	5d                   	pop    %rbp
+  804209:	c3                   	ret
+
+000000000080420a <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80420a:	55                   	push   %rbp
+  80420b:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80420e:	48 b8 f7 40 80 00 00 	movabs $0x8040f7,%rax
+  804215:	00 00 00 
+  804218:	ff d0                	call   *%rax
+  80421a:	83 e0 01             	and    $0x1,%eax
+}
+  80421d:	5d                   	pop    %rbp
+  80421e:	c3                   	ret
+
+000000000080421f <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  80421f:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  804226:	01 00 00 
+  804229:	a8 01                	test   $0x1,%al
+  80422b:	75 06                	jne    804233 <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  80422d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804232:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804233:	55                   	push   %rbp
+  804234:	48 89 e5             	mov    %rsp,%rbp
+  804237:	41 57                	push   %r15
+  804239:	41 56                	push   %r14
+  80423b:	41 55                	push   %r13
+  80423d:	41 54                	push   %r12
+  80423f:	53                   	push   %rbx
+  804240:	48 83 ec 28          	sub    $0x28,%rsp
+  804244:	49 89 fe             	mov    %rdi,%r14
+  804247:	49 89 f7             	mov    %rsi,%r15
+  80424a:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  804251:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  804252:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  804259:	01 00 00 
+  80425c:	e9 ae 00 00 00       	jmp    80430f <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  804261:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804268:	49 83 ec 01          	sub    $0x1,%r12
+  80426c:	74 2d                	je     80429b <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  80426e:	48 89 d8             	mov    %rbx,%rax
+  804271:	48 c1 e8 0c          	shr    $0xc,%rax
+  804275:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  80427a:	f6 c2 01             	test   $0x1,%dl
+  80427d:	74 e2                	je     804261 <foreach_shared_region+0x42>
+  80427f:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  804284:	f6 c4 04             	test   $0x4,%ah
+  804287:	74 d8                	je     804261 <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  804289:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  804290:	4c 89 fa             	mov    %r15,%rdx
+  804293:	48 89 df             	mov    %rbx,%rdi
+  804296:	41 ff d6             	call   *%r14
+  804299:	eb c6                	jmp    804261 <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  80429b:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  8042a2:	00 
+  8042a3:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  8042a8:	74 4a                	je     8042f4 <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  8042aa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8042ae:	48 c1 e8 15          	shr    $0x15,%rax
+  8042b2:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  8042b9:	01 00 00 
+  8042bc:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  8042c0:	a8 01                	test   $0x1,%al
+  8042c2:	74 d7                	je     80429b <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  8042c4:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  8042c8:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  8042cf:	48 39 c3             	cmp    %rax,%rbx
+  8042d2:	73 c7                	jae    80429b <foreach_shared_region+0x7c>
+  8042d4:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  8042db:	48 39 d0             	cmp    %rdx,%rax
+  8042de:	4d 19 e4             	sbb    %r12,%r12
+  8042e1:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  8042e8:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  8042ef:	e9 7a ff ff ff       	jmp    80426e <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  8042f4:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  8042fb:	40 
+  8042fc:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804300:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804307:	00 00 00 
+  80430a:	48 39 c1             	cmp    %rax,%rcx
+  80430d:	74 50                	je     80435f <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  80430f:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804313:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804317:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  80431e:	01 00 00 
+  804321:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804325:	a8 01                	test   $0x1,%al
+  804327:	74 cb                	je     8042f4 <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  804329:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80432d:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  804334:	48 39 c1             	cmp    %rax,%rcx
+  804337:	73 bb                	jae    8042f4 <foreach_shared_region+0xd5>
+  804339:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  804340:	48 39 d0             	cmp    %rdx,%rax
+  804343:	48 19 c0             	sbb    %rax,%rax
+  804346:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  80434c:	48 05 00 02 00 00    	add    $0x200,%rax
+  804352:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804356:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80435a:	e9 4b ff ff ff       	jmp    8042aa <foreach_shared_region+0x8b>
+  80435f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804364:	48 83 c4 28          	add    $0x28,%rsp
+  804368:	5b                   	pop    %rbx
+  804369:	41 5c                	pop    %r12
+  80436b:	41 5d                	pop    %r13
+  80436d:	41 5e                	pop    %r14
+  80436f:	41 5f                	pop    %r15
+  804371:	5d                   	pop    %rbp
+  804372:	c3                   	ret
+
+0000000000804373 <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  804373:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  804379:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  804380:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  804387:	c3                   	ret
+
+0000000000804388 <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  804388:	8b 47 40             	mov    0x40(%rdi),%eax
+  80438b:	8b 17                	mov    (%rdi),%edx
+  80438d:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  80438f:	83 f8 0f             	cmp    $0xf,%eax
+  804392:	77 13                	ja     8043a7 <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  804394:	8b 47 40             	mov    0x40(%rdi),%eax
+  804397:	83 e0 0f             	and    $0xf,%eax
+  80439a:	48 c1 e0 09          	shl    $0x9,%rax
+  80439e:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  8043a5:	00 
+  8043a6:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  8043a7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8043ac:	c3                   	ret
+
+00000000008043ad <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  8043ad:	8b 47 40             	mov    0x40(%rdi),%eax
+  8043b0:	83 c0 01             	add    $0x1,%eax
+  8043b3:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8043b6:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  8043bc:	8b 57 04             	mov    0x4(%rdi),%edx
+  8043bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043c4:	85 d2                	test   %edx,%edx
+  8043c6:	75 04                	jne    8043cc <chan_publish+0x1f>
+  8043c8:	83 e0 01             	and    $0x1,%eax
+}
+  8043cb:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  8043cc:	87 47 04             	xchg   %eax,0x4(%rdi)
+  8043cf:	85 c0                	test   %eax,%eax
+  8043d1:	0f 95 c0             	setne  %al
+  8043d4:	0f b6 c0             	movzbl %al,%eax
+  8043d7:	eb ef                	jmp    8043c8 <chan_publish+0x1b>
+
+00000000008043d9 <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  8043d9:	8b 47 40             	mov    0x40(%rdi),%eax
+  8043dc:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  8043de:	29 d0                	sub    %edx,%eax
+  8043e0:	83 e8 01             	sub    $0x1,%eax
+  8043e3:	83 f8 0f             	cmp    $0xf,%eax
+  8043e6:	77 12                	ja     8043fa <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  8043e8:	8b 07                	mov    (%rdi),%eax
+  8043ea:	83 e0 0f             	and    $0xf,%eax
+  8043ed:	48 c1 e0 09          	shl    $0x9,%rax
+  8043f1:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  8043f8:	00 
+  8043f9:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  8043fa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8043ff:	c3                   	ret
+
+0000000000804400 <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  804400:	8b 07                	mov    (%rdi),%eax
+  804402:	83 c0 01             	add    $0x1,%eax
+  804405:	89 07                	mov    %eax,(%rdi)
+}
+  804407:	c3                   	ret
+
+0000000000804408 <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  804408:	55                   	push   %rbp
+  804409:	48 89 e5             	mov    %rsp,%rbp
+  80440c:	53                   	push   %rbx
+  80440d:	48 83 ec 08          	sub    $0x8,%rsp
+  804411:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  804414:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  80441b:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  804421:	48 b8 d9 43 80 00 00 	movabs $0x8043d9,%rax
+  804428:	00 00 00 
+  80442b:	ff d0                	call   *%rax
+  80442d:	48 85 c0             	test   %rax,%rax
+  804430:	74 12                	je     804444 <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  804432:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  804439:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80443e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804442:	c9                   	leave
+  804443:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  804444:	b8 01 00 00 00       	mov    $0x1,%eax
+  804449:	eb f3                	jmp    80443e <chan_arm+0x36>
+
+000000000080444b <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  80444b:	55                   	push   %rbp
+  80444c:	48 89 e5             	mov    %rsp,%rbp
+  80444f:	41 56                	push   %r14
+  804451:	41 55                	push   %r13
+  804453:	41 54                	push   %r12
+  804455:	53                   	push   %rbx
+  804456:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  804459:	49 bc 08 44 80 00 00 	movabs $0x804408,%r12
+  804460:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  804463:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  804467:	49 bd 0a 17 80 00 00 	movabs $0x80170a,%r13
+  80446e:	00 00 00 
+    while (chan_arm(r))
+  804471:	eb 0d                	jmp    804480 <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  804473:	8b 33                	mov    (%rbx),%esi
+  804475:	ba 00 00 00 00       	mov    $0x0,%edx
+  80447a:	4c 89 f7             	mov    %r14,%rdi
+  80447d:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  804480:	48 89 df             	mov    %rbx,%rdi
+  804483:	41 ff d4             	call   *%r12
+  804486:	84 c0                	test   %al,%al
+  804488:	75 e9                	jne    804473 <chan_wait+0x28>
+}
+  80448a:	5b                   	pop    %rbx
+  80448b:	41 5c                	pop    %r12
+  80448d:	41 5d                	pop    %r13
+  80448f:	41 5e                	pop    %r14
+  804491:	5d                   	pop    %rbp
+  804492:	c3                   	ret
+
+0000000000804493 <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  804493:	55                   	push   %rbp
+  804494:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  804497:	48 83 c7 40          	add    $0x40,%rdi
+  80449b:	be 01 00 00 00       	mov    $0x1,%esi
+  8044a0:	48 b8 28 17 80 00 00 	movabs $0x801728,%rax
+  8044a7:	00 00 00 
+  8044aa:	ff d0                	call   *%rax
+}
+  8044ac:	5d                   	pop    %rbp
+  8044ad:	c3                   	ret
+
+00000000008044ae <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8044ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044b3:	c3                   	ret
+
+00000000008044b4 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8044b4:	55                   	push   %rbp
+  8044b5:	48 89 e5             	mov    %rsp,%rbp
+  8044b8:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8044bb:	48 be aa 53 80 00 00 	movabs $0x8053aa,%rsi
+  8044c2:	00 00 00 
+  8044c5:	48 b8 3d 0e 80 00 00 	movabs $0x800e3d,%rax
+  8044cc:	00 00 00 
+  8044cf:	ff d0                	call   *%rax
+    return 0;
+}
+  8044d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044d6:	5d                   	pop    %rbp
+  8044d7:	c3                   	ret
+
+00000000008044d8 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8044d8:	55                   	push   %rbp
+  8044d9:	48 89 e5             	mov    %rsp,%rbp
+  8044dc:	41 57                	push   %r15
+  8044de:	41 56                	push   %r14
+  8044e0:	41 55                	push   %r13
+  8044e2:	41 54                	push   %r12
+  8044e4:	53                   	push   %rbx
+  8044e5:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8044ec:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8044f3:	48 85 d2             	test   %rdx,%rdx
+  8044f6:	74 7a                	je     804572 <devcons_write+0x9a>
+  8044f8:	49 89 d6             	mov    %rdx,%r14
+  8044fb:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804501:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  804506:	49 bf 37 10 80 00 00 	movabs $0x801037,%r15
+  80450d:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804510:	4c 89 f3             	mov    %r14,%rbx
+  804513:	48 29 f3             	sub    %rsi,%rbx
+  804516:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80451b:	48 39 c3             	cmp    %rax,%rbx
+  80451e:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804522:	4c 63 eb             	movslq %ebx,%r13
+  804525:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80452c:	48 01 c6             	add    %rax,%rsi
+  80452f:	4c 89 ea             	mov    %r13,%rdx
+  804532:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804539:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80453c:	4c 89 ee             	mov    %r13,%rsi
+  80453f:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804546:	48 b8 64 12 80 00 00 	movabs $0x801264,%rax
+  80454d:	00 00 00 
+  804550:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804552:	41 01 dc             	add    %ebx,%r12d
+  804555:	49 63 f4             	movslq %r12d,%rsi
+  804558:	4c 39 f6             	cmp    %r14,%rsi
+  80455b:	72 b3                	jb     804510 <devcons_write+0x38>
+    return res;
+  80455d:	49 63 c4             	movslq %r12d,%rax
+}
+  804560:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804567:	5b                   	pop    %rbx
+  804568:	41 5c                	pop    %r12
+  80456a:	41 5d                	pop    %r13
+  80456c:	41 5e                	pop    %r14
+  80456e:	41 5f                	pop    %r15
+  804570:	5d                   	pop    %rbp
+  804571:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804572:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804578:	eb e3                	jmp    80455d <devcons_write+0x85>
+
+000000000080457a <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80457a:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80457d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804582:	48 85 c0             	test   %rax,%rax
+  804585:	74 55                	je     8045dc <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804587:	55                   	push   %rbp
+  804588:	48 89 e5             	mov    %rsp,%rbp
+  80458b:	41 55                	push   %r13
+  80458d:	41 54                	push   %r12
+  80458f:	53                   	push   %rbx
+  804590:	48 83 ec 08          	sub    $0x8,%rsp
+  804594:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  804597:	48 bb 83 12 80 00 00 	movabs $0x801283,%rbx
+  80459e:	00 00 00 
+  8045a1:	49 bc 38 13 80 00 00 	movabs $0x801338,%r12
+  8045a8:	00 00 00 
+  8045ab:	eb 03                	jmp    8045b0 <devcons_read+0x36>
+  8045ad:	41 ff d4             	call   *%r12
+  8045b0:	ff d3                	call   *%rbx
+  8045b2:	85 c0                	test   %eax,%eax
+  8045b4:	74 f7                	je     8045ad <devcons_read+0x33>
+    if (c < 0) return c;
+  8045b6:	48 63 d0             	movslq %eax,%rdx
+  8045b9:	78 13                	js     8045ce <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8045bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8045c0:	83 f8 04             	cmp    $0x4,%eax
+  8045c3:	74 09                	je     8045ce <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8045c5:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8045c9:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8045ce:	48 89 d0             	mov    %rdx,%rax
+  8045d1:	48 83 c4 08          	add    $0x8,%rsp
+  8045d5:	5b                   	pop    %rbx
+  8045d6:	41 5c                	pop    %r12
+  8045d8:	41 5d                	pop    %r13
+  8045da:	5d                   	pop    %rbp
+  8045db:	c3                   	ret
+  8045dc:	48 89 d0             	mov    %rdx,%rax
+  8045df:	c3                   	ret
+
+00000000008045e0 <cputchar>:
+cputchar(int ch) {
+  8045e0:	55                   	push   %rbp
+  8045e1:	48 89 e5             	mov    %rsp,%rbp
+  8045e4:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8045e8:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8045ec:	be 01 00 00 00       	mov    $0x1,%esi
+  8045f1:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8045f5:	48 b8 64 12 80 00 00 	movabs $0x801264,%rax
+  8045fc:	00 00 00 
+  8045ff:	ff d0                	call   *%rax
+}
+  804601:	c9                   	leave
+  804602:	c3                   	ret
+
+0000000000804603 <getchar>:
+getchar(void) {
+  804603:	55                   	push   %rbp
+  804604:	48 89 e5             	mov    %rsp,%rbp
+  804607:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80460b:	ba 01 00 00 00       	mov    $0x1,%edx
+  804610:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  804614:	bf 00 00 00 00       	mov    $0x0,%edi
+  804619:	48 b8 60 1c 80 00 00 	movabs $0x801c60,%rax
+  804620:	00 00 00 
+  804623:	ff d0                	call   *%rax
+  804625:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  804627:	85 c0                	test   %eax,%eax
+  804629:	78 06                	js     804631 <getchar+0x2e>
+  80462b:	74 08                	je     804635 <getchar+0x32>
+  80462d:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804631:	89 d0                	mov    %edx,%eax
+  804633:	c9                   	leave
+  804634:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  804635:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80463a:	eb f5                	jmp    804631 <getchar+0x2e>
+
+000000000080463c <iscons>:
+iscons(int fdnum) {
+  80463c:	55                   	push   %rbp
+  80463d:	48 89 e5             	mov    %rsp,%rbp
+  804640:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804644:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804648:	48 b8 7d 19 80 00 00 	movabs $0x80197d,%rax
+  80464f:	00 00 00 
+  804652:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804654:	85 c0                	test   %eax,%eax
+  804656:	78 18                	js     804670 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  804658:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80465c:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  804663:	00 00 00 
+  804666:	8b 00                	mov    (%rax),%eax
+  804668:	39 02                	cmp    %eax,(%rdx)
+  80466a:	0f 94 c0             	sete   %al
+  80466d:	0f b6 c0             	movzbl %al,%eax
+}
+  804670:	c9                   	leave
+  804671:	c3                   	ret
+
+0000000000804672 <opencons>:
+opencons(void) {
+  804672:	55                   	push   %rbp
+  804673:	48 89 e5             	mov    %rsp,%rbp
+  804676:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80467a:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80467e:	48 b8 1d 19 80 00 00 	movabs $0x80191d,%rax
+  804685:	00 00 00 
+  804688:	ff d0                	call   *%rax
+  80468a:	85 c0                	test   %eax,%eax
+  80468c:	78 49                	js     8046d7 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80468e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804693:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804698:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80469c:	bf 00 00 00 00       	mov    $0x0,%edi
+  8046a1:	48 b8 9c 13 80 00 00 	movabs $0x80139c,%rax
+  8046a8:	00 00 00 
+  8046ab:	ff d0                	call   *%rax
+  8046ad:	85 c0                	test   %eax,%eax
+  8046af:	78 26                	js     8046d7 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8046b1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8046b5:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  8046bc:	00 00 
+  8046be:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8046c0:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8046c4:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8046cb:	48 b8 ef 18 80 00 00 	movabs $0x8018ef,%rax
+  8046d2:	00 00 00 
+  8046d5:	ff d0                	call   *%rax
+}
+  8046d7:	c9                   	leave
+  8046d8:	c3                   	ret
+
+00000000008046d9 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  8046d9:	55                   	push   %rbp
+  8046da:	48 89 e5             	mov    %rsp,%rbp
+  8046dd:	41 56                	push   %r14
+  8046df:	41 55                	push   %r13
+  8046e1:	41 54                	push   %r12
+  8046e3:	53                   	push   %rbx
+  8046e4:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8046e7:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  8046ee:	00 00 00 
+  8046f1:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8046f5:	74 27                	je     80471e <_handle_vectored_pagefault+0x45>
+  8046f7:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  8046fc:	49 bd 00 10 84 00 00 	movabs $0x841000,%r13
+  804703:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804706:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  804709:	4c 89 e7             	mov    %r12,%rdi
+  80470c:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  804711:	84 c0                	test   %al,%al
+  804713:	75 45                	jne    80475a <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804715:	48 83 c3 01          	add    $0x1,%rbx
+  804719:	49 3b 1e             	cmp    (%r14),%rbx
+  80471c:	72 eb                	jb     804709 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  80471e:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  804725:	00 
+  804726:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  80472b:	4d 8b 04 24          	mov    (%r12),%r8
+  80472f:	48 ba b8 53 80 00 00 	movabs $0x8053b8,%rdx
+  804736:	00 00 00 
+  804739:	be 1d 00 00 00       	mov    $0x1d,%esi
+  80473e:	48 bf e8 53 80 00 00 	movabs $0x8053e8,%rdi
+  804745:	00 00 00 
+  804748:	b8 00 00 00 00       	mov    $0x0,%eax
+  80474d:	49 ba c8 03 80 00 00 	movabs $0x8003c8,%r10
+  804754:	00 00 00 
+  804757:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  80475a:	5b                   	pop    %rbx
+  80475b:	41 5c                	pop    %r12
+  80475d:	41 5d                	pop    %r13
+  80475f:	41 5e                	pop    %r14
+  804761:	5d                   	pop    %rbp
+  804762:	c3                   	ret
+
+0000000000804763 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  804763:	55                   	push   %rbp
+  804764:	48 89 e5             	mov    %rsp,%rbp
+  804767:	53                   	push   %rbx
+  804768:	48 83 ec 08          	sub    $0x8,%rsp
+  80476c:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  80476f:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  804776:	00 00 00 
+  804779:	80 38 00             	cmpb   $0x0,(%rax)
+  80477c:	0f 84 84 00 00 00    	je     804806 <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804782:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  804789:	00 00 00 
+  80478c:	48 8b 10             	mov    (%rax),%rdx
+  80478f:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  804794:	48 b9 00 10 84 00 00 	movabs $0x841000,%rcx
+  80479b:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80479e:	48 85 d2             	test   %rdx,%rdx
+  8047a1:	74 19                	je     8047bc <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  8047a3:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  8047a7:	0f 84 e8 00 00 00    	je     804895 <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8047ad:	48 83 c0 01          	add    $0x1,%rax
+  8047b1:	48 39 d0             	cmp    %rdx,%rax
+  8047b4:	75 ed                	jne    8047a3 <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  8047b6:	48 83 fa 08          	cmp    $0x8,%rdx
+  8047ba:	74 1c                	je     8047d8 <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8047bc:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8047c0:	48 a3 48 10 84 00 00 	movabs %rax,0x841048
+  8047c7:	00 00 00 
+  8047ca:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  8047d1:	00 00 00 
+  8047d4:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  8047d8:	48 b8 0f 13 80 00 00 	movabs $0x80130f,%rax
+  8047df:	00 00 00 
+  8047e2:	ff d0                	call   *%rax
+  8047e4:	89 c7                	mov    %eax,%edi
+  8047e6:	48 be 5b 49 80 00 00 	movabs $0x80495b,%rsi
+  8047ed:	00 00 00 
+  8047f0:	48 b8 5a 15 80 00 00 	movabs $0x80155a,%rax
+  8047f7:	00 00 00 
+  8047fa:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8047fc:	85 c0                	test   %eax,%eax
+  8047fe:	78 68                	js     804868 <add_pgfault_handler+0x105>
+    return res;
+}
+  804800:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804804:	c9                   	leave
+  804805:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  804806:	48 b8 0f 13 80 00 00 	movabs $0x80130f,%rax
+  80480d:	00 00 00 
+  804810:	ff d0                	call   *%rax
+  804812:	89 c7                	mov    %eax,%edi
+  804814:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804819:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80481e:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  804825:	00 00 00 
+  804828:	48 b8 9c 13 80 00 00 	movabs $0x80139c,%rax
+  80482f:	00 00 00 
+  804832:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  804834:	48 ba 48 10 84 00 00 	movabs $0x841048,%rdx
+  80483b:	00 00 00 
+  80483e:	48 8b 02             	mov    (%rdx),%rax
+  804841:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804845:	48 89 0a             	mov    %rcx,(%rdx)
+  804848:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  80484f:	00 00 00 
+  804852:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  804856:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  80485d:	00 00 00 
+  804860:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  804863:	e9 70 ff ff ff       	jmp    8047d8 <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  804868:	89 c1                	mov    %eax,%ecx
+  80486a:	48 ba f6 53 80 00 00 	movabs $0x8053f6,%rdx
+  804871:	00 00 00 
+  804874:	be 3d 00 00 00       	mov    $0x3d,%esi
+  804879:	48 bf e8 53 80 00 00 	movabs $0x8053e8,%rdi
+  804880:	00 00 00 
+  804883:	b8 00 00 00 00       	mov    $0x0,%eax
+  804888:	49 b8 c8 03 80 00 00 	movabs $0x8003c8,%r8
+  80488f:	00 00 00 
+  804892:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  804895:	b8 00 00 00 00       	mov    $0x0,%eax
+  80489a:	e9 61 ff ff ff       	jmp    804800 <add_pgfault_handler+0x9d>
+
+000000000080489f <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  80489f:	55                   	push   %rbp
+  8048a0:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  8048a3:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8048aa:	00 00 00 
+  8048ad:	80 38 00             	cmpb   $0x0,(%rax)
+  8048b0:	74 33                	je     8048e5 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8048b2:	48 a1 48 10 84 00 00 	movabs 0x841048,%rax
+  8048b9:	00 00 00 
+  8048bc:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  8048c1:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  8048c8:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8048cb:	48 85 c0             	test   %rax,%rax
+  8048ce:	0f 84 85 00 00 00    	je     804959 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  8048d4:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  8048d8:	74 40                	je     80491a <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8048da:	48 83 c1 01          	add    $0x1,%rcx
+  8048de:	48 39 c1             	cmp    %rax,%rcx
+  8048e1:	75 f1                	jne    8048d4 <remove_pgfault_handler+0x35>
+  8048e3:	eb 74                	jmp    804959 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  8048e5:	48 b9 0e 54 80 00 00 	movabs $0x80540e,%rcx
+  8048ec:	00 00 00 
+  8048ef:	48 ba 47 53 80 00 00 	movabs $0x805347,%rdx
+  8048f6:	00 00 00 
+  8048f9:	be 43 00 00 00       	mov    $0x43,%esi
+  8048fe:	48 bf e8 53 80 00 00 	movabs $0x8053e8,%rdi
+  804905:	00 00 00 
+  804908:	b8 00 00 00 00       	mov    $0x0,%eax
+  80490d:	49 b8 c8 03 80 00 00 	movabs $0x8003c8,%r8
+  804914:	00 00 00 
+  804917:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  80491a:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  804921:	00 
+  804922:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804926:	48 29 ca             	sub    %rcx,%rdx
+  804929:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  804930:	00 00 00 
+  804933:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  804937:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  80493c:	48 89 ce             	mov    %rcx,%rsi
+  80493f:	48 b8 37 10 80 00 00 	movabs $0x801037,%rax
+  804946:	00 00 00 
+  804949:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  80494b:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  804952:	00 00 00 
+  804955:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  804959:	5d                   	pop    %rbp
+  80495a:	c3                   	ret
+
+000000000080495b <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  80495b:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  80495e:	48 b8 d9 46 80 00 00 	movabs $0x8046d9,%rax
+  804965:	00 00 00 
+    call *%rax
+  804968:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  80496a:	41 5f                	pop    %r15
+	popq %r15
+  80496c:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  80496e:	41 5f                	pop    %r15
+	popq %r14
+  804970:	41 5e                	pop    %r14
+	popq %r13
+  804972:	41 5d                	pop    %r13
+	popq %r12
+  804974:	41 5c                	pop    %r12
+	popq %r11
+  804976:	41 5b                	pop    %r11
+	popq %r10
+  804978:	41 5a                	pop    %r10
+	popq %r9
+  80497a:	41 59                	pop    %r9
+	popq %r8
+  80497c:	41 58                	pop    %r8
+	popq %rsi
+  80497e:	5e                   	pop    %rsi
+	popq %rdi
+  80497f:	5f                   	pop    %rdi
+	popq %rbp
+  804980:	5d                   	pop    %rbp
+	popq %rdx
+  804981:	5a                   	pop    %rdx
+	popq %rcx
+  804982:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  804983:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  804988:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  80498d:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  804991:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  804994:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  804999:	5b                   	pop    %rbx
+	popq %rax
+  80499a:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  80499b:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  80499f:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  8049a0:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  8049a5:	c3                   	ret
+
+00000000008049a6 <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8049a6:	55                   	push   %rbp
+  8049a7:	48 89 e5             	mov    %rsp,%rbp
+  8049aa:	41 55                	push   %r13
+  8049ac:	41 54                	push   %r12
+  8049ae:	53                   	push   %rbx
+  8049af:	48 83 ec 08          	sub    $0x8,%rsp
+  8049b3:	49 89 fd             	mov    %rdi,%r13
+  8049b6:	48 89 f7             	mov    %rsi,%rdi
+  8049b9:	48 89 d3             	mov    %rdx,%rbx
+  8049bc:	49 89 cc             	mov    %rcx,%r12
+  8049bf:	4c 89 c2             	mov    %r8,%rdx
+  8049c2:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8049c5:	48 85 f6             	test   %rsi,%rsi
+  8049c8:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8049cf:	00 00 00 
+  8049d2:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  8049d6:	be 00 10 00 00       	mov    $0x1000,%esi
+  8049db:	48 85 db             	test   %rbx,%rbx
+  8049de:	74 03                	je     8049e3 <ipc_recv_futex+0x3d>
+  8049e0:	48 8b 33             	mov    (%rbx),%rsi
+  8049e3:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  8049e7:	48 b8 e6 15 80 00 00 	movabs $0x8015e6,%rax
+  8049ee:	00 00 00 
+  8049f1:	ff d0                	call   *%rax
+    if (res < 0) {
+  8049f3:	85 c0                	test   %eax,%eax
+  8049f5:	78 75                	js     804a6c <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  8049f7:	4d 85 ed             	test   %r13,%r13
+  8049fa:	74 14                	je     804a10 <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  8049fc:	48 a1 00 04 81 00 00 	movabs 0x810400,%rax
+  804a03:	00 00 00 
+  804a06:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  804a0c:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  804a10:	4d 85 e4             	test   %r12,%r12
+  804a13:	74 14                	je     804a29 <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  804a15:	48 a1 00 04 81 00 00 	movabs 0x810400,%rax
+  804a1c:	00 00 00 
+  804a1f:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  804a25:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  804a29:	48 85 db             	test   %rbx,%rbx
+  804a2c:	74 23                	je     804a51 <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804a2e:	48 a1 00 04 81 00 00 	movabs 0x810400,%rax
+  804a35:	00 00 00 
+  804a38:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  804a3e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804a43:	85 c9                	test   %ecx,%ecx
+  804a45:	74 07                	je     804a4e <ipc_recv_futex+0xa8>
+  804a47:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  804a4e:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  804a51:	48 a1 00 04 81 00 00 	movabs 0x810400,%rax
+  804a58:	00 00 00 
+  804a5b:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  804a61:	48 83 c4 08          	add    $0x8,%rsp
+  804a65:	5b                   	pop    %rbx
+  804a66:	41 5c                	pop    %r12
+  804a68:	41 5d                	pop    %r13
+  804a6a:	5d                   	pop    %rbp
+  804a6b:	c3                   	ret
+        if (from_env_store != NULL) {
+  804a6c:	4d 85 ed             	test   %r13,%r13
+  804a6f:	74 08                	je     804a79 <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  804a71:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804a78:	00 
+        if (perm_store != NULL) {
+  804a79:	4d 85 e4             	test   %r12,%r12
+  804a7c:	74 08                	je     804a86 <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  804a7e:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804a85:	00 
+        if (size != NULL) {
+  804a86:	48 85 db             	test   %rbx,%rbx
+  804a89:	74 d6                	je     804a61 <ipc_recv_futex+0xbb>
+            *size = 0;
+  804a8b:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  804a92:	eb cd                	jmp    804a61 <ipc_recv_futex+0xbb>
+
+0000000000804a94 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804a94:	55                   	push   %rbp
+  804a95:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  804a98:	48 83 ec 08          	sub    $0x8,%rsp
+  804a9c:	6a 00                	push   $0x0
+  804a9e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804aa4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804aaa:	48 b8 a6 49 80 00 00 	movabs $0x8049a6,%rax
+  804ab1:	00 00 00 
+  804ab4:	ff d0                	call   *%rax
+}
+  804ab6:	c9                   	leave
+  804ab7:	c3                   	ret
+
+0000000000804ab8 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  804ab8:	55                   	push   %rbp
+  804ab9:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804abc:	48 85 d2             	test   %rdx,%rdx
+  804abf:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804ac6:	00 00 00 
+  804ac9:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  804acd:	89 f6                	mov    %esi,%esi
+  804acf:	48 b8 cf 15 80 00 00 	movabs $0x8015cf,%rax
+  804ad6:	00 00 00 
+  804ad9:	ff d0                	call   *%rax
+    if (res < 0) {
+  804adb:	85 c0                	test   %eax,%eax
+  804add:	78 02                	js     804ae1 <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  804adf:	5d                   	pop    %rbp
+  804ae0:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  804ae1:	89 c1                	mov    %eax,%ecx
+  804ae3:	48 ba 28 54 80 00 00 	movabs $0x805428,%rdx
+  804aea:	00 00 00 
+  804aed:	be 50 00 00 00       	mov    $0x50,%esi
+  804af2:	48 bf 3c 54 80 00 00 	movabs $0x80543c,%rdi
+  804af9:	00 00 00 
+  804afc:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b01:	49 b8 c8 03 80 00 00 	movabs $0x8003c8,%r8
+  804b08:	00 00 00 
+  804b0b:	41 ff d0             	call   *%r8
+
+0000000000804b0e <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804b0e:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  804b13:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804b1a:	00 00 00 
+  804b1d:	48 89 d0             	mov    %rdx,%rax
+  804b20:	48 c1 e0 04          	shl    $0x4,%rax
+  804b24:	48 29 d0             	sub    %rdx,%rax
+  804b27:	48 c1 e0 05          	shl    $0x5,%rax
+  804b2b:	48 01 c8             	add    %rcx,%rax
+  804b2e:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  804b34:	39 f8                	cmp    %edi,%eax
+  804b36:	74 13                	je     804b4b <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  804b38:	48 83 c2 01          	add    $0x1,%rdx
+  804b3c:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  804b43:	75 d8                	jne    804b1d <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804b45:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804b4a:	c3                   	ret
+            return envs[i].env_id;
+  804b4b:	48 89 d0             	mov    %rdx,%rax
+  804b4e:	48 c1 e0 04          	shl    $0x4,%rax
+  804b52:	48 29 d0             	sub    %rdx,%rax
+  804b55:	48 c1 e0 05          	shl    $0x5,%rax
+  804b59:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804b60:	00 00 00 
+  804b63:	48 01 d0             	add    %rdx,%rax
+  804b66:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804b6c:	c3                   	ret
+  804b6d:	0f 1f 00             	nopl   (%rax)
+
+0000000000804b70 <__rodata_start>:
+  804b70:	6d                   	insl   (%dx),%es:(%rdi)
+  804b71:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b72:	74 64                	je     804bd8 <__rodata_start+0x68>
+  804b74:	00 6f 70             	add    %ch,0x70(%rdi)
+  804b77:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804b79:	20 6d 6f             	and    %ch,0x6f(%rbp)
+  804b7c:	74 64                	je     804be2 <__rodata_start+0x72>
+  804b7e:	3a 20                	cmp    (%rax),%ah
+  804b80:	25 69 00 75 73       	and    $0x73750069,%eax
+  804b85:	65 72 2f             	gs jb  804bb7 <__rodata_start+0x47>
+  804b88:	74 65                	je     804bef <__rodata_start+0x7f>
+  804b8a:	73 74                	jae    804c00 <__rodata_start+0x90>
+  804b8c:	66 64 73 68          	data16 fs jae 804bf8 <__rodata_start+0x88>
+  804b90:	61                   	(bad)
+  804b91:	72 69                	jb     804bfc <__rodata_start+0x8c>
+  804b93:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804b94:	67 2e 63 00          	cs movsxd (%eax),%eax
+  804b98:	72 65                	jb     804bff <__rodata_start+0x8f>
+  804b9a:	61                   	(bad)
+  804b9b:	64 6e                	outsb  %fs:(%rsi),(%dx)
+  804b9d:	3a 20                	cmp    (%rax),%ah
+  804b9f:	25 69 00 66 6f       	and    $0x6f660069,%eax
+  804ba4:	72 6b                	jb     804c11 <__rodata_start+0xa1>
+  804ba6:	3a 20                	cmp    (%rax),%ah
+  804ba8:	25 69 00 72 65       	and    $0x65720069,%eax
+  804bad:	61                   	(bad)
+  804bae:	64 20 69 6e          	and    %ch,%fs:0x6e(%rcx)
+  804bb2:	20 63 68             	and    %ah,0x68(%rbx)
+  804bb5:	69 6c 64 20 73 75 63 	imul   $0x63637573,0x20(%rsp,%riz,2),%ebp
+  804bbc:	63 
+  804bbd:	65 65 64 65 64 0a 00 	gs gs fs gs or %fs:(%rax),%al
+  804bc4:	72 65                	jb     804c2b <__rodata_start+0xbb>
+  804bc6:	61                   	(bad)
+  804bc7:	64 20 69 6e          	and    %ch,%fs:0x6e(%rcx)
+  804bcb:	20 70 61             	and    %dh,0x61(%rax)
+  804bce:	72 65                	jb     804c35 <__rodata_start+0xc5>
+  804bd0:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804bd1:	74 20                	je     804bf3 <__rodata_start+0x83>
+  804bd3:	73 75                	jae    804c4a <__rodata_start+0xda>
+  804bd5:	63 63 65             	movsxd 0x65(%rbx),%esp
+  804bd8:	65 64 65 64 0a 00    	gs fs gs or %fs:(%rax),%al
+  804bde:	66 90                	xchg   %ax,%ax
+  804be0:	67 6f                	outsl  %ds:(%esi),(%dx)
+  804be2:	69 6e 67 20 74 6f 20 	imul   $0x206f7420,0x67(%rsi),%ebp
+  804be9:	72 65                	jb     804c50 <__rodata_start+0xe0>
+  804beb:	61                   	(bad)
+  804bec:	64 20 69 6e          	and    %ch,%fs:0x6e(%rcx)
+  804bf0:	20 63 68             	and    %ah,0x68(%rbx)
+  804bf3:	69 6c 64 20 28 6d 69 	imul   $0x67696d28,0x20(%rsp,%riz,2),%ebp
+  804bfa:	67 
+  804bfb:	68 74 20 70 61       	push   $0x61702074
+  804c00:	67 65 20 66 61       	and    %ah,%gs:0x61(%esi)
+  804c05:	75 6c                	jne    804c73 <__rodata_start+0x103>
+  804c07:	74 20                	je     804c29 <__rodata_start+0xb9>
+  804c09:	69 66 20 79 6f 75 72 	imul   $0x72756f79,0x20(%rsi),%esp
+  804c10:	20 73 68             	and    %dh,0x68(%rbx)
+  804c13:	61                   	(bad)
+  804c14:	72 69                	jb     804c7f <__rodata_start+0x10f>
+  804c16:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804c17:	67 20 69 73          	and    %ch,0x73(%ecx)
+  804c1b:	20 62 75             	and    %ah,0x75(%rdx)
+  804c1e:	67 67 79 29          	addr32 addr32 jns 804c4b <__rodata_start+0xdb>
+  804c22:	0a 00                	or     (%rax),%al
+  804c24:	00 00                	add    %al,(%rax)
+  804c26:	00 00                	add    %al,(%rax)
+  804c28:	72 65                	jb     804c8f <__rodata_start+0x11f>
+  804c2a:	61                   	(bad)
+  804c2b:	64 20 69 6e          	and    %ch,%fs:0x6e(%rcx)
+  804c2f:	20 70 61             	and    %dh,0x61(%rax)
+  804c32:	72 65                	jb     804c99 <__rodata_start+0x129>
+  804c34:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804c35:	74 20                	je     804c57 <__rodata_start+0xe7>
+  804c37:	67 6f                	outsl  %ds:(%esi),(%dx)
+  804c39:	74 20                	je     804c5b <__rodata_start+0xeb>
+  804c3b:	25 64 2c 20 72       	and    $0x72202c64,%eax
+  804c40:	65 61                	gs (bad)
+  804c42:	64 20 69 6e          	and    %ch,%fs:0x6e(%rcx)
+  804c46:	20 63 68             	and    %ah,0x68(%rbx)
+  804c49:	69 6c 64 20 67 6f 74 	imul   $0x20746f67,0x20(%rsp,%riz,2),%ebp
+  804c50:	20 
+  804c51:	25 64 00 00 00       	and    $0x64,%eax
+  804c56:	00 00                	add    %al,(%rax)
+  804c58:	72 65                	jb     804cbf <__rodata_start+0x14f>
+  804c5a:	61                   	(bad)
+  804c5b:	64 20 69 6e          	and    %ch,%fs:0x6e(%rcx)
+  804c5f:	20 70 61             	and    %dh,0x61(%rax)
+  804c62:	72 65                	jb     804cc9 <__rodata_start+0x159>
+  804c64:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804c65:	74 20                	je     804c87 <__rodata_start+0x117>
+  804c67:	67 6f                	outsl  %ds:(%esi),(%dx)
+  804c69:	74 20                	je     804c8b <__rodata_start+0x11b>
+  804c6b:	64 69 66 66 65 72 65 	imul   $0x6e657265,%fs:0x66(%rsi),%esp
+  804c72:	6e 
+  804c73:	74 20                	je     804c95 <__rodata_start+0x125>
+  804c75:	62                   	(bad)
+  804c76:	79 74                	jns    804cec <__rodata_start+0x17c>
+  804c78:	65 73 20             	gs jae 804c9b <__rodata_start+0x12b>
+  804c7b:	66 72 6f             	data16 jb 804ced <__rodata_start+0x17d>
+  804c7e:	6d                   	insl   (%dx),%es:(%rdi)
+  804c7f:	20 72 65             	and    %dh,0x65(%rdx)
+  804c82:	61                   	(bad)
+  804c83:	64 20 69 6e          	and    %ch,%fs:0x6e(%rcx)
+  804c87:	20 63 68             	and    %ah,0x68(%rbx)
+  804c8a:	69 6c 64 00 00 00 72 	imul   $0x65720000,0x0(%rsp,%riz,2),%ebp
+  804c91:	65 
+  804c92:	61                   	(bad)
+  804c93:	64 20 69 6e          	and    %ch,%fs:0x6e(%rcx)
+  804c97:	20 70 61             	and    %dh,0x61(%rax)
+  804c9a:	72 65                	jb     804d01 <__rodata_start+0x191>
+  804c9c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804c9d:	74 20                	je     804cbf <__rodata_start+0x14f>
+  804c9f:	67 6f                	outsl  %ds:(%esi),(%dx)
+  804ca1:	74 20                	je     804cc3 <__rodata_start+0x153>
+  804ca3:	25 64 2c 20 74       	and    $0x74202c64,%eax
+  804ca8:	68 65 6e 20 67       	push   $0x67206e65
+  804cad:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804cae:	74 20                	je     804cd0 <__rodata_start+0x160>
+  804cb0:	25 64 00 3c 75       	and    $0x753c0064,%eax
+  804cb5:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804cb6:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  804cba:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804cbb:	3e 00 0f             	ds add %cl,(%rdi)
+  804cbe:	1f                   	(bad)
+  804cbf:	00 5b 25             	add    %bl,0x25(%rbx)
+  804cc2:	30 38                	xor    %bh,(%rax)
+  804cc4:	78 5d                	js     804d23 <__rodata_start+0x1b3>
+  804cc6:	20 75 73             	and    %dh,0x73(%rbp)
+  804cc9:	65 72 20             	gs jb  804cec <__rodata_start+0x17c>
+  804ccc:	70 61                	jo     804d2f <__rodata_start+0x1bf>
+  804cce:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804ccf:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  804cd6:	73 20                	jae    804cf8 <__rodata_start+0x188>
+  804cd8:	61                   	(bad)
+  804cd9:	74 20                	je     804cfb <__rodata_start+0x18b>
+  804cdb:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  804ce0:	3a 20                	cmp    (%rax),%ah
+  804ce2:	00 30                	add    %dh,(%rax)
+  804ce4:	31 32                	xor    %esi,(%rdx)
+  804ce6:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  804ced:	41                   	rex.B
+  804cee:	42                   	rex.X
+  804cef:	43                   	rex.XB
+  804cf0:	44                   	rex.R
+  804cf1:	45                   	rex.RB
+  804cf2:	46 00 30             	rex.RX add %r14b,(%rax)
+  804cf5:	31 32                	xor    %esi,(%rdx)
+  804cf7:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  804cfe:	61                   	(bad)
+  804cff:	62 63 64 65 66       	(bad)
+  804d04:	00 28                	add    %ch,(%rax)
+  804d06:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804d07:	75 6c                	jne    804d75 <__rodata_start+0x205>
+  804d09:	6c                   	insb   (%dx),%es:(%rdi)
+  804d0a:	29 00                	sub    %eax,(%rax)
+  804d0c:	65 72 72             	gs jb  804d81 <__rodata_start+0x211>
+  804d0f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804d10:	72 20                	jb     804d32 <__rodata_start+0x1c2>
+  804d12:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  804d17:	73 70                	jae    804d89 <__rodata_start+0x219>
+  804d19:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  804d1d:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  804d24:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804d25:	72 00                	jb     804d27 <__rodata_start+0x1b7>
+  804d27:	62 61 64 20 65       	(bad)
+  804d2c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804d2d:	76 69                	jbe    804d98 <__rodata_start+0x228>
+  804d2f:	72 6f                	jb     804da0 <__rodata_start+0x230>
+  804d31:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804d32:	6d                   	insl   (%dx),%es:(%rdi)
+  804d33:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804d35:	74 00                	je     804d37 <__rodata_start+0x1c7>
+  804d37:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  804d3e:	20 70 61             	and    %dh,0x61(%rax)
+  804d41:	72 61                	jb     804da4 <__rodata_start+0x234>
+  804d43:	6d                   	insl   (%dx),%es:(%rdi)
+  804d44:	65 74 65             	gs je  804dac <__rodata_start+0x23c>
+  804d47:	72 00                	jb     804d49 <__rodata_start+0x1d9>
+  804d49:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804d4a:	75 74                	jne    804dc0 <__rodata_start+0x250>
+  804d4c:	20 6f 66             	and    %ch,0x66(%rdi)
+  804d4f:	20 6d 65             	and    %ch,0x65(%rbp)
+  804d52:	6d                   	insl   (%dx),%es:(%rdi)
+  804d53:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804d54:	72 79                	jb     804dcf <__rodata_start+0x25f>
+  804d56:	00 6f 75             	add    %ch,0x75(%rdi)
+  804d59:	74 20                	je     804d7b <__rodata_start+0x20b>
+  804d5b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804d5c:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  804d60:	76 69                	jbe    804dcb <__rodata_start+0x25b>
+  804d62:	72 6f                	jb     804dd3 <__rodata_start+0x263>
+  804d64:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804d65:	6d                   	insl   (%dx),%es:(%rdi)
+  804d66:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804d68:	74 73                	je     804ddd <__rodata_start+0x26d>
+  804d6a:	00 63 6f             	add    %ah,0x6f(%rbx)
+  804d6d:	72 72                	jb     804de1 <__rodata_start+0x271>
+  804d6f:	75 70                	jne    804de1 <__rodata_start+0x271>
+  804d71:	74 65                	je     804dd8 <__rodata_start+0x268>
+  804d73:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  804d78:	75 67                	jne    804de1 <__rodata_start+0x271>
+  804d7a:	20 69 6e             	and    %ch,0x6e(%rcx)
+  804d7d:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804d7f:	00 73 65             	add    %dh,0x65(%rbx)
+  804d82:	67 6d                	insl   (%dx),%es:(%edi)
+  804d84:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804d86:	74 61                	je     804de9 <__rodata_start+0x279>
+  804d88:	74 69                	je     804df3 <__rodata_start+0x283>
+  804d8a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804d8b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804d8c:	20 66 61             	and    %ah,0x61(%rsi)
+  804d8f:	75 6c                	jne    804dfd <__rodata_start+0x28d>
+  804d91:	74 00                	je     804d93 <__rodata_start+0x223>
+  804d93:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  804d9a:	20 45 4c             	and    %al,0x4c(%rbp)
+  804d9d:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  804da1:	61                   	(bad)
+  804da2:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  804da7:	20 73 75             	and    %dh,0x75(%rbx)
+  804daa:	63 68 20             	movsxd 0x20(%rax),%ebp
+  804dad:	73 79                	jae    804e28 <__rodata_start+0x2b8>
+  804daf:	73 74                	jae    804e25 <__rodata_start+0x2b5>
+  804db1:	65 6d                	gs insl (%dx),%es:(%rdi)
+  804db3:	20 63 61             	and    %ah,0x61(%rbx)
+  804db6:	6c                   	insb   (%dx),%es:(%rdi)
+  804db7:	6c                   	insb   (%dx),%es:(%rdi)
+  804db8:	00 65 6e             	add    %ah,0x6e(%rbp)
+  804dbb:	74 72                	je     804e2f <__rodata_start+0x2bf>
+  804dbd:	79 20                	jns    804ddf <__rodata_start+0x26f>
+  804dbf:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804dc0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804dc1:	74 20                	je     804de3 <__rodata_start+0x273>
+  804dc3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804dc5:	75 6e                	jne    804e35 <__rodata_start+0x2c5>
+  804dc7:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  804dcb:	76 20                	jbe    804ded <__rodata_start+0x27d>
+  804dcd:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  804dd4:	72 65                	jb     804e3b <__rodata_start+0x2cb>
+  804dd6:	63 76 69             	movsxd 0x69(%rsi),%esi
+  804dd9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804dda:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  804dde:	65 78 70             	gs js  804e51 <__rodata_start+0x2e1>
+  804de1:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  804de6:	20 65 6e             	and    %ah,0x6e(%rbp)
+  804de9:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  804ded:	20 66 69             	and    %ah,0x69(%rsi)
+  804df0:	6c                   	insb   (%dx),%es:(%rdi)
+  804df1:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  804df5:	20 66 72             	and    %ah,0x72(%rsi)
+  804df8:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  804dfd:	61                   	(bad)
+  804dfe:	63 65 20             	movsxd 0x20(%rbp),%esp
+  804e01:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804e02:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804e03:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  804e07:	6b 00 74             	imul   $0x74,(%rax),%eax
+  804e0a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804e0b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804e0c:	20 6d 61             	and    %ch,0x61(%rbp)
+  804e0f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804e10:	79 20                	jns    804e32 <__rodata_start+0x2c2>
+  804e12:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  804e19:	72 65                	jb     804e80 <__rodata_start+0x310>
+  804e1b:	20 6f 70             	and    %ch,0x70(%rdi)
+  804e1e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804e20:	00 66 69             	add    %ah,0x69(%rsi)
+  804e23:	6c                   	insb   (%dx),%es:(%rdi)
+  804e24:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  804e28:	20 62 6c             	and    %ah,0x6c(%rdx)
+  804e2b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804e2c:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  804e2f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804e30:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804e31:	74 20                	je     804e53 <__rodata_start+0x2e3>
+  804e33:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804e35:	75 6e                	jne    804ea5 <__rodata_start+0x335>
+  804e37:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  804e3b:	76 61                	jbe    804e9e <__rodata_start+0x32e>
+  804e3d:	6c                   	insb   (%dx),%es:(%rdi)
+  804e3e:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  804e45:	00 
+  804e46:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  804e4d:	72 65                	jb     804eb4 <__rodata_start+0x344>
+  804e4f:	61                   	(bad)
+  804e50:	64 79 20             	fs jns 804e73 <__rodata_start+0x303>
+  804e53:	65 78 69             	gs js  804ebf <__rodata_start+0x34f>
+  804e56:	73 74                	jae    804ecc <__rodata_start+0x35c>
+  804e58:	73 00                	jae    804e5a <__rodata_start+0x2ea>
+  804e5a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804e5b:	70 65                	jo     804ec2 <__rodata_start+0x352>
+  804e5d:	72 61                	jb     804ec0 <__rodata_start+0x350>
+  804e5f:	74 69                	je     804eca <__rodata_start+0x35a>
+  804e61:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804e62:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804e63:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  804e66:	74 20                	je     804e88 <__rodata_start+0x318>
+  804e68:	73 75                	jae    804edf <__rodata_start+0x36f>
+  804e6a:	70 70                	jo     804edc <__rodata_start+0x36c>
+  804e6c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804e6d:	72 74                	jb     804ee3 <__rodata_start+0x373>
+  804e6f:	65 64 00 74 72 79    	gs add %dh,%fs:0x79(%rdx,%rsi,2)
+  804e75:	20 61 67             	and    %ah,0x67(%rcx)
+  804e78:	61                   	(bad)
+  804e79:	69 6e 00 74 69 6d 65 	imul   $0x656d6974,0x0(%rsi),%ebp
+  804e80:	64 20 6f 75          	and    %ch,%fs:0x75(%rdi)
+  804e84:	74 00                	je     804e86 <__rodata_start+0x316>
+  804e86:	66 69 6c 65 20 69 73 	imul   $0x7369,0x20(%rbp,%riz,2),%bp
+  804e8d:	20 69 6e             	and    %ch,0x6e(%rcx)
+  804e90:	20 75 73             	and    %dh,0x73(%rbp)
+  804e93:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  804e97:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  804e9e:	00 
+  804e9f:	90                   	nop
+  804ea0:	05 07 80 00 00       	add    $0x8007,%eax
+  804ea5:	00 00                	add    %al,(%rax)
+  804ea7:	00 46 0d             	add    %al,0xd(%rsi)
+  804eaa:	80 00 00             	addb   $0x0,(%rax)
+  804ead:	00 00                	add    %al,(%rax)
+  804eaf:	00 36                	add    %dh,(%rsi)
+  804eb1:	0d 80 00 00 00       	or     $0x80,%eax
+  804eb6:	00 00                	add    %al,(%rax)
+  804eb8:	46 0d 80 00 00 00    	rex.RX or $0x80,%eax
+  804ebe:	00 00                	add    %al,(%rax)
+  804ec0:	46 0d 80 00 00 00    	rex.RX or $0x80,%eax
+  804ec6:	00 00                	add    %al,(%rax)
+  804ec8:	46 0d 80 00 00 00    	rex.RX or $0x80,%eax
+  804ece:	00 00                	add    %al,(%rax)
+  804ed0:	46 0d 80 00 00 00    	rex.RX or $0x80,%eax
+  804ed6:	00 00                	add    %al,(%rax)
+  804ed8:	24 07                	and    $0x7,%al
+  804eda:	80 00 00             	addb   $0x0,(%rax)
+  804edd:	00 00                	add    %al,(%rax)
+  804edf:	00 46 0d             	add    %al,0xd(%rsi)
+  804ee2:	80 00 00             	addb   $0x0,(%rax)
+  804ee5:	00 00                	add    %al,(%rax)
+  804ee7:	00 46 0d             	add    %al,0xd(%rsi)
+  804eea:	80 00 00             	addb   $0x0,(%rax)
+  804eed:	00 00                	add    %al,(%rax)
+  804eef:	00 18                	add    %bl,(%rax)
+  804ef1:	07                   	(bad)
+  804ef2:	80 00 00             	addb   $0x0,(%rax)
+  804ef5:	00 00                	add    %al,(%rax)
+  804ef7:	00 92 07 80 00 00    	add    %dl,0x8007(%rdx)
+  804efd:	00 00                	add    %al,(%rax)
+  804eff:	00 46 0d             	add    %al,0xd(%rsi)
+  804f02:	80 00 00             	addb   $0x0,(%rax)
+  804f05:	00 00                	add    %al,(%rax)
+  804f07:	00 18                	add    %bl,(%rax)
+  804f09:	07                   	(bad)
+  804f0a:	80 00 00             	addb   $0x0,(%rax)
+  804f0d:	00 00                	add    %al,(%rax)
+  804f0f:	00 5e 07             	add    %bl,0x7(%rsi)
+  804f12:	80 00 00             	addb   $0x0,(%rax)
+  804f15:	00 00                	add    %al,(%rax)
+  804f17:	00 5e 07             	add    %bl,0x7(%rsi)
+  804f1a:	80 00 00             	addb   $0x0,(%rax)
+  804f1d:	00 00                	add    %al,(%rax)
+  804f1f:	00 5e 07             	add    %bl,0x7(%rsi)
+  804f22:	80 00 00             	addb   $0x0,(%rax)
+  804f25:	00 00                	add    %al,(%rax)
+  804f27:	00 5e 07             	add    %bl,0x7(%rsi)
+  804f2a:	80 00 00             	addb   $0x0,(%rax)
+  804f2d:	00 00                	add    %al,(%rax)
+  804f2f:	00 5e 07             	add    %bl,0x7(%rsi)
+  804f32:	80 00 00             	addb   $0x0,(%rax)
+  804f35:	00 00                	add    %al,(%rax)
+  804f37:	00 5e 07             	add    %bl,0x7(%rsi)
+  804f3a:	80 00 00             	addb   $0x0,(%rax)
+  804f3d:	00 00                	add    %al,(%rax)
+  804f3f:	00 5e 07             	add    %bl,0x7(%rsi)
+  804f42:	80 00 00             	addb   $0x0,(%rax)
+  804f45:	00 00                	add    %al,(%rax)
+  804f47:	00 5e 07             	add    %bl,0x7(%rsi)
+  804f4a:	80 00 00             	addb   $0x0,(%rax)
+  804f4d:	00 00                	add    %al,(%rax)
+  804f4f:	00 5e 07             	add    %bl,0x7(%rsi)
+  804f52:	80 00 00             	addb   $0x0,(%rax)
+  804f55:	00 00                	add    %al,(%rax)
+  804f57:	00 46 0d             	add    %al,0xd(%rsi)
+  804f5a:	80 00 00             	addb   $0x0,(%rax)
+  804f5d:	00 00                	add    %al,(%rax)
+  804f5f:	00 46 0d             	add    %al,0xd(%rsi)
+  804f62:	80 00 00             	addb   $0x0,(%rax)
+  804f65:	00 00                	add    %al,(%rax)
+  804f67:	00 46 0d             	add    %al,0xd(%rsi)
+  804f6a:	80 00 00             	addb   $0x0,(%rax)
+  804f6d:	00 00                	add    %al,(%rax)
+  804f6f:	00 46 0d             	add    %al,0xd(%rsi)
+  804f72:	80 00 00             	addb   $0x0,(%rax)
+  804f75:	00 00                	add    %al,(%rax)
+  804f77:	00 46 0d             	add    %al,0xd(%rsi)
+  804f7a:	80 00 00             	addb   $0x0,(%rax)
+  804f7d:	00 00                	add    %al,(%rax)
+  804f7f:	00 46 0d             	add    %al,0xd(%rsi)
+  804f82:	80 00 00             	addb   $0x0,(%rax)
+  804f85:	00 00                	add    %al,(%rax)
+  804f87:	00 46 0d             	add    %al,0xd(%rsi)
+  804f8a:	80 00 00             	addb   $0x0,(%rax)
+  804f8d:	00 00                	add    %al,(%rax)
+  804f8f:	00 46 0d             	add    %al,0xd(%rsi)
+  804f92:	80 00 00             	addb   $0x0,(%rax)
+  804f95:	00 00                	add    %al,(%rax)
+  804f97:	00 46 0d             	add    %al,0xd(%rsi)
+  804f9a:	80 00 00             	addb   $0x0,(%rax)
+  804f9d:	00 00                	add    %al,(%rax)
+  804f9f:	00 46 0d             	add    %al,0xd(%rsi)
+  804fa2:	80 00 00             	addb   $0x0,(%rax)
+  804fa5:	00 00                	add    %al,(%rax)
+  804fa7:	00 46 0d             	add    %al,0xd(%rsi)
+  804faa:	80 00 00             	addb   $0x0,(%rax)
+  804fad:	00 00                	add    %al,(%rax)
+  804faf:	00 46 0d             	add    %al,0xd(%rsi)
+  804fb2:	80 00 00             	addb   $0x0,(%rax)
+  804fb5:	00 00                	add    %al,(%rax)
+  804fb7:	00 46 0d             	add    %al,0xd(%rsi)
+  804fba:	80 00 00             	addb   $0x0,(%rax)
+  804fbd:	00 00                	add    %al,(%rax)
+  804fbf:	00 46 0d             	add    %al,0xd(%rsi)
+  804fc2:	80 00 00             	addb   $0x0,(%rax)
+  804fc5:	00 00                	add    %al,(%rax)
+  804fc7:	00 46 0d             	add    %al,0xd(%rsi)
+  804fca:	80 00 00             	addb   $0x0,(%rax)
+  804fcd:	00 00                	add    %al,(%rax)
+  804fcf:	00 46 0d             	add    %al,0xd(%rsi)
+  804fd2:	80 00 00             	addb   $0x0,(%rax)
+  804fd5:	00 00                	add    %al,(%rax)
+  804fd7:	00 46 0d             	add    %al,0xd(%rsi)
+  804fda:	80 00 00             	addb   $0x0,(%rax)
+  804fdd:	00 00                	add    %al,(%rax)
+  804fdf:	00 46 0d             	add    %al,0xd(%rsi)
+  804fe2:	80 00 00             	addb   $0x0,(%rax)
+  804fe5:	00 00                	add    %al,(%rax)
+  804fe7:	00 46 0d             	add    %al,0xd(%rsi)
+  804fea:	80 00 00             	addb   $0x0,(%rax)
+  804fed:	00 00                	add    %al,(%rax)
+  804fef:	00 46 0d             	add    %al,0xd(%rsi)
+  804ff2:	80 00 00             	addb   $0x0,(%rax)
+  804ff5:	00 00                	add    %al,(%rax)
+  804ff7:	00 46 0d             	add    %al,0xd(%rsi)
+  804ffa:	80 00 00             	addb   $0x0,(%rax)
+  804ffd:	00 00                	add    %al,(%rax)
+  804fff:	00 46 0d             	add    %al,0xd(%rsi)
+  805002:	80 00 00             	addb   $0x0,(%rax)
+  805005:	00 00                	add    %al,(%rax)
+  805007:	00 46 0d             	add    %al,0xd(%rsi)
+  80500a:	80 00 00             	addb   $0x0,(%rax)
+  80500d:	00 00                	add    %al,(%rax)
+  80500f:	00 46 0d             	add    %al,0xd(%rsi)
+  805012:	80 00 00             	addb   $0x0,(%rax)
+  805015:	00 00                	add    %al,(%rax)
+  805017:	00 46 0d             	add    %al,0xd(%rsi)
+  80501a:	80 00 00             	addb   $0x0,(%rax)
+  80501d:	00 00                	add    %al,(%rax)
+  80501f:	00 46 0d             	add    %al,0xd(%rsi)
+  805022:	80 00 00             	addb   $0x0,(%rax)
+  805025:	00 00                	add    %al,(%rax)
+  805027:	00 46 0d             	add    %al,0xd(%rsi)
+  80502a:	80 00 00             	addb   $0x0,(%rax)
+  80502d:	00 00                	add    %al,(%rax)
+  80502f:	00 46 0d             	add    %al,0xd(%rsi)
+  805032:	80 00 00             	addb   $0x0,(%rax)
+  805035:	00 00                	add    %al,(%rax)
+  805037:	00 46 0d             	add    %al,0xd(%rsi)
+  80503a:	80 00 00             	addb   $0x0,(%rax)
+  80503d:	00 00                	add    %al,(%rax)
+  80503f:	00 46 0d             	add    %al,0xd(%rsi)
+  805042:	80 00 00             	addb   $0x0,(%rax)
+  805045:	00 00                	add    %al,(%rax)
+  805047:	00 69 0c             	add    %ch,0xc(%rcx)
+  80504a:	80 00 00             	addb   $0x0,(%rax)
+  80504d:	00 00                	add    %al,(%rax)
+  80504f:	00 46 0d             	add    %al,0xd(%rsi)
+  805052:	80 00 00             	addb   $0x0,(%rax)
+  805055:	00 00                	add    %al,(%rax)
+  805057:	00 46 0d             	add    %al,0xd(%rsi)
+  80505a:	80 00 00             	addb   $0x0,(%rax)
+  80505d:	00 00                	add    %al,(%rax)
+  80505f:	00 46 0d             	add    %al,0xd(%rsi)
+  805062:	80 00 00             	addb   $0x0,(%rax)
+  805065:	00 00                	add    %al,(%rax)
+  805067:	00 46 0d             	add    %al,0xd(%rsi)
+  80506a:	80 00 00             	addb   $0x0,(%rax)
+  80506d:	00 00                	add    %al,(%rax)
+  80506f:	00 46 0d             	add    %al,0xd(%rsi)
+  805072:	80 00 00             	addb   $0x0,(%rax)
+  805075:	00 00                	add    %al,(%rax)
+  805077:	00 46 0d             	add    %al,0xd(%rsi)
+  80507a:	80 00 00             	addb   $0x0,(%rax)
+  80507d:	00 00                	add    %al,(%rax)
+  80507f:	00 46 0d             	add    %al,0xd(%rsi)
+  805082:	80 00 00             	addb   $0x0,(%rax)
+  805085:	00 00                	add    %al,(%rax)
+  805087:	00 46 0d             	add    %al,0xd(%rsi)
+  80508a:	80 00 00             	addb   $0x0,(%rax)
+  80508d:	00 00                	add    %al,(%rax)
+  80508f:	00 46 0d             	add    %al,0xd(%rsi)
+  805092:	80 00 00             	addb   $0x0,(%rax)
+  805095:	00 00                	add    %al,(%rax)
+  805097:	00 46 0d             	add    %al,0xd(%rsi)
+  80509a:	80 00 00             	addb   $0x0,(%rax)
+  80509d:	00 00                	add    %al,(%rax)
+  80509f:	00 b5 07 80 00 00    	add    %dh,0x8007(%rbp)
+  8050a5:	00 00                	add    %al,(%rax)
+  8050a7:	00 84 09 80 00 00 00 	add    %al,0x80(%rcx,%rcx,1)
+  8050ae:	00 00                	add    %al,(%rax)
+  8050b0:	46 0d 80 00 00 00    	rex.RX or $0x80,%eax
+  8050b6:	00 00                	add    %al,(%rax)
+  8050b8:	46 0d 80 00 00 00    	rex.RX or $0x80,%eax
+  8050be:	00 00                	add    %al,(%rax)
+  8050c0:	46 0d 80 00 00 00    	rex.RX or $0x80,%eax
+  8050c6:	00 00                	add    %al,(%rax)
+  8050c8:	46 0d 80 00 00 00    	rex.RX or $0x80,%eax
+  8050ce:	00 00                	add    %al,(%rax)
+  8050d0:	e4 07                	in     $0x7,%al
+  8050d2:	80 00 00             	addb   $0x0,(%rax)
+  8050d5:	00 00                	add    %al,(%rax)
+  8050d7:	00 46 0d             	add    %al,0xd(%rsi)
+  8050da:	80 00 00             	addb   $0x0,(%rax)
+  8050dd:	00 00                	add    %al,(%rax)
+  8050df:	00 46 0d             	add    %al,0xd(%rsi)
+  8050e2:	80 00 00             	addb   $0x0,(%rax)
+  8050e5:	00 00                	add    %al,(%rax)
+  8050e7:	00 aa 07 80 00 00    	add    %ch,0x8007(%rdx)
+  8050ed:	00 00                	add    %al,(%rax)
+  8050ef:	00 46 0d             	add    %al,0xd(%rsi)
+  8050f2:	80 00 00             	addb   $0x0,(%rax)
+  8050f5:	00 00                	add    %al,(%rax)
+  8050f7:	00 46 0d             	add    %al,0xd(%rsi)
+  8050fa:	80 00 00             	addb   $0x0,(%rax)
+  8050fd:	00 00                	add    %al,(%rax)
+  8050ff:	00 2c 0b             	add    %ch,(%rbx,%rcx,1)
+  805102:	80 00 00             	addb   $0x0,(%rax)
+  805105:	00 00                	add    %al,(%rax)
+  805107:	00 f6                	add    %dh,%dh
+  805109:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80510f:	00 46 0d             	add    %al,0xd(%rsi)
+  805112:	80 00 00             	addb   $0x0,(%rax)
+  805115:	00 00                	add    %al,(%rax)
+  805117:	00 46 0d             	add    %al,0xd(%rsi)
+  80511a:	80 00 00             	addb   $0x0,(%rax)
+  80511d:	00 00                	add    %al,(%rax)
+  80511f:	00 7b 08             	add    %bh,0x8(%rbx)
+  805122:	80 00 00             	addb   $0x0,(%rax)
+  805125:	00 00                	add    %al,(%rax)
+  805127:	00 46 0d             	add    %al,0xd(%rsi)
+  80512a:	80 00 00             	addb   $0x0,(%rax)
+  80512d:	00 00                	add    %al,(%rax)
+  80512f:	00 58 0a             	add    %bl,0xa(%rax)
+  805132:	80 00 00             	addb   $0x0,(%rax)
+  805135:	00 00                	add    %al,(%rax)
+  805137:	00 46 0d             	add    %al,0xd(%rsi)
+  80513a:	80 00 00             	addb   $0x0,(%rax)
+  80513d:	00 00                	add    %al,(%rax)
+  80513f:	00 46 0d             	add    %al,0xd(%rsi)
+  805142:	80 00 00             	addb   $0x0,(%rax)
+  805145:	00 00                	add    %al,(%rax)
+  805147:	00 69 0c             	add    %ch,0xc(%rcx)
+  80514a:	80 00 00             	addb   $0x0,(%rax)
+  80514d:	00 00                	add    %al,(%rax)
+  80514f:	00 46 0d             	add    %al,0xd(%rsi)
+  805152:	80 00 00             	addb   $0x0,(%rax)
+  805155:	00 00                	add    %al,(%rax)
+  805157:	00 0e                	add    %cl,(%rsi)
+  805159:	07                   	(bad)
+  80515a:	80 00 00             	addb   $0x0,(%rax)
+  80515d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000805160 <error_string>:
+	...
+  805168:	15 4d 80 00 00 00 00 00 27 4d 80 00 00 00 00 00     .M......'M......
+  805178:	37 4d 80 00 00 00 00 00 49 4d 80 00 00 00 00 00     7M......IM......
+  805188:	57 4d 80 00 00 00 00 00 6b 4d 80 00 00 00 00 00     WM......kM......
+  805198:	80 4d 80 00 00 00 00 00 93 4d 80 00 00 00 00 00     .M.......M......
+  8051a8:	a5 4d 80 00 00 00 00 00 b9 4d 80 00 00 00 00 00     .M.......M......
+  8051b8:	c9 4d 80 00 00 00 00 00 dc 4d 80 00 00 00 00 00     .M.......M......
+  8051c8:	f3 4d 80 00 00 00 00 00 09 4e 80 00 00 00 00 00     .M.......N......
+  8051d8:	21 4e 80 00 00 00 00 00 39 4e 80 00 00 00 00 00     !N......9N......
+  8051e8:	46 4e 80 00 00 00 00 00 18 52 80 00 00 00 00 00     FN.......R......
+  8051f8:	5a 4e 80 00 00 00 00 00 72 4e 80 00 00 00 00 00     ZN......rN......
+  805208:	7c 4e 80 00 00 00 00 00 86 4e 80 00 00 00 00 00     |N.......N......
+  805218:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  805228:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  805238:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  805248:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  805258:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 73 66 6f     ib/syscall.c.sfo
+  805268:	72 6b 28 29 20 69 73 20 6e 6f 74 20 69 6d 70 6c     rk() is not impl
+  805278:	65 6d 65 6e 74 65 64 00 6c 69 62 2f 66 6f 72 6b     emented.lib/fork
+  805288:	2e 63 00 0f 1f 44 00 00 5b 25 30 38 78 5d 20 75     .c...D..[%08x] u
+  805298:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  8052a8:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  8052b8:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  8052c8:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  8052d8:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  8052e8:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  8052f8:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  805308:	0a 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805318:	84 00 00 00 00 00 66 90                             ......f.
+
+0000000000805320 <devtab>:
+  805320:	20 60 80 00 00 00 00 00 60 60 80 00 00 00 00 00      `......``......
+  805330:	a0 60 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .`..............
+  805340:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  805350:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  805360:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  805370:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  805380:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  805390:	3d 20 32 00 65 6e 76 69 64 20 21 3d 20 30 00 6c     = 2.envid != 0.l
+  8053a0:	69 62 2f 77 61 69 74 2e 63 00 3c 63 6f 6e 73 3e     ib/wait.c.<cons>
+  8053b0:	00 63 6f 6e 73 00 66 90 55 73 65 72 73 70 61 63     .cons.f.Userspac
+  8053c0:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  8053d0:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  8053e0:	65 72 72 3d 25 78 0a 00 6c 69 62 2f 70 67 66 61     err=%x..lib/pgfa
+  8053f0:	75 6c 74 2e 63 00 73 65 74 5f 70 67 66 61 75 6c     ult.c.set_pgfaul
+  805400:	74 5f 68 61 6e 64 6c 65 72 3a 20 25 69 00 5f 70     t_handler: %i._p
+  805410:	66 68 61 6e 64 6c 65 72 5f 69 6e 69 74 69 74 69     fhandler_inititi
+  805420:	61 6c 6c 69 7a 65 64 00 69 70 63 5f 73 65 6e 64     allized.ipc_send
+  805430:	20 65 72 72 6f 72 3a 20 25 69 0a 00 6c 69 62 2f      error: %i..lib/
+  805440:	69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00 00     ipc.c.f.........
+  805450:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805460:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805470:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805480:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805490:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8054a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8054b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8054c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8054d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8054e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8054f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805500:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805510:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805520:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805530:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805540:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805550:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805560:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805570:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805580:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805590:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8055a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8055b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8055c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8055d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8055e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8055f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805600:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805610:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805620:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805630:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805640:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805650:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805660:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805670:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805680:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805690:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8056a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8056b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8056c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8056d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8056e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8056f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805700:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805710:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805720:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805730:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805740:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805750:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805760:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805770:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805780:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805790:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8057a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8057b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8057c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8057d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8057e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8057f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805800:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805810:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805820:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805830:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805840:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805850:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805860:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805870:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805880:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805890:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8058a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8058b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8058c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8058d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8058e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8058f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805900:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805910:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805920:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805930:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805940:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805950:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805960:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805970:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805980:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805990:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8059a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8059b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8059c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8059d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8059e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8059f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805aa0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ab0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ac0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ad0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ae0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805af0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ba0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805bb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805bc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805bd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805be0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805bf0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ca0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805cb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805cc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805cd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ce0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805cf0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805da0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805db0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805dc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805dd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805de0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805df0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ea0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805eb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ec0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ed0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ee0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ef0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805fa0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805fb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805fc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805fd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805fe0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ff0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 90     ....f.........f.
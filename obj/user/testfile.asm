@@ -0,0 +1,9826 @@
+
+obj/user/testfile:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 d4 0d 00 00       	call   800df7 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <xopen>:
+    if ((r = readn(f, blk, sizeof(blk))) != 0)
+        panic("read %s past %ld blocks returned %ld", path, (long)nblocks, (long)r);
+}
+
+static int
+xopen(const char *path, int mode) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 54                	push   %r12
+  80002b:	53                   	push   %rbx
+  80002c:	48 83 ec 10          	sub    $0x10,%rsp
+  800030:	41 89 f4             	mov    %esi,%r12d
+    extern union Fsipc fsipcbuf;
+    envid_t fsenv;
+
+    strcpy(fsipcbuf.open.req_path, path);
+  800033:	48 89 fe             	mov    %rdi,%rsi
+  800036:	48 bb 00 00 83 00 00 	movabs $0x830000,%rbx
+  80003d:	00 00 00 
+  800040:	48 89 df             	mov    %rbx,%rdi
+  800043:	48 b8 42 19 80 00 00 	movabs $0x801942,%rax
+  80004a:	00 00 00 
+  80004d:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  80004f:	44 89 a3 00 04 00 00 	mov    %r12d,0x400(%rbx)
+
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  800056:	bf 03 00 00 00       	mov    $0x3,%edi
+  80005b:	48 b8 3c 24 80 00 00 	movabs $0x80243c,%rax
+  800062:	00 00 00 
+  800065:	ff d0                	call   *%rax
+  800067:	89 c7                	mov    %eax,%edi
+    size_t sz = PAGE_SIZE;
+  800069:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  800070:	00 
+    ipc_send(fsenv, FSREQ_OPEN, &fsipcbuf, sz, PROT_RW);
+  800071:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  800077:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80007c:	48 89 da             	mov    %rbx,%rdx
+  80007f:	be 01 00 00 00       	mov    $0x1,%esi
+  800084:	48 b8 e6 23 80 00 00 	movabs $0x8023e6,%rax
+  80008b:	00 00 00 
+  80008e:	ff d0                	call   *%rax
+    return ipc_recv(NULL, FVA, &sz, NULL);
+  800090:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800095:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  800099:	be 00 00 00 0a       	mov    $0xa000000,%esi
+  80009e:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000a3:	48 b8 c2 23 80 00 00 	movabs $0x8023c2,%rax
+  8000aa:	00 00 00 
+  8000ad:	ff d0                	call   *%rax
+}
+  8000af:	48 83 c4 10          	add    $0x10,%rsp
+  8000b3:	5b                   	pop    %rbx
+  8000b4:	41 5c                	pop    %r12
+  8000b6:	5d                   	pop    %rbp
+  8000b7:	c3                   	ret
+
+00000000008000b8 <big_write>:
+big_write(int f, const char *path, int64_t i, int tag) {
+  8000b8:	55                   	push   %rbp
+  8000b9:	48 89 e5             	mov    %rsp,%rbp
+  8000bc:	41 56                	push   %r14
+  8000be:	41 55                	push   %r13
+  8000c0:	41 54                	push   %r12
+  8000c2:	53                   	push   %rbx
+  8000c3:	41 89 fc             	mov    %edi,%r12d
+  8000c6:	49 89 f5             	mov    %rsi,%r13
+  8000c9:	48 89 d3             	mov    %rdx,%rbx
+  8000cc:	89 ce                	mov    %ecx,%esi
+    memset(blk, tag, sizeof(blk));
+  8000ce:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8000d3:	49 be 00 00 81 00 00 	movabs $0x810000,%r14
+  8000da:	00 00 00 
+  8000dd:	4c 89 f7             	mov    %r14,%rdi
+  8000e0:	48 b8 8e 1a 80 00 00 	movabs $0x801a8e,%rax
+  8000e7:	00 00 00 
+  8000ea:	ff d0                	call   *%rax
+    *(int64_t *)blk = i;
+  8000ec:	49 89 1e             	mov    %rbx,(%r14)
+    if ((r = write(f, blk, sizeof(blk))) != sizeof(blk))
+  8000ef:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8000f4:	4c 89 f6             	mov    %r14,%rsi
+  8000f7:	44 89 e7             	mov    %r12d,%edi
+  8000fa:	48 b8 3b 29 80 00 00 	movabs $0x80293b,%rax
+  800101:	00 00 00 
+  800104:	ff d0                	call   *%rax
+  800106:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  80010c:	75 09                	jne    800117 <big_write+0x5f>
+}
+  80010e:	5b                   	pop    %rbx
+  80010f:	41 5c                	pop    %r12
+  800111:	41 5d                	pop    %r13
+  800113:	41 5e                	pop    %r14
+  800115:	5d                   	pop    %rbp
+  800116:	c3                   	ret
+        panic("write %s@%ld: %ld", path, (long)(i * BLKSIZE), (long)r);
+  800117:	49 89 c1             	mov    %rax,%r9
+  80011a:	48 c1 e3 0c          	shl    $0xc,%rbx
+  80011e:	49 89 d8             	mov    %rbx,%r8
+  800121:	4c 89 e9             	mov    %r13,%rcx
+  800124:	48 ba 58 54 80 00 00 	movabs $0x805458,%rdx
+  80012b:	00 00 00 
+  80012e:	be 14 00 00 00       	mov    $0x14,%esi
+  800133:	48 bf 6a 54 80 00 00 	movabs $0x80546a,%rdi
+  80013a:	00 00 00 
+  80013d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800142:	49 ba cd 0e 80 00 00 	movabs $0x800ecd,%r10
+  800149:	00 00 00 
+  80014c:	41 ff d2             	call   *%r10
+
+000000000080014f <big_check>:
+big_check(int f, const char *path, int64_t nblocks, int tag) {
+  80014f:	55                   	push   %rbp
+  800150:	48 89 e5             	mov    %rsp,%rbp
+  800153:	41 57                	push   %r15
+  800155:	41 56                	push   %r14
+  800157:	41 55                	push   %r13
+  800159:	41 54                	push   %r12
+  80015b:	53                   	push   %rbx
+  80015c:	48 83 ec 18          	sub    $0x18,%rsp
+  800160:	41 89 fd             	mov    %edi,%r13d
+  800163:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  800167:	48 89 d3             	mov    %rdx,%rbx
+  80016a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80016e:	41 89 ce             	mov    %ecx,%r14d
+    seek(f, 0);
+  800171:	be 00 00 00 00       	mov    $0x0,%esi
+  800176:	48 b8 f4 29 80 00 00 	movabs $0x8029f4,%rax
+  80017d:	00 00 00 
+  800180:	ff d0                	call   *%rax
+    for (int64_t i = 0; i < nblocks; i++) {
+  800182:	48 85 db             	test   %rbx,%rbx
+  800185:	7e 61                	jle    8001e8 <big_check+0x99>
+  800187:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if ((r = readn(f, blk, sizeof(blk))) < 0)
+  80018c:	49 bc 00 00 81 00 00 	movabs $0x810000,%r12
+  800193:	00 00 00 
+  800196:	49 bf ca 28 80 00 00 	movabs $0x8028ca,%r15
+  80019d:	00 00 00 
+  8001a0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8001a5:	4c 89 e6             	mov    %r12,%rsi
+  8001a8:	44 89 ef             	mov    %r13d,%edi
+  8001ab:	41 ff d7             	call   *%r15
+  8001ae:	48 85 c0             	test   %rax,%rax
+  8001b1:	78 6b                	js     80021e <big_check+0xcf>
+        if (r != sizeof(blk))
+  8001b3:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  8001b9:	0f 85 98 00 00 00    	jne    800257 <big_check+0x108>
+        if (*(int64_t *)blk != i || blk[sizeof(blk) - 1] != tag)
+  8001bf:	4d 8b 0c 24          	mov    (%r12),%r9
+  8001c3:	49 39 d9             	cmp    %rbx,%r9
+  8001c6:	0f 85 d0 00 00 00    	jne    80029c <big_check+0x14d>
+  8001cc:	41 0f be 84 24 ff 0f 	movsbl 0xfff(%r12),%eax
+  8001d3:	00 00 
+  8001d5:	44 39 f0             	cmp    %r14d,%eax
+  8001d8:	0f 85 bb 00 00 00    	jne    800299 <big_check+0x14a>
+    for (int64_t i = 0; i < nblocks; i++) {
+  8001de:	48 83 c3 01          	add    $0x1,%rbx
+  8001e2:	48 39 5d c8          	cmp    %rbx,-0x38(%rbp)
+  8001e6:	75 b8                	jne    8001a0 <big_check+0x51>
+    if ((r = readn(f, blk, sizeof(blk))) != 0)
+  8001e8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8001ed:	48 be 00 00 81 00 00 	movabs $0x810000,%rsi
+  8001f4:	00 00 00 
+  8001f7:	44 89 ef             	mov    %r13d,%edi
+  8001fa:	48 b8 ca 28 80 00 00 	movabs $0x8028ca,%rax
+  800201:	00 00 00 
+  800204:	ff d0                	call   *%rax
+  800206:	48 85 c0             	test   %rax,%rax
+  800209:	0f 85 d9 00 00 00    	jne    8002e8 <big_check+0x199>
+}
+  80020f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800213:	5b                   	pop    %rbx
+  800214:	41 5c                	pop    %r12
+  800216:	41 5d                	pop    %r13
+  800218:	41 5e                	pop    %r14
+  80021a:	41 5f                	pop    %r15
+  80021c:	5d                   	pop    %rbp
+  80021d:	c3                   	ret
+            panic("read %s@%ld: %ld", path, (long)(i * BLKSIZE), (long)r);
+  80021e:	49 89 c1             	mov    %rax,%r9
+  800221:	48 c1 e3 0c          	shl    $0xc,%rbx
+  800225:	49 89 d8             	mov    %rbx,%r8
+  800228:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80022c:	48 ba 7a 54 80 00 00 	movabs $0x80547a,%rdx
+  800233:	00 00 00 
+  800236:	be 1f 00 00 00       	mov    $0x1f,%esi
+  80023b:	48 bf 6a 54 80 00 00 	movabs $0x80546a,%rdi
+  800242:	00 00 00 
+  800245:	b8 00 00 00 00       	mov    $0x0,%eax
+  80024a:	49 ba cd 0e 80 00 00 	movabs $0x800ecd,%r10
+  800251:	00 00 00 
+  800254:	41 ff d2             	call   *%r10
+            panic("read %s from %ld returned %ld < %d bytes",
+  800257:	48 83 ec 08          	sub    $0x8,%rsp
+  80025b:	68 00 10 00 00       	push   $0x1000
+  800260:	49 89 c1             	mov    %rax,%r9
+  800263:	48 c1 e3 0c          	shl    $0xc,%rbx
+  800267:	49 89 d8             	mov    %rbx,%r8
+  80026a:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80026e:	48 ba 68 56 80 00 00 	movabs $0x805668,%rdx
+  800275:	00 00 00 
+  800278:	be 21 00 00 00       	mov    $0x21,%esi
+  80027d:	48 bf 6a 54 80 00 00 	movabs $0x80546a,%rdi
+  800284:	00 00 00 
+  800287:	b8 00 00 00 00       	mov    $0x0,%eax
+  80028c:	49 ba cd 0e 80 00 00 	movabs $0x800ecd,%r10
+  800293:	00 00 00 
+  800296:	41 ff d2             	call   *%r10
+        if (*(int64_t *)blk != i || blk[sizeof(blk) - 1] != tag)
+  800299:	49 89 d9             	mov    %rbx,%r9
+            panic("read %s from %ld returned bad data %ld/%d",
+  80029c:	48 83 ec 08          	sub    $0x8,%rsp
+  8002a0:	48 b8 00 00 81 00 00 	movabs $0x810000,%rax
+  8002a7:	00 00 00 
+  8002aa:	0f be 80 ff 0f 00 00 	movsbl 0xfff(%rax),%eax
+  8002b1:	50                   	push   %rax
+  8002b2:	48 c1 e3 0c          	shl    $0xc,%rbx
+  8002b6:	49 89 d8             	mov    %rbx,%r8
+  8002b9:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8002bd:	48 ba 98 56 80 00 00 	movabs $0x805698,%rdx
+  8002c4:	00 00 00 
+  8002c7:	be 24 00 00 00       	mov    $0x24,%esi
+  8002cc:	48 bf 6a 54 80 00 00 	movabs $0x80546a,%rdi
+  8002d3:	00 00 00 
+  8002d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002db:	49 ba cd 0e 80 00 00 	movabs $0x800ecd,%r10
+  8002e2:	00 00 00 
+  8002e5:	41 ff d2             	call   *%r10
+        panic("read %s past %ld blocks returned %ld", path, (long)nblocks, (long)r);
+  8002e8:	49 89 c1             	mov    %rax,%r9
+  8002eb:	4c 8b 45 c8          	mov    -0x38(%rbp),%r8
+  8002ef:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8002f3:	48 ba c8 56 80 00 00 	movabs $0x8056c8,%rdx
+  8002fa:	00 00 00 
+  8002fd:	be 28 00 00 00       	mov    $0x28,%esi
+  800302:	48 bf 6a 54 80 00 00 	movabs $0x80546a,%rdi
+  800309:	00 00 00 
+  80030c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800311:	49 ba cd 0e 80 00 00 	movabs $0x800ecd,%r10
+  800318:	00 00 00 
+  80031b:	41 ff d2             	call   *%r10
+
+000000000080031e <umain>:
+
+void
+umain(int argc, char **argv) {
+  80031e:	55                   	push   %rbp
+  80031f:	48 89 e5             	mov    %rsp,%rbp
+  800322:	41 57                	push   %r15
+  800324:	41 56                	push   %r14
+  800326:	41 55                	push   %r13
+  800328:	41 54                	push   %r12
+  80032a:	53                   	push   %rbx
+  80032b:	48 81 ec b8 02 00 00 	sub    $0x2b8,%rsp
+    struct Fd fdcopy;
+    struct Stat st;
+    char buf[512];
+
+    /* We open files manually first, to avoid the FD layer */
+    if ((r = xopen("/not-found", O_RDONLY)) < 0 && r != -E_NOT_FOUND)
+  800332:	be 00 00 00 00       	mov    $0x0,%esi
+  800337:	48 bf 8b 54 80 00 00 	movabs $0x80548b,%rdi
+  80033e:	00 00 00 
+  800341:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800348:	00 00 00 
+  80034b:	ff d0                	call   *%rax
+  80034d:	48 63 c8             	movslq %eax,%rcx
+  800350:	48 85 c9             	test   %rcx,%rcx
+  800353:	0f 89 6a 06 00 00    	jns    8009c3 <umain+0x6a5>
+  800359:	48 83 f9 f1          	cmp    $0xfffffffffffffff1,%rcx
+  80035d:	0f 85 35 06 00 00    	jne    800998 <umain+0x67a>
+        panic("serve_open /not-found: %ld", (long)r);
+    else if (r >= 0)
+        panic("serve_open /not-found succeeded!");
+
+    if ((r = xopen("/newmotd", O_RDONLY)) < 0)
+  800363:	be 00 00 00 00       	mov    $0x0,%esi
+  800368:	48 bf b1 54 80 00 00 	movabs $0x8054b1,%rdi
+  80036f:	00 00 00 
+  800372:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800379:	00 00 00 
+  80037c:	ff d0                	call   *%rax
+  80037e:	48 63 c8             	movslq %eax,%rcx
+  800381:	48 85 c9             	test   %rcx,%rcx
+  800384:	0f 88 63 06 00 00    	js     8009ed <umain+0x6cf>
+        panic("serve_open /newmotd: %ld", (long)r);
+    if (FVA->fd_dev_id != 'f' || FVA->fd_offset != 0 || FVA->fd_omode != O_RDONLY)
+  80038a:	83 3c 25 00 00 00 0a 	cmpl   $0x66,0xa000000
+  800391:	66 
+  800392:	0f 85 80 06 00 00    	jne    800a18 <umain+0x6fa>
+  800398:	83 3c 25 04 00 00 0a 	cmpl   $0x0,0xa000004
+  80039f:	00 
+  8003a0:	0f 85 72 06 00 00    	jne    800a18 <umain+0x6fa>
+  8003a6:	83 3c 25 08 00 00 0a 	cmpl   $0x0,0xa000008
+  8003ad:	00 
+  8003ae:	0f 85 64 06 00 00    	jne    800a18 <umain+0x6fa>
+        panic("serve_open did not fill struct Fd correctly\n");
+    cprintf("serve_open is good\n");
+  8003b4:	48 bf d3 54 80 00 00 	movabs $0x8054d3,%rdi
+  8003bb:	00 00 00 
+  8003be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003c3:	48 ba 1d 10 80 00 00 	movabs $0x80101d,%rdx
+  8003ca:	00 00 00 
+  8003cd:	ff d2                	call   *%rdx
+
+    if ((r = devfile.dev_stat(FVA, &st)) < 0)
+  8003cf:	48 8d b5 28 ff ff ff 	lea    -0xd8(%rbp),%rsi
+  8003d6:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  8003db:	48 a1 48 70 80 00 00 	movabs 0x807048,%rax
+  8003e2:	00 00 00 
+  8003e5:	ff d0                	call   *%rax
+  8003e7:	48 63 c8             	movslq %eax,%rcx
+  8003ea:	48 85 c9             	test   %rcx,%rcx
+  8003ed:	0f 88 4f 06 00 00    	js     800a42 <umain+0x724>
+        panic("file_stat: %ld", (long)r);
+    if (strlen(msg) != st.st_size)
+  8003f3:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8003fa:	00 00 00 
+  8003fd:	48 8b 38             	mov    (%rax),%rdi
+  800400:	48 b8 04 19 80 00 00 	movabs $0x801904,%rax
+  800407:	00 00 00 
+  80040a:	ff d0                	call   *%rax
+  80040c:	48 89 c2             	mov    %rax,%rdx
+  80040f:	48 63 45 a8          	movslq -0x58(%rbp),%rax
+  800413:	48 39 c2             	cmp    %rax,%rdx
+  800416:	0f 85 51 06 00 00    	jne    800a6d <umain+0x74f>
+        panic("file_stat returned size %ld wanted %zd\n", (long)st.st_size, strlen(msg));
+    cprintf("file_stat is good\n");
+  80041c:	48 bf f6 54 80 00 00 	movabs $0x8054f6,%rdi
+  800423:	00 00 00 
+  800426:	b8 00 00 00 00       	mov    $0x0,%eax
+  80042b:	48 ba 1d 10 80 00 00 	movabs $0x80101d,%rdx
+  800432:	00 00 00 
+  800435:	ff d2                	call   *%rdx
+
+    memset(buf, 0, sizeof buf);
+  800437:	ba 00 02 00 00       	mov    $0x200,%edx
+  80043c:	be 00 00 00 00       	mov    $0x0,%esi
+  800441:	48 8d bd 28 fd ff ff 	lea    -0x2d8(%rbp),%rdi
+  800448:	48 b8 8e 1a 80 00 00 	movabs $0x801a8e,%rax
+  80044f:	00 00 00 
+  800452:	ff d0                	call   *%rax
+    if ((r = devfile.dev_read(FVA, buf, sizeof buf)) < 0)
+  800454:	ba 00 02 00 00       	mov    $0x200,%edx
+  800459:	48 8d b5 28 fd ff ff 	lea    -0x2d8(%rbp),%rsi
+  800460:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  800465:	48 a1 30 70 80 00 00 	movabs 0x807030,%rax
+  80046c:	00 00 00 
+  80046f:	ff d0                	call   *%rax
+  800471:	48 85 c0             	test   %rax,%rax
+  800474:	0f 88 3e 06 00 00    	js     800ab8 <umain+0x79a>
+        panic("file_read: %ld", (long)r);
+    if (strcmp(buf, msg) != 0)
+  80047a:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800481:	00 00 00 
+  800484:	48 8b 30             	mov    (%rax),%rsi
+  800487:	48 8d bd 28 fd ff ff 	lea    -0x2d8(%rbp),%rdi
+  80048e:	48 b8 e6 19 80 00 00 	movabs $0x8019e6,%rax
+  800495:	00 00 00 
+  800498:	ff d0                	call   *%rax
+  80049a:	85 c0                	test   %eax,%eax
+  80049c:	0f 85 44 06 00 00    	jne    800ae6 <umain+0x7c8>
+        panic("file_read returned wrong data");
+    cprintf("file_read is good\n");
+  8004a2:	48 bf 36 55 80 00 00 	movabs $0x805536,%rdi
+  8004a9:	00 00 00 
+  8004ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004b1:	48 ba 1d 10 80 00 00 	movabs $0x80101d,%rdx
+  8004b8:	00 00 00 
+  8004bb:	ff d2                	call   *%rdx
+
+    if ((r = devfile.dev_close(FVA)) < 0)
+  8004bd:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  8004c2:	48 a1 40 70 80 00 00 	movabs 0x807040,%rax
+  8004c9:	00 00 00 
+  8004cc:	ff d0                	call   *%rax
+  8004ce:	48 63 c8             	movslq %eax,%rcx
+  8004d1:	48 85 c9             	test   %rcx,%rcx
+  8004d4:	0f 88 36 06 00 00    	js     800b10 <umain+0x7f2>
+        panic("file_close: %ld", (long)r);
+    cprintf("file_close is good\n");
+  8004da:	48 bf 59 55 80 00 00 	movabs $0x805559,%rdi
+  8004e1:	00 00 00 
+  8004e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004e9:	48 ba 1d 10 80 00 00 	movabs $0x80101d,%rdx
+  8004f0:	00 00 00 
+  8004f3:	ff d2                	call   *%rdx
+
+    /* We're about to unmap the FD, but still need a way to get
+     * the stale filenum to serve_read, so we make a local copy.
+     * The file server won't think it's stale until we unmap the
+     * FD page. */
+    fdcopy = *FVA;
+  8004f5:	48 8b 04 25 00 00 00 	mov    0xa000000,%rax
+  8004fc:	0a 
+  8004fd:	48 89 45 bc          	mov    %rax,-0x44(%rbp)
+  800501:	48 8b 04 25 08 00 00 	mov    0xa000008,%rax
+  800508:	0a 
+  800509:	48 89 45 c4          	mov    %rax,-0x3c(%rbp)
+  80050d:	8b 04 25 10 00 00 0a 	mov    0xa000010,%eax
+  800514:	89 45 cc             	mov    %eax,-0x34(%rbp)
+    sys_unmap_region(0, FVA, PAGE_SIZE);
+  800517:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80051c:	be 00 00 00 0a       	mov    $0xa000000,%esi
+  800521:	bf 00 00 00 00       	mov    $0x0,%edi
+  800526:	48 b8 47 1f 80 00 00 	movabs $0x801f47,%rax
+  80052d:	00 00 00 
+  800530:	ff d0                	call   *%rax
+
+    if ((r = devfile.dev_read(&fdcopy, buf, sizeof buf)) != -E_INVAL)
+  800532:	ba 00 02 00 00       	mov    $0x200,%edx
+  800537:	48 8d b5 28 fd ff ff 	lea    -0x2d8(%rbp),%rsi
+  80053e:	48 8d 7d bc          	lea    -0x44(%rbp),%rdi
+  800542:	48 a1 30 70 80 00 00 	movabs 0x807030,%rax
+  800549:	00 00 00 
+  80054c:	ff d0                	call   *%rax
+  80054e:	48 83 f8 fd          	cmp    $0xfffffffffffffffd,%rax
+  800552:	0f 85 e3 05 00 00    	jne    800b3b <umain+0x81d>
+        panic("serve_read does not handle stale fileids correctly: %ld", (long)r);
+    cprintf("stale fileid is good\n");
+  800558:	48 bf 6d 55 80 00 00 	movabs $0x80556d,%rdi
+  80055f:	00 00 00 
+  800562:	b8 00 00 00 00       	mov    $0x0,%eax
+  800567:	48 ba 1d 10 80 00 00 	movabs $0x80101d,%rdx
+  80056e:	00 00 00 
+  800571:	ff d2                	call   *%rdx
+
+    /* Try writing */
+    if ((r = xopen("/new-file", O_RDWR | O_CREAT)) < 0)
+  800573:	be 02 01 00 00       	mov    $0x102,%esi
+  800578:	48 bf 83 55 80 00 00 	movabs $0x805583,%rdi
+  80057f:	00 00 00 
+  800582:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800589:	00 00 00 
+  80058c:	ff d0                	call   *%rax
+  80058e:	48 63 c8             	movslq %eax,%rcx
+  800591:	48 85 c9             	test   %rcx,%rcx
+  800594:	0f 88 cf 05 00 00    	js     800b69 <umain+0x84b>
+        panic("serve_open /new-file: %ld", (long)r);
+
+    if ((r = devfile.dev_write(FVA, msg, strlen(msg))) != strlen(msg))
+  80059a:	48 b8 38 70 80 00 00 	movabs $0x807038,%rax
+  8005a1:	00 00 00 
+  8005a4:	48 8b 18             	mov    (%rax),%rbx
+  8005a7:	49 bc 00 70 80 00 00 	movabs $0x807000,%r12
+  8005ae:	00 00 00 
+  8005b1:	49 8b 3c 24          	mov    (%r12),%rdi
+  8005b5:	49 bd 04 19 80 00 00 	movabs $0x801904,%r13
+  8005bc:	00 00 00 
+  8005bf:	41 ff d5             	call   *%r13
+  8005c2:	48 89 c2             	mov    %rax,%rdx
+  8005c5:	49 8b 34 24          	mov    (%r12),%rsi
+  8005c9:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  8005ce:	ff d3                	call   *%rbx
+  8005d0:	48 89 c3             	mov    %rax,%rbx
+  8005d3:	49 8b 3c 24          	mov    (%r12),%rdi
+  8005d7:	41 ff d5             	call   *%r13
+  8005da:	48 39 c3             	cmp    %rax,%rbx
+  8005dd:	0f 85 b1 05 00 00    	jne    800b94 <umain+0x876>
+        panic("file_write: %ld", (long)r);
+    cprintf("file_write is good\n");
+  8005e3:	48 bf b7 55 80 00 00 	movabs $0x8055b7,%rdi
+  8005ea:	00 00 00 
+  8005ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005f2:	48 ba 1d 10 80 00 00 	movabs $0x80101d,%rdx
+  8005f9:	00 00 00 
+  8005fc:	ff d2                	call   *%rdx
+
+    FVA->fd_offset = 0;
+  8005fe:	c7 04 25 04 00 00 0a 	movl   $0x0,0xa000004
+  800605:	00 00 00 00 
+    memset(buf, 0, sizeof buf);
+  800609:	ba 00 02 00 00       	mov    $0x200,%edx
+  80060e:	be 00 00 00 00       	mov    $0x0,%esi
+  800613:	48 8d bd 28 fd ff ff 	lea    -0x2d8(%rbp),%rdi
+  80061a:	48 b8 8e 1a 80 00 00 	movabs $0x801a8e,%rax
+  800621:	00 00 00 
+  800624:	ff d0                	call   *%rax
+    if ((r = devfile.dev_read(FVA, buf, sizeof buf)) < 0)
+  800626:	ba 00 02 00 00       	mov    $0x200,%edx
+  80062b:	48 8d b5 28 fd ff ff 	lea    -0x2d8(%rbp),%rsi
+  800632:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  800637:	48 a1 30 70 80 00 00 	movabs 0x807030,%rax
+  80063e:	00 00 00 
+  800641:	ff d0                	call   *%rax
+  800643:	48 89 c3             	mov    %rax,%rbx
+  800646:	48 85 c0             	test   %rax,%rax
+  800649:	0f 88 73 05 00 00    	js     800bc2 <umain+0x8a4>
+        panic("file_read after file_write: %ld", (long)r);
+    if (r != strlen(msg))
+  80064f:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800656:	00 00 00 
+  800659:	48 8b 38             	mov    (%rax),%rdi
+  80065c:	48 b8 04 19 80 00 00 	movabs $0x801904,%rax
+  800663:	00 00 00 
+  800666:	ff d0                	call   *%rax
+  800668:	48 39 d8             	cmp    %rbx,%rax
+  80066b:	0f 85 7f 05 00 00    	jne    800bf0 <umain+0x8d2>
+        panic("file_read after file_write returned wrong length: %ld", (long)r);
+    if (strcmp(buf, msg) != 0)
+  800671:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800678:	00 00 00 
+  80067b:	48 8b 30             	mov    (%rax),%rsi
+  80067e:	48 8d bd 28 fd ff ff 	lea    -0x2d8(%rbp),%rdi
+  800685:	48 b8 e6 19 80 00 00 	movabs $0x8019e6,%rax
+  80068c:	00 00 00 
+  80068f:	ff d0                	call   *%rax
+  800691:	85 c0                	test   %eax,%eax
+  800693:	0f 85 85 05 00 00    	jne    800c1e <umain+0x900>
+        panic("file_read after file_write returned wrong data");
+    cprintf("file_read after file_write is good\n");
+  800699:	48 bf 30 58 80 00 00 	movabs $0x805830,%rdi
+  8006a0:	00 00 00 
+  8006a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006a8:	48 ba 1d 10 80 00 00 	movabs $0x80101d,%rdx
+  8006af:	00 00 00 
+  8006b2:	ff d2                	call   *%rdx
+
+    /* Now we'll try out open */
+    if ((r = open("/not-found", O_RDONLY)) < 0 && r != -E_NOT_FOUND)
+  8006b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8006b9:	48 bf 8b 54 80 00 00 	movabs $0x80548b,%rdi
+  8006c0:	00 00 00 
+  8006c3:	48 b8 ee 3c 80 00 00 	movabs $0x803cee,%rax
+  8006ca:	00 00 00 
+  8006cd:	ff d0                	call   *%rax
+  8006cf:	48 63 c8             	movslq %eax,%rcx
+  8006d2:	48 85 c9             	test   %rcx,%rcx
+  8006d5:	0f 89 98 05 00 00    	jns    800c73 <umain+0x955>
+  8006db:	48 83 f9 f1          	cmp    $0xfffffffffffffff1,%rcx
+  8006df:	0f 85 63 05 00 00    	jne    800c48 <umain+0x92a>
+        panic("open /not-found: %ld", (long)r);
+    else if (r >= 0)
+        panic("open /not-found succeeded!");
+
+    if ((r = open("/newmotd", O_RDONLY)) < 0)
+  8006e5:	be 00 00 00 00       	mov    $0x0,%esi
+  8006ea:	48 bf b1 54 80 00 00 	movabs $0x8054b1,%rdi
+  8006f1:	00 00 00 
+  8006f4:	48 b8 ee 3c 80 00 00 	movabs $0x803cee,%rax
+  8006fb:	00 00 00 
+  8006fe:	ff d0                	call   *%rax
+  800700:	48 98                	cltq
+  800702:	48 85 c0             	test   %rax,%rax
+  800705:	0f 88 92 05 00 00    	js     800c9d <umain+0x97f>
+        panic("open /newmotd: %ld", (long)r);
+    fd = (struct Fd *)(0xD0000000 + r * PAGE_SIZE);
+  80070b:	48 05 00 00 0d 00    	add    $0xd0000,%rax
+  800711:	48 c1 e0 0c          	shl    $0xc,%rax
+    if (fd->fd_dev_id != 'f' || fd->fd_offset != 0 || fd->fd_omode != O_RDONLY)
+  800715:	83 38 66             	cmpl   $0x66,(%rax)
+  800718:	0f 85 ad 05 00 00    	jne    800ccb <umain+0x9ad>
+  80071e:	83 78 04 00          	cmpl   $0x0,0x4(%rax)
+  800722:	0f 85 a3 05 00 00    	jne    800ccb <umain+0x9ad>
+  800728:	83 78 08 00          	cmpl   $0x0,0x8(%rax)
+  80072c:	0f 85 99 05 00 00    	jne    800ccb <umain+0x9ad>
+        panic("open did not fill struct Fd correctly\n");
+    cprintf("open is good\n");
+  800732:	48 bf d9 54 80 00 00 	movabs $0x8054d9,%rdi
+  800739:	00 00 00 
+  80073c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800741:	48 ba 1d 10 80 00 00 	movabs $0x80101d,%rdx
+  800748:	00 00 00 
+  80074b:	ff d2                	call   *%rdx
+    /* Try large files. Writing two files in turns keeps either from
+     * growing its extents, so both run out of them and go on to the
+     * indirect and the double-indirect block. The client buffer sends
+     * the writes a few blocks at a time, so each extent maps a run of
+     * blocks rather than a single one */
+    if ((f = open("/big", O_RDWR | O_CREAT | O_TRUNC)) < 0)
+  80074d:	be 02 03 00 00       	mov    $0x302,%esi
+  800752:	48 bf e6 55 80 00 00 	movabs $0x8055e6,%rdi
+  800759:	00 00 00 
+  80075c:	48 b8 ee 3c 80 00 00 	movabs $0x803cee,%rax
+  800763:	00 00 00 
+  800766:	ff d0                	call   *%rax
+  800768:	41 89 c5             	mov    %eax,%r13d
+  80076b:	48 63 c8             	movslq %eax,%rcx
+  80076e:	48 85 c9             	test   %rcx,%rcx
+  800771:	0f 88 7e 05 00 00    	js     800cf5 <umain+0x9d7>
+        panic("creat /big: %ld", (long)f);
+    if ((f2 = open("/big2", O_RDWR | O_CREAT | O_TRUNC)) < 0)
+  800777:	be 02 03 00 00       	mov    $0x302,%esi
+  80077c:	48 bf fb 55 80 00 00 	movabs $0x8055fb,%rdi
+  800783:	00 00 00 
+  800786:	48 b8 ee 3c 80 00 00 	movabs $0x803cee,%rax
+  80078d:	00 00 00 
+  800790:	ff d0                	call   *%rax
+  800792:	41 89 c6             	mov    %eax,%r14d
+  800795:	48 63 c8             	movslq %eax,%rcx
+  800798:	48 85 c9             	test   %rcx,%rcx
+  80079b:	0f 88 7f 05 00 00    	js     800d20 <umain+0xa02>
+        panic("creat /big2: %ld", (long)f2);
+    for (int64_t i = 0; i < NBIGBLOCKS; i++) {
+  8007a1:	bb 00 00 00 00       	mov    $0x0,%ebx
+        big_write(f, "/big", i, 1);
+  8007a6:	49 bf e6 55 80 00 00 	movabs $0x8055e6,%r15
+  8007ad:	00 00 00 
+  8007b0:	49 bc b8 00 80 00 00 	movabs $0x8000b8,%r12
+  8007b7:	00 00 00 
+  8007ba:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8007bf:	48 89 da             	mov    %rbx,%rdx
+  8007c2:	4c 89 fe             	mov    %r15,%rsi
+  8007c5:	44 89 ef             	mov    %r13d,%edi
+  8007c8:	41 ff d4             	call   *%r12
+        big_write(f2, "/big2", i, 2);
+  8007cb:	b9 02 00 00 00       	mov    $0x2,%ecx
+  8007d0:	48 89 da             	mov    %rbx,%rdx
+  8007d3:	48 be fb 55 80 00 00 	movabs $0x8055fb,%rsi
+  8007da:	00 00 00 
+  8007dd:	44 89 f7             	mov    %r14d,%edi
+  8007e0:	41 ff d4             	call   *%r12
+    for (int64_t i = 0; i < NBIGBLOCKS; i++) {
+  8007e3:	48 83 c3 01          	add    $0x1,%rbx
+  8007e7:	48 81 fb 27 04 00 00 	cmp    $0x427,%rbx
+  8007ee:	75 ca                	jne    8007ba <umain+0x49c>
+    }
+    big_check(f, "/big", NBIGBLOCKS, 1);
+  8007f0:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8007f5:	ba 27 04 00 00       	mov    $0x427,%edx
+  8007fa:	48 be e6 55 80 00 00 	movabs $0x8055e6,%rsi
+  800801:	00 00 00 
+  800804:	44 89 ef             	mov    %r13d,%edi
+  800807:	48 bb 4f 01 80 00 00 	movabs $0x80014f,%rbx
+  80080e:	00 00 00 
+  800811:	ff d3                	call   *%rbx
+    big_check(f2, "/big2", NBIGBLOCKS, 2);
+  800813:	b9 02 00 00 00       	mov    $0x2,%ecx
+  800818:	ba 27 04 00 00       	mov    $0x427,%edx
+  80081d:	48 be fb 55 80 00 00 	movabs $0x8055fb,%rsi
+  800824:	00 00 00 
+  800827:	44 89 f7             	mov    %r14d,%edi
+  80082a:	ff d3                	call   *%rbx
+    cprintf("large file is good\n");
+  80082c:	48 bf 12 56 80 00 00 	movabs $0x805612,%rdi
+  800833:	00 00 00 
+  800836:	b8 00 00 00 00       	mov    $0x0,%eax
+  80083b:	48 ba 1d 10 80 00 00 	movabs $0x80101d,%rdx
+  800842:	00 00 00 
+  800845:	ff d2                	call   *%rdx
+
+    /* Free the double-indirect block of /big and the second half of
+     * its indirect one, which stays in use whatever the extents map,
+     * and all of /big2, then reuse the freed blocks */
+    if ((r = ftruncate(f, NINDIRECT / 2 * BLKSIZE)) < 0)
+  800847:	be 00 00 20 00       	mov    $0x200000,%esi
+  80084c:	44 89 ef             	mov    %r13d,%edi
+  80084f:	48 b8 5c 2a 80 00 00 	movabs $0x802a5c,%rax
+  800856:	00 00 00 
+  800859:	ff d0                	call   *%rax
+  80085b:	48 63 c8             	movslq %eax,%rcx
+  80085e:	48 85 c9             	test   %rcx,%rcx
+  800861:	0f 88 e4 04 00 00    	js     800d4b <umain+0xa2d>
+        panic("ftruncate /big: %ld", (long)r);
+    close(f2);
+  800867:	44 89 f7             	mov    %r14d,%edi
+  80086a:	48 b8 8e 26 80 00 00 	movabs $0x80268e,%rax
+  800871:	00 00 00 
+  800874:	ff d0                	call   *%rax
+    if ((r = remove("/big2")) < 0)
+  800876:	48 bf fb 55 80 00 00 	movabs $0x8055fb,%rdi
+  80087d:	00 00 00 
+  800880:	48 b8 ed 3e 80 00 00 	movabs $0x803eed,%rax
+  800887:	00 00 00 
+  80088a:	ff d0                	call   *%rax
+  80088c:	48 63 c8             	movslq %eax,%rcx
+  80088f:	48 85 c9             	test   %rcx,%rcx
+  800892:	0f 88 de 04 00 00    	js     800d76 <umain+0xa58>
+        panic("remove /big2: %ld", (long)r);
+    if ((f2 = open("/big2", O_RDWR | O_CREAT | O_TRUNC)) < 0)
+  800898:	be 02 03 00 00       	mov    $0x302,%esi
+  80089d:	48 bf fb 55 80 00 00 	movabs $0x8055fb,%rdi
+  8008a4:	00 00 00 
+  8008a7:	48 b8 ee 3c 80 00 00 	movabs $0x803cee,%rax
+  8008ae:	00 00 00 
+  8008b1:	ff d0                	call   *%rax
+  8008b3:	41 89 c4             	mov    %eax,%r12d
+  8008b6:	48 63 c8             	movslq %eax,%rcx
+  8008b9:	48 85 c9             	test   %rcx,%rcx
+  8008bc:	0f 88 df 04 00 00    	js     800da1 <umain+0xa83>
+        panic("creat /big2: %ld", (long)f2);
+    for (int64_t i = 0; i < NBIGBLOCKS; i++)
+  8008c2:	bb 00 00 00 00       	mov    $0x0,%ebx
+        big_write(f2, "/big2", i, 3);
+  8008c7:	49 bf fb 55 80 00 00 	movabs $0x8055fb,%r15
+  8008ce:	00 00 00 
+  8008d1:	49 be b8 00 80 00 00 	movabs $0x8000b8,%r14
+  8008d8:	00 00 00 
+  8008db:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8008e0:	48 89 da             	mov    %rbx,%rdx
+  8008e3:	4c 89 fe             	mov    %r15,%rsi
+  8008e6:	44 89 e7             	mov    %r12d,%edi
+  8008e9:	41 ff d6             	call   *%r14
+    for (int64_t i = 0; i < NBIGBLOCKS; i++)
+  8008ec:	48 83 c3 01          	add    $0x1,%rbx
+  8008f0:	48 81 fb 27 04 00 00 	cmp    $0x427,%rbx
+  8008f7:	75 e2                	jne    8008db <umain+0x5bd>
+    big_check(f, "/big", NINDIRECT / 2, 1);
+  8008f9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8008fe:	ba 00 02 00 00       	mov    $0x200,%edx
+  800903:	48 be e6 55 80 00 00 	movabs $0x8055e6,%rsi
+  80090a:	00 00 00 
+  80090d:	44 89 ef             	mov    %r13d,%edi
+  800910:	49 be 4f 01 80 00 00 	movabs $0x80014f,%r14
+  800917:	00 00 00 
+  80091a:	41 ff d6             	call   *%r14
+    big_check(f2, "/big2", NBIGBLOCKS, 3);
+  80091d:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800922:	ba 27 04 00 00       	mov    $0x427,%edx
+  800927:	48 bb fb 55 80 00 00 	movabs $0x8055fb,%rbx
+  80092e:	00 00 00 
+  800931:	48 89 de             	mov    %rbx,%rsi
+  800934:	44 89 e7             	mov    %r12d,%edi
+  800937:	41 ff d6             	call   *%r14
+    close(f);
+  80093a:	44 89 ef             	mov    %r13d,%edi
+  80093d:	49 bd 8e 26 80 00 00 	movabs $0x80268e,%r13
+  800944:	00 00 00 
+  800947:	41 ff d5             	call   *%r13
+    close(f2);
+  80094a:	44 89 e7             	mov    %r12d,%edi
+  80094d:	41 ff d5             	call   *%r13
+    if ((r = remove("/big2")) < 0)
+  800950:	48 89 df             	mov    %rbx,%rdi
+  800953:	48 b8 ed 3e 80 00 00 	movabs $0x803eed,%rax
+  80095a:	00 00 00 
+  80095d:	ff d0                	call   *%rax
+  80095f:	48 63 c8             	movslq %eax,%rcx
+  800962:	48 85 c9             	test   %rcx,%rcx
+  800965:	0f 88 61 04 00 00    	js     800dcc <umain+0xaae>
+        panic("remove /big2: %ld", (long)r);
+    cprintf("large file free is good\n");
+  80096b:	48 bf 4c 56 80 00 00 	movabs $0x80564c,%rdi
+  800972:	00 00 00 
+  800975:	b8 00 00 00 00       	mov    $0x0,%eax
+  80097a:	48 ba 1d 10 80 00 00 	movabs $0x80101d,%rdx
+  800981:	00 00 00 
+  800984:	ff d2                	call   *%rdx
+}
+  800986:	48 81 c4 b8 02 00 00 	add    $0x2b8,%rsp
+  80098d:	5b                   	pop    %rbx
+  80098e:	41 5c                	pop    %r12
+  800990:	41 5d                	pop    %r13
+  800992:	41 5e                	pop    %r14
+  800994:	41 5f                	pop    %r15
+  800996:	5d                   	pop    %rbp
+  800997:	c3                   	ret
+        panic("serve_open /not-found: %ld", (long)r);
+  800998:	48 ba 96 54 80 00 00 	movabs $0x805496,%rdx
+  80099f:	00 00 00 
+  8009a2:	be 43 00 00 00       	mov    $0x43,%esi
+  8009a7:	48 bf 6a 54 80 00 00 	movabs $0x80546a,%rdi
+  8009ae:	00 00 00 
+  8009b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009b6:	49 b8 cd 0e 80 00 00 	movabs $0x800ecd,%r8
+  8009bd:	00 00 00 
+  8009c0:	41 ff d0             	call   *%r8
+        panic("serve_open /not-found succeeded!");
+  8009c3:	48 ba f0 56 80 00 00 	movabs $0x8056f0,%rdx
+  8009ca:	00 00 00 
+  8009cd:	be 45 00 00 00       	mov    $0x45,%esi
+  8009d2:	48 bf 6a 54 80 00 00 	movabs $0x80546a,%rdi
+  8009d9:	00 00 00 
+  8009dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009e1:	48 b9 cd 0e 80 00 00 	movabs $0x800ecd,%rcx
+  8009e8:	00 00 00 
+  8009eb:	ff d1                	call   *%rcx
+        panic("serve_open /newmotd: %ld", (long)r);
+  8009ed:	48 ba ba 54 80 00 00 	movabs $0x8054ba,%rdx
+  8009f4:	00 00 00 
+  8009f7:	be 48 00 00 00       	mov    $0x48,%esi
+  8009fc:	48 bf 6a 54 80 00 00 	movabs $0x80546a,%rdi
+  800a03:	00 00 00 
+  800a06:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a0b:	49 b8 cd 0e 80 00 00 	movabs $0x800ecd,%r8
+  800a12:	00 00 00 
+  800a15:	41 ff d0             	call   *%r8
+        panic("serve_open did not fill struct Fd correctly\n");
+  800a18:	48 ba 18 57 80 00 00 	movabs $0x805718,%rdx
+  800a1f:	00 00 00 
+  800a22:	be 4a 00 00 00       	mov    $0x4a,%esi
+  800a27:	48 bf 6a 54 80 00 00 	movabs $0x80546a,%rdi
+  800a2e:	00 00 00 
+  800a31:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a36:	48 b9 cd 0e 80 00 00 	movabs $0x800ecd,%rcx
+  800a3d:	00 00 00 
+  800a40:	ff d1                	call   *%rcx
+        panic("file_stat: %ld", (long)r);
+  800a42:	48 ba e7 54 80 00 00 	movabs $0x8054e7,%rdx
+  800a49:	00 00 00 
+  800a4c:	be 4e 00 00 00       	mov    $0x4e,%esi
+  800a51:	48 bf 6a 54 80 00 00 	movabs $0x80546a,%rdi
+  800a58:	00 00 00 
+  800a5b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a60:	49 b8 cd 0e 80 00 00 	movabs $0x800ecd,%r8
+  800a67:	00 00 00 
+  800a6a:	41 ff d0             	call   *%r8
+        panic("file_stat returned size %ld wanted %zd\n", (long)st.st_size, strlen(msg));
+  800a6d:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800a74:	00 00 00 
+  800a77:	48 8b 38             	mov    (%rax),%rdi
+  800a7a:	48 b8 04 19 80 00 00 	movabs $0x801904,%rax
+  800a81:	00 00 00 
+  800a84:	ff d0                	call   *%rax
+  800a86:	49 89 c0             	mov    %rax,%r8
+  800a89:	48 63 4d a8          	movslq -0x58(%rbp),%rcx
+  800a8d:	48 ba 48 57 80 00 00 	movabs $0x805748,%rdx
+  800a94:	00 00 00 
+  800a97:	be 50 00 00 00       	mov    $0x50,%esi
+  800a9c:	48 bf 6a 54 80 00 00 	movabs $0x80546a,%rdi
+  800aa3:	00 00 00 
+  800aa6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aab:	49 b9 cd 0e 80 00 00 	movabs $0x800ecd,%r9
+  800ab2:	00 00 00 
+  800ab5:	41 ff d1             	call   *%r9
+        panic("file_read: %ld", (long)r);
+  800ab8:	48 89 c1             	mov    %rax,%rcx
+  800abb:	48 ba 09 55 80 00 00 	movabs $0x805509,%rdx
+  800ac2:	00 00 00 
+  800ac5:	be 55 00 00 00       	mov    $0x55,%esi
+  800aca:	48 bf 6a 54 80 00 00 	movabs $0x80546a,%rdi
+  800ad1:	00 00 00 
+  800ad4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ad9:	49 b8 cd 0e 80 00 00 	movabs $0x800ecd,%r8
+  800ae0:	00 00 00 
+  800ae3:	41 ff d0             	call   *%r8
+        panic("file_read returned wrong data");
+  800ae6:	48 ba 18 55 80 00 00 	movabs $0x805518,%rdx
+  800aed:	00 00 00 
+  800af0:	be 57 00 00 00       	mov    $0x57,%esi
+  800af5:	48 bf 6a 54 80 00 00 	movabs $0x80546a,%rdi
+  800afc:	00 00 00 
+  800aff:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b04:	48 b9 cd 0e 80 00 00 	movabs $0x800ecd,%rcx
+  800b0b:	00 00 00 
+  800b0e:	ff d1                	call   *%rcx
+        panic("file_close: %ld", (long)r);
+  800b10:	48 ba 49 55 80 00 00 	movabs $0x805549,%rdx
+  800b17:	00 00 00 
+  800b1a:	be 5b 00 00 00       	mov    $0x5b,%esi
+  800b1f:	48 bf 6a 54 80 00 00 	movabs $0x80546a,%rdi
+  800b26:	00 00 00 
+  800b29:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b2e:	49 b8 cd 0e 80 00 00 	movabs $0x800ecd,%r8
+  800b35:	00 00 00 
+  800b38:	41 ff d0             	call   *%r8
+        panic("serve_read does not handle stale fileids correctly: %ld", (long)r);
+  800b3b:	48 89 c1             	mov    %rax,%rcx
+  800b3e:	48 ba 70 57 80 00 00 	movabs $0x805770,%rdx
+  800b45:	00 00 00 
+  800b48:	be 66 00 00 00       	mov    $0x66,%esi
+  800b4d:	48 bf 6a 54 80 00 00 	movabs $0x80546a,%rdi
+  800b54:	00 00 00 
+  800b57:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b5c:	49 b8 cd 0e 80 00 00 	movabs $0x800ecd,%r8
+  800b63:	00 00 00 
+  800b66:	41 ff d0             	call   *%r8
+        panic("serve_open /new-file: %ld", (long)r);
+  800b69:	48 ba 8d 55 80 00 00 	movabs $0x80558d,%rdx
+  800b70:	00 00 00 
+  800b73:	be 6b 00 00 00       	mov    $0x6b,%esi
+  800b78:	48 bf 6a 54 80 00 00 	movabs $0x80546a,%rdi
+  800b7f:	00 00 00 
+  800b82:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b87:	49 b8 cd 0e 80 00 00 	movabs $0x800ecd,%r8
+  800b8e:	00 00 00 
+  800b91:	41 ff d0             	call   *%r8
+        panic("file_write: %ld", (long)r);
+  800b94:	48 89 d9             	mov    %rbx,%rcx
+  800b97:	48 ba a7 55 80 00 00 	movabs $0x8055a7,%rdx
+  800b9e:	00 00 00 
+  800ba1:	be 6e 00 00 00       	mov    $0x6e,%esi
+  800ba6:	48 bf 6a 54 80 00 00 	movabs $0x80546a,%rdi
+  800bad:	00 00 00 
+  800bb0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bb5:	49 b8 cd 0e 80 00 00 	movabs $0x800ecd,%r8
+  800bbc:	00 00 00 
+  800bbf:	41 ff d0             	call   *%r8
+        panic("file_read after file_write: %ld", (long)r);
+  800bc2:	48 89 c1             	mov    %rax,%rcx
+  800bc5:	48 ba a8 57 80 00 00 	movabs $0x8057a8,%rdx
+  800bcc:	00 00 00 
+  800bcf:	be 74 00 00 00       	mov    $0x74,%esi
+  800bd4:	48 bf 6a 54 80 00 00 	movabs $0x80546a,%rdi
+  800bdb:	00 00 00 
+  800bde:	b8 00 00 00 00       	mov    $0x0,%eax
+  800be3:	49 b8 cd 0e 80 00 00 	movabs $0x800ecd,%r8
+  800bea:	00 00 00 
+  800bed:	41 ff d0             	call   *%r8
+        panic("file_read after file_write returned wrong length: %ld", (long)r);
+  800bf0:	48 89 d9             	mov    %rbx,%rcx
+  800bf3:	48 ba c8 57 80 00 00 	movabs $0x8057c8,%rdx
+  800bfa:	00 00 00 
+  800bfd:	be 76 00 00 00       	mov    $0x76,%esi
+  800c02:	48 bf 6a 54 80 00 00 	movabs $0x80546a,%rdi
+  800c09:	00 00 00 
+  800c0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c11:	49 b8 cd 0e 80 00 00 	movabs $0x800ecd,%r8
+  800c18:	00 00 00 
+  800c1b:	41 ff d0             	call   *%r8
+        panic("file_read after file_write returned wrong data");
+  800c1e:	48 ba 00 58 80 00 00 	movabs $0x805800,%rdx
+  800c25:	00 00 00 
+  800c28:	be 78 00 00 00       	mov    $0x78,%esi
+  800c2d:	48 bf 6a 54 80 00 00 	movabs $0x80546a,%rdi
+  800c34:	00 00 00 
+  800c37:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c3c:	48 b9 cd 0e 80 00 00 	movabs $0x800ecd,%rcx
+  800c43:	00 00 00 
+  800c46:	ff d1                	call   *%rcx
+        panic("open /not-found: %ld", (long)r);
+  800c48:	48 ba 9c 54 80 00 00 	movabs $0x80549c,%rdx
+  800c4f:	00 00 00 
+  800c52:	be 7d 00 00 00       	mov    $0x7d,%esi
+  800c57:	48 bf 6a 54 80 00 00 	movabs $0x80546a,%rdi
+  800c5e:	00 00 00 
+  800c61:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c66:	49 b8 cd 0e 80 00 00 	movabs $0x800ecd,%r8
+  800c6d:	00 00 00 
+  800c70:	41 ff d0             	call   *%r8
+        panic("open /not-found succeeded!");
+  800c73:	48 ba cb 55 80 00 00 	movabs $0x8055cb,%rdx
+  800c7a:	00 00 00 
+  800c7d:	be 7f 00 00 00       	mov    $0x7f,%esi
+  800c82:	48 bf 6a 54 80 00 00 	movabs $0x80546a,%rdi
+  800c89:	00 00 00 
+  800c8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c91:	48 b9 cd 0e 80 00 00 	movabs $0x800ecd,%rcx
+  800c98:	00 00 00 
+  800c9b:	ff d1                	call   *%rcx
+        panic("open /newmotd: %ld", (long)r);
+  800c9d:	48 89 c1             	mov    %rax,%rcx
+  800ca0:	48 ba c0 54 80 00 00 	movabs $0x8054c0,%rdx
+  800ca7:	00 00 00 
+  800caa:	be 82 00 00 00       	mov    $0x82,%esi
+  800caf:	48 bf 6a 54 80 00 00 	movabs $0x80546a,%rdi
+  800cb6:	00 00 00 
+  800cb9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cbe:	49 b8 cd 0e 80 00 00 	movabs $0x800ecd,%r8
+  800cc5:	00 00 00 
+  800cc8:	41 ff d0             	call   *%r8
+        panic("open did not fill struct Fd correctly\n");
+  800ccb:	48 ba 58 58 80 00 00 	movabs $0x805858,%rdx
+  800cd2:	00 00 00 
+  800cd5:	be 85 00 00 00       	mov    $0x85,%esi
+  800cda:	48 bf 6a 54 80 00 00 	movabs $0x80546a,%rdi
+  800ce1:	00 00 00 
+  800ce4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ce9:	48 b9 cd 0e 80 00 00 	movabs $0x800ecd,%rcx
+  800cf0:	00 00 00 
+  800cf3:	ff d1                	call   *%rcx
+        panic("creat /big: %ld", (long)f);
+  800cf5:	48 ba eb 55 80 00 00 	movabs $0x8055eb,%rdx
+  800cfc:	00 00 00 
+  800cff:	be 8e 00 00 00       	mov    $0x8e,%esi
+  800d04:	48 bf 6a 54 80 00 00 	movabs $0x80546a,%rdi
+  800d0b:	00 00 00 
+  800d0e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d13:	49 b8 cd 0e 80 00 00 	movabs $0x800ecd,%r8
+  800d1a:	00 00 00 
+  800d1d:	41 ff d0             	call   *%r8
+        panic("creat /big2: %ld", (long)f2);
+  800d20:	48 ba 01 56 80 00 00 	movabs $0x805601,%rdx
+  800d27:	00 00 00 
+  800d2a:	be 90 00 00 00       	mov    $0x90,%esi
+  800d2f:	48 bf 6a 54 80 00 00 	movabs $0x80546a,%rdi
+  800d36:	00 00 00 
+  800d39:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d3e:	49 b8 cd 0e 80 00 00 	movabs $0x800ecd,%r8
+  800d45:	00 00 00 
+  800d48:	41 ff d0             	call   *%r8
+        panic("ftruncate /big: %ld", (long)r);
+  800d4b:	48 ba 26 56 80 00 00 	movabs $0x805626,%rdx
+  800d52:	00 00 00 
+  800d55:	be 9d 00 00 00       	mov    $0x9d,%esi
+  800d5a:	48 bf 6a 54 80 00 00 	movabs $0x80546a,%rdi
+  800d61:	00 00 00 
+  800d64:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d69:	49 b8 cd 0e 80 00 00 	movabs $0x800ecd,%r8
+  800d70:	00 00 00 
+  800d73:	41 ff d0             	call   *%r8
+        panic("remove /big2: %ld", (long)r);
+  800d76:	48 ba 3a 56 80 00 00 	movabs $0x80563a,%rdx
+  800d7d:	00 00 00 
+  800d80:	be a0 00 00 00       	mov    $0xa0,%esi
+  800d85:	48 bf 6a 54 80 00 00 	movabs $0x80546a,%rdi
+  800d8c:	00 00 00 
+  800d8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d94:	49 b8 cd 0e 80 00 00 	movabs $0x800ecd,%r8
+  800d9b:	00 00 00 
+  800d9e:	41 ff d0             	call   *%r8
+        panic("creat /big2: %ld", (long)f2);
+  800da1:	48 ba 01 56 80 00 00 	movabs $0x805601,%rdx
+  800da8:	00 00 00 
+  800dab:	be a2 00 00 00       	mov    $0xa2,%esi
+  800db0:	48 bf 6a 54 80 00 00 	movabs $0x80546a,%rdi
+  800db7:	00 00 00 
+  800dba:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dbf:	49 b8 cd 0e 80 00 00 	movabs $0x800ecd,%r8
+  800dc6:	00 00 00 
+  800dc9:	41 ff d0             	call   *%r8
+        panic("remove /big2: %ld", (long)r);
+  800dcc:	48 ba 3a 56 80 00 00 	movabs $0x80563a,%rdx
+  800dd3:	00 00 00 
+  800dd6:	be aa 00 00 00       	mov    $0xaa,%esi
+  800ddb:	48 bf 6a 54 80 00 00 	movabs $0x80546a,%rdi
+  800de2:	00 00 00 
+  800de5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dea:	49 b8 cd 0e 80 00 00 	movabs $0x800ecd,%r8
+  800df1:	00 00 00 
+  800df4:	41 ff d0             	call   *%r8
+
+0000000000800df7 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800df7:	55                   	push   %rbp
+  800df8:	48 89 e5             	mov    %rsp,%rbp
+  800dfb:	41 56                	push   %r14
+  800dfd:	41 55                	push   %r13
+  800dff:	41 54                	push   %r12
+  800e01:	53                   	push   %rbx
+  800e02:	41 89 fd             	mov    %edi,%r13d
+  800e05:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800e08:	48 ba e0 70 80 00 00 	movabs $0x8070e0,%rdx
+  800e0f:	00 00 00 
+  800e12:	48 b8 e0 70 80 00 00 	movabs $0x8070e0,%rax
+  800e19:	00 00 00 
+  800e1c:	48 39 c2             	cmp    %rax,%rdx
+  800e1f:	73 17                	jae    800e38 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800e21:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800e24:	49 89 c4             	mov    %rax,%r12
+  800e27:	48 83 c3 08          	add    $0x8,%rbx
+  800e2b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e30:	ff 53 f8             	call   *-0x8(%rbx)
+  800e33:	4c 39 e3             	cmp    %r12,%rbx
+  800e36:	72 ef                	jb     800e27 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800e38:	48 b8 14 1e 80 00 00 	movabs $0x801e14,%rax
+  800e3f:	00 00 00 
+  800e42:	ff d0                	call   *%rax
+  800e44:	89 c2                	mov    %eax,%edx
+  800e46:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  800e4c:	48 89 d0             	mov    %rdx,%rax
+  800e4f:	48 c1 e0 04          	shl    $0x4,%rax
+  800e53:	48 29 d0             	sub    %rdx,%rax
+  800e56:	48 c1 e0 05          	shl    $0x5,%rax
+  800e5a:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800e61:	00 00 00 
+  800e64:	48 01 d0             	add    %rdx,%rax
+  800e67:	48 a3 00 10 81 00 00 	movabs %rax,0x811000
+  800e6e:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800e71:	45 85 ed             	test   %r13d,%r13d
+  800e74:	7e 0d                	jle    800e83 <libmain+0x8c>
+  800e76:	49 8b 06             	mov    (%r14),%rax
+  800e79:	48 a3 08 70 80 00 00 	movabs %rax,0x807008
+  800e80:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800e83:	4c 89 f6             	mov    %r14,%rsi
+  800e86:	44 89 ef             	mov    %r13d,%edi
+  800e89:	48 b8 1e 03 80 00 00 	movabs $0x80031e,%rax
+  800e90:	00 00 00 
+  800e93:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800e95:	48 b8 aa 0e 80 00 00 	movabs $0x800eaa,%rax
+  800e9c:	00 00 00 
+  800e9f:	ff d0                	call   *%rax
+#endif
+}
+  800ea1:	5b                   	pop    %rbx
+  800ea2:	41 5c                	pop    %r12
+  800ea4:	41 5d                	pop    %r13
+  800ea6:	41 5e                	pop    %r14
+  800ea8:	5d                   	pop    %rbp
+  800ea9:	c3                   	ret
+
+0000000000800eaa <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800eaa:	55                   	push   %rbp
+  800eab:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800eae:	48 b8 c1 26 80 00 00 	movabs $0x8026c1,%rax
+  800eb5:	00 00 00 
+  800eb8:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800eba:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ebf:	48 b8 b1 1d 80 00 00 	movabs $0x801db1,%rax
+  800ec6:	00 00 00 
+  800ec9:	ff d0                	call   *%rax
+}
+  800ecb:	5d                   	pop    %rbp
+  800ecc:	c3                   	ret
+
+0000000000800ecd <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800ecd:	55                   	push   %rbp
+  800ece:	48 89 e5             	mov    %rsp,%rbp
+  800ed1:	41 56                	push   %r14
+  800ed3:	41 55                	push   %r13
+  800ed5:	41 54                	push   %r12
+  800ed7:	53                   	push   %rbx
+  800ed8:	48 83 ec 50          	sub    $0x50,%rsp
+  800edc:	49 89 fc             	mov    %rdi,%r12
+  800edf:	41 89 f5             	mov    %esi,%r13d
+  800ee2:	48 89 d3             	mov    %rdx,%rbx
+  800ee5:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800ee9:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800eed:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800ef1:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800ef8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800efc:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800f00:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800f04:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800f08:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  800f0f:	00 00 00 
+  800f12:	4c 8b 30             	mov    (%rax),%r14
+  800f15:	48 b8 14 1e 80 00 00 	movabs $0x801e14,%rax
+  800f1c:	00 00 00 
+  800f1f:	ff d0                	call   *%rax
+  800f21:	89 c6                	mov    %eax,%esi
+  800f23:	45 89 e8             	mov    %r13d,%r8d
+  800f26:	4c 89 e1             	mov    %r12,%rcx
+  800f29:	4c 89 f2             	mov    %r14,%rdx
+  800f2c:	48 bf b0 58 80 00 00 	movabs $0x8058b0,%rdi
+  800f33:	00 00 00 
+  800f36:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f3b:	49 bc 1d 10 80 00 00 	movabs $0x80101d,%r12
+  800f42:	00 00 00 
+  800f45:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800f48:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800f4c:	48 89 df             	mov    %rbx,%rdi
+  800f4f:	48 b8 b9 0f 80 00 00 	movabs $0x800fb9,%rax
+  800f56:	00 00 00 
+  800f59:	ff d0                	call   *%rax
+    cprintf("\n");
+  800f5b:	48 bf 47 55 80 00 00 	movabs $0x805547,%rdi
+  800f62:	00 00 00 
+  800f65:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f6a:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800f6d:	cc                   	int3
+  800f6e:	eb fd                	jmp    800f6d <_panic+0xa0>
+
+0000000000800f70 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800f70:	55                   	push   %rbp
+  800f71:	48 89 e5             	mov    %rsp,%rbp
+  800f74:	53                   	push   %rbx
+  800f75:	48 83 ec 08          	sub    $0x8,%rsp
+  800f79:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800f7c:	8b 06                	mov    (%rsi),%eax
+  800f7e:	8d 50 01             	lea    0x1(%rax),%edx
+  800f81:	89 16                	mov    %edx,(%rsi)
+  800f83:	48 98                	cltq
+  800f85:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800f8a:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800f90:	74 0a                	je     800f9c <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800f92:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800f96:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800f9a:	c9                   	leave
+  800f9b:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800f9c:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800fa0:	be ff 00 00 00       	mov    $0xff,%esi
+  800fa5:	48 b8 69 1d 80 00 00 	movabs $0x801d69,%rax
+  800fac:	00 00 00 
+  800faf:	ff d0                	call   *%rax
+        state->offset = 0;
+  800fb1:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800fb7:	eb d9                	jmp    800f92 <putch+0x22>
+
+0000000000800fb9 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800fb9:	55                   	push   %rbp
+  800fba:	48 89 e5             	mov    %rsp,%rbp
+  800fbd:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800fc4:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800fc7:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800fce:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800fd3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fd8:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800fdb:	48 89 f1             	mov    %rsi,%rcx
+  800fde:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800fe5:	48 bf 70 0f 80 00 00 	movabs $0x800f70,%rdi
+  800fec:	00 00 00 
+  800fef:	48 b8 6d 11 80 00 00 	movabs $0x80116d,%rax
+  800ff6:	00 00 00 
+  800ff9:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800ffb:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  801002:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  801009:	48 b8 69 1d 80 00 00 	movabs $0x801d69,%rax
+  801010:	00 00 00 
+  801013:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  801015:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80101b:	c9                   	leave
+  80101c:	c3                   	ret
+
+000000000080101d <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80101d:	55                   	push   %rbp
+  80101e:	48 89 e5             	mov    %rsp,%rbp
+  801021:	48 83 ec 50          	sub    $0x50,%rsp
+  801025:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801029:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80102d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801031:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801035:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  801039:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  801040:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801044:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801048:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80104c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  801050:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  801054:	48 b8 b9 0f 80 00 00 	movabs $0x800fb9,%rax
+  80105b:	00 00 00 
+  80105e:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  801060:	c9                   	leave
+  801061:	c3                   	ret
+
+0000000000801062 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  801062:	55                   	push   %rbp
+  801063:	48 89 e5             	mov    %rsp,%rbp
+  801066:	41 57                	push   %r15
+  801068:	41 56                	push   %r14
+  80106a:	41 55                	push   %r13
+  80106c:	41 54                	push   %r12
+  80106e:	53                   	push   %rbx
+  80106f:	48 83 ec 18          	sub    $0x18,%rsp
+  801073:	49 89 fc             	mov    %rdi,%r12
+  801076:	49 89 f5             	mov    %rsi,%r13
+  801079:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80107d:	8b 45 10             	mov    0x10(%rbp),%eax
+  801080:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  801083:	41 89 cf             	mov    %ecx,%r15d
+  801086:	4c 39 fa             	cmp    %r15,%rdx
+  801089:	73 5b                	jae    8010e6 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80108b:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80108f:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  801093:	85 db                	test   %ebx,%ebx
+  801095:	7e 0e                	jle    8010a5 <print_num+0x43>
+            putch(padc, put_arg);
+  801097:	4c 89 ee             	mov    %r13,%rsi
+  80109a:	44 89 f7             	mov    %r14d,%edi
+  80109d:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8010a0:	83 eb 01             	sub    $0x1,%ebx
+  8010a3:	75 f2                	jne    801097 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8010a5:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8010a9:	48 b9 e4 58 80 00 00 	movabs $0x8058e4,%rcx
+  8010b0:	00 00 00 
+  8010b3:	48 b8 d3 58 80 00 00 	movabs $0x8058d3,%rax
+  8010ba:	00 00 00 
+  8010bd:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8010c1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8010c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010ca:	49 f7 f7             	div    %r15
+  8010cd:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8010d1:	4c 89 ee             	mov    %r13,%rsi
+  8010d4:	41 ff d4             	call   *%r12
+}
+  8010d7:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8010db:	5b                   	pop    %rbx
+  8010dc:	41 5c                	pop    %r12
+  8010de:	41 5d                	pop    %r13
+  8010e0:	41 5e                	pop    %r14
+  8010e2:	41 5f                	pop    %r15
+  8010e4:	5d                   	pop    %rbp
+  8010e5:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8010e6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8010ea:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010ef:	49 f7 f7             	div    %r15
+  8010f2:	48 83 ec 08          	sub    $0x8,%rsp
+  8010f6:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8010fa:	52                   	push   %rdx
+  8010fb:	45 0f be c9          	movsbl %r9b,%r9d
+  8010ff:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  801103:	48 89 c2             	mov    %rax,%rdx
+  801106:	48 b8 62 10 80 00 00 	movabs $0x801062,%rax
+  80110d:	00 00 00 
+  801110:	ff d0                	call   *%rax
+  801112:	48 83 c4 10          	add    $0x10,%rsp
+  801116:	eb 8d                	jmp    8010a5 <print_num+0x43>
+
+0000000000801118 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  801118:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80111c:	48 8b 06             	mov    (%rsi),%rax
+  80111f:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  801123:	73 0a                	jae    80112f <sprintputch+0x17>
+        *state->start++ = ch;
+  801125:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801129:	48 89 16             	mov    %rdx,(%rsi)
+  80112c:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80112f:	c3                   	ret
+
+0000000000801130 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  801130:	55                   	push   %rbp
+  801131:	48 89 e5             	mov    %rsp,%rbp
+  801134:	48 83 ec 50          	sub    $0x50,%rsp
+  801138:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80113c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801140:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  801144:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80114b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80114f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801153:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801157:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80115b:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80115f:	48 b8 6d 11 80 00 00 	movabs $0x80116d,%rax
+  801166:	00 00 00 
+  801169:	ff d0                	call   *%rax
+}
+  80116b:	c9                   	leave
+  80116c:	c3                   	ret
+
+000000000080116d <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80116d:	55                   	push   %rbp
+  80116e:	48 89 e5             	mov    %rsp,%rbp
+  801171:	41 57                	push   %r15
+  801173:	41 56                	push   %r14
+  801175:	41 55                	push   %r13
+  801177:	41 54                	push   %r12
+  801179:	53                   	push   %rbx
+  80117a:	48 83 ec 38          	sub    $0x38,%rsp
+  80117e:	49 89 fe             	mov    %rdi,%r14
+  801181:	49 89 f5             	mov    %rsi,%r13
+  801184:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  801187:	48 8b 01             	mov    (%rcx),%rax
+  80118a:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80118e:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  801192:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801196:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80119a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80119e:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8011a2:	0f b6 3b             	movzbl (%rbx),%edi
+  8011a5:	40 80 ff 25          	cmp    $0x25,%dil
+  8011a9:	74 18                	je     8011c3 <vprintfmt+0x56>
+            if (!ch) return;
+  8011ab:	40 84 ff             	test   %dil,%dil
+  8011ae:	0f 84 b1 06 00 00    	je     801865 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8011b4:	40 0f b6 ff          	movzbl %dil,%edi
+  8011b8:	4c 89 ee             	mov    %r13,%rsi
+  8011bb:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8011be:	4c 89 e3             	mov    %r12,%rbx
+  8011c1:	eb db                	jmp    80119e <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8011c3:	be 00 00 00 00       	mov    $0x0,%esi
+  8011c8:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8011cc:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8011d1:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8011d7:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8011de:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8011e2:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8011e7:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8011ec:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8011ef:	83 e8 23             	sub    $0x23,%eax
+  8011f2:	3c 57                	cmp    $0x57,%al
+  8011f4:	0f 87 51 06 00 00    	ja     80184b <vprintfmt+0x6de>
+  8011fa:	0f b6 c0             	movzbl %al,%eax
+  8011fd:	48 b9 a0 5a 80 00 00 	movabs $0x805aa0,%rcx
+  801204:	00 00 00 
+  801207:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80120a:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80120d:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  801211:	eb cf                	jmp    8011e2 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  801213:	49 89 dc             	mov    %rbx,%r12
+  801216:	be 01 00 00 00       	mov    $0x1,%esi
+  80121b:	eb c5                	jmp    8011e2 <vprintfmt+0x75>
+            padc = ch;
+  80121d:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  801221:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  801224:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801227:	eb b9                	jmp    8011e2 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  801229:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80122c:	83 f8 2f             	cmp    $0x2f,%eax
+  80122f:	77 24                	ja     801255 <vprintfmt+0xe8>
+  801231:	89 c1                	mov    %eax,%ecx
+  801233:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  801237:	83 c0 08             	add    $0x8,%eax
+  80123a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80123d:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  801240:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  801243:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801247:	79 99                	jns    8011e2 <vprintfmt+0x75>
+                width = precision;
+  801249:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80124d:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801253:	eb 8d                	jmp    8011e2 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  801255:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801259:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80125d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801261:	eb da                	jmp    80123d <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  801263:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  801268:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80126c:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801272:	3c 39                	cmp    $0x39,%al
+  801274:	77 1c                	ja     801292 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  801276:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80127a:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80127e:	0f b6 c0             	movzbl %al,%eax
+  801281:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801286:	0f b6 03             	movzbl (%rbx),%eax
+  801289:	3c 39                	cmp    $0x39,%al
+  80128b:	76 e9                	jbe    801276 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80128d:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801290:	eb b1                	jmp    801243 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  801292:	49 89 dc             	mov    %rbx,%r12
+  801295:	eb ac                	jmp    801243 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  801297:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80129a:	85 c9                	test   %ecx,%ecx
+  80129c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012a1:	0f 49 c1             	cmovns %ecx,%eax
+  8012a4:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8012a7:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8012aa:	e9 33 ff ff ff       	jmp    8011e2 <vprintfmt+0x75>
+            lflag++;
+  8012af:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8012b2:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8012b5:	e9 28 ff ff ff       	jmp    8011e2 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8012ba:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8012bd:	83 f8 2f             	cmp    $0x2f,%eax
+  8012c0:	77 19                	ja     8012db <vprintfmt+0x16e>
+  8012c2:	89 c2                	mov    %eax,%edx
+  8012c4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8012c8:	83 c0 08             	add    $0x8,%eax
+  8012cb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8012ce:	8b 3a                	mov    (%rdx),%edi
+  8012d0:	4c 89 ee             	mov    %r13,%rsi
+  8012d3:	41 ff d6             	call   *%r14
+            break;
+  8012d6:	e9 c3 fe ff ff       	jmp    80119e <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8012db:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8012df:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8012e3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8012e7:	eb e5                	jmp    8012ce <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8012e9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8012ec:	83 f8 2f             	cmp    $0x2f,%eax
+  8012ef:	77 5a                	ja     80134b <vprintfmt+0x1de>
+  8012f1:	89 c2                	mov    %eax,%edx
+  8012f3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8012f7:	83 c0 08             	add    $0x8,%eax
+  8012fa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8012fd:	8b 02                	mov    (%rdx),%eax
+  8012ff:	89 c1                	mov    %eax,%ecx
+  801301:	f7 d9                	neg    %ecx
+  801303:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  801306:	83 f9 16             	cmp    $0x16,%ecx
+  801309:	7f 4e                	jg     801359 <vprintfmt+0x1ec>
+  80130b:	48 63 c1             	movslq %ecx,%rax
+  80130e:	48 ba 60 5d 80 00 00 	movabs $0x805d60,%rdx
+  801315:	00 00 00 
+  801318:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80131c:	48 85 c0             	test   %rax,%rax
+  80131f:	74 38                	je     801359 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  801321:	48 89 c1             	mov    %rax,%rcx
+  801324:	48 ba 59 5f 80 00 00 	movabs $0x805f59,%rdx
+  80132b:	00 00 00 
+  80132e:	4c 89 ee             	mov    %r13,%rsi
+  801331:	4c 89 f7             	mov    %r14,%rdi
+  801334:	b8 00 00 00 00       	mov    $0x0,%eax
+  801339:	49 b8 30 11 80 00 00 	movabs $0x801130,%r8
+  801340:	00 00 00 
+  801343:	41 ff d0             	call   *%r8
+  801346:	e9 53 fe ff ff       	jmp    80119e <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80134b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80134f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801353:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801357:	eb a4                	jmp    8012fd <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  801359:	48 ba fc 58 80 00 00 	movabs $0x8058fc,%rdx
+  801360:	00 00 00 
+  801363:	4c 89 ee             	mov    %r13,%rsi
+  801366:	4c 89 f7             	mov    %r14,%rdi
+  801369:	b8 00 00 00 00       	mov    $0x0,%eax
+  80136e:	49 b8 30 11 80 00 00 	movabs $0x801130,%r8
+  801375:	00 00 00 
+  801378:	41 ff d0             	call   *%r8
+  80137b:	e9 1e fe ff ff       	jmp    80119e <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  801380:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801383:	83 f8 2f             	cmp    $0x2f,%eax
+  801386:	77 6c                	ja     8013f4 <vprintfmt+0x287>
+  801388:	89 c2                	mov    %eax,%edx
+  80138a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80138e:	83 c0 08             	add    $0x8,%eax
+  801391:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801394:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  801397:	48 85 d2             	test   %rdx,%rdx
+  80139a:	48 b8 f5 58 80 00 00 	movabs $0x8058f5,%rax
+  8013a1:	00 00 00 
+  8013a4:	48 0f 45 c2          	cmovne %rdx,%rax
+  8013a8:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8013ac:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8013b0:	7e 06                	jle    8013b8 <vprintfmt+0x24b>
+  8013b2:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8013b6:	75 4a                	jne    801402 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8013b8:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8013bc:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8013c0:	0f b6 00             	movzbl (%rax),%eax
+  8013c3:	84 c0                	test   %al,%al
+  8013c5:	0f 85 9a 00 00 00    	jne    801465 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8013cb:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8013ce:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8013d2:	85 c0                	test   %eax,%eax
+  8013d4:	0f 8e c4 fd ff ff    	jle    80119e <vprintfmt+0x31>
+  8013da:	4c 89 ee             	mov    %r13,%rsi
+  8013dd:	bf 20 00 00 00       	mov    $0x20,%edi
+  8013e2:	41 ff d6             	call   *%r14
+  8013e5:	41 83 ec 01          	sub    $0x1,%r12d
+  8013e9:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8013ed:	75 eb                	jne    8013da <vprintfmt+0x26d>
+  8013ef:	e9 aa fd ff ff       	jmp    80119e <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8013f4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8013f8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8013fc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801400:	eb 92                	jmp    801394 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  801402:	49 63 f7             	movslq %r15d,%rsi
+  801405:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  801409:	48 b8 1f 19 80 00 00 	movabs $0x80191f,%rax
+  801410:	00 00 00 
+  801413:	ff d0                	call   *%rax
+  801415:	48 89 c2             	mov    %rax,%rdx
+  801418:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80141b:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80141d:	8d 70 ff             	lea    -0x1(%rax),%esi
+  801420:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  801423:	85 c0                	test   %eax,%eax
+  801425:	7e 91                	jle    8013b8 <vprintfmt+0x24b>
+  801427:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80142c:	4c 89 ee             	mov    %r13,%rsi
+  80142f:	44 89 e7             	mov    %r12d,%edi
+  801432:	41 ff d6             	call   *%r14
+  801435:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801439:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80143c:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80143f:	75 eb                	jne    80142c <vprintfmt+0x2bf>
+  801441:	e9 72 ff ff ff       	jmp    8013b8 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801446:	0f b6 f8             	movzbl %al,%edi
+  801449:	4c 89 ee             	mov    %r13,%rsi
+  80144c:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80144f:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801453:	49 83 c4 01          	add    $0x1,%r12
+  801457:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80145d:	84 c0                	test   %al,%al
+  80145f:	0f 84 66 ff ff ff    	je     8013cb <vprintfmt+0x25e>
+  801465:	45 85 ff             	test   %r15d,%r15d
+  801468:	78 0a                	js     801474 <vprintfmt+0x307>
+  80146a:	41 83 ef 01          	sub    $0x1,%r15d
+  80146e:	0f 88 57 ff ff ff    	js     8013cb <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801474:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801478:	74 cc                	je     801446 <vprintfmt+0x2d9>
+  80147a:	8d 50 e0             	lea    -0x20(%rax),%edx
+  80147d:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801482:	80 fa 5e             	cmp    $0x5e,%dl
+  801485:	77 c2                	ja     801449 <vprintfmt+0x2dc>
+  801487:	eb bd                	jmp    801446 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  801489:	40 84 f6             	test   %sil,%sil
+  80148c:	75 26                	jne    8014b4 <vprintfmt+0x347>
+    switch (lflag) {
+  80148e:	85 d2                	test   %edx,%edx
+  801490:	74 59                	je     8014eb <vprintfmt+0x37e>
+  801492:	83 fa 01             	cmp    $0x1,%edx
+  801495:	74 7b                	je     801512 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  801497:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80149a:	83 f8 2f             	cmp    $0x2f,%eax
+  80149d:	0f 87 96 00 00 00    	ja     801539 <vprintfmt+0x3cc>
+  8014a3:	89 c2                	mov    %eax,%edx
+  8014a5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8014a9:	83 c0 08             	add    $0x8,%eax
+  8014ac:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8014af:	4c 8b 22             	mov    (%rdx),%r12
+  8014b2:	eb 17                	jmp    8014cb <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8014b4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8014b7:	83 f8 2f             	cmp    $0x2f,%eax
+  8014ba:	77 21                	ja     8014dd <vprintfmt+0x370>
+  8014bc:	89 c2                	mov    %eax,%edx
+  8014be:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8014c2:	83 c0 08             	add    $0x8,%eax
+  8014c5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8014c8:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8014cb:	4d 85 e4             	test   %r12,%r12
+  8014ce:	78 7a                	js     80154a <vprintfmt+0x3dd>
+            num = i;
+  8014d0:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8014d3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8014d8:	e9 50 02 00 00       	jmp    80172d <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8014dd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8014e1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8014e5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014e9:	eb dd                	jmp    8014c8 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8014eb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8014ee:	83 f8 2f             	cmp    $0x2f,%eax
+  8014f1:	77 11                	ja     801504 <vprintfmt+0x397>
+  8014f3:	89 c2                	mov    %eax,%edx
+  8014f5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8014f9:	83 c0 08             	add    $0x8,%eax
+  8014fc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8014ff:	4c 63 22             	movslq (%rdx),%r12
+  801502:	eb c7                	jmp    8014cb <vprintfmt+0x35e>
+  801504:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801508:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80150c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801510:	eb ed                	jmp    8014ff <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  801512:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801515:	83 f8 2f             	cmp    $0x2f,%eax
+  801518:	77 11                	ja     80152b <vprintfmt+0x3be>
+  80151a:	89 c2                	mov    %eax,%edx
+  80151c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801520:	83 c0 08             	add    $0x8,%eax
+  801523:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801526:	4c 8b 22             	mov    (%rdx),%r12
+  801529:	eb a0                	jmp    8014cb <vprintfmt+0x35e>
+  80152b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80152f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801533:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801537:	eb ed                	jmp    801526 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  801539:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80153d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801541:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801545:	e9 65 ff ff ff       	jmp    8014af <vprintfmt+0x342>
+                putch('-', put_arg);
+  80154a:	4c 89 ee             	mov    %r13,%rsi
+  80154d:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801552:	41 ff d6             	call   *%r14
+                i = -i;
+  801555:	49 f7 dc             	neg    %r12
+  801558:	e9 73 ff ff ff       	jmp    8014d0 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  80155d:	40 84 f6             	test   %sil,%sil
+  801560:	75 32                	jne    801594 <vprintfmt+0x427>
+    switch (lflag) {
+  801562:	85 d2                	test   %edx,%edx
+  801564:	74 5d                	je     8015c3 <vprintfmt+0x456>
+  801566:	83 fa 01             	cmp    $0x1,%edx
+  801569:	0f 84 82 00 00 00    	je     8015f1 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  80156f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801572:	83 f8 2f             	cmp    $0x2f,%eax
+  801575:	0f 87 a5 00 00 00    	ja     801620 <vprintfmt+0x4b3>
+  80157b:	89 c2                	mov    %eax,%edx
+  80157d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801581:	83 c0 08             	add    $0x8,%eax
+  801584:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801587:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80158a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  80158f:	e9 99 01 00 00       	jmp    80172d <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  801594:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801597:	83 f8 2f             	cmp    $0x2f,%eax
+  80159a:	77 19                	ja     8015b5 <vprintfmt+0x448>
+  80159c:	89 c2                	mov    %eax,%edx
+  80159e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8015a2:	83 c0 08             	add    $0x8,%eax
+  8015a5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8015a8:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8015ab:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8015b0:	e9 78 01 00 00       	jmp    80172d <vprintfmt+0x5c0>
+  8015b5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8015b9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8015bd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8015c1:	eb e5                	jmp    8015a8 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8015c3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8015c6:	83 f8 2f             	cmp    $0x2f,%eax
+  8015c9:	77 18                	ja     8015e3 <vprintfmt+0x476>
+  8015cb:	89 c2                	mov    %eax,%edx
+  8015cd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8015d1:	83 c0 08             	add    $0x8,%eax
+  8015d4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8015d7:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8015d9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8015de:	e9 4a 01 00 00       	jmp    80172d <vprintfmt+0x5c0>
+  8015e3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8015e7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8015eb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8015ef:	eb e6                	jmp    8015d7 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8015f1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8015f4:	83 f8 2f             	cmp    $0x2f,%eax
+  8015f7:	77 19                	ja     801612 <vprintfmt+0x4a5>
+  8015f9:	89 c2                	mov    %eax,%edx
+  8015fb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8015ff:	83 c0 08             	add    $0x8,%eax
+  801602:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801605:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801608:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  80160d:	e9 1b 01 00 00       	jmp    80172d <vprintfmt+0x5c0>
+  801612:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801616:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80161a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80161e:	eb e5                	jmp    801605 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  801620:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801624:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801628:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80162c:	e9 56 ff ff ff       	jmp    801587 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  801631:	40 84 f6             	test   %sil,%sil
+  801634:	75 2e                	jne    801664 <vprintfmt+0x4f7>
+    switch (lflag) {
+  801636:	85 d2                	test   %edx,%edx
+  801638:	74 59                	je     801693 <vprintfmt+0x526>
+  80163a:	83 fa 01             	cmp    $0x1,%edx
+  80163d:	74 7f                	je     8016be <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  80163f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801642:	83 f8 2f             	cmp    $0x2f,%eax
+  801645:	0f 87 9f 00 00 00    	ja     8016ea <vprintfmt+0x57d>
+  80164b:	89 c2                	mov    %eax,%edx
+  80164d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801651:	83 c0 08             	add    $0x8,%eax
+  801654:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801657:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80165a:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  80165f:	e9 c9 00 00 00       	jmp    80172d <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  801664:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801667:	83 f8 2f             	cmp    $0x2f,%eax
+  80166a:	77 19                	ja     801685 <vprintfmt+0x518>
+  80166c:	89 c2                	mov    %eax,%edx
+  80166e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801672:	83 c0 08             	add    $0x8,%eax
+  801675:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801678:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80167b:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801680:	e9 a8 00 00 00       	jmp    80172d <vprintfmt+0x5c0>
+  801685:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801689:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80168d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801691:	eb e5                	jmp    801678 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  801693:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801696:	83 f8 2f             	cmp    $0x2f,%eax
+  801699:	77 15                	ja     8016b0 <vprintfmt+0x543>
+  80169b:	89 c2                	mov    %eax,%edx
+  80169d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8016a1:	83 c0 08             	add    $0x8,%eax
+  8016a4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8016a7:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8016a9:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8016ae:	eb 7d                	jmp    80172d <vprintfmt+0x5c0>
+  8016b0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8016b4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8016b8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8016bc:	eb e9                	jmp    8016a7 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  8016be:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8016c1:	83 f8 2f             	cmp    $0x2f,%eax
+  8016c4:	77 16                	ja     8016dc <vprintfmt+0x56f>
+  8016c6:	89 c2                	mov    %eax,%edx
+  8016c8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8016cc:	83 c0 08             	add    $0x8,%eax
+  8016cf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8016d2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8016d5:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  8016da:	eb 51                	jmp    80172d <vprintfmt+0x5c0>
+  8016dc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8016e0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8016e4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8016e8:	eb e8                	jmp    8016d2 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  8016ea:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8016ee:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8016f2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8016f6:	e9 5c ff ff ff       	jmp    801657 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8016fb:	4c 89 ee             	mov    %r13,%rsi
+  8016fe:	bf 30 00 00 00       	mov    $0x30,%edi
+  801703:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  801706:	4c 89 ee             	mov    %r13,%rsi
+  801709:	bf 78 00 00 00       	mov    $0x78,%edi
+  80170e:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  801711:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801714:	83 f8 2f             	cmp    $0x2f,%eax
+  801717:	77 47                	ja     801760 <vprintfmt+0x5f3>
+  801719:	89 c2                	mov    %eax,%edx
+  80171b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80171f:	83 c0 08             	add    $0x8,%eax
+  801722:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801725:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801728:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  80172d:	48 83 ec 08          	sub    $0x8,%rsp
+  801731:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  801735:	0f 94 c0             	sete   %al
+  801738:	0f b6 c0             	movzbl %al,%eax
+  80173b:	50                   	push   %rax
+  80173c:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  801741:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  801745:	4c 89 ee             	mov    %r13,%rsi
+  801748:	4c 89 f7             	mov    %r14,%rdi
+  80174b:	48 b8 62 10 80 00 00 	movabs $0x801062,%rax
+  801752:	00 00 00 
+  801755:	ff d0                	call   *%rax
+            break;
+  801757:	48 83 c4 10          	add    $0x10,%rsp
+  80175b:	e9 3e fa ff ff       	jmp    80119e <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  801760:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801764:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801768:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80176c:	eb b7                	jmp    801725 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  80176e:	40 84 f6             	test   %sil,%sil
+  801771:	75 2b                	jne    80179e <vprintfmt+0x631>
+    switch (lflag) {
+  801773:	85 d2                	test   %edx,%edx
+  801775:	74 56                	je     8017cd <vprintfmt+0x660>
+  801777:	83 fa 01             	cmp    $0x1,%edx
+  80177a:	74 7f                	je     8017fb <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  80177c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80177f:	83 f8 2f             	cmp    $0x2f,%eax
+  801782:	0f 87 a2 00 00 00    	ja     80182a <vprintfmt+0x6bd>
+  801788:	89 c2                	mov    %eax,%edx
+  80178a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80178e:	83 c0 08             	add    $0x8,%eax
+  801791:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801794:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801797:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  80179c:	eb 8f                	jmp    80172d <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80179e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8017a1:	83 f8 2f             	cmp    $0x2f,%eax
+  8017a4:	77 19                	ja     8017bf <vprintfmt+0x652>
+  8017a6:	89 c2                	mov    %eax,%edx
+  8017a8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8017ac:	83 c0 08             	add    $0x8,%eax
+  8017af:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8017b2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8017b5:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8017ba:	e9 6e ff ff ff       	jmp    80172d <vprintfmt+0x5c0>
+  8017bf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8017c3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8017c7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8017cb:	eb e5                	jmp    8017b2 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  8017cd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8017d0:	83 f8 2f             	cmp    $0x2f,%eax
+  8017d3:	77 18                	ja     8017ed <vprintfmt+0x680>
+  8017d5:	89 c2                	mov    %eax,%edx
+  8017d7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8017db:	83 c0 08             	add    $0x8,%eax
+  8017de:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8017e1:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8017e3:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8017e8:	e9 40 ff ff ff       	jmp    80172d <vprintfmt+0x5c0>
+  8017ed:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8017f1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8017f5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8017f9:	eb e6                	jmp    8017e1 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  8017fb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8017fe:	83 f8 2f             	cmp    $0x2f,%eax
+  801801:	77 19                	ja     80181c <vprintfmt+0x6af>
+  801803:	89 c2                	mov    %eax,%edx
+  801805:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801809:	83 c0 08             	add    $0x8,%eax
+  80180c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80180f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801812:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  801817:	e9 11 ff ff ff       	jmp    80172d <vprintfmt+0x5c0>
+  80181c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801820:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801824:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801828:	eb e5                	jmp    80180f <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  80182a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80182e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801832:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801836:	e9 59 ff ff ff       	jmp    801794 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  80183b:	4c 89 ee             	mov    %r13,%rsi
+  80183e:	bf 25 00 00 00       	mov    $0x25,%edi
+  801843:	41 ff d6             	call   *%r14
+            break;
+  801846:	e9 53 f9 ff ff       	jmp    80119e <vprintfmt+0x31>
+            putch('%', put_arg);
+  80184b:	4c 89 ee             	mov    %r13,%rsi
+  80184e:	bf 25 00 00 00       	mov    $0x25,%edi
+  801853:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  801856:	48 83 eb 01          	sub    $0x1,%rbx
+  80185a:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  80185e:	75 f6                	jne    801856 <vprintfmt+0x6e9>
+  801860:	e9 39 f9 ff ff       	jmp    80119e <vprintfmt+0x31>
+}
+  801865:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801869:	5b                   	pop    %rbx
+  80186a:	41 5c                	pop    %r12
+  80186c:	41 5d                	pop    %r13
+  80186e:	41 5e                	pop    %r14
+  801870:	41 5f                	pop    %r15
+  801872:	5d                   	pop    %rbp
+  801873:	c3                   	ret
+
+0000000000801874 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  801874:	55                   	push   %rbp
+  801875:	48 89 e5             	mov    %rsp,%rbp
+  801878:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  80187c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801880:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  801885:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  801889:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  801890:	48 85 ff             	test   %rdi,%rdi
+  801893:	74 2b                	je     8018c0 <vsnprintf+0x4c>
+  801895:	48 85 f6             	test   %rsi,%rsi
+  801898:	74 26                	je     8018c0 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  80189a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80189e:	48 bf 18 11 80 00 00 	movabs $0x801118,%rdi
+  8018a5:	00 00 00 
+  8018a8:	48 b8 6d 11 80 00 00 	movabs $0x80116d,%rax
+  8018af:	00 00 00 
+  8018b2:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  8018b4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018b8:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  8018bb:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8018be:	c9                   	leave
+  8018bf:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  8018c0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018c5:	eb f7                	jmp    8018be <vsnprintf+0x4a>
+
+00000000008018c7 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  8018c7:	55                   	push   %rbp
+  8018c8:	48 89 e5             	mov    %rsp,%rbp
+  8018cb:	48 83 ec 50          	sub    $0x50,%rsp
+  8018cf:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8018d3:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8018d7:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8018db:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8018e2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8018e6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8018ea:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8018ee:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  8018f2:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8018f6:	48 b8 74 18 80 00 00 	movabs $0x801874,%rax
+  8018fd:	00 00 00 
+  801900:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  801902:	c9                   	leave
+  801903:	c3                   	ret
+
+0000000000801904 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  801904:	80 3f 00             	cmpb   $0x0,(%rdi)
+  801907:	74 10                	je     801919 <strlen+0x15>
+    size_t n = 0;
+  801909:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  80190e:	48 83 c0 01          	add    $0x1,%rax
+  801912:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  801916:	75 f6                	jne    80190e <strlen+0xa>
+  801918:	c3                   	ret
+    size_t n = 0;
+  801919:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  80191e:	c3                   	ret
+
+000000000080191f <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  80191f:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  801922:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  801927:	48 85 f6             	test   %rsi,%rsi
+  80192a:	74 11                	je     80193d <strnlen+0x1e>
+  80192c:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  801930:	74 0c                	je     80193e <strnlen+0x1f>
+  801932:	48 83 c2 01          	add    $0x1,%rdx
+  801936:	48 39 d0             	cmp    %rdx,%rax
+  801939:	75 f1                	jne    80192c <strnlen+0xd>
+  80193b:	eb 04                	jmp    801941 <strnlen+0x22>
+  80193d:	c3                   	ret
+  80193e:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  801941:	c3                   	ret
+
+0000000000801942 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  801942:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  801945:	ba 00 00 00 00       	mov    $0x0,%edx
+  80194a:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  80194e:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  801951:	48 83 c2 01          	add    $0x1,%rdx
+  801955:	84 c9                	test   %cl,%cl
+  801957:	75 f1                	jne    80194a <strcpy+0x8>
+        ;
+    return res;
+}
+  801959:	c3                   	ret
+
+000000000080195a <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  80195a:	55                   	push   %rbp
+  80195b:	48 89 e5             	mov    %rsp,%rbp
+  80195e:	41 54                	push   %r12
+  801960:	53                   	push   %rbx
+  801961:	48 89 fb             	mov    %rdi,%rbx
+  801964:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  801967:	48 b8 04 19 80 00 00 	movabs $0x801904,%rax
+  80196e:	00 00 00 
+  801971:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  801973:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  801977:	4c 89 e6             	mov    %r12,%rsi
+  80197a:	48 b8 42 19 80 00 00 	movabs $0x801942,%rax
+  801981:	00 00 00 
+  801984:	ff d0                	call   *%rax
+    return dst;
+}
+  801986:	48 89 d8             	mov    %rbx,%rax
+  801989:	5b                   	pop    %rbx
+  80198a:	41 5c                	pop    %r12
+  80198c:	5d                   	pop    %rbp
+  80198d:	c3                   	ret
+
+000000000080198e <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80198e:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  801991:	48 85 d2             	test   %rdx,%rdx
+  801994:	74 1f                	je     8019b5 <strncpy+0x27>
+  801996:	48 01 fa             	add    %rdi,%rdx
+  801999:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  80199c:	48 83 c1 01          	add    $0x1,%rcx
+  8019a0:	44 0f b6 06          	movzbl (%rsi),%r8d
+  8019a4:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  8019a8:	41 80 f8 01          	cmp    $0x1,%r8b
+  8019ac:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  8019b0:	48 39 ca             	cmp    %rcx,%rdx
+  8019b3:	75 e7                	jne    80199c <strncpy+0xe>
+    }
+    return ret;
+}
+  8019b5:	c3                   	ret
+
+00000000008019b6 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  8019b6:	48 89 f8             	mov    %rdi,%rax
+  8019b9:	48 85 d2             	test   %rdx,%rdx
+  8019bc:	74 24                	je     8019e2 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  8019be:	48 83 ea 01          	sub    $0x1,%rdx
+  8019c2:	74 1b                	je     8019df <strlcpy+0x29>
+  8019c4:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  8019c8:	0f b6 16             	movzbl (%rsi),%edx
+  8019cb:	84 d2                	test   %dl,%dl
+  8019cd:	74 10                	je     8019df <strlcpy+0x29>
+            *dst++ = *src++;
+  8019cf:	48 83 c6 01          	add    $0x1,%rsi
+  8019d3:	48 83 c0 01          	add    $0x1,%rax
+  8019d7:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  8019da:	48 39 c8             	cmp    %rcx,%rax
+  8019dd:	75 e9                	jne    8019c8 <strlcpy+0x12>
+        *dst = '\0';
+  8019df:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  8019e2:	48 29 f8             	sub    %rdi,%rax
+}
+  8019e5:	c3                   	ret
+
+00000000008019e6 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  8019e6:	0f b6 07             	movzbl (%rdi),%eax
+  8019e9:	84 c0                	test   %al,%al
+  8019eb:	74 13                	je     801a00 <strcmp+0x1a>
+  8019ed:	38 06                	cmp    %al,(%rsi)
+  8019ef:	75 0f                	jne    801a00 <strcmp+0x1a>
+  8019f1:	48 83 c7 01          	add    $0x1,%rdi
+  8019f5:	48 83 c6 01          	add    $0x1,%rsi
+  8019f9:	0f b6 07             	movzbl (%rdi),%eax
+  8019fc:	84 c0                	test   %al,%al
+  8019fe:	75 ed                	jne    8019ed <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801a00:	0f b6 c0             	movzbl %al,%eax
+  801a03:	0f b6 16             	movzbl (%rsi),%edx
+  801a06:	29 d0                	sub    %edx,%eax
+}
+  801a08:	c3                   	ret
+
+0000000000801a09 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  801a09:	48 85 d2             	test   %rdx,%rdx
+  801a0c:	74 1f                	je     801a2d <strncmp+0x24>
+  801a0e:	0f b6 07             	movzbl (%rdi),%eax
+  801a11:	84 c0                	test   %al,%al
+  801a13:	74 1e                	je     801a33 <strncmp+0x2a>
+  801a15:	3a 06                	cmp    (%rsi),%al
+  801a17:	75 1a                	jne    801a33 <strncmp+0x2a>
+  801a19:	48 83 c7 01          	add    $0x1,%rdi
+  801a1d:	48 83 c6 01          	add    $0x1,%rsi
+  801a21:	48 83 ea 01          	sub    $0x1,%rdx
+  801a25:	75 e7                	jne    801a0e <strncmp+0x5>
+
+    if (!n) return 0;
+  801a27:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a2c:	c3                   	ret
+  801a2d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a32:	c3                   	ret
+  801a33:	48 85 d2             	test   %rdx,%rdx
+  801a36:	74 09                	je     801a41 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801a38:	0f b6 07             	movzbl (%rdi),%eax
+  801a3b:	0f b6 16             	movzbl (%rsi),%edx
+  801a3e:	29 d0                	sub    %edx,%eax
+  801a40:	c3                   	ret
+    if (!n) return 0;
+  801a41:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a46:	c3                   	ret
+
+0000000000801a47 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  801a47:	0f b6 17             	movzbl (%rdi),%edx
+  801a4a:	84 d2                	test   %dl,%dl
+  801a4c:	74 18                	je     801a66 <strchr+0x1f>
+        if (*str == c) {
+  801a4e:	0f be d2             	movsbl %dl,%edx
+  801a51:	39 f2                	cmp    %esi,%edx
+  801a53:	74 17                	je     801a6c <strchr+0x25>
+    for (; *str; str++) {
+  801a55:	48 83 c7 01          	add    $0x1,%rdi
+  801a59:	0f b6 17             	movzbl (%rdi),%edx
+  801a5c:	84 d2                	test   %dl,%dl
+  801a5e:	75 ee                	jne    801a4e <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  801a60:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a65:	c3                   	ret
+  801a66:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a6b:	c3                   	ret
+  801a6c:	48 89 f8             	mov    %rdi,%rax
+}
+  801a6f:	c3                   	ret
+
+0000000000801a70 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  801a70:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  801a73:	0f b6 17             	movzbl (%rdi),%edx
+  801a76:	84 d2                	test   %dl,%dl
+  801a78:	74 13                	je     801a8d <strfind+0x1d>
+  801a7a:	0f be d2             	movsbl %dl,%edx
+  801a7d:	39 f2                	cmp    %esi,%edx
+  801a7f:	74 0b                	je     801a8c <strfind+0x1c>
+  801a81:	48 83 c0 01          	add    $0x1,%rax
+  801a85:	0f b6 10             	movzbl (%rax),%edx
+  801a88:	84 d2                	test   %dl,%dl
+  801a8a:	75 ee                	jne    801a7a <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  801a8c:	c3                   	ret
+  801a8d:	c3                   	ret
+
+0000000000801a8e <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  801a8e:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  801a91:	48 89 f8             	mov    %rdi,%rax
+  801a94:	48 f7 d8             	neg    %rax
+  801a97:	83 e0 07             	and    $0x7,%eax
+  801a9a:	49 89 d1             	mov    %rdx,%r9
+  801a9d:	49 29 c1             	sub    %rax,%r9
+  801aa0:	78 36                	js     801ad8 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  801aa2:	40 0f b6 c6          	movzbl %sil,%eax
+  801aa6:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  801aad:	01 01 01 
+  801ab0:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  801ab4:	40 f6 c7 07          	test   $0x7,%dil
+  801ab8:	75 38                	jne    801af2 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  801aba:	4c 89 c9             	mov    %r9,%rcx
+  801abd:	48 c1 f9 03          	sar    $0x3,%rcx
+  801ac1:	74 0c                	je     801acf <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  801ac3:	fc                   	cld
+  801ac4:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  801ac7:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  801acb:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  801acf:	4d 85 c9             	test   %r9,%r9
+  801ad2:	75 45                	jne    801b19 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  801ad4:	4c 89 c0             	mov    %r8,%rax
+  801ad7:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  801ad8:	48 85 d2             	test   %rdx,%rdx
+  801adb:	74 f7                	je     801ad4 <memset+0x46>
+  801add:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  801ae0:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  801ae3:	48 83 c0 01          	add    $0x1,%rax
+  801ae7:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  801aeb:	48 39 c2             	cmp    %rax,%rdx
+  801aee:	75 f3                	jne    801ae3 <memset+0x55>
+  801af0:	eb e2                	jmp    801ad4 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  801af2:	40 f6 c7 01          	test   $0x1,%dil
+  801af6:	74 06                	je     801afe <memset+0x70>
+  801af8:	88 07                	mov    %al,(%rdi)
+  801afa:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801afe:	40 f6 c7 02          	test   $0x2,%dil
+  801b02:	74 07                	je     801b0b <memset+0x7d>
+  801b04:	66 89 07             	mov    %ax,(%rdi)
+  801b07:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801b0b:	40 f6 c7 04          	test   $0x4,%dil
+  801b0f:	74 a9                	je     801aba <memset+0x2c>
+  801b11:	89 07                	mov    %eax,(%rdi)
+  801b13:	48 83 c7 04          	add    $0x4,%rdi
+  801b17:	eb a1                	jmp    801aba <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801b19:	41 f6 c1 04          	test   $0x4,%r9b
+  801b1d:	74 06                	je     801b25 <memset+0x97>
+  801b1f:	89 07                	mov    %eax,(%rdi)
+  801b21:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801b25:	41 f6 c1 02          	test   $0x2,%r9b
+  801b29:	74 07                	je     801b32 <memset+0xa4>
+  801b2b:	66 89 07             	mov    %ax,(%rdi)
+  801b2e:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  801b32:	41 f6 c1 01          	test   $0x1,%r9b
+  801b36:	74 9c                	je     801ad4 <memset+0x46>
+  801b38:	88 07                	mov    %al,(%rdi)
+  801b3a:	eb 98                	jmp    801ad4 <memset+0x46>
+
+0000000000801b3c <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  801b3c:	48 89 f8             	mov    %rdi,%rax
+  801b3f:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  801b42:	48 39 fe             	cmp    %rdi,%rsi
+  801b45:	73 3b                	jae    801b82 <memmove+0x46>
+  801b47:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  801b4b:	48 39 d7             	cmp    %rdx,%rdi
+  801b4e:	73 32                	jae    801b82 <memmove+0x46>
+        s += n;
+        d += n;
+  801b50:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801b54:	48 89 d6             	mov    %rdx,%rsi
+  801b57:	48 09 fe             	or     %rdi,%rsi
+  801b5a:	48 09 ce             	or     %rcx,%rsi
+  801b5d:	40 f6 c6 07          	test   $0x7,%sil
+  801b61:	75 12                	jne    801b75 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  801b63:	48 83 ef 08          	sub    $0x8,%rdi
+  801b67:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  801b6b:	48 c1 e9 03          	shr    $0x3,%rcx
+  801b6f:	fd                   	std
+  801b70:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  801b73:	fc                   	cld
+  801b74:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801b75:	48 83 ef 01          	sub    $0x1,%rdi
+  801b79:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  801b7d:	fd                   	std
+  801b7e:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801b80:	eb f1                	jmp    801b73 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801b82:	48 89 f2             	mov    %rsi,%rdx
+  801b85:	48 09 c2             	or     %rax,%rdx
+  801b88:	48 09 ca             	or     %rcx,%rdx
+  801b8b:	f6 c2 07             	test   $0x7,%dl
+  801b8e:	75 0c                	jne    801b9c <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801b90:	48 c1 e9 03          	shr    $0x3,%rcx
+  801b94:	48 89 c7             	mov    %rax,%rdi
+  801b97:	fc                   	cld
+  801b98:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801b9b:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801b9c:	48 89 c7             	mov    %rax,%rdi
+  801b9f:	fc                   	cld
+  801ba0:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801ba2:	c3                   	ret
+
+0000000000801ba3 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801ba3:	55                   	push   %rbp
+  801ba4:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801ba7:	48 b8 3c 1b 80 00 00 	movabs $0x801b3c,%rax
+  801bae:	00 00 00 
+  801bb1:	ff d0                	call   *%rax
+}
+  801bb3:	5d                   	pop    %rbp
+  801bb4:	c3                   	ret
+
+0000000000801bb5 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801bb5:	55                   	push   %rbp
+  801bb6:	48 89 e5             	mov    %rsp,%rbp
+  801bb9:	41 57                	push   %r15
+  801bbb:	41 56                	push   %r14
+  801bbd:	41 55                	push   %r13
+  801bbf:	41 54                	push   %r12
+  801bc1:	53                   	push   %rbx
+  801bc2:	48 83 ec 08          	sub    $0x8,%rsp
+  801bc6:	49 89 fe             	mov    %rdi,%r14
+  801bc9:	49 89 f7             	mov    %rsi,%r15
+  801bcc:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801bcf:	48 89 f7             	mov    %rsi,%rdi
+  801bd2:	48 b8 04 19 80 00 00 	movabs $0x801904,%rax
+  801bd9:	00 00 00 
+  801bdc:	ff d0                	call   *%rax
+  801bde:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801be1:	48 89 de             	mov    %rbx,%rsi
+  801be4:	4c 89 f7             	mov    %r14,%rdi
+  801be7:	48 b8 1f 19 80 00 00 	movabs $0x80191f,%rax
+  801bee:	00 00 00 
+  801bf1:	ff d0                	call   *%rax
+  801bf3:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801bf6:	48 39 c3             	cmp    %rax,%rbx
+  801bf9:	74 36                	je     801c31 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801bfb:	48 89 d8             	mov    %rbx,%rax
+  801bfe:	4c 29 e8             	sub    %r13,%rax
+  801c01:	49 39 c4             	cmp    %rax,%r12
+  801c04:	73 31                	jae    801c37 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801c06:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801c0b:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801c0f:	4c 89 fe             	mov    %r15,%rsi
+  801c12:	48 b8 a3 1b 80 00 00 	movabs $0x801ba3,%rax
+  801c19:	00 00 00 
+  801c1c:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801c1e:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801c22:	48 83 c4 08          	add    $0x8,%rsp
+  801c26:	5b                   	pop    %rbx
+  801c27:	41 5c                	pop    %r12
+  801c29:	41 5d                	pop    %r13
+  801c2b:	41 5e                	pop    %r14
+  801c2d:	41 5f                	pop    %r15
+  801c2f:	5d                   	pop    %rbp
+  801c30:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801c31:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801c35:	eb eb                	jmp    801c22 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801c37:	48 83 eb 01          	sub    $0x1,%rbx
+  801c3b:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801c3f:	48 89 da             	mov    %rbx,%rdx
+  801c42:	4c 89 fe             	mov    %r15,%rsi
+  801c45:	48 b8 a3 1b 80 00 00 	movabs $0x801ba3,%rax
+  801c4c:	00 00 00 
+  801c4f:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801c51:	49 01 de             	add    %rbx,%r14
+  801c54:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801c59:	eb c3                	jmp    801c1e <strlcat+0x69>
+
+0000000000801c5b <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801c5b:	48 85 d2             	test   %rdx,%rdx
+  801c5e:	74 2d                	je     801c8d <memcmp+0x32>
+  801c60:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801c65:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801c69:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801c6e:	44 38 c1             	cmp    %r8b,%cl
+  801c71:	75 0f                	jne    801c82 <memcmp+0x27>
+    while (n-- > 0) {
+  801c73:	48 83 c0 01          	add    $0x1,%rax
+  801c77:	48 39 c2             	cmp    %rax,%rdx
+  801c7a:	75 e9                	jne    801c65 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801c7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c81:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801c82:	0f b6 c1             	movzbl %cl,%eax
+  801c85:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801c89:	44 29 c0             	sub    %r8d,%eax
+  801c8c:	c3                   	ret
+    return 0;
+  801c8d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c92:	c3                   	ret
+
+0000000000801c93 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801c93:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801c97:	48 39 c7             	cmp    %rax,%rdi
+  801c9a:	73 0f                	jae    801cab <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801c9c:	40 38 37             	cmp    %sil,(%rdi)
+  801c9f:	74 0e                	je     801caf <memfind+0x1c>
+    for (; src < end; src++) {
+  801ca1:	48 83 c7 01          	add    $0x1,%rdi
+  801ca5:	48 39 f8             	cmp    %rdi,%rax
+  801ca8:	75 f2                	jne    801c9c <memfind+0x9>
+  801caa:	c3                   	ret
+  801cab:	48 89 f8             	mov    %rdi,%rax
+  801cae:	c3                   	ret
+  801caf:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801cb2:	c3                   	ret
+
+0000000000801cb3 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801cb3:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801cb6:	0f b6 37             	movzbl (%rdi),%esi
+  801cb9:	40 80 fe 20          	cmp    $0x20,%sil
+  801cbd:	74 06                	je     801cc5 <strtol+0x12>
+  801cbf:	40 80 fe 09          	cmp    $0x9,%sil
+  801cc3:	75 13                	jne    801cd8 <strtol+0x25>
+  801cc5:	48 83 c7 01          	add    $0x1,%rdi
+  801cc9:	0f b6 37             	movzbl (%rdi),%esi
+  801ccc:	40 80 fe 20          	cmp    $0x20,%sil
+  801cd0:	74 f3                	je     801cc5 <strtol+0x12>
+  801cd2:	40 80 fe 09          	cmp    $0x9,%sil
+  801cd6:	74 ed                	je     801cc5 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801cd8:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801cdb:	83 e0 fd             	and    $0xfffffffd,%eax
+  801cde:	3c 01                	cmp    $0x1,%al
+  801ce0:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801ce4:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801cea:	75 0f                	jne    801cfb <strtol+0x48>
+  801cec:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801cef:	74 14                	je     801d05 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801cf1:	85 d2                	test   %edx,%edx
+  801cf3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801cf8:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801cfb:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801d00:	4c 63 ca             	movslq %edx,%r9
+  801d03:	eb 36                	jmp    801d3b <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801d05:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801d09:	74 0f                	je     801d1a <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801d0b:	85 d2                	test   %edx,%edx
+  801d0d:	75 ec                	jne    801cfb <strtol+0x48>
+        s++;
+  801d0f:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801d13:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801d18:	eb e1                	jmp    801cfb <strtol+0x48>
+        s += 2;
+  801d1a:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801d1e:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801d23:	eb d6                	jmp    801cfb <strtol+0x48>
+            dig -= '0';
+  801d25:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801d28:	44 0f b6 c1          	movzbl %cl,%r8d
+  801d2c:	41 39 d0             	cmp    %edx,%r8d
+  801d2f:	7d 21                	jge    801d52 <strtol+0x9f>
+        val = val * base + dig;
+  801d31:	49 0f af c1          	imul   %r9,%rax
+  801d35:	0f b6 c9             	movzbl %cl,%ecx
+  801d38:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801d3b:	48 83 c7 01          	add    $0x1,%rdi
+  801d3f:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801d43:	80 f9 39             	cmp    $0x39,%cl
+  801d46:	76 dd                	jbe    801d25 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801d48:	80 f9 7b             	cmp    $0x7b,%cl
+  801d4b:	77 05                	ja     801d52 <strtol+0x9f>
+            dig -= 'a' - 10;
+  801d4d:	83 e9 57             	sub    $0x57,%ecx
+  801d50:	eb d6                	jmp    801d28 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801d52:	4d 85 d2             	test   %r10,%r10
+  801d55:	74 03                	je     801d5a <strtol+0xa7>
+  801d57:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801d5a:	48 89 c2             	mov    %rax,%rdx
+  801d5d:	48 f7 da             	neg    %rdx
+  801d60:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801d64:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801d68:	c3                   	ret
+
+0000000000801d69 <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  801d69:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801d6e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d73:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801d79:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801d7f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  801d85:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801d87:	c3                   	ret
+
+0000000000801d88 <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  801d88:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801d8d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d92:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801d97:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d9c:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801da2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801da8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801dae:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801db0:	c3                   	ret
+
+0000000000801db1 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801db1:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801db4:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801db9:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801dbe:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dc3:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801dc9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801dcf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801dd5:	0f 05                	syscall
+    if (check && ret > 0) {
+  801dd7:	48 85 c0             	test   %rax,%rax
+  801dda:	7f 01                	jg     801ddd <sys_env_destroy+0x2c>
+}
+  801ddc:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  801ddd:	55                   	push   %rbp
+  801dde:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801de1:	49 89 c0             	mov    %rax,%r8
+  801de4:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801de9:	48 ba 38 5e 80 00 00 	movabs $0x805e38,%rdx
+  801df0:	00 00 00 
+  801df3:	be 29 00 00 00       	mov    $0x29,%esi
+  801df8:	48 bf 57 5e 80 00 00 	movabs $0x805e57,%rdi
+  801dff:	00 00 00 
+  801e02:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e07:	49 b9 cd 0e 80 00 00 	movabs $0x800ecd,%r9
+  801e0e:	00 00 00 
+  801e11:	41 ff d1             	call   *%r9
+
+0000000000801e14 <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  801e14:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801e19:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e1e:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801e23:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e28:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801e2e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e34:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801e3a:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801e3c:	c3                   	ret
+
+0000000000801e3d <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  801e3d:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801e42:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e47:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801e4c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e51:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801e57:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e5d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801e63:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801e65:	c3                   	ret
+
+0000000000801e66 <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  801e66:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801e6b:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  801e72:	00 00 00 
+  801e75:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801e7b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e81:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801e87:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801e89:	c3                   	ret
+
+0000000000801e8a <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801e8a:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  801e8d:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801e92:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e98:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801e9e:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801ea0:	c3                   	ret
+
+0000000000801ea1 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801ea1:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801ea4:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801ea9:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801eac:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801eb2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801eb8:	0f 05                	syscall
+    if (check && ret > 0) {
+  801eba:	48 85 c0             	test   %rax,%rax
+  801ebd:	7f 01                	jg     801ec0 <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801ebf:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801ec0:	55                   	push   %rbp
+  801ec1:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801ec4:	49 89 c0             	mov    %rax,%r8
+  801ec7:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801ecc:	48 ba 38 5e 80 00 00 	movabs $0x805e38,%rdx
+  801ed3:	00 00 00 
+  801ed6:	be 29 00 00 00       	mov    $0x29,%esi
+  801edb:	48 bf 57 5e 80 00 00 	movabs $0x805e57,%rdi
+  801ee2:	00 00 00 
+  801ee5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801eea:	49 b9 cd 0e 80 00 00 	movabs $0x800ecd,%r9
+  801ef1:	00 00 00 
+  801ef4:	41 ff d1             	call   *%r9
+
+0000000000801ef7 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801ef7:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801efa:	48 63 d2             	movslq %edx,%rdx
+  801efd:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801f00:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801f05:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  801f08:	0f 05                	syscall
+    if (check && ret > 0) {
+  801f0a:	48 85 c0             	test   %rax,%rax
+  801f0d:	7f 01                	jg     801f10 <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801f0f:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801f10:	55                   	push   %rbp
+  801f11:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801f14:	49 89 c0             	mov    %rax,%r8
+  801f17:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801f1c:	48 ba 38 5e 80 00 00 	movabs $0x805e38,%rdx
+  801f23:	00 00 00 
+  801f26:	be 29 00 00 00       	mov    $0x29,%esi
+  801f2b:	48 bf 57 5e 80 00 00 	movabs $0x805e57,%rdi
+  801f32:	00 00 00 
+  801f35:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f3a:	49 b9 cd 0e 80 00 00 	movabs $0x800ecd,%r9
+  801f41:	00 00 00 
+  801f44:	41 ff d1             	call   *%r9
+
+0000000000801f47 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801f47:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801f4a:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801f4f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801f55:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f5b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801f61:	0f 05                	syscall
+    if (check && ret > 0) {
+  801f63:	48 85 c0             	test   %rax,%rax
+  801f66:	7f 01                	jg     801f69 <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801f68:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801f69:	55                   	push   %rbp
+  801f6a:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801f6d:	49 89 c0             	mov    %rax,%r8
+  801f70:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801f75:	48 ba 38 5e 80 00 00 	movabs $0x805e38,%rdx
+  801f7c:	00 00 00 
+  801f7f:	be 29 00 00 00       	mov    $0x29,%esi
+  801f84:	48 bf 57 5e 80 00 00 	movabs $0x805e57,%rdi
+  801f8b:	00 00 00 
+  801f8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f93:	49 b9 cd 0e 80 00 00 	movabs $0x800ecd,%r9
+  801f9a:	00 00 00 
+  801f9d:	41 ff d1             	call   *%r9
+
+0000000000801fa0 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801fa0:	48 63 f6             	movslq %esi,%rsi
+  801fa3:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801fa6:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801fab:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fb0:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801fb6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801fbc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801fc2:	0f 05                	syscall
+    if (check && ret > 0) {
+  801fc4:	48 85 c0             	test   %rax,%rax
+  801fc7:	7f 01                	jg     801fca <sys_env_set_status+0x2a>
+}
+  801fc9:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  801fca:	55                   	push   %rbp
+  801fcb:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801fce:	49 89 c0             	mov    %rax,%r8
+  801fd1:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801fd6:	48 ba 38 5e 80 00 00 	movabs $0x805e38,%rdx
+  801fdd:	00 00 00 
+  801fe0:	be 29 00 00 00       	mov    $0x29,%esi
+  801fe5:	48 bf 57 5e 80 00 00 	movabs $0x805e57,%rdi
+  801fec:	00 00 00 
+  801fef:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ff4:	49 b9 cd 0e 80 00 00 	movabs $0x800ecd,%r9
+  801ffb:	00 00 00 
+  801ffe:	41 ff d1             	call   *%r9
+
+0000000000802001 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  802001:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  802004:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  802009:	ba 00 00 00 00       	mov    $0x0,%edx
+  80200e:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  802014:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80201a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  802020:	0f 05                	syscall
+    if (check && ret > 0) {
+  802022:	48 85 c0             	test   %rax,%rax
+  802025:	7f 01                	jg     802028 <sys_env_set_trapframe+0x27>
+}
+  802027:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  802028:	55                   	push   %rbp
+  802029:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80202c:	49 89 c0             	mov    %rax,%r8
+  80202f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  802034:	48 ba 38 5e 80 00 00 	movabs $0x805e38,%rdx
+  80203b:	00 00 00 
+  80203e:	be 29 00 00 00       	mov    $0x29,%esi
+  802043:	48 bf 57 5e 80 00 00 	movabs $0x805e57,%rdi
+  80204a:	00 00 00 
+  80204d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802052:	49 b9 cd 0e 80 00 00 	movabs $0x800ecd,%r9
+  802059:	00 00 00 
+  80205c:	41 ff d1             	call   *%r9
+
+000000000080205f <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80205f:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  802062:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  802067:	ba 00 00 00 00       	mov    $0x0,%edx
+  80206c:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  802072:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802078:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80207e:	0f 05                	syscall
+    if (check && ret > 0) {
+  802080:	48 85 c0             	test   %rax,%rax
+  802083:	7f 01                	jg     802086 <sys_env_set_pgfault_upcall+0x27>
+}
+  802085:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802086:	55                   	push   %rbp
+  802087:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80208a:	49 89 c0             	mov    %rax,%r8
+  80208d:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  802092:	48 ba 38 5e 80 00 00 	movabs $0x805e38,%rdx
+  802099:	00 00 00 
+  80209c:	be 29 00 00 00       	mov    $0x29,%esi
+  8020a1:	48 bf 57 5e 80 00 00 	movabs $0x805e57,%rdi
+  8020a8:	00 00 00 
+  8020ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020b0:	49 b9 cd 0e 80 00 00 	movabs $0x800ecd,%r9
+  8020b7:	00 00 00 
+  8020ba:	41 ff d1             	call   *%r9
+
+00000000008020bd <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8020bd:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8020c0:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8020c3:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8020c8:	4d 63 c0             	movslq %r8d,%r8
+  8020cb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8020d1:	0f 05                	syscall
+}
+  8020d3:	c3                   	ret
+
+00000000008020d4 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8020d4:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8020d7:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8020da:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8020df:	4d 63 c0             	movslq %r8d,%r8
+  8020e2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8020e8:	0f 05                	syscall
+}
+  8020ea:	c3                   	ret
+
+00000000008020eb <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  8020eb:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8020f0:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8020f3:	45 89 c0             	mov    %r8d,%r8d
+  8020f6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8020fc:	0f 05                	syscall
+    if (check && ret > 0) {
+  8020fe:	48 85 c0             	test   %rax,%rax
+  802101:	7f 01                	jg     802104 <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802103:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  802104:	55                   	push   %rbp
+  802105:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802108:	49 89 c0             	mov    %rax,%r8
+  80210b:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  802110:	48 ba 38 5e 80 00 00 	movabs $0x805e38,%rdx
+  802117:	00 00 00 
+  80211a:	be 29 00 00 00       	mov    $0x29,%esi
+  80211f:	48 bf 57 5e 80 00 00 	movabs $0x805e57,%rdi
+  802126:	00 00 00 
+  802129:	b8 00 00 00 00       	mov    $0x0,%eax
+  80212e:	49 b9 cd 0e 80 00 00 	movabs $0x800ecd,%r9
+  802135:	00 00 00 
+  802138:	41 ff d1             	call   *%r9
+
+000000000080213b <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  80213b:	55                   	push   %rbp
+  80213c:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  80213f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802145:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80214a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80214f:	48 b8 eb 20 80 00 00 	movabs $0x8020eb,%rax
+  802156:	00 00 00 
+  802159:	ff d0                	call   *%rax
+}
+  80215b:	5d                   	pop    %rbp
+  80215c:	c3                   	ret
+
+000000000080215d <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  80215d:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  802162:	bf 00 00 00 00       	mov    $0x0,%edi
+  802167:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80216c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802171:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  802177:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80217d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  802183:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  802185:	c3                   	ret
+
+0000000000802186 <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  802186:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80218b:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  802190:	ba 00 00 00 00       	mov    $0x0,%edx
+  802195:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80219b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021a1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8021a7:	0f 05                	syscall
+    if (check && ret > 0) {
+  8021a9:	48 85 c0             	test   %rax,%rax
+  8021ac:	7f 01                	jg     8021af <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  8021ae:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  8021af:	55                   	push   %rbp
+  8021b0:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8021b3:	49 89 c0             	mov    %rax,%r8
+  8021b6:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8021bb:	48 ba 38 5e 80 00 00 	movabs $0x805e38,%rdx
+  8021c2:	00 00 00 
+  8021c5:	be 29 00 00 00       	mov    $0x29,%esi
+  8021ca:	48 bf 57 5e 80 00 00 	movabs $0x805e57,%rdi
+  8021d1:	00 00 00 
+  8021d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021d9:	49 b9 cd 0e 80 00 00 	movabs $0x800ecd,%r9
+  8021e0:	00 00 00 
+  8021e3:	41 ff d1             	call   *%r9
+
+00000000008021e6 <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  8021e6:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8021eb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021f0:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8021f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021fa:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  802200:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802206:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80220c:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  80220e:	c3                   	ret
+
+000000000080220f <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  80220f:	89 d2                	mov    %edx,%edx
+  802211:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  802213:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  802218:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80221e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802224:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80222a:	0f 05                	syscall
+}
+  80222c:	c3                   	ret
+
+000000000080222d <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  80222d:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  802230:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  802235:	ba 00 00 00 00       	mov    $0x0,%edx
+  80223a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  802240:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802246:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80224c:	0f 05                	syscall
+}
+  80224e:	c3                   	ret
+
+000000000080224f <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  80224f:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  802252:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  802257:	ba 00 00 00 00       	mov    $0x0,%edx
+  80225c:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  802262:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802268:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80226e:	0f 05                	syscall
+}
+  802270:	c3                   	ret
+
+0000000000802271 <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  802271:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  802274:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  802279:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80227e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802283:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  802289:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80228f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  802295:	0f 05                	syscall
+    if (check && ret > 0) {
+  802297:	48 85 c0             	test   %rax,%rax
+  80229a:	7f 01                	jg     80229d <sys_irq_ack+0x2c>
+}
+  80229c:	c3                   	ret
+sys_irq_ack(int irq) {
+  80229d:	55                   	push   %rbp
+  80229e:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8022a1:	49 89 c0             	mov    %rax,%r8
+  8022a4:	b9 16 00 00 00       	mov    $0x16,%ecx
+  8022a9:	48 ba 38 5e 80 00 00 	movabs $0x805e38,%rdx
+  8022b0:	00 00 00 
+  8022b3:	be 29 00 00 00       	mov    $0x29,%esi
+  8022b8:	48 bf 57 5e 80 00 00 	movabs $0x805e57,%rdi
+  8022bf:	00 00 00 
+  8022c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022c7:	49 b9 cd 0e 80 00 00 	movabs $0x800ecd,%r9
+  8022ce:	00 00 00 
+  8022d1:	41 ff d1             	call   *%r9
+
+00000000008022d4 <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8022d4:	55                   	push   %rbp
+  8022d5:	48 89 e5             	mov    %rsp,%rbp
+  8022d8:	41 55                	push   %r13
+  8022da:	41 54                	push   %r12
+  8022dc:	53                   	push   %rbx
+  8022dd:	48 83 ec 08          	sub    $0x8,%rsp
+  8022e1:	49 89 fd             	mov    %rdi,%r13
+  8022e4:	48 89 f7             	mov    %rsi,%rdi
+  8022e7:	48 89 d3             	mov    %rdx,%rbx
+  8022ea:	49 89 cc             	mov    %rcx,%r12
+  8022ed:	4c 89 c2             	mov    %r8,%rdx
+  8022f0:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8022f3:	48 85 f6             	test   %rsi,%rsi
+  8022f6:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8022fd:	00 00 00 
+  802300:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  802304:	be 00 10 00 00       	mov    $0x1000,%esi
+  802309:	48 85 db             	test   %rbx,%rbx
+  80230c:	74 03                	je     802311 <ipc_recv_futex+0x3d>
+  80230e:	48 8b 33             	mov    (%rbx),%rsi
+  802311:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  802315:	48 b8 eb 20 80 00 00 	movabs $0x8020eb,%rax
+  80231c:	00 00 00 
+  80231f:	ff d0                	call   *%rax
+    if (res < 0) {
+  802321:	85 c0                	test   %eax,%eax
+  802323:	78 75                	js     80239a <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  802325:	4d 85 ed             	test   %r13,%r13
+  802328:	74 14                	je     80233e <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  80232a:	48 a1 00 10 81 00 00 	movabs 0x811000,%rax
+  802331:	00 00 00 
+  802334:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  80233a:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  80233e:	4d 85 e4             	test   %r12,%r12
+  802341:	74 14                	je     802357 <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  802343:	48 a1 00 10 81 00 00 	movabs 0x811000,%rax
+  80234a:	00 00 00 
+  80234d:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  802353:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  802357:	48 85 db             	test   %rbx,%rbx
+  80235a:	74 23                	je     80237f <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  80235c:	48 a1 00 10 81 00 00 	movabs 0x811000,%rax
+  802363:	00 00 00 
+  802366:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  80236c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802371:	85 c9                	test   %ecx,%ecx
+  802373:	74 07                	je     80237c <ipc_recv_futex+0xa8>
+  802375:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  80237c:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  80237f:	48 a1 00 10 81 00 00 	movabs 0x811000,%rax
+  802386:	00 00 00 
+  802389:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  80238f:	48 83 c4 08          	add    $0x8,%rsp
+  802393:	5b                   	pop    %rbx
+  802394:	41 5c                	pop    %r12
+  802396:	41 5d                	pop    %r13
+  802398:	5d                   	pop    %rbp
+  802399:	c3                   	ret
+        if (from_env_store != NULL) {
+  80239a:	4d 85 ed             	test   %r13,%r13
+  80239d:	74 08                	je     8023a7 <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  80239f:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8023a6:	00 
+        if (perm_store != NULL) {
+  8023a7:	4d 85 e4             	test   %r12,%r12
+  8023aa:	74 08                	je     8023b4 <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  8023ac:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8023b3:	00 
+        if (size != NULL) {
+  8023b4:	48 85 db             	test   %rbx,%rbx
+  8023b7:	74 d6                	je     80238f <ipc_recv_futex+0xbb>
+            *size = 0;
+  8023b9:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  8023c0:	eb cd                	jmp    80238f <ipc_recv_futex+0xbb>
+
+00000000008023c2 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8023c2:	55                   	push   %rbp
+  8023c3:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  8023c6:	48 83 ec 08          	sub    $0x8,%rsp
+  8023ca:	6a 00                	push   $0x0
+  8023cc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023d2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8023d8:	48 b8 d4 22 80 00 00 	movabs $0x8022d4,%rax
+  8023df:	00 00 00 
+  8023e2:	ff d0                	call   *%rax
+}
+  8023e4:	c9                   	leave
+  8023e5:	c3                   	ret
+
+00000000008023e6 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8023e6:	55                   	push   %rbp
+  8023e7:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8023ea:	48 85 d2             	test   %rdx,%rdx
+  8023ed:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8023f4:	00 00 00 
+  8023f7:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  8023fb:	89 f6                	mov    %esi,%esi
+  8023fd:	48 b8 d4 20 80 00 00 	movabs $0x8020d4,%rax
+  802404:	00 00 00 
+  802407:	ff d0                	call   *%rax
+    if (res < 0) {
+  802409:	85 c0                	test   %eax,%eax
+  80240b:	78 02                	js     80240f <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  80240d:	5d                   	pop    %rbp
+  80240e:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  80240f:	89 c1                	mov    %eax,%ecx
+  802411:	48 ba 65 5e 80 00 00 	movabs $0x805e65,%rdx
+  802418:	00 00 00 
+  80241b:	be 50 00 00 00       	mov    $0x50,%esi
+  802420:	48 bf 79 5e 80 00 00 	movabs $0x805e79,%rdi
+  802427:	00 00 00 
+  80242a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80242f:	49 b8 cd 0e 80 00 00 	movabs $0x800ecd,%r8
+  802436:	00 00 00 
+  802439:	41 ff d0             	call   *%r8
+
+000000000080243c <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80243c:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  802441:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  802448:	00 00 00 
+  80244b:	48 89 d0             	mov    %rdx,%rax
+  80244e:	48 c1 e0 04          	shl    $0x4,%rax
+  802452:	48 29 d0             	sub    %rdx,%rax
+  802455:	48 c1 e0 05          	shl    $0x5,%rax
+  802459:	48 01 c8             	add    %rcx,%rax
+  80245c:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  802462:	39 f8                	cmp    %edi,%eax
+  802464:	74 13                	je     802479 <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  802466:	48 83 c2 01          	add    $0x1,%rdx
+  80246a:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  802471:	75 d8                	jne    80244b <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  802473:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802478:	c3                   	ret
+            return envs[i].env_id;
+  802479:	48 89 d0             	mov    %rdx,%rax
+  80247c:	48 c1 e0 04          	shl    $0x4,%rax
+  802480:	48 29 d0             	sub    %rdx,%rax
+  802483:	48 c1 e0 05          	shl    $0x5,%rax
+  802487:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80248e:	00 00 00 
+  802491:	48 01 d0             	add    %rdx,%rax
+  802494:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80249a:	c3                   	ret
+
+000000000080249b <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80249b:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8024a2:	ff ff ff 
+  8024a5:	48 01 f8             	add    %rdi,%rax
+  8024a8:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8024ac:	c3                   	ret
+
+00000000008024ad <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8024ad:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8024b4:	ff ff ff 
+  8024b7:	48 01 f8             	add    %rdi,%rax
+  8024ba:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8024be:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8024c4:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8024c8:	c3                   	ret
+
+00000000008024c9 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8024c9:	55                   	push   %rbp
+  8024ca:	48 89 e5             	mov    %rsp,%rbp
+  8024cd:	41 57                	push   %r15
+  8024cf:	41 56                	push   %r14
+  8024d1:	41 55                	push   %r13
+  8024d3:	41 54                	push   %r12
+  8024d5:	53                   	push   %rbx
+  8024d6:	48 83 ec 08          	sub    $0x8,%rsp
+  8024da:	49 89 ff             	mov    %rdi,%r15
+  8024dd:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8024e2:	49 bd 58 4c 80 00 00 	movabs $0x804c58,%r13
+  8024e9:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8024ec:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8024f2:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8024f5:	48 89 df             	mov    %rbx,%rdi
+  8024f8:	41 ff d5             	call   *%r13
+  8024fb:	83 e0 04             	and    $0x4,%eax
+  8024fe:	74 17                	je     802517 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  802500:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802507:	4c 39 f3             	cmp    %r14,%rbx
+  80250a:	75 e6                	jne    8024f2 <fd_alloc+0x29>
+  80250c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  802512:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  802517:	4d 89 27             	mov    %r12,(%r15)
+}
+  80251a:	48 83 c4 08          	add    $0x8,%rsp
+  80251e:	5b                   	pop    %rbx
+  80251f:	41 5c                	pop    %r12
+  802521:	41 5d                	pop    %r13
+  802523:	41 5e                	pop    %r14
+  802525:	41 5f                	pop    %r15
+  802527:	5d                   	pop    %rbp
+  802528:	c3                   	ret
+
+0000000000802529 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  802529:	83 ff 1f             	cmp    $0x1f,%edi
+  80252c:	77 39                	ja     802567 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80252e:	55                   	push   %rbp
+  80252f:	48 89 e5             	mov    %rsp,%rbp
+  802532:	41 54                	push   %r12
+  802534:	53                   	push   %rbx
+  802535:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  802538:	48 63 df             	movslq %edi,%rbx
+  80253b:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  802542:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  802546:	48 89 df             	mov    %rbx,%rdi
+  802549:	48 b8 58 4c 80 00 00 	movabs $0x804c58,%rax
+  802550:	00 00 00 
+  802553:	ff d0                	call   *%rax
+  802555:	a8 04                	test   $0x4,%al
+  802557:	74 14                	je     80256d <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  802559:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  80255d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802562:	5b                   	pop    %rbx
+  802563:	41 5c                	pop    %r12
+  802565:	5d                   	pop    %rbp
+  802566:	c3                   	ret
+        return -E_INVAL;
+  802567:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80256c:	c3                   	ret
+        return -E_INVAL;
+  80256d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802572:	eb ee                	jmp    802562 <fd_lookup+0x39>
+
+0000000000802574 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802574:	55                   	push   %rbp
+  802575:	48 89 e5             	mov    %rsp,%rbp
+  802578:	41 54                	push   %r12
+  80257a:	53                   	push   %rbx
+  80257b:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  80257e:	48 b8 20 5f 80 00 00 	movabs $0x805f20,%rax
+  802585:	00 00 00 
+  802588:	48 bb 20 70 80 00 00 	movabs $0x807020,%rbx
+  80258f:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  802592:	39 3b                	cmp    %edi,(%rbx)
+  802594:	74 47                	je     8025dd <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  802596:	48 83 c0 08          	add    $0x8,%rax
+  80259a:	48 8b 18             	mov    (%rax),%rbx
+  80259d:	48 85 db             	test   %rbx,%rbx
+  8025a0:	75 f0                	jne    802592 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8025a2:	48 a1 00 10 81 00 00 	movabs 0x811000,%rax
+  8025a9:	00 00 00 
+  8025ac:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8025b2:	89 fa                	mov    %edi,%edx
+  8025b4:	48 bf 88 5e 80 00 00 	movabs $0x805e88,%rdi
+  8025bb:	00 00 00 
+  8025be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025c3:	48 b9 1d 10 80 00 00 	movabs $0x80101d,%rcx
+  8025ca:	00 00 00 
+  8025cd:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8025cf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8025d4:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8025d8:	5b                   	pop    %rbx
+  8025d9:	41 5c                	pop    %r12
+  8025db:	5d                   	pop    %rbp
+  8025dc:	c3                   	ret
+            return 0;
+  8025dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025e2:	eb f0                	jmp    8025d4 <dev_lookup+0x60>
+
+00000000008025e4 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8025e4:	55                   	push   %rbp
+  8025e5:	48 89 e5             	mov    %rsp,%rbp
+  8025e8:	41 55                	push   %r13
+  8025ea:	41 54                	push   %r12
+  8025ec:	53                   	push   %rbx
+  8025ed:	48 83 ec 18          	sub    $0x18,%rsp
+  8025f1:	48 89 fb             	mov    %rdi,%rbx
+  8025f4:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8025f7:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8025fe:	ff ff ff 
+  802601:	48 01 df             	add    %rbx,%rdi
+  802604:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  802608:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80260c:	48 b8 29 25 80 00 00 	movabs $0x802529,%rax
+  802613:	00 00 00 
+  802616:	ff d0                	call   *%rax
+  802618:	41 89 c5             	mov    %eax,%r13d
+  80261b:	85 c0                	test   %eax,%eax
+  80261d:	78 06                	js     802625 <fd_close+0x41>
+  80261f:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  802623:	74 1a                	je     80263f <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  802625:	45 84 e4             	test   %r12b,%r12b
+  802628:	b8 00 00 00 00       	mov    $0x0,%eax
+  80262d:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  802631:	44 89 e8             	mov    %r13d,%eax
+  802634:	48 83 c4 18          	add    $0x18,%rsp
+  802638:	5b                   	pop    %rbx
+  802639:	41 5c                	pop    %r12
+  80263b:	41 5d                	pop    %r13
+  80263d:	5d                   	pop    %rbp
+  80263e:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80263f:	8b 3b                	mov    (%rbx),%edi
+  802641:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802645:	48 b8 74 25 80 00 00 	movabs $0x802574,%rax
+  80264c:	00 00 00 
+  80264f:	ff d0                	call   *%rax
+  802651:	41 89 c5             	mov    %eax,%r13d
+  802654:	85 c0                	test   %eax,%eax
+  802656:	78 1b                	js     802673 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  802658:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80265c:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802660:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802666:	48 85 c0             	test   %rax,%rax
+  802669:	74 08                	je     802673 <fd_close+0x8f>
+  80266b:	48 89 df             	mov    %rbx,%rdi
+  80266e:	ff d0                	call   *%rax
+  802670:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802673:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802678:	48 89 de             	mov    %rbx,%rsi
+  80267b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802680:	48 b8 47 1f 80 00 00 	movabs $0x801f47,%rax
+  802687:	00 00 00 
+  80268a:	ff d0                	call   *%rax
+    return res;
+  80268c:	eb a3                	jmp    802631 <fd_close+0x4d>
+
+000000000080268e <close>:
+
+int
+close(int fdnum) {
+  80268e:	55                   	push   %rbp
+  80268f:	48 89 e5             	mov    %rsp,%rbp
+  802692:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802696:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80269a:	48 b8 29 25 80 00 00 	movabs $0x802529,%rax
+  8026a1:	00 00 00 
+  8026a4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8026a6:	85 c0                	test   %eax,%eax
+  8026a8:	78 15                	js     8026bf <close+0x31>
+
+    return fd_close(fd, 1);
+  8026aa:	be 01 00 00 00       	mov    $0x1,%esi
+  8026af:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8026b3:	48 b8 e4 25 80 00 00 	movabs $0x8025e4,%rax
+  8026ba:	00 00 00 
+  8026bd:	ff d0                	call   *%rax
+}
+  8026bf:	c9                   	leave
+  8026c0:	c3                   	ret
+
+00000000008026c1 <close_all>:
+
+void
+close_all(void) {
+  8026c1:	55                   	push   %rbp
+  8026c2:	48 89 e5             	mov    %rsp,%rbp
+  8026c5:	41 54                	push   %r12
+  8026c7:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8026c8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8026cd:	49 bc 8e 26 80 00 00 	movabs $0x80268e,%r12
+  8026d4:	00 00 00 
+  8026d7:	89 df                	mov    %ebx,%edi
+  8026d9:	41 ff d4             	call   *%r12
+  8026dc:	83 c3 01             	add    $0x1,%ebx
+  8026df:	83 fb 20             	cmp    $0x20,%ebx
+  8026e2:	75 f3                	jne    8026d7 <close_all+0x16>
+}
+  8026e4:	5b                   	pop    %rbx
+  8026e5:	41 5c                	pop    %r12
+  8026e7:	5d                   	pop    %rbp
+  8026e8:	c3                   	ret
+
+00000000008026e9 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8026e9:	55                   	push   %rbp
+  8026ea:	48 89 e5             	mov    %rsp,%rbp
+  8026ed:	41 57                	push   %r15
+  8026ef:	41 56                	push   %r14
+  8026f1:	41 55                	push   %r13
+  8026f3:	41 54                	push   %r12
+  8026f5:	53                   	push   %rbx
+  8026f6:	48 83 ec 18          	sub    $0x18,%rsp
+  8026fa:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8026fd:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802701:	48 b8 29 25 80 00 00 	movabs $0x802529,%rax
+  802708:	00 00 00 
+  80270b:	ff d0                	call   *%rax
+  80270d:	89 c3                	mov    %eax,%ebx
+  80270f:	85 c0                	test   %eax,%eax
+  802711:	0f 88 b8 00 00 00    	js     8027cf <dup+0xe6>
+    close(newfdnum);
+  802717:	44 89 e7             	mov    %r12d,%edi
+  80271a:	48 b8 8e 26 80 00 00 	movabs $0x80268e,%rax
+  802721:	00 00 00 
+  802724:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  802726:	4d 63 ec             	movslq %r12d,%r13
+  802729:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  802730:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  802734:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  802738:	4c 89 ff             	mov    %r15,%rdi
+  80273b:	49 be ad 24 80 00 00 	movabs $0x8024ad,%r14
+  802742:	00 00 00 
+  802745:	41 ff d6             	call   *%r14
+  802748:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  80274b:	4c 89 ef             	mov    %r13,%rdi
+  80274e:	41 ff d6             	call   *%r14
+  802751:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  802754:	48 89 df             	mov    %rbx,%rdi
+  802757:	48 b8 58 4c 80 00 00 	movabs $0x804c58,%rax
+  80275e:	00 00 00 
+  802761:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  802763:	a8 04                	test   $0x4,%al
+  802765:	74 2b                	je     802792 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  802767:	41 89 c1             	mov    %eax,%r9d
+  80276a:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802770:	4c 89 f1             	mov    %r14,%rcx
+  802773:	ba 00 00 00 00       	mov    $0x0,%edx
+  802778:	48 89 de             	mov    %rbx,%rsi
+  80277b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802780:	48 b8 f7 1e 80 00 00 	movabs $0x801ef7,%rax
+  802787:	00 00 00 
+  80278a:	ff d0                	call   *%rax
+  80278c:	89 c3                	mov    %eax,%ebx
+  80278e:	85 c0                	test   %eax,%eax
+  802790:	78 4e                	js     8027e0 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  802792:	4c 89 ff             	mov    %r15,%rdi
+  802795:	48 b8 58 4c 80 00 00 	movabs $0x804c58,%rax
+  80279c:	00 00 00 
+  80279f:	ff d0                	call   *%rax
+  8027a1:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8027a4:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8027aa:	4c 89 e9             	mov    %r13,%rcx
+  8027ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027b2:	4c 89 fe             	mov    %r15,%rsi
+  8027b5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027ba:	48 b8 f7 1e 80 00 00 	movabs $0x801ef7,%rax
+  8027c1:	00 00 00 
+  8027c4:	ff d0                	call   *%rax
+  8027c6:	89 c3                	mov    %eax,%ebx
+  8027c8:	85 c0                	test   %eax,%eax
+  8027ca:	78 14                	js     8027e0 <dup+0xf7>
+
+    return newfdnum;
+  8027cc:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8027cf:	89 d8                	mov    %ebx,%eax
+  8027d1:	48 83 c4 18          	add    $0x18,%rsp
+  8027d5:	5b                   	pop    %rbx
+  8027d6:	41 5c                	pop    %r12
+  8027d8:	41 5d                	pop    %r13
+  8027da:	41 5e                	pop    %r14
+  8027dc:	41 5f                	pop    %r15
+  8027de:	5d                   	pop    %rbp
+  8027df:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8027e0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8027e5:	4c 89 ee             	mov    %r13,%rsi
+  8027e8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027ed:	49 bc 47 1f 80 00 00 	movabs $0x801f47,%r12
+  8027f4:	00 00 00 
+  8027f7:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8027fa:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8027ff:	4c 89 f6             	mov    %r14,%rsi
+  802802:	bf 00 00 00 00       	mov    $0x0,%edi
+  802807:	41 ff d4             	call   *%r12
+    return res;
+  80280a:	eb c3                	jmp    8027cf <dup+0xe6>
+
+000000000080280c <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80280c:	55                   	push   %rbp
+  80280d:	48 89 e5             	mov    %rsp,%rbp
+  802810:	41 56                	push   %r14
+  802812:	41 55                	push   %r13
+  802814:	41 54                	push   %r12
+  802816:	53                   	push   %rbx
+  802817:	48 83 ec 10          	sub    $0x10,%rsp
+  80281b:	89 fb                	mov    %edi,%ebx
+  80281d:	49 89 f4             	mov    %rsi,%r12
+  802820:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802823:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802827:	48 b8 29 25 80 00 00 	movabs $0x802529,%rax
+  80282e:	00 00 00 
+  802831:	ff d0                	call   *%rax
+  802833:	85 c0                	test   %eax,%eax
+  802835:	78 4c                	js     802883 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802837:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80283b:	41 8b 3e             	mov    (%r14),%edi
+  80283e:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802842:	48 b8 74 25 80 00 00 	movabs $0x802574,%rax
+  802849:	00 00 00 
+  80284c:	ff d0                	call   *%rax
+  80284e:	85 c0                	test   %eax,%eax
+  802850:	78 35                	js     802887 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802852:	41 8b 46 08          	mov    0x8(%r14),%eax
+  802856:	83 e0 03             	and    $0x3,%eax
+  802859:	83 f8 01             	cmp    $0x1,%eax
+  80285c:	74 2d                	je     80288b <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80285e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802862:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802866:	48 85 c0             	test   %rax,%rax
+  802869:	74 56                	je     8028c1 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  80286b:	4c 89 ea             	mov    %r13,%rdx
+  80286e:	4c 89 e6             	mov    %r12,%rsi
+  802871:	4c 89 f7             	mov    %r14,%rdi
+  802874:	ff d0                	call   *%rax
+}
+  802876:	48 83 c4 10          	add    $0x10,%rsp
+  80287a:	5b                   	pop    %rbx
+  80287b:	41 5c                	pop    %r12
+  80287d:	41 5d                	pop    %r13
+  80287f:	41 5e                	pop    %r14
+  802881:	5d                   	pop    %rbp
+  802882:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802883:	48 98                	cltq
+  802885:	eb ef                	jmp    802876 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802887:	48 98                	cltq
+  802889:	eb eb                	jmp    802876 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80288b:	48 a1 00 10 81 00 00 	movabs 0x811000,%rax
+  802892:	00 00 00 
+  802895:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80289b:	89 da                	mov    %ebx,%edx
+  80289d:	48 bf c9 5e 80 00 00 	movabs $0x805ec9,%rdi
+  8028a4:	00 00 00 
+  8028a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028ac:	48 b9 1d 10 80 00 00 	movabs $0x80101d,%rcx
+  8028b3:	00 00 00 
+  8028b6:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8028b8:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8028bf:	eb b5                	jmp    802876 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8028c1:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8028c8:	eb ac                	jmp    802876 <read+0x6a>
+
+00000000008028ca <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8028ca:	55                   	push   %rbp
+  8028cb:	48 89 e5             	mov    %rsp,%rbp
+  8028ce:	41 57                	push   %r15
+  8028d0:	41 56                	push   %r14
+  8028d2:	41 55                	push   %r13
+  8028d4:	41 54                	push   %r12
+  8028d6:	53                   	push   %rbx
+  8028d7:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8028db:	48 85 d2             	test   %rdx,%rdx
+  8028de:	74 54                	je     802934 <readn+0x6a>
+  8028e0:	41 89 fd             	mov    %edi,%r13d
+  8028e3:	49 89 f6             	mov    %rsi,%r14
+  8028e6:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8028e9:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8028ee:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8028f3:	49 bf 0c 28 80 00 00 	movabs $0x80280c,%r15
+  8028fa:	00 00 00 
+  8028fd:	4c 89 e2             	mov    %r12,%rdx
+  802900:	48 29 f2             	sub    %rsi,%rdx
+  802903:	4c 01 f6             	add    %r14,%rsi
+  802906:	44 89 ef             	mov    %r13d,%edi
+  802909:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  80290c:	85 c0                	test   %eax,%eax
+  80290e:	78 20                	js     802930 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  802910:	01 c3                	add    %eax,%ebx
+  802912:	85 c0                	test   %eax,%eax
+  802914:	74 08                	je     80291e <readn+0x54>
+  802916:	48 63 f3             	movslq %ebx,%rsi
+  802919:	4c 39 e6             	cmp    %r12,%rsi
+  80291c:	72 df                	jb     8028fd <readn+0x33>
+    }
+    return res;
+  80291e:	48 63 c3             	movslq %ebx,%rax
+}
+  802921:	48 83 c4 08          	add    $0x8,%rsp
+  802925:	5b                   	pop    %rbx
+  802926:	41 5c                	pop    %r12
+  802928:	41 5d                	pop    %r13
+  80292a:	41 5e                	pop    %r14
+  80292c:	41 5f                	pop    %r15
+  80292e:	5d                   	pop    %rbp
+  80292f:	c3                   	ret
+        if (inc < 0) return inc;
+  802930:	48 98                	cltq
+  802932:	eb ed                	jmp    802921 <readn+0x57>
+    int inc = 1, res = 0;
+  802934:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802939:	eb e3                	jmp    80291e <readn+0x54>
+
+000000000080293b <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  80293b:	55                   	push   %rbp
+  80293c:	48 89 e5             	mov    %rsp,%rbp
+  80293f:	41 56                	push   %r14
+  802941:	41 55                	push   %r13
+  802943:	41 54                	push   %r12
+  802945:	53                   	push   %rbx
+  802946:	48 83 ec 10          	sub    $0x10,%rsp
+  80294a:	89 fb                	mov    %edi,%ebx
+  80294c:	49 89 f4             	mov    %rsi,%r12
+  80294f:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802952:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802956:	48 b8 29 25 80 00 00 	movabs $0x802529,%rax
+  80295d:	00 00 00 
+  802960:	ff d0                	call   *%rax
+  802962:	85 c0                	test   %eax,%eax
+  802964:	78 47                	js     8029ad <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802966:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80296a:	41 8b 3e             	mov    (%r14),%edi
+  80296d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802971:	48 b8 74 25 80 00 00 	movabs $0x802574,%rax
+  802978:	00 00 00 
+  80297b:	ff d0                	call   *%rax
+  80297d:	85 c0                	test   %eax,%eax
+  80297f:	78 30                	js     8029b1 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802981:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  802986:	74 2d                	je     8029b5 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802988:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80298c:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802990:	48 85 c0             	test   %rax,%rax
+  802993:	74 56                	je     8029eb <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  802995:	4c 89 ea             	mov    %r13,%rdx
+  802998:	4c 89 e6             	mov    %r12,%rsi
+  80299b:	4c 89 f7             	mov    %r14,%rdi
+  80299e:	ff d0                	call   *%rax
+}
+  8029a0:	48 83 c4 10          	add    $0x10,%rsp
+  8029a4:	5b                   	pop    %rbx
+  8029a5:	41 5c                	pop    %r12
+  8029a7:	41 5d                	pop    %r13
+  8029a9:	41 5e                	pop    %r14
+  8029ab:	5d                   	pop    %rbp
+  8029ac:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8029ad:	48 98                	cltq
+  8029af:	eb ef                	jmp    8029a0 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8029b1:	48 98                	cltq
+  8029b3:	eb eb                	jmp    8029a0 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8029b5:	48 a1 00 10 81 00 00 	movabs 0x811000,%rax
+  8029bc:	00 00 00 
+  8029bf:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8029c5:	89 da                	mov    %ebx,%edx
+  8029c7:	48 bf e5 5e 80 00 00 	movabs $0x805ee5,%rdi
+  8029ce:	00 00 00 
+  8029d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029d6:	48 b9 1d 10 80 00 00 	movabs $0x80101d,%rcx
+  8029dd:	00 00 00 
+  8029e0:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8029e2:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8029e9:	eb b5                	jmp    8029a0 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8029eb:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8029f2:	eb ac                	jmp    8029a0 <write+0x65>
+
+00000000008029f4 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8029f4:	55                   	push   %rbp
+  8029f5:	48 89 e5             	mov    %rsp,%rbp
+  8029f8:	41 54                	push   %r12
+  8029fa:	53                   	push   %rbx
+  8029fb:	48 83 ec 10          	sub    $0x10,%rsp
+  8029ff:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802a01:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802a05:	48 b8 29 25 80 00 00 	movabs $0x802529,%rax
+  802a0c:	00 00 00 
+  802a0f:	ff d0                	call   *%rax
+  802a11:	85 c0                	test   %eax,%eax
+  802a13:	78 3e                	js     802a53 <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802a15:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802a19:	41 8b 3c 24          	mov    (%r12),%edi
+  802a1d:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802a21:	48 b8 74 25 80 00 00 	movabs $0x802574,%rax
+  802a28:	00 00 00 
+  802a2b:	ff d0                	call   *%rax
+  802a2d:	85 c0                	test   %eax,%eax
+  802a2f:	78 22                	js     802a53 <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  802a31:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a35:	48 8b 40 38          	mov    0x38(%rax),%rax
+  802a39:	48 85 c0             	test   %rax,%rax
+  802a3c:	74 0b                	je     802a49 <seek+0x55>
+  802a3e:	89 de                	mov    %ebx,%esi
+  802a40:	4c 89 e7             	mov    %r12,%rdi
+  802a43:	ff d0                	call   *%rax
+  802a45:	85 c0                	test   %eax,%eax
+  802a47:	78 0a                	js     802a53 <seek+0x5f>
+
+    fd->fd_offset = offset;
+  802a49:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  802a4e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a53:	48 83 c4 10          	add    $0x10,%rsp
+  802a57:	5b                   	pop    %rbx
+  802a58:	41 5c                	pop    %r12
+  802a5a:	5d                   	pop    %rbp
+  802a5b:	c3                   	ret
+
+0000000000802a5c <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802a5c:	55                   	push   %rbp
+  802a5d:	48 89 e5             	mov    %rsp,%rbp
+  802a60:	41 55                	push   %r13
+  802a62:	41 54                	push   %r12
+  802a64:	53                   	push   %rbx
+  802a65:	48 83 ec 18          	sub    $0x18,%rsp
+  802a69:	89 fb                	mov    %edi,%ebx
+  802a6b:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802a6e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802a72:	48 b8 29 25 80 00 00 	movabs $0x802529,%rax
+  802a79:	00 00 00 
+  802a7c:	ff d0                	call   *%rax
+  802a7e:	85 c0                	test   %eax,%eax
+  802a80:	78 38                	js     802aba <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802a82:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802a86:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  802a8a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802a8e:	48 b8 74 25 80 00 00 	movabs $0x802574,%rax
+  802a95:	00 00 00 
+  802a98:	ff d0                	call   *%rax
+  802a9a:	85 c0                	test   %eax,%eax
+  802a9c:	78 1c                	js     802aba <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802a9e:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  802aa3:	74 20                	je     802ac5 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802aa5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802aa9:	48 8b 40 30          	mov    0x30(%rax),%rax
+  802aad:	48 85 c0             	test   %rax,%rax
+  802ab0:	74 47                	je     802af9 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802ab2:	44 89 e6             	mov    %r12d,%esi
+  802ab5:	4c 89 ef             	mov    %r13,%rdi
+  802ab8:	ff d0                	call   *%rax
+}
+  802aba:	48 83 c4 18          	add    $0x18,%rsp
+  802abe:	5b                   	pop    %rbx
+  802abf:	41 5c                	pop    %r12
+  802ac1:	41 5d                	pop    %r13
+  802ac3:	5d                   	pop    %rbp
+  802ac4:	c3                   	ret
+                thisenv->env_id, fdnum);
+  802ac5:	48 a1 00 10 81 00 00 	movabs 0x811000,%rax
+  802acc:	00 00 00 
+  802acf:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802ad5:	89 da                	mov    %ebx,%edx
+  802ad7:	48 bf a8 5e 80 00 00 	movabs $0x805ea8,%rdi
+  802ade:	00 00 00 
+  802ae1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ae6:	48 b9 1d 10 80 00 00 	movabs $0x80101d,%rcx
+  802aed:	00 00 00 
+  802af0:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802af2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802af7:	eb c1                	jmp    802aba <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802af9:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802afe:	eb ba                	jmp    802aba <ftruncate+0x5e>
+
+0000000000802b00 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802b00:	55                   	push   %rbp
+  802b01:	48 89 e5             	mov    %rsp,%rbp
+  802b04:	41 54                	push   %r12
+  802b06:	53                   	push   %rbx
+  802b07:	48 83 ec 10          	sub    $0x10,%rsp
+  802b0b:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802b0e:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802b12:	48 b8 29 25 80 00 00 	movabs $0x802529,%rax
+  802b19:	00 00 00 
+  802b1c:	ff d0                	call   *%rax
+  802b1e:	85 c0                	test   %eax,%eax
+  802b20:	78 4e                	js     802b70 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802b22:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802b26:	41 8b 3c 24          	mov    (%r12),%edi
+  802b2a:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802b2e:	48 b8 74 25 80 00 00 	movabs $0x802574,%rax
+  802b35:	00 00 00 
+  802b38:	ff d0                	call   *%rax
+  802b3a:	85 c0                	test   %eax,%eax
+  802b3c:	78 32                	js     802b70 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802b3e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802b42:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802b47:	74 30                	je     802b79 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802b49:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802b4c:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802b53:	00 00 00 
+    stat->st_isdir = 0;
+  802b56:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802b5d:	00 00 00 
+    stat->st_dev = dev;
+  802b60:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802b67:	48 89 de             	mov    %rbx,%rsi
+  802b6a:	4c 89 e7             	mov    %r12,%rdi
+  802b6d:	ff 50 28             	call   *0x28(%rax)
+}
+  802b70:	48 83 c4 10          	add    $0x10,%rsp
+  802b74:	5b                   	pop    %rbx
+  802b75:	41 5c                	pop    %r12
+  802b77:	5d                   	pop    %rbp
+  802b78:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802b79:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802b7e:	eb f0                	jmp    802b70 <fstat+0x70>
+
+0000000000802b80 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802b80:	55                   	push   %rbp
+  802b81:	48 89 e5             	mov    %rsp,%rbp
+  802b84:	41 54                	push   %r12
+  802b86:	53                   	push   %rbx
+  802b87:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802b8a:	be 00 00 00 00       	mov    $0x0,%esi
+  802b8f:	48 b8 ee 3c 80 00 00 	movabs $0x803cee,%rax
+  802b96:	00 00 00 
+  802b99:	ff d0                	call   *%rax
+  802b9b:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802b9d:	85 c0                	test   %eax,%eax
+  802b9f:	78 25                	js     802bc6 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802ba1:	4c 89 e6             	mov    %r12,%rsi
+  802ba4:	89 c7                	mov    %eax,%edi
+  802ba6:	48 b8 00 2b 80 00 00 	movabs $0x802b00,%rax
+  802bad:	00 00 00 
+  802bb0:	ff d0                	call   *%rax
+  802bb2:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802bb5:	89 df                	mov    %ebx,%edi
+  802bb7:	48 b8 8e 26 80 00 00 	movabs $0x80268e,%rax
+  802bbe:	00 00 00 
+  802bc1:	ff d0                	call   *%rax
+
+    return res;
+  802bc3:	44 89 e3             	mov    %r12d,%ebx
+}
+  802bc6:	89 d8                	mov    %ebx,%eax
+  802bc8:	5b                   	pop    %rbx
+  802bc9:	41 5c                	pop    %r12
+  802bcb:	5d                   	pop    %rbp
+  802bcc:	c3                   	ret
+
+0000000000802bcd <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  802bcd:	48 b8 08 00 82 00 00 	movabs $0x820008,%rax
+  802bd4:	00 00 00 
+  802bd7:	83 38 00             	cmpl   $0x0,(%rax)
+  802bda:	74 0a                	je     802be6 <fsenv+0x19>
+    return envid;
+}
+  802bdc:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  802be3:	00 00 
+  802be5:	c3                   	ret
+fsenv(void) {
+  802be6:	55                   	push   %rbp
+  802be7:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  802bea:	bf 03 00 00 00       	mov    $0x3,%edi
+  802bef:	48 b8 3c 24 80 00 00 	movabs $0x80243c,%rax
+  802bf6:	00 00 00 
+  802bf9:	ff d0                	call   *%rax
+  802bfb:	a3 08 00 82 00 00 00 	movabs %eax,0x820008
+  802c02:	00 00 
+}
+  802c04:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  802c0b:	00 00 
+  802c0d:	5d                   	pop    %rbp
+  802c0e:	c3                   	ret
+
+0000000000802c0f <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  802c0f:	55                   	push   %rbp
+  802c10:	48 89 e5             	mov    %rsp,%rbp
+  802c13:	41 54                	push   %r12
+  802c15:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  802c16:	ba 00 50 00 00       	mov    $0x5000,%edx
+  802c1b:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  802c20:	48 89 de             	mov    %rbx,%rsi
+  802c23:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c28:	48 b8 47 1f 80 00 00 	movabs $0x801f47,%rax
+  802c2f:	00 00 00 
+  802c32:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  802c34:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  802c3b:	00 00 00 
+  802c3e:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  802c44:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802c49:	ba 00 50 00 00       	mov    $0x5000,%edx
+  802c4e:	48 89 de             	mov    %rbx,%rsi
+  802c51:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c56:	48 b8 a1 1e 80 00 00 	movabs $0x801ea1,%rax
+  802c5d:	00 00 00 
+  802c60:	ff d0                	call   *%rax
+  802c62:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  802c64:	85 c0                	test   %eax,%eax
+  802c66:	0f 88 a2 00 00 00    	js     802d0e <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  802c6c:	48 a1 00 10 81 00 00 	movabs 0x811000,%rax
+  802c73:	00 00 00 
+  802c76:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802c7c:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  802c81:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  802c83:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  802c88:	49 bc 20 4e 80 00 00 	movabs $0x804e20,%r12
+  802c8f:	00 00 00 
+  802c92:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  802c95:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  802c9a:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  802c9d:	48 b8 cd 2b 80 00 00 	movabs $0x802bcd,%rax
+  802ca4:	00 00 00 
+  802ca7:	ff d0                	call   *%rax
+  802ca9:	89 c7                	mov    %eax,%edi
+  802cab:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  802cb1:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  802cb6:	48 89 da             	mov    %rbx,%rdx
+  802cb9:	be 09 00 00 00       	mov    $0x9,%esi
+  802cbe:	48 b8 e6 23 80 00 00 	movabs $0x8023e6,%rax
+  802cc5:	00 00 00 
+  802cc8:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  802cca:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802ccf:	ba 00 00 00 00       	mov    $0x0,%edx
+  802cd4:	be 00 00 00 00       	mov    $0x0,%esi
+  802cd9:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cde:	48 b8 c2 23 80 00 00 	movabs $0x8023c2,%rax
+  802ce5:	00 00 00 
+  802ce8:	ff d0                	call   *%rax
+  802cea:	89 c3                	mov    %eax,%ebx
+  802cec:	85 c0                	test   %eax,%eax
+  802cee:	78 25                	js     802d15 <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  802cf0:	48 a1 00 10 81 00 00 	movabs 0x811000,%rax
+  802cf7:	00 00 00 
+  802cfa:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802d00:	a3 00 26 82 00 00 00 	movabs %eax,0x822600
+  802d07:	00 00 
+    return 0;
+  802d09:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  802d0e:	89 d8                	mov    %ebx,%eax
+  802d10:	5b                   	pop    %rbx
+  802d11:	41 5c                	pop    %r12
+  802d13:	5d                   	pop    %rbp
+  802d14:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  802d15:	ba 00 50 00 00       	mov    $0x5000,%edx
+  802d1a:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  802d1f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d24:	48 b8 47 1f 80 00 00 	movabs $0x801f47,%rax
+  802d2b:	00 00 00 
+  802d2e:	ff d0                	call   *%rax
+        return res;
+  802d30:	eb dc                	jmp    802d0e <fschan_setup+0xff>
+
+0000000000802d32 <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  802d32:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  802d39:	00 00 00 
+  802d3c:	80 38 00             	cmpb   $0x0,(%rax)
+  802d3f:	74 55                	je     802d96 <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802d41:	48 a1 00 10 81 00 00 	movabs 0x811000,%rax
+  802d48:	00 00 00 
+  802d4b:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  802d51:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802d56:	48 ba 00 26 82 00 00 	movabs $0x822600,%rdx
+  802d5d:	00 00 00 
+  802d60:	3b 0a                	cmp    (%rdx),%ecx
+  802d62:	75 01                	jne    802d65 <fschan+0x33>
+}
+  802d64:	c3                   	ret
+fschan(void) {
+  802d65:	55                   	push   %rbp
+  802d66:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802d69:	48 b8 0f 2c 80 00 00 	movabs $0x802c0f,%rax
+  802d70:	00 00 00 
+  802d73:	ff d0                	call   *%rax
+  802d75:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  802d77:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802d7c:	85 d2                	test   %edx,%edx
+  802d7e:	78 02                	js     802d82 <fschan+0x50>
+}
+  802d80:	5d                   	pop    %rbp
+  802d81:	c3                   	ret
+        fschan_enabled = 0;
+  802d82:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  802d89:	00 00 00 
+  802d8c:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  802d8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d94:	eb ea                	jmp    802d80 <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  802d96:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d9b:	c3                   	ret
+
+0000000000802d9c <fbuf>:
+fbuf(struct Fd *fd) {
+  802d9c:	55                   	push   %rbp
+  802d9d:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  802da0:	48 b8 9b 24 80 00 00 	movabs $0x80249b,%rax
+  802da7:	00 00 00 
+  802daa:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  802dac:	ba 00 00 00 00       	mov    $0x0,%edx
+  802db1:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802db5:	77 12                	ja     802dc9 <fbuf+0x2d>
+  802db7:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  802dbb:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802dc2:	00 00 00 
+  802dc5:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  802dc9:	48 89 d0             	mov    %rdx,%rax
+  802dcc:	5d                   	pop    %rbp
+  802dcd:	c3                   	ret
+
+0000000000802dce <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  802dce:	55                   	push   %rbp
+  802dcf:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  802dd2:	48 83 c7 40          	add    $0x40,%rdi
+  802dd6:	48 b8 5a 4e 80 00 00 	movabs $0x804e5a,%rax
+  802ddd:	00 00 00 
+  802de0:	ff d0                	call   *%rax
+  802de2:	84 c0                	test   %al,%al
+  802de4:	75 02                	jne    802de8 <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  802de6:	5d                   	pop    %rbp
+  802de7:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  802de8:	48 b8 cd 2b 80 00 00 	movabs $0x802bcd,%rax
+  802def:	00 00 00 
+  802df2:	ff d0                	call   *%rax
+  802df4:	89 c7                	mov    %eax,%edi
+  802df6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802dfc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802e01:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e06:	be 0a 00 00 00       	mov    $0xa,%esi
+  802e0b:	48 b8 e6 23 80 00 00 	movabs $0x8023e6,%rax
+  802e12:	00 00 00 
+  802e15:	ff d0                	call   *%rax
+}
+  802e17:	eb cd                	jmp    802de6 <fschan_publish+0x18>
+
+0000000000802e19 <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  802e19:	55                   	push   %rbp
+  802e1a:	48 89 e5             	mov    %rsp,%rbp
+  802e1d:	41 57                	push   %r15
+  802e1f:	41 56                	push   %r14
+  802e21:	41 55                	push   %r13
+  802e23:	41 54                	push   %r12
+  802e25:	53                   	push   %rbx
+  802e26:	48 83 ec 48          	sub    $0x48,%rsp
+  802e2a:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802e2e:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  802e32:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  802e35:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  802e39:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  802e3c:	48 ba 04 00 82 00 00 	movabs $0x820004,%rdx
+  802e43:	00 00 00 
+  802e46:	8b 02                	mov    (%rdx),%eax
+  802e48:	83 c0 01             	add    $0x1,%eax
+  802e4b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802e50:	0f 44 c1             	cmove  %ecx,%eax
+  802e53:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  802e55:	4d 85 c0             	test   %r8,%r8
+  802e58:	74 2c                	je     802e86 <fschan_rw+0x6d>
+  802e5a:	45 89 ce             	mov    %r9d,%r14d
+  802e5d:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  802e64:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  802e68:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802e6e:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  802e75:	00 
+  802e76:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802e7c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802e81:	e9 41 01 00 00       	jmp    802fc7 <fschan_rw+0x1ae>
+  802e86:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  802e8a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802e8e:	e9 9c 01 00 00       	jmp    80302f <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  802e93:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  802e97:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  802e9a:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  802e9d:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  802ea0:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  802ea4:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  802ea8:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  802eac:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  802eb0:	48 89 da             	mov    %rbx,%rdx
+  802eb3:	48 b8 a3 1b 80 00 00 	movabs $0x801ba3,%rax
+  802eba:	00 00 00 
+  802ebd:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  802ebf:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802ec3:	48 b8 ce 2d 80 00 00 	movabs $0x802dce,%rax
+  802eca:	00 00 00 
+  802ecd:	ff d0                	call   *%rax
+            queued += blk;
+  802ecf:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  802ed2:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  802ed6:	4d 39 fc             	cmp    %r15,%r12
+  802ed9:	73 6b                	jae    802f46 <fschan_rw+0x12d>
+  802edb:	41 83 fd 0f          	cmp    $0xf,%r13d
+  802edf:	77 65                	ja     802f46 <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  802ee1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802ee5:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  802ee9:	48 b8 35 4e 80 00 00 	movabs $0x804e35,%rax
+  802ef0:	00 00 00 
+  802ef3:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  802ef5:	4c 89 fb             	mov    %r15,%rbx
+  802ef8:	4c 29 e3             	sub    %r12,%rbx
+  802efb:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  802f00:	48 39 d3             	cmp    %rdx,%rbx
+  802f03:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  802f07:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  802f0b:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802f0f:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  802f13:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  802f16:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  802f18:	48 b9 04 00 82 00 00 	movabs $0x820004,%rcx
+  802f1f:	00 00 00 
+  802f22:	8b 09                	mov    (%rcx),%ecx
+  802f24:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  802f27:	83 fe 03             	cmp    $0x3,%esi
+  802f2a:	0f 85 63 ff ff ff    	jne    802e93 <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  802f30:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802f34:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  802f37:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  802f3a:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  802f3d:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  802f41:	e9 79 ff ff ff       	jmp    802ebf <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  802f46:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f4a:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  802f51:	48 89 df             	mov    %rbx,%rdi
+  802f54:	48 b8 f8 4e 80 00 00 	movabs $0x804ef8,%rax
+  802f5b:	00 00 00 
+  802f5e:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  802f60:	48 89 df             	mov    %rbx,%rdi
+  802f63:	48 b8 86 4e 80 00 00 	movabs $0x804e86,%rax
+  802f6a:	00 00 00 
+  802f6d:	ff d0                	call   *%rax
+  802f6f:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  802f73:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  802f77:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  802f7b:	75 25                	jne    802fa2 <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  802f7d:	8b 40 04             	mov    0x4(%rax),%eax
+  802f80:	85 c0                	test   %eax,%eax
+  802f82:	0f 88 86 00 00 00    	js     80300e <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  802f88:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  802f8c:	74 5b                	je     802fe9 <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  802f8e:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802f92:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  802f96:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  802f9a:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  802f9e:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  802fa2:	48 89 df             	mov    %rbx,%rdi
+  802fa5:	48 b8 ad 4e 80 00 00 	movabs $0x804ead,%rax
+  802fac:	00 00 00 
+  802faf:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  802fb1:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  802fb5:	83 f0 01             	xor    $0x1,%eax
+  802fb8:	4d 39 fc             	cmp    %r15,%r12
+  802fbb:	0f 92 c2             	setb   %dl
+  802fbe:	84 c2                	test   %al,%dl
+  802fc0:	75 05                	jne    802fc7 <fschan_rw+0x1ae>
+  802fc2:	45 85 ed             	test   %r13d,%r13d
+  802fc5:	74 50                	je     803017 <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  802fc7:	4d 39 fc             	cmp    %r15,%r12
+  802fca:	0f 92 c1             	setb   %cl
+  802fcd:	41 83 fd 0f          	cmp    $0xf,%r13d
+  802fd1:	0f 96 c2             	setbe  %dl
+  802fd4:	84 d1                	test   %dl,%cl
+  802fd6:	0f 84 6a ff ff ff    	je     802f46 <fschan_rw+0x12d>
+  802fdc:	84 c0                	test   %al,%al
+  802fde:	0f 85 fd fe ff ff    	jne    802ee1 <fschan_rw+0xc8>
+  802fe4:	e9 5d ff ff ff       	jmp    802f46 <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  802fe9:	48 63 d0             	movslq %eax,%rdx
+  802fec:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802ff0:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  802ff4:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802ff8:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  802ffc:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  803000:	48 b8 a3 1b 80 00 00 	movabs $0x801ba3,%rax
+  803007:	00 00 00 
+  80300a:	ff d0                	call   *%rax
+  80300c:	eb 80                	jmp    802f8e <fschan_rw+0x175>
+                err = msg->fm_res;
+  80300e:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  803011:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  803015:	eb 8b                	jmp    802fa2 <fschan_rw+0x189>
+    return done || !err ? done : err;
+  803017:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  80301c:	0f 85 68 fe ff ff    	jne    802e8a <fschan_rw+0x71>
+  803022:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  803025:	85 c0                	test   %eax,%eax
+  803027:	0f 84 5d fe ff ff    	je     802e8a <fschan_rw+0x71>
+  80302d:	48 98                	cltq
+}
+  80302f:	48 83 c4 48          	add    $0x48,%rsp
+  803033:	5b                   	pop    %rbx
+  803034:	41 5c                	pop    %r12
+  803036:	41 5d                	pop    %r13
+  803038:	41 5e                	pop    %r14
+  80303a:	41 5f                	pop    %r15
+  80303c:	5d                   	pop    %rbp
+  80303d:	c3                   	ret
+
+000000000080303e <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  80303e:	55                   	push   %rbp
+  80303f:	48 89 e5             	mov    %rsp,%rbp
+  803042:	41 56                	push   %r14
+  803044:	41 55                	push   %r13
+  803046:	41 54                	push   %r12
+  803048:	53                   	push   %rbx
+  803049:	48 83 ec 10          	sub    $0x10,%rsp
+  80304d:	49 89 fe             	mov    %rdi,%r14
+  803050:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  803053:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  803057:	48 29 f3             	sub    %rsi,%rbx
+  80305a:	48 39 d3             	cmp    %rdx,%rbx
+  80305d:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  803061:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  803068:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  803069:	bf 00 10 00 00       	mov    $0x1000,%edi
+  80306e:	49 bd b7 4c 80 00 00 	movabs $0x804cb7,%r13
+  803075:	00 00 00 
+  803078:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  80307f:	76 1e                	jbe    80309f <mmap_fault+0x61>
+  803081:	4c 01 e7             	add    %r12,%rdi
+  803084:	41 ff d5             	call   *%r13
+  803087:	84 c0                	test   %al,%al
+  803089:	75 14                	jne    80309f <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  80308b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80308f:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  803096:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  80309a:	48 39 df             	cmp    %rbx,%rdi
+  80309d:	72 e2                	jb     803081 <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  80309f:	48 bb 00 10 82 00 00 	movabs $0x821000,%rbx
+  8030a6:	00 00 00 
+  8030a9:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  8030b0:	00 00 00 
+  8030b3:	4c 89 f0             	mov    %r14,%rax
+  8030b6:	48 29 d0             	sub    %rdx,%rax
+  8030b9:	48 c1 f8 03          	sar    $0x3,%rax
+  8030bd:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  8030c4:	aa aa aa 
+  8030c7:	48 0f af c2          	imul   %rdx,%rax
+  8030cb:	48 c1 e0 0c          	shl    $0xc,%rax
+  8030cf:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  8030d4:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  8030d8:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  8030da:	44 89 e0             	mov    %r12d,%eax
+  8030dd:	41 03 46 10          	add    0x10(%r14),%eax
+  8030e1:	41 2b 06             	sub    (%r14),%eax
+  8030e4:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  8030e7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8030eb:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  8030ef:	41 8b 46 14          	mov    0x14(%r14),%eax
+  8030f3:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  8030f6:	48 b8 cd 2b 80 00 00 	movabs $0x802bcd,%rax
+  8030fd:	00 00 00 
+  803100:	ff d0                	call   *%rax
+  803102:	89 c7                	mov    %eax,%edi
+  803104:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80310a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80310f:	48 89 da             	mov    %rbx,%rdx
+  803112:	be 0f 00 00 00       	mov    $0xf,%esi
+  803117:	48 b8 e6 23 80 00 00 	movabs $0x8023e6,%rax
+  80311e:	00 00 00 
+  803121:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  803123:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803128:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80312c:	4c 89 e6             	mov    %r12,%rsi
+  80312f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803134:	48 b8 c2 23 80 00 00 	movabs $0x8023c2,%rax
+  80313b:	00 00 00 
+  80313e:	ff d0                	call   *%rax
+  803140:	48 98                	cltq
+}
+  803142:	48 83 c4 10          	add    $0x10,%rsp
+  803146:	5b                   	pop    %rbx
+  803147:	41 5c                	pop    %r12
+  803149:	41 5d                	pop    %r13
+  80314b:	41 5e                	pop    %r14
+  80314d:	5d                   	pop    %rbp
+  80314e:	c3                   	ret
+
+000000000080314f <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  80314f:	48 8b 37             	mov    (%rdi),%rsi
+  803152:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  803159:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  803160:	00 00 00 
+  803163:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803168:	eb 0f                	jmp    803179 <mmap_pgfault+0x2a>
+  80316a:	c3                   	ret
+  80316b:	48 83 c1 01          	add    $0x1,%rcx
+  80316f:	48 83 c2 18          	add    $0x18,%rdx
+  803173:	48 83 f9 20          	cmp    $0x20,%rcx
+  803177:	74 6e                	je     8031e7 <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  803179:	48 8b 02             	mov    (%rdx),%rax
+  80317c:	48 83 e8 01          	sub    $0x1,%rax
+  803180:	48 39 f0             	cmp    %rsi,%rax
+  803183:	73 e6                	jae    80316b <mmap_pgfault+0x1c>
+  803185:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  803189:	73 e0                	jae    80316b <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  80318b:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  80318f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803194:	f6 c2 01             	test   $0x1,%dl
+  803197:	75 d1                	jne    80316a <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  803199:	f6 c2 02             	test   $0x2,%dl
+  80319c:	74 1a                	je     8031b8 <mmap_pgfault+0x69>
+  80319e:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  8031a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031a7:	48 bf 00 20 82 00 00 	movabs $0x822000,%rdi
+  8031ae:	00 00 00 
+  8031b1:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  8031b6:	74 35                	je     8031ed <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  8031b8:	55                   	push   %rbp
+  8031b9:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  8031bc:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  8031c0:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8031c7:	00 00 00 
+  8031ca:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  8031ce:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8031d3:	48 b8 3e 30 80 00 00 	movabs $0x80303e,%rax
+  8031da:	00 00 00 
+  8031dd:	ff d0                	call   *%rax
+  8031df:	48 85 c0             	test   %rax,%rax
+  8031e2:	0f 9f c0             	setg   %al
+}
+  8031e5:	5d                   	pop    %rbp
+  8031e6:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  8031e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031ec:	c3                   	ret
+}
+  8031ed:	c3                   	ret
+
+00000000008031ee <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  8031ee:	55                   	push   %rbp
+  8031ef:	48 89 e5             	mov    %rsp,%rbp
+  8031f2:	41 54                	push   %r12
+  8031f4:	53                   	push   %rbx
+  8031f5:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8031f8:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8031ff:	00 00 00 
+  803202:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  803207:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80320b:	74 15                	je     803222 <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80320d:	48 83 c3 01          	add    $0x1,%rbx
+  803211:	48 83 c0 18          	add    $0x18,%rax
+  803215:	48 83 fb 20          	cmp    $0x20,%rbx
+  803219:	75 ec                	jne    803207 <mmap_alloc+0x19>
+    return NULL;
+  80321b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803220:	eb 52                	jmp    803274 <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  803222:	4c 89 e7             	mov    %r12,%rdi
+  803225:	48 b8 58 4c 80 00 00 	movabs $0x804c58,%rax
+  80322c:	00 00 00 
+  80322f:	ff d0                	call   *%rax
+  803231:	41 89 c1             	mov    %eax,%r9d
+  803234:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  80323b:	48 c1 e1 0c          	shl    $0xc,%rcx
+  80323f:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803245:	ba 00 00 00 00       	mov    $0x0,%edx
+  80324a:	4c 89 e6             	mov    %r12,%rsi
+  80324d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803252:	48 b8 f7 1e 80 00 00 	movabs $0x801ef7,%rax
+  803259:	00 00 00 
+  80325c:	ff d0                	call   *%rax
+  80325e:	85 c0                	test   %eax,%eax
+  803260:	78 17                	js     803279 <mmap_alloc+0x8b>
+        return &mmaps[i];
+  803262:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  803266:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  80326d:	00 00 00 
+  803270:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  803274:	5b                   	pop    %rbx
+  803275:	41 5c                	pop    %r12
+  803277:	5d                   	pop    %rbp
+  803278:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  803279:	b8 00 00 00 00       	mov    $0x0,%eax
+  80327e:	eb f4                	jmp    803274 <mmap_alloc+0x86>
+
+0000000000803280 <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  803280:	55                   	push   %rbp
+  803281:	48 89 e5             	mov    %rsp,%rbp
+  803284:	41 56                	push   %r14
+  803286:	41 55                	push   %r13
+  803288:	41 54                	push   %r12
+  80328a:	53                   	push   %rbx
+  80328b:	48 83 ec 10          	sub    $0x10,%rsp
+  80328f:	41 89 fc             	mov    %edi,%r12d
+  803292:	49 89 f5             	mov    %rsi,%r13
+  803295:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  803298:	48 89 f0             	mov    %rsi,%rax
+  80329b:	48 09 d0             	or     %rdx,%rax
+  80329e:	75 0d                	jne    8032ad <fsipc+0x2d>
+  8032a0:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  8032a3:	83 f8 04             	cmp    $0x4,%eax
+  8032a6:	76 7d                	jbe    803325 <fsipc+0xa5>
+  8032a8:	83 ff 0d             	cmp    $0xd,%edi
+  8032ab:	74 78                	je     803325 <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  8032ad:	48 b8 cd 2b 80 00 00 	movabs $0x802bcd,%rax
+  8032b4:	00 00 00 
+  8032b7:	ff d0                	call   *%rax
+  8032b9:	89 c7                	mov    %eax,%edi
+  8032bb:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  8032c2:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  8032c9:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  8032d0:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8032d6:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  8032dd:	00 00 00 
+  8032e0:	44 89 e6             	mov    %r12d,%esi
+  8032e3:	48 b8 e6 23 80 00 00 	movabs $0x8023e6,%rax
+  8032ea:	00 00 00 
+  8032ed:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  8032ef:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8032f6:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  8032f7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8032fc:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803300:	4c 89 ee             	mov    %r13,%rsi
+  803303:	bf 00 00 00 00       	mov    $0x0,%edi
+  803308:	48 b8 c2 23 80 00 00 	movabs $0x8023c2,%rax
+  80330f:	00 00 00 
+  803312:	ff d0                	call   *%rax
+  803314:	89 c3                	mov    %eax,%ebx
+}
+  803316:	89 d8                	mov    %ebx,%eax
+  803318:	48 83 c4 10          	add    $0x10,%rsp
+  80331c:	5b                   	pop    %rbx
+  80331d:	41 5c                	pop    %r12
+  80331f:	41 5d                	pop    %r13
+  803321:	41 5e                	pop    %r14
+  803323:	5d                   	pop    %rbp
+  803324:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  803325:	48 b8 32 2d 80 00 00 	movabs $0x802d32,%rax
+  80332c:	00 00 00 
+  80332f:	ff d0                	call   *%rax
+  803331:	49 89 c6             	mov    %rax,%r14
+  803334:	48 85 c0             	test   %rax,%rax
+  803337:	0f 84 70 ff ff ff    	je     8032ad <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  80333d:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  803341:	48 b8 35 4e 80 00 00 	movabs $0x804e35,%rax
+  803348:	00 00 00 
+  80334b:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  80334d:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  803350:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  803357:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  80335b:	ba 10 00 00 00       	mov    $0x10,%edx
+  803360:	48 be 00 00 83 00 00 	movabs $0x830000,%rsi
+  803367:	00 00 00 
+  80336a:	48 b8 a3 1b 80 00 00 	movabs $0x801ba3,%rax
+  803371:	00 00 00 
+  803374:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  803376:	4c 89 f7             	mov    %r14,%rdi
+  803379:	48 b8 ce 2d 80 00 00 	movabs $0x802dce,%rax
+  803380:	00 00 00 
+  803383:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  803385:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  80338c:	4c 89 f7             	mov    %r14,%rdi
+  80338f:	48 b8 f8 4e 80 00 00 	movabs $0x804ef8,%rax
+  803396:	00 00 00 
+  803399:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  80339b:	4c 89 f7             	mov    %r14,%rdi
+  80339e:	48 b8 86 4e 80 00 00 	movabs $0x804e86,%rax
+  8033a5:	00 00 00 
+  8033a8:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  8033aa:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  8033ad:	41 83 fc 05          	cmp    $0x5,%r12d
+  8033b1:	75 04                	jne    8033b7 <fsipc+0x137>
+  8033b3:	85 db                	test   %ebx,%ebx
+  8033b5:	79 14                	jns    8033cb <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  8033b7:	4c 89 f7             	mov    %r14,%rdi
+  8033ba:	48 b8 ad 4e 80 00 00 	movabs $0x804ead,%rax
+  8033c1:	00 00 00 
+  8033c4:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  8033c6:	e9 4b ff ff ff       	jmp    803316 <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  8033cb:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  8033cf:	ba 88 00 00 00       	mov    $0x88,%edx
+  8033d4:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  8033db:	00 00 00 
+  8033de:	48 b8 a3 1b 80 00 00 	movabs $0x801ba3,%rax
+  8033e5:	00 00 00 
+  8033e8:	ff d0                	call   *%rax
+  8033ea:	eb cb                	jmp    8033b7 <fsipc+0x137>
+
+00000000008033ec <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  8033ec:	55                   	push   %rbp
+  8033ed:	48 89 e5             	mov    %rsp,%rbp
+  8033f0:	41 57                	push   %r15
+  8033f2:	41 56                	push   %r14
+  8033f4:	41 55                	push   %r13
+  8033f6:	41 54                	push   %r12
+  8033f8:	53                   	push   %rbx
+  8033f9:	48 83 ec 18          	sub    $0x18,%rsp
+  8033fd:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  803401:	49 89 f6             	mov    %rsi,%r14
+  803404:	49 89 d4             	mov    %rdx,%r12
+  803407:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  80340a:	48 b8 32 2d 80 00 00 	movabs $0x802d32,%rax
+  803411:	00 00 00 
+  803414:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  803416:	48 85 c0             	test   %rax,%rax
+  803419:	0f 85 96 00 00 00    	jne    8034b5 <devfile_write_direct+0xc9>
+    size_t write = 0;
+  80341f:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803426:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803427:	49 bf 00 00 83 00 00 	movabs $0x830000,%r15
+  80342e:	00 00 00 
+    while (n) {
+  803431:	4d 85 e4             	test   %r12,%r12
+  803434:	74 79                	je     8034af <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  803436:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  80343b:	49 39 dc             	cmp    %rbx,%r12
+  80343e:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  803442:	48 89 da             	mov    %rbx,%rdx
+  803445:	4c 89 f6             	mov    %r14,%rsi
+  803448:	48 bf 00 10 83 00 00 	movabs $0x831000,%rdi
+  80344f:	00 00 00 
+  803452:	48 b8 a3 1b 80 00 00 	movabs $0x801ba3,%rax
+  803459:	00 00 00 
+  80345c:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80345e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803462:	8b 40 0c             	mov    0xc(%rax),%eax
+  803465:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  803468:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  80346b:	44 01 e8             	add    %r13d,%eax
+  80346e:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  803472:	41 0f 44 c5          	cmove  %r13d,%eax
+  803476:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  80347a:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  80347e:	48 89 da             	mov    %rbx,%rdx
+  803481:	be 00 00 00 00       	mov    $0x0,%esi
+  803486:	bf 04 00 00 00       	mov    $0x4,%edi
+  80348b:	48 b8 80 32 80 00 00 	movabs $0x803280,%rax
+  803492:	00 00 00 
+  803495:	ff d0                	call   *%rax
+        if (res < 0)
+  803497:	85 c0                	test   %eax,%eax
+  803499:	78 4a                	js     8034e5 <devfile_write_direct+0xf9>
+        buf += res;
+  80349b:	48 98                	cltq
+  80349d:	49 01 c6             	add    %rax,%r14
+        write += res;
+  8034a0:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  8034a4:	49 29 c4             	sub    %rax,%r12
+  8034a7:	75 8d                	jne    803436 <devfile_write_direct+0x4a>
+    return write;
+  8034a9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8034ad:	eb 27                	jmp    8034d6 <devfile_write_direct+0xea>
+    size_t write = 0;
+  8034af:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  8034b3:	eb f4                	jmp    8034a9 <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  8034b5:	45 89 e9             	mov    %r13d,%r9d
+  8034b8:	4d 89 e0             	mov    %r12,%r8
+  8034bb:	4c 89 f1             	mov    %r14,%rcx
+  8034be:	ba 04 00 00 00       	mov    $0x4,%edx
+  8034c3:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8034c7:	48 89 c7             	mov    %rax,%rdi
+  8034ca:	48 b8 19 2e 80 00 00 	movabs $0x802e19,%rax
+  8034d1:	00 00 00 
+  8034d4:	ff d0                	call   *%rax
+}
+  8034d6:	48 83 c4 18          	add    $0x18,%rsp
+  8034da:	5b                   	pop    %rbx
+  8034db:	41 5c                	pop    %r12
+  8034dd:	41 5d                	pop    %r13
+  8034df:	41 5e                	pop    %r14
+  8034e1:	41 5f                	pop    %r15
+  8034e3:	5d                   	pop    %rbp
+  8034e4:	c3                   	ret
+            return res;
+  8034e5:	48 98                	cltq
+  8034e7:	eb ed                	jmp    8034d6 <devfile_write_direct+0xea>
+
+00000000008034e9 <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  8034e9:	55                   	push   %rbp
+  8034ea:	48 89 e5             	mov    %rsp,%rbp
+  8034ed:	41 54                	push   %r12
+  8034ef:	53                   	push   %rbx
+  8034f0:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  8034f3:	48 b8 9c 2d 80 00 00 	movabs $0x802d9c,%rax
+  8034fa:	00 00 00 
+  8034fd:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  8034ff:	48 85 c0             	test   %rax,%rax
+  803502:	74 71                	je     803575 <fbuf_flush+0x8c>
+  803504:	48 89 c3             	mov    %rax,%rbx
+  803507:	b8 00 00 00 00       	mov    $0x0,%eax
+  80350c:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  803510:	75 05                	jne    803517 <fbuf_flush+0x2e>
+}
+  803512:	5b                   	pop    %rbx
+  803513:	41 5c                	pop    %r12
+  803515:	5d                   	pop    %rbp
+  803516:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  803517:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  80351a:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  80351e:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  803525:	00 00 00 
+  803528:	48 89 de             	mov    %rbx,%rsi
+  80352b:	48 29 c6             	sub    %rax,%rsi
+  80352e:	48 c1 fe 03          	sar    $0x3,%rsi
+  803532:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  803539:	aa aa aa 
+  80353c:	48 0f af f0          	imul   %rax,%rsi
+  803540:	48 c1 e6 0e          	shl    $0xe,%rsi
+  803544:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  803549:	48 01 c6             	add    %rax,%rsi
+  80354c:	4c 89 e7             	mov    %r12,%rdi
+  80354f:	48 b8 ec 33 80 00 00 	movabs $0x8033ec,%rax
+  803556:	00 00 00 
+  803559:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  80355b:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  80355f:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  803566:	00 
+    return res < 0 ? res : 0;
+  803567:	48 85 c0             	test   %rax,%rax
+  80356a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80356f:	48 0f 4f c2          	cmovg  %rdx,%rax
+  803573:	eb 9d                	jmp    803512 <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  803575:	b8 00 00 00 00       	mov    $0x0,%eax
+  80357a:	eb 96                	jmp    803512 <fbuf_flush+0x29>
+
+000000000080357c <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  80357c:	55                   	push   %rbp
+  80357d:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  803580:	48 b8 e9 34 80 00 00 	movabs $0x8034e9,%rax
+  803587:	00 00 00 
+  80358a:	ff d0                	call   *%rax
+}
+  80358c:	5d                   	pop    %rbp
+  80358d:	c3                   	ret
+
+000000000080358e <devfile_write>:
+    if (!fd || !buf)
+  80358e:	48 85 ff             	test   %rdi,%rdi
+  803591:	0f 84 d3 01 00 00    	je     80376a <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803597:	55                   	push   %rbp
+  803598:	48 89 e5             	mov    %rsp,%rbp
+  80359b:	41 57                	push   %r15
+  80359d:	41 56                	push   %r14
+  80359f:	41 55                	push   %r13
+  8035a1:	41 54                	push   %r12
+  8035a3:	53                   	push   %rbx
+  8035a4:	48 83 ec 08          	sub    $0x8,%rsp
+  8035a8:	49 89 fc             	mov    %rdi,%r12
+  8035ab:	49 89 f6             	mov    %rsi,%r14
+  8035ae:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  8035b1:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  8035b6:	48 85 f6             	test   %rsi,%rsi
+  8035b9:	0f 84 9c 01 00 00    	je     80375b <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  8035bf:	48 b8 9c 2d 80 00 00 	movabs $0x802d9c,%rax
+  8035c6:	00 00 00 
+  8035c9:	ff d0                	call   *%rax
+  8035cb:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  8035ce:	48 85 c0             	test   %rax,%rax
+  8035d1:	0f 84 a2 00 00 00    	je     803679 <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  8035d7:	be 00 10 00 00       	mov    $0x1000,%esi
+  8035dc:	4c 89 e7             	mov    %r12,%rdi
+  8035df:	48 b8 66 1e 80 00 00 	movabs $0x801e66,%rax
+  8035e6:	00 00 00 
+  8035e9:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  8035eb:	83 f8 02             	cmp    $0x2,%eax
+  8035ee:	0f 8f 85 00 00 00    	jg     803679 <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  8035f4:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8035fb:	00 00 00 
+  8035fe:	4d 89 ef             	mov    %r13,%r15
+  803601:	49 29 c7             	sub    %rax,%r15
+  803604:	49 c1 ff 03          	sar    $0x3,%r15
+  803608:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  80360f:	aa aa aa 
+  803612:	4c 0f af f8          	imul   %rax,%r15
+  803616:	49 c1 e7 0e          	shl    $0xe,%r15
+  80361a:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  80361f:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  803622:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  803627:	0f 84 d7 00 00 00    	je     803704 <devfile_write+0x176>
+  80362d:	49 8b 45 10          	mov    0x10(%r13),%rax
+  803631:	89 c2                	mov    %eax,%edx
+  803633:	41 03 55 0c          	add    0xc(%r13),%edx
+  803637:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  80363c:	75 0f                	jne    80364d <devfile_write+0xbf>
+  80363e:	48 01 d8             	add    %rbx,%rax
+  803641:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  803647:	0f 86 92 00 00 00    	jbe    8036df <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  80364d:	4c 89 e7             	mov    %r12,%rdi
+  803650:	48 b8 e9 34 80 00 00 	movabs $0x8034e9,%rax
+  803657:	00 00 00 
+  80365a:	ff d0                	call   *%rax
+  80365c:	85 c0                	test   %eax,%eax
+  80365e:	78 52                	js     8036b2 <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  803660:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  803667:	77 7f                	ja     8036e8 <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  803669:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  80366e:	0f 85 c2 00 00 00    	jne    803736 <devfile_write+0x1a8>
+  803674:	e9 94 00 00 00       	jmp    80370d <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  803679:	4c 89 e7             	mov    %r12,%rdi
+  80367c:	48 b8 e9 34 80 00 00 	movabs $0x8034e9,%rax
+  803683:	00 00 00 
+  803686:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  803688:	85 c0                	test   %eax,%eax
+  80368a:	79 07                	jns    803693 <devfile_write+0x105>
+  80368c:	48 98                	cltq
+  80368e:	e9 c8 00 00 00       	jmp    80375b <devfile_write+0x1cd>
+  803693:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  803698:	48 89 da             	mov    %rbx,%rdx
+  80369b:	4c 89 f6             	mov    %r14,%rsi
+  80369e:	4c 89 e7             	mov    %r12,%rdi
+  8036a1:	48 b8 ec 33 80 00 00 	movabs $0x8033ec,%rax
+  8036a8:	00 00 00 
+  8036ab:	ff d0                	call   *%rax
+  8036ad:	e9 a9 00 00 00       	jmp    80375b <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  8036b2:	48 98                	cltq
+  8036b4:	e9 a2 00 00 00       	jmp    80375b <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8036b9:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8036be:	ba 00 40 00 00       	mov    $0x4000,%edx
+  8036c3:	4c 89 fe             	mov    %r15,%rsi
+  8036c6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036cb:	48 b8 a1 1e 80 00 00 	movabs $0x801ea1,%rax
+  8036d2:	00 00 00 
+  8036d5:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  8036d7:	85 c0                	test   %eax,%eax
+  8036d9:	79 45                	jns    803720 <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8036db:	48 98                	cltq
+  8036dd:	eb 7c                	jmp    80375b <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  8036df:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  8036e6:	76 4e                	jbe    803736 <devfile_write+0x1a8>
+  8036e8:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  8036ed:	48 89 da             	mov    %rbx,%rdx
+  8036f0:	4c 89 f6             	mov    %r14,%rsi
+  8036f3:	4c 89 e7             	mov    %r12,%rdi
+  8036f6:	48 b8 ec 33 80 00 00 	movabs $0x8033ec,%rax
+  8036fd:	00 00 00 
+  803700:	ff d0                	call   *%rax
+  803702:	eb 57                	jmp    80375b <devfile_write+0x1cd>
+  803704:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  80370b:	77 db                	ja     8036e8 <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  80370d:	4c 89 ff             	mov    %r15,%rdi
+  803710:	48 b8 b7 4c 80 00 00 	movabs $0x804cb7,%rax
+  803717:	00 00 00 
+  80371a:	ff d0                	call   *%rax
+  80371c:	84 c0                	test   %al,%al
+  80371e:	74 99                	je     8036b9 <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  803720:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  803725:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80372a:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  80372e:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  803735:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  803736:	4c 89 ff             	mov    %r15,%rdi
+  803739:	49 03 7d 10          	add    0x10(%r13),%rdi
+  80373d:	48 89 da             	mov    %rbx,%rdx
+  803740:	4c 89 f6             	mov    %r14,%rsi
+  803743:	48 b8 a3 1b 80 00 00 	movabs $0x801ba3,%rax
+  80374a:	00 00 00 
+  80374d:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  80374f:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  803753:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  803758:	48 89 d8             	mov    %rbx,%rax
+}
+  80375b:	48 83 c4 08          	add    $0x8,%rsp
+  80375f:	5b                   	pop    %rbx
+  803760:	41 5c                	pop    %r12
+  803762:	41 5d                	pop    %r13
+  803764:	41 5e                	pop    %r14
+  803766:	41 5f                	pop    %r15
+  803768:	5d                   	pop    %rbp
+  803769:	c3                   	ret
+        return E_INVAL;
+  80376a:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  80376f:	c3                   	ret
+
+0000000000803770 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  803770:	55                   	push   %rbp
+  803771:	48 89 e5             	mov    %rsp,%rbp
+  803774:	41 54                	push   %r12
+  803776:	53                   	push   %rbx
+  803777:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  80377a:	48 b8 e9 34 80 00 00 	movabs $0x8034e9,%rax
+  803781:	00 00 00 
+  803784:	ff d0                	call   *%rax
+  803786:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  803789:	48 89 df             	mov    %rbx,%rdi
+  80378c:	48 b8 9c 2d 80 00 00 	movabs $0x802d9c,%rax
+  803793:	00 00 00 
+  803796:	ff d0                	call   *%rax
+  803798:	48 85 c0             	test   %rax,%rax
+  80379b:	74 17                	je     8037b4 <devfile_flush+0x44>
+  80379d:	48 89 df             	mov    %rbx,%rdi
+  8037a0:	48 b8 9c 2d 80 00 00 	movabs $0x802d9c,%rax
+  8037a7:	00 00 00 
+  8037aa:	ff d0                	call   *%rax
+  8037ac:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  8037b3:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8037b4:	8b 43 0c             	mov    0xc(%rbx),%eax
+  8037b7:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  8037be:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  8037c0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8037c5:	be 00 00 00 00       	mov    $0x0,%esi
+  8037ca:	bf 06 00 00 00       	mov    $0x6,%edi
+  8037cf:	48 b8 80 32 80 00 00 	movabs $0x803280,%rax
+  8037d6:	00 00 00 
+  8037d9:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  8037db:	45 85 e4             	test   %r12d,%r12d
+  8037de:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  8037e2:	5b                   	pop    %rbx
+  8037e3:	41 5c                	pop    %r12
+  8037e5:	5d                   	pop    %rbp
+  8037e6:	c3                   	ret
+
+00000000008037e7 <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  8037e7:	55                   	push   %rbp
+  8037e8:	48 89 e5             	mov    %rsp,%rbp
+  8037eb:	41 57                	push   %r15
+  8037ed:	41 56                	push   %r14
+  8037ef:	41 55                	push   %r13
+  8037f1:	41 54                	push   %r12
+  8037f3:	53                   	push   %rbx
+  8037f4:	48 83 ec 38          	sub    $0x38,%rsp
+  8037f8:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8037fc:	49 89 f7             	mov    %rsi,%r15
+  8037ff:	48 89 d3             	mov    %rdx,%rbx
+  803802:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  803805:	48 b8 32 2d 80 00 00 	movabs $0x802d32,%rax
+  80380c:	00 00 00 
+  80380f:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  803811:	48 85 c0             	test   %rax,%rax
+  803814:	75 20                	jne    803836 <devfile_read_direct+0x4f>
+    bool map = 1;
+  803816:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  80381b:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  803822:	00 
+    while (n) {
+  803823:	48 85 db             	test   %rbx,%rbx
+  803826:	0f 85 df 00 00 00    	jne    80390b <devfile_read_direct+0x124>
+    size_t read = 0;
+  80382c:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  803830:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803834:	eb 21                	jmp    803857 <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  803836:	45 89 f1             	mov    %r14d,%r9d
+  803839:	49 89 d8             	mov    %rbx,%r8
+  80383c:	4c 89 f9             	mov    %r15,%rcx
+  80383f:	ba 03 00 00 00       	mov    $0x3,%edx
+  803844:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  803848:	48 89 c7             	mov    %rax,%rdi
+  80384b:	48 b8 19 2e 80 00 00 	movabs $0x802e19,%rax
+  803852:	00 00 00 
+  803855:	ff d0                	call   *%rax
+}
+  803857:	48 83 c4 38          	add    $0x38,%rsp
+  80385b:	5b                   	pop    %rbx
+  80385c:	41 5c                	pop    %r12
+  80385e:	41 5d                	pop    %r13
+  803860:	41 5e                	pop    %r14
+  803862:	41 5f                	pop    %r15
+  803864:	5d                   	pop    %rbp
+  803865:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  803866:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80386a:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  803870:	75 1e                	jne    803890 <devfile_read_direct+0xa9>
+  803872:	e9 e2 00 00 00       	jmp    803959 <devfile_read_direct+0x172>
+            if (!res) return read;
+  803877:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80387b:	eb da                	jmp    803857 <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  80387d:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  803881:	0f 85 d0 01 00 00    	jne    803a57 <devfile_read_direct+0x270>
+            map = 0;
+  803887:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  80388b:	eb 03                	jmp    803890 <devfile_read_direct+0xa9>
+  80388d:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  803890:	ba 00 00 01 00       	mov    $0x10000,%edx
+  803895:	48 39 d3             	cmp    %rdx,%rbx
+  803898:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80389c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8038a0:	8b 40 0c             	mov    0xc(%rax),%eax
+  8038a3:	48 b9 00 00 83 00 00 	movabs $0x830000,%rcx
+  8038aa:	00 00 00 
+  8038ad:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  8038af:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  8038b3:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  8038b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8038bc:	bf 03 00 00 00       	mov    $0x3,%edi
+  8038c1:	48 b8 80 32 80 00 00 	movabs $0x803280,%rax
+  8038c8:	00 00 00 
+  8038cb:	ff d0                	call   *%rax
+        if (res <= 0)
+  8038cd:	85 c0                	test   %eax,%eax
+  8038cf:	0f 8e 63 01 00 00    	jle    803a38 <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  8038d5:	4c 63 e0             	movslq %eax,%r12
+  8038d8:	4c 89 e2             	mov    %r12,%rdx
+  8038db:	48 be 00 10 83 00 00 	movabs $0x831000,%rsi
+  8038e2:	00 00 00 
+  8038e5:	4c 89 ff             	mov    %r15,%rdi
+  8038e8:	48 b8 a3 1b 80 00 00 	movabs $0x801ba3,%rax
+  8038ef:	00 00 00 
+  8038f2:	ff d0                	call   *%rax
+        buf += res;
+  8038f4:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  8038f7:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  8038fa:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  8038fe:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  803902:	48 85 db             	test   %rbx,%rbx
+  803905:	0f 84 25 ff ff ff    	je     803830 <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  80390b:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  80390e:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  803912:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  803916:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  80391a:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  803921:	0f 97 c2             	seta   %dl
+  803924:	20 c2                	and    %al,%dl
+  803926:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  803929:	0f 84 5e ff ff ff    	je     80388d <devfile_read_direct+0xa6>
+  80392f:	4c 89 fa             	mov    %r15,%rdx
+  803932:	4d 89 fd             	mov    %r15,%r13
+  803935:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  80393c:	0f 85 4e ff ff ff    	jne    803890 <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  803942:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  803946:	0f 84 1a ff ff ff    	je     803866 <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  80394c:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  803953:	0f 85 37 ff ff ff    	jne    803890 <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  803959:	48 89 d8             	mov    %rbx,%rax
+  80395c:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  803962:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  803967:	48 39 c8             	cmp    %rcx,%rax
+  80396a:	48 0f 47 c1          	cmova  %rcx,%rax
+  80396e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  803972:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  803976:	49 89 d4             	mov    %rdx,%r12
+  803979:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  80397d:	48 b8 58 4c 80 00 00 	movabs $0x804c58,%rax
+  803984:	00 00 00 
+  803987:	ff d0                	call   *%rax
+  803989:	a8 40                	test   $0x40,%al
+  80398b:	0f 85 b9 00 00 00    	jne    803a4a <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  803991:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  803998:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80399c:	49 39 c5             	cmp    %rax,%r13
+  80399f:	72 d8                	jb     803979 <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8039a1:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  8039a5:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  8039ac:	00 00 00 
+  8039af:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  8039b3:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  8039b6:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  8039b8:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  8039bc:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  8039c0:	48 b8 cd 2b 80 00 00 	movabs $0x802bcd,%rax
+  8039c7:	00 00 00 
+  8039ca:	ff d0                	call   *%rax
+  8039cc:	89 c7                	mov    %eax,%edi
+  8039ce:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8039d4:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8039d9:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  8039e0:	00 00 00 
+  8039e3:	be 0e 00 00 00       	mov    $0xe,%esi
+  8039e8:	48 b8 e6 23 80 00 00 	movabs $0x8023e6,%rax
+  8039ef:	00 00 00 
+  8039f2:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  8039f4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8039f9:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  8039fd:	4c 89 fe             	mov    %r15,%rsi
+  803a00:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a05:	48 b8 c2 23 80 00 00 	movabs $0x8023c2,%rax
+  803a0c:	00 00 00 
+  803a0f:	ff d0                	call   *%rax
+  803a11:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  803a14:	48 85 d2             	test   %rdx,%rdx
+  803a17:	0f 84 5a fe ff ff    	je     803877 <devfile_read_direct+0x90>
+            if (res > 0) {
+  803a1d:	0f 8e 5a fe ff ff    	jle    80387d <devfile_read_direct+0x96>
+                buf += res;
+  803a23:	48 98                	cltq
+  803a25:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  803a28:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  803a2b:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  803a2f:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  803a33:	e9 ca fe ff ff       	jmp    803902 <devfile_read_direct+0x11b>
+            return res ? res : read;
+  803a38:	41 89 c5             	mov    %eax,%r13d
+  803a3b:	48 98                	cltq
+  803a3d:	45 85 ed             	test   %r13d,%r13d
+  803a40:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  803a45:	e9 0d fe ff ff       	jmp    803857 <devfile_read_direct+0x70>
+            map = 0;
+  803a4a:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  803a4e:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  803a52:	e9 39 fe ff ff       	jmp    803890 <devfile_read_direct+0xa9>
+  803a57:	48 89 d0             	mov    %rdx,%rax
+  803a5a:	e9 f8 fd ff ff       	jmp    803857 <devfile_read_direct+0x70>
+
+0000000000803a5f <devfile_read>:
+    if (!fd || !buf)
+  803a5f:	48 85 ff             	test   %rdi,%rdi
+  803a62:	0f 84 21 02 00 00    	je     803c89 <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803a68:	55                   	push   %rbp
+  803a69:	48 89 e5             	mov    %rsp,%rbp
+  803a6c:	41 57                	push   %r15
+  803a6e:	41 56                	push   %r14
+  803a70:	41 55                	push   %r13
+  803a72:	41 54                	push   %r12
+  803a74:	53                   	push   %rbx
+  803a75:	48 83 ec 28          	sub    $0x28,%rsp
+  803a79:	48 89 fb             	mov    %rdi,%rbx
+  803a7c:	49 89 f4             	mov    %rsi,%r12
+  803a7f:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  803a82:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  803a87:	48 85 f6             	test   %rsi,%rsi
+  803a8a:	74 4b                	je     803ad7 <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  803a8c:	48 b8 9c 2d 80 00 00 	movabs $0x802d9c,%rax
+  803a93:	00 00 00 
+  803a96:	ff d0                	call   *%rax
+  803a98:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  803a9b:	48 85 c0             	test   %rax,%rax
+  803a9e:	74 22                	je     803ac2 <devfile_read+0x63>
+  803aa0:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  803aa7:	77 19                	ja     803ac2 <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  803aa9:	be 00 10 00 00       	mov    $0x1000,%esi
+  803aae:	48 89 df             	mov    %rbx,%rdi
+  803ab1:	48 b8 66 1e 80 00 00 	movabs $0x801e66,%rax
+  803ab8:	00 00 00 
+  803abb:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  803abd:	83 f8 02             	cmp    $0x2,%eax
+  803ac0:	7e 40                	jle    803b02 <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  803ac2:	48 89 df             	mov    %rbx,%rdi
+  803ac5:	48 b8 e9 34 80 00 00 	movabs $0x8034e9,%rax
+  803acc:	00 00 00 
+  803acf:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  803ad1:	85 c0                	test   %eax,%eax
+  803ad3:	79 11                	jns    803ae6 <devfile_read+0x87>
+  803ad5:	48 98                	cltq
+}
+  803ad7:	48 83 c4 28          	add    $0x28,%rsp
+  803adb:	5b                   	pop    %rbx
+  803adc:	41 5c                	pop    %r12
+  803ade:	41 5d                	pop    %r13
+  803ae0:	41 5e                	pop    %r14
+  803ae2:	41 5f                	pop    %r15
+  803ae4:	5d                   	pop    %rbp
+  803ae5:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  803ae6:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  803aeb:	4c 89 ea             	mov    %r13,%rdx
+  803aee:	4c 89 e6             	mov    %r12,%rsi
+  803af1:	48 89 df             	mov    %rbx,%rdi
+  803af4:	48 b8 e7 37 80 00 00 	movabs $0x8037e7,%rax
+  803afb:	00 00 00 
+  803afe:	ff d0                	call   *%rax
+  803b00:	eb d5                	jmp    803ad7 <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  803b02:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  803b06:	48 89 df             	mov    %rbx,%rdi
+  803b09:	48 b8 e9 34 80 00 00 	movabs $0x8034e9,%rax
+  803b10:	00 00 00 
+  803b13:	ff d0                	call   *%rax
+  803b15:	85 c0                	test   %eax,%eax
+  803b17:	0f 88 33 01 00 00    	js     803c50 <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  803b1d:	48 ba 00 23 82 00 00 	movabs $0x822300,%rdx
+  803b24:	00 00 00 
+  803b27:	4c 89 f0             	mov    %r14,%rax
+  803b2a:	48 29 d0             	sub    %rdx,%rax
+  803b2d:	48 c1 f8 03          	sar    $0x3,%rax
+  803b31:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  803b38:	aa aa aa 
+  803b3b:	48 0f af c2          	imul   %rdx,%rax
+  803b3f:	48 c1 e0 0e          	shl    $0xe,%rax
+  803b43:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  803b47:	8b 43 0c             	mov    0xc(%rbx),%eax
+  803b4a:	41 39 06             	cmp    %eax,(%r14)
+  803b4d:	75 0d                	jne    803b5c <devfile_read+0xfd>
+  803b4f:	8b 43 10             	mov    0x10(%rbx),%eax
+  803b52:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  803b56:	0f 84 fb 00 00 00    	je     803c57 <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  803b5c:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  803b61:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  803b65:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  803b68:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b6c:	48 89 c7             	mov    %rax,%rdi
+  803b6f:	48 b8 b7 4c 80 00 00 	movabs $0x804cb7,%rax
+  803b76:	00 00 00 
+  803b79:	ff d0                	call   *%rax
+  803b7b:	84 c0                	test   %al,%al
+  803b7d:	75 27                	jne    803ba6 <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  803b7f:	b9 06 00 00 00       	mov    $0x6,%ecx
+  803b84:	ba 00 40 00 00       	mov    $0x4000,%edx
+  803b89:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803b8d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b92:	48 b8 a1 1e 80 00 00 	movabs $0x801ea1,%rax
+  803b99:	00 00 00 
+  803b9c:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  803b9e:	85 c0                	test   %eax,%eax
+  803ba0:	0f 88 dc 00 00 00    	js     803c82 <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  803ba6:	44 89 f8             	mov    %r15d,%eax
+  803ba9:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  803bae:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  803bb0:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  803bb7:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  803bb8:	8b 43 10             	mov    0x10(%rbx),%eax
+  803bbb:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  803bbf:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  803bc2:	ba 00 40 00 00       	mov    $0x4000,%edx
+  803bc7:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803bcb:	48 89 df             	mov    %rbx,%rdi
+  803bce:	48 b8 e7 37 80 00 00 	movabs $0x8037e7,%rax
+  803bd5:	00 00 00 
+  803bd8:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  803bda:	48 85 c0             	test   %rax,%rax
+  803bdd:	0f 88 f4 fe ff ff    	js     803ad7 <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  803be3:	8b 53 0c             	mov    0xc(%rbx),%edx
+  803be6:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  803be9:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  803bec:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  803bf0:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  803bf4:	48 63 d1             	movslq %ecx,%rdx
+  803bf7:	48 01 d0             	add    %rdx,%rax
+  803bfa:	4d 63 ff             	movslq %r15d,%r15
+  803bfd:	4c 29 f8             	sub    %r15,%rax
+  803c00:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c05:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  803c09:	48 85 c0             	test   %rax,%rax
+  803c0c:	0f 8e c5 fe ff ff    	jle    803ad7 <devfile_read+0x78>
+    n = MIN(n, res);
+  803c12:	4c 39 e8             	cmp    %r13,%rax
+  803c15:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  803c19:	8b 73 04             	mov    0x4(%rbx),%esi
+  803c1c:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  803c20:	48 63 f6             	movslq %esi,%rsi
+  803c23:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  803c28:	48 01 c6             	add    %rax,%rsi
+  803c2b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803c2f:	48 01 c6             	add    %rax,%rsi
+  803c32:	4c 89 ea             	mov    %r13,%rdx
+  803c35:	4c 89 e7             	mov    %r12,%rdi
+  803c38:	48 b8 a3 1b 80 00 00 	movabs $0x801ba3,%rax
+  803c3f:	00 00 00 
+  803c42:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  803c44:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  803c48:	4c 89 e8             	mov    %r13,%rax
+  803c4b:	e9 87 fe ff ff       	jmp    803ad7 <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  803c50:	48 98                	cltq
+  803c52:	e9 80 fe ff ff       	jmp    803ad7 <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  803c57:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  803c5b:	41 39 d7             	cmp    %edx,%r15d
+  803c5e:	0f 8c f8 fe ff ff    	jl     803b5c <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  803c64:	49 8b 46 10          	mov    0x10(%r14),%rax
+  803c68:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  803c6b:	41 39 cf             	cmp    %ecx,%r15d
+  803c6e:	0f 8d e8 fe ff ff    	jge    803b5c <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  803c74:	4d 63 ff             	movslq %r15d,%r15
+  803c77:	4c 29 f8             	sub    %r15,%rax
+  803c7a:	48 63 d2             	movslq %edx,%rdx
+  803c7d:	48 01 d0             	add    %rdx,%rax
+  803c80:	eb 87                	jmp    803c09 <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  803c82:	48 98                	cltq
+  803c84:	e9 4e fe ff ff       	jmp    803ad7 <devfile_read+0x78>
+        return E_INVAL;
+  803c89:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  803c8e:	c3                   	ret
+
+0000000000803c8f <fs_channel>:
+fs_channel(bool enable) {
+  803c8f:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  803c91:	a2 04 26 82 00 00 00 	movabs %al,0x822604
+  803c98:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  803c9a:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c9f:	40 84 ff             	test   %dil,%dil
+  803ca2:	74 47                	je     803ceb <fs_channel+0x5c>
+  803ca4:	48 a1 00 10 81 00 00 	movabs 0x811000,%rax
+  803cab:	00 00 00 
+  803cae:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  803cb4:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  803cbb:	00 00 00 
+  803cbe:	3b 08                	cmp    (%rax),%ecx
+  803cc0:	74 29                	je     803ceb <fs_channel+0x5c>
+fs_channel(bool enable) {
+  803cc2:	55                   	push   %rbp
+  803cc3:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  803cc6:	48 b8 0f 2c 80 00 00 	movabs $0x802c0f,%rax
+  803ccd:	00 00 00 
+  803cd0:	ff d0                	call   *%rax
+  803cd2:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  803cd4:	85 c0                	test   %eax,%eax
+  803cd6:	78 04                	js     803cdc <fs_channel+0x4d>
+}
+  803cd8:	89 d0                	mov    %edx,%eax
+  803cda:	5d                   	pop    %rbp
+  803cdb:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  803cdc:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  803ce3:	00 00 00 
+  803ce6:	c6 00 00             	movb   $0x0,(%rax)
+  803ce9:	eb ed                	jmp    803cd8 <fs_channel+0x49>
+}
+  803ceb:	89 d0                	mov    %edx,%eax
+  803ced:	c3                   	ret
+
+0000000000803cee <open>:
+open(const char *path, int mode) {
+  803cee:	55                   	push   %rbp
+  803cef:	48 89 e5             	mov    %rsp,%rbp
+  803cf2:	41 55                	push   %r13
+  803cf4:	41 54                	push   %r12
+  803cf6:	53                   	push   %rbx
+  803cf7:	48 83 ec 18          	sub    $0x18,%rsp
+  803cfb:	49 89 fc             	mov    %rdi,%r12
+  803cfe:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803d01:	48 b8 04 19 80 00 00 	movabs $0x801904,%rax
+  803d08:	00 00 00 
+  803d0b:	ff d0                	call   *%rax
+  803d0d:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803d13:	0f 87 8f 00 00 00    	ja     803da8 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803d19:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803d1d:	48 b8 c9 24 80 00 00 	movabs $0x8024c9,%rax
+  803d24:	00 00 00 
+  803d27:	ff d0                	call   *%rax
+  803d29:	89 c3                	mov    %eax,%ebx
+  803d2b:	85 c0                	test   %eax,%eax
+  803d2d:	78 55                	js     803d84 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  803d2f:	4c 89 e6             	mov    %r12,%rsi
+  803d32:	48 bb 00 00 83 00 00 	movabs $0x830000,%rbx
+  803d39:	00 00 00 
+  803d3c:	48 89 df             	mov    %rbx,%rdi
+  803d3f:	48 b8 42 19 80 00 00 	movabs $0x801942,%rax
+  803d46:	00 00 00 
+  803d49:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803d4b:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  803d52:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d57:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803d5b:	bf 01 00 00 00       	mov    $0x1,%edi
+  803d60:	48 b8 80 32 80 00 00 	movabs $0x803280,%rax
+  803d67:	00 00 00 
+  803d6a:	ff d0                	call   *%rax
+  803d6c:	89 c3                	mov    %eax,%ebx
+  803d6e:	85 c0                	test   %eax,%eax
+  803d70:	78 1f                	js     803d91 <open+0xa3>
+    return fd2num(fd);
+  803d72:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803d76:	48 b8 9b 24 80 00 00 	movabs $0x80249b,%rax
+  803d7d:	00 00 00 
+  803d80:	ff d0                	call   *%rax
+  803d82:	89 c3                	mov    %eax,%ebx
+}
+  803d84:	89 d8                	mov    %ebx,%eax
+  803d86:	48 83 c4 18          	add    $0x18,%rsp
+  803d8a:	5b                   	pop    %rbx
+  803d8b:	41 5c                	pop    %r12
+  803d8d:	41 5d                	pop    %r13
+  803d8f:	5d                   	pop    %rbp
+  803d90:	c3                   	ret
+        fd_close(fd, 0);
+  803d91:	be 00 00 00 00       	mov    $0x0,%esi
+  803d96:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803d9a:	48 b8 e4 25 80 00 00 	movabs $0x8025e4,%rax
+  803da1:	00 00 00 
+  803da4:	ff d0                	call   *%rax
+        return res;
+  803da6:	eb dc                	jmp    803d84 <open+0x96>
+        return -E_BAD_PATH;
+  803da8:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803dad:	eb d5                	jmp    803d84 <open+0x96>
+
+0000000000803daf <file_flush_buffers>:
+file_flush_buffers(void) {
+  803daf:	55                   	push   %rbp
+  803db0:	48 89 e5             	mov    %rsp,%rbp
+  803db3:	41 56                	push   %r14
+  803db5:	41 55                	push   %r13
+  803db7:	41 54                	push   %r12
+  803db9:	53                   	push   %rbx
+  803dba:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  803dbe:	49 bc 08 23 82 00 00 	movabs $0x822308,%r12
+  803dc5:	00 00 00 
+  803dc8:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  803dcd:	49 bd 29 25 80 00 00 	movabs $0x802529,%r13
+  803dd4:	00 00 00 
+  803dd7:	49 be e9 34 80 00 00 	movabs $0x8034e9,%r14
+  803dde:	00 00 00 
+  803de1:	eb 0c                	jmp    803def <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  803de3:	83 c3 01             	add    $0x1,%ebx
+  803de6:	49 83 c4 18          	add    $0x18,%r12
+  803dea:	83 fb 20             	cmp    $0x20,%ebx
+  803ded:	74 1d                	je     803e0c <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  803def:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  803df4:	74 ed                	je     803de3 <file_flush_buffers+0x34>
+  803df6:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803dfa:	89 df                	mov    %ebx,%edi
+  803dfc:	41 ff d5             	call   *%r13
+  803dff:	85 c0                	test   %eax,%eax
+  803e01:	78 e0                	js     803de3 <file_flush_buffers+0x34>
+  803e03:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803e07:	41 ff d6             	call   *%r14
+  803e0a:	eb d7                	jmp    803de3 <file_flush_buffers+0x34>
+}
+  803e0c:	48 83 c4 10          	add    $0x10,%rsp
+  803e10:	5b                   	pop    %rbx
+  803e11:	41 5c                	pop    %r12
+  803e13:	41 5d                	pop    %r13
+  803e15:	41 5e                	pop    %r14
+  803e17:	5d                   	pop    %rbp
+  803e18:	c3                   	ret
+
+0000000000803e19 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803e19:	55                   	push   %rbp
+  803e1a:	48 89 e5             	mov    %rsp,%rbp
+  803e1d:	41 54                	push   %r12
+  803e1f:	53                   	push   %rbx
+  803e20:	49 89 fc             	mov    %rdi,%r12
+  803e23:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  803e25:	48 b8 af 3d 80 00 00 	movabs $0x803daf,%rax
+  803e2c:	00 00 00 
+  803e2f:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  803e31:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803e38:	00 00 00 
+  803e3b:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  803e40:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  803e42:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  803e45:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e4a:	be 00 00 00 00       	mov    $0x0,%esi
+  803e4f:	bf 02 00 00 00       	mov    $0x2,%edi
+  803e54:	48 b8 80 32 80 00 00 	movabs $0x803280,%rax
+  803e5b:	00 00 00 
+  803e5e:	ff d0                	call   *%rax
+}
+  803e60:	5b                   	pop    %rbx
+  803e61:	41 5c                	pop    %r12
+  803e63:	5d                   	pop    %rbp
+  803e64:	c3                   	ret
+
+0000000000803e65 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803e65:	55                   	push   %rbp
+  803e66:	48 89 e5             	mov    %rsp,%rbp
+  803e69:	41 54                	push   %r12
+  803e6b:	53                   	push   %rbx
+  803e6c:	49 89 fc             	mov    %rdi,%r12
+  803e6f:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  803e72:	48 b8 af 3d 80 00 00 	movabs $0x803daf,%rax
+  803e79:	00 00 00 
+  803e7c:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803e7e:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  803e83:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  803e8a:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  803e8c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e91:	be 00 00 00 00       	mov    $0x0,%esi
+  803e96:	bf 05 00 00 00       	mov    $0x5,%edi
+  803e9b:	48 b8 80 32 80 00 00 	movabs $0x803280,%rax
+  803ea2:	00 00 00 
+  803ea5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803ea7:	85 c0                	test   %eax,%eax
+  803ea9:	78 3d                	js     803ee8 <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803eab:	49 bc 00 00 83 00 00 	movabs $0x830000,%r12
+  803eb2:	00 00 00 
+  803eb5:	4c 89 e6             	mov    %r12,%rsi
+  803eb8:	48 89 df             	mov    %rbx,%rdi
+  803ebb:	48 b8 42 19 80 00 00 	movabs $0x801942,%rax
+  803ec2:	00 00 00 
+  803ec5:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  803ec7:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  803ece:	00 
+  803ecf:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803ed5:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  803edc:	00 
+  803edd:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  803ee3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ee8:	5b                   	pop    %rbx
+  803ee9:	41 5c                	pop    %r12
+  803eeb:	5d                   	pop    %rbp
+  803eec:	c3                   	ret
+
+0000000000803eed <remove>:
+remove(const char *path) {
+  803eed:	55                   	push   %rbp
+  803eee:	48 89 e5             	mov    %rsp,%rbp
+  803ef1:	53                   	push   %rbx
+  803ef2:	48 83 ec 08          	sub    $0x8,%rsp
+  803ef6:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  803ef9:	48 b8 04 19 80 00 00 	movabs $0x801904,%rax
+  803f00:	00 00 00 
+  803f03:	ff d0                	call   *%rax
+  803f05:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803f0b:	77 3a                	ja     803f47 <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  803f0d:	48 89 de             	mov    %rbx,%rsi
+  803f10:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  803f17:	00 00 00 
+  803f1a:	48 b8 42 19 80 00 00 	movabs $0x801942,%rax
+  803f21:	00 00 00 
+  803f24:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  803f26:	ba 00 00 00 00       	mov    $0x0,%edx
+  803f2b:	be 00 00 00 00       	mov    $0x0,%esi
+  803f30:	bf 07 00 00 00       	mov    $0x7,%edi
+  803f35:	48 b8 80 32 80 00 00 	movabs $0x803280,%rax
+  803f3c:	00 00 00 
+  803f3f:	ff d0                	call   *%rax
+}
+  803f41:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803f45:	c9                   	leave
+  803f46:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  803f47:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803f4c:	eb f3                	jmp    803f41 <remove+0x54>
+
+0000000000803f4e <sync>:
+sync(void) {
+  803f4e:	55                   	push   %rbp
+  803f4f:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  803f52:	48 b8 af 3d 80 00 00 	movabs $0x803daf,%rax
+  803f59:	00 00 00 
+  803f5c:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  803f5e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803f63:	be 00 00 00 00       	mov    $0x0,%esi
+  803f68:	bf 08 00 00 00       	mov    $0x8,%edi
+  803f6d:	48 b8 80 32 80 00 00 	movabs $0x803280,%rax
+  803f74:	00 00 00 
+  803f77:	ff d0                	call   *%rax
+}
+  803f79:	5d                   	pop    %rbp
+  803f7a:	c3                   	ret
+
+0000000000803f7b <fsync>:
+fsync(int fdnum) {
+  803f7b:	55                   	push   %rbp
+  803f7c:	48 89 e5             	mov    %rsp,%rbp
+  803f7f:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803f83:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803f87:	48 b8 29 25 80 00 00 	movabs $0x802529,%rax
+  803f8e:	00 00 00 
+  803f91:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803f93:	85 c0                	test   %eax,%eax
+  803f95:	78 4b                	js     803fe2 <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803f97:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803f9b:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  803fa2:	00 00 00 
+  803fa5:	8b 00                	mov    (%rax),%eax
+  803fa7:	39 02                	cmp    %eax,(%rdx)
+  803fa9:	75 39                	jne    803fe4 <fsync+0x69>
+    file_flush_buffers();
+  803fab:	48 b8 af 3d 80 00 00 	movabs $0x803daf,%rax
+  803fb2:	00 00 00 
+  803fb5:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  803fb7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803fbb:	8b 40 0c             	mov    0xc(%rax),%eax
+  803fbe:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  803fc5:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  803fc7:	ba 00 00 00 00       	mov    $0x0,%edx
+  803fcc:	be 00 00 00 00       	mov    $0x0,%esi
+  803fd1:	bf 0d 00 00 00       	mov    $0xd,%edi
+  803fd6:	48 b8 80 32 80 00 00 	movabs $0x803280,%rax
+  803fdd:	00 00 00 
+  803fe0:	ff d0                	call   *%rax
+}
+  803fe2:	c9                   	leave
+  803fe3:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803fe4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803fe9:	eb f7                	jmp    803fe2 <fsync+0x67>
+
+0000000000803feb <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  803feb:	55                   	push   %rbp
+  803fec:	48 89 e5             	mov    %rsp,%rbp
+  803fef:	53                   	push   %rbx
+  803ff0:	48 83 ec 08          	sub    $0x8,%rsp
+  803ff4:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  803ff7:	ba 00 00 00 00       	mov    $0x0,%edx
+  803ffc:	be 00 00 00 00       	mov    $0x0,%esi
+  804001:	bf 0b 00 00 00       	mov    $0xb,%edi
+  804006:	48 b8 80 32 80 00 00 	movabs $0x803280,%rax
+  80400d:	00 00 00 
+  804010:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804012:	85 c0                	test   %eax,%eax
+  804014:	78 2d                	js     804043 <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  804016:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  80401d:	00 00 00 
+  804020:	48 8b 10             	mov    (%rax),%rdx
+  804023:	48 89 13             	mov    %rdx,(%rbx)
+  804026:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80402a:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  80402e:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804032:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  804036:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80403a:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  80403e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804043:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804047:	c9                   	leave
+  804048:	c3                   	ret
+
+0000000000804049 <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  804049:	55                   	push   %rbp
+  80404a:	48 89 e5             	mov    %rsp,%rbp
+  80404d:	53                   	push   %rbx
+  80404e:	48 83 ec 08          	sub    $0x8,%rsp
+  804052:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  804055:	ba 00 00 00 00       	mov    $0x0,%edx
+  80405a:	be 00 00 00 00       	mov    $0x0,%esi
+  80405f:	bf 0c 00 00 00       	mov    $0xc,%edi
+  804064:	48 b8 80 32 80 00 00 	movabs $0x803280,%rax
+  80406b:	00 00 00 
+  80406e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804070:	85 c0                	test   %eax,%eax
+  804072:	78 3d                	js     8040b1 <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  804074:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  80407b:	00 00 00 
+  80407e:	48 8b 10             	mov    (%rax),%rdx
+  804081:	48 89 13             	mov    %rdx,(%rbx)
+  804084:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804088:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  80408c:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804090:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  804094:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  804098:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  80409c:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  8040a0:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  8040a4:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8040a8:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  8040ac:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8040b1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8040b5:	c9                   	leave
+  8040b6:	c3                   	ret
+
+00000000008040b7 <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  8040b7:	55                   	push   %rbp
+  8040b8:	48 89 e5             	mov    %rsp,%rbp
+  8040bb:	41 57                	push   %r15
+  8040bd:	41 56                	push   %r14
+  8040bf:	41 55                	push   %r13
+  8040c1:	41 54                	push   %r12
+  8040c3:	53                   	push   %rbx
+  8040c4:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  8040c8:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  8040cf:	00 
+  8040d0:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  8040d7:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8040dd:	0f 85 43 01 00 00    	jne    804226 <munmap+0x16f>
+  8040e3:	49 89 ff             	mov    %rdi,%r15
+  8040e6:	4c 39 f7             	cmp    %r14,%rdi
+  8040e9:	0f 87 37 01 00 00    	ja     804226 <munmap+0x16f>
+  8040ef:	48 bb 00 20 82 00 00 	movabs $0x822000,%rbx
+  8040f6:	00 00 00 
+  8040f9:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  8040ff:	eb 2c                	jmp    80412d <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  804101:	4c 39 f8             	cmp    %r15,%rax
+  804104:	0f 83 85 00 00 00    	jae    80418f <munmap+0xd8>
+            m->mm_end = start;
+  80410a:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80410f:	48 83 c3 18          	add    $0x18,%rbx
+  804113:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  80411a:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  804121:	00 00 00 
+  804124:	48 39 c3             	cmp    %rax,%rbx
+  804127:	0f 84 d0 00 00 00    	je     8041fd <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  80412d:	49 89 dc             	mov    %rbx,%r12
+  804130:	48 8b 03             	mov    (%rbx),%rax
+  804133:	4c 39 f0             	cmp    %r14,%rax
+  804136:	73 d7                	jae    80410f <munmap+0x58>
+  804138:	48 85 c0             	test   %rax,%rax
+  80413b:	74 d2                	je     80410f <munmap+0x58>
+  80413d:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  804141:	49 39 d7             	cmp    %rdx,%r15
+  804144:	73 c9                	jae    80410f <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  804146:	49 39 d6             	cmp    %rdx,%r14
+  804149:	73 b6                	jae    804101 <munmap+0x4a>
+  80414b:	49 39 c7             	cmp    %rax,%r15
+  80414e:	76 b1                	jbe    804101 <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  804150:	4c 89 ef             	mov    %r13,%rdi
+  804153:	48 b8 ee 31 80 00 00 	movabs $0x8031ee,%rax
+  80415a:	00 00 00 
+  80415d:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  80415f:	48 85 c0             	test   %rax,%rax
+  804162:	0f 84 c5 00 00 00    	je     80422d <munmap+0x176>
+            *tail = *m;
+  804168:	48 8b 13             	mov    (%rbx),%rdx
+  80416b:	48 89 10             	mov    %rdx,(%rax)
+  80416e:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  804172:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  804176:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  80417a:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  80417e:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  804181:	44 89 f2             	mov    %r14d,%edx
+  804184:	2b 13                	sub    (%rbx),%edx
+  804186:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  804189:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  80418d:	eb 80                	jmp    80410f <munmap+0x58>
+        } else if (m->mm_end > end) {
+  80418f:	49 39 d6             	cmp    %rdx,%r14
+  804192:	73 18                	jae    8041ac <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  804194:	44 89 f2             	mov    %r14d,%edx
+  804197:	41 03 54 24 10       	add    0x10(%r12),%edx
+  80419c:	29 c2                	sub    %eax,%edx
+  80419e:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  8041a3:	4d 89 34 24          	mov    %r14,(%r12)
+  8041a7:	e9 63 ff ff ff       	jmp    80410f <munmap+0x58>
+    m->mm_start = 0;
+  8041ac:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  8041b3:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  8041b4:	4c 89 e6             	mov    %r12,%rsi
+  8041b7:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8041be:	00 00 00 
+  8041c1:	48 29 c6             	sub    %rax,%rsi
+  8041c4:	48 c1 fe 03          	sar    $0x3,%rsi
+  8041c8:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8041cf:	aa aa aa 
+  8041d2:	48 0f af f0          	imul   %rax,%rsi
+  8041d6:	48 c1 e6 0c          	shl    $0xc,%rsi
+  8041da:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  8041df:	48 01 c6             	add    %rax,%rsi
+  8041e2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8041e7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8041ec:	48 b8 47 1f 80 00 00 	movabs $0x801f47,%rax
+  8041f3:	00 00 00 
+  8041f6:	ff d0                	call   *%rax
+}
+  8041f8:	e9 12 ff ff ff       	jmp    80410f <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  8041fd:	4c 89 f2             	mov    %r14,%rdx
+  804200:	4c 29 fa             	sub    %r15,%rdx
+  804203:	4c 89 fe             	mov    %r15,%rsi
+  804206:	bf 00 00 00 00       	mov    $0x0,%edi
+  80420b:	48 b8 47 1f 80 00 00 	movabs $0x801f47,%rax
+  804212:	00 00 00 
+  804215:	ff d0                	call   *%rax
+}
+  804217:	48 83 c4 08          	add    $0x8,%rsp
+  80421b:	5b                   	pop    %rbx
+  80421c:	41 5c                	pop    %r12
+  80421e:	41 5d                	pop    %r13
+  804220:	41 5e                	pop    %r14
+  804222:	41 5f                	pop    %r15
+  804224:	5d                   	pop    %rbp
+  804225:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  804226:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80422b:	eb ea                	jmp    804217 <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  80422d:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  804232:	eb e3                	jmp    804217 <munmap+0x160>
+
+0000000000804234 <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  804234:	55                   	push   %rbp
+  804235:	48 89 e5             	mov    %rsp,%rbp
+  804238:	41 57                	push   %r15
+  80423a:	41 56                	push   %r14
+  80423c:	41 55                	push   %r13
+  80423e:	41 54                	push   %r12
+  804240:	53                   	push   %rbx
+  804241:	48 83 ec 28          	sub    $0x28,%rsp
+  804245:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  804249:	49 89 f5             	mov    %rsi,%r13
+  80424c:	41 89 d6             	mov    %edx,%r14d
+  80424f:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  804252:	41 89 cc             	mov    %ecx,%r12d
+  804255:	44 89 c7             	mov    %r8d,%edi
+  804258:	44 89 cb             	mov    %r9d,%ebx
+  80425b:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80425f:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  804263:	48 b8 29 25 80 00 00 	movabs $0x802529,%rax
+  80426a:	00 00 00 
+  80426d:	ff d0                	call   *%rax
+  80426f:	41 89 c7             	mov    %eax,%r15d
+  804272:	85 c0                	test   %eax,%eax
+  804274:	0f 88 ae 01 00 00    	js     804428 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80427a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80427e:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  804285:	00 00 00 
+  804288:	8b 32                	mov    (%rdx),%esi
+  80428a:	39 30                	cmp    %esi,(%rax)
+  80428c:	0f 85 7a 02 00 00    	jne    80450c <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  804292:	8b 40 08             	mov    0x8(%rax),%eax
+  804295:	83 e0 03             	and    $0x3,%eax
+  804298:	83 f8 01             	cmp    $0x1,%eax
+  80429b:	0f 84 76 02 00 00    	je     804517 <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  8042a1:	4d 85 ed             	test   %r13,%r13
+  8042a4:	0f 84 78 02 00 00    	je     804522 <mmap+0x2ee>
+  8042aa:	85 db                	test   %ebx,%ebx
+  8042ac:	0f 88 70 02 00 00    	js     804522 <mmap+0x2ee>
+  8042b2:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  8042b8:	41 89 df             	mov    %ebx,%r15d
+  8042bb:	0f 85 6c 02 00 00    	jne    80452d <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  8042c1:	44 89 f0             	mov    %r14d,%eax
+  8042c4:	83 e0 fd             	and    $0xfffffffd,%eax
+  8042c7:	83 f8 04             	cmp    $0x4,%eax
+  8042ca:	0f 85 68 02 00 00    	jne    804538 <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  8042d0:	44 89 e1             	mov    %r12d,%ecx
+  8042d3:	83 e1 01             	and    $0x1,%ecx
+  8042d6:	0f 95 c2             	setne  %dl
+  8042d9:	44 89 e0             	mov    %r12d,%eax
+  8042dc:	d1 e8                	shr    %eax
+  8042de:	83 f0 01             	xor    $0x1,%eax
+  8042e1:	83 e0 01             	and    $0x1,%eax
+  8042e4:	38 c2                	cmp    %al,%dl
+  8042e6:	0f 85 57 02 00 00    	jne    804543 <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  8042ec:	85 c9                	test   %ecx,%ecx
+  8042ee:	74 0a                	je     8042fa <mmap+0xc6>
+  8042f0:	41 f6 c6 02          	test   $0x2,%r14b
+  8042f4:	0f 85 54 02 00 00    	jne    80454e <mmap+0x31a>
+    file_flush_buffers();
+  8042fa:	48 b8 af 3d 80 00 00 	movabs $0x803daf,%rax
+  804301:	00 00 00 
+  804304:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  804306:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  80430d:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  804314:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804318:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  80431b:	41 f6 c4 04          	test   $0x4,%r12b
+  80431f:	0f 84 15 01 00 00    	je     80443a <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  804325:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  804328:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  80432e:	0f 85 25 02 00 00    	jne    804559 <mmap+0x325>
+  804334:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  804338:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  80433f:	00 00 00 
+  804342:	48 39 c2             	cmp    %rax,%rdx
+  804345:	0f 82 19 02 00 00    	jb     804564 <mmap+0x330>
+  80434b:	48 39 c7             	cmp    %rax,%rdi
+  80434e:	0f 87 10 02 00 00    	ja     804564 <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  804354:	4c 89 ee             	mov    %r13,%rsi
+  804357:	48 b8 b7 40 80 00 00 	movabs $0x8040b7,%rax
+  80435e:	00 00 00 
+  804361:	ff d0                	call   *%rax
+  804363:	85 c0                	test   %eax,%eax
+  804365:	0f 88 04 02 00 00    	js     80456f <mmap+0x33b>
+    if (!handler) {
+  80436b:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  804372:	00 00 00 
+  804375:	80 38 00             	cmpb   $0x0,(%rax)
+  804378:	75 2b                	jne    8043a5 <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  80437a:	48 bf 4f 31 80 00 00 	movabs $0x80314f,%rdi
+  804381:	00 00 00 
+  804384:	48 b8 10 52 80 00 00 	movabs $0x805210,%rax
+  80438b:	00 00 00 
+  80438e:	ff d0                	call   *%rax
+  804390:	85 c0                	test   %eax,%eax
+  804392:	0f 88 ea 01 00 00    	js     804582 <mmap+0x34e>
+        handler = 1;
+  804398:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  80439f:	00 00 00 
+  8043a2:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  8043a5:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8043a9:	48 b8 ee 31 80 00 00 	movabs $0x8031ee,%rax
+  8043b0:	00 00 00 
+  8043b3:	ff d0                	call   *%rax
+  8043b5:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  8043b8:	48 85 c0             	test   %rax,%rax
+  8043bb:	0f 84 c9 01 00 00    	je     80458a <mmap+0x356>
+    m->mm_start = va;
+  8043c1:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  8043c4:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  8043c8:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  8043cc:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  8043cf:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  8043d3:	44 89 e0             	mov    %r12d,%eax
+  8043d6:	c1 e0 06             	shl    $0x6,%eax
+  8043d9:	25 80 00 00 00       	and    $0x80,%eax
+  8043de:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  8043e1:	09 f0                	or     %esi,%eax
+  8043e3:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  8043e7:	41 f6 c4 08          	test   $0x8,%r12b
+  8043eb:	74 31                	je     80441e <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  8043ed:	48 39 d3             	cmp    %rdx,%rbx
+  8043f0:	73 2c                	jae    80441e <mmap+0x1ea>
+  8043f2:	ba 00 00 04 00       	mov    $0x40000,%edx
+  8043f7:	48 89 de             	mov    %rbx,%rsi
+  8043fa:	4c 89 f7             	mov    %r14,%rdi
+  8043fd:	48 b8 3e 30 80 00 00 	movabs $0x80303e,%rax
+  804404:	00 00 00 
+  804407:	ff d0                	call   *%rax
+  804409:	49 89 c4             	mov    %rax,%r12
+  80440c:	48 85 c0             	test   %rax,%rax
+  80440f:	0f 8e d7 00 00 00    	jle    8044ec <mmap+0x2b8>
+            va += n;
+  804415:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  804418:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  80441c:	72 d4                	jb     8043f2 <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  80441e:	49 8b 06             	mov    (%r14),%rax
+  804421:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  804425:	48 89 06             	mov    %rax,(%rsi)
+}
+  804428:	44 89 f8             	mov    %r15d,%eax
+  80442b:	48 83 c4 28          	add    $0x28,%rsp
+  80442f:	5b                   	pop    %rbx
+  804430:	41 5c                	pop    %r12
+  804432:	41 5d                	pop    %r13
+  804434:	41 5e                	pop    %r14
+  804436:	41 5f                	pop    %r15
+  804438:	5d                   	pop    %rbp
+  804439:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80443a:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  804441:	00 00 00 
+  804444:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  804447:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  80444e:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  804451:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  804456:	48 be 00 20 82 00 00 	movabs $0x822000,%rsi
+  80445d:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  804460:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  804467:	00 00 00 
+  80446a:	48 39 d7             	cmp    %rdx,%rdi
+  80446d:	73 1c                	jae    80448b <mmap+0x257>
+        return -E_NO_MEM;
+  80446f:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  804475:	eb b1                	jmp    804428 <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  804477:	48 83 c0 01          	add    $0x1,%rax
+  80447b:	48 83 f8 1f          	cmp    $0x1f,%rax
+  80447f:	77 3f                	ja     8044c0 <mmap+0x28c>
+  804481:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  804486:	48 39 d7             	cmp    %rdx,%rdi
+  804489:	72 2a                	jb     8044b5 <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  80448b:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  80448f:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  804493:	48 39 d1             	cmp    %rdx,%rcx
+  804496:	73 df                	jae    804477 <mmap+0x243>
+  804498:	48 85 c9             	test   %rcx,%rcx
+  80449b:	74 da                	je     804477 <mmap+0x243>
+  80449d:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  8044a1:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  8044a6:	48 39 d3             	cmp    %rdx,%rbx
+  8044a9:	73 cc                	jae    804477 <mmap+0x243>
+            va = mmaps[i].mm_end;
+  8044ab:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8044ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044b3:	eb cc                	jmp    804481 <mmap+0x24d>
+        return -E_NO_MEM;
+  8044b5:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8044bb:	e9 68 ff ff ff       	jmp    804428 <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  8044c0:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  8044c5:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  8044cc:	00 00 00 
+  8044cf:	48 39 c2             	cmp    %rax,%rdx
+  8044d2:	0f 82 9f 00 00 00    	jb     804577 <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  8044d8:	48 85 db             	test   %rbx,%rbx
+  8044db:	0f 85 8a fe ff ff    	jne    80436b <mmap+0x137>
+        return -E_NO_MEM;
+  8044e1:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8044e7:	e9 3c ff ff ff       	jmp    804428 <mmap+0x1f4>
+        if (n < 0) {
+  8044ec:	0f 89 2c ff ff ff    	jns    80441e <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  8044f2:	49 8b 3e             	mov    (%r14),%rdi
+  8044f5:	4c 89 ee             	mov    %r13,%rsi
+  8044f8:	48 b8 b7 40 80 00 00 	movabs $0x8040b7,%rax
+  8044ff:	00 00 00 
+  804502:	ff d0                	call   *%rax
+            return n;
+  804504:	45 89 e7             	mov    %r12d,%r15d
+  804507:	e9 1c ff ff ff       	jmp    804428 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80450c:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  804512:	e9 11 ff ff ff       	jmp    804428 <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  804517:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80451d:	e9 06 ff ff ff       	jmp    804428 <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  804522:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  804528:	e9 fb fe ff ff       	jmp    804428 <mmap+0x1f4>
+  80452d:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  804533:	e9 f0 fe ff ff       	jmp    804428 <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  804538:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80453e:	e9 e5 fe ff ff       	jmp    804428 <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  804543:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  804549:	e9 da fe ff ff       	jmp    804428 <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  80454e:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  804554:	e9 cf fe ff ff       	jmp    804428 <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  804559:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80455f:	e9 c4 fe ff ff       	jmp    804428 <mmap+0x1f4>
+  804564:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80456a:	e9 b9 fe ff ff       	jmp    804428 <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  80456f:	41 89 c7             	mov    %eax,%r15d
+  804572:	e9 b1 fe ff ff       	jmp    804428 <mmap+0x1f4>
+        return -E_NO_MEM;
+  804577:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80457d:	e9 a6 fe ff ff       	jmp    804428 <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  804582:	41 89 c7             	mov    %eax,%r15d
+  804585:	e9 9e fe ff ff       	jmp    804428 <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  80458a:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  804590:	e9 93 fe ff ff       	jmp    804428 <mmap+0x1f4>
+
+0000000000804595 <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  804595:	55                   	push   %rbp
+  804596:	48 89 e5             	mov    %rsp,%rbp
+  804599:	41 54                	push   %r12
+  80459b:	53                   	push   %rbx
+  80459c:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80459f:	48 b8 ad 24 80 00 00 	movabs $0x8024ad,%rax
+  8045a6:	00 00 00 
+  8045a9:	ff d0                	call   *%rax
+  8045ab:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8045ae:	48 be 40 5f 80 00 00 	movabs $0x805f40,%rsi
+  8045b5:	00 00 00 
+  8045b8:	48 89 df             	mov    %rbx,%rdi
+  8045bb:	48 b8 42 19 80 00 00 	movabs $0x801942,%rax
+  8045c2:	00 00 00 
+  8045c5:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8045c7:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8045cc:	41 2b 04 24          	sub    (%r12),%eax
+  8045d0:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8045d6:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8045dd:	00 00 00 
+    stat->st_dev = &devpipe;
+  8045e0:	48 b8 60 70 80 00 00 	movabs $0x807060,%rax
+  8045e7:	00 00 00 
+  8045ea:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8045f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045f6:	5b                   	pop    %rbx
+  8045f7:	41 5c                	pop    %r12
+  8045f9:	5d                   	pop    %rbp
+  8045fa:	c3                   	ret
+
+00000000008045fb <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  8045fb:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8045fe:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  804604:	8b 17                	mov    (%rdi),%edx
+  804606:	85 d2                	test   %edx,%edx
+  804608:	75 01                	jne    80460b <pipe_wakeup+0x10>
+  80460a:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  80460b:	55                   	push   %rbp
+  80460c:	48 89 e5             	mov    %rsp,%rbp
+  80460f:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  804612:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  804618:	be 00 04 00 00       	mov    $0x400,%esi
+  80461d:	48 b8 2d 22 80 00 00 	movabs $0x80222d,%rax
+  804624:	00 00 00 
+  804627:	ff d0                	call   *%rax
+}
+  804629:	5d                   	pop    %rbp
+  80462a:	c3                   	ret
+
+000000000080462b <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80462b:	55                   	push   %rbp
+  80462c:	48 89 e5             	mov    %rsp,%rbp
+  80462f:	41 55                	push   %r13
+  804631:	41 54                	push   %r12
+  804633:	53                   	push   %rbx
+  804634:	48 83 ec 08          	sub    $0x8,%rsp
+  804638:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80463b:	48 b8 ad 24 80 00 00 	movabs $0x8024ad,%rax
+  804642:	00 00 00 
+  804645:	ff d0                	call   *%rax
+  804647:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80464a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80464f:	4c 89 e6             	mov    %r12,%rsi
+  804652:	bf 00 00 00 00       	mov    $0x0,%edi
+  804657:	49 bc 47 1f 80 00 00 	movabs $0x801f47,%r12
+  80465e:	00 00 00 
+  804661:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  804664:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  804668:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  80466c:	49 bd fb 45 80 00 00 	movabs $0x8045fb,%r13
+  804673:	00 00 00 
+  804676:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  804679:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  80467d:	48 89 de             	mov    %rbx,%rsi
+  804680:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  804683:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804688:	48 89 de             	mov    %rbx,%rsi
+  80468b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804690:	41 ff d4             	call   *%r12
+  804693:	48 83 c4 08          	add    $0x8,%rsp
+  804697:	5b                   	pop    %rbx
+  804698:	41 5c                	pop    %r12
+  80469a:	41 5d                	pop    %r13
+  80469c:	5d                   	pop    %rbp
+  80469d:	c3                   	ret
+
+000000000080469e <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  80469e:	55                   	push   %rbp
+  80469f:	48 89 e5             	mov    %rsp,%rbp
+  8046a2:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8046a5:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8046aa:	be 00 10 00 00       	mov    $0x1000,%esi
+  8046af:	48 b8 8a 1e 80 00 00 	movabs $0x801e8a,%rax
+  8046b6:	00 00 00 
+  8046b9:	ff d0                	call   *%rax
+  8046bb:	85 c0                	test   %eax,%eax
+  8046bd:	0f 94 c0             	sete   %al
+  8046c0:	0f b6 c0             	movzbl %al,%eax
+}
+  8046c3:	5d                   	pop    %rbp
+  8046c4:	c3                   	ret
+
+00000000008046c5 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8046c5:	55                   	push   %rbp
+  8046c6:	48 89 e5             	mov    %rsp,%rbp
+  8046c9:	41 57                	push   %r15
+  8046cb:	41 56                	push   %r14
+  8046cd:	41 55                	push   %r13
+  8046cf:	41 54                	push   %r12
+  8046d1:	53                   	push   %rbx
+  8046d2:	48 83 ec 38          	sub    $0x38,%rsp
+  8046d6:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8046da:	49 89 f4             	mov    %rsi,%r12
+  8046dd:	49 89 d7             	mov    %rdx,%r15
+  8046e0:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8046e4:	48 b8 ad 24 80 00 00 	movabs $0x8024ad,%rax
+  8046eb:	00 00 00 
+  8046ee:	ff d0                	call   *%rax
+  8046f0:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8046f3:	4d 85 ff             	test   %r15,%r15
+  8046f6:	0f 84 f1 00 00 00    	je     8047ed <devpipe_write+0x128>
+  8046fc:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  804700:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  804704:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  804708:	49 bd 9e 46 80 00 00 	movabs $0x80469e,%r13
+  80470f:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  804712:	49 bf fb 45 80 00 00 	movabs $0x8045fb,%r15
+  804719:	00 00 00 
+  80471c:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  804720:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804724:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804728:	8b 73 04             	mov    0x4(%rbx),%esi
+  80472b:	48 63 ce             	movslq %esi,%rcx
+  80472e:	48 63 03             	movslq (%rbx),%rax
+  804731:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  804737:	48 39 c1             	cmp    %rax,%rcx
+  80473a:	72 64                	jb     8047a0 <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  80473c:	48 89 de             	mov    %rbx,%rsi
+  80473f:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  804743:	41 ff d5             	call   *%r13
+  804746:	85 c0                	test   %eax,%eax
+  804748:	0f 85 b9 00 00 00    	jne    804807 <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  80474e:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  804752:	4c 89 f7             	mov    %r14,%rdi
+  804755:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  804758:	8b 43 04             	mov    0x4(%rbx),%eax
+  80475b:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  804762:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  804769:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  80476f:	8b 03                	mov    (%rbx),%eax
+  804771:	41 39 c4             	cmp    %eax,%r12d
+  804774:	75 b2                	jne    804728 <devpipe_write+0x63>
+  804776:	48 89 de             	mov    %rbx,%rsi
+  804779:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80477d:	41 ff d5             	call   *%r13
+  804780:	85 c0                	test   %eax,%eax
+  804782:	75 a0                	jne    804724 <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  804784:	ba 0a 00 00 00       	mov    $0xa,%edx
+  804789:	44 89 e6             	mov    %r12d,%esi
+  80478c:	48 89 df             	mov    %rbx,%rdi
+  80478f:	48 b8 0f 22 80 00 00 	movabs $0x80220f,%rax
+  804796:	00 00 00 
+  804799:	ff d0                	call   *%rax
+  80479b:	e9 7c ff ff ff       	jmp    80471c <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8047a0:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  8047a4:	41 0f b6 38          	movzbl (%r8),%edi
+  8047a8:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  8047af:	80 80 80 
+  8047b2:	48 89 c8             	mov    %rcx,%rax
+  8047b5:	48 f7 e2             	mul    %rdx
+  8047b8:	48 c1 ea 0b          	shr    $0xb,%rdx
+  8047bc:	48 89 d0             	mov    %rdx,%rax
+  8047bf:	48 c1 e0 08          	shl    $0x8,%rax
+  8047c3:	48 29 d0             	sub    %rdx,%rax
+  8047c6:	48 c1 e0 04          	shl    $0x4,%rax
+  8047ca:	48 29 c1             	sub    %rax,%rcx
+  8047cd:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  8047d2:	83 c6 01             	add    $0x1,%esi
+  8047d5:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8047d8:	49 83 c0 01          	add    $0x1,%r8
+  8047dc:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  8047e0:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8047e4:	49 39 c0             	cmp    %rax,%r8
+  8047e7:	0f 85 2f ff ff ff    	jne    80471c <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8047ed:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  8047f1:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  8047f5:	48 b8 fb 45 80 00 00 	movabs $0x8045fb,%rax
+  8047fc:	00 00 00 
+  8047ff:	ff d0                	call   *%rax
+    return n;
+  804801:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804805:	eb 05                	jmp    80480c <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  804807:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80480c:	48 83 c4 38          	add    $0x38,%rsp
+  804810:	5b                   	pop    %rbx
+  804811:	41 5c                	pop    %r12
+  804813:	41 5d                	pop    %r13
+  804815:	41 5e                	pop    %r14
+  804817:	41 5f                	pop    %r15
+  804819:	5d                   	pop    %rbp
+  80481a:	c3                   	ret
+
+000000000080481b <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80481b:	55                   	push   %rbp
+  80481c:	48 89 e5             	mov    %rsp,%rbp
+  80481f:	41 57                	push   %r15
+  804821:	41 56                	push   %r14
+  804823:	41 55                	push   %r13
+  804825:	41 54                	push   %r12
+  804827:	53                   	push   %rbx
+  804828:	48 83 ec 28          	sub    $0x28,%rsp
+  80482c:	49 89 fd             	mov    %rdi,%r13
+  80482f:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  804833:	49 89 d4             	mov    %rdx,%r12
+  804836:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80483a:	48 b8 ad 24 80 00 00 	movabs $0x8024ad,%rax
+  804841:	00 00 00 
+  804844:	ff d0                	call   *%rax
+  804846:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  804849:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  80484f:	49 bf 9e 46 80 00 00 	movabs $0x80469e,%r15
+  804856:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  804859:	4d 85 e4             	test   %r12,%r12
+  80485c:	0f 84 d5 00 00 00    	je     804937 <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  804862:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  804866:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80486a:	8b 03                	mov    (%rbx),%eax
+  80486c:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80486f:	75 7a                	jne    8048eb <devpipe_read+0xd0>
+            if (i > 0) {
+  804871:	4d 85 f6             	test   %r14,%r14
+  804874:	75 50                	jne    8048c6 <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  804876:	48 89 de             	mov    %rbx,%rsi
+  804879:	4c 89 ef             	mov    %r13,%rdi
+  80487c:	41 ff d7             	call   *%r15
+  80487f:	85 c0                	test   %eax,%eax
+  804881:	0f 85 c9 00 00 00    	jne    804950 <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  804887:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  80488a:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  804891:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  804897:	8b 43 04             	mov    0x4(%rbx),%eax
+  80489a:	41 39 c4             	cmp    %eax,%r12d
+  80489d:	75 cb                	jne    80486a <devpipe_read+0x4f>
+  80489f:	48 89 de             	mov    %rbx,%rsi
+  8048a2:	4c 89 ef             	mov    %r13,%rdi
+  8048a5:	41 ff d7             	call   *%r15
+  8048a8:	85 c0                	test   %eax,%eax
+  8048aa:	75 be                	jne    80486a <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  8048ac:	ba 0a 00 00 00       	mov    $0xa,%edx
+  8048b1:	44 89 e6             	mov    %r12d,%esi
+  8048b4:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8048b8:	48 b8 0f 22 80 00 00 	movabs $0x80220f,%rax
+  8048bf:	00 00 00 
+  8048c2:	ff d0                	call   *%rax
+  8048c4:	eb a4                	jmp    80486a <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  8048c6:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  8048ca:	48 89 de             	mov    %rbx,%rsi
+  8048cd:	48 b8 fb 45 80 00 00 	movabs $0x8045fb,%rax
+  8048d4:	00 00 00 
+  8048d7:	ff d0                	call   *%rax
+                return i;
+  8048d9:	4c 89 f0             	mov    %r14,%rax
+}
+  8048dc:	48 83 c4 28          	add    $0x28,%rsp
+  8048e0:	5b                   	pop    %rbx
+  8048e1:	41 5c                	pop    %r12
+  8048e3:	41 5d                	pop    %r13
+  8048e5:	41 5e                	pop    %r14
+  8048e7:	41 5f                	pop    %r15
+  8048e9:	5d                   	pop    %rbp
+  8048ea:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8048eb:	48 63 c8             	movslq %eax,%rcx
+  8048ee:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  8048f5:	80 80 80 
+  8048f8:	48 89 c8             	mov    %rcx,%rax
+  8048fb:	48 f7 e2             	mul    %rdx
+  8048fe:	48 c1 ea 0b          	shr    $0xb,%rdx
+  804902:	48 89 d0             	mov    %rdx,%rax
+  804905:	48 c1 e0 08          	shl    $0x8,%rax
+  804909:	48 29 d0             	sub    %rdx,%rax
+  80490c:	48 c1 e0 04          	shl    $0x4,%rax
+  804910:	48 89 c2             	mov    %rax,%rdx
+  804913:	48 89 c8             	mov    %rcx,%rax
+  804916:	48 29 d0             	sub    %rdx,%rax
+  804919:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  80491e:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804922:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  804926:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  804929:	49 83 c6 01          	add    $0x1,%r14
+  80492d:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  804931:	0f 85 2b ff ff ff    	jne    804862 <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  804937:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  80493b:	48 89 de             	mov    %rbx,%rsi
+  80493e:	48 b8 fb 45 80 00 00 	movabs $0x8045fb,%rax
+  804945:	00 00 00 
+  804948:	ff d0                	call   *%rax
+    return n;
+  80494a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80494e:	eb 8c                	jmp    8048dc <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  804950:	b8 00 00 00 00       	mov    $0x0,%eax
+  804955:	eb 85                	jmp    8048dc <devpipe_read+0xc1>
+
+0000000000804957 <pipe>:
+pipe(int pfd[2]) {
+  804957:	55                   	push   %rbp
+  804958:	48 89 e5             	mov    %rsp,%rbp
+  80495b:	41 55                	push   %r13
+  80495d:	41 54                	push   %r12
+  80495f:	53                   	push   %rbx
+  804960:	48 83 ec 18          	sub    $0x18,%rsp
+  804964:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804967:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80496b:	48 b8 c9 24 80 00 00 	movabs $0x8024c9,%rax
+  804972:	00 00 00 
+  804975:	ff d0                	call   *%rax
+  804977:	89 c3                	mov    %eax,%ebx
+  804979:	85 c0                	test   %eax,%eax
+  80497b:	0f 88 a0 01 00 00    	js     804b21 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  804981:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804986:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80498b:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80498f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804994:	48 b8 a1 1e 80 00 00 	movabs $0x801ea1,%rax
+  80499b:	00 00 00 
+  80499e:	ff d0                	call   *%rax
+  8049a0:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8049a2:	85 c0                	test   %eax,%eax
+  8049a4:	0f 88 77 01 00 00    	js     804b21 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8049aa:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8049ae:	48 b8 c9 24 80 00 00 	movabs $0x8024c9,%rax
+  8049b5:	00 00 00 
+  8049b8:	ff d0                	call   *%rax
+  8049ba:	89 c3                	mov    %eax,%ebx
+  8049bc:	85 c0                	test   %eax,%eax
+  8049be:	0f 88 43 01 00 00    	js     804b07 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8049c4:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8049c9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8049ce:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8049d2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8049d7:	48 b8 a1 1e 80 00 00 	movabs $0x801ea1,%rax
+  8049de:	00 00 00 
+  8049e1:	ff d0                	call   *%rax
+  8049e3:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8049e5:	85 c0                	test   %eax,%eax
+  8049e7:	0f 88 1a 01 00 00    	js     804b07 <pipe+0x1b0>
+    va = fd2data(fd0);
+  8049ed:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8049f1:	48 b8 ad 24 80 00 00 	movabs $0x8024ad,%rax
+  8049f8:	00 00 00 
+  8049fb:	ff d0                	call   *%rax
+  8049fd:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  804a00:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804a05:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804a0a:	48 89 c6             	mov    %rax,%rsi
+  804a0d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a12:	48 b8 a1 1e 80 00 00 	movabs $0x801ea1,%rax
+  804a19:	00 00 00 
+  804a1c:	ff d0                	call   *%rax
+  804a1e:	89 c3                	mov    %eax,%ebx
+  804a20:	85 c0                	test   %eax,%eax
+  804a22:	0f 88 c5 00 00 00    	js     804aed <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  804a28:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804a2c:	48 b8 ad 24 80 00 00 	movabs $0x8024ad,%rax
+  804a33:	00 00 00 
+  804a36:	ff d0                	call   *%rax
+  804a38:	48 89 c1             	mov    %rax,%rcx
+  804a3b:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  804a41:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804a47:	ba 00 00 00 00       	mov    $0x0,%edx
+  804a4c:	4c 89 ee             	mov    %r13,%rsi
+  804a4f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a54:	48 b8 f7 1e 80 00 00 	movabs $0x801ef7,%rax
+  804a5b:	00 00 00 
+  804a5e:	ff d0                	call   *%rax
+  804a60:	89 c3                	mov    %eax,%ebx
+  804a62:	85 c0                	test   %eax,%eax
+  804a64:	78 6e                	js     804ad4 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804a66:	be 00 10 00 00       	mov    $0x1000,%esi
+  804a6b:	4c 89 ef             	mov    %r13,%rdi
+  804a6e:	48 b8 66 1e 80 00 00 	movabs $0x801e66,%rax
+  804a75:	00 00 00 
+  804a78:	ff d0                	call   *%rax
+  804a7a:	83 f8 02             	cmp    $0x2,%eax
+  804a7d:	0f 85 ab 00 00 00    	jne    804b2e <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  804a83:	a1 60 70 80 00 00 00 	movabs 0x807060,%eax
+  804a8a:	00 00 
+  804a8c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804a90:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  804a92:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804a96:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  804a9d:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804aa1:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  804aa3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804aa7:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  804aae:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804ab2:	48 bb 9b 24 80 00 00 	movabs $0x80249b,%rbx
+  804ab9:	00 00 00 
+  804abc:	ff d3                	call   *%rbx
+  804abe:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  804ac2:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804ac6:	ff d3                	call   *%rbx
+  804ac8:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  804acd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804ad2:	eb 4d                	jmp    804b21 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  804ad4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804ad9:	4c 89 ee             	mov    %r13,%rsi
+  804adc:	bf 00 00 00 00       	mov    $0x0,%edi
+  804ae1:	48 b8 47 1f 80 00 00 	movabs $0x801f47,%rax
+  804ae8:	00 00 00 
+  804aeb:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  804aed:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804af2:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804af6:	bf 00 00 00 00       	mov    $0x0,%edi
+  804afb:	48 b8 47 1f 80 00 00 	movabs $0x801f47,%rax
+  804b02:	00 00 00 
+  804b05:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  804b07:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804b0c:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804b10:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b15:	48 b8 47 1f 80 00 00 	movabs $0x801f47,%rax
+  804b1c:	00 00 00 
+  804b1f:	ff d0                	call   *%rax
+}
+  804b21:	89 d8                	mov    %ebx,%eax
+  804b23:	48 83 c4 18          	add    $0x18,%rsp
+  804b27:	5b                   	pop    %rbx
+  804b28:	41 5c                	pop    %r12
+  804b2a:	41 5d                	pop    %r13
+  804b2c:	5d                   	pop    %rbp
+  804b2d:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804b2e:	48 b9 70 5f 80 00 00 	movabs $0x805f70,%rcx
+  804b35:	00 00 00 
+  804b38:	48 ba 47 5f 80 00 00 	movabs $0x805f47,%rdx
+  804b3f:	00 00 00 
+  804b42:	be 50 00 00 00       	mov    $0x50,%esi
+  804b47:	48 bf 5c 5f 80 00 00 	movabs $0x805f5c,%rdi
+  804b4e:	00 00 00 
+  804b51:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b56:	49 b8 cd 0e 80 00 00 	movabs $0x800ecd,%r8
+  804b5d:	00 00 00 
+  804b60:	41 ff d0             	call   *%r8
+
+0000000000804b63 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  804b63:	55                   	push   %rbp
+  804b64:	48 89 e5             	mov    %rsp,%rbp
+  804b67:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804b6b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804b6f:	48 b8 29 25 80 00 00 	movabs $0x802529,%rax
+  804b76:	00 00 00 
+  804b79:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804b7b:	85 c0                	test   %eax,%eax
+  804b7d:	78 23                	js     804ba2 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  804b7f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804b83:	48 b8 ad 24 80 00 00 	movabs $0x8024ad,%rax
+  804b8a:	00 00 00 
+  804b8d:	ff d0                	call   *%rax
+  804b8f:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  804b92:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804b96:	48 b8 9e 46 80 00 00 	movabs $0x80469e,%rax
+  804b9d:	00 00 00 
+  804ba0:	ff d0                	call   *%rax
+}
+  804ba2:	c9                   	leave
+  804ba3:	c3                   	ret
+
+0000000000804ba4 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804ba4:	48 89 f8             	mov    %rdi,%rax
+  804ba7:	48 c1 e8 27          	shr    $0x27,%rax
+  804bab:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804bb2:	01 00 00 
+  804bb5:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804bb9:	f6 c2 01             	test   $0x1,%dl
+  804bbc:	74 6d                	je     804c2b <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804bbe:	48 89 f8             	mov    %rdi,%rax
+  804bc1:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804bc5:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804bcc:	01 00 00 
+  804bcf:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804bd3:	f6 c2 01             	test   $0x1,%dl
+  804bd6:	74 62                	je     804c3a <get_uvpt_entry+0x96>
+  804bd8:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804bdf:	01 00 00 
+  804be2:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804be6:	f6 c2 80             	test   $0x80,%dl
+  804be9:	75 4f                	jne    804c3a <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804beb:	48 89 f8             	mov    %rdi,%rax
+  804bee:	48 c1 e8 15          	shr    $0x15,%rax
+  804bf2:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804bf9:	01 00 00 
+  804bfc:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804c00:	f6 c2 01             	test   $0x1,%dl
+  804c03:	74 44                	je     804c49 <get_uvpt_entry+0xa5>
+  804c05:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804c0c:	01 00 00 
+  804c0f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804c13:	f6 c2 80             	test   $0x80,%dl
+  804c16:	75 31                	jne    804c49 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  804c18:	48 c1 ef 0c          	shr    $0xc,%rdi
+  804c1c:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804c23:	01 00 00 
+  804c26:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  804c2a:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804c2b:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804c32:	01 00 00 
+  804c35:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804c39:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804c3a:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804c41:	01 00 00 
+  804c44:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804c48:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804c49:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804c50:	01 00 00 
+  804c53:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804c57:	c3                   	ret
+
+0000000000804c58 <get_prot>:
+
+int
+get_prot(void *va) {
+  804c58:	55                   	push   %rbp
+  804c59:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804c5c:	48 b8 a4 4b 80 00 00 	movabs $0x804ba4,%rax
+  804c63:	00 00 00 
+  804c66:	ff d0                	call   *%rax
+  804c68:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  804c6b:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  804c70:	89 c1                	mov    %eax,%ecx
+  804c72:	83 c9 04             	or     $0x4,%ecx
+  804c75:	f6 c2 01             	test   $0x1,%dl
+  804c78:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  804c7b:	89 c1                	mov    %eax,%ecx
+  804c7d:	83 c9 02             	or     $0x2,%ecx
+  804c80:	f6 c2 02             	test   $0x2,%dl
+  804c83:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  804c86:	89 c1                	mov    %eax,%ecx
+  804c88:	83 c9 01             	or     $0x1,%ecx
+  804c8b:	48 85 d2             	test   %rdx,%rdx
+  804c8e:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804c91:	89 c1                	mov    %eax,%ecx
+  804c93:	83 c9 40             	or     $0x40,%ecx
+  804c96:	f6 c6 04             	test   $0x4,%dh
+  804c99:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804c9c:	5d                   	pop    %rbp
+  804c9d:	c3                   	ret
+
+0000000000804c9e <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804c9e:	55                   	push   %rbp
+  804c9f:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804ca2:	48 b8 a4 4b 80 00 00 	movabs $0x804ba4,%rax
+  804ca9:	00 00 00 
+  804cac:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804cae:	48 c1 e8 06          	shr    $0x6,%rax
+  804cb2:	83 e0 01             	and    $0x1,%eax
+}
+  804cb5:	5d                   	pop    %rbp
+  804cb6:	c3                   	ret
+
+0000000000804cb7 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804cb7:	55                   	push   %rbp
+  804cb8:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804cbb:	48 b8 a4 4b 80 00 00 	movabs $0x804ba4,%rax
+  804cc2:	00 00 00 
+  804cc5:	ff d0                	call   *%rax
+  804cc7:	83 e0 01             	and    $0x1,%eax
+}
+  804cca:	5d                   	pop    %rbp
+  804ccb:	c3                   	ret
+
+0000000000804ccc <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  804ccc:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  804cd3:	01 00 00 
+  804cd6:	a8 01                	test   $0x1,%al
+  804cd8:	75 06                	jne    804ce0 <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  804cda:	b8 00 00 00 00       	mov    $0x0,%eax
+  804cdf:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804ce0:	55                   	push   %rbp
+  804ce1:	48 89 e5             	mov    %rsp,%rbp
+  804ce4:	41 57                	push   %r15
+  804ce6:	41 56                	push   %r14
+  804ce8:	41 55                	push   %r13
+  804cea:	41 54                	push   %r12
+  804cec:	53                   	push   %rbx
+  804ced:	48 83 ec 28          	sub    $0x28,%rsp
+  804cf1:	49 89 fe             	mov    %rdi,%r14
+  804cf4:	49 89 f7             	mov    %rsi,%r15
+  804cf7:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  804cfe:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  804cff:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  804d06:	01 00 00 
+  804d09:	e9 ae 00 00 00       	jmp    804dbc <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  804d0e:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804d15:	49 83 ec 01          	sub    $0x1,%r12
+  804d19:	74 2d                	je     804d48 <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  804d1b:	48 89 d8             	mov    %rbx,%rax
+  804d1e:	48 c1 e8 0c          	shr    $0xc,%rax
+  804d22:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  804d27:	f6 c2 01             	test   $0x1,%dl
+  804d2a:	74 e2                	je     804d0e <foreach_shared_region+0x42>
+  804d2c:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  804d31:	f6 c4 04             	test   $0x4,%ah
+  804d34:	74 d8                	je     804d0e <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  804d36:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  804d3d:	4c 89 fa             	mov    %r15,%rdx
+  804d40:	48 89 df             	mov    %rbx,%rdi
+  804d43:	41 ff d6             	call   *%r14
+  804d46:	eb c6                	jmp    804d0e <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  804d48:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  804d4f:	00 
+  804d50:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  804d55:	74 4a                	je     804da1 <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  804d57:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804d5b:	48 c1 e8 15          	shr    $0x15,%rax
+  804d5f:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  804d66:	01 00 00 
+  804d69:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804d6d:	a8 01                	test   $0x1,%al
+  804d6f:	74 d7                	je     804d48 <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  804d71:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  804d75:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  804d7c:	48 39 c3             	cmp    %rax,%rbx
+  804d7f:	73 c7                	jae    804d48 <foreach_shared_region+0x7c>
+  804d81:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  804d88:	48 39 d0             	cmp    %rdx,%rax
+  804d8b:	4d 19 e4             	sbb    %r12,%r12
+  804d8e:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  804d95:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  804d9c:	e9 7a ff ff ff       	jmp    804d1b <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  804da1:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  804da8:	40 
+  804da9:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804dad:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804db4:	00 00 00 
+  804db7:	48 39 c1             	cmp    %rax,%rcx
+  804dba:	74 50                	je     804e0c <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  804dbc:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804dc0:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804dc4:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  804dcb:	01 00 00 
+  804dce:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804dd2:	a8 01                	test   $0x1,%al
+  804dd4:	74 cb                	je     804da1 <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  804dd6:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804dda:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  804de1:	48 39 c1             	cmp    %rax,%rcx
+  804de4:	73 bb                	jae    804da1 <foreach_shared_region+0xd5>
+  804de6:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  804ded:	48 39 d0             	cmp    %rdx,%rax
+  804df0:	48 19 c0             	sbb    %rax,%rax
+  804df3:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  804df9:	48 05 00 02 00 00    	add    $0x200,%rax
+  804dff:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804e03:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  804e07:	e9 4b ff ff ff       	jmp    804d57 <foreach_shared_region+0x8b>
+  804e0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e11:	48 83 c4 28          	add    $0x28,%rsp
+  804e15:	5b                   	pop    %rbx
+  804e16:	41 5c                	pop    %r12
+  804e18:	41 5d                	pop    %r13
+  804e1a:	41 5e                	pop    %r14
+  804e1c:	41 5f                	pop    %r15
+  804e1e:	5d                   	pop    %rbp
+  804e1f:	c3                   	ret
+
+0000000000804e20 <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  804e20:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  804e26:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  804e2d:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  804e34:	c3                   	ret
+
+0000000000804e35 <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  804e35:	8b 47 40             	mov    0x40(%rdi),%eax
+  804e38:	8b 17                	mov    (%rdi),%edx
+  804e3a:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  804e3c:	83 f8 0f             	cmp    $0xf,%eax
+  804e3f:	77 13                	ja     804e54 <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  804e41:	8b 47 40             	mov    0x40(%rdi),%eax
+  804e44:	83 e0 0f             	and    $0xf,%eax
+  804e47:	48 c1 e0 09          	shl    $0x9,%rax
+  804e4b:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  804e52:	00 
+  804e53:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  804e54:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804e59:	c3                   	ret
+
+0000000000804e5a <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  804e5a:	8b 47 40             	mov    0x40(%rdi),%eax
+  804e5d:	83 c0 01             	add    $0x1,%eax
+  804e60:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  804e63:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  804e69:	8b 57 04             	mov    0x4(%rdi),%edx
+  804e6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e71:	85 d2                	test   %edx,%edx
+  804e73:	75 04                	jne    804e79 <chan_publish+0x1f>
+  804e75:	83 e0 01             	and    $0x1,%eax
+}
+  804e78:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  804e79:	87 47 04             	xchg   %eax,0x4(%rdi)
+  804e7c:	85 c0                	test   %eax,%eax
+  804e7e:	0f 95 c0             	setne  %al
+  804e81:	0f b6 c0             	movzbl %al,%eax
+  804e84:	eb ef                	jmp    804e75 <chan_publish+0x1b>
+
+0000000000804e86 <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  804e86:	8b 47 40             	mov    0x40(%rdi),%eax
+  804e89:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  804e8b:	29 d0                	sub    %edx,%eax
+  804e8d:	83 e8 01             	sub    $0x1,%eax
+  804e90:	83 f8 0f             	cmp    $0xf,%eax
+  804e93:	77 12                	ja     804ea7 <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  804e95:	8b 07                	mov    (%rdi),%eax
+  804e97:	83 e0 0f             	and    $0xf,%eax
+  804e9a:	48 c1 e0 09          	shl    $0x9,%rax
+  804e9e:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  804ea5:	00 
+  804ea6:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  804ea7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804eac:	c3                   	ret
+
+0000000000804ead <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  804ead:	8b 07                	mov    (%rdi),%eax
+  804eaf:	83 c0 01             	add    $0x1,%eax
+  804eb2:	89 07                	mov    %eax,(%rdi)
+}
+  804eb4:	c3                   	ret
+
+0000000000804eb5 <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  804eb5:	55                   	push   %rbp
+  804eb6:	48 89 e5             	mov    %rsp,%rbp
+  804eb9:	53                   	push   %rbx
+  804eba:	48 83 ec 08          	sub    $0x8,%rsp
+  804ebe:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  804ec1:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  804ec8:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  804ece:	48 b8 86 4e 80 00 00 	movabs $0x804e86,%rax
+  804ed5:	00 00 00 
+  804ed8:	ff d0                	call   *%rax
+  804eda:	48 85 c0             	test   %rax,%rax
+  804edd:	74 12                	je     804ef1 <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  804edf:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  804ee6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804eeb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804eef:	c9                   	leave
+  804ef0:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  804ef1:	b8 01 00 00 00       	mov    $0x1,%eax
+  804ef6:	eb f3                	jmp    804eeb <chan_arm+0x36>
+
+0000000000804ef8 <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  804ef8:	55                   	push   %rbp
+  804ef9:	48 89 e5             	mov    %rsp,%rbp
+  804efc:	41 56                	push   %r14
+  804efe:	41 55                	push   %r13
+  804f00:	41 54                	push   %r12
+  804f02:	53                   	push   %rbx
+  804f03:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  804f06:	49 bc b5 4e 80 00 00 	movabs $0x804eb5,%r12
+  804f0d:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  804f10:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  804f14:	49 bd 0f 22 80 00 00 	movabs $0x80220f,%r13
+  804f1b:	00 00 00 
+    while (chan_arm(r))
+  804f1e:	eb 0d                	jmp    804f2d <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  804f20:	8b 33                	mov    (%rbx),%esi
+  804f22:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f27:	4c 89 f7             	mov    %r14,%rdi
+  804f2a:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  804f2d:	48 89 df             	mov    %rbx,%rdi
+  804f30:	41 ff d4             	call   *%r12
+  804f33:	84 c0                	test   %al,%al
+  804f35:	75 e9                	jne    804f20 <chan_wait+0x28>
+}
+  804f37:	5b                   	pop    %rbx
+  804f38:	41 5c                	pop    %r12
+  804f3a:	41 5d                	pop    %r13
+  804f3c:	41 5e                	pop    %r14
+  804f3e:	5d                   	pop    %rbp
+  804f3f:	c3                   	ret
+
+0000000000804f40 <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  804f40:	55                   	push   %rbp
+  804f41:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  804f44:	48 83 c7 40          	add    $0x40,%rdi
+  804f48:	be 01 00 00 00       	mov    $0x1,%esi
+  804f4d:	48 b8 2d 22 80 00 00 	movabs $0x80222d,%rax
+  804f54:	00 00 00 
+  804f57:	ff d0                	call   *%rax
+}
+  804f59:	5d                   	pop    %rbp
+  804f5a:	c3                   	ret
+
+0000000000804f5b <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804f5b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f60:	c3                   	ret
+
+0000000000804f61 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804f61:	55                   	push   %rbp
+  804f62:	48 89 e5             	mov    %rsp,%rbp
+  804f65:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804f68:	48 be 94 5f 80 00 00 	movabs $0x805f94,%rsi
+  804f6f:	00 00 00 
+  804f72:	48 b8 42 19 80 00 00 	movabs $0x801942,%rax
+  804f79:	00 00 00 
+  804f7c:	ff d0                	call   *%rax
+    return 0;
+}
+  804f7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f83:	5d                   	pop    %rbp
+  804f84:	c3                   	ret
+
+0000000000804f85 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804f85:	55                   	push   %rbp
+  804f86:	48 89 e5             	mov    %rsp,%rbp
+  804f89:	41 57                	push   %r15
+  804f8b:	41 56                	push   %r14
+  804f8d:	41 55                	push   %r13
+  804f8f:	41 54                	push   %r12
+  804f91:	53                   	push   %rbx
+  804f92:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  804f99:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  804fa0:	48 85 d2             	test   %rdx,%rdx
+  804fa3:	74 7a                	je     80501f <devcons_write+0x9a>
+  804fa5:	49 89 d6             	mov    %rdx,%r14
+  804fa8:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804fae:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  804fb3:	49 bf 3c 1b 80 00 00 	movabs $0x801b3c,%r15
+  804fba:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804fbd:	4c 89 f3             	mov    %r14,%rbx
+  804fc0:	48 29 f3             	sub    %rsi,%rbx
+  804fc3:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804fc8:	48 39 c3             	cmp    %rax,%rbx
+  804fcb:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804fcf:	4c 63 eb             	movslq %ebx,%r13
+  804fd2:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804fd9:	48 01 c6             	add    %rax,%rsi
+  804fdc:	4c 89 ea             	mov    %r13,%rdx
+  804fdf:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804fe6:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  804fe9:	4c 89 ee             	mov    %r13,%rsi
+  804fec:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804ff3:	48 b8 69 1d 80 00 00 	movabs $0x801d69,%rax
+  804ffa:	00 00 00 
+  804ffd:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804fff:	41 01 dc             	add    %ebx,%r12d
+  805002:	49 63 f4             	movslq %r12d,%rsi
+  805005:	4c 39 f6             	cmp    %r14,%rsi
+  805008:	72 b3                	jb     804fbd <devcons_write+0x38>
+    return res;
+  80500a:	49 63 c4             	movslq %r12d,%rax
+}
+  80500d:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  805014:	5b                   	pop    %rbx
+  805015:	41 5c                	pop    %r12
+  805017:	41 5d                	pop    %r13
+  805019:	41 5e                	pop    %r14
+  80501b:	41 5f                	pop    %r15
+  80501d:	5d                   	pop    %rbp
+  80501e:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80501f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  805025:	eb e3                	jmp    80500a <devcons_write+0x85>
+
+0000000000805027 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805027:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80502a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80502f:	48 85 c0             	test   %rax,%rax
+  805032:	74 55                	je     805089 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805034:	55                   	push   %rbp
+  805035:	48 89 e5             	mov    %rsp,%rbp
+  805038:	41 55                	push   %r13
+  80503a:	41 54                	push   %r12
+  80503c:	53                   	push   %rbx
+  80503d:	48 83 ec 08          	sub    $0x8,%rsp
+  805041:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  805044:	48 bb 88 1d 80 00 00 	movabs $0x801d88,%rbx
+  80504b:	00 00 00 
+  80504e:	49 bc 3d 1e 80 00 00 	movabs $0x801e3d,%r12
+  805055:	00 00 00 
+  805058:	eb 03                	jmp    80505d <devcons_read+0x36>
+  80505a:	41 ff d4             	call   *%r12
+  80505d:	ff d3                	call   *%rbx
+  80505f:	85 c0                	test   %eax,%eax
+  805061:	74 f7                	je     80505a <devcons_read+0x33>
+    if (c < 0) return c;
+  805063:	48 63 d0             	movslq %eax,%rdx
+  805066:	78 13                	js     80507b <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  805068:	ba 00 00 00 00       	mov    $0x0,%edx
+  80506d:	83 f8 04             	cmp    $0x4,%eax
+  805070:	74 09                	je     80507b <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  805072:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  805076:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  80507b:	48 89 d0             	mov    %rdx,%rax
+  80507e:	48 83 c4 08          	add    $0x8,%rsp
+  805082:	5b                   	pop    %rbx
+  805083:	41 5c                	pop    %r12
+  805085:	41 5d                	pop    %r13
+  805087:	5d                   	pop    %rbp
+  805088:	c3                   	ret
+  805089:	48 89 d0             	mov    %rdx,%rax
+  80508c:	c3                   	ret
+
+000000000080508d <cputchar>:
+cputchar(int ch) {
+  80508d:	55                   	push   %rbp
+  80508e:	48 89 e5             	mov    %rsp,%rbp
+  805091:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  805095:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  805099:	be 01 00 00 00       	mov    $0x1,%esi
+  80509e:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8050a2:	48 b8 69 1d 80 00 00 	movabs $0x801d69,%rax
+  8050a9:	00 00 00 
+  8050ac:	ff d0                	call   *%rax
+}
+  8050ae:	c9                   	leave
+  8050af:	c3                   	ret
+
+00000000008050b0 <getchar>:
+getchar(void) {
+  8050b0:	55                   	push   %rbp
+  8050b1:	48 89 e5             	mov    %rsp,%rbp
+  8050b4:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8050b8:	ba 01 00 00 00       	mov    $0x1,%edx
+  8050bd:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8050c1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8050c6:	48 b8 0c 28 80 00 00 	movabs $0x80280c,%rax
+  8050cd:	00 00 00 
+  8050d0:	ff d0                	call   *%rax
+  8050d2:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8050d4:	85 c0                	test   %eax,%eax
+  8050d6:	78 06                	js     8050de <getchar+0x2e>
+  8050d8:	74 08                	je     8050e2 <getchar+0x32>
+  8050da:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8050de:	89 d0                	mov    %edx,%eax
+  8050e0:	c9                   	leave
+  8050e1:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8050e2:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8050e7:	eb f5                	jmp    8050de <getchar+0x2e>
+
+00000000008050e9 <iscons>:
+iscons(int fdnum) {
+  8050e9:	55                   	push   %rbp
+  8050ea:	48 89 e5             	mov    %rsp,%rbp
+  8050ed:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8050f1:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8050f5:	48 b8 29 25 80 00 00 	movabs $0x802529,%rax
+  8050fc:	00 00 00 
+  8050ff:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  805101:	85 c0                	test   %eax,%eax
+  805103:	78 18                	js     80511d <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  805105:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805109:	48 b8 a0 70 80 00 00 	movabs $0x8070a0,%rax
+  805110:	00 00 00 
+  805113:	8b 00                	mov    (%rax),%eax
+  805115:	39 02                	cmp    %eax,(%rdx)
+  805117:	0f 94 c0             	sete   %al
+  80511a:	0f b6 c0             	movzbl %al,%eax
+}
+  80511d:	c9                   	leave
+  80511e:	c3                   	ret
+
+000000000080511f <opencons>:
+opencons(void) {
+  80511f:	55                   	push   %rbp
+  805120:	48 89 e5             	mov    %rsp,%rbp
+  805123:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  805127:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80512b:	48 b8 c9 24 80 00 00 	movabs $0x8024c9,%rax
+  805132:	00 00 00 
+  805135:	ff d0                	call   *%rax
+  805137:	85 c0                	test   %eax,%eax
+  805139:	78 49                	js     805184 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80513b:	b9 46 00 00 00       	mov    $0x46,%ecx
+  805140:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805145:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  805149:	bf 00 00 00 00       	mov    $0x0,%edi
+  80514e:	48 b8 a1 1e 80 00 00 	movabs $0x801ea1,%rax
+  805155:	00 00 00 
+  805158:	ff d0                	call   *%rax
+  80515a:	85 c0                	test   %eax,%eax
+  80515c:	78 26                	js     805184 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80515e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805162:	a1 a0 70 80 00 00 00 	movabs 0x8070a0,%eax
+  805169:	00 00 
+  80516b:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80516d:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  805171:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  805178:	48 b8 9b 24 80 00 00 	movabs $0x80249b,%rax
+  80517f:	00 00 00 
+  805182:	ff d0                	call   *%rax
+}
+  805184:	c9                   	leave
+  805185:	c3                   	ret
+
+0000000000805186 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  805186:	55                   	push   %rbp
+  805187:	48 89 e5             	mov    %rsp,%rbp
+  80518a:	41 56                	push   %r14
+  80518c:	41 55                	push   %r13
+  80518e:	41 54                	push   %r12
+  805190:	53                   	push   %rbx
+  805191:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805194:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  80519b:	00 00 00 
+  80519e:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8051a2:	74 27                	je     8051cb <_handle_vectored_pagefault+0x45>
+  8051a4:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  8051a9:	49 bd 00 10 84 00 00 	movabs $0x841000,%r13
+  8051b0:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8051b3:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  8051b6:	4c 89 e7             	mov    %r12,%rdi
+  8051b9:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  8051be:	84 c0                	test   %al,%al
+  8051c0:	75 45                	jne    805207 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8051c2:	48 83 c3 01          	add    $0x1,%rbx
+  8051c6:	49 3b 1e             	cmp    (%r14),%rbx
+  8051c9:	72 eb                	jb     8051b6 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  8051cb:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  8051d2:	00 
+  8051d3:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  8051d8:	4d 8b 04 24          	mov    (%r12),%r8
+  8051dc:	48 ba a0 5f 80 00 00 	movabs $0x805fa0,%rdx
+  8051e3:	00 00 00 
+  8051e6:	be 1d 00 00 00       	mov    $0x1d,%esi
+  8051eb:	48 bf d0 5f 80 00 00 	movabs $0x805fd0,%rdi
+  8051f2:	00 00 00 
+  8051f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051fa:	49 ba cd 0e 80 00 00 	movabs $0x800ecd,%r10
+  805201:	00 00 00 
+  805204:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  805207:	5b                   	pop    %rbx
+  805208:	41 5c                	pop    %r12
+  80520a:	41 5d                	pop    %r13
+  80520c:	41 5e                	pop    %r14
+  80520e:	5d                   	pop    %rbp
+  80520f:	c3                   	ret
+
+0000000000805210 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  805210:	55                   	push   %rbp
+  805211:	48 89 e5             	mov    %rsp,%rbp
+  805214:	53                   	push   %rbx
+  805215:	48 83 ec 08          	sub    $0x8,%rsp
+  805219:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  80521c:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  805223:	00 00 00 
+  805226:	80 38 00             	cmpb   $0x0,(%rax)
+  805229:	0f 84 84 00 00 00    	je     8052b3 <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80522f:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  805236:	00 00 00 
+  805239:	48 8b 10             	mov    (%rax),%rdx
+  80523c:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  805241:	48 b9 00 10 84 00 00 	movabs $0x841000,%rcx
+  805248:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80524b:	48 85 d2             	test   %rdx,%rdx
+  80524e:	74 19                	je     805269 <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  805250:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  805254:	0f 84 e8 00 00 00    	je     805342 <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80525a:	48 83 c0 01          	add    $0x1,%rax
+  80525e:	48 39 d0             	cmp    %rdx,%rax
+  805261:	75 ed                	jne    805250 <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  805263:	48 83 fa 08          	cmp    $0x8,%rdx
+  805267:	74 1c                	je     805285 <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  805269:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80526d:	48 a3 48 10 84 00 00 	movabs %rax,0x841048
+  805274:	00 00 00 
+  805277:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  80527e:	00 00 00 
+  805281:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  805285:	48 b8 14 1e 80 00 00 	movabs $0x801e14,%rax
+  80528c:	00 00 00 
+  80528f:	ff d0                	call   *%rax
+  805291:	89 c7                	mov    %eax,%edi
+  805293:	48 be 08 54 80 00 00 	movabs $0x805408,%rsi
+  80529a:	00 00 00 
+  80529d:	48 b8 5f 20 80 00 00 	movabs $0x80205f,%rax
+  8052a4:	00 00 00 
+  8052a7:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8052a9:	85 c0                	test   %eax,%eax
+  8052ab:	78 68                	js     805315 <add_pgfault_handler+0x105>
+    return res;
+}
+  8052ad:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8052b1:	c9                   	leave
+  8052b2:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  8052b3:	48 b8 14 1e 80 00 00 	movabs $0x801e14,%rax
+  8052ba:	00 00 00 
+  8052bd:	ff d0                	call   *%rax
+  8052bf:	89 c7                	mov    %eax,%edi
+  8052c1:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8052c6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8052cb:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  8052d2:	00 00 00 
+  8052d5:	48 b8 a1 1e 80 00 00 	movabs $0x801ea1,%rax
+  8052dc:	00 00 00 
+  8052df:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8052e1:	48 ba 48 10 84 00 00 	movabs $0x841048,%rdx
+  8052e8:	00 00 00 
+  8052eb:	48 8b 02             	mov    (%rdx),%rax
+  8052ee:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8052f2:	48 89 0a             	mov    %rcx,(%rdx)
+  8052f5:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  8052fc:	00 00 00 
+  8052ff:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  805303:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  80530a:	00 00 00 
+  80530d:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  805310:	e9 70 ff ff ff       	jmp    805285 <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805315:	89 c1                	mov    %eax,%ecx
+  805317:	48 ba de 5f 80 00 00 	movabs $0x805fde,%rdx
+  80531e:	00 00 00 
+  805321:	be 3d 00 00 00       	mov    $0x3d,%esi
+  805326:	48 bf d0 5f 80 00 00 	movabs $0x805fd0,%rdi
+  80532d:	00 00 00 
+  805330:	b8 00 00 00 00       	mov    $0x0,%eax
+  805335:	49 b8 cd 0e 80 00 00 	movabs $0x800ecd,%r8
+  80533c:	00 00 00 
+  80533f:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  805342:	b8 00 00 00 00       	mov    $0x0,%eax
+  805347:	e9 61 ff ff ff       	jmp    8052ad <add_pgfault_handler+0x9d>
+
+000000000080534c <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  80534c:	55                   	push   %rbp
+  80534d:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  805350:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  805357:	00 00 00 
+  80535a:	80 38 00             	cmpb   $0x0,(%rax)
+  80535d:	74 33                	je     805392 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80535f:	48 a1 48 10 84 00 00 	movabs 0x841048,%rax
+  805366:	00 00 00 
+  805369:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  80536e:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  805375:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805378:	48 85 c0             	test   %rax,%rax
+  80537b:	0f 84 85 00 00 00    	je     805406 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  805381:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  805385:	74 40                	je     8053c7 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805387:	48 83 c1 01          	add    $0x1,%rcx
+  80538b:	48 39 c1             	cmp    %rax,%rcx
+  80538e:	75 f1                	jne    805381 <remove_pgfault_handler+0x35>
+  805390:	eb 74                	jmp    805406 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  805392:	48 b9 f6 5f 80 00 00 	movabs $0x805ff6,%rcx
+  805399:	00 00 00 
+  80539c:	48 ba 47 5f 80 00 00 	movabs $0x805f47,%rdx
+  8053a3:	00 00 00 
+  8053a6:	be 43 00 00 00       	mov    $0x43,%esi
+  8053ab:	48 bf d0 5f 80 00 00 	movabs $0x805fd0,%rdi
+  8053b2:	00 00 00 
+  8053b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8053ba:	49 b8 cd 0e 80 00 00 	movabs $0x800ecd,%r8
+  8053c1:	00 00 00 
+  8053c4:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  8053c7:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  8053ce:	00 
+  8053cf:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8053d3:	48 29 ca             	sub    %rcx,%rdx
+  8053d6:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  8053dd:	00 00 00 
+  8053e0:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  8053e4:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  8053e9:	48 89 ce             	mov    %rcx,%rsi
+  8053ec:	48 b8 3c 1b 80 00 00 	movabs $0x801b3c,%rax
+  8053f3:	00 00 00 
+  8053f6:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  8053f8:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  8053ff:	00 00 00 
+  805402:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  805406:	5d                   	pop    %rbp
+  805407:	c3                   	ret
+
+0000000000805408 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  805408:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  80540b:	48 b8 86 51 80 00 00 	movabs $0x805186,%rax
+  805412:	00 00 00 
+    call *%rax
+  805415:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  805417:	41 5f                	pop    %r15
+	popq %r15
+  805419:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  80541b:	41 5f                	pop    %r15
+	popq %r14
+  80541d:	41 5e                	pop    %r14
+	popq %r13
+  80541f:	41 5d                	pop    %r13
+	popq %r12
+  805421:	41 5c                	pop    %r12
+	popq %r11
+  805423:	41 5b                	pop    %r11
+	popq %r10
+  805425:	41 5a                	pop    %r10
+	popq %r9
+  805427:	41 59                	pop    %r9
+	popq %r8
+  805429:	41 58                	pop    %r8
+	popq %rsi
+  80542b:	5e                   	pop    %rsi
+	popq %rdi
+  80542c:	5f                   	pop    %rdi
+	popq %rbp
+  80542d:	5d                   	pop    %rbp
+	popq %rdx
+  80542e:	5a                   	pop    %rdx
+	popq %rcx
+  80542f:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  805430:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  805435:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  80543a:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  80543e:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  805441:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  805446:	5b                   	pop    %rbx
+	popq %rax
+  805447:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  805448:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  80544c:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  80544d:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  805452:	c3                   	ret
+  805453:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000805458 <__rodata_start>:
+  805458:	77 72                	ja     8054cc <__rodata_start+0x74>
+  80545a:	69 74 65 20 25 73 40 	imul   $0x25407325,0x20(%rbp,%riz,2),%esi
+  805461:	25 
+  805462:	6c                   	insb   (%dx),%es:(%rdi)
+  805463:	64 3a 20             	cmp    %fs:(%rax),%ah
+  805466:	25 6c 64 00 75       	and    $0x7500646c,%eax
+  80546b:	73 65                	jae    8054d2 <__rodata_start+0x7a>
+  80546d:	72 2f                	jb     80549e <__rodata_start+0x46>
+  80546f:	74 65                	je     8054d6 <__rodata_start+0x7e>
+  805471:	73 74                	jae    8054e7 <__rodata_start+0x8f>
+  805473:	66 69 6c 65 2e 63 00 	imul   $0x63,0x2e(%rbp,%riz,2),%bp
+  80547a:	72 65                	jb     8054e1 <__rodata_start+0x89>
+  80547c:	61                   	(bad)
+  80547d:	64 20 25 73 40 25 6c 	and    %ah,%fs:0x6c254073(%rip)        # 6ca594f7 <__bss_end+0x6c2174f7>
+  805484:	64 3a 20             	cmp    %fs:(%rax),%ah
+  805487:	25 6c 64 00 2f       	and    $0x2f00646c,%eax
+  80548c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80548d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80548e:	74 2d                	je     8054bd <__rodata_start+0x65>
+  805490:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  805492:	75 6e                	jne    805502 <__rodata_start+0xaa>
+  805494:	64 00 73 65          	add    %dh,%fs:0x65(%rbx)
+  805498:	72 76                	jb     805510 <__rodata_start+0xb8>
+  80549a:	65 5f                	gs pop %rdi
+  80549c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80549d:	70 65                	jo     805504 <__rodata_start+0xac>
+  80549f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8054a0:	20 2f                	and    %ch,(%rdi)
+  8054a2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8054a3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8054a4:	74 2d                	je     8054d3 <__rodata_start+0x7b>
+  8054a6:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8054a8:	75 6e                	jne    805518 <__rodata_start+0xc0>
+  8054aa:	64 3a 20             	cmp    %fs:(%rax),%ah
+  8054ad:	25 6c 64 00 2f       	and    $0x2f00646c,%eax
+  8054b2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8054b3:	65 77 6d             	gs ja  805523 <__rodata_start+0xcb>
+  8054b6:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8054b7:	74 64                	je     80551d <__rodata_start+0xc5>
+  8054b9:	00 73 65             	add    %dh,0x65(%rbx)
+  8054bc:	72 76                	jb     805534 <__rodata_start+0xdc>
+  8054be:	65 5f                	gs pop %rdi
+  8054c0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8054c1:	70 65                	jo     805528 <__rodata_start+0xd0>
+  8054c3:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8054c4:	20 2f                	and    %ch,(%rdi)
+  8054c6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8054c7:	65 77 6d             	gs ja  805537 <__rodata_start+0xdf>
+  8054ca:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8054cb:	74 64                	je     805531 <__rodata_start+0xd9>
+  8054cd:	3a 20                	cmp    (%rax),%ah
+  8054cf:	25 6c 64 00 73       	and    $0x7300646c,%eax
+  8054d4:	65 72 76             	gs jb  80554d <__rodata_start+0xf5>
+  8054d7:	65 5f                	gs pop %rdi
+  8054d9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8054da:	70 65                	jo     805541 <__rodata_start+0xe9>
+  8054dc:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8054dd:	20 69 73             	and    %ch,0x73(%rcx)
+  8054e0:	20 67 6f             	and    %ah,0x6f(%rdi)
+  8054e3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8054e4:	64 0a 00             	or     %fs:(%rax),%al
+  8054e7:	66 69 6c 65 5f 73 74 	imul   $0x7473,0x5f(%rbp,%riz,2),%bp
+  8054ee:	61                   	(bad)
+  8054ef:	74 3a                	je     80552b <__rodata_start+0xd3>
+  8054f1:	20 25 6c 64 00 66    	and    %ah,0x6600646c(%rip)        # 6680b963 <__bss_end+0x65fc9963>
+  8054f7:	69 6c 65 5f 73 74 61 	imul   $0x74617473,0x5f(%rbp,%riz,2),%ebp
+  8054fe:	74 
+  8054ff:	20 69 73             	and    %ch,0x73(%rcx)
+  805502:	20 67 6f             	and    %ah,0x6f(%rdi)
+  805505:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805506:	64 0a 00             	or     %fs:(%rax),%al
+  805509:	66 69 6c 65 5f 72 65 	imul   $0x6572,0x5f(%rbp,%riz,2),%bp
+  805510:	61                   	(bad)
+  805511:	64 3a 20             	cmp    %fs:(%rax),%ah
+  805514:	25 6c 64 00 66       	and    $0x6600646c,%eax
+  805519:	69 6c 65 5f 72 65 61 	imul   $0x64616572,0x5f(%rbp,%riz,2),%ebp
+  805520:	64 
+  805521:	20 72 65             	and    %dh,0x65(%rdx)
+  805524:	74 75                	je     80559b <__rodata_start+0x143>
+  805526:	72 6e                	jb     805596 <__rodata_start+0x13e>
+  805528:	65 64 20 77 72       	gs and %dh,%fs:0x72(%rdi)
+  80552d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80552e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80552f:	67 20 64 61 74       	and    %ah,0x74(%ecx,%eiz,2)
+  805534:	61                   	(bad)
+  805535:	00 66 69             	add    %ah,0x69(%rsi)
+  805538:	6c                   	insb   (%dx),%es:(%rdi)
+  805539:	65 5f                	gs pop %rdi
+  80553b:	72 65                	jb     8055a2 <__rodata_start+0x14a>
+  80553d:	61                   	(bad)
+  80553e:	64 20 69 73          	and    %ch,%fs:0x73(%rcx)
+  805542:	20 67 6f             	and    %ah,0x6f(%rdi)
+  805545:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805546:	64 0a 00             	or     %fs:(%rax),%al
+  805549:	66 69 6c 65 5f 63 6c 	imul   $0x6c63,0x5f(%rbp,%riz,2),%bp
+  805550:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805551:	73 65                	jae    8055b8 <__rodata_start+0x160>
+  805553:	3a 20                	cmp    (%rax),%ah
+  805555:	25 6c 64 00 66       	and    $0x6600646c,%eax
+  80555a:	69 6c 65 5f 63 6c 6f 	imul   $0x736f6c63,0x5f(%rbp,%riz,2),%ebp
+  805561:	73 
+  805562:	65 20 69 73          	and    %ch,%gs:0x73(%rcx)
+  805566:	20 67 6f             	and    %ah,0x6f(%rdi)
+  805569:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80556a:	64 0a 00             	or     %fs:(%rax),%al
+  80556d:	73 74                	jae    8055e3 <__rodata_start+0x18b>
+  80556f:	61                   	(bad)
+  805570:	6c                   	insb   (%dx),%es:(%rdi)
+  805571:	65 20 66 69          	and    %ah,%gs:0x69(%rsi)
+  805575:	6c                   	insb   (%dx),%es:(%rdi)
+  805576:	65 69 64 20 69 73 20 	imul   $0x6f672073,%gs:0x69(%rax,%riz,1),%esp
+  80557d:	67 6f 
+  80557f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805580:	64 0a 00             	or     %fs:(%rax),%al
+  805583:	2f                   	(bad)
+  805584:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805585:	65 77 2d             	gs ja  8055b5 <__rodata_start+0x15d>
+  805588:	66 69 6c 65 00 73 65 	imul   $0x6573,0x0(%rbp,%riz,2),%bp
+  80558f:	72 76                	jb     805607 <__rodata_start+0x1af>
+  805591:	65 5f                	gs pop %rdi
+  805593:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805594:	70 65                	jo     8055fb <__rodata_start+0x1a3>
+  805596:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805597:	20 2f                	and    %ch,(%rdi)
+  805599:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80559a:	65 77 2d             	gs ja  8055ca <__rodata_start+0x172>
+  80559d:	66 69 6c 65 3a 20 25 	imul   $0x2520,0x3a(%rbp,%riz,2),%bp
+  8055a4:	6c                   	insb   (%dx),%es:(%rdi)
+  8055a5:	64 00 66 69          	add    %ah,%fs:0x69(%rsi)
+  8055a9:	6c                   	insb   (%dx),%es:(%rdi)
+  8055aa:	65 5f                	gs pop %rdi
+  8055ac:	77 72                	ja     805620 <__rodata_start+0x1c8>
+  8055ae:	69 74 65 3a 20 25 6c 	imul   $0x646c2520,0x3a(%rbp,%riz,2),%esi
+  8055b5:	64 
+  8055b6:	00 66 69             	add    %ah,0x69(%rsi)
+  8055b9:	6c                   	insb   (%dx),%es:(%rdi)
+  8055ba:	65 5f                	gs pop %rdi
+  8055bc:	77 72                	ja     805630 <__rodata_start+0x1d8>
+  8055be:	69 74 65 20 69 73 20 	imul   $0x67207369,0x20(%rbp,%riz,2),%esi
+  8055c5:	67 
+  8055c6:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8055c7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8055c8:	64 0a 00             	or     %fs:(%rax),%al
+  8055cb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8055cc:	70 65                	jo     805633 <__rodata_start+0x1db>
+  8055ce:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8055cf:	20 2f                	and    %ch,(%rdi)
+  8055d1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8055d2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8055d3:	74 2d                	je     805602 <__rodata_start+0x1aa>
+  8055d5:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8055d7:	75 6e                	jne    805647 <__rodata_start+0x1ef>
+  8055d9:	64 20 73 75          	and    %dh,%fs:0x75(%rbx)
+  8055dd:	63 63 65             	movsxd 0x65(%rbx),%esp
+  8055e0:	65 64 65 64 21 00    	gs fs gs and %eax,%fs:(%rax)
+  8055e6:	2f                   	(bad)
+  8055e7:	62                   	(bad)
+  8055e8:	69 67 00 63 72 65 61 	imul   $0x61657263,0x0(%rdi),%esp
+  8055ef:	74 20                	je     805611 <__rodata_start+0x1b9>
+  8055f1:	2f                   	(bad)
+  8055f2:	62                   	(bad)
+  8055f3:	69 67 3a 20 25 6c 64 	imul   $0x646c2520,0x3a(%rdi),%esp
+  8055fa:	00 2f                	add    %ch,(%rdi)
+  8055fc:	62                   	(bad)
+  8055fd:	69 67 32 00 63 72 65 	imul   $0x65726300,0x32(%rdi),%esp
+  805604:	61                   	(bad)
+  805605:	74 20                	je     805627 <__rodata_start+0x1cf>
+  805607:	2f                   	(bad)
+  805608:	62                   	(bad)
+  805609:	69 67 32 3a 20 25 6c 	imul   $0x6c25203a,0x32(%rdi),%esp
+  805610:	64 00 6c 61 72       	add    %ch,%fs:0x72(%rcx,%riz,2)
+  805615:	67 65 20 66 69       	and    %ah,%gs:0x69(%esi)
+  80561a:	6c                   	insb   (%dx),%es:(%rdi)
+  80561b:	65 20 69 73          	and    %ch,%gs:0x73(%rcx)
+  80561f:	20 67 6f             	and    %ah,0x6f(%rdi)
+  805622:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805623:	64 0a 00             	or     %fs:(%rax),%al
+  805626:	66 74 72             	data16 je 80569b <__rodata_start+0x243>
+  805629:	75 6e                	jne    805699 <__rodata_start+0x241>
+  80562b:	63 61 74             	movsxd 0x74(%rcx),%esp
+  80562e:	65 20 2f             	and    %ch,%gs:(%rdi)
+  805631:	62                   	(bad)
+  805632:	69 67 3a 20 25 6c 64 	imul   $0x646c2520,0x3a(%rdi),%esp
+  805639:	00 72 65             	add    %dh,0x65(%rdx)
+  80563c:	6d                   	insl   (%dx),%es:(%rdi)
+  80563d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80563e:	76 65                	jbe    8056a5 <__rodata_start+0x24d>
+  805640:	20 2f                	and    %ch,(%rdi)
+  805642:	62                   	(bad)
+  805643:	69 67 32 3a 20 25 6c 	imul   $0x6c25203a,0x32(%rdi),%esp
+  80564a:	64 00 6c 61 72       	add    %ch,%fs:0x72(%rcx,%riz,2)
+  80564f:	67 65 20 66 69       	and    %ah,%gs:0x69(%esi)
+  805654:	6c                   	insb   (%dx),%es:(%rdi)
+  805655:	65 20 66 72          	and    %ah,%gs:0x72(%rsi)
+  805659:	65 65 20 69 73       	gs and %ch,%gs:0x73(%rcx)
+  80565e:	20 67 6f             	and    %ah,0x6f(%rdi)
+  805661:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805662:	64 0a 00             	or     %fs:(%rax),%al
+  805665:	0f 1f 00             	nopl   (%rax)
+  805668:	72 65                	jb     8056cf <__rodata_start+0x277>
+  80566a:	61                   	(bad)
+  80566b:	64 20 25 73 20 66 72 	and    %ah,%fs:0x72662073(%rip)        # 72e676e5 <__bss_end+0x726256e5>
+  805672:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805673:	6d                   	insl   (%dx),%es:(%rdi)
+  805674:	20 25 6c 64 20 72    	and    %ah,0x7220646c(%rip)        # 72a0bae6 <__bss_end+0x721c9ae6>
+  80567a:	65 74 75             	gs je  8056f2 <__rodata_start+0x29a>
+  80567d:	72 6e                	jb     8056ed <__rodata_start+0x295>
+  80567f:	65 64 20 25 6c 64 20 	gs and %ah,%fs:0x3c20646c(%rip)        # 3ca0baf3 <__bss_end+0x3c1c9af3>
+  805686:	3c 
+  805687:	20 25 64 20 62 79    	and    %ah,0x79622064(%rip)        # 79e276f1 <__bss_end+0x795e56f1>
+  80568d:	74 65                	je     8056f4 <__rodata_start+0x29c>
+  80568f:	73 00                	jae    805691 <__rodata_start+0x239>
+  805691:	00 00                	add    %al,(%rax)
+  805693:	00 00                	add    %al,(%rax)
+  805695:	00 00                	add    %al,(%rax)
+  805697:	00 72 65             	add    %dh,0x65(%rdx)
+  80569a:	61                   	(bad)
+  80569b:	64 20 25 73 20 66 72 	and    %ah,%fs:0x72662073(%rip)        # 72e67715 <__bss_end+0x72625715>
+  8056a2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8056a3:	6d                   	insl   (%dx),%es:(%rdi)
+  8056a4:	20 25 6c 64 20 72    	and    %ah,0x7220646c(%rip)        # 72a0bb16 <__bss_end+0x721c9b16>
+  8056aa:	65 74 75             	gs je  805722 <__rodata_start+0x2ca>
+  8056ad:	72 6e                	jb     80571d <__rodata_start+0x2c5>
+  8056af:	65 64 20 62 61       	gs and %ah,%fs:0x61(%rdx)
+  8056b4:	64 20 64 61 74       	and    %ah,%fs:0x74(%rcx,%riz,2)
+  8056b9:	61                   	(bad)
+  8056ba:	20 25 6c 64 2f 25    	and    %ah,0x252f646c(%rip)        # 25afbb2c <__bss_end+0x252b9b2c>
+  8056c0:	64 00 00             	add    %al,%fs:(%rax)
+  8056c3:	00 00                	add    %al,(%rax)
+  8056c5:	00 00                	add    %al,(%rax)
+  8056c7:	00 72 65             	add    %dh,0x65(%rdx)
+  8056ca:	61                   	(bad)
+  8056cb:	64 20 25 73 20 70 61 	and    %ah,%fs:0x61702073(%rip)        # 61f07745 <__bss_end+0x616c5745>
+  8056d2:	73 74                	jae    805748 <__rodata_start+0x2f0>
+  8056d4:	20 25 6c 64 20 62    	and    %ah,0x6220646c(%rip)        # 62a0bb46 <__bss_end+0x621c9b46>
+  8056da:	6c                   	insb   (%dx),%es:(%rdi)
+  8056db:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8056dc:	63 6b 73             	movsxd 0x73(%rbx),%ebp
+  8056df:	20 72 65             	and    %dh,0x65(%rdx)
+  8056e2:	74 75                	je     805759 <__rodata_start+0x301>
+  8056e4:	72 6e                	jb     805754 <__rodata_start+0x2fc>
+  8056e6:	65 64 20 25 6c 64 00 	gs and %ah,%fs:0x646c(%rip)        # 80bb5a <__ctors_end+0x4a7a>
+  8056ed:	00 
+  8056ee:	00 00                	add    %al,(%rax)
+  8056f0:	73 65                	jae    805757 <__rodata_start+0x2ff>
+  8056f2:	72 76                	jb     80576a <__rodata_start+0x312>
+  8056f4:	65 5f                	gs pop %rdi
+  8056f6:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8056f7:	70 65                	jo     80575e <__rodata_start+0x306>
+  8056f9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8056fa:	20 2f                	and    %ch,(%rdi)
+  8056fc:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8056fd:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8056fe:	74 2d                	je     80572d <__rodata_start+0x2d5>
+  805700:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  805702:	75 6e                	jne    805772 <__rodata_start+0x31a>
+  805704:	64 20 73 75          	and    %dh,%fs:0x75(%rbx)
+  805708:	63 63 65             	movsxd 0x65(%rbx),%esp
+  80570b:	65 64 65 64 21 00    	gs fs gs and %eax,%fs:(%rax)
+  805711:	00 00                	add    %al,(%rax)
+  805713:	00 00                	add    %al,(%rax)
+  805715:	00 00                	add    %al,(%rax)
+  805717:	00 73 65             	add    %dh,0x65(%rbx)
+  80571a:	72 76                	jb     805792 <__rodata_start+0x33a>
+  80571c:	65 5f                	gs pop %rdi
+  80571e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80571f:	70 65                	jo     805786 <__rodata_start+0x32e>
+  805721:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805722:	20 64 69 64          	and    %ah,0x64(%rcx,%rbp,2)
+  805726:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  805729:	74 20                	je     80574b <__rodata_start+0x2f3>
+  80572b:	66 69 6c 6c 20 73 74 	imul   $0x7473,0x20(%rsp,%rbp,2),%bp
+  805732:	72 75                	jb     8057a9 <__rodata_start+0x351>
+  805734:	63 74 20 46          	movsxd 0x46(%rax,%riz,1),%esi
+  805738:	64 20 63 6f          	and    %ah,%fs:0x6f(%rbx)
+  80573c:	72 72                	jb     8057b0 <__rodata_start+0x358>
+  80573e:	65 63 74 6c 79       	movsxd %gs:0x79(%rsp,%rbp,2),%esi
+  805743:	0a 00                	or     (%rax),%al
+  805745:	00 00                	add    %al,(%rax)
+  805747:	00 66 69             	add    %ah,0x69(%rsi)
+  80574a:	6c                   	insb   (%dx),%es:(%rdi)
+  80574b:	65 5f                	gs pop %rdi
+  80574d:	73 74                	jae    8057c3 <__rodata_start+0x36b>
+  80574f:	61                   	(bad)
+  805750:	74 20                	je     805772 <__rodata_start+0x31a>
+  805752:	72 65                	jb     8057b9 <__rodata_start+0x361>
+  805754:	74 75                	je     8057cb <__rodata_start+0x373>
+  805756:	72 6e                	jb     8057c6 <__rodata_start+0x36e>
+  805758:	65 64 20 73 69       	gs and %dh,%fs:0x69(%rbx)
+  80575d:	7a 65                	jp     8057c4 <__rodata_start+0x36c>
+  80575f:	20 25 6c 64 20 77    	and    %ah,0x7720646c(%rip)        # 77a0bbd1 <__bss_end+0x771c9bd1>
+  805765:	61                   	(bad)
+  805766:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805767:	74 65                	je     8057ce <__rodata_start+0x376>
+  805769:	64 20 25 7a 64 0a 00 	and    %ah,%fs:0xa647a(%rip)        # 8abbea <__bss_end+0x69bea>
+  805770:	73 65                	jae    8057d7 <__rodata_start+0x37f>
+  805772:	72 76                	jb     8057ea <__rodata_start+0x392>
+  805774:	65 5f                	gs pop %rdi
+  805776:	72 65                	jb     8057dd <__rodata_start+0x385>
+  805778:	61                   	(bad)
+  805779:	64 20 64 6f 65       	and    %ah,%fs:0x65(%rdi,%rbp,2)
+  80577e:	73 20                	jae    8057a0 <__rodata_start+0x348>
+  805780:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805781:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805782:	74 20                	je     8057a4 <__rodata_start+0x34c>
+  805784:	68 61 6e 64 6c       	push   $0x6c646e61
+  805789:	65 20 73 74          	and    %dh,%gs:0x74(%rbx)
+  80578d:	61                   	(bad)
+  80578e:	6c                   	insb   (%dx),%es:(%rdi)
+  80578f:	65 20 66 69          	and    %ah,%gs:0x69(%rsi)
+  805793:	6c                   	insb   (%dx),%es:(%rdi)
+  805794:	65 69 64 73 20 63 6f 	imul   $0x72726f63,%gs:0x20(%rbx,%rsi,2),%esp
+  80579b:	72 72 
+  80579d:	65 63 74 6c 79       	movsxd %gs:0x79(%rsp,%rbp,2),%esi
+  8057a2:	3a 20                	cmp    (%rax),%ah
+  8057a4:	25 6c 64 00 66       	and    $0x6600646c,%eax
+  8057a9:	69 6c 65 5f 72 65 61 	imul   $0x64616572,0x5f(%rbp,%riz,2),%ebp
+  8057b0:	64 
+  8057b1:	20 61 66             	and    %ah,0x66(%rcx)
+  8057b4:	74 65                	je     80581b <__rodata_start+0x3c3>
+  8057b6:	72 20                	jb     8057d8 <__rodata_start+0x380>
+  8057b8:	66 69 6c 65 5f 77 72 	imul   $0x7277,0x5f(%rbp,%riz,2),%bp
+  8057bf:	69 74 65 3a 20 25 6c 	imul   $0x646c2520,0x3a(%rbp,%riz,2),%esi
+  8057c6:	64 
+  8057c7:	00 66 69             	add    %ah,0x69(%rsi)
+  8057ca:	6c                   	insb   (%dx),%es:(%rdi)
+  8057cb:	65 5f                	gs pop %rdi
+  8057cd:	72 65                	jb     805834 <__rodata_start+0x3dc>
+  8057cf:	61                   	(bad)
+  8057d0:	64 20 61 66          	and    %ah,%fs:0x66(%rcx)
+  8057d4:	74 65                	je     80583b <__rodata_start+0x3e3>
+  8057d6:	72 20                	jb     8057f8 <__rodata_start+0x3a0>
+  8057d8:	66 69 6c 65 5f 77 72 	imul   $0x7277,0x5f(%rbp,%riz,2),%bp
+  8057df:	69 74 65 20 72 65 74 	imul   $0x75746572,0x20(%rbp,%riz,2),%esi
+  8057e6:	75 
+  8057e7:	72 6e                	jb     805857 <__rodata_start+0x3ff>
+  8057e9:	65 64 20 77 72       	gs and %dh,%fs:0x72(%rdi)
+  8057ee:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8057ef:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8057f0:	67 20 6c 65 6e       	and    %ch,0x6e(%ebp,%eiz,2)
+  8057f5:	67 74 68             	addr32 je 805860 <__rodata_start+0x408>
+  8057f8:	3a 20                	cmp    (%rax),%ah
+  8057fa:	25 6c 64 00 00       	and    $0x646c,%eax
+  8057ff:	00 66 69             	add    %ah,0x69(%rsi)
+  805802:	6c                   	insb   (%dx),%es:(%rdi)
+  805803:	65 5f                	gs pop %rdi
+  805805:	72 65                	jb     80586c <__rodata_start+0x414>
+  805807:	61                   	(bad)
+  805808:	64 20 61 66          	and    %ah,%fs:0x66(%rcx)
+  80580c:	74 65                	je     805873 <__rodata_start+0x41b>
+  80580e:	72 20                	jb     805830 <__rodata_start+0x3d8>
+  805810:	66 69 6c 65 5f 77 72 	imul   $0x7277,0x5f(%rbp,%riz,2),%bp
+  805817:	69 74 65 20 72 65 74 	imul   $0x75746572,0x20(%rbp,%riz,2),%esi
+  80581e:	75 
+  80581f:	72 6e                	jb     80588f <__rodata_start+0x437>
+  805821:	65 64 20 77 72       	gs and %dh,%fs:0x72(%rdi)
+  805826:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805827:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805828:	67 20 64 61 74       	and    %ah,0x74(%ecx,%eiz,2)
+  80582d:	61                   	(bad)
+  80582e:	00 00                	add    %al,(%rax)
+  805830:	66 69 6c 65 5f 72 65 	imul   $0x6572,0x5f(%rbp,%riz,2),%bp
+  805837:	61                   	(bad)
+  805838:	64 20 61 66          	and    %ah,%fs:0x66(%rcx)
+  80583c:	74 65                	je     8058a3 <__rodata_start+0x44b>
+  80583e:	72 20                	jb     805860 <__rodata_start+0x408>
+  805840:	66 69 6c 65 5f 77 72 	imul   $0x7277,0x5f(%rbp,%riz,2),%bp
+  805847:	69 74 65 20 69 73 20 	imul   $0x67207369,0x20(%rbp,%riz,2),%esi
+  80584e:	67 
+  80584f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805850:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805851:	64 0a 00             	or     %fs:(%rax),%al
+  805854:	00 00                	add    %al,(%rax)
+  805856:	00 00                	add    %al,(%rax)
+  805858:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805859:	70 65                	jo     8058c0 <__rodata_start+0x468>
+  80585b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80585c:	20 64 69 64          	and    %ah,0x64(%rcx,%rbp,2)
+  805860:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  805863:	74 20                	je     805885 <__rodata_start+0x42d>
+  805865:	66 69 6c 6c 20 73 74 	imul   $0x7473,0x20(%rsp,%rbp,2),%bp
+  80586c:	72 75                	jb     8058e3 <__rodata_start+0x48b>
+  80586e:	63 74 20 46          	movsxd 0x46(%rax,%riz,1),%esi
+  805872:	64 20 63 6f          	and    %ah,%fs:0x6f(%rbx)
+  805876:	72 72                	jb     8058ea <__rodata_start+0x492>
+  805878:	65 63 74 6c 79       	movsxd %gs:0x79(%rsp,%rbp,2),%esi
+  80587d:	0a 00                	or     (%rax),%al
+  80587f:	00 54 68 69          	add    %dl,0x69(%rax,%rbp,2)
+  805883:	73 20                	jae    8058a5 <__rodata_start+0x44d>
+  805885:	69 73 20 74 68 65 20 	imul   $0x20656874,0x20(%rbx),%esi
+  80588c:	4e                   	rex.WRX
+  80588d:	45 57                	rex.RB push %r15
+  80588f:	20 6d 65             	and    %ch,0x65(%rbp)
+  805892:	73 73                	jae    805907 <__rodata_start+0x4af>
+  805894:	61                   	(bad)
+  805895:	67 65 20 6f 66       	and    %ch,%gs:0x66(%edi)
+  80589a:	20 74 68 65          	and    %dh,0x65(%rax,%rbp,2)
+  80589e:	20 64 61 79          	and    %ah,0x79(%rcx,%riz,2)
+  8058a2:	21 0a                	and    %ecx,(%rdx)
+  8058a4:	0a 00                	or     (%rax),%al
+  8058a6:	3c 75                	cmp    $0x75,%al
+  8058a8:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8058a9:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8058ad:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8058ae:	3e 00 5b 25          	ds add %bl,0x25(%rbx)
+  8058b2:	30 38                	xor    %bh,(%rax)
+  8058b4:	78 5d                	js     805913 <__rodata_start+0x4bb>
+  8058b6:	20 75 73             	and    %dh,0x73(%rbp)
+  8058b9:	65 72 20             	gs jb  8058dc <__rodata_start+0x484>
+  8058bc:	70 61                	jo     80591f <__rodata_start+0x4c7>
+  8058be:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8058bf:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  8058c6:	73 20                	jae    8058e8 <__rodata_start+0x490>
+  8058c8:	61                   	(bad)
+  8058c9:	74 20                	je     8058eb <__rodata_start+0x493>
+  8058cb:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  8058d0:	3a 20                	cmp    (%rax),%ah
+  8058d2:	00 30                	add    %dh,(%rax)
+  8058d4:	31 32                	xor    %esi,(%rdx)
+  8058d6:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8058dd:	41                   	rex.B
+  8058de:	42                   	rex.X
+  8058df:	43                   	rex.XB
+  8058e0:	44                   	rex.R
+  8058e1:	45                   	rex.RB
+  8058e2:	46 00 30             	rex.RX add %r14b,(%rax)
+  8058e5:	31 32                	xor    %esi,(%rdx)
+  8058e7:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8058ee:	61                   	(bad)
+  8058ef:	62 63 64 65 66       	(bad)
+  8058f4:	00 28                	add    %ch,(%rax)
+  8058f6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8058f7:	75 6c                	jne    805965 <__rodata_start+0x50d>
+  8058f9:	6c                   	insb   (%dx),%es:(%rdi)
+  8058fa:	29 00                	sub    %eax,(%rax)
+  8058fc:	65 72 72             	gs jb  805971 <__rodata_start+0x519>
+  8058ff:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805900:	72 20                	jb     805922 <__rodata_start+0x4ca>
+  805902:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  805907:	73 70                	jae    805979 <__rodata_start+0x521>
+  805909:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  80590d:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  805914:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805915:	72 00                	jb     805917 <__rodata_start+0x4bf>
+  805917:	62 61 64 20 65       	(bad)
+  80591c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80591d:	76 69                	jbe    805988 <__rodata_start+0x530>
+  80591f:	72 6f                	jb     805990 <__rodata_start+0x538>
+  805921:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805922:	6d                   	insl   (%dx),%es:(%rdi)
+  805923:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  805925:	74 00                	je     805927 <__rodata_start+0x4cf>
+  805927:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80592e:	20 70 61             	and    %dh,0x61(%rax)
+  805931:	72 61                	jb     805994 <__rodata_start+0x53c>
+  805933:	6d                   	insl   (%dx),%es:(%rdi)
+  805934:	65 74 65             	gs je  80599c <__rodata_start+0x544>
+  805937:	72 00                	jb     805939 <__rodata_start+0x4e1>
+  805939:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80593a:	75 74                	jne    8059b0 <__rodata_start+0x558>
+  80593c:	20 6f 66             	and    %ch,0x66(%rdi)
+  80593f:	20 6d 65             	and    %ch,0x65(%rbp)
+  805942:	6d                   	insl   (%dx),%es:(%rdi)
+  805943:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805944:	72 79                	jb     8059bf <__rodata_start+0x567>
+  805946:	00 6f 75             	add    %ch,0x75(%rdi)
+  805949:	74 20                	je     80596b <__rodata_start+0x513>
+  80594b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80594c:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  805950:	76 69                	jbe    8059bb <__rodata_start+0x563>
+  805952:	72 6f                	jb     8059c3 <__rodata_start+0x56b>
+  805954:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805955:	6d                   	insl   (%dx),%es:(%rdi)
+  805956:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  805958:	74 73                	je     8059cd <__rodata_start+0x575>
+  80595a:	00 63 6f             	add    %ah,0x6f(%rbx)
+  80595d:	72 72                	jb     8059d1 <__rodata_start+0x579>
+  80595f:	75 70                	jne    8059d1 <__rodata_start+0x579>
+  805961:	74 65                	je     8059c8 <__rodata_start+0x570>
+  805963:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  805968:	75 67                	jne    8059d1 <__rodata_start+0x579>
+  80596a:	20 69 6e             	and    %ch,0x6e(%rcx)
+  80596d:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80596f:	00 73 65             	add    %dh,0x65(%rbx)
+  805972:	67 6d                	insl   (%dx),%es:(%edi)
+  805974:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  805976:	74 61                	je     8059d9 <__rodata_start+0x581>
+  805978:	74 69                	je     8059e3 <__rodata_start+0x58b>
+  80597a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80597b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80597c:	20 66 61             	and    %ah,0x61(%rsi)
+  80597f:	75 6c                	jne    8059ed <__rodata_start+0x595>
+  805981:	74 00                	je     805983 <__rodata_start+0x52b>
+  805983:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80598a:	20 45 4c             	and    %al,0x4c(%rbp)
+  80598d:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  805991:	61                   	(bad)
+  805992:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  805997:	20 73 75             	and    %dh,0x75(%rbx)
+  80599a:	63 68 20             	movsxd 0x20(%rax),%ebp
+  80599d:	73 79                	jae    805a18 <__rodata_start+0x5c0>
+  80599f:	73 74                	jae    805a15 <__rodata_start+0x5bd>
+  8059a1:	65 6d                	gs insl (%dx),%es:(%rdi)
+  8059a3:	20 63 61             	and    %ah,0x61(%rbx)
+  8059a6:	6c                   	insb   (%dx),%es:(%rdi)
+  8059a7:	6c                   	insb   (%dx),%es:(%rdi)
+  8059a8:	00 65 6e             	add    %ah,0x6e(%rbp)
+  8059ab:	74 72                	je     805a1f <__rodata_start+0x5c7>
+  8059ad:	79 20                	jns    8059cf <__rodata_start+0x577>
+  8059af:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8059b0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8059b1:	74 20                	je     8059d3 <__rodata_start+0x57b>
+  8059b3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8059b5:	75 6e                	jne    805a25 <__rodata_start+0x5cd>
+  8059b7:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  8059bb:	76 20                	jbe    8059dd <__rodata_start+0x585>
+  8059bd:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  8059c4:	72 65                	jb     805a2b <__rodata_start+0x5d3>
+  8059c6:	63 76 69             	movsxd 0x69(%rsi),%esi
+  8059c9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8059ca:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  8059ce:	65 78 70             	gs js  805a41 <__rodata_start+0x5e9>
+  8059d1:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  8059d6:	20 65 6e             	and    %ah,0x6e(%rbp)
+  8059d9:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  8059dd:	20 66 69             	and    %ah,0x69(%rsi)
+  8059e0:	6c                   	insb   (%dx),%es:(%rdi)
+  8059e1:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  8059e5:	20 66 72             	and    %ah,0x72(%rsi)
+  8059e8:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  8059ed:	61                   	(bad)
+  8059ee:	63 65 20             	movsxd 0x20(%rbp),%esp
+  8059f1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8059f2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8059f3:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  8059f7:	6b 00 74             	imul   $0x74,(%rax),%eax
+  8059fa:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8059fb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8059fc:	20 6d 61             	and    %ch,0x61(%rbp)
+  8059ff:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805a00:	79 20                	jns    805a22 <__rodata_start+0x5ca>
+  805a02:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  805a09:	72 65                	jb     805a70 <__rodata_start+0x618>
+  805a0b:	20 6f 70             	and    %ch,0x70(%rdi)
+  805a0e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  805a10:	00 66 69             	add    %ah,0x69(%rsi)
+  805a13:	6c                   	insb   (%dx),%es:(%rdi)
+  805a14:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  805a18:	20 62 6c             	and    %ah,0x6c(%rdx)
+  805a1b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805a1c:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  805a1f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805a20:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805a21:	74 20                	je     805a43 <__rodata_start+0x5eb>
+  805a23:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  805a25:	75 6e                	jne    805a95 <__rodata_start+0x63d>
+  805a27:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  805a2b:	76 61                	jbe    805a8e <__rodata_start+0x636>
+  805a2d:	6c                   	insb   (%dx),%es:(%rdi)
+  805a2e:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  805a35:	00 
+  805a36:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  805a3d:	72 65                	jb     805aa4 <__rodata_start+0x64c>
+  805a3f:	61                   	(bad)
+  805a40:	64 79 20             	fs jns 805a63 <__rodata_start+0x60b>
+  805a43:	65 78 69             	gs js  805aaf <__rodata_start+0x657>
+  805a46:	73 74                	jae    805abc <__rodata_start+0x664>
+  805a48:	73 00                	jae    805a4a <__rodata_start+0x5f2>
+  805a4a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805a4b:	70 65                	jo     805ab2 <__rodata_start+0x65a>
+  805a4d:	72 61                	jb     805ab0 <__rodata_start+0x658>
+  805a4f:	74 69                	je     805aba <__rodata_start+0x662>
+  805a51:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805a52:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805a53:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  805a56:	74 20                	je     805a78 <__rodata_start+0x620>
+  805a58:	73 75                	jae    805acf <__rodata_start+0x677>
+  805a5a:	70 70                	jo     805acc <__rodata_start+0x674>
+  805a5c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805a5d:	72 74                	jb     805ad3 <__rodata_start+0x67b>
+  805a5f:	65 64 00 74 72 79    	gs add %dh,%fs:0x79(%rdx,%rsi,2)
+  805a65:	20 61 67             	and    %ah,0x67(%rcx)
+  805a68:	61                   	(bad)
+  805a69:	69 6e 00 74 69 6d 65 	imul   $0x656d6974,0x0(%rsi),%ebp
+  805a70:	64 20 6f 75          	and    %ch,%fs:0x75(%rdi)
+  805a74:	74 00                	je     805a76 <__rodata_start+0x61e>
+  805a76:	66 69 6c 65 20 69 73 	imul   $0x7369,0x20(%rbp,%riz,2),%bp
+  805a7d:	20 69 6e             	and    %ch,0x6e(%rcx)
+  805a80:	20 75 73             	and    %dh,0x73(%rbp)
+  805a83:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  805a87:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  805a8e:	00 
+  805a8f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805a96:	00 00 00 
+  805a99:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+  805aa0:	0a 12                	or     (%rdx),%dl
+  805aa2:	80 00 00             	addb   $0x0,(%rax)
+  805aa5:	00 00                	add    %al,(%rax)
+  805aa7:	00 4b 18             	add    %cl,0x18(%rbx)
+  805aaa:	80 00 00             	addb   $0x0,(%rax)
+  805aad:	00 00                	add    %al,(%rax)
+  805aaf:	00 3b                	add    %bh,(%rbx)
+  805ab1:	18 80 00 00 00 00    	sbb    %al,0x0(%rax)
+  805ab7:	00 4b 18             	add    %cl,0x18(%rbx)
+  805aba:	80 00 00             	addb   $0x0,(%rax)
+  805abd:	00 00                	add    %al,(%rax)
+  805abf:	00 4b 18             	add    %cl,0x18(%rbx)
+  805ac2:	80 00 00             	addb   $0x0,(%rax)
+  805ac5:	00 00                	add    %al,(%rax)
+  805ac7:	00 4b 18             	add    %cl,0x18(%rbx)
+  805aca:	80 00 00             	addb   $0x0,(%rax)
+  805acd:	00 00                	add    %al,(%rax)
+  805acf:	00 4b 18             	add    %cl,0x18(%rbx)
+  805ad2:	80 00 00             	addb   $0x0,(%rax)
+  805ad5:	00 00                	add    %al,(%rax)
+  805ad7:	00 29                	add    %ch,(%rcx)
+  805ad9:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805adf:	00 4b 18             	add    %cl,0x18(%rbx)
+  805ae2:	80 00 00             	addb   $0x0,(%rax)
+  805ae5:	00 00                	add    %al,(%rax)
+  805ae7:	00 4b 18             	add    %cl,0x18(%rbx)
+  805aea:	80 00 00             	addb   $0x0,(%rax)
+  805aed:	00 00                	add    %al,(%rax)
+  805aef:	00 1d 12 80 00 00    	add    %bl,0x8012(%rip)        # 80db07 <__ctors_end+0x6a27>
+  805af5:	00 00                	add    %al,(%rax)
+  805af7:	00 97 12 80 00 00    	add    %dl,0x8012(%rdi)
+  805afd:	00 00                	add    %al,(%rax)
+  805aff:	00 4b 18             	add    %cl,0x18(%rbx)
+  805b02:	80 00 00             	addb   $0x0,(%rax)
+  805b05:	00 00                	add    %al,(%rax)
+  805b07:	00 1d 12 80 00 00    	add    %bl,0x8012(%rip)        # 80db1f <__ctors_end+0x6a3f>
+  805b0d:	00 00                	add    %al,(%rax)
+  805b0f:	00 63 12             	add    %ah,0x12(%rbx)
+  805b12:	80 00 00             	addb   $0x0,(%rax)
+  805b15:	00 00                	add    %al,(%rax)
+  805b17:	00 63 12             	add    %ah,0x12(%rbx)
+  805b1a:	80 00 00             	addb   $0x0,(%rax)
+  805b1d:	00 00                	add    %al,(%rax)
+  805b1f:	00 63 12             	add    %ah,0x12(%rbx)
+  805b22:	80 00 00             	addb   $0x0,(%rax)
+  805b25:	00 00                	add    %al,(%rax)
+  805b27:	00 63 12             	add    %ah,0x12(%rbx)
+  805b2a:	80 00 00             	addb   $0x0,(%rax)
+  805b2d:	00 00                	add    %al,(%rax)
+  805b2f:	00 63 12             	add    %ah,0x12(%rbx)
+  805b32:	80 00 00             	addb   $0x0,(%rax)
+  805b35:	00 00                	add    %al,(%rax)
+  805b37:	00 63 12             	add    %ah,0x12(%rbx)
+  805b3a:	80 00 00             	addb   $0x0,(%rax)
+  805b3d:	00 00                	add    %al,(%rax)
+  805b3f:	00 63 12             	add    %ah,0x12(%rbx)
+  805b42:	80 00 00             	addb   $0x0,(%rax)
+  805b45:	00 00                	add    %al,(%rax)
+  805b47:	00 63 12             	add    %ah,0x12(%rbx)
+  805b4a:	80 00 00             	addb   $0x0,(%rax)
+  805b4d:	00 00                	add    %al,(%rax)
+  805b4f:	00 63 12             	add    %ah,0x12(%rbx)
+  805b52:	80 00 00             	addb   $0x0,(%rax)
+  805b55:	00 00                	add    %al,(%rax)
+  805b57:	00 4b 18             	add    %cl,0x18(%rbx)
+  805b5a:	80 00 00             	addb   $0x0,(%rax)
+  805b5d:	00 00                	add    %al,(%rax)
+  805b5f:	00 4b 18             	add    %cl,0x18(%rbx)
+  805b62:	80 00 00             	addb   $0x0,(%rax)
+  805b65:	00 00                	add    %al,(%rax)
+  805b67:	00 4b 18             	add    %cl,0x18(%rbx)
+  805b6a:	80 00 00             	addb   $0x0,(%rax)
+  805b6d:	00 00                	add    %al,(%rax)
+  805b6f:	00 4b 18             	add    %cl,0x18(%rbx)
+  805b72:	80 00 00             	addb   $0x0,(%rax)
+  805b75:	00 00                	add    %al,(%rax)
+  805b77:	00 4b 18             	add    %cl,0x18(%rbx)
+  805b7a:	80 00 00             	addb   $0x0,(%rax)
+  805b7d:	00 00                	add    %al,(%rax)
+  805b7f:	00 4b 18             	add    %cl,0x18(%rbx)
+  805b82:	80 00 00             	addb   $0x0,(%rax)
+  805b85:	00 00                	add    %al,(%rax)
+  805b87:	00 4b 18             	add    %cl,0x18(%rbx)
+  805b8a:	80 00 00             	addb   $0x0,(%rax)
+  805b8d:	00 00                	add    %al,(%rax)
+  805b8f:	00 4b 18             	add    %cl,0x18(%rbx)
+  805b92:	80 00 00             	addb   $0x0,(%rax)
+  805b95:	00 00                	add    %al,(%rax)
+  805b97:	00 4b 18             	add    %cl,0x18(%rbx)
+  805b9a:	80 00 00             	addb   $0x0,(%rax)
+  805b9d:	00 00                	add    %al,(%rax)
+  805b9f:	00 4b 18             	add    %cl,0x18(%rbx)
+  805ba2:	80 00 00             	addb   $0x0,(%rax)
+  805ba5:	00 00                	add    %al,(%rax)
+  805ba7:	00 4b 18             	add    %cl,0x18(%rbx)
+  805baa:	80 00 00             	addb   $0x0,(%rax)
+  805bad:	00 00                	add    %al,(%rax)
+  805baf:	00 4b 18             	add    %cl,0x18(%rbx)
+  805bb2:	80 00 00             	addb   $0x0,(%rax)
+  805bb5:	00 00                	add    %al,(%rax)
+  805bb7:	00 4b 18             	add    %cl,0x18(%rbx)
+  805bba:	80 00 00             	addb   $0x0,(%rax)
+  805bbd:	00 00                	add    %al,(%rax)
+  805bbf:	00 4b 18             	add    %cl,0x18(%rbx)
+  805bc2:	80 00 00             	addb   $0x0,(%rax)
+  805bc5:	00 00                	add    %al,(%rax)
+  805bc7:	00 4b 18             	add    %cl,0x18(%rbx)
+  805bca:	80 00 00             	addb   $0x0,(%rax)
+  805bcd:	00 00                	add    %al,(%rax)
+  805bcf:	00 4b 18             	add    %cl,0x18(%rbx)
+  805bd2:	80 00 00             	addb   $0x0,(%rax)
+  805bd5:	00 00                	add    %al,(%rax)
+  805bd7:	00 4b 18             	add    %cl,0x18(%rbx)
+  805bda:	80 00 00             	addb   $0x0,(%rax)
+  805bdd:	00 00                	add    %al,(%rax)
+  805bdf:	00 4b 18             	add    %cl,0x18(%rbx)
+  805be2:	80 00 00             	addb   $0x0,(%rax)
+  805be5:	00 00                	add    %al,(%rax)
+  805be7:	00 4b 18             	add    %cl,0x18(%rbx)
+  805bea:	80 00 00             	addb   $0x0,(%rax)
+  805bed:	00 00                	add    %al,(%rax)
+  805bef:	00 4b 18             	add    %cl,0x18(%rbx)
+  805bf2:	80 00 00             	addb   $0x0,(%rax)
+  805bf5:	00 00                	add    %al,(%rax)
+  805bf7:	00 4b 18             	add    %cl,0x18(%rbx)
+  805bfa:	80 00 00             	addb   $0x0,(%rax)
+  805bfd:	00 00                	add    %al,(%rax)
+  805bff:	00 4b 18             	add    %cl,0x18(%rbx)
+  805c02:	80 00 00             	addb   $0x0,(%rax)
+  805c05:	00 00                	add    %al,(%rax)
+  805c07:	00 4b 18             	add    %cl,0x18(%rbx)
+  805c0a:	80 00 00             	addb   $0x0,(%rax)
+  805c0d:	00 00                	add    %al,(%rax)
+  805c0f:	00 4b 18             	add    %cl,0x18(%rbx)
+  805c12:	80 00 00             	addb   $0x0,(%rax)
+  805c15:	00 00                	add    %al,(%rax)
+  805c17:	00 4b 18             	add    %cl,0x18(%rbx)
+  805c1a:	80 00 00             	addb   $0x0,(%rax)
+  805c1d:	00 00                	add    %al,(%rax)
+  805c1f:	00 4b 18             	add    %cl,0x18(%rbx)
+  805c22:	80 00 00             	addb   $0x0,(%rax)
+  805c25:	00 00                	add    %al,(%rax)
+  805c27:	00 4b 18             	add    %cl,0x18(%rbx)
+  805c2a:	80 00 00             	addb   $0x0,(%rax)
+  805c2d:	00 00                	add    %al,(%rax)
+  805c2f:	00 4b 18             	add    %cl,0x18(%rbx)
+  805c32:	80 00 00             	addb   $0x0,(%rax)
+  805c35:	00 00                	add    %al,(%rax)
+  805c37:	00 4b 18             	add    %cl,0x18(%rbx)
+  805c3a:	80 00 00             	addb   $0x0,(%rax)
+  805c3d:	00 00                	add    %al,(%rax)
+  805c3f:	00 4b 18             	add    %cl,0x18(%rbx)
+  805c42:	80 00 00             	addb   $0x0,(%rax)
+  805c45:	00 00                	add    %al,(%rax)
+  805c47:	00 6e 17             	add    %ch,0x17(%rsi)
+  805c4a:	80 00 00             	addb   $0x0,(%rax)
+  805c4d:	00 00                	add    %al,(%rax)
+  805c4f:	00 4b 18             	add    %cl,0x18(%rbx)
+  805c52:	80 00 00             	addb   $0x0,(%rax)
+  805c55:	00 00                	add    %al,(%rax)
+  805c57:	00 4b 18             	add    %cl,0x18(%rbx)
+  805c5a:	80 00 00             	addb   $0x0,(%rax)
+  805c5d:	00 00                	add    %al,(%rax)
+  805c5f:	00 4b 18             	add    %cl,0x18(%rbx)
+  805c62:	80 00 00             	addb   $0x0,(%rax)
+  805c65:	00 00                	add    %al,(%rax)
+  805c67:	00 4b 18             	add    %cl,0x18(%rbx)
+  805c6a:	80 00 00             	addb   $0x0,(%rax)
+  805c6d:	00 00                	add    %al,(%rax)
+  805c6f:	00 4b 18             	add    %cl,0x18(%rbx)
+  805c72:	80 00 00             	addb   $0x0,(%rax)
+  805c75:	00 00                	add    %al,(%rax)
+  805c77:	00 4b 18             	add    %cl,0x18(%rbx)
+  805c7a:	80 00 00             	addb   $0x0,(%rax)
+  805c7d:	00 00                	add    %al,(%rax)
+  805c7f:	00 4b 18             	add    %cl,0x18(%rbx)
+  805c82:	80 00 00             	addb   $0x0,(%rax)
+  805c85:	00 00                	add    %al,(%rax)
+  805c87:	00 4b 18             	add    %cl,0x18(%rbx)
+  805c8a:	80 00 00             	addb   $0x0,(%rax)
+  805c8d:	00 00                	add    %al,(%rax)
+  805c8f:	00 4b 18             	add    %cl,0x18(%rbx)
+  805c92:	80 00 00             	addb   $0x0,(%rax)
+  805c95:	00 00                	add    %al,(%rax)
+  805c97:	00 4b 18             	add    %cl,0x18(%rbx)
+  805c9a:	80 00 00             	addb   $0x0,(%rax)
+  805c9d:	00 00                	add    %al,(%rax)
+  805c9f:	00 ba 12 80 00 00    	add    %bh,0x8012(%rdx)
+  805ca5:	00 00                	add    %al,(%rax)
+  805ca7:	00 89 14 80 00 00    	add    %cl,0x8014(%rcx)
+  805cad:	00 00                	add    %al,(%rax)
+  805caf:	00 4b 18             	add    %cl,0x18(%rbx)
+  805cb2:	80 00 00             	addb   $0x0,(%rax)
+  805cb5:	00 00                	add    %al,(%rax)
+  805cb7:	00 4b 18             	add    %cl,0x18(%rbx)
+  805cba:	80 00 00             	addb   $0x0,(%rax)
+  805cbd:	00 00                	add    %al,(%rax)
+  805cbf:	00 4b 18             	add    %cl,0x18(%rbx)
+  805cc2:	80 00 00             	addb   $0x0,(%rax)
+  805cc5:	00 00                	add    %al,(%rax)
+  805cc7:	00 4b 18             	add    %cl,0x18(%rbx)
+  805cca:	80 00 00             	addb   $0x0,(%rax)
+  805ccd:	00 00                	add    %al,(%rax)
+  805ccf:	00 e9                	add    %ch,%cl
+  805cd1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  805cd7:	00 4b 18             	add    %cl,0x18(%rbx)
+  805cda:	80 00 00             	addb   $0x0,(%rax)
+  805cdd:	00 00                	add    %al,(%rax)
+  805cdf:	00 4b 18             	add    %cl,0x18(%rbx)
+  805ce2:	80 00 00             	addb   $0x0,(%rax)
+  805ce5:	00 00                	add    %al,(%rax)
+  805ce7:	00 af 12 80 00 00    	add    %ch,0x8012(%rdi)
+  805ced:	00 00                	add    %al,(%rax)
+  805cef:	00 4b 18             	add    %cl,0x18(%rbx)
+  805cf2:	80 00 00             	addb   $0x0,(%rax)
+  805cf5:	00 00                	add    %al,(%rax)
+  805cf7:	00 4b 18             	add    %cl,0x18(%rbx)
+  805cfa:	80 00 00             	addb   $0x0,(%rax)
+  805cfd:	00 00                	add    %al,(%rax)
+  805cff:	00 31                	add    %dh,(%rcx)
+  805d01:	16                   	(bad)
+  805d02:	80 00 00             	addb   $0x0,(%rax)
+  805d05:	00 00                	add    %al,(%rax)
+  805d07:	00 fb                	add    %bh,%bl
+  805d09:	16                   	(bad)
+  805d0a:	80 00 00             	addb   $0x0,(%rax)
+  805d0d:	00 00                	add    %al,(%rax)
+  805d0f:	00 4b 18             	add    %cl,0x18(%rbx)
+  805d12:	80 00 00             	addb   $0x0,(%rax)
+  805d15:	00 00                	add    %al,(%rax)
+  805d17:	00 4b 18             	add    %cl,0x18(%rbx)
+  805d1a:	80 00 00             	addb   $0x0,(%rax)
+  805d1d:	00 00                	add    %al,(%rax)
+  805d1f:	00 80 13 80 00 00    	add    %al,0x8013(%rax)
+  805d25:	00 00                	add    %al,(%rax)
+  805d27:	00 4b 18             	add    %cl,0x18(%rbx)
+  805d2a:	80 00 00             	addb   $0x0,(%rax)
+  805d2d:	00 00                	add    %al,(%rax)
+  805d2f:	00 5d 15             	add    %bl,0x15(%rbp)
+  805d32:	80 00 00             	addb   $0x0,(%rax)
+  805d35:	00 00                	add    %al,(%rax)
+  805d37:	00 4b 18             	add    %cl,0x18(%rbx)
+  805d3a:	80 00 00             	addb   $0x0,(%rax)
+  805d3d:	00 00                	add    %al,(%rax)
+  805d3f:	00 4b 18             	add    %cl,0x18(%rbx)
+  805d42:	80 00 00             	addb   $0x0,(%rax)
+  805d45:	00 00                	add    %al,(%rax)
+  805d47:	00 6e 17             	add    %ch,0x17(%rsi)
+  805d4a:	80 00 00             	addb   $0x0,(%rax)
+  805d4d:	00 00                	add    %al,(%rax)
+  805d4f:	00 4b 18             	add    %cl,0x18(%rbx)
+  805d52:	80 00 00             	addb   $0x0,(%rax)
+  805d55:	00 00                	add    %al,(%rax)
+  805d57:	00 13                	add    %dl,(%rbx)
+  805d59:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+	...
+
+0000000000805d60 <error_string>:
+	...
+  805d68:	05 59 80 00 00 00 00 00 17 59 80 00 00 00 00 00     .Y.......Y......
+  805d78:	27 59 80 00 00 00 00 00 39 59 80 00 00 00 00 00     'Y......9Y......
+  805d88:	47 59 80 00 00 00 00 00 5b 59 80 00 00 00 00 00     GY......[Y......
+  805d98:	70 59 80 00 00 00 00 00 83 59 80 00 00 00 00 00     pY.......Y......
+  805da8:	95 59 80 00 00 00 00 00 a9 59 80 00 00 00 00 00     .Y.......Y......
+  805db8:	b9 59 80 00 00 00 00 00 cc 59 80 00 00 00 00 00     .Y.......Y......
+  805dc8:	e3 59 80 00 00 00 00 00 f9 59 80 00 00 00 00 00     .Y.......Y......
+  805dd8:	11 5a 80 00 00 00 00 00 29 5a 80 00 00 00 00 00     .Z......)Z......
+  805de8:	36 5a 80 00 00 00 00 00 18 5e 80 00 00 00 00 00     6Z.......^......
+  805df8:	4a 5a 80 00 00 00 00 00 62 5a 80 00 00 00 00 00     JZ......bZ......
+  805e08:	6c 5a 80 00 00 00 00 00 76 5a 80 00 00 00 00 00     lZ......vZ......
+  805e18:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  805e28:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  805e38:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  805e48:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  805e58:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 69 70 63     ib/syscall.c.ipc
+  805e68:	5f 73 65 6e 64 20 65 72 72 6f 72 3a 20 25 69 0a     _send error: %i.
+  805e78:	00 6c 69 62 2f 69 70 63 2e 63 00 0f 1f 44 00 00     .lib/ipc.c...D..
+  805e88:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  805e98:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  805ea8:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  805eb8:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  805ec8:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  805ed8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  805ee8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  805ef8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  805f08:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f18:	0f 1f 84 00 00 00 00 00                             ........
+
+0000000000805f20 <devtab>:
+  805f20:	20 70 80 00 00 00 00 00 60 70 80 00 00 00 00 00      p......`p......
+  805f30:	a0 70 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .p..............
+  805f40:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  805f50:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  805f60:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  805f70:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  805f80:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  805f90:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  805fa0:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  805fb0:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  805fc0:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  805fd0:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  805fe0:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  805ff0:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  806000:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  806010:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806020:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806030:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806040:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806050:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806060:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806070:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806080:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806090:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8060a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8060b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8060c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8060d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8060e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8060f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806100:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806110:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806120:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806130:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806140:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806150:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806160:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806170:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806180:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806190:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8061a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8061b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8061c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8061d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8061e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8061f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806200:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806210:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806220:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806230:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806240:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806250:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806260:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806270:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806280:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806290:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8062a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8062b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8062c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8062d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8062e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8062f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806300:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806310:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806320:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806330:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806340:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806350:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806360:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806370:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806380:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806390:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8063a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8063b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8063c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8063d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8063e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8063f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806400:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806410:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806420:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806430:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806440:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806450:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806460:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806470:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806480:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806490:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8064a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8064b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8064c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8064d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8064e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8064f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806500:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806510:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806520:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806530:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806540:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806550:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806560:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806570:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806580:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806590:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8065a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8065b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8065c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8065d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8065e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8065f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806600:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806610:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806620:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806630:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806640:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806650:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806660:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806670:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806680:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806690:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8066a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8066b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8066c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8066d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8066e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8066f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806700:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806710:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806720:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806730:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806740:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806750:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806760:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806770:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806780:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806790:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8067a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8067b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8067c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8067d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8067e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8067f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806800:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806810:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806820:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806830:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806840:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806850:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806860:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806870:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806880:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806890:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8068a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8068b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8068c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8068d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8068e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8068f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806900:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806910:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806920:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806930:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806940:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806950:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806960:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806970:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806980:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806990:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8069a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8069b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8069c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8069d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8069e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8069f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806a00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806a10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806a20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806a30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806a40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806a50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806a60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806a70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806a80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806a90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806aa0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806ab0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806ac0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806ad0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806ae0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806af0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806b00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806b10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806b20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806b30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806b40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806b50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806b60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806b70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806b80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806b90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806ba0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806bb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806bc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806bd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806be0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806bf0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806c00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806c10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806c20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806c30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806c40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806c50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806c60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806c70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806c80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806c90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806ca0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806cb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806cc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806cd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806ce0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806cf0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806d00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806d10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806d20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806d30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806d40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806d50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806d60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806d70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806d80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806d90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806da0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806db0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806dc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806dd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806de0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806df0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806e00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806e10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806e20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806e30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806e40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806e50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806e60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806e70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806e80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806e90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806ea0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806eb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806ec0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806ed0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806ee0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806ef0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806f00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806f10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806f20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806f30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806f40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806f50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806f60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806f70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806f80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806f90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806fa0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806fb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806fc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806fd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806fe0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806ff0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
@@ -0,0 +1,9148 @@
+
+obj/user/testfsconc:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 de 05 00 00       	call   800601 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <line_reader>:
+}
+
+/* Read the first NLINES lines one at a time. Lines are handed out in
+ * order, so the others are all taken once one past them comes back */
+static void
+line_reader(int fd) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 68          	sub    $0x68,%rsp
+  800036:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%rbp)
+    char line[LINE_SIZE + 1], want[LINE_SIZE + 1];
+    int res;
+
+    while ((res = read(fd, line, LINE_SIZE)) > 0) {
+  80003c:	49 bc 6f 1f 80 00 00 	movabs $0x801f6f,%r12
+  800043:	00 00 00 
+        if (res != LINE_SIZE) panic("short line read: %i", res);
+
+        long n = strtol(line + LINE_SIZE - 8, NULL, 10);
+  800046:	49 bf bd 14 80 00 00 	movabs $0x8014bd,%r15
+  80004d:	00 00 00 
+        snprintf(want, sizeof(want), "JOS disk benchmark data %07ld\n", n);
+  800050:	49 be 68 4f 80 00 00 	movabs $0x804f68,%r14
+  800057:	00 00 00 
+  80005a:	49 bd d1 10 80 00 00 	movabs $0x8010d1,%r13
+  800061:	00 00 00 
+    while ((res = read(fd, line, LINE_SIZE)) > 0) {
+  800064:	ba 20 00 00 00       	mov    $0x20,%edx
+  800069:	48 8d 75 af          	lea    -0x51(%rbp),%rsi
+  80006d:	8b bd 7c ff ff ff    	mov    -0x84(%rbp),%edi
+  800073:	41 ff d4             	call   *%r12
+  800076:	89 c1                	mov    %eax,%ecx
+  800078:	85 c0                	test   %eax,%eax
+  80007a:	0f 8e b9 00 00 00    	jle    800139 <line_reader+0x114>
+        if (res != LINE_SIZE) panic("short line read: %i", res);
+  800080:	83 f8 20             	cmp    $0x20,%eax
+  800083:	75 5b                	jne    8000e0 <line_reader+0xbb>
+        long n = strtol(line + LINE_SIZE - 8, NULL, 10);
+  800085:	ba 0a 00 00 00       	mov    $0xa,%edx
+  80008a:	be 00 00 00 00       	mov    $0x0,%esi
+  80008f:	48 8d 7d c7          	lea    -0x39(%rbp),%rdi
+  800093:	41 ff d7             	call   *%r15
+  800096:	48 89 c3             	mov    %rax,%rbx
+        snprintf(want, sizeof(want), "JOS disk benchmark data %07ld\n", n);
+  800099:	48 89 c1             	mov    %rax,%rcx
+  80009c:	4c 89 f2             	mov    %r14,%rdx
+  80009f:	be 21 00 00 00       	mov    $0x21,%esi
+  8000a4:	48 8d 7d 8e          	lea    -0x72(%rbp),%rdi
+  8000a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ad:	41 ff d5             	call   *%r13
+        if (memcmp(line, want, LINE_SIZE)) panic("line %ld is wrong", n);
+  8000b0:	ba 20 00 00 00       	mov    $0x20,%edx
+  8000b5:	48 8d 75 8e          	lea    -0x72(%rbp),%rsi
+  8000b9:	48 8d 7d af          	lea    -0x51(%rbp),%rdi
+  8000bd:	48 b8 65 14 80 00 00 	movabs $0x801465,%rax
+  8000c4:	00 00 00 
+  8000c7:	ff d0                	call   *%rax
+  8000c9:	85 c0                	test   %eax,%eax
+  8000cb:	75 3e                	jne    80010b <line_reader+0xe6>
+        if (n >= NLINES) return;
+  8000cd:	48 81 fb ff 1f 00 00 	cmp    $0x1fff,%rbx
+  8000d4:	7f 65                	jg     80013b <line_reader+0x116>
+        __atomic_fetch_add(&LINES_SEEN[n], 1, __ATOMIC_RELAXED);
+  8000d6:	f0 80 83 00 10 00 0a 	lock addb $0x1,0xa001000(%rbx)
+  8000dd:	01 
+  8000de:	eb 84                	jmp    800064 <line_reader+0x3f>
+        if (res != LINE_SIZE) panic("short line read: %i", res);
+  8000e0:	48 ba 80 4e 80 00 00 	movabs $0x804e80,%rdx
+  8000e7:	00 00 00 
+  8000ea:	be 36 00 00 00       	mov    $0x36,%esi
+  8000ef:	48 bf 94 4e 80 00 00 	movabs $0x804e94,%rdi
+  8000f6:	00 00 00 
+  8000f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000fe:	49 b8 d7 06 80 00 00 	movabs $0x8006d7,%r8
+  800105:	00 00 00 
+  800108:	41 ff d0             	call   *%r8
+        if (memcmp(line, want, LINE_SIZE)) panic("line %ld is wrong", n);
+  80010b:	48 89 d9             	mov    %rbx,%rcx
+  80010e:	48 ba a6 4e 80 00 00 	movabs $0x804ea6,%rdx
+  800115:	00 00 00 
+  800118:	be 3a 00 00 00       	mov    $0x3a,%esi
+  80011d:	48 bf 94 4e 80 00 00 	movabs $0x804e94,%rdi
+  800124:	00 00 00 
+  800127:	b8 00 00 00 00       	mov    $0x0,%eax
+  80012c:	49 b8 d7 06 80 00 00 	movabs $0x8006d7,%r8
+  800133:	00 00 00 
+  800136:	41 ff d0             	call   *%r8
+    }
+    if (res < 0) panic("read /bigfile: %i", res);
+  800139:	78 0f                	js     80014a <line_reader+0x125>
+}
+  80013b:	48 83 c4 68          	add    $0x68,%rsp
+  80013f:	5b                   	pop    %rbx
+  800140:	41 5c                	pop    %r12
+  800142:	41 5d                	pop    %r13
+  800144:	41 5e                	pop    %r14
+  800146:	41 5f                	pop    %r15
+  800148:	5d                   	pop    %rbp
+  800149:	c3                   	ret
+    if (res < 0) panic("read /bigfile: %i", res);
+  80014a:	48 ba b8 4e 80 00 00 	movabs $0x804eb8,%rdx
+  800151:	00 00 00 
+  800154:	be 3e 00 00 00       	mov    $0x3e,%esi
+  800159:	48 bf 94 4e 80 00 00 	movabs $0x804e94,%rdi
+  800160:	00 00 00 
+  800163:	b8 00 00 00 00       	mov    $0x0,%eax
+  800168:	49 b8 d7 06 80 00 00 	movabs $0x8006d7,%r8
+  80016f:	00 00 00 
+  800172:	41 ff d0             	call   *%r8
+
+0000000000800175 <reader>:
+reader(int fd) {
+  800175:	55                   	push   %rbp
+  800176:	48 89 e5             	mov    %rsp,%rbp
+  800179:	41 57                	push   %r15
+  80017b:	41 56                	push   %r14
+  80017d:	41 55                	push   %r13
+  80017f:	41 54                	push   %r12
+  800181:	53                   	push   %rbx
+  800182:	48 83 ec 48          	sub    $0x48,%rsp
+  800186:	89 7d 9c             	mov    %edi,-0x64(%rbp)
+    while ((res = read(fd, buf, PIECE)) > 0) {
+  800189:	49 bc 00 00 81 00 00 	movabs $0x810000,%r12
+  800190:	00 00 00 
+  800193:	e9 a5 00 00 00       	jmp    80023d <reader+0xc8>
+        if (res != PIECE) panic("short read: %i", res);
+  800198:	48 ba ca 4e 80 00 00 	movabs $0x804eca,%rdx
+  80019f:	00 00 00 
+  8001a2:	be 20 00 00 00       	mov    $0x20,%esi
+  8001a7:	48 bf 94 4e 80 00 00 	movabs $0x804e94,%rdi
+  8001ae:	00 00 00 
+  8001b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001b6:	49 b8 d7 06 80 00 00 	movabs $0x8006d7,%r8
+  8001bd:	00 00 00 
+  8001c0:	41 ff d0             	call   *%r8
+        if (first % (PIECE / LINE_SIZE)) panic("piece starts at line %ld", first);
+  8001c3:	48 89 c1             	mov    %rax,%rcx
+  8001c6:	48 ba d9 4e 80 00 00 	movabs $0x804ed9,%rdx
+  8001cd:	00 00 00 
+  8001d0:	be 23 00 00 00       	mov    $0x23,%esi
+  8001d5:	48 bf 94 4e 80 00 00 	movabs $0x804e94,%rdi
+  8001dc:	00 00 00 
+  8001df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001e4:	49 b8 d7 06 80 00 00 	movabs $0x8006d7,%r8
+  8001eb:	00 00 00 
+  8001ee:	41 ff d0             	call   *%r8
+                panic("line %ld of the piece at line %ld is wrong", (long)i, first);
+  8001f1:	4d 89 f8             	mov    %r15,%r8
+  8001f4:	48 89 d9             	mov    %rbx,%rcx
+  8001f7:	48 ba 88 4f 80 00 00 	movabs $0x804f88,%rdx
+  8001fe:	00 00 00 
+  800201:	be 27 00 00 00       	mov    $0x27,%esi
+  800206:	48 bf 94 4e 80 00 00 	movabs $0x804e94,%rdi
+  80020d:	00 00 00 
+  800210:	b8 00 00 00 00       	mov    $0x0,%eax
+  800215:	49 b9 d7 06 80 00 00 	movabs $0x8006d7,%r9
+  80021c:	00 00 00 
+  80021f:	41 ff d1             	call   *%r9
+        __atomic_fetch_add(&SEEN[first / (PIECE / LINE_SIZE)], 1, __ATOMIC_RELAXED);
+  800222:	49 8d 87 ff 07 00 00 	lea    0x7ff(%r15),%rax
+  800229:	4d 85 ff             	test   %r15,%r15
+  80022c:	49 0f 49 c7          	cmovns %r15,%rax
+  800230:	48 c1 f8 0b          	sar    $0xb,%rax
+  800234:	f0 83 04 85 00 00 00 	lock addl $0x1,0xa000000(,%rax,4)
+  80023b:	0a 01 
+    while ((res = read(fd, buf, PIECE)) > 0) {
+  80023d:	ba 00 00 01 00       	mov    $0x10000,%edx
+  800242:	4c 89 e6             	mov    %r12,%rsi
+  800245:	8b 7d 9c             	mov    -0x64(%rbp),%edi
+  800248:	48 b8 6f 1f 80 00 00 	movabs $0x801f6f,%rax
+  80024f:	00 00 00 
+  800252:	ff d0                	call   *%rax
+  800254:	89 c1                	mov    %eax,%ecx
+  800256:	85 c0                	test   %eax,%eax
+  800258:	0f 8e a1 00 00 00    	jle    8002ff <reader+0x18a>
+        if (res != PIECE) panic("short read: %i", res);
+  80025e:	3d 00 00 01 00       	cmp    $0x10000,%eax
+  800263:	0f 85 2f ff ff ff    	jne    800198 <reader+0x23>
+        long first = strtol(buf + LINE_SIZE - 8, NULL, 10);
+  800269:	ba 0a 00 00 00       	mov    $0xa,%edx
+  80026e:	be 00 00 00 00       	mov    $0x0,%esi
+  800273:	48 bf 18 00 81 00 00 	movabs $0x810018,%rdi
+  80027a:	00 00 00 
+  80027d:	48 b8 bd 14 80 00 00 	movabs $0x8014bd,%rax
+  800284:	00 00 00 
+  800287:	ff d0                	call   *%rax
+  800289:	49 89 c7             	mov    %rax,%r15
+        if (first % (PIECE / LINE_SIZE)) panic("piece starts at line %ld", first);
+  80028c:	a9 ff 07 00 00       	test   $0x7ff,%eax
+  800291:	0f 85 2c ff ff ff    	jne    8001c3 <reader+0x4e>
+        for (size_t i = 0; i < PIECE / LINE_SIZE; i++) {
+  800297:	bb 00 00 00 00       	mov    $0x0,%ebx
+            snprintf(line, sizeof(line), "JOS disk benchmark data %07ld\n", first + (long)i);
+  80029c:	49 be d1 10 80 00 00 	movabs $0x8010d1,%r14
+  8002a3:	00 00 00 
+            if (memcmp(buf + i * LINE_SIZE, line, LINE_SIZE))
+  8002a6:	49 bd 65 14 80 00 00 	movabs $0x801465,%r13
+  8002ad:	00 00 00 
+            snprintf(line, sizeof(line), "JOS disk benchmark data %07ld\n", first + (long)i);
+  8002b0:	49 8d 0c 1f          	lea    (%r15,%rbx,1),%rcx
+  8002b4:	48 ba 68 4f 80 00 00 	movabs $0x804f68,%rdx
+  8002bb:	00 00 00 
+  8002be:	be 21 00 00 00       	mov    $0x21,%esi
+  8002c3:	48 8d 7d af          	lea    -0x51(%rbp),%rdi
+  8002c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002cc:	41 ff d6             	call   *%r14
+            if (memcmp(buf + i * LINE_SIZE, line, LINE_SIZE))
+  8002cf:	48 89 df             	mov    %rbx,%rdi
+  8002d2:	48 c1 e7 05          	shl    $0x5,%rdi
+  8002d6:	4c 01 e7             	add    %r12,%rdi
+  8002d9:	ba 20 00 00 00       	mov    $0x20,%edx
+  8002de:	48 8d 75 af          	lea    -0x51(%rbp),%rsi
+  8002e2:	41 ff d5             	call   *%r13
+  8002e5:	85 c0                	test   %eax,%eax
+  8002e7:	0f 85 04 ff ff ff    	jne    8001f1 <reader+0x7c>
+        for (size_t i = 0; i < PIECE / LINE_SIZE; i++) {
+  8002ed:	48 83 c3 01          	add    $0x1,%rbx
+  8002f1:	48 81 fb 00 08 00 00 	cmp    $0x800,%rbx
+  8002f8:	75 b6                	jne    8002b0 <reader+0x13b>
+  8002fa:	e9 23 ff ff ff       	jmp    800222 <reader+0xad>
+    if (res < 0) panic("read /bigfile: %i", res);
+  8002ff:	78 0f                	js     800310 <reader+0x19b>
+}
+  800301:	48 83 c4 48          	add    $0x48,%rsp
+  800305:	5b                   	pop    %rbx
+  800306:	41 5c                	pop    %r12
+  800308:	41 5d                	pop    %r13
+  80030a:	41 5e                	pop    %r14
+  80030c:	41 5f                	pop    %r15
+  80030e:	5d                   	pop    %rbp
+  80030f:	c3                   	ret
+    if (res < 0) panic("read /bigfile: %i", res);
+  800310:	48 ba b8 4e 80 00 00 	movabs $0x804eb8,%rdx
+  800317:	00 00 00 
+  80031a:	be 2b 00 00 00       	mov    $0x2b,%esi
+  80031f:	48 bf 94 4e 80 00 00 	movabs $0x804e94,%rdi
+  800326:	00 00 00 
+  800329:	b8 00 00 00 00       	mov    $0x0,%eax
+  80032e:	49 b8 d7 06 80 00 00 	movabs $0x8006d7,%r8
+  800335:	00 00 00 
+  800338:	41 ff d0             	call   *%r8
+
+000000000080033b <run_readers>:
+
+/* Run NREADERS children of fn sharing a fresh descriptor of /bigfile */
+static void
+run_readers(void (*fn)(int)) {
+  80033b:	55                   	push   %rbp
+  80033c:	48 89 e5             	mov    %rsp,%rbp
+  80033f:	41 57                	push   %r15
+  800341:	41 56                	push   %r14
+  800343:	41 55                	push   %r13
+  800345:	41 54                	push   %r12
+  800347:	53                   	push   %rbx
+  800348:	48 83 ec 28          	sub    $0x28,%rsp
+  80034c:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+    envid_t readers[NREADERS];
+    int fd;
+
+    if ((fd = open("/bigfile", O_RDONLY)) < 0) panic("open /bigfile: %i", fd);
+  800350:	be 00 00 00 00       	mov    $0x0,%esi
+  800355:	48 bf f2 4e 80 00 00 	movabs $0x804ef2,%rdi
+  80035c:	00 00 00 
+  80035f:	48 b8 51 34 80 00 00 	movabs $0x803451,%rax
+  800366:	00 00 00 
+  800369:	ff d0                	call   *%rax
+  80036b:	41 89 c6             	mov    %eax,%r14d
+  80036e:	85 c0                	test   %eax,%eax
+  800370:	78 17                	js     800389 <run_readers+0x4e>
+  800372:	48 8d 5d c0          	lea    -0x40(%rbp),%rbx
+  800376:	4c 8d 6d d0          	lea    -0x30(%rbp),%r13
+  80037a:	49 89 dc             	mov    %rbx,%r12
+
+    for (size_t i = 0; i < NREADERS; i++) {
+        if ((readers[i] = fork()) < 0) panic("fork: %i", readers[i]);
+  80037d:	49 bf de 1a 80 00 00 	movabs $0x801ade,%r15
+  800384:	00 00 00 
+  800387:	eb 63                	jmp    8003ec <run_readers+0xb1>
+    if ((fd = open("/bigfile", O_RDONLY)) < 0) panic("open /bigfile: %i", fd);
+  800389:	89 c1                	mov    %eax,%ecx
+  80038b:	48 ba fb 4e 80 00 00 	movabs $0x804efb,%rdx
+  800392:	00 00 00 
+  800395:	be 47 00 00 00       	mov    $0x47,%esi
+  80039a:	48 bf 94 4e 80 00 00 	movabs $0x804e94,%rdi
+  8003a1:	00 00 00 
+  8003a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003a9:	49 b8 d7 06 80 00 00 	movabs $0x8006d7,%r8
+  8003b0:	00 00 00 
+  8003b3:	41 ff d0             	call   *%r8
+        if ((readers[i] = fork()) < 0) panic("fork: %i", readers[i]);
+  8003b6:	89 c1                	mov    %eax,%ecx
+  8003b8:	48 ba 0d 4f 80 00 00 	movabs $0x804f0d,%rdx
+  8003bf:	00 00 00 
+  8003c2:	be 4a 00 00 00       	mov    $0x4a,%esi
+  8003c7:	48 bf 94 4e 80 00 00 	movabs $0x804e94,%rdi
+  8003ce:	00 00 00 
+  8003d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003d6:	49 b8 d7 06 80 00 00 	movabs $0x8006d7,%r8
+  8003dd:	00 00 00 
+  8003e0:	41 ff d0             	call   *%r8
+    for (size_t i = 0; i < NREADERS; i++) {
+  8003e3:	49 83 c4 04          	add    $0x4,%r12
+  8003e7:	4d 39 ec             	cmp    %r13,%r12
+  8003ea:	74 24                	je     800410 <run_readers+0xd5>
+        if ((readers[i] = fork()) < 0) panic("fork: %i", readers[i]);
+  8003ec:	41 ff d7             	call   *%r15
+  8003ef:	41 89 04 24          	mov    %eax,(%r12)
+  8003f3:	85 c0                	test   %eax,%eax
+  8003f5:	78 bf                	js     8003b6 <run_readers+0x7b>
+        if (!readers[i]) {
+  8003f7:	75 ea                	jne    8003e3 <run_readers+0xa8>
+            fn(fd);
+  8003f9:	44 89 f7             	mov    %r14d,%edi
+  8003fc:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  800400:	ff d0                	call   *%rax
+            exit();
+  800402:	48 b8 b4 06 80 00 00 	movabs $0x8006b4,%rax
+  800409:	00 00 00 
+  80040c:	ff d0                	call   *%rax
+  80040e:	eb d3                	jmp    8003e3 <run_readers+0xa8>
+        }
+    }
+    for (size_t i = 0; i < NREADERS; i++)
+        wait(readers[i]);
+  800410:	49 bc 07 43 80 00 00 	movabs $0x804307,%r12
+  800417:	00 00 00 
+  80041a:	8b 3b                	mov    (%rbx),%edi
+  80041c:	41 ff d4             	call   *%r12
+    for (size_t i = 0; i < NREADERS; i++)
+  80041f:	48 83 c3 04          	add    $0x4,%rbx
+  800423:	4c 39 eb             	cmp    %r13,%rbx
+  800426:	75 f2                	jne    80041a <run_readers+0xdf>
+    close(fd);
+  800428:	44 89 f7             	mov    %r14d,%edi
+  80042b:	48 b8 f1 1d 80 00 00 	movabs $0x801df1,%rax
+  800432:	00 00 00 
+  800435:	ff d0                	call   *%rax
+}
+  800437:	48 83 c4 28          	add    $0x28,%rsp
+  80043b:	5b                   	pop    %rbx
+  80043c:	41 5c                	pop    %r12
+  80043e:	41 5d                	pop    %r13
+  800440:	41 5e                	pop    %r14
+  800442:	41 5f                	pop    %r15
+  800444:	5d                   	pop    %rbp
+  800445:	c3                   	ret
+
+0000000000800446 <umain>:
+
+void
+umain(int argc, char **argv) {
+  800446:	55                   	push   %rbp
+  800447:	48 89 e5             	mov    %rsp,%rbp
+    int res;
+
+    if ((res = sys_alloc_region(0, (void *)SEEN, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0)
+  80044a:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80044f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800454:	be 00 00 00 0a       	mov    $0xa000000,%esi
+  800459:	bf 00 00 00 00       	mov    $0x0,%edi
+  80045e:	48 b8 ab 16 80 00 00 	movabs $0x8016ab,%rax
+  800465:	00 00 00 
+  800468:	ff d0                	call   *%rax
+  80046a:	85 c0                	test   %eax,%eax
+  80046c:	0f 88 d0 00 00 00    	js     800542 <umain+0xfc>
+        panic("sys_alloc_region: %i", res);
+    if ((res = sys_alloc_region(0, (void *)LINES_SEEN, ROUNDUP(NLINES, PAGE_SIZE), PROT_RW | PROT_SHARE)) < 0)
+  800472:	b9 46 00 00 00       	mov    $0x46,%ecx
+  800477:	ba 00 20 00 00       	mov    $0x2000,%edx
+  80047c:	be 00 10 00 0a       	mov    $0xa001000,%esi
+  800481:	bf 00 00 00 00       	mov    $0x0,%edi
+  800486:	48 b8 ab 16 80 00 00 	movabs $0x8016ab,%rax
+  80048d:	00 00 00 
+  800490:	ff d0                	call   *%rax
+  800492:	85 c0                	test   %eax,%eax
+  800494:	0f 88 d5 00 00 00    	js     80056f <umain+0x129>
+        panic("sys_alloc_region: %i", res);
+
+    /* Not read before, so the readers wait for the disk */
+    run_readers(reader);
+  80049a:	48 bf 75 01 80 00 00 	movabs $0x800175,%rdi
+  8004a1:	00 00 00 
+  8004a4:	48 b8 3b 03 80 00 00 	movabs $0x80033b,%rax
+  8004ab:	00 00 00 
+  8004ae:	ff d0                	call   *%rax
+  8004b0:	b8 00 00 00 0a       	mov    $0xa000000,%eax
+    for (size_t i = 0; i < NPIECES; i++)
+  8004b5:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (SEEN[i] != 1) panic("piece %lu was read %u times", (unsigned long)i, SEEN[i]);
+  8004ba:	8b 10                	mov    (%rax),%edx
+  8004bc:	83 fa 01             	cmp    $0x1,%edx
+  8004bf:	0f 85 d7 00 00 00    	jne    80059c <umain+0x156>
+    for (size_t i = 0; i < NPIECES; i++)
+  8004c5:	48 83 c1 01          	add    $0x1,%rcx
+  8004c9:	48 83 c0 04          	add    $0x4,%rax
+  8004cd:	48 83 f9 20          	cmp    $0x20,%rcx
+  8004d1:	75 e7                	jne    8004ba <umain+0x74>
+    cprintf("concurrent shared fd reads are good\n");
+  8004d3:	48 bf b8 4f 80 00 00 	movabs $0x804fb8,%rdi
+  8004da:	00 00 00 
+  8004dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004e2:	48 ba 27 08 80 00 00 	movabs $0x800827,%rdx
+  8004e9:	00 00 00 
+  8004ec:	ff d2                	call   *%rdx
+
+    run_readers(line_reader);
+  8004ee:	48 bf 25 00 80 00 00 	movabs $0x800025,%rdi
+  8004f5:	00 00 00 
+  8004f8:	48 b8 3b 03 80 00 00 	movabs $0x80033b,%rax
+  8004ff:	00 00 00 
+  800502:	ff d0                	call   *%rax
+    for (size_t i = 0; i < NLINES; i++)
+  800504:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (LINES_SEEN[i] != 1) panic("line %lu was read %u times", (unsigned long)i, LINES_SEEN[i]);
+  800509:	0f b6 81 00 10 00 0a 	movzbl 0xa001000(%rcx),%eax
+  800510:	3c 01                	cmp    $0x1,%al
+  800512:	0f 85 b2 00 00 00    	jne    8005ca <umain+0x184>
+    for (size_t i = 0; i < NLINES; i++)
+  800518:	48 83 c1 01          	add    $0x1,%rcx
+  80051c:	48 81 f9 00 20 00 00 	cmp    $0x2000,%rcx
+  800523:	75 e4                	jne    800509 <umain+0xc3>
+    cprintf("concurrent small shared fd reads are good\n");
+  800525:	48 bf e0 4f 80 00 00 	movabs $0x804fe0,%rdi
+  80052c:	00 00 00 
+  80052f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800534:	48 ba 27 08 80 00 00 	movabs $0x800827,%rdx
+  80053b:	00 00 00 
+  80053e:	ff d2                	call   *%rdx
+}
+  800540:	5d                   	pop    %rbp
+  800541:	c3                   	ret
+        panic("sys_alloc_region: %i", res);
+  800542:	89 c1                	mov    %eax,%ecx
+  800544:	48 ba 16 4f 80 00 00 	movabs $0x804f16,%rdx
+  80054b:	00 00 00 
+  80054e:	be 5a 00 00 00       	mov    $0x5a,%esi
+  800553:	48 bf 94 4e 80 00 00 	movabs $0x804e94,%rdi
+  80055a:	00 00 00 
+  80055d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800562:	49 b8 d7 06 80 00 00 	movabs $0x8006d7,%r8
+  800569:	00 00 00 
+  80056c:	41 ff d0             	call   *%r8
+        panic("sys_alloc_region: %i", res);
+  80056f:	89 c1                	mov    %eax,%ecx
+  800571:	48 ba 16 4f 80 00 00 	movabs $0x804f16,%rdx
+  800578:	00 00 00 
+  80057b:	be 5c 00 00 00       	mov    $0x5c,%esi
+  800580:	48 bf 94 4e 80 00 00 	movabs $0x804e94,%rdi
+  800587:	00 00 00 
+  80058a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80058f:	49 b8 d7 06 80 00 00 	movabs $0x8006d7,%r8
+  800596:	00 00 00 
+  800599:	41 ff d0             	call   *%r8
+        if (SEEN[i] != 1) panic("piece %lu was read %u times", (unsigned long)i, SEEN[i]);
+  80059c:	44 8b 00             	mov    (%rax),%r8d
+  80059f:	48 ba 2b 4f 80 00 00 	movabs $0x804f2b,%rdx
+  8005a6:	00 00 00 
+  8005a9:	be 61 00 00 00       	mov    $0x61,%esi
+  8005ae:	48 bf 94 4e 80 00 00 	movabs $0x804e94,%rdi
+  8005b5:	00 00 00 
+  8005b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005bd:	49 b9 d7 06 80 00 00 	movabs $0x8006d7,%r9
+  8005c4:	00 00 00 
+  8005c7:	41 ff d1             	call   *%r9
+        if (LINES_SEEN[i] != 1) panic("line %lu was read %u times", (unsigned long)i, LINES_SEEN[i]);
+  8005ca:	44 0f b6 81 00 10 00 	movzbl 0xa001000(%rcx),%r8d
+  8005d1:	0a 
+  8005d2:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8005d6:	48 ba 47 4f 80 00 00 	movabs $0x804f47,%rdx
+  8005dd:	00 00 00 
+  8005e0:	be 66 00 00 00       	mov    $0x66,%esi
+  8005e5:	48 bf 94 4e 80 00 00 	movabs $0x804e94,%rdi
+  8005ec:	00 00 00 
+  8005ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005f4:	49 b9 d7 06 80 00 00 	movabs $0x8006d7,%r9
+  8005fb:	00 00 00 
+  8005fe:	41 ff d1             	call   *%r9
+
+0000000000800601 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800601:	55                   	push   %rbp
+  800602:	48 89 e5             	mov    %rsp,%rbp
+  800605:	41 56                	push   %r14
+  800607:	41 55                	push   %r13
+  800609:	41 54                	push   %r12
+  80060b:	53                   	push   %rbx
+  80060c:	41 89 fd             	mov    %edi,%r13d
+  80060f:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800612:	48 ba e0 60 80 00 00 	movabs $0x8060e0,%rdx
+  800619:	00 00 00 
+  80061c:	48 b8 e0 60 80 00 00 	movabs $0x8060e0,%rax
+  800623:	00 00 00 
+  800626:	48 39 c2             	cmp    %rax,%rdx
+  800629:	73 17                	jae    800642 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80062b:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80062e:	49 89 c4             	mov    %rax,%r12
+  800631:	48 83 c3 08          	add    $0x8,%rbx
+  800635:	b8 00 00 00 00       	mov    $0x0,%eax
+  80063a:	ff 53 f8             	call   *-0x8(%rbx)
+  80063d:	4c 39 e3             	cmp    %r12,%rbx
+  800640:	72 ef                	jb     800631 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800642:	48 b8 1e 16 80 00 00 	movabs $0x80161e,%rax
+  800649:	00 00 00 
+  80064c:	ff d0                	call   *%rax
+  80064e:	89 c2                	mov    %eax,%edx
+  800650:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  800656:	48 89 d0             	mov    %rdx,%rax
+  800659:	48 c1 e0 04          	shl    $0x4,%rax
+  80065d:	48 29 d0             	sub    %rdx,%rax
+  800660:	48 c1 e0 05          	shl    $0x5,%rax
+  800664:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80066b:	00 00 00 
+  80066e:	48 01 d0             	add    %rdx,%rax
+  800671:	48 a3 00 00 82 00 00 	movabs %rax,0x820000
+  800678:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80067b:	45 85 ed             	test   %r13d,%r13d
+  80067e:	7e 0d                	jle    80068d <libmain+0x8c>
+  800680:	49 8b 06             	mov    (%r14),%rax
+  800683:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  80068a:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80068d:	4c 89 f6             	mov    %r14,%rsi
+  800690:	44 89 ef             	mov    %r13d,%edi
+  800693:	48 b8 46 04 80 00 00 	movabs $0x800446,%rax
+  80069a:	00 00 00 
+  80069d:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80069f:	48 b8 b4 06 80 00 00 	movabs $0x8006b4,%rax
+  8006a6:	00 00 00 
+  8006a9:	ff d0                	call   *%rax
+#endif
+}
+  8006ab:	5b                   	pop    %rbx
+  8006ac:	41 5c                	pop    %r12
+  8006ae:	41 5d                	pop    %r13
+  8006b0:	41 5e                	pop    %r14
+  8006b2:	5d                   	pop    %rbp
+  8006b3:	c3                   	ret
+
+00000000008006b4 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8006b4:	55                   	push   %rbp
+  8006b5:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8006b8:	48 b8 24 1e 80 00 00 	movabs $0x801e24,%rax
+  8006bf:	00 00 00 
+  8006c2:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8006c4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8006c9:	48 b8 bb 15 80 00 00 	movabs $0x8015bb,%rax
+  8006d0:	00 00 00 
+  8006d3:	ff d0                	call   *%rax
+}
+  8006d5:	5d                   	pop    %rbp
+  8006d6:	c3                   	ret
+
+00000000008006d7 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8006d7:	55                   	push   %rbp
+  8006d8:	48 89 e5             	mov    %rsp,%rbp
+  8006db:	41 56                	push   %r14
+  8006dd:	41 55                	push   %r13
+  8006df:	41 54                	push   %r12
+  8006e1:	53                   	push   %rbx
+  8006e2:	48 83 ec 50          	sub    $0x50,%rsp
+  8006e6:	49 89 fc             	mov    %rdi,%r12
+  8006e9:	41 89 f5             	mov    %esi,%r13d
+  8006ec:	48 89 d3             	mov    %rdx,%rbx
+  8006ef:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8006f3:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8006f7:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8006fb:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800702:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800706:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80070a:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80070e:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800712:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800719:	00 00 00 
+  80071c:	4c 8b 30             	mov    (%rax),%r14
+  80071f:	48 b8 1e 16 80 00 00 	movabs $0x80161e,%rax
+  800726:	00 00 00 
+  800729:	ff d0                	call   *%rax
+  80072b:	89 c6                	mov    %eax,%esi
+  80072d:	45 89 e8             	mov    %r13d,%r8d
+  800730:	4c 89 e1             	mov    %r12,%rcx
+  800733:	4c 89 f2             	mov    %r14,%rdx
+  800736:	48 bf 18 50 80 00 00 	movabs $0x805018,%rdi
+  80073d:	00 00 00 
+  800740:	b8 00 00 00 00       	mov    $0x0,%eax
+  800745:	49 bc 27 08 80 00 00 	movabs $0x800827,%r12
+  80074c:	00 00 00 
+  80074f:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800752:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800756:	48 89 df             	mov    %rbx,%rdi
+  800759:	48 b8 c3 07 80 00 00 	movabs $0x8007c3,%rax
+  800760:	00 00 00 
+  800763:	ff d0                	call   *%rax
+    cprintf("\n");
+  800765:	48 bf 4b 56 80 00 00 	movabs $0x80564b,%rdi
+  80076c:	00 00 00 
+  80076f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800774:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800777:	cc                   	int3
+  800778:	eb fd                	jmp    800777 <_panic+0xa0>
+
+000000000080077a <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80077a:	55                   	push   %rbp
+  80077b:	48 89 e5             	mov    %rsp,%rbp
+  80077e:	53                   	push   %rbx
+  80077f:	48 83 ec 08          	sub    $0x8,%rsp
+  800783:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800786:	8b 06                	mov    (%rsi),%eax
+  800788:	8d 50 01             	lea    0x1(%rax),%edx
+  80078b:	89 16                	mov    %edx,(%rsi)
+  80078d:	48 98                	cltq
+  80078f:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800794:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80079a:	74 0a                	je     8007a6 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80079c:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8007a0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8007a4:	c9                   	leave
+  8007a5:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8007a6:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8007aa:	be ff 00 00 00       	mov    $0xff,%esi
+  8007af:	48 b8 73 15 80 00 00 	movabs $0x801573,%rax
+  8007b6:	00 00 00 
+  8007b9:	ff d0                	call   *%rax
+        state->offset = 0;
+  8007bb:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8007c1:	eb d9                	jmp    80079c <putch+0x22>
+
+00000000008007c3 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8007c3:	55                   	push   %rbp
+  8007c4:	48 89 e5             	mov    %rsp,%rbp
+  8007c7:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8007ce:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8007d1:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8007d8:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8007dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007e2:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8007e5:	48 89 f1             	mov    %rsi,%rcx
+  8007e8:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8007ef:	48 bf 7a 07 80 00 00 	movabs $0x80077a,%rdi
+  8007f6:	00 00 00 
+  8007f9:	48 b8 77 09 80 00 00 	movabs $0x800977,%rax
+  800800:	00 00 00 
+  800803:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800805:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80080c:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800813:	48 b8 73 15 80 00 00 	movabs $0x801573,%rax
+  80081a:	00 00 00 
+  80081d:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80081f:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800825:	c9                   	leave
+  800826:	c3                   	ret
+
+0000000000800827 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800827:	55                   	push   %rbp
+  800828:	48 89 e5             	mov    %rsp,%rbp
+  80082b:	48 83 ec 50          	sub    $0x50,%rsp
+  80082f:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800833:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800837:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80083b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80083f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800843:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80084a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80084e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800852:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800856:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80085a:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80085e:	48 b8 c3 07 80 00 00 	movabs $0x8007c3,%rax
+  800865:	00 00 00 
+  800868:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80086a:	c9                   	leave
+  80086b:	c3                   	ret
+
+000000000080086c <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80086c:	55                   	push   %rbp
+  80086d:	48 89 e5             	mov    %rsp,%rbp
+  800870:	41 57                	push   %r15
+  800872:	41 56                	push   %r14
+  800874:	41 55                	push   %r13
+  800876:	41 54                	push   %r12
+  800878:	53                   	push   %rbx
+  800879:	48 83 ec 18          	sub    $0x18,%rsp
+  80087d:	49 89 fc             	mov    %rdi,%r12
+  800880:	49 89 f5             	mov    %rsi,%r13
+  800883:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800887:	8b 45 10             	mov    0x10(%rbp),%eax
+  80088a:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80088d:	41 89 cf             	mov    %ecx,%r15d
+  800890:	4c 39 fa             	cmp    %r15,%rdx
+  800893:	73 5b                	jae    8008f0 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800895:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800899:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80089d:	85 db                	test   %ebx,%ebx
+  80089f:	7e 0e                	jle    8008af <print_num+0x43>
+            putch(padc, put_arg);
+  8008a1:	4c 89 ee             	mov    %r13,%rsi
+  8008a4:	44 89 f7             	mov    %r14d,%edi
+  8008a7:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8008aa:	83 eb 01             	sub    $0x1,%ebx
+  8008ad:	75 f2                	jne    8008a1 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8008af:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8008b3:	48 b9 4c 50 80 00 00 	movabs $0x80504c,%rcx
+  8008ba:	00 00 00 
+  8008bd:	48 b8 3b 50 80 00 00 	movabs $0x80503b,%rax
+  8008c4:	00 00 00 
+  8008c7:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8008cb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8008cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008d4:	49 f7 f7             	div    %r15
+  8008d7:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8008db:	4c 89 ee             	mov    %r13,%rsi
+  8008de:	41 ff d4             	call   *%r12
+}
+  8008e1:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8008e5:	5b                   	pop    %rbx
+  8008e6:	41 5c                	pop    %r12
+  8008e8:	41 5d                	pop    %r13
+  8008ea:	41 5e                	pop    %r14
+  8008ec:	41 5f                	pop    %r15
+  8008ee:	5d                   	pop    %rbp
+  8008ef:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8008f0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8008f4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008f9:	49 f7 f7             	div    %r15
+  8008fc:	48 83 ec 08          	sub    $0x8,%rsp
+  800900:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800904:	52                   	push   %rdx
+  800905:	45 0f be c9          	movsbl %r9b,%r9d
+  800909:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80090d:	48 89 c2             	mov    %rax,%rdx
+  800910:	48 b8 6c 08 80 00 00 	movabs $0x80086c,%rax
+  800917:	00 00 00 
+  80091a:	ff d0                	call   *%rax
+  80091c:	48 83 c4 10          	add    $0x10,%rsp
+  800920:	eb 8d                	jmp    8008af <print_num+0x43>
+
+0000000000800922 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800922:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800926:	48 8b 06             	mov    (%rsi),%rax
+  800929:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80092d:	73 0a                	jae    800939 <sprintputch+0x17>
+        *state->start++ = ch;
+  80092f:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800933:	48 89 16             	mov    %rdx,(%rsi)
+  800936:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800939:	c3                   	ret
+
+000000000080093a <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80093a:	55                   	push   %rbp
+  80093b:	48 89 e5             	mov    %rsp,%rbp
+  80093e:	48 83 ec 50          	sub    $0x50,%rsp
+  800942:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800946:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80094a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80094e:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800955:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800959:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80095d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800961:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800965:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800969:	48 b8 77 09 80 00 00 	movabs $0x800977,%rax
+  800970:	00 00 00 
+  800973:	ff d0                	call   *%rax
+}
+  800975:	c9                   	leave
+  800976:	c3                   	ret
+
+0000000000800977 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800977:	55                   	push   %rbp
+  800978:	48 89 e5             	mov    %rsp,%rbp
+  80097b:	41 57                	push   %r15
+  80097d:	41 56                	push   %r14
+  80097f:	41 55                	push   %r13
+  800981:	41 54                	push   %r12
+  800983:	53                   	push   %rbx
+  800984:	48 83 ec 38          	sub    $0x38,%rsp
+  800988:	49 89 fe             	mov    %rdi,%r14
+  80098b:	49 89 f5             	mov    %rsi,%r13
+  80098e:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800991:	48 8b 01             	mov    (%rcx),%rax
+  800994:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800998:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80099c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009a0:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8009a4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8009a8:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8009ac:	0f b6 3b             	movzbl (%rbx),%edi
+  8009af:	40 80 ff 25          	cmp    $0x25,%dil
+  8009b3:	74 18                	je     8009cd <vprintfmt+0x56>
+            if (!ch) return;
+  8009b5:	40 84 ff             	test   %dil,%dil
+  8009b8:	0f 84 b1 06 00 00    	je     80106f <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8009be:	40 0f b6 ff          	movzbl %dil,%edi
+  8009c2:	4c 89 ee             	mov    %r13,%rsi
+  8009c5:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8009c8:	4c 89 e3             	mov    %r12,%rbx
+  8009cb:	eb db                	jmp    8009a8 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8009cd:	be 00 00 00 00       	mov    $0x0,%esi
+  8009d2:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8009d6:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8009db:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8009e1:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8009e8:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8009ec:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8009f1:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8009f6:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8009f9:	83 e8 23             	sub    $0x23,%eax
+  8009fc:	3c 57                	cmp    $0x57,%al
+  8009fe:	0f 87 51 06 00 00    	ja     801055 <vprintfmt+0x6de>
+  800a04:	0f b6 c0             	movzbl %al,%eax
+  800a07:	48 b9 00 52 80 00 00 	movabs $0x805200,%rcx
+  800a0e:	00 00 00 
+  800a11:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800a14:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800a17:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800a1b:	eb cf                	jmp    8009ec <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800a1d:	49 89 dc             	mov    %rbx,%r12
+  800a20:	be 01 00 00 00       	mov    $0x1,%esi
+  800a25:	eb c5                	jmp    8009ec <vprintfmt+0x75>
+            padc = ch;
+  800a27:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800a2b:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800a2e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800a31:	eb b9                	jmp    8009ec <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800a33:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a36:	83 f8 2f             	cmp    $0x2f,%eax
+  800a39:	77 24                	ja     800a5f <vprintfmt+0xe8>
+  800a3b:	89 c1                	mov    %eax,%ecx
+  800a3d:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800a41:	83 c0 08             	add    $0x8,%eax
+  800a44:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a47:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800a4a:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800a4d:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800a51:	79 99                	jns    8009ec <vprintfmt+0x75>
+                width = precision;
+  800a53:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800a57:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800a5d:	eb 8d                	jmp    8009ec <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800a5f:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800a63:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800a67:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a6b:	eb da                	jmp    800a47 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800a6d:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800a72:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800a76:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800a7c:	3c 39                	cmp    $0x39,%al
+  800a7e:	77 1c                	ja     800a9c <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800a80:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800a84:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800a88:	0f b6 c0             	movzbl %al,%eax
+  800a8b:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800a90:	0f b6 03             	movzbl (%rbx),%eax
+  800a93:	3c 39                	cmp    $0x39,%al
+  800a95:	76 e9                	jbe    800a80 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800a97:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800a9a:	eb b1                	jmp    800a4d <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800a9c:	49 89 dc             	mov    %rbx,%r12
+  800a9f:	eb ac                	jmp    800a4d <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800aa1:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800aa4:	85 c9                	test   %ecx,%ecx
+  800aa6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aab:	0f 49 c1             	cmovns %ecx,%eax
+  800aae:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800ab1:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800ab4:	e9 33 ff ff ff       	jmp    8009ec <vprintfmt+0x75>
+            lflag++;
+  800ab9:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800abc:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800abf:	e9 28 ff ff ff       	jmp    8009ec <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800ac4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ac7:	83 f8 2f             	cmp    $0x2f,%eax
+  800aca:	77 19                	ja     800ae5 <vprintfmt+0x16e>
+  800acc:	89 c2                	mov    %eax,%edx
+  800ace:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ad2:	83 c0 08             	add    $0x8,%eax
+  800ad5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ad8:	8b 3a                	mov    (%rdx),%edi
+  800ada:	4c 89 ee             	mov    %r13,%rsi
+  800add:	41 ff d6             	call   *%r14
+            break;
+  800ae0:	e9 c3 fe ff ff       	jmp    8009a8 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800ae5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ae9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aed:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800af1:	eb e5                	jmp    800ad8 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800af3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800af6:	83 f8 2f             	cmp    $0x2f,%eax
+  800af9:	77 5a                	ja     800b55 <vprintfmt+0x1de>
+  800afb:	89 c2                	mov    %eax,%edx
+  800afd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b01:	83 c0 08             	add    $0x8,%eax
+  800b04:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800b07:	8b 02                	mov    (%rdx),%eax
+  800b09:	89 c1                	mov    %eax,%ecx
+  800b0b:	f7 d9                	neg    %ecx
+  800b0d:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800b10:	83 f9 16             	cmp    $0x16,%ecx
+  800b13:	7f 4e                	jg     800b63 <vprintfmt+0x1ec>
+  800b15:	48 63 c1             	movslq %ecx,%rax
+  800b18:	48 ba c0 54 80 00 00 	movabs $0x8054c0,%rdx
+  800b1f:	00 00 00 
+  800b22:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800b26:	48 85 c0             	test   %rax,%rax
+  800b29:	74 38                	je     800b63 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800b2b:	48 89 c1             	mov    %rax,%rcx
+  800b2e:	48 ba b9 56 80 00 00 	movabs $0x8056b9,%rdx
+  800b35:	00 00 00 
+  800b38:	4c 89 ee             	mov    %r13,%rsi
+  800b3b:	4c 89 f7             	mov    %r14,%rdi
+  800b3e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b43:	49 b8 3a 09 80 00 00 	movabs $0x80093a,%r8
+  800b4a:	00 00 00 
+  800b4d:	41 ff d0             	call   *%r8
+  800b50:	e9 53 fe ff ff       	jmp    8009a8 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800b55:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b59:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b5d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b61:	eb a4                	jmp    800b07 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800b63:	48 ba 64 50 80 00 00 	movabs $0x805064,%rdx
+  800b6a:	00 00 00 
+  800b6d:	4c 89 ee             	mov    %r13,%rsi
+  800b70:	4c 89 f7             	mov    %r14,%rdi
+  800b73:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b78:	49 b8 3a 09 80 00 00 	movabs $0x80093a,%r8
+  800b7f:	00 00 00 
+  800b82:	41 ff d0             	call   *%r8
+  800b85:	e9 1e fe ff ff       	jmp    8009a8 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800b8a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b8d:	83 f8 2f             	cmp    $0x2f,%eax
+  800b90:	77 6c                	ja     800bfe <vprintfmt+0x287>
+  800b92:	89 c2                	mov    %eax,%edx
+  800b94:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b98:	83 c0 08             	add    $0x8,%eax
+  800b9b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b9e:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800ba1:	48 85 d2             	test   %rdx,%rdx
+  800ba4:	48 b8 5d 50 80 00 00 	movabs $0x80505d,%rax
+  800bab:	00 00 00 
+  800bae:	48 0f 45 c2          	cmovne %rdx,%rax
+  800bb2:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800bb6:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800bba:	7e 06                	jle    800bc2 <vprintfmt+0x24b>
+  800bbc:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800bc0:	75 4a                	jne    800c0c <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800bc2:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800bc6:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800bca:	0f b6 00             	movzbl (%rax),%eax
+  800bcd:	84 c0                	test   %al,%al
+  800bcf:	0f 85 9a 00 00 00    	jne    800c6f <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800bd5:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800bd8:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800bdc:	85 c0                	test   %eax,%eax
+  800bde:	0f 8e c4 fd ff ff    	jle    8009a8 <vprintfmt+0x31>
+  800be4:	4c 89 ee             	mov    %r13,%rsi
+  800be7:	bf 20 00 00 00       	mov    $0x20,%edi
+  800bec:	41 ff d6             	call   *%r14
+  800bef:	41 83 ec 01          	sub    $0x1,%r12d
+  800bf3:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800bf7:	75 eb                	jne    800be4 <vprintfmt+0x26d>
+  800bf9:	e9 aa fd ff ff       	jmp    8009a8 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800bfe:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c02:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c06:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c0a:	eb 92                	jmp    800b9e <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800c0c:	49 63 f7             	movslq %r15d,%rsi
+  800c0f:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800c13:	48 b8 29 11 80 00 00 	movabs $0x801129,%rax
+  800c1a:	00 00 00 
+  800c1d:	ff d0                	call   *%rax
+  800c1f:	48 89 c2             	mov    %rax,%rdx
+  800c22:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800c25:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800c27:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800c2a:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800c2d:	85 c0                	test   %eax,%eax
+  800c2f:	7e 91                	jle    800bc2 <vprintfmt+0x24b>
+  800c31:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800c36:	4c 89 ee             	mov    %r13,%rsi
+  800c39:	44 89 e7             	mov    %r12d,%edi
+  800c3c:	41 ff d6             	call   *%r14
+  800c3f:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800c43:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800c46:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800c49:	75 eb                	jne    800c36 <vprintfmt+0x2bf>
+  800c4b:	e9 72 ff ff ff       	jmp    800bc2 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800c50:	0f b6 f8             	movzbl %al,%edi
+  800c53:	4c 89 ee             	mov    %r13,%rsi
+  800c56:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800c59:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800c5d:	49 83 c4 01          	add    $0x1,%r12
+  800c61:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800c67:	84 c0                	test   %al,%al
+  800c69:	0f 84 66 ff ff ff    	je     800bd5 <vprintfmt+0x25e>
+  800c6f:	45 85 ff             	test   %r15d,%r15d
+  800c72:	78 0a                	js     800c7e <vprintfmt+0x307>
+  800c74:	41 83 ef 01          	sub    $0x1,%r15d
+  800c78:	0f 88 57 ff ff ff    	js     800bd5 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800c7e:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800c82:	74 cc                	je     800c50 <vprintfmt+0x2d9>
+  800c84:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800c87:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800c8c:	80 fa 5e             	cmp    $0x5e,%dl
+  800c8f:	77 c2                	ja     800c53 <vprintfmt+0x2dc>
+  800c91:	eb bd                	jmp    800c50 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800c93:	40 84 f6             	test   %sil,%sil
+  800c96:	75 26                	jne    800cbe <vprintfmt+0x347>
+    switch (lflag) {
+  800c98:	85 d2                	test   %edx,%edx
+  800c9a:	74 59                	je     800cf5 <vprintfmt+0x37e>
+  800c9c:	83 fa 01             	cmp    $0x1,%edx
+  800c9f:	74 7b                	je     800d1c <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800ca1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ca4:	83 f8 2f             	cmp    $0x2f,%eax
+  800ca7:	0f 87 96 00 00 00    	ja     800d43 <vprintfmt+0x3cc>
+  800cad:	89 c2                	mov    %eax,%edx
+  800caf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cb3:	83 c0 08             	add    $0x8,%eax
+  800cb6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cb9:	4c 8b 22             	mov    (%rdx),%r12
+  800cbc:	eb 17                	jmp    800cd5 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800cbe:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cc1:	83 f8 2f             	cmp    $0x2f,%eax
+  800cc4:	77 21                	ja     800ce7 <vprintfmt+0x370>
+  800cc6:	89 c2                	mov    %eax,%edx
+  800cc8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ccc:	83 c0 08             	add    $0x8,%eax
+  800ccf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cd2:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800cd5:	4d 85 e4             	test   %r12,%r12
+  800cd8:	78 7a                	js     800d54 <vprintfmt+0x3dd>
+            num = i;
+  800cda:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800cdd:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800ce2:	e9 50 02 00 00       	jmp    800f37 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800ce7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ceb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cef:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cf3:	eb dd                	jmp    800cd2 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800cf5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cf8:	83 f8 2f             	cmp    $0x2f,%eax
+  800cfb:	77 11                	ja     800d0e <vprintfmt+0x397>
+  800cfd:	89 c2                	mov    %eax,%edx
+  800cff:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d03:	83 c0 08             	add    $0x8,%eax
+  800d06:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d09:	4c 63 22             	movslq (%rdx),%r12
+  800d0c:	eb c7                	jmp    800cd5 <vprintfmt+0x35e>
+  800d0e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d12:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d16:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d1a:	eb ed                	jmp    800d09 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800d1c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d1f:	83 f8 2f             	cmp    $0x2f,%eax
+  800d22:	77 11                	ja     800d35 <vprintfmt+0x3be>
+  800d24:	89 c2                	mov    %eax,%edx
+  800d26:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d2a:	83 c0 08             	add    $0x8,%eax
+  800d2d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d30:	4c 8b 22             	mov    (%rdx),%r12
+  800d33:	eb a0                	jmp    800cd5 <vprintfmt+0x35e>
+  800d35:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d39:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d3d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d41:	eb ed                	jmp    800d30 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800d43:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d47:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d4b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d4f:	e9 65 ff ff ff       	jmp    800cb9 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800d54:	4c 89 ee             	mov    %r13,%rsi
+  800d57:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800d5c:	41 ff d6             	call   *%r14
+                i = -i;
+  800d5f:	49 f7 dc             	neg    %r12
+  800d62:	e9 73 ff ff ff       	jmp    800cda <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800d67:	40 84 f6             	test   %sil,%sil
+  800d6a:	75 32                	jne    800d9e <vprintfmt+0x427>
+    switch (lflag) {
+  800d6c:	85 d2                	test   %edx,%edx
+  800d6e:	74 5d                	je     800dcd <vprintfmt+0x456>
+  800d70:	83 fa 01             	cmp    $0x1,%edx
+  800d73:	0f 84 82 00 00 00    	je     800dfb <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800d79:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d7c:	83 f8 2f             	cmp    $0x2f,%eax
+  800d7f:	0f 87 a5 00 00 00    	ja     800e2a <vprintfmt+0x4b3>
+  800d85:	89 c2                	mov    %eax,%edx
+  800d87:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d8b:	83 c0 08             	add    $0x8,%eax
+  800d8e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d91:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800d94:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800d99:	e9 99 01 00 00       	jmp    800f37 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800d9e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800da1:	83 f8 2f             	cmp    $0x2f,%eax
+  800da4:	77 19                	ja     800dbf <vprintfmt+0x448>
+  800da6:	89 c2                	mov    %eax,%edx
+  800da8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800dac:	83 c0 08             	add    $0x8,%eax
+  800daf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800db2:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800db5:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800dba:	e9 78 01 00 00       	jmp    800f37 <vprintfmt+0x5c0>
+  800dbf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800dc3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800dc7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dcb:	eb e5                	jmp    800db2 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800dcd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800dd0:	83 f8 2f             	cmp    $0x2f,%eax
+  800dd3:	77 18                	ja     800ded <vprintfmt+0x476>
+  800dd5:	89 c2                	mov    %eax,%edx
+  800dd7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ddb:	83 c0 08             	add    $0x8,%eax
+  800dde:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800de1:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800de3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800de8:	e9 4a 01 00 00       	jmp    800f37 <vprintfmt+0x5c0>
+  800ded:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800df1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800df5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800df9:	eb e6                	jmp    800de1 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800dfb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800dfe:	83 f8 2f             	cmp    $0x2f,%eax
+  800e01:	77 19                	ja     800e1c <vprintfmt+0x4a5>
+  800e03:	89 c2                	mov    %eax,%edx
+  800e05:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e09:	83 c0 08             	add    $0x8,%eax
+  800e0c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e0f:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800e12:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800e17:	e9 1b 01 00 00       	jmp    800f37 <vprintfmt+0x5c0>
+  800e1c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e20:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e24:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e28:	eb e5                	jmp    800e0f <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800e2a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e2e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e32:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e36:	e9 56 ff ff ff       	jmp    800d91 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800e3b:	40 84 f6             	test   %sil,%sil
+  800e3e:	75 2e                	jne    800e6e <vprintfmt+0x4f7>
+    switch (lflag) {
+  800e40:	85 d2                	test   %edx,%edx
+  800e42:	74 59                	je     800e9d <vprintfmt+0x526>
+  800e44:	83 fa 01             	cmp    $0x1,%edx
+  800e47:	74 7f                	je     800ec8 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800e49:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e4c:	83 f8 2f             	cmp    $0x2f,%eax
+  800e4f:	0f 87 9f 00 00 00    	ja     800ef4 <vprintfmt+0x57d>
+  800e55:	89 c2                	mov    %eax,%edx
+  800e57:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e5b:	83 c0 08             	add    $0x8,%eax
+  800e5e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e61:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800e64:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800e69:	e9 c9 00 00 00       	jmp    800f37 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800e6e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e71:	83 f8 2f             	cmp    $0x2f,%eax
+  800e74:	77 19                	ja     800e8f <vprintfmt+0x518>
+  800e76:	89 c2                	mov    %eax,%edx
+  800e78:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e7c:	83 c0 08             	add    $0x8,%eax
+  800e7f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e82:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800e85:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800e8a:	e9 a8 00 00 00       	jmp    800f37 <vprintfmt+0x5c0>
+  800e8f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e93:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e97:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e9b:	eb e5                	jmp    800e82 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800e9d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ea0:	83 f8 2f             	cmp    $0x2f,%eax
+  800ea3:	77 15                	ja     800eba <vprintfmt+0x543>
+  800ea5:	89 c2                	mov    %eax,%edx
+  800ea7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800eab:	83 c0 08             	add    $0x8,%eax
+  800eae:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800eb1:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800eb3:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800eb8:	eb 7d                	jmp    800f37 <vprintfmt+0x5c0>
+  800eba:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ebe:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ec2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ec6:	eb e9                	jmp    800eb1 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800ec8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ecb:	83 f8 2f             	cmp    $0x2f,%eax
+  800ece:	77 16                	ja     800ee6 <vprintfmt+0x56f>
+  800ed0:	89 c2                	mov    %eax,%edx
+  800ed2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ed6:	83 c0 08             	add    $0x8,%eax
+  800ed9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800edc:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800edf:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800ee4:	eb 51                	jmp    800f37 <vprintfmt+0x5c0>
+  800ee6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800eea:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800eee:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ef2:	eb e8                	jmp    800edc <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800ef4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ef8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800efc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f00:	e9 5c ff ff ff       	jmp    800e61 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800f05:	4c 89 ee             	mov    %r13,%rsi
+  800f08:	bf 30 00 00 00       	mov    $0x30,%edi
+  800f0d:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800f10:	4c 89 ee             	mov    %r13,%rsi
+  800f13:	bf 78 00 00 00       	mov    $0x78,%edi
+  800f18:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800f1b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f1e:	83 f8 2f             	cmp    $0x2f,%eax
+  800f21:	77 47                	ja     800f6a <vprintfmt+0x5f3>
+  800f23:	89 c2                	mov    %eax,%edx
+  800f25:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f29:	83 c0 08             	add    $0x8,%eax
+  800f2c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f2f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800f32:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800f37:	48 83 ec 08          	sub    $0x8,%rsp
+  800f3b:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800f3f:	0f 94 c0             	sete   %al
+  800f42:	0f b6 c0             	movzbl %al,%eax
+  800f45:	50                   	push   %rax
+  800f46:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800f4b:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800f4f:	4c 89 ee             	mov    %r13,%rsi
+  800f52:	4c 89 f7             	mov    %r14,%rdi
+  800f55:	48 b8 6c 08 80 00 00 	movabs $0x80086c,%rax
+  800f5c:	00 00 00 
+  800f5f:	ff d0                	call   *%rax
+            break;
+  800f61:	48 83 c4 10          	add    $0x10,%rsp
+  800f65:	e9 3e fa ff ff       	jmp    8009a8 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800f6a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f6e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f72:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f76:	eb b7                	jmp    800f2f <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800f78:	40 84 f6             	test   %sil,%sil
+  800f7b:	75 2b                	jne    800fa8 <vprintfmt+0x631>
+    switch (lflag) {
+  800f7d:	85 d2                	test   %edx,%edx
+  800f7f:	74 56                	je     800fd7 <vprintfmt+0x660>
+  800f81:	83 fa 01             	cmp    $0x1,%edx
+  800f84:	74 7f                	je     801005 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800f86:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f89:	83 f8 2f             	cmp    $0x2f,%eax
+  800f8c:	0f 87 a2 00 00 00    	ja     801034 <vprintfmt+0x6bd>
+  800f92:	89 c2                	mov    %eax,%edx
+  800f94:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f98:	83 c0 08             	add    $0x8,%eax
+  800f9b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f9e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800fa1:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800fa6:	eb 8f                	jmp    800f37 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800fa8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800fab:	83 f8 2f             	cmp    $0x2f,%eax
+  800fae:	77 19                	ja     800fc9 <vprintfmt+0x652>
+  800fb0:	89 c2                	mov    %eax,%edx
+  800fb2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800fb6:	83 c0 08             	add    $0x8,%eax
+  800fb9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800fbc:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800fbf:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800fc4:	e9 6e ff ff ff       	jmp    800f37 <vprintfmt+0x5c0>
+  800fc9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800fcd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800fd1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800fd5:	eb e5                	jmp    800fbc <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800fd7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800fda:	83 f8 2f             	cmp    $0x2f,%eax
+  800fdd:	77 18                	ja     800ff7 <vprintfmt+0x680>
+  800fdf:	89 c2                	mov    %eax,%edx
+  800fe1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800fe5:	83 c0 08             	add    $0x8,%eax
+  800fe8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800feb:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800fed:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800ff2:	e9 40 ff ff ff       	jmp    800f37 <vprintfmt+0x5c0>
+  800ff7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ffb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800fff:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801003:	eb e6                	jmp    800feb <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  801005:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801008:	83 f8 2f             	cmp    $0x2f,%eax
+  80100b:	77 19                	ja     801026 <vprintfmt+0x6af>
+  80100d:	89 c2                	mov    %eax,%edx
+  80100f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801013:	83 c0 08             	add    $0x8,%eax
+  801016:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801019:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80101c:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  801021:	e9 11 ff ff ff       	jmp    800f37 <vprintfmt+0x5c0>
+  801026:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80102a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80102e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801032:	eb e5                	jmp    801019 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  801034:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801038:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801040:	e9 59 ff ff ff       	jmp    800f9e <vprintfmt+0x627>
+            putch(ch, put_arg);
+  801045:	4c 89 ee             	mov    %r13,%rsi
+  801048:	bf 25 00 00 00       	mov    $0x25,%edi
+  80104d:	41 ff d6             	call   *%r14
+            break;
+  801050:	e9 53 f9 ff ff       	jmp    8009a8 <vprintfmt+0x31>
+            putch('%', put_arg);
+  801055:	4c 89 ee             	mov    %r13,%rsi
+  801058:	bf 25 00 00 00       	mov    $0x25,%edi
+  80105d:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  801060:	48 83 eb 01          	sub    $0x1,%rbx
+  801064:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  801068:	75 f6                	jne    801060 <vprintfmt+0x6e9>
+  80106a:	e9 39 f9 ff ff       	jmp    8009a8 <vprintfmt+0x31>
+}
+  80106f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801073:	5b                   	pop    %rbx
+  801074:	41 5c                	pop    %r12
+  801076:	41 5d                	pop    %r13
+  801078:	41 5e                	pop    %r14
+  80107a:	41 5f                	pop    %r15
+  80107c:	5d                   	pop    %rbp
+  80107d:	c3                   	ret
+
+000000000080107e <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  80107e:	55                   	push   %rbp
+  80107f:	48 89 e5             	mov    %rsp,%rbp
+  801082:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  801086:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80108a:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  80108f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  801093:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  80109a:	48 85 ff             	test   %rdi,%rdi
+  80109d:	74 2b                	je     8010ca <vsnprintf+0x4c>
+  80109f:	48 85 f6             	test   %rsi,%rsi
+  8010a2:	74 26                	je     8010ca <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  8010a4:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8010a8:	48 bf 22 09 80 00 00 	movabs $0x800922,%rdi
+  8010af:	00 00 00 
+  8010b2:	48 b8 77 09 80 00 00 	movabs $0x800977,%rax
+  8010b9:	00 00 00 
+  8010bc:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  8010be:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8010c2:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  8010c5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8010c8:	c9                   	leave
+  8010c9:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  8010ca:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8010cf:	eb f7                	jmp    8010c8 <vsnprintf+0x4a>
+
+00000000008010d1 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  8010d1:	55                   	push   %rbp
+  8010d2:	48 89 e5             	mov    %rsp,%rbp
+  8010d5:	48 83 ec 50          	sub    $0x50,%rsp
+  8010d9:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8010dd:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8010e1:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8010e5:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8010ec:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8010f0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8010f4:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8010f8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  8010fc:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801100:	48 b8 7e 10 80 00 00 	movabs $0x80107e,%rax
+  801107:	00 00 00 
+  80110a:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  80110c:	c9                   	leave
+  80110d:	c3                   	ret
+
+000000000080110e <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  80110e:	80 3f 00             	cmpb   $0x0,(%rdi)
+  801111:	74 10                	je     801123 <strlen+0x15>
+    size_t n = 0;
+  801113:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  801118:	48 83 c0 01          	add    $0x1,%rax
+  80111c:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  801120:	75 f6                	jne    801118 <strlen+0xa>
+  801122:	c3                   	ret
+    size_t n = 0;
+  801123:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  801128:	c3                   	ret
+
+0000000000801129 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  801129:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  80112c:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  801131:	48 85 f6             	test   %rsi,%rsi
+  801134:	74 11                	je     801147 <strnlen+0x1e>
+  801136:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  80113a:	74 0c                	je     801148 <strnlen+0x1f>
+  80113c:	48 83 c2 01          	add    $0x1,%rdx
+  801140:	48 39 d0             	cmp    %rdx,%rax
+  801143:	75 f1                	jne    801136 <strnlen+0xd>
+  801145:	eb 04                	jmp    80114b <strnlen+0x22>
+  801147:	c3                   	ret
+  801148:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  80114b:	c3                   	ret
+
+000000000080114c <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  80114c:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  80114f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801154:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  801158:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  80115b:	48 83 c2 01          	add    $0x1,%rdx
+  80115f:	84 c9                	test   %cl,%cl
+  801161:	75 f1                	jne    801154 <strcpy+0x8>
+        ;
+    return res;
+}
+  801163:	c3                   	ret
+
+0000000000801164 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  801164:	55                   	push   %rbp
+  801165:	48 89 e5             	mov    %rsp,%rbp
+  801168:	41 54                	push   %r12
+  80116a:	53                   	push   %rbx
+  80116b:	48 89 fb             	mov    %rdi,%rbx
+  80116e:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  801171:	48 b8 0e 11 80 00 00 	movabs $0x80110e,%rax
+  801178:	00 00 00 
+  80117b:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  80117d:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  801181:	4c 89 e6             	mov    %r12,%rsi
+  801184:	48 b8 4c 11 80 00 00 	movabs $0x80114c,%rax
+  80118b:	00 00 00 
+  80118e:	ff d0                	call   *%rax
+    return dst;
+}
+  801190:	48 89 d8             	mov    %rbx,%rax
+  801193:	5b                   	pop    %rbx
+  801194:	41 5c                	pop    %r12
+  801196:	5d                   	pop    %rbp
+  801197:	c3                   	ret
+
+0000000000801198 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801198:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  80119b:	48 85 d2             	test   %rdx,%rdx
+  80119e:	74 1f                	je     8011bf <strncpy+0x27>
+  8011a0:	48 01 fa             	add    %rdi,%rdx
+  8011a3:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  8011a6:	48 83 c1 01          	add    $0x1,%rcx
+  8011aa:	44 0f b6 06          	movzbl (%rsi),%r8d
+  8011ae:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  8011b2:	41 80 f8 01          	cmp    $0x1,%r8b
+  8011b6:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  8011ba:	48 39 ca             	cmp    %rcx,%rdx
+  8011bd:	75 e7                	jne    8011a6 <strncpy+0xe>
+    }
+    return ret;
+}
+  8011bf:	c3                   	ret
+
+00000000008011c0 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  8011c0:	48 89 f8             	mov    %rdi,%rax
+  8011c3:	48 85 d2             	test   %rdx,%rdx
+  8011c6:	74 24                	je     8011ec <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  8011c8:	48 83 ea 01          	sub    $0x1,%rdx
+  8011cc:	74 1b                	je     8011e9 <strlcpy+0x29>
+  8011ce:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  8011d2:	0f b6 16             	movzbl (%rsi),%edx
+  8011d5:	84 d2                	test   %dl,%dl
+  8011d7:	74 10                	je     8011e9 <strlcpy+0x29>
+            *dst++ = *src++;
+  8011d9:	48 83 c6 01          	add    $0x1,%rsi
+  8011dd:	48 83 c0 01          	add    $0x1,%rax
+  8011e1:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  8011e4:	48 39 c8             	cmp    %rcx,%rax
+  8011e7:	75 e9                	jne    8011d2 <strlcpy+0x12>
+        *dst = '\0';
+  8011e9:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  8011ec:	48 29 f8             	sub    %rdi,%rax
+}
+  8011ef:	c3                   	ret
+
+00000000008011f0 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  8011f0:	0f b6 07             	movzbl (%rdi),%eax
+  8011f3:	84 c0                	test   %al,%al
+  8011f5:	74 13                	je     80120a <strcmp+0x1a>
+  8011f7:	38 06                	cmp    %al,(%rsi)
+  8011f9:	75 0f                	jne    80120a <strcmp+0x1a>
+  8011fb:	48 83 c7 01          	add    $0x1,%rdi
+  8011ff:	48 83 c6 01          	add    $0x1,%rsi
+  801203:	0f b6 07             	movzbl (%rdi),%eax
+  801206:	84 c0                	test   %al,%al
+  801208:	75 ed                	jne    8011f7 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80120a:	0f b6 c0             	movzbl %al,%eax
+  80120d:	0f b6 16             	movzbl (%rsi),%edx
+  801210:	29 d0                	sub    %edx,%eax
+}
+  801212:	c3                   	ret
+
+0000000000801213 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  801213:	48 85 d2             	test   %rdx,%rdx
+  801216:	74 1f                	je     801237 <strncmp+0x24>
+  801218:	0f b6 07             	movzbl (%rdi),%eax
+  80121b:	84 c0                	test   %al,%al
+  80121d:	74 1e                	je     80123d <strncmp+0x2a>
+  80121f:	3a 06                	cmp    (%rsi),%al
+  801221:	75 1a                	jne    80123d <strncmp+0x2a>
+  801223:	48 83 c7 01          	add    $0x1,%rdi
+  801227:	48 83 c6 01          	add    $0x1,%rsi
+  80122b:	48 83 ea 01          	sub    $0x1,%rdx
+  80122f:	75 e7                	jne    801218 <strncmp+0x5>
+
+    if (!n) return 0;
+  801231:	b8 00 00 00 00       	mov    $0x0,%eax
+  801236:	c3                   	ret
+  801237:	b8 00 00 00 00       	mov    $0x0,%eax
+  80123c:	c3                   	ret
+  80123d:	48 85 d2             	test   %rdx,%rdx
+  801240:	74 09                	je     80124b <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801242:	0f b6 07             	movzbl (%rdi),%eax
+  801245:	0f b6 16             	movzbl (%rsi),%edx
+  801248:	29 d0                	sub    %edx,%eax
+  80124a:	c3                   	ret
+    if (!n) return 0;
+  80124b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801250:	c3                   	ret
+
+0000000000801251 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  801251:	0f b6 17             	movzbl (%rdi),%edx
+  801254:	84 d2                	test   %dl,%dl
+  801256:	74 18                	je     801270 <strchr+0x1f>
+        if (*str == c) {
+  801258:	0f be d2             	movsbl %dl,%edx
+  80125b:	39 f2                	cmp    %esi,%edx
+  80125d:	74 17                	je     801276 <strchr+0x25>
+    for (; *str; str++) {
+  80125f:	48 83 c7 01          	add    $0x1,%rdi
+  801263:	0f b6 17             	movzbl (%rdi),%edx
+  801266:	84 d2                	test   %dl,%dl
+  801268:	75 ee                	jne    801258 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  80126a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80126f:	c3                   	ret
+  801270:	b8 00 00 00 00       	mov    $0x0,%eax
+  801275:	c3                   	ret
+  801276:	48 89 f8             	mov    %rdi,%rax
+}
+  801279:	c3                   	ret
+
+000000000080127a <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  80127a:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  80127d:	0f b6 17             	movzbl (%rdi),%edx
+  801280:	84 d2                	test   %dl,%dl
+  801282:	74 13                	je     801297 <strfind+0x1d>
+  801284:	0f be d2             	movsbl %dl,%edx
+  801287:	39 f2                	cmp    %esi,%edx
+  801289:	74 0b                	je     801296 <strfind+0x1c>
+  80128b:	48 83 c0 01          	add    $0x1,%rax
+  80128f:	0f b6 10             	movzbl (%rax),%edx
+  801292:	84 d2                	test   %dl,%dl
+  801294:	75 ee                	jne    801284 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  801296:	c3                   	ret
+  801297:	c3                   	ret
+
+0000000000801298 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  801298:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  80129b:	48 89 f8             	mov    %rdi,%rax
+  80129e:	48 f7 d8             	neg    %rax
+  8012a1:	83 e0 07             	and    $0x7,%eax
+  8012a4:	49 89 d1             	mov    %rdx,%r9
+  8012a7:	49 29 c1             	sub    %rax,%r9
+  8012aa:	78 36                	js     8012e2 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8012ac:	40 0f b6 c6          	movzbl %sil,%eax
+  8012b0:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8012b7:	01 01 01 
+  8012ba:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8012be:	40 f6 c7 07          	test   $0x7,%dil
+  8012c2:	75 38                	jne    8012fc <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8012c4:	4c 89 c9             	mov    %r9,%rcx
+  8012c7:	48 c1 f9 03          	sar    $0x3,%rcx
+  8012cb:	74 0c                	je     8012d9 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8012cd:	fc                   	cld
+  8012ce:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8012d1:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8012d5:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8012d9:	4d 85 c9             	test   %r9,%r9
+  8012dc:	75 45                	jne    801323 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8012de:	4c 89 c0             	mov    %r8,%rax
+  8012e1:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8012e2:	48 85 d2             	test   %rdx,%rdx
+  8012e5:	74 f7                	je     8012de <memset+0x46>
+  8012e7:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8012ea:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8012ed:	48 83 c0 01          	add    $0x1,%rax
+  8012f1:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8012f5:	48 39 c2             	cmp    %rax,%rdx
+  8012f8:	75 f3                	jne    8012ed <memset+0x55>
+  8012fa:	eb e2                	jmp    8012de <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8012fc:	40 f6 c7 01          	test   $0x1,%dil
+  801300:	74 06                	je     801308 <memset+0x70>
+  801302:	88 07                	mov    %al,(%rdi)
+  801304:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801308:	40 f6 c7 02          	test   $0x2,%dil
+  80130c:	74 07                	je     801315 <memset+0x7d>
+  80130e:	66 89 07             	mov    %ax,(%rdi)
+  801311:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801315:	40 f6 c7 04          	test   $0x4,%dil
+  801319:	74 a9                	je     8012c4 <memset+0x2c>
+  80131b:	89 07                	mov    %eax,(%rdi)
+  80131d:	48 83 c7 04          	add    $0x4,%rdi
+  801321:	eb a1                	jmp    8012c4 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801323:	41 f6 c1 04          	test   $0x4,%r9b
+  801327:	74 06                	je     80132f <memset+0x97>
+  801329:	89 07                	mov    %eax,(%rdi)
+  80132b:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80132f:	41 f6 c1 02          	test   $0x2,%r9b
+  801333:	74 07                	je     80133c <memset+0xa4>
+  801335:	66 89 07             	mov    %ax,(%rdi)
+  801338:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  80133c:	41 f6 c1 01          	test   $0x1,%r9b
+  801340:	74 9c                	je     8012de <memset+0x46>
+  801342:	88 07                	mov    %al,(%rdi)
+  801344:	eb 98                	jmp    8012de <memset+0x46>
+
+0000000000801346 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  801346:	48 89 f8             	mov    %rdi,%rax
+  801349:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  80134c:	48 39 fe             	cmp    %rdi,%rsi
+  80134f:	73 3b                	jae    80138c <memmove+0x46>
+  801351:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  801355:	48 39 d7             	cmp    %rdx,%rdi
+  801358:	73 32                	jae    80138c <memmove+0x46>
+        s += n;
+        d += n;
+  80135a:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80135e:	48 89 d6             	mov    %rdx,%rsi
+  801361:	48 09 fe             	or     %rdi,%rsi
+  801364:	48 09 ce             	or     %rcx,%rsi
+  801367:	40 f6 c6 07          	test   $0x7,%sil
+  80136b:	75 12                	jne    80137f <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  80136d:	48 83 ef 08          	sub    $0x8,%rdi
+  801371:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  801375:	48 c1 e9 03          	shr    $0x3,%rcx
+  801379:	fd                   	std
+  80137a:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  80137d:	fc                   	cld
+  80137e:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  80137f:	48 83 ef 01          	sub    $0x1,%rdi
+  801383:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  801387:	fd                   	std
+  801388:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80138a:	eb f1                	jmp    80137d <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80138c:	48 89 f2             	mov    %rsi,%rdx
+  80138f:	48 09 c2             	or     %rax,%rdx
+  801392:	48 09 ca             	or     %rcx,%rdx
+  801395:	f6 c2 07             	test   $0x7,%dl
+  801398:	75 0c                	jne    8013a6 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  80139a:	48 c1 e9 03          	shr    $0x3,%rcx
+  80139e:	48 89 c7             	mov    %rax,%rdi
+  8013a1:	fc                   	cld
+  8013a2:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8013a5:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8013a6:	48 89 c7             	mov    %rax,%rdi
+  8013a9:	fc                   	cld
+  8013aa:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8013ac:	c3                   	ret
+
+00000000008013ad <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8013ad:	55                   	push   %rbp
+  8013ae:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8013b1:	48 b8 46 13 80 00 00 	movabs $0x801346,%rax
+  8013b8:	00 00 00 
+  8013bb:	ff d0                	call   *%rax
+}
+  8013bd:	5d                   	pop    %rbp
+  8013be:	c3                   	ret
+
+00000000008013bf <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8013bf:	55                   	push   %rbp
+  8013c0:	48 89 e5             	mov    %rsp,%rbp
+  8013c3:	41 57                	push   %r15
+  8013c5:	41 56                	push   %r14
+  8013c7:	41 55                	push   %r13
+  8013c9:	41 54                	push   %r12
+  8013cb:	53                   	push   %rbx
+  8013cc:	48 83 ec 08          	sub    $0x8,%rsp
+  8013d0:	49 89 fe             	mov    %rdi,%r14
+  8013d3:	49 89 f7             	mov    %rsi,%r15
+  8013d6:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8013d9:	48 89 f7             	mov    %rsi,%rdi
+  8013dc:	48 b8 0e 11 80 00 00 	movabs $0x80110e,%rax
+  8013e3:	00 00 00 
+  8013e6:	ff d0                	call   *%rax
+  8013e8:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8013eb:	48 89 de             	mov    %rbx,%rsi
+  8013ee:	4c 89 f7             	mov    %r14,%rdi
+  8013f1:	48 b8 29 11 80 00 00 	movabs $0x801129,%rax
+  8013f8:	00 00 00 
+  8013fb:	ff d0                	call   *%rax
+  8013fd:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801400:	48 39 c3             	cmp    %rax,%rbx
+  801403:	74 36                	je     80143b <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801405:	48 89 d8             	mov    %rbx,%rax
+  801408:	4c 29 e8             	sub    %r13,%rax
+  80140b:	49 39 c4             	cmp    %rax,%r12
+  80140e:	73 31                	jae    801441 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801410:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801415:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801419:	4c 89 fe             	mov    %r15,%rsi
+  80141c:	48 b8 ad 13 80 00 00 	movabs $0x8013ad,%rax
+  801423:	00 00 00 
+  801426:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801428:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80142c:	48 83 c4 08          	add    $0x8,%rsp
+  801430:	5b                   	pop    %rbx
+  801431:	41 5c                	pop    %r12
+  801433:	41 5d                	pop    %r13
+  801435:	41 5e                	pop    %r14
+  801437:	41 5f                	pop    %r15
+  801439:	5d                   	pop    %rbp
+  80143a:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80143b:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80143f:	eb eb                	jmp    80142c <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801441:	48 83 eb 01          	sub    $0x1,%rbx
+  801445:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801449:	48 89 da             	mov    %rbx,%rdx
+  80144c:	4c 89 fe             	mov    %r15,%rsi
+  80144f:	48 b8 ad 13 80 00 00 	movabs $0x8013ad,%rax
+  801456:	00 00 00 
+  801459:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  80145b:	49 01 de             	add    %rbx,%r14
+  80145e:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801463:	eb c3                	jmp    801428 <strlcat+0x69>
+
+0000000000801465 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801465:	48 85 d2             	test   %rdx,%rdx
+  801468:	74 2d                	je     801497 <memcmp+0x32>
+  80146a:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80146f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801473:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801478:	44 38 c1             	cmp    %r8b,%cl
+  80147b:	75 0f                	jne    80148c <memcmp+0x27>
+    while (n-- > 0) {
+  80147d:	48 83 c0 01          	add    $0x1,%rax
+  801481:	48 39 c2             	cmp    %rax,%rdx
+  801484:	75 e9                	jne    80146f <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801486:	b8 00 00 00 00       	mov    $0x0,%eax
+  80148b:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80148c:	0f b6 c1             	movzbl %cl,%eax
+  80148f:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801493:	44 29 c0             	sub    %r8d,%eax
+  801496:	c3                   	ret
+    return 0;
+  801497:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80149c:	c3                   	ret
+
+000000000080149d <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80149d:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8014a1:	48 39 c7             	cmp    %rax,%rdi
+  8014a4:	73 0f                	jae    8014b5 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8014a6:	40 38 37             	cmp    %sil,(%rdi)
+  8014a9:	74 0e                	je     8014b9 <memfind+0x1c>
+    for (; src < end; src++) {
+  8014ab:	48 83 c7 01          	add    $0x1,%rdi
+  8014af:	48 39 f8             	cmp    %rdi,%rax
+  8014b2:	75 f2                	jne    8014a6 <memfind+0x9>
+  8014b4:	c3                   	ret
+  8014b5:	48 89 f8             	mov    %rdi,%rax
+  8014b8:	c3                   	ret
+  8014b9:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8014bc:	c3                   	ret
+
+00000000008014bd <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8014bd:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8014c0:	0f b6 37             	movzbl (%rdi),%esi
+  8014c3:	40 80 fe 20          	cmp    $0x20,%sil
+  8014c7:	74 06                	je     8014cf <strtol+0x12>
+  8014c9:	40 80 fe 09          	cmp    $0x9,%sil
+  8014cd:	75 13                	jne    8014e2 <strtol+0x25>
+  8014cf:	48 83 c7 01          	add    $0x1,%rdi
+  8014d3:	0f b6 37             	movzbl (%rdi),%esi
+  8014d6:	40 80 fe 20          	cmp    $0x20,%sil
+  8014da:	74 f3                	je     8014cf <strtol+0x12>
+  8014dc:	40 80 fe 09          	cmp    $0x9,%sil
+  8014e0:	74 ed                	je     8014cf <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8014e2:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8014e5:	83 e0 fd             	and    $0xfffffffd,%eax
+  8014e8:	3c 01                	cmp    $0x1,%al
+  8014ea:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8014ee:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8014f4:	75 0f                	jne    801505 <strtol+0x48>
+  8014f6:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8014f9:	74 14                	je     80150f <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8014fb:	85 d2                	test   %edx,%edx
+  8014fd:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801502:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801505:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80150a:	4c 63 ca             	movslq %edx,%r9
+  80150d:	eb 36                	jmp    801545 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80150f:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801513:	74 0f                	je     801524 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801515:	85 d2                	test   %edx,%edx
+  801517:	75 ec                	jne    801505 <strtol+0x48>
+        s++;
+  801519:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80151d:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801522:	eb e1                	jmp    801505 <strtol+0x48>
+        s += 2;
+  801524:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801528:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80152d:	eb d6                	jmp    801505 <strtol+0x48>
+            dig -= '0';
+  80152f:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801532:	44 0f b6 c1          	movzbl %cl,%r8d
+  801536:	41 39 d0             	cmp    %edx,%r8d
+  801539:	7d 21                	jge    80155c <strtol+0x9f>
+        val = val * base + dig;
+  80153b:	49 0f af c1          	imul   %r9,%rax
+  80153f:	0f b6 c9             	movzbl %cl,%ecx
+  801542:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801545:	48 83 c7 01          	add    $0x1,%rdi
+  801549:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80154d:	80 f9 39             	cmp    $0x39,%cl
+  801550:	76 dd                	jbe    80152f <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801552:	80 f9 7b             	cmp    $0x7b,%cl
+  801555:	77 05                	ja     80155c <strtol+0x9f>
+            dig -= 'a' - 10;
+  801557:	83 e9 57             	sub    $0x57,%ecx
+  80155a:	eb d6                	jmp    801532 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  80155c:	4d 85 d2             	test   %r10,%r10
+  80155f:	74 03                	je     801564 <strtol+0xa7>
+  801561:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801564:	48 89 c2             	mov    %rax,%rdx
+  801567:	48 f7 da             	neg    %rdx
+  80156a:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80156e:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801572:	c3                   	ret
+
+0000000000801573 <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  801573:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801578:	ba 00 00 00 00       	mov    $0x0,%edx
+  80157d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801583:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801589:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  80158f:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801591:	c3                   	ret
+
+0000000000801592 <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  801592:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801597:	bf 00 00 00 00       	mov    $0x0,%edi
+  80159c:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8015a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015a6:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8015ac:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8015b2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8015b8:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8015ba:	c3                   	ret
+
+00000000008015bb <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8015bb:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8015be:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8015c3:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8015c8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015cd:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8015d3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8015d9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8015df:	0f 05                	syscall
+    if (check && ret > 0) {
+  8015e1:	48 85 c0             	test   %rax,%rax
+  8015e4:	7f 01                	jg     8015e7 <sys_env_destroy+0x2c>
+}
+  8015e6:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  8015e7:	55                   	push   %rbp
+  8015e8:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015eb:	49 89 c0             	mov    %rax,%r8
+  8015ee:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8015f3:	48 ba 98 55 80 00 00 	movabs $0x805598,%rdx
+  8015fa:	00 00 00 
+  8015fd:	be 29 00 00 00       	mov    $0x29,%esi
+  801602:	48 bf b7 55 80 00 00 	movabs $0x8055b7,%rdi
+  801609:	00 00 00 
+  80160c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801611:	49 b9 d7 06 80 00 00 	movabs $0x8006d7,%r9
+  801618:	00 00 00 
+  80161b:	41 ff d1             	call   *%r9
+
+000000000080161e <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  80161e:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801623:	bf 00 00 00 00       	mov    $0x0,%edi
+  801628:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80162d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801632:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801638:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80163e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801644:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801646:	c3                   	ret
+
+0000000000801647 <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  801647:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80164c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801651:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801656:	ba 00 00 00 00       	mov    $0x0,%edx
+  80165b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801661:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801667:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80166d:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80166f:	c3                   	ret
+
+0000000000801670 <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  801670:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801675:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  80167c:	00 00 00 
+  80167f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801685:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80168b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801691:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801693:	c3                   	ret
+
+0000000000801694 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801694:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  801697:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80169c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8016a2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8016a8:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8016aa:	c3                   	ret
+
+00000000008016ab <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8016ab:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8016ae:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8016b3:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8016b6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8016bc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8016c2:	0f 05                	syscall
+    if (check && ret > 0) {
+  8016c4:	48 85 c0             	test   %rax,%rax
+  8016c7:	7f 01                	jg     8016ca <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8016c9:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8016ca:	55                   	push   %rbp
+  8016cb:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016ce:	49 89 c0             	mov    %rax,%r8
+  8016d1:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8016d6:	48 ba 98 55 80 00 00 	movabs $0x805598,%rdx
+  8016dd:	00 00 00 
+  8016e0:	be 29 00 00 00       	mov    $0x29,%esi
+  8016e5:	48 bf b7 55 80 00 00 	movabs $0x8055b7,%rdi
+  8016ec:	00 00 00 
+  8016ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016f4:	49 b9 d7 06 80 00 00 	movabs $0x8006d7,%r9
+  8016fb:	00 00 00 
+  8016fe:	41 ff d1             	call   *%r9
+
+0000000000801701 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801701:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801704:	48 63 d2             	movslq %edx,%rdx
+  801707:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80170a:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80170f:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  801712:	0f 05                	syscall
+    if (check && ret > 0) {
+  801714:	48 85 c0             	test   %rax,%rax
+  801717:	7f 01                	jg     80171a <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801719:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80171a:	55                   	push   %rbp
+  80171b:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80171e:	49 89 c0             	mov    %rax,%r8
+  801721:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801726:	48 ba 98 55 80 00 00 	movabs $0x805598,%rdx
+  80172d:	00 00 00 
+  801730:	be 29 00 00 00       	mov    $0x29,%esi
+  801735:	48 bf b7 55 80 00 00 	movabs $0x8055b7,%rdi
+  80173c:	00 00 00 
+  80173f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801744:	49 b9 d7 06 80 00 00 	movabs $0x8006d7,%r9
+  80174b:	00 00 00 
+  80174e:	41 ff d1             	call   *%r9
+
+0000000000801751 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801751:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801754:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801759:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80175f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801765:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80176b:	0f 05                	syscall
+    if (check && ret > 0) {
+  80176d:	48 85 c0             	test   %rax,%rax
+  801770:	7f 01                	jg     801773 <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801772:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801773:	55                   	push   %rbp
+  801774:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801777:	49 89 c0             	mov    %rax,%r8
+  80177a:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80177f:	48 ba 98 55 80 00 00 	movabs $0x805598,%rdx
+  801786:	00 00 00 
+  801789:	be 29 00 00 00       	mov    $0x29,%esi
+  80178e:	48 bf b7 55 80 00 00 	movabs $0x8055b7,%rdi
+  801795:	00 00 00 
+  801798:	b8 00 00 00 00       	mov    $0x0,%eax
+  80179d:	49 b9 d7 06 80 00 00 	movabs $0x8006d7,%r9
+  8017a4:	00 00 00 
+  8017a7:	41 ff d1             	call   *%r9
+
+00000000008017aa <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8017aa:	48 63 f6             	movslq %esi,%rsi
+  8017ad:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8017b0:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8017b5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017ba:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8017c0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8017c6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8017cc:	0f 05                	syscall
+    if (check && ret > 0) {
+  8017ce:	48 85 c0             	test   %rax,%rax
+  8017d1:	7f 01                	jg     8017d4 <sys_env_set_status+0x2a>
+}
+  8017d3:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  8017d4:	55                   	push   %rbp
+  8017d5:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017d8:	49 89 c0             	mov    %rax,%r8
+  8017db:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8017e0:	48 ba 98 55 80 00 00 	movabs $0x805598,%rdx
+  8017e7:	00 00 00 
+  8017ea:	be 29 00 00 00       	mov    $0x29,%esi
+  8017ef:	48 bf b7 55 80 00 00 	movabs $0x8055b7,%rdi
+  8017f6:	00 00 00 
+  8017f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017fe:	49 b9 d7 06 80 00 00 	movabs $0x8006d7,%r9
+  801805:	00 00 00 
+  801808:	41 ff d1             	call   *%r9
+
+000000000080180b <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80180b:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80180e:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801813:	ba 00 00 00 00       	mov    $0x0,%edx
+  801818:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80181e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801824:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80182a:	0f 05                	syscall
+    if (check && ret > 0) {
+  80182c:	48 85 c0             	test   %rax,%rax
+  80182f:	7f 01                	jg     801832 <sys_env_set_trapframe+0x27>
+}
+  801831:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801832:	55                   	push   %rbp
+  801833:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801836:	49 89 c0             	mov    %rax,%r8
+  801839:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80183e:	48 ba 98 55 80 00 00 	movabs $0x805598,%rdx
+  801845:	00 00 00 
+  801848:	be 29 00 00 00       	mov    $0x29,%esi
+  80184d:	48 bf b7 55 80 00 00 	movabs $0x8055b7,%rdi
+  801854:	00 00 00 
+  801857:	b8 00 00 00 00       	mov    $0x0,%eax
+  80185c:	49 b9 d7 06 80 00 00 	movabs $0x8006d7,%r9
+  801863:	00 00 00 
+  801866:	41 ff d1             	call   *%r9
+
+0000000000801869 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801869:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80186c:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801871:	ba 00 00 00 00       	mov    $0x0,%edx
+  801876:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80187c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801882:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801888:	0f 05                	syscall
+    if (check && ret > 0) {
+  80188a:	48 85 c0             	test   %rax,%rax
+  80188d:	7f 01                	jg     801890 <sys_env_set_pgfault_upcall+0x27>
+}
+  80188f:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801890:	55                   	push   %rbp
+  801891:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801894:	49 89 c0             	mov    %rax,%r8
+  801897:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80189c:	48 ba 98 55 80 00 00 	movabs $0x805598,%rdx
+  8018a3:	00 00 00 
+  8018a6:	be 29 00 00 00       	mov    $0x29,%esi
+  8018ab:	48 bf b7 55 80 00 00 	movabs $0x8055b7,%rdi
+  8018b2:	00 00 00 
+  8018b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018ba:	49 b9 d7 06 80 00 00 	movabs $0x8006d7,%r9
+  8018c1:	00 00 00 
+  8018c4:	41 ff d1             	call   *%r9
+
+00000000008018c7 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8018c7:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8018ca:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8018cd:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8018d2:	4d 63 c0             	movslq %r8d,%r8
+  8018d5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8018db:	0f 05                	syscall
+}
+  8018dd:	c3                   	ret
+
+00000000008018de <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8018de:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8018e1:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8018e4:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8018e9:	4d 63 c0             	movslq %r8d,%r8
+  8018ec:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8018f2:	0f 05                	syscall
+}
+  8018f4:	c3                   	ret
+
+00000000008018f5 <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  8018f5:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8018fa:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8018fd:	45 89 c0             	mov    %r8d,%r8d
+  801900:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801906:	0f 05                	syscall
+    if (check && ret > 0) {
+  801908:	48 85 c0             	test   %rax,%rax
+  80190b:	7f 01                	jg     80190e <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80190d:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  80190e:	55                   	push   %rbp
+  80190f:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801912:	49 89 c0             	mov    %rax,%r8
+  801915:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  80191a:	48 ba 98 55 80 00 00 	movabs $0x805598,%rdx
+  801921:	00 00 00 
+  801924:	be 29 00 00 00       	mov    $0x29,%esi
+  801929:	48 bf b7 55 80 00 00 	movabs $0x8055b7,%rdi
+  801930:	00 00 00 
+  801933:	b8 00 00 00 00       	mov    $0x0,%eax
+  801938:	49 b9 d7 06 80 00 00 	movabs $0x8006d7,%r9
+  80193f:	00 00 00 
+  801942:	41 ff d1             	call   *%r9
+
+0000000000801945 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  801945:	55                   	push   %rbp
+  801946:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  801949:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80194f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801954:	ba 00 00 00 00       	mov    $0x0,%edx
+  801959:	48 b8 f5 18 80 00 00 	movabs $0x8018f5,%rax
+  801960:	00 00 00 
+  801963:	ff d0                	call   *%rax
+}
+  801965:	5d                   	pop    %rbp
+  801966:	c3                   	ret
+
+0000000000801967 <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  801967:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80196c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801971:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801976:	ba 00 00 00 00       	mov    $0x0,%edx
+  80197b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801981:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801987:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80198d:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80198f:	c3                   	ret
+
+0000000000801990 <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  801990:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801995:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80199a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80199f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8019a5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8019ab:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8019b1:	0f 05                	syscall
+    if (check && ret > 0) {
+  8019b3:	48 85 c0             	test   %rax,%rax
+  8019b6:	7f 01                	jg     8019b9 <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  8019b8:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  8019b9:	55                   	push   %rbp
+  8019ba:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8019bd:	49 89 c0             	mov    %rax,%r8
+  8019c0:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8019c5:	48 ba 98 55 80 00 00 	movabs $0x805598,%rdx
+  8019cc:	00 00 00 
+  8019cf:	be 29 00 00 00       	mov    $0x29,%esi
+  8019d4:	48 bf b7 55 80 00 00 	movabs $0x8055b7,%rdi
+  8019db:	00 00 00 
+  8019de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019e3:	49 b9 d7 06 80 00 00 	movabs $0x8006d7,%r9
+  8019ea:	00 00 00 
+  8019ed:	41 ff d1             	call   *%r9
+
+00000000008019f0 <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  8019f0:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8019f5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019fa:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8019ff:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a04:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801a0a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801a10:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801a16:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  801a18:	c3                   	ret
+
+0000000000801a19 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  801a19:	89 d2                	mov    %edx,%edx
+  801a1b:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  801a1d:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801a22:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801a28:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801a2e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801a34:	0f 05                	syscall
+}
+  801a36:	c3                   	ret
+
+0000000000801a37 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  801a37:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  801a3a:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801a3f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a44:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801a4a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801a50:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801a56:	0f 05                	syscall
+}
+  801a58:	c3                   	ret
+
+0000000000801a59 <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  801a59:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  801a5c:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801a61:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a66:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801a6c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801a72:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801a78:	0f 05                	syscall
+}
+  801a7a:	c3                   	ret
+
+0000000000801a7b <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  801a7b:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801a7e:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801a83:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801a88:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a8d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801a93:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801a99:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801a9f:	0f 05                	syscall
+    if (check && ret > 0) {
+  801aa1:	48 85 c0             	test   %rax,%rax
+  801aa4:	7f 01                	jg     801aa7 <sys_irq_ack+0x2c>
+}
+  801aa6:	c3                   	ret
+sys_irq_ack(int irq) {
+  801aa7:	55                   	push   %rbp
+  801aa8:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801aab:	49 89 c0             	mov    %rax,%r8
+  801aae:	b9 16 00 00 00       	mov    $0x16,%ecx
+  801ab3:	48 ba 98 55 80 00 00 	movabs $0x805598,%rdx
+  801aba:	00 00 00 
+  801abd:	be 29 00 00 00       	mov    $0x29,%esi
+  801ac2:	48 bf b7 55 80 00 00 	movabs $0x8055b7,%rdi
+  801ac9:	00 00 00 
+  801acc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ad1:	49 b9 d7 06 80 00 00 	movabs $0x8006d7,%r9
+  801ad8:	00 00 00 
+  801adb:	41 ff d1             	call   *%r9
+
+0000000000801ade <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  801ade:	55                   	push   %rbp
+  801adf:	48 89 e5             	mov    %rsp,%rbp
+  801ae2:	41 54                	push   %r12
+  801ae4:	53                   	push   %rbx
+    // LAB 9: Your code here
+    /* The child would write them out once more */
+    file_flush_buffers();
+  801ae5:	48 b8 12 35 80 00 00 	movabs $0x803512,%rax
+  801aec:	00 00 00 
+  801aef:	ff d0                	call   *%rax
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("syscall"
+  801af1:	b8 08 00 00 00       	mov    $0x8,%eax
+  801af6:	0f 05                	syscall
+  801af8:	41 89 c4             	mov    %eax,%r12d
+
+	envid_t envid = sys_exofork();
+    if (envid < 0)
+  801afb:	85 c0                	test   %eax,%eax
+  801afd:	78 7e                	js     801b7d <fork+0x9f>
+        return envid;
+    if (envid == 0) {
+  801aff:	0f 84 80 00 00 00    	je     801b85 <fork+0xa7>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE) < 0) {
+  801b05:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801b0b:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801b12:	00 00 00 
+  801b15:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b1a:	89 c2                	mov    %eax,%edx
+  801b1c:	be 00 00 00 00       	mov    $0x0,%esi
+  801b21:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b26:	48 b8 01 17 80 00 00 	movabs $0x801701,%rax
+  801b2d:	00 00 00 
+  801b30:	ff d0                	call   *%rax
+  801b32:	85 c0                	test   %eax,%eax
+  801b34:	0f 88 86 00 00 00    	js     801bc0 <fork+0xe2>
+		return -1;
+	}
+    if (sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall) < 0) {
+  801b3a:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  801b41:	00 00 00 
+  801b44:	48 8b b0 28 01 00 00 	mov    0x128(%rax),%rsi
+  801b4b:	44 89 e7             	mov    %r12d,%edi
+  801b4e:	48 b8 69 18 80 00 00 	movabs $0x801869,%rax
+  801b55:	00 00 00 
+  801b58:	ff d0                	call   *%rax
+  801b5a:	85 c0                	test   %eax,%eax
+  801b5c:	78 6a                	js     801bc8 <fork+0xea>
+		return -1;
+	}
+    if (sys_env_set_status(envid, ENV_RUNNABLE) < 0) {
+  801b5e:	be 02 00 00 00       	mov    $0x2,%esi
+  801b63:	44 89 e7             	mov    %r12d,%edi
+  801b66:	48 b8 aa 17 80 00 00 	movabs $0x8017aa,%rax
+  801b6d:	00 00 00 
+  801b70:	ff d0                	call   *%rax
+		return -1;
+  801b72:	85 c0                	test   %eax,%eax
+  801b74:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801b79:	44 0f 48 e0          	cmovs  %eax,%r12d
+	}
+    return envid;
+}
+  801b7d:	44 89 e0             	mov    %r12d,%eax
+  801b80:	5b                   	pop    %rbx
+  801b81:	41 5c                	pop    %r12
+  801b83:	5d                   	pop    %rbp
+  801b84:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801b85:	48 b8 1e 16 80 00 00 	movabs $0x80161e,%rax
+  801b8c:	00 00 00 
+  801b8f:	ff d0                	call   *%rax
+  801b91:	89 c2                	mov    %eax,%edx
+  801b93:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  801b99:	48 89 d0             	mov    %rdx,%rax
+  801b9c:	48 c1 e0 04          	shl    $0x4,%rax
+  801ba0:	48 29 d0             	sub    %rdx,%rax
+  801ba3:	48 c1 e0 05          	shl    $0x5,%rax
+  801ba7:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801bae:	00 00 00 
+  801bb1:	48 01 d0             	add    %rdx,%rax
+  801bb4:	48 a3 00 00 82 00 00 	movabs %rax,0x820000
+  801bbb:	00 00 00 
+        return 0;
+  801bbe:	eb bd                	jmp    801b7d <fork+0x9f>
+		return -1;
+  801bc0:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801bc6:	eb b5                	jmp    801b7d <fork+0x9f>
+		return -1;
+  801bc8:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801bce:	eb ad                	jmp    801b7d <fork+0x9f>
+
+0000000000801bd0 <sfork>:
+
+envid_t
+sfork() {
+  801bd0:	55                   	push   %rbp
+  801bd1:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  801bd4:	48 ba c5 55 80 00 00 	movabs $0x8055c5,%rdx
+  801bdb:	00 00 00 
+  801bde:	be 2d 00 00 00       	mov    $0x2d,%esi
+  801be3:	48 bf e0 55 80 00 00 	movabs $0x8055e0,%rdi
+  801bea:	00 00 00 
+  801bed:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bf2:	48 b9 d7 06 80 00 00 	movabs $0x8006d7,%rcx
+  801bf9:	00 00 00 
+  801bfc:	ff d1                	call   *%rcx
+
+0000000000801bfe <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801bfe:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801c05:	ff ff ff 
+  801c08:	48 01 f8             	add    %rdi,%rax
+  801c0b:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801c0f:	c3                   	ret
+
+0000000000801c10 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801c10:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801c17:	ff ff ff 
+  801c1a:	48 01 f8             	add    %rdi,%rax
+  801c1d:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801c21:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801c27:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801c2b:	c3                   	ret
+
+0000000000801c2c <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801c2c:	55                   	push   %rbp
+  801c2d:	48 89 e5             	mov    %rsp,%rbp
+  801c30:	41 57                	push   %r15
+  801c32:	41 56                	push   %r14
+  801c34:	41 55                	push   %r13
+  801c36:	41 54                	push   %r12
+  801c38:	53                   	push   %rbx
+  801c39:	48 83 ec 08          	sub    $0x8,%rsp
+  801c3d:	49 89 ff             	mov    %rdi,%r15
+  801c40:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801c45:	49 bd ba 44 80 00 00 	movabs $0x8044ba,%r13
+  801c4c:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801c4f:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801c55:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801c58:	48 89 df             	mov    %rbx,%rdi
+  801c5b:	41 ff d5             	call   *%r13
+  801c5e:	83 e0 04             	and    $0x4,%eax
+  801c61:	74 17                	je     801c7a <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801c63:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801c6a:	4c 39 f3             	cmp    %r14,%rbx
+  801c6d:	75 e6                	jne    801c55 <fd_alloc+0x29>
+  801c6f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801c75:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801c7a:	4d 89 27             	mov    %r12,(%r15)
+}
+  801c7d:	48 83 c4 08          	add    $0x8,%rsp
+  801c81:	5b                   	pop    %rbx
+  801c82:	41 5c                	pop    %r12
+  801c84:	41 5d                	pop    %r13
+  801c86:	41 5e                	pop    %r14
+  801c88:	41 5f                	pop    %r15
+  801c8a:	5d                   	pop    %rbp
+  801c8b:	c3                   	ret
+
+0000000000801c8c <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801c8c:	83 ff 1f             	cmp    $0x1f,%edi
+  801c8f:	77 39                	ja     801cca <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801c91:	55                   	push   %rbp
+  801c92:	48 89 e5             	mov    %rsp,%rbp
+  801c95:	41 54                	push   %r12
+  801c97:	53                   	push   %rbx
+  801c98:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801c9b:	48 63 df             	movslq %edi,%rbx
+  801c9e:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801ca5:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801ca9:	48 89 df             	mov    %rbx,%rdi
+  801cac:	48 b8 ba 44 80 00 00 	movabs $0x8044ba,%rax
+  801cb3:	00 00 00 
+  801cb6:	ff d0                	call   *%rax
+  801cb8:	a8 04                	test   $0x4,%al
+  801cba:	74 14                	je     801cd0 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801cbc:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801cc0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801cc5:	5b                   	pop    %rbx
+  801cc6:	41 5c                	pop    %r12
+  801cc8:	5d                   	pop    %rbp
+  801cc9:	c3                   	ret
+        return -E_INVAL;
+  801cca:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801ccf:	c3                   	ret
+        return -E_INVAL;
+  801cd0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801cd5:	eb ee                	jmp    801cc5 <fd_lookup+0x39>
+
+0000000000801cd7 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801cd7:	55                   	push   %rbp
+  801cd8:	48 89 e5             	mov    %rsp,%rbp
+  801cdb:	41 54                	push   %r12
+  801cdd:	53                   	push   %rbx
+  801cde:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801ce1:	48 b8 80 56 80 00 00 	movabs $0x805680,%rax
+  801ce8:	00 00 00 
+  801ceb:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  801cf2:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801cf5:	39 3b                	cmp    %edi,(%rbx)
+  801cf7:	74 47                	je     801d40 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801cf9:	48 83 c0 08          	add    $0x8,%rax
+  801cfd:	48 8b 18             	mov    (%rax),%rbx
+  801d00:	48 85 db             	test   %rbx,%rbx
+  801d03:	75 f0                	jne    801cf5 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801d05:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  801d0c:	00 00 00 
+  801d0f:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801d15:	89 fa                	mov    %edi,%edx
+  801d17:	48 bf f0 55 80 00 00 	movabs $0x8055f0,%rdi
+  801d1e:	00 00 00 
+  801d21:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d26:	48 b9 27 08 80 00 00 	movabs $0x800827,%rcx
+  801d2d:	00 00 00 
+  801d30:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801d32:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801d37:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801d3b:	5b                   	pop    %rbx
+  801d3c:	41 5c                	pop    %r12
+  801d3e:	5d                   	pop    %rbp
+  801d3f:	c3                   	ret
+            return 0;
+  801d40:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d45:	eb f0                	jmp    801d37 <dev_lookup+0x60>
+
+0000000000801d47 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801d47:	55                   	push   %rbp
+  801d48:	48 89 e5             	mov    %rsp,%rbp
+  801d4b:	41 55                	push   %r13
+  801d4d:	41 54                	push   %r12
+  801d4f:	53                   	push   %rbx
+  801d50:	48 83 ec 18          	sub    $0x18,%rsp
+  801d54:	48 89 fb             	mov    %rdi,%rbx
+  801d57:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801d5a:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801d61:	ff ff ff 
+  801d64:	48 01 df             	add    %rbx,%rdi
+  801d67:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801d6b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d6f:	48 b8 8c 1c 80 00 00 	movabs $0x801c8c,%rax
+  801d76:	00 00 00 
+  801d79:	ff d0                	call   *%rax
+  801d7b:	41 89 c5             	mov    %eax,%r13d
+  801d7e:	85 c0                	test   %eax,%eax
+  801d80:	78 06                	js     801d88 <fd_close+0x41>
+  801d82:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801d86:	74 1a                	je     801da2 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801d88:	45 84 e4             	test   %r12b,%r12b
+  801d8b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d90:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801d94:	44 89 e8             	mov    %r13d,%eax
+  801d97:	48 83 c4 18          	add    $0x18,%rsp
+  801d9b:	5b                   	pop    %rbx
+  801d9c:	41 5c                	pop    %r12
+  801d9e:	41 5d                	pop    %r13
+  801da0:	5d                   	pop    %rbp
+  801da1:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801da2:	8b 3b                	mov    (%rbx),%edi
+  801da4:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801da8:	48 b8 d7 1c 80 00 00 	movabs $0x801cd7,%rax
+  801daf:	00 00 00 
+  801db2:	ff d0                	call   *%rax
+  801db4:	41 89 c5             	mov    %eax,%r13d
+  801db7:	85 c0                	test   %eax,%eax
+  801db9:	78 1b                	js     801dd6 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801dbb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801dbf:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801dc3:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801dc9:	48 85 c0             	test   %rax,%rax
+  801dcc:	74 08                	je     801dd6 <fd_close+0x8f>
+  801dce:	48 89 df             	mov    %rbx,%rdi
+  801dd1:	ff d0                	call   *%rax
+  801dd3:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801dd6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ddb:	48 89 de             	mov    %rbx,%rsi
+  801dde:	bf 00 00 00 00       	mov    $0x0,%edi
+  801de3:	48 b8 51 17 80 00 00 	movabs $0x801751,%rax
+  801dea:	00 00 00 
+  801ded:	ff d0                	call   *%rax
+    return res;
+  801def:	eb a3                	jmp    801d94 <fd_close+0x4d>
+
+0000000000801df1 <close>:
+
+int
+close(int fdnum) {
+  801df1:	55                   	push   %rbp
+  801df2:	48 89 e5             	mov    %rsp,%rbp
+  801df5:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801df9:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801dfd:	48 b8 8c 1c 80 00 00 	movabs $0x801c8c,%rax
+  801e04:	00 00 00 
+  801e07:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801e09:	85 c0                	test   %eax,%eax
+  801e0b:	78 15                	js     801e22 <close+0x31>
+
+    return fd_close(fd, 1);
+  801e0d:	be 01 00 00 00       	mov    $0x1,%esi
+  801e12:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801e16:	48 b8 47 1d 80 00 00 	movabs $0x801d47,%rax
+  801e1d:	00 00 00 
+  801e20:	ff d0                	call   *%rax
+}
+  801e22:	c9                   	leave
+  801e23:	c3                   	ret
+
+0000000000801e24 <close_all>:
+
+void
+close_all(void) {
+  801e24:	55                   	push   %rbp
+  801e25:	48 89 e5             	mov    %rsp,%rbp
+  801e28:	41 54                	push   %r12
+  801e2a:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801e2b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e30:	49 bc f1 1d 80 00 00 	movabs $0x801df1,%r12
+  801e37:	00 00 00 
+  801e3a:	89 df                	mov    %ebx,%edi
+  801e3c:	41 ff d4             	call   *%r12
+  801e3f:	83 c3 01             	add    $0x1,%ebx
+  801e42:	83 fb 20             	cmp    $0x20,%ebx
+  801e45:	75 f3                	jne    801e3a <close_all+0x16>
+}
+  801e47:	5b                   	pop    %rbx
+  801e48:	41 5c                	pop    %r12
+  801e4a:	5d                   	pop    %rbp
+  801e4b:	c3                   	ret
+
+0000000000801e4c <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801e4c:	55                   	push   %rbp
+  801e4d:	48 89 e5             	mov    %rsp,%rbp
+  801e50:	41 57                	push   %r15
+  801e52:	41 56                	push   %r14
+  801e54:	41 55                	push   %r13
+  801e56:	41 54                	push   %r12
+  801e58:	53                   	push   %rbx
+  801e59:	48 83 ec 18          	sub    $0x18,%rsp
+  801e5d:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801e60:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801e64:	48 b8 8c 1c 80 00 00 	movabs $0x801c8c,%rax
+  801e6b:	00 00 00 
+  801e6e:	ff d0                	call   *%rax
+  801e70:	89 c3                	mov    %eax,%ebx
+  801e72:	85 c0                	test   %eax,%eax
+  801e74:	0f 88 b8 00 00 00    	js     801f32 <dup+0xe6>
+    close(newfdnum);
+  801e7a:	44 89 e7             	mov    %r12d,%edi
+  801e7d:	48 b8 f1 1d 80 00 00 	movabs $0x801df1,%rax
+  801e84:	00 00 00 
+  801e87:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801e89:	4d 63 ec             	movslq %r12d,%r13
+  801e8c:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801e93:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801e97:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801e9b:	4c 89 ff             	mov    %r15,%rdi
+  801e9e:	49 be 10 1c 80 00 00 	movabs $0x801c10,%r14
+  801ea5:	00 00 00 
+  801ea8:	41 ff d6             	call   *%r14
+  801eab:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801eae:	4c 89 ef             	mov    %r13,%rdi
+  801eb1:	41 ff d6             	call   *%r14
+  801eb4:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801eb7:	48 89 df             	mov    %rbx,%rdi
+  801eba:	48 b8 ba 44 80 00 00 	movabs $0x8044ba,%rax
+  801ec1:	00 00 00 
+  801ec4:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801ec6:	a8 04                	test   $0x4,%al
+  801ec8:	74 2b                	je     801ef5 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801eca:	41 89 c1             	mov    %eax,%r9d
+  801ecd:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801ed3:	4c 89 f1             	mov    %r14,%rcx
+  801ed6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801edb:	48 89 de             	mov    %rbx,%rsi
+  801ede:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ee3:	48 b8 01 17 80 00 00 	movabs $0x801701,%rax
+  801eea:	00 00 00 
+  801eed:	ff d0                	call   *%rax
+  801eef:	89 c3                	mov    %eax,%ebx
+  801ef1:	85 c0                	test   %eax,%eax
+  801ef3:	78 4e                	js     801f43 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801ef5:	4c 89 ff             	mov    %r15,%rdi
+  801ef8:	48 b8 ba 44 80 00 00 	movabs $0x8044ba,%rax
+  801eff:	00 00 00 
+  801f02:	ff d0                	call   *%rax
+  801f04:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801f07:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801f0d:	4c 89 e9             	mov    %r13,%rcx
+  801f10:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f15:	4c 89 fe             	mov    %r15,%rsi
+  801f18:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f1d:	48 b8 01 17 80 00 00 	movabs $0x801701,%rax
+  801f24:	00 00 00 
+  801f27:	ff d0                	call   *%rax
+  801f29:	89 c3                	mov    %eax,%ebx
+  801f2b:	85 c0                	test   %eax,%eax
+  801f2d:	78 14                	js     801f43 <dup+0xf7>
+
+    return newfdnum;
+  801f2f:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801f32:	89 d8                	mov    %ebx,%eax
+  801f34:	48 83 c4 18          	add    $0x18,%rsp
+  801f38:	5b                   	pop    %rbx
+  801f39:	41 5c                	pop    %r12
+  801f3b:	41 5d                	pop    %r13
+  801f3d:	41 5e                	pop    %r14
+  801f3f:	41 5f                	pop    %r15
+  801f41:	5d                   	pop    %rbp
+  801f42:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801f43:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f48:	4c 89 ee             	mov    %r13,%rsi
+  801f4b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f50:	49 bc 51 17 80 00 00 	movabs $0x801751,%r12
+  801f57:	00 00 00 
+  801f5a:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801f5d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f62:	4c 89 f6             	mov    %r14,%rsi
+  801f65:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f6a:	41 ff d4             	call   *%r12
+    return res;
+  801f6d:	eb c3                	jmp    801f32 <dup+0xe6>
+
+0000000000801f6f <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801f6f:	55                   	push   %rbp
+  801f70:	48 89 e5             	mov    %rsp,%rbp
+  801f73:	41 56                	push   %r14
+  801f75:	41 55                	push   %r13
+  801f77:	41 54                	push   %r12
+  801f79:	53                   	push   %rbx
+  801f7a:	48 83 ec 10          	sub    $0x10,%rsp
+  801f7e:	89 fb                	mov    %edi,%ebx
+  801f80:	49 89 f4             	mov    %rsi,%r12
+  801f83:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f86:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f8a:	48 b8 8c 1c 80 00 00 	movabs $0x801c8c,%rax
+  801f91:	00 00 00 
+  801f94:	ff d0                	call   *%rax
+  801f96:	85 c0                	test   %eax,%eax
+  801f98:	78 4c                	js     801fe6 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f9a:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801f9e:	41 8b 3e             	mov    (%r14),%edi
+  801fa1:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801fa5:	48 b8 d7 1c 80 00 00 	movabs $0x801cd7,%rax
+  801fac:	00 00 00 
+  801faf:	ff d0                	call   *%rax
+  801fb1:	85 c0                	test   %eax,%eax
+  801fb3:	78 35                	js     801fea <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801fb5:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801fb9:	83 e0 03             	and    $0x3,%eax
+  801fbc:	83 f8 01             	cmp    $0x1,%eax
+  801fbf:	74 2d                	je     801fee <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801fc1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801fc5:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801fc9:	48 85 c0             	test   %rax,%rax
+  801fcc:	74 56                	je     802024 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801fce:	4c 89 ea             	mov    %r13,%rdx
+  801fd1:	4c 89 e6             	mov    %r12,%rsi
+  801fd4:	4c 89 f7             	mov    %r14,%rdi
+  801fd7:	ff d0                	call   *%rax
+}
+  801fd9:	48 83 c4 10          	add    $0x10,%rsp
+  801fdd:	5b                   	pop    %rbx
+  801fde:	41 5c                	pop    %r12
+  801fe0:	41 5d                	pop    %r13
+  801fe2:	41 5e                	pop    %r14
+  801fe4:	5d                   	pop    %rbp
+  801fe5:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801fe6:	48 98                	cltq
+  801fe8:	eb ef                	jmp    801fd9 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801fea:	48 98                	cltq
+  801fec:	eb eb                	jmp    801fd9 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801fee:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  801ff5:	00 00 00 
+  801ff8:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801ffe:	89 da                	mov    %ebx,%edx
+  802000:	48 bf 31 56 80 00 00 	movabs $0x805631,%rdi
+  802007:	00 00 00 
+  80200a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80200f:	48 b9 27 08 80 00 00 	movabs $0x800827,%rcx
+  802016:	00 00 00 
+  802019:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80201b:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802022:	eb b5                	jmp    801fd9 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802024:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80202b:	eb ac                	jmp    801fd9 <read+0x6a>
+
+000000000080202d <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  80202d:	55                   	push   %rbp
+  80202e:	48 89 e5             	mov    %rsp,%rbp
+  802031:	41 57                	push   %r15
+  802033:	41 56                	push   %r14
+  802035:	41 55                	push   %r13
+  802037:	41 54                	push   %r12
+  802039:	53                   	push   %rbx
+  80203a:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  80203e:	48 85 d2             	test   %rdx,%rdx
+  802041:	74 54                	je     802097 <readn+0x6a>
+  802043:	41 89 fd             	mov    %edi,%r13d
+  802046:	49 89 f6             	mov    %rsi,%r14
+  802049:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  80204c:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  802051:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  802056:	49 bf 6f 1f 80 00 00 	movabs $0x801f6f,%r15
+  80205d:	00 00 00 
+  802060:	4c 89 e2             	mov    %r12,%rdx
+  802063:	48 29 f2             	sub    %rsi,%rdx
+  802066:	4c 01 f6             	add    %r14,%rsi
+  802069:	44 89 ef             	mov    %r13d,%edi
+  80206c:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  80206f:	85 c0                	test   %eax,%eax
+  802071:	78 20                	js     802093 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  802073:	01 c3                	add    %eax,%ebx
+  802075:	85 c0                	test   %eax,%eax
+  802077:	74 08                	je     802081 <readn+0x54>
+  802079:	48 63 f3             	movslq %ebx,%rsi
+  80207c:	4c 39 e6             	cmp    %r12,%rsi
+  80207f:	72 df                	jb     802060 <readn+0x33>
+    }
+    return res;
+  802081:	48 63 c3             	movslq %ebx,%rax
+}
+  802084:	48 83 c4 08          	add    $0x8,%rsp
+  802088:	5b                   	pop    %rbx
+  802089:	41 5c                	pop    %r12
+  80208b:	41 5d                	pop    %r13
+  80208d:	41 5e                	pop    %r14
+  80208f:	41 5f                	pop    %r15
+  802091:	5d                   	pop    %rbp
+  802092:	c3                   	ret
+        if (inc < 0) return inc;
+  802093:	48 98                	cltq
+  802095:	eb ed                	jmp    802084 <readn+0x57>
+    int inc = 1, res = 0;
+  802097:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80209c:	eb e3                	jmp    802081 <readn+0x54>
+
+000000000080209e <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  80209e:	55                   	push   %rbp
+  80209f:	48 89 e5             	mov    %rsp,%rbp
+  8020a2:	41 56                	push   %r14
+  8020a4:	41 55                	push   %r13
+  8020a6:	41 54                	push   %r12
+  8020a8:	53                   	push   %rbx
+  8020a9:	48 83 ec 10          	sub    $0x10,%rsp
+  8020ad:	89 fb                	mov    %edi,%ebx
+  8020af:	49 89 f4             	mov    %rsi,%r12
+  8020b2:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8020b5:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8020b9:	48 b8 8c 1c 80 00 00 	movabs $0x801c8c,%rax
+  8020c0:	00 00 00 
+  8020c3:	ff d0                	call   *%rax
+  8020c5:	85 c0                	test   %eax,%eax
+  8020c7:	78 47                	js     802110 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8020c9:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8020cd:	41 8b 3e             	mov    (%r14),%edi
+  8020d0:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8020d4:	48 b8 d7 1c 80 00 00 	movabs $0x801cd7,%rax
+  8020db:	00 00 00 
+  8020de:	ff d0                	call   *%rax
+  8020e0:	85 c0                	test   %eax,%eax
+  8020e2:	78 30                	js     802114 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8020e4:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8020e9:	74 2d                	je     802118 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8020eb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8020ef:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8020f3:	48 85 c0             	test   %rax,%rax
+  8020f6:	74 56                	je     80214e <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8020f8:	4c 89 ea             	mov    %r13,%rdx
+  8020fb:	4c 89 e6             	mov    %r12,%rsi
+  8020fe:	4c 89 f7             	mov    %r14,%rdi
+  802101:	ff d0                	call   *%rax
+}
+  802103:	48 83 c4 10          	add    $0x10,%rsp
+  802107:	5b                   	pop    %rbx
+  802108:	41 5c                	pop    %r12
+  80210a:	41 5d                	pop    %r13
+  80210c:	41 5e                	pop    %r14
+  80210e:	5d                   	pop    %rbp
+  80210f:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802110:	48 98                	cltq
+  802112:	eb ef                	jmp    802103 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802114:	48 98                	cltq
+  802116:	eb eb                	jmp    802103 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802118:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  80211f:	00 00 00 
+  802122:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802128:	89 da                	mov    %ebx,%edx
+  80212a:	48 bf 4d 56 80 00 00 	movabs $0x80564d,%rdi
+  802131:	00 00 00 
+  802134:	b8 00 00 00 00       	mov    $0x0,%eax
+  802139:	48 b9 27 08 80 00 00 	movabs $0x800827,%rcx
+  802140:	00 00 00 
+  802143:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802145:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80214c:	eb b5                	jmp    802103 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80214e:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802155:	eb ac                	jmp    802103 <write+0x65>
+
+0000000000802157 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802157:	55                   	push   %rbp
+  802158:	48 89 e5             	mov    %rsp,%rbp
+  80215b:	41 54                	push   %r12
+  80215d:	53                   	push   %rbx
+  80215e:	48 83 ec 10          	sub    $0x10,%rsp
+  802162:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802164:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802168:	48 b8 8c 1c 80 00 00 	movabs $0x801c8c,%rax
+  80216f:	00 00 00 
+  802172:	ff d0                	call   *%rax
+  802174:	85 c0                	test   %eax,%eax
+  802176:	78 3e                	js     8021b6 <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802178:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80217c:	41 8b 3c 24          	mov    (%r12),%edi
+  802180:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802184:	48 b8 d7 1c 80 00 00 	movabs $0x801cd7,%rax
+  80218b:	00 00 00 
+  80218e:	ff d0                	call   *%rax
+  802190:	85 c0                	test   %eax,%eax
+  802192:	78 22                	js     8021b6 <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  802194:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802198:	48 8b 40 38          	mov    0x38(%rax),%rax
+  80219c:	48 85 c0             	test   %rax,%rax
+  80219f:	74 0b                	je     8021ac <seek+0x55>
+  8021a1:	89 de                	mov    %ebx,%esi
+  8021a3:	4c 89 e7             	mov    %r12,%rdi
+  8021a6:	ff d0                	call   *%rax
+  8021a8:	85 c0                	test   %eax,%eax
+  8021aa:	78 0a                	js     8021b6 <seek+0x5f>
+
+    fd->fd_offset = offset;
+  8021ac:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  8021b1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021b6:	48 83 c4 10          	add    $0x10,%rsp
+  8021ba:	5b                   	pop    %rbx
+  8021bb:	41 5c                	pop    %r12
+  8021bd:	5d                   	pop    %rbp
+  8021be:	c3                   	ret
+
+00000000008021bf <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8021bf:	55                   	push   %rbp
+  8021c0:	48 89 e5             	mov    %rsp,%rbp
+  8021c3:	41 55                	push   %r13
+  8021c5:	41 54                	push   %r12
+  8021c7:	53                   	push   %rbx
+  8021c8:	48 83 ec 18          	sub    $0x18,%rsp
+  8021cc:	89 fb                	mov    %edi,%ebx
+  8021ce:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8021d1:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8021d5:	48 b8 8c 1c 80 00 00 	movabs $0x801c8c,%rax
+  8021dc:	00 00 00 
+  8021df:	ff d0                	call   *%rax
+  8021e1:	85 c0                	test   %eax,%eax
+  8021e3:	78 38                	js     80221d <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8021e5:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8021e9:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8021ed:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8021f1:	48 b8 d7 1c 80 00 00 	movabs $0x801cd7,%rax
+  8021f8:	00 00 00 
+  8021fb:	ff d0                	call   *%rax
+  8021fd:	85 c0                	test   %eax,%eax
+  8021ff:	78 1c                	js     80221d <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802201:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  802206:	74 20                	je     802228 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802208:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80220c:	48 8b 40 30          	mov    0x30(%rax),%rax
+  802210:	48 85 c0             	test   %rax,%rax
+  802213:	74 47                	je     80225c <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802215:	44 89 e6             	mov    %r12d,%esi
+  802218:	4c 89 ef             	mov    %r13,%rdi
+  80221b:	ff d0                	call   *%rax
+}
+  80221d:	48 83 c4 18          	add    $0x18,%rsp
+  802221:	5b                   	pop    %rbx
+  802222:	41 5c                	pop    %r12
+  802224:	41 5d                	pop    %r13
+  802226:	5d                   	pop    %rbp
+  802227:	c3                   	ret
+                thisenv->env_id, fdnum);
+  802228:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  80222f:	00 00 00 
+  802232:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802238:	89 da                	mov    %ebx,%edx
+  80223a:	48 bf 10 56 80 00 00 	movabs $0x805610,%rdi
+  802241:	00 00 00 
+  802244:	b8 00 00 00 00       	mov    $0x0,%eax
+  802249:	48 b9 27 08 80 00 00 	movabs $0x800827,%rcx
+  802250:	00 00 00 
+  802253:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802255:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80225a:	eb c1                	jmp    80221d <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80225c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802261:	eb ba                	jmp    80221d <ftruncate+0x5e>
+
+0000000000802263 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802263:	55                   	push   %rbp
+  802264:	48 89 e5             	mov    %rsp,%rbp
+  802267:	41 54                	push   %r12
+  802269:	53                   	push   %rbx
+  80226a:	48 83 ec 10          	sub    $0x10,%rsp
+  80226e:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802271:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802275:	48 b8 8c 1c 80 00 00 	movabs $0x801c8c,%rax
+  80227c:	00 00 00 
+  80227f:	ff d0                	call   *%rax
+  802281:	85 c0                	test   %eax,%eax
+  802283:	78 4e                	js     8022d3 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802285:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802289:	41 8b 3c 24          	mov    (%r12),%edi
+  80228d:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802291:	48 b8 d7 1c 80 00 00 	movabs $0x801cd7,%rax
+  802298:	00 00 00 
+  80229b:	ff d0                	call   *%rax
+  80229d:	85 c0                	test   %eax,%eax
+  80229f:	78 32                	js     8022d3 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8022a1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8022a5:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8022aa:	74 30                	je     8022dc <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8022ac:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8022af:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8022b6:	00 00 00 
+    stat->st_isdir = 0;
+  8022b9:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8022c0:	00 00 00 
+    stat->st_dev = dev;
+  8022c3:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8022ca:	48 89 de             	mov    %rbx,%rsi
+  8022cd:	4c 89 e7             	mov    %r12,%rdi
+  8022d0:	ff 50 28             	call   *0x28(%rax)
+}
+  8022d3:	48 83 c4 10          	add    $0x10,%rsp
+  8022d7:	5b                   	pop    %rbx
+  8022d8:	41 5c                	pop    %r12
+  8022da:	5d                   	pop    %rbp
+  8022db:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8022dc:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8022e1:	eb f0                	jmp    8022d3 <fstat+0x70>
+
+00000000008022e3 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8022e3:	55                   	push   %rbp
+  8022e4:	48 89 e5             	mov    %rsp,%rbp
+  8022e7:	41 54                	push   %r12
+  8022e9:	53                   	push   %rbx
+  8022ea:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8022ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8022f2:	48 b8 51 34 80 00 00 	movabs $0x803451,%rax
+  8022f9:	00 00 00 
+  8022fc:	ff d0                	call   *%rax
+  8022fe:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802300:	85 c0                	test   %eax,%eax
+  802302:	78 25                	js     802329 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802304:	4c 89 e6             	mov    %r12,%rsi
+  802307:	89 c7                	mov    %eax,%edi
+  802309:	48 b8 63 22 80 00 00 	movabs $0x802263,%rax
+  802310:	00 00 00 
+  802313:	ff d0                	call   *%rax
+  802315:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802318:	89 df                	mov    %ebx,%edi
+  80231a:	48 b8 f1 1d 80 00 00 	movabs $0x801df1,%rax
+  802321:	00 00 00 
+  802324:	ff d0                	call   *%rax
+
+    return res;
+  802326:	44 89 e3             	mov    %r12d,%ebx
+}
+  802329:	89 d8                	mov    %ebx,%eax
+  80232b:	5b                   	pop    %rbx
+  80232c:	41 5c                	pop    %r12
+  80232e:	5d                   	pop    %rbp
+  80232f:	c3                   	ret
+
+0000000000802330 <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  802330:	48 b8 08 00 83 00 00 	movabs $0x830008,%rax
+  802337:	00 00 00 
+  80233a:	83 38 00             	cmpl   $0x0,(%rax)
+  80233d:	74 0a                	je     802349 <fsenv+0x19>
+    return envid;
+}
+  80233f:	a1 08 00 83 00 00 00 	movabs 0x830008,%eax
+  802346:	00 00 
+  802348:	c3                   	ret
+fsenv(void) {
+  802349:	55                   	push   %rbp
+  80234a:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  80234d:	bf 03 00 00 00       	mov    $0x3,%edi
+  802352:	48 b8 1d 4e 80 00 00 	movabs $0x804e1d,%rax
+  802359:	00 00 00 
+  80235c:	ff d0                	call   *%rax
+  80235e:	a3 08 00 83 00 00 00 	movabs %eax,0x830008
+  802365:	00 00 
+}
+  802367:	a1 08 00 83 00 00 00 	movabs 0x830008,%eax
+  80236e:	00 00 
+  802370:	5d                   	pop    %rbp
+  802371:	c3                   	ret
+
+0000000000802372 <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  802372:	55                   	push   %rbp
+  802373:	48 89 e5             	mov    %rsp,%rbp
+  802376:	41 54                	push   %r12
+  802378:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  802379:	ba 00 50 00 00       	mov    $0x5000,%edx
+  80237e:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  802383:	48 89 de             	mov    %rbx,%rsi
+  802386:	bf 00 00 00 00       	mov    $0x0,%edi
+  80238b:	48 b8 51 17 80 00 00 	movabs $0x801751,%rax
+  802392:	00 00 00 
+  802395:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  802397:	48 b8 00 26 83 00 00 	movabs $0x832600,%rax
+  80239e:	00 00 00 
+  8023a1:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  8023a7:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8023ac:	ba 00 50 00 00       	mov    $0x5000,%edx
+  8023b1:	48 89 de             	mov    %rbx,%rsi
+  8023b4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023b9:	48 b8 ab 16 80 00 00 	movabs $0x8016ab,%rax
+  8023c0:	00 00 00 
+  8023c3:	ff d0                	call   *%rax
+  8023c5:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  8023c7:	85 c0                	test   %eax,%eax
+  8023c9:	0f 88 a2 00 00 00    	js     802471 <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  8023cf:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  8023d6:	00 00 00 
+  8023d9:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8023df:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  8023e4:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  8023e6:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  8023eb:	49 bc 82 46 80 00 00 	movabs $0x804682,%r12
+  8023f2:	00 00 00 
+  8023f5:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  8023f8:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  8023fd:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  802400:	48 b8 30 23 80 00 00 	movabs $0x802330,%rax
+  802407:	00 00 00 
+  80240a:	ff d0                	call   *%rax
+  80240c:	89 c7                	mov    %eax,%edi
+  80240e:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  802414:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  802419:	48 89 da             	mov    %rbx,%rdx
+  80241c:	be 09 00 00 00       	mov    $0x9,%esi
+  802421:	48 b8 c7 4d 80 00 00 	movabs $0x804dc7,%rax
+  802428:	00 00 00 
+  80242b:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  80242d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802432:	ba 00 00 00 00       	mov    $0x0,%edx
+  802437:	be 00 00 00 00       	mov    $0x0,%esi
+  80243c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802441:	48 b8 a3 4d 80 00 00 	movabs $0x804da3,%rax
+  802448:	00 00 00 
+  80244b:	ff d0                	call   *%rax
+  80244d:	89 c3                	mov    %eax,%ebx
+  80244f:	85 c0                	test   %eax,%eax
+  802451:	78 25                	js     802478 <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  802453:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  80245a:	00 00 00 
+  80245d:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802463:	a3 00 26 83 00 00 00 	movabs %eax,0x832600
+  80246a:	00 00 
+    return 0;
+  80246c:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  802471:	89 d8                	mov    %ebx,%eax
+  802473:	5b                   	pop    %rbx
+  802474:	41 5c                	pop    %r12
+  802476:	5d                   	pop    %rbp
+  802477:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  802478:	ba 00 50 00 00       	mov    $0x5000,%edx
+  80247d:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  802482:	bf 00 00 00 00       	mov    $0x0,%edi
+  802487:	48 b8 51 17 80 00 00 	movabs $0x801751,%rax
+  80248e:	00 00 00 
+  802491:	ff d0                	call   *%rax
+        return res;
+  802493:	eb dc                	jmp    802471 <fschan_setup+0xff>
+
+0000000000802495 <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  802495:	48 b8 04 26 83 00 00 	movabs $0x832604,%rax
+  80249c:	00 00 00 
+  80249f:	80 38 00             	cmpb   $0x0,(%rax)
+  8024a2:	74 55                	je     8024f9 <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  8024a4:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  8024ab:	00 00 00 
+  8024ae:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  8024b4:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  8024b9:	48 ba 00 26 83 00 00 	movabs $0x832600,%rdx
+  8024c0:	00 00 00 
+  8024c3:	3b 0a                	cmp    (%rdx),%ecx
+  8024c5:	75 01                	jne    8024c8 <fschan+0x33>
+}
+  8024c7:	c3                   	ret
+fschan(void) {
+  8024c8:	55                   	push   %rbp
+  8024c9:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  8024cc:	48 b8 72 23 80 00 00 	movabs $0x802372,%rax
+  8024d3:	00 00 00 
+  8024d6:	ff d0                	call   *%rax
+  8024d8:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  8024da:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  8024df:	85 d2                	test   %edx,%edx
+  8024e1:	78 02                	js     8024e5 <fschan+0x50>
+}
+  8024e3:	5d                   	pop    %rbp
+  8024e4:	c3                   	ret
+        fschan_enabled = 0;
+  8024e5:	48 b8 04 26 83 00 00 	movabs $0x832604,%rax
+  8024ec:	00 00 00 
+  8024ef:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  8024f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024f7:	eb ea                	jmp    8024e3 <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  8024f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024fe:	c3                   	ret
+
+00000000008024ff <fbuf>:
+fbuf(struct Fd *fd) {
+  8024ff:	55                   	push   %rbp
+  802500:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  802503:	48 b8 fe 1b 80 00 00 	movabs $0x801bfe,%rax
+  80250a:	00 00 00 
+  80250d:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  80250f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802514:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802518:	77 12                	ja     80252c <fbuf+0x2d>
+  80251a:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  80251e:	48 b8 00 23 83 00 00 	movabs $0x832300,%rax
+  802525:	00 00 00 
+  802528:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  80252c:	48 89 d0             	mov    %rdx,%rax
+  80252f:	5d                   	pop    %rbp
+  802530:	c3                   	ret
+
+0000000000802531 <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  802531:	55                   	push   %rbp
+  802532:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  802535:	48 83 c7 40          	add    $0x40,%rdi
+  802539:	48 b8 bc 46 80 00 00 	movabs $0x8046bc,%rax
+  802540:	00 00 00 
+  802543:	ff d0                	call   *%rax
+  802545:	84 c0                	test   %al,%al
+  802547:	75 02                	jne    80254b <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  802549:	5d                   	pop    %rbp
+  80254a:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  80254b:	48 b8 30 23 80 00 00 	movabs $0x802330,%rax
+  802552:	00 00 00 
+  802555:	ff d0                	call   *%rax
+  802557:	89 c7                	mov    %eax,%edi
+  802559:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80255f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802564:	ba 00 00 00 00       	mov    $0x0,%edx
+  802569:	be 0a 00 00 00       	mov    $0xa,%esi
+  80256e:	48 b8 c7 4d 80 00 00 	movabs $0x804dc7,%rax
+  802575:	00 00 00 
+  802578:	ff d0                	call   *%rax
+}
+  80257a:	eb cd                	jmp    802549 <fschan_publish+0x18>
+
+000000000080257c <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  80257c:	55                   	push   %rbp
+  80257d:	48 89 e5             	mov    %rsp,%rbp
+  802580:	41 57                	push   %r15
+  802582:	41 56                	push   %r14
+  802584:	41 55                	push   %r13
+  802586:	41 54                	push   %r12
+  802588:	53                   	push   %rbx
+  802589:	48 83 ec 48          	sub    $0x48,%rsp
+  80258d:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802591:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  802595:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  802598:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  80259c:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  80259f:	48 ba 04 00 83 00 00 	movabs $0x830004,%rdx
+  8025a6:	00 00 00 
+  8025a9:	8b 02                	mov    (%rdx),%eax
+  8025ab:	83 c0 01             	add    $0x1,%eax
+  8025ae:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8025b3:	0f 44 c1             	cmove  %ecx,%eax
+  8025b6:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  8025b8:	4d 85 c0             	test   %r8,%r8
+  8025bb:	74 2c                	je     8025e9 <fschan_rw+0x6d>
+  8025bd:	45 89 ce             	mov    %r9d,%r14d
+  8025c0:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  8025c7:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  8025cb:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8025d1:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  8025d8:	00 
+  8025d9:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8025df:	b8 01 00 00 00       	mov    $0x1,%eax
+  8025e4:	e9 41 01 00 00       	jmp    80272a <fschan_rw+0x1ae>
+  8025e9:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  8025ed:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8025f1:	e9 9c 01 00 00       	jmp    802792 <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  8025f6:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8025fa:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  8025fd:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  802600:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  802603:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  802607:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  80260b:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  80260f:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  802613:	48 89 da             	mov    %rbx,%rdx
+  802616:	48 b8 ad 13 80 00 00 	movabs $0x8013ad,%rax
+  80261d:	00 00 00 
+  802620:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  802622:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802626:	48 b8 31 25 80 00 00 	movabs $0x802531,%rax
+  80262d:	00 00 00 
+  802630:	ff d0                	call   *%rax
+            queued += blk;
+  802632:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  802635:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  802639:	4d 39 fc             	cmp    %r15,%r12
+  80263c:	73 6b                	jae    8026a9 <fschan_rw+0x12d>
+  80263e:	41 83 fd 0f          	cmp    $0xf,%r13d
+  802642:	77 65                	ja     8026a9 <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  802644:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802648:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  80264c:	48 b8 97 46 80 00 00 	movabs $0x804697,%rax
+  802653:	00 00 00 
+  802656:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  802658:	4c 89 fb             	mov    %r15,%rbx
+  80265b:	4c 29 e3             	sub    %r12,%rbx
+  80265e:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  802663:	48 39 d3             	cmp    %rdx,%rbx
+  802666:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  80266a:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  80266e:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802672:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  802676:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  802679:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  80267b:	48 b9 04 00 83 00 00 	movabs $0x830004,%rcx
+  802682:	00 00 00 
+  802685:	8b 09                	mov    (%rcx),%ecx
+  802687:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  80268a:	83 fe 03             	cmp    $0x3,%esi
+  80268d:	0f 85 63 ff ff ff    	jne    8025f6 <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  802693:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802697:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  80269a:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  80269d:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  8026a0:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  8026a4:	e9 79 ff ff ff       	jmp    802622 <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  8026a9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8026ad:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  8026b4:	48 89 df             	mov    %rbx,%rdi
+  8026b7:	48 b8 5a 47 80 00 00 	movabs $0x80475a,%rax
+  8026be:	00 00 00 
+  8026c1:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  8026c3:	48 89 df             	mov    %rbx,%rdi
+  8026c6:	48 b8 e8 46 80 00 00 	movabs $0x8046e8,%rax
+  8026cd:	00 00 00 
+  8026d0:	ff d0                	call   *%rax
+  8026d2:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  8026d6:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  8026da:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  8026de:	75 25                	jne    802705 <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  8026e0:	8b 40 04             	mov    0x4(%rax),%eax
+  8026e3:	85 c0                	test   %eax,%eax
+  8026e5:	0f 88 86 00 00 00    	js     802771 <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  8026eb:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  8026ef:	74 5b                	je     80274c <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  8026f1:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8026f5:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  8026f9:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  8026fd:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  802701:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  802705:	48 89 df             	mov    %rbx,%rdi
+  802708:	48 b8 0f 47 80 00 00 	movabs $0x80470f,%rax
+  80270f:	00 00 00 
+  802712:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  802714:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  802718:	83 f0 01             	xor    $0x1,%eax
+  80271b:	4d 39 fc             	cmp    %r15,%r12
+  80271e:	0f 92 c2             	setb   %dl
+  802721:	84 c2                	test   %al,%dl
+  802723:	75 05                	jne    80272a <fschan_rw+0x1ae>
+  802725:	45 85 ed             	test   %r13d,%r13d
+  802728:	74 50                	je     80277a <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  80272a:	4d 39 fc             	cmp    %r15,%r12
+  80272d:	0f 92 c1             	setb   %cl
+  802730:	41 83 fd 0f          	cmp    $0xf,%r13d
+  802734:	0f 96 c2             	setbe  %dl
+  802737:	84 d1                	test   %dl,%cl
+  802739:	0f 84 6a ff ff ff    	je     8026a9 <fschan_rw+0x12d>
+  80273f:	84 c0                	test   %al,%al
+  802741:	0f 85 fd fe ff ff    	jne    802644 <fschan_rw+0xc8>
+  802747:	e9 5d ff ff ff       	jmp    8026a9 <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  80274c:	48 63 d0             	movslq %eax,%rdx
+  80274f:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802753:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  802757:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80275b:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  80275f:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  802763:	48 b8 ad 13 80 00 00 	movabs $0x8013ad,%rax
+  80276a:	00 00 00 
+  80276d:	ff d0                	call   *%rax
+  80276f:	eb 80                	jmp    8026f1 <fschan_rw+0x175>
+                err = msg->fm_res;
+  802771:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  802774:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  802778:	eb 8b                	jmp    802705 <fschan_rw+0x189>
+    return done || !err ? done : err;
+  80277a:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  80277f:	0f 85 68 fe ff ff    	jne    8025ed <fschan_rw+0x71>
+  802785:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  802788:	85 c0                	test   %eax,%eax
+  80278a:	0f 84 5d fe ff ff    	je     8025ed <fschan_rw+0x71>
+  802790:	48 98                	cltq
+}
+  802792:	48 83 c4 48          	add    $0x48,%rsp
+  802796:	5b                   	pop    %rbx
+  802797:	41 5c                	pop    %r12
+  802799:	41 5d                	pop    %r13
+  80279b:	41 5e                	pop    %r14
+  80279d:	41 5f                	pop    %r15
+  80279f:	5d                   	pop    %rbp
+  8027a0:	c3                   	ret
+
+00000000008027a1 <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  8027a1:	55                   	push   %rbp
+  8027a2:	48 89 e5             	mov    %rsp,%rbp
+  8027a5:	41 56                	push   %r14
+  8027a7:	41 55                	push   %r13
+  8027a9:	41 54                	push   %r12
+  8027ab:	53                   	push   %rbx
+  8027ac:	48 83 ec 10          	sub    $0x10,%rsp
+  8027b0:	49 89 fe             	mov    %rdi,%r14
+  8027b3:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  8027b6:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  8027ba:	48 29 f3             	sub    %rsi,%rbx
+  8027bd:	48 39 d3             	cmp    %rdx,%rbx
+  8027c0:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  8027c4:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8027cb:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  8027cc:	bf 00 10 00 00       	mov    $0x1000,%edi
+  8027d1:	49 bd 19 45 80 00 00 	movabs $0x804519,%r13
+  8027d8:	00 00 00 
+  8027db:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  8027e2:	76 1e                	jbe    802802 <mmap_fault+0x61>
+  8027e4:	4c 01 e7             	add    %r12,%rdi
+  8027e7:	41 ff d5             	call   *%r13
+  8027ea:	84 c0                	test   %al,%al
+  8027ec:	75 14                	jne    802802 <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  8027ee:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8027f2:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  8027f9:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  8027fd:	48 39 df             	cmp    %rbx,%rdi
+  802800:	72 e2                	jb     8027e4 <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  802802:	48 bb 00 10 83 00 00 	movabs $0x831000,%rbx
+  802809:	00 00 00 
+  80280c:	48 ba 00 20 83 00 00 	movabs $0x832000,%rdx
+  802813:	00 00 00 
+  802816:	4c 89 f0             	mov    %r14,%rax
+  802819:	48 29 d0             	sub    %rdx,%rax
+  80281c:	48 c1 f8 03          	sar    $0x3,%rax
+  802820:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  802827:	aa aa aa 
+  80282a:	48 0f af c2          	imul   %rdx,%rax
+  80282e:	48 c1 e0 0c          	shl    $0xc,%rax
+  802832:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  802837:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  80283b:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  80283d:	44 89 e0             	mov    %r12d,%eax
+  802840:	41 03 46 10          	add    0x10(%r14),%eax
+  802844:	41 2b 06             	sub    (%r14),%eax
+  802847:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  80284a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80284e:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  802852:	41 8b 46 14          	mov    0x14(%r14),%eax
+  802856:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  802859:	48 b8 30 23 80 00 00 	movabs $0x802330,%rax
+  802860:	00 00 00 
+  802863:	ff d0                	call   *%rax
+  802865:	89 c7                	mov    %eax,%edi
+  802867:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80286d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802872:	48 89 da             	mov    %rbx,%rdx
+  802875:	be 0f 00 00 00       	mov    $0xf,%esi
+  80287a:	48 b8 c7 4d 80 00 00 	movabs $0x804dc7,%rax
+  802881:	00 00 00 
+  802884:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  802886:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80288b:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80288f:	4c 89 e6             	mov    %r12,%rsi
+  802892:	bf 00 00 00 00       	mov    $0x0,%edi
+  802897:	48 b8 a3 4d 80 00 00 	movabs $0x804da3,%rax
+  80289e:	00 00 00 
+  8028a1:	ff d0                	call   *%rax
+  8028a3:	48 98                	cltq
+}
+  8028a5:	48 83 c4 10          	add    $0x10,%rsp
+  8028a9:	5b                   	pop    %rbx
+  8028aa:	41 5c                	pop    %r12
+  8028ac:	41 5d                	pop    %r13
+  8028ae:	41 5e                	pop    %r14
+  8028b0:	5d                   	pop    %rbp
+  8028b1:	c3                   	ret
+
+00000000008028b2 <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  8028b2:	48 8b 37             	mov    (%rdi),%rsi
+  8028b5:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  8028bc:	48 ba 00 20 83 00 00 	movabs $0x832000,%rdx
+  8028c3:	00 00 00 
+  8028c6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8028cb:	eb 0f                	jmp    8028dc <mmap_pgfault+0x2a>
+  8028cd:	c3                   	ret
+  8028ce:	48 83 c1 01          	add    $0x1,%rcx
+  8028d2:	48 83 c2 18          	add    $0x18,%rdx
+  8028d6:	48 83 f9 20          	cmp    $0x20,%rcx
+  8028da:	74 6e                	je     80294a <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  8028dc:	48 8b 02             	mov    (%rdx),%rax
+  8028df:	48 83 e8 01          	sub    $0x1,%rax
+  8028e3:	48 39 f0             	cmp    %rsi,%rax
+  8028e6:	73 e6                	jae    8028ce <mmap_pgfault+0x1c>
+  8028e8:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  8028ec:	73 e0                	jae    8028ce <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  8028ee:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  8028f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028f7:	f6 c2 01             	test   $0x1,%dl
+  8028fa:	75 d1                	jne    8028cd <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  8028fc:	f6 c2 02             	test   $0x2,%dl
+  8028ff:	74 1a                	je     80291b <mmap_pgfault+0x69>
+  802901:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  802905:	b8 00 00 00 00       	mov    $0x0,%eax
+  80290a:	48 bf 00 20 83 00 00 	movabs $0x832000,%rdi
+  802911:	00 00 00 
+  802914:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  802919:	74 35                	je     802950 <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  80291b:	55                   	push   %rbp
+  80291c:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  80291f:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  802923:	48 b8 00 20 83 00 00 	movabs $0x832000,%rax
+  80292a:	00 00 00 
+  80292d:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  802931:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802936:	48 b8 a1 27 80 00 00 	movabs $0x8027a1,%rax
+  80293d:	00 00 00 
+  802940:	ff d0                	call   *%rax
+  802942:	48 85 c0             	test   %rax,%rax
+  802945:	0f 9f c0             	setg   %al
+}
+  802948:	5d                   	pop    %rbp
+  802949:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  80294a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80294f:	c3                   	ret
+}
+  802950:	c3                   	ret
+
+0000000000802951 <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  802951:	55                   	push   %rbp
+  802952:	48 89 e5             	mov    %rsp,%rbp
+  802955:	41 54                	push   %r12
+  802957:	53                   	push   %rbx
+  802958:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80295b:	48 b8 00 20 83 00 00 	movabs $0x832000,%rax
+  802962:	00 00 00 
+  802965:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  80296a:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80296e:	74 15                	je     802985 <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802970:	48 83 c3 01          	add    $0x1,%rbx
+  802974:	48 83 c0 18          	add    $0x18,%rax
+  802978:	48 83 fb 20          	cmp    $0x20,%rbx
+  80297c:	75 ec                	jne    80296a <mmap_alloc+0x19>
+    return NULL;
+  80297e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802983:	eb 52                	jmp    8029d7 <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  802985:	4c 89 e7             	mov    %r12,%rdi
+  802988:	48 b8 ba 44 80 00 00 	movabs $0x8044ba,%rax
+  80298f:	00 00 00 
+  802992:	ff d0                	call   *%rax
+  802994:	41 89 c1             	mov    %eax,%r9d
+  802997:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  80299e:	48 c1 e1 0c          	shl    $0xc,%rcx
+  8029a2:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8029a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029ad:	4c 89 e6             	mov    %r12,%rsi
+  8029b0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029b5:	48 b8 01 17 80 00 00 	movabs $0x801701,%rax
+  8029bc:	00 00 00 
+  8029bf:	ff d0                	call   *%rax
+  8029c1:	85 c0                	test   %eax,%eax
+  8029c3:	78 17                	js     8029dc <mmap_alloc+0x8b>
+        return &mmaps[i];
+  8029c5:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  8029c9:	48 b8 00 20 83 00 00 	movabs $0x832000,%rax
+  8029d0:	00 00 00 
+  8029d3:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  8029d7:	5b                   	pop    %rbx
+  8029d8:	41 5c                	pop    %r12
+  8029da:	5d                   	pop    %rbp
+  8029db:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  8029dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029e1:	eb f4                	jmp    8029d7 <mmap_alloc+0x86>
+
+00000000008029e3 <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  8029e3:	55                   	push   %rbp
+  8029e4:	48 89 e5             	mov    %rsp,%rbp
+  8029e7:	41 56                	push   %r14
+  8029e9:	41 55                	push   %r13
+  8029eb:	41 54                	push   %r12
+  8029ed:	53                   	push   %rbx
+  8029ee:	48 83 ec 10          	sub    $0x10,%rsp
+  8029f2:	41 89 fc             	mov    %edi,%r12d
+  8029f5:	49 89 f5             	mov    %rsi,%r13
+  8029f8:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  8029fb:	48 89 f0             	mov    %rsi,%rax
+  8029fe:	48 09 d0             	or     %rdx,%rax
+  802a01:	75 0d                	jne    802a10 <fsipc+0x2d>
+  802a03:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  802a06:	83 f8 04             	cmp    $0x4,%eax
+  802a09:	76 7d                	jbe    802a88 <fsipc+0xa5>
+  802a0b:	83 ff 0d             	cmp    $0xd,%edi
+  802a0e:	74 78                	je     802a88 <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  802a10:	48 b8 30 23 80 00 00 	movabs $0x802330,%rax
+  802a17:	00 00 00 
+  802a1a:	ff d0                	call   *%rax
+  802a1c:	89 c7                	mov    %eax,%edi
+  802a1e:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  802a25:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  802a2c:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  802a33:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802a39:	48 ba 00 00 84 00 00 	movabs $0x840000,%rdx
+  802a40:	00 00 00 
+  802a43:	44 89 e6             	mov    %r12d,%esi
+  802a46:	48 b8 c7 4d 80 00 00 	movabs $0x804dc7,%rax
+  802a4d:	00 00 00 
+  802a50:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  802a52:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  802a59:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  802a5a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a5f:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802a63:	4c 89 ee             	mov    %r13,%rsi
+  802a66:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a6b:	48 b8 a3 4d 80 00 00 	movabs $0x804da3,%rax
+  802a72:	00 00 00 
+  802a75:	ff d0                	call   *%rax
+  802a77:	89 c3                	mov    %eax,%ebx
+}
+  802a79:	89 d8                	mov    %ebx,%eax
+  802a7b:	48 83 c4 10          	add    $0x10,%rsp
+  802a7f:	5b                   	pop    %rbx
+  802a80:	41 5c                	pop    %r12
+  802a82:	41 5d                	pop    %r13
+  802a84:	41 5e                	pop    %r14
+  802a86:	5d                   	pop    %rbp
+  802a87:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  802a88:	48 b8 95 24 80 00 00 	movabs $0x802495,%rax
+  802a8f:	00 00 00 
+  802a92:	ff d0                	call   *%rax
+  802a94:	49 89 c6             	mov    %rax,%r14
+  802a97:	48 85 c0             	test   %rax,%rax
+  802a9a:	0f 84 70 ff ff ff    	je     802a10 <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  802aa0:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  802aa4:	48 b8 97 46 80 00 00 	movabs $0x804697,%rax
+  802aab:	00 00 00 
+  802aae:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  802ab0:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  802ab3:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  802aba:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  802abe:	ba 10 00 00 00       	mov    $0x10,%edx
+  802ac3:	48 be 00 00 84 00 00 	movabs $0x840000,%rsi
+  802aca:	00 00 00 
+  802acd:	48 b8 ad 13 80 00 00 	movabs $0x8013ad,%rax
+  802ad4:	00 00 00 
+  802ad7:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  802ad9:	4c 89 f7             	mov    %r14,%rdi
+  802adc:	48 b8 31 25 80 00 00 	movabs $0x802531,%rax
+  802ae3:	00 00 00 
+  802ae6:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  802ae8:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  802aef:	4c 89 f7             	mov    %r14,%rdi
+  802af2:	48 b8 5a 47 80 00 00 	movabs $0x80475a,%rax
+  802af9:	00 00 00 
+  802afc:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  802afe:	4c 89 f7             	mov    %r14,%rdi
+  802b01:	48 b8 e8 46 80 00 00 	movabs $0x8046e8,%rax
+  802b08:	00 00 00 
+  802b0b:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  802b0d:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  802b10:	41 83 fc 05          	cmp    $0x5,%r12d
+  802b14:	75 04                	jne    802b1a <fsipc+0x137>
+  802b16:	85 db                	test   %ebx,%ebx
+  802b18:	79 14                	jns    802b2e <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  802b1a:	4c 89 f7             	mov    %r14,%rdi
+  802b1d:	48 b8 0f 47 80 00 00 	movabs $0x80470f,%rax
+  802b24:	00 00 00 
+  802b27:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  802b29:	e9 4b ff ff ff       	jmp    802a79 <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  802b2e:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  802b32:	ba 88 00 00 00       	mov    $0x88,%edx
+  802b37:	48 bf 00 00 84 00 00 	movabs $0x840000,%rdi
+  802b3e:	00 00 00 
+  802b41:	48 b8 ad 13 80 00 00 	movabs $0x8013ad,%rax
+  802b48:	00 00 00 
+  802b4b:	ff d0                	call   *%rax
+  802b4d:	eb cb                	jmp    802b1a <fsipc+0x137>
+
+0000000000802b4f <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  802b4f:	55                   	push   %rbp
+  802b50:	48 89 e5             	mov    %rsp,%rbp
+  802b53:	41 57                	push   %r15
+  802b55:	41 56                	push   %r14
+  802b57:	41 55                	push   %r13
+  802b59:	41 54                	push   %r12
+  802b5b:	53                   	push   %rbx
+  802b5c:	48 83 ec 18          	sub    $0x18,%rsp
+  802b60:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  802b64:	49 89 f6             	mov    %rsi,%r14
+  802b67:	49 89 d4             	mov    %rdx,%r12
+  802b6a:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  802b6d:	48 b8 95 24 80 00 00 	movabs $0x802495,%rax
+  802b74:	00 00 00 
+  802b77:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  802b79:	48 85 c0             	test   %rax,%rax
+  802b7c:	0f 85 96 00 00 00    	jne    802c18 <devfile_write_direct+0xc9>
+    size_t write = 0;
+  802b82:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802b89:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802b8a:	49 bf 00 00 84 00 00 	movabs $0x840000,%r15
+  802b91:	00 00 00 
+    while (n) {
+  802b94:	4d 85 e4             	test   %r12,%r12
+  802b97:	74 79                	je     802c12 <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802b99:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  802b9e:	49 39 dc             	cmp    %rbx,%r12
+  802ba1:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  802ba5:	48 89 da             	mov    %rbx,%rdx
+  802ba8:	4c 89 f6             	mov    %r14,%rsi
+  802bab:	48 bf 00 10 84 00 00 	movabs $0x841000,%rdi
+  802bb2:	00 00 00 
+  802bb5:	48 b8 ad 13 80 00 00 	movabs $0x8013ad,%rax
+  802bbc:	00 00 00 
+  802bbf:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802bc1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802bc5:	8b 40 0c             	mov    0xc(%rax),%eax
+  802bc8:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  802bcb:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802bce:	44 01 e8             	add    %r13d,%eax
+  802bd1:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  802bd5:	41 0f 44 c5          	cmove  %r13d,%eax
+  802bd9:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  802bdd:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  802be1:	48 89 da             	mov    %rbx,%rdx
+  802be4:	be 00 00 00 00       	mov    $0x0,%esi
+  802be9:	bf 04 00 00 00       	mov    $0x4,%edi
+  802bee:	48 b8 e3 29 80 00 00 	movabs $0x8029e3,%rax
+  802bf5:	00 00 00 
+  802bf8:	ff d0                	call   *%rax
+        if (res < 0)
+  802bfa:	85 c0                	test   %eax,%eax
+  802bfc:	78 4a                	js     802c48 <devfile_write_direct+0xf9>
+        buf += res;
+  802bfe:	48 98                	cltq
+  802c00:	49 01 c6             	add    %rax,%r14
+        write += res;
+  802c03:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  802c07:	49 29 c4             	sub    %rax,%r12
+  802c0a:	75 8d                	jne    802b99 <devfile_write_direct+0x4a>
+    return write;
+  802c0c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c10:	eb 27                	jmp    802c39 <devfile_write_direct+0xea>
+    size_t write = 0;
+  802c12:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  802c16:	eb f4                	jmp    802c0c <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  802c18:	45 89 e9             	mov    %r13d,%r9d
+  802c1b:	4d 89 e0             	mov    %r12,%r8
+  802c1e:	4c 89 f1             	mov    %r14,%rcx
+  802c21:	ba 04 00 00 00       	mov    $0x4,%edx
+  802c26:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802c2a:	48 89 c7             	mov    %rax,%rdi
+  802c2d:	48 b8 7c 25 80 00 00 	movabs $0x80257c,%rax
+  802c34:	00 00 00 
+  802c37:	ff d0                	call   *%rax
+}
+  802c39:	48 83 c4 18          	add    $0x18,%rsp
+  802c3d:	5b                   	pop    %rbx
+  802c3e:	41 5c                	pop    %r12
+  802c40:	41 5d                	pop    %r13
+  802c42:	41 5e                	pop    %r14
+  802c44:	41 5f                	pop    %r15
+  802c46:	5d                   	pop    %rbp
+  802c47:	c3                   	ret
+            return res;
+  802c48:	48 98                	cltq
+  802c4a:	eb ed                	jmp    802c39 <devfile_write_direct+0xea>
+
+0000000000802c4c <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  802c4c:	55                   	push   %rbp
+  802c4d:	48 89 e5             	mov    %rsp,%rbp
+  802c50:	41 54                	push   %r12
+  802c52:	53                   	push   %rbx
+  802c53:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  802c56:	48 b8 ff 24 80 00 00 	movabs $0x8024ff,%rax
+  802c5d:	00 00 00 
+  802c60:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  802c62:	48 85 c0             	test   %rax,%rax
+  802c65:	74 71                	je     802cd8 <fbuf_flush+0x8c>
+  802c67:	48 89 c3             	mov    %rax,%rbx
+  802c6a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c6f:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  802c73:	75 05                	jne    802c7a <fbuf_flush+0x2e>
+}
+  802c75:	5b                   	pop    %rbx
+  802c76:	41 5c                	pop    %r12
+  802c78:	5d                   	pop    %rbp
+  802c79:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  802c7a:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  802c7d:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  802c81:	48 b8 00 23 83 00 00 	movabs $0x832300,%rax
+  802c88:	00 00 00 
+  802c8b:	48 89 de             	mov    %rbx,%rsi
+  802c8e:	48 29 c6             	sub    %rax,%rsi
+  802c91:	48 c1 fe 03          	sar    $0x3,%rsi
+  802c95:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802c9c:	aa aa aa 
+  802c9f:	48 0f af f0          	imul   %rax,%rsi
+  802ca3:	48 c1 e6 0e          	shl    $0xe,%rsi
+  802ca7:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802cac:	48 01 c6             	add    %rax,%rsi
+  802caf:	4c 89 e7             	mov    %r12,%rdi
+  802cb2:	48 b8 4f 2b 80 00 00 	movabs $0x802b4f,%rax
+  802cb9:	00 00 00 
+  802cbc:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  802cbe:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  802cc2:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802cc9:	00 
+    return res < 0 ? res : 0;
+  802cca:	48 85 c0             	test   %rax,%rax
+  802ccd:	ba 00 00 00 00       	mov    $0x0,%edx
+  802cd2:	48 0f 4f c2          	cmovg  %rdx,%rax
+  802cd6:	eb 9d                	jmp    802c75 <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  802cd8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cdd:	eb 96                	jmp    802c75 <fbuf_flush+0x29>
+
+0000000000802cdf <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  802cdf:	55                   	push   %rbp
+  802ce0:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  802ce3:	48 b8 4c 2c 80 00 00 	movabs $0x802c4c,%rax
+  802cea:	00 00 00 
+  802ced:	ff d0                	call   *%rax
+}
+  802cef:	5d                   	pop    %rbp
+  802cf0:	c3                   	ret
+
+0000000000802cf1 <devfile_write>:
+    if (!fd || !buf)
+  802cf1:	48 85 ff             	test   %rdi,%rdi
+  802cf4:	0f 84 d3 01 00 00    	je     802ecd <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802cfa:	55                   	push   %rbp
+  802cfb:	48 89 e5             	mov    %rsp,%rbp
+  802cfe:	41 57                	push   %r15
+  802d00:	41 56                	push   %r14
+  802d02:	41 55                	push   %r13
+  802d04:	41 54                	push   %r12
+  802d06:	53                   	push   %rbx
+  802d07:	48 83 ec 08          	sub    $0x8,%rsp
+  802d0b:	49 89 fc             	mov    %rdi,%r12
+  802d0e:	49 89 f6             	mov    %rsi,%r14
+  802d11:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  802d14:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802d19:	48 85 f6             	test   %rsi,%rsi
+  802d1c:	0f 84 9c 01 00 00    	je     802ebe <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  802d22:	48 b8 ff 24 80 00 00 	movabs $0x8024ff,%rax
+  802d29:	00 00 00 
+  802d2c:	ff d0                	call   *%rax
+  802d2e:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  802d31:	48 85 c0             	test   %rax,%rax
+  802d34:	0f 84 a2 00 00 00    	je     802ddc <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802d3a:	be 00 10 00 00       	mov    $0x1000,%esi
+  802d3f:	4c 89 e7             	mov    %r12,%rdi
+  802d42:	48 b8 70 16 80 00 00 	movabs $0x801670,%rax
+  802d49:	00 00 00 
+  802d4c:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  802d4e:	83 f8 02             	cmp    $0x2,%eax
+  802d51:	0f 8f 85 00 00 00    	jg     802ddc <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  802d57:	48 b8 00 23 83 00 00 	movabs $0x832300,%rax
+  802d5e:	00 00 00 
+  802d61:	4d 89 ef             	mov    %r13,%r15
+  802d64:	49 29 c7             	sub    %rax,%r15
+  802d67:	49 c1 ff 03          	sar    $0x3,%r15
+  802d6b:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802d72:	aa aa aa 
+  802d75:	4c 0f af f8          	imul   %rax,%r15
+  802d79:	49 c1 e7 0e          	shl    $0xe,%r15
+  802d7d:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802d82:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  802d85:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802d8a:	0f 84 d7 00 00 00    	je     802e67 <devfile_write+0x176>
+  802d90:	49 8b 45 10          	mov    0x10(%r13),%rax
+  802d94:	89 c2                	mov    %eax,%edx
+  802d96:	41 03 55 0c          	add    0xc(%r13),%edx
+  802d9a:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  802d9f:	75 0f                	jne    802db0 <devfile_write+0xbf>
+  802da1:	48 01 d8             	add    %rbx,%rax
+  802da4:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  802daa:	0f 86 92 00 00 00    	jbe    802e42 <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802db0:	4c 89 e7             	mov    %r12,%rdi
+  802db3:	48 b8 4c 2c 80 00 00 	movabs $0x802c4c,%rax
+  802dba:	00 00 00 
+  802dbd:	ff d0                	call   *%rax
+  802dbf:	85 c0                	test   %eax,%eax
+  802dc1:	78 52                	js     802e15 <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802dc3:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802dca:	77 7f                	ja     802e4b <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  802dcc:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802dd1:	0f 85 c2 00 00 00    	jne    802e99 <devfile_write+0x1a8>
+  802dd7:	e9 94 00 00 00       	jmp    802e70 <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  802ddc:	4c 89 e7             	mov    %r12,%rdi
+  802ddf:	48 b8 4c 2c 80 00 00 	movabs $0x802c4c,%rax
+  802de6:	00 00 00 
+  802de9:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802deb:	85 c0                	test   %eax,%eax
+  802ded:	79 07                	jns    802df6 <devfile_write+0x105>
+  802def:	48 98                	cltq
+  802df1:	e9 c8 00 00 00       	jmp    802ebe <devfile_write+0x1cd>
+  802df6:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802dfb:	48 89 da             	mov    %rbx,%rdx
+  802dfe:	4c 89 f6             	mov    %r14,%rsi
+  802e01:	4c 89 e7             	mov    %r12,%rdi
+  802e04:	48 b8 4f 2b 80 00 00 	movabs $0x802b4f,%rax
+  802e0b:	00 00 00 
+  802e0e:	ff d0                	call   *%rax
+  802e10:	e9 a9 00 00 00       	jmp    802ebe <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802e15:	48 98                	cltq
+  802e17:	e9 a2 00 00 00       	jmp    802ebe <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802e1c:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802e21:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802e26:	4c 89 fe             	mov    %r15,%rsi
+  802e29:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e2e:	48 b8 ab 16 80 00 00 	movabs $0x8016ab,%rax
+  802e35:	00 00 00 
+  802e38:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  802e3a:	85 c0                	test   %eax,%eax
+  802e3c:	79 45                	jns    802e83 <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802e3e:	48 98                	cltq
+  802e40:	eb 7c                	jmp    802ebe <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802e42:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802e49:	76 4e                	jbe    802e99 <devfile_write+0x1a8>
+  802e4b:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802e50:	48 89 da             	mov    %rbx,%rdx
+  802e53:	4c 89 f6             	mov    %r14,%rsi
+  802e56:	4c 89 e7             	mov    %r12,%rdi
+  802e59:	48 b8 4f 2b 80 00 00 	movabs $0x802b4f,%rax
+  802e60:	00 00 00 
+  802e63:	ff d0                	call   *%rax
+  802e65:	eb 57                	jmp    802ebe <devfile_write+0x1cd>
+  802e67:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802e6e:	77 db                	ja     802e4b <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  802e70:	4c 89 ff             	mov    %r15,%rdi
+  802e73:	48 b8 19 45 80 00 00 	movabs $0x804519,%rax
+  802e7a:	00 00 00 
+  802e7d:	ff d0                	call   *%rax
+  802e7f:	84 c0                	test   %al,%al
+  802e81:	74 99                	je     802e1c <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  802e83:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  802e88:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802e8d:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  802e91:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  802e98:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  802e99:	4c 89 ff             	mov    %r15,%rdi
+  802e9c:	49 03 7d 10          	add    0x10(%r13),%rdi
+  802ea0:	48 89 da             	mov    %rbx,%rdx
+  802ea3:	4c 89 f6             	mov    %r14,%rsi
+  802ea6:	48 b8 ad 13 80 00 00 	movabs $0x8013ad,%rax
+  802ead:	00 00 00 
+  802eb0:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  802eb2:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  802eb6:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  802ebb:	48 89 d8             	mov    %rbx,%rax
+}
+  802ebe:	48 83 c4 08          	add    $0x8,%rsp
+  802ec2:	5b                   	pop    %rbx
+  802ec3:	41 5c                	pop    %r12
+  802ec5:	41 5d                	pop    %r13
+  802ec7:	41 5e                	pop    %r14
+  802ec9:	41 5f                	pop    %r15
+  802ecb:	5d                   	pop    %rbp
+  802ecc:	c3                   	ret
+        return E_INVAL;
+  802ecd:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802ed2:	c3                   	ret
+
+0000000000802ed3 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802ed3:	55                   	push   %rbp
+  802ed4:	48 89 e5             	mov    %rsp,%rbp
+  802ed7:	41 54                	push   %r12
+  802ed9:	53                   	push   %rbx
+  802eda:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  802edd:	48 b8 4c 2c 80 00 00 	movabs $0x802c4c,%rax
+  802ee4:	00 00 00 
+  802ee7:	ff d0                	call   *%rax
+  802ee9:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  802eec:	48 89 df             	mov    %rbx,%rdi
+  802eef:	48 b8 ff 24 80 00 00 	movabs $0x8024ff,%rax
+  802ef6:	00 00 00 
+  802ef9:	ff d0                	call   *%rax
+  802efb:	48 85 c0             	test   %rax,%rax
+  802efe:	74 17                	je     802f17 <devfile_flush+0x44>
+  802f00:	48 89 df             	mov    %rbx,%rdi
+  802f03:	48 b8 ff 24 80 00 00 	movabs $0x8024ff,%rax
+  802f0a:	00 00 00 
+  802f0d:	ff d0                	call   *%rax
+  802f0f:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  802f16:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802f17:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802f1a:	a3 00 00 84 00 00 00 	movabs %eax,0x840000
+  802f21:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  802f23:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f28:	be 00 00 00 00       	mov    $0x0,%esi
+  802f2d:	bf 06 00 00 00       	mov    $0x6,%edi
+  802f32:	48 b8 e3 29 80 00 00 	movabs $0x8029e3,%rax
+  802f39:	00 00 00 
+  802f3c:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802f3e:	45 85 e4             	test   %r12d,%r12d
+  802f41:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802f45:	5b                   	pop    %rbx
+  802f46:	41 5c                	pop    %r12
+  802f48:	5d                   	pop    %rbp
+  802f49:	c3                   	ret
+
+0000000000802f4a <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  802f4a:	55                   	push   %rbp
+  802f4b:	48 89 e5             	mov    %rsp,%rbp
+  802f4e:	41 57                	push   %r15
+  802f50:	41 56                	push   %r14
+  802f52:	41 55                	push   %r13
+  802f54:	41 54                	push   %r12
+  802f56:	53                   	push   %rbx
+  802f57:	48 83 ec 38          	sub    $0x38,%rsp
+  802f5b:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  802f5f:	49 89 f7             	mov    %rsi,%r15
+  802f62:	48 89 d3             	mov    %rdx,%rbx
+  802f65:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  802f68:	48 b8 95 24 80 00 00 	movabs $0x802495,%rax
+  802f6f:	00 00 00 
+  802f72:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802f74:	48 85 c0             	test   %rax,%rax
+  802f77:	75 20                	jne    802f99 <devfile_read_direct+0x4f>
+    bool map = 1;
+  802f79:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  802f7e:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802f85:	00 
+    while (n) {
+  802f86:	48 85 db             	test   %rbx,%rbx
+  802f89:	0f 85 df 00 00 00    	jne    80306e <devfile_read_direct+0x124>
+    size_t read = 0;
+  802f8f:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  802f93:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802f97:	eb 21                	jmp    802fba <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802f99:	45 89 f1             	mov    %r14d,%r9d
+  802f9c:	49 89 d8             	mov    %rbx,%r8
+  802f9f:	4c 89 f9             	mov    %r15,%rcx
+  802fa2:	ba 03 00 00 00       	mov    $0x3,%edx
+  802fa7:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802fab:	48 89 c7             	mov    %rax,%rdi
+  802fae:	48 b8 7c 25 80 00 00 	movabs $0x80257c,%rax
+  802fb5:	00 00 00 
+  802fb8:	ff d0                	call   *%rax
+}
+  802fba:	48 83 c4 38          	add    $0x38,%rsp
+  802fbe:	5b                   	pop    %rbx
+  802fbf:	41 5c                	pop    %r12
+  802fc1:	41 5d                	pop    %r13
+  802fc3:	41 5e                	pop    %r14
+  802fc5:	41 5f                	pop    %r15
+  802fc7:	5d                   	pop    %rbp
+  802fc8:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802fc9:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802fcd:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802fd3:	75 1e                	jne    802ff3 <devfile_read_direct+0xa9>
+  802fd5:	e9 e2 00 00 00       	jmp    8030bc <devfile_read_direct+0x172>
+            if (!res) return read;
+  802fda:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802fde:	eb da                	jmp    802fba <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  802fe0:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  802fe4:	0f 85 d0 01 00 00    	jne    8031ba <devfile_read_direct+0x270>
+            map = 0;
+  802fea:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802fee:	eb 03                	jmp    802ff3 <devfile_read_direct+0xa9>
+  802ff0:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802ff3:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802ff8:	48 39 d3             	cmp    %rdx,%rbx
+  802ffb:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802fff:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803003:	8b 40 0c             	mov    0xc(%rax),%eax
+  803006:	48 b9 00 00 84 00 00 	movabs $0x840000,%rcx
+  80300d:	00 00 00 
+  803010:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  803012:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  803016:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  80301a:	be 00 00 00 00       	mov    $0x0,%esi
+  80301f:	bf 03 00 00 00       	mov    $0x3,%edi
+  803024:	48 b8 e3 29 80 00 00 	movabs $0x8029e3,%rax
+  80302b:	00 00 00 
+  80302e:	ff d0                	call   *%rax
+        if (res <= 0)
+  803030:	85 c0                	test   %eax,%eax
+  803032:	0f 8e 63 01 00 00    	jle    80319b <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  803038:	4c 63 e0             	movslq %eax,%r12
+  80303b:	4c 89 e2             	mov    %r12,%rdx
+  80303e:	48 be 00 10 84 00 00 	movabs $0x841000,%rsi
+  803045:	00 00 00 
+  803048:	4c 89 ff             	mov    %r15,%rdi
+  80304b:	48 b8 ad 13 80 00 00 	movabs $0x8013ad,%rax
+  803052:	00 00 00 
+  803055:	ff d0                	call   *%rax
+        buf += res;
+  803057:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  80305a:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  80305d:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  803061:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  803065:	48 85 db             	test   %rbx,%rbx
+  803068:	0f 84 25 ff ff ff    	je     802f93 <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  80306e:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  803071:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  803075:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  803079:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  80307d:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  803084:	0f 97 c2             	seta   %dl
+  803087:	20 c2                	and    %al,%dl
+  803089:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  80308c:	0f 84 5e ff ff ff    	je     802ff0 <devfile_read_direct+0xa6>
+  803092:	4c 89 fa             	mov    %r15,%rdx
+  803095:	4d 89 fd             	mov    %r15,%r13
+  803098:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  80309f:	0f 85 4e ff ff ff    	jne    802ff3 <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  8030a5:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8030a9:	0f 84 1a ff ff ff    	je     802fc9 <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  8030af:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  8030b6:	0f 85 37 ff ff ff    	jne    802ff3 <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  8030bc:	48 89 d8             	mov    %rbx,%rax
+  8030bf:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8030c5:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  8030ca:	48 39 c8             	cmp    %rcx,%rax
+  8030cd:	48 0f 47 c1          	cmova  %rcx,%rax
+  8030d1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  8030d5:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  8030d9:	49 89 d4             	mov    %rdx,%r12
+  8030dc:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  8030e0:	48 b8 ba 44 80 00 00 	movabs $0x8044ba,%rax
+  8030e7:	00 00 00 
+  8030ea:	ff d0                	call   *%rax
+  8030ec:	a8 40                	test   $0x40,%al
+  8030ee:	0f 85 b9 00 00 00    	jne    8031ad <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  8030f4:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  8030fb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8030ff:	49 39 c5             	cmp    %rax,%r13
+  803102:	72 d8                	jb     8030dc <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803104:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  803108:	48 ba 00 00 84 00 00 	movabs $0x840000,%rdx
+  80310f:	00 00 00 
+  803112:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  803116:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  803119:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  80311b:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  80311f:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  803123:	48 b8 30 23 80 00 00 	movabs $0x802330,%rax
+  80312a:	00 00 00 
+  80312d:	ff d0                	call   *%rax
+  80312f:	89 c7                	mov    %eax,%edi
+  803131:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  803137:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80313c:	48 ba 00 00 84 00 00 	movabs $0x840000,%rdx
+  803143:	00 00 00 
+  803146:	be 0e 00 00 00       	mov    $0xe,%esi
+  80314b:	48 b8 c7 4d 80 00 00 	movabs $0x804dc7,%rax
+  803152:	00 00 00 
+  803155:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  803157:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80315c:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  803160:	4c 89 fe             	mov    %r15,%rsi
+  803163:	bf 00 00 00 00       	mov    $0x0,%edi
+  803168:	48 b8 a3 4d 80 00 00 	movabs $0x804da3,%rax
+  80316f:	00 00 00 
+  803172:	ff d0                	call   *%rax
+  803174:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  803177:	48 85 d2             	test   %rdx,%rdx
+  80317a:	0f 84 5a fe ff ff    	je     802fda <devfile_read_direct+0x90>
+            if (res > 0) {
+  803180:	0f 8e 5a fe ff ff    	jle    802fe0 <devfile_read_direct+0x96>
+                buf += res;
+  803186:	48 98                	cltq
+  803188:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  80318b:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  80318e:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  803192:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  803196:	e9 ca fe ff ff       	jmp    803065 <devfile_read_direct+0x11b>
+            return res ? res : read;
+  80319b:	41 89 c5             	mov    %eax,%r13d
+  80319e:	48 98                	cltq
+  8031a0:	45 85 ed             	test   %r13d,%r13d
+  8031a3:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  8031a8:	e9 0d fe ff ff       	jmp    802fba <devfile_read_direct+0x70>
+            map = 0;
+  8031ad:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  8031b1:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  8031b5:	e9 39 fe ff ff       	jmp    802ff3 <devfile_read_direct+0xa9>
+  8031ba:	48 89 d0             	mov    %rdx,%rax
+  8031bd:	e9 f8 fd ff ff       	jmp    802fba <devfile_read_direct+0x70>
+
+00000000008031c2 <devfile_read>:
+    if (!fd || !buf)
+  8031c2:	48 85 ff             	test   %rdi,%rdi
+  8031c5:	0f 84 21 02 00 00    	je     8033ec <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8031cb:	55                   	push   %rbp
+  8031cc:	48 89 e5             	mov    %rsp,%rbp
+  8031cf:	41 57                	push   %r15
+  8031d1:	41 56                	push   %r14
+  8031d3:	41 55                	push   %r13
+  8031d5:	41 54                	push   %r12
+  8031d7:	53                   	push   %rbx
+  8031d8:	48 83 ec 28          	sub    $0x28,%rsp
+  8031dc:	48 89 fb             	mov    %rdi,%rbx
+  8031df:	49 89 f4             	mov    %rsi,%r12
+  8031e2:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  8031e5:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  8031ea:	48 85 f6             	test   %rsi,%rsi
+  8031ed:	74 4b                	je     80323a <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  8031ef:	48 b8 ff 24 80 00 00 	movabs $0x8024ff,%rax
+  8031f6:	00 00 00 
+  8031f9:	ff d0                	call   *%rax
+  8031fb:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  8031fe:	48 85 c0             	test   %rax,%rax
+  803201:	74 22                	je     803225 <devfile_read+0x63>
+  803203:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  80320a:	77 19                	ja     803225 <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  80320c:	be 00 10 00 00       	mov    $0x1000,%esi
+  803211:	48 89 df             	mov    %rbx,%rdi
+  803214:	48 b8 70 16 80 00 00 	movabs $0x801670,%rax
+  80321b:	00 00 00 
+  80321e:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  803220:	83 f8 02             	cmp    $0x2,%eax
+  803223:	7e 40                	jle    803265 <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  803225:	48 89 df             	mov    %rbx,%rdi
+  803228:	48 b8 4c 2c 80 00 00 	movabs $0x802c4c,%rax
+  80322f:	00 00 00 
+  803232:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  803234:	85 c0                	test   %eax,%eax
+  803236:	79 11                	jns    803249 <devfile_read+0x87>
+  803238:	48 98                	cltq
+}
+  80323a:	48 83 c4 28          	add    $0x28,%rsp
+  80323e:	5b                   	pop    %rbx
+  80323f:	41 5c                	pop    %r12
+  803241:	41 5d                	pop    %r13
+  803243:	41 5e                	pop    %r14
+  803245:	41 5f                	pop    %r15
+  803247:	5d                   	pop    %rbp
+  803248:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  803249:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  80324e:	4c 89 ea             	mov    %r13,%rdx
+  803251:	4c 89 e6             	mov    %r12,%rsi
+  803254:	48 89 df             	mov    %rbx,%rdi
+  803257:	48 b8 4a 2f 80 00 00 	movabs $0x802f4a,%rax
+  80325e:	00 00 00 
+  803261:	ff d0                	call   *%rax
+  803263:	eb d5                	jmp    80323a <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  803265:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  803269:	48 89 df             	mov    %rbx,%rdi
+  80326c:	48 b8 4c 2c 80 00 00 	movabs $0x802c4c,%rax
+  803273:	00 00 00 
+  803276:	ff d0                	call   *%rax
+  803278:	85 c0                	test   %eax,%eax
+  80327a:	0f 88 33 01 00 00    	js     8033b3 <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  803280:	48 ba 00 23 83 00 00 	movabs $0x832300,%rdx
+  803287:	00 00 00 
+  80328a:	4c 89 f0             	mov    %r14,%rax
+  80328d:	48 29 d0             	sub    %rdx,%rax
+  803290:	48 c1 f8 03          	sar    $0x3,%rax
+  803294:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  80329b:	aa aa aa 
+  80329e:	48 0f af c2          	imul   %rdx,%rax
+  8032a2:	48 c1 e0 0e          	shl    $0xe,%rax
+  8032a6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  8032aa:	8b 43 0c             	mov    0xc(%rbx),%eax
+  8032ad:	41 39 06             	cmp    %eax,(%r14)
+  8032b0:	75 0d                	jne    8032bf <devfile_read+0xfd>
+  8032b2:	8b 43 10             	mov    0x10(%rbx),%eax
+  8032b5:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  8032b9:	0f 84 fb 00 00 00    	je     8033ba <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  8032bf:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  8032c4:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8032c8:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  8032cb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8032cf:	48 89 c7             	mov    %rax,%rdi
+  8032d2:	48 b8 19 45 80 00 00 	movabs $0x804519,%rax
+  8032d9:	00 00 00 
+  8032dc:	ff d0                	call   *%rax
+  8032de:	84 c0                	test   %al,%al
+  8032e0:	75 27                	jne    803309 <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8032e2:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8032e7:	ba 00 40 00 00       	mov    $0x4000,%edx
+  8032ec:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8032f0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032f5:	48 b8 ab 16 80 00 00 	movabs $0x8016ab,%rax
+  8032fc:	00 00 00 
+  8032ff:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  803301:	85 c0                	test   %eax,%eax
+  803303:	0f 88 dc 00 00 00    	js     8033e5 <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  803309:	44 89 f8             	mov    %r15d,%eax
+  80330c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  803311:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  803313:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  80331a:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  80331b:	8b 43 10             	mov    0x10(%rbx),%eax
+  80331e:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  803322:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  803325:	ba 00 40 00 00       	mov    $0x4000,%edx
+  80332a:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80332e:	48 89 df             	mov    %rbx,%rdi
+  803331:	48 b8 4a 2f 80 00 00 	movabs $0x802f4a,%rax
+  803338:	00 00 00 
+  80333b:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  80333d:	48 85 c0             	test   %rax,%rax
+  803340:	0f 88 f4 fe ff ff    	js     80323a <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  803346:	8b 53 0c             	mov    0xc(%rbx),%edx
+  803349:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  80334c:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  80334f:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  803353:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  803357:	48 63 d1             	movslq %ecx,%rdx
+  80335a:	48 01 d0             	add    %rdx,%rax
+  80335d:	4d 63 ff             	movslq %r15d,%r15
+  803360:	4c 29 f8             	sub    %r15,%rax
+  803363:	ba 00 00 00 00       	mov    $0x0,%edx
+  803368:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  80336c:	48 85 c0             	test   %rax,%rax
+  80336f:	0f 8e c5 fe ff ff    	jle    80323a <devfile_read+0x78>
+    n = MIN(n, res);
+  803375:	4c 39 e8             	cmp    %r13,%rax
+  803378:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  80337c:	8b 73 04             	mov    0x4(%rbx),%esi
+  80337f:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  803383:	48 63 f6             	movslq %esi,%rsi
+  803386:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  80338b:	48 01 c6             	add    %rax,%rsi
+  80338e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803392:	48 01 c6             	add    %rax,%rsi
+  803395:	4c 89 ea             	mov    %r13,%rdx
+  803398:	4c 89 e7             	mov    %r12,%rdi
+  80339b:	48 b8 ad 13 80 00 00 	movabs $0x8013ad,%rax
+  8033a2:	00 00 00 
+  8033a5:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  8033a7:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  8033ab:	4c 89 e8             	mov    %r13,%rax
+  8033ae:	e9 87 fe ff ff       	jmp    80323a <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  8033b3:	48 98                	cltq
+  8033b5:	e9 80 fe ff ff       	jmp    80323a <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  8033ba:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  8033be:	41 39 d7             	cmp    %edx,%r15d
+  8033c1:	0f 8c f8 fe ff ff    	jl     8032bf <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  8033c7:	49 8b 46 10          	mov    0x10(%r14),%rax
+  8033cb:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  8033ce:	41 39 cf             	cmp    %ecx,%r15d
+  8033d1:	0f 8d e8 fe ff ff    	jge    8032bf <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  8033d7:	4d 63 ff             	movslq %r15d,%r15
+  8033da:	4c 29 f8             	sub    %r15,%rax
+  8033dd:	48 63 d2             	movslq %edx,%rdx
+  8033e0:	48 01 d0             	add    %rdx,%rax
+  8033e3:	eb 87                	jmp    80336c <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8033e5:	48 98                	cltq
+  8033e7:	e9 4e fe ff ff       	jmp    80323a <devfile_read+0x78>
+        return E_INVAL;
+  8033ec:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  8033f1:	c3                   	ret
+
+00000000008033f2 <fs_channel>:
+fs_channel(bool enable) {
+  8033f2:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  8033f4:	a2 04 26 83 00 00 00 	movabs %al,0x832604
+  8033fb:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  8033fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  803402:	40 84 ff             	test   %dil,%dil
+  803405:	74 47                	je     80344e <fs_channel+0x5c>
+  803407:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  80340e:	00 00 00 
+  803411:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  803417:	48 b8 00 26 83 00 00 	movabs $0x832600,%rax
+  80341e:	00 00 00 
+  803421:	3b 08                	cmp    (%rax),%ecx
+  803423:	74 29                	je     80344e <fs_channel+0x5c>
+fs_channel(bool enable) {
+  803425:	55                   	push   %rbp
+  803426:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  803429:	48 b8 72 23 80 00 00 	movabs $0x802372,%rax
+  803430:	00 00 00 
+  803433:	ff d0                	call   *%rax
+  803435:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  803437:	85 c0                	test   %eax,%eax
+  803439:	78 04                	js     80343f <fs_channel+0x4d>
+}
+  80343b:	89 d0                	mov    %edx,%eax
+  80343d:	5d                   	pop    %rbp
+  80343e:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  80343f:	48 b8 04 26 83 00 00 	movabs $0x832604,%rax
+  803446:	00 00 00 
+  803449:	c6 00 00             	movb   $0x0,(%rax)
+  80344c:	eb ed                	jmp    80343b <fs_channel+0x49>
+}
+  80344e:	89 d0                	mov    %edx,%eax
+  803450:	c3                   	ret
+
+0000000000803451 <open>:
+open(const char *path, int mode) {
+  803451:	55                   	push   %rbp
+  803452:	48 89 e5             	mov    %rsp,%rbp
+  803455:	41 55                	push   %r13
+  803457:	41 54                	push   %r12
+  803459:	53                   	push   %rbx
+  80345a:	48 83 ec 18          	sub    $0x18,%rsp
+  80345e:	49 89 fc             	mov    %rdi,%r12
+  803461:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803464:	48 b8 0e 11 80 00 00 	movabs $0x80110e,%rax
+  80346b:	00 00 00 
+  80346e:	ff d0                	call   *%rax
+  803470:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803476:	0f 87 8f 00 00 00    	ja     80350b <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80347c:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803480:	48 b8 2c 1c 80 00 00 	movabs $0x801c2c,%rax
+  803487:	00 00 00 
+  80348a:	ff d0                	call   *%rax
+  80348c:	89 c3                	mov    %eax,%ebx
+  80348e:	85 c0                	test   %eax,%eax
+  803490:	78 55                	js     8034e7 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  803492:	4c 89 e6             	mov    %r12,%rsi
+  803495:	48 bb 00 00 84 00 00 	movabs $0x840000,%rbx
+  80349c:	00 00 00 
+  80349f:	48 89 df             	mov    %rbx,%rdi
+  8034a2:	48 b8 4c 11 80 00 00 	movabs $0x80114c,%rax
+  8034a9:	00 00 00 
+  8034ac:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8034ae:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  8034b5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8034ba:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8034be:	bf 01 00 00 00       	mov    $0x1,%edi
+  8034c3:	48 b8 e3 29 80 00 00 	movabs $0x8029e3,%rax
+  8034ca:	00 00 00 
+  8034cd:	ff d0                	call   *%rax
+  8034cf:	89 c3                	mov    %eax,%ebx
+  8034d1:	85 c0                	test   %eax,%eax
+  8034d3:	78 1f                	js     8034f4 <open+0xa3>
+    return fd2num(fd);
+  8034d5:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8034d9:	48 b8 fe 1b 80 00 00 	movabs $0x801bfe,%rax
+  8034e0:	00 00 00 
+  8034e3:	ff d0                	call   *%rax
+  8034e5:	89 c3                	mov    %eax,%ebx
+}
+  8034e7:	89 d8                	mov    %ebx,%eax
+  8034e9:	48 83 c4 18          	add    $0x18,%rsp
+  8034ed:	5b                   	pop    %rbx
+  8034ee:	41 5c                	pop    %r12
+  8034f0:	41 5d                	pop    %r13
+  8034f2:	5d                   	pop    %rbp
+  8034f3:	c3                   	ret
+        fd_close(fd, 0);
+  8034f4:	be 00 00 00 00       	mov    $0x0,%esi
+  8034f9:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8034fd:	48 b8 47 1d 80 00 00 	movabs $0x801d47,%rax
+  803504:	00 00 00 
+  803507:	ff d0                	call   *%rax
+        return res;
+  803509:	eb dc                	jmp    8034e7 <open+0x96>
+        return -E_BAD_PATH;
+  80350b:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803510:	eb d5                	jmp    8034e7 <open+0x96>
+
+0000000000803512 <file_flush_buffers>:
+file_flush_buffers(void) {
+  803512:	55                   	push   %rbp
+  803513:	48 89 e5             	mov    %rsp,%rbp
+  803516:	41 56                	push   %r14
+  803518:	41 55                	push   %r13
+  80351a:	41 54                	push   %r12
+  80351c:	53                   	push   %rbx
+  80351d:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  803521:	49 bc 08 23 83 00 00 	movabs $0x832308,%r12
+  803528:	00 00 00 
+  80352b:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  803530:	49 bd 8c 1c 80 00 00 	movabs $0x801c8c,%r13
+  803537:	00 00 00 
+  80353a:	49 be 4c 2c 80 00 00 	movabs $0x802c4c,%r14
+  803541:	00 00 00 
+  803544:	eb 0c                	jmp    803552 <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  803546:	83 c3 01             	add    $0x1,%ebx
+  803549:	49 83 c4 18          	add    $0x18,%r12
+  80354d:	83 fb 20             	cmp    $0x20,%ebx
+  803550:	74 1d                	je     80356f <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  803552:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  803557:	74 ed                	je     803546 <file_flush_buffers+0x34>
+  803559:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80355d:	89 df                	mov    %ebx,%edi
+  80355f:	41 ff d5             	call   *%r13
+  803562:	85 c0                	test   %eax,%eax
+  803564:	78 e0                	js     803546 <file_flush_buffers+0x34>
+  803566:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80356a:	41 ff d6             	call   *%r14
+  80356d:	eb d7                	jmp    803546 <file_flush_buffers+0x34>
+}
+  80356f:	48 83 c4 10          	add    $0x10,%rsp
+  803573:	5b                   	pop    %rbx
+  803574:	41 5c                	pop    %r12
+  803576:	41 5d                	pop    %r13
+  803578:	41 5e                	pop    %r14
+  80357a:	5d                   	pop    %rbp
+  80357b:	c3                   	ret
+
+000000000080357c <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80357c:	55                   	push   %rbp
+  80357d:	48 89 e5             	mov    %rsp,%rbp
+  803580:	41 54                	push   %r12
+  803582:	53                   	push   %rbx
+  803583:	49 89 fc             	mov    %rdi,%r12
+  803586:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  803588:	48 b8 12 35 80 00 00 	movabs $0x803512,%rax
+  80358f:	00 00 00 
+  803592:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  803594:	48 b8 00 00 84 00 00 	movabs $0x840000,%rax
+  80359b:	00 00 00 
+  80359e:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  8035a3:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  8035a5:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  8035a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8035b2:	bf 02 00 00 00       	mov    $0x2,%edi
+  8035b7:	48 b8 e3 29 80 00 00 	movabs $0x8029e3,%rax
+  8035be:	00 00 00 
+  8035c1:	ff d0                	call   *%rax
+}
+  8035c3:	5b                   	pop    %rbx
+  8035c4:	41 5c                	pop    %r12
+  8035c6:	5d                   	pop    %rbp
+  8035c7:	c3                   	ret
+
+00000000008035c8 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8035c8:	55                   	push   %rbp
+  8035c9:	48 89 e5             	mov    %rsp,%rbp
+  8035cc:	41 54                	push   %r12
+  8035ce:	53                   	push   %rbx
+  8035cf:	49 89 fc             	mov    %rdi,%r12
+  8035d2:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  8035d5:	48 b8 12 35 80 00 00 	movabs $0x803512,%rax
+  8035dc:	00 00 00 
+  8035df:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8035e1:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  8035e6:	a3 00 00 84 00 00 00 	movabs %eax,0x840000
+  8035ed:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  8035ef:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035f4:	be 00 00 00 00       	mov    $0x0,%esi
+  8035f9:	bf 05 00 00 00       	mov    $0x5,%edi
+  8035fe:	48 b8 e3 29 80 00 00 	movabs $0x8029e3,%rax
+  803605:	00 00 00 
+  803608:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80360a:	85 c0                	test   %eax,%eax
+  80360c:	78 3d                	js     80364b <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80360e:	49 bc 00 00 84 00 00 	movabs $0x840000,%r12
+  803615:	00 00 00 
+  803618:	4c 89 e6             	mov    %r12,%rsi
+  80361b:	48 89 df             	mov    %rbx,%rdi
+  80361e:	48 b8 4c 11 80 00 00 	movabs $0x80114c,%rax
+  803625:	00 00 00 
+  803628:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80362a:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  803631:	00 
+  803632:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803638:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  80363f:	00 
+  803640:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  803646:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80364b:	5b                   	pop    %rbx
+  80364c:	41 5c                	pop    %r12
+  80364e:	5d                   	pop    %rbp
+  80364f:	c3                   	ret
+
+0000000000803650 <remove>:
+remove(const char *path) {
+  803650:	55                   	push   %rbp
+  803651:	48 89 e5             	mov    %rsp,%rbp
+  803654:	53                   	push   %rbx
+  803655:	48 83 ec 08          	sub    $0x8,%rsp
+  803659:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  80365c:	48 b8 0e 11 80 00 00 	movabs $0x80110e,%rax
+  803663:	00 00 00 
+  803666:	ff d0                	call   *%rax
+  803668:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80366e:	77 3a                	ja     8036aa <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  803670:	48 89 de             	mov    %rbx,%rsi
+  803673:	48 bf 00 00 84 00 00 	movabs $0x840000,%rdi
+  80367a:	00 00 00 
+  80367d:	48 b8 4c 11 80 00 00 	movabs $0x80114c,%rax
+  803684:	00 00 00 
+  803687:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  803689:	ba 00 00 00 00       	mov    $0x0,%edx
+  80368e:	be 00 00 00 00       	mov    $0x0,%esi
+  803693:	bf 07 00 00 00       	mov    $0x7,%edi
+  803698:	48 b8 e3 29 80 00 00 	movabs $0x8029e3,%rax
+  80369f:	00 00 00 
+  8036a2:	ff d0                	call   *%rax
+}
+  8036a4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8036a8:	c9                   	leave
+  8036a9:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  8036aa:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8036af:	eb f3                	jmp    8036a4 <remove+0x54>
+
+00000000008036b1 <sync>:
+sync(void) {
+  8036b1:	55                   	push   %rbp
+  8036b2:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  8036b5:	48 b8 12 35 80 00 00 	movabs $0x803512,%rax
+  8036bc:	00 00 00 
+  8036bf:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  8036c1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8036c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8036cb:	bf 08 00 00 00       	mov    $0x8,%edi
+  8036d0:	48 b8 e3 29 80 00 00 	movabs $0x8029e3,%rax
+  8036d7:	00 00 00 
+  8036da:	ff d0                	call   *%rax
+}
+  8036dc:	5d                   	pop    %rbp
+  8036dd:	c3                   	ret
+
+00000000008036de <fsync>:
+fsync(int fdnum) {
+  8036de:	55                   	push   %rbp
+  8036df:	48 89 e5             	mov    %rsp,%rbp
+  8036e2:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8036e6:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8036ea:	48 b8 8c 1c 80 00 00 	movabs $0x801c8c,%rax
+  8036f1:	00 00 00 
+  8036f4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8036f6:	85 c0                	test   %eax,%eax
+  8036f8:	78 4b                	js     803745 <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8036fa:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8036fe:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  803705:	00 00 00 
+  803708:	8b 00                	mov    (%rax),%eax
+  80370a:	39 02                	cmp    %eax,(%rdx)
+  80370c:	75 39                	jne    803747 <fsync+0x69>
+    file_flush_buffers();
+  80370e:	48 b8 12 35 80 00 00 	movabs $0x803512,%rax
+  803715:	00 00 00 
+  803718:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  80371a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80371e:	8b 40 0c             	mov    0xc(%rax),%eax
+  803721:	a3 00 00 84 00 00 00 	movabs %eax,0x840000
+  803728:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  80372a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80372f:	be 00 00 00 00       	mov    $0x0,%esi
+  803734:	bf 0d 00 00 00       	mov    $0xd,%edi
+  803739:	48 b8 e3 29 80 00 00 	movabs $0x8029e3,%rax
+  803740:	00 00 00 
+  803743:	ff d0                	call   *%rax
+}
+  803745:	c9                   	leave
+  803746:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803747:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80374c:	eb f7                	jmp    803745 <fsync+0x67>
+
+000000000080374e <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  80374e:	55                   	push   %rbp
+  80374f:	48 89 e5             	mov    %rsp,%rbp
+  803752:	53                   	push   %rbx
+  803753:	48 83 ec 08          	sub    $0x8,%rsp
+  803757:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  80375a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80375f:	be 00 00 00 00       	mov    $0x0,%esi
+  803764:	bf 0b 00 00 00       	mov    $0xb,%edi
+  803769:	48 b8 e3 29 80 00 00 	movabs $0x8029e3,%rax
+  803770:	00 00 00 
+  803773:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803775:	85 c0                	test   %eax,%eax
+  803777:	78 2d                	js     8037a6 <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  803779:	48 b8 00 00 84 00 00 	movabs $0x840000,%rax
+  803780:	00 00 00 
+  803783:	48 8b 10             	mov    (%rax),%rdx
+  803786:	48 89 13             	mov    %rdx,(%rbx)
+  803789:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80378d:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  803791:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803795:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  803799:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80379d:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  8037a1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8037a6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8037aa:	c9                   	leave
+  8037ab:	c3                   	ret
+
+00000000008037ac <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  8037ac:	55                   	push   %rbp
+  8037ad:	48 89 e5             	mov    %rsp,%rbp
+  8037b0:	53                   	push   %rbx
+  8037b1:	48 83 ec 08          	sub    $0x8,%rsp
+  8037b5:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  8037b8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8037bd:	be 00 00 00 00       	mov    $0x0,%esi
+  8037c2:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8037c7:	48 b8 e3 29 80 00 00 	movabs $0x8029e3,%rax
+  8037ce:	00 00 00 
+  8037d1:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8037d3:	85 c0                	test   %eax,%eax
+  8037d5:	78 3d                	js     803814 <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  8037d7:	48 b8 00 00 84 00 00 	movabs $0x840000,%rax
+  8037de:	00 00 00 
+  8037e1:	48 8b 10             	mov    (%rax),%rdx
+  8037e4:	48 89 13             	mov    %rdx,(%rbx)
+  8037e7:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8037eb:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  8037ef:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8037f3:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  8037f7:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  8037fb:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  8037ff:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  803803:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  803807:	48 8b 40 28          	mov    0x28(%rax),%rax
+  80380b:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  80380f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803814:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803818:	c9                   	leave
+  803819:	c3                   	ret
+
+000000000080381a <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  80381a:	55                   	push   %rbp
+  80381b:	48 89 e5             	mov    %rsp,%rbp
+  80381e:	41 57                	push   %r15
+  803820:	41 56                	push   %r14
+  803822:	41 55                	push   %r13
+  803824:	41 54                	push   %r12
+  803826:	53                   	push   %rbx
+  803827:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  80382b:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  803832:	00 
+  803833:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  80383a:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  803840:	0f 85 43 01 00 00    	jne    803989 <munmap+0x16f>
+  803846:	49 89 ff             	mov    %rdi,%r15
+  803849:	4c 39 f7             	cmp    %r14,%rdi
+  80384c:	0f 87 37 01 00 00    	ja     803989 <munmap+0x16f>
+  803852:	48 bb 00 20 83 00 00 	movabs $0x832000,%rbx
+  803859:	00 00 00 
+  80385c:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  803862:	eb 2c                	jmp    803890 <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  803864:	4c 39 f8             	cmp    %r15,%rax
+  803867:	0f 83 85 00 00 00    	jae    8038f2 <munmap+0xd8>
+            m->mm_end = start;
+  80386d:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  803872:	48 83 c3 18          	add    $0x18,%rbx
+  803876:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  80387d:	48 b8 00 23 83 00 00 	movabs $0x832300,%rax
+  803884:	00 00 00 
+  803887:	48 39 c3             	cmp    %rax,%rbx
+  80388a:	0f 84 d0 00 00 00    	je     803960 <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  803890:	49 89 dc             	mov    %rbx,%r12
+  803893:	48 8b 03             	mov    (%rbx),%rax
+  803896:	4c 39 f0             	cmp    %r14,%rax
+  803899:	73 d7                	jae    803872 <munmap+0x58>
+  80389b:	48 85 c0             	test   %rax,%rax
+  80389e:	74 d2                	je     803872 <munmap+0x58>
+  8038a0:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8038a4:	49 39 d7             	cmp    %rdx,%r15
+  8038a7:	73 c9                	jae    803872 <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  8038a9:	49 39 d6             	cmp    %rdx,%r14
+  8038ac:	73 b6                	jae    803864 <munmap+0x4a>
+  8038ae:	49 39 c7             	cmp    %rax,%r15
+  8038b1:	76 b1                	jbe    803864 <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  8038b3:	4c 89 ef             	mov    %r13,%rdi
+  8038b6:	48 b8 51 29 80 00 00 	movabs $0x802951,%rax
+  8038bd:	00 00 00 
+  8038c0:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  8038c2:	48 85 c0             	test   %rax,%rax
+  8038c5:	0f 84 c5 00 00 00    	je     803990 <munmap+0x176>
+            *tail = *m;
+  8038cb:	48 8b 13             	mov    (%rbx),%rdx
+  8038ce:	48 89 10             	mov    %rdx,(%rax)
+  8038d1:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8038d5:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  8038d9:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  8038dd:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  8038e1:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  8038e4:	44 89 f2             	mov    %r14d,%edx
+  8038e7:	2b 13                	sub    (%rbx),%edx
+  8038e9:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  8038ec:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  8038f0:	eb 80                	jmp    803872 <munmap+0x58>
+        } else if (m->mm_end > end) {
+  8038f2:	49 39 d6             	cmp    %rdx,%r14
+  8038f5:	73 18                	jae    80390f <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  8038f7:	44 89 f2             	mov    %r14d,%edx
+  8038fa:	41 03 54 24 10       	add    0x10(%r12),%edx
+  8038ff:	29 c2                	sub    %eax,%edx
+  803901:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  803906:	4d 89 34 24          	mov    %r14,(%r12)
+  80390a:	e9 63 ff ff ff       	jmp    803872 <munmap+0x58>
+    m->mm_start = 0;
+  80390f:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  803916:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  803917:	4c 89 e6             	mov    %r12,%rsi
+  80391a:	48 b8 00 20 83 00 00 	movabs $0x832000,%rax
+  803921:	00 00 00 
+  803924:	48 29 c6             	sub    %rax,%rsi
+  803927:	48 c1 fe 03          	sar    $0x3,%rsi
+  80392b:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  803932:	aa aa aa 
+  803935:	48 0f af f0          	imul   %rax,%rsi
+  803939:	48 c1 e6 0c          	shl    $0xc,%rsi
+  80393d:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  803942:	48 01 c6             	add    %rax,%rsi
+  803945:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80394a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80394f:	48 b8 51 17 80 00 00 	movabs $0x801751,%rax
+  803956:	00 00 00 
+  803959:	ff d0                	call   *%rax
+}
+  80395b:	e9 12 ff ff ff       	jmp    803872 <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  803960:	4c 89 f2             	mov    %r14,%rdx
+  803963:	4c 29 fa             	sub    %r15,%rdx
+  803966:	4c 89 fe             	mov    %r15,%rsi
+  803969:	bf 00 00 00 00       	mov    $0x0,%edi
+  80396e:	48 b8 51 17 80 00 00 	movabs $0x801751,%rax
+  803975:	00 00 00 
+  803978:	ff d0                	call   *%rax
+}
+  80397a:	48 83 c4 08          	add    $0x8,%rsp
+  80397e:	5b                   	pop    %rbx
+  80397f:	41 5c                	pop    %r12
+  803981:	41 5d                	pop    %r13
+  803983:	41 5e                	pop    %r14
+  803985:	41 5f                	pop    %r15
+  803987:	5d                   	pop    %rbp
+  803988:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  803989:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80398e:	eb ea                	jmp    80397a <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  803990:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  803995:	eb e3                	jmp    80397a <munmap+0x160>
+
+0000000000803997 <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  803997:	55                   	push   %rbp
+  803998:	48 89 e5             	mov    %rsp,%rbp
+  80399b:	41 57                	push   %r15
+  80399d:	41 56                	push   %r14
+  80399f:	41 55                	push   %r13
+  8039a1:	41 54                	push   %r12
+  8039a3:	53                   	push   %rbx
+  8039a4:	48 83 ec 28          	sub    $0x28,%rsp
+  8039a8:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8039ac:	49 89 f5             	mov    %rsi,%r13
+  8039af:	41 89 d6             	mov    %edx,%r14d
+  8039b2:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  8039b5:	41 89 cc             	mov    %ecx,%r12d
+  8039b8:	44 89 c7             	mov    %r8d,%edi
+  8039bb:	44 89 cb             	mov    %r9d,%ebx
+  8039be:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8039c2:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8039c6:	48 b8 8c 1c 80 00 00 	movabs $0x801c8c,%rax
+  8039cd:	00 00 00 
+  8039d0:	ff d0                	call   *%rax
+  8039d2:	41 89 c7             	mov    %eax,%r15d
+  8039d5:	85 c0                	test   %eax,%eax
+  8039d7:	0f 88 ae 01 00 00    	js     803b8b <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8039dd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8039e1:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  8039e8:	00 00 00 
+  8039eb:	8b 32                	mov    (%rdx),%esi
+  8039ed:	39 30                	cmp    %esi,(%rax)
+  8039ef:	0f 85 7a 02 00 00    	jne    803c6f <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  8039f5:	8b 40 08             	mov    0x8(%rax),%eax
+  8039f8:	83 e0 03             	and    $0x3,%eax
+  8039fb:	83 f8 01             	cmp    $0x1,%eax
+  8039fe:	0f 84 76 02 00 00    	je     803c7a <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  803a04:	4d 85 ed             	test   %r13,%r13
+  803a07:	0f 84 78 02 00 00    	je     803c85 <mmap+0x2ee>
+  803a0d:	85 db                	test   %ebx,%ebx
+  803a0f:	0f 88 70 02 00 00    	js     803c85 <mmap+0x2ee>
+  803a15:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  803a1b:	41 89 df             	mov    %ebx,%r15d
+  803a1e:	0f 85 6c 02 00 00    	jne    803c90 <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  803a24:	44 89 f0             	mov    %r14d,%eax
+  803a27:	83 e0 fd             	and    $0xfffffffd,%eax
+  803a2a:	83 f8 04             	cmp    $0x4,%eax
+  803a2d:	0f 85 68 02 00 00    	jne    803c9b <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  803a33:	44 89 e1             	mov    %r12d,%ecx
+  803a36:	83 e1 01             	and    $0x1,%ecx
+  803a39:	0f 95 c2             	setne  %dl
+  803a3c:	44 89 e0             	mov    %r12d,%eax
+  803a3f:	d1 e8                	shr    %eax
+  803a41:	83 f0 01             	xor    $0x1,%eax
+  803a44:	83 e0 01             	and    $0x1,%eax
+  803a47:	38 c2                	cmp    %al,%dl
+  803a49:	0f 85 57 02 00 00    	jne    803ca6 <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  803a4f:	85 c9                	test   %ecx,%ecx
+  803a51:	74 0a                	je     803a5d <mmap+0xc6>
+  803a53:	41 f6 c6 02          	test   $0x2,%r14b
+  803a57:	0f 85 54 02 00 00    	jne    803cb1 <mmap+0x31a>
+    file_flush_buffers();
+  803a5d:	48 b8 12 35 80 00 00 	movabs $0x803512,%rax
+  803a64:	00 00 00 
+  803a67:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  803a69:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  803a70:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  803a77:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803a7b:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  803a7e:	41 f6 c4 04          	test   $0x4,%r12b
+  803a82:	0f 84 15 01 00 00    	je     803b9d <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  803a88:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  803a8b:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  803a91:	0f 85 25 02 00 00    	jne    803cbc <mmap+0x325>
+  803a97:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  803a9b:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  803aa2:	00 00 00 
+  803aa5:	48 39 c2             	cmp    %rax,%rdx
+  803aa8:	0f 82 19 02 00 00    	jb     803cc7 <mmap+0x330>
+  803aae:	48 39 c7             	cmp    %rax,%rdi
+  803ab1:	0f 87 10 02 00 00    	ja     803cc7 <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  803ab7:	4c 89 ee             	mov    %r13,%rsi
+  803aba:	48 b8 1a 38 80 00 00 	movabs $0x80381a,%rax
+  803ac1:	00 00 00 
+  803ac4:	ff d0                	call   *%rax
+  803ac6:	85 c0                	test   %eax,%eax
+  803ac8:	0f 88 04 02 00 00    	js     803cd2 <mmap+0x33b>
+    if (!handler) {
+  803ace:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803ad5:	00 00 00 
+  803ad8:	80 38 00             	cmpb   $0x0,(%rax)
+  803adb:	75 2b                	jne    803b08 <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  803add:	48 bf b2 28 80 00 00 	movabs $0x8028b2,%rdi
+  803ae4:	00 00 00 
+  803ae7:	48 b8 72 4a 80 00 00 	movabs $0x804a72,%rax
+  803aee:	00 00 00 
+  803af1:	ff d0                	call   *%rax
+  803af3:	85 c0                	test   %eax,%eax
+  803af5:	0f 88 ea 01 00 00    	js     803ce5 <mmap+0x34e>
+        handler = 1;
+  803afb:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803b02:	00 00 00 
+  803b05:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  803b08:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803b0c:	48 b8 51 29 80 00 00 	movabs $0x802951,%rax
+  803b13:	00 00 00 
+  803b16:	ff d0                	call   *%rax
+  803b18:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  803b1b:	48 85 c0             	test   %rax,%rax
+  803b1e:	0f 84 c9 01 00 00    	je     803ced <mmap+0x356>
+    m->mm_start = va;
+  803b24:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  803b27:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  803b2b:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  803b2f:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  803b32:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  803b36:	44 89 e0             	mov    %r12d,%eax
+  803b39:	c1 e0 06             	shl    $0x6,%eax
+  803b3c:	25 80 00 00 00       	and    $0x80,%eax
+  803b41:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  803b44:	09 f0                	or     %esi,%eax
+  803b46:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  803b4a:	41 f6 c4 08          	test   $0x8,%r12b
+  803b4e:	74 31                	je     803b81 <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  803b50:	48 39 d3             	cmp    %rdx,%rbx
+  803b53:	73 2c                	jae    803b81 <mmap+0x1ea>
+  803b55:	ba 00 00 04 00       	mov    $0x40000,%edx
+  803b5a:	48 89 de             	mov    %rbx,%rsi
+  803b5d:	4c 89 f7             	mov    %r14,%rdi
+  803b60:	48 b8 a1 27 80 00 00 	movabs $0x8027a1,%rax
+  803b67:	00 00 00 
+  803b6a:	ff d0                	call   *%rax
+  803b6c:	49 89 c4             	mov    %rax,%r12
+  803b6f:	48 85 c0             	test   %rax,%rax
+  803b72:	0f 8e d7 00 00 00    	jle    803c4f <mmap+0x2b8>
+            va += n;
+  803b78:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  803b7b:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  803b7f:	72 d4                	jb     803b55 <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  803b81:	49 8b 06             	mov    (%r14),%rax
+  803b84:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  803b88:	48 89 06             	mov    %rax,(%rsi)
+}
+  803b8b:	44 89 f8             	mov    %r15d,%eax
+  803b8e:	48 83 c4 28          	add    $0x28,%rsp
+  803b92:	5b                   	pop    %rbx
+  803b93:	41 5c                	pop    %r12
+  803b95:	41 5d                	pop    %r13
+  803b97:	41 5e                	pop    %r14
+  803b99:	41 5f                	pop    %r15
+  803b9b:	5d                   	pop    %rbp
+  803b9c:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803b9d:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  803ba4:	00 00 00 
+  803ba7:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  803baa:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  803bb1:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803bb4:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  803bb9:	48 be 00 20 83 00 00 	movabs $0x832000,%rsi
+  803bc0:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803bc3:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  803bca:	00 00 00 
+  803bcd:	48 39 d7             	cmp    %rdx,%rdi
+  803bd0:	73 1c                	jae    803bee <mmap+0x257>
+        return -E_NO_MEM;
+  803bd2:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803bd8:	eb b1                	jmp    803b8b <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803bda:	48 83 c0 01          	add    $0x1,%rax
+  803bde:	48 83 f8 1f          	cmp    $0x1f,%rax
+  803be2:	77 3f                	ja     803c23 <mmap+0x28c>
+  803be4:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  803be9:	48 39 d7             	cmp    %rdx,%rdi
+  803bec:	72 2a                	jb     803c18 <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  803bee:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  803bf2:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  803bf6:	48 39 d1             	cmp    %rdx,%rcx
+  803bf9:	73 df                	jae    803bda <mmap+0x243>
+  803bfb:	48 85 c9             	test   %rcx,%rcx
+  803bfe:	74 da                	je     803bda <mmap+0x243>
+  803c00:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  803c04:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  803c09:	48 39 d3             	cmp    %rdx,%rbx
+  803c0c:	73 cc                	jae    803bda <mmap+0x243>
+            va = mmaps[i].mm_end;
+  803c0e:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803c11:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c16:	eb cc                	jmp    803be4 <mmap+0x24d>
+        return -E_NO_MEM;
+  803c18:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803c1e:	e9 68 ff ff ff       	jmp    803b8b <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  803c23:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  803c28:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  803c2f:	00 00 00 
+  803c32:	48 39 c2             	cmp    %rax,%rdx
+  803c35:	0f 82 9f 00 00 00    	jb     803cda <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  803c3b:	48 85 db             	test   %rbx,%rbx
+  803c3e:	0f 85 8a fe ff ff    	jne    803ace <mmap+0x137>
+        return -E_NO_MEM;
+  803c44:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803c4a:	e9 3c ff ff ff       	jmp    803b8b <mmap+0x1f4>
+        if (n < 0) {
+  803c4f:	0f 89 2c ff ff ff    	jns    803b81 <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  803c55:	49 8b 3e             	mov    (%r14),%rdi
+  803c58:	4c 89 ee             	mov    %r13,%rsi
+  803c5b:	48 b8 1a 38 80 00 00 	movabs $0x80381a,%rax
+  803c62:	00 00 00 
+  803c65:	ff d0                	call   *%rax
+            return n;
+  803c67:	45 89 e7             	mov    %r12d,%r15d
+  803c6a:	e9 1c ff ff ff       	jmp    803b8b <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803c6f:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803c75:	e9 11 ff ff ff       	jmp    803b8b <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  803c7a:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803c80:	e9 06 ff ff ff       	jmp    803b8b <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  803c85:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803c8b:	e9 fb fe ff ff       	jmp    803b8b <mmap+0x1f4>
+  803c90:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803c96:	e9 f0 fe ff ff       	jmp    803b8b <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  803c9b:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803ca1:	e9 e5 fe ff ff       	jmp    803b8b <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  803ca6:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803cac:	e9 da fe ff ff       	jmp    803b8b <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  803cb1:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  803cb7:	e9 cf fe ff ff       	jmp    803b8b <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  803cbc:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803cc2:	e9 c4 fe ff ff       	jmp    803b8b <mmap+0x1f4>
+  803cc7:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803ccd:	e9 b9 fe ff ff       	jmp    803b8b <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  803cd2:	41 89 c7             	mov    %eax,%r15d
+  803cd5:	e9 b1 fe ff ff       	jmp    803b8b <mmap+0x1f4>
+        return -E_NO_MEM;
+  803cda:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803ce0:	e9 a6 fe ff ff       	jmp    803b8b <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  803ce5:	41 89 c7             	mov    %eax,%r15d
+  803ce8:	e9 9e fe ff ff       	jmp    803b8b <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  803ced:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803cf3:	e9 93 fe ff ff       	jmp    803b8b <mmap+0x1f4>
+
+0000000000803cf8 <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803cf8:	55                   	push   %rbp
+  803cf9:	48 89 e5             	mov    %rsp,%rbp
+  803cfc:	41 54                	push   %r12
+  803cfe:	53                   	push   %rbx
+  803cff:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803d02:	48 b8 10 1c 80 00 00 	movabs $0x801c10,%rax
+  803d09:	00 00 00 
+  803d0c:	ff d0                	call   *%rax
+  803d0e:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803d11:	48 be a0 56 80 00 00 	movabs $0x8056a0,%rsi
+  803d18:	00 00 00 
+  803d1b:	48 89 df             	mov    %rbx,%rdi
+  803d1e:	48 b8 4c 11 80 00 00 	movabs $0x80114c,%rax
+  803d25:	00 00 00 
+  803d28:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803d2a:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803d2f:	41 2b 04 24          	sub    (%r12),%eax
+  803d33:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803d39:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803d40:	00 00 00 
+    stat->st_dev = &devpipe;
+  803d43:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803d4a:	00 00 00 
+  803d4d:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803d54:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d59:	5b                   	pop    %rbx
+  803d5a:	41 5c                	pop    %r12
+  803d5c:	5d                   	pop    %rbp
+  803d5d:	c3                   	ret
+
+0000000000803d5e <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  803d5e:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803d61:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  803d67:	8b 17                	mov    (%rdi),%edx
+  803d69:	85 d2                	test   %edx,%edx
+  803d6b:	75 01                	jne    803d6e <pipe_wakeup+0x10>
+  803d6d:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  803d6e:	55                   	push   %rbp
+  803d6f:	48 89 e5             	mov    %rsp,%rbp
+  803d72:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  803d75:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  803d7b:	be 00 04 00 00       	mov    $0x400,%esi
+  803d80:	48 b8 37 1a 80 00 00 	movabs $0x801a37,%rax
+  803d87:	00 00 00 
+  803d8a:	ff d0                	call   *%rax
+}
+  803d8c:	5d                   	pop    %rbp
+  803d8d:	c3                   	ret
+
+0000000000803d8e <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803d8e:	55                   	push   %rbp
+  803d8f:	48 89 e5             	mov    %rsp,%rbp
+  803d92:	41 55                	push   %r13
+  803d94:	41 54                	push   %r12
+  803d96:	53                   	push   %rbx
+  803d97:	48 83 ec 08          	sub    $0x8,%rsp
+  803d9b:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803d9e:	48 b8 10 1c 80 00 00 	movabs $0x801c10,%rax
+  803da5:	00 00 00 
+  803da8:	ff d0                	call   *%rax
+  803daa:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803dad:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803db2:	4c 89 e6             	mov    %r12,%rsi
+  803db5:	bf 00 00 00 00       	mov    $0x0,%edi
+  803dba:	49 bc 51 17 80 00 00 	movabs $0x801751,%r12
+  803dc1:	00 00 00 
+  803dc4:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803dc7:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803dcb:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803dcf:	49 bd 5e 3d 80 00 00 	movabs $0x803d5e,%r13
+  803dd6:	00 00 00 
+  803dd9:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803ddc:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803de0:	48 89 de             	mov    %rbx,%rsi
+  803de3:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  803de6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803deb:	48 89 de             	mov    %rbx,%rsi
+  803dee:	bf 00 00 00 00       	mov    $0x0,%edi
+  803df3:	41 ff d4             	call   *%r12
+  803df6:	48 83 c4 08          	add    $0x8,%rsp
+  803dfa:	5b                   	pop    %rbx
+  803dfb:	41 5c                	pop    %r12
+  803dfd:	41 5d                	pop    %r13
+  803dff:	5d                   	pop    %rbp
+  803e00:	c3                   	ret
+
+0000000000803e01 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  803e01:	55                   	push   %rbp
+  803e02:	48 89 e5             	mov    %rsp,%rbp
+  803e05:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803e08:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803e0d:	be 00 10 00 00       	mov    $0x1000,%esi
+  803e12:	48 b8 94 16 80 00 00 	movabs $0x801694,%rax
+  803e19:	00 00 00 
+  803e1c:	ff d0                	call   *%rax
+  803e1e:	85 c0                	test   %eax,%eax
+  803e20:	0f 94 c0             	sete   %al
+  803e23:	0f b6 c0             	movzbl %al,%eax
+}
+  803e26:	5d                   	pop    %rbp
+  803e27:	c3                   	ret
+
+0000000000803e28 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803e28:	55                   	push   %rbp
+  803e29:	48 89 e5             	mov    %rsp,%rbp
+  803e2c:	41 57                	push   %r15
+  803e2e:	41 56                	push   %r14
+  803e30:	41 55                	push   %r13
+  803e32:	41 54                	push   %r12
+  803e34:	53                   	push   %rbx
+  803e35:	48 83 ec 38          	sub    $0x38,%rsp
+  803e39:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803e3d:	49 89 f4             	mov    %rsi,%r12
+  803e40:	49 89 d7             	mov    %rdx,%r15
+  803e43:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803e47:	48 b8 10 1c 80 00 00 	movabs $0x801c10,%rax
+  803e4e:	00 00 00 
+  803e51:	ff d0                	call   *%rax
+  803e53:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803e56:	4d 85 ff             	test   %r15,%r15
+  803e59:	0f 84 f1 00 00 00    	je     803f50 <devpipe_write+0x128>
+  803e5f:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  803e63:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  803e67:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  803e6b:	49 bd 01 3e 80 00 00 	movabs $0x803e01,%r13
+  803e72:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803e75:	49 bf 5e 3d 80 00 00 	movabs $0x803d5e,%r15
+  803e7c:	00 00 00 
+  803e7f:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803e83:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803e87:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803e8b:	8b 73 04             	mov    0x4(%rbx),%esi
+  803e8e:	48 63 ce             	movslq %esi,%rcx
+  803e91:	48 63 03             	movslq (%rbx),%rax
+  803e94:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  803e9a:	48 39 c1             	cmp    %rax,%rcx
+  803e9d:	72 64                	jb     803f03 <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  803e9f:	48 89 de             	mov    %rbx,%rsi
+  803ea2:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803ea6:	41 ff d5             	call   *%r13
+  803ea9:	85 c0                	test   %eax,%eax
+  803eab:	0f 85 b9 00 00 00    	jne    803f6a <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803eb1:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803eb5:	4c 89 f7             	mov    %r14,%rdi
+  803eb8:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  803ebb:	8b 43 04             	mov    0x4(%rbx),%eax
+  803ebe:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  803ec5:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803ecc:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803ed2:	8b 03                	mov    (%rbx),%eax
+  803ed4:	41 39 c4             	cmp    %eax,%r12d
+  803ed7:	75 b2                	jne    803e8b <devpipe_write+0x63>
+  803ed9:	48 89 de             	mov    %rbx,%rsi
+  803edc:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803ee0:	41 ff d5             	call   *%r13
+  803ee3:	85 c0                	test   %eax,%eax
+  803ee5:	75 a0                	jne    803e87 <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803ee7:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803eec:	44 89 e6             	mov    %r12d,%esi
+  803eef:	48 89 df             	mov    %rbx,%rdi
+  803ef2:	48 b8 19 1a 80 00 00 	movabs $0x801a19,%rax
+  803ef9:	00 00 00 
+  803efc:	ff d0                	call   *%rax
+  803efe:	e9 7c ff ff ff       	jmp    803e7f <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803f03:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  803f07:	41 0f b6 38          	movzbl (%r8),%edi
+  803f0b:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803f12:	80 80 80 
+  803f15:	48 89 c8             	mov    %rcx,%rax
+  803f18:	48 f7 e2             	mul    %rdx
+  803f1b:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803f1f:	48 89 d0             	mov    %rdx,%rax
+  803f22:	48 c1 e0 08          	shl    $0x8,%rax
+  803f26:	48 29 d0             	sub    %rdx,%rax
+  803f29:	48 c1 e0 04          	shl    $0x4,%rax
+  803f2d:	48 29 c1             	sub    %rax,%rcx
+  803f30:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  803f35:	83 c6 01             	add    $0x1,%esi
+  803f38:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803f3b:	49 83 c0 01          	add    $0x1,%r8
+  803f3f:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  803f43:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803f47:	49 39 c0             	cmp    %rax,%r8
+  803f4a:	0f 85 2f ff ff ff    	jne    803e7f <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803f50:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803f54:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803f58:	48 b8 5e 3d 80 00 00 	movabs $0x803d5e,%rax
+  803f5f:	00 00 00 
+  803f62:	ff d0                	call   *%rax
+    return n;
+  803f64:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803f68:	eb 05                	jmp    803f6f <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  803f6a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f6f:	48 83 c4 38          	add    $0x38,%rsp
+  803f73:	5b                   	pop    %rbx
+  803f74:	41 5c                	pop    %r12
+  803f76:	41 5d                	pop    %r13
+  803f78:	41 5e                	pop    %r14
+  803f7a:	41 5f                	pop    %r15
+  803f7c:	5d                   	pop    %rbp
+  803f7d:	c3                   	ret
+
+0000000000803f7e <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803f7e:	55                   	push   %rbp
+  803f7f:	48 89 e5             	mov    %rsp,%rbp
+  803f82:	41 57                	push   %r15
+  803f84:	41 56                	push   %r14
+  803f86:	41 55                	push   %r13
+  803f88:	41 54                	push   %r12
+  803f8a:	53                   	push   %rbx
+  803f8b:	48 83 ec 28          	sub    $0x28,%rsp
+  803f8f:	49 89 fd             	mov    %rdi,%r13
+  803f92:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  803f96:	49 89 d4             	mov    %rdx,%r12
+  803f99:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803f9d:	48 b8 10 1c 80 00 00 	movabs $0x801c10,%rax
+  803fa4:	00 00 00 
+  803fa7:	ff d0                	call   *%rax
+  803fa9:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803fac:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  803fb2:	49 bf 01 3e 80 00 00 	movabs $0x803e01,%r15
+  803fb9:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803fbc:	4d 85 e4             	test   %r12,%r12
+  803fbf:	0f 84 d5 00 00 00    	je     80409a <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803fc5:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803fc9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803fcd:	8b 03                	mov    (%rbx),%eax
+  803fcf:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803fd2:	75 7a                	jne    80404e <devpipe_read+0xd0>
+            if (i > 0) {
+  803fd4:	4d 85 f6             	test   %r14,%r14
+  803fd7:	75 50                	jne    804029 <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  803fd9:	48 89 de             	mov    %rbx,%rsi
+  803fdc:	4c 89 ef             	mov    %r13,%rdi
+  803fdf:	41 ff d7             	call   *%r15
+  803fe2:	85 c0                	test   %eax,%eax
+  803fe4:	0f 85 c9 00 00 00    	jne    8040b3 <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803fea:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  803fed:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803ff4:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803ffa:	8b 43 04             	mov    0x4(%rbx),%eax
+  803ffd:	41 39 c4             	cmp    %eax,%r12d
+  804000:	75 cb                	jne    803fcd <devpipe_read+0x4f>
+  804002:	48 89 de             	mov    %rbx,%rsi
+  804005:	4c 89 ef             	mov    %r13,%rdi
+  804008:	41 ff d7             	call   *%r15
+  80400b:	85 c0                	test   %eax,%eax
+  80400d:	75 be                	jne    803fcd <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  80400f:	ba 0a 00 00 00       	mov    $0xa,%edx
+  804014:	44 89 e6             	mov    %r12d,%esi
+  804017:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80401b:	48 b8 19 1a 80 00 00 	movabs $0x801a19,%rax
+  804022:	00 00 00 
+  804025:	ff d0                	call   *%rax
+  804027:	eb a4                	jmp    803fcd <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  804029:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  80402d:	48 89 de             	mov    %rbx,%rsi
+  804030:	48 b8 5e 3d 80 00 00 	movabs $0x803d5e,%rax
+  804037:	00 00 00 
+  80403a:	ff d0                	call   *%rax
+                return i;
+  80403c:	4c 89 f0             	mov    %r14,%rax
+}
+  80403f:	48 83 c4 28          	add    $0x28,%rsp
+  804043:	5b                   	pop    %rbx
+  804044:	41 5c                	pop    %r12
+  804046:	41 5d                	pop    %r13
+  804048:	41 5e                	pop    %r14
+  80404a:	41 5f                	pop    %r15
+  80404c:	5d                   	pop    %rbp
+  80404d:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80404e:	48 63 c8             	movslq %eax,%rcx
+  804051:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  804058:	80 80 80 
+  80405b:	48 89 c8             	mov    %rcx,%rax
+  80405e:	48 f7 e2             	mul    %rdx
+  804061:	48 c1 ea 0b          	shr    $0xb,%rdx
+  804065:	48 89 d0             	mov    %rdx,%rax
+  804068:	48 c1 e0 08          	shl    $0x8,%rax
+  80406c:	48 29 d0             	sub    %rdx,%rax
+  80406f:	48 c1 e0 04          	shl    $0x4,%rax
+  804073:	48 89 c2             	mov    %rax,%rdx
+  804076:	48 89 c8             	mov    %rcx,%rax
+  804079:	48 29 d0             	sub    %rdx,%rax
+  80407c:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  804081:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804085:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  804089:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80408c:	49 83 c6 01          	add    $0x1,%r14
+  804090:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  804094:	0f 85 2b ff ff ff    	jne    803fc5 <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  80409a:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  80409e:	48 89 de             	mov    %rbx,%rsi
+  8040a1:	48 b8 5e 3d 80 00 00 	movabs $0x803d5e,%rax
+  8040a8:	00 00 00 
+  8040ab:	ff d0                	call   *%rax
+    return n;
+  8040ad:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8040b1:	eb 8c                	jmp    80403f <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  8040b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040b8:	eb 85                	jmp    80403f <devpipe_read+0xc1>
+
+00000000008040ba <pipe>:
+pipe(int pfd[2]) {
+  8040ba:	55                   	push   %rbp
+  8040bb:	48 89 e5             	mov    %rsp,%rbp
+  8040be:	41 55                	push   %r13
+  8040c0:	41 54                	push   %r12
+  8040c2:	53                   	push   %rbx
+  8040c3:	48 83 ec 18          	sub    $0x18,%rsp
+  8040c7:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8040ca:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8040ce:	48 b8 2c 1c 80 00 00 	movabs $0x801c2c,%rax
+  8040d5:	00 00 00 
+  8040d8:	ff d0                	call   *%rax
+  8040da:	89 c3                	mov    %eax,%ebx
+  8040dc:	85 c0                	test   %eax,%eax
+  8040de:	0f 88 a0 01 00 00    	js     804284 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8040e4:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8040e9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8040ee:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8040f2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040f7:	48 b8 ab 16 80 00 00 	movabs $0x8016ab,%rax
+  8040fe:	00 00 00 
+  804101:	ff d0                	call   *%rax
+  804103:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804105:	85 c0                	test   %eax,%eax
+  804107:	0f 88 77 01 00 00    	js     804284 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80410d:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  804111:	48 b8 2c 1c 80 00 00 	movabs $0x801c2c,%rax
+  804118:	00 00 00 
+  80411b:	ff d0                	call   *%rax
+  80411d:	89 c3                	mov    %eax,%ebx
+  80411f:	85 c0                	test   %eax,%eax
+  804121:	0f 88 43 01 00 00    	js     80426a <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  804127:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80412c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804131:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804135:	bf 00 00 00 00       	mov    $0x0,%edi
+  80413a:	48 b8 ab 16 80 00 00 	movabs $0x8016ab,%rax
+  804141:	00 00 00 
+  804144:	ff d0                	call   *%rax
+  804146:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804148:	85 c0                	test   %eax,%eax
+  80414a:	0f 88 1a 01 00 00    	js     80426a <pipe+0x1b0>
+    va = fd2data(fd0);
+  804150:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804154:	48 b8 10 1c 80 00 00 	movabs $0x801c10,%rax
+  80415b:	00 00 00 
+  80415e:	ff d0                	call   *%rax
+  804160:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  804163:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804168:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80416d:	48 89 c6             	mov    %rax,%rsi
+  804170:	bf 00 00 00 00       	mov    $0x0,%edi
+  804175:	48 b8 ab 16 80 00 00 	movabs $0x8016ab,%rax
+  80417c:	00 00 00 
+  80417f:	ff d0                	call   *%rax
+  804181:	89 c3                	mov    %eax,%ebx
+  804183:	85 c0                	test   %eax,%eax
+  804185:	0f 88 c5 00 00 00    	js     804250 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80418b:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80418f:	48 b8 10 1c 80 00 00 	movabs $0x801c10,%rax
+  804196:	00 00 00 
+  804199:	ff d0                	call   *%rax
+  80419b:	48 89 c1             	mov    %rax,%rcx
+  80419e:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8041a4:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8041aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8041af:	4c 89 ee             	mov    %r13,%rsi
+  8041b2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8041b7:	48 b8 01 17 80 00 00 	movabs $0x801701,%rax
+  8041be:	00 00 00 
+  8041c1:	ff d0                	call   *%rax
+  8041c3:	89 c3                	mov    %eax,%ebx
+  8041c5:	85 c0                	test   %eax,%eax
+  8041c7:	78 6e                	js     804237 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8041c9:	be 00 10 00 00       	mov    $0x1000,%esi
+  8041ce:	4c 89 ef             	mov    %r13,%rdi
+  8041d1:	48 b8 70 16 80 00 00 	movabs $0x801670,%rax
+  8041d8:	00 00 00 
+  8041db:	ff d0                	call   *%rax
+  8041dd:	83 f8 02             	cmp    $0x2,%eax
+  8041e0:	0f 85 ab 00 00 00    	jne    804291 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8041e6:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  8041ed:	00 00 
+  8041ef:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8041f3:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8041f5:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8041f9:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  804200:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804204:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  804206:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80420a:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  804211:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804215:	48 bb fe 1b 80 00 00 	movabs $0x801bfe,%rbx
+  80421c:	00 00 00 
+  80421f:	ff d3                	call   *%rbx
+  804221:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  804225:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804229:	ff d3                	call   *%rbx
+  80422b:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  804230:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804235:	eb 4d                	jmp    804284 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  804237:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80423c:	4c 89 ee             	mov    %r13,%rsi
+  80423f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804244:	48 b8 51 17 80 00 00 	movabs $0x801751,%rax
+  80424b:	00 00 00 
+  80424e:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  804250:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804255:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804259:	bf 00 00 00 00       	mov    $0x0,%edi
+  80425e:	48 b8 51 17 80 00 00 	movabs $0x801751,%rax
+  804265:	00 00 00 
+  804268:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80426a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80426f:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804273:	bf 00 00 00 00       	mov    $0x0,%edi
+  804278:	48 b8 51 17 80 00 00 	movabs $0x801751,%rax
+  80427f:	00 00 00 
+  804282:	ff d0                	call   *%rax
+}
+  804284:	89 d8                	mov    %ebx,%eax
+  804286:	48 83 c4 18          	add    $0x18,%rsp
+  80428a:	5b                   	pop    %rbx
+  80428b:	41 5c                	pop    %r12
+  80428d:	41 5d                	pop    %r13
+  80428f:	5d                   	pop    %rbp
+  804290:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804291:	48 b9 d0 56 80 00 00 	movabs $0x8056d0,%rcx
+  804298:	00 00 00 
+  80429b:	48 ba a7 56 80 00 00 	movabs $0x8056a7,%rdx
+  8042a2:	00 00 00 
+  8042a5:	be 50 00 00 00       	mov    $0x50,%esi
+  8042aa:	48 bf bc 56 80 00 00 	movabs $0x8056bc,%rdi
+  8042b1:	00 00 00 
+  8042b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042b9:	49 b8 d7 06 80 00 00 	movabs $0x8006d7,%r8
+  8042c0:	00 00 00 
+  8042c3:	41 ff d0             	call   *%r8
+
+00000000008042c6 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8042c6:	55                   	push   %rbp
+  8042c7:	48 89 e5             	mov    %rsp,%rbp
+  8042ca:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8042ce:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8042d2:	48 b8 8c 1c 80 00 00 	movabs $0x801c8c,%rax
+  8042d9:	00 00 00 
+  8042dc:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8042de:	85 c0                	test   %eax,%eax
+  8042e0:	78 23                	js     804305 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8042e2:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8042e6:	48 b8 10 1c 80 00 00 	movabs $0x801c10,%rax
+  8042ed:	00 00 00 
+  8042f0:	ff d0                	call   *%rax
+  8042f2:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  8042f5:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8042f9:	48 b8 01 3e 80 00 00 	movabs $0x803e01,%rax
+  804300:	00 00 00 
+  804303:	ff d0                	call   *%rax
+}
+  804305:	c9                   	leave
+  804306:	c3                   	ret
+
+0000000000804307 <wait>:
+#include <inc/lib.h>
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  804307:	55                   	push   %rbp
+  804308:	48 89 e5             	mov    %rsp,%rbp
+  80430b:	41 56                	push   %r14
+  80430d:	41 55                	push   %r13
+  80430f:	41 54                	push   %r12
+  804311:	53                   	push   %rbx
+    assert(envid != 0);
+  804312:	85 ff                	test   %edi,%edi
+  804314:	0f 84 b7 00 00 00    	je     8043d1 <wait+0xca>
+  80431a:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  80431d:	89 f9                	mov    %edi,%ecx
+  80431f:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+
+    for (;;) {
+        uint32_t seq = env->env_wait_seq;
+  804325:	48 bf 00 00 c0 1f 80 	movabs $0x801fc00000,%rdi
+  80432c:	00 00 00 
+  80432f:	45 89 e0             	mov    %r12d,%r8d
+  804332:	41 81 e0 ff 03 00 00 	and    $0x3ff,%r8d
+  804339:	4c 89 c0             	mov    %r8,%rax
+  80433c:	48 c1 e0 04          	shl    $0x4,%rax
+  804340:	48 89 c2             	mov    %rax,%rdx
+  804343:	4c 29 c2             	sub    %r8,%rdx
+  804346:	48 c1 e2 05          	shl    $0x5,%rdx
+  80434a:	48 01 fa             	add    %rdi,%rdx
+  80434d:	8b b2 b8 01 00 00    	mov    0x1b8(%rdx),%esi
+        if (env->env_id != envid || env->env_status == ENV_FREE) break;
+  804353:	8b 82 c8 00 00 00    	mov    0xc8(%rdx),%eax
+  804359:	41 39 c4             	cmp    %eax,%r12d
+  80435c:	75 6a                	jne    8043c8 <wait+0xc1>
+
+        /* The kernel wakes us up when the environment is freed */
+        sys_futex_wait(&env->env_wait_seq, seq, 0);
+  80435e:	48 63 d1             	movslq %ecx,%rdx
+  804361:	48 89 d0             	mov    %rdx,%rax
+  804364:	48 c1 e0 04          	shl    $0x4,%rax
+  804368:	48 29 d0             	sub    %rdx,%rax
+  80436b:	48 c1 e0 05          	shl    $0x5,%rax
+  80436f:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804376:	00 00 00 
+  804379:	4c 8d b4 02 b8 01 00 	lea    0x1b8(%rdx,%rax,1),%r14
+  804380:	00 
+        if (env->env_id != envid || env->env_status == ENV_FREE) break;
+  804381:	48 63 c9             	movslq %ecx,%rcx
+  804384:	48 89 c8             	mov    %rcx,%rax
+  804387:	48 c1 e0 04          	shl    $0x4,%rax
+  80438b:	48 29 c8             	sub    %rcx,%rax
+  80438e:	48 c1 e0 05          	shl    $0x5,%rax
+  804392:	48 89 d3             	mov    %rdx,%rbx
+  804395:	48 01 c3             	add    %rax,%rbx
+        sys_futex_wait(&env->env_wait_seq, seq, 0);
+  804398:	49 bd 19 1a 80 00 00 	movabs $0x801a19,%r13
+  80439f:	00 00 00 
+        if (env->env_id != envid || env->env_status == ENV_FREE) break;
+  8043a2:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+  8043a8:	85 c0                	test   %eax,%eax
+  8043aa:	74 1c                	je     8043c8 <wait+0xc1>
+        sys_futex_wait(&env->env_wait_seq, seq, 0);
+  8043ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8043b1:	4c 89 f7             	mov    %r14,%rdi
+  8043b4:	41 ff d5             	call   *%r13
+        uint32_t seq = env->env_wait_seq;
+  8043b7:	8b b3 b8 01 00 00    	mov    0x1b8(%rbx),%esi
+        if (env->env_id != envid || env->env_status == ENV_FREE) break;
+  8043bd:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  8043c3:	44 39 e0             	cmp    %r12d,%eax
+  8043c6:	74 da                	je     8043a2 <wait+0x9b>
+    }
+}
+  8043c8:	5b                   	pop    %rbx
+  8043c9:	41 5c                	pop    %r12
+  8043cb:	41 5d                	pop    %r13
+  8043cd:	41 5e                	pop    %r14
+  8043cf:	5d                   	pop    %rbp
+  8043d0:	c3                   	ret
+    assert(envid != 0);
+  8043d1:	48 b9 f4 56 80 00 00 	movabs $0x8056f4,%rcx
+  8043d8:	00 00 00 
+  8043db:	48 ba a7 56 80 00 00 	movabs $0x8056a7,%rdx
+  8043e2:	00 00 00 
+  8043e5:	be 06 00 00 00       	mov    $0x6,%esi
+  8043ea:	48 bf ff 56 80 00 00 	movabs $0x8056ff,%rdi
+  8043f1:	00 00 00 
+  8043f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043f9:	49 b8 d7 06 80 00 00 	movabs $0x8006d7,%r8
+  804400:	00 00 00 
+  804403:	41 ff d0             	call   *%r8
+
+0000000000804406 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804406:	48 89 f8             	mov    %rdi,%rax
+  804409:	48 c1 e8 27          	shr    $0x27,%rax
+  80440d:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804414:	01 00 00 
+  804417:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80441b:	f6 c2 01             	test   $0x1,%dl
+  80441e:	74 6d                	je     80448d <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804420:	48 89 f8             	mov    %rdi,%rax
+  804423:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804427:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80442e:	01 00 00 
+  804431:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804435:	f6 c2 01             	test   $0x1,%dl
+  804438:	74 62                	je     80449c <get_uvpt_entry+0x96>
+  80443a:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804441:	01 00 00 
+  804444:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804448:	f6 c2 80             	test   $0x80,%dl
+  80444b:	75 4f                	jne    80449c <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80444d:	48 89 f8             	mov    %rdi,%rax
+  804450:	48 c1 e8 15          	shr    $0x15,%rax
+  804454:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80445b:	01 00 00 
+  80445e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804462:	f6 c2 01             	test   $0x1,%dl
+  804465:	74 44                	je     8044ab <get_uvpt_entry+0xa5>
+  804467:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80446e:	01 00 00 
+  804471:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804475:	f6 c2 80             	test   $0x80,%dl
+  804478:	75 31                	jne    8044ab <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80447a:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80447e:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804485:	01 00 00 
+  804488:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80448c:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80448d:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804494:	01 00 00 
+  804497:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80449b:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80449c:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8044a3:	01 00 00 
+  8044a6:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8044aa:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8044ab:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8044b2:	01 00 00 
+  8044b5:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8044b9:	c3                   	ret
+
+00000000008044ba <get_prot>:
+
+int
+get_prot(void *va) {
+  8044ba:	55                   	push   %rbp
+  8044bb:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8044be:	48 b8 06 44 80 00 00 	movabs $0x804406,%rax
+  8044c5:	00 00 00 
+  8044c8:	ff d0                	call   *%rax
+  8044ca:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8044cd:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8044d2:	89 c1                	mov    %eax,%ecx
+  8044d4:	83 c9 04             	or     $0x4,%ecx
+  8044d7:	f6 c2 01             	test   $0x1,%dl
+  8044da:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8044dd:	89 c1                	mov    %eax,%ecx
+  8044df:	83 c9 02             	or     $0x2,%ecx
+  8044e2:	f6 c2 02             	test   $0x2,%dl
+  8044e5:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8044e8:	89 c1                	mov    %eax,%ecx
+  8044ea:	83 c9 01             	or     $0x1,%ecx
+  8044ed:	48 85 d2             	test   %rdx,%rdx
+  8044f0:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8044f3:	89 c1                	mov    %eax,%ecx
+  8044f5:	83 c9 40             	or     $0x40,%ecx
+  8044f8:	f6 c6 04             	test   $0x4,%dh
+  8044fb:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8044fe:	5d                   	pop    %rbp
+  8044ff:	c3                   	ret
+
+0000000000804500 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804500:	55                   	push   %rbp
+  804501:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804504:	48 b8 06 44 80 00 00 	movabs $0x804406,%rax
+  80450b:	00 00 00 
+  80450e:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804510:	48 c1 e8 06          	shr    $0x6,%rax
+  804514:	83 e0 01             	and    $0x1,%eax
+}
+  804517:	5d                   	pop    %rbp
+  804518:	c3                   	ret
+
+0000000000804519 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804519:	55                   	push   %rbp
+  80451a:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80451d:	48 b8 06 44 80 00 00 	movabs $0x804406,%rax
+  804524:	00 00 00 
+  804527:	ff d0                	call   *%rax
+  804529:	83 e0 01             	and    $0x1,%eax
+}
+  80452c:	5d                   	pop    %rbp
+  80452d:	c3                   	ret
+
+000000000080452e <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  80452e:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  804535:	01 00 00 
+  804538:	a8 01                	test   $0x1,%al
+  80453a:	75 06                	jne    804542 <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  80453c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804541:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804542:	55                   	push   %rbp
+  804543:	48 89 e5             	mov    %rsp,%rbp
+  804546:	41 57                	push   %r15
+  804548:	41 56                	push   %r14
+  80454a:	41 55                	push   %r13
+  80454c:	41 54                	push   %r12
+  80454e:	53                   	push   %rbx
+  80454f:	48 83 ec 28          	sub    $0x28,%rsp
+  804553:	49 89 fe             	mov    %rdi,%r14
+  804556:	49 89 f7             	mov    %rsi,%r15
+  804559:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  804560:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  804561:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  804568:	01 00 00 
+  80456b:	e9 ae 00 00 00       	jmp    80461e <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  804570:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804577:	49 83 ec 01          	sub    $0x1,%r12
+  80457b:	74 2d                	je     8045aa <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  80457d:	48 89 d8             	mov    %rbx,%rax
+  804580:	48 c1 e8 0c          	shr    $0xc,%rax
+  804584:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  804589:	f6 c2 01             	test   $0x1,%dl
+  80458c:	74 e2                	je     804570 <foreach_shared_region+0x42>
+  80458e:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  804593:	f6 c4 04             	test   $0x4,%ah
+  804596:	74 d8                	je     804570 <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  804598:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  80459f:	4c 89 fa             	mov    %r15,%rdx
+  8045a2:	48 89 df             	mov    %rbx,%rdi
+  8045a5:	41 ff d6             	call   *%r14
+  8045a8:	eb c6                	jmp    804570 <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  8045aa:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  8045b1:	00 
+  8045b2:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  8045b7:	74 4a                	je     804603 <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  8045b9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8045bd:	48 c1 e8 15          	shr    $0x15,%rax
+  8045c1:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  8045c8:	01 00 00 
+  8045cb:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  8045cf:	a8 01                	test   $0x1,%al
+  8045d1:	74 d7                	je     8045aa <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  8045d3:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  8045d7:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  8045de:	48 39 c3             	cmp    %rax,%rbx
+  8045e1:	73 c7                	jae    8045aa <foreach_shared_region+0x7c>
+  8045e3:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  8045ea:	48 39 d0             	cmp    %rdx,%rax
+  8045ed:	4d 19 e4             	sbb    %r12,%r12
+  8045f0:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  8045f7:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  8045fe:	e9 7a ff ff ff       	jmp    80457d <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  804603:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  80460a:	40 
+  80460b:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80460f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804616:	00 00 00 
+  804619:	48 39 c1             	cmp    %rax,%rcx
+  80461c:	74 50                	je     80466e <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  80461e:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804622:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804626:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  80462d:	01 00 00 
+  804630:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804634:	a8 01                	test   $0x1,%al
+  804636:	74 cb                	je     804603 <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  804638:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80463c:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  804643:	48 39 c1             	cmp    %rax,%rcx
+  804646:	73 bb                	jae    804603 <foreach_shared_region+0xd5>
+  804648:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  80464f:	48 39 d0             	cmp    %rdx,%rax
+  804652:	48 19 c0             	sbb    %rax,%rax
+  804655:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  80465b:	48 05 00 02 00 00    	add    $0x200,%rax
+  804661:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804665:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  804669:	e9 4b ff ff ff       	jmp    8045b9 <foreach_shared_region+0x8b>
+  80466e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804673:	48 83 c4 28          	add    $0x28,%rsp
+  804677:	5b                   	pop    %rbx
+  804678:	41 5c                	pop    %r12
+  80467a:	41 5d                	pop    %r13
+  80467c:	41 5e                	pop    %r14
+  80467e:	41 5f                	pop    %r15
+  804680:	5d                   	pop    %rbp
+  804681:	c3                   	ret
+
+0000000000804682 <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  804682:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  804688:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  80468f:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  804696:	c3                   	ret
+
+0000000000804697 <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  804697:	8b 47 40             	mov    0x40(%rdi),%eax
+  80469a:	8b 17                	mov    (%rdi),%edx
+  80469c:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  80469e:	83 f8 0f             	cmp    $0xf,%eax
+  8046a1:	77 13                	ja     8046b6 <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  8046a3:	8b 47 40             	mov    0x40(%rdi),%eax
+  8046a6:	83 e0 0f             	and    $0xf,%eax
+  8046a9:	48 c1 e0 09          	shl    $0x9,%rax
+  8046ad:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  8046b4:	00 
+  8046b5:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  8046b6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8046bb:	c3                   	ret
+
+00000000008046bc <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  8046bc:	8b 47 40             	mov    0x40(%rdi),%eax
+  8046bf:	83 c0 01             	add    $0x1,%eax
+  8046c2:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8046c5:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  8046cb:	8b 57 04             	mov    0x4(%rdi),%edx
+  8046ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046d3:	85 d2                	test   %edx,%edx
+  8046d5:	75 04                	jne    8046db <chan_publish+0x1f>
+  8046d7:	83 e0 01             	and    $0x1,%eax
+}
+  8046da:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  8046db:	87 47 04             	xchg   %eax,0x4(%rdi)
+  8046de:	85 c0                	test   %eax,%eax
+  8046e0:	0f 95 c0             	setne  %al
+  8046e3:	0f b6 c0             	movzbl %al,%eax
+  8046e6:	eb ef                	jmp    8046d7 <chan_publish+0x1b>
+
+00000000008046e8 <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  8046e8:	8b 47 40             	mov    0x40(%rdi),%eax
+  8046eb:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  8046ed:	29 d0                	sub    %edx,%eax
+  8046ef:	83 e8 01             	sub    $0x1,%eax
+  8046f2:	83 f8 0f             	cmp    $0xf,%eax
+  8046f5:	77 12                	ja     804709 <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  8046f7:	8b 07                	mov    (%rdi),%eax
+  8046f9:	83 e0 0f             	and    $0xf,%eax
+  8046fc:	48 c1 e0 09          	shl    $0x9,%rax
+  804700:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  804707:	00 
+  804708:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  804709:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80470e:	c3                   	ret
+
+000000000080470f <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  80470f:	8b 07                	mov    (%rdi),%eax
+  804711:	83 c0 01             	add    $0x1,%eax
+  804714:	89 07                	mov    %eax,(%rdi)
+}
+  804716:	c3                   	ret
+
+0000000000804717 <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  804717:	55                   	push   %rbp
+  804718:	48 89 e5             	mov    %rsp,%rbp
+  80471b:	53                   	push   %rbx
+  80471c:	48 83 ec 08          	sub    $0x8,%rsp
+  804720:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  804723:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  80472a:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  804730:	48 b8 e8 46 80 00 00 	movabs $0x8046e8,%rax
+  804737:	00 00 00 
+  80473a:	ff d0                	call   *%rax
+  80473c:	48 85 c0             	test   %rax,%rax
+  80473f:	74 12                	je     804753 <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  804741:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  804748:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80474d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804751:	c9                   	leave
+  804752:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  804753:	b8 01 00 00 00       	mov    $0x1,%eax
+  804758:	eb f3                	jmp    80474d <chan_arm+0x36>
+
+000000000080475a <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  80475a:	55                   	push   %rbp
+  80475b:	48 89 e5             	mov    %rsp,%rbp
+  80475e:	41 56                	push   %r14
+  804760:	41 55                	push   %r13
+  804762:	41 54                	push   %r12
+  804764:	53                   	push   %rbx
+  804765:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  804768:	49 bc 17 47 80 00 00 	movabs $0x804717,%r12
+  80476f:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  804772:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  804776:	49 bd 19 1a 80 00 00 	movabs $0x801a19,%r13
+  80477d:	00 00 00 
+    while (chan_arm(r))
+  804780:	eb 0d                	jmp    80478f <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  804782:	8b 33                	mov    (%rbx),%esi
+  804784:	ba 00 00 00 00       	mov    $0x0,%edx
+  804789:	4c 89 f7             	mov    %r14,%rdi
+  80478c:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  80478f:	48 89 df             	mov    %rbx,%rdi
+  804792:	41 ff d4             	call   *%r12
+  804795:	84 c0                	test   %al,%al
+  804797:	75 e9                	jne    804782 <chan_wait+0x28>
+}
+  804799:	5b                   	pop    %rbx
+  80479a:	41 5c                	pop    %r12
+  80479c:	41 5d                	pop    %r13
+  80479e:	41 5e                	pop    %r14
+  8047a0:	5d                   	pop    %rbp
+  8047a1:	c3                   	ret
+
+00000000008047a2 <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  8047a2:	55                   	push   %rbp
+  8047a3:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  8047a6:	48 83 c7 40          	add    $0x40,%rdi
+  8047aa:	be 01 00 00 00       	mov    $0x1,%esi
+  8047af:	48 b8 37 1a 80 00 00 	movabs $0x801a37,%rax
+  8047b6:	00 00 00 
+  8047b9:	ff d0                	call   *%rax
+}
+  8047bb:	5d                   	pop    %rbp
+  8047bc:	c3                   	ret
+
+00000000008047bd <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8047bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047c2:	c3                   	ret
+
+00000000008047c3 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8047c3:	55                   	push   %rbp
+  8047c4:	48 89 e5             	mov    %rsp,%rbp
+  8047c7:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8047ca:	48 be 0a 57 80 00 00 	movabs $0x80570a,%rsi
+  8047d1:	00 00 00 
+  8047d4:	48 b8 4c 11 80 00 00 	movabs $0x80114c,%rax
+  8047db:	00 00 00 
+  8047de:	ff d0                	call   *%rax
+    return 0;
+}
+  8047e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047e5:	5d                   	pop    %rbp
+  8047e6:	c3                   	ret
+
+00000000008047e7 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8047e7:	55                   	push   %rbp
+  8047e8:	48 89 e5             	mov    %rsp,%rbp
+  8047eb:	41 57                	push   %r15
+  8047ed:	41 56                	push   %r14
+  8047ef:	41 55                	push   %r13
+  8047f1:	41 54                	push   %r12
+  8047f3:	53                   	push   %rbx
+  8047f4:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8047fb:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  804802:	48 85 d2             	test   %rdx,%rdx
+  804805:	74 7a                	je     804881 <devcons_write+0x9a>
+  804807:	49 89 d6             	mov    %rdx,%r14
+  80480a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804810:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  804815:	49 bf 46 13 80 00 00 	movabs $0x801346,%r15
+  80481c:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80481f:	4c 89 f3             	mov    %r14,%rbx
+  804822:	48 29 f3             	sub    %rsi,%rbx
+  804825:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80482a:	48 39 c3             	cmp    %rax,%rbx
+  80482d:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804831:	4c 63 eb             	movslq %ebx,%r13
+  804834:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80483b:	48 01 c6             	add    %rax,%rsi
+  80483e:	4c 89 ea             	mov    %r13,%rdx
+  804841:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804848:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80484b:	4c 89 ee             	mov    %r13,%rsi
+  80484e:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804855:	48 b8 73 15 80 00 00 	movabs $0x801573,%rax
+  80485c:	00 00 00 
+  80485f:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804861:	41 01 dc             	add    %ebx,%r12d
+  804864:	49 63 f4             	movslq %r12d,%rsi
+  804867:	4c 39 f6             	cmp    %r14,%rsi
+  80486a:	72 b3                	jb     80481f <devcons_write+0x38>
+    return res;
+  80486c:	49 63 c4             	movslq %r12d,%rax
+}
+  80486f:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804876:	5b                   	pop    %rbx
+  804877:	41 5c                	pop    %r12
+  804879:	41 5d                	pop    %r13
+  80487b:	41 5e                	pop    %r14
+  80487d:	41 5f                	pop    %r15
+  80487f:	5d                   	pop    %rbp
+  804880:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804881:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804887:	eb e3                	jmp    80486c <devcons_write+0x85>
+
+0000000000804889 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804889:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80488c:	ba 00 00 00 00       	mov    $0x0,%edx
+  804891:	48 85 c0             	test   %rax,%rax
+  804894:	74 55                	je     8048eb <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804896:	55                   	push   %rbp
+  804897:	48 89 e5             	mov    %rsp,%rbp
+  80489a:	41 55                	push   %r13
+  80489c:	41 54                	push   %r12
+  80489e:	53                   	push   %rbx
+  80489f:	48 83 ec 08          	sub    $0x8,%rsp
+  8048a3:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8048a6:	48 bb 92 15 80 00 00 	movabs $0x801592,%rbx
+  8048ad:	00 00 00 
+  8048b0:	49 bc 47 16 80 00 00 	movabs $0x801647,%r12
+  8048b7:	00 00 00 
+  8048ba:	eb 03                	jmp    8048bf <devcons_read+0x36>
+  8048bc:	41 ff d4             	call   *%r12
+  8048bf:	ff d3                	call   *%rbx
+  8048c1:	85 c0                	test   %eax,%eax
+  8048c3:	74 f7                	je     8048bc <devcons_read+0x33>
+    if (c < 0) return c;
+  8048c5:	48 63 d0             	movslq %eax,%rdx
+  8048c8:	78 13                	js     8048dd <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8048ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8048cf:	83 f8 04             	cmp    $0x4,%eax
+  8048d2:	74 09                	je     8048dd <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8048d4:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8048d8:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8048dd:	48 89 d0             	mov    %rdx,%rax
+  8048e0:	48 83 c4 08          	add    $0x8,%rsp
+  8048e4:	5b                   	pop    %rbx
+  8048e5:	41 5c                	pop    %r12
+  8048e7:	41 5d                	pop    %r13
+  8048e9:	5d                   	pop    %rbp
+  8048ea:	c3                   	ret
+  8048eb:	48 89 d0             	mov    %rdx,%rax
+  8048ee:	c3                   	ret
+
+00000000008048ef <cputchar>:
+cputchar(int ch) {
+  8048ef:	55                   	push   %rbp
+  8048f0:	48 89 e5             	mov    %rsp,%rbp
+  8048f3:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8048f7:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8048fb:	be 01 00 00 00       	mov    $0x1,%esi
+  804900:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  804904:	48 b8 73 15 80 00 00 	movabs $0x801573,%rax
+  80490b:	00 00 00 
+  80490e:	ff d0                	call   *%rax
+}
+  804910:	c9                   	leave
+  804911:	c3                   	ret
+
+0000000000804912 <getchar>:
+getchar(void) {
+  804912:	55                   	push   %rbp
+  804913:	48 89 e5             	mov    %rsp,%rbp
+  804916:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80491a:	ba 01 00 00 00       	mov    $0x1,%edx
+  80491f:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  804923:	bf 00 00 00 00       	mov    $0x0,%edi
+  804928:	48 b8 6f 1f 80 00 00 	movabs $0x801f6f,%rax
+  80492f:	00 00 00 
+  804932:	ff d0                	call   *%rax
+  804934:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  804936:	85 c0                	test   %eax,%eax
+  804938:	78 06                	js     804940 <getchar+0x2e>
+  80493a:	74 08                	je     804944 <getchar+0x32>
+  80493c:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804940:	89 d0                	mov    %edx,%eax
+  804942:	c9                   	leave
+  804943:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  804944:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  804949:	eb f5                	jmp    804940 <getchar+0x2e>
+
+000000000080494b <iscons>:
+iscons(int fdnum) {
+  80494b:	55                   	push   %rbp
+  80494c:	48 89 e5             	mov    %rsp,%rbp
+  80494f:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804953:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804957:	48 b8 8c 1c 80 00 00 	movabs $0x801c8c,%rax
+  80495e:	00 00 00 
+  804961:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804963:	85 c0                	test   %eax,%eax
+  804965:	78 18                	js     80497f <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  804967:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80496b:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  804972:	00 00 00 
+  804975:	8b 00                	mov    (%rax),%eax
+  804977:	39 02                	cmp    %eax,(%rdx)
+  804979:	0f 94 c0             	sete   %al
+  80497c:	0f b6 c0             	movzbl %al,%eax
+}
+  80497f:	c9                   	leave
+  804980:	c3                   	ret
+
+0000000000804981 <opencons>:
+opencons(void) {
+  804981:	55                   	push   %rbp
+  804982:	48 89 e5             	mov    %rsp,%rbp
+  804985:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  804989:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80498d:	48 b8 2c 1c 80 00 00 	movabs $0x801c2c,%rax
+  804994:	00 00 00 
+  804997:	ff d0                	call   *%rax
+  804999:	85 c0                	test   %eax,%eax
+  80499b:	78 49                	js     8049e6 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80499d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8049a2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8049a7:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8049ab:	bf 00 00 00 00       	mov    $0x0,%edi
+  8049b0:	48 b8 ab 16 80 00 00 	movabs $0x8016ab,%rax
+  8049b7:	00 00 00 
+  8049ba:	ff d0                	call   *%rax
+  8049bc:	85 c0                	test   %eax,%eax
+  8049be:	78 26                	js     8049e6 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8049c0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8049c4:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  8049cb:	00 00 
+  8049cd:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8049cf:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8049d3:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8049da:	48 b8 fe 1b 80 00 00 	movabs $0x801bfe,%rax
+  8049e1:	00 00 00 
+  8049e4:	ff d0                	call   *%rax
+}
+  8049e6:	c9                   	leave
+  8049e7:	c3                   	ret
+
+00000000008049e8 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  8049e8:	55                   	push   %rbp
+  8049e9:	48 89 e5             	mov    %rsp,%rbp
+  8049ec:	41 56                	push   %r14
+  8049ee:	41 55                	push   %r13
+  8049f0:	41 54                	push   %r12
+  8049f2:	53                   	push   %rbx
+  8049f3:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8049f6:	48 b8 48 10 85 00 00 	movabs $0x851048,%rax
+  8049fd:	00 00 00 
+  804a00:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804a04:	74 27                	je     804a2d <_handle_vectored_pagefault+0x45>
+  804a06:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  804a0b:	49 bd 00 10 85 00 00 	movabs $0x851000,%r13
+  804a12:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804a15:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  804a18:	4c 89 e7             	mov    %r12,%rdi
+  804a1b:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  804a20:	84 c0                	test   %al,%al
+  804a22:	75 45                	jne    804a69 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804a24:	48 83 c3 01          	add    $0x1,%rbx
+  804a28:	49 3b 1e             	cmp    (%r14),%rbx
+  804a2b:	72 eb                	jb     804a18 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  804a2d:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  804a34:	00 
+  804a35:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  804a3a:	4d 8b 04 24          	mov    (%r12),%r8
+  804a3e:	48 ba 18 57 80 00 00 	movabs $0x805718,%rdx
+  804a45:	00 00 00 
+  804a48:	be 1d 00 00 00       	mov    $0x1d,%esi
+  804a4d:	48 bf 48 57 80 00 00 	movabs $0x805748,%rdi
+  804a54:	00 00 00 
+  804a57:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a5c:	49 ba d7 06 80 00 00 	movabs $0x8006d7,%r10
+  804a63:	00 00 00 
+  804a66:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  804a69:	5b                   	pop    %rbx
+  804a6a:	41 5c                	pop    %r12
+  804a6c:	41 5d                	pop    %r13
+  804a6e:	41 5e                	pop    %r14
+  804a70:	5d                   	pop    %rbp
+  804a71:	c3                   	ret
+
+0000000000804a72 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  804a72:	55                   	push   %rbp
+  804a73:	48 89 e5             	mov    %rsp,%rbp
+  804a76:	53                   	push   %rbx
+  804a77:	48 83 ec 08          	sub    $0x8,%rsp
+  804a7b:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  804a7e:	48 b8 40 10 85 00 00 	movabs $0x851040,%rax
+  804a85:	00 00 00 
+  804a88:	80 38 00             	cmpb   $0x0,(%rax)
+  804a8b:	0f 84 84 00 00 00    	je     804b15 <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804a91:	48 b8 48 10 85 00 00 	movabs $0x851048,%rax
+  804a98:	00 00 00 
+  804a9b:	48 8b 10             	mov    (%rax),%rdx
+  804a9e:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  804aa3:	48 b9 00 10 85 00 00 	movabs $0x851000,%rcx
+  804aaa:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804aad:	48 85 d2             	test   %rdx,%rdx
+  804ab0:	74 19                	je     804acb <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  804ab2:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  804ab6:	0f 84 e8 00 00 00    	je     804ba4 <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804abc:	48 83 c0 01          	add    $0x1,%rax
+  804ac0:	48 39 d0             	cmp    %rdx,%rax
+  804ac3:	75 ed                	jne    804ab2 <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  804ac5:	48 83 fa 08          	cmp    $0x8,%rdx
+  804ac9:	74 1c                	je     804ae7 <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  804acb:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  804acf:	48 a3 48 10 85 00 00 	movabs %rax,0x851048
+  804ad6:	00 00 00 
+  804ad9:	48 b8 00 10 85 00 00 	movabs $0x851000,%rax
+  804ae0:	00 00 00 
+  804ae3:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  804ae7:	48 b8 1e 16 80 00 00 	movabs $0x80161e,%rax
+  804aee:	00 00 00 
+  804af1:	ff d0                	call   *%rax
+  804af3:	89 c7                	mov    %eax,%edi
+  804af5:	48 be 6a 4c 80 00 00 	movabs $0x804c6a,%rsi
+  804afc:	00 00 00 
+  804aff:	48 b8 69 18 80 00 00 	movabs $0x801869,%rax
+  804b06:	00 00 00 
+  804b09:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  804b0b:	85 c0                	test   %eax,%eax
+  804b0d:	78 68                	js     804b77 <add_pgfault_handler+0x105>
+    return res;
+}
+  804b0f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804b13:	c9                   	leave
+  804b14:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  804b15:	48 b8 1e 16 80 00 00 	movabs $0x80161e,%rax
+  804b1c:	00 00 00 
+  804b1f:	ff d0                	call   *%rax
+  804b21:	89 c7                	mov    %eax,%edi
+  804b23:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804b28:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804b2d:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  804b34:	00 00 00 
+  804b37:	48 b8 ab 16 80 00 00 	movabs $0x8016ab,%rax
+  804b3e:	00 00 00 
+  804b41:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  804b43:	48 ba 48 10 85 00 00 	movabs $0x851048,%rdx
+  804b4a:	00 00 00 
+  804b4d:	48 8b 02             	mov    (%rdx),%rax
+  804b50:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804b54:	48 89 0a             	mov    %rcx,(%rdx)
+  804b57:	48 ba 00 10 85 00 00 	movabs $0x851000,%rdx
+  804b5e:	00 00 00 
+  804b61:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  804b65:	48 b8 40 10 85 00 00 	movabs $0x851040,%rax
+  804b6c:	00 00 00 
+  804b6f:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  804b72:	e9 70 ff ff ff       	jmp    804ae7 <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  804b77:	89 c1                	mov    %eax,%ecx
+  804b79:	48 ba 56 57 80 00 00 	movabs $0x805756,%rdx
+  804b80:	00 00 00 
+  804b83:	be 3d 00 00 00       	mov    $0x3d,%esi
+  804b88:	48 bf 48 57 80 00 00 	movabs $0x805748,%rdi
+  804b8f:	00 00 00 
+  804b92:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b97:	49 b8 d7 06 80 00 00 	movabs $0x8006d7,%r8
+  804b9e:	00 00 00 
+  804ba1:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  804ba4:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ba9:	e9 61 ff ff ff       	jmp    804b0f <add_pgfault_handler+0x9d>
+
+0000000000804bae <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  804bae:	55                   	push   %rbp
+  804baf:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  804bb2:	48 b8 40 10 85 00 00 	movabs $0x851040,%rax
+  804bb9:	00 00 00 
+  804bbc:	80 38 00             	cmpb   $0x0,(%rax)
+  804bbf:	74 33                	je     804bf4 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804bc1:	48 a1 48 10 85 00 00 	movabs 0x851048,%rax
+  804bc8:	00 00 00 
+  804bcb:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  804bd0:	48 ba 00 10 85 00 00 	movabs $0x851000,%rdx
+  804bd7:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804bda:	48 85 c0             	test   %rax,%rax
+  804bdd:	0f 84 85 00 00 00    	je     804c68 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  804be3:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  804be7:	74 40                	je     804c29 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804be9:	48 83 c1 01          	add    $0x1,%rcx
+  804bed:	48 39 c1             	cmp    %rax,%rcx
+  804bf0:	75 f1                	jne    804be3 <remove_pgfault_handler+0x35>
+  804bf2:	eb 74                	jmp    804c68 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  804bf4:	48 b9 6e 57 80 00 00 	movabs $0x80576e,%rcx
+  804bfb:	00 00 00 
+  804bfe:	48 ba a7 56 80 00 00 	movabs $0x8056a7,%rdx
+  804c05:	00 00 00 
+  804c08:	be 43 00 00 00       	mov    $0x43,%esi
+  804c0d:	48 bf 48 57 80 00 00 	movabs $0x805748,%rdi
+  804c14:	00 00 00 
+  804c17:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c1c:	49 b8 d7 06 80 00 00 	movabs $0x8006d7,%r8
+  804c23:	00 00 00 
+  804c26:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  804c29:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  804c30:	00 
+  804c31:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804c35:	48 29 ca             	sub    %rcx,%rdx
+  804c38:	48 b8 00 10 85 00 00 	movabs $0x851000,%rax
+  804c3f:	00 00 00 
+  804c42:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  804c46:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  804c4b:	48 89 ce             	mov    %rcx,%rsi
+  804c4e:	48 b8 46 13 80 00 00 	movabs $0x801346,%rax
+  804c55:	00 00 00 
+  804c58:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  804c5a:	48 b8 48 10 85 00 00 	movabs $0x851048,%rax
+  804c61:	00 00 00 
+  804c64:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  804c68:	5d                   	pop    %rbp
+  804c69:	c3                   	ret
+
+0000000000804c6a <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  804c6a:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  804c6d:	48 b8 e8 49 80 00 00 	movabs $0x8049e8,%rax
+  804c74:	00 00 00 
+    call *%rax
+  804c77:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  804c79:	41 5f                	pop    %r15
+	popq %r15
+  804c7b:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  804c7d:	41 5f                	pop    %r15
+	popq %r14
+  804c7f:	41 5e                	pop    %r14
+	popq %r13
+  804c81:	41 5d                	pop    %r13
+	popq %r12
+  804c83:	41 5c                	pop    %r12
+	popq %r11
+  804c85:	41 5b                	pop    %r11
+	popq %r10
+  804c87:	41 5a                	pop    %r10
+	popq %r9
+  804c89:	41 59                	pop    %r9
+	popq %r8
+  804c8b:	41 58                	pop    %r8
+	popq %rsi
+  804c8d:	5e                   	pop    %rsi
+	popq %rdi
+  804c8e:	5f                   	pop    %rdi
+	popq %rbp
+  804c8f:	5d                   	pop    %rbp
+	popq %rdx
+  804c90:	5a                   	pop    %rdx
+	popq %rcx
+  804c91:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  804c92:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  804c97:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  804c9c:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  804ca0:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  804ca3:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  804ca8:	5b                   	pop    %rbx
+	popq %rax
+  804ca9:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  804caa:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  804cae:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  804caf:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  804cb4:	c3                   	ret
+
+0000000000804cb5 <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  804cb5:	55                   	push   %rbp
+  804cb6:	48 89 e5             	mov    %rsp,%rbp
+  804cb9:	41 55                	push   %r13
+  804cbb:	41 54                	push   %r12
+  804cbd:	53                   	push   %rbx
+  804cbe:	48 83 ec 08          	sub    $0x8,%rsp
+  804cc2:	49 89 fd             	mov    %rdi,%r13
+  804cc5:	48 89 f7             	mov    %rsi,%rdi
+  804cc8:	48 89 d3             	mov    %rdx,%rbx
+  804ccb:	49 89 cc             	mov    %rcx,%r12
+  804cce:	4c 89 c2             	mov    %r8,%rdx
+  804cd1:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804cd4:	48 85 f6             	test   %rsi,%rsi
+  804cd7:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804cde:	00 00 00 
+  804ce1:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  804ce5:	be 00 10 00 00       	mov    $0x1000,%esi
+  804cea:	48 85 db             	test   %rbx,%rbx
+  804ced:	74 03                	je     804cf2 <ipc_recv_futex+0x3d>
+  804cef:	48 8b 33             	mov    (%rbx),%rsi
+  804cf2:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  804cf6:	48 b8 f5 18 80 00 00 	movabs $0x8018f5,%rax
+  804cfd:	00 00 00 
+  804d00:	ff d0                	call   *%rax
+    if (res < 0) {
+  804d02:	85 c0                	test   %eax,%eax
+  804d04:	78 75                	js     804d7b <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  804d06:	4d 85 ed             	test   %r13,%r13
+  804d09:	74 14                	je     804d1f <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  804d0b:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  804d12:	00 00 00 
+  804d15:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  804d1b:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  804d1f:	4d 85 e4             	test   %r12,%r12
+  804d22:	74 14                	je     804d38 <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  804d24:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  804d2b:	00 00 00 
+  804d2e:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  804d34:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  804d38:	48 85 db             	test   %rbx,%rbx
+  804d3b:	74 23                	je     804d60 <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804d3d:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  804d44:	00 00 00 
+  804d47:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  804d4d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804d52:	85 c9                	test   %ecx,%ecx
+  804d54:	74 07                	je     804d5d <ipc_recv_futex+0xa8>
+  804d56:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  804d5d:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  804d60:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  804d67:	00 00 00 
+  804d6a:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  804d70:	48 83 c4 08          	add    $0x8,%rsp
+  804d74:	5b                   	pop    %rbx
+  804d75:	41 5c                	pop    %r12
+  804d77:	41 5d                	pop    %r13
+  804d79:	5d                   	pop    %rbp
+  804d7a:	c3                   	ret
+        if (from_env_store != NULL) {
+  804d7b:	4d 85 ed             	test   %r13,%r13
+  804d7e:	74 08                	je     804d88 <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  804d80:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804d87:	00 
+        if (perm_store != NULL) {
+  804d88:	4d 85 e4             	test   %r12,%r12
+  804d8b:	74 08                	je     804d95 <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  804d8d:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804d94:	00 
+        if (size != NULL) {
+  804d95:	48 85 db             	test   %rbx,%rbx
+  804d98:	74 d6                	je     804d70 <ipc_recv_futex+0xbb>
+            *size = 0;
+  804d9a:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  804da1:	eb cd                	jmp    804d70 <ipc_recv_futex+0xbb>
+
+0000000000804da3 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804da3:	55                   	push   %rbp
+  804da4:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  804da7:	48 83 ec 08          	sub    $0x8,%rsp
+  804dab:	6a 00                	push   $0x0
+  804dad:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804db3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804db9:	48 b8 b5 4c 80 00 00 	movabs $0x804cb5,%rax
+  804dc0:	00 00 00 
+  804dc3:	ff d0                	call   *%rax
+}
+  804dc5:	c9                   	leave
+  804dc6:	c3                   	ret
+
+0000000000804dc7 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  804dc7:	55                   	push   %rbp
+  804dc8:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804dcb:	48 85 d2             	test   %rdx,%rdx
+  804dce:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804dd5:	00 00 00 
+  804dd8:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  804ddc:	89 f6                	mov    %esi,%esi
+  804dde:	48 b8 de 18 80 00 00 	movabs $0x8018de,%rax
+  804de5:	00 00 00 
+  804de8:	ff d0                	call   *%rax
+    if (res < 0) {
+  804dea:	85 c0                	test   %eax,%eax
+  804dec:	78 02                	js     804df0 <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  804dee:	5d                   	pop    %rbp
+  804def:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  804df0:	89 c1                	mov    %eax,%ecx
+  804df2:	48 ba 88 57 80 00 00 	movabs $0x805788,%rdx
+  804df9:	00 00 00 
+  804dfc:	be 50 00 00 00       	mov    $0x50,%esi
+  804e01:	48 bf 9c 57 80 00 00 	movabs $0x80579c,%rdi
+  804e08:	00 00 00 
+  804e0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e10:	49 b8 d7 06 80 00 00 	movabs $0x8006d7,%r8
+  804e17:	00 00 00 
+  804e1a:	41 ff d0             	call   *%r8
+
+0000000000804e1d <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804e1d:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  804e22:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804e29:	00 00 00 
+  804e2c:	48 89 d0             	mov    %rdx,%rax
+  804e2f:	48 c1 e0 04          	shl    $0x4,%rax
+  804e33:	48 29 d0             	sub    %rdx,%rax
+  804e36:	48 c1 e0 05          	shl    $0x5,%rax
+  804e3a:	48 01 c8             	add    %rcx,%rax
+  804e3d:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  804e43:	39 f8                	cmp    %edi,%eax
+  804e45:	74 13                	je     804e5a <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  804e47:	48 83 c2 01          	add    $0x1,%rdx
+  804e4b:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  804e52:	75 d8                	jne    804e2c <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804e54:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804e59:	c3                   	ret
+            return envs[i].env_id;
+  804e5a:	48 89 d0             	mov    %rdx,%rax
+  804e5d:	48 c1 e0 04          	shl    $0x4,%rax
+  804e61:	48 29 d0             	sub    %rdx,%rax
+  804e64:	48 c1 e0 05          	shl    $0x5,%rax
+  804e68:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804e6f:	00 00 00 
+  804e72:	48 01 d0             	add    %rdx,%rax
+  804e75:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804e7b:	c3                   	ret
+  804e7c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000804e80 <__rodata_start>:
+  804e80:	73 68                	jae    804eea <__rodata_start+0x6a>
+  804e82:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804e83:	72 74                	jb     804ef9 <__rodata_start+0x79>
+  804e85:	20 6c 69 6e          	and    %ch,0x6e(%rcx,%rbp,2)
+  804e89:	65 20 72 65          	and    %dh,%gs:0x65(%rdx)
+  804e8d:	61                   	(bad)
+  804e8e:	64 3a 20             	cmp    %fs:(%rax),%ah
+  804e91:	25 69 00 75 73       	and    $0x73750069,%eax
+  804e96:	65 72 2f             	gs jb  804ec8 <__rodata_start+0x48>
+  804e99:	74 65                	je     804f00 <__rodata_start+0x80>
+  804e9b:	73 74                	jae    804f11 <__rodata_start+0x91>
+  804e9d:	66 73 63             	data16 jae 804f03 <__rodata_start+0x83>
+  804ea0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804ea1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804ea2:	63 2e                	movsxd (%rsi),%ebp
+  804ea4:	63 00                	movsxd (%rax),%eax
+  804ea6:	6c                   	insb   (%dx),%es:(%rdi)
+  804ea7:	69 6e 65 20 25 6c 64 	imul   $0x646c2520,0x65(%rsi),%ebp
+  804eae:	20 69 73             	and    %ch,0x73(%rcx)
+  804eb1:	20 77 72             	and    %dh,0x72(%rdi)
+  804eb4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804eb5:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804eb6:	67 00 72 65          	add    %dh,0x65(%edx)
+  804eba:	61                   	(bad)
+  804ebb:	64 20 2f             	and    %ch,%fs:(%rdi)
+  804ebe:	62                   	(bad)
+  804ebf:	69 67 66 69 6c 65 3a 	imul   $0x3a656c69,0x66(%rdi),%esp
+  804ec6:	20 25 69 00 73 68    	and    %ah,0x68730069(%rip)        # 68f34f35 <__bss_end+0x686e2f35>
+  804ecc:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804ecd:	72 74                	jb     804f43 <__rodata_start+0xc3>
+  804ecf:	20 72 65             	and    %dh,0x65(%rdx)
+  804ed2:	61                   	(bad)
+  804ed3:	64 3a 20             	cmp    %fs:(%rax),%ah
+  804ed6:	25 69 00 70 69       	and    $0x69700069,%eax
+  804edb:	65 63 65 20          	movsxd %gs:0x20(%rbp),%esp
+  804edf:	73 74                	jae    804f55 <__rodata_start+0xd5>
+  804ee1:	61                   	(bad)
+  804ee2:	72 74                	jb     804f58 <__rodata_start+0xd8>
+  804ee4:	73 20                	jae    804f06 <__rodata_start+0x86>
+  804ee6:	61                   	(bad)
+  804ee7:	74 20                	je     804f09 <__rodata_start+0x89>
+  804ee9:	6c                   	insb   (%dx),%es:(%rdi)
+  804eea:	69 6e 65 20 25 6c 64 	imul   $0x646c2520,0x65(%rsi),%ebp
+  804ef1:	00 2f                	add    %ch,(%rdi)
+  804ef3:	62                   	(bad)
+  804ef4:	69 67 66 69 6c 65 00 	imul   $0x656c69,0x66(%rdi),%esp
+  804efb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804efc:	70 65                	jo     804f63 <__rodata_start+0xe3>
+  804efe:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804eff:	20 2f                	and    %ch,(%rdi)
+  804f01:	62                   	(bad)
+  804f02:	69 67 66 69 6c 65 3a 	imul   $0x3a656c69,0x66(%rdi),%esp
+  804f09:	20 25 69 00 66 6f    	and    %ah,0x6f660069(%rip)        # 6fe64f78 <__bss_end+0x6f612f78>
+  804f0f:	72 6b                	jb     804f7c <__rodata_start+0xfc>
+  804f11:	3a 20                	cmp    (%rax),%ah
+  804f13:	25 69 00 73 79       	and    $0x79730069,%eax
+  804f18:	73 5f                	jae    804f79 <__rodata_start+0xf9>
+  804f1a:	61                   	(bad)
+  804f1b:	6c                   	insb   (%dx),%es:(%rdi)
+  804f1c:	6c                   	insb   (%dx),%es:(%rdi)
+  804f1d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804f1e:	63 5f 72             	movsxd 0x72(%rdi),%ebx
+  804f21:	65 67 69 6f 6e 3a 20 	imul   $0x6925203a,%gs:0x6e(%edi),%ebp
+  804f28:	25 69 
+  804f2a:	00 70 69             	add    %dh,0x69(%rax)
+  804f2d:	65 63 65 20          	movsxd %gs:0x20(%rbp),%esp
+  804f31:	25 6c 75 20 77       	and    $0x7720756c,%eax
+  804f36:	61                   	(bad)
+  804f37:	73 20                	jae    804f59 <__rodata_start+0xd9>
+  804f39:	72 65                	jb     804fa0 <__rodata_start+0x120>
+  804f3b:	61                   	(bad)
+  804f3c:	64 20 25 75 20 74 69 	and    %ah,%fs:0x69742075(%rip)        # 69f46fb8 <__bss_end+0x696f4fb8>
+  804f43:	6d                   	insl   (%dx),%es:(%rdi)
+  804f44:	65 73 00             	gs jae 804f47 <__rodata_start+0xc7>
+  804f47:	6c                   	insb   (%dx),%es:(%rdi)
+  804f48:	69 6e 65 20 25 6c 75 	imul   $0x756c2520,0x65(%rsi),%ebp
+  804f4f:	20 77 61             	and    %dh,0x61(%rdi)
+  804f52:	73 20                	jae    804f74 <__rodata_start+0xf4>
+  804f54:	72 65                	jb     804fbb <__rodata_start+0x13b>
+  804f56:	61                   	(bad)
+  804f57:	64 20 25 75 20 74 69 	and    %ah,%fs:0x69742075(%rip)        # 69f46fd3 <__bss_end+0x696f4fd3>
+  804f5e:	6d                   	insl   (%dx),%es:(%rdi)
+  804f5f:	65 73 00             	gs jae 804f62 <__rodata_start+0xe2>
+  804f62:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+  804f68:	4a                   	rex.WX
+  804f69:	4f 53                	rex.WRXB push %r11
+  804f6b:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  804f6f:	6b 20 62             	imul   $0x62,(%rax),%esp
+  804f72:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804f74:	63 68 6d             	movsxd 0x6d(%rax),%ebp
+  804f77:	61                   	(bad)
+  804f78:	72 6b                	jb     804fe5 <__rodata_start+0x165>
+  804f7a:	20 64 61 74          	and    %ah,0x74(%rcx,%riz,2)
+  804f7e:	61                   	(bad)
+  804f7f:	20 25 30 37 6c 64    	and    %ah,0x646c3730(%rip)        # 64ec86b5 <__bss_end+0x646766b5>
+  804f85:	0a 00                	or     (%rax),%al
+  804f87:	00 6c 69 6e          	add    %ch,0x6e(%rcx,%rbp,2)
+  804f8b:	65 20 25 6c 64 20 6f 	and    %ah,%gs:0x6f20646c(%rip)        # 6fa0b3fe <__bss_end+0x6f1b93fe>
+  804f92:	66 20 74 68 65       	data16 and %dh,0x65(%rax,%rbp,2)
+  804f97:	20 70 69             	and    %dh,0x69(%rax)
+  804f9a:	65 63 65 20          	movsxd %gs:0x20(%rbp),%esp
+  804f9e:	61                   	(bad)
+  804f9f:	74 20                	je     804fc1 <__rodata_start+0x141>
+  804fa1:	6c                   	insb   (%dx),%es:(%rdi)
+  804fa2:	69 6e 65 20 25 6c 64 	imul   $0x646c2520,0x65(%rsi),%ebp
+  804fa9:	20 69 73             	and    %ch,0x73(%rcx)
+  804fac:	20 77 72             	and    %dh,0x72(%rdi)
+  804faf:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804fb0:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804fb1:	67 00 00             	add    %al,(%eax)
+  804fb4:	00 00                	add    %al,(%rax)
+  804fb6:	00 00                	add    %al,(%rax)
+  804fb8:	63 6f 6e             	movsxd 0x6e(%rdi),%ebp
+  804fbb:	63 75 72             	movsxd 0x72(%rbp),%esi
+  804fbe:	72 65                	jb     805025 <__rodata_start+0x1a5>
+  804fc0:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804fc1:	74 20                	je     804fe3 <__rodata_start+0x163>
+  804fc3:	73 68                	jae    80502d <__rodata_start+0x1ad>
+  804fc5:	61                   	(bad)
+  804fc6:	72 65                	jb     80502d <__rodata_start+0x1ad>
+  804fc8:	64 20 66 64          	and    %ah,%fs:0x64(%rsi)
+  804fcc:	20 72 65             	and    %dh,0x65(%rdx)
+  804fcf:	61                   	(bad)
+  804fd0:	64 73 20             	fs jae 804ff3 <__rodata_start+0x173>
+  804fd3:	61                   	(bad)
+  804fd4:	72 65                	jb     80503b <__rodata_start+0x1bb>
+  804fd6:	20 67 6f             	and    %ah,0x6f(%rdi)
+  804fd9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804fda:	64 0a 00             	or     %fs:(%rax),%al
+  804fdd:	00 00                	add    %al,(%rax)
+  804fdf:	00 63 6f             	add    %ah,0x6f(%rbx)
+  804fe2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804fe3:	63 75 72             	movsxd 0x72(%rbp),%esi
+  804fe6:	72 65                	jb     80504d <__rodata_start+0x1cd>
+  804fe8:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804fe9:	74 20                	je     80500b <__rodata_start+0x18b>
+  804feb:	73 6d                	jae    80505a <__rodata_start+0x1da>
+  804fed:	61                   	(bad)
+  804fee:	6c                   	insb   (%dx),%es:(%rdi)
+  804fef:	6c                   	insb   (%dx),%es:(%rdi)
+  804ff0:	20 73 68             	and    %dh,0x68(%rbx)
+  804ff3:	61                   	(bad)
+  804ff4:	72 65                	jb     80505b <__rodata_start+0x1db>
+  804ff6:	64 20 66 64          	and    %ah,%fs:0x64(%rsi)
+  804ffa:	20 72 65             	and    %dh,0x65(%rdx)
+  804ffd:	61                   	(bad)
+  804ffe:	64 73 20             	fs jae 805021 <__rodata_start+0x1a1>
+  805001:	61                   	(bad)
+  805002:	72 65                	jb     805069 <__rodata_start+0x1e9>
+  805004:	20 67 6f             	and    %ah,0x6f(%rdi)
+  805007:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805008:	64 0a 00             	or     %fs:(%rax),%al
+  80500b:	3c 75                	cmp    $0x75,%al
+  80500d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80500e:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  805012:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805013:	3e 00 0f             	ds add %cl,(%rdi)
+  805016:	1f                   	(bad)
+  805017:	00 5b 25             	add    %bl,0x25(%rbx)
+  80501a:	30 38                	xor    %bh,(%rax)
+  80501c:	78 5d                	js     80507b <__rodata_start+0x1fb>
+  80501e:	20 75 73             	and    %dh,0x73(%rbp)
+  805021:	65 72 20             	gs jb  805044 <__rodata_start+0x1c4>
+  805024:	70 61                	jo     805087 <__rodata_start+0x207>
+  805026:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805027:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  80502e:	73 20                	jae    805050 <__rodata_start+0x1d0>
+  805030:	61                   	(bad)
+  805031:	74 20                	je     805053 <__rodata_start+0x1d3>
+  805033:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  805038:	3a 20                	cmp    (%rax),%ah
+  80503a:	00 30                	add    %dh,(%rax)
+  80503c:	31 32                	xor    %esi,(%rdx)
+  80503e:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  805045:	41                   	rex.B
+  805046:	42                   	rex.X
+  805047:	43                   	rex.XB
+  805048:	44                   	rex.R
+  805049:	45                   	rex.RB
+  80504a:	46 00 30             	rex.RX add %r14b,(%rax)
+  80504d:	31 32                	xor    %esi,(%rdx)
+  80504f:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  805056:	61                   	(bad)
+  805057:	62 63 64 65 66       	(bad)
+  80505c:	00 28                	add    %ch,(%rax)
+  80505e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80505f:	75 6c                	jne    8050cd <__rodata_start+0x24d>
+  805061:	6c                   	insb   (%dx),%es:(%rdi)
+  805062:	29 00                	sub    %eax,(%rax)
+  805064:	65 72 72             	gs jb  8050d9 <__rodata_start+0x259>
+  805067:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805068:	72 20                	jb     80508a <__rodata_start+0x20a>
+  80506a:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  80506f:	73 70                	jae    8050e1 <__rodata_start+0x261>
+  805071:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  805075:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  80507c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80507d:	72 00                	jb     80507f <__rodata_start+0x1ff>
+  80507f:	62 61 64 20 65       	(bad)
+  805084:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805085:	76 69                	jbe    8050f0 <__rodata_start+0x270>
+  805087:	72 6f                	jb     8050f8 <__rodata_start+0x278>
+  805089:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80508a:	6d                   	insl   (%dx),%es:(%rdi)
+  80508b:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80508d:	74 00                	je     80508f <__rodata_start+0x20f>
+  80508f:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  805096:	20 70 61             	and    %dh,0x61(%rax)
+  805099:	72 61                	jb     8050fc <__rodata_start+0x27c>
+  80509b:	6d                   	insl   (%dx),%es:(%rdi)
+  80509c:	65 74 65             	gs je  805104 <__rodata_start+0x284>
+  80509f:	72 00                	jb     8050a1 <__rodata_start+0x221>
+  8050a1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8050a2:	75 74                	jne    805118 <__rodata_start+0x298>
+  8050a4:	20 6f 66             	and    %ch,0x66(%rdi)
+  8050a7:	20 6d 65             	and    %ch,0x65(%rbp)
+  8050aa:	6d                   	insl   (%dx),%es:(%rdi)
+  8050ab:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8050ac:	72 79                	jb     805127 <__rodata_start+0x2a7>
+  8050ae:	00 6f 75             	add    %ch,0x75(%rdi)
+  8050b1:	74 20                	je     8050d3 <__rodata_start+0x253>
+  8050b3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8050b4:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  8050b8:	76 69                	jbe    805123 <__rodata_start+0x2a3>
+  8050ba:	72 6f                	jb     80512b <__rodata_start+0x2ab>
+  8050bc:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8050bd:	6d                   	insl   (%dx),%es:(%rdi)
+  8050be:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8050c0:	74 73                	je     805135 <__rodata_start+0x2b5>
+  8050c2:	00 63 6f             	add    %ah,0x6f(%rbx)
+  8050c5:	72 72                	jb     805139 <__rodata_start+0x2b9>
+  8050c7:	75 70                	jne    805139 <__rodata_start+0x2b9>
+  8050c9:	74 65                	je     805130 <__rodata_start+0x2b0>
+  8050cb:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  8050d0:	75 67                	jne    805139 <__rodata_start+0x2b9>
+  8050d2:	20 69 6e             	and    %ch,0x6e(%rcx)
+  8050d5:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8050d7:	00 73 65             	add    %dh,0x65(%rbx)
+  8050da:	67 6d                	insl   (%dx),%es:(%edi)
+  8050dc:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8050de:	74 61                	je     805141 <__rodata_start+0x2c1>
+  8050e0:	74 69                	je     80514b <__rodata_start+0x2cb>
+  8050e2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8050e3:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8050e4:	20 66 61             	and    %ah,0x61(%rsi)
+  8050e7:	75 6c                	jne    805155 <__rodata_start+0x2d5>
+  8050e9:	74 00                	je     8050eb <__rodata_start+0x26b>
+  8050eb:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8050f2:	20 45 4c             	and    %al,0x4c(%rbp)
+  8050f5:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  8050f9:	61                   	(bad)
+  8050fa:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  8050ff:	20 73 75             	and    %dh,0x75(%rbx)
+  805102:	63 68 20             	movsxd 0x20(%rax),%ebp
+  805105:	73 79                	jae    805180 <__rodata_start+0x300>
+  805107:	73 74                	jae    80517d <__rodata_start+0x2fd>
+  805109:	65 6d                	gs insl (%dx),%es:(%rdi)
+  80510b:	20 63 61             	and    %ah,0x61(%rbx)
+  80510e:	6c                   	insb   (%dx),%es:(%rdi)
+  80510f:	6c                   	insb   (%dx),%es:(%rdi)
+  805110:	00 65 6e             	add    %ah,0x6e(%rbp)
+  805113:	74 72                	je     805187 <__rodata_start+0x307>
+  805115:	79 20                	jns    805137 <__rodata_start+0x2b7>
+  805117:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805118:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805119:	74 20                	je     80513b <__rodata_start+0x2bb>
+  80511b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80511d:	75 6e                	jne    80518d <__rodata_start+0x30d>
+  80511f:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  805123:	76 20                	jbe    805145 <__rodata_start+0x2c5>
+  805125:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  80512c:	72 65                	jb     805193 <__rodata_start+0x313>
+  80512e:	63 76 69             	movsxd 0x69(%rsi),%esi
+  805131:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805132:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  805136:	65 78 70             	gs js  8051a9 <__rodata_start+0x329>
+  805139:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  80513e:	20 65 6e             	and    %ah,0x6e(%rbp)
+  805141:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  805145:	20 66 69             	and    %ah,0x69(%rsi)
+  805148:	6c                   	insb   (%dx),%es:(%rdi)
+  805149:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  80514d:	20 66 72             	and    %ah,0x72(%rsi)
+  805150:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  805155:	61                   	(bad)
+  805156:	63 65 20             	movsxd 0x20(%rbp),%esp
+  805159:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80515a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80515b:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  80515f:	6b 00 74             	imul   $0x74,(%rax),%eax
+  805162:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805163:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805164:	20 6d 61             	and    %ch,0x61(%rbp)
+  805167:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805168:	79 20                	jns    80518a <__rodata_start+0x30a>
+  80516a:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  805171:	72 65                	jb     8051d8 <__rodata_start+0x358>
+  805173:	20 6f 70             	and    %ch,0x70(%rdi)
+  805176:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  805178:	00 66 69             	add    %ah,0x69(%rsi)
+  80517b:	6c                   	insb   (%dx),%es:(%rdi)
+  80517c:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  805180:	20 62 6c             	and    %ah,0x6c(%rdx)
+  805183:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805184:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  805187:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805188:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805189:	74 20                	je     8051ab <__rodata_start+0x32b>
+  80518b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80518d:	75 6e                	jne    8051fd <__rodata_start+0x37d>
+  80518f:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  805193:	76 61                	jbe    8051f6 <__rodata_start+0x376>
+  805195:	6c                   	insb   (%dx),%es:(%rdi)
+  805196:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  80519d:	00 
+  80519e:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  8051a5:	72 65                	jb     80520c <__rodata_start+0x38c>
+  8051a7:	61                   	(bad)
+  8051a8:	64 79 20             	fs jns 8051cb <__rodata_start+0x34b>
+  8051ab:	65 78 69             	gs js  805217 <__rodata_start+0x397>
+  8051ae:	73 74                	jae    805224 <__rodata_start+0x3a4>
+  8051b0:	73 00                	jae    8051b2 <__rodata_start+0x332>
+  8051b2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8051b3:	70 65                	jo     80521a <__rodata_start+0x39a>
+  8051b5:	72 61                	jb     805218 <__rodata_start+0x398>
+  8051b7:	74 69                	je     805222 <__rodata_start+0x3a2>
+  8051b9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8051ba:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8051bb:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  8051be:	74 20                	je     8051e0 <__rodata_start+0x360>
+  8051c0:	73 75                	jae    805237 <__rodata_start+0x3b7>
+  8051c2:	70 70                	jo     805234 <__rodata_start+0x3b4>
+  8051c4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8051c5:	72 74                	jb     80523b <__rodata_start+0x3bb>
+  8051c7:	65 64 00 74 72 79    	gs add %dh,%fs:0x79(%rdx,%rsi,2)
+  8051cd:	20 61 67             	and    %ah,0x67(%rcx)
+  8051d0:	61                   	(bad)
+  8051d1:	69 6e 00 74 69 6d 65 	imul   $0x656d6974,0x0(%rsi),%ebp
+  8051d8:	64 20 6f 75          	and    %ch,%fs:0x75(%rdi)
+  8051dc:	74 00                	je     8051de <__rodata_start+0x35e>
+  8051de:	66 69 6c 65 20 69 73 	imul   $0x7369,0x20(%rbp,%riz,2),%bp
+  8051e5:	20 69 6e             	and    %ch,0x6e(%rcx)
+  8051e8:	20 75 73             	and    %dh,0x73(%rbp)
+  8051eb:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  8051ef:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  8051f6:	00 
+  8051f7:	66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+  8051fe:	00 00 
+  805200:	14 0a                	adc    $0xa,%al
+  805202:	80 00 00             	addb   $0x0,(%rax)
+  805205:	00 00                	add    %al,(%rax)
+  805207:	00 55 10             	add    %dl,0x10(%rbp)
+  80520a:	80 00 00             	addb   $0x0,(%rax)
+  80520d:	00 00                	add    %al,(%rax)
+  80520f:	00 45 10             	add    %al,0x10(%rbp)
+  805212:	80 00 00             	addb   $0x0,(%rax)
+  805215:	00 00                	add    %al,(%rax)
+  805217:	00 55 10             	add    %dl,0x10(%rbp)
+  80521a:	80 00 00             	addb   $0x0,(%rax)
+  80521d:	00 00                	add    %al,(%rax)
+  80521f:	00 55 10             	add    %dl,0x10(%rbp)
+  805222:	80 00 00             	addb   $0x0,(%rax)
+  805225:	00 00                	add    %al,(%rax)
+  805227:	00 55 10             	add    %dl,0x10(%rbp)
+  80522a:	80 00 00             	addb   $0x0,(%rax)
+  80522d:	00 00                	add    %al,(%rax)
+  80522f:	00 55 10             	add    %dl,0x10(%rbp)
+  805232:	80 00 00             	addb   $0x0,(%rax)
+  805235:	00 00                	add    %al,(%rax)
+  805237:	00 33                	add    %dh,(%rbx)
+  805239:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80523f:	00 55 10             	add    %dl,0x10(%rbp)
+  805242:	80 00 00             	addb   $0x0,(%rax)
+  805245:	00 00                	add    %al,(%rax)
+  805247:	00 55 10             	add    %dl,0x10(%rbp)
+  80524a:	80 00 00             	addb   $0x0,(%rax)
+  80524d:	00 00                	add    %al,(%rax)
+  80524f:	00 27                	add    %ah,(%rdi)
+  805251:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805257:	00 a1 0a 80 00 00    	add    %ah,0x800a(%rcx)
+  80525d:	00 00                	add    %al,(%rax)
+  80525f:	00 55 10             	add    %dl,0x10(%rbp)
+  805262:	80 00 00             	addb   $0x0,(%rax)
+  805265:	00 00                	add    %al,(%rax)
+  805267:	00 27                	add    %ah,(%rdi)
+  805269:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80526f:	00 6d 0a             	add    %ch,0xa(%rbp)
+  805272:	80 00 00             	addb   $0x0,(%rax)
+  805275:	00 00                	add    %al,(%rax)
+  805277:	00 6d 0a             	add    %ch,0xa(%rbp)
+  80527a:	80 00 00             	addb   $0x0,(%rax)
+  80527d:	00 00                	add    %al,(%rax)
+  80527f:	00 6d 0a             	add    %ch,0xa(%rbp)
+  805282:	80 00 00             	addb   $0x0,(%rax)
+  805285:	00 00                	add    %al,(%rax)
+  805287:	00 6d 0a             	add    %ch,0xa(%rbp)
+  80528a:	80 00 00             	addb   $0x0,(%rax)
+  80528d:	00 00                	add    %al,(%rax)
+  80528f:	00 6d 0a             	add    %ch,0xa(%rbp)
+  805292:	80 00 00             	addb   $0x0,(%rax)
+  805295:	00 00                	add    %al,(%rax)
+  805297:	00 6d 0a             	add    %ch,0xa(%rbp)
+  80529a:	80 00 00             	addb   $0x0,(%rax)
+  80529d:	00 00                	add    %al,(%rax)
+  80529f:	00 6d 0a             	add    %ch,0xa(%rbp)
+  8052a2:	80 00 00             	addb   $0x0,(%rax)
+  8052a5:	00 00                	add    %al,(%rax)
+  8052a7:	00 6d 0a             	add    %ch,0xa(%rbp)
+  8052aa:	80 00 00             	addb   $0x0,(%rax)
+  8052ad:	00 00                	add    %al,(%rax)
+  8052af:	00 6d 0a             	add    %ch,0xa(%rbp)
+  8052b2:	80 00 00             	addb   $0x0,(%rax)
+  8052b5:	00 00                	add    %al,(%rax)
+  8052b7:	00 55 10             	add    %dl,0x10(%rbp)
+  8052ba:	80 00 00             	addb   $0x0,(%rax)
+  8052bd:	00 00                	add    %al,(%rax)
+  8052bf:	00 55 10             	add    %dl,0x10(%rbp)
+  8052c2:	80 00 00             	addb   $0x0,(%rax)
+  8052c5:	00 00                	add    %al,(%rax)
+  8052c7:	00 55 10             	add    %dl,0x10(%rbp)
+  8052ca:	80 00 00             	addb   $0x0,(%rax)
+  8052cd:	00 00                	add    %al,(%rax)
+  8052cf:	00 55 10             	add    %dl,0x10(%rbp)
+  8052d2:	80 00 00             	addb   $0x0,(%rax)
+  8052d5:	00 00                	add    %al,(%rax)
+  8052d7:	00 55 10             	add    %dl,0x10(%rbp)
+  8052da:	80 00 00             	addb   $0x0,(%rax)
+  8052dd:	00 00                	add    %al,(%rax)
+  8052df:	00 55 10             	add    %dl,0x10(%rbp)
+  8052e2:	80 00 00             	addb   $0x0,(%rax)
+  8052e5:	00 00                	add    %al,(%rax)
+  8052e7:	00 55 10             	add    %dl,0x10(%rbp)
+  8052ea:	80 00 00             	addb   $0x0,(%rax)
+  8052ed:	00 00                	add    %al,(%rax)
+  8052ef:	00 55 10             	add    %dl,0x10(%rbp)
+  8052f2:	80 00 00             	addb   $0x0,(%rax)
+  8052f5:	00 00                	add    %al,(%rax)
+  8052f7:	00 55 10             	add    %dl,0x10(%rbp)
+  8052fa:	80 00 00             	addb   $0x0,(%rax)
+  8052fd:	00 00                	add    %al,(%rax)
+  8052ff:	00 55 10             	add    %dl,0x10(%rbp)
+  805302:	80 00 00             	addb   $0x0,(%rax)
+  805305:	00 00                	add    %al,(%rax)
+  805307:	00 55 10             	add    %dl,0x10(%rbp)
+  80530a:	80 00 00             	addb   $0x0,(%rax)
+  80530d:	00 00                	add    %al,(%rax)
+  80530f:	00 55 10             	add    %dl,0x10(%rbp)
+  805312:	80 00 00             	addb   $0x0,(%rax)
+  805315:	00 00                	add    %al,(%rax)
+  805317:	00 55 10             	add    %dl,0x10(%rbp)
+  80531a:	80 00 00             	addb   $0x0,(%rax)
+  80531d:	00 00                	add    %al,(%rax)
+  80531f:	00 55 10             	add    %dl,0x10(%rbp)
+  805322:	80 00 00             	addb   $0x0,(%rax)
+  805325:	00 00                	add    %al,(%rax)
+  805327:	00 55 10             	add    %dl,0x10(%rbp)
+  80532a:	80 00 00             	addb   $0x0,(%rax)
+  80532d:	00 00                	add    %al,(%rax)
+  80532f:	00 55 10             	add    %dl,0x10(%rbp)
+  805332:	80 00 00             	addb   $0x0,(%rax)
+  805335:	00 00                	add    %al,(%rax)
+  805337:	00 55 10             	add    %dl,0x10(%rbp)
+  80533a:	80 00 00             	addb   $0x0,(%rax)
+  80533d:	00 00                	add    %al,(%rax)
+  80533f:	00 55 10             	add    %dl,0x10(%rbp)
+  805342:	80 00 00             	addb   $0x0,(%rax)
+  805345:	00 00                	add    %al,(%rax)
+  805347:	00 55 10             	add    %dl,0x10(%rbp)
+  80534a:	80 00 00             	addb   $0x0,(%rax)
+  80534d:	00 00                	add    %al,(%rax)
+  80534f:	00 55 10             	add    %dl,0x10(%rbp)
+  805352:	80 00 00             	addb   $0x0,(%rax)
+  805355:	00 00                	add    %al,(%rax)
+  805357:	00 55 10             	add    %dl,0x10(%rbp)
+  80535a:	80 00 00             	addb   $0x0,(%rax)
+  80535d:	00 00                	add    %al,(%rax)
+  80535f:	00 55 10             	add    %dl,0x10(%rbp)
+  805362:	80 00 00             	addb   $0x0,(%rax)
+  805365:	00 00                	add    %al,(%rax)
+  805367:	00 55 10             	add    %dl,0x10(%rbp)
+  80536a:	80 00 00             	addb   $0x0,(%rax)
+  80536d:	00 00                	add    %al,(%rax)
+  80536f:	00 55 10             	add    %dl,0x10(%rbp)
+  805372:	80 00 00             	addb   $0x0,(%rax)
+  805375:	00 00                	add    %al,(%rax)
+  805377:	00 55 10             	add    %dl,0x10(%rbp)
+  80537a:	80 00 00             	addb   $0x0,(%rax)
+  80537d:	00 00                	add    %al,(%rax)
+  80537f:	00 55 10             	add    %dl,0x10(%rbp)
+  805382:	80 00 00             	addb   $0x0,(%rax)
+  805385:	00 00                	add    %al,(%rax)
+  805387:	00 55 10             	add    %dl,0x10(%rbp)
+  80538a:	80 00 00             	addb   $0x0,(%rax)
+  80538d:	00 00                	add    %al,(%rax)
+  80538f:	00 55 10             	add    %dl,0x10(%rbp)
+  805392:	80 00 00             	addb   $0x0,(%rax)
+  805395:	00 00                	add    %al,(%rax)
+  805397:	00 55 10             	add    %dl,0x10(%rbp)
+  80539a:	80 00 00             	addb   $0x0,(%rax)
+  80539d:	00 00                	add    %al,(%rax)
+  80539f:	00 55 10             	add    %dl,0x10(%rbp)
+  8053a2:	80 00 00             	addb   $0x0,(%rax)
+  8053a5:	00 00                	add    %al,(%rax)
+  8053a7:	00 78 0f             	add    %bh,0xf(%rax)
+  8053aa:	80 00 00             	addb   $0x0,(%rax)
+  8053ad:	00 00                	add    %al,(%rax)
+  8053af:	00 55 10             	add    %dl,0x10(%rbp)
+  8053b2:	80 00 00             	addb   $0x0,(%rax)
+  8053b5:	00 00                	add    %al,(%rax)
+  8053b7:	00 55 10             	add    %dl,0x10(%rbp)
+  8053ba:	80 00 00             	addb   $0x0,(%rax)
+  8053bd:	00 00                	add    %al,(%rax)
+  8053bf:	00 55 10             	add    %dl,0x10(%rbp)
+  8053c2:	80 00 00             	addb   $0x0,(%rax)
+  8053c5:	00 00                	add    %al,(%rax)
+  8053c7:	00 55 10             	add    %dl,0x10(%rbp)
+  8053ca:	80 00 00             	addb   $0x0,(%rax)
+  8053cd:	00 00                	add    %al,(%rax)
+  8053cf:	00 55 10             	add    %dl,0x10(%rbp)
+  8053d2:	80 00 00             	addb   $0x0,(%rax)
+  8053d5:	00 00                	add    %al,(%rax)
+  8053d7:	00 55 10             	add    %dl,0x10(%rbp)
+  8053da:	80 00 00             	addb   $0x0,(%rax)
+  8053dd:	00 00                	add    %al,(%rax)
+  8053df:	00 55 10             	add    %dl,0x10(%rbp)
+  8053e2:	80 00 00             	addb   $0x0,(%rax)
+  8053e5:	00 00                	add    %al,(%rax)
+  8053e7:	00 55 10             	add    %dl,0x10(%rbp)
+  8053ea:	80 00 00             	addb   $0x0,(%rax)
+  8053ed:	00 00                	add    %al,(%rax)
+  8053ef:	00 55 10             	add    %dl,0x10(%rbp)
+  8053f2:	80 00 00             	addb   $0x0,(%rax)
+  8053f5:	00 00                	add    %al,(%rax)
+  8053f7:	00 55 10             	add    %dl,0x10(%rbp)
+  8053fa:	80 00 00             	addb   $0x0,(%rax)
+  8053fd:	00 00                	add    %al,(%rax)
+  8053ff:	00 c4                	add    %al,%ah
+  805401:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805407:	00 93 0c 80 00 00    	add    %dl,0x800c(%rbx)
+  80540d:	00 00                	add    %al,(%rax)
+  80540f:	00 55 10             	add    %dl,0x10(%rbp)
+  805412:	80 00 00             	addb   $0x0,(%rax)
+  805415:	00 00                	add    %al,(%rax)
+  805417:	00 55 10             	add    %dl,0x10(%rbp)
+  80541a:	80 00 00             	addb   $0x0,(%rax)
+  80541d:	00 00                	add    %al,(%rax)
+  80541f:	00 55 10             	add    %dl,0x10(%rbp)
+  805422:	80 00 00             	addb   $0x0,(%rax)
+  805425:	00 00                	add    %al,(%rax)
+  805427:	00 55 10             	add    %dl,0x10(%rbp)
+  80542a:	80 00 00             	addb   $0x0,(%rax)
+  80542d:	00 00                	add    %al,(%rax)
+  80542f:	00 f3                	add    %dh,%bl
+  805431:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805437:	00 55 10             	add    %dl,0x10(%rbp)
+  80543a:	80 00 00             	addb   $0x0,(%rax)
+  80543d:	00 00                	add    %al,(%rax)
+  80543f:	00 55 10             	add    %dl,0x10(%rbp)
+  805442:	80 00 00             	addb   $0x0,(%rax)
+  805445:	00 00                	add    %al,(%rax)
+  805447:	00 b9 0a 80 00 00    	add    %bh,0x800a(%rcx)
+  80544d:	00 00                	add    %al,(%rax)
+  80544f:	00 55 10             	add    %dl,0x10(%rbp)
+  805452:	80 00 00             	addb   $0x0,(%rax)
+  805455:	00 00                	add    %al,(%rax)
+  805457:	00 55 10             	add    %dl,0x10(%rbp)
+  80545a:	80 00 00             	addb   $0x0,(%rax)
+  80545d:	00 00                	add    %al,(%rax)
+  80545f:	00 3b                	add    %bh,(%rbx)
+  805461:	0e                   	(bad)
+  805462:	80 00 00             	addb   $0x0,(%rax)
+  805465:	00 00                	add    %al,(%rax)
+  805467:	00 05 0f 80 00 00    	add    %al,0x800f(%rip)        # 80d47c <__ctors_end+0x739c>
+  80546d:	00 00                	add    %al,(%rax)
+  80546f:	00 55 10             	add    %dl,0x10(%rbp)
+  805472:	80 00 00             	addb   $0x0,(%rax)
+  805475:	00 00                	add    %al,(%rax)
+  805477:	00 55 10             	add    %dl,0x10(%rbp)
+  80547a:	80 00 00             	addb   $0x0,(%rax)
+  80547d:	00 00                	add    %al,(%rax)
+  80547f:	00 8a 0b 80 00 00    	add    %cl,0x800b(%rdx)
+  805485:	00 00                	add    %al,(%rax)
+  805487:	00 55 10             	add    %dl,0x10(%rbp)
+  80548a:	80 00 00             	addb   $0x0,(%rax)
+  80548d:	00 00                	add    %al,(%rax)
+  80548f:	00 67 0d             	add    %ah,0xd(%rdi)
+  805492:	80 00 00             	addb   $0x0,(%rax)
+  805495:	00 00                	add    %al,(%rax)
+  805497:	00 55 10             	add    %dl,0x10(%rbp)
+  80549a:	80 00 00             	addb   $0x0,(%rax)
+  80549d:	00 00                	add    %al,(%rax)
+  80549f:	00 55 10             	add    %dl,0x10(%rbp)
+  8054a2:	80 00 00             	addb   $0x0,(%rax)
+  8054a5:	00 00                	add    %al,(%rax)
+  8054a7:	00 78 0f             	add    %bh,0xf(%rax)
+  8054aa:	80 00 00             	addb   $0x0,(%rax)
+  8054ad:	00 00                	add    %al,(%rax)
+  8054af:	00 55 10             	add    %dl,0x10(%rbp)
+  8054b2:	80 00 00             	addb   $0x0,(%rax)
+  8054b5:	00 00                	add    %al,(%rax)
+  8054b7:	00 1d 0a 80 00 00    	add    %bl,0x800a(%rip)        # 80d4c7 <__ctors_end+0x73e7>
+  8054bd:	00 00                	add    %al,(%rax)
+	...
+
+00000000008054c0 <error_string>:
+	...
+  8054c8:	6d 50 80 00 00 00 00 00 7f 50 80 00 00 00 00 00     mP.......P......
+  8054d8:	8f 50 80 00 00 00 00 00 a1 50 80 00 00 00 00 00     .P.......P......
+  8054e8:	af 50 80 00 00 00 00 00 c3 50 80 00 00 00 00 00     .P.......P......
+  8054f8:	d8 50 80 00 00 00 00 00 eb 50 80 00 00 00 00 00     .P.......P......
+  805508:	fd 50 80 00 00 00 00 00 11 51 80 00 00 00 00 00     .P.......Q......
+  805518:	21 51 80 00 00 00 00 00 34 51 80 00 00 00 00 00     !Q......4Q......
+  805528:	4b 51 80 00 00 00 00 00 61 51 80 00 00 00 00 00     KQ......aQ......
+  805538:	79 51 80 00 00 00 00 00 91 51 80 00 00 00 00 00     yQ.......Q......
+  805548:	9e 51 80 00 00 00 00 00 78 55 80 00 00 00 00 00     .Q......xU......
+  805558:	b2 51 80 00 00 00 00 00 ca 51 80 00 00 00 00 00     .Q.......Q......
+  805568:	d4 51 80 00 00 00 00 00 de 51 80 00 00 00 00 00     .Q.......Q......
+  805578:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  805588:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  805598:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  8055a8:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  8055b8:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 73 66 6f     ib/syscall.c.sfo
+  8055c8:	72 6b 28 29 20 69 73 20 6e 6f 74 20 69 6d 70 6c     rk() is not impl
+  8055d8:	65 6d 65 6e 74 65 64 00 6c 69 62 2f 66 6f 72 6b     emented.lib/fork
+  8055e8:	2e 63 00 0f 1f 44 00 00 5b 25 30 38 78 5d 20 75     .c...D..[%08x] u
+  8055f8:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  805608:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  805618:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  805628:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  805638:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  805648:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  805658:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  805668:	0a 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805678:	84 00 00 00 00 00 66 90                             ......f.
+
+0000000000805680 <devtab>:
+  805680:	20 60 80 00 00 00 00 00 60 60 80 00 00 00 00 00      `......``......
+  805690:	a0 60 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .`..............
+  8056a0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  8056b0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8056c0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8056d0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8056e0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8056f0:	3d 20 32 00 65 6e 76 69 64 20 21 3d 20 30 00 6c     = 2.envid != 0.l
+  805700:	69 62 2f 77 61 69 74 2e 63 00 3c 63 6f 6e 73 3e     ib/wait.c.<cons>
+  805710:	00 63 6f 6e 73 00 66 90 55 73 65 72 73 70 61 63     .cons.f.Userspac
+  805720:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  805730:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  805740:	65 72 72 3d 25 78 0a 00 6c 69 62 2f 70 67 66 61     err=%x..lib/pgfa
+  805750:	75 6c 74 2e 63 00 73 65 74 5f 70 67 66 61 75 6c     ult.c.set_pgfaul
+  805760:	74 5f 68 61 6e 64 6c 65 72 3a 20 25 69 00 5f 70     t_handler: %i._p
+  805770:	66 68 61 6e 64 6c 65 72 5f 69 6e 69 74 69 74 69     fhandler_inititi
+  805780:	61 6c 6c 69 7a 65 64 00 69 70 63 5f 73 65 6e 64     allized.ipc_send
+  805790:	20 65 72 72 6f 72 3a 20 25 69 0a 00 6c 69 62 2f      error: %i..lib/
+  8057a0:	69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00 00     ipc.c.f.........
+  8057b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8057c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8057d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8057e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8057f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805800:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805810:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805820:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805830:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805840:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805850:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805860:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805870:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805880:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805890:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8058a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8058b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8058c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8058d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8058e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8058f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805900:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805910:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805920:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805930:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805940:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805950:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805960:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805970:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805980:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805990:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8059a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8059b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8059c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8059d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8059e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8059f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805aa0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ab0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ac0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ad0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ae0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805af0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ba0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805bb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805bc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805bd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805be0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805bf0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ca0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805cb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805cc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805cd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ce0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805cf0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805da0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805db0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805dc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805dd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805de0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805df0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ea0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805eb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ec0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ed0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ee0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ef0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805fa0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805fb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805fc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805fd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805fe0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ff0:	0f 1f 84 00 00 00 00 00 0f 1f 84 00 00 00 00 00     ................
@@ -0,0 +1,9094 @@
+
+obj/user/testkbd:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 71 03 00 00       	call   800394 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 56                	push   %r14
+  80002b:	41 55                	push   %r13
+  80002d:	41 54                	push   %r12
+  80002f:	53                   	push   %rbx
+  800030:	bb 0a 00 00 00       	mov    $0xa,%ebx
+    int r;
+
+    /* Spin for a bit to let the console quiet */
+    for (int i = 0; i < 10; ++i)
+        sys_yield();
+  800035:	49 bc 50 18 80 00 00 	movabs $0x801850,%r12
+  80003c:	00 00 00 
+  80003f:	41 ff d4             	call   *%r12
+    for (int i = 0; i < 10; ++i)
+  800042:	83 eb 01             	sub    $0x1,%ebx
+  800045:	75 f8                	jne    80003f <umain+0x1a>
+
+    close(0);
+  800047:	bf 00 00 00 00       	mov    $0x0,%edi
+  80004c:	48 b8 da 1e 80 00 00 	movabs $0x801eda,%rax
+  800053:	00 00 00 
+  800056:	ff d0                	call   *%rax
+    if ((r = opencons()) < 0)
+  800058:	48 b8 2d 03 80 00 00 	movabs $0x80032d,%rax
+  80005f:	00 00 00 
+  800062:	ff d0                	call   *%rax
+  800064:	85 c0                	test   %eax,%eax
+  800066:	78 2f                	js     800097 <umain+0x72>
+        panic("opencons: %i", r);
+    if (r != 0)
+  800068:	74 5a                	je     8000c4 <umain+0x9f>
+        panic("first opencons used fd %d", r);
+  80006a:	89 c1                	mov    %eax,%ecx
+  80006c:	48 ba fc 4d 80 00 00 	movabs $0x804dfc,%rdx
+  800073:	00 00 00 
+  800076:	be 10 00 00 00       	mov    $0x10,%esi
+  80007b:	48 bf ed 4d 80 00 00 	movabs $0x804ded,%rdi
+  800082:	00 00 00 
+  800085:	b8 00 00 00 00       	mov    $0x0,%eax
+  80008a:	49 b8 6a 04 80 00 00 	movabs $0x80046a,%r8
+  800091:	00 00 00 
+  800094:	41 ff d0             	call   *%r8
+        panic("opencons: %i", r);
+  800097:	89 c1                	mov    %eax,%ecx
+  800099:	48 ba e0 4d 80 00 00 	movabs $0x804de0,%rdx
+  8000a0:	00 00 00 
+  8000a3:	be 0e 00 00 00       	mov    $0xe,%esi
+  8000a8:	48 bf ed 4d 80 00 00 	movabs $0x804ded,%rdi
+  8000af:	00 00 00 
+  8000b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000b7:	49 b8 6a 04 80 00 00 	movabs $0x80046a,%r8
+  8000be:	00 00 00 
+  8000c1:	41 ff d0             	call   *%r8
+    if ((r = dup(0, 1)) < 0)
+  8000c4:	be 01 00 00 00       	mov    $0x1,%esi
+  8000c9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000ce:	48 b8 35 1f 80 00 00 	movabs $0x801f35,%rax
+  8000d5:	00 00 00 
+  8000d8:	ff d0                	call   *%rax
+        panic("dup: %i", r);
+
+    for (;;) {
+        char *buf;
+
+        buf = readline("Type a line: ");
+  8000da:	49 bc 1e 4e 80 00 00 	movabs $0x804e1e,%r12
+  8000e1:	00 00 00 
+  8000e4:	48 bb 06 13 80 00 00 	movabs $0x801306,%rbx
+  8000eb:	00 00 00 
+        if (buf != NULL)
+            fprintf(1, "%s\n", buf);
+        else
+            fprintf(1, "(end of file received)\n");
+  8000ee:	49 be 30 4e 80 00 00 	movabs $0x804e30,%r14
+  8000f5:	00 00 00 
+  8000f8:	49 bd f7 3e 80 00 00 	movabs $0x803ef7,%r13
+  8000ff:	00 00 00 
+    if ((r = dup(0, 1)) < 0)
+  800102:	85 c0                	test   %eax,%eax
+  800104:	79 44                	jns    80014a <umain+0x125>
+        panic("dup: %i", r);
+  800106:	89 c1                	mov    %eax,%ecx
+  800108:	48 ba 16 4e 80 00 00 	movabs $0x804e16,%rdx
+  80010f:	00 00 00 
+  800112:	be 12 00 00 00       	mov    $0x12,%esi
+  800117:	48 bf ed 4d 80 00 00 	movabs $0x804ded,%rdi
+  80011e:	00 00 00 
+  800121:	b8 00 00 00 00       	mov    $0x0,%eax
+  800126:	49 b8 6a 04 80 00 00 	movabs $0x80046a,%r8
+  80012d:	00 00 00 
+  800130:	41 ff d0             	call   *%r8
+            fprintf(1, "%s\n", buf);
+  800133:	48 be 2c 4e 80 00 00 	movabs $0x804e2c,%rsi
+  80013a:	00 00 00 
+  80013d:	bf 01 00 00 00       	mov    $0x1,%edi
+  800142:	b8 00 00 00 00       	mov    $0x0,%eax
+  800147:	41 ff d5             	call   *%r13
+        buf = readline("Type a line: ");
+  80014a:	4c 89 e7             	mov    %r12,%rdi
+  80014d:	ff d3                	call   *%rbx
+  80014f:	48 89 c2             	mov    %rax,%rdx
+        if (buf != NULL)
+  800152:	48 85 c0             	test   %rax,%rax
+  800155:	75 dc                	jne    800133 <umain+0x10e>
+            fprintf(1, "(end of file received)\n");
+  800157:	4c 89 f6             	mov    %r14,%rsi
+  80015a:	bf 01 00 00 00       	mov    $0x1,%edi
+  80015f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800164:	41 ff d5             	call   *%r13
+  800167:	eb e1                	jmp    80014a <umain+0x125>
+
+0000000000800169 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  800169:	b8 00 00 00 00       	mov    $0x0,%eax
+  80016e:	c3                   	ret
+
+000000000080016f <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80016f:	55                   	push   %rbp
+  800170:	48 89 e5             	mov    %rsp,%rbp
+  800173:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  800176:	48 be 48 4e 80 00 00 	movabs $0x804e48,%rsi
+  80017d:	00 00 00 
+  800180:	48 b8 df 0e 80 00 00 	movabs $0x800edf,%rax
+  800187:	00 00 00 
+  80018a:	ff d0                	call   *%rax
+    return 0;
+}
+  80018c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800191:	5d                   	pop    %rbp
+  800192:	c3                   	ret
+
+0000000000800193 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  800193:	55                   	push   %rbp
+  800194:	48 89 e5             	mov    %rsp,%rbp
+  800197:	41 57                	push   %r15
+  800199:	41 56                	push   %r14
+  80019b:	41 55                	push   %r13
+  80019d:	41 54                	push   %r12
+  80019f:	53                   	push   %rbx
+  8001a0:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8001a7:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8001ae:	48 85 d2             	test   %rdx,%rdx
+  8001b1:	74 7a                	je     80022d <devcons_write+0x9a>
+  8001b3:	49 89 d6             	mov    %rdx,%r14
+  8001b6:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8001bc:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8001c1:	49 bf d9 10 80 00 00 	movabs $0x8010d9,%r15
+  8001c8:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8001cb:	4c 89 f3             	mov    %r14,%rbx
+  8001ce:	48 29 f3             	sub    %rsi,%rbx
+  8001d1:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8001d6:	48 39 c3             	cmp    %rax,%rbx
+  8001d9:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8001dd:	4c 63 eb             	movslq %ebx,%r13
+  8001e0:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8001e7:	48 01 c6             	add    %rax,%rsi
+  8001ea:	4c 89 ea             	mov    %r13,%rdx
+  8001ed:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8001f4:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8001f7:	4c 89 ee             	mov    %r13,%rsi
+  8001fa:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  800201:	48 b8 7c 17 80 00 00 	movabs $0x80177c,%rax
+  800208:	00 00 00 
+  80020b:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80020d:	41 01 dc             	add    %ebx,%r12d
+  800210:	49 63 f4             	movslq %r12d,%rsi
+  800213:	4c 39 f6             	cmp    %r14,%rsi
+  800216:	72 b3                	jb     8001cb <devcons_write+0x38>
+    return res;
+  800218:	49 63 c4             	movslq %r12d,%rax
+}
+  80021b:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  800222:	5b                   	pop    %rbx
+  800223:	41 5c                	pop    %r12
+  800225:	41 5d                	pop    %r13
+  800227:	41 5e                	pop    %r14
+  800229:	41 5f                	pop    %r15
+  80022b:	5d                   	pop    %rbp
+  80022c:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80022d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  800233:	eb e3                	jmp    800218 <devcons_write+0x85>
+
+0000000000800235 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  800235:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  800238:	ba 00 00 00 00       	mov    $0x0,%edx
+  80023d:	48 85 c0             	test   %rax,%rax
+  800240:	74 55                	je     800297 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  800242:	55                   	push   %rbp
+  800243:	48 89 e5             	mov    %rsp,%rbp
+  800246:	41 55                	push   %r13
+  800248:	41 54                	push   %r12
+  80024a:	53                   	push   %rbx
+  80024b:	48 83 ec 08          	sub    $0x8,%rsp
+  80024f:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  800252:	48 bb 9b 17 80 00 00 	movabs $0x80179b,%rbx
+  800259:	00 00 00 
+  80025c:	49 bc 50 18 80 00 00 	movabs $0x801850,%r12
+  800263:	00 00 00 
+  800266:	eb 03                	jmp    80026b <devcons_read+0x36>
+  800268:	41 ff d4             	call   *%r12
+  80026b:	ff d3                	call   *%rbx
+  80026d:	85 c0                	test   %eax,%eax
+  80026f:	74 f7                	je     800268 <devcons_read+0x33>
+    if (c < 0) return c;
+  800271:	48 63 d0             	movslq %eax,%rdx
+  800274:	78 13                	js     800289 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  800276:	ba 00 00 00 00       	mov    $0x0,%edx
+  80027b:	83 f8 04             	cmp    $0x4,%eax
+  80027e:	74 09                	je     800289 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  800280:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  800284:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  800289:	48 89 d0             	mov    %rdx,%rax
+  80028c:	48 83 c4 08          	add    $0x8,%rsp
+  800290:	5b                   	pop    %rbx
+  800291:	41 5c                	pop    %r12
+  800293:	41 5d                	pop    %r13
+  800295:	5d                   	pop    %rbp
+  800296:	c3                   	ret
+  800297:	48 89 d0             	mov    %rdx,%rax
+  80029a:	c3                   	ret
+
+000000000080029b <cputchar>:
+cputchar(int ch) {
+  80029b:	55                   	push   %rbp
+  80029c:	48 89 e5             	mov    %rsp,%rbp
+  80029f:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8002a3:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8002a7:	be 01 00 00 00       	mov    $0x1,%esi
+  8002ac:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8002b0:	48 b8 7c 17 80 00 00 	movabs $0x80177c,%rax
+  8002b7:	00 00 00 
+  8002ba:	ff d0                	call   *%rax
+}
+  8002bc:	c9                   	leave
+  8002bd:	c3                   	ret
+
+00000000008002be <getchar>:
+getchar(void) {
+  8002be:	55                   	push   %rbp
+  8002bf:	48 89 e5             	mov    %rsp,%rbp
+  8002c2:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8002c6:	ba 01 00 00 00       	mov    $0x1,%edx
+  8002cb:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8002cf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002d4:	48 b8 58 20 80 00 00 	movabs $0x802058,%rax
+  8002db:	00 00 00 
+  8002de:	ff d0                	call   *%rax
+  8002e0:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8002e2:	85 c0                	test   %eax,%eax
+  8002e4:	78 06                	js     8002ec <getchar+0x2e>
+  8002e6:	74 08                	je     8002f0 <getchar+0x32>
+  8002e8:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8002ec:	89 d0                	mov    %edx,%eax
+  8002ee:	c9                   	leave
+  8002ef:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8002f0:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8002f5:	eb f5                	jmp    8002ec <getchar+0x2e>
+
+00000000008002f7 <iscons>:
+iscons(int fdnum) {
+  8002f7:	55                   	push   %rbp
+  8002f8:	48 89 e5             	mov    %rsp,%rbp
+  8002fb:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8002ff:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800303:	48 b8 75 1d 80 00 00 	movabs $0x801d75,%rax
+  80030a:	00 00 00 
+  80030d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80030f:	85 c0                	test   %eax,%eax
+  800311:	78 18                	js     80032b <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  800313:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800317:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80031e:	00 00 00 
+  800321:	8b 00                	mov    (%rax),%eax
+  800323:	39 02                	cmp    %eax,(%rdx)
+  800325:	0f 94 c0             	sete   %al
+  800328:	0f b6 c0             	movzbl %al,%eax
+}
+  80032b:	c9                   	leave
+  80032c:	c3                   	ret
+
+000000000080032d <opencons>:
+opencons(void) {
+  80032d:	55                   	push   %rbp
+  80032e:	48 89 e5             	mov    %rsp,%rbp
+  800331:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  800335:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  800339:	48 b8 15 1d 80 00 00 	movabs $0x801d15,%rax
+  800340:	00 00 00 
+  800343:	ff d0                	call   *%rax
+  800345:	85 c0                	test   %eax,%eax
+  800347:	78 49                	js     800392 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  800349:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80034e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800353:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  800357:	bf 00 00 00 00       	mov    $0x0,%edi
+  80035c:	48 b8 b4 18 80 00 00 	movabs $0x8018b4,%rax
+  800363:	00 00 00 
+  800366:	ff d0                	call   *%rax
+  800368:	85 c0                	test   %eax,%eax
+  80036a:	78 26                	js     800392 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80036c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800370:	a1 00 60 80 00 00 00 	movabs 0x806000,%eax
+  800377:	00 00 
+  800379:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80037b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80037f:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  800386:	48 b8 e7 1c 80 00 00 	movabs $0x801ce7,%rax
+  80038d:	00 00 00 
+  800390:	ff d0                	call   *%rax
+}
+  800392:	c9                   	leave
+  800393:	c3                   	ret
+
+0000000000800394 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800394:	55                   	push   %rbp
+  800395:	48 89 e5             	mov    %rsp,%rbp
+  800398:	41 56                	push   %r14
+  80039a:	41 55                	push   %r13
+  80039c:	41 54                	push   %r12
+  80039e:	53                   	push   %rbx
+  80039f:	41 89 fd             	mov    %edi,%r13d
+  8003a2:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8003a5:	48 ba e0 60 80 00 00 	movabs $0x8060e0,%rdx
+  8003ac:	00 00 00 
+  8003af:	48 b8 e0 60 80 00 00 	movabs $0x8060e0,%rax
+  8003b6:	00 00 00 
+  8003b9:	48 39 c2             	cmp    %rax,%rdx
+  8003bc:	73 17                	jae    8003d5 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8003be:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8003c1:	49 89 c4             	mov    %rax,%r12
+  8003c4:	48 83 c3 08          	add    $0x8,%rbx
+  8003c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003cd:	ff 53 f8             	call   *-0x8(%rbx)
+  8003d0:	4c 39 e3             	cmp    %r12,%rbx
+  8003d3:	72 ef                	jb     8003c4 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8003d5:	48 b8 27 18 80 00 00 	movabs $0x801827,%rax
+  8003dc:	00 00 00 
+  8003df:	ff d0                	call   *%rax
+  8003e1:	89 c2                	mov    %eax,%edx
+  8003e3:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  8003e9:	48 89 d0             	mov    %rdx,%rax
+  8003ec:	48 c1 e0 04          	shl    $0x4,%rax
+  8003f0:	48 29 d0             	sub    %rdx,%rax
+  8003f3:	48 c1 e0 05          	shl    $0x5,%rax
+  8003f7:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8003fe:	00 00 00 
+  800401:	48 01 d0             	add    %rdx,%rax
+  800404:	48 a3 00 00 81 00 00 	movabs %rax,0x810000
+  80040b:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80040e:	45 85 ed             	test   %r13d,%r13d
+  800411:	7e 0d                	jle    800420 <libmain+0x8c>
+  800413:	49 8b 06             	mov    (%r14),%rax
+  800416:	48 a3 40 60 80 00 00 	movabs %rax,0x806040
+  80041d:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800420:	4c 89 f6             	mov    %r14,%rsi
+  800423:	44 89 ef             	mov    %r13d,%edi
+  800426:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80042d:	00 00 00 
+  800430:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800432:	48 b8 47 04 80 00 00 	movabs $0x800447,%rax
+  800439:	00 00 00 
+  80043c:	ff d0                	call   *%rax
+#endif
+}
+  80043e:	5b                   	pop    %rbx
+  80043f:	41 5c                	pop    %r12
+  800441:	41 5d                	pop    %r13
+  800443:	41 5e                	pop    %r14
+  800445:	5d                   	pop    %rbp
+  800446:	c3                   	ret
+
+0000000000800447 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800447:	55                   	push   %rbp
+  800448:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80044b:	48 b8 0d 1f 80 00 00 	movabs $0x801f0d,%rax
+  800452:	00 00 00 
+  800455:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800457:	bf 00 00 00 00       	mov    $0x0,%edi
+  80045c:	48 b8 c4 17 80 00 00 	movabs $0x8017c4,%rax
+  800463:	00 00 00 
+  800466:	ff d0                	call   *%rax
+}
+  800468:	5d                   	pop    %rbp
+  800469:	c3                   	ret
+
+000000000080046a <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80046a:	55                   	push   %rbp
+  80046b:	48 89 e5             	mov    %rsp,%rbp
+  80046e:	41 56                	push   %r14
+  800470:	41 55                	push   %r13
+  800472:	41 54                	push   %r12
+  800474:	53                   	push   %rbx
+  800475:	48 83 ec 50          	sub    $0x50,%rsp
+  800479:	49 89 fc             	mov    %rdi,%r12
+  80047c:	41 89 f5             	mov    %esi,%r13d
+  80047f:	48 89 d3             	mov    %rdx,%rbx
+  800482:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800486:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80048a:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80048e:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800495:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800499:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80049d:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8004a1:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8004a5:	48 b8 40 60 80 00 00 	movabs $0x806040,%rax
+  8004ac:	00 00 00 
+  8004af:	4c 8b 30             	mov    (%rax),%r14
+  8004b2:	48 b8 27 18 80 00 00 	movabs $0x801827,%rax
+  8004b9:	00 00 00 
+  8004bc:	ff d0                	call   *%rax
+  8004be:	89 c6                	mov    %eax,%esi
+  8004c0:	45 89 e8             	mov    %r13d,%r8d
+  8004c3:	4c 89 e1             	mov    %r12,%rcx
+  8004c6:	4c 89 f2             	mov    %r14,%rdx
+  8004c9:	48 bf 60 4e 80 00 00 	movabs $0x804e60,%rdi
+  8004d0:	00 00 00 
+  8004d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004d8:	49 bc ba 05 80 00 00 	movabs $0x8005ba,%r12
+  8004df:	00 00 00 
+  8004e2:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8004e5:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8004e9:	48 89 df             	mov    %rbx,%rdi
+  8004ec:	48 b8 56 05 80 00 00 	movabs $0x800556,%rax
+  8004f3:	00 00 00 
+  8004f6:	ff d0                	call   *%rax
+    cprintf("\n");
+  8004f8:	48 bf 46 4e 80 00 00 	movabs $0x804e46,%rdi
+  8004ff:	00 00 00 
+  800502:	b8 00 00 00 00       	mov    $0x0,%eax
+  800507:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80050a:	cc                   	int3
+  80050b:	eb fd                	jmp    80050a <_panic+0xa0>
+
+000000000080050d <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80050d:	55                   	push   %rbp
+  80050e:	48 89 e5             	mov    %rsp,%rbp
+  800511:	53                   	push   %rbx
+  800512:	48 83 ec 08          	sub    $0x8,%rsp
+  800516:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800519:	8b 06                	mov    (%rsi),%eax
+  80051b:	8d 50 01             	lea    0x1(%rax),%edx
+  80051e:	89 16                	mov    %edx,(%rsi)
+  800520:	48 98                	cltq
+  800522:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800527:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80052d:	74 0a                	je     800539 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80052f:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800533:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800537:	c9                   	leave
+  800538:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800539:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80053d:	be ff 00 00 00       	mov    $0xff,%esi
+  800542:	48 b8 7c 17 80 00 00 	movabs $0x80177c,%rax
+  800549:	00 00 00 
+  80054c:	ff d0                	call   *%rax
+        state->offset = 0;
+  80054e:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800554:	eb d9                	jmp    80052f <putch+0x22>
+
+0000000000800556 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800556:	55                   	push   %rbp
+  800557:	48 89 e5             	mov    %rsp,%rbp
+  80055a:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800561:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800564:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80056b:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800570:	b8 00 00 00 00       	mov    $0x0,%eax
+  800575:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800578:	48 89 f1             	mov    %rsi,%rcx
+  80057b:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800582:	48 bf 0d 05 80 00 00 	movabs $0x80050d,%rdi
+  800589:	00 00 00 
+  80058c:	48 b8 0a 07 80 00 00 	movabs $0x80070a,%rax
+  800593:	00 00 00 
+  800596:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800598:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80059f:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8005a6:	48 b8 7c 17 80 00 00 	movabs $0x80177c,%rax
+  8005ad:	00 00 00 
+  8005b0:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8005b2:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8005b8:	c9                   	leave
+  8005b9:	c3                   	ret
+
+00000000008005ba <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8005ba:	55                   	push   %rbp
+  8005bb:	48 89 e5             	mov    %rsp,%rbp
+  8005be:	48 83 ec 50          	sub    $0x50,%rsp
+  8005c2:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8005c6:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8005ca:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8005ce:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8005d2:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8005d6:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8005dd:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8005e1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005e5:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8005e9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8005ed:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8005f1:	48 b8 56 05 80 00 00 	movabs $0x800556,%rax
+  8005f8:	00 00 00 
+  8005fb:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8005fd:	c9                   	leave
+  8005fe:	c3                   	ret
+
+00000000008005ff <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8005ff:	55                   	push   %rbp
+  800600:	48 89 e5             	mov    %rsp,%rbp
+  800603:	41 57                	push   %r15
+  800605:	41 56                	push   %r14
+  800607:	41 55                	push   %r13
+  800609:	41 54                	push   %r12
+  80060b:	53                   	push   %rbx
+  80060c:	48 83 ec 18          	sub    $0x18,%rsp
+  800610:	49 89 fc             	mov    %rdi,%r12
+  800613:	49 89 f5             	mov    %rsi,%r13
+  800616:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80061a:	8b 45 10             	mov    0x10(%rbp),%eax
+  80061d:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800620:	41 89 cf             	mov    %ecx,%r15d
+  800623:	4c 39 fa             	cmp    %r15,%rdx
+  800626:	73 5b                	jae    800683 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800628:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80062c:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800630:	85 db                	test   %ebx,%ebx
+  800632:	7e 0e                	jle    800642 <print_num+0x43>
+            putch(padc, put_arg);
+  800634:	4c 89 ee             	mov    %r13,%rsi
+  800637:	44 89 f7             	mov    %r14d,%edi
+  80063a:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80063d:	83 eb 01             	sub    $0x1,%ebx
+  800640:	75 f2                	jne    800634 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800642:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800646:	48 b9 94 4e 80 00 00 	movabs $0x804e94,%rcx
+  80064d:	00 00 00 
+  800650:	48 b8 83 4e 80 00 00 	movabs $0x804e83,%rax
+  800657:	00 00 00 
+  80065a:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80065e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800662:	ba 00 00 00 00       	mov    $0x0,%edx
+  800667:	49 f7 f7             	div    %r15
+  80066a:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80066e:	4c 89 ee             	mov    %r13,%rsi
+  800671:	41 ff d4             	call   *%r12
+}
+  800674:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800678:	5b                   	pop    %rbx
+  800679:	41 5c                	pop    %r12
+  80067b:	41 5d                	pop    %r13
+  80067d:	41 5e                	pop    %r14
+  80067f:	41 5f                	pop    %r15
+  800681:	5d                   	pop    %rbp
+  800682:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800683:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800687:	ba 00 00 00 00       	mov    $0x0,%edx
+  80068c:	49 f7 f7             	div    %r15
+  80068f:	48 83 ec 08          	sub    $0x8,%rsp
+  800693:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800697:	52                   	push   %rdx
+  800698:	45 0f be c9          	movsbl %r9b,%r9d
+  80069c:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8006a0:	48 89 c2             	mov    %rax,%rdx
+  8006a3:	48 b8 ff 05 80 00 00 	movabs $0x8005ff,%rax
+  8006aa:	00 00 00 
+  8006ad:	ff d0                	call   *%rax
+  8006af:	48 83 c4 10          	add    $0x10,%rsp
+  8006b3:	eb 8d                	jmp    800642 <print_num+0x43>
+
+00000000008006b5 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8006b5:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8006b9:	48 8b 06             	mov    (%rsi),%rax
+  8006bc:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8006c0:	73 0a                	jae    8006cc <sprintputch+0x17>
+        *state->start++ = ch;
+  8006c2:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8006c6:	48 89 16             	mov    %rdx,(%rsi)
+  8006c9:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8006cc:	c3                   	ret
+
+00000000008006cd <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8006cd:	55                   	push   %rbp
+  8006ce:	48 89 e5             	mov    %rsp,%rbp
+  8006d1:	48 83 ec 50          	sub    $0x50,%rsp
+  8006d5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8006d9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8006dd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8006e1:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8006e8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8006ec:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006f0:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8006f4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8006f8:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8006fc:	48 b8 0a 07 80 00 00 	movabs $0x80070a,%rax
+  800703:	00 00 00 
+  800706:	ff d0                	call   *%rax
+}
+  800708:	c9                   	leave
+  800709:	c3                   	ret
+
+000000000080070a <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80070a:	55                   	push   %rbp
+  80070b:	48 89 e5             	mov    %rsp,%rbp
+  80070e:	41 57                	push   %r15
+  800710:	41 56                	push   %r14
+  800712:	41 55                	push   %r13
+  800714:	41 54                	push   %r12
+  800716:	53                   	push   %rbx
+  800717:	48 83 ec 38          	sub    $0x38,%rsp
+  80071b:	49 89 fe             	mov    %rdi,%r14
+  80071e:	49 89 f5             	mov    %rsi,%r13
+  800721:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800724:	48 8b 01             	mov    (%rcx),%rax
+  800727:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80072b:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80072f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800733:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800737:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80073b:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80073f:	0f b6 3b             	movzbl (%rbx),%edi
+  800742:	40 80 ff 25          	cmp    $0x25,%dil
+  800746:	74 18                	je     800760 <vprintfmt+0x56>
+            if (!ch) return;
+  800748:	40 84 ff             	test   %dil,%dil
+  80074b:	0f 84 b1 06 00 00    	je     800e02 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800751:	40 0f b6 ff          	movzbl %dil,%edi
+  800755:	4c 89 ee             	mov    %r13,%rsi
+  800758:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80075b:	4c 89 e3             	mov    %r12,%rbx
+  80075e:	eb db                	jmp    80073b <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800760:	be 00 00 00 00       	mov    $0x0,%esi
+  800765:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800769:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80076e:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800774:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80077b:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80077f:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800784:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800789:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80078c:	83 e8 23             	sub    $0x23,%eax
+  80078f:	3c 57                	cmp    $0x57,%al
+  800791:	0f 87 51 06 00 00    	ja     800de8 <vprintfmt+0x6de>
+  800797:	0f b6 c0             	movzbl %al,%eax
+  80079a:	48 b9 40 50 80 00 00 	movabs $0x805040,%rcx
+  8007a1:	00 00 00 
+  8007a4:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8007a7:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8007aa:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8007ae:	eb cf                	jmp    80077f <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8007b0:	49 89 dc             	mov    %rbx,%r12
+  8007b3:	be 01 00 00 00       	mov    $0x1,%esi
+  8007b8:	eb c5                	jmp    80077f <vprintfmt+0x75>
+            padc = ch;
+  8007ba:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8007be:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8007c1:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8007c4:	eb b9                	jmp    80077f <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8007c6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007c9:	83 f8 2f             	cmp    $0x2f,%eax
+  8007cc:	77 24                	ja     8007f2 <vprintfmt+0xe8>
+  8007ce:	89 c1                	mov    %eax,%ecx
+  8007d0:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8007d4:	83 c0 08             	add    $0x8,%eax
+  8007d7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007da:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8007dd:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8007e0:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8007e4:	79 99                	jns    80077f <vprintfmt+0x75>
+                width = precision;
+  8007e6:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8007ea:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8007f0:	eb 8d                	jmp    80077f <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8007f2:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8007f6:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8007fa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007fe:	eb da                	jmp    8007da <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800800:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800805:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800809:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80080f:	3c 39                	cmp    $0x39,%al
+  800811:	77 1c                	ja     80082f <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800813:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800817:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80081b:	0f b6 c0             	movzbl %al,%eax
+  80081e:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800823:	0f b6 03             	movzbl (%rbx),%eax
+  800826:	3c 39                	cmp    $0x39,%al
+  800828:	76 e9                	jbe    800813 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80082a:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80082d:	eb b1                	jmp    8007e0 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80082f:	49 89 dc             	mov    %rbx,%r12
+  800832:	eb ac                	jmp    8007e0 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800834:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800837:	85 c9                	test   %ecx,%ecx
+  800839:	b8 00 00 00 00       	mov    $0x0,%eax
+  80083e:	0f 49 c1             	cmovns %ecx,%eax
+  800841:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800844:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800847:	e9 33 ff ff ff       	jmp    80077f <vprintfmt+0x75>
+            lflag++;
+  80084c:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80084f:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800852:	e9 28 ff ff ff       	jmp    80077f <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800857:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80085a:	83 f8 2f             	cmp    $0x2f,%eax
+  80085d:	77 19                	ja     800878 <vprintfmt+0x16e>
+  80085f:	89 c2                	mov    %eax,%edx
+  800861:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800865:	83 c0 08             	add    $0x8,%eax
+  800868:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80086b:	8b 3a                	mov    (%rdx),%edi
+  80086d:	4c 89 ee             	mov    %r13,%rsi
+  800870:	41 ff d6             	call   *%r14
+            break;
+  800873:	e9 c3 fe ff ff       	jmp    80073b <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800878:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80087c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800880:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800884:	eb e5                	jmp    80086b <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800886:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800889:	83 f8 2f             	cmp    $0x2f,%eax
+  80088c:	77 5a                	ja     8008e8 <vprintfmt+0x1de>
+  80088e:	89 c2                	mov    %eax,%edx
+  800890:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800894:	83 c0 08             	add    $0x8,%eax
+  800897:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80089a:	8b 02                	mov    (%rdx),%eax
+  80089c:	89 c1                	mov    %eax,%ecx
+  80089e:	f7 d9                	neg    %ecx
+  8008a0:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8008a3:	83 f9 16             	cmp    $0x16,%ecx
+  8008a6:	7f 4e                	jg     8008f6 <vprintfmt+0x1ec>
+  8008a8:	48 63 c1             	movslq %ecx,%rax
+  8008ab:	48 ba 00 53 80 00 00 	movabs $0x805300,%rdx
+  8008b2:	00 00 00 
+  8008b5:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8008b9:	48 85 c0             	test   %rax,%rax
+  8008bc:	74 38                	je     8008f6 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8008be:	48 89 c1             	mov    %rax,%rcx
+  8008c1:	48 ba f9 54 80 00 00 	movabs $0x8054f9,%rdx
+  8008c8:	00 00 00 
+  8008cb:	4c 89 ee             	mov    %r13,%rsi
+  8008ce:	4c 89 f7             	mov    %r14,%rdi
+  8008d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d6:	49 b8 cd 06 80 00 00 	movabs $0x8006cd,%r8
+  8008dd:	00 00 00 
+  8008e0:	41 ff d0             	call   *%r8
+  8008e3:	e9 53 fe ff ff       	jmp    80073b <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8008e8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008ec:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008f0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008f4:	eb a4                	jmp    80089a <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8008f6:	48 ba ac 4e 80 00 00 	movabs $0x804eac,%rdx
+  8008fd:	00 00 00 
+  800900:	4c 89 ee             	mov    %r13,%rsi
+  800903:	4c 89 f7             	mov    %r14,%rdi
+  800906:	b8 00 00 00 00       	mov    $0x0,%eax
+  80090b:	49 b8 cd 06 80 00 00 	movabs $0x8006cd,%r8
+  800912:	00 00 00 
+  800915:	41 ff d0             	call   *%r8
+  800918:	e9 1e fe ff ff       	jmp    80073b <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80091d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800920:	83 f8 2f             	cmp    $0x2f,%eax
+  800923:	77 6c                	ja     800991 <vprintfmt+0x287>
+  800925:	89 c2                	mov    %eax,%edx
+  800927:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80092b:	83 c0 08             	add    $0x8,%eax
+  80092e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800931:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800934:	48 85 d2             	test   %rdx,%rdx
+  800937:	48 b8 a5 4e 80 00 00 	movabs $0x804ea5,%rax
+  80093e:	00 00 00 
+  800941:	48 0f 45 c2          	cmovne %rdx,%rax
+  800945:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800949:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80094d:	7e 06                	jle    800955 <vprintfmt+0x24b>
+  80094f:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800953:	75 4a                	jne    80099f <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800955:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800959:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80095d:	0f b6 00             	movzbl (%rax),%eax
+  800960:	84 c0                	test   %al,%al
+  800962:	0f 85 9a 00 00 00    	jne    800a02 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800968:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80096b:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80096f:	85 c0                	test   %eax,%eax
+  800971:	0f 8e c4 fd ff ff    	jle    80073b <vprintfmt+0x31>
+  800977:	4c 89 ee             	mov    %r13,%rsi
+  80097a:	bf 20 00 00 00       	mov    $0x20,%edi
+  80097f:	41 ff d6             	call   *%r14
+  800982:	41 83 ec 01          	sub    $0x1,%r12d
+  800986:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80098a:	75 eb                	jne    800977 <vprintfmt+0x26d>
+  80098c:	e9 aa fd ff ff       	jmp    80073b <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800991:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800995:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800999:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80099d:	eb 92                	jmp    800931 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80099f:	49 63 f7             	movslq %r15d,%rsi
+  8009a2:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8009a6:	48 b8 bc 0e 80 00 00 	movabs $0x800ebc,%rax
+  8009ad:	00 00 00 
+  8009b0:	ff d0                	call   *%rax
+  8009b2:	48 89 c2             	mov    %rax,%rdx
+  8009b5:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8009b8:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8009ba:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8009bd:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8009c0:	85 c0                	test   %eax,%eax
+  8009c2:	7e 91                	jle    800955 <vprintfmt+0x24b>
+  8009c4:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8009c9:	4c 89 ee             	mov    %r13,%rsi
+  8009cc:	44 89 e7             	mov    %r12d,%edi
+  8009cf:	41 ff d6             	call   *%r14
+  8009d2:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8009d6:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8009d9:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8009dc:	75 eb                	jne    8009c9 <vprintfmt+0x2bf>
+  8009de:	e9 72 ff ff ff       	jmp    800955 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8009e3:	0f b6 f8             	movzbl %al,%edi
+  8009e6:	4c 89 ee             	mov    %r13,%rsi
+  8009e9:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8009ec:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8009f0:	49 83 c4 01          	add    $0x1,%r12
+  8009f4:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8009fa:	84 c0                	test   %al,%al
+  8009fc:	0f 84 66 ff ff ff    	je     800968 <vprintfmt+0x25e>
+  800a02:	45 85 ff             	test   %r15d,%r15d
+  800a05:	78 0a                	js     800a11 <vprintfmt+0x307>
+  800a07:	41 83 ef 01          	sub    $0x1,%r15d
+  800a0b:	0f 88 57 ff ff ff    	js     800968 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800a11:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800a15:	74 cc                	je     8009e3 <vprintfmt+0x2d9>
+  800a17:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800a1a:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800a1f:	80 fa 5e             	cmp    $0x5e,%dl
+  800a22:	77 c2                	ja     8009e6 <vprintfmt+0x2dc>
+  800a24:	eb bd                	jmp    8009e3 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800a26:	40 84 f6             	test   %sil,%sil
+  800a29:	75 26                	jne    800a51 <vprintfmt+0x347>
+    switch (lflag) {
+  800a2b:	85 d2                	test   %edx,%edx
+  800a2d:	74 59                	je     800a88 <vprintfmt+0x37e>
+  800a2f:	83 fa 01             	cmp    $0x1,%edx
+  800a32:	74 7b                	je     800aaf <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800a34:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a37:	83 f8 2f             	cmp    $0x2f,%eax
+  800a3a:	0f 87 96 00 00 00    	ja     800ad6 <vprintfmt+0x3cc>
+  800a40:	89 c2                	mov    %eax,%edx
+  800a42:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a46:	83 c0 08             	add    $0x8,%eax
+  800a49:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a4c:	4c 8b 22             	mov    (%rdx),%r12
+  800a4f:	eb 17                	jmp    800a68 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800a51:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a54:	83 f8 2f             	cmp    $0x2f,%eax
+  800a57:	77 21                	ja     800a7a <vprintfmt+0x370>
+  800a59:	89 c2                	mov    %eax,%edx
+  800a5b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a5f:	83 c0 08             	add    $0x8,%eax
+  800a62:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a65:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800a68:	4d 85 e4             	test   %r12,%r12
+  800a6b:	78 7a                	js     800ae7 <vprintfmt+0x3dd>
+            num = i;
+  800a6d:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800a70:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800a75:	e9 50 02 00 00       	jmp    800cca <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a7a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a7e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a82:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a86:	eb dd                	jmp    800a65 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800a88:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a8b:	83 f8 2f             	cmp    $0x2f,%eax
+  800a8e:	77 11                	ja     800aa1 <vprintfmt+0x397>
+  800a90:	89 c2                	mov    %eax,%edx
+  800a92:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a96:	83 c0 08             	add    $0x8,%eax
+  800a99:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a9c:	4c 63 22             	movslq (%rdx),%r12
+  800a9f:	eb c7                	jmp    800a68 <vprintfmt+0x35e>
+  800aa1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aa5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aa9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aad:	eb ed                	jmp    800a9c <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800aaf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ab2:	83 f8 2f             	cmp    $0x2f,%eax
+  800ab5:	77 11                	ja     800ac8 <vprintfmt+0x3be>
+  800ab7:	89 c2                	mov    %eax,%edx
+  800ab9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800abd:	83 c0 08             	add    $0x8,%eax
+  800ac0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ac3:	4c 8b 22             	mov    (%rdx),%r12
+  800ac6:	eb a0                	jmp    800a68 <vprintfmt+0x35e>
+  800ac8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800acc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ad0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ad4:	eb ed                	jmp    800ac3 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800ad6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ada:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ade:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ae2:	e9 65 ff ff ff       	jmp    800a4c <vprintfmt+0x342>
+                putch('-', put_arg);
+  800ae7:	4c 89 ee             	mov    %r13,%rsi
+  800aea:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800aef:	41 ff d6             	call   *%r14
+                i = -i;
+  800af2:	49 f7 dc             	neg    %r12
+  800af5:	e9 73 ff ff ff       	jmp    800a6d <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800afa:	40 84 f6             	test   %sil,%sil
+  800afd:	75 32                	jne    800b31 <vprintfmt+0x427>
+    switch (lflag) {
+  800aff:	85 d2                	test   %edx,%edx
+  800b01:	74 5d                	je     800b60 <vprintfmt+0x456>
+  800b03:	83 fa 01             	cmp    $0x1,%edx
+  800b06:	0f 84 82 00 00 00    	je     800b8e <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800b0c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b0f:	83 f8 2f             	cmp    $0x2f,%eax
+  800b12:	0f 87 a5 00 00 00    	ja     800bbd <vprintfmt+0x4b3>
+  800b18:	89 c2                	mov    %eax,%edx
+  800b1a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b1e:	83 c0 08             	add    $0x8,%eax
+  800b21:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b24:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b27:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b2c:	e9 99 01 00 00       	jmp    800cca <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b31:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b34:	83 f8 2f             	cmp    $0x2f,%eax
+  800b37:	77 19                	ja     800b52 <vprintfmt+0x448>
+  800b39:	89 c2                	mov    %eax,%edx
+  800b3b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b3f:	83 c0 08             	add    $0x8,%eax
+  800b42:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b45:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b48:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b4d:	e9 78 01 00 00       	jmp    800cca <vprintfmt+0x5c0>
+  800b52:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b56:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b5a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b5e:	eb e5                	jmp    800b45 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800b60:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b63:	83 f8 2f             	cmp    $0x2f,%eax
+  800b66:	77 18                	ja     800b80 <vprintfmt+0x476>
+  800b68:	89 c2                	mov    %eax,%edx
+  800b6a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b6e:	83 c0 08             	add    $0x8,%eax
+  800b71:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b74:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800b76:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800b7b:	e9 4a 01 00 00       	jmp    800cca <vprintfmt+0x5c0>
+  800b80:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b84:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b88:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b8c:	eb e6                	jmp    800b74 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800b8e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b91:	83 f8 2f             	cmp    $0x2f,%eax
+  800b94:	77 19                	ja     800baf <vprintfmt+0x4a5>
+  800b96:	89 c2                	mov    %eax,%edx
+  800b98:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b9c:	83 c0 08             	add    $0x8,%eax
+  800b9f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ba2:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800ba5:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800baa:	e9 1b 01 00 00       	jmp    800cca <vprintfmt+0x5c0>
+  800baf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bb3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bb7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bbb:	eb e5                	jmp    800ba2 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800bbd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bc1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bc5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bc9:	e9 56 ff ff ff       	jmp    800b24 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800bce:	40 84 f6             	test   %sil,%sil
+  800bd1:	75 2e                	jne    800c01 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800bd3:	85 d2                	test   %edx,%edx
+  800bd5:	74 59                	je     800c30 <vprintfmt+0x526>
+  800bd7:	83 fa 01             	cmp    $0x1,%edx
+  800bda:	74 7f                	je     800c5b <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800bdc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bdf:	83 f8 2f             	cmp    $0x2f,%eax
+  800be2:	0f 87 9f 00 00 00    	ja     800c87 <vprintfmt+0x57d>
+  800be8:	89 c2                	mov    %eax,%edx
+  800bea:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bee:	83 c0 08             	add    $0x8,%eax
+  800bf1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bf4:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800bf7:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800bfc:	e9 c9 00 00 00       	jmp    800cca <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800c01:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c04:	83 f8 2f             	cmp    $0x2f,%eax
+  800c07:	77 19                	ja     800c22 <vprintfmt+0x518>
+  800c09:	89 c2                	mov    %eax,%edx
+  800c0b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c0f:	83 c0 08             	add    $0x8,%eax
+  800c12:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c15:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800c18:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800c1d:	e9 a8 00 00 00       	jmp    800cca <vprintfmt+0x5c0>
+  800c22:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c26:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c2a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c2e:	eb e5                	jmp    800c15 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800c30:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c33:	83 f8 2f             	cmp    $0x2f,%eax
+  800c36:	77 15                	ja     800c4d <vprintfmt+0x543>
+  800c38:	89 c2                	mov    %eax,%edx
+  800c3a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c3e:	83 c0 08             	add    $0x8,%eax
+  800c41:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c44:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800c46:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800c4b:	eb 7d                	jmp    800cca <vprintfmt+0x5c0>
+  800c4d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c51:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c55:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c59:	eb e9                	jmp    800c44 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800c5b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c5e:	83 f8 2f             	cmp    $0x2f,%eax
+  800c61:	77 16                	ja     800c79 <vprintfmt+0x56f>
+  800c63:	89 c2                	mov    %eax,%edx
+  800c65:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c69:	83 c0 08             	add    $0x8,%eax
+  800c6c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c6f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800c72:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800c77:	eb 51                	jmp    800cca <vprintfmt+0x5c0>
+  800c79:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c7d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c81:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c85:	eb e8                	jmp    800c6f <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800c87:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c8b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c8f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c93:	e9 5c ff ff ff       	jmp    800bf4 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800c98:	4c 89 ee             	mov    %r13,%rsi
+  800c9b:	bf 30 00 00 00       	mov    $0x30,%edi
+  800ca0:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800ca3:	4c 89 ee             	mov    %r13,%rsi
+  800ca6:	bf 78 00 00 00       	mov    $0x78,%edi
+  800cab:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800cae:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cb1:	83 f8 2f             	cmp    $0x2f,%eax
+  800cb4:	77 47                	ja     800cfd <vprintfmt+0x5f3>
+  800cb6:	89 c2                	mov    %eax,%edx
+  800cb8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cbc:	83 c0 08             	add    $0x8,%eax
+  800cbf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cc2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800cc5:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800cca:	48 83 ec 08          	sub    $0x8,%rsp
+  800cce:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800cd2:	0f 94 c0             	sete   %al
+  800cd5:	0f b6 c0             	movzbl %al,%eax
+  800cd8:	50                   	push   %rax
+  800cd9:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800cde:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800ce2:	4c 89 ee             	mov    %r13,%rsi
+  800ce5:	4c 89 f7             	mov    %r14,%rdi
+  800ce8:	48 b8 ff 05 80 00 00 	movabs $0x8005ff,%rax
+  800cef:	00 00 00 
+  800cf2:	ff d0                	call   *%rax
+            break;
+  800cf4:	48 83 c4 10          	add    $0x10,%rsp
+  800cf8:	e9 3e fa ff ff       	jmp    80073b <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800cfd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d01:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d05:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d09:	eb b7                	jmp    800cc2 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800d0b:	40 84 f6             	test   %sil,%sil
+  800d0e:	75 2b                	jne    800d3b <vprintfmt+0x631>
+    switch (lflag) {
+  800d10:	85 d2                	test   %edx,%edx
+  800d12:	74 56                	je     800d6a <vprintfmt+0x660>
+  800d14:	83 fa 01             	cmp    $0x1,%edx
+  800d17:	74 7f                	je     800d98 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800d19:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d1c:	83 f8 2f             	cmp    $0x2f,%eax
+  800d1f:	0f 87 a2 00 00 00    	ja     800dc7 <vprintfmt+0x6bd>
+  800d25:	89 c2                	mov    %eax,%edx
+  800d27:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d2b:	83 c0 08             	add    $0x8,%eax
+  800d2e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d31:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d34:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800d39:	eb 8f                	jmp    800cca <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800d3b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d3e:	83 f8 2f             	cmp    $0x2f,%eax
+  800d41:	77 19                	ja     800d5c <vprintfmt+0x652>
+  800d43:	89 c2                	mov    %eax,%edx
+  800d45:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d49:	83 c0 08             	add    $0x8,%eax
+  800d4c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d4f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d52:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800d57:	e9 6e ff ff ff       	jmp    800cca <vprintfmt+0x5c0>
+  800d5c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d60:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d64:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d68:	eb e5                	jmp    800d4f <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800d6a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d6d:	83 f8 2f             	cmp    $0x2f,%eax
+  800d70:	77 18                	ja     800d8a <vprintfmt+0x680>
+  800d72:	89 c2                	mov    %eax,%edx
+  800d74:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d78:	83 c0 08             	add    $0x8,%eax
+  800d7b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d7e:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800d80:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800d85:	e9 40 ff ff ff       	jmp    800cca <vprintfmt+0x5c0>
+  800d8a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d8e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d92:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d96:	eb e6                	jmp    800d7e <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800d98:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d9b:	83 f8 2f             	cmp    $0x2f,%eax
+  800d9e:	77 19                	ja     800db9 <vprintfmt+0x6af>
+  800da0:	89 c2                	mov    %eax,%edx
+  800da2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800da6:	83 c0 08             	add    $0x8,%eax
+  800da9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800dac:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800daf:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800db4:	e9 11 ff ff ff       	jmp    800cca <vprintfmt+0x5c0>
+  800db9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800dbd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800dc1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dc5:	eb e5                	jmp    800dac <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800dc7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800dcb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800dcf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dd3:	e9 59 ff ff ff       	jmp    800d31 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800dd8:	4c 89 ee             	mov    %r13,%rsi
+  800ddb:	bf 25 00 00 00       	mov    $0x25,%edi
+  800de0:	41 ff d6             	call   *%r14
+            break;
+  800de3:	e9 53 f9 ff ff       	jmp    80073b <vprintfmt+0x31>
+            putch('%', put_arg);
+  800de8:	4c 89 ee             	mov    %r13,%rsi
+  800deb:	bf 25 00 00 00       	mov    $0x25,%edi
+  800df0:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800df3:	48 83 eb 01          	sub    $0x1,%rbx
+  800df7:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800dfb:	75 f6                	jne    800df3 <vprintfmt+0x6e9>
+  800dfd:	e9 39 f9 ff ff       	jmp    80073b <vprintfmt+0x31>
+}
+  800e02:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800e06:	5b                   	pop    %rbx
+  800e07:	41 5c                	pop    %r12
+  800e09:	41 5d                	pop    %r13
+  800e0b:	41 5e                	pop    %r14
+  800e0d:	41 5f                	pop    %r15
+  800e0f:	5d                   	pop    %rbp
+  800e10:	c3                   	ret
+
+0000000000800e11 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800e11:	55                   	push   %rbp
+  800e12:	48 89 e5             	mov    %rsp,%rbp
+  800e15:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800e19:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800e1d:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800e22:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800e26:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800e2d:	48 85 ff             	test   %rdi,%rdi
+  800e30:	74 2b                	je     800e5d <vsnprintf+0x4c>
+  800e32:	48 85 f6             	test   %rsi,%rsi
+  800e35:	74 26                	je     800e5d <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800e37:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800e3b:	48 bf b5 06 80 00 00 	movabs $0x8006b5,%rdi
+  800e42:	00 00 00 
+  800e45:	48 b8 0a 07 80 00 00 	movabs $0x80070a,%rax
+  800e4c:	00 00 00 
+  800e4f:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800e51:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e55:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800e58:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800e5b:	c9                   	leave
+  800e5c:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800e5d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e62:	eb f7                	jmp    800e5b <vsnprintf+0x4a>
+
+0000000000800e64 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800e64:	55                   	push   %rbp
+  800e65:	48 89 e5             	mov    %rsp,%rbp
+  800e68:	48 83 ec 50          	sub    $0x50,%rsp
+  800e6c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800e70:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800e74:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800e78:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800e7f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800e83:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e87:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800e8b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800e8f:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800e93:	48 b8 11 0e 80 00 00 	movabs $0x800e11,%rax
+  800e9a:	00 00 00 
+  800e9d:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800e9f:	c9                   	leave
+  800ea0:	c3                   	ret
+
+0000000000800ea1 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800ea1:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800ea4:	74 10                	je     800eb6 <strlen+0x15>
+    size_t n = 0;
+  800ea6:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800eab:	48 83 c0 01          	add    $0x1,%rax
+  800eaf:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800eb3:	75 f6                	jne    800eab <strlen+0xa>
+  800eb5:	c3                   	ret
+    size_t n = 0;
+  800eb6:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800ebb:	c3                   	ret
+
+0000000000800ebc <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800ebc:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800ebf:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800ec4:	48 85 f6             	test   %rsi,%rsi
+  800ec7:	74 11                	je     800eda <strnlen+0x1e>
+  800ec9:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800ecd:	74 0c                	je     800edb <strnlen+0x1f>
+  800ecf:	48 83 c2 01          	add    $0x1,%rdx
+  800ed3:	48 39 d0             	cmp    %rdx,%rax
+  800ed6:	75 f1                	jne    800ec9 <strnlen+0xd>
+  800ed8:	eb 04                	jmp    800ede <strnlen+0x22>
+  800eda:	c3                   	ret
+  800edb:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800ede:	c3                   	ret
+
+0000000000800edf <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800edf:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800ee2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ee7:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800eeb:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800eee:	48 83 c2 01          	add    $0x1,%rdx
+  800ef2:	84 c9                	test   %cl,%cl
+  800ef4:	75 f1                	jne    800ee7 <strcpy+0x8>
+        ;
+    return res;
+}
+  800ef6:	c3                   	ret
+
+0000000000800ef7 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800ef7:	55                   	push   %rbp
+  800ef8:	48 89 e5             	mov    %rsp,%rbp
+  800efb:	41 54                	push   %r12
+  800efd:	53                   	push   %rbx
+  800efe:	48 89 fb             	mov    %rdi,%rbx
+  800f01:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800f04:	48 b8 a1 0e 80 00 00 	movabs $0x800ea1,%rax
+  800f0b:	00 00 00 
+  800f0e:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800f10:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800f14:	4c 89 e6             	mov    %r12,%rsi
+  800f17:	48 b8 df 0e 80 00 00 	movabs $0x800edf,%rax
+  800f1e:	00 00 00 
+  800f21:	ff d0                	call   *%rax
+    return dst;
+}
+  800f23:	48 89 d8             	mov    %rbx,%rax
+  800f26:	5b                   	pop    %rbx
+  800f27:	41 5c                	pop    %r12
+  800f29:	5d                   	pop    %rbp
+  800f2a:	c3                   	ret
+
+0000000000800f2b <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800f2b:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800f2e:	48 85 d2             	test   %rdx,%rdx
+  800f31:	74 1f                	je     800f52 <strncpy+0x27>
+  800f33:	48 01 fa             	add    %rdi,%rdx
+  800f36:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800f39:	48 83 c1 01          	add    $0x1,%rcx
+  800f3d:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800f41:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800f45:	41 80 f8 01          	cmp    $0x1,%r8b
+  800f49:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800f4d:	48 39 ca             	cmp    %rcx,%rdx
+  800f50:	75 e7                	jne    800f39 <strncpy+0xe>
+    }
+    return ret;
+}
+  800f52:	c3                   	ret
+
+0000000000800f53 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800f53:	48 89 f8             	mov    %rdi,%rax
+  800f56:	48 85 d2             	test   %rdx,%rdx
+  800f59:	74 24                	je     800f7f <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800f5b:	48 83 ea 01          	sub    $0x1,%rdx
+  800f5f:	74 1b                	je     800f7c <strlcpy+0x29>
+  800f61:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800f65:	0f b6 16             	movzbl (%rsi),%edx
+  800f68:	84 d2                	test   %dl,%dl
+  800f6a:	74 10                	je     800f7c <strlcpy+0x29>
+            *dst++ = *src++;
+  800f6c:	48 83 c6 01          	add    $0x1,%rsi
+  800f70:	48 83 c0 01          	add    $0x1,%rax
+  800f74:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800f77:	48 39 c8             	cmp    %rcx,%rax
+  800f7a:	75 e9                	jne    800f65 <strlcpy+0x12>
+        *dst = '\0';
+  800f7c:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800f7f:	48 29 f8             	sub    %rdi,%rax
+}
+  800f82:	c3                   	ret
+
+0000000000800f83 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800f83:	0f b6 07             	movzbl (%rdi),%eax
+  800f86:	84 c0                	test   %al,%al
+  800f88:	74 13                	je     800f9d <strcmp+0x1a>
+  800f8a:	38 06                	cmp    %al,(%rsi)
+  800f8c:	75 0f                	jne    800f9d <strcmp+0x1a>
+  800f8e:	48 83 c7 01          	add    $0x1,%rdi
+  800f92:	48 83 c6 01          	add    $0x1,%rsi
+  800f96:	0f b6 07             	movzbl (%rdi),%eax
+  800f99:	84 c0                	test   %al,%al
+  800f9b:	75 ed                	jne    800f8a <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f9d:	0f b6 c0             	movzbl %al,%eax
+  800fa0:	0f b6 16             	movzbl (%rsi),%edx
+  800fa3:	29 d0                	sub    %edx,%eax
+}
+  800fa5:	c3                   	ret
+
+0000000000800fa6 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800fa6:	48 85 d2             	test   %rdx,%rdx
+  800fa9:	74 1f                	je     800fca <strncmp+0x24>
+  800fab:	0f b6 07             	movzbl (%rdi),%eax
+  800fae:	84 c0                	test   %al,%al
+  800fb0:	74 1e                	je     800fd0 <strncmp+0x2a>
+  800fb2:	3a 06                	cmp    (%rsi),%al
+  800fb4:	75 1a                	jne    800fd0 <strncmp+0x2a>
+  800fb6:	48 83 c7 01          	add    $0x1,%rdi
+  800fba:	48 83 c6 01          	add    $0x1,%rsi
+  800fbe:	48 83 ea 01          	sub    $0x1,%rdx
+  800fc2:	75 e7                	jne    800fab <strncmp+0x5>
+
+    if (!n) return 0;
+  800fc4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fc9:	c3                   	ret
+  800fca:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fcf:	c3                   	ret
+  800fd0:	48 85 d2             	test   %rdx,%rdx
+  800fd3:	74 09                	je     800fde <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800fd5:	0f b6 07             	movzbl (%rdi),%eax
+  800fd8:	0f b6 16             	movzbl (%rsi),%edx
+  800fdb:	29 d0                	sub    %edx,%eax
+  800fdd:	c3                   	ret
+    if (!n) return 0;
+  800fde:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fe3:	c3                   	ret
+
+0000000000800fe4 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800fe4:	0f b6 17             	movzbl (%rdi),%edx
+  800fe7:	84 d2                	test   %dl,%dl
+  800fe9:	74 18                	je     801003 <strchr+0x1f>
+        if (*str == c) {
+  800feb:	0f be d2             	movsbl %dl,%edx
+  800fee:	39 f2                	cmp    %esi,%edx
+  800ff0:	74 17                	je     801009 <strchr+0x25>
+    for (; *str; str++) {
+  800ff2:	48 83 c7 01          	add    $0x1,%rdi
+  800ff6:	0f b6 17             	movzbl (%rdi),%edx
+  800ff9:	84 d2                	test   %dl,%dl
+  800ffb:	75 ee                	jne    800feb <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800ffd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801002:	c3                   	ret
+  801003:	b8 00 00 00 00       	mov    $0x0,%eax
+  801008:	c3                   	ret
+  801009:	48 89 f8             	mov    %rdi,%rax
+}
+  80100c:	c3                   	ret
+
+000000000080100d <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  80100d:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  801010:	0f b6 17             	movzbl (%rdi),%edx
+  801013:	84 d2                	test   %dl,%dl
+  801015:	74 13                	je     80102a <strfind+0x1d>
+  801017:	0f be d2             	movsbl %dl,%edx
+  80101a:	39 f2                	cmp    %esi,%edx
+  80101c:	74 0b                	je     801029 <strfind+0x1c>
+  80101e:	48 83 c0 01          	add    $0x1,%rax
+  801022:	0f b6 10             	movzbl (%rax),%edx
+  801025:	84 d2                	test   %dl,%dl
+  801027:	75 ee                	jne    801017 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  801029:	c3                   	ret
+  80102a:	c3                   	ret
+
+000000000080102b <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  80102b:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  80102e:	48 89 f8             	mov    %rdi,%rax
+  801031:	48 f7 d8             	neg    %rax
+  801034:	83 e0 07             	and    $0x7,%eax
+  801037:	49 89 d1             	mov    %rdx,%r9
+  80103a:	49 29 c1             	sub    %rax,%r9
+  80103d:	78 36                	js     801075 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  80103f:	40 0f b6 c6          	movzbl %sil,%eax
+  801043:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  80104a:	01 01 01 
+  80104d:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  801051:	40 f6 c7 07          	test   $0x7,%dil
+  801055:	75 38                	jne    80108f <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  801057:	4c 89 c9             	mov    %r9,%rcx
+  80105a:	48 c1 f9 03          	sar    $0x3,%rcx
+  80105e:	74 0c                	je     80106c <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  801060:	fc                   	cld
+  801061:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  801064:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  801068:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  80106c:	4d 85 c9             	test   %r9,%r9
+  80106f:	75 45                	jne    8010b6 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  801071:	4c 89 c0             	mov    %r8,%rax
+  801074:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  801075:	48 85 d2             	test   %rdx,%rdx
+  801078:	74 f7                	je     801071 <memset+0x46>
+  80107a:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  80107d:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  801080:	48 83 c0 01          	add    $0x1,%rax
+  801084:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  801088:	48 39 c2             	cmp    %rax,%rdx
+  80108b:	75 f3                	jne    801080 <memset+0x55>
+  80108d:	eb e2                	jmp    801071 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  80108f:	40 f6 c7 01          	test   $0x1,%dil
+  801093:	74 06                	je     80109b <memset+0x70>
+  801095:	88 07                	mov    %al,(%rdi)
+  801097:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80109b:	40 f6 c7 02          	test   $0x2,%dil
+  80109f:	74 07                	je     8010a8 <memset+0x7d>
+  8010a1:	66 89 07             	mov    %ax,(%rdi)
+  8010a4:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8010a8:	40 f6 c7 04          	test   $0x4,%dil
+  8010ac:	74 a9                	je     801057 <memset+0x2c>
+  8010ae:	89 07                	mov    %eax,(%rdi)
+  8010b0:	48 83 c7 04          	add    $0x4,%rdi
+  8010b4:	eb a1                	jmp    801057 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8010b6:	41 f6 c1 04          	test   $0x4,%r9b
+  8010ba:	74 06                	je     8010c2 <memset+0x97>
+  8010bc:	89 07                	mov    %eax,(%rdi)
+  8010be:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8010c2:	41 f6 c1 02          	test   $0x2,%r9b
+  8010c6:	74 07                	je     8010cf <memset+0xa4>
+  8010c8:	66 89 07             	mov    %ax,(%rdi)
+  8010cb:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8010cf:	41 f6 c1 01          	test   $0x1,%r9b
+  8010d3:	74 9c                	je     801071 <memset+0x46>
+  8010d5:	88 07                	mov    %al,(%rdi)
+  8010d7:	eb 98                	jmp    801071 <memset+0x46>
+
+00000000008010d9 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8010d9:	48 89 f8             	mov    %rdi,%rax
+  8010dc:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8010df:	48 39 fe             	cmp    %rdi,%rsi
+  8010e2:	73 3b                	jae    80111f <memmove+0x46>
+  8010e4:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8010e8:	48 39 d7             	cmp    %rdx,%rdi
+  8010eb:	73 32                	jae    80111f <memmove+0x46>
+        s += n;
+        d += n;
+  8010ed:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8010f1:	48 89 d6             	mov    %rdx,%rsi
+  8010f4:	48 09 fe             	or     %rdi,%rsi
+  8010f7:	48 09 ce             	or     %rcx,%rsi
+  8010fa:	40 f6 c6 07          	test   $0x7,%sil
+  8010fe:	75 12                	jne    801112 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  801100:	48 83 ef 08          	sub    $0x8,%rdi
+  801104:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  801108:	48 c1 e9 03          	shr    $0x3,%rcx
+  80110c:	fd                   	std
+  80110d:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  801110:	fc                   	cld
+  801111:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801112:	48 83 ef 01          	sub    $0x1,%rdi
+  801116:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  80111a:	fd                   	std
+  80111b:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80111d:	eb f1                	jmp    801110 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80111f:	48 89 f2             	mov    %rsi,%rdx
+  801122:	48 09 c2             	or     %rax,%rdx
+  801125:	48 09 ca             	or     %rcx,%rdx
+  801128:	f6 c2 07             	test   $0x7,%dl
+  80112b:	75 0c                	jne    801139 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  80112d:	48 c1 e9 03          	shr    $0x3,%rcx
+  801131:	48 89 c7             	mov    %rax,%rdi
+  801134:	fc                   	cld
+  801135:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801138:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801139:	48 89 c7             	mov    %rax,%rdi
+  80113c:	fc                   	cld
+  80113d:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  80113f:	c3                   	ret
+
+0000000000801140 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801140:	55                   	push   %rbp
+  801141:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801144:	48 b8 d9 10 80 00 00 	movabs $0x8010d9,%rax
+  80114b:	00 00 00 
+  80114e:	ff d0                	call   *%rax
+}
+  801150:	5d                   	pop    %rbp
+  801151:	c3                   	ret
+
+0000000000801152 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801152:	55                   	push   %rbp
+  801153:	48 89 e5             	mov    %rsp,%rbp
+  801156:	41 57                	push   %r15
+  801158:	41 56                	push   %r14
+  80115a:	41 55                	push   %r13
+  80115c:	41 54                	push   %r12
+  80115e:	53                   	push   %rbx
+  80115f:	48 83 ec 08          	sub    $0x8,%rsp
+  801163:	49 89 fe             	mov    %rdi,%r14
+  801166:	49 89 f7             	mov    %rsi,%r15
+  801169:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80116c:	48 89 f7             	mov    %rsi,%rdi
+  80116f:	48 b8 a1 0e 80 00 00 	movabs $0x800ea1,%rax
+  801176:	00 00 00 
+  801179:	ff d0                	call   *%rax
+  80117b:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  80117e:	48 89 de             	mov    %rbx,%rsi
+  801181:	4c 89 f7             	mov    %r14,%rdi
+  801184:	48 b8 bc 0e 80 00 00 	movabs $0x800ebc,%rax
+  80118b:	00 00 00 
+  80118e:	ff d0                	call   *%rax
+  801190:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801193:	48 39 c3             	cmp    %rax,%rbx
+  801196:	74 36                	je     8011ce <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801198:	48 89 d8             	mov    %rbx,%rax
+  80119b:	4c 29 e8             	sub    %r13,%rax
+  80119e:	49 39 c4             	cmp    %rax,%r12
+  8011a1:	73 31                	jae    8011d4 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8011a3:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8011a8:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8011ac:	4c 89 fe             	mov    %r15,%rsi
+  8011af:	48 b8 40 11 80 00 00 	movabs $0x801140,%rax
+  8011b6:	00 00 00 
+  8011b9:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8011bb:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8011bf:	48 83 c4 08          	add    $0x8,%rsp
+  8011c3:	5b                   	pop    %rbx
+  8011c4:	41 5c                	pop    %r12
+  8011c6:	41 5d                	pop    %r13
+  8011c8:	41 5e                	pop    %r14
+  8011ca:	41 5f                	pop    %r15
+  8011cc:	5d                   	pop    %rbp
+  8011cd:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8011ce:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8011d2:	eb eb                	jmp    8011bf <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8011d4:	48 83 eb 01          	sub    $0x1,%rbx
+  8011d8:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8011dc:	48 89 da             	mov    %rbx,%rdx
+  8011df:	4c 89 fe             	mov    %r15,%rsi
+  8011e2:	48 b8 40 11 80 00 00 	movabs $0x801140,%rax
+  8011e9:	00 00 00 
+  8011ec:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8011ee:	49 01 de             	add    %rbx,%r14
+  8011f1:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8011f6:	eb c3                	jmp    8011bb <strlcat+0x69>
+
+00000000008011f8 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8011f8:	48 85 d2             	test   %rdx,%rdx
+  8011fb:	74 2d                	je     80122a <memcmp+0x32>
+  8011fd:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801202:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801206:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80120b:	44 38 c1             	cmp    %r8b,%cl
+  80120e:	75 0f                	jne    80121f <memcmp+0x27>
+    while (n-- > 0) {
+  801210:	48 83 c0 01          	add    $0x1,%rax
+  801214:	48 39 c2             	cmp    %rax,%rdx
+  801217:	75 e9                	jne    801202 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801219:	b8 00 00 00 00       	mov    $0x0,%eax
+  80121e:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80121f:	0f b6 c1             	movzbl %cl,%eax
+  801222:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801226:	44 29 c0             	sub    %r8d,%eax
+  801229:	c3                   	ret
+    return 0;
+  80122a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80122f:	c3                   	ret
+
+0000000000801230 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801230:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801234:	48 39 c7             	cmp    %rax,%rdi
+  801237:	73 0f                	jae    801248 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801239:	40 38 37             	cmp    %sil,(%rdi)
+  80123c:	74 0e                	je     80124c <memfind+0x1c>
+    for (; src < end; src++) {
+  80123e:	48 83 c7 01          	add    $0x1,%rdi
+  801242:	48 39 f8             	cmp    %rdi,%rax
+  801245:	75 f2                	jne    801239 <memfind+0x9>
+  801247:	c3                   	ret
+  801248:	48 89 f8             	mov    %rdi,%rax
+  80124b:	c3                   	ret
+  80124c:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80124f:	c3                   	ret
+
+0000000000801250 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801250:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801253:	0f b6 37             	movzbl (%rdi),%esi
+  801256:	40 80 fe 20          	cmp    $0x20,%sil
+  80125a:	74 06                	je     801262 <strtol+0x12>
+  80125c:	40 80 fe 09          	cmp    $0x9,%sil
+  801260:	75 13                	jne    801275 <strtol+0x25>
+  801262:	48 83 c7 01          	add    $0x1,%rdi
+  801266:	0f b6 37             	movzbl (%rdi),%esi
+  801269:	40 80 fe 20          	cmp    $0x20,%sil
+  80126d:	74 f3                	je     801262 <strtol+0x12>
+  80126f:	40 80 fe 09          	cmp    $0x9,%sil
+  801273:	74 ed                	je     801262 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801275:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801278:	83 e0 fd             	and    $0xfffffffd,%eax
+  80127b:	3c 01                	cmp    $0x1,%al
+  80127d:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801281:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801287:	75 0f                	jne    801298 <strtol+0x48>
+  801289:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80128c:	74 14                	je     8012a2 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80128e:	85 d2                	test   %edx,%edx
+  801290:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801295:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801298:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80129d:	4c 63 ca             	movslq %edx,%r9
+  8012a0:	eb 36                	jmp    8012d8 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8012a2:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8012a6:	74 0f                	je     8012b7 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8012a8:	85 d2                	test   %edx,%edx
+  8012aa:	75 ec                	jne    801298 <strtol+0x48>
+        s++;
+  8012ac:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8012b0:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8012b5:	eb e1                	jmp    801298 <strtol+0x48>
+        s += 2;
+  8012b7:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8012bb:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8012c0:	eb d6                	jmp    801298 <strtol+0x48>
+            dig -= '0';
+  8012c2:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8012c5:	44 0f b6 c1          	movzbl %cl,%r8d
+  8012c9:	41 39 d0             	cmp    %edx,%r8d
+  8012cc:	7d 21                	jge    8012ef <strtol+0x9f>
+        val = val * base + dig;
+  8012ce:	49 0f af c1          	imul   %r9,%rax
+  8012d2:	0f b6 c9             	movzbl %cl,%ecx
+  8012d5:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8012d8:	48 83 c7 01          	add    $0x1,%rdi
+  8012dc:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8012e0:	80 f9 39             	cmp    $0x39,%cl
+  8012e3:	76 dd                	jbe    8012c2 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8012e5:	80 f9 7b             	cmp    $0x7b,%cl
+  8012e8:	77 05                	ja     8012ef <strtol+0x9f>
+            dig -= 'a' - 10;
+  8012ea:	83 e9 57             	sub    $0x57,%ecx
+  8012ed:	eb d6                	jmp    8012c5 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8012ef:	4d 85 d2             	test   %r10,%r10
+  8012f2:	74 03                	je     8012f7 <strtol+0xa7>
+  8012f4:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8012f7:	48 89 c2             	mov    %rax,%rdx
+  8012fa:	48 f7 da             	neg    %rdx
+  8012fd:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801301:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801305:	c3                   	ret
+
+0000000000801306 <readline>:
+#define BUFLEN 1024
+
+static char buf[BUFLEN];
+
+char *
+readline(const char *prompt) {
+  801306:	55                   	push   %rbp
+  801307:	48 89 e5             	mov    %rsp,%rbp
+  80130a:	41 57                	push   %r15
+  80130c:	41 56                	push   %r14
+  80130e:	41 55                	push   %r13
+  801310:	41 54                	push   %r12
+  801312:	53                   	push   %rbx
+  801313:	48 83 ec 08          	sub    $0x8,%rsp
+    if (prompt) {
+  801317:	48 85 ff             	test   %rdi,%rdi
+  80131a:	74 23                	je     80133f <readline+0x39>
+#if JOS_KERNEL
+        cprintf("%s", prompt);
+#else
+        fprintf(1, "%s", prompt);
+  80131c:	48 89 fa             	mov    %rdi,%rdx
+  80131f:	48 be f9 54 80 00 00 	movabs $0x8054f9,%rsi
+  801326:	00 00 00 
+  801329:	bf 01 00 00 00       	mov    $0x1,%edi
+  80132e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801333:	48 b9 f7 3e 80 00 00 	movabs $0x803ef7,%rcx
+  80133a:	00 00 00 
+  80133d:	ff d1                	call   *%rcx
+#endif
+    }
+
+    bool echo = iscons(0);
+  80133f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801344:	48 b8 f7 02 80 00 00 	movabs $0x8002f7,%rax
+  80134b:	00 00 00 
+  80134e:	ff d0                	call   *%rax
+  801350:	41 89 c6             	mov    %eax,%r14d
+
+    for (size_t i = 0;;) {
+  801353:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        int c = getchar();
+  801359:	49 bd be 02 80 00 00 	movabs $0x8002be,%r13
+  801360:	00 00 00 
+                cprintf("read error: %i\n", c);
+            return NULL;
+        } else if ((c == '\b' || c == '\x7F')) {
+            if (i) {
+                if (echo) {
+                    cputchar('\b');
+  801363:	49 bf 9b 02 80 00 00 	movabs $0x80029b,%r15
+  80136a:	00 00 00 
+  80136d:	eb 46                	jmp    8013b5 <readline+0xaf>
+            return NULL;
+  80136f:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (c != -E_EOF)
+  801374:	83 fb f4             	cmp    $0xfffffff4,%ebx
+  801377:	75 0f                	jne    801388 <readline+0x82>
+            }
+            buf[i] = 0;
+            return buf;
+        }
+    }
+}
+  801379:	48 83 c4 08          	add    $0x8,%rsp
+  80137d:	5b                   	pop    %rbx
+  80137e:	41 5c                	pop    %r12
+  801380:	41 5d                	pop    %r13
+  801382:	41 5e                	pop    %r14
+  801384:	41 5f                	pop    %r15
+  801386:	5d                   	pop    %rbp
+  801387:	c3                   	ret
+                cprintf("read error: %i\n", c);
+  801388:	89 de                	mov    %ebx,%esi
+  80138a:	48 bf d7 53 80 00 00 	movabs $0x8053d7,%rdi
+  801391:	00 00 00 
+  801394:	48 ba ba 05 80 00 00 	movabs $0x8005ba,%rdx
+  80139b:	00 00 00 
+  80139e:	ff d2                	call   *%rdx
+            return NULL;
+  8013a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013a5:	eb d2                	jmp    801379 <readline+0x73>
+            if (i) {
+  8013a7:	4d 85 e4             	test   %r12,%r12
+  8013aa:	74 09                	je     8013b5 <readline+0xaf>
+                if (echo) {
+  8013ac:	45 85 f6             	test   %r14d,%r14d
+  8013af:	75 3f                	jne    8013f0 <readline+0xea>
+                i--;
+  8013b1:	49 83 ec 01          	sub    $0x1,%r12
+        int c = getchar();
+  8013b5:	41 ff d5             	call   *%r13
+  8013b8:	89 c3                	mov    %eax,%ebx
+        if (c < 0) {
+  8013ba:	85 c0                	test   %eax,%eax
+  8013bc:	78 b1                	js     80136f <readline+0x69>
+        } else if ((c == '\b' || c == '\x7F')) {
+  8013be:	83 f8 08             	cmp    $0x8,%eax
+  8013c1:	74 e4                	je     8013a7 <readline+0xa1>
+  8013c3:	83 f8 7f             	cmp    $0x7f,%eax
+  8013c6:	74 df                	je     8013a7 <readline+0xa1>
+        } else if (c >= ' ') {
+  8013c8:	83 f8 1f             	cmp    $0x1f,%eax
+  8013cb:	7e 4d                	jle    80141a <readline+0x114>
+            if (i < BUFLEN - 1) {
+  8013cd:	49 81 fc fe 03 00 00 	cmp    $0x3fe,%r12
+  8013d4:	77 df                	ja     8013b5 <readline+0xaf>
+                if (echo) {
+  8013d6:	45 85 f6             	test   %r14d,%r14d
+  8013d9:	75 2f                	jne    80140a <readline+0x104>
+                buf[i++] = (char)c;
+  8013db:	48 b8 20 00 81 00 00 	movabs $0x810020,%rax
+  8013e2:	00 00 00 
+  8013e5:	42 88 1c 20          	mov    %bl,(%rax,%r12,1)
+  8013e9:	4d 8d 64 24 01       	lea    0x1(%r12),%r12
+  8013ee:	eb c5                	jmp    8013b5 <readline+0xaf>
+                    cputchar('\b');
+  8013f0:	bf 08 00 00 00       	mov    $0x8,%edi
+  8013f5:	41 ff d7             	call   *%r15
+                    cputchar(' ');
+  8013f8:	bf 20 00 00 00       	mov    $0x20,%edi
+  8013fd:	41 ff d7             	call   *%r15
+                    cputchar('\b');
+  801400:	bf 08 00 00 00       	mov    $0x8,%edi
+  801405:	41 ff d7             	call   *%r15
+  801408:	eb a7                	jmp    8013b1 <readline+0xab>
+                    cputchar(c);
+  80140a:	89 c7                	mov    %eax,%edi
+  80140c:	48 b8 9b 02 80 00 00 	movabs $0x80029b,%rax
+  801413:	00 00 00 
+  801416:	ff d0                	call   *%rax
+  801418:	eb c1                	jmp    8013db <readline+0xd5>
+        } else if (c == '\n' || c == '\r') {
+  80141a:	83 f8 0a             	cmp    $0xa,%eax
+  80141d:	74 05                	je     801424 <readline+0x11e>
+  80141f:	83 f8 0d             	cmp    $0xd,%eax
+  801422:	75 91                	jne    8013b5 <readline+0xaf>
+            if (echo) {
+  801424:	45 85 f6             	test   %r14d,%r14d
+  801427:	75 14                	jne    80143d <readline+0x137>
+            buf[i] = 0;
+  801429:	48 b8 20 00 81 00 00 	movabs $0x810020,%rax
+  801430:	00 00 00 
+  801433:	42 c6 04 20 00       	movb   $0x0,(%rax,%r12,1)
+            return buf;
+  801438:	e9 3c ff ff ff       	jmp    801379 <readline+0x73>
+                cputchar('\n');
+  80143d:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801442:	48 b8 9b 02 80 00 00 	movabs $0x80029b,%rax
+  801449:	00 00 00 
+  80144c:	ff d0                	call   *%rax
+  80144e:	eb d9                	jmp    801429 <readline+0x123>
+
+0000000000801450 <s2lld>:
+    return result;
+}
+*/
+
+long long
+s2lld(const char* s) {
+  801450:	55                   	push   %rbp
+  801451:	48 89 e5             	mov    %rsp,%rbp
+  801454:	53                   	push   %rbx
+  801455:	48 83 ec 08          	sub    $0x8,%rsp
+  801459:	48 89 fb             	mov    %rdi,%rbx
+    long long result = 0;
+    int n = strlen(s);
+  80145c:	48 b8 a1 0e 80 00 00 	movabs $0x800ea1,%rax
+  801463:	00 00 00 
+  801466:	ff d0                	call   *%rax
+    int sign = 1;
+  801468:	80 3b 2d             	cmpb   $0x2d,(%rbx)
+  80146b:	41 0f 95 c1          	setne  %r9b
+  80146f:	45 0f b6 c9          	movzbl %r9b,%r9d
+  801473:	47 8d 4c 09 ff       	lea    -0x1(%r9,%r9,1),%r9d
+    if (s[0] == '-') {
+        sign = -1;
+    }
+    for (int i = 0; i < n; i++) {
+  801478:	85 c0                	test   %eax,%eax
+  80147a:	7e 3a                	jle    8014b6 <s2lld+0x66>
+  80147c:	48 89 d9             	mov    %rbx,%rcx
+  80147f:	8d 40 ff             	lea    -0x1(%rax),%eax
+  801482:	4c 8d 44 03 01       	lea    0x1(%rbx,%rax,1),%r8
+    long long result = 0;
+  801487:	bf 00 00 00 00       	mov    $0x0,%edi
+  80148c:	eb 09                	jmp    801497 <s2lld+0x47>
+    for (int i = 0; i < n; i++) {
+  80148e:	48 83 c1 01          	add    $0x1,%rcx
+  801492:	4c 39 c1             	cmp    %r8,%rcx
+  801495:	74 24                	je     8014bb <s2lld+0x6b>
+        if ((s[i] >= '0') && (s[i] <= '9')) {
+  801497:	0f b6 11             	movzbl (%rcx),%edx
+  80149a:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  80149d:	40 80 fe 09          	cmp    $0x9,%sil
+  8014a1:	77 eb                	ja     80148e <s2lld+0x3e>
+            result *= 10;
+  8014a3:	48 8d 34 bf          	lea    (%rdi,%rdi,4),%rsi
+            result += s[i] - '0';
+  8014a7:	0f be d2             	movsbl %dl,%edx
+  8014aa:	83 ea 30             	sub    $0x30,%edx
+  8014ad:	48 63 d2             	movslq %edx,%rdx
+  8014b0:	48 8d 3c 72          	lea    (%rdx,%rsi,2),%rdi
+  8014b4:	eb d8                	jmp    80148e <s2lld+0x3e>
+    long long result = 0;
+  8014b6:	bf 00 00 00 00       	mov    $0x0,%edi
+        }
+    }
+    return sign * result;
+  8014bb:	49 63 c1             	movslq %r9d,%rax
+  8014be:	48 0f af c7          	imul   %rdi,%rax
+}
+  8014c2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8014c6:	c9                   	leave
+  8014c7:	c3                   	ret
+
+00000000008014c8 <s2llu>:
+
+unsigned long long
+s2llu(const char* s) {
+  8014c8:	55                   	push   %rbp
+  8014c9:	48 89 e5             	mov    %rsp,%rbp
+  8014cc:	53                   	push   %rbx
+  8014cd:	48 83 ec 08          	sub    $0x8,%rsp
+  8014d1:	48 89 fb             	mov    %rdi,%rbx
+    unsigned long long result = 0;
+    int n = strlen(s);
+  8014d4:	48 b8 a1 0e 80 00 00 	movabs $0x800ea1,%rax
+  8014db:	00 00 00 
+  8014de:	ff d0                	call   *%rax
+    for (int i = 0; i < n; i++) {
+  8014e0:	85 c0                	test   %eax,%eax
+  8014e2:	7e 38                	jle    80151c <s2llu+0x54>
+  8014e4:	48 89 da             	mov    %rbx,%rdx
+  8014e7:	8d 40 ff             	lea    -0x1(%rax),%eax
+  8014ea:	48 8d 7c 03 01       	lea    0x1(%rbx,%rax,1),%rdi
+    unsigned long long result = 0;
+  8014ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8014f4:	eb 09                	jmp    8014ff <s2llu+0x37>
+    for (int i = 0; i < n; i++) {
+  8014f6:	48 83 c2 01          	add    $0x1,%rdx
+  8014fa:	48 39 fa             	cmp    %rdi,%rdx
+  8014fd:	74 22                	je     801521 <s2llu+0x59>
+        if ((s[i] >= '0') && (s[i] <= '9')) {
+  8014ff:	0f b6 02             	movzbl (%rdx),%eax
+  801502:	8d 48 d0             	lea    -0x30(%rax),%ecx
+  801505:	80 f9 09             	cmp    $0x9,%cl
+  801508:	77 ec                	ja     8014f6 <s2llu+0x2e>
+            result *= 10;
+  80150a:	48 8d 0c b6          	lea    (%rsi,%rsi,4),%rcx
+            result += s[i] - '0';
+  80150e:	0f be c0             	movsbl %al,%eax
+  801511:	83 e8 30             	sub    $0x30,%eax
+  801514:	48 98                	cltq
+  801516:	48 8d 34 48          	lea    (%rax,%rcx,2),%rsi
+  80151a:	eb da                	jmp    8014f6 <s2llu+0x2e>
+    unsigned long long result = 0;
+  80151c:	be 00 00 00 00       	mov    $0x0,%esi
+        }
+    }
+    return result;
+}
+  801521:	48 89 f0             	mov    %rsi,%rax
+  801524:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801528:	c9                   	leave
+  801529:	c3                   	ret
+
+000000000080152a <readvalue>:
+    return sign * result;
+}
+*/
+
+void
+readvalue(const char* format, void* value) {
+  80152a:	55                   	push   %rbp
+  80152b:	48 89 e5             	mov    %rsp,%rbp
+  80152e:	41 55                	push   %r13
+  801530:	41 54                	push   %r12
+  801532:	53                   	push   %rbx
+  801533:	48 83 ec 18          	sub    $0x18,%rsp
+  801537:	48 89 fb             	mov    %rdi,%rbx
+  80153a:	49 89 f4             	mov    %rsi,%r12
+    char* buf = readline(NULL);
+  80153d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801542:	48 b8 06 13 80 00 00 	movabs $0x801306,%rax
+  801549:	00 00 00 
+  80154c:	ff d0                	call   *%rax
+  80154e:	49 89 c5             	mov    %rax,%r13
+    if (strcmp(format, "%s") == 0) {
+  801551:	48 be f9 54 80 00 00 	movabs $0x8054f9,%rsi
+  801558:	00 00 00 
+  80155b:	48 89 df             	mov    %rbx,%rdi
+  80155e:	48 b8 83 0f 80 00 00 	movabs $0x800f83,%rax
+  801565:	00 00 00 
+  801568:	ff d0                	call   *%rax
+  80156a:	85 c0                	test   %eax,%eax
+  80156c:	75 1d                	jne    80158b <readvalue+0x61>
+        strcpy(value, buf);
+  80156e:	4c 89 ee             	mov    %r13,%rsi
+  801571:	4c 89 e7             	mov    %r12,%rdi
+  801574:	48 b8 df 0e 80 00 00 	movabs $0x800edf,%rax
+  80157b:	00 00 00 
+  80157e:	ff d0                	call   *%rax
+        //memcpy(value, &result, sizeof(result));
+    } else if (strcmp(format, "%c") == 0) {
+        char result = buf[0];
+        memcpy(value, &result, sizeof(result));
+    }
+  801580:	48 83 c4 18          	add    $0x18,%rsp
+  801584:	5b                   	pop    %rbx
+  801585:	41 5c                	pop    %r12
+  801587:	41 5d                	pop    %r13
+  801589:	5d                   	pop    %rbp
+  80158a:	c3                   	ret
+    } else if (strcmp(format, "%d") == 0) {
+  80158b:	48 be 13 4e 80 00 00 	movabs $0x804e13,%rsi
+  801592:	00 00 00 
+  801595:	48 89 df             	mov    %rbx,%rdi
+  801598:	48 b8 83 0f 80 00 00 	movabs $0x800f83,%rax
+  80159f:	00 00 00 
+  8015a2:	ff d0                	call   *%rax
+  8015a4:	85 c0                	test   %eax,%eax
+  8015a6:	75 2c                	jne    8015d4 <readvalue+0xaa>
+        int result = s2lld(buf);
+  8015a8:	4c 89 ef             	mov    %r13,%rdi
+  8015ab:	48 b8 50 14 80 00 00 	movabs $0x801450,%rax
+  8015b2:	00 00 00 
+  8015b5:	ff d0                	call   *%rax
+  8015b7:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        memcpy(value, &result, sizeof(result));
+  8015ba:	ba 04 00 00 00       	mov    $0x4,%edx
+  8015bf:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8015c3:	4c 89 e7             	mov    %r12,%rdi
+  8015c6:	48 b8 40 11 80 00 00 	movabs $0x801140,%rax
+  8015cd:	00 00 00 
+  8015d0:	ff d0                	call   *%rax
+  8015d2:	eb ac                	jmp    801580 <readvalue+0x56>
+    } else if ((strcmp(format, "%ld") == 0) || (strcmp(format, "%lld") == 0)) {
+  8015d4:	48 be e7 53 80 00 00 	movabs $0x8053e7,%rsi
+  8015db:	00 00 00 
+  8015de:	48 89 df             	mov    %rbx,%rdi
+  8015e1:	48 b8 83 0f 80 00 00 	movabs $0x800f83,%rax
+  8015e8:	00 00 00 
+  8015eb:	ff d0                	call   *%rax
+  8015ed:	85 c0                	test   %eax,%eax
+  8015ef:	74 1d                	je     80160e <readvalue+0xe4>
+  8015f1:	48 be eb 53 80 00 00 	movabs $0x8053eb,%rsi
+  8015f8:	00 00 00 
+  8015fb:	48 89 df             	mov    %rbx,%rdi
+  8015fe:	48 b8 83 0f 80 00 00 	movabs $0x800f83,%rax
+  801605:	00 00 00 
+  801608:	ff d0                	call   *%rax
+  80160a:	85 c0                	test   %eax,%eax
+  80160c:	75 30                	jne    80163e <readvalue+0x114>
+        long long result = s2lld(buf);
+  80160e:	4c 89 ef             	mov    %r13,%rdi
+  801611:	48 b8 50 14 80 00 00 	movabs $0x801450,%rax
+  801618:	00 00 00 
+  80161b:	ff d0                	call   *%rax
+  80161d:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+        memcpy(value, &result, sizeof(result));
+  801621:	ba 08 00 00 00       	mov    $0x8,%edx
+  801626:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80162a:	4c 89 e7             	mov    %r12,%rdi
+  80162d:	48 b8 40 11 80 00 00 	movabs $0x801140,%rax
+  801634:	00 00 00 
+  801637:	ff d0                	call   *%rax
+    } else if ((strcmp(format, "%ld") == 0) || (strcmp(format, "%lld") == 0)) {
+  801639:	e9 42 ff ff ff       	jmp    801580 <readvalue+0x56>
+    } else if (strcmp(format, "%u") == 0) {
+  80163e:	48 be f0 53 80 00 00 	movabs $0x8053f0,%rsi
+  801645:	00 00 00 
+  801648:	48 89 df             	mov    %rbx,%rdi
+  80164b:	48 b8 83 0f 80 00 00 	movabs $0x800f83,%rax
+  801652:	00 00 00 
+  801655:	ff d0                	call   *%rax
+  801657:	85 c0                	test   %eax,%eax
+  801659:	75 2f                	jne    80168a <readvalue+0x160>
+        unsigned result = s2llu(buf);
+  80165b:	4c 89 ef             	mov    %r13,%rdi
+  80165e:	48 b8 c8 14 80 00 00 	movabs $0x8014c8,%rax
+  801665:	00 00 00 
+  801668:	ff d0                	call   *%rax
+  80166a:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        memcpy(value, &result, sizeof(result));
+  80166d:	ba 04 00 00 00       	mov    $0x4,%edx
+  801672:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801676:	4c 89 e7             	mov    %r12,%rdi
+  801679:	48 b8 40 11 80 00 00 	movabs $0x801140,%rax
+  801680:	00 00 00 
+  801683:	ff d0                	call   *%rax
+  801685:	e9 f6 fe ff ff       	jmp    801580 <readvalue+0x56>
+    } else if ((strcmp(format, "%lu") == 0) || (strcmp(format, "%llu") == 0)) {
+  80168a:	48 be f3 53 80 00 00 	movabs $0x8053f3,%rsi
+  801691:	00 00 00 
+  801694:	48 89 df             	mov    %rbx,%rdi
+  801697:	48 b8 83 0f 80 00 00 	movabs $0x800f83,%rax
+  80169e:	00 00 00 
+  8016a1:	ff d0                	call   *%rax
+  8016a3:	85 c0                	test   %eax,%eax
+  8016a5:	74 1d                	je     8016c4 <readvalue+0x19a>
+  8016a7:	48 be f7 53 80 00 00 	movabs $0x8053f7,%rsi
+  8016ae:	00 00 00 
+  8016b1:	48 89 df             	mov    %rbx,%rdi
+  8016b4:	48 b8 83 0f 80 00 00 	movabs $0x800f83,%rax
+  8016bb:	00 00 00 
+  8016be:	ff d0                	call   *%rax
+  8016c0:	85 c0                	test   %eax,%eax
+  8016c2:	75 30                	jne    8016f4 <readvalue+0x1ca>
+        unsigned long long result = s2llu(buf);
+  8016c4:	4c 89 ef             	mov    %r13,%rdi
+  8016c7:	48 b8 c8 14 80 00 00 	movabs $0x8014c8,%rax
+  8016ce:	00 00 00 
+  8016d1:	ff d0                	call   *%rax
+  8016d3:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+        memcpy(value, &result, sizeof(result));
+  8016d7:	ba 08 00 00 00       	mov    $0x8,%edx
+  8016dc:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8016e0:	4c 89 e7             	mov    %r12,%rdi
+  8016e3:	48 b8 40 11 80 00 00 	movabs $0x801140,%rax
+  8016ea:	00 00 00 
+  8016ed:	ff d0                	call   *%rax
+    } else if ((strcmp(format, "%lu") == 0) || (strcmp(format, "%llu") == 0)) {
+  8016ef:	e9 8c fe ff ff       	jmp    801580 <readvalue+0x56>
+    } else if (strcmp(format, "%f") == 0) {
+  8016f4:	48 be fc 53 80 00 00 	movabs $0x8053fc,%rsi
+  8016fb:	00 00 00 
+  8016fe:	48 89 df             	mov    %rbx,%rdi
+  801701:	48 b8 83 0f 80 00 00 	movabs $0x800f83,%rax
+  801708:	00 00 00 
+  80170b:	ff d0                	call   *%rax
+  80170d:	85 c0                	test   %eax,%eax
+  80170f:	0f 84 6b fe ff ff    	je     801580 <readvalue+0x56>
+    } else if (strcmp(format, "%lf") == 0) {
+  801715:	48 be ff 53 80 00 00 	movabs $0x8053ff,%rsi
+  80171c:	00 00 00 
+  80171f:	48 89 df             	mov    %rbx,%rdi
+  801722:	48 b8 83 0f 80 00 00 	movabs $0x800f83,%rax
+  801729:	00 00 00 
+  80172c:	ff d0                	call   *%rax
+  80172e:	85 c0                	test   %eax,%eax
+  801730:	0f 84 4a fe ff ff    	je     801580 <readvalue+0x56>
+    } else if (strcmp(format, "%c") == 0) {
+  801736:	48 be 03 54 80 00 00 	movabs $0x805403,%rsi
+  80173d:	00 00 00 
+  801740:	48 89 df             	mov    %rbx,%rdi
+  801743:	48 b8 83 0f 80 00 00 	movabs $0x800f83,%rax
+  80174a:	00 00 00 
+  80174d:	ff d0                	call   *%rax
+  80174f:	85 c0                	test   %eax,%eax
+  801751:	0f 85 29 fe ff ff    	jne    801580 <readvalue+0x56>
+        char result = buf[0];
+  801757:	41 0f b6 45 00       	movzbl 0x0(%r13),%eax
+  80175c:	88 45 d8             	mov    %al,-0x28(%rbp)
+        memcpy(value, &result, sizeof(result));
+  80175f:	ba 01 00 00 00       	mov    $0x1,%edx
+  801764:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801768:	4c 89 e7             	mov    %r12,%rdi
+  80176b:	48 b8 40 11 80 00 00 	movabs $0x801140,%rax
+  801772:	00 00 00 
+  801775:	ff d0                	call   *%rax
+  801777:	e9 04 fe ff ff       	jmp    801580 <readvalue+0x56>
+
+000000000080177c <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  80177c:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801781:	ba 00 00 00 00       	mov    $0x0,%edx
+  801786:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80178c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801792:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  801798:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80179a:	c3                   	ret
+
+000000000080179b <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  80179b:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8017a0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8017a5:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8017aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017af:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8017b5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8017bb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8017c1:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8017c3:	c3                   	ret
+
+00000000008017c4 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8017c4:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8017c7:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8017cc:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8017d1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017d6:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8017dc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8017e2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8017e8:	0f 05                	syscall
+    if (check && ret > 0) {
+  8017ea:	48 85 c0             	test   %rax,%rax
+  8017ed:	7f 01                	jg     8017f0 <sys_env_destroy+0x2c>
+}
+  8017ef:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  8017f0:	55                   	push   %rbp
+  8017f1:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017f4:	49 89 c0             	mov    %rax,%r8
+  8017f7:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8017fc:	48 ba 08 54 80 00 00 	movabs $0x805408,%rdx
+  801803:	00 00 00 
+  801806:	be 29 00 00 00       	mov    $0x29,%esi
+  80180b:	48 bf 27 54 80 00 00 	movabs $0x805427,%rdi
+  801812:	00 00 00 
+  801815:	b8 00 00 00 00       	mov    $0x0,%eax
+  80181a:	49 b9 6a 04 80 00 00 	movabs $0x80046a,%r9
+  801821:	00 00 00 
+  801824:	41 ff d1             	call   *%r9
+
+0000000000801827 <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  801827:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80182c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801831:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801836:	ba 00 00 00 00       	mov    $0x0,%edx
+  80183b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801841:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801847:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80184d:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80184f:	c3                   	ret
+
+0000000000801850 <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  801850:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801855:	bf 00 00 00 00       	mov    $0x0,%edi
+  80185a:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80185f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801864:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80186a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801870:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801876:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801878:	c3                   	ret
+
+0000000000801879 <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  801879:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80187e:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  801885:	00 00 00 
+  801888:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80188e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801894:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80189a:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80189c:	c3                   	ret
+
+000000000080189d <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80189d:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  8018a0:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8018a5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8018ab:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8018b1:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8018b3:	c3                   	ret
+
+00000000008018b4 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8018b4:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8018b7:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8018bc:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8018bf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8018c5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8018cb:	0f 05                	syscall
+    if (check && ret > 0) {
+  8018cd:	48 85 c0             	test   %rax,%rax
+  8018d0:	7f 01                	jg     8018d3 <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8018d2:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8018d3:	55                   	push   %rbp
+  8018d4:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018d7:	49 89 c0             	mov    %rax,%r8
+  8018da:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8018df:	48 ba 08 54 80 00 00 	movabs $0x805408,%rdx
+  8018e6:	00 00 00 
+  8018e9:	be 29 00 00 00       	mov    $0x29,%esi
+  8018ee:	48 bf 27 54 80 00 00 	movabs $0x805427,%rdi
+  8018f5:	00 00 00 
+  8018f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018fd:	49 b9 6a 04 80 00 00 	movabs $0x80046a,%r9
+  801904:	00 00 00 
+  801907:	41 ff d1             	call   *%r9
+
+000000000080190a <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80190a:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80190d:	48 63 d2             	movslq %edx,%rdx
+  801910:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801913:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801918:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  80191b:	0f 05                	syscall
+    if (check && ret > 0) {
+  80191d:	48 85 c0             	test   %rax,%rax
+  801920:	7f 01                	jg     801923 <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801922:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801923:	55                   	push   %rbp
+  801924:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801927:	49 89 c0             	mov    %rax,%r8
+  80192a:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80192f:	48 ba 08 54 80 00 00 	movabs $0x805408,%rdx
+  801936:	00 00 00 
+  801939:	be 29 00 00 00       	mov    $0x29,%esi
+  80193e:	48 bf 27 54 80 00 00 	movabs $0x805427,%rdi
+  801945:	00 00 00 
+  801948:	b8 00 00 00 00       	mov    $0x0,%eax
+  80194d:	49 b9 6a 04 80 00 00 	movabs $0x80046a,%r9
+  801954:	00 00 00 
+  801957:	41 ff d1             	call   *%r9
+
+000000000080195a <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80195a:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80195d:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801962:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801968:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80196e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801974:	0f 05                	syscall
+    if (check && ret > 0) {
+  801976:	48 85 c0             	test   %rax,%rax
+  801979:	7f 01                	jg     80197c <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80197b:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80197c:	55                   	push   %rbp
+  80197d:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801980:	49 89 c0             	mov    %rax,%r8
+  801983:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801988:	48 ba 08 54 80 00 00 	movabs $0x805408,%rdx
+  80198f:	00 00 00 
+  801992:	be 29 00 00 00       	mov    $0x29,%esi
+  801997:	48 bf 27 54 80 00 00 	movabs $0x805427,%rdi
+  80199e:	00 00 00 
+  8019a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019a6:	49 b9 6a 04 80 00 00 	movabs $0x80046a,%r9
+  8019ad:	00 00 00 
+  8019b0:	41 ff d1             	call   *%r9
+
+00000000008019b3 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8019b3:	48 63 f6             	movslq %esi,%rsi
+  8019b6:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8019b9:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8019be:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019c3:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8019c9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8019cf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8019d5:	0f 05                	syscall
+    if (check && ret > 0) {
+  8019d7:	48 85 c0             	test   %rax,%rax
+  8019da:	7f 01                	jg     8019dd <sys_env_set_status+0x2a>
+}
+  8019dc:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  8019dd:	55                   	push   %rbp
+  8019de:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8019e1:	49 89 c0             	mov    %rax,%r8
+  8019e4:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8019e9:	48 ba 08 54 80 00 00 	movabs $0x805408,%rdx
+  8019f0:	00 00 00 
+  8019f3:	be 29 00 00 00       	mov    $0x29,%esi
+  8019f8:	48 bf 27 54 80 00 00 	movabs $0x805427,%rdi
+  8019ff:	00 00 00 
+  801a02:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a07:	49 b9 6a 04 80 00 00 	movabs $0x80046a,%r9
+  801a0e:	00 00 00 
+  801a11:	41 ff d1             	call   *%r9
+
+0000000000801a14 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801a14:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801a17:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801a1c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a21:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801a27:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801a2d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801a33:	0f 05                	syscall
+    if (check && ret > 0) {
+  801a35:	48 85 c0             	test   %rax,%rax
+  801a38:	7f 01                	jg     801a3b <sys_env_set_trapframe+0x27>
+}
+  801a3a:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801a3b:	55                   	push   %rbp
+  801a3c:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801a3f:	49 89 c0             	mov    %rax,%r8
+  801a42:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801a47:	48 ba 08 54 80 00 00 	movabs $0x805408,%rdx
+  801a4e:	00 00 00 
+  801a51:	be 29 00 00 00       	mov    $0x29,%esi
+  801a56:	48 bf 27 54 80 00 00 	movabs $0x805427,%rdi
+  801a5d:	00 00 00 
+  801a60:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a65:	49 b9 6a 04 80 00 00 	movabs $0x80046a,%r9
+  801a6c:	00 00 00 
+  801a6f:	41 ff d1             	call   *%r9
+
+0000000000801a72 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801a72:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801a75:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801a7a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a7f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801a85:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801a8b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801a91:	0f 05                	syscall
+    if (check && ret > 0) {
+  801a93:	48 85 c0             	test   %rax,%rax
+  801a96:	7f 01                	jg     801a99 <sys_env_set_pgfault_upcall+0x27>
+}
+  801a98:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801a99:	55                   	push   %rbp
+  801a9a:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801a9d:	49 89 c0             	mov    %rax,%r8
+  801aa0:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801aa5:	48 ba 08 54 80 00 00 	movabs $0x805408,%rdx
+  801aac:	00 00 00 
+  801aaf:	be 29 00 00 00       	mov    $0x29,%esi
+  801ab4:	48 bf 27 54 80 00 00 	movabs $0x805427,%rdi
+  801abb:	00 00 00 
+  801abe:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ac3:	49 b9 6a 04 80 00 00 	movabs $0x80046a,%r9
+  801aca:	00 00 00 
+  801acd:	41 ff d1             	call   *%r9
+
+0000000000801ad0 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801ad0:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801ad3:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801ad6:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801adb:	4d 63 c0             	movslq %r8d,%r8
+  801ade:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801ae4:	0f 05                	syscall
+}
+  801ae6:	c3                   	ret
+
+0000000000801ae7 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801ae7:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801aea:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801aed:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801af2:	4d 63 c0             	movslq %r8d,%r8
+  801af5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801afb:	0f 05                	syscall
+}
+  801afd:	c3                   	ret
+
+0000000000801afe <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  801afe:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801b03:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801b06:	45 89 c0             	mov    %r8d,%r8d
+  801b09:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801b0f:	0f 05                	syscall
+    if (check && ret > 0) {
+  801b11:	48 85 c0             	test   %rax,%rax
+  801b14:	7f 01                	jg     801b17 <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801b16:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  801b17:	55                   	push   %rbp
+  801b18:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801b1b:	49 89 c0             	mov    %rax,%r8
+  801b1e:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801b23:	48 ba 08 54 80 00 00 	movabs $0x805408,%rdx
+  801b2a:	00 00 00 
+  801b2d:	be 29 00 00 00       	mov    $0x29,%esi
+  801b32:	48 bf 27 54 80 00 00 	movabs $0x805427,%rdi
+  801b39:	00 00 00 
+  801b3c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b41:	49 b9 6a 04 80 00 00 	movabs $0x80046a,%r9
+  801b48:	00 00 00 
+  801b4b:	41 ff d1             	call   *%r9
+
+0000000000801b4e <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  801b4e:	55                   	push   %rbp
+  801b4f:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  801b52:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801b58:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801b5d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b62:	48 b8 fe 1a 80 00 00 	movabs $0x801afe,%rax
+  801b69:	00 00 00 
+  801b6c:	ff d0                	call   *%rax
+}
+  801b6e:	5d                   	pop    %rbp
+  801b6f:	c3                   	ret
+
+0000000000801b70 <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  801b70:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801b75:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b7a:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801b7f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b84:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801b8a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801b90:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801b96:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801b98:	c3                   	ret
+
+0000000000801b99 <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  801b99:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801b9e:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801ba3:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ba8:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801bae:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801bb4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801bba:	0f 05                	syscall
+    if (check && ret > 0) {
+  801bbc:	48 85 c0             	test   %rax,%rax
+  801bbf:	7f 01                	jg     801bc2 <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  801bc1:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  801bc2:	55                   	push   %rbp
+  801bc3:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801bc6:	49 89 c0             	mov    %rax,%r8
+  801bc9:	b9 10 00 00 00       	mov    $0x10,%ecx
+  801bce:	48 ba 08 54 80 00 00 	movabs $0x805408,%rdx
+  801bd5:	00 00 00 
+  801bd8:	be 29 00 00 00       	mov    $0x29,%esi
+  801bdd:	48 bf 27 54 80 00 00 	movabs $0x805427,%rdi
+  801be4:	00 00 00 
+  801be7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bec:	49 b9 6a 04 80 00 00 	movabs $0x80046a,%r9
+  801bf3:	00 00 00 
+  801bf6:	41 ff d1             	call   *%r9
+
+0000000000801bf9 <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  801bf9:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801bfe:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c03:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801c08:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c0d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801c13:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801c19:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801c1f:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  801c21:	c3                   	ret
+
+0000000000801c22 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  801c22:	89 d2                	mov    %edx,%edx
+  801c24:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  801c26:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801c2b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801c31:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801c37:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801c3d:	0f 05                	syscall
+}
+  801c3f:	c3                   	ret
+
+0000000000801c40 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  801c40:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  801c43:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801c48:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c4d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801c53:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801c59:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801c5f:	0f 05                	syscall
+}
+  801c61:	c3                   	ret
+
+0000000000801c62 <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  801c62:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  801c65:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801c6a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c6f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801c75:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801c7b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801c81:	0f 05                	syscall
+}
+  801c83:	c3                   	ret
+
+0000000000801c84 <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  801c84:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801c87:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801c8c:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801c91:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c96:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801c9c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801ca2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801ca8:	0f 05                	syscall
+    if (check && ret > 0) {
+  801caa:	48 85 c0             	test   %rax,%rax
+  801cad:	7f 01                	jg     801cb0 <sys_irq_ack+0x2c>
+}
+  801caf:	c3                   	ret
+sys_irq_ack(int irq) {
+  801cb0:	55                   	push   %rbp
+  801cb1:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801cb4:	49 89 c0             	mov    %rax,%r8
+  801cb7:	b9 16 00 00 00       	mov    $0x16,%ecx
+  801cbc:	48 ba 08 54 80 00 00 	movabs $0x805408,%rdx
+  801cc3:	00 00 00 
+  801cc6:	be 29 00 00 00       	mov    $0x29,%esi
+  801ccb:	48 bf 27 54 80 00 00 	movabs $0x805427,%rdi
+  801cd2:	00 00 00 
+  801cd5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cda:	49 b9 6a 04 80 00 00 	movabs $0x80046a,%r9
+  801ce1:	00 00 00 
+  801ce4:	41 ff d1             	call   *%r9
+
+0000000000801ce7 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801ce7:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801cee:	ff ff ff 
+  801cf1:	48 01 f8             	add    %rdi,%rax
+  801cf4:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801cf8:	c3                   	ret
+
+0000000000801cf9 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801cf9:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801d00:	ff ff ff 
+  801d03:	48 01 f8             	add    %rdi,%rax
+  801d06:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801d0a:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801d10:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801d14:	c3                   	ret
+
+0000000000801d15 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801d15:	55                   	push   %rbp
+  801d16:	48 89 e5             	mov    %rsp,%rbp
+  801d19:	41 57                	push   %r15
+  801d1b:	41 56                	push   %r14
+  801d1d:	41 55                	push   %r13
+  801d1f:	41 54                	push   %r12
+  801d21:	53                   	push   %rbx
+  801d22:	48 83 ec 08          	sub    $0x8,%rsp
+  801d26:	49 89 ff             	mov    %rdi,%r15
+  801d29:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801d2e:	49 bd 48 46 80 00 00 	movabs $0x804648,%r13
+  801d35:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801d38:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801d3e:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801d41:	48 89 df             	mov    %rbx,%rdi
+  801d44:	41 ff d5             	call   *%r13
+  801d47:	83 e0 04             	and    $0x4,%eax
+  801d4a:	74 17                	je     801d63 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801d4c:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801d53:	4c 39 f3             	cmp    %r14,%rbx
+  801d56:	75 e6                	jne    801d3e <fd_alloc+0x29>
+  801d58:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801d5e:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801d63:	4d 89 27             	mov    %r12,(%r15)
+}
+  801d66:	48 83 c4 08          	add    $0x8,%rsp
+  801d6a:	5b                   	pop    %rbx
+  801d6b:	41 5c                	pop    %r12
+  801d6d:	41 5d                	pop    %r13
+  801d6f:	41 5e                	pop    %r14
+  801d71:	41 5f                	pop    %r15
+  801d73:	5d                   	pop    %rbp
+  801d74:	c3                   	ret
+
+0000000000801d75 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801d75:	83 ff 1f             	cmp    $0x1f,%edi
+  801d78:	77 39                	ja     801db3 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801d7a:	55                   	push   %rbp
+  801d7b:	48 89 e5             	mov    %rsp,%rbp
+  801d7e:	41 54                	push   %r12
+  801d80:	53                   	push   %rbx
+  801d81:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801d84:	48 63 df             	movslq %edi,%rbx
+  801d87:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801d8e:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801d92:	48 89 df             	mov    %rbx,%rdi
+  801d95:	48 b8 48 46 80 00 00 	movabs $0x804648,%rax
+  801d9c:	00 00 00 
+  801d9f:	ff d0                	call   *%rax
+  801da1:	a8 04                	test   $0x4,%al
+  801da3:	74 14                	je     801db9 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801da5:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801da9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801dae:	5b                   	pop    %rbx
+  801daf:	41 5c                	pop    %r12
+  801db1:	5d                   	pop    %rbp
+  801db2:	c3                   	ret
+        return -E_INVAL;
+  801db3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801db8:	c3                   	ret
+        return -E_INVAL;
+  801db9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801dbe:	eb ee                	jmp    801dae <fd_lookup+0x39>
+
+0000000000801dc0 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801dc0:	55                   	push   %rbp
+  801dc1:	48 89 e5             	mov    %rsp,%rbp
+  801dc4:	41 54                	push   %r12
+  801dc6:	53                   	push   %rbx
+  801dc7:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801dca:	48 b8 c0 54 80 00 00 	movabs $0x8054c0,%rax
+  801dd1:	00 00 00 
+  801dd4:	48 bb 60 60 80 00 00 	movabs $0x806060,%rbx
+  801ddb:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801dde:	39 3b                	cmp    %edi,(%rbx)
+  801de0:	74 47                	je     801e29 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801de2:	48 83 c0 08          	add    $0x8,%rax
+  801de6:	48 8b 18             	mov    (%rax),%rbx
+  801de9:	48 85 db             	test   %rbx,%rbx
+  801dec:	75 f0                	jne    801dde <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801dee:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801df5:	00 00 00 
+  801df8:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801dfe:	89 fa                	mov    %edi,%edx
+  801e00:	48 bf 38 54 80 00 00 	movabs $0x805438,%rdi
+  801e07:	00 00 00 
+  801e0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e0f:	48 b9 ba 05 80 00 00 	movabs $0x8005ba,%rcx
+  801e16:	00 00 00 
+  801e19:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801e1b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801e20:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801e24:	5b                   	pop    %rbx
+  801e25:	41 5c                	pop    %r12
+  801e27:	5d                   	pop    %rbp
+  801e28:	c3                   	ret
+            return 0;
+  801e29:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e2e:	eb f0                	jmp    801e20 <dev_lookup+0x60>
+
+0000000000801e30 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801e30:	55                   	push   %rbp
+  801e31:	48 89 e5             	mov    %rsp,%rbp
+  801e34:	41 55                	push   %r13
+  801e36:	41 54                	push   %r12
+  801e38:	53                   	push   %rbx
+  801e39:	48 83 ec 18          	sub    $0x18,%rsp
+  801e3d:	48 89 fb             	mov    %rdi,%rbx
+  801e40:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801e43:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801e4a:	ff ff ff 
+  801e4d:	48 01 df             	add    %rbx,%rdi
+  801e50:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801e54:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e58:	48 b8 75 1d 80 00 00 	movabs $0x801d75,%rax
+  801e5f:	00 00 00 
+  801e62:	ff d0                	call   *%rax
+  801e64:	41 89 c5             	mov    %eax,%r13d
+  801e67:	85 c0                	test   %eax,%eax
+  801e69:	78 06                	js     801e71 <fd_close+0x41>
+  801e6b:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801e6f:	74 1a                	je     801e8b <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801e71:	45 84 e4             	test   %r12b,%r12b
+  801e74:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e79:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801e7d:	44 89 e8             	mov    %r13d,%eax
+  801e80:	48 83 c4 18          	add    $0x18,%rsp
+  801e84:	5b                   	pop    %rbx
+  801e85:	41 5c                	pop    %r12
+  801e87:	41 5d                	pop    %r13
+  801e89:	5d                   	pop    %rbp
+  801e8a:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801e8b:	8b 3b                	mov    (%rbx),%edi
+  801e8d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e91:	48 b8 c0 1d 80 00 00 	movabs $0x801dc0,%rax
+  801e98:	00 00 00 
+  801e9b:	ff d0                	call   *%rax
+  801e9d:	41 89 c5             	mov    %eax,%r13d
+  801ea0:	85 c0                	test   %eax,%eax
+  801ea2:	78 1b                	js     801ebf <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801ea4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ea8:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801eac:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801eb2:	48 85 c0             	test   %rax,%rax
+  801eb5:	74 08                	je     801ebf <fd_close+0x8f>
+  801eb7:	48 89 df             	mov    %rbx,%rdi
+  801eba:	ff d0                	call   *%rax
+  801ebc:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801ebf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ec4:	48 89 de             	mov    %rbx,%rsi
+  801ec7:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ecc:	48 b8 5a 19 80 00 00 	movabs $0x80195a,%rax
+  801ed3:	00 00 00 
+  801ed6:	ff d0                	call   *%rax
+    return res;
+  801ed8:	eb a3                	jmp    801e7d <fd_close+0x4d>
+
+0000000000801eda <close>:
+
+int
+close(int fdnum) {
+  801eda:	55                   	push   %rbp
+  801edb:	48 89 e5             	mov    %rsp,%rbp
+  801ede:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801ee2:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801ee6:	48 b8 75 1d 80 00 00 	movabs $0x801d75,%rax
+  801eed:	00 00 00 
+  801ef0:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801ef2:	85 c0                	test   %eax,%eax
+  801ef4:	78 15                	js     801f0b <close+0x31>
+
+    return fd_close(fd, 1);
+  801ef6:	be 01 00 00 00       	mov    $0x1,%esi
+  801efb:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801eff:	48 b8 30 1e 80 00 00 	movabs $0x801e30,%rax
+  801f06:	00 00 00 
+  801f09:	ff d0                	call   *%rax
+}
+  801f0b:	c9                   	leave
+  801f0c:	c3                   	ret
+
+0000000000801f0d <close_all>:
+
+void
+close_all(void) {
+  801f0d:	55                   	push   %rbp
+  801f0e:	48 89 e5             	mov    %rsp,%rbp
+  801f11:	41 54                	push   %r12
+  801f13:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801f14:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f19:	49 bc da 1e 80 00 00 	movabs $0x801eda,%r12
+  801f20:	00 00 00 
+  801f23:	89 df                	mov    %ebx,%edi
+  801f25:	41 ff d4             	call   *%r12
+  801f28:	83 c3 01             	add    $0x1,%ebx
+  801f2b:	83 fb 20             	cmp    $0x20,%ebx
+  801f2e:	75 f3                	jne    801f23 <close_all+0x16>
+}
+  801f30:	5b                   	pop    %rbx
+  801f31:	41 5c                	pop    %r12
+  801f33:	5d                   	pop    %rbp
+  801f34:	c3                   	ret
+
+0000000000801f35 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801f35:	55                   	push   %rbp
+  801f36:	48 89 e5             	mov    %rsp,%rbp
+  801f39:	41 57                	push   %r15
+  801f3b:	41 56                	push   %r14
+  801f3d:	41 55                	push   %r13
+  801f3f:	41 54                	push   %r12
+  801f41:	53                   	push   %rbx
+  801f42:	48 83 ec 18          	sub    $0x18,%rsp
+  801f46:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801f49:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801f4d:	48 b8 75 1d 80 00 00 	movabs $0x801d75,%rax
+  801f54:	00 00 00 
+  801f57:	ff d0                	call   *%rax
+  801f59:	89 c3                	mov    %eax,%ebx
+  801f5b:	85 c0                	test   %eax,%eax
+  801f5d:	0f 88 b8 00 00 00    	js     80201b <dup+0xe6>
+    close(newfdnum);
+  801f63:	44 89 e7             	mov    %r12d,%edi
+  801f66:	48 b8 da 1e 80 00 00 	movabs $0x801eda,%rax
+  801f6d:	00 00 00 
+  801f70:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801f72:	4d 63 ec             	movslq %r12d,%r13
+  801f75:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801f7c:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801f80:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801f84:	4c 89 ff             	mov    %r15,%rdi
+  801f87:	49 be f9 1c 80 00 00 	movabs $0x801cf9,%r14
+  801f8e:	00 00 00 
+  801f91:	41 ff d6             	call   *%r14
+  801f94:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801f97:	4c 89 ef             	mov    %r13,%rdi
+  801f9a:	41 ff d6             	call   *%r14
+  801f9d:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801fa0:	48 89 df             	mov    %rbx,%rdi
+  801fa3:	48 b8 48 46 80 00 00 	movabs $0x804648,%rax
+  801faa:	00 00 00 
+  801fad:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801faf:	a8 04                	test   $0x4,%al
+  801fb1:	74 2b                	je     801fde <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801fb3:	41 89 c1             	mov    %eax,%r9d
+  801fb6:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801fbc:	4c 89 f1             	mov    %r14,%rcx
+  801fbf:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fc4:	48 89 de             	mov    %rbx,%rsi
+  801fc7:	bf 00 00 00 00       	mov    $0x0,%edi
+  801fcc:	48 b8 0a 19 80 00 00 	movabs $0x80190a,%rax
+  801fd3:	00 00 00 
+  801fd6:	ff d0                	call   *%rax
+  801fd8:	89 c3                	mov    %eax,%ebx
+  801fda:	85 c0                	test   %eax,%eax
+  801fdc:	78 4e                	js     80202c <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801fde:	4c 89 ff             	mov    %r15,%rdi
+  801fe1:	48 b8 48 46 80 00 00 	movabs $0x804648,%rax
+  801fe8:	00 00 00 
+  801feb:	ff d0                	call   *%rax
+  801fed:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801ff0:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801ff6:	4c 89 e9             	mov    %r13,%rcx
+  801ff9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ffe:	4c 89 fe             	mov    %r15,%rsi
+  802001:	bf 00 00 00 00       	mov    $0x0,%edi
+  802006:	48 b8 0a 19 80 00 00 	movabs $0x80190a,%rax
+  80200d:	00 00 00 
+  802010:	ff d0                	call   *%rax
+  802012:	89 c3                	mov    %eax,%ebx
+  802014:	85 c0                	test   %eax,%eax
+  802016:	78 14                	js     80202c <dup+0xf7>
+
+    return newfdnum;
+  802018:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  80201b:	89 d8                	mov    %ebx,%eax
+  80201d:	48 83 c4 18          	add    $0x18,%rsp
+  802021:	5b                   	pop    %rbx
+  802022:	41 5c                	pop    %r12
+  802024:	41 5d                	pop    %r13
+  802026:	41 5e                	pop    %r14
+  802028:	41 5f                	pop    %r15
+  80202a:	5d                   	pop    %rbp
+  80202b:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  80202c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802031:	4c 89 ee             	mov    %r13,%rsi
+  802034:	bf 00 00 00 00       	mov    $0x0,%edi
+  802039:	49 bc 5a 19 80 00 00 	movabs $0x80195a,%r12
+  802040:	00 00 00 
+  802043:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  802046:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80204b:	4c 89 f6             	mov    %r14,%rsi
+  80204e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802053:	41 ff d4             	call   *%r12
+    return res;
+  802056:	eb c3                	jmp    80201b <dup+0xe6>
+
+0000000000802058 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802058:	55                   	push   %rbp
+  802059:	48 89 e5             	mov    %rsp,%rbp
+  80205c:	41 56                	push   %r14
+  80205e:	41 55                	push   %r13
+  802060:	41 54                	push   %r12
+  802062:	53                   	push   %rbx
+  802063:	48 83 ec 10          	sub    $0x10,%rsp
+  802067:	89 fb                	mov    %edi,%ebx
+  802069:	49 89 f4             	mov    %rsi,%r12
+  80206c:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80206f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802073:	48 b8 75 1d 80 00 00 	movabs $0x801d75,%rax
+  80207a:	00 00 00 
+  80207d:	ff d0                	call   *%rax
+  80207f:	85 c0                	test   %eax,%eax
+  802081:	78 4c                	js     8020cf <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802083:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802087:	41 8b 3e             	mov    (%r14),%edi
+  80208a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80208e:	48 b8 c0 1d 80 00 00 	movabs $0x801dc0,%rax
+  802095:	00 00 00 
+  802098:	ff d0                	call   *%rax
+  80209a:	85 c0                	test   %eax,%eax
+  80209c:	78 35                	js     8020d3 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80209e:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8020a2:	83 e0 03             	and    $0x3,%eax
+  8020a5:	83 f8 01             	cmp    $0x1,%eax
+  8020a8:	74 2d                	je     8020d7 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8020aa:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8020ae:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8020b2:	48 85 c0             	test   %rax,%rax
+  8020b5:	74 56                	je     80210d <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8020b7:	4c 89 ea             	mov    %r13,%rdx
+  8020ba:	4c 89 e6             	mov    %r12,%rsi
+  8020bd:	4c 89 f7             	mov    %r14,%rdi
+  8020c0:	ff d0                	call   *%rax
+}
+  8020c2:	48 83 c4 10          	add    $0x10,%rsp
+  8020c6:	5b                   	pop    %rbx
+  8020c7:	41 5c                	pop    %r12
+  8020c9:	41 5d                	pop    %r13
+  8020cb:	41 5e                	pop    %r14
+  8020cd:	5d                   	pop    %rbp
+  8020ce:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8020cf:	48 98                	cltq
+  8020d1:	eb ef                	jmp    8020c2 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8020d3:	48 98                	cltq
+  8020d5:	eb eb                	jmp    8020c2 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8020d7:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8020de:	00 00 00 
+  8020e1:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8020e7:	89 da                	mov    %ebx,%edx
+  8020e9:	48 bf 79 54 80 00 00 	movabs $0x805479,%rdi
+  8020f0:	00 00 00 
+  8020f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020f8:	48 b9 ba 05 80 00 00 	movabs $0x8005ba,%rcx
+  8020ff:	00 00 00 
+  802102:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802104:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80210b:	eb b5                	jmp    8020c2 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80210d:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802114:	eb ac                	jmp    8020c2 <read+0x6a>
+
+0000000000802116 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802116:	55                   	push   %rbp
+  802117:	48 89 e5             	mov    %rsp,%rbp
+  80211a:	41 57                	push   %r15
+  80211c:	41 56                	push   %r14
+  80211e:	41 55                	push   %r13
+  802120:	41 54                	push   %r12
+  802122:	53                   	push   %rbx
+  802123:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802127:	48 85 d2             	test   %rdx,%rdx
+  80212a:	74 54                	je     802180 <readn+0x6a>
+  80212c:	41 89 fd             	mov    %edi,%r13d
+  80212f:	49 89 f6             	mov    %rsi,%r14
+  802132:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802135:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  80213a:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  80213f:	49 bf 58 20 80 00 00 	movabs $0x802058,%r15
+  802146:	00 00 00 
+  802149:	4c 89 e2             	mov    %r12,%rdx
+  80214c:	48 29 f2             	sub    %rsi,%rdx
+  80214f:	4c 01 f6             	add    %r14,%rsi
+  802152:	44 89 ef             	mov    %r13d,%edi
+  802155:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802158:	85 c0                	test   %eax,%eax
+  80215a:	78 20                	js     80217c <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80215c:	01 c3                	add    %eax,%ebx
+  80215e:	85 c0                	test   %eax,%eax
+  802160:	74 08                	je     80216a <readn+0x54>
+  802162:	48 63 f3             	movslq %ebx,%rsi
+  802165:	4c 39 e6             	cmp    %r12,%rsi
+  802168:	72 df                	jb     802149 <readn+0x33>
+    }
+    return res;
+  80216a:	48 63 c3             	movslq %ebx,%rax
+}
+  80216d:	48 83 c4 08          	add    $0x8,%rsp
+  802171:	5b                   	pop    %rbx
+  802172:	41 5c                	pop    %r12
+  802174:	41 5d                	pop    %r13
+  802176:	41 5e                	pop    %r14
+  802178:	41 5f                	pop    %r15
+  80217a:	5d                   	pop    %rbp
+  80217b:	c3                   	ret
+        if (inc < 0) return inc;
+  80217c:	48 98                	cltq
+  80217e:	eb ed                	jmp    80216d <readn+0x57>
+    int inc = 1, res = 0;
+  802180:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802185:	eb e3                	jmp    80216a <readn+0x54>
+
+0000000000802187 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802187:	55                   	push   %rbp
+  802188:	48 89 e5             	mov    %rsp,%rbp
+  80218b:	41 56                	push   %r14
+  80218d:	41 55                	push   %r13
+  80218f:	41 54                	push   %r12
+  802191:	53                   	push   %rbx
+  802192:	48 83 ec 10          	sub    $0x10,%rsp
+  802196:	89 fb                	mov    %edi,%ebx
+  802198:	49 89 f4             	mov    %rsi,%r12
+  80219b:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80219e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8021a2:	48 b8 75 1d 80 00 00 	movabs $0x801d75,%rax
+  8021a9:	00 00 00 
+  8021ac:	ff d0                	call   *%rax
+  8021ae:	85 c0                	test   %eax,%eax
+  8021b0:	78 47                	js     8021f9 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8021b2:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8021b6:	41 8b 3e             	mov    (%r14),%edi
+  8021b9:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8021bd:	48 b8 c0 1d 80 00 00 	movabs $0x801dc0,%rax
+  8021c4:	00 00 00 
+  8021c7:	ff d0                	call   *%rax
+  8021c9:	85 c0                	test   %eax,%eax
+  8021cb:	78 30                	js     8021fd <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8021cd:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8021d2:	74 2d                	je     802201 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8021d4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8021d8:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8021dc:	48 85 c0             	test   %rax,%rax
+  8021df:	74 56                	je     802237 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8021e1:	4c 89 ea             	mov    %r13,%rdx
+  8021e4:	4c 89 e6             	mov    %r12,%rsi
+  8021e7:	4c 89 f7             	mov    %r14,%rdi
+  8021ea:	ff d0                	call   *%rax
+}
+  8021ec:	48 83 c4 10          	add    $0x10,%rsp
+  8021f0:	5b                   	pop    %rbx
+  8021f1:	41 5c                	pop    %r12
+  8021f3:	41 5d                	pop    %r13
+  8021f5:	41 5e                	pop    %r14
+  8021f7:	5d                   	pop    %rbp
+  8021f8:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8021f9:	48 98                	cltq
+  8021fb:	eb ef                	jmp    8021ec <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8021fd:	48 98                	cltq
+  8021ff:	eb eb                	jmp    8021ec <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802201:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  802208:	00 00 00 
+  80220b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802211:	89 da                	mov    %ebx,%edx
+  802213:	48 bf 95 54 80 00 00 	movabs $0x805495,%rdi
+  80221a:	00 00 00 
+  80221d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802222:	48 b9 ba 05 80 00 00 	movabs $0x8005ba,%rcx
+  802229:	00 00 00 
+  80222c:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80222e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802235:	eb b5                	jmp    8021ec <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802237:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80223e:	eb ac                	jmp    8021ec <write+0x65>
+
+0000000000802240 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802240:	55                   	push   %rbp
+  802241:	48 89 e5             	mov    %rsp,%rbp
+  802244:	41 54                	push   %r12
+  802246:	53                   	push   %rbx
+  802247:	48 83 ec 10          	sub    $0x10,%rsp
+  80224b:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80224d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802251:	48 b8 75 1d 80 00 00 	movabs $0x801d75,%rax
+  802258:	00 00 00 
+  80225b:	ff d0                	call   *%rax
+  80225d:	85 c0                	test   %eax,%eax
+  80225f:	78 3e                	js     80229f <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802261:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802265:	41 8b 3c 24          	mov    (%r12),%edi
+  802269:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80226d:	48 b8 c0 1d 80 00 00 	movabs $0x801dc0,%rax
+  802274:	00 00 00 
+  802277:	ff d0                	call   *%rax
+  802279:	85 c0                	test   %eax,%eax
+  80227b:	78 22                	js     80229f <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  80227d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802281:	48 8b 40 38          	mov    0x38(%rax),%rax
+  802285:	48 85 c0             	test   %rax,%rax
+  802288:	74 0b                	je     802295 <seek+0x55>
+  80228a:	89 de                	mov    %ebx,%esi
+  80228c:	4c 89 e7             	mov    %r12,%rdi
+  80228f:	ff d0                	call   *%rax
+  802291:	85 c0                	test   %eax,%eax
+  802293:	78 0a                	js     80229f <seek+0x5f>
+
+    fd->fd_offset = offset;
+  802295:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  80229a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80229f:	48 83 c4 10          	add    $0x10,%rsp
+  8022a3:	5b                   	pop    %rbx
+  8022a4:	41 5c                	pop    %r12
+  8022a6:	5d                   	pop    %rbp
+  8022a7:	c3                   	ret
+
+00000000008022a8 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8022a8:	55                   	push   %rbp
+  8022a9:	48 89 e5             	mov    %rsp,%rbp
+  8022ac:	41 55                	push   %r13
+  8022ae:	41 54                	push   %r12
+  8022b0:	53                   	push   %rbx
+  8022b1:	48 83 ec 18          	sub    $0x18,%rsp
+  8022b5:	89 fb                	mov    %edi,%ebx
+  8022b7:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8022ba:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8022be:	48 b8 75 1d 80 00 00 	movabs $0x801d75,%rax
+  8022c5:	00 00 00 
+  8022c8:	ff d0                	call   *%rax
+  8022ca:	85 c0                	test   %eax,%eax
+  8022cc:	78 38                	js     802306 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8022ce:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8022d2:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8022d6:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8022da:	48 b8 c0 1d 80 00 00 	movabs $0x801dc0,%rax
+  8022e1:	00 00 00 
+  8022e4:	ff d0                	call   *%rax
+  8022e6:	85 c0                	test   %eax,%eax
+  8022e8:	78 1c                	js     802306 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8022ea:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8022ef:	74 20                	je     802311 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8022f1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8022f5:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8022f9:	48 85 c0             	test   %rax,%rax
+  8022fc:	74 47                	je     802345 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8022fe:	44 89 e6             	mov    %r12d,%esi
+  802301:	4c 89 ef             	mov    %r13,%rdi
+  802304:	ff d0                	call   *%rax
+}
+  802306:	48 83 c4 18          	add    $0x18,%rsp
+  80230a:	5b                   	pop    %rbx
+  80230b:	41 5c                	pop    %r12
+  80230d:	41 5d                	pop    %r13
+  80230f:	5d                   	pop    %rbp
+  802310:	c3                   	ret
+                thisenv->env_id, fdnum);
+  802311:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  802318:	00 00 00 
+  80231b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802321:	89 da                	mov    %ebx,%edx
+  802323:	48 bf 58 54 80 00 00 	movabs $0x805458,%rdi
+  80232a:	00 00 00 
+  80232d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802332:	48 b9 ba 05 80 00 00 	movabs $0x8005ba,%rcx
+  802339:	00 00 00 
+  80233c:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80233e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802343:	eb c1                	jmp    802306 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802345:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80234a:	eb ba                	jmp    802306 <ftruncate+0x5e>
+
+000000000080234c <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80234c:	55                   	push   %rbp
+  80234d:	48 89 e5             	mov    %rsp,%rbp
+  802350:	41 54                	push   %r12
+  802352:	53                   	push   %rbx
+  802353:	48 83 ec 10          	sub    $0x10,%rsp
+  802357:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80235a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80235e:	48 b8 75 1d 80 00 00 	movabs $0x801d75,%rax
+  802365:	00 00 00 
+  802368:	ff d0                	call   *%rax
+  80236a:	85 c0                	test   %eax,%eax
+  80236c:	78 4e                	js     8023bc <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80236e:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802372:	41 8b 3c 24          	mov    (%r12),%edi
+  802376:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80237a:	48 b8 c0 1d 80 00 00 	movabs $0x801dc0,%rax
+  802381:	00 00 00 
+  802384:	ff d0                	call   *%rax
+  802386:	85 c0                	test   %eax,%eax
+  802388:	78 32                	js     8023bc <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80238a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80238e:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802393:	74 30                	je     8023c5 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802395:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802398:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80239f:	00 00 00 
+    stat->st_isdir = 0;
+  8023a2:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8023a9:	00 00 00 
+    stat->st_dev = dev;
+  8023ac:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8023b3:	48 89 de             	mov    %rbx,%rsi
+  8023b6:	4c 89 e7             	mov    %r12,%rdi
+  8023b9:	ff 50 28             	call   *0x28(%rax)
+}
+  8023bc:	48 83 c4 10          	add    $0x10,%rsp
+  8023c0:	5b                   	pop    %rbx
+  8023c1:	41 5c                	pop    %r12
+  8023c3:	5d                   	pop    %rbp
+  8023c4:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8023c5:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8023ca:	eb f0                	jmp    8023bc <fstat+0x70>
+
+00000000008023cc <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8023cc:	55                   	push   %rbp
+  8023cd:	48 89 e5             	mov    %rsp,%rbp
+  8023d0:	41 54                	push   %r12
+  8023d2:	53                   	push   %rbx
+  8023d3:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8023d6:	be 00 00 00 00       	mov    $0x0,%esi
+  8023db:	48 b8 3a 35 80 00 00 	movabs $0x80353a,%rax
+  8023e2:	00 00 00 
+  8023e5:	ff d0                	call   *%rax
+  8023e7:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8023e9:	85 c0                	test   %eax,%eax
+  8023eb:	78 25                	js     802412 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8023ed:	4c 89 e6             	mov    %r12,%rsi
+  8023f0:	89 c7                	mov    %eax,%edi
+  8023f2:	48 b8 4c 23 80 00 00 	movabs $0x80234c,%rax
+  8023f9:	00 00 00 
+  8023fc:	ff d0                	call   *%rax
+  8023fe:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802401:	89 df                	mov    %ebx,%edi
+  802403:	48 b8 da 1e 80 00 00 	movabs $0x801eda,%rax
+  80240a:	00 00 00 
+  80240d:	ff d0                	call   *%rax
+
+    return res;
+  80240f:	44 89 e3             	mov    %r12d,%ebx
+}
+  802412:	89 d8                	mov    %ebx,%eax
+  802414:	5b                   	pop    %rbx
+  802415:	41 5c                	pop    %r12
+  802417:	5d                   	pop    %rbp
+  802418:	c3                   	ret
+
+0000000000802419 <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  802419:	48 b8 08 00 82 00 00 	movabs $0x820008,%rax
+  802420:	00 00 00 
+  802423:	83 38 00             	cmpl   $0x0,(%rax)
+  802426:	74 0a                	je     802432 <fsenv+0x19>
+    return envid;
+}
+  802428:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  80242f:	00 00 
+  802431:	c3                   	ret
+fsenv(void) {
+  802432:	55                   	push   %rbp
+  802433:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  802436:	bf 03 00 00 00       	mov    $0x3,%edi
+  80243b:	48 b8 80 4d 80 00 00 	movabs $0x804d80,%rax
+  802442:	00 00 00 
+  802445:	ff d0                	call   *%rax
+  802447:	a3 08 00 82 00 00 00 	movabs %eax,0x820008
+  80244e:	00 00 
+}
+  802450:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  802457:	00 00 
+  802459:	5d                   	pop    %rbp
+  80245a:	c3                   	ret
+
+000000000080245b <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  80245b:	55                   	push   %rbp
+  80245c:	48 89 e5             	mov    %rsp,%rbp
+  80245f:	41 54                	push   %r12
+  802461:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  802462:	ba 00 50 00 00       	mov    $0x5000,%edx
+  802467:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  80246c:	48 89 de             	mov    %rbx,%rsi
+  80246f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802474:	48 b8 5a 19 80 00 00 	movabs $0x80195a,%rax
+  80247b:	00 00 00 
+  80247e:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  802480:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  802487:	00 00 00 
+  80248a:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  802490:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802495:	ba 00 50 00 00       	mov    $0x5000,%edx
+  80249a:	48 89 de             	mov    %rbx,%rsi
+  80249d:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024a2:	48 b8 b4 18 80 00 00 	movabs $0x8018b4,%rax
+  8024a9:	00 00 00 
+  8024ac:	ff d0                	call   *%rax
+  8024ae:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  8024b0:	85 c0                	test   %eax,%eax
+  8024b2:	0f 88 a2 00 00 00    	js     80255a <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  8024b8:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8024bf:	00 00 00 
+  8024c2:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8024c8:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  8024cd:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  8024cf:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  8024d4:	49 bc 10 48 80 00 00 	movabs $0x804810,%r12
+  8024db:	00 00 00 
+  8024de:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  8024e1:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  8024e6:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  8024e9:	48 b8 19 24 80 00 00 	movabs $0x802419,%rax
+  8024f0:	00 00 00 
+  8024f3:	ff d0                	call   *%rax
+  8024f5:	89 c7                	mov    %eax,%edi
+  8024f7:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  8024fd:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  802502:	48 89 da             	mov    %rbx,%rdx
+  802505:	be 09 00 00 00       	mov    $0x9,%esi
+  80250a:	48 b8 2a 4d 80 00 00 	movabs $0x804d2a,%rax
+  802511:	00 00 00 
+  802514:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  802516:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80251b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802520:	be 00 00 00 00       	mov    $0x0,%esi
+  802525:	bf 00 00 00 00       	mov    $0x0,%edi
+  80252a:	48 b8 06 4d 80 00 00 	movabs $0x804d06,%rax
+  802531:	00 00 00 
+  802534:	ff d0                	call   *%rax
+  802536:	89 c3                	mov    %eax,%ebx
+  802538:	85 c0                	test   %eax,%eax
+  80253a:	78 25                	js     802561 <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  80253c:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  802543:	00 00 00 
+  802546:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80254c:	a3 00 26 82 00 00 00 	movabs %eax,0x822600
+  802553:	00 00 
+    return 0;
+  802555:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  80255a:	89 d8                	mov    %ebx,%eax
+  80255c:	5b                   	pop    %rbx
+  80255d:	41 5c                	pop    %r12
+  80255f:	5d                   	pop    %rbp
+  802560:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  802561:	ba 00 50 00 00       	mov    $0x5000,%edx
+  802566:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  80256b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802570:	48 b8 5a 19 80 00 00 	movabs $0x80195a,%rax
+  802577:	00 00 00 
+  80257a:	ff d0                	call   *%rax
+        return res;
+  80257c:	eb dc                	jmp    80255a <fschan_setup+0xff>
+
+000000000080257e <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  80257e:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  802585:	00 00 00 
+  802588:	80 38 00             	cmpb   $0x0,(%rax)
+  80258b:	74 55                	je     8025e2 <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  80258d:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  802594:	00 00 00 
+  802597:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  80259d:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  8025a2:	48 ba 00 26 82 00 00 	movabs $0x822600,%rdx
+  8025a9:	00 00 00 
+  8025ac:	3b 0a                	cmp    (%rdx),%ecx
+  8025ae:	75 01                	jne    8025b1 <fschan+0x33>
+}
+  8025b0:	c3                   	ret
+fschan(void) {
+  8025b1:	55                   	push   %rbp
+  8025b2:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  8025b5:	48 b8 5b 24 80 00 00 	movabs $0x80245b,%rax
+  8025bc:	00 00 00 
+  8025bf:	ff d0                	call   *%rax
+  8025c1:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  8025c3:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  8025c8:	85 d2                	test   %edx,%edx
+  8025ca:	78 02                	js     8025ce <fschan+0x50>
+}
+  8025cc:	5d                   	pop    %rbp
+  8025cd:	c3                   	ret
+        fschan_enabled = 0;
+  8025ce:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  8025d5:	00 00 00 
+  8025d8:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  8025db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025e0:	eb ea                	jmp    8025cc <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  8025e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025e7:	c3                   	ret
+
+00000000008025e8 <fbuf>:
+fbuf(struct Fd *fd) {
+  8025e8:	55                   	push   %rbp
+  8025e9:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  8025ec:	48 b8 e7 1c 80 00 00 	movabs $0x801ce7,%rax
+  8025f3:	00 00 00 
+  8025f6:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  8025f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025fd:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802601:	77 12                	ja     802615 <fbuf+0x2d>
+  802603:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  802607:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  80260e:	00 00 00 
+  802611:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  802615:	48 89 d0             	mov    %rdx,%rax
+  802618:	5d                   	pop    %rbp
+  802619:	c3                   	ret
+
+000000000080261a <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  80261a:	55                   	push   %rbp
+  80261b:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  80261e:	48 83 c7 40          	add    $0x40,%rdi
+  802622:	48 b8 4a 48 80 00 00 	movabs $0x80484a,%rax
+  802629:	00 00 00 
+  80262c:	ff d0                	call   *%rax
+  80262e:	84 c0                	test   %al,%al
+  802630:	75 02                	jne    802634 <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  802632:	5d                   	pop    %rbp
+  802633:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  802634:	48 b8 19 24 80 00 00 	movabs $0x802419,%rax
+  80263b:	00 00 00 
+  80263e:	ff d0                	call   *%rax
+  802640:	89 c7                	mov    %eax,%edi
+  802642:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802648:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80264d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802652:	be 0a 00 00 00       	mov    $0xa,%esi
+  802657:	48 b8 2a 4d 80 00 00 	movabs $0x804d2a,%rax
+  80265e:	00 00 00 
+  802661:	ff d0                	call   *%rax
+}
+  802663:	eb cd                	jmp    802632 <fschan_publish+0x18>
+
+0000000000802665 <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  802665:	55                   	push   %rbp
+  802666:	48 89 e5             	mov    %rsp,%rbp
+  802669:	41 57                	push   %r15
+  80266b:	41 56                	push   %r14
+  80266d:	41 55                	push   %r13
+  80266f:	41 54                	push   %r12
+  802671:	53                   	push   %rbx
+  802672:	48 83 ec 48          	sub    $0x48,%rsp
+  802676:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80267a:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  80267e:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  802681:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  802685:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  802688:	48 ba 04 00 82 00 00 	movabs $0x820004,%rdx
+  80268f:	00 00 00 
+  802692:	8b 02                	mov    (%rdx),%eax
+  802694:	83 c0 01             	add    $0x1,%eax
+  802697:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80269c:	0f 44 c1             	cmove  %ecx,%eax
+  80269f:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  8026a1:	4d 85 c0             	test   %r8,%r8
+  8026a4:	74 2c                	je     8026d2 <fschan_rw+0x6d>
+  8026a6:	45 89 ce             	mov    %r9d,%r14d
+  8026a9:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  8026b0:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  8026b4:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8026ba:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  8026c1:	00 
+  8026c2:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8026c8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8026cd:	e9 41 01 00 00       	jmp    802813 <fschan_rw+0x1ae>
+  8026d2:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  8026d6:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8026da:	e9 9c 01 00 00       	jmp    80287b <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  8026df:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8026e3:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  8026e6:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  8026e9:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  8026ec:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  8026f0:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8026f4:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  8026f8:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  8026fc:	48 89 da             	mov    %rbx,%rdx
+  8026ff:	48 b8 40 11 80 00 00 	movabs $0x801140,%rax
+  802706:	00 00 00 
+  802709:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  80270b:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80270f:	48 b8 1a 26 80 00 00 	movabs $0x80261a,%rax
+  802716:	00 00 00 
+  802719:	ff d0                	call   *%rax
+            queued += blk;
+  80271b:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  80271e:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  802722:	4d 39 fc             	cmp    %r15,%r12
+  802725:	73 6b                	jae    802792 <fschan_rw+0x12d>
+  802727:	41 83 fd 0f          	cmp    $0xf,%r13d
+  80272b:	77 65                	ja     802792 <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  80272d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802731:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  802735:	48 b8 25 48 80 00 00 	movabs $0x804825,%rax
+  80273c:	00 00 00 
+  80273f:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  802741:	4c 89 fb             	mov    %r15,%rbx
+  802744:	4c 29 e3             	sub    %r12,%rbx
+  802747:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  80274c:	48 39 d3             	cmp    %rdx,%rbx
+  80274f:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  802753:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  802757:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  80275b:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  80275f:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  802762:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  802764:	48 b9 04 00 82 00 00 	movabs $0x820004,%rcx
+  80276b:	00 00 00 
+  80276e:	8b 09                	mov    (%rcx),%ecx
+  802770:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  802773:	83 fe 03             	cmp    $0x3,%esi
+  802776:	0f 85 63 ff ff ff    	jne    8026df <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  80277c:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802780:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  802783:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  802786:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  802789:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  80278d:	e9 79 ff ff ff       	jmp    80270b <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  802792:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802796:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  80279d:	48 89 df             	mov    %rbx,%rdi
+  8027a0:	48 b8 e8 48 80 00 00 	movabs $0x8048e8,%rax
+  8027a7:	00 00 00 
+  8027aa:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  8027ac:	48 89 df             	mov    %rbx,%rdi
+  8027af:	48 b8 76 48 80 00 00 	movabs $0x804876,%rax
+  8027b6:	00 00 00 
+  8027b9:	ff d0                	call   *%rax
+  8027bb:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  8027bf:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  8027c3:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  8027c7:	75 25                	jne    8027ee <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  8027c9:	8b 40 04             	mov    0x4(%rax),%eax
+  8027cc:	85 c0                	test   %eax,%eax
+  8027ce:	0f 88 86 00 00 00    	js     80285a <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  8027d4:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  8027d8:	74 5b                	je     802835 <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  8027da:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8027de:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  8027e2:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  8027e6:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  8027ea:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  8027ee:	48 89 df             	mov    %rbx,%rdi
+  8027f1:	48 b8 9d 48 80 00 00 	movabs $0x80489d,%rax
+  8027f8:	00 00 00 
+  8027fb:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  8027fd:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  802801:	83 f0 01             	xor    $0x1,%eax
+  802804:	4d 39 fc             	cmp    %r15,%r12
+  802807:	0f 92 c2             	setb   %dl
+  80280a:	84 c2                	test   %al,%dl
+  80280c:	75 05                	jne    802813 <fschan_rw+0x1ae>
+  80280e:	45 85 ed             	test   %r13d,%r13d
+  802811:	74 50                	je     802863 <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  802813:	4d 39 fc             	cmp    %r15,%r12
+  802816:	0f 92 c1             	setb   %cl
+  802819:	41 83 fd 0f          	cmp    $0xf,%r13d
+  80281d:	0f 96 c2             	setbe  %dl
+  802820:	84 d1                	test   %dl,%cl
+  802822:	0f 84 6a ff ff ff    	je     802792 <fschan_rw+0x12d>
+  802828:	84 c0                	test   %al,%al
+  80282a:	0f 85 fd fe ff ff    	jne    80272d <fschan_rw+0xc8>
+  802830:	e9 5d ff ff ff       	jmp    802792 <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  802835:	48 63 d0             	movslq %eax,%rdx
+  802838:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80283c:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  802840:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802844:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  802848:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  80284c:	48 b8 40 11 80 00 00 	movabs $0x801140,%rax
+  802853:	00 00 00 
+  802856:	ff d0                	call   *%rax
+  802858:	eb 80                	jmp    8027da <fschan_rw+0x175>
+                err = msg->fm_res;
+  80285a:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  80285d:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  802861:	eb 8b                	jmp    8027ee <fschan_rw+0x189>
+    return done || !err ? done : err;
+  802863:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  802868:	0f 85 68 fe ff ff    	jne    8026d6 <fschan_rw+0x71>
+  80286e:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  802871:	85 c0                	test   %eax,%eax
+  802873:	0f 84 5d fe ff ff    	je     8026d6 <fschan_rw+0x71>
+  802879:	48 98                	cltq
+}
+  80287b:	48 83 c4 48          	add    $0x48,%rsp
+  80287f:	5b                   	pop    %rbx
+  802880:	41 5c                	pop    %r12
+  802882:	41 5d                	pop    %r13
+  802884:	41 5e                	pop    %r14
+  802886:	41 5f                	pop    %r15
+  802888:	5d                   	pop    %rbp
+  802889:	c3                   	ret
+
+000000000080288a <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  80288a:	55                   	push   %rbp
+  80288b:	48 89 e5             	mov    %rsp,%rbp
+  80288e:	41 56                	push   %r14
+  802890:	41 55                	push   %r13
+  802892:	41 54                	push   %r12
+  802894:	53                   	push   %rbx
+  802895:	48 83 ec 10          	sub    $0x10,%rsp
+  802899:	49 89 fe             	mov    %rdi,%r14
+  80289c:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  80289f:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  8028a3:	48 29 f3             	sub    %rsi,%rbx
+  8028a6:	48 39 d3             	cmp    %rdx,%rbx
+  8028a9:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  8028ad:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8028b4:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  8028b5:	bf 00 10 00 00       	mov    $0x1000,%edi
+  8028ba:	49 bd a7 46 80 00 00 	movabs $0x8046a7,%r13
+  8028c1:	00 00 00 
+  8028c4:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  8028cb:	76 1e                	jbe    8028eb <mmap_fault+0x61>
+  8028cd:	4c 01 e7             	add    %r12,%rdi
+  8028d0:	41 ff d5             	call   *%r13
+  8028d3:	84 c0                	test   %al,%al
+  8028d5:	75 14                	jne    8028eb <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  8028d7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8028db:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  8028e2:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  8028e6:	48 39 df             	cmp    %rbx,%rdi
+  8028e9:	72 e2                	jb     8028cd <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  8028eb:	48 bb 00 10 82 00 00 	movabs $0x821000,%rbx
+  8028f2:	00 00 00 
+  8028f5:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  8028fc:	00 00 00 
+  8028ff:	4c 89 f0             	mov    %r14,%rax
+  802902:	48 29 d0             	sub    %rdx,%rax
+  802905:	48 c1 f8 03          	sar    $0x3,%rax
+  802909:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  802910:	aa aa aa 
+  802913:	48 0f af c2          	imul   %rdx,%rax
+  802917:	48 c1 e0 0c          	shl    $0xc,%rax
+  80291b:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  802920:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  802924:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  802926:	44 89 e0             	mov    %r12d,%eax
+  802929:	41 03 46 10          	add    0x10(%r14),%eax
+  80292d:	41 2b 06             	sub    (%r14),%eax
+  802930:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  802933:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802937:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  80293b:	41 8b 46 14          	mov    0x14(%r14),%eax
+  80293f:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  802942:	48 b8 19 24 80 00 00 	movabs $0x802419,%rax
+  802949:	00 00 00 
+  80294c:	ff d0                	call   *%rax
+  80294e:	89 c7                	mov    %eax,%edi
+  802950:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802956:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80295b:	48 89 da             	mov    %rbx,%rdx
+  80295e:	be 0f 00 00 00       	mov    $0xf,%esi
+  802963:	48 b8 2a 4d 80 00 00 	movabs $0x804d2a,%rax
+  80296a:	00 00 00 
+  80296d:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  80296f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802974:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802978:	4c 89 e6             	mov    %r12,%rsi
+  80297b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802980:	48 b8 06 4d 80 00 00 	movabs $0x804d06,%rax
+  802987:	00 00 00 
+  80298a:	ff d0                	call   *%rax
+  80298c:	48 98                	cltq
+}
+  80298e:	48 83 c4 10          	add    $0x10,%rsp
+  802992:	5b                   	pop    %rbx
+  802993:	41 5c                	pop    %r12
+  802995:	41 5d                	pop    %r13
+  802997:	41 5e                	pop    %r14
+  802999:	5d                   	pop    %rbp
+  80299a:	c3                   	ret
+
+000000000080299b <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  80299b:	48 8b 37             	mov    (%rdi),%rsi
+  80299e:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  8029a5:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  8029ac:	00 00 00 
+  8029af:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8029b4:	eb 0f                	jmp    8029c5 <mmap_pgfault+0x2a>
+  8029b6:	c3                   	ret
+  8029b7:	48 83 c1 01          	add    $0x1,%rcx
+  8029bb:	48 83 c2 18          	add    $0x18,%rdx
+  8029bf:	48 83 f9 20          	cmp    $0x20,%rcx
+  8029c3:	74 6e                	je     802a33 <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  8029c5:	48 8b 02             	mov    (%rdx),%rax
+  8029c8:	48 83 e8 01          	sub    $0x1,%rax
+  8029cc:	48 39 f0             	cmp    %rsi,%rax
+  8029cf:	73 e6                	jae    8029b7 <mmap_pgfault+0x1c>
+  8029d1:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  8029d5:	73 e0                	jae    8029b7 <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  8029d7:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  8029db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029e0:	f6 c2 01             	test   $0x1,%dl
+  8029e3:	75 d1                	jne    8029b6 <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  8029e5:	f6 c2 02             	test   $0x2,%dl
+  8029e8:	74 1a                	je     802a04 <mmap_pgfault+0x69>
+  8029ea:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  8029ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029f3:	48 bf 00 20 82 00 00 	movabs $0x822000,%rdi
+  8029fa:	00 00 00 
+  8029fd:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  802a02:	74 35                	je     802a39 <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  802a04:	55                   	push   %rbp
+  802a05:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  802a08:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  802a0c:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  802a13:	00 00 00 
+  802a16:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  802a1a:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802a1f:	48 b8 8a 28 80 00 00 	movabs $0x80288a,%rax
+  802a26:	00 00 00 
+  802a29:	ff d0                	call   *%rax
+  802a2b:	48 85 c0             	test   %rax,%rax
+  802a2e:	0f 9f c0             	setg   %al
+}
+  802a31:	5d                   	pop    %rbp
+  802a32:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  802a33:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a38:	c3                   	ret
+}
+  802a39:	c3                   	ret
+
+0000000000802a3a <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  802a3a:	55                   	push   %rbp
+  802a3b:	48 89 e5             	mov    %rsp,%rbp
+  802a3e:	41 54                	push   %r12
+  802a40:	53                   	push   %rbx
+  802a41:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802a44:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  802a4b:	00 00 00 
+  802a4e:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  802a53:	48 83 38 00          	cmpq   $0x0,(%rax)
+  802a57:	74 15                	je     802a6e <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802a59:	48 83 c3 01          	add    $0x1,%rbx
+  802a5d:	48 83 c0 18          	add    $0x18,%rax
+  802a61:	48 83 fb 20          	cmp    $0x20,%rbx
+  802a65:	75 ec                	jne    802a53 <mmap_alloc+0x19>
+    return NULL;
+  802a67:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a6c:	eb 52                	jmp    802ac0 <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  802a6e:	4c 89 e7             	mov    %r12,%rdi
+  802a71:	48 b8 48 46 80 00 00 	movabs $0x804648,%rax
+  802a78:	00 00 00 
+  802a7b:	ff d0                	call   *%rax
+  802a7d:	41 89 c1             	mov    %eax,%r9d
+  802a80:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  802a87:	48 c1 e1 0c          	shl    $0xc,%rcx
+  802a8b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802a91:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a96:	4c 89 e6             	mov    %r12,%rsi
+  802a99:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a9e:	48 b8 0a 19 80 00 00 	movabs $0x80190a,%rax
+  802aa5:	00 00 00 
+  802aa8:	ff d0                	call   *%rax
+  802aaa:	85 c0                	test   %eax,%eax
+  802aac:	78 17                	js     802ac5 <mmap_alloc+0x8b>
+        return &mmaps[i];
+  802aae:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  802ab2:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  802ab9:	00 00 00 
+  802abc:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  802ac0:	5b                   	pop    %rbx
+  802ac1:	41 5c                	pop    %r12
+  802ac3:	5d                   	pop    %rbp
+  802ac4:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  802ac5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aca:	eb f4                	jmp    802ac0 <mmap_alloc+0x86>
+
+0000000000802acc <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  802acc:	55                   	push   %rbp
+  802acd:	48 89 e5             	mov    %rsp,%rbp
+  802ad0:	41 56                	push   %r14
+  802ad2:	41 55                	push   %r13
+  802ad4:	41 54                	push   %r12
+  802ad6:	53                   	push   %rbx
+  802ad7:	48 83 ec 10          	sub    $0x10,%rsp
+  802adb:	41 89 fc             	mov    %edi,%r12d
+  802ade:	49 89 f5             	mov    %rsi,%r13
+  802ae1:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  802ae4:	48 89 f0             	mov    %rsi,%rax
+  802ae7:	48 09 d0             	or     %rdx,%rax
+  802aea:	75 0d                	jne    802af9 <fsipc+0x2d>
+  802aec:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  802aef:	83 f8 04             	cmp    $0x4,%eax
+  802af2:	76 7d                	jbe    802b71 <fsipc+0xa5>
+  802af4:	83 ff 0d             	cmp    $0xd,%edi
+  802af7:	74 78                	je     802b71 <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  802af9:	48 b8 19 24 80 00 00 	movabs $0x802419,%rax
+  802b00:	00 00 00 
+  802b03:	ff d0                	call   *%rax
+  802b05:	89 c7                	mov    %eax,%edi
+  802b07:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  802b0e:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  802b15:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  802b1c:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802b22:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802b29:	00 00 00 
+  802b2c:	44 89 e6             	mov    %r12d,%esi
+  802b2f:	48 b8 2a 4d 80 00 00 	movabs $0x804d2a,%rax
+  802b36:	00 00 00 
+  802b39:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  802b3b:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  802b42:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  802b43:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802b48:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802b4c:	4c 89 ee             	mov    %r13,%rsi
+  802b4f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b54:	48 b8 06 4d 80 00 00 	movabs $0x804d06,%rax
+  802b5b:	00 00 00 
+  802b5e:	ff d0                	call   *%rax
+  802b60:	89 c3                	mov    %eax,%ebx
+}
+  802b62:	89 d8                	mov    %ebx,%eax
+  802b64:	48 83 c4 10          	add    $0x10,%rsp
+  802b68:	5b                   	pop    %rbx
+  802b69:	41 5c                	pop    %r12
+  802b6b:	41 5d                	pop    %r13
+  802b6d:	41 5e                	pop    %r14
+  802b6f:	5d                   	pop    %rbp
+  802b70:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  802b71:	48 b8 7e 25 80 00 00 	movabs $0x80257e,%rax
+  802b78:	00 00 00 
+  802b7b:	ff d0                	call   *%rax
+  802b7d:	49 89 c6             	mov    %rax,%r14
+  802b80:	48 85 c0             	test   %rax,%rax
+  802b83:	0f 84 70 ff ff ff    	je     802af9 <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  802b89:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  802b8d:	48 b8 25 48 80 00 00 	movabs $0x804825,%rax
+  802b94:	00 00 00 
+  802b97:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  802b99:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  802b9c:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  802ba3:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  802ba7:	ba 10 00 00 00       	mov    $0x10,%edx
+  802bac:	48 be 00 00 83 00 00 	movabs $0x830000,%rsi
+  802bb3:	00 00 00 
+  802bb6:	48 b8 40 11 80 00 00 	movabs $0x801140,%rax
+  802bbd:	00 00 00 
+  802bc0:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  802bc2:	4c 89 f7             	mov    %r14,%rdi
+  802bc5:	48 b8 1a 26 80 00 00 	movabs $0x80261a,%rax
+  802bcc:	00 00 00 
+  802bcf:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  802bd1:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  802bd8:	4c 89 f7             	mov    %r14,%rdi
+  802bdb:	48 b8 e8 48 80 00 00 	movabs $0x8048e8,%rax
+  802be2:	00 00 00 
+  802be5:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  802be7:	4c 89 f7             	mov    %r14,%rdi
+  802bea:	48 b8 76 48 80 00 00 	movabs $0x804876,%rax
+  802bf1:	00 00 00 
+  802bf4:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  802bf6:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  802bf9:	41 83 fc 05          	cmp    $0x5,%r12d
+  802bfd:	75 04                	jne    802c03 <fsipc+0x137>
+  802bff:	85 db                	test   %ebx,%ebx
+  802c01:	79 14                	jns    802c17 <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  802c03:	4c 89 f7             	mov    %r14,%rdi
+  802c06:	48 b8 9d 48 80 00 00 	movabs $0x80489d,%rax
+  802c0d:	00 00 00 
+  802c10:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  802c12:	e9 4b ff ff ff       	jmp    802b62 <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  802c17:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  802c1b:	ba 88 00 00 00       	mov    $0x88,%edx
+  802c20:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  802c27:	00 00 00 
+  802c2a:	48 b8 40 11 80 00 00 	movabs $0x801140,%rax
+  802c31:	00 00 00 
+  802c34:	ff d0                	call   *%rax
+  802c36:	eb cb                	jmp    802c03 <fsipc+0x137>
+
+0000000000802c38 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  802c38:	55                   	push   %rbp
+  802c39:	48 89 e5             	mov    %rsp,%rbp
+  802c3c:	41 57                	push   %r15
+  802c3e:	41 56                	push   %r14
+  802c40:	41 55                	push   %r13
+  802c42:	41 54                	push   %r12
+  802c44:	53                   	push   %rbx
+  802c45:	48 83 ec 18          	sub    $0x18,%rsp
+  802c49:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  802c4d:	49 89 f6             	mov    %rsi,%r14
+  802c50:	49 89 d4             	mov    %rdx,%r12
+  802c53:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  802c56:	48 b8 7e 25 80 00 00 	movabs $0x80257e,%rax
+  802c5d:	00 00 00 
+  802c60:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  802c62:	48 85 c0             	test   %rax,%rax
+  802c65:	0f 85 96 00 00 00    	jne    802d01 <devfile_write_direct+0xc9>
+    size_t write = 0;
+  802c6b:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802c72:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802c73:	49 bf 00 00 83 00 00 	movabs $0x830000,%r15
+  802c7a:	00 00 00 
+    while (n) {
+  802c7d:	4d 85 e4             	test   %r12,%r12
+  802c80:	74 79                	je     802cfb <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802c82:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  802c87:	49 39 dc             	cmp    %rbx,%r12
+  802c8a:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  802c8e:	48 89 da             	mov    %rbx,%rdx
+  802c91:	4c 89 f6             	mov    %r14,%rsi
+  802c94:	48 bf 00 10 83 00 00 	movabs $0x831000,%rdi
+  802c9b:	00 00 00 
+  802c9e:	48 b8 40 11 80 00 00 	movabs $0x801140,%rax
+  802ca5:	00 00 00 
+  802ca8:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802caa:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802cae:	8b 40 0c             	mov    0xc(%rax),%eax
+  802cb1:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  802cb4:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802cb7:	44 01 e8             	add    %r13d,%eax
+  802cba:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  802cbe:	41 0f 44 c5          	cmove  %r13d,%eax
+  802cc2:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  802cc6:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  802cca:	48 89 da             	mov    %rbx,%rdx
+  802ccd:	be 00 00 00 00       	mov    $0x0,%esi
+  802cd2:	bf 04 00 00 00       	mov    $0x4,%edi
+  802cd7:	48 b8 cc 2a 80 00 00 	movabs $0x802acc,%rax
+  802cde:	00 00 00 
+  802ce1:	ff d0                	call   *%rax
+        if (res < 0)
+  802ce3:	85 c0                	test   %eax,%eax
+  802ce5:	78 4a                	js     802d31 <devfile_write_direct+0xf9>
+        buf += res;
+  802ce7:	48 98                	cltq
+  802ce9:	49 01 c6             	add    %rax,%r14
+        write += res;
+  802cec:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  802cf0:	49 29 c4             	sub    %rax,%r12
+  802cf3:	75 8d                	jne    802c82 <devfile_write_direct+0x4a>
+    return write;
+  802cf5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802cf9:	eb 27                	jmp    802d22 <devfile_write_direct+0xea>
+    size_t write = 0;
+  802cfb:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  802cff:	eb f4                	jmp    802cf5 <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  802d01:	45 89 e9             	mov    %r13d,%r9d
+  802d04:	4d 89 e0             	mov    %r12,%r8
+  802d07:	4c 89 f1             	mov    %r14,%rcx
+  802d0a:	ba 04 00 00 00       	mov    $0x4,%edx
+  802d0f:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802d13:	48 89 c7             	mov    %rax,%rdi
+  802d16:	48 b8 65 26 80 00 00 	movabs $0x802665,%rax
+  802d1d:	00 00 00 
+  802d20:	ff d0                	call   *%rax
+}
+  802d22:	48 83 c4 18          	add    $0x18,%rsp
+  802d26:	5b                   	pop    %rbx
+  802d27:	41 5c                	pop    %r12
+  802d29:	41 5d                	pop    %r13
+  802d2b:	41 5e                	pop    %r14
+  802d2d:	41 5f                	pop    %r15
+  802d2f:	5d                   	pop    %rbp
+  802d30:	c3                   	ret
+            return res;
+  802d31:	48 98                	cltq
+  802d33:	eb ed                	jmp    802d22 <devfile_write_direct+0xea>
+
+0000000000802d35 <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  802d35:	55                   	push   %rbp
+  802d36:	48 89 e5             	mov    %rsp,%rbp
+  802d39:	41 54                	push   %r12
+  802d3b:	53                   	push   %rbx
+  802d3c:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  802d3f:	48 b8 e8 25 80 00 00 	movabs $0x8025e8,%rax
+  802d46:	00 00 00 
+  802d49:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  802d4b:	48 85 c0             	test   %rax,%rax
+  802d4e:	74 71                	je     802dc1 <fbuf_flush+0x8c>
+  802d50:	48 89 c3             	mov    %rax,%rbx
+  802d53:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d58:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  802d5c:	75 05                	jne    802d63 <fbuf_flush+0x2e>
+}
+  802d5e:	5b                   	pop    %rbx
+  802d5f:	41 5c                	pop    %r12
+  802d61:	5d                   	pop    %rbp
+  802d62:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  802d63:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  802d66:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  802d6a:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802d71:	00 00 00 
+  802d74:	48 89 de             	mov    %rbx,%rsi
+  802d77:	48 29 c6             	sub    %rax,%rsi
+  802d7a:	48 c1 fe 03          	sar    $0x3,%rsi
+  802d7e:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802d85:	aa aa aa 
+  802d88:	48 0f af f0          	imul   %rax,%rsi
+  802d8c:	48 c1 e6 0e          	shl    $0xe,%rsi
+  802d90:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802d95:	48 01 c6             	add    %rax,%rsi
+  802d98:	4c 89 e7             	mov    %r12,%rdi
+  802d9b:	48 b8 38 2c 80 00 00 	movabs $0x802c38,%rax
+  802da2:	00 00 00 
+  802da5:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  802da7:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  802dab:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802db2:	00 
+    return res < 0 ? res : 0;
+  802db3:	48 85 c0             	test   %rax,%rax
+  802db6:	ba 00 00 00 00       	mov    $0x0,%edx
+  802dbb:	48 0f 4f c2          	cmovg  %rdx,%rax
+  802dbf:	eb 9d                	jmp    802d5e <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  802dc1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dc6:	eb 96                	jmp    802d5e <fbuf_flush+0x29>
+
+0000000000802dc8 <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  802dc8:	55                   	push   %rbp
+  802dc9:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  802dcc:	48 b8 35 2d 80 00 00 	movabs $0x802d35,%rax
+  802dd3:	00 00 00 
+  802dd6:	ff d0                	call   *%rax
+}
+  802dd8:	5d                   	pop    %rbp
+  802dd9:	c3                   	ret
+
+0000000000802dda <devfile_write>:
+    if (!fd || !buf)
+  802dda:	48 85 ff             	test   %rdi,%rdi
+  802ddd:	0f 84 d3 01 00 00    	je     802fb6 <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802de3:	55                   	push   %rbp
+  802de4:	48 89 e5             	mov    %rsp,%rbp
+  802de7:	41 57                	push   %r15
+  802de9:	41 56                	push   %r14
+  802deb:	41 55                	push   %r13
+  802ded:	41 54                	push   %r12
+  802def:	53                   	push   %rbx
+  802df0:	48 83 ec 08          	sub    $0x8,%rsp
+  802df4:	49 89 fc             	mov    %rdi,%r12
+  802df7:	49 89 f6             	mov    %rsi,%r14
+  802dfa:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  802dfd:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802e02:	48 85 f6             	test   %rsi,%rsi
+  802e05:	0f 84 9c 01 00 00    	je     802fa7 <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  802e0b:	48 b8 e8 25 80 00 00 	movabs $0x8025e8,%rax
+  802e12:	00 00 00 
+  802e15:	ff d0                	call   *%rax
+  802e17:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  802e1a:	48 85 c0             	test   %rax,%rax
+  802e1d:	0f 84 a2 00 00 00    	je     802ec5 <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802e23:	be 00 10 00 00       	mov    $0x1000,%esi
+  802e28:	4c 89 e7             	mov    %r12,%rdi
+  802e2b:	48 b8 79 18 80 00 00 	movabs $0x801879,%rax
+  802e32:	00 00 00 
+  802e35:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  802e37:	83 f8 02             	cmp    $0x2,%eax
+  802e3a:	0f 8f 85 00 00 00    	jg     802ec5 <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  802e40:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802e47:	00 00 00 
+  802e4a:	4d 89 ef             	mov    %r13,%r15
+  802e4d:	49 29 c7             	sub    %rax,%r15
+  802e50:	49 c1 ff 03          	sar    $0x3,%r15
+  802e54:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802e5b:	aa aa aa 
+  802e5e:	4c 0f af f8          	imul   %rax,%r15
+  802e62:	49 c1 e7 0e          	shl    $0xe,%r15
+  802e66:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802e6b:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  802e6e:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802e73:	0f 84 d7 00 00 00    	je     802f50 <devfile_write+0x176>
+  802e79:	49 8b 45 10          	mov    0x10(%r13),%rax
+  802e7d:	89 c2                	mov    %eax,%edx
+  802e7f:	41 03 55 0c          	add    0xc(%r13),%edx
+  802e83:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  802e88:	75 0f                	jne    802e99 <devfile_write+0xbf>
+  802e8a:	48 01 d8             	add    %rbx,%rax
+  802e8d:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  802e93:	0f 86 92 00 00 00    	jbe    802f2b <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802e99:	4c 89 e7             	mov    %r12,%rdi
+  802e9c:	48 b8 35 2d 80 00 00 	movabs $0x802d35,%rax
+  802ea3:	00 00 00 
+  802ea6:	ff d0                	call   *%rax
+  802ea8:	85 c0                	test   %eax,%eax
+  802eaa:	78 52                	js     802efe <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802eac:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802eb3:	77 7f                	ja     802f34 <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  802eb5:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802eba:	0f 85 c2 00 00 00    	jne    802f82 <devfile_write+0x1a8>
+  802ec0:	e9 94 00 00 00       	jmp    802f59 <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  802ec5:	4c 89 e7             	mov    %r12,%rdi
+  802ec8:	48 b8 35 2d 80 00 00 	movabs $0x802d35,%rax
+  802ecf:	00 00 00 
+  802ed2:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802ed4:	85 c0                	test   %eax,%eax
+  802ed6:	79 07                	jns    802edf <devfile_write+0x105>
+  802ed8:	48 98                	cltq
+  802eda:	e9 c8 00 00 00       	jmp    802fa7 <devfile_write+0x1cd>
+  802edf:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802ee4:	48 89 da             	mov    %rbx,%rdx
+  802ee7:	4c 89 f6             	mov    %r14,%rsi
+  802eea:	4c 89 e7             	mov    %r12,%rdi
+  802eed:	48 b8 38 2c 80 00 00 	movabs $0x802c38,%rax
+  802ef4:	00 00 00 
+  802ef7:	ff d0                	call   *%rax
+  802ef9:	e9 a9 00 00 00       	jmp    802fa7 <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802efe:	48 98                	cltq
+  802f00:	e9 a2 00 00 00       	jmp    802fa7 <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802f05:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802f0a:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802f0f:	4c 89 fe             	mov    %r15,%rsi
+  802f12:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f17:	48 b8 b4 18 80 00 00 	movabs $0x8018b4,%rax
+  802f1e:	00 00 00 
+  802f21:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  802f23:	85 c0                	test   %eax,%eax
+  802f25:	79 45                	jns    802f6c <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802f27:	48 98                	cltq
+  802f29:	eb 7c                	jmp    802fa7 <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802f2b:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802f32:	76 4e                	jbe    802f82 <devfile_write+0x1a8>
+  802f34:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802f39:	48 89 da             	mov    %rbx,%rdx
+  802f3c:	4c 89 f6             	mov    %r14,%rsi
+  802f3f:	4c 89 e7             	mov    %r12,%rdi
+  802f42:	48 b8 38 2c 80 00 00 	movabs $0x802c38,%rax
+  802f49:	00 00 00 
+  802f4c:	ff d0                	call   *%rax
+  802f4e:	eb 57                	jmp    802fa7 <devfile_write+0x1cd>
+  802f50:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802f57:	77 db                	ja     802f34 <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  802f59:	4c 89 ff             	mov    %r15,%rdi
+  802f5c:	48 b8 a7 46 80 00 00 	movabs $0x8046a7,%rax
+  802f63:	00 00 00 
+  802f66:	ff d0                	call   *%rax
+  802f68:	84 c0                	test   %al,%al
+  802f6a:	74 99                	je     802f05 <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  802f6c:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  802f71:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802f76:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  802f7a:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  802f81:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  802f82:	4c 89 ff             	mov    %r15,%rdi
+  802f85:	49 03 7d 10          	add    0x10(%r13),%rdi
+  802f89:	48 89 da             	mov    %rbx,%rdx
+  802f8c:	4c 89 f6             	mov    %r14,%rsi
+  802f8f:	48 b8 40 11 80 00 00 	movabs $0x801140,%rax
+  802f96:	00 00 00 
+  802f99:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  802f9b:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  802f9f:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  802fa4:	48 89 d8             	mov    %rbx,%rax
+}
+  802fa7:	48 83 c4 08          	add    $0x8,%rsp
+  802fab:	5b                   	pop    %rbx
+  802fac:	41 5c                	pop    %r12
+  802fae:	41 5d                	pop    %r13
+  802fb0:	41 5e                	pop    %r14
+  802fb2:	41 5f                	pop    %r15
+  802fb4:	5d                   	pop    %rbp
+  802fb5:	c3                   	ret
+        return E_INVAL;
+  802fb6:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802fbb:	c3                   	ret
+
+0000000000802fbc <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802fbc:	55                   	push   %rbp
+  802fbd:	48 89 e5             	mov    %rsp,%rbp
+  802fc0:	41 54                	push   %r12
+  802fc2:	53                   	push   %rbx
+  802fc3:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  802fc6:	48 b8 35 2d 80 00 00 	movabs $0x802d35,%rax
+  802fcd:	00 00 00 
+  802fd0:	ff d0                	call   *%rax
+  802fd2:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  802fd5:	48 89 df             	mov    %rbx,%rdi
+  802fd8:	48 b8 e8 25 80 00 00 	movabs $0x8025e8,%rax
+  802fdf:	00 00 00 
+  802fe2:	ff d0                	call   *%rax
+  802fe4:	48 85 c0             	test   %rax,%rax
+  802fe7:	74 17                	je     803000 <devfile_flush+0x44>
+  802fe9:	48 89 df             	mov    %rbx,%rdi
+  802fec:	48 b8 e8 25 80 00 00 	movabs $0x8025e8,%rax
+  802ff3:	00 00 00 
+  802ff6:	ff d0                	call   *%rax
+  802ff8:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  802fff:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  803000:	8b 43 0c             	mov    0xc(%rbx),%eax
+  803003:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  80300a:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  80300c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803011:	be 00 00 00 00       	mov    $0x0,%esi
+  803016:	bf 06 00 00 00       	mov    $0x6,%edi
+  80301b:	48 b8 cc 2a 80 00 00 	movabs $0x802acc,%rax
+  803022:	00 00 00 
+  803025:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  803027:	45 85 e4             	test   %r12d,%r12d
+  80302a:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  80302e:	5b                   	pop    %rbx
+  80302f:	41 5c                	pop    %r12
+  803031:	5d                   	pop    %rbp
+  803032:	c3                   	ret
+
+0000000000803033 <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  803033:	55                   	push   %rbp
+  803034:	48 89 e5             	mov    %rsp,%rbp
+  803037:	41 57                	push   %r15
+  803039:	41 56                	push   %r14
+  80303b:	41 55                	push   %r13
+  80303d:	41 54                	push   %r12
+  80303f:	53                   	push   %rbx
+  803040:	48 83 ec 38          	sub    $0x38,%rsp
+  803044:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  803048:	49 89 f7             	mov    %rsi,%r15
+  80304b:	48 89 d3             	mov    %rdx,%rbx
+  80304e:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  803051:	48 b8 7e 25 80 00 00 	movabs $0x80257e,%rax
+  803058:	00 00 00 
+  80305b:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  80305d:	48 85 c0             	test   %rax,%rax
+  803060:	75 20                	jne    803082 <devfile_read_direct+0x4f>
+    bool map = 1;
+  803062:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  803067:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  80306e:	00 
+    while (n) {
+  80306f:	48 85 db             	test   %rbx,%rbx
+  803072:	0f 85 df 00 00 00    	jne    803157 <devfile_read_direct+0x124>
+    size_t read = 0;
+  803078:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  80307c:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803080:	eb 21                	jmp    8030a3 <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  803082:	45 89 f1             	mov    %r14d,%r9d
+  803085:	49 89 d8             	mov    %rbx,%r8
+  803088:	4c 89 f9             	mov    %r15,%rcx
+  80308b:	ba 03 00 00 00       	mov    $0x3,%edx
+  803090:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  803094:	48 89 c7             	mov    %rax,%rdi
+  803097:	48 b8 65 26 80 00 00 	movabs $0x802665,%rax
+  80309e:	00 00 00 
+  8030a1:	ff d0                	call   *%rax
+}
+  8030a3:	48 83 c4 38          	add    $0x38,%rsp
+  8030a7:	5b                   	pop    %rbx
+  8030a8:	41 5c                	pop    %r12
+  8030aa:	41 5d                	pop    %r13
+  8030ac:	41 5e                	pop    %r14
+  8030ae:	41 5f                	pop    %r15
+  8030b0:	5d                   	pop    %rbp
+  8030b1:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  8030b2:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8030b6:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  8030bc:	75 1e                	jne    8030dc <devfile_read_direct+0xa9>
+  8030be:	e9 e2 00 00 00       	jmp    8031a5 <devfile_read_direct+0x172>
+            if (!res) return read;
+  8030c3:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8030c7:	eb da                	jmp    8030a3 <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  8030c9:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  8030cd:	0f 85 d0 01 00 00    	jne    8032a3 <devfile_read_direct+0x270>
+            map = 0;
+  8030d3:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  8030d7:	eb 03                	jmp    8030dc <devfile_read_direct+0xa9>
+  8030d9:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  8030dc:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8030e1:	48 39 d3             	cmp    %rdx,%rbx
+  8030e4:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8030e8:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8030ec:	8b 40 0c             	mov    0xc(%rax),%eax
+  8030ef:	48 b9 00 00 83 00 00 	movabs $0x830000,%rcx
+  8030f6:	00 00 00 
+  8030f9:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  8030fb:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  8030ff:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  803103:	be 00 00 00 00       	mov    $0x0,%esi
+  803108:	bf 03 00 00 00       	mov    $0x3,%edi
+  80310d:	48 b8 cc 2a 80 00 00 	movabs $0x802acc,%rax
+  803114:	00 00 00 
+  803117:	ff d0                	call   *%rax
+        if (res <= 0)
+  803119:	85 c0                	test   %eax,%eax
+  80311b:	0f 8e 63 01 00 00    	jle    803284 <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  803121:	4c 63 e0             	movslq %eax,%r12
+  803124:	4c 89 e2             	mov    %r12,%rdx
+  803127:	48 be 00 10 83 00 00 	movabs $0x831000,%rsi
+  80312e:	00 00 00 
+  803131:	4c 89 ff             	mov    %r15,%rdi
+  803134:	48 b8 40 11 80 00 00 	movabs $0x801140,%rax
+  80313b:	00 00 00 
+  80313e:	ff d0                	call   *%rax
+        buf += res;
+  803140:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  803143:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  803146:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  80314a:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  80314e:	48 85 db             	test   %rbx,%rbx
+  803151:	0f 84 25 ff ff ff    	je     80307c <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  803157:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  80315a:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  80315e:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  803162:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  803166:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  80316d:	0f 97 c2             	seta   %dl
+  803170:	20 c2                	and    %al,%dl
+  803172:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  803175:	0f 84 5e ff ff ff    	je     8030d9 <devfile_read_direct+0xa6>
+  80317b:	4c 89 fa             	mov    %r15,%rdx
+  80317e:	4d 89 fd             	mov    %r15,%r13
+  803181:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  803188:	0f 85 4e ff ff ff    	jne    8030dc <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  80318e:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  803192:	0f 84 1a ff ff ff    	je     8030b2 <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  803198:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  80319f:	0f 85 37 ff ff ff    	jne    8030dc <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  8031a5:	48 89 d8             	mov    %rbx,%rax
+  8031a8:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8031ae:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  8031b3:	48 39 c8             	cmp    %rcx,%rax
+  8031b6:	48 0f 47 c1          	cmova  %rcx,%rax
+  8031ba:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  8031be:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  8031c2:	49 89 d4             	mov    %rdx,%r12
+  8031c5:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  8031c9:	48 b8 48 46 80 00 00 	movabs $0x804648,%rax
+  8031d0:	00 00 00 
+  8031d3:	ff d0                	call   *%rax
+  8031d5:	a8 40                	test   $0x40,%al
+  8031d7:	0f 85 b9 00 00 00    	jne    803296 <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  8031dd:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  8031e4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8031e8:	49 39 c5             	cmp    %rax,%r13
+  8031eb:	72 d8                	jb     8031c5 <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8031ed:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  8031f1:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  8031f8:	00 00 00 
+  8031fb:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  8031ff:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  803202:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  803204:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  803208:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  80320c:	48 b8 19 24 80 00 00 	movabs $0x802419,%rax
+  803213:	00 00 00 
+  803216:	ff d0                	call   *%rax
+  803218:	89 c7                	mov    %eax,%edi
+  80321a:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  803220:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803225:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  80322c:	00 00 00 
+  80322f:	be 0e 00 00 00       	mov    $0xe,%esi
+  803234:	48 b8 2a 4d 80 00 00 	movabs $0x804d2a,%rax
+  80323b:	00 00 00 
+  80323e:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  803240:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803245:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  803249:	4c 89 fe             	mov    %r15,%rsi
+  80324c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803251:	48 b8 06 4d 80 00 00 	movabs $0x804d06,%rax
+  803258:	00 00 00 
+  80325b:	ff d0                	call   *%rax
+  80325d:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  803260:	48 85 d2             	test   %rdx,%rdx
+  803263:	0f 84 5a fe ff ff    	je     8030c3 <devfile_read_direct+0x90>
+            if (res > 0) {
+  803269:	0f 8e 5a fe ff ff    	jle    8030c9 <devfile_read_direct+0x96>
+                buf += res;
+  80326f:	48 98                	cltq
+  803271:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  803274:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  803277:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  80327b:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  80327f:	e9 ca fe ff ff       	jmp    80314e <devfile_read_direct+0x11b>
+            return res ? res : read;
+  803284:	41 89 c5             	mov    %eax,%r13d
+  803287:	48 98                	cltq
+  803289:	45 85 ed             	test   %r13d,%r13d
+  80328c:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  803291:	e9 0d fe ff ff       	jmp    8030a3 <devfile_read_direct+0x70>
+            map = 0;
+  803296:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  80329a:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  80329e:	e9 39 fe ff ff       	jmp    8030dc <devfile_read_direct+0xa9>
+  8032a3:	48 89 d0             	mov    %rdx,%rax
+  8032a6:	e9 f8 fd ff ff       	jmp    8030a3 <devfile_read_direct+0x70>
+
+00000000008032ab <devfile_read>:
+    if (!fd || !buf)
+  8032ab:	48 85 ff             	test   %rdi,%rdi
+  8032ae:	0f 84 21 02 00 00    	je     8034d5 <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8032b4:	55                   	push   %rbp
+  8032b5:	48 89 e5             	mov    %rsp,%rbp
+  8032b8:	41 57                	push   %r15
+  8032ba:	41 56                	push   %r14
+  8032bc:	41 55                	push   %r13
+  8032be:	41 54                	push   %r12
+  8032c0:	53                   	push   %rbx
+  8032c1:	48 83 ec 28          	sub    $0x28,%rsp
+  8032c5:	48 89 fb             	mov    %rdi,%rbx
+  8032c8:	49 89 f4             	mov    %rsi,%r12
+  8032cb:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  8032ce:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  8032d3:	48 85 f6             	test   %rsi,%rsi
+  8032d6:	74 4b                	je     803323 <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  8032d8:	48 b8 e8 25 80 00 00 	movabs $0x8025e8,%rax
+  8032df:	00 00 00 
+  8032e2:	ff d0                	call   *%rax
+  8032e4:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  8032e7:	48 85 c0             	test   %rax,%rax
+  8032ea:	74 22                	je     80330e <devfile_read+0x63>
+  8032ec:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  8032f3:	77 19                	ja     80330e <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  8032f5:	be 00 10 00 00       	mov    $0x1000,%esi
+  8032fa:	48 89 df             	mov    %rbx,%rdi
+  8032fd:	48 b8 79 18 80 00 00 	movabs $0x801879,%rax
+  803304:	00 00 00 
+  803307:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  803309:	83 f8 02             	cmp    $0x2,%eax
+  80330c:	7e 40                	jle    80334e <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  80330e:	48 89 df             	mov    %rbx,%rdi
+  803311:	48 b8 35 2d 80 00 00 	movabs $0x802d35,%rax
+  803318:	00 00 00 
+  80331b:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  80331d:	85 c0                	test   %eax,%eax
+  80331f:	79 11                	jns    803332 <devfile_read+0x87>
+  803321:	48 98                	cltq
+}
+  803323:	48 83 c4 28          	add    $0x28,%rsp
+  803327:	5b                   	pop    %rbx
+  803328:	41 5c                	pop    %r12
+  80332a:	41 5d                	pop    %r13
+  80332c:	41 5e                	pop    %r14
+  80332e:	41 5f                	pop    %r15
+  803330:	5d                   	pop    %rbp
+  803331:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  803332:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  803337:	4c 89 ea             	mov    %r13,%rdx
+  80333a:	4c 89 e6             	mov    %r12,%rsi
+  80333d:	48 89 df             	mov    %rbx,%rdi
+  803340:	48 b8 33 30 80 00 00 	movabs $0x803033,%rax
+  803347:	00 00 00 
+  80334a:	ff d0                	call   *%rax
+  80334c:	eb d5                	jmp    803323 <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  80334e:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  803352:	48 89 df             	mov    %rbx,%rdi
+  803355:	48 b8 35 2d 80 00 00 	movabs $0x802d35,%rax
+  80335c:	00 00 00 
+  80335f:	ff d0                	call   *%rax
+  803361:	85 c0                	test   %eax,%eax
+  803363:	0f 88 33 01 00 00    	js     80349c <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  803369:	48 ba 00 23 82 00 00 	movabs $0x822300,%rdx
+  803370:	00 00 00 
+  803373:	4c 89 f0             	mov    %r14,%rax
+  803376:	48 29 d0             	sub    %rdx,%rax
+  803379:	48 c1 f8 03          	sar    $0x3,%rax
+  80337d:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  803384:	aa aa aa 
+  803387:	48 0f af c2          	imul   %rdx,%rax
+  80338b:	48 c1 e0 0e          	shl    $0xe,%rax
+  80338f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  803393:	8b 43 0c             	mov    0xc(%rbx),%eax
+  803396:	41 39 06             	cmp    %eax,(%r14)
+  803399:	75 0d                	jne    8033a8 <devfile_read+0xfd>
+  80339b:	8b 43 10             	mov    0x10(%rbx),%eax
+  80339e:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  8033a2:	0f 84 fb 00 00 00    	je     8034a3 <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  8033a8:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  8033ad:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8033b1:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  8033b4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8033b8:	48 89 c7             	mov    %rax,%rdi
+  8033bb:	48 b8 a7 46 80 00 00 	movabs $0x8046a7,%rax
+  8033c2:	00 00 00 
+  8033c5:	ff d0                	call   *%rax
+  8033c7:	84 c0                	test   %al,%al
+  8033c9:	75 27                	jne    8033f2 <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8033cb:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8033d0:	ba 00 40 00 00       	mov    $0x4000,%edx
+  8033d5:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8033d9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033de:	48 b8 b4 18 80 00 00 	movabs $0x8018b4,%rax
+  8033e5:	00 00 00 
+  8033e8:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  8033ea:	85 c0                	test   %eax,%eax
+  8033ec:	0f 88 dc 00 00 00    	js     8034ce <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  8033f2:	44 89 f8             	mov    %r15d,%eax
+  8033f5:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8033fa:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  8033fc:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  803403:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  803404:	8b 43 10             	mov    0x10(%rbx),%eax
+  803407:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  80340b:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  80340e:	ba 00 40 00 00       	mov    $0x4000,%edx
+  803413:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803417:	48 89 df             	mov    %rbx,%rdi
+  80341a:	48 b8 33 30 80 00 00 	movabs $0x803033,%rax
+  803421:	00 00 00 
+  803424:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  803426:	48 85 c0             	test   %rax,%rax
+  803429:	0f 88 f4 fe ff ff    	js     803323 <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  80342f:	8b 53 0c             	mov    0xc(%rbx),%edx
+  803432:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  803435:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  803438:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  80343c:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  803440:	48 63 d1             	movslq %ecx,%rdx
+  803443:	48 01 d0             	add    %rdx,%rax
+  803446:	4d 63 ff             	movslq %r15d,%r15
+  803449:	4c 29 f8             	sub    %r15,%rax
+  80344c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803451:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  803455:	48 85 c0             	test   %rax,%rax
+  803458:	0f 8e c5 fe ff ff    	jle    803323 <devfile_read+0x78>
+    n = MIN(n, res);
+  80345e:	4c 39 e8             	cmp    %r13,%rax
+  803461:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  803465:	8b 73 04             	mov    0x4(%rbx),%esi
+  803468:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  80346c:	48 63 f6             	movslq %esi,%rsi
+  80346f:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  803474:	48 01 c6             	add    %rax,%rsi
+  803477:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80347b:	48 01 c6             	add    %rax,%rsi
+  80347e:	4c 89 ea             	mov    %r13,%rdx
+  803481:	4c 89 e7             	mov    %r12,%rdi
+  803484:	48 b8 40 11 80 00 00 	movabs $0x801140,%rax
+  80348b:	00 00 00 
+  80348e:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  803490:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  803494:	4c 89 e8             	mov    %r13,%rax
+  803497:	e9 87 fe ff ff       	jmp    803323 <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  80349c:	48 98                	cltq
+  80349e:	e9 80 fe ff ff       	jmp    803323 <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  8034a3:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  8034a7:	41 39 d7             	cmp    %edx,%r15d
+  8034aa:	0f 8c f8 fe ff ff    	jl     8033a8 <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  8034b0:	49 8b 46 10          	mov    0x10(%r14),%rax
+  8034b4:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  8034b7:	41 39 cf             	cmp    %ecx,%r15d
+  8034ba:	0f 8d e8 fe ff ff    	jge    8033a8 <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  8034c0:	4d 63 ff             	movslq %r15d,%r15
+  8034c3:	4c 29 f8             	sub    %r15,%rax
+  8034c6:	48 63 d2             	movslq %edx,%rdx
+  8034c9:	48 01 d0             	add    %rdx,%rax
+  8034cc:	eb 87                	jmp    803455 <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8034ce:	48 98                	cltq
+  8034d0:	e9 4e fe ff ff       	jmp    803323 <devfile_read+0x78>
+        return E_INVAL;
+  8034d5:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  8034da:	c3                   	ret
+
+00000000008034db <fs_channel>:
+fs_channel(bool enable) {
+  8034db:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  8034dd:	a2 04 26 82 00 00 00 	movabs %al,0x822604
+  8034e4:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  8034e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8034eb:	40 84 ff             	test   %dil,%dil
+  8034ee:	74 47                	je     803537 <fs_channel+0x5c>
+  8034f0:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8034f7:	00 00 00 
+  8034fa:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  803500:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  803507:	00 00 00 
+  80350a:	3b 08                	cmp    (%rax),%ecx
+  80350c:	74 29                	je     803537 <fs_channel+0x5c>
+fs_channel(bool enable) {
+  80350e:	55                   	push   %rbp
+  80350f:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  803512:	48 b8 5b 24 80 00 00 	movabs $0x80245b,%rax
+  803519:	00 00 00 
+  80351c:	ff d0                	call   *%rax
+  80351e:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  803520:	85 c0                	test   %eax,%eax
+  803522:	78 04                	js     803528 <fs_channel+0x4d>
+}
+  803524:	89 d0                	mov    %edx,%eax
+  803526:	5d                   	pop    %rbp
+  803527:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  803528:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  80352f:	00 00 00 
+  803532:	c6 00 00             	movb   $0x0,(%rax)
+  803535:	eb ed                	jmp    803524 <fs_channel+0x49>
+}
+  803537:	89 d0                	mov    %edx,%eax
+  803539:	c3                   	ret
+
+000000000080353a <open>:
+open(const char *path, int mode) {
+  80353a:	55                   	push   %rbp
+  80353b:	48 89 e5             	mov    %rsp,%rbp
+  80353e:	41 55                	push   %r13
+  803540:	41 54                	push   %r12
+  803542:	53                   	push   %rbx
+  803543:	48 83 ec 18          	sub    $0x18,%rsp
+  803547:	49 89 fc             	mov    %rdi,%r12
+  80354a:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80354d:	48 b8 a1 0e 80 00 00 	movabs $0x800ea1,%rax
+  803554:	00 00 00 
+  803557:	ff d0                	call   *%rax
+  803559:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80355f:	0f 87 8f 00 00 00    	ja     8035f4 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803565:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803569:	48 b8 15 1d 80 00 00 	movabs $0x801d15,%rax
+  803570:	00 00 00 
+  803573:	ff d0                	call   *%rax
+  803575:	89 c3                	mov    %eax,%ebx
+  803577:	85 c0                	test   %eax,%eax
+  803579:	78 55                	js     8035d0 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  80357b:	4c 89 e6             	mov    %r12,%rsi
+  80357e:	48 bb 00 00 83 00 00 	movabs $0x830000,%rbx
+  803585:	00 00 00 
+  803588:	48 89 df             	mov    %rbx,%rdi
+  80358b:	48 b8 df 0e 80 00 00 	movabs $0x800edf,%rax
+  803592:	00 00 00 
+  803595:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803597:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  80359e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035a3:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8035a7:	bf 01 00 00 00       	mov    $0x1,%edi
+  8035ac:	48 b8 cc 2a 80 00 00 	movabs $0x802acc,%rax
+  8035b3:	00 00 00 
+  8035b6:	ff d0                	call   *%rax
+  8035b8:	89 c3                	mov    %eax,%ebx
+  8035ba:	85 c0                	test   %eax,%eax
+  8035bc:	78 1f                	js     8035dd <open+0xa3>
+    return fd2num(fd);
+  8035be:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8035c2:	48 b8 e7 1c 80 00 00 	movabs $0x801ce7,%rax
+  8035c9:	00 00 00 
+  8035cc:	ff d0                	call   *%rax
+  8035ce:	89 c3                	mov    %eax,%ebx
+}
+  8035d0:	89 d8                	mov    %ebx,%eax
+  8035d2:	48 83 c4 18          	add    $0x18,%rsp
+  8035d6:	5b                   	pop    %rbx
+  8035d7:	41 5c                	pop    %r12
+  8035d9:	41 5d                	pop    %r13
+  8035db:	5d                   	pop    %rbp
+  8035dc:	c3                   	ret
+        fd_close(fd, 0);
+  8035dd:	be 00 00 00 00       	mov    $0x0,%esi
+  8035e2:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8035e6:	48 b8 30 1e 80 00 00 	movabs $0x801e30,%rax
+  8035ed:	00 00 00 
+  8035f0:	ff d0                	call   *%rax
+        return res;
+  8035f2:	eb dc                	jmp    8035d0 <open+0x96>
+        return -E_BAD_PATH;
+  8035f4:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8035f9:	eb d5                	jmp    8035d0 <open+0x96>
+
+00000000008035fb <file_flush_buffers>:
+file_flush_buffers(void) {
+  8035fb:	55                   	push   %rbp
+  8035fc:	48 89 e5             	mov    %rsp,%rbp
+  8035ff:	41 56                	push   %r14
+  803601:	41 55                	push   %r13
+  803603:	41 54                	push   %r12
+  803605:	53                   	push   %rbx
+  803606:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  80360a:	49 bc 08 23 82 00 00 	movabs $0x822308,%r12
+  803611:	00 00 00 
+  803614:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  803619:	49 bd 75 1d 80 00 00 	movabs $0x801d75,%r13
+  803620:	00 00 00 
+  803623:	49 be 35 2d 80 00 00 	movabs $0x802d35,%r14
+  80362a:	00 00 00 
+  80362d:	eb 0c                	jmp    80363b <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  80362f:	83 c3 01             	add    $0x1,%ebx
+  803632:	49 83 c4 18          	add    $0x18,%r12
+  803636:	83 fb 20             	cmp    $0x20,%ebx
+  803639:	74 1d                	je     803658 <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  80363b:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  803640:	74 ed                	je     80362f <file_flush_buffers+0x34>
+  803642:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803646:	89 df                	mov    %ebx,%edi
+  803648:	41 ff d5             	call   *%r13
+  80364b:	85 c0                	test   %eax,%eax
+  80364d:	78 e0                	js     80362f <file_flush_buffers+0x34>
+  80364f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803653:	41 ff d6             	call   *%r14
+  803656:	eb d7                	jmp    80362f <file_flush_buffers+0x34>
+}
+  803658:	48 83 c4 10          	add    $0x10,%rsp
+  80365c:	5b                   	pop    %rbx
+  80365d:	41 5c                	pop    %r12
+  80365f:	41 5d                	pop    %r13
+  803661:	41 5e                	pop    %r14
+  803663:	5d                   	pop    %rbp
+  803664:	c3                   	ret
+
+0000000000803665 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803665:	55                   	push   %rbp
+  803666:	48 89 e5             	mov    %rsp,%rbp
+  803669:	41 54                	push   %r12
+  80366b:	53                   	push   %rbx
+  80366c:	49 89 fc             	mov    %rdi,%r12
+  80366f:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  803671:	48 b8 fb 35 80 00 00 	movabs $0x8035fb,%rax
+  803678:	00 00 00 
+  80367b:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80367d:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803684:	00 00 00 
+  803687:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  80368c:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  80368e:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  803691:	ba 00 00 00 00       	mov    $0x0,%edx
+  803696:	be 00 00 00 00       	mov    $0x0,%esi
+  80369b:	bf 02 00 00 00       	mov    $0x2,%edi
+  8036a0:	48 b8 cc 2a 80 00 00 	movabs $0x802acc,%rax
+  8036a7:	00 00 00 
+  8036aa:	ff d0                	call   *%rax
+}
+  8036ac:	5b                   	pop    %rbx
+  8036ad:	41 5c                	pop    %r12
+  8036af:	5d                   	pop    %rbp
+  8036b0:	c3                   	ret
+
+00000000008036b1 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8036b1:	55                   	push   %rbp
+  8036b2:	48 89 e5             	mov    %rsp,%rbp
+  8036b5:	41 54                	push   %r12
+  8036b7:	53                   	push   %rbx
+  8036b8:	49 89 fc             	mov    %rdi,%r12
+  8036bb:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  8036be:	48 b8 fb 35 80 00 00 	movabs $0x8035fb,%rax
+  8036c5:	00 00 00 
+  8036c8:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8036ca:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  8036cf:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  8036d6:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  8036d8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8036dd:	be 00 00 00 00       	mov    $0x0,%esi
+  8036e2:	bf 05 00 00 00       	mov    $0x5,%edi
+  8036e7:	48 b8 cc 2a 80 00 00 	movabs $0x802acc,%rax
+  8036ee:	00 00 00 
+  8036f1:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8036f3:	85 c0                	test   %eax,%eax
+  8036f5:	78 3d                	js     803734 <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8036f7:	49 bc 00 00 83 00 00 	movabs $0x830000,%r12
+  8036fe:	00 00 00 
+  803701:	4c 89 e6             	mov    %r12,%rsi
+  803704:	48 89 df             	mov    %rbx,%rdi
+  803707:	48 b8 df 0e 80 00 00 	movabs $0x800edf,%rax
+  80370e:	00 00 00 
+  803711:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  803713:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  80371a:	00 
+  80371b:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803721:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  803728:	00 
+  803729:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  80372f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803734:	5b                   	pop    %rbx
+  803735:	41 5c                	pop    %r12
+  803737:	5d                   	pop    %rbp
+  803738:	c3                   	ret
+
+0000000000803739 <remove>:
+remove(const char *path) {
+  803739:	55                   	push   %rbp
+  80373a:	48 89 e5             	mov    %rsp,%rbp
+  80373d:	53                   	push   %rbx
+  80373e:	48 83 ec 08          	sub    $0x8,%rsp
+  803742:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  803745:	48 b8 a1 0e 80 00 00 	movabs $0x800ea1,%rax
+  80374c:	00 00 00 
+  80374f:	ff d0                	call   *%rax
+  803751:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803757:	77 3a                	ja     803793 <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  803759:	48 89 de             	mov    %rbx,%rsi
+  80375c:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  803763:	00 00 00 
+  803766:	48 b8 df 0e 80 00 00 	movabs $0x800edf,%rax
+  80376d:	00 00 00 
+  803770:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  803772:	ba 00 00 00 00       	mov    $0x0,%edx
+  803777:	be 00 00 00 00       	mov    $0x0,%esi
+  80377c:	bf 07 00 00 00       	mov    $0x7,%edi
+  803781:	48 b8 cc 2a 80 00 00 	movabs $0x802acc,%rax
+  803788:	00 00 00 
+  80378b:	ff d0                	call   *%rax
+}
+  80378d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803791:	c9                   	leave
+  803792:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  803793:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803798:	eb f3                	jmp    80378d <remove+0x54>
+
+000000000080379a <sync>:
+sync(void) {
+  80379a:	55                   	push   %rbp
+  80379b:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  80379e:	48 b8 fb 35 80 00 00 	movabs $0x8035fb,%rax
+  8037a5:	00 00 00 
+  8037a8:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  8037aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8037af:	be 00 00 00 00       	mov    $0x0,%esi
+  8037b4:	bf 08 00 00 00       	mov    $0x8,%edi
+  8037b9:	48 b8 cc 2a 80 00 00 	movabs $0x802acc,%rax
+  8037c0:	00 00 00 
+  8037c3:	ff d0                	call   *%rax
+}
+  8037c5:	5d                   	pop    %rbp
+  8037c6:	c3                   	ret
+
+00000000008037c7 <fsync>:
+fsync(int fdnum) {
+  8037c7:	55                   	push   %rbp
+  8037c8:	48 89 e5             	mov    %rsp,%rbp
+  8037cb:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8037cf:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8037d3:	48 b8 75 1d 80 00 00 	movabs $0x801d75,%rax
+  8037da:	00 00 00 
+  8037dd:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8037df:	85 c0                	test   %eax,%eax
+  8037e1:	78 4b                	js     80382e <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8037e3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8037e7:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  8037ee:	00 00 00 
+  8037f1:	8b 00                	mov    (%rax),%eax
+  8037f3:	39 02                	cmp    %eax,(%rdx)
+  8037f5:	75 39                	jne    803830 <fsync+0x69>
+    file_flush_buffers();
+  8037f7:	48 b8 fb 35 80 00 00 	movabs $0x8035fb,%rax
+  8037fe:	00 00 00 
+  803801:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  803803:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803807:	8b 40 0c             	mov    0xc(%rax),%eax
+  80380a:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  803811:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  803813:	ba 00 00 00 00       	mov    $0x0,%edx
+  803818:	be 00 00 00 00       	mov    $0x0,%esi
+  80381d:	bf 0d 00 00 00       	mov    $0xd,%edi
+  803822:	48 b8 cc 2a 80 00 00 	movabs $0x802acc,%rax
+  803829:	00 00 00 
+  80382c:	ff d0                	call   *%rax
+}
+  80382e:	c9                   	leave
+  80382f:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803830:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803835:	eb f7                	jmp    80382e <fsync+0x67>
+
+0000000000803837 <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  803837:	55                   	push   %rbp
+  803838:	48 89 e5             	mov    %rsp,%rbp
+  80383b:	53                   	push   %rbx
+  80383c:	48 83 ec 08          	sub    $0x8,%rsp
+  803840:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  803843:	ba 00 00 00 00       	mov    $0x0,%edx
+  803848:	be 00 00 00 00       	mov    $0x0,%esi
+  80384d:	bf 0b 00 00 00       	mov    $0xb,%edi
+  803852:	48 b8 cc 2a 80 00 00 	movabs $0x802acc,%rax
+  803859:	00 00 00 
+  80385c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80385e:	85 c0                	test   %eax,%eax
+  803860:	78 2d                	js     80388f <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  803862:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803869:	00 00 00 
+  80386c:	48 8b 10             	mov    (%rax),%rdx
+  80386f:	48 89 13             	mov    %rdx,(%rbx)
+  803872:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  803876:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  80387a:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80387e:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  803882:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803886:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  80388a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80388f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803893:	c9                   	leave
+  803894:	c3                   	ret
+
+0000000000803895 <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  803895:	55                   	push   %rbp
+  803896:	48 89 e5             	mov    %rsp,%rbp
+  803899:	53                   	push   %rbx
+  80389a:	48 83 ec 08          	sub    $0x8,%rsp
+  80389e:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  8038a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8038a6:	be 00 00 00 00       	mov    $0x0,%esi
+  8038ab:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8038b0:	48 b8 cc 2a 80 00 00 	movabs $0x802acc,%rax
+  8038b7:	00 00 00 
+  8038ba:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8038bc:	85 c0                	test   %eax,%eax
+  8038be:	78 3d                	js     8038fd <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  8038c0:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  8038c7:	00 00 00 
+  8038ca:	48 8b 10             	mov    (%rax),%rdx
+  8038cd:	48 89 13             	mov    %rdx,(%rbx)
+  8038d0:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8038d4:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  8038d8:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8038dc:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  8038e0:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  8038e4:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  8038e8:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  8038ec:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  8038f0:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8038f4:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  8038f8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8038fd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803901:	c9                   	leave
+  803902:	c3                   	ret
+
+0000000000803903 <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  803903:	55                   	push   %rbp
+  803904:	48 89 e5             	mov    %rsp,%rbp
+  803907:	41 57                	push   %r15
+  803909:	41 56                	push   %r14
+  80390b:	41 55                	push   %r13
+  80390d:	41 54                	push   %r12
+  80390f:	53                   	push   %rbx
+  803910:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  803914:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  80391b:	00 
+  80391c:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  803923:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  803929:	0f 85 43 01 00 00    	jne    803a72 <munmap+0x16f>
+  80392f:	49 89 ff             	mov    %rdi,%r15
+  803932:	4c 39 f7             	cmp    %r14,%rdi
+  803935:	0f 87 37 01 00 00    	ja     803a72 <munmap+0x16f>
+  80393b:	48 bb 00 20 82 00 00 	movabs $0x822000,%rbx
+  803942:	00 00 00 
+  803945:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  80394b:	eb 2c                	jmp    803979 <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  80394d:	4c 39 f8             	cmp    %r15,%rax
+  803950:	0f 83 85 00 00 00    	jae    8039db <munmap+0xd8>
+            m->mm_end = start;
+  803956:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80395b:	48 83 c3 18          	add    $0x18,%rbx
+  80395f:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  803966:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  80396d:	00 00 00 
+  803970:	48 39 c3             	cmp    %rax,%rbx
+  803973:	0f 84 d0 00 00 00    	je     803a49 <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  803979:	49 89 dc             	mov    %rbx,%r12
+  80397c:	48 8b 03             	mov    (%rbx),%rax
+  80397f:	4c 39 f0             	cmp    %r14,%rax
+  803982:	73 d7                	jae    80395b <munmap+0x58>
+  803984:	48 85 c0             	test   %rax,%rax
+  803987:	74 d2                	je     80395b <munmap+0x58>
+  803989:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  80398d:	49 39 d7             	cmp    %rdx,%r15
+  803990:	73 c9                	jae    80395b <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  803992:	49 39 d6             	cmp    %rdx,%r14
+  803995:	73 b6                	jae    80394d <munmap+0x4a>
+  803997:	49 39 c7             	cmp    %rax,%r15
+  80399a:	76 b1                	jbe    80394d <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  80399c:	4c 89 ef             	mov    %r13,%rdi
+  80399f:	48 b8 3a 2a 80 00 00 	movabs $0x802a3a,%rax
+  8039a6:	00 00 00 
+  8039a9:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  8039ab:	48 85 c0             	test   %rax,%rax
+  8039ae:	0f 84 c5 00 00 00    	je     803a79 <munmap+0x176>
+            *tail = *m;
+  8039b4:	48 8b 13             	mov    (%rbx),%rdx
+  8039b7:	48 89 10             	mov    %rdx,(%rax)
+  8039ba:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8039be:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  8039c2:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  8039c6:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  8039ca:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  8039cd:	44 89 f2             	mov    %r14d,%edx
+  8039d0:	2b 13                	sub    (%rbx),%edx
+  8039d2:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  8039d5:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  8039d9:	eb 80                	jmp    80395b <munmap+0x58>
+        } else if (m->mm_end > end) {
+  8039db:	49 39 d6             	cmp    %rdx,%r14
+  8039de:	73 18                	jae    8039f8 <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  8039e0:	44 89 f2             	mov    %r14d,%edx
+  8039e3:	41 03 54 24 10       	add    0x10(%r12),%edx
+  8039e8:	29 c2                	sub    %eax,%edx
+  8039ea:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  8039ef:	4d 89 34 24          	mov    %r14,(%r12)
+  8039f3:	e9 63 ff ff ff       	jmp    80395b <munmap+0x58>
+    m->mm_start = 0;
+  8039f8:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  8039ff:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  803a00:	4c 89 e6             	mov    %r12,%rsi
+  803a03:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  803a0a:	00 00 00 
+  803a0d:	48 29 c6             	sub    %rax,%rsi
+  803a10:	48 c1 fe 03          	sar    $0x3,%rsi
+  803a14:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  803a1b:	aa aa aa 
+  803a1e:	48 0f af f0          	imul   %rax,%rsi
+  803a22:	48 c1 e6 0c          	shl    $0xc,%rsi
+  803a26:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  803a2b:	48 01 c6             	add    %rax,%rsi
+  803a2e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a33:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a38:	48 b8 5a 19 80 00 00 	movabs $0x80195a,%rax
+  803a3f:	00 00 00 
+  803a42:	ff d0                	call   *%rax
+}
+  803a44:	e9 12 ff ff ff       	jmp    80395b <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  803a49:	4c 89 f2             	mov    %r14,%rdx
+  803a4c:	4c 29 fa             	sub    %r15,%rdx
+  803a4f:	4c 89 fe             	mov    %r15,%rsi
+  803a52:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a57:	48 b8 5a 19 80 00 00 	movabs $0x80195a,%rax
+  803a5e:	00 00 00 
+  803a61:	ff d0                	call   *%rax
+}
+  803a63:	48 83 c4 08          	add    $0x8,%rsp
+  803a67:	5b                   	pop    %rbx
+  803a68:	41 5c                	pop    %r12
+  803a6a:	41 5d                	pop    %r13
+  803a6c:	41 5e                	pop    %r14
+  803a6e:	41 5f                	pop    %r15
+  803a70:	5d                   	pop    %rbp
+  803a71:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  803a72:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803a77:	eb ea                	jmp    803a63 <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  803a79:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  803a7e:	eb e3                	jmp    803a63 <munmap+0x160>
+
+0000000000803a80 <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  803a80:	55                   	push   %rbp
+  803a81:	48 89 e5             	mov    %rsp,%rbp
+  803a84:	41 57                	push   %r15
+  803a86:	41 56                	push   %r14
+  803a88:	41 55                	push   %r13
+  803a8a:	41 54                	push   %r12
+  803a8c:	53                   	push   %rbx
+  803a8d:	48 83 ec 28          	sub    $0x28,%rsp
+  803a91:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  803a95:	49 89 f5             	mov    %rsi,%r13
+  803a98:	41 89 d6             	mov    %edx,%r14d
+  803a9b:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  803a9e:	41 89 cc             	mov    %ecx,%r12d
+  803aa1:	44 89 c7             	mov    %r8d,%edi
+  803aa4:	44 89 cb             	mov    %r9d,%ebx
+  803aa7:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803aab:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803aaf:	48 b8 75 1d 80 00 00 	movabs $0x801d75,%rax
+  803ab6:	00 00 00 
+  803ab9:	ff d0                	call   *%rax
+  803abb:	41 89 c7             	mov    %eax,%r15d
+  803abe:	85 c0                	test   %eax,%eax
+  803ac0:	0f 88 ae 01 00 00    	js     803c74 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803ac6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803aca:	48 ba 60 60 80 00 00 	movabs $0x806060,%rdx
+  803ad1:	00 00 00 
+  803ad4:	8b 32                	mov    (%rdx),%esi
+  803ad6:	39 30                	cmp    %esi,(%rax)
+  803ad8:	0f 85 7a 02 00 00    	jne    803d58 <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  803ade:	8b 40 08             	mov    0x8(%rax),%eax
+  803ae1:	83 e0 03             	and    $0x3,%eax
+  803ae4:	83 f8 01             	cmp    $0x1,%eax
+  803ae7:	0f 84 76 02 00 00    	je     803d63 <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  803aed:	4d 85 ed             	test   %r13,%r13
+  803af0:	0f 84 78 02 00 00    	je     803d6e <mmap+0x2ee>
+  803af6:	85 db                	test   %ebx,%ebx
+  803af8:	0f 88 70 02 00 00    	js     803d6e <mmap+0x2ee>
+  803afe:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  803b04:	41 89 df             	mov    %ebx,%r15d
+  803b07:	0f 85 6c 02 00 00    	jne    803d79 <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  803b0d:	44 89 f0             	mov    %r14d,%eax
+  803b10:	83 e0 fd             	and    $0xfffffffd,%eax
+  803b13:	83 f8 04             	cmp    $0x4,%eax
+  803b16:	0f 85 68 02 00 00    	jne    803d84 <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  803b1c:	44 89 e1             	mov    %r12d,%ecx
+  803b1f:	83 e1 01             	and    $0x1,%ecx
+  803b22:	0f 95 c2             	setne  %dl
+  803b25:	44 89 e0             	mov    %r12d,%eax
+  803b28:	d1 e8                	shr    %eax
+  803b2a:	83 f0 01             	xor    $0x1,%eax
+  803b2d:	83 e0 01             	and    $0x1,%eax
+  803b30:	38 c2                	cmp    %al,%dl
+  803b32:	0f 85 57 02 00 00    	jne    803d8f <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  803b38:	85 c9                	test   %ecx,%ecx
+  803b3a:	74 0a                	je     803b46 <mmap+0xc6>
+  803b3c:	41 f6 c6 02          	test   $0x2,%r14b
+  803b40:	0f 85 54 02 00 00    	jne    803d9a <mmap+0x31a>
+    file_flush_buffers();
+  803b46:	48 b8 fb 35 80 00 00 	movabs $0x8035fb,%rax
+  803b4d:	00 00 00 
+  803b50:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  803b52:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  803b59:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  803b60:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803b64:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  803b67:	41 f6 c4 04          	test   $0x4,%r12b
+  803b6b:	0f 84 15 01 00 00    	je     803c86 <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  803b71:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  803b74:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  803b7a:	0f 85 25 02 00 00    	jne    803da5 <mmap+0x325>
+  803b80:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  803b84:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  803b8b:	00 00 00 
+  803b8e:	48 39 c2             	cmp    %rax,%rdx
+  803b91:	0f 82 19 02 00 00    	jb     803db0 <mmap+0x330>
+  803b97:	48 39 c7             	cmp    %rax,%rdi
+  803b9a:	0f 87 10 02 00 00    	ja     803db0 <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  803ba0:	4c 89 ee             	mov    %r13,%rsi
+  803ba3:	48 b8 03 39 80 00 00 	movabs $0x803903,%rax
+  803baa:	00 00 00 
+  803bad:	ff d0                	call   *%rax
+  803baf:	85 c0                	test   %eax,%eax
+  803bb1:	0f 88 04 02 00 00    	js     803dbb <mmap+0x33b>
+    if (!handler) {
+  803bb7:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  803bbe:	00 00 00 
+  803bc1:	80 38 00             	cmpb   $0x0,(%rax)
+  803bc4:	75 2b                	jne    803bf1 <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  803bc6:	48 bf 9b 29 80 00 00 	movabs $0x80299b,%rdi
+  803bcd:	00 00 00 
+  803bd0:	48 b8 d5 49 80 00 00 	movabs $0x8049d5,%rax
+  803bd7:	00 00 00 
+  803bda:	ff d0                	call   *%rax
+  803bdc:	85 c0                	test   %eax,%eax
+  803bde:	0f 88 ea 01 00 00    	js     803dce <mmap+0x34e>
+        handler = 1;
+  803be4:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  803beb:	00 00 00 
+  803bee:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  803bf1:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803bf5:	48 b8 3a 2a 80 00 00 	movabs $0x802a3a,%rax
+  803bfc:	00 00 00 
+  803bff:	ff d0                	call   *%rax
+  803c01:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  803c04:	48 85 c0             	test   %rax,%rax
+  803c07:	0f 84 c9 01 00 00    	je     803dd6 <mmap+0x356>
+    m->mm_start = va;
+  803c0d:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  803c10:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  803c14:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  803c18:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  803c1b:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  803c1f:	44 89 e0             	mov    %r12d,%eax
+  803c22:	c1 e0 06             	shl    $0x6,%eax
+  803c25:	25 80 00 00 00       	and    $0x80,%eax
+  803c2a:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  803c2d:	09 f0                	or     %esi,%eax
+  803c2f:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  803c33:	41 f6 c4 08          	test   $0x8,%r12b
+  803c37:	74 31                	je     803c6a <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  803c39:	48 39 d3             	cmp    %rdx,%rbx
+  803c3c:	73 2c                	jae    803c6a <mmap+0x1ea>
+  803c3e:	ba 00 00 04 00       	mov    $0x40000,%edx
+  803c43:	48 89 de             	mov    %rbx,%rsi
+  803c46:	4c 89 f7             	mov    %r14,%rdi
+  803c49:	48 b8 8a 28 80 00 00 	movabs $0x80288a,%rax
+  803c50:	00 00 00 
+  803c53:	ff d0                	call   *%rax
+  803c55:	49 89 c4             	mov    %rax,%r12
+  803c58:	48 85 c0             	test   %rax,%rax
+  803c5b:	0f 8e d7 00 00 00    	jle    803d38 <mmap+0x2b8>
+            va += n;
+  803c61:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  803c64:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  803c68:	72 d4                	jb     803c3e <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  803c6a:	49 8b 06             	mov    (%r14),%rax
+  803c6d:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  803c71:	48 89 06             	mov    %rax,(%rsi)
+}
+  803c74:	44 89 f8             	mov    %r15d,%eax
+  803c77:	48 83 c4 28          	add    $0x28,%rsp
+  803c7b:	5b                   	pop    %rbx
+  803c7c:	41 5c                	pop    %r12
+  803c7e:	41 5d                	pop    %r13
+  803c80:	41 5e                	pop    %r14
+  803c82:	41 5f                	pop    %r15
+  803c84:	5d                   	pop    %rbp
+  803c85:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803c86:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  803c8d:	00 00 00 
+  803c90:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  803c93:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  803c9a:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803c9d:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  803ca2:	48 be 00 20 82 00 00 	movabs $0x822000,%rsi
+  803ca9:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803cac:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  803cb3:	00 00 00 
+  803cb6:	48 39 d7             	cmp    %rdx,%rdi
+  803cb9:	73 1c                	jae    803cd7 <mmap+0x257>
+        return -E_NO_MEM;
+  803cbb:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803cc1:	eb b1                	jmp    803c74 <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803cc3:	48 83 c0 01          	add    $0x1,%rax
+  803cc7:	48 83 f8 1f          	cmp    $0x1f,%rax
+  803ccb:	77 3f                	ja     803d0c <mmap+0x28c>
+  803ccd:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  803cd2:	48 39 d7             	cmp    %rdx,%rdi
+  803cd5:	72 2a                	jb     803d01 <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  803cd7:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  803cdb:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  803cdf:	48 39 d1             	cmp    %rdx,%rcx
+  803ce2:	73 df                	jae    803cc3 <mmap+0x243>
+  803ce4:	48 85 c9             	test   %rcx,%rcx
+  803ce7:	74 da                	je     803cc3 <mmap+0x243>
+  803ce9:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  803ced:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  803cf2:	48 39 d3             	cmp    %rdx,%rbx
+  803cf5:	73 cc                	jae    803cc3 <mmap+0x243>
+            va = mmaps[i].mm_end;
+  803cf7:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803cfa:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cff:	eb cc                	jmp    803ccd <mmap+0x24d>
+        return -E_NO_MEM;
+  803d01:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803d07:	e9 68 ff ff ff       	jmp    803c74 <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  803d0c:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  803d11:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  803d18:	00 00 00 
+  803d1b:	48 39 c2             	cmp    %rax,%rdx
+  803d1e:	0f 82 9f 00 00 00    	jb     803dc3 <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  803d24:	48 85 db             	test   %rbx,%rbx
+  803d27:	0f 85 8a fe ff ff    	jne    803bb7 <mmap+0x137>
+        return -E_NO_MEM;
+  803d2d:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803d33:	e9 3c ff ff ff       	jmp    803c74 <mmap+0x1f4>
+        if (n < 0) {
+  803d38:	0f 89 2c ff ff ff    	jns    803c6a <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  803d3e:	49 8b 3e             	mov    (%r14),%rdi
+  803d41:	4c 89 ee             	mov    %r13,%rsi
+  803d44:	48 b8 03 39 80 00 00 	movabs $0x803903,%rax
+  803d4b:	00 00 00 
+  803d4e:	ff d0                	call   *%rax
+            return n;
+  803d50:	45 89 e7             	mov    %r12d,%r15d
+  803d53:	e9 1c ff ff ff       	jmp    803c74 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803d58:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803d5e:	e9 11 ff ff ff       	jmp    803c74 <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  803d63:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803d69:	e9 06 ff ff ff       	jmp    803c74 <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  803d6e:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803d74:	e9 fb fe ff ff       	jmp    803c74 <mmap+0x1f4>
+  803d79:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803d7f:	e9 f0 fe ff ff       	jmp    803c74 <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  803d84:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803d8a:	e9 e5 fe ff ff       	jmp    803c74 <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  803d8f:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803d95:	e9 da fe ff ff       	jmp    803c74 <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  803d9a:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  803da0:	e9 cf fe ff ff       	jmp    803c74 <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  803da5:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803dab:	e9 c4 fe ff ff       	jmp    803c74 <mmap+0x1f4>
+  803db0:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803db6:	e9 b9 fe ff ff       	jmp    803c74 <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  803dbb:	41 89 c7             	mov    %eax,%r15d
+  803dbe:	e9 b1 fe ff ff       	jmp    803c74 <mmap+0x1f4>
+        return -E_NO_MEM;
+  803dc3:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803dc9:	e9 a6 fe ff ff       	jmp    803c74 <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  803dce:	41 89 c7             	mov    %eax,%r15d
+  803dd1:	e9 9e fe ff ff       	jmp    803c74 <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  803dd6:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803ddc:	e9 93 fe ff ff       	jmp    803c74 <mmap+0x1f4>
+
+0000000000803de1 <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  803de1:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  803de5:	7f 01                	jg     803de8 <writebuf+0x7>
+  803de7:	c3                   	ret
+writebuf(struct printbuf *state) {
+  803de8:	55                   	push   %rbp
+  803de9:	48 89 e5             	mov    %rsp,%rbp
+  803dec:	53                   	push   %rbx
+  803ded:	48 83 ec 08          	sub    $0x8,%rsp
+  803df1:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  803df4:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  803df8:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  803dfc:	8b 3f                	mov    (%rdi),%edi
+  803dfe:	48 b8 87 21 80 00 00 	movabs $0x802187,%rax
+  803e05:	00 00 00 
+  803e08:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  803e0a:	48 85 c0             	test   %rax,%rax
+  803e0d:	7e 04                	jle    803e13 <writebuf+0x32>
+  803e0f:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  803e13:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  803e17:	48 39 c2             	cmp    %rax,%rdx
+  803e1a:	74 0f                	je     803e2b <writebuf+0x4a>
+            state->error = MIN(0, result);
+  803e1c:	48 85 c0             	test   %rax,%rax
+  803e1f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e24:	48 0f 4f c2          	cmovg  %rdx,%rax
+  803e28:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  803e2b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803e2f:	c9                   	leave
+  803e30:	c3                   	ret
+
+0000000000803e31 <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  803e31:	8b 46 04             	mov    0x4(%rsi),%eax
+  803e34:	8d 50 01             	lea    0x1(%rax),%edx
+  803e37:	89 56 04             	mov    %edx,0x4(%rsi)
+  803e3a:	48 98                	cltq
+  803e3c:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  803e41:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  803e47:	74 01                	je     803e4a <putch+0x19>
+  803e49:	c3                   	ret
+putch(int ch, void *arg) {
+  803e4a:	55                   	push   %rbp
+  803e4b:	48 89 e5             	mov    %rsp,%rbp
+  803e4e:	53                   	push   %rbx
+  803e4f:	48 83 ec 08          	sub    $0x8,%rsp
+  803e53:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  803e56:	48 89 f7             	mov    %rsi,%rdi
+  803e59:	48 b8 e1 3d 80 00 00 	movabs $0x803de1,%rax
+  803e60:	00 00 00 
+  803e63:	ff d0                	call   *%rax
+        state->offset = 0;
+  803e65:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  803e6c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803e70:	c9                   	leave
+  803e71:	c3                   	ret
+
+0000000000803e72 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  803e72:	55                   	push   %rbp
+  803e73:	48 89 e5             	mov    %rsp,%rbp
+  803e76:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  803e7d:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  803e80:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  803e86:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  803e8d:	00 00 00 
+    state.result = 0;
+  803e90:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  803e97:	00 00 00 00 
+    state.error = 1;
+  803e9b:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  803ea2:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  803ea5:	48 89 f2             	mov    %rsi,%rdx
+  803ea8:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  803eaf:	48 bf 31 3e 80 00 00 	movabs $0x803e31,%rdi
+  803eb6:	00 00 00 
+  803eb9:	48 b8 0a 07 80 00 00 	movabs $0x80070a,%rax
+  803ec0:	00 00 00 
+  803ec3:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  803ec5:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  803ecc:	7f 14                	jg     803ee2 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  803ece:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  803ed5:	48 85 c0             	test   %rax,%rax
+  803ed8:	75 06                	jne    803ee0 <vfprintf+0x6e>
+  803eda:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  803ee0:	c9                   	leave
+  803ee1:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  803ee2:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  803ee9:	48 b8 e1 3d 80 00 00 	movabs $0x803de1,%rax
+  803ef0:	00 00 00 
+  803ef3:	ff d0                	call   *%rax
+  803ef5:	eb d7                	jmp    803ece <vfprintf+0x5c>
+
+0000000000803ef7 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  803ef7:	55                   	push   %rbp
+  803ef8:	48 89 e5             	mov    %rsp,%rbp
+  803efb:	48 83 ec 50          	sub    $0x50,%rsp
+  803eff:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803f03:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803f07:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803f0b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803f0f:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803f16:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803f1a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803f1e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803f22:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  803f26:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803f2a:	48 b8 72 3e 80 00 00 	movabs $0x803e72,%rax
+  803f31:	00 00 00 
+  803f34:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803f36:	c9                   	leave
+  803f37:	c3                   	ret
+
+0000000000803f38 <printf>:
+
+int
+printf(const char *fmt, ...) {
+  803f38:	55                   	push   %rbp
+  803f39:	48 89 e5             	mov    %rsp,%rbp
+  803f3c:	48 83 ec 50          	sub    $0x50,%rsp
+  803f40:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803f44:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803f48:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803f4c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803f50:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803f54:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  803f5b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803f5f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803f63:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803f67:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  803f6b:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803f6f:	48 89 fe             	mov    %rdi,%rsi
+  803f72:	bf 01 00 00 00       	mov    $0x1,%edi
+  803f77:	48 b8 72 3e 80 00 00 	movabs $0x803e72,%rax
+  803f7e:	00 00 00 
+  803f81:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803f83:	c9                   	leave
+  803f84:	c3                   	ret
+
+0000000000803f85 <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803f85:	55                   	push   %rbp
+  803f86:	48 89 e5             	mov    %rsp,%rbp
+  803f89:	41 54                	push   %r12
+  803f8b:	53                   	push   %rbx
+  803f8c:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803f8f:	48 b8 f9 1c 80 00 00 	movabs $0x801cf9,%rax
+  803f96:	00 00 00 
+  803f99:	ff d0                	call   *%rax
+  803f9b:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803f9e:	48 be e0 54 80 00 00 	movabs $0x8054e0,%rsi
+  803fa5:	00 00 00 
+  803fa8:	48 89 df             	mov    %rbx,%rdi
+  803fab:	48 b8 df 0e 80 00 00 	movabs $0x800edf,%rax
+  803fb2:	00 00 00 
+  803fb5:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803fb7:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803fbc:	41 2b 04 24          	sub    (%r12),%eax
+  803fc0:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803fc6:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803fcd:	00 00 00 
+    stat->st_dev = &devpipe;
+  803fd0:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  803fd7:	00 00 00 
+  803fda:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803fe1:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fe6:	5b                   	pop    %rbx
+  803fe7:	41 5c                	pop    %r12
+  803fe9:	5d                   	pop    %rbp
+  803fea:	c3                   	ret
+
+0000000000803feb <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  803feb:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803fee:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  803ff4:	8b 17                	mov    (%rdi),%edx
+  803ff6:	85 d2                	test   %edx,%edx
+  803ff8:	75 01                	jne    803ffb <pipe_wakeup+0x10>
+  803ffa:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  803ffb:	55                   	push   %rbp
+  803ffc:	48 89 e5             	mov    %rsp,%rbp
+  803fff:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  804002:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  804008:	be 00 04 00 00       	mov    $0x400,%esi
+  80400d:	48 b8 40 1c 80 00 00 	movabs $0x801c40,%rax
+  804014:	00 00 00 
+  804017:	ff d0                	call   *%rax
+}
+  804019:	5d                   	pop    %rbp
+  80401a:	c3                   	ret
+
+000000000080401b <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80401b:	55                   	push   %rbp
+  80401c:	48 89 e5             	mov    %rsp,%rbp
+  80401f:	41 55                	push   %r13
+  804021:	41 54                	push   %r12
+  804023:	53                   	push   %rbx
+  804024:	48 83 ec 08          	sub    $0x8,%rsp
+  804028:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80402b:	48 b8 f9 1c 80 00 00 	movabs $0x801cf9,%rax
+  804032:	00 00 00 
+  804035:	ff d0                	call   *%rax
+  804037:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80403a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80403f:	4c 89 e6             	mov    %r12,%rsi
+  804042:	bf 00 00 00 00       	mov    $0x0,%edi
+  804047:	49 bc 5a 19 80 00 00 	movabs $0x80195a,%r12
+  80404e:	00 00 00 
+  804051:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  804054:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  804058:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  80405c:	49 bd eb 3f 80 00 00 	movabs $0x803feb,%r13
+  804063:	00 00 00 
+  804066:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  804069:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  80406d:	48 89 de             	mov    %rbx,%rsi
+  804070:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  804073:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804078:	48 89 de             	mov    %rbx,%rsi
+  80407b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804080:	41 ff d4             	call   *%r12
+  804083:	48 83 c4 08          	add    $0x8,%rsp
+  804087:	5b                   	pop    %rbx
+  804088:	41 5c                	pop    %r12
+  80408a:	41 5d                	pop    %r13
+  80408c:	5d                   	pop    %rbp
+  80408d:	c3                   	ret
+
+000000000080408e <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  80408e:	55                   	push   %rbp
+  80408f:	48 89 e5             	mov    %rsp,%rbp
+  804092:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804095:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80409a:	be 00 10 00 00       	mov    $0x1000,%esi
+  80409f:	48 b8 9d 18 80 00 00 	movabs $0x80189d,%rax
+  8040a6:	00 00 00 
+  8040a9:	ff d0                	call   *%rax
+  8040ab:	85 c0                	test   %eax,%eax
+  8040ad:	0f 94 c0             	sete   %al
+  8040b0:	0f b6 c0             	movzbl %al,%eax
+}
+  8040b3:	5d                   	pop    %rbp
+  8040b4:	c3                   	ret
+
+00000000008040b5 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8040b5:	55                   	push   %rbp
+  8040b6:	48 89 e5             	mov    %rsp,%rbp
+  8040b9:	41 57                	push   %r15
+  8040bb:	41 56                	push   %r14
+  8040bd:	41 55                	push   %r13
+  8040bf:	41 54                	push   %r12
+  8040c1:	53                   	push   %rbx
+  8040c2:	48 83 ec 38          	sub    $0x38,%rsp
+  8040c6:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8040ca:	49 89 f4             	mov    %rsi,%r12
+  8040cd:	49 89 d7             	mov    %rdx,%r15
+  8040d0:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8040d4:	48 b8 f9 1c 80 00 00 	movabs $0x801cf9,%rax
+  8040db:	00 00 00 
+  8040de:	ff d0                	call   *%rax
+  8040e0:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8040e3:	4d 85 ff             	test   %r15,%r15
+  8040e6:	0f 84 f1 00 00 00    	je     8041dd <devpipe_write+0x128>
+  8040ec:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  8040f0:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  8040f4:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  8040f8:	49 bd 8e 40 80 00 00 	movabs $0x80408e,%r13
+  8040ff:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  804102:	49 bf eb 3f 80 00 00 	movabs $0x803feb,%r15
+  804109:	00 00 00 
+  80410c:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  804110:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804114:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804118:	8b 73 04             	mov    0x4(%rbx),%esi
+  80411b:	48 63 ce             	movslq %esi,%rcx
+  80411e:	48 63 03             	movslq (%rbx),%rax
+  804121:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  804127:	48 39 c1             	cmp    %rax,%rcx
+  80412a:	72 64                	jb     804190 <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  80412c:	48 89 de             	mov    %rbx,%rsi
+  80412f:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  804133:	41 ff d5             	call   *%r13
+  804136:	85 c0                	test   %eax,%eax
+  804138:	0f 85 b9 00 00 00    	jne    8041f7 <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  80413e:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  804142:	4c 89 f7             	mov    %r14,%rdi
+  804145:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  804148:	8b 43 04             	mov    0x4(%rbx),%eax
+  80414b:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  804152:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  804159:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  80415f:	8b 03                	mov    (%rbx),%eax
+  804161:	41 39 c4             	cmp    %eax,%r12d
+  804164:	75 b2                	jne    804118 <devpipe_write+0x63>
+  804166:	48 89 de             	mov    %rbx,%rsi
+  804169:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80416d:	41 ff d5             	call   *%r13
+  804170:	85 c0                	test   %eax,%eax
+  804172:	75 a0                	jne    804114 <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  804174:	ba 0a 00 00 00       	mov    $0xa,%edx
+  804179:	44 89 e6             	mov    %r12d,%esi
+  80417c:	48 89 df             	mov    %rbx,%rdi
+  80417f:	48 b8 22 1c 80 00 00 	movabs $0x801c22,%rax
+  804186:	00 00 00 
+  804189:	ff d0                	call   *%rax
+  80418b:	e9 7c ff ff ff       	jmp    80410c <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  804190:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  804194:	41 0f b6 38          	movzbl (%r8),%edi
+  804198:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  80419f:	80 80 80 
+  8041a2:	48 89 c8             	mov    %rcx,%rax
+  8041a5:	48 f7 e2             	mul    %rdx
+  8041a8:	48 c1 ea 0b          	shr    $0xb,%rdx
+  8041ac:	48 89 d0             	mov    %rdx,%rax
+  8041af:	48 c1 e0 08          	shl    $0x8,%rax
+  8041b3:	48 29 d0             	sub    %rdx,%rax
+  8041b6:	48 c1 e0 04          	shl    $0x4,%rax
+  8041ba:	48 29 c1             	sub    %rax,%rcx
+  8041bd:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  8041c2:	83 c6 01             	add    $0x1,%esi
+  8041c5:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8041c8:	49 83 c0 01          	add    $0x1,%r8
+  8041cc:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  8041d0:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8041d4:	49 39 c0             	cmp    %rax,%r8
+  8041d7:	0f 85 2f ff ff ff    	jne    80410c <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8041dd:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  8041e1:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  8041e5:	48 b8 eb 3f 80 00 00 	movabs $0x803feb,%rax
+  8041ec:	00 00 00 
+  8041ef:	ff d0                	call   *%rax
+    return n;
+  8041f1:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8041f5:	eb 05                	jmp    8041fc <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  8041f7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8041fc:	48 83 c4 38          	add    $0x38,%rsp
+  804200:	5b                   	pop    %rbx
+  804201:	41 5c                	pop    %r12
+  804203:	41 5d                	pop    %r13
+  804205:	41 5e                	pop    %r14
+  804207:	41 5f                	pop    %r15
+  804209:	5d                   	pop    %rbp
+  80420a:	c3                   	ret
+
+000000000080420b <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80420b:	55                   	push   %rbp
+  80420c:	48 89 e5             	mov    %rsp,%rbp
+  80420f:	41 57                	push   %r15
+  804211:	41 56                	push   %r14
+  804213:	41 55                	push   %r13
+  804215:	41 54                	push   %r12
+  804217:	53                   	push   %rbx
+  804218:	48 83 ec 28          	sub    $0x28,%rsp
+  80421c:	49 89 fd             	mov    %rdi,%r13
+  80421f:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  804223:	49 89 d4             	mov    %rdx,%r12
+  804226:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80422a:	48 b8 f9 1c 80 00 00 	movabs $0x801cf9,%rax
+  804231:	00 00 00 
+  804234:	ff d0                	call   *%rax
+  804236:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  804239:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  80423f:	49 bf 8e 40 80 00 00 	movabs $0x80408e,%r15
+  804246:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  804249:	4d 85 e4             	test   %r12,%r12
+  80424c:	0f 84 d5 00 00 00    	je     804327 <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  804252:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  804256:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80425a:	8b 03                	mov    (%rbx),%eax
+  80425c:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80425f:	75 7a                	jne    8042db <devpipe_read+0xd0>
+            if (i > 0) {
+  804261:	4d 85 f6             	test   %r14,%r14
+  804264:	75 50                	jne    8042b6 <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  804266:	48 89 de             	mov    %rbx,%rsi
+  804269:	4c 89 ef             	mov    %r13,%rdi
+  80426c:	41 ff d7             	call   *%r15
+  80426f:	85 c0                	test   %eax,%eax
+  804271:	0f 85 c9 00 00 00    	jne    804340 <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  804277:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  80427a:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  804281:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  804287:	8b 43 04             	mov    0x4(%rbx),%eax
+  80428a:	41 39 c4             	cmp    %eax,%r12d
+  80428d:	75 cb                	jne    80425a <devpipe_read+0x4f>
+  80428f:	48 89 de             	mov    %rbx,%rsi
+  804292:	4c 89 ef             	mov    %r13,%rdi
+  804295:	41 ff d7             	call   *%r15
+  804298:	85 c0                	test   %eax,%eax
+  80429a:	75 be                	jne    80425a <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  80429c:	ba 0a 00 00 00       	mov    $0xa,%edx
+  8042a1:	44 89 e6             	mov    %r12d,%esi
+  8042a4:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8042a8:	48 b8 22 1c 80 00 00 	movabs $0x801c22,%rax
+  8042af:	00 00 00 
+  8042b2:	ff d0                	call   *%rax
+  8042b4:	eb a4                	jmp    80425a <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  8042b6:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  8042ba:	48 89 de             	mov    %rbx,%rsi
+  8042bd:	48 b8 eb 3f 80 00 00 	movabs $0x803feb,%rax
+  8042c4:	00 00 00 
+  8042c7:	ff d0                	call   *%rax
+                return i;
+  8042c9:	4c 89 f0             	mov    %r14,%rax
+}
+  8042cc:	48 83 c4 28          	add    $0x28,%rsp
+  8042d0:	5b                   	pop    %rbx
+  8042d1:	41 5c                	pop    %r12
+  8042d3:	41 5d                	pop    %r13
+  8042d5:	41 5e                	pop    %r14
+  8042d7:	41 5f                	pop    %r15
+  8042d9:	5d                   	pop    %rbp
+  8042da:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8042db:	48 63 c8             	movslq %eax,%rcx
+  8042de:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  8042e5:	80 80 80 
+  8042e8:	48 89 c8             	mov    %rcx,%rax
+  8042eb:	48 f7 e2             	mul    %rdx
+  8042ee:	48 c1 ea 0b          	shr    $0xb,%rdx
+  8042f2:	48 89 d0             	mov    %rdx,%rax
+  8042f5:	48 c1 e0 08          	shl    $0x8,%rax
+  8042f9:	48 29 d0             	sub    %rdx,%rax
+  8042fc:	48 c1 e0 04          	shl    $0x4,%rax
+  804300:	48 89 c2             	mov    %rax,%rdx
+  804303:	48 89 c8             	mov    %rcx,%rax
+  804306:	48 29 d0             	sub    %rdx,%rax
+  804309:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  80430e:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804312:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  804316:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  804319:	49 83 c6 01          	add    $0x1,%r14
+  80431d:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  804321:	0f 85 2b ff ff ff    	jne    804252 <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  804327:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  80432b:	48 89 de             	mov    %rbx,%rsi
+  80432e:	48 b8 eb 3f 80 00 00 	movabs $0x803feb,%rax
+  804335:	00 00 00 
+  804338:	ff d0                	call   *%rax
+    return n;
+  80433a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80433e:	eb 8c                	jmp    8042cc <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  804340:	b8 00 00 00 00       	mov    $0x0,%eax
+  804345:	eb 85                	jmp    8042cc <devpipe_read+0xc1>
+
+0000000000804347 <pipe>:
+pipe(int pfd[2]) {
+  804347:	55                   	push   %rbp
+  804348:	48 89 e5             	mov    %rsp,%rbp
+  80434b:	41 55                	push   %r13
+  80434d:	41 54                	push   %r12
+  80434f:	53                   	push   %rbx
+  804350:	48 83 ec 18          	sub    $0x18,%rsp
+  804354:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804357:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80435b:	48 b8 15 1d 80 00 00 	movabs $0x801d15,%rax
+  804362:	00 00 00 
+  804365:	ff d0                	call   *%rax
+  804367:	89 c3                	mov    %eax,%ebx
+  804369:	85 c0                	test   %eax,%eax
+  80436b:	0f 88 a0 01 00 00    	js     804511 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  804371:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804376:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80437b:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80437f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804384:	48 b8 b4 18 80 00 00 	movabs $0x8018b4,%rax
+  80438b:	00 00 00 
+  80438e:	ff d0                	call   *%rax
+  804390:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804392:	85 c0                	test   %eax,%eax
+  804394:	0f 88 77 01 00 00    	js     804511 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80439a:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  80439e:	48 b8 15 1d 80 00 00 	movabs $0x801d15,%rax
+  8043a5:	00 00 00 
+  8043a8:	ff d0                	call   *%rax
+  8043aa:	89 c3                	mov    %eax,%ebx
+  8043ac:	85 c0                	test   %eax,%eax
+  8043ae:	0f 88 43 01 00 00    	js     8044f7 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8043b4:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8043b9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8043be:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8043c2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043c7:	48 b8 b4 18 80 00 00 	movabs $0x8018b4,%rax
+  8043ce:	00 00 00 
+  8043d1:	ff d0                	call   *%rax
+  8043d3:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8043d5:	85 c0                	test   %eax,%eax
+  8043d7:	0f 88 1a 01 00 00    	js     8044f7 <pipe+0x1b0>
+    va = fd2data(fd0);
+  8043dd:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8043e1:	48 b8 f9 1c 80 00 00 	movabs $0x801cf9,%rax
+  8043e8:	00 00 00 
+  8043eb:	ff d0                	call   *%rax
+  8043ed:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8043f0:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8043f5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8043fa:	48 89 c6             	mov    %rax,%rsi
+  8043fd:	bf 00 00 00 00       	mov    $0x0,%edi
+  804402:	48 b8 b4 18 80 00 00 	movabs $0x8018b4,%rax
+  804409:	00 00 00 
+  80440c:	ff d0                	call   *%rax
+  80440e:	89 c3                	mov    %eax,%ebx
+  804410:	85 c0                	test   %eax,%eax
+  804412:	0f 88 c5 00 00 00    	js     8044dd <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  804418:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80441c:	48 b8 f9 1c 80 00 00 	movabs $0x801cf9,%rax
+  804423:	00 00 00 
+  804426:	ff d0                	call   *%rax
+  804428:	48 89 c1             	mov    %rax,%rcx
+  80442b:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  804431:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804437:	ba 00 00 00 00       	mov    $0x0,%edx
+  80443c:	4c 89 ee             	mov    %r13,%rsi
+  80443f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804444:	48 b8 0a 19 80 00 00 	movabs $0x80190a,%rax
+  80444b:	00 00 00 
+  80444e:	ff d0                	call   *%rax
+  804450:	89 c3                	mov    %eax,%ebx
+  804452:	85 c0                	test   %eax,%eax
+  804454:	78 6e                	js     8044c4 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804456:	be 00 10 00 00       	mov    $0x1000,%esi
+  80445b:	4c 89 ef             	mov    %r13,%rdi
+  80445e:	48 b8 79 18 80 00 00 	movabs $0x801879,%rax
+  804465:	00 00 00 
+  804468:	ff d0                	call   *%rax
+  80446a:	83 f8 02             	cmp    $0x2,%eax
+  80446d:	0f 85 ab 00 00 00    	jne    80451e <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  804473:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  80447a:	00 00 
+  80447c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804480:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  804482:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804486:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80448d:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804491:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  804493:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804497:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80449e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8044a2:	48 bb e7 1c 80 00 00 	movabs $0x801ce7,%rbx
+  8044a9:	00 00 00 
+  8044ac:	ff d3                	call   *%rbx
+  8044ae:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8044b2:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8044b6:	ff d3                	call   *%rbx
+  8044b8:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8044bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8044c2:	eb 4d                	jmp    804511 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8044c4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8044c9:	4c 89 ee             	mov    %r13,%rsi
+  8044cc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8044d1:	48 b8 5a 19 80 00 00 	movabs $0x80195a,%rax
+  8044d8:	00 00 00 
+  8044db:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8044dd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8044e2:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8044e6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8044eb:	48 b8 5a 19 80 00 00 	movabs $0x80195a,%rax
+  8044f2:	00 00 00 
+  8044f5:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8044f7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8044fc:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804500:	bf 00 00 00 00       	mov    $0x0,%edi
+  804505:	48 b8 5a 19 80 00 00 	movabs $0x80195a,%rax
+  80450c:	00 00 00 
+  80450f:	ff d0                	call   *%rax
+}
+  804511:	89 d8                	mov    %ebx,%eax
+  804513:	48 83 c4 18          	add    $0x18,%rsp
+  804517:	5b                   	pop    %rbx
+  804518:	41 5c                	pop    %r12
+  80451a:	41 5d                	pop    %r13
+  80451c:	5d                   	pop    %rbp
+  80451d:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80451e:	48 b9 10 55 80 00 00 	movabs $0x805510,%rcx
+  804525:	00 00 00 
+  804528:	48 ba e7 54 80 00 00 	movabs $0x8054e7,%rdx
+  80452f:	00 00 00 
+  804532:	be 50 00 00 00       	mov    $0x50,%esi
+  804537:	48 bf fc 54 80 00 00 	movabs $0x8054fc,%rdi
+  80453e:	00 00 00 
+  804541:	b8 00 00 00 00       	mov    $0x0,%eax
+  804546:	49 b8 6a 04 80 00 00 	movabs $0x80046a,%r8
+  80454d:	00 00 00 
+  804550:	41 ff d0             	call   *%r8
+
+0000000000804553 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  804553:	55                   	push   %rbp
+  804554:	48 89 e5             	mov    %rsp,%rbp
+  804557:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80455b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80455f:	48 b8 75 1d 80 00 00 	movabs $0x801d75,%rax
+  804566:	00 00 00 
+  804569:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80456b:	85 c0                	test   %eax,%eax
+  80456d:	78 23                	js     804592 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  80456f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804573:	48 b8 f9 1c 80 00 00 	movabs $0x801cf9,%rax
+  80457a:	00 00 00 
+  80457d:	ff d0                	call   *%rax
+  80457f:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  804582:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804586:	48 b8 8e 40 80 00 00 	movabs $0x80408e,%rax
+  80458d:	00 00 00 
+  804590:	ff d0                	call   *%rax
+}
+  804592:	c9                   	leave
+  804593:	c3                   	ret
+
+0000000000804594 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804594:	48 89 f8             	mov    %rdi,%rax
+  804597:	48 c1 e8 27          	shr    $0x27,%rax
+  80459b:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8045a2:	01 00 00 
+  8045a5:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8045a9:	f6 c2 01             	test   $0x1,%dl
+  8045ac:	74 6d                	je     80461b <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8045ae:	48 89 f8             	mov    %rdi,%rax
+  8045b1:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8045b5:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8045bc:	01 00 00 
+  8045bf:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8045c3:	f6 c2 01             	test   $0x1,%dl
+  8045c6:	74 62                	je     80462a <get_uvpt_entry+0x96>
+  8045c8:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8045cf:	01 00 00 
+  8045d2:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8045d6:	f6 c2 80             	test   $0x80,%dl
+  8045d9:	75 4f                	jne    80462a <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8045db:	48 89 f8             	mov    %rdi,%rax
+  8045de:	48 c1 e8 15          	shr    $0x15,%rax
+  8045e2:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8045e9:	01 00 00 
+  8045ec:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8045f0:	f6 c2 01             	test   $0x1,%dl
+  8045f3:	74 44                	je     804639 <get_uvpt_entry+0xa5>
+  8045f5:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8045fc:	01 00 00 
+  8045ff:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804603:	f6 c2 80             	test   $0x80,%dl
+  804606:	75 31                	jne    804639 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  804608:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80460c:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804613:	01 00 00 
+  804616:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80461a:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80461b:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804622:	01 00 00 
+  804625:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804629:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80462a:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804631:	01 00 00 
+  804634:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804638:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804639:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804640:	01 00 00 
+  804643:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804647:	c3                   	ret
+
+0000000000804648 <get_prot>:
+
+int
+get_prot(void *va) {
+  804648:	55                   	push   %rbp
+  804649:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80464c:	48 b8 94 45 80 00 00 	movabs $0x804594,%rax
+  804653:	00 00 00 
+  804656:	ff d0                	call   *%rax
+  804658:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  80465b:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  804660:	89 c1                	mov    %eax,%ecx
+  804662:	83 c9 04             	or     $0x4,%ecx
+  804665:	f6 c2 01             	test   $0x1,%dl
+  804668:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  80466b:	89 c1                	mov    %eax,%ecx
+  80466d:	83 c9 02             	or     $0x2,%ecx
+  804670:	f6 c2 02             	test   $0x2,%dl
+  804673:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  804676:	89 c1                	mov    %eax,%ecx
+  804678:	83 c9 01             	or     $0x1,%ecx
+  80467b:	48 85 d2             	test   %rdx,%rdx
+  80467e:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804681:	89 c1                	mov    %eax,%ecx
+  804683:	83 c9 40             	or     $0x40,%ecx
+  804686:	f6 c6 04             	test   $0x4,%dh
+  804689:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80468c:	5d                   	pop    %rbp
+  80468d:	c3                   	ret
+
+000000000080468e <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80468e:	55                   	push   %rbp
+  80468f:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804692:	48 b8 94 45 80 00 00 	movabs $0x804594,%rax
+  804699:	00 00 00 
+  80469c:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  80469e:	48 c1 e8 06          	shr    $0x6,%rax
+  8046a2:	83 e0 01             	and    $0x1,%eax
+}
+  8046a5:	5d                   	pop    %rbp
+  8046a6:	c3                   	ret
+
+00000000008046a7 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8046a7:	55                   	push   %rbp
+  8046a8:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8046ab:	48 b8 94 45 80 00 00 	movabs $0x804594,%rax
+  8046b2:	00 00 00 
+  8046b5:	ff d0                	call   *%rax
+  8046b7:	83 e0 01             	and    $0x1,%eax
+}
+  8046ba:	5d                   	pop    %rbp
+  8046bb:	c3                   	ret
+
+00000000008046bc <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  8046bc:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  8046c3:	01 00 00 
+  8046c6:	a8 01                	test   $0x1,%al
+  8046c8:	75 06                	jne    8046d0 <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  8046ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046cf:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8046d0:	55                   	push   %rbp
+  8046d1:	48 89 e5             	mov    %rsp,%rbp
+  8046d4:	41 57                	push   %r15
+  8046d6:	41 56                	push   %r14
+  8046d8:	41 55                	push   %r13
+  8046da:	41 54                	push   %r12
+  8046dc:	53                   	push   %rbx
+  8046dd:	48 83 ec 28          	sub    $0x28,%rsp
+  8046e1:	49 89 fe             	mov    %rdi,%r14
+  8046e4:	49 89 f7             	mov    %rsi,%r15
+  8046e7:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  8046ee:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  8046ef:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  8046f6:	01 00 00 
+  8046f9:	e9 ae 00 00 00       	jmp    8047ac <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  8046fe:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804705:	49 83 ec 01          	sub    $0x1,%r12
+  804709:	74 2d                	je     804738 <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  80470b:	48 89 d8             	mov    %rbx,%rax
+  80470e:	48 c1 e8 0c          	shr    $0xc,%rax
+  804712:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  804717:	f6 c2 01             	test   $0x1,%dl
+  80471a:	74 e2                	je     8046fe <foreach_shared_region+0x42>
+  80471c:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  804721:	f6 c4 04             	test   $0x4,%ah
+  804724:	74 d8                	je     8046fe <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  804726:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  80472d:	4c 89 fa             	mov    %r15,%rdx
+  804730:	48 89 df             	mov    %rbx,%rdi
+  804733:	41 ff d6             	call   *%r14
+  804736:	eb c6                	jmp    8046fe <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  804738:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  80473f:	00 
+  804740:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  804745:	74 4a                	je     804791 <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  804747:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80474b:	48 c1 e8 15          	shr    $0x15,%rax
+  80474f:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  804756:	01 00 00 
+  804759:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  80475d:	a8 01                	test   $0x1,%al
+  80475f:	74 d7                	je     804738 <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  804761:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  804765:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  80476c:	48 39 c3             	cmp    %rax,%rbx
+  80476f:	73 c7                	jae    804738 <foreach_shared_region+0x7c>
+  804771:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  804778:	48 39 d0             	cmp    %rdx,%rax
+  80477b:	4d 19 e4             	sbb    %r12,%r12
+  80477e:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  804785:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  80478c:	e9 7a ff ff ff       	jmp    80470b <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  804791:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  804798:	40 
+  804799:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80479d:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8047a4:	00 00 00 
+  8047a7:	48 39 c1             	cmp    %rax,%rcx
+  8047aa:	74 50                	je     8047fc <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  8047ac:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8047b0:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8047b4:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  8047bb:	01 00 00 
+  8047be:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  8047c2:	a8 01                	test   $0x1,%al
+  8047c4:	74 cb                	je     804791 <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  8047c6:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8047ca:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  8047d1:	48 39 c1             	cmp    %rax,%rcx
+  8047d4:	73 bb                	jae    804791 <foreach_shared_region+0xd5>
+  8047d6:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  8047dd:	48 39 d0             	cmp    %rdx,%rax
+  8047e0:	48 19 c0             	sbb    %rax,%rax
+  8047e3:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  8047e9:	48 05 00 02 00 00    	add    $0x200,%rax
+  8047ef:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8047f3:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8047f7:	e9 4b ff ff ff       	jmp    804747 <foreach_shared_region+0x8b>
+  8047fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  804801:	48 83 c4 28          	add    $0x28,%rsp
+  804805:	5b                   	pop    %rbx
+  804806:	41 5c                	pop    %r12
+  804808:	41 5d                	pop    %r13
+  80480a:	41 5e                	pop    %r14
+  80480c:	41 5f                	pop    %r15
+  80480e:	5d                   	pop    %rbp
+  80480f:	c3                   	ret
+
+0000000000804810 <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  804810:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  804816:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  80481d:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  804824:	c3                   	ret
+
+0000000000804825 <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  804825:	8b 47 40             	mov    0x40(%rdi),%eax
+  804828:	8b 17                	mov    (%rdi),%edx
+  80482a:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  80482c:	83 f8 0f             	cmp    $0xf,%eax
+  80482f:	77 13                	ja     804844 <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  804831:	8b 47 40             	mov    0x40(%rdi),%eax
+  804834:	83 e0 0f             	and    $0xf,%eax
+  804837:	48 c1 e0 09          	shl    $0x9,%rax
+  80483b:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  804842:	00 
+  804843:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  804844:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804849:	c3                   	ret
+
+000000000080484a <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  80484a:	8b 47 40             	mov    0x40(%rdi),%eax
+  80484d:	83 c0 01             	add    $0x1,%eax
+  804850:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  804853:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  804859:	8b 57 04             	mov    0x4(%rdi),%edx
+  80485c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804861:	85 d2                	test   %edx,%edx
+  804863:	75 04                	jne    804869 <chan_publish+0x1f>
+  804865:	83 e0 01             	and    $0x1,%eax
+}
+  804868:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  804869:	87 47 04             	xchg   %eax,0x4(%rdi)
+  80486c:	85 c0                	test   %eax,%eax
+  80486e:	0f 95 c0             	setne  %al
+  804871:	0f b6 c0             	movzbl %al,%eax
+  804874:	eb ef                	jmp    804865 <chan_publish+0x1b>
+
+0000000000804876 <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  804876:	8b 47 40             	mov    0x40(%rdi),%eax
+  804879:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  80487b:	29 d0                	sub    %edx,%eax
+  80487d:	83 e8 01             	sub    $0x1,%eax
+  804880:	83 f8 0f             	cmp    $0xf,%eax
+  804883:	77 12                	ja     804897 <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  804885:	8b 07                	mov    (%rdi),%eax
+  804887:	83 e0 0f             	and    $0xf,%eax
+  80488a:	48 c1 e0 09          	shl    $0x9,%rax
+  80488e:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  804895:	00 
+  804896:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  804897:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80489c:	c3                   	ret
+
+000000000080489d <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  80489d:	8b 07                	mov    (%rdi),%eax
+  80489f:	83 c0 01             	add    $0x1,%eax
+  8048a2:	89 07                	mov    %eax,(%rdi)
+}
+  8048a4:	c3                   	ret
+
+00000000008048a5 <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  8048a5:	55                   	push   %rbp
+  8048a6:	48 89 e5             	mov    %rsp,%rbp
+  8048a9:	53                   	push   %rbx
+  8048aa:	48 83 ec 08          	sub    $0x8,%rsp
+  8048ae:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  8048b1:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8048b8:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  8048be:	48 b8 76 48 80 00 00 	movabs $0x804876,%rax
+  8048c5:	00 00 00 
+  8048c8:	ff d0                	call   *%rax
+  8048ca:	48 85 c0             	test   %rax,%rax
+  8048cd:	74 12                	je     8048e1 <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  8048cf:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  8048d6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8048db:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8048df:	c9                   	leave
+  8048e0:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  8048e1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8048e6:	eb f3                	jmp    8048db <chan_arm+0x36>
+
+00000000008048e8 <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  8048e8:	55                   	push   %rbp
+  8048e9:	48 89 e5             	mov    %rsp,%rbp
+  8048ec:	41 56                	push   %r14
+  8048ee:	41 55                	push   %r13
+  8048f0:	41 54                	push   %r12
+  8048f2:	53                   	push   %rbx
+  8048f3:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  8048f6:	49 bc a5 48 80 00 00 	movabs $0x8048a5,%r12
+  8048fd:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  804900:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  804904:	49 bd 22 1c 80 00 00 	movabs $0x801c22,%r13
+  80490b:	00 00 00 
+    while (chan_arm(r))
+  80490e:	eb 0d                	jmp    80491d <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  804910:	8b 33                	mov    (%rbx),%esi
+  804912:	ba 00 00 00 00       	mov    $0x0,%edx
+  804917:	4c 89 f7             	mov    %r14,%rdi
+  80491a:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  80491d:	48 89 df             	mov    %rbx,%rdi
+  804920:	41 ff d4             	call   *%r12
+  804923:	84 c0                	test   %al,%al
+  804925:	75 e9                	jne    804910 <chan_wait+0x28>
+}
+  804927:	5b                   	pop    %rbx
+  804928:	41 5c                	pop    %r12
+  80492a:	41 5d                	pop    %r13
+  80492c:	41 5e                	pop    %r14
+  80492e:	5d                   	pop    %rbp
+  80492f:	c3                   	ret
+
+0000000000804930 <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  804930:	55                   	push   %rbp
+  804931:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  804934:	48 83 c7 40          	add    $0x40,%rdi
+  804938:	be 01 00 00 00       	mov    $0x1,%esi
+  80493d:	48 b8 40 1c 80 00 00 	movabs $0x801c40,%rax
+  804944:	00 00 00 
+  804947:	ff d0                	call   *%rax
+}
+  804949:	5d                   	pop    %rbp
+  80494a:	c3                   	ret
+
+000000000080494b <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  80494b:	55                   	push   %rbp
+  80494c:	48 89 e5             	mov    %rsp,%rbp
+  80494f:	41 56                	push   %r14
+  804951:	41 55                	push   %r13
+  804953:	41 54                	push   %r12
+  804955:	53                   	push   %rbx
+  804956:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804959:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  804960:	00 00 00 
+  804963:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804967:	74 27                	je     804990 <_handle_vectored_pagefault+0x45>
+  804969:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  80496e:	49 bd 00 10 84 00 00 	movabs $0x841000,%r13
+  804975:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804978:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  80497b:	4c 89 e7             	mov    %r12,%rdi
+  80497e:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  804983:	84 c0                	test   %al,%al
+  804985:	75 45                	jne    8049cc <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804987:	48 83 c3 01          	add    $0x1,%rbx
+  80498b:	49 3b 1e             	cmp    (%r14),%rbx
+  80498e:	72 eb                	jb     80497b <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  804990:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  804997:	00 
+  804998:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  80499d:	4d 8b 04 24          	mov    (%r12),%r8
+  8049a1:	48 ba 38 55 80 00 00 	movabs $0x805538,%rdx
+  8049a8:	00 00 00 
+  8049ab:	be 1d 00 00 00       	mov    $0x1d,%esi
+  8049b0:	48 bf 68 55 80 00 00 	movabs $0x805568,%rdi
+  8049b7:	00 00 00 
+  8049ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049bf:	49 ba 6a 04 80 00 00 	movabs $0x80046a,%r10
+  8049c6:	00 00 00 
+  8049c9:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  8049cc:	5b                   	pop    %rbx
+  8049cd:	41 5c                	pop    %r12
+  8049cf:	41 5d                	pop    %r13
+  8049d1:	41 5e                	pop    %r14
+  8049d3:	5d                   	pop    %rbp
+  8049d4:	c3                   	ret
+
+00000000008049d5 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  8049d5:	55                   	push   %rbp
+  8049d6:	48 89 e5             	mov    %rsp,%rbp
+  8049d9:	53                   	push   %rbx
+  8049da:	48 83 ec 08          	sub    $0x8,%rsp
+  8049de:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  8049e1:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8049e8:	00 00 00 
+  8049eb:	80 38 00             	cmpb   $0x0,(%rax)
+  8049ee:	0f 84 84 00 00 00    	je     804a78 <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8049f4:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  8049fb:	00 00 00 
+  8049fe:	48 8b 10             	mov    (%rax),%rdx
+  804a01:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  804a06:	48 b9 00 10 84 00 00 	movabs $0x841000,%rcx
+  804a0d:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804a10:	48 85 d2             	test   %rdx,%rdx
+  804a13:	74 19                	je     804a2e <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  804a15:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  804a19:	0f 84 e8 00 00 00    	je     804b07 <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804a1f:	48 83 c0 01          	add    $0x1,%rax
+  804a23:	48 39 d0             	cmp    %rdx,%rax
+  804a26:	75 ed                	jne    804a15 <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  804a28:	48 83 fa 08          	cmp    $0x8,%rdx
+  804a2c:	74 1c                	je     804a4a <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  804a2e:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  804a32:	48 a3 48 10 84 00 00 	movabs %rax,0x841048
+  804a39:	00 00 00 
+  804a3c:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  804a43:	00 00 00 
+  804a46:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  804a4a:	48 b8 27 18 80 00 00 	movabs $0x801827,%rax
+  804a51:	00 00 00 
+  804a54:	ff d0                	call   *%rax
+  804a56:	89 c7                	mov    %eax,%edi
+  804a58:	48 be cd 4b 80 00 00 	movabs $0x804bcd,%rsi
+  804a5f:	00 00 00 
+  804a62:	48 b8 72 1a 80 00 00 	movabs $0x801a72,%rax
+  804a69:	00 00 00 
+  804a6c:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  804a6e:	85 c0                	test   %eax,%eax
+  804a70:	78 68                	js     804ada <add_pgfault_handler+0x105>
+    return res;
+}
+  804a72:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804a76:	c9                   	leave
+  804a77:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  804a78:	48 b8 27 18 80 00 00 	movabs $0x801827,%rax
+  804a7f:	00 00 00 
+  804a82:	ff d0                	call   *%rax
+  804a84:	89 c7                	mov    %eax,%edi
+  804a86:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804a8b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804a90:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  804a97:	00 00 00 
+  804a9a:	48 b8 b4 18 80 00 00 	movabs $0x8018b4,%rax
+  804aa1:	00 00 00 
+  804aa4:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  804aa6:	48 ba 48 10 84 00 00 	movabs $0x841048,%rdx
+  804aad:	00 00 00 
+  804ab0:	48 8b 02             	mov    (%rdx),%rax
+  804ab3:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804ab7:	48 89 0a             	mov    %rcx,(%rdx)
+  804aba:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  804ac1:	00 00 00 
+  804ac4:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  804ac8:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  804acf:	00 00 00 
+  804ad2:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  804ad5:	e9 70 ff ff ff       	jmp    804a4a <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  804ada:	89 c1                	mov    %eax,%ecx
+  804adc:	48 ba 76 55 80 00 00 	movabs $0x805576,%rdx
+  804ae3:	00 00 00 
+  804ae6:	be 3d 00 00 00       	mov    $0x3d,%esi
+  804aeb:	48 bf 68 55 80 00 00 	movabs $0x805568,%rdi
+  804af2:	00 00 00 
+  804af5:	b8 00 00 00 00       	mov    $0x0,%eax
+  804afa:	49 b8 6a 04 80 00 00 	movabs $0x80046a,%r8
+  804b01:	00 00 00 
+  804b04:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  804b07:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b0c:	e9 61 ff ff ff       	jmp    804a72 <add_pgfault_handler+0x9d>
+
+0000000000804b11 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  804b11:	55                   	push   %rbp
+  804b12:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  804b15:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  804b1c:	00 00 00 
+  804b1f:	80 38 00             	cmpb   $0x0,(%rax)
+  804b22:	74 33                	je     804b57 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804b24:	48 a1 48 10 84 00 00 	movabs 0x841048,%rax
+  804b2b:	00 00 00 
+  804b2e:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  804b33:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  804b3a:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804b3d:	48 85 c0             	test   %rax,%rax
+  804b40:	0f 84 85 00 00 00    	je     804bcb <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  804b46:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  804b4a:	74 40                	je     804b8c <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804b4c:	48 83 c1 01          	add    $0x1,%rcx
+  804b50:	48 39 c1             	cmp    %rax,%rcx
+  804b53:	75 f1                	jne    804b46 <remove_pgfault_handler+0x35>
+  804b55:	eb 74                	jmp    804bcb <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  804b57:	48 b9 8e 55 80 00 00 	movabs $0x80558e,%rcx
+  804b5e:	00 00 00 
+  804b61:	48 ba e7 54 80 00 00 	movabs $0x8054e7,%rdx
+  804b68:	00 00 00 
+  804b6b:	be 43 00 00 00       	mov    $0x43,%esi
+  804b70:	48 bf 68 55 80 00 00 	movabs $0x805568,%rdi
+  804b77:	00 00 00 
+  804b7a:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b7f:	49 b8 6a 04 80 00 00 	movabs $0x80046a,%r8
+  804b86:	00 00 00 
+  804b89:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  804b8c:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  804b93:	00 
+  804b94:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804b98:	48 29 ca             	sub    %rcx,%rdx
+  804b9b:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  804ba2:	00 00 00 
+  804ba5:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  804ba9:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  804bae:	48 89 ce             	mov    %rcx,%rsi
+  804bb1:	48 b8 d9 10 80 00 00 	movabs $0x8010d9,%rax
+  804bb8:	00 00 00 
+  804bbb:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  804bbd:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  804bc4:	00 00 00 
+  804bc7:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  804bcb:	5d                   	pop    %rbp
+  804bcc:	c3                   	ret
+
+0000000000804bcd <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  804bcd:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  804bd0:	48 b8 4b 49 80 00 00 	movabs $0x80494b,%rax
+  804bd7:	00 00 00 
+    call *%rax
+  804bda:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  804bdc:	41 5f                	pop    %r15
+	popq %r15
+  804bde:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  804be0:	41 5f                	pop    %r15
+	popq %r14
+  804be2:	41 5e                	pop    %r14
+	popq %r13
+  804be4:	41 5d                	pop    %r13
+	popq %r12
+  804be6:	41 5c                	pop    %r12
+	popq %r11
+  804be8:	41 5b                	pop    %r11
+	popq %r10
+  804bea:	41 5a                	pop    %r10
+	popq %r9
+  804bec:	41 59                	pop    %r9
+	popq %r8
+  804bee:	41 58                	pop    %r8
+	popq %rsi
+  804bf0:	5e                   	pop    %rsi
+	popq %rdi
+  804bf1:	5f                   	pop    %rdi
+	popq %rbp
+  804bf2:	5d                   	pop    %rbp
+	popq %rdx
+  804bf3:	5a                   	pop    %rdx
+	popq %rcx
+  804bf4:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  804bf5:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  804bfa:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  804bff:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  804c03:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  804c06:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  804c0b:	5b                   	pop    %rbx
+	popq %rax
+  804c0c:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  804c0d:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  804c11:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  804c12:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  804c17:	c3                   	ret
+
+0000000000804c18 <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  804c18:	55                   	push   %rbp
+  804c19:	48 89 e5             	mov    %rsp,%rbp
+  804c1c:	41 55                	push   %r13
+  804c1e:	41 54                	push   %r12
+  804c20:	53                   	push   %rbx
+  804c21:	48 83 ec 08          	sub    $0x8,%rsp
+  804c25:	49 89 fd             	mov    %rdi,%r13
+  804c28:	48 89 f7             	mov    %rsi,%rdi
+  804c2b:	48 89 d3             	mov    %rdx,%rbx
+  804c2e:	49 89 cc             	mov    %rcx,%r12
+  804c31:	4c 89 c2             	mov    %r8,%rdx
+  804c34:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804c37:	48 85 f6             	test   %rsi,%rsi
+  804c3a:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804c41:	00 00 00 
+  804c44:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  804c48:	be 00 10 00 00       	mov    $0x1000,%esi
+  804c4d:	48 85 db             	test   %rbx,%rbx
+  804c50:	74 03                	je     804c55 <ipc_recv_futex+0x3d>
+  804c52:	48 8b 33             	mov    (%rbx),%rsi
+  804c55:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  804c59:	48 b8 fe 1a 80 00 00 	movabs $0x801afe,%rax
+  804c60:	00 00 00 
+  804c63:	ff d0                	call   *%rax
+    if (res < 0) {
+  804c65:	85 c0                	test   %eax,%eax
+  804c67:	78 75                	js     804cde <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  804c69:	4d 85 ed             	test   %r13,%r13
+  804c6c:	74 14                	je     804c82 <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  804c6e:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804c75:	00 00 00 
+  804c78:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  804c7e:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  804c82:	4d 85 e4             	test   %r12,%r12
+  804c85:	74 14                	je     804c9b <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  804c87:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804c8e:	00 00 00 
+  804c91:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  804c97:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  804c9b:	48 85 db             	test   %rbx,%rbx
+  804c9e:	74 23                	je     804cc3 <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804ca0:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804ca7:	00 00 00 
+  804caa:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  804cb0:	ba 00 00 00 00       	mov    $0x0,%edx
+  804cb5:	85 c9                	test   %ecx,%ecx
+  804cb7:	74 07                	je     804cc0 <ipc_recv_futex+0xa8>
+  804cb9:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  804cc0:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  804cc3:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804cca:	00 00 00 
+  804ccd:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  804cd3:	48 83 c4 08          	add    $0x8,%rsp
+  804cd7:	5b                   	pop    %rbx
+  804cd8:	41 5c                	pop    %r12
+  804cda:	41 5d                	pop    %r13
+  804cdc:	5d                   	pop    %rbp
+  804cdd:	c3                   	ret
+        if (from_env_store != NULL) {
+  804cde:	4d 85 ed             	test   %r13,%r13
+  804ce1:	74 08                	je     804ceb <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  804ce3:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804cea:	00 
+        if (perm_store != NULL) {
+  804ceb:	4d 85 e4             	test   %r12,%r12
+  804cee:	74 08                	je     804cf8 <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  804cf0:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804cf7:	00 
+        if (size != NULL) {
+  804cf8:	48 85 db             	test   %rbx,%rbx
+  804cfb:	74 d6                	je     804cd3 <ipc_recv_futex+0xbb>
+            *size = 0;
+  804cfd:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  804d04:	eb cd                	jmp    804cd3 <ipc_recv_futex+0xbb>
+
+0000000000804d06 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804d06:	55                   	push   %rbp
+  804d07:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  804d0a:	48 83 ec 08          	sub    $0x8,%rsp
+  804d0e:	6a 00                	push   $0x0
+  804d10:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804d16:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804d1c:	48 b8 18 4c 80 00 00 	movabs $0x804c18,%rax
+  804d23:	00 00 00 
+  804d26:	ff d0                	call   *%rax
+}
+  804d28:	c9                   	leave
+  804d29:	c3                   	ret
+
+0000000000804d2a <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  804d2a:	55                   	push   %rbp
+  804d2b:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804d2e:	48 85 d2             	test   %rdx,%rdx
+  804d31:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804d38:	00 00 00 
+  804d3b:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  804d3f:	89 f6                	mov    %esi,%esi
+  804d41:	48 b8 e7 1a 80 00 00 	movabs $0x801ae7,%rax
+  804d48:	00 00 00 
+  804d4b:	ff d0                	call   *%rax
+    if (res < 0) {
+  804d4d:	85 c0                	test   %eax,%eax
+  804d4f:	78 02                	js     804d53 <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  804d51:	5d                   	pop    %rbp
+  804d52:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  804d53:	89 c1                	mov    %eax,%ecx
+  804d55:	48 ba a8 55 80 00 00 	movabs $0x8055a8,%rdx
+  804d5c:	00 00 00 
+  804d5f:	be 50 00 00 00       	mov    $0x50,%esi
+  804d64:	48 bf bc 55 80 00 00 	movabs $0x8055bc,%rdi
+  804d6b:	00 00 00 
+  804d6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d73:	49 b8 6a 04 80 00 00 	movabs $0x80046a,%r8
+  804d7a:	00 00 00 
+  804d7d:	41 ff d0             	call   *%r8
+
+0000000000804d80 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804d80:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  804d85:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804d8c:	00 00 00 
+  804d8f:	48 89 d0             	mov    %rdx,%rax
+  804d92:	48 c1 e0 04          	shl    $0x4,%rax
+  804d96:	48 29 d0             	sub    %rdx,%rax
+  804d99:	48 c1 e0 05          	shl    $0x5,%rax
+  804d9d:	48 01 c8             	add    %rcx,%rax
+  804da0:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  804da6:	39 f8                	cmp    %edi,%eax
+  804da8:	74 13                	je     804dbd <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  804daa:	48 83 c2 01          	add    $0x1,%rdx
+  804dae:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  804db5:	75 d8                	jne    804d8f <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804db7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804dbc:	c3                   	ret
+            return envs[i].env_id;
+  804dbd:	48 89 d0             	mov    %rdx,%rax
+  804dc0:	48 c1 e0 04          	shl    $0x4,%rax
+  804dc4:	48 29 d0             	sub    %rdx,%rax
+  804dc7:	48 c1 e0 05          	shl    $0x5,%rax
+  804dcb:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804dd2:	00 00 00 
+  804dd5:	48 01 d0             	add    %rdx,%rax
+  804dd8:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804dde:	c3                   	ret
+  804ddf:	90                   	nop
+
+0000000000804de0 <__rodata_start>:
+  804de0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804de1:	70 65                	jo     804e48 <__rodata_start+0x68>
+  804de3:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804de4:	63 6f 6e             	movsxd 0x6e(%rdi),%ebp
+  804de7:	73 3a                	jae    804e23 <__rodata_start+0x43>
+  804de9:	20 25 69 00 75 73    	and    %ah,0x73750069(%rip)        # 73f54e58 <__bss_end+0x73712e58>
+  804def:	65 72 2f             	gs jb  804e21 <__rodata_start+0x41>
+  804df2:	74 65                	je     804e59 <__rodata_start+0x79>
+  804df4:	73 74                	jae    804e6a <__rodata_start+0x8a>
+  804df6:	6b 62 64 2e          	imul   $0x2e,0x64(%rdx),%esp
+  804dfa:	63 00                	movsxd (%rax),%eax
+  804dfc:	66 69 72 73 74 20    	imul   $0x2074,0x73(%rdx),%si
+  804e02:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804e03:	70 65                	jo     804e6a <__rodata_start+0x8a>
+  804e05:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804e06:	63 6f 6e             	movsxd 0x6e(%rdi),%ebp
+  804e09:	73 20                	jae    804e2b <__rodata_start+0x4b>
+  804e0b:	75 73                	jne    804e80 <__rodata_start+0xa0>
+  804e0d:	65 64 20 66 64       	gs and %ah,%fs:0x64(%rsi)
+  804e12:	20 25 64 00 64 75    	and    %ah,0x75640064(%rip)        # 75e44e7c <__bss_end+0x75602e7c>
+  804e18:	70 3a                	jo     804e54 <__rodata_start+0x74>
+  804e1a:	20 25 69 00 54 79    	and    %ah,0x79540069(%rip)        # 79d44e89 <__bss_end+0x79502e89>
+  804e20:	70 65                	jo     804e87 <__rodata_start+0xa7>
+  804e22:	20 61 20             	and    %ah,0x20(%rcx)
+  804e25:	6c                   	insb   (%dx),%es:(%rdi)
+  804e26:	69 6e 65 3a 20 00 25 	imul   $0x2500203a,0x65(%rsi),%ebp
+  804e2d:	73 0a                	jae    804e39 <__rodata_start+0x59>
+  804e2f:	00 28                	add    %ch,(%rax)
+  804e31:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804e33:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  804e37:	20 66 69             	and    %ah,0x69(%rsi)
+  804e3a:	6c                   	insb   (%dx),%es:(%rdi)
+  804e3b:	65 20 72 65          	and    %dh,%gs:0x65(%rdx)
+  804e3f:	63 65 69             	movsxd 0x69(%rbp),%esp
+  804e42:	76 65                	jbe    804ea9 <__rodata_start+0xc9>
+  804e44:	64 29 0a             	sub    %ecx,%fs:(%rdx)
+  804e47:	00 3c 63             	add    %bh,(%rbx,%riz,2)
+  804e4a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804e4b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804e4c:	73 3e                	jae    804e8c <__rodata_start+0xac>
+  804e4e:	00 63 6f             	add    %ah,0x6f(%rbx)
+  804e51:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804e52:	73 00                	jae    804e54 <__rodata_start+0x74>
+  804e54:	3c 75                	cmp    $0x75,%al
+  804e56:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804e57:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  804e5b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804e5c:	3e 00 66 90          	ds add %ah,-0x70(%rsi)
+  804e60:	5b                   	pop    %rbx
+  804e61:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  804e66:	20 75 73             	and    %dh,0x73(%rbp)
+  804e69:	65 72 20             	gs jb  804e8c <__rodata_start+0xac>
+  804e6c:	70 61                	jo     804ecf <__rodata_start+0xef>
+  804e6e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804e6f:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  804e76:	73 20                	jae    804e98 <__rodata_start+0xb8>
+  804e78:	61                   	(bad)
+  804e79:	74 20                	je     804e9b <__rodata_start+0xbb>
+  804e7b:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  804e80:	3a 20                	cmp    (%rax),%ah
+  804e82:	00 30                	add    %dh,(%rax)
+  804e84:	31 32                	xor    %esi,(%rdx)
+  804e86:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  804e8d:	41                   	rex.B
+  804e8e:	42                   	rex.X
+  804e8f:	43                   	rex.XB
+  804e90:	44                   	rex.R
+  804e91:	45                   	rex.RB
+  804e92:	46 00 30             	rex.RX add %r14b,(%rax)
+  804e95:	31 32                	xor    %esi,(%rdx)
+  804e97:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  804e9e:	61                   	(bad)
+  804e9f:	62 63 64 65 66       	(bad)
+  804ea4:	00 28                	add    %ch,(%rax)
+  804ea6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804ea7:	75 6c                	jne    804f15 <__rodata_start+0x135>
+  804ea9:	6c                   	insb   (%dx),%es:(%rdi)
+  804eaa:	29 00                	sub    %eax,(%rax)
+  804eac:	65 72 72             	gs jb  804f21 <__rodata_start+0x141>
+  804eaf:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804eb0:	72 20                	jb     804ed2 <__rodata_start+0xf2>
+  804eb2:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  804eb7:	73 70                	jae    804f29 <__rodata_start+0x149>
+  804eb9:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  804ebd:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  804ec4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804ec5:	72 00                	jb     804ec7 <__rodata_start+0xe7>
+  804ec7:	62 61 64 20 65       	(bad)
+  804ecc:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804ecd:	76 69                	jbe    804f38 <__rodata_start+0x158>
+  804ecf:	72 6f                	jb     804f40 <__rodata_start+0x160>
+  804ed1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804ed2:	6d                   	insl   (%dx),%es:(%rdi)
+  804ed3:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804ed5:	74 00                	je     804ed7 <__rodata_start+0xf7>
+  804ed7:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  804ede:	20 70 61             	and    %dh,0x61(%rax)
+  804ee1:	72 61                	jb     804f44 <__rodata_start+0x164>
+  804ee3:	6d                   	insl   (%dx),%es:(%rdi)
+  804ee4:	65 74 65             	gs je  804f4c <__rodata_start+0x16c>
+  804ee7:	72 00                	jb     804ee9 <__rodata_start+0x109>
+  804ee9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804eea:	75 74                	jne    804f60 <__rodata_start+0x180>
+  804eec:	20 6f 66             	and    %ch,0x66(%rdi)
+  804eef:	20 6d 65             	and    %ch,0x65(%rbp)
+  804ef2:	6d                   	insl   (%dx),%es:(%rdi)
+  804ef3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804ef4:	72 79                	jb     804f6f <__rodata_start+0x18f>
+  804ef6:	00 6f 75             	add    %ch,0x75(%rdi)
+  804ef9:	74 20                	je     804f1b <__rodata_start+0x13b>
+  804efb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804efc:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  804f00:	76 69                	jbe    804f6b <__rodata_start+0x18b>
+  804f02:	72 6f                	jb     804f73 <__rodata_start+0x193>
+  804f04:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804f05:	6d                   	insl   (%dx),%es:(%rdi)
+  804f06:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804f08:	74 73                	je     804f7d <__rodata_start+0x19d>
+  804f0a:	00 63 6f             	add    %ah,0x6f(%rbx)
+  804f0d:	72 72                	jb     804f81 <__rodata_start+0x1a1>
+  804f0f:	75 70                	jne    804f81 <__rodata_start+0x1a1>
+  804f11:	74 65                	je     804f78 <__rodata_start+0x198>
+  804f13:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  804f18:	75 67                	jne    804f81 <__rodata_start+0x1a1>
+  804f1a:	20 69 6e             	and    %ch,0x6e(%rcx)
+  804f1d:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804f1f:	00 73 65             	add    %dh,0x65(%rbx)
+  804f22:	67 6d                	insl   (%dx),%es:(%edi)
+  804f24:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804f26:	74 61                	je     804f89 <__rodata_start+0x1a9>
+  804f28:	74 69                	je     804f93 <__rodata_start+0x1b3>
+  804f2a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804f2b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804f2c:	20 66 61             	and    %ah,0x61(%rsi)
+  804f2f:	75 6c                	jne    804f9d <__rodata_start+0x1bd>
+  804f31:	74 00                	je     804f33 <__rodata_start+0x153>
+  804f33:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  804f3a:	20 45 4c             	and    %al,0x4c(%rbp)
+  804f3d:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  804f41:	61                   	(bad)
+  804f42:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  804f47:	20 73 75             	and    %dh,0x75(%rbx)
+  804f4a:	63 68 20             	movsxd 0x20(%rax),%ebp
+  804f4d:	73 79                	jae    804fc8 <__rodata_start+0x1e8>
+  804f4f:	73 74                	jae    804fc5 <__rodata_start+0x1e5>
+  804f51:	65 6d                	gs insl (%dx),%es:(%rdi)
+  804f53:	20 63 61             	and    %ah,0x61(%rbx)
+  804f56:	6c                   	insb   (%dx),%es:(%rdi)
+  804f57:	6c                   	insb   (%dx),%es:(%rdi)
+  804f58:	00 65 6e             	add    %ah,0x6e(%rbp)
+  804f5b:	74 72                	je     804fcf <__rodata_start+0x1ef>
+  804f5d:	79 20                	jns    804f7f <__rodata_start+0x19f>
+  804f5f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804f60:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804f61:	74 20                	je     804f83 <__rodata_start+0x1a3>
+  804f63:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804f65:	75 6e                	jne    804fd5 <__rodata_start+0x1f5>
+  804f67:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  804f6b:	76 20                	jbe    804f8d <__rodata_start+0x1ad>
+  804f6d:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  804f74:	72 65                	jb     804fdb <__rodata_start+0x1fb>
+  804f76:	63 76 69             	movsxd 0x69(%rsi),%esi
+  804f79:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804f7a:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  804f7e:	65 78 70             	gs js  804ff1 <__rodata_start+0x211>
+  804f81:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  804f86:	20 65 6e             	and    %ah,0x6e(%rbp)
+  804f89:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  804f8d:	20 66 69             	and    %ah,0x69(%rsi)
+  804f90:	6c                   	insb   (%dx),%es:(%rdi)
+  804f91:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  804f95:	20 66 72             	and    %ah,0x72(%rsi)
+  804f98:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  804f9d:	61                   	(bad)
+  804f9e:	63 65 20             	movsxd 0x20(%rbp),%esp
+  804fa1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804fa2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804fa3:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  804fa7:	6b 00 74             	imul   $0x74,(%rax),%eax
+  804faa:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804fab:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804fac:	20 6d 61             	and    %ch,0x61(%rbp)
+  804faf:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804fb0:	79 20                	jns    804fd2 <__rodata_start+0x1f2>
+  804fb2:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  804fb9:	72 65                	jb     805020 <__rodata_start+0x240>
+  804fbb:	20 6f 70             	and    %ch,0x70(%rdi)
+  804fbe:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804fc0:	00 66 69             	add    %ah,0x69(%rsi)
+  804fc3:	6c                   	insb   (%dx),%es:(%rdi)
+  804fc4:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  804fc8:	20 62 6c             	and    %ah,0x6c(%rdx)
+  804fcb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804fcc:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  804fcf:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804fd0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804fd1:	74 20                	je     804ff3 <__rodata_start+0x213>
+  804fd3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804fd5:	75 6e                	jne    805045 <__rodata_start+0x265>
+  804fd7:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  804fdb:	76 61                	jbe    80503e <__rodata_start+0x25e>
+  804fdd:	6c                   	insb   (%dx),%es:(%rdi)
+  804fde:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  804fe5:	00 
+  804fe6:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  804fed:	72 65                	jb     805054 <__rodata_start+0x274>
+  804fef:	61                   	(bad)
+  804ff0:	64 79 20             	fs jns 805013 <__rodata_start+0x233>
+  804ff3:	65 78 69             	gs js  80505f <__rodata_start+0x27f>
+  804ff6:	73 74                	jae    80506c <__rodata_start+0x28c>
+  804ff8:	73 00                	jae    804ffa <__rodata_start+0x21a>
+  804ffa:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804ffb:	70 65                	jo     805062 <__rodata_start+0x282>
+  804ffd:	72 61                	jb     805060 <__rodata_start+0x280>
+  804fff:	74 69                	je     80506a <__rodata_start+0x28a>
+  805001:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805002:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805003:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  805006:	74 20                	je     805028 <__rodata_start+0x248>
+  805008:	73 75                	jae    80507f <__rodata_start+0x29f>
+  80500a:	70 70                	jo     80507c <__rodata_start+0x29c>
+  80500c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80500d:	72 74                	jb     805083 <__rodata_start+0x2a3>
+  80500f:	65 64 00 74 72 79    	gs add %dh,%fs:0x79(%rdx,%rsi,2)
+  805015:	20 61 67             	and    %ah,0x67(%rcx)
+  805018:	61                   	(bad)
+  805019:	69 6e 00 74 69 6d 65 	imul   $0x656d6974,0x0(%rsi),%ebp
+  805020:	64 20 6f 75          	and    %ch,%fs:0x75(%rdi)
+  805024:	74 00                	je     805026 <__rodata_start+0x246>
+  805026:	66 69 6c 65 20 69 73 	imul   $0x7369,0x20(%rbp,%riz,2),%bp
+  80502d:	20 69 6e             	and    %ch,0x6e(%rcx)
+  805030:	20 75 73             	and    %dh,0x73(%rbp)
+  805033:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  805037:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  80503e:	00 
+  80503f:	90                   	nop
+  805040:	a7                   	cmpsl  %es:(%rdi),%ds:(%rsi)
+  805041:	07                   	(bad)
+  805042:	80 00 00             	addb   $0x0,(%rax)
+  805045:	00 00                	add    %al,(%rax)
+  805047:	00 e8                	add    %ch,%al
+  805049:	0d 80 00 00 00       	or     $0x80,%eax
+  80504e:	00 00                	add    %al,(%rax)
+  805050:	d8 0d 80 00 00 00    	fmuls  0x80(%rip)        # 8050d6 <__rodata_start+0x2f6>
+  805056:	00 00                	add    %al,(%rax)
+  805058:	e8 0d 80 00 00       	call   80d06a <__ctors_end+0x6f8a>
+  80505d:	00 00                	add    %al,(%rax)
+  80505f:	00 e8                	add    %ch,%al
+  805061:	0d 80 00 00 00       	or     $0x80,%eax
+  805066:	00 00                	add    %al,(%rax)
+  805068:	e8 0d 80 00 00       	call   80d07a <__ctors_end+0x6f9a>
+  80506d:	00 00                	add    %al,(%rax)
+  80506f:	00 e8                	add    %ch,%al
+  805071:	0d 80 00 00 00       	or     $0x80,%eax
+  805076:	00 00                	add    %al,(%rax)
+  805078:	c6 07 80             	movb   $0x80,(%rdi)
+  80507b:	00 00                	add    %al,(%rax)
+  80507d:	00 00                	add    %al,(%rax)
+  80507f:	00 e8                	add    %ch,%al
+  805081:	0d 80 00 00 00       	or     $0x80,%eax
+  805086:	00 00                	add    %al,(%rax)
+  805088:	e8 0d 80 00 00       	call   80d09a <__ctors_end+0x6fba>
+  80508d:	00 00                	add    %al,(%rax)
+  80508f:	00 ba 07 80 00 00    	add    %bh,0x8007(%rdx)
+  805095:	00 00                	add    %al,(%rax)
+  805097:	00 34 08             	add    %dh,(%rax,%rcx,1)
+  80509a:	80 00 00             	addb   $0x0,(%rax)
+  80509d:	00 00                	add    %al,(%rax)
+  80509f:	00 e8                	add    %ch,%al
+  8050a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8050a6:	00 00                	add    %al,(%rax)
+  8050a8:	ba 07 80 00 00       	mov    $0x8007,%edx
+  8050ad:	00 00                	add    %al,(%rax)
+  8050af:	00 00                	add    %al,(%rax)
+  8050b1:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  8050b7:	00 00                	add    %al,(%rax)
+  8050b9:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  8050bf:	00 00                	add    %al,(%rax)
+  8050c1:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  8050c7:	00 00                	add    %al,(%rax)
+  8050c9:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  8050cf:	00 00                	add    %al,(%rax)
+  8050d1:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  8050d7:	00 00                	add    %al,(%rax)
+  8050d9:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  8050df:	00 00                	add    %al,(%rax)
+  8050e1:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  8050e7:	00 00                	add    %al,(%rax)
+  8050e9:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  8050ef:	00 00                	add    %al,(%rax)
+  8050f1:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  8050f7:	00 e8                	add    %ch,%al
+  8050f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8050fe:	00 00                	add    %al,(%rax)
+  805100:	e8 0d 80 00 00       	call   80d112 <__ctors_end+0x7032>
+  805105:	00 00                	add    %al,(%rax)
+  805107:	00 e8                	add    %ch,%al
+  805109:	0d 80 00 00 00       	or     $0x80,%eax
+  80510e:	00 00                	add    %al,(%rax)
+  805110:	e8 0d 80 00 00       	call   80d122 <__ctors_end+0x7042>
+  805115:	00 00                	add    %al,(%rax)
+  805117:	00 e8                	add    %ch,%al
+  805119:	0d 80 00 00 00       	or     $0x80,%eax
+  80511e:	00 00                	add    %al,(%rax)
+  805120:	e8 0d 80 00 00       	call   80d132 <__ctors_end+0x7052>
+  805125:	00 00                	add    %al,(%rax)
+  805127:	00 e8                	add    %ch,%al
+  805129:	0d 80 00 00 00       	or     $0x80,%eax
+  80512e:	00 00                	add    %al,(%rax)
+  805130:	e8 0d 80 00 00       	call   80d142 <__ctors_end+0x7062>
+  805135:	00 00                	add    %al,(%rax)
+  805137:	00 e8                	add    %ch,%al
+  805139:	0d 80 00 00 00       	or     $0x80,%eax
+  80513e:	00 00                	add    %al,(%rax)
+  805140:	e8 0d 80 00 00       	call   80d152 <__ctors_end+0x7072>
+  805145:	00 00                	add    %al,(%rax)
+  805147:	00 e8                	add    %ch,%al
+  805149:	0d 80 00 00 00       	or     $0x80,%eax
+  80514e:	00 00                	add    %al,(%rax)
+  805150:	e8 0d 80 00 00       	call   80d162 <__ctors_end+0x7082>
+  805155:	00 00                	add    %al,(%rax)
+  805157:	00 e8                	add    %ch,%al
+  805159:	0d 80 00 00 00       	or     $0x80,%eax
+  80515e:	00 00                	add    %al,(%rax)
+  805160:	e8 0d 80 00 00       	call   80d172 <__ctors_end+0x7092>
+  805165:	00 00                	add    %al,(%rax)
+  805167:	00 e8                	add    %ch,%al
+  805169:	0d 80 00 00 00       	or     $0x80,%eax
+  80516e:	00 00                	add    %al,(%rax)
+  805170:	e8 0d 80 00 00       	call   80d182 <__ctors_end+0x70a2>
+  805175:	00 00                	add    %al,(%rax)
+  805177:	00 e8                	add    %ch,%al
+  805179:	0d 80 00 00 00       	or     $0x80,%eax
+  80517e:	00 00                	add    %al,(%rax)
+  805180:	e8 0d 80 00 00       	call   80d192 <__ctors_end+0x70b2>
+  805185:	00 00                	add    %al,(%rax)
+  805187:	00 e8                	add    %ch,%al
+  805189:	0d 80 00 00 00       	or     $0x80,%eax
+  80518e:	00 00                	add    %al,(%rax)
+  805190:	e8 0d 80 00 00       	call   80d1a2 <__ctors_end+0x70c2>
+  805195:	00 00                	add    %al,(%rax)
+  805197:	00 e8                	add    %ch,%al
+  805199:	0d 80 00 00 00       	or     $0x80,%eax
+  80519e:	00 00                	add    %al,(%rax)
+  8051a0:	e8 0d 80 00 00       	call   80d1b2 <__ctors_end+0x70d2>
+  8051a5:	00 00                	add    %al,(%rax)
+  8051a7:	00 e8                	add    %ch,%al
+  8051a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8051ae:	00 00                	add    %al,(%rax)
+  8051b0:	e8 0d 80 00 00       	call   80d1c2 <__ctors_end+0x70e2>
+  8051b5:	00 00                	add    %al,(%rax)
+  8051b7:	00 e8                	add    %ch,%al
+  8051b9:	0d 80 00 00 00       	or     $0x80,%eax
+  8051be:	00 00                	add    %al,(%rax)
+  8051c0:	e8 0d 80 00 00       	call   80d1d2 <__ctors_end+0x70f2>
+  8051c5:	00 00                	add    %al,(%rax)
+  8051c7:	00 e8                	add    %ch,%al
+  8051c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8051ce:	00 00                	add    %al,(%rax)
+  8051d0:	e8 0d 80 00 00       	call   80d1e2 <__ctors_end+0x7102>
+  8051d5:	00 00                	add    %al,(%rax)
+  8051d7:	00 e8                	add    %ch,%al
+  8051d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8051de:	00 00                	add    %al,(%rax)
+  8051e0:	e8 0d 80 00 00       	call   80d1f2 <__ctors_end+0x7112>
+  8051e5:	00 00                	add    %al,(%rax)
+  8051e7:	00 0b                	add    %cl,(%rbx)
+  8051e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8051ee:	00 00                	add    %al,(%rax)
+  8051f0:	e8 0d 80 00 00       	call   80d202 <__ctors_end+0x7122>
+  8051f5:	00 00                	add    %al,(%rax)
+  8051f7:	00 e8                	add    %ch,%al
+  8051f9:	0d 80 00 00 00       	or     $0x80,%eax
+  8051fe:	00 00                	add    %al,(%rax)
+  805200:	e8 0d 80 00 00       	call   80d212 <__ctors_end+0x7132>
+  805205:	00 00                	add    %al,(%rax)
+  805207:	00 e8                	add    %ch,%al
+  805209:	0d 80 00 00 00       	or     $0x80,%eax
+  80520e:	00 00                	add    %al,(%rax)
+  805210:	e8 0d 80 00 00       	call   80d222 <__ctors_end+0x7142>
+  805215:	00 00                	add    %al,(%rax)
+  805217:	00 e8                	add    %ch,%al
+  805219:	0d 80 00 00 00       	or     $0x80,%eax
+  80521e:	00 00                	add    %al,(%rax)
+  805220:	e8 0d 80 00 00       	call   80d232 <__ctors_end+0x7152>
+  805225:	00 00                	add    %al,(%rax)
+  805227:	00 e8                	add    %ch,%al
+  805229:	0d 80 00 00 00       	or     $0x80,%eax
+  80522e:	00 00                	add    %al,(%rax)
+  805230:	e8 0d 80 00 00       	call   80d242 <__ctors_end+0x7162>
+  805235:	00 00                	add    %al,(%rax)
+  805237:	00 e8                	add    %ch,%al
+  805239:	0d 80 00 00 00       	or     $0x80,%eax
+  80523e:	00 00                	add    %al,(%rax)
+  805240:	57                   	push   %rdi
+  805241:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  805247:	00 26                	add    %ah,(%rsi)
+  805249:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80524f:	00 e8                	add    %ch,%al
+  805251:	0d 80 00 00 00       	or     $0x80,%eax
+  805256:	00 00                	add    %al,(%rax)
+  805258:	e8 0d 80 00 00       	call   80d26a <__ctors_end+0x718a>
+  80525d:	00 00                	add    %al,(%rax)
+  80525f:	00 e8                	add    %ch,%al
+  805261:	0d 80 00 00 00       	or     $0x80,%eax
+  805266:	00 00                	add    %al,(%rax)
+  805268:	e8 0d 80 00 00       	call   80d27a <__ctors_end+0x719a>
+  80526d:	00 00                	add    %al,(%rax)
+  80526f:	00 86 08 80 00 00    	add    %al,0x8008(%rsi)
+  805275:	00 00                	add    %al,(%rax)
+  805277:	00 e8                	add    %ch,%al
+  805279:	0d 80 00 00 00       	or     $0x80,%eax
+  80527e:	00 00                	add    %al,(%rax)
+  805280:	e8 0d 80 00 00       	call   80d292 <__ctors_end+0x71b2>
+  805285:	00 00                	add    %al,(%rax)
+  805287:	00 4c 08 80          	add    %cl,-0x80(%rax,%rcx,1)
+  80528b:	00 00                	add    %al,(%rax)
+  80528d:	00 00                	add    %al,(%rax)
+  80528f:	00 e8                	add    %ch,%al
+  805291:	0d 80 00 00 00       	or     $0x80,%eax
+  805296:	00 00                	add    %al,(%rax)
+  805298:	e8 0d 80 00 00       	call   80d2aa <__ctors_end+0x71ca>
+  80529d:	00 00                	add    %al,(%rax)
+  80529f:	00 ce                	add    %cl,%dh
+  8052a1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8052a7:	00 98 0c 80 00 00    	add    %bl,0x800c(%rax)
+  8052ad:	00 00                	add    %al,(%rax)
+  8052af:	00 e8                	add    %ch,%al
+  8052b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8052b6:	00 00                	add    %al,(%rax)
+  8052b8:	e8 0d 80 00 00       	call   80d2ca <__ctors_end+0x71ea>
+  8052bd:	00 00                	add    %al,(%rax)
+  8052bf:	00 1d 09 80 00 00    	add    %bl,0x8009(%rip)        # 80d2ce <__ctors_end+0x71ee>
+  8052c5:	00 00                	add    %al,(%rax)
+  8052c7:	00 e8                	add    %ch,%al
+  8052c9:	0d 80 00 00 00       	or     $0x80,%eax
+  8052ce:	00 00                	add    %al,(%rax)
+  8052d0:	fa                   	cli
+  8052d1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8052d7:	00 e8                	add    %ch,%al
+  8052d9:	0d 80 00 00 00       	or     $0x80,%eax
+  8052de:	00 00                	add    %al,(%rax)
+  8052e0:	e8 0d 80 00 00       	call   80d2f2 <__ctors_end+0x7212>
+  8052e5:	00 00                	add    %al,(%rax)
+  8052e7:	00 0b                	add    %cl,(%rbx)
+  8052e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8052ee:	00 00                	add    %al,(%rax)
+  8052f0:	e8 0d 80 00 00       	call   80d302 <__ctors_end+0x7222>
+  8052f5:	00 00                	add    %al,(%rax)
+  8052f7:	00 b0 07 80 00 00    	add    %dh,0x8007(%rax)
+  8052fd:	00 00                	add    %al,(%rax)
+	...
+
+0000000000805300 <error_string>:
+	...
+  805308:	b5 4e 80 00 00 00 00 00 c7 4e 80 00 00 00 00 00     .N.......N......
+  805318:	d7 4e 80 00 00 00 00 00 e9 4e 80 00 00 00 00 00     .N.......N......
+  805328:	f7 4e 80 00 00 00 00 00 0b 4f 80 00 00 00 00 00     .N.......O......
+  805338:	20 4f 80 00 00 00 00 00 33 4f 80 00 00 00 00 00      O......3O......
+  805348:	45 4f 80 00 00 00 00 00 59 4f 80 00 00 00 00 00     EO......YO......
+  805358:	69 4f 80 00 00 00 00 00 7c 4f 80 00 00 00 00 00     iO......|O......
+  805368:	93 4f 80 00 00 00 00 00 a9 4f 80 00 00 00 00 00     .O.......O......
+  805378:	c1 4f 80 00 00 00 00 00 d9 4f 80 00 00 00 00 00     .O.......O......
+  805388:	e6 4f 80 00 00 00 00 00 b8 53 80 00 00 00 00 00     .O.......S......
+  805398:	fa 4f 80 00 00 00 00 00 12 50 80 00 00 00 00 00     .O.......P......
+  8053a8:	1c 50 80 00 00 00 00 00 26 50 80 00 00 00 00 00     .P......&P......
+  8053b8:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  8053c8:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 72     lid executable.r
+  8053d8:	65 61 64 20 65 72 72 6f 72 3a 20 25 69 0a 00 25     ead error: %i..%
+  8053e8:	6c 64 00 25 6c 6c 64 00 25 75 00 25 6c 75 00 25     ld.%lld.%u.%lu.%
+  8053f8:	6c 6c 75 00 25 66 00 25 6c 66 00 25 63 00 66 90     llu.%f.%lf.%c.f.
+  805408:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  805418:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  805428:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  805438:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  805448:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  805458:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  805468:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  805478:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  805488:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  805498:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  8054a8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  8054b8:	00 00 00 00 0f 1f 40 00                             ......@.
+
+00000000008054c0 <devtab>:
+  8054c0:	60 60 80 00 00 00 00 00 a0 60 80 00 00 00 00 00     ``.......`......
+  8054d0:	00 60 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .`..............
+  8054e0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  8054f0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  805500:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  805510:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  805520:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  805530:	3d 20 32 00 0f 1f 40 00 55 73 65 72 73 70 61 63     = 2...@.Userspac
+  805540:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  805550:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  805560:	65 72 72 3d 25 78 0a 00 6c 69 62 2f 70 67 66 61     err=%x..lib/pgfa
+  805570:	75 6c 74 2e 63 00 73 65 74 5f 70 67 66 61 75 6c     ult.c.set_pgfaul
+  805580:	74 5f 68 61 6e 64 6c 65 72 3a 20 25 69 00 5f 70     t_handler: %i._p
+  805590:	66 68 61 6e 64 6c 65 72 5f 69 6e 69 74 69 74 69     fhandler_inititi
+  8055a0:	61 6c 6c 69 7a 65 64 00 69 70 63 5f 73 65 6e 64     allized.ipc_send
+  8055b0:	20 65 72 72 6f 72 3a 20 25 69 0a 00 6c 69 62 2f      error: %i..lib/
+  8055c0:	69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00 00     ipc.c.f.........
+  8055d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8055e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8055f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805600:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805610:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805620:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805630:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805640:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805650:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805660:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805670:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805680:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805690:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8056a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8056b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8056c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8056d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8056e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8056f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805700:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805710:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805720:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805730:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805740:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805750:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805760:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805770:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805780:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805790:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8057a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8057b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8057c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8057d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8057e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8057f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805800:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805810:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805820:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805830:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805840:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805850:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805860:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805870:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805880:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805890:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8058a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8058b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8058c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8058d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8058e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8058f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805900:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805910:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805920:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805930:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805940:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805950:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805960:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805970:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805980:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805990:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8059a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8059b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8059c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8059d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8059e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8059f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805aa0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ab0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ac0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ad0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ae0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805af0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ba0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805bb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805bc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805bd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805be0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805bf0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ca0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805cb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805cc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805cd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ce0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805cf0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805da0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805db0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805dc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805dd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805de0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805df0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ea0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805eb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ec0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ed0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ee0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ef0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805fa0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805fb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805fc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805fd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805fe0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ff0:	0f 1f 84 00 00 00 00 00 0f 1f 84 00 00 00 00 00     ................
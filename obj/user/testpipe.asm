@@ -0,0 +1,9064 @@
+
+obj/user/testpipe:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 85 04 00 00       	call   8004a8 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+char *msg = "Now is the time for all good men to come to the aid of their party.";
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 78          	sub    $0x78,%rsp
+    char buf[100];
+    int i, pid, p[2];
+
+    binaryname = "pipereadeof";
+  800036:	48 b8 28 4d 80 00 00 	movabs $0x804d28,%rax
+  80003d:	00 00 00 
+  800040:	48 a3 08 60 80 00 00 	movabs %rax,0x806008
+  800047:	00 00 00 
+
+    if ((i = pipe(p)) < 0)
+  80004a:	48 8d bd 64 ff ff ff 	lea    -0x9c(%rbp),%rdi
+  800051:	48 b8 61 3f 80 00 00 	movabs $0x803f61,%rax
+  800058:	00 00 00 
+  80005b:	ff d0                	call   *%rax
+  80005d:	41 89 c4             	mov    %eax,%r12d
+  800060:	85 c0                	test   %eax,%eax
+  800062:	0f 88 b3 01 00 00    	js     80021b <umain+0x1f6>
+        panic("pipe: %i", i);
+
+    if ((pid = fork()) < 0)
+  800068:	48 b8 85 19 80 00 00 	movabs $0x801985,%rax
+  80006f:	00 00 00 
+  800072:	ff d0                	call   *%rax
+  800074:	89 c3                	mov    %eax,%ebx
+  800076:	85 c0                	test   %eax,%eax
+  800078:	0f 88 ca 01 00 00    	js     800248 <umain+0x223>
+        panic("fork: %i", i);
+
+    if (pid == 0) {
+  80007e:	0f 85 49 02 00 00    	jne    8002cd <umain+0x2a8>
+        cprintf("[%08x] pipereadeof close %d\n", thisenv->env_id, p[1]);
+  800084:	49 bd 00 00 81 00 00 	movabs $0x810000,%r13
+  80008b:	00 00 00 
+  80008e:	49 8b 45 00          	mov    0x0(%r13),%rax
+  800092:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800098:	8b 95 68 ff ff ff    	mov    -0x98(%rbp),%edx
+  80009e:	48 bf 56 4d 80 00 00 	movabs $0x804d56,%rdi
+  8000a5:	00 00 00 
+  8000a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ad:	49 bc ce 06 80 00 00 	movabs $0x8006ce,%r12
+  8000b4:	00 00 00 
+  8000b7:	41 ff d4             	call   *%r12
+        close(p[1]);
+  8000ba:	8b bd 68 ff ff ff    	mov    -0x98(%rbp),%edi
+  8000c0:	48 b8 98 1c 80 00 00 	movabs $0x801c98,%rax
+  8000c7:	00 00 00 
+  8000ca:	ff d0                	call   *%rax
+        cprintf("[%08x] pipereadeof readn %d\n", thisenv->env_id, p[0]);
+  8000cc:	49 8b 45 00          	mov    0x0(%r13),%rax
+  8000d0:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8000d6:	8b 95 64 ff ff ff    	mov    -0x9c(%rbp),%edx
+  8000dc:	48 bf 73 4d 80 00 00 	movabs $0x804d73,%rdi
+  8000e3:	00 00 00 
+  8000e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000eb:	41 ff d4             	call   *%r12
+        i = readn(p[0], buf, sizeof buf - 1);
+  8000ee:	ba 63 00 00 00       	mov    $0x63,%edx
+  8000f3:	48 8d b5 6c ff ff ff 	lea    -0x94(%rbp),%rsi
+  8000fa:	8b bd 64 ff ff ff    	mov    -0x9c(%rbp),%edi
+  800100:	48 b8 d4 1e 80 00 00 	movabs $0x801ed4,%rax
+  800107:	00 00 00 
+  80010a:	ff d0                	call   *%rax
+  80010c:	41 89 c4             	mov    %eax,%r12d
+        if (i < 0)
+  80010f:	85 c0                	test   %eax,%eax
+  800111:	0f 88 5f 01 00 00    	js     800276 <umain+0x251>
+            panic("read: %i", i);
+        buf[i] = 0;
+  800117:	48 98                	cltq
+  800119:	c6 84 05 6c ff ff ff 	movb   $0x0,-0x94(%rbp,%rax,1)
+  800120:	00 
+        if (strcmp(buf, msg) == 0)
+  800121:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800128:	00 00 00 
+  80012b:	48 8b 30             	mov    (%rax),%rsi
+  80012e:	48 8d bd 6c ff ff ff 	lea    -0x94(%rbp),%rdi
+  800135:	48 b8 97 10 80 00 00 	movabs $0x801097,%rax
+  80013c:	00 00 00 
+  80013f:	ff d0                	call   *%rax
+  800141:	85 c0                	test   %eax,%eax
+  800143:	0f 85 5a 01 00 00    	jne    8002a3 <umain+0x27e>
+            cprintf("\npipe read closed properly\n");
+  800149:	48 bf 99 4d 80 00 00 	movabs $0x804d99,%rdi
+  800150:	00 00 00 
+  800153:	48 ba ce 06 80 00 00 	movabs $0x8006ce,%rdx
+  80015a:	00 00 00 
+  80015d:	ff d2                	call   *%rdx
+        else
+            cprintf("\ngot %d bytes: %s\n", i, buf);
+        exit();
+  80015f:	48 b8 5b 05 80 00 00 	movabs $0x80055b,%rax
+  800166:	00 00 00 
+  800169:	ff d0                	call   *%rax
+        cprintf("[%08x] pipereadeof write %d\n", thisenv->env_id, p[1]);
+        if ((i = write(p[1], msg, strlen(msg))) != strlen(msg))
+            panic("write: %i", i);
+        close(p[1]);
+    }
+    wait(pid);
+  80016b:	89 df                	mov    %ebx,%edi
+  80016d:	48 b8 ae 41 80 00 00 	movabs $0x8041ae,%rax
+  800174:	00 00 00 
+  800177:	ff d0                	call   *%rax
+
+    binaryname = "pipewriteeof";
+  800179:	48 b8 ef 4d 80 00 00 	movabs $0x804def,%rax
+  800180:	00 00 00 
+  800183:	48 a3 08 60 80 00 00 	movabs %rax,0x806008
+  80018a:	00 00 00 
+    if ((i = pipe(p)) < 0)
+  80018d:	48 8d bd 64 ff ff ff 	lea    -0x9c(%rbp),%rdi
+  800194:	48 b8 61 3f 80 00 00 	movabs $0x803f61,%rax
+  80019b:	00 00 00 
+  80019e:	ff d0                	call   *%rax
+  8001a0:	41 89 c4             	mov    %eax,%r12d
+  8001a3:	85 c0                	test   %eax,%eax
+  8001a5:	0f 88 1a 02 00 00    	js     8003c5 <umain+0x3a0>
+        panic("pipe: %i", i);
+
+    if ((pid = fork()) < 0)
+  8001ab:	48 b8 85 19 80 00 00 	movabs $0x801985,%rax
+  8001b2:	00 00 00 
+  8001b5:	ff d0                	call   *%rax
+  8001b7:	89 c3                	mov    %eax,%ebx
+  8001b9:	85 c0                	test   %eax,%eax
+  8001bb:	0f 88 31 02 00 00    	js     8003f2 <umain+0x3cd>
+        panic("fork: %i", i);
+
+    if (pid == 0) {
+  8001c1:	0f 84 59 02 00 00    	je     800420 <umain+0x3fb>
+                break;
+        }
+        cprintf("\npipe write closed properly\n");
+        exit();
+    }
+    close(p[0]);
+  8001c7:	8b bd 64 ff ff ff    	mov    -0x9c(%rbp),%edi
+  8001cd:	49 bc 98 1c 80 00 00 	movabs $0x801c98,%r12
+  8001d4:	00 00 00 
+  8001d7:	41 ff d4             	call   *%r12
+    close(p[1]);
+  8001da:	8b bd 68 ff ff ff    	mov    -0x98(%rbp),%edi
+  8001e0:	41 ff d4             	call   *%r12
+    wait(pid);
+  8001e3:	89 df                	mov    %ebx,%edi
+  8001e5:	48 b8 ae 41 80 00 00 	movabs $0x8041ae,%rax
+  8001ec:	00 00 00 
+  8001ef:	ff d0                	call   *%rax
+
+    cprintf("pipe tests passed\n");
+  8001f1:	48 bf 1d 4e 80 00 00 	movabs $0x804e1d,%rdi
+  8001f8:	00 00 00 
+  8001fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800200:	48 ba ce 06 80 00 00 	movabs $0x8006ce,%rdx
+  800207:	00 00 00 
+  80020a:	ff d2                	call   *%rdx
+}
+  80020c:	48 83 c4 78          	add    $0x78,%rsp
+  800210:	5b                   	pop    %rbx
+  800211:	41 5c                	pop    %r12
+  800213:	41 5d                	pop    %r13
+  800215:	41 5e                	pop    %r14
+  800217:	41 5f                	pop    %r15
+  800219:	5d                   	pop    %rbp
+  80021a:	c3                   	ret
+        panic("pipe: %i", i);
+  80021b:	89 c1                	mov    %eax,%ecx
+  80021d:	48 ba 34 4d 80 00 00 	movabs $0x804d34,%rdx
+  800224:	00 00 00 
+  800227:	be 0d 00 00 00       	mov    $0xd,%esi
+  80022c:	48 bf 3d 4d 80 00 00 	movabs $0x804d3d,%rdi
+  800233:	00 00 00 
+  800236:	b8 00 00 00 00       	mov    $0x0,%eax
+  80023b:	49 b8 7e 05 80 00 00 	movabs $0x80057e,%r8
+  800242:	00 00 00 
+  800245:	41 ff d0             	call   *%r8
+        panic("fork: %i", i);
+  800248:	44 89 e1             	mov    %r12d,%ecx
+  80024b:	48 ba 4d 4d 80 00 00 	movabs $0x804d4d,%rdx
+  800252:	00 00 00 
+  800255:	be 10 00 00 00       	mov    $0x10,%esi
+  80025a:	48 bf 3d 4d 80 00 00 	movabs $0x804d3d,%rdi
+  800261:	00 00 00 
+  800264:	b8 00 00 00 00       	mov    $0x0,%eax
+  800269:	49 b8 7e 05 80 00 00 	movabs $0x80057e,%r8
+  800270:	00 00 00 
+  800273:	41 ff d0             	call   *%r8
+            panic("read: %i", i);
+  800276:	89 c1                	mov    %eax,%ecx
+  800278:	48 ba 90 4d 80 00 00 	movabs $0x804d90,%rdx
+  80027f:	00 00 00 
+  800282:	be 18 00 00 00       	mov    $0x18,%esi
+  800287:	48 bf 3d 4d 80 00 00 	movabs $0x804d3d,%rdi
+  80028e:	00 00 00 
+  800291:	b8 00 00 00 00       	mov    $0x0,%eax
+  800296:	49 b8 7e 05 80 00 00 	movabs $0x80057e,%r8
+  80029d:	00 00 00 
+  8002a0:	41 ff d0             	call   *%r8
+            cprintf("\ngot %d bytes: %s\n", i, buf);
+  8002a3:	48 8d 95 6c ff ff ff 	lea    -0x94(%rbp),%rdx
+  8002aa:	44 89 e6             	mov    %r12d,%esi
+  8002ad:	48 bf b5 4d 80 00 00 	movabs $0x804db5,%rdi
+  8002b4:	00 00 00 
+  8002b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002bc:	48 b9 ce 06 80 00 00 	movabs $0x8006ce,%rcx
+  8002c3:	00 00 00 
+  8002c6:	ff d1                	call   *%rcx
+  8002c8:	e9 92 fe ff ff       	jmp    80015f <umain+0x13a>
+        cprintf("[%08x] pipereadeof close %d\n", thisenv->env_id, p[0]);
+  8002cd:	49 bd 00 00 81 00 00 	movabs $0x810000,%r13
+  8002d4:	00 00 00 
+  8002d7:	49 8b 45 00          	mov    0x0(%r13),%rax
+  8002db:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8002e1:	8b 95 64 ff ff ff    	mov    -0x9c(%rbp),%edx
+  8002e7:	48 bf 56 4d 80 00 00 	movabs $0x804d56,%rdi
+  8002ee:	00 00 00 
+  8002f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002f6:	49 bc ce 06 80 00 00 	movabs $0x8006ce,%r12
+  8002fd:	00 00 00 
+  800300:	41 ff d4             	call   *%r12
+        close(p[0]);
+  800303:	8b bd 64 ff ff ff    	mov    -0x9c(%rbp),%edi
+  800309:	48 b8 98 1c 80 00 00 	movabs $0x801c98,%rax
+  800310:	00 00 00 
+  800313:	ff d0                	call   *%rax
+        cprintf("[%08x] pipereadeof write %d\n", thisenv->env_id, p[1]);
+  800315:	49 8b 45 00          	mov    0x0(%r13),%rax
+  800319:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80031f:	8b 95 68 ff ff ff    	mov    -0x98(%rbp),%edx
+  800325:	48 bf c8 4d 80 00 00 	movabs $0x804dc8,%rdi
+  80032c:	00 00 00 
+  80032f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800334:	41 ff d4             	call   *%r12
+        if ((i = write(p[1], msg, strlen(msg))) != strlen(msg))
+  800337:	49 bd 00 60 80 00 00 	movabs $0x806000,%r13
+  80033e:	00 00 00 
+  800341:	49 8b 7d 00          	mov    0x0(%r13),%rdi
+  800345:	49 bf b5 0f 80 00 00 	movabs $0x800fb5,%r15
+  80034c:	00 00 00 
+  80034f:	41 ff d7             	call   *%r15
+  800352:	48 89 c2             	mov    %rax,%rdx
+  800355:	49 8b 75 00          	mov    0x0(%r13),%rsi
+  800359:	8b bd 68 ff ff ff    	mov    -0x98(%rbp),%edi
+  80035f:	48 b8 45 1f 80 00 00 	movabs $0x801f45,%rax
+  800366:	00 00 00 
+  800369:	ff d0                	call   *%rax
+  80036b:	49 89 c4             	mov    %rax,%r12
+  80036e:	41 89 c6             	mov    %eax,%r14d
+  800371:	49 8b 7d 00          	mov    0x0(%r13),%rdi
+  800375:	41 ff d7             	call   *%r15
+  800378:	4d 63 e4             	movslq %r12d,%r12
+  80037b:	49 39 c4             	cmp    %rax,%r12
+  80037e:	75 17                	jne    800397 <umain+0x372>
+        close(p[1]);
+  800380:	8b bd 68 ff ff ff    	mov    -0x98(%rbp),%edi
+  800386:	48 b8 98 1c 80 00 00 	movabs $0x801c98,%rax
+  80038d:	00 00 00 
+  800390:	ff d0                	call   *%rax
+  800392:	e9 d4 fd ff ff       	jmp    80016b <umain+0x146>
+            panic("write: %i", i);
+  800397:	44 89 f1             	mov    %r14d,%ecx
+  80039a:	48 ba e5 4d 80 00 00 	movabs $0x804de5,%rdx
+  8003a1:	00 00 00 
+  8003a4:	be 24 00 00 00       	mov    $0x24,%esi
+  8003a9:	48 bf 3d 4d 80 00 00 	movabs $0x804d3d,%rdi
+  8003b0:	00 00 00 
+  8003b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003b8:	49 b8 7e 05 80 00 00 	movabs $0x80057e,%r8
+  8003bf:	00 00 00 
+  8003c2:	41 ff d0             	call   *%r8
+        panic("pipe: %i", i);
+  8003c5:	89 c1                	mov    %eax,%ecx
+  8003c7:	48 ba 34 4d 80 00 00 	movabs $0x804d34,%rdx
+  8003ce:	00 00 00 
+  8003d1:	be 2b 00 00 00       	mov    $0x2b,%esi
+  8003d6:	48 bf 3d 4d 80 00 00 	movabs $0x804d3d,%rdi
+  8003dd:	00 00 00 
+  8003e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003e5:	49 b8 7e 05 80 00 00 	movabs $0x80057e,%r8
+  8003ec:	00 00 00 
+  8003ef:	41 ff d0             	call   *%r8
+        panic("fork: %i", i);
+  8003f2:	44 89 e1             	mov    %r12d,%ecx
+  8003f5:	48 ba 4d 4d 80 00 00 	movabs $0x804d4d,%rdx
+  8003fc:	00 00 00 
+  8003ff:	be 2e 00 00 00       	mov    $0x2e,%esi
+  800404:	48 bf 3d 4d 80 00 00 	movabs $0x804d3d,%rdi
+  80040b:	00 00 00 
+  80040e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800413:	49 b8 7e 05 80 00 00 	movabs $0x80057e,%r8
+  80041a:	00 00 00 
+  80041d:	41 ff d0             	call   *%r8
+        close(p[0]);
+  800420:	8b bd 64 ff ff ff    	mov    -0x9c(%rbp),%edi
+  800426:	48 b8 98 1c 80 00 00 	movabs $0x801c98,%rax
+  80042d:	00 00 00 
+  800430:	ff d0                	call   *%rax
+            cprintf(".");
+  800432:	49 bf fc 4d 80 00 00 	movabs $0x804dfc,%r15
+  800439:	00 00 00 
+  80043c:	49 be ce 06 80 00 00 	movabs $0x8006ce,%r14
+  800443:	00 00 00 
+            if (write(p[1], "x", 1) != 1)
+  800446:	49 bd fe 4d 80 00 00 	movabs $0x804dfe,%r13
+  80044d:	00 00 00 
+  800450:	49 bc 45 1f 80 00 00 	movabs $0x801f45,%r12
+  800457:	00 00 00 
+            cprintf(".");
+  80045a:	4c 89 ff             	mov    %r15,%rdi
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	41 ff d6             	call   *%r14
+            if (write(p[1], "x", 1) != 1)
+  800465:	ba 01 00 00 00       	mov    $0x1,%edx
+  80046a:	4c 89 ee             	mov    %r13,%rsi
+  80046d:	8b bd 68 ff ff ff    	mov    -0x98(%rbp),%edi
+  800473:	41 ff d4             	call   *%r12
+  800476:	48 83 f8 01          	cmp    $0x1,%rax
+  80047a:	74 de                	je     80045a <umain+0x435>
+        cprintf("\npipe write closed properly\n");
+  80047c:	48 bf 00 4e 80 00 00 	movabs $0x804e00,%rdi
+  800483:	00 00 00 
+  800486:	b8 00 00 00 00       	mov    $0x0,%eax
+  80048b:	48 ba ce 06 80 00 00 	movabs $0x8006ce,%rdx
+  800492:	00 00 00 
+  800495:	ff d2                	call   *%rdx
+        exit();
+  800497:	48 b8 5b 05 80 00 00 	movabs $0x80055b,%rax
+  80049e:	00 00 00 
+  8004a1:	ff d0                	call   *%rax
+  8004a3:	e9 1f fd ff ff       	jmp    8001c7 <umain+0x1a2>
+
+00000000008004a8 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8004a8:	55                   	push   %rbp
+  8004a9:	48 89 e5             	mov    %rsp,%rbp
+  8004ac:	41 56                	push   %r14
+  8004ae:	41 55                	push   %r13
+  8004b0:	41 54                	push   %r12
+  8004b2:	53                   	push   %rbx
+  8004b3:	41 89 fd             	mov    %edi,%r13d
+  8004b6:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8004b9:	48 ba e0 60 80 00 00 	movabs $0x8060e0,%rdx
+  8004c0:	00 00 00 
+  8004c3:	48 b8 e0 60 80 00 00 	movabs $0x8060e0,%rax
+  8004ca:	00 00 00 
+  8004cd:	48 39 c2             	cmp    %rax,%rdx
+  8004d0:	73 17                	jae    8004e9 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8004d2:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8004d5:	49 89 c4             	mov    %rax,%r12
+  8004d8:	48 83 c3 08          	add    $0x8,%rbx
+  8004dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004e1:	ff 53 f8             	call   *-0x8(%rbx)
+  8004e4:	4c 39 e3             	cmp    %r12,%rbx
+  8004e7:	72 ef                	jb     8004d8 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8004e9:	48 b8 c5 14 80 00 00 	movabs $0x8014c5,%rax
+  8004f0:	00 00 00 
+  8004f3:	ff d0                	call   *%rax
+  8004f5:	89 c2                	mov    %eax,%edx
+  8004f7:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  8004fd:	48 89 d0             	mov    %rdx,%rax
+  800500:	48 c1 e0 04          	shl    $0x4,%rax
+  800504:	48 29 d0             	sub    %rdx,%rax
+  800507:	48 c1 e0 05          	shl    $0x5,%rax
+  80050b:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800512:	00 00 00 
+  800515:	48 01 d0             	add    %rdx,%rax
+  800518:	48 a3 00 00 81 00 00 	movabs %rax,0x810000
+  80051f:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800522:	45 85 ed             	test   %r13d,%r13d
+  800525:	7e 0d                	jle    800534 <libmain+0x8c>
+  800527:	49 8b 06             	mov    (%r14),%rax
+  80052a:	48 a3 08 60 80 00 00 	movabs %rax,0x806008
+  800531:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800534:	4c 89 f6             	mov    %r14,%rsi
+  800537:	44 89 ef             	mov    %r13d,%edi
+  80053a:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800541:	00 00 00 
+  800544:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800546:	48 b8 5b 05 80 00 00 	movabs $0x80055b,%rax
+  80054d:	00 00 00 
+  800550:	ff d0                	call   *%rax
+#endif
+}
+  800552:	5b                   	pop    %rbx
+  800553:	41 5c                	pop    %r12
+  800555:	41 5d                	pop    %r13
+  800557:	41 5e                	pop    %r14
+  800559:	5d                   	pop    %rbp
+  80055a:	c3                   	ret
+
+000000000080055b <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80055b:	55                   	push   %rbp
+  80055c:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80055f:	48 b8 cb 1c 80 00 00 	movabs $0x801ccb,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80056b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800570:	48 b8 62 14 80 00 00 	movabs $0x801462,%rax
+  800577:	00 00 00 
+  80057a:	ff d0                	call   *%rax
+}
+  80057c:	5d                   	pop    %rbp
+  80057d:	c3                   	ret
+
+000000000080057e <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80057e:	55                   	push   %rbp
+  80057f:	48 89 e5             	mov    %rsp,%rbp
+  800582:	41 56                	push   %r14
+  800584:	41 55                	push   %r13
+  800586:	41 54                	push   %r12
+  800588:	53                   	push   %rbx
+  800589:	48 83 ec 50          	sub    $0x50,%rsp
+  80058d:	49 89 fc             	mov    %rdi,%r12
+  800590:	41 89 f5             	mov    %esi,%r13d
+  800593:	48 89 d3             	mov    %rdx,%rbx
+  800596:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80059a:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80059e:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8005a2:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8005a9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8005ad:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8005b1:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8005b5:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8005b9:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  8005c0:	00 00 00 
+  8005c3:	4c 8b 30             	mov    (%rax),%r14
+  8005c6:	48 b8 c5 14 80 00 00 	movabs $0x8014c5,%rax
+  8005cd:	00 00 00 
+  8005d0:	ff d0                	call   *%rax
+  8005d2:	89 c6                	mov    %eax,%esi
+  8005d4:	45 89 e8             	mov    %r13d,%r8d
+  8005d7:	4c 89 e1             	mov    %r12,%rcx
+  8005da:	4c 89 f2             	mov    %r14,%rdx
+  8005dd:	48 bf 80 4e 80 00 00 	movabs $0x804e80,%rdi
+  8005e4:	00 00 00 
+  8005e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005ec:	49 bc ce 06 80 00 00 	movabs $0x8006ce,%r12
+  8005f3:	00 00 00 
+  8005f6:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8005f9:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8005fd:	48 89 df             	mov    %rbx,%rdi
+  800600:	48 b8 6a 06 80 00 00 	movabs $0x80066a,%rax
+  800607:	00 00 00 
+  80060a:	ff d0                	call   *%rax
+    cprintf("\n");
+  80060c:	48 bf 71 4d 80 00 00 	movabs $0x804d71,%rdi
+  800613:	00 00 00 
+  800616:	b8 00 00 00 00       	mov    $0x0,%eax
+  80061b:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80061e:	cc                   	int3
+  80061f:	eb fd                	jmp    80061e <_panic+0xa0>
+
+0000000000800621 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800621:	55                   	push   %rbp
+  800622:	48 89 e5             	mov    %rsp,%rbp
+  800625:	53                   	push   %rbx
+  800626:	48 83 ec 08          	sub    $0x8,%rsp
+  80062a:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80062d:	8b 06                	mov    (%rsi),%eax
+  80062f:	8d 50 01             	lea    0x1(%rax),%edx
+  800632:	89 16                	mov    %edx,(%rsi)
+  800634:	48 98                	cltq
+  800636:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80063b:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800641:	74 0a                	je     80064d <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800643:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800647:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80064b:	c9                   	leave
+  80064c:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80064d:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800651:	be ff 00 00 00       	mov    $0xff,%esi
+  800656:	48 b8 1a 14 80 00 00 	movabs $0x80141a,%rax
+  80065d:	00 00 00 
+  800660:	ff d0                	call   *%rax
+        state->offset = 0;
+  800662:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800668:	eb d9                	jmp    800643 <putch+0x22>
+
+000000000080066a <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80066a:	55                   	push   %rbp
+  80066b:	48 89 e5             	mov    %rsp,%rbp
+  80066e:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800675:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800678:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80067f:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800684:	b8 00 00 00 00       	mov    $0x0,%eax
+  800689:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80068c:	48 89 f1             	mov    %rsi,%rcx
+  80068f:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800696:	48 bf 21 06 80 00 00 	movabs $0x800621,%rdi
+  80069d:	00 00 00 
+  8006a0:	48 b8 1e 08 80 00 00 	movabs $0x80081e,%rax
+  8006a7:	00 00 00 
+  8006aa:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8006ac:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8006b3:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8006ba:	48 b8 1a 14 80 00 00 	movabs $0x80141a,%rax
+  8006c1:	00 00 00 
+  8006c4:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8006c6:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8006cc:	c9                   	leave
+  8006cd:	c3                   	ret
+
+00000000008006ce <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8006ce:	55                   	push   %rbp
+  8006cf:	48 89 e5             	mov    %rsp,%rbp
+  8006d2:	48 83 ec 50          	sub    $0x50,%rsp
+  8006d6:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8006da:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8006de:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8006e2:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8006e6:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8006ea:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8006f1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8006f5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006f9:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8006fd:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800701:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800705:	48 b8 6a 06 80 00 00 	movabs $0x80066a,%rax
+  80070c:	00 00 00 
+  80070f:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800711:	c9                   	leave
+  800712:	c3                   	ret
+
+0000000000800713 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800713:	55                   	push   %rbp
+  800714:	48 89 e5             	mov    %rsp,%rbp
+  800717:	41 57                	push   %r15
+  800719:	41 56                	push   %r14
+  80071b:	41 55                	push   %r13
+  80071d:	41 54                	push   %r12
+  80071f:	53                   	push   %rbx
+  800720:	48 83 ec 18          	sub    $0x18,%rsp
+  800724:	49 89 fc             	mov    %rdi,%r12
+  800727:	49 89 f5             	mov    %rsi,%r13
+  80072a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80072e:	8b 45 10             	mov    0x10(%rbp),%eax
+  800731:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800734:	41 89 cf             	mov    %ecx,%r15d
+  800737:	4c 39 fa             	cmp    %r15,%rdx
+  80073a:	73 5b                	jae    800797 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80073c:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800740:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800744:	85 db                	test   %ebx,%ebx
+  800746:	7e 0e                	jle    800756 <print_num+0x43>
+            putch(padc, put_arg);
+  800748:	4c 89 ee             	mov    %r13,%rsi
+  80074b:	44 89 f7             	mov    %r14d,%edi
+  80074e:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800751:	83 eb 01             	sub    $0x1,%ebx
+  800754:	75 f2                	jne    800748 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800756:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80075a:	48 b9 b4 4e 80 00 00 	movabs $0x804eb4,%rcx
+  800761:	00 00 00 
+  800764:	48 b8 a3 4e 80 00 00 	movabs $0x804ea3,%rax
+  80076b:	00 00 00 
+  80076e:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800772:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800776:	ba 00 00 00 00       	mov    $0x0,%edx
+  80077b:	49 f7 f7             	div    %r15
+  80077e:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800782:	4c 89 ee             	mov    %r13,%rsi
+  800785:	41 ff d4             	call   *%r12
+}
+  800788:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80078c:	5b                   	pop    %rbx
+  80078d:	41 5c                	pop    %r12
+  80078f:	41 5d                	pop    %r13
+  800791:	41 5e                	pop    %r14
+  800793:	41 5f                	pop    %r15
+  800795:	5d                   	pop    %rbp
+  800796:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800797:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80079b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8007a0:	49 f7 f7             	div    %r15
+  8007a3:	48 83 ec 08          	sub    $0x8,%rsp
+  8007a7:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8007ab:	52                   	push   %rdx
+  8007ac:	45 0f be c9          	movsbl %r9b,%r9d
+  8007b0:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8007b4:	48 89 c2             	mov    %rax,%rdx
+  8007b7:	48 b8 13 07 80 00 00 	movabs $0x800713,%rax
+  8007be:	00 00 00 
+  8007c1:	ff d0                	call   *%rax
+  8007c3:	48 83 c4 10          	add    $0x10,%rsp
+  8007c7:	eb 8d                	jmp    800756 <print_num+0x43>
+
+00000000008007c9 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8007c9:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8007cd:	48 8b 06             	mov    (%rsi),%rax
+  8007d0:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8007d4:	73 0a                	jae    8007e0 <sprintputch+0x17>
+        *state->start++ = ch;
+  8007d6:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8007da:	48 89 16             	mov    %rdx,(%rsi)
+  8007dd:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8007e0:	c3                   	ret
+
+00000000008007e1 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8007e1:	55                   	push   %rbp
+  8007e2:	48 89 e5             	mov    %rsp,%rbp
+  8007e5:	48 83 ec 50          	sub    $0x50,%rsp
+  8007e9:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8007ed:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8007f1:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8007f5:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8007fc:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800800:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800804:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800808:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80080c:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800810:	48 b8 1e 08 80 00 00 	movabs $0x80081e,%rax
+  800817:	00 00 00 
+  80081a:	ff d0                	call   *%rax
+}
+  80081c:	c9                   	leave
+  80081d:	c3                   	ret
+
+000000000080081e <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80081e:	55                   	push   %rbp
+  80081f:	48 89 e5             	mov    %rsp,%rbp
+  800822:	41 57                	push   %r15
+  800824:	41 56                	push   %r14
+  800826:	41 55                	push   %r13
+  800828:	41 54                	push   %r12
+  80082a:	53                   	push   %rbx
+  80082b:	48 83 ec 38          	sub    $0x38,%rsp
+  80082f:	49 89 fe             	mov    %rdi,%r14
+  800832:	49 89 f5             	mov    %rsi,%r13
+  800835:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800838:	48 8b 01             	mov    (%rcx),%rax
+  80083b:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80083f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800843:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800847:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80084b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80084f:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800853:	0f b6 3b             	movzbl (%rbx),%edi
+  800856:	40 80 ff 25          	cmp    $0x25,%dil
+  80085a:	74 18                	je     800874 <vprintfmt+0x56>
+            if (!ch) return;
+  80085c:	40 84 ff             	test   %dil,%dil
+  80085f:	0f 84 b1 06 00 00    	je     800f16 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800865:	40 0f b6 ff          	movzbl %dil,%edi
+  800869:	4c 89 ee             	mov    %r13,%rsi
+  80086c:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80086f:	4c 89 e3             	mov    %r12,%rbx
+  800872:	eb db                	jmp    80084f <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800874:	be 00 00 00 00       	mov    $0x0,%esi
+  800879:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80087d:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800882:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800888:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80088f:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800893:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800898:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80089d:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8008a0:	83 e8 23             	sub    $0x23,%eax
+  8008a3:	3c 57                	cmp    $0x57,%al
+  8008a5:	0f 87 51 06 00 00    	ja     800efc <vprintfmt+0x6de>
+  8008ab:	0f b6 c0             	movzbl %al,%eax
+  8008ae:	48 b9 60 50 80 00 00 	movabs $0x805060,%rcx
+  8008b5:	00 00 00 
+  8008b8:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8008bb:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8008be:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8008c2:	eb cf                	jmp    800893 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8008c4:	49 89 dc             	mov    %rbx,%r12
+  8008c7:	be 01 00 00 00       	mov    $0x1,%esi
+  8008cc:	eb c5                	jmp    800893 <vprintfmt+0x75>
+            padc = ch;
+  8008ce:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8008d2:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8008d5:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8008d8:	eb b9                	jmp    800893 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8008da:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008dd:	83 f8 2f             	cmp    $0x2f,%eax
+  8008e0:	77 24                	ja     800906 <vprintfmt+0xe8>
+  8008e2:	89 c1                	mov    %eax,%ecx
+  8008e4:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8008e8:	83 c0 08             	add    $0x8,%eax
+  8008eb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008ee:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8008f1:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8008f4:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8008f8:	79 99                	jns    800893 <vprintfmt+0x75>
+                width = precision;
+  8008fa:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8008fe:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800904:	eb 8d                	jmp    800893 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800906:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80090a:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80090e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800912:	eb da                	jmp    8008ee <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800914:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800919:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80091d:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800923:	3c 39                	cmp    $0x39,%al
+  800925:	77 1c                	ja     800943 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800927:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80092b:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80092f:	0f b6 c0             	movzbl %al,%eax
+  800932:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800937:	0f b6 03             	movzbl (%rbx),%eax
+  80093a:	3c 39                	cmp    $0x39,%al
+  80093c:	76 e9                	jbe    800927 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80093e:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800941:	eb b1                	jmp    8008f4 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800943:	49 89 dc             	mov    %rbx,%r12
+  800946:	eb ac                	jmp    8008f4 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800948:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80094b:	85 c9                	test   %ecx,%ecx
+  80094d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800952:	0f 49 c1             	cmovns %ecx,%eax
+  800955:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800958:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80095b:	e9 33 ff ff ff       	jmp    800893 <vprintfmt+0x75>
+            lflag++;
+  800960:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800963:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800966:	e9 28 ff ff ff       	jmp    800893 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80096b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80096e:	83 f8 2f             	cmp    $0x2f,%eax
+  800971:	77 19                	ja     80098c <vprintfmt+0x16e>
+  800973:	89 c2                	mov    %eax,%edx
+  800975:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800979:	83 c0 08             	add    $0x8,%eax
+  80097c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80097f:	8b 3a                	mov    (%rdx),%edi
+  800981:	4c 89 ee             	mov    %r13,%rsi
+  800984:	41 ff d6             	call   *%r14
+            break;
+  800987:	e9 c3 fe ff ff       	jmp    80084f <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80098c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800990:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800994:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800998:	eb e5                	jmp    80097f <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80099a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80099d:	83 f8 2f             	cmp    $0x2f,%eax
+  8009a0:	77 5a                	ja     8009fc <vprintfmt+0x1de>
+  8009a2:	89 c2                	mov    %eax,%edx
+  8009a4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009a8:	83 c0 08             	add    $0x8,%eax
+  8009ab:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8009ae:	8b 02                	mov    (%rdx),%eax
+  8009b0:	89 c1                	mov    %eax,%ecx
+  8009b2:	f7 d9                	neg    %ecx
+  8009b4:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8009b7:	83 f9 16             	cmp    $0x16,%ecx
+  8009ba:	7f 4e                	jg     800a0a <vprintfmt+0x1ec>
+  8009bc:	48 63 c1             	movslq %ecx,%rax
+  8009bf:	48 ba 20 53 80 00 00 	movabs $0x805320,%rdx
+  8009c6:	00 00 00 
+  8009c9:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8009cd:	48 85 c0             	test   %rax,%rax
+  8009d0:	74 38                	je     800a0a <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8009d2:	48 89 c1             	mov    %rax,%rcx
+  8009d5:	48 ba 19 55 80 00 00 	movabs $0x805519,%rdx
+  8009dc:	00 00 00 
+  8009df:	4c 89 ee             	mov    %r13,%rsi
+  8009e2:	4c 89 f7             	mov    %r14,%rdi
+  8009e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009ea:	49 b8 e1 07 80 00 00 	movabs $0x8007e1,%r8
+  8009f1:	00 00 00 
+  8009f4:	41 ff d0             	call   *%r8
+  8009f7:	e9 53 fe ff ff       	jmp    80084f <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8009fc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a00:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a04:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a08:	eb a4                	jmp    8009ae <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800a0a:	48 ba cc 4e 80 00 00 	movabs $0x804ecc,%rdx
+  800a11:	00 00 00 
+  800a14:	4c 89 ee             	mov    %r13,%rsi
+  800a17:	4c 89 f7             	mov    %r14,%rdi
+  800a1a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a1f:	49 b8 e1 07 80 00 00 	movabs $0x8007e1,%r8
+  800a26:	00 00 00 
+  800a29:	41 ff d0             	call   *%r8
+  800a2c:	e9 1e fe ff ff       	jmp    80084f <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800a31:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a34:	83 f8 2f             	cmp    $0x2f,%eax
+  800a37:	77 6c                	ja     800aa5 <vprintfmt+0x287>
+  800a39:	89 c2                	mov    %eax,%edx
+  800a3b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a3f:	83 c0 08             	add    $0x8,%eax
+  800a42:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a45:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800a48:	48 85 d2             	test   %rdx,%rdx
+  800a4b:	48 b8 c5 4e 80 00 00 	movabs $0x804ec5,%rax
+  800a52:	00 00 00 
+  800a55:	48 0f 45 c2          	cmovne %rdx,%rax
+  800a59:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800a5d:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800a61:	7e 06                	jle    800a69 <vprintfmt+0x24b>
+  800a63:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800a67:	75 4a                	jne    800ab3 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800a69:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a6d:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800a71:	0f b6 00             	movzbl (%rax),%eax
+  800a74:	84 c0                	test   %al,%al
+  800a76:	0f 85 9a 00 00 00    	jne    800b16 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800a7c:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800a7f:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800a83:	85 c0                	test   %eax,%eax
+  800a85:	0f 8e c4 fd ff ff    	jle    80084f <vprintfmt+0x31>
+  800a8b:	4c 89 ee             	mov    %r13,%rsi
+  800a8e:	bf 20 00 00 00       	mov    $0x20,%edi
+  800a93:	41 ff d6             	call   *%r14
+  800a96:	41 83 ec 01          	sub    $0x1,%r12d
+  800a9a:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800a9e:	75 eb                	jne    800a8b <vprintfmt+0x26d>
+  800aa0:	e9 aa fd ff ff       	jmp    80084f <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800aa5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aa9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aad:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ab1:	eb 92                	jmp    800a45 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800ab3:	49 63 f7             	movslq %r15d,%rsi
+  800ab6:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800aba:	48 b8 d0 0f 80 00 00 	movabs $0x800fd0,%rax
+  800ac1:	00 00 00 
+  800ac4:	ff d0                	call   *%rax
+  800ac6:	48 89 c2             	mov    %rax,%rdx
+  800ac9:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800acc:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800ace:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800ad1:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800ad4:	85 c0                	test   %eax,%eax
+  800ad6:	7e 91                	jle    800a69 <vprintfmt+0x24b>
+  800ad8:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800add:	4c 89 ee             	mov    %r13,%rsi
+  800ae0:	44 89 e7             	mov    %r12d,%edi
+  800ae3:	41 ff d6             	call   *%r14
+  800ae6:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800aea:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800aed:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800af0:	75 eb                	jne    800add <vprintfmt+0x2bf>
+  800af2:	e9 72 ff ff ff       	jmp    800a69 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800af7:	0f b6 f8             	movzbl %al,%edi
+  800afa:	4c 89 ee             	mov    %r13,%rsi
+  800afd:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800b00:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800b04:	49 83 c4 01          	add    $0x1,%r12
+  800b08:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800b0e:	84 c0                	test   %al,%al
+  800b10:	0f 84 66 ff ff ff    	je     800a7c <vprintfmt+0x25e>
+  800b16:	45 85 ff             	test   %r15d,%r15d
+  800b19:	78 0a                	js     800b25 <vprintfmt+0x307>
+  800b1b:	41 83 ef 01          	sub    $0x1,%r15d
+  800b1f:	0f 88 57 ff ff ff    	js     800a7c <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800b25:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800b29:	74 cc                	je     800af7 <vprintfmt+0x2d9>
+  800b2b:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800b2e:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800b33:	80 fa 5e             	cmp    $0x5e,%dl
+  800b36:	77 c2                	ja     800afa <vprintfmt+0x2dc>
+  800b38:	eb bd                	jmp    800af7 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800b3a:	40 84 f6             	test   %sil,%sil
+  800b3d:	75 26                	jne    800b65 <vprintfmt+0x347>
+    switch (lflag) {
+  800b3f:	85 d2                	test   %edx,%edx
+  800b41:	74 59                	je     800b9c <vprintfmt+0x37e>
+  800b43:	83 fa 01             	cmp    $0x1,%edx
+  800b46:	74 7b                	je     800bc3 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800b48:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b4b:	83 f8 2f             	cmp    $0x2f,%eax
+  800b4e:	0f 87 96 00 00 00    	ja     800bea <vprintfmt+0x3cc>
+  800b54:	89 c2                	mov    %eax,%edx
+  800b56:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b5a:	83 c0 08             	add    $0x8,%eax
+  800b5d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b60:	4c 8b 22             	mov    (%rdx),%r12
+  800b63:	eb 17                	jmp    800b7c <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800b65:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b68:	83 f8 2f             	cmp    $0x2f,%eax
+  800b6b:	77 21                	ja     800b8e <vprintfmt+0x370>
+  800b6d:	89 c2                	mov    %eax,%edx
+  800b6f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b73:	83 c0 08             	add    $0x8,%eax
+  800b76:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b79:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800b7c:	4d 85 e4             	test   %r12,%r12
+  800b7f:	78 7a                	js     800bfb <vprintfmt+0x3dd>
+            num = i;
+  800b81:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800b84:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800b89:	e9 50 02 00 00       	jmp    800dde <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b8e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b92:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b96:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b9a:	eb dd                	jmp    800b79 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800b9c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b9f:	83 f8 2f             	cmp    $0x2f,%eax
+  800ba2:	77 11                	ja     800bb5 <vprintfmt+0x397>
+  800ba4:	89 c2                	mov    %eax,%edx
+  800ba6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800baa:	83 c0 08             	add    $0x8,%eax
+  800bad:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bb0:	4c 63 22             	movslq (%rdx),%r12
+  800bb3:	eb c7                	jmp    800b7c <vprintfmt+0x35e>
+  800bb5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bb9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bbd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bc1:	eb ed                	jmp    800bb0 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800bc3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bc6:	83 f8 2f             	cmp    $0x2f,%eax
+  800bc9:	77 11                	ja     800bdc <vprintfmt+0x3be>
+  800bcb:	89 c2                	mov    %eax,%edx
+  800bcd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bd1:	83 c0 08             	add    $0x8,%eax
+  800bd4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bd7:	4c 8b 22             	mov    (%rdx),%r12
+  800bda:	eb a0                	jmp    800b7c <vprintfmt+0x35e>
+  800bdc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800be0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800be4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800be8:	eb ed                	jmp    800bd7 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800bea:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bee:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bf2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bf6:	e9 65 ff ff ff       	jmp    800b60 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800bfb:	4c 89 ee             	mov    %r13,%rsi
+  800bfe:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800c03:	41 ff d6             	call   *%r14
+                i = -i;
+  800c06:	49 f7 dc             	neg    %r12
+  800c09:	e9 73 ff ff ff       	jmp    800b81 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800c0e:	40 84 f6             	test   %sil,%sil
+  800c11:	75 32                	jne    800c45 <vprintfmt+0x427>
+    switch (lflag) {
+  800c13:	85 d2                	test   %edx,%edx
+  800c15:	74 5d                	je     800c74 <vprintfmt+0x456>
+  800c17:	83 fa 01             	cmp    $0x1,%edx
+  800c1a:	0f 84 82 00 00 00    	je     800ca2 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800c20:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c23:	83 f8 2f             	cmp    $0x2f,%eax
+  800c26:	0f 87 a5 00 00 00    	ja     800cd1 <vprintfmt+0x4b3>
+  800c2c:	89 c2                	mov    %eax,%edx
+  800c2e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c32:	83 c0 08             	add    $0x8,%eax
+  800c35:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c38:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800c3b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800c40:	e9 99 01 00 00       	jmp    800dde <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800c45:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c48:	83 f8 2f             	cmp    $0x2f,%eax
+  800c4b:	77 19                	ja     800c66 <vprintfmt+0x448>
+  800c4d:	89 c2                	mov    %eax,%edx
+  800c4f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c53:	83 c0 08             	add    $0x8,%eax
+  800c56:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c59:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800c5c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800c61:	e9 78 01 00 00       	jmp    800dde <vprintfmt+0x5c0>
+  800c66:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c6a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c6e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c72:	eb e5                	jmp    800c59 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800c74:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c77:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7a:	77 18                	ja     800c94 <vprintfmt+0x476>
+  800c7c:	89 c2                	mov    %eax,%edx
+  800c7e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c82:	83 c0 08             	add    $0x8,%eax
+  800c85:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c88:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800c8a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800c8f:	e9 4a 01 00 00       	jmp    800dde <vprintfmt+0x5c0>
+  800c94:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c98:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c9c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ca0:	eb e6                	jmp    800c88 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800ca2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ca5:	83 f8 2f             	cmp    $0x2f,%eax
+  800ca8:	77 19                	ja     800cc3 <vprintfmt+0x4a5>
+  800caa:	89 c2                	mov    %eax,%edx
+  800cac:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cb0:	83 c0 08             	add    $0x8,%eax
+  800cb3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cb6:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800cb9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800cbe:	e9 1b 01 00 00       	jmp    800dde <vprintfmt+0x5c0>
+  800cc3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cc7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ccb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ccf:	eb e5                	jmp    800cb6 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800cd1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cd5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cd9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cdd:	e9 56 ff ff ff       	jmp    800c38 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800ce2:	40 84 f6             	test   %sil,%sil
+  800ce5:	75 2e                	jne    800d15 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800ce7:	85 d2                	test   %edx,%edx
+  800ce9:	74 59                	je     800d44 <vprintfmt+0x526>
+  800ceb:	83 fa 01             	cmp    $0x1,%edx
+  800cee:	74 7f                	je     800d6f <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800cf0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cf3:	83 f8 2f             	cmp    $0x2f,%eax
+  800cf6:	0f 87 9f 00 00 00    	ja     800d9b <vprintfmt+0x57d>
+  800cfc:	89 c2                	mov    %eax,%edx
+  800cfe:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d02:	83 c0 08             	add    $0x8,%eax
+  800d05:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d08:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800d0b:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800d10:	e9 c9 00 00 00       	jmp    800dde <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800d15:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d18:	83 f8 2f             	cmp    $0x2f,%eax
+  800d1b:	77 19                	ja     800d36 <vprintfmt+0x518>
+  800d1d:	89 c2                	mov    %eax,%edx
+  800d1f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d23:	83 c0 08             	add    $0x8,%eax
+  800d26:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d29:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800d2c:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800d31:	e9 a8 00 00 00       	jmp    800dde <vprintfmt+0x5c0>
+  800d36:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d3a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d3e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d42:	eb e5                	jmp    800d29 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800d44:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d47:	83 f8 2f             	cmp    $0x2f,%eax
+  800d4a:	77 15                	ja     800d61 <vprintfmt+0x543>
+  800d4c:	89 c2                	mov    %eax,%edx
+  800d4e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d52:	83 c0 08             	add    $0x8,%eax
+  800d55:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d58:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800d5a:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800d5f:	eb 7d                	jmp    800dde <vprintfmt+0x5c0>
+  800d61:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d65:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d69:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d6d:	eb e9                	jmp    800d58 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800d6f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d72:	83 f8 2f             	cmp    $0x2f,%eax
+  800d75:	77 16                	ja     800d8d <vprintfmt+0x56f>
+  800d77:	89 c2                	mov    %eax,%edx
+  800d79:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d7d:	83 c0 08             	add    $0x8,%eax
+  800d80:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d83:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800d86:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800d8b:	eb 51                	jmp    800dde <vprintfmt+0x5c0>
+  800d8d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d91:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d95:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d99:	eb e8                	jmp    800d83 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800d9b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d9f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800da3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800da7:	e9 5c ff ff ff       	jmp    800d08 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800dac:	4c 89 ee             	mov    %r13,%rsi
+  800daf:	bf 30 00 00 00       	mov    $0x30,%edi
+  800db4:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800db7:	4c 89 ee             	mov    %r13,%rsi
+  800dba:	bf 78 00 00 00       	mov    $0x78,%edi
+  800dbf:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800dc2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800dc5:	83 f8 2f             	cmp    $0x2f,%eax
+  800dc8:	77 47                	ja     800e11 <vprintfmt+0x5f3>
+  800dca:	89 c2                	mov    %eax,%edx
+  800dcc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800dd0:	83 c0 08             	add    $0x8,%eax
+  800dd3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800dd6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800dd9:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800dde:	48 83 ec 08          	sub    $0x8,%rsp
+  800de2:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800de6:	0f 94 c0             	sete   %al
+  800de9:	0f b6 c0             	movzbl %al,%eax
+  800dec:	50                   	push   %rax
+  800ded:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800df2:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800df6:	4c 89 ee             	mov    %r13,%rsi
+  800df9:	4c 89 f7             	mov    %r14,%rdi
+  800dfc:	48 b8 13 07 80 00 00 	movabs $0x800713,%rax
+  800e03:	00 00 00 
+  800e06:	ff d0                	call   *%rax
+            break;
+  800e08:	48 83 c4 10          	add    $0x10,%rsp
+  800e0c:	e9 3e fa ff ff       	jmp    80084f <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800e11:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e15:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e19:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e1d:	eb b7                	jmp    800dd6 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800e1f:	40 84 f6             	test   %sil,%sil
+  800e22:	75 2b                	jne    800e4f <vprintfmt+0x631>
+    switch (lflag) {
+  800e24:	85 d2                	test   %edx,%edx
+  800e26:	74 56                	je     800e7e <vprintfmt+0x660>
+  800e28:	83 fa 01             	cmp    $0x1,%edx
+  800e2b:	74 7f                	je     800eac <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800e2d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e30:	83 f8 2f             	cmp    $0x2f,%eax
+  800e33:	0f 87 a2 00 00 00    	ja     800edb <vprintfmt+0x6bd>
+  800e39:	89 c2                	mov    %eax,%edx
+  800e3b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e3f:	83 c0 08             	add    $0x8,%eax
+  800e42:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e45:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800e48:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800e4d:	eb 8f                	jmp    800dde <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800e4f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e52:	83 f8 2f             	cmp    $0x2f,%eax
+  800e55:	77 19                	ja     800e70 <vprintfmt+0x652>
+  800e57:	89 c2                	mov    %eax,%edx
+  800e59:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e5d:	83 c0 08             	add    $0x8,%eax
+  800e60:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e63:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800e66:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800e6b:	e9 6e ff ff ff       	jmp    800dde <vprintfmt+0x5c0>
+  800e70:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e74:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e78:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e7c:	eb e5                	jmp    800e63 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800e7e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e81:	83 f8 2f             	cmp    $0x2f,%eax
+  800e84:	77 18                	ja     800e9e <vprintfmt+0x680>
+  800e86:	89 c2                	mov    %eax,%edx
+  800e88:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e8c:	83 c0 08             	add    $0x8,%eax
+  800e8f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e92:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800e94:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800e99:	e9 40 ff ff ff       	jmp    800dde <vprintfmt+0x5c0>
+  800e9e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ea2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ea6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800eaa:	eb e6                	jmp    800e92 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800eac:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800eaf:	83 f8 2f             	cmp    $0x2f,%eax
+  800eb2:	77 19                	ja     800ecd <vprintfmt+0x6af>
+  800eb4:	89 c2                	mov    %eax,%edx
+  800eb6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800eba:	83 c0 08             	add    $0x8,%eax
+  800ebd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ec0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ec3:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800ec8:	e9 11 ff ff ff       	jmp    800dde <vprintfmt+0x5c0>
+  800ecd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ed1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ed5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ed9:	eb e5                	jmp    800ec0 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800edb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800edf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ee3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ee7:	e9 59 ff ff ff       	jmp    800e45 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800eec:	4c 89 ee             	mov    %r13,%rsi
+  800eef:	bf 25 00 00 00       	mov    $0x25,%edi
+  800ef4:	41 ff d6             	call   *%r14
+            break;
+  800ef7:	e9 53 f9 ff ff       	jmp    80084f <vprintfmt+0x31>
+            putch('%', put_arg);
+  800efc:	4c 89 ee             	mov    %r13,%rsi
+  800eff:	bf 25 00 00 00       	mov    $0x25,%edi
+  800f04:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800f07:	48 83 eb 01          	sub    $0x1,%rbx
+  800f0b:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800f0f:	75 f6                	jne    800f07 <vprintfmt+0x6e9>
+  800f11:	e9 39 f9 ff ff       	jmp    80084f <vprintfmt+0x31>
+}
+  800f16:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800f1a:	5b                   	pop    %rbx
+  800f1b:	41 5c                	pop    %r12
+  800f1d:	41 5d                	pop    %r13
+  800f1f:	41 5e                	pop    %r14
+  800f21:	41 5f                	pop    %r15
+  800f23:	5d                   	pop    %rbp
+  800f24:	c3                   	ret
+
+0000000000800f25 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800f25:	55                   	push   %rbp
+  800f26:	48 89 e5             	mov    %rsp,%rbp
+  800f29:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800f2d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800f31:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800f36:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800f3a:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800f41:	48 85 ff             	test   %rdi,%rdi
+  800f44:	74 2b                	je     800f71 <vsnprintf+0x4c>
+  800f46:	48 85 f6             	test   %rsi,%rsi
+  800f49:	74 26                	je     800f71 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800f4b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800f4f:	48 bf c9 07 80 00 00 	movabs $0x8007c9,%rdi
+  800f56:	00 00 00 
+  800f59:	48 b8 1e 08 80 00 00 	movabs $0x80081e,%rax
+  800f60:	00 00 00 
+  800f63:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800f65:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f69:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800f6c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800f6f:	c9                   	leave
+  800f70:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800f71:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f76:	eb f7                	jmp    800f6f <vsnprintf+0x4a>
+
+0000000000800f78 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800f78:	55                   	push   %rbp
+  800f79:	48 89 e5             	mov    %rsp,%rbp
+  800f7c:	48 83 ec 50          	sub    $0x50,%rsp
+  800f80:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800f84:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800f88:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800f8c:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800f93:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800f97:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f9b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800f9f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800fa3:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800fa7:	48 b8 25 0f 80 00 00 	movabs $0x800f25,%rax
+  800fae:	00 00 00 
+  800fb1:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800fb3:	c9                   	leave
+  800fb4:	c3                   	ret
+
+0000000000800fb5 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800fb5:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800fb8:	74 10                	je     800fca <strlen+0x15>
+    size_t n = 0;
+  800fba:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800fbf:	48 83 c0 01          	add    $0x1,%rax
+  800fc3:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800fc7:	75 f6                	jne    800fbf <strlen+0xa>
+  800fc9:	c3                   	ret
+    size_t n = 0;
+  800fca:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800fcf:	c3                   	ret
+
+0000000000800fd0 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800fd0:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800fd3:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800fd8:	48 85 f6             	test   %rsi,%rsi
+  800fdb:	74 11                	je     800fee <strnlen+0x1e>
+  800fdd:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800fe1:	74 0c                	je     800fef <strnlen+0x1f>
+  800fe3:	48 83 c2 01          	add    $0x1,%rdx
+  800fe7:	48 39 d0             	cmp    %rdx,%rax
+  800fea:	75 f1                	jne    800fdd <strnlen+0xd>
+  800fec:	eb 04                	jmp    800ff2 <strnlen+0x22>
+  800fee:	c3                   	ret
+  800fef:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800ff2:	c3                   	ret
+
+0000000000800ff3 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800ff3:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800ff6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ffb:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800fff:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  801002:	48 83 c2 01          	add    $0x1,%rdx
+  801006:	84 c9                	test   %cl,%cl
+  801008:	75 f1                	jne    800ffb <strcpy+0x8>
+        ;
+    return res;
+}
+  80100a:	c3                   	ret
+
+000000000080100b <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  80100b:	55                   	push   %rbp
+  80100c:	48 89 e5             	mov    %rsp,%rbp
+  80100f:	41 54                	push   %r12
+  801011:	53                   	push   %rbx
+  801012:	48 89 fb             	mov    %rdi,%rbx
+  801015:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  801018:	48 b8 b5 0f 80 00 00 	movabs $0x800fb5,%rax
+  80101f:	00 00 00 
+  801022:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  801024:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  801028:	4c 89 e6             	mov    %r12,%rsi
+  80102b:	48 b8 f3 0f 80 00 00 	movabs $0x800ff3,%rax
+  801032:	00 00 00 
+  801035:	ff d0                	call   *%rax
+    return dst;
+}
+  801037:	48 89 d8             	mov    %rbx,%rax
+  80103a:	5b                   	pop    %rbx
+  80103b:	41 5c                	pop    %r12
+  80103d:	5d                   	pop    %rbp
+  80103e:	c3                   	ret
+
+000000000080103f <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80103f:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  801042:	48 85 d2             	test   %rdx,%rdx
+  801045:	74 1f                	je     801066 <strncpy+0x27>
+  801047:	48 01 fa             	add    %rdi,%rdx
+  80104a:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  80104d:	48 83 c1 01          	add    $0x1,%rcx
+  801051:	44 0f b6 06          	movzbl (%rsi),%r8d
+  801055:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  801059:	41 80 f8 01          	cmp    $0x1,%r8b
+  80105d:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  801061:	48 39 ca             	cmp    %rcx,%rdx
+  801064:	75 e7                	jne    80104d <strncpy+0xe>
+    }
+    return ret;
+}
+  801066:	c3                   	ret
+
+0000000000801067 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  801067:	48 89 f8             	mov    %rdi,%rax
+  80106a:	48 85 d2             	test   %rdx,%rdx
+  80106d:	74 24                	je     801093 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  80106f:	48 83 ea 01          	sub    $0x1,%rdx
+  801073:	74 1b                	je     801090 <strlcpy+0x29>
+  801075:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  801079:	0f b6 16             	movzbl (%rsi),%edx
+  80107c:	84 d2                	test   %dl,%dl
+  80107e:	74 10                	je     801090 <strlcpy+0x29>
+            *dst++ = *src++;
+  801080:	48 83 c6 01          	add    $0x1,%rsi
+  801084:	48 83 c0 01          	add    $0x1,%rax
+  801088:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  80108b:	48 39 c8             	cmp    %rcx,%rax
+  80108e:	75 e9                	jne    801079 <strlcpy+0x12>
+        *dst = '\0';
+  801090:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  801093:	48 29 f8             	sub    %rdi,%rax
+}
+  801096:	c3                   	ret
+
+0000000000801097 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  801097:	0f b6 07             	movzbl (%rdi),%eax
+  80109a:	84 c0                	test   %al,%al
+  80109c:	74 13                	je     8010b1 <strcmp+0x1a>
+  80109e:	38 06                	cmp    %al,(%rsi)
+  8010a0:	75 0f                	jne    8010b1 <strcmp+0x1a>
+  8010a2:	48 83 c7 01          	add    $0x1,%rdi
+  8010a6:	48 83 c6 01          	add    $0x1,%rsi
+  8010aa:	0f b6 07             	movzbl (%rdi),%eax
+  8010ad:	84 c0                	test   %al,%al
+  8010af:	75 ed                	jne    80109e <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8010b1:	0f b6 c0             	movzbl %al,%eax
+  8010b4:	0f b6 16             	movzbl (%rsi),%edx
+  8010b7:	29 d0                	sub    %edx,%eax
+}
+  8010b9:	c3                   	ret
+
+00000000008010ba <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  8010ba:	48 85 d2             	test   %rdx,%rdx
+  8010bd:	74 1f                	je     8010de <strncmp+0x24>
+  8010bf:	0f b6 07             	movzbl (%rdi),%eax
+  8010c2:	84 c0                	test   %al,%al
+  8010c4:	74 1e                	je     8010e4 <strncmp+0x2a>
+  8010c6:	3a 06                	cmp    (%rsi),%al
+  8010c8:	75 1a                	jne    8010e4 <strncmp+0x2a>
+  8010ca:	48 83 c7 01          	add    $0x1,%rdi
+  8010ce:	48 83 c6 01          	add    $0x1,%rsi
+  8010d2:	48 83 ea 01          	sub    $0x1,%rdx
+  8010d6:	75 e7                	jne    8010bf <strncmp+0x5>
+
+    if (!n) return 0;
+  8010d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010dd:	c3                   	ret
+  8010de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010e3:	c3                   	ret
+  8010e4:	48 85 d2             	test   %rdx,%rdx
+  8010e7:	74 09                	je     8010f2 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8010e9:	0f b6 07             	movzbl (%rdi),%eax
+  8010ec:	0f b6 16             	movzbl (%rsi),%edx
+  8010ef:	29 d0                	sub    %edx,%eax
+  8010f1:	c3                   	ret
+    if (!n) return 0;
+  8010f2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8010f7:	c3                   	ret
+
+00000000008010f8 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8010f8:	0f b6 17             	movzbl (%rdi),%edx
+  8010fb:	84 d2                	test   %dl,%dl
+  8010fd:	74 18                	je     801117 <strchr+0x1f>
+        if (*str == c) {
+  8010ff:	0f be d2             	movsbl %dl,%edx
+  801102:	39 f2                	cmp    %esi,%edx
+  801104:	74 17                	je     80111d <strchr+0x25>
+    for (; *str; str++) {
+  801106:	48 83 c7 01          	add    $0x1,%rdi
+  80110a:	0f b6 17             	movzbl (%rdi),%edx
+  80110d:	84 d2                	test   %dl,%dl
+  80110f:	75 ee                	jne    8010ff <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  801111:	b8 00 00 00 00       	mov    $0x0,%eax
+  801116:	c3                   	ret
+  801117:	b8 00 00 00 00       	mov    $0x0,%eax
+  80111c:	c3                   	ret
+  80111d:	48 89 f8             	mov    %rdi,%rax
+}
+  801120:	c3                   	ret
+
+0000000000801121 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  801121:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  801124:	0f b6 17             	movzbl (%rdi),%edx
+  801127:	84 d2                	test   %dl,%dl
+  801129:	74 13                	je     80113e <strfind+0x1d>
+  80112b:	0f be d2             	movsbl %dl,%edx
+  80112e:	39 f2                	cmp    %esi,%edx
+  801130:	74 0b                	je     80113d <strfind+0x1c>
+  801132:	48 83 c0 01          	add    $0x1,%rax
+  801136:	0f b6 10             	movzbl (%rax),%edx
+  801139:	84 d2                	test   %dl,%dl
+  80113b:	75 ee                	jne    80112b <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  80113d:	c3                   	ret
+  80113e:	c3                   	ret
+
+000000000080113f <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  80113f:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  801142:	48 89 f8             	mov    %rdi,%rax
+  801145:	48 f7 d8             	neg    %rax
+  801148:	83 e0 07             	and    $0x7,%eax
+  80114b:	49 89 d1             	mov    %rdx,%r9
+  80114e:	49 29 c1             	sub    %rax,%r9
+  801151:	78 36                	js     801189 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  801153:	40 0f b6 c6          	movzbl %sil,%eax
+  801157:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  80115e:	01 01 01 
+  801161:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  801165:	40 f6 c7 07          	test   $0x7,%dil
+  801169:	75 38                	jne    8011a3 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  80116b:	4c 89 c9             	mov    %r9,%rcx
+  80116e:	48 c1 f9 03          	sar    $0x3,%rcx
+  801172:	74 0c                	je     801180 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  801174:	fc                   	cld
+  801175:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  801178:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  80117c:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  801180:	4d 85 c9             	test   %r9,%r9
+  801183:	75 45                	jne    8011ca <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  801185:	4c 89 c0             	mov    %r8,%rax
+  801188:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  801189:	48 85 d2             	test   %rdx,%rdx
+  80118c:	74 f7                	je     801185 <memset+0x46>
+  80118e:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  801191:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  801194:	48 83 c0 01          	add    $0x1,%rax
+  801198:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  80119c:	48 39 c2             	cmp    %rax,%rdx
+  80119f:	75 f3                	jne    801194 <memset+0x55>
+  8011a1:	eb e2                	jmp    801185 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8011a3:	40 f6 c7 01          	test   $0x1,%dil
+  8011a7:	74 06                	je     8011af <memset+0x70>
+  8011a9:	88 07                	mov    %al,(%rdi)
+  8011ab:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8011af:	40 f6 c7 02          	test   $0x2,%dil
+  8011b3:	74 07                	je     8011bc <memset+0x7d>
+  8011b5:	66 89 07             	mov    %ax,(%rdi)
+  8011b8:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8011bc:	40 f6 c7 04          	test   $0x4,%dil
+  8011c0:	74 a9                	je     80116b <memset+0x2c>
+  8011c2:	89 07                	mov    %eax,(%rdi)
+  8011c4:	48 83 c7 04          	add    $0x4,%rdi
+  8011c8:	eb a1                	jmp    80116b <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8011ca:	41 f6 c1 04          	test   $0x4,%r9b
+  8011ce:	74 06                	je     8011d6 <memset+0x97>
+  8011d0:	89 07                	mov    %eax,(%rdi)
+  8011d2:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8011d6:	41 f6 c1 02          	test   $0x2,%r9b
+  8011da:	74 07                	je     8011e3 <memset+0xa4>
+  8011dc:	66 89 07             	mov    %ax,(%rdi)
+  8011df:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8011e3:	41 f6 c1 01          	test   $0x1,%r9b
+  8011e7:	74 9c                	je     801185 <memset+0x46>
+  8011e9:	88 07                	mov    %al,(%rdi)
+  8011eb:	eb 98                	jmp    801185 <memset+0x46>
+
+00000000008011ed <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8011ed:	48 89 f8             	mov    %rdi,%rax
+  8011f0:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8011f3:	48 39 fe             	cmp    %rdi,%rsi
+  8011f6:	73 3b                	jae    801233 <memmove+0x46>
+  8011f8:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8011fc:	48 39 d7             	cmp    %rdx,%rdi
+  8011ff:	73 32                	jae    801233 <memmove+0x46>
+        s += n;
+        d += n;
+  801201:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801205:	48 89 d6             	mov    %rdx,%rsi
+  801208:	48 09 fe             	or     %rdi,%rsi
+  80120b:	48 09 ce             	or     %rcx,%rsi
+  80120e:	40 f6 c6 07          	test   $0x7,%sil
+  801212:	75 12                	jne    801226 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  801214:	48 83 ef 08          	sub    $0x8,%rdi
+  801218:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  80121c:	48 c1 e9 03          	shr    $0x3,%rcx
+  801220:	fd                   	std
+  801221:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  801224:	fc                   	cld
+  801225:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801226:	48 83 ef 01          	sub    $0x1,%rdi
+  80122a:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  80122e:	fd                   	std
+  80122f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801231:	eb f1                	jmp    801224 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801233:	48 89 f2             	mov    %rsi,%rdx
+  801236:	48 09 c2             	or     %rax,%rdx
+  801239:	48 09 ca             	or     %rcx,%rdx
+  80123c:	f6 c2 07             	test   $0x7,%dl
+  80123f:	75 0c                	jne    80124d <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801241:	48 c1 e9 03          	shr    $0x3,%rcx
+  801245:	48 89 c7             	mov    %rax,%rdi
+  801248:	fc                   	cld
+  801249:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80124c:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  80124d:	48 89 c7             	mov    %rax,%rdi
+  801250:	fc                   	cld
+  801251:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801253:	c3                   	ret
+
+0000000000801254 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801254:	55                   	push   %rbp
+  801255:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801258:	48 b8 ed 11 80 00 00 	movabs $0x8011ed,%rax
+  80125f:	00 00 00 
+  801262:	ff d0                	call   *%rax
+}
+  801264:	5d                   	pop    %rbp
+  801265:	c3                   	ret
+
+0000000000801266 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801266:	55                   	push   %rbp
+  801267:	48 89 e5             	mov    %rsp,%rbp
+  80126a:	41 57                	push   %r15
+  80126c:	41 56                	push   %r14
+  80126e:	41 55                	push   %r13
+  801270:	41 54                	push   %r12
+  801272:	53                   	push   %rbx
+  801273:	48 83 ec 08          	sub    $0x8,%rsp
+  801277:	49 89 fe             	mov    %rdi,%r14
+  80127a:	49 89 f7             	mov    %rsi,%r15
+  80127d:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801280:	48 89 f7             	mov    %rsi,%rdi
+  801283:	48 b8 b5 0f 80 00 00 	movabs $0x800fb5,%rax
+  80128a:	00 00 00 
+  80128d:	ff d0                	call   *%rax
+  80128f:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801292:	48 89 de             	mov    %rbx,%rsi
+  801295:	4c 89 f7             	mov    %r14,%rdi
+  801298:	48 b8 d0 0f 80 00 00 	movabs $0x800fd0,%rax
+  80129f:	00 00 00 
+  8012a2:	ff d0                	call   *%rax
+  8012a4:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8012a7:	48 39 c3             	cmp    %rax,%rbx
+  8012aa:	74 36                	je     8012e2 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8012ac:	48 89 d8             	mov    %rbx,%rax
+  8012af:	4c 29 e8             	sub    %r13,%rax
+  8012b2:	49 39 c4             	cmp    %rax,%r12
+  8012b5:	73 31                	jae    8012e8 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8012b7:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8012bc:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8012c0:	4c 89 fe             	mov    %r15,%rsi
+  8012c3:	48 b8 54 12 80 00 00 	movabs $0x801254,%rax
+  8012ca:	00 00 00 
+  8012cd:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8012cf:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8012d3:	48 83 c4 08          	add    $0x8,%rsp
+  8012d7:	5b                   	pop    %rbx
+  8012d8:	41 5c                	pop    %r12
+  8012da:	41 5d                	pop    %r13
+  8012dc:	41 5e                	pop    %r14
+  8012de:	41 5f                	pop    %r15
+  8012e0:	5d                   	pop    %rbp
+  8012e1:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8012e2:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8012e6:	eb eb                	jmp    8012d3 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8012e8:	48 83 eb 01          	sub    $0x1,%rbx
+  8012ec:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8012f0:	48 89 da             	mov    %rbx,%rdx
+  8012f3:	4c 89 fe             	mov    %r15,%rsi
+  8012f6:	48 b8 54 12 80 00 00 	movabs $0x801254,%rax
+  8012fd:	00 00 00 
+  801300:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801302:	49 01 de             	add    %rbx,%r14
+  801305:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80130a:	eb c3                	jmp    8012cf <strlcat+0x69>
+
+000000000080130c <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80130c:	48 85 d2             	test   %rdx,%rdx
+  80130f:	74 2d                	je     80133e <memcmp+0x32>
+  801311:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801316:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80131a:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80131f:	44 38 c1             	cmp    %r8b,%cl
+  801322:	75 0f                	jne    801333 <memcmp+0x27>
+    while (n-- > 0) {
+  801324:	48 83 c0 01          	add    $0x1,%rax
+  801328:	48 39 c2             	cmp    %rax,%rdx
+  80132b:	75 e9                	jne    801316 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80132d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801332:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801333:	0f b6 c1             	movzbl %cl,%eax
+  801336:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80133a:	44 29 c0             	sub    %r8d,%eax
+  80133d:	c3                   	ret
+    return 0;
+  80133e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801343:	c3                   	ret
+
+0000000000801344 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801344:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801348:	48 39 c7             	cmp    %rax,%rdi
+  80134b:	73 0f                	jae    80135c <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80134d:	40 38 37             	cmp    %sil,(%rdi)
+  801350:	74 0e                	je     801360 <memfind+0x1c>
+    for (; src < end; src++) {
+  801352:	48 83 c7 01          	add    $0x1,%rdi
+  801356:	48 39 f8             	cmp    %rdi,%rax
+  801359:	75 f2                	jne    80134d <memfind+0x9>
+  80135b:	c3                   	ret
+  80135c:	48 89 f8             	mov    %rdi,%rax
+  80135f:	c3                   	ret
+  801360:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801363:	c3                   	ret
+
+0000000000801364 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801364:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801367:	0f b6 37             	movzbl (%rdi),%esi
+  80136a:	40 80 fe 20          	cmp    $0x20,%sil
+  80136e:	74 06                	je     801376 <strtol+0x12>
+  801370:	40 80 fe 09          	cmp    $0x9,%sil
+  801374:	75 13                	jne    801389 <strtol+0x25>
+  801376:	48 83 c7 01          	add    $0x1,%rdi
+  80137a:	0f b6 37             	movzbl (%rdi),%esi
+  80137d:	40 80 fe 20          	cmp    $0x20,%sil
+  801381:	74 f3                	je     801376 <strtol+0x12>
+  801383:	40 80 fe 09          	cmp    $0x9,%sil
+  801387:	74 ed                	je     801376 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801389:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80138c:	83 e0 fd             	and    $0xfffffffd,%eax
+  80138f:	3c 01                	cmp    $0x1,%al
+  801391:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801395:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80139b:	75 0f                	jne    8013ac <strtol+0x48>
+  80139d:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8013a0:	74 14                	je     8013b6 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8013a2:	85 d2                	test   %edx,%edx
+  8013a4:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8013a9:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8013ac:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8013b1:	4c 63 ca             	movslq %edx,%r9
+  8013b4:	eb 36                	jmp    8013ec <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8013b6:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8013ba:	74 0f                	je     8013cb <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8013bc:	85 d2                	test   %edx,%edx
+  8013be:	75 ec                	jne    8013ac <strtol+0x48>
+        s++;
+  8013c0:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8013c4:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8013c9:	eb e1                	jmp    8013ac <strtol+0x48>
+        s += 2;
+  8013cb:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8013cf:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8013d4:	eb d6                	jmp    8013ac <strtol+0x48>
+            dig -= '0';
+  8013d6:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8013d9:	44 0f b6 c1          	movzbl %cl,%r8d
+  8013dd:	41 39 d0             	cmp    %edx,%r8d
+  8013e0:	7d 21                	jge    801403 <strtol+0x9f>
+        val = val * base + dig;
+  8013e2:	49 0f af c1          	imul   %r9,%rax
+  8013e6:	0f b6 c9             	movzbl %cl,%ecx
+  8013e9:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8013ec:	48 83 c7 01          	add    $0x1,%rdi
+  8013f0:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8013f4:	80 f9 39             	cmp    $0x39,%cl
+  8013f7:	76 dd                	jbe    8013d6 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8013f9:	80 f9 7b             	cmp    $0x7b,%cl
+  8013fc:	77 05                	ja     801403 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8013fe:	83 e9 57             	sub    $0x57,%ecx
+  801401:	eb d6                	jmp    8013d9 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801403:	4d 85 d2             	test   %r10,%r10
+  801406:	74 03                	je     80140b <strtol+0xa7>
+  801408:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80140b:	48 89 c2             	mov    %rax,%rdx
+  80140e:	48 f7 da             	neg    %rdx
+  801411:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801415:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801419:	c3                   	ret
+
+000000000080141a <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  80141a:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80141f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801424:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80142a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801430:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  801436:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801438:	c3                   	ret
+
+0000000000801439 <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  801439:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80143e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801443:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801448:	ba 00 00 00 00       	mov    $0x0,%edx
+  80144d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801453:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801459:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80145f:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801461:	c3                   	ret
+
+0000000000801462 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801462:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801465:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80146a:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80146f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801474:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80147a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801480:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801486:	0f 05                	syscall
+    if (check && ret > 0) {
+  801488:	48 85 c0             	test   %rax,%rax
+  80148b:	7f 01                	jg     80148e <sys_env_destroy+0x2c>
+}
+  80148d:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  80148e:	55                   	push   %rbp
+  80148f:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801492:	49 89 c0             	mov    %rax,%r8
+  801495:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80149a:	48 ba f8 53 80 00 00 	movabs $0x8053f8,%rdx
+  8014a1:	00 00 00 
+  8014a4:	be 29 00 00 00       	mov    $0x29,%esi
+  8014a9:	48 bf 17 54 80 00 00 	movabs $0x805417,%rdi
+  8014b0:	00 00 00 
+  8014b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014b8:	49 b9 7e 05 80 00 00 	movabs $0x80057e,%r9
+  8014bf:	00 00 00 
+  8014c2:	41 ff d1             	call   *%r9
+
+00000000008014c5 <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  8014c5:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8014ca:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014cf:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8014d4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014d9:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014df:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014e5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8014eb:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8014ed:	c3                   	ret
+
+00000000008014ee <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  8014ee:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8014f3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014f8:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8014fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  801502:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801508:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80150e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801514:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801516:	c3                   	ret
+
+0000000000801517 <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  801517:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80151c:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  801523:	00 00 00 
+  801526:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80152c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801532:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801538:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80153a:	c3                   	ret
+
+000000000080153b <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80153b:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  80153e:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801543:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801549:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80154f:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801551:	c3                   	ret
+
+0000000000801552 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801552:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801555:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80155a:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80155d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801563:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801569:	0f 05                	syscall
+    if (check && ret > 0) {
+  80156b:	48 85 c0             	test   %rax,%rax
+  80156e:	7f 01                	jg     801571 <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801570:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801571:	55                   	push   %rbp
+  801572:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801575:	49 89 c0             	mov    %rax,%r8
+  801578:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80157d:	48 ba f8 53 80 00 00 	movabs $0x8053f8,%rdx
+  801584:	00 00 00 
+  801587:	be 29 00 00 00       	mov    $0x29,%esi
+  80158c:	48 bf 17 54 80 00 00 	movabs $0x805417,%rdi
+  801593:	00 00 00 
+  801596:	b8 00 00 00 00       	mov    $0x0,%eax
+  80159b:	49 b9 7e 05 80 00 00 	movabs $0x80057e,%r9
+  8015a2:	00 00 00 
+  8015a5:	41 ff d1             	call   *%r9
+
+00000000008015a8 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8015a8:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8015ab:	48 63 d2             	movslq %edx,%rdx
+  8015ae:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8015b1:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8015b6:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  8015b9:	0f 05                	syscall
+    if (check && ret > 0) {
+  8015bb:	48 85 c0             	test   %rax,%rax
+  8015be:	7f 01                	jg     8015c1 <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8015c0:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8015c1:	55                   	push   %rbp
+  8015c2:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015c5:	49 89 c0             	mov    %rax,%r8
+  8015c8:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8015cd:	48 ba f8 53 80 00 00 	movabs $0x8053f8,%rdx
+  8015d4:	00 00 00 
+  8015d7:	be 29 00 00 00       	mov    $0x29,%esi
+  8015dc:	48 bf 17 54 80 00 00 	movabs $0x805417,%rdi
+  8015e3:	00 00 00 
+  8015e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015eb:	49 b9 7e 05 80 00 00 	movabs $0x80057e,%r9
+  8015f2:	00 00 00 
+  8015f5:	41 ff d1             	call   *%r9
+
+00000000008015f8 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8015f8:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8015fb:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801600:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801606:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80160c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801612:	0f 05                	syscall
+    if (check && ret > 0) {
+  801614:	48 85 c0             	test   %rax,%rax
+  801617:	7f 01                	jg     80161a <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801619:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80161a:	55                   	push   %rbp
+  80161b:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80161e:	49 89 c0             	mov    %rax,%r8
+  801621:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801626:	48 ba f8 53 80 00 00 	movabs $0x8053f8,%rdx
+  80162d:	00 00 00 
+  801630:	be 29 00 00 00       	mov    $0x29,%esi
+  801635:	48 bf 17 54 80 00 00 	movabs $0x805417,%rdi
+  80163c:	00 00 00 
+  80163f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801644:	49 b9 7e 05 80 00 00 	movabs $0x80057e,%r9
+  80164b:	00 00 00 
+  80164e:	41 ff d1             	call   *%r9
+
+0000000000801651 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801651:	48 63 f6             	movslq %esi,%rsi
+  801654:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801657:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80165c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801661:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801667:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80166d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801673:	0f 05                	syscall
+    if (check && ret > 0) {
+  801675:	48 85 c0             	test   %rax,%rax
+  801678:	7f 01                	jg     80167b <sys_env_set_status+0x2a>
+}
+  80167a:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  80167b:	55                   	push   %rbp
+  80167c:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80167f:	49 89 c0             	mov    %rax,%r8
+  801682:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801687:	48 ba f8 53 80 00 00 	movabs $0x8053f8,%rdx
+  80168e:	00 00 00 
+  801691:	be 29 00 00 00       	mov    $0x29,%esi
+  801696:	48 bf 17 54 80 00 00 	movabs $0x805417,%rdi
+  80169d:	00 00 00 
+  8016a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016a5:	49 b9 7e 05 80 00 00 	movabs $0x80057e,%r9
+  8016ac:	00 00 00 
+  8016af:	41 ff d1             	call   *%r9
+
+00000000008016b2 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8016b2:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8016b5:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8016ba:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016bf:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8016c5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8016cb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8016d1:	0f 05                	syscall
+    if (check && ret > 0) {
+  8016d3:	48 85 c0             	test   %rax,%rax
+  8016d6:	7f 01                	jg     8016d9 <sys_env_set_trapframe+0x27>
+}
+  8016d8:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8016d9:	55                   	push   %rbp
+  8016da:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016dd:	49 89 c0             	mov    %rax,%r8
+  8016e0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8016e5:	48 ba f8 53 80 00 00 	movabs $0x8053f8,%rdx
+  8016ec:	00 00 00 
+  8016ef:	be 29 00 00 00       	mov    $0x29,%esi
+  8016f4:	48 bf 17 54 80 00 00 	movabs $0x805417,%rdi
+  8016fb:	00 00 00 
+  8016fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  801703:	49 b9 7e 05 80 00 00 	movabs $0x80057e,%r9
+  80170a:	00 00 00 
+  80170d:	41 ff d1             	call   *%r9
+
+0000000000801710 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801710:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801713:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801718:	ba 00 00 00 00       	mov    $0x0,%edx
+  80171d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801723:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801729:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80172f:	0f 05                	syscall
+    if (check && ret > 0) {
+  801731:	48 85 c0             	test   %rax,%rax
+  801734:	7f 01                	jg     801737 <sys_env_set_pgfault_upcall+0x27>
+}
+  801736:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801737:	55                   	push   %rbp
+  801738:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80173b:	49 89 c0             	mov    %rax,%r8
+  80173e:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801743:	48 ba f8 53 80 00 00 	movabs $0x8053f8,%rdx
+  80174a:	00 00 00 
+  80174d:	be 29 00 00 00       	mov    $0x29,%esi
+  801752:	48 bf 17 54 80 00 00 	movabs $0x805417,%rdi
+  801759:	00 00 00 
+  80175c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801761:	49 b9 7e 05 80 00 00 	movabs $0x80057e,%r9
+  801768:	00 00 00 
+  80176b:	41 ff d1             	call   *%r9
+
+000000000080176e <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80176e:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801771:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801774:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801779:	4d 63 c0             	movslq %r8d,%r8
+  80177c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801782:	0f 05                	syscall
+}
+  801784:	c3                   	ret
+
+0000000000801785 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801785:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801788:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80178b:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801790:	4d 63 c0             	movslq %r8d,%r8
+  801793:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801799:	0f 05                	syscall
+}
+  80179b:	c3                   	ret
+
+000000000080179c <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  80179c:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8017a1:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8017a4:	45 89 c0             	mov    %r8d,%r8d
+  8017a7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8017ad:	0f 05                	syscall
+    if (check && ret > 0) {
+  8017af:	48 85 c0             	test   %rax,%rax
+  8017b2:	7f 01                	jg     8017b5 <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8017b4:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8017b5:	55                   	push   %rbp
+  8017b6:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017b9:	49 89 c0             	mov    %rax,%r8
+  8017bc:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8017c1:	48 ba f8 53 80 00 00 	movabs $0x8053f8,%rdx
+  8017c8:	00 00 00 
+  8017cb:	be 29 00 00 00       	mov    $0x29,%esi
+  8017d0:	48 bf 17 54 80 00 00 	movabs $0x805417,%rdi
+  8017d7:	00 00 00 
+  8017da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017df:	49 b9 7e 05 80 00 00 	movabs $0x80057e,%r9
+  8017e6:	00 00 00 
+  8017e9:	41 ff d1             	call   *%r9
+
+00000000008017ec <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  8017ec:	55                   	push   %rbp
+  8017ed:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  8017f0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8017f6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017fb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801800:	48 b8 9c 17 80 00 00 	movabs $0x80179c,%rax
+  801807:	00 00 00 
+  80180a:	ff d0                	call   *%rax
+}
+  80180c:	5d                   	pop    %rbp
+  80180d:	c3                   	ret
+
+000000000080180e <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  80180e:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801813:	bf 00 00 00 00       	mov    $0x0,%edi
+  801818:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80181d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801822:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801828:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80182e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801834:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801836:	c3                   	ret
+
+0000000000801837 <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  801837:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80183c:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801841:	ba 00 00 00 00       	mov    $0x0,%edx
+  801846:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80184c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801852:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801858:	0f 05                	syscall
+    if (check && ret > 0) {
+  80185a:	48 85 c0             	test   %rax,%rax
+  80185d:	7f 01                	jg     801860 <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  80185f:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  801860:	55                   	push   %rbp
+  801861:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801864:	49 89 c0             	mov    %rax,%r8
+  801867:	b9 10 00 00 00       	mov    $0x10,%ecx
+  80186c:	48 ba f8 53 80 00 00 	movabs $0x8053f8,%rdx
+  801873:	00 00 00 
+  801876:	be 29 00 00 00       	mov    $0x29,%esi
+  80187b:	48 bf 17 54 80 00 00 	movabs $0x805417,%rdi
+  801882:	00 00 00 
+  801885:	b8 00 00 00 00       	mov    $0x0,%eax
+  80188a:	49 b9 7e 05 80 00 00 	movabs $0x80057e,%r9
+  801891:	00 00 00 
+  801894:	41 ff d1             	call   *%r9
+
+0000000000801897 <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  801897:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80189c:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018a1:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8018a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018ab:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8018b1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8018b7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8018bd:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  8018bf:	c3                   	ret
+
+00000000008018c0 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  8018c0:	89 d2                	mov    %edx,%edx
+  8018c2:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  8018c4:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8018c9:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8018cf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8018d5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8018db:	0f 05                	syscall
+}
+  8018dd:	c3                   	ret
+
+00000000008018de <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  8018de:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  8018e1:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8018e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018eb:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8018f1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8018f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8018fd:	0f 05                	syscall
+}
+  8018ff:	c3                   	ret
+
+0000000000801900 <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  801900:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  801903:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801908:	ba 00 00 00 00       	mov    $0x0,%edx
+  80190d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801913:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801919:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80191f:	0f 05                	syscall
+}
+  801921:	c3                   	ret
+
+0000000000801922 <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  801922:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801925:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80192a:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80192f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801934:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80193a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801940:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801946:	0f 05                	syscall
+    if (check && ret > 0) {
+  801948:	48 85 c0             	test   %rax,%rax
+  80194b:	7f 01                	jg     80194e <sys_irq_ack+0x2c>
+}
+  80194d:	c3                   	ret
+sys_irq_ack(int irq) {
+  80194e:	55                   	push   %rbp
+  80194f:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801952:	49 89 c0             	mov    %rax,%r8
+  801955:	b9 16 00 00 00       	mov    $0x16,%ecx
+  80195a:	48 ba f8 53 80 00 00 	movabs $0x8053f8,%rdx
+  801961:	00 00 00 
+  801964:	be 29 00 00 00       	mov    $0x29,%esi
+  801969:	48 bf 17 54 80 00 00 	movabs $0x805417,%rdi
+  801970:	00 00 00 
+  801973:	b8 00 00 00 00       	mov    $0x0,%eax
+  801978:	49 b9 7e 05 80 00 00 	movabs $0x80057e,%r9
+  80197f:	00 00 00 
+  801982:	41 ff d1             	call   *%r9
+
+0000000000801985 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  801985:	55                   	push   %rbp
+  801986:	48 89 e5             	mov    %rsp,%rbp
+  801989:	41 54                	push   %r12
+  80198b:	53                   	push   %rbx
+    // LAB 9: Your code here
+    /* The child would write them out once more */
+    file_flush_buffers();
+  80198c:	48 b8 b9 33 80 00 00 	movabs $0x8033b9,%rax
+  801993:	00 00 00 
+  801996:	ff d0                	call   *%rax
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("syscall"
+  801998:	b8 08 00 00 00       	mov    $0x8,%eax
+  80199d:	0f 05                	syscall
+  80199f:	41 89 c4             	mov    %eax,%r12d
+
+	envid_t envid = sys_exofork();
+    if (envid < 0)
+  8019a2:	85 c0                	test   %eax,%eax
+  8019a4:	78 7e                	js     801a24 <fork+0x9f>
+        return envid;
+    if (envid == 0) {
+  8019a6:	0f 84 80 00 00 00    	je     801a2c <fork+0xa7>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE) < 0) {
+  8019ac:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  8019b2:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  8019b9:	00 00 00 
+  8019bc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8019c1:	89 c2                	mov    %eax,%edx
+  8019c3:	be 00 00 00 00       	mov    $0x0,%esi
+  8019c8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019cd:	48 b8 a8 15 80 00 00 	movabs $0x8015a8,%rax
+  8019d4:	00 00 00 
+  8019d7:	ff d0                	call   *%rax
+  8019d9:	85 c0                	test   %eax,%eax
+  8019db:	0f 88 86 00 00 00    	js     801a67 <fork+0xe2>
+		return -1;
+	}
+    if (sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall) < 0) {
+  8019e1:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8019e8:	00 00 00 
+  8019eb:	48 8b b0 28 01 00 00 	mov    0x128(%rax),%rsi
+  8019f2:	44 89 e7             	mov    %r12d,%edi
+  8019f5:	48 b8 10 17 80 00 00 	movabs $0x801710,%rax
+  8019fc:	00 00 00 
+  8019ff:	ff d0                	call   *%rax
+  801a01:	85 c0                	test   %eax,%eax
+  801a03:	78 6a                	js     801a6f <fork+0xea>
+		return -1;
+	}
+    if (sys_env_set_status(envid, ENV_RUNNABLE) < 0) {
+  801a05:	be 02 00 00 00       	mov    $0x2,%esi
+  801a0a:	44 89 e7             	mov    %r12d,%edi
+  801a0d:	48 b8 51 16 80 00 00 	movabs $0x801651,%rax
+  801a14:	00 00 00 
+  801a17:	ff d0                	call   *%rax
+		return -1;
+  801a19:	85 c0                	test   %eax,%eax
+  801a1b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801a20:	44 0f 48 e0          	cmovs  %eax,%r12d
+	}
+    return envid;
+}
+  801a24:	44 89 e0             	mov    %r12d,%eax
+  801a27:	5b                   	pop    %rbx
+  801a28:	41 5c                	pop    %r12
+  801a2a:	5d                   	pop    %rbp
+  801a2b:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801a2c:	48 b8 c5 14 80 00 00 	movabs $0x8014c5,%rax
+  801a33:	00 00 00 
+  801a36:	ff d0                	call   *%rax
+  801a38:	89 c2                	mov    %eax,%edx
+  801a3a:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  801a40:	48 89 d0             	mov    %rdx,%rax
+  801a43:	48 c1 e0 04          	shl    $0x4,%rax
+  801a47:	48 29 d0             	sub    %rdx,%rax
+  801a4a:	48 c1 e0 05          	shl    $0x5,%rax
+  801a4e:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801a55:	00 00 00 
+  801a58:	48 01 d0             	add    %rdx,%rax
+  801a5b:	48 a3 00 00 81 00 00 	movabs %rax,0x810000
+  801a62:	00 00 00 
+        return 0;
+  801a65:	eb bd                	jmp    801a24 <fork+0x9f>
+		return -1;
+  801a67:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801a6d:	eb b5                	jmp    801a24 <fork+0x9f>
+		return -1;
+  801a6f:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801a75:	eb ad                	jmp    801a24 <fork+0x9f>
+
+0000000000801a77 <sfork>:
+
+envid_t
+sfork() {
+  801a77:	55                   	push   %rbp
+  801a78:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  801a7b:	48 ba 25 54 80 00 00 	movabs $0x805425,%rdx
+  801a82:	00 00 00 
+  801a85:	be 2d 00 00 00       	mov    $0x2d,%esi
+  801a8a:	48 bf 40 54 80 00 00 	movabs $0x805440,%rdi
+  801a91:	00 00 00 
+  801a94:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a99:	48 b9 7e 05 80 00 00 	movabs $0x80057e,%rcx
+  801aa0:	00 00 00 
+  801aa3:	ff d1                	call   *%rcx
+
+0000000000801aa5 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801aa5:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801aac:	ff ff ff 
+  801aaf:	48 01 f8             	add    %rdi,%rax
+  801ab2:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801ab6:	c3                   	ret
+
+0000000000801ab7 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801ab7:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801abe:	ff ff ff 
+  801ac1:	48 01 f8             	add    %rdi,%rax
+  801ac4:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801ac8:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801ace:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801ad2:	c3                   	ret
+
+0000000000801ad3 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801ad3:	55                   	push   %rbp
+  801ad4:	48 89 e5             	mov    %rsp,%rbp
+  801ad7:	41 57                	push   %r15
+  801ad9:	41 56                	push   %r14
+  801adb:	41 55                	push   %r13
+  801add:	41 54                	push   %r12
+  801adf:	53                   	push   %rbx
+  801ae0:	48 83 ec 08          	sub    $0x8,%rsp
+  801ae4:	49 89 ff             	mov    %rdi,%r15
+  801ae7:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801aec:	49 bd 61 43 80 00 00 	movabs $0x804361,%r13
+  801af3:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801af6:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801afc:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801aff:	48 89 df             	mov    %rbx,%rdi
+  801b02:	41 ff d5             	call   *%r13
+  801b05:	83 e0 04             	and    $0x4,%eax
+  801b08:	74 17                	je     801b21 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801b0a:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801b11:	4c 39 f3             	cmp    %r14,%rbx
+  801b14:	75 e6                	jne    801afc <fd_alloc+0x29>
+  801b16:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801b1c:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801b21:	4d 89 27             	mov    %r12,(%r15)
+}
+  801b24:	48 83 c4 08          	add    $0x8,%rsp
+  801b28:	5b                   	pop    %rbx
+  801b29:	41 5c                	pop    %r12
+  801b2b:	41 5d                	pop    %r13
+  801b2d:	41 5e                	pop    %r14
+  801b2f:	41 5f                	pop    %r15
+  801b31:	5d                   	pop    %rbp
+  801b32:	c3                   	ret
+
+0000000000801b33 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801b33:	83 ff 1f             	cmp    $0x1f,%edi
+  801b36:	77 39                	ja     801b71 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801b38:	55                   	push   %rbp
+  801b39:	48 89 e5             	mov    %rsp,%rbp
+  801b3c:	41 54                	push   %r12
+  801b3e:	53                   	push   %rbx
+  801b3f:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801b42:	48 63 df             	movslq %edi,%rbx
+  801b45:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801b4c:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801b50:	48 89 df             	mov    %rbx,%rdi
+  801b53:	48 b8 61 43 80 00 00 	movabs $0x804361,%rax
+  801b5a:	00 00 00 
+  801b5d:	ff d0                	call   *%rax
+  801b5f:	a8 04                	test   $0x4,%al
+  801b61:	74 14                	je     801b77 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801b63:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801b67:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b6c:	5b                   	pop    %rbx
+  801b6d:	41 5c                	pop    %r12
+  801b6f:	5d                   	pop    %rbp
+  801b70:	c3                   	ret
+        return -E_INVAL;
+  801b71:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801b76:	c3                   	ret
+        return -E_INVAL;
+  801b77:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b7c:	eb ee                	jmp    801b6c <fd_lookup+0x39>
+
+0000000000801b7e <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801b7e:	55                   	push   %rbp
+  801b7f:	48 89 e5             	mov    %rsp,%rbp
+  801b82:	41 54                	push   %r12
+  801b84:	53                   	push   %rbx
+  801b85:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801b88:	48 b8 e0 54 80 00 00 	movabs $0x8054e0,%rax
+  801b8f:	00 00 00 
+  801b92:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  801b99:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801b9c:	39 3b                	cmp    %edi,(%rbx)
+  801b9e:	74 47                	je     801be7 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801ba0:	48 83 c0 08          	add    $0x8,%rax
+  801ba4:	48 8b 18             	mov    (%rax),%rbx
+  801ba7:	48 85 db             	test   %rbx,%rbx
+  801baa:	75 f0                	jne    801b9c <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801bac:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801bb3:	00 00 00 
+  801bb6:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801bbc:	89 fa                	mov    %edi,%edx
+  801bbe:	48 bf 50 54 80 00 00 	movabs $0x805450,%rdi
+  801bc5:	00 00 00 
+  801bc8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bcd:	48 b9 ce 06 80 00 00 	movabs $0x8006ce,%rcx
+  801bd4:	00 00 00 
+  801bd7:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801bd9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801bde:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801be2:	5b                   	pop    %rbx
+  801be3:	41 5c                	pop    %r12
+  801be5:	5d                   	pop    %rbp
+  801be6:	c3                   	ret
+            return 0;
+  801be7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bec:	eb f0                	jmp    801bde <dev_lookup+0x60>
+
+0000000000801bee <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801bee:	55                   	push   %rbp
+  801bef:	48 89 e5             	mov    %rsp,%rbp
+  801bf2:	41 55                	push   %r13
+  801bf4:	41 54                	push   %r12
+  801bf6:	53                   	push   %rbx
+  801bf7:	48 83 ec 18          	sub    $0x18,%rsp
+  801bfb:	48 89 fb             	mov    %rdi,%rbx
+  801bfe:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801c01:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801c08:	ff ff ff 
+  801c0b:	48 01 df             	add    %rbx,%rdi
+  801c0e:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801c12:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c16:	48 b8 33 1b 80 00 00 	movabs $0x801b33,%rax
+  801c1d:	00 00 00 
+  801c20:	ff d0                	call   *%rax
+  801c22:	41 89 c5             	mov    %eax,%r13d
+  801c25:	85 c0                	test   %eax,%eax
+  801c27:	78 06                	js     801c2f <fd_close+0x41>
+  801c29:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801c2d:	74 1a                	je     801c49 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801c2f:	45 84 e4             	test   %r12b,%r12b
+  801c32:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c37:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801c3b:	44 89 e8             	mov    %r13d,%eax
+  801c3e:	48 83 c4 18          	add    $0x18,%rsp
+  801c42:	5b                   	pop    %rbx
+  801c43:	41 5c                	pop    %r12
+  801c45:	41 5d                	pop    %r13
+  801c47:	5d                   	pop    %rbp
+  801c48:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801c49:	8b 3b                	mov    (%rbx),%edi
+  801c4b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c4f:	48 b8 7e 1b 80 00 00 	movabs $0x801b7e,%rax
+  801c56:	00 00 00 
+  801c59:	ff d0                	call   *%rax
+  801c5b:	41 89 c5             	mov    %eax,%r13d
+  801c5e:	85 c0                	test   %eax,%eax
+  801c60:	78 1b                	js     801c7d <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801c62:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c66:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801c6a:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801c70:	48 85 c0             	test   %rax,%rax
+  801c73:	74 08                	je     801c7d <fd_close+0x8f>
+  801c75:	48 89 df             	mov    %rbx,%rdi
+  801c78:	ff d0                	call   *%rax
+  801c7a:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801c7d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c82:	48 89 de             	mov    %rbx,%rsi
+  801c85:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c8a:	48 b8 f8 15 80 00 00 	movabs $0x8015f8,%rax
+  801c91:	00 00 00 
+  801c94:	ff d0                	call   *%rax
+    return res;
+  801c96:	eb a3                	jmp    801c3b <fd_close+0x4d>
+
+0000000000801c98 <close>:
+
+int
+close(int fdnum) {
+  801c98:	55                   	push   %rbp
+  801c99:	48 89 e5             	mov    %rsp,%rbp
+  801c9c:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801ca0:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801ca4:	48 b8 33 1b 80 00 00 	movabs $0x801b33,%rax
+  801cab:	00 00 00 
+  801cae:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801cb0:	85 c0                	test   %eax,%eax
+  801cb2:	78 15                	js     801cc9 <close+0x31>
+
+    return fd_close(fd, 1);
+  801cb4:	be 01 00 00 00       	mov    $0x1,%esi
+  801cb9:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801cbd:	48 b8 ee 1b 80 00 00 	movabs $0x801bee,%rax
+  801cc4:	00 00 00 
+  801cc7:	ff d0                	call   *%rax
+}
+  801cc9:	c9                   	leave
+  801cca:	c3                   	ret
+
+0000000000801ccb <close_all>:
+
+void
+close_all(void) {
+  801ccb:	55                   	push   %rbp
+  801ccc:	48 89 e5             	mov    %rsp,%rbp
+  801ccf:	41 54                	push   %r12
+  801cd1:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801cd2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cd7:	49 bc 98 1c 80 00 00 	movabs $0x801c98,%r12
+  801cde:	00 00 00 
+  801ce1:	89 df                	mov    %ebx,%edi
+  801ce3:	41 ff d4             	call   *%r12
+  801ce6:	83 c3 01             	add    $0x1,%ebx
+  801ce9:	83 fb 20             	cmp    $0x20,%ebx
+  801cec:	75 f3                	jne    801ce1 <close_all+0x16>
+}
+  801cee:	5b                   	pop    %rbx
+  801cef:	41 5c                	pop    %r12
+  801cf1:	5d                   	pop    %rbp
+  801cf2:	c3                   	ret
+
+0000000000801cf3 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801cf3:	55                   	push   %rbp
+  801cf4:	48 89 e5             	mov    %rsp,%rbp
+  801cf7:	41 57                	push   %r15
+  801cf9:	41 56                	push   %r14
+  801cfb:	41 55                	push   %r13
+  801cfd:	41 54                	push   %r12
+  801cff:	53                   	push   %rbx
+  801d00:	48 83 ec 18          	sub    $0x18,%rsp
+  801d04:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801d07:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801d0b:	48 b8 33 1b 80 00 00 	movabs $0x801b33,%rax
+  801d12:	00 00 00 
+  801d15:	ff d0                	call   *%rax
+  801d17:	89 c3                	mov    %eax,%ebx
+  801d19:	85 c0                	test   %eax,%eax
+  801d1b:	0f 88 b8 00 00 00    	js     801dd9 <dup+0xe6>
+    close(newfdnum);
+  801d21:	44 89 e7             	mov    %r12d,%edi
+  801d24:	48 b8 98 1c 80 00 00 	movabs $0x801c98,%rax
+  801d2b:	00 00 00 
+  801d2e:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801d30:	4d 63 ec             	movslq %r12d,%r13
+  801d33:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801d3a:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801d3e:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801d42:	4c 89 ff             	mov    %r15,%rdi
+  801d45:	49 be b7 1a 80 00 00 	movabs $0x801ab7,%r14
+  801d4c:	00 00 00 
+  801d4f:	41 ff d6             	call   *%r14
+  801d52:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801d55:	4c 89 ef             	mov    %r13,%rdi
+  801d58:	41 ff d6             	call   *%r14
+  801d5b:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801d5e:	48 89 df             	mov    %rbx,%rdi
+  801d61:	48 b8 61 43 80 00 00 	movabs $0x804361,%rax
+  801d68:	00 00 00 
+  801d6b:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801d6d:	a8 04                	test   $0x4,%al
+  801d6f:	74 2b                	je     801d9c <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801d71:	41 89 c1             	mov    %eax,%r9d
+  801d74:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801d7a:	4c 89 f1             	mov    %r14,%rcx
+  801d7d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d82:	48 89 de             	mov    %rbx,%rsi
+  801d85:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d8a:	48 b8 a8 15 80 00 00 	movabs $0x8015a8,%rax
+  801d91:	00 00 00 
+  801d94:	ff d0                	call   *%rax
+  801d96:	89 c3                	mov    %eax,%ebx
+  801d98:	85 c0                	test   %eax,%eax
+  801d9a:	78 4e                	js     801dea <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801d9c:	4c 89 ff             	mov    %r15,%rdi
+  801d9f:	48 b8 61 43 80 00 00 	movabs $0x804361,%rax
+  801da6:	00 00 00 
+  801da9:	ff d0                	call   *%rax
+  801dab:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801dae:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801db4:	4c 89 e9             	mov    %r13,%rcx
+  801db7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dbc:	4c 89 fe             	mov    %r15,%rsi
+  801dbf:	bf 00 00 00 00       	mov    $0x0,%edi
+  801dc4:	48 b8 a8 15 80 00 00 	movabs $0x8015a8,%rax
+  801dcb:	00 00 00 
+  801dce:	ff d0                	call   *%rax
+  801dd0:	89 c3                	mov    %eax,%ebx
+  801dd2:	85 c0                	test   %eax,%eax
+  801dd4:	78 14                	js     801dea <dup+0xf7>
+
+    return newfdnum;
+  801dd6:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801dd9:	89 d8                	mov    %ebx,%eax
+  801ddb:	48 83 c4 18          	add    $0x18,%rsp
+  801ddf:	5b                   	pop    %rbx
+  801de0:	41 5c                	pop    %r12
+  801de2:	41 5d                	pop    %r13
+  801de4:	41 5e                	pop    %r14
+  801de6:	41 5f                	pop    %r15
+  801de8:	5d                   	pop    %rbp
+  801de9:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801dea:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801def:	4c 89 ee             	mov    %r13,%rsi
+  801df2:	bf 00 00 00 00       	mov    $0x0,%edi
+  801df7:	49 bc f8 15 80 00 00 	movabs $0x8015f8,%r12
+  801dfe:	00 00 00 
+  801e01:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801e04:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801e09:	4c 89 f6             	mov    %r14,%rsi
+  801e0c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e11:	41 ff d4             	call   *%r12
+    return res;
+  801e14:	eb c3                	jmp    801dd9 <dup+0xe6>
+
+0000000000801e16 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801e16:	55                   	push   %rbp
+  801e17:	48 89 e5             	mov    %rsp,%rbp
+  801e1a:	41 56                	push   %r14
+  801e1c:	41 55                	push   %r13
+  801e1e:	41 54                	push   %r12
+  801e20:	53                   	push   %rbx
+  801e21:	48 83 ec 10          	sub    $0x10,%rsp
+  801e25:	89 fb                	mov    %edi,%ebx
+  801e27:	49 89 f4             	mov    %rsi,%r12
+  801e2a:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e2d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e31:	48 b8 33 1b 80 00 00 	movabs $0x801b33,%rax
+  801e38:	00 00 00 
+  801e3b:	ff d0                	call   *%rax
+  801e3d:	85 c0                	test   %eax,%eax
+  801e3f:	78 4c                	js     801e8d <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e41:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801e45:	41 8b 3e             	mov    (%r14),%edi
+  801e48:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e4c:	48 b8 7e 1b 80 00 00 	movabs $0x801b7e,%rax
+  801e53:	00 00 00 
+  801e56:	ff d0                	call   *%rax
+  801e58:	85 c0                	test   %eax,%eax
+  801e5a:	78 35                	js     801e91 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801e5c:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801e60:	83 e0 03             	and    $0x3,%eax
+  801e63:	83 f8 01             	cmp    $0x1,%eax
+  801e66:	74 2d                	je     801e95 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801e68:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e6c:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801e70:	48 85 c0             	test   %rax,%rax
+  801e73:	74 56                	je     801ecb <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801e75:	4c 89 ea             	mov    %r13,%rdx
+  801e78:	4c 89 e6             	mov    %r12,%rsi
+  801e7b:	4c 89 f7             	mov    %r14,%rdi
+  801e7e:	ff d0                	call   *%rax
+}
+  801e80:	48 83 c4 10          	add    $0x10,%rsp
+  801e84:	5b                   	pop    %rbx
+  801e85:	41 5c                	pop    %r12
+  801e87:	41 5d                	pop    %r13
+  801e89:	41 5e                	pop    %r14
+  801e8b:	5d                   	pop    %rbp
+  801e8c:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e8d:	48 98                	cltq
+  801e8f:	eb ef                	jmp    801e80 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e91:	48 98                	cltq
+  801e93:	eb eb                	jmp    801e80 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e95:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801e9c:	00 00 00 
+  801e9f:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801ea5:	89 da                	mov    %ebx,%edx
+  801ea7:	48 bf 91 54 80 00 00 	movabs $0x805491,%rdi
+  801eae:	00 00 00 
+  801eb1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801eb6:	48 b9 ce 06 80 00 00 	movabs $0x8006ce,%rcx
+  801ebd:	00 00 00 
+  801ec0:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801ec2:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801ec9:	eb b5                	jmp    801e80 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801ecb:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801ed2:	eb ac                	jmp    801e80 <read+0x6a>
+
+0000000000801ed4 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801ed4:	55                   	push   %rbp
+  801ed5:	48 89 e5             	mov    %rsp,%rbp
+  801ed8:	41 57                	push   %r15
+  801eda:	41 56                	push   %r14
+  801edc:	41 55                	push   %r13
+  801ede:	41 54                	push   %r12
+  801ee0:	53                   	push   %rbx
+  801ee1:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801ee5:	48 85 d2             	test   %rdx,%rdx
+  801ee8:	74 54                	je     801f3e <readn+0x6a>
+  801eea:	41 89 fd             	mov    %edi,%r13d
+  801eed:	49 89 f6             	mov    %rsi,%r14
+  801ef0:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801ef3:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801ef8:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801efd:	49 bf 16 1e 80 00 00 	movabs $0x801e16,%r15
+  801f04:	00 00 00 
+  801f07:	4c 89 e2             	mov    %r12,%rdx
+  801f0a:	48 29 f2             	sub    %rsi,%rdx
+  801f0d:	4c 01 f6             	add    %r14,%rsi
+  801f10:	44 89 ef             	mov    %r13d,%edi
+  801f13:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801f16:	85 c0                	test   %eax,%eax
+  801f18:	78 20                	js     801f3a <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801f1a:	01 c3                	add    %eax,%ebx
+  801f1c:	85 c0                	test   %eax,%eax
+  801f1e:	74 08                	je     801f28 <readn+0x54>
+  801f20:	48 63 f3             	movslq %ebx,%rsi
+  801f23:	4c 39 e6             	cmp    %r12,%rsi
+  801f26:	72 df                	jb     801f07 <readn+0x33>
+    }
+    return res;
+  801f28:	48 63 c3             	movslq %ebx,%rax
+}
+  801f2b:	48 83 c4 08          	add    $0x8,%rsp
+  801f2f:	5b                   	pop    %rbx
+  801f30:	41 5c                	pop    %r12
+  801f32:	41 5d                	pop    %r13
+  801f34:	41 5e                	pop    %r14
+  801f36:	41 5f                	pop    %r15
+  801f38:	5d                   	pop    %rbp
+  801f39:	c3                   	ret
+        if (inc < 0) return inc;
+  801f3a:	48 98                	cltq
+  801f3c:	eb ed                	jmp    801f2b <readn+0x57>
+    int inc = 1, res = 0;
+  801f3e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f43:	eb e3                	jmp    801f28 <readn+0x54>
+
+0000000000801f45 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801f45:	55                   	push   %rbp
+  801f46:	48 89 e5             	mov    %rsp,%rbp
+  801f49:	41 56                	push   %r14
+  801f4b:	41 55                	push   %r13
+  801f4d:	41 54                	push   %r12
+  801f4f:	53                   	push   %rbx
+  801f50:	48 83 ec 10          	sub    $0x10,%rsp
+  801f54:	89 fb                	mov    %edi,%ebx
+  801f56:	49 89 f4             	mov    %rsi,%r12
+  801f59:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f5c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f60:	48 b8 33 1b 80 00 00 	movabs $0x801b33,%rax
+  801f67:	00 00 00 
+  801f6a:	ff d0                	call   *%rax
+  801f6c:	85 c0                	test   %eax,%eax
+  801f6e:	78 47                	js     801fb7 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f70:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801f74:	41 8b 3e             	mov    (%r14),%edi
+  801f77:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f7b:	48 b8 7e 1b 80 00 00 	movabs $0x801b7e,%rax
+  801f82:	00 00 00 
+  801f85:	ff d0                	call   *%rax
+  801f87:	85 c0                	test   %eax,%eax
+  801f89:	78 30                	js     801fbb <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801f8b:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801f90:	74 2d                	je     801fbf <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801f92:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f96:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801f9a:	48 85 c0             	test   %rax,%rax
+  801f9d:	74 56                	je     801ff5 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801f9f:	4c 89 ea             	mov    %r13,%rdx
+  801fa2:	4c 89 e6             	mov    %r12,%rsi
+  801fa5:	4c 89 f7             	mov    %r14,%rdi
+  801fa8:	ff d0                	call   *%rax
+}
+  801faa:	48 83 c4 10          	add    $0x10,%rsp
+  801fae:	5b                   	pop    %rbx
+  801faf:	41 5c                	pop    %r12
+  801fb1:	41 5d                	pop    %r13
+  801fb3:	41 5e                	pop    %r14
+  801fb5:	5d                   	pop    %rbp
+  801fb6:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801fb7:	48 98                	cltq
+  801fb9:	eb ef                	jmp    801faa <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801fbb:	48 98                	cltq
+  801fbd:	eb eb                	jmp    801faa <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801fbf:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801fc6:	00 00 00 
+  801fc9:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801fcf:	89 da                	mov    %ebx,%edx
+  801fd1:	48 bf ad 54 80 00 00 	movabs $0x8054ad,%rdi
+  801fd8:	00 00 00 
+  801fdb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fe0:	48 b9 ce 06 80 00 00 	movabs $0x8006ce,%rcx
+  801fe7:	00 00 00 
+  801fea:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801fec:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801ff3:	eb b5                	jmp    801faa <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801ff5:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801ffc:	eb ac                	jmp    801faa <write+0x65>
+
+0000000000801ffe <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801ffe:	55                   	push   %rbp
+  801fff:	48 89 e5             	mov    %rsp,%rbp
+  802002:	41 54                	push   %r12
+  802004:	53                   	push   %rbx
+  802005:	48 83 ec 10          	sub    $0x10,%rsp
+  802009:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80200b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80200f:	48 b8 33 1b 80 00 00 	movabs $0x801b33,%rax
+  802016:	00 00 00 
+  802019:	ff d0                	call   *%rax
+  80201b:	85 c0                	test   %eax,%eax
+  80201d:	78 3e                	js     80205d <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80201f:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802023:	41 8b 3c 24          	mov    (%r12),%edi
+  802027:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80202b:	48 b8 7e 1b 80 00 00 	movabs $0x801b7e,%rax
+  802032:	00 00 00 
+  802035:	ff d0                	call   *%rax
+  802037:	85 c0                	test   %eax,%eax
+  802039:	78 22                	js     80205d <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  80203b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80203f:	48 8b 40 38          	mov    0x38(%rax),%rax
+  802043:	48 85 c0             	test   %rax,%rax
+  802046:	74 0b                	je     802053 <seek+0x55>
+  802048:	89 de                	mov    %ebx,%esi
+  80204a:	4c 89 e7             	mov    %r12,%rdi
+  80204d:	ff d0                	call   *%rax
+  80204f:	85 c0                	test   %eax,%eax
+  802051:	78 0a                	js     80205d <seek+0x5f>
+
+    fd->fd_offset = offset;
+  802053:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  802058:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80205d:	48 83 c4 10          	add    $0x10,%rsp
+  802061:	5b                   	pop    %rbx
+  802062:	41 5c                	pop    %r12
+  802064:	5d                   	pop    %rbp
+  802065:	c3                   	ret
+
+0000000000802066 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802066:	55                   	push   %rbp
+  802067:	48 89 e5             	mov    %rsp,%rbp
+  80206a:	41 55                	push   %r13
+  80206c:	41 54                	push   %r12
+  80206e:	53                   	push   %rbx
+  80206f:	48 83 ec 18          	sub    $0x18,%rsp
+  802073:	89 fb                	mov    %edi,%ebx
+  802075:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802078:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80207c:	48 b8 33 1b 80 00 00 	movabs $0x801b33,%rax
+  802083:	00 00 00 
+  802086:	ff d0                	call   *%rax
+  802088:	85 c0                	test   %eax,%eax
+  80208a:	78 38                	js     8020c4 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80208c:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802090:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  802094:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802098:	48 b8 7e 1b 80 00 00 	movabs $0x801b7e,%rax
+  80209f:	00 00 00 
+  8020a2:	ff d0                	call   *%rax
+  8020a4:	85 c0                	test   %eax,%eax
+  8020a6:	78 1c                	js     8020c4 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8020a8:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8020ad:	74 20                	je     8020cf <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8020af:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8020b3:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8020b7:	48 85 c0             	test   %rax,%rax
+  8020ba:	74 47                	je     802103 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8020bc:	44 89 e6             	mov    %r12d,%esi
+  8020bf:	4c 89 ef             	mov    %r13,%rdi
+  8020c2:	ff d0                	call   *%rax
+}
+  8020c4:	48 83 c4 18          	add    $0x18,%rsp
+  8020c8:	5b                   	pop    %rbx
+  8020c9:	41 5c                	pop    %r12
+  8020cb:	41 5d                	pop    %r13
+  8020cd:	5d                   	pop    %rbp
+  8020ce:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8020cf:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8020d6:	00 00 00 
+  8020d9:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8020df:	89 da                	mov    %ebx,%edx
+  8020e1:	48 bf 70 54 80 00 00 	movabs $0x805470,%rdi
+  8020e8:	00 00 00 
+  8020eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020f0:	48 b9 ce 06 80 00 00 	movabs $0x8006ce,%rcx
+  8020f7:	00 00 00 
+  8020fa:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8020fc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802101:	eb c1                	jmp    8020c4 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802103:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802108:	eb ba                	jmp    8020c4 <ftruncate+0x5e>
+
+000000000080210a <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80210a:	55                   	push   %rbp
+  80210b:	48 89 e5             	mov    %rsp,%rbp
+  80210e:	41 54                	push   %r12
+  802110:	53                   	push   %rbx
+  802111:	48 83 ec 10          	sub    $0x10,%rsp
+  802115:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802118:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80211c:	48 b8 33 1b 80 00 00 	movabs $0x801b33,%rax
+  802123:	00 00 00 
+  802126:	ff d0                	call   *%rax
+  802128:	85 c0                	test   %eax,%eax
+  80212a:	78 4e                	js     80217a <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80212c:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802130:	41 8b 3c 24          	mov    (%r12),%edi
+  802134:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802138:	48 b8 7e 1b 80 00 00 	movabs $0x801b7e,%rax
+  80213f:	00 00 00 
+  802142:	ff d0                	call   *%rax
+  802144:	85 c0                	test   %eax,%eax
+  802146:	78 32                	js     80217a <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802148:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80214c:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802151:	74 30                	je     802183 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802153:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802156:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80215d:	00 00 00 
+    stat->st_isdir = 0;
+  802160:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802167:	00 00 00 
+    stat->st_dev = dev;
+  80216a:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802171:	48 89 de             	mov    %rbx,%rsi
+  802174:	4c 89 e7             	mov    %r12,%rdi
+  802177:	ff 50 28             	call   *0x28(%rax)
+}
+  80217a:	48 83 c4 10          	add    $0x10,%rsp
+  80217e:	5b                   	pop    %rbx
+  80217f:	41 5c                	pop    %r12
+  802181:	5d                   	pop    %rbp
+  802182:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802183:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802188:	eb f0                	jmp    80217a <fstat+0x70>
+
+000000000080218a <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80218a:	55                   	push   %rbp
+  80218b:	48 89 e5             	mov    %rsp,%rbp
+  80218e:	41 54                	push   %r12
+  802190:	53                   	push   %rbx
+  802191:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802194:	be 00 00 00 00       	mov    $0x0,%esi
+  802199:	48 b8 f8 32 80 00 00 	movabs $0x8032f8,%rax
+  8021a0:	00 00 00 
+  8021a3:	ff d0                	call   *%rax
+  8021a5:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8021a7:	85 c0                	test   %eax,%eax
+  8021a9:	78 25                	js     8021d0 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8021ab:	4c 89 e6             	mov    %r12,%rsi
+  8021ae:	89 c7                	mov    %eax,%edi
+  8021b0:	48 b8 0a 21 80 00 00 	movabs $0x80210a,%rax
+  8021b7:	00 00 00 
+  8021ba:	ff d0                	call   *%rax
+  8021bc:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8021bf:	89 df                	mov    %ebx,%edi
+  8021c1:	48 b8 98 1c 80 00 00 	movabs $0x801c98,%rax
+  8021c8:	00 00 00 
+  8021cb:	ff d0                	call   *%rax
+
+    return res;
+  8021cd:	44 89 e3             	mov    %r12d,%ebx
+}
+  8021d0:	89 d8                	mov    %ebx,%eax
+  8021d2:	5b                   	pop    %rbx
+  8021d3:	41 5c                	pop    %r12
+  8021d5:	5d                   	pop    %rbp
+  8021d6:	c3                   	ret
+
+00000000008021d7 <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  8021d7:	48 b8 08 00 82 00 00 	movabs $0x820008,%rax
+  8021de:	00 00 00 
+  8021e1:	83 38 00             	cmpl   $0x0,(%rax)
+  8021e4:	74 0a                	je     8021f0 <fsenv+0x19>
+    return envid;
+}
+  8021e6:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  8021ed:	00 00 
+  8021ef:	c3                   	ret
+fsenv(void) {
+  8021f0:	55                   	push   %rbp
+  8021f1:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  8021f4:	bf 03 00 00 00       	mov    $0x3,%edi
+  8021f9:	48 b8 c4 4c 80 00 00 	movabs $0x804cc4,%rax
+  802200:	00 00 00 
+  802203:	ff d0                	call   *%rax
+  802205:	a3 08 00 82 00 00 00 	movabs %eax,0x820008
+  80220c:	00 00 
+}
+  80220e:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  802215:	00 00 
+  802217:	5d                   	pop    %rbp
+  802218:	c3                   	ret
+
+0000000000802219 <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  802219:	55                   	push   %rbp
+  80221a:	48 89 e5             	mov    %rsp,%rbp
+  80221d:	41 54                	push   %r12
+  80221f:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  802220:	ba 00 50 00 00       	mov    $0x5000,%edx
+  802225:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  80222a:	48 89 de             	mov    %rbx,%rsi
+  80222d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802232:	48 b8 f8 15 80 00 00 	movabs $0x8015f8,%rax
+  802239:	00 00 00 
+  80223c:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  80223e:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  802245:	00 00 00 
+  802248:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  80224e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802253:	ba 00 50 00 00       	mov    $0x5000,%edx
+  802258:	48 89 de             	mov    %rbx,%rsi
+  80225b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802260:	48 b8 52 15 80 00 00 	movabs $0x801552,%rax
+  802267:	00 00 00 
+  80226a:	ff d0                	call   *%rax
+  80226c:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  80226e:	85 c0                	test   %eax,%eax
+  802270:	0f 88 a2 00 00 00    	js     802318 <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  802276:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80227d:	00 00 00 
+  802280:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802286:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  80228b:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  80228d:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  802292:	49 bc 29 45 80 00 00 	movabs $0x804529,%r12
+  802299:	00 00 00 
+  80229c:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  80229f:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  8022a4:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  8022a7:	48 b8 d7 21 80 00 00 	movabs $0x8021d7,%rax
+  8022ae:	00 00 00 
+  8022b1:	ff d0                	call   *%rax
+  8022b3:	89 c7                	mov    %eax,%edi
+  8022b5:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  8022bb:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  8022c0:	48 89 da             	mov    %rbx,%rdx
+  8022c3:	be 09 00 00 00       	mov    $0x9,%esi
+  8022c8:	48 b8 6e 4c 80 00 00 	movabs $0x804c6e,%rax
+  8022cf:	00 00 00 
+  8022d2:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  8022d4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022d9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022de:	be 00 00 00 00       	mov    $0x0,%esi
+  8022e3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022e8:	48 b8 4a 4c 80 00 00 	movabs $0x804c4a,%rax
+  8022ef:	00 00 00 
+  8022f2:	ff d0                	call   *%rax
+  8022f4:	89 c3                	mov    %eax,%ebx
+  8022f6:	85 c0                	test   %eax,%eax
+  8022f8:	78 25                	js     80231f <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  8022fa:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  802301:	00 00 00 
+  802304:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80230a:	a3 00 26 82 00 00 00 	movabs %eax,0x822600
+  802311:	00 00 
+    return 0;
+  802313:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  802318:	89 d8                	mov    %ebx,%eax
+  80231a:	5b                   	pop    %rbx
+  80231b:	41 5c                	pop    %r12
+  80231d:	5d                   	pop    %rbp
+  80231e:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  80231f:	ba 00 50 00 00       	mov    $0x5000,%edx
+  802324:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  802329:	bf 00 00 00 00       	mov    $0x0,%edi
+  80232e:	48 b8 f8 15 80 00 00 	movabs $0x8015f8,%rax
+  802335:	00 00 00 
+  802338:	ff d0                	call   *%rax
+        return res;
+  80233a:	eb dc                	jmp    802318 <fschan_setup+0xff>
+
+000000000080233c <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  80233c:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  802343:	00 00 00 
+  802346:	80 38 00             	cmpb   $0x0,(%rax)
+  802349:	74 55                	je     8023a0 <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  80234b:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  802352:	00 00 00 
+  802355:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  80235b:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802360:	48 ba 00 26 82 00 00 	movabs $0x822600,%rdx
+  802367:	00 00 00 
+  80236a:	3b 0a                	cmp    (%rdx),%ecx
+  80236c:	75 01                	jne    80236f <fschan+0x33>
+}
+  80236e:	c3                   	ret
+fschan(void) {
+  80236f:	55                   	push   %rbp
+  802370:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802373:	48 b8 19 22 80 00 00 	movabs $0x802219,%rax
+  80237a:	00 00 00 
+  80237d:	ff d0                	call   *%rax
+  80237f:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  802381:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802386:	85 d2                	test   %edx,%edx
+  802388:	78 02                	js     80238c <fschan+0x50>
+}
+  80238a:	5d                   	pop    %rbp
+  80238b:	c3                   	ret
+        fschan_enabled = 0;
+  80238c:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  802393:	00 00 00 
+  802396:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  802399:	b8 00 00 00 00       	mov    $0x0,%eax
+  80239e:	eb ea                	jmp    80238a <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  8023a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023a5:	c3                   	ret
+
+00000000008023a6 <fbuf>:
+fbuf(struct Fd *fd) {
+  8023a6:	55                   	push   %rbp
+  8023a7:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  8023aa:	48 b8 a5 1a 80 00 00 	movabs $0x801aa5,%rax
+  8023b1:	00 00 00 
+  8023b4:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  8023b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023bb:	48 83 f8 1f          	cmp    $0x1f,%rax
+  8023bf:	77 12                	ja     8023d3 <fbuf+0x2d>
+  8023c1:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  8023c5:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8023cc:	00 00 00 
+  8023cf:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  8023d3:	48 89 d0             	mov    %rdx,%rax
+  8023d6:	5d                   	pop    %rbp
+  8023d7:	c3                   	ret
+
+00000000008023d8 <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  8023d8:	55                   	push   %rbp
+  8023d9:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  8023dc:	48 83 c7 40          	add    $0x40,%rdi
+  8023e0:	48 b8 63 45 80 00 00 	movabs $0x804563,%rax
+  8023e7:	00 00 00 
+  8023ea:	ff d0                	call   *%rax
+  8023ec:	84 c0                	test   %al,%al
+  8023ee:	75 02                	jne    8023f2 <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  8023f0:	5d                   	pop    %rbp
+  8023f1:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  8023f2:	48 b8 d7 21 80 00 00 	movabs $0x8021d7,%rax
+  8023f9:	00 00 00 
+  8023fc:	ff d0                	call   *%rax
+  8023fe:	89 c7                	mov    %eax,%edi
+  802400:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802406:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80240b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802410:	be 0a 00 00 00       	mov    $0xa,%esi
+  802415:	48 b8 6e 4c 80 00 00 	movabs $0x804c6e,%rax
+  80241c:	00 00 00 
+  80241f:	ff d0                	call   *%rax
+}
+  802421:	eb cd                	jmp    8023f0 <fschan_publish+0x18>
+
+0000000000802423 <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  802423:	55                   	push   %rbp
+  802424:	48 89 e5             	mov    %rsp,%rbp
+  802427:	41 57                	push   %r15
+  802429:	41 56                	push   %r14
+  80242b:	41 55                	push   %r13
+  80242d:	41 54                	push   %r12
+  80242f:	53                   	push   %rbx
+  802430:	48 83 ec 48          	sub    $0x48,%rsp
+  802434:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802438:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  80243c:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  80243f:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  802443:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  802446:	48 ba 04 00 82 00 00 	movabs $0x820004,%rdx
+  80244d:	00 00 00 
+  802450:	8b 02                	mov    (%rdx),%eax
+  802452:	83 c0 01             	add    $0x1,%eax
+  802455:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80245a:	0f 44 c1             	cmove  %ecx,%eax
+  80245d:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  80245f:	4d 85 c0             	test   %r8,%r8
+  802462:	74 2c                	je     802490 <fschan_rw+0x6d>
+  802464:	45 89 ce             	mov    %r9d,%r14d
+  802467:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  80246e:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  802472:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802478:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  80247f:	00 
+  802480:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802486:	b8 01 00 00 00       	mov    $0x1,%eax
+  80248b:	e9 41 01 00 00       	jmp    8025d1 <fschan_rw+0x1ae>
+  802490:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  802494:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802498:	e9 9c 01 00 00       	jmp    802639 <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  80249d:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8024a1:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  8024a4:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  8024a7:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  8024aa:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  8024ae:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8024b2:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  8024b6:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  8024ba:	48 89 da             	mov    %rbx,%rdx
+  8024bd:	48 b8 54 12 80 00 00 	movabs $0x801254,%rax
+  8024c4:	00 00 00 
+  8024c7:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  8024c9:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8024cd:	48 b8 d8 23 80 00 00 	movabs $0x8023d8,%rax
+  8024d4:	00 00 00 
+  8024d7:	ff d0                	call   *%rax
+            queued += blk;
+  8024d9:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  8024dc:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  8024e0:	4d 39 fc             	cmp    %r15,%r12
+  8024e3:	73 6b                	jae    802550 <fschan_rw+0x12d>
+  8024e5:	41 83 fd 0f          	cmp    $0xf,%r13d
+  8024e9:	77 65                	ja     802550 <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  8024eb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8024ef:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  8024f3:	48 b8 3e 45 80 00 00 	movabs $0x80453e,%rax
+  8024fa:	00 00 00 
+  8024fd:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  8024ff:	4c 89 fb             	mov    %r15,%rbx
+  802502:	4c 29 e3             	sub    %r12,%rbx
+  802505:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  80250a:	48 39 d3             	cmp    %rdx,%rbx
+  80250d:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  802511:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  802515:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802519:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  80251d:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  802520:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  802522:	48 b9 04 00 82 00 00 	movabs $0x820004,%rcx
+  802529:	00 00 00 
+  80252c:	8b 09                	mov    (%rcx),%ecx
+  80252e:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  802531:	83 fe 03             	cmp    $0x3,%esi
+  802534:	0f 85 63 ff ff ff    	jne    80249d <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  80253a:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80253e:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  802541:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  802544:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  802547:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  80254b:	e9 79 ff ff ff       	jmp    8024c9 <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  802550:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802554:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  80255b:	48 89 df             	mov    %rbx,%rdi
+  80255e:	48 b8 01 46 80 00 00 	movabs $0x804601,%rax
+  802565:	00 00 00 
+  802568:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  80256a:	48 89 df             	mov    %rbx,%rdi
+  80256d:	48 b8 8f 45 80 00 00 	movabs $0x80458f,%rax
+  802574:	00 00 00 
+  802577:	ff d0                	call   *%rax
+  802579:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  80257d:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  802581:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  802585:	75 25                	jne    8025ac <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  802587:	8b 40 04             	mov    0x4(%rax),%eax
+  80258a:	85 c0                	test   %eax,%eax
+  80258c:	0f 88 86 00 00 00    	js     802618 <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  802592:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  802596:	74 5b                	je     8025f3 <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  802598:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  80259c:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  8025a0:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  8025a4:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  8025a8:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  8025ac:	48 89 df             	mov    %rbx,%rdi
+  8025af:	48 b8 b6 45 80 00 00 	movabs $0x8045b6,%rax
+  8025b6:	00 00 00 
+  8025b9:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  8025bb:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  8025bf:	83 f0 01             	xor    $0x1,%eax
+  8025c2:	4d 39 fc             	cmp    %r15,%r12
+  8025c5:	0f 92 c2             	setb   %dl
+  8025c8:	84 c2                	test   %al,%dl
+  8025ca:	75 05                	jne    8025d1 <fschan_rw+0x1ae>
+  8025cc:	45 85 ed             	test   %r13d,%r13d
+  8025cf:	74 50                	je     802621 <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  8025d1:	4d 39 fc             	cmp    %r15,%r12
+  8025d4:	0f 92 c1             	setb   %cl
+  8025d7:	41 83 fd 0f          	cmp    $0xf,%r13d
+  8025db:	0f 96 c2             	setbe  %dl
+  8025de:	84 d1                	test   %dl,%cl
+  8025e0:	0f 84 6a ff ff ff    	je     802550 <fschan_rw+0x12d>
+  8025e6:	84 c0                	test   %al,%al
+  8025e8:	0f 85 fd fe ff ff    	jne    8024eb <fschan_rw+0xc8>
+  8025ee:	e9 5d ff ff ff       	jmp    802550 <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  8025f3:	48 63 d0             	movslq %eax,%rdx
+  8025f6:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8025fa:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  8025fe:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802602:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  802606:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  80260a:	48 b8 54 12 80 00 00 	movabs $0x801254,%rax
+  802611:	00 00 00 
+  802614:	ff d0                	call   *%rax
+  802616:	eb 80                	jmp    802598 <fschan_rw+0x175>
+                err = msg->fm_res;
+  802618:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  80261b:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  80261f:	eb 8b                	jmp    8025ac <fschan_rw+0x189>
+    return done || !err ? done : err;
+  802621:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  802626:	0f 85 68 fe ff ff    	jne    802494 <fschan_rw+0x71>
+  80262c:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  80262f:	85 c0                	test   %eax,%eax
+  802631:	0f 84 5d fe ff ff    	je     802494 <fschan_rw+0x71>
+  802637:	48 98                	cltq
+}
+  802639:	48 83 c4 48          	add    $0x48,%rsp
+  80263d:	5b                   	pop    %rbx
+  80263e:	41 5c                	pop    %r12
+  802640:	41 5d                	pop    %r13
+  802642:	41 5e                	pop    %r14
+  802644:	41 5f                	pop    %r15
+  802646:	5d                   	pop    %rbp
+  802647:	c3                   	ret
+
+0000000000802648 <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  802648:	55                   	push   %rbp
+  802649:	48 89 e5             	mov    %rsp,%rbp
+  80264c:	41 56                	push   %r14
+  80264e:	41 55                	push   %r13
+  802650:	41 54                	push   %r12
+  802652:	53                   	push   %rbx
+  802653:	48 83 ec 10          	sub    $0x10,%rsp
+  802657:	49 89 fe             	mov    %rdi,%r14
+  80265a:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  80265d:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  802661:	48 29 f3             	sub    %rsi,%rbx
+  802664:	48 39 d3             	cmp    %rdx,%rbx
+  802667:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  80266b:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  802672:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  802673:	bf 00 10 00 00       	mov    $0x1000,%edi
+  802678:	49 bd c0 43 80 00 00 	movabs $0x8043c0,%r13
+  80267f:	00 00 00 
+  802682:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  802689:	76 1e                	jbe    8026a9 <mmap_fault+0x61>
+  80268b:	4c 01 e7             	add    %r12,%rdi
+  80268e:	41 ff d5             	call   *%r13
+  802691:	84 c0                	test   %al,%al
+  802693:	75 14                	jne    8026a9 <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  802695:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802699:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  8026a0:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  8026a4:	48 39 df             	cmp    %rbx,%rdi
+  8026a7:	72 e2                	jb     80268b <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  8026a9:	48 bb 00 10 82 00 00 	movabs $0x821000,%rbx
+  8026b0:	00 00 00 
+  8026b3:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  8026ba:	00 00 00 
+  8026bd:	4c 89 f0             	mov    %r14,%rax
+  8026c0:	48 29 d0             	sub    %rdx,%rax
+  8026c3:	48 c1 f8 03          	sar    $0x3,%rax
+  8026c7:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  8026ce:	aa aa aa 
+  8026d1:	48 0f af c2          	imul   %rdx,%rax
+  8026d5:	48 c1 e0 0c          	shl    $0xc,%rax
+  8026d9:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  8026de:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  8026e2:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  8026e4:	44 89 e0             	mov    %r12d,%eax
+  8026e7:	41 03 46 10          	add    0x10(%r14),%eax
+  8026eb:	41 2b 06             	sub    (%r14),%eax
+  8026ee:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  8026f1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8026f5:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  8026f9:	41 8b 46 14          	mov    0x14(%r14),%eax
+  8026fd:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  802700:	48 b8 d7 21 80 00 00 	movabs $0x8021d7,%rax
+  802707:	00 00 00 
+  80270a:	ff d0                	call   *%rax
+  80270c:	89 c7                	mov    %eax,%edi
+  80270e:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802714:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802719:	48 89 da             	mov    %rbx,%rdx
+  80271c:	be 0f 00 00 00       	mov    $0xf,%esi
+  802721:	48 b8 6e 4c 80 00 00 	movabs $0x804c6e,%rax
+  802728:	00 00 00 
+  80272b:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  80272d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802732:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802736:	4c 89 e6             	mov    %r12,%rsi
+  802739:	bf 00 00 00 00       	mov    $0x0,%edi
+  80273e:	48 b8 4a 4c 80 00 00 	movabs $0x804c4a,%rax
+  802745:	00 00 00 
+  802748:	ff d0                	call   *%rax
+  80274a:	48 98                	cltq
+}
+  80274c:	48 83 c4 10          	add    $0x10,%rsp
+  802750:	5b                   	pop    %rbx
+  802751:	41 5c                	pop    %r12
+  802753:	41 5d                	pop    %r13
+  802755:	41 5e                	pop    %r14
+  802757:	5d                   	pop    %rbp
+  802758:	c3                   	ret
+
+0000000000802759 <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  802759:	48 8b 37             	mov    (%rdi),%rsi
+  80275c:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  802763:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  80276a:	00 00 00 
+  80276d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802772:	eb 0f                	jmp    802783 <mmap_pgfault+0x2a>
+  802774:	c3                   	ret
+  802775:	48 83 c1 01          	add    $0x1,%rcx
+  802779:	48 83 c2 18          	add    $0x18,%rdx
+  80277d:	48 83 f9 20          	cmp    $0x20,%rcx
+  802781:	74 6e                	je     8027f1 <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  802783:	48 8b 02             	mov    (%rdx),%rax
+  802786:	48 83 e8 01          	sub    $0x1,%rax
+  80278a:	48 39 f0             	cmp    %rsi,%rax
+  80278d:	73 e6                	jae    802775 <mmap_pgfault+0x1c>
+  80278f:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  802793:	73 e0                	jae    802775 <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  802795:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  802799:	b8 00 00 00 00       	mov    $0x0,%eax
+  80279e:	f6 c2 01             	test   $0x1,%dl
+  8027a1:	75 d1                	jne    802774 <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  8027a3:	f6 c2 02             	test   $0x2,%dl
+  8027a6:	74 1a                	je     8027c2 <mmap_pgfault+0x69>
+  8027a8:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  8027ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027b1:	48 bf 00 20 82 00 00 	movabs $0x822000,%rdi
+  8027b8:	00 00 00 
+  8027bb:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  8027c0:	74 35                	je     8027f7 <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  8027c2:	55                   	push   %rbp
+  8027c3:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  8027c6:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  8027ca:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8027d1:	00 00 00 
+  8027d4:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  8027d8:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8027dd:	48 b8 48 26 80 00 00 	movabs $0x802648,%rax
+  8027e4:	00 00 00 
+  8027e7:	ff d0                	call   *%rax
+  8027e9:	48 85 c0             	test   %rax,%rax
+  8027ec:	0f 9f c0             	setg   %al
+}
+  8027ef:	5d                   	pop    %rbp
+  8027f0:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  8027f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027f6:	c3                   	ret
+}
+  8027f7:	c3                   	ret
+
+00000000008027f8 <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  8027f8:	55                   	push   %rbp
+  8027f9:	48 89 e5             	mov    %rsp,%rbp
+  8027fc:	41 54                	push   %r12
+  8027fe:	53                   	push   %rbx
+  8027ff:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802802:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  802809:	00 00 00 
+  80280c:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  802811:	48 83 38 00          	cmpq   $0x0,(%rax)
+  802815:	74 15                	je     80282c <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802817:	48 83 c3 01          	add    $0x1,%rbx
+  80281b:	48 83 c0 18          	add    $0x18,%rax
+  80281f:	48 83 fb 20          	cmp    $0x20,%rbx
+  802823:	75 ec                	jne    802811 <mmap_alloc+0x19>
+    return NULL;
+  802825:	b8 00 00 00 00       	mov    $0x0,%eax
+  80282a:	eb 52                	jmp    80287e <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  80282c:	4c 89 e7             	mov    %r12,%rdi
+  80282f:	48 b8 61 43 80 00 00 	movabs $0x804361,%rax
+  802836:	00 00 00 
+  802839:	ff d0                	call   *%rax
+  80283b:	41 89 c1             	mov    %eax,%r9d
+  80283e:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  802845:	48 c1 e1 0c          	shl    $0xc,%rcx
+  802849:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80284f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802854:	4c 89 e6             	mov    %r12,%rsi
+  802857:	bf 00 00 00 00       	mov    $0x0,%edi
+  80285c:	48 b8 a8 15 80 00 00 	movabs $0x8015a8,%rax
+  802863:	00 00 00 
+  802866:	ff d0                	call   *%rax
+  802868:	85 c0                	test   %eax,%eax
+  80286a:	78 17                	js     802883 <mmap_alloc+0x8b>
+        return &mmaps[i];
+  80286c:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  802870:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  802877:	00 00 00 
+  80287a:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  80287e:	5b                   	pop    %rbx
+  80287f:	41 5c                	pop    %r12
+  802881:	5d                   	pop    %rbp
+  802882:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  802883:	b8 00 00 00 00       	mov    $0x0,%eax
+  802888:	eb f4                	jmp    80287e <mmap_alloc+0x86>
+
+000000000080288a <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  80288a:	55                   	push   %rbp
+  80288b:	48 89 e5             	mov    %rsp,%rbp
+  80288e:	41 56                	push   %r14
+  802890:	41 55                	push   %r13
+  802892:	41 54                	push   %r12
+  802894:	53                   	push   %rbx
+  802895:	48 83 ec 10          	sub    $0x10,%rsp
+  802899:	41 89 fc             	mov    %edi,%r12d
+  80289c:	49 89 f5             	mov    %rsi,%r13
+  80289f:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  8028a2:	48 89 f0             	mov    %rsi,%rax
+  8028a5:	48 09 d0             	or     %rdx,%rax
+  8028a8:	75 0d                	jne    8028b7 <fsipc+0x2d>
+  8028aa:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  8028ad:	83 f8 04             	cmp    $0x4,%eax
+  8028b0:	76 7d                	jbe    80292f <fsipc+0xa5>
+  8028b2:	83 ff 0d             	cmp    $0xd,%edi
+  8028b5:	74 78                	je     80292f <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  8028b7:	48 b8 d7 21 80 00 00 	movabs $0x8021d7,%rax
+  8028be:	00 00 00 
+  8028c1:	ff d0                	call   *%rax
+  8028c3:	89 c7                	mov    %eax,%edi
+  8028c5:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  8028cc:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  8028d3:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  8028da:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8028e0:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  8028e7:	00 00 00 
+  8028ea:	44 89 e6             	mov    %r12d,%esi
+  8028ed:	48 b8 6e 4c 80 00 00 	movabs $0x804c6e,%rax
+  8028f4:	00 00 00 
+  8028f7:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  8028f9:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  802900:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  802901:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802906:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80290a:	4c 89 ee             	mov    %r13,%rsi
+  80290d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802912:	48 b8 4a 4c 80 00 00 	movabs $0x804c4a,%rax
+  802919:	00 00 00 
+  80291c:	ff d0                	call   *%rax
+  80291e:	89 c3                	mov    %eax,%ebx
+}
+  802920:	89 d8                	mov    %ebx,%eax
+  802922:	48 83 c4 10          	add    $0x10,%rsp
+  802926:	5b                   	pop    %rbx
+  802927:	41 5c                	pop    %r12
+  802929:	41 5d                	pop    %r13
+  80292b:	41 5e                	pop    %r14
+  80292d:	5d                   	pop    %rbp
+  80292e:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  80292f:	48 b8 3c 23 80 00 00 	movabs $0x80233c,%rax
+  802936:	00 00 00 
+  802939:	ff d0                	call   *%rax
+  80293b:	49 89 c6             	mov    %rax,%r14
+  80293e:	48 85 c0             	test   %rax,%rax
+  802941:	0f 84 70 ff ff ff    	je     8028b7 <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  802947:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  80294b:	48 b8 3e 45 80 00 00 	movabs $0x80453e,%rax
+  802952:	00 00 00 
+  802955:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  802957:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  80295a:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  802961:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  802965:	ba 10 00 00 00       	mov    $0x10,%edx
+  80296a:	48 be 00 00 83 00 00 	movabs $0x830000,%rsi
+  802971:	00 00 00 
+  802974:	48 b8 54 12 80 00 00 	movabs $0x801254,%rax
+  80297b:	00 00 00 
+  80297e:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  802980:	4c 89 f7             	mov    %r14,%rdi
+  802983:	48 b8 d8 23 80 00 00 	movabs $0x8023d8,%rax
+  80298a:	00 00 00 
+  80298d:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  80298f:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  802996:	4c 89 f7             	mov    %r14,%rdi
+  802999:	48 b8 01 46 80 00 00 	movabs $0x804601,%rax
+  8029a0:	00 00 00 
+  8029a3:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  8029a5:	4c 89 f7             	mov    %r14,%rdi
+  8029a8:	48 b8 8f 45 80 00 00 	movabs $0x80458f,%rax
+  8029af:	00 00 00 
+  8029b2:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  8029b4:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  8029b7:	41 83 fc 05          	cmp    $0x5,%r12d
+  8029bb:	75 04                	jne    8029c1 <fsipc+0x137>
+  8029bd:	85 db                	test   %ebx,%ebx
+  8029bf:	79 14                	jns    8029d5 <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  8029c1:	4c 89 f7             	mov    %r14,%rdi
+  8029c4:	48 b8 b6 45 80 00 00 	movabs $0x8045b6,%rax
+  8029cb:	00 00 00 
+  8029ce:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  8029d0:	e9 4b ff ff ff       	jmp    802920 <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  8029d5:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  8029d9:	ba 88 00 00 00       	mov    $0x88,%edx
+  8029de:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  8029e5:	00 00 00 
+  8029e8:	48 b8 54 12 80 00 00 	movabs $0x801254,%rax
+  8029ef:	00 00 00 
+  8029f2:	ff d0                	call   *%rax
+  8029f4:	eb cb                	jmp    8029c1 <fsipc+0x137>
+
+00000000008029f6 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  8029f6:	55                   	push   %rbp
+  8029f7:	48 89 e5             	mov    %rsp,%rbp
+  8029fa:	41 57                	push   %r15
+  8029fc:	41 56                	push   %r14
+  8029fe:	41 55                	push   %r13
+  802a00:	41 54                	push   %r12
+  802a02:	53                   	push   %rbx
+  802a03:	48 83 ec 18          	sub    $0x18,%rsp
+  802a07:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  802a0b:	49 89 f6             	mov    %rsi,%r14
+  802a0e:	49 89 d4             	mov    %rdx,%r12
+  802a11:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  802a14:	48 b8 3c 23 80 00 00 	movabs $0x80233c,%rax
+  802a1b:	00 00 00 
+  802a1e:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  802a20:	48 85 c0             	test   %rax,%rax
+  802a23:	0f 85 96 00 00 00    	jne    802abf <devfile_write_direct+0xc9>
+    size_t write = 0;
+  802a29:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802a30:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802a31:	49 bf 00 00 83 00 00 	movabs $0x830000,%r15
+  802a38:	00 00 00 
+    while (n) {
+  802a3b:	4d 85 e4             	test   %r12,%r12
+  802a3e:	74 79                	je     802ab9 <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802a40:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  802a45:	49 39 dc             	cmp    %rbx,%r12
+  802a48:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  802a4c:	48 89 da             	mov    %rbx,%rdx
+  802a4f:	4c 89 f6             	mov    %r14,%rsi
+  802a52:	48 bf 00 10 83 00 00 	movabs $0x831000,%rdi
+  802a59:	00 00 00 
+  802a5c:	48 b8 54 12 80 00 00 	movabs $0x801254,%rax
+  802a63:	00 00 00 
+  802a66:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802a68:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802a6c:	8b 40 0c             	mov    0xc(%rax),%eax
+  802a6f:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  802a72:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802a75:	44 01 e8             	add    %r13d,%eax
+  802a78:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  802a7c:	41 0f 44 c5          	cmove  %r13d,%eax
+  802a80:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  802a84:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  802a88:	48 89 da             	mov    %rbx,%rdx
+  802a8b:	be 00 00 00 00       	mov    $0x0,%esi
+  802a90:	bf 04 00 00 00       	mov    $0x4,%edi
+  802a95:	48 b8 8a 28 80 00 00 	movabs $0x80288a,%rax
+  802a9c:	00 00 00 
+  802a9f:	ff d0                	call   *%rax
+        if (res < 0)
+  802aa1:	85 c0                	test   %eax,%eax
+  802aa3:	78 4a                	js     802aef <devfile_write_direct+0xf9>
+        buf += res;
+  802aa5:	48 98                	cltq
+  802aa7:	49 01 c6             	add    %rax,%r14
+        write += res;
+  802aaa:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  802aae:	49 29 c4             	sub    %rax,%r12
+  802ab1:	75 8d                	jne    802a40 <devfile_write_direct+0x4a>
+    return write;
+  802ab3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802ab7:	eb 27                	jmp    802ae0 <devfile_write_direct+0xea>
+    size_t write = 0;
+  802ab9:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  802abd:	eb f4                	jmp    802ab3 <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  802abf:	45 89 e9             	mov    %r13d,%r9d
+  802ac2:	4d 89 e0             	mov    %r12,%r8
+  802ac5:	4c 89 f1             	mov    %r14,%rcx
+  802ac8:	ba 04 00 00 00       	mov    $0x4,%edx
+  802acd:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802ad1:	48 89 c7             	mov    %rax,%rdi
+  802ad4:	48 b8 23 24 80 00 00 	movabs $0x802423,%rax
+  802adb:	00 00 00 
+  802ade:	ff d0                	call   *%rax
+}
+  802ae0:	48 83 c4 18          	add    $0x18,%rsp
+  802ae4:	5b                   	pop    %rbx
+  802ae5:	41 5c                	pop    %r12
+  802ae7:	41 5d                	pop    %r13
+  802ae9:	41 5e                	pop    %r14
+  802aeb:	41 5f                	pop    %r15
+  802aed:	5d                   	pop    %rbp
+  802aee:	c3                   	ret
+            return res;
+  802aef:	48 98                	cltq
+  802af1:	eb ed                	jmp    802ae0 <devfile_write_direct+0xea>
+
+0000000000802af3 <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  802af3:	55                   	push   %rbp
+  802af4:	48 89 e5             	mov    %rsp,%rbp
+  802af7:	41 54                	push   %r12
+  802af9:	53                   	push   %rbx
+  802afa:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  802afd:	48 b8 a6 23 80 00 00 	movabs $0x8023a6,%rax
+  802b04:	00 00 00 
+  802b07:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  802b09:	48 85 c0             	test   %rax,%rax
+  802b0c:	74 71                	je     802b7f <fbuf_flush+0x8c>
+  802b0e:	48 89 c3             	mov    %rax,%rbx
+  802b11:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b16:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  802b1a:	75 05                	jne    802b21 <fbuf_flush+0x2e>
+}
+  802b1c:	5b                   	pop    %rbx
+  802b1d:	41 5c                	pop    %r12
+  802b1f:	5d                   	pop    %rbp
+  802b20:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  802b21:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  802b24:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  802b28:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802b2f:	00 00 00 
+  802b32:	48 89 de             	mov    %rbx,%rsi
+  802b35:	48 29 c6             	sub    %rax,%rsi
+  802b38:	48 c1 fe 03          	sar    $0x3,%rsi
+  802b3c:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802b43:	aa aa aa 
+  802b46:	48 0f af f0          	imul   %rax,%rsi
+  802b4a:	48 c1 e6 0e          	shl    $0xe,%rsi
+  802b4e:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802b53:	48 01 c6             	add    %rax,%rsi
+  802b56:	4c 89 e7             	mov    %r12,%rdi
+  802b59:	48 b8 f6 29 80 00 00 	movabs $0x8029f6,%rax
+  802b60:	00 00 00 
+  802b63:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  802b65:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  802b69:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802b70:	00 
+    return res < 0 ? res : 0;
+  802b71:	48 85 c0             	test   %rax,%rax
+  802b74:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b79:	48 0f 4f c2          	cmovg  %rdx,%rax
+  802b7d:	eb 9d                	jmp    802b1c <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  802b7f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b84:	eb 96                	jmp    802b1c <fbuf_flush+0x29>
+
+0000000000802b86 <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  802b86:	55                   	push   %rbp
+  802b87:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  802b8a:	48 b8 f3 2a 80 00 00 	movabs $0x802af3,%rax
+  802b91:	00 00 00 
+  802b94:	ff d0                	call   *%rax
+}
+  802b96:	5d                   	pop    %rbp
+  802b97:	c3                   	ret
+
+0000000000802b98 <devfile_write>:
+    if (!fd || !buf)
+  802b98:	48 85 ff             	test   %rdi,%rdi
+  802b9b:	0f 84 d3 01 00 00    	je     802d74 <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802ba1:	55                   	push   %rbp
+  802ba2:	48 89 e5             	mov    %rsp,%rbp
+  802ba5:	41 57                	push   %r15
+  802ba7:	41 56                	push   %r14
+  802ba9:	41 55                	push   %r13
+  802bab:	41 54                	push   %r12
+  802bad:	53                   	push   %rbx
+  802bae:	48 83 ec 08          	sub    $0x8,%rsp
+  802bb2:	49 89 fc             	mov    %rdi,%r12
+  802bb5:	49 89 f6             	mov    %rsi,%r14
+  802bb8:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  802bbb:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802bc0:	48 85 f6             	test   %rsi,%rsi
+  802bc3:	0f 84 9c 01 00 00    	je     802d65 <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  802bc9:	48 b8 a6 23 80 00 00 	movabs $0x8023a6,%rax
+  802bd0:	00 00 00 
+  802bd3:	ff d0                	call   *%rax
+  802bd5:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  802bd8:	48 85 c0             	test   %rax,%rax
+  802bdb:	0f 84 a2 00 00 00    	je     802c83 <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802be1:	be 00 10 00 00       	mov    $0x1000,%esi
+  802be6:	4c 89 e7             	mov    %r12,%rdi
+  802be9:	48 b8 17 15 80 00 00 	movabs $0x801517,%rax
+  802bf0:	00 00 00 
+  802bf3:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  802bf5:	83 f8 02             	cmp    $0x2,%eax
+  802bf8:	0f 8f 85 00 00 00    	jg     802c83 <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  802bfe:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802c05:	00 00 00 
+  802c08:	4d 89 ef             	mov    %r13,%r15
+  802c0b:	49 29 c7             	sub    %rax,%r15
+  802c0e:	49 c1 ff 03          	sar    $0x3,%r15
+  802c12:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802c19:	aa aa aa 
+  802c1c:	4c 0f af f8          	imul   %rax,%r15
+  802c20:	49 c1 e7 0e          	shl    $0xe,%r15
+  802c24:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802c29:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  802c2c:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802c31:	0f 84 d7 00 00 00    	je     802d0e <devfile_write+0x176>
+  802c37:	49 8b 45 10          	mov    0x10(%r13),%rax
+  802c3b:	89 c2                	mov    %eax,%edx
+  802c3d:	41 03 55 0c          	add    0xc(%r13),%edx
+  802c41:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  802c46:	75 0f                	jne    802c57 <devfile_write+0xbf>
+  802c48:	48 01 d8             	add    %rbx,%rax
+  802c4b:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  802c51:	0f 86 92 00 00 00    	jbe    802ce9 <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802c57:	4c 89 e7             	mov    %r12,%rdi
+  802c5a:	48 b8 f3 2a 80 00 00 	movabs $0x802af3,%rax
+  802c61:	00 00 00 
+  802c64:	ff d0                	call   *%rax
+  802c66:	85 c0                	test   %eax,%eax
+  802c68:	78 52                	js     802cbc <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802c6a:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802c71:	77 7f                	ja     802cf2 <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  802c73:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802c78:	0f 85 c2 00 00 00    	jne    802d40 <devfile_write+0x1a8>
+  802c7e:	e9 94 00 00 00       	jmp    802d17 <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  802c83:	4c 89 e7             	mov    %r12,%rdi
+  802c86:	48 b8 f3 2a 80 00 00 	movabs $0x802af3,%rax
+  802c8d:	00 00 00 
+  802c90:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802c92:	85 c0                	test   %eax,%eax
+  802c94:	79 07                	jns    802c9d <devfile_write+0x105>
+  802c96:	48 98                	cltq
+  802c98:	e9 c8 00 00 00       	jmp    802d65 <devfile_write+0x1cd>
+  802c9d:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802ca2:	48 89 da             	mov    %rbx,%rdx
+  802ca5:	4c 89 f6             	mov    %r14,%rsi
+  802ca8:	4c 89 e7             	mov    %r12,%rdi
+  802cab:	48 b8 f6 29 80 00 00 	movabs $0x8029f6,%rax
+  802cb2:	00 00 00 
+  802cb5:	ff d0                	call   *%rax
+  802cb7:	e9 a9 00 00 00       	jmp    802d65 <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802cbc:	48 98                	cltq
+  802cbe:	e9 a2 00 00 00       	jmp    802d65 <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802cc3:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802cc8:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802ccd:	4c 89 fe             	mov    %r15,%rsi
+  802cd0:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cd5:	48 b8 52 15 80 00 00 	movabs $0x801552,%rax
+  802cdc:	00 00 00 
+  802cdf:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  802ce1:	85 c0                	test   %eax,%eax
+  802ce3:	79 45                	jns    802d2a <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802ce5:	48 98                	cltq
+  802ce7:	eb 7c                	jmp    802d65 <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802ce9:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802cf0:	76 4e                	jbe    802d40 <devfile_write+0x1a8>
+  802cf2:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802cf7:	48 89 da             	mov    %rbx,%rdx
+  802cfa:	4c 89 f6             	mov    %r14,%rsi
+  802cfd:	4c 89 e7             	mov    %r12,%rdi
+  802d00:	48 b8 f6 29 80 00 00 	movabs $0x8029f6,%rax
+  802d07:	00 00 00 
+  802d0a:	ff d0                	call   *%rax
+  802d0c:	eb 57                	jmp    802d65 <devfile_write+0x1cd>
+  802d0e:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802d15:	77 db                	ja     802cf2 <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  802d17:	4c 89 ff             	mov    %r15,%rdi
+  802d1a:	48 b8 c0 43 80 00 00 	movabs $0x8043c0,%rax
+  802d21:	00 00 00 
+  802d24:	ff d0                	call   *%rax
+  802d26:	84 c0                	test   %al,%al
+  802d28:	74 99                	je     802cc3 <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  802d2a:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  802d2f:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802d34:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  802d38:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  802d3f:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  802d40:	4c 89 ff             	mov    %r15,%rdi
+  802d43:	49 03 7d 10          	add    0x10(%r13),%rdi
+  802d47:	48 89 da             	mov    %rbx,%rdx
+  802d4a:	4c 89 f6             	mov    %r14,%rsi
+  802d4d:	48 b8 54 12 80 00 00 	movabs $0x801254,%rax
+  802d54:	00 00 00 
+  802d57:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  802d59:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  802d5d:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  802d62:	48 89 d8             	mov    %rbx,%rax
+}
+  802d65:	48 83 c4 08          	add    $0x8,%rsp
+  802d69:	5b                   	pop    %rbx
+  802d6a:	41 5c                	pop    %r12
+  802d6c:	41 5d                	pop    %r13
+  802d6e:	41 5e                	pop    %r14
+  802d70:	41 5f                	pop    %r15
+  802d72:	5d                   	pop    %rbp
+  802d73:	c3                   	ret
+        return E_INVAL;
+  802d74:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802d79:	c3                   	ret
+
+0000000000802d7a <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802d7a:	55                   	push   %rbp
+  802d7b:	48 89 e5             	mov    %rsp,%rbp
+  802d7e:	41 54                	push   %r12
+  802d80:	53                   	push   %rbx
+  802d81:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  802d84:	48 b8 f3 2a 80 00 00 	movabs $0x802af3,%rax
+  802d8b:	00 00 00 
+  802d8e:	ff d0                	call   *%rax
+  802d90:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  802d93:	48 89 df             	mov    %rbx,%rdi
+  802d96:	48 b8 a6 23 80 00 00 	movabs $0x8023a6,%rax
+  802d9d:	00 00 00 
+  802da0:	ff d0                	call   *%rax
+  802da2:	48 85 c0             	test   %rax,%rax
+  802da5:	74 17                	je     802dbe <devfile_flush+0x44>
+  802da7:	48 89 df             	mov    %rbx,%rdi
+  802daa:	48 b8 a6 23 80 00 00 	movabs $0x8023a6,%rax
+  802db1:	00 00 00 
+  802db4:	ff d0                	call   *%rax
+  802db6:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  802dbd:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802dbe:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802dc1:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  802dc8:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  802dca:	ba 00 00 00 00       	mov    $0x0,%edx
+  802dcf:	be 00 00 00 00       	mov    $0x0,%esi
+  802dd4:	bf 06 00 00 00       	mov    $0x6,%edi
+  802dd9:	48 b8 8a 28 80 00 00 	movabs $0x80288a,%rax
+  802de0:	00 00 00 
+  802de3:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802de5:	45 85 e4             	test   %r12d,%r12d
+  802de8:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802dec:	5b                   	pop    %rbx
+  802ded:	41 5c                	pop    %r12
+  802def:	5d                   	pop    %rbp
+  802df0:	c3                   	ret
+
+0000000000802df1 <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  802df1:	55                   	push   %rbp
+  802df2:	48 89 e5             	mov    %rsp,%rbp
+  802df5:	41 57                	push   %r15
+  802df7:	41 56                	push   %r14
+  802df9:	41 55                	push   %r13
+  802dfb:	41 54                	push   %r12
+  802dfd:	53                   	push   %rbx
+  802dfe:	48 83 ec 38          	sub    $0x38,%rsp
+  802e02:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  802e06:	49 89 f7             	mov    %rsi,%r15
+  802e09:	48 89 d3             	mov    %rdx,%rbx
+  802e0c:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  802e0f:	48 b8 3c 23 80 00 00 	movabs $0x80233c,%rax
+  802e16:	00 00 00 
+  802e19:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802e1b:	48 85 c0             	test   %rax,%rax
+  802e1e:	75 20                	jne    802e40 <devfile_read_direct+0x4f>
+    bool map = 1;
+  802e20:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  802e25:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802e2c:	00 
+    while (n) {
+  802e2d:	48 85 db             	test   %rbx,%rbx
+  802e30:	0f 85 df 00 00 00    	jne    802f15 <devfile_read_direct+0x124>
+    size_t read = 0;
+  802e36:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  802e3a:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802e3e:	eb 21                	jmp    802e61 <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802e40:	45 89 f1             	mov    %r14d,%r9d
+  802e43:	49 89 d8             	mov    %rbx,%r8
+  802e46:	4c 89 f9             	mov    %r15,%rcx
+  802e49:	ba 03 00 00 00       	mov    $0x3,%edx
+  802e4e:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802e52:	48 89 c7             	mov    %rax,%rdi
+  802e55:	48 b8 23 24 80 00 00 	movabs $0x802423,%rax
+  802e5c:	00 00 00 
+  802e5f:	ff d0                	call   *%rax
+}
+  802e61:	48 83 c4 38          	add    $0x38,%rsp
+  802e65:	5b                   	pop    %rbx
+  802e66:	41 5c                	pop    %r12
+  802e68:	41 5d                	pop    %r13
+  802e6a:	41 5e                	pop    %r14
+  802e6c:	41 5f                	pop    %r15
+  802e6e:	5d                   	pop    %rbp
+  802e6f:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802e70:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802e74:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802e7a:	75 1e                	jne    802e9a <devfile_read_direct+0xa9>
+  802e7c:	e9 e2 00 00 00       	jmp    802f63 <devfile_read_direct+0x172>
+            if (!res) return read;
+  802e81:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802e85:	eb da                	jmp    802e61 <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  802e87:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  802e8b:	0f 85 d0 01 00 00    	jne    803061 <devfile_read_direct+0x270>
+            map = 0;
+  802e91:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802e95:	eb 03                	jmp    802e9a <devfile_read_direct+0xa9>
+  802e97:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802e9a:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802e9f:	48 39 d3             	cmp    %rdx,%rbx
+  802ea2:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802ea6:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802eaa:	8b 40 0c             	mov    0xc(%rax),%eax
+  802ead:	48 b9 00 00 83 00 00 	movabs $0x830000,%rcx
+  802eb4:	00 00 00 
+  802eb7:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  802eb9:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  802ebd:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  802ec1:	be 00 00 00 00       	mov    $0x0,%esi
+  802ec6:	bf 03 00 00 00       	mov    $0x3,%edi
+  802ecb:	48 b8 8a 28 80 00 00 	movabs $0x80288a,%rax
+  802ed2:	00 00 00 
+  802ed5:	ff d0                	call   *%rax
+        if (res <= 0)
+  802ed7:	85 c0                	test   %eax,%eax
+  802ed9:	0f 8e 63 01 00 00    	jle    803042 <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  802edf:	4c 63 e0             	movslq %eax,%r12
+  802ee2:	4c 89 e2             	mov    %r12,%rdx
+  802ee5:	48 be 00 10 83 00 00 	movabs $0x831000,%rsi
+  802eec:	00 00 00 
+  802eef:	4c 89 ff             	mov    %r15,%rdi
+  802ef2:	48 b8 54 12 80 00 00 	movabs $0x801254,%rax
+  802ef9:	00 00 00 
+  802efc:	ff d0                	call   *%rax
+        buf += res;
+  802efe:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  802f01:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  802f04:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  802f08:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  802f0c:	48 85 db             	test   %rbx,%rbx
+  802f0f:	0f 84 25 ff ff ff    	je     802e3a <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  802f15:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  802f18:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  802f1c:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802f20:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802f24:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  802f2b:	0f 97 c2             	seta   %dl
+  802f2e:	20 c2                	and    %al,%dl
+  802f30:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  802f33:	0f 84 5e ff ff ff    	je     802e97 <devfile_read_direct+0xa6>
+  802f39:	4c 89 fa             	mov    %r15,%rdx
+  802f3c:	4d 89 fd             	mov    %r15,%r13
+  802f3f:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  802f46:	0f 85 4e ff ff ff    	jne    802e9a <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  802f4c:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802f50:	0f 84 1a ff ff ff    	je     802e70 <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802f56:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802f5d:	0f 85 37 ff ff ff    	jne    802e9a <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  802f63:	48 89 d8             	mov    %rbx,%rax
+  802f66:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802f6c:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802f71:	48 39 c8             	cmp    %rcx,%rax
+  802f74:	48 0f 47 c1          	cmova  %rcx,%rax
+  802f78:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  802f7c:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  802f80:	49 89 d4             	mov    %rdx,%r12
+  802f83:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  802f87:	48 b8 61 43 80 00 00 	movabs $0x804361,%rax
+  802f8e:	00 00 00 
+  802f91:	ff d0                	call   *%rax
+  802f93:	a8 40                	test   $0x40,%al
+  802f95:	0f 85 b9 00 00 00    	jne    803054 <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  802f9b:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  802fa2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802fa6:	49 39 c5             	cmp    %rax,%r13
+  802fa9:	72 d8                	jb     802f83 <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802fab:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802faf:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802fb6:	00 00 00 
+  802fb9:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802fbd:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  802fc0:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  802fc2:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  802fc6:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  802fca:	48 b8 d7 21 80 00 00 	movabs $0x8021d7,%rax
+  802fd1:	00 00 00 
+  802fd4:	ff d0                	call   *%rax
+  802fd6:	89 c7                	mov    %eax,%edi
+  802fd8:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802fde:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802fe3:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802fea:	00 00 00 
+  802fed:	be 0e 00 00 00       	mov    $0xe,%esi
+  802ff2:	48 b8 6e 4c 80 00 00 	movabs $0x804c6e,%rax
+  802ff9:	00 00 00 
+  802ffc:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  802ffe:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803003:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  803007:	4c 89 fe             	mov    %r15,%rsi
+  80300a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80300f:	48 b8 4a 4c 80 00 00 	movabs $0x804c4a,%rax
+  803016:	00 00 00 
+  803019:	ff d0                	call   *%rax
+  80301b:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  80301e:	48 85 d2             	test   %rdx,%rdx
+  803021:	0f 84 5a fe ff ff    	je     802e81 <devfile_read_direct+0x90>
+            if (res > 0) {
+  803027:	0f 8e 5a fe ff ff    	jle    802e87 <devfile_read_direct+0x96>
+                buf += res;
+  80302d:	48 98                	cltq
+  80302f:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  803032:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  803035:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  803039:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  80303d:	e9 ca fe ff ff       	jmp    802f0c <devfile_read_direct+0x11b>
+            return res ? res : read;
+  803042:	41 89 c5             	mov    %eax,%r13d
+  803045:	48 98                	cltq
+  803047:	45 85 ed             	test   %r13d,%r13d
+  80304a:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  80304f:	e9 0d fe ff ff       	jmp    802e61 <devfile_read_direct+0x70>
+            map = 0;
+  803054:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  803058:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  80305c:	e9 39 fe ff ff       	jmp    802e9a <devfile_read_direct+0xa9>
+  803061:	48 89 d0             	mov    %rdx,%rax
+  803064:	e9 f8 fd ff ff       	jmp    802e61 <devfile_read_direct+0x70>
+
+0000000000803069 <devfile_read>:
+    if (!fd || !buf)
+  803069:	48 85 ff             	test   %rdi,%rdi
+  80306c:	0f 84 21 02 00 00    	je     803293 <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803072:	55                   	push   %rbp
+  803073:	48 89 e5             	mov    %rsp,%rbp
+  803076:	41 57                	push   %r15
+  803078:	41 56                	push   %r14
+  80307a:	41 55                	push   %r13
+  80307c:	41 54                	push   %r12
+  80307e:	53                   	push   %rbx
+  80307f:	48 83 ec 28          	sub    $0x28,%rsp
+  803083:	48 89 fb             	mov    %rdi,%rbx
+  803086:	49 89 f4             	mov    %rsi,%r12
+  803089:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  80308c:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  803091:	48 85 f6             	test   %rsi,%rsi
+  803094:	74 4b                	je     8030e1 <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  803096:	48 b8 a6 23 80 00 00 	movabs $0x8023a6,%rax
+  80309d:	00 00 00 
+  8030a0:	ff d0                	call   *%rax
+  8030a2:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  8030a5:	48 85 c0             	test   %rax,%rax
+  8030a8:	74 22                	je     8030cc <devfile_read+0x63>
+  8030aa:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  8030b1:	77 19                	ja     8030cc <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  8030b3:	be 00 10 00 00       	mov    $0x1000,%esi
+  8030b8:	48 89 df             	mov    %rbx,%rdi
+  8030bb:	48 b8 17 15 80 00 00 	movabs $0x801517,%rax
+  8030c2:	00 00 00 
+  8030c5:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  8030c7:	83 f8 02             	cmp    $0x2,%eax
+  8030ca:	7e 40                	jle    80310c <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  8030cc:	48 89 df             	mov    %rbx,%rdi
+  8030cf:	48 b8 f3 2a 80 00 00 	movabs $0x802af3,%rax
+  8030d6:	00 00 00 
+  8030d9:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  8030db:	85 c0                	test   %eax,%eax
+  8030dd:	79 11                	jns    8030f0 <devfile_read+0x87>
+  8030df:	48 98                	cltq
+}
+  8030e1:	48 83 c4 28          	add    $0x28,%rsp
+  8030e5:	5b                   	pop    %rbx
+  8030e6:	41 5c                	pop    %r12
+  8030e8:	41 5d                	pop    %r13
+  8030ea:	41 5e                	pop    %r14
+  8030ec:	41 5f                	pop    %r15
+  8030ee:	5d                   	pop    %rbp
+  8030ef:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  8030f0:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  8030f5:	4c 89 ea             	mov    %r13,%rdx
+  8030f8:	4c 89 e6             	mov    %r12,%rsi
+  8030fb:	48 89 df             	mov    %rbx,%rdi
+  8030fe:	48 b8 f1 2d 80 00 00 	movabs $0x802df1,%rax
+  803105:	00 00 00 
+  803108:	ff d0                	call   *%rax
+  80310a:	eb d5                	jmp    8030e1 <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  80310c:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  803110:	48 89 df             	mov    %rbx,%rdi
+  803113:	48 b8 f3 2a 80 00 00 	movabs $0x802af3,%rax
+  80311a:	00 00 00 
+  80311d:	ff d0                	call   *%rax
+  80311f:	85 c0                	test   %eax,%eax
+  803121:	0f 88 33 01 00 00    	js     80325a <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  803127:	48 ba 00 23 82 00 00 	movabs $0x822300,%rdx
+  80312e:	00 00 00 
+  803131:	4c 89 f0             	mov    %r14,%rax
+  803134:	48 29 d0             	sub    %rdx,%rax
+  803137:	48 c1 f8 03          	sar    $0x3,%rax
+  80313b:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  803142:	aa aa aa 
+  803145:	48 0f af c2          	imul   %rdx,%rax
+  803149:	48 c1 e0 0e          	shl    $0xe,%rax
+  80314d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  803151:	8b 43 0c             	mov    0xc(%rbx),%eax
+  803154:	41 39 06             	cmp    %eax,(%r14)
+  803157:	75 0d                	jne    803166 <devfile_read+0xfd>
+  803159:	8b 43 10             	mov    0x10(%rbx),%eax
+  80315c:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  803160:	0f 84 fb 00 00 00    	je     803261 <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  803166:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  80316b:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80316f:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  803172:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803176:	48 89 c7             	mov    %rax,%rdi
+  803179:	48 b8 c0 43 80 00 00 	movabs $0x8043c0,%rax
+  803180:	00 00 00 
+  803183:	ff d0                	call   *%rax
+  803185:	84 c0                	test   %al,%al
+  803187:	75 27                	jne    8031b0 <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  803189:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80318e:	ba 00 40 00 00       	mov    $0x4000,%edx
+  803193:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803197:	bf 00 00 00 00       	mov    $0x0,%edi
+  80319c:	48 b8 52 15 80 00 00 	movabs $0x801552,%rax
+  8031a3:	00 00 00 
+  8031a6:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  8031a8:	85 c0                	test   %eax,%eax
+  8031aa:	0f 88 dc 00 00 00    	js     80328c <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  8031b0:	44 89 f8             	mov    %r15d,%eax
+  8031b3:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8031b8:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  8031ba:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  8031c1:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  8031c2:	8b 43 10             	mov    0x10(%rbx),%eax
+  8031c5:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  8031c9:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  8031cc:	ba 00 40 00 00       	mov    $0x4000,%edx
+  8031d1:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8031d5:	48 89 df             	mov    %rbx,%rdi
+  8031d8:	48 b8 f1 2d 80 00 00 	movabs $0x802df1,%rax
+  8031df:	00 00 00 
+  8031e2:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  8031e4:	48 85 c0             	test   %rax,%rax
+  8031e7:	0f 88 f4 fe ff ff    	js     8030e1 <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  8031ed:	8b 53 0c             	mov    0xc(%rbx),%edx
+  8031f0:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  8031f3:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  8031f6:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  8031fa:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  8031fe:	48 63 d1             	movslq %ecx,%rdx
+  803201:	48 01 d0             	add    %rdx,%rax
+  803204:	4d 63 ff             	movslq %r15d,%r15
+  803207:	4c 29 f8             	sub    %r15,%rax
+  80320a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80320f:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  803213:	48 85 c0             	test   %rax,%rax
+  803216:	0f 8e c5 fe ff ff    	jle    8030e1 <devfile_read+0x78>
+    n = MIN(n, res);
+  80321c:	4c 39 e8             	cmp    %r13,%rax
+  80321f:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  803223:	8b 73 04             	mov    0x4(%rbx),%esi
+  803226:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  80322a:	48 63 f6             	movslq %esi,%rsi
+  80322d:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  803232:	48 01 c6             	add    %rax,%rsi
+  803235:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803239:	48 01 c6             	add    %rax,%rsi
+  80323c:	4c 89 ea             	mov    %r13,%rdx
+  80323f:	4c 89 e7             	mov    %r12,%rdi
+  803242:	48 b8 54 12 80 00 00 	movabs $0x801254,%rax
+  803249:	00 00 00 
+  80324c:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  80324e:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  803252:	4c 89 e8             	mov    %r13,%rax
+  803255:	e9 87 fe ff ff       	jmp    8030e1 <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  80325a:	48 98                	cltq
+  80325c:	e9 80 fe ff ff       	jmp    8030e1 <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  803261:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  803265:	41 39 d7             	cmp    %edx,%r15d
+  803268:	0f 8c f8 fe ff ff    	jl     803166 <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  80326e:	49 8b 46 10          	mov    0x10(%r14),%rax
+  803272:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  803275:	41 39 cf             	cmp    %ecx,%r15d
+  803278:	0f 8d e8 fe ff ff    	jge    803166 <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  80327e:	4d 63 ff             	movslq %r15d,%r15
+  803281:	4c 29 f8             	sub    %r15,%rax
+  803284:	48 63 d2             	movslq %edx,%rdx
+  803287:	48 01 d0             	add    %rdx,%rax
+  80328a:	eb 87                	jmp    803213 <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  80328c:	48 98                	cltq
+  80328e:	e9 4e fe ff ff       	jmp    8030e1 <devfile_read+0x78>
+        return E_INVAL;
+  803293:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  803298:	c3                   	ret
+
+0000000000803299 <fs_channel>:
+fs_channel(bool enable) {
+  803299:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  80329b:	a2 04 26 82 00 00 00 	movabs %al,0x822604
+  8032a2:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  8032a4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032a9:	40 84 ff             	test   %dil,%dil
+  8032ac:	74 47                	je     8032f5 <fs_channel+0x5c>
+  8032ae:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8032b5:	00 00 00 
+  8032b8:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  8032be:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  8032c5:	00 00 00 
+  8032c8:	3b 08                	cmp    (%rax),%ecx
+  8032ca:	74 29                	je     8032f5 <fs_channel+0x5c>
+fs_channel(bool enable) {
+  8032cc:	55                   	push   %rbp
+  8032cd:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  8032d0:	48 b8 19 22 80 00 00 	movabs $0x802219,%rax
+  8032d7:	00 00 00 
+  8032da:	ff d0                	call   *%rax
+  8032dc:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  8032de:	85 c0                	test   %eax,%eax
+  8032e0:	78 04                	js     8032e6 <fs_channel+0x4d>
+}
+  8032e2:	89 d0                	mov    %edx,%eax
+  8032e4:	5d                   	pop    %rbp
+  8032e5:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  8032e6:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  8032ed:	00 00 00 
+  8032f0:	c6 00 00             	movb   $0x0,(%rax)
+  8032f3:	eb ed                	jmp    8032e2 <fs_channel+0x49>
+}
+  8032f5:	89 d0                	mov    %edx,%eax
+  8032f7:	c3                   	ret
+
+00000000008032f8 <open>:
+open(const char *path, int mode) {
+  8032f8:	55                   	push   %rbp
+  8032f9:	48 89 e5             	mov    %rsp,%rbp
+  8032fc:	41 55                	push   %r13
+  8032fe:	41 54                	push   %r12
+  803300:	53                   	push   %rbx
+  803301:	48 83 ec 18          	sub    $0x18,%rsp
+  803305:	49 89 fc             	mov    %rdi,%r12
+  803308:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80330b:	48 b8 b5 0f 80 00 00 	movabs $0x800fb5,%rax
+  803312:	00 00 00 
+  803315:	ff d0                	call   *%rax
+  803317:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80331d:	0f 87 8f 00 00 00    	ja     8033b2 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803323:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803327:	48 b8 d3 1a 80 00 00 	movabs $0x801ad3,%rax
+  80332e:	00 00 00 
+  803331:	ff d0                	call   *%rax
+  803333:	89 c3                	mov    %eax,%ebx
+  803335:	85 c0                	test   %eax,%eax
+  803337:	78 55                	js     80338e <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  803339:	4c 89 e6             	mov    %r12,%rsi
+  80333c:	48 bb 00 00 83 00 00 	movabs $0x830000,%rbx
+  803343:	00 00 00 
+  803346:	48 89 df             	mov    %rbx,%rdi
+  803349:	48 b8 f3 0f 80 00 00 	movabs $0x800ff3,%rax
+  803350:	00 00 00 
+  803353:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803355:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  80335c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803361:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803365:	bf 01 00 00 00       	mov    $0x1,%edi
+  80336a:	48 b8 8a 28 80 00 00 	movabs $0x80288a,%rax
+  803371:	00 00 00 
+  803374:	ff d0                	call   *%rax
+  803376:	89 c3                	mov    %eax,%ebx
+  803378:	85 c0                	test   %eax,%eax
+  80337a:	78 1f                	js     80339b <open+0xa3>
+    return fd2num(fd);
+  80337c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803380:	48 b8 a5 1a 80 00 00 	movabs $0x801aa5,%rax
+  803387:	00 00 00 
+  80338a:	ff d0                	call   *%rax
+  80338c:	89 c3                	mov    %eax,%ebx
+}
+  80338e:	89 d8                	mov    %ebx,%eax
+  803390:	48 83 c4 18          	add    $0x18,%rsp
+  803394:	5b                   	pop    %rbx
+  803395:	41 5c                	pop    %r12
+  803397:	41 5d                	pop    %r13
+  803399:	5d                   	pop    %rbp
+  80339a:	c3                   	ret
+        fd_close(fd, 0);
+  80339b:	be 00 00 00 00       	mov    $0x0,%esi
+  8033a0:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8033a4:	48 b8 ee 1b 80 00 00 	movabs $0x801bee,%rax
+  8033ab:	00 00 00 
+  8033ae:	ff d0                	call   *%rax
+        return res;
+  8033b0:	eb dc                	jmp    80338e <open+0x96>
+        return -E_BAD_PATH;
+  8033b2:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8033b7:	eb d5                	jmp    80338e <open+0x96>
+
+00000000008033b9 <file_flush_buffers>:
+file_flush_buffers(void) {
+  8033b9:	55                   	push   %rbp
+  8033ba:	48 89 e5             	mov    %rsp,%rbp
+  8033bd:	41 56                	push   %r14
+  8033bf:	41 55                	push   %r13
+  8033c1:	41 54                	push   %r12
+  8033c3:	53                   	push   %rbx
+  8033c4:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  8033c8:	49 bc 08 23 82 00 00 	movabs $0x822308,%r12
+  8033cf:	00 00 00 
+  8033d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  8033d7:	49 bd 33 1b 80 00 00 	movabs $0x801b33,%r13
+  8033de:	00 00 00 
+  8033e1:	49 be f3 2a 80 00 00 	movabs $0x802af3,%r14
+  8033e8:	00 00 00 
+  8033eb:	eb 0c                	jmp    8033f9 <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  8033ed:	83 c3 01             	add    $0x1,%ebx
+  8033f0:	49 83 c4 18          	add    $0x18,%r12
+  8033f4:	83 fb 20             	cmp    $0x20,%ebx
+  8033f7:	74 1d                	je     803416 <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  8033f9:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  8033fe:	74 ed                	je     8033ed <file_flush_buffers+0x34>
+  803400:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803404:	89 df                	mov    %ebx,%edi
+  803406:	41 ff d5             	call   *%r13
+  803409:	85 c0                	test   %eax,%eax
+  80340b:	78 e0                	js     8033ed <file_flush_buffers+0x34>
+  80340d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803411:	41 ff d6             	call   *%r14
+  803414:	eb d7                	jmp    8033ed <file_flush_buffers+0x34>
+}
+  803416:	48 83 c4 10          	add    $0x10,%rsp
+  80341a:	5b                   	pop    %rbx
+  80341b:	41 5c                	pop    %r12
+  80341d:	41 5d                	pop    %r13
+  80341f:	41 5e                	pop    %r14
+  803421:	5d                   	pop    %rbp
+  803422:	c3                   	ret
+
+0000000000803423 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803423:	55                   	push   %rbp
+  803424:	48 89 e5             	mov    %rsp,%rbp
+  803427:	41 54                	push   %r12
+  803429:	53                   	push   %rbx
+  80342a:	49 89 fc             	mov    %rdi,%r12
+  80342d:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  80342f:	48 b8 b9 33 80 00 00 	movabs $0x8033b9,%rax
+  803436:	00 00 00 
+  803439:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80343b:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803442:	00 00 00 
+  803445:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  80344a:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  80344c:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  80344f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803454:	be 00 00 00 00       	mov    $0x0,%esi
+  803459:	bf 02 00 00 00       	mov    $0x2,%edi
+  80345e:	48 b8 8a 28 80 00 00 	movabs $0x80288a,%rax
+  803465:	00 00 00 
+  803468:	ff d0                	call   *%rax
+}
+  80346a:	5b                   	pop    %rbx
+  80346b:	41 5c                	pop    %r12
+  80346d:	5d                   	pop    %rbp
+  80346e:	c3                   	ret
+
+000000000080346f <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80346f:	55                   	push   %rbp
+  803470:	48 89 e5             	mov    %rsp,%rbp
+  803473:	41 54                	push   %r12
+  803475:	53                   	push   %rbx
+  803476:	49 89 fc             	mov    %rdi,%r12
+  803479:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  80347c:	48 b8 b9 33 80 00 00 	movabs $0x8033b9,%rax
+  803483:	00 00 00 
+  803486:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803488:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  80348d:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  803494:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  803496:	ba 00 00 00 00       	mov    $0x0,%edx
+  80349b:	be 00 00 00 00       	mov    $0x0,%esi
+  8034a0:	bf 05 00 00 00       	mov    $0x5,%edi
+  8034a5:	48 b8 8a 28 80 00 00 	movabs $0x80288a,%rax
+  8034ac:	00 00 00 
+  8034af:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8034b1:	85 c0                	test   %eax,%eax
+  8034b3:	78 3d                	js     8034f2 <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8034b5:	49 bc 00 00 83 00 00 	movabs $0x830000,%r12
+  8034bc:	00 00 00 
+  8034bf:	4c 89 e6             	mov    %r12,%rsi
+  8034c2:	48 89 df             	mov    %rbx,%rdi
+  8034c5:	48 b8 f3 0f 80 00 00 	movabs $0x800ff3,%rax
+  8034cc:	00 00 00 
+  8034cf:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8034d1:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8034d8:	00 
+  8034d9:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8034df:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8034e6:	00 
+  8034e7:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8034ed:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8034f2:	5b                   	pop    %rbx
+  8034f3:	41 5c                	pop    %r12
+  8034f5:	5d                   	pop    %rbp
+  8034f6:	c3                   	ret
+
+00000000008034f7 <remove>:
+remove(const char *path) {
+  8034f7:	55                   	push   %rbp
+  8034f8:	48 89 e5             	mov    %rsp,%rbp
+  8034fb:	53                   	push   %rbx
+  8034fc:	48 83 ec 08          	sub    $0x8,%rsp
+  803500:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  803503:	48 b8 b5 0f 80 00 00 	movabs $0x800fb5,%rax
+  80350a:	00 00 00 
+  80350d:	ff d0                	call   *%rax
+  80350f:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803515:	77 3a                	ja     803551 <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  803517:	48 89 de             	mov    %rbx,%rsi
+  80351a:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  803521:	00 00 00 
+  803524:	48 b8 f3 0f 80 00 00 	movabs $0x800ff3,%rax
+  80352b:	00 00 00 
+  80352e:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  803530:	ba 00 00 00 00       	mov    $0x0,%edx
+  803535:	be 00 00 00 00       	mov    $0x0,%esi
+  80353a:	bf 07 00 00 00       	mov    $0x7,%edi
+  80353f:	48 b8 8a 28 80 00 00 	movabs $0x80288a,%rax
+  803546:	00 00 00 
+  803549:	ff d0                	call   *%rax
+}
+  80354b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80354f:	c9                   	leave
+  803550:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  803551:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803556:	eb f3                	jmp    80354b <remove+0x54>
+
+0000000000803558 <sync>:
+sync(void) {
+  803558:	55                   	push   %rbp
+  803559:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  80355c:	48 b8 b9 33 80 00 00 	movabs $0x8033b9,%rax
+  803563:	00 00 00 
+  803566:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  803568:	ba 00 00 00 00       	mov    $0x0,%edx
+  80356d:	be 00 00 00 00       	mov    $0x0,%esi
+  803572:	bf 08 00 00 00       	mov    $0x8,%edi
+  803577:	48 b8 8a 28 80 00 00 	movabs $0x80288a,%rax
+  80357e:	00 00 00 
+  803581:	ff d0                	call   *%rax
+}
+  803583:	5d                   	pop    %rbp
+  803584:	c3                   	ret
+
+0000000000803585 <fsync>:
+fsync(int fdnum) {
+  803585:	55                   	push   %rbp
+  803586:	48 89 e5             	mov    %rsp,%rbp
+  803589:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80358d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803591:	48 b8 33 1b 80 00 00 	movabs $0x801b33,%rax
+  803598:	00 00 00 
+  80359b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80359d:	85 c0                	test   %eax,%eax
+  80359f:	78 4b                	js     8035ec <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8035a1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8035a5:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  8035ac:	00 00 00 
+  8035af:	8b 00                	mov    (%rax),%eax
+  8035b1:	39 02                	cmp    %eax,(%rdx)
+  8035b3:	75 39                	jne    8035ee <fsync+0x69>
+    file_flush_buffers();
+  8035b5:	48 b8 b9 33 80 00 00 	movabs $0x8033b9,%rax
+  8035bc:	00 00 00 
+  8035bf:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  8035c1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8035c5:	8b 40 0c             	mov    0xc(%rax),%eax
+  8035c8:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  8035cf:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  8035d1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035d6:	be 00 00 00 00       	mov    $0x0,%esi
+  8035db:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8035e0:	48 b8 8a 28 80 00 00 	movabs $0x80288a,%rax
+  8035e7:	00 00 00 
+  8035ea:	ff d0                	call   *%rax
+}
+  8035ec:	c9                   	leave
+  8035ed:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8035ee:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8035f3:	eb f7                	jmp    8035ec <fsync+0x67>
+
+00000000008035f5 <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  8035f5:	55                   	push   %rbp
+  8035f6:	48 89 e5             	mov    %rsp,%rbp
+  8035f9:	53                   	push   %rbx
+  8035fa:	48 83 ec 08          	sub    $0x8,%rsp
+  8035fe:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  803601:	ba 00 00 00 00       	mov    $0x0,%edx
+  803606:	be 00 00 00 00       	mov    $0x0,%esi
+  80360b:	bf 0b 00 00 00       	mov    $0xb,%edi
+  803610:	48 b8 8a 28 80 00 00 	movabs $0x80288a,%rax
+  803617:	00 00 00 
+  80361a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80361c:	85 c0                	test   %eax,%eax
+  80361e:	78 2d                	js     80364d <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  803620:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803627:	00 00 00 
+  80362a:	48 8b 10             	mov    (%rax),%rdx
+  80362d:	48 89 13             	mov    %rdx,(%rbx)
+  803630:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  803634:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  803638:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80363c:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  803640:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803644:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  803648:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80364d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803651:	c9                   	leave
+  803652:	c3                   	ret
+
+0000000000803653 <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  803653:	55                   	push   %rbp
+  803654:	48 89 e5             	mov    %rsp,%rbp
+  803657:	53                   	push   %rbx
+  803658:	48 83 ec 08          	sub    $0x8,%rsp
+  80365c:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  80365f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803664:	be 00 00 00 00       	mov    $0x0,%esi
+  803669:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80366e:	48 b8 8a 28 80 00 00 	movabs $0x80288a,%rax
+  803675:	00 00 00 
+  803678:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80367a:	85 c0                	test   %eax,%eax
+  80367c:	78 3d                	js     8036bb <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  80367e:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803685:	00 00 00 
+  803688:	48 8b 10             	mov    (%rax),%rdx
+  80368b:	48 89 13             	mov    %rdx,(%rbx)
+  80368e:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  803692:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  803696:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80369a:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  80369e:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  8036a2:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  8036a6:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  8036aa:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  8036ae:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8036b2:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  8036b6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8036bb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8036bf:	c9                   	leave
+  8036c0:	c3                   	ret
+
+00000000008036c1 <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  8036c1:	55                   	push   %rbp
+  8036c2:	48 89 e5             	mov    %rsp,%rbp
+  8036c5:	41 57                	push   %r15
+  8036c7:	41 56                	push   %r14
+  8036c9:	41 55                	push   %r13
+  8036cb:	41 54                	push   %r12
+  8036cd:	53                   	push   %rbx
+  8036ce:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  8036d2:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  8036d9:	00 
+  8036da:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  8036e1:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8036e7:	0f 85 43 01 00 00    	jne    803830 <munmap+0x16f>
+  8036ed:	49 89 ff             	mov    %rdi,%r15
+  8036f0:	4c 39 f7             	cmp    %r14,%rdi
+  8036f3:	0f 87 37 01 00 00    	ja     803830 <munmap+0x16f>
+  8036f9:	48 bb 00 20 82 00 00 	movabs $0x822000,%rbx
+  803700:	00 00 00 
+  803703:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  803709:	eb 2c                	jmp    803737 <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  80370b:	4c 39 f8             	cmp    %r15,%rax
+  80370e:	0f 83 85 00 00 00    	jae    803799 <munmap+0xd8>
+            m->mm_end = start;
+  803714:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  803719:	48 83 c3 18          	add    $0x18,%rbx
+  80371d:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  803724:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  80372b:	00 00 00 
+  80372e:	48 39 c3             	cmp    %rax,%rbx
+  803731:	0f 84 d0 00 00 00    	je     803807 <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  803737:	49 89 dc             	mov    %rbx,%r12
+  80373a:	48 8b 03             	mov    (%rbx),%rax
+  80373d:	4c 39 f0             	cmp    %r14,%rax
+  803740:	73 d7                	jae    803719 <munmap+0x58>
+  803742:	48 85 c0             	test   %rax,%rax
+  803745:	74 d2                	je     803719 <munmap+0x58>
+  803747:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  80374b:	49 39 d7             	cmp    %rdx,%r15
+  80374e:	73 c9                	jae    803719 <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  803750:	49 39 d6             	cmp    %rdx,%r14
+  803753:	73 b6                	jae    80370b <munmap+0x4a>
+  803755:	49 39 c7             	cmp    %rax,%r15
+  803758:	76 b1                	jbe    80370b <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  80375a:	4c 89 ef             	mov    %r13,%rdi
+  80375d:	48 b8 f8 27 80 00 00 	movabs $0x8027f8,%rax
+  803764:	00 00 00 
+  803767:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  803769:	48 85 c0             	test   %rax,%rax
+  80376c:	0f 84 c5 00 00 00    	je     803837 <munmap+0x176>
+            *tail = *m;
+  803772:	48 8b 13             	mov    (%rbx),%rdx
+  803775:	48 89 10             	mov    %rdx,(%rax)
+  803778:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  80377c:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  803780:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  803784:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  803788:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  80378b:	44 89 f2             	mov    %r14d,%edx
+  80378e:	2b 13                	sub    (%rbx),%edx
+  803790:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  803793:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  803797:	eb 80                	jmp    803719 <munmap+0x58>
+        } else if (m->mm_end > end) {
+  803799:	49 39 d6             	cmp    %rdx,%r14
+  80379c:	73 18                	jae    8037b6 <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  80379e:	44 89 f2             	mov    %r14d,%edx
+  8037a1:	41 03 54 24 10       	add    0x10(%r12),%edx
+  8037a6:	29 c2                	sub    %eax,%edx
+  8037a8:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  8037ad:	4d 89 34 24          	mov    %r14,(%r12)
+  8037b1:	e9 63 ff ff ff       	jmp    803719 <munmap+0x58>
+    m->mm_start = 0;
+  8037b6:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  8037bd:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  8037be:	4c 89 e6             	mov    %r12,%rsi
+  8037c1:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8037c8:	00 00 00 
+  8037cb:	48 29 c6             	sub    %rax,%rsi
+  8037ce:	48 c1 fe 03          	sar    $0x3,%rsi
+  8037d2:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8037d9:	aa aa aa 
+  8037dc:	48 0f af f0          	imul   %rax,%rsi
+  8037e0:	48 c1 e6 0c          	shl    $0xc,%rsi
+  8037e4:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  8037e9:	48 01 c6             	add    %rax,%rsi
+  8037ec:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8037f1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037f6:	48 b8 f8 15 80 00 00 	movabs $0x8015f8,%rax
+  8037fd:	00 00 00 
+  803800:	ff d0                	call   *%rax
+}
+  803802:	e9 12 ff ff ff       	jmp    803719 <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  803807:	4c 89 f2             	mov    %r14,%rdx
+  80380a:	4c 29 fa             	sub    %r15,%rdx
+  80380d:	4c 89 fe             	mov    %r15,%rsi
+  803810:	bf 00 00 00 00       	mov    $0x0,%edi
+  803815:	48 b8 f8 15 80 00 00 	movabs $0x8015f8,%rax
+  80381c:	00 00 00 
+  80381f:	ff d0                	call   *%rax
+}
+  803821:	48 83 c4 08          	add    $0x8,%rsp
+  803825:	5b                   	pop    %rbx
+  803826:	41 5c                	pop    %r12
+  803828:	41 5d                	pop    %r13
+  80382a:	41 5e                	pop    %r14
+  80382c:	41 5f                	pop    %r15
+  80382e:	5d                   	pop    %rbp
+  80382f:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  803830:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803835:	eb ea                	jmp    803821 <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  803837:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  80383c:	eb e3                	jmp    803821 <munmap+0x160>
+
+000000000080383e <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  80383e:	55                   	push   %rbp
+  80383f:	48 89 e5             	mov    %rsp,%rbp
+  803842:	41 57                	push   %r15
+  803844:	41 56                	push   %r14
+  803846:	41 55                	push   %r13
+  803848:	41 54                	push   %r12
+  80384a:	53                   	push   %rbx
+  80384b:	48 83 ec 28          	sub    $0x28,%rsp
+  80384f:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  803853:	49 89 f5             	mov    %rsi,%r13
+  803856:	41 89 d6             	mov    %edx,%r14d
+  803859:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  80385c:	41 89 cc             	mov    %ecx,%r12d
+  80385f:	44 89 c7             	mov    %r8d,%edi
+  803862:	44 89 cb             	mov    %r9d,%ebx
+  803865:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803869:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80386d:	48 b8 33 1b 80 00 00 	movabs $0x801b33,%rax
+  803874:	00 00 00 
+  803877:	ff d0                	call   *%rax
+  803879:	41 89 c7             	mov    %eax,%r15d
+  80387c:	85 c0                	test   %eax,%eax
+  80387e:	0f 88 ae 01 00 00    	js     803a32 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803884:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803888:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  80388f:	00 00 00 
+  803892:	8b 32                	mov    (%rdx),%esi
+  803894:	39 30                	cmp    %esi,(%rax)
+  803896:	0f 85 7a 02 00 00    	jne    803b16 <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  80389c:	8b 40 08             	mov    0x8(%rax),%eax
+  80389f:	83 e0 03             	and    $0x3,%eax
+  8038a2:	83 f8 01             	cmp    $0x1,%eax
+  8038a5:	0f 84 76 02 00 00    	je     803b21 <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  8038ab:	4d 85 ed             	test   %r13,%r13
+  8038ae:	0f 84 78 02 00 00    	je     803b2c <mmap+0x2ee>
+  8038b4:	85 db                	test   %ebx,%ebx
+  8038b6:	0f 88 70 02 00 00    	js     803b2c <mmap+0x2ee>
+  8038bc:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  8038c2:	41 89 df             	mov    %ebx,%r15d
+  8038c5:	0f 85 6c 02 00 00    	jne    803b37 <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  8038cb:	44 89 f0             	mov    %r14d,%eax
+  8038ce:	83 e0 fd             	and    $0xfffffffd,%eax
+  8038d1:	83 f8 04             	cmp    $0x4,%eax
+  8038d4:	0f 85 68 02 00 00    	jne    803b42 <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  8038da:	44 89 e1             	mov    %r12d,%ecx
+  8038dd:	83 e1 01             	and    $0x1,%ecx
+  8038e0:	0f 95 c2             	setne  %dl
+  8038e3:	44 89 e0             	mov    %r12d,%eax
+  8038e6:	d1 e8                	shr    %eax
+  8038e8:	83 f0 01             	xor    $0x1,%eax
+  8038eb:	83 e0 01             	and    $0x1,%eax
+  8038ee:	38 c2                	cmp    %al,%dl
+  8038f0:	0f 85 57 02 00 00    	jne    803b4d <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  8038f6:	85 c9                	test   %ecx,%ecx
+  8038f8:	74 0a                	je     803904 <mmap+0xc6>
+  8038fa:	41 f6 c6 02          	test   $0x2,%r14b
+  8038fe:	0f 85 54 02 00 00    	jne    803b58 <mmap+0x31a>
+    file_flush_buffers();
+  803904:	48 b8 b9 33 80 00 00 	movabs $0x8033b9,%rax
+  80390b:	00 00 00 
+  80390e:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  803910:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  803917:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  80391e:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803922:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  803925:	41 f6 c4 04          	test   $0x4,%r12b
+  803929:	0f 84 15 01 00 00    	je     803a44 <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  80392f:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  803932:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  803938:	0f 85 25 02 00 00    	jne    803b63 <mmap+0x325>
+  80393e:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  803942:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  803949:	00 00 00 
+  80394c:	48 39 c2             	cmp    %rax,%rdx
+  80394f:	0f 82 19 02 00 00    	jb     803b6e <mmap+0x330>
+  803955:	48 39 c7             	cmp    %rax,%rdi
+  803958:	0f 87 10 02 00 00    	ja     803b6e <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  80395e:	4c 89 ee             	mov    %r13,%rsi
+  803961:	48 b8 c1 36 80 00 00 	movabs $0x8036c1,%rax
+  803968:	00 00 00 
+  80396b:	ff d0                	call   *%rax
+  80396d:	85 c0                	test   %eax,%eax
+  80396f:	0f 88 04 02 00 00    	js     803b79 <mmap+0x33b>
+    if (!handler) {
+  803975:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  80397c:	00 00 00 
+  80397f:	80 38 00             	cmpb   $0x0,(%rax)
+  803982:	75 2b                	jne    8039af <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  803984:	48 bf 59 27 80 00 00 	movabs $0x802759,%rdi
+  80398b:	00 00 00 
+  80398e:	48 b8 19 49 80 00 00 	movabs $0x804919,%rax
+  803995:	00 00 00 
+  803998:	ff d0                	call   *%rax
+  80399a:	85 c0                	test   %eax,%eax
+  80399c:	0f 88 ea 01 00 00    	js     803b8c <mmap+0x34e>
+        handler = 1;
+  8039a2:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  8039a9:	00 00 00 
+  8039ac:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  8039af:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8039b3:	48 b8 f8 27 80 00 00 	movabs $0x8027f8,%rax
+  8039ba:	00 00 00 
+  8039bd:	ff d0                	call   *%rax
+  8039bf:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  8039c2:	48 85 c0             	test   %rax,%rax
+  8039c5:	0f 84 c9 01 00 00    	je     803b94 <mmap+0x356>
+    m->mm_start = va;
+  8039cb:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  8039ce:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  8039d2:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  8039d6:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  8039d9:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  8039dd:	44 89 e0             	mov    %r12d,%eax
+  8039e0:	c1 e0 06             	shl    $0x6,%eax
+  8039e3:	25 80 00 00 00       	and    $0x80,%eax
+  8039e8:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  8039eb:	09 f0                	or     %esi,%eax
+  8039ed:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  8039f1:	41 f6 c4 08          	test   $0x8,%r12b
+  8039f5:	74 31                	je     803a28 <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  8039f7:	48 39 d3             	cmp    %rdx,%rbx
+  8039fa:	73 2c                	jae    803a28 <mmap+0x1ea>
+  8039fc:	ba 00 00 04 00       	mov    $0x40000,%edx
+  803a01:	48 89 de             	mov    %rbx,%rsi
+  803a04:	4c 89 f7             	mov    %r14,%rdi
+  803a07:	48 b8 48 26 80 00 00 	movabs $0x802648,%rax
+  803a0e:	00 00 00 
+  803a11:	ff d0                	call   *%rax
+  803a13:	49 89 c4             	mov    %rax,%r12
+  803a16:	48 85 c0             	test   %rax,%rax
+  803a19:	0f 8e d7 00 00 00    	jle    803af6 <mmap+0x2b8>
+            va += n;
+  803a1f:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  803a22:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  803a26:	72 d4                	jb     8039fc <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  803a28:	49 8b 06             	mov    (%r14),%rax
+  803a2b:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  803a2f:	48 89 06             	mov    %rax,(%rsi)
+}
+  803a32:	44 89 f8             	mov    %r15d,%eax
+  803a35:	48 83 c4 28          	add    $0x28,%rsp
+  803a39:	5b                   	pop    %rbx
+  803a3a:	41 5c                	pop    %r12
+  803a3c:	41 5d                	pop    %r13
+  803a3e:	41 5e                	pop    %r14
+  803a40:	41 5f                	pop    %r15
+  803a42:	5d                   	pop    %rbp
+  803a43:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803a44:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  803a4b:	00 00 00 
+  803a4e:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  803a51:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  803a58:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803a5b:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  803a60:	48 be 00 20 82 00 00 	movabs $0x822000,%rsi
+  803a67:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803a6a:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  803a71:	00 00 00 
+  803a74:	48 39 d7             	cmp    %rdx,%rdi
+  803a77:	73 1c                	jae    803a95 <mmap+0x257>
+        return -E_NO_MEM;
+  803a79:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803a7f:	eb b1                	jmp    803a32 <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803a81:	48 83 c0 01          	add    $0x1,%rax
+  803a85:	48 83 f8 1f          	cmp    $0x1f,%rax
+  803a89:	77 3f                	ja     803aca <mmap+0x28c>
+  803a8b:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  803a90:	48 39 d7             	cmp    %rdx,%rdi
+  803a93:	72 2a                	jb     803abf <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  803a95:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  803a99:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  803a9d:	48 39 d1             	cmp    %rdx,%rcx
+  803aa0:	73 df                	jae    803a81 <mmap+0x243>
+  803aa2:	48 85 c9             	test   %rcx,%rcx
+  803aa5:	74 da                	je     803a81 <mmap+0x243>
+  803aa7:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  803aab:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  803ab0:	48 39 d3             	cmp    %rdx,%rbx
+  803ab3:	73 cc                	jae    803a81 <mmap+0x243>
+            va = mmaps[i].mm_end;
+  803ab5:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803ab8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803abd:	eb cc                	jmp    803a8b <mmap+0x24d>
+        return -E_NO_MEM;
+  803abf:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803ac5:	e9 68 ff ff ff       	jmp    803a32 <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  803aca:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  803acf:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  803ad6:	00 00 00 
+  803ad9:	48 39 c2             	cmp    %rax,%rdx
+  803adc:	0f 82 9f 00 00 00    	jb     803b81 <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  803ae2:	48 85 db             	test   %rbx,%rbx
+  803ae5:	0f 85 8a fe ff ff    	jne    803975 <mmap+0x137>
+        return -E_NO_MEM;
+  803aeb:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803af1:	e9 3c ff ff ff       	jmp    803a32 <mmap+0x1f4>
+        if (n < 0) {
+  803af6:	0f 89 2c ff ff ff    	jns    803a28 <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  803afc:	49 8b 3e             	mov    (%r14),%rdi
+  803aff:	4c 89 ee             	mov    %r13,%rsi
+  803b02:	48 b8 c1 36 80 00 00 	movabs $0x8036c1,%rax
+  803b09:	00 00 00 
+  803b0c:	ff d0                	call   *%rax
+            return n;
+  803b0e:	45 89 e7             	mov    %r12d,%r15d
+  803b11:	e9 1c ff ff ff       	jmp    803a32 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803b16:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803b1c:	e9 11 ff ff ff       	jmp    803a32 <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  803b21:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803b27:	e9 06 ff ff ff       	jmp    803a32 <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  803b2c:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803b32:	e9 fb fe ff ff       	jmp    803a32 <mmap+0x1f4>
+  803b37:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803b3d:	e9 f0 fe ff ff       	jmp    803a32 <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  803b42:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803b48:	e9 e5 fe ff ff       	jmp    803a32 <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  803b4d:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803b53:	e9 da fe ff ff       	jmp    803a32 <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  803b58:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  803b5e:	e9 cf fe ff ff       	jmp    803a32 <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  803b63:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803b69:	e9 c4 fe ff ff       	jmp    803a32 <mmap+0x1f4>
+  803b6e:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803b74:	e9 b9 fe ff ff       	jmp    803a32 <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  803b79:	41 89 c7             	mov    %eax,%r15d
+  803b7c:	e9 b1 fe ff ff       	jmp    803a32 <mmap+0x1f4>
+        return -E_NO_MEM;
+  803b81:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803b87:	e9 a6 fe ff ff       	jmp    803a32 <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  803b8c:	41 89 c7             	mov    %eax,%r15d
+  803b8f:	e9 9e fe ff ff       	jmp    803a32 <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  803b94:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803b9a:	e9 93 fe ff ff       	jmp    803a32 <mmap+0x1f4>
+
+0000000000803b9f <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803b9f:	55                   	push   %rbp
+  803ba0:	48 89 e5             	mov    %rsp,%rbp
+  803ba3:	41 54                	push   %r12
+  803ba5:	53                   	push   %rbx
+  803ba6:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803ba9:	48 b8 b7 1a 80 00 00 	movabs $0x801ab7,%rax
+  803bb0:	00 00 00 
+  803bb3:	ff d0                	call   *%rax
+  803bb5:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803bb8:	48 be 00 55 80 00 00 	movabs $0x805500,%rsi
+  803bbf:	00 00 00 
+  803bc2:	48 89 df             	mov    %rbx,%rdi
+  803bc5:	48 b8 f3 0f 80 00 00 	movabs $0x800ff3,%rax
+  803bcc:	00 00 00 
+  803bcf:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803bd1:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803bd6:	41 2b 04 24          	sub    (%r12),%eax
+  803bda:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803be0:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803be7:	00 00 00 
+    stat->st_dev = &devpipe;
+  803bea:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803bf1:	00 00 00 
+  803bf4:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803bfb:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c00:	5b                   	pop    %rbx
+  803c01:	41 5c                	pop    %r12
+  803c03:	5d                   	pop    %rbp
+  803c04:	c3                   	ret
+
+0000000000803c05 <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  803c05:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803c08:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  803c0e:	8b 17                	mov    (%rdi),%edx
+  803c10:	85 d2                	test   %edx,%edx
+  803c12:	75 01                	jne    803c15 <pipe_wakeup+0x10>
+  803c14:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  803c15:	55                   	push   %rbp
+  803c16:	48 89 e5             	mov    %rsp,%rbp
+  803c19:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  803c1c:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  803c22:	be 00 04 00 00       	mov    $0x400,%esi
+  803c27:	48 b8 de 18 80 00 00 	movabs $0x8018de,%rax
+  803c2e:	00 00 00 
+  803c31:	ff d0                	call   *%rax
+}
+  803c33:	5d                   	pop    %rbp
+  803c34:	c3                   	ret
+
+0000000000803c35 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803c35:	55                   	push   %rbp
+  803c36:	48 89 e5             	mov    %rsp,%rbp
+  803c39:	41 55                	push   %r13
+  803c3b:	41 54                	push   %r12
+  803c3d:	53                   	push   %rbx
+  803c3e:	48 83 ec 08          	sub    $0x8,%rsp
+  803c42:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803c45:	48 b8 b7 1a 80 00 00 	movabs $0x801ab7,%rax
+  803c4c:	00 00 00 
+  803c4f:	ff d0                	call   *%rax
+  803c51:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803c54:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c59:	4c 89 e6             	mov    %r12,%rsi
+  803c5c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c61:	49 bc f8 15 80 00 00 	movabs $0x8015f8,%r12
+  803c68:	00 00 00 
+  803c6b:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803c6e:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803c72:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803c76:	49 bd 05 3c 80 00 00 	movabs $0x803c05,%r13
+  803c7d:	00 00 00 
+  803c80:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803c83:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803c87:	48 89 de             	mov    %rbx,%rsi
+  803c8a:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  803c8d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c92:	48 89 de             	mov    %rbx,%rsi
+  803c95:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c9a:	41 ff d4             	call   *%r12
+  803c9d:	48 83 c4 08          	add    $0x8,%rsp
+  803ca1:	5b                   	pop    %rbx
+  803ca2:	41 5c                	pop    %r12
+  803ca4:	41 5d                	pop    %r13
+  803ca6:	5d                   	pop    %rbp
+  803ca7:	c3                   	ret
+
+0000000000803ca8 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  803ca8:	55                   	push   %rbp
+  803ca9:	48 89 e5             	mov    %rsp,%rbp
+  803cac:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803caf:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803cb4:	be 00 10 00 00       	mov    $0x1000,%esi
+  803cb9:	48 b8 3b 15 80 00 00 	movabs $0x80153b,%rax
+  803cc0:	00 00 00 
+  803cc3:	ff d0                	call   *%rax
+  803cc5:	85 c0                	test   %eax,%eax
+  803cc7:	0f 94 c0             	sete   %al
+  803cca:	0f b6 c0             	movzbl %al,%eax
+}
+  803ccd:	5d                   	pop    %rbp
+  803cce:	c3                   	ret
+
+0000000000803ccf <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803ccf:	55                   	push   %rbp
+  803cd0:	48 89 e5             	mov    %rsp,%rbp
+  803cd3:	41 57                	push   %r15
+  803cd5:	41 56                	push   %r14
+  803cd7:	41 55                	push   %r13
+  803cd9:	41 54                	push   %r12
+  803cdb:	53                   	push   %rbx
+  803cdc:	48 83 ec 38          	sub    $0x38,%rsp
+  803ce0:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803ce4:	49 89 f4             	mov    %rsi,%r12
+  803ce7:	49 89 d7             	mov    %rdx,%r15
+  803cea:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803cee:	48 b8 b7 1a 80 00 00 	movabs $0x801ab7,%rax
+  803cf5:	00 00 00 
+  803cf8:	ff d0                	call   *%rax
+  803cfa:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803cfd:	4d 85 ff             	test   %r15,%r15
+  803d00:	0f 84 f1 00 00 00    	je     803df7 <devpipe_write+0x128>
+  803d06:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  803d0a:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  803d0e:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  803d12:	49 bd a8 3c 80 00 00 	movabs $0x803ca8,%r13
+  803d19:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803d1c:	49 bf 05 3c 80 00 00 	movabs $0x803c05,%r15
+  803d23:	00 00 00 
+  803d26:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803d2a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803d2e:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803d32:	8b 73 04             	mov    0x4(%rbx),%esi
+  803d35:	48 63 ce             	movslq %esi,%rcx
+  803d38:	48 63 03             	movslq (%rbx),%rax
+  803d3b:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  803d41:	48 39 c1             	cmp    %rax,%rcx
+  803d44:	72 64                	jb     803daa <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  803d46:	48 89 de             	mov    %rbx,%rsi
+  803d49:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803d4d:	41 ff d5             	call   *%r13
+  803d50:	85 c0                	test   %eax,%eax
+  803d52:	0f 85 b9 00 00 00    	jne    803e11 <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803d58:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803d5c:	4c 89 f7             	mov    %r14,%rdi
+  803d5f:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  803d62:	8b 43 04             	mov    0x4(%rbx),%eax
+  803d65:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  803d6c:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803d73:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803d79:	8b 03                	mov    (%rbx),%eax
+  803d7b:	41 39 c4             	cmp    %eax,%r12d
+  803d7e:	75 b2                	jne    803d32 <devpipe_write+0x63>
+  803d80:	48 89 de             	mov    %rbx,%rsi
+  803d83:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803d87:	41 ff d5             	call   *%r13
+  803d8a:	85 c0                	test   %eax,%eax
+  803d8c:	75 a0                	jne    803d2e <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803d8e:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803d93:	44 89 e6             	mov    %r12d,%esi
+  803d96:	48 89 df             	mov    %rbx,%rdi
+  803d99:	48 b8 c0 18 80 00 00 	movabs $0x8018c0,%rax
+  803da0:	00 00 00 
+  803da3:	ff d0                	call   *%rax
+  803da5:	e9 7c ff ff ff       	jmp    803d26 <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803daa:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  803dae:	41 0f b6 38          	movzbl (%r8),%edi
+  803db2:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803db9:	80 80 80 
+  803dbc:	48 89 c8             	mov    %rcx,%rax
+  803dbf:	48 f7 e2             	mul    %rdx
+  803dc2:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803dc6:	48 89 d0             	mov    %rdx,%rax
+  803dc9:	48 c1 e0 08          	shl    $0x8,%rax
+  803dcd:	48 29 d0             	sub    %rdx,%rax
+  803dd0:	48 c1 e0 04          	shl    $0x4,%rax
+  803dd4:	48 29 c1             	sub    %rax,%rcx
+  803dd7:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  803ddc:	83 c6 01             	add    $0x1,%esi
+  803ddf:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803de2:	49 83 c0 01          	add    $0x1,%r8
+  803de6:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  803dea:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803dee:	49 39 c0             	cmp    %rax,%r8
+  803df1:	0f 85 2f ff ff ff    	jne    803d26 <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803df7:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803dfb:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803dff:	48 b8 05 3c 80 00 00 	movabs $0x803c05,%rax
+  803e06:	00 00 00 
+  803e09:	ff d0                	call   *%rax
+    return n;
+  803e0b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803e0f:	eb 05                	jmp    803e16 <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  803e11:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e16:	48 83 c4 38          	add    $0x38,%rsp
+  803e1a:	5b                   	pop    %rbx
+  803e1b:	41 5c                	pop    %r12
+  803e1d:	41 5d                	pop    %r13
+  803e1f:	41 5e                	pop    %r14
+  803e21:	41 5f                	pop    %r15
+  803e23:	5d                   	pop    %rbp
+  803e24:	c3                   	ret
+
+0000000000803e25 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803e25:	55                   	push   %rbp
+  803e26:	48 89 e5             	mov    %rsp,%rbp
+  803e29:	41 57                	push   %r15
+  803e2b:	41 56                	push   %r14
+  803e2d:	41 55                	push   %r13
+  803e2f:	41 54                	push   %r12
+  803e31:	53                   	push   %rbx
+  803e32:	48 83 ec 28          	sub    $0x28,%rsp
+  803e36:	49 89 fd             	mov    %rdi,%r13
+  803e39:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  803e3d:	49 89 d4             	mov    %rdx,%r12
+  803e40:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803e44:	48 b8 b7 1a 80 00 00 	movabs $0x801ab7,%rax
+  803e4b:	00 00 00 
+  803e4e:	ff d0                	call   *%rax
+  803e50:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803e53:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  803e59:	49 bf a8 3c 80 00 00 	movabs $0x803ca8,%r15
+  803e60:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803e63:	4d 85 e4             	test   %r12,%r12
+  803e66:	0f 84 d5 00 00 00    	je     803f41 <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803e6c:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803e70:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803e74:	8b 03                	mov    (%rbx),%eax
+  803e76:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803e79:	75 7a                	jne    803ef5 <devpipe_read+0xd0>
+            if (i > 0) {
+  803e7b:	4d 85 f6             	test   %r14,%r14
+  803e7e:	75 50                	jne    803ed0 <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  803e80:	48 89 de             	mov    %rbx,%rsi
+  803e83:	4c 89 ef             	mov    %r13,%rdi
+  803e86:	41 ff d7             	call   *%r15
+  803e89:	85 c0                	test   %eax,%eax
+  803e8b:	0f 85 c9 00 00 00    	jne    803f5a <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803e91:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  803e94:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803e9b:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803ea1:	8b 43 04             	mov    0x4(%rbx),%eax
+  803ea4:	41 39 c4             	cmp    %eax,%r12d
+  803ea7:	75 cb                	jne    803e74 <devpipe_read+0x4f>
+  803ea9:	48 89 de             	mov    %rbx,%rsi
+  803eac:	4c 89 ef             	mov    %r13,%rdi
+  803eaf:	41 ff d7             	call   *%r15
+  803eb2:	85 c0                	test   %eax,%eax
+  803eb4:	75 be                	jne    803e74 <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803eb6:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803ebb:	44 89 e6             	mov    %r12d,%esi
+  803ebe:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803ec2:	48 b8 c0 18 80 00 00 	movabs $0x8018c0,%rax
+  803ec9:	00 00 00 
+  803ecc:	ff d0                	call   *%rax
+  803ece:	eb a4                	jmp    803e74 <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803ed0:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803ed4:	48 89 de             	mov    %rbx,%rsi
+  803ed7:	48 b8 05 3c 80 00 00 	movabs $0x803c05,%rax
+  803ede:	00 00 00 
+  803ee1:	ff d0                	call   *%rax
+                return i;
+  803ee3:	4c 89 f0             	mov    %r14,%rax
+}
+  803ee6:	48 83 c4 28          	add    $0x28,%rsp
+  803eea:	5b                   	pop    %rbx
+  803eeb:	41 5c                	pop    %r12
+  803eed:	41 5d                	pop    %r13
+  803eef:	41 5e                	pop    %r14
+  803ef1:	41 5f                	pop    %r15
+  803ef3:	5d                   	pop    %rbp
+  803ef4:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803ef5:	48 63 c8             	movslq %eax,%rcx
+  803ef8:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803eff:	80 80 80 
+  803f02:	48 89 c8             	mov    %rcx,%rax
+  803f05:	48 f7 e2             	mul    %rdx
+  803f08:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803f0c:	48 89 d0             	mov    %rdx,%rax
+  803f0f:	48 c1 e0 08          	shl    $0x8,%rax
+  803f13:	48 29 d0             	sub    %rdx,%rax
+  803f16:	48 c1 e0 04          	shl    $0x4,%rax
+  803f1a:	48 89 c2             	mov    %rax,%rdx
+  803f1d:	48 89 c8             	mov    %rcx,%rax
+  803f20:	48 29 d0             	sub    %rdx,%rax
+  803f23:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  803f28:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803f2c:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  803f30:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803f33:	49 83 c6 01          	add    $0x1,%r14
+  803f37:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  803f3b:	0f 85 2b ff ff ff    	jne    803e6c <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803f41:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803f45:	48 89 de             	mov    %rbx,%rsi
+  803f48:	48 b8 05 3c 80 00 00 	movabs $0x803c05,%rax
+  803f4f:	00 00 00 
+  803f52:	ff d0                	call   *%rax
+    return n;
+  803f54:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803f58:	eb 8c                	jmp    803ee6 <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  803f5a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f5f:	eb 85                	jmp    803ee6 <devpipe_read+0xc1>
+
+0000000000803f61 <pipe>:
+pipe(int pfd[2]) {
+  803f61:	55                   	push   %rbp
+  803f62:	48 89 e5             	mov    %rsp,%rbp
+  803f65:	41 55                	push   %r13
+  803f67:	41 54                	push   %r12
+  803f69:	53                   	push   %rbx
+  803f6a:	48 83 ec 18          	sub    $0x18,%rsp
+  803f6e:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803f71:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803f75:	48 b8 d3 1a 80 00 00 	movabs $0x801ad3,%rax
+  803f7c:	00 00 00 
+  803f7f:	ff d0                	call   *%rax
+  803f81:	89 c3                	mov    %eax,%ebx
+  803f83:	85 c0                	test   %eax,%eax
+  803f85:	0f 88 a0 01 00 00    	js     80412b <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803f8b:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803f90:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f95:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803f99:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f9e:	48 b8 52 15 80 00 00 	movabs $0x801552,%rax
+  803fa5:	00 00 00 
+  803fa8:	ff d0                	call   *%rax
+  803faa:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803fac:	85 c0                	test   %eax,%eax
+  803fae:	0f 88 77 01 00 00    	js     80412b <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803fb4:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803fb8:	48 b8 d3 1a 80 00 00 	movabs $0x801ad3,%rax
+  803fbf:	00 00 00 
+  803fc2:	ff d0                	call   *%rax
+  803fc4:	89 c3                	mov    %eax,%ebx
+  803fc6:	85 c0                	test   %eax,%eax
+  803fc8:	0f 88 43 01 00 00    	js     804111 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803fce:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803fd3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803fd8:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803fdc:	bf 00 00 00 00       	mov    $0x0,%edi
+  803fe1:	48 b8 52 15 80 00 00 	movabs $0x801552,%rax
+  803fe8:	00 00 00 
+  803feb:	ff d0                	call   *%rax
+  803fed:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803fef:	85 c0                	test   %eax,%eax
+  803ff1:	0f 88 1a 01 00 00    	js     804111 <pipe+0x1b0>
+    va = fd2data(fd0);
+  803ff7:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803ffb:	48 b8 b7 1a 80 00 00 	movabs $0x801ab7,%rax
+  804002:	00 00 00 
+  804005:	ff d0                	call   *%rax
+  804007:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80400a:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80400f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804014:	48 89 c6             	mov    %rax,%rsi
+  804017:	bf 00 00 00 00       	mov    $0x0,%edi
+  80401c:	48 b8 52 15 80 00 00 	movabs $0x801552,%rax
+  804023:	00 00 00 
+  804026:	ff d0                	call   *%rax
+  804028:	89 c3                	mov    %eax,%ebx
+  80402a:	85 c0                	test   %eax,%eax
+  80402c:	0f 88 c5 00 00 00    	js     8040f7 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  804032:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804036:	48 b8 b7 1a 80 00 00 	movabs $0x801ab7,%rax
+  80403d:	00 00 00 
+  804040:	ff d0                	call   *%rax
+  804042:	48 89 c1             	mov    %rax,%rcx
+  804045:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  80404b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804051:	ba 00 00 00 00       	mov    $0x0,%edx
+  804056:	4c 89 ee             	mov    %r13,%rsi
+  804059:	bf 00 00 00 00       	mov    $0x0,%edi
+  80405e:	48 b8 a8 15 80 00 00 	movabs $0x8015a8,%rax
+  804065:	00 00 00 
+  804068:	ff d0                	call   *%rax
+  80406a:	89 c3                	mov    %eax,%ebx
+  80406c:	85 c0                	test   %eax,%eax
+  80406e:	78 6e                	js     8040de <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804070:	be 00 10 00 00       	mov    $0x1000,%esi
+  804075:	4c 89 ef             	mov    %r13,%rdi
+  804078:	48 b8 17 15 80 00 00 	movabs $0x801517,%rax
+  80407f:	00 00 00 
+  804082:	ff d0                	call   *%rax
+  804084:	83 f8 02             	cmp    $0x2,%eax
+  804087:	0f 85 ab 00 00 00    	jne    804138 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80408d:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  804094:	00 00 
+  804096:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80409a:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  80409c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8040a0:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8040a7:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8040ab:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8040ad:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8040b1:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8040b8:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8040bc:	48 bb a5 1a 80 00 00 	movabs $0x801aa5,%rbx
+  8040c3:	00 00 00 
+  8040c6:	ff d3                	call   *%rbx
+  8040c8:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8040cc:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8040d0:	ff d3                	call   *%rbx
+  8040d2:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8040d7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8040dc:	eb 4d                	jmp    80412b <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8040de:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8040e3:	4c 89 ee             	mov    %r13,%rsi
+  8040e6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040eb:	48 b8 f8 15 80 00 00 	movabs $0x8015f8,%rax
+  8040f2:	00 00 00 
+  8040f5:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8040f7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8040fc:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804100:	bf 00 00 00 00       	mov    $0x0,%edi
+  804105:	48 b8 f8 15 80 00 00 	movabs $0x8015f8,%rax
+  80410c:	00 00 00 
+  80410f:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  804111:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804116:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80411a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80411f:	48 b8 f8 15 80 00 00 	movabs $0x8015f8,%rax
+  804126:	00 00 00 
+  804129:	ff d0                	call   *%rax
+}
+  80412b:	89 d8                	mov    %ebx,%eax
+  80412d:	48 83 c4 18          	add    $0x18,%rsp
+  804131:	5b                   	pop    %rbx
+  804132:	41 5c                	pop    %r12
+  804134:	41 5d                	pop    %r13
+  804136:	5d                   	pop    %rbp
+  804137:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804138:	48 b9 30 55 80 00 00 	movabs $0x805530,%rcx
+  80413f:	00 00 00 
+  804142:	48 ba 07 55 80 00 00 	movabs $0x805507,%rdx
+  804149:	00 00 00 
+  80414c:	be 50 00 00 00       	mov    $0x50,%esi
+  804151:	48 bf 1c 55 80 00 00 	movabs $0x80551c,%rdi
+  804158:	00 00 00 
+  80415b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804160:	49 b8 7e 05 80 00 00 	movabs $0x80057e,%r8
+  804167:	00 00 00 
+  80416a:	41 ff d0             	call   *%r8
+
+000000000080416d <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80416d:	55                   	push   %rbp
+  80416e:	48 89 e5             	mov    %rsp,%rbp
+  804171:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804175:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804179:	48 b8 33 1b 80 00 00 	movabs $0x801b33,%rax
+  804180:	00 00 00 
+  804183:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804185:	85 c0                	test   %eax,%eax
+  804187:	78 23                	js     8041ac <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  804189:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80418d:	48 b8 b7 1a 80 00 00 	movabs $0x801ab7,%rax
+  804194:	00 00 00 
+  804197:	ff d0                	call   *%rax
+  804199:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  80419c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8041a0:	48 b8 a8 3c 80 00 00 	movabs $0x803ca8,%rax
+  8041a7:	00 00 00 
+  8041aa:	ff d0                	call   *%rax
+}
+  8041ac:	c9                   	leave
+  8041ad:	c3                   	ret
+
+00000000008041ae <wait>:
+#include <inc/lib.h>
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  8041ae:	55                   	push   %rbp
+  8041af:	48 89 e5             	mov    %rsp,%rbp
+  8041b2:	41 56                	push   %r14
+  8041b4:	41 55                	push   %r13
+  8041b6:	41 54                	push   %r12
+  8041b8:	53                   	push   %rbx
+    assert(envid != 0);
+  8041b9:	85 ff                	test   %edi,%edi
+  8041bb:	0f 84 b7 00 00 00    	je     804278 <wait+0xca>
+  8041c1:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  8041c4:	89 f9                	mov    %edi,%ecx
+  8041c6:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+
+    for (;;) {
+        uint32_t seq = env->env_wait_seq;
+  8041cc:	48 bf 00 00 c0 1f 80 	movabs $0x801fc00000,%rdi
+  8041d3:	00 00 00 
+  8041d6:	45 89 e0             	mov    %r12d,%r8d
+  8041d9:	41 81 e0 ff 03 00 00 	and    $0x3ff,%r8d
+  8041e0:	4c 89 c0             	mov    %r8,%rax
+  8041e3:	48 c1 e0 04          	shl    $0x4,%rax
+  8041e7:	48 89 c2             	mov    %rax,%rdx
+  8041ea:	4c 29 c2             	sub    %r8,%rdx
+  8041ed:	48 c1 e2 05          	shl    $0x5,%rdx
+  8041f1:	48 01 fa             	add    %rdi,%rdx
+  8041f4:	8b b2 b8 01 00 00    	mov    0x1b8(%rdx),%esi
+        if (env->env_id != envid || env->env_status == ENV_FREE) break;
+  8041fa:	8b 82 c8 00 00 00    	mov    0xc8(%rdx),%eax
+  804200:	41 39 c4             	cmp    %eax,%r12d
+  804203:	75 6a                	jne    80426f <wait+0xc1>
+
+        /* The kernel wakes us up when the environment is freed */
+        sys_futex_wait(&env->env_wait_seq, seq, 0);
+  804205:	48 63 d1             	movslq %ecx,%rdx
+  804208:	48 89 d0             	mov    %rdx,%rax
+  80420b:	48 c1 e0 04          	shl    $0x4,%rax
+  80420f:	48 29 d0             	sub    %rdx,%rax
+  804212:	48 c1 e0 05          	shl    $0x5,%rax
+  804216:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80421d:	00 00 00 
+  804220:	4c 8d b4 02 b8 01 00 	lea    0x1b8(%rdx,%rax,1),%r14
+  804227:	00 
+        if (env->env_id != envid || env->env_status == ENV_FREE) break;
+  804228:	48 63 c9             	movslq %ecx,%rcx
+  80422b:	48 89 c8             	mov    %rcx,%rax
+  80422e:	48 c1 e0 04          	shl    $0x4,%rax
+  804232:	48 29 c8             	sub    %rcx,%rax
+  804235:	48 c1 e0 05          	shl    $0x5,%rax
+  804239:	48 89 d3             	mov    %rdx,%rbx
+  80423c:	48 01 c3             	add    %rax,%rbx
+        sys_futex_wait(&env->env_wait_seq, seq, 0);
+  80423f:	49 bd c0 18 80 00 00 	movabs $0x8018c0,%r13
+  804246:	00 00 00 
+        if (env->env_id != envid || env->env_status == ENV_FREE) break;
+  804249:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+  80424f:	85 c0                	test   %eax,%eax
+  804251:	74 1c                	je     80426f <wait+0xc1>
+        sys_futex_wait(&env->env_wait_seq, seq, 0);
+  804253:	ba 00 00 00 00       	mov    $0x0,%edx
+  804258:	4c 89 f7             	mov    %r14,%rdi
+  80425b:	41 ff d5             	call   *%r13
+        uint32_t seq = env->env_wait_seq;
+  80425e:	8b b3 b8 01 00 00    	mov    0x1b8(%rbx),%esi
+        if (env->env_id != envid || env->env_status == ENV_FREE) break;
+  804264:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  80426a:	44 39 e0             	cmp    %r12d,%eax
+  80426d:	74 da                	je     804249 <wait+0x9b>
+    }
+}
+  80426f:	5b                   	pop    %rbx
+  804270:	41 5c                	pop    %r12
+  804272:	41 5d                	pop    %r13
+  804274:	41 5e                	pop    %r14
+  804276:	5d                   	pop    %rbp
+  804277:	c3                   	ret
+    assert(envid != 0);
+  804278:	48 b9 54 55 80 00 00 	movabs $0x805554,%rcx
+  80427f:	00 00 00 
+  804282:	48 ba 07 55 80 00 00 	movabs $0x805507,%rdx
+  804289:	00 00 00 
+  80428c:	be 06 00 00 00       	mov    $0x6,%esi
+  804291:	48 bf 5f 55 80 00 00 	movabs $0x80555f,%rdi
+  804298:	00 00 00 
+  80429b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042a0:	49 b8 7e 05 80 00 00 	movabs $0x80057e,%r8
+  8042a7:	00 00 00 
+  8042aa:	41 ff d0             	call   *%r8
+
+00000000008042ad <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8042ad:	48 89 f8             	mov    %rdi,%rax
+  8042b0:	48 c1 e8 27          	shr    $0x27,%rax
+  8042b4:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8042bb:	01 00 00 
+  8042be:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8042c2:	f6 c2 01             	test   $0x1,%dl
+  8042c5:	74 6d                	je     804334 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8042c7:	48 89 f8             	mov    %rdi,%rax
+  8042ca:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8042ce:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8042d5:	01 00 00 
+  8042d8:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8042dc:	f6 c2 01             	test   $0x1,%dl
+  8042df:	74 62                	je     804343 <get_uvpt_entry+0x96>
+  8042e1:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8042e8:	01 00 00 
+  8042eb:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8042ef:	f6 c2 80             	test   $0x80,%dl
+  8042f2:	75 4f                	jne    804343 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8042f4:	48 89 f8             	mov    %rdi,%rax
+  8042f7:	48 c1 e8 15          	shr    $0x15,%rax
+  8042fb:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804302:	01 00 00 
+  804305:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804309:	f6 c2 01             	test   $0x1,%dl
+  80430c:	74 44                	je     804352 <get_uvpt_entry+0xa5>
+  80430e:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804315:	01 00 00 
+  804318:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80431c:	f6 c2 80             	test   $0x80,%dl
+  80431f:	75 31                	jne    804352 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  804321:	48 c1 ef 0c          	shr    $0xc,%rdi
+  804325:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80432c:	01 00 00 
+  80432f:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  804333:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804334:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80433b:	01 00 00 
+  80433e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804342:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804343:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80434a:	01 00 00 
+  80434d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804351:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804352:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804359:	01 00 00 
+  80435c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804360:	c3                   	ret
+
+0000000000804361 <get_prot>:
+
+int
+get_prot(void *va) {
+  804361:	55                   	push   %rbp
+  804362:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804365:	48 b8 ad 42 80 00 00 	movabs $0x8042ad,%rax
+  80436c:	00 00 00 
+  80436f:	ff d0                	call   *%rax
+  804371:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  804374:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  804379:	89 c1                	mov    %eax,%ecx
+  80437b:	83 c9 04             	or     $0x4,%ecx
+  80437e:	f6 c2 01             	test   $0x1,%dl
+  804381:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  804384:	89 c1                	mov    %eax,%ecx
+  804386:	83 c9 02             	or     $0x2,%ecx
+  804389:	f6 c2 02             	test   $0x2,%dl
+  80438c:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80438f:	89 c1                	mov    %eax,%ecx
+  804391:	83 c9 01             	or     $0x1,%ecx
+  804394:	48 85 d2             	test   %rdx,%rdx
+  804397:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  80439a:	89 c1                	mov    %eax,%ecx
+  80439c:	83 c9 40             	or     $0x40,%ecx
+  80439f:	f6 c6 04             	test   $0x4,%dh
+  8043a2:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8043a5:	5d                   	pop    %rbp
+  8043a6:	c3                   	ret
+
+00000000008043a7 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8043a7:	55                   	push   %rbp
+  8043a8:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8043ab:	48 b8 ad 42 80 00 00 	movabs $0x8042ad,%rax
+  8043b2:	00 00 00 
+  8043b5:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8043b7:	48 c1 e8 06          	shr    $0x6,%rax
+  8043bb:	83 e0 01             	and    $0x1,%eax
+}
+  8043be:	5d                   	pop    %rbp
+  8043bf:	c3                   	ret
+
+00000000008043c0 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8043c0:	55                   	push   %rbp
+  8043c1:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8043c4:	48 b8 ad 42 80 00 00 	movabs $0x8042ad,%rax
+  8043cb:	00 00 00 
+  8043ce:	ff d0                	call   *%rax
+  8043d0:	83 e0 01             	and    $0x1,%eax
+}
+  8043d3:	5d                   	pop    %rbp
+  8043d4:	c3                   	ret
+
+00000000008043d5 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  8043d5:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  8043dc:	01 00 00 
+  8043df:	a8 01                	test   $0x1,%al
+  8043e1:	75 06                	jne    8043e9 <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  8043e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043e8:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8043e9:	55                   	push   %rbp
+  8043ea:	48 89 e5             	mov    %rsp,%rbp
+  8043ed:	41 57                	push   %r15
+  8043ef:	41 56                	push   %r14
+  8043f1:	41 55                	push   %r13
+  8043f3:	41 54                	push   %r12
+  8043f5:	53                   	push   %rbx
+  8043f6:	48 83 ec 28          	sub    $0x28,%rsp
+  8043fa:	49 89 fe             	mov    %rdi,%r14
+  8043fd:	49 89 f7             	mov    %rsi,%r15
+  804400:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  804407:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  804408:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  80440f:	01 00 00 
+  804412:	e9 ae 00 00 00       	jmp    8044c5 <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  804417:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80441e:	49 83 ec 01          	sub    $0x1,%r12
+  804422:	74 2d                	je     804451 <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  804424:	48 89 d8             	mov    %rbx,%rax
+  804427:	48 c1 e8 0c          	shr    $0xc,%rax
+  80442b:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  804430:	f6 c2 01             	test   $0x1,%dl
+  804433:	74 e2                	je     804417 <foreach_shared_region+0x42>
+  804435:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  80443a:	f6 c4 04             	test   $0x4,%ah
+  80443d:	74 d8                	je     804417 <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  80443f:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  804446:	4c 89 fa             	mov    %r15,%rdx
+  804449:	48 89 df             	mov    %rbx,%rdi
+  80444c:	41 ff d6             	call   *%r14
+  80444f:	eb c6                	jmp    804417 <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  804451:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  804458:	00 
+  804459:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  80445e:	74 4a                	je     8044aa <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  804460:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804464:	48 c1 e8 15          	shr    $0x15,%rax
+  804468:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  80446f:	01 00 00 
+  804472:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804476:	a8 01                	test   $0x1,%al
+  804478:	74 d7                	je     804451 <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  80447a:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  80447e:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  804485:	48 39 c3             	cmp    %rax,%rbx
+  804488:	73 c7                	jae    804451 <foreach_shared_region+0x7c>
+  80448a:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  804491:	48 39 d0             	cmp    %rdx,%rax
+  804494:	4d 19 e4             	sbb    %r12,%r12
+  804497:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  80449e:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  8044a5:	e9 7a ff ff ff       	jmp    804424 <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  8044aa:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  8044b1:	40 
+  8044b2:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8044b6:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8044bd:	00 00 00 
+  8044c0:	48 39 c1             	cmp    %rax,%rcx
+  8044c3:	74 50                	je     804515 <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  8044c5:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8044c9:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8044cd:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  8044d4:	01 00 00 
+  8044d7:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  8044db:	a8 01                	test   $0x1,%al
+  8044dd:	74 cb                	je     8044aa <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  8044df:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8044e3:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  8044ea:	48 39 c1             	cmp    %rax,%rcx
+  8044ed:	73 bb                	jae    8044aa <foreach_shared_region+0xd5>
+  8044ef:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  8044f6:	48 39 d0             	cmp    %rdx,%rax
+  8044f9:	48 19 c0             	sbb    %rax,%rax
+  8044fc:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  804502:	48 05 00 02 00 00    	add    $0x200,%rax
+  804508:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80450c:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  804510:	e9 4b ff ff ff       	jmp    804460 <foreach_shared_region+0x8b>
+  804515:	b8 00 00 00 00       	mov    $0x0,%eax
+  80451a:	48 83 c4 28          	add    $0x28,%rsp
+  80451e:	5b                   	pop    %rbx
+  80451f:	41 5c                	pop    %r12
+  804521:	41 5d                	pop    %r13
+  804523:	41 5e                	pop    %r14
+  804525:	41 5f                	pop    %r15
+  804527:	5d                   	pop    %rbp
+  804528:	c3                   	ret
+
+0000000000804529 <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  804529:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  80452f:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  804536:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  80453d:	c3                   	ret
+
+000000000080453e <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  80453e:	8b 47 40             	mov    0x40(%rdi),%eax
+  804541:	8b 17                	mov    (%rdi),%edx
+  804543:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  804545:	83 f8 0f             	cmp    $0xf,%eax
+  804548:	77 13                	ja     80455d <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  80454a:	8b 47 40             	mov    0x40(%rdi),%eax
+  80454d:	83 e0 0f             	and    $0xf,%eax
+  804550:	48 c1 e0 09          	shl    $0x9,%rax
+  804554:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  80455b:	00 
+  80455c:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  80455d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804562:	c3                   	ret
+
+0000000000804563 <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  804563:	8b 47 40             	mov    0x40(%rdi),%eax
+  804566:	83 c0 01             	add    $0x1,%eax
+  804569:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  80456c:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  804572:	8b 57 04             	mov    0x4(%rdi),%edx
+  804575:	b8 00 00 00 00       	mov    $0x0,%eax
+  80457a:	85 d2                	test   %edx,%edx
+  80457c:	75 04                	jne    804582 <chan_publish+0x1f>
+  80457e:	83 e0 01             	and    $0x1,%eax
+}
+  804581:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  804582:	87 47 04             	xchg   %eax,0x4(%rdi)
+  804585:	85 c0                	test   %eax,%eax
+  804587:	0f 95 c0             	setne  %al
+  80458a:	0f b6 c0             	movzbl %al,%eax
+  80458d:	eb ef                	jmp    80457e <chan_publish+0x1b>
+
+000000000080458f <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  80458f:	8b 47 40             	mov    0x40(%rdi),%eax
+  804592:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  804594:	29 d0                	sub    %edx,%eax
+  804596:	83 e8 01             	sub    $0x1,%eax
+  804599:	83 f8 0f             	cmp    $0xf,%eax
+  80459c:	77 12                	ja     8045b0 <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  80459e:	8b 07                	mov    (%rdi),%eax
+  8045a0:	83 e0 0f             	and    $0xf,%eax
+  8045a3:	48 c1 e0 09          	shl    $0x9,%rax
+  8045a7:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  8045ae:	00 
+  8045af:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  8045b0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8045b5:	c3                   	ret
+
+00000000008045b6 <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  8045b6:	8b 07                	mov    (%rdi),%eax
+  8045b8:	83 c0 01             	add    $0x1,%eax
+  8045bb:	89 07                	mov    %eax,(%rdi)
+}
+  8045bd:	c3                   	ret
+
+00000000008045be <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  8045be:	55                   	push   %rbp
+  8045bf:	48 89 e5             	mov    %rsp,%rbp
+  8045c2:	53                   	push   %rbx
+  8045c3:	48 83 ec 08          	sub    $0x8,%rsp
+  8045c7:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  8045ca:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8045d1:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  8045d7:	48 b8 8f 45 80 00 00 	movabs $0x80458f,%rax
+  8045de:	00 00 00 
+  8045e1:	ff d0                	call   *%rax
+  8045e3:	48 85 c0             	test   %rax,%rax
+  8045e6:	74 12                	je     8045fa <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  8045e8:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  8045ef:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8045f4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8045f8:	c9                   	leave
+  8045f9:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  8045fa:	b8 01 00 00 00       	mov    $0x1,%eax
+  8045ff:	eb f3                	jmp    8045f4 <chan_arm+0x36>
+
+0000000000804601 <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  804601:	55                   	push   %rbp
+  804602:	48 89 e5             	mov    %rsp,%rbp
+  804605:	41 56                	push   %r14
+  804607:	41 55                	push   %r13
+  804609:	41 54                	push   %r12
+  80460b:	53                   	push   %rbx
+  80460c:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  80460f:	49 bc be 45 80 00 00 	movabs $0x8045be,%r12
+  804616:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  804619:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  80461d:	49 bd c0 18 80 00 00 	movabs $0x8018c0,%r13
+  804624:	00 00 00 
+    while (chan_arm(r))
+  804627:	eb 0d                	jmp    804636 <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  804629:	8b 33                	mov    (%rbx),%esi
+  80462b:	ba 00 00 00 00       	mov    $0x0,%edx
+  804630:	4c 89 f7             	mov    %r14,%rdi
+  804633:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  804636:	48 89 df             	mov    %rbx,%rdi
+  804639:	41 ff d4             	call   *%r12
+  80463c:	84 c0                	test   %al,%al
+  80463e:	75 e9                	jne    804629 <chan_wait+0x28>
+}
+  804640:	5b                   	pop    %rbx
+  804641:	41 5c                	pop    %r12
+  804643:	41 5d                	pop    %r13
+  804645:	41 5e                	pop    %r14
+  804647:	5d                   	pop    %rbp
+  804648:	c3                   	ret
+
+0000000000804649 <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  804649:	55                   	push   %rbp
+  80464a:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  80464d:	48 83 c7 40          	add    $0x40,%rdi
+  804651:	be 01 00 00 00       	mov    $0x1,%esi
+  804656:	48 b8 de 18 80 00 00 	movabs $0x8018de,%rax
+  80465d:	00 00 00 
+  804660:	ff d0                	call   *%rax
+}
+  804662:	5d                   	pop    %rbp
+  804663:	c3                   	ret
+
+0000000000804664 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804664:	b8 00 00 00 00       	mov    $0x0,%eax
+  804669:	c3                   	ret
+
+000000000080466a <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80466a:	55                   	push   %rbp
+  80466b:	48 89 e5             	mov    %rsp,%rbp
+  80466e:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804671:	48 be 6a 55 80 00 00 	movabs $0x80556a,%rsi
+  804678:	00 00 00 
+  80467b:	48 b8 f3 0f 80 00 00 	movabs $0x800ff3,%rax
+  804682:	00 00 00 
+  804685:	ff d0                	call   *%rax
+    return 0;
+}
+  804687:	b8 00 00 00 00       	mov    $0x0,%eax
+  80468c:	5d                   	pop    %rbp
+  80468d:	c3                   	ret
+
+000000000080468e <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80468e:	55                   	push   %rbp
+  80468f:	48 89 e5             	mov    %rsp,%rbp
+  804692:	41 57                	push   %r15
+  804694:	41 56                	push   %r14
+  804696:	41 55                	push   %r13
+  804698:	41 54                	push   %r12
+  80469a:	53                   	push   %rbx
+  80469b:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8046a2:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8046a9:	48 85 d2             	test   %rdx,%rdx
+  8046ac:	74 7a                	je     804728 <devcons_write+0x9a>
+  8046ae:	49 89 d6             	mov    %rdx,%r14
+  8046b1:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8046b7:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8046bc:	49 bf ed 11 80 00 00 	movabs $0x8011ed,%r15
+  8046c3:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8046c6:	4c 89 f3             	mov    %r14,%rbx
+  8046c9:	48 29 f3             	sub    %rsi,%rbx
+  8046cc:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8046d1:	48 39 c3             	cmp    %rax,%rbx
+  8046d4:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8046d8:	4c 63 eb             	movslq %ebx,%r13
+  8046db:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8046e2:	48 01 c6             	add    %rax,%rsi
+  8046e5:	4c 89 ea             	mov    %r13,%rdx
+  8046e8:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8046ef:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8046f2:	4c 89 ee             	mov    %r13,%rsi
+  8046f5:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8046fc:	48 b8 1a 14 80 00 00 	movabs $0x80141a,%rax
+  804703:	00 00 00 
+  804706:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804708:	41 01 dc             	add    %ebx,%r12d
+  80470b:	49 63 f4             	movslq %r12d,%rsi
+  80470e:	4c 39 f6             	cmp    %r14,%rsi
+  804711:	72 b3                	jb     8046c6 <devcons_write+0x38>
+    return res;
+  804713:	49 63 c4             	movslq %r12d,%rax
+}
+  804716:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80471d:	5b                   	pop    %rbx
+  80471e:	41 5c                	pop    %r12
+  804720:	41 5d                	pop    %r13
+  804722:	41 5e                	pop    %r14
+  804724:	41 5f                	pop    %r15
+  804726:	5d                   	pop    %rbp
+  804727:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804728:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80472e:	eb e3                	jmp    804713 <devcons_write+0x85>
+
+0000000000804730 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804730:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804733:	ba 00 00 00 00       	mov    $0x0,%edx
+  804738:	48 85 c0             	test   %rax,%rax
+  80473b:	74 55                	je     804792 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80473d:	55                   	push   %rbp
+  80473e:	48 89 e5             	mov    %rsp,%rbp
+  804741:	41 55                	push   %r13
+  804743:	41 54                	push   %r12
+  804745:	53                   	push   %rbx
+  804746:	48 83 ec 08          	sub    $0x8,%rsp
+  80474a:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  80474d:	48 bb 39 14 80 00 00 	movabs $0x801439,%rbx
+  804754:	00 00 00 
+  804757:	49 bc ee 14 80 00 00 	movabs $0x8014ee,%r12
+  80475e:	00 00 00 
+  804761:	eb 03                	jmp    804766 <devcons_read+0x36>
+  804763:	41 ff d4             	call   *%r12
+  804766:	ff d3                	call   *%rbx
+  804768:	85 c0                	test   %eax,%eax
+  80476a:	74 f7                	je     804763 <devcons_read+0x33>
+    if (c < 0) return c;
+  80476c:	48 63 d0             	movslq %eax,%rdx
+  80476f:	78 13                	js     804784 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  804771:	ba 00 00 00 00       	mov    $0x0,%edx
+  804776:	83 f8 04             	cmp    $0x4,%eax
+  804779:	74 09                	je     804784 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  80477b:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  80477f:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804784:	48 89 d0             	mov    %rdx,%rax
+  804787:	48 83 c4 08          	add    $0x8,%rsp
+  80478b:	5b                   	pop    %rbx
+  80478c:	41 5c                	pop    %r12
+  80478e:	41 5d                	pop    %r13
+  804790:	5d                   	pop    %rbp
+  804791:	c3                   	ret
+  804792:	48 89 d0             	mov    %rdx,%rax
+  804795:	c3                   	ret
+
+0000000000804796 <cputchar>:
+cputchar(int ch) {
+  804796:	55                   	push   %rbp
+  804797:	48 89 e5             	mov    %rsp,%rbp
+  80479a:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  80479e:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8047a2:	be 01 00 00 00       	mov    $0x1,%esi
+  8047a7:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8047ab:	48 b8 1a 14 80 00 00 	movabs $0x80141a,%rax
+  8047b2:	00 00 00 
+  8047b5:	ff d0                	call   *%rax
+}
+  8047b7:	c9                   	leave
+  8047b8:	c3                   	ret
+
+00000000008047b9 <getchar>:
+getchar(void) {
+  8047b9:	55                   	push   %rbp
+  8047ba:	48 89 e5             	mov    %rsp,%rbp
+  8047bd:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8047c1:	ba 01 00 00 00       	mov    $0x1,%edx
+  8047c6:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8047ca:	bf 00 00 00 00       	mov    $0x0,%edi
+  8047cf:	48 b8 16 1e 80 00 00 	movabs $0x801e16,%rax
+  8047d6:	00 00 00 
+  8047d9:	ff d0                	call   *%rax
+  8047db:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8047dd:	85 c0                	test   %eax,%eax
+  8047df:	78 06                	js     8047e7 <getchar+0x2e>
+  8047e1:	74 08                	je     8047eb <getchar+0x32>
+  8047e3:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8047e7:	89 d0                	mov    %edx,%eax
+  8047e9:	c9                   	leave
+  8047ea:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8047eb:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8047f0:	eb f5                	jmp    8047e7 <getchar+0x2e>
+
+00000000008047f2 <iscons>:
+iscons(int fdnum) {
+  8047f2:	55                   	push   %rbp
+  8047f3:	48 89 e5             	mov    %rsp,%rbp
+  8047f6:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8047fa:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8047fe:	48 b8 33 1b 80 00 00 	movabs $0x801b33,%rax
+  804805:	00 00 00 
+  804808:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80480a:	85 c0                	test   %eax,%eax
+  80480c:	78 18                	js     804826 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80480e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804812:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  804819:	00 00 00 
+  80481c:	8b 00                	mov    (%rax),%eax
+  80481e:	39 02                	cmp    %eax,(%rdx)
+  804820:	0f 94 c0             	sete   %al
+  804823:	0f b6 c0             	movzbl %al,%eax
+}
+  804826:	c9                   	leave
+  804827:	c3                   	ret
+
+0000000000804828 <opencons>:
+opencons(void) {
+  804828:	55                   	push   %rbp
+  804829:	48 89 e5             	mov    %rsp,%rbp
+  80482c:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  804830:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  804834:	48 b8 d3 1a 80 00 00 	movabs $0x801ad3,%rax
+  80483b:	00 00 00 
+  80483e:	ff d0                	call   *%rax
+  804840:	85 c0                	test   %eax,%eax
+  804842:	78 49                	js     80488d <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  804844:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804849:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80484e:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  804852:	bf 00 00 00 00       	mov    $0x0,%edi
+  804857:	48 b8 52 15 80 00 00 	movabs $0x801552,%rax
+  80485e:	00 00 00 
+  804861:	ff d0                	call   *%rax
+  804863:	85 c0                	test   %eax,%eax
+  804865:	78 26                	js     80488d <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  804867:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80486b:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  804872:	00 00 
+  804874:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  804876:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80487a:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  804881:	48 b8 a5 1a 80 00 00 	movabs $0x801aa5,%rax
+  804888:	00 00 00 
+  80488b:	ff d0                	call   *%rax
+}
+  80488d:	c9                   	leave
+  80488e:	c3                   	ret
+
+000000000080488f <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  80488f:	55                   	push   %rbp
+  804890:	48 89 e5             	mov    %rsp,%rbp
+  804893:	41 56                	push   %r14
+  804895:	41 55                	push   %r13
+  804897:	41 54                	push   %r12
+  804899:	53                   	push   %rbx
+  80489a:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80489d:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  8048a4:	00 00 00 
+  8048a7:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8048ab:	74 27                	je     8048d4 <_handle_vectored_pagefault+0x45>
+  8048ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  8048b2:	49 bd 00 10 84 00 00 	movabs $0x841000,%r13
+  8048b9:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8048bc:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  8048bf:	4c 89 e7             	mov    %r12,%rdi
+  8048c2:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  8048c7:	84 c0                	test   %al,%al
+  8048c9:	75 45                	jne    804910 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8048cb:	48 83 c3 01          	add    $0x1,%rbx
+  8048cf:	49 3b 1e             	cmp    (%r14),%rbx
+  8048d2:	72 eb                	jb     8048bf <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  8048d4:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  8048db:	00 
+  8048dc:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  8048e1:	4d 8b 04 24          	mov    (%r12),%r8
+  8048e5:	48 ba 78 55 80 00 00 	movabs $0x805578,%rdx
+  8048ec:	00 00 00 
+  8048ef:	be 1d 00 00 00       	mov    $0x1d,%esi
+  8048f4:	48 bf a8 55 80 00 00 	movabs $0x8055a8,%rdi
+  8048fb:	00 00 00 
+  8048fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  804903:	49 ba 7e 05 80 00 00 	movabs $0x80057e,%r10
+  80490a:	00 00 00 
+  80490d:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  804910:	5b                   	pop    %rbx
+  804911:	41 5c                	pop    %r12
+  804913:	41 5d                	pop    %r13
+  804915:	41 5e                	pop    %r14
+  804917:	5d                   	pop    %rbp
+  804918:	c3                   	ret
+
+0000000000804919 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  804919:	55                   	push   %rbp
+  80491a:	48 89 e5             	mov    %rsp,%rbp
+  80491d:	53                   	push   %rbx
+  80491e:	48 83 ec 08          	sub    $0x8,%rsp
+  804922:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  804925:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  80492c:	00 00 00 
+  80492f:	80 38 00             	cmpb   $0x0,(%rax)
+  804932:	0f 84 84 00 00 00    	je     8049bc <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804938:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  80493f:	00 00 00 
+  804942:	48 8b 10             	mov    (%rax),%rdx
+  804945:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  80494a:	48 b9 00 10 84 00 00 	movabs $0x841000,%rcx
+  804951:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804954:	48 85 d2             	test   %rdx,%rdx
+  804957:	74 19                	je     804972 <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  804959:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  80495d:	0f 84 e8 00 00 00    	je     804a4b <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804963:	48 83 c0 01          	add    $0x1,%rax
+  804967:	48 39 d0             	cmp    %rdx,%rax
+  80496a:	75 ed                	jne    804959 <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  80496c:	48 83 fa 08          	cmp    $0x8,%rdx
+  804970:	74 1c                	je     80498e <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  804972:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  804976:	48 a3 48 10 84 00 00 	movabs %rax,0x841048
+  80497d:	00 00 00 
+  804980:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  804987:	00 00 00 
+  80498a:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  80498e:	48 b8 c5 14 80 00 00 	movabs $0x8014c5,%rax
+  804995:	00 00 00 
+  804998:	ff d0                	call   *%rax
+  80499a:	89 c7                	mov    %eax,%edi
+  80499c:	48 be 11 4b 80 00 00 	movabs $0x804b11,%rsi
+  8049a3:	00 00 00 
+  8049a6:	48 b8 10 17 80 00 00 	movabs $0x801710,%rax
+  8049ad:	00 00 00 
+  8049b0:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8049b2:	85 c0                	test   %eax,%eax
+  8049b4:	78 68                	js     804a1e <add_pgfault_handler+0x105>
+    return res;
+}
+  8049b6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8049ba:	c9                   	leave
+  8049bb:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  8049bc:	48 b8 c5 14 80 00 00 	movabs $0x8014c5,%rax
+  8049c3:	00 00 00 
+  8049c6:	ff d0                	call   *%rax
+  8049c8:	89 c7                	mov    %eax,%edi
+  8049ca:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8049cf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8049d4:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  8049db:	00 00 00 
+  8049de:	48 b8 52 15 80 00 00 	movabs $0x801552,%rax
+  8049e5:	00 00 00 
+  8049e8:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8049ea:	48 ba 48 10 84 00 00 	movabs $0x841048,%rdx
+  8049f1:	00 00 00 
+  8049f4:	48 8b 02             	mov    (%rdx),%rax
+  8049f7:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8049fb:	48 89 0a             	mov    %rcx,(%rdx)
+  8049fe:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  804a05:	00 00 00 
+  804a08:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  804a0c:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  804a13:	00 00 00 
+  804a16:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  804a19:	e9 70 ff ff ff       	jmp    80498e <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  804a1e:	89 c1                	mov    %eax,%ecx
+  804a20:	48 ba b6 55 80 00 00 	movabs $0x8055b6,%rdx
+  804a27:	00 00 00 
+  804a2a:	be 3d 00 00 00       	mov    $0x3d,%esi
+  804a2f:	48 bf a8 55 80 00 00 	movabs $0x8055a8,%rdi
+  804a36:	00 00 00 
+  804a39:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a3e:	49 b8 7e 05 80 00 00 	movabs $0x80057e,%r8
+  804a45:	00 00 00 
+  804a48:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  804a4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a50:	e9 61 ff ff ff       	jmp    8049b6 <add_pgfault_handler+0x9d>
+
+0000000000804a55 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  804a55:	55                   	push   %rbp
+  804a56:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  804a59:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  804a60:	00 00 00 
+  804a63:	80 38 00             	cmpb   $0x0,(%rax)
+  804a66:	74 33                	je     804a9b <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804a68:	48 a1 48 10 84 00 00 	movabs 0x841048,%rax
+  804a6f:	00 00 00 
+  804a72:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  804a77:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  804a7e:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804a81:	48 85 c0             	test   %rax,%rax
+  804a84:	0f 84 85 00 00 00    	je     804b0f <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  804a8a:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  804a8e:	74 40                	je     804ad0 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804a90:	48 83 c1 01          	add    $0x1,%rcx
+  804a94:	48 39 c1             	cmp    %rax,%rcx
+  804a97:	75 f1                	jne    804a8a <remove_pgfault_handler+0x35>
+  804a99:	eb 74                	jmp    804b0f <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  804a9b:	48 b9 ce 55 80 00 00 	movabs $0x8055ce,%rcx
+  804aa2:	00 00 00 
+  804aa5:	48 ba 07 55 80 00 00 	movabs $0x805507,%rdx
+  804aac:	00 00 00 
+  804aaf:	be 43 00 00 00       	mov    $0x43,%esi
+  804ab4:	48 bf a8 55 80 00 00 	movabs $0x8055a8,%rdi
+  804abb:	00 00 00 
+  804abe:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ac3:	49 b8 7e 05 80 00 00 	movabs $0x80057e,%r8
+  804aca:	00 00 00 
+  804acd:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  804ad0:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  804ad7:	00 
+  804ad8:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804adc:	48 29 ca             	sub    %rcx,%rdx
+  804adf:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  804ae6:	00 00 00 
+  804ae9:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  804aed:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  804af2:	48 89 ce             	mov    %rcx,%rsi
+  804af5:	48 b8 ed 11 80 00 00 	movabs $0x8011ed,%rax
+  804afc:	00 00 00 
+  804aff:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  804b01:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  804b08:	00 00 00 
+  804b0b:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  804b0f:	5d                   	pop    %rbp
+  804b10:	c3                   	ret
+
+0000000000804b11 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  804b11:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  804b14:	48 b8 8f 48 80 00 00 	movabs $0x80488f,%rax
+  804b1b:	00 00 00 
+    call *%rax
+  804b1e:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  804b20:	41 5f                	pop    %r15
+	popq %r15
+  804b22:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  804b24:	41 5f                	pop    %r15
+	popq %r14
+  804b26:	41 5e                	pop    %r14
+	popq %r13
+  804b28:	41 5d                	pop    %r13
+	popq %r12
+  804b2a:	41 5c                	pop    %r12
+	popq %r11
+  804b2c:	41 5b                	pop    %r11
+	popq %r10
+  804b2e:	41 5a                	pop    %r10
+	popq %r9
+  804b30:	41 59                	pop    %r9
+	popq %r8
+  804b32:	41 58                	pop    %r8
+	popq %rsi
+  804b34:	5e                   	pop    %rsi
+	popq %rdi
+  804b35:	5f                   	pop    %rdi
+	popq %rbp
+  804b36:	5d                   	pop    %rbp
+	popq %rdx
+  804b37:	5a                   	pop    %rdx
+	popq %rcx
+  804b38:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  804b39:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  804b3e:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  804b43:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  804b47:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  804b4a:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  804b4f:	5b                   	pop    %rbx
+	popq %rax
+  804b50:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  804b51:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  804b55:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  804b56:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  804b5b:	c3                   	ret
+
+0000000000804b5c <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  804b5c:	55                   	push   %rbp
+  804b5d:	48 89 e5             	mov    %rsp,%rbp
+  804b60:	41 55                	push   %r13
+  804b62:	41 54                	push   %r12
+  804b64:	53                   	push   %rbx
+  804b65:	48 83 ec 08          	sub    $0x8,%rsp
+  804b69:	49 89 fd             	mov    %rdi,%r13
+  804b6c:	48 89 f7             	mov    %rsi,%rdi
+  804b6f:	48 89 d3             	mov    %rdx,%rbx
+  804b72:	49 89 cc             	mov    %rcx,%r12
+  804b75:	4c 89 c2             	mov    %r8,%rdx
+  804b78:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804b7b:	48 85 f6             	test   %rsi,%rsi
+  804b7e:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804b85:	00 00 00 
+  804b88:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  804b8c:	be 00 10 00 00       	mov    $0x1000,%esi
+  804b91:	48 85 db             	test   %rbx,%rbx
+  804b94:	74 03                	je     804b99 <ipc_recv_futex+0x3d>
+  804b96:	48 8b 33             	mov    (%rbx),%rsi
+  804b99:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  804b9d:	48 b8 9c 17 80 00 00 	movabs $0x80179c,%rax
+  804ba4:	00 00 00 
+  804ba7:	ff d0                	call   *%rax
+    if (res < 0) {
+  804ba9:	85 c0                	test   %eax,%eax
+  804bab:	78 75                	js     804c22 <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  804bad:	4d 85 ed             	test   %r13,%r13
+  804bb0:	74 14                	je     804bc6 <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  804bb2:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804bb9:	00 00 00 
+  804bbc:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  804bc2:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  804bc6:	4d 85 e4             	test   %r12,%r12
+  804bc9:	74 14                	je     804bdf <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  804bcb:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804bd2:	00 00 00 
+  804bd5:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  804bdb:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  804bdf:	48 85 db             	test   %rbx,%rbx
+  804be2:	74 23                	je     804c07 <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804be4:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804beb:	00 00 00 
+  804bee:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  804bf4:	ba 00 00 00 00       	mov    $0x0,%edx
+  804bf9:	85 c9                	test   %ecx,%ecx
+  804bfb:	74 07                	je     804c04 <ipc_recv_futex+0xa8>
+  804bfd:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  804c04:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  804c07:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804c0e:	00 00 00 
+  804c11:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  804c17:	48 83 c4 08          	add    $0x8,%rsp
+  804c1b:	5b                   	pop    %rbx
+  804c1c:	41 5c                	pop    %r12
+  804c1e:	41 5d                	pop    %r13
+  804c20:	5d                   	pop    %rbp
+  804c21:	c3                   	ret
+        if (from_env_store != NULL) {
+  804c22:	4d 85 ed             	test   %r13,%r13
+  804c25:	74 08                	je     804c2f <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  804c27:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804c2e:	00 
+        if (perm_store != NULL) {
+  804c2f:	4d 85 e4             	test   %r12,%r12
+  804c32:	74 08                	je     804c3c <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  804c34:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804c3b:	00 
+        if (size != NULL) {
+  804c3c:	48 85 db             	test   %rbx,%rbx
+  804c3f:	74 d6                	je     804c17 <ipc_recv_futex+0xbb>
+            *size = 0;
+  804c41:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  804c48:	eb cd                	jmp    804c17 <ipc_recv_futex+0xbb>
+
+0000000000804c4a <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804c4a:	55                   	push   %rbp
+  804c4b:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  804c4e:	48 83 ec 08          	sub    $0x8,%rsp
+  804c52:	6a 00                	push   $0x0
+  804c54:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804c5a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804c60:	48 b8 5c 4b 80 00 00 	movabs $0x804b5c,%rax
+  804c67:	00 00 00 
+  804c6a:	ff d0                	call   *%rax
+}
+  804c6c:	c9                   	leave
+  804c6d:	c3                   	ret
+
+0000000000804c6e <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  804c6e:	55                   	push   %rbp
+  804c6f:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804c72:	48 85 d2             	test   %rdx,%rdx
+  804c75:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804c7c:	00 00 00 
+  804c7f:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  804c83:	89 f6                	mov    %esi,%esi
+  804c85:	48 b8 85 17 80 00 00 	movabs $0x801785,%rax
+  804c8c:	00 00 00 
+  804c8f:	ff d0                	call   *%rax
+    if (res < 0) {
+  804c91:	85 c0                	test   %eax,%eax
+  804c93:	78 02                	js     804c97 <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  804c95:	5d                   	pop    %rbp
+  804c96:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  804c97:	89 c1                	mov    %eax,%ecx
+  804c99:	48 ba e8 55 80 00 00 	movabs $0x8055e8,%rdx
+  804ca0:	00 00 00 
+  804ca3:	be 50 00 00 00       	mov    $0x50,%esi
+  804ca8:	48 bf fc 55 80 00 00 	movabs $0x8055fc,%rdi
+  804caf:	00 00 00 
+  804cb2:	b8 00 00 00 00       	mov    $0x0,%eax
+  804cb7:	49 b8 7e 05 80 00 00 	movabs $0x80057e,%r8
+  804cbe:	00 00 00 
+  804cc1:	41 ff d0             	call   *%r8
+
+0000000000804cc4 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804cc4:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  804cc9:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804cd0:	00 00 00 
+  804cd3:	48 89 d0             	mov    %rdx,%rax
+  804cd6:	48 c1 e0 04          	shl    $0x4,%rax
+  804cda:	48 29 d0             	sub    %rdx,%rax
+  804cdd:	48 c1 e0 05          	shl    $0x5,%rax
+  804ce1:	48 01 c8             	add    %rcx,%rax
+  804ce4:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  804cea:	39 f8                	cmp    %edi,%eax
+  804cec:	74 13                	je     804d01 <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  804cee:	48 83 c2 01          	add    $0x1,%rdx
+  804cf2:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  804cf9:	75 d8                	jne    804cd3 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804cfb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804d00:	c3                   	ret
+            return envs[i].env_id;
+  804d01:	48 89 d0             	mov    %rdx,%rax
+  804d04:	48 c1 e0 04          	shl    $0x4,%rax
+  804d08:	48 29 d0             	sub    %rdx,%rax
+  804d0b:	48 c1 e0 05          	shl    $0x5,%rax
+  804d0f:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804d16:	00 00 00 
+  804d19:	48 01 d0             	add    %rdx,%rax
+  804d1c:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804d22:	c3                   	ret
+  804d23:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000804d28 <__rodata_start>:
+  804d28:	70 69                	jo     804d93 <__rodata_start+0x6b>
+  804d2a:	70 65                	jo     804d91 <__rodata_start+0x69>
+  804d2c:	72 65                	jb     804d93 <__rodata_start+0x6b>
+  804d2e:	61                   	(bad)
+  804d2f:	64 65 6f             	fs outsl %gs:(%rsi),(%dx)
+  804d32:	66 00 70 69          	data16 add %dh,0x69(%rax)
+  804d36:	70 65                	jo     804d9d <__rodata_start+0x75>
+  804d38:	3a 20                	cmp    (%rax),%ah
+  804d3a:	25 69 00 75 73       	and    $0x73750069,%eax
+  804d3f:	65 72 2f             	gs jb  804d71 <__rodata_start+0x49>
+  804d42:	74 65                	je     804da9 <__rodata_start+0x81>
+  804d44:	73 74                	jae    804dba <__rodata_start+0x92>
+  804d46:	70 69                	jo     804db1 <__rodata_start+0x89>
+  804d48:	70 65                	jo     804daf <__rodata_start+0x87>
+  804d4a:	2e 63 00             	cs movsxd (%rax),%eax
+  804d4d:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804d4f:	72 6b                	jb     804dbc <__rodata_start+0x94>
+  804d51:	3a 20                	cmp    (%rax),%ah
+  804d53:	25 69 00 5b 25       	and    $0x255b0069,%eax
+  804d58:	30 38                	xor    %bh,(%rax)
+  804d5a:	78 5d                	js     804db9 <__rodata_start+0x91>
+  804d5c:	20 70 69             	and    %dh,0x69(%rax)
+  804d5f:	70 65                	jo     804dc6 <__rodata_start+0x9e>
+  804d61:	72 65                	jb     804dc8 <__rodata_start+0xa0>
+  804d63:	61                   	(bad)
+  804d64:	64 65 6f             	fs outsl %gs:(%rsi),(%dx)
+  804d67:	66 20 63 6c          	data16 and %ah,0x6c(%rbx)
+  804d6b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804d6c:	73 65                	jae    804dd3 <__rodata_start+0xab>
+  804d6e:	20 25 64 0a 00 5b    	and    %ah,0x5b000a64(%rip)        # 5b8057d8 <__bss_end+0x5afc37d8>
+  804d74:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  804d79:	20 70 69             	and    %dh,0x69(%rax)
+  804d7c:	70 65                	jo     804de3 <__rodata_start+0xbb>
+  804d7e:	72 65                	jb     804de5 <__rodata_start+0xbd>
+  804d80:	61                   	(bad)
+  804d81:	64 65 6f             	fs outsl %gs:(%rsi),(%dx)
+  804d84:	66 20 72 65          	data16 and %dh,0x65(%rdx)
+  804d88:	61                   	(bad)
+  804d89:	64 6e                	outsb  %fs:(%rsi),(%dx)
+  804d8b:	20 25 64 0a 00 72    	and    %ah,0x72000a64(%rip)        # 728057f5 <__bss_end+0x71fc37f5>
+  804d91:	65 61                	gs (bad)
+  804d93:	64 3a 20             	cmp    %fs:(%rax),%ah
+  804d96:	25 69 00 0a 70       	and    $0x700a0069,%eax
+  804d9b:	69 70 65 20 72 65 61 	imul   $0x61657220,0x65(%rax),%esi
+  804da2:	64 20 63 6c          	and    %ah,%fs:0x6c(%rbx)
+  804da6:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804da7:	73 65                	jae    804e0e <__rodata_start+0xe6>
+  804da9:	64 20 70 72          	and    %dh,%fs:0x72(%rax)
+  804dad:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804dae:	70 65                	jo     804e15 <__rodata_start+0xed>
+  804db0:	72 6c                	jb     804e1e <__rodata_start+0xf6>
+  804db2:	79 0a                	jns    804dbe <__rodata_start+0x96>
+  804db4:	00 0a                	add    %cl,(%rdx)
+  804db6:	67 6f                	outsl  %ds:(%esi),(%dx)
+  804db8:	74 20                	je     804dda <__rodata_start+0xb2>
+  804dba:	25 64 20 62 79       	and    $0x79622064,%eax
+  804dbf:	74 65                	je     804e26 <__rodata_start+0xfe>
+  804dc1:	73 3a                	jae    804dfd <__rodata_start+0xd5>
+  804dc3:	20 25 73 0a 00 5b    	and    %ah,0x5b000a73(%rip)        # 5b80583c <__bss_end+0x5afc383c>
+  804dc9:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  804dce:	20 70 69             	and    %dh,0x69(%rax)
+  804dd1:	70 65                	jo     804e38 <__rodata_start+0x110>
+  804dd3:	72 65                	jb     804e3a <__rodata_start+0x112>
+  804dd5:	61                   	(bad)
+  804dd6:	64 65 6f             	fs outsl %gs:(%rsi),(%dx)
+  804dd9:	66 20 77 72          	data16 and %dh,0x72(%rdi)
+  804ddd:	69 74 65 20 25 64 0a 	imul   $0xa6425,0x20(%rbp,%riz,2),%esi
+  804de4:	00 
+  804de5:	77 72                	ja     804e59 <__rodata_start+0x131>
+  804de7:	69 74 65 3a 20 25 69 	imul   $0x692520,0x3a(%rbp,%riz,2),%esi
+  804dee:	00 
+  804def:	70 69                	jo     804e5a <__rodata_start+0x132>
+  804df1:	70 65                	jo     804e58 <__rodata_start+0x130>
+  804df3:	77 72                	ja     804e67 <__rodata_start+0x13f>
+  804df5:	69 74 65 65 6f 66 00 	imul   $0x2e00666f,0x65(%rbp,%riz,2),%esi
+  804dfc:	2e 
+  804dfd:	00 78 00             	add    %bh,0x0(%rax)
+  804e00:	0a 70 69             	or     0x69(%rax),%dh
+  804e03:	70 65                	jo     804e6a <__rodata_start+0x142>
+  804e05:	20 77 72             	and    %dh,0x72(%rdi)
+  804e08:	69 74 65 20 63 6c 6f 	imul   $0x736f6c63,0x20(%rbp,%riz,2),%esi
+  804e0f:	73 
+  804e10:	65 64 20 70 72       	gs and %dh,%fs:0x72(%rax)
+  804e15:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804e16:	70 65                	jo     804e7d <__rodata_start+0x155>
+  804e18:	72 6c                	jb     804e86 <__rodata_start+0x15e>
+  804e1a:	79 0a                	jns    804e26 <__rodata_start+0xfe>
+  804e1c:	00 70 69             	add    %dh,0x69(%rax)
+  804e1f:	70 65                	jo     804e86 <__rodata_start+0x15e>
+  804e21:	20 74 65 73          	and    %dh,0x73(%rbp,%riz,2)
+  804e25:	74 73                	je     804e9a <__rodata_start+0x172>
+  804e27:	20 70 61             	and    %dh,0x61(%rax)
+  804e2a:	73 73                	jae    804e9f <__rodata_start+0x177>
+  804e2c:	65 64 0a 00          	gs or  %fs:(%rax),%al
+  804e30:	4e 6f                	rex.WRX outsl %ds:(%rsi),(%dx)
+  804e32:	77 20                	ja     804e54 <__rodata_start+0x12c>
+  804e34:	69 73 20 74 68 65 20 	imul   $0x20656874,0x20(%rbx),%esi
+  804e3b:	74 69                	je     804ea6 <__rodata_start+0x17e>
+  804e3d:	6d                   	insl   (%dx),%es:(%rdi)
+  804e3e:	65 20 66 6f          	and    %ah,%gs:0x6f(%rsi)
+  804e42:	72 20                	jb     804e64 <__rodata_start+0x13c>
+  804e44:	61                   	(bad)
+  804e45:	6c                   	insb   (%dx),%es:(%rdi)
+  804e46:	6c                   	insb   (%dx),%es:(%rdi)
+  804e47:	20 67 6f             	and    %ah,0x6f(%rdi)
+  804e4a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804e4b:	64 20 6d 65          	and    %ch,%fs:0x65(%rbp)
+  804e4f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804e50:	20 74 6f 20          	and    %dh,0x20(%rdi,%rbp,2)
+  804e54:	63 6f 6d             	movsxd 0x6d(%rdi),%ebp
+  804e57:	65 20 74 6f 20       	and    %dh,%gs:0x20(%rdi,%rbp,2)
+  804e5c:	74 68                	je     804ec6 <__rodata_start+0x19e>
+  804e5e:	65 20 61 69          	and    %ah,%gs:0x69(%rcx)
+  804e62:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  804e66:	20 74 68 65          	and    %dh,0x65(%rax,%rbp,2)
+  804e6a:	69 72 20 70 61 72 74 	imul   $0x74726170,0x20(%rdx),%esi
+  804e71:	79 2e                	jns    804ea1 <__rodata_start+0x179>
+  804e73:	00 3c 75 6e 6b 6e 6f 	add    %bh,0x6f6e6b6e(,%rsi,2)
+  804e7a:	77 6e                	ja     804eea <__rodata_start+0x1c2>
+  804e7c:	3e 00 66 90          	ds add %ah,-0x70(%rsi)
+  804e80:	5b                   	pop    %rbx
+  804e81:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  804e86:	20 75 73             	and    %dh,0x73(%rbp)
+  804e89:	65 72 20             	gs jb  804eac <__rodata_start+0x184>
+  804e8c:	70 61                	jo     804eef <__rodata_start+0x1c7>
+  804e8e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804e8f:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  804e96:	73 20                	jae    804eb8 <__rodata_start+0x190>
+  804e98:	61                   	(bad)
+  804e99:	74 20                	je     804ebb <__rodata_start+0x193>
+  804e9b:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  804ea0:	3a 20                	cmp    (%rax),%ah
+  804ea2:	00 30                	add    %dh,(%rax)
+  804ea4:	31 32                	xor    %esi,(%rdx)
+  804ea6:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  804ead:	41                   	rex.B
+  804eae:	42                   	rex.X
+  804eaf:	43                   	rex.XB
+  804eb0:	44                   	rex.R
+  804eb1:	45                   	rex.RB
+  804eb2:	46 00 30             	rex.RX add %r14b,(%rax)
+  804eb5:	31 32                	xor    %esi,(%rdx)
+  804eb7:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  804ebe:	61                   	(bad)
+  804ebf:	62 63 64 65 66       	(bad)
+  804ec4:	00 28                	add    %ch,(%rax)
+  804ec6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804ec7:	75 6c                	jne    804f35 <__rodata_start+0x20d>
+  804ec9:	6c                   	insb   (%dx),%es:(%rdi)
+  804eca:	29 00                	sub    %eax,(%rax)
+  804ecc:	65 72 72             	gs jb  804f41 <__rodata_start+0x219>
+  804ecf:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804ed0:	72 20                	jb     804ef2 <__rodata_start+0x1ca>
+  804ed2:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  804ed7:	73 70                	jae    804f49 <__rodata_start+0x221>
+  804ed9:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  804edd:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  804ee4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804ee5:	72 00                	jb     804ee7 <__rodata_start+0x1bf>
+  804ee7:	62 61 64 20 65       	(bad)
+  804eec:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804eed:	76 69                	jbe    804f58 <__rodata_start+0x230>
+  804eef:	72 6f                	jb     804f60 <__rodata_start+0x238>
+  804ef1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804ef2:	6d                   	insl   (%dx),%es:(%rdi)
+  804ef3:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804ef5:	74 00                	je     804ef7 <__rodata_start+0x1cf>
+  804ef7:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  804efe:	20 70 61             	and    %dh,0x61(%rax)
+  804f01:	72 61                	jb     804f64 <__rodata_start+0x23c>
+  804f03:	6d                   	insl   (%dx),%es:(%rdi)
+  804f04:	65 74 65             	gs je  804f6c <__rodata_start+0x244>
+  804f07:	72 00                	jb     804f09 <__rodata_start+0x1e1>
+  804f09:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804f0a:	75 74                	jne    804f80 <__rodata_start+0x258>
+  804f0c:	20 6f 66             	and    %ch,0x66(%rdi)
+  804f0f:	20 6d 65             	and    %ch,0x65(%rbp)
+  804f12:	6d                   	insl   (%dx),%es:(%rdi)
+  804f13:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804f14:	72 79                	jb     804f8f <__rodata_start+0x267>
+  804f16:	00 6f 75             	add    %ch,0x75(%rdi)
+  804f19:	74 20                	je     804f3b <__rodata_start+0x213>
+  804f1b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804f1c:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  804f20:	76 69                	jbe    804f8b <__rodata_start+0x263>
+  804f22:	72 6f                	jb     804f93 <__rodata_start+0x26b>
+  804f24:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804f25:	6d                   	insl   (%dx),%es:(%rdi)
+  804f26:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804f28:	74 73                	je     804f9d <__rodata_start+0x275>
+  804f2a:	00 63 6f             	add    %ah,0x6f(%rbx)
+  804f2d:	72 72                	jb     804fa1 <__rodata_start+0x279>
+  804f2f:	75 70                	jne    804fa1 <__rodata_start+0x279>
+  804f31:	74 65                	je     804f98 <__rodata_start+0x270>
+  804f33:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  804f38:	75 67                	jne    804fa1 <__rodata_start+0x279>
+  804f3a:	20 69 6e             	and    %ch,0x6e(%rcx)
+  804f3d:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804f3f:	00 73 65             	add    %dh,0x65(%rbx)
+  804f42:	67 6d                	insl   (%dx),%es:(%edi)
+  804f44:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804f46:	74 61                	je     804fa9 <__rodata_start+0x281>
+  804f48:	74 69                	je     804fb3 <__rodata_start+0x28b>
+  804f4a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804f4b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804f4c:	20 66 61             	and    %ah,0x61(%rsi)
+  804f4f:	75 6c                	jne    804fbd <__rodata_start+0x295>
+  804f51:	74 00                	je     804f53 <__rodata_start+0x22b>
+  804f53:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  804f5a:	20 45 4c             	and    %al,0x4c(%rbp)
+  804f5d:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  804f61:	61                   	(bad)
+  804f62:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  804f67:	20 73 75             	and    %dh,0x75(%rbx)
+  804f6a:	63 68 20             	movsxd 0x20(%rax),%ebp
+  804f6d:	73 79                	jae    804fe8 <__rodata_start+0x2c0>
+  804f6f:	73 74                	jae    804fe5 <__rodata_start+0x2bd>
+  804f71:	65 6d                	gs insl (%dx),%es:(%rdi)
+  804f73:	20 63 61             	and    %ah,0x61(%rbx)
+  804f76:	6c                   	insb   (%dx),%es:(%rdi)
+  804f77:	6c                   	insb   (%dx),%es:(%rdi)
+  804f78:	00 65 6e             	add    %ah,0x6e(%rbp)
+  804f7b:	74 72                	je     804fef <__rodata_start+0x2c7>
+  804f7d:	79 20                	jns    804f9f <__rodata_start+0x277>
+  804f7f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804f80:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804f81:	74 20                	je     804fa3 <__rodata_start+0x27b>
+  804f83:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804f85:	75 6e                	jne    804ff5 <__rodata_start+0x2cd>
+  804f87:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  804f8b:	76 20                	jbe    804fad <__rodata_start+0x285>
+  804f8d:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  804f94:	72 65                	jb     804ffb <__rodata_start+0x2d3>
+  804f96:	63 76 69             	movsxd 0x69(%rsi),%esi
+  804f99:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804f9a:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  804f9e:	65 78 70             	gs js  805011 <__rodata_start+0x2e9>
+  804fa1:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  804fa6:	20 65 6e             	and    %ah,0x6e(%rbp)
+  804fa9:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  804fad:	20 66 69             	and    %ah,0x69(%rsi)
+  804fb0:	6c                   	insb   (%dx),%es:(%rdi)
+  804fb1:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  804fb5:	20 66 72             	and    %ah,0x72(%rsi)
+  804fb8:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  804fbd:	61                   	(bad)
+  804fbe:	63 65 20             	movsxd 0x20(%rbp),%esp
+  804fc1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804fc2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804fc3:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  804fc7:	6b 00 74             	imul   $0x74,(%rax),%eax
+  804fca:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804fcb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804fcc:	20 6d 61             	and    %ch,0x61(%rbp)
+  804fcf:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804fd0:	79 20                	jns    804ff2 <__rodata_start+0x2ca>
+  804fd2:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  804fd9:	72 65                	jb     805040 <__rodata_start+0x318>
+  804fdb:	20 6f 70             	and    %ch,0x70(%rdi)
+  804fde:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804fe0:	00 66 69             	add    %ah,0x69(%rsi)
+  804fe3:	6c                   	insb   (%dx),%es:(%rdi)
+  804fe4:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  804fe8:	20 62 6c             	and    %ah,0x6c(%rdx)
+  804feb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804fec:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  804fef:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804ff0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804ff1:	74 20                	je     805013 <__rodata_start+0x2eb>
+  804ff3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804ff5:	75 6e                	jne    805065 <__rodata_start+0x33d>
+  804ff7:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  804ffb:	76 61                	jbe    80505e <__rodata_start+0x336>
+  804ffd:	6c                   	insb   (%dx),%es:(%rdi)
+  804ffe:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  805005:	00 
+  805006:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  80500d:	72 65                	jb     805074 <__rodata_start+0x34c>
+  80500f:	61                   	(bad)
+  805010:	64 79 20             	fs jns 805033 <__rodata_start+0x30b>
+  805013:	65 78 69             	gs js  80507f <__rodata_start+0x357>
+  805016:	73 74                	jae    80508c <__rodata_start+0x364>
+  805018:	73 00                	jae    80501a <__rodata_start+0x2f2>
+  80501a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80501b:	70 65                	jo     805082 <__rodata_start+0x35a>
+  80501d:	72 61                	jb     805080 <__rodata_start+0x358>
+  80501f:	74 69                	je     80508a <__rodata_start+0x362>
+  805021:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805022:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805023:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  805026:	74 20                	je     805048 <__rodata_start+0x320>
+  805028:	73 75                	jae    80509f <__rodata_start+0x377>
+  80502a:	70 70                	jo     80509c <__rodata_start+0x374>
+  80502c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80502d:	72 74                	jb     8050a3 <__rodata_start+0x37b>
+  80502f:	65 64 00 74 72 79    	gs add %dh,%fs:0x79(%rdx,%rsi,2)
+  805035:	20 61 67             	and    %ah,0x67(%rcx)
+  805038:	61                   	(bad)
+  805039:	69 6e 00 74 69 6d 65 	imul   $0x656d6974,0x0(%rsi),%ebp
+  805040:	64 20 6f 75          	and    %ch,%fs:0x75(%rdi)
+  805044:	74 00                	je     805046 <__rodata_start+0x31e>
+  805046:	66 69 6c 65 20 69 73 	imul   $0x7369,0x20(%rbp,%riz,2),%bp
+  80504d:	20 69 6e             	and    %ch,0x6e(%rcx)
+  805050:	20 75 73             	and    %dh,0x73(%rbp)
+  805053:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  805057:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  80505e:	00 
+  80505f:	90                   	nop
+  805060:	bb 08 80 00 00       	mov    $0x8008,%ebx
+  805065:	00 00                	add    %al,(%rax)
+  805067:	00 fc                	add    %bh,%ah
+  805069:	0e                   	(bad)
+  80506a:	80 00 00             	addb   $0x0,(%rax)
+  80506d:	00 00                	add    %al,(%rax)
+  80506f:	00 ec                	add    %ch,%ah
+  805071:	0e                   	(bad)
+  805072:	80 00 00             	addb   $0x0,(%rax)
+  805075:	00 00                	add    %al,(%rax)
+  805077:	00 fc                	add    %bh,%ah
+  805079:	0e                   	(bad)
+  80507a:	80 00 00             	addb   $0x0,(%rax)
+  80507d:	00 00                	add    %al,(%rax)
+  80507f:	00 fc                	add    %bh,%ah
+  805081:	0e                   	(bad)
+  805082:	80 00 00             	addb   $0x0,(%rax)
+  805085:	00 00                	add    %al,(%rax)
+  805087:	00 fc                	add    %bh,%ah
+  805089:	0e                   	(bad)
+  80508a:	80 00 00             	addb   $0x0,(%rax)
+  80508d:	00 00                	add    %al,(%rax)
+  80508f:	00 fc                	add    %bh,%ah
+  805091:	0e                   	(bad)
+  805092:	80 00 00             	addb   $0x0,(%rax)
+  805095:	00 00                	add    %al,(%rax)
+  805097:	00 da                	add    %bl,%dl
+  805099:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  80509f:	00 fc                	add    %bh,%ah
+  8050a1:	0e                   	(bad)
+  8050a2:	80 00 00             	addb   $0x0,(%rax)
+  8050a5:	00 00                	add    %al,(%rax)
+  8050a7:	00 fc                	add    %bh,%ah
+  8050a9:	0e                   	(bad)
+  8050aa:	80 00 00             	addb   $0x0,(%rax)
+  8050ad:	00 00                	add    %al,(%rax)
+  8050af:	00 ce                	add    %cl,%dh
+  8050b1:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  8050b7:	00 48 09             	add    %cl,0x9(%rax)
+  8050ba:	80 00 00             	addb   $0x0,(%rax)
+  8050bd:	00 00                	add    %al,(%rax)
+  8050bf:	00 fc                	add    %bh,%ah
+  8050c1:	0e                   	(bad)
+  8050c2:	80 00 00             	addb   $0x0,(%rax)
+  8050c5:	00 00                	add    %al,(%rax)
+  8050c7:	00 ce                	add    %cl,%dh
+  8050c9:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  8050cf:	00 14 09             	add    %dl,(%rcx,%rcx,1)
+  8050d2:	80 00 00             	addb   $0x0,(%rax)
+  8050d5:	00 00                	add    %al,(%rax)
+  8050d7:	00 14 09             	add    %dl,(%rcx,%rcx,1)
+  8050da:	80 00 00             	addb   $0x0,(%rax)
+  8050dd:	00 00                	add    %al,(%rax)
+  8050df:	00 14 09             	add    %dl,(%rcx,%rcx,1)
+  8050e2:	80 00 00             	addb   $0x0,(%rax)
+  8050e5:	00 00                	add    %al,(%rax)
+  8050e7:	00 14 09             	add    %dl,(%rcx,%rcx,1)
+  8050ea:	80 00 00             	addb   $0x0,(%rax)
+  8050ed:	00 00                	add    %al,(%rax)
+  8050ef:	00 14 09             	add    %dl,(%rcx,%rcx,1)
+  8050f2:	80 00 00             	addb   $0x0,(%rax)
+  8050f5:	00 00                	add    %al,(%rax)
+  8050f7:	00 14 09             	add    %dl,(%rcx,%rcx,1)
+  8050fa:	80 00 00             	addb   $0x0,(%rax)
+  8050fd:	00 00                	add    %al,(%rax)
+  8050ff:	00 14 09             	add    %dl,(%rcx,%rcx,1)
+  805102:	80 00 00             	addb   $0x0,(%rax)
+  805105:	00 00                	add    %al,(%rax)
+  805107:	00 14 09             	add    %dl,(%rcx,%rcx,1)
+  80510a:	80 00 00             	addb   $0x0,(%rax)
+  80510d:	00 00                	add    %al,(%rax)
+  80510f:	00 14 09             	add    %dl,(%rcx,%rcx,1)
+  805112:	80 00 00             	addb   $0x0,(%rax)
+  805115:	00 00                	add    %al,(%rax)
+  805117:	00 fc                	add    %bh,%ah
+  805119:	0e                   	(bad)
+  80511a:	80 00 00             	addb   $0x0,(%rax)
+  80511d:	00 00                	add    %al,(%rax)
+  80511f:	00 fc                	add    %bh,%ah
+  805121:	0e                   	(bad)
+  805122:	80 00 00             	addb   $0x0,(%rax)
+  805125:	00 00                	add    %al,(%rax)
+  805127:	00 fc                	add    %bh,%ah
+  805129:	0e                   	(bad)
+  80512a:	80 00 00             	addb   $0x0,(%rax)
+  80512d:	00 00                	add    %al,(%rax)
+  80512f:	00 fc                	add    %bh,%ah
+  805131:	0e                   	(bad)
+  805132:	80 00 00             	addb   $0x0,(%rax)
+  805135:	00 00                	add    %al,(%rax)
+  805137:	00 fc                	add    %bh,%ah
+  805139:	0e                   	(bad)
+  80513a:	80 00 00             	addb   $0x0,(%rax)
+  80513d:	00 00                	add    %al,(%rax)
+  80513f:	00 fc                	add    %bh,%ah
+  805141:	0e                   	(bad)
+  805142:	80 00 00             	addb   $0x0,(%rax)
+  805145:	00 00                	add    %al,(%rax)
+  805147:	00 fc                	add    %bh,%ah
+  805149:	0e                   	(bad)
+  80514a:	80 00 00             	addb   $0x0,(%rax)
+  80514d:	00 00                	add    %al,(%rax)
+  80514f:	00 fc                	add    %bh,%ah
+  805151:	0e                   	(bad)
+  805152:	80 00 00             	addb   $0x0,(%rax)
+  805155:	00 00                	add    %al,(%rax)
+  805157:	00 fc                	add    %bh,%ah
+  805159:	0e                   	(bad)
+  80515a:	80 00 00             	addb   $0x0,(%rax)
+  80515d:	00 00                	add    %al,(%rax)
+  80515f:	00 fc                	add    %bh,%ah
+  805161:	0e                   	(bad)
+  805162:	80 00 00             	addb   $0x0,(%rax)
+  805165:	00 00                	add    %al,(%rax)
+  805167:	00 fc                	add    %bh,%ah
+  805169:	0e                   	(bad)
+  80516a:	80 00 00             	addb   $0x0,(%rax)
+  80516d:	00 00                	add    %al,(%rax)
+  80516f:	00 fc                	add    %bh,%ah
+  805171:	0e                   	(bad)
+  805172:	80 00 00             	addb   $0x0,(%rax)
+  805175:	00 00                	add    %al,(%rax)
+  805177:	00 fc                	add    %bh,%ah
+  805179:	0e                   	(bad)
+  80517a:	80 00 00             	addb   $0x0,(%rax)
+  80517d:	00 00                	add    %al,(%rax)
+  80517f:	00 fc                	add    %bh,%ah
+  805181:	0e                   	(bad)
+  805182:	80 00 00             	addb   $0x0,(%rax)
+  805185:	00 00                	add    %al,(%rax)
+  805187:	00 fc                	add    %bh,%ah
+  805189:	0e                   	(bad)
+  80518a:	80 00 00             	addb   $0x0,(%rax)
+  80518d:	00 00                	add    %al,(%rax)
+  80518f:	00 fc                	add    %bh,%ah
+  805191:	0e                   	(bad)
+  805192:	80 00 00             	addb   $0x0,(%rax)
+  805195:	00 00                	add    %al,(%rax)
+  805197:	00 fc                	add    %bh,%ah
+  805199:	0e                   	(bad)
+  80519a:	80 00 00             	addb   $0x0,(%rax)
+  80519d:	00 00                	add    %al,(%rax)
+  80519f:	00 fc                	add    %bh,%ah
+  8051a1:	0e                   	(bad)
+  8051a2:	80 00 00             	addb   $0x0,(%rax)
+  8051a5:	00 00                	add    %al,(%rax)
+  8051a7:	00 fc                	add    %bh,%ah
+  8051a9:	0e                   	(bad)
+  8051aa:	80 00 00             	addb   $0x0,(%rax)
+  8051ad:	00 00                	add    %al,(%rax)
+  8051af:	00 fc                	add    %bh,%ah
+  8051b1:	0e                   	(bad)
+  8051b2:	80 00 00             	addb   $0x0,(%rax)
+  8051b5:	00 00                	add    %al,(%rax)
+  8051b7:	00 fc                	add    %bh,%ah
+  8051b9:	0e                   	(bad)
+  8051ba:	80 00 00             	addb   $0x0,(%rax)
+  8051bd:	00 00                	add    %al,(%rax)
+  8051bf:	00 fc                	add    %bh,%ah
+  8051c1:	0e                   	(bad)
+  8051c2:	80 00 00             	addb   $0x0,(%rax)
+  8051c5:	00 00                	add    %al,(%rax)
+  8051c7:	00 fc                	add    %bh,%ah
+  8051c9:	0e                   	(bad)
+  8051ca:	80 00 00             	addb   $0x0,(%rax)
+  8051cd:	00 00                	add    %al,(%rax)
+  8051cf:	00 fc                	add    %bh,%ah
+  8051d1:	0e                   	(bad)
+  8051d2:	80 00 00             	addb   $0x0,(%rax)
+  8051d5:	00 00                	add    %al,(%rax)
+  8051d7:	00 fc                	add    %bh,%ah
+  8051d9:	0e                   	(bad)
+  8051da:	80 00 00             	addb   $0x0,(%rax)
+  8051dd:	00 00                	add    %al,(%rax)
+  8051df:	00 fc                	add    %bh,%ah
+  8051e1:	0e                   	(bad)
+  8051e2:	80 00 00             	addb   $0x0,(%rax)
+  8051e5:	00 00                	add    %al,(%rax)
+  8051e7:	00 fc                	add    %bh,%ah
+  8051e9:	0e                   	(bad)
+  8051ea:	80 00 00             	addb   $0x0,(%rax)
+  8051ed:	00 00                	add    %al,(%rax)
+  8051ef:	00 fc                	add    %bh,%ah
+  8051f1:	0e                   	(bad)
+  8051f2:	80 00 00             	addb   $0x0,(%rax)
+  8051f5:	00 00                	add    %al,(%rax)
+  8051f7:	00 fc                	add    %bh,%ah
+  8051f9:	0e                   	(bad)
+  8051fa:	80 00 00             	addb   $0x0,(%rax)
+  8051fd:	00 00                	add    %al,(%rax)
+  8051ff:	00 fc                	add    %bh,%ah
+  805201:	0e                   	(bad)
+  805202:	80 00 00             	addb   $0x0,(%rax)
+  805205:	00 00                	add    %al,(%rax)
+  805207:	00 1f                	add    %bl,(%rdi)
+  805209:	0e                   	(bad)
+  80520a:	80 00 00             	addb   $0x0,(%rax)
+  80520d:	00 00                	add    %al,(%rax)
+  80520f:	00 fc                	add    %bh,%ah
+  805211:	0e                   	(bad)
+  805212:	80 00 00             	addb   $0x0,(%rax)
+  805215:	00 00                	add    %al,(%rax)
+  805217:	00 fc                	add    %bh,%ah
+  805219:	0e                   	(bad)
+  80521a:	80 00 00             	addb   $0x0,(%rax)
+  80521d:	00 00                	add    %al,(%rax)
+  80521f:	00 fc                	add    %bh,%ah
+  805221:	0e                   	(bad)
+  805222:	80 00 00             	addb   $0x0,(%rax)
+  805225:	00 00                	add    %al,(%rax)
+  805227:	00 fc                	add    %bh,%ah
+  805229:	0e                   	(bad)
+  80522a:	80 00 00             	addb   $0x0,(%rax)
+  80522d:	00 00                	add    %al,(%rax)
+  80522f:	00 fc                	add    %bh,%ah
+  805231:	0e                   	(bad)
+  805232:	80 00 00             	addb   $0x0,(%rax)
+  805235:	00 00                	add    %al,(%rax)
+  805237:	00 fc                	add    %bh,%ah
+  805239:	0e                   	(bad)
+  80523a:	80 00 00             	addb   $0x0,(%rax)
+  80523d:	00 00                	add    %al,(%rax)
+  80523f:	00 fc                	add    %bh,%ah
+  805241:	0e                   	(bad)
+  805242:	80 00 00             	addb   $0x0,(%rax)
+  805245:	00 00                	add    %al,(%rax)
+  805247:	00 fc                	add    %bh,%ah
+  805249:	0e                   	(bad)
+  80524a:	80 00 00             	addb   $0x0,(%rax)
+  80524d:	00 00                	add    %al,(%rax)
+  80524f:	00 fc                	add    %bh,%ah
+  805251:	0e                   	(bad)
+  805252:	80 00 00             	addb   $0x0,(%rax)
+  805255:	00 00                	add    %al,(%rax)
+  805257:	00 fc                	add    %bh,%ah
+  805259:	0e                   	(bad)
+  80525a:	80 00 00             	addb   $0x0,(%rax)
+  80525d:	00 00                	add    %al,(%rax)
+  80525f:	00 6b 09             	add    %ch,0x9(%rbx)
+  805262:	80 00 00             	addb   $0x0,(%rax)
+  805265:	00 00                	add    %al,(%rax)
+  805267:	00 3a                	add    %bh,(%rdx)
+  805269:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  80526f:	00 fc                	add    %bh,%ah
+  805271:	0e                   	(bad)
+  805272:	80 00 00             	addb   $0x0,(%rax)
+  805275:	00 00                	add    %al,(%rax)
+  805277:	00 fc                	add    %bh,%ah
+  805279:	0e                   	(bad)
+  80527a:	80 00 00             	addb   $0x0,(%rax)
+  80527d:	00 00                	add    %al,(%rax)
+  80527f:	00 fc                	add    %bh,%ah
+  805281:	0e                   	(bad)
+  805282:	80 00 00             	addb   $0x0,(%rax)
+  805285:	00 00                	add    %al,(%rax)
+  805287:	00 fc                	add    %bh,%ah
+  805289:	0e                   	(bad)
+  80528a:	80 00 00             	addb   $0x0,(%rax)
+  80528d:	00 00                	add    %al,(%rax)
+  80528f:	00 9a 09 80 00 00    	add    %bl,0x8009(%rdx)
+  805295:	00 00                	add    %al,(%rax)
+  805297:	00 fc                	add    %bh,%ah
+  805299:	0e                   	(bad)
+  80529a:	80 00 00             	addb   $0x0,(%rax)
+  80529d:	00 00                	add    %al,(%rax)
+  80529f:	00 fc                	add    %bh,%ah
+  8052a1:	0e                   	(bad)
+  8052a2:	80 00 00             	addb   $0x0,(%rax)
+  8052a5:	00 00                	add    %al,(%rax)
+  8052a7:	00 60 09             	add    %ah,0x9(%rax)
+  8052aa:	80 00 00             	addb   $0x0,(%rax)
+  8052ad:	00 00                	add    %al,(%rax)
+  8052af:	00 fc                	add    %bh,%ah
+  8052b1:	0e                   	(bad)
+  8052b2:	80 00 00             	addb   $0x0,(%rax)
+  8052b5:	00 00                	add    %al,(%rax)
+  8052b7:	00 fc                	add    %bh,%ah
+  8052b9:	0e                   	(bad)
+  8052ba:	80 00 00             	addb   $0x0,(%rax)
+  8052bd:	00 00                	add    %al,(%rax)
+  8052bf:	00 e2                	add    %ah,%dl
+  8052c1:	0c 80                	or     $0x80,%al
+  8052c3:	00 00                	add    %al,(%rax)
+  8052c5:	00 00                	add    %al,(%rax)
+  8052c7:	00 ac 0d 80 00 00 00 	add    %ch,0x80(%rbp,%rcx,1)
+  8052ce:	00 00                	add    %al,(%rax)
+  8052d0:	fc                   	cld
+  8052d1:	0e                   	(bad)
+  8052d2:	80 00 00             	addb   $0x0,(%rax)
+  8052d5:	00 00                	add    %al,(%rax)
+  8052d7:	00 fc                	add    %bh,%ah
+  8052d9:	0e                   	(bad)
+  8052da:	80 00 00             	addb   $0x0,(%rax)
+  8052dd:	00 00                	add    %al,(%rax)
+  8052df:	00 31                	add    %dh,(%rcx)
+  8052e1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8052e7:	00 fc                	add    %bh,%ah
+  8052e9:	0e                   	(bad)
+  8052ea:	80 00 00             	addb   $0x0,(%rax)
+  8052ed:	00 00                	add    %al,(%rax)
+  8052ef:	00 0e                	add    %cl,(%rsi)
+  8052f1:	0c 80                	or     $0x80,%al
+  8052f3:	00 00                	add    %al,(%rax)
+  8052f5:	00 00                	add    %al,(%rax)
+  8052f7:	00 fc                	add    %bh,%ah
+  8052f9:	0e                   	(bad)
+  8052fa:	80 00 00             	addb   $0x0,(%rax)
+  8052fd:	00 00                	add    %al,(%rax)
+  8052ff:	00 fc                	add    %bh,%ah
+  805301:	0e                   	(bad)
+  805302:	80 00 00             	addb   $0x0,(%rax)
+  805305:	00 00                	add    %al,(%rax)
+  805307:	00 1f                	add    %bl,(%rdi)
+  805309:	0e                   	(bad)
+  80530a:	80 00 00             	addb   $0x0,(%rax)
+  80530d:	00 00                	add    %al,(%rax)
+  80530f:	00 fc                	add    %bh,%ah
+  805311:	0e                   	(bad)
+  805312:	80 00 00             	addb   $0x0,(%rax)
+  805315:	00 00                	add    %al,(%rax)
+  805317:	00 c4                	add    %al,%ah
+  805319:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+	...
+
+0000000000805320 <error_string>:
+	...
+  805328:	d5 4e 80 00 00 00 00 00 e7 4e 80 00 00 00 00 00     .N.......N......
+  805338:	f7 4e 80 00 00 00 00 00 09 4f 80 00 00 00 00 00     .N.......O......
+  805348:	17 4f 80 00 00 00 00 00 2b 4f 80 00 00 00 00 00     .O......+O......
+  805358:	40 4f 80 00 00 00 00 00 53 4f 80 00 00 00 00 00     @O......SO......
+  805368:	65 4f 80 00 00 00 00 00 79 4f 80 00 00 00 00 00     eO......yO......
+  805378:	89 4f 80 00 00 00 00 00 9c 4f 80 00 00 00 00 00     .O.......O......
+  805388:	b3 4f 80 00 00 00 00 00 c9 4f 80 00 00 00 00 00     .O.......O......
+  805398:	e1 4f 80 00 00 00 00 00 f9 4f 80 00 00 00 00 00     .O.......O......
+  8053a8:	06 50 80 00 00 00 00 00 d8 53 80 00 00 00 00 00     .P.......S......
+  8053b8:	1a 50 80 00 00 00 00 00 32 50 80 00 00 00 00 00     .P......2P......
+  8053c8:	3c 50 80 00 00 00 00 00 46 50 80 00 00 00 00 00     <P......FP......
+  8053d8:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  8053e8:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  8053f8:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  805408:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  805418:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 73 66 6f     ib/syscall.c.sfo
+  805428:	72 6b 28 29 20 69 73 20 6e 6f 74 20 69 6d 70 6c     rk() is not impl
+  805438:	65 6d 65 6e 74 65 64 00 6c 69 62 2f 66 6f 72 6b     emented.lib/fork
+  805448:	2e 63 00 0f 1f 44 00 00 5b 25 30 38 78 5d 20 75     .c...D..[%08x] u
+  805458:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  805468:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  805478:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  805488:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  805498:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  8054a8:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  8054b8:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  8054c8:	0a 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8054d8:	84 00 00 00 00 00 66 90                             ......f.
+
+00000000008054e0 <devtab>:
+  8054e0:	20 60 80 00 00 00 00 00 60 60 80 00 00 00 00 00      `......``......
+  8054f0:	a0 60 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .`..............
+  805500:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  805510:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  805520:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  805530:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  805540:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  805550:	3d 20 32 00 65 6e 76 69 64 20 21 3d 20 30 00 6c     = 2.envid != 0.l
+  805560:	69 62 2f 77 61 69 74 2e 63 00 3c 63 6f 6e 73 3e     ib/wait.c.<cons>
+  805570:	00 63 6f 6e 73 00 66 90 55 73 65 72 73 70 61 63     .cons.f.Userspac
+  805580:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  805590:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  8055a0:	65 72 72 3d 25 78 0a 00 6c 69 62 2f 70 67 66 61     err=%x..lib/pgfa
+  8055b0:	75 6c 74 2e 63 00 73 65 74 5f 70 67 66 61 75 6c     ult.c.set_pgfaul
+  8055c0:	74 5f 68 61 6e 64 6c 65 72 3a 20 25 69 00 5f 70     t_handler: %i._p
+  8055d0:	66 68 61 6e 64 6c 65 72 5f 69 6e 69 74 69 74 69     fhandler_inititi
+  8055e0:	61 6c 6c 69 7a 65 64 00 69 70 63 5f 73 65 6e 64     allized.ipc_send
+  8055f0:	20 65 72 72 6f 72 3a 20 25 69 0a 00 6c 69 62 2f      error: %i..lib/
+  805600:	69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00 00     ipc.c.f.........
+  805610:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805620:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805630:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805640:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805650:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805660:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805670:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805680:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805690:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8056a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8056b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8056c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8056d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8056e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8056f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805700:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805710:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805720:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805730:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805740:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805750:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805760:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805770:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805780:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805790:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8057a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8057b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8057c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8057d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8057e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8057f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805800:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805810:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805820:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805830:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805840:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805850:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805860:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805870:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805880:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805890:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8058a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8058b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8058c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8058d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8058e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8058f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805900:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805910:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805920:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805930:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805940:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805950:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805960:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805970:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805980:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805990:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8059a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8059b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8059c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8059d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8059e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8059f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805aa0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ab0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ac0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ad0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ae0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805af0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ba0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805bb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805bc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805bd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805be0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805bf0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ca0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805cb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805cc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805cd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ce0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805cf0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805da0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805db0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805dc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805dd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805de0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805df0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ea0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805eb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ec0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ed0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ee0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ef0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805fa0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805fb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805fc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805fd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805fe0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ff0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 40 00     ..f...........@.
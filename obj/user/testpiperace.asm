@@ -0,0 +1,8797 @@
+
+obj/user/testpiperace:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 3a 03 00 00       	call   80035d <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 28          	sub    $0x28,%rsp
+    int p[2], r, pid, i, max;
+    void *va;
+    struct Fd *fd;
+    const volatile struct Env *kid;
+
+    cprintf("testing for dup race...\n");
+  800036:	48 bf e0 4a 80 00 00 	movabs $0x804ae0,%rdi
+  80003d:	00 00 00 
+  800040:	b8 00 00 00 00       	mov    $0x0,%eax
+  800045:	48 ba 83 05 80 00 00 	movabs $0x800583,%rdx
+  80004c:	00 00 00 
+  80004f:	ff d2                	call   *%rdx
+    if ((r = pipe(p)) < 0)
+  800051:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  800055:	48 b8 dd 3f 80 00 00 	movabs $0x803fdd,%rax
+  80005c:	00 00 00 
+  80005f:	ff d0                	call   *%rax
+  800061:	85 c0                	test   %eax,%eax
+  800063:	0f 88 90 01 00 00    	js     8001f9 <umain+0x1d4>
+        panic("pipe: %i", r);
+    max = 200;
+    if ((r = fork()) < 0)
+  800069:	48 b8 3a 18 80 00 00 	movabs $0x80183a,%rax
+  800070:	00 00 00 
+  800073:	ff d0                	call   *%rax
+  800075:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  800078:	85 c0                	test   %eax,%eax
+  80007a:	0f 88 a6 01 00 00    	js     800226 <umain+0x201>
+        panic("fork: %i", r);
+    if (r == 0) {
+  800080:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+  800084:	0f 84 c9 01 00 00    	je     800253 <umain+0x22e>
+        }
+        /* do something to be not runnable besides exiting */
+        ipc_recv(0, 0, 0, 0);
+    }
+    pid = r;
+    cprintf("pid is %d\n", pid);
+  80008a:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+  80008d:	89 de                	mov    %ebx,%esi
+  80008f:	48 bf 3a 4b 80 00 00 	movabs $0x804b3a,%rdi
+  800096:	00 00 00 
+  800099:	b8 00 00 00 00       	mov    $0x0,%eax
+  80009e:	49 be 83 05 80 00 00 	movabs $0x800583,%r14
+  8000a5:	00 00 00 
+  8000a8:	41 ff d6             	call   *%r14
+    va = 0;
+    kid = &envs[ENVX(pid)];
+  8000ab:	41 89 dd             	mov    %ebx,%r13d
+  8000ae:	41 81 e5 ff 03 00 00 	and    $0x3ff,%r13d
+    cprintf("kid is %d\n", (int32_t)(kid - envs));
+  8000b5:	41 89 dc             	mov    %ebx,%r12d
+  8000b8:	41 81 e4 ff 03 00 00 	and    $0x3ff,%r12d
+  8000bf:	4c 89 e3             	mov    %r12,%rbx
+  8000c2:	48 c1 e3 04          	shl    $0x4,%rbx
+  8000c6:	48 89 de             	mov    %rbx,%rsi
+  8000c9:	4c 29 e6             	sub    %r12,%rsi
+  8000cc:	69 f6 ef ee ee ee    	imul   $0xeeeeeeef,%esi,%esi
+  8000d2:	48 bf 45 4b 80 00 00 	movabs $0x804b45,%rdi
+  8000d9:	00 00 00 
+  8000dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000e1:	41 ff d6             	call   *%r14
+    dup(p[0], 10);
+  8000e4:	be 0a 00 00 00       	mov    $0xa,%esi
+  8000e9:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  8000ec:	48 b8 6f 1d 80 00 00 	movabs $0x801d6f,%rax
+  8000f3:	00 00 00 
+  8000f6:	ff d0                	call   *%rax
+    while (kid->env_status == ENV_RUNNABLE)
+  8000f8:	4c 29 e3             	sub    %r12,%rbx
+  8000fb:	48 c1 e3 05          	shl    $0x5,%rbx
+  8000ff:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  800106:	00 00 00 
+  800109:	48 01 d8             	add    %rbx,%rax
+  80010c:	8b 80 d4 00 00 00    	mov    0xd4(%rax),%eax
+  800112:	83 f8 02             	cmp    $0x2,%eax
+  800115:	75 3e                	jne    800155 <umain+0x130>
+        dup(p[0], 10);
+  800117:	49 bc 6f 1d 80 00 00 	movabs $0x801d6f,%r12
+  80011e:	00 00 00 
+    while (kid->env_status == ENV_RUNNABLE)
+  800121:	4d 63 ed             	movslq %r13d,%r13
+  800124:	4c 89 e8             	mov    %r13,%rax
+  800127:	48 c1 e0 04          	shl    $0x4,%rax
+  80012b:	4c 29 e8             	sub    %r13,%rax
+  80012e:	48 c1 e0 05          	shl    $0x5,%rax
+  800132:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  800139:	00 00 00 
+  80013c:	48 01 c3             	add    %rax,%rbx
+        dup(p[0], 10);
+  80013f:	be 0a 00 00 00       	mov    $0xa,%esi
+  800144:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  800147:	41 ff d4             	call   *%r12
+    while (kid->env_status == ENV_RUNNABLE)
+  80014a:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+  800150:	83 f8 02             	cmp    $0x2,%eax
+  800153:	74 ea                	je     80013f <umain+0x11a>
+
+    cprintf("child done with loop\n");
+  800155:	48 bf 50 4b 80 00 00 	movabs $0x804b50,%rdi
+  80015c:	00 00 00 
+  80015f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800164:	48 ba 83 05 80 00 00 	movabs $0x800583,%rdx
+  80016b:	00 00 00 
+  80016e:	ff d2                	call   *%rdx
+    if (pipeisclosed(p[0]))
+  800170:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  800173:	48 b8 e9 41 80 00 00 	movabs $0x8041e9,%rax
+  80017a:	00 00 00 
+  80017d:	ff d0                	call   *%rax
+  80017f:	85 c0                	test   %eax,%eax
+  800181:	0f 85 5a 01 00 00    	jne    8002e1 <umain+0x2bc>
+        panic("somehow the other end of p[0] got closed!");
+    if ((r = fd_lookup(p[0], &fd)) < 0)
+  800187:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  80018b:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  80018e:	48 b8 af 1b 80 00 00 	movabs $0x801baf,%rax
+  800195:	00 00 00 
+  800198:	ff d0                	call   *%rax
+  80019a:	85 c0                	test   %eax,%eax
+  80019c:	0f 88 69 01 00 00    	js     80030b <umain+0x2e6>
+        panic("cannot look up p[0]: %i", r);
+    va = fd2data(fd);
+  8001a2:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8001a6:	48 b8 33 1b 80 00 00 	movabs $0x801b33,%rax
+  8001ad:	00 00 00 
+  8001b0:	ff d0                	call   *%rax
+  8001b2:	48 89 c7             	mov    %rax,%rdi
+    if (sys_region_refs(va, PAGE_SIZE) != 3 + 1)
+  8001b5:	be 00 10 00 00       	mov    $0x1000,%esi
+  8001ba:	48 b8 cc 13 80 00 00 	movabs $0x8013cc,%rax
+  8001c1:	00 00 00 
+  8001c4:	ff d0                	call   *%rax
+  8001c6:	83 f8 04             	cmp    $0x4,%eax
+  8001c9:	0f 84 69 01 00 00    	je     800338 <umain+0x313>
+        cprintf("\nchild detected race\n");
+  8001cf:	48 bf 7e 4b 80 00 00 	movabs $0x804b7e,%rdi
+  8001d6:	00 00 00 
+  8001d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001de:	48 ba 83 05 80 00 00 	movabs $0x800583,%rdx
+  8001e5:	00 00 00 
+  8001e8:	ff d2                	call   *%rdx
+    else
+        cprintf("\nrace didn't happen (number of tests: %d)\n", max);
+}
+  8001ea:	48 83 c4 28          	add    $0x28,%rsp
+  8001ee:	5b                   	pop    %rbx
+  8001ef:	41 5c                	pop    %r12
+  8001f1:	41 5d                	pop    %r13
+  8001f3:	41 5e                	pop    %r14
+  8001f5:	41 5f                	pop    %r15
+  8001f7:	5d                   	pop    %rbp
+  8001f8:	c3                   	ret
+        panic("pipe: %i", r);
+  8001f9:	89 c1                	mov    %eax,%ecx
+  8001fb:	48 ba f9 4a 80 00 00 	movabs $0x804af9,%rdx
+  800202:	00 00 00 
+  800205:	be 0c 00 00 00       	mov    $0xc,%esi
+  80020a:	48 bf 02 4b 80 00 00 	movabs $0x804b02,%rdi
+  800211:	00 00 00 
+  800214:	b8 00 00 00 00       	mov    $0x0,%eax
+  800219:	49 b8 33 04 80 00 00 	movabs $0x800433,%r8
+  800220:	00 00 00 
+  800223:	41 ff d0             	call   *%r8
+        panic("fork: %i", r);
+  800226:	89 c1                	mov    %eax,%ecx
+  800228:	48 ba 16 4b 80 00 00 	movabs $0x804b16,%rdx
+  80022f:	00 00 00 
+  800232:	be 0f 00 00 00       	mov    $0xf,%esi
+  800237:	48 bf 02 4b 80 00 00 	movabs $0x804b02,%rdi
+  80023e:	00 00 00 
+  800241:	b8 00 00 00 00       	mov    $0x0,%eax
+  800246:	49 b8 33 04 80 00 00 	movabs $0x800433,%r8
+  80024d:	00 00 00 
+  800250:	41 ff d0             	call   *%r8
+        close(p[1]);
+  800253:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  800256:	48 b8 14 1d 80 00 00 	movabs $0x801d14,%rax
+  80025d:	00 00 00 
+  800260:	ff d0                	call   *%rax
+  800262:	bb c8 00 00 00       	mov    $0xc8,%ebx
+            if (pipeisclosed(p[0])) {
+  800267:	49 bc e9 41 80 00 00 	movabs $0x8041e9,%r12
+  80026e:	00 00 00 
+                cprintf("RACE: pipe appears closed\n");
+  800271:	49 bf 1f 4b 80 00 00 	movabs $0x804b1f,%r15
+  800278:	00 00 00 
+  80027b:	49 be 83 05 80 00 00 	movabs $0x800583,%r14
+  800282:	00 00 00 
+                exit();
+  800285:	49 bd 10 04 80 00 00 	movabs $0x800410,%r13
+  80028c:	00 00 00 
+  80028f:	eb 11                	jmp    8002a2 <umain+0x27d>
+            sys_yield();
+  800291:	48 b8 a3 13 80 00 00 	movabs $0x8013a3,%rax
+  800298:	00 00 00 
+  80029b:	ff d0                	call   *%rax
+        for (i = 0; i < max; i++) {
+  80029d:	83 eb 01             	sub    $0x1,%ebx
+  8002a0:	74 1a                	je     8002bc <umain+0x297>
+            if (pipeisclosed(p[0])) {
+  8002a2:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  8002a5:	41 ff d4             	call   *%r12
+  8002a8:	85 c0                	test   %eax,%eax
+  8002aa:	74 e5                	je     800291 <umain+0x26c>
+                cprintf("RACE: pipe appears closed\n");
+  8002ac:	4c 89 ff             	mov    %r15,%rdi
+  8002af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002b4:	41 ff d6             	call   *%r14
+                exit();
+  8002b7:	41 ff d5             	call   *%r13
+  8002ba:	eb d5                	jmp    800291 <umain+0x26c>
+        ipc_recv(0, 0, 0, 0);
+  8002bc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8002c1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8002cb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002d0:	48 b8 48 1a 80 00 00 	movabs $0x801a48,%rax
+  8002d7:	00 00 00 
+  8002da:	ff d0                	call   *%rax
+  8002dc:	e9 a9 fd ff ff       	jmp    80008a <umain+0x65>
+        panic("somehow the other end of p[0] got closed!");
+  8002e1:	48 ba 98 4b 80 00 00 	movabs $0x804b98,%rdx
+  8002e8:	00 00 00 
+  8002eb:	be 38 00 00 00       	mov    $0x38,%esi
+  8002f0:	48 bf 02 4b 80 00 00 	movabs $0x804b02,%rdi
+  8002f7:	00 00 00 
+  8002fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002ff:	48 b9 33 04 80 00 00 	movabs $0x800433,%rcx
+  800306:	00 00 00 
+  800309:	ff d1                	call   *%rcx
+        panic("cannot look up p[0]: %i", r);
+  80030b:	89 c1                	mov    %eax,%ecx
+  80030d:	48 ba 66 4b 80 00 00 	movabs $0x804b66,%rdx
+  800314:	00 00 00 
+  800317:	be 3a 00 00 00       	mov    $0x3a,%esi
+  80031c:	48 bf 02 4b 80 00 00 	movabs $0x804b02,%rdi
+  800323:	00 00 00 
+  800326:	b8 00 00 00 00       	mov    $0x0,%eax
+  80032b:	49 b8 33 04 80 00 00 	movabs $0x800433,%r8
+  800332:	00 00 00 
+  800335:	41 ff d0             	call   *%r8
+        cprintf("\nrace didn't happen (number of tests: %d)\n", max);
+  800338:	be c8 00 00 00       	mov    $0xc8,%esi
+  80033d:	48 bf c8 4b 80 00 00 	movabs $0x804bc8,%rdi
+  800344:	00 00 00 
+  800347:	b8 00 00 00 00       	mov    $0x0,%eax
+  80034c:	48 ba 83 05 80 00 00 	movabs $0x800583,%rdx
+  800353:	00 00 00 
+  800356:	ff d2                	call   *%rdx
+}
+  800358:	e9 8d fe ff ff       	jmp    8001ea <umain+0x1c5>
+
+000000000080035d <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80035d:	55                   	push   %rbp
+  80035e:	48 89 e5             	mov    %rsp,%rbp
+  800361:	41 56                	push   %r14
+  800363:	41 55                	push   %r13
+  800365:	41 54                	push   %r12
+  800367:	53                   	push   %rbx
+  800368:	41 89 fd             	mov    %edi,%r13d
+  80036b:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80036e:	48 ba e0 60 80 00 00 	movabs $0x8060e0,%rdx
+  800375:	00 00 00 
+  800378:	48 b8 e0 60 80 00 00 	movabs $0x8060e0,%rax
+  80037f:	00 00 00 
+  800382:	48 39 c2             	cmp    %rax,%rdx
+  800385:	73 17                	jae    80039e <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800387:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80038a:	49 89 c4             	mov    %rax,%r12
+  80038d:	48 83 c3 08          	add    $0x8,%rbx
+  800391:	b8 00 00 00 00       	mov    $0x0,%eax
+  800396:	ff 53 f8             	call   *-0x8(%rbx)
+  800399:	4c 39 e3             	cmp    %r12,%rbx
+  80039c:	72 ef                	jb     80038d <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  80039e:	48 b8 7a 13 80 00 00 	movabs $0x80137a,%rax
+  8003a5:	00 00 00 
+  8003a8:	ff d0                	call   *%rax
+  8003aa:	89 c2                	mov    %eax,%edx
+  8003ac:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  8003b2:	48 89 d0             	mov    %rdx,%rax
+  8003b5:	48 c1 e0 04          	shl    $0x4,%rax
+  8003b9:	48 29 d0             	sub    %rdx,%rax
+  8003bc:	48 c1 e0 05          	shl    $0x5,%rax
+  8003c0:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8003c7:	00 00 00 
+  8003ca:	48 01 d0             	add    %rdx,%rax
+  8003cd:	48 a3 00 00 81 00 00 	movabs %rax,0x810000
+  8003d4:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8003d7:	45 85 ed             	test   %r13d,%r13d
+  8003da:	7e 0d                	jle    8003e9 <libmain+0x8c>
+  8003dc:	49 8b 06             	mov    (%r14),%rax
+  8003df:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8003e6:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8003e9:	4c 89 f6             	mov    %r14,%rsi
+  8003ec:	44 89 ef             	mov    %r13d,%edi
+  8003ef:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8003f6:	00 00 00 
+  8003f9:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8003fb:	48 b8 10 04 80 00 00 	movabs $0x800410,%rax
+  800402:	00 00 00 
+  800405:	ff d0                	call   *%rax
+#endif
+}
+  800407:	5b                   	pop    %rbx
+  800408:	41 5c                	pop    %r12
+  80040a:	41 5d                	pop    %r13
+  80040c:	41 5e                	pop    %r14
+  80040e:	5d                   	pop    %rbp
+  80040f:	c3                   	ret
+
+0000000000800410 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800410:	55                   	push   %rbp
+  800411:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800414:	48 b8 47 1d 80 00 00 	movabs $0x801d47,%rax
+  80041b:	00 00 00 
+  80041e:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800420:	bf 00 00 00 00       	mov    $0x0,%edi
+  800425:	48 b8 17 13 80 00 00 	movabs $0x801317,%rax
+  80042c:	00 00 00 
+  80042f:	ff d0                	call   *%rax
+}
+  800431:	5d                   	pop    %rbp
+  800432:	c3                   	ret
+
+0000000000800433 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800433:	55                   	push   %rbp
+  800434:	48 89 e5             	mov    %rsp,%rbp
+  800437:	41 56                	push   %r14
+  800439:	41 55                	push   %r13
+  80043b:	41 54                	push   %r12
+  80043d:	53                   	push   %rbx
+  80043e:	48 83 ec 50          	sub    $0x50,%rsp
+  800442:	49 89 fc             	mov    %rdi,%r12
+  800445:	41 89 f5             	mov    %esi,%r13d
+  800448:	48 89 d3             	mov    %rdx,%rbx
+  80044b:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80044f:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800453:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800457:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80045e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800462:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800466:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80046a:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80046e:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800475:	00 00 00 
+  800478:	4c 8b 30             	mov    (%rax),%r14
+  80047b:	48 b8 7a 13 80 00 00 	movabs $0x80137a,%rax
+  800482:	00 00 00 
+  800485:	ff d0                	call   *%rax
+  800487:	89 c6                	mov    %eax,%esi
+  800489:	45 89 e8             	mov    %r13d,%r8d
+  80048c:	4c 89 e1             	mov    %r12,%rcx
+  80048f:	4c 89 f2             	mov    %r14,%rdx
+  800492:	48 bf 00 4c 80 00 00 	movabs $0x804c00,%rdi
+  800499:	00 00 00 
+  80049c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004a1:	49 bc 83 05 80 00 00 	movabs $0x800583,%r12
+  8004a8:	00 00 00 
+  8004ab:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8004ae:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8004b2:	48 89 df             	mov    %rbx,%rdi
+  8004b5:	48 b8 1f 05 80 00 00 	movabs $0x80051f,%rax
+  8004bc:	00 00 00 
+  8004bf:	ff d0                	call   *%rax
+    cprintf("\n");
+  8004c1:	48 bf f7 4a 80 00 00 	movabs $0x804af7,%rdi
+  8004c8:	00 00 00 
+  8004cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004d0:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8004d3:	cc                   	int3
+  8004d4:	eb fd                	jmp    8004d3 <_panic+0xa0>
+
+00000000008004d6 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8004d6:	55                   	push   %rbp
+  8004d7:	48 89 e5             	mov    %rsp,%rbp
+  8004da:	53                   	push   %rbx
+  8004db:	48 83 ec 08          	sub    $0x8,%rsp
+  8004df:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8004e2:	8b 06                	mov    (%rsi),%eax
+  8004e4:	8d 50 01             	lea    0x1(%rax),%edx
+  8004e7:	89 16                	mov    %edx,(%rsi)
+  8004e9:	48 98                	cltq
+  8004eb:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8004f0:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8004f6:	74 0a                	je     800502 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8004f8:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8004fc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800500:	c9                   	leave
+  800501:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800502:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800506:	be ff 00 00 00       	mov    $0xff,%esi
+  80050b:	48 b8 cf 12 80 00 00 	movabs $0x8012cf,%rax
+  800512:	00 00 00 
+  800515:	ff d0                	call   *%rax
+        state->offset = 0;
+  800517:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80051d:	eb d9                	jmp    8004f8 <putch+0x22>
+
+000000000080051f <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80051f:	55                   	push   %rbp
+  800520:	48 89 e5             	mov    %rsp,%rbp
+  800523:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80052a:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80052d:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800534:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800539:	b8 00 00 00 00       	mov    $0x0,%eax
+  80053e:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800541:	48 89 f1             	mov    %rsi,%rcx
+  800544:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80054b:	48 bf d6 04 80 00 00 	movabs $0x8004d6,%rdi
+  800552:	00 00 00 
+  800555:	48 b8 d3 06 80 00 00 	movabs $0x8006d3,%rax
+  80055c:	00 00 00 
+  80055f:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800561:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800568:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80056f:	48 b8 cf 12 80 00 00 	movabs $0x8012cf,%rax
+  800576:	00 00 00 
+  800579:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80057b:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800581:	c9                   	leave
+  800582:	c3                   	ret
+
+0000000000800583 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800583:	55                   	push   %rbp
+  800584:	48 89 e5             	mov    %rsp,%rbp
+  800587:	48 83 ec 50          	sub    $0x50,%rsp
+  80058b:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80058f:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800593:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800597:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80059b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80059f:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8005a6:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8005aa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005ae:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8005b2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8005b6:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8005ba:	48 b8 1f 05 80 00 00 	movabs $0x80051f,%rax
+  8005c1:	00 00 00 
+  8005c4:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8005c6:	c9                   	leave
+  8005c7:	c3                   	ret
+
+00000000008005c8 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8005c8:	55                   	push   %rbp
+  8005c9:	48 89 e5             	mov    %rsp,%rbp
+  8005cc:	41 57                	push   %r15
+  8005ce:	41 56                	push   %r14
+  8005d0:	41 55                	push   %r13
+  8005d2:	41 54                	push   %r12
+  8005d4:	53                   	push   %rbx
+  8005d5:	48 83 ec 18          	sub    $0x18,%rsp
+  8005d9:	49 89 fc             	mov    %rdi,%r12
+  8005dc:	49 89 f5             	mov    %rsi,%r13
+  8005df:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8005e3:	8b 45 10             	mov    0x10(%rbp),%eax
+  8005e6:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8005e9:	41 89 cf             	mov    %ecx,%r15d
+  8005ec:	4c 39 fa             	cmp    %r15,%rdx
+  8005ef:	73 5b                	jae    80064c <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8005f1:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8005f5:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8005f9:	85 db                	test   %ebx,%ebx
+  8005fb:	7e 0e                	jle    80060b <print_num+0x43>
+            putch(padc, put_arg);
+  8005fd:	4c 89 ee             	mov    %r13,%rsi
+  800600:	44 89 f7             	mov    %r14d,%edi
+  800603:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800606:	83 eb 01             	sub    $0x1,%ebx
+  800609:	75 f2                	jne    8005fd <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80060b:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80060f:	48 b9 34 4c 80 00 00 	movabs $0x804c34,%rcx
+  800616:	00 00 00 
+  800619:	48 b8 23 4c 80 00 00 	movabs $0x804c23,%rax
+  800620:	00 00 00 
+  800623:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800627:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80062b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800630:	49 f7 f7             	div    %r15
+  800633:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800637:	4c 89 ee             	mov    %r13,%rsi
+  80063a:	41 ff d4             	call   *%r12
+}
+  80063d:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800641:	5b                   	pop    %rbx
+  800642:	41 5c                	pop    %r12
+  800644:	41 5d                	pop    %r13
+  800646:	41 5e                	pop    %r14
+  800648:	41 5f                	pop    %r15
+  80064a:	5d                   	pop    %rbp
+  80064b:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80064c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800650:	ba 00 00 00 00       	mov    $0x0,%edx
+  800655:	49 f7 f7             	div    %r15
+  800658:	48 83 ec 08          	sub    $0x8,%rsp
+  80065c:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800660:	52                   	push   %rdx
+  800661:	45 0f be c9          	movsbl %r9b,%r9d
+  800665:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800669:	48 89 c2             	mov    %rax,%rdx
+  80066c:	48 b8 c8 05 80 00 00 	movabs $0x8005c8,%rax
+  800673:	00 00 00 
+  800676:	ff d0                	call   *%rax
+  800678:	48 83 c4 10          	add    $0x10,%rsp
+  80067c:	eb 8d                	jmp    80060b <print_num+0x43>
+
+000000000080067e <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80067e:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800682:	48 8b 06             	mov    (%rsi),%rax
+  800685:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800689:	73 0a                	jae    800695 <sprintputch+0x17>
+        *state->start++ = ch;
+  80068b:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80068f:	48 89 16             	mov    %rdx,(%rsi)
+  800692:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800695:	c3                   	ret
+
+0000000000800696 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800696:	55                   	push   %rbp
+  800697:	48 89 e5             	mov    %rsp,%rbp
+  80069a:	48 83 ec 50          	sub    $0x50,%rsp
+  80069e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8006a2:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8006a6:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8006aa:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8006b1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8006b5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006b9:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8006bd:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8006c1:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8006c5:	48 b8 d3 06 80 00 00 	movabs $0x8006d3,%rax
+  8006cc:	00 00 00 
+  8006cf:	ff d0                	call   *%rax
+}
+  8006d1:	c9                   	leave
+  8006d2:	c3                   	ret
+
+00000000008006d3 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8006d3:	55                   	push   %rbp
+  8006d4:	48 89 e5             	mov    %rsp,%rbp
+  8006d7:	41 57                	push   %r15
+  8006d9:	41 56                	push   %r14
+  8006db:	41 55                	push   %r13
+  8006dd:	41 54                	push   %r12
+  8006df:	53                   	push   %rbx
+  8006e0:	48 83 ec 38          	sub    $0x38,%rsp
+  8006e4:	49 89 fe             	mov    %rdi,%r14
+  8006e7:	49 89 f5             	mov    %rsi,%r13
+  8006ea:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8006ed:	48 8b 01             	mov    (%rcx),%rax
+  8006f0:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8006f4:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8006f8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006fc:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800700:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800704:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800708:	0f b6 3b             	movzbl (%rbx),%edi
+  80070b:	40 80 ff 25          	cmp    $0x25,%dil
+  80070f:	74 18                	je     800729 <vprintfmt+0x56>
+            if (!ch) return;
+  800711:	40 84 ff             	test   %dil,%dil
+  800714:	0f 84 b1 06 00 00    	je     800dcb <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80071a:	40 0f b6 ff          	movzbl %dil,%edi
+  80071e:	4c 89 ee             	mov    %r13,%rsi
+  800721:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800724:	4c 89 e3             	mov    %r12,%rbx
+  800727:	eb db                	jmp    800704 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800729:	be 00 00 00 00       	mov    $0x0,%esi
+  80072e:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800732:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800737:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80073d:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800744:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800748:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80074d:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800752:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800755:	83 e8 23             	sub    $0x23,%eax
+  800758:	3c 57                	cmp    $0x57,%al
+  80075a:	0f 87 51 06 00 00    	ja     800db1 <vprintfmt+0x6de>
+  800760:	0f b6 c0             	movzbl %al,%eax
+  800763:	48 b9 e0 4d 80 00 00 	movabs $0x804de0,%rcx
+  80076a:	00 00 00 
+  80076d:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800770:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800773:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800777:	eb cf                	jmp    800748 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800779:	49 89 dc             	mov    %rbx,%r12
+  80077c:	be 01 00 00 00       	mov    $0x1,%esi
+  800781:	eb c5                	jmp    800748 <vprintfmt+0x75>
+            padc = ch;
+  800783:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800787:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80078a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80078d:	eb b9                	jmp    800748 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80078f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800792:	83 f8 2f             	cmp    $0x2f,%eax
+  800795:	77 24                	ja     8007bb <vprintfmt+0xe8>
+  800797:	89 c1                	mov    %eax,%ecx
+  800799:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  80079d:	83 c0 08             	add    $0x8,%eax
+  8007a0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007a3:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8007a6:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8007a9:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8007ad:	79 99                	jns    800748 <vprintfmt+0x75>
+                width = precision;
+  8007af:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8007b3:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8007b9:	eb 8d                	jmp    800748 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8007bb:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8007bf:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8007c3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007c7:	eb da                	jmp    8007a3 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8007c9:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8007ce:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8007d2:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8007d8:	3c 39                	cmp    $0x39,%al
+  8007da:	77 1c                	ja     8007f8 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8007dc:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8007e0:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8007e4:	0f b6 c0             	movzbl %al,%eax
+  8007e7:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8007ec:	0f b6 03             	movzbl (%rbx),%eax
+  8007ef:	3c 39                	cmp    $0x39,%al
+  8007f1:	76 e9                	jbe    8007dc <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8007f3:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8007f6:	eb b1                	jmp    8007a9 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8007f8:	49 89 dc             	mov    %rbx,%r12
+  8007fb:	eb ac                	jmp    8007a9 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8007fd:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800800:	85 c9                	test   %ecx,%ecx
+  800802:	b8 00 00 00 00       	mov    $0x0,%eax
+  800807:	0f 49 c1             	cmovns %ecx,%eax
+  80080a:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80080d:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800810:	e9 33 ff ff ff       	jmp    800748 <vprintfmt+0x75>
+            lflag++;
+  800815:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800818:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80081b:	e9 28 ff ff ff       	jmp    800748 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800820:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800823:	83 f8 2f             	cmp    $0x2f,%eax
+  800826:	77 19                	ja     800841 <vprintfmt+0x16e>
+  800828:	89 c2                	mov    %eax,%edx
+  80082a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80082e:	83 c0 08             	add    $0x8,%eax
+  800831:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800834:	8b 3a                	mov    (%rdx),%edi
+  800836:	4c 89 ee             	mov    %r13,%rsi
+  800839:	41 ff d6             	call   *%r14
+            break;
+  80083c:	e9 c3 fe ff ff       	jmp    800704 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800841:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800845:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800849:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80084d:	eb e5                	jmp    800834 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80084f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800852:	83 f8 2f             	cmp    $0x2f,%eax
+  800855:	77 5a                	ja     8008b1 <vprintfmt+0x1de>
+  800857:	89 c2                	mov    %eax,%edx
+  800859:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80085d:	83 c0 08             	add    $0x8,%eax
+  800860:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800863:	8b 02                	mov    (%rdx),%eax
+  800865:	89 c1                	mov    %eax,%ecx
+  800867:	f7 d9                	neg    %ecx
+  800869:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80086c:	83 f9 16             	cmp    $0x16,%ecx
+  80086f:	7f 4e                	jg     8008bf <vprintfmt+0x1ec>
+  800871:	48 63 c1             	movslq %ecx,%rax
+  800874:	48 ba a0 50 80 00 00 	movabs $0x8050a0,%rdx
+  80087b:	00 00 00 
+  80087e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800882:	48 85 c0             	test   %rax,%rax
+  800885:	74 38                	je     8008bf <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800887:	48 89 c1             	mov    %rax,%rcx
+  80088a:	48 ba b9 52 80 00 00 	movabs $0x8052b9,%rdx
+  800891:	00 00 00 
+  800894:	4c 89 ee             	mov    %r13,%rsi
+  800897:	4c 89 f7             	mov    %r14,%rdi
+  80089a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80089f:	49 b8 96 06 80 00 00 	movabs $0x800696,%r8
+  8008a6:	00 00 00 
+  8008a9:	41 ff d0             	call   *%r8
+  8008ac:	e9 53 fe ff ff       	jmp    800704 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8008b1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008b5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008b9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008bd:	eb a4                	jmp    800863 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8008bf:	48 ba 4c 4c 80 00 00 	movabs $0x804c4c,%rdx
+  8008c6:	00 00 00 
+  8008c9:	4c 89 ee             	mov    %r13,%rsi
+  8008cc:	4c 89 f7             	mov    %r14,%rdi
+  8008cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d4:	49 b8 96 06 80 00 00 	movabs $0x800696,%r8
+  8008db:	00 00 00 
+  8008de:	41 ff d0             	call   *%r8
+  8008e1:	e9 1e fe ff ff       	jmp    800704 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8008e6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008e9:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ec:	77 6c                	ja     80095a <vprintfmt+0x287>
+  8008ee:	89 c2                	mov    %eax,%edx
+  8008f0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008f4:	83 c0 08             	add    $0x8,%eax
+  8008f7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008fa:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8008fd:	48 85 d2             	test   %rdx,%rdx
+  800900:	48 b8 45 4c 80 00 00 	movabs $0x804c45,%rax
+  800907:	00 00 00 
+  80090a:	48 0f 45 c2          	cmovne %rdx,%rax
+  80090e:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800912:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800916:	7e 06                	jle    80091e <vprintfmt+0x24b>
+  800918:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80091c:	75 4a                	jne    800968 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80091e:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800922:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800926:	0f b6 00             	movzbl (%rax),%eax
+  800929:	84 c0                	test   %al,%al
+  80092b:	0f 85 9a 00 00 00    	jne    8009cb <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800931:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800934:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800938:	85 c0                	test   %eax,%eax
+  80093a:	0f 8e c4 fd ff ff    	jle    800704 <vprintfmt+0x31>
+  800940:	4c 89 ee             	mov    %r13,%rsi
+  800943:	bf 20 00 00 00       	mov    $0x20,%edi
+  800948:	41 ff d6             	call   *%r14
+  80094b:	41 83 ec 01          	sub    $0x1,%r12d
+  80094f:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800953:	75 eb                	jne    800940 <vprintfmt+0x26d>
+  800955:	e9 aa fd ff ff       	jmp    800704 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80095a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80095e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800962:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800966:	eb 92                	jmp    8008fa <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800968:	49 63 f7             	movslq %r15d,%rsi
+  80096b:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80096f:	48 b8 85 0e 80 00 00 	movabs $0x800e85,%rax
+  800976:	00 00 00 
+  800979:	ff d0                	call   *%rax
+  80097b:	48 89 c2             	mov    %rax,%rdx
+  80097e:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800981:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800983:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800986:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800989:	85 c0                	test   %eax,%eax
+  80098b:	7e 91                	jle    80091e <vprintfmt+0x24b>
+  80098d:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800992:	4c 89 ee             	mov    %r13,%rsi
+  800995:	44 89 e7             	mov    %r12d,%edi
+  800998:	41 ff d6             	call   *%r14
+  80099b:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80099f:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8009a2:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8009a5:	75 eb                	jne    800992 <vprintfmt+0x2bf>
+  8009a7:	e9 72 ff ff ff       	jmp    80091e <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8009ac:	0f b6 f8             	movzbl %al,%edi
+  8009af:	4c 89 ee             	mov    %r13,%rsi
+  8009b2:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8009b5:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8009b9:	49 83 c4 01          	add    $0x1,%r12
+  8009bd:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8009c3:	84 c0                	test   %al,%al
+  8009c5:	0f 84 66 ff ff ff    	je     800931 <vprintfmt+0x25e>
+  8009cb:	45 85 ff             	test   %r15d,%r15d
+  8009ce:	78 0a                	js     8009da <vprintfmt+0x307>
+  8009d0:	41 83 ef 01          	sub    $0x1,%r15d
+  8009d4:	0f 88 57 ff ff ff    	js     800931 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8009da:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8009de:	74 cc                	je     8009ac <vprintfmt+0x2d9>
+  8009e0:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8009e3:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8009e8:	80 fa 5e             	cmp    $0x5e,%dl
+  8009eb:	77 c2                	ja     8009af <vprintfmt+0x2dc>
+  8009ed:	eb bd                	jmp    8009ac <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8009ef:	40 84 f6             	test   %sil,%sil
+  8009f2:	75 26                	jne    800a1a <vprintfmt+0x347>
+    switch (lflag) {
+  8009f4:	85 d2                	test   %edx,%edx
+  8009f6:	74 59                	je     800a51 <vprintfmt+0x37e>
+  8009f8:	83 fa 01             	cmp    $0x1,%edx
+  8009fb:	74 7b                	je     800a78 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8009fd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a00:	83 f8 2f             	cmp    $0x2f,%eax
+  800a03:	0f 87 96 00 00 00    	ja     800a9f <vprintfmt+0x3cc>
+  800a09:	89 c2                	mov    %eax,%edx
+  800a0b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a0f:	83 c0 08             	add    $0x8,%eax
+  800a12:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a15:	4c 8b 22             	mov    (%rdx),%r12
+  800a18:	eb 17                	jmp    800a31 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800a1a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a1d:	83 f8 2f             	cmp    $0x2f,%eax
+  800a20:	77 21                	ja     800a43 <vprintfmt+0x370>
+  800a22:	89 c2                	mov    %eax,%edx
+  800a24:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a28:	83 c0 08             	add    $0x8,%eax
+  800a2b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a2e:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800a31:	4d 85 e4             	test   %r12,%r12
+  800a34:	78 7a                	js     800ab0 <vprintfmt+0x3dd>
+            num = i;
+  800a36:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800a39:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800a3e:	e9 50 02 00 00       	jmp    800c93 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a43:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a47:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a4b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a4f:	eb dd                	jmp    800a2e <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800a51:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a54:	83 f8 2f             	cmp    $0x2f,%eax
+  800a57:	77 11                	ja     800a6a <vprintfmt+0x397>
+  800a59:	89 c2                	mov    %eax,%edx
+  800a5b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a5f:	83 c0 08             	add    $0x8,%eax
+  800a62:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a65:	4c 63 22             	movslq (%rdx),%r12
+  800a68:	eb c7                	jmp    800a31 <vprintfmt+0x35e>
+  800a6a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a6e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a72:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a76:	eb ed                	jmp    800a65 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800a78:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a7b:	83 f8 2f             	cmp    $0x2f,%eax
+  800a7e:	77 11                	ja     800a91 <vprintfmt+0x3be>
+  800a80:	89 c2                	mov    %eax,%edx
+  800a82:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a86:	83 c0 08             	add    $0x8,%eax
+  800a89:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a8c:	4c 8b 22             	mov    (%rdx),%r12
+  800a8f:	eb a0                	jmp    800a31 <vprintfmt+0x35e>
+  800a91:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a95:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a99:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a9d:	eb ed                	jmp    800a8c <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800a9f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aa3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aa7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aab:	e9 65 ff ff ff       	jmp    800a15 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800ab0:	4c 89 ee             	mov    %r13,%rsi
+  800ab3:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800ab8:	41 ff d6             	call   *%r14
+                i = -i;
+  800abb:	49 f7 dc             	neg    %r12
+  800abe:	e9 73 ff ff ff       	jmp    800a36 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800ac3:	40 84 f6             	test   %sil,%sil
+  800ac6:	75 32                	jne    800afa <vprintfmt+0x427>
+    switch (lflag) {
+  800ac8:	85 d2                	test   %edx,%edx
+  800aca:	74 5d                	je     800b29 <vprintfmt+0x456>
+  800acc:	83 fa 01             	cmp    $0x1,%edx
+  800acf:	0f 84 82 00 00 00    	je     800b57 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800ad5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ad8:	83 f8 2f             	cmp    $0x2f,%eax
+  800adb:	0f 87 a5 00 00 00    	ja     800b86 <vprintfmt+0x4b3>
+  800ae1:	89 c2                	mov    %eax,%edx
+  800ae3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ae7:	83 c0 08             	add    $0x8,%eax
+  800aea:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aed:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800af0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800af5:	e9 99 01 00 00       	jmp    800c93 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800afa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800afd:	83 f8 2f             	cmp    $0x2f,%eax
+  800b00:	77 19                	ja     800b1b <vprintfmt+0x448>
+  800b02:	89 c2                	mov    %eax,%edx
+  800b04:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b08:	83 c0 08             	add    $0x8,%eax
+  800b0b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b0e:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b11:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b16:	e9 78 01 00 00       	jmp    800c93 <vprintfmt+0x5c0>
+  800b1b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b1f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b23:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b27:	eb e5                	jmp    800b0e <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800b29:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b2c:	83 f8 2f             	cmp    $0x2f,%eax
+  800b2f:	77 18                	ja     800b49 <vprintfmt+0x476>
+  800b31:	89 c2                	mov    %eax,%edx
+  800b33:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b37:	83 c0 08             	add    $0x8,%eax
+  800b3a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b3d:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800b3f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800b44:	e9 4a 01 00 00       	jmp    800c93 <vprintfmt+0x5c0>
+  800b49:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b4d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b51:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b55:	eb e6                	jmp    800b3d <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800b57:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b5a:	83 f8 2f             	cmp    $0x2f,%eax
+  800b5d:	77 19                	ja     800b78 <vprintfmt+0x4a5>
+  800b5f:	89 c2                	mov    %eax,%edx
+  800b61:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b65:	83 c0 08             	add    $0x8,%eax
+  800b68:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b6b:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b6e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800b73:	e9 1b 01 00 00       	jmp    800c93 <vprintfmt+0x5c0>
+  800b78:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b7c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b80:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b84:	eb e5                	jmp    800b6b <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800b86:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b8a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b8e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b92:	e9 56 ff ff ff       	jmp    800aed <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800b97:	40 84 f6             	test   %sil,%sil
+  800b9a:	75 2e                	jne    800bca <vprintfmt+0x4f7>
+    switch (lflag) {
+  800b9c:	85 d2                	test   %edx,%edx
+  800b9e:	74 59                	je     800bf9 <vprintfmt+0x526>
+  800ba0:	83 fa 01             	cmp    $0x1,%edx
+  800ba3:	74 7f                	je     800c24 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800ba5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ba8:	83 f8 2f             	cmp    $0x2f,%eax
+  800bab:	0f 87 9f 00 00 00    	ja     800c50 <vprintfmt+0x57d>
+  800bb1:	89 c2                	mov    %eax,%edx
+  800bb3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bb7:	83 c0 08             	add    $0x8,%eax
+  800bba:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bbd:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800bc0:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800bc5:	e9 c9 00 00 00       	jmp    800c93 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800bca:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bcd:	83 f8 2f             	cmp    $0x2f,%eax
+  800bd0:	77 19                	ja     800beb <vprintfmt+0x518>
+  800bd2:	89 c2                	mov    %eax,%edx
+  800bd4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bd8:	83 c0 08             	add    $0x8,%eax
+  800bdb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bde:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800be1:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800be6:	e9 a8 00 00 00       	jmp    800c93 <vprintfmt+0x5c0>
+  800beb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bef:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bf3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bf7:	eb e5                	jmp    800bde <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800bf9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bfc:	83 f8 2f             	cmp    $0x2f,%eax
+  800bff:	77 15                	ja     800c16 <vprintfmt+0x543>
+  800c01:	89 c2                	mov    %eax,%edx
+  800c03:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c07:	83 c0 08             	add    $0x8,%eax
+  800c0a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c0d:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800c0f:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800c14:	eb 7d                	jmp    800c93 <vprintfmt+0x5c0>
+  800c16:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c1a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c1e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c22:	eb e9                	jmp    800c0d <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800c24:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c27:	83 f8 2f             	cmp    $0x2f,%eax
+  800c2a:	77 16                	ja     800c42 <vprintfmt+0x56f>
+  800c2c:	89 c2                	mov    %eax,%edx
+  800c2e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c32:	83 c0 08             	add    $0x8,%eax
+  800c35:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c38:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800c3b:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800c40:	eb 51                	jmp    800c93 <vprintfmt+0x5c0>
+  800c42:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c46:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c4a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c4e:	eb e8                	jmp    800c38 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800c50:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c54:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c58:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c5c:	e9 5c ff ff ff       	jmp    800bbd <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800c61:	4c 89 ee             	mov    %r13,%rsi
+  800c64:	bf 30 00 00 00       	mov    $0x30,%edi
+  800c69:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800c6c:	4c 89 ee             	mov    %r13,%rsi
+  800c6f:	bf 78 00 00 00       	mov    $0x78,%edi
+  800c74:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800c77:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c7a:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7d:	77 47                	ja     800cc6 <vprintfmt+0x5f3>
+  800c7f:	89 c2                	mov    %eax,%edx
+  800c81:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c85:	83 c0 08             	add    $0x8,%eax
+  800c88:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c8b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c8e:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800c93:	48 83 ec 08          	sub    $0x8,%rsp
+  800c97:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800c9b:	0f 94 c0             	sete   %al
+  800c9e:	0f b6 c0             	movzbl %al,%eax
+  800ca1:	50                   	push   %rax
+  800ca2:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800ca7:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800cab:	4c 89 ee             	mov    %r13,%rsi
+  800cae:	4c 89 f7             	mov    %r14,%rdi
+  800cb1:	48 b8 c8 05 80 00 00 	movabs $0x8005c8,%rax
+  800cb8:	00 00 00 
+  800cbb:	ff d0                	call   *%rax
+            break;
+  800cbd:	48 83 c4 10          	add    $0x10,%rsp
+  800cc1:	e9 3e fa ff ff       	jmp    800704 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800cc6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cca:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cce:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cd2:	eb b7                	jmp    800c8b <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800cd4:	40 84 f6             	test   %sil,%sil
+  800cd7:	75 2b                	jne    800d04 <vprintfmt+0x631>
+    switch (lflag) {
+  800cd9:	85 d2                	test   %edx,%edx
+  800cdb:	74 56                	je     800d33 <vprintfmt+0x660>
+  800cdd:	83 fa 01             	cmp    $0x1,%edx
+  800ce0:	74 7f                	je     800d61 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800ce2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ce5:	83 f8 2f             	cmp    $0x2f,%eax
+  800ce8:	0f 87 a2 00 00 00    	ja     800d90 <vprintfmt+0x6bd>
+  800cee:	89 c2                	mov    %eax,%edx
+  800cf0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cf4:	83 c0 08             	add    $0x8,%eax
+  800cf7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cfa:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800cfd:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800d02:	eb 8f                	jmp    800c93 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800d04:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d07:	83 f8 2f             	cmp    $0x2f,%eax
+  800d0a:	77 19                	ja     800d25 <vprintfmt+0x652>
+  800d0c:	89 c2                	mov    %eax,%edx
+  800d0e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d12:	83 c0 08             	add    $0x8,%eax
+  800d15:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d18:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d1b:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800d20:	e9 6e ff ff ff       	jmp    800c93 <vprintfmt+0x5c0>
+  800d25:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d29:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d2d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d31:	eb e5                	jmp    800d18 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800d33:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d36:	83 f8 2f             	cmp    $0x2f,%eax
+  800d39:	77 18                	ja     800d53 <vprintfmt+0x680>
+  800d3b:	89 c2                	mov    %eax,%edx
+  800d3d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d41:	83 c0 08             	add    $0x8,%eax
+  800d44:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d47:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800d49:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800d4e:	e9 40 ff ff ff       	jmp    800c93 <vprintfmt+0x5c0>
+  800d53:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d57:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d5b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d5f:	eb e6                	jmp    800d47 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800d61:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d64:	83 f8 2f             	cmp    $0x2f,%eax
+  800d67:	77 19                	ja     800d82 <vprintfmt+0x6af>
+  800d69:	89 c2                	mov    %eax,%edx
+  800d6b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d6f:	83 c0 08             	add    $0x8,%eax
+  800d72:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d75:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d78:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800d7d:	e9 11 ff ff ff       	jmp    800c93 <vprintfmt+0x5c0>
+  800d82:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d86:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d8a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d8e:	eb e5                	jmp    800d75 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800d90:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d94:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d98:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d9c:	e9 59 ff ff ff       	jmp    800cfa <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800da1:	4c 89 ee             	mov    %r13,%rsi
+  800da4:	bf 25 00 00 00       	mov    $0x25,%edi
+  800da9:	41 ff d6             	call   *%r14
+            break;
+  800dac:	e9 53 f9 ff ff       	jmp    800704 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800db1:	4c 89 ee             	mov    %r13,%rsi
+  800db4:	bf 25 00 00 00       	mov    $0x25,%edi
+  800db9:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800dbc:	48 83 eb 01          	sub    $0x1,%rbx
+  800dc0:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800dc4:	75 f6                	jne    800dbc <vprintfmt+0x6e9>
+  800dc6:	e9 39 f9 ff ff       	jmp    800704 <vprintfmt+0x31>
+}
+  800dcb:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800dcf:	5b                   	pop    %rbx
+  800dd0:	41 5c                	pop    %r12
+  800dd2:	41 5d                	pop    %r13
+  800dd4:	41 5e                	pop    %r14
+  800dd6:	41 5f                	pop    %r15
+  800dd8:	5d                   	pop    %rbp
+  800dd9:	c3                   	ret
+
+0000000000800dda <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800dda:	55                   	push   %rbp
+  800ddb:	48 89 e5             	mov    %rsp,%rbp
+  800dde:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800de2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800de6:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800deb:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800def:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800df6:	48 85 ff             	test   %rdi,%rdi
+  800df9:	74 2b                	je     800e26 <vsnprintf+0x4c>
+  800dfb:	48 85 f6             	test   %rsi,%rsi
+  800dfe:	74 26                	je     800e26 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800e00:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800e04:	48 bf 7e 06 80 00 00 	movabs $0x80067e,%rdi
+  800e0b:	00 00 00 
+  800e0e:	48 b8 d3 06 80 00 00 	movabs $0x8006d3,%rax
+  800e15:	00 00 00 
+  800e18:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800e1a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e1e:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800e21:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800e24:	c9                   	leave
+  800e25:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800e26:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e2b:	eb f7                	jmp    800e24 <vsnprintf+0x4a>
+
+0000000000800e2d <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800e2d:	55                   	push   %rbp
+  800e2e:	48 89 e5             	mov    %rsp,%rbp
+  800e31:	48 83 ec 50          	sub    $0x50,%rsp
+  800e35:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800e39:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800e3d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800e41:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800e48:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800e4c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e50:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800e54:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800e58:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800e5c:	48 b8 da 0d 80 00 00 	movabs $0x800dda,%rax
+  800e63:	00 00 00 
+  800e66:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800e68:	c9                   	leave
+  800e69:	c3                   	ret
+
+0000000000800e6a <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800e6a:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800e6d:	74 10                	je     800e7f <strlen+0x15>
+    size_t n = 0;
+  800e6f:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800e74:	48 83 c0 01          	add    $0x1,%rax
+  800e78:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800e7c:	75 f6                	jne    800e74 <strlen+0xa>
+  800e7e:	c3                   	ret
+    size_t n = 0;
+  800e7f:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800e84:	c3                   	ret
+
+0000000000800e85 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800e85:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800e88:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800e8d:	48 85 f6             	test   %rsi,%rsi
+  800e90:	74 11                	je     800ea3 <strnlen+0x1e>
+  800e92:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800e96:	74 0c                	je     800ea4 <strnlen+0x1f>
+  800e98:	48 83 c2 01          	add    $0x1,%rdx
+  800e9c:	48 39 d0             	cmp    %rdx,%rax
+  800e9f:	75 f1                	jne    800e92 <strnlen+0xd>
+  800ea1:	eb 04                	jmp    800ea7 <strnlen+0x22>
+  800ea3:	c3                   	ret
+  800ea4:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800ea7:	c3                   	ret
+
+0000000000800ea8 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800ea8:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800eab:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eb0:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800eb4:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800eb7:	48 83 c2 01          	add    $0x1,%rdx
+  800ebb:	84 c9                	test   %cl,%cl
+  800ebd:	75 f1                	jne    800eb0 <strcpy+0x8>
+        ;
+    return res;
+}
+  800ebf:	c3                   	ret
+
+0000000000800ec0 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800ec0:	55                   	push   %rbp
+  800ec1:	48 89 e5             	mov    %rsp,%rbp
+  800ec4:	41 54                	push   %r12
+  800ec6:	53                   	push   %rbx
+  800ec7:	48 89 fb             	mov    %rdi,%rbx
+  800eca:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800ecd:	48 b8 6a 0e 80 00 00 	movabs $0x800e6a,%rax
+  800ed4:	00 00 00 
+  800ed7:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800ed9:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800edd:	4c 89 e6             	mov    %r12,%rsi
+  800ee0:	48 b8 a8 0e 80 00 00 	movabs $0x800ea8,%rax
+  800ee7:	00 00 00 
+  800eea:	ff d0                	call   *%rax
+    return dst;
+}
+  800eec:	48 89 d8             	mov    %rbx,%rax
+  800eef:	5b                   	pop    %rbx
+  800ef0:	41 5c                	pop    %r12
+  800ef2:	5d                   	pop    %rbp
+  800ef3:	c3                   	ret
+
+0000000000800ef4 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800ef4:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800ef7:	48 85 d2             	test   %rdx,%rdx
+  800efa:	74 1f                	je     800f1b <strncpy+0x27>
+  800efc:	48 01 fa             	add    %rdi,%rdx
+  800eff:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800f02:	48 83 c1 01          	add    $0x1,%rcx
+  800f06:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800f0a:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800f0e:	41 80 f8 01          	cmp    $0x1,%r8b
+  800f12:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800f16:	48 39 ca             	cmp    %rcx,%rdx
+  800f19:	75 e7                	jne    800f02 <strncpy+0xe>
+    }
+    return ret;
+}
+  800f1b:	c3                   	ret
+
+0000000000800f1c <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800f1c:	48 89 f8             	mov    %rdi,%rax
+  800f1f:	48 85 d2             	test   %rdx,%rdx
+  800f22:	74 24                	je     800f48 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800f24:	48 83 ea 01          	sub    $0x1,%rdx
+  800f28:	74 1b                	je     800f45 <strlcpy+0x29>
+  800f2a:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800f2e:	0f b6 16             	movzbl (%rsi),%edx
+  800f31:	84 d2                	test   %dl,%dl
+  800f33:	74 10                	je     800f45 <strlcpy+0x29>
+            *dst++ = *src++;
+  800f35:	48 83 c6 01          	add    $0x1,%rsi
+  800f39:	48 83 c0 01          	add    $0x1,%rax
+  800f3d:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800f40:	48 39 c8             	cmp    %rcx,%rax
+  800f43:	75 e9                	jne    800f2e <strlcpy+0x12>
+        *dst = '\0';
+  800f45:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800f48:	48 29 f8             	sub    %rdi,%rax
+}
+  800f4b:	c3                   	ret
+
+0000000000800f4c <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800f4c:	0f b6 07             	movzbl (%rdi),%eax
+  800f4f:	84 c0                	test   %al,%al
+  800f51:	74 13                	je     800f66 <strcmp+0x1a>
+  800f53:	38 06                	cmp    %al,(%rsi)
+  800f55:	75 0f                	jne    800f66 <strcmp+0x1a>
+  800f57:	48 83 c7 01          	add    $0x1,%rdi
+  800f5b:	48 83 c6 01          	add    $0x1,%rsi
+  800f5f:	0f b6 07             	movzbl (%rdi),%eax
+  800f62:	84 c0                	test   %al,%al
+  800f64:	75 ed                	jne    800f53 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f66:	0f b6 c0             	movzbl %al,%eax
+  800f69:	0f b6 16             	movzbl (%rsi),%edx
+  800f6c:	29 d0                	sub    %edx,%eax
+}
+  800f6e:	c3                   	ret
+
+0000000000800f6f <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800f6f:	48 85 d2             	test   %rdx,%rdx
+  800f72:	74 1f                	je     800f93 <strncmp+0x24>
+  800f74:	0f b6 07             	movzbl (%rdi),%eax
+  800f77:	84 c0                	test   %al,%al
+  800f79:	74 1e                	je     800f99 <strncmp+0x2a>
+  800f7b:	3a 06                	cmp    (%rsi),%al
+  800f7d:	75 1a                	jne    800f99 <strncmp+0x2a>
+  800f7f:	48 83 c7 01          	add    $0x1,%rdi
+  800f83:	48 83 c6 01          	add    $0x1,%rsi
+  800f87:	48 83 ea 01          	sub    $0x1,%rdx
+  800f8b:	75 e7                	jne    800f74 <strncmp+0x5>
+
+    if (!n) return 0;
+  800f8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f92:	c3                   	ret
+  800f93:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f98:	c3                   	ret
+  800f99:	48 85 d2             	test   %rdx,%rdx
+  800f9c:	74 09                	je     800fa7 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f9e:	0f b6 07             	movzbl (%rdi),%eax
+  800fa1:	0f b6 16             	movzbl (%rsi),%edx
+  800fa4:	29 d0                	sub    %edx,%eax
+  800fa6:	c3                   	ret
+    if (!n) return 0;
+  800fa7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fac:	c3                   	ret
+
+0000000000800fad <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800fad:	0f b6 17             	movzbl (%rdi),%edx
+  800fb0:	84 d2                	test   %dl,%dl
+  800fb2:	74 18                	je     800fcc <strchr+0x1f>
+        if (*str == c) {
+  800fb4:	0f be d2             	movsbl %dl,%edx
+  800fb7:	39 f2                	cmp    %esi,%edx
+  800fb9:	74 17                	je     800fd2 <strchr+0x25>
+    for (; *str; str++) {
+  800fbb:	48 83 c7 01          	add    $0x1,%rdi
+  800fbf:	0f b6 17             	movzbl (%rdi),%edx
+  800fc2:	84 d2                	test   %dl,%dl
+  800fc4:	75 ee                	jne    800fb4 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800fc6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fcb:	c3                   	ret
+  800fcc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fd1:	c3                   	ret
+  800fd2:	48 89 f8             	mov    %rdi,%rax
+}
+  800fd5:	c3                   	ret
+
+0000000000800fd6 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800fd6:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800fd9:	0f b6 17             	movzbl (%rdi),%edx
+  800fdc:	84 d2                	test   %dl,%dl
+  800fde:	74 13                	je     800ff3 <strfind+0x1d>
+  800fe0:	0f be d2             	movsbl %dl,%edx
+  800fe3:	39 f2                	cmp    %esi,%edx
+  800fe5:	74 0b                	je     800ff2 <strfind+0x1c>
+  800fe7:	48 83 c0 01          	add    $0x1,%rax
+  800feb:	0f b6 10             	movzbl (%rax),%edx
+  800fee:	84 d2                	test   %dl,%dl
+  800ff0:	75 ee                	jne    800fe0 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800ff2:	c3                   	ret
+  800ff3:	c3                   	ret
+
+0000000000800ff4 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800ff4:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800ff7:	48 89 f8             	mov    %rdi,%rax
+  800ffa:	48 f7 d8             	neg    %rax
+  800ffd:	83 e0 07             	and    $0x7,%eax
+  801000:	49 89 d1             	mov    %rdx,%r9
+  801003:	49 29 c1             	sub    %rax,%r9
+  801006:	78 36                	js     80103e <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  801008:	40 0f b6 c6          	movzbl %sil,%eax
+  80100c:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  801013:	01 01 01 
+  801016:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  80101a:	40 f6 c7 07          	test   $0x7,%dil
+  80101e:	75 38                	jne    801058 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  801020:	4c 89 c9             	mov    %r9,%rcx
+  801023:	48 c1 f9 03          	sar    $0x3,%rcx
+  801027:	74 0c                	je     801035 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  801029:	fc                   	cld
+  80102a:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  80102d:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  801031:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  801035:	4d 85 c9             	test   %r9,%r9
+  801038:	75 45                	jne    80107f <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  80103a:	4c 89 c0             	mov    %r8,%rax
+  80103d:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  80103e:	48 85 d2             	test   %rdx,%rdx
+  801041:	74 f7                	je     80103a <memset+0x46>
+  801043:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  801046:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  801049:	48 83 c0 01          	add    $0x1,%rax
+  80104d:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  801051:	48 39 c2             	cmp    %rax,%rdx
+  801054:	75 f3                	jne    801049 <memset+0x55>
+  801056:	eb e2                	jmp    80103a <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  801058:	40 f6 c7 01          	test   $0x1,%dil
+  80105c:	74 06                	je     801064 <memset+0x70>
+  80105e:	88 07                	mov    %al,(%rdi)
+  801060:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801064:	40 f6 c7 02          	test   $0x2,%dil
+  801068:	74 07                	je     801071 <memset+0x7d>
+  80106a:	66 89 07             	mov    %ax,(%rdi)
+  80106d:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801071:	40 f6 c7 04          	test   $0x4,%dil
+  801075:	74 a9                	je     801020 <memset+0x2c>
+  801077:	89 07                	mov    %eax,(%rdi)
+  801079:	48 83 c7 04          	add    $0x4,%rdi
+  80107d:	eb a1                	jmp    801020 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80107f:	41 f6 c1 04          	test   $0x4,%r9b
+  801083:	74 06                	je     80108b <memset+0x97>
+  801085:	89 07                	mov    %eax,(%rdi)
+  801087:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80108b:	41 f6 c1 02          	test   $0x2,%r9b
+  80108f:	74 07                	je     801098 <memset+0xa4>
+  801091:	66 89 07             	mov    %ax,(%rdi)
+  801094:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  801098:	41 f6 c1 01          	test   $0x1,%r9b
+  80109c:	74 9c                	je     80103a <memset+0x46>
+  80109e:	88 07                	mov    %al,(%rdi)
+  8010a0:	eb 98                	jmp    80103a <memset+0x46>
+
+00000000008010a2 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8010a2:	48 89 f8             	mov    %rdi,%rax
+  8010a5:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8010a8:	48 39 fe             	cmp    %rdi,%rsi
+  8010ab:	73 3b                	jae    8010e8 <memmove+0x46>
+  8010ad:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8010b1:	48 39 d7             	cmp    %rdx,%rdi
+  8010b4:	73 32                	jae    8010e8 <memmove+0x46>
+        s += n;
+        d += n;
+  8010b6:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8010ba:	48 89 d6             	mov    %rdx,%rsi
+  8010bd:	48 09 fe             	or     %rdi,%rsi
+  8010c0:	48 09 ce             	or     %rcx,%rsi
+  8010c3:	40 f6 c6 07          	test   $0x7,%sil
+  8010c7:	75 12                	jne    8010db <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8010c9:	48 83 ef 08          	sub    $0x8,%rdi
+  8010cd:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8010d1:	48 c1 e9 03          	shr    $0x3,%rcx
+  8010d5:	fd                   	std
+  8010d6:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8010d9:	fc                   	cld
+  8010da:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8010db:	48 83 ef 01          	sub    $0x1,%rdi
+  8010df:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8010e3:	fd                   	std
+  8010e4:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8010e6:	eb f1                	jmp    8010d9 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8010e8:	48 89 f2             	mov    %rsi,%rdx
+  8010eb:	48 09 c2             	or     %rax,%rdx
+  8010ee:	48 09 ca             	or     %rcx,%rdx
+  8010f1:	f6 c2 07             	test   $0x7,%dl
+  8010f4:	75 0c                	jne    801102 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8010f6:	48 c1 e9 03          	shr    $0x3,%rcx
+  8010fa:	48 89 c7             	mov    %rax,%rdi
+  8010fd:	fc                   	cld
+  8010fe:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801101:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801102:	48 89 c7             	mov    %rax,%rdi
+  801105:	fc                   	cld
+  801106:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801108:	c3                   	ret
+
+0000000000801109 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801109:	55                   	push   %rbp
+  80110a:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  80110d:	48 b8 a2 10 80 00 00 	movabs $0x8010a2,%rax
+  801114:	00 00 00 
+  801117:	ff d0                	call   *%rax
+}
+  801119:	5d                   	pop    %rbp
+  80111a:	c3                   	ret
+
+000000000080111b <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80111b:	55                   	push   %rbp
+  80111c:	48 89 e5             	mov    %rsp,%rbp
+  80111f:	41 57                	push   %r15
+  801121:	41 56                	push   %r14
+  801123:	41 55                	push   %r13
+  801125:	41 54                	push   %r12
+  801127:	53                   	push   %rbx
+  801128:	48 83 ec 08          	sub    $0x8,%rsp
+  80112c:	49 89 fe             	mov    %rdi,%r14
+  80112f:	49 89 f7             	mov    %rsi,%r15
+  801132:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801135:	48 89 f7             	mov    %rsi,%rdi
+  801138:	48 b8 6a 0e 80 00 00 	movabs $0x800e6a,%rax
+  80113f:	00 00 00 
+  801142:	ff d0                	call   *%rax
+  801144:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801147:	48 89 de             	mov    %rbx,%rsi
+  80114a:	4c 89 f7             	mov    %r14,%rdi
+  80114d:	48 b8 85 0e 80 00 00 	movabs $0x800e85,%rax
+  801154:	00 00 00 
+  801157:	ff d0                	call   *%rax
+  801159:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80115c:	48 39 c3             	cmp    %rax,%rbx
+  80115f:	74 36                	je     801197 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801161:	48 89 d8             	mov    %rbx,%rax
+  801164:	4c 29 e8             	sub    %r13,%rax
+  801167:	49 39 c4             	cmp    %rax,%r12
+  80116a:	73 31                	jae    80119d <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80116c:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801171:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801175:	4c 89 fe             	mov    %r15,%rsi
+  801178:	48 b8 09 11 80 00 00 	movabs $0x801109,%rax
+  80117f:	00 00 00 
+  801182:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801184:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801188:	48 83 c4 08          	add    $0x8,%rsp
+  80118c:	5b                   	pop    %rbx
+  80118d:	41 5c                	pop    %r12
+  80118f:	41 5d                	pop    %r13
+  801191:	41 5e                	pop    %r14
+  801193:	41 5f                	pop    %r15
+  801195:	5d                   	pop    %rbp
+  801196:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801197:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80119b:	eb eb                	jmp    801188 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  80119d:	48 83 eb 01          	sub    $0x1,%rbx
+  8011a1:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8011a5:	48 89 da             	mov    %rbx,%rdx
+  8011a8:	4c 89 fe             	mov    %r15,%rsi
+  8011ab:	48 b8 09 11 80 00 00 	movabs $0x801109,%rax
+  8011b2:	00 00 00 
+  8011b5:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8011b7:	49 01 de             	add    %rbx,%r14
+  8011ba:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8011bf:	eb c3                	jmp    801184 <strlcat+0x69>
+
+00000000008011c1 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8011c1:	48 85 d2             	test   %rdx,%rdx
+  8011c4:	74 2d                	je     8011f3 <memcmp+0x32>
+  8011c6:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8011cb:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8011cf:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8011d4:	44 38 c1             	cmp    %r8b,%cl
+  8011d7:	75 0f                	jne    8011e8 <memcmp+0x27>
+    while (n-- > 0) {
+  8011d9:	48 83 c0 01          	add    $0x1,%rax
+  8011dd:	48 39 c2             	cmp    %rax,%rdx
+  8011e0:	75 e9                	jne    8011cb <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8011e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011e7:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8011e8:	0f b6 c1             	movzbl %cl,%eax
+  8011eb:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8011ef:	44 29 c0             	sub    %r8d,%eax
+  8011f2:	c3                   	ret
+    return 0;
+  8011f3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011f8:	c3                   	ret
+
+00000000008011f9 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8011f9:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8011fd:	48 39 c7             	cmp    %rax,%rdi
+  801200:	73 0f                	jae    801211 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801202:	40 38 37             	cmp    %sil,(%rdi)
+  801205:	74 0e                	je     801215 <memfind+0x1c>
+    for (; src < end; src++) {
+  801207:	48 83 c7 01          	add    $0x1,%rdi
+  80120b:	48 39 f8             	cmp    %rdi,%rax
+  80120e:	75 f2                	jne    801202 <memfind+0x9>
+  801210:	c3                   	ret
+  801211:	48 89 f8             	mov    %rdi,%rax
+  801214:	c3                   	ret
+  801215:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801218:	c3                   	ret
+
+0000000000801219 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801219:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80121c:	0f b6 37             	movzbl (%rdi),%esi
+  80121f:	40 80 fe 20          	cmp    $0x20,%sil
+  801223:	74 06                	je     80122b <strtol+0x12>
+  801225:	40 80 fe 09          	cmp    $0x9,%sil
+  801229:	75 13                	jne    80123e <strtol+0x25>
+  80122b:	48 83 c7 01          	add    $0x1,%rdi
+  80122f:	0f b6 37             	movzbl (%rdi),%esi
+  801232:	40 80 fe 20          	cmp    $0x20,%sil
+  801236:	74 f3                	je     80122b <strtol+0x12>
+  801238:	40 80 fe 09          	cmp    $0x9,%sil
+  80123c:	74 ed                	je     80122b <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80123e:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801241:	83 e0 fd             	and    $0xfffffffd,%eax
+  801244:	3c 01                	cmp    $0x1,%al
+  801246:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80124a:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801250:	75 0f                	jne    801261 <strtol+0x48>
+  801252:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801255:	74 14                	je     80126b <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801257:	85 d2                	test   %edx,%edx
+  801259:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80125e:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801261:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801266:	4c 63 ca             	movslq %edx,%r9
+  801269:	eb 36                	jmp    8012a1 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80126b:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80126f:	74 0f                	je     801280 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801271:	85 d2                	test   %edx,%edx
+  801273:	75 ec                	jne    801261 <strtol+0x48>
+        s++;
+  801275:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801279:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80127e:	eb e1                	jmp    801261 <strtol+0x48>
+        s += 2;
+  801280:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801284:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801289:	eb d6                	jmp    801261 <strtol+0x48>
+            dig -= '0';
+  80128b:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80128e:	44 0f b6 c1          	movzbl %cl,%r8d
+  801292:	41 39 d0             	cmp    %edx,%r8d
+  801295:	7d 21                	jge    8012b8 <strtol+0x9f>
+        val = val * base + dig;
+  801297:	49 0f af c1          	imul   %r9,%rax
+  80129b:	0f b6 c9             	movzbl %cl,%ecx
+  80129e:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8012a1:	48 83 c7 01          	add    $0x1,%rdi
+  8012a5:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8012a9:	80 f9 39             	cmp    $0x39,%cl
+  8012ac:	76 dd                	jbe    80128b <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8012ae:	80 f9 7b             	cmp    $0x7b,%cl
+  8012b1:	77 05                	ja     8012b8 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8012b3:	83 e9 57             	sub    $0x57,%ecx
+  8012b6:	eb d6                	jmp    80128e <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8012b8:	4d 85 d2             	test   %r10,%r10
+  8012bb:	74 03                	je     8012c0 <strtol+0xa7>
+  8012bd:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8012c0:	48 89 c2             	mov    %rax,%rdx
+  8012c3:	48 f7 da             	neg    %rdx
+  8012c6:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8012ca:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8012ce:	c3                   	ret
+
+00000000008012cf <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  8012cf:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8012d4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012d9:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8012df:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8012e5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  8012eb:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8012ed:	c3                   	ret
+
+00000000008012ee <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  8012ee:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8012f3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8012f8:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8012fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  801302:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801308:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80130e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801314:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801316:	c3                   	ret
+
+0000000000801317 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801317:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80131a:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80131f:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801324:	ba 00 00 00 00       	mov    $0x0,%edx
+  801329:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80132f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801335:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80133b:	0f 05                	syscall
+    if (check && ret > 0) {
+  80133d:	48 85 c0             	test   %rax,%rax
+  801340:	7f 01                	jg     801343 <sys_env_destroy+0x2c>
+}
+  801342:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  801343:	55                   	push   %rbp
+  801344:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801347:	49 89 c0             	mov    %rax,%r8
+  80134a:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80134f:	48 ba 78 51 80 00 00 	movabs $0x805178,%rdx
+  801356:	00 00 00 
+  801359:	be 29 00 00 00       	mov    $0x29,%esi
+  80135e:	48 bf 97 51 80 00 00 	movabs $0x805197,%rdi
+  801365:	00 00 00 
+  801368:	b8 00 00 00 00       	mov    $0x0,%eax
+  80136d:	49 b9 33 04 80 00 00 	movabs $0x800433,%r9
+  801374:	00 00 00 
+  801377:	41 ff d1             	call   *%r9
+
+000000000080137a <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  80137a:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80137f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801384:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801389:	ba 00 00 00 00       	mov    $0x0,%edx
+  80138e:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801394:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80139a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013a0:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8013a2:	c3                   	ret
+
+00000000008013a3 <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  8013a3:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8013a8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8013ad:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8013b2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013b7:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013bd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013c3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013c9:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8013cb:	c3                   	ret
+
+00000000008013cc <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  8013cc:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8013d1:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  8013d8:	00 00 00 
+  8013db:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013e1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013e7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013ed:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8013ef:	c3                   	ret
+
+00000000008013f0 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8013f0:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  8013f3:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013f8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013fe:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801404:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801406:	c3                   	ret
+
+0000000000801407 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801407:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80140a:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80140f:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801412:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801418:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80141e:	0f 05                	syscall
+    if (check && ret > 0) {
+  801420:	48 85 c0             	test   %rax,%rax
+  801423:	7f 01                	jg     801426 <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801425:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801426:	55                   	push   %rbp
+  801427:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80142a:	49 89 c0             	mov    %rax,%r8
+  80142d:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801432:	48 ba 78 51 80 00 00 	movabs $0x805178,%rdx
+  801439:	00 00 00 
+  80143c:	be 29 00 00 00       	mov    $0x29,%esi
+  801441:	48 bf 97 51 80 00 00 	movabs $0x805197,%rdi
+  801448:	00 00 00 
+  80144b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801450:	49 b9 33 04 80 00 00 	movabs $0x800433,%r9
+  801457:	00 00 00 
+  80145a:	41 ff d1             	call   *%r9
+
+000000000080145d <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80145d:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801460:	48 63 d2             	movslq %edx,%rdx
+  801463:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801466:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80146b:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  80146e:	0f 05                	syscall
+    if (check && ret > 0) {
+  801470:	48 85 c0             	test   %rax,%rax
+  801473:	7f 01                	jg     801476 <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801475:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801476:	55                   	push   %rbp
+  801477:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80147a:	49 89 c0             	mov    %rax,%r8
+  80147d:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801482:	48 ba 78 51 80 00 00 	movabs $0x805178,%rdx
+  801489:	00 00 00 
+  80148c:	be 29 00 00 00       	mov    $0x29,%esi
+  801491:	48 bf 97 51 80 00 00 	movabs $0x805197,%rdi
+  801498:	00 00 00 
+  80149b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014a0:	49 b9 33 04 80 00 00 	movabs $0x800433,%r9
+  8014a7:	00 00 00 
+  8014aa:	41 ff d1             	call   *%r9
+
+00000000008014ad <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8014ad:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8014b0:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8014b5:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014bb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014c1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8014c7:	0f 05                	syscall
+    if (check && ret > 0) {
+  8014c9:	48 85 c0             	test   %rax,%rax
+  8014cc:	7f 01                	jg     8014cf <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8014ce:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8014cf:	55                   	push   %rbp
+  8014d0:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014d3:	49 89 c0             	mov    %rax,%r8
+  8014d6:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8014db:	48 ba 78 51 80 00 00 	movabs $0x805178,%rdx
+  8014e2:	00 00 00 
+  8014e5:	be 29 00 00 00       	mov    $0x29,%esi
+  8014ea:	48 bf 97 51 80 00 00 	movabs $0x805197,%rdi
+  8014f1:	00 00 00 
+  8014f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014f9:	49 b9 33 04 80 00 00 	movabs $0x800433,%r9
+  801500:	00 00 00 
+  801503:	41 ff d1             	call   *%r9
+
+0000000000801506 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801506:	48 63 f6             	movslq %esi,%rsi
+  801509:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80150c:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801511:	ba 00 00 00 00       	mov    $0x0,%edx
+  801516:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80151c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801522:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801528:	0f 05                	syscall
+    if (check && ret > 0) {
+  80152a:	48 85 c0             	test   %rax,%rax
+  80152d:	7f 01                	jg     801530 <sys_env_set_status+0x2a>
+}
+  80152f:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  801530:	55                   	push   %rbp
+  801531:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801534:	49 89 c0             	mov    %rax,%r8
+  801537:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80153c:	48 ba 78 51 80 00 00 	movabs $0x805178,%rdx
+  801543:	00 00 00 
+  801546:	be 29 00 00 00       	mov    $0x29,%esi
+  80154b:	48 bf 97 51 80 00 00 	movabs $0x805197,%rdi
+  801552:	00 00 00 
+  801555:	b8 00 00 00 00       	mov    $0x0,%eax
+  80155a:	49 b9 33 04 80 00 00 	movabs $0x800433,%r9
+  801561:	00 00 00 
+  801564:	41 ff d1             	call   *%r9
+
+0000000000801567 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801567:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80156a:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80156f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801574:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80157a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801580:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801586:	0f 05                	syscall
+    if (check && ret > 0) {
+  801588:	48 85 c0             	test   %rax,%rax
+  80158b:	7f 01                	jg     80158e <sys_env_set_trapframe+0x27>
+}
+  80158d:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80158e:	55                   	push   %rbp
+  80158f:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801592:	49 89 c0             	mov    %rax,%r8
+  801595:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80159a:	48 ba 78 51 80 00 00 	movabs $0x805178,%rdx
+  8015a1:	00 00 00 
+  8015a4:	be 29 00 00 00       	mov    $0x29,%esi
+  8015a9:	48 bf 97 51 80 00 00 	movabs $0x805197,%rdi
+  8015b0:	00 00 00 
+  8015b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015b8:	49 b9 33 04 80 00 00 	movabs $0x800433,%r9
+  8015bf:	00 00 00 
+  8015c2:	41 ff d1             	call   *%r9
+
+00000000008015c5 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8015c5:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8015c8:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8015cd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015d2:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8015d8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8015de:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8015e4:	0f 05                	syscall
+    if (check && ret > 0) {
+  8015e6:	48 85 c0             	test   %rax,%rax
+  8015e9:	7f 01                	jg     8015ec <sys_env_set_pgfault_upcall+0x27>
+}
+  8015eb:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8015ec:	55                   	push   %rbp
+  8015ed:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015f0:	49 89 c0             	mov    %rax,%r8
+  8015f3:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8015f8:	48 ba 78 51 80 00 00 	movabs $0x805178,%rdx
+  8015ff:	00 00 00 
+  801602:	be 29 00 00 00       	mov    $0x29,%esi
+  801607:	48 bf 97 51 80 00 00 	movabs $0x805197,%rdi
+  80160e:	00 00 00 
+  801611:	b8 00 00 00 00       	mov    $0x0,%eax
+  801616:	49 b9 33 04 80 00 00 	movabs $0x800433,%r9
+  80161d:	00 00 00 
+  801620:	41 ff d1             	call   *%r9
+
+0000000000801623 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801623:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801626:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801629:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80162e:	4d 63 c0             	movslq %r8d,%r8
+  801631:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801637:	0f 05                	syscall
+}
+  801639:	c3                   	ret
+
+000000000080163a <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80163a:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80163d:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801640:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801645:	4d 63 c0             	movslq %r8d,%r8
+  801648:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80164e:	0f 05                	syscall
+}
+  801650:	c3                   	ret
+
+0000000000801651 <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  801651:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801656:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801659:	45 89 c0             	mov    %r8d,%r8d
+  80165c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801662:	0f 05                	syscall
+    if (check && ret > 0) {
+  801664:	48 85 c0             	test   %rax,%rax
+  801667:	7f 01                	jg     80166a <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801669:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  80166a:	55                   	push   %rbp
+  80166b:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80166e:	49 89 c0             	mov    %rax,%r8
+  801671:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801676:	48 ba 78 51 80 00 00 	movabs $0x805178,%rdx
+  80167d:	00 00 00 
+  801680:	be 29 00 00 00       	mov    $0x29,%esi
+  801685:	48 bf 97 51 80 00 00 	movabs $0x805197,%rdi
+  80168c:	00 00 00 
+  80168f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801694:	49 b9 33 04 80 00 00 	movabs $0x800433,%r9
+  80169b:	00 00 00 
+  80169e:	41 ff d1             	call   *%r9
+
+00000000008016a1 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  8016a1:	55                   	push   %rbp
+  8016a2:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  8016a5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8016ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016b5:	48 b8 51 16 80 00 00 	movabs $0x801651,%rax
+  8016bc:	00 00 00 
+  8016bf:	ff d0                	call   *%rax
+}
+  8016c1:	5d                   	pop    %rbp
+  8016c2:	c3                   	ret
+
+00000000008016c3 <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  8016c3:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8016c8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8016cd:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8016d2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016d7:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8016dd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8016e3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8016e9:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8016eb:	c3                   	ret
+
+00000000008016ec <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  8016ec:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8016f1:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8016f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016fb:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801701:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801707:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80170d:	0f 05                	syscall
+    if (check && ret > 0) {
+  80170f:	48 85 c0             	test   %rax,%rax
+  801712:	7f 01                	jg     801715 <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  801714:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  801715:	55                   	push   %rbp
+  801716:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801719:	49 89 c0             	mov    %rax,%r8
+  80171c:	b9 10 00 00 00       	mov    $0x10,%ecx
+  801721:	48 ba 78 51 80 00 00 	movabs $0x805178,%rdx
+  801728:	00 00 00 
+  80172b:	be 29 00 00 00       	mov    $0x29,%esi
+  801730:	48 bf 97 51 80 00 00 	movabs $0x805197,%rdi
+  801737:	00 00 00 
+  80173a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80173f:	49 b9 33 04 80 00 00 	movabs $0x800433,%r9
+  801746:	00 00 00 
+  801749:	41 ff d1             	call   *%r9
+
+000000000080174c <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  80174c:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801751:	bf 00 00 00 00       	mov    $0x0,%edi
+  801756:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80175b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801760:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801766:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80176c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801772:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  801774:	c3                   	ret
+
+0000000000801775 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  801775:	89 d2                	mov    %edx,%edx
+  801777:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  801779:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80177e:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801784:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80178a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801790:	0f 05                	syscall
+}
+  801792:	c3                   	ret
+
+0000000000801793 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  801793:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  801796:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80179b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017a0:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8017a6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8017ac:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8017b2:	0f 05                	syscall
+}
+  8017b4:	c3                   	ret
+
+00000000008017b5 <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  8017b5:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  8017b8:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8017bd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017c2:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8017c8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8017ce:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8017d4:	0f 05                	syscall
+}
+  8017d6:	c3                   	ret
+
+00000000008017d7 <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  8017d7:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8017da:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8017df:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8017e4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017e9:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8017ef:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8017f5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8017fb:	0f 05                	syscall
+    if (check && ret > 0) {
+  8017fd:	48 85 c0             	test   %rax,%rax
+  801800:	7f 01                	jg     801803 <sys_irq_ack+0x2c>
+}
+  801802:	c3                   	ret
+sys_irq_ack(int irq) {
+  801803:	55                   	push   %rbp
+  801804:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801807:	49 89 c0             	mov    %rax,%r8
+  80180a:	b9 16 00 00 00       	mov    $0x16,%ecx
+  80180f:	48 ba 78 51 80 00 00 	movabs $0x805178,%rdx
+  801816:	00 00 00 
+  801819:	be 29 00 00 00       	mov    $0x29,%esi
+  80181e:	48 bf 97 51 80 00 00 	movabs $0x805197,%rdi
+  801825:	00 00 00 
+  801828:	b8 00 00 00 00       	mov    $0x0,%eax
+  80182d:	49 b9 33 04 80 00 00 	movabs $0x800433,%r9
+  801834:	00 00 00 
+  801837:	41 ff d1             	call   *%r9
+
+000000000080183a <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  80183a:	55                   	push   %rbp
+  80183b:	48 89 e5             	mov    %rsp,%rbp
+  80183e:	41 54                	push   %r12
+  801840:	53                   	push   %rbx
+    // LAB 9: Your code here
+    /* The child would write them out once more */
+    file_flush_buffers();
+  801841:	48 b8 35 34 80 00 00 	movabs $0x803435,%rax
+  801848:	00 00 00 
+  80184b:	ff d0                	call   *%rax
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("syscall"
+  80184d:	b8 08 00 00 00       	mov    $0x8,%eax
+  801852:	0f 05                	syscall
+  801854:	41 89 c4             	mov    %eax,%r12d
+
+	envid_t envid = sys_exofork();
+    if (envid < 0)
+  801857:	85 c0                	test   %eax,%eax
+  801859:	78 7e                	js     8018d9 <fork+0x9f>
+        return envid;
+    if (envid == 0) {
+  80185b:	0f 84 80 00 00 00    	je     8018e1 <fork+0xa7>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE) < 0) {
+  801861:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801867:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  80186e:	00 00 00 
+  801871:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801876:	89 c2                	mov    %eax,%edx
+  801878:	be 00 00 00 00       	mov    $0x0,%esi
+  80187d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801882:	48 b8 5d 14 80 00 00 	movabs $0x80145d,%rax
+  801889:	00 00 00 
+  80188c:	ff d0                	call   *%rax
+  80188e:	85 c0                	test   %eax,%eax
+  801890:	0f 88 86 00 00 00    	js     80191c <fork+0xe2>
+		return -1;
+	}
+    if (sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall) < 0) {
+  801896:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80189d:	00 00 00 
+  8018a0:	48 8b b0 28 01 00 00 	mov    0x128(%rax),%rsi
+  8018a7:	44 89 e7             	mov    %r12d,%edi
+  8018aa:	48 b8 c5 15 80 00 00 	movabs $0x8015c5,%rax
+  8018b1:	00 00 00 
+  8018b4:	ff d0                	call   *%rax
+  8018b6:	85 c0                	test   %eax,%eax
+  8018b8:	78 6a                	js     801924 <fork+0xea>
+		return -1;
+	}
+    if (sys_env_set_status(envid, ENV_RUNNABLE) < 0) {
+  8018ba:	be 02 00 00 00       	mov    $0x2,%esi
+  8018bf:	44 89 e7             	mov    %r12d,%edi
+  8018c2:	48 b8 06 15 80 00 00 	movabs $0x801506,%rax
+  8018c9:	00 00 00 
+  8018cc:	ff d0                	call   *%rax
+		return -1;
+  8018ce:	85 c0                	test   %eax,%eax
+  8018d0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8018d5:	44 0f 48 e0          	cmovs  %eax,%r12d
+	}
+    return envid;
+}
+  8018d9:	44 89 e0             	mov    %r12d,%eax
+  8018dc:	5b                   	pop    %rbx
+  8018dd:	41 5c                	pop    %r12
+  8018df:	5d                   	pop    %rbp
+  8018e0:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  8018e1:	48 b8 7a 13 80 00 00 	movabs $0x80137a,%rax
+  8018e8:	00 00 00 
+  8018eb:	ff d0                	call   *%rax
+  8018ed:	89 c2                	mov    %eax,%edx
+  8018ef:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  8018f5:	48 89 d0             	mov    %rdx,%rax
+  8018f8:	48 c1 e0 04          	shl    $0x4,%rax
+  8018fc:	48 29 d0             	sub    %rdx,%rax
+  8018ff:	48 c1 e0 05          	shl    $0x5,%rax
+  801903:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80190a:	00 00 00 
+  80190d:	48 01 d0             	add    %rdx,%rax
+  801910:	48 a3 00 00 81 00 00 	movabs %rax,0x810000
+  801917:	00 00 00 
+        return 0;
+  80191a:	eb bd                	jmp    8018d9 <fork+0x9f>
+		return -1;
+  80191c:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801922:	eb b5                	jmp    8018d9 <fork+0x9f>
+		return -1;
+  801924:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  80192a:	eb ad                	jmp    8018d9 <fork+0x9f>
+
+000000000080192c <sfork>:
+
+envid_t
+sfork() {
+  80192c:	55                   	push   %rbp
+  80192d:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  801930:	48 ba a5 51 80 00 00 	movabs $0x8051a5,%rdx
+  801937:	00 00 00 
+  80193a:	be 2d 00 00 00       	mov    $0x2d,%esi
+  80193f:	48 bf c0 51 80 00 00 	movabs $0x8051c0,%rdi
+  801946:	00 00 00 
+  801949:	b8 00 00 00 00       	mov    $0x0,%eax
+  80194e:	48 b9 33 04 80 00 00 	movabs $0x800433,%rcx
+  801955:	00 00 00 
+  801958:	ff d1                	call   *%rcx
+
+000000000080195a <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  80195a:	55                   	push   %rbp
+  80195b:	48 89 e5             	mov    %rsp,%rbp
+  80195e:	41 55                	push   %r13
+  801960:	41 54                	push   %r12
+  801962:	53                   	push   %rbx
+  801963:	48 83 ec 08          	sub    $0x8,%rsp
+  801967:	49 89 fd             	mov    %rdi,%r13
+  80196a:	48 89 f7             	mov    %rsi,%rdi
+  80196d:	48 89 d3             	mov    %rdx,%rbx
+  801970:	49 89 cc             	mov    %rcx,%r12
+  801973:	4c 89 c2             	mov    %r8,%rdx
+  801976:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  801979:	48 85 f6             	test   %rsi,%rsi
+  80197c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801983:	00 00 00 
+  801986:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  80198a:	be 00 10 00 00       	mov    $0x1000,%esi
+  80198f:	48 85 db             	test   %rbx,%rbx
+  801992:	74 03                	je     801997 <ipc_recv_futex+0x3d>
+  801994:	48 8b 33             	mov    (%rbx),%rsi
+  801997:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  80199b:	48 b8 51 16 80 00 00 	movabs $0x801651,%rax
+  8019a2:	00 00 00 
+  8019a5:	ff d0                	call   *%rax
+    if (res < 0) {
+  8019a7:	85 c0                	test   %eax,%eax
+  8019a9:	78 75                	js     801a20 <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  8019ab:	4d 85 ed             	test   %r13,%r13
+  8019ae:	74 14                	je     8019c4 <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  8019b0:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8019b7:	00 00 00 
+  8019ba:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  8019c0:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  8019c4:	4d 85 e4             	test   %r12,%r12
+  8019c7:	74 14                	je     8019dd <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  8019c9:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8019d0:	00 00 00 
+  8019d3:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  8019d9:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  8019dd:	48 85 db             	test   %rbx,%rbx
+  8019e0:	74 23                	je     801a05 <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8019e2:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8019e9:	00 00 00 
+  8019ec:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  8019f2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019f7:	85 c9                	test   %ecx,%ecx
+  8019f9:	74 07                	je     801a02 <ipc_recv_futex+0xa8>
+  8019fb:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  801a02:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  801a05:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801a0c:	00 00 00 
+  801a0f:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  801a15:	48 83 c4 08          	add    $0x8,%rsp
+  801a19:	5b                   	pop    %rbx
+  801a1a:	41 5c                	pop    %r12
+  801a1c:	41 5d                	pop    %r13
+  801a1e:	5d                   	pop    %rbp
+  801a1f:	c3                   	ret
+        if (from_env_store != NULL) {
+  801a20:	4d 85 ed             	test   %r13,%r13
+  801a23:	74 08                	je     801a2d <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  801a25:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  801a2c:	00 
+        if (perm_store != NULL) {
+  801a2d:	4d 85 e4             	test   %r12,%r12
+  801a30:	74 08                	je     801a3a <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  801a32:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  801a39:	00 
+        if (size != NULL) {
+  801a3a:	48 85 db             	test   %rbx,%rbx
+  801a3d:	74 d6                	je     801a15 <ipc_recv_futex+0xbb>
+            *size = 0;
+  801a3f:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  801a46:	eb cd                	jmp    801a15 <ipc_recv_futex+0xbb>
+
+0000000000801a48 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  801a48:	55                   	push   %rbp
+  801a49:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  801a4c:	48 83 ec 08          	sub    $0x8,%rsp
+  801a50:	6a 00                	push   $0x0
+  801a52:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801a58:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801a5e:	48 b8 5a 19 80 00 00 	movabs $0x80195a,%rax
+  801a65:	00 00 00 
+  801a68:	ff d0                	call   *%rax
+}
+  801a6a:	c9                   	leave
+  801a6b:	c3                   	ret
+
+0000000000801a6c <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  801a6c:	55                   	push   %rbp
+  801a6d:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  801a70:	48 85 d2             	test   %rdx,%rdx
+  801a73:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801a7a:	00 00 00 
+  801a7d:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  801a81:	89 f6                	mov    %esi,%esi
+  801a83:	48 b8 3a 16 80 00 00 	movabs $0x80163a,%rax
+  801a8a:	00 00 00 
+  801a8d:	ff d0                	call   *%rax
+    if (res < 0) {
+  801a8f:	85 c0                	test   %eax,%eax
+  801a91:	78 02                	js     801a95 <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  801a93:	5d                   	pop    %rbp
+  801a94:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  801a95:	89 c1                	mov    %eax,%ecx
+  801a97:	48 ba cb 51 80 00 00 	movabs $0x8051cb,%rdx
+  801a9e:	00 00 00 
+  801aa1:	be 50 00 00 00       	mov    $0x50,%esi
+  801aa6:	48 bf df 51 80 00 00 	movabs $0x8051df,%rdi
+  801aad:	00 00 00 
+  801ab0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ab5:	49 b8 33 04 80 00 00 	movabs $0x800433,%r8
+  801abc:	00 00 00 
+  801abf:	41 ff d0             	call   *%r8
+
+0000000000801ac2 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  801ac2:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  801ac7:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  801ace:	00 00 00 
+  801ad1:	48 89 d0             	mov    %rdx,%rax
+  801ad4:	48 c1 e0 04          	shl    $0x4,%rax
+  801ad8:	48 29 d0             	sub    %rdx,%rax
+  801adb:	48 c1 e0 05          	shl    $0x5,%rax
+  801adf:	48 01 c8             	add    %rcx,%rax
+  801ae2:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  801ae8:	39 f8                	cmp    %edi,%eax
+  801aea:	74 13                	je     801aff <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  801aec:	48 83 c2 01          	add    $0x1,%rdx
+  801af0:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  801af7:	75 d8                	jne    801ad1 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  801af9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801afe:	c3                   	ret
+            return envs[i].env_id;
+  801aff:	48 89 d0             	mov    %rdx,%rax
+  801b02:	48 c1 e0 04          	shl    $0x4,%rax
+  801b06:	48 29 d0             	sub    %rdx,%rax
+  801b09:	48 c1 e0 05          	shl    $0x5,%rax
+  801b0d:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801b14:	00 00 00 
+  801b17:	48 01 d0             	add    %rdx,%rax
+  801b1a:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801b20:	c3                   	ret
+
+0000000000801b21 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801b21:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801b28:	ff ff ff 
+  801b2b:	48 01 f8             	add    %rdi,%rax
+  801b2e:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801b32:	c3                   	ret
+
+0000000000801b33 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801b33:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801b3a:	ff ff ff 
+  801b3d:	48 01 f8             	add    %rdi,%rax
+  801b40:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801b44:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801b4a:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801b4e:	c3                   	ret
+
+0000000000801b4f <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801b4f:	55                   	push   %rbp
+  801b50:	48 89 e5             	mov    %rsp,%rbp
+  801b53:	41 57                	push   %r15
+  801b55:	41 56                	push   %r14
+  801b57:	41 55                	push   %r13
+  801b59:	41 54                	push   %r12
+  801b5b:	53                   	push   %rbx
+  801b5c:	48 83 ec 08          	sub    $0x8,%rsp
+  801b60:	49 89 ff             	mov    %rdi,%r15
+  801b63:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801b68:	49 bd de 42 80 00 00 	movabs $0x8042de,%r13
+  801b6f:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801b72:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801b78:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801b7b:	48 89 df             	mov    %rbx,%rdi
+  801b7e:	41 ff d5             	call   *%r13
+  801b81:	83 e0 04             	and    $0x4,%eax
+  801b84:	74 17                	je     801b9d <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801b86:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801b8d:	4c 39 f3             	cmp    %r14,%rbx
+  801b90:	75 e6                	jne    801b78 <fd_alloc+0x29>
+  801b92:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801b98:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801b9d:	4d 89 27             	mov    %r12,(%r15)
+}
+  801ba0:	48 83 c4 08          	add    $0x8,%rsp
+  801ba4:	5b                   	pop    %rbx
+  801ba5:	41 5c                	pop    %r12
+  801ba7:	41 5d                	pop    %r13
+  801ba9:	41 5e                	pop    %r14
+  801bab:	41 5f                	pop    %r15
+  801bad:	5d                   	pop    %rbp
+  801bae:	c3                   	ret
+
+0000000000801baf <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801baf:	83 ff 1f             	cmp    $0x1f,%edi
+  801bb2:	77 39                	ja     801bed <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801bb4:	55                   	push   %rbp
+  801bb5:	48 89 e5             	mov    %rsp,%rbp
+  801bb8:	41 54                	push   %r12
+  801bba:	53                   	push   %rbx
+  801bbb:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801bbe:	48 63 df             	movslq %edi,%rbx
+  801bc1:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801bc8:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801bcc:	48 89 df             	mov    %rbx,%rdi
+  801bcf:	48 b8 de 42 80 00 00 	movabs $0x8042de,%rax
+  801bd6:	00 00 00 
+  801bd9:	ff d0                	call   *%rax
+  801bdb:	a8 04                	test   $0x4,%al
+  801bdd:	74 14                	je     801bf3 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801bdf:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801be3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801be8:	5b                   	pop    %rbx
+  801be9:	41 5c                	pop    %r12
+  801beb:	5d                   	pop    %rbp
+  801bec:	c3                   	ret
+        return -E_INVAL;
+  801bed:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801bf2:	c3                   	ret
+        return -E_INVAL;
+  801bf3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801bf8:	eb ee                	jmp    801be8 <fd_lookup+0x39>
+
+0000000000801bfa <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801bfa:	55                   	push   %rbp
+  801bfb:	48 89 e5             	mov    %rsp,%rbp
+  801bfe:	41 54                	push   %r12
+  801c00:	53                   	push   %rbx
+  801c01:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801c04:	48 b8 80 52 80 00 00 	movabs $0x805280,%rax
+  801c0b:	00 00 00 
+  801c0e:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  801c15:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801c18:	39 3b                	cmp    %edi,(%rbx)
+  801c1a:	74 47                	je     801c63 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801c1c:	48 83 c0 08          	add    $0x8,%rax
+  801c20:	48 8b 18             	mov    (%rax),%rbx
+  801c23:	48 85 db             	test   %rbx,%rbx
+  801c26:	75 f0                	jne    801c18 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801c28:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801c2f:	00 00 00 
+  801c32:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801c38:	89 fa                	mov    %edi,%edx
+  801c3a:	48 bf f0 51 80 00 00 	movabs $0x8051f0,%rdi
+  801c41:	00 00 00 
+  801c44:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c49:	48 b9 83 05 80 00 00 	movabs $0x800583,%rcx
+  801c50:	00 00 00 
+  801c53:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801c55:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801c5a:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801c5e:	5b                   	pop    %rbx
+  801c5f:	41 5c                	pop    %r12
+  801c61:	5d                   	pop    %rbp
+  801c62:	c3                   	ret
+            return 0;
+  801c63:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c68:	eb f0                	jmp    801c5a <dev_lookup+0x60>
+
+0000000000801c6a <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801c6a:	55                   	push   %rbp
+  801c6b:	48 89 e5             	mov    %rsp,%rbp
+  801c6e:	41 55                	push   %r13
+  801c70:	41 54                	push   %r12
+  801c72:	53                   	push   %rbx
+  801c73:	48 83 ec 18          	sub    $0x18,%rsp
+  801c77:	48 89 fb             	mov    %rdi,%rbx
+  801c7a:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801c7d:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801c84:	ff ff ff 
+  801c87:	48 01 df             	add    %rbx,%rdi
+  801c8a:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801c8e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c92:	48 b8 af 1b 80 00 00 	movabs $0x801baf,%rax
+  801c99:	00 00 00 
+  801c9c:	ff d0                	call   *%rax
+  801c9e:	41 89 c5             	mov    %eax,%r13d
+  801ca1:	85 c0                	test   %eax,%eax
+  801ca3:	78 06                	js     801cab <fd_close+0x41>
+  801ca5:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801ca9:	74 1a                	je     801cc5 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801cab:	45 84 e4             	test   %r12b,%r12b
+  801cae:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cb3:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801cb7:	44 89 e8             	mov    %r13d,%eax
+  801cba:	48 83 c4 18          	add    $0x18,%rsp
+  801cbe:	5b                   	pop    %rbx
+  801cbf:	41 5c                	pop    %r12
+  801cc1:	41 5d                	pop    %r13
+  801cc3:	5d                   	pop    %rbp
+  801cc4:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801cc5:	8b 3b                	mov    (%rbx),%edi
+  801cc7:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ccb:	48 b8 fa 1b 80 00 00 	movabs $0x801bfa,%rax
+  801cd2:	00 00 00 
+  801cd5:	ff d0                	call   *%rax
+  801cd7:	41 89 c5             	mov    %eax,%r13d
+  801cda:	85 c0                	test   %eax,%eax
+  801cdc:	78 1b                	js     801cf9 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801cde:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ce2:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801ce6:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801cec:	48 85 c0             	test   %rax,%rax
+  801cef:	74 08                	je     801cf9 <fd_close+0x8f>
+  801cf1:	48 89 df             	mov    %rbx,%rdi
+  801cf4:	ff d0                	call   *%rax
+  801cf6:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801cf9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801cfe:	48 89 de             	mov    %rbx,%rsi
+  801d01:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d06:	48 b8 ad 14 80 00 00 	movabs $0x8014ad,%rax
+  801d0d:	00 00 00 
+  801d10:	ff d0                	call   *%rax
+    return res;
+  801d12:	eb a3                	jmp    801cb7 <fd_close+0x4d>
+
+0000000000801d14 <close>:
+
+int
+close(int fdnum) {
+  801d14:	55                   	push   %rbp
+  801d15:	48 89 e5             	mov    %rsp,%rbp
+  801d18:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801d1c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801d20:	48 b8 af 1b 80 00 00 	movabs $0x801baf,%rax
+  801d27:	00 00 00 
+  801d2a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801d2c:	85 c0                	test   %eax,%eax
+  801d2e:	78 15                	js     801d45 <close+0x31>
+
+    return fd_close(fd, 1);
+  801d30:	be 01 00 00 00       	mov    $0x1,%esi
+  801d35:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801d39:	48 b8 6a 1c 80 00 00 	movabs $0x801c6a,%rax
+  801d40:	00 00 00 
+  801d43:	ff d0                	call   *%rax
+}
+  801d45:	c9                   	leave
+  801d46:	c3                   	ret
+
+0000000000801d47 <close_all>:
+
+void
+close_all(void) {
+  801d47:	55                   	push   %rbp
+  801d48:	48 89 e5             	mov    %rsp,%rbp
+  801d4b:	41 54                	push   %r12
+  801d4d:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801d4e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d53:	49 bc 14 1d 80 00 00 	movabs $0x801d14,%r12
+  801d5a:	00 00 00 
+  801d5d:	89 df                	mov    %ebx,%edi
+  801d5f:	41 ff d4             	call   *%r12
+  801d62:	83 c3 01             	add    $0x1,%ebx
+  801d65:	83 fb 20             	cmp    $0x20,%ebx
+  801d68:	75 f3                	jne    801d5d <close_all+0x16>
+}
+  801d6a:	5b                   	pop    %rbx
+  801d6b:	41 5c                	pop    %r12
+  801d6d:	5d                   	pop    %rbp
+  801d6e:	c3                   	ret
+
+0000000000801d6f <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801d6f:	55                   	push   %rbp
+  801d70:	48 89 e5             	mov    %rsp,%rbp
+  801d73:	41 57                	push   %r15
+  801d75:	41 56                	push   %r14
+  801d77:	41 55                	push   %r13
+  801d79:	41 54                	push   %r12
+  801d7b:	53                   	push   %rbx
+  801d7c:	48 83 ec 18          	sub    $0x18,%rsp
+  801d80:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801d83:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801d87:	48 b8 af 1b 80 00 00 	movabs $0x801baf,%rax
+  801d8e:	00 00 00 
+  801d91:	ff d0                	call   *%rax
+  801d93:	89 c3                	mov    %eax,%ebx
+  801d95:	85 c0                	test   %eax,%eax
+  801d97:	0f 88 b8 00 00 00    	js     801e55 <dup+0xe6>
+    close(newfdnum);
+  801d9d:	44 89 e7             	mov    %r12d,%edi
+  801da0:	48 b8 14 1d 80 00 00 	movabs $0x801d14,%rax
+  801da7:	00 00 00 
+  801daa:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801dac:	4d 63 ec             	movslq %r12d,%r13
+  801daf:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801db6:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801dba:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801dbe:	4c 89 ff             	mov    %r15,%rdi
+  801dc1:	49 be 33 1b 80 00 00 	movabs $0x801b33,%r14
+  801dc8:	00 00 00 
+  801dcb:	41 ff d6             	call   *%r14
+  801dce:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801dd1:	4c 89 ef             	mov    %r13,%rdi
+  801dd4:	41 ff d6             	call   *%r14
+  801dd7:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801dda:	48 89 df             	mov    %rbx,%rdi
+  801ddd:	48 b8 de 42 80 00 00 	movabs $0x8042de,%rax
+  801de4:	00 00 00 
+  801de7:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801de9:	a8 04                	test   $0x4,%al
+  801deb:	74 2b                	je     801e18 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801ded:	41 89 c1             	mov    %eax,%r9d
+  801df0:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801df6:	4c 89 f1             	mov    %r14,%rcx
+  801df9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dfe:	48 89 de             	mov    %rbx,%rsi
+  801e01:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e06:	48 b8 5d 14 80 00 00 	movabs $0x80145d,%rax
+  801e0d:	00 00 00 
+  801e10:	ff d0                	call   *%rax
+  801e12:	89 c3                	mov    %eax,%ebx
+  801e14:	85 c0                	test   %eax,%eax
+  801e16:	78 4e                	js     801e66 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801e18:	4c 89 ff             	mov    %r15,%rdi
+  801e1b:	48 b8 de 42 80 00 00 	movabs $0x8042de,%rax
+  801e22:	00 00 00 
+  801e25:	ff d0                	call   *%rax
+  801e27:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801e2a:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801e30:	4c 89 e9             	mov    %r13,%rcx
+  801e33:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e38:	4c 89 fe             	mov    %r15,%rsi
+  801e3b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e40:	48 b8 5d 14 80 00 00 	movabs $0x80145d,%rax
+  801e47:	00 00 00 
+  801e4a:	ff d0                	call   *%rax
+  801e4c:	89 c3                	mov    %eax,%ebx
+  801e4e:	85 c0                	test   %eax,%eax
+  801e50:	78 14                	js     801e66 <dup+0xf7>
+
+    return newfdnum;
+  801e52:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801e55:	89 d8                	mov    %ebx,%eax
+  801e57:	48 83 c4 18          	add    $0x18,%rsp
+  801e5b:	5b                   	pop    %rbx
+  801e5c:	41 5c                	pop    %r12
+  801e5e:	41 5d                	pop    %r13
+  801e60:	41 5e                	pop    %r14
+  801e62:	41 5f                	pop    %r15
+  801e64:	5d                   	pop    %rbp
+  801e65:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801e66:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801e6b:	4c 89 ee             	mov    %r13,%rsi
+  801e6e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e73:	49 bc ad 14 80 00 00 	movabs $0x8014ad,%r12
+  801e7a:	00 00 00 
+  801e7d:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801e80:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801e85:	4c 89 f6             	mov    %r14,%rsi
+  801e88:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e8d:	41 ff d4             	call   *%r12
+    return res;
+  801e90:	eb c3                	jmp    801e55 <dup+0xe6>
+
+0000000000801e92 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801e92:	55                   	push   %rbp
+  801e93:	48 89 e5             	mov    %rsp,%rbp
+  801e96:	41 56                	push   %r14
+  801e98:	41 55                	push   %r13
+  801e9a:	41 54                	push   %r12
+  801e9c:	53                   	push   %rbx
+  801e9d:	48 83 ec 10          	sub    $0x10,%rsp
+  801ea1:	89 fb                	mov    %edi,%ebx
+  801ea3:	49 89 f4             	mov    %rsi,%r12
+  801ea6:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ea9:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ead:	48 b8 af 1b 80 00 00 	movabs $0x801baf,%rax
+  801eb4:	00 00 00 
+  801eb7:	ff d0                	call   *%rax
+  801eb9:	85 c0                	test   %eax,%eax
+  801ebb:	78 4c                	js     801f09 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ebd:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801ec1:	41 8b 3e             	mov    (%r14),%edi
+  801ec4:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ec8:	48 b8 fa 1b 80 00 00 	movabs $0x801bfa,%rax
+  801ecf:	00 00 00 
+  801ed2:	ff d0                	call   *%rax
+  801ed4:	85 c0                	test   %eax,%eax
+  801ed6:	78 35                	js     801f0d <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801ed8:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801edc:	83 e0 03             	and    $0x3,%eax
+  801edf:	83 f8 01             	cmp    $0x1,%eax
+  801ee2:	74 2d                	je     801f11 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801ee4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ee8:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801eec:	48 85 c0             	test   %rax,%rax
+  801eef:	74 56                	je     801f47 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801ef1:	4c 89 ea             	mov    %r13,%rdx
+  801ef4:	4c 89 e6             	mov    %r12,%rsi
+  801ef7:	4c 89 f7             	mov    %r14,%rdi
+  801efa:	ff d0                	call   *%rax
+}
+  801efc:	48 83 c4 10          	add    $0x10,%rsp
+  801f00:	5b                   	pop    %rbx
+  801f01:	41 5c                	pop    %r12
+  801f03:	41 5d                	pop    %r13
+  801f05:	41 5e                	pop    %r14
+  801f07:	5d                   	pop    %rbp
+  801f08:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f09:	48 98                	cltq
+  801f0b:	eb ef                	jmp    801efc <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f0d:	48 98                	cltq
+  801f0f:	eb eb                	jmp    801efc <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801f11:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801f18:	00 00 00 
+  801f1b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801f21:	89 da                	mov    %ebx,%edx
+  801f23:	48 bf 31 52 80 00 00 	movabs $0x805231,%rdi
+  801f2a:	00 00 00 
+  801f2d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f32:	48 b9 83 05 80 00 00 	movabs $0x800583,%rcx
+  801f39:	00 00 00 
+  801f3c:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801f3e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801f45:	eb b5                	jmp    801efc <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801f47:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801f4e:	eb ac                	jmp    801efc <read+0x6a>
+
+0000000000801f50 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801f50:	55                   	push   %rbp
+  801f51:	48 89 e5             	mov    %rsp,%rbp
+  801f54:	41 57                	push   %r15
+  801f56:	41 56                	push   %r14
+  801f58:	41 55                	push   %r13
+  801f5a:	41 54                	push   %r12
+  801f5c:	53                   	push   %rbx
+  801f5d:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801f61:	48 85 d2             	test   %rdx,%rdx
+  801f64:	74 54                	je     801fba <readn+0x6a>
+  801f66:	41 89 fd             	mov    %edi,%r13d
+  801f69:	49 89 f6             	mov    %rsi,%r14
+  801f6c:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801f6f:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801f74:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801f79:	49 bf 92 1e 80 00 00 	movabs $0x801e92,%r15
+  801f80:	00 00 00 
+  801f83:	4c 89 e2             	mov    %r12,%rdx
+  801f86:	48 29 f2             	sub    %rsi,%rdx
+  801f89:	4c 01 f6             	add    %r14,%rsi
+  801f8c:	44 89 ef             	mov    %r13d,%edi
+  801f8f:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801f92:	85 c0                	test   %eax,%eax
+  801f94:	78 20                	js     801fb6 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801f96:	01 c3                	add    %eax,%ebx
+  801f98:	85 c0                	test   %eax,%eax
+  801f9a:	74 08                	je     801fa4 <readn+0x54>
+  801f9c:	48 63 f3             	movslq %ebx,%rsi
+  801f9f:	4c 39 e6             	cmp    %r12,%rsi
+  801fa2:	72 df                	jb     801f83 <readn+0x33>
+    }
+    return res;
+  801fa4:	48 63 c3             	movslq %ebx,%rax
+}
+  801fa7:	48 83 c4 08          	add    $0x8,%rsp
+  801fab:	5b                   	pop    %rbx
+  801fac:	41 5c                	pop    %r12
+  801fae:	41 5d                	pop    %r13
+  801fb0:	41 5e                	pop    %r14
+  801fb2:	41 5f                	pop    %r15
+  801fb4:	5d                   	pop    %rbp
+  801fb5:	c3                   	ret
+        if (inc < 0) return inc;
+  801fb6:	48 98                	cltq
+  801fb8:	eb ed                	jmp    801fa7 <readn+0x57>
+    int inc = 1, res = 0;
+  801fba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801fbf:	eb e3                	jmp    801fa4 <readn+0x54>
+
+0000000000801fc1 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801fc1:	55                   	push   %rbp
+  801fc2:	48 89 e5             	mov    %rsp,%rbp
+  801fc5:	41 56                	push   %r14
+  801fc7:	41 55                	push   %r13
+  801fc9:	41 54                	push   %r12
+  801fcb:	53                   	push   %rbx
+  801fcc:	48 83 ec 10          	sub    $0x10,%rsp
+  801fd0:	89 fb                	mov    %edi,%ebx
+  801fd2:	49 89 f4             	mov    %rsi,%r12
+  801fd5:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801fd8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801fdc:	48 b8 af 1b 80 00 00 	movabs $0x801baf,%rax
+  801fe3:	00 00 00 
+  801fe6:	ff d0                	call   *%rax
+  801fe8:	85 c0                	test   %eax,%eax
+  801fea:	78 47                	js     802033 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801fec:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801ff0:	41 8b 3e             	mov    (%r14),%edi
+  801ff3:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ff7:	48 b8 fa 1b 80 00 00 	movabs $0x801bfa,%rax
+  801ffe:	00 00 00 
+  802001:	ff d0                	call   *%rax
+  802003:	85 c0                	test   %eax,%eax
+  802005:	78 30                	js     802037 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802007:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  80200c:	74 2d                	je     80203b <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80200e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802012:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802016:	48 85 c0             	test   %rax,%rax
+  802019:	74 56                	je     802071 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  80201b:	4c 89 ea             	mov    %r13,%rdx
+  80201e:	4c 89 e6             	mov    %r12,%rsi
+  802021:	4c 89 f7             	mov    %r14,%rdi
+  802024:	ff d0                	call   *%rax
+}
+  802026:	48 83 c4 10          	add    $0x10,%rsp
+  80202a:	5b                   	pop    %rbx
+  80202b:	41 5c                	pop    %r12
+  80202d:	41 5d                	pop    %r13
+  80202f:	41 5e                	pop    %r14
+  802031:	5d                   	pop    %rbp
+  802032:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802033:	48 98                	cltq
+  802035:	eb ef                	jmp    802026 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802037:	48 98                	cltq
+  802039:	eb eb                	jmp    802026 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80203b:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  802042:	00 00 00 
+  802045:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80204b:	89 da                	mov    %ebx,%edx
+  80204d:	48 bf 4d 52 80 00 00 	movabs $0x80524d,%rdi
+  802054:	00 00 00 
+  802057:	b8 00 00 00 00       	mov    $0x0,%eax
+  80205c:	48 b9 83 05 80 00 00 	movabs $0x800583,%rcx
+  802063:	00 00 00 
+  802066:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802068:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80206f:	eb b5                	jmp    802026 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802071:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802078:	eb ac                	jmp    802026 <write+0x65>
+
+000000000080207a <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80207a:	55                   	push   %rbp
+  80207b:	48 89 e5             	mov    %rsp,%rbp
+  80207e:	41 54                	push   %r12
+  802080:	53                   	push   %rbx
+  802081:	48 83 ec 10          	sub    $0x10,%rsp
+  802085:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802087:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80208b:	48 b8 af 1b 80 00 00 	movabs $0x801baf,%rax
+  802092:	00 00 00 
+  802095:	ff d0                	call   *%rax
+  802097:	85 c0                	test   %eax,%eax
+  802099:	78 3e                	js     8020d9 <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80209b:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80209f:	41 8b 3c 24          	mov    (%r12),%edi
+  8020a3:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8020a7:	48 b8 fa 1b 80 00 00 	movabs $0x801bfa,%rax
+  8020ae:	00 00 00 
+  8020b1:	ff d0                	call   *%rax
+  8020b3:	85 c0                	test   %eax,%eax
+  8020b5:	78 22                	js     8020d9 <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  8020b7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8020bb:	48 8b 40 38          	mov    0x38(%rax),%rax
+  8020bf:	48 85 c0             	test   %rax,%rax
+  8020c2:	74 0b                	je     8020cf <seek+0x55>
+  8020c4:	89 de                	mov    %ebx,%esi
+  8020c6:	4c 89 e7             	mov    %r12,%rdi
+  8020c9:	ff d0                	call   *%rax
+  8020cb:	85 c0                	test   %eax,%eax
+  8020cd:	78 0a                	js     8020d9 <seek+0x5f>
+
+    fd->fd_offset = offset;
+  8020cf:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  8020d4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020d9:	48 83 c4 10          	add    $0x10,%rsp
+  8020dd:	5b                   	pop    %rbx
+  8020de:	41 5c                	pop    %r12
+  8020e0:	5d                   	pop    %rbp
+  8020e1:	c3                   	ret
+
+00000000008020e2 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8020e2:	55                   	push   %rbp
+  8020e3:	48 89 e5             	mov    %rsp,%rbp
+  8020e6:	41 55                	push   %r13
+  8020e8:	41 54                	push   %r12
+  8020ea:	53                   	push   %rbx
+  8020eb:	48 83 ec 18          	sub    $0x18,%rsp
+  8020ef:	89 fb                	mov    %edi,%ebx
+  8020f1:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8020f4:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8020f8:	48 b8 af 1b 80 00 00 	movabs $0x801baf,%rax
+  8020ff:	00 00 00 
+  802102:	ff d0                	call   *%rax
+  802104:	85 c0                	test   %eax,%eax
+  802106:	78 38                	js     802140 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802108:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80210c:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  802110:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802114:	48 b8 fa 1b 80 00 00 	movabs $0x801bfa,%rax
+  80211b:	00 00 00 
+  80211e:	ff d0                	call   *%rax
+  802120:	85 c0                	test   %eax,%eax
+  802122:	78 1c                	js     802140 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802124:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  802129:	74 20                	je     80214b <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80212b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80212f:	48 8b 40 30          	mov    0x30(%rax),%rax
+  802133:	48 85 c0             	test   %rax,%rax
+  802136:	74 47                	je     80217f <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802138:	44 89 e6             	mov    %r12d,%esi
+  80213b:	4c 89 ef             	mov    %r13,%rdi
+  80213e:	ff d0                	call   *%rax
+}
+  802140:	48 83 c4 18          	add    $0x18,%rsp
+  802144:	5b                   	pop    %rbx
+  802145:	41 5c                	pop    %r12
+  802147:	41 5d                	pop    %r13
+  802149:	5d                   	pop    %rbp
+  80214a:	c3                   	ret
+                thisenv->env_id, fdnum);
+  80214b:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  802152:	00 00 00 
+  802155:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80215b:	89 da                	mov    %ebx,%edx
+  80215d:	48 bf 10 52 80 00 00 	movabs $0x805210,%rdi
+  802164:	00 00 00 
+  802167:	b8 00 00 00 00       	mov    $0x0,%eax
+  80216c:	48 b9 83 05 80 00 00 	movabs $0x800583,%rcx
+  802173:	00 00 00 
+  802176:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802178:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80217d:	eb c1                	jmp    802140 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80217f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802184:	eb ba                	jmp    802140 <ftruncate+0x5e>
+
+0000000000802186 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802186:	55                   	push   %rbp
+  802187:	48 89 e5             	mov    %rsp,%rbp
+  80218a:	41 54                	push   %r12
+  80218c:	53                   	push   %rbx
+  80218d:	48 83 ec 10          	sub    $0x10,%rsp
+  802191:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802194:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802198:	48 b8 af 1b 80 00 00 	movabs $0x801baf,%rax
+  80219f:	00 00 00 
+  8021a2:	ff d0                	call   *%rax
+  8021a4:	85 c0                	test   %eax,%eax
+  8021a6:	78 4e                	js     8021f6 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8021a8:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8021ac:	41 8b 3c 24          	mov    (%r12),%edi
+  8021b0:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8021b4:	48 b8 fa 1b 80 00 00 	movabs $0x801bfa,%rax
+  8021bb:	00 00 00 
+  8021be:	ff d0                	call   *%rax
+  8021c0:	85 c0                	test   %eax,%eax
+  8021c2:	78 32                	js     8021f6 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8021c4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8021c8:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8021cd:	74 30                	je     8021ff <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8021cf:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8021d2:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8021d9:	00 00 00 
+    stat->st_isdir = 0;
+  8021dc:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8021e3:	00 00 00 
+    stat->st_dev = dev;
+  8021e6:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8021ed:	48 89 de             	mov    %rbx,%rsi
+  8021f0:	4c 89 e7             	mov    %r12,%rdi
+  8021f3:	ff 50 28             	call   *0x28(%rax)
+}
+  8021f6:	48 83 c4 10          	add    $0x10,%rsp
+  8021fa:	5b                   	pop    %rbx
+  8021fb:	41 5c                	pop    %r12
+  8021fd:	5d                   	pop    %rbp
+  8021fe:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8021ff:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802204:	eb f0                	jmp    8021f6 <fstat+0x70>
+
+0000000000802206 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802206:	55                   	push   %rbp
+  802207:	48 89 e5             	mov    %rsp,%rbp
+  80220a:	41 54                	push   %r12
+  80220c:	53                   	push   %rbx
+  80220d:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802210:	be 00 00 00 00       	mov    $0x0,%esi
+  802215:	48 b8 74 33 80 00 00 	movabs $0x803374,%rax
+  80221c:	00 00 00 
+  80221f:	ff d0                	call   *%rax
+  802221:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802223:	85 c0                	test   %eax,%eax
+  802225:	78 25                	js     80224c <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802227:	4c 89 e6             	mov    %r12,%rsi
+  80222a:	89 c7                	mov    %eax,%edi
+  80222c:	48 b8 86 21 80 00 00 	movabs $0x802186,%rax
+  802233:	00 00 00 
+  802236:	ff d0                	call   *%rax
+  802238:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80223b:	89 df                	mov    %ebx,%edi
+  80223d:	48 b8 14 1d 80 00 00 	movabs $0x801d14,%rax
+  802244:	00 00 00 
+  802247:	ff d0                	call   *%rax
+
+    return res;
+  802249:	44 89 e3             	mov    %r12d,%ebx
+}
+  80224c:	89 d8                	mov    %ebx,%eax
+  80224e:	5b                   	pop    %rbx
+  80224f:	41 5c                	pop    %r12
+  802251:	5d                   	pop    %rbp
+  802252:	c3                   	ret
+
+0000000000802253 <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  802253:	48 b8 08 00 82 00 00 	movabs $0x820008,%rax
+  80225a:	00 00 00 
+  80225d:	83 38 00             	cmpl   $0x0,(%rax)
+  802260:	74 0a                	je     80226c <fsenv+0x19>
+    return envid;
+}
+  802262:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  802269:	00 00 
+  80226b:	c3                   	ret
+fsenv(void) {
+  80226c:	55                   	push   %rbp
+  80226d:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  802270:	bf 03 00 00 00       	mov    $0x3,%edi
+  802275:	48 b8 c2 1a 80 00 00 	movabs $0x801ac2,%rax
+  80227c:	00 00 00 
+  80227f:	ff d0                	call   *%rax
+  802281:	a3 08 00 82 00 00 00 	movabs %eax,0x820008
+  802288:	00 00 
+}
+  80228a:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  802291:	00 00 
+  802293:	5d                   	pop    %rbp
+  802294:	c3                   	ret
+
+0000000000802295 <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  802295:	55                   	push   %rbp
+  802296:	48 89 e5             	mov    %rsp,%rbp
+  802299:	41 54                	push   %r12
+  80229b:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  80229c:	ba 00 50 00 00       	mov    $0x5000,%edx
+  8022a1:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  8022a6:	48 89 de             	mov    %rbx,%rsi
+  8022a9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022ae:	48 b8 ad 14 80 00 00 	movabs $0x8014ad,%rax
+  8022b5:	00 00 00 
+  8022b8:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  8022ba:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  8022c1:	00 00 00 
+  8022c4:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  8022ca:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8022cf:	ba 00 50 00 00       	mov    $0x5000,%edx
+  8022d4:	48 89 de             	mov    %rbx,%rsi
+  8022d7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022dc:	48 b8 07 14 80 00 00 	movabs $0x801407,%rax
+  8022e3:	00 00 00 
+  8022e6:	ff d0                	call   *%rax
+  8022e8:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  8022ea:	85 c0                	test   %eax,%eax
+  8022ec:	0f 88 a2 00 00 00    	js     802394 <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  8022f2:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8022f9:	00 00 00 
+  8022fc:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802302:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  802307:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  802309:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  80230e:	49 bc a6 44 80 00 00 	movabs $0x8044a6,%r12
+  802315:	00 00 00 
+  802318:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  80231b:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  802320:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  802323:	48 b8 53 22 80 00 00 	movabs $0x802253,%rax
+  80232a:	00 00 00 
+  80232d:	ff d0                	call   *%rax
+  80232f:	89 c7                	mov    %eax,%edi
+  802331:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  802337:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  80233c:	48 89 da             	mov    %rbx,%rdx
+  80233f:	be 09 00 00 00       	mov    $0x9,%esi
+  802344:	48 b8 6c 1a 80 00 00 	movabs $0x801a6c,%rax
+  80234b:	00 00 00 
+  80234e:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  802350:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802355:	ba 00 00 00 00       	mov    $0x0,%edx
+  80235a:	be 00 00 00 00       	mov    $0x0,%esi
+  80235f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802364:	48 b8 48 1a 80 00 00 	movabs $0x801a48,%rax
+  80236b:	00 00 00 
+  80236e:	ff d0                	call   *%rax
+  802370:	89 c3                	mov    %eax,%ebx
+  802372:	85 c0                	test   %eax,%eax
+  802374:	78 25                	js     80239b <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  802376:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80237d:	00 00 00 
+  802380:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802386:	a3 00 26 82 00 00 00 	movabs %eax,0x822600
+  80238d:	00 00 
+    return 0;
+  80238f:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  802394:	89 d8                	mov    %ebx,%eax
+  802396:	5b                   	pop    %rbx
+  802397:	41 5c                	pop    %r12
+  802399:	5d                   	pop    %rbp
+  80239a:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  80239b:	ba 00 50 00 00       	mov    $0x5000,%edx
+  8023a0:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  8023a5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023aa:	48 b8 ad 14 80 00 00 	movabs $0x8014ad,%rax
+  8023b1:	00 00 00 
+  8023b4:	ff d0                	call   *%rax
+        return res;
+  8023b6:	eb dc                	jmp    802394 <fschan_setup+0xff>
+
+00000000008023b8 <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  8023b8:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  8023bf:	00 00 00 
+  8023c2:	80 38 00             	cmpb   $0x0,(%rax)
+  8023c5:	74 55                	je     80241c <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  8023c7:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8023ce:	00 00 00 
+  8023d1:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  8023d7:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  8023dc:	48 ba 00 26 82 00 00 	movabs $0x822600,%rdx
+  8023e3:	00 00 00 
+  8023e6:	3b 0a                	cmp    (%rdx),%ecx
+  8023e8:	75 01                	jne    8023eb <fschan+0x33>
+}
+  8023ea:	c3                   	ret
+fschan(void) {
+  8023eb:	55                   	push   %rbp
+  8023ec:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  8023ef:	48 b8 95 22 80 00 00 	movabs $0x802295,%rax
+  8023f6:	00 00 00 
+  8023f9:	ff d0                	call   *%rax
+  8023fb:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  8023fd:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802402:	85 d2                	test   %edx,%edx
+  802404:	78 02                	js     802408 <fschan+0x50>
+}
+  802406:	5d                   	pop    %rbp
+  802407:	c3                   	ret
+        fschan_enabled = 0;
+  802408:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  80240f:	00 00 00 
+  802412:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  802415:	b8 00 00 00 00       	mov    $0x0,%eax
+  80241a:	eb ea                	jmp    802406 <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  80241c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802421:	c3                   	ret
+
+0000000000802422 <fbuf>:
+fbuf(struct Fd *fd) {
+  802422:	55                   	push   %rbp
+  802423:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  802426:	48 b8 21 1b 80 00 00 	movabs $0x801b21,%rax
+  80242d:	00 00 00 
+  802430:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  802432:	ba 00 00 00 00       	mov    $0x0,%edx
+  802437:	48 83 f8 1f          	cmp    $0x1f,%rax
+  80243b:	77 12                	ja     80244f <fbuf+0x2d>
+  80243d:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  802441:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802448:	00 00 00 
+  80244b:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  80244f:	48 89 d0             	mov    %rdx,%rax
+  802452:	5d                   	pop    %rbp
+  802453:	c3                   	ret
+
+0000000000802454 <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  802454:	55                   	push   %rbp
+  802455:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  802458:	48 83 c7 40          	add    $0x40,%rdi
+  80245c:	48 b8 e0 44 80 00 00 	movabs $0x8044e0,%rax
+  802463:	00 00 00 
+  802466:	ff d0                	call   *%rax
+  802468:	84 c0                	test   %al,%al
+  80246a:	75 02                	jne    80246e <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  80246c:	5d                   	pop    %rbp
+  80246d:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  80246e:	48 b8 53 22 80 00 00 	movabs $0x802253,%rax
+  802475:	00 00 00 
+  802478:	ff d0                	call   *%rax
+  80247a:	89 c7                	mov    %eax,%edi
+  80247c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802482:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802487:	ba 00 00 00 00       	mov    $0x0,%edx
+  80248c:	be 0a 00 00 00       	mov    $0xa,%esi
+  802491:	48 b8 6c 1a 80 00 00 	movabs $0x801a6c,%rax
+  802498:	00 00 00 
+  80249b:	ff d0                	call   *%rax
+}
+  80249d:	eb cd                	jmp    80246c <fschan_publish+0x18>
+
+000000000080249f <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  80249f:	55                   	push   %rbp
+  8024a0:	48 89 e5             	mov    %rsp,%rbp
+  8024a3:	41 57                	push   %r15
+  8024a5:	41 56                	push   %r14
+  8024a7:	41 55                	push   %r13
+  8024a9:	41 54                	push   %r12
+  8024ab:	53                   	push   %rbx
+  8024ac:	48 83 ec 48          	sub    $0x48,%rsp
+  8024b0:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8024b4:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  8024b8:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  8024bb:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  8024bf:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  8024c2:	48 ba 04 00 82 00 00 	movabs $0x820004,%rdx
+  8024c9:	00 00 00 
+  8024cc:	8b 02                	mov    (%rdx),%eax
+  8024ce:	83 c0 01             	add    $0x1,%eax
+  8024d1:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8024d6:	0f 44 c1             	cmove  %ecx,%eax
+  8024d9:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  8024db:	4d 85 c0             	test   %r8,%r8
+  8024de:	74 2c                	je     80250c <fschan_rw+0x6d>
+  8024e0:	45 89 ce             	mov    %r9d,%r14d
+  8024e3:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  8024ea:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  8024ee:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8024f4:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  8024fb:	00 
+  8024fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802502:	b8 01 00 00 00       	mov    $0x1,%eax
+  802507:	e9 41 01 00 00       	jmp    80264d <fschan_rw+0x1ae>
+  80250c:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  802510:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802514:	e9 9c 01 00 00       	jmp    8026b5 <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  802519:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80251d:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  802520:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  802523:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  802526:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  80252a:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  80252e:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  802532:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  802536:	48 89 da             	mov    %rbx,%rdx
+  802539:	48 b8 09 11 80 00 00 	movabs $0x801109,%rax
+  802540:	00 00 00 
+  802543:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  802545:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802549:	48 b8 54 24 80 00 00 	movabs $0x802454,%rax
+  802550:	00 00 00 
+  802553:	ff d0                	call   *%rax
+            queued += blk;
+  802555:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  802558:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  80255c:	4d 39 fc             	cmp    %r15,%r12
+  80255f:	73 6b                	jae    8025cc <fschan_rw+0x12d>
+  802561:	41 83 fd 0f          	cmp    $0xf,%r13d
+  802565:	77 65                	ja     8025cc <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  802567:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80256b:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  80256f:	48 b8 bb 44 80 00 00 	movabs $0x8044bb,%rax
+  802576:	00 00 00 
+  802579:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  80257b:	4c 89 fb             	mov    %r15,%rbx
+  80257e:	4c 29 e3             	sub    %r12,%rbx
+  802581:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  802586:	48 39 d3             	cmp    %rdx,%rbx
+  802589:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  80258d:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  802591:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802595:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  802599:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  80259c:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  80259e:	48 b9 04 00 82 00 00 	movabs $0x820004,%rcx
+  8025a5:	00 00 00 
+  8025a8:	8b 09                	mov    (%rcx),%ecx
+  8025aa:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  8025ad:	83 fe 03             	cmp    $0x3,%esi
+  8025b0:	0f 85 63 ff ff ff    	jne    802519 <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  8025b6:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8025ba:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  8025bd:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  8025c0:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  8025c3:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  8025c7:	e9 79 ff ff ff       	jmp    802545 <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  8025cc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8025d0:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  8025d7:	48 89 df             	mov    %rbx,%rdi
+  8025da:	48 b8 7e 45 80 00 00 	movabs $0x80457e,%rax
+  8025e1:	00 00 00 
+  8025e4:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  8025e6:	48 89 df             	mov    %rbx,%rdi
+  8025e9:	48 b8 0c 45 80 00 00 	movabs $0x80450c,%rax
+  8025f0:	00 00 00 
+  8025f3:	ff d0                	call   *%rax
+  8025f5:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  8025f9:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  8025fd:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  802601:	75 25                	jne    802628 <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  802603:	8b 40 04             	mov    0x4(%rax),%eax
+  802606:	85 c0                	test   %eax,%eax
+  802608:	0f 88 86 00 00 00    	js     802694 <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  80260e:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  802612:	74 5b                	je     80266f <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  802614:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802618:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  80261c:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  802620:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  802624:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  802628:	48 89 df             	mov    %rbx,%rdi
+  80262b:	48 b8 33 45 80 00 00 	movabs $0x804533,%rax
+  802632:	00 00 00 
+  802635:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  802637:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  80263b:	83 f0 01             	xor    $0x1,%eax
+  80263e:	4d 39 fc             	cmp    %r15,%r12
+  802641:	0f 92 c2             	setb   %dl
+  802644:	84 c2                	test   %al,%dl
+  802646:	75 05                	jne    80264d <fschan_rw+0x1ae>
+  802648:	45 85 ed             	test   %r13d,%r13d
+  80264b:	74 50                	je     80269d <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  80264d:	4d 39 fc             	cmp    %r15,%r12
+  802650:	0f 92 c1             	setb   %cl
+  802653:	41 83 fd 0f          	cmp    $0xf,%r13d
+  802657:	0f 96 c2             	setbe  %dl
+  80265a:	84 d1                	test   %dl,%cl
+  80265c:	0f 84 6a ff ff ff    	je     8025cc <fschan_rw+0x12d>
+  802662:	84 c0                	test   %al,%al
+  802664:	0f 85 fd fe ff ff    	jne    802567 <fschan_rw+0xc8>
+  80266a:	e9 5d ff ff ff       	jmp    8025cc <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  80266f:	48 63 d0             	movslq %eax,%rdx
+  802672:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802676:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  80267a:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80267e:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  802682:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  802686:	48 b8 09 11 80 00 00 	movabs $0x801109,%rax
+  80268d:	00 00 00 
+  802690:	ff d0                	call   *%rax
+  802692:	eb 80                	jmp    802614 <fschan_rw+0x175>
+                err = msg->fm_res;
+  802694:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  802697:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  80269b:	eb 8b                	jmp    802628 <fschan_rw+0x189>
+    return done || !err ? done : err;
+  80269d:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  8026a2:	0f 85 68 fe ff ff    	jne    802510 <fschan_rw+0x71>
+  8026a8:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  8026ab:	85 c0                	test   %eax,%eax
+  8026ad:	0f 84 5d fe ff ff    	je     802510 <fschan_rw+0x71>
+  8026b3:	48 98                	cltq
+}
+  8026b5:	48 83 c4 48          	add    $0x48,%rsp
+  8026b9:	5b                   	pop    %rbx
+  8026ba:	41 5c                	pop    %r12
+  8026bc:	41 5d                	pop    %r13
+  8026be:	41 5e                	pop    %r14
+  8026c0:	41 5f                	pop    %r15
+  8026c2:	5d                   	pop    %rbp
+  8026c3:	c3                   	ret
+
+00000000008026c4 <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  8026c4:	55                   	push   %rbp
+  8026c5:	48 89 e5             	mov    %rsp,%rbp
+  8026c8:	41 56                	push   %r14
+  8026ca:	41 55                	push   %r13
+  8026cc:	41 54                	push   %r12
+  8026ce:	53                   	push   %rbx
+  8026cf:	48 83 ec 10          	sub    $0x10,%rsp
+  8026d3:	49 89 fe             	mov    %rdi,%r14
+  8026d6:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  8026d9:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  8026dd:	48 29 f3             	sub    %rsi,%rbx
+  8026e0:	48 39 d3             	cmp    %rdx,%rbx
+  8026e3:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  8026e7:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8026ee:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  8026ef:	bf 00 10 00 00       	mov    $0x1000,%edi
+  8026f4:	49 bd 3d 43 80 00 00 	movabs $0x80433d,%r13
+  8026fb:	00 00 00 
+  8026fe:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  802705:	76 1e                	jbe    802725 <mmap_fault+0x61>
+  802707:	4c 01 e7             	add    %r12,%rdi
+  80270a:	41 ff d5             	call   *%r13
+  80270d:	84 c0                	test   %al,%al
+  80270f:	75 14                	jne    802725 <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  802711:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802715:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  80271c:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  802720:	48 39 df             	cmp    %rbx,%rdi
+  802723:	72 e2                	jb     802707 <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  802725:	48 bb 00 10 82 00 00 	movabs $0x821000,%rbx
+  80272c:	00 00 00 
+  80272f:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  802736:	00 00 00 
+  802739:	4c 89 f0             	mov    %r14,%rax
+  80273c:	48 29 d0             	sub    %rdx,%rax
+  80273f:	48 c1 f8 03          	sar    $0x3,%rax
+  802743:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  80274a:	aa aa aa 
+  80274d:	48 0f af c2          	imul   %rdx,%rax
+  802751:	48 c1 e0 0c          	shl    $0xc,%rax
+  802755:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  80275a:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  80275e:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  802760:	44 89 e0             	mov    %r12d,%eax
+  802763:	41 03 46 10          	add    0x10(%r14),%eax
+  802767:	41 2b 06             	sub    (%r14),%eax
+  80276a:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  80276d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802771:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  802775:	41 8b 46 14          	mov    0x14(%r14),%eax
+  802779:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  80277c:	48 b8 53 22 80 00 00 	movabs $0x802253,%rax
+  802783:	00 00 00 
+  802786:	ff d0                	call   *%rax
+  802788:	89 c7                	mov    %eax,%edi
+  80278a:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802790:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802795:	48 89 da             	mov    %rbx,%rdx
+  802798:	be 0f 00 00 00       	mov    $0xf,%esi
+  80279d:	48 b8 6c 1a 80 00 00 	movabs $0x801a6c,%rax
+  8027a4:	00 00 00 
+  8027a7:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  8027a9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8027ae:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8027b2:	4c 89 e6             	mov    %r12,%rsi
+  8027b5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027ba:	48 b8 48 1a 80 00 00 	movabs $0x801a48,%rax
+  8027c1:	00 00 00 
+  8027c4:	ff d0                	call   *%rax
+  8027c6:	48 98                	cltq
+}
+  8027c8:	48 83 c4 10          	add    $0x10,%rsp
+  8027cc:	5b                   	pop    %rbx
+  8027cd:	41 5c                	pop    %r12
+  8027cf:	41 5d                	pop    %r13
+  8027d1:	41 5e                	pop    %r14
+  8027d3:	5d                   	pop    %rbp
+  8027d4:	c3                   	ret
+
+00000000008027d5 <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  8027d5:	48 8b 37             	mov    (%rdi),%rsi
+  8027d8:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  8027df:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  8027e6:	00 00 00 
+  8027e9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8027ee:	eb 0f                	jmp    8027ff <mmap_pgfault+0x2a>
+  8027f0:	c3                   	ret
+  8027f1:	48 83 c1 01          	add    $0x1,%rcx
+  8027f5:	48 83 c2 18          	add    $0x18,%rdx
+  8027f9:	48 83 f9 20          	cmp    $0x20,%rcx
+  8027fd:	74 6e                	je     80286d <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  8027ff:	48 8b 02             	mov    (%rdx),%rax
+  802802:	48 83 e8 01          	sub    $0x1,%rax
+  802806:	48 39 f0             	cmp    %rsi,%rax
+  802809:	73 e6                	jae    8027f1 <mmap_pgfault+0x1c>
+  80280b:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  80280f:	73 e0                	jae    8027f1 <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  802811:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  802815:	b8 00 00 00 00       	mov    $0x0,%eax
+  80281a:	f6 c2 01             	test   $0x1,%dl
+  80281d:	75 d1                	jne    8027f0 <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  80281f:	f6 c2 02             	test   $0x2,%dl
+  802822:	74 1a                	je     80283e <mmap_pgfault+0x69>
+  802824:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  802828:	b8 00 00 00 00       	mov    $0x0,%eax
+  80282d:	48 bf 00 20 82 00 00 	movabs $0x822000,%rdi
+  802834:	00 00 00 
+  802837:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  80283c:	74 35                	je     802873 <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  80283e:	55                   	push   %rbp
+  80283f:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  802842:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  802846:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  80284d:	00 00 00 
+  802850:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  802854:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802859:	48 b8 c4 26 80 00 00 	movabs $0x8026c4,%rax
+  802860:	00 00 00 
+  802863:	ff d0                	call   *%rax
+  802865:	48 85 c0             	test   %rax,%rax
+  802868:	0f 9f c0             	setg   %al
+}
+  80286b:	5d                   	pop    %rbp
+  80286c:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  80286d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802872:	c3                   	ret
+}
+  802873:	c3                   	ret
+
+0000000000802874 <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  802874:	55                   	push   %rbp
+  802875:	48 89 e5             	mov    %rsp,%rbp
+  802878:	41 54                	push   %r12
+  80287a:	53                   	push   %rbx
+  80287b:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80287e:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  802885:	00 00 00 
+  802888:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  80288d:	48 83 38 00          	cmpq   $0x0,(%rax)
+  802891:	74 15                	je     8028a8 <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802893:	48 83 c3 01          	add    $0x1,%rbx
+  802897:	48 83 c0 18          	add    $0x18,%rax
+  80289b:	48 83 fb 20          	cmp    $0x20,%rbx
+  80289f:	75 ec                	jne    80288d <mmap_alloc+0x19>
+    return NULL;
+  8028a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028a6:	eb 52                	jmp    8028fa <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  8028a8:	4c 89 e7             	mov    %r12,%rdi
+  8028ab:	48 b8 de 42 80 00 00 	movabs $0x8042de,%rax
+  8028b2:	00 00 00 
+  8028b5:	ff d0                	call   *%rax
+  8028b7:	41 89 c1             	mov    %eax,%r9d
+  8028ba:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  8028c1:	48 c1 e1 0c          	shl    $0xc,%rcx
+  8028c5:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8028cb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028d0:	4c 89 e6             	mov    %r12,%rsi
+  8028d3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028d8:	48 b8 5d 14 80 00 00 	movabs $0x80145d,%rax
+  8028df:	00 00 00 
+  8028e2:	ff d0                	call   *%rax
+  8028e4:	85 c0                	test   %eax,%eax
+  8028e6:	78 17                	js     8028ff <mmap_alloc+0x8b>
+        return &mmaps[i];
+  8028e8:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  8028ec:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8028f3:	00 00 00 
+  8028f6:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  8028fa:	5b                   	pop    %rbx
+  8028fb:	41 5c                	pop    %r12
+  8028fd:	5d                   	pop    %rbp
+  8028fe:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  8028ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  802904:	eb f4                	jmp    8028fa <mmap_alloc+0x86>
+
+0000000000802906 <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  802906:	55                   	push   %rbp
+  802907:	48 89 e5             	mov    %rsp,%rbp
+  80290a:	41 56                	push   %r14
+  80290c:	41 55                	push   %r13
+  80290e:	41 54                	push   %r12
+  802910:	53                   	push   %rbx
+  802911:	48 83 ec 10          	sub    $0x10,%rsp
+  802915:	41 89 fc             	mov    %edi,%r12d
+  802918:	49 89 f5             	mov    %rsi,%r13
+  80291b:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  80291e:	48 89 f0             	mov    %rsi,%rax
+  802921:	48 09 d0             	or     %rdx,%rax
+  802924:	75 0d                	jne    802933 <fsipc+0x2d>
+  802926:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  802929:	83 f8 04             	cmp    $0x4,%eax
+  80292c:	76 7d                	jbe    8029ab <fsipc+0xa5>
+  80292e:	83 ff 0d             	cmp    $0xd,%edi
+  802931:	74 78                	je     8029ab <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  802933:	48 b8 53 22 80 00 00 	movabs $0x802253,%rax
+  80293a:	00 00 00 
+  80293d:	ff d0                	call   *%rax
+  80293f:	89 c7                	mov    %eax,%edi
+  802941:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  802948:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  80294f:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  802956:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80295c:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802963:	00 00 00 
+  802966:	44 89 e6             	mov    %r12d,%esi
+  802969:	48 b8 6c 1a 80 00 00 	movabs $0x801a6c,%rax
+  802970:	00 00 00 
+  802973:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  802975:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  80297c:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  80297d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802982:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802986:	4c 89 ee             	mov    %r13,%rsi
+  802989:	bf 00 00 00 00       	mov    $0x0,%edi
+  80298e:	48 b8 48 1a 80 00 00 	movabs $0x801a48,%rax
+  802995:	00 00 00 
+  802998:	ff d0                	call   *%rax
+  80299a:	89 c3                	mov    %eax,%ebx
+}
+  80299c:	89 d8                	mov    %ebx,%eax
+  80299e:	48 83 c4 10          	add    $0x10,%rsp
+  8029a2:	5b                   	pop    %rbx
+  8029a3:	41 5c                	pop    %r12
+  8029a5:	41 5d                	pop    %r13
+  8029a7:	41 5e                	pop    %r14
+  8029a9:	5d                   	pop    %rbp
+  8029aa:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  8029ab:	48 b8 b8 23 80 00 00 	movabs $0x8023b8,%rax
+  8029b2:	00 00 00 
+  8029b5:	ff d0                	call   *%rax
+  8029b7:	49 89 c6             	mov    %rax,%r14
+  8029ba:	48 85 c0             	test   %rax,%rax
+  8029bd:	0f 84 70 ff ff ff    	je     802933 <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  8029c3:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  8029c7:	48 b8 bb 44 80 00 00 	movabs $0x8044bb,%rax
+  8029ce:	00 00 00 
+  8029d1:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  8029d3:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  8029d6:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  8029dd:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  8029e1:	ba 10 00 00 00       	mov    $0x10,%edx
+  8029e6:	48 be 00 00 83 00 00 	movabs $0x830000,%rsi
+  8029ed:	00 00 00 
+  8029f0:	48 b8 09 11 80 00 00 	movabs $0x801109,%rax
+  8029f7:	00 00 00 
+  8029fa:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  8029fc:	4c 89 f7             	mov    %r14,%rdi
+  8029ff:	48 b8 54 24 80 00 00 	movabs $0x802454,%rax
+  802a06:	00 00 00 
+  802a09:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  802a0b:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  802a12:	4c 89 f7             	mov    %r14,%rdi
+  802a15:	48 b8 7e 45 80 00 00 	movabs $0x80457e,%rax
+  802a1c:	00 00 00 
+  802a1f:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  802a21:	4c 89 f7             	mov    %r14,%rdi
+  802a24:	48 b8 0c 45 80 00 00 	movabs $0x80450c,%rax
+  802a2b:	00 00 00 
+  802a2e:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  802a30:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  802a33:	41 83 fc 05          	cmp    $0x5,%r12d
+  802a37:	75 04                	jne    802a3d <fsipc+0x137>
+  802a39:	85 db                	test   %ebx,%ebx
+  802a3b:	79 14                	jns    802a51 <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  802a3d:	4c 89 f7             	mov    %r14,%rdi
+  802a40:	48 b8 33 45 80 00 00 	movabs $0x804533,%rax
+  802a47:	00 00 00 
+  802a4a:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  802a4c:	e9 4b ff ff ff       	jmp    80299c <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  802a51:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  802a55:	ba 88 00 00 00       	mov    $0x88,%edx
+  802a5a:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  802a61:	00 00 00 
+  802a64:	48 b8 09 11 80 00 00 	movabs $0x801109,%rax
+  802a6b:	00 00 00 
+  802a6e:	ff d0                	call   *%rax
+  802a70:	eb cb                	jmp    802a3d <fsipc+0x137>
+
+0000000000802a72 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  802a72:	55                   	push   %rbp
+  802a73:	48 89 e5             	mov    %rsp,%rbp
+  802a76:	41 57                	push   %r15
+  802a78:	41 56                	push   %r14
+  802a7a:	41 55                	push   %r13
+  802a7c:	41 54                	push   %r12
+  802a7e:	53                   	push   %rbx
+  802a7f:	48 83 ec 18          	sub    $0x18,%rsp
+  802a83:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  802a87:	49 89 f6             	mov    %rsi,%r14
+  802a8a:	49 89 d4             	mov    %rdx,%r12
+  802a8d:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  802a90:	48 b8 b8 23 80 00 00 	movabs $0x8023b8,%rax
+  802a97:	00 00 00 
+  802a9a:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  802a9c:	48 85 c0             	test   %rax,%rax
+  802a9f:	0f 85 96 00 00 00    	jne    802b3b <devfile_write_direct+0xc9>
+    size_t write = 0;
+  802aa5:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802aac:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802aad:	49 bf 00 00 83 00 00 	movabs $0x830000,%r15
+  802ab4:	00 00 00 
+    while (n) {
+  802ab7:	4d 85 e4             	test   %r12,%r12
+  802aba:	74 79                	je     802b35 <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802abc:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  802ac1:	49 39 dc             	cmp    %rbx,%r12
+  802ac4:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  802ac8:	48 89 da             	mov    %rbx,%rdx
+  802acb:	4c 89 f6             	mov    %r14,%rsi
+  802ace:	48 bf 00 10 83 00 00 	movabs $0x831000,%rdi
+  802ad5:	00 00 00 
+  802ad8:	48 b8 09 11 80 00 00 	movabs $0x801109,%rax
+  802adf:	00 00 00 
+  802ae2:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802ae4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802ae8:	8b 40 0c             	mov    0xc(%rax),%eax
+  802aeb:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  802aee:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802af1:	44 01 e8             	add    %r13d,%eax
+  802af4:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  802af8:	41 0f 44 c5          	cmove  %r13d,%eax
+  802afc:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  802b00:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  802b04:	48 89 da             	mov    %rbx,%rdx
+  802b07:	be 00 00 00 00       	mov    $0x0,%esi
+  802b0c:	bf 04 00 00 00       	mov    $0x4,%edi
+  802b11:	48 b8 06 29 80 00 00 	movabs $0x802906,%rax
+  802b18:	00 00 00 
+  802b1b:	ff d0                	call   *%rax
+        if (res < 0)
+  802b1d:	85 c0                	test   %eax,%eax
+  802b1f:	78 4a                	js     802b6b <devfile_write_direct+0xf9>
+        buf += res;
+  802b21:	48 98                	cltq
+  802b23:	49 01 c6             	add    %rax,%r14
+        write += res;
+  802b26:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  802b2a:	49 29 c4             	sub    %rax,%r12
+  802b2d:	75 8d                	jne    802abc <devfile_write_direct+0x4a>
+    return write;
+  802b2f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802b33:	eb 27                	jmp    802b5c <devfile_write_direct+0xea>
+    size_t write = 0;
+  802b35:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  802b39:	eb f4                	jmp    802b2f <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  802b3b:	45 89 e9             	mov    %r13d,%r9d
+  802b3e:	4d 89 e0             	mov    %r12,%r8
+  802b41:	4c 89 f1             	mov    %r14,%rcx
+  802b44:	ba 04 00 00 00       	mov    $0x4,%edx
+  802b49:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802b4d:	48 89 c7             	mov    %rax,%rdi
+  802b50:	48 b8 9f 24 80 00 00 	movabs $0x80249f,%rax
+  802b57:	00 00 00 
+  802b5a:	ff d0                	call   *%rax
+}
+  802b5c:	48 83 c4 18          	add    $0x18,%rsp
+  802b60:	5b                   	pop    %rbx
+  802b61:	41 5c                	pop    %r12
+  802b63:	41 5d                	pop    %r13
+  802b65:	41 5e                	pop    %r14
+  802b67:	41 5f                	pop    %r15
+  802b69:	5d                   	pop    %rbp
+  802b6a:	c3                   	ret
+            return res;
+  802b6b:	48 98                	cltq
+  802b6d:	eb ed                	jmp    802b5c <devfile_write_direct+0xea>
+
+0000000000802b6f <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  802b6f:	55                   	push   %rbp
+  802b70:	48 89 e5             	mov    %rsp,%rbp
+  802b73:	41 54                	push   %r12
+  802b75:	53                   	push   %rbx
+  802b76:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  802b79:	48 b8 22 24 80 00 00 	movabs $0x802422,%rax
+  802b80:	00 00 00 
+  802b83:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  802b85:	48 85 c0             	test   %rax,%rax
+  802b88:	74 71                	je     802bfb <fbuf_flush+0x8c>
+  802b8a:	48 89 c3             	mov    %rax,%rbx
+  802b8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b92:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  802b96:	75 05                	jne    802b9d <fbuf_flush+0x2e>
+}
+  802b98:	5b                   	pop    %rbx
+  802b99:	41 5c                	pop    %r12
+  802b9b:	5d                   	pop    %rbp
+  802b9c:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  802b9d:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  802ba0:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  802ba4:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802bab:	00 00 00 
+  802bae:	48 89 de             	mov    %rbx,%rsi
+  802bb1:	48 29 c6             	sub    %rax,%rsi
+  802bb4:	48 c1 fe 03          	sar    $0x3,%rsi
+  802bb8:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802bbf:	aa aa aa 
+  802bc2:	48 0f af f0          	imul   %rax,%rsi
+  802bc6:	48 c1 e6 0e          	shl    $0xe,%rsi
+  802bca:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802bcf:	48 01 c6             	add    %rax,%rsi
+  802bd2:	4c 89 e7             	mov    %r12,%rdi
+  802bd5:	48 b8 72 2a 80 00 00 	movabs $0x802a72,%rax
+  802bdc:	00 00 00 
+  802bdf:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  802be1:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  802be5:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802bec:	00 
+    return res < 0 ? res : 0;
+  802bed:	48 85 c0             	test   %rax,%rax
+  802bf0:	ba 00 00 00 00       	mov    $0x0,%edx
+  802bf5:	48 0f 4f c2          	cmovg  %rdx,%rax
+  802bf9:	eb 9d                	jmp    802b98 <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  802bfb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c00:	eb 96                	jmp    802b98 <fbuf_flush+0x29>
+
+0000000000802c02 <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  802c02:	55                   	push   %rbp
+  802c03:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  802c06:	48 b8 6f 2b 80 00 00 	movabs $0x802b6f,%rax
+  802c0d:	00 00 00 
+  802c10:	ff d0                	call   *%rax
+}
+  802c12:	5d                   	pop    %rbp
+  802c13:	c3                   	ret
+
+0000000000802c14 <devfile_write>:
+    if (!fd || !buf)
+  802c14:	48 85 ff             	test   %rdi,%rdi
+  802c17:	0f 84 d3 01 00 00    	je     802df0 <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802c1d:	55                   	push   %rbp
+  802c1e:	48 89 e5             	mov    %rsp,%rbp
+  802c21:	41 57                	push   %r15
+  802c23:	41 56                	push   %r14
+  802c25:	41 55                	push   %r13
+  802c27:	41 54                	push   %r12
+  802c29:	53                   	push   %rbx
+  802c2a:	48 83 ec 08          	sub    $0x8,%rsp
+  802c2e:	49 89 fc             	mov    %rdi,%r12
+  802c31:	49 89 f6             	mov    %rsi,%r14
+  802c34:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  802c37:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802c3c:	48 85 f6             	test   %rsi,%rsi
+  802c3f:	0f 84 9c 01 00 00    	je     802de1 <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  802c45:	48 b8 22 24 80 00 00 	movabs $0x802422,%rax
+  802c4c:	00 00 00 
+  802c4f:	ff d0                	call   *%rax
+  802c51:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  802c54:	48 85 c0             	test   %rax,%rax
+  802c57:	0f 84 a2 00 00 00    	je     802cff <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802c5d:	be 00 10 00 00       	mov    $0x1000,%esi
+  802c62:	4c 89 e7             	mov    %r12,%rdi
+  802c65:	48 b8 cc 13 80 00 00 	movabs $0x8013cc,%rax
+  802c6c:	00 00 00 
+  802c6f:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  802c71:	83 f8 02             	cmp    $0x2,%eax
+  802c74:	0f 8f 85 00 00 00    	jg     802cff <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  802c7a:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802c81:	00 00 00 
+  802c84:	4d 89 ef             	mov    %r13,%r15
+  802c87:	49 29 c7             	sub    %rax,%r15
+  802c8a:	49 c1 ff 03          	sar    $0x3,%r15
+  802c8e:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802c95:	aa aa aa 
+  802c98:	4c 0f af f8          	imul   %rax,%r15
+  802c9c:	49 c1 e7 0e          	shl    $0xe,%r15
+  802ca0:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802ca5:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  802ca8:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802cad:	0f 84 d7 00 00 00    	je     802d8a <devfile_write+0x176>
+  802cb3:	49 8b 45 10          	mov    0x10(%r13),%rax
+  802cb7:	89 c2                	mov    %eax,%edx
+  802cb9:	41 03 55 0c          	add    0xc(%r13),%edx
+  802cbd:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  802cc2:	75 0f                	jne    802cd3 <devfile_write+0xbf>
+  802cc4:	48 01 d8             	add    %rbx,%rax
+  802cc7:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  802ccd:	0f 86 92 00 00 00    	jbe    802d65 <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802cd3:	4c 89 e7             	mov    %r12,%rdi
+  802cd6:	48 b8 6f 2b 80 00 00 	movabs $0x802b6f,%rax
+  802cdd:	00 00 00 
+  802ce0:	ff d0                	call   *%rax
+  802ce2:	85 c0                	test   %eax,%eax
+  802ce4:	78 52                	js     802d38 <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802ce6:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802ced:	77 7f                	ja     802d6e <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  802cef:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802cf4:	0f 85 c2 00 00 00    	jne    802dbc <devfile_write+0x1a8>
+  802cfa:	e9 94 00 00 00       	jmp    802d93 <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  802cff:	4c 89 e7             	mov    %r12,%rdi
+  802d02:	48 b8 6f 2b 80 00 00 	movabs $0x802b6f,%rax
+  802d09:	00 00 00 
+  802d0c:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802d0e:	85 c0                	test   %eax,%eax
+  802d10:	79 07                	jns    802d19 <devfile_write+0x105>
+  802d12:	48 98                	cltq
+  802d14:	e9 c8 00 00 00       	jmp    802de1 <devfile_write+0x1cd>
+  802d19:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802d1e:	48 89 da             	mov    %rbx,%rdx
+  802d21:	4c 89 f6             	mov    %r14,%rsi
+  802d24:	4c 89 e7             	mov    %r12,%rdi
+  802d27:	48 b8 72 2a 80 00 00 	movabs $0x802a72,%rax
+  802d2e:	00 00 00 
+  802d31:	ff d0                	call   *%rax
+  802d33:	e9 a9 00 00 00       	jmp    802de1 <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802d38:	48 98                	cltq
+  802d3a:	e9 a2 00 00 00       	jmp    802de1 <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802d3f:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802d44:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802d49:	4c 89 fe             	mov    %r15,%rsi
+  802d4c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d51:	48 b8 07 14 80 00 00 	movabs $0x801407,%rax
+  802d58:	00 00 00 
+  802d5b:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  802d5d:	85 c0                	test   %eax,%eax
+  802d5f:	79 45                	jns    802da6 <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802d61:	48 98                	cltq
+  802d63:	eb 7c                	jmp    802de1 <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802d65:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802d6c:	76 4e                	jbe    802dbc <devfile_write+0x1a8>
+  802d6e:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802d73:	48 89 da             	mov    %rbx,%rdx
+  802d76:	4c 89 f6             	mov    %r14,%rsi
+  802d79:	4c 89 e7             	mov    %r12,%rdi
+  802d7c:	48 b8 72 2a 80 00 00 	movabs $0x802a72,%rax
+  802d83:	00 00 00 
+  802d86:	ff d0                	call   *%rax
+  802d88:	eb 57                	jmp    802de1 <devfile_write+0x1cd>
+  802d8a:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802d91:	77 db                	ja     802d6e <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  802d93:	4c 89 ff             	mov    %r15,%rdi
+  802d96:	48 b8 3d 43 80 00 00 	movabs $0x80433d,%rax
+  802d9d:	00 00 00 
+  802da0:	ff d0                	call   *%rax
+  802da2:	84 c0                	test   %al,%al
+  802da4:	74 99                	je     802d3f <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  802da6:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  802dab:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802db0:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  802db4:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  802dbb:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  802dbc:	4c 89 ff             	mov    %r15,%rdi
+  802dbf:	49 03 7d 10          	add    0x10(%r13),%rdi
+  802dc3:	48 89 da             	mov    %rbx,%rdx
+  802dc6:	4c 89 f6             	mov    %r14,%rsi
+  802dc9:	48 b8 09 11 80 00 00 	movabs $0x801109,%rax
+  802dd0:	00 00 00 
+  802dd3:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  802dd5:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  802dd9:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  802dde:	48 89 d8             	mov    %rbx,%rax
+}
+  802de1:	48 83 c4 08          	add    $0x8,%rsp
+  802de5:	5b                   	pop    %rbx
+  802de6:	41 5c                	pop    %r12
+  802de8:	41 5d                	pop    %r13
+  802dea:	41 5e                	pop    %r14
+  802dec:	41 5f                	pop    %r15
+  802dee:	5d                   	pop    %rbp
+  802def:	c3                   	ret
+        return E_INVAL;
+  802df0:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802df5:	c3                   	ret
+
+0000000000802df6 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802df6:	55                   	push   %rbp
+  802df7:	48 89 e5             	mov    %rsp,%rbp
+  802dfa:	41 54                	push   %r12
+  802dfc:	53                   	push   %rbx
+  802dfd:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  802e00:	48 b8 6f 2b 80 00 00 	movabs $0x802b6f,%rax
+  802e07:	00 00 00 
+  802e0a:	ff d0                	call   *%rax
+  802e0c:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  802e0f:	48 89 df             	mov    %rbx,%rdi
+  802e12:	48 b8 22 24 80 00 00 	movabs $0x802422,%rax
+  802e19:	00 00 00 
+  802e1c:	ff d0                	call   *%rax
+  802e1e:	48 85 c0             	test   %rax,%rax
+  802e21:	74 17                	je     802e3a <devfile_flush+0x44>
+  802e23:	48 89 df             	mov    %rbx,%rdi
+  802e26:	48 b8 22 24 80 00 00 	movabs $0x802422,%rax
+  802e2d:	00 00 00 
+  802e30:	ff d0                	call   *%rax
+  802e32:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  802e39:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802e3a:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802e3d:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  802e44:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  802e46:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e4b:	be 00 00 00 00       	mov    $0x0,%esi
+  802e50:	bf 06 00 00 00       	mov    $0x6,%edi
+  802e55:	48 b8 06 29 80 00 00 	movabs $0x802906,%rax
+  802e5c:	00 00 00 
+  802e5f:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802e61:	45 85 e4             	test   %r12d,%r12d
+  802e64:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802e68:	5b                   	pop    %rbx
+  802e69:	41 5c                	pop    %r12
+  802e6b:	5d                   	pop    %rbp
+  802e6c:	c3                   	ret
+
+0000000000802e6d <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  802e6d:	55                   	push   %rbp
+  802e6e:	48 89 e5             	mov    %rsp,%rbp
+  802e71:	41 57                	push   %r15
+  802e73:	41 56                	push   %r14
+  802e75:	41 55                	push   %r13
+  802e77:	41 54                	push   %r12
+  802e79:	53                   	push   %rbx
+  802e7a:	48 83 ec 38          	sub    $0x38,%rsp
+  802e7e:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  802e82:	49 89 f7             	mov    %rsi,%r15
+  802e85:	48 89 d3             	mov    %rdx,%rbx
+  802e88:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  802e8b:	48 b8 b8 23 80 00 00 	movabs $0x8023b8,%rax
+  802e92:	00 00 00 
+  802e95:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802e97:	48 85 c0             	test   %rax,%rax
+  802e9a:	75 20                	jne    802ebc <devfile_read_direct+0x4f>
+    bool map = 1;
+  802e9c:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  802ea1:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802ea8:	00 
+    while (n) {
+  802ea9:	48 85 db             	test   %rbx,%rbx
+  802eac:	0f 85 df 00 00 00    	jne    802f91 <devfile_read_direct+0x124>
+    size_t read = 0;
+  802eb2:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  802eb6:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802eba:	eb 21                	jmp    802edd <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802ebc:	45 89 f1             	mov    %r14d,%r9d
+  802ebf:	49 89 d8             	mov    %rbx,%r8
+  802ec2:	4c 89 f9             	mov    %r15,%rcx
+  802ec5:	ba 03 00 00 00       	mov    $0x3,%edx
+  802eca:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802ece:	48 89 c7             	mov    %rax,%rdi
+  802ed1:	48 b8 9f 24 80 00 00 	movabs $0x80249f,%rax
+  802ed8:	00 00 00 
+  802edb:	ff d0                	call   *%rax
+}
+  802edd:	48 83 c4 38          	add    $0x38,%rsp
+  802ee1:	5b                   	pop    %rbx
+  802ee2:	41 5c                	pop    %r12
+  802ee4:	41 5d                	pop    %r13
+  802ee6:	41 5e                	pop    %r14
+  802ee8:	41 5f                	pop    %r15
+  802eea:	5d                   	pop    %rbp
+  802eeb:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802eec:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802ef0:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802ef6:	75 1e                	jne    802f16 <devfile_read_direct+0xa9>
+  802ef8:	e9 e2 00 00 00       	jmp    802fdf <devfile_read_direct+0x172>
+            if (!res) return read;
+  802efd:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802f01:	eb da                	jmp    802edd <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  802f03:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  802f07:	0f 85 d0 01 00 00    	jne    8030dd <devfile_read_direct+0x270>
+            map = 0;
+  802f0d:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802f11:	eb 03                	jmp    802f16 <devfile_read_direct+0xa9>
+  802f13:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802f16:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802f1b:	48 39 d3             	cmp    %rdx,%rbx
+  802f1e:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802f22:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802f26:	8b 40 0c             	mov    0xc(%rax),%eax
+  802f29:	48 b9 00 00 83 00 00 	movabs $0x830000,%rcx
+  802f30:	00 00 00 
+  802f33:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  802f35:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  802f39:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  802f3d:	be 00 00 00 00       	mov    $0x0,%esi
+  802f42:	bf 03 00 00 00       	mov    $0x3,%edi
+  802f47:	48 b8 06 29 80 00 00 	movabs $0x802906,%rax
+  802f4e:	00 00 00 
+  802f51:	ff d0                	call   *%rax
+        if (res <= 0)
+  802f53:	85 c0                	test   %eax,%eax
+  802f55:	0f 8e 63 01 00 00    	jle    8030be <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  802f5b:	4c 63 e0             	movslq %eax,%r12
+  802f5e:	4c 89 e2             	mov    %r12,%rdx
+  802f61:	48 be 00 10 83 00 00 	movabs $0x831000,%rsi
+  802f68:	00 00 00 
+  802f6b:	4c 89 ff             	mov    %r15,%rdi
+  802f6e:	48 b8 09 11 80 00 00 	movabs $0x801109,%rax
+  802f75:	00 00 00 
+  802f78:	ff d0                	call   *%rax
+        buf += res;
+  802f7a:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  802f7d:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  802f80:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  802f84:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  802f88:	48 85 db             	test   %rbx,%rbx
+  802f8b:	0f 84 25 ff ff ff    	je     802eb6 <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  802f91:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  802f94:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  802f98:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802f9c:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802fa0:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  802fa7:	0f 97 c2             	seta   %dl
+  802faa:	20 c2                	and    %al,%dl
+  802fac:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  802faf:	0f 84 5e ff ff ff    	je     802f13 <devfile_read_direct+0xa6>
+  802fb5:	4c 89 fa             	mov    %r15,%rdx
+  802fb8:	4d 89 fd             	mov    %r15,%r13
+  802fbb:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  802fc2:	0f 85 4e ff ff ff    	jne    802f16 <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  802fc8:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802fcc:	0f 84 1a ff ff ff    	je     802eec <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802fd2:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802fd9:	0f 85 37 ff ff ff    	jne    802f16 <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  802fdf:	48 89 d8             	mov    %rbx,%rax
+  802fe2:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802fe8:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802fed:	48 39 c8             	cmp    %rcx,%rax
+  802ff0:	48 0f 47 c1          	cmova  %rcx,%rax
+  802ff4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  802ff8:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  802ffc:	49 89 d4             	mov    %rdx,%r12
+  802fff:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  803003:	48 b8 de 42 80 00 00 	movabs $0x8042de,%rax
+  80300a:	00 00 00 
+  80300d:	ff d0                	call   *%rax
+  80300f:	a8 40                	test   $0x40,%al
+  803011:	0f 85 b9 00 00 00    	jne    8030d0 <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  803017:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  80301e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803022:	49 39 c5             	cmp    %rax,%r13
+  803025:	72 d8                	jb     802fff <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803027:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  80302b:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  803032:	00 00 00 
+  803035:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  803039:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  80303c:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  80303e:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  803042:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  803046:	48 b8 53 22 80 00 00 	movabs $0x802253,%rax
+  80304d:	00 00 00 
+  803050:	ff d0                	call   *%rax
+  803052:	89 c7                	mov    %eax,%edi
+  803054:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80305a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80305f:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  803066:	00 00 00 
+  803069:	be 0e 00 00 00       	mov    $0xe,%esi
+  80306e:	48 b8 6c 1a 80 00 00 	movabs $0x801a6c,%rax
+  803075:	00 00 00 
+  803078:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  80307a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80307f:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  803083:	4c 89 fe             	mov    %r15,%rsi
+  803086:	bf 00 00 00 00       	mov    $0x0,%edi
+  80308b:	48 b8 48 1a 80 00 00 	movabs $0x801a48,%rax
+  803092:	00 00 00 
+  803095:	ff d0                	call   *%rax
+  803097:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  80309a:	48 85 d2             	test   %rdx,%rdx
+  80309d:	0f 84 5a fe ff ff    	je     802efd <devfile_read_direct+0x90>
+            if (res > 0) {
+  8030a3:	0f 8e 5a fe ff ff    	jle    802f03 <devfile_read_direct+0x96>
+                buf += res;
+  8030a9:	48 98                	cltq
+  8030ab:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  8030ae:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  8030b1:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  8030b5:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  8030b9:	e9 ca fe ff ff       	jmp    802f88 <devfile_read_direct+0x11b>
+            return res ? res : read;
+  8030be:	41 89 c5             	mov    %eax,%r13d
+  8030c1:	48 98                	cltq
+  8030c3:	45 85 ed             	test   %r13d,%r13d
+  8030c6:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  8030cb:	e9 0d fe ff ff       	jmp    802edd <devfile_read_direct+0x70>
+            map = 0;
+  8030d0:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  8030d4:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  8030d8:	e9 39 fe ff ff       	jmp    802f16 <devfile_read_direct+0xa9>
+  8030dd:	48 89 d0             	mov    %rdx,%rax
+  8030e0:	e9 f8 fd ff ff       	jmp    802edd <devfile_read_direct+0x70>
+
+00000000008030e5 <devfile_read>:
+    if (!fd || !buf)
+  8030e5:	48 85 ff             	test   %rdi,%rdi
+  8030e8:	0f 84 21 02 00 00    	je     80330f <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8030ee:	55                   	push   %rbp
+  8030ef:	48 89 e5             	mov    %rsp,%rbp
+  8030f2:	41 57                	push   %r15
+  8030f4:	41 56                	push   %r14
+  8030f6:	41 55                	push   %r13
+  8030f8:	41 54                	push   %r12
+  8030fa:	53                   	push   %rbx
+  8030fb:	48 83 ec 28          	sub    $0x28,%rsp
+  8030ff:	48 89 fb             	mov    %rdi,%rbx
+  803102:	49 89 f4             	mov    %rsi,%r12
+  803105:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  803108:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  80310d:	48 85 f6             	test   %rsi,%rsi
+  803110:	74 4b                	je     80315d <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  803112:	48 b8 22 24 80 00 00 	movabs $0x802422,%rax
+  803119:	00 00 00 
+  80311c:	ff d0                	call   *%rax
+  80311e:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  803121:	48 85 c0             	test   %rax,%rax
+  803124:	74 22                	je     803148 <devfile_read+0x63>
+  803126:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  80312d:	77 19                	ja     803148 <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  80312f:	be 00 10 00 00       	mov    $0x1000,%esi
+  803134:	48 89 df             	mov    %rbx,%rdi
+  803137:	48 b8 cc 13 80 00 00 	movabs $0x8013cc,%rax
+  80313e:	00 00 00 
+  803141:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  803143:	83 f8 02             	cmp    $0x2,%eax
+  803146:	7e 40                	jle    803188 <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  803148:	48 89 df             	mov    %rbx,%rdi
+  80314b:	48 b8 6f 2b 80 00 00 	movabs $0x802b6f,%rax
+  803152:	00 00 00 
+  803155:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  803157:	85 c0                	test   %eax,%eax
+  803159:	79 11                	jns    80316c <devfile_read+0x87>
+  80315b:	48 98                	cltq
+}
+  80315d:	48 83 c4 28          	add    $0x28,%rsp
+  803161:	5b                   	pop    %rbx
+  803162:	41 5c                	pop    %r12
+  803164:	41 5d                	pop    %r13
+  803166:	41 5e                	pop    %r14
+  803168:	41 5f                	pop    %r15
+  80316a:	5d                   	pop    %rbp
+  80316b:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  80316c:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  803171:	4c 89 ea             	mov    %r13,%rdx
+  803174:	4c 89 e6             	mov    %r12,%rsi
+  803177:	48 89 df             	mov    %rbx,%rdi
+  80317a:	48 b8 6d 2e 80 00 00 	movabs $0x802e6d,%rax
+  803181:	00 00 00 
+  803184:	ff d0                	call   *%rax
+  803186:	eb d5                	jmp    80315d <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  803188:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  80318c:	48 89 df             	mov    %rbx,%rdi
+  80318f:	48 b8 6f 2b 80 00 00 	movabs $0x802b6f,%rax
+  803196:	00 00 00 
+  803199:	ff d0                	call   *%rax
+  80319b:	85 c0                	test   %eax,%eax
+  80319d:	0f 88 33 01 00 00    	js     8032d6 <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  8031a3:	48 ba 00 23 82 00 00 	movabs $0x822300,%rdx
+  8031aa:	00 00 00 
+  8031ad:	4c 89 f0             	mov    %r14,%rax
+  8031b0:	48 29 d0             	sub    %rdx,%rax
+  8031b3:	48 c1 f8 03          	sar    $0x3,%rax
+  8031b7:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  8031be:	aa aa aa 
+  8031c1:	48 0f af c2          	imul   %rdx,%rax
+  8031c5:	48 c1 e0 0e          	shl    $0xe,%rax
+  8031c9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  8031cd:	8b 43 0c             	mov    0xc(%rbx),%eax
+  8031d0:	41 39 06             	cmp    %eax,(%r14)
+  8031d3:	75 0d                	jne    8031e2 <devfile_read+0xfd>
+  8031d5:	8b 43 10             	mov    0x10(%rbx),%eax
+  8031d8:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  8031dc:	0f 84 fb 00 00 00    	je     8032dd <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  8031e2:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  8031e7:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8031eb:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  8031ee:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8031f2:	48 89 c7             	mov    %rax,%rdi
+  8031f5:	48 b8 3d 43 80 00 00 	movabs $0x80433d,%rax
+  8031fc:	00 00 00 
+  8031ff:	ff d0                	call   *%rax
+  803201:	84 c0                	test   %al,%al
+  803203:	75 27                	jne    80322c <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  803205:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80320a:	ba 00 40 00 00       	mov    $0x4000,%edx
+  80320f:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803213:	bf 00 00 00 00       	mov    $0x0,%edi
+  803218:	48 b8 07 14 80 00 00 	movabs $0x801407,%rax
+  80321f:	00 00 00 
+  803222:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  803224:	85 c0                	test   %eax,%eax
+  803226:	0f 88 dc 00 00 00    	js     803308 <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  80322c:	44 89 f8             	mov    %r15d,%eax
+  80322f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  803234:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  803236:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  80323d:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  80323e:	8b 43 10             	mov    0x10(%rbx),%eax
+  803241:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  803245:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  803248:	ba 00 40 00 00       	mov    $0x4000,%edx
+  80324d:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803251:	48 89 df             	mov    %rbx,%rdi
+  803254:	48 b8 6d 2e 80 00 00 	movabs $0x802e6d,%rax
+  80325b:	00 00 00 
+  80325e:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  803260:	48 85 c0             	test   %rax,%rax
+  803263:	0f 88 f4 fe ff ff    	js     80315d <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  803269:	8b 53 0c             	mov    0xc(%rbx),%edx
+  80326c:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  80326f:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  803272:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  803276:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  80327a:	48 63 d1             	movslq %ecx,%rdx
+  80327d:	48 01 d0             	add    %rdx,%rax
+  803280:	4d 63 ff             	movslq %r15d,%r15
+  803283:	4c 29 f8             	sub    %r15,%rax
+  803286:	ba 00 00 00 00       	mov    $0x0,%edx
+  80328b:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  80328f:	48 85 c0             	test   %rax,%rax
+  803292:	0f 8e c5 fe ff ff    	jle    80315d <devfile_read+0x78>
+    n = MIN(n, res);
+  803298:	4c 39 e8             	cmp    %r13,%rax
+  80329b:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  80329f:	8b 73 04             	mov    0x4(%rbx),%esi
+  8032a2:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  8032a6:	48 63 f6             	movslq %esi,%rsi
+  8032a9:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  8032ae:	48 01 c6             	add    %rax,%rsi
+  8032b1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8032b5:	48 01 c6             	add    %rax,%rsi
+  8032b8:	4c 89 ea             	mov    %r13,%rdx
+  8032bb:	4c 89 e7             	mov    %r12,%rdi
+  8032be:	48 b8 09 11 80 00 00 	movabs $0x801109,%rax
+  8032c5:	00 00 00 
+  8032c8:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  8032ca:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  8032ce:	4c 89 e8             	mov    %r13,%rax
+  8032d1:	e9 87 fe ff ff       	jmp    80315d <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  8032d6:	48 98                	cltq
+  8032d8:	e9 80 fe ff ff       	jmp    80315d <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  8032dd:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  8032e1:	41 39 d7             	cmp    %edx,%r15d
+  8032e4:	0f 8c f8 fe ff ff    	jl     8031e2 <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  8032ea:	49 8b 46 10          	mov    0x10(%r14),%rax
+  8032ee:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  8032f1:	41 39 cf             	cmp    %ecx,%r15d
+  8032f4:	0f 8d e8 fe ff ff    	jge    8031e2 <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  8032fa:	4d 63 ff             	movslq %r15d,%r15
+  8032fd:	4c 29 f8             	sub    %r15,%rax
+  803300:	48 63 d2             	movslq %edx,%rdx
+  803303:	48 01 d0             	add    %rdx,%rax
+  803306:	eb 87                	jmp    80328f <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  803308:	48 98                	cltq
+  80330a:	e9 4e fe ff ff       	jmp    80315d <devfile_read+0x78>
+        return E_INVAL;
+  80330f:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  803314:	c3                   	ret
+
+0000000000803315 <fs_channel>:
+fs_channel(bool enable) {
+  803315:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  803317:	a2 04 26 82 00 00 00 	movabs %al,0x822604
+  80331e:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  803320:	ba 00 00 00 00       	mov    $0x0,%edx
+  803325:	40 84 ff             	test   %dil,%dil
+  803328:	74 47                	je     803371 <fs_channel+0x5c>
+  80332a:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  803331:	00 00 00 
+  803334:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  80333a:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  803341:	00 00 00 
+  803344:	3b 08                	cmp    (%rax),%ecx
+  803346:	74 29                	je     803371 <fs_channel+0x5c>
+fs_channel(bool enable) {
+  803348:	55                   	push   %rbp
+  803349:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  80334c:	48 b8 95 22 80 00 00 	movabs $0x802295,%rax
+  803353:	00 00 00 
+  803356:	ff d0                	call   *%rax
+  803358:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  80335a:	85 c0                	test   %eax,%eax
+  80335c:	78 04                	js     803362 <fs_channel+0x4d>
+}
+  80335e:	89 d0                	mov    %edx,%eax
+  803360:	5d                   	pop    %rbp
+  803361:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  803362:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  803369:	00 00 00 
+  80336c:	c6 00 00             	movb   $0x0,(%rax)
+  80336f:	eb ed                	jmp    80335e <fs_channel+0x49>
+}
+  803371:	89 d0                	mov    %edx,%eax
+  803373:	c3                   	ret
+
+0000000000803374 <open>:
+open(const char *path, int mode) {
+  803374:	55                   	push   %rbp
+  803375:	48 89 e5             	mov    %rsp,%rbp
+  803378:	41 55                	push   %r13
+  80337a:	41 54                	push   %r12
+  80337c:	53                   	push   %rbx
+  80337d:	48 83 ec 18          	sub    $0x18,%rsp
+  803381:	49 89 fc             	mov    %rdi,%r12
+  803384:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803387:	48 b8 6a 0e 80 00 00 	movabs $0x800e6a,%rax
+  80338e:	00 00 00 
+  803391:	ff d0                	call   *%rax
+  803393:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803399:	0f 87 8f 00 00 00    	ja     80342e <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80339f:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8033a3:	48 b8 4f 1b 80 00 00 	movabs $0x801b4f,%rax
+  8033aa:	00 00 00 
+  8033ad:	ff d0                	call   *%rax
+  8033af:	89 c3                	mov    %eax,%ebx
+  8033b1:	85 c0                	test   %eax,%eax
+  8033b3:	78 55                	js     80340a <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  8033b5:	4c 89 e6             	mov    %r12,%rsi
+  8033b8:	48 bb 00 00 83 00 00 	movabs $0x830000,%rbx
+  8033bf:	00 00 00 
+  8033c2:	48 89 df             	mov    %rbx,%rdi
+  8033c5:	48 b8 a8 0e 80 00 00 	movabs $0x800ea8,%rax
+  8033cc:	00 00 00 
+  8033cf:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8033d1:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  8033d8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8033dd:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8033e1:	bf 01 00 00 00       	mov    $0x1,%edi
+  8033e6:	48 b8 06 29 80 00 00 	movabs $0x802906,%rax
+  8033ed:	00 00 00 
+  8033f0:	ff d0                	call   *%rax
+  8033f2:	89 c3                	mov    %eax,%ebx
+  8033f4:	85 c0                	test   %eax,%eax
+  8033f6:	78 1f                	js     803417 <open+0xa3>
+    return fd2num(fd);
+  8033f8:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8033fc:	48 b8 21 1b 80 00 00 	movabs $0x801b21,%rax
+  803403:	00 00 00 
+  803406:	ff d0                	call   *%rax
+  803408:	89 c3                	mov    %eax,%ebx
+}
+  80340a:	89 d8                	mov    %ebx,%eax
+  80340c:	48 83 c4 18          	add    $0x18,%rsp
+  803410:	5b                   	pop    %rbx
+  803411:	41 5c                	pop    %r12
+  803413:	41 5d                	pop    %r13
+  803415:	5d                   	pop    %rbp
+  803416:	c3                   	ret
+        fd_close(fd, 0);
+  803417:	be 00 00 00 00       	mov    $0x0,%esi
+  80341c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803420:	48 b8 6a 1c 80 00 00 	movabs $0x801c6a,%rax
+  803427:	00 00 00 
+  80342a:	ff d0                	call   *%rax
+        return res;
+  80342c:	eb dc                	jmp    80340a <open+0x96>
+        return -E_BAD_PATH;
+  80342e:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803433:	eb d5                	jmp    80340a <open+0x96>
+
+0000000000803435 <file_flush_buffers>:
+file_flush_buffers(void) {
+  803435:	55                   	push   %rbp
+  803436:	48 89 e5             	mov    %rsp,%rbp
+  803439:	41 56                	push   %r14
+  80343b:	41 55                	push   %r13
+  80343d:	41 54                	push   %r12
+  80343f:	53                   	push   %rbx
+  803440:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  803444:	49 bc 08 23 82 00 00 	movabs $0x822308,%r12
+  80344b:	00 00 00 
+  80344e:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  803453:	49 bd af 1b 80 00 00 	movabs $0x801baf,%r13
+  80345a:	00 00 00 
+  80345d:	49 be 6f 2b 80 00 00 	movabs $0x802b6f,%r14
+  803464:	00 00 00 
+  803467:	eb 0c                	jmp    803475 <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  803469:	83 c3 01             	add    $0x1,%ebx
+  80346c:	49 83 c4 18          	add    $0x18,%r12
+  803470:	83 fb 20             	cmp    $0x20,%ebx
+  803473:	74 1d                	je     803492 <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  803475:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  80347a:	74 ed                	je     803469 <file_flush_buffers+0x34>
+  80347c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803480:	89 df                	mov    %ebx,%edi
+  803482:	41 ff d5             	call   *%r13
+  803485:	85 c0                	test   %eax,%eax
+  803487:	78 e0                	js     803469 <file_flush_buffers+0x34>
+  803489:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80348d:	41 ff d6             	call   *%r14
+  803490:	eb d7                	jmp    803469 <file_flush_buffers+0x34>
+}
+  803492:	48 83 c4 10          	add    $0x10,%rsp
+  803496:	5b                   	pop    %rbx
+  803497:	41 5c                	pop    %r12
+  803499:	41 5d                	pop    %r13
+  80349b:	41 5e                	pop    %r14
+  80349d:	5d                   	pop    %rbp
+  80349e:	c3                   	ret
+
+000000000080349f <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80349f:	55                   	push   %rbp
+  8034a0:	48 89 e5             	mov    %rsp,%rbp
+  8034a3:	41 54                	push   %r12
+  8034a5:	53                   	push   %rbx
+  8034a6:	49 89 fc             	mov    %rdi,%r12
+  8034a9:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  8034ab:	48 b8 35 34 80 00 00 	movabs $0x803435,%rax
+  8034b2:	00 00 00 
+  8034b5:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8034b7:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  8034be:	00 00 00 
+  8034c1:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  8034c6:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  8034c8:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  8034cb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8034d0:	be 00 00 00 00       	mov    $0x0,%esi
+  8034d5:	bf 02 00 00 00       	mov    $0x2,%edi
+  8034da:	48 b8 06 29 80 00 00 	movabs $0x802906,%rax
+  8034e1:	00 00 00 
+  8034e4:	ff d0                	call   *%rax
+}
+  8034e6:	5b                   	pop    %rbx
+  8034e7:	41 5c                	pop    %r12
+  8034e9:	5d                   	pop    %rbp
+  8034ea:	c3                   	ret
+
+00000000008034eb <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8034eb:	55                   	push   %rbp
+  8034ec:	48 89 e5             	mov    %rsp,%rbp
+  8034ef:	41 54                	push   %r12
+  8034f1:	53                   	push   %rbx
+  8034f2:	49 89 fc             	mov    %rdi,%r12
+  8034f5:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  8034f8:	48 b8 35 34 80 00 00 	movabs $0x803435,%rax
+  8034ff:	00 00 00 
+  803502:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803504:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  803509:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  803510:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  803512:	ba 00 00 00 00       	mov    $0x0,%edx
+  803517:	be 00 00 00 00       	mov    $0x0,%esi
+  80351c:	bf 05 00 00 00       	mov    $0x5,%edi
+  803521:	48 b8 06 29 80 00 00 	movabs $0x802906,%rax
+  803528:	00 00 00 
+  80352b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80352d:	85 c0                	test   %eax,%eax
+  80352f:	78 3d                	js     80356e <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803531:	49 bc 00 00 83 00 00 	movabs $0x830000,%r12
+  803538:	00 00 00 
+  80353b:	4c 89 e6             	mov    %r12,%rsi
+  80353e:	48 89 df             	mov    %rbx,%rdi
+  803541:	48 b8 a8 0e 80 00 00 	movabs $0x800ea8,%rax
+  803548:	00 00 00 
+  80354b:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80354d:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  803554:	00 
+  803555:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80355b:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  803562:	00 
+  803563:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  803569:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80356e:	5b                   	pop    %rbx
+  80356f:	41 5c                	pop    %r12
+  803571:	5d                   	pop    %rbp
+  803572:	c3                   	ret
+
+0000000000803573 <remove>:
+remove(const char *path) {
+  803573:	55                   	push   %rbp
+  803574:	48 89 e5             	mov    %rsp,%rbp
+  803577:	53                   	push   %rbx
+  803578:	48 83 ec 08          	sub    $0x8,%rsp
+  80357c:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  80357f:	48 b8 6a 0e 80 00 00 	movabs $0x800e6a,%rax
+  803586:	00 00 00 
+  803589:	ff d0                	call   *%rax
+  80358b:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803591:	77 3a                	ja     8035cd <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  803593:	48 89 de             	mov    %rbx,%rsi
+  803596:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  80359d:	00 00 00 
+  8035a0:	48 b8 a8 0e 80 00 00 	movabs $0x800ea8,%rax
+  8035a7:	00 00 00 
+  8035aa:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  8035ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8035b6:	bf 07 00 00 00       	mov    $0x7,%edi
+  8035bb:	48 b8 06 29 80 00 00 	movabs $0x802906,%rax
+  8035c2:	00 00 00 
+  8035c5:	ff d0                	call   *%rax
+}
+  8035c7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8035cb:	c9                   	leave
+  8035cc:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  8035cd:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8035d2:	eb f3                	jmp    8035c7 <remove+0x54>
+
+00000000008035d4 <sync>:
+sync(void) {
+  8035d4:	55                   	push   %rbp
+  8035d5:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  8035d8:	48 b8 35 34 80 00 00 	movabs $0x803435,%rax
+  8035df:	00 00 00 
+  8035e2:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  8035e4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035e9:	be 00 00 00 00       	mov    $0x0,%esi
+  8035ee:	bf 08 00 00 00       	mov    $0x8,%edi
+  8035f3:	48 b8 06 29 80 00 00 	movabs $0x802906,%rax
+  8035fa:	00 00 00 
+  8035fd:	ff d0                	call   *%rax
+}
+  8035ff:	5d                   	pop    %rbp
+  803600:	c3                   	ret
+
+0000000000803601 <fsync>:
+fsync(int fdnum) {
+  803601:	55                   	push   %rbp
+  803602:	48 89 e5             	mov    %rsp,%rbp
+  803605:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803609:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80360d:	48 b8 af 1b 80 00 00 	movabs $0x801baf,%rax
+  803614:	00 00 00 
+  803617:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803619:	85 c0                	test   %eax,%eax
+  80361b:	78 4b                	js     803668 <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80361d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803621:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  803628:	00 00 00 
+  80362b:	8b 00                	mov    (%rax),%eax
+  80362d:	39 02                	cmp    %eax,(%rdx)
+  80362f:	75 39                	jne    80366a <fsync+0x69>
+    file_flush_buffers();
+  803631:	48 b8 35 34 80 00 00 	movabs $0x803435,%rax
+  803638:	00 00 00 
+  80363b:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  80363d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803641:	8b 40 0c             	mov    0xc(%rax),%eax
+  803644:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  80364b:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  80364d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803652:	be 00 00 00 00       	mov    $0x0,%esi
+  803657:	bf 0d 00 00 00       	mov    $0xd,%edi
+  80365c:	48 b8 06 29 80 00 00 	movabs $0x802906,%rax
+  803663:	00 00 00 
+  803666:	ff d0                	call   *%rax
+}
+  803668:	c9                   	leave
+  803669:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80366a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80366f:	eb f7                	jmp    803668 <fsync+0x67>
+
+0000000000803671 <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  803671:	55                   	push   %rbp
+  803672:	48 89 e5             	mov    %rsp,%rbp
+  803675:	53                   	push   %rbx
+  803676:	48 83 ec 08          	sub    $0x8,%rsp
+  80367a:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  80367d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803682:	be 00 00 00 00       	mov    $0x0,%esi
+  803687:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80368c:	48 b8 06 29 80 00 00 	movabs $0x802906,%rax
+  803693:	00 00 00 
+  803696:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803698:	85 c0                	test   %eax,%eax
+  80369a:	78 2d                	js     8036c9 <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  80369c:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  8036a3:	00 00 00 
+  8036a6:	48 8b 10             	mov    (%rax),%rdx
+  8036a9:	48 89 13             	mov    %rdx,(%rbx)
+  8036ac:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8036b0:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  8036b4:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8036b8:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  8036bc:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8036c0:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  8036c4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8036c9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8036cd:	c9                   	leave
+  8036ce:	c3                   	ret
+
+00000000008036cf <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  8036cf:	55                   	push   %rbp
+  8036d0:	48 89 e5             	mov    %rsp,%rbp
+  8036d3:	53                   	push   %rbx
+  8036d4:	48 83 ec 08          	sub    $0x8,%rsp
+  8036d8:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  8036db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8036e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8036e5:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8036ea:	48 b8 06 29 80 00 00 	movabs $0x802906,%rax
+  8036f1:	00 00 00 
+  8036f4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8036f6:	85 c0                	test   %eax,%eax
+  8036f8:	78 3d                	js     803737 <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  8036fa:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803701:	00 00 00 
+  803704:	48 8b 10             	mov    (%rax),%rdx
+  803707:	48 89 13             	mov    %rdx,(%rbx)
+  80370a:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80370e:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  803712:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803716:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  80371a:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  80371e:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  803722:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  803726:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  80372a:	48 8b 40 28          	mov    0x28(%rax),%rax
+  80372e:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  803732:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803737:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80373b:	c9                   	leave
+  80373c:	c3                   	ret
+
+000000000080373d <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  80373d:	55                   	push   %rbp
+  80373e:	48 89 e5             	mov    %rsp,%rbp
+  803741:	41 57                	push   %r15
+  803743:	41 56                	push   %r14
+  803745:	41 55                	push   %r13
+  803747:	41 54                	push   %r12
+  803749:	53                   	push   %rbx
+  80374a:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  80374e:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  803755:	00 
+  803756:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  80375d:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  803763:	0f 85 43 01 00 00    	jne    8038ac <munmap+0x16f>
+  803769:	49 89 ff             	mov    %rdi,%r15
+  80376c:	4c 39 f7             	cmp    %r14,%rdi
+  80376f:	0f 87 37 01 00 00    	ja     8038ac <munmap+0x16f>
+  803775:	48 bb 00 20 82 00 00 	movabs $0x822000,%rbx
+  80377c:	00 00 00 
+  80377f:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  803785:	eb 2c                	jmp    8037b3 <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  803787:	4c 39 f8             	cmp    %r15,%rax
+  80378a:	0f 83 85 00 00 00    	jae    803815 <munmap+0xd8>
+            m->mm_end = start;
+  803790:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  803795:	48 83 c3 18          	add    $0x18,%rbx
+  803799:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  8037a0:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8037a7:	00 00 00 
+  8037aa:	48 39 c3             	cmp    %rax,%rbx
+  8037ad:	0f 84 d0 00 00 00    	je     803883 <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  8037b3:	49 89 dc             	mov    %rbx,%r12
+  8037b6:	48 8b 03             	mov    (%rbx),%rax
+  8037b9:	4c 39 f0             	cmp    %r14,%rax
+  8037bc:	73 d7                	jae    803795 <munmap+0x58>
+  8037be:	48 85 c0             	test   %rax,%rax
+  8037c1:	74 d2                	je     803795 <munmap+0x58>
+  8037c3:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8037c7:	49 39 d7             	cmp    %rdx,%r15
+  8037ca:	73 c9                	jae    803795 <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  8037cc:	49 39 d6             	cmp    %rdx,%r14
+  8037cf:	73 b6                	jae    803787 <munmap+0x4a>
+  8037d1:	49 39 c7             	cmp    %rax,%r15
+  8037d4:	76 b1                	jbe    803787 <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  8037d6:	4c 89 ef             	mov    %r13,%rdi
+  8037d9:	48 b8 74 28 80 00 00 	movabs $0x802874,%rax
+  8037e0:	00 00 00 
+  8037e3:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  8037e5:	48 85 c0             	test   %rax,%rax
+  8037e8:	0f 84 c5 00 00 00    	je     8038b3 <munmap+0x176>
+            *tail = *m;
+  8037ee:	48 8b 13             	mov    (%rbx),%rdx
+  8037f1:	48 89 10             	mov    %rdx,(%rax)
+  8037f4:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8037f8:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  8037fc:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  803800:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  803804:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  803807:	44 89 f2             	mov    %r14d,%edx
+  80380a:	2b 13                	sub    (%rbx),%edx
+  80380c:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  80380f:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  803813:	eb 80                	jmp    803795 <munmap+0x58>
+        } else if (m->mm_end > end) {
+  803815:	49 39 d6             	cmp    %rdx,%r14
+  803818:	73 18                	jae    803832 <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  80381a:	44 89 f2             	mov    %r14d,%edx
+  80381d:	41 03 54 24 10       	add    0x10(%r12),%edx
+  803822:	29 c2                	sub    %eax,%edx
+  803824:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  803829:	4d 89 34 24          	mov    %r14,(%r12)
+  80382d:	e9 63 ff ff ff       	jmp    803795 <munmap+0x58>
+    m->mm_start = 0;
+  803832:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  803839:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  80383a:	4c 89 e6             	mov    %r12,%rsi
+  80383d:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  803844:	00 00 00 
+  803847:	48 29 c6             	sub    %rax,%rsi
+  80384a:	48 c1 fe 03          	sar    $0x3,%rsi
+  80384e:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  803855:	aa aa aa 
+  803858:	48 0f af f0          	imul   %rax,%rsi
+  80385c:	48 c1 e6 0c          	shl    $0xc,%rsi
+  803860:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  803865:	48 01 c6             	add    %rax,%rsi
+  803868:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80386d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803872:	48 b8 ad 14 80 00 00 	movabs $0x8014ad,%rax
+  803879:	00 00 00 
+  80387c:	ff d0                	call   *%rax
+}
+  80387e:	e9 12 ff ff ff       	jmp    803795 <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  803883:	4c 89 f2             	mov    %r14,%rdx
+  803886:	4c 29 fa             	sub    %r15,%rdx
+  803889:	4c 89 fe             	mov    %r15,%rsi
+  80388c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803891:	48 b8 ad 14 80 00 00 	movabs $0x8014ad,%rax
+  803898:	00 00 00 
+  80389b:	ff d0                	call   *%rax
+}
+  80389d:	48 83 c4 08          	add    $0x8,%rsp
+  8038a1:	5b                   	pop    %rbx
+  8038a2:	41 5c                	pop    %r12
+  8038a4:	41 5d                	pop    %r13
+  8038a6:	41 5e                	pop    %r14
+  8038a8:	41 5f                	pop    %r15
+  8038aa:	5d                   	pop    %rbp
+  8038ab:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  8038ac:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8038b1:	eb ea                	jmp    80389d <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  8038b3:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  8038b8:	eb e3                	jmp    80389d <munmap+0x160>
+
+00000000008038ba <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  8038ba:	55                   	push   %rbp
+  8038bb:	48 89 e5             	mov    %rsp,%rbp
+  8038be:	41 57                	push   %r15
+  8038c0:	41 56                	push   %r14
+  8038c2:	41 55                	push   %r13
+  8038c4:	41 54                	push   %r12
+  8038c6:	53                   	push   %rbx
+  8038c7:	48 83 ec 28          	sub    $0x28,%rsp
+  8038cb:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8038cf:	49 89 f5             	mov    %rsi,%r13
+  8038d2:	41 89 d6             	mov    %edx,%r14d
+  8038d5:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  8038d8:	41 89 cc             	mov    %ecx,%r12d
+  8038db:	44 89 c7             	mov    %r8d,%edi
+  8038de:	44 89 cb             	mov    %r9d,%ebx
+  8038e1:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8038e5:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8038e9:	48 b8 af 1b 80 00 00 	movabs $0x801baf,%rax
+  8038f0:	00 00 00 
+  8038f3:	ff d0                	call   *%rax
+  8038f5:	41 89 c7             	mov    %eax,%r15d
+  8038f8:	85 c0                	test   %eax,%eax
+  8038fa:	0f 88 ae 01 00 00    	js     803aae <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803900:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803904:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  80390b:	00 00 00 
+  80390e:	8b 32                	mov    (%rdx),%esi
+  803910:	39 30                	cmp    %esi,(%rax)
+  803912:	0f 85 7a 02 00 00    	jne    803b92 <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  803918:	8b 40 08             	mov    0x8(%rax),%eax
+  80391b:	83 e0 03             	and    $0x3,%eax
+  80391e:	83 f8 01             	cmp    $0x1,%eax
+  803921:	0f 84 76 02 00 00    	je     803b9d <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  803927:	4d 85 ed             	test   %r13,%r13
+  80392a:	0f 84 78 02 00 00    	je     803ba8 <mmap+0x2ee>
+  803930:	85 db                	test   %ebx,%ebx
+  803932:	0f 88 70 02 00 00    	js     803ba8 <mmap+0x2ee>
+  803938:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  80393e:	41 89 df             	mov    %ebx,%r15d
+  803941:	0f 85 6c 02 00 00    	jne    803bb3 <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  803947:	44 89 f0             	mov    %r14d,%eax
+  80394a:	83 e0 fd             	and    $0xfffffffd,%eax
+  80394d:	83 f8 04             	cmp    $0x4,%eax
+  803950:	0f 85 68 02 00 00    	jne    803bbe <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  803956:	44 89 e1             	mov    %r12d,%ecx
+  803959:	83 e1 01             	and    $0x1,%ecx
+  80395c:	0f 95 c2             	setne  %dl
+  80395f:	44 89 e0             	mov    %r12d,%eax
+  803962:	d1 e8                	shr    %eax
+  803964:	83 f0 01             	xor    $0x1,%eax
+  803967:	83 e0 01             	and    $0x1,%eax
+  80396a:	38 c2                	cmp    %al,%dl
+  80396c:	0f 85 57 02 00 00    	jne    803bc9 <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  803972:	85 c9                	test   %ecx,%ecx
+  803974:	74 0a                	je     803980 <mmap+0xc6>
+  803976:	41 f6 c6 02          	test   $0x2,%r14b
+  80397a:	0f 85 54 02 00 00    	jne    803bd4 <mmap+0x31a>
+    file_flush_buffers();
+  803980:	48 b8 35 34 80 00 00 	movabs $0x803435,%rax
+  803987:	00 00 00 
+  80398a:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  80398c:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  803993:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  80399a:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80399e:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  8039a1:	41 f6 c4 04          	test   $0x4,%r12b
+  8039a5:	0f 84 15 01 00 00    	je     803ac0 <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  8039ab:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  8039ae:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8039b4:	0f 85 25 02 00 00    	jne    803bdf <mmap+0x325>
+  8039ba:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  8039be:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  8039c5:	00 00 00 
+  8039c8:	48 39 c2             	cmp    %rax,%rdx
+  8039cb:	0f 82 19 02 00 00    	jb     803bea <mmap+0x330>
+  8039d1:	48 39 c7             	cmp    %rax,%rdi
+  8039d4:	0f 87 10 02 00 00    	ja     803bea <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  8039da:	4c 89 ee             	mov    %r13,%rsi
+  8039dd:	48 b8 3d 37 80 00 00 	movabs $0x80373d,%rax
+  8039e4:	00 00 00 
+  8039e7:	ff d0                	call   *%rax
+  8039e9:	85 c0                	test   %eax,%eax
+  8039eb:	0f 88 04 02 00 00    	js     803bf5 <mmap+0x33b>
+    if (!handler) {
+  8039f1:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  8039f8:	00 00 00 
+  8039fb:	80 38 00             	cmpb   $0x0,(%rax)
+  8039fe:	75 2b                	jne    803a2b <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  803a00:	48 bf d5 27 80 00 00 	movabs $0x8027d5,%rdi
+  803a07:	00 00 00 
+  803a0a:	48 b8 96 48 80 00 00 	movabs $0x804896,%rax
+  803a11:	00 00 00 
+  803a14:	ff d0                	call   *%rax
+  803a16:	85 c0                	test   %eax,%eax
+  803a18:	0f 88 ea 01 00 00    	js     803c08 <mmap+0x34e>
+        handler = 1;
+  803a1e:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  803a25:	00 00 00 
+  803a28:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  803a2b:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803a2f:	48 b8 74 28 80 00 00 	movabs $0x802874,%rax
+  803a36:	00 00 00 
+  803a39:	ff d0                	call   *%rax
+  803a3b:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  803a3e:	48 85 c0             	test   %rax,%rax
+  803a41:	0f 84 c9 01 00 00    	je     803c10 <mmap+0x356>
+    m->mm_start = va;
+  803a47:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  803a4a:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  803a4e:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  803a52:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  803a55:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  803a59:	44 89 e0             	mov    %r12d,%eax
+  803a5c:	c1 e0 06             	shl    $0x6,%eax
+  803a5f:	25 80 00 00 00       	and    $0x80,%eax
+  803a64:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  803a67:	09 f0                	or     %esi,%eax
+  803a69:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  803a6d:	41 f6 c4 08          	test   $0x8,%r12b
+  803a71:	74 31                	je     803aa4 <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  803a73:	48 39 d3             	cmp    %rdx,%rbx
+  803a76:	73 2c                	jae    803aa4 <mmap+0x1ea>
+  803a78:	ba 00 00 04 00       	mov    $0x40000,%edx
+  803a7d:	48 89 de             	mov    %rbx,%rsi
+  803a80:	4c 89 f7             	mov    %r14,%rdi
+  803a83:	48 b8 c4 26 80 00 00 	movabs $0x8026c4,%rax
+  803a8a:	00 00 00 
+  803a8d:	ff d0                	call   *%rax
+  803a8f:	49 89 c4             	mov    %rax,%r12
+  803a92:	48 85 c0             	test   %rax,%rax
+  803a95:	0f 8e d7 00 00 00    	jle    803b72 <mmap+0x2b8>
+            va += n;
+  803a9b:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  803a9e:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  803aa2:	72 d4                	jb     803a78 <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  803aa4:	49 8b 06             	mov    (%r14),%rax
+  803aa7:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  803aab:	48 89 06             	mov    %rax,(%rsi)
+}
+  803aae:	44 89 f8             	mov    %r15d,%eax
+  803ab1:	48 83 c4 28          	add    $0x28,%rsp
+  803ab5:	5b                   	pop    %rbx
+  803ab6:	41 5c                	pop    %r12
+  803ab8:	41 5d                	pop    %r13
+  803aba:	41 5e                	pop    %r14
+  803abc:	41 5f                	pop    %r15
+  803abe:	5d                   	pop    %rbp
+  803abf:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803ac0:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  803ac7:	00 00 00 
+  803aca:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  803acd:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  803ad4:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803ad7:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  803adc:	48 be 00 20 82 00 00 	movabs $0x822000,%rsi
+  803ae3:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803ae6:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  803aed:	00 00 00 
+  803af0:	48 39 d7             	cmp    %rdx,%rdi
+  803af3:	73 1c                	jae    803b11 <mmap+0x257>
+        return -E_NO_MEM;
+  803af5:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803afb:	eb b1                	jmp    803aae <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803afd:	48 83 c0 01          	add    $0x1,%rax
+  803b01:	48 83 f8 1f          	cmp    $0x1f,%rax
+  803b05:	77 3f                	ja     803b46 <mmap+0x28c>
+  803b07:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  803b0c:	48 39 d7             	cmp    %rdx,%rdi
+  803b0f:	72 2a                	jb     803b3b <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  803b11:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  803b15:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  803b19:	48 39 d1             	cmp    %rdx,%rcx
+  803b1c:	73 df                	jae    803afd <mmap+0x243>
+  803b1e:	48 85 c9             	test   %rcx,%rcx
+  803b21:	74 da                	je     803afd <mmap+0x243>
+  803b23:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  803b27:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  803b2c:	48 39 d3             	cmp    %rdx,%rbx
+  803b2f:	73 cc                	jae    803afd <mmap+0x243>
+            va = mmaps[i].mm_end;
+  803b31:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803b34:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b39:	eb cc                	jmp    803b07 <mmap+0x24d>
+        return -E_NO_MEM;
+  803b3b:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803b41:	e9 68 ff ff ff       	jmp    803aae <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  803b46:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  803b4b:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  803b52:	00 00 00 
+  803b55:	48 39 c2             	cmp    %rax,%rdx
+  803b58:	0f 82 9f 00 00 00    	jb     803bfd <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  803b5e:	48 85 db             	test   %rbx,%rbx
+  803b61:	0f 85 8a fe ff ff    	jne    8039f1 <mmap+0x137>
+        return -E_NO_MEM;
+  803b67:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803b6d:	e9 3c ff ff ff       	jmp    803aae <mmap+0x1f4>
+        if (n < 0) {
+  803b72:	0f 89 2c ff ff ff    	jns    803aa4 <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  803b78:	49 8b 3e             	mov    (%r14),%rdi
+  803b7b:	4c 89 ee             	mov    %r13,%rsi
+  803b7e:	48 b8 3d 37 80 00 00 	movabs $0x80373d,%rax
+  803b85:	00 00 00 
+  803b88:	ff d0                	call   *%rax
+            return n;
+  803b8a:	45 89 e7             	mov    %r12d,%r15d
+  803b8d:	e9 1c ff ff ff       	jmp    803aae <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803b92:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803b98:	e9 11 ff ff ff       	jmp    803aae <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  803b9d:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803ba3:	e9 06 ff ff ff       	jmp    803aae <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  803ba8:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803bae:	e9 fb fe ff ff       	jmp    803aae <mmap+0x1f4>
+  803bb3:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803bb9:	e9 f0 fe ff ff       	jmp    803aae <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  803bbe:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803bc4:	e9 e5 fe ff ff       	jmp    803aae <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  803bc9:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803bcf:	e9 da fe ff ff       	jmp    803aae <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  803bd4:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  803bda:	e9 cf fe ff ff       	jmp    803aae <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  803bdf:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803be5:	e9 c4 fe ff ff       	jmp    803aae <mmap+0x1f4>
+  803bea:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803bf0:	e9 b9 fe ff ff       	jmp    803aae <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  803bf5:	41 89 c7             	mov    %eax,%r15d
+  803bf8:	e9 b1 fe ff ff       	jmp    803aae <mmap+0x1f4>
+        return -E_NO_MEM;
+  803bfd:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803c03:	e9 a6 fe ff ff       	jmp    803aae <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  803c08:	41 89 c7             	mov    %eax,%r15d
+  803c0b:	e9 9e fe ff ff       	jmp    803aae <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  803c10:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803c16:	e9 93 fe ff ff       	jmp    803aae <mmap+0x1f4>
+
+0000000000803c1b <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803c1b:	55                   	push   %rbp
+  803c1c:	48 89 e5             	mov    %rsp,%rbp
+  803c1f:	41 54                	push   %r12
+  803c21:	53                   	push   %rbx
+  803c22:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803c25:	48 b8 33 1b 80 00 00 	movabs $0x801b33,%rax
+  803c2c:	00 00 00 
+  803c2f:	ff d0                	call   *%rax
+  803c31:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803c34:	48 be a0 52 80 00 00 	movabs $0x8052a0,%rsi
+  803c3b:	00 00 00 
+  803c3e:	48 89 df             	mov    %rbx,%rdi
+  803c41:	48 b8 a8 0e 80 00 00 	movabs $0x800ea8,%rax
+  803c48:	00 00 00 
+  803c4b:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803c4d:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803c52:	41 2b 04 24          	sub    (%r12),%eax
+  803c56:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803c5c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803c63:	00 00 00 
+    stat->st_dev = &devpipe;
+  803c66:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803c6d:	00 00 00 
+  803c70:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803c77:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c7c:	5b                   	pop    %rbx
+  803c7d:	41 5c                	pop    %r12
+  803c7f:	5d                   	pop    %rbp
+  803c80:	c3                   	ret
+
+0000000000803c81 <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  803c81:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803c84:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  803c8a:	8b 17                	mov    (%rdi),%edx
+  803c8c:	85 d2                	test   %edx,%edx
+  803c8e:	75 01                	jne    803c91 <pipe_wakeup+0x10>
+  803c90:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  803c91:	55                   	push   %rbp
+  803c92:	48 89 e5             	mov    %rsp,%rbp
+  803c95:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  803c98:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  803c9e:	be 00 04 00 00       	mov    $0x400,%esi
+  803ca3:	48 b8 93 17 80 00 00 	movabs $0x801793,%rax
+  803caa:	00 00 00 
+  803cad:	ff d0                	call   *%rax
+}
+  803caf:	5d                   	pop    %rbp
+  803cb0:	c3                   	ret
+
+0000000000803cb1 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803cb1:	55                   	push   %rbp
+  803cb2:	48 89 e5             	mov    %rsp,%rbp
+  803cb5:	41 55                	push   %r13
+  803cb7:	41 54                	push   %r12
+  803cb9:	53                   	push   %rbx
+  803cba:	48 83 ec 08          	sub    $0x8,%rsp
+  803cbe:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803cc1:	48 b8 33 1b 80 00 00 	movabs $0x801b33,%rax
+  803cc8:	00 00 00 
+  803ccb:	ff d0                	call   *%rax
+  803ccd:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803cd0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803cd5:	4c 89 e6             	mov    %r12,%rsi
+  803cd8:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cdd:	49 bc ad 14 80 00 00 	movabs $0x8014ad,%r12
+  803ce4:	00 00 00 
+  803ce7:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803cea:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803cee:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803cf2:	49 bd 81 3c 80 00 00 	movabs $0x803c81,%r13
+  803cf9:	00 00 00 
+  803cfc:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803cff:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803d03:	48 89 de             	mov    %rbx,%rsi
+  803d06:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  803d09:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d0e:	48 89 de             	mov    %rbx,%rsi
+  803d11:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d16:	41 ff d4             	call   *%r12
+  803d19:	48 83 c4 08          	add    $0x8,%rsp
+  803d1d:	5b                   	pop    %rbx
+  803d1e:	41 5c                	pop    %r12
+  803d20:	41 5d                	pop    %r13
+  803d22:	5d                   	pop    %rbp
+  803d23:	c3                   	ret
+
+0000000000803d24 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  803d24:	55                   	push   %rbp
+  803d25:	48 89 e5             	mov    %rsp,%rbp
+  803d28:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803d2b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803d30:	be 00 10 00 00       	mov    $0x1000,%esi
+  803d35:	48 b8 f0 13 80 00 00 	movabs $0x8013f0,%rax
+  803d3c:	00 00 00 
+  803d3f:	ff d0                	call   *%rax
+  803d41:	85 c0                	test   %eax,%eax
+  803d43:	0f 94 c0             	sete   %al
+  803d46:	0f b6 c0             	movzbl %al,%eax
+}
+  803d49:	5d                   	pop    %rbp
+  803d4a:	c3                   	ret
+
+0000000000803d4b <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803d4b:	55                   	push   %rbp
+  803d4c:	48 89 e5             	mov    %rsp,%rbp
+  803d4f:	41 57                	push   %r15
+  803d51:	41 56                	push   %r14
+  803d53:	41 55                	push   %r13
+  803d55:	41 54                	push   %r12
+  803d57:	53                   	push   %rbx
+  803d58:	48 83 ec 38          	sub    $0x38,%rsp
+  803d5c:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803d60:	49 89 f4             	mov    %rsi,%r12
+  803d63:	49 89 d7             	mov    %rdx,%r15
+  803d66:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803d6a:	48 b8 33 1b 80 00 00 	movabs $0x801b33,%rax
+  803d71:	00 00 00 
+  803d74:	ff d0                	call   *%rax
+  803d76:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803d79:	4d 85 ff             	test   %r15,%r15
+  803d7c:	0f 84 f1 00 00 00    	je     803e73 <devpipe_write+0x128>
+  803d82:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  803d86:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  803d8a:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  803d8e:	49 bd 24 3d 80 00 00 	movabs $0x803d24,%r13
+  803d95:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803d98:	49 bf 81 3c 80 00 00 	movabs $0x803c81,%r15
+  803d9f:	00 00 00 
+  803da2:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803da6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803daa:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803dae:	8b 73 04             	mov    0x4(%rbx),%esi
+  803db1:	48 63 ce             	movslq %esi,%rcx
+  803db4:	48 63 03             	movslq (%rbx),%rax
+  803db7:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  803dbd:	48 39 c1             	cmp    %rax,%rcx
+  803dc0:	72 64                	jb     803e26 <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  803dc2:	48 89 de             	mov    %rbx,%rsi
+  803dc5:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803dc9:	41 ff d5             	call   *%r13
+  803dcc:	85 c0                	test   %eax,%eax
+  803dce:	0f 85 b9 00 00 00    	jne    803e8d <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803dd4:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803dd8:	4c 89 f7             	mov    %r14,%rdi
+  803ddb:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  803dde:	8b 43 04             	mov    0x4(%rbx),%eax
+  803de1:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  803de8:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803def:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803df5:	8b 03                	mov    (%rbx),%eax
+  803df7:	41 39 c4             	cmp    %eax,%r12d
+  803dfa:	75 b2                	jne    803dae <devpipe_write+0x63>
+  803dfc:	48 89 de             	mov    %rbx,%rsi
+  803dff:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803e03:	41 ff d5             	call   *%r13
+  803e06:	85 c0                	test   %eax,%eax
+  803e08:	75 a0                	jne    803daa <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803e0a:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803e0f:	44 89 e6             	mov    %r12d,%esi
+  803e12:	48 89 df             	mov    %rbx,%rdi
+  803e15:	48 b8 75 17 80 00 00 	movabs $0x801775,%rax
+  803e1c:	00 00 00 
+  803e1f:	ff d0                	call   *%rax
+  803e21:	e9 7c ff ff ff       	jmp    803da2 <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803e26:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  803e2a:	41 0f b6 38          	movzbl (%r8),%edi
+  803e2e:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803e35:	80 80 80 
+  803e38:	48 89 c8             	mov    %rcx,%rax
+  803e3b:	48 f7 e2             	mul    %rdx
+  803e3e:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803e42:	48 89 d0             	mov    %rdx,%rax
+  803e45:	48 c1 e0 08          	shl    $0x8,%rax
+  803e49:	48 29 d0             	sub    %rdx,%rax
+  803e4c:	48 c1 e0 04          	shl    $0x4,%rax
+  803e50:	48 29 c1             	sub    %rax,%rcx
+  803e53:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  803e58:	83 c6 01             	add    $0x1,%esi
+  803e5b:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803e5e:	49 83 c0 01          	add    $0x1,%r8
+  803e62:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  803e66:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803e6a:	49 39 c0             	cmp    %rax,%r8
+  803e6d:	0f 85 2f ff ff ff    	jne    803da2 <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803e73:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803e77:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803e7b:	48 b8 81 3c 80 00 00 	movabs $0x803c81,%rax
+  803e82:	00 00 00 
+  803e85:	ff d0                	call   *%rax
+    return n;
+  803e87:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803e8b:	eb 05                	jmp    803e92 <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  803e8d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e92:	48 83 c4 38          	add    $0x38,%rsp
+  803e96:	5b                   	pop    %rbx
+  803e97:	41 5c                	pop    %r12
+  803e99:	41 5d                	pop    %r13
+  803e9b:	41 5e                	pop    %r14
+  803e9d:	41 5f                	pop    %r15
+  803e9f:	5d                   	pop    %rbp
+  803ea0:	c3                   	ret
+
+0000000000803ea1 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803ea1:	55                   	push   %rbp
+  803ea2:	48 89 e5             	mov    %rsp,%rbp
+  803ea5:	41 57                	push   %r15
+  803ea7:	41 56                	push   %r14
+  803ea9:	41 55                	push   %r13
+  803eab:	41 54                	push   %r12
+  803ead:	53                   	push   %rbx
+  803eae:	48 83 ec 28          	sub    $0x28,%rsp
+  803eb2:	49 89 fd             	mov    %rdi,%r13
+  803eb5:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  803eb9:	49 89 d4             	mov    %rdx,%r12
+  803ebc:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803ec0:	48 b8 33 1b 80 00 00 	movabs $0x801b33,%rax
+  803ec7:	00 00 00 
+  803eca:	ff d0                	call   *%rax
+  803ecc:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803ecf:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  803ed5:	49 bf 24 3d 80 00 00 	movabs $0x803d24,%r15
+  803edc:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803edf:	4d 85 e4             	test   %r12,%r12
+  803ee2:	0f 84 d5 00 00 00    	je     803fbd <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803ee8:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803eec:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803ef0:	8b 03                	mov    (%rbx),%eax
+  803ef2:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803ef5:	75 7a                	jne    803f71 <devpipe_read+0xd0>
+            if (i > 0) {
+  803ef7:	4d 85 f6             	test   %r14,%r14
+  803efa:	75 50                	jne    803f4c <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  803efc:	48 89 de             	mov    %rbx,%rsi
+  803eff:	4c 89 ef             	mov    %r13,%rdi
+  803f02:	41 ff d7             	call   *%r15
+  803f05:	85 c0                	test   %eax,%eax
+  803f07:	0f 85 c9 00 00 00    	jne    803fd6 <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803f0d:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  803f10:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803f17:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803f1d:	8b 43 04             	mov    0x4(%rbx),%eax
+  803f20:	41 39 c4             	cmp    %eax,%r12d
+  803f23:	75 cb                	jne    803ef0 <devpipe_read+0x4f>
+  803f25:	48 89 de             	mov    %rbx,%rsi
+  803f28:	4c 89 ef             	mov    %r13,%rdi
+  803f2b:	41 ff d7             	call   *%r15
+  803f2e:	85 c0                	test   %eax,%eax
+  803f30:	75 be                	jne    803ef0 <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803f32:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803f37:	44 89 e6             	mov    %r12d,%esi
+  803f3a:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803f3e:	48 b8 75 17 80 00 00 	movabs $0x801775,%rax
+  803f45:	00 00 00 
+  803f48:	ff d0                	call   *%rax
+  803f4a:	eb a4                	jmp    803ef0 <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803f4c:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803f50:	48 89 de             	mov    %rbx,%rsi
+  803f53:	48 b8 81 3c 80 00 00 	movabs $0x803c81,%rax
+  803f5a:	00 00 00 
+  803f5d:	ff d0                	call   *%rax
+                return i;
+  803f5f:	4c 89 f0             	mov    %r14,%rax
+}
+  803f62:	48 83 c4 28          	add    $0x28,%rsp
+  803f66:	5b                   	pop    %rbx
+  803f67:	41 5c                	pop    %r12
+  803f69:	41 5d                	pop    %r13
+  803f6b:	41 5e                	pop    %r14
+  803f6d:	41 5f                	pop    %r15
+  803f6f:	5d                   	pop    %rbp
+  803f70:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803f71:	48 63 c8             	movslq %eax,%rcx
+  803f74:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803f7b:	80 80 80 
+  803f7e:	48 89 c8             	mov    %rcx,%rax
+  803f81:	48 f7 e2             	mul    %rdx
+  803f84:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803f88:	48 89 d0             	mov    %rdx,%rax
+  803f8b:	48 c1 e0 08          	shl    $0x8,%rax
+  803f8f:	48 29 d0             	sub    %rdx,%rax
+  803f92:	48 c1 e0 04          	shl    $0x4,%rax
+  803f96:	48 89 c2             	mov    %rax,%rdx
+  803f99:	48 89 c8             	mov    %rcx,%rax
+  803f9c:	48 29 d0             	sub    %rdx,%rax
+  803f9f:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  803fa4:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803fa8:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  803fac:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803faf:	49 83 c6 01          	add    $0x1,%r14
+  803fb3:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  803fb7:	0f 85 2b ff ff ff    	jne    803ee8 <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803fbd:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803fc1:	48 89 de             	mov    %rbx,%rsi
+  803fc4:	48 b8 81 3c 80 00 00 	movabs $0x803c81,%rax
+  803fcb:	00 00 00 
+  803fce:	ff d0                	call   *%rax
+    return n;
+  803fd0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803fd4:	eb 8c                	jmp    803f62 <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  803fd6:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fdb:	eb 85                	jmp    803f62 <devpipe_read+0xc1>
+
+0000000000803fdd <pipe>:
+pipe(int pfd[2]) {
+  803fdd:	55                   	push   %rbp
+  803fde:	48 89 e5             	mov    %rsp,%rbp
+  803fe1:	41 55                	push   %r13
+  803fe3:	41 54                	push   %r12
+  803fe5:	53                   	push   %rbx
+  803fe6:	48 83 ec 18          	sub    $0x18,%rsp
+  803fea:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803fed:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803ff1:	48 b8 4f 1b 80 00 00 	movabs $0x801b4f,%rax
+  803ff8:	00 00 00 
+  803ffb:	ff d0                	call   *%rax
+  803ffd:	89 c3                	mov    %eax,%ebx
+  803fff:	85 c0                	test   %eax,%eax
+  804001:	0f 88 a0 01 00 00    	js     8041a7 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  804007:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80400c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804011:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804015:	bf 00 00 00 00       	mov    $0x0,%edi
+  80401a:	48 b8 07 14 80 00 00 	movabs $0x801407,%rax
+  804021:	00 00 00 
+  804024:	ff d0                	call   *%rax
+  804026:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804028:	85 c0                	test   %eax,%eax
+  80402a:	0f 88 77 01 00 00    	js     8041a7 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804030:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  804034:	48 b8 4f 1b 80 00 00 	movabs $0x801b4f,%rax
+  80403b:	00 00 00 
+  80403e:	ff d0                	call   *%rax
+  804040:	89 c3                	mov    %eax,%ebx
+  804042:	85 c0                	test   %eax,%eax
+  804044:	0f 88 43 01 00 00    	js     80418d <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  80404a:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80404f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804054:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804058:	bf 00 00 00 00       	mov    $0x0,%edi
+  80405d:	48 b8 07 14 80 00 00 	movabs $0x801407,%rax
+  804064:	00 00 00 
+  804067:	ff d0                	call   *%rax
+  804069:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80406b:	85 c0                	test   %eax,%eax
+  80406d:	0f 88 1a 01 00 00    	js     80418d <pipe+0x1b0>
+    va = fd2data(fd0);
+  804073:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804077:	48 b8 33 1b 80 00 00 	movabs $0x801b33,%rax
+  80407e:	00 00 00 
+  804081:	ff d0                	call   *%rax
+  804083:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  804086:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80408b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804090:	48 89 c6             	mov    %rax,%rsi
+  804093:	bf 00 00 00 00       	mov    $0x0,%edi
+  804098:	48 b8 07 14 80 00 00 	movabs $0x801407,%rax
+  80409f:	00 00 00 
+  8040a2:	ff d0                	call   *%rax
+  8040a4:	89 c3                	mov    %eax,%ebx
+  8040a6:	85 c0                	test   %eax,%eax
+  8040a8:	0f 88 c5 00 00 00    	js     804173 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8040ae:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8040b2:	48 b8 33 1b 80 00 00 	movabs $0x801b33,%rax
+  8040b9:	00 00 00 
+  8040bc:	ff d0                	call   *%rax
+  8040be:	48 89 c1             	mov    %rax,%rcx
+  8040c1:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8040c7:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8040cd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8040d2:	4c 89 ee             	mov    %r13,%rsi
+  8040d5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040da:	48 b8 5d 14 80 00 00 	movabs $0x80145d,%rax
+  8040e1:	00 00 00 
+  8040e4:	ff d0                	call   *%rax
+  8040e6:	89 c3                	mov    %eax,%ebx
+  8040e8:	85 c0                	test   %eax,%eax
+  8040ea:	78 6e                	js     80415a <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8040ec:	be 00 10 00 00       	mov    $0x1000,%esi
+  8040f1:	4c 89 ef             	mov    %r13,%rdi
+  8040f4:	48 b8 cc 13 80 00 00 	movabs $0x8013cc,%rax
+  8040fb:	00 00 00 
+  8040fe:	ff d0                	call   *%rax
+  804100:	83 f8 02             	cmp    $0x2,%eax
+  804103:	0f 85 ab 00 00 00    	jne    8041b4 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  804109:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  804110:	00 00 
+  804112:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804116:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  804118:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80411c:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  804123:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804127:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  804129:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80412d:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  804134:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804138:	48 bb 21 1b 80 00 00 	movabs $0x801b21,%rbx
+  80413f:	00 00 00 
+  804142:	ff d3                	call   *%rbx
+  804144:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  804148:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80414c:	ff d3                	call   *%rbx
+  80414e:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  804153:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804158:	eb 4d                	jmp    8041a7 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  80415a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80415f:	4c 89 ee             	mov    %r13,%rsi
+  804162:	bf 00 00 00 00       	mov    $0x0,%edi
+  804167:	48 b8 ad 14 80 00 00 	movabs $0x8014ad,%rax
+  80416e:	00 00 00 
+  804171:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  804173:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804178:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80417c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804181:	48 b8 ad 14 80 00 00 	movabs $0x8014ad,%rax
+  804188:	00 00 00 
+  80418b:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80418d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804192:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804196:	bf 00 00 00 00       	mov    $0x0,%edi
+  80419b:	48 b8 ad 14 80 00 00 	movabs $0x8014ad,%rax
+  8041a2:	00 00 00 
+  8041a5:	ff d0                	call   *%rax
+}
+  8041a7:	89 d8                	mov    %ebx,%eax
+  8041a9:	48 83 c4 18          	add    $0x18,%rsp
+  8041ad:	5b                   	pop    %rbx
+  8041ae:	41 5c                	pop    %r12
+  8041b0:	41 5d                	pop    %r13
+  8041b2:	5d                   	pop    %rbp
+  8041b3:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8041b4:	48 b9 d0 52 80 00 00 	movabs $0x8052d0,%rcx
+  8041bb:	00 00 00 
+  8041be:	48 ba a7 52 80 00 00 	movabs $0x8052a7,%rdx
+  8041c5:	00 00 00 
+  8041c8:	be 50 00 00 00       	mov    $0x50,%esi
+  8041cd:	48 bf bc 52 80 00 00 	movabs $0x8052bc,%rdi
+  8041d4:	00 00 00 
+  8041d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041dc:	49 b8 33 04 80 00 00 	movabs $0x800433,%r8
+  8041e3:	00 00 00 
+  8041e6:	41 ff d0             	call   *%r8
+
+00000000008041e9 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8041e9:	55                   	push   %rbp
+  8041ea:	48 89 e5             	mov    %rsp,%rbp
+  8041ed:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8041f1:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8041f5:	48 b8 af 1b 80 00 00 	movabs $0x801baf,%rax
+  8041fc:	00 00 00 
+  8041ff:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804201:	85 c0                	test   %eax,%eax
+  804203:	78 23                	js     804228 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  804205:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804209:	48 b8 33 1b 80 00 00 	movabs $0x801b33,%rax
+  804210:	00 00 00 
+  804213:	ff d0                	call   *%rax
+  804215:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  804218:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80421c:	48 b8 24 3d 80 00 00 	movabs $0x803d24,%rax
+  804223:	00 00 00 
+  804226:	ff d0                	call   *%rax
+}
+  804228:	c9                   	leave
+  804229:	c3                   	ret
+
+000000000080422a <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80422a:	48 89 f8             	mov    %rdi,%rax
+  80422d:	48 c1 e8 27          	shr    $0x27,%rax
+  804231:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804238:	01 00 00 
+  80423b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80423f:	f6 c2 01             	test   $0x1,%dl
+  804242:	74 6d                	je     8042b1 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804244:	48 89 f8             	mov    %rdi,%rax
+  804247:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80424b:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804252:	01 00 00 
+  804255:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804259:	f6 c2 01             	test   $0x1,%dl
+  80425c:	74 62                	je     8042c0 <get_uvpt_entry+0x96>
+  80425e:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804265:	01 00 00 
+  804268:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80426c:	f6 c2 80             	test   $0x80,%dl
+  80426f:	75 4f                	jne    8042c0 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804271:	48 89 f8             	mov    %rdi,%rax
+  804274:	48 c1 e8 15          	shr    $0x15,%rax
+  804278:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80427f:	01 00 00 
+  804282:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804286:	f6 c2 01             	test   $0x1,%dl
+  804289:	74 44                	je     8042cf <get_uvpt_entry+0xa5>
+  80428b:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804292:	01 00 00 
+  804295:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804299:	f6 c2 80             	test   $0x80,%dl
+  80429c:	75 31                	jne    8042cf <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80429e:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8042a2:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8042a9:	01 00 00 
+  8042ac:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8042b0:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8042b1:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8042b8:	01 00 00 
+  8042bb:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8042bf:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8042c0:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8042c7:	01 00 00 
+  8042ca:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8042ce:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8042cf:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8042d6:	01 00 00 
+  8042d9:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8042dd:	c3                   	ret
+
+00000000008042de <get_prot>:
+
+int
+get_prot(void *va) {
+  8042de:	55                   	push   %rbp
+  8042df:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8042e2:	48 b8 2a 42 80 00 00 	movabs $0x80422a,%rax
+  8042e9:	00 00 00 
+  8042ec:	ff d0                	call   *%rax
+  8042ee:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8042f1:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8042f6:	89 c1                	mov    %eax,%ecx
+  8042f8:	83 c9 04             	or     $0x4,%ecx
+  8042fb:	f6 c2 01             	test   $0x1,%dl
+  8042fe:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  804301:	89 c1                	mov    %eax,%ecx
+  804303:	83 c9 02             	or     $0x2,%ecx
+  804306:	f6 c2 02             	test   $0x2,%dl
+  804309:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80430c:	89 c1                	mov    %eax,%ecx
+  80430e:	83 c9 01             	or     $0x1,%ecx
+  804311:	48 85 d2             	test   %rdx,%rdx
+  804314:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804317:	89 c1                	mov    %eax,%ecx
+  804319:	83 c9 40             	or     $0x40,%ecx
+  80431c:	f6 c6 04             	test   $0x4,%dh
+  80431f:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804322:	5d                   	pop    %rbp
+  804323:	c3                   	ret
+
+0000000000804324 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804324:	55                   	push   %rbp
+  804325:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804328:	48 b8 2a 42 80 00 00 	movabs $0x80422a,%rax
+  80432f:	00 00 00 
+  804332:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804334:	48 c1 e8 06          	shr    $0x6,%rax
+  804338:	83 e0 01             	and    $0x1,%eax
+}
+  80433b:	5d                   	pop    %rbp
+  80433c:	c3                   	ret
+
+000000000080433d <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80433d:	55                   	push   %rbp
+  80433e:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804341:	48 b8 2a 42 80 00 00 	movabs $0x80422a,%rax
+  804348:	00 00 00 
+  80434b:	ff d0                	call   *%rax
+  80434d:	83 e0 01             	and    $0x1,%eax
+}
+  804350:	5d                   	pop    %rbp
+  804351:	c3                   	ret
+
+0000000000804352 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  804352:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  804359:	01 00 00 
+  80435c:	a8 01                	test   $0x1,%al
+  80435e:	75 06                	jne    804366 <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  804360:	b8 00 00 00 00       	mov    $0x0,%eax
+  804365:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804366:	55                   	push   %rbp
+  804367:	48 89 e5             	mov    %rsp,%rbp
+  80436a:	41 57                	push   %r15
+  80436c:	41 56                	push   %r14
+  80436e:	41 55                	push   %r13
+  804370:	41 54                	push   %r12
+  804372:	53                   	push   %rbx
+  804373:	48 83 ec 28          	sub    $0x28,%rsp
+  804377:	49 89 fe             	mov    %rdi,%r14
+  80437a:	49 89 f7             	mov    %rsi,%r15
+  80437d:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  804384:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  804385:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  80438c:	01 00 00 
+  80438f:	e9 ae 00 00 00       	jmp    804442 <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  804394:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80439b:	49 83 ec 01          	sub    $0x1,%r12
+  80439f:	74 2d                	je     8043ce <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  8043a1:	48 89 d8             	mov    %rbx,%rax
+  8043a4:	48 c1 e8 0c          	shr    $0xc,%rax
+  8043a8:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  8043ad:	f6 c2 01             	test   $0x1,%dl
+  8043b0:	74 e2                	je     804394 <foreach_shared_region+0x42>
+  8043b2:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8043b7:	f6 c4 04             	test   $0x4,%ah
+  8043ba:	74 d8                	je     804394 <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  8043bc:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8043c3:	4c 89 fa             	mov    %r15,%rdx
+  8043c6:	48 89 df             	mov    %rbx,%rdi
+  8043c9:	41 ff d6             	call   *%r14
+  8043cc:	eb c6                	jmp    804394 <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  8043ce:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  8043d5:	00 
+  8043d6:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  8043db:	74 4a                	je     804427 <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  8043dd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8043e1:	48 c1 e8 15          	shr    $0x15,%rax
+  8043e5:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  8043ec:	01 00 00 
+  8043ef:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  8043f3:	a8 01                	test   $0x1,%al
+  8043f5:	74 d7                	je     8043ce <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  8043f7:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  8043fb:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  804402:	48 39 c3             	cmp    %rax,%rbx
+  804405:	73 c7                	jae    8043ce <foreach_shared_region+0x7c>
+  804407:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  80440e:	48 39 d0             	cmp    %rdx,%rax
+  804411:	4d 19 e4             	sbb    %r12,%r12
+  804414:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  80441b:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  804422:	e9 7a ff ff ff       	jmp    8043a1 <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  804427:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  80442e:	40 
+  80442f:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804433:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80443a:	00 00 00 
+  80443d:	48 39 c1             	cmp    %rax,%rcx
+  804440:	74 50                	je     804492 <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  804442:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804446:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80444a:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  804451:	01 00 00 
+  804454:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804458:	a8 01                	test   $0x1,%al
+  80445a:	74 cb                	je     804427 <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  80445c:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804460:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  804467:	48 39 c1             	cmp    %rax,%rcx
+  80446a:	73 bb                	jae    804427 <foreach_shared_region+0xd5>
+  80446c:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  804473:	48 39 d0             	cmp    %rdx,%rax
+  804476:	48 19 c0             	sbb    %rax,%rax
+  804479:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  80447f:	48 05 00 02 00 00    	add    $0x200,%rax
+  804485:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804489:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80448d:	e9 4b ff ff ff       	jmp    8043dd <foreach_shared_region+0x8b>
+  804492:	b8 00 00 00 00       	mov    $0x0,%eax
+  804497:	48 83 c4 28          	add    $0x28,%rsp
+  80449b:	5b                   	pop    %rbx
+  80449c:	41 5c                	pop    %r12
+  80449e:	41 5d                	pop    %r13
+  8044a0:	41 5e                	pop    %r14
+  8044a2:	41 5f                	pop    %r15
+  8044a4:	5d                   	pop    %rbp
+  8044a5:	c3                   	ret
+
+00000000008044a6 <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  8044a6:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  8044ac:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  8044b3:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  8044ba:	c3                   	ret
+
+00000000008044bb <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  8044bb:	8b 47 40             	mov    0x40(%rdi),%eax
+  8044be:	8b 17                	mov    (%rdi),%edx
+  8044c0:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  8044c2:	83 f8 0f             	cmp    $0xf,%eax
+  8044c5:	77 13                	ja     8044da <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  8044c7:	8b 47 40             	mov    0x40(%rdi),%eax
+  8044ca:	83 e0 0f             	and    $0xf,%eax
+  8044cd:	48 c1 e0 09          	shl    $0x9,%rax
+  8044d1:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  8044d8:	00 
+  8044d9:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  8044da:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8044df:	c3                   	ret
+
+00000000008044e0 <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  8044e0:	8b 47 40             	mov    0x40(%rdi),%eax
+  8044e3:	83 c0 01             	add    $0x1,%eax
+  8044e6:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8044e9:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  8044ef:	8b 57 04             	mov    0x4(%rdi),%edx
+  8044f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044f7:	85 d2                	test   %edx,%edx
+  8044f9:	75 04                	jne    8044ff <chan_publish+0x1f>
+  8044fb:	83 e0 01             	and    $0x1,%eax
+}
+  8044fe:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  8044ff:	87 47 04             	xchg   %eax,0x4(%rdi)
+  804502:	85 c0                	test   %eax,%eax
+  804504:	0f 95 c0             	setne  %al
+  804507:	0f b6 c0             	movzbl %al,%eax
+  80450a:	eb ef                	jmp    8044fb <chan_publish+0x1b>
+
+000000000080450c <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  80450c:	8b 47 40             	mov    0x40(%rdi),%eax
+  80450f:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  804511:	29 d0                	sub    %edx,%eax
+  804513:	83 e8 01             	sub    $0x1,%eax
+  804516:	83 f8 0f             	cmp    $0xf,%eax
+  804519:	77 12                	ja     80452d <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  80451b:	8b 07                	mov    (%rdi),%eax
+  80451d:	83 e0 0f             	and    $0xf,%eax
+  804520:	48 c1 e0 09          	shl    $0x9,%rax
+  804524:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  80452b:	00 
+  80452c:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  80452d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804532:	c3                   	ret
+
+0000000000804533 <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  804533:	8b 07                	mov    (%rdi),%eax
+  804535:	83 c0 01             	add    $0x1,%eax
+  804538:	89 07                	mov    %eax,(%rdi)
+}
+  80453a:	c3                   	ret
+
+000000000080453b <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  80453b:	55                   	push   %rbp
+  80453c:	48 89 e5             	mov    %rsp,%rbp
+  80453f:	53                   	push   %rbx
+  804540:	48 83 ec 08          	sub    $0x8,%rsp
+  804544:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  804547:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  80454e:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  804554:	48 b8 0c 45 80 00 00 	movabs $0x80450c,%rax
+  80455b:	00 00 00 
+  80455e:	ff d0                	call   *%rax
+  804560:	48 85 c0             	test   %rax,%rax
+  804563:	74 12                	je     804577 <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  804565:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  80456c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804571:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804575:	c9                   	leave
+  804576:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  804577:	b8 01 00 00 00       	mov    $0x1,%eax
+  80457c:	eb f3                	jmp    804571 <chan_arm+0x36>
+
+000000000080457e <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  80457e:	55                   	push   %rbp
+  80457f:	48 89 e5             	mov    %rsp,%rbp
+  804582:	41 56                	push   %r14
+  804584:	41 55                	push   %r13
+  804586:	41 54                	push   %r12
+  804588:	53                   	push   %rbx
+  804589:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  80458c:	49 bc 3b 45 80 00 00 	movabs $0x80453b,%r12
+  804593:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  804596:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  80459a:	49 bd 75 17 80 00 00 	movabs $0x801775,%r13
+  8045a1:	00 00 00 
+    while (chan_arm(r))
+  8045a4:	eb 0d                	jmp    8045b3 <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  8045a6:	8b 33                	mov    (%rbx),%esi
+  8045a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8045ad:	4c 89 f7             	mov    %r14,%rdi
+  8045b0:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  8045b3:	48 89 df             	mov    %rbx,%rdi
+  8045b6:	41 ff d4             	call   *%r12
+  8045b9:	84 c0                	test   %al,%al
+  8045bb:	75 e9                	jne    8045a6 <chan_wait+0x28>
+}
+  8045bd:	5b                   	pop    %rbx
+  8045be:	41 5c                	pop    %r12
+  8045c0:	41 5d                	pop    %r13
+  8045c2:	41 5e                	pop    %r14
+  8045c4:	5d                   	pop    %rbp
+  8045c5:	c3                   	ret
+
+00000000008045c6 <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  8045c6:	55                   	push   %rbp
+  8045c7:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  8045ca:	48 83 c7 40          	add    $0x40,%rdi
+  8045ce:	be 01 00 00 00       	mov    $0x1,%esi
+  8045d3:	48 b8 93 17 80 00 00 	movabs $0x801793,%rax
+  8045da:	00 00 00 
+  8045dd:	ff d0                	call   *%rax
+}
+  8045df:	5d                   	pop    %rbp
+  8045e0:	c3                   	ret
+
+00000000008045e1 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8045e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045e6:	c3                   	ret
+
+00000000008045e7 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8045e7:	55                   	push   %rbp
+  8045e8:	48 89 e5             	mov    %rsp,%rbp
+  8045eb:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8045ee:	48 be f4 52 80 00 00 	movabs $0x8052f4,%rsi
+  8045f5:	00 00 00 
+  8045f8:	48 b8 a8 0e 80 00 00 	movabs $0x800ea8,%rax
+  8045ff:	00 00 00 
+  804602:	ff d0                	call   *%rax
+    return 0;
+}
+  804604:	b8 00 00 00 00       	mov    $0x0,%eax
+  804609:	5d                   	pop    %rbp
+  80460a:	c3                   	ret
+
+000000000080460b <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80460b:	55                   	push   %rbp
+  80460c:	48 89 e5             	mov    %rsp,%rbp
+  80460f:	41 57                	push   %r15
+  804611:	41 56                	push   %r14
+  804613:	41 55                	push   %r13
+  804615:	41 54                	push   %r12
+  804617:	53                   	push   %rbx
+  804618:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80461f:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  804626:	48 85 d2             	test   %rdx,%rdx
+  804629:	74 7a                	je     8046a5 <devcons_write+0x9a>
+  80462b:	49 89 d6             	mov    %rdx,%r14
+  80462e:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804634:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  804639:	49 bf a2 10 80 00 00 	movabs $0x8010a2,%r15
+  804640:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804643:	4c 89 f3             	mov    %r14,%rbx
+  804646:	48 29 f3             	sub    %rsi,%rbx
+  804649:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80464e:	48 39 c3             	cmp    %rax,%rbx
+  804651:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804655:	4c 63 eb             	movslq %ebx,%r13
+  804658:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80465f:	48 01 c6             	add    %rax,%rsi
+  804662:	4c 89 ea             	mov    %r13,%rdx
+  804665:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80466c:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80466f:	4c 89 ee             	mov    %r13,%rsi
+  804672:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804679:	48 b8 cf 12 80 00 00 	movabs $0x8012cf,%rax
+  804680:	00 00 00 
+  804683:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804685:	41 01 dc             	add    %ebx,%r12d
+  804688:	49 63 f4             	movslq %r12d,%rsi
+  80468b:	4c 39 f6             	cmp    %r14,%rsi
+  80468e:	72 b3                	jb     804643 <devcons_write+0x38>
+    return res;
+  804690:	49 63 c4             	movslq %r12d,%rax
+}
+  804693:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80469a:	5b                   	pop    %rbx
+  80469b:	41 5c                	pop    %r12
+  80469d:	41 5d                	pop    %r13
+  80469f:	41 5e                	pop    %r14
+  8046a1:	41 5f                	pop    %r15
+  8046a3:	5d                   	pop    %rbp
+  8046a4:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8046a5:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8046ab:	eb e3                	jmp    804690 <devcons_write+0x85>
+
+00000000008046ad <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8046ad:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8046b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8046b5:	48 85 c0             	test   %rax,%rax
+  8046b8:	74 55                	je     80470f <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8046ba:	55                   	push   %rbp
+  8046bb:	48 89 e5             	mov    %rsp,%rbp
+  8046be:	41 55                	push   %r13
+  8046c0:	41 54                	push   %r12
+  8046c2:	53                   	push   %rbx
+  8046c3:	48 83 ec 08          	sub    $0x8,%rsp
+  8046c7:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8046ca:	48 bb ee 12 80 00 00 	movabs $0x8012ee,%rbx
+  8046d1:	00 00 00 
+  8046d4:	49 bc a3 13 80 00 00 	movabs $0x8013a3,%r12
+  8046db:	00 00 00 
+  8046de:	eb 03                	jmp    8046e3 <devcons_read+0x36>
+  8046e0:	41 ff d4             	call   *%r12
+  8046e3:	ff d3                	call   *%rbx
+  8046e5:	85 c0                	test   %eax,%eax
+  8046e7:	74 f7                	je     8046e0 <devcons_read+0x33>
+    if (c < 0) return c;
+  8046e9:	48 63 d0             	movslq %eax,%rdx
+  8046ec:	78 13                	js     804701 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8046ee:	ba 00 00 00 00       	mov    $0x0,%edx
+  8046f3:	83 f8 04             	cmp    $0x4,%eax
+  8046f6:	74 09                	je     804701 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8046f8:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8046fc:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804701:	48 89 d0             	mov    %rdx,%rax
+  804704:	48 83 c4 08          	add    $0x8,%rsp
+  804708:	5b                   	pop    %rbx
+  804709:	41 5c                	pop    %r12
+  80470b:	41 5d                	pop    %r13
+  80470d:	5d                   	pop    %rbp
+  80470e:	c3                   	ret
+  80470f:	48 89 d0             	mov    %rdx,%rax
+  804712:	c3                   	ret
+
+0000000000804713 <cputchar>:
+cputchar(int ch) {
+  804713:	55                   	push   %rbp
+  804714:	48 89 e5             	mov    %rsp,%rbp
+  804717:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  80471b:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80471f:	be 01 00 00 00       	mov    $0x1,%esi
+  804724:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  804728:	48 b8 cf 12 80 00 00 	movabs $0x8012cf,%rax
+  80472f:	00 00 00 
+  804732:	ff d0                	call   *%rax
+}
+  804734:	c9                   	leave
+  804735:	c3                   	ret
+
+0000000000804736 <getchar>:
+getchar(void) {
+  804736:	55                   	push   %rbp
+  804737:	48 89 e5             	mov    %rsp,%rbp
+  80473a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80473e:	ba 01 00 00 00       	mov    $0x1,%edx
+  804743:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  804747:	bf 00 00 00 00       	mov    $0x0,%edi
+  80474c:	48 b8 92 1e 80 00 00 	movabs $0x801e92,%rax
+  804753:	00 00 00 
+  804756:	ff d0                	call   *%rax
+  804758:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80475a:	85 c0                	test   %eax,%eax
+  80475c:	78 06                	js     804764 <getchar+0x2e>
+  80475e:	74 08                	je     804768 <getchar+0x32>
+  804760:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804764:	89 d0                	mov    %edx,%eax
+  804766:	c9                   	leave
+  804767:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  804768:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80476d:	eb f5                	jmp    804764 <getchar+0x2e>
+
+000000000080476f <iscons>:
+iscons(int fdnum) {
+  80476f:	55                   	push   %rbp
+  804770:	48 89 e5             	mov    %rsp,%rbp
+  804773:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804777:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80477b:	48 b8 af 1b 80 00 00 	movabs $0x801baf,%rax
+  804782:	00 00 00 
+  804785:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804787:	85 c0                	test   %eax,%eax
+  804789:	78 18                	js     8047a3 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80478b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80478f:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  804796:	00 00 00 
+  804799:	8b 00                	mov    (%rax),%eax
+  80479b:	39 02                	cmp    %eax,(%rdx)
+  80479d:	0f 94 c0             	sete   %al
+  8047a0:	0f b6 c0             	movzbl %al,%eax
+}
+  8047a3:	c9                   	leave
+  8047a4:	c3                   	ret
+
+00000000008047a5 <opencons>:
+opencons(void) {
+  8047a5:	55                   	push   %rbp
+  8047a6:	48 89 e5             	mov    %rsp,%rbp
+  8047a9:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8047ad:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8047b1:	48 b8 4f 1b 80 00 00 	movabs $0x801b4f,%rax
+  8047b8:	00 00 00 
+  8047bb:	ff d0                	call   *%rax
+  8047bd:	85 c0                	test   %eax,%eax
+  8047bf:	78 49                	js     80480a <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8047c1:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8047c6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8047cb:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8047cf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8047d4:	48 b8 07 14 80 00 00 	movabs $0x801407,%rax
+  8047db:	00 00 00 
+  8047de:	ff d0                	call   *%rax
+  8047e0:	85 c0                	test   %eax,%eax
+  8047e2:	78 26                	js     80480a <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8047e4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8047e8:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  8047ef:	00 00 
+  8047f1:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8047f3:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8047f7:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8047fe:	48 b8 21 1b 80 00 00 	movabs $0x801b21,%rax
+  804805:	00 00 00 
+  804808:	ff d0                	call   *%rax
+}
+  80480a:	c9                   	leave
+  80480b:	c3                   	ret
+
+000000000080480c <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  80480c:	55                   	push   %rbp
+  80480d:	48 89 e5             	mov    %rsp,%rbp
+  804810:	41 56                	push   %r14
+  804812:	41 55                	push   %r13
+  804814:	41 54                	push   %r12
+  804816:	53                   	push   %rbx
+  804817:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80481a:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  804821:	00 00 00 
+  804824:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804828:	74 27                	je     804851 <_handle_vectored_pagefault+0x45>
+  80482a:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  80482f:	49 bd 00 10 84 00 00 	movabs $0x841000,%r13
+  804836:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804839:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  80483c:	4c 89 e7             	mov    %r12,%rdi
+  80483f:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  804844:	84 c0                	test   %al,%al
+  804846:	75 45                	jne    80488d <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804848:	48 83 c3 01          	add    $0x1,%rbx
+  80484c:	49 3b 1e             	cmp    (%r14),%rbx
+  80484f:	72 eb                	jb     80483c <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  804851:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  804858:	00 
+  804859:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  80485e:	4d 8b 04 24          	mov    (%r12),%r8
+  804862:	48 ba 00 53 80 00 00 	movabs $0x805300,%rdx
+  804869:	00 00 00 
+  80486c:	be 1d 00 00 00       	mov    $0x1d,%esi
+  804871:	48 bf 30 53 80 00 00 	movabs $0x805330,%rdi
+  804878:	00 00 00 
+  80487b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804880:	49 ba 33 04 80 00 00 	movabs $0x800433,%r10
+  804887:	00 00 00 
+  80488a:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  80488d:	5b                   	pop    %rbx
+  80488e:	41 5c                	pop    %r12
+  804890:	41 5d                	pop    %r13
+  804892:	41 5e                	pop    %r14
+  804894:	5d                   	pop    %rbp
+  804895:	c3                   	ret
+
+0000000000804896 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  804896:	55                   	push   %rbp
+  804897:	48 89 e5             	mov    %rsp,%rbp
+  80489a:	53                   	push   %rbx
+  80489b:	48 83 ec 08          	sub    $0x8,%rsp
+  80489f:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  8048a2:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8048a9:	00 00 00 
+  8048ac:	80 38 00             	cmpb   $0x0,(%rax)
+  8048af:	0f 84 84 00 00 00    	je     804939 <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8048b5:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  8048bc:	00 00 00 
+  8048bf:	48 8b 10             	mov    (%rax),%rdx
+  8048c2:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  8048c7:	48 b9 00 10 84 00 00 	movabs $0x841000,%rcx
+  8048ce:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8048d1:	48 85 d2             	test   %rdx,%rdx
+  8048d4:	74 19                	je     8048ef <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  8048d6:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  8048da:	0f 84 e8 00 00 00    	je     8049c8 <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8048e0:	48 83 c0 01          	add    $0x1,%rax
+  8048e4:	48 39 d0             	cmp    %rdx,%rax
+  8048e7:	75 ed                	jne    8048d6 <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  8048e9:	48 83 fa 08          	cmp    $0x8,%rdx
+  8048ed:	74 1c                	je     80490b <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8048ef:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8048f3:	48 a3 48 10 84 00 00 	movabs %rax,0x841048
+  8048fa:	00 00 00 
+  8048fd:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  804904:	00 00 00 
+  804907:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  80490b:	48 b8 7a 13 80 00 00 	movabs $0x80137a,%rax
+  804912:	00 00 00 
+  804915:	ff d0                	call   *%rax
+  804917:	89 c7                	mov    %eax,%edi
+  804919:	48 be 8e 4a 80 00 00 	movabs $0x804a8e,%rsi
+  804920:	00 00 00 
+  804923:	48 b8 c5 15 80 00 00 	movabs $0x8015c5,%rax
+  80492a:	00 00 00 
+  80492d:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80492f:	85 c0                	test   %eax,%eax
+  804931:	78 68                	js     80499b <add_pgfault_handler+0x105>
+    return res;
+}
+  804933:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804937:	c9                   	leave
+  804938:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  804939:	48 b8 7a 13 80 00 00 	movabs $0x80137a,%rax
+  804940:	00 00 00 
+  804943:	ff d0                	call   *%rax
+  804945:	89 c7                	mov    %eax,%edi
+  804947:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80494c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804951:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  804958:	00 00 00 
+  80495b:	48 b8 07 14 80 00 00 	movabs $0x801407,%rax
+  804962:	00 00 00 
+  804965:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  804967:	48 ba 48 10 84 00 00 	movabs $0x841048,%rdx
+  80496e:	00 00 00 
+  804971:	48 8b 02             	mov    (%rdx),%rax
+  804974:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804978:	48 89 0a             	mov    %rcx,(%rdx)
+  80497b:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  804982:	00 00 00 
+  804985:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  804989:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  804990:	00 00 00 
+  804993:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  804996:	e9 70 ff ff ff       	jmp    80490b <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80499b:	89 c1                	mov    %eax,%ecx
+  80499d:	48 ba 3e 53 80 00 00 	movabs $0x80533e,%rdx
+  8049a4:	00 00 00 
+  8049a7:	be 3d 00 00 00       	mov    $0x3d,%esi
+  8049ac:	48 bf 30 53 80 00 00 	movabs $0x805330,%rdi
+  8049b3:	00 00 00 
+  8049b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049bb:	49 b8 33 04 80 00 00 	movabs $0x800433,%r8
+  8049c2:	00 00 00 
+  8049c5:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8049c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049cd:	e9 61 ff ff ff       	jmp    804933 <add_pgfault_handler+0x9d>
+
+00000000008049d2 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  8049d2:	55                   	push   %rbp
+  8049d3:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  8049d6:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8049dd:	00 00 00 
+  8049e0:	80 38 00             	cmpb   $0x0,(%rax)
+  8049e3:	74 33                	je     804a18 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8049e5:	48 a1 48 10 84 00 00 	movabs 0x841048,%rax
+  8049ec:	00 00 00 
+  8049ef:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  8049f4:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  8049fb:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8049fe:	48 85 c0             	test   %rax,%rax
+  804a01:	0f 84 85 00 00 00    	je     804a8c <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  804a07:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  804a0b:	74 40                	je     804a4d <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804a0d:	48 83 c1 01          	add    $0x1,%rcx
+  804a11:	48 39 c1             	cmp    %rax,%rcx
+  804a14:	75 f1                	jne    804a07 <remove_pgfault_handler+0x35>
+  804a16:	eb 74                	jmp    804a8c <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  804a18:	48 b9 56 53 80 00 00 	movabs $0x805356,%rcx
+  804a1f:	00 00 00 
+  804a22:	48 ba a7 52 80 00 00 	movabs $0x8052a7,%rdx
+  804a29:	00 00 00 
+  804a2c:	be 43 00 00 00       	mov    $0x43,%esi
+  804a31:	48 bf 30 53 80 00 00 	movabs $0x805330,%rdi
+  804a38:	00 00 00 
+  804a3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a40:	49 b8 33 04 80 00 00 	movabs $0x800433,%r8
+  804a47:	00 00 00 
+  804a4a:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  804a4d:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  804a54:	00 
+  804a55:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804a59:	48 29 ca             	sub    %rcx,%rdx
+  804a5c:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  804a63:	00 00 00 
+  804a66:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  804a6a:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  804a6f:	48 89 ce             	mov    %rcx,%rsi
+  804a72:	48 b8 a2 10 80 00 00 	movabs $0x8010a2,%rax
+  804a79:	00 00 00 
+  804a7c:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  804a7e:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  804a85:	00 00 00 
+  804a88:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  804a8c:	5d                   	pop    %rbp
+  804a8d:	c3                   	ret
+
+0000000000804a8e <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  804a8e:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  804a91:	48 b8 0c 48 80 00 00 	movabs $0x80480c,%rax
+  804a98:	00 00 00 
+    call *%rax
+  804a9b:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  804a9d:	41 5f                	pop    %r15
+	popq %r15
+  804a9f:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  804aa1:	41 5f                	pop    %r15
+	popq %r14
+  804aa3:	41 5e                	pop    %r14
+	popq %r13
+  804aa5:	41 5d                	pop    %r13
+	popq %r12
+  804aa7:	41 5c                	pop    %r12
+	popq %r11
+  804aa9:	41 5b                	pop    %r11
+	popq %r10
+  804aab:	41 5a                	pop    %r10
+	popq %r9
+  804aad:	41 59                	pop    %r9
+	popq %r8
+  804aaf:	41 58                	pop    %r8
+	popq %rsi
+  804ab1:	5e                   	pop    %rsi
+	popq %rdi
+  804ab2:	5f                   	pop    %rdi
+	popq %rbp
+  804ab3:	5d                   	pop    %rbp
+	popq %rdx
+  804ab4:	5a                   	pop    %rdx
+	popq %rcx
+  804ab5:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  804ab6:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  804abb:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  804ac0:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  804ac4:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  804ac7:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  804acc:	5b                   	pop    %rbx
+	popq %rax
+  804acd:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  804ace:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  804ad2:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  804ad3:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  804ad8:	c3                   	ret
+  804ad9:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000804ae0 <__rodata_start>:
+  804ae0:	74 65                	je     804b47 <__rodata_start+0x67>
+  804ae2:	73 74                	jae    804b58 <__rodata_start+0x78>
+  804ae4:	69 6e 67 20 66 6f 72 	imul   $0x726f6620,0x67(%rsi),%ebp
+  804aeb:	20 64 75 70          	and    %ah,0x70(%rbp,%rsi,2)
+  804aef:	20 72 61             	and    %dh,0x61(%rdx)
+  804af2:	63 65 2e             	movsxd 0x2e(%rbp),%esp
+  804af5:	2e 2e 0a 00          	cs cs or (%rax),%al
+  804af9:	70 69                	jo     804b64 <__rodata_start+0x84>
+  804afb:	70 65                	jo     804b62 <__rodata_start+0x82>
+  804afd:	3a 20                	cmp    (%rax),%ah
+  804aff:	25 69 00 75 73       	and    $0x73750069,%eax
+  804b04:	65 72 2f             	gs jb  804b36 <__rodata_start+0x56>
+  804b07:	74 65                	je     804b6e <__rodata_start+0x8e>
+  804b09:	73 74                	jae    804b7f <__rodata_start+0x9f>
+  804b0b:	70 69                	jo     804b76 <__rodata_start+0x96>
+  804b0d:	70 65                	jo     804b74 <__rodata_start+0x94>
+  804b0f:	72 61                	jb     804b72 <__rodata_start+0x92>
+  804b11:	63 65 2e             	movsxd 0x2e(%rbp),%esp
+  804b14:	63 00                	movsxd (%rax),%eax
+  804b16:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804b18:	72 6b                	jb     804b85 <__rodata_start+0xa5>
+  804b1a:	3a 20                	cmp    (%rax),%ah
+  804b1c:	25 69 00 52 41       	and    $0x41520069,%eax
+  804b21:	43                   	rex.XB
+  804b22:	45 3a 20             	cmp    (%r8),%r12b
+  804b25:	70 69                	jo     804b90 <__rodata_start+0xb0>
+  804b27:	70 65                	jo     804b8e <__rodata_start+0xae>
+  804b29:	20 61 70             	and    %ah,0x70(%rcx)
+  804b2c:	70 65                	jo     804b93 <__rodata_start+0xb3>
+  804b2e:	61                   	(bad)
+  804b2f:	72 73                	jb     804ba4 <__rodata_start+0xc4>
+  804b31:	20 63 6c             	and    %ah,0x6c(%rbx)
+  804b34:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b35:	73 65                	jae    804b9c <__rodata_start+0xbc>
+  804b37:	64 0a 00             	or     %fs:(%rax),%al
+  804b3a:	70 69                	jo     804ba5 <__rodata_start+0xc5>
+  804b3c:	64 20 69 73          	and    %ch,%fs:0x73(%rcx)
+  804b40:	20 25 64 0a 00 6b    	and    %ah,0x6b000a64(%rip)        # 6b8055aa <__bss_end+0x6afc35aa>
+  804b46:	69 64 20 69 73 20 25 	imul   $0x64252073,0x69(%rax,%riz,1),%esp
+  804b4d:	64 
+  804b4e:	0a 00                	or     (%rax),%al
+  804b50:	63 68 69             	movsxd 0x69(%rax),%ebp
+  804b53:	6c                   	insb   (%dx),%es:(%rdi)
+  804b54:	64 20 64 6f 6e       	and    %ah,%fs:0x6e(%rdi,%rbp,2)
+  804b59:	65 20 77 69          	and    %dh,%gs:0x69(%rdi)
+  804b5d:	74 68                	je     804bc7 <__rodata_start+0xe7>
+  804b5f:	20 6c 6f 6f          	and    %ch,0x6f(%rdi,%rbp,2)
+  804b63:	70 0a                	jo     804b6f <__rodata_start+0x8f>
+  804b65:	00 63 61             	add    %ah,0x61(%rbx)
+  804b68:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804b69:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804b6a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b6b:	74 20                	je     804b8d <__rodata_start+0xad>
+  804b6d:	6c                   	insb   (%dx),%es:(%rdi)
+  804b6e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b6f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b70:	6b 20 75             	imul   $0x75,(%rax),%esp
+  804b73:	70 20                	jo     804b95 <__rodata_start+0xb5>
+  804b75:	70 5b                	jo     804bd2 <__rodata_start+0xf2>
+  804b77:	30 5d 3a             	xor    %bl,0x3a(%rbp)
+  804b7a:	20 25 69 00 0a 63    	and    %ah,0x630a0069(%rip)        # 638a4be9 <__bss_end+0x63062be9>
+  804b80:	68 69 6c 64 20       	push   $0x20646c69
+  804b85:	64 65 74 65          	fs gs je 804bee <__rodata_start+0x10e>
+  804b89:	63 74 65 64          	movsxd 0x64(%rbp,%riz,2),%esi
+  804b8d:	20 72 61             	and    %dh,0x61(%rdx)
+  804b90:	63 65 0a             	movsxd 0xa(%rbp),%esp
+  804b93:	00 0f                	add    %cl,(%rdi)
+  804b95:	1f                   	(bad)
+  804b96:	40 00 73 6f          	add    %sil,0x6f(%rbx)
+  804b9a:	6d                   	insl   (%dx),%es:(%rdi)
+  804b9b:	65 68 6f 77 20 74    	gs push $0x7420776f
+  804ba1:	68 65 20 6f 74       	push   $0x746f2065
+  804ba6:	68 65 72 20 65       	push   $0x65207265
+  804bab:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804bac:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  804bb0:	20 70 5b             	and    %dh,0x5b(%rax)
+  804bb3:	30 5d 20             	xor    %bl,0x20(%rbp)
+  804bb6:	67 6f                	outsl  %ds:(%esi),(%dx)
+  804bb8:	74 20                	je     804bda <__rodata_start+0xfa>
+  804bba:	63 6c 6f 73          	movsxd 0x73(%rdi,%rbp,2),%ebp
+  804bbe:	65 64 21 00          	gs and %eax,%fs:(%rax)
+  804bc2:	00 00                	add    %al,(%rax)
+  804bc4:	00 00                	add    %al,(%rax)
+  804bc6:	00 00                	add    %al,(%rax)
+  804bc8:	0a 72 61             	or     0x61(%rdx),%dh
+  804bcb:	63 65 20             	movsxd 0x20(%rbp),%esp
+  804bce:	64 69 64 6e 27 74 20 	imul   $0x61682074,%fs:0x27(%rsi,%rbp,2),%esp
+  804bd5:	68 61 
+  804bd7:	70 70                	jo     804c49 <__rodata_start+0x169>
+  804bd9:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804bdb:	20 28                	and    %ch,(%rax)
+  804bdd:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804bde:	75 6d                	jne    804c4d <__rodata_start+0x16d>
+  804be0:	62 65                	(bad)
+  804be2:	72 20                	jb     804c04 <__rodata_start+0x124>
+  804be4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804be5:	66 20 74 65 73       	data16 and %dh,0x73(%rbp,%riz,2)
+  804bea:	74 73                	je     804c5f <__rodata_start+0x17f>
+  804bec:	3a 20                	cmp    (%rax),%ah
+  804bee:	25 64 29 0a 00       	and    $0xa2964,%eax
+  804bf3:	3c 75                	cmp    $0x75,%al
+  804bf5:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804bf6:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  804bfa:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804bfb:	3e 00 0f             	ds add %cl,(%rdi)
+  804bfe:	1f                   	(bad)
+  804bff:	00 5b 25             	add    %bl,0x25(%rbx)
+  804c02:	30 38                	xor    %bh,(%rax)
+  804c04:	78 5d                	js     804c63 <__rodata_start+0x183>
+  804c06:	20 75 73             	and    %dh,0x73(%rbp)
+  804c09:	65 72 20             	gs jb  804c2c <__rodata_start+0x14c>
+  804c0c:	70 61                	jo     804c6f <__rodata_start+0x18f>
+  804c0e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804c0f:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  804c16:	73 20                	jae    804c38 <__rodata_start+0x158>
+  804c18:	61                   	(bad)
+  804c19:	74 20                	je     804c3b <__rodata_start+0x15b>
+  804c1b:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  804c20:	3a 20                	cmp    (%rax),%ah
+  804c22:	00 30                	add    %dh,(%rax)
+  804c24:	31 32                	xor    %esi,(%rdx)
+  804c26:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  804c2d:	41                   	rex.B
+  804c2e:	42                   	rex.X
+  804c2f:	43                   	rex.XB
+  804c30:	44                   	rex.R
+  804c31:	45                   	rex.RB
+  804c32:	46 00 30             	rex.RX add %r14b,(%rax)
+  804c35:	31 32                	xor    %esi,(%rdx)
+  804c37:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  804c3e:	61                   	(bad)
+  804c3f:	62 63 64 65 66       	(bad)
+  804c44:	00 28                	add    %ch,(%rax)
+  804c46:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804c47:	75 6c                	jne    804cb5 <__rodata_start+0x1d5>
+  804c49:	6c                   	insb   (%dx),%es:(%rdi)
+  804c4a:	29 00                	sub    %eax,(%rax)
+  804c4c:	65 72 72             	gs jb  804cc1 <__rodata_start+0x1e1>
+  804c4f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804c50:	72 20                	jb     804c72 <__rodata_start+0x192>
+  804c52:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  804c57:	73 70                	jae    804cc9 <__rodata_start+0x1e9>
+  804c59:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  804c5d:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  804c64:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804c65:	72 00                	jb     804c67 <__rodata_start+0x187>
+  804c67:	62 61 64 20 65       	(bad)
+  804c6c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804c6d:	76 69                	jbe    804cd8 <__rodata_start+0x1f8>
+  804c6f:	72 6f                	jb     804ce0 <__rodata_start+0x200>
+  804c71:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804c72:	6d                   	insl   (%dx),%es:(%rdi)
+  804c73:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804c75:	74 00                	je     804c77 <__rodata_start+0x197>
+  804c77:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  804c7e:	20 70 61             	and    %dh,0x61(%rax)
+  804c81:	72 61                	jb     804ce4 <__rodata_start+0x204>
+  804c83:	6d                   	insl   (%dx),%es:(%rdi)
+  804c84:	65 74 65             	gs je  804cec <__rodata_start+0x20c>
+  804c87:	72 00                	jb     804c89 <__rodata_start+0x1a9>
+  804c89:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804c8a:	75 74                	jne    804d00 <__rodata_start+0x220>
+  804c8c:	20 6f 66             	and    %ch,0x66(%rdi)
+  804c8f:	20 6d 65             	and    %ch,0x65(%rbp)
+  804c92:	6d                   	insl   (%dx),%es:(%rdi)
+  804c93:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804c94:	72 79                	jb     804d0f <__rodata_start+0x22f>
+  804c96:	00 6f 75             	add    %ch,0x75(%rdi)
+  804c99:	74 20                	je     804cbb <__rodata_start+0x1db>
+  804c9b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804c9c:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  804ca0:	76 69                	jbe    804d0b <__rodata_start+0x22b>
+  804ca2:	72 6f                	jb     804d13 <__rodata_start+0x233>
+  804ca4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804ca5:	6d                   	insl   (%dx),%es:(%rdi)
+  804ca6:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804ca8:	74 73                	je     804d1d <__rodata_start+0x23d>
+  804caa:	00 63 6f             	add    %ah,0x6f(%rbx)
+  804cad:	72 72                	jb     804d21 <__rodata_start+0x241>
+  804caf:	75 70                	jne    804d21 <__rodata_start+0x241>
+  804cb1:	74 65                	je     804d18 <__rodata_start+0x238>
+  804cb3:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  804cb8:	75 67                	jne    804d21 <__rodata_start+0x241>
+  804cba:	20 69 6e             	and    %ch,0x6e(%rcx)
+  804cbd:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804cbf:	00 73 65             	add    %dh,0x65(%rbx)
+  804cc2:	67 6d                	insl   (%dx),%es:(%edi)
+  804cc4:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804cc6:	74 61                	je     804d29 <__rodata_start+0x249>
+  804cc8:	74 69                	je     804d33 <__rodata_start+0x253>
+  804cca:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804ccb:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804ccc:	20 66 61             	and    %ah,0x61(%rsi)
+  804ccf:	75 6c                	jne    804d3d <__rodata_start+0x25d>
+  804cd1:	74 00                	je     804cd3 <__rodata_start+0x1f3>
+  804cd3:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  804cda:	20 45 4c             	and    %al,0x4c(%rbp)
+  804cdd:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  804ce1:	61                   	(bad)
+  804ce2:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  804ce7:	20 73 75             	and    %dh,0x75(%rbx)
+  804cea:	63 68 20             	movsxd 0x20(%rax),%ebp
+  804ced:	73 79                	jae    804d68 <__rodata_start+0x288>
+  804cef:	73 74                	jae    804d65 <__rodata_start+0x285>
+  804cf1:	65 6d                	gs insl (%dx),%es:(%rdi)
+  804cf3:	20 63 61             	and    %ah,0x61(%rbx)
+  804cf6:	6c                   	insb   (%dx),%es:(%rdi)
+  804cf7:	6c                   	insb   (%dx),%es:(%rdi)
+  804cf8:	00 65 6e             	add    %ah,0x6e(%rbp)
+  804cfb:	74 72                	je     804d6f <__rodata_start+0x28f>
+  804cfd:	79 20                	jns    804d1f <__rodata_start+0x23f>
+  804cff:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804d00:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804d01:	74 20                	je     804d23 <__rodata_start+0x243>
+  804d03:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804d05:	75 6e                	jne    804d75 <__rodata_start+0x295>
+  804d07:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  804d0b:	76 20                	jbe    804d2d <__rodata_start+0x24d>
+  804d0d:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  804d14:	72 65                	jb     804d7b <__rodata_start+0x29b>
+  804d16:	63 76 69             	movsxd 0x69(%rsi),%esi
+  804d19:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804d1a:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  804d1e:	65 78 70             	gs js  804d91 <__rodata_start+0x2b1>
+  804d21:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  804d26:	20 65 6e             	and    %ah,0x6e(%rbp)
+  804d29:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  804d2d:	20 66 69             	and    %ah,0x69(%rsi)
+  804d30:	6c                   	insb   (%dx),%es:(%rdi)
+  804d31:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  804d35:	20 66 72             	and    %ah,0x72(%rsi)
+  804d38:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  804d3d:	61                   	(bad)
+  804d3e:	63 65 20             	movsxd 0x20(%rbp),%esp
+  804d41:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804d42:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804d43:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  804d47:	6b 00 74             	imul   $0x74,(%rax),%eax
+  804d4a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804d4b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804d4c:	20 6d 61             	and    %ch,0x61(%rbp)
+  804d4f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804d50:	79 20                	jns    804d72 <__rodata_start+0x292>
+  804d52:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  804d59:	72 65                	jb     804dc0 <__rodata_start+0x2e0>
+  804d5b:	20 6f 70             	and    %ch,0x70(%rdi)
+  804d5e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804d60:	00 66 69             	add    %ah,0x69(%rsi)
+  804d63:	6c                   	insb   (%dx),%es:(%rdi)
+  804d64:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  804d68:	20 62 6c             	and    %ah,0x6c(%rdx)
+  804d6b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804d6c:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  804d6f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804d70:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804d71:	74 20                	je     804d93 <__rodata_start+0x2b3>
+  804d73:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804d75:	75 6e                	jne    804de5 <__rodata_start+0x305>
+  804d77:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  804d7b:	76 61                	jbe    804dde <__rodata_start+0x2fe>
+  804d7d:	6c                   	insb   (%dx),%es:(%rdi)
+  804d7e:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  804d85:	00 
+  804d86:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  804d8d:	72 65                	jb     804df4 <__rodata_start+0x314>
+  804d8f:	61                   	(bad)
+  804d90:	64 79 20             	fs jns 804db3 <__rodata_start+0x2d3>
+  804d93:	65 78 69             	gs js  804dff <__rodata_start+0x31f>
+  804d96:	73 74                	jae    804e0c <__rodata_start+0x32c>
+  804d98:	73 00                	jae    804d9a <__rodata_start+0x2ba>
+  804d9a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804d9b:	70 65                	jo     804e02 <__rodata_start+0x322>
+  804d9d:	72 61                	jb     804e00 <__rodata_start+0x320>
+  804d9f:	74 69                	je     804e0a <__rodata_start+0x32a>
+  804da1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804da2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804da3:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  804da6:	74 20                	je     804dc8 <__rodata_start+0x2e8>
+  804da8:	73 75                	jae    804e1f <__rodata_start+0x33f>
+  804daa:	70 70                	jo     804e1c <__rodata_start+0x33c>
+  804dac:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804dad:	72 74                	jb     804e23 <__rodata_start+0x343>
+  804daf:	65 64 00 74 72 79    	gs add %dh,%fs:0x79(%rdx,%rsi,2)
+  804db5:	20 61 67             	and    %ah,0x67(%rcx)
+  804db8:	61                   	(bad)
+  804db9:	69 6e 00 74 69 6d 65 	imul   $0x656d6974,0x0(%rsi),%ebp
+  804dc0:	64 20 6f 75          	and    %ch,%fs:0x75(%rdi)
+  804dc4:	74 00                	je     804dc6 <__rodata_start+0x2e6>
+  804dc6:	66 69 6c 65 20 69 73 	imul   $0x7369,0x20(%rbp,%riz,2),%bp
+  804dcd:	20 69 6e             	and    %ch,0x6e(%rcx)
+  804dd0:	20 75 73             	and    %dh,0x73(%rbp)
+  804dd3:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  804dd7:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  804dde:	00 
+  804ddf:	90                   	nop
+  804de0:	70 07                	jo     804de9 <__rodata_start+0x309>
+  804de2:	80 00 00             	addb   $0x0,(%rax)
+  804de5:	00 00                	add    %al,(%rax)
+  804de7:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  804ded:	00 00                	add    %al,(%rax)
+  804def:	00 a1 0d 80 00 00    	add    %ah,0x800d(%rcx)
+  804df5:	00 00                	add    %al,(%rax)
+  804df7:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  804dfd:	00 00                	add    %al,(%rax)
+  804dff:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  804e05:	00 00                	add    %al,(%rax)
+  804e07:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  804e0d:	00 00                	add    %al,(%rax)
+  804e0f:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  804e15:	00 00                	add    %al,(%rax)
+  804e17:	00 8f 07 80 00 00    	add    %cl,0x8007(%rdi)
+  804e1d:	00 00                	add    %al,(%rax)
+  804e1f:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  804e25:	00 00                	add    %al,(%rax)
+  804e27:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  804e2d:	00 00                	add    %al,(%rax)
+  804e2f:	00 83 07 80 00 00    	add    %al,0x8007(%rbx)
+  804e35:	00 00                	add    %al,(%rax)
+  804e37:	00 fd                	add    %bh,%ch
+  804e39:	07                   	(bad)
+  804e3a:	80 00 00             	addb   $0x0,(%rax)
+  804e3d:	00 00                	add    %al,(%rax)
+  804e3f:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  804e45:	00 00                	add    %al,(%rax)
+  804e47:	00 83 07 80 00 00    	add    %al,0x8007(%rbx)
+  804e4d:	00 00                	add    %al,(%rax)
+  804e4f:	00 c9                	add    %cl,%cl
+  804e51:	07                   	(bad)
+  804e52:	80 00 00             	addb   $0x0,(%rax)
+  804e55:	00 00                	add    %al,(%rax)
+  804e57:	00 c9                	add    %cl,%cl
+  804e59:	07                   	(bad)
+  804e5a:	80 00 00             	addb   $0x0,(%rax)
+  804e5d:	00 00                	add    %al,(%rax)
+  804e5f:	00 c9                	add    %cl,%cl
+  804e61:	07                   	(bad)
+  804e62:	80 00 00             	addb   $0x0,(%rax)
+  804e65:	00 00                	add    %al,(%rax)
+  804e67:	00 c9                	add    %cl,%cl
+  804e69:	07                   	(bad)
+  804e6a:	80 00 00             	addb   $0x0,(%rax)
+  804e6d:	00 00                	add    %al,(%rax)
+  804e6f:	00 c9                	add    %cl,%cl
+  804e71:	07                   	(bad)
+  804e72:	80 00 00             	addb   $0x0,(%rax)
+  804e75:	00 00                	add    %al,(%rax)
+  804e77:	00 c9                	add    %cl,%cl
+  804e79:	07                   	(bad)
+  804e7a:	80 00 00             	addb   $0x0,(%rax)
+  804e7d:	00 00                	add    %al,(%rax)
+  804e7f:	00 c9                	add    %cl,%cl
+  804e81:	07                   	(bad)
+  804e82:	80 00 00             	addb   $0x0,(%rax)
+  804e85:	00 00                	add    %al,(%rax)
+  804e87:	00 c9                	add    %cl,%cl
+  804e89:	07                   	(bad)
+  804e8a:	80 00 00             	addb   $0x0,(%rax)
+  804e8d:	00 00                	add    %al,(%rax)
+  804e8f:	00 c9                	add    %cl,%cl
+  804e91:	07                   	(bad)
+  804e92:	80 00 00             	addb   $0x0,(%rax)
+  804e95:	00 00                	add    %al,(%rax)
+  804e97:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  804e9d:	00 00                	add    %al,(%rax)
+  804e9f:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  804ea5:	00 00                	add    %al,(%rax)
+  804ea7:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  804ead:	00 00                	add    %al,(%rax)
+  804eaf:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  804eb5:	00 00                	add    %al,(%rax)
+  804eb7:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  804ebd:	00 00                	add    %al,(%rax)
+  804ebf:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  804ec5:	00 00                	add    %al,(%rax)
+  804ec7:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  804ecd:	00 00                	add    %al,(%rax)
+  804ecf:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  804ed5:	00 00                	add    %al,(%rax)
+  804ed7:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  804edd:	00 00                	add    %al,(%rax)
+  804edf:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  804ee5:	00 00                	add    %al,(%rax)
+  804ee7:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  804eed:	00 00                	add    %al,(%rax)
+  804eef:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  804ef5:	00 00                	add    %al,(%rax)
+  804ef7:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  804efd:	00 00                	add    %al,(%rax)
+  804eff:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  804f05:	00 00                	add    %al,(%rax)
+  804f07:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  804f0d:	00 00                	add    %al,(%rax)
+  804f0f:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  804f15:	00 00                	add    %al,(%rax)
+  804f17:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  804f1d:	00 00                	add    %al,(%rax)
+  804f1f:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  804f25:	00 00                	add    %al,(%rax)
+  804f27:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  804f2d:	00 00                	add    %al,(%rax)
+  804f2f:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  804f35:	00 00                	add    %al,(%rax)
+  804f37:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  804f3d:	00 00                	add    %al,(%rax)
+  804f3f:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  804f45:	00 00                	add    %al,(%rax)
+  804f47:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  804f4d:	00 00                	add    %al,(%rax)
+  804f4f:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  804f55:	00 00                	add    %al,(%rax)
+  804f57:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  804f5d:	00 00                	add    %al,(%rax)
+  804f5f:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  804f65:	00 00                	add    %al,(%rax)
+  804f67:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  804f6d:	00 00                	add    %al,(%rax)
+  804f6f:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  804f75:	00 00                	add    %al,(%rax)
+  804f77:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  804f7d:	00 00                	add    %al,(%rax)
+  804f7f:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  804f85:	00 00                	add    %al,(%rax)
+  804f87:	00 d4                	add    %dl,%ah
+  804f89:	0c 80                	or     $0x80,%al
+  804f8b:	00 00                	add    %al,(%rax)
+  804f8d:	00 00                	add    %al,(%rax)
+  804f8f:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  804f95:	00 00                	add    %al,(%rax)
+  804f97:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  804f9d:	00 00                	add    %al,(%rax)
+  804f9f:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  804fa5:	00 00                	add    %al,(%rax)
+  804fa7:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  804fad:	00 00                	add    %al,(%rax)
+  804faf:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  804fb5:	00 00                	add    %al,(%rax)
+  804fb7:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  804fbd:	00 00                	add    %al,(%rax)
+  804fbf:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  804fc5:	00 00                	add    %al,(%rax)
+  804fc7:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  804fcd:	00 00                	add    %al,(%rax)
+  804fcf:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  804fd5:	00 00                	add    %al,(%rax)
+  804fd7:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  804fdd:	00 00                	add    %al,(%rax)
+  804fdf:	00 20                	add    %ah,(%rax)
+  804fe1:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  804fe7:	00 ef                	add    %ch,%bh
+  804fe9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804fef:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  804ff5:	00 00                	add    %al,(%rax)
+  804ff7:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  804ffd:	00 00                	add    %al,(%rax)
+  804fff:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  805005:	00 00                	add    %al,(%rax)
+  805007:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  80500d:	00 00                	add    %al,(%rax)
+  80500f:	00 4f 08             	add    %cl,0x8(%rdi)
+  805012:	80 00 00             	addb   $0x0,(%rax)
+  805015:	00 00                	add    %al,(%rax)
+  805017:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  80501d:	00 00                	add    %al,(%rax)
+  80501f:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  805025:	00 00                	add    %al,(%rax)
+  805027:	00 15 08 80 00 00    	add    %dl,0x8008(%rip)        # 80d035 <__ctors_end+0x6f55>
+  80502d:	00 00                	add    %al,(%rax)
+  80502f:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  805035:	00 00                	add    %al,(%rax)
+  805037:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  80503d:	00 00                	add    %al,(%rax)
+  80503f:	00 97 0b 80 00 00    	add    %dl,0x800b(%rdi)
+  805045:	00 00                	add    %al,(%rax)
+  805047:	00 61 0c             	add    %ah,0xc(%rcx)
+  80504a:	80 00 00             	addb   $0x0,(%rax)
+  80504d:	00 00                	add    %al,(%rax)
+  80504f:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  805055:	00 00                	add    %al,(%rax)
+  805057:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  80505d:	00 00                	add    %al,(%rax)
+  80505f:	00 e6                	add    %ah,%dh
+  805061:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  805067:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  80506d:	00 00                	add    %al,(%rax)
+  80506f:	00 c3                	add    %al,%bl
+  805071:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805077:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  80507d:	00 00                	add    %al,(%rax)
+  80507f:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  805085:	00 00                	add    %al,(%rax)
+  805087:	00 d4                	add    %dl,%ah
+  805089:	0c 80                	or     $0x80,%al
+  80508b:	00 00                	add    %al,(%rax)
+  80508d:	00 00                	add    %al,(%rax)
+  80508f:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  805095:	00 00                	add    %al,(%rax)
+  805097:	00 79 07             	add    %bh,0x7(%rcx)
+  80509a:	80 00 00             	addb   $0x0,(%rax)
+  80509d:	00 00                	add    %al,(%rax)
+	...
+
+00000000008050a0 <error_string>:
+	...
+  8050a8:	55 4c 80 00 00 00 00 00 67 4c 80 00 00 00 00 00     UL......gL......
+  8050b8:	77 4c 80 00 00 00 00 00 89 4c 80 00 00 00 00 00     wL.......L......
+  8050c8:	97 4c 80 00 00 00 00 00 ab 4c 80 00 00 00 00 00     .L.......L......
+  8050d8:	c0 4c 80 00 00 00 00 00 d3 4c 80 00 00 00 00 00     .L.......L......
+  8050e8:	e5 4c 80 00 00 00 00 00 f9 4c 80 00 00 00 00 00     .L.......L......
+  8050f8:	09 4d 80 00 00 00 00 00 1c 4d 80 00 00 00 00 00     .M.......M......
+  805108:	33 4d 80 00 00 00 00 00 49 4d 80 00 00 00 00 00     3M......IM......
+  805118:	61 4d 80 00 00 00 00 00 79 4d 80 00 00 00 00 00     aM......yM......
+  805128:	86 4d 80 00 00 00 00 00 58 51 80 00 00 00 00 00     .M......XQ......
+  805138:	9a 4d 80 00 00 00 00 00 b2 4d 80 00 00 00 00 00     .M.......M......
+  805148:	bc 4d 80 00 00 00 00 00 c6 4d 80 00 00 00 00 00     .M.......M......
+  805158:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  805168:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  805178:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  805188:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  805198:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 73 66 6f     ib/syscall.c.sfo
+  8051a8:	72 6b 28 29 20 69 73 20 6e 6f 74 20 69 6d 70 6c     rk() is not impl
+  8051b8:	65 6d 65 6e 74 65 64 00 6c 69 62 2f 66 6f 72 6b     emented.lib/fork
+  8051c8:	2e 63 00 69 70 63 5f 73 65 6e 64 20 65 72 72 6f     .c.ipc_send erro
+  8051d8:	72 3a 20 25 69 0a 00 6c 69 62 2f 69 70 63 2e 63     r: %i..lib/ipc.c
+  8051e8:	00 0f 1f 80 00 00 00 00 5b 25 30 38 78 5d 20 75     ........[%08x] u
+  8051f8:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  805208:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  805218:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  805228:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  805238:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  805248:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  805258:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  805268:	0a 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805278:	84 00 00 00 00 00 66 90                             ......f.
+
+0000000000805280 <devtab>:
+  805280:	20 60 80 00 00 00 00 00 60 60 80 00 00 00 00 00      `......``......
+  805290:	a0 60 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .`..............
+  8052a0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  8052b0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8052c0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8052d0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8052e0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8052f0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  805300:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  805310:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  805320:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  805330:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  805340:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  805350:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  805360:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  805370:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805380:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805390:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8053a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8053b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8053c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8053d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8053e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8053f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805400:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805410:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805420:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805430:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805440:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805450:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805460:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805470:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805480:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805490:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8054a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8054b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8054c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8054d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8054e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8054f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805500:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805510:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805520:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805530:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805540:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805550:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805560:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805570:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805580:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805590:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8055a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8055b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8055c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8055d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8055e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8055f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805600:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805610:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805620:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805630:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805640:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805650:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805660:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805670:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805680:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805690:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8056a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8056b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8056c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8056d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8056e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8056f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805700:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805710:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805720:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805730:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805740:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805750:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805760:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805770:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805780:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805790:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8057a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8057b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8057c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8057d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8057e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8057f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805800:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805810:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805820:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805830:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805840:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805850:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805860:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805870:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805880:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805890:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8058a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8058b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8058c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8058d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8058e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8058f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805900:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805910:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805920:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805930:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805940:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805950:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805960:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805970:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805980:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805990:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8059a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8059b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8059c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8059d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8059e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8059f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805aa0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ab0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ac0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ad0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ae0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805af0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ba0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805bb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805bc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805bd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805be0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805bf0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ca0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805cb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805cc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805cd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ce0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805cf0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805da0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805db0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805dc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805dd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805de0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805df0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ea0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805eb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ec0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ed0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ee0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ef0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805fa0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805fb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805fc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805fd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805fe0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ff0:	66 2e 0f 1f 84 00 00 00 00 00 66 0f 1f 44 00 00     f.........f..D..
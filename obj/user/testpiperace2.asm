@@ -0,0 +1,8786 @@
+
+obj/user/testpiperace2:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 bd 02 00 00       	call   8002e0 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 28          	sub    $0x28,%rsp
+    int p[2], r, i;
+    struct Fd *fd;
+    const volatile struct Env *kid;
+
+    cprintf("testing for pipeisclosed race...\n");
+  800036:	48 bf 60 4a 80 00 00 	movabs $0x804a60,%rdi
+  80003d:	00 00 00 
+  800040:	b8 00 00 00 00       	mov    $0x0,%eax
+  800045:	48 ba 06 05 80 00 00 	movabs $0x800506,%rdx
+  80004c:	00 00 00 
+  80004f:	ff d2                	call   *%rdx
+    if ((r = pipe(p)) < 0)
+  800051:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  800055:	48 b8 99 3d 80 00 00 	movabs $0x803d99,%rax
+  80005c:	00 00 00 
+  80005f:	ff d0                	call   *%rax
+  800061:	85 c0                	test   %eax,%eax
+  800063:	0f 88 a0 00 00 00    	js     800109 <umain+0xe4>
+        panic("pipe: %i", r);
+    if ((r = fork()) < 0)
+  800069:	48 b8 bd 17 80 00 00 	movabs $0x8017bd,%rax
+  800070:	00 00 00 
+  800073:	ff d0                	call   *%rax
+  800075:	89 45 bc             	mov    %eax,-0x44(%rbp)
+  800078:	85 c0                	test   %eax,%eax
+  80007a:	0f 88 b6 00 00 00    	js     800136 <umain+0x111>
+        panic("fork: %i", r);
+    if (r == 0) {
+  800080:	83 7d bc 00          	cmpl   $0x0,-0x44(%rbp)
+  800084:	0f 84 d9 00 00 00    	je     800163 <umain+0x13e>
+     * it shouldn't.
+     *
+     * So either way, pipeisclosed is going give a wrong answer. */
+
+    kid = &envs[ENVX(r)];
+    while (kid->env_status == ENV_RUNNABLE) {
+  80008a:	8b 55 bc             	mov    -0x44(%rbp),%edx
+  80008d:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  800093:	48 89 d0             	mov    %rdx,%rax
+  800096:	48 c1 e0 04          	shl    $0x4,%rax
+  80009a:	48 29 d0             	sub    %rdx,%rax
+  80009d:	48 c1 e0 05          	shl    $0x5,%rax
+  8000a1:	48 bb 00 00 c0 1f 80 	movabs $0x801fc00000,%rbx
+  8000a8:	00 00 00 
+  8000ab:	48 01 c3             	add    %rax,%rbx
+        if (pipeisclosed(p[0]) != 0) {
+  8000ae:	49 bc a5 3f 80 00 00 	movabs $0x803fa5,%r12
+  8000b5:	00 00 00 
+    while (kid->env_status == ENV_RUNNABLE) {
+  8000b8:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+  8000be:	83 f8 02             	cmp    $0x2,%eax
+  8000c1:	0f 85 43 01 00 00    	jne    80020a <umain+0x1e5>
+        if (pipeisclosed(p[0]) != 0) {
+  8000c7:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  8000ca:	41 ff d4             	call   *%r12
+  8000cd:	85 c0                	test   %eax,%eax
+  8000cf:	74 e7                	je     8000b8 <umain+0x93>
+            cprintf("\nRACE: pipe appears closed\n");
+  8000d1:	48 bf dd 4a 80 00 00 	movabs $0x804add,%rdi
+  8000d8:	00 00 00 
+  8000db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000e0:	48 ba 06 05 80 00 00 	movabs $0x800506,%rdx
+  8000e7:	00 00 00 
+  8000ea:	ff d2                	call   *%rdx
+            sys_env_destroy(r);
+  8000ec:	8b 7d bc             	mov    -0x44(%rbp),%edi
+  8000ef:	48 b8 9a 12 80 00 00 	movabs $0x80129a,%rax
+  8000f6:	00 00 00 
+  8000f9:	ff d0                	call   *%rax
+            exit();
+  8000fb:	48 b8 93 03 80 00 00 	movabs $0x800393,%rax
+  800102:	00 00 00 
+  800105:	ff d0                	call   *%rax
+  800107:	eb af                	jmp    8000b8 <umain+0x93>
+        panic("pipe: %i", r);
+  800109:	89 c1                	mov    %eax,%ecx
+  80010b:	48 ba b2 4a 80 00 00 	movabs $0x804ab2,%rdx
+  800112:	00 00 00 
+  800115:	be 0c 00 00 00       	mov    $0xc,%esi
+  80011a:	48 bf bb 4a 80 00 00 	movabs $0x804abb,%rdi
+  800121:	00 00 00 
+  800124:	b8 00 00 00 00       	mov    $0x0,%eax
+  800129:	49 b8 b6 03 80 00 00 	movabs $0x8003b6,%r8
+  800130:	00 00 00 
+  800133:	41 ff d0             	call   *%r8
+        panic("fork: %i", r);
+  800136:	89 c1                	mov    %eax,%ecx
+  800138:	48 ba d0 4a 80 00 00 	movabs $0x804ad0,%rdx
+  80013f:	00 00 00 
+  800142:	be 0e 00 00 00       	mov    $0xe,%esi
+  800147:	48 bf bb 4a 80 00 00 	movabs $0x804abb,%rdi
+  80014e:	00 00 00 
+  800151:	b8 00 00 00 00       	mov    $0x0,%eax
+  800156:	49 b8 b6 03 80 00 00 	movabs $0x8003b6,%r8
+  80015d:	00 00 00 
+  800160:	41 ff d0             	call   *%r8
+        close(p[1]);
+  800163:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  800166:	48 b8 d0 1a 80 00 00 	movabs $0x801ad0,%rax
+  80016d:	00 00 00 
+  800170:	ff d0                	call   *%rax
+        for (i = 0; i < 200; i++) {
+  800172:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+                cprintf("%d.", i);
+  800175:	49 bf d9 4a 80 00 00 	movabs $0x804ad9,%r15
+  80017c:	00 00 00 
+  80017f:	49 be 06 05 80 00 00 	movabs $0x800506,%r14
+  800186:	00 00 00 
+            dup(p[0], 10);
+  800189:	49 bd 2b 1b 80 00 00 	movabs $0x801b2b,%r13
+  800190:	00 00 00 
+            sys_yield();
+  800193:	49 bc 26 13 80 00 00 	movabs $0x801326,%r12
+  80019a:	00 00 00 
+  80019d:	eb 2d                	jmp    8001cc <umain+0x1a7>
+            dup(p[0], 10);
+  80019f:	be 0a 00 00 00       	mov    $0xa,%esi
+  8001a4:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  8001a7:	41 ff d5             	call   *%r13
+            sys_yield();
+  8001aa:	41 ff d4             	call   *%r12
+            close(10);
+  8001ad:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8001b2:	48 b8 d0 1a 80 00 00 	movabs $0x801ad0,%rax
+  8001b9:	00 00 00 
+  8001bc:	ff d0                	call   *%rax
+            sys_yield();
+  8001be:	41 ff d4             	call   *%r12
+        for (i = 0; i < 200; i++) {
+  8001c1:	83 c3 01             	add    $0x1,%ebx
+  8001c4:	81 fb c8 00 00 00    	cmp    $0xc8,%ebx
+  8001ca:	74 2d                	je     8001f9 <umain+0x1d4>
+            if (i % 10 == 0)
+  8001cc:	48 63 c3             	movslq %ebx,%rax
+  8001cf:	48 69 c0 67 66 66 66 	imul   $0x66666667,%rax,%rax
+  8001d6:	48 c1 f8 22          	sar    $0x22,%rax
+  8001da:	89 da                	mov    %ebx,%edx
+  8001dc:	c1 fa 1f             	sar    $0x1f,%edx
+  8001df:	29 d0                	sub    %edx,%eax
+  8001e1:	8d 04 80             	lea    (%rax,%rax,4),%eax
+  8001e4:	01 c0                	add    %eax,%eax
+  8001e6:	39 c3                	cmp    %eax,%ebx
+  8001e8:	75 b5                	jne    80019f <umain+0x17a>
+                cprintf("%d.", i);
+  8001ea:	89 de                	mov    %ebx,%esi
+  8001ec:	4c 89 ff             	mov    %r15,%rdi
+  8001ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001f4:	41 ff d6             	call   *%r14
+  8001f7:	eb a6                	jmp    80019f <umain+0x17a>
+        exit();
+  8001f9:	48 b8 93 03 80 00 00 	movabs $0x800393,%rax
+  800200:	00 00 00 
+  800203:	ff d0                	call   *%rax
+  800205:	e9 80 fe ff ff       	jmp    80008a <umain+0x65>
+        }
+    }
+    cprintf("child done with loop\n");
+  80020a:	48 bf f9 4a 80 00 00 	movabs $0x804af9,%rdi
+  800211:	00 00 00 
+  800214:	b8 00 00 00 00       	mov    $0x0,%eax
+  800219:	48 ba 06 05 80 00 00 	movabs $0x800506,%rdx
+  800220:	00 00 00 
+  800223:	ff d2                	call   *%rdx
+    if (pipeisclosed(p[0]))
+  800225:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  800228:	48 b8 a5 3f 80 00 00 	movabs $0x803fa5,%rax
+  80022f:	00 00 00 
+  800232:	ff d0                	call   *%rax
+  800234:	85 c0                	test   %eax,%eax
+  800236:	75 51                	jne    800289 <umain+0x264>
+        panic("somehow the other end of p[0] got closed!");
+    if ((r = fd_lookup(p[0], &fd)) < 0)
+  800238:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  80023c:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  80023f:	48 b8 6b 19 80 00 00 	movabs $0x80196b,%rax
+  800246:	00 00 00 
+  800249:	ff d0                	call   *%rax
+  80024b:	85 c0                	test   %eax,%eax
+  80024d:	78 64                	js     8002b3 <umain+0x28e>
+        panic("cannot look up p[0]: %i", r);
+    USED(fd2data(fd));
+  80024f:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  800253:	48 b8 ef 18 80 00 00 	movabs $0x8018ef,%rax
+  80025a:	00 00 00 
+  80025d:	ff d0                	call   *%rax
+    cprintf("race didn't happen\n");
+  80025f:	48 bf 27 4b 80 00 00 	movabs $0x804b27,%rdi
+  800266:	00 00 00 
+  800269:	b8 00 00 00 00       	mov    $0x0,%eax
+  80026e:	48 ba 06 05 80 00 00 	movabs $0x800506,%rdx
+  800275:	00 00 00 
+  800278:	ff d2                	call   *%rdx
+}
+  80027a:	48 83 c4 28          	add    $0x28,%rsp
+  80027e:	5b                   	pop    %rbx
+  80027f:	41 5c                	pop    %r12
+  800281:	41 5d                	pop    %r13
+  800283:	41 5e                	pop    %r14
+  800285:	41 5f                	pop    %r15
+  800287:	5d                   	pop    %rbp
+  800288:	c3                   	ret
+        panic("somehow the other end of p[0] got closed!");
+  800289:	48 ba 88 4a 80 00 00 	movabs $0x804a88,%rdx
+  800290:	00 00 00 
+  800293:	be 40 00 00 00       	mov    $0x40,%esi
+  800298:	48 bf bb 4a 80 00 00 	movabs $0x804abb,%rdi
+  80029f:	00 00 00 
+  8002a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002a7:	48 b9 b6 03 80 00 00 	movabs $0x8003b6,%rcx
+  8002ae:	00 00 00 
+  8002b1:	ff d1                	call   *%rcx
+        panic("cannot look up p[0]: %i", r);
+  8002b3:	89 c1                	mov    %eax,%ecx
+  8002b5:	48 ba 0f 4b 80 00 00 	movabs $0x804b0f,%rdx
+  8002bc:	00 00 00 
+  8002bf:	be 42 00 00 00       	mov    $0x42,%esi
+  8002c4:	48 bf bb 4a 80 00 00 	movabs $0x804abb,%rdi
+  8002cb:	00 00 00 
+  8002ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002d3:	49 b8 b6 03 80 00 00 	movabs $0x8003b6,%r8
+  8002da:	00 00 00 
+  8002dd:	41 ff d0             	call   *%r8
+
+00000000008002e0 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8002e0:	55                   	push   %rbp
+  8002e1:	48 89 e5             	mov    %rsp,%rbp
+  8002e4:	41 56                	push   %r14
+  8002e6:	41 55                	push   %r13
+  8002e8:	41 54                	push   %r12
+  8002ea:	53                   	push   %rbx
+  8002eb:	41 89 fd             	mov    %edi,%r13d
+  8002ee:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8002f1:	48 ba e0 60 80 00 00 	movabs $0x8060e0,%rdx
+  8002f8:	00 00 00 
+  8002fb:	48 b8 e0 60 80 00 00 	movabs $0x8060e0,%rax
+  800302:	00 00 00 
+  800305:	48 39 c2             	cmp    %rax,%rdx
+  800308:	73 17                	jae    800321 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80030a:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80030d:	49 89 c4             	mov    %rax,%r12
+  800310:	48 83 c3 08          	add    $0x8,%rbx
+  800314:	b8 00 00 00 00       	mov    $0x0,%eax
+  800319:	ff 53 f8             	call   *-0x8(%rbx)
+  80031c:	4c 39 e3             	cmp    %r12,%rbx
+  80031f:	72 ef                	jb     800310 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800321:	48 b8 fd 12 80 00 00 	movabs $0x8012fd,%rax
+  800328:	00 00 00 
+  80032b:	ff d0                	call   *%rax
+  80032d:	89 c2                	mov    %eax,%edx
+  80032f:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  800335:	48 89 d0             	mov    %rdx,%rax
+  800338:	48 c1 e0 04          	shl    $0x4,%rax
+  80033c:	48 29 d0             	sub    %rdx,%rax
+  80033f:	48 c1 e0 05          	shl    $0x5,%rax
+  800343:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80034a:	00 00 00 
+  80034d:	48 01 d0             	add    %rdx,%rax
+  800350:	48 a3 00 00 81 00 00 	movabs %rax,0x810000
+  800357:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80035a:	45 85 ed             	test   %r13d,%r13d
+  80035d:	7e 0d                	jle    80036c <libmain+0x8c>
+  80035f:	49 8b 06             	mov    (%r14),%rax
+  800362:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  800369:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80036c:	4c 89 f6             	mov    %r14,%rsi
+  80036f:	44 89 ef             	mov    %r13d,%edi
+  800372:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800379:	00 00 00 
+  80037c:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80037e:	48 b8 93 03 80 00 00 	movabs $0x800393,%rax
+  800385:	00 00 00 
+  800388:	ff d0                	call   *%rax
+#endif
+}
+  80038a:	5b                   	pop    %rbx
+  80038b:	41 5c                	pop    %r12
+  80038d:	41 5d                	pop    %r13
+  80038f:	41 5e                	pop    %r14
+  800391:	5d                   	pop    %rbp
+  800392:	c3                   	ret
+
+0000000000800393 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800393:	55                   	push   %rbp
+  800394:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800397:	48 b8 03 1b 80 00 00 	movabs $0x801b03,%rax
+  80039e:	00 00 00 
+  8003a1:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8003a3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8003a8:	48 b8 9a 12 80 00 00 	movabs $0x80129a,%rax
+  8003af:	00 00 00 
+  8003b2:	ff d0                	call   *%rax
+}
+  8003b4:	5d                   	pop    %rbp
+  8003b5:	c3                   	ret
+
+00000000008003b6 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8003b6:	55                   	push   %rbp
+  8003b7:	48 89 e5             	mov    %rsp,%rbp
+  8003ba:	41 56                	push   %r14
+  8003bc:	41 55                	push   %r13
+  8003be:	41 54                	push   %r12
+  8003c0:	53                   	push   %rbx
+  8003c1:	48 83 ec 50          	sub    $0x50,%rsp
+  8003c5:	49 89 fc             	mov    %rdi,%r12
+  8003c8:	41 89 f5             	mov    %esi,%r13d
+  8003cb:	48 89 d3             	mov    %rdx,%rbx
+  8003ce:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8003d2:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8003d6:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8003da:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8003e1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003e5:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8003e9:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8003ed:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8003f1:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8003f8:	00 00 00 
+  8003fb:	4c 8b 30             	mov    (%rax),%r14
+  8003fe:	48 b8 fd 12 80 00 00 	movabs $0x8012fd,%rax
+  800405:	00 00 00 
+  800408:	ff d0                	call   *%rax
+  80040a:	89 c6                	mov    %eax,%esi
+  80040c:	45 89 e8             	mov    %r13d,%r8d
+  80040f:	4c 89 e1             	mov    %r12,%rcx
+  800412:	4c 89 f2             	mov    %r14,%rdx
+  800415:	48 bf 48 4b 80 00 00 	movabs $0x804b48,%rdi
+  80041c:	00 00 00 
+  80041f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800424:	49 bc 06 05 80 00 00 	movabs $0x800506,%r12
+  80042b:	00 00 00 
+  80042e:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800431:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800435:	48 89 df             	mov    %rbx,%rdi
+  800438:	48 b8 a2 04 80 00 00 	movabs $0x8004a2,%rax
+  80043f:	00 00 00 
+  800442:	ff d0                	call   *%rax
+    cprintf("\n");
+  800444:	48 bf f7 4a 80 00 00 	movabs $0x804af7,%rdi
+  80044b:	00 00 00 
+  80044e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800453:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800456:	cc                   	int3
+  800457:	eb fd                	jmp    800456 <_panic+0xa0>
+
+0000000000800459 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800459:	55                   	push   %rbp
+  80045a:	48 89 e5             	mov    %rsp,%rbp
+  80045d:	53                   	push   %rbx
+  80045e:	48 83 ec 08          	sub    $0x8,%rsp
+  800462:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800465:	8b 06                	mov    (%rsi),%eax
+  800467:	8d 50 01             	lea    0x1(%rax),%edx
+  80046a:	89 16                	mov    %edx,(%rsi)
+  80046c:	48 98                	cltq
+  80046e:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800473:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800479:	74 0a                	je     800485 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80047b:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80047f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800483:	c9                   	leave
+  800484:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800485:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800489:	be ff 00 00 00       	mov    $0xff,%esi
+  80048e:	48 b8 52 12 80 00 00 	movabs $0x801252,%rax
+  800495:	00 00 00 
+  800498:	ff d0                	call   *%rax
+        state->offset = 0;
+  80049a:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8004a0:	eb d9                	jmp    80047b <putch+0x22>
+
+00000000008004a2 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8004a2:	55                   	push   %rbp
+  8004a3:	48 89 e5             	mov    %rsp,%rbp
+  8004a6:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8004ad:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8004b0:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8004b7:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8004bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004c1:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8004c4:	48 89 f1             	mov    %rsi,%rcx
+  8004c7:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8004ce:	48 bf 59 04 80 00 00 	movabs $0x800459,%rdi
+  8004d5:	00 00 00 
+  8004d8:	48 b8 56 06 80 00 00 	movabs $0x800656,%rax
+  8004df:	00 00 00 
+  8004e2:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8004e4:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8004eb:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8004f2:	48 b8 52 12 80 00 00 	movabs $0x801252,%rax
+  8004f9:	00 00 00 
+  8004fc:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8004fe:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800504:	c9                   	leave
+  800505:	c3                   	ret
+
+0000000000800506 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800506:	55                   	push   %rbp
+  800507:	48 89 e5             	mov    %rsp,%rbp
+  80050a:	48 83 ec 50          	sub    $0x50,%rsp
+  80050e:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800512:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800516:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80051a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80051e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800522:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800529:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80052d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800531:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800535:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800539:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80053d:	48 b8 a2 04 80 00 00 	movabs $0x8004a2,%rax
+  800544:	00 00 00 
+  800547:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800549:	c9                   	leave
+  80054a:	c3                   	ret
+
+000000000080054b <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80054b:	55                   	push   %rbp
+  80054c:	48 89 e5             	mov    %rsp,%rbp
+  80054f:	41 57                	push   %r15
+  800551:	41 56                	push   %r14
+  800553:	41 55                	push   %r13
+  800555:	41 54                	push   %r12
+  800557:	53                   	push   %rbx
+  800558:	48 83 ec 18          	sub    $0x18,%rsp
+  80055c:	49 89 fc             	mov    %rdi,%r12
+  80055f:	49 89 f5             	mov    %rsi,%r13
+  800562:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800566:	8b 45 10             	mov    0x10(%rbp),%eax
+  800569:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80056c:	41 89 cf             	mov    %ecx,%r15d
+  80056f:	4c 39 fa             	cmp    %r15,%rdx
+  800572:	73 5b                	jae    8005cf <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800574:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800578:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80057c:	85 db                	test   %ebx,%ebx
+  80057e:	7e 0e                	jle    80058e <print_num+0x43>
+            putch(padc, put_arg);
+  800580:	4c 89 ee             	mov    %r13,%rsi
+  800583:	44 89 f7             	mov    %r14d,%edi
+  800586:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800589:	83 eb 01             	sub    $0x1,%ebx
+  80058c:	75 f2                	jne    800580 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80058e:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800592:	48 b9 7c 4b 80 00 00 	movabs $0x804b7c,%rcx
+  800599:	00 00 00 
+  80059c:	48 b8 6b 4b 80 00 00 	movabs $0x804b6b,%rax
+  8005a3:	00 00 00 
+  8005a6:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8005aa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8005ae:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005b3:	49 f7 f7             	div    %r15
+  8005b6:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8005ba:	4c 89 ee             	mov    %r13,%rsi
+  8005bd:	41 ff d4             	call   *%r12
+}
+  8005c0:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8005c4:	5b                   	pop    %rbx
+  8005c5:	41 5c                	pop    %r12
+  8005c7:	41 5d                	pop    %r13
+  8005c9:	41 5e                	pop    %r14
+  8005cb:	41 5f                	pop    %r15
+  8005cd:	5d                   	pop    %rbp
+  8005ce:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8005cf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8005d3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005d8:	49 f7 f7             	div    %r15
+  8005db:	48 83 ec 08          	sub    $0x8,%rsp
+  8005df:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8005e3:	52                   	push   %rdx
+  8005e4:	45 0f be c9          	movsbl %r9b,%r9d
+  8005e8:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8005ec:	48 89 c2             	mov    %rax,%rdx
+  8005ef:	48 b8 4b 05 80 00 00 	movabs $0x80054b,%rax
+  8005f6:	00 00 00 
+  8005f9:	ff d0                	call   *%rax
+  8005fb:	48 83 c4 10          	add    $0x10,%rsp
+  8005ff:	eb 8d                	jmp    80058e <print_num+0x43>
+
+0000000000800601 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800601:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800605:	48 8b 06             	mov    (%rsi),%rax
+  800608:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80060c:	73 0a                	jae    800618 <sprintputch+0x17>
+        *state->start++ = ch;
+  80060e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800612:	48 89 16             	mov    %rdx,(%rsi)
+  800615:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800618:	c3                   	ret
+
+0000000000800619 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800619:	55                   	push   %rbp
+  80061a:	48 89 e5             	mov    %rsp,%rbp
+  80061d:	48 83 ec 50          	sub    $0x50,%rsp
+  800621:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800625:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800629:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80062d:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800634:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800638:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80063c:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800640:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800644:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800648:	48 b8 56 06 80 00 00 	movabs $0x800656,%rax
+  80064f:	00 00 00 
+  800652:	ff d0                	call   *%rax
+}
+  800654:	c9                   	leave
+  800655:	c3                   	ret
+
+0000000000800656 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800656:	55                   	push   %rbp
+  800657:	48 89 e5             	mov    %rsp,%rbp
+  80065a:	41 57                	push   %r15
+  80065c:	41 56                	push   %r14
+  80065e:	41 55                	push   %r13
+  800660:	41 54                	push   %r12
+  800662:	53                   	push   %rbx
+  800663:	48 83 ec 38          	sub    $0x38,%rsp
+  800667:	49 89 fe             	mov    %rdi,%r14
+  80066a:	49 89 f5             	mov    %rsi,%r13
+  80066d:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800670:	48 8b 01             	mov    (%rcx),%rax
+  800673:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800677:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80067b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80067f:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800683:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800687:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80068b:	0f b6 3b             	movzbl (%rbx),%edi
+  80068e:	40 80 ff 25          	cmp    $0x25,%dil
+  800692:	74 18                	je     8006ac <vprintfmt+0x56>
+            if (!ch) return;
+  800694:	40 84 ff             	test   %dil,%dil
+  800697:	0f 84 b1 06 00 00    	je     800d4e <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80069d:	40 0f b6 ff          	movzbl %dil,%edi
+  8006a1:	4c 89 ee             	mov    %r13,%rsi
+  8006a4:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8006a7:	4c 89 e3             	mov    %r12,%rbx
+  8006aa:	eb db                	jmp    800687 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8006ac:	be 00 00 00 00       	mov    $0x0,%esi
+  8006b1:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8006b5:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8006ba:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8006c0:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8006c7:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8006cb:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8006d0:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8006d5:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8006d8:	83 e8 23             	sub    $0x23,%eax
+  8006db:	3c 57                	cmp    $0x57,%al
+  8006dd:	0f 87 51 06 00 00    	ja     800d34 <vprintfmt+0x6de>
+  8006e3:	0f b6 c0             	movzbl %al,%eax
+  8006e6:	48 b9 20 4d 80 00 00 	movabs $0x804d20,%rcx
+  8006ed:	00 00 00 
+  8006f0:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8006f3:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8006f6:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8006fa:	eb cf                	jmp    8006cb <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8006fc:	49 89 dc             	mov    %rbx,%r12
+  8006ff:	be 01 00 00 00       	mov    $0x1,%esi
+  800704:	eb c5                	jmp    8006cb <vprintfmt+0x75>
+            padc = ch;
+  800706:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80070a:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80070d:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800710:	eb b9                	jmp    8006cb <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800712:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800715:	83 f8 2f             	cmp    $0x2f,%eax
+  800718:	77 24                	ja     80073e <vprintfmt+0xe8>
+  80071a:	89 c1                	mov    %eax,%ecx
+  80071c:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800720:	83 c0 08             	add    $0x8,%eax
+  800723:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800726:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800729:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80072c:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800730:	79 99                	jns    8006cb <vprintfmt+0x75>
+                width = precision;
+  800732:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800736:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80073c:	eb 8d                	jmp    8006cb <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80073e:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800742:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800746:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80074a:	eb da                	jmp    800726 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80074c:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800751:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800755:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80075b:	3c 39                	cmp    $0x39,%al
+  80075d:	77 1c                	ja     80077b <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  80075f:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800763:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800767:	0f b6 c0             	movzbl %al,%eax
+  80076a:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80076f:	0f b6 03             	movzbl (%rbx),%eax
+  800772:	3c 39                	cmp    $0x39,%al
+  800774:	76 e9                	jbe    80075f <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800776:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800779:	eb b1                	jmp    80072c <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80077b:	49 89 dc             	mov    %rbx,%r12
+  80077e:	eb ac                	jmp    80072c <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800780:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800783:	85 c9                	test   %ecx,%ecx
+  800785:	b8 00 00 00 00       	mov    $0x0,%eax
+  80078a:	0f 49 c1             	cmovns %ecx,%eax
+  80078d:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800790:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800793:	e9 33 ff ff ff       	jmp    8006cb <vprintfmt+0x75>
+            lflag++;
+  800798:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80079b:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80079e:	e9 28 ff ff ff       	jmp    8006cb <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8007a3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007a6:	83 f8 2f             	cmp    $0x2f,%eax
+  8007a9:	77 19                	ja     8007c4 <vprintfmt+0x16e>
+  8007ab:	89 c2                	mov    %eax,%edx
+  8007ad:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007b1:	83 c0 08             	add    $0x8,%eax
+  8007b4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007b7:	8b 3a                	mov    (%rdx),%edi
+  8007b9:	4c 89 ee             	mov    %r13,%rsi
+  8007bc:	41 ff d6             	call   *%r14
+            break;
+  8007bf:	e9 c3 fe ff ff       	jmp    800687 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8007c4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007c8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007cc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007d0:	eb e5                	jmp    8007b7 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8007d2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007d5:	83 f8 2f             	cmp    $0x2f,%eax
+  8007d8:	77 5a                	ja     800834 <vprintfmt+0x1de>
+  8007da:	89 c2                	mov    %eax,%edx
+  8007dc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007e0:	83 c0 08             	add    $0x8,%eax
+  8007e3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8007e6:	8b 02                	mov    (%rdx),%eax
+  8007e8:	89 c1                	mov    %eax,%ecx
+  8007ea:	f7 d9                	neg    %ecx
+  8007ec:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8007ef:	83 f9 16             	cmp    $0x16,%ecx
+  8007f2:	7f 4e                	jg     800842 <vprintfmt+0x1ec>
+  8007f4:	48 63 c1             	movslq %ecx,%rax
+  8007f7:	48 ba e0 4f 80 00 00 	movabs $0x804fe0,%rdx
+  8007fe:	00 00 00 
+  800801:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800805:	48 85 c0             	test   %rax,%rax
+  800808:	74 38                	je     800842 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80080a:	48 89 c1             	mov    %rax,%rcx
+  80080d:	48 ba d9 51 80 00 00 	movabs $0x8051d9,%rdx
+  800814:	00 00 00 
+  800817:	4c 89 ee             	mov    %r13,%rsi
+  80081a:	4c 89 f7             	mov    %r14,%rdi
+  80081d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800822:	49 b8 19 06 80 00 00 	movabs $0x800619,%r8
+  800829:	00 00 00 
+  80082c:	41 ff d0             	call   *%r8
+  80082f:	e9 53 fe ff ff       	jmp    800687 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800834:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800838:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80083c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800840:	eb a4                	jmp    8007e6 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800842:	48 ba 94 4b 80 00 00 	movabs $0x804b94,%rdx
+  800849:	00 00 00 
+  80084c:	4c 89 ee             	mov    %r13,%rsi
+  80084f:	4c 89 f7             	mov    %r14,%rdi
+  800852:	b8 00 00 00 00       	mov    $0x0,%eax
+  800857:	49 b8 19 06 80 00 00 	movabs $0x800619,%r8
+  80085e:	00 00 00 
+  800861:	41 ff d0             	call   *%r8
+  800864:	e9 1e fe ff ff       	jmp    800687 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800869:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80086c:	83 f8 2f             	cmp    $0x2f,%eax
+  80086f:	77 6c                	ja     8008dd <vprintfmt+0x287>
+  800871:	89 c2                	mov    %eax,%edx
+  800873:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800877:	83 c0 08             	add    $0x8,%eax
+  80087a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80087d:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800880:	48 85 d2             	test   %rdx,%rdx
+  800883:	48 b8 8d 4b 80 00 00 	movabs $0x804b8d,%rax
+  80088a:	00 00 00 
+  80088d:	48 0f 45 c2          	cmovne %rdx,%rax
+  800891:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800895:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800899:	7e 06                	jle    8008a1 <vprintfmt+0x24b>
+  80089b:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80089f:	75 4a                	jne    8008eb <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8008a1:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8008a5:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8008a9:	0f b6 00             	movzbl (%rax),%eax
+  8008ac:	84 c0                	test   %al,%al
+  8008ae:	0f 85 9a 00 00 00    	jne    80094e <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8008b4:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8008b7:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8008bb:	85 c0                	test   %eax,%eax
+  8008bd:	0f 8e c4 fd ff ff    	jle    800687 <vprintfmt+0x31>
+  8008c3:	4c 89 ee             	mov    %r13,%rsi
+  8008c6:	bf 20 00 00 00       	mov    $0x20,%edi
+  8008cb:	41 ff d6             	call   *%r14
+  8008ce:	41 83 ec 01          	sub    $0x1,%r12d
+  8008d2:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8008d6:	75 eb                	jne    8008c3 <vprintfmt+0x26d>
+  8008d8:	e9 aa fd ff ff       	jmp    800687 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8008dd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008e1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008e5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008e9:	eb 92                	jmp    80087d <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8008eb:	49 63 f7             	movslq %r15d,%rsi
+  8008ee:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8008f2:	48 b8 08 0e 80 00 00 	movabs $0x800e08,%rax
+  8008f9:	00 00 00 
+  8008fc:	ff d0                	call   *%rax
+  8008fe:	48 89 c2             	mov    %rax,%rdx
+  800901:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800904:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800906:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800909:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80090c:	85 c0                	test   %eax,%eax
+  80090e:	7e 91                	jle    8008a1 <vprintfmt+0x24b>
+  800910:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800915:	4c 89 ee             	mov    %r13,%rsi
+  800918:	44 89 e7             	mov    %r12d,%edi
+  80091b:	41 ff d6             	call   *%r14
+  80091e:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800922:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800925:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800928:	75 eb                	jne    800915 <vprintfmt+0x2bf>
+  80092a:	e9 72 ff ff ff       	jmp    8008a1 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80092f:	0f b6 f8             	movzbl %al,%edi
+  800932:	4c 89 ee             	mov    %r13,%rsi
+  800935:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800938:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80093c:	49 83 c4 01          	add    $0x1,%r12
+  800940:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800946:	84 c0                	test   %al,%al
+  800948:	0f 84 66 ff ff ff    	je     8008b4 <vprintfmt+0x25e>
+  80094e:	45 85 ff             	test   %r15d,%r15d
+  800951:	78 0a                	js     80095d <vprintfmt+0x307>
+  800953:	41 83 ef 01          	sub    $0x1,%r15d
+  800957:	0f 88 57 ff ff ff    	js     8008b4 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80095d:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800961:	74 cc                	je     80092f <vprintfmt+0x2d9>
+  800963:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800966:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80096b:	80 fa 5e             	cmp    $0x5e,%dl
+  80096e:	77 c2                	ja     800932 <vprintfmt+0x2dc>
+  800970:	eb bd                	jmp    80092f <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800972:	40 84 f6             	test   %sil,%sil
+  800975:	75 26                	jne    80099d <vprintfmt+0x347>
+    switch (lflag) {
+  800977:	85 d2                	test   %edx,%edx
+  800979:	74 59                	je     8009d4 <vprintfmt+0x37e>
+  80097b:	83 fa 01             	cmp    $0x1,%edx
+  80097e:	74 7b                	je     8009fb <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800980:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800983:	83 f8 2f             	cmp    $0x2f,%eax
+  800986:	0f 87 96 00 00 00    	ja     800a22 <vprintfmt+0x3cc>
+  80098c:	89 c2                	mov    %eax,%edx
+  80098e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800992:	83 c0 08             	add    $0x8,%eax
+  800995:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800998:	4c 8b 22             	mov    (%rdx),%r12
+  80099b:	eb 17                	jmp    8009b4 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  80099d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009a0:	83 f8 2f             	cmp    $0x2f,%eax
+  8009a3:	77 21                	ja     8009c6 <vprintfmt+0x370>
+  8009a5:	89 c2                	mov    %eax,%edx
+  8009a7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009ab:	83 c0 08             	add    $0x8,%eax
+  8009ae:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009b1:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8009b4:	4d 85 e4             	test   %r12,%r12
+  8009b7:	78 7a                	js     800a33 <vprintfmt+0x3dd>
+            num = i;
+  8009b9:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8009bc:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8009c1:	e9 50 02 00 00       	jmp    800c16 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009c6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009ca:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009ce:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009d2:	eb dd                	jmp    8009b1 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8009d4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009d7:	83 f8 2f             	cmp    $0x2f,%eax
+  8009da:	77 11                	ja     8009ed <vprintfmt+0x397>
+  8009dc:	89 c2                	mov    %eax,%edx
+  8009de:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009e2:	83 c0 08             	add    $0x8,%eax
+  8009e5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009e8:	4c 63 22             	movslq (%rdx),%r12
+  8009eb:	eb c7                	jmp    8009b4 <vprintfmt+0x35e>
+  8009ed:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009f1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009f5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009f9:	eb ed                	jmp    8009e8 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8009fb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009fe:	83 f8 2f             	cmp    $0x2f,%eax
+  800a01:	77 11                	ja     800a14 <vprintfmt+0x3be>
+  800a03:	89 c2                	mov    %eax,%edx
+  800a05:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a09:	83 c0 08             	add    $0x8,%eax
+  800a0c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a0f:	4c 8b 22             	mov    (%rdx),%r12
+  800a12:	eb a0                	jmp    8009b4 <vprintfmt+0x35e>
+  800a14:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a18:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a1c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a20:	eb ed                	jmp    800a0f <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800a22:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a26:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a2a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a2e:	e9 65 ff ff ff       	jmp    800998 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800a33:	4c 89 ee             	mov    %r13,%rsi
+  800a36:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800a3b:	41 ff d6             	call   *%r14
+                i = -i;
+  800a3e:	49 f7 dc             	neg    %r12
+  800a41:	e9 73 ff ff ff       	jmp    8009b9 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800a46:	40 84 f6             	test   %sil,%sil
+  800a49:	75 32                	jne    800a7d <vprintfmt+0x427>
+    switch (lflag) {
+  800a4b:	85 d2                	test   %edx,%edx
+  800a4d:	74 5d                	je     800aac <vprintfmt+0x456>
+  800a4f:	83 fa 01             	cmp    $0x1,%edx
+  800a52:	0f 84 82 00 00 00    	je     800ada <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800a58:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a5b:	83 f8 2f             	cmp    $0x2f,%eax
+  800a5e:	0f 87 a5 00 00 00    	ja     800b09 <vprintfmt+0x4b3>
+  800a64:	89 c2                	mov    %eax,%edx
+  800a66:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a6a:	83 c0 08             	add    $0x8,%eax
+  800a6d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a70:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a73:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a78:	e9 99 01 00 00       	jmp    800c16 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a7d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a80:	83 f8 2f             	cmp    $0x2f,%eax
+  800a83:	77 19                	ja     800a9e <vprintfmt+0x448>
+  800a85:	89 c2                	mov    %eax,%edx
+  800a87:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a8b:	83 c0 08             	add    $0x8,%eax
+  800a8e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a91:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a94:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a99:	e9 78 01 00 00       	jmp    800c16 <vprintfmt+0x5c0>
+  800a9e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aa2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aa6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aaa:	eb e5                	jmp    800a91 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800aac:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aaf:	83 f8 2f             	cmp    $0x2f,%eax
+  800ab2:	77 18                	ja     800acc <vprintfmt+0x476>
+  800ab4:	89 c2                	mov    %eax,%edx
+  800ab6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aba:	83 c0 08             	add    $0x8,%eax
+  800abd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ac0:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800ac2:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800ac7:	e9 4a 01 00 00       	jmp    800c16 <vprintfmt+0x5c0>
+  800acc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ad0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ad4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ad8:	eb e6                	jmp    800ac0 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800ada:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800add:	83 f8 2f             	cmp    $0x2f,%eax
+  800ae0:	77 19                	ja     800afb <vprintfmt+0x4a5>
+  800ae2:	89 c2                	mov    %eax,%edx
+  800ae4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ae8:	83 c0 08             	add    $0x8,%eax
+  800aeb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aee:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800af1:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800af6:	e9 1b 01 00 00       	jmp    800c16 <vprintfmt+0x5c0>
+  800afb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aff:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b03:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b07:	eb e5                	jmp    800aee <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800b09:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b0d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b11:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b15:	e9 56 ff ff ff       	jmp    800a70 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800b1a:	40 84 f6             	test   %sil,%sil
+  800b1d:	75 2e                	jne    800b4d <vprintfmt+0x4f7>
+    switch (lflag) {
+  800b1f:	85 d2                	test   %edx,%edx
+  800b21:	74 59                	je     800b7c <vprintfmt+0x526>
+  800b23:	83 fa 01             	cmp    $0x1,%edx
+  800b26:	74 7f                	je     800ba7 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800b28:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b2b:	83 f8 2f             	cmp    $0x2f,%eax
+  800b2e:	0f 87 9f 00 00 00    	ja     800bd3 <vprintfmt+0x57d>
+  800b34:	89 c2                	mov    %eax,%edx
+  800b36:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b3a:	83 c0 08             	add    $0x8,%eax
+  800b3d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b40:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800b43:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b48:	e9 c9 00 00 00       	jmp    800c16 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b4d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b50:	83 f8 2f             	cmp    $0x2f,%eax
+  800b53:	77 19                	ja     800b6e <vprintfmt+0x518>
+  800b55:	89 c2                	mov    %eax,%edx
+  800b57:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b5b:	83 c0 08             	add    $0x8,%eax
+  800b5e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b61:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800b64:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b69:	e9 a8 00 00 00       	jmp    800c16 <vprintfmt+0x5c0>
+  800b6e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b72:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b76:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b7a:	eb e5                	jmp    800b61 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800b7c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b7f:	83 f8 2f             	cmp    $0x2f,%eax
+  800b82:	77 15                	ja     800b99 <vprintfmt+0x543>
+  800b84:	89 c2                	mov    %eax,%edx
+  800b86:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b8a:	83 c0 08             	add    $0x8,%eax
+  800b8d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b90:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800b92:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800b97:	eb 7d                	jmp    800c16 <vprintfmt+0x5c0>
+  800b99:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b9d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ba1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ba5:	eb e9                	jmp    800b90 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800ba7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800baa:	83 f8 2f             	cmp    $0x2f,%eax
+  800bad:	77 16                	ja     800bc5 <vprintfmt+0x56f>
+  800baf:	89 c2                	mov    %eax,%edx
+  800bb1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bb5:	83 c0 08             	add    $0x8,%eax
+  800bb8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bbb:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800bbe:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800bc3:	eb 51                	jmp    800c16 <vprintfmt+0x5c0>
+  800bc5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bc9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bcd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bd1:	eb e8                	jmp    800bbb <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800bd3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bd7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bdb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bdf:	e9 5c ff ff ff       	jmp    800b40 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800be4:	4c 89 ee             	mov    %r13,%rsi
+  800be7:	bf 30 00 00 00       	mov    $0x30,%edi
+  800bec:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800bef:	4c 89 ee             	mov    %r13,%rsi
+  800bf2:	bf 78 00 00 00       	mov    $0x78,%edi
+  800bf7:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800bfa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bfd:	83 f8 2f             	cmp    $0x2f,%eax
+  800c00:	77 47                	ja     800c49 <vprintfmt+0x5f3>
+  800c02:	89 c2                	mov    %eax,%edx
+  800c04:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c08:	83 c0 08             	add    $0x8,%eax
+  800c0b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c0e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c11:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800c16:	48 83 ec 08          	sub    $0x8,%rsp
+  800c1a:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800c1e:	0f 94 c0             	sete   %al
+  800c21:	0f b6 c0             	movzbl %al,%eax
+  800c24:	50                   	push   %rax
+  800c25:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800c2a:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800c2e:	4c 89 ee             	mov    %r13,%rsi
+  800c31:	4c 89 f7             	mov    %r14,%rdi
+  800c34:	48 b8 4b 05 80 00 00 	movabs $0x80054b,%rax
+  800c3b:	00 00 00 
+  800c3e:	ff d0                	call   *%rax
+            break;
+  800c40:	48 83 c4 10          	add    $0x10,%rsp
+  800c44:	e9 3e fa ff ff       	jmp    800687 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800c49:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c4d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c51:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c55:	eb b7                	jmp    800c0e <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800c57:	40 84 f6             	test   %sil,%sil
+  800c5a:	75 2b                	jne    800c87 <vprintfmt+0x631>
+    switch (lflag) {
+  800c5c:	85 d2                	test   %edx,%edx
+  800c5e:	74 56                	je     800cb6 <vprintfmt+0x660>
+  800c60:	83 fa 01             	cmp    $0x1,%edx
+  800c63:	74 7f                	je     800ce4 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800c65:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c68:	83 f8 2f             	cmp    $0x2f,%eax
+  800c6b:	0f 87 a2 00 00 00    	ja     800d13 <vprintfmt+0x6bd>
+  800c71:	89 c2                	mov    %eax,%edx
+  800c73:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c77:	83 c0 08             	add    $0x8,%eax
+  800c7a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c7d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c80:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800c85:	eb 8f                	jmp    800c16 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800c87:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c8a:	83 f8 2f             	cmp    $0x2f,%eax
+  800c8d:	77 19                	ja     800ca8 <vprintfmt+0x652>
+  800c8f:	89 c2                	mov    %eax,%edx
+  800c91:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c95:	83 c0 08             	add    $0x8,%eax
+  800c98:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c9b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c9e:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800ca3:	e9 6e ff ff ff       	jmp    800c16 <vprintfmt+0x5c0>
+  800ca8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cac:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cb0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cb4:	eb e5                	jmp    800c9b <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800cb6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cb9:	83 f8 2f             	cmp    $0x2f,%eax
+  800cbc:	77 18                	ja     800cd6 <vprintfmt+0x680>
+  800cbe:	89 c2                	mov    %eax,%edx
+  800cc0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cc4:	83 c0 08             	add    $0x8,%eax
+  800cc7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cca:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800ccc:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800cd1:	e9 40 ff ff ff       	jmp    800c16 <vprintfmt+0x5c0>
+  800cd6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cda:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cde:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ce2:	eb e6                	jmp    800cca <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800ce4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ce7:	83 f8 2f             	cmp    $0x2f,%eax
+  800cea:	77 19                	ja     800d05 <vprintfmt+0x6af>
+  800cec:	89 c2                	mov    %eax,%edx
+  800cee:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cf2:	83 c0 08             	add    $0x8,%eax
+  800cf5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cf8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800cfb:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800d00:	e9 11 ff ff ff       	jmp    800c16 <vprintfmt+0x5c0>
+  800d05:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d09:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d0d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d11:	eb e5                	jmp    800cf8 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800d13:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d17:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d1b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d1f:	e9 59 ff ff ff       	jmp    800c7d <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800d24:	4c 89 ee             	mov    %r13,%rsi
+  800d27:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d2c:	41 ff d6             	call   *%r14
+            break;
+  800d2f:	e9 53 f9 ff ff       	jmp    800687 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800d34:	4c 89 ee             	mov    %r13,%rsi
+  800d37:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d3c:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800d3f:	48 83 eb 01          	sub    $0x1,%rbx
+  800d43:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800d47:	75 f6                	jne    800d3f <vprintfmt+0x6e9>
+  800d49:	e9 39 f9 ff ff       	jmp    800687 <vprintfmt+0x31>
+}
+  800d4e:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800d52:	5b                   	pop    %rbx
+  800d53:	41 5c                	pop    %r12
+  800d55:	41 5d                	pop    %r13
+  800d57:	41 5e                	pop    %r14
+  800d59:	41 5f                	pop    %r15
+  800d5b:	5d                   	pop    %rbp
+  800d5c:	c3                   	ret
+
+0000000000800d5d <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800d5d:	55                   	push   %rbp
+  800d5e:	48 89 e5             	mov    %rsp,%rbp
+  800d61:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800d65:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800d69:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800d6e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800d72:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800d79:	48 85 ff             	test   %rdi,%rdi
+  800d7c:	74 2b                	je     800da9 <vsnprintf+0x4c>
+  800d7e:	48 85 f6             	test   %rsi,%rsi
+  800d81:	74 26                	je     800da9 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800d83:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800d87:	48 bf 01 06 80 00 00 	movabs $0x800601,%rdi
+  800d8e:	00 00 00 
+  800d91:	48 b8 56 06 80 00 00 	movabs $0x800656,%rax
+  800d98:	00 00 00 
+  800d9b:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800d9d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800da1:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800da4:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800da7:	c9                   	leave
+  800da8:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800da9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800dae:	eb f7                	jmp    800da7 <vsnprintf+0x4a>
+
+0000000000800db0 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800db0:	55                   	push   %rbp
+  800db1:	48 89 e5             	mov    %rsp,%rbp
+  800db4:	48 83 ec 50          	sub    $0x50,%rsp
+  800db8:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800dbc:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800dc0:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800dc4:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800dcb:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800dcf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dd3:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800dd7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800ddb:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800ddf:	48 b8 5d 0d 80 00 00 	movabs $0x800d5d,%rax
+  800de6:	00 00 00 
+  800de9:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800deb:	c9                   	leave
+  800dec:	c3                   	ret
+
+0000000000800ded <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800ded:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800df0:	74 10                	je     800e02 <strlen+0x15>
+    size_t n = 0;
+  800df2:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800df7:	48 83 c0 01          	add    $0x1,%rax
+  800dfb:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800dff:	75 f6                	jne    800df7 <strlen+0xa>
+  800e01:	c3                   	ret
+    size_t n = 0;
+  800e02:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800e07:	c3                   	ret
+
+0000000000800e08 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800e08:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800e0b:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800e10:	48 85 f6             	test   %rsi,%rsi
+  800e13:	74 11                	je     800e26 <strnlen+0x1e>
+  800e15:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800e19:	74 0c                	je     800e27 <strnlen+0x1f>
+  800e1b:	48 83 c2 01          	add    $0x1,%rdx
+  800e1f:	48 39 d0             	cmp    %rdx,%rax
+  800e22:	75 f1                	jne    800e15 <strnlen+0xd>
+  800e24:	eb 04                	jmp    800e2a <strnlen+0x22>
+  800e26:	c3                   	ret
+  800e27:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800e2a:	c3                   	ret
+
+0000000000800e2b <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800e2b:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800e2e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e33:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800e37:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800e3a:	48 83 c2 01          	add    $0x1,%rdx
+  800e3e:	84 c9                	test   %cl,%cl
+  800e40:	75 f1                	jne    800e33 <strcpy+0x8>
+        ;
+    return res;
+}
+  800e42:	c3                   	ret
+
+0000000000800e43 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800e43:	55                   	push   %rbp
+  800e44:	48 89 e5             	mov    %rsp,%rbp
+  800e47:	41 54                	push   %r12
+  800e49:	53                   	push   %rbx
+  800e4a:	48 89 fb             	mov    %rdi,%rbx
+  800e4d:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800e50:	48 b8 ed 0d 80 00 00 	movabs $0x800ded,%rax
+  800e57:	00 00 00 
+  800e5a:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800e5c:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800e60:	4c 89 e6             	mov    %r12,%rsi
+  800e63:	48 b8 2b 0e 80 00 00 	movabs $0x800e2b,%rax
+  800e6a:	00 00 00 
+  800e6d:	ff d0                	call   *%rax
+    return dst;
+}
+  800e6f:	48 89 d8             	mov    %rbx,%rax
+  800e72:	5b                   	pop    %rbx
+  800e73:	41 5c                	pop    %r12
+  800e75:	5d                   	pop    %rbp
+  800e76:	c3                   	ret
+
+0000000000800e77 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800e77:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800e7a:	48 85 d2             	test   %rdx,%rdx
+  800e7d:	74 1f                	je     800e9e <strncpy+0x27>
+  800e7f:	48 01 fa             	add    %rdi,%rdx
+  800e82:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800e85:	48 83 c1 01          	add    $0x1,%rcx
+  800e89:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800e8d:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800e91:	41 80 f8 01          	cmp    $0x1,%r8b
+  800e95:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800e99:	48 39 ca             	cmp    %rcx,%rdx
+  800e9c:	75 e7                	jne    800e85 <strncpy+0xe>
+    }
+    return ret;
+}
+  800e9e:	c3                   	ret
+
+0000000000800e9f <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800e9f:	48 89 f8             	mov    %rdi,%rax
+  800ea2:	48 85 d2             	test   %rdx,%rdx
+  800ea5:	74 24                	je     800ecb <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800ea7:	48 83 ea 01          	sub    $0x1,%rdx
+  800eab:	74 1b                	je     800ec8 <strlcpy+0x29>
+  800ead:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800eb1:	0f b6 16             	movzbl (%rsi),%edx
+  800eb4:	84 d2                	test   %dl,%dl
+  800eb6:	74 10                	je     800ec8 <strlcpy+0x29>
+            *dst++ = *src++;
+  800eb8:	48 83 c6 01          	add    $0x1,%rsi
+  800ebc:	48 83 c0 01          	add    $0x1,%rax
+  800ec0:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800ec3:	48 39 c8             	cmp    %rcx,%rax
+  800ec6:	75 e9                	jne    800eb1 <strlcpy+0x12>
+        *dst = '\0';
+  800ec8:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800ecb:	48 29 f8             	sub    %rdi,%rax
+}
+  800ece:	c3                   	ret
+
+0000000000800ecf <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800ecf:	0f b6 07             	movzbl (%rdi),%eax
+  800ed2:	84 c0                	test   %al,%al
+  800ed4:	74 13                	je     800ee9 <strcmp+0x1a>
+  800ed6:	38 06                	cmp    %al,(%rsi)
+  800ed8:	75 0f                	jne    800ee9 <strcmp+0x1a>
+  800eda:	48 83 c7 01          	add    $0x1,%rdi
+  800ede:	48 83 c6 01          	add    $0x1,%rsi
+  800ee2:	0f b6 07             	movzbl (%rdi),%eax
+  800ee5:	84 c0                	test   %al,%al
+  800ee7:	75 ed                	jne    800ed6 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800ee9:	0f b6 c0             	movzbl %al,%eax
+  800eec:	0f b6 16             	movzbl (%rsi),%edx
+  800eef:	29 d0                	sub    %edx,%eax
+}
+  800ef1:	c3                   	ret
+
+0000000000800ef2 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800ef2:	48 85 d2             	test   %rdx,%rdx
+  800ef5:	74 1f                	je     800f16 <strncmp+0x24>
+  800ef7:	0f b6 07             	movzbl (%rdi),%eax
+  800efa:	84 c0                	test   %al,%al
+  800efc:	74 1e                	je     800f1c <strncmp+0x2a>
+  800efe:	3a 06                	cmp    (%rsi),%al
+  800f00:	75 1a                	jne    800f1c <strncmp+0x2a>
+  800f02:	48 83 c7 01          	add    $0x1,%rdi
+  800f06:	48 83 c6 01          	add    $0x1,%rsi
+  800f0a:	48 83 ea 01          	sub    $0x1,%rdx
+  800f0e:	75 e7                	jne    800ef7 <strncmp+0x5>
+
+    if (!n) return 0;
+  800f10:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f15:	c3                   	ret
+  800f16:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f1b:	c3                   	ret
+  800f1c:	48 85 d2             	test   %rdx,%rdx
+  800f1f:	74 09                	je     800f2a <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f21:	0f b6 07             	movzbl (%rdi),%eax
+  800f24:	0f b6 16             	movzbl (%rsi),%edx
+  800f27:	29 d0                	sub    %edx,%eax
+  800f29:	c3                   	ret
+    if (!n) return 0;
+  800f2a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f2f:	c3                   	ret
+
+0000000000800f30 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800f30:	0f b6 17             	movzbl (%rdi),%edx
+  800f33:	84 d2                	test   %dl,%dl
+  800f35:	74 18                	je     800f4f <strchr+0x1f>
+        if (*str == c) {
+  800f37:	0f be d2             	movsbl %dl,%edx
+  800f3a:	39 f2                	cmp    %esi,%edx
+  800f3c:	74 17                	je     800f55 <strchr+0x25>
+    for (; *str; str++) {
+  800f3e:	48 83 c7 01          	add    $0x1,%rdi
+  800f42:	0f b6 17             	movzbl (%rdi),%edx
+  800f45:	84 d2                	test   %dl,%dl
+  800f47:	75 ee                	jne    800f37 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800f49:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f4e:	c3                   	ret
+  800f4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f54:	c3                   	ret
+  800f55:	48 89 f8             	mov    %rdi,%rax
+}
+  800f58:	c3                   	ret
+
+0000000000800f59 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800f59:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800f5c:	0f b6 17             	movzbl (%rdi),%edx
+  800f5f:	84 d2                	test   %dl,%dl
+  800f61:	74 13                	je     800f76 <strfind+0x1d>
+  800f63:	0f be d2             	movsbl %dl,%edx
+  800f66:	39 f2                	cmp    %esi,%edx
+  800f68:	74 0b                	je     800f75 <strfind+0x1c>
+  800f6a:	48 83 c0 01          	add    $0x1,%rax
+  800f6e:	0f b6 10             	movzbl (%rax),%edx
+  800f71:	84 d2                	test   %dl,%dl
+  800f73:	75 ee                	jne    800f63 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800f75:	c3                   	ret
+  800f76:	c3                   	ret
+
+0000000000800f77 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800f77:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800f7a:	48 89 f8             	mov    %rdi,%rax
+  800f7d:	48 f7 d8             	neg    %rax
+  800f80:	83 e0 07             	and    $0x7,%eax
+  800f83:	49 89 d1             	mov    %rdx,%r9
+  800f86:	49 29 c1             	sub    %rax,%r9
+  800f89:	78 36                	js     800fc1 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800f8b:	40 0f b6 c6          	movzbl %sil,%eax
+  800f8f:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800f96:	01 01 01 
+  800f99:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800f9d:	40 f6 c7 07          	test   $0x7,%dil
+  800fa1:	75 38                	jne    800fdb <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800fa3:	4c 89 c9             	mov    %r9,%rcx
+  800fa6:	48 c1 f9 03          	sar    $0x3,%rcx
+  800faa:	74 0c                	je     800fb8 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800fac:	fc                   	cld
+  800fad:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800fb0:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800fb4:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800fb8:	4d 85 c9             	test   %r9,%r9
+  800fbb:	75 45                	jne    801002 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800fbd:	4c 89 c0             	mov    %r8,%rax
+  800fc0:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800fc1:	48 85 d2             	test   %rdx,%rdx
+  800fc4:	74 f7                	je     800fbd <memset+0x46>
+  800fc6:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800fc9:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800fcc:	48 83 c0 01          	add    $0x1,%rax
+  800fd0:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800fd4:	48 39 c2             	cmp    %rax,%rdx
+  800fd7:	75 f3                	jne    800fcc <memset+0x55>
+  800fd9:	eb e2                	jmp    800fbd <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800fdb:	40 f6 c7 01          	test   $0x1,%dil
+  800fdf:	74 06                	je     800fe7 <memset+0x70>
+  800fe1:	88 07                	mov    %al,(%rdi)
+  800fe3:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800fe7:	40 f6 c7 02          	test   $0x2,%dil
+  800feb:	74 07                	je     800ff4 <memset+0x7d>
+  800fed:	66 89 07             	mov    %ax,(%rdi)
+  800ff0:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800ff4:	40 f6 c7 04          	test   $0x4,%dil
+  800ff8:	74 a9                	je     800fa3 <memset+0x2c>
+  800ffa:	89 07                	mov    %eax,(%rdi)
+  800ffc:	48 83 c7 04          	add    $0x4,%rdi
+  801000:	eb a1                	jmp    800fa3 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801002:	41 f6 c1 04          	test   $0x4,%r9b
+  801006:	74 06                	je     80100e <memset+0x97>
+  801008:	89 07                	mov    %eax,(%rdi)
+  80100a:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80100e:	41 f6 c1 02          	test   $0x2,%r9b
+  801012:	74 07                	je     80101b <memset+0xa4>
+  801014:	66 89 07             	mov    %ax,(%rdi)
+  801017:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  80101b:	41 f6 c1 01          	test   $0x1,%r9b
+  80101f:	74 9c                	je     800fbd <memset+0x46>
+  801021:	88 07                	mov    %al,(%rdi)
+  801023:	eb 98                	jmp    800fbd <memset+0x46>
+
+0000000000801025 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  801025:	48 89 f8             	mov    %rdi,%rax
+  801028:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  80102b:	48 39 fe             	cmp    %rdi,%rsi
+  80102e:	73 3b                	jae    80106b <memmove+0x46>
+  801030:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  801034:	48 39 d7             	cmp    %rdx,%rdi
+  801037:	73 32                	jae    80106b <memmove+0x46>
+        s += n;
+        d += n;
+  801039:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80103d:	48 89 d6             	mov    %rdx,%rsi
+  801040:	48 09 fe             	or     %rdi,%rsi
+  801043:	48 09 ce             	or     %rcx,%rsi
+  801046:	40 f6 c6 07          	test   $0x7,%sil
+  80104a:	75 12                	jne    80105e <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  80104c:	48 83 ef 08          	sub    $0x8,%rdi
+  801050:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  801054:	48 c1 e9 03          	shr    $0x3,%rcx
+  801058:	fd                   	std
+  801059:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  80105c:	fc                   	cld
+  80105d:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  80105e:	48 83 ef 01          	sub    $0x1,%rdi
+  801062:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  801066:	fd                   	std
+  801067:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801069:	eb f1                	jmp    80105c <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80106b:	48 89 f2             	mov    %rsi,%rdx
+  80106e:	48 09 c2             	or     %rax,%rdx
+  801071:	48 09 ca             	or     %rcx,%rdx
+  801074:	f6 c2 07             	test   $0x7,%dl
+  801077:	75 0c                	jne    801085 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801079:	48 c1 e9 03          	shr    $0x3,%rcx
+  80107d:	48 89 c7             	mov    %rax,%rdi
+  801080:	fc                   	cld
+  801081:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801084:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801085:	48 89 c7             	mov    %rax,%rdi
+  801088:	fc                   	cld
+  801089:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  80108b:	c3                   	ret
+
+000000000080108c <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80108c:	55                   	push   %rbp
+  80108d:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801090:	48 b8 25 10 80 00 00 	movabs $0x801025,%rax
+  801097:	00 00 00 
+  80109a:	ff d0                	call   *%rax
+}
+  80109c:	5d                   	pop    %rbp
+  80109d:	c3                   	ret
+
+000000000080109e <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80109e:	55                   	push   %rbp
+  80109f:	48 89 e5             	mov    %rsp,%rbp
+  8010a2:	41 57                	push   %r15
+  8010a4:	41 56                	push   %r14
+  8010a6:	41 55                	push   %r13
+  8010a8:	41 54                	push   %r12
+  8010aa:	53                   	push   %rbx
+  8010ab:	48 83 ec 08          	sub    $0x8,%rsp
+  8010af:	49 89 fe             	mov    %rdi,%r14
+  8010b2:	49 89 f7             	mov    %rsi,%r15
+  8010b5:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8010b8:	48 89 f7             	mov    %rsi,%rdi
+  8010bb:	48 b8 ed 0d 80 00 00 	movabs $0x800ded,%rax
+  8010c2:	00 00 00 
+  8010c5:	ff d0                	call   *%rax
+  8010c7:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8010ca:	48 89 de             	mov    %rbx,%rsi
+  8010cd:	4c 89 f7             	mov    %r14,%rdi
+  8010d0:	48 b8 08 0e 80 00 00 	movabs $0x800e08,%rax
+  8010d7:	00 00 00 
+  8010da:	ff d0                	call   *%rax
+  8010dc:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8010df:	48 39 c3             	cmp    %rax,%rbx
+  8010e2:	74 36                	je     80111a <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8010e4:	48 89 d8             	mov    %rbx,%rax
+  8010e7:	4c 29 e8             	sub    %r13,%rax
+  8010ea:	49 39 c4             	cmp    %rax,%r12
+  8010ed:	73 31                	jae    801120 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8010ef:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8010f4:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8010f8:	4c 89 fe             	mov    %r15,%rsi
+  8010fb:	48 b8 8c 10 80 00 00 	movabs $0x80108c,%rax
+  801102:	00 00 00 
+  801105:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801107:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80110b:	48 83 c4 08          	add    $0x8,%rsp
+  80110f:	5b                   	pop    %rbx
+  801110:	41 5c                	pop    %r12
+  801112:	41 5d                	pop    %r13
+  801114:	41 5e                	pop    %r14
+  801116:	41 5f                	pop    %r15
+  801118:	5d                   	pop    %rbp
+  801119:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80111a:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80111e:	eb eb                	jmp    80110b <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801120:	48 83 eb 01          	sub    $0x1,%rbx
+  801124:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801128:	48 89 da             	mov    %rbx,%rdx
+  80112b:	4c 89 fe             	mov    %r15,%rsi
+  80112e:	48 b8 8c 10 80 00 00 	movabs $0x80108c,%rax
+  801135:	00 00 00 
+  801138:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  80113a:	49 01 de             	add    %rbx,%r14
+  80113d:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801142:	eb c3                	jmp    801107 <strlcat+0x69>
+
+0000000000801144 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801144:	48 85 d2             	test   %rdx,%rdx
+  801147:	74 2d                	je     801176 <memcmp+0x32>
+  801149:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80114e:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801152:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801157:	44 38 c1             	cmp    %r8b,%cl
+  80115a:	75 0f                	jne    80116b <memcmp+0x27>
+    while (n-- > 0) {
+  80115c:	48 83 c0 01          	add    $0x1,%rax
+  801160:	48 39 c2             	cmp    %rax,%rdx
+  801163:	75 e9                	jne    80114e <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801165:	b8 00 00 00 00       	mov    $0x0,%eax
+  80116a:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80116b:	0f b6 c1             	movzbl %cl,%eax
+  80116e:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801172:	44 29 c0             	sub    %r8d,%eax
+  801175:	c3                   	ret
+    return 0;
+  801176:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80117b:	c3                   	ret
+
+000000000080117c <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80117c:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801180:	48 39 c7             	cmp    %rax,%rdi
+  801183:	73 0f                	jae    801194 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801185:	40 38 37             	cmp    %sil,(%rdi)
+  801188:	74 0e                	je     801198 <memfind+0x1c>
+    for (; src < end; src++) {
+  80118a:	48 83 c7 01          	add    $0x1,%rdi
+  80118e:	48 39 f8             	cmp    %rdi,%rax
+  801191:	75 f2                	jne    801185 <memfind+0x9>
+  801193:	c3                   	ret
+  801194:	48 89 f8             	mov    %rdi,%rax
+  801197:	c3                   	ret
+  801198:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80119b:	c3                   	ret
+
+000000000080119c <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80119c:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80119f:	0f b6 37             	movzbl (%rdi),%esi
+  8011a2:	40 80 fe 20          	cmp    $0x20,%sil
+  8011a6:	74 06                	je     8011ae <strtol+0x12>
+  8011a8:	40 80 fe 09          	cmp    $0x9,%sil
+  8011ac:	75 13                	jne    8011c1 <strtol+0x25>
+  8011ae:	48 83 c7 01          	add    $0x1,%rdi
+  8011b2:	0f b6 37             	movzbl (%rdi),%esi
+  8011b5:	40 80 fe 20          	cmp    $0x20,%sil
+  8011b9:	74 f3                	je     8011ae <strtol+0x12>
+  8011bb:	40 80 fe 09          	cmp    $0x9,%sil
+  8011bf:	74 ed                	je     8011ae <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8011c1:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8011c4:	83 e0 fd             	and    $0xfffffffd,%eax
+  8011c7:	3c 01                	cmp    $0x1,%al
+  8011c9:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8011cd:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8011d3:	75 0f                	jne    8011e4 <strtol+0x48>
+  8011d5:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8011d8:	74 14                	je     8011ee <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8011da:	85 d2                	test   %edx,%edx
+  8011dc:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8011e1:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8011e4:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8011e9:	4c 63 ca             	movslq %edx,%r9
+  8011ec:	eb 36                	jmp    801224 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8011ee:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8011f2:	74 0f                	je     801203 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8011f4:	85 d2                	test   %edx,%edx
+  8011f6:	75 ec                	jne    8011e4 <strtol+0x48>
+        s++;
+  8011f8:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8011fc:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801201:	eb e1                	jmp    8011e4 <strtol+0x48>
+        s += 2;
+  801203:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801207:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80120c:	eb d6                	jmp    8011e4 <strtol+0x48>
+            dig -= '0';
+  80120e:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801211:	44 0f b6 c1          	movzbl %cl,%r8d
+  801215:	41 39 d0             	cmp    %edx,%r8d
+  801218:	7d 21                	jge    80123b <strtol+0x9f>
+        val = val * base + dig;
+  80121a:	49 0f af c1          	imul   %r9,%rax
+  80121e:	0f b6 c9             	movzbl %cl,%ecx
+  801221:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801224:	48 83 c7 01          	add    $0x1,%rdi
+  801228:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80122c:	80 f9 39             	cmp    $0x39,%cl
+  80122f:	76 dd                	jbe    80120e <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801231:	80 f9 7b             	cmp    $0x7b,%cl
+  801234:	77 05                	ja     80123b <strtol+0x9f>
+            dig -= 'a' - 10;
+  801236:	83 e9 57             	sub    $0x57,%ecx
+  801239:	eb d6                	jmp    801211 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  80123b:	4d 85 d2             	test   %r10,%r10
+  80123e:	74 03                	je     801243 <strtol+0xa7>
+  801240:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801243:	48 89 c2             	mov    %rax,%rdx
+  801246:	48 f7 da             	neg    %rdx
+  801249:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80124d:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801251:	c3                   	ret
+
+0000000000801252 <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  801252:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801257:	ba 00 00 00 00       	mov    $0x0,%edx
+  80125c:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801262:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801268:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  80126e:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801270:	c3                   	ret
+
+0000000000801271 <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  801271:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801276:	bf 00 00 00 00       	mov    $0x0,%edi
+  80127b:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801280:	ba 00 00 00 00       	mov    $0x0,%edx
+  801285:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80128b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801291:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801297:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801299:	c3                   	ret
+
+000000000080129a <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80129a:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80129d:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8012a2:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8012a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012ac:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8012b2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8012b8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8012be:	0f 05                	syscall
+    if (check && ret > 0) {
+  8012c0:	48 85 c0             	test   %rax,%rax
+  8012c3:	7f 01                	jg     8012c6 <sys_env_destroy+0x2c>
+}
+  8012c5:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  8012c6:	55                   	push   %rbp
+  8012c7:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012ca:	49 89 c0             	mov    %rax,%r8
+  8012cd:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8012d2:	48 ba b8 50 80 00 00 	movabs $0x8050b8,%rdx
+  8012d9:	00 00 00 
+  8012dc:	be 29 00 00 00       	mov    $0x29,%esi
+  8012e1:	48 bf d7 50 80 00 00 	movabs $0x8050d7,%rdi
+  8012e8:	00 00 00 
+  8012eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012f0:	49 b9 b6 03 80 00 00 	movabs $0x8003b6,%r9
+  8012f7:	00 00 00 
+  8012fa:	41 ff d1             	call   *%r9
+
+00000000008012fd <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  8012fd:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801302:	bf 00 00 00 00       	mov    $0x0,%edi
+  801307:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80130c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801311:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801317:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80131d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801323:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801325:	c3                   	ret
+
+0000000000801326 <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  801326:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80132b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801330:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801335:	ba 00 00 00 00       	mov    $0x0,%edx
+  80133a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801340:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801346:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80134c:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80134e:	c3                   	ret
+
+000000000080134f <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  80134f:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801354:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  80135b:	00 00 00 
+  80135e:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801364:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80136a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801370:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801372:	c3                   	ret
+
+0000000000801373 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801373:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  801376:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80137b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801381:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801387:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801389:	c3                   	ret
+
+000000000080138a <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80138a:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80138d:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801392:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801395:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80139b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013a1:	0f 05                	syscall
+    if (check && ret > 0) {
+  8013a3:	48 85 c0             	test   %rax,%rax
+  8013a6:	7f 01                	jg     8013a9 <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8013a8:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8013a9:	55                   	push   %rbp
+  8013aa:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013ad:	49 89 c0             	mov    %rax,%r8
+  8013b0:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8013b5:	48 ba b8 50 80 00 00 	movabs $0x8050b8,%rdx
+  8013bc:	00 00 00 
+  8013bf:	be 29 00 00 00       	mov    $0x29,%esi
+  8013c4:	48 bf d7 50 80 00 00 	movabs $0x8050d7,%rdi
+  8013cb:	00 00 00 
+  8013ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013d3:	49 b9 b6 03 80 00 00 	movabs $0x8003b6,%r9
+  8013da:	00 00 00 
+  8013dd:	41 ff d1             	call   *%r9
+
+00000000008013e0 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8013e0:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8013e3:	48 63 d2             	movslq %edx,%rdx
+  8013e6:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8013e9:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013ee:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  8013f1:	0f 05                	syscall
+    if (check && ret > 0) {
+  8013f3:	48 85 c0             	test   %rax,%rax
+  8013f6:	7f 01                	jg     8013f9 <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8013f8:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8013f9:	55                   	push   %rbp
+  8013fa:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013fd:	49 89 c0             	mov    %rax,%r8
+  801400:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801405:	48 ba b8 50 80 00 00 	movabs $0x8050b8,%rdx
+  80140c:	00 00 00 
+  80140f:	be 29 00 00 00       	mov    $0x29,%esi
+  801414:	48 bf d7 50 80 00 00 	movabs $0x8050d7,%rdi
+  80141b:	00 00 00 
+  80141e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801423:	49 b9 b6 03 80 00 00 	movabs $0x8003b6,%r9
+  80142a:	00 00 00 
+  80142d:	41 ff d1             	call   *%r9
+
+0000000000801430 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801430:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801433:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801438:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80143e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801444:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80144a:	0f 05                	syscall
+    if (check && ret > 0) {
+  80144c:	48 85 c0             	test   %rax,%rax
+  80144f:	7f 01                	jg     801452 <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801451:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801452:	55                   	push   %rbp
+  801453:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801456:	49 89 c0             	mov    %rax,%r8
+  801459:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80145e:	48 ba b8 50 80 00 00 	movabs $0x8050b8,%rdx
+  801465:	00 00 00 
+  801468:	be 29 00 00 00       	mov    $0x29,%esi
+  80146d:	48 bf d7 50 80 00 00 	movabs $0x8050d7,%rdi
+  801474:	00 00 00 
+  801477:	b8 00 00 00 00       	mov    $0x0,%eax
+  80147c:	49 b9 b6 03 80 00 00 	movabs $0x8003b6,%r9
+  801483:	00 00 00 
+  801486:	41 ff d1             	call   *%r9
+
+0000000000801489 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801489:	48 63 f6             	movslq %esi,%rsi
+  80148c:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80148f:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801494:	ba 00 00 00 00       	mov    $0x0,%edx
+  801499:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80149f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014a5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8014ab:	0f 05                	syscall
+    if (check && ret > 0) {
+  8014ad:	48 85 c0             	test   %rax,%rax
+  8014b0:	7f 01                	jg     8014b3 <sys_env_set_status+0x2a>
+}
+  8014b2:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  8014b3:	55                   	push   %rbp
+  8014b4:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014b7:	49 89 c0             	mov    %rax,%r8
+  8014ba:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8014bf:	48 ba b8 50 80 00 00 	movabs $0x8050b8,%rdx
+  8014c6:	00 00 00 
+  8014c9:	be 29 00 00 00       	mov    $0x29,%esi
+  8014ce:	48 bf d7 50 80 00 00 	movabs $0x8050d7,%rdi
+  8014d5:	00 00 00 
+  8014d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014dd:	49 b9 b6 03 80 00 00 	movabs $0x8003b6,%r9
+  8014e4:	00 00 00 
+  8014e7:	41 ff d1             	call   *%r9
+
+00000000008014ea <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8014ea:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8014ed:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8014f2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014f7:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014fd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801503:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801509:	0f 05                	syscall
+    if (check && ret > 0) {
+  80150b:	48 85 c0             	test   %rax,%rax
+  80150e:	7f 01                	jg     801511 <sys_env_set_trapframe+0x27>
+}
+  801510:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801511:	55                   	push   %rbp
+  801512:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801515:	49 89 c0             	mov    %rax,%r8
+  801518:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80151d:	48 ba b8 50 80 00 00 	movabs $0x8050b8,%rdx
+  801524:	00 00 00 
+  801527:	be 29 00 00 00       	mov    $0x29,%esi
+  80152c:	48 bf d7 50 80 00 00 	movabs $0x8050d7,%rdi
+  801533:	00 00 00 
+  801536:	b8 00 00 00 00       	mov    $0x0,%eax
+  80153b:	49 b9 b6 03 80 00 00 	movabs $0x8003b6,%r9
+  801542:	00 00 00 
+  801545:	41 ff d1             	call   *%r9
+
+0000000000801548 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801548:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80154b:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801550:	ba 00 00 00 00       	mov    $0x0,%edx
+  801555:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80155b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801561:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801567:	0f 05                	syscall
+    if (check && ret > 0) {
+  801569:	48 85 c0             	test   %rax,%rax
+  80156c:	7f 01                	jg     80156f <sys_env_set_pgfault_upcall+0x27>
+}
+  80156e:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80156f:	55                   	push   %rbp
+  801570:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801573:	49 89 c0             	mov    %rax,%r8
+  801576:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80157b:	48 ba b8 50 80 00 00 	movabs $0x8050b8,%rdx
+  801582:	00 00 00 
+  801585:	be 29 00 00 00       	mov    $0x29,%esi
+  80158a:	48 bf d7 50 80 00 00 	movabs $0x8050d7,%rdi
+  801591:	00 00 00 
+  801594:	b8 00 00 00 00       	mov    $0x0,%eax
+  801599:	49 b9 b6 03 80 00 00 	movabs $0x8003b6,%r9
+  8015a0:	00 00 00 
+  8015a3:	41 ff d1             	call   *%r9
+
+00000000008015a6 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8015a6:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8015a9:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8015ac:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8015b1:	4d 63 c0             	movslq %r8d,%r8
+  8015b4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8015ba:	0f 05                	syscall
+}
+  8015bc:	c3                   	ret
+
+00000000008015bd <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8015bd:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8015c0:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8015c3:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8015c8:	4d 63 c0             	movslq %r8d,%r8
+  8015cb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8015d1:	0f 05                	syscall
+}
+  8015d3:	c3                   	ret
+
+00000000008015d4 <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  8015d4:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8015d9:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8015dc:	45 89 c0             	mov    %r8d,%r8d
+  8015df:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8015e5:	0f 05                	syscall
+    if (check && ret > 0) {
+  8015e7:	48 85 c0             	test   %rax,%rax
+  8015ea:	7f 01                	jg     8015ed <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8015ec:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8015ed:	55                   	push   %rbp
+  8015ee:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015f1:	49 89 c0             	mov    %rax,%r8
+  8015f4:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8015f9:	48 ba b8 50 80 00 00 	movabs $0x8050b8,%rdx
+  801600:	00 00 00 
+  801603:	be 29 00 00 00       	mov    $0x29,%esi
+  801608:	48 bf d7 50 80 00 00 	movabs $0x8050d7,%rdi
+  80160f:	00 00 00 
+  801612:	b8 00 00 00 00       	mov    $0x0,%eax
+  801617:	49 b9 b6 03 80 00 00 	movabs $0x8003b6,%r9
+  80161e:	00 00 00 
+  801621:	41 ff d1             	call   *%r9
+
+0000000000801624 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  801624:	55                   	push   %rbp
+  801625:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  801628:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80162e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801633:	ba 00 00 00 00       	mov    $0x0,%edx
+  801638:	48 b8 d4 15 80 00 00 	movabs $0x8015d4,%rax
+  80163f:	00 00 00 
+  801642:	ff d0                	call   *%rax
+}
+  801644:	5d                   	pop    %rbp
+  801645:	c3                   	ret
+
+0000000000801646 <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  801646:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80164b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801650:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801655:	ba 00 00 00 00       	mov    $0x0,%edx
+  80165a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801660:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801666:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80166c:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80166e:	c3                   	ret
+
+000000000080166f <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  80166f:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801674:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801679:	ba 00 00 00 00       	mov    $0x0,%edx
+  80167e:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801684:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80168a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801690:	0f 05                	syscall
+    if (check && ret > 0) {
+  801692:	48 85 c0             	test   %rax,%rax
+  801695:	7f 01                	jg     801698 <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  801697:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  801698:	55                   	push   %rbp
+  801699:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80169c:	49 89 c0             	mov    %rax,%r8
+  80169f:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8016a4:	48 ba b8 50 80 00 00 	movabs $0x8050b8,%rdx
+  8016ab:	00 00 00 
+  8016ae:	be 29 00 00 00       	mov    $0x29,%esi
+  8016b3:	48 bf d7 50 80 00 00 	movabs $0x8050d7,%rdi
+  8016ba:	00 00 00 
+  8016bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016c2:	49 b9 b6 03 80 00 00 	movabs $0x8003b6,%r9
+  8016c9:	00 00 00 
+  8016cc:	41 ff d1             	call   *%r9
+
+00000000008016cf <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  8016cf:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8016d4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8016d9:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8016de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016e3:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8016e9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8016ef:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8016f5:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  8016f7:	c3                   	ret
+
+00000000008016f8 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  8016f8:	89 d2                	mov    %edx,%edx
+  8016fa:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  8016fc:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801701:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801707:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80170d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801713:	0f 05                	syscall
+}
+  801715:	c3                   	ret
+
+0000000000801716 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  801716:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  801719:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80171e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801723:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801729:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80172f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801735:	0f 05                	syscall
+}
+  801737:	c3                   	ret
+
+0000000000801738 <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  801738:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  80173b:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801740:	ba 00 00 00 00       	mov    $0x0,%edx
+  801745:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80174b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801751:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801757:	0f 05                	syscall
+}
+  801759:	c3                   	ret
+
+000000000080175a <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  80175a:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80175d:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801762:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801767:	ba 00 00 00 00       	mov    $0x0,%edx
+  80176c:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801772:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801778:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80177e:	0f 05                	syscall
+    if (check && ret > 0) {
+  801780:	48 85 c0             	test   %rax,%rax
+  801783:	7f 01                	jg     801786 <sys_irq_ack+0x2c>
+}
+  801785:	c3                   	ret
+sys_irq_ack(int irq) {
+  801786:	55                   	push   %rbp
+  801787:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80178a:	49 89 c0             	mov    %rax,%r8
+  80178d:	b9 16 00 00 00       	mov    $0x16,%ecx
+  801792:	48 ba b8 50 80 00 00 	movabs $0x8050b8,%rdx
+  801799:	00 00 00 
+  80179c:	be 29 00 00 00       	mov    $0x29,%esi
+  8017a1:	48 bf d7 50 80 00 00 	movabs $0x8050d7,%rdi
+  8017a8:	00 00 00 
+  8017ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017b0:	49 b9 b6 03 80 00 00 	movabs $0x8003b6,%r9
+  8017b7:	00 00 00 
+  8017ba:	41 ff d1             	call   *%r9
+
+00000000008017bd <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  8017bd:	55                   	push   %rbp
+  8017be:	48 89 e5             	mov    %rsp,%rbp
+  8017c1:	41 54                	push   %r12
+  8017c3:	53                   	push   %rbx
+    // LAB 9: Your code here
+    /* The child would write them out once more */
+    file_flush_buffers();
+  8017c4:	48 b8 f1 31 80 00 00 	movabs $0x8031f1,%rax
+  8017cb:	00 00 00 
+  8017ce:	ff d0                	call   *%rax
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("syscall"
+  8017d0:	b8 08 00 00 00       	mov    $0x8,%eax
+  8017d5:	0f 05                	syscall
+  8017d7:	41 89 c4             	mov    %eax,%r12d
+
+	envid_t envid = sys_exofork();
+    if (envid < 0)
+  8017da:	85 c0                	test   %eax,%eax
+  8017dc:	78 7e                	js     80185c <fork+0x9f>
+        return envid;
+    if (envid == 0) {
+  8017de:	0f 84 80 00 00 00    	je     801864 <fork+0xa7>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE) < 0) {
+  8017e4:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  8017ea:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  8017f1:	00 00 00 
+  8017f4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017f9:	89 c2                	mov    %eax,%edx
+  8017fb:	be 00 00 00 00       	mov    $0x0,%esi
+  801800:	bf 00 00 00 00       	mov    $0x0,%edi
+  801805:	48 b8 e0 13 80 00 00 	movabs $0x8013e0,%rax
+  80180c:	00 00 00 
+  80180f:	ff d0                	call   *%rax
+  801811:	85 c0                	test   %eax,%eax
+  801813:	0f 88 86 00 00 00    	js     80189f <fork+0xe2>
+		return -1;
+	}
+    if (sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall) < 0) {
+  801819:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801820:	00 00 00 
+  801823:	48 8b b0 28 01 00 00 	mov    0x128(%rax),%rsi
+  80182a:	44 89 e7             	mov    %r12d,%edi
+  80182d:	48 b8 48 15 80 00 00 	movabs $0x801548,%rax
+  801834:	00 00 00 
+  801837:	ff d0                	call   *%rax
+  801839:	85 c0                	test   %eax,%eax
+  80183b:	78 6a                	js     8018a7 <fork+0xea>
+		return -1;
+	}
+    if (sys_env_set_status(envid, ENV_RUNNABLE) < 0) {
+  80183d:	be 02 00 00 00       	mov    $0x2,%esi
+  801842:	44 89 e7             	mov    %r12d,%edi
+  801845:	48 b8 89 14 80 00 00 	movabs $0x801489,%rax
+  80184c:	00 00 00 
+  80184f:	ff d0                	call   *%rax
+		return -1;
+  801851:	85 c0                	test   %eax,%eax
+  801853:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801858:	44 0f 48 e0          	cmovs  %eax,%r12d
+	}
+    return envid;
+}
+  80185c:	44 89 e0             	mov    %r12d,%eax
+  80185f:	5b                   	pop    %rbx
+  801860:	41 5c                	pop    %r12
+  801862:	5d                   	pop    %rbp
+  801863:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801864:	48 b8 fd 12 80 00 00 	movabs $0x8012fd,%rax
+  80186b:	00 00 00 
+  80186e:	ff d0                	call   *%rax
+  801870:	89 c2                	mov    %eax,%edx
+  801872:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  801878:	48 89 d0             	mov    %rdx,%rax
+  80187b:	48 c1 e0 04          	shl    $0x4,%rax
+  80187f:	48 29 d0             	sub    %rdx,%rax
+  801882:	48 c1 e0 05          	shl    $0x5,%rax
+  801886:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80188d:	00 00 00 
+  801890:	48 01 d0             	add    %rdx,%rax
+  801893:	48 a3 00 00 81 00 00 	movabs %rax,0x810000
+  80189a:	00 00 00 
+        return 0;
+  80189d:	eb bd                	jmp    80185c <fork+0x9f>
+		return -1;
+  80189f:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  8018a5:	eb b5                	jmp    80185c <fork+0x9f>
+		return -1;
+  8018a7:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  8018ad:	eb ad                	jmp    80185c <fork+0x9f>
+
+00000000008018af <sfork>:
+
+envid_t
+sfork() {
+  8018af:	55                   	push   %rbp
+  8018b0:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  8018b3:	48 ba e5 50 80 00 00 	movabs $0x8050e5,%rdx
+  8018ba:	00 00 00 
+  8018bd:	be 2d 00 00 00       	mov    $0x2d,%esi
+  8018c2:	48 bf 00 51 80 00 00 	movabs $0x805100,%rdi
+  8018c9:	00 00 00 
+  8018cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018d1:	48 b9 b6 03 80 00 00 	movabs $0x8003b6,%rcx
+  8018d8:	00 00 00 
+  8018db:	ff d1                	call   *%rcx
+
+00000000008018dd <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8018dd:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8018e4:	ff ff ff 
+  8018e7:	48 01 f8             	add    %rdi,%rax
+  8018ea:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8018ee:	c3                   	ret
+
+00000000008018ef <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8018ef:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8018f6:	ff ff ff 
+  8018f9:	48 01 f8             	add    %rdi,%rax
+  8018fc:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801900:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801906:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80190a:	c3                   	ret
+
+000000000080190b <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  80190b:	55                   	push   %rbp
+  80190c:	48 89 e5             	mov    %rsp,%rbp
+  80190f:	41 57                	push   %r15
+  801911:	41 56                	push   %r14
+  801913:	41 55                	push   %r13
+  801915:	41 54                	push   %r12
+  801917:	53                   	push   %rbx
+  801918:	48 83 ec 08          	sub    $0x8,%rsp
+  80191c:	49 89 ff             	mov    %rdi,%r15
+  80191f:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801924:	49 bd 9a 40 80 00 00 	movabs $0x80409a,%r13
+  80192b:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  80192e:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801934:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801937:	48 89 df             	mov    %rbx,%rdi
+  80193a:	41 ff d5             	call   *%r13
+  80193d:	83 e0 04             	and    $0x4,%eax
+  801940:	74 17                	je     801959 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801942:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801949:	4c 39 f3             	cmp    %r14,%rbx
+  80194c:	75 e6                	jne    801934 <fd_alloc+0x29>
+  80194e:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801954:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801959:	4d 89 27             	mov    %r12,(%r15)
+}
+  80195c:	48 83 c4 08          	add    $0x8,%rsp
+  801960:	5b                   	pop    %rbx
+  801961:	41 5c                	pop    %r12
+  801963:	41 5d                	pop    %r13
+  801965:	41 5e                	pop    %r14
+  801967:	41 5f                	pop    %r15
+  801969:	5d                   	pop    %rbp
+  80196a:	c3                   	ret
+
+000000000080196b <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  80196b:	83 ff 1f             	cmp    $0x1f,%edi
+  80196e:	77 39                	ja     8019a9 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801970:	55                   	push   %rbp
+  801971:	48 89 e5             	mov    %rsp,%rbp
+  801974:	41 54                	push   %r12
+  801976:	53                   	push   %rbx
+  801977:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  80197a:	48 63 df             	movslq %edi,%rbx
+  80197d:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801984:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801988:	48 89 df             	mov    %rbx,%rdi
+  80198b:	48 b8 9a 40 80 00 00 	movabs $0x80409a,%rax
+  801992:	00 00 00 
+  801995:	ff d0                	call   *%rax
+  801997:	a8 04                	test   $0x4,%al
+  801999:	74 14                	je     8019af <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  80199b:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  80199f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019a4:	5b                   	pop    %rbx
+  8019a5:	41 5c                	pop    %r12
+  8019a7:	5d                   	pop    %rbp
+  8019a8:	c3                   	ret
+        return -E_INVAL;
+  8019a9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8019ae:	c3                   	ret
+        return -E_INVAL;
+  8019af:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019b4:	eb ee                	jmp    8019a4 <fd_lookup+0x39>
+
+00000000008019b6 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8019b6:	55                   	push   %rbp
+  8019b7:	48 89 e5             	mov    %rsp,%rbp
+  8019ba:	41 54                	push   %r12
+  8019bc:	53                   	push   %rbx
+  8019bd:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8019c0:	48 b8 a0 51 80 00 00 	movabs $0x8051a0,%rax
+  8019c7:	00 00 00 
+  8019ca:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  8019d1:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8019d4:	39 3b                	cmp    %edi,(%rbx)
+  8019d6:	74 47                	je     801a1f <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8019d8:	48 83 c0 08          	add    $0x8,%rax
+  8019dc:	48 8b 18             	mov    (%rax),%rbx
+  8019df:	48 85 db             	test   %rbx,%rbx
+  8019e2:	75 f0                	jne    8019d4 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8019e4:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8019eb:	00 00 00 
+  8019ee:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8019f4:	89 fa                	mov    %edi,%edx
+  8019f6:	48 bf 10 51 80 00 00 	movabs $0x805110,%rdi
+  8019fd:	00 00 00 
+  801a00:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a05:	48 b9 06 05 80 00 00 	movabs $0x800506,%rcx
+  801a0c:	00 00 00 
+  801a0f:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801a11:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801a16:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801a1a:	5b                   	pop    %rbx
+  801a1b:	41 5c                	pop    %r12
+  801a1d:	5d                   	pop    %rbp
+  801a1e:	c3                   	ret
+            return 0;
+  801a1f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a24:	eb f0                	jmp    801a16 <dev_lookup+0x60>
+
+0000000000801a26 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801a26:	55                   	push   %rbp
+  801a27:	48 89 e5             	mov    %rsp,%rbp
+  801a2a:	41 55                	push   %r13
+  801a2c:	41 54                	push   %r12
+  801a2e:	53                   	push   %rbx
+  801a2f:	48 83 ec 18          	sub    $0x18,%rsp
+  801a33:	48 89 fb             	mov    %rdi,%rbx
+  801a36:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a39:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801a40:	ff ff ff 
+  801a43:	48 01 df             	add    %rbx,%rdi
+  801a46:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801a4a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801a4e:	48 b8 6b 19 80 00 00 	movabs $0x80196b,%rax
+  801a55:	00 00 00 
+  801a58:	ff d0                	call   *%rax
+  801a5a:	41 89 c5             	mov    %eax,%r13d
+  801a5d:	85 c0                	test   %eax,%eax
+  801a5f:	78 06                	js     801a67 <fd_close+0x41>
+  801a61:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801a65:	74 1a                	je     801a81 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801a67:	45 84 e4             	test   %r12b,%r12b
+  801a6a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a6f:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801a73:	44 89 e8             	mov    %r13d,%eax
+  801a76:	48 83 c4 18          	add    $0x18,%rsp
+  801a7a:	5b                   	pop    %rbx
+  801a7b:	41 5c                	pop    %r12
+  801a7d:	41 5d                	pop    %r13
+  801a7f:	5d                   	pop    %rbp
+  801a80:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801a81:	8b 3b                	mov    (%rbx),%edi
+  801a83:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801a87:	48 b8 b6 19 80 00 00 	movabs $0x8019b6,%rax
+  801a8e:	00 00 00 
+  801a91:	ff d0                	call   *%rax
+  801a93:	41 89 c5             	mov    %eax,%r13d
+  801a96:	85 c0                	test   %eax,%eax
+  801a98:	78 1b                	js     801ab5 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801a9a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a9e:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801aa2:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801aa8:	48 85 c0             	test   %rax,%rax
+  801aab:	74 08                	je     801ab5 <fd_close+0x8f>
+  801aad:	48 89 df             	mov    %rbx,%rdi
+  801ab0:	ff d0                	call   *%rax
+  801ab2:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801ab5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801aba:	48 89 de             	mov    %rbx,%rsi
+  801abd:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ac2:	48 b8 30 14 80 00 00 	movabs $0x801430,%rax
+  801ac9:	00 00 00 
+  801acc:	ff d0                	call   *%rax
+    return res;
+  801ace:	eb a3                	jmp    801a73 <fd_close+0x4d>
+
+0000000000801ad0 <close>:
+
+int
+close(int fdnum) {
+  801ad0:	55                   	push   %rbp
+  801ad1:	48 89 e5             	mov    %rsp,%rbp
+  801ad4:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801ad8:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801adc:	48 b8 6b 19 80 00 00 	movabs $0x80196b,%rax
+  801ae3:	00 00 00 
+  801ae6:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801ae8:	85 c0                	test   %eax,%eax
+  801aea:	78 15                	js     801b01 <close+0x31>
+
+    return fd_close(fd, 1);
+  801aec:	be 01 00 00 00       	mov    $0x1,%esi
+  801af1:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801af5:	48 b8 26 1a 80 00 00 	movabs $0x801a26,%rax
+  801afc:	00 00 00 
+  801aff:	ff d0                	call   *%rax
+}
+  801b01:	c9                   	leave
+  801b02:	c3                   	ret
+
+0000000000801b03 <close_all>:
+
+void
+close_all(void) {
+  801b03:	55                   	push   %rbp
+  801b04:	48 89 e5             	mov    %rsp,%rbp
+  801b07:	41 54                	push   %r12
+  801b09:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801b0a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b0f:	49 bc d0 1a 80 00 00 	movabs $0x801ad0,%r12
+  801b16:	00 00 00 
+  801b19:	89 df                	mov    %ebx,%edi
+  801b1b:	41 ff d4             	call   *%r12
+  801b1e:	83 c3 01             	add    $0x1,%ebx
+  801b21:	83 fb 20             	cmp    $0x20,%ebx
+  801b24:	75 f3                	jne    801b19 <close_all+0x16>
+}
+  801b26:	5b                   	pop    %rbx
+  801b27:	41 5c                	pop    %r12
+  801b29:	5d                   	pop    %rbp
+  801b2a:	c3                   	ret
+
+0000000000801b2b <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801b2b:	55                   	push   %rbp
+  801b2c:	48 89 e5             	mov    %rsp,%rbp
+  801b2f:	41 57                	push   %r15
+  801b31:	41 56                	push   %r14
+  801b33:	41 55                	push   %r13
+  801b35:	41 54                	push   %r12
+  801b37:	53                   	push   %rbx
+  801b38:	48 83 ec 18          	sub    $0x18,%rsp
+  801b3c:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801b3f:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801b43:	48 b8 6b 19 80 00 00 	movabs $0x80196b,%rax
+  801b4a:	00 00 00 
+  801b4d:	ff d0                	call   *%rax
+  801b4f:	89 c3                	mov    %eax,%ebx
+  801b51:	85 c0                	test   %eax,%eax
+  801b53:	0f 88 b8 00 00 00    	js     801c11 <dup+0xe6>
+    close(newfdnum);
+  801b59:	44 89 e7             	mov    %r12d,%edi
+  801b5c:	48 b8 d0 1a 80 00 00 	movabs $0x801ad0,%rax
+  801b63:	00 00 00 
+  801b66:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801b68:	4d 63 ec             	movslq %r12d,%r13
+  801b6b:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801b72:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801b76:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801b7a:	4c 89 ff             	mov    %r15,%rdi
+  801b7d:	49 be ef 18 80 00 00 	movabs $0x8018ef,%r14
+  801b84:	00 00 00 
+  801b87:	41 ff d6             	call   *%r14
+  801b8a:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801b8d:	4c 89 ef             	mov    %r13,%rdi
+  801b90:	41 ff d6             	call   *%r14
+  801b93:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801b96:	48 89 df             	mov    %rbx,%rdi
+  801b99:	48 b8 9a 40 80 00 00 	movabs $0x80409a,%rax
+  801ba0:	00 00 00 
+  801ba3:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801ba5:	a8 04                	test   $0x4,%al
+  801ba7:	74 2b                	je     801bd4 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801ba9:	41 89 c1             	mov    %eax,%r9d
+  801bac:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801bb2:	4c 89 f1             	mov    %r14,%rcx
+  801bb5:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bba:	48 89 de             	mov    %rbx,%rsi
+  801bbd:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bc2:	48 b8 e0 13 80 00 00 	movabs $0x8013e0,%rax
+  801bc9:	00 00 00 
+  801bcc:	ff d0                	call   *%rax
+  801bce:	89 c3                	mov    %eax,%ebx
+  801bd0:	85 c0                	test   %eax,%eax
+  801bd2:	78 4e                	js     801c22 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801bd4:	4c 89 ff             	mov    %r15,%rdi
+  801bd7:	48 b8 9a 40 80 00 00 	movabs $0x80409a,%rax
+  801bde:	00 00 00 
+  801be1:	ff d0                	call   *%rax
+  801be3:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801be6:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801bec:	4c 89 e9             	mov    %r13,%rcx
+  801bef:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bf4:	4c 89 fe             	mov    %r15,%rsi
+  801bf7:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bfc:	48 b8 e0 13 80 00 00 	movabs $0x8013e0,%rax
+  801c03:	00 00 00 
+  801c06:	ff d0                	call   *%rax
+  801c08:	89 c3                	mov    %eax,%ebx
+  801c0a:	85 c0                	test   %eax,%eax
+  801c0c:	78 14                	js     801c22 <dup+0xf7>
+
+    return newfdnum;
+  801c0e:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801c11:	89 d8                	mov    %ebx,%eax
+  801c13:	48 83 c4 18          	add    $0x18,%rsp
+  801c17:	5b                   	pop    %rbx
+  801c18:	41 5c                	pop    %r12
+  801c1a:	41 5d                	pop    %r13
+  801c1c:	41 5e                	pop    %r14
+  801c1e:	41 5f                	pop    %r15
+  801c20:	5d                   	pop    %rbp
+  801c21:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801c22:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c27:	4c 89 ee             	mov    %r13,%rsi
+  801c2a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c2f:	49 bc 30 14 80 00 00 	movabs $0x801430,%r12
+  801c36:	00 00 00 
+  801c39:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801c3c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c41:	4c 89 f6             	mov    %r14,%rsi
+  801c44:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c49:	41 ff d4             	call   *%r12
+    return res;
+  801c4c:	eb c3                	jmp    801c11 <dup+0xe6>
+
+0000000000801c4e <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801c4e:	55                   	push   %rbp
+  801c4f:	48 89 e5             	mov    %rsp,%rbp
+  801c52:	41 56                	push   %r14
+  801c54:	41 55                	push   %r13
+  801c56:	41 54                	push   %r12
+  801c58:	53                   	push   %rbx
+  801c59:	48 83 ec 10          	sub    $0x10,%rsp
+  801c5d:	89 fb                	mov    %edi,%ebx
+  801c5f:	49 89 f4             	mov    %rsi,%r12
+  801c62:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c65:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c69:	48 b8 6b 19 80 00 00 	movabs $0x80196b,%rax
+  801c70:	00 00 00 
+  801c73:	ff d0                	call   *%rax
+  801c75:	85 c0                	test   %eax,%eax
+  801c77:	78 4c                	js     801cc5 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c79:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801c7d:	41 8b 3e             	mov    (%r14),%edi
+  801c80:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c84:	48 b8 b6 19 80 00 00 	movabs $0x8019b6,%rax
+  801c8b:	00 00 00 
+  801c8e:	ff d0                	call   *%rax
+  801c90:	85 c0                	test   %eax,%eax
+  801c92:	78 35                	js     801cc9 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801c94:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801c98:	83 e0 03             	and    $0x3,%eax
+  801c9b:	83 f8 01             	cmp    $0x1,%eax
+  801c9e:	74 2d                	je     801ccd <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801ca0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ca4:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801ca8:	48 85 c0             	test   %rax,%rax
+  801cab:	74 56                	je     801d03 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801cad:	4c 89 ea             	mov    %r13,%rdx
+  801cb0:	4c 89 e6             	mov    %r12,%rsi
+  801cb3:	4c 89 f7             	mov    %r14,%rdi
+  801cb6:	ff d0                	call   *%rax
+}
+  801cb8:	48 83 c4 10          	add    $0x10,%rsp
+  801cbc:	5b                   	pop    %rbx
+  801cbd:	41 5c                	pop    %r12
+  801cbf:	41 5d                	pop    %r13
+  801cc1:	41 5e                	pop    %r14
+  801cc3:	5d                   	pop    %rbp
+  801cc4:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801cc5:	48 98                	cltq
+  801cc7:	eb ef                	jmp    801cb8 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801cc9:	48 98                	cltq
+  801ccb:	eb eb                	jmp    801cb8 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801ccd:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801cd4:	00 00 00 
+  801cd7:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801cdd:	89 da                	mov    %ebx,%edx
+  801cdf:	48 bf 51 51 80 00 00 	movabs $0x805151,%rdi
+  801ce6:	00 00 00 
+  801ce9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cee:	48 b9 06 05 80 00 00 	movabs $0x800506,%rcx
+  801cf5:	00 00 00 
+  801cf8:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801cfa:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801d01:	eb b5                	jmp    801cb8 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801d03:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801d0a:	eb ac                	jmp    801cb8 <read+0x6a>
+
+0000000000801d0c <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801d0c:	55                   	push   %rbp
+  801d0d:	48 89 e5             	mov    %rsp,%rbp
+  801d10:	41 57                	push   %r15
+  801d12:	41 56                	push   %r14
+  801d14:	41 55                	push   %r13
+  801d16:	41 54                	push   %r12
+  801d18:	53                   	push   %rbx
+  801d19:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801d1d:	48 85 d2             	test   %rdx,%rdx
+  801d20:	74 54                	je     801d76 <readn+0x6a>
+  801d22:	41 89 fd             	mov    %edi,%r13d
+  801d25:	49 89 f6             	mov    %rsi,%r14
+  801d28:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801d2b:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801d30:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801d35:	49 bf 4e 1c 80 00 00 	movabs $0x801c4e,%r15
+  801d3c:	00 00 00 
+  801d3f:	4c 89 e2             	mov    %r12,%rdx
+  801d42:	48 29 f2             	sub    %rsi,%rdx
+  801d45:	4c 01 f6             	add    %r14,%rsi
+  801d48:	44 89 ef             	mov    %r13d,%edi
+  801d4b:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801d4e:	85 c0                	test   %eax,%eax
+  801d50:	78 20                	js     801d72 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801d52:	01 c3                	add    %eax,%ebx
+  801d54:	85 c0                	test   %eax,%eax
+  801d56:	74 08                	je     801d60 <readn+0x54>
+  801d58:	48 63 f3             	movslq %ebx,%rsi
+  801d5b:	4c 39 e6             	cmp    %r12,%rsi
+  801d5e:	72 df                	jb     801d3f <readn+0x33>
+    }
+    return res;
+  801d60:	48 63 c3             	movslq %ebx,%rax
+}
+  801d63:	48 83 c4 08          	add    $0x8,%rsp
+  801d67:	5b                   	pop    %rbx
+  801d68:	41 5c                	pop    %r12
+  801d6a:	41 5d                	pop    %r13
+  801d6c:	41 5e                	pop    %r14
+  801d6e:	41 5f                	pop    %r15
+  801d70:	5d                   	pop    %rbp
+  801d71:	c3                   	ret
+        if (inc < 0) return inc;
+  801d72:	48 98                	cltq
+  801d74:	eb ed                	jmp    801d63 <readn+0x57>
+    int inc = 1, res = 0;
+  801d76:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d7b:	eb e3                	jmp    801d60 <readn+0x54>
+
+0000000000801d7d <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801d7d:	55                   	push   %rbp
+  801d7e:	48 89 e5             	mov    %rsp,%rbp
+  801d81:	41 56                	push   %r14
+  801d83:	41 55                	push   %r13
+  801d85:	41 54                	push   %r12
+  801d87:	53                   	push   %rbx
+  801d88:	48 83 ec 10          	sub    $0x10,%rsp
+  801d8c:	89 fb                	mov    %edi,%ebx
+  801d8e:	49 89 f4             	mov    %rsi,%r12
+  801d91:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d94:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d98:	48 b8 6b 19 80 00 00 	movabs $0x80196b,%rax
+  801d9f:	00 00 00 
+  801da2:	ff d0                	call   *%rax
+  801da4:	85 c0                	test   %eax,%eax
+  801da6:	78 47                	js     801def <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801da8:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801dac:	41 8b 3e             	mov    (%r14),%edi
+  801daf:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801db3:	48 b8 b6 19 80 00 00 	movabs $0x8019b6,%rax
+  801dba:	00 00 00 
+  801dbd:	ff d0                	call   *%rax
+  801dbf:	85 c0                	test   %eax,%eax
+  801dc1:	78 30                	js     801df3 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801dc3:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801dc8:	74 2d                	je     801df7 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801dca:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801dce:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801dd2:	48 85 c0             	test   %rax,%rax
+  801dd5:	74 56                	je     801e2d <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801dd7:	4c 89 ea             	mov    %r13,%rdx
+  801dda:	4c 89 e6             	mov    %r12,%rsi
+  801ddd:	4c 89 f7             	mov    %r14,%rdi
+  801de0:	ff d0                	call   *%rax
+}
+  801de2:	48 83 c4 10          	add    $0x10,%rsp
+  801de6:	5b                   	pop    %rbx
+  801de7:	41 5c                	pop    %r12
+  801de9:	41 5d                	pop    %r13
+  801deb:	41 5e                	pop    %r14
+  801ded:	5d                   	pop    %rbp
+  801dee:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801def:	48 98                	cltq
+  801df1:	eb ef                	jmp    801de2 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801df3:	48 98                	cltq
+  801df5:	eb eb                	jmp    801de2 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801df7:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801dfe:	00 00 00 
+  801e01:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801e07:	89 da                	mov    %ebx,%edx
+  801e09:	48 bf 6d 51 80 00 00 	movabs $0x80516d,%rdi
+  801e10:	00 00 00 
+  801e13:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e18:	48 b9 06 05 80 00 00 	movabs $0x800506,%rcx
+  801e1f:	00 00 00 
+  801e22:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e24:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801e2b:	eb b5                	jmp    801de2 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801e2d:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801e34:	eb ac                	jmp    801de2 <write+0x65>
+
+0000000000801e36 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801e36:	55                   	push   %rbp
+  801e37:	48 89 e5             	mov    %rsp,%rbp
+  801e3a:	41 54                	push   %r12
+  801e3c:	53                   	push   %rbx
+  801e3d:	48 83 ec 10          	sub    $0x10,%rsp
+  801e41:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e43:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801e47:	48 b8 6b 19 80 00 00 	movabs $0x80196b,%rax
+  801e4e:	00 00 00 
+  801e51:	ff d0                	call   *%rax
+  801e53:	85 c0                	test   %eax,%eax
+  801e55:	78 3e                	js     801e95 <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e57:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801e5b:	41 8b 3c 24          	mov    (%r12),%edi
+  801e5f:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801e63:	48 b8 b6 19 80 00 00 	movabs $0x8019b6,%rax
+  801e6a:	00 00 00 
+  801e6d:	ff d0                	call   *%rax
+  801e6f:	85 c0                	test   %eax,%eax
+  801e71:	78 22                	js     801e95 <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  801e73:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801e77:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801e7b:	48 85 c0             	test   %rax,%rax
+  801e7e:	74 0b                	je     801e8b <seek+0x55>
+  801e80:	89 de                	mov    %ebx,%esi
+  801e82:	4c 89 e7             	mov    %r12,%rdi
+  801e85:	ff d0                	call   *%rax
+  801e87:	85 c0                	test   %eax,%eax
+  801e89:	78 0a                	js     801e95 <seek+0x5f>
+
+    fd->fd_offset = offset;
+  801e8b:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  801e90:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e95:	48 83 c4 10          	add    $0x10,%rsp
+  801e99:	5b                   	pop    %rbx
+  801e9a:	41 5c                	pop    %r12
+  801e9c:	5d                   	pop    %rbp
+  801e9d:	c3                   	ret
+
+0000000000801e9e <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801e9e:	55                   	push   %rbp
+  801e9f:	48 89 e5             	mov    %rsp,%rbp
+  801ea2:	41 55                	push   %r13
+  801ea4:	41 54                	push   %r12
+  801ea6:	53                   	push   %rbx
+  801ea7:	48 83 ec 18          	sub    $0x18,%rsp
+  801eab:	89 fb                	mov    %edi,%ebx
+  801ead:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801eb0:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801eb4:	48 b8 6b 19 80 00 00 	movabs $0x80196b,%rax
+  801ebb:	00 00 00 
+  801ebe:	ff d0                	call   *%rax
+  801ec0:	85 c0                	test   %eax,%eax
+  801ec2:	78 38                	js     801efc <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ec4:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801ec8:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801ecc:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ed0:	48 b8 b6 19 80 00 00 	movabs $0x8019b6,%rax
+  801ed7:	00 00 00 
+  801eda:	ff d0                	call   *%rax
+  801edc:	85 c0                	test   %eax,%eax
+  801ede:	78 1c                	js     801efc <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ee0:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801ee5:	74 20                	je     801f07 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801ee7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801eeb:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801eef:	48 85 c0             	test   %rax,%rax
+  801ef2:	74 47                	je     801f3b <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801ef4:	44 89 e6             	mov    %r12d,%esi
+  801ef7:	4c 89 ef             	mov    %r13,%rdi
+  801efa:	ff d0                	call   *%rax
+}
+  801efc:	48 83 c4 18          	add    $0x18,%rsp
+  801f00:	5b                   	pop    %rbx
+  801f01:	41 5c                	pop    %r12
+  801f03:	41 5d                	pop    %r13
+  801f05:	5d                   	pop    %rbp
+  801f06:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801f07:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801f0e:	00 00 00 
+  801f11:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801f17:	89 da                	mov    %ebx,%edx
+  801f19:	48 bf 30 51 80 00 00 	movabs $0x805130,%rdi
+  801f20:	00 00 00 
+  801f23:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f28:	48 b9 06 05 80 00 00 	movabs $0x800506,%rcx
+  801f2f:	00 00 00 
+  801f32:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801f34:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f39:	eb c1                	jmp    801efc <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801f3b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f40:	eb ba                	jmp    801efc <ftruncate+0x5e>
+
+0000000000801f42 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801f42:	55                   	push   %rbp
+  801f43:	48 89 e5             	mov    %rsp,%rbp
+  801f46:	41 54                	push   %r12
+  801f48:	53                   	push   %rbx
+  801f49:	48 83 ec 10          	sub    $0x10,%rsp
+  801f4d:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f50:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f54:	48 b8 6b 19 80 00 00 	movabs $0x80196b,%rax
+  801f5b:	00 00 00 
+  801f5e:	ff d0                	call   *%rax
+  801f60:	85 c0                	test   %eax,%eax
+  801f62:	78 4e                	js     801fb2 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f64:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801f68:	41 8b 3c 24          	mov    (%r12),%edi
+  801f6c:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801f70:	48 b8 b6 19 80 00 00 	movabs $0x8019b6,%rax
+  801f77:	00 00 00 
+  801f7a:	ff d0                	call   *%rax
+  801f7c:	85 c0                	test   %eax,%eax
+  801f7e:	78 32                	js     801fb2 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801f80:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801f84:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801f89:	74 30                	je     801fbb <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801f8b:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801f8e:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801f95:	00 00 00 
+    stat->st_isdir = 0;
+  801f98:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801f9f:	00 00 00 
+    stat->st_dev = dev;
+  801fa2:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801fa9:	48 89 de             	mov    %rbx,%rsi
+  801fac:	4c 89 e7             	mov    %r12,%rdi
+  801faf:	ff 50 28             	call   *0x28(%rax)
+}
+  801fb2:	48 83 c4 10          	add    $0x10,%rsp
+  801fb6:	5b                   	pop    %rbx
+  801fb7:	41 5c                	pop    %r12
+  801fb9:	5d                   	pop    %rbp
+  801fba:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801fbb:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801fc0:	eb f0                	jmp    801fb2 <fstat+0x70>
+
+0000000000801fc2 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801fc2:	55                   	push   %rbp
+  801fc3:	48 89 e5             	mov    %rsp,%rbp
+  801fc6:	41 54                	push   %r12
+  801fc8:	53                   	push   %rbx
+  801fc9:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801fcc:	be 00 00 00 00       	mov    $0x0,%esi
+  801fd1:	48 b8 30 31 80 00 00 	movabs $0x803130,%rax
+  801fd8:	00 00 00 
+  801fdb:	ff d0                	call   *%rax
+  801fdd:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801fdf:	85 c0                	test   %eax,%eax
+  801fe1:	78 25                	js     802008 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801fe3:	4c 89 e6             	mov    %r12,%rsi
+  801fe6:	89 c7                	mov    %eax,%edi
+  801fe8:	48 b8 42 1f 80 00 00 	movabs $0x801f42,%rax
+  801fef:	00 00 00 
+  801ff2:	ff d0                	call   *%rax
+  801ff4:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801ff7:	89 df                	mov    %ebx,%edi
+  801ff9:	48 b8 d0 1a 80 00 00 	movabs $0x801ad0,%rax
+  802000:	00 00 00 
+  802003:	ff d0                	call   *%rax
+
+    return res;
+  802005:	44 89 e3             	mov    %r12d,%ebx
+}
+  802008:	89 d8                	mov    %ebx,%eax
+  80200a:	5b                   	pop    %rbx
+  80200b:	41 5c                	pop    %r12
+  80200d:	5d                   	pop    %rbp
+  80200e:	c3                   	ret
+
+000000000080200f <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  80200f:	48 b8 08 00 82 00 00 	movabs $0x820008,%rax
+  802016:	00 00 00 
+  802019:	83 38 00             	cmpl   $0x0,(%rax)
+  80201c:	74 0a                	je     802028 <fsenv+0x19>
+    return envid;
+}
+  80201e:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  802025:	00 00 
+  802027:	c3                   	ret
+fsenv(void) {
+  802028:	55                   	push   %rbp
+  802029:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  80202c:	bf 03 00 00 00       	mov    $0x3,%edi
+  802031:	48 b8 fd 49 80 00 00 	movabs $0x8049fd,%rax
+  802038:	00 00 00 
+  80203b:	ff d0                	call   *%rax
+  80203d:	a3 08 00 82 00 00 00 	movabs %eax,0x820008
+  802044:	00 00 
+}
+  802046:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  80204d:	00 00 
+  80204f:	5d                   	pop    %rbp
+  802050:	c3                   	ret
+
+0000000000802051 <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  802051:	55                   	push   %rbp
+  802052:	48 89 e5             	mov    %rsp,%rbp
+  802055:	41 54                	push   %r12
+  802057:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  802058:	ba 00 50 00 00       	mov    $0x5000,%edx
+  80205d:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  802062:	48 89 de             	mov    %rbx,%rsi
+  802065:	bf 00 00 00 00       	mov    $0x0,%edi
+  80206a:	48 b8 30 14 80 00 00 	movabs $0x801430,%rax
+  802071:	00 00 00 
+  802074:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  802076:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  80207d:	00 00 00 
+  802080:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  802086:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80208b:	ba 00 50 00 00       	mov    $0x5000,%edx
+  802090:	48 89 de             	mov    %rbx,%rsi
+  802093:	bf 00 00 00 00       	mov    $0x0,%edi
+  802098:	48 b8 8a 13 80 00 00 	movabs $0x80138a,%rax
+  80209f:	00 00 00 
+  8020a2:	ff d0                	call   *%rax
+  8020a4:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  8020a6:	85 c0                	test   %eax,%eax
+  8020a8:	0f 88 a2 00 00 00    	js     802150 <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  8020ae:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8020b5:	00 00 00 
+  8020b8:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8020be:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  8020c3:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  8020c5:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  8020ca:	49 bc 62 42 80 00 00 	movabs $0x804262,%r12
+  8020d1:	00 00 00 
+  8020d4:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  8020d7:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  8020dc:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  8020df:	48 b8 0f 20 80 00 00 	movabs $0x80200f,%rax
+  8020e6:	00 00 00 
+  8020e9:	ff d0                	call   *%rax
+  8020eb:	89 c7                	mov    %eax,%edi
+  8020ed:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  8020f3:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  8020f8:	48 89 da             	mov    %rbx,%rdx
+  8020fb:	be 09 00 00 00       	mov    $0x9,%esi
+  802100:	48 b8 a7 49 80 00 00 	movabs $0x8049a7,%rax
+  802107:	00 00 00 
+  80210a:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  80210c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802111:	ba 00 00 00 00       	mov    $0x0,%edx
+  802116:	be 00 00 00 00       	mov    $0x0,%esi
+  80211b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802120:	48 b8 83 49 80 00 00 	movabs $0x804983,%rax
+  802127:	00 00 00 
+  80212a:	ff d0                	call   *%rax
+  80212c:	89 c3                	mov    %eax,%ebx
+  80212e:	85 c0                	test   %eax,%eax
+  802130:	78 25                	js     802157 <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  802132:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  802139:	00 00 00 
+  80213c:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802142:	a3 00 26 82 00 00 00 	movabs %eax,0x822600
+  802149:	00 00 
+    return 0;
+  80214b:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  802150:	89 d8                	mov    %ebx,%eax
+  802152:	5b                   	pop    %rbx
+  802153:	41 5c                	pop    %r12
+  802155:	5d                   	pop    %rbp
+  802156:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  802157:	ba 00 50 00 00       	mov    $0x5000,%edx
+  80215c:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  802161:	bf 00 00 00 00       	mov    $0x0,%edi
+  802166:	48 b8 30 14 80 00 00 	movabs $0x801430,%rax
+  80216d:	00 00 00 
+  802170:	ff d0                	call   *%rax
+        return res;
+  802172:	eb dc                	jmp    802150 <fschan_setup+0xff>
+
+0000000000802174 <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  802174:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  80217b:	00 00 00 
+  80217e:	80 38 00             	cmpb   $0x0,(%rax)
+  802181:	74 55                	je     8021d8 <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802183:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80218a:	00 00 00 
+  80218d:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  802193:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802198:	48 ba 00 26 82 00 00 	movabs $0x822600,%rdx
+  80219f:	00 00 00 
+  8021a2:	3b 0a                	cmp    (%rdx),%ecx
+  8021a4:	75 01                	jne    8021a7 <fschan+0x33>
+}
+  8021a6:	c3                   	ret
+fschan(void) {
+  8021a7:	55                   	push   %rbp
+  8021a8:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  8021ab:	48 b8 51 20 80 00 00 	movabs $0x802051,%rax
+  8021b2:	00 00 00 
+  8021b5:	ff d0                	call   *%rax
+  8021b7:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  8021b9:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  8021be:	85 d2                	test   %edx,%edx
+  8021c0:	78 02                	js     8021c4 <fschan+0x50>
+}
+  8021c2:	5d                   	pop    %rbp
+  8021c3:	c3                   	ret
+        fschan_enabled = 0;
+  8021c4:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  8021cb:	00 00 00 
+  8021ce:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  8021d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021d6:	eb ea                	jmp    8021c2 <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  8021d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021dd:	c3                   	ret
+
+00000000008021de <fbuf>:
+fbuf(struct Fd *fd) {
+  8021de:	55                   	push   %rbp
+  8021df:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  8021e2:	48 b8 dd 18 80 00 00 	movabs $0x8018dd,%rax
+  8021e9:	00 00 00 
+  8021ec:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  8021ee:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021f3:	48 83 f8 1f          	cmp    $0x1f,%rax
+  8021f7:	77 12                	ja     80220b <fbuf+0x2d>
+  8021f9:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  8021fd:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802204:	00 00 00 
+  802207:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  80220b:	48 89 d0             	mov    %rdx,%rax
+  80220e:	5d                   	pop    %rbp
+  80220f:	c3                   	ret
+
+0000000000802210 <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  802210:	55                   	push   %rbp
+  802211:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  802214:	48 83 c7 40          	add    $0x40,%rdi
+  802218:	48 b8 9c 42 80 00 00 	movabs $0x80429c,%rax
+  80221f:	00 00 00 
+  802222:	ff d0                	call   *%rax
+  802224:	84 c0                	test   %al,%al
+  802226:	75 02                	jne    80222a <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  802228:	5d                   	pop    %rbp
+  802229:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  80222a:	48 b8 0f 20 80 00 00 	movabs $0x80200f,%rax
+  802231:	00 00 00 
+  802234:	ff d0                	call   *%rax
+  802236:	89 c7                	mov    %eax,%edi
+  802238:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80223e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802243:	ba 00 00 00 00       	mov    $0x0,%edx
+  802248:	be 0a 00 00 00       	mov    $0xa,%esi
+  80224d:	48 b8 a7 49 80 00 00 	movabs $0x8049a7,%rax
+  802254:	00 00 00 
+  802257:	ff d0                	call   *%rax
+}
+  802259:	eb cd                	jmp    802228 <fschan_publish+0x18>
+
+000000000080225b <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  80225b:	55                   	push   %rbp
+  80225c:	48 89 e5             	mov    %rsp,%rbp
+  80225f:	41 57                	push   %r15
+  802261:	41 56                	push   %r14
+  802263:	41 55                	push   %r13
+  802265:	41 54                	push   %r12
+  802267:	53                   	push   %rbx
+  802268:	48 83 ec 48          	sub    $0x48,%rsp
+  80226c:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802270:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  802274:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  802277:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  80227b:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  80227e:	48 ba 04 00 82 00 00 	movabs $0x820004,%rdx
+  802285:	00 00 00 
+  802288:	8b 02                	mov    (%rdx),%eax
+  80228a:	83 c0 01             	add    $0x1,%eax
+  80228d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802292:	0f 44 c1             	cmove  %ecx,%eax
+  802295:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  802297:	4d 85 c0             	test   %r8,%r8
+  80229a:	74 2c                	je     8022c8 <fschan_rw+0x6d>
+  80229c:	45 89 ce             	mov    %r9d,%r14d
+  80229f:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  8022a6:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  8022aa:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8022b0:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  8022b7:	00 
+  8022b8:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8022be:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022c3:	e9 41 01 00 00       	jmp    802409 <fschan_rw+0x1ae>
+  8022c8:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  8022cc:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8022d0:	e9 9c 01 00 00       	jmp    802471 <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  8022d5:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8022d9:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  8022dc:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  8022df:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  8022e2:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  8022e6:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8022ea:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  8022ee:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  8022f2:	48 89 da             	mov    %rbx,%rdx
+  8022f5:	48 b8 8c 10 80 00 00 	movabs $0x80108c,%rax
+  8022fc:	00 00 00 
+  8022ff:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  802301:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802305:	48 b8 10 22 80 00 00 	movabs $0x802210,%rax
+  80230c:	00 00 00 
+  80230f:	ff d0                	call   *%rax
+            queued += blk;
+  802311:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  802314:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  802318:	4d 39 fc             	cmp    %r15,%r12
+  80231b:	73 6b                	jae    802388 <fschan_rw+0x12d>
+  80231d:	41 83 fd 0f          	cmp    $0xf,%r13d
+  802321:	77 65                	ja     802388 <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  802323:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802327:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  80232b:	48 b8 77 42 80 00 00 	movabs $0x804277,%rax
+  802332:	00 00 00 
+  802335:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  802337:	4c 89 fb             	mov    %r15,%rbx
+  80233a:	4c 29 e3             	sub    %r12,%rbx
+  80233d:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  802342:	48 39 d3             	cmp    %rdx,%rbx
+  802345:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  802349:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  80234d:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802351:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  802355:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  802358:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  80235a:	48 b9 04 00 82 00 00 	movabs $0x820004,%rcx
+  802361:	00 00 00 
+  802364:	8b 09                	mov    (%rcx),%ecx
+  802366:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  802369:	83 fe 03             	cmp    $0x3,%esi
+  80236c:	0f 85 63 ff ff ff    	jne    8022d5 <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  802372:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802376:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  802379:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  80237c:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  80237f:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  802383:	e9 79 ff ff ff       	jmp    802301 <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  802388:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80238c:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  802393:	48 89 df             	mov    %rbx,%rdi
+  802396:	48 b8 3a 43 80 00 00 	movabs $0x80433a,%rax
+  80239d:	00 00 00 
+  8023a0:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  8023a2:	48 89 df             	mov    %rbx,%rdi
+  8023a5:	48 b8 c8 42 80 00 00 	movabs $0x8042c8,%rax
+  8023ac:	00 00 00 
+  8023af:	ff d0                	call   *%rax
+  8023b1:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  8023b5:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  8023b9:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  8023bd:	75 25                	jne    8023e4 <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  8023bf:	8b 40 04             	mov    0x4(%rax),%eax
+  8023c2:	85 c0                	test   %eax,%eax
+  8023c4:	0f 88 86 00 00 00    	js     802450 <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  8023ca:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  8023ce:	74 5b                	je     80242b <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  8023d0:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8023d4:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  8023d8:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  8023dc:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  8023e0:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  8023e4:	48 89 df             	mov    %rbx,%rdi
+  8023e7:	48 b8 ef 42 80 00 00 	movabs $0x8042ef,%rax
+  8023ee:	00 00 00 
+  8023f1:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  8023f3:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  8023f7:	83 f0 01             	xor    $0x1,%eax
+  8023fa:	4d 39 fc             	cmp    %r15,%r12
+  8023fd:	0f 92 c2             	setb   %dl
+  802400:	84 c2                	test   %al,%dl
+  802402:	75 05                	jne    802409 <fschan_rw+0x1ae>
+  802404:	45 85 ed             	test   %r13d,%r13d
+  802407:	74 50                	je     802459 <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  802409:	4d 39 fc             	cmp    %r15,%r12
+  80240c:	0f 92 c1             	setb   %cl
+  80240f:	41 83 fd 0f          	cmp    $0xf,%r13d
+  802413:	0f 96 c2             	setbe  %dl
+  802416:	84 d1                	test   %dl,%cl
+  802418:	0f 84 6a ff ff ff    	je     802388 <fschan_rw+0x12d>
+  80241e:	84 c0                	test   %al,%al
+  802420:	0f 85 fd fe ff ff    	jne    802323 <fschan_rw+0xc8>
+  802426:	e9 5d ff ff ff       	jmp    802388 <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  80242b:	48 63 d0             	movslq %eax,%rdx
+  80242e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802432:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  802436:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80243a:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  80243e:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  802442:	48 b8 8c 10 80 00 00 	movabs $0x80108c,%rax
+  802449:	00 00 00 
+  80244c:	ff d0                	call   *%rax
+  80244e:	eb 80                	jmp    8023d0 <fschan_rw+0x175>
+                err = msg->fm_res;
+  802450:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  802453:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  802457:	eb 8b                	jmp    8023e4 <fschan_rw+0x189>
+    return done || !err ? done : err;
+  802459:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  80245e:	0f 85 68 fe ff ff    	jne    8022cc <fschan_rw+0x71>
+  802464:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  802467:	85 c0                	test   %eax,%eax
+  802469:	0f 84 5d fe ff ff    	je     8022cc <fschan_rw+0x71>
+  80246f:	48 98                	cltq
+}
+  802471:	48 83 c4 48          	add    $0x48,%rsp
+  802475:	5b                   	pop    %rbx
+  802476:	41 5c                	pop    %r12
+  802478:	41 5d                	pop    %r13
+  80247a:	41 5e                	pop    %r14
+  80247c:	41 5f                	pop    %r15
+  80247e:	5d                   	pop    %rbp
+  80247f:	c3                   	ret
+
+0000000000802480 <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  802480:	55                   	push   %rbp
+  802481:	48 89 e5             	mov    %rsp,%rbp
+  802484:	41 56                	push   %r14
+  802486:	41 55                	push   %r13
+  802488:	41 54                	push   %r12
+  80248a:	53                   	push   %rbx
+  80248b:	48 83 ec 10          	sub    $0x10,%rsp
+  80248f:	49 89 fe             	mov    %rdi,%r14
+  802492:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  802495:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  802499:	48 29 f3             	sub    %rsi,%rbx
+  80249c:	48 39 d3             	cmp    %rdx,%rbx
+  80249f:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  8024a3:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8024aa:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  8024ab:	bf 00 10 00 00       	mov    $0x1000,%edi
+  8024b0:	49 bd f9 40 80 00 00 	movabs $0x8040f9,%r13
+  8024b7:	00 00 00 
+  8024ba:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  8024c1:	76 1e                	jbe    8024e1 <mmap_fault+0x61>
+  8024c3:	4c 01 e7             	add    %r12,%rdi
+  8024c6:	41 ff d5             	call   *%r13
+  8024c9:	84 c0                	test   %al,%al
+  8024cb:	75 14                	jne    8024e1 <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  8024cd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8024d1:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  8024d8:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  8024dc:	48 39 df             	cmp    %rbx,%rdi
+  8024df:	72 e2                	jb     8024c3 <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  8024e1:	48 bb 00 10 82 00 00 	movabs $0x821000,%rbx
+  8024e8:	00 00 00 
+  8024eb:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  8024f2:	00 00 00 
+  8024f5:	4c 89 f0             	mov    %r14,%rax
+  8024f8:	48 29 d0             	sub    %rdx,%rax
+  8024fb:	48 c1 f8 03          	sar    $0x3,%rax
+  8024ff:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  802506:	aa aa aa 
+  802509:	48 0f af c2          	imul   %rdx,%rax
+  80250d:	48 c1 e0 0c          	shl    $0xc,%rax
+  802511:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  802516:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  80251a:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  80251c:	44 89 e0             	mov    %r12d,%eax
+  80251f:	41 03 46 10          	add    0x10(%r14),%eax
+  802523:	41 2b 06             	sub    (%r14),%eax
+  802526:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  802529:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80252d:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  802531:	41 8b 46 14          	mov    0x14(%r14),%eax
+  802535:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  802538:	48 b8 0f 20 80 00 00 	movabs $0x80200f,%rax
+  80253f:	00 00 00 
+  802542:	ff d0                	call   *%rax
+  802544:	89 c7                	mov    %eax,%edi
+  802546:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80254c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802551:	48 89 da             	mov    %rbx,%rdx
+  802554:	be 0f 00 00 00       	mov    $0xf,%esi
+  802559:	48 b8 a7 49 80 00 00 	movabs $0x8049a7,%rax
+  802560:	00 00 00 
+  802563:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  802565:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80256a:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80256e:	4c 89 e6             	mov    %r12,%rsi
+  802571:	bf 00 00 00 00       	mov    $0x0,%edi
+  802576:	48 b8 83 49 80 00 00 	movabs $0x804983,%rax
+  80257d:	00 00 00 
+  802580:	ff d0                	call   *%rax
+  802582:	48 98                	cltq
+}
+  802584:	48 83 c4 10          	add    $0x10,%rsp
+  802588:	5b                   	pop    %rbx
+  802589:	41 5c                	pop    %r12
+  80258b:	41 5d                	pop    %r13
+  80258d:	41 5e                	pop    %r14
+  80258f:	5d                   	pop    %rbp
+  802590:	c3                   	ret
+
+0000000000802591 <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  802591:	48 8b 37             	mov    (%rdi),%rsi
+  802594:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  80259b:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  8025a2:	00 00 00 
+  8025a5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025aa:	eb 0f                	jmp    8025bb <mmap_pgfault+0x2a>
+  8025ac:	c3                   	ret
+  8025ad:	48 83 c1 01          	add    $0x1,%rcx
+  8025b1:	48 83 c2 18          	add    $0x18,%rdx
+  8025b5:	48 83 f9 20          	cmp    $0x20,%rcx
+  8025b9:	74 6e                	je     802629 <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  8025bb:	48 8b 02             	mov    (%rdx),%rax
+  8025be:	48 83 e8 01          	sub    $0x1,%rax
+  8025c2:	48 39 f0             	cmp    %rsi,%rax
+  8025c5:	73 e6                	jae    8025ad <mmap_pgfault+0x1c>
+  8025c7:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  8025cb:	73 e0                	jae    8025ad <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  8025cd:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  8025d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025d6:	f6 c2 01             	test   $0x1,%dl
+  8025d9:	75 d1                	jne    8025ac <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  8025db:	f6 c2 02             	test   $0x2,%dl
+  8025de:	74 1a                	je     8025fa <mmap_pgfault+0x69>
+  8025e0:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  8025e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025e9:	48 bf 00 20 82 00 00 	movabs $0x822000,%rdi
+  8025f0:	00 00 00 
+  8025f3:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  8025f8:	74 35                	je     80262f <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  8025fa:	55                   	push   %rbp
+  8025fb:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  8025fe:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  802602:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  802609:	00 00 00 
+  80260c:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  802610:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802615:	48 b8 80 24 80 00 00 	movabs $0x802480,%rax
+  80261c:	00 00 00 
+  80261f:	ff d0                	call   *%rax
+  802621:	48 85 c0             	test   %rax,%rax
+  802624:	0f 9f c0             	setg   %al
+}
+  802627:	5d                   	pop    %rbp
+  802628:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  802629:	b8 00 00 00 00       	mov    $0x0,%eax
+  80262e:	c3                   	ret
+}
+  80262f:	c3                   	ret
+
+0000000000802630 <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  802630:	55                   	push   %rbp
+  802631:	48 89 e5             	mov    %rsp,%rbp
+  802634:	41 54                	push   %r12
+  802636:	53                   	push   %rbx
+  802637:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80263a:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  802641:	00 00 00 
+  802644:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  802649:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80264d:	74 15                	je     802664 <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80264f:	48 83 c3 01          	add    $0x1,%rbx
+  802653:	48 83 c0 18          	add    $0x18,%rax
+  802657:	48 83 fb 20          	cmp    $0x20,%rbx
+  80265b:	75 ec                	jne    802649 <mmap_alloc+0x19>
+    return NULL;
+  80265d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802662:	eb 52                	jmp    8026b6 <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  802664:	4c 89 e7             	mov    %r12,%rdi
+  802667:	48 b8 9a 40 80 00 00 	movabs $0x80409a,%rax
+  80266e:	00 00 00 
+  802671:	ff d0                	call   *%rax
+  802673:	41 89 c1             	mov    %eax,%r9d
+  802676:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  80267d:	48 c1 e1 0c          	shl    $0xc,%rcx
+  802681:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802687:	ba 00 00 00 00       	mov    $0x0,%edx
+  80268c:	4c 89 e6             	mov    %r12,%rsi
+  80268f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802694:	48 b8 e0 13 80 00 00 	movabs $0x8013e0,%rax
+  80269b:	00 00 00 
+  80269e:	ff d0                	call   *%rax
+  8026a0:	85 c0                	test   %eax,%eax
+  8026a2:	78 17                	js     8026bb <mmap_alloc+0x8b>
+        return &mmaps[i];
+  8026a4:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  8026a8:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8026af:	00 00 00 
+  8026b2:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  8026b6:	5b                   	pop    %rbx
+  8026b7:	41 5c                	pop    %r12
+  8026b9:	5d                   	pop    %rbp
+  8026ba:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  8026bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026c0:	eb f4                	jmp    8026b6 <mmap_alloc+0x86>
+
+00000000008026c2 <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  8026c2:	55                   	push   %rbp
+  8026c3:	48 89 e5             	mov    %rsp,%rbp
+  8026c6:	41 56                	push   %r14
+  8026c8:	41 55                	push   %r13
+  8026ca:	41 54                	push   %r12
+  8026cc:	53                   	push   %rbx
+  8026cd:	48 83 ec 10          	sub    $0x10,%rsp
+  8026d1:	41 89 fc             	mov    %edi,%r12d
+  8026d4:	49 89 f5             	mov    %rsi,%r13
+  8026d7:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  8026da:	48 89 f0             	mov    %rsi,%rax
+  8026dd:	48 09 d0             	or     %rdx,%rax
+  8026e0:	75 0d                	jne    8026ef <fsipc+0x2d>
+  8026e2:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  8026e5:	83 f8 04             	cmp    $0x4,%eax
+  8026e8:	76 7d                	jbe    802767 <fsipc+0xa5>
+  8026ea:	83 ff 0d             	cmp    $0xd,%edi
+  8026ed:	74 78                	je     802767 <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  8026ef:	48 b8 0f 20 80 00 00 	movabs $0x80200f,%rax
+  8026f6:	00 00 00 
+  8026f9:	ff d0                	call   *%rax
+  8026fb:	89 c7                	mov    %eax,%edi
+  8026fd:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  802704:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  80270b:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  802712:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802718:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  80271f:	00 00 00 
+  802722:	44 89 e6             	mov    %r12d,%esi
+  802725:	48 b8 a7 49 80 00 00 	movabs $0x8049a7,%rax
+  80272c:	00 00 00 
+  80272f:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  802731:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  802738:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  802739:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80273e:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802742:	4c 89 ee             	mov    %r13,%rsi
+  802745:	bf 00 00 00 00       	mov    $0x0,%edi
+  80274a:	48 b8 83 49 80 00 00 	movabs $0x804983,%rax
+  802751:	00 00 00 
+  802754:	ff d0                	call   *%rax
+  802756:	89 c3                	mov    %eax,%ebx
+}
+  802758:	89 d8                	mov    %ebx,%eax
+  80275a:	48 83 c4 10          	add    $0x10,%rsp
+  80275e:	5b                   	pop    %rbx
+  80275f:	41 5c                	pop    %r12
+  802761:	41 5d                	pop    %r13
+  802763:	41 5e                	pop    %r14
+  802765:	5d                   	pop    %rbp
+  802766:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  802767:	48 b8 74 21 80 00 00 	movabs $0x802174,%rax
+  80276e:	00 00 00 
+  802771:	ff d0                	call   *%rax
+  802773:	49 89 c6             	mov    %rax,%r14
+  802776:	48 85 c0             	test   %rax,%rax
+  802779:	0f 84 70 ff ff ff    	je     8026ef <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  80277f:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  802783:	48 b8 77 42 80 00 00 	movabs $0x804277,%rax
+  80278a:	00 00 00 
+  80278d:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  80278f:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  802792:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  802799:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  80279d:	ba 10 00 00 00       	mov    $0x10,%edx
+  8027a2:	48 be 00 00 83 00 00 	movabs $0x830000,%rsi
+  8027a9:	00 00 00 
+  8027ac:	48 b8 8c 10 80 00 00 	movabs $0x80108c,%rax
+  8027b3:	00 00 00 
+  8027b6:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  8027b8:	4c 89 f7             	mov    %r14,%rdi
+  8027bb:	48 b8 10 22 80 00 00 	movabs $0x802210,%rax
+  8027c2:	00 00 00 
+  8027c5:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  8027c7:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  8027ce:	4c 89 f7             	mov    %r14,%rdi
+  8027d1:	48 b8 3a 43 80 00 00 	movabs $0x80433a,%rax
+  8027d8:	00 00 00 
+  8027db:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  8027dd:	4c 89 f7             	mov    %r14,%rdi
+  8027e0:	48 b8 c8 42 80 00 00 	movabs $0x8042c8,%rax
+  8027e7:	00 00 00 
+  8027ea:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  8027ec:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  8027ef:	41 83 fc 05          	cmp    $0x5,%r12d
+  8027f3:	75 04                	jne    8027f9 <fsipc+0x137>
+  8027f5:	85 db                	test   %ebx,%ebx
+  8027f7:	79 14                	jns    80280d <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  8027f9:	4c 89 f7             	mov    %r14,%rdi
+  8027fc:	48 b8 ef 42 80 00 00 	movabs $0x8042ef,%rax
+  802803:	00 00 00 
+  802806:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  802808:	e9 4b ff ff ff       	jmp    802758 <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  80280d:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  802811:	ba 88 00 00 00       	mov    $0x88,%edx
+  802816:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  80281d:	00 00 00 
+  802820:	48 b8 8c 10 80 00 00 	movabs $0x80108c,%rax
+  802827:	00 00 00 
+  80282a:	ff d0                	call   *%rax
+  80282c:	eb cb                	jmp    8027f9 <fsipc+0x137>
+
+000000000080282e <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  80282e:	55                   	push   %rbp
+  80282f:	48 89 e5             	mov    %rsp,%rbp
+  802832:	41 57                	push   %r15
+  802834:	41 56                	push   %r14
+  802836:	41 55                	push   %r13
+  802838:	41 54                	push   %r12
+  80283a:	53                   	push   %rbx
+  80283b:	48 83 ec 18          	sub    $0x18,%rsp
+  80283f:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  802843:	49 89 f6             	mov    %rsi,%r14
+  802846:	49 89 d4             	mov    %rdx,%r12
+  802849:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  80284c:	48 b8 74 21 80 00 00 	movabs $0x802174,%rax
+  802853:	00 00 00 
+  802856:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  802858:	48 85 c0             	test   %rax,%rax
+  80285b:	0f 85 96 00 00 00    	jne    8028f7 <devfile_write_direct+0xc9>
+    size_t write = 0;
+  802861:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802868:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802869:	49 bf 00 00 83 00 00 	movabs $0x830000,%r15
+  802870:	00 00 00 
+    while (n) {
+  802873:	4d 85 e4             	test   %r12,%r12
+  802876:	74 79                	je     8028f1 <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802878:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  80287d:	49 39 dc             	cmp    %rbx,%r12
+  802880:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  802884:	48 89 da             	mov    %rbx,%rdx
+  802887:	4c 89 f6             	mov    %r14,%rsi
+  80288a:	48 bf 00 10 83 00 00 	movabs $0x831000,%rdi
+  802891:	00 00 00 
+  802894:	48 b8 8c 10 80 00 00 	movabs $0x80108c,%rax
+  80289b:	00 00 00 
+  80289e:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8028a0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8028a4:	8b 40 0c             	mov    0xc(%rax),%eax
+  8028a7:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  8028aa:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8028ad:	44 01 e8             	add    %r13d,%eax
+  8028b0:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  8028b4:	41 0f 44 c5          	cmove  %r13d,%eax
+  8028b8:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  8028bc:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  8028c0:	48 89 da             	mov    %rbx,%rdx
+  8028c3:	be 00 00 00 00       	mov    $0x0,%esi
+  8028c8:	bf 04 00 00 00       	mov    $0x4,%edi
+  8028cd:	48 b8 c2 26 80 00 00 	movabs $0x8026c2,%rax
+  8028d4:	00 00 00 
+  8028d7:	ff d0                	call   *%rax
+        if (res < 0)
+  8028d9:	85 c0                	test   %eax,%eax
+  8028db:	78 4a                	js     802927 <devfile_write_direct+0xf9>
+        buf += res;
+  8028dd:	48 98                	cltq
+  8028df:	49 01 c6             	add    %rax,%r14
+        write += res;
+  8028e2:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  8028e6:	49 29 c4             	sub    %rax,%r12
+  8028e9:	75 8d                	jne    802878 <devfile_write_direct+0x4a>
+    return write;
+  8028eb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8028ef:	eb 27                	jmp    802918 <devfile_write_direct+0xea>
+    size_t write = 0;
+  8028f1:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  8028f5:	eb f4                	jmp    8028eb <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  8028f7:	45 89 e9             	mov    %r13d,%r9d
+  8028fa:	4d 89 e0             	mov    %r12,%r8
+  8028fd:	4c 89 f1             	mov    %r14,%rcx
+  802900:	ba 04 00 00 00       	mov    $0x4,%edx
+  802905:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802909:	48 89 c7             	mov    %rax,%rdi
+  80290c:	48 b8 5b 22 80 00 00 	movabs $0x80225b,%rax
+  802913:	00 00 00 
+  802916:	ff d0                	call   *%rax
+}
+  802918:	48 83 c4 18          	add    $0x18,%rsp
+  80291c:	5b                   	pop    %rbx
+  80291d:	41 5c                	pop    %r12
+  80291f:	41 5d                	pop    %r13
+  802921:	41 5e                	pop    %r14
+  802923:	41 5f                	pop    %r15
+  802925:	5d                   	pop    %rbp
+  802926:	c3                   	ret
+            return res;
+  802927:	48 98                	cltq
+  802929:	eb ed                	jmp    802918 <devfile_write_direct+0xea>
+
+000000000080292b <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  80292b:	55                   	push   %rbp
+  80292c:	48 89 e5             	mov    %rsp,%rbp
+  80292f:	41 54                	push   %r12
+  802931:	53                   	push   %rbx
+  802932:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  802935:	48 b8 de 21 80 00 00 	movabs $0x8021de,%rax
+  80293c:	00 00 00 
+  80293f:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  802941:	48 85 c0             	test   %rax,%rax
+  802944:	74 71                	je     8029b7 <fbuf_flush+0x8c>
+  802946:	48 89 c3             	mov    %rax,%rbx
+  802949:	b8 00 00 00 00       	mov    $0x0,%eax
+  80294e:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  802952:	75 05                	jne    802959 <fbuf_flush+0x2e>
+}
+  802954:	5b                   	pop    %rbx
+  802955:	41 5c                	pop    %r12
+  802957:	5d                   	pop    %rbp
+  802958:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  802959:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  80295c:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  802960:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802967:	00 00 00 
+  80296a:	48 89 de             	mov    %rbx,%rsi
+  80296d:	48 29 c6             	sub    %rax,%rsi
+  802970:	48 c1 fe 03          	sar    $0x3,%rsi
+  802974:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  80297b:	aa aa aa 
+  80297e:	48 0f af f0          	imul   %rax,%rsi
+  802982:	48 c1 e6 0e          	shl    $0xe,%rsi
+  802986:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  80298b:	48 01 c6             	add    %rax,%rsi
+  80298e:	4c 89 e7             	mov    %r12,%rdi
+  802991:	48 b8 2e 28 80 00 00 	movabs $0x80282e,%rax
+  802998:	00 00 00 
+  80299b:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  80299d:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  8029a1:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  8029a8:	00 
+    return res < 0 ? res : 0;
+  8029a9:	48 85 c0             	test   %rax,%rax
+  8029ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029b1:	48 0f 4f c2          	cmovg  %rdx,%rax
+  8029b5:	eb 9d                	jmp    802954 <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  8029b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029bc:	eb 96                	jmp    802954 <fbuf_flush+0x29>
+
+00000000008029be <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  8029be:	55                   	push   %rbp
+  8029bf:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  8029c2:	48 b8 2b 29 80 00 00 	movabs $0x80292b,%rax
+  8029c9:	00 00 00 
+  8029cc:	ff d0                	call   *%rax
+}
+  8029ce:	5d                   	pop    %rbp
+  8029cf:	c3                   	ret
+
+00000000008029d0 <devfile_write>:
+    if (!fd || !buf)
+  8029d0:	48 85 ff             	test   %rdi,%rdi
+  8029d3:	0f 84 d3 01 00 00    	je     802bac <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8029d9:	55                   	push   %rbp
+  8029da:	48 89 e5             	mov    %rsp,%rbp
+  8029dd:	41 57                	push   %r15
+  8029df:	41 56                	push   %r14
+  8029e1:	41 55                	push   %r13
+  8029e3:	41 54                	push   %r12
+  8029e5:	53                   	push   %rbx
+  8029e6:	48 83 ec 08          	sub    $0x8,%rsp
+  8029ea:	49 89 fc             	mov    %rdi,%r12
+  8029ed:	49 89 f6             	mov    %rsi,%r14
+  8029f0:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  8029f3:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  8029f8:	48 85 f6             	test   %rsi,%rsi
+  8029fb:	0f 84 9c 01 00 00    	je     802b9d <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  802a01:	48 b8 de 21 80 00 00 	movabs $0x8021de,%rax
+  802a08:	00 00 00 
+  802a0b:	ff d0                	call   *%rax
+  802a0d:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  802a10:	48 85 c0             	test   %rax,%rax
+  802a13:	0f 84 a2 00 00 00    	je     802abb <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802a19:	be 00 10 00 00       	mov    $0x1000,%esi
+  802a1e:	4c 89 e7             	mov    %r12,%rdi
+  802a21:	48 b8 4f 13 80 00 00 	movabs $0x80134f,%rax
+  802a28:	00 00 00 
+  802a2b:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  802a2d:	83 f8 02             	cmp    $0x2,%eax
+  802a30:	0f 8f 85 00 00 00    	jg     802abb <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  802a36:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802a3d:	00 00 00 
+  802a40:	4d 89 ef             	mov    %r13,%r15
+  802a43:	49 29 c7             	sub    %rax,%r15
+  802a46:	49 c1 ff 03          	sar    $0x3,%r15
+  802a4a:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802a51:	aa aa aa 
+  802a54:	4c 0f af f8          	imul   %rax,%r15
+  802a58:	49 c1 e7 0e          	shl    $0xe,%r15
+  802a5c:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802a61:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  802a64:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802a69:	0f 84 d7 00 00 00    	je     802b46 <devfile_write+0x176>
+  802a6f:	49 8b 45 10          	mov    0x10(%r13),%rax
+  802a73:	89 c2                	mov    %eax,%edx
+  802a75:	41 03 55 0c          	add    0xc(%r13),%edx
+  802a79:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  802a7e:	75 0f                	jne    802a8f <devfile_write+0xbf>
+  802a80:	48 01 d8             	add    %rbx,%rax
+  802a83:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  802a89:	0f 86 92 00 00 00    	jbe    802b21 <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802a8f:	4c 89 e7             	mov    %r12,%rdi
+  802a92:	48 b8 2b 29 80 00 00 	movabs $0x80292b,%rax
+  802a99:	00 00 00 
+  802a9c:	ff d0                	call   *%rax
+  802a9e:	85 c0                	test   %eax,%eax
+  802aa0:	78 52                	js     802af4 <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802aa2:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802aa9:	77 7f                	ja     802b2a <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  802aab:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802ab0:	0f 85 c2 00 00 00    	jne    802b78 <devfile_write+0x1a8>
+  802ab6:	e9 94 00 00 00       	jmp    802b4f <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  802abb:	4c 89 e7             	mov    %r12,%rdi
+  802abe:	48 b8 2b 29 80 00 00 	movabs $0x80292b,%rax
+  802ac5:	00 00 00 
+  802ac8:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802aca:	85 c0                	test   %eax,%eax
+  802acc:	79 07                	jns    802ad5 <devfile_write+0x105>
+  802ace:	48 98                	cltq
+  802ad0:	e9 c8 00 00 00       	jmp    802b9d <devfile_write+0x1cd>
+  802ad5:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802ada:	48 89 da             	mov    %rbx,%rdx
+  802add:	4c 89 f6             	mov    %r14,%rsi
+  802ae0:	4c 89 e7             	mov    %r12,%rdi
+  802ae3:	48 b8 2e 28 80 00 00 	movabs $0x80282e,%rax
+  802aea:	00 00 00 
+  802aed:	ff d0                	call   *%rax
+  802aef:	e9 a9 00 00 00       	jmp    802b9d <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802af4:	48 98                	cltq
+  802af6:	e9 a2 00 00 00       	jmp    802b9d <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802afb:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802b00:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802b05:	4c 89 fe             	mov    %r15,%rsi
+  802b08:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b0d:	48 b8 8a 13 80 00 00 	movabs $0x80138a,%rax
+  802b14:	00 00 00 
+  802b17:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  802b19:	85 c0                	test   %eax,%eax
+  802b1b:	79 45                	jns    802b62 <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802b1d:	48 98                	cltq
+  802b1f:	eb 7c                	jmp    802b9d <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802b21:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802b28:	76 4e                	jbe    802b78 <devfile_write+0x1a8>
+  802b2a:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802b2f:	48 89 da             	mov    %rbx,%rdx
+  802b32:	4c 89 f6             	mov    %r14,%rsi
+  802b35:	4c 89 e7             	mov    %r12,%rdi
+  802b38:	48 b8 2e 28 80 00 00 	movabs $0x80282e,%rax
+  802b3f:	00 00 00 
+  802b42:	ff d0                	call   *%rax
+  802b44:	eb 57                	jmp    802b9d <devfile_write+0x1cd>
+  802b46:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802b4d:	77 db                	ja     802b2a <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  802b4f:	4c 89 ff             	mov    %r15,%rdi
+  802b52:	48 b8 f9 40 80 00 00 	movabs $0x8040f9,%rax
+  802b59:	00 00 00 
+  802b5c:	ff d0                	call   *%rax
+  802b5e:	84 c0                	test   %al,%al
+  802b60:	74 99                	je     802afb <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  802b62:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  802b67:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802b6c:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  802b70:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  802b77:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  802b78:	4c 89 ff             	mov    %r15,%rdi
+  802b7b:	49 03 7d 10          	add    0x10(%r13),%rdi
+  802b7f:	48 89 da             	mov    %rbx,%rdx
+  802b82:	4c 89 f6             	mov    %r14,%rsi
+  802b85:	48 b8 8c 10 80 00 00 	movabs $0x80108c,%rax
+  802b8c:	00 00 00 
+  802b8f:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  802b91:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  802b95:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  802b9a:	48 89 d8             	mov    %rbx,%rax
+}
+  802b9d:	48 83 c4 08          	add    $0x8,%rsp
+  802ba1:	5b                   	pop    %rbx
+  802ba2:	41 5c                	pop    %r12
+  802ba4:	41 5d                	pop    %r13
+  802ba6:	41 5e                	pop    %r14
+  802ba8:	41 5f                	pop    %r15
+  802baa:	5d                   	pop    %rbp
+  802bab:	c3                   	ret
+        return E_INVAL;
+  802bac:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802bb1:	c3                   	ret
+
+0000000000802bb2 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802bb2:	55                   	push   %rbp
+  802bb3:	48 89 e5             	mov    %rsp,%rbp
+  802bb6:	41 54                	push   %r12
+  802bb8:	53                   	push   %rbx
+  802bb9:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  802bbc:	48 b8 2b 29 80 00 00 	movabs $0x80292b,%rax
+  802bc3:	00 00 00 
+  802bc6:	ff d0                	call   *%rax
+  802bc8:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  802bcb:	48 89 df             	mov    %rbx,%rdi
+  802bce:	48 b8 de 21 80 00 00 	movabs $0x8021de,%rax
+  802bd5:	00 00 00 
+  802bd8:	ff d0                	call   *%rax
+  802bda:	48 85 c0             	test   %rax,%rax
+  802bdd:	74 17                	je     802bf6 <devfile_flush+0x44>
+  802bdf:	48 89 df             	mov    %rbx,%rdi
+  802be2:	48 b8 de 21 80 00 00 	movabs $0x8021de,%rax
+  802be9:	00 00 00 
+  802bec:	ff d0                	call   *%rax
+  802bee:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  802bf5:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802bf6:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802bf9:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  802c00:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  802c02:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c07:	be 00 00 00 00       	mov    $0x0,%esi
+  802c0c:	bf 06 00 00 00       	mov    $0x6,%edi
+  802c11:	48 b8 c2 26 80 00 00 	movabs $0x8026c2,%rax
+  802c18:	00 00 00 
+  802c1b:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802c1d:	45 85 e4             	test   %r12d,%r12d
+  802c20:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802c24:	5b                   	pop    %rbx
+  802c25:	41 5c                	pop    %r12
+  802c27:	5d                   	pop    %rbp
+  802c28:	c3                   	ret
+
+0000000000802c29 <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  802c29:	55                   	push   %rbp
+  802c2a:	48 89 e5             	mov    %rsp,%rbp
+  802c2d:	41 57                	push   %r15
+  802c2f:	41 56                	push   %r14
+  802c31:	41 55                	push   %r13
+  802c33:	41 54                	push   %r12
+  802c35:	53                   	push   %rbx
+  802c36:	48 83 ec 38          	sub    $0x38,%rsp
+  802c3a:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  802c3e:	49 89 f7             	mov    %rsi,%r15
+  802c41:	48 89 d3             	mov    %rdx,%rbx
+  802c44:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  802c47:	48 b8 74 21 80 00 00 	movabs $0x802174,%rax
+  802c4e:	00 00 00 
+  802c51:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802c53:	48 85 c0             	test   %rax,%rax
+  802c56:	75 20                	jne    802c78 <devfile_read_direct+0x4f>
+    bool map = 1;
+  802c58:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  802c5d:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802c64:	00 
+    while (n) {
+  802c65:	48 85 db             	test   %rbx,%rbx
+  802c68:	0f 85 df 00 00 00    	jne    802d4d <devfile_read_direct+0x124>
+    size_t read = 0;
+  802c6e:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  802c72:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802c76:	eb 21                	jmp    802c99 <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802c78:	45 89 f1             	mov    %r14d,%r9d
+  802c7b:	49 89 d8             	mov    %rbx,%r8
+  802c7e:	4c 89 f9             	mov    %r15,%rcx
+  802c81:	ba 03 00 00 00       	mov    $0x3,%edx
+  802c86:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802c8a:	48 89 c7             	mov    %rax,%rdi
+  802c8d:	48 b8 5b 22 80 00 00 	movabs $0x80225b,%rax
+  802c94:	00 00 00 
+  802c97:	ff d0                	call   *%rax
+}
+  802c99:	48 83 c4 38          	add    $0x38,%rsp
+  802c9d:	5b                   	pop    %rbx
+  802c9e:	41 5c                	pop    %r12
+  802ca0:	41 5d                	pop    %r13
+  802ca2:	41 5e                	pop    %r14
+  802ca4:	41 5f                	pop    %r15
+  802ca6:	5d                   	pop    %rbp
+  802ca7:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802ca8:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802cac:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802cb2:	75 1e                	jne    802cd2 <devfile_read_direct+0xa9>
+  802cb4:	e9 e2 00 00 00       	jmp    802d9b <devfile_read_direct+0x172>
+            if (!res) return read;
+  802cb9:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802cbd:	eb da                	jmp    802c99 <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  802cbf:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  802cc3:	0f 85 d0 01 00 00    	jne    802e99 <devfile_read_direct+0x270>
+            map = 0;
+  802cc9:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802ccd:	eb 03                	jmp    802cd2 <devfile_read_direct+0xa9>
+  802ccf:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802cd2:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802cd7:	48 39 d3             	cmp    %rdx,%rbx
+  802cda:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802cde:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802ce2:	8b 40 0c             	mov    0xc(%rax),%eax
+  802ce5:	48 b9 00 00 83 00 00 	movabs $0x830000,%rcx
+  802cec:	00 00 00 
+  802cef:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  802cf1:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  802cf5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  802cf9:	be 00 00 00 00       	mov    $0x0,%esi
+  802cfe:	bf 03 00 00 00       	mov    $0x3,%edi
+  802d03:	48 b8 c2 26 80 00 00 	movabs $0x8026c2,%rax
+  802d0a:	00 00 00 
+  802d0d:	ff d0                	call   *%rax
+        if (res <= 0)
+  802d0f:	85 c0                	test   %eax,%eax
+  802d11:	0f 8e 63 01 00 00    	jle    802e7a <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  802d17:	4c 63 e0             	movslq %eax,%r12
+  802d1a:	4c 89 e2             	mov    %r12,%rdx
+  802d1d:	48 be 00 10 83 00 00 	movabs $0x831000,%rsi
+  802d24:	00 00 00 
+  802d27:	4c 89 ff             	mov    %r15,%rdi
+  802d2a:	48 b8 8c 10 80 00 00 	movabs $0x80108c,%rax
+  802d31:	00 00 00 
+  802d34:	ff d0                	call   *%rax
+        buf += res;
+  802d36:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  802d39:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  802d3c:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  802d40:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  802d44:	48 85 db             	test   %rbx,%rbx
+  802d47:	0f 84 25 ff ff ff    	je     802c72 <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  802d4d:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  802d50:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  802d54:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802d58:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802d5c:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  802d63:	0f 97 c2             	seta   %dl
+  802d66:	20 c2                	and    %al,%dl
+  802d68:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  802d6b:	0f 84 5e ff ff ff    	je     802ccf <devfile_read_direct+0xa6>
+  802d71:	4c 89 fa             	mov    %r15,%rdx
+  802d74:	4d 89 fd             	mov    %r15,%r13
+  802d77:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  802d7e:	0f 85 4e ff ff ff    	jne    802cd2 <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  802d84:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802d88:	0f 84 1a ff ff ff    	je     802ca8 <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802d8e:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802d95:	0f 85 37 ff ff ff    	jne    802cd2 <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  802d9b:	48 89 d8             	mov    %rbx,%rax
+  802d9e:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802da4:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802da9:	48 39 c8             	cmp    %rcx,%rax
+  802dac:	48 0f 47 c1          	cmova  %rcx,%rax
+  802db0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  802db4:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  802db8:	49 89 d4             	mov    %rdx,%r12
+  802dbb:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  802dbf:	48 b8 9a 40 80 00 00 	movabs $0x80409a,%rax
+  802dc6:	00 00 00 
+  802dc9:	ff d0                	call   *%rax
+  802dcb:	a8 40                	test   $0x40,%al
+  802dcd:	0f 85 b9 00 00 00    	jne    802e8c <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  802dd3:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  802dda:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802dde:	49 39 c5             	cmp    %rax,%r13
+  802de1:	72 d8                	jb     802dbb <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802de3:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802de7:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802dee:	00 00 00 
+  802df1:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802df5:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  802df8:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  802dfa:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  802dfe:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  802e02:	48 b8 0f 20 80 00 00 	movabs $0x80200f,%rax
+  802e09:	00 00 00 
+  802e0c:	ff d0                	call   *%rax
+  802e0e:	89 c7                	mov    %eax,%edi
+  802e10:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802e16:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802e1b:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802e22:	00 00 00 
+  802e25:	be 0e 00 00 00       	mov    $0xe,%esi
+  802e2a:	48 b8 a7 49 80 00 00 	movabs $0x8049a7,%rax
+  802e31:	00 00 00 
+  802e34:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  802e36:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802e3b:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802e3f:	4c 89 fe             	mov    %r15,%rsi
+  802e42:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e47:	48 b8 83 49 80 00 00 	movabs $0x804983,%rax
+  802e4e:	00 00 00 
+  802e51:	ff d0                	call   *%rax
+  802e53:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  802e56:	48 85 d2             	test   %rdx,%rdx
+  802e59:	0f 84 5a fe ff ff    	je     802cb9 <devfile_read_direct+0x90>
+            if (res > 0) {
+  802e5f:	0f 8e 5a fe ff ff    	jle    802cbf <devfile_read_direct+0x96>
+                buf += res;
+  802e65:	48 98                	cltq
+  802e67:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  802e6a:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  802e6d:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  802e71:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  802e75:	e9 ca fe ff ff       	jmp    802d44 <devfile_read_direct+0x11b>
+            return res ? res : read;
+  802e7a:	41 89 c5             	mov    %eax,%r13d
+  802e7d:	48 98                	cltq
+  802e7f:	45 85 ed             	test   %r13d,%r13d
+  802e82:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  802e87:	e9 0d fe ff ff       	jmp    802c99 <devfile_read_direct+0x70>
+            map = 0;
+  802e8c:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802e90:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802e94:	e9 39 fe ff ff       	jmp    802cd2 <devfile_read_direct+0xa9>
+  802e99:	48 89 d0             	mov    %rdx,%rax
+  802e9c:	e9 f8 fd ff ff       	jmp    802c99 <devfile_read_direct+0x70>
+
+0000000000802ea1 <devfile_read>:
+    if (!fd || !buf)
+  802ea1:	48 85 ff             	test   %rdi,%rdi
+  802ea4:	0f 84 21 02 00 00    	je     8030cb <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802eaa:	55                   	push   %rbp
+  802eab:	48 89 e5             	mov    %rsp,%rbp
+  802eae:	41 57                	push   %r15
+  802eb0:	41 56                	push   %r14
+  802eb2:	41 55                	push   %r13
+  802eb4:	41 54                	push   %r12
+  802eb6:	53                   	push   %rbx
+  802eb7:	48 83 ec 28          	sub    $0x28,%rsp
+  802ebb:	48 89 fb             	mov    %rdi,%rbx
+  802ebe:	49 89 f4             	mov    %rsi,%r12
+  802ec1:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  802ec4:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802ec9:	48 85 f6             	test   %rsi,%rsi
+  802ecc:	74 4b                	je     802f19 <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  802ece:	48 b8 de 21 80 00 00 	movabs $0x8021de,%rax
+  802ed5:	00 00 00 
+  802ed8:	ff d0                	call   *%rax
+  802eda:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802edd:	48 85 c0             	test   %rax,%rax
+  802ee0:	74 22                	je     802f04 <devfile_read+0x63>
+  802ee2:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  802ee9:	77 19                	ja     802f04 <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802eeb:	be 00 10 00 00       	mov    $0x1000,%esi
+  802ef0:	48 89 df             	mov    %rbx,%rdi
+  802ef3:	48 b8 4f 13 80 00 00 	movabs $0x80134f,%rax
+  802efa:	00 00 00 
+  802efd:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802eff:	83 f8 02             	cmp    $0x2,%eax
+  802f02:	7e 40                	jle    802f44 <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  802f04:	48 89 df             	mov    %rbx,%rdi
+  802f07:	48 b8 2b 29 80 00 00 	movabs $0x80292b,%rax
+  802f0e:	00 00 00 
+  802f11:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802f13:	85 c0                	test   %eax,%eax
+  802f15:	79 11                	jns    802f28 <devfile_read+0x87>
+  802f17:	48 98                	cltq
+}
+  802f19:	48 83 c4 28          	add    $0x28,%rsp
+  802f1d:	5b                   	pop    %rbx
+  802f1e:	41 5c                	pop    %r12
+  802f20:	41 5d                	pop    %r13
+  802f22:	41 5e                	pop    %r14
+  802f24:	41 5f                	pop    %r15
+  802f26:	5d                   	pop    %rbp
+  802f27:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802f28:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802f2d:	4c 89 ea             	mov    %r13,%rdx
+  802f30:	4c 89 e6             	mov    %r12,%rsi
+  802f33:	48 89 df             	mov    %rbx,%rdi
+  802f36:	48 b8 29 2c 80 00 00 	movabs $0x802c29,%rax
+  802f3d:	00 00 00 
+  802f40:	ff d0                	call   *%rax
+  802f42:	eb d5                	jmp    802f19 <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  802f44:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802f48:	48 89 df             	mov    %rbx,%rdi
+  802f4b:	48 b8 2b 29 80 00 00 	movabs $0x80292b,%rax
+  802f52:	00 00 00 
+  802f55:	ff d0                	call   *%rax
+  802f57:	85 c0                	test   %eax,%eax
+  802f59:	0f 88 33 01 00 00    	js     803092 <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  802f5f:	48 ba 00 23 82 00 00 	movabs $0x822300,%rdx
+  802f66:	00 00 00 
+  802f69:	4c 89 f0             	mov    %r14,%rax
+  802f6c:	48 29 d0             	sub    %rdx,%rax
+  802f6f:	48 c1 f8 03          	sar    $0x3,%rax
+  802f73:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  802f7a:	aa aa aa 
+  802f7d:	48 0f af c2          	imul   %rdx,%rax
+  802f81:	48 c1 e0 0e          	shl    $0xe,%rax
+  802f85:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  802f89:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802f8c:	41 39 06             	cmp    %eax,(%r14)
+  802f8f:	75 0d                	jne    802f9e <devfile_read+0xfd>
+  802f91:	8b 43 10             	mov    0x10(%rbx),%eax
+  802f94:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  802f98:	0f 84 fb 00 00 00    	je     803099 <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  802f9e:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802fa3:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802fa7:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  802faa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802fae:	48 89 c7             	mov    %rax,%rdi
+  802fb1:	48 b8 f9 40 80 00 00 	movabs $0x8040f9,%rax
+  802fb8:	00 00 00 
+  802fbb:	ff d0                	call   *%rax
+  802fbd:	84 c0                	test   %al,%al
+  802fbf:	75 27                	jne    802fe8 <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802fc1:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802fc6:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802fcb:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802fcf:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fd4:	48 b8 8a 13 80 00 00 	movabs $0x80138a,%rax
+  802fdb:	00 00 00 
+  802fde:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  802fe0:	85 c0                	test   %eax,%eax
+  802fe2:	0f 88 dc 00 00 00    	js     8030c4 <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  802fe8:	44 89 f8             	mov    %r15d,%eax
+  802feb:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802ff0:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  802ff2:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  802ff9:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  802ffa:	8b 43 10             	mov    0x10(%rbx),%eax
+  802ffd:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  803001:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  803004:	ba 00 40 00 00       	mov    $0x4000,%edx
+  803009:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80300d:	48 89 df             	mov    %rbx,%rdi
+  803010:	48 b8 29 2c 80 00 00 	movabs $0x802c29,%rax
+  803017:	00 00 00 
+  80301a:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  80301c:	48 85 c0             	test   %rax,%rax
+  80301f:	0f 88 f4 fe ff ff    	js     802f19 <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  803025:	8b 53 0c             	mov    0xc(%rbx),%edx
+  803028:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  80302b:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  80302e:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  803032:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  803036:	48 63 d1             	movslq %ecx,%rdx
+  803039:	48 01 d0             	add    %rdx,%rax
+  80303c:	4d 63 ff             	movslq %r15d,%r15
+  80303f:	4c 29 f8             	sub    %r15,%rax
+  803042:	ba 00 00 00 00       	mov    $0x0,%edx
+  803047:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  80304b:	48 85 c0             	test   %rax,%rax
+  80304e:	0f 8e c5 fe ff ff    	jle    802f19 <devfile_read+0x78>
+    n = MIN(n, res);
+  803054:	4c 39 e8             	cmp    %r13,%rax
+  803057:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  80305b:	8b 73 04             	mov    0x4(%rbx),%esi
+  80305e:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  803062:	48 63 f6             	movslq %esi,%rsi
+  803065:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  80306a:	48 01 c6             	add    %rax,%rsi
+  80306d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803071:	48 01 c6             	add    %rax,%rsi
+  803074:	4c 89 ea             	mov    %r13,%rdx
+  803077:	4c 89 e7             	mov    %r12,%rdi
+  80307a:	48 b8 8c 10 80 00 00 	movabs $0x80108c,%rax
+  803081:	00 00 00 
+  803084:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  803086:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  80308a:	4c 89 e8             	mov    %r13,%rax
+  80308d:	e9 87 fe ff ff       	jmp    802f19 <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  803092:	48 98                	cltq
+  803094:	e9 80 fe ff ff       	jmp    802f19 <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  803099:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  80309d:	41 39 d7             	cmp    %edx,%r15d
+  8030a0:	0f 8c f8 fe ff ff    	jl     802f9e <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  8030a6:	49 8b 46 10          	mov    0x10(%r14),%rax
+  8030aa:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  8030ad:	41 39 cf             	cmp    %ecx,%r15d
+  8030b0:	0f 8d e8 fe ff ff    	jge    802f9e <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  8030b6:	4d 63 ff             	movslq %r15d,%r15
+  8030b9:	4c 29 f8             	sub    %r15,%rax
+  8030bc:	48 63 d2             	movslq %edx,%rdx
+  8030bf:	48 01 d0             	add    %rdx,%rax
+  8030c2:	eb 87                	jmp    80304b <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8030c4:	48 98                	cltq
+  8030c6:	e9 4e fe ff ff       	jmp    802f19 <devfile_read+0x78>
+        return E_INVAL;
+  8030cb:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  8030d0:	c3                   	ret
+
+00000000008030d1 <fs_channel>:
+fs_channel(bool enable) {
+  8030d1:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  8030d3:	a2 04 26 82 00 00 00 	movabs %al,0x822604
+  8030da:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  8030dc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030e1:	40 84 ff             	test   %dil,%dil
+  8030e4:	74 47                	je     80312d <fs_channel+0x5c>
+  8030e6:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8030ed:	00 00 00 
+  8030f0:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  8030f6:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  8030fd:	00 00 00 
+  803100:	3b 08                	cmp    (%rax),%ecx
+  803102:	74 29                	je     80312d <fs_channel+0x5c>
+fs_channel(bool enable) {
+  803104:	55                   	push   %rbp
+  803105:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  803108:	48 b8 51 20 80 00 00 	movabs $0x802051,%rax
+  80310f:	00 00 00 
+  803112:	ff d0                	call   *%rax
+  803114:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  803116:	85 c0                	test   %eax,%eax
+  803118:	78 04                	js     80311e <fs_channel+0x4d>
+}
+  80311a:	89 d0                	mov    %edx,%eax
+  80311c:	5d                   	pop    %rbp
+  80311d:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  80311e:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  803125:	00 00 00 
+  803128:	c6 00 00             	movb   $0x0,(%rax)
+  80312b:	eb ed                	jmp    80311a <fs_channel+0x49>
+}
+  80312d:	89 d0                	mov    %edx,%eax
+  80312f:	c3                   	ret
+
+0000000000803130 <open>:
+open(const char *path, int mode) {
+  803130:	55                   	push   %rbp
+  803131:	48 89 e5             	mov    %rsp,%rbp
+  803134:	41 55                	push   %r13
+  803136:	41 54                	push   %r12
+  803138:	53                   	push   %rbx
+  803139:	48 83 ec 18          	sub    $0x18,%rsp
+  80313d:	49 89 fc             	mov    %rdi,%r12
+  803140:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803143:	48 b8 ed 0d 80 00 00 	movabs $0x800ded,%rax
+  80314a:	00 00 00 
+  80314d:	ff d0                	call   *%rax
+  80314f:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803155:	0f 87 8f 00 00 00    	ja     8031ea <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80315b:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80315f:	48 b8 0b 19 80 00 00 	movabs $0x80190b,%rax
+  803166:	00 00 00 
+  803169:	ff d0                	call   *%rax
+  80316b:	89 c3                	mov    %eax,%ebx
+  80316d:	85 c0                	test   %eax,%eax
+  80316f:	78 55                	js     8031c6 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  803171:	4c 89 e6             	mov    %r12,%rsi
+  803174:	48 bb 00 00 83 00 00 	movabs $0x830000,%rbx
+  80317b:	00 00 00 
+  80317e:	48 89 df             	mov    %rbx,%rdi
+  803181:	48 b8 2b 0e 80 00 00 	movabs $0x800e2b,%rax
+  803188:	00 00 00 
+  80318b:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  80318d:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  803194:	ba 00 00 00 00       	mov    $0x0,%edx
+  803199:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80319d:	bf 01 00 00 00       	mov    $0x1,%edi
+  8031a2:	48 b8 c2 26 80 00 00 	movabs $0x8026c2,%rax
+  8031a9:	00 00 00 
+  8031ac:	ff d0                	call   *%rax
+  8031ae:	89 c3                	mov    %eax,%ebx
+  8031b0:	85 c0                	test   %eax,%eax
+  8031b2:	78 1f                	js     8031d3 <open+0xa3>
+    return fd2num(fd);
+  8031b4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8031b8:	48 b8 dd 18 80 00 00 	movabs $0x8018dd,%rax
+  8031bf:	00 00 00 
+  8031c2:	ff d0                	call   *%rax
+  8031c4:	89 c3                	mov    %eax,%ebx
+}
+  8031c6:	89 d8                	mov    %ebx,%eax
+  8031c8:	48 83 c4 18          	add    $0x18,%rsp
+  8031cc:	5b                   	pop    %rbx
+  8031cd:	41 5c                	pop    %r12
+  8031cf:	41 5d                	pop    %r13
+  8031d1:	5d                   	pop    %rbp
+  8031d2:	c3                   	ret
+        fd_close(fd, 0);
+  8031d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8031d8:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8031dc:	48 b8 26 1a 80 00 00 	movabs $0x801a26,%rax
+  8031e3:	00 00 00 
+  8031e6:	ff d0                	call   *%rax
+        return res;
+  8031e8:	eb dc                	jmp    8031c6 <open+0x96>
+        return -E_BAD_PATH;
+  8031ea:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8031ef:	eb d5                	jmp    8031c6 <open+0x96>
+
+00000000008031f1 <file_flush_buffers>:
+file_flush_buffers(void) {
+  8031f1:	55                   	push   %rbp
+  8031f2:	48 89 e5             	mov    %rsp,%rbp
+  8031f5:	41 56                	push   %r14
+  8031f7:	41 55                	push   %r13
+  8031f9:	41 54                	push   %r12
+  8031fb:	53                   	push   %rbx
+  8031fc:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  803200:	49 bc 08 23 82 00 00 	movabs $0x822308,%r12
+  803207:	00 00 00 
+  80320a:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  80320f:	49 bd 6b 19 80 00 00 	movabs $0x80196b,%r13
+  803216:	00 00 00 
+  803219:	49 be 2b 29 80 00 00 	movabs $0x80292b,%r14
+  803220:	00 00 00 
+  803223:	eb 0c                	jmp    803231 <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  803225:	83 c3 01             	add    $0x1,%ebx
+  803228:	49 83 c4 18          	add    $0x18,%r12
+  80322c:	83 fb 20             	cmp    $0x20,%ebx
+  80322f:	74 1d                	je     80324e <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  803231:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  803236:	74 ed                	je     803225 <file_flush_buffers+0x34>
+  803238:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80323c:	89 df                	mov    %ebx,%edi
+  80323e:	41 ff d5             	call   *%r13
+  803241:	85 c0                	test   %eax,%eax
+  803243:	78 e0                	js     803225 <file_flush_buffers+0x34>
+  803245:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803249:	41 ff d6             	call   *%r14
+  80324c:	eb d7                	jmp    803225 <file_flush_buffers+0x34>
+}
+  80324e:	48 83 c4 10          	add    $0x10,%rsp
+  803252:	5b                   	pop    %rbx
+  803253:	41 5c                	pop    %r12
+  803255:	41 5d                	pop    %r13
+  803257:	41 5e                	pop    %r14
+  803259:	5d                   	pop    %rbp
+  80325a:	c3                   	ret
+
+000000000080325b <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80325b:	55                   	push   %rbp
+  80325c:	48 89 e5             	mov    %rsp,%rbp
+  80325f:	41 54                	push   %r12
+  803261:	53                   	push   %rbx
+  803262:	49 89 fc             	mov    %rdi,%r12
+  803265:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  803267:	48 b8 f1 31 80 00 00 	movabs $0x8031f1,%rax
+  80326e:	00 00 00 
+  803271:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  803273:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  80327a:	00 00 00 
+  80327d:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  803282:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  803284:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  803287:	ba 00 00 00 00       	mov    $0x0,%edx
+  80328c:	be 00 00 00 00       	mov    $0x0,%esi
+  803291:	bf 02 00 00 00       	mov    $0x2,%edi
+  803296:	48 b8 c2 26 80 00 00 	movabs $0x8026c2,%rax
+  80329d:	00 00 00 
+  8032a0:	ff d0                	call   *%rax
+}
+  8032a2:	5b                   	pop    %rbx
+  8032a3:	41 5c                	pop    %r12
+  8032a5:	5d                   	pop    %rbp
+  8032a6:	c3                   	ret
+
+00000000008032a7 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8032a7:	55                   	push   %rbp
+  8032a8:	48 89 e5             	mov    %rsp,%rbp
+  8032ab:	41 54                	push   %r12
+  8032ad:	53                   	push   %rbx
+  8032ae:	49 89 fc             	mov    %rdi,%r12
+  8032b1:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  8032b4:	48 b8 f1 31 80 00 00 	movabs $0x8031f1,%rax
+  8032bb:	00 00 00 
+  8032be:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8032c0:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  8032c5:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  8032cc:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  8032ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8032d8:	bf 05 00 00 00       	mov    $0x5,%edi
+  8032dd:	48 b8 c2 26 80 00 00 	movabs $0x8026c2,%rax
+  8032e4:	00 00 00 
+  8032e7:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8032e9:	85 c0                	test   %eax,%eax
+  8032eb:	78 3d                	js     80332a <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8032ed:	49 bc 00 00 83 00 00 	movabs $0x830000,%r12
+  8032f4:	00 00 00 
+  8032f7:	4c 89 e6             	mov    %r12,%rsi
+  8032fa:	48 89 df             	mov    %rbx,%rdi
+  8032fd:	48 b8 2b 0e 80 00 00 	movabs $0x800e2b,%rax
+  803304:	00 00 00 
+  803307:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  803309:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  803310:	00 
+  803311:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803317:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  80331e:	00 
+  80331f:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  803325:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80332a:	5b                   	pop    %rbx
+  80332b:	41 5c                	pop    %r12
+  80332d:	5d                   	pop    %rbp
+  80332e:	c3                   	ret
+
+000000000080332f <remove>:
+remove(const char *path) {
+  80332f:	55                   	push   %rbp
+  803330:	48 89 e5             	mov    %rsp,%rbp
+  803333:	53                   	push   %rbx
+  803334:	48 83 ec 08          	sub    $0x8,%rsp
+  803338:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  80333b:	48 b8 ed 0d 80 00 00 	movabs $0x800ded,%rax
+  803342:	00 00 00 
+  803345:	ff d0                	call   *%rax
+  803347:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80334d:	77 3a                	ja     803389 <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  80334f:	48 89 de             	mov    %rbx,%rsi
+  803352:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  803359:	00 00 00 
+  80335c:	48 b8 2b 0e 80 00 00 	movabs $0x800e2b,%rax
+  803363:	00 00 00 
+  803366:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  803368:	ba 00 00 00 00       	mov    $0x0,%edx
+  80336d:	be 00 00 00 00       	mov    $0x0,%esi
+  803372:	bf 07 00 00 00       	mov    $0x7,%edi
+  803377:	48 b8 c2 26 80 00 00 	movabs $0x8026c2,%rax
+  80337e:	00 00 00 
+  803381:	ff d0                	call   *%rax
+}
+  803383:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803387:	c9                   	leave
+  803388:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  803389:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80338e:	eb f3                	jmp    803383 <remove+0x54>
+
+0000000000803390 <sync>:
+sync(void) {
+  803390:	55                   	push   %rbp
+  803391:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  803394:	48 b8 f1 31 80 00 00 	movabs $0x8031f1,%rax
+  80339b:	00 00 00 
+  80339e:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  8033a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8033a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8033aa:	bf 08 00 00 00       	mov    $0x8,%edi
+  8033af:	48 b8 c2 26 80 00 00 	movabs $0x8026c2,%rax
+  8033b6:	00 00 00 
+  8033b9:	ff d0                	call   *%rax
+}
+  8033bb:	5d                   	pop    %rbp
+  8033bc:	c3                   	ret
+
+00000000008033bd <fsync>:
+fsync(int fdnum) {
+  8033bd:	55                   	push   %rbp
+  8033be:	48 89 e5             	mov    %rsp,%rbp
+  8033c1:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8033c5:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8033c9:	48 b8 6b 19 80 00 00 	movabs $0x80196b,%rax
+  8033d0:	00 00 00 
+  8033d3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8033d5:	85 c0                	test   %eax,%eax
+  8033d7:	78 4b                	js     803424 <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8033d9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8033dd:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  8033e4:	00 00 00 
+  8033e7:	8b 00                	mov    (%rax),%eax
+  8033e9:	39 02                	cmp    %eax,(%rdx)
+  8033eb:	75 39                	jne    803426 <fsync+0x69>
+    file_flush_buffers();
+  8033ed:	48 b8 f1 31 80 00 00 	movabs $0x8031f1,%rax
+  8033f4:	00 00 00 
+  8033f7:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  8033f9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033fd:	8b 40 0c             	mov    0xc(%rax),%eax
+  803400:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  803407:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  803409:	ba 00 00 00 00       	mov    $0x0,%edx
+  80340e:	be 00 00 00 00       	mov    $0x0,%esi
+  803413:	bf 0d 00 00 00       	mov    $0xd,%edi
+  803418:	48 b8 c2 26 80 00 00 	movabs $0x8026c2,%rax
+  80341f:	00 00 00 
+  803422:	ff d0                	call   *%rax
+}
+  803424:	c9                   	leave
+  803425:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803426:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80342b:	eb f7                	jmp    803424 <fsync+0x67>
+
+000000000080342d <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  80342d:	55                   	push   %rbp
+  80342e:	48 89 e5             	mov    %rsp,%rbp
+  803431:	53                   	push   %rbx
+  803432:	48 83 ec 08          	sub    $0x8,%rsp
+  803436:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  803439:	ba 00 00 00 00       	mov    $0x0,%edx
+  80343e:	be 00 00 00 00       	mov    $0x0,%esi
+  803443:	bf 0b 00 00 00       	mov    $0xb,%edi
+  803448:	48 b8 c2 26 80 00 00 	movabs $0x8026c2,%rax
+  80344f:	00 00 00 
+  803452:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803454:	85 c0                	test   %eax,%eax
+  803456:	78 2d                	js     803485 <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  803458:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  80345f:	00 00 00 
+  803462:	48 8b 10             	mov    (%rax),%rdx
+  803465:	48 89 13             	mov    %rdx,(%rbx)
+  803468:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80346c:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  803470:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803474:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  803478:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80347c:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  803480:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803485:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803489:	c9                   	leave
+  80348a:	c3                   	ret
+
+000000000080348b <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  80348b:	55                   	push   %rbp
+  80348c:	48 89 e5             	mov    %rsp,%rbp
+  80348f:	53                   	push   %rbx
+  803490:	48 83 ec 08          	sub    $0x8,%rsp
+  803494:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  803497:	ba 00 00 00 00       	mov    $0x0,%edx
+  80349c:	be 00 00 00 00       	mov    $0x0,%esi
+  8034a1:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8034a6:	48 b8 c2 26 80 00 00 	movabs $0x8026c2,%rax
+  8034ad:	00 00 00 
+  8034b0:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8034b2:	85 c0                	test   %eax,%eax
+  8034b4:	78 3d                	js     8034f3 <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  8034b6:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  8034bd:	00 00 00 
+  8034c0:	48 8b 10             	mov    (%rax),%rdx
+  8034c3:	48 89 13             	mov    %rdx,(%rbx)
+  8034c6:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8034ca:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  8034ce:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8034d2:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  8034d6:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  8034da:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  8034de:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  8034e2:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  8034e6:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8034ea:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  8034ee:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8034f3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8034f7:	c9                   	leave
+  8034f8:	c3                   	ret
+
+00000000008034f9 <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  8034f9:	55                   	push   %rbp
+  8034fa:	48 89 e5             	mov    %rsp,%rbp
+  8034fd:	41 57                	push   %r15
+  8034ff:	41 56                	push   %r14
+  803501:	41 55                	push   %r13
+  803503:	41 54                	push   %r12
+  803505:	53                   	push   %rbx
+  803506:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  80350a:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  803511:	00 
+  803512:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  803519:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  80351f:	0f 85 43 01 00 00    	jne    803668 <munmap+0x16f>
+  803525:	49 89 ff             	mov    %rdi,%r15
+  803528:	4c 39 f7             	cmp    %r14,%rdi
+  80352b:	0f 87 37 01 00 00    	ja     803668 <munmap+0x16f>
+  803531:	48 bb 00 20 82 00 00 	movabs $0x822000,%rbx
+  803538:	00 00 00 
+  80353b:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  803541:	eb 2c                	jmp    80356f <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  803543:	4c 39 f8             	cmp    %r15,%rax
+  803546:	0f 83 85 00 00 00    	jae    8035d1 <munmap+0xd8>
+            m->mm_end = start;
+  80354c:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  803551:	48 83 c3 18          	add    $0x18,%rbx
+  803555:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  80355c:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  803563:	00 00 00 
+  803566:	48 39 c3             	cmp    %rax,%rbx
+  803569:	0f 84 d0 00 00 00    	je     80363f <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  80356f:	49 89 dc             	mov    %rbx,%r12
+  803572:	48 8b 03             	mov    (%rbx),%rax
+  803575:	4c 39 f0             	cmp    %r14,%rax
+  803578:	73 d7                	jae    803551 <munmap+0x58>
+  80357a:	48 85 c0             	test   %rax,%rax
+  80357d:	74 d2                	je     803551 <munmap+0x58>
+  80357f:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  803583:	49 39 d7             	cmp    %rdx,%r15
+  803586:	73 c9                	jae    803551 <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  803588:	49 39 d6             	cmp    %rdx,%r14
+  80358b:	73 b6                	jae    803543 <munmap+0x4a>
+  80358d:	49 39 c7             	cmp    %rax,%r15
+  803590:	76 b1                	jbe    803543 <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  803592:	4c 89 ef             	mov    %r13,%rdi
+  803595:	48 b8 30 26 80 00 00 	movabs $0x802630,%rax
+  80359c:	00 00 00 
+  80359f:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  8035a1:	48 85 c0             	test   %rax,%rax
+  8035a4:	0f 84 c5 00 00 00    	je     80366f <munmap+0x176>
+            *tail = *m;
+  8035aa:	48 8b 13             	mov    (%rbx),%rdx
+  8035ad:	48 89 10             	mov    %rdx,(%rax)
+  8035b0:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8035b4:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  8035b8:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  8035bc:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  8035c0:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  8035c3:	44 89 f2             	mov    %r14d,%edx
+  8035c6:	2b 13                	sub    (%rbx),%edx
+  8035c8:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  8035cb:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  8035cf:	eb 80                	jmp    803551 <munmap+0x58>
+        } else if (m->mm_end > end) {
+  8035d1:	49 39 d6             	cmp    %rdx,%r14
+  8035d4:	73 18                	jae    8035ee <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  8035d6:	44 89 f2             	mov    %r14d,%edx
+  8035d9:	41 03 54 24 10       	add    0x10(%r12),%edx
+  8035de:	29 c2                	sub    %eax,%edx
+  8035e0:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  8035e5:	4d 89 34 24          	mov    %r14,(%r12)
+  8035e9:	e9 63 ff ff ff       	jmp    803551 <munmap+0x58>
+    m->mm_start = 0;
+  8035ee:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  8035f5:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  8035f6:	4c 89 e6             	mov    %r12,%rsi
+  8035f9:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  803600:	00 00 00 
+  803603:	48 29 c6             	sub    %rax,%rsi
+  803606:	48 c1 fe 03          	sar    $0x3,%rsi
+  80360a:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  803611:	aa aa aa 
+  803614:	48 0f af f0          	imul   %rax,%rsi
+  803618:	48 c1 e6 0c          	shl    $0xc,%rsi
+  80361c:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  803621:	48 01 c6             	add    %rax,%rsi
+  803624:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803629:	bf 00 00 00 00       	mov    $0x0,%edi
+  80362e:	48 b8 30 14 80 00 00 	movabs $0x801430,%rax
+  803635:	00 00 00 
+  803638:	ff d0                	call   *%rax
+}
+  80363a:	e9 12 ff ff ff       	jmp    803551 <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  80363f:	4c 89 f2             	mov    %r14,%rdx
+  803642:	4c 29 fa             	sub    %r15,%rdx
+  803645:	4c 89 fe             	mov    %r15,%rsi
+  803648:	bf 00 00 00 00       	mov    $0x0,%edi
+  80364d:	48 b8 30 14 80 00 00 	movabs $0x801430,%rax
+  803654:	00 00 00 
+  803657:	ff d0                	call   *%rax
+}
+  803659:	48 83 c4 08          	add    $0x8,%rsp
+  80365d:	5b                   	pop    %rbx
+  80365e:	41 5c                	pop    %r12
+  803660:	41 5d                	pop    %r13
+  803662:	41 5e                	pop    %r14
+  803664:	41 5f                	pop    %r15
+  803666:	5d                   	pop    %rbp
+  803667:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  803668:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80366d:	eb ea                	jmp    803659 <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  80366f:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  803674:	eb e3                	jmp    803659 <munmap+0x160>
+
+0000000000803676 <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  803676:	55                   	push   %rbp
+  803677:	48 89 e5             	mov    %rsp,%rbp
+  80367a:	41 57                	push   %r15
+  80367c:	41 56                	push   %r14
+  80367e:	41 55                	push   %r13
+  803680:	41 54                	push   %r12
+  803682:	53                   	push   %rbx
+  803683:	48 83 ec 28          	sub    $0x28,%rsp
+  803687:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  80368b:	49 89 f5             	mov    %rsi,%r13
+  80368e:	41 89 d6             	mov    %edx,%r14d
+  803691:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  803694:	41 89 cc             	mov    %ecx,%r12d
+  803697:	44 89 c7             	mov    %r8d,%edi
+  80369a:	44 89 cb             	mov    %r9d,%ebx
+  80369d:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8036a1:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8036a5:	48 b8 6b 19 80 00 00 	movabs $0x80196b,%rax
+  8036ac:	00 00 00 
+  8036af:	ff d0                	call   *%rax
+  8036b1:	41 89 c7             	mov    %eax,%r15d
+  8036b4:	85 c0                	test   %eax,%eax
+  8036b6:	0f 88 ae 01 00 00    	js     80386a <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8036bc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8036c0:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  8036c7:	00 00 00 
+  8036ca:	8b 32                	mov    (%rdx),%esi
+  8036cc:	39 30                	cmp    %esi,(%rax)
+  8036ce:	0f 85 7a 02 00 00    	jne    80394e <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  8036d4:	8b 40 08             	mov    0x8(%rax),%eax
+  8036d7:	83 e0 03             	and    $0x3,%eax
+  8036da:	83 f8 01             	cmp    $0x1,%eax
+  8036dd:	0f 84 76 02 00 00    	je     803959 <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  8036e3:	4d 85 ed             	test   %r13,%r13
+  8036e6:	0f 84 78 02 00 00    	je     803964 <mmap+0x2ee>
+  8036ec:	85 db                	test   %ebx,%ebx
+  8036ee:	0f 88 70 02 00 00    	js     803964 <mmap+0x2ee>
+  8036f4:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  8036fa:	41 89 df             	mov    %ebx,%r15d
+  8036fd:	0f 85 6c 02 00 00    	jne    80396f <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  803703:	44 89 f0             	mov    %r14d,%eax
+  803706:	83 e0 fd             	and    $0xfffffffd,%eax
+  803709:	83 f8 04             	cmp    $0x4,%eax
+  80370c:	0f 85 68 02 00 00    	jne    80397a <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  803712:	44 89 e1             	mov    %r12d,%ecx
+  803715:	83 e1 01             	and    $0x1,%ecx
+  803718:	0f 95 c2             	setne  %dl
+  80371b:	44 89 e0             	mov    %r12d,%eax
+  80371e:	d1 e8                	shr    %eax
+  803720:	83 f0 01             	xor    $0x1,%eax
+  803723:	83 e0 01             	and    $0x1,%eax
+  803726:	38 c2                	cmp    %al,%dl
+  803728:	0f 85 57 02 00 00    	jne    803985 <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  80372e:	85 c9                	test   %ecx,%ecx
+  803730:	74 0a                	je     80373c <mmap+0xc6>
+  803732:	41 f6 c6 02          	test   $0x2,%r14b
+  803736:	0f 85 54 02 00 00    	jne    803990 <mmap+0x31a>
+    file_flush_buffers();
+  80373c:	48 b8 f1 31 80 00 00 	movabs $0x8031f1,%rax
+  803743:	00 00 00 
+  803746:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  803748:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  80374f:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  803756:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80375a:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  80375d:	41 f6 c4 04          	test   $0x4,%r12b
+  803761:	0f 84 15 01 00 00    	je     80387c <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  803767:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  80376a:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  803770:	0f 85 25 02 00 00    	jne    80399b <mmap+0x325>
+  803776:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  80377a:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  803781:	00 00 00 
+  803784:	48 39 c2             	cmp    %rax,%rdx
+  803787:	0f 82 19 02 00 00    	jb     8039a6 <mmap+0x330>
+  80378d:	48 39 c7             	cmp    %rax,%rdi
+  803790:	0f 87 10 02 00 00    	ja     8039a6 <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  803796:	4c 89 ee             	mov    %r13,%rsi
+  803799:	48 b8 f9 34 80 00 00 	movabs $0x8034f9,%rax
+  8037a0:	00 00 00 
+  8037a3:	ff d0                	call   *%rax
+  8037a5:	85 c0                	test   %eax,%eax
+  8037a7:	0f 88 04 02 00 00    	js     8039b1 <mmap+0x33b>
+    if (!handler) {
+  8037ad:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  8037b4:	00 00 00 
+  8037b7:	80 38 00             	cmpb   $0x0,(%rax)
+  8037ba:	75 2b                	jne    8037e7 <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  8037bc:	48 bf 91 25 80 00 00 	movabs $0x802591,%rdi
+  8037c3:	00 00 00 
+  8037c6:	48 b8 52 46 80 00 00 	movabs $0x804652,%rax
+  8037cd:	00 00 00 
+  8037d0:	ff d0                	call   *%rax
+  8037d2:	85 c0                	test   %eax,%eax
+  8037d4:	0f 88 ea 01 00 00    	js     8039c4 <mmap+0x34e>
+        handler = 1;
+  8037da:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  8037e1:	00 00 00 
+  8037e4:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  8037e7:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8037eb:	48 b8 30 26 80 00 00 	movabs $0x802630,%rax
+  8037f2:	00 00 00 
+  8037f5:	ff d0                	call   *%rax
+  8037f7:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  8037fa:	48 85 c0             	test   %rax,%rax
+  8037fd:	0f 84 c9 01 00 00    	je     8039cc <mmap+0x356>
+    m->mm_start = va;
+  803803:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  803806:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  80380a:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  80380e:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  803811:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  803815:	44 89 e0             	mov    %r12d,%eax
+  803818:	c1 e0 06             	shl    $0x6,%eax
+  80381b:	25 80 00 00 00       	and    $0x80,%eax
+  803820:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  803823:	09 f0                	or     %esi,%eax
+  803825:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  803829:	41 f6 c4 08          	test   $0x8,%r12b
+  80382d:	74 31                	je     803860 <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  80382f:	48 39 d3             	cmp    %rdx,%rbx
+  803832:	73 2c                	jae    803860 <mmap+0x1ea>
+  803834:	ba 00 00 04 00       	mov    $0x40000,%edx
+  803839:	48 89 de             	mov    %rbx,%rsi
+  80383c:	4c 89 f7             	mov    %r14,%rdi
+  80383f:	48 b8 80 24 80 00 00 	movabs $0x802480,%rax
+  803846:	00 00 00 
+  803849:	ff d0                	call   *%rax
+  80384b:	49 89 c4             	mov    %rax,%r12
+  80384e:	48 85 c0             	test   %rax,%rax
+  803851:	0f 8e d7 00 00 00    	jle    80392e <mmap+0x2b8>
+            va += n;
+  803857:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  80385a:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  80385e:	72 d4                	jb     803834 <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  803860:	49 8b 06             	mov    (%r14),%rax
+  803863:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  803867:	48 89 06             	mov    %rax,(%rsi)
+}
+  80386a:	44 89 f8             	mov    %r15d,%eax
+  80386d:	48 83 c4 28          	add    $0x28,%rsp
+  803871:	5b                   	pop    %rbx
+  803872:	41 5c                	pop    %r12
+  803874:	41 5d                	pop    %r13
+  803876:	41 5e                	pop    %r14
+  803878:	41 5f                	pop    %r15
+  80387a:	5d                   	pop    %rbp
+  80387b:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80387c:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  803883:	00 00 00 
+  803886:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  803889:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  803890:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803893:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  803898:	48 be 00 20 82 00 00 	movabs $0x822000,%rsi
+  80389f:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8038a2:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  8038a9:	00 00 00 
+  8038ac:	48 39 d7             	cmp    %rdx,%rdi
+  8038af:	73 1c                	jae    8038cd <mmap+0x257>
+        return -E_NO_MEM;
+  8038b1:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8038b7:	eb b1                	jmp    80386a <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8038b9:	48 83 c0 01          	add    $0x1,%rax
+  8038bd:	48 83 f8 1f          	cmp    $0x1f,%rax
+  8038c1:	77 3f                	ja     803902 <mmap+0x28c>
+  8038c3:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  8038c8:	48 39 d7             	cmp    %rdx,%rdi
+  8038cb:	72 2a                	jb     8038f7 <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  8038cd:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  8038d1:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  8038d5:	48 39 d1             	cmp    %rdx,%rcx
+  8038d8:	73 df                	jae    8038b9 <mmap+0x243>
+  8038da:	48 85 c9             	test   %rcx,%rcx
+  8038dd:	74 da                	je     8038b9 <mmap+0x243>
+  8038df:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  8038e3:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  8038e8:	48 39 d3             	cmp    %rdx,%rbx
+  8038eb:	73 cc                	jae    8038b9 <mmap+0x243>
+            va = mmaps[i].mm_end;
+  8038ed:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8038f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038f5:	eb cc                	jmp    8038c3 <mmap+0x24d>
+        return -E_NO_MEM;
+  8038f7:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8038fd:	e9 68 ff ff ff       	jmp    80386a <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  803902:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  803907:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  80390e:	00 00 00 
+  803911:	48 39 c2             	cmp    %rax,%rdx
+  803914:	0f 82 9f 00 00 00    	jb     8039b9 <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  80391a:	48 85 db             	test   %rbx,%rbx
+  80391d:	0f 85 8a fe ff ff    	jne    8037ad <mmap+0x137>
+        return -E_NO_MEM;
+  803923:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803929:	e9 3c ff ff ff       	jmp    80386a <mmap+0x1f4>
+        if (n < 0) {
+  80392e:	0f 89 2c ff ff ff    	jns    803860 <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  803934:	49 8b 3e             	mov    (%r14),%rdi
+  803937:	4c 89 ee             	mov    %r13,%rsi
+  80393a:	48 b8 f9 34 80 00 00 	movabs $0x8034f9,%rax
+  803941:	00 00 00 
+  803944:	ff d0                	call   *%rax
+            return n;
+  803946:	45 89 e7             	mov    %r12d,%r15d
+  803949:	e9 1c ff ff ff       	jmp    80386a <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80394e:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803954:	e9 11 ff ff ff       	jmp    80386a <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  803959:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80395f:	e9 06 ff ff ff       	jmp    80386a <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  803964:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80396a:	e9 fb fe ff ff       	jmp    80386a <mmap+0x1f4>
+  80396f:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803975:	e9 f0 fe ff ff       	jmp    80386a <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  80397a:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803980:	e9 e5 fe ff ff       	jmp    80386a <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  803985:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80398b:	e9 da fe ff ff       	jmp    80386a <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  803990:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  803996:	e9 cf fe ff ff       	jmp    80386a <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  80399b:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8039a1:	e9 c4 fe ff ff       	jmp    80386a <mmap+0x1f4>
+  8039a6:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8039ac:	e9 b9 fe ff ff       	jmp    80386a <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  8039b1:	41 89 c7             	mov    %eax,%r15d
+  8039b4:	e9 b1 fe ff ff       	jmp    80386a <mmap+0x1f4>
+        return -E_NO_MEM;
+  8039b9:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8039bf:	e9 a6 fe ff ff       	jmp    80386a <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  8039c4:	41 89 c7             	mov    %eax,%r15d
+  8039c7:	e9 9e fe ff ff       	jmp    80386a <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  8039cc:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8039d2:	e9 93 fe ff ff       	jmp    80386a <mmap+0x1f4>
+
+00000000008039d7 <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8039d7:	55                   	push   %rbp
+  8039d8:	48 89 e5             	mov    %rsp,%rbp
+  8039db:	41 54                	push   %r12
+  8039dd:	53                   	push   %rbx
+  8039de:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8039e1:	48 b8 ef 18 80 00 00 	movabs $0x8018ef,%rax
+  8039e8:	00 00 00 
+  8039eb:	ff d0                	call   *%rax
+  8039ed:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8039f0:	48 be c0 51 80 00 00 	movabs $0x8051c0,%rsi
+  8039f7:	00 00 00 
+  8039fa:	48 89 df             	mov    %rbx,%rdi
+  8039fd:	48 b8 2b 0e 80 00 00 	movabs $0x800e2b,%rax
+  803a04:	00 00 00 
+  803a07:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803a09:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803a0e:	41 2b 04 24          	sub    (%r12),%eax
+  803a12:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803a18:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803a1f:	00 00 00 
+    stat->st_dev = &devpipe;
+  803a22:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803a29:	00 00 00 
+  803a2c:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803a33:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a38:	5b                   	pop    %rbx
+  803a39:	41 5c                	pop    %r12
+  803a3b:	5d                   	pop    %rbp
+  803a3c:	c3                   	ret
+
+0000000000803a3d <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  803a3d:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803a40:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  803a46:	8b 17                	mov    (%rdi),%edx
+  803a48:	85 d2                	test   %edx,%edx
+  803a4a:	75 01                	jne    803a4d <pipe_wakeup+0x10>
+  803a4c:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  803a4d:	55                   	push   %rbp
+  803a4e:	48 89 e5             	mov    %rsp,%rbp
+  803a51:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  803a54:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  803a5a:	be 00 04 00 00       	mov    $0x400,%esi
+  803a5f:	48 b8 16 17 80 00 00 	movabs $0x801716,%rax
+  803a66:	00 00 00 
+  803a69:	ff d0                	call   *%rax
+}
+  803a6b:	5d                   	pop    %rbp
+  803a6c:	c3                   	ret
+
+0000000000803a6d <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803a6d:	55                   	push   %rbp
+  803a6e:	48 89 e5             	mov    %rsp,%rbp
+  803a71:	41 55                	push   %r13
+  803a73:	41 54                	push   %r12
+  803a75:	53                   	push   %rbx
+  803a76:	48 83 ec 08          	sub    $0x8,%rsp
+  803a7a:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803a7d:	48 b8 ef 18 80 00 00 	movabs $0x8018ef,%rax
+  803a84:	00 00 00 
+  803a87:	ff d0                	call   *%rax
+  803a89:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803a8c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a91:	4c 89 e6             	mov    %r12,%rsi
+  803a94:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a99:	49 bc 30 14 80 00 00 	movabs $0x801430,%r12
+  803aa0:	00 00 00 
+  803aa3:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803aa6:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803aaa:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803aae:	49 bd 3d 3a 80 00 00 	movabs $0x803a3d,%r13
+  803ab5:	00 00 00 
+  803ab8:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803abb:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803abf:	48 89 de             	mov    %rbx,%rsi
+  803ac2:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  803ac5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803aca:	48 89 de             	mov    %rbx,%rsi
+  803acd:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ad2:	41 ff d4             	call   *%r12
+  803ad5:	48 83 c4 08          	add    $0x8,%rsp
+  803ad9:	5b                   	pop    %rbx
+  803ada:	41 5c                	pop    %r12
+  803adc:	41 5d                	pop    %r13
+  803ade:	5d                   	pop    %rbp
+  803adf:	c3                   	ret
+
+0000000000803ae0 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  803ae0:	55                   	push   %rbp
+  803ae1:	48 89 e5             	mov    %rsp,%rbp
+  803ae4:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803ae7:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803aec:	be 00 10 00 00       	mov    $0x1000,%esi
+  803af1:	48 b8 73 13 80 00 00 	movabs $0x801373,%rax
+  803af8:	00 00 00 
+  803afb:	ff d0                	call   *%rax
+  803afd:	85 c0                	test   %eax,%eax
+  803aff:	0f 94 c0             	sete   %al
+  803b02:	0f b6 c0             	movzbl %al,%eax
+}
+  803b05:	5d                   	pop    %rbp
+  803b06:	c3                   	ret
+
+0000000000803b07 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803b07:	55                   	push   %rbp
+  803b08:	48 89 e5             	mov    %rsp,%rbp
+  803b0b:	41 57                	push   %r15
+  803b0d:	41 56                	push   %r14
+  803b0f:	41 55                	push   %r13
+  803b11:	41 54                	push   %r12
+  803b13:	53                   	push   %rbx
+  803b14:	48 83 ec 38          	sub    $0x38,%rsp
+  803b18:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803b1c:	49 89 f4             	mov    %rsi,%r12
+  803b1f:	49 89 d7             	mov    %rdx,%r15
+  803b22:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803b26:	48 b8 ef 18 80 00 00 	movabs $0x8018ef,%rax
+  803b2d:	00 00 00 
+  803b30:	ff d0                	call   *%rax
+  803b32:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803b35:	4d 85 ff             	test   %r15,%r15
+  803b38:	0f 84 f1 00 00 00    	je     803c2f <devpipe_write+0x128>
+  803b3e:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  803b42:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  803b46:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  803b4a:	49 bd e0 3a 80 00 00 	movabs $0x803ae0,%r13
+  803b51:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803b54:	49 bf 3d 3a 80 00 00 	movabs $0x803a3d,%r15
+  803b5b:	00 00 00 
+  803b5e:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803b62:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b66:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803b6a:	8b 73 04             	mov    0x4(%rbx),%esi
+  803b6d:	48 63 ce             	movslq %esi,%rcx
+  803b70:	48 63 03             	movslq (%rbx),%rax
+  803b73:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  803b79:	48 39 c1             	cmp    %rax,%rcx
+  803b7c:	72 64                	jb     803be2 <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  803b7e:	48 89 de             	mov    %rbx,%rsi
+  803b81:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803b85:	41 ff d5             	call   *%r13
+  803b88:	85 c0                	test   %eax,%eax
+  803b8a:	0f 85 b9 00 00 00    	jne    803c49 <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803b90:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803b94:	4c 89 f7             	mov    %r14,%rdi
+  803b97:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  803b9a:	8b 43 04             	mov    0x4(%rbx),%eax
+  803b9d:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  803ba4:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803bab:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803bb1:	8b 03                	mov    (%rbx),%eax
+  803bb3:	41 39 c4             	cmp    %eax,%r12d
+  803bb6:	75 b2                	jne    803b6a <devpipe_write+0x63>
+  803bb8:	48 89 de             	mov    %rbx,%rsi
+  803bbb:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803bbf:	41 ff d5             	call   *%r13
+  803bc2:	85 c0                	test   %eax,%eax
+  803bc4:	75 a0                	jne    803b66 <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803bc6:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803bcb:	44 89 e6             	mov    %r12d,%esi
+  803bce:	48 89 df             	mov    %rbx,%rdi
+  803bd1:	48 b8 f8 16 80 00 00 	movabs $0x8016f8,%rax
+  803bd8:	00 00 00 
+  803bdb:	ff d0                	call   *%rax
+  803bdd:	e9 7c ff ff ff       	jmp    803b5e <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803be2:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  803be6:	41 0f b6 38          	movzbl (%r8),%edi
+  803bea:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803bf1:	80 80 80 
+  803bf4:	48 89 c8             	mov    %rcx,%rax
+  803bf7:	48 f7 e2             	mul    %rdx
+  803bfa:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803bfe:	48 89 d0             	mov    %rdx,%rax
+  803c01:	48 c1 e0 08          	shl    $0x8,%rax
+  803c05:	48 29 d0             	sub    %rdx,%rax
+  803c08:	48 c1 e0 04          	shl    $0x4,%rax
+  803c0c:	48 29 c1             	sub    %rax,%rcx
+  803c0f:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  803c14:	83 c6 01             	add    $0x1,%esi
+  803c17:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803c1a:	49 83 c0 01          	add    $0x1,%r8
+  803c1e:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  803c22:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803c26:	49 39 c0             	cmp    %rax,%r8
+  803c29:	0f 85 2f ff ff ff    	jne    803b5e <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803c2f:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803c33:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803c37:	48 b8 3d 3a 80 00 00 	movabs $0x803a3d,%rax
+  803c3e:	00 00 00 
+  803c41:	ff d0                	call   *%rax
+    return n;
+  803c43:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803c47:	eb 05                	jmp    803c4e <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  803c49:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803c4e:	48 83 c4 38          	add    $0x38,%rsp
+  803c52:	5b                   	pop    %rbx
+  803c53:	41 5c                	pop    %r12
+  803c55:	41 5d                	pop    %r13
+  803c57:	41 5e                	pop    %r14
+  803c59:	41 5f                	pop    %r15
+  803c5b:	5d                   	pop    %rbp
+  803c5c:	c3                   	ret
+
+0000000000803c5d <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803c5d:	55                   	push   %rbp
+  803c5e:	48 89 e5             	mov    %rsp,%rbp
+  803c61:	41 57                	push   %r15
+  803c63:	41 56                	push   %r14
+  803c65:	41 55                	push   %r13
+  803c67:	41 54                	push   %r12
+  803c69:	53                   	push   %rbx
+  803c6a:	48 83 ec 28          	sub    $0x28,%rsp
+  803c6e:	49 89 fd             	mov    %rdi,%r13
+  803c71:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  803c75:	49 89 d4             	mov    %rdx,%r12
+  803c78:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803c7c:	48 b8 ef 18 80 00 00 	movabs $0x8018ef,%rax
+  803c83:	00 00 00 
+  803c86:	ff d0                	call   *%rax
+  803c88:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803c8b:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  803c91:	49 bf e0 3a 80 00 00 	movabs $0x803ae0,%r15
+  803c98:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803c9b:	4d 85 e4             	test   %r12,%r12
+  803c9e:	0f 84 d5 00 00 00    	je     803d79 <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803ca4:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803ca8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803cac:	8b 03                	mov    (%rbx),%eax
+  803cae:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803cb1:	75 7a                	jne    803d2d <devpipe_read+0xd0>
+            if (i > 0) {
+  803cb3:	4d 85 f6             	test   %r14,%r14
+  803cb6:	75 50                	jne    803d08 <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  803cb8:	48 89 de             	mov    %rbx,%rsi
+  803cbb:	4c 89 ef             	mov    %r13,%rdi
+  803cbe:	41 ff d7             	call   *%r15
+  803cc1:	85 c0                	test   %eax,%eax
+  803cc3:	0f 85 c9 00 00 00    	jne    803d92 <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803cc9:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  803ccc:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803cd3:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803cd9:	8b 43 04             	mov    0x4(%rbx),%eax
+  803cdc:	41 39 c4             	cmp    %eax,%r12d
+  803cdf:	75 cb                	jne    803cac <devpipe_read+0x4f>
+  803ce1:	48 89 de             	mov    %rbx,%rsi
+  803ce4:	4c 89 ef             	mov    %r13,%rdi
+  803ce7:	41 ff d7             	call   *%r15
+  803cea:	85 c0                	test   %eax,%eax
+  803cec:	75 be                	jne    803cac <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803cee:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803cf3:	44 89 e6             	mov    %r12d,%esi
+  803cf6:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803cfa:	48 b8 f8 16 80 00 00 	movabs $0x8016f8,%rax
+  803d01:	00 00 00 
+  803d04:	ff d0                	call   *%rax
+  803d06:	eb a4                	jmp    803cac <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803d08:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803d0c:	48 89 de             	mov    %rbx,%rsi
+  803d0f:	48 b8 3d 3a 80 00 00 	movabs $0x803a3d,%rax
+  803d16:	00 00 00 
+  803d19:	ff d0                	call   *%rax
+                return i;
+  803d1b:	4c 89 f0             	mov    %r14,%rax
+}
+  803d1e:	48 83 c4 28          	add    $0x28,%rsp
+  803d22:	5b                   	pop    %rbx
+  803d23:	41 5c                	pop    %r12
+  803d25:	41 5d                	pop    %r13
+  803d27:	41 5e                	pop    %r14
+  803d29:	41 5f                	pop    %r15
+  803d2b:	5d                   	pop    %rbp
+  803d2c:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803d2d:	48 63 c8             	movslq %eax,%rcx
+  803d30:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803d37:	80 80 80 
+  803d3a:	48 89 c8             	mov    %rcx,%rax
+  803d3d:	48 f7 e2             	mul    %rdx
+  803d40:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803d44:	48 89 d0             	mov    %rdx,%rax
+  803d47:	48 c1 e0 08          	shl    $0x8,%rax
+  803d4b:	48 29 d0             	sub    %rdx,%rax
+  803d4e:	48 c1 e0 04          	shl    $0x4,%rax
+  803d52:	48 89 c2             	mov    %rax,%rdx
+  803d55:	48 89 c8             	mov    %rcx,%rax
+  803d58:	48 29 d0             	sub    %rdx,%rax
+  803d5b:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  803d60:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803d64:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  803d68:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803d6b:	49 83 c6 01          	add    $0x1,%r14
+  803d6f:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  803d73:	0f 85 2b ff ff ff    	jne    803ca4 <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803d79:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803d7d:	48 89 de             	mov    %rbx,%rsi
+  803d80:	48 b8 3d 3a 80 00 00 	movabs $0x803a3d,%rax
+  803d87:	00 00 00 
+  803d8a:	ff d0                	call   *%rax
+    return n;
+  803d8c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803d90:	eb 8c                	jmp    803d1e <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  803d92:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d97:	eb 85                	jmp    803d1e <devpipe_read+0xc1>
+
+0000000000803d99 <pipe>:
+pipe(int pfd[2]) {
+  803d99:	55                   	push   %rbp
+  803d9a:	48 89 e5             	mov    %rsp,%rbp
+  803d9d:	41 55                	push   %r13
+  803d9f:	41 54                	push   %r12
+  803da1:	53                   	push   %rbx
+  803da2:	48 83 ec 18          	sub    $0x18,%rsp
+  803da6:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803da9:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803dad:	48 b8 0b 19 80 00 00 	movabs $0x80190b,%rax
+  803db4:	00 00 00 
+  803db7:	ff d0                	call   *%rax
+  803db9:	89 c3                	mov    %eax,%ebx
+  803dbb:	85 c0                	test   %eax,%eax
+  803dbd:	0f 88 a0 01 00 00    	js     803f63 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803dc3:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803dc8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803dcd:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803dd1:	bf 00 00 00 00       	mov    $0x0,%edi
+  803dd6:	48 b8 8a 13 80 00 00 	movabs $0x80138a,%rax
+  803ddd:	00 00 00 
+  803de0:	ff d0                	call   *%rax
+  803de2:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803de4:	85 c0                	test   %eax,%eax
+  803de6:	0f 88 77 01 00 00    	js     803f63 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803dec:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803df0:	48 b8 0b 19 80 00 00 	movabs $0x80190b,%rax
+  803df7:	00 00 00 
+  803dfa:	ff d0                	call   *%rax
+  803dfc:	89 c3                	mov    %eax,%ebx
+  803dfe:	85 c0                	test   %eax,%eax
+  803e00:	0f 88 43 01 00 00    	js     803f49 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803e06:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803e0b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803e10:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803e14:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e19:	48 b8 8a 13 80 00 00 	movabs $0x80138a,%rax
+  803e20:	00 00 00 
+  803e23:	ff d0                	call   *%rax
+  803e25:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803e27:	85 c0                	test   %eax,%eax
+  803e29:	0f 88 1a 01 00 00    	js     803f49 <pipe+0x1b0>
+    va = fd2data(fd0);
+  803e2f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803e33:	48 b8 ef 18 80 00 00 	movabs $0x8018ef,%rax
+  803e3a:	00 00 00 
+  803e3d:	ff d0                	call   *%rax
+  803e3f:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803e42:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803e47:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803e4c:	48 89 c6             	mov    %rax,%rsi
+  803e4f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e54:	48 b8 8a 13 80 00 00 	movabs $0x80138a,%rax
+  803e5b:	00 00 00 
+  803e5e:	ff d0                	call   *%rax
+  803e60:	89 c3                	mov    %eax,%ebx
+  803e62:	85 c0                	test   %eax,%eax
+  803e64:	0f 88 c5 00 00 00    	js     803f2f <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803e6a:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803e6e:	48 b8 ef 18 80 00 00 	movabs $0x8018ef,%rax
+  803e75:	00 00 00 
+  803e78:	ff d0                	call   *%rax
+  803e7a:	48 89 c1             	mov    %rax,%rcx
+  803e7d:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803e83:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803e89:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e8e:	4c 89 ee             	mov    %r13,%rsi
+  803e91:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e96:	48 b8 e0 13 80 00 00 	movabs $0x8013e0,%rax
+  803e9d:	00 00 00 
+  803ea0:	ff d0                	call   *%rax
+  803ea2:	89 c3                	mov    %eax,%ebx
+  803ea4:	85 c0                	test   %eax,%eax
+  803ea6:	78 6e                	js     803f16 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803ea8:	be 00 10 00 00       	mov    $0x1000,%esi
+  803ead:	4c 89 ef             	mov    %r13,%rdi
+  803eb0:	48 b8 4f 13 80 00 00 	movabs $0x80134f,%rax
+  803eb7:	00 00 00 
+  803eba:	ff d0                	call   *%rax
+  803ebc:	83 f8 02             	cmp    $0x2,%eax
+  803ebf:	0f 85 ab 00 00 00    	jne    803f70 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803ec5:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803ecc:	00 00 
+  803ece:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803ed2:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803ed4:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803ed8:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803edf:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803ee3:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803ee5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803ee9:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803ef0:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803ef4:	48 bb dd 18 80 00 00 	movabs $0x8018dd,%rbx
+  803efb:	00 00 00 
+  803efe:	ff d3                	call   *%rbx
+  803f00:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803f04:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803f08:	ff d3                	call   *%rbx
+  803f0a:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803f0f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803f14:	eb 4d                	jmp    803f63 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803f16:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f1b:	4c 89 ee             	mov    %r13,%rsi
+  803f1e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f23:	48 b8 30 14 80 00 00 	movabs $0x801430,%rax
+  803f2a:	00 00 00 
+  803f2d:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803f2f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f34:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803f38:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f3d:	48 b8 30 14 80 00 00 	movabs $0x801430,%rax
+  803f44:	00 00 00 
+  803f47:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803f49:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f4e:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803f52:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f57:	48 b8 30 14 80 00 00 	movabs $0x801430,%rax
+  803f5e:	00 00 00 
+  803f61:	ff d0                	call   *%rax
+}
+  803f63:	89 d8                	mov    %ebx,%eax
+  803f65:	48 83 c4 18          	add    $0x18,%rsp
+  803f69:	5b                   	pop    %rbx
+  803f6a:	41 5c                	pop    %r12
+  803f6c:	41 5d                	pop    %r13
+  803f6e:	5d                   	pop    %rbp
+  803f6f:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803f70:	48 b9 f0 51 80 00 00 	movabs $0x8051f0,%rcx
+  803f77:	00 00 00 
+  803f7a:	48 ba c7 51 80 00 00 	movabs $0x8051c7,%rdx
+  803f81:	00 00 00 
+  803f84:	be 50 00 00 00       	mov    $0x50,%esi
+  803f89:	48 bf dc 51 80 00 00 	movabs $0x8051dc,%rdi
+  803f90:	00 00 00 
+  803f93:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f98:	49 b8 b6 03 80 00 00 	movabs $0x8003b6,%r8
+  803f9f:	00 00 00 
+  803fa2:	41 ff d0             	call   *%r8
+
+0000000000803fa5 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803fa5:	55                   	push   %rbp
+  803fa6:	48 89 e5             	mov    %rsp,%rbp
+  803fa9:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803fad:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803fb1:	48 b8 6b 19 80 00 00 	movabs $0x80196b,%rax
+  803fb8:	00 00 00 
+  803fbb:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803fbd:	85 c0                	test   %eax,%eax
+  803fbf:	78 23                	js     803fe4 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803fc1:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803fc5:	48 b8 ef 18 80 00 00 	movabs $0x8018ef,%rax
+  803fcc:	00 00 00 
+  803fcf:	ff d0                	call   *%rax
+  803fd1:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  803fd4:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803fd8:	48 b8 e0 3a 80 00 00 	movabs $0x803ae0,%rax
+  803fdf:	00 00 00 
+  803fe2:	ff d0                	call   *%rax
+}
+  803fe4:	c9                   	leave
+  803fe5:	c3                   	ret
+
+0000000000803fe6 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803fe6:	48 89 f8             	mov    %rdi,%rax
+  803fe9:	48 c1 e8 27          	shr    $0x27,%rax
+  803fed:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803ff4:	01 00 00 
+  803ff7:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803ffb:	f6 c2 01             	test   $0x1,%dl
+  803ffe:	74 6d                	je     80406d <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804000:	48 89 f8             	mov    %rdi,%rax
+  804003:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804007:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80400e:	01 00 00 
+  804011:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804015:	f6 c2 01             	test   $0x1,%dl
+  804018:	74 62                	je     80407c <get_uvpt_entry+0x96>
+  80401a:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804021:	01 00 00 
+  804024:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804028:	f6 c2 80             	test   $0x80,%dl
+  80402b:	75 4f                	jne    80407c <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80402d:	48 89 f8             	mov    %rdi,%rax
+  804030:	48 c1 e8 15          	shr    $0x15,%rax
+  804034:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80403b:	01 00 00 
+  80403e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804042:	f6 c2 01             	test   $0x1,%dl
+  804045:	74 44                	je     80408b <get_uvpt_entry+0xa5>
+  804047:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80404e:	01 00 00 
+  804051:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804055:	f6 c2 80             	test   $0x80,%dl
+  804058:	75 31                	jne    80408b <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80405a:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80405e:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804065:	01 00 00 
+  804068:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80406c:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80406d:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804074:	01 00 00 
+  804077:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80407b:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80407c:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804083:	01 00 00 
+  804086:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80408a:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80408b:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804092:	01 00 00 
+  804095:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804099:	c3                   	ret
+
+000000000080409a <get_prot>:
+
+int
+get_prot(void *va) {
+  80409a:	55                   	push   %rbp
+  80409b:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80409e:	48 b8 e6 3f 80 00 00 	movabs $0x803fe6,%rax
+  8040a5:	00 00 00 
+  8040a8:	ff d0                	call   *%rax
+  8040aa:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8040ad:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8040b2:	89 c1                	mov    %eax,%ecx
+  8040b4:	83 c9 04             	or     $0x4,%ecx
+  8040b7:	f6 c2 01             	test   $0x1,%dl
+  8040ba:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8040bd:	89 c1                	mov    %eax,%ecx
+  8040bf:	83 c9 02             	or     $0x2,%ecx
+  8040c2:	f6 c2 02             	test   $0x2,%dl
+  8040c5:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8040c8:	89 c1                	mov    %eax,%ecx
+  8040ca:	83 c9 01             	or     $0x1,%ecx
+  8040cd:	48 85 d2             	test   %rdx,%rdx
+  8040d0:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8040d3:	89 c1                	mov    %eax,%ecx
+  8040d5:	83 c9 40             	or     $0x40,%ecx
+  8040d8:	f6 c6 04             	test   $0x4,%dh
+  8040db:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8040de:	5d                   	pop    %rbp
+  8040df:	c3                   	ret
+
+00000000008040e0 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8040e0:	55                   	push   %rbp
+  8040e1:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8040e4:	48 b8 e6 3f 80 00 00 	movabs $0x803fe6,%rax
+  8040eb:	00 00 00 
+  8040ee:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8040f0:	48 c1 e8 06          	shr    $0x6,%rax
+  8040f4:	83 e0 01             	and    $0x1,%eax
+}
+  8040f7:	5d                   	pop    %rbp
+  8040f8:	c3                   	ret
+
+00000000008040f9 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8040f9:	55                   	push   %rbp
+  8040fa:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8040fd:	48 b8 e6 3f 80 00 00 	movabs $0x803fe6,%rax
+  804104:	00 00 00 
+  804107:	ff d0                	call   *%rax
+  804109:	83 e0 01             	and    $0x1,%eax
+}
+  80410c:	5d                   	pop    %rbp
+  80410d:	c3                   	ret
+
+000000000080410e <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  80410e:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  804115:	01 00 00 
+  804118:	a8 01                	test   $0x1,%al
+  80411a:	75 06                	jne    804122 <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  80411c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804121:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804122:	55                   	push   %rbp
+  804123:	48 89 e5             	mov    %rsp,%rbp
+  804126:	41 57                	push   %r15
+  804128:	41 56                	push   %r14
+  80412a:	41 55                	push   %r13
+  80412c:	41 54                	push   %r12
+  80412e:	53                   	push   %rbx
+  80412f:	48 83 ec 28          	sub    $0x28,%rsp
+  804133:	49 89 fe             	mov    %rdi,%r14
+  804136:	49 89 f7             	mov    %rsi,%r15
+  804139:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  804140:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  804141:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  804148:	01 00 00 
+  80414b:	e9 ae 00 00 00       	jmp    8041fe <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  804150:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804157:	49 83 ec 01          	sub    $0x1,%r12
+  80415b:	74 2d                	je     80418a <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  80415d:	48 89 d8             	mov    %rbx,%rax
+  804160:	48 c1 e8 0c          	shr    $0xc,%rax
+  804164:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  804169:	f6 c2 01             	test   $0x1,%dl
+  80416c:	74 e2                	je     804150 <foreach_shared_region+0x42>
+  80416e:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  804173:	f6 c4 04             	test   $0x4,%ah
+  804176:	74 d8                	je     804150 <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  804178:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  80417f:	4c 89 fa             	mov    %r15,%rdx
+  804182:	48 89 df             	mov    %rbx,%rdi
+  804185:	41 ff d6             	call   *%r14
+  804188:	eb c6                	jmp    804150 <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  80418a:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  804191:	00 
+  804192:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  804197:	74 4a                	je     8041e3 <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  804199:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80419d:	48 c1 e8 15          	shr    $0x15,%rax
+  8041a1:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  8041a8:	01 00 00 
+  8041ab:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  8041af:	a8 01                	test   $0x1,%al
+  8041b1:	74 d7                	je     80418a <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  8041b3:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  8041b7:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  8041be:	48 39 c3             	cmp    %rax,%rbx
+  8041c1:	73 c7                	jae    80418a <foreach_shared_region+0x7c>
+  8041c3:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  8041ca:	48 39 d0             	cmp    %rdx,%rax
+  8041cd:	4d 19 e4             	sbb    %r12,%r12
+  8041d0:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  8041d7:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  8041de:	e9 7a ff ff ff       	jmp    80415d <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  8041e3:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  8041ea:	40 
+  8041eb:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8041ef:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8041f6:	00 00 00 
+  8041f9:	48 39 c1             	cmp    %rax,%rcx
+  8041fc:	74 50                	je     80424e <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  8041fe:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804202:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804206:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  80420d:	01 00 00 
+  804210:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804214:	a8 01                	test   $0x1,%al
+  804216:	74 cb                	je     8041e3 <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  804218:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80421c:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  804223:	48 39 c1             	cmp    %rax,%rcx
+  804226:	73 bb                	jae    8041e3 <foreach_shared_region+0xd5>
+  804228:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  80422f:	48 39 d0             	cmp    %rdx,%rax
+  804232:	48 19 c0             	sbb    %rax,%rax
+  804235:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  80423b:	48 05 00 02 00 00    	add    $0x200,%rax
+  804241:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804245:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  804249:	e9 4b ff ff ff       	jmp    804199 <foreach_shared_region+0x8b>
+  80424e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804253:	48 83 c4 28          	add    $0x28,%rsp
+  804257:	5b                   	pop    %rbx
+  804258:	41 5c                	pop    %r12
+  80425a:	41 5d                	pop    %r13
+  80425c:	41 5e                	pop    %r14
+  80425e:	41 5f                	pop    %r15
+  804260:	5d                   	pop    %rbp
+  804261:	c3                   	ret
+
+0000000000804262 <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  804262:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  804268:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  80426f:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  804276:	c3                   	ret
+
+0000000000804277 <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  804277:	8b 47 40             	mov    0x40(%rdi),%eax
+  80427a:	8b 17                	mov    (%rdi),%edx
+  80427c:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  80427e:	83 f8 0f             	cmp    $0xf,%eax
+  804281:	77 13                	ja     804296 <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  804283:	8b 47 40             	mov    0x40(%rdi),%eax
+  804286:	83 e0 0f             	and    $0xf,%eax
+  804289:	48 c1 e0 09          	shl    $0x9,%rax
+  80428d:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  804294:	00 
+  804295:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  804296:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80429b:	c3                   	ret
+
+000000000080429c <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  80429c:	8b 47 40             	mov    0x40(%rdi),%eax
+  80429f:	83 c0 01             	add    $0x1,%eax
+  8042a2:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8042a5:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  8042ab:	8b 57 04             	mov    0x4(%rdi),%edx
+  8042ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042b3:	85 d2                	test   %edx,%edx
+  8042b5:	75 04                	jne    8042bb <chan_publish+0x1f>
+  8042b7:	83 e0 01             	and    $0x1,%eax
+}
+  8042ba:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  8042bb:	87 47 04             	xchg   %eax,0x4(%rdi)
+  8042be:	85 c0                	test   %eax,%eax
+  8042c0:	0f 95 c0             	setne  %al
+  8042c3:	0f b6 c0             	movzbl %al,%eax
+  8042c6:	eb ef                	jmp    8042b7 <chan_publish+0x1b>
+
+00000000008042c8 <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  8042c8:	8b 47 40             	mov    0x40(%rdi),%eax
+  8042cb:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  8042cd:	29 d0                	sub    %edx,%eax
+  8042cf:	83 e8 01             	sub    $0x1,%eax
+  8042d2:	83 f8 0f             	cmp    $0xf,%eax
+  8042d5:	77 12                	ja     8042e9 <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  8042d7:	8b 07                	mov    (%rdi),%eax
+  8042d9:	83 e0 0f             	and    $0xf,%eax
+  8042dc:	48 c1 e0 09          	shl    $0x9,%rax
+  8042e0:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  8042e7:	00 
+  8042e8:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  8042e9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8042ee:	c3                   	ret
+
+00000000008042ef <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  8042ef:	8b 07                	mov    (%rdi),%eax
+  8042f1:	83 c0 01             	add    $0x1,%eax
+  8042f4:	89 07                	mov    %eax,(%rdi)
+}
+  8042f6:	c3                   	ret
+
+00000000008042f7 <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  8042f7:	55                   	push   %rbp
+  8042f8:	48 89 e5             	mov    %rsp,%rbp
+  8042fb:	53                   	push   %rbx
+  8042fc:	48 83 ec 08          	sub    $0x8,%rsp
+  804300:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  804303:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  80430a:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  804310:	48 b8 c8 42 80 00 00 	movabs $0x8042c8,%rax
+  804317:	00 00 00 
+  80431a:	ff d0                	call   *%rax
+  80431c:	48 85 c0             	test   %rax,%rax
+  80431f:	74 12                	je     804333 <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  804321:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  804328:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80432d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804331:	c9                   	leave
+  804332:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  804333:	b8 01 00 00 00       	mov    $0x1,%eax
+  804338:	eb f3                	jmp    80432d <chan_arm+0x36>
+
+000000000080433a <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  80433a:	55                   	push   %rbp
+  80433b:	48 89 e5             	mov    %rsp,%rbp
+  80433e:	41 56                	push   %r14
+  804340:	41 55                	push   %r13
+  804342:	41 54                	push   %r12
+  804344:	53                   	push   %rbx
+  804345:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  804348:	49 bc f7 42 80 00 00 	movabs $0x8042f7,%r12
+  80434f:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  804352:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  804356:	49 bd f8 16 80 00 00 	movabs $0x8016f8,%r13
+  80435d:	00 00 00 
+    while (chan_arm(r))
+  804360:	eb 0d                	jmp    80436f <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  804362:	8b 33                	mov    (%rbx),%esi
+  804364:	ba 00 00 00 00       	mov    $0x0,%edx
+  804369:	4c 89 f7             	mov    %r14,%rdi
+  80436c:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  80436f:	48 89 df             	mov    %rbx,%rdi
+  804372:	41 ff d4             	call   *%r12
+  804375:	84 c0                	test   %al,%al
+  804377:	75 e9                	jne    804362 <chan_wait+0x28>
+}
+  804379:	5b                   	pop    %rbx
+  80437a:	41 5c                	pop    %r12
+  80437c:	41 5d                	pop    %r13
+  80437e:	41 5e                	pop    %r14
+  804380:	5d                   	pop    %rbp
+  804381:	c3                   	ret
+
+0000000000804382 <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  804382:	55                   	push   %rbp
+  804383:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  804386:	48 83 c7 40          	add    $0x40,%rdi
+  80438a:	be 01 00 00 00       	mov    $0x1,%esi
+  80438f:	48 b8 16 17 80 00 00 	movabs $0x801716,%rax
+  804396:	00 00 00 
+  804399:	ff d0                	call   *%rax
+}
+  80439b:	5d                   	pop    %rbp
+  80439c:	c3                   	ret
+
+000000000080439d <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80439d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043a2:	c3                   	ret
+
+00000000008043a3 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8043a3:	55                   	push   %rbp
+  8043a4:	48 89 e5             	mov    %rsp,%rbp
+  8043a7:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8043aa:	48 be 14 52 80 00 00 	movabs $0x805214,%rsi
+  8043b1:	00 00 00 
+  8043b4:	48 b8 2b 0e 80 00 00 	movabs $0x800e2b,%rax
+  8043bb:	00 00 00 
+  8043be:	ff d0                	call   *%rax
+    return 0;
+}
+  8043c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043c5:	5d                   	pop    %rbp
+  8043c6:	c3                   	ret
+
+00000000008043c7 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8043c7:	55                   	push   %rbp
+  8043c8:	48 89 e5             	mov    %rsp,%rbp
+  8043cb:	41 57                	push   %r15
+  8043cd:	41 56                	push   %r14
+  8043cf:	41 55                	push   %r13
+  8043d1:	41 54                	push   %r12
+  8043d3:	53                   	push   %rbx
+  8043d4:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8043db:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8043e2:	48 85 d2             	test   %rdx,%rdx
+  8043e5:	74 7a                	je     804461 <devcons_write+0x9a>
+  8043e7:	49 89 d6             	mov    %rdx,%r14
+  8043ea:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8043f0:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8043f5:	49 bf 25 10 80 00 00 	movabs $0x801025,%r15
+  8043fc:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8043ff:	4c 89 f3             	mov    %r14,%rbx
+  804402:	48 29 f3             	sub    %rsi,%rbx
+  804405:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80440a:	48 39 c3             	cmp    %rax,%rbx
+  80440d:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804411:	4c 63 eb             	movslq %ebx,%r13
+  804414:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80441b:	48 01 c6             	add    %rax,%rsi
+  80441e:	4c 89 ea             	mov    %r13,%rdx
+  804421:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804428:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80442b:	4c 89 ee             	mov    %r13,%rsi
+  80442e:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804435:	48 b8 52 12 80 00 00 	movabs $0x801252,%rax
+  80443c:	00 00 00 
+  80443f:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804441:	41 01 dc             	add    %ebx,%r12d
+  804444:	49 63 f4             	movslq %r12d,%rsi
+  804447:	4c 39 f6             	cmp    %r14,%rsi
+  80444a:	72 b3                	jb     8043ff <devcons_write+0x38>
+    return res;
+  80444c:	49 63 c4             	movslq %r12d,%rax
+}
+  80444f:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804456:	5b                   	pop    %rbx
+  804457:	41 5c                	pop    %r12
+  804459:	41 5d                	pop    %r13
+  80445b:	41 5e                	pop    %r14
+  80445d:	41 5f                	pop    %r15
+  80445f:	5d                   	pop    %rbp
+  804460:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804461:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804467:	eb e3                	jmp    80444c <devcons_write+0x85>
+
+0000000000804469 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804469:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80446c:	ba 00 00 00 00       	mov    $0x0,%edx
+  804471:	48 85 c0             	test   %rax,%rax
+  804474:	74 55                	je     8044cb <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804476:	55                   	push   %rbp
+  804477:	48 89 e5             	mov    %rsp,%rbp
+  80447a:	41 55                	push   %r13
+  80447c:	41 54                	push   %r12
+  80447e:	53                   	push   %rbx
+  80447f:	48 83 ec 08          	sub    $0x8,%rsp
+  804483:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  804486:	48 bb 71 12 80 00 00 	movabs $0x801271,%rbx
+  80448d:	00 00 00 
+  804490:	49 bc 26 13 80 00 00 	movabs $0x801326,%r12
+  804497:	00 00 00 
+  80449a:	eb 03                	jmp    80449f <devcons_read+0x36>
+  80449c:	41 ff d4             	call   *%r12
+  80449f:	ff d3                	call   *%rbx
+  8044a1:	85 c0                	test   %eax,%eax
+  8044a3:	74 f7                	je     80449c <devcons_read+0x33>
+    if (c < 0) return c;
+  8044a5:	48 63 d0             	movslq %eax,%rdx
+  8044a8:	78 13                	js     8044bd <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8044aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8044af:	83 f8 04             	cmp    $0x4,%eax
+  8044b2:	74 09                	je     8044bd <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8044b4:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8044b8:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8044bd:	48 89 d0             	mov    %rdx,%rax
+  8044c0:	48 83 c4 08          	add    $0x8,%rsp
+  8044c4:	5b                   	pop    %rbx
+  8044c5:	41 5c                	pop    %r12
+  8044c7:	41 5d                	pop    %r13
+  8044c9:	5d                   	pop    %rbp
+  8044ca:	c3                   	ret
+  8044cb:	48 89 d0             	mov    %rdx,%rax
+  8044ce:	c3                   	ret
+
+00000000008044cf <cputchar>:
+cputchar(int ch) {
+  8044cf:	55                   	push   %rbp
+  8044d0:	48 89 e5             	mov    %rsp,%rbp
+  8044d3:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8044d7:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8044db:	be 01 00 00 00       	mov    $0x1,%esi
+  8044e0:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8044e4:	48 b8 52 12 80 00 00 	movabs $0x801252,%rax
+  8044eb:	00 00 00 
+  8044ee:	ff d0                	call   *%rax
+}
+  8044f0:	c9                   	leave
+  8044f1:	c3                   	ret
+
+00000000008044f2 <getchar>:
+getchar(void) {
+  8044f2:	55                   	push   %rbp
+  8044f3:	48 89 e5             	mov    %rsp,%rbp
+  8044f6:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8044fa:	ba 01 00 00 00       	mov    $0x1,%edx
+  8044ff:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  804503:	bf 00 00 00 00       	mov    $0x0,%edi
+  804508:	48 b8 4e 1c 80 00 00 	movabs $0x801c4e,%rax
+  80450f:	00 00 00 
+  804512:	ff d0                	call   *%rax
+  804514:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  804516:	85 c0                	test   %eax,%eax
+  804518:	78 06                	js     804520 <getchar+0x2e>
+  80451a:	74 08                	je     804524 <getchar+0x32>
+  80451c:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804520:	89 d0                	mov    %edx,%eax
+  804522:	c9                   	leave
+  804523:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  804524:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  804529:	eb f5                	jmp    804520 <getchar+0x2e>
+
+000000000080452b <iscons>:
+iscons(int fdnum) {
+  80452b:	55                   	push   %rbp
+  80452c:	48 89 e5             	mov    %rsp,%rbp
+  80452f:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804533:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804537:	48 b8 6b 19 80 00 00 	movabs $0x80196b,%rax
+  80453e:	00 00 00 
+  804541:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804543:	85 c0                	test   %eax,%eax
+  804545:	78 18                	js     80455f <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  804547:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80454b:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  804552:	00 00 00 
+  804555:	8b 00                	mov    (%rax),%eax
+  804557:	39 02                	cmp    %eax,(%rdx)
+  804559:	0f 94 c0             	sete   %al
+  80455c:	0f b6 c0             	movzbl %al,%eax
+}
+  80455f:	c9                   	leave
+  804560:	c3                   	ret
+
+0000000000804561 <opencons>:
+opencons(void) {
+  804561:	55                   	push   %rbp
+  804562:	48 89 e5             	mov    %rsp,%rbp
+  804565:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  804569:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80456d:	48 b8 0b 19 80 00 00 	movabs $0x80190b,%rax
+  804574:	00 00 00 
+  804577:	ff d0                	call   *%rax
+  804579:	85 c0                	test   %eax,%eax
+  80457b:	78 49                	js     8045c6 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80457d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804582:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804587:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80458b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804590:	48 b8 8a 13 80 00 00 	movabs $0x80138a,%rax
+  804597:	00 00 00 
+  80459a:	ff d0                	call   *%rax
+  80459c:	85 c0                	test   %eax,%eax
+  80459e:	78 26                	js     8045c6 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8045a0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8045a4:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  8045ab:	00 00 
+  8045ad:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8045af:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8045b3:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8045ba:	48 b8 dd 18 80 00 00 	movabs $0x8018dd,%rax
+  8045c1:	00 00 00 
+  8045c4:	ff d0                	call   *%rax
+}
+  8045c6:	c9                   	leave
+  8045c7:	c3                   	ret
+
+00000000008045c8 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  8045c8:	55                   	push   %rbp
+  8045c9:	48 89 e5             	mov    %rsp,%rbp
+  8045cc:	41 56                	push   %r14
+  8045ce:	41 55                	push   %r13
+  8045d0:	41 54                	push   %r12
+  8045d2:	53                   	push   %rbx
+  8045d3:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8045d6:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  8045dd:	00 00 00 
+  8045e0:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8045e4:	74 27                	je     80460d <_handle_vectored_pagefault+0x45>
+  8045e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  8045eb:	49 bd 00 10 84 00 00 	movabs $0x841000,%r13
+  8045f2:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8045f5:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  8045f8:	4c 89 e7             	mov    %r12,%rdi
+  8045fb:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  804600:	84 c0                	test   %al,%al
+  804602:	75 45                	jne    804649 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804604:	48 83 c3 01          	add    $0x1,%rbx
+  804608:	49 3b 1e             	cmp    (%r14),%rbx
+  80460b:	72 eb                	jb     8045f8 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  80460d:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  804614:	00 
+  804615:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  80461a:	4d 8b 04 24          	mov    (%r12),%r8
+  80461e:	48 ba 20 52 80 00 00 	movabs $0x805220,%rdx
+  804625:	00 00 00 
+  804628:	be 1d 00 00 00       	mov    $0x1d,%esi
+  80462d:	48 bf 50 52 80 00 00 	movabs $0x805250,%rdi
+  804634:	00 00 00 
+  804637:	b8 00 00 00 00       	mov    $0x0,%eax
+  80463c:	49 ba b6 03 80 00 00 	movabs $0x8003b6,%r10
+  804643:	00 00 00 
+  804646:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  804649:	5b                   	pop    %rbx
+  80464a:	41 5c                	pop    %r12
+  80464c:	41 5d                	pop    %r13
+  80464e:	41 5e                	pop    %r14
+  804650:	5d                   	pop    %rbp
+  804651:	c3                   	ret
+
+0000000000804652 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  804652:	55                   	push   %rbp
+  804653:	48 89 e5             	mov    %rsp,%rbp
+  804656:	53                   	push   %rbx
+  804657:	48 83 ec 08          	sub    $0x8,%rsp
+  80465b:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  80465e:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  804665:	00 00 00 
+  804668:	80 38 00             	cmpb   $0x0,(%rax)
+  80466b:	0f 84 84 00 00 00    	je     8046f5 <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804671:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  804678:	00 00 00 
+  80467b:	48 8b 10             	mov    (%rax),%rdx
+  80467e:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  804683:	48 b9 00 10 84 00 00 	movabs $0x841000,%rcx
+  80468a:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80468d:	48 85 d2             	test   %rdx,%rdx
+  804690:	74 19                	je     8046ab <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  804692:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  804696:	0f 84 e8 00 00 00    	je     804784 <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80469c:	48 83 c0 01          	add    $0x1,%rax
+  8046a0:	48 39 d0             	cmp    %rdx,%rax
+  8046a3:	75 ed                	jne    804692 <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  8046a5:	48 83 fa 08          	cmp    $0x8,%rdx
+  8046a9:	74 1c                	je     8046c7 <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8046ab:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8046af:	48 a3 48 10 84 00 00 	movabs %rax,0x841048
+  8046b6:	00 00 00 
+  8046b9:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  8046c0:	00 00 00 
+  8046c3:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  8046c7:	48 b8 fd 12 80 00 00 	movabs $0x8012fd,%rax
+  8046ce:	00 00 00 
+  8046d1:	ff d0                	call   *%rax
+  8046d3:	89 c7                	mov    %eax,%edi
+  8046d5:	48 be 4a 48 80 00 00 	movabs $0x80484a,%rsi
+  8046dc:	00 00 00 
+  8046df:	48 b8 48 15 80 00 00 	movabs $0x801548,%rax
+  8046e6:	00 00 00 
+  8046e9:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8046eb:	85 c0                	test   %eax,%eax
+  8046ed:	78 68                	js     804757 <add_pgfault_handler+0x105>
+    return res;
+}
+  8046ef:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8046f3:	c9                   	leave
+  8046f4:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  8046f5:	48 b8 fd 12 80 00 00 	movabs $0x8012fd,%rax
+  8046fc:	00 00 00 
+  8046ff:	ff d0                	call   *%rax
+  804701:	89 c7                	mov    %eax,%edi
+  804703:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804708:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80470d:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  804714:	00 00 00 
+  804717:	48 b8 8a 13 80 00 00 	movabs $0x80138a,%rax
+  80471e:	00 00 00 
+  804721:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  804723:	48 ba 48 10 84 00 00 	movabs $0x841048,%rdx
+  80472a:	00 00 00 
+  80472d:	48 8b 02             	mov    (%rdx),%rax
+  804730:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804734:	48 89 0a             	mov    %rcx,(%rdx)
+  804737:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  80473e:	00 00 00 
+  804741:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  804745:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  80474c:	00 00 00 
+  80474f:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  804752:	e9 70 ff ff ff       	jmp    8046c7 <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  804757:	89 c1                	mov    %eax,%ecx
+  804759:	48 ba 5e 52 80 00 00 	movabs $0x80525e,%rdx
+  804760:	00 00 00 
+  804763:	be 3d 00 00 00       	mov    $0x3d,%esi
+  804768:	48 bf 50 52 80 00 00 	movabs $0x805250,%rdi
+  80476f:	00 00 00 
+  804772:	b8 00 00 00 00       	mov    $0x0,%eax
+  804777:	49 b8 b6 03 80 00 00 	movabs $0x8003b6,%r8
+  80477e:	00 00 00 
+  804781:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  804784:	b8 00 00 00 00       	mov    $0x0,%eax
+  804789:	e9 61 ff ff ff       	jmp    8046ef <add_pgfault_handler+0x9d>
+
+000000000080478e <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  80478e:	55                   	push   %rbp
+  80478f:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  804792:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  804799:	00 00 00 
+  80479c:	80 38 00             	cmpb   $0x0,(%rax)
+  80479f:	74 33                	je     8047d4 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8047a1:	48 a1 48 10 84 00 00 	movabs 0x841048,%rax
+  8047a8:	00 00 00 
+  8047ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  8047b0:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  8047b7:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8047ba:	48 85 c0             	test   %rax,%rax
+  8047bd:	0f 84 85 00 00 00    	je     804848 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  8047c3:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  8047c7:	74 40                	je     804809 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8047c9:	48 83 c1 01          	add    $0x1,%rcx
+  8047cd:	48 39 c1             	cmp    %rax,%rcx
+  8047d0:	75 f1                	jne    8047c3 <remove_pgfault_handler+0x35>
+  8047d2:	eb 74                	jmp    804848 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  8047d4:	48 b9 76 52 80 00 00 	movabs $0x805276,%rcx
+  8047db:	00 00 00 
+  8047de:	48 ba c7 51 80 00 00 	movabs $0x8051c7,%rdx
+  8047e5:	00 00 00 
+  8047e8:	be 43 00 00 00       	mov    $0x43,%esi
+  8047ed:	48 bf 50 52 80 00 00 	movabs $0x805250,%rdi
+  8047f4:	00 00 00 
+  8047f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047fc:	49 b8 b6 03 80 00 00 	movabs $0x8003b6,%r8
+  804803:	00 00 00 
+  804806:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  804809:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  804810:	00 
+  804811:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804815:	48 29 ca             	sub    %rcx,%rdx
+  804818:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  80481f:	00 00 00 
+  804822:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  804826:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  80482b:	48 89 ce             	mov    %rcx,%rsi
+  80482e:	48 b8 25 10 80 00 00 	movabs $0x801025,%rax
+  804835:	00 00 00 
+  804838:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  80483a:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  804841:	00 00 00 
+  804844:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  804848:	5d                   	pop    %rbp
+  804849:	c3                   	ret
+
+000000000080484a <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  80484a:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  80484d:	48 b8 c8 45 80 00 00 	movabs $0x8045c8,%rax
+  804854:	00 00 00 
+    call *%rax
+  804857:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  804859:	41 5f                	pop    %r15
+	popq %r15
+  80485b:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  80485d:	41 5f                	pop    %r15
+	popq %r14
+  80485f:	41 5e                	pop    %r14
+	popq %r13
+  804861:	41 5d                	pop    %r13
+	popq %r12
+  804863:	41 5c                	pop    %r12
+	popq %r11
+  804865:	41 5b                	pop    %r11
+	popq %r10
+  804867:	41 5a                	pop    %r10
+	popq %r9
+  804869:	41 59                	pop    %r9
+	popq %r8
+  80486b:	41 58                	pop    %r8
+	popq %rsi
+  80486d:	5e                   	pop    %rsi
+	popq %rdi
+  80486e:	5f                   	pop    %rdi
+	popq %rbp
+  80486f:	5d                   	pop    %rbp
+	popq %rdx
+  804870:	5a                   	pop    %rdx
+	popq %rcx
+  804871:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  804872:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  804877:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  80487c:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  804880:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  804883:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  804888:	5b                   	pop    %rbx
+	popq %rax
+  804889:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  80488a:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  80488e:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  80488f:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  804894:	c3                   	ret
+
+0000000000804895 <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  804895:	55                   	push   %rbp
+  804896:	48 89 e5             	mov    %rsp,%rbp
+  804899:	41 55                	push   %r13
+  80489b:	41 54                	push   %r12
+  80489d:	53                   	push   %rbx
+  80489e:	48 83 ec 08          	sub    $0x8,%rsp
+  8048a2:	49 89 fd             	mov    %rdi,%r13
+  8048a5:	48 89 f7             	mov    %rsi,%rdi
+  8048a8:	48 89 d3             	mov    %rdx,%rbx
+  8048ab:	49 89 cc             	mov    %rcx,%r12
+  8048ae:	4c 89 c2             	mov    %r8,%rdx
+  8048b1:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8048b4:	48 85 f6             	test   %rsi,%rsi
+  8048b7:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8048be:	00 00 00 
+  8048c1:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  8048c5:	be 00 10 00 00       	mov    $0x1000,%esi
+  8048ca:	48 85 db             	test   %rbx,%rbx
+  8048cd:	74 03                	je     8048d2 <ipc_recv_futex+0x3d>
+  8048cf:	48 8b 33             	mov    (%rbx),%rsi
+  8048d2:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  8048d6:	48 b8 d4 15 80 00 00 	movabs $0x8015d4,%rax
+  8048dd:	00 00 00 
+  8048e0:	ff d0                	call   *%rax
+    if (res < 0) {
+  8048e2:	85 c0                	test   %eax,%eax
+  8048e4:	78 75                	js     80495b <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  8048e6:	4d 85 ed             	test   %r13,%r13
+  8048e9:	74 14                	je     8048ff <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  8048eb:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8048f2:	00 00 00 
+  8048f5:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  8048fb:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  8048ff:	4d 85 e4             	test   %r12,%r12
+  804902:	74 14                	je     804918 <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  804904:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80490b:	00 00 00 
+  80490e:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  804914:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  804918:	48 85 db             	test   %rbx,%rbx
+  80491b:	74 23                	je     804940 <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  80491d:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804924:	00 00 00 
+  804927:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  80492d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804932:	85 c9                	test   %ecx,%ecx
+  804934:	74 07                	je     80493d <ipc_recv_futex+0xa8>
+  804936:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  80493d:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  804940:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804947:	00 00 00 
+  80494a:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  804950:	48 83 c4 08          	add    $0x8,%rsp
+  804954:	5b                   	pop    %rbx
+  804955:	41 5c                	pop    %r12
+  804957:	41 5d                	pop    %r13
+  804959:	5d                   	pop    %rbp
+  80495a:	c3                   	ret
+        if (from_env_store != NULL) {
+  80495b:	4d 85 ed             	test   %r13,%r13
+  80495e:	74 08                	je     804968 <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  804960:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804967:	00 
+        if (perm_store != NULL) {
+  804968:	4d 85 e4             	test   %r12,%r12
+  80496b:	74 08                	je     804975 <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  80496d:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804974:	00 
+        if (size != NULL) {
+  804975:	48 85 db             	test   %rbx,%rbx
+  804978:	74 d6                	je     804950 <ipc_recv_futex+0xbb>
+            *size = 0;
+  80497a:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  804981:	eb cd                	jmp    804950 <ipc_recv_futex+0xbb>
+
+0000000000804983 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804983:	55                   	push   %rbp
+  804984:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  804987:	48 83 ec 08          	sub    $0x8,%rsp
+  80498b:	6a 00                	push   $0x0
+  80498d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804993:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804999:	48 b8 95 48 80 00 00 	movabs $0x804895,%rax
+  8049a0:	00 00 00 
+  8049a3:	ff d0                	call   *%rax
+}
+  8049a5:	c9                   	leave
+  8049a6:	c3                   	ret
+
+00000000008049a7 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8049a7:	55                   	push   %rbp
+  8049a8:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8049ab:	48 85 d2             	test   %rdx,%rdx
+  8049ae:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8049b5:	00 00 00 
+  8049b8:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  8049bc:	89 f6                	mov    %esi,%esi
+  8049be:	48 b8 bd 15 80 00 00 	movabs $0x8015bd,%rax
+  8049c5:	00 00 00 
+  8049c8:	ff d0                	call   *%rax
+    if (res < 0) {
+  8049ca:	85 c0                	test   %eax,%eax
+  8049cc:	78 02                	js     8049d0 <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  8049ce:	5d                   	pop    %rbp
+  8049cf:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  8049d0:	89 c1                	mov    %eax,%ecx
+  8049d2:	48 ba 90 52 80 00 00 	movabs $0x805290,%rdx
+  8049d9:	00 00 00 
+  8049dc:	be 50 00 00 00       	mov    $0x50,%esi
+  8049e1:	48 bf a4 52 80 00 00 	movabs $0x8052a4,%rdi
+  8049e8:	00 00 00 
+  8049eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049f0:	49 b8 b6 03 80 00 00 	movabs $0x8003b6,%r8
+  8049f7:	00 00 00 
+  8049fa:	41 ff d0             	call   *%r8
+
+00000000008049fd <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8049fd:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  804a02:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804a09:	00 00 00 
+  804a0c:	48 89 d0             	mov    %rdx,%rax
+  804a0f:	48 c1 e0 04          	shl    $0x4,%rax
+  804a13:	48 29 d0             	sub    %rdx,%rax
+  804a16:	48 c1 e0 05          	shl    $0x5,%rax
+  804a1a:	48 01 c8             	add    %rcx,%rax
+  804a1d:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  804a23:	39 f8                	cmp    %edi,%eax
+  804a25:	74 13                	je     804a3a <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  804a27:	48 83 c2 01          	add    $0x1,%rdx
+  804a2b:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  804a32:	75 d8                	jne    804a0c <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804a34:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804a39:	c3                   	ret
+            return envs[i].env_id;
+  804a3a:	48 89 d0             	mov    %rdx,%rax
+  804a3d:	48 c1 e0 04          	shl    $0x4,%rax
+  804a41:	48 29 d0             	sub    %rdx,%rax
+  804a44:	48 c1 e0 05          	shl    $0x5,%rax
+  804a48:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804a4f:	00 00 00 
+  804a52:	48 01 d0             	add    %rdx,%rax
+  804a55:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804a5b:	c3                   	ret
+  804a5c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000804a60 <__rodata_start>:
+  804a60:	74 65                	je     804ac7 <__rodata_start+0x67>
+  804a62:	73 74                	jae    804ad8 <__rodata_start+0x78>
+  804a64:	69 6e 67 20 66 6f 72 	imul   $0x726f6620,0x67(%rsi),%ebp
+  804a6b:	20 70 69             	and    %dh,0x69(%rax)
+  804a6e:	70 65                	jo     804ad5 <__rodata_start+0x75>
+  804a70:	69 73 63 6c 6f 73 65 	imul   $0x65736f6c,0x63(%rbx),%esi
+  804a77:	64 20 72 61          	and    %dh,%fs:0x61(%rdx)
+  804a7b:	63 65 2e             	movsxd 0x2e(%rbp),%esp
+  804a7e:	2e 2e 0a 00          	cs cs or (%rax),%al
+  804a82:	00 00                	add    %al,(%rax)
+  804a84:	00 00                	add    %al,(%rax)
+  804a86:	00 00                	add    %al,(%rax)
+  804a88:	73 6f                	jae    804af9 <__rodata_start+0x99>
+  804a8a:	6d                   	insl   (%dx),%es:(%rdi)
+  804a8b:	65 68 6f 77 20 74    	gs push $0x7420776f
+  804a91:	68 65 20 6f 74       	push   $0x746f2065
+  804a96:	68 65 72 20 65       	push   $0x65207265
+  804a9b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a9c:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  804aa0:	20 70 5b             	and    %dh,0x5b(%rax)
+  804aa3:	30 5d 20             	xor    %bl,0x20(%rbp)
+  804aa6:	67 6f                	outsl  %ds:(%esi),(%dx)
+  804aa8:	74 20                	je     804aca <__rodata_start+0x6a>
+  804aaa:	63 6c 6f 73          	movsxd 0x73(%rdi,%rbp,2),%ebp
+  804aae:	65 64 21 00          	gs and %eax,%fs:(%rax)
+  804ab2:	70 69                	jo     804b1d <__rodata_start+0xbd>
+  804ab4:	70 65                	jo     804b1b <__rodata_start+0xbb>
+  804ab6:	3a 20                	cmp    (%rax),%ah
+  804ab8:	25 69 00 75 73       	and    $0x73750069,%eax
+  804abd:	65 72 2f             	gs jb  804aef <__rodata_start+0x8f>
+  804ac0:	74 65                	je     804b27 <__rodata_start+0xc7>
+  804ac2:	73 74                	jae    804b38 <__rodata_start+0xd8>
+  804ac4:	70 69                	jo     804b2f <__rodata_start+0xcf>
+  804ac6:	70 65                	jo     804b2d <__rodata_start+0xcd>
+  804ac8:	72 61                	jb     804b2b <__rodata_start+0xcb>
+  804aca:	63 65 32             	movsxd 0x32(%rbp),%esp
+  804acd:	2e 63 00             	cs movsxd (%rax),%eax
+  804ad0:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804ad2:	72 6b                	jb     804b3f <__rodata_start+0xdf>
+  804ad4:	3a 20                	cmp    (%rax),%ah
+  804ad6:	25 69 00 25 64       	and    $0x64250069,%eax
+  804adb:	2e 00 0a             	cs add %cl,(%rdx)
+  804ade:	52                   	push   %rdx
+  804adf:	41                   	rex.B
+  804ae0:	43                   	rex.XB
+  804ae1:	45 3a 20             	cmp    (%r8),%r12b
+  804ae4:	70 69                	jo     804b4f <__rodata_start+0xef>
+  804ae6:	70 65                	jo     804b4d <__rodata_start+0xed>
+  804ae8:	20 61 70             	and    %ah,0x70(%rcx)
+  804aeb:	70 65                	jo     804b52 <__rodata_start+0xf2>
+  804aed:	61                   	(bad)
+  804aee:	72 73                	jb     804b63 <__rodata_start+0x103>
+  804af0:	20 63 6c             	and    %ah,0x6c(%rbx)
+  804af3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804af4:	73 65                	jae    804b5b <__rodata_start+0xfb>
+  804af6:	64 0a 00             	or     %fs:(%rax),%al
+  804af9:	63 68 69             	movsxd 0x69(%rax),%ebp
+  804afc:	6c                   	insb   (%dx),%es:(%rdi)
+  804afd:	64 20 64 6f 6e       	and    %ah,%fs:0x6e(%rdi,%rbp,2)
+  804b02:	65 20 77 69          	and    %dh,%gs:0x69(%rdi)
+  804b06:	74 68                	je     804b70 <__rodata_start+0x110>
+  804b08:	20 6c 6f 6f          	and    %ch,0x6f(%rdi,%rbp,2)
+  804b0c:	70 0a                	jo     804b18 <__rodata_start+0xb8>
+  804b0e:	00 63 61             	add    %ah,0x61(%rbx)
+  804b11:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804b12:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804b13:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b14:	74 20                	je     804b36 <__rodata_start+0xd6>
+  804b16:	6c                   	insb   (%dx),%es:(%rdi)
+  804b17:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b18:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b19:	6b 20 75             	imul   $0x75,(%rax),%esp
+  804b1c:	70 20                	jo     804b3e <__rodata_start+0xde>
+  804b1e:	70 5b                	jo     804b7b <__rodata_start+0x11b>
+  804b20:	30 5d 3a             	xor    %bl,0x3a(%rbp)
+  804b23:	20 25 69 00 72 61    	and    %ah,0x61720069(%rip)        # 61f24b92 <__bss_end+0x616e2b92>
+  804b29:	63 65 20             	movsxd 0x20(%rbp),%esp
+  804b2c:	64 69 64 6e 27 74 20 	imul   $0x61682074,%fs:0x27(%rsi,%rbp,2),%esp
+  804b33:	68 61 
+  804b35:	70 70                	jo     804ba7 <__rodata_start+0x147>
+  804b37:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804b39:	0a 00                	or     (%rax),%al
+  804b3b:	3c 75                	cmp    $0x75,%al
+  804b3d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804b3e:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  804b42:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804b43:	3e 00 0f             	ds add %cl,(%rdi)
+  804b46:	1f                   	(bad)
+  804b47:	00 5b 25             	add    %bl,0x25(%rbx)
+  804b4a:	30 38                	xor    %bh,(%rax)
+  804b4c:	78 5d                	js     804bab <__rodata_start+0x14b>
+  804b4e:	20 75 73             	and    %dh,0x73(%rbp)
+  804b51:	65 72 20             	gs jb  804b74 <__rodata_start+0x114>
+  804b54:	70 61                	jo     804bb7 <__rodata_start+0x157>
+  804b56:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804b57:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  804b5e:	73 20                	jae    804b80 <__rodata_start+0x120>
+  804b60:	61                   	(bad)
+  804b61:	74 20                	je     804b83 <__rodata_start+0x123>
+  804b63:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  804b68:	3a 20                	cmp    (%rax),%ah
+  804b6a:	00 30                	add    %dh,(%rax)
+  804b6c:	31 32                	xor    %esi,(%rdx)
+  804b6e:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  804b75:	41                   	rex.B
+  804b76:	42                   	rex.X
+  804b77:	43                   	rex.XB
+  804b78:	44                   	rex.R
+  804b79:	45                   	rex.RB
+  804b7a:	46 00 30             	rex.RX add %r14b,(%rax)
+  804b7d:	31 32                	xor    %esi,(%rdx)
+  804b7f:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  804b86:	61                   	(bad)
+  804b87:	62 63 64 65 66       	(bad)
+  804b8c:	00 28                	add    %ch,(%rax)
+  804b8e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804b8f:	75 6c                	jne    804bfd <__rodata_start+0x19d>
+  804b91:	6c                   	insb   (%dx),%es:(%rdi)
+  804b92:	29 00                	sub    %eax,(%rax)
+  804b94:	65 72 72             	gs jb  804c09 <__rodata_start+0x1a9>
+  804b97:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b98:	72 20                	jb     804bba <__rodata_start+0x15a>
+  804b9a:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  804b9f:	73 70                	jae    804c11 <__rodata_start+0x1b1>
+  804ba1:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  804ba5:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  804bac:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804bad:	72 00                	jb     804baf <__rodata_start+0x14f>
+  804baf:	62 61 64 20 65       	(bad)
+  804bb4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804bb5:	76 69                	jbe    804c20 <__rodata_start+0x1c0>
+  804bb7:	72 6f                	jb     804c28 <__rodata_start+0x1c8>
+  804bb9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804bba:	6d                   	insl   (%dx),%es:(%rdi)
+  804bbb:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804bbd:	74 00                	je     804bbf <__rodata_start+0x15f>
+  804bbf:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  804bc6:	20 70 61             	and    %dh,0x61(%rax)
+  804bc9:	72 61                	jb     804c2c <__rodata_start+0x1cc>
+  804bcb:	6d                   	insl   (%dx),%es:(%rdi)
+  804bcc:	65 74 65             	gs je  804c34 <__rodata_start+0x1d4>
+  804bcf:	72 00                	jb     804bd1 <__rodata_start+0x171>
+  804bd1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804bd2:	75 74                	jne    804c48 <__rodata_start+0x1e8>
+  804bd4:	20 6f 66             	and    %ch,0x66(%rdi)
+  804bd7:	20 6d 65             	and    %ch,0x65(%rbp)
+  804bda:	6d                   	insl   (%dx),%es:(%rdi)
+  804bdb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804bdc:	72 79                	jb     804c57 <__rodata_start+0x1f7>
+  804bde:	00 6f 75             	add    %ch,0x75(%rdi)
+  804be1:	74 20                	je     804c03 <__rodata_start+0x1a3>
+  804be3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804be4:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  804be8:	76 69                	jbe    804c53 <__rodata_start+0x1f3>
+  804bea:	72 6f                	jb     804c5b <__rodata_start+0x1fb>
+  804bec:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804bed:	6d                   	insl   (%dx),%es:(%rdi)
+  804bee:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804bf0:	74 73                	je     804c65 <__rodata_start+0x205>
+  804bf2:	00 63 6f             	add    %ah,0x6f(%rbx)
+  804bf5:	72 72                	jb     804c69 <__rodata_start+0x209>
+  804bf7:	75 70                	jne    804c69 <__rodata_start+0x209>
+  804bf9:	74 65                	je     804c60 <__rodata_start+0x200>
+  804bfb:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  804c00:	75 67                	jne    804c69 <__rodata_start+0x209>
+  804c02:	20 69 6e             	and    %ch,0x6e(%rcx)
+  804c05:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804c07:	00 73 65             	add    %dh,0x65(%rbx)
+  804c0a:	67 6d                	insl   (%dx),%es:(%edi)
+  804c0c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804c0e:	74 61                	je     804c71 <__rodata_start+0x211>
+  804c10:	74 69                	je     804c7b <__rodata_start+0x21b>
+  804c12:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804c13:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804c14:	20 66 61             	and    %ah,0x61(%rsi)
+  804c17:	75 6c                	jne    804c85 <__rodata_start+0x225>
+  804c19:	74 00                	je     804c1b <__rodata_start+0x1bb>
+  804c1b:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  804c22:	20 45 4c             	and    %al,0x4c(%rbp)
+  804c25:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  804c29:	61                   	(bad)
+  804c2a:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  804c2f:	20 73 75             	and    %dh,0x75(%rbx)
+  804c32:	63 68 20             	movsxd 0x20(%rax),%ebp
+  804c35:	73 79                	jae    804cb0 <__rodata_start+0x250>
+  804c37:	73 74                	jae    804cad <__rodata_start+0x24d>
+  804c39:	65 6d                	gs insl (%dx),%es:(%rdi)
+  804c3b:	20 63 61             	and    %ah,0x61(%rbx)
+  804c3e:	6c                   	insb   (%dx),%es:(%rdi)
+  804c3f:	6c                   	insb   (%dx),%es:(%rdi)
+  804c40:	00 65 6e             	add    %ah,0x6e(%rbp)
+  804c43:	74 72                	je     804cb7 <__rodata_start+0x257>
+  804c45:	79 20                	jns    804c67 <__rodata_start+0x207>
+  804c47:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804c48:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804c49:	74 20                	je     804c6b <__rodata_start+0x20b>
+  804c4b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804c4d:	75 6e                	jne    804cbd <__rodata_start+0x25d>
+  804c4f:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  804c53:	76 20                	jbe    804c75 <__rodata_start+0x215>
+  804c55:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  804c5c:	72 65                	jb     804cc3 <__rodata_start+0x263>
+  804c5e:	63 76 69             	movsxd 0x69(%rsi),%esi
+  804c61:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804c62:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  804c66:	65 78 70             	gs js  804cd9 <__rodata_start+0x279>
+  804c69:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  804c6e:	20 65 6e             	and    %ah,0x6e(%rbp)
+  804c71:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  804c75:	20 66 69             	and    %ah,0x69(%rsi)
+  804c78:	6c                   	insb   (%dx),%es:(%rdi)
+  804c79:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  804c7d:	20 66 72             	and    %ah,0x72(%rsi)
+  804c80:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  804c85:	61                   	(bad)
+  804c86:	63 65 20             	movsxd 0x20(%rbp),%esp
+  804c89:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804c8a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804c8b:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  804c8f:	6b 00 74             	imul   $0x74,(%rax),%eax
+  804c92:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804c93:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804c94:	20 6d 61             	and    %ch,0x61(%rbp)
+  804c97:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804c98:	79 20                	jns    804cba <__rodata_start+0x25a>
+  804c9a:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  804ca1:	72 65                	jb     804d08 <__rodata_start+0x2a8>
+  804ca3:	20 6f 70             	and    %ch,0x70(%rdi)
+  804ca6:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804ca8:	00 66 69             	add    %ah,0x69(%rsi)
+  804cab:	6c                   	insb   (%dx),%es:(%rdi)
+  804cac:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  804cb0:	20 62 6c             	and    %ah,0x6c(%rdx)
+  804cb3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804cb4:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  804cb7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804cb8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804cb9:	74 20                	je     804cdb <__rodata_start+0x27b>
+  804cbb:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804cbd:	75 6e                	jne    804d2d <__rodata_start+0x2cd>
+  804cbf:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  804cc3:	76 61                	jbe    804d26 <__rodata_start+0x2c6>
+  804cc5:	6c                   	insb   (%dx),%es:(%rdi)
+  804cc6:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  804ccd:	00 
+  804cce:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  804cd5:	72 65                	jb     804d3c <__rodata_start+0x2dc>
+  804cd7:	61                   	(bad)
+  804cd8:	64 79 20             	fs jns 804cfb <__rodata_start+0x29b>
+  804cdb:	65 78 69             	gs js  804d47 <__rodata_start+0x2e7>
+  804cde:	73 74                	jae    804d54 <__rodata_start+0x2f4>
+  804ce0:	73 00                	jae    804ce2 <__rodata_start+0x282>
+  804ce2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804ce3:	70 65                	jo     804d4a <__rodata_start+0x2ea>
+  804ce5:	72 61                	jb     804d48 <__rodata_start+0x2e8>
+  804ce7:	74 69                	je     804d52 <__rodata_start+0x2f2>
+  804ce9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804cea:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804ceb:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  804cee:	74 20                	je     804d10 <__rodata_start+0x2b0>
+  804cf0:	73 75                	jae    804d67 <__rodata_start+0x307>
+  804cf2:	70 70                	jo     804d64 <__rodata_start+0x304>
+  804cf4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804cf5:	72 74                	jb     804d6b <__rodata_start+0x30b>
+  804cf7:	65 64 00 74 72 79    	gs add %dh,%fs:0x79(%rdx,%rsi,2)
+  804cfd:	20 61 67             	and    %ah,0x67(%rcx)
+  804d00:	61                   	(bad)
+  804d01:	69 6e 00 74 69 6d 65 	imul   $0x656d6974,0x0(%rsi),%ebp
+  804d08:	64 20 6f 75          	and    %ch,%fs:0x75(%rdi)
+  804d0c:	74 00                	je     804d0e <__rodata_start+0x2ae>
+  804d0e:	66 69 6c 65 20 69 73 	imul   $0x7369,0x20(%rbp,%riz,2),%bp
+  804d15:	20 69 6e             	and    %ch,0x6e(%rcx)
+  804d18:	20 75 73             	and    %dh,0x73(%rbp)
+  804d1b:	65 00 0f             	add    %cl,%gs:(%rdi)
+  804d1e:	1f                   	(bad)
+  804d1f:	00 f3                	add    %dh,%bl
+  804d21:	06                   	(bad)
+  804d22:	80 00 00             	addb   $0x0,(%rax)
+  804d25:	00 00                	add    %al,(%rax)
+  804d27:	00 34 0d 80 00 00 00 	add    %dh,0x80(,%rcx,1)
+  804d2e:	00 00                	add    %al,(%rax)
+  804d30:	24 0d                	and    $0xd,%al
+  804d32:	80 00 00             	addb   $0x0,(%rax)
+  804d35:	00 00                	add    %al,(%rax)
+  804d37:	00 34 0d 80 00 00 00 	add    %dh,0x80(,%rcx,1)
+  804d3e:	00 00                	add    %al,(%rax)
+  804d40:	34 0d                	xor    $0xd,%al
+  804d42:	80 00 00             	addb   $0x0,(%rax)
+  804d45:	00 00                	add    %al,(%rax)
+  804d47:	00 34 0d 80 00 00 00 	add    %dh,0x80(,%rcx,1)
+  804d4e:	00 00                	add    %al,(%rax)
+  804d50:	34 0d                	xor    $0xd,%al
+  804d52:	80 00 00             	addb   $0x0,(%rax)
+  804d55:	00 00                	add    %al,(%rax)
+  804d57:	00 12                	add    %dl,(%rdx)
+  804d59:	07                   	(bad)
+  804d5a:	80 00 00             	addb   $0x0,(%rax)
+  804d5d:	00 00                	add    %al,(%rax)
+  804d5f:	00 34 0d 80 00 00 00 	add    %dh,0x80(,%rcx,1)
+  804d66:	00 00                	add    %al,(%rax)
+  804d68:	34 0d                	xor    $0xd,%al
+  804d6a:	80 00 00             	addb   $0x0,(%rax)
+  804d6d:	00 00                	add    %al,(%rax)
+  804d6f:	00 06                	add    %al,(%rsi)
+  804d71:	07                   	(bad)
+  804d72:	80 00 00             	addb   $0x0,(%rax)
+  804d75:	00 00                	add    %al,(%rax)
+  804d77:	00 80 07 80 00 00    	add    %al,0x8007(%rax)
+  804d7d:	00 00                	add    %al,(%rax)
+  804d7f:	00 34 0d 80 00 00 00 	add    %dh,0x80(,%rcx,1)
+  804d86:	00 00                	add    %al,(%rax)
+  804d88:	06                   	(bad)
+  804d89:	07                   	(bad)
+  804d8a:	80 00 00             	addb   $0x0,(%rax)
+  804d8d:	00 00                	add    %al,(%rax)
+  804d8f:	00 4c 07 80          	add    %cl,-0x80(%rdi,%rax,1)
+  804d93:	00 00                	add    %al,(%rax)
+  804d95:	00 00                	add    %al,(%rax)
+  804d97:	00 4c 07 80          	add    %cl,-0x80(%rdi,%rax,1)
+  804d9b:	00 00                	add    %al,(%rax)
+  804d9d:	00 00                	add    %al,(%rax)
+  804d9f:	00 4c 07 80          	add    %cl,-0x80(%rdi,%rax,1)
+  804da3:	00 00                	add    %al,(%rax)
+  804da5:	00 00                	add    %al,(%rax)
+  804da7:	00 4c 07 80          	add    %cl,-0x80(%rdi,%rax,1)
+  804dab:	00 00                	add    %al,(%rax)
+  804dad:	00 00                	add    %al,(%rax)
+  804daf:	00 4c 07 80          	add    %cl,-0x80(%rdi,%rax,1)
+  804db3:	00 00                	add    %al,(%rax)
+  804db5:	00 00                	add    %al,(%rax)
+  804db7:	00 4c 07 80          	add    %cl,-0x80(%rdi,%rax,1)
+  804dbb:	00 00                	add    %al,(%rax)
+  804dbd:	00 00                	add    %al,(%rax)
+  804dbf:	00 4c 07 80          	add    %cl,-0x80(%rdi,%rax,1)
+  804dc3:	00 00                	add    %al,(%rax)
+  804dc5:	00 00                	add    %al,(%rax)
+  804dc7:	00 4c 07 80          	add    %cl,-0x80(%rdi,%rax,1)
+  804dcb:	00 00                	add    %al,(%rax)
+  804dcd:	00 00                	add    %al,(%rax)
+  804dcf:	00 4c 07 80          	add    %cl,-0x80(%rdi,%rax,1)
+  804dd3:	00 00                	add    %al,(%rax)
+  804dd5:	00 00                	add    %al,(%rax)
+  804dd7:	00 34 0d 80 00 00 00 	add    %dh,0x80(,%rcx,1)
+  804dde:	00 00                	add    %al,(%rax)
+  804de0:	34 0d                	xor    $0xd,%al
+  804de2:	80 00 00             	addb   $0x0,(%rax)
+  804de5:	00 00                	add    %al,(%rax)
+  804de7:	00 34 0d 80 00 00 00 	add    %dh,0x80(,%rcx,1)
+  804dee:	00 00                	add    %al,(%rax)
+  804df0:	34 0d                	xor    $0xd,%al
+  804df2:	80 00 00             	addb   $0x0,(%rax)
+  804df5:	00 00                	add    %al,(%rax)
+  804df7:	00 34 0d 80 00 00 00 	add    %dh,0x80(,%rcx,1)
+  804dfe:	00 00                	add    %al,(%rax)
+  804e00:	34 0d                	xor    $0xd,%al
+  804e02:	80 00 00             	addb   $0x0,(%rax)
+  804e05:	00 00                	add    %al,(%rax)
+  804e07:	00 34 0d 80 00 00 00 	add    %dh,0x80(,%rcx,1)
+  804e0e:	00 00                	add    %al,(%rax)
+  804e10:	34 0d                	xor    $0xd,%al
+  804e12:	80 00 00             	addb   $0x0,(%rax)
+  804e15:	00 00                	add    %al,(%rax)
+  804e17:	00 34 0d 80 00 00 00 	add    %dh,0x80(,%rcx,1)
+  804e1e:	00 00                	add    %al,(%rax)
+  804e20:	34 0d                	xor    $0xd,%al
+  804e22:	80 00 00             	addb   $0x0,(%rax)
+  804e25:	00 00                	add    %al,(%rax)
+  804e27:	00 34 0d 80 00 00 00 	add    %dh,0x80(,%rcx,1)
+  804e2e:	00 00                	add    %al,(%rax)
+  804e30:	34 0d                	xor    $0xd,%al
+  804e32:	80 00 00             	addb   $0x0,(%rax)
+  804e35:	00 00                	add    %al,(%rax)
+  804e37:	00 34 0d 80 00 00 00 	add    %dh,0x80(,%rcx,1)
+  804e3e:	00 00                	add    %al,(%rax)
+  804e40:	34 0d                	xor    $0xd,%al
+  804e42:	80 00 00             	addb   $0x0,(%rax)
+  804e45:	00 00                	add    %al,(%rax)
+  804e47:	00 34 0d 80 00 00 00 	add    %dh,0x80(,%rcx,1)
+  804e4e:	00 00                	add    %al,(%rax)
+  804e50:	34 0d                	xor    $0xd,%al
+  804e52:	80 00 00             	addb   $0x0,(%rax)
+  804e55:	00 00                	add    %al,(%rax)
+  804e57:	00 34 0d 80 00 00 00 	add    %dh,0x80(,%rcx,1)
+  804e5e:	00 00                	add    %al,(%rax)
+  804e60:	34 0d                	xor    $0xd,%al
+  804e62:	80 00 00             	addb   $0x0,(%rax)
+  804e65:	00 00                	add    %al,(%rax)
+  804e67:	00 34 0d 80 00 00 00 	add    %dh,0x80(,%rcx,1)
+  804e6e:	00 00                	add    %al,(%rax)
+  804e70:	34 0d                	xor    $0xd,%al
+  804e72:	80 00 00             	addb   $0x0,(%rax)
+  804e75:	00 00                	add    %al,(%rax)
+  804e77:	00 34 0d 80 00 00 00 	add    %dh,0x80(,%rcx,1)
+  804e7e:	00 00                	add    %al,(%rax)
+  804e80:	34 0d                	xor    $0xd,%al
+  804e82:	80 00 00             	addb   $0x0,(%rax)
+  804e85:	00 00                	add    %al,(%rax)
+  804e87:	00 34 0d 80 00 00 00 	add    %dh,0x80(,%rcx,1)
+  804e8e:	00 00                	add    %al,(%rax)
+  804e90:	34 0d                	xor    $0xd,%al
+  804e92:	80 00 00             	addb   $0x0,(%rax)
+  804e95:	00 00                	add    %al,(%rax)
+  804e97:	00 34 0d 80 00 00 00 	add    %dh,0x80(,%rcx,1)
+  804e9e:	00 00                	add    %al,(%rax)
+  804ea0:	34 0d                	xor    $0xd,%al
+  804ea2:	80 00 00             	addb   $0x0,(%rax)
+  804ea5:	00 00                	add    %al,(%rax)
+  804ea7:	00 34 0d 80 00 00 00 	add    %dh,0x80(,%rcx,1)
+  804eae:	00 00                	add    %al,(%rax)
+  804eb0:	34 0d                	xor    $0xd,%al
+  804eb2:	80 00 00             	addb   $0x0,(%rax)
+  804eb5:	00 00                	add    %al,(%rax)
+  804eb7:	00 34 0d 80 00 00 00 	add    %dh,0x80(,%rcx,1)
+  804ebe:	00 00                	add    %al,(%rax)
+  804ec0:	34 0d                	xor    $0xd,%al
+  804ec2:	80 00 00             	addb   $0x0,(%rax)
+  804ec5:	00 00                	add    %al,(%rax)
+  804ec7:	00 57 0c             	add    %dl,0xc(%rdi)
+  804eca:	80 00 00             	addb   $0x0,(%rax)
+  804ecd:	00 00                	add    %al,(%rax)
+  804ecf:	00 34 0d 80 00 00 00 	add    %dh,0x80(,%rcx,1)
+  804ed6:	00 00                	add    %al,(%rax)
+  804ed8:	34 0d                	xor    $0xd,%al
+  804eda:	80 00 00             	addb   $0x0,(%rax)
+  804edd:	00 00                	add    %al,(%rax)
+  804edf:	00 34 0d 80 00 00 00 	add    %dh,0x80(,%rcx,1)
+  804ee6:	00 00                	add    %al,(%rax)
+  804ee8:	34 0d                	xor    $0xd,%al
+  804eea:	80 00 00             	addb   $0x0,(%rax)
+  804eed:	00 00                	add    %al,(%rax)
+  804eef:	00 34 0d 80 00 00 00 	add    %dh,0x80(,%rcx,1)
+  804ef6:	00 00                	add    %al,(%rax)
+  804ef8:	34 0d                	xor    $0xd,%al
+  804efa:	80 00 00             	addb   $0x0,(%rax)
+  804efd:	00 00                	add    %al,(%rax)
+  804eff:	00 34 0d 80 00 00 00 	add    %dh,0x80(,%rcx,1)
+  804f06:	00 00                	add    %al,(%rax)
+  804f08:	34 0d                	xor    $0xd,%al
+  804f0a:	80 00 00             	addb   $0x0,(%rax)
+  804f0d:	00 00                	add    %al,(%rax)
+  804f0f:	00 34 0d 80 00 00 00 	add    %dh,0x80(,%rcx,1)
+  804f16:	00 00                	add    %al,(%rax)
+  804f18:	34 0d                	xor    $0xd,%al
+  804f1a:	80 00 00             	addb   $0x0,(%rax)
+  804f1d:	00 00                	add    %al,(%rax)
+  804f1f:	00 a3 07 80 00 00    	add    %ah,0x8007(%rbx)
+  804f25:	00 00                	add    %al,(%rax)
+  804f27:	00 72 09             	add    %dh,0x9(%rdx)
+  804f2a:	80 00 00             	addb   $0x0,(%rax)
+  804f2d:	00 00                	add    %al,(%rax)
+  804f2f:	00 34 0d 80 00 00 00 	add    %dh,0x80(,%rcx,1)
+  804f36:	00 00                	add    %al,(%rax)
+  804f38:	34 0d                	xor    $0xd,%al
+  804f3a:	80 00 00             	addb   $0x0,(%rax)
+  804f3d:	00 00                	add    %al,(%rax)
+  804f3f:	00 34 0d 80 00 00 00 	add    %dh,0x80(,%rcx,1)
+  804f46:	00 00                	add    %al,(%rax)
+  804f48:	34 0d                	xor    $0xd,%al
+  804f4a:	80 00 00             	addb   $0x0,(%rax)
+  804f4d:	00 00                	add    %al,(%rax)
+  804f4f:	00 d2                	add    %dl,%dl
+  804f51:	07                   	(bad)
+  804f52:	80 00 00             	addb   $0x0,(%rax)
+  804f55:	00 00                	add    %al,(%rax)
+  804f57:	00 34 0d 80 00 00 00 	add    %dh,0x80(,%rcx,1)
+  804f5e:	00 00                	add    %al,(%rax)
+  804f60:	34 0d                	xor    $0xd,%al
+  804f62:	80 00 00             	addb   $0x0,(%rax)
+  804f65:	00 00                	add    %al,(%rax)
+  804f67:	00 98 07 80 00 00    	add    %bl,0x8007(%rax)
+  804f6d:	00 00                	add    %al,(%rax)
+  804f6f:	00 34 0d 80 00 00 00 	add    %dh,0x80(,%rcx,1)
+  804f76:	00 00                	add    %al,(%rax)
+  804f78:	34 0d                	xor    $0xd,%al
+  804f7a:	80 00 00             	addb   $0x0,(%rax)
+  804f7d:	00 00                	add    %al,(%rax)
+  804f7f:	00 1a                	add    %bl,(%rdx)
+  804f81:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804f87:	00 e4                	add    %ah,%ah
+  804f89:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804f8f:	00 34 0d 80 00 00 00 	add    %dh,0x80(,%rcx,1)
+  804f96:	00 00                	add    %al,(%rax)
+  804f98:	34 0d                	xor    $0xd,%al
+  804f9a:	80 00 00             	addb   $0x0,(%rax)
+  804f9d:	00 00                	add    %al,(%rax)
+  804f9f:	00 69 08             	add    %ch,0x8(%rcx)
+  804fa2:	80 00 00             	addb   $0x0,(%rax)
+  804fa5:	00 00                	add    %al,(%rax)
+  804fa7:	00 34 0d 80 00 00 00 	add    %dh,0x80(,%rcx,1)
+  804fae:	00 00                	add    %al,(%rax)
+  804fb0:	46 0a 80 00 00 00 00 	rex.RX or 0x0(%rax),%r8b
+  804fb7:	00 34 0d 80 00 00 00 	add    %dh,0x80(,%rcx,1)
+  804fbe:	00 00                	add    %al,(%rax)
+  804fc0:	34 0d                	xor    $0xd,%al
+  804fc2:	80 00 00             	addb   $0x0,(%rax)
+  804fc5:	00 00                	add    %al,(%rax)
+  804fc7:	00 57 0c             	add    %dl,0xc(%rdi)
+  804fca:	80 00 00             	addb   $0x0,(%rax)
+  804fcd:	00 00                	add    %al,(%rax)
+  804fcf:	00 34 0d 80 00 00 00 	add    %dh,0x80(,%rcx,1)
+  804fd6:	00 00                	add    %al,(%rax)
+  804fd8:	fc                   	cld
+  804fd9:	06                   	(bad)
+  804fda:	80 00 00             	addb   $0x0,(%rax)
+  804fdd:	00 00                	add    %al,(%rax)
+	...
+
+0000000000804fe0 <error_string>:
+	...
+  804fe8:	9d 4b 80 00 00 00 00 00 af 4b 80 00 00 00 00 00     .K.......K......
+  804ff8:	bf 4b 80 00 00 00 00 00 d1 4b 80 00 00 00 00 00     .K.......K......
+  805008:	df 4b 80 00 00 00 00 00 f3 4b 80 00 00 00 00 00     .K.......K......
+  805018:	08 4c 80 00 00 00 00 00 1b 4c 80 00 00 00 00 00     .L.......L......
+  805028:	2d 4c 80 00 00 00 00 00 41 4c 80 00 00 00 00 00     -L......AL......
+  805038:	51 4c 80 00 00 00 00 00 64 4c 80 00 00 00 00 00     QL......dL......
+  805048:	7b 4c 80 00 00 00 00 00 91 4c 80 00 00 00 00 00     {L.......L......
+  805058:	a9 4c 80 00 00 00 00 00 c1 4c 80 00 00 00 00 00     .L.......L......
+  805068:	ce 4c 80 00 00 00 00 00 98 50 80 00 00 00 00 00     .L.......P......
+  805078:	e2 4c 80 00 00 00 00 00 fa 4c 80 00 00 00 00 00     .L.......L......
+  805088:	04 4d 80 00 00 00 00 00 0e 4d 80 00 00 00 00 00     .M.......M......
+  805098:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  8050a8:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  8050b8:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  8050c8:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  8050d8:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 73 66 6f     ib/syscall.c.sfo
+  8050e8:	72 6b 28 29 20 69 73 20 6e 6f 74 20 69 6d 70 6c     rk() is not impl
+  8050f8:	65 6d 65 6e 74 65 64 00 6c 69 62 2f 66 6f 72 6b     emented.lib/fork
+  805108:	2e 63 00 0f 1f 44 00 00 5b 25 30 38 78 5d 20 75     .c...D..[%08x] u
+  805118:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  805128:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  805138:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  805148:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  805158:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  805168:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  805178:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  805188:	0a 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805198:	84 00 00 00 00 00 66 90                             ......f.
+
+00000000008051a0 <devtab>:
+  8051a0:	20 60 80 00 00 00 00 00 60 60 80 00 00 00 00 00      `......``......
+  8051b0:	a0 60 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .`..............
+  8051c0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  8051d0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8051e0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8051f0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  805200:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  805210:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  805220:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  805230:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  805240:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  805250:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  805260:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  805270:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  805280:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  805290:	69 70 63 5f 73 65 6e 64 20 65 72 72 6f 72 3a 20     ipc_send error: 
+  8052a0:	25 69 0a 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e     %i..lib/ipc.c.f.
+  8052b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8052c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8052d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8052e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8052f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805300:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805310:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805320:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805330:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805340:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805350:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805360:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805370:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805380:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805390:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8053a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8053b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8053c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8053d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8053e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8053f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805400:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805410:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805420:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805430:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805440:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805450:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805460:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805470:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805480:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805490:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8054a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8054b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8054c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8054d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8054e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8054f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805500:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805510:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805520:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805530:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805540:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805550:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805560:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805570:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805580:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805590:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8055a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8055b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8055c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8055d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8055e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8055f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805600:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805610:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805620:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805630:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805640:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805650:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805660:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805670:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805680:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805690:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8056a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8056b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8056c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8056d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8056e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8056f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805700:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805710:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805720:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805730:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805740:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805750:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805760:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805770:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805780:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805790:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8057a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8057b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8057c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8057d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8057e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8057f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805800:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805810:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805820:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805830:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805840:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805850:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805860:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805870:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805880:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805890:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8058a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8058b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8058c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8058d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8058e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8058f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805900:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805910:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805920:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805930:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805940:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805950:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805960:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805970:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805980:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805990:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8059a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8059b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8059c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8059d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8059e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8059f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805aa0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ab0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ac0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ad0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ae0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805af0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ba0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805bb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805bc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805bd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805be0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805bf0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ca0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805cb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805cc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805cd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ce0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805cf0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805da0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805db0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805dc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805dd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805de0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805df0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ea0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805eb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ec0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ed0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ee0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ef0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805fa0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805fb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805fc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805fd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805fe0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ff0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
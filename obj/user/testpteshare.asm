@@ -0,0 +1,9727 @@
+
+obj/user/testpteshare:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 54 02 00 00       	call   800277 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <childofspawn>:
+
+    breakpoint();
+}
+
+void
+childofspawn(void) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    strcpy(VA, msg2);
+  800029:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800030:	00 00 00 
+  800033:	48 8b 30             	mov    (%rax),%rsi
+  800036:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  80003b:	48 b8 c2 0d 80 00 00 	movabs $0x800dc2,%rax
+  800042:	00 00 00 
+  800045:	ff d0                	call   *%rax
+    exit();
+  800047:	48 b8 2a 03 80 00 00 	movabs $0x80032a,%rax
+  80004e:	00 00 00 
+  800051:	ff d0                	call   *%rax
+}
+  800053:	5d                   	pop    %rbp
+  800054:	c3                   	ret
+
+0000000000800055 <umain>:
+umain(int argc, char **argv) {
+  800055:	55                   	push   %rbp
+  800056:	48 89 e5             	mov    %rsp,%rbp
+  800059:	53                   	push   %rbx
+  80005a:	48 83 ec 08          	sub    $0x8,%rsp
+    if (argc != 0)
+  80005e:	85 ff                	test   %edi,%edi
+  800060:	0f 85 4a 01 00 00    	jne    8001b0 <umain+0x15b>
+    if ((r = sys_alloc_region(0, VA, PAGE_SIZE, PROT_SHARE | PROT_RW)) < 0)
+  800066:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80006b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800070:	be 00 00 00 0a       	mov    $0xa000000,%esi
+  800075:	bf 00 00 00 00       	mov    $0x0,%edi
+  80007a:	48 b8 21 13 80 00 00 	movabs $0x801321,%rax
+  800081:	00 00 00 
+  800084:	ff d0                	call   *%rax
+  800086:	85 c0                	test   %eax,%eax
+  800088:	0f 88 33 01 00 00    	js     8001c1 <umain+0x16c>
+    if ((r = fork()) < 0)
+  80008e:	48 b8 54 17 80 00 00 	movabs $0x801754,%rax
+  800095:	00 00 00 
+  800098:	ff d0                	call   *%rax
+  80009a:	89 c3                	mov    %eax,%ebx
+  80009c:	85 c0                	test   %eax,%eax
+  80009e:	0f 88 4a 01 00 00    	js     8001ee <umain+0x199>
+    if (r == 0) {
+  8000a4:	0f 84 71 01 00 00    	je     80021b <umain+0x1c6>
+    wait(r);
+  8000aa:	89 df                	mov    %ebx,%edi
+  8000ac:	48 b8 37 48 80 00 00 	movabs $0x804837,%rax
+  8000b3:	00 00 00 
+  8000b6:	ff d0                	call   *%rax
+    cprintf("fork handles PTE_SHARE %s\n", strcmp(VA, msg) == 0 ? "right" : "wrong");
+  8000b8:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  8000bf:	00 00 00 
+  8000c2:	48 8b 30             	mov    (%rax),%rsi
+  8000c5:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  8000ca:	48 b8 66 0e 80 00 00 	movabs $0x800e66,%rax
+  8000d1:	00 00 00 
+  8000d4:	ff d0                	call   *%rax
+  8000d6:	85 c0                	test   %eax,%eax
+  8000d8:	48 be 46 56 80 00 00 	movabs $0x805646,%rsi
+  8000df:	00 00 00 
+  8000e2:	48 b8 40 56 80 00 00 	movabs $0x805640,%rax
+  8000e9:	00 00 00 
+  8000ec:	48 0f 44 f0          	cmove  %rax,%rsi
+  8000f0:	48 bf 7c 56 80 00 00 	movabs $0x80567c,%rdi
+  8000f7:	00 00 00 
+  8000fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ff:	48 ba 9d 04 80 00 00 	movabs $0x80049d,%rdx
+  800106:	00 00 00 
+  800109:	ff d2                	call   *%rdx
+    if ((r = spawnl("/testpteshare", "testpteshare", "arg", 0)) < 0)
+  80010b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800110:	48 ba 97 56 80 00 00 	movabs $0x805697,%rdx
+  800117:	00 00 00 
+  80011a:	48 be 9c 56 80 00 00 	movabs $0x80569c,%rsi
+  800121:	00 00 00 
+  800124:	48 bf 9b 56 80 00 00 	movabs $0x80569b,%rdi
+  80012b:	00 00 00 
+  80012e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800133:	49 b8 1e 41 80 00 00 	movabs $0x80411e,%r8
+  80013a:	00 00 00 
+  80013d:	41 ff d0             	call   *%r8
+  800140:	89 c7                	mov    %eax,%edi
+  800142:	85 c0                	test   %eax,%eax
+  800144:	0f 88 00 01 00 00    	js     80024a <umain+0x1f5>
+    wait(r);
+  80014a:	48 b8 37 48 80 00 00 	movabs $0x804837,%rax
+  800151:	00 00 00 
+  800154:	ff d0                	call   *%rax
+    cprintf("spawn handles PTE_SHARE %s\n", strcmp(VA, msg2) == 0 ? "right" : "wrong");
+  800156:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80015d:	00 00 00 
+  800160:	48 8b 30             	mov    (%rax),%rsi
+  800163:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  800168:	48 b8 66 0e 80 00 00 	movabs $0x800e66,%rax
+  80016f:	00 00 00 
+  800172:	ff d0                	call   *%rax
+  800174:	85 c0                	test   %eax,%eax
+  800176:	48 be 46 56 80 00 00 	movabs $0x805646,%rsi
+  80017d:	00 00 00 
+  800180:	48 b8 40 56 80 00 00 	movabs $0x805640,%rax
+  800187:	00 00 00 
+  80018a:	48 0f 44 f0          	cmove  %rax,%rsi
+  80018e:	48 bf b3 56 80 00 00 	movabs $0x8056b3,%rdi
+  800195:	00 00 00 
+  800198:	b8 00 00 00 00       	mov    $0x0,%eax
+  80019d:	48 ba 9d 04 80 00 00 	movabs $0x80049d,%rdx
+  8001a4:	00 00 00 
+  8001a7:	ff d2                	call   *%rdx
+
+#include <inc/types.h>
+
+static inline void __attribute__((always_inline))
+breakpoint(void) {
+    asm volatile("int3");
+  8001a9:	cc                   	int3
+}
+  8001aa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001ae:	c9                   	leave
+  8001af:	c3                   	ret
+        childofspawn();
+  8001b0:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8001b7:	00 00 00 
+  8001ba:	ff d0                	call   *%rax
+  8001bc:	e9 a5 fe ff ff       	jmp    800066 <umain+0x11>
+        panic("sys_page_alloc: %i", r);
+  8001c1:	89 c1                	mov    %eax,%ecx
+  8001c3:	48 ba 4c 56 80 00 00 	movabs $0x80564c,%rdx
+  8001ca:	00 00 00 
+  8001cd:	be 12 00 00 00       	mov    $0x12,%esi
+  8001d2:	48 bf 5f 56 80 00 00 	movabs $0x80565f,%rdi
+  8001d9:	00 00 00 
+  8001dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001e1:	49 b8 4d 03 80 00 00 	movabs $0x80034d,%r8
+  8001e8:	00 00 00 
+  8001eb:	41 ff d0             	call   *%r8
+        panic("fork: %i", r);
+  8001ee:	89 c1                	mov    %eax,%ecx
+  8001f0:	48 ba 73 56 80 00 00 	movabs $0x805673,%rdx
+  8001f7:	00 00 00 
+  8001fa:	be 16 00 00 00       	mov    $0x16,%esi
+  8001ff:	48 bf 5f 56 80 00 00 	movabs $0x80565f,%rdi
+  800206:	00 00 00 
+  800209:	b8 00 00 00 00       	mov    $0x0,%eax
+  80020e:	49 b8 4d 03 80 00 00 	movabs $0x80034d,%r8
+  800215:	00 00 00 
+  800218:	41 ff d0             	call   *%r8
+        strcpy(VA, msg);
+  80021b:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  800222:	00 00 00 
+  800225:	48 8b 30             	mov    (%rax),%rsi
+  800228:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  80022d:	48 b8 c2 0d 80 00 00 	movabs $0x800dc2,%rax
+  800234:	00 00 00 
+  800237:	ff d0                	call   *%rax
+        exit();
+  800239:	48 b8 2a 03 80 00 00 	movabs $0x80032a,%rax
+  800240:	00 00 00 
+  800243:	ff d0                	call   *%rax
+  800245:	e9 60 fe ff ff       	jmp    8000aa <umain+0x55>
+        panic("spawn: %i", r);
+  80024a:	89 c1                	mov    %eax,%ecx
+  80024c:	48 ba a9 56 80 00 00 	movabs $0x8056a9,%rdx
+  800253:	00 00 00 
+  800256:	be 20 00 00 00       	mov    $0x20,%esi
+  80025b:	48 bf 5f 56 80 00 00 	movabs $0x80565f,%rdi
+  800262:	00 00 00 
+  800265:	b8 00 00 00 00       	mov    $0x0,%eax
+  80026a:	49 b8 4d 03 80 00 00 	movabs $0x80034d,%r8
+  800271:	00 00 00 
+  800274:	41 ff d0             	call   *%r8
+
+0000000000800277 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800277:	55                   	push   %rbp
+  800278:	48 89 e5             	mov    %rsp,%rbp
+  80027b:	41 56                	push   %r14
+  80027d:	41 55                	push   %r13
+  80027f:	41 54                	push   %r12
+  800281:	53                   	push   %rbx
+  800282:	41 89 fd             	mov    %edi,%r13d
+  800285:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800288:	48 ba e0 60 80 00 00 	movabs $0x8060e0,%rdx
+  80028f:	00 00 00 
+  800292:	48 b8 e0 60 80 00 00 	movabs $0x8060e0,%rax
+  800299:	00 00 00 
+  80029c:	48 39 c2             	cmp    %rax,%rdx
+  80029f:	73 17                	jae    8002b8 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8002a1:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8002a4:	49 89 c4             	mov    %rax,%r12
+  8002a7:	48 83 c3 08          	add    $0x8,%rbx
+  8002ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002b0:	ff 53 f8             	call   *-0x8(%rbx)
+  8002b3:	4c 39 e3             	cmp    %r12,%rbx
+  8002b6:	72 ef                	jb     8002a7 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8002b8:	48 b8 94 12 80 00 00 	movabs $0x801294,%rax
+  8002bf:	00 00 00 
+  8002c2:	ff d0                	call   *%rax
+  8002c4:	89 c2                	mov    %eax,%edx
+  8002c6:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  8002cc:	48 89 d0             	mov    %rdx,%rax
+  8002cf:	48 c1 e0 04          	shl    $0x4,%rax
+  8002d3:	48 29 d0             	sub    %rdx,%rax
+  8002d6:	48 c1 e0 05          	shl    $0x5,%rax
+  8002da:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8002e1:	00 00 00 
+  8002e4:	48 01 d0             	add    %rdx,%rax
+  8002e7:	48 a3 00 00 81 00 00 	movabs %rax,0x810000
+  8002ee:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8002f1:	45 85 ed             	test   %r13d,%r13d
+  8002f4:	7e 0d                	jle    800303 <libmain+0x8c>
+  8002f6:	49 8b 06             	mov    (%r14),%rax
+  8002f9:	48 a3 10 60 80 00 00 	movabs %rax,0x806010
+  800300:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800303:	4c 89 f6             	mov    %r14,%rsi
+  800306:	44 89 ef             	mov    %r13d,%edi
+  800309:	48 b8 55 00 80 00 00 	movabs $0x800055,%rax
+  800310:	00 00 00 
+  800313:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800315:	48 b8 2a 03 80 00 00 	movabs $0x80032a,%rax
+  80031c:	00 00 00 
+  80031f:	ff d0                	call   *%rax
+#endif
+}
+  800321:	5b                   	pop    %rbx
+  800322:	41 5c                	pop    %r12
+  800324:	41 5d                	pop    %r13
+  800326:	41 5e                	pop    %r14
+  800328:	5d                   	pop    %rbp
+  800329:	c3                   	ret
+
+000000000080032a <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80032a:	55                   	push   %rbp
+  80032b:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80032e:	48 b8 9a 1a 80 00 00 	movabs $0x801a9a,%rax
+  800335:	00 00 00 
+  800338:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80033a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80033f:	48 b8 31 12 80 00 00 	movabs $0x801231,%rax
+  800346:	00 00 00 
+  800349:	ff d0                	call   *%rax
+}
+  80034b:	5d                   	pop    %rbp
+  80034c:	c3                   	ret
+
+000000000080034d <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80034d:	55                   	push   %rbp
+  80034e:	48 89 e5             	mov    %rsp,%rbp
+  800351:	41 56                	push   %r14
+  800353:	41 55                	push   %r13
+  800355:	41 54                	push   %r12
+  800357:	53                   	push   %rbx
+  800358:	48 83 ec 50          	sub    $0x50,%rsp
+  80035c:	49 89 fc             	mov    %rdi,%r12
+  80035f:	41 89 f5             	mov    %esi,%r13d
+  800362:	48 89 d3             	mov    %rdx,%rbx
+  800365:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800369:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80036d:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800371:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800378:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80037c:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800380:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800384:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800388:	48 b8 10 60 80 00 00 	movabs $0x806010,%rax
+  80038f:	00 00 00 
+  800392:	4c 8b 30             	mov    (%rax),%r14
+  800395:	48 b8 94 12 80 00 00 	movabs $0x801294,%rax
+  80039c:	00 00 00 
+  80039f:	ff d0                	call   *%rax
+  8003a1:	89 c6                	mov    %eax,%esi
+  8003a3:	45 89 e8             	mov    %r13d,%r8d
+  8003a6:	4c 89 e1             	mov    %r12,%rcx
+  8003a9:	4c 89 f2             	mov    %r14,%rdx
+  8003ac:	48 bf f8 56 80 00 00 	movabs $0x8056f8,%rdi
+  8003b3:	00 00 00 
+  8003b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003bb:	49 bc 9d 04 80 00 00 	movabs $0x80049d,%r12
+  8003c2:	00 00 00 
+  8003c5:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8003c8:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8003cc:	48 89 df             	mov    %rbx,%rdi
+  8003cf:	48 b8 39 04 80 00 00 	movabs $0x800439,%rax
+  8003d6:	00 00 00 
+  8003d9:	ff d0                	call   *%rax
+    cprintf("\n");
+  8003db:	48 bf dd 56 80 00 00 	movabs $0x8056dd,%rdi
+  8003e2:	00 00 00 
+  8003e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003ea:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8003ed:	cc                   	int3
+  8003ee:	eb fd                	jmp    8003ed <_panic+0xa0>
+
+00000000008003f0 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8003f0:	55                   	push   %rbp
+  8003f1:	48 89 e5             	mov    %rsp,%rbp
+  8003f4:	53                   	push   %rbx
+  8003f5:	48 83 ec 08          	sub    $0x8,%rsp
+  8003f9:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8003fc:	8b 06                	mov    (%rsi),%eax
+  8003fe:	8d 50 01             	lea    0x1(%rax),%edx
+  800401:	89 16                	mov    %edx,(%rsi)
+  800403:	48 98                	cltq
+  800405:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80040a:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800410:	74 0a                	je     80041c <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800412:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800416:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80041a:	c9                   	leave
+  80041b:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80041c:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800420:	be ff 00 00 00       	mov    $0xff,%esi
+  800425:	48 b8 e9 11 80 00 00 	movabs $0x8011e9,%rax
+  80042c:	00 00 00 
+  80042f:	ff d0                	call   *%rax
+        state->offset = 0;
+  800431:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800437:	eb d9                	jmp    800412 <putch+0x22>
+
+0000000000800439 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800439:	55                   	push   %rbp
+  80043a:	48 89 e5             	mov    %rsp,%rbp
+  80043d:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800444:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800447:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80044e:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800453:	b8 00 00 00 00       	mov    $0x0,%eax
+  800458:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80045b:	48 89 f1             	mov    %rsi,%rcx
+  80045e:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800465:	48 bf f0 03 80 00 00 	movabs $0x8003f0,%rdi
+  80046c:	00 00 00 
+  80046f:	48 b8 ed 05 80 00 00 	movabs $0x8005ed,%rax
+  800476:	00 00 00 
+  800479:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80047b:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800482:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800489:	48 b8 e9 11 80 00 00 	movabs $0x8011e9,%rax
+  800490:	00 00 00 
+  800493:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800495:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80049b:	c9                   	leave
+  80049c:	c3                   	ret
+
+000000000080049d <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80049d:	55                   	push   %rbp
+  80049e:	48 89 e5             	mov    %rsp,%rbp
+  8004a1:	48 83 ec 50          	sub    $0x50,%rsp
+  8004a5:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8004a9:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8004ad:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004b1:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004b5:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8004b9:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8004c0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8004c4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004c8:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8004cc:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8004d0:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8004d4:	48 b8 39 04 80 00 00 	movabs $0x800439,%rax
+  8004db:	00 00 00 
+  8004de:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8004e0:	c9                   	leave
+  8004e1:	c3                   	ret
+
+00000000008004e2 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8004e2:	55                   	push   %rbp
+  8004e3:	48 89 e5             	mov    %rsp,%rbp
+  8004e6:	41 57                	push   %r15
+  8004e8:	41 56                	push   %r14
+  8004ea:	41 55                	push   %r13
+  8004ec:	41 54                	push   %r12
+  8004ee:	53                   	push   %rbx
+  8004ef:	48 83 ec 18          	sub    $0x18,%rsp
+  8004f3:	49 89 fc             	mov    %rdi,%r12
+  8004f6:	49 89 f5             	mov    %rsi,%r13
+  8004f9:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8004fd:	8b 45 10             	mov    0x10(%rbp),%eax
+  800500:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800503:	41 89 cf             	mov    %ecx,%r15d
+  800506:	4c 39 fa             	cmp    %r15,%rdx
+  800509:	73 5b                	jae    800566 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80050b:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80050f:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800513:	85 db                	test   %ebx,%ebx
+  800515:	7e 0e                	jle    800525 <print_num+0x43>
+            putch(padc, put_arg);
+  800517:	4c 89 ee             	mov    %r13,%rsi
+  80051a:	44 89 f7             	mov    %r14d,%edi
+  80051d:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800520:	83 eb 01             	sub    $0x1,%ebx
+  800523:	75 f2                	jne    800517 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800525:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800529:	48 b9 2c 57 80 00 00 	movabs $0x80572c,%rcx
+  800530:	00 00 00 
+  800533:	48 b8 1b 57 80 00 00 	movabs $0x80571b,%rax
+  80053a:	00 00 00 
+  80053d:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800541:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800545:	ba 00 00 00 00       	mov    $0x0,%edx
+  80054a:	49 f7 f7             	div    %r15
+  80054d:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800551:	4c 89 ee             	mov    %r13,%rsi
+  800554:	41 ff d4             	call   *%r12
+}
+  800557:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80055b:	5b                   	pop    %rbx
+  80055c:	41 5c                	pop    %r12
+  80055e:	41 5d                	pop    %r13
+  800560:	41 5e                	pop    %r14
+  800562:	41 5f                	pop    %r15
+  800564:	5d                   	pop    %rbp
+  800565:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800566:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80056a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80056f:	49 f7 f7             	div    %r15
+  800572:	48 83 ec 08          	sub    $0x8,%rsp
+  800576:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80057a:	52                   	push   %rdx
+  80057b:	45 0f be c9          	movsbl %r9b,%r9d
+  80057f:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800583:	48 89 c2             	mov    %rax,%rdx
+  800586:	48 b8 e2 04 80 00 00 	movabs $0x8004e2,%rax
+  80058d:	00 00 00 
+  800590:	ff d0                	call   *%rax
+  800592:	48 83 c4 10          	add    $0x10,%rsp
+  800596:	eb 8d                	jmp    800525 <print_num+0x43>
+
+0000000000800598 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800598:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80059c:	48 8b 06             	mov    (%rsi),%rax
+  80059f:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8005a3:	73 0a                	jae    8005af <sprintputch+0x17>
+        *state->start++ = ch;
+  8005a5:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8005a9:	48 89 16             	mov    %rdx,(%rsi)
+  8005ac:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8005af:	c3                   	ret
+
+00000000008005b0 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8005b0:	55                   	push   %rbp
+  8005b1:	48 89 e5             	mov    %rsp,%rbp
+  8005b4:	48 83 ec 50          	sub    $0x50,%rsp
+  8005b8:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8005bc:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8005c0:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8005c4:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8005cb:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8005cf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005d3:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8005d7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8005db:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8005df:	48 b8 ed 05 80 00 00 	movabs $0x8005ed,%rax
+  8005e6:	00 00 00 
+  8005e9:	ff d0                	call   *%rax
+}
+  8005eb:	c9                   	leave
+  8005ec:	c3                   	ret
+
+00000000008005ed <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8005ed:	55                   	push   %rbp
+  8005ee:	48 89 e5             	mov    %rsp,%rbp
+  8005f1:	41 57                	push   %r15
+  8005f3:	41 56                	push   %r14
+  8005f5:	41 55                	push   %r13
+  8005f7:	41 54                	push   %r12
+  8005f9:	53                   	push   %rbx
+  8005fa:	48 83 ec 38          	sub    $0x38,%rsp
+  8005fe:	49 89 fe             	mov    %rdi,%r14
+  800601:	49 89 f5             	mov    %rsi,%r13
+  800604:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800607:	48 8b 01             	mov    (%rcx),%rax
+  80060a:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80060e:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800612:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800616:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80061a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80061e:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800622:	0f b6 3b             	movzbl (%rbx),%edi
+  800625:	40 80 ff 25          	cmp    $0x25,%dil
+  800629:	74 18                	je     800643 <vprintfmt+0x56>
+            if (!ch) return;
+  80062b:	40 84 ff             	test   %dil,%dil
+  80062e:	0f 84 b1 06 00 00    	je     800ce5 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800634:	40 0f b6 ff          	movzbl %dil,%edi
+  800638:	4c 89 ee             	mov    %r13,%rsi
+  80063b:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80063e:	4c 89 e3             	mov    %r12,%rbx
+  800641:	eb db                	jmp    80061e <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800643:	be 00 00 00 00       	mov    $0x0,%esi
+  800648:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80064c:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800651:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800657:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80065e:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800662:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800667:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80066c:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80066f:	83 e8 23             	sub    $0x23,%eax
+  800672:	3c 57                	cmp    $0x57,%al
+  800674:	0f 87 51 06 00 00    	ja     800ccb <vprintfmt+0x6de>
+  80067a:	0f b6 c0             	movzbl %al,%eax
+  80067d:	48 b9 e0 58 80 00 00 	movabs $0x8058e0,%rcx
+  800684:	00 00 00 
+  800687:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80068a:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80068d:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800691:	eb cf                	jmp    800662 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800693:	49 89 dc             	mov    %rbx,%r12
+  800696:	be 01 00 00 00       	mov    $0x1,%esi
+  80069b:	eb c5                	jmp    800662 <vprintfmt+0x75>
+            padc = ch;
+  80069d:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8006a1:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8006a4:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8006a7:	eb b9                	jmp    800662 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8006a9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006ac:	83 f8 2f             	cmp    $0x2f,%eax
+  8006af:	77 24                	ja     8006d5 <vprintfmt+0xe8>
+  8006b1:	89 c1                	mov    %eax,%ecx
+  8006b3:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8006b7:	83 c0 08             	add    $0x8,%eax
+  8006ba:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006bd:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8006c0:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8006c3:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8006c7:	79 99                	jns    800662 <vprintfmt+0x75>
+                width = precision;
+  8006c9:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8006cd:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8006d3:	eb 8d                	jmp    800662 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8006d5:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8006d9:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8006dd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006e1:	eb da                	jmp    8006bd <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8006e3:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8006e8:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8006ec:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8006f2:	3c 39                	cmp    $0x39,%al
+  8006f4:	77 1c                	ja     800712 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8006f6:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8006fa:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8006fe:	0f b6 c0             	movzbl %al,%eax
+  800701:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800706:	0f b6 03             	movzbl (%rbx),%eax
+  800709:	3c 39                	cmp    $0x39,%al
+  80070b:	76 e9                	jbe    8006f6 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80070d:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800710:	eb b1                	jmp    8006c3 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800712:	49 89 dc             	mov    %rbx,%r12
+  800715:	eb ac                	jmp    8006c3 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800717:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80071a:	85 c9                	test   %ecx,%ecx
+  80071c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800721:	0f 49 c1             	cmovns %ecx,%eax
+  800724:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800727:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80072a:	e9 33 ff ff ff       	jmp    800662 <vprintfmt+0x75>
+            lflag++;
+  80072f:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800732:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800735:	e9 28 ff ff ff       	jmp    800662 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80073a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80073d:	83 f8 2f             	cmp    $0x2f,%eax
+  800740:	77 19                	ja     80075b <vprintfmt+0x16e>
+  800742:	89 c2                	mov    %eax,%edx
+  800744:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800748:	83 c0 08             	add    $0x8,%eax
+  80074b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80074e:	8b 3a                	mov    (%rdx),%edi
+  800750:	4c 89 ee             	mov    %r13,%rsi
+  800753:	41 ff d6             	call   *%r14
+            break;
+  800756:	e9 c3 fe ff ff       	jmp    80061e <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80075b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80075f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800763:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800767:	eb e5                	jmp    80074e <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800769:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80076c:	83 f8 2f             	cmp    $0x2f,%eax
+  80076f:	77 5a                	ja     8007cb <vprintfmt+0x1de>
+  800771:	89 c2                	mov    %eax,%edx
+  800773:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800777:	83 c0 08             	add    $0x8,%eax
+  80077a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80077d:	8b 02                	mov    (%rdx),%eax
+  80077f:	89 c1                	mov    %eax,%ecx
+  800781:	f7 d9                	neg    %ecx
+  800783:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800786:	83 f9 16             	cmp    $0x16,%ecx
+  800789:	7f 4e                	jg     8007d9 <vprintfmt+0x1ec>
+  80078b:	48 63 c1             	movslq %ecx,%rax
+  80078e:	48 ba a0 5b 80 00 00 	movabs $0x805ba0,%rdx
+  800795:	00 00 00 
+  800798:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80079c:	48 85 c0             	test   %rax,%rax
+  80079f:	74 38                	je     8007d9 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8007a1:	48 89 c1             	mov    %rax,%rcx
+  8007a4:	48 ba 63 5e 80 00 00 	movabs $0x805e63,%rdx
+  8007ab:	00 00 00 
+  8007ae:	4c 89 ee             	mov    %r13,%rsi
+  8007b1:	4c 89 f7             	mov    %r14,%rdi
+  8007b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007b9:	49 b8 b0 05 80 00 00 	movabs $0x8005b0,%r8
+  8007c0:	00 00 00 
+  8007c3:	41 ff d0             	call   *%r8
+  8007c6:	e9 53 fe ff ff       	jmp    80061e <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8007cb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007cf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007d3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007d7:	eb a4                	jmp    80077d <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8007d9:	48 ba 44 57 80 00 00 	movabs $0x805744,%rdx
+  8007e0:	00 00 00 
+  8007e3:	4c 89 ee             	mov    %r13,%rsi
+  8007e6:	4c 89 f7             	mov    %r14,%rdi
+  8007e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007ee:	49 b8 b0 05 80 00 00 	movabs $0x8005b0,%r8
+  8007f5:	00 00 00 
+  8007f8:	41 ff d0             	call   *%r8
+  8007fb:	e9 1e fe ff ff       	jmp    80061e <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800800:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800803:	83 f8 2f             	cmp    $0x2f,%eax
+  800806:	77 6c                	ja     800874 <vprintfmt+0x287>
+  800808:	89 c2                	mov    %eax,%edx
+  80080a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80080e:	83 c0 08             	add    $0x8,%eax
+  800811:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800814:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800817:	48 85 d2             	test   %rdx,%rdx
+  80081a:	48 b8 3d 57 80 00 00 	movabs $0x80573d,%rax
+  800821:	00 00 00 
+  800824:	48 0f 45 c2          	cmovne %rdx,%rax
+  800828:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80082c:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800830:	7e 06                	jle    800838 <vprintfmt+0x24b>
+  800832:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800836:	75 4a                	jne    800882 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800838:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80083c:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800840:	0f b6 00             	movzbl (%rax),%eax
+  800843:	84 c0                	test   %al,%al
+  800845:	0f 85 9a 00 00 00    	jne    8008e5 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80084b:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80084e:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800852:	85 c0                	test   %eax,%eax
+  800854:	0f 8e c4 fd ff ff    	jle    80061e <vprintfmt+0x31>
+  80085a:	4c 89 ee             	mov    %r13,%rsi
+  80085d:	bf 20 00 00 00       	mov    $0x20,%edi
+  800862:	41 ff d6             	call   *%r14
+  800865:	41 83 ec 01          	sub    $0x1,%r12d
+  800869:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80086d:	75 eb                	jne    80085a <vprintfmt+0x26d>
+  80086f:	e9 aa fd ff ff       	jmp    80061e <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800874:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800878:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80087c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800880:	eb 92                	jmp    800814 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800882:	49 63 f7             	movslq %r15d,%rsi
+  800885:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800889:	48 b8 9f 0d 80 00 00 	movabs $0x800d9f,%rax
+  800890:	00 00 00 
+  800893:	ff d0                	call   *%rax
+  800895:	48 89 c2             	mov    %rax,%rdx
+  800898:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80089b:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80089d:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8008a0:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8008a3:	85 c0                	test   %eax,%eax
+  8008a5:	7e 91                	jle    800838 <vprintfmt+0x24b>
+  8008a7:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8008ac:	4c 89 ee             	mov    %r13,%rsi
+  8008af:	44 89 e7             	mov    %r12d,%edi
+  8008b2:	41 ff d6             	call   *%r14
+  8008b5:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8008b9:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8008bc:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8008bf:	75 eb                	jne    8008ac <vprintfmt+0x2bf>
+  8008c1:	e9 72 ff ff ff       	jmp    800838 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8008c6:	0f b6 f8             	movzbl %al,%edi
+  8008c9:	4c 89 ee             	mov    %r13,%rsi
+  8008cc:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8008cf:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8008d3:	49 83 c4 01          	add    $0x1,%r12
+  8008d7:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8008dd:	84 c0                	test   %al,%al
+  8008df:	0f 84 66 ff ff ff    	je     80084b <vprintfmt+0x25e>
+  8008e5:	45 85 ff             	test   %r15d,%r15d
+  8008e8:	78 0a                	js     8008f4 <vprintfmt+0x307>
+  8008ea:	41 83 ef 01          	sub    $0x1,%r15d
+  8008ee:	0f 88 57 ff ff ff    	js     80084b <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8008f4:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8008f8:	74 cc                	je     8008c6 <vprintfmt+0x2d9>
+  8008fa:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8008fd:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800902:	80 fa 5e             	cmp    $0x5e,%dl
+  800905:	77 c2                	ja     8008c9 <vprintfmt+0x2dc>
+  800907:	eb bd                	jmp    8008c6 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800909:	40 84 f6             	test   %sil,%sil
+  80090c:	75 26                	jne    800934 <vprintfmt+0x347>
+    switch (lflag) {
+  80090e:	85 d2                	test   %edx,%edx
+  800910:	74 59                	je     80096b <vprintfmt+0x37e>
+  800912:	83 fa 01             	cmp    $0x1,%edx
+  800915:	74 7b                	je     800992 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800917:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80091a:	83 f8 2f             	cmp    $0x2f,%eax
+  80091d:	0f 87 96 00 00 00    	ja     8009b9 <vprintfmt+0x3cc>
+  800923:	89 c2                	mov    %eax,%edx
+  800925:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800929:	83 c0 08             	add    $0x8,%eax
+  80092c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80092f:	4c 8b 22             	mov    (%rdx),%r12
+  800932:	eb 17                	jmp    80094b <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800934:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800937:	83 f8 2f             	cmp    $0x2f,%eax
+  80093a:	77 21                	ja     80095d <vprintfmt+0x370>
+  80093c:	89 c2                	mov    %eax,%edx
+  80093e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800942:	83 c0 08             	add    $0x8,%eax
+  800945:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800948:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80094b:	4d 85 e4             	test   %r12,%r12
+  80094e:	78 7a                	js     8009ca <vprintfmt+0x3dd>
+            num = i;
+  800950:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800953:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800958:	e9 50 02 00 00       	jmp    800bad <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80095d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800961:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800965:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800969:	eb dd                	jmp    800948 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  80096b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80096e:	83 f8 2f             	cmp    $0x2f,%eax
+  800971:	77 11                	ja     800984 <vprintfmt+0x397>
+  800973:	89 c2                	mov    %eax,%edx
+  800975:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800979:	83 c0 08             	add    $0x8,%eax
+  80097c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80097f:	4c 63 22             	movslq (%rdx),%r12
+  800982:	eb c7                	jmp    80094b <vprintfmt+0x35e>
+  800984:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800988:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80098c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800990:	eb ed                	jmp    80097f <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800992:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800995:	83 f8 2f             	cmp    $0x2f,%eax
+  800998:	77 11                	ja     8009ab <vprintfmt+0x3be>
+  80099a:	89 c2                	mov    %eax,%edx
+  80099c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009a0:	83 c0 08             	add    $0x8,%eax
+  8009a3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009a6:	4c 8b 22             	mov    (%rdx),%r12
+  8009a9:	eb a0                	jmp    80094b <vprintfmt+0x35e>
+  8009ab:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009af:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009b3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009b7:	eb ed                	jmp    8009a6 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8009b9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009bd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009c1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009c5:	e9 65 ff ff ff       	jmp    80092f <vprintfmt+0x342>
+                putch('-', put_arg);
+  8009ca:	4c 89 ee             	mov    %r13,%rsi
+  8009cd:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8009d2:	41 ff d6             	call   *%r14
+                i = -i;
+  8009d5:	49 f7 dc             	neg    %r12
+  8009d8:	e9 73 ff ff ff       	jmp    800950 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8009dd:	40 84 f6             	test   %sil,%sil
+  8009e0:	75 32                	jne    800a14 <vprintfmt+0x427>
+    switch (lflag) {
+  8009e2:	85 d2                	test   %edx,%edx
+  8009e4:	74 5d                	je     800a43 <vprintfmt+0x456>
+  8009e6:	83 fa 01             	cmp    $0x1,%edx
+  8009e9:	0f 84 82 00 00 00    	je     800a71 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8009ef:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009f2:	83 f8 2f             	cmp    $0x2f,%eax
+  8009f5:	0f 87 a5 00 00 00    	ja     800aa0 <vprintfmt+0x4b3>
+  8009fb:	89 c2                	mov    %eax,%edx
+  8009fd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a01:	83 c0 08             	add    $0x8,%eax
+  800a04:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a07:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a0a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a0f:	e9 99 01 00 00       	jmp    800bad <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a14:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a17:	83 f8 2f             	cmp    $0x2f,%eax
+  800a1a:	77 19                	ja     800a35 <vprintfmt+0x448>
+  800a1c:	89 c2                	mov    %eax,%edx
+  800a1e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a22:	83 c0 08             	add    $0x8,%eax
+  800a25:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a28:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a2b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a30:	e9 78 01 00 00       	jmp    800bad <vprintfmt+0x5c0>
+  800a35:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a39:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a3d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a41:	eb e5                	jmp    800a28 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800a43:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a46:	83 f8 2f             	cmp    $0x2f,%eax
+  800a49:	77 18                	ja     800a63 <vprintfmt+0x476>
+  800a4b:	89 c2                	mov    %eax,%edx
+  800a4d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a51:	83 c0 08             	add    $0x8,%eax
+  800a54:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a57:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800a59:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800a5e:	e9 4a 01 00 00       	jmp    800bad <vprintfmt+0x5c0>
+  800a63:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a67:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a6b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a6f:	eb e6                	jmp    800a57 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800a71:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a74:	83 f8 2f             	cmp    $0x2f,%eax
+  800a77:	77 19                	ja     800a92 <vprintfmt+0x4a5>
+  800a79:	89 c2                	mov    %eax,%edx
+  800a7b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a7f:	83 c0 08             	add    $0x8,%eax
+  800a82:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a85:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a88:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800a8d:	e9 1b 01 00 00       	jmp    800bad <vprintfmt+0x5c0>
+  800a92:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a96:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a9a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a9e:	eb e5                	jmp    800a85 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800aa0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aa4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aa8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aac:	e9 56 ff ff ff       	jmp    800a07 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800ab1:	40 84 f6             	test   %sil,%sil
+  800ab4:	75 2e                	jne    800ae4 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800ab6:	85 d2                	test   %edx,%edx
+  800ab8:	74 59                	je     800b13 <vprintfmt+0x526>
+  800aba:	83 fa 01             	cmp    $0x1,%edx
+  800abd:	74 7f                	je     800b3e <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800abf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ac2:	83 f8 2f             	cmp    $0x2f,%eax
+  800ac5:	0f 87 9f 00 00 00    	ja     800b6a <vprintfmt+0x57d>
+  800acb:	89 c2                	mov    %eax,%edx
+  800acd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ad1:	83 c0 08             	add    $0x8,%eax
+  800ad4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ad7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800ada:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800adf:	e9 c9 00 00 00       	jmp    800bad <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800ae4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ae7:	83 f8 2f             	cmp    $0x2f,%eax
+  800aea:	77 19                	ja     800b05 <vprintfmt+0x518>
+  800aec:	89 c2                	mov    %eax,%edx
+  800aee:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800af2:	83 c0 08             	add    $0x8,%eax
+  800af5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800af8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800afb:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b00:	e9 a8 00 00 00       	jmp    800bad <vprintfmt+0x5c0>
+  800b05:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b09:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b0d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b11:	eb e5                	jmp    800af8 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800b13:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b16:	83 f8 2f             	cmp    $0x2f,%eax
+  800b19:	77 15                	ja     800b30 <vprintfmt+0x543>
+  800b1b:	89 c2                	mov    %eax,%edx
+  800b1d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b21:	83 c0 08             	add    $0x8,%eax
+  800b24:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b27:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800b29:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800b2e:	eb 7d                	jmp    800bad <vprintfmt+0x5c0>
+  800b30:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b34:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b38:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b3c:	eb e9                	jmp    800b27 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800b3e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b41:	83 f8 2f             	cmp    $0x2f,%eax
+  800b44:	77 16                	ja     800b5c <vprintfmt+0x56f>
+  800b46:	89 c2                	mov    %eax,%edx
+  800b48:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b4c:	83 c0 08             	add    $0x8,%eax
+  800b4f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b52:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800b55:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800b5a:	eb 51                	jmp    800bad <vprintfmt+0x5c0>
+  800b5c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b60:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b64:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b68:	eb e8                	jmp    800b52 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800b6a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b6e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b72:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b76:	e9 5c ff ff ff       	jmp    800ad7 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800b7b:	4c 89 ee             	mov    %r13,%rsi
+  800b7e:	bf 30 00 00 00       	mov    $0x30,%edi
+  800b83:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800b86:	4c 89 ee             	mov    %r13,%rsi
+  800b89:	bf 78 00 00 00       	mov    $0x78,%edi
+  800b8e:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800b91:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b94:	83 f8 2f             	cmp    $0x2f,%eax
+  800b97:	77 47                	ja     800be0 <vprintfmt+0x5f3>
+  800b99:	89 c2                	mov    %eax,%edx
+  800b9b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b9f:	83 c0 08             	add    $0x8,%eax
+  800ba2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ba5:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ba8:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800bad:	48 83 ec 08          	sub    $0x8,%rsp
+  800bb1:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800bb5:	0f 94 c0             	sete   %al
+  800bb8:	0f b6 c0             	movzbl %al,%eax
+  800bbb:	50                   	push   %rax
+  800bbc:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800bc1:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800bc5:	4c 89 ee             	mov    %r13,%rsi
+  800bc8:	4c 89 f7             	mov    %r14,%rdi
+  800bcb:	48 b8 e2 04 80 00 00 	movabs $0x8004e2,%rax
+  800bd2:	00 00 00 
+  800bd5:	ff d0                	call   *%rax
+            break;
+  800bd7:	48 83 c4 10          	add    $0x10,%rsp
+  800bdb:	e9 3e fa ff ff       	jmp    80061e <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800be0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800be4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800be8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bec:	eb b7                	jmp    800ba5 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800bee:	40 84 f6             	test   %sil,%sil
+  800bf1:	75 2b                	jne    800c1e <vprintfmt+0x631>
+    switch (lflag) {
+  800bf3:	85 d2                	test   %edx,%edx
+  800bf5:	74 56                	je     800c4d <vprintfmt+0x660>
+  800bf7:	83 fa 01             	cmp    $0x1,%edx
+  800bfa:	74 7f                	je     800c7b <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800bfc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bff:	83 f8 2f             	cmp    $0x2f,%eax
+  800c02:	0f 87 a2 00 00 00    	ja     800caa <vprintfmt+0x6bd>
+  800c08:	89 c2                	mov    %eax,%edx
+  800c0a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c0e:	83 c0 08             	add    $0x8,%eax
+  800c11:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c14:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c17:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800c1c:	eb 8f                	jmp    800bad <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800c1e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c21:	83 f8 2f             	cmp    $0x2f,%eax
+  800c24:	77 19                	ja     800c3f <vprintfmt+0x652>
+  800c26:	89 c2                	mov    %eax,%edx
+  800c28:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c2c:	83 c0 08             	add    $0x8,%eax
+  800c2f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c32:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c35:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800c3a:	e9 6e ff ff ff       	jmp    800bad <vprintfmt+0x5c0>
+  800c3f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c43:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c47:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c4b:	eb e5                	jmp    800c32 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800c4d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c50:	83 f8 2f             	cmp    $0x2f,%eax
+  800c53:	77 18                	ja     800c6d <vprintfmt+0x680>
+  800c55:	89 c2                	mov    %eax,%edx
+  800c57:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c5b:	83 c0 08             	add    $0x8,%eax
+  800c5e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c61:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800c63:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800c68:	e9 40 ff ff ff       	jmp    800bad <vprintfmt+0x5c0>
+  800c6d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c71:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c75:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c79:	eb e6                	jmp    800c61 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800c7b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c7e:	83 f8 2f             	cmp    $0x2f,%eax
+  800c81:	77 19                	ja     800c9c <vprintfmt+0x6af>
+  800c83:	89 c2                	mov    %eax,%edx
+  800c85:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c89:	83 c0 08             	add    $0x8,%eax
+  800c8c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c8f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c92:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800c97:	e9 11 ff ff ff       	jmp    800bad <vprintfmt+0x5c0>
+  800c9c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ca0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ca8:	eb e5                	jmp    800c8f <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800caa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cae:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cb2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cb6:	e9 59 ff ff ff       	jmp    800c14 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800cbb:	4c 89 ee             	mov    %r13,%rsi
+  800cbe:	bf 25 00 00 00       	mov    $0x25,%edi
+  800cc3:	41 ff d6             	call   *%r14
+            break;
+  800cc6:	e9 53 f9 ff ff       	jmp    80061e <vprintfmt+0x31>
+            putch('%', put_arg);
+  800ccb:	4c 89 ee             	mov    %r13,%rsi
+  800cce:	bf 25 00 00 00       	mov    $0x25,%edi
+  800cd3:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800cd6:	48 83 eb 01          	sub    $0x1,%rbx
+  800cda:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800cde:	75 f6                	jne    800cd6 <vprintfmt+0x6e9>
+  800ce0:	e9 39 f9 ff ff       	jmp    80061e <vprintfmt+0x31>
+}
+  800ce5:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800ce9:	5b                   	pop    %rbx
+  800cea:	41 5c                	pop    %r12
+  800cec:	41 5d                	pop    %r13
+  800cee:	41 5e                	pop    %r14
+  800cf0:	41 5f                	pop    %r15
+  800cf2:	5d                   	pop    %rbp
+  800cf3:	c3                   	ret
+
+0000000000800cf4 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800cf4:	55                   	push   %rbp
+  800cf5:	48 89 e5             	mov    %rsp,%rbp
+  800cf8:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800cfc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800d00:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800d05:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800d09:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800d10:	48 85 ff             	test   %rdi,%rdi
+  800d13:	74 2b                	je     800d40 <vsnprintf+0x4c>
+  800d15:	48 85 f6             	test   %rsi,%rsi
+  800d18:	74 26                	je     800d40 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800d1a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800d1e:	48 bf 98 05 80 00 00 	movabs $0x800598,%rdi
+  800d25:	00 00 00 
+  800d28:	48 b8 ed 05 80 00 00 	movabs $0x8005ed,%rax
+  800d2f:	00 00 00 
+  800d32:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800d34:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d38:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800d3b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800d3e:	c9                   	leave
+  800d3f:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800d40:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d45:	eb f7                	jmp    800d3e <vsnprintf+0x4a>
+
+0000000000800d47 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800d47:	55                   	push   %rbp
+  800d48:	48 89 e5             	mov    %rsp,%rbp
+  800d4b:	48 83 ec 50          	sub    $0x50,%rsp
+  800d4f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800d53:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800d57:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800d5b:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800d62:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800d66:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d6a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800d6e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800d72:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800d76:	48 b8 f4 0c 80 00 00 	movabs $0x800cf4,%rax
+  800d7d:	00 00 00 
+  800d80:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800d82:	c9                   	leave
+  800d83:	c3                   	ret
+
+0000000000800d84 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800d84:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800d87:	74 10                	je     800d99 <strlen+0x15>
+    size_t n = 0;
+  800d89:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800d8e:	48 83 c0 01          	add    $0x1,%rax
+  800d92:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800d96:	75 f6                	jne    800d8e <strlen+0xa>
+  800d98:	c3                   	ret
+    size_t n = 0;
+  800d99:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800d9e:	c3                   	ret
+
+0000000000800d9f <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800d9f:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800da2:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800da7:	48 85 f6             	test   %rsi,%rsi
+  800daa:	74 11                	je     800dbd <strnlen+0x1e>
+  800dac:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800db0:	74 0c                	je     800dbe <strnlen+0x1f>
+  800db2:	48 83 c2 01          	add    $0x1,%rdx
+  800db6:	48 39 d0             	cmp    %rdx,%rax
+  800db9:	75 f1                	jne    800dac <strnlen+0xd>
+  800dbb:	eb 04                	jmp    800dc1 <strnlen+0x22>
+  800dbd:	c3                   	ret
+  800dbe:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800dc1:	c3                   	ret
+
+0000000000800dc2 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800dc2:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800dc5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dca:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800dce:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800dd1:	48 83 c2 01          	add    $0x1,%rdx
+  800dd5:	84 c9                	test   %cl,%cl
+  800dd7:	75 f1                	jne    800dca <strcpy+0x8>
+        ;
+    return res;
+}
+  800dd9:	c3                   	ret
+
+0000000000800dda <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800dda:	55                   	push   %rbp
+  800ddb:	48 89 e5             	mov    %rsp,%rbp
+  800dde:	41 54                	push   %r12
+  800de0:	53                   	push   %rbx
+  800de1:	48 89 fb             	mov    %rdi,%rbx
+  800de4:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800de7:	48 b8 84 0d 80 00 00 	movabs $0x800d84,%rax
+  800dee:	00 00 00 
+  800df1:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800df3:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800df7:	4c 89 e6             	mov    %r12,%rsi
+  800dfa:	48 b8 c2 0d 80 00 00 	movabs $0x800dc2,%rax
+  800e01:	00 00 00 
+  800e04:	ff d0                	call   *%rax
+    return dst;
+}
+  800e06:	48 89 d8             	mov    %rbx,%rax
+  800e09:	5b                   	pop    %rbx
+  800e0a:	41 5c                	pop    %r12
+  800e0c:	5d                   	pop    %rbp
+  800e0d:	c3                   	ret
+
+0000000000800e0e <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800e0e:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800e11:	48 85 d2             	test   %rdx,%rdx
+  800e14:	74 1f                	je     800e35 <strncpy+0x27>
+  800e16:	48 01 fa             	add    %rdi,%rdx
+  800e19:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800e1c:	48 83 c1 01          	add    $0x1,%rcx
+  800e20:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800e24:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800e28:	41 80 f8 01          	cmp    $0x1,%r8b
+  800e2c:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800e30:	48 39 ca             	cmp    %rcx,%rdx
+  800e33:	75 e7                	jne    800e1c <strncpy+0xe>
+    }
+    return ret;
+}
+  800e35:	c3                   	ret
+
+0000000000800e36 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800e36:	48 89 f8             	mov    %rdi,%rax
+  800e39:	48 85 d2             	test   %rdx,%rdx
+  800e3c:	74 24                	je     800e62 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800e3e:	48 83 ea 01          	sub    $0x1,%rdx
+  800e42:	74 1b                	je     800e5f <strlcpy+0x29>
+  800e44:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800e48:	0f b6 16             	movzbl (%rsi),%edx
+  800e4b:	84 d2                	test   %dl,%dl
+  800e4d:	74 10                	je     800e5f <strlcpy+0x29>
+            *dst++ = *src++;
+  800e4f:	48 83 c6 01          	add    $0x1,%rsi
+  800e53:	48 83 c0 01          	add    $0x1,%rax
+  800e57:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800e5a:	48 39 c8             	cmp    %rcx,%rax
+  800e5d:	75 e9                	jne    800e48 <strlcpy+0x12>
+        *dst = '\0';
+  800e5f:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800e62:	48 29 f8             	sub    %rdi,%rax
+}
+  800e65:	c3                   	ret
+
+0000000000800e66 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800e66:	0f b6 07             	movzbl (%rdi),%eax
+  800e69:	84 c0                	test   %al,%al
+  800e6b:	74 13                	je     800e80 <strcmp+0x1a>
+  800e6d:	38 06                	cmp    %al,(%rsi)
+  800e6f:	75 0f                	jne    800e80 <strcmp+0x1a>
+  800e71:	48 83 c7 01          	add    $0x1,%rdi
+  800e75:	48 83 c6 01          	add    $0x1,%rsi
+  800e79:	0f b6 07             	movzbl (%rdi),%eax
+  800e7c:	84 c0                	test   %al,%al
+  800e7e:	75 ed                	jne    800e6d <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800e80:	0f b6 c0             	movzbl %al,%eax
+  800e83:	0f b6 16             	movzbl (%rsi),%edx
+  800e86:	29 d0                	sub    %edx,%eax
+}
+  800e88:	c3                   	ret
+
+0000000000800e89 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800e89:	48 85 d2             	test   %rdx,%rdx
+  800e8c:	74 1f                	je     800ead <strncmp+0x24>
+  800e8e:	0f b6 07             	movzbl (%rdi),%eax
+  800e91:	84 c0                	test   %al,%al
+  800e93:	74 1e                	je     800eb3 <strncmp+0x2a>
+  800e95:	3a 06                	cmp    (%rsi),%al
+  800e97:	75 1a                	jne    800eb3 <strncmp+0x2a>
+  800e99:	48 83 c7 01          	add    $0x1,%rdi
+  800e9d:	48 83 c6 01          	add    $0x1,%rsi
+  800ea1:	48 83 ea 01          	sub    $0x1,%rdx
+  800ea5:	75 e7                	jne    800e8e <strncmp+0x5>
+
+    if (!n) return 0;
+  800ea7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800eac:	c3                   	ret
+  800ead:	b8 00 00 00 00       	mov    $0x0,%eax
+  800eb2:	c3                   	ret
+  800eb3:	48 85 d2             	test   %rdx,%rdx
+  800eb6:	74 09                	je     800ec1 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800eb8:	0f b6 07             	movzbl (%rdi),%eax
+  800ebb:	0f b6 16             	movzbl (%rsi),%edx
+  800ebe:	29 d0                	sub    %edx,%eax
+  800ec0:	c3                   	ret
+    if (!n) return 0;
+  800ec1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ec6:	c3                   	ret
+
+0000000000800ec7 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800ec7:	0f b6 17             	movzbl (%rdi),%edx
+  800eca:	84 d2                	test   %dl,%dl
+  800ecc:	74 18                	je     800ee6 <strchr+0x1f>
+        if (*str == c) {
+  800ece:	0f be d2             	movsbl %dl,%edx
+  800ed1:	39 f2                	cmp    %esi,%edx
+  800ed3:	74 17                	je     800eec <strchr+0x25>
+    for (; *str; str++) {
+  800ed5:	48 83 c7 01          	add    $0x1,%rdi
+  800ed9:	0f b6 17             	movzbl (%rdi),%edx
+  800edc:	84 d2                	test   %dl,%dl
+  800ede:	75 ee                	jne    800ece <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800ee0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ee5:	c3                   	ret
+  800ee6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800eeb:	c3                   	ret
+  800eec:	48 89 f8             	mov    %rdi,%rax
+}
+  800eef:	c3                   	ret
+
+0000000000800ef0 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800ef0:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800ef3:	0f b6 17             	movzbl (%rdi),%edx
+  800ef6:	84 d2                	test   %dl,%dl
+  800ef8:	74 13                	je     800f0d <strfind+0x1d>
+  800efa:	0f be d2             	movsbl %dl,%edx
+  800efd:	39 f2                	cmp    %esi,%edx
+  800eff:	74 0b                	je     800f0c <strfind+0x1c>
+  800f01:	48 83 c0 01          	add    $0x1,%rax
+  800f05:	0f b6 10             	movzbl (%rax),%edx
+  800f08:	84 d2                	test   %dl,%dl
+  800f0a:	75 ee                	jne    800efa <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800f0c:	c3                   	ret
+  800f0d:	c3                   	ret
+
+0000000000800f0e <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800f0e:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800f11:	48 89 f8             	mov    %rdi,%rax
+  800f14:	48 f7 d8             	neg    %rax
+  800f17:	83 e0 07             	and    $0x7,%eax
+  800f1a:	49 89 d1             	mov    %rdx,%r9
+  800f1d:	49 29 c1             	sub    %rax,%r9
+  800f20:	78 36                	js     800f58 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800f22:	40 0f b6 c6          	movzbl %sil,%eax
+  800f26:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800f2d:	01 01 01 
+  800f30:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800f34:	40 f6 c7 07          	test   $0x7,%dil
+  800f38:	75 38                	jne    800f72 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800f3a:	4c 89 c9             	mov    %r9,%rcx
+  800f3d:	48 c1 f9 03          	sar    $0x3,%rcx
+  800f41:	74 0c                	je     800f4f <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800f43:	fc                   	cld
+  800f44:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800f47:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800f4b:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800f4f:	4d 85 c9             	test   %r9,%r9
+  800f52:	75 45                	jne    800f99 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800f54:	4c 89 c0             	mov    %r8,%rax
+  800f57:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800f58:	48 85 d2             	test   %rdx,%rdx
+  800f5b:	74 f7                	je     800f54 <memset+0x46>
+  800f5d:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800f60:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800f63:	48 83 c0 01          	add    $0x1,%rax
+  800f67:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800f6b:	48 39 c2             	cmp    %rax,%rdx
+  800f6e:	75 f3                	jne    800f63 <memset+0x55>
+  800f70:	eb e2                	jmp    800f54 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800f72:	40 f6 c7 01          	test   $0x1,%dil
+  800f76:	74 06                	je     800f7e <memset+0x70>
+  800f78:	88 07                	mov    %al,(%rdi)
+  800f7a:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800f7e:	40 f6 c7 02          	test   $0x2,%dil
+  800f82:	74 07                	je     800f8b <memset+0x7d>
+  800f84:	66 89 07             	mov    %ax,(%rdi)
+  800f87:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800f8b:	40 f6 c7 04          	test   $0x4,%dil
+  800f8f:	74 a9                	je     800f3a <memset+0x2c>
+  800f91:	89 07                	mov    %eax,(%rdi)
+  800f93:	48 83 c7 04          	add    $0x4,%rdi
+  800f97:	eb a1                	jmp    800f3a <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800f99:	41 f6 c1 04          	test   $0x4,%r9b
+  800f9d:	74 06                	je     800fa5 <memset+0x97>
+  800f9f:	89 07                	mov    %eax,(%rdi)
+  800fa1:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800fa5:	41 f6 c1 02          	test   $0x2,%r9b
+  800fa9:	74 07                	je     800fb2 <memset+0xa4>
+  800fab:	66 89 07             	mov    %ax,(%rdi)
+  800fae:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800fb2:	41 f6 c1 01          	test   $0x1,%r9b
+  800fb6:	74 9c                	je     800f54 <memset+0x46>
+  800fb8:	88 07                	mov    %al,(%rdi)
+  800fba:	eb 98                	jmp    800f54 <memset+0x46>
+
+0000000000800fbc <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800fbc:	48 89 f8             	mov    %rdi,%rax
+  800fbf:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800fc2:	48 39 fe             	cmp    %rdi,%rsi
+  800fc5:	73 3b                	jae    801002 <memmove+0x46>
+  800fc7:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800fcb:	48 39 d7             	cmp    %rdx,%rdi
+  800fce:	73 32                	jae    801002 <memmove+0x46>
+        s += n;
+        d += n;
+  800fd0:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800fd4:	48 89 d6             	mov    %rdx,%rsi
+  800fd7:	48 09 fe             	or     %rdi,%rsi
+  800fda:	48 09 ce             	or     %rcx,%rsi
+  800fdd:	40 f6 c6 07          	test   $0x7,%sil
+  800fe1:	75 12                	jne    800ff5 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800fe3:	48 83 ef 08          	sub    $0x8,%rdi
+  800fe7:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800feb:	48 c1 e9 03          	shr    $0x3,%rcx
+  800fef:	fd                   	std
+  800ff0:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800ff3:	fc                   	cld
+  800ff4:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800ff5:	48 83 ef 01          	sub    $0x1,%rdi
+  800ff9:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800ffd:	fd                   	std
+  800ffe:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801000:	eb f1                	jmp    800ff3 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801002:	48 89 f2             	mov    %rsi,%rdx
+  801005:	48 09 c2             	or     %rax,%rdx
+  801008:	48 09 ca             	or     %rcx,%rdx
+  80100b:	f6 c2 07             	test   $0x7,%dl
+  80100e:	75 0c                	jne    80101c <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801010:	48 c1 e9 03          	shr    $0x3,%rcx
+  801014:	48 89 c7             	mov    %rax,%rdi
+  801017:	fc                   	cld
+  801018:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80101b:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  80101c:	48 89 c7             	mov    %rax,%rdi
+  80101f:	fc                   	cld
+  801020:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801022:	c3                   	ret
+
+0000000000801023 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801023:	55                   	push   %rbp
+  801024:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801027:	48 b8 bc 0f 80 00 00 	movabs $0x800fbc,%rax
+  80102e:	00 00 00 
+  801031:	ff d0                	call   *%rax
+}
+  801033:	5d                   	pop    %rbp
+  801034:	c3                   	ret
+
+0000000000801035 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801035:	55                   	push   %rbp
+  801036:	48 89 e5             	mov    %rsp,%rbp
+  801039:	41 57                	push   %r15
+  80103b:	41 56                	push   %r14
+  80103d:	41 55                	push   %r13
+  80103f:	41 54                	push   %r12
+  801041:	53                   	push   %rbx
+  801042:	48 83 ec 08          	sub    $0x8,%rsp
+  801046:	49 89 fe             	mov    %rdi,%r14
+  801049:	49 89 f7             	mov    %rsi,%r15
+  80104c:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80104f:	48 89 f7             	mov    %rsi,%rdi
+  801052:	48 b8 84 0d 80 00 00 	movabs $0x800d84,%rax
+  801059:	00 00 00 
+  80105c:	ff d0                	call   *%rax
+  80105e:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801061:	48 89 de             	mov    %rbx,%rsi
+  801064:	4c 89 f7             	mov    %r14,%rdi
+  801067:	48 b8 9f 0d 80 00 00 	movabs $0x800d9f,%rax
+  80106e:	00 00 00 
+  801071:	ff d0                	call   *%rax
+  801073:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801076:	48 39 c3             	cmp    %rax,%rbx
+  801079:	74 36                	je     8010b1 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80107b:	48 89 d8             	mov    %rbx,%rax
+  80107e:	4c 29 e8             	sub    %r13,%rax
+  801081:	49 39 c4             	cmp    %rax,%r12
+  801084:	73 31                	jae    8010b7 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801086:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80108b:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80108f:	4c 89 fe             	mov    %r15,%rsi
+  801092:	48 b8 23 10 80 00 00 	movabs $0x801023,%rax
+  801099:	00 00 00 
+  80109c:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80109e:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8010a2:	48 83 c4 08          	add    $0x8,%rsp
+  8010a6:	5b                   	pop    %rbx
+  8010a7:	41 5c                	pop    %r12
+  8010a9:	41 5d                	pop    %r13
+  8010ab:	41 5e                	pop    %r14
+  8010ad:	41 5f                	pop    %r15
+  8010af:	5d                   	pop    %rbp
+  8010b0:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8010b1:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8010b5:	eb eb                	jmp    8010a2 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8010b7:	48 83 eb 01          	sub    $0x1,%rbx
+  8010bb:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8010bf:	48 89 da             	mov    %rbx,%rdx
+  8010c2:	4c 89 fe             	mov    %r15,%rsi
+  8010c5:	48 b8 23 10 80 00 00 	movabs $0x801023,%rax
+  8010cc:	00 00 00 
+  8010cf:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8010d1:	49 01 de             	add    %rbx,%r14
+  8010d4:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8010d9:	eb c3                	jmp    80109e <strlcat+0x69>
+
+00000000008010db <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8010db:	48 85 d2             	test   %rdx,%rdx
+  8010de:	74 2d                	je     80110d <memcmp+0x32>
+  8010e0:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8010e5:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8010e9:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8010ee:	44 38 c1             	cmp    %r8b,%cl
+  8010f1:	75 0f                	jne    801102 <memcmp+0x27>
+    while (n-- > 0) {
+  8010f3:	48 83 c0 01          	add    $0x1,%rax
+  8010f7:	48 39 c2             	cmp    %rax,%rdx
+  8010fa:	75 e9                	jne    8010e5 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8010fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801101:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801102:	0f b6 c1             	movzbl %cl,%eax
+  801105:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801109:	44 29 c0             	sub    %r8d,%eax
+  80110c:	c3                   	ret
+    return 0;
+  80110d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801112:	c3                   	ret
+
+0000000000801113 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801113:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801117:	48 39 c7             	cmp    %rax,%rdi
+  80111a:	73 0f                	jae    80112b <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80111c:	40 38 37             	cmp    %sil,(%rdi)
+  80111f:	74 0e                	je     80112f <memfind+0x1c>
+    for (; src < end; src++) {
+  801121:	48 83 c7 01          	add    $0x1,%rdi
+  801125:	48 39 f8             	cmp    %rdi,%rax
+  801128:	75 f2                	jne    80111c <memfind+0x9>
+  80112a:	c3                   	ret
+  80112b:	48 89 f8             	mov    %rdi,%rax
+  80112e:	c3                   	ret
+  80112f:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801132:	c3                   	ret
+
+0000000000801133 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801133:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801136:	0f b6 37             	movzbl (%rdi),%esi
+  801139:	40 80 fe 20          	cmp    $0x20,%sil
+  80113d:	74 06                	je     801145 <strtol+0x12>
+  80113f:	40 80 fe 09          	cmp    $0x9,%sil
+  801143:	75 13                	jne    801158 <strtol+0x25>
+  801145:	48 83 c7 01          	add    $0x1,%rdi
+  801149:	0f b6 37             	movzbl (%rdi),%esi
+  80114c:	40 80 fe 20          	cmp    $0x20,%sil
+  801150:	74 f3                	je     801145 <strtol+0x12>
+  801152:	40 80 fe 09          	cmp    $0x9,%sil
+  801156:	74 ed                	je     801145 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801158:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80115b:	83 e0 fd             	and    $0xfffffffd,%eax
+  80115e:	3c 01                	cmp    $0x1,%al
+  801160:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801164:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80116a:	75 0f                	jne    80117b <strtol+0x48>
+  80116c:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80116f:	74 14                	je     801185 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801171:	85 d2                	test   %edx,%edx
+  801173:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801178:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80117b:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801180:	4c 63 ca             	movslq %edx,%r9
+  801183:	eb 36                	jmp    8011bb <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801185:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801189:	74 0f                	je     80119a <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80118b:	85 d2                	test   %edx,%edx
+  80118d:	75 ec                	jne    80117b <strtol+0x48>
+        s++;
+  80118f:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801193:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801198:	eb e1                	jmp    80117b <strtol+0x48>
+        s += 2;
+  80119a:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80119e:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8011a3:	eb d6                	jmp    80117b <strtol+0x48>
+            dig -= '0';
+  8011a5:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8011a8:	44 0f b6 c1          	movzbl %cl,%r8d
+  8011ac:	41 39 d0             	cmp    %edx,%r8d
+  8011af:	7d 21                	jge    8011d2 <strtol+0x9f>
+        val = val * base + dig;
+  8011b1:	49 0f af c1          	imul   %r9,%rax
+  8011b5:	0f b6 c9             	movzbl %cl,%ecx
+  8011b8:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8011bb:	48 83 c7 01          	add    $0x1,%rdi
+  8011bf:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8011c3:	80 f9 39             	cmp    $0x39,%cl
+  8011c6:	76 dd                	jbe    8011a5 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8011c8:	80 f9 7b             	cmp    $0x7b,%cl
+  8011cb:	77 05                	ja     8011d2 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8011cd:	83 e9 57             	sub    $0x57,%ecx
+  8011d0:	eb d6                	jmp    8011a8 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8011d2:	4d 85 d2             	test   %r10,%r10
+  8011d5:	74 03                	je     8011da <strtol+0xa7>
+  8011d7:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8011da:	48 89 c2             	mov    %rax,%rdx
+  8011dd:	48 f7 da             	neg    %rdx
+  8011e0:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8011e4:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8011e8:	c3                   	ret
+
+00000000008011e9 <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  8011e9:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8011ee:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011f3:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8011f9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011ff:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  801205:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801207:	c3                   	ret
+
+0000000000801208 <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  801208:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80120d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801212:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801217:	ba 00 00 00 00       	mov    $0x0,%edx
+  80121c:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801222:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801228:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80122e:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801230:	c3                   	ret
+
+0000000000801231 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801231:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801234:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801239:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80123e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801243:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801249:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80124f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801255:	0f 05                	syscall
+    if (check && ret > 0) {
+  801257:	48 85 c0             	test   %rax,%rax
+  80125a:	7f 01                	jg     80125d <sys_env_destroy+0x2c>
+}
+  80125c:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  80125d:	55                   	push   %rbp
+  80125e:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801261:	49 89 c0             	mov    %rax,%r8
+  801264:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801269:	48 ba 78 5c 80 00 00 	movabs $0x805c78,%rdx
+  801270:	00 00 00 
+  801273:	be 29 00 00 00       	mov    $0x29,%esi
+  801278:	48 bf 97 5c 80 00 00 	movabs $0x805c97,%rdi
+  80127f:	00 00 00 
+  801282:	b8 00 00 00 00       	mov    $0x0,%eax
+  801287:	49 b9 4d 03 80 00 00 	movabs $0x80034d,%r9
+  80128e:	00 00 00 
+  801291:	41 ff d1             	call   *%r9
+
+0000000000801294 <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  801294:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801299:	bf 00 00 00 00       	mov    $0x0,%edi
+  80129e:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8012a3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012a8:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8012ae:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8012b4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8012ba:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8012bc:	c3                   	ret
+
+00000000008012bd <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  8012bd:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8012c2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8012c7:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8012cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012d1:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8012d7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8012dd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8012e3:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8012e5:	c3                   	ret
+
+00000000008012e6 <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  8012e6:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8012eb:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  8012f2:	00 00 00 
+  8012f5:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8012fb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801301:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801307:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801309:	c3                   	ret
+
+000000000080130a <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80130a:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  80130d:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801312:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801318:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80131e:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801320:	c3                   	ret
+
+0000000000801321 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801321:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801324:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801329:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80132c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801332:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801338:	0f 05                	syscall
+    if (check && ret > 0) {
+  80133a:	48 85 c0             	test   %rax,%rax
+  80133d:	7f 01                	jg     801340 <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80133f:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801340:	55                   	push   %rbp
+  801341:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801344:	49 89 c0             	mov    %rax,%r8
+  801347:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80134c:	48 ba 78 5c 80 00 00 	movabs $0x805c78,%rdx
+  801353:	00 00 00 
+  801356:	be 29 00 00 00       	mov    $0x29,%esi
+  80135b:	48 bf 97 5c 80 00 00 	movabs $0x805c97,%rdi
+  801362:	00 00 00 
+  801365:	b8 00 00 00 00       	mov    $0x0,%eax
+  80136a:	49 b9 4d 03 80 00 00 	movabs $0x80034d,%r9
+  801371:	00 00 00 
+  801374:	41 ff d1             	call   *%r9
+
+0000000000801377 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801377:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80137a:	48 63 d2             	movslq %edx,%rdx
+  80137d:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801380:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801385:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  801388:	0f 05                	syscall
+    if (check && ret > 0) {
+  80138a:	48 85 c0             	test   %rax,%rax
+  80138d:	7f 01                	jg     801390 <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80138f:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801390:	55                   	push   %rbp
+  801391:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801394:	49 89 c0             	mov    %rax,%r8
+  801397:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80139c:	48 ba 78 5c 80 00 00 	movabs $0x805c78,%rdx
+  8013a3:	00 00 00 
+  8013a6:	be 29 00 00 00       	mov    $0x29,%esi
+  8013ab:	48 bf 97 5c 80 00 00 	movabs $0x805c97,%rdi
+  8013b2:	00 00 00 
+  8013b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013ba:	49 b9 4d 03 80 00 00 	movabs $0x80034d,%r9
+  8013c1:	00 00 00 
+  8013c4:	41 ff d1             	call   *%r9
+
+00000000008013c7 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8013c7:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8013ca:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8013cf:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013d5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013db:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013e1:	0f 05                	syscall
+    if (check && ret > 0) {
+  8013e3:	48 85 c0             	test   %rax,%rax
+  8013e6:	7f 01                	jg     8013e9 <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8013e8:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8013e9:	55                   	push   %rbp
+  8013ea:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013ed:	49 89 c0             	mov    %rax,%r8
+  8013f0:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8013f5:	48 ba 78 5c 80 00 00 	movabs $0x805c78,%rdx
+  8013fc:	00 00 00 
+  8013ff:	be 29 00 00 00       	mov    $0x29,%esi
+  801404:	48 bf 97 5c 80 00 00 	movabs $0x805c97,%rdi
+  80140b:	00 00 00 
+  80140e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801413:	49 b9 4d 03 80 00 00 	movabs $0x80034d,%r9
+  80141a:	00 00 00 
+  80141d:	41 ff d1             	call   *%r9
+
+0000000000801420 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801420:	48 63 f6             	movslq %esi,%rsi
+  801423:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801426:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80142b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801430:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801436:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80143c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801442:	0f 05                	syscall
+    if (check && ret > 0) {
+  801444:	48 85 c0             	test   %rax,%rax
+  801447:	7f 01                	jg     80144a <sys_env_set_status+0x2a>
+}
+  801449:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  80144a:	55                   	push   %rbp
+  80144b:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80144e:	49 89 c0             	mov    %rax,%r8
+  801451:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801456:	48 ba 78 5c 80 00 00 	movabs $0x805c78,%rdx
+  80145d:	00 00 00 
+  801460:	be 29 00 00 00       	mov    $0x29,%esi
+  801465:	48 bf 97 5c 80 00 00 	movabs $0x805c97,%rdi
+  80146c:	00 00 00 
+  80146f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801474:	49 b9 4d 03 80 00 00 	movabs $0x80034d,%r9
+  80147b:	00 00 00 
+  80147e:	41 ff d1             	call   *%r9
+
+0000000000801481 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801481:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801484:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801489:	ba 00 00 00 00       	mov    $0x0,%edx
+  80148e:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801494:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80149a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8014a0:	0f 05                	syscall
+    if (check && ret > 0) {
+  8014a2:	48 85 c0             	test   %rax,%rax
+  8014a5:	7f 01                	jg     8014a8 <sys_env_set_trapframe+0x27>
+}
+  8014a7:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8014a8:	55                   	push   %rbp
+  8014a9:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014ac:	49 89 c0             	mov    %rax,%r8
+  8014af:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8014b4:	48 ba 78 5c 80 00 00 	movabs $0x805c78,%rdx
+  8014bb:	00 00 00 
+  8014be:	be 29 00 00 00       	mov    $0x29,%esi
+  8014c3:	48 bf 97 5c 80 00 00 	movabs $0x805c97,%rdi
+  8014ca:	00 00 00 
+  8014cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014d2:	49 b9 4d 03 80 00 00 	movabs $0x80034d,%r9
+  8014d9:	00 00 00 
+  8014dc:	41 ff d1             	call   *%r9
+
+00000000008014df <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8014df:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8014e2:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8014e7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014ec:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014f2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014f8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8014fe:	0f 05                	syscall
+    if (check && ret > 0) {
+  801500:	48 85 c0             	test   %rax,%rax
+  801503:	7f 01                	jg     801506 <sys_env_set_pgfault_upcall+0x27>
+}
+  801505:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801506:	55                   	push   %rbp
+  801507:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80150a:	49 89 c0             	mov    %rax,%r8
+  80150d:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801512:	48 ba 78 5c 80 00 00 	movabs $0x805c78,%rdx
+  801519:	00 00 00 
+  80151c:	be 29 00 00 00       	mov    $0x29,%esi
+  801521:	48 bf 97 5c 80 00 00 	movabs $0x805c97,%rdi
+  801528:	00 00 00 
+  80152b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801530:	49 b9 4d 03 80 00 00 	movabs $0x80034d,%r9
+  801537:	00 00 00 
+  80153a:	41 ff d1             	call   *%r9
+
+000000000080153d <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80153d:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801540:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801543:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801548:	4d 63 c0             	movslq %r8d,%r8
+  80154b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801551:	0f 05                	syscall
+}
+  801553:	c3                   	ret
+
+0000000000801554 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801554:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801557:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80155a:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80155f:	4d 63 c0             	movslq %r8d,%r8
+  801562:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801568:	0f 05                	syscall
+}
+  80156a:	c3                   	ret
+
+000000000080156b <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  80156b:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801570:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801573:	45 89 c0             	mov    %r8d,%r8d
+  801576:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80157c:	0f 05                	syscall
+    if (check && ret > 0) {
+  80157e:	48 85 c0             	test   %rax,%rax
+  801581:	7f 01                	jg     801584 <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801583:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  801584:	55                   	push   %rbp
+  801585:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801588:	49 89 c0             	mov    %rax,%r8
+  80158b:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801590:	48 ba 78 5c 80 00 00 	movabs $0x805c78,%rdx
+  801597:	00 00 00 
+  80159a:	be 29 00 00 00       	mov    $0x29,%esi
+  80159f:	48 bf 97 5c 80 00 00 	movabs $0x805c97,%rdi
+  8015a6:	00 00 00 
+  8015a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015ae:	49 b9 4d 03 80 00 00 	movabs $0x80034d,%r9
+  8015b5:	00 00 00 
+  8015b8:	41 ff d1             	call   *%r9
+
+00000000008015bb <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  8015bb:	55                   	push   %rbp
+  8015bc:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  8015bf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8015c5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015cf:	48 b8 6b 15 80 00 00 	movabs $0x80156b,%rax
+  8015d6:	00 00 00 
+  8015d9:	ff d0                	call   *%rax
+}
+  8015db:	5d                   	pop    %rbp
+  8015dc:	c3                   	ret
+
+00000000008015dd <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  8015dd:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8015e2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015e7:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8015ec:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015f1:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8015f7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8015fd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801603:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801605:	c3                   	ret
+
+0000000000801606 <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  801606:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80160b:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801610:	ba 00 00 00 00       	mov    $0x0,%edx
+  801615:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80161b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801621:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801627:	0f 05                	syscall
+    if (check && ret > 0) {
+  801629:	48 85 c0             	test   %rax,%rax
+  80162c:	7f 01                	jg     80162f <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  80162e:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  80162f:	55                   	push   %rbp
+  801630:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801633:	49 89 c0             	mov    %rax,%r8
+  801636:	b9 10 00 00 00       	mov    $0x10,%ecx
+  80163b:	48 ba 78 5c 80 00 00 	movabs $0x805c78,%rdx
+  801642:	00 00 00 
+  801645:	be 29 00 00 00       	mov    $0x29,%esi
+  80164a:	48 bf 97 5c 80 00 00 	movabs $0x805c97,%rdi
+  801651:	00 00 00 
+  801654:	b8 00 00 00 00       	mov    $0x0,%eax
+  801659:	49 b9 4d 03 80 00 00 	movabs $0x80034d,%r9
+  801660:	00 00 00 
+  801663:	41 ff d1             	call   *%r9
+
+0000000000801666 <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  801666:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80166b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801670:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801675:	ba 00 00 00 00       	mov    $0x0,%edx
+  80167a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801680:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801686:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80168c:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  80168e:	c3                   	ret
+
+000000000080168f <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  80168f:	89 d2                	mov    %edx,%edx
+  801691:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  801693:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801698:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80169e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8016a4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8016aa:	0f 05                	syscall
+}
+  8016ac:	c3                   	ret
+
+00000000008016ad <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  8016ad:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  8016b0:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8016b5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016ba:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8016c0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8016c6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8016cc:	0f 05                	syscall
+}
+  8016ce:	c3                   	ret
+
+00000000008016cf <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  8016cf:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  8016d2:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8016d7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016dc:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8016e2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8016e8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8016ee:	0f 05                	syscall
+}
+  8016f0:	c3                   	ret
+
+00000000008016f1 <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  8016f1:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8016f4:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8016f9:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8016fe:	ba 00 00 00 00       	mov    $0x0,%edx
+  801703:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801709:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80170f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801715:	0f 05                	syscall
+    if (check && ret > 0) {
+  801717:	48 85 c0             	test   %rax,%rax
+  80171a:	7f 01                	jg     80171d <sys_irq_ack+0x2c>
+}
+  80171c:	c3                   	ret
+sys_irq_ack(int irq) {
+  80171d:	55                   	push   %rbp
+  80171e:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801721:	49 89 c0             	mov    %rax,%r8
+  801724:	b9 16 00 00 00       	mov    $0x16,%ecx
+  801729:	48 ba 78 5c 80 00 00 	movabs $0x805c78,%rdx
+  801730:	00 00 00 
+  801733:	be 29 00 00 00       	mov    $0x29,%esi
+  801738:	48 bf 97 5c 80 00 00 	movabs $0x805c97,%rdi
+  80173f:	00 00 00 
+  801742:	b8 00 00 00 00       	mov    $0x0,%eax
+  801747:	49 b9 4d 03 80 00 00 	movabs $0x80034d,%r9
+  80174e:	00 00 00 
+  801751:	41 ff d1             	call   *%r9
+
+0000000000801754 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  801754:	55                   	push   %rbp
+  801755:	48 89 e5             	mov    %rsp,%rbp
+  801758:	41 54                	push   %r12
+  80175a:	53                   	push   %rbx
+    // LAB 9: Your code here
+    /* The child would write them out once more */
+    file_flush_buffers();
+  80175b:	48 b8 88 31 80 00 00 	movabs $0x803188,%rax
+  801762:	00 00 00 
+  801765:	ff d0                	call   *%rax
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("syscall"
+  801767:	b8 08 00 00 00       	mov    $0x8,%eax
+  80176c:	0f 05                	syscall
+  80176e:	41 89 c4             	mov    %eax,%r12d
+
+	envid_t envid = sys_exofork();
+    if (envid < 0)
+  801771:	85 c0                	test   %eax,%eax
+  801773:	78 7e                	js     8017f3 <fork+0x9f>
+        return envid;
+    if (envid == 0) {
+  801775:	0f 84 80 00 00 00    	je     8017fb <fork+0xa7>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE) < 0) {
+  80177b:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801781:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801788:	00 00 00 
+  80178b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801790:	89 c2                	mov    %eax,%edx
+  801792:	be 00 00 00 00       	mov    $0x0,%esi
+  801797:	bf 00 00 00 00       	mov    $0x0,%edi
+  80179c:	48 b8 77 13 80 00 00 	movabs $0x801377,%rax
+  8017a3:	00 00 00 
+  8017a6:	ff d0                	call   *%rax
+  8017a8:	85 c0                	test   %eax,%eax
+  8017aa:	0f 88 86 00 00 00    	js     801836 <fork+0xe2>
+		return -1;
+	}
+    if (sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall) < 0) {
+  8017b0:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8017b7:	00 00 00 
+  8017ba:	48 8b b0 28 01 00 00 	mov    0x128(%rax),%rsi
+  8017c1:	44 89 e7             	mov    %r12d,%edi
+  8017c4:	48 b8 df 14 80 00 00 	movabs $0x8014df,%rax
+  8017cb:	00 00 00 
+  8017ce:	ff d0                	call   *%rax
+  8017d0:	85 c0                	test   %eax,%eax
+  8017d2:	78 6a                	js     80183e <fork+0xea>
+		return -1;
+	}
+    if (sys_env_set_status(envid, ENV_RUNNABLE) < 0) {
+  8017d4:	be 02 00 00 00       	mov    $0x2,%esi
+  8017d9:	44 89 e7             	mov    %r12d,%edi
+  8017dc:	48 b8 20 14 80 00 00 	movabs $0x801420,%rax
+  8017e3:	00 00 00 
+  8017e6:	ff d0                	call   *%rax
+		return -1;
+  8017e8:	85 c0                	test   %eax,%eax
+  8017ea:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8017ef:	44 0f 48 e0          	cmovs  %eax,%r12d
+	}
+    return envid;
+}
+  8017f3:	44 89 e0             	mov    %r12d,%eax
+  8017f6:	5b                   	pop    %rbx
+  8017f7:	41 5c                	pop    %r12
+  8017f9:	5d                   	pop    %rbp
+  8017fa:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  8017fb:	48 b8 94 12 80 00 00 	movabs $0x801294,%rax
+  801802:	00 00 00 
+  801805:	ff d0                	call   *%rax
+  801807:	89 c2                	mov    %eax,%edx
+  801809:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  80180f:	48 89 d0             	mov    %rdx,%rax
+  801812:	48 c1 e0 04          	shl    $0x4,%rax
+  801816:	48 29 d0             	sub    %rdx,%rax
+  801819:	48 c1 e0 05          	shl    $0x5,%rax
+  80181d:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801824:	00 00 00 
+  801827:	48 01 d0             	add    %rdx,%rax
+  80182a:	48 a3 00 00 81 00 00 	movabs %rax,0x810000
+  801831:	00 00 00 
+        return 0;
+  801834:	eb bd                	jmp    8017f3 <fork+0x9f>
+		return -1;
+  801836:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  80183c:	eb b5                	jmp    8017f3 <fork+0x9f>
+		return -1;
+  80183e:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801844:	eb ad                	jmp    8017f3 <fork+0x9f>
+
+0000000000801846 <sfork>:
+
+envid_t
+sfork() {
+  801846:	55                   	push   %rbp
+  801847:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  80184a:	48 ba a5 5c 80 00 00 	movabs $0x805ca5,%rdx
+  801851:	00 00 00 
+  801854:	be 2d 00 00 00       	mov    $0x2d,%esi
+  801859:	48 bf c0 5c 80 00 00 	movabs $0x805cc0,%rdi
+  801860:	00 00 00 
+  801863:	b8 00 00 00 00       	mov    $0x0,%eax
+  801868:	48 b9 4d 03 80 00 00 	movabs $0x80034d,%rcx
+  80186f:	00 00 00 
+  801872:	ff d1                	call   *%rcx
+
+0000000000801874 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801874:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80187b:	ff ff ff 
+  80187e:	48 01 f8             	add    %rdi,%rax
+  801881:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801885:	c3                   	ret
+
+0000000000801886 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801886:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80188d:	ff ff ff 
+  801890:	48 01 f8             	add    %rdi,%rax
+  801893:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801897:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  80189d:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8018a1:	c3                   	ret
+
+00000000008018a2 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8018a2:	55                   	push   %rbp
+  8018a3:	48 89 e5             	mov    %rsp,%rbp
+  8018a6:	41 57                	push   %r15
+  8018a8:	41 56                	push   %r14
+  8018aa:	41 55                	push   %r13
+  8018ac:	41 54                	push   %r12
+  8018ae:	53                   	push   %rbx
+  8018af:	48 83 ec 08          	sub    $0x8,%rsp
+  8018b3:	49 89 ff             	mov    %rdi,%r15
+  8018b6:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8018bb:	49 bd ea 49 80 00 00 	movabs $0x8049ea,%r13
+  8018c2:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8018c5:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8018cb:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8018ce:	48 89 df             	mov    %rbx,%rdi
+  8018d1:	41 ff d5             	call   *%r13
+  8018d4:	83 e0 04             	and    $0x4,%eax
+  8018d7:	74 17                	je     8018f0 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8018d9:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8018e0:	4c 39 f3             	cmp    %r14,%rbx
+  8018e3:	75 e6                	jne    8018cb <fd_alloc+0x29>
+  8018e5:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8018eb:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8018f0:	4d 89 27             	mov    %r12,(%r15)
+}
+  8018f3:	48 83 c4 08          	add    $0x8,%rsp
+  8018f7:	5b                   	pop    %rbx
+  8018f8:	41 5c                	pop    %r12
+  8018fa:	41 5d                	pop    %r13
+  8018fc:	41 5e                	pop    %r14
+  8018fe:	41 5f                	pop    %r15
+  801900:	5d                   	pop    %rbp
+  801901:	c3                   	ret
+
+0000000000801902 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801902:	83 ff 1f             	cmp    $0x1f,%edi
+  801905:	77 39                	ja     801940 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801907:	55                   	push   %rbp
+  801908:	48 89 e5             	mov    %rsp,%rbp
+  80190b:	41 54                	push   %r12
+  80190d:	53                   	push   %rbx
+  80190e:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801911:	48 63 df             	movslq %edi,%rbx
+  801914:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80191b:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  80191f:	48 89 df             	mov    %rbx,%rdi
+  801922:	48 b8 ea 49 80 00 00 	movabs $0x8049ea,%rax
+  801929:	00 00 00 
+  80192c:	ff d0                	call   *%rax
+  80192e:	a8 04                	test   $0x4,%al
+  801930:	74 14                	je     801946 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801932:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801936:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80193b:	5b                   	pop    %rbx
+  80193c:	41 5c                	pop    %r12
+  80193e:	5d                   	pop    %rbp
+  80193f:	c3                   	ret
+        return -E_INVAL;
+  801940:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801945:	c3                   	ret
+        return -E_INVAL;
+  801946:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80194b:	eb ee                	jmp    80193b <fd_lookup+0x39>
+
+000000000080194d <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80194d:	55                   	push   %rbp
+  80194e:	48 89 e5             	mov    %rsp,%rbp
+  801951:	41 54                	push   %r12
+  801953:	53                   	push   %rbx
+  801954:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801957:	48 b8 60 5d 80 00 00 	movabs $0x805d60,%rax
+  80195e:	00 00 00 
+  801961:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  801968:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  80196b:	39 3b                	cmp    %edi,(%rbx)
+  80196d:	74 47                	je     8019b6 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  80196f:	48 83 c0 08          	add    $0x8,%rax
+  801973:	48 8b 18             	mov    (%rax),%rbx
+  801976:	48 85 db             	test   %rbx,%rbx
+  801979:	75 f0                	jne    80196b <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80197b:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801982:	00 00 00 
+  801985:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80198b:	89 fa                	mov    %edi,%edx
+  80198d:	48 bf d0 5c 80 00 00 	movabs $0x805cd0,%rdi
+  801994:	00 00 00 
+  801997:	b8 00 00 00 00       	mov    $0x0,%eax
+  80199c:	48 b9 9d 04 80 00 00 	movabs $0x80049d,%rcx
+  8019a3:	00 00 00 
+  8019a6:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8019a8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8019ad:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8019b1:	5b                   	pop    %rbx
+  8019b2:	41 5c                	pop    %r12
+  8019b4:	5d                   	pop    %rbp
+  8019b5:	c3                   	ret
+            return 0;
+  8019b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019bb:	eb f0                	jmp    8019ad <dev_lookup+0x60>
+
+00000000008019bd <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8019bd:	55                   	push   %rbp
+  8019be:	48 89 e5             	mov    %rsp,%rbp
+  8019c1:	41 55                	push   %r13
+  8019c3:	41 54                	push   %r12
+  8019c5:	53                   	push   %rbx
+  8019c6:	48 83 ec 18          	sub    $0x18,%rsp
+  8019ca:	48 89 fb             	mov    %rdi,%rbx
+  8019cd:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8019d0:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8019d7:	ff ff ff 
+  8019da:	48 01 df             	add    %rbx,%rdi
+  8019dd:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8019e1:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8019e5:	48 b8 02 19 80 00 00 	movabs $0x801902,%rax
+  8019ec:	00 00 00 
+  8019ef:	ff d0                	call   *%rax
+  8019f1:	41 89 c5             	mov    %eax,%r13d
+  8019f4:	85 c0                	test   %eax,%eax
+  8019f6:	78 06                	js     8019fe <fd_close+0x41>
+  8019f8:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8019fc:	74 1a                	je     801a18 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8019fe:	45 84 e4             	test   %r12b,%r12b
+  801a01:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a06:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801a0a:	44 89 e8             	mov    %r13d,%eax
+  801a0d:	48 83 c4 18          	add    $0x18,%rsp
+  801a11:	5b                   	pop    %rbx
+  801a12:	41 5c                	pop    %r12
+  801a14:	41 5d                	pop    %r13
+  801a16:	5d                   	pop    %rbp
+  801a17:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801a18:	8b 3b                	mov    (%rbx),%edi
+  801a1a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801a1e:	48 b8 4d 19 80 00 00 	movabs $0x80194d,%rax
+  801a25:	00 00 00 
+  801a28:	ff d0                	call   *%rax
+  801a2a:	41 89 c5             	mov    %eax,%r13d
+  801a2d:	85 c0                	test   %eax,%eax
+  801a2f:	78 1b                	js     801a4c <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801a31:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a35:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801a39:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801a3f:	48 85 c0             	test   %rax,%rax
+  801a42:	74 08                	je     801a4c <fd_close+0x8f>
+  801a44:	48 89 df             	mov    %rbx,%rdi
+  801a47:	ff d0                	call   *%rax
+  801a49:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801a4c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a51:	48 89 de             	mov    %rbx,%rsi
+  801a54:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a59:	48 b8 c7 13 80 00 00 	movabs $0x8013c7,%rax
+  801a60:	00 00 00 
+  801a63:	ff d0                	call   *%rax
+    return res;
+  801a65:	eb a3                	jmp    801a0a <fd_close+0x4d>
+
+0000000000801a67 <close>:
+
+int
+close(int fdnum) {
+  801a67:	55                   	push   %rbp
+  801a68:	48 89 e5             	mov    %rsp,%rbp
+  801a6b:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801a6f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801a73:	48 b8 02 19 80 00 00 	movabs $0x801902,%rax
+  801a7a:	00 00 00 
+  801a7d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801a7f:	85 c0                	test   %eax,%eax
+  801a81:	78 15                	js     801a98 <close+0x31>
+
+    return fd_close(fd, 1);
+  801a83:	be 01 00 00 00       	mov    $0x1,%esi
+  801a88:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801a8c:	48 b8 bd 19 80 00 00 	movabs $0x8019bd,%rax
+  801a93:	00 00 00 
+  801a96:	ff d0                	call   *%rax
+}
+  801a98:	c9                   	leave
+  801a99:	c3                   	ret
+
+0000000000801a9a <close_all>:
+
+void
+close_all(void) {
+  801a9a:	55                   	push   %rbp
+  801a9b:	48 89 e5             	mov    %rsp,%rbp
+  801a9e:	41 54                	push   %r12
+  801aa0:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801aa1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801aa6:	49 bc 67 1a 80 00 00 	movabs $0x801a67,%r12
+  801aad:	00 00 00 
+  801ab0:	89 df                	mov    %ebx,%edi
+  801ab2:	41 ff d4             	call   *%r12
+  801ab5:	83 c3 01             	add    $0x1,%ebx
+  801ab8:	83 fb 20             	cmp    $0x20,%ebx
+  801abb:	75 f3                	jne    801ab0 <close_all+0x16>
+}
+  801abd:	5b                   	pop    %rbx
+  801abe:	41 5c                	pop    %r12
+  801ac0:	5d                   	pop    %rbp
+  801ac1:	c3                   	ret
+
+0000000000801ac2 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801ac2:	55                   	push   %rbp
+  801ac3:	48 89 e5             	mov    %rsp,%rbp
+  801ac6:	41 57                	push   %r15
+  801ac8:	41 56                	push   %r14
+  801aca:	41 55                	push   %r13
+  801acc:	41 54                	push   %r12
+  801ace:	53                   	push   %rbx
+  801acf:	48 83 ec 18          	sub    $0x18,%rsp
+  801ad3:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801ad6:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801ada:	48 b8 02 19 80 00 00 	movabs $0x801902,%rax
+  801ae1:	00 00 00 
+  801ae4:	ff d0                	call   *%rax
+  801ae6:	89 c3                	mov    %eax,%ebx
+  801ae8:	85 c0                	test   %eax,%eax
+  801aea:	0f 88 b8 00 00 00    	js     801ba8 <dup+0xe6>
+    close(newfdnum);
+  801af0:	44 89 e7             	mov    %r12d,%edi
+  801af3:	48 b8 67 1a 80 00 00 	movabs $0x801a67,%rax
+  801afa:	00 00 00 
+  801afd:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801aff:	4d 63 ec             	movslq %r12d,%r13
+  801b02:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801b09:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801b0d:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801b11:	4c 89 ff             	mov    %r15,%rdi
+  801b14:	49 be 86 18 80 00 00 	movabs $0x801886,%r14
+  801b1b:	00 00 00 
+  801b1e:	41 ff d6             	call   *%r14
+  801b21:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801b24:	4c 89 ef             	mov    %r13,%rdi
+  801b27:	41 ff d6             	call   *%r14
+  801b2a:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801b2d:	48 89 df             	mov    %rbx,%rdi
+  801b30:	48 b8 ea 49 80 00 00 	movabs $0x8049ea,%rax
+  801b37:	00 00 00 
+  801b3a:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801b3c:	a8 04                	test   $0x4,%al
+  801b3e:	74 2b                	je     801b6b <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801b40:	41 89 c1             	mov    %eax,%r9d
+  801b43:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801b49:	4c 89 f1             	mov    %r14,%rcx
+  801b4c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b51:	48 89 de             	mov    %rbx,%rsi
+  801b54:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b59:	48 b8 77 13 80 00 00 	movabs $0x801377,%rax
+  801b60:	00 00 00 
+  801b63:	ff d0                	call   *%rax
+  801b65:	89 c3                	mov    %eax,%ebx
+  801b67:	85 c0                	test   %eax,%eax
+  801b69:	78 4e                	js     801bb9 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801b6b:	4c 89 ff             	mov    %r15,%rdi
+  801b6e:	48 b8 ea 49 80 00 00 	movabs $0x8049ea,%rax
+  801b75:	00 00 00 
+  801b78:	ff d0                	call   *%rax
+  801b7a:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801b7d:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801b83:	4c 89 e9             	mov    %r13,%rcx
+  801b86:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b8b:	4c 89 fe             	mov    %r15,%rsi
+  801b8e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b93:	48 b8 77 13 80 00 00 	movabs $0x801377,%rax
+  801b9a:	00 00 00 
+  801b9d:	ff d0                	call   *%rax
+  801b9f:	89 c3                	mov    %eax,%ebx
+  801ba1:	85 c0                	test   %eax,%eax
+  801ba3:	78 14                	js     801bb9 <dup+0xf7>
+
+    return newfdnum;
+  801ba5:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801ba8:	89 d8                	mov    %ebx,%eax
+  801baa:	48 83 c4 18          	add    $0x18,%rsp
+  801bae:	5b                   	pop    %rbx
+  801baf:	41 5c                	pop    %r12
+  801bb1:	41 5d                	pop    %r13
+  801bb3:	41 5e                	pop    %r14
+  801bb5:	41 5f                	pop    %r15
+  801bb7:	5d                   	pop    %rbp
+  801bb8:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801bb9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801bbe:	4c 89 ee             	mov    %r13,%rsi
+  801bc1:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bc6:	49 bc c7 13 80 00 00 	movabs $0x8013c7,%r12
+  801bcd:	00 00 00 
+  801bd0:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801bd3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801bd8:	4c 89 f6             	mov    %r14,%rsi
+  801bdb:	bf 00 00 00 00       	mov    $0x0,%edi
+  801be0:	41 ff d4             	call   *%r12
+    return res;
+  801be3:	eb c3                	jmp    801ba8 <dup+0xe6>
+
+0000000000801be5 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801be5:	55                   	push   %rbp
+  801be6:	48 89 e5             	mov    %rsp,%rbp
+  801be9:	41 56                	push   %r14
+  801beb:	41 55                	push   %r13
+  801bed:	41 54                	push   %r12
+  801bef:	53                   	push   %rbx
+  801bf0:	48 83 ec 10          	sub    $0x10,%rsp
+  801bf4:	89 fb                	mov    %edi,%ebx
+  801bf6:	49 89 f4             	mov    %rsi,%r12
+  801bf9:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801bfc:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c00:	48 b8 02 19 80 00 00 	movabs $0x801902,%rax
+  801c07:	00 00 00 
+  801c0a:	ff d0                	call   *%rax
+  801c0c:	85 c0                	test   %eax,%eax
+  801c0e:	78 4c                	js     801c5c <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c10:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801c14:	41 8b 3e             	mov    (%r14),%edi
+  801c17:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c1b:	48 b8 4d 19 80 00 00 	movabs $0x80194d,%rax
+  801c22:	00 00 00 
+  801c25:	ff d0                	call   *%rax
+  801c27:	85 c0                	test   %eax,%eax
+  801c29:	78 35                	js     801c60 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801c2b:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801c2f:	83 e0 03             	and    $0x3,%eax
+  801c32:	83 f8 01             	cmp    $0x1,%eax
+  801c35:	74 2d                	je     801c64 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801c37:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c3b:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801c3f:	48 85 c0             	test   %rax,%rax
+  801c42:	74 56                	je     801c9a <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801c44:	4c 89 ea             	mov    %r13,%rdx
+  801c47:	4c 89 e6             	mov    %r12,%rsi
+  801c4a:	4c 89 f7             	mov    %r14,%rdi
+  801c4d:	ff d0                	call   *%rax
+}
+  801c4f:	48 83 c4 10          	add    $0x10,%rsp
+  801c53:	5b                   	pop    %rbx
+  801c54:	41 5c                	pop    %r12
+  801c56:	41 5d                	pop    %r13
+  801c58:	41 5e                	pop    %r14
+  801c5a:	5d                   	pop    %rbp
+  801c5b:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c5c:	48 98                	cltq
+  801c5e:	eb ef                	jmp    801c4f <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c60:	48 98                	cltq
+  801c62:	eb eb                	jmp    801c4f <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c64:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801c6b:	00 00 00 
+  801c6e:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801c74:	89 da                	mov    %ebx,%edx
+  801c76:	48 bf 11 5d 80 00 00 	movabs $0x805d11,%rdi
+  801c7d:	00 00 00 
+  801c80:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c85:	48 b9 9d 04 80 00 00 	movabs $0x80049d,%rcx
+  801c8c:	00 00 00 
+  801c8f:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801c91:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801c98:	eb b5                	jmp    801c4f <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801c9a:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801ca1:	eb ac                	jmp    801c4f <read+0x6a>
+
+0000000000801ca3 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801ca3:	55                   	push   %rbp
+  801ca4:	48 89 e5             	mov    %rsp,%rbp
+  801ca7:	41 57                	push   %r15
+  801ca9:	41 56                	push   %r14
+  801cab:	41 55                	push   %r13
+  801cad:	41 54                	push   %r12
+  801caf:	53                   	push   %rbx
+  801cb0:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801cb4:	48 85 d2             	test   %rdx,%rdx
+  801cb7:	74 54                	je     801d0d <readn+0x6a>
+  801cb9:	41 89 fd             	mov    %edi,%r13d
+  801cbc:	49 89 f6             	mov    %rsi,%r14
+  801cbf:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801cc2:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801cc7:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801ccc:	49 bf e5 1b 80 00 00 	movabs $0x801be5,%r15
+  801cd3:	00 00 00 
+  801cd6:	4c 89 e2             	mov    %r12,%rdx
+  801cd9:	48 29 f2             	sub    %rsi,%rdx
+  801cdc:	4c 01 f6             	add    %r14,%rsi
+  801cdf:	44 89 ef             	mov    %r13d,%edi
+  801ce2:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801ce5:	85 c0                	test   %eax,%eax
+  801ce7:	78 20                	js     801d09 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801ce9:	01 c3                	add    %eax,%ebx
+  801ceb:	85 c0                	test   %eax,%eax
+  801ced:	74 08                	je     801cf7 <readn+0x54>
+  801cef:	48 63 f3             	movslq %ebx,%rsi
+  801cf2:	4c 39 e6             	cmp    %r12,%rsi
+  801cf5:	72 df                	jb     801cd6 <readn+0x33>
+    }
+    return res;
+  801cf7:	48 63 c3             	movslq %ebx,%rax
+}
+  801cfa:	48 83 c4 08          	add    $0x8,%rsp
+  801cfe:	5b                   	pop    %rbx
+  801cff:	41 5c                	pop    %r12
+  801d01:	41 5d                	pop    %r13
+  801d03:	41 5e                	pop    %r14
+  801d05:	41 5f                	pop    %r15
+  801d07:	5d                   	pop    %rbp
+  801d08:	c3                   	ret
+        if (inc < 0) return inc;
+  801d09:	48 98                	cltq
+  801d0b:	eb ed                	jmp    801cfa <readn+0x57>
+    int inc = 1, res = 0;
+  801d0d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d12:	eb e3                	jmp    801cf7 <readn+0x54>
+
+0000000000801d14 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801d14:	55                   	push   %rbp
+  801d15:	48 89 e5             	mov    %rsp,%rbp
+  801d18:	41 56                	push   %r14
+  801d1a:	41 55                	push   %r13
+  801d1c:	41 54                	push   %r12
+  801d1e:	53                   	push   %rbx
+  801d1f:	48 83 ec 10          	sub    $0x10,%rsp
+  801d23:	89 fb                	mov    %edi,%ebx
+  801d25:	49 89 f4             	mov    %rsi,%r12
+  801d28:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d2b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d2f:	48 b8 02 19 80 00 00 	movabs $0x801902,%rax
+  801d36:	00 00 00 
+  801d39:	ff d0                	call   *%rax
+  801d3b:	85 c0                	test   %eax,%eax
+  801d3d:	78 47                	js     801d86 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d3f:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801d43:	41 8b 3e             	mov    (%r14),%edi
+  801d46:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d4a:	48 b8 4d 19 80 00 00 	movabs $0x80194d,%rax
+  801d51:	00 00 00 
+  801d54:	ff d0                	call   *%rax
+  801d56:	85 c0                	test   %eax,%eax
+  801d58:	78 30                	js     801d8a <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d5a:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801d5f:	74 2d                	je     801d8e <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801d61:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d65:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801d69:	48 85 c0             	test   %rax,%rax
+  801d6c:	74 56                	je     801dc4 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801d6e:	4c 89 ea             	mov    %r13,%rdx
+  801d71:	4c 89 e6             	mov    %r12,%rsi
+  801d74:	4c 89 f7             	mov    %r14,%rdi
+  801d77:	ff d0                	call   *%rax
+}
+  801d79:	48 83 c4 10          	add    $0x10,%rsp
+  801d7d:	5b                   	pop    %rbx
+  801d7e:	41 5c                	pop    %r12
+  801d80:	41 5d                	pop    %r13
+  801d82:	41 5e                	pop    %r14
+  801d84:	5d                   	pop    %rbp
+  801d85:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d86:	48 98                	cltq
+  801d88:	eb ef                	jmp    801d79 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d8a:	48 98                	cltq
+  801d8c:	eb eb                	jmp    801d79 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d8e:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801d95:	00 00 00 
+  801d98:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801d9e:	89 da                	mov    %ebx,%edx
+  801da0:	48 bf 2d 5d 80 00 00 	movabs $0x805d2d,%rdi
+  801da7:	00 00 00 
+  801daa:	b8 00 00 00 00       	mov    $0x0,%eax
+  801daf:	48 b9 9d 04 80 00 00 	movabs $0x80049d,%rcx
+  801db6:	00 00 00 
+  801db9:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801dbb:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801dc2:	eb b5                	jmp    801d79 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801dc4:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801dcb:	eb ac                	jmp    801d79 <write+0x65>
+
+0000000000801dcd <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801dcd:	55                   	push   %rbp
+  801dce:	48 89 e5             	mov    %rsp,%rbp
+  801dd1:	41 54                	push   %r12
+  801dd3:	53                   	push   %rbx
+  801dd4:	48 83 ec 10          	sub    $0x10,%rsp
+  801dd8:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801dda:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801dde:	48 b8 02 19 80 00 00 	movabs $0x801902,%rax
+  801de5:	00 00 00 
+  801de8:	ff d0                	call   *%rax
+  801dea:	85 c0                	test   %eax,%eax
+  801dec:	78 3e                	js     801e2c <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801dee:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801df2:	41 8b 3c 24          	mov    (%r12),%edi
+  801df6:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801dfa:	48 b8 4d 19 80 00 00 	movabs $0x80194d,%rax
+  801e01:	00 00 00 
+  801e04:	ff d0                	call   *%rax
+  801e06:	85 c0                	test   %eax,%eax
+  801e08:	78 22                	js     801e2c <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  801e0a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801e0e:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801e12:	48 85 c0             	test   %rax,%rax
+  801e15:	74 0b                	je     801e22 <seek+0x55>
+  801e17:	89 de                	mov    %ebx,%esi
+  801e19:	4c 89 e7             	mov    %r12,%rdi
+  801e1c:	ff d0                	call   *%rax
+  801e1e:	85 c0                	test   %eax,%eax
+  801e20:	78 0a                	js     801e2c <seek+0x5f>
+
+    fd->fd_offset = offset;
+  801e22:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  801e27:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e2c:	48 83 c4 10          	add    $0x10,%rsp
+  801e30:	5b                   	pop    %rbx
+  801e31:	41 5c                	pop    %r12
+  801e33:	5d                   	pop    %rbp
+  801e34:	c3                   	ret
+
+0000000000801e35 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801e35:	55                   	push   %rbp
+  801e36:	48 89 e5             	mov    %rsp,%rbp
+  801e39:	41 55                	push   %r13
+  801e3b:	41 54                	push   %r12
+  801e3d:	53                   	push   %rbx
+  801e3e:	48 83 ec 18          	sub    $0x18,%rsp
+  801e42:	89 fb                	mov    %edi,%ebx
+  801e44:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e47:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e4b:	48 b8 02 19 80 00 00 	movabs $0x801902,%rax
+  801e52:	00 00 00 
+  801e55:	ff d0                	call   *%rax
+  801e57:	85 c0                	test   %eax,%eax
+  801e59:	78 38                	js     801e93 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e5b:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801e5f:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801e63:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e67:	48 b8 4d 19 80 00 00 	movabs $0x80194d,%rax
+  801e6e:	00 00 00 
+  801e71:	ff d0                	call   *%rax
+  801e73:	85 c0                	test   %eax,%eax
+  801e75:	78 1c                	js     801e93 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e77:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801e7c:	74 20                	je     801e9e <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801e7e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e82:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801e86:	48 85 c0             	test   %rax,%rax
+  801e89:	74 47                	je     801ed2 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801e8b:	44 89 e6             	mov    %r12d,%esi
+  801e8e:	4c 89 ef             	mov    %r13,%rdi
+  801e91:	ff d0                	call   *%rax
+}
+  801e93:	48 83 c4 18          	add    $0x18,%rsp
+  801e97:	5b                   	pop    %rbx
+  801e98:	41 5c                	pop    %r12
+  801e9a:	41 5d                	pop    %r13
+  801e9c:	5d                   	pop    %rbp
+  801e9d:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801e9e:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801ea5:	00 00 00 
+  801ea8:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801eae:	89 da                	mov    %ebx,%edx
+  801eb0:	48 bf f0 5c 80 00 00 	movabs $0x805cf0,%rdi
+  801eb7:	00 00 00 
+  801eba:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ebf:	48 b9 9d 04 80 00 00 	movabs $0x80049d,%rcx
+  801ec6:	00 00 00 
+  801ec9:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801ecb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ed0:	eb c1                	jmp    801e93 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801ed2:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801ed7:	eb ba                	jmp    801e93 <ftruncate+0x5e>
+
+0000000000801ed9 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801ed9:	55                   	push   %rbp
+  801eda:	48 89 e5             	mov    %rsp,%rbp
+  801edd:	41 54                	push   %r12
+  801edf:	53                   	push   %rbx
+  801ee0:	48 83 ec 10          	sub    $0x10,%rsp
+  801ee4:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ee7:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801eeb:	48 b8 02 19 80 00 00 	movabs $0x801902,%rax
+  801ef2:	00 00 00 
+  801ef5:	ff d0                	call   *%rax
+  801ef7:	85 c0                	test   %eax,%eax
+  801ef9:	78 4e                	js     801f49 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801efb:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801eff:	41 8b 3c 24          	mov    (%r12),%edi
+  801f03:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801f07:	48 b8 4d 19 80 00 00 	movabs $0x80194d,%rax
+  801f0e:	00 00 00 
+  801f11:	ff d0                	call   *%rax
+  801f13:	85 c0                	test   %eax,%eax
+  801f15:	78 32                	js     801f49 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801f17:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801f1b:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801f20:	74 30                	je     801f52 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801f22:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801f25:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801f2c:	00 00 00 
+    stat->st_isdir = 0;
+  801f2f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801f36:	00 00 00 
+    stat->st_dev = dev;
+  801f39:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801f40:	48 89 de             	mov    %rbx,%rsi
+  801f43:	4c 89 e7             	mov    %r12,%rdi
+  801f46:	ff 50 28             	call   *0x28(%rax)
+}
+  801f49:	48 83 c4 10          	add    $0x10,%rsp
+  801f4d:	5b                   	pop    %rbx
+  801f4e:	41 5c                	pop    %r12
+  801f50:	5d                   	pop    %rbp
+  801f51:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801f52:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f57:	eb f0                	jmp    801f49 <fstat+0x70>
+
+0000000000801f59 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801f59:	55                   	push   %rbp
+  801f5a:	48 89 e5             	mov    %rsp,%rbp
+  801f5d:	41 54                	push   %r12
+  801f5f:	53                   	push   %rbx
+  801f60:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801f63:	be 00 00 00 00       	mov    $0x0,%esi
+  801f68:	48 b8 c7 30 80 00 00 	movabs $0x8030c7,%rax
+  801f6f:	00 00 00 
+  801f72:	ff d0                	call   *%rax
+  801f74:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801f76:	85 c0                	test   %eax,%eax
+  801f78:	78 25                	js     801f9f <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801f7a:	4c 89 e6             	mov    %r12,%rsi
+  801f7d:	89 c7                	mov    %eax,%edi
+  801f7f:	48 b8 d9 1e 80 00 00 	movabs $0x801ed9,%rax
+  801f86:	00 00 00 
+  801f89:	ff d0                	call   *%rax
+  801f8b:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801f8e:	89 df                	mov    %ebx,%edi
+  801f90:	48 b8 67 1a 80 00 00 	movabs $0x801a67,%rax
+  801f97:	00 00 00 
+  801f9a:	ff d0                	call   *%rax
+
+    return res;
+  801f9c:	44 89 e3             	mov    %r12d,%ebx
+}
+  801f9f:	89 d8                	mov    %ebx,%eax
+  801fa1:	5b                   	pop    %rbx
+  801fa2:	41 5c                	pop    %r12
+  801fa4:	5d                   	pop    %rbp
+  801fa5:	c3                   	ret
+
+0000000000801fa6 <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  801fa6:	48 b8 08 00 82 00 00 	movabs $0x820008,%rax
+  801fad:	00 00 00 
+  801fb0:	83 38 00             	cmpl   $0x0,(%rax)
+  801fb3:	74 0a                	je     801fbf <fsenv+0x19>
+    return envid;
+}
+  801fb5:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  801fbc:	00 00 
+  801fbe:	c3                   	ret
+fsenv(void) {
+  801fbf:	55                   	push   %rbp
+  801fc0:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  801fc3:	bf 03 00 00 00       	mov    $0x3,%edi
+  801fc8:	48 b8 dc 55 80 00 00 	movabs $0x8055dc,%rax
+  801fcf:	00 00 00 
+  801fd2:	ff d0                	call   *%rax
+  801fd4:	a3 08 00 82 00 00 00 	movabs %eax,0x820008
+  801fdb:	00 00 
+}
+  801fdd:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  801fe4:	00 00 
+  801fe6:	5d                   	pop    %rbp
+  801fe7:	c3                   	ret
+
+0000000000801fe8 <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  801fe8:	55                   	push   %rbp
+  801fe9:	48 89 e5             	mov    %rsp,%rbp
+  801fec:	41 54                	push   %r12
+  801fee:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  801fef:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801ff4:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801ff9:	48 89 de             	mov    %rbx,%rsi
+  801ffc:	bf 00 00 00 00       	mov    $0x0,%edi
+  802001:	48 b8 c7 13 80 00 00 	movabs $0x8013c7,%rax
+  802008:	00 00 00 
+  80200b:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  80200d:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  802014:	00 00 00 
+  802017:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  80201d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802022:	ba 00 50 00 00       	mov    $0x5000,%edx
+  802027:	48 89 de             	mov    %rbx,%rsi
+  80202a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80202f:	48 b8 21 13 80 00 00 	movabs $0x801321,%rax
+  802036:	00 00 00 
+  802039:	ff d0                	call   *%rax
+  80203b:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  80203d:	85 c0                	test   %eax,%eax
+  80203f:	0f 88 a2 00 00 00    	js     8020e7 <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  802045:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80204c:	00 00 00 
+  80204f:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802055:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  80205a:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  80205c:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  802061:	49 bc 41 4e 80 00 00 	movabs $0x804e41,%r12
+  802068:	00 00 00 
+  80206b:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  80206e:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  802073:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  802076:	48 b8 a6 1f 80 00 00 	movabs $0x801fa6,%rax
+  80207d:	00 00 00 
+  802080:	ff d0                	call   *%rax
+  802082:	89 c7                	mov    %eax,%edi
+  802084:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  80208a:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  80208f:	48 89 da             	mov    %rbx,%rdx
+  802092:	be 09 00 00 00       	mov    $0x9,%esi
+  802097:	48 b8 86 55 80 00 00 	movabs $0x805586,%rax
+  80209e:	00 00 00 
+  8020a1:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  8020a3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8020b2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020b7:	48 b8 62 55 80 00 00 	movabs $0x805562,%rax
+  8020be:	00 00 00 
+  8020c1:	ff d0                	call   *%rax
+  8020c3:	89 c3                	mov    %eax,%ebx
+  8020c5:	85 c0                	test   %eax,%eax
+  8020c7:	78 25                	js     8020ee <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  8020c9:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8020d0:	00 00 00 
+  8020d3:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8020d9:	a3 00 26 82 00 00 00 	movabs %eax,0x822600
+  8020e0:	00 00 
+    return 0;
+  8020e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  8020e7:	89 d8                	mov    %ebx,%eax
+  8020e9:	5b                   	pop    %rbx
+  8020ea:	41 5c                	pop    %r12
+  8020ec:	5d                   	pop    %rbp
+  8020ed:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  8020ee:	ba 00 50 00 00       	mov    $0x5000,%edx
+  8020f3:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  8020f8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020fd:	48 b8 c7 13 80 00 00 	movabs $0x8013c7,%rax
+  802104:	00 00 00 
+  802107:	ff d0                	call   *%rax
+        return res;
+  802109:	eb dc                	jmp    8020e7 <fschan_setup+0xff>
+
+000000000080210b <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  80210b:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  802112:	00 00 00 
+  802115:	80 38 00             	cmpb   $0x0,(%rax)
+  802118:	74 55                	je     80216f <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  80211a:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  802121:	00 00 00 
+  802124:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  80212a:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  80212f:	48 ba 00 26 82 00 00 	movabs $0x822600,%rdx
+  802136:	00 00 00 
+  802139:	3b 0a                	cmp    (%rdx),%ecx
+  80213b:	75 01                	jne    80213e <fschan+0x33>
+}
+  80213d:	c3                   	ret
+fschan(void) {
+  80213e:	55                   	push   %rbp
+  80213f:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802142:	48 b8 e8 1f 80 00 00 	movabs $0x801fe8,%rax
+  802149:	00 00 00 
+  80214c:	ff d0                	call   *%rax
+  80214e:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  802150:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802155:	85 d2                	test   %edx,%edx
+  802157:	78 02                	js     80215b <fschan+0x50>
+}
+  802159:	5d                   	pop    %rbp
+  80215a:	c3                   	ret
+        fschan_enabled = 0;
+  80215b:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  802162:	00 00 00 
+  802165:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  802168:	b8 00 00 00 00       	mov    $0x0,%eax
+  80216d:	eb ea                	jmp    802159 <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  80216f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802174:	c3                   	ret
+
+0000000000802175 <fbuf>:
+fbuf(struct Fd *fd) {
+  802175:	55                   	push   %rbp
+  802176:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  802179:	48 b8 74 18 80 00 00 	movabs $0x801874,%rax
+  802180:	00 00 00 
+  802183:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  802185:	ba 00 00 00 00       	mov    $0x0,%edx
+  80218a:	48 83 f8 1f          	cmp    $0x1f,%rax
+  80218e:	77 12                	ja     8021a2 <fbuf+0x2d>
+  802190:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  802194:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  80219b:	00 00 00 
+  80219e:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  8021a2:	48 89 d0             	mov    %rdx,%rax
+  8021a5:	5d                   	pop    %rbp
+  8021a6:	c3                   	ret
+
+00000000008021a7 <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  8021a7:	55                   	push   %rbp
+  8021a8:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  8021ab:	48 83 c7 40          	add    $0x40,%rdi
+  8021af:	48 b8 7b 4e 80 00 00 	movabs $0x804e7b,%rax
+  8021b6:	00 00 00 
+  8021b9:	ff d0                	call   *%rax
+  8021bb:	84 c0                	test   %al,%al
+  8021bd:	75 02                	jne    8021c1 <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  8021bf:	5d                   	pop    %rbp
+  8021c0:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  8021c1:	48 b8 a6 1f 80 00 00 	movabs $0x801fa6,%rax
+  8021c8:	00 00 00 
+  8021cb:	ff d0                	call   *%rax
+  8021cd:	89 c7                	mov    %eax,%edi
+  8021cf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021d5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021df:	be 0a 00 00 00       	mov    $0xa,%esi
+  8021e4:	48 b8 86 55 80 00 00 	movabs $0x805586,%rax
+  8021eb:	00 00 00 
+  8021ee:	ff d0                	call   *%rax
+}
+  8021f0:	eb cd                	jmp    8021bf <fschan_publish+0x18>
+
+00000000008021f2 <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  8021f2:	55                   	push   %rbp
+  8021f3:	48 89 e5             	mov    %rsp,%rbp
+  8021f6:	41 57                	push   %r15
+  8021f8:	41 56                	push   %r14
+  8021fa:	41 55                	push   %r13
+  8021fc:	41 54                	push   %r12
+  8021fe:	53                   	push   %rbx
+  8021ff:	48 83 ec 48          	sub    $0x48,%rsp
+  802203:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802207:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  80220b:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  80220e:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  802212:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  802215:	48 ba 04 00 82 00 00 	movabs $0x820004,%rdx
+  80221c:	00 00 00 
+  80221f:	8b 02                	mov    (%rdx),%eax
+  802221:	83 c0 01             	add    $0x1,%eax
+  802224:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802229:	0f 44 c1             	cmove  %ecx,%eax
+  80222c:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  80222e:	4d 85 c0             	test   %r8,%r8
+  802231:	74 2c                	je     80225f <fschan_rw+0x6d>
+  802233:	45 89 ce             	mov    %r9d,%r14d
+  802236:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  80223d:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  802241:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802247:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  80224e:	00 
+  80224f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802255:	b8 01 00 00 00       	mov    $0x1,%eax
+  80225a:	e9 41 01 00 00       	jmp    8023a0 <fschan_rw+0x1ae>
+  80225f:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  802263:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802267:	e9 9c 01 00 00       	jmp    802408 <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  80226c:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  802270:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  802273:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  802276:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  802279:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  80227d:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  802281:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  802285:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  802289:	48 89 da             	mov    %rbx,%rdx
+  80228c:	48 b8 23 10 80 00 00 	movabs $0x801023,%rax
+  802293:	00 00 00 
+  802296:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  802298:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80229c:	48 b8 a7 21 80 00 00 	movabs $0x8021a7,%rax
+  8022a3:	00 00 00 
+  8022a6:	ff d0                	call   *%rax
+            queued += blk;
+  8022a8:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  8022ab:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  8022af:	4d 39 fc             	cmp    %r15,%r12
+  8022b2:	73 6b                	jae    80231f <fschan_rw+0x12d>
+  8022b4:	41 83 fd 0f          	cmp    $0xf,%r13d
+  8022b8:	77 65                	ja     80231f <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  8022ba:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8022be:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  8022c2:	48 b8 56 4e 80 00 00 	movabs $0x804e56,%rax
+  8022c9:	00 00 00 
+  8022cc:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  8022ce:	4c 89 fb             	mov    %r15,%rbx
+  8022d1:	4c 29 e3             	sub    %r12,%rbx
+  8022d4:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  8022d9:	48 39 d3             	cmp    %rdx,%rbx
+  8022dc:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  8022e0:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  8022e4:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  8022e8:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  8022ec:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  8022ef:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  8022f1:	48 b9 04 00 82 00 00 	movabs $0x820004,%rcx
+  8022f8:	00 00 00 
+  8022fb:	8b 09                	mov    (%rcx),%ecx
+  8022fd:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  802300:	83 fe 03             	cmp    $0x3,%esi
+  802303:	0f 85 63 ff ff ff    	jne    80226c <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  802309:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80230d:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  802310:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  802313:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  802316:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  80231a:	e9 79 ff ff ff       	jmp    802298 <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  80231f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802323:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  80232a:	48 89 df             	mov    %rbx,%rdi
+  80232d:	48 b8 19 4f 80 00 00 	movabs $0x804f19,%rax
+  802334:	00 00 00 
+  802337:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  802339:	48 89 df             	mov    %rbx,%rdi
+  80233c:	48 b8 a7 4e 80 00 00 	movabs $0x804ea7,%rax
+  802343:	00 00 00 
+  802346:	ff d0                	call   *%rax
+  802348:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  80234c:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  802350:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  802354:	75 25                	jne    80237b <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  802356:	8b 40 04             	mov    0x4(%rax),%eax
+  802359:	85 c0                	test   %eax,%eax
+  80235b:	0f 88 86 00 00 00    	js     8023e7 <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  802361:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  802365:	74 5b                	je     8023c2 <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  802367:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  80236b:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  80236f:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  802373:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  802377:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  80237b:	48 89 df             	mov    %rbx,%rdi
+  80237e:	48 b8 ce 4e 80 00 00 	movabs $0x804ece,%rax
+  802385:	00 00 00 
+  802388:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  80238a:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  80238e:	83 f0 01             	xor    $0x1,%eax
+  802391:	4d 39 fc             	cmp    %r15,%r12
+  802394:	0f 92 c2             	setb   %dl
+  802397:	84 c2                	test   %al,%dl
+  802399:	75 05                	jne    8023a0 <fschan_rw+0x1ae>
+  80239b:	45 85 ed             	test   %r13d,%r13d
+  80239e:	74 50                	je     8023f0 <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  8023a0:	4d 39 fc             	cmp    %r15,%r12
+  8023a3:	0f 92 c1             	setb   %cl
+  8023a6:	41 83 fd 0f          	cmp    $0xf,%r13d
+  8023aa:	0f 96 c2             	setbe  %dl
+  8023ad:	84 d1                	test   %dl,%cl
+  8023af:	0f 84 6a ff ff ff    	je     80231f <fschan_rw+0x12d>
+  8023b5:	84 c0                	test   %al,%al
+  8023b7:	0f 85 fd fe ff ff    	jne    8022ba <fschan_rw+0xc8>
+  8023bd:	e9 5d ff ff ff       	jmp    80231f <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  8023c2:	48 63 d0             	movslq %eax,%rdx
+  8023c5:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8023c9:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  8023cd:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8023d1:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  8023d5:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  8023d9:	48 b8 23 10 80 00 00 	movabs $0x801023,%rax
+  8023e0:	00 00 00 
+  8023e3:	ff d0                	call   *%rax
+  8023e5:	eb 80                	jmp    802367 <fschan_rw+0x175>
+                err = msg->fm_res;
+  8023e7:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  8023ea:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  8023ee:	eb 8b                	jmp    80237b <fschan_rw+0x189>
+    return done || !err ? done : err;
+  8023f0:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  8023f5:	0f 85 68 fe ff ff    	jne    802263 <fschan_rw+0x71>
+  8023fb:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  8023fe:	85 c0                	test   %eax,%eax
+  802400:	0f 84 5d fe ff ff    	je     802263 <fschan_rw+0x71>
+  802406:	48 98                	cltq
+}
+  802408:	48 83 c4 48          	add    $0x48,%rsp
+  80240c:	5b                   	pop    %rbx
+  80240d:	41 5c                	pop    %r12
+  80240f:	41 5d                	pop    %r13
+  802411:	41 5e                	pop    %r14
+  802413:	41 5f                	pop    %r15
+  802415:	5d                   	pop    %rbp
+  802416:	c3                   	ret
+
+0000000000802417 <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  802417:	55                   	push   %rbp
+  802418:	48 89 e5             	mov    %rsp,%rbp
+  80241b:	41 56                	push   %r14
+  80241d:	41 55                	push   %r13
+  80241f:	41 54                	push   %r12
+  802421:	53                   	push   %rbx
+  802422:	48 83 ec 10          	sub    $0x10,%rsp
+  802426:	49 89 fe             	mov    %rdi,%r14
+  802429:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  80242c:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  802430:	48 29 f3             	sub    %rsi,%rbx
+  802433:	48 39 d3             	cmp    %rdx,%rbx
+  802436:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  80243a:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  802441:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  802442:	bf 00 10 00 00       	mov    $0x1000,%edi
+  802447:	49 bd 49 4a 80 00 00 	movabs $0x804a49,%r13
+  80244e:	00 00 00 
+  802451:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  802458:	76 1e                	jbe    802478 <mmap_fault+0x61>
+  80245a:	4c 01 e7             	add    %r12,%rdi
+  80245d:	41 ff d5             	call   *%r13
+  802460:	84 c0                	test   %al,%al
+  802462:	75 14                	jne    802478 <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  802464:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802468:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  80246f:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  802473:	48 39 df             	cmp    %rbx,%rdi
+  802476:	72 e2                	jb     80245a <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  802478:	48 bb 00 10 82 00 00 	movabs $0x821000,%rbx
+  80247f:	00 00 00 
+  802482:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  802489:	00 00 00 
+  80248c:	4c 89 f0             	mov    %r14,%rax
+  80248f:	48 29 d0             	sub    %rdx,%rax
+  802492:	48 c1 f8 03          	sar    $0x3,%rax
+  802496:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  80249d:	aa aa aa 
+  8024a0:	48 0f af c2          	imul   %rdx,%rax
+  8024a4:	48 c1 e0 0c          	shl    $0xc,%rax
+  8024a8:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  8024ad:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  8024b1:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  8024b3:	44 89 e0             	mov    %r12d,%eax
+  8024b6:	41 03 46 10          	add    0x10(%r14),%eax
+  8024ba:	41 2b 06             	sub    (%r14),%eax
+  8024bd:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  8024c0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8024c4:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  8024c8:	41 8b 46 14          	mov    0x14(%r14),%eax
+  8024cc:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  8024cf:	48 b8 a6 1f 80 00 00 	movabs $0x801fa6,%rax
+  8024d6:	00 00 00 
+  8024d9:	ff d0                	call   *%rax
+  8024db:	89 c7                	mov    %eax,%edi
+  8024dd:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8024e3:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8024e8:	48 89 da             	mov    %rbx,%rdx
+  8024eb:	be 0f 00 00 00       	mov    $0xf,%esi
+  8024f0:	48 b8 86 55 80 00 00 	movabs $0x805586,%rax
+  8024f7:	00 00 00 
+  8024fa:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  8024fc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802501:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802505:	4c 89 e6             	mov    %r12,%rsi
+  802508:	bf 00 00 00 00       	mov    $0x0,%edi
+  80250d:	48 b8 62 55 80 00 00 	movabs $0x805562,%rax
+  802514:	00 00 00 
+  802517:	ff d0                	call   *%rax
+  802519:	48 98                	cltq
+}
+  80251b:	48 83 c4 10          	add    $0x10,%rsp
+  80251f:	5b                   	pop    %rbx
+  802520:	41 5c                	pop    %r12
+  802522:	41 5d                	pop    %r13
+  802524:	41 5e                	pop    %r14
+  802526:	5d                   	pop    %rbp
+  802527:	c3                   	ret
+
+0000000000802528 <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  802528:	48 8b 37             	mov    (%rdi),%rsi
+  80252b:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  802532:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  802539:	00 00 00 
+  80253c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802541:	eb 0f                	jmp    802552 <mmap_pgfault+0x2a>
+  802543:	c3                   	ret
+  802544:	48 83 c1 01          	add    $0x1,%rcx
+  802548:	48 83 c2 18          	add    $0x18,%rdx
+  80254c:	48 83 f9 20          	cmp    $0x20,%rcx
+  802550:	74 6e                	je     8025c0 <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  802552:	48 8b 02             	mov    (%rdx),%rax
+  802555:	48 83 e8 01          	sub    $0x1,%rax
+  802559:	48 39 f0             	cmp    %rsi,%rax
+  80255c:	73 e6                	jae    802544 <mmap_pgfault+0x1c>
+  80255e:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  802562:	73 e0                	jae    802544 <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  802564:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  802568:	b8 00 00 00 00       	mov    $0x0,%eax
+  80256d:	f6 c2 01             	test   $0x1,%dl
+  802570:	75 d1                	jne    802543 <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  802572:	f6 c2 02             	test   $0x2,%dl
+  802575:	74 1a                	je     802591 <mmap_pgfault+0x69>
+  802577:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  80257b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802580:	48 bf 00 20 82 00 00 	movabs $0x822000,%rdi
+  802587:	00 00 00 
+  80258a:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  80258f:	74 35                	je     8025c6 <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  802591:	55                   	push   %rbp
+  802592:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  802595:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  802599:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8025a0:	00 00 00 
+  8025a3:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  8025a7:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8025ac:	48 b8 17 24 80 00 00 	movabs $0x802417,%rax
+  8025b3:	00 00 00 
+  8025b6:	ff d0                	call   *%rax
+  8025b8:	48 85 c0             	test   %rax,%rax
+  8025bb:	0f 9f c0             	setg   %al
+}
+  8025be:	5d                   	pop    %rbp
+  8025bf:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  8025c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025c5:	c3                   	ret
+}
+  8025c6:	c3                   	ret
+
+00000000008025c7 <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  8025c7:	55                   	push   %rbp
+  8025c8:	48 89 e5             	mov    %rsp,%rbp
+  8025cb:	41 54                	push   %r12
+  8025cd:	53                   	push   %rbx
+  8025ce:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8025d1:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8025d8:	00 00 00 
+  8025db:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  8025e0:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8025e4:	74 15                	je     8025fb <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8025e6:	48 83 c3 01          	add    $0x1,%rbx
+  8025ea:	48 83 c0 18          	add    $0x18,%rax
+  8025ee:	48 83 fb 20          	cmp    $0x20,%rbx
+  8025f2:	75 ec                	jne    8025e0 <mmap_alloc+0x19>
+    return NULL;
+  8025f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025f9:	eb 52                	jmp    80264d <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  8025fb:	4c 89 e7             	mov    %r12,%rdi
+  8025fe:	48 b8 ea 49 80 00 00 	movabs $0x8049ea,%rax
+  802605:	00 00 00 
+  802608:	ff d0                	call   *%rax
+  80260a:	41 89 c1             	mov    %eax,%r9d
+  80260d:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  802614:	48 c1 e1 0c          	shl    $0xc,%rcx
+  802618:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80261e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802623:	4c 89 e6             	mov    %r12,%rsi
+  802626:	bf 00 00 00 00       	mov    $0x0,%edi
+  80262b:	48 b8 77 13 80 00 00 	movabs $0x801377,%rax
+  802632:	00 00 00 
+  802635:	ff d0                	call   *%rax
+  802637:	85 c0                	test   %eax,%eax
+  802639:	78 17                	js     802652 <mmap_alloc+0x8b>
+        return &mmaps[i];
+  80263b:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  80263f:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  802646:	00 00 00 
+  802649:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  80264d:	5b                   	pop    %rbx
+  80264e:	41 5c                	pop    %r12
+  802650:	5d                   	pop    %rbp
+  802651:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  802652:	b8 00 00 00 00       	mov    $0x0,%eax
+  802657:	eb f4                	jmp    80264d <mmap_alloc+0x86>
+
+0000000000802659 <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  802659:	55                   	push   %rbp
+  80265a:	48 89 e5             	mov    %rsp,%rbp
+  80265d:	41 56                	push   %r14
+  80265f:	41 55                	push   %r13
+  802661:	41 54                	push   %r12
+  802663:	53                   	push   %rbx
+  802664:	48 83 ec 10          	sub    $0x10,%rsp
+  802668:	41 89 fc             	mov    %edi,%r12d
+  80266b:	49 89 f5             	mov    %rsi,%r13
+  80266e:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  802671:	48 89 f0             	mov    %rsi,%rax
+  802674:	48 09 d0             	or     %rdx,%rax
+  802677:	75 0d                	jne    802686 <fsipc+0x2d>
+  802679:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  80267c:	83 f8 04             	cmp    $0x4,%eax
+  80267f:	76 7d                	jbe    8026fe <fsipc+0xa5>
+  802681:	83 ff 0d             	cmp    $0xd,%edi
+  802684:	74 78                	je     8026fe <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  802686:	48 b8 a6 1f 80 00 00 	movabs $0x801fa6,%rax
+  80268d:	00 00 00 
+  802690:	ff d0                	call   *%rax
+  802692:	89 c7                	mov    %eax,%edi
+  802694:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  80269b:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  8026a2:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  8026a9:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8026af:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  8026b6:	00 00 00 
+  8026b9:	44 89 e6             	mov    %r12d,%esi
+  8026bc:	48 b8 86 55 80 00 00 	movabs $0x805586,%rax
+  8026c3:	00 00 00 
+  8026c6:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  8026c8:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8026cf:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  8026d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026d5:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8026d9:	4c 89 ee             	mov    %r13,%rsi
+  8026dc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8026e1:	48 b8 62 55 80 00 00 	movabs $0x805562,%rax
+  8026e8:	00 00 00 
+  8026eb:	ff d0                	call   *%rax
+  8026ed:	89 c3                	mov    %eax,%ebx
+}
+  8026ef:	89 d8                	mov    %ebx,%eax
+  8026f1:	48 83 c4 10          	add    $0x10,%rsp
+  8026f5:	5b                   	pop    %rbx
+  8026f6:	41 5c                	pop    %r12
+  8026f8:	41 5d                	pop    %r13
+  8026fa:	41 5e                	pop    %r14
+  8026fc:	5d                   	pop    %rbp
+  8026fd:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  8026fe:	48 b8 0b 21 80 00 00 	movabs $0x80210b,%rax
+  802705:	00 00 00 
+  802708:	ff d0                	call   *%rax
+  80270a:	49 89 c6             	mov    %rax,%r14
+  80270d:	48 85 c0             	test   %rax,%rax
+  802710:	0f 84 70 ff ff ff    	je     802686 <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  802716:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  80271a:	48 b8 56 4e 80 00 00 	movabs $0x804e56,%rax
+  802721:	00 00 00 
+  802724:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  802726:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  802729:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  802730:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  802734:	ba 10 00 00 00       	mov    $0x10,%edx
+  802739:	48 be 00 00 83 00 00 	movabs $0x830000,%rsi
+  802740:	00 00 00 
+  802743:	48 b8 23 10 80 00 00 	movabs $0x801023,%rax
+  80274a:	00 00 00 
+  80274d:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  80274f:	4c 89 f7             	mov    %r14,%rdi
+  802752:	48 b8 a7 21 80 00 00 	movabs $0x8021a7,%rax
+  802759:	00 00 00 
+  80275c:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  80275e:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  802765:	4c 89 f7             	mov    %r14,%rdi
+  802768:	48 b8 19 4f 80 00 00 	movabs $0x804f19,%rax
+  80276f:	00 00 00 
+  802772:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  802774:	4c 89 f7             	mov    %r14,%rdi
+  802777:	48 b8 a7 4e 80 00 00 	movabs $0x804ea7,%rax
+  80277e:	00 00 00 
+  802781:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  802783:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  802786:	41 83 fc 05          	cmp    $0x5,%r12d
+  80278a:	75 04                	jne    802790 <fsipc+0x137>
+  80278c:	85 db                	test   %ebx,%ebx
+  80278e:	79 14                	jns    8027a4 <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  802790:	4c 89 f7             	mov    %r14,%rdi
+  802793:	48 b8 ce 4e 80 00 00 	movabs $0x804ece,%rax
+  80279a:	00 00 00 
+  80279d:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  80279f:	e9 4b ff ff ff       	jmp    8026ef <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  8027a4:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  8027a8:	ba 88 00 00 00       	mov    $0x88,%edx
+  8027ad:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  8027b4:	00 00 00 
+  8027b7:	48 b8 23 10 80 00 00 	movabs $0x801023,%rax
+  8027be:	00 00 00 
+  8027c1:	ff d0                	call   *%rax
+  8027c3:	eb cb                	jmp    802790 <fsipc+0x137>
+
+00000000008027c5 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  8027c5:	55                   	push   %rbp
+  8027c6:	48 89 e5             	mov    %rsp,%rbp
+  8027c9:	41 57                	push   %r15
+  8027cb:	41 56                	push   %r14
+  8027cd:	41 55                	push   %r13
+  8027cf:	41 54                	push   %r12
+  8027d1:	53                   	push   %rbx
+  8027d2:	48 83 ec 18          	sub    $0x18,%rsp
+  8027d6:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  8027da:	49 89 f6             	mov    %rsi,%r14
+  8027dd:	49 89 d4             	mov    %rdx,%r12
+  8027e0:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  8027e3:	48 b8 0b 21 80 00 00 	movabs $0x80210b,%rax
+  8027ea:	00 00 00 
+  8027ed:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  8027ef:	48 85 c0             	test   %rax,%rax
+  8027f2:	0f 85 96 00 00 00    	jne    80288e <devfile_write_direct+0xc9>
+    size_t write = 0;
+  8027f8:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8027ff:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802800:	49 bf 00 00 83 00 00 	movabs $0x830000,%r15
+  802807:	00 00 00 
+    while (n) {
+  80280a:	4d 85 e4             	test   %r12,%r12
+  80280d:	74 79                	je     802888 <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  80280f:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  802814:	49 39 dc             	cmp    %rbx,%r12
+  802817:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  80281b:	48 89 da             	mov    %rbx,%rdx
+  80281e:	4c 89 f6             	mov    %r14,%rsi
+  802821:	48 bf 00 10 83 00 00 	movabs $0x831000,%rdi
+  802828:	00 00 00 
+  80282b:	48 b8 23 10 80 00 00 	movabs $0x801023,%rax
+  802832:	00 00 00 
+  802835:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802837:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80283b:	8b 40 0c             	mov    0xc(%rax),%eax
+  80283e:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  802841:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802844:	44 01 e8             	add    %r13d,%eax
+  802847:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  80284b:	41 0f 44 c5          	cmove  %r13d,%eax
+  80284f:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  802853:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  802857:	48 89 da             	mov    %rbx,%rdx
+  80285a:	be 00 00 00 00       	mov    $0x0,%esi
+  80285f:	bf 04 00 00 00       	mov    $0x4,%edi
+  802864:	48 b8 59 26 80 00 00 	movabs $0x802659,%rax
+  80286b:	00 00 00 
+  80286e:	ff d0                	call   *%rax
+        if (res < 0)
+  802870:	85 c0                	test   %eax,%eax
+  802872:	78 4a                	js     8028be <devfile_write_direct+0xf9>
+        buf += res;
+  802874:	48 98                	cltq
+  802876:	49 01 c6             	add    %rax,%r14
+        write += res;
+  802879:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  80287d:	49 29 c4             	sub    %rax,%r12
+  802880:	75 8d                	jne    80280f <devfile_write_direct+0x4a>
+    return write;
+  802882:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802886:	eb 27                	jmp    8028af <devfile_write_direct+0xea>
+    size_t write = 0;
+  802888:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  80288c:	eb f4                	jmp    802882 <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  80288e:	45 89 e9             	mov    %r13d,%r9d
+  802891:	4d 89 e0             	mov    %r12,%r8
+  802894:	4c 89 f1             	mov    %r14,%rcx
+  802897:	ba 04 00 00 00       	mov    $0x4,%edx
+  80289c:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8028a0:	48 89 c7             	mov    %rax,%rdi
+  8028a3:	48 b8 f2 21 80 00 00 	movabs $0x8021f2,%rax
+  8028aa:	00 00 00 
+  8028ad:	ff d0                	call   *%rax
+}
+  8028af:	48 83 c4 18          	add    $0x18,%rsp
+  8028b3:	5b                   	pop    %rbx
+  8028b4:	41 5c                	pop    %r12
+  8028b6:	41 5d                	pop    %r13
+  8028b8:	41 5e                	pop    %r14
+  8028ba:	41 5f                	pop    %r15
+  8028bc:	5d                   	pop    %rbp
+  8028bd:	c3                   	ret
+            return res;
+  8028be:	48 98                	cltq
+  8028c0:	eb ed                	jmp    8028af <devfile_write_direct+0xea>
+
+00000000008028c2 <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  8028c2:	55                   	push   %rbp
+  8028c3:	48 89 e5             	mov    %rsp,%rbp
+  8028c6:	41 54                	push   %r12
+  8028c8:	53                   	push   %rbx
+  8028c9:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  8028cc:	48 b8 75 21 80 00 00 	movabs $0x802175,%rax
+  8028d3:	00 00 00 
+  8028d6:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  8028d8:	48 85 c0             	test   %rax,%rax
+  8028db:	74 71                	je     80294e <fbuf_flush+0x8c>
+  8028dd:	48 89 c3             	mov    %rax,%rbx
+  8028e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028e5:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  8028e9:	75 05                	jne    8028f0 <fbuf_flush+0x2e>
+}
+  8028eb:	5b                   	pop    %rbx
+  8028ec:	41 5c                	pop    %r12
+  8028ee:	5d                   	pop    %rbp
+  8028ef:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  8028f0:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  8028f3:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  8028f7:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8028fe:	00 00 00 
+  802901:	48 89 de             	mov    %rbx,%rsi
+  802904:	48 29 c6             	sub    %rax,%rsi
+  802907:	48 c1 fe 03          	sar    $0x3,%rsi
+  80290b:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802912:	aa aa aa 
+  802915:	48 0f af f0          	imul   %rax,%rsi
+  802919:	48 c1 e6 0e          	shl    $0xe,%rsi
+  80291d:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802922:	48 01 c6             	add    %rax,%rsi
+  802925:	4c 89 e7             	mov    %r12,%rdi
+  802928:	48 b8 c5 27 80 00 00 	movabs $0x8027c5,%rax
+  80292f:	00 00 00 
+  802932:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  802934:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  802938:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  80293f:	00 
+    return res < 0 ? res : 0;
+  802940:	48 85 c0             	test   %rax,%rax
+  802943:	ba 00 00 00 00       	mov    $0x0,%edx
+  802948:	48 0f 4f c2          	cmovg  %rdx,%rax
+  80294c:	eb 9d                	jmp    8028eb <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  80294e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802953:	eb 96                	jmp    8028eb <fbuf_flush+0x29>
+
+0000000000802955 <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  802955:	55                   	push   %rbp
+  802956:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  802959:	48 b8 c2 28 80 00 00 	movabs $0x8028c2,%rax
+  802960:	00 00 00 
+  802963:	ff d0                	call   *%rax
+}
+  802965:	5d                   	pop    %rbp
+  802966:	c3                   	ret
+
+0000000000802967 <devfile_write>:
+    if (!fd || !buf)
+  802967:	48 85 ff             	test   %rdi,%rdi
+  80296a:	0f 84 d3 01 00 00    	je     802b43 <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802970:	55                   	push   %rbp
+  802971:	48 89 e5             	mov    %rsp,%rbp
+  802974:	41 57                	push   %r15
+  802976:	41 56                	push   %r14
+  802978:	41 55                	push   %r13
+  80297a:	41 54                	push   %r12
+  80297c:	53                   	push   %rbx
+  80297d:	48 83 ec 08          	sub    $0x8,%rsp
+  802981:	49 89 fc             	mov    %rdi,%r12
+  802984:	49 89 f6             	mov    %rsi,%r14
+  802987:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  80298a:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  80298f:	48 85 f6             	test   %rsi,%rsi
+  802992:	0f 84 9c 01 00 00    	je     802b34 <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  802998:	48 b8 75 21 80 00 00 	movabs $0x802175,%rax
+  80299f:	00 00 00 
+  8029a2:	ff d0                	call   *%rax
+  8029a4:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  8029a7:	48 85 c0             	test   %rax,%rax
+  8029aa:	0f 84 a2 00 00 00    	je     802a52 <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  8029b0:	be 00 10 00 00       	mov    $0x1000,%esi
+  8029b5:	4c 89 e7             	mov    %r12,%rdi
+  8029b8:	48 b8 e6 12 80 00 00 	movabs $0x8012e6,%rax
+  8029bf:	00 00 00 
+  8029c2:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  8029c4:	83 f8 02             	cmp    $0x2,%eax
+  8029c7:	0f 8f 85 00 00 00    	jg     802a52 <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  8029cd:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8029d4:	00 00 00 
+  8029d7:	4d 89 ef             	mov    %r13,%r15
+  8029da:	49 29 c7             	sub    %rax,%r15
+  8029dd:	49 c1 ff 03          	sar    $0x3,%r15
+  8029e1:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8029e8:	aa aa aa 
+  8029eb:	4c 0f af f8          	imul   %rax,%r15
+  8029ef:	49 c1 e7 0e          	shl    $0xe,%r15
+  8029f3:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  8029f8:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  8029fb:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802a00:	0f 84 d7 00 00 00    	je     802add <devfile_write+0x176>
+  802a06:	49 8b 45 10          	mov    0x10(%r13),%rax
+  802a0a:	89 c2                	mov    %eax,%edx
+  802a0c:	41 03 55 0c          	add    0xc(%r13),%edx
+  802a10:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  802a15:	75 0f                	jne    802a26 <devfile_write+0xbf>
+  802a17:	48 01 d8             	add    %rbx,%rax
+  802a1a:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  802a20:	0f 86 92 00 00 00    	jbe    802ab8 <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802a26:	4c 89 e7             	mov    %r12,%rdi
+  802a29:	48 b8 c2 28 80 00 00 	movabs $0x8028c2,%rax
+  802a30:	00 00 00 
+  802a33:	ff d0                	call   *%rax
+  802a35:	85 c0                	test   %eax,%eax
+  802a37:	78 52                	js     802a8b <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802a39:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802a40:	77 7f                	ja     802ac1 <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  802a42:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802a47:	0f 85 c2 00 00 00    	jne    802b0f <devfile_write+0x1a8>
+  802a4d:	e9 94 00 00 00       	jmp    802ae6 <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  802a52:	4c 89 e7             	mov    %r12,%rdi
+  802a55:	48 b8 c2 28 80 00 00 	movabs $0x8028c2,%rax
+  802a5c:	00 00 00 
+  802a5f:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802a61:	85 c0                	test   %eax,%eax
+  802a63:	79 07                	jns    802a6c <devfile_write+0x105>
+  802a65:	48 98                	cltq
+  802a67:	e9 c8 00 00 00       	jmp    802b34 <devfile_write+0x1cd>
+  802a6c:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802a71:	48 89 da             	mov    %rbx,%rdx
+  802a74:	4c 89 f6             	mov    %r14,%rsi
+  802a77:	4c 89 e7             	mov    %r12,%rdi
+  802a7a:	48 b8 c5 27 80 00 00 	movabs $0x8027c5,%rax
+  802a81:	00 00 00 
+  802a84:	ff d0                	call   *%rax
+  802a86:	e9 a9 00 00 00       	jmp    802b34 <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802a8b:	48 98                	cltq
+  802a8d:	e9 a2 00 00 00       	jmp    802b34 <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802a92:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802a97:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802a9c:	4c 89 fe             	mov    %r15,%rsi
+  802a9f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802aa4:	48 b8 21 13 80 00 00 	movabs $0x801321,%rax
+  802aab:	00 00 00 
+  802aae:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  802ab0:	85 c0                	test   %eax,%eax
+  802ab2:	79 45                	jns    802af9 <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802ab4:	48 98                	cltq
+  802ab6:	eb 7c                	jmp    802b34 <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802ab8:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802abf:	76 4e                	jbe    802b0f <devfile_write+0x1a8>
+  802ac1:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802ac6:	48 89 da             	mov    %rbx,%rdx
+  802ac9:	4c 89 f6             	mov    %r14,%rsi
+  802acc:	4c 89 e7             	mov    %r12,%rdi
+  802acf:	48 b8 c5 27 80 00 00 	movabs $0x8027c5,%rax
+  802ad6:	00 00 00 
+  802ad9:	ff d0                	call   *%rax
+  802adb:	eb 57                	jmp    802b34 <devfile_write+0x1cd>
+  802add:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802ae4:	77 db                	ja     802ac1 <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  802ae6:	4c 89 ff             	mov    %r15,%rdi
+  802ae9:	48 b8 49 4a 80 00 00 	movabs $0x804a49,%rax
+  802af0:	00 00 00 
+  802af3:	ff d0                	call   *%rax
+  802af5:	84 c0                	test   %al,%al
+  802af7:	74 99                	je     802a92 <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  802af9:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  802afe:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802b03:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  802b07:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  802b0e:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  802b0f:	4c 89 ff             	mov    %r15,%rdi
+  802b12:	49 03 7d 10          	add    0x10(%r13),%rdi
+  802b16:	48 89 da             	mov    %rbx,%rdx
+  802b19:	4c 89 f6             	mov    %r14,%rsi
+  802b1c:	48 b8 23 10 80 00 00 	movabs $0x801023,%rax
+  802b23:	00 00 00 
+  802b26:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  802b28:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  802b2c:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  802b31:	48 89 d8             	mov    %rbx,%rax
+}
+  802b34:	48 83 c4 08          	add    $0x8,%rsp
+  802b38:	5b                   	pop    %rbx
+  802b39:	41 5c                	pop    %r12
+  802b3b:	41 5d                	pop    %r13
+  802b3d:	41 5e                	pop    %r14
+  802b3f:	41 5f                	pop    %r15
+  802b41:	5d                   	pop    %rbp
+  802b42:	c3                   	ret
+        return E_INVAL;
+  802b43:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802b48:	c3                   	ret
+
+0000000000802b49 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802b49:	55                   	push   %rbp
+  802b4a:	48 89 e5             	mov    %rsp,%rbp
+  802b4d:	41 54                	push   %r12
+  802b4f:	53                   	push   %rbx
+  802b50:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  802b53:	48 b8 c2 28 80 00 00 	movabs $0x8028c2,%rax
+  802b5a:	00 00 00 
+  802b5d:	ff d0                	call   *%rax
+  802b5f:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  802b62:	48 89 df             	mov    %rbx,%rdi
+  802b65:	48 b8 75 21 80 00 00 	movabs $0x802175,%rax
+  802b6c:	00 00 00 
+  802b6f:	ff d0                	call   *%rax
+  802b71:	48 85 c0             	test   %rax,%rax
+  802b74:	74 17                	je     802b8d <devfile_flush+0x44>
+  802b76:	48 89 df             	mov    %rbx,%rdi
+  802b79:	48 b8 75 21 80 00 00 	movabs $0x802175,%rax
+  802b80:	00 00 00 
+  802b83:	ff d0                	call   *%rax
+  802b85:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  802b8c:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802b8d:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802b90:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  802b97:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  802b99:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b9e:	be 00 00 00 00       	mov    $0x0,%esi
+  802ba3:	bf 06 00 00 00       	mov    $0x6,%edi
+  802ba8:	48 b8 59 26 80 00 00 	movabs $0x802659,%rax
+  802baf:	00 00 00 
+  802bb2:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802bb4:	45 85 e4             	test   %r12d,%r12d
+  802bb7:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802bbb:	5b                   	pop    %rbx
+  802bbc:	41 5c                	pop    %r12
+  802bbe:	5d                   	pop    %rbp
+  802bbf:	c3                   	ret
+
+0000000000802bc0 <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  802bc0:	55                   	push   %rbp
+  802bc1:	48 89 e5             	mov    %rsp,%rbp
+  802bc4:	41 57                	push   %r15
+  802bc6:	41 56                	push   %r14
+  802bc8:	41 55                	push   %r13
+  802bca:	41 54                	push   %r12
+  802bcc:	53                   	push   %rbx
+  802bcd:	48 83 ec 38          	sub    $0x38,%rsp
+  802bd1:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  802bd5:	49 89 f7             	mov    %rsi,%r15
+  802bd8:	48 89 d3             	mov    %rdx,%rbx
+  802bdb:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  802bde:	48 b8 0b 21 80 00 00 	movabs $0x80210b,%rax
+  802be5:	00 00 00 
+  802be8:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802bea:	48 85 c0             	test   %rax,%rax
+  802bed:	75 20                	jne    802c0f <devfile_read_direct+0x4f>
+    bool map = 1;
+  802bef:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  802bf4:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802bfb:	00 
+    while (n) {
+  802bfc:	48 85 db             	test   %rbx,%rbx
+  802bff:	0f 85 df 00 00 00    	jne    802ce4 <devfile_read_direct+0x124>
+    size_t read = 0;
+  802c05:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  802c09:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802c0d:	eb 21                	jmp    802c30 <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802c0f:	45 89 f1             	mov    %r14d,%r9d
+  802c12:	49 89 d8             	mov    %rbx,%r8
+  802c15:	4c 89 f9             	mov    %r15,%rcx
+  802c18:	ba 03 00 00 00       	mov    $0x3,%edx
+  802c1d:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802c21:	48 89 c7             	mov    %rax,%rdi
+  802c24:	48 b8 f2 21 80 00 00 	movabs $0x8021f2,%rax
+  802c2b:	00 00 00 
+  802c2e:	ff d0                	call   *%rax
+}
+  802c30:	48 83 c4 38          	add    $0x38,%rsp
+  802c34:	5b                   	pop    %rbx
+  802c35:	41 5c                	pop    %r12
+  802c37:	41 5d                	pop    %r13
+  802c39:	41 5e                	pop    %r14
+  802c3b:	41 5f                	pop    %r15
+  802c3d:	5d                   	pop    %rbp
+  802c3e:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802c3f:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802c43:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802c49:	75 1e                	jne    802c69 <devfile_read_direct+0xa9>
+  802c4b:	e9 e2 00 00 00       	jmp    802d32 <devfile_read_direct+0x172>
+            if (!res) return read;
+  802c50:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802c54:	eb da                	jmp    802c30 <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  802c56:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  802c5a:	0f 85 d0 01 00 00    	jne    802e30 <devfile_read_direct+0x270>
+            map = 0;
+  802c60:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802c64:	eb 03                	jmp    802c69 <devfile_read_direct+0xa9>
+  802c66:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802c69:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802c6e:	48 39 d3             	cmp    %rdx,%rbx
+  802c71:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802c75:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802c79:	8b 40 0c             	mov    0xc(%rax),%eax
+  802c7c:	48 b9 00 00 83 00 00 	movabs $0x830000,%rcx
+  802c83:	00 00 00 
+  802c86:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  802c88:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  802c8c:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  802c90:	be 00 00 00 00       	mov    $0x0,%esi
+  802c95:	bf 03 00 00 00       	mov    $0x3,%edi
+  802c9a:	48 b8 59 26 80 00 00 	movabs $0x802659,%rax
+  802ca1:	00 00 00 
+  802ca4:	ff d0                	call   *%rax
+        if (res <= 0)
+  802ca6:	85 c0                	test   %eax,%eax
+  802ca8:	0f 8e 63 01 00 00    	jle    802e11 <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  802cae:	4c 63 e0             	movslq %eax,%r12
+  802cb1:	4c 89 e2             	mov    %r12,%rdx
+  802cb4:	48 be 00 10 83 00 00 	movabs $0x831000,%rsi
+  802cbb:	00 00 00 
+  802cbe:	4c 89 ff             	mov    %r15,%rdi
+  802cc1:	48 b8 23 10 80 00 00 	movabs $0x801023,%rax
+  802cc8:	00 00 00 
+  802ccb:	ff d0                	call   *%rax
+        buf += res;
+  802ccd:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  802cd0:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  802cd3:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  802cd7:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  802cdb:	48 85 db             	test   %rbx,%rbx
+  802cde:	0f 84 25 ff ff ff    	je     802c09 <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  802ce4:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  802ce7:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  802ceb:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802cef:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802cf3:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  802cfa:	0f 97 c2             	seta   %dl
+  802cfd:	20 c2                	and    %al,%dl
+  802cff:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  802d02:	0f 84 5e ff ff ff    	je     802c66 <devfile_read_direct+0xa6>
+  802d08:	4c 89 fa             	mov    %r15,%rdx
+  802d0b:	4d 89 fd             	mov    %r15,%r13
+  802d0e:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  802d15:	0f 85 4e ff ff ff    	jne    802c69 <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  802d1b:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802d1f:	0f 84 1a ff ff ff    	je     802c3f <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802d25:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802d2c:	0f 85 37 ff ff ff    	jne    802c69 <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  802d32:	48 89 d8             	mov    %rbx,%rax
+  802d35:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802d3b:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802d40:	48 39 c8             	cmp    %rcx,%rax
+  802d43:	48 0f 47 c1          	cmova  %rcx,%rax
+  802d47:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  802d4b:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  802d4f:	49 89 d4             	mov    %rdx,%r12
+  802d52:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  802d56:	48 b8 ea 49 80 00 00 	movabs $0x8049ea,%rax
+  802d5d:	00 00 00 
+  802d60:	ff d0                	call   *%rax
+  802d62:	a8 40                	test   $0x40,%al
+  802d64:	0f 85 b9 00 00 00    	jne    802e23 <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  802d6a:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  802d71:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802d75:	49 39 c5             	cmp    %rax,%r13
+  802d78:	72 d8                	jb     802d52 <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802d7a:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802d7e:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802d85:	00 00 00 
+  802d88:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802d8c:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  802d8f:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  802d91:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  802d95:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  802d99:	48 b8 a6 1f 80 00 00 	movabs $0x801fa6,%rax
+  802da0:	00 00 00 
+  802da3:	ff d0                	call   *%rax
+  802da5:	89 c7                	mov    %eax,%edi
+  802da7:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802dad:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802db2:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802db9:	00 00 00 
+  802dbc:	be 0e 00 00 00       	mov    $0xe,%esi
+  802dc1:	48 b8 86 55 80 00 00 	movabs $0x805586,%rax
+  802dc8:	00 00 00 
+  802dcb:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  802dcd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802dd2:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802dd6:	4c 89 fe             	mov    %r15,%rsi
+  802dd9:	bf 00 00 00 00       	mov    $0x0,%edi
+  802dde:	48 b8 62 55 80 00 00 	movabs $0x805562,%rax
+  802de5:	00 00 00 
+  802de8:	ff d0                	call   *%rax
+  802dea:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  802ded:	48 85 d2             	test   %rdx,%rdx
+  802df0:	0f 84 5a fe ff ff    	je     802c50 <devfile_read_direct+0x90>
+            if (res > 0) {
+  802df6:	0f 8e 5a fe ff ff    	jle    802c56 <devfile_read_direct+0x96>
+                buf += res;
+  802dfc:	48 98                	cltq
+  802dfe:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  802e01:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  802e04:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  802e08:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  802e0c:	e9 ca fe ff ff       	jmp    802cdb <devfile_read_direct+0x11b>
+            return res ? res : read;
+  802e11:	41 89 c5             	mov    %eax,%r13d
+  802e14:	48 98                	cltq
+  802e16:	45 85 ed             	test   %r13d,%r13d
+  802e19:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  802e1e:	e9 0d fe ff ff       	jmp    802c30 <devfile_read_direct+0x70>
+            map = 0;
+  802e23:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802e27:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802e2b:	e9 39 fe ff ff       	jmp    802c69 <devfile_read_direct+0xa9>
+  802e30:	48 89 d0             	mov    %rdx,%rax
+  802e33:	e9 f8 fd ff ff       	jmp    802c30 <devfile_read_direct+0x70>
+
+0000000000802e38 <devfile_read>:
+    if (!fd || !buf)
+  802e38:	48 85 ff             	test   %rdi,%rdi
+  802e3b:	0f 84 21 02 00 00    	je     803062 <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802e41:	55                   	push   %rbp
+  802e42:	48 89 e5             	mov    %rsp,%rbp
+  802e45:	41 57                	push   %r15
+  802e47:	41 56                	push   %r14
+  802e49:	41 55                	push   %r13
+  802e4b:	41 54                	push   %r12
+  802e4d:	53                   	push   %rbx
+  802e4e:	48 83 ec 28          	sub    $0x28,%rsp
+  802e52:	48 89 fb             	mov    %rdi,%rbx
+  802e55:	49 89 f4             	mov    %rsi,%r12
+  802e58:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  802e5b:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802e60:	48 85 f6             	test   %rsi,%rsi
+  802e63:	74 4b                	je     802eb0 <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  802e65:	48 b8 75 21 80 00 00 	movabs $0x802175,%rax
+  802e6c:	00 00 00 
+  802e6f:	ff d0                	call   *%rax
+  802e71:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802e74:	48 85 c0             	test   %rax,%rax
+  802e77:	74 22                	je     802e9b <devfile_read+0x63>
+  802e79:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  802e80:	77 19                	ja     802e9b <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802e82:	be 00 10 00 00       	mov    $0x1000,%esi
+  802e87:	48 89 df             	mov    %rbx,%rdi
+  802e8a:	48 b8 e6 12 80 00 00 	movabs $0x8012e6,%rax
+  802e91:	00 00 00 
+  802e94:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802e96:	83 f8 02             	cmp    $0x2,%eax
+  802e99:	7e 40                	jle    802edb <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  802e9b:	48 89 df             	mov    %rbx,%rdi
+  802e9e:	48 b8 c2 28 80 00 00 	movabs $0x8028c2,%rax
+  802ea5:	00 00 00 
+  802ea8:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802eaa:	85 c0                	test   %eax,%eax
+  802eac:	79 11                	jns    802ebf <devfile_read+0x87>
+  802eae:	48 98                	cltq
+}
+  802eb0:	48 83 c4 28          	add    $0x28,%rsp
+  802eb4:	5b                   	pop    %rbx
+  802eb5:	41 5c                	pop    %r12
+  802eb7:	41 5d                	pop    %r13
+  802eb9:	41 5e                	pop    %r14
+  802ebb:	41 5f                	pop    %r15
+  802ebd:	5d                   	pop    %rbp
+  802ebe:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802ebf:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802ec4:	4c 89 ea             	mov    %r13,%rdx
+  802ec7:	4c 89 e6             	mov    %r12,%rsi
+  802eca:	48 89 df             	mov    %rbx,%rdi
+  802ecd:	48 b8 c0 2b 80 00 00 	movabs $0x802bc0,%rax
+  802ed4:	00 00 00 
+  802ed7:	ff d0                	call   *%rax
+  802ed9:	eb d5                	jmp    802eb0 <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  802edb:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802edf:	48 89 df             	mov    %rbx,%rdi
+  802ee2:	48 b8 c2 28 80 00 00 	movabs $0x8028c2,%rax
+  802ee9:	00 00 00 
+  802eec:	ff d0                	call   *%rax
+  802eee:	85 c0                	test   %eax,%eax
+  802ef0:	0f 88 33 01 00 00    	js     803029 <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  802ef6:	48 ba 00 23 82 00 00 	movabs $0x822300,%rdx
+  802efd:	00 00 00 
+  802f00:	4c 89 f0             	mov    %r14,%rax
+  802f03:	48 29 d0             	sub    %rdx,%rax
+  802f06:	48 c1 f8 03          	sar    $0x3,%rax
+  802f0a:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  802f11:	aa aa aa 
+  802f14:	48 0f af c2          	imul   %rdx,%rax
+  802f18:	48 c1 e0 0e          	shl    $0xe,%rax
+  802f1c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  802f20:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802f23:	41 39 06             	cmp    %eax,(%r14)
+  802f26:	75 0d                	jne    802f35 <devfile_read+0xfd>
+  802f28:	8b 43 10             	mov    0x10(%rbx),%eax
+  802f2b:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  802f2f:	0f 84 fb 00 00 00    	je     803030 <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  802f35:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802f3a:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802f3e:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  802f41:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802f45:	48 89 c7             	mov    %rax,%rdi
+  802f48:	48 b8 49 4a 80 00 00 	movabs $0x804a49,%rax
+  802f4f:	00 00 00 
+  802f52:	ff d0                	call   *%rax
+  802f54:	84 c0                	test   %al,%al
+  802f56:	75 27                	jne    802f7f <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802f58:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802f5d:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802f62:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802f66:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f6b:	48 b8 21 13 80 00 00 	movabs $0x801321,%rax
+  802f72:	00 00 00 
+  802f75:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  802f77:	85 c0                	test   %eax,%eax
+  802f79:	0f 88 dc 00 00 00    	js     80305b <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  802f7f:	44 89 f8             	mov    %r15d,%eax
+  802f82:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802f87:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  802f89:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  802f90:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  802f91:	8b 43 10             	mov    0x10(%rbx),%eax
+  802f94:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  802f98:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  802f9b:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802fa0:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802fa4:	48 89 df             	mov    %rbx,%rdi
+  802fa7:	48 b8 c0 2b 80 00 00 	movabs $0x802bc0,%rax
+  802fae:	00 00 00 
+  802fb1:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  802fb3:	48 85 c0             	test   %rax,%rax
+  802fb6:	0f 88 f4 fe ff ff    	js     802eb0 <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  802fbc:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802fbf:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  802fc2:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  802fc5:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  802fc9:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  802fcd:	48 63 d1             	movslq %ecx,%rdx
+  802fd0:	48 01 d0             	add    %rdx,%rax
+  802fd3:	4d 63 ff             	movslq %r15d,%r15
+  802fd6:	4c 29 f8             	sub    %r15,%rax
+  802fd9:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fde:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  802fe2:	48 85 c0             	test   %rax,%rax
+  802fe5:	0f 8e c5 fe ff ff    	jle    802eb0 <devfile_read+0x78>
+    n = MIN(n, res);
+  802feb:	4c 39 e8             	cmp    %r13,%rax
+  802fee:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  802ff2:	8b 73 04             	mov    0x4(%rbx),%esi
+  802ff5:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  802ff9:	48 63 f6             	movslq %esi,%rsi
+  802ffc:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  803001:	48 01 c6             	add    %rax,%rsi
+  803004:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803008:	48 01 c6             	add    %rax,%rsi
+  80300b:	4c 89 ea             	mov    %r13,%rdx
+  80300e:	4c 89 e7             	mov    %r12,%rdi
+  803011:	48 b8 23 10 80 00 00 	movabs $0x801023,%rax
+  803018:	00 00 00 
+  80301b:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  80301d:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  803021:	4c 89 e8             	mov    %r13,%rax
+  803024:	e9 87 fe ff ff       	jmp    802eb0 <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  803029:	48 98                	cltq
+  80302b:	e9 80 fe ff ff       	jmp    802eb0 <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  803030:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  803034:	41 39 d7             	cmp    %edx,%r15d
+  803037:	0f 8c f8 fe ff ff    	jl     802f35 <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  80303d:	49 8b 46 10          	mov    0x10(%r14),%rax
+  803041:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  803044:	41 39 cf             	cmp    %ecx,%r15d
+  803047:	0f 8d e8 fe ff ff    	jge    802f35 <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  80304d:	4d 63 ff             	movslq %r15d,%r15
+  803050:	4c 29 f8             	sub    %r15,%rax
+  803053:	48 63 d2             	movslq %edx,%rdx
+  803056:	48 01 d0             	add    %rdx,%rax
+  803059:	eb 87                	jmp    802fe2 <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  80305b:	48 98                	cltq
+  80305d:	e9 4e fe ff ff       	jmp    802eb0 <devfile_read+0x78>
+        return E_INVAL;
+  803062:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  803067:	c3                   	ret
+
+0000000000803068 <fs_channel>:
+fs_channel(bool enable) {
+  803068:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  80306a:	a2 04 26 82 00 00 00 	movabs %al,0x822604
+  803071:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  803073:	ba 00 00 00 00       	mov    $0x0,%edx
+  803078:	40 84 ff             	test   %dil,%dil
+  80307b:	74 47                	je     8030c4 <fs_channel+0x5c>
+  80307d:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  803084:	00 00 00 
+  803087:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  80308d:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  803094:	00 00 00 
+  803097:	3b 08                	cmp    (%rax),%ecx
+  803099:	74 29                	je     8030c4 <fs_channel+0x5c>
+fs_channel(bool enable) {
+  80309b:	55                   	push   %rbp
+  80309c:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  80309f:	48 b8 e8 1f 80 00 00 	movabs $0x801fe8,%rax
+  8030a6:	00 00 00 
+  8030a9:	ff d0                	call   *%rax
+  8030ab:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  8030ad:	85 c0                	test   %eax,%eax
+  8030af:	78 04                	js     8030b5 <fs_channel+0x4d>
+}
+  8030b1:	89 d0                	mov    %edx,%eax
+  8030b3:	5d                   	pop    %rbp
+  8030b4:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  8030b5:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  8030bc:	00 00 00 
+  8030bf:	c6 00 00             	movb   $0x0,(%rax)
+  8030c2:	eb ed                	jmp    8030b1 <fs_channel+0x49>
+}
+  8030c4:	89 d0                	mov    %edx,%eax
+  8030c6:	c3                   	ret
+
+00000000008030c7 <open>:
+open(const char *path, int mode) {
+  8030c7:	55                   	push   %rbp
+  8030c8:	48 89 e5             	mov    %rsp,%rbp
+  8030cb:	41 55                	push   %r13
+  8030cd:	41 54                	push   %r12
+  8030cf:	53                   	push   %rbx
+  8030d0:	48 83 ec 18          	sub    $0x18,%rsp
+  8030d4:	49 89 fc             	mov    %rdi,%r12
+  8030d7:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8030da:	48 b8 84 0d 80 00 00 	movabs $0x800d84,%rax
+  8030e1:	00 00 00 
+  8030e4:	ff d0                	call   *%rax
+  8030e6:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8030ec:	0f 87 8f 00 00 00    	ja     803181 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8030f2:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8030f6:	48 b8 a2 18 80 00 00 	movabs $0x8018a2,%rax
+  8030fd:	00 00 00 
+  803100:	ff d0                	call   *%rax
+  803102:	89 c3                	mov    %eax,%ebx
+  803104:	85 c0                	test   %eax,%eax
+  803106:	78 55                	js     80315d <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  803108:	4c 89 e6             	mov    %r12,%rsi
+  80310b:	48 bb 00 00 83 00 00 	movabs $0x830000,%rbx
+  803112:	00 00 00 
+  803115:	48 89 df             	mov    %rbx,%rdi
+  803118:	48 b8 c2 0d 80 00 00 	movabs $0x800dc2,%rax
+  80311f:	00 00 00 
+  803122:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803124:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  80312b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803130:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803134:	bf 01 00 00 00       	mov    $0x1,%edi
+  803139:	48 b8 59 26 80 00 00 	movabs $0x802659,%rax
+  803140:	00 00 00 
+  803143:	ff d0                	call   *%rax
+  803145:	89 c3                	mov    %eax,%ebx
+  803147:	85 c0                	test   %eax,%eax
+  803149:	78 1f                	js     80316a <open+0xa3>
+    return fd2num(fd);
+  80314b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80314f:	48 b8 74 18 80 00 00 	movabs $0x801874,%rax
+  803156:	00 00 00 
+  803159:	ff d0                	call   *%rax
+  80315b:	89 c3                	mov    %eax,%ebx
+}
+  80315d:	89 d8                	mov    %ebx,%eax
+  80315f:	48 83 c4 18          	add    $0x18,%rsp
+  803163:	5b                   	pop    %rbx
+  803164:	41 5c                	pop    %r12
+  803166:	41 5d                	pop    %r13
+  803168:	5d                   	pop    %rbp
+  803169:	c3                   	ret
+        fd_close(fd, 0);
+  80316a:	be 00 00 00 00       	mov    $0x0,%esi
+  80316f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803173:	48 b8 bd 19 80 00 00 	movabs $0x8019bd,%rax
+  80317a:	00 00 00 
+  80317d:	ff d0                	call   *%rax
+        return res;
+  80317f:	eb dc                	jmp    80315d <open+0x96>
+        return -E_BAD_PATH;
+  803181:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803186:	eb d5                	jmp    80315d <open+0x96>
+
+0000000000803188 <file_flush_buffers>:
+file_flush_buffers(void) {
+  803188:	55                   	push   %rbp
+  803189:	48 89 e5             	mov    %rsp,%rbp
+  80318c:	41 56                	push   %r14
+  80318e:	41 55                	push   %r13
+  803190:	41 54                	push   %r12
+  803192:	53                   	push   %rbx
+  803193:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  803197:	49 bc 08 23 82 00 00 	movabs $0x822308,%r12
+  80319e:	00 00 00 
+  8031a1:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  8031a6:	49 bd 02 19 80 00 00 	movabs $0x801902,%r13
+  8031ad:	00 00 00 
+  8031b0:	49 be c2 28 80 00 00 	movabs $0x8028c2,%r14
+  8031b7:	00 00 00 
+  8031ba:	eb 0c                	jmp    8031c8 <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  8031bc:	83 c3 01             	add    $0x1,%ebx
+  8031bf:	49 83 c4 18          	add    $0x18,%r12
+  8031c3:	83 fb 20             	cmp    $0x20,%ebx
+  8031c6:	74 1d                	je     8031e5 <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  8031c8:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  8031cd:	74 ed                	je     8031bc <file_flush_buffers+0x34>
+  8031cf:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8031d3:	89 df                	mov    %ebx,%edi
+  8031d5:	41 ff d5             	call   *%r13
+  8031d8:	85 c0                	test   %eax,%eax
+  8031da:	78 e0                	js     8031bc <file_flush_buffers+0x34>
+  8031dc:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8031e0:	41 ff d6             	call   *%r14
+  8031e3:	eb d7                	jmp    8031bc <file_flush_buffers+0x34>
+}
+  8031e5:	48 83 c4 10          	add    $0x10,%rsp
+  8031e9:	5b                   	pop    %rbx
+  8031ea:	41 5c                	pop    %r12
+  8031ec:	41 5d                	pop    %r13
+  8031ee:	41 5e                	pop    %r14
+  8031f0:	5d                   	pop    %rbp
+  8031f1:	c3                   	ret
+
+00000000008031f2 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8031f2:	55                   	push   %rbp
+  8031f3:	48 89 e5             	mov    %rsp,%rbp
+  8031f6:	41 54                	push   %r12
+  8031f8:	53                   	push   %rbx
+  8031f9:	49 89 fc             	mov    %rdi,%r12
+  8031fc:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  8031fe:	48 b8 88 31 80 00 00 	movabs $0x803188,%rax
+  803205:	00 00 00 
+  803208:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80320a:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803211:	00 00 00 
+  803214:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  803219:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  80321b:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  80321e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803223:	be 00 00 00 00       	mov    $0x0,%esi
+  803228:	bf 02 00 00 00       	mov    $0x2,%edi
+  80322d:	48 b8 59 26 80 00 00 	movabs $0x802659,%rax
+  803234:	00 00 00 
+  803237:	ff d0                	call   *%rax
+}
+  803239:	5b                   	pop    %rbx
+  80323a:	41 5c                	pop    %r12
+  80323c:	5d                   	pop    %rbp
+  80323d:	c3                   	ret
+
+000000000080323e <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80323e:	55                   	push   %rbp
+  80323f:	48 89 e5             	mov    %rsp,%rbp
+  803242:	41 54                	push   %r12
+  803244:	53                   	push   %rbx
+  803245:	49 89 fc             	mov    %rdi,%r12
+  803248:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  80324b:	48 b8 88 31 80 00 00 	movabs $0x803188,%rax
+  803252:	00 00 00 
+  803255:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803257:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  80325c:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  803263:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  803265:	ba 00 00 00 00       	mov    $0x0,%edx
+  80326a:	be 00 00 00 00       	mov    $0x0,%esi
+  80326f:	bf 05 00 00 00       	mov    $0x5,%edi
+  803274:	48 b8 59 26 80 00 00 	movabs $0x802659,%rax
+  80327b:	00 00 00 
+  80327e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803280:	85 c0                	test   %eax,%eax
+  803282:	78 3d                	js     8032c1 <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803284:	49 bc 00 00 83 00 00 	movabs $0x830000,%r12
+  80328b:	00 00 00 
+  80328e:	4c 89 e6             	mov    %r12,%rsi
+  803291:	48 89 df             	mov    %rbx,%rdi
+  803294:	48 b8 c2 0d 80 00 00 	movabs $0x800dc2,%rax
+  80329b:	00 00 00 
+  80329e:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8032a0:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8032a7:	00 
+  8032a8:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8032ae:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8032b5:	00 
+  8032b6:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8032bc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032c1:	5b                   	pop    %rbx
+  8032c2:	41 5c                	pop    %r12
+  8032c4:	5d                   	pop    %rbp
+  8032c5:	c3                   	ret
+
+00000000008032c6 <remove>:
+remove(const char *path) {
+  8032c6:	55                   	push   %rbp
+  8032c7:	48 89 e5             	mov    %rsp,%rbp
+  8032ca:	53                   	push   %rbx
+  8032cb:	48 83 ec 08          	sub    $0x8,%rsp
+  8032cf:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  8032d2:	48 b8 84 0d 80 00 00 	movabs $0x800d84,%rax
+  8032d9:	00 00 00 
+  8032dc:	ff d0                	call   *%rax
+  8032de:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8032e4:	77 3a                	ja     803320 <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  8032e6:	48 89 de             	mov    %rbx,%rsi
+  8032e9:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  8032f0:	00 00 00 
+  8032f3:	48 b8 c2 0d 80 00 00 	movabs $0x800dc2,%rax
+  8032fa:	00 00 00 
+  8032fd:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  8032ff:	ba 00 00 00 00       	mov    $0x0,%edx
+  803304:	be 00 00 00 00       	mov    $0x0,%esi
+  803309:	bf 07 00 00 00       	mov    $0x7,%edi
+  80330e:	48 b8 59 26 80 00 00 	movabs $0x802659,%rax
+  803315:	00 00 00 
+  803318:	ff d0                	call   *%rax
+}
+  80331a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80331e:	c9                   	leave
+  80331f:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  803320:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803325:	eb f3                	jmp    80331a <remove+0x54>
+
+0000000000803327 <sync>:
+sync(void) {
+  803327:	55                   	push   %rbp
+  803328:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  80332b:	48 b8 88 31 80 00 00 	movabs $0x803188,%rax
+  803332:	00 00 00 
+  803335:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  803337:	ba 00 00 00 00       	mov    $0x0,%edx
+  80333c:	be 00 00 00 00       	mov    $0x0,%esi
+  803341:	bf 08 00 00 00       	mov    $0x8,%edi
+  803346:	48 b8 59 26 80 00 00 	movabs $0x802659,%rax
+  80334d:	00 00 00 
+  803350:	ff d0                	call   *%rax
+}
+  803352:	5d                   	pop    %rbp
+  803353:	c3                   	ret
+
+0000000000803354 <fsync>:
+fsync(int fdnum) {
+  803354:	55                   	push   %rbp
+  803355:	48 89 e5             	mov    %rsp,%rbp
+  803358:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80335c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803360:	48 b8 02 19 80 00 00 	movabs $0x801902,%rax
+  803367:	00 00 00 
+  80336a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80336c:	85 c0                	test   %eax,%eax
+  80336e:	78 4b                	js     8033bb <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803370:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803374:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  80337b:	00 00 00 
+  80337e:	8b 00                	mov    (%rax),%eax
+  803380:	39 02                	cmp    %eax,(%rdx)
+  803382:	75 39                	jne    8033bd <fsync+0x69>
+    file_flush_buffers();
+  803384:	48 b8 88 31 80 00 00 	movabs $0x803188,%rax
+  80338b:	00 00 00 
+  80338e:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  803390:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803394:	8b 40 0c             	mov    0xc(%rax),%eax
+  803397:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  80339e:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  8033a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8033a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8033aa:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8033af:	48 b8 59 26 80 00 00 	movabs $0x802659,%rax
+  8033b6:	00 00 00 
+  8033b9:	ff d0                	call   *%rax
+}
+  8033bb:	c9                   	leave
+  8033bc:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8033bd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8033c2:	eb f7                	jmp    8033bb <fsync+0x67>
+
+00000000008033c4 <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  8033c4:	55                   	push   %rbp
+  8033c5:	48 89 e5             	mov    %rsp,%rbp
+  8033c8:	53                   	push   %rbx
+  8033c9:	48 83 ec 08          	sub    $0x8,%rsp
+  8033cd:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  8033d0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8033d5:	be 00 00 00 00       	mov    $0x0,%esi
+  8033da:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8033df:	48 b8 59 26 80 00 00 	movabs $0x802659,%rax
+  8033e6:	00 00 00 
+  8033e9:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8033eb:	85 c0                	test   %eax,%eax
+  8033ed:	78 2d                	js     80341c <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  8033ef:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  8033f6:	00 00 00 
+  8033f9:	48 8b 10             	mov    (%rax),%rdx
+  8033fc:	48 89 13             	mov    %rdx,(%rbx)
+  8033ff:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  803403:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  803407:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80340b:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  80340f:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803413:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  803417:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80341c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803420:	c9                   	leave
+  803421:	c3                   	ret
+
+0000000000803422 <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  803422:	55                   	push   %rbp
+  803423:	48 89 e5             	mov    %rsp,%rbp
+  803426:	53                   	push   %rbx
+  803427:	48 83 ec 08          	sub    $0x8,%rsp
+  80342b:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  80342e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803433:	be 00 00 00 00       	mov    $0x0,%esi
+  803438:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80343d:	48 b8 59 26 80 00 00 	movabs $0x802659,%rax
+  803444:	00 00 00 
+  803447:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803449:	85 c0                	test   %eax,%eax
+  80344b:	78 3d                	js     80348a <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  80344d:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803454:	00 00 00 
+  803457:	48 8b 10             	mov    (%rax),%rdx
+  80345a:	48 89 13             	mov    %rdx,(%rbx)
+  80345d:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  803461:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  803465:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803469:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  80346d:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  803471:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  803475:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  803479:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  80347d:	48 8b 40 28          	mov    0x28(%rax),%rax
+  803481:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  803485:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80348a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80348e:	c9                   	leave
+  80348f:	c3                   	ret
+
+0000000000803490 <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  803490:	55                   	push   %rbp
+  803491:	48 89 e5             	mov    %rsp,%rbp
+  803494:	41 57                	push   %r15
+  803496:	41 56                	push   %r14
+  803498:	41 55                	push   %r13
+  80349a:	41 54                	push   %r12
+  80349c:	53                   	push   %rbx
+  80349d:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  8034a1:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  8034a8:	00 
+  8034a9:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  8034b0:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8034b6:	0f 85 43 01 00 00    	jne    8035ff <munmap+0x16f>
+  8034bc:	49 89 ff             	mov    %rdi,%r15
+  8034bf:	4c 39 f7             	cmp    %r14,%rdi
+  8034c2:	0f 87 37 01 00 00    	ja     8035ff <munmap+0x16f>
+  8034c8:	48 bb 00 20 82 00 00 	movabs $0x822000,%rbx
+  8034cf:	00 00 00 
+  8034d2:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  8034d8:	eb 2c                	jmp    803506 <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  8034da:	4c 39 f8             	cmp    %r15,%rax
+  8034dd:	0f 83 85 00 00 00    	jae    803568 <munmap+0xd8>
+            m->mm_end = start;
+  8034e3:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8034e8:	48 83 c3 18          	add    $0x18,%rbx
+  8034ec:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  8034f3:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8034fa:	00 00 00 
+  8034fd:	48 39 c3             	cmp    %rax,%rbx
+  803500:	0f 84 d0 00 00 00    	je     8035d6 <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  803506:	49 89 dc             	mov    %rbx,%r12
+  803509:	48 8b 03             	mov    (%rbx),%rax
+  80350c:	4c 39 f0             	cmp    %r14,%rax
+  80350f:	73 d7                	jae    8034e8 <munmap+0x58>
+  803511:	48 85 c0             	test   %rax,%rax
+  803514:	74 d2                	je     8034e8 <munmap+0x58>
+  803516:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  80351a:	49 39 d7             	cmp    %rdx,%r15
+  80351d:	73 c9                	jae    8034e8 <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  80351f:	49 39 d6             	cmp    %rdx,%r14
+  803522:	73 b6                	jae    8034da <munmap+0x4a>
+  803524:	49 39 c7             	cmp    %rax,%r15
+  803527:	76 b1                	jbe    8034da <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  803529:	4c 89 ef             	mov    %r13,%rdi
+  80352c:	48 b8 c7 25 80 00 00 	movabs $0x8025c7,%rax
+  803533:	00 00 00 
+  803536:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  803538:	48 85 c0             	test   %rax,%rax
+  80353b:	0f 84 c5 00 00 00    	je     803606 <munmap+0x176>
+            *tail = *m;
+  803541:	48 8b 13             	mov    (%rbx),%rdx
+  803544:	48 89 10             	mov    %rdx,(%rax)
+  803547:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  80354b:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  80354f:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  803553:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  803557:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  80355a:	44 89 f2             	mov    %r14d,%edx
+  80355d:	2b 13                	sub    (%rbx),%edx
+  80355f:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  803562:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  803566:	eb 80                	jmp    8034e8 <munmap+0x58>
+        } else if (m->mm_end > end) {
+  803568:	49 39 d6             	cmp    %rdx,%r14
+  80356b:	73 18                	jae    803585 <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  80356d:	44 89 f2             	mov    %r14d,%edx
+  803570:	41 03 54 24 10       	add    0x10(%r12),%edx
+  803575:	29 c2                	sub    %eax,%edx
+  803577:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  80357c:	4d 89 34 24          	mov    %r14,(%r12)
+  803580:	e9 63 ff ff ff       	jmp    8034e8 <munmap+0x58>
+    m->mm_start = 0;
+  803585:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  80358c:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  80358d:	4c 89 e6             	mov    %r12,%rsi
+  803590:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  803597:	00 00 00 
+  80359a:	48 29 c6             	sub    %rax,%rsi
+  80359d:	48 c1 fe 03          	sar    $0x3,%rsi
+  8035a1:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8035a8:	aa aa aa 
+  8035ab:	48 0f af f0          	imul   %rax,%rsi
+  8035af:	48 c1 e6 0c          	shl    $0xc,%rsi
+  8035b3:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  8035b8:	48 01 c6             	add    %rax,%rsi
+  8035bb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8035c0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035c5:	48 b8 c7 13 80 00 00 	movabs $0x8013c7,%rax
+  8035cc:	00 00 00 
+  8035cf:	ff d0                	call   *%rax
+}
+  8035d1:	e9 12 ff ff ff       	jmp    8034e8 <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  8035d6:	4c 89 f2             	mov    %r14,%rdx
+  8035d9:	4c 29 fa             	sub    %r15,%rdx
+  8035dc:	4c 89 fe             	mov    %r15,%rsi
+  8035df:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035e4:	48 b8 c7 13 80 00 00 	movabs $0x8013c7,%rax
+  8035eb:	00 00 00 
+  8035ee:	ff d0                	call   *%rax
+}
+  8035f0:	48 83 c4 08          	add    $0x8,%rsp
+  8035f4:	5b                   	pop    %rbx
+  8035f5:	41 5c                	pop    %r12
+  8035f7:	41 5d                	pop    %r13
+  8035f9:	41 5e                	pop    %r14
+  8035fb:	41 5f                	pop    %r15
+  8035fd:	5d                   	pop    %rbp
+  8035fe:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  8035ff:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803604:	eb ea                	jmp    8035f0 <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  803606:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  80360b:	eb e3                	jmp    8035f0 <munmap+0x160>
+
+000000000080360d <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  80360d:	55                   	push   %rbp
+  80360e:	48 89 e5             	mov    %rsp,%rbp
+  803611:	41 57                	push   %r15
+  803613:	41 56                	push   %r14
+  803615:	41 55                	push   %r13
+  803617:	41 54                	push   %r12
+  803619:	53                   	push   %rbx
+  80361a:	48 83 ec 28          	sub    $0x28,%rsp
+  80361e:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  803622:	49 89 f5             	mov    %rsi,%r13
+  803625:	41 89 d6             	mov    %edx,%r14d
+  803628:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  80362b:	41 89 cc             	mov    %ecx,%r12d
+  80362e:	44 89 c7             	mov    %r8d,%edi
+  803631:	44 89 cb             	mov    %r9d,%ebx
+  803634:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803638:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80363c:	48 b8 02 19 80 00 00 	movabs $0x801902,%rax
+  803643:	00 00 00 
+  803646:	ff d0                	call   *%rax
+  803648:	41 89 c7             	mov    %eax,%r15d
+  80364b:	85 c0                	test   %eax,%eax
+  80364d:	0f 88 ae 01 00 00    	js     803801 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803653:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803657:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  80365e:	00 00 00 
+  803661:	8b 32                	mov    (%rdx),%esi
+  803663:	39 30                	cmp    %esi,(%rax)
+  803665:	0f 85 7a 02 00 00    	jne    8038e5 <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  80366b:	8b 40 08             	mov    0x8(%rax),%eax
+  80366e:	83 e0 03             	and    $0x3,%eax
+  803671:	83 f8 01             	cmp    $0x1,%eax
+  803674:	0f 84 76 02 00 00    	je     8038f0 <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  80367a:	4d 85 ed             	test   %r13,%r13
+  80367d:	0f 84 78 02 00 00    	je     8038fb <mmap+0x2ee>
+  803683:	85 db                	test   %ebx,%ebx
+  803685:	0f 88 70 02 00 00    	js     8038fb <mmap+0x2ee>
+  80368b:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  803691:	41 89 df             	mov    %ebx,%r15d
+  803694:	0f 85 6c 02 00 00    	jne    803906 <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  80369a:	44 89 f0             	mov    %r14d,%eax
+  80369d:	83 e0 fd             	and    $0xfffffffd,%eax
+  8036a0:	83 f8 04             	cmp    $0x4,%eax
+  8036a3:	0f 85 68 02 00 00    	jne    803911 <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  8036a9:	44 89 e1             	mov    %r12d,%ecx
+  8036ac:	83 e1 01             	and    $0x1,%ecx
+  8036af:	0f 95 c2             	setne  %dl
+  8036b2:	44 89 e0             	mov    %r12d,%eax
+  8036b5:	d1 e8                	shr    %eax
+  8036b7:	83 f0 01             	xor    $0x1,%eax
+  8036ba:	83 e0 01             	and    $0x1,%eax
+  8036bd:	38 c2                	cmp    %al,%dl
+  8036bf:	0f 85 57 02 00 00    	jne    80391c <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  8036c5:	85 c9                	test   %ecx,%ecx
+  8036c7:	74 0a                	je     8036d3 <mmap+0xc6>
+  8036c9:	41 f6 c6 02          	test   $0x2,%r14b
+  8036cd:	0f 85 54 02 00 00    	jne    803927 <mmap+0x31a>
+    file_flush_buffers();
+  8036d3:	48 b8 88 31 80 00 00 	movabs $0x803188,%rax
+  8036da:	00 00 00 
+  8036dd:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  8036df:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  8036e6:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  8036ed:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8036f1:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  8036f4:	41 f6 c4 04          	test   $0x4,%r12b
+  8036f8:	0f 84 15 01 00 00    	je     803813 <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  8036fe:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  803701:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  803707:	0f 85 25 02 00 00    	jne    803932 <mmap+0x325>
+  80370d:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  803711:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  803718:	00 00 00 
+  80371b:	48 39 c2             	cmp    %rax,%rdx
+  80371e:	0f 82 19 02 00 00    	jb     80393d <mmap+0x330>
+  803724:	48 39 c7             	cmp    %rax,%rdi
+  803727:	0f 87 10 02 00 00    	ja     80393d <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  80372d:	4c 89 ee             	mov    %r13,%rsi
+  803730:	48 b8 90 34 80 00 00 	movabs $0x803490,%rax
+  803737:	00 00 00 
+  80373a:	ff d0                	call   *%rax
+  80373c:	85 c0                	test   %eax,%eax
+  80373e:	0f 88 04 02 00 00    	js     803948 <mmap+0x33b>
+    if (!handler) {
+  803744:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  80374b:	00 00 00 
+  80374e:	80 38 00             	cmpb   $0x0,(%rax)
+  803751:	75 2b                	jne    80377e <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  803753:	48 bf 28 25 80 00 00 	movabs $0x802528,%rdi
+  80375a:	00 00 00 
+  80375d:	48 b8 31 52 80 00 00 	movabs $0x805231,%rax
+  803764:	00 00 00 
+  803767:	ff d0                	call   *%rax
+  803769:	85 c0                	test   %eax,%eax
+  80376b:	0f 88 ea 01 00 00    	js     80395b <mmap+0x34e>
+        handler = 1;
+  803771:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  803778:	00 00 00 
+  80377b:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  80377e:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803782:	48 b8 c7 25 80 00 00 	movabs $0x8025c7,%rax
+  803789:	00 00 00 
+  80378c:	ff d0                	call   *%rax
+  80378e:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  803791:	48 85 c0             	test   %rax,%rax
+  803794:	0f 84 c9 01 00 00    	je     803963 <mmap+0x356>
+    m->mm_start = va;
+  80379a:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  80379d:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  8037a1:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  8037a5:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  8037a8:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  8037ac:	44 89 e0             	mov    %r12d,%eax
+  8037af:	c1 e0 06             	shl    $0x6,%eax
+  8037b2:	25 80 00 00 00       	and    $0x80,%eax
+  8037b7:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  8037ba:	09 f0                	or     %esi,%eax
+  8037bc:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  8037c0:	41 f6 c4 08          	test   $0x8,%r12b
+  8037c4:	74 31                	je     8037f7 <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  8037c6:	48 39 d3             	cmp    %rdx,%rbx
+  8037c9:	73 2c                	jae    8037f7 <mmap+0x1ea>
+  8037cb:	ba 00 00 04 00       	mov    $0x40000,%edx
+  8037d0:	48 89 de             	mov    %rbx,%rsi
+  8037d3:	4c 89 f7             	mov    %r14,%rdi
+  8037d6:	48 b8 17 24 80 00 00 	movabs $0x802417,%rax
+  8037dd:	00 00 00 
+  8037e0:	ff d0                	call   *%rax
+  8037e2:	49 89 c4             	mov    %rax,%r12
+  8037e5:	48 85 c0             	test   %rax,%rax
+  8037e8:	0f 8e d7 00 00 00    	jle    8038c5 <mmap+0x2b8>
+            va += n;
+  8037ee:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  8037f1:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  8037f5:	72 d4                	jb     8037cb <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  8037f7:	49 8b 06             	mov    (%r14),%rax
+  8037fa:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  8037fe:	48 89 06             	mov    %rax,(%rsi)
+}
+  803801:	44 89 f8             	mov    %r15d,%eax
+  803804:	48 83 c4 28          	add    $0x28,%rsp
+  803808:	5b                   	pop    %rbx
+  803809:	41 5c                	pop    %r12
+  80380b:	41 5d                	pop    %r13
+  80380d:	41 5e                	pop    %r14
+  80380f:	41 5f                	pop    %r15
+  803811:	5d                   	pop    %rbp
+  803812:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803813:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  80381a:	00 00 00 
+  80381d:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  803820:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  803827:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80382a:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  80382f:	48 be 00 20 82 00 00 	movabs $0x822000,%rsi
+  803836:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803839:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  803840:	00 00 00 
+  803843:	48 39 d7             	cmp    %rdx,%rdi
+  803846:	73 1c                	jae    803864 <mmap+0x257>
+        return -E_NO_MEM;
+  803848:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80384e:	eb b1                	jmp    803801 <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803850:	48 83 c0 01          	add    $0x1,%rax
+  803854:	48 83 f8 1f          	cmp    $0x1f,%rax
+  803858:	77 3f                	ja     803899 <mmap+0x28c>
+  80385a:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  80385f:	48 39 d7             	cmp    %rdx,%rdi
+  803862:	72 2a                	jb     80388e <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  803864:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  803868:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  80386c:	48 39 d1             	cmp    %rdx,%rcx
+  80386f:	73 df                	jae    803850 <mmap+0x243>
+  803871:	48 85 c9             	test   %rcx,%rcx
+  803874:	74 da                	je     803850 <mmap+0x243>
+  803876:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  80387a:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  80387f:	48 39 d3             	cmp    %rdx,%rbx
+  803882:	73 cc                	jae    803850 <mmap+0x243>
+            va = mmaps[i].mm_end;
+  803884:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803887:	b8 00 00 00 00       	mov    $0x0,%eax
+  80388c:	eb cc                	jmp    80385a <mmap+0x24d>
+        return -E_NO_MEM;
+  80388e:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803894:	e9 68 ff ff ff       	jmp    803801 <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  803899:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  80389e:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  8038a5:	00 00 00 
+  8038a8:	48 39 c2             	cmp    %rax,%rdx
+  8038ab:	0f 82 9f 00 00 00    	jb     803950 <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  8038b1:	48 85 db             	test   %rbx,%rbx
+  8038b4:	0f 85 8a fe ff ff    	jne    803744 <mmap+0x137>
+        return -E_NO_MEM;
+  8038ba:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8038c0:	e9 3c ff ff ff       	jmp    803801 <mmap+0x1f4>
+        if (n < 0) {
+  8038c5:	0f 89 2c ff ff ff    	jns    8037f7 <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  8038cb:	49 8b 3e             	mov    (%r14),%rdi
+  8038ce:	4c 89 ee             	mov    %r13,%rsi
+  8038d1:	48 b8 90 34 80 00 00 	movabs $0x803490,%rax
+  8038d8:	00 00 00 
+  8038db:	ff d0                	call   *%rax
+            return n;
+  8038dd:	45 89 e7             	mov    %r12d,%r15d
+  8038e0:	e9 1c ff ff ff       	jmp    803801 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8038e5:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8038eb:	e9 11 ff ff ff       	jmp    803801 <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  8038f0:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8038f6:	e9 06 ff ff ff       	jmp    803801 <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  8038fb:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803901:	e9 fb fe ff ff       	jmp    803801 <mmap+0x1f4>
+  803906:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80390c:	e9 f0 fe ff ff       	jmp    803801 <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  803911:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803917:	e9 e5 fe ff ff       	jmp    803801 <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  80391c:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803922:	e9 da fe ff ff       	jmp    803801 <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  803927:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  80392d:	e9 cf fe ff ff       	jmp    803801 <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  803932:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803938:	e9 c4 fe ff ff       	jmp    803801 <mmap+0x1f4>
+  80393d:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803943:	e9 b9 fe ff ff       	jmp    803801 <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  803948:	41 89 c7             	mov    %eax,%r15d
+  80394b:	e9 b1 fe ff ff       	jmp    803801 <mmap+0x1f4>
+        return -E_NO_MEM;
+  803950:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803956:	e9 a6 fe ff ff       	jmp    803801 <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  80395b:	41 89 c7             	mov    %eax,%r15d
+  80395e:	e9 9e fe ff ff       	jmp    803801 <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  803963:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803969:	e9 93 fe ff ff       	jmp    803801 <mmap+0x1f4>
+
+000000000080396e <copy_shared_region>:
+    scring_unmap_region(0, UTEMP, USER_STACK_SIZE);
+    return 0;
+}
+
+static int
+copy_shared_region(void *start, void *end, void *arg) {
+  80396e:	55                   	push   %rbp
+  80396f:	48 89 e5             	mov    %rsp,%rbp
+  803972:	41 55                	push   %r13
+  803974:	41 54                	push   %r12
+  803976:	53                   	push   %rbx
+  803977:	48 83 ec 08          	sub    $0x8,%rsp
+  80397b:	48 89 fb             	mov    %rdi,%rbx
+  80397e:	49 89 f4             	mov    %rsi,%r12
+    envid_t child = *(envid_t *)arg;
+  803981:	44 8b 2a             	mov    (%rdx),%r13d
+    scring_map_region(0, start, child, start, end - start, get_prot(start));
+  803984:	48 b8 ea 49 80 00 00 	movabs $0x8049ea,%rax
+  80398b:	00 00 00 
+  80398e:	ff d0                	call   *%rax
+  803990:	41 89 c1             	mov    %eax,%r9d
+  803993:	4d 89 e0             	mov    %r12,%r8
+  803996:	49 29 d8             	sub    %rbx,%r8
+  803999:	48 89 d9             	mov    %rbx,%rcx
+  80399c:	44 89 ea             	mov    %r13d,%edx
+  80399f:	48 89 de             	mov    %rbx,%rsi
+  8039a2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039a7:	48 b8 5f 4d 80 00 00 	movabs $0x804d5f,%rax
+  8039ae:	00 00 00 
+  8039b1:	ff d0                	call   *%rax
+    return 0;
+}
+  8039b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039b8:	48 83 c4 08          	add    $0x8,%rsp
+  8039bc:	5b                   	pop    %rbx
+  8039bd:	41 5c                	pop    %r12
+  8039bf:	41 5d                	pop    %r13
+  8039c1:	5d                   	pop    %rbp
+  8039c2:	c3                   	ret
+
+00000000008039c3 <spawn>:
+spawn(const char *prog, const char **argv) {
+  8039c3:	55                   	push   %rbp
+  8039c4:	48 89 e5             	mov    %rsp,%rbp
+  8039c7:	41 57                	push   %r15
+  8039c9:	41 56                	push   %r14
+  8039cb:	41 55                	push   %r13
+  8039cd:	41 54                	push   %r12
+  8039cf:	53                   	push   %rbx
+  8039d0:	48 81 ec 08 03 00 00 	sub    $0x308,%rsp
+  8039d7:	48 89 fb             	mov    %rdi,%rbx
+  8039da:	49 89 f4             	mov    %rsi,%r12
+    file_flush_buffers();
+  8039dd:	48 b8 88 31 80 00 00 	movabs $0x803188,%rax
+  8039e4:	00 00 00 
+  8039e7:	ff d0                	call   *%rax
+    int fd = open(prog, O_RDONLY);
+  8039e9:	be 00 00 00 00       	mov    $0x0,%esi
+  8039ee:	48 89 df             	mov    %rbx,%rdi
+  8039f1:	48 b8 c7 30 80 00 00 	movabs $0x8030c7,%rax
+  8039f8:	00 00 00 
+  8039fb:	ff d0                	call   *%rax
+  8039fd:	89 85 e4 fc ff ff    	mov    %eax,-0x31c(%rbp)
+    if (fd < 0) return fd;
+  803a03:	85 c0                	test   %eax,%eax
+  803a05:	0f 88 06 04 00 00    	js     803e11 <spawn+0x44e>
+  803a0b:	89 c7                	mov    %eax,%edi
+    res = readn(fd, elf_buf, sizeof(elf_buf));
+  803a0d:	ba 00 02 00 00       	mov    $0x200,%edx
+  803a12:	48 8d b5 d0 fd ff ff 	lea    -0x230(%rbp),%rsi
+  803a19:	48 b8 a3 1c 80 00 00 	movabs $0x801ca3,%rax
+  803a20:	00 00 00 
+  803a23:	ff d0                	call   *%rax
+  803a25:	89 c6                	mov    %eax,%esi
+    if (res != sizeof(elf_buf)) {
+  803a27:	3d 00 02 00 00       	cmp    $0x200,%eax
+  803a2c:	0f 85 93 02 00 00    	jne    803cc5 <spawn+0x302>
+        elf->e_elf[1] != 1 /* little endian */ ||
+  803a32:	48 b8 ff ff ff ff ff 	movabs $0xffffffffffffff,%rax
+  803a39:	ff ff 00 
+  803a3c:	48 23 85 d0 fd ff ff 	and    -0x230(%rbp),%rax
+    if (elf->e_magic != ELF_MAGIC ||
+  803a43:	48 ba 7f 45 4c 46 02 	movabs $0x10102464c457f,%rdx
+  803a4a:	01 01 00 
+  803a4d:	48 39 d0             	cmp    %rdx,%rax
+  803a50:	0f 85 ab 02 00 00    	jne    803d01 <spawn+0x33e>
+        elf->e_type != ET_EXEC /* executable */ ||
+  803a56:	81 bd e0 fd ff ff 02 	cmpl   $0x3e0002,-0x220(%rbp)
+  803a5d:	00 3e 00 
+  803a60:	0f 85 9b 02 00 00    	jne    803d01 <spawn+0x33e>
+  803a66:	b8 08 00 00 00       	mov    $0x8,%eax
+  803a6b:	0f 05                	syscall
+  803a6d:	41 89 c6             	mov    %eax,%r14d
+  803a70:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+    if ((int)(res = sys_exofork()) < 0) goto error2;
+  803a76:	85 c0                	test   %eax,%eax
+  803a78:	0f 88 75 03 00 00    	js     803df3 <spawn+0x430>
+    envid_t child = res;
+  803a7e:	89 85 cc fd ff ff    	mov    %eax,-0x234(%rbp)
+    struct Trapframe child_tf = envs[ENVX(child)].env_tf;
+  803a84:	89 c2                	mov    %eax,%edx
+  803a86:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  803a8c:	48 89 d0             	mov    %rdx,%rax
+  803a8f:	48 c1 e0 04          	shl    $0x4,%rax
+  803a93:	48 29 d0             	sub    %rdx,%rax
+  803a96:	48 c1 e0 05          	shl    $0x5,%rax
+  803a9a:	48 be 00 00 c0 1f 80 	movabs $0x801fc00000,%rsi
+  803aa1:	00 00 00 
+  803aa4:	48 01 c6             	add    %rax,%rsi
+  803aa7:	48 8b 06             	mov    (%rsi),%rax
+  803aaa:	48 89 85 0c fd ff ff 	mov    %rax,-0x2f4(%rbp)
+  803ab1:	48 8b 86 b8 00 00 00 	mov    0xb8(%rsi),%rax
+  803ab8:	48 89 85 c4 fd ff ff 	mov    %rax,-0x23c(%rbp)
+  803abf:	48 8d bd 10 fd ff ff 	lea    -0x2f0(%rbp),%rdi
+  803ac6:	48 c7 c1 fc ff ff ff 	mov    $0xfffffffffffffffc,%rcx
+  803acd:	48 29 ce             	sub    %rcx,%rsi
+  803ad0:	81 c1 c0 00 00 00    	add    $0xc0,%ecx
+  803ad6:	c1 e9 03             	shr    $0x3,%ecx
+  803ad9:	89 c9                	mov    %ecx,%ecx
+  803adb:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    child_tf.tf_rip = elf->e_entry;
+  803ade:	48 8b 85 e8 fd ff ff 	mov    -0x218(%rbp),%rax
+  803ae5:	48 89 85 a4 fd ff ff 	mov    %rax,-0x25c(%rbp)
+    for (argc = 0; argv[argc] != 0; argc++)
+  803aec:	49 8b 3c 24          	mov    (%r12),%rdi
+  803af0:	48 85 ff             	test   %rdi,%rdi
+  803af3:	0f 84 d6 05 00 00    	je     8040cf <spawn+0x70c>
+  803af9:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    string_size = 0;
+  803aff:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        string_size += strlen(argv[argc]) + 1;
+  803b05:	48 bb 84 0d 80 00 00 	movabs $0x800d84,%rbx
+  803b0c:	00 00 00 
+  803b0f:	ff d3                	call   *%rbx
+  803b11:	4c 01 f8             	add    %r15,%rax
+  803b14:	4c 8d 78 01          	lea    0x1(%rax),%r15
+    for (argc = 0; argv[argc] != 0; argc++)
+  803b18:	4c 89 ea             	mov    %r13,%rdx
+  803b1b:	49 83 c5 01          	add    $0x1,%r13
+  803b1f:	4b 8b 7c ec f8       	mov    -0x8(%r12,%r13,8),%rdi
+  803b24:	48 85 ff             	test   %rdi,%rdi
+  803b27:	75 e6                	jne    803b0f <spawn+0x14c>
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  803b29:	49 89 d5             	mov    %rdx,%r13
+  803b2c:	48 89 95 f8 fc ff ff 	mov    %rdx,-0x308(%rbp)
+  803b33:	48 f7 d0             	not    %rax
+  803b36:	48 8d 98 00 00 41 00 	lea    0x410000(%rax),%rbx
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  803b3d:	49 89 df             	mov    %rbx,%r15
+  803b40:	49 83 e7 f8          	and    $0xfffffffffffffff8,%r15
+  803b44:	4c 89 bd e8 fc ff ff 	mov    %r15,-0x318(%rbp)
+  803b4b:	89 d0                	mov    %edx,%eax
+  803b4d:	83 c0 01             	add    $0x1,%eax
+  803b50:	48 98                	cltq
+  803b52:	48 c1 e0 03          	shl    $0x3,%rax
+  803b56:	49 29 c7             	sub    %rax,%r15
+  803b59:	4c 89 bd f0 fc ff ff 	mov    %r15,-0x310(%rbp)
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  803b60:	49 8d 47 f0          	lea    -0x10(%r15),%rax
+  803b64:	48 3d ff ff 3f 00    	cmp    $0x3fffff,%rax
+  803b6a:	0f 86 4f 05 00 00    	jbe    8040bf <spawn+0x6fc>
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  803b70:	b9 06 00 00 00       	mov    $0x6,%ecx
+  803b75:	ba 00 00 01 00       	mov    $0x10000,%edx
+  803b7a:	be 00 00 40 00       	mov    $0x400000,%esi
+  803b7f:	48 b8 21 13 80 00 00 	movabs $0x801321,%rax
+  803b86:	00 00 00 
+  803b89:	ff d0                	call   *%rax
+  803b8b:	85 c0                	test   %eax,%eax
+  803b8d:	0f 88 31 05 00 00    	js     8040c4 <spawn+0x701>
+    for (i = 0; i < argc; i++) {
+  803b93:	4c 89 e8             	mov    %r13,%rax
+  803b96:	45 85 ed             	test   %r13d,%r13d
+  803b99:	7e 65                	jle    803c00 <spawn+0x23d>
+  803b9b:	4d 89 fd             	mov    %r15,%r13
+  803b9e:	48 98                	cltq
+  803ba0:	49 8d 04 c7          	lea    (%r15,%rax,8),%rax
+        argv_store[i] = UTEMP2USTACK(string_store);
+  803ba4:	49 bf 00 70 fe ff 7f 	movabs $0x7ffffe7000,%r15
+  803bab:	00 00 00 
+        string_store += strlen(argv[i]) + 1;
+  803bae:	44 89 b5 e0 fc ff ff 	mov    %r14d,-0x320(%rbp)
+  803bb5:	49 89 c6             	mov    %rax,%r14
+        argv_store[i] = UTEMP2USTACK(string_store);
+  803bb8:	4a 8d 84 3b 00 00 c0 	lea    -0x400000(%rbx,%r15,1),%rax
+  803bbf:	ff 
+  803bc0:	49 89 45 00          	mov    %rax,0x0(%r13)
+        strcpy(string_store, argv[i]);
+  803bc4:	49 8b 34 24          	mov    (%r12),%rsi
+  803bc8:	48 89 df             	mov    %rbx,%rdi
+  803bcb:	48 b8 c2 0d 80 00 00 	movabs $0x800dc2,%rax
+  803bd2:	00 00 00 
+  803bd5:	ff d0                	call   *%rax
+        string_store += strlen(argv[i]) + 1;
+  803bd7:	49 8b 3c 24          	mov    (%r12),%rdi
+  803bdb:	48 b8 84 0d 80 00 00 	movabs $0x800d84,%rax
+  803be2:	00 00 00 
+  803be5:	ff d0                	call   *%rax
+  803be7:	48 8d 5c 03 01       	lea    0x1(%rbx,%rax,1),%rbx
+    for (i = 0; i < argc; i++) {
+  803bec:	49 83 c5 08          	add    $0x8,%r13
+  803bf0:	49 83 c4 08          	add    $0x8,%r12
+  803bf4:	4d 39 ee             	cmp    %r13,%r14
+  803bf7:	75 bf                	jne    803bb8 <spawn+0x1f5>
+  803bf9:	44 8b b5 e0 fc ff ff 	mov    -0x320(%rbp),%r14d
+    argv_store[argc] = 0;
+  803c00:	48 8b 85 e8 fc ff ff 	mov    -0x318(%rbp),%rax
+  803c07:	48 c7 40 f8 00 00 00 	movq   $0x0,-0x8(%rax)
+  803c0e:	00 
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  803c0f:	48 81 fb 00 00 41 00 	cmp    $0x410000,%rbx
+  803c16:	0f 85 2c 01 00 00    	jne    803d48 <spawn+0x385>
+    argv_store[-1] = UTEMP2USTACK(argv_store);
+  803c1c:	48 b9 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rcx
+  803c23:	00 00 00 
+  803c26:	48 8b 9d f0 fc ff ff 	mov    -0x310(%rbp),%rbx
+  803c2d:	48 8d 84 0b 00 00 c0 	lea    -0x400000(%rbx,%rcx,1),%rax
+  803c34:	ff 
+  803c35:	48 89 43 f8          	mov    %rax,-0x8(%rbx)
+    argv_store[-2] = argc;
+  803c39:	48 8b 85 f8 fc ff ff 	mov    -0x308(%rbp),%rax
+  803c40:	48 89 43 f0          	mov    %rax,-0x10(%rbx)
+    tf->tf_rsp = UTEMP2USTACK(&argv_store[-2]);
+  803c44:	48 b8 f0 6f fe ff 7f 	movabs $0x7ffffe6ff0,%rax
+  803c4b:	00 00 00 
+  803c4e:	48 8d 84 03 00 00 c0 	lea    -0x400000(%rbx,%rax,1),%rax
+  803c55:	ff 
+  803c56:	48 89 85 bc fd ff ff 	mov    %rax,-0x244(%rbp)
+    scring_map_region(0, UTEMP, child, (void *)(USER_STACK_TOP - USER_STACK_SIZE),
+  803c5d:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  803c63:	41 b8 00 00 01 00    	mov    $0x10000,%r8d
+  803c69:	44 89 f2             	mov    %r14d,%edx
+  803c6c:	be 00 00 40 00       	mov    $0x400000,%esi
+  803c71:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c76:	48 b8 5f 4d 80 00 00 	movabs $0x804d5f,%rax
+  803c7d:	00 00 00 
+  803c80:	ff d0                	call   *%rax
+    scring_unmap_region(0, UTEMP, USER_STACK_SIZE);
+  803c82:	ba 00 00 01 00       	mov    $0x10000,%edx
+  803c87:	be 00 00 40 00       	mov    $0x400000,%esi
+  803c8c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c91:	48 b8 98 4d 80 00 00 	movabs $0x804d98,%rax
+  803c98:	00 00 00 
+  803c9b:	ff d0                	call   *%rax
+    struct Proghdr *ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+  803c9d:	48 8b 85 f0 fd ff ff 	mov    -0x210(%rbp),%rax
+  803ca4:	4c 8d ac 05 d0 fd ff 	lea    -0x230(%rbp,%rax,1),%r13
+  803cab:	ff 
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  803cac:	66 83 bd 08 fe ff ff 	cmpw   $0x0,-0x1f8(%rbp)
+  803cb3:	00 
+  803cb4:	0f 84 5d 03 00 00    	je     804017 <spawn+0x654>
+  803cba:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  803cc0:	e9 1b 02 00 00       	jmp    803ee0 <spawn+0x51d>
+        cprintf("Wrong ELF header size or read error: %i\n", res);
+  803cc5:	48 bf 80 5d 80 00 00 	movabs $0x805d80,%rdi
+  803ccc:	00 00 00 
+  803ccf:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cd4:	48 ba 9d 04 80 00 00 	movabs $0x80049d,%rdx
+  803cdb:	00 00 00 
+  803cde:	ff d2                	call   *%rdx
+        close(fd);
+  803ce0:	8b bd e4 fc ff ff    	mov    -0x31c(%rbp),%edi
+  803ce6:	48 b8 67 1a 80 00 00 	movabs $0x801a67,%rax
+  803ced:	00 00 00 
+  803cf0:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  803cf2:	c7 85 e4 fc ff ff ee 	movl   $0xffffffee,-0x31c(%rbp)
+  803cf9:	ff ff ff 
+  803cfc:	e9 10 01 00 00       	jmp    803e11 <spawn+0x44e>
+        cprintf("Elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  803d01:	ba 7f 45 4c 46       	mov    $0x464c457f,%edx
+  803d06:	8b b5 d0 fd ff ff    	mov    -0x230(%rbp),%esi
+  803d0c:	48 bf 37 5e 80 00 00 	movabs $0x805e37,%rdi
+  803d13:	00 00 00 
+  803d16:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d1b:	48 b9 9d 04 80 00 00 	movabs $0x80049d,%rcx
+  803d22:	00 00 00 
+  803d25:	ff d1                	call   *%rcx
+        close(fd);
+  803d27:	8b bd e4 fc ff ff    	mov    -0x31c(%rbp),%edi
+  803d2d:	48 b8 67 1a 80 00 00 	movabs $0x801a67,%rax
+  803d34:	00 00 00 
+  803d37:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  803d39:	c7 85 e4 fc ff ff ee 	movl   $0xffffffee,-0x31c(%rbp)
+  803d40:	ff ff ff 
+  803d43:	e9 c9 00 00 00       	jmp    803e11 <spawn+0x44e>
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  803d48:	48 b9 b0 5d 80 00 00 	movabs $0x805db0,%rcx
+  803d4f:	00 00 00 
+  803d52:	48 ba 51 5e 80 00 00 	movabs $0x805e51,%rdx
+  803d59:	00 00 00 
+  803d5c:	be f9 00 00 00       	mov    $0xf9,%esi
+  803d61:	48 bf 66 5e 80 00 00 	movabs $0x805e66,%rdi
+  803d68:	00 00 00 
+  803d6b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d70:	49 b8 4d 03 80 00 00 	movabs $0x80034d,%r8
+  803d77:	00 00 00 
+  803d7a:	41 ff d0             	call   *%r8
+    /* Map them to child */
+    /* Unmap them from parent */
+    size_t datasz = filesz;
+    filesz = ROUNDUP(va + filesz, PAGE_SIZE) - va;
+    if (memsz > filesz)
+        scring_alloc_region(child, (void *)va + filesz, memsz - filesz, perm);
+  803d7d:	49 8d 14 06          	lea    (%r14,%rax,1),%rdx
+  803d81:	48 29 f2             	sub    %rsi,%rdx
+  803d84:	89 d9                	mov    %ebx,%ecx
+  803d86:	8b bd dc fc ff ff    	mov    -0x324(%rbp),%edi
+  803d8c:	48 b8 29 4d 80 00 00 	movabs $0x804d29,%rax
+  803d93:	00 00 00 
+  803d96:	ff d0                	call   *%rax
+  803d98:	e9 f0 01 00 00       	jmp    803f8d <spawn+0x5ca>
+
+    /* Everything queued so far (including the unmap of
+     * the previous segment) has to be executed first */
+    res = scring_submit();
+    if (res < 0) {
+        cprintf("map_segment.sys_alloc_region failed: %i\n", res);
+  803d9d:	89 c6                	mov    %eax,%esi
+  803d9f:	48 bf e0 5d 80 00 00 	movabs $0x805de0,%rdi
+  803da6:	00 00 00 
+  803da9:	b8 00 00 00 00       	mov    $0x0,%eax
+  803dae:	48 ba 9d 04 80 00 00 	movabs $0x80049d,%rdx
+  803db5:	00 00 00 
+  803db8:	ff d2                	call   *%rdx
+    scring_discard();
+  803dba:	48 b8 09 4d 80 00 00 	movabs $0x804d09,%rax
+  803dc1:	00 00 00 
+  803dc4:	ff d0                	call   *%rax
+    sys_unmap_region(0, UTEMP, USER_STACK_SIZE);
+  803dc6:	ba 00 00 01 00       	mov    $0x10000,%edx
+  803dcb:	be 00 00 40 00       	mov    $0x400000,%esi
+  803dd0:	bf 00 00 00 00       	mov    $0x0,%edi
+  803dd5:	48 b8 c7 13 80 00 00 	movabs $0x8013c7,%rax
+  803ddc:	00 00 00 
+  803ddf:	ff d0                	call   *%rax
+    sys_env_destroy(child);
+  803de1:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  803de7:	48 b8 31 12 80 00 00 	movabs $0x801231,%rax
+  803dee:	00 00 00 
+  803df1:	ff d0                	call   *%rax
+    close(fd);
+  803df3:	8b bd e4 fc ff ff    	mov    -0x31c(%rbp),%edi
+  803df9:	48 b8 67 1a 80 00 00 	movabs $0x801a67,%rax
+  803e00:	00 00 00 
+  803e03:	ff d0                	call   *%rax
+    return res;
+  803e05:	8b 85 f0 fc ff ff    	mov    -0x310(%rbp),%eax
+  803e0b:	89 85 e4 fc ff ff    	mov    %eax,-0x31c(%rbp)
+}
+  803e11:	8b 85 e4 fc ff ff    	mov    -0x31c(%rbp),%eax
+  803e17:	48 81 c4 08 03 00 00 	add    $0x308,%rsp
+  803e1e:	5b                   	pop    %rbx
+  803e1f:	41 5c                	pop    %r12
+  803e21:	41 5d                	pop    %r13
+  803e23:	41 5e                	pop    %r14
+  803e25:	41 5f                	pop    %r15
+  803e27:	5d                   	pop    %rbp
+  803e28:	c3                   	ret
+    /* Text pages stay shared with the block cache
+     * and with other instances of the program */
+    void *addr = UTEMP;
+    res = mmap(&addr, filesz, PROT_RW, MAP_PRIVATE | MAP_FIXED | MAP_POPULATE, fd, fileoffset);
+    if (res < 0) {
+        cprintf("map_segment.mmap failed: %i\n", res);
+  803e29:	89 c6                	mov    %eax,%esi
+  803e2b:	48 bf 72 5e 80 00 00 	movabs $0x805e72,%rdi
+  803e32:	00 00 00 
+  803e35:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e3a:	48 ba 9d 04 80 00 00 	movabs $0x80049d,%rdx
+  803e41:	00 00 00 
+  803e44:	ff d2                	call   *%rdx
+        return res;
+  803e46:	e9 6f ff ff ff       	jmp    803dba <spawn+0x3f7>
+    }
+
+    /* The rest of the last page belongs to bss */
+    if (memsz > datasz && filesz > datasz)
+        memset(UTEMP + datasz, 0, filesz - datasz);
+  803e4b:	4c 89 e2             	mov    %r12,%rdx
+  803e4e:	48 8b 85 e8 fc ff ff 	mov    -0x318(%rbp),%rax
+  803e55:	48 29 c2             	sub    %rax,%rdx
+  803e58:	48 8d b8 00 00 40 00 	lea    0x400000(%rax),%rdi
+  803e5f:	be 00 00 00 00       	mov    $0x0,%esi
+  803e64:	48 b8 0e 0f 80 00 00 	movabs $0x800f0e,%rax
+  803e6b:	00 00 00 
+  803e6e:	ff d0                	call   *%rax
+
+    scring_map_region(CURENVID, UTEMP, child, (void *)va, filesz, perm | PROT_LAZY);
+  803e70:	80 cb 80             	or     $0x80,%bl
+  803e73:	41 89 d9             	mov    %ebx,%r9d
+  803e76:	4d 89 e0             	mov    %r12,%r8
+  803e79:	4c 89 f1             	mov    %r14,%rcx
+  803e7c:	8b 95 dc fc ff ff    	mov    -0x324(%rbp),%edx
+  803e82:	be 00 00 40 00       	mov    $0x400000,%esi
+  803e87:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e8c:	48 b8 5f 4d 80 00 00 	movabs $0x804d5f,%rax
+  803e93:	00 00 00 
+  803e96:	ff d0                	call   *%rax
+    res = scring_submit();
+  803e98:	48 b8 bd 4c 80 00 00 	movabs $0x804cbd,%rax
+  803e9f:	00 00 00 
+  803ea2:	ff d0                	call   *%rax
+  803ea4:	89 c3                	mov    %eax,%ebx
+  803ea6:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+    munmap(UTEMP, filesz);
+  803eac:	4c 89 e6             	mov    %r12,%rsi
+  803eaf:	bf 00 00 40 00       	mov    $0x400000,%edi
+  803eb4:	48 b8 90 34 80 00 00 	movabs $0x803490,%rax
+  803ebb:	00 00 00 
+  803ebe:	ff d0                	call   *%rax
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  803ec0:	85 db                	test   %ebx,%ebx
+  803ec2:	0f 88 f2 fe ff ff    	js     803dba <spawn+0x3f7>
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  803ec8:	49 83 c7 01          	add    $0x1,%r15
+  803ecc:	49 83 c5 38          	add    $0x38,%r13
+  803ed0:	0f b7 85 08 fe ff ff 	movzwl -0x1f8(%rbp),%eax
+  803ed7:	49 39 c7             	cmp    %rax,%r15
+  803eda:	0f 83 37 01 00 00    	jae    804017 <spawn+0x654>
+        if (ph->p_type != ELF_PROG_LOAD) continue;
+  803ee0:	41 83 7d 00 01       	cmpl   $0x1,0x0(%r13)
+  803ee5:	75 e1                	jne    803ec8 <spawn+0x505>
+        if (ph->p_flags & ELF_PROG_FLAG_WRITE) perm |= PROT_W;
+  803ee7:	41 8b 45 04          	mov    0x4(%r13),%eax
+  803eeb:	89 c3                	mov    %eax,%ebx
+  803eed:	83 e3 02             	and    $0x2,%ebx
+        if (ph->p_flags & ELF_PROG_FLAG_READ) perm |= PROT_R;
+  803ef0:	89 da                	mov    %ebx,%edx
+  803ef2:	83 ca 04             	or     $0x4,%edx
+  803ef5:	a8 04                	test   $0x4,%al
+  803ef7:	0f 45 da             	cmovne %edx,%ebx
+        if (ph->p_flags & ELF_PROG_FLAG_EXEC) perm |= PROT_X;
+  803efa:	89 da                	mov    %ebx,%edx
+  803efc:	83 ca 01             	or     $0x1,%edx
+  803eff:	a8 01                	test   $0x1,%al
+  803f01:	0f 45 da             	cmovne %edx,%ebx
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  803f04:	49 8b 45 08          	mov    0x8(%r13),%rax
+  803f08:	89 85 e0 fc ff ff    	mov    %eax,-0x320(%rbp)
+  803f0e:	49 8b 75 20          	mov    0x20(%r13),%rsi
+  803f12:	48 89 b5 e8 fc ff ff 	mov    %rsi,-0x318(%rbp)
+  803f19:	49 8b 7d 28          	mov    0x28(%r13),%rdi
+  803f1d:	48 89 bd f8 fc ff ff 	mov    %rdi,-0x308(%rbp)
+  803f24:	4d 8b 75 10          	mov    0x10(%r13),%r14
+  803f28:	8b 8d cc fd ff ff    	mov    -0x234(%rbp),%ecx
+  803f2e:	89 8d dc fc ff ff    	mov    %ecx,-0x324(%rbp)
+    if (res) {
+  803f34:	44 89 f2             	mov    %r14d,%edx
+  803f37:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803f3d:	74 22                	je     803f61 <spawn+0x59e>
+        va -= res;
+  803f3f:	48 63 ca             	movslq %edx,%rcx
+  803f42:	49 29 ce             	sub    %rcx,%r14
+        memsz += res;
+  803f45:	48 01 cf             	add    %rcx,%rdi
+  803f48:	48 89 bd f8 fc ff ff 	mov    %rdi,-0x308(%rbp)
+        filesz += res;
+  803f4f:	48 01 ce             	add    %rcx,%rsi
+  803f52:	48 89 b5 e8 fc ff ff 	mov    %rsi,-0x318(%rbp)
+        fileoffset -= res;
+  803f59:	29 d0                	sub    %edx,%eax
+  803f5b:	89 85 e0 fc ff ff    	mov    %eax,-0x320(%rbp)
+    filesz = ROUNDUP(va + filesz, PAGE_SIZE) - va;
+  803f61:	48 8b 85 e8 fc ff ff 	mov    -0x318(%rbp),%rax
+  803f68:	4a 8d b4 30 ff 0f 00 	lea    0xfff(%rax,%r14,1),%rsi
+  803f6f:	00 
+  803f70:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  803f77:	49 89 f4             	mov    %rsi,%r12
+  803f7a:	4d 29 f4             	sub    %r14,%r12
+    if (memsz > filesz)
+  803f7d:	48 8b 85 f8 fc ff ff 	mov    -0x308(%rbp),%rax
+  803f84:	49 39 c4             	cmp    %rax,%r12
+  803f87:	0f 82 f0 fd ff ff    	jb     803d7d <spawn+0x3ba>
+    res = scring_submit();
+  803f8d:	48 b8 bd 4c 80 00 00 	movabs $0x804cbd,%rax
+  803f94:	00 00 00 
+  803f97:	ff d0                	call   *%rax
+  803f99:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+    if (res < 0) {
+  803f9f:	85 c0                	test   %eax,%eax
+  803fa1:	0f 88 f6 fd ff ff    	js     803d9d <spawn+0x3da>
+    if (!filesz) return 0;
+  803fa7:	4d 85 e4             	test   %r12,%r12
+  803faa:	0f 84 18 ff ff ff    	je     803ec8 <spawn+0x505>
+    void *addr = UTEMP;
+  803fb0:	48 c7 85 00 fd ff ff 	movq   $0x400000,-0x300(%rbp)
+  803fb7:	00 00 40 00 
+    res = mmap(&addr, filesz, PROT_RW, MAP_PRIVATE | MAP_FIXED | MAP_POPULATE, fd, fileoffset);
+  803fbb:	44 8b 8d e0 fc ff ff 	mov    -0x320(%rbp),%r9d
+  803fc2:	44 8b 85 e4 fc ff ff 	mov    -0x31c(%rbp),%r8d
+  803fc9:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  803fce:	ba 06 00 00 00       	mov    $0x6,%edx
+  803fd3:	4c 89 e6             	mov    %r12,%rsi
+  803fd6:	48 8d bd 00 fd ff ff 	lea    -0x300(%rbp),%rdi
+  803fdd:	48 b8 0d 36 80 00 00 	movabs $0x80360d,%rax
+  803fe4:	00 00 00 
+  803fe7:	ff d0                	call   *%rax
+  803fe9:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+    if (res < 0) {
+  803fef:	85 c0                	test   %eax,%eax
+  803ff1:	0f 88 32 fe ff ff    	js     803e29 <spawn+0x466>
+    if (memsz > datasz && filesz > datasz)
+  803ff7:	48 8b 85 f8 fc ff ff 	mov    -0x308(%rbp),%rax
+  803ffe:	49 39 c4             	cmp    %rax,%r12
+  804001:	49 0f 46 c4          	cmovbe %r12,%rax
+  804005:	48 39 85 e8 fc ff ff 	cmp    %rax,-0x318(%rbp)
+  80400c:	0f 83 5e fe ff ff    	jae    803e70 <spawn+0x4ad>
+  804012:	e9 34 fe ff ff       	jmp    803e4b <spawn+0x488>
+    close(fd);
+  804017:	8b bd e4 fc ff ff    	mov    -0x31c(%rbp),%edi
+  80401d:	48 b8 67 1a 80 00 00 	movabs $0x801a67,%rax
+  804024:	00 00 00 
+  804027:	ff d0                	call   *%rax
+    foreach_shared_region(copy_shared_region, &child);
+  804029:	48 8d b5 cc fd ff ff 	lea    -0x234(%rbp),%rsi
+  804030:	48 bf 6e 39 80 00 00 	movabs $0x80396e,%rdi
+  804037:	00 00 00 
+  80403a:	48 b8 5e 4a 80 00 00 	movabs $0x804a5e,%rax
+  804041:	00 00 00 
+  804044:	ff d0                	call   *%rax
+    scring_env_set_trapframe(child, &child_tf);
+  804046:	48 8d b5 0c fd ff ff 	lea    -0x2f4(%rbp),%rsi
+  80404d:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  804053:	48 b8 09 4e 80 00 00 	movabs $0x804e09,%rax
+  80405a:	00 00 00 
+  80405d:	ff d0                	call   *%rax
+    scring_env_set_status(child, ENV_RUNNABLE);
+  80405f:	be 02 00 00 00       	mov    $0x2,%esi
+  804064:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  80406a:	48 b8 d1 4d 80 00 00 	movabs $0x804dd1,%rax
+  804071:	00 00 00 
+  804074:	ff d0                	call   *%rax
+    if ((res = scring_submit()) < 0) {
+  804076:	48 b8 bd 4c 80 00 00 	movabs $0x804cbd,%rax
+  80407d:	00 00 00 
+  804080:	ff d0                	call   *%rax
+  804082:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+  804088:	85 c0                	test   %eax,%eax
+  80408a:	78 11                	js     80409d <spawn+0x6da>
+    return child;
+  80408c:	8b 85 cc fd ff ff    	mov    -0x234(%rbp),%eax
+  804092:	89 85 e4 fc ff ff    	mov    %eax,-0x31c(%rbp)
+  804098:	e9 74 fd ff ff       	jmp    803e11 <spawn+0x44e>
+        cprintf("spawn: batched system call failed: %i\n", res);
+  80409d:	89 c6                	mov    %eax,%esi
+  80409f:	48 bf 10 5e 80 00 00 	movabs $0x805e10,%rdi
+  8040a6:	00 00 00 
+  8040a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040ae:	48 ba 9d 04 80 00 00 	movabs $0x80049d,%rdx
+  8040b5:	00 00 00 
+  8040b8:	ff d2                	call   *%rdx
+        goto error;
+  8040ba:	e9 fb fc ff ff       	jmp    803dba <spawn+0x3f7>
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  8040bf:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  8040c4:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+  8040ca:	e9 eb fc ff ff       	jmp    803dba <spawn+0x3f7>
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  8040cf:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8040d4:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8040d9:	be 00 00 40 00       	mov    $0x400000,%esi
+  8040de:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040e3:	48 b8 21 13 80 00 00 	movabs $0x801321,%rax
+  8040ea:	00 00 00 
+  8040ed:	ff d0                	call   *%rax
+  8040ef:	85 c0                	test   %eax,%eax
+  8040f1:	78 d1                	js     8040c4 <spawn+0x701>
+    for (argc = 0; argv[argc] != 0; argc++)
+  8040f3:	48 c7 85 f8 fc ff ff 	movq   $0x0,-0x308(%rbp)
+  8040fa:	00 00 00 00 
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  8040fe:	48 c7 85 f0 fc ff ff 	movq   $0x40fff8,-0x310(%rbp)
+  804105:	f8 ff 40 00 
+  804109:	48 c7 85 e8 fc ff ff 	movq   $0x410000,-0x318(%rbp)
+  804110:	00 00 41 00 
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  804114:	bb 00 00 41 00       	mov    $0x410000,%ebx
+  804119:	e9 e2 fa ff ff       	jmp    803c00 <spawn+0x23d>
+
+000000000080411e <spawnl>:
+spawnl(const char *prog, const char *arg0, ...) {
+  80411e:	55                   	push   %rbp
+  80411f:	48 89 e5             	mov    %rsp,%rbp
+  804122:	48 83 ec 50          	sub    $0x50,%rsp
+  804126:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80412a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80412e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  804132:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(vl, arg0);
+  804136:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  80413d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804141:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804145:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804149:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int argc = 0;
+  80414d:	b9 00 00 00 00       	mov    $0x0,%ecx
+    while (va_arg(vl, void *) != NULL) argc++;
+  804152:	eb 15                	jmp    804169 <spawnl+0x4b>
+  804154:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804158:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80415c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804160:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  804164:	74 1c                	je     804182 <spawnl+0x64>
+  804166:	83 c1 01             	add    $0x1,%ecx
+  804169:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80416c:	83 f8 2f             	cmp    $0x2f,%eax
+  80416f:	77 e3                	ja     804154 <spawnl+0x36>
+  804171:	89 c2                	mov    %eax,%edx
+  804173:	4c 8d 55 d0          	lea    -0x30(%rbp),%r10
+  804177:	4c 01 d2             	add    %r10,%rdx
+  80417a:	83 c0 08             	add    $0x8,%eax
+  80417d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  804180:	eb de                	jmp    804160 <spawnl+0x42>
+    const char *argv[argc + 2];
+  804182:	8d 41 02             	lea    0x2(%rcx),%eax
+  804185:	48 98                	cltq
+  804187:	48 8d 04 c5 0f 00 00 	lea    0xf(,%rax,8),%rax
+  80418e:	00 
+  80418f:	48 83 e0 f0          	and    $0xfffffffffffffff0,%rax
+  804193:	48 29 c4             	sub    %rax,%rsp
+  804196:	4c 8d 44 24 07       	lea    0x7(%rsp),%r8
+  80419b:	4c 89 c0             	mov    %r8,%rax
+  80419e:	48 c1 e8 03          	shr    $0x3,%rax
+  8041a2:	49 83 e0 f8          	and    $0xfffffffffffffff8,%r8
+    argv[0] = arg0;
+  8041a6:	48 89 34 c5 00 00 00 	mov    %rsi,0x0(,%rax,8)
+  8041ad:	00 
+    argv[argc + 1] = NULL;
+  8041ae:	8d 41 01             	lea    0x1(%rcx),%eax
+  8041b1:	48 98                	cltq
+  8041b3:	49 c7 04 c0 00 00 00 	movq   $0x0,(%r8,%rax,8)
+  8041ba:	00 
+    va_start(vl, arg0);
+  8041bb:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8041c2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8041c6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8041ca:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8041ce:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    for (i = 0; i < argc; i++) {
+  8041d2:	85 c9                	test   %ecx,%ecx
+  8041d4:	74 41                	je     804217 <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  8041d6:	49 89 c1             	mov    %rax,%r9
+  8041d9:	49 8d 40 08          	lea    0x8(%r8),%rax
+  8041dd:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  8041e0:	49 8d 74 d0 10       	lea    0x10(%r8,%rdx,8),%rsi
+  8041e5:	eb 1b                	jmp    804202 <spawnl+0xe4>
+  8041e7:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8041eb:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  8041ef:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8041f3:	48 8b 11             	mov    (%rcx),%rdx
+  8041f6:	48 89 10             	mov    %rdx,(%rax)
+    for (i = 0; i < argc; i++) {
+  8041f9:	48 83 c0 08          	add    $0x8,%rax
+  8041fd:	48 39 f0             	cmp    %rsi,%rax
+  804200:	74 15                	je     804217 <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  804202:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  804205:	83 fa 2f             	cmp    $0x2f,%edx
+  804208:	77 dd                	ja     8041e7 <spawnl+0xc9>
+  80420a:	89 d1                	mov    %edx,%ecx
+  80420c:	4c 01 c9             	add    %r9,%rcx
+  80420f:	83 c2 08             	add    $0x8,%edx
+  804212:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  804215:	eb dc                	jmp    8041f3 <spawnl+0xd5>
+    return spawn(prog, argv);
+  804217:	4c 89 c6             	mov    %r8,%rsi
+  80421a:	48 b8 c3 39 80 00 00 	movabs $0x8039c3,%rax
+  804221:	00 00 00 
+  804224:	ff d0                	call   *%rax
+}
+  804226:	c9                   	leave
+  804227:	c3                   	ret
+
+0000000000804228 <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  804228:	55                   	push   %rbp
+  804229:	48 89 e5             	mov    %rsp,%rbp
+  80422c:	41 54                	push   %r12
+  80422e:	53                   	push   %rbx
+  80422f:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804232:	48 b8 86 18 80 00 00 	movabs $0x801886,%rax
+  804239:	00 00 00 
+  80423c:	ff d0                	call   *%rax
+  80423e:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  804241:	48 be 8f 5e 80 00 00 	movabs $0x805e8f,%rsi
+  804248:	00 00 00 
+  80424b:	48 89 df             	mov    %rbx,%rdi
+  80424e:	48 b8 c2 0d 80 00 00 	movabs $0x800dc2,%rax
+  804255:	00 00 00 
+  804258:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  80425a:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80425f:	41 2b 04 24          	sub    (%r12),%eax
+  804263:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  804269:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  804270:	00 00 00 
+    stat->st_dev = &devpipe;
+  804273:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  80427a:	00 00 00 
+  80427d:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  804284:	b8 00 00 00 00       	mov    $0x0,%eax
+  804289:	5b                   	pop    %rbx
+  80428a:	41 5c                	pop    %r12
+  80428c:	5d                   	pop    %rbp
+  80428d:	c3                   	ret
+
+000000000080428e <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  80428e:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  804291:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  804297:	8b 17                	mov    (%rdi),%edx
+  804299:	85 d2                	test   %edx,%edx
+  80429b:	75 01                	jne    80429e <pipe_wakeup+0x10>
+  80429d:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  80429e:	55                   	push   %rbp
+  80429f:	48 89 e5             	mov    %rsp,%rbp
+  8042a2:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  8042a5:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  8042ab:	be 00 04 00 00       	mov    $0x400,%esi
+  8042b0:	48 b8 ad 16 80 00 00 	movabs $0x8016ad,%rax
+  8042b7:	00 00 00 
+  8042ba:	ff d0                	call   *%rax
+}
+  8042bc:	5d                   	pop    %rbp
+  8042bd:	c3                   	ret
+
+00000000008042be <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8042be:	55                   	push   %rbp
+  8042bf:	48 89 e5             	mov    %rsp,%rbp
+  8042c2:	41 55                	push   %r13
+  8042c4:	41 54                	push   %r12
+  8042c6:	53                   	push   %rbx
+  8042c7:	48 83 ec 08          	sub    $0x8,%rsp
+  8042cb:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8042ce:	48 b8 86 18 80 00 00 	movabs $0x801886,%rax
+  8042d5:	00 00 00 
+  8042d8:	ff d0                	call   *%rax
+  8042da:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8042dd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8042e2:	4c 89 e6             	mov    %r12,%rsi
+  8042e5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8042ea:	49 bc c7 13 80 00 00 	movabs $0x8013c7,%r12
+  8042f1:	00 00 00 
+  8042f4:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8042f7:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  8042fb:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  8042ff:	49 bd 8e 42 80 00 00 	movabs $0x80428e,%r13
+  804306:	00 00 00 
+  804309:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  80430c:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  804310:	48 89 de             	mov    %rbx,%rsi
+  804313:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  804316:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80431b:	48 89 de             	mov    %rbx,%rsi
+  80431e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804323:	41 ff d4             	call   *%r12
+  804326:	48 83 c4 08          	add    $0x8,%rsp
+  80432a:	5b                   	pop    %rbx
+  80432b:	41 5c                	pop    %r12
+  80432d:	41 5d                	pop    %r13
+  80432f:	5d                   	pop    %rbp
+  804330:	c3                   	ret
+
+0000000000804331 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  804331:	55                   	push   %rbp
+  804332:	48 89 e5             	mov    %rsp,%rbp
+  804335:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804338:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80433d:	be 00 10 00 00       	mov    $0x1000,%esi
+  804342:	48 b8 0a 13 80 00 00 	movabs $0x80130a,%rax
+  804349:	00 00 00 
+  80434c:	ff d0                	call   *%rax
+  80434e:	85 c0                	test   %eax,%eax
+  804350:	0f 94 c0             	sete   %al
+  804353:	0f b6 c0             	movzbl %al,%eax
+}
+  804356:	5d                   	pop    %rbp
+  804357:	c3                   	ret
+
+0000000000804358 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804358:	55                   	push   %rbp
+  804359:	48 89 e5             	mov    %rsp,%rbp
+  80435c:	41 57                	push   %r15
+  80435e:	41 56                	push   %r14
+  804360:	41 55                	push   %r13
+  804362:	41 54                	push   %r12
+  804364:	53                   	push   %rbx
+  804365:	48 83 ec 38          	sub    $0x38,%rsp
+  804369:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80436d:	49 89 f4             	mov    %rsi,%r12
+  804370:	49 89 d7             	mov    %rdx,%r15
+  804373:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804377:	48 b8 86 18 80 00 00 	movabs $0x801886,%rax
+  80437e:	00 00 00 
+  804381:	ff d0                	call   *%rax
+  804383:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  804386:	4d 85 ff             	test   %r15,%r15
+  804389:	0f 84 f1 00 00 00    	je     804480 <devpipe_write+0x128>
+  80438f:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  804393:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  804397:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  80439b:	49 bd 31 43 80 00 00 	movabs $0x804331,%r13
+  8043a2:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8043a5:	49 bf 8e 42 80 00 00 	movabs $0x80428e,%r15
+  8043ac:	00 00 00 
+  8043af:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  8043b3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8043b7:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8043bb:	8b 73 04             	mov    0x4(%rbx),%esi
+  8043be:	48 63 ce             	movslq %esi,%rcx
+  8043c1:	48 63 03             	movslq (%rbx),%rax
+  8043c4:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  8043ca:	48 39 c1             	cmp    %rax,%rcx
+  8043cd:	72 64                	jb     804433 <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  8043cf:	48 89 de             	mov    %rbx,%rsi
+  8043d2:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8043d6:	41 ff d5             	call   *%r13
+  8043d9:	85 c0                	test   %eax,%eax
+  8043db:	0f 85 b9 00 00 00    	jne    80449a <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8043e1:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8043e5:	4c 89 f7             	mov    %r14,%rdi
+  8043e8:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  8043eb:	8b 43 04             	mov    0x4(%rbx),%eax
+  8043ee:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  8043f5:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8043fc:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  804402:	8b 03                	mov    (%rbx),%eax
+  804404:	41 39 c4             	cmp    %eax,%r12d
+  804407:	75 b2                	jne    8043bb <devpipe_write+0x63>
+  804409:	48 89 de             	mov    %rbx,%rsi
+  80440c:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  804410:	41 ff d5             	call   *%r13
+  804413:	85 c0                	test   %eax,%eax
+  804415:	75 a0                	jne    8043b7 <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  804417:	ba 0a 00 00 00       	mov    $0xa,%edx
+  80441c:	44 89 e6             	mov    %r12d,%esi
+  80441f:	48 89 df             	mov    %rbx,%rdi
+  804422:	48 b8 8f 16 80 00 00 	movabs $0x80168f,%rax
+  804429:	00 00 00 
+  80442c:	ff d0                	call   *%rax
+  80442e:	e9 7c ff ff ff       	jmp    8043af <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  804433:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  804437:	41 0f b6 38          	movzbl (%r8),%edi
+  80443b:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  804442:	80 80 80 
+  804445:	48 89 c8             	mov    %rcx,%rax
+  804448:	48 f7 e2             	mul    %rdx
+  80444b:	48 c1 ea 0b          	shr    $0xb,%rdx
+  80444f:	48 89 d0             	mov    %rdx,%rax
+  804452:	48 c1 e0 08          	shl    $0x8,%rax
+  804456:	48 29 d0             	sub    %rdx,%rax
+  804459:	48 c1 e0 04          	shl    $0x4,%rax
+  80445d:	48 29 c1             	sub    %rax,%rcx
+  804460:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  804465:	83 c6 01             	add    $0x1,%esi
+  804468:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80446b:	49 83 c0 01          	add    $0x1,%r8
+  80446f:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  804473:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804477:	49 39 c0             	cmp    %rax,%r8
+  80447a:	0f 85 2f ff ff ff    	jne    8043af <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  804480:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  804484:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  804488:	48 b8 8e 42 80 00 00 	movabs $0x80428e,%rax
+  80448f:	00 00 00 
+  804492:	ff d0                	call   *%rax
+    return n;
+  804494:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804498:	eb 05                	jmp    80449f <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  80449a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80449f:	48 83 c4 38          	add    $0x38,%rsp
+  8044a3:	5b                   	pop    %rbx
+  8044a4:	41 5c                	pop    %r12
+  8044a6:	41 5d                	pop    %r13
+  8044a8:	41 5e                	pop    %r14
+  8044aa:	41 5f                	pop    %r15
+  8044ac:	5d                   	pop    %rbp
+  8044ad:	c3                   	ret
+
+00000000008044ae <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8044ae:	55                   	push   %rbp
+  8044af:	48 89 e5             	mov    %rsp,%rbp
+  8044b2:	41 57                	push   %r15
+  8044b4:	41 56                	push   %r14
+  8044b6:	41 55                	push   %r13
+  8044b8:	41 54                	push   %r12
+  8044ba:	53                   	push   %rbx
+  8044bb:	48 83 ec 28          	sub    $0x28,%rsp
+  8044bf:	49 89 fd             	mov    %rdi,%r13
+  8044c2:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  8044c6:	49 89 d4             	mov    %rdx,%r12
+  8044c9:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8044cd:	48 b8 86 18 80 00 00 	movabs $0x801886,%rax
+  8044d4:	00 00 00 
+  8044d7:	ff d0                	call   *%rax
+  8044d9:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8044dc:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  8044e2:	49 bf 31 43 80 00 00 	movabs $0x804331,%r15
+  8044e9:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8044ec:	4d 85 e4             	test   %r12,%r12
+  8044ef:	0f 84 d5 00 00 00    	je     8045ca <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  8044f5:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  8044f9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8044fd:	8b 03                	mov    (%rbx),%eax
+  8044ff:	3b 43 04             	cmp    0x4(%rbx),%eax
+  804502:	75 7a                	jne    80457e <devpipe_read+0xd0>
+            if (i > 0) {
+  804504:	4d 85 f6             	test   %r14,%r14
+  804507:	75 50                	jne    804559 <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  804509:	48 89 de             	mov    %rbx,%rsi
+  80450c:	4c 89 ef             	mov    %r13,%rdi
+  80450f:	41 ff d7             	call   *%r15
+  804512:	85 c0                	test   %eax,%eax
+  804514:	0f 85 c9 00 00 00    	jne    8045e3 <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  80451a:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  80451d:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  804524:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  80452a:	8b 43 04             	mov    0x4(%rbx),%eax
+  80452d:	41 39 c4             	cmp    %eax,%r12d
+  804530:	75 cb                	jne    8044fd <devpipe_read+0x4f>
+  804532:	48 89 de             	mov    %rbx,%rsi
+  804535:	4c 89 ef             	mov    %r13,%rdi
+  804538:	41 ff d7             	call   *%r15
+  80453b:	85 c0                	test   %eax,%eax
+  80453d:	75 be                	jne    8044fd <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  80453f:	ba 0a 00 00 00       	mov    $0xa,%edx
+  804544:	44 89 e6             	mov    %r12d,%esi
+  804547:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80454b:	48 b8 8f 16 80 00 00 	movabs $0x80168f,%rax
+  804552:	00 00 00 
+  804555:	ff d0                	call   *%rax
+  804557:	eb a4                	jmp    8044fd <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  804559:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  80455d:	48 89 de             	mov    %rbx,%rsi
+  804560:	48 b8 8e 42 80 00 00 	movabs $0x80428e,%rax
+  804567:	00 00 00 
+  80456a:	ff d0                	call   *%rax
+                return i;
+  80456c:	4c 89 f0             	mov    %r14,%rax
+}
+  80456f:	48 83 c4 28          	add    $0x28,%rsp
+  804573:	5b                   	pop    %rbx
+  804574:	41 5c                	pop    %r12
+  804576:	41 5d                	pop    %r13
+  804578:	41 5e                	pop    %r14
+  80457a:	41 5f                	pop    %r15
+  80457c:	5d                   	pop    %rbp
+  80457d:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80457e:	48 63 c8             	movslq %eax,%rcx
+  804581:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  804588:	80 80 80 
+  80458b:	48 89 c8             	mov    %rcx,%rax
+  80458e:	48 f7 e2             	mul    %rdx
+  804591:	48 c1 ea 0b          	shr    $0xb,%rdx
+  804595:	48 89 d0             	mov    %rdx,%rax
+  804598:	48 c1 e0 08          	shl    $0x8,%rax
+  80459c:	48 29 d0             	sub    %rdx,%rax
+  80459f:	48 c1 e0 04          	shl    $0x4,%rax
+  8045a3:	48 89 c2             	mov    %rax,%rdx
+  8045a6:	48 89 c8             	mov    %rcx,%rax
+  8045a9:	48 29 d0             	sub    %rdx,%rax
+  8045ac:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  8045b1:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8045b5:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  8045b9:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8045bc:	49 83 c6 01          	add    $0x1,%r14
+  8045c0:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  8045c4:	0f 85 2b ff ff ff    	jne    8044f5 <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  8045ca:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  8045ce:	48 89 de             	mov    %rbx,%rsi
+  8045d1:	48 b8 8e 42 80 00 00 	movabs $0x80428e,%rax
+  8045d8:	00 00 00 
+  8045db:	ff d0                	call   *%rax
+    return n;
+  8045dd:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8045e1:	eb 8c                	jmp    80456f <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  8045e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045e8:	eb 85                	jmp    80456f <devpipe_read+0xc1>
+
+00000000008045ea <pipe>:
+pipe(int pfd[2]) {
+  8045ea:	55                   	push   %rbp
+  8045eb:	48 89 e5             	mov    %rsp,%rbp
+  8045ee:	41 55                	push   %r13
+  8045f0:	41 54                	push   %r12
+  8045f2:	53                   	push   %rbx
+  8045f3:	48 83 ec 18          	sub    $0x18,%rsp
+  8045f7:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8045fa:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8045fe:	48 b8 a2 18 80 00 00 	movabs $0x8018a2,%rax
+  804605:	00 00 00 
+  804608:	ff d0                	call   *%rax
+  80460a:	89 c3                	mov    %eax,%ebx
+  80460c:	85 c0                	test   %eax,%eax
+  80460e:	0f 88 a0 01 00 00    	js     8047b4 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  804614:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804619:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80461e:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804622:	bf 00 00 00 00       	mov    $0x0,%edi
+  804627:	48 b8 21 13 80 00 00 	movabs $0x801321,%rax
+  80462e:	00 00 00 
+  804631:	ff d0                	call   *%rax
+  804633:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804635:	85 c0                	test   %eax,%eax
+  804637:	0f 88 77 01 00 00    	js     8047b4 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80463d:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  804641:	48 b8 a2 18 80 00 00 	movabs $0x8018a2,%rax
+  804648:	00 00 00 
+  80464b:	ff d0                	call   *%rax
+  80464d:	89 c3                	mov    %eax,%ebx
+  80464f:	85 c0                	test   %eax,%eax
+  804651:	0f 88 43 01 00 00    	js     80479a <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  804657:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80465c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804661:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804665:	bf 00 00 00 00       	mov    $0x0,%edi
+  80466a:	48 b8 21 13 80 00 00 	movabs $0x801321,%rax
+  804671:	00 00 00 
+  804674:	ff d0                	call   *%rax
+  804676:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804678:	85 c0                	test   %eax,%eax
+  80467a:	0f 88 1a 01 00 00    	js     80479a <pipe+0x1b0>
+    va = fd2data(fd0);
+  804680:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804684:	48 b8 86 18 80 00 00 	movabs $0x801886,%rax
+  80468b:	00 00 00 
+  80468e:	ff d0                	call   *%rax
+  804690:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  804693:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804698:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80469d:	48 89 c6             	mov    %rax,%rsi
+  8046a0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8046a5:	48 b8 21 13 80 00 00 	movabs $0x801321,%rax
+  8046ac:	00 00 00 
+  8046af:	ff d0                	call   *%rax
+  8046b1:	89 c3                	mov    %eax,%ebx
+  8046b3:	85 c0                	test   %eax,%eax
+  8046b5:	0f 88 c5 00 00 00    	js     804780 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8046bb:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8046bf:	48 b8 86 18 80 00 00 	movabs $0x801886,%rax
+  8046c6:	00 00 00 
+  8046c9:	ff d0                	call   *%rax
+  8046cb:	48 89 c1             	mov    %rax,%rcx
+  8046ce:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8046d4:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8046da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8046df:	4c 89 ee             	mov    %r13,%rsi
+  8046e2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8046e7:	48 b8 77 13 80 00 00 	movabs $0x801377,%rax
+  8046ee:	00 00 00 
+  8046f1:	ff d0                	call   *%rax
+  8046f3:	89 c3                	mov    %eax,%ebx
+  8046f5:	85 c0                	test   %eax,%eax
+  8046f7:	78 6e                	js     804767 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8046f9:	be 00 10 00 00       	mov    $0x1000,%esi
+  8046fe:	4c 89 ef             	mov    %r13,%rdi
+  804701:	48 b8 e6 12 80 00 00 	movabs $0x8012e6,%rax
+  804708:	00 00 00 
+  80470b:	ff d0                	call   *%rax
+  80470d:	83 f8 02             	cmp    $0x2,%eax
+  804710:	0f 85 ab 00 00 00    	jne    8047c1 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  804716:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  80471d:	00 00 
+  80471f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804723:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  804725:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804729:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  804730:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804734:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  804736:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80473a:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  804741:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804745:	48 bb 74 18 80 00 00 	movabs $0x801874,%rbx
+  80474c:	00 00 00 
+  80474f:	ff d3                	call   *%rbx
+  804751:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  804755:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804759:	ff d3                	call   *%rbx
+  80475b:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  804760:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804765:	eb 4d                	jmp    8047b4 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  804767:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80476c:	4c 89 ee             	mov    %r13,%rsi
+  80476f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804774:	48 b8 c7 13 80 00 00 	movabs $0x8013c7,%rax
+  80477b:	00 00 00 
+  80477e:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  804780:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804785:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804789:	bf 00 00 00 00       	mov    $0x0,%edi
+  80478e:	48 b8 c7 13 80 00 00 	movabs $0x8013c7,%rax
+  804795:	00 00 00 
+  804798:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80479a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80479f:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8047a3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8047a8:	48 b8 c7 13 80 00 00 	movabs $0x8013c7,%rax
+  8047af:	00 00 00 
+  8047b2:	ff d0                	call   *%rax
+}
+  8047b4:	89 d8                	mov    %ebx,%eax
+  8047b6:	48 83 c4 18          	add    $0x18,%rsp
+  8047ba:	5b                   	pop    %rbx
+  8047bb:	41 5c                	pop    %r12
+  8047bd:	41 5d                	pop    %r13
+  8047bf:	5d                   	pop    %rbp
+  8047c0:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8047c1:	48 b9 a8 5e 80 00 00 	movabs $0x805ea8,%rcx
+  8047c8:	00 00 00 
+  8047cb:	48 ba 51 5e 80 00 00 	movabs $0x805e51,%rdx
+  8047d2:	00 00 00 
+  8047d5:	be 50 00 00 00       	mov    $0x50,%esi
+  8047da:	48 bf 96 5e 80 00 00 	movabs $0x805e96,%rdi
+  8047e1:	00 00 00 
+  8047e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047e9:	49 b8 4d 03 80 00 00 	movabs $0x80034d,%r8
+  8047f0:	00 00 00 
+  8047f3:	41 ff d0             	call   *%r8
+
+00000000008047f6 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8047f6:	55                   	push   %rbp
+  8047f7:	48 89 e5             	mov    %rsp,%rbp
+  8047fa:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8047fe:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804802:	48 b8 02 19 80 00 00 	movabs $0x801902,%rax
+  804809:	00 00 00 
+  80480c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80480e:	85 c0                	test   %eax,%eax
+  804810:	78 23                	js     804835 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  804812:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804816:	48 b8 86 18 80 00 00 	movabs $0x801886,%rax
+  80481d:	00 00 00 
+  804820:	ff d0                	call   *%rax
+  804822:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  804825:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804829:	48 b8 31 43 80 00 00 	movabs $0x804331,%rax
+  804830:	00 00 00 
+  804833:	ff d0                	call   *%rax
+}
+  804835:	c9                   	leave
+  804836:	c3                   	ret
+
+0000000000804837 <wait>:
+#include <inc/lib.h>
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  804837:	55                   	push   %rbp
+  804838:	48 89 e5             	mov    %rsp,%rbp
+  80483b:	41 56                	push   %r14
+  80483d:	41 55                	push   %r13
+  80483f:	41 54                	push   %r12
+  804841:	53                   	push   %rbx
+    assert(envid != 0);
+  804842:	85 ff                	test   %edi,%edi
+  804844:	0f 84 b7 00 00 00    	je     804901 <wait+0xca>
+  80484a:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  80484d:	89 f9                	mov    %edi,%ecx
+  80484f:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+
+    for (;;) {
+        uint32_t seq = env->env_wait_seq;
+  804855:	48 bf 00 00 c0 1f 80 	movabs $0x801fc00000,%rdi
+  80485c:	00 00 00 
+  80485f:	45 89 e0             	mov    %r12d,%r8d
+  804862:	41 81 e0 ff 03 00 00 	and    $0x3ff,%r8d
+  804869:	4c 89 c0             	mov    %r8,%rax
+  80486c:	48 c1 e0 04          	shl    $0x4,%rax
+  804870:	48 89 c2             	mov    %rax,%rdx
+  804873:	4c 29 c2             	sub    %r8,%rdx
+  804876:	48 c1 e2 05          	shl    $0x5,%rdx
+  80487a:	48 01 fa             	add    %rdi,%rdx
+  80487d:	8b b2 b8 01 00 00    	mov    0x1b8(%rdx),%esi
+        if (env->env_id != envid || env->env_status == ENV_FREE) break;
+  804883:	8b 82 c8 00 00 00    	mov    0xc8(%rdx),%eax
+  804889:	41 39 c4             	cmp    %eax,%r12d
+  80488c:	75 6a                	jne    8048f8 <wait+0xc1>
+
+        /* The kernel wakes us up when the environment is freed */
+        sys_futex_wait(&env->env_wait_seq, seq, 0);
+  80488e:	48 63 d1             	movslq %ecx,%rdx
+  804891:	48 89 d0             	mov    %rdx,%rax
+  804894:	48 c1 e0 04          	shl    $0x4,%rax
+  804898:	48 29 d0             	sub    %rdx,%rax
+  80489b:	48 c1 e0 05          	shl    $0x5,%rax
+  80489f:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8048a6:	00 00 00 
+  8048a9:	4c 8d b4 02 b8 01 00 	lea    0x1b8(%rdx,%rax,1),%r14
+  8048b0:	00 
+        if (env->env_id != envid || env->env_status == ENV_FREE) break;
+  8048b1:	48 63 c9             	movslq %ecx,%rcx
+  8048b4:	48 89 c8             	mov    %rcx,%rax
+  8048b7:	48 c1 e0 04          	shl    $0x4,%rax
+  8048bb:	48 29 c8             	sub    %rcx,%rax
+  8048be:	48 c1 e0 05          	shl    $0x5,%rax
+  8048c2:	48 89 d3             	mov    %rdx,%rbx
+  8048c5:	48 01 c3             	add    %rax,%rbx
+        sys_futex_wait(&env->env_wait_seq, seq, 0);
+  8048c8:	49 bd 8f 16 80 00 00 	movabs $0x80168f,%r13
+  8048cf:	00 00 00 
+        if (env->env_id != envid || env->env_status == ENV_FREE) break;
+  8048d2:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+  8048d8:	85 c0                	test   %eax,%eax
+  8048da:	74 1c                	je     8048f8 <wait+0xc1>
+        sys_futex_wait(&env->env_wait_seq, seq, 0);
+  8048dc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8048e1:	4c 89 f7             	mov    %r14,%rdi
+  8048e4:	41 ff d5             	call   *%r13
+        uint32_t seq = env->env_wait_seq;
+  8048e7:	8b b3 b8 01 00 00    	mov    0x1b8(%rbx),%esi
+        if (env->env_id != envid || env->env_status == ENV_FREE) break;
+  8048ed:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  8048f3:	44 39 e0             	cmp    %r12d,%eax
+  8048f6:	74 da                	je     8048d2 <wait+0x9b>
+    }
+}
+  8048f8:	5b                   	pop    %rbx
+  8048f9:	41 5c                	pop    %r12
+  8048fb:	41 5d                	pop    %r13
+  8048fd:	41 5e                	pop    %r14
+  8048ff:	5d                   	pop    %rbp
+  804900:	c3                   	ret
+    assert(envid != 0);
+  804901:	48 b9 cc 5e 80 00 00 	movabs $0x805ecc,%rcx
+  804908:	00 00 00 
+  80490b:	48 ba 51 5e 80 00 00 	movabs $0x805e51,%rdx
+  804912:	00 00 00 
+  804915:	be 06 00 00 00       	mov    $0x6,%esi
+  80491a:	48 bf d7 5e 80 00 00 	movabs $0x805ed7,%rdi
+  804921:	00 00 00 
+  804924:	b8 00 00 00 00       	mov    $0x0,%eax
+  804929:	49 b8 4d 03 80 00 00 	movabs $0x80034d,%r8
+  804930:	00 00 00 
+  804933:	41 ff d0             	call   *%r8
+
+0000000000804936 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804936:	48 89 f8             	mov    %rdi,%rax
+  804939:	48 c1 e8 27          	shr    $0x27,%rax
+  80493d:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804944:	01 00 00 
+  804947:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80494b:	f6 c2 01             	test   $0x1,%dl
+  80494e:	74 6d                	je     8049bd <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804950:	48 89 f8             	mov    %rdi,%rax
+  804953:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804957:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80495e:	01 00 00 
+  804961:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804965:	f6 c2 01             	test   $0x1,%dl
+  804968:	74 62                	je     8049cc <get_uvpt_entry+0x96>
+  80496a:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804971:	01 00 00 
+  804974:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804978:	f6 c2 80             	test   $0x80,%dl
+  80497b:	75 4f                	jne    8049cc <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80497d:	48 89 f8             	mov    %rdi,%rax
+  804980:	48 c1 e8 15          	shr    $0x15,%rax
+  804984:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80498b:	01 00 00 
+  80498e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804992:	f6 c2 01             	test   $0x1,%dl
+  804995:	74 44                	je     8049db <get_uvpt_entry+0xa5>
+  804997:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80499e:	01 00 00 
+  8049a1:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8049a5:	f6 c2 80             	test   $0x80,%dl
+  8049a8:	75 31                	jne    8049db <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8049aa:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8049ae:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8049b5:	01 00 00 
+  8049b8:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8049bc:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8049bd:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8049c4:	01 00 00 
+  8049c7:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8049cb:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8049cc:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8049d3:	01 00 00 
+  8049d6:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8049da:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8049db:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8049e2:	01 00 00 
+  8049e5:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8049e9:	c3                   	ret
+
+00000000008049ea <get_prot>:
+
+int
+get_prot(void *va) {
+  8049ea:	55                   	push   %rbp
+  8049eb:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8049ee:	48 b8 36 49 80 00 00 	movabs $0x804936,%rax
+  8049f5:	00 00 00 
+  8049f8:	ff d0                	call   *%rax
+  8049fa:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8049fd:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  804a02:	89 c1                	mov    %eax,%ecx
+  804a04:	83 c9 04             	or     $0x4,%ecx
+  804a07:	f6 c2 01             	test   $0x1,%dl
+  804a0a:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  804a0d:	89 c1                	mov    %eax,%ecx
+  804a0f:	83 c9 02             	or     $0x2,%ecx
+  804a12:	f6 c2 02             	test   $0x2,%dl
+  804a15:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  804a18:	89 c1                	mov    %eax,%ecx
+  804a1a:	83 c9 01             	or     $0x1,%ecx
+  804a1d:	48 85 d2             	test   %rdx,%rdx
+  804a20:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804a23:	89 c1                	mov    %eax,%ecx
+  804a25:	83 c9 40             	or     $0x40,%ecx
+  804a28:	f6 c6 04             	test   $0x4,%dh
+  804a2b:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804a2e:	5d                   	pop    %rbp
+  804a2f:	c3                   	ret
+
+0000000000804a30 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804a30:	55                   	push   %rbp
+  804a31:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804a34:	48 b8 36 49 80 00 00 	movabs $0x804936,%rax
+  804a3b:	00 00 00 
+  804a3e:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804a40:	48 c1 e8 06          	shr    $0x6,%rax
+  804a44:	83 e0 01             	and    $0x1,%eax
+}
+  804a47:	5d                   	pop    %rbp
+  804a48:	c3                   	ret
+
+0000000000804a49 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804a49:	55                   	push   %rbp
+  804a4a:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804a4d:	48 b8 36 49 80 00 00 	movabs $0x804936,%rax
+  804a54:	00 00 00 
+  804a57:	ff d0                	call   *%rax
+  804a59:	83 e0 01             	and    $0x1,%eax
+}
+  804a5c:	5d                   	pop    %rbp
+  804a5d:	c3                   	ret
+
+0000000000804a5e <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  804a5e:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  804a65:	01 00 00 
+  804a68:	a8 01                	test   $0x1,%al
+  804a6a:	75 06                	jne    804a72 <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  804a6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a71:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804a72:	55                   	push   %rbp
+  804a73:	48 89 e5             	mov    %rsp,%rbp
+  804a76:	41 57                	push   %r15
+  804a78:	41 56                	push   %r14
+  804a7a:	41 55                	push   %r13
+  804a7c:	41 54                	push   %r12
+  804a7e:	53                   	push   %rbx
+  804a7f:	48 83 ec 28          	sub    $0x28,%rsp
+  804a83:	49 89 fe             	mov    %rdi,%r14
+  804a86:	49 89 f7             	mov    %rsi,%r15
+  804a89:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  804a90:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  804a91:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  804a98:	01 00 00 
+  804a9b:	e9 ae 00 00 00       	jmp    804b4e <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  804aa0:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804aa7:	49 83 ec 01          	sub    $0x1,%r12
+  804aab:	74 2d                	je     804ada <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  804aad:	48 89 d8             	mov    %rbx,%rax
+  804ab0:	48 c1 e8 0c          	shr    $0xc,%rax
+  804ab4:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  804ab9:	f6 c2 01             	test   $0x1,%dl
+  804abc:	74 e2                	je     804aa0 <foreach_shared_region+0x42>
+  804abe:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  804ac3:	f6 c4 04             	test   $0x4,%ah
+  804ac6:	74 d8                	je     804aa0 <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  804ac8:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  804acf:	4c 89 fa             	mov    %r15,%rdx
+  804ad2:	48 89 df             	mov    %rbx,%rdi
+  804ad5:	41 ff d6             	call   *%r14
+  804ad8:	eb c6                	jmp    804aa0 <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  804ada:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  804ae1:	00 
+  804ae2:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  804ae7:	74 4a                	je     804b33 <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  804ae9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804aed:	48 c1 e8 15          	shr    $0x15,%rax
+  804af1:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  804af8:	01 00 00 
+  804afb:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804aff:	a8 01                	test   $0x1,%al
+  804b01:	74 d7                	je     804ada <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  804b03:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  804b07:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  804b0e:	48 39 c3             	cmp    %rax,%rbx
+  804b11:	73 c7                	jae    804ada <foreach_shared_region+0x7c>
+  804b13:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  804b1a:	48 39 d0             	cmp    %rdx,%rax
+  804b1d:	4d 19 e4             	sbb    %r12,%r12
+  804b20:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  804b27:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  804b2e:	e9 7a ff ff ff       	jmp    804aad <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  804b33:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  804b3a:	40 
+  804b3b:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804b3f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804b46:	00 00 00 
+  804b49:	48 39 c1             	cmp    %rax,%rcx
+  804b4c:	74 50                	je     804b9e <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  804b4e:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804b52:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804b56:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  804b5d:	01 00 00 
+  804b60:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804b64:	a8 01                	test   $0x1,%al
+  804b66:	74 cb                	je     804b33 <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  804b68:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804b6c:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  804b73:	48 39 c1             	cmp    %rax,%rcx
+  804b76:	73 bb                	jae    804b33 <foreach_shared_region+0xd5>
+  804b78:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  804b7f:	48 39 d0             	cmp    %rdx,%rax
+  804b82:	48 19 c0             	sbb    %rax,%rax
+  804b85:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  804b8b:	48 05 00 02 00 00    	add    $0x200,%rax
+  804b91:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804b95:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  804b99:	e9 4b ff ff ff       	jmp    804ae9 <foreach_shared_region+0x8b>
+  804b9e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ba3:	48 83 c4 28          	add    $0x28,%rsp
+  804ba7:	5b                   	pop    %rbx
+  804ba8:	41 5c                	pop    %r12
+  804baa:	41 5d                	pop    %r13
+  804bac:	41 5e                	pop    %r14
+  804bae:	41 5f                	pop    %r15
+  804bb0:	5d                   	pop    %rbp
+  804bb1:	c3                   	ret
+
+0000000000804bb2 <ring_enter>:
+    }
+}
+#endif
+
+static int
+ring_enter(void) {
+  804bb2:	55                   	push   %rbp
+  804bb3:	48 89 e5             	mov    %rsp,%rbp
+    int res;
+
+    /* Forked children inherit the ring but not its registration */
+    if (thisenv->env_sc_ring != &ring &&
+  804bb6:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804bbd:	00 00 00 
+  804bc0:	48 8b 90 c0 01 00 00 	mov    0x1c0(%rax),%rdx
+  804bc7:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  804bce:	00 00 00 
+  804bd1:	48 39 c2             	cmp    %rax,%rdx
+  804bd4:	74 13                	je     804be9 <ring_enter+0x37>
+        (res = sys_ring_register(&ring)) < 0) goto out;
+  804bd6:	48 89 c7             	mov    %rax,%rdi
+  804bd9:	48 b8 06 16 80 00 00 	movabs $0x801606,%rax
+  804be0:	00 00 00 
+  804be3:	ff d0                	call   *%rax
+    if (thisenv->env_sc_ring != &ring &&
+  804be5:	85 c0                	test   %eax,%eax
+  804be7:	78 0c                	js     804bf5 <ring_enter+0x43>
+
+#ifdef SANITIZE_USER_SHADOW_BASE
+    uint32_t head = ring.sr_head;
+#endif
+
+    res = sys_ring_enter();
+  804be9:	48 b8 66 16 80 00 00 	movabs $0x801666,%rax
+  804bf0:	00 00 00 
+  804bf3:	ff d0                	call   *%rax
+    }
+#endif
+
+out:
+    /* Calls queued after the failed one are dropped */
+    ring.sr_tail = ring.sr_head;
+  804bf5:	48 ba 40 10 84 00 00 	movabs $0x841040,%rdx
+  804bfc:	00 00 00 
+  804bff:	8b 0a                	mov    (%rdx),%ecx
+  804c01:	89 4a 04             	mov    %ecx,0x4(%rdx)
+    return res;
+}
+  804c04:	5d                   	pop    %rbp
+  804c05:	c3                   	ret
+
+0000000000804c06 <scring_push>:
+
+/* Queue system call num, the ring is submitted
+ * automatically when it is full. Errors are reported
+ * by scring_submit(), calls queued after an error are dropped */
+void
+scring_push(uintptr_t num, uintptr_t a1, uintptr_t a2, uintptr_t a3, uintptr_t a4, uintptr_t a5, uintptr_t a6) {
+  804c06:	55                   	push   %rbp
+  804c07:	48 89 e5             	mov    %rsp,%rbp
+  804c0a:	41 57                	push   %r15
+  804c0c:	41 56                	push   %r14
+  804c0e:	41 55                	push   %r13
+  804c10:	41 54                	push   %r12
+  804c12:	53                   	push   %rbx
+  804c13:	48 83 ec 18          	sub    $0x18,%rsp
+  804c17:	4c 89 4d c8          	mov    %r9,-0x38(%rbp)
+    if (pending_error) return;
+  804c1b:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  804c22:	00 00 00 
+  804c25:	83 38 00             	cmpl   $0x0,(%rax)
+  804c28:	75 69                	jne    804c93 <scring_push+0x8d>
+  804c2a:	49 89 ff             	mov    %rdi,%r15
+  804c2d:	49 89 f6             	mov    %rsi,%r14
+  804c30:	49 89 d5             	mov    %rdx,%r13
+  804c33:	49 89 cc             	mov    %rcx,%r12
+  804c36:	4c 89 c3             	mov    %r8,%rbx
+    if (ring.sr_tail - ring.sr_head == SCRING_SIZE &&
+  804c39:	48 ba 40 10 84 00 00 	movabs $0x841040,%rdx
+  804c40:	00 00 00 
+  804c43:	8b 42 04             	mov    0x4(%rdx),%eax
+  804c46:	8b 12                	mov    (%rdx),%edx
+  804c48:	29 d0                	sub    %edx,%eax
+  804c4a:	83 f8 20             	cmp    $0x20,%eax
+  804c4d:	74 53                	je     804ca2 <scring_push+0x9c>
+        (pending_error = ring_enter()) < 0) return;
+
+    struct SyscallDesc *sd = &ring.sr_desc[ring.sr_tail % SCRING_SIZE];
+  804c4f:	48 ba 40 10 84 00 00 	movabs $0x841040,%rdx
+  804c56:	00 00 00 
+  804c59:	8b 42 04             	mov    0x4(%rdx),%eax
+    sd->sd_num = num;
+  804c5c:	83 e0 1f             	and    $0x1f,%eax
+  804c5f:	48 c1 e0 06          	shl    $0x6,%rax
+  804c63:	48 01 d0             	add    %rdx,%rax
+  804c66:	4c 89 78 08          	mov    %r15,0x8(%rax)
+    sd->sd_args[0] = a1;
+  804c6a:	4c 89 70 10          	mov    %r14,0x10(%rax)
+    sd->sd_args[1] = a2;
+  804c6e:	4c 89 68 18          	mov    %r13,0x18(%rax)
+    sd->sd_args[2] = a3;
+  804c72:	4c 89 60 20          	mov    %r12,0x20(%rax)
+    sd->sd_args[3] = a4;
+  804c76:	48 89 58 28          	mov    %rbx,0x28(%rax)
+    sd->sd_args[4] = a5;
+  804c7a:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  804c7e:	48 89 58 30          	mov    %rbx,0x30(%rax)
+    sd->sd_args[5] = a6;
+  804c82:	48 8b 4d 10          	mov    0x10(%rbp),%rcx
+  804c86:	48 89 48 38          	mov    %rcx,0x38(%rax)
+    ring.sr_tail++;
+  804c8a:	8b 42 04             	mov    0x4(%rdx),%eax
+  804c8d:	83 c0 01             	add    $0x1,%eax
+  804c90:	89 42 04             	mov    %eax,0x4(%rdx)
+}
+  804c93:	48 83 c4 18          	add    $0x18,%rsp
+  804c97:	5b                   	pop    %rbx
+  804c98:	41 5c                	pop    %r12
+  804c9a:	41 5d                	pop    %r13
+  804c9c:	41 5e                	pop    %r14
+  804c9e:	41 5f                	pop    %r15
+  804ca0:	5d                   	pop    %rbp
+  804ca1:	c3                   	ret
+        (pending_error = ring_enter()) < 0) return;
+  804ca2:	48 b8 b2 4b 80 00 00 	movabs $0x804bb2,%rax
+  804ca9:	00 00 00 
+  804cac:	ff d0                	call   *%rax
+  804cae:	a3 00 10 84 00 00 00 	movabs %eax,0x841000
+  804cb5:	00 00 
+    if (ring.sr_tail - ring.sr_head == SCRING_SIZE &&
+  804cb7:	85 c0                	test   %eax,%eax
+  804cb9:	79 94                	jns    804c4f <scring_push+0x49>
+  804cbb:	eb d6                	jmp    804c93 <scring_push+0x8d>
+
+0000000000804cbd <scring_submit>:
+
+/* Execute all queued calls.
+ * Returns 0 on success or the error of the first failed call */
+int
+scring_submit(void) {
+    int res = pending_error;
+  804cbd:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  804cc4:	00 00 00 
+  804cc7:	8b 02                	mov    (%rdx),%eax
+    pending_error = 0;
+  804cc9:	c7 02 00 00 00 00    	movl   $0x0,(%rdx)
+
+    if (res < 0)
+  804ccf:	85 c0                	test   %eax,%eax
+  804cd1:	78 14                	js     804ce7 <scring_submit+0x2a>
+        ring.sr_tail = ring.sr_head;
+    else if (ring.sr_tail != ring.sr_head)
+  804cd3:	48 ba 40 10 84 00 00 	movabs $0x841040,%rdx
+  804cda:	00 00 00 
+  804cdd:	8b 4a 04             	mov    0x4(%rdx),%ecx
+  804ce0:	8b 12                	mov    (%rdx),%edx
+  804ce2:	39 d1                	cmp    %edx,%ecx
+  804ce4:	75 11                	jne    804cf7 <scring_submit+0x3a>
+        res = ring_enter();
+
+    return res;
+}
+  804ce6:	c3                   	ret
+        ring.sr_tail = ring.sr_head;
+  804ce7:	48 ba 40 10 84 00 00 	movabs $0x841040,%rdx
+  804cee:	00 00 00 
+  804cf1:	8b 0a                	mov    (%rdx),%ecx
+  804cf3:	89 4a 04             	mov    %ecx,0x4(%rdx)
+  804cf6:	c3                   	ret
+scring_submit(void) {
+  804cf7:	55                   	push   %rbp
+  804cf8:	48 89 e5             	mov    %rsp,%rbp
+        res = ring_enter();
+  804cfb:	48 b8 b2 4b 80 00 00 	movabs $0x804bb2,%rax
+  804d02:	00 00 00 
+  804d05:	ff d0                	call   *%rax
+}
+  804d07:	5d                   	pop    %rbp
+  804d08:	c3                   	ret
+
+0000000000804d09 <scring_discard>:
+
+/* Drop all queued calls without executing them,
+ * along with an error scring_submit() would report */
+void
+scring_discard(void) {
+    pending_error = 0;
+  804d09:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  804d10:	00 00 00 
+  804d13:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    ring.sr_tail = ring.sr_head;
+  804d19:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  804d20:	00 00 00 
+  804d23:	8b 10                	mov    (%rax),%edx
+  804d25:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  804d28:	c3                   	ret
+
+0000000000804d29 <scring_alloc_region>:
+
+void
+scring_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  804d29:	55                   	push   %rbp
+  804d2a:	48 89 e5             	mov    %rsp,%rbp
+  804d2d:	48 89 f0             	mov    %rsi,%rax
+    scring_push(SYS_alloc_region, envid, (uintptr_t)va, size, perm, 0, 0);
+  804d30:	48 63 f7             	movslq %edi,%rsi
+  804d33:	48 83 ec 08          	sub    $0x8,%rsp
+  804d37:	6a 00                	push   $0x0
+  804d39:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804d3f:	4c 63 c1             	movslq %ecx,%r8
+  804d42:	48 89 d1             	mov    %rdx,%rcx
+  804d45:	48 89 c2             	mov    %rax,%rdx
+  804d48:	bf 04 00 00 00       	mov    $0x4,%edi
+  804d4d:	48 b8 06 4c 80 00 00 	movabs $0x804c06,%rax
+  804d54:	00 00 00 
+  804d57:	ff d0                	call   *%rax
+}
+  804d59:	48 83 c4 10          	add    $0x10,%rsp
+  804d5d:	c9                   	leave
+  804d5e:	c3                   	ret
+
+0000000000804d5f <scring_map_region>:
+
+void
+scring_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  804d5f:	55                   	push   %rbp
+  804d60:	48 89 e5             	mov    %rsp,%rbp
+  804d63:	48 89 f0             	mov    %rsi,%rax
+  804d66:	49 89 ca             	mov    %rcx,%r10
+    scring_push(SYS_map_region, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  804d69:	48 63 ca             	movslq %edx,%rcx
+  804d6c:	48 63 f7             	movslq %edi,%rsi
+  804d6f:	48 83 ec 08          	sub    $0x8,%rsp
+  804d73:	4d 63 c9             	movslq %r9d,%r9
+  804d76:	41 51                	push   %r9
+  804d78:	4d 89 c1             	mov    %r8,%r9
+  804d7b:	4d 89 d0             	mov    %r10,%r8
+  804d7e:	48 89 c2             	mov    %rax,%rdx
+  804d81:	bf 05 00 00 00       	mov    $0x5,%edi
+  804d86:	48 b8 06 4c 80 00 00 	movabs $0x804c06,%rax
+  804d8d:	00 00 00 
+  804d90:	ff d0                	call   *%rax
+}
+  804d92:	48 83 c4 10          	add    $0x10,%rsp
+  804d96:	c9                   	leave
+  804d97:	c3                   	ret
+
+0000000000804d98 <scring_unmap_region>:
+
+void
+scring_unmap_region(envid_t envid, void *va, size_t size) {
+  804d98:	55                   	push   %rbp
+  804d99:	48 89 e5             	mov    %rsp,%rbp
+  804d9c:	48 89 f0             	mov    %rsi,%rax
+  804d9f:	48 89 d1             	mov    %rdx,%rcx
+    scring_push(SYS_unmap_region, envid, (uintptr_t)va, size, 0, 0, 0);
+  804da2:	48 63 f7             	movslq %edi,%rsi
+  804da5:	48 83 ec 08          	sub    $0x8,%rsp
+  804da9:	6a 00                	push   $0x0
+  804dab:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804db1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804db7:	48 89 c2             	mov    %rax,%rdx
+  804dba:	bf 06 00 00 00       	mov    $0x6,%edi
+  804dbf:	48 b8 06 4c 80 00 00 	movabs $0x804c06,%rax
+  804dc6:	00 00 00 
+  804dc9:	ff d0                	call   *%rax
+}
+  804dcb:	48 83 c4 10          	add    $0x10,%rsp
+  804dcf:	c9                   	leave
+  804dd0:	c3                   	ret
+
+0000000000804dd1 <scring_env_set_status>:
+
+void
+scring_env_set_status(envid_t envid, int status) {
+  804dd1:	55                   	push   %rbp
+  804dd2:	48 89 e5             	mov    %rsp,%rbp
+    scring_push(SYS_env_set_status, envid, status, 0, 0, 0, 0);
+  804dd5:	48 63 d6             	movslq %esi,%rdx
+  804dd8:	48 63 f7             	movslq %edi,%rsi
+  804ddb:	48 83 ec 08          	sub    $0x8,%rsp
+  804ddf:	6a 00                	push   $0x0
+  804de1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804de7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804ded:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804df2:	bf 09 00 00 00       	mov    $0x9,%edi
+  804df7:	48 b8 06 4c 80 00 00 	movabs $0x804c06,%rax
+  804dfe:	00 00 00 
+  804e01:	ff d0                	call   *%rax
+}
+  804e03:	48 83 c4 10          	add    $0x10,%rsp
+  804e07:	c9                   	leave
+  804e08:	c3                   	ret
+
+0000000000804e09 <scring_env_set_trapframe>:
+
+void
+scring_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  804e09:	55                   	push   %rbp
+  804e0a:	48 89 e5             	mov    %rsp,%rbp
+  804e0d:	48 89 f2             	mov    %rsi,%rdx
+    scring_push(SYS_env_set_trapframe, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  804e10:	48 63 f7             	movslq %edi,%rsi
+  804e13:	48 83 ec 08          	sub    $0x8,%rsp
+  804e17:	6a 00                	push   $0x0
+  804e19:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804e1f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804e25:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804e2a:	bf 0a 00 00 00       	mov    $0xa,%edi
+  804e2f:	48 b8 06 4c 80 00 00 	movabs $0x804c06,%rax
+  804e36:	00 00 00 
+  804e39:	ff d0                	call   *%rax
+}
+  804e3b:	48 83 c4 10          	add    $0x10,%rsp
+  804e3f:	c9                   	leave
+  804e40:	c3                   	ret
+
+0000000000804e41 <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  804e41:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  804e47:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  804e4e:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  804e55:	c3                   	ret
+
+0000000000804e56 <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  804e56:	8b 47 40             	mov    0x40(%rdi),%eax
+  804e59:	8b 17                	mov    (%rdi),%edx
+  804e5b:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  804e5d:	83 f8 0f             	cmp    $0xf,%eax
+  804e60:	77 13                	ja     804e75 <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  804e62:	8b 47 40             	mov    0x40(%rdi),%eax
+  804e65:	83 e0 0f             	and    $0xf,%eax
+  804e68:	48 c1 e0 09          	shl    $0x9,%rax
+  804e6c:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  804e73:	00 
+  804e74:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  804e75:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804e7a:	c3                   	ret
+
+0000000000804e7b <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  804e7b:	8b 47 40             	mov    0x40(%rdi),%eax
+  804e7e:	83 c0 01             	add    $0x1,%eax
+  804e81:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  804e84:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  804e8a:	8b 57 04             	mov    0x4(%rdi),%edx
+  804e8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e92:	85 d2                	test   %edx,%edx
+  804e94:	75 04                	jne    804e9a <chan_publish+0x1f>
+  804e96:	83 e0 01             	and    $0x1,%eax
+}
+  804e99:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  804e9a:	87 47 04             	xchg   %eax,0x4(%rdi)
+  804e9d:	85 c0                	test   %eax,%eax
+  804e9f:	0f 95 c0             	setne  %al
+  804ea2:	0f b6 c0             	movzbl %al,%eax
+  804ea5:	eb ef                	jmp    804e96 <chan_publish+0x1b>
+
+0000000000804ea7 <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  804ea7:	8b 47 40             	mov    0x40(%rdi),%eax
+  804eaa:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  804eac:	29 d0                	sub    %edx,%eax
+  804eae:	83 e8 01             	sub    $0x1,%eax
+  804eb1:	83 f8 0f             	cmp    $0xf,%eax
+  804eb4:	77 12                	ja     804ec8 <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  804eb6:	8b 07                	mov    (%rdi),%eax
+  804eb8:	83 e0 0f             	and    $0xf,%eax
+  804ebb:	48 c1 e0 09          	shl    $0x9,%rax
+  804ebf:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  804ec6:	00 
+  804ec7:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  804ec8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804ecd:	c3                   	ret
+
+0000000000804ece <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  804ece:	8b 07                	mov    (%rdi),%eax
+  804ed0:	83 c0 01             	add    $0x1,%eax
+  804ed3:	89 07                	mov    %eax,(%rdi)
+}
+  804ed5:	c3                   	ret
+
+0000000000804ed6 <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  804ed6:	55                   	push   %rbp
+  804ed7:	48 89 e5             	mov    %rsp,%rbp
+  804eda:	53                   	push   %rbx
+  804edb:	48 83 ec 08          	sub    $0x8,%rsp
+  804edf:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  804ee2:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  804ee9:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  804eef:	48 b8 a7 4e 80 00 00 	movabs $0x804ea7,%rax
+  804ef6:	00 00 00 
+  804ef9:	ff d0                	call   *%rax
+  804efb:	48 85 c0             	test   %rax,%rax
+  804efe:	74 12                	je     804f12 <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  804f00:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  804f07:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804f0c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804f10:	c9                   	leave
+  804f11:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  804f12:	b8 01 00 00 00       	mov    $0x1,%eax
+  804f17:	eb f3                	jmp    804f0c <chan_arm+0x36>
+
+0000000000804f19 <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  804f19:	55                   	push   %rbp
+  804f1a:	48 89 e5             	mov    %rsp,%rbp
+  804f1d:	41 56                	push   %r14
+  804f1f:	41 55                	push   %r13
+  804f21:	41 54                	push   %r12
+  804f23:	53                   	push   %rbx
+  804f24:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  804f27:	49 bc d6 4e 80 00 00 	movabs $0x804ed6,%r12
+  804f2e:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  804f31:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  804f35:	49 bd 8f 16 80 00 00 	movabs $0x80168f,%r13
+  804f3c:	00 00 00 
+    while (chan_arm(r))
+  804f3f:	eb 0d                	jmp    804f4e <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  804f41:	8b 33                	mov    (%rbx),%esi
+  804f43:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f48:	4c 89 f7             	mov    %r14,%rdi
+  804f4b:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  804f4e:	48 89 df             	mov    %rbx,%rdi
+  804f51:	41 ff d4             	call   *%r12
+  804f54:	84 c0                	test   %al,%al
+  804f56:	75 e9                	jne    804f41 <chan_wait+0x28>
+}
+  804f58:	5b                   	pop    %rbx
+  804f59:	41 5c                	pop    %r12
+  804f5b:	41 5d                	pop    %r13
+  804f5d:	41 5e                	pop    %r14
+  804f5f:	5d                   	pop    %rbp
+  804f60:	c3                   	ret
+
+0000000000804f61 <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  804f61:	55                   	push   %rbp
+  804f62:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  804f65:	48 83 c7 40          	add    $0x40,%rdi
+  804f69:	be 01 00 00 00       	mov    $0x1,%esi
+  804f6e:	48 b8 ad 16 80 00 00 	movabs $0x8016ad,%rax
+  804f75:	00 00 00 
+  804f78:	ff d0                	call   *%rax
+}
+  804f7a:	5d                   	pop    %rbp
+  804f7b:	c3                   	ret
+
+0000000000804f7c <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804f7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f81:	c3                   	ret
+
+0000000000804f82 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804f82:	55                   	push   %rbp
+  804f83:	48 89 e5             	mov    %rsp,%rbp
+  804f86:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804f89:	48 be e2 5e 80 00 00 	movabs $0x805ee2,%rsi
+  804f90:	00 00 00 
+  804f93:	48 b8 c2 0d 80 00 00 	movabs $0x800dc2,%rax
+  804f9a:	00 00 00 
+  804f9d:	ff d0                	call   *%rax
+    return 0;
+}
+  804f9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804fa4:	5d                   	pop    %rbp
+  804fa5:	c3                   	ret
+
+0000000000804fa6 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804fa6:	55                   	push   %rbp
+  804fa7:	48 89 e5             	mov    %rsp,%rbp
+  804faa:	41 57                	push   %r15
+  804fac:	41 56                	push   %r14
+  804fae:	41 55                	push   %r13
+  804fb0:	41 54                	push   %r12
+  804fb2:	53                   	push   %rbx
+  804fb3:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  804fba:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  804fc1:	48 85 d2             	test   %rdx,%rdx
+  804fc4:	74 7a                	je     805040 <devcons_write+0x9a>
+  804fc6:	49 89 d6             	mov    %rdx,%r14
+  804fc9:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804fcf:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  804fd4:	49 bf bc 0f 80 00 00 	movabs $0x800fbc,%r15
+  804fdb:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804fde:	4c 89 f3             	mov    %r14,%rbx
+  804fe1:	48 29 f3             	sub    %rsi,%rbx
+  804fe4:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804fe9:	48 39 c3             	cmp    %rax,%rbx
+  804fec:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804ff0:	4c 63 eb             	movslq %ebx,%r13
+  804ff3:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804ffa:	48 01 c6             	add    %rax,%rsi
+  804ffd:	4c 89 ea             	mov    %r13,%rdx
+  805000:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  805007:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80500a:	4c 89 ee             	mov    %r13,%rsi
+  80500d:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  805014:	48 b8 e9 11 80 00 00 	movabs $0x8011e9,%rax
+  80501b:	00 00 00 
+  80501e:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  805020:	41 01 dc             	add    %ebx,%r12d
+  805023:	49 63 f4             	movslq %r12d,%rsi
+  805026:	4c 39 f6             	cmp    %r14,%rsi
+  805029:	72 b3                	jb     804fde <devcons_write+0x38>
+    return res;
+  80502b:	49 63 c4             	movslq %r12d,%rax
+}
+  80502e:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  805035:	5b                   	pop    %rbx
+  805036:	41 5c                	pop    %r12
+  805038:	41 5d                	pop    %r13
+  80503a:	41 5e                	pop    %r14
+  80503c:	41 5f                	pop    %r15
+  80503e:	5d                   	pop    %rbp
+  80503f:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  805040:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  805046:	eb e3                	jmp    80502b <devcons_write+0x85>
+
+0000000000805048 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805048:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80504b:	ba 00 00 00 00       	mov    $0x0,%edx
+  805050:	48 85 c0             	test   %rax,%rax
+  805053:	74 55                	je     8050aa <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805055:	55                   	push   %rbp
+  805056:	48 89 e5             	mov    %rsp,%rbp
+  805059:	41 55                	push   %r13
+  80505b:	41 54                	push   %r12
+  80505d:	53                   	push   %rbx
+  80505e:	48 83 ec 08          	sub    $0x8,%rsp
+  805062:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  805065:	48 bb 08 12 80 00 00 	movabs $0x801208,%rbx
+  80506c:	00 00 00 
+  80506f:	49 bc bd 12 80 00 00 	movabs $0x8012bd,%r12
+  805076:	00 00 00 
+  805079:	eb 03                	jmp    80507e <devcons_read+0x36>
+  80507b:	41 ff d4             	call   *%r12
+  80507e:	ff d3                	call   *%rbx
+  805080:	85 c0                	test   %eax,%eax
+  805082:	74 f7                	je     80507b <devcons_read+0x33>
+    if (c < 0) return c;
+  805084:	48 63 d0             	movslq %eax,%rdx
+  805087:	78 13                	js     80509c <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  805089:	ba 00 00 00 00       	mov    $0x0,%edx
+  80508e:	83 f8 04             	cmp    $0x4,%eax
+  805091:	74 09                	je     80509c <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  805093:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  805097:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  80509c:	48 89 d0             	mov    %rdx,%rax
+  80509f:	48 83 c4 08          	add    $0x8,%rsp
+  8050a3:	5b                   	pop    %rbx
+  8050a4:	41 5c                	pop    %r12
+  8050a6:	41 5d                	pop    %r13
+  8050a8:	5d                   	pop    %rbp
+  8050a9:	c3                   	ret
+  8050aa:	48 89 d0             	mov    %rdx,%rax
+  8050ad:	c3                   	ret
+
+00000000008050ae <cputchar>:
+cputchar(int ch) {
+  8050ae:	55                   	push   %rbp
+  8050af:	48 89 e5             	mov    %rsp,%rbp
+  8050b2:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8050b6:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8050ba:	be 01 00 00 00       	mov    $0x1,%esi
+  8050bf:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8050c3:	48 b8 e9 11 80 00 00 	movabs $0x8011e9,%rax
+  8050ca:	00 00 00 
+  8050cd:	ff d0                	call   *%rax
+}
+  8050cf:	c9                   	leave
+  8050d0:	c3                   	ret
+
+00000000008050d1 <getchar>:
+getchar(void) {
+  8050d1:	55                   	push   %rbp
+  8050d2:	48 89 e5             	mov    %rsp,%rbp
+  8050d5:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8050d9:	ba 01 00 00 00       	mov    $0x1,%edx
+  8050de:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8050e2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8050e7:	48 b8 e5 1b 80 00 00 	movabs $0x801be5,%rax
+  8050ee:	00 00 00 
+  8050f1:	ff d0                	call   *%rax
+  8050f3:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8050f5:	85 c0                	test   %eax,%eax
+  8050f7:	78 06                	js     8050ff <getchar+0x2e>
+  8050f9:	74 08                	je     805103 <getchar+0x32>
+  8050fb:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8050ff:	89 d0                	mov    %edx,%eax
+  805101:	c9                   	leave
+  805102:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  805103:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  805108:	eb f5                	jmp    8050ff <getchar+0x2e>
+
+000000000080510a <iscons>:
+iscons(int fdnum) {
+  80510a:	55                   	push   %rbp
+  80510b:	48 89 e5             	mov    %rsp,%rbp
+  80510e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  805112:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  805116:	48 b8 02 19 80 00 00 	movabs $0x801902,%rax
+  80511d:	00 00 00 
+  805120:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  805122:	85 c0                	test   %eax,%eax
+  805124:	78 18                	js     80513e <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  805126:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80512a:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  805131:	00 00 00 
+  805134:	8b 00                	mov    (%rax),%eax
+  805136:	39 02                	cmp    %eax,(%rdx)
+  805138:	0f 94 c0             	sete   %al
+  80513b:	0f b6 c0             	movzbl %al,%eax
+}
+  80513e:	c9                   	leave
+  80513f:	c3                   	ret
+
+0000000000805140 <opencons>:
+opencons(void) {
+  805140:	55                   	push   %rbp
+  805141:	48 89 e5             	mov    %rsp,%rbp
+  805144:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  805148:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80514c:	48 b8 a2 18 80 00 00 	movabs $0x8018a2,%rax
+  805153:	00 00 00 
+  805156:	ff d0                	call   *%rax
+  805158:	85 c0                	test   %eax,%eax
+  80515a:	78 49                	js     8051a5 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80515c:	b9 46 00 00 00       	mov    $0x46,%ecx
+  805161:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805166:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80516a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80516f:	48 b8 21 13 80 00 00 	movabs $0x801321,%rax
+  805176:	00 00 00 
+  805179:	ff d0                	call   *%rax
+  80517b:	85 c0                	test   %eax,%eax
+  80517d:	78 26                	js     8051a5 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80517f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805183:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  80518a:	00 00 
+  80518c:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80518e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  805192:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  805199:	48 b8 74 18 80 00 00 	movabs $0x801874,%rax
+  8051a0:	00 00 00 
+  8051a3:	ff d0                	call   *%rax
+}
+  8051a5:	c9                   	leave
+  8051a6:	c3                   	ret
+
+00000000008051a7 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  8051a7:	55                   	push   %rbp
+  8051a8:	48 89 e5             	mov    %rsp,%rbp
+  8051ab:	41 56                	push   %r14
+  8051ad:	41 55                	push   %r13
+  8051af:	41 54                	push   %r12
+  8051b1:	53                   	push   %rbx
+  8051b2:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8051b5:	48 b8 a8 18 84 00 00 	movabs $0x8418a8,%rax
+  8051bc:	00 00 00 
+  8051bf:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8051c3:	74 27                	je     8051ec <_handle_vectored_pagefault+0x45>
+  8051c5:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  8051ca:	49 bd 60 18 84 00 00 	movabs $0x841860,%r13
+  8051d1:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8051d4:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  8051d7:	4c 89 e7             	mov    %r12,%rdi
+  8051da:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  8051df:	84 c0                	test   %al,%al
+  8051e1:	75 45                	jne    805228 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8051e3:	48 83 c3 01          	add    $0x1,%rbx
+  8051e7:	49 3b 1e             	cmp    (%r14),%rbx
+  8051ea:	72 eb                	jb     8051d7 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  8051ec:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  8051f3:	00 
+  8051f4:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  8051f9:	4d 8b 04 24          	mov    (%r12),%r8
+  8051fd:	48 ba f0 5e 80 00 00 	movabs $0x805ef0,%rdx
+  805204:	00 00 00 
+  805207:	be 1d 00 00 00       	mov    $0x1d,%esi
+  80520c:	48 bf 20 5f 80 00 00 	movabs $0x805f20,%rdi
+  805213:	00 00 00 
+  805216:	b8 00 00 00 00       	mov    $0x0,%eax
+  80521b:	49 ba 4d 03 80 00 00 	movabs $0x80034d,%r10
+  805222:	00 00 00 
+  805225:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  805228:	5b                   	pop    %rbx
+  805229:	41 5c                	pop    %r12
+  80522b:	41 5d                	pop    %r13
+  80522d:	41 5e                	pop    %r14
+  80522f:	5d                   	pop    %rbp
+  805230:	c3                   	ret
+
+0000000000805231 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  805231:	55                   	push   %rbp
+  805232:	48 89 e5             	mov    %rsp,%rbp
+  805235:	53                   	push   %rbx
+  805236:	48 83 ec 08          	sub    $0x8,%rsp
+  80523a:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  80523d:	48 b8 a0 18 84 00 00 	movabs $0x8418a0,%rax
+  805244:	00 00 00 
+  805247:	80 38 00             	cmpb   $0x0,(%rax)
+  80524a:	0f 84 84 00 00 00    	je     8052d4 <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805250:	48 b8 a8 18 84 00 00 	movabs $0x8418a8,%rax
+  805257:	00 00 00 
+  80525a:	48 8b 10             	mov    (%rax),%rdx
+  80525d:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  805262:	48 b9 60 18 84 00 00 	movabs $0x841860,%rcx
+  805269:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80526c:	48 85 d2             	test   %rdx,%rdx
+  80526f:	74 19                	je     80528a <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  805271:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  805275:	0f 84 e8 00 00 00    	je     805363 <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80527b:	48 83 c0 01          	add    $0x1,%rax
+  80527f:	48 39 d0             	cmp    %rdx,%rax
+  805282:	75 ed                	jne    805271 <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  805284:	48 83 fa 08          	cmp    $0x8,%rdx
+  805288:	74 1c                	je     8052a6 <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  80528a:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80528e:	48 a3 a8 18 84 00 00 	movabs %rax,0x8418a8
+  805295:	00 00 00 
+  805298:	48 b8 60 18 84 00 00 	movabs $0x841860,%rax
+  80529f:	00 00 00 
+  8052a2:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  8052a6:	48 b8 94 12 80 00 00 	movabs $0x801294,%rax
+  8052ad:	00 00 00 
+  8052b0:	ff d0                	call   *%rax
+  8052b2:	89 c7                	mov    %eax,%edi
+  8052b4:	48 be 29 54 80 00 00 	movabs $0x805429,%rsi
+  8052bb:	00 00 00 
+  8052be:	48 b8 df 14 80 00 00 	movabs $0x8014df,%rax
+  8052c5:	00 00 00 
+  8052c8:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8052ca:	85 c0                	test   %eax,%eax
+  8052cc:	78 68                	js     805336 <add_pgfault_handler+0x105>
+    return res;
+}
+  8052ce:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8052d2:	c9                   	leave
+  8052d3:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  8052d4:	48 b8 94 12 80 00 00 	movabs $0x801294,%rax
+  8052db:	00 00 00 
+  8052de:	ff d0                	call   *%rax
+  8052e0:	89 c7                	mov    %eax,%edi
+  8052e2:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8052e7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8052ec:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  8052f3:	00 00 00 
+  8052f6:	48 b8 21 13 80 00 00 	movabs $0x801321,%rax
+  8052fd:	00 00 00 
+  805300:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  805302:	48 ba a8 18 84 00 00 	movabs $0x8418a8,%rdx
+  805309:	00 00 00 
+  80530c:	48 8b 02             	mov    (%rdx),%rax
+  80530f:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  805313:	48 89 0a             	mov    %rcx,(%rdx)
+  805316:	48 ba 60 18 84 00 00 	movabs $0x841860,%rdx
+  80531d:	00 00 00 
+  805320:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  805324:	48 b8 a0 18 84 00 00 	movabs $0x8418a0,%rax
+  80532b:	00 00 00 
+  80532e:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  805331:	e9 70 ff ff ff       	jmp    8052a6 <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805336:	89 c1                	mov    %eax,%ecx
+  805338:	48 ba 2e 5f 80 00 00 	movabs $0x805f2e,%rdx
+  80533f:	00 00 00 
+  805342:	be 3d 00 00 00       	mov    $0x3d,%esi
+  805347:	48 bf 20 5f 80 00 00 	movabs $0x805f20,%rdi
+  80534e:	00 00 00 
+  805351:	b8 00 00 00 00       	mov    $0x0,%eax
+  805356:	49 b8 4d 03 80 00 00 	movabs $0x80034d,%r8
+  80535d:	00 00 00 
+  805360:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  805363:	b8 00 00 00 00       	mov    $0x0,%eax
+  805368:	e9 61 ff ff ff       	jmp    8052ce <add_pgfault_handler+0x9d>
+
+000000000080536d <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  80536d:	55                   	push   %rbp
+  80536e:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  805371:	48 b8 a0 18 84 00 00 	movabs $0x8418a0,%rax
+  805378:	00 00 00 
+  80537b:	80 38 00             	cmpb   $0x0,(%rax)
+  80537e:	74 33                	je     8053b3 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805380:	48 a1 a8 18 84 00 00 	movabs 0x8418a8,%rax
+  805387:	00 00 00 
+  80538a:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  80538f:	48 ba 60 18 84 00 00 	movabs $0x841860,%rdx
+  805396:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805399:	48 85 c0             	test   %rax,%rax
+  80539c:	0f 84 85 00 00 00    	je     805427 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  8053a2:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  8053a6:	74 40                	je     8053e8 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8053a8:	48 83 c1 01          	add    $0x1,%rcx
+  8053ac:	48 39 c1             	cmp    %rax,%rcx
+  8053af:	75 f1                	jne    8053a2 <remove_pgfault_handler+0x35>
+  8053b1:	eb 74                	jmp    805427 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  8053b3:	48 b9 46 5f 80 00 00 	movabs $0x805f46,%rcx
+  8053ba:	00 00 00 
+  8053bd:	48 ba 51 5e 80 00 00 	movabs $0x805e51,%rdx
+  8053c4:	00 00 00 
+  8053c7:	be 43 00 00 00       	mov    $0x43,%esi
+  8053cc:	48 bf 20 5f 80 00 00 	movabs $0x805f20,%rdi
+  8053d3:	00 00 00 
+  8053d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8053db:	49 b8 4d 03 80 00 00 	movabs $0x80034d,%r8
+  8053e2:	00 00 00 
+  8053e5:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  8053e8:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  8053ef:	00 
+  8053f0:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8053f4:	48 29 ca             	sub    %rcx,%rdx
+  8053f7:	48 b8 60 18 84 00 00 	movabs $0x841860,%rax
+  8053fe:	00 00 00 
+  805401:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  805405:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  80540a:	48 89 ce             	mov    %rcx,%rsi
+  80540d:	48 b8 bc 0f 80 00 00 	movabs $0x800fbc,%rax
+  805414:	00 00 00 
+  805417:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  805419:	48 b8 a8 18 84 00 00 	movabs $0x8418a8,%rax
+  805420:	00 00 00 
+  805423:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  805427:	5d                   	pop    %rbp
+  805428:	c3                   	ret
+
+0000000000805429 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  805429:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  80542c:	48 b8 a7 51 80 00 00 	movabs $0x8051a7,%rax
+  805433:	00 00 00 
+    call *%rax
+  805436:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  805438:	41 5f                	pop    %r15
+	popq %r15
+  80543a:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  80543c:	41 5f                	pop    %r15
+	popq %r14
+  80543e:	41 5e                	pop    %r14
+	popq %r13
+  805440:	41 5d                	pop    %r13
+	popq %r12
+  805442:	41 5c                	pop    %r12
+	popq %r11
+  805444:	41 5b                	pop    %r11
+	popq %r10
+  805446:	41 5a                	pop    %r10
+	popq %r9
+  805448:	41 59                	pop    %r9
+	popq %r8
+  80544a:	41 58                	pop    %r8
+	popq %rsi
+  80544c:	5e                   	pop    %rsi
+	popq %rdi
+  80544d:	5f                   	pop    %rdi
+	popq %rbp
+  80544e:	5d                   	pop    %rbp
+	popq %rdx
+  80544f:	5a                   	pop    %rdx
+	popq %rcx
+  805450:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  805451:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  805456:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  80545b:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  80545f:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  805462:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  805467:	5b                   	pop    %rbx
+	popq %rax
+  805468:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  805469:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  80546d:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  80546e:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  805473:	c3                   	ret
+
+0000000000805474 <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  805474:	55                   	push   %rbp
+  805475:	48 89 e5             	mov    %rsp,%rbp
+  805478:	41 55                	push   %r13
+  80547a:	41 54                	push   %r12
+  80547c:	53                   	push   %rbx
+  80547d:	48 83 ec 08          	sub    $0x8,%rsp
+  805481:	49 89 fd             	mov    %rdi,%r13
+  805484:	48 89 f7             	mov    %rsi,%rdi
+  805487:	48 89 d3             	mov    %rdx,%rbx
+  80548a:	49 89 cc             	mov    %rcx,%r12
+  80548d:	4c 89 c2             	mov    %r8,%rdx
+  805490:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  805493:	48 85 f6             	test   %rsi,%rsi
+  805496:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80549d:	00 00 00 
+  8054a0:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  8054a4:	be 00 10 00 00       	mov    $0x1000,%esi
+  8054a9:	48 85 db             	test   %rbx,%rbx
+  8054ac:	74 03                	je     8054b1 <ipc_recv_futex+0x3d>
+  8054ae:	48 8b 33             	mov    (%rbx),%rsi
+  8054b1:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  8054b5:	48 b8 6b 15 80 00 00 	movabs $0x80156b,%rax
+  8054bc:	00 00 00 
+  8054bf:	ff d0                	call   *%rax
+    if (res < 0) {
+  8054c1:	85 c0                	test   %eax,%eax
+  8054c3:	78 75                	js     80553a <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  8054c5:	4d 85 ed             	test   %r13,%r13
+  8054c8:	74 14                	je     8054de <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  8054ca:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8054d1:	00 00 00 
+  8054d4:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  8054da:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  8054de:	4d 85 e4             	test   %r12,%r12
+  8054e1:	74 14                	je     8054f7 <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  8054e3:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8054ea:	00 00 00 
+  8054ed:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  8054f3:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  8054f7:	48 85 db             	test   %rbx,%rbx
+  8054fa:	74 23                	je     80551f <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8054fc:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  805503:	00 00 00 
+  805506:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  80550c:	ba 00 00 00 00       	mov    $0x0,%edx
+  805511:	85 c9                	test   %ecx,%ecx
+  805513:	74 07                	je     80551c <ipc_recv_futex+0xa8>
+  805515:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  80551c:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  80551f:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  805526:	00 00 00 
+  805529:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  80552f:	48 83 c4 08          	add    $0x8,%rsp
+  805533:	5b                   	pop    %rbx
+  805534:	41 5c                	pop    %r12
+  805536:	41 5d                	pop    %r13
+  805538:	5d                   	pop    %rbp
+  805539:	c3                   	ret
+        if (from_env_store != NULL) {
+  80553a:	4d 85 ed             	test   %r13,%r13
+  80553d:	74 08                	je     805547 <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  80553f:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  805546:	00 
+        if (perm_store != NULL) {
+  805547:	4d 85 e4             	test   %r12,%r12
+  80554a:	74 08                	je     805554 <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  80554c:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  805553:	00 
+        if (size != NULL) {
+  805554:	48 85 db             	test   %rbx,%rbx
+  805557:	74 d6                	je     80552f <ipc_recv_futex+0xbb>
+            *size = 0;
+  805559:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  805560:	eb cd                	jmp    80552f <ipc_recv_futex+0xbb>
+
+0000000000805562 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  805562:	55                   	push   %rbp
+  805563:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  805566:	48 83 ec 08          	sub    $0x8,%rsp
+  80556a:	6a 00                	push   $0x0
+  80556c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  805572:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  805578:	48 b8 74 54 80 00 00 	movabs $0x805474,%rax
+  80557f:	00 00 00 
+  805582:	ff d0                	call   *%rax
+}
+  805584:	c9                   	leave
+  805585:	c3                   	ret
+
+0000000000805586 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  805586:	55                   	push   %rbp
+  805587:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80558a:	48 85 d2             	test   %rdx,%rdx
+  80558d:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805594:	00 00 00 
+  805597:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  80559b:	89 f6                	mov    %esi,%esi
+  80559d:	48 b8 54 15 80 00 00 	movabs $0x801554,%rax
+  8055a4:	00 00 00 
+  8055a7:	ff d0                	call   *%rax
+    if (res < 0) {
+  8055a9:	85 c0                	test   %eax,%eax
+  8055ab:	78 02                	js     8055af <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  8055ad:	5d                   	pop    %rbp
+  8055ae:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  8055af:	89 c1                	mov    %eax,%ecx
+  8055b1:	48 ba 60 5f 80 00 00 	movabs $0x805f60,%rdx
+  8055b8:	00 00 00 
+  8055bb:	be 50 00 00 00       	mov    $0x50,%esi
+  8055c0:	48 bf 74 5f 80 00 00 	movabs $0x805f74,%rdi
+  8055c7:	00 00 00 
+  8055ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8055cf:	49 b8 4d 03 80 00 00 	movabs $0x80034d,%r8
+  8055d6:	00 00 00 
+  8055d9:	41 ff d0             	call   *%r8
+
+00000000008055dc <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8055dc:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  8055e1:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8055e8:	00 00 00 
+  8055eb:	48 89 d0             	mov    %rdx,%rax
+  8055ee:	48 c1 e0 04          	shl    $0x4,%rax
+  8055f2:	48 29 d0             	sub    %rdx,%rax
+  8055f5:	48 c1 e0 05          	shl    $0x5,%rax
+  8055f9:	48 01 c8             	add    %rcx,%rax
+  8055fc:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  805602:	39 f8                	cmp    %edi,%eax
+  805604:	74 13                	je     805619 <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  805606:	48 83 c2 01          	add    $0x1,%rdx
+  80560a:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  805611:	75 d8                	jne    8055eb <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  805613:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805618:	c3                   	ret
+            return envs[i].env_id;
+  805619:	48 89 d0             	mov    %rdx,%rax
+  80561c:	48 c1 e0 04          	shl    $0x4,%rax
+  805620:	48 29 d0             	sub    %rdx,%rax
+  805623:	48 c1 e0 05          	shl    $0x5,%rax
+  805627:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80562e:	00 00 00 
+  805631:	48 01 d0             	add    %rdx,%rax
+  805634:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80563a:	c3                   	ret
+  80563b:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000805640 <__rodata_start>:
+  805640:	72 69                	jb     8056ab <__rodata_start+0x6b>
+  805642:	67 68 74 00 77 72    	addr32 push $0x72770074
+  805648:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805649:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80564a:	67 00 73 79          	add    %dh,0x79(%ebx)
+  80564e:	73 5f                	jae    8056af <__rodata_start+0x6f>
+  805650:	70 61                	jo     8056b3 <__rodata_start+0x73>
+  805652:	67 65 5f             	addr32 gs pop %rdi
+  805655:	61                   	(bad)
+  805656:	6c                   	insb   (%dx),%es:(%rdi)
+  805657:	6c                   	insb   (%dx),%es:(%rdi)
+  805658:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805659:	63 3a                	movsxd (%rdx),%edi
+  80565b:	20 25 69 00 75 73    	and    %ah,0x73750069(%rip)        # 73f556ca <__bss_end+0x737136ca>
+  805661:	65 72 2f             	gs jb  805693 <__rodata_start+0x53>
+  805664:	74 65                	je     8056cb <__rodata_start+0x8b>
+  805666:	73 74                	jae    8056dc <__rodata_start+0x9c>
+  805668:	70 74                	jo     8056de <__rodata_start+0x9e>
+  80566a:	65 73 68             	gs jae 8056d5 <__rodata_start+0x95>
+  80566d:	61                   	(bad)
+  80566e:	72 65                	jb     8056d5 <__rodata_start+0x95>
+  805670:	2e 63 00             	cs movsxd (%rax),%eax
+  805673:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  805675:	72 6b                	jb     8056e2 <__rodata_start+0xa2>
+  805677:	3a 20                	cmp    (%rax),%ah
+  805679:	25 69 00 66 6f       	and    $0x6f660069,%eax
+  80567e:	72 6b                	jb     8056eb <__rodata_start+0xab>
+  805680:	20 68 61             	and    %ch,0x61(%rax)
+  805683:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805684:	64 6c                	fs insb (%dx),%es:(%rdi)
+  805686:	65 73 20             	gs jae 8056a9 <__rodata_start+0x69>
+  805689:	50                   	push   %rax
+  80568a:	54                   	push   %rsp
+  80568b:	45 5f                	rex.RB pop %r15
+  80568d:	53                   	push   %rbx
+  80568e:	48                   	rex.W
+  80568f:	41 52                	push   %r10
+  805691:	45 20 25 73 0a 00 61 	and    %r12b,0x61000a73(%rip)        # 6180610b <__bss_end+0x60fc410b>
+  805698:	72 67                	jb     805701 <__rodata_start+0xc1>
+  80569a:	00 2f                	add    %ch,(%rdi)
+  80569c:	74 65                	je     805703 <__rodata_start+0xc3>
+  80569e:	73 74                	jae    805714 <__rodata_start+0xd4>
+  8056a0:	70 74                	jo     805716 <__rodata_start+0xd6>
+  8056a2:	65 73 68             	gs jae 80570d <__rodata_start+0xcd>
+  8056a5:	61                   	(bad)
+  8056a6:	72 65                	jb     80570d <__rodata_start+0xcd>
+  8056a8:	00 73 70             	add    %dh,0x70(%rbx)
+  8056ab:	61                   	(bad)
+  8056ac:	77 6e                	ja     80571c <__rodata_start+0xdc>
+  8056ae:	3a 20                	cmp    (%rax),%ah
+  8056b0:	25 69 00 73 70       	and    $0x70730069,%eax
+  8056b5:	61                   	(bad)
+  8056b6:	77 6e                	ja     805726 <__rodata_start+0xe6>
+  8056b8:	20 68 61             	and    %ch,0x61(%rax)
+  8056bb:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8056bc:	64 6c                	fs insb (%dx),%es:(%rdi)
+  8056be:	65 73 20             	gs jae 8056e1 <__rodata_start+0xa1>
+  8056c1:	50                   	push   %rax
+  8056c2:	54                   	push   %rsp
+  8056c3:	45 5f                	rex.RB pop %r15
+  8056c5:	53                   	push   %rbx
+  8056c6:	48                   	rex.W
+  8056c7:	41 52                	push   %r10
+  8056c9:	45 20 25 73 0a 00 67 	and    %r12b,0x67000a73(%rip)        # 67806143 <__bss_end+0x66fc4143>
+  8056d0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8056d1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8056d2:	64 62                	fs (bad)
+  8056d4:	79 65                	jns    80573b <__rodata_start+0xfb>
+  8056d6:	2c 20                	sub    $0x20,%al
+  8056d8:	77 6f                	ja     805749 <__rodata_start+0x109>
+  8056da:	72 6c                	jb     805748 <__rodata_start+0x108>
+  8056dc:	64 0a 00             	or     %fs:(%rax),%al
+  8056df:	68 65 6c 6c 6f       	push   $0x6f6c6c65
+  8056e4:	2c 20                	sub    $0x20,%al
+  8056e6:	77 6f                	ja     805757 <__rodata_start+0x117>
+  8056e8:	72 6c                	jb     805756 <__rodata_start+0x116>
+  8056ea:	64 0a 00             	or     %fs:(%rax),%al
+  8056ed:	3c 75                	cmp    $0x75,%al
+  8056ef:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8056f0:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8056f4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8056f5:	3e 00 90 5b 25 30 38 	ds add %dl,0x3830255b(%rax)
+  8056fc:	78 5d                	js     80575b <__rodata_start+0x11b>
+  8056fe:	20 75 73             	and    %dh,0x73(%rbp)
+  805701:	65 72 20             	gs jb  805724 <__rodata_start+0xe4>
+  805704:	70 61                	jo     805767 <__rodata_start+0x127>
+  805706:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805707:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  80570e:	73 20                	jae    805730 <__rodata_start+0xf0>
+  805710:	61                   	(bad)
+  805711:	74 20                	je     805733 <__rodata_start+0xf3>
+  805713:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  805718:	3a 20                	cmp    (%rax),%ah
+  80571a:	00 30                	add    %dh,(%rax)
+  80571c:	31 32                	xor    %esi,(%rdx)
+  80571e:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  805725:	41                   	rex.B
+  805726:	42                   	rex.X
+  805727:	43                   	rex.XB
+  805728:	44                   	rex.R
+  805729:	45                   	rex.RB
+  80572a:	46 00 30             	rex.RX add %r14b,(%rax)
+  80572d:	31 32                	xor    %esi,(%rdx)
+  80572f:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  805736:	61                   	(bad)
+  805737:	62 63 64 65 66       	(bad)
+  80573c:	00 28                	add    %ch,(%rax)
+  80573e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80573f:	75 6c                	jne    8057ad <__rodata_start+0x16d>
+  805741:	6c                   	insb   (%dx),%es:(%rdi)
+  805742:	29 00                	sub    %eax,(%rax)
+  805744:	65 72 72             	gs jb  8057b9 <__rodata_start+0x179>
+  805747:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805748:	72 20                	jb     80576a <__rodata_start+0x12a>
+  80574a:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  80574f:	73 70                	jae    8057c1 <__rodata_start+0x181>
+  805751:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  805755:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  80575c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80575d:	72 00                	jb     80575f <__rodata_start+0x11f>
+  80575f:	62 61 64 20 65       	(bad)
+  805764:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805765:	76 69                	jbe    8057d0 <__rodata_start+0x190>
+  805767:	72 6f                	jb     8057d8 <__rodata_start+0x198>
+  805769:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80576a:	6d                   	insl   (%dx),%es:(%rdi)
+  80576b:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80576d:	74 00                	je     80576f <__rodata_start+0x12f>
+  80576f:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  805776:	20 70 61             	and    %dh,0x61(%rax)
+  805779:	72 61                	jb     8057dc <__rodata_start+0x19c>
+  80577b:	6d                   	insl   (%dx),%es:(%rdi)
+  80577c:	65 74 65             	gs je  8057e4 <__rodata_start+0x1a4>
+  80577f:	72 00                	jb     805781 <__rodata_start+0x141>
+  805781:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805782:	75 74                	jne    8057f8 <__rodata_start+0x1b8>
+  805784:	20 6f 66             	and    %ch,0x66(%rdi)
+  805787:	20 6d 65             	and    %ch,0x65(%rbp)
+  80578a:	6d                   	insl   (%dx),%es:(%rdi)
+  80578b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80578c:	72 79                	jb     805807 <__rodata_start+0x1c7>
+  80578e:	00 6f 75             	add    %ch,0x75(%rdi)
+  805791:	74 20                	je     8057b3 <__rodata_start+0x173>
+  805793:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805794:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  805798:	76 69                	jbe    805803 <__rodata_start+0x1c3>
+  80579a:	72 6f                	jb     80580b <__rodata_start+0x1cb>
+  80579c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80579d:	6d                   	insl   (%dx),%es:(%rdi)
+  80579e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8057a0:	74 73                	je     805815 <__rodata_start+0x1d5>
+  8057a2:	00 63 6f             	add    %ah,0x6f(%rbx)
+  8057a5:	72 72                	jb     805819 <__rodata_start+0x1d9>
+  8057a7:	75 70                	jne    805819 <__rodata_start+0x1d9>
+  8057a9:	74 65                	je     805810 <__rodata_start+0x1d0>
+  8057ab:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  8057b0:	75 67                	jne    805819 <__rodata_start+0x1d9>
+  8057b2:	20 69 6e             	and    %ch,0x6e(%rcx)
+  8057b5:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8057b7:	00 73 65             	add    %dh,0x65(%rbx)
+  8057ba:	67 6d                	insl   (%dx),%es:(%edi)
+  8057bc:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8057be:	74 61                	je     805821 <__rodata_start+0x1e1>
+  8057c0:	74 69                	je     80582b <__rodata_start+0x1eb>
+  8057c2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8057c3:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8057c4:	20 66 61             	and    %ah,0x61(%rsi)
+  8057c7:	75 6c                	jne    805835 <__rodata_start+0x1f5>
+  8057c9:	74 00                	je     8057cb <__rodata_start+0x18b>
+  8057cb:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8057d2:	20 45 4c             	and    %al,0x4c(%rbp)
+  8057d5:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  8057d9:	61                   	(bad)
+  8057da:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  8057df:	20 73 75             	and    %dh,0x75(%rbx)
+  8057e2:	63 68 20             	movsxd 0x20(%rax),%ebp
+  8057e5:	73 79                	jae    805860 <__rodata_start+0x220>
+  8057e7:	73 74                	jae    80585d <__rodata_start+0x21d>
+  8057e9:	65 6d                	gs insl (%dx),%es:(%rdi)
+  8057eb:	20 63 61             	and    %ah,0x61(%rbx)
+  8057ee:	6c                   	insb   (%dx),%es:(%rdi)
+  8057ef:	6c                   	insb   (%dx),%es:(%rdi)
+  8057f0:	00 65 6e             	add    %ah,0x6e(%rbp)
+  8057f3:	74 72                	je     805867 <__rodata_start+0x227>
+  8057f5:	79 20                	jns    805817 <__rodata_start+0x1d7>
+  8057f7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8057f8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8057f9:	74 20                	je     80581b <__rodata_start+0x1db>
+  8057fb:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8057fd:	75 6e                	jne    80586d <__rodata_start+0x22d>
+  8057ff:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  805803:	76 20                	jbe    805825 <__rodata_start+0x1e5>
+  805805:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  80580c:	72 65                	jb     805873 <__rodata_start+0x233>
+  80580e:	63 76 69             	movsxd 0x69(%rsi),%esi
+  805811:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805812:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  805816:	65 78 70             	gs js  805889 <__rodata_start+0x249>
+  805819:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  80581e:	20 65 6e             	and    %ah,0x6e(%rbp)
+  805821:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  805825:	20 66 69             	and    %ah,0x69(%rsi)
+  805828:	6c                   	insb   (%dx),%es:(%rdi)
+  805829:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  80582d:	20 66 72             	and    %ah,0x72(%rsi)
+  805830:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  805835:	61                   	(bad)
+  805836:	63 65 20             	movsxd 0x20(%rbp),%esp
+  805839:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80583a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80583b:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  80583f:	6b 00 74             	imul   $0x74,(%rax),%eax
+  805842:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805843:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805844:	20 6d 61             	and    %ch,0x61(%rbp)
+  805847:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805848:	79 20                	jns    80586a <__rodata_start+0x22a>
+  80584a:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  805851:	72 65                	jb     8058b8 <__rodata_start+0x278>
+  805853:	20 6f 70             	and    %ch,0x70(%rdi)
+  805856:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  805858:	00 66 69             	add    %ah,0x69(%rsi)
+  80585b:	6c                   	insb   (%dx),%es:(%rdi)
+  80585c:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  805860:	20 62 6c             	and    %ah,0x6c(%rdx)
+  805863:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805864:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  805867:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805868:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805869:	74 20                	je     80588b <__rodata_start+0x24b>
+  80586b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80586d:	75 6e                	jne    8058dd <__rodata_start+0x29d>
+  80586f:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  805873:	76 61                	jbe    8058d6 <__rodata_start+0x296>
+  805875:	6c                   	insb   (%dx),%es:(%rdi)
+  805876:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  80587d:	00 
+  80587e:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  805885:	72 65                	jb     8058ec <__rodata_start+0x2ac>
+  805887:	61                   	(bad)
+  805888:	64 79 20             	fs jns 8058ab <__rodata_start+0x26b>
+  80588b:	65 78 69             	gs js  8058f7 <__rodata_start+0x2b7>
+  80588e:	73 74                	jae    805904 <__rodata_start+0x2c4>
+  805890:	73 00                	jae    805892 <__rodata_start+0x252>
+  805892:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805893:	70 65                	jo     8058fa <__rodata_start+0x2ba>
+  805895:	72 61                	jb     8058f8 <__rodata_start+0x2b8>
+  805897:	74 69                	je     805902 <__rodata_start+0x2c2>
+  805899:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80589a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80589b:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  80589e:	74 20                	je     8058c0 <__rodata_start+0x280>
+  8058a0:	73 75                	jae    805917 <__rodata_start+0x2d7>
+  8058a2:	70 70                	jo     805914 <__rodata_start+0x2d4>
+  8058a4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8058a5:	72 74                	jb     80591b <__rodata_start+0x2db>
+  8058a7:	65 64 00 74 72 79    	gs add %dh,%fs:0x79(%rdx,%rsi,2)
+  8058ad:	20 61 67             	and    %ah,0x67(%rcx)
+  8058b0:	61                   	(bad)
+  8058b1:	69 6e 00 74 69 6d 65 	imul   $0x656d6974,0x0(%rsi),%ebp
+  8058b8:	64 20 6f 75          	and    %ch,%fs:0x75(%rdi)
+  8058bc:	74 00                	je     8058be <__rodata_start+0x27e>
+  8058be:	66 69 6c 65 20 69 73 	imul   $0x7369,0x20(%rbp,%riz,2),%bp
+  8058c5:	20 69 6e             	and    %ch,0x6e(%rcx)
+  8058c8:	20 75 73             	and    %dh,0x73(%rbp)
+  8058cb:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  8058cf:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  8058d6:	00 
+  8058d7:	66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+  8058de:	00 00 
+  8058e0:	8a 06                	mov    (%rsi),%al
+  8058e2:	80 00 00             	addb   $0x0,(%rax)
+  8058e5:	00 00                	add    %al,(%rax)
+  8058e7:	00 cb                	add    %cl,%bl
+  8058e9:	0c 80                	or     $0x80,%al
+  8058eb:	00 00                	add    %al,(%rax)
+  8058ed:	00 00                	add    %al,(%rax)
+  8058ef:	00 bb 0c 80 00 00    	add    %bh,0x800c(%rbx)
+  8058f5:	00 00                	add    %al,(%rax)
+  8058f7:	00 cb                	add    %cl,%bl
+  8058f9:	0c 80                	or     $0x80,%al
+  8058fb:	00 00                	add    %al,(%rax)
+  8058fd:	00 00                	add    %al,(%rax)
+  8058ff:	00 cb                	add    %cl,%bl
+  805901:	0c 80                	or     $0x80,%al
+  805903:	00 00                	add    %al,(%rax)
+  805905:	00 00                	add    %al,(%rax)
+  805907:	00 cb                	add    %cl,%bl
+  805909:	0c 80                	or     $0x80,%al
+  80590b:	00 00                	add    %al,(%rax)
+  80590d:	00 00                	add    %al,(%rax)
+  80590f:	00 cb                	add    %cl,%bl
+  805911:	0c 80                	or     $0x80,%al
+  805913:	00 00                	add    %al,(%rax)
+  805915:	00 00                	add    %al,(%rax)
+  805917:	00 a9 06 80 00 00    	add    %ch,0x8006(%rcx)
+  80591d:	00 00                	add    %al,(%rax)
+  80591f:	00 cb                	add    %cl,%bl
+  805921:	0c 80                	or     $0x80,%al
+  805923:	00 00                	add    %al,(%rax)
+  805925:	00 00                	add    %al,(%rax)
+  805927:	00 cb                	add    %cl,%bl
+  805929:	0c 80                	or     $0x80,%al
+  80592b:	00 00                	add    %al,(%rax)
+  80592d:	00 00                	add    %al,(%rax)
+  80592f:	00 9d 06 80 00 00    	add    %bl,0x8006(%rbp)
+  805935:	00 00                	add    %al,(%rax)
+  805937:	00 17                	add    %dl,(%rdi)
+  805939:	07                   	(bad)
+  80593a:	80 00 00             	addb   $0x0,(%rax)
+  80593d:	00 00                	add    %al,(%rax)
+  80593f:	00 cb                	add    %cl,%bl
+  805941:	0c 80                	or     $0x80,%al
+  805943:	00 00                	add    %al,(%rax)
+  805945:	00 00                	add    %al,(%rax)
+  805947:	00 9d 06 80 00 00    	add    %bl,0x8006(%rbp)
+  80594d:	00 00                	add    %al,(%rax)
+  80594f:	00 e3                	add    %ah,%bl
+  805951:	06                   	(bad)
+  805952:	80 00 00             	addb   $0x0,(%rax)
+  805955:	00 00                	add    %al,(%rax)
+  805957:	00 e3                	add    %ah,%bl
+  805959:	06                   	(bad)
+  80595a:	80 00 00             	addb   $0x0,(%rax)
+  80595d:	00 00                	add    %al,(%rax)
+  80595f:	00 e3                	add    %ah,%bl
+  805961:	06                   	(bad)
+  805962:	80 00 00             	addb   $0x0,(%rax)
+  805965:	00 00                	add    %al,(%rax)
+  805967:	00 e3                	add    %ah,%bl
+  805969:	06                   	(bad)
+  80596a:	80 00 00             	addb   $0x0,(%rax)
+  80596d:	00 00                	add    %al,(%rax)
+  80596f:	00 e3                	add    %ah,%bl
+  805971:	06                   	(bad)
+  805972:	80 00 00             	addb   $0x0,(%rax)
+  805975:	00 00                	add    %al,(%rax)
+  805977:	00 e3                	add    %ah,%bl
+  805979:	06                   	(bad)
+  80597a:	80 00 00             	addb   $0x0,(%rax)
+  80597d:	00 00                	add    %al,(%rax)
+  80597f:	00 e3                	add    %ah,%bl
+  805981:	06                   	(bad)
+  805982:	80 00 00             	addb   $0x0,(%rax)
+  805985:	00 00                	add    %al,(%rax)
+  805987:	00 e3                	add    %ah,%bl
+  805989:	06                   	(bad)
+  80598a:	80 00 00             	addb   $0x0,(%rax)
+  80598d:	00 00                	add    %al,(%rax)
+  80598f:	00 e3                	add    %ah,%bl
+  805991:	06                   	(bad)
+  805992:	80 00 00             	addb   $0x0,(%rax)
+  805995:	00 00                	add    %al,(%rax)
+  805997:	00 cb                	add    %cl,%bl
+  805999:	0c 80                	or     $0x80,%al
+  80599b:	00 00                	add    %al,(%rax)
+  80599d:	00 00                	add    %al,(%rax)
+  80599f:	00 cb                	add    %cl,%bl
+  8059a1:	0c 80                	or     $0x80,%al
+  8059a3:	00 00                	add    %al,(%rax)
+  8059a5:	00 00                	add    %al,(%rax)
+  8059a7:	00 cb                	add    %cl,%bl
+  8059a9:	0c 80                	or     $0x80,%al
+  8059ab:	00 00                	add    %al,(%rax)
+  8059ad:	00 00                	add    %al,(%rax)
+  8059af:	00 cb                	add    %cl,%bl
+  8059b1:	0c 80                	or     $0x80,%al
+  8059b3:	00 00                	add    %al,(%rax)
+  8059b5:	00 00                	add    %al,(%rax)
+  8059b7:	00 cb                	add    %cl,%bl
+  8059b9:	0c 80                	or     $0x80,%al
+  8059bb:	00 00                	add    %al,(%rax)
+  8059bd:	00 00                	add    %al,(%rax)
+  8059bf:	00 cb                	add    %cl,%bl
+  8059c1:	0c 80                	or     $0x80,%al
+  8059c3:	00 00                	add    %al,(%rax)
+  8059c5:	00 00                	add    %al,(%rax)
+  8059c7:	00 cb                	add    %cl,%bl
+  8059c9:	0c 80                	or     $0x80,%al
+  8059cb:	00 00                	add    %al,(%rax)
+  8059cd:	00 00                	add    %al,(%rax)
+  8059cf:	00 cb                	add    %cl,%bl
+  8059d1:	0c 80                	or     $0x80,%al
+  8059d3:	00 00                	add    %al,(%rax)
+  8059d5:	00 00                	add    %al,(%rax)
+  8059d7:	00 cb                	add    %cl,%bl
+  8059d9:	0c 80                	or     $0x80,%al
+  8059db:	00 00                	add    %al,(%rax)
+  8059dd:	00 00                	add    %al,(%rax)
+  8059df:	00 cb                	add    %cl,%bl
+  8059e1:	0c 80                	or     $0x80,%al
+  8059e3:	00 00                	add    %al,(%rax)
+  8059e5:	00 00                	add    %al,(%rax)
+  8059e7:	00 cb                	add    %cl,%bl
+  8059e9:	0c 80                	or     $0x80,%al
+  8059eb:	00 00                	add    %al,(%rax)
+  8059ed:	00 00                	add    %al,(%rax)
+  8059ef:	00 cb                	add    %cl,%bl
+  8059f1:	0c 80                	or     $0x80,%al
+  8059f3:	00 00                	add    %al,(%rax)
+  8059f5:	00 00                	add    %al,(%rax)
+  8059f7:	00 cb                	add    %cl,%bl
+  8059f9:	0c 80                	or     $0x80,%al
+  8059fb:	00 00                	add    %al,(%rax)
+  8059fd:	00 00                	add    %al,(%rax)
+  8059ff:	00 cb                	add    %cl,%bl
+  805a01:	0c 80                	or     $0x80,%al
+  805a03:	00 00                	add    %al,(%rax)
+  805a05:	00 00                	add    %al,(%rax)
+  805a07:	00 cb                	add    %cl,%bl
+  805a09:	0c 80                	or     $0x80,%al
+  805a0b:	00 00                	add    %al,(%rax)
+  805a0d:	00 00                	add    %al,(%rax)
+  805a0f:	00 cb                	add    %cl,%bl
+  805a11:	0c 80                	or     $0x80,%al
+  805a13:	00 00                	add    %al,(%rax)
+  805a15:	00 00                	add    %al,(%rax)
+  805a17:	00 cb                	add    %cl,%bl
+  805a19:	0c 80                	or     $0x80,%al
+  805a1b:	00 00                	add    %al,(%rax)
+  805a1d:	00 00                	add    %al,(%rax)
+  805a1f:	00 cb                	add    %cl,%bl
+  805a21:	0c 80                	or     $0x80,%al
+  805a23:	00 00                	add    %al,(%rax)
+  805a25:	00 00                	add    %al,(%rax)
+  805a27:	00 cb                	add    %cl,%bl
+  805a29:	0c 80                	or     $0x80,%al
+  805a2b:	00 00                	add    %al,(%rax)
+  805a2d:	00 00                	add    %al,(%rax)
+  805a2f:	00 cb                	add    %cl,%bl
+  805a31:	0c 80                	or     $0x80,%al
+  805a33:	00 00                	add    %al,(%rax)
+  805a35:	00 00                	add    %al,(%rax)
+  805a37:	00 cb                	add    %cl,%bl
+  805a39:	0c 80                	or     $0x80,%al
+  805a3b:	00 00                	add    %al,(%rax)
+  805a3d:	00 00                	add    %al,(%rax)
+  805a3f:	00 cb                	add    %cl,%bl
+  805a41:	0c 80                	or     $0x80,%al
+  805a43:	00 00                	add    %al,(%rax)
+  805a45:	00 00                	add    %al,(%rax)
+  805a47:	00 cb                	add    %cl,%bl
+  805a49:	0c 80                	or     $0x80,%al
+  805a4b:	00 00                	add    %al,(%rax)
+  805a4d:	00 00                	add    %al,(%rax)
+  805a4f:	00 cb                	add    %cl,%bl
+  805a51:	0c 80                	or     $0x80,%al
+  805a53:	00 00                	add    %al,(%rax)
+  805a55:	00 00                	add    %al,(%rax)
+  805a57:	00 cb                	add    %cl,%bl
+  805a59:	0c 80                	or     $0x80,%al
+  805a5b:	00 00                	add    %al,(%rax)
+  805a5d:	00 00                	add    %al,(%rax)
+  805a5f:	00 cb                	add    %cl,%bl
+  805a61:	0c 80                	or     $0x80,%al
+  805a63:	00 00                	add    %al,(%rax)
+  805a65:	00 00                	add    %al,(%rax)
+  805a67:	00 cb                	add    %cl,%bl
+  805a69:	0c 80                	or     $0x80,%al
+  805a6b:	00 00                	add    %al,(%rax)
+  805a6d:	00 00                	add    %al,(%rax)
+  805a6f:	00 cb                	add    %cl,%bl
+  805a71:	0c 80                	or     $0x80,%al
+  805a73:	00 00                	add    %al,(%rax)
+  805a75:	00 00                	add    %al,(%rax)
+  805a77:	00 cb                	add    %cl,%bl
+  805a79:	0c 80                	or     $0x80,%al
+  805a7b:	00 00                	add    %al,(%rax)
+  805a7d:	00 00                	add    %al,(%rax)
+  805a7f:	00 cb                	add    %cl,%bl
+  805a81:	0c 80                	or     $0x80,%al
+  805a83:	00 00                	add    %al,(%rax)
+  805a85:	00 00                	add    %al,(%rax)
+  805a87:	00 ee                	add    %ch,%dh
+  805a89:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  805a8f:	00 cb                	add    %cl,%bl
+  805a91:	0c 80                	or     $0x80,%al
+  805a93:	00 00                	add    %al,(%rax)
+  805a95:	00 00                	add    %al,(%rax)
+  805a97:	00 cb                	add    %cl,%bl
+  805a99:	0c 80                	or     $0x80,%al
+  805a9b:	00 00                	add    %al,(%rax)
+  805a9d:	00 00                	add    %al,(%rax)
+  805a9f:	00 cb                	add    %cl,%bl
+  805aa1:	0c 80                	or     $0x80,%al
+  805aa3:	00 00                	add    %al,(%rax)
+  805aa5:	00 00                	add    %al,(%rax)
+  805aa7:	00 cb                	add    %cl,%bl
+  805aa9:	0c 80                	or     $0x80,%al
+  805aab:	00 00                	add    %al,(%rax)
+  805aad:	00 00                	add    %al,(%rax)
+  805aaf:	00 cb                	add    %cl,%bl
+  805ab1:	0c 80                	or     $0x80,%al
+  805ab3:	00 00                	add    %al,(%rax)
+  805ab5:	00 00                	add    %al,(%rax)
+  805ab7:	00 cb                	add    %cl,%bl
+  805ab9:	0c 80                	or     $0x80,%al
+  805abb:	00 00                	add    %al,(%rax)
+  805abd:	00 00                	add    %al,(%rax)
+  805abf:	00 cb                	add    %cl,%bl
+  805ac1:	0c 80                	or     $0x80,%al
+  805ac3:	00 00                	add    %al,(%rax)
+  805ac5:	00 00                	add    %al,(%rax)
+  805ac7:	00 cb                	add    %cl,%bl
+  805ac9:	0c 80                	or     $0x80,%al
+  805acb:	00 00                	add    %al,(%rax)
+  805acd:	00 00                	add    %al,(%rax)
+  805acf:	00 cb                	add    %cl,%bl
+  805ad1:	0c 80                	or     $0x80,%al
+  805ad3:	00 00                	add    %al,(%rax)
+  805ad5:	00 00                	add    %al,(%rax)
+  805ad7:	00 cb                	add    %cl,%bl
+  805ad9:	0c 80                	or     $0x80,%al
+  805adb:	00 00                	add    %al,(%rax)
+  805add:	00 00                	add    %al,(%rax)
+  805adf:	00 3a                	add    %bh,(%rdx)
+  805ae1:	07                   	(bad)
+  805ae2:	80 00 00             	addb   $0x0,(%rax)
+  805ae5:	00 00                	add    %al,(%rax)
+  805ae7:	00 09                	add    %cl,(%rcx)
+  805ae9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  805aef:	00 cb                	add    %cl,%bl
+  805af1:	0c 80                	or     $0x80,%al
+  805af3:	00 00                	add    %al,(%rax)
+  805af5:	00 00                	add    %al,(%rax)
+  805af7:	00 cb                	add    %cl,%bl
+  805af9:	0c 80                	or     $0x80,%al
+  805afb:	00 00                	add    %al,(%rax)
+  805afd:	00 00                	add    %al,(%rax)
+  805aff:	00 cb                	add    %cl,%bl
+  805b01:	0c 80                	or     $0x80,%al
+  805b03:	00 00                	add    %al,(%rax)
+  805b05:	00 00                	add    %al,(%rax)
+  805b07:	00 cb                	add    %cl,%bl
+  805b09:	0c 80                	or     $0x80,%al
+  805b0b:	00 00                	add    %al,(%rax)
+  805b0d:	00 00                	add    %al,(%rax)
+  805b0f:	00 69 07             	add    %ch,0x7(%rcx)
+  805b12:	80 00 00             	addb   $0x0,(%rax)
+  805b15:	00 00                	add    %al,(%rax)
+  805b17:	00 cb                	add    %cl,%bl
+  805b19:	0c 80                	or     $0x80,%al
+  805b1b:	00 00                	add    %al,(%rax)
+  805b1d:	00 00                	add    %al,(%rax)
+  805b1f:	00 cb                	add    %cl,%bl
+  805b21:	0c 80                	or     $0x80,%al
+  805b23:	00 00                	add    %al,(%rax)
+  805b25:	00 00                	add    %al,(%rax)
+  805b27:	00 2f                	add    %ch,(%rdi)
+  805b29:	07                   	(bad)
+  805b2a:	80 00 00             	addb   $0x0,(%rax)
+  805b2d:	00 00                	add    %al,(%rax)
+  805b2f:	00 cb                	add    %cl,%bl
+  805b31:	0c 80                	or     $0x80,%al
+  805b33:	00 00                	add    %al,(%rax)
+  805b35:	00 00                	add    %al,(%rax)
+  805b37:	00 cb                	add    %cl,%bl
+  805b39:	0c 80                	or     $0x80,%al
+  805b3b:	00 00                	add    %al,(%rax)
+  805b3d:	00 00                	add    %al,(%rax)
+  805b3f:	00 b1 0a 80 00 00    	add    %dh,0x800a(%rcx)
+  805b45:	00 00                	add    %al,(%rax)
+  805b47:	00 7b 0b             	add    %bh,0xb(%rbx)
+  805b4a:	80 00 00             	addb   $0x0,(%rax)
+  805b4d:	00 00                	add    %al,(%rax)
+  805b4f:	00 cb                	add    %cl,%bl
+  805b51:	0c 80                	or     $0x80,%al
+  805b53:	00 00                	add    %al,(%rax)
+  805b55:	00 00                	add    %al,(%rax)
+  805b57:	00 cb                	add    %cl,%bl
+  805b59:	0c 80                	or     $0x80,%al
+  805b5b:	00 00                	add    %al,(%rax)
+  805b5d:	00 00                	add    %al,(%rax)
+  805b5f:	00 00                	add    %al,(%rax)
+  805b61:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  805b67:	00 cb                	add    %cl,%bl
+  805b69:	0c 80                	or     $0x80,%al
+  805b6b:	00 00                	add    %al,(%rax)
+  805b6d:	00 00                	add    %al,(%rax)
+  805b6f:	00 dd                	add    %bl,%ch
+  805b71:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  805b77:	00 cb                	add    %cl,%bl
+  805b79:	0c 80                	or     $0x80,%al
+  805b7b:	00 00                	add    %al,(%rax)
+  805b7d:	00 00                	add    %al,(%rax)
+  805b7f:	00 cb                	add    %cl,%bl
+  805b81:	0c 80                	or     $0x80,%al
+  805b83:	00 00                	add    %al,(%rax)
+  805b85:	00 00                	add    %al,(%rax)
+  805b87:	00 ee                	add    %ch,%dh
+  805b89:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  805b8f:	00 cb                	add    %cl,%bl
+  805b91:	0c 80                	or     $0x80,%al
+  805b93:	00 00                	add    %al,(%rax)
+  805b95:	00 00                	add    %al,(%rax)
+  805b97:	00 93 06 80 00 00    	add    %dl,0x8006(%rbx)
+  805b9d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000805ba0 <error_string>:
+	...
+  805ba8:	4d 57 80 00 00 00 00 00 5f 57 80 00 00 00 00 00     MW......_W......
+  805bb8:	6f 57 80 00 00 00 00 00 81 57 80 00 00 00 00 00     oW.......W......
+  805bc8:	8f 57 80 00 00 00 00 00 a3 57 80 00 00 00 00 00     .W.......W......
+  805bd8:	b8 57 80 00 00 00 00 00 cb 57 80 00 00 00 00 00     .W.......W......
+  805be8:	dd 57 80 00 00 00 00 00 f1 57 80 00 00 00 00 00     .W.......W......
+  805bf8:	01 58 80 00 00 00 00 00 14 58 80 00 00 00 00 00     .X.......X......
+  805c08:	2b 58 80 00 00 00 00 00 41 58 80 00 00 00 00 00     +X......AX......
+  805c18:	59 58 80 00 00 00 00 00 71 58 80 00 00 00 00 00     YX......qX......
+  805c28:	7e 58 80 00 00 00 00 00 58 5c 80 00 00 00 00 00     ~X......X\......
+  805c38:	92 58 80 00 00 00 00 00 aa 58 80 00 00 00 00 00     .X.......X......
+  805c48:	b4 58 80 00 00 00 00 00 be 58 80 00 00 00 00 00     .X.......X......
+  805c58:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  805c68:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  805c78:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  805c88:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  805c98:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 73 66 6f     ib/syscall.c.sfo
+  805ca8:	72 6b 28 29 20 69 73 20 6e 6f 74 20 69 6d 70 6c     rk() is not impl
+  805cb8:	65 6d 65 6e 74 65 64 00 6c 69 62 2f 66 6f 72 6b     emented.lib/fork
+  805cc8:	2e 63 00 0f 1f 44 00 00 5b 25 30 38 78 5d 20 75     .c...D..[%08x] u
+  805cd8:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  805ce8:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  805cf8:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  805d08:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  805d18:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  805d28:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  805d38:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  805d48:	0a 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d58:	84 00 00 00 00 00 66 90                             ......f.
+
+0000000000805d60 <devtab>:
+  805d60:	20 60 80 00 00 00 00 00 60 60 80 00 00 00 00 00      `......``......
+  805d70:	a0 60 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .`..............
+  805d80:	57 72 6f 6e 67 20 45 4c 46 20 68 65 61 64 65 72     Wrong ELF header
+  805d90:	20 73 69 7a 65 20 6f 72 20 72 65 61 64 20 65 72      size or read er
+  805da0:	72 6f 72 3a 20 25 69 0a 00 00 00 00 00 00 00 00     ror: %i.........
+  805db0:	73 74 72 69 6e 67 5f 73 74 6f 72 65 20 3d 3d 20     string_store == 
+  805dc0:	28 63 68 61 72 20 2a 29 55 54 45 4d 50 20 2b 20     (char *)UTEMP + 
+  805dd0:	55 53 45 52 5f 53 54 41 43 4b 5f 53 49 5a 45 00     USER_STACK_SIZE.
+  805de0:	6d 61 70 5f 73 65 67 6d 65 6e 74 2e 73 79 73 5f     map_segment.sys_
+  805df0:	61 6c 6c 6f 63 5f 72 65 67 69 6f 6e 20 66 61 69     alloc_region fai
+  805e00:	6c 65 64 3a 20 25 69 0a 00 00 00 00 00 00 00 00     led: %i.........
+  805e10:	73 70 61 77 6e 3a 20 62 61 74 63 68 65 64 20 73     spawn: batched s
+  805e20:	79 73 74 65 6d 20 63 61 6c 6c 20 66 61 69 6c 65     ystem call faile
+  805e30:	64 3a 20 25 69 0a 00 45 6c 66 20 6d 61 67 69 63     d: %i..Elf magic
+  805e40:	20 25 30 38 78 20 77 61 6e 74 20 25 30 38 78 0a      %08x want %08x.
+  805e50:	00 61 73 73 65 72 74 69 6f 6e 20 66 61 69 6c 65     .assertion faile
+  805e60:	64 3a 20 25 73 00 6c 69 62 2f 73 70 61 77 6e 2e     d: %s.lib/spawn.
+  805e70:	63 00 6d 61 70 5f 73 65 67 6d 65 6e 74 2e 6d 6d     c.map_segment.mm
+  805e80:	61 70 20 66 61 69 6c 65 64 3a 20 25 69 0a 00 3c     ap failed: %i..<
+  805e90:	70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e 63     pipe>.lib/pipe.c
+  805ea0:	00 70 69 70 65 00 66 90 73 79 73 5f 72 65 67 69     .pipe.f.sys_regi
+  805eb0:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  805ec0:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 65 6e 76 69     _SIZE) == 2.envi
+  805ed0:	64 20 21 3d 20 30 00 6c 69 62 2f 77 61 69 74 2e     d != 0.lib/wait.
+  805ee0:	63 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00 66 90     c.<cons>.cons.f.
+  805ef0:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  805f00:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  805f10:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  805f20:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  805f30:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  805f40:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  805f50:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  805f60:	69 70 63 5f 73 65 6e 64 20 65 72 72 6f 72 3a 20     ipc_send error: 
+  805f70:	25 69 0a 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e     %i..lib/ipc.c.f.
+  805f80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805fa0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805fb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805fc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805fd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805fe0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ff0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
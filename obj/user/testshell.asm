@@ -0,0 +1,10124 @@
+
+obj/user/testshell:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 e5 06 00 00       	call   800708 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <wrong>:
+
+    breakpoint();
+}
+
+void
+wrong(int rfd, int kfd, int off, char c1, char c2) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 81 ec 88 00 00 00 	sub    $0x88,%rsp
+  800039:	89 fb                	mov    %edi,%ebx
+  80003b:	41 89 f4             	mov    %esi,%r12d
+  80003e:	41 89 d6             	mov    %edx,%r14d
+  800041:	41 89 cd             	mov    %ecx,%r13d
+  800044:	44 89 85 5c ff ff ff 	mov    %r8d,-0xa4(%rbp)
+    char buf[100];
+    int n;
+
+    seek(rfd, off);
+  80004b:	89 d6                	mov    %edx,%esi
+  80004d:	49 bf 5e 22 80 00 00 	movabs $0x80225e,%r15
+  800054:	00 00 00 
+  800057:	41 ff d7             	call   *%r15
+    seek(kfd, off);
+  80005a:	44 89 f6             	mov    %r14d,%esi
+  80005d:	44 89 e7             	mov    %r12d,%edi
+  800060:	41 ff d7             	call   *%r15
+
+    cprintf("shell produced incorrect output.\n");
+  800063:	48 bf a8 58 80 00 00 	movabs $0x8058a8,%rdi
+  80006a:	00 00 00 
+  80006d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800072:	49 be 2e 09 80 00 00 	movabs $0x80092e,%r14
+  800079:	00 00 00 
+  80007c:	41 ff d6             	call   *%r14
+    cprintf("expected:\n===\n%c", c1);
+  80007f:	41 0f be f5          	movsbl %r13b,%esi
+  800083:	48 bf 1b 59 80 00 00 	movabs $0x80591b,%rdi
+  80008a:	00 00 00 
+  80008d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800092:	41 ff d6             	call   *%r14
+    while ((n = read(kfd, buf, sizeof buf - 1)) > 0)
+  800095:	49 bd 76 20 80 00 00 	movabs $0x802076,%r13
+  80009c:	00 00 00 
+        sys_cputs(buf, n);
+  80009f:	49 be 7a 16 80 00 00 	movabs $0x80167a,%r14
+  8000a6:	00 00 00 
+    while ((n = read(kfd, buf, sizeof buf - 1)) > 0)
+  8000a9:	eb 0d                	jmp    8000b8 <wrong+0x93>
+        sys_cputs(buf, n);
+  8000ab:	48 63 f0             	movslq %eax,%rsi
+  8000ae:	48 8d bd 6c ff ff ff 	lea    -0x94(%rbp),%rdi
+  8000b5:	41 ff d6             	call   *%r14
+    while ((n = read(kfd, buf, sizeof buf - 1)) > 0)
+  8000b8:	ba 63 00 00 00       	mov    $0x63,%edx
+  8000bd:	48 8d b5 6c ff ff ff 	lea    -0x94(%rbp),%rsi
+  8000c4:	44 89 e7             	mov    %r12d,%edi
+  8000c7:	41 ff d5             	call   *%r13
+  8000ca:	85 c0                	test   %eax,%eax
+  8000cc:	7f dd                	jg     8000ab <wrong+0x86>
+    cprintf("===\ngot:\n===\n%c", c2);
+  8000ce:	0f be b5 5c ff ff ff 	movsbl -0xa4(%rbp),%esi
+  8000d5:	48 bf 2c 59 80 00 00 	movabs $0x80592c,%rdi
+  8000dc:	00 00 00 
+  8000df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000e4:	48 ba 2e 09 80 00 00 	movabs $0x80092e,%rdx
+  8000eb:	00 00 00 
+  8000ee:	ff d2                	call   *%rdx
+    while ((n = read(rfd, buf, sizeof buf - 1)) > 0)
+  8000f0:	49 bc 76 20 80 00 00 	movabs $0x802076,%r12
+  8000f7:	00 00 00 
+        sys_cputs(buf, n);
+  8000fa:	49 bd 7a 16 80 00 00 	movabs $0x80167a,%r13
+  800101:	00 00 00 
+    while ((n = read(rfd, buf, sizeof buf - 1)) > 0)
+  800104:	eb 0d                	jmp    800113 <wrong+0xee>
+        sys_cputs(buf, n);
+  800106:	48 63 f0             	movslq %eax,%rsi
+  800109:	48 8d bd 6c ff ff ff 	lea    -0x94(%rbp),%rdi
+  800110:	41 ff d5             	call   *%r13
+    while ((n = read(rfd, buf, sizeof buf - 1)) > 0)
+  800113:	ba 63 00 00 00       	mov    $0x63,%edx
+  800118:	48 8d b5 6c ff ff ff 	lea    -0x94(%rbp),%rsi
+  80011f:	89 df                	mov    %ebx,%edi
+  800121:	41 ff d4             	call   *%r12
+  800124:	85 c0                	test   %eax,%eax
+  800126:	7f de                	jg     800106 <wrong+0xe1>
+    cprintf("===\n");
+  800128:	48 bf 3c 59 80 00 00 	movabs $0x80593c,%rdi
+  80012f:	00 00 00 
+  800132:	b8 00 00 00 00       	mov    $0x0,%eax
+  800137:	48 ba 2e 09 80 00 00 	movabs $0x80092e,%rdx
+  80013e:	00 00 00 
+  800141:	ff d2                	call   *%rdx
+    exit();
+  800143:	48 b8 bb 07 80 00 00 	movabs $0x8007bb,%rax
+  80014a:	00 00 00 
+  80014d:	ff d0                	call   *%rax
+}
+  80014f:	48 81 c4 88 00 00 00 	add    $0x88,%rsp
+  800156:	5b                   	pop    %rbx
+  800157:	41 5c                	pop    %r12
+  800159:	41 5d                	pop    %r13
+  80015b:	41 5e                	pop    %r14
+  80015d:	41 5f                	pop    %r15
+  80015f:	5d                   	pop    %rbp
+  800160:	c3                   	ret
+
+0000000000800161 <umain>:
+umain(int argc, char **argv) {
+  800161:	55                   	push   %rbp
+  800162:	48 89 e5             	mov    %rsp,%rbp
+  800165:	41 57                	push   %r15
+  800167:	41 56                	push   %r14
+  800169:	41 55                	push   %r13
+  80016b:	41 54                	push   %r12
+  80016d:	53                   	push   %rbx
+  80016e:	48 83 ec 28          	sub    $0x28,%rsp
+    close(0);
+  800172:	bf 00 00 00 00       	mov    $0x0,%edi
+  800177:	48 bb f8 1e 80 00 00 	movabs $0x801ef8,%rbx
+  80017e:	00 00 00 
+  800181:	ff d3                	call   *%rbx
+    close(1);
+  800183:	bf 01 00 00 00       	mov    $0x1,%edi
+  800188:	ff d3                	call   *%rbx
+    opencons();
+  80018a:	48 bb a1 06 80 00 00 	movabs $0x8006a1,%rbx
+  800191:	00 00 00 
+  800194:	ff d3                	call   *%rbx
+    opencons();
+  800196:	ff d3                	call   *%rbx
+    if ((rfd = open("testshell.sh", O_RDONLY)) < 0)
+  800198:	be 00 00 00 00       	mov    $0x0,%esi
+  80019d:	48 bf 41 59 80 00 00 	movabs $0x805941,%rdi
+  8001a4:	00 00 00 
+  8001a7:	48 b8 58 35 80 00 00 	movabs $0x803558,%rax
+  8001ae:	00 00 00 
+  8001b1:	ff d0                	call   *%rax
+  8001b3:	89 c3                	mov    %eax,%ebx
+  8001b5:	85 c0                	test   %eax,%eax
+  8001b7:	0f 88 4c 01 00 00    	js     800309 <umain+0x1a8>
+    if ((wfd = pipe(pfds)) < 0)
+  8001bd:	48 8d 7d c4          	lea    -0x3c(%rbp),%rdi
+  8001c1:	48 b8 7b 4a 80 00 00 	movabs $0x804a7b,%rax
+  8001c8:	00 00 00 
+  8001cb:	ff d0                	call   *%rax
+  8001cd:	85 c0                	test   %eax,%eax
+  8001cf:	0f 88 61 01 00 00    	js     800336 <umain+0x1d5>
+    wfd = pfds[1];
+  8001d5:	44 8b 65 c8          	mov    -0x38(%rbp),%r12d
+    cprintf("running sh -x < testshell.sh | cat\n");
+  8001d9:	48 bf d0 58 80 00 00 	movabs $0x8058d0,%rdi
+  8001e0:	00 00 00 
+  8001e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001e8:	48 ba 2e 09 80 00 00 	movabs $0x80092e,%rdx
+  8001ef:	00 00 00 
+  8001f2:	ff d2                	call   *%rdx
+    if ((r = fork()) < 0)
+  8001f4:	48 b8 e5 1b 80 00 00 	movabs $0x801be5,%rax
+  8001fb:	00 00 00 
+  8001fe:	ff d0                	call   *%rax
+  800200:	85 c0                	test   %eax,%eax
+  800202:	0f 88 5b 01 00 00    	js     800363 <umain+0x202>
+    if (r == 0) {
+  800208:	0f 85 a9 00 00 00    	jne    8002b7 <umain+0x156>
+        dup(rfd, 0);
+  80020e:	be 00 00 00 00       	mov    $0x0,%esi
+  800213:	89 df                	mov    %ebx,%edi
+  800215:	49 bd 53 1f 80 00 00 	movabs $0x801f53,%r13
+  80021c:	00 00 00 
+  80021f:	41 ff d5             	call   *%r13
+        dup(wfd, 1);
+  800222:	be 01 00 00 00       	mov    $0x1,%esi
+  800227:	44 89 e7             	mov    %r12d,%edi
+  80022a:	41 ff d5             	call   *%r13
+        close(rfd);
+  80022d:	89 df                	mov    %ebx,%edi
+  80022f:	49 bd f8 1e 80 00 00 	movabs $0x801ef8,%r13
+  800236:	00 00 00 
+  800239:	41 ff d5             	call   *%r13
+        close(wfd);
+  80023c:	44 89 e7             	mov    %r12d,%edi
+  80023f:	41 ff d5             	call   *%r13
+        if ((r = spawnl("/sh", "sh", "-x", 0)) < 0)
+  800242:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800247:	48 ba 87 59 80 00 00 	movabs $0x805987,%rdx
+  80024e:	00 00 00 
+  800251:	48 be 4b 59 80 00 00 	movabs $0x80594b,%rsi
+  800258:	00 00 00 
+  80025b:	48 bf 8a 59 80 00 00 	movabs $0x80598a,%rdi
+  800262:	00 00 00 
+  800265:	b8 00 00 00 00       	mov    $0x0,%eax
+  80026a:	49 b8 af 45 80 00 00 	movabs $0x8045af,%r8
+  800271:	00 00 00 
+  800274:	41 ff d0             	call   *%r8
+  800277:	41 89 c5             	mov    %eax,%r13d
+  80027a:	85 c0                	test   %eax,%eax
+  80027c:	0f 88 0e 01 00 00    	js     800390 <umain+0x22f>
+        close(0);
+  800282:	bf 00 00 00 00       	mov    $0x0,%edi
+  800287:	49 be f8 1e 80 00 00 	movabs $0x801ef8,%r14
+  80028e:	00 00 00 
+  800291:	41 ff d6             	call   *%r14
+        close(1);
+  800294:	bf 01 00 00 00       	mov    $0x1,%edi
+  800299:	41 ff d6             	call   *%r14
+        wait(r);
+  80029c:	44 89 ef             	mov    %r13d,%edi
+  80029f:	48 b8 c8 4c 80 00 00 	movabs $0x804cc8,%rax
+  8002a6:	00 00 00 
+  8002a9:	ff d0                	call   *%rax
+        exit();
+  8002ab:	48 b8 bb 07 80 00 00 	movabs $0x8007bb,%rax
+  8002b2:	00 00 00 
+  8002b5:	ff d0                	call   *%rax
+    close(rfd);
+  8002b7:	89 df                	mov    %ebx,%edi
+  8002b9:	48 bb f8 1e 80 00 00 	movabs $0x801ef8,%rbx
+  8002c0:	00 00 00 
+  8002c3:	ff d3                	call   *%rbx
+    close(wfd);
+  8002c5:	44 89 e7             	mov    %r12d,%edi
+  8002c8:	ff d3                	call   *%rbx
+    rfd = pfds[0];
+  8002ca:	44 8b 7d c4          	mov    -0x3c(%rbp),%r15d
+    if ((kfd = open("testshell.key", O_RDONLY)) < 0)
+  8002ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8002d3:	48 bf 98 59 80 00 00 	movabs $0x805998,%rdi
+  8002da:	00 00 00 
+  8002dd:	48 b8 58 35 80 00 00 	movabs $0x803558,%rax
+  8002e4:	00 00 00 
+  8002e7:	ff d0                	call   *%rax
+  8002e9:	41 89 c6             	mov    %eax,%r14d
+  8002ec:	85 c0                	test   %eax,%eax
+  8002ee:	0f 88 c9 00 00 00    	js     8003bd <umain+0x25c>
+    for (off = 0;; off++) {
+  8002f4:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        n1 = read(rfd, &c1, 1);
+  8002fa:	49 bd 76 20 80 00 00 	movabs $0x802076,%r13
+  800301:	00 00 00 
+  800304:	e9 5c 01 00 00       	jmp    800465 <umain+0x304>
+        panic("open testshell.sh: %i", rfd);
+  800309:	89 c1                	mov    %eax,%ecx
+  80030b:	48 ba 4e 59 80 00 00 	movabs $0x80594e,%rdx
+  800312:	00 00 00 
+  800315:	be 12 00 00 00       	mov    $0x12,%esi
+  80031a:	48 bf 64 59 80 00 00 	movabs $0x805964,%rdi
+  800321:	00 00 00 
+  800324:	b8 00 00 00 00       	mov    $0x0,%eax
+  800329:	49 b8 de 07 80 00 00 	movabs $0x8007de,%r8
+  800330:	00 00 00 
+  800333:	41 ff d0             	call   *%r8
+        panic("pipe: %i", wfd);
+  800336:	89 c1                	mov    %eax,%ecx
+  800338:	48 ba 75 59 80 00 00 	movabs $0x805975,%rdx
+  80033f:	00 00 00 
+  800342:	be 14 00 00 00       	mov    $0x14,%esi
+  800347:	48 bf 64 59 80 00 00 	movabs $0x805964,%rdi
+  80034e:	00 00 00 
+  800351:	b8 00 00 00 00       	mov    $0x0,%eax
+  800356:	49 b8 de 07 80 00 00 	movabs $0x8007de,%r8
+  80035d:	00 00 00 
+  800360:	41 ff d0             	call   *%r8
+        panic("fork: %i", r);
+  800363:	89 c1                	mov    %eax,%ecx
+  800365:	48 ba 7e 59 80 00 00 	movabs $0x80597e,%rdx
+  80036c:	00 00 00 
+  80036f:	be 19 00 00 00       	mov    $0x19,%esi
+  800374:	48 bf 64 59 80 00 00 	movabs $0x805964,%rdi
+  80037b:	00 00 00 
+  80037e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800383:	49 b8 de 07 80 00 00 	movabs $0x8007de,%r8
+  80038a:	00 00 00 
+  80038d:	41 ff d0             	call   *%r8
+            panic("spawn: %i", r);
+  800390:	89 c1                	mov    %eax,%ecx
+  800392:	48 ba 8e 59 80 00 00 	movabs $0x80598e,%rdx
+  800399:	00 00 00 
+  80039c:	be 20 00 00 00       	mov    $0x20,%esi
+  8003a1:	48 bf 64 59 80 00 00 	movabs $0x805964,%rdi
+  8003a8:	00 00 00 
+  8003ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003b0:	49 b8 de 07 80 00 00 	movabs $0x8007de,%r8
+  8003b7:	00 00 00 
+  8003ba:	41 ff d0             	call   *%r8
+        panic("open testshell.key for reading: %i", kfd);
+  8003bd:	89 c1                	mov    %eax,%ecx
+  8003bf:	48 ba f8 58 80 00 00 	movabs $0x8058f8,%rdx
+  8003c6:	00 00 00 
+  8003c9:	be 2b 00 00 00       	mov    $0x2b,%esi
+  8003ce:	48 bf 64 59 80 00 00 	movabs $0x805964,%rdi
+  8003d5:	00 00 00 
+  8003d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003dd:	49 b8 de 07 80 00 00 	movabs $0x8007de,%r8
+  8003e4:	00 00 00 
+  8003e7:	41 ff d0             	call   *%r8
+            panic("reading testshell.out: %i", n1);
+  8003ea:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  8003ed:	48 ba a6 59 80 00 00 	movabs $0x8059a6,%rdx
+  8003f4:	00 00 00 
+  8003f7:	be 32 00 00 00       	mov    $0x32,%esi
+  8003fc:	48 bf 64 59 80 00 00 	movabs $0x805964,%rdi
+  800403:	00 00 00 
+  800406:	b8 00 00 00 00       	mov    $0x0,%eax
+  80040b:	49 b8 de 07 80 00 00 	movabs $0x8007de,%r8
+  800412:	00 00 00 
+  800415:	41 ff d0             	call   *%r8
+            panic("reading testshell.key: %i", n2);
+  800418:	48 ba c0 59 80 00 00 	movabs $0x8059c0,%rdx
+  80041f:	00 00 00 
+  800422:	be 34 00 00 00       	mov    $0x34,%esi
+  800427:	48 bf 64 59 80 00 00 	movabs $0x805964,%rdi
+  80042e:	00 00 00 
+  800431:	b8 00 00 00 00       	mov    $0x0,%eax
+  800436:	49 b8 de 07 80 00 00 	movabs $0x8007de,%r8
+  80043d:	00 00 00 
+  800440:	41 ff d0             	call   *%r8
+            wrong(rfd, kfd, off, c1, c2);
+  800443:	0f be 4d cf          	movsbl -0x31(%rbp),%ecx
+  800447:	44 0f be 45 ce       	movsbl -0x32(%rbp),%r8d
+  80044c:	44 89 e2             	mov    %r12d,%edx
+  80044f:	44 89 f6             	mov    %r14d,%esi
+  800452:	44 89 ff             	mov    %r15d,%edi
+  800455:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80045c:	00 00 00 
+  80045f:	ff d0                	call   *%rax
+    for (off = 0;; off++) {
+  800461:	41 83 c4 01          	add    $0x1,%r12d
+        n1 = read(rfd, &c1, 1);
+  800465:	ba 01 00 00 00       	mov    $0x1,%edx
+  80046a:	48 8d 75 cf          	lea    -0x31(%rbp),%rsi
+  80046e:	44 89 ff             	mov    %r15d,%edi
+  800471:	41 ff d5             	call   *%r13
+  800474:	48 89 c3             	mov    %rax,%rbx
+  800477:	89 45 bc             	mov    %eax,-0x44(%rbp)
+        n2 = read(kfd, &c2, 1);
+  80047a:	ba 01 00 00 00       	mov    $0x1,%edx
+  80047f:	48 8d 75 ce          	lea    -0x32(%rbp),%rsi
+  800483:	44 89 f7             	mov    %r14d,%edi
+  800486:	41 ff d5             	call   *%r13
+  800489:	89 c1                	mov    %eax,%ecx
+        if (n1 < 0)
+  80048b:	85 db                	test   %ebx,%ebx
+  80048d:	0f 88 57 ff ff ff    	js     8003ea <umain+0x289>
+        if (n2 < 0)
+  800493:	85 c0                	test   %eax,%eax
+  800495:	78 81                	js     800418 <umain+0x2b7>
+        if (n1 == 0 && n2 == 0)
+  800497:	89 c2                	mov    %eax,%edx
+  800499:	09 da                	or     %ebx,%edx
+  80049b:	74 15                	je     8004b2 <umain+0x351>
+        if (n1 != 1 || n2 != 1 || c1 != c2) {
+  80049d:	83 fb 01             	cmp    $0x1,%ebx
+  8004a0:	75 a1                	jne    800443 <umain+0x2e2>
+  8004a2:	83 f8 01             	cmp    $0x1,%eax
+  8004a5:	75 9c                	jne    800443 <umain+0x2e2>
+  8004a7:	0f b6 45 ce          	movzbl -0x32(%rbp),%eax
+  8004ab:	38 45 cf             	cmp    %al,-0x31(%rbp)
+  8004ae:	75 93                	jne    800443 <umain+0x2e2>
+  8004b0:	eb af                	jmp    800461 <umain+0x300>
+    cprintf("shell ran correctly\n");
+  8004b2:	48 bf da 59 80 00 00 	movabs $0x8059da,%rdi
+  8004b9:	00 00 00 
+  8004bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004c1:	48 ba 2e 09 80 00 00 	movabs $0x80092e,%rdx
+  8004c8:	00 00 00 
+  8004cb:	ff d2                	call   *%rdx
+
+#include <inc/types.h>
+
+static inline void __attribute__((always_inline))
+breakpoint(void) {
+    asm volatile("int3");
+  8004cd:	cc                   	int3
+}
+  8004ce:	48 83 c4 28          	add    $0x28,%rsp
+  8004d2:	5b                   	pop    %rbx
+  8004d3:	41 5c                	pop    %r12
+  8004d5:	41 5d                	pop    %r13
+  8004d7:	41 5e                	pop    %r14
+  8004d9:	41 5f                	pop    %r15
+  8004db:	5d                   	pop    %rbp
+  8004dc:	c3                   	ret
+
+00000000008004dd <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8004dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004e2:	c3                   	ret
+
+00000000008004e3 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8004e3:	55                   	push   %rbp
+  8004e4:	48 89 e5             	mov    %rsp,%rbp
+  8004e7:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8004ea:	48 be ef 59 80 00 00 	movabs $0x8059ef,%rsi
+  8004f1:	00 00 00 
+  8004f4:	48 b8 53 12 80 00 00 	movabs $0x801253,%rax
+  8004fb:	00 00 00 
+  8004fe:	ff d0                	call   *%rax
+    return 0;
+}
+  800500:	b8 00 00 00 00       	mov    $0x0,%eax
+  800505:	5d                   	pop    %rbp
+  800506:	c3                   	ret
+
+0000000000800507 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  800507:	55                   	push   %rbp
+  800508:	48 89 e5             	mov    %rsp,%rbp
+  80050b:	41 57                	push   %r15
+  80050d:	41 56                	push   %r14
+  80050f:	41 55                	push   %r13
+  800511:	41 54                	push   %r12
+  800513:	53                   	push   %rbx
+  800514:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80051b:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  800522:	48 85 d2             	test   %rdx,%rdx
+  800525:	74 7a                	je     8005a1 <devcons_write+0x9a>
+  800527:	49 89 d6             	mov    %rdx,%r14
+  80052a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  800530:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  800535:	49 bf 4d 14 80 00 00 	movabs $0x80144d,%r15
+  80053c:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80053f:	4c 89 f3             	mov    %r14,%rbx
+  800542:	48 29 f3             	sub    %rsi,%rbx
+  800545:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80054a:	48 39 c3             	cmp    %rax,%rbx
+  80054d:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  800551:	4c 63 eb             	movslq %ebx,%r13
+  800554:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80055b:	48 01 c6             	add    %rax,%rsi
+  80055e:	4c 89 ea             	mov    %r13,%rdx
+  800561:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  800568:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80056b:	4c 89 ee             	mov    %r13,%rsi
+  80056e:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  800575:	48 b8 7a 16 80 00 00 	movabs $0x80167a,%rax
+  80057c:	00 00 00 
+  80057f:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  800581:	41 01 dc             	add    %ebx,%r12d
+  800584:	49 63 f4             	movslq %r12d,%rsi
+  800587:	4c 39 f6             	cmp    %r14,%rsi
+  80058a:	72 b3                	jb     80053f <devcons_write+0x38>
+    return res;
+  80058c:	49 63 c4             	movslq %r12d,%rax
+}
+  80058f:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  800596:	5b                   	pop    %rbx
+  800597:	41 5c                	pop    %r12
+  800599:	41 5d                	pop    %r13
+  80059b:	41 5e                	pop    %r14
+  80059d:	41 5f                	pop    %r15
+  80059f:	5d                   	pop    %rbp
+  8005a0:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8005a1:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8005a7:	eb e3                	jmp    80058c <devcons_write+0x85>
+
+00000000008005a9 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8005a9:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8005ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005b1:	48 85 c0             	test   %rax,%rax
+  8005b4:	74 55                	je     80060b <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8005b6:	55                   	push   %rbp
+  8005b7:	48 89 e5             	mov    %rsp,%rbp
+  8005ba:	41 55                	push   %r13
+  8005bc:	41 54                	push   %r12
+  8005be:	53                   	push   %rbx
+  8005bf:	48 83 ec 08          	sub    $0x8,%rsp
+  8005c3:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8005c6:	48 bb 99 16 80 00 00 	movabs $0x801699,%rbx
+  8005cd:	00 00 00 
+  8005d0:	49 bc 4e 17 80 00 00 	movabs $0x80174e,%r12
+  8005d7:	00 00 00 
+  8005da:	eb 03                	jmp    8005df <devcons_read+0x36>
+  8005dc:	41 ff d4             	call   *%r12
+  8005df:	ff d3                	call   *%rbx
+  8005e1:	85 c0                	test   %eax,%eax
+  8005e3:	74 f7                	je     8005dc <devcons_read+0x33>
+    if (c < 0) return c;
+  8005e5:	48 63 d0             	movslq %eax,%rdx
+  8005e8:	78 13                	js     8005fd <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8005ea:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005ef:	83 f8 04             	cmp    $0x4,%eax
+  8005f2:	74 09                	je     8005fd <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8005f4:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8005f8:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8005fd:	48 89 d0             	mov    %rdx,%rax
+  800600:	48 83 c4 08          	add    $0x8,%rsp
+  800604:	5b                   	pop    %rbx
+  800605:	41 5c                	pop    %r12
+  800607:	41 5d                	pop    %r13
+  800609:	5d                   	pop    %rbp
+  80060a:	c3                   	ret
+  80060b:	48 89 d0             	mov    %rdx,%rax
+  80060e:	c3                   	ret
+
+000000000080060f <cputchar>:
+cputchar(int ch) {
+  80060f:	55                   	push   %rbp
+  800610:	48 89 e5             	mov    %rsp,%rbp
+  800613:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  800617:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80061b:	be 01 00 00 00       	mov    $0x1,%esi
+  800620:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  800624:	48 b8 7a 16 80 00 00 	movabs $0x80167a,%rax
+  80062b:	00 00 00 
+  80062e:	ff d0                	call   *%rax
+}
+  800630:	c9                   	leave
+  800631:	c3                   	ret
+
+0000000000800632 <getchar>:
+getchar(void) {
+  800632:	55                   	push   %rbp
+  800633:	48 89 e5             	mov    %rsp,%rbp
+  800636:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80063a:	ba 01 00 00 00       	mov    $0x1,%edx
+  80063f:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  800643:	bf 00 00 00 00       	mov    $0x0,%edi
+  800648:	48 b8 76 20 80 00 00 	movabs $0x802076,%rax
+  80064f:	00 00 00 
+  800652:	ff d0                	call   *%rax
+  800654:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  800656:	85 c0                	test   %eax,%eax
+  800658:	78 06                	js     800660 <getchar+0x2e>
+  80065a:	74 08                	je     800664 <getchar+0x32>
+  80065c:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  800660:	89 d0                	mov    %edx,%eax
+  800662:	c9                   	leave
+  800663:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  800664:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  800669:	eb f5                	jmp    800660 <getchar+0x2e>
+
+000000000080066b <iscons>:
+iscons(int fdnum) {
+  80066b:	55                   	push   %rbp
+  80066c:	48 89 e5             	mov    %rsp,%rbp
+  80066f:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  800673:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800677:	48 b8 93 1d 80 00 00 	movabs $0x801d93,%rax
+  80067e:	00 00 00 
+  800681:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800683:	85 c0                	test   %eax,%eax
+  800685:	78 18                	js     80069f <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  800687:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80068b:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800692:	00 00 00 
+  800695:	8b 00                	mov    (%rax),%eax
+  800697:	39 02                	cmp    %eax,(%rdx)
+  800699:	0f 94 c0             	sete   %al
+  80069c:	0f b6 c0             	movzbl %al,%eax
+}
+  80069f:	c9                   	leave
+  8006a0:	c3                   	ret
+
+00000000008006a1 <opencons>:
+opencons(void) {
+  8006a1:	55                   	push   %rbp
+  8006a2:	48 89 e5             	mov    %rsp,%rbp
+  8006a5:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8006a9:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8006ad:	48 b8 33 1d 80 00 00 	movabs $0x801d33,%rax
+  8006b4:	00 00 00 
+  8006b7:	ff d0                	call   *%rax
+  8006b9:	85 c0                	test   %eax,%eax
+  8006bb:	78 49                	js     800706 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8006bd:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8006c2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8006c7:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8006cb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8006d0:	48 b8 b2 17 80 00 00 	movabs $0x8017b2,%rax
+  8006d7:	00 00 00 
+  8006da:	ff d0                	call   *%rax
+  8006dc:	85 c0                	test   %eax,%eax
+  8006de:	78 26                	js     800706 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8006e0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8006e4:	a1 00 70 80 00 00 00 	movabs 0x807000,%eax
+  8006eb:	00 00 
+  8006ed:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8006ef:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8006f3:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8006fa:	48 b8 05 1d 80 00 00 	movabs $0x801d05,%rax
+  800701:	00 00 00 
+  800704:	ff d0                	call   *%rax
+}
+  800706:	c9                   	leave
+  800707:	c3                   	ret
+
+0000000000800708 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800708:	55                   	push   %rbp
+  800709:	48 89 e5             	mov    %rsp,%rbp
+  80070c:	41 56                	push   %r14
+  80070e:	41 55                	push   %r13
+  800710:	41 54                	push   %r12
+  800712:	53                   	push   %rbx
+  800713:	41 89 fd             	mov    %edi,%r13d
+  800716:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800719:	48 ba e0 70 80 00 00 	movabs $0x8070e0,%rdx
+  800720:	00 00 00 
+  800723:	48 b8 e0 70 80 00 00 	movabs $0x8070e0,%rax
+  80072a:	00 00 00 
+  80072d:	48 39 c2             	cmp    %rax,%rdx
+  800730:	73 17                	jae    800749 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800732:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800735:	49 89 c4             	mov    %rax,%r12
+  800738:	48 83 c3 08          	add    $0x8,%rbx
+  80073c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800741:	ff 53 f8             	call   *-0x8(%rbx)
+  800744:	4c 39 e3             	cmp    %r12,%rbx
+  800747:	72 ef                	jb     800738 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800749:	48 b8 25 17 80 00 00 	movabs $0x801725,%rax
+  800750:	00 00 00 
+  800753:	ff d0                	call   *%rax
+  800755:	89 c2                	mov    %eax,%edx
+  800757:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  80075d:	48 89 d0             	mov    %rdx,%rax
+  800760:	48 c1 e0 04          	shl    $0x4,%rax
+  800764:	48 29 d0             	sub    %rdx,%rax
+  800767:	48 c1 e0 05          	shl    $0x5,%rax
+  80076b:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800772:	00 00 00 
+  800775:	48 01 d0             	add    %rdx,%rax
+  800778:	48 a3 00 00 81 00 00 	movabs %rax,0x810000
+  80077f:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800782:	45 85 ed             	test   %r13d,%r13d
+  800785:	7e 0d                	jle    800794 <libmain+0x8c>
+  800787:	49 8b 06             	mov    (%r14),%rax
+  80078a:	48 a3 40 70 80 00 00 	movabs %rax,0x807040
+  800791:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800794:	4c 89 f6             	mov    %r14,%rsi
+  800797:	44 89 ef             	mov    %r13d,%edi
+  80079a:	48 b8 61 01 80 00 00 	movabs $0x800161,%rax
+  8007a1:	00 00 00 
+  8007a4:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8007a6:	48 b8 bb 07 80 00 00 	movabs $0x8007bb,%rax
+  8007ad:	00 00 00 
+  8007b0:	ff d0                	call   *%rax
+#endif
+}
+  8007b2:	5b                   	pop    %rbx
+  8007b3:	41 5c                	pop    %r12
+  8007b5:	41 5d                	pop    %r13
+  8007b7:	41 5e                	pop    %r14
+  8007b9:	5d                   	pop    %rbp
+  8007ba:	c3                   	ret
+
+00000000008007bb <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8007bb:	55                   	push   %rbp
+  8007bc:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8007bf:	48 b8 2b 1f 80 00 00 	movabs $0x801f2b,%rax
+  8007c6:	00 00 00 
+  8007c9:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8007cb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8007d0:	48 b8 c2 16 80 00 00 	movabs $0x8016c2,%rax
+  8007d7:	00 00 00 
+  8007da:	ff d0                	call   *%rax
+}
+  8007dc:	5d                   	pop    %rbp
+  8007dd:	c3                   	ret
+
+00000000008007de <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8007de:	55                   	push   %rbp
+  8007df:	48 89 e5             	mov    %rsp,%rbp
+  8007e2:	41 56                	push   %r14
+  8007e4:	41 55                	push   %r13
+  8007e6:	41 54                	push   %r12
+  8007e8:	53                   	push   %rbx
+  8007e9:	48 83 ec 50          	sub    $0x50,%rsp
+  8007ed:	49 89 fc             	mov    %rdi,%r12
+  8007f0:	41 89 f5             	mov    %esi,%r13d
+  8007f3:	48 89 d3             	mov    %rdx,%rbx
+  8007f6:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8007fa:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8007fe:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800802:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800809:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80080d:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800811:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800815:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800819:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  800820:	00 00 00 
+  800823:	4c 8b 30             	mov    (%rax),%r14
+  800826:	48 b8 25 17 80 00 00 	movabs $0x801725,%rax
+  80082d:	00 00 00 
+  800830:	ff d0                	call   *%rax
+  800832:	89 c6                	mov    %eax,%esi
+  800834:	45 89 e8             	mov    %r13d,%r8d
+  800837:	4c 89 e1             	mov    %r12,%rcx
+  80083a:	4c 89 f2             	mov    %r14,%rdx
+  80083d:	48 bf 08 5a 80 00 00 	movabs $0x805a08,%rdi
+  800844:	00 00 00 
+  800847:	b8 00 00 00 00       	mov    $0x0,%eax
+  80084c:	49 bc 2e 09 80 00 00 	movabs $0x80092e,%r12
+  800853:	00 00 00 
+  800856:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800859:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80085d:	48 89 df             	mov    %rbx,%rdi
+  800860:	48 b8 ca 08 80 00 00 	movabs $0x8008ca,%rax
+  800867:	00 00 00 
+  80086a:	ff d0                	call   *%rax
+    cprintf("\n");
+  80086c:	48 bf 3f 59 80 00 00 	movabs $0x80593f,%rdi
+  800873:	00 00 00 
+  800876:	b8 00 00 00 00       	mov    $0x0,%eax
+  80087b:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80087e:	cc                   	int3
+  80087f:	eb fd                	jmp    80087e <_panic+0xa0>
+
+0000000000800881 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800881:	55                   	push   %rbp
+  800882:	48 89 e5             	mov    %rsp,%rbp
+  800885:	53                   	push   %rbx
+  800886:	48 83 ec 08          	sub    $0x8,%rsp
+  80088a:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80088d:	8b 06                	mov    (%rsi),%eax
+  80088f:	8d 50 01             	lea    0x1(%rax),%edx
+  800892:	89 16                	mov    %edx,(%rsi)
+  800894:	48 98                	cltq
+  800896:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80089b:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8008a1:	74 0a                	je     8008ad <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8008a3:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8008a7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8008ab:	c9                   	leave
+  8008ac:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8008ad:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8008b1:	be ff 00 00 00       	mov    $0xff,%esi
+  8008b6:	48 b8 7a 16 80 00 00 	movabs $0x80167a,%rax
+  8008bd:	00 00 00 
+  8008c0:	ff d0                	call   *%rax
+        state->offset = 0;
+  8008c2:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8008c8:	eb d9                	jmp    8008a3 <putch+0x22>
+
+00000000008008ca <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8008ca:	55                   	push   %rbp
+  8008cb:	48 89 e5             	mov    %rsp,%rbp
+  8008ce:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8008d5:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8008d8:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8008df:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8008e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008e9:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8008ec:	48 89 f1             	mov    %rsi,%rcx
+  8008ef:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8008f6:	48 bf 81 08 80 00 00 	movabs $0x800881,%rdi
+  8008fd:	00 00 00 
+  800900:	48 b8 7e 0a 80 00 00 	movabs $0x800a7e,%rax
+  800907:	00 00 00 
+  80090a:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80090c:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800913:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80091a:	48 b8 7a 16 80 00 00 	movabs $0x80167a,%rax
+  800921:	00 00 00 
+  800924:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800926:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80092c:	c9                   	leave
+  80092d:	c3                   	ret
+
+000000000080092e <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80092e:	55                   	push   %rbp
+  80092f:	48 89 e5             	mov    %rsp,%rbp
+  800932:	48 83 ec 50          	sub    $0x50,%rsp
+  800936:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80093a:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80093e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800942:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800946:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80094a:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800951:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800955:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800959:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80095d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800961:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800965:	48 b8 ca 08 80 00 00 	movabs $0x8008ca,%rax
+  80096c:	00 00 00 
+  80096f:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800971:	c9                   	leave
+  800972:	c3                   	ret
+
+0000000000800973 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800973:	55                   	push   %rbp
+  800974:	48 89 e5             	mov    %rsp,%rbp
+  800977:	41 57                	push   %r15
+  800979:	41 56                	push   %r14
+  80097b:	41 55                	push   %r13
+  80097d:	41 54                	push   %r12
+  80097f:	53                   	push   %rbx
+  800980:	48 83 ec 18          	sub    $0x18,%rsp
+  800984:	49 89 fc             	mov    %rdi,%r12
+  800987:	49 89 f5             	mov    %rsi,%r13
+  80098a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80098e:	8b 45 10             	mov    0x10(%rbp),%eax
+  800991:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800994:	41 89 cf             	mov    %ecx,%r15d
+  800997:	4c 39 fa             	cmp    %r15,%rdx
+  80099a:	73 5b                	jae    8009f7 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80099c:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8009a0:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8009a4:	85 db                	test   %ebx,%ebx
+  8009a6:	7e 0e                	jle    8009b6 <print_num+0x43>
+            putch(padc, put_arg);
+  8009a8:	4c 89 ee             	mov    %r13,%rsi
+  8009ab:	44 89 f7             	mov    %r14d,%edi
+  8009ae:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8009b1:	83 eb 01             	sub    $0x1,%ebx
+  8009b4:	75 f2                	jne    8009a8 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8009b6:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8009ba:	48 b9 3c 5a 80 00 00 	movabs $0x805a3c,%rcx
+  8009c1:	00 00 00 
+  8009c4:	48 b8 2b 5a 80 00 00 	movabs $0x805a2b,%rax
+  8009cb:	00 00 00 
+  8009ce:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8009d2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8009d6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009db:	49 f7 f7             	div    %r15
+  8009de:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8009e2:	4c 89 ee             	mov    %r13,%rsi
+  8009e5:	41 ff d4             	call   *%r12
+}
+  8009e8:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8009ec:	5b                   	pop    %rbx
+  8009ed:	41 5c                	pop    %r12
+  8009ef:	41 5d                	pop    %r13
+  8009f1:	41 5e                	pop    %r14
+  8009f3:	41 5f                	pop    %r15
+  8009f5:	5d                   	pop    %rbp
+  8009f6:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8009f7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8009fb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a00:	49 f7 f7             	div    %r15
+  800a03:	48 83 ec 08          	sub    $0x8,%rsp
+  800a07:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800a0b:	52                   	push   %rdx
+  800a0c:	45 0f be c9          	movsbl %r9b,%r9d
+  800a10:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800a14:	48 89 c2             	mov    %rax,%rdx
+  800a17:	48 b8 73 09 80 00 00 	movabs $0x800973,%rax
+  800a1e:	00 00 00 
+  800a21:	ff d0                	call   *%rax
+  800a23:	48 83 c4 10          	add    $0x10,%rsp
+  800a27:	eb 8d                	jmp    8009b6 <print_num+0x43>
+
+0000000000800a29 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800a29:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800a2d:	48 8b 06             	mov    (%rsi),%rax
+  800a30:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800a34:	73 0a                	jae    800a40 <sprintputch+0x17>
+        *state->start++ = ch;
+  800a36:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800a3a:	48 89 16             	mov    %rdx,(%rsi)
+  800a3d:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800a40:	c3                   	ret
+
+0000000000800a41 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800a41:	55                   	push   %rbp
+  800a42:	48 89 e5             	mov    %rsp,%rbp
+  800a45:	48 83 ec 50          	sub    $0x50,%rsp
+  800a49:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800a4d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800a51:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800a55:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800a5c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800a60:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a64:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800a68:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800a6c:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800a70:	48 b8 7e 0a 80 00 00 	movabs $0x800a7e,%rax
+  800a77:	00 00 00 
+  800a7a:	ff d0                	call   *%rax
+}
+  800a7c:	c9                   	leave
+  800a7d:	c3                   	ret
+
+0000000000800a7e <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800a7e:	55                   	push   %rbp
+  800a7f:	48 89 e5             	mov    %rsp,%rbp
+  800a82:	41 57                	push   %r15
+  800a84:	41 56                	push   %r14
+  800a86:	41 55                	push   %r13
+  800a88:	41 54                	push   %r12
+  800a8a:	53                   	push   %rbx
+  800a8b:	48 83 ec 38          	sub    $0x38,%rsp
+  800a8f:	49 89 fe             	mov    %rdi,%r14
+  800a92:	49 89 f5             	mov    %rsi,%r13
+  800a95:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800a98:	48 8b 01             	mov    (%rcx),%rax
+  800a9b:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800a9f:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800aa3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aa7:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800aab:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800aaf:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800ab3:	0f b6 3b             	movzbl (%rbx),%edi
+  800ab6:	40 80 ff 25          	cmp    $0x25,%dil
+  800aba:	74 18                	je     800ad4 <vprintfmt+0x56>
+            if (!ch) return;
+  800abc:	40 84 ff             	test   %dil,%dil
+  800abf:	0f 84 b1 06 00 00    	je     801176 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800ac5:	40 0f b6 ff          	movzbl %dil,%edi
+  800ac9:	4c 89 ee             	mov    %r13,%rsi
+  800acc:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800acf:	4c 89 e3             	mov    %r12,%rbx
+  800ad2:	eb db                	jmp    800aaf <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800ad4:	be 00 00 00 00       	mov    $0x0,%esi
+  800ad9:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800add:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800ae2:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800ae8:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800aef:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800af3:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800af8:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800afd:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800b00:	83 e8 23             	sub    $0x23,%eax
+  800b03:	3c 57                	cmp    $0x57,%al
+  800b05:	0f 87 51 06 00 00    	ja     80115c <vprintfmt+0x6de>
+  800b0b:	0f b6 c0             	movzbl %al,%eax
+  800b0e:	48 b9 e0 5b 80 00 00 	movabs $0x805be0,%rcx
+  800b15:	00 00 00 
+  800b18:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800b1b:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800b1e:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800b22:	eb cf                	jmp    800af3 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800b24:	49 89 dc             	mov    %rbx,%r12
+  800b27:	be 01 00 00 00       	mov    $0x1,%esi
+  800b2c:	eb c5                	jmp    800af3 <vprintfmt+0x75>
+            padc = ch;
+  800b2e:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800b32:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800b35:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800b38:	eb b9                	jmp    800af3 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800b3a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b3d:	83 f8 2f             	cmp    $0x2f,%eax
+  800b40:	77 24                	ja     800b66 <vprintfmt+0xe8>
+  800b42:	89 c1                	mov    %eax,%ecx
+  800b44:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800b48:	83 c0 08             	add    $0x8,%eax
+  800b4b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b4e:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800b51:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800b54:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800b58:	79 99                	jns    800af3 <vprintfmt+0x75>
+                width = precision;
+  800b5a:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800b5e:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800b64:	eb 8d                	jmp    800af3 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800b66:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800b6a:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800b6e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b72:	eb da                	jmp    800b4e <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800b74:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800b79:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800b7d:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800b83:	3c 39                	cmp    $0x39,%al
+  800b85:	77 1c                	ja     800ba3 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800b87:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800b8b:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800b8f:	0f b6 c0             	movzbl %al,%eax
+  800b92:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800b97:	0f b6 03             	movzbl (%rbx),%eax
+  800b9a:	3c 39                	cmp    $0x39,%al
+  800b9c:	76 e9                	jbe    800b87 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800b9e:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800ba1:	eb b1                	jmp    800b54 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800ba3:	49 89 dc             	mov    %rbx,%r12
+  800ba6:	eb ac                	jmp    800b54 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800ba8:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800bab:	85 c9                	test   %ecx,%ecx
+  800bad:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bb2:	0f 49 c1             	cmovns %ecx,%eax
+  800bb5:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800bb8:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800bbb:	e9 33 ff ff ff       	jmp    800af3 <vprintfmt+0x75>
+            lflag++;
+  800bc0:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800bc3:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800bc6:	e9 28 ff ff ff       	jmp    800af3 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800bcb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bce:	83 f8 2f             	cmp    $0x2f,%eax
+  800bd1:	77 19                	ja     800bec <vprintfmt+0x16e>
+  800bd3:	89 c2                	mov    %eax,%edx
+  800bd5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bd9:	83 c0 08             	add    $0x8,%eax
+  800bdc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bdf:	8b 3a                	mov    (%rdx),%edi
+  800be1:	4c 89 ee             	mov    %r13,%rsi
+  800be4:	41 ff d6             	call   *%r14
+            break;
+  800be7:	e9 c3 fe ff ff       	jmp    800aaf <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800bec:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bf0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bf4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bf8:	eb e5                	jmp    800bdf <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800bfa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bfd:	83 f8 2f             	cmp    $0x2f,%eax
+  800c00:	77 5a                	ja     800c5c <vprintfmt+0x1de>
+  800c02:	89 c2                	mov    %eax,%edx
+  800c04:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c08:	83 c0 08             	add    $0x8,%eax
+  800c0b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800c0e:	8b 02                	mov    (%rdx),%eax
+  800c10:	89 c1                	mov    %eax,%ecx
+  800c12:	f7 d9                	neg    %ecx
+  800c14:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800c17:	83 f9 16             	cmp    $0x16,%ecx
+  800c1a:	7f 4e                	jg     800c6a <vprintfmt+0x1ec>
+  800c1c:	48 63 c1             	movslq %ecx,%rax
+  800c1f:	48 ba a0 5e 80 00 00 	movabs $0x805ea0,%rdx
+  800c26:	00 00 00 
+  800c29:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800c2d:	48 85 c0             	test   %rax,%rax
+  800c30:	74 38                	je     800c6a <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800c32:	48 89 c1             	mov    %rax,%rcx
+  800c35:	48 ba 63 61 80 00 00 	movabs $0x806163,%rdx
+  800c3c:	00 00 00 
+  800c3f:	4c 89 ee             	mov    %r13,%rsi
+  800c42:	4c 89 f7             	mov    %r14,%rdi
+  800c45:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c4a:	49 b8 41 0a 80 00 00 	movabs $0x800a41,%r8
+  800c51:	00 00 00 
+  800c54:	41 ff d0             	call   *%r8
+  800c57:	e9 53 fe ff ff       	jmp    800aaf <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800c5c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c60:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c64:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c68:	eb a4                	jmp    800c0e <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800c6a:	48 ba 54 5a 80 00 00 	movabs $0x805a54,%rdx
+  800c71:	00 00 00 
+  800c74:	4c 89 ee             	mov    %r13,%rsi
+  800c77:	4c 89 f7             	mov    %r14,%rdi
+  800c7a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c7f:	49 b8 41 0a 80 00 00 	movabs $0x800a41,%r8
+  800c86:	00 00 00 
+  800c89:	41 ff d0             	call   *%r8
+  800c8c:	e9 1e fe ff ff       	jmp    800aaf <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800c91:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c94:	83 f8 2f             	cmp    $0x2f,%eax
+  800c97:	77 6c                	ja     800d05 <vprintfmt+0x287>
+  800c99:	89 c2                	mov    %eax,%edx
+  800c9b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c9f:	83 c0 08             	add    $0x8,%eax
+  800ca2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ca5:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800ca8:	48 85 d2             	test   %rdx,%rdx
+  800cab:	48 b8 4d 5a 80 00 00 	movabs $0x805a4d,%rax
+  800cb2:	00 00 00 
+  800cb5:	48 0f 45 c2          	cmovne %rdx,%rax
+  800cb9:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800cbd:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800cc1:	7e 06                	jle    800cc9 <vprintfmt+0x24b>
+  800cc3:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800cc7:	75 4a                	jne    800d13 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800cc9:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800ccd:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800cd1:	0f b6 00             	movzbl (%rax),%eax
+  800cd4:	84 c0                	test   %al,%al
+  800cd6:	0f 85 9a 00 00 00    	jne    800d76 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800cdc:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800cdf:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800ce3:	85 c0                	test   %eax,%eax
+  800ce5:	0f 8e c4 fd ff ff    	jle    800aaf <vprintfmt+0x31>
+  800ceb:	4c 89 ee             	mov    %r13,%rsi
+  800cee:	bf 20 00 00 00       	mov    $0x20,%edi
+  800cf3:	41 ff d6             	call   *%r14
+  800cf6:	41 83 ec 01          	sub    $0x1,%r12d
+  800cfa:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800cfe:	75 eb                	jne    800ceb <vprintfmt+0x26d>
+  800d00:	e9 aa fd ff ff       	jmp    800aaf <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800d05:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d09:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d0d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d11:	eb 92                	jmp    800ca5 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800d13:	49 63 f7             	movslq %r15d,%rsi
+  800d16:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800d1a:	48 b8 30 12 80 00 00 	movabs $0x801230,%rax
+  800d21:	00 00 00 
+  800d24:	ff d0                	call   *%rax
+  800d26:	48 89 c2             	mov    %rax,%rdx
+  800d29:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800d2c:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800d2e:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800d31:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800d34:	85 c0                	test   %eax,%eax
+  800d36:	7e 91                	jle    800cc9 <vprintfmt+0x24b>
+  800d38:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800d3d:	4c 89 ee             	mov    %r13,%rsi
+  800d40:	44 89 e7             	mov    %r12d,%edi
+  800d43:	41 ff d6             	call   *%r14
+  800d46:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800d4a:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800d4d:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800d50:	75 eb                	jne    800d3d <vprintfmt+0x2bf>
+  800d52:	e9 72 ff ff ff       	jmp    800cc9 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800d57:	0f b6 f8             	movzbl %al,%edi
+  800d5a:	4c 89 ee             	mov    %r13,%rsi
+  800d5d:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800d60:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800d64:	49 83 c4 01          	add    $0x1,%r12
+  800d68:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800d6e:	84 c0                	test   %al,%al
+  800d70:	0f 84 66 ff ff ff    	je     800cdc <vprintfmt+0x25e>
+  800d76:	45 85 ff             	test   %r15d,%r15d
+  800d79:	78 0a                	js     800d85 <vprintfmt+0x307>
+  800d7b:	41 83 ef 01          	sub    $0x1,%r15d
+  800d7f:	0f 88 57 ff ff ff    	js     800cdc <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800d85:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800d89:	74 cc                	je     800d57 <vprintfmt+0x2d9>
+  800d8b:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800d8e:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800d93:	80 fa 5e             	cmp    $0x5e,%dl
+  800d96:	77 c2                	ja     800d5a <vprintfmt+0x2dc>
+  800d98:	eb bd                	jmp    800d57 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800d9a:	40 84 f6             	test   %sil,%sil
+  800d9d:	75 26                	jne    800dc5 <vprintfmt+0x347>
+    switch (lflag) {
+  800d9f:	85 d2                	test   %edx,%edx
+  800da1:	74 59                	je     800dfc <vprintfmt+0x37e>
+  800da3:	83 fa 01             	cmp    $0x1,%edx
+  800da6:	74 7b                	je     800e23 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800da8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800dab:	83 f8 2f             	cmp    $0x2f,%eax
+  800dae:	0f 87 96 00 00 00    	ja     800e4a <vprintfmt+0x3cc>
+  800db4:	89 c2                	mov    %eax,%edx
+  800db6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800dba:	83 c0 08             	add    $0x8,%eax
+  800dbd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800dc0:	4c 8b 22             	mov    (%rdx),%r12
+  800dc3:	eb 17                	jmp    800ddc <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800dc5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800dc8:	83 f8 2f             	cmp    $0x2f,%eax
+  800dcb:	77 21                	ja     800dee <vprintfmt+0x370>
+  800dcd:	89 c2                	mov    %eax,%edx
+  800dcf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800dd3:	83 c0 08             	add    $0x8,%eax
+  800dd6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800dd9:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800ddc:	4d 85 e4             	test   %r12,%r12
+  800ddf:	78 7a                	js     800e5b <vprintfmt+0x3dd>
+            num = i;
+  800de1:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800de4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800de9:	e9 50 02 00 00       	jmp    80103e <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800dee:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800df2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800df6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dfa:	eb dd                	jmp    800dd9 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800dfc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800dff:	83 f8 2f             	cmp    $0x2f,%eax
+  800e02:	77 11                	ja     800e15 <vprintfmt+0x397>
+  800e04:	89 c2                	mov    %eax,%edx
+  800e06:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e0a:	83 c0 08             	add    $0x8,%eax
+  800e0d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e10:	4c 63 22             	movslq (%rdx),%r12
+  800e13:	eb c7                	jmp    800ddc <vprintfmt+0x35e>
+  800e15:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e19:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e1d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e21:	eb ed                	jmp    800e10 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800e23:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e26:	83 f8 2f             	cmp    $0x2f,%eax
+  800e29:	77 11                	ja     800e3c <vprintfmt+0x3be>
+  800e2b:	89 c2                	mov    %eax,%edx
+  800e2d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e31:	83 c0 08             	add    $0x8,%eax
+  800e34:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e37:	4c 8b 22             	mov    (%rdx),%r12
+  800e3a:	eb a0                	jmp    800ddc <vprintfmt+0x35e>
+  800e3c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e40:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e44:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e48:	eb ed                	jmp    800e37 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800e4a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e4e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e52:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e56:	e9 65 ff ff ff       	jmp    800dc0 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800e5b:	4c 89 ee             	mov    %r13,%rsi
+  800e5e:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800e63:	41 ff d6             	call   *%r14
+                i = -i;
+  800e66:	49 f7 dc             	neg    %r12
+  800e69:	e9 73 ff ff ff       	jmp    800de1 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800e6e:	40 84 f6             	test   %sil,%sil
+  800e71:	75 32                	jne    800ea5 <vprintfmt+0x427>
+    switch (lflag) {
+  800e73:	85 d2                	test   %edx,%edx
+  800e75:	74 5d                	je     800ed4 <vprintfmt+0x456>
+  800e77:	83 fa 01             	cmp    $0x1,%edx
+  800e7a:	0f 84 82 00 00 00    	je     800f02 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800e80:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e83:	83 f8 2f             	cmp    $0x2f,%eax
+  800e86:	0f 87 a5 00 00 00    	ja     800f31 <vprintfmt+0x4b3>
+  800e8c:	89 c2                	mov    %eax,%edx
+  800e8e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e92:	83 c0 08             	add    $0x8,%eax
+  800e95:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e98:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800e9b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800ea0:	e9 99 01 00 00       	jmp    80103e <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800ea5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ea8:	83 f8 2f             	cmp    $0x2f,%eax
+  800eab:	77 19                	ja     800ec6 <vprintfmt+0x448>
+  800ead:	89 c2                	mov    %eax,%edx
+  800eaf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800eb3:	83 c0 08             	add    $0x8,%eax
+  800eb6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800eb9:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800ebc:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800ec1:	e9 78 01 00 00       	jmp    80103e <vprintfmt+0x5c0>
+  800ec6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800eca:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ece:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ed2:	eb e5                	jmp    800eb9 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800ed4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ed7:	83 f8 2f             	cmp    $0x2f,%eax
+  800eda:	77 18                	ja     800ef4 <vprintfmt+0x476>
+  800edc:	89 c2                	mov    %eax,%edx
+  800ede:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ee2:	83 c0 08             	add    $0x8,%eax
+  800ee5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ee8:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800eea:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800eef:	e9 4a 01 00 00       	jmp    80103e <vprintfmt+0x5c0>
+  800ef4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ef8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800efc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f00:	eb e6                	jmp    800ee8 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800f02:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f05:	83 f8 2f             	cmp    $0x2f,%eax
+  800f08:	77 19                	ja     800f23 <vprintfmt+0x4a5>
+  800f0a:	89 c2                	mov    %eax,%edx
+  800f0c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f10:	83 c0 08             	add    $0x8,%eax
+  800f13:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f16:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800f19:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800f1e:	e9 1b 01 00 00       	jmp    80103e <vprintfmt+0x5c0>
+  800f23:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f27:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f2b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f2f:	eb e5                	jmp    800f16 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800f31:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f35:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f39:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f3d:	e9 56 ff ff ff       	jmp    800e98 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800f42:	40 84 f6             	test   %sil,%sil
+  800f45:	75 2e                	jne    800f75 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800f47:	85 d2                	test   %edx,%edx
+  800f49:	74 59                	je     800fa4 <vprintfmt+0x526>
+  800f4b:	83 fa 01             	cmp    $0x1,%edx
+  800f4e:	74 7f                	je     800fcf <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800f50:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f53:	83 f8 2f             	cmp    $0x2f,%eax
+  800f56:	0f 87 9f 00 00 00    	ja     800ffb <vprintfmt+0x57d>
+  800f5c:	89 c2                	mov    %eax,%edx
+  800f5e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f62:	83 c0 08             	add    $0x8,%eax
+  800f65:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f68:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800f6b:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800f70:	e9 c9 00 00 00       	jmp    80103e <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800f75:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f78:	83 f8 2f             	cmp    $0x2f,%eax
+  800f7b:	77 19                	ja     800f96 <vprintfmt+0x518>
+  800f7d:	89 c2                	mov    %eax,%edx
+  800f7f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f83:	83 c0 08             	add    $0x8,%eax
+  800f86:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f89:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800f8c:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800f91:	e9 a8 00 00 00       	jmp    80103e <vprintfmt+0x5c0>
+  800f96:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f9a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f9e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800fa2:	eb e5                	jmp    800f89 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800fa4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800fa7:	83 f8 2f             	cmp    $0x2f,%eax
+  800faa:	77 15                	ja     800fc1 <vprintfmt+0x543>
+  800fac:	89 c2                	mov    %eax,%edx
+  800fae:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800fb2:	83 c0 08             	add    $0x8,%eax
+  800fb5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800fb8:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800fba:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800fbf:	eb 7d                	jmp    80103e <vprintfmt+0x5c0>
+  800fc1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800fc5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800fc9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800fcd:	eb e9                	jmp    800fb8 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800fcf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800fd2:	83 f8 2f             	cmp    $0x2f,%eax
+  800fd5:	77 16                	ja     800fed <vprintfmt+0x56f>
+  800fd7:	89 c2                	mov    %eax,%edx
+  800fd9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800fdd:	83 c0 08             	add    $0x8,%eax
+  800fe0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800fe3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800fe6:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800feb:	eb 51                	jmp    80103e <vprintfmt+0x5c0>
+  800fed:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ff1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ff5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ff9:	eb e8                	jmp    800fe3 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800ffb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800fff:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801003:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801007:	e9 5c ff ff ff       	jmp    800f68 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  80100c:	4c 89 ee             	mov    %r13,%rsi
+  80100f:	bf 30 00 00 00       	mov    $0x30,%edi
+  801014:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  801017:	4c 89 ee             	mov    %r13,%rsi
+  80101a:	bf 78 00 00 00       	mov    $0x78,%edi
+  80101f:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  801022:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801025:	83 f8 2f             	cmp    $0x2f,%eax
+  801028:	77 47                	ja     801071 <vprintfmt+0x5f3>
+  80102a:	89 c2                	mov    %eax,%edx
+  80102c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801030:	83 c0 08             	add    $0x8,%eax
+  801033:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801036:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801039:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  80103e:	48 83 ec 08          	sub    $0x8,%rsp
+  801042:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  801046:	0f 94 c0             	sete   %al
+  801049:	0f b6 c0             	movzbl %al,%eax
+  80104c:	50                   	push   %rax
+  80104d:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  801052:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  801056:	4c 89 ee             	mov    %r13,%rsi
+  801059:	4c 89 f7             	mov    %r14,%rdi
+  80105c:	48 b8 73 09 80 00 00 	movabs $0x800973,%rax
+  801063:	00 00 00 
+  801066:	ff d0                	call   *%rax
+            break;
+  801068:	48 83 c4 10          	add    $0x10,%rsp
+  80106c:	e9 3e fa ff ff       	jmp    800aaf <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  801071:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801075:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801079:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80107d:	eb b7                	jmp    801036 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  80107f:	40 84 f6             	test   %sil,%sil
+  801082:	75 2b                	jne    8010af <vprintfmt+0x631>
+    switch (lflag) {
+  801084:	85 d2                	test   %edx,%edx
+  801086:	74 56                	je     8010de <vprintfmt+0x660>
+  801088:	83 fa 01             	cmp    $0x1,%edx
+  80108b:	74 7f                	je     80110c <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  80108d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801090:	83 f8 2f             	cmp    $0x2f,%eax
+  801093:	0f 87 a2 00 00 00    	ja     80113b <vprintfmt+0x6bd>
+  801099:	89 c2                	mov    %eax,%edx
+  80109b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80109f:	83 c0 08             	add    $0x8,%eax
+  8010a2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8010a5:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8010a8:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8010ad:	eb 8f                	jmp    80103e <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8010af:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8010b2:	83 f8 2f             	cmp    $0x2f,%eax
+  8010b5:	77 19                	ja     8010d0 <vprintfmt+0x652>
+  8010b7:	89 c2                	mov    %eax,%edx
+  8010b9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8010bd:	83 c0 08             	add    $0x8,%eax
+  8010c0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8010c3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8010c6:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8010cb:	e9 6e ff ff ff       	jmp    80103e <vprintfmt+0x5c0>
+  8010d0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8010d4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8010d8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8010dc:	eb e5                	jmp    8010c3 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  8010de:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8010e1:	83 f8 2f             	cmp    $0x2f,%eax
+  8010e4:	77 18                	ja     8010fe <vprintfmt+0x680>
+  8010e6:	89 c2                	mov    %eax,%edx
+  8010e8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8010ec:	83 c0 08             	add    $0x8,%eax
+  8010ef:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8010f2:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8010f4:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8010f9:	e9 40 ff ff ff       	jmp    80103e <vprintfmt+0x5c0>
+  8010fe:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801102:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801106:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80110a:	eb e6                	jmp    8010f2 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  80110c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80110f:	83 f8 2f             	cmp    $0x2f,%eax
+  801112:	77 19                	ja     80112d <vprintfmt+0x6af>
+  801114:	89 c2                	mov    %eax,%edx
+  801116:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80111a:	83 c0 08             	add    $0x8,%eax
+  80111d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801120:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801123:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  801128:	e9 11 ff ff ff       	jmp    80103e <vprintfmt+0x5c0>
+  80112d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801131:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801135:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801139:	eb e5                	jmp    801120 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  80113b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80113f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801143:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801147:	e9 59 ff ff ff       	jmp    8010a5 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  80114c:	4c 89 ee             	mov    %r13,%rsi
+  80114f:	bf 25 00 00 00       	mov    $0x25,%edi
+  801154:	41 ff d6             	call   *%r14
+            break;
+  801157:	e9 53 f9 ff ff       	jmp    800aaf <vprintfmt+0x31>
+            putch('%', put_arg);
+  80115c:	4c 89 ee             	mov    %r13,%rsi
+  80115f:	bf 25 00 00 00       	mov    $0x25,%edi
+  801164:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  801167:	48 83 eb 01          	sub    $0x1,%rbx
+  80116b:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  80116f:	75 f6                	jne    801167 <vprintfmt+0x6e9>
+  801171:	e9 39 f9 ff ff       	jmp    800aaf <vprintfmt+0x31>
+}
+  801176:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80117a:	5b                   	pop    %rbx
+  80117b:	41 5c                	pop    %r12
+  80117d:	41 5d                	pop    %r13
+  80117f:	41 5e                	pop    %r14
+  801181:	41 5f                	pop    %r15
+  801183:	5d                   	pop    %rbp
+  801184:	c3                   	ret
+
+0000000000801185 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  801185:	55                   	push   %rbp
+  801186:	48 89 e5             	mov    %rsp,%rbp
+  801189:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  80118d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801191:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  801196:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  80119a:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  8011a1:	48 85 ff             	test   %rdi,%rdi
+  8011a4:	74 2b                	je     8011d1 <vsnprintf+0x4c>
+  8011a6:	48 85 f6             	test   %rsi,%rsi
+  8011a9:	74 26                	je     8011d1 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  8011ab:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8011af:	48 bf 29 0a 80 00 00 	movabs $0x800a29,%rdi
+  8011b6:	00 00 00 
+  8011b9:	48 b8 7e 0a 80 00 00 	movabs $0x800a7e,%rax
+  8011c0:	00 00 00 
+  8011c3:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  8011c5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8011c9:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  8011cc:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8011cf:	c9                   	leave
+  8011d0:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  8011d1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011d6:	eb f7                	jmp    8011cf <vsnprintf+0x4a>
+
+00000000008011d8 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  8011d8:	55                   	push   %rbp
+  8011d9:	48 89 e5             	mov    %rsp,%rbp
+  8011dc:	48 83 ec 50          	sub    $0x50,%rsp
+  8011e0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8011e4:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8011e8:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8011ec:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8011f3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8011f7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8011fb:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8011ff:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  801203:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801207:	48 b8 85 11 80 00 00 	movabs $0x801185,%rax
+  80120e:	00 00 00 
+  801211:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  801213:	c9                   	leave
+  801214:	c3                   	ret
+
+0000000000801215 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  801215:	80 3f 00             	cmpb   $0x0,(%rdi)
+  801218:	74 10                	je     80122a <strlen+0x15>
+    size_t n = 0;
+  80121a:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  80121f:	48 83 c0 01          	add    $0x1,%rax
+  801223:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  801227:	75 f6                	jne    80121f <strlen+0xa>
+  801229:	c3                   	ret
+    size_t n = 0;
+  80122a:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  80122f:	c3                   	ret
+
+0000000000801230 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  801230:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  801233:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  801238:	48 85 f6             	test   %rsi,%rsi
+  80123b:	74 11                	je     80124e <strnlen+0x1e>
+  80123d:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  801241:	74 0c                	je     80124f <strnlen+0x1f>
+  801243:	48 83 c2 01          	add    $0x1,%rdx
+  801247:	48 39 d0             	cmp    %rdx,%rax
+  80124a:	75 f1                	jne    80123d <strnlen+0xd>
+  80124c:	eb 04                	jmp    801252 <strnlen+0x22>
+  80124e:	c3                   	ret
+  80124f:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  801252:	c3                   	ret
+
+0000000000801253 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  801253:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  801256:	ba 00 00 00 00       	mov    $0x0,%edx
+  80125b:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  80125f:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  801262:	48 83 c2 01          	add    $0x1,%rdx
+  801266:	84 c9                	test   %cl,%cl
+  801268:	75 f1                	jne    80125b <strcpy+0x8>
+        ;
+    return res;
+}
+  80126a:	c3                   	ret
+
+000000000080126b <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  80126b:	55                   	push   %rbp
+  80126c:	48 89 e5             	mov    %rsp,%rbp
+  80126f:	41 54                	push   %r12
+  801271:	53                   	push   %rbx
+  801272:	48 89 fb             	mov    %rdi,%rbx
+  801275:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  801278:	48 b8 15 12 80 00 00 	movabs $0x801215,%rax
+  80127f:	00 00 00 
+  801282:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  801284:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  801288:	4c 89 e6             	mov    %r12,%rsi
+  80128b:	48 b8 53 12 80 00 00 	movabs $0x801253,%rax
+  801292:	00 00 00 
+  801295:	ff d0                	call   *%rax
+    return dst;
+}
+  801297:	48 89 d8             	mov    %rbx,%rax
+  80129a:	5b                   	pop    %rbx
+  80129b:	41 5c                	pop    %r12
+  80129d:	5d                   	pop    %rbp
+  80129e:	c3                   	ret
+
+000000000080129f <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80129f:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  8012a2:	48 85 d2             	test   %rdx,%rdx
+  8012a5:	74 1f                	je     8012c6 <strncpy+0x27>
+  8012a7:	48 01 fa             	add    %rdi,%rdx
+  8012aa:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  8012ad:	48 83 c1 01          	add    $0x1,%rcx
+  8012b1:	44 0f b6 06          	movzbl (%rsi),%r8d
+  8012b5:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  8012b9:	41 80 f8 01          	cmp    $0x1,%r8b
+  8012bd:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  8012c1:	48 39 ca             	cmp    %rcx,%rdx
+  8012c4:	75 e7                	jne    8012ad <strncpy+0xe>
+    }
+    return ret;
+}
+  8012c6:	c3                   	ret
+
+00000000008012c7 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  8012c7:	48 89 f8             	mov    %rdi,%rax
+  8012ca:	48 85 d2             	test   %rdx,%rdx
+  8012cd:	74 24                	je     8012f3 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  8012cf:	48 83 ea 01          	sub    $0x1,%rdx
+  8012d3:	74 1b                	je     8012f0 <strlcpy+0x29>
+  8012d5:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  8012d9:	0f b6 16             	movzbl (%rsi),%edx
+  8012dc:	84 d2                	test   %dl,%dl
+  8012de:	74 10                	je     8012f0 <strlcpy+0x29>
+            *dst++ = *src++;
+  8012e0:	48 83 c6 01          	add    $0x1,%rsi
+  8012e4:	48 83 c0 01          	add    $0x1,%rax
+  8012e8:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  8012eb:	48 39 c8             	cmp    %rcx,%rax
+  8012ee:	75 e9                	jne    8012d9 <strlcpy+0x12>
+        *dst = '\0';
+  8012f0:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  8012f3:	48 29 f8             	sub    %rdi,%rax
+}
+  8012f6:	c3                   	ret
+
+00000000008012f7 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  8012f7:	0f b6 07             	movzbl (%rdi),%eax
+  8012fa:	84 c0                	test   %al,%al
+  8012fc:	74 13                	je     801311 <strcmp+0x1a>
+  8012fe:	38 06                	cmp    %al,(%rsi)
+  801300:	75 0f                	jne    801311 <strcmp+0x1a>
+  801302:	48 83 c7 01          	add    $0x1,%rdi
+  801306:	48 83 c6 01          	add    $0x1,%rsi
+  80130a:	0f b6 07             	movzbl (%rdi),%eax
+  80130d:	84 c0                	test   %al,%al
+  80130f:	75 ed                	jne    8012fe <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801311:	0f b6 c0             	movzbl %al,%eax
+  801314:	0f b6 16             	movzbl (%rsi),%edx
+  801317:	29 d0                	sub    %edx,%eax
+}
+  801319:	c3                   	ret
+
+000000000080131a <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  80131a:	48 85 d2             	test   %rdx,%rdx
+  80131d:	74 1f                	je     80133e <strncmp+0x24>
+  80131f:	0f b6 07             	movzbl (%rdi),%eax
+  801322:	84 c0                	test   %al,%al
+  801324:	74 1e                	je     801344 <strncmp+0x2a>
+  801326:	3a 06                	cmp    (%rsi),%al
+  801328:	75 1a                	jne    801344 <strncmp+0x2a>
+  80132a:	48 83 c7 01          	add    $0x1,%rdi
+  80132e:	48 83 c6 01          	add    $0x1,%rsi
+  801332:	48 83 ea 01          	sub    $0x1,%rdx
+  801336:	75 e7                	jne    80131f <strncmp+0x5>
+
+    if (!n) return 0;
+  801338:	b8 00 00 00 00       	mov    $0x0,%eax
+  80133d:	c3                   	ret
+  80133e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801343:	c3                   	ret
+  801344:	48 85 d2             	test   %rdx,%rdx
+  801347:	74 09                	je     801352 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801349:	0f b6 07             	movzbl (%rdi),%eax
+  80134c:	0f b6 16             	movzbl (%rsi),%edx
+  80134f:	29 d0                	sub    %edx,%eax
+  801351:	c3                   	ret
+    if (!n) return 0;
+  801352:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801357:	c3                   	ret
+
+0000000000801358 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  801358:	0f b6 17             	movzbl (%rdi),%edx
+  80135b:	84 d2                	test   %dl,%dl
+  80135d:	74 18                	je     801377 <strchr+0x1f>
+        if (*str == c) {
+  80135f:	0f be d2             	movsbl %dl,%edx
+  801362:	39 f2                	cmp    %esi,%edx
+  801364:	74 17                	je     80137d <strchr+0x25>
+    for (; *str; str++) {
+  801366:	48 83 c7 01          	add    $0x1,%rdi
+  80136a:	0f b6 17             	movzbl (%rdi),%edx
+  80136d:	84 d2                	test   %dl,%dl
+  80136f:	75 ee                	jne    80135f <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  801371:	b8 00 00 00 00       	mov    $0x0,%eax
+  801376:	c3                   	ret
+  801377:	b8 00 00 00 00       	mov    $0x0,%eax
+  80137c:	c3                   	ret
+  80137d:	48 89 f8             	mov    %rdi,%rax
+}
+  801380:	c3                   	ret
+
+0000000000801381 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  801381:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  801384:	0f b6 17             	movzbl (%rdi),%edx
+  801387:	84 d2                	test   %dl,%dl
+  801389:	74 13                	je     80139e <strfind+0x1d>
+  80138b:	0f be d2             	movsbl %dl,%edx
+  80138e:	39 f2                	cmp    %esi,%edx
+  801390:	74 0b                	je     80139d <strfind+0x1c>
+  801392:	48 83 c0 01          	add    $0x1,%rax
+  801396:	0f b6 10             	movzbl (%rax),%edx
+  801399:	84 d2                	test   %dl,%dl
+  80139b:	75 ee                	jne    80138b <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  80139d:	c3                   	ret
+  80139e:	c3                   	ret
+
+000000000080139f <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  80139f:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8013a2:	48 89 f8             	mov    %rdi,%rax
+  8013a5:	48 f7 d8             	neg    %rax
+  8013a8:	83 e0 07             	and    $0x7,%eax
+  8013ab:	49 89 d1             	mov    %rdx,%r9
+  8013ae:	49 29 c1             	sub    %rax,%r9
+  8013b1:	78 36                	js     8013e9 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8013b3:	40 0f b6 c6          	movzbl %sil,%eax
+  8013b7:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8013be:	01 01 01 
+  8013c1:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8013c5:	40 f6 c7 07          	test   $0x7,%dil
+  8013c9:	75 38                	jne    801403 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8013cb:	4c 89 c9             	mov    %r9,%rcx
+  8013ce:	48 c1 f9 03          	sar    $0x3,%rcx
+  8013d2:	74 0c                	je     8013e0 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8013d4:	fc                   	cld
+  8013d5:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8013d8:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8013dc:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8013e0:	4d 85 c9             	test   %r9,%r9
+  8013e3:	75 45                	jne    80142a <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8013e5:	4c 89 c0             	mov    %r8,%rax
+  8013e8:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8013e9:	48 85 d2             	test   %rdx,%rdx
+  8013ec:	74 f7                	je     8013e5 <memset+0x46>
+  8013ee:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8013f1:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8013f4:	48 83 c0 01          	add    $0x1,%rax
+  8013f8:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8013fc:	48 39 c2             	cmp    %rax,%rdx
+  8013ff:	75 f3                	jne    8013f4 <memset+0x55>
+  801401:	eb e2                	jmp    8013e5 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  801403:	40 f6 c7 01          	test   $0x1,%dil
+  801407:	74 06                	je     80140f <memset+0x70>
+  801409:	88 07                	mov    %al,(%rdi)
+  80140b:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80140f:	40 f6 c7 02          	test   $0x2,%dil
+  801413:	74 07                	je     80141c <memset+0x7d>
+  801415:	66 89 07             	mov    %ax,(%rdi)
+  801418:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80141c:	40 f6 c7 04          	test   $0x4,%dil
+  801420:	74 a9                	je     8013cb <memset+0x2c>
+  801422:	89 07                	mov    %eax,(%rdi)
+  801424:	48 83 c7 04          	add    $0x4,%rdi
+  801428:	eb a1                	jmp    8013cb <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80142a:	41 f6 c1 04          	test   $0x4,%r9b
+  80142e:	74 06                	je     801436 <memset+0x97>
+  801430:	89 07                	mov    %eax,(%rdi)
+  801432:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801436:	41 f6 c1 02          	test   $0x2,%r9b
+  80143a:	74 07                	je     801443 <memset+0xa4>
+  80143c:	66 89 07             	mov    %ax,(%rdi)
+  80143f:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  801443:	41 f6 c1 01          	test   $0x1,%r9b
+  801447:	74 9c                	je     8013e5 <memset+0x46>
+  801449:	88 07                	mov    %al,(%rdi)
+  80144b:	eb 98                	jmp    8013e5 <memset+0x46>
+
+000000000080144d <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80144d:	48 89 f8             	mov    %rdi,%rax
+  801450:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  801453:	48 39 fe             	cmp    %rdi,%rsi
+  801456:	73 3b                	jae    801493 <memmove+0x46>
+  801458:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80145c:	48 39 d7             	cmp    %rdx,%rdi
+  80145f:	73 32                	jae    801493 <memmove+0x46>
+        s += n;
+        d += n;
+  801461:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801465:	48 89 d6             	mov    %rdx,%rsi
+  801468:	48 09 fe             	or     %rdi,%rsi
+  80146b:	48 09 ce             	or     %rcx,%rsi
+  80146e:	40 f6 c6 07          	test   $0x7,%sil
+  801472:	75 12                	jne    801486 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  801474:	48 83 ef 08          	sub    $0x8,%rdi
+  801478:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  80147c:	48 c1 e9 03          	shr    $0x3,%rcx
+  801480:	fd                   	std
+  801481:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  801484:	fc                   	cld
+  801485:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801486:	48 83 ef 01          	sub    $0x1,%rdi
+  80148a:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  80148e:	fd                   	std
+  80148f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801491:	eb f1                	jmp    801484 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801493:	48 89 f2             	mov    %rsi,%rdx
+  801496:	48 09 c2             	or     %rax,%rdx
+  801499:	48 09 ca             	or     %rcx,%rdx
+  80149c:	f6 c2 07             	test   $0x7,%dl
+  80149f:	75 0c                	jne    8014ad <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8014a1:	48 c1 e9 03          	shr    $0x3,%rcx
+  8014a5:	48 89 c7             	mov    %rax,%rdi
+  8014a8:	fc                   	cld
+  8014a9:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8014ac:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8014ad:	48 89 c7             	mov    %rax,%rdi
+  8014b0:	fc                   	cld
+  8014b1:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8014b3:	c3                   	ret
+
+00000000008014b4 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8014b4:	55                   	push   %rbp
+  8014b5:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8014b8:	48 b8 4d 14 80 00 00 	movabs $0x80144d,%rax
+  8014bf:	00 00 00 
+  8014c2:	ff d0                	call   *%rax
+}
+  8014c4:	5d                   	pop    %rbp
+  8014c5:	c3                   	ret
+
+00000000008014c6 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8014c6:	55                   	push   %rbp
+  8014c7:	48 89 e5             	mov    %rsp,%rbp
+  8014ca:	41 57                	push   %r15
+  8014cc:	41 56                	push   %r14
+  8014ce:	41 55                	push   %r13
+  8014d0:	41 54                	push   %r12
+  8014d2:	53                   	push   %rbx
+  8014d3:	48 83 ec 08          	sub    $0x8,%rsp
+  8014d7:	49 89 fe             	mov    %rdi,%r14
+  8014da:	49 89 f7             	mov    %rsi,%r15
+  8014dd:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8014e0:	48 89 f7             	mov    %rsi,%rdi
+  8014e3:	48 b8 15 12 80 00 00 	movabs $0x801215,%rax
+  8014ea:	00 00 00 
+  8014ed:	ff d0                	call   *%rax
+  8014ef:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8014f2:	48 89 de             	mov    %rbx,%rsi
+  8014f5:	4c 89 f7             	mov    %r14,%rdi
+  8014f8:	48 b8 30 12 80 00 00 	movabs $0x801230,%rax
+  8014ff:	00 00 00 
+  801502:	ff d0                	call   *%rax
+  801504:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801507:	48 39 c3             	cmp    %rax,%rbx
+  80150a:	74 36                	je     801542 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80150c:	48 89 d8             	mov    %rbx,%rax
+  80150f:	4c 29 e8             	sub    %r13,%rax
+  801512:	49 39 c4             	cmp    %rax,%r12
+  801515:	73 31                	jae    801548 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801517:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80151c:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801520:	4c 89 fe             	mov    %r15,%rsi
+  801523:	48 b8 b4 14 80 00 00 	movabs $0x8014b4,%rax
+  80152a:	00 00 00 
+  80152d:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80152f:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801533:	48 83 c4 08          	add    $0x8,%rsp
+  801537:	5b                   	pop    %rbx
+  801538:	41 5c                	pop    %r12
+  80153a:	41 5d                	pop    %r13
+  80153c:	41 5e                	pop    %r14
+  80153e:	41 5f                	pop    %r15
+  801540:	5d                   	pop    %rbp
+  801541:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801542:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801546:	eb eb                	jmp    801533 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801548:	48 83 eb 01          	sub    $0x1,%rbx
+  80154c:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801550:	48 89 da             	mov    %rbx,%rdx
+  801553:	4c 89 fe             	mov    %r15,%rsi
+  801556:	48 b8 b4 14 80 00 00 	movabs $0x8014b4,%rax
+  80155d:	00 00 00 
+  801560:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801562:	49 01 de             	add    %rbx,%r14
+  801565:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80156a:	eb c3                	jmp    80152f <strlcat+0x69>
+
+000000000080156c <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80156c:	48 85 d2             	test   %rdx,%rdx
+  80156f:	74 2d                	je     80159e <memcmp+0x32>
+  801571:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801576:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80157a:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80157f:	44 38 c1             	cmp    %r8b,%cl
+  801582:	75 0f                	jne    801593 <memcmp+0x27>
+    while (n-- > 0) {
+  801584:	48 83 c0 01          	add    $0x1,%rax
+  801588:	48 39 c2             	cmp    %rax,%rdx
+  80158b:	75 e9                	jne    801576 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80158d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801592:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801593:	0f b6 c1             	movzbl %cl,%eax
+  801596:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80159a:	44 29 c0             	sub    %r8d,%eax
+  80159d:	c3                   	ret
+    return 0;
+  80159e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015a3:	c3                   	ret
+
+00000000008015a4 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8015a4:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8015a8:	48 39 c7             	cmp    %rax,%rdi
+  8015ab:	73 0f                	jae    8015bc <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8015ad:	40 38 37             	cmp    %sil,(%rdi)
+  8015b0:	74 0e                	je     8015c0 <memfind+0x1c>
+    for (; src < end; src++) {
+  8015b2:	48 83 c7 01          	add    $0x1,%rdi
+  8015b6:	48 39 f8             	cmp    %rdi,%rax
+  8015b9:	75 f2                	jne    8015ad <memfind+0x9>
+  8015bb:	c3                   	ret
+  8015bc:	48 89 f8             	mov    %rdi,%rax
+  8015bf:	c3                   	ret
+  8015c0:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8015c3:	c3                   	ret
+
+00000000008015c4 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8015c4:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8015c7:	0f b6 37             	movzbl (%rdi),%esi
+  8015ca:	40 80 fe 20          	cmp    $0x20,%sil
+  8015ce:	74 06                	je     8015d6 <strtol+0x12>
+  8015d0:	40 80 fe 09          	cmp    $0x9,%sil
+  8015d4:	75 13                	jne    8015e9 <strtol+0x25>
+  8015d6:	48 83 c7 01          	add    $0x1,%rdi
+  8015da:	0f b6 37             	movzbl (%rdi),%esi
+  8015dd:	40 80 fe 20          	cmp    $0x20,%sil
+  8015e1:	74 f3                	je     8015d6 <strtol+0x12>
+  8015e3:	40 80 fe 09          	cmp    $0x9,%sil
+  8015e7:	74 ed                	je     8015d6 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8015e9:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8015ec:	83 e0 fd             	and    $0xfffffffd,%eax
+  8015ef:	3c 01                	cmp    $0x1,%al
+  8015f1:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8015f5:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8015fb:	75 0f                	jne    80160c <strtol+0x48>
+  8015fd:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801600:	74 14                	je     801616 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801602:	85 d2                	test   %edx,%edx
+  801604:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801609:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80160c:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801611:	4c 63 ca             	movslq %edx,%r9
+  801614:	eb 36                	jmp    80164c <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801616:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80161a:	74 0f                	je     80162b <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80161c:	85 d2                	test   %edx,%edx
+  80161e:	75 ec                	jne    80160c <strtol+0x48>
+        s++;
+  801620:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801624:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801629:	eb e1                	jmp    80160c <strtol+0x48>
+        s += 2;
+  80162b:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80162f:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801634:	eb d6                	jmp    80160c <strtol+0x48>
+            dig -= '0';
+  801636:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801639:	44 0f b6 c1          	movzbl %cl,%r8d
+  80163d:	41 39 d0             	cmp    %edx,%r8d
+  801640:	7d 21                	jge    801663 <strtol+0x9f>
+        val = val * base + dig;
+  801642:	49 0f af c1          	imul   %r9,%rax
+  801646:	0f b6 c9             	movzbl %cl,%ecx
+  801649:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80164c:	48 83 c7 01          	add    $0x1,%rdi
+  801650:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801654:	80 f9 39             	cmp    $0x39,%cl
+  801657:	76 dd                	jbe    801636 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801659:	80 f9 7b             	cmp    $0x7b,%cl
+  80165c:	77 05                	ja     801663 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80165e:	83 e9 57             	sub    $0x57,%ecx
+  801661:	eb d6                	jmp    801639 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801663:	4d 85 d2             	test   %r10,%r10
+  801666:	74 03                	je     80166b <strtol+0xa7>
+  801668:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80166b:	48 89 c2             	mov    %rax,%rdx
+  80166e:	48 f7 da             	neg    %rdx
+  801671:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801675:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801679:	c3                   	ret
+
+000000000080167a <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  80167a:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80167f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801684:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80168a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801690:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  801696:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801698:	c3                   	ret
+
+0000000000801699 <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  801699:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80169e:	bf 00 00 00 00       	mov    $0x0,%edi
+  8016a3:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8016a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016ad:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8016b3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8016b9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8016bf:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8016c1:	c3                   	ret
+
+00000000008016c2 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8016c2:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8016c5:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8016ca:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8016cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016d4:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8016da:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8016e0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8016e6:	0f 05                	syscall
+    if (check && ret > 0) {
+  8016e8:	48 85 c0             	test   %rax,%rax
+  8016eb:	7f 01                	jg     8016ee <sys_env_destroy+0x2c>
+}
+  8016ed:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  8016ee:	55                   	push   %rbp
+  8016ef:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016f2:	49 89 c0             	mov    %rax,%r8
+  8016f5:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8016fa:	48 ba 78 5f 80 00 00 	movabs $0x805f78,%rdx
+  801701:	00 00 00 
+  801704:	be 29 00 00 00       	mov    $0x29,%esi
+  801709:	48 bf 97 5f 80 00 00 	movabs $0x805f97,%rdi
+  801710:	00 00 00 
+  801713:	b8 00 00 00 00       	mov    $0x0,%eax
+  801718:	49 b9 de 07 80 00 00 	movabs $0x8007de,%r9
+  80171f:	00 00 00 
+  801722:	41 ff d1             	call   *%r9
+
+0000000000801725 <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  801725:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80172a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80172f:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801734:	ba 00 00 00 00       	mov    $0x0,%edx
+  801739:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80173f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801745:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80174b:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80174d:	c3                   	ret
+
+000000000080174e <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  80174e:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801753:	bf 00 00 00 00       	mov    $0x0,%edi
+  801758:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80175d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801762:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801768:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80176e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801774:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801776:	c3                   	ret
+
+0000000000801777 <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  801777:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80177c:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  801783:	00 00 00 
+  801786:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80178c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801792:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801798:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80179a:	c3                   	ret
+
+000000000080179b <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80179b:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  80179e:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8017a3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8017a9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8017af:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8017b1:	c3                   	ret
+
+00000000008017b2 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8017b2:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8017b5:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8017ba:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8017bd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8017c3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8017c9:	0f 05                	syscall
+    if (check && ret > 0) {
+  8017cb:	48 85 c0             	test   %rax,%rax
+  8017ce:	7f 01                	jg     8017d1 <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8017d0:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8017d1:	55                   	push   %rbp
+  8017d2:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017d5:	49 89 c0             	mov    %rax,%r8
+  8017d8:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8017dd:	48 ba 78 5f 80 00 00 	movabs $0x805f78,%rdx
+  8017e4:	00 00 00 
+  8017e7:	be 29 00 00 00       	mov    $0x29,%esi
+  8017ec:	48 bf 97 5f 80 00 00 	movabs $0x805f97,%rdi
+  8017f3:	00 00 00 
+  8017f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017fb:	49 b9 de 07 80 00 00 	movabs $0x8007de,%r9
+  801802:	00 00 00 
+  801805:	41 ff d1             	call   *%r9
+
+0000000000801808 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801808:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80180b:	48 63 d2             	movslq %edx,%rdx
+  80180e:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801811:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801816:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  801819:	0f 05                	syscall
+    if (check && ret > 0) {
+  80181b:	48 85 c0             	test   %rax,%rax
+  80181e:	7f 01                	jg     801821 <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801820:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801821:	55                   	push   %rbp
+  801822:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801825:	49 89 c0             	mov    %rax,%r8
+  801828:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80182d:	48 ba 78 5f 80 00 00 	movabs $0x805f78,%rdx
+  801834:	00 00 00 
+  801837:	be 29 00 00 00       	mov    $0x29,%esi
+  80183c:	48 bf 97 5f 80 00 00 	movabs $0x805f97,%rdi
+  801843:	00 00 00 
+  801846:	b8 00 00 00 00       	mov    $0x0,%eax
+  80184b:	49 b9 de 07 80 00 00 	movabs $0x8007de,%r9
+  801852:	00 00 00 
+  801855:	41 ff d1             	call   *%r9
+
+0000000000801858 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801858:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80185b:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801860:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801866:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80186c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801872:	0f 05                	syscall
+    if (check && ret > 0) {
+  801874:	48 85 c0             	test   %rax,%rax
+  801877:	7f 01                	jg     80187a <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801879:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80187a:	55                   	push   %rbp
+  80187b:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80187e:	49 89 c0             	mov    %rax,%r8
+  801881:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801886:	48 ba 78 5f 80 00 00 	movabs $0x805f78,%rdx
+  80188d:	00 00 00 
+  801890:	be 29 00 00 00       	mov    $0x29,%esi
+  801895:	48 bf 97 5f 80 00 00 	movabs $0x805f97,%rdi
+  80189c:	00 00 00 
+  80189f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018a4:	49 b9 de 07 80 00 00 	movabs $0x8007de,%r9
+  8018ab:	00 00 00 
+  8018ae:	41 ff d1             	call   *%r9
+
+00000000008018b1 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8018b1:	48 63 f6             	movslq %esi,%rsi
+  8018b4:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8018b7:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8018bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018c1:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8018c7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8018cd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8018d3:	0f 05                	syscall
+    if (check && ret > 0) {
+  8018d5:	48 85 c0             	test   %rax,%rax
+  8018d8:	7f 01                	jg     8018db <sys_env_set_status+0x2a>
+}
+  8018da:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  8018db:	55                   	push   %rbp
+  8018dc:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018df:	49 89 c0             	mov    %rax,%r8
+  8018e2:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8018e7:	48 ba 78 5f 80 00 00 	movabs $0x805f78,%rdx
+  8018ee:	00 00 00 
+  8018f1:	be 29 00 00 00       	mov    $0x29,%esi
+  8018f6:	48 bf 97 5f 80 00 00 	movabs $0x805f97,%rdi
+  8018fd:	00 00 00 
+  801900:	b8 00 00 00 00       	mov    $0x0,%eax
+  801905:	49 b9 de 07 80 00 00 	movabs $0x8007de,%r9
+  80190c:	00 00 00 
+  80190f:	41 ff d1             	call   *%r9
+
+0000000000801912 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801912:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801915:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80191a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80191f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801925:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80192b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801931:	0f 05                	syscall
+    if (check && ret > 0) {
+  801933:	48 85 c0             	test   %rax,%rax
+  801936:	7f 01                	jg     801939 <sys_env_set_trapframe+0x27>
+}
+  801938:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801939:	55                   	push   %rbp
+  80193a:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80193d:	49 89 c0             	mov    %rax,%r8
+  801940:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801945:	48 ba 78 5f 80 00 00 	movabs $0x805f78,%rdx
+  80194c:	00 00 00 
+  80194f:	be 29 00 00 00       	mov    $0x29,%esi
+  801954:	48 bf 97 5f 80 00 00 	movabs $0x805f97,%rdi
+  80195b:	00 00 00 
+  80195e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801963:	49 b9 de 07 80 00 00 	movabs $0x8007de,%r9
+  80196a:	00 00 00 
+  80196d:	41 ff d1             	call   *%r9
+
+0000000000801970 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801970:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801973:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801978:	ba 00 00 00 00       	mov    $0x0,%edx
+  80197d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801983:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801989:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80198f:	0f 05                	syscall
+    if (check && ret > 0) {
+  801991:	48 85 c0             	test   %rax,%rax
+  801994:	7f 01                	jg     801997 <sys_env_set_pgfault_upcall+0x27>
+}
+  801996:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801997:	55                   	push   %rbp
+  801998:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80199b:	49 89 c0             	mov    %rax,%r8
+  80199e:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8019a3:	48 ba 78 5f 80 00 00 	movabs $0x805f78,%rdx
+  8019aa:	00 00 00 
+  8019ad:	be 29 00 00 00       	mov    $0x29,%esi
+  8019b2:	48 bf 97 5f 80 00 00 	movabs $0x805f97,%rdi
+  8019b9:	00 00 00 
+  8019bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019c1:	49 b9 de 07 80 00 00 	movabs $0x8007de,%r9
+  8019c8:	00 00 00 
+  8019cb:	41 ff d1             	call   *%r9
+
+00000000008019ce <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8019ce:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8019d1:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8019d4:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8019d9:	4d 63 c0             	movslq %r8d,%r8
+  8019dc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8019e2:	0f 05                	syscall
+}
+  8019e4:	c3                   	ret
+
+00000000008019e5 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8019e5:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8019e8:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8019eb:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8019f0:	4d 63 c0             	movslq %r8d,%r8
+  8019f3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8019f9:	0f 05                	syscall
+}
+  8019fb:	c3                   	ret
+
+00000000008019fc <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  8019fc:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801a01:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801a04:	45 89 c0             	mov    %r8d,%r8d
+  801a07:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801a0d:	0f 05                	syscall
+    if (check && ret > 0) {
+  801a0f:	48 85 c0             	test   %rax,%rax
+  801a12:	7f 01                	jg     801a15 <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801a14:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  801a15:	55                   	push   %rbp
+  801a16:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801a19:	49 89 c0             	mov    %rax,%r8
+  801a1c:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801a21:	48 ba 78 5f 80 00 00 	movabs $0x805f78,%rdx
+  801a28:	00 00 00 
+  801a2b:	be 29 00 00 00       	mov    $0x29,%esi
+  801a30:	48 bf 97 5f 80 00 00 	movabs $0x805f97,%rdi
+  801a37:	00 00 00 
+  801a3a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a3f:	49 b9 de 07 80 00 00 	movabs $0x8007de,%r9
+  801a46:	00 00 00 
+  801a49:	41 ff d1             	call   *%r9
+
+0000000000801a4c <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  801a4c:	55                   	push   %rbp
+  801a4d:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  801a50:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801a56:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a5b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a60:	48 b8 fc 19 80 00 00 	movabs $0x8019fc,%rax
+  801a67:	00 00 00 
+  801a6a:	ff d0                	call   *%rax
+}
+  801a6c:	5d                   	pop    %rbp
+  801a6d:	c3                   	ret
+
+0000000000801a6e <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  801a6e:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801a73:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a78:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801a7d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a82:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801a88:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801a8e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801a94:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801a96:	c3                   	ret
+
+0000000000801a97 <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  801a97:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801a9c:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801aa1:	ba 00 00 00 00       	mov    $0x0,%edx
+  801aa6:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801aac:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801ab2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801ab8:	0f 05                	syscall
+    if (check && ret > 0) {
+  801aba:	48 85 c0             	test   %rax,%rax
+  801abd:	7f 01                	jg     801ac0 <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  801abf:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  801ac0:	55                   	push   %rbp
+  801ac1:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801ac4:	49 89 c0             	mov    %rax,%r8
+  801ac7:	b9 10 00 00 00       	mov    $0x10,%ecx
+  801acc:	48 ba 78 5f 80 00 00 	movabs $0x805f78,%rdx
+  801ad3:	00 00 00 
+  801ad6:	be 29 00 00 00       	mov    $0x29,%esi
+  801adb:	48 bf 97 5f 80 00 00 	movabs $0x805f97,%rdi
+  801ae2:	00 00 00 
+  801ae5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aea:	49 b9 de 07 80 00 00 	movabs $0x8007de,%r9
+  801af1:	00 00 00 
+  801af4:	41 ff d1             	call   *%r9
+
+0000000000801af7 <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  801af7:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801afc:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b01:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801b06:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b0b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801b11:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801b17:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801b1d:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  801b1f:	c3                   	ret
+
+0000000000801b20 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  801b20:	89 d2                	mov    %edx,%edx
+  801b22:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  801b24:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801b29:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801b2f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801b35:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801b3b:	0f 05                	syscall
+}
+  801b3d:	c3                   	ret
+
+0000000000801b3e <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  801b3e:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  801b41:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801b46:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b4b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801b51:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801b57:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801b5d:	0f 05                	syscall
+}
+  801b5f:	c3                   	ret
+
+0000000000801b60 <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  801b60:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  801b63:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801b68:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b6d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801b73:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801b79:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801b7f:	0f 05                	syscall
+}
+  801b81:	c3                   	ret
+
+0000000000801b82 <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  801b82:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801b85:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801b8a:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801b8f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b94:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801b9a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801ba0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801ba6:	0f 05                	syscall
+    if (check && ret > 0) {
+  801ba8:	48 85 c0             	test   %rax,%rax
+  801bab:	7f 01                	jg     801bae <sys_irq_ack+0x2c>
+}
+  801bad:	c3                   	ret
+sys_irq_ack(int irq) {
+  801bae:	55                   	push   %rbp
+  801baf:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801bb2:	49 89 c0             	mov    %rax,%r8
+  801bb5:	b9 16 00 00 00       	mov    $0x16,%ecx
+  801bba:	48 ba 78 5f 80 00 00 	movabs $0x805f78,%rdx
+  801bc1:	00 00 00 
+  801bc4:	be 29 00 00 00       	mov    $0x29,%esi
+  801bc9:	48 bf 97 5f 80 00 00 	movabs $0x805f97,%rdi
+  801bd0:	00 00 00 
+  801bd3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bd8:	49 b9 de 07 80 00 00 	movabs $0x8007de,%r9
+  801bdf:	00 00 00 
+  801be2:	41 ff d1             	call   *%r9
+
+0000000000801be5 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  801be5:	55                   	push   %rbp
+  801be6:	48 89 e5             	mov    %rsp,%rbp
+  801be9:	41 54                	push   %r12
+  801beb:	53                   	push   %rbx
+    // LAB 9: Your code here
+    /* The child would write them out once more */
+    file_flush_buffers();
+  801bec:	48 b8 19 36 80 00 00 	movabs $0x803619,%rax
+  801bf3:	00 00 00 
+  801bf6:	ff d0                	call   *%rax
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("syscall"
+  801bf8:	b8 08 00 00 00       	mov    $0x8,%eax
+  801bfd:	0f 05                	syscall
+  801bff:	41 89 c4             	mov    %eax,%r12d
+
+	envid_t envid = sys_exofork();
+    if (envid < 0)
+  801c02:	85 c0                	test   %eax,%eax
+  801c04:	78 7e                	js     801c84 <fork+0x9f>
+        return envid;
+    if (envid == 0) {
+  801c06:	0f 84 80 00 00 00    	je     801c8c <fork+0xa7>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE) < 0) {
+  801c0c:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801c12:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801c19:	00 00 00 
+  801c1c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c21:	89 c2                	mov    %eax,%edx
+  801c23:	be 00 00 00 00       	mov    $0x0,%esi
+  801c28:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c2d:	48 b8 08 18 80 00 00 	movabs $0x801808,%rax
+  801c34:	00 00 00 
+  801c37:	ff d0                	call   *%rax
+  801c39:	85 c0                	test   %eax,%eax
+  801c3b:	0f 88 86 00 00 00    	js     801cc7 <fork+0xe2>
+		return -1;
+	}
+    if (sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall) < 0) {
+  801c41:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801c48:	00 00 00 
+  801c4b:	48 8b b0 28 01 00 00 	mov    0x128(%rax),%rsi
+  801c52:	44 89 e7             	mov    %r12d,%edi
+  801c55:	48 b8 70 19 80 00 00 	movabs $0x801970,%rax
+  801c5c:	00 00 00 
+  801c5f:	ff d0                	call   *%rax
+  801c61:	85 c0                	test   %eax,%eax
+  801c63:	78 6a                	js     801ccf <fork+0xea>
+		return -1;
+	}
+    if (sys_env_set_status(envid, ENV_RUNNABLE) < 0) {
+  801c65:	be 02 00 00 00       	mov    $0x2,%esi
+  801c6a:	44 89 e7             	mov    %r12d,%edi
+  801c6d:	48 b8 b1 18 80 00 00 	movabs $0x8018b1,%rax
+  801c74:	00 00 00 
+  801c77:	ff d0                	call   *%rax
+		return -1;
+  801c79:	85 c0                	test   %eax,%eax
+  801c7b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801c80:	44 0f 48 e0          	cmovs  %eax,%r12d
+	}
+    return envid;
+}
+  801c84:	44 89 e0             	mov    %r12d,%eax
+  801c87:	5b                   	pop    %rbx
+  801c88:	41 5c                	pop    %r12
+  801c8a:	5d                   	pop    %rbp
+  801c8b:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801c8c:	48 b8 25 17 80 00 00 	movabs $0x801725,%rax
+  801c93:	00 00 00 
+  801c96:	ff d0                	call   *%rax
+  801c98:	89 c2                	mov    %eax,%edx
+  801c9a:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  801ca0:	48 89 d0             	mov    %rdx,%rax
+  801ca3:	48 c1 e0 04          	shl    $0x4,%rax
+  801ca7:	48 29 d0             	sub    %rdx,%rax
+  801caa:	48 c1 e0 05          	shl    $0x5,%rax
+  801cae:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801cb5:	00 00 00 
+  801cb8:	48 01 d0             	add    %rdx,%rax
+  801cbb:	48 a3 00 00 81 00 00 	movabs %rax,0x810000
+  801cc2:	00 00 00 
+        return 0;
+  801cc5:	eb bd                	jmp    801c84 <fork+0x9f>
+		return -1;
+  801cc7:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801ccd:	eb b5                	jmp    801c84 <fork+0x9f>
+		return -1;
+  801ccf:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801cd5:	eb ad                	jmp    801c84 <fork+0x9f>
+
+0000000000801cd7 <sfork>:
+
+envid_t
+sfork() {
+  801cd7:	55                   	push   %rbp
+  801cd8:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  801cdb:	48 ba a5 5f 80 00 00 	movabs $0x805fa5,%rdx
+  801ce2:	00 00 00 
+  801ce5:	be 2d 00 00 00       	mov    $0x2d,%esi
+  801cea:	48 bf c0 5f 80 00 00 	movabs $0x805fc0,%rdi
+  801cf1:	00 00 00 
+  801cf4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cf9:	48 b9 de 07 80 00 00 	movabs $0x8007de,%rcx
+  801d00:	00 00 00 
+  801d03:	ff d1                	call   *%rcx
+
+0000000000801d05 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801d05:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801d0c:	ff ff ff 
+  801d0f:	48 01 f8             	add    %rdi,%rax
+  801d12:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801d16:	c3                   	ret
+
+0000000000801d17 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801d17:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801d1e:	ff ff ff 
+  801d21:	48 01 f8             	add    %rdi,%rax
+  801d24:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801d28:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801d2e:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801d32:	c3                   	ret
+
+0000000000801d33 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801d33:	55                   	push   %rbp
+  801d34:	48 89 e5             	mov    %rsp,%rbp
+  801d37:	41 57                	push   %r15
+  801d39:	41 56                	push   %r14
+  801d3b:	41 55                	push   %r13
+  801d3d:	41 54                	push   %r12
+  801d3f:	53                   	push   %rbx
+  801d40:	48 83 ec 08          	sub    $0x8,%rsp
+  801d44:	49 89 ff             	mov    %rdi,%r15
+  801d47:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801d4c:	49 bd 7b 4e 80 00 00 	movabs $0x804e7b,%r13
+  801d53:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801d56:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801d5c:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801d5f:	48 89 df             	mov    %rbx,%rdi
+  801d62:	41 ff d5             	call   *%r13
+  801d65:	83 e0 04             	and    $0x4,%eax
+  801d68:	74 17                	je     801d81 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801d6a:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801d71:	4c 39 f3             	cmp    %r14,%rbx
+  801d74:	75 e6                	jne    801d5c <fd_alloc+0x29>
+  801d76:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801d7c:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801d81:	4d 89 27             	mov    %r12,(%r15)
+}
+  801d84:	48 83 c4 08          	add    $0x8,%rsp
+  801d88:	5b                   	pop    %rbx
+  801d89:	41 5c                	pop    %r12
+  801d8b:	41 5d                	pop    %r13
+  801d8d:	41 5e                	pop    %r14
+  801d8f:	41 5f                	pop    %r15
+  801d91:	5d                   	pop    %rbp
+  801d92:	c3                   	ret
+
+0000000000801d93 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801d93:	83 ff 1f             	cmp    $0x1f,%edi
+  801d96:	77 39                	ja     801dd1 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801d98:	55                   	push   %rbp
+  801d99:	48 89 e5             	mov    %rsp,%rbp
+  801d9c:	41 54                	push   %r12
+  801d9e:	53                   	push   %rbx
+  801d9f:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801da2:	48 63 df             	movslq %edi,%rbx
+  801da5:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801dac:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801db0:	48 89 df             	mov    %rbx,%rdi
+  801db3:	48 b8 7b 4e 80 00 00 	movabs $0x804e7b,%rax
+  801dba:	00 00 00 
+  801dbd:	ff d0                	call   *%rax
+  801dbf:	a8 04                	test   $0x4,%al
+  801dc1:	74 14                	je     801dd7 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801dc3:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801dc7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801dcc:	5b                   	pop    %rbx
+  801dcd:	41 5c                	pop    %r12
+  801dcf:	5d                   	pop    %rbp
+  801dd0:	c3                   	ret
+        return -E_INVAL;
+  801dd1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801dd6:	c3                   	ret
+        return -E_INVAL;
+  801dd7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ddc:	eb ee                	jmp    801dcc <fd_lookup+0x39>
+
+0000000000801dde <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801dde:	55                   	push   %rbp
+  801ddf:	48 89 e5             	mov    %rsp,%rbp
+  801de2:	41 54                	push   %r12
+  801de4:	53                   	push   %rbx
+  801de5:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801de8:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  801def:	00 00 00 
+  801df2:	48 bb 60 70 80 00 00 	movabs $0x807060,%rbx
+  801df9:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801dfc:	39 3b                	cmp    %edi,(%rbx)
+  801dfe:	74 47                	je     801e47 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801e00:	48 83 c0 08          	add    $0x8,%rax
+  801e04:	48 8b 18             	mov    (%rax),%rbx
+  801e07:	48 85 db             	test   %rbx,%rbx
+  801e0a:	75 f0                	jne    801dfc <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801e0c:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801e13:	00 00 00 
+  801e16:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801e1c:	89 fa                	mov    %edi,%edx
+  801e1e:	48 bf d0 5f 80 00 00 	movabs $0x805fd0,%rdi
+  801e25:	00 00 00 
+  801e28:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e2d:	48 b9 2e 09 80 00 00 	movabs $0x80092e,%rcx
+  801e34:	00 00 00 
+  801e37:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801e39:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801e3e:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801e42:	5b                   	pop    %rbx
+  801e43:	41 5c                	pop    %r12
+  801e45:	5d                   	pop    %rbp
+  801e46:	c3                   	ret
+            return 0;
+  801e47:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e4c:	eb f0                	jmp    801e3e <dev_lookup+0x60>
+
+0000000000801e4e <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801e4e:	55                   	push   %rbp
+  801e4f:	48 89 e5             	mov    %rsp,%rbp
+  801e52:	41 55                	push   %r13
+  801e54:	41 54                	push   %r12
+  801e56:	53                   	push   %rbx
+  801e57:	48 83 ec 18          	sub    $0x18,%rsp
+  801e5b:	48 89 fb             	mov    %rdi,%rbx
+  801e5e:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801e61:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801e68:	ff ff ff 
+  801e6b:	48 01 df             	add    %rbx,%rdi
+  801e6e:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801e72:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e76:	48 b8 93 1d 80 00 00 	movabs $0x801d93,%rax
+  801e7d:	00 00 00 
+  801e80:	ff d0                	call   *%rax
+  801e82:	41 89 c5             	mov    %eax,%r13d
+  801e85:	85 c0                	test   %eax,%eax
+  801e87:	78 06                	js     801e8f <fd_close+0x41>
+  801e89:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801e8d:	74 1a                	je     801ea9 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801e8f:	45 84 e4             	test   %r12b,%r12b
+  801e92:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e97:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801e9b:	44 89 e8             	mov    %r13d,%eax
+  801e9e:	48 83 c4 18          	add    $0x18,%rsp
+  801ea2:	5b                   	pop    %rbx
+  801ea3:	41 5c                	pop    %r12
+  801ea5:	41 5d                	pop    %r13
+  801ea7:	5d                   	pop    %rbp
+  801ea8:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801ea9:	8b 3b                	mov    (%rbx),%edi
+  801eab:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801eaf:	48 b8 de 1d 80 00 00 	movabs $0x801dde,%rax
+  801eb6:	00 00 00 
+  801eb9:	ff d0                	call   *%rax
+  801ebb:	41 89 c5             	mov    %eax,%r13d
+  801ebe:	85 c0                	test   %eax,%eax
+  801ec0:	78 1b                	js     801edd <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801ec2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ec6:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801eca:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801ed0:	48 85 c0             	test   %rax,%rax
+  801ed3:	74 08                	je     801edd <fd_close+0x8f>
+  801ed5:	48 89 df             	mov    %rbx,%rdi
+  801ed8:	ff d0                	call   *%rax
+  801eda:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801edd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ee2:	48 89 de             	mov    %rbx,%rsi
+  801ee5:	bf 00 00 00 00       	mov    $0x0,%edi
+  801eea:	48 b8 58 18 80 00 00 	movabs $0x801858,%rax
+  801ef1:	00 00 00 
+  801ef4:	ff d0                	call   *%rax
+    return res;
+  801ef6:	eb a3                	jmp    801e9b <fd_close+0x4d>
+
+0000000000801ef8 <close>:
+
+int
+close(int fdnum) {
+  801ef8:	55                   	push   %rbp
+  801ef9:	48 89 e5             	mov    %rsp,%rbp
+  801efc:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801f00:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801f04:	48 b8 93 1d 80 00 00 	movabs $0x801d93,%rax
+  801f0b:	00 00 00 
+  801f0e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801f10:	85 c0                	test   %eax,%eax
+  801f12:	78 15                	js     801f29 <close+0x31>
+
+    return fd_close(fd, 1);
+  801f14:	be 01 00 00 00       	mov    $0x1,%esi
+  801f19:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801f1d:	48 b8 4e 1e 80 00 00 	movabs $0x801e4e,%rax
+  801f24:	00 00 00 
+  801f27:	ff d0                	call   *%rax
+}
+  801f29:	c9                   	leave
+  801f2a:	c3                   	ret
+
+0000000000801f2b <close_all>:
+
+void
+close_all(void) {
+  801f2b:	55                   	push   %rbp
+  801f2c:	48 89 e5             	mov    %rsp,%rbp
+  801f2f:	41 54                	push   %r12
+  801f31:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801f32:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f37:	49 bc f8 1e 80 00 00 	movabs $0x801ef8,%r12
+  801f3e:	00 00 00 
+  801f41:	89 df                	mov    %ebx,%edi
+  801f43:	41 ff d4             	call   *%r12
+  801f46:	83 c3 01             	add    $0x1,%ebx
+  801f49:	83 fb 20             	cmp    $0x20,%ebx
+  801f4c:	75 f3                	jne    801f41 <close_all+0x16>
+}
+  801f4e:	5b                   	pop    %rbx
+  801f4f:	41 5c                	pop    %r12
+  801f51:	5d                   	pop    %rbp
+  801f52:	c3                   	ret
+
+0000000000801f53 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801f53:	55                   	push   %rbp
+  801f54:	48 89 e5             	mov    %rsp,%rbp
+  801f57:	41 57                	push   %r15
+  801f59:	41 56                	push   %r14
+  801f5b:	41 55                	push   %r13
+  801f5d:	41 54                	push   %r12
+  801f5f:	53                   	push   %rbx
+  801f60:	48 83 ec 18          	sub    $0x18,%rsp
+  801f64:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801f67:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801f6b:	48 b8 93 1d 80 00 00 	movabs $0x801d93,%rax
+  801f72:	00 00 00 
+  801f75:	ff d0                	call   *%rax
+  801f77:	89 c3                	mov    %eax,%ebx
+  801f79:	85 c0                	test   %eax,%eax
+  801f7b:	0f 88 b8 00 00 00    	js     802039 <dup+0xe6>
+    close(newfdnum);
+  801f81:	44 89 e7             	mov    %r12d,%edi
+  801f84:	48 b8 f8 1e 80 00 00 	movabs $0x801ef8,%rax
+  801f8b:	00 00 00 
+  801f8e:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801f90:	4d 63 ec             	movslq %r12d,%r13
+  801f93:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801f9a:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801f9e:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801fa2:	4c 89 ff             	mov    %r15,%rdi
+  801fa5:	49 be 17 1d 80 00 00 	movabs $0x801d17,%r14
+  801fac:	00 00 00 
+  801faf:	41 ff d6             	call   *%r14
+  801fb2:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801fb5:	4c 89 ef             	mov    %r13,%rdi
+  801fb8:	41 ff d6             	call   *%r14
+  801fbb:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801fbe:	48 89 df             	mov    %rbx,%rdi
+  801fc1:	48 b8 7b 4e 80 00 00 	movabs $0x804e7b,%rax
+  801fc8:	00 00 00 
+  801fcb:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801fcd:	a8 04                	test   $0x4,%al
+  801fcf:	74 2b                	je     801ffc <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801fd1:	41 89 c1             	mov    %eax,%r9d
+  801fd4:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801fda:	4c 89 f1             	mov    %r14,%rcx
+  801fdd:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fe2:	48 89 de             	mov    %rbx,%rsi
+  801fe5:	bf 00 00 00 00       	mov    $0x0,%edi
+  801fea:	48 b8 08 18 80 00 00 	movabs $0x801808,%rax
+  801ff1:	00 00 00 
+  801ff4:	ff d0                	call   *%rax
+  801ff6:	89 c3                	mov    %eax,%ebx
+  801ff8:	85 c0                	test   %eax,%eax
+  801ffa:	78 4e                	js     80204a <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801ffc:	4c 89 ff             	mov    %r15,%rdi
+  801fff:	48 b8 7b 4e 80 00 00 	movabs $0x804e7b,%rax
+  802006:	00 00 00 
+  802009:	ff d0                	call   *%rax
+  80200b:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  80200e:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802014:	4c 89 e9             	mov    %r13,%rcx
+  802017:	ba 00 00 00 00       	mov    $0x0,%edx
+  80201c:	4c 89 fe             	mov    %r15,%rsi
+  80201f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802024:	48 b8 08 18 80 00 00 	movabs $0x801808,%rax
+  80202b:	00 00 00 
+  80202e:	ff d0                	call   *%rax
+  802030:	89 c3                	mov    %eax,%ebx
+  802032:	85 c0                	test   %eax,%eax
+  802034:	78 14                	js     80204a <dup+0xf7>
+
+    return newfdnum;
+  802036:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  802039:	89 d8                	mov    %ebx,%eax
+  80203b:	48 83 c4 18          	add    $0x18,%rsp
+  80203f:	5b                   	pop    %rbx
+  802040:	41 5c                	pop    %r12
+  802042:	41 5d                	pop    %r13
+  802044:	41 5e                	pop    %r14
+  802046:	41 5f                	pop    %r15
+  802048:	5d                   	pop    %rbp
+  802049:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  80204a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80204f:	4c 89 ee             	mov    %r13,%rsi
+  802052:	bf 00 00 00 00       	mov    $0x0,%edi
+  802057:	49 bc 58 18 80 00 00 	movabs $0x801858,%r12
+  80205e:	00 00 00 
+  802061:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  802064:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802069:	4c 89 f6             	mov    %r14,%rsi
+  80206c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802071:	41 ff d4             	call   *%r12
+    return res;
+  802074:	eb c3                	jmp    802039 <dup+0xe6>
+
+0000000000802076 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802076:	55                   	push   %rbp
+  802077:	48 89 e5             	mov    %rsp,%rbp
+  80207a:	41 56                	push   %r14
+  80207c:	41 55                	push   %r13
+  80207e:	41 54                	push   %r12
+  802080:	53                   	push   %rbx
+  802081:	48 83 ec 10          	sub    $0x10,%rsp
+  802085:	89 fb                	mov    %edi,%ebx
+  802087:	49 89 f4             	mov    %rsi,%r12
+  80208a:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80208d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802091:	48 b8 93 1d 80 00 00 	movabs $0x801d93,%rax
+  802098:	00 00 00 
+  80209b:	ff d0                	call   *%rax
+  80209d:	85 c0                	test   %eax,%eax
+  80209f:	78 4c                	js     8020ed <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8020a1:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8020a5:	41 8b 3e             	mov    (%r14),%edi
+  8020a8:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8020ac:	48 b8 de 1d 80 00 00 	movabs $0x801dde,%rax
+  8020b3:	00 00 00 
+  8020b6:	ff d0                	call   *%rax
+  8020b8:	85 c0                	test   %eax,%eax
+  8020ba:	78 35                	js     8020f1 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8020bc:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8020c0:	83 e0 03             	and    $0x3,%eax
+  8020c3:	83 f8 01             	cmp    $0x1,%eax
+  8020c6:	74 2d                	je     8020f5 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8020c8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8020cc:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8020d0:	48 85 c0             	test   %rax,%rax
+  8020d3:	74 56                	je     80212b <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8020d5:	4c 89 ea             	mov    %r13,%rdx
+  8020d8:	4c 89 e6             	mov    %r12,%rsi
+  8020db:	4c 89 f7             	mov    %r14,%rdi
+  8020de:	ff d0                	call   *%rax
+}
+  8020e0:	48 83 c4 10          	add    $0x10,%rsp
+  8020e4:	5b                   	pop    %rbx
+  8020e5:	41 5c                	pop    %r12
+  8020e7:	41 5d                	pop    %r13
+  8020e9:	41 5e                	pop    %r14
+  8020eb:	5d                   	pop    %rbp
+  8020ec:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8020ed:	48 98                	cltq
+  8020ef:	eb ef                	jmp    8020e0 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8020f1:	48 98                	cltq
+  8020f3:	eb eb                	jmp    8020e0 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8020f5:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8020fc:	00 00 00 
+  8020ff:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802105:	89 da                	mov    %ebx,%edx
+  802107:	48 bf 11 60 80 00 00 	movabs $0x806011,%rdi
+  80210e:	00 00 00 
+  802111:	b8 00 00 00 00       	mov    $0x0,%eax
+  802116:	48 b9 2e 09 80 00 00 	movabs $0x80092e,%rcx
+  80211d:	00 00 00 
+  802120:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802122:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802129:	eb b5                	jmp    8020e0 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80212b:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802132:	eb ac                	jmp    8020e0 <read+0x6a>
+
+0000000000802134 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802134:	55                   	push   %rbp
+  802135:	48 89 e5             	mov    %rsp,%rbp
+  802138:	41 57                	push   %r15
+  80213a:	41 56                	push   %r14
+  80213c:	41 55                	push   %r13
+  80213e:	41 54                	push   %r12
+  802140:	53                   	push   %rbx
+  802141:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802145:	48 85 d2             	test   %rdx,%rdx
+  802148:	74 54                	je     80219e <readn+0x6a>
+  80214a:	41 89 fd             	mov    %edi,%r13d
+  80214d:	49 89 f6             	mov    %rsi,%r14
+  802150:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802153:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  802158:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  80215d:	49 bf 76 20 80 00 00 	movabs $0x802076,%r15
+  802164:	00 00 00 
+  802167:	4c 89 e2             	mov    %r12,%rdx
+  80216a:	48 29 f2             	sub    %rsi,%rdx
+  80216d:	4c 01 f6             	add    %r14,%rsi
+  802170:	44 89 ef             	mov    %r13d,%edi
+  802173:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802176:	85 c0                	test   %eax,%eax
+  802178:	78 20                	js     80219a <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80217a:	01 c3                	add    %eax,%ebx
+  80217c:	85 c0                	test   %eax,%eax
+  80217e:	74 08                	je     802188 <readn+0x54>
+  802180:	48 63 f3             	movslq %ebx,%rsi
+  802183:	4c 39 e6             	cmp    %r12,%rsi
+  802186:	72 df                	jb     802167 <readn+0x33>
+    }
+    return res;
+  802188:	48 63 c3             	movslq %ebx,%rax
+}
+  80218b:	48 83 c4 08          	add    $0x8,%rsp
+  80218f:	5b                   	pop    %rbx
+  802190:	41 5c                	pop    %r12
+  802192:	41 5d                	pop    %r13
+  802194:	41 5e                	pop    %r14
+  802196:	41 5f                	pop    %r15
+  802198:	5d                   	pop    %rbp
+  802199:	c3                   	ret
+        if (inc < 0) return inc;
+  80219a:	48 98                	cltq
+  80219c:	eb ed                	jmp    80218b <readn+0x57>
+    int inc = 1, res = 0;
+  80219e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8021a3:	eb e3                	jmp    802188 <readn+0x54>
+
+00000000008021a5 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8021a5:	55                   	push   %rbp
+  8021a6:	48 89 e5             	mov    %rsp,%rbp
+  8021a9:	41 56                	push   %r14
+  8021ab:	41 55                	push   %r13
+  8021ad:	41 54                	push   %r12
+  8021af:	53                   	push   %rbx
+  8021b0:	48 83 ec 10          	sub    $0x10,%rsp
+  8021b4:	89 fb                	mov    %edi,%ebx
+  8021b6:	49 89 f4             	mov    %rsi,%r12
+  8021b9:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8021bc:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8021c0:	48 b8 93 1d 80 00 00 	movabs $0x801d93,%rax
+  8021c7:	00 00 00 
+  8021ca:	ff d0                	call   *%rax
+  8021cc:	85 c0                	test   %eax,%eax
+  8021ce:	78 47                	js     802217 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8021d0:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8021d4:	41 8b 3e             	mov    (%r14),%edi
+  8021d7:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8021db:	48 b8 de 1d 80 00 00 	movabs $0x801dde,%rax
+  8021e2:	00 00 00 
+  8021e5:	ff d0                	call   *%rax
+  8021e7:	85 c0                	test   %eax,%eax
+  8021e9:	78 30                	js     80221b <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8021eb:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8021f0:	74 2d                	je     80221f <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8021f2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8021f6:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8021fa:	48 85 c0             	test   %rax,%rax
+  8021fd:	74 56                	je     802255 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8021ff:	4c 89 ea             	mov    %r13,%rdx
+  802202:	4c 89 e6             	mov    %r12,%rsi
+  802205:	4c 89 f7             	mov    %r14,%rdi
+  802208:	ff d0                	call   *%rax
+}
+  80220a:	48 83 c4 10          	add    $0x10,%rsp
+  80220e:	5b                   	pop    %rbx
+  80220f:	41 5c                	pop    %r12
+  802211:	41 5d                	pop    %r13
+  802213:	41 5e                	pop    %r14
+  802215:	5d                   	pop    %rbp
+  802216:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802217:	48 98                	cltq
+  802219:	eb ef                	jmp    80220a <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80221b:	48 98                	cltq
+  80221d:	eb eb                	jmp    80220a <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80221f:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  802226:	00 00 00 
+  802229:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80222f:	89 da                	mov    %ebx,%edx
+  802231:	48 bf 2d 60 80 00 00 	movabs $0x80602d,%rdi
+  802238:	00 00 00 
+  80223b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802240:	48 b9 2e 09 80 00 00 	movabs $0x80092e,%rcx
+  802247:	00 00 00 
+  80224a:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80224c:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802253:	eb b5                	jmp    80220a <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802255:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80225c:	eb ac                	jmp    80220a <write+0x65>
+
+000000000080225e <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80225e:	55                   	push   %rbp
+  80225f:	48 89 e5             	mov    %rsp,%rbp
+  802262:	41 54                	push   %r12
+  802264:	53                   	push   %rbx
+  802265:	48 83 ec 10          	sub    $0x10,%rsp
+  802269:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80226b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80226f:	48 b8 93 1d 80 00 00 	movabs $0x801d93,%rax
+  802276:	00 00 00 
+  802279:	ff d0                	call   *%rax
+  80227b:	85 c0                	test   %eax,%eax
+  80227d:	78 3e                	js     8022bd <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80227f:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802283:	41 8b 3c 24          	mov    (%r12),%edi
+  802287:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80228b:	48 b8 de 1d 80 00 00 	movabs $0x801dde,%rax
+  802292:	00 00 00 
+  802295:	ff d0                	call   *%rax
+  802297:	85 c0                	test   %eax,%eax
+  802299:	78 22                	js     8022bd <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  80229b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80229f:	48 8b 40 38          	mov    0x38(%rax),%rax
+  8022a3:	48 85 c0             	test   %rax,%rax
+  8022a6:	74 0b                	je     8022b3 <seek+0x55>
+  8022a8:	89 de                	mov    %ebx,%esi
+  8022aa:	4c 89 e7             	mov    %r12,%rdi
+  8022ad:	ff d0                	call   *%rax
+  8022af:	85 c0                	test   %eax,%eax
+  8022b1:	78 0a                	js     8022bd <seek+0x5f>
+
+    fd->fd_offset = offset;
+  8022b3:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  8022b8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022bd:	48 83 c4 10          	add    $0x10,%rsp
+  8022c1:	5b                   	pop    %rbx
+  8022c2:	41 5c                	pop    %r12
+  8022c4:	5d                   	pop    %rbp
+  8022c5:	c3                   	ret
+
+00000000008022c6 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8022c6:	55                   	push   %rbp
+  8022c7:	48 89 e5             	mov    %rsp,%rbp
+  8022ca:	41 55                	push   %r13
+  8022cc:	41 54                	push   %r12
+  8022ce:	53                   	push   %rbx
+  8022cf:	48 83 ec 18          	sub    $0x18,%rsp
+  8022d3:	89 fb                	mov    %edi,%ebx
+  8022d5:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8022d8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8022dc:	48 b8 93 1d 80 00 00 	movabs $0x801d93,%rax
+  8022e3:	00 00 00 
+  8022e6:	ff d0                	call   *%rax
+  8022e8:	85 c0                	test   %eax,%eax
+  8022ea:	78 38                	js     802324 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8022ec:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8022f0:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8022f4:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8022f8:	48 b8 de 1d 80 00 00 	movabs $0x801dde,%rax
+  8022ff:	00 00 00 
+  802302:	ff d0                	call   *%rax
+  802304:	85 c0                	test   %eax,%eax
+  802306:	78 1c                	js     802324 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802308:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  80230d:	74 20                	je     80232f <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80230f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802313:	48 8b 40 30          	mov    0x30(%rax),%rax
+  802317:	48 85 c0             	test   %rax,%rax
+  80231a:	74 47                	je     802363 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  80231c:	44 89 e6             	mov    %r12d,%esi
+  80231f:	4c 89 ef             	mov    %r13,%rdi
+  802322:	ff d0                	call   *%rax
+}
+  802324:	48 83 c4 18          	add    $0x18,%rsp
+  802328:	5b                   	pop    %rbx
+  802329:	41 5c                	pop    %r12
+  80232b:	41 5d                	pop    %r13
+  80232d:	5d                   	pop    %rbp
+  80232e:	c3                   	ret
+                thisenv->env_id, fdnum);
+  80232f:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  802336:	00 00 00 
+  802339:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80233f:	89 da                	mov    %ebx,%edx
+  802341:	48 bf f0 5f 80 00 00 	movabs $0x805ff0,%rdi
+  802348:	00 00 00 
+  80234b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802350:	48 b9 2e 09 80 00 00 	movabs $0x80092e,%rcx
+  802357:	00 00 00 
+  80235a:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80235c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802361:	eb c1                	jmp    802324 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802363:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802368:	eb ba                	jmp    802324 <ftruncate+0x5e>
+
+000000000080236a <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80236a:	55                   	push   %rbp
+  80236b:	48 89 e5             	mov    %rsp,%rbp
+  80236e:	41 54                	push   %r12
+  802370:	53                   	push   %rbx
+  802371:	48 83 ec 10          	sub    $0x10,%rsp
+  802375:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802378:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80237c:	48 b8 93 1d 80 00 00 	movabs $0x801d93,%rax
+  802383:	00 00 00 
+  802386:	ff d0                	call   *%rax
+  802388:	85 c0                	test   %eax,%eax
+  80238a:	78 4e                	js     8023da <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80238c:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802390:	41 8b 3c 24          	mov    (%r12),%edi
+  802394:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802398:	48 b8 de 1d 80 00 00 	movabs $0x801dde,%rax
+  80239f:	00 00 00 
+  8023a2:	ff d0                	call   *%rax
+  8023a4:	85 c0                	test   %eax,%eax
+  8023a6:	78 32                	js     8023da <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8023a8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8023ac:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8023b1:	74 30                	je     8023e3 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8023b3:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8023b6:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8023bd:	00 00 00 
+    stat->st_isdir = 0;
+  8023c0:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8023c7:	00 00 00 
+    stat->st_dev = dev;
+  8023ca:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8023d1:	48 89 de             	mov    %rbx,%rsi
+  8023d4:	4c 89 e7             	mov    %r12,%rdi
+  8023d7:	ff 50 28             	call   *0x28(%rax)
+}
+  8023da:	48 83 c4 10          	add    $0x10,%rsp
+  8023de:	5b                   	pop    %rbx
+  8023df:	41 5c                	pop    %r12
+  8023e1:	5d                   	pop    %rbp
+  8023e2:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8023e3:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8023e8:	eb f0                	jmp    8023da <fstat+0x70>
+
+00000000008023ea <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8023ea:	55                   	push   %rbp
+  8023eb:	48 89 e5             	mov    %rsp,%rbp
+  8023ee:	41 54                	push   %r12
+  8023f0:	53                   	push   %rbx
+  8023f1:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8023f4:	be 00 00 00 00       	mov    $0x0,%esi
+  8023f9:	48 b8 58 35 80 00 00 	movabs $0x803558,%rax
+  802400:	00 00 00 
+  802403:	ff d0                	call   *%rax
+  802405:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802407:	85 c0                	test   %eax,%eax
+  802409:	78 25                	js     802430 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80240b:	4c 89 e6             	mov    %r12,%rsi
+  80240e:	89 c7                	mov    %eax,%edi
+  802410:	48 b8 6a 23 80 00 00 	movabs $0x80236a,%rax
+  802417:	00 00 00 
+  80241a:	ff d0                	call   *%rax
+  80241c:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80241f:	89 df                	mov    %ebx,%edi
+  802421:	48 b8 f8 1e 80 00 00 	movabs $0x801ef8,%rax
+  802428:	00 00 00 
+  80242b:	ff d0                	call   *%rax
+
+    return res;
+  80242d:	44 89 e3             	mov    %r12d,%ebx
+}
+  802430:	89 d8                	mov    %ebx,%eax
+  802432:	5b                   	pop    %rbx
+  802433:	41 5c                	pop    %r12
+  802435:	5d                   	pop    %rbp
+  802436:	c3                   	ret
+
+0000000000802437 <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  802437:	48 b8 08 00 82 00 00 	movabs $0x820008,%rax
+  80243e:	00 00 00 
+  802441:	83 38 00             	cmpl   $0x0,(%rax)
+  802444:	74 0a                	je     802450 <fsenv+0x19>
+    return envid;
+}
+  802446:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  80244d:	00 00 
+  80244f:	c3                   	ret
+fsenv(void) {
+  802450:	55                   	push   %rbp
+  802451:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  802454:	bf 03 00 00 00       	mov    $0x3,%edi
+  802459:	48 b8 42 58 80 00 00 	movabs $0x805842,%rax
+  802460:	00 00 00 
+  802463:	ff d0                	call   *%rax
+  802465:	a3 08 00 82 00 00 00 	movabs %eax,0x820008
+  80246c:	00 00 
+}
+  80246e:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  802475:	00 00 
+  802477:	5d                   	pop    %rbp
+  802478:	c3                   	ret
+
+0000000000802479 <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  802479:	55                   	push   %rbp
+  80247a:	48 89 e5             	mov    %rsp,%rbp
+  80247d:	41 54                	push   %r12
+  80247f:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  802480:	ba 00 50 00 00       	mov    $0x5000,%edx
+  802485:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  80248a:	48 89 de             	mov    %rbx,%rsi
+  80248d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802492:	48 b8 58 18 80 00 00 	movabs $0x801858,%rax
+  802499:	00 00 00 
+  80249c:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  80249e:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  8024a5:	00 00 00 
+  8024a8:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  8024ae:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8024b3:	ba 00 50 00 00       	mov    $0x5000,%edx
+  8024b8:	48 89 de             	mov    %rbx,%rsi
+  8024bb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024c0:	48 b8 b2 17 80 00 00 	movabs $0x8017b2,%rax
+  8024c7:	00 00 00 
+  8024ca:	ff d0                	call   *%rax
+  8024cc:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  8024ce:	85 c0                	test   %eax,%eax
+  8024d0:	0f 88 a2 00 00 00    	js     802578 <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  8024d6:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8024dd:	00 00 00 
+  8024e0:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8024e6:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  8024eb:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  8024ed:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  8024f2:	49 bc d2 52 80 00 00 	movabs $0x8052d2,%r12
+  8024f9:	00 00 00 
+  8024fc:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  8024ff:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  802504:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  802507:	48 b8 37 24 80 00 00 	movabs $0x802437,%rax
+  80250e:	00 00 00 
+  802511:	ff d0                	call   *%rax
+  802513:	89 c7                	mov    %eax,%edi
+  802515:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  80251b:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  802520:	48 89 da             	mov    %rbx,%rdx
+  802523:	be 09 00 00 00       	mov    $0x9,%esi
+  802528:	48 b8 ec 57 80 00 00 	movabs $0x8057ec,%rax
+  80252f:	00 00 00 
+  802532:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  802534:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802539:	ba 00 00 00 00       	mov    $0x0,%edx
+  80253e:	be 00 00 00 00       	mov    $0x0,%esi
+  802543:	bf 00 00 00 00       	mov    $0x0,%edi
+  802548:	48 b8 c8 57 80 00 00 	movabs $0x8057c8,%rax
+  80254f:	00 00 00 
+  802552:	ff d0                	call   *%rax
+  802554:	89 c3                	mov    %eax,%ebx
+  802556:	85 c0                	test   %eax,%eax
+  802558:	78 25                	js     80257f <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  80255a:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  802561:	00 00 00 
+  802564:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80256a:	a3 00 26 82 00 00 00 	movabs %eax,0x822600
+  802571:	00 00 
+    return 0;
+  802573:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  802578:	89 d8                	mov    %ebx,%eax
+  80257a:	5b                   	pop    %rbx
+  80257b:	41 5c                	pop    %r12
+  80257d:	5d                   	pop    %rbp
+  80257e:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  80257f:	ba 00 50 00 00       	mov    $0x5000,%edx
+  802584:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  802589:	bf 00 00 00 00       	mov    $0x0,%edi
+  80258e:	48 b8 58 18 80 00 00 	movabs $0x801858,%rax
+  802595:	00 00 00 
+  802598:	ff d0                	call   *%rax
+        return res;
+  80259a:	eb dc                	jmp    802578 <fschan_setup+0xff>
+
+000000000080259c <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  80259c:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  8025a3:	00 00 00 
+  8025a6:	80 38 00             	cmpb   $0x0,(%rax)
+  8025a9:	74 55                	je     802600 <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  8025ab:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8025b2:	00 00 00 
+  8025b5:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  8025bb:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  8025c0:	48 ba 00 26 82 00 00 	movabs $0x822600,%rdx
+  8025c7:	00 00 00 
+  8025ca:	3b 0a                	cmp    (%rdx),%ecx
+  8025cc:	75 01                	jne    8025cf <fschan+0x33>
+}
+  8025ce:	c3                   	ret
+fschan(void) {
+  8025cf:	55                   	push   %rbp
+  8025d0:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  8025d3:	48 b8 79 24 80 00 00 	movabs $0x802479,%rax
+  8025da:	00 00 00 
+  8025dd:	ff d0                	call   *%rax
+  8025df:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  8025e1:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  8025e6:	85 d2                	test   %edx,%edx
+  8025e8:	78 02                	js     8025ec <fschan+0x50>
+}
+  8025ea:	5d                   	pop    %rbp
+  8025eb:	c3                   	ret
+        fschan_enabled = 0;
+  8025ec:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  8025f3:	00 00 00 
+  8025f6:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  8025f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025fe:	eb ea                	jmp    8025ea <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  802600:	b8 00 00 00 00       	mov    $0x0,%eax
+  802605:	c3                   	ret
+
+0000000000802606 <fbuf>:
+fbuf(struct Fd *fd) {
+  802606:	55                   	push   %rbp
+  802607:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  80260a:	48 b8 05 1d 80 00 00 	movabs $0x801d05,%rax
+  802611:	00 00 00 
+  802614:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  802616:	ba 00 00 00 00       	mov    $0x0,%edx
+  80261b:	48 83 f8 1f          	cmp    $0x1f,%rax
+  80261f:	77 12                	ja     802633 <fbuf+0x2d>
+  802621:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  802625:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  80262c:	00 00 00 
+  80262f:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  802633:	48 89 d0             	mov    %rdx,%rax
+  802636:	5d                   	pop    %rbp
+  802637:	c3                   	ret
+
+0000000000802638 <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  802638:	55                   	push   %rbp
+  802639:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  80263c:	48 83 c7 40          	add    $0x40,%rdi
+  802640:	48 b8 0c 53 80 00 00 	movabs $0x80530c,%rax
+  802647:	00 00 00 
+  80264a:	ff d0                	call   *%rax
+  80264c:	84 c0                	test   %al,%al
+  80264e:	75 02                	jne    802652 <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  802650:	5d                   	pop    %rbp
+  802651:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  802652:	48 b8 37 24 80 00 00 	movabs $0x802437,%rax
+  802659:	00 00 00 
+  80265c:	ff d0                	call   *%rax
+  80265e:	89 c7                	mov    %eax,%edi
+  802660:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802666:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80266b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802670:	be 0a 00 00 00       	mov    $0xa,%esi
+  802675:	48 b8 ec 57 80 00 00 	movabs $0x8057ec,%rax
+  80267c:	00 00 00 
+  80267f:	ff d0                	call   *%rax
+}
+  802681:	eb cd                	jmp    802650 <fschan_publish+0x18>
+
+0000000000802683 <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  802683:	55                   	push   %rbp
+  802684:	48 89 e5             	mov    %rsp,%rbp
+  802687:	41 57                	push   %r15
+  802689:	41 56                	push   %r14
+  80268b:	41 55                	push   %r13
+  80268d:	41 54                	push   %r12
+  80268f:	53                   	push   %rbx
+  802690:	48 83 ec 48          	sub    $0x48,%rsp
+  802694:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802698:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  80269c:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  80269f:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  8026a3:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  8026a6:	48 ba 04 00 82 00 00 	movabs $0x820004,%rdx
+  8026ad:	00 00 00 
+  8026b0:	8b 02                	mov    (%rdx),%eax
+  8026b2:	83 c0 01             	add    $0x1,%eax
+  8026b5:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8026ba:	0f 44 c1             	cmove  %ecx,%eax
+  8026bd:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  8026bf:	4d 85 c0             	test   %r8,%r8
+  8026c2:	74 2c                	je     8026f0 <fschan_rw+0x6d>
+  8026c4:	45 89 ce             	mov    %r9d,%r14d
+  8026c7:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  8026ce:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  8026d2:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8026d8:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  8026df:	00 
+  8026e0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8026e6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8026eb:	e9 41 01 00 00       	jmp    802831 <fschan_rw+0x1ae>
+  8026f0:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  8026f4:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8026f8:	e9 9c 01 00 00       	jmp    802899 <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  8026fd:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  802701:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  802704:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  802707:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  80270a:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  80270e:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  802712:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  802716:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  80271a:	48 89 da             	mov    %rbx,%rdx
+  80271d:	48 b8 b4 14 80 00 00 	movabs $0x8014b4,%rax
+  802724:	00 00 00 
+  802727:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  802729:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80272d:	48 b8 38 26 80 00 00 	movabs $0x802638,%rax
+  802734:	00 00 00 
+  802737:	ff d0                	call   *%rax
+            queued += blk;
+  802739:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  80273c:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  802740:	4d 39 fc             	cmp    %r15,%r12
+  802743:	73 6b                	jae    8027b0 <fschan_rw+0x12d>
+  802745:	41 83 fd 0f          	cmp    $0xf,%r13d
+  802749:	77 65                	ja     8027b0 <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  80274b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80274f:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  802753:	48 b8 e7 52 80 00 00 	movabs $0x8052e7,%rax
+  80275a:	00 00 00 
+  80275d:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  80275f:	4c 89 fb             	mov    %r15,%rbx
+  802762:	4c 29 e3             	sub    %r12,%rbx
+  802765:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  80276a:	48 39 d3             	cmp    %rdx,%rbx
+  80276d:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  802771:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  802775:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802779:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  80277d:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  802780:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  802782:	48 b9 04 00 82 00 00 	movabs $0x820004,%rcx
+  802789:	00 00 00 
+  80278c:	8b 09                	mov    (%rcx),%ecx
+  80278e:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  802791:	83 fe 03             	cmp    $0x3,%esi
+  802794:	0f 85 63 ff ff ff    	jne    8026fd <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  80279a:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80279e:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  8027a1:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  8027a4:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  8027a7:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  8027ab:	e9 79 ff ff ff       	jmp    802729 <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  8027b0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8027b4:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  8027bb:	48 89 df             	mov    %rbx,%rdi
+  8027be:	48 b8 aa 53 80 00 00 	movabs $0x8053aa,%rax
+  8027c5:	00 00 00 
+  8027c8:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  8027ca:	48 89 df             	mov    %rbx,%rdi
+  8027cd:	48 b8 38 53 80 00 00 	movabs $0x805338,%rax
+  8027d4:	00 00 00 
+  8027d7:	ff d0                	call   *%rax
+  8027d9:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  8027dd:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  8027e1:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  8027e5:	75 25                	jne    80280c <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  8027e7:	8b 40 04             	mov    0x4(%rax),%eax
+  8027ea:	85 c0                	test   %eax,%eax
+  8027ec:	0f 88 86 00 00 00    	js     802878 <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  8027f2:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  8027f6:	74 5b                	je     802853 <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  8027f8:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8027fc:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  802800:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  802804:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  802808:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  80280c:	48 89 df             	mov    %rbx,%rdi
+  80280f:	48 b8 5f 53 80 00 00 	movabs $0x80535f,%rax
+  802816:	00 00 00 
+  802819:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  80281b:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  80281f:	83 f0 01             	xor    $0x1,%eax
+  802822:	4d 39 fc             	cmp    %r15,%r12
+  802825:	0f 92 c2             	setb   %dl
+  802828:	84 c2                	test   %al,%dl
+  80282a:	75 05                	jne    802831 <fschan_rw+0x1ae>
+  80282c:	45 85 ed             	test   %r13d,%r13d
+  80282f:	74 50                	je     802881 <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  802831:	4d 39 fc             	cmp    %r15,%r12
+  802834:	0f 92 c1             	setb   %cl
+  802837:	41 83 fd 0f          	cmp    $0xf,%r13d
+  80283b:	0f 96 c2             	setbe  %dl
+  80283e:	84 d1                	test   %dl,%cl
+  802840:	0f 84 6a ff ff ff    	je     8027b0 <fschan_rw+0x12d>
+  802846:	84 c0                	test   %al,%al
+  802848:	0f 85 fd fe ff ff    	jne    80274b <fschan_rw+0xc8>
+  80284e:	e9 5d ff ff ff       	jmp    8027b0 <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  802853:	48 63 d0             	movslq %eax,%rdx
+  802856:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80285a:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  80285e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802862:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  802866:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  80286a:	48 b8 b4 14 80 00 00 	movabs $0x8014b4,%rax
+  802871:	00 00 00 
+  802874:	ff d0                	call   *%rax
+  802876:	eb 80                	jmp    8027f8 <fschan_rw+0x175>
+                err = msg->fm_res;
+  802878:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  80287b:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  80287f:	eb 8b                	jmp    80280c <fschan_rw+0x189>
+    return done || !err ? done : err;
+  802881:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  802886:	0f 85 68 fe ff ff    	jne    8026f4 <fschan_rw+0x71>
+  80288c:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  80288f:	85 c0                	test   %eax,%eax
+  802891:	0f 84 5d fe ff ff    	je     8026f4 <fschan_rw+0x71>
+  802897:	48 98                	cltq
+}
+  802899:	48 83 c4 48          	add    $0x48,%rsp
+  80289d:	5b                   	pop    %rbx
+  80289e:	41 5c                	pop    %r12
+  8028a0:	41 5d                	pop    %r13
+  8028a2:	41 5e                	pop    %r14
+  8028a4:	41 5f                	pop    %r15
+  8028a6:	5d                   	pop    %rbp
+  8028a7:	c3                   	ret
+
+00000000008028a8 <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  8028a8:	55                   	push   %rbp
+  8028a9:	48 89 e5             	mov    %rsp,%rbp
+  8028ac:	41 56                	push   %r14
+  8028ae:	41 55                	push   %r13
+  8028b0:	41 54                	push   %r12
+  8028b2:	53                   	push   %rbx
+  8028b3:	48 83 ec 10          	sub    $0x10,%rsp
+  8028b7:	49 89 fe             	mov    %rdi,%r14
+  8028ba:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  8028bd:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  8028c1:	48 29 f3             	sub    %rsi,%rbx
+  8028c4:	48 39 d3             	cmp    %rdx,%rbx
+  8028c7:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  8028cb:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8028d2:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  8028d3:	bf 00 10 00 00       	mov    $0x1000,%edi
+  8028d8:	49 bd da 4e 80 00 00 	movabs $0x804eda,%r13
+  8028df:	00 00 00 
+  8028e2:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  8028e9:	76 1e                	jbe    802909 <mmap_fault+0x61>
+  8028eb:	4c 01 e7             	add    %r12,%rdi
+  8028ee:	41 ff d5             	call   *%r13
+  8028f1:	84 c0                	test   %al,%al
+  8028f3:	75 14                	jne    802909 <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  8028f5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8028f9:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  802900:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  802904:	48 39 df             	cmp    %rbx,%rdi
+  802907:	72 e2                	jb     8028eb <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  802909:	48 bb 00 10 82 00 00 	movabs $0x821000,%rbx
+  802910:	00 00 00 
+  802913:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  80291a:	00 00 00 
+  80291d:	4c 89 f0             	mov    %r14,%rax
+  802920:	48 29 d0             	sub    %rdx,%rax
+  802923:	48 c1 f8 03          	sar    $0x3,%rax
+  802927:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  80292e:	aa aa aa 
+  802931:	48 0f af c2          	imul   %rdx,%rax
+  802935:	48 c1 e0 0c          	shl    $0xc,%rax
+  802939:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  80293e:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  802942:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  802944:	44 89 e0             	mov    %r12d,%eax
+  802947:	41 03 46 10          	add    0x10(%r14),%eax
+  80294b:	41 2b 06             	sub    (%r14),%eax
+  80294e:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  802951:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802955:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  802959:	41 8b 46 14          	mov    0x14(%r14),%eax
+  80295d:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  802960:	48 b8 37 24 80 00 00 	movabs $0x802437,%rax
+  802967:	00 00 00 
+  80296a:	ff d0                	call   *%rax
+  80296c:	89 c7                	mov    %eax,%edi
+  80296e:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802974:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802979:	48 89 da             	mov    %rbx,%rdx
+  80297c:	be 0f 00 00 00       	mov    $0xf,%esi
+  802981:	48 b8 ec 57 80 00 00 	movabs $0x8057ec,%rax
+  802988:	00 00 00 
+  80298b:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  80298d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802992:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802996:	4c 89 e6             	mov    %r12,%rsi
+  802999:	bf 00 00 00 00       	mov    $0x0,%edi
+  80299e:	48 b8 c8 57 80 00 00 	movabs $0x8057c8,%rax
+  8029a5:	00 00 00 
+  8029a8:	ff d0                	call   *%rax
+  8029aa:	48 98                	cltq
+}
+  8029ac:	48 83 c4 10          	add    $0x10,%rsp
+  8029b0:	5b                   	pop    %rbx
+  8029b1:	41 5c                	pop    %r12
+  8029b3:	41 5d                	pop    %r13
+  8029b5:	41 5e                	pop    %r14
+  8029b7:	5d                   	pop    %rbp
+  8029b8:	c3                   	ret
+
+00000000008029b9 <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  8029b9:	48 8b 37             	mov    (%rdi),%rsi
+  8029bc:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  8029c3:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  8029ca:	00 00 00 
+  8029cd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8029d2:	eb 0f                	jmp    8029e3 <mmap_pgfault+0x2a>
+  8029d4:	c3                   	ret
+  8029d5:	48 83 c1 01          	add    $0x1,%rcx
+  8029d9:	48 83 c2 18          	add    $0x18,%rdx
+  8029dd:	48 83 f9 20          	cmp    $0x20,%rcx
+  8029e1:	74 6e                	je     802a51 <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  8029e3:	48 8b 02             	mov    (%rdx),%rax
+  8029e6:	48 83 e8 01          	sub    $0x1,%rax
+  8029ea:	48 39 f0             	cmp    %rsi,%rax
+  8029ed:	73 e6                	jae    8029d5 <mmap_pgfault+0x1c>
+  8029ef:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  8029f3:	73 e0                	jae    8029d5 <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  8029f5:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  8029f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029fe:	f6 c2 01             	test   $0x1,%dl
+  802a01:	75 d1                	jne    8029d4 <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  802a03:	f6 c2 02             	test   $0x2,%dl
+  802a06:	74 1a                	je     802a22 <mmap_pgfault+0x69>
+  802a08:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  802a0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a11:	48 bf 00 20 82 00 00 	movabs $0x822000,%rdi
+  802a18:	00 00 00 
+  802a1b:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  802a20:	74 35                	je     802a57 <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  802a22:	55                   	push   %rbp
+  802a23:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  802a26:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  802a2a:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  802a31:	00 00 00 
+  802a34:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  802a38:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802a3d:	48 b8 a8 28 80 00 00 	movabs $0x8028a8,%rax
+  802a44:	00 00 00 
+  802a47:	ff d0                	call   *%rax
+  802a49:	48 85 c0             	test   %rax,%rax
+  802a4c:	0f 9f c0             	setg   %al
+}
+  802a4f:	5d                   	pop    %rbp
+  802a50:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  802a51:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a56:	c3                   	ret
+}
+  802a57:	c3                   	ret
+
+0000000000802a58 <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  802a58:	55                   	push   %rbp
+  802a59:	48 89 e5             	mov    %rsp,%rbp
+  802a5c:	41 54                	push   %r12
+  802a5e:	53                   	push   %rbx
+  802a5f:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802a62:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  802a69:	00 00 00 
+  802a6c:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  802a71:	48 83 38 00          	cmpq   $0x0,(%rax)
+  802a75:	74 15                	je     802a8c <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802a77:	48 83 c3 01          	add    $0x1,%rbx
+  802a7b:	48 83 c0 18          	add    $0x18,%rax
+  802a7f:	48 83 fb 20          	cmp    $0x20,%rbx
+  802a83:	75 ec                	jne    802a71 <mmap_alloc+0x19>
+    return NULL;
+  802a85:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a8a:	eb 52                	jmp    802ade <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  802a8c:	4c 89 e7             	mov    %r12,%rdi
+  802a8f:	48 b8 7b 4e 80 00 00 	movabs $0x804e7b,%rax
+  802a96:	00 00 00 
+  802a99:	ff d0                	call   *%rax
+  802a9b:	41 89 c1             	mov    %eax,%r9d
+  802a9e:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  802aa5:	48 c1 e1 0c          	shl    $0xc,%rcx
+  802aa9:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802aaf:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ab4:	4c 89 e6             	mov    %r12,%rsi
+  802ab7:	bf 00 00 00 00       	mov    $0x0,%edi
+  802abc:	48 b8 08 18 80 00 00 	movabs $0x801808,%rax
+  802ac3:	00 00 00 
+  802ac6:	ff d0                	call   *%rax
+  802ac8:	85 c0                	test   %eax,%eax
+  802aca:	78 17                	js     802ae3 <mmap_alloc+0x8b>
+        return &mmaps[i];
+  802acc:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  802ad0:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  802ad7:	00 00 00 
+  802ada:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  802ade:	5b                   	pop    %rbx
+  802adf:	41 5c                	pop    %r12
+  802ae1:	5d                   	pop    %rbp
+  802ae2:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  802ae3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ae8:	eb f4                	jmp    802ade <mmap_alloc+0x86>
+
+0000000000802aea <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  802aea:	55                   	push   %rbp
+  802aeb:	48 89 e5             	mov    %rsp,%rbp
+  802aee:	41 56                	push   %r14
+  802af0:	41 55                	push   %r13
+  802af2:	41 54                	push   %r12
+  802af4:	53                   	push   %rbx
+  802af5:	48 83 ec 10          	sub    $0x10,%rsp
+  802af9:	41 89 fc             	mov    %edi,%r12d
+  802afc:	49 89 f5             	mov    %rsi,%r13
+  802aff:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  802b02:	48 89 f0             	mov    %rsi,%rax
+  802b05:	48 09 d0             	or     %rdx,%rax
+  802b08:	75 0d                	jne    802b17 <fsipc+0x2d>
+  802b0a:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  802b0d:	83 f8 04             	cmp    $0x4,%eax
+  802b10:	76 7d                	jbe    802b8f <fsipc+0xa5>
+  802b12:	83 ff 0d             	cmp    $0xd,%edi
+  802b15:	74 78                	je     802b8f <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  802b17:	48 b8 37 24 80 00 00 	movabs $0x802437,%rax
+  802b1e:	00 00 00 
+  802b21:	ff d0                	call   *%rax
+  802b23:	89 c7                	mov    %eax,%edi
+  802b25:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  802b2c:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  802b33:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  802b3a:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802b40:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802b47:	00 00 00 
+  802b4a:	44 89 e6             	mov    %r12d,%esi
+  802b4d:	48 b8 ec 57 80 00 00 	movabs $0x8057ec,%rax
+  802b54:	00 00 00 
+  802b57:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  802b59:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  802b60:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  802b61:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802b66:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802b6a:	4c 89 ee             	mov    %r13,%rsi
+  802b6d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b72:	48 b8 c8 57 80 00 00 	movabs $0x8057c8,%rax
+  802b79:	00 00 00 
+  802b7c:	ff d0                	call   *%rax
+  802b7e:	89 c3                	mov    %eax,%ebx
+}
+  802b80:	89 d8                	mov    %ebx,%eax
+  802b82:	48 83 c4 10          	add    $0x10,%rsp
+  802b86:	5b                   	pop    %rbx
+  802b87:	41 5c                	pop    %r12
+  802b89:	41 5d                	pop    %r13
+  802b8b:	41 5e                	pop    %r14
+  802b8d:	5d                   	pop    %rbp
+  802b8e:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  802b8f:	48 b8 9c 25 80 00 00 	movabs $0x80259c,%rax
+  802b96:	00 00 00 
+  802b99:	ff d0                	call   *%rax
+  802b9b:	49 89 c6             	mov    %rax,%r14
+  802b9e:	48 85 c0             	test   %rax,%rax
+  802ba1:	0f 84 70 ff ff ff    	je     802b17 <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  802ba7:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  802bab:	48 b8 e7 52 80 00 00 	movabs $0x8052e7,%rax
+  802bb2:	00 00 00 
+  802bb5:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  802bb7:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  802bba:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  802bc1:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  802bc5:	ba 10 00 00 00       	mov    $0x10,%edx
+  802bca:	48 be 00 00 83 00 00 	movabs $0x830000,%rsi
+  802bd1:	00 00 00 
+  802bd4:	48 b8 b4 14 80 00 00 	movabs $0x8014b4,%rax
+  802bdb:	00 00 00 
+  802bde:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  802be0:	4c 89 f7             	mov    %r14,%rdi
+  802be3:	48 b8 38 26 80 00 00 	movabs $0x802638,%rax
+  802bea:	00 00 00 
+  802bed:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  802bef:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  802bf6:	4c 89 f7             	mov    %r14,%rdi
+  802bf9:	48 b8 aa 53 80 00 00 	movabs $0x8053aa,%rax
+  802c00:	00 00 00 
+  802c03:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  802c05:	4c 89 f7             	mov    %r14,%rdi
+  802c08:	48 b8 38 53 80 00 00 	movabs $0x805338,%rax
+  802c0f:	00 00 00 
+  802c12:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  802c14:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  802c17:	41 83 fc 05          	cmp    $0x5,%r12d
+  802c1b:	75 04                	jne    802c21 <fsipc+0x137>
+  802c1d:	85 db                	test   %ebx,%ebx
+  802c1f:	79 14                	jns    802c35 <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  802c21:	4c 89 f7             	mov    %r14,%rdi
+  802c24:	48 b8 5f 53 80 00 00 	movabs $0x80535f,%rax
+  802c2b:	00 00 00 
+  802c2e:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  802c30:	e9 4b ff ff ff       	jmp    802b80 <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  802c35:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  802c39:	ba 88 00 00 00       	mov    $0x88,%edx
+  802c3e:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  802c45:	00 00 00 
+  802c48:	48 b8 b4 14 80 00 00 	movabs $0x8014b4,%rax
+  802c4f:	00 00 00 
+  802c52:	ff d0                	call   *%rax
+  802c54:	eb cb                	jmp    802c21 <fsipc+0x137>
+
+0000000000802c56 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  802c56:	55                   	push   %rbp
+  802c57:	48 89 e5             	mov    %rsp,%rbp
+  802c5a:	41 57                	push   %r15
+  802c5c:	41 56                	push   %r14
+  802c5e:	41 55                	push   %r13
+  802c60:	41 54                	push   %r12
+  802c62:	53                   	push   %rbx
+  802c63:	48 83 ec 18          	sub    $0x18,%rsp
+  802c67:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  802c6b:	49 89 f6             	mov    %rsi,%r14
+  802c6e:	49 89 d4             	mov    %rdx,%r12
+  802c71:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  802c74:	48 b8 9c 25 80 00 00 	movabs $0x80259c,%rax
+  802c7b:	00 00 00 
+  802c7e:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  802c80:	48 85 c0             	test   %rax,%rax
+  802c83:	0f 85 96 00 00 00    	jne    802d1f <devfile_write_direct+0xc9>
+    size_t write = 0;
+  802c89:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802c90:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802c91:	49 bf 00 00 83 00 00 	movabs $0x830000,%r15
+  802c98:	00 00 00 
+    while (n) {
+  802c9b:	4d 85 e4             	test   %r12,%r12
+  802c9e:	74 79                	je     802d19 <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802ca0:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  802ca5:	49 39 dc             	cmp    %rbx,%r12
+  802ca8:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  802cac:	48 89 da             	mov    %rbx,%rdx
+  802caf:	4c 89 f6             	mov    %r14,%rsi
+  802cb2:	48 bf 00 10 83 00 00 	movabs $0x831000,%rdi
+  802cb9:	00 00 00 
+  802cbc:	48 b8 b4 14 80 00 00 	movabs $0x8014b4,%rax
+  802cc3:	00 00 00 
+  802cc6:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802cc8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802ccc:	8b 40 0c             	mov    0xc(%rax),%eax
+  802ccf:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  802cd2:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802cd5:	44 01 e8             	add    %r13d,%eax
+  802cd8:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  802cdc:	41 0f 44 c5          	cmove  %r13d,%eax
+  802ce0:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  802ce4:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  802ce8:	48 89 da             	mov    %rbx,%rdx
+  802ceb:	be 00 00 00 00       	mov    $0x0,%esi
+  802cf0:	bf 04 00 00 00       	mov    $0x4,%edi
+  802cf5:	48 b8 ea 2a 80 00 00 	movabs $0x802aea,%rax
+  802cfc:	00 00 00 
+  802cff:	ff d0                	call   *%rax
+        if (res < 0)
+  802d01:	85 c0                	test   %eax,%eax
+  802d03:	78 4a                	js     802d4f <devfile_write_direct+0xf9>
+        buf += res;
+  802d05:	48 98                	cltq
+  802d07:	49 01 c6             	add    %rax,%r14
+        write += res;
+  802d0a:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  802d0e:	49 29 c4             	sub    %rax,%r12
+  802d11:	75 8d                	jne    802ca0 <devfile_write_direct+0x4a>
+    return write;
+  802d13:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802d17:	eb 27                	jmp    802d40 <devfile_write_direct+0xea>
+    size_t write = 0;
+  802d19:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  802d1d:	eb f4                	jmp    802d13 <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  802d1f:	45 89 e9             	mov    %r13d,%r9d
+  802d22:	4d 89 e0             	mov    %r12,%r8
+  802d25:	4c 89 f1             	mov    %r14,%rcx
+  802d28:	ba 04 00 00 00       	mov    $0x4,%edx
+  802d2d:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802d31:	48 89 c7             	mov    %rax,%rdi
+  802d34:	48 b8 83 26 80 00 00 	movabs $0x802683,%rax
+  802d3b:	00 00 00 
+  802d3e:	ff d0                	call   *%rax
+}
+  802d40:	48 83 c4 18          	add    $0x18,%rsp
+  802d44:	5b                   	pop    %rbx
+  802d45:	41 5c                	pop    %r12
+  802d47:	41 5d                	pop    %r13
+  802d49:	41 5e                	pop    %r14
+  802d4b:	41 5f                	pop    %r15
+  802d4d:	5d                   	pop    %rbp
+  802d4e:	c3                   	ret
+            return res;
+  802d4f:	48 98                	cltq
+  802d51:	eb ed                	jmp    802d40 <devfile_write_direct+0xea>
+
+0000000000802d53 <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  802d53:	55                   	push   %rbp
+  802d54:	48 89 e5             	mov    %rsp,%rbp
+  802d57:	41 54                	push   %r12
+  802d59:	53                   	push   %rbx
+  802d5a:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  802d5d:	48 b8 06 26 80 00 00 	movabs $0x802606,%rax
+  802d64:	00 00 00 
+  802d67:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  802d69:	48 85 c0             	test   %rax,%rax
+  802d6c:	74 71                	je     802ddf <fbuf_flush+0x8c>
+  802d6e:	48 89 c3             	mov    %rax,%rbx
+  802d71:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d76:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  802d7a:	75 05                	jne    802d81 <fbuf_flush+0x2e>
+}
+  802d7c:	5b                   	pop    %rbx
+  802d7d:	41 5c                	pop    %r12
+  802d7f:	5d                   	pop    %rbp
+  802d80:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  802d81:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  802d84:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  802d88:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802d8f:	00 00 00 
+  802d92:	48 89 de             	mov    %rbx,%rsi
+  802d95:	48 29 c6             	sub    %rax,%rsi
+  802d98:	48 c1 fe 03          	sar    $0x3,%rsi
+  802d9c:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802da3:	aa aa aa 
+  802da6:	48 0f af f0          	imul   %rax,%rsi
+  802daa:	48 c1 e6 0e          	shl    $0xe,%rsi
+  802dae:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802db3:	48 01 c6             	add    %rax,%rsi
+  802db6:	4c 89 e7             	mov    %r12,%rdi
+  802db9:	48 b8 56 2c 80 00 00 	movabs $0x802c56,%rax
+  802dc0:	00 00 00 
+  802dc3:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  802dc5:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  802dc9:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802dd0:	00 
+    return res < 0 ? res : 0;
+  802dd1:	48 85 c0             	test   %rax,%rax
+  802dd4:	ba 00 00 00 00       	mov    $0x0,%edx
+  802dd9:	48 0f 4f c2          	cmovg  %rdx,%rax
+  802ddd:	eb 9d                	jmp    802d7c <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  802ddf:	b8 00 00 00 00       	mov    $0x0,%eax
+  802de4:	eb 96                	jmp    802d7c <fbuf_flush+0x29>
+
+0000000000802de6 <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  802de6:	55                   	push   %rbp
+  802de7:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  802dea:	48 b8 53 2d 80 00 00 	movabs $0x802d53,%rax
+  802df1:	00 00 00 
+  802df4:	ff d0                	call   *%rax
+}
+  802df6:	5d                   	pop    %rbp
+  802df7:	c3                   	ret
+
+0000000000802df8 <devfile_write>:
+    if (!fd || !buf)
+  802df8:	48 85 ff             	test   %rdi,%rdi
+  802dfb:	0f 84 d3 01 00 00    	je     802fd4 <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802e01:	55                   	push   %rbp
+  802e02:	48 89 e5             	mov    %rsp,%rbp
+  802e05:	41 57                	push   %r15
+  802e07:	41 56                	push   %r14
+  802e09:	41 55                	push   %r13
+  802e0b:	41 54                	push   %r12
+  802e0d:	53                   	push   %rbx
+  802e0e:	48 83 ec 08          	sub    $0x8,%rsp
+  802e12:	49 89 fc             	mov    %rdi,%r12
+  802e15:	49 89 f6             	mov    %rsi,%r14
+  802e18:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  802e1b:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802e20:	48 85 f6             	test   %rsi,%rsi
+  802e23:	0f 84 9c 01 00 00    	je     802fc5 <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  802e29:	48 b8 06 26 80 00 00 	movabs $0x802606,%rax
+  802e30:	00 00 00 
+  802e33:	ff d0                	call   *%rax
+  802e35:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  802e38:	48 85 c0             	test   %rax,%rax
+  802e3b:	0f 84 a2 00 00 00    	je     802ee3 <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802e41:	be 00 10 00 00       	mov    $0x1000,%esi
+  802e46:	4c 89 e7             	mov    %r12,%rdi
+  802e49:	48 b8 77 17 80 00 00 	movabs $0x801777,%rax
+  802e50:	00 00 00 
+  802e53:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  802e55:	83 f8 02             	cmp    $0x2,%eax
+  802e58:	0f 8f 85 00 00 00    	jg     802ee3 <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  802e5e:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802e65:	00 00 00 
+  802e68:	4d 89 ef             	mov    %r13,%r15
+  802e6b:	49 29 c7             	sub    %rax,%r15
+  802e6e:	49 c1 ff 03          	sar    $0x3,%r15
+  802e72:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802e79:	aa aa aa 
+  802e7c:	4c 0f af f8          	imul   %rax,%r15
+  802e80:	49 c1 e7 0e          	shl    $0xe,%r15
+  802e84:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802e89:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  802e8c:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802e91:	0f 84 d7 00 00 00    	je     802f6e <devfile_write+0x176>
+  802e97:	49 8b 45 10          	mov    0x10(%r13),%rax
+  802e9b:	89 c2                	mov    %eax,%edx
+  802e9d:	41 03 55 0c          	add    0xc(%r13),%edx
+  802ea1:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  802ea6:	75 0f                	jne    802eb7 <devfile_write+0xbf>
+  802ea8:	48 01 d8             	add    %rbx,%rax
+  802eab:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  802eb1:	0f 86 92 00 00 00    	jbe    802f49 <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802eb7:	4c 89 e7             	mov    %r12,%rdi
+  802eba:	48 b8 53 2d 80 00 00 	movabs $0x802d53,%rax
+  802ec1:	00 00 00 
+  802ec4:	ff d0                	call   *%rax
+  802ec6:	85 c0                	test   %eax,%eax
+  802ec8:	78 52                	js     802f1c <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802eca:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802ed1:	77 7f                	ja     802f52 <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  802ed3:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802ed8:	0f 85 c2 00 00 00    	jne    802fa0 <devfile_write+0x1a8>
+  802ede:	e9 94 00 00 00       	jmp    802f77 <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  802ee3:	4c 89 e7             	mov    %r12,%rdi
+  802ee6:	48 b8 53 2d 80 00 00 	movabs $0x802d53,%rax
+  802eed:	00 00 00 
+  802ef0:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802ef2:	85 c0                	test   %eax,%eax
+  802ef4:	79 07                	jns    802efd <devfile_write+0x105>
+  802ef6:	48 98                	cltq
+  802ef8:	e9 c8 00 00 00       	jmp    802fc5 <devfile_write+0x1cd>
+  802efd:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802f02:	48 89 da             	mov    %rbx,%rdx
+  802f05:	4c 89 f6             	mov    %r14,%rsi
+  802f08:	4c 89 e7             	mov    %r12,%rdi
+  802f0b:	48 b8 56 2c 80 00 00 	movabs $0x802c56,%rax
+  802f12:	00 00 00 
+  802f15:	ff d0                	call   *%rax
+  802f17:	e9 a9 00 00 00       	jmp    802fc5 <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802f1c:	48 98                	cltq
+  802f1e:	e9 a2 00 00 00       	jmp    802fc5 <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802f23:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802f28:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802f2d:	4c 89 fe             	mov    %r15,%rsi
+  802f30:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f35:	48 b8 b2 17 80 00 00 	movabs $0x8017b2,%rax
+  802f3c:	00 00 00 
+  802f3f:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  802f41:	85 c0                	test   %eax,%eax
+  802f43:	79 45                	jns    802f8a <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802f45:	48 98                	cltq
+  802f47:	eb 7c                	jmp    802fc5 <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802f49:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802f50:	76 4e                	jbe    802fa0 <devfile_write+0x1a8>
+  802f52:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802f57:	48 89 da             	mov    %rbx,%rdx
+  802f5a:	4c 89 f6             	mov    %r14,%rsi
+  802f5d:	4c 89 e7             	mov    %r12,%rdi
+  802f60:	48 b8 56 2c 80 00 00 	movabs $0x802c56,%rax
+  802f67:	00 00 00 
+  802f6a:	ff d0                	call   *%rax
+  802f6c:	eb 57                	jmp    802fc5 <devfile_write+0x1cd>
+  802f6e:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802f75:	77 db                	ja     802f52 <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  802f77:	4c 89 ff             	mov    %r15,%rdi
+  802f7a:	48 b8 da 4e 80 00 00 	movabs $0x804eda,%rax
+  802f81:	00 00 00 
+  802f84:	ff d0                	call   *%rax
+  802f86:	84 c0                	test   %al,%al
+  802f88:	74 99                	je     802f23 <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  802f8a:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  802f8f:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802f94:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  802f98:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  802f9f:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  802fa0:	4c 89 ff             	mov    %r15,%rdi
+  802fa3:	49 03 7d 10          	add    0x10(%r13),%rdi
+  802fa7:	48 89 da             	mov    %rbx,%rdx
+  802faa:	4c 89 f6             	mov    %r14,%rsi
+  802fad:	48 b8 b4 14 80 00 00 	movabs $0x8014b4,%rax
+  802fb4:	00 00 00 
+  802fb7:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  802fb9:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  802fbd:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  802fc2:	48 89 d8             	mov    %rbx,%rax
+}
+  802fc5:	48 83 c4 08          	add    $0x8,%rsp
+  802fc9:	5b                   	pop    %rbx
+  802fca:	41 5c                	pop    %r12
+  802fcc:	41 5d                	pop    %r13
+  802fce:	41 5e                	pop    %r14
+  802fd0:	41 5f                	pop    %r15
+  802fd2:	5d                   	pop    %rbp
+  802fd3:	c3                   	ret
+        return E_INVAL;
+  802fd4:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802fd9:	c3                   	ret
+
+0000000000802fda <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802fda:	55                   	push   %rbp
+  802fdb:	48 89 e5             	mov    %rsp,%rbp
+  802fde:	41 54                	push   %r12
+  802fe0:	53                   	push   %rbx
+  802fe1:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  802fe4:	48 b8 53 2d 80 00 00 	movabs $0x802d53,%rax
+  802feb:	00 00 00 
+  802fee:	ff d0                	call   *%rax
+  802ff0:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  802ff3:	48 89 df             	mov    %rbx,%rdi
+  802ff6:	48 b8 06 26 80 00 00 	movabs $0x802606,%rax
+  802ffd:	00 00 00 
+  803000:	ff d0                	call   *%rax
+  803002:	48 85 c0             	test   %rax,%rax
+  803005:	74 17                	je     80301e <devfile_flush+0x44>
+  803007:	48 89 df             	mov    %rbx,%rdi
+  80300a:	48 b8 06 26 80 00 00 	movabs $0x802606,%rax
+  803011:	00 00 00 
+  803014:	ff d0                	call   *%rax
+  803016:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  80301d:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80301e:	8b 43 0c             	mov    0xc(%rbx),%eax
+  803021:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  803028:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  80302a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80302f:	be 00 00 00 00       	mov    $0x0,%esi
+  803034:	bf 06 00 00 00       	mov    $0x6,%edi
+  803039:	48 b8 ea 2a 80 00 00 	movabs $0x802aea,%rax
+  803040:	00 00 00 
+  803043:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  803045:	45 85 e4             	test   %r12d,%r12d
+  803048:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  80304c:	5b                   	pop    %rbx
+  80304d:	41 5c                	pop    %r12
+  80304f:	5d                   	pop    %rbp
+  803050:	c3                   	ret
+
+0000000000803051 <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  803051:	55                   	push   %rbp
+  803052:	48 89 e5             	mov    %rsp,%rbp
+  803055:	41 57                	push   %r15
+  803057:	41 56                	push   %r14
+  803059:	41 55                	push   %r13
+  80305b:	41 54                	push   %r12
+  80305d:	53                   	push   %rbx
+  80305e:	48 83 ec 38          	sub    $0x38,%rsp
+  803062:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  803066:	49 89 f7             	mov    %rsi,%r15
+  803069:	48 89 d3             	mov    %rdx,%rbx
+  80306c:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  80306f:	48 b8 9c 25 80 00 00 	movabs $0x80259c,%rax
+  803076:	00 00 00 
+  803079:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  80307b:	48 85 c0             	test   %rax,%rax
+  80307e:	75 20                	jne    8030a0 <devfile_read_direct+0x4f>
+    bool map = 1;
+  803080:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  803085:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  80308c:	00 
+    while (n) {
+  80308d:	48 85 db             	test   %rbx,%rbx
+  803090:	0f 85 df 00 00 00    	jne    803175 <devfile_read_direct+0x124>
+    size_t read = 0;
+  803096:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  80309a:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80309e:	eb 21                	jmp    8030c1 <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  8030a0:	45 89 f1             	mov    %r14d,%r9d
+  8030a3:	49 89 d8             	mov    %rbx,%r8
+  8030a6:	4c 89 f9             	mov    %r15,%rcx
+  8030a9:	ba 03 00 00 00       	mov    $0x3,%edx
+  8030ae:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  8030b2:	48 89 c7             	mov    %rax,%rdi
+  8030b5:	48 b8 83 26 80 00 00 	movabs $0x802683,%rax
+  8030bc:	00 00 00 
+  8030bf:	ff d0                	call   *%rax
+}
+  8030c1:	48 83 c4 38          	add    $0x38,%rsp
+  8030c5:	5b                   	pop    %rbx
+  8030c6:	41 5c                	pop    %r12
+  8030c8:	41 5d                	pop    %r13
+  8030ca:	41 5e                	pop    %r14
+  8030cc:	41 5f                	pop    %r15
+  8030ce:	5d                   	pop    %rbp
+  8030cf:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  8030d0:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8030d4:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  8030da:	75 1e                	jne    8030fa <devfile_read_direct+0xa9>
+  8030dc:	e9 e2 00 00 00       	jmp    8031c3 <devfile_read_direct+0x172>
+            if (!res) return read;
+  8030e1:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8030e5:	eb da                	jmp    8030c1 <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  8030e7:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  8030eb:	0f 85 d0 01 00 00    	jne    8032c1 <devfile_read_direct+0x270>
+            map = 0;
+  8030f1:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  8030f5:	eb 03                	jmp    8030fa <devfile_read_direct+0xa9>
+  8030f7:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  8030fa:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8030ff:	48 39 d3             	cmp    %rdx,%rbx
+  803102:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803106:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80310a:	8b 40 0c             	mov    0xc(%rax),%eax
+  80310d:	48 b9 00 00 83 00 00 	movabs $0x830000,%rcx
+  803114:	00 00 00 
+  803117:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  803119:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  80311d:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  803121:	be 00 00 00 00       	mov    $0x0,%esi
+  803126:	bf 03 00 00 00       	mov    $0x3,%edi
+  80312b:	48 b8 ea 2a 80 00 00 	movabs $0x802aea,%rax
+  803132:	00 00 00 
+  803135:	ff d0                	call   *%rax
+        if (res <= 0)
+  803137:	85 c0                	test   %eax,%eax
+  803139:	0f 8e 63 01 00 00    	jle    8032a2 <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  80313f:	4c 63 e0             	movslq %eax,%r12
+  803142:	4c 89 e2             	mov    %r12,%rdx
+  803145:	48 be 00 10 83 00 00 	movabs $0x831000,%rsi
+  80314c:	00 00 00 
+  80314f:	4c 89 ff             	mov    %r15,%rdi
+  803152:	48 b8 b4 14 80 00 00 	movabs $0x8014b4,%rax
+  803159:	00 00 00 
+  80315c:	ff d0                	call   *%rax
+        buf += res;
+  80315e:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  803161:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  803164:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  803168:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  80316c:	48 85 db             	test   %rbx,%rbx
+  80316f:	0f 84 25 ff ff ff    	je     80309a <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  803175:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  803178:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  80317c:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  803180:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  803184:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  80318b:	0f 97 c2             	seta   %dl
+  80318e:	20 c2                	and    %al,%dl
+  803190:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  803193:	0f 84 5e ff ff ff    	je     8030f7 <devfile_read_direct+0xa6>
+  803199:	4c 89 fa             	mov    %r15,%rdx
+  80319c:	4d 89 fd             	mov    %r15,%r13
+  80319f:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  8031a6:	0f 85 4e ff ff ff    	jne    8030fa <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  8031ac:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8031b0:	0f 84 1a ff ff ff    	je     8030d0 <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  8031b6:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  8031bd:	0f 85 37 ff ff ff    	jne    8030fa <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  8031c3:	48 89 d8             	mov    %rbx,%rax
+  8031c6:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8031cc:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  8031d1:	48 39 c8             	cmp    %rcx,%rax
+  8031d4:	48 0f 47 c1          	cmova  %rcx,%rax
+  8031d8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  8031dc:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  8031e0:	49 89 d4             	mov    %rdx,%r12
+  8031e3:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  8031e7:	48 b8 7b 4e 80 00 00 	movabs $0x804e7b,%rax
+  8031ee:	00 00 00 
+  8031f1:	ff d0                	call   *%rax
+  8031f3:	a8 40                	test   $0x40,%al
+  8031f5:	0f 85 b9 00 00 00    	jne    8032b4 <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  8031fb:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  803202:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803206:	49 39 c5             	cmp    %rax,%r13
+  803209:	72 d8                	jb     8031e3 <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80320b:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  80320f:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  803216:	00 00 00 
+  803219:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  80321d:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  803220:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  803222:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  803226:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  80322a:	48 b8 37 24 80 00 00 	movabs $0x802437,%rax
+  803231:	00 00 00 
+  803234:	ff d0                	call   *%rax
+  803236:	89 c7                	mov    %eax,%edi
+  803238:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80323e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803243:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  80324a:	00 00 00 
+  80324d:	be 0e 00 00 00       	mov    $0xe,%esi
+  803252:	48 b8 ec 57 80 00 00 	movabs $0x8057ec,%rax
+  803259:	00 00 00 
+  80325c:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  80325e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803263:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  803267:	4c 89 fe             	mov    %r15,%rsi
+  80326a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80326f:	48 b8 c8 57 80 00 00 	movabs $0x8057c8,%rax
+  803276:	00 00 00 
+  803279:	ff d0                	call   *%rax
+  80327b:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  80327e:	48 85 d2             	test   %rdx,%rdx
+  803281:	0f 84 5a fe ff ff    	je     8030e1 <devfile_read_direct+0x90>
+            if (res > 0) {
+  803287:	0f 8e 5a fe ff ff    	jle    8030e7 <devfile_read_direct+0x96>
+                buf += res;
+  80328d:	48 98                	cltq
+  80328f:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  803292:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  803295:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  803299:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  80329d:	e9 ca fe ff ff       	jmp    80316c <devfile_read_direct+0x11b>
+            return res ? res : read;
+  8032a2:	41 89 c5             	mov    %eax,%r13d
+  8032a5:	48 98                	cltq
+  8032a7:	45 85 ed             	test   %r13d,%r13d
+  8032aa:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  8032af:	e9 0d fe ff ff       	jmp    8030c1 <devfile_read_direct+0x70>
+            map = 0;
+  8032b4:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  8032b8:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  8032bc:	e9 39 fe ff ff       	jmp    8030fa <devfile_read_direct+0xa9>
+  8032c1:	48 89 d0             	mov    %rdx,%rax
+  8032c4:	e9 f8 fd ff ff       	jmp    8030c1 <devfile_read_direct+0x70>
+
+00000000008032c9 <devfile_read>:
+    if (!fd || !buf)
+  8032c9:	48 85 ff             	test   %rdi,%rdi
+  8032cc:	0f 84 21 02 00 00    	je     8034f3 <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8032d2:	55                   	push   %rbp
+  8032d3:	48 89 e5             	mov    %rsp,%rbp
+  8032d6:	41 57                	push   %r15
+  8032d8:	41 56                	push   %r14
+  8032da:	41 55                	push   %r13
+  8032dc:	41 54                	push   %r12
+  8032de:	53                   	push   %rbx
+  8032df:	48 83 ec 28          	sub    $0x28,%rsp
+  8032e3:	48 89 fb             	mov    %rdi,%rbx
+  8032e6:	49 89 f4             	mov    %rsi,%r12
+  8032e9:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  8032ec:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  8032f1:	48 85 f6             	test   %rsi,%rsi
+  8032f4:	74 4b                	je     803341 <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  8032f6:	48 b8 06 26 80 00 00 	movabs $0x802606,%rax
+  8032fd:	00 00 00 
+  803300:	ff d0                	call   *%rax
+  803302:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  803305:	48 85 c0             	test   %rax,%rax
+  803308:	74 22                	je     80332c <devfile_read+0x63>
+  80330a:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  803311:	77 19                	ja     80332c <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  803313:	be 00 10 00 00       	mov    $0x1000,%esi
+  803318:	48 89 df             	mov    %rbx,%rdi
+  80331b:	48 b8 77 17 80 00 00 	movabs $0x801777,%rax
+  803322:	00 00 00 
+  803325:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  803327:	83 f8 02             	cmp    $0x2,%eax
+  80332a:	7e 40                	jle    80336c <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  80332c:	48 89 df             	mov    %rbx,%rdi
+  80332f:	48 b8 53 2d 80 00 00 	movabs $0x802d53,%rax
+  803336:	00 00 00 
+  803339:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  80333b:	85 c0                	test   %eax,%eax
+  80333d:	79 11                	jns    803350 <devfile_read+0x87>
+  80333f:	48 98                	cltq
+}
+  803341:	48 83 c4 28          	add    $0x28,%rsp
+  803345:	5b                   	pop    %rbx
+  803346:	41 5c                	pop    %r12
+  803348:	41 5d                	pop    %r13
+  80334a:	41 5e                	pop    %r14
+  80334c:	41 5f                	pop    %r15
+  80334e:	5d                   	pop    %rbp
+  80334f:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  803350:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  803355:	4c 89 ea             	mov    %r13,%rdx
+  803358:	4c 89 e6             	mov    %r12,%rsi
+  80335b:	48 89 df             	mov    %rbx,%rdi
+  80335e:	48 b8 51 30 80 00 00 	movabs $0x803051,%rax
+  803365:	00 00 00 
+  803368:	ff d0                	call   *%rax
+  80336a:	eb d5                	jmp    803341 <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  80336c:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  803370:	48 89 df             	mov    %rbx,%rdi
+  803373:	48 b8 53 2d 80 00 00 	movabs $0x802d53,%rax
+  80337a:	00 00 00 
+  80337d:	ff d0                	call   *%rax
+  80337f:	85 c0                	test   %eax,%eax
+  803381:	0f 88 33 01 00 00    	js     8034ba <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  803387:	48 ba 00 23 82 00 00 	movabs $0x822300,%rdx
+  80338e:	00 00 00 
+  803391:	4c 89 f0             	mov    %r14,%rax
+  803394:	48 29 d0             	sub    %rdx,%rax
+  803397:	48 c1 f8 03          	sar    $0x3,%rax
+  80339b:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  8033a2:	aa aa aa 
+  8033a5:	48 0f af c2          	imul   %rdx,%rax
+  8033a9:	48 c1 e0 0e          	shl    $0xe,%rax
+  8033ad:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  8033b1:	8b 43 0c             	mov    0xc(%rbx),%eax
+  8033b4:	41 39 06             	cmp    %eax,(%r14)
+  8033b7:	75 0d                	jne    8033c6 <devfile_read+0xfd>
+  8033b9:	8b 43 10             	mov    0x10(%rbx),%eax
+  8033bc:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  8033c0:	0f 84 fb 00 00 00    	je     8034c1 <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  8033c6:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  8033cb:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8033cf:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  8033d2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8033d6:	48 89 c7             	mov    %rax,%rdi
+  8033d9:	48 b8 da 4e 80 00 00 	movabs $0x804eda,%rax
+  8033e0:	00 00 00 
+  8033e3:	ff d0                	call   *%rax
+  8033e5:	84 c0                	test   %al,%al
+  8033e7:	75 27                	jne    803410 <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8033e9:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8033ee:	ba 00 40 00 00       	mov    $0x4000,%edx
+  8033f3:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8033f7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033fc:	48 b8 b2 17 80 00 00 	movabs $0x8017b2,%rax
+  803403:	00 00 00 
+  803406:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  803408:	85 c0                	test   %eax,%eax
+  80340a:	0f 88 dc 00 00 00    	js     8034ec <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  803410:	44 89 f8             	mov    %r15d,%eax
+  803413:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  803418:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  80341a:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  803421:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  803422:	8b 43 10             	mov    0x10(%rbx),%eax
+  803425:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  803429:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  80342c:	ba 00 40 00 00       	mov    $0x4000,%edx
+  803431:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803435:	48 89 df             	mov    %rbx,%rdi
+  803438:	48 b8 51 30 80 00 00 	movabs $0x803051,%rax
+  80343f:	00 00 00 
+  803442:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  803444:	48 85 c0             	test   %rax,%rax
+  803447:	0f 88 f4 fe ff ff    	js     803341 <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  80344d:	8b 53 0c             	mov    0xc(%rbx),%edx
+  803450:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  803453:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  803456:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  80345a:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  80345e:	48 63 d1             	movslq %ecx,%rdx
+  803461:	48 01 d0             	add    %rdx,%rax
+  803464:	4d 63 ff             	movslq %r15d,%r15
+  803467:	4c 29 f8             	sub    %r15,%rax
+  80346a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80346f:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  803473:	48 85 c0             	test   %rax,%rax
+  803476:	0f 8e c5 fe ff ff    	jle    803341 <devfile_read+0x78>
+    n = MIN(n, res);
+  80347c:	4c 39 e8             	cmp    %r13,%rax
+  80347f:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  803483:	8b 73 04             	mov    0x4(%rbx),%esi
+  803486:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  80348a:	48 63 f6             	movslq %esi,%rsi
+  80348d:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  803492:	48 01 c6             	add    %rax,%rsi
+  803495:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803499:	48 01 c6             	add    %rax,%rsi
+  80349c:	4c 89 ea             	mov    %r13,%rdx
+  80349f:	4c 89 e7             	mov    %r12,%rdi
+  8034a2:	48 b8 b4 14 80 00 00 	movabs $0x8014b4,%rax
+  8034a9:	00 00 00 
+  8034ac:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  8034ae:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  8034b2:	4c 89 e8             	mov    %r13,%rax
+  8034b5:	e9 87 fe ff ff       	jmp    803341 <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  8034ba:	48 98                	cltq
+  8034bc:	e9 80 fe ff ff       	jmp    803341 <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  8034c1:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  8034c5:	41 39 d7             	cmp    %edx,%r15d
+  8034c8:	0f 8c f8 fe ff ff    	jl     8033c6 <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  8034ce:	49 8b 46 10          	mov    0x10(%r14),%rax
+  8034d2:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  8034d5:	41 39 cf             	cmp    %ecx,%r15d
+  8034d8:	0f 8d e8 fe ff ff    	jge    8033c6 <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  8034de:	4d 63 ff             	movslq %r15d,%r15
+  8034e1:	4c 29 f8             	sub    %r15,%rax
+  8034e4:	48 63 d2             	movslq %edx,%rdx
+  8034e7:	48 01 d0             	add    %rdx,%rax
+  8034ea:	eb 87                	jmp    803473 <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8034ec:	48 98                	cltq
+  8034ee:	e9 4e fe ff ff       	jmp    803341 <devfile_read+0x78>
+        return E_INVAL;
+  8034f3:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  8034f8:	c3                   	ret
+
+00000000008034f9 <fs_channel>:
+fs_channel(bool enable) {
+  8034f9:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  8034fb:	a2 04 26 82 00 00 00 	movabs %al,0x822604
+  803502:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  803504:	ba 00 00 00 00       	mov    $0x0,%edx
+  803509:	40 84 ff             	test   %dil,%dil
+  80350c:	74 47                	je     803555 <fs_channel+0x5c>
+  80350e:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  803515:	00 00 00 
+  803518:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  80351e:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  803525:	00 00 00 
+  803528:	3b 08                	cmp    (%rax),%ecx
+  80352a:	74 29                	je     803555 <fs_channel+0x5c>
+fs_channel(bool enable) {
+  80352c:	55                   	push   %rbp
+  80352d:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  803530:	48 b8 79 24 80 00 00 	movabs $0x802479,%rax
+  803537:	00 00 00 
+  80353a:	ff d0                	call   *%rax
+  80353c:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  80353e:	85 c0                	test   %eax,%eax
+  803540:	78 04                	js     803546 <fs_channel+0x4d>
+}
+  803542:	89 d0                	mov    %edx,%eax
+  803544:	5d                   	pop    %rbp
+  803545:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  803546:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  80354d:	00 00 00 
+  803550:	c6 00 00             	movb   $0x0,(%rax)
+  803553:	eb ed                	jmp    803542 <fs_channel+0x49>
+}
+  803555:	89 d0                	mov    %edx,%eax
+  803557:	c3                   	ret
+
+0000000000803558 <open>:
+open(const char *path, int mode) {
+  803558:	55                   	push   %rbp
+  803559:	48 89 e5             	mov    %rsp,%rbp
+  80355c:	41 55                	push   %r13
+  80355e:	41 54                	push   %r12
+  803560:	53                   	push   %rbx
+  803561:	48 83 ec 18          	sub    $0x18,%rsp
+  803565:	49 89 fc             	mov    %rdi,%r12
+  803568:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80356b:	48 b8 15 12 80 00 00 	movabs $0x801215,%rax
+  803572:	00 00 00 
+  803575:	ff d0                	call   *%rax
+  803577:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80357d:	0f 87 8f 00 00 00    	ja     803612 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803583:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803587:	48 b8 33 1d 80 00 00 	movabs $0x801d33,%rax
+  80358e:	00 00 00 
+  803591:	ff d0                	call   *%rax
+  803593:	89 c3                	mov    %eax,%ebx
+  803595:	85 c0                	test   %eax,%eax
+  803597:	78 55                	js     8035ee <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  803599:	4c 89 e6             	mov    %r12,%rsi
+  80359c:	48 bb 00 00 83 00 00 	movabs $0x830000,%rbx
+  8035a3:	00 00 00 
+  8035a6:	48 89 df             	mov    %rbx,%rdi
+  8035a9:	48 b8 53 12 80 00 00 	movabs $0x801253,%rax
+  8035b0:	00 00 00 
+  8035b3:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8035b5:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  8035bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035c1:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8035c5:	bf 01 00 00 00       	mov    $0x1,%edi
+  8035ca:	48 b8 ea 2a 80 00 00 	movabs $0x802aea,%rax
+  8035d1:	00 00 00 
+  8035d4:	ff d0                	call   *%rax
+  8035d6:	89 c3                	mov    %eax,%ebx
+  8035d8:	85 c0                	test   %eax,%eax
+  8035da:	78 1f                	js     8035fb <open+0xa3>
+    return fd2num(fd);
+  8035dc:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8035e0:	48 b8 05 1d 80 00 00 	movabs $0x801d05,%rax
+  8035e7:	00 00 00 
+  8035ea:	ff d0                	call   *%rax
+  8035ec:	89 c3                	mov    %eax,%ebx
+}
+  8035ee:	89 d8                	mov    %ebx,%eax
+  8035f0:	48 83 c4 18          	add    $0x18,%rsp
+  8035f4:	5b                   	pop    %rbx
+  8035f5:	41 5c                	pop    %r12
+  8035f7:	41 5d                	pop    %r13
+  8035f9:	5d                   	pop    %rbp
+  8035fa:	c3                   	ret
+        fd_close(fd, 0);
+  8035fb:	be 00 00 00 00       	mov    $0x0,%esi
+  803600:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803604:	48 b8 4e 1e 80 00 00 	movabs $0x801e4e,%rax
+  80360b:	00 00 00 
+  80360e:	ff d0                	call   *%rax
+        return res;
+  803610:	eb dc                	jmp    8035ee <open+0x96>
+        return -E_BAD_PATH;
+  803612:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803617:	eb d5                	jmp    8035ee <open+0x96>
+
+0000000000803619 <file_flush_buffers>:
+file_flush_buffers(void) {
+  803619:	55                   	push   %rbp
+  80361a:	48 89 e5             	mov    %rsp,%rbp
+  80361d:	41 56                	push   %r14
+  80361f:	41 55                	push   %r13
+  803621:	41 54                	push   %r12
+  803623:	53                   	push   %rbx
+  803624:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  803628:	49 bc 08 23 82 00 00 	movabs $0x822308,%r12
+  80362f:	00 00 00 
+  803632:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  803637:	49 bd 93 1d 80 00 00 	movabs $0x801d93,%r13
+  80363e:	00 00 00 
+  803641:	49 be 53 2d 80 00 00 	movabs $0x802d53,%r14
+  803648:	00 00 00 
+  80364b:	eb 0c                	jmp    803659 <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  80364d:	83 c3 01             	add    $0x1,%ebx
+  803650:	49 83 c4 18          	add    $0x18,%r12
+  803654:	83 fb 20             	cmp    $0x20,%ebx
+  803657:	74 1d                	je     803676 <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  803659:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  80365e:	74 ed                	je     80364d <file_flush_buffers+0x34>
+  803660:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803664:	89 df                	mov    %ebx,%edi
+  803666:	41 ff d5             	call   *%r13
+  803669:	85 c0                	test   %eax,%eax
+  80366b:	78 e0                	js     80364d <file_flush_buffers+0x34>
+  80366d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803671:	41 ff d6             	call   *%r14
+  803674:	eb d7                	jmp    80364d <file_flush_buffers+0x34>
+}
+  803676:	48 83 c4 10          	add    $0x10,%rsp
+  80367a:	5b                   	pop    %rbx
+  80367b:	41 5c                	pop    %r12
+  80367d:	41 5d                	pop    %r13
+  80367f:	41 5e                	pop    %r14
+  803681:	5d                   	pop    %rbp
+  803682:	c3                   	ret
+
+0000000000803683 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803683:	55                   	push   %rbp
+  803684:	48 89 e5             	mov    %rsp,%rbp
+  803687:	41 54                	push   %r12
+  803689:	53                   	push   %rbx
+  80368a:	49 89 fc             	mov    %rdi,%r12
+  80368d:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  80368f:	48 b8 19 36 80 00 00 	movabs $0x803619,%rax
+  803696:	00 00 00 
+  803699:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80369b:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  8036a2:	00 00 00 
+  8036a5:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  8036aa:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  8036ac:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  8036af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8036b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8036b9:	bf 02 00 00 00       	mov    $0x2,%edi
+  8036be:	48 b8 ea 2a 80 00 00 	movabs $0x802aea,%rax
+  8036c5:	00 00 00 
+  8036c8:	ff d0                	call   *%rax
+}
+  8036ca:	5b                   	pop    %rbx
+  8036cb:	41 5c                	pop    %r12
+  8036cd:	5d                   	pop    %rbp
+  8036ce:	c3                   	ret
+
+00000000008036cf <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8036cf:	55                   	push   %rbp
+  8036d0:	48 89 e5             	mov    %rsp,%rbp
+  8036d3:	41 54                	push   %r12
+  8036d5:	53                   	push   %rbx
+  8036d6:	49 89 fc             	mov    %rdi,%r12
+  8036d9:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  8036dc:	48 b8 19 36 80 00 00 	movabs $0x803619,%rax
+  8036e3:	00 00 00 
+  8036e6:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8036e8:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  8036ed:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  8036f4:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  8036f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8036fb:	be 00 00 00 00       	mov    $0x0,%esi
+  803700:	bf 05 00 00 00       	mov    $0x5,%edi
+  803705:	48 b8 ea 2a 80 00 00 	movabs $0x802aea,%rax
+  80370c:	00 00 00 
+  80370f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803711:	85 c0                	test   %eax,%eax
+  803713:	78 3d                	js     803752 <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803715:	49 bc 00 00 83 00 00 	movabs $0x830000,%r12
+  80371c:	00 00 00 
+  80371f:	4c 89 e6             	mov    %r12,%rsi
+  803722:	48 89 df             	mov    %rbx,%rdi
+  803725:	48 b8 53 12 80 00 00 	movabs $0x801253,%rax
+  80372c:	00 00 00 
+  80372f:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  803731:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  803738:	00 
+  803739:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80373f:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  803746:	00 
+  803747:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  80374d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803752:	5b                   	pop    %rbx
+  803753:	41 5c                	pop    %r12
+  803755:	5d                   	pop    %rbp
+  803756:	c3                   	ret
+
+0000000000803757 <remove>:
+remove(const char *path) {
+  803757:	55                   	push   %rbp
+  803758:	48 89 e5             	mov    %rsp,%rbp
+  80375b:	53                   	push   %rbx
+  80375c:	48 83 ec 08          	sub    $0x8,%rsp
+  803760:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  803763:	48 b8 15 12 80 00 00 	movabs $0x801215,%rax
+  80376a:	00 00 00 
+  80376d:	ff d0                	call   *%rax
+  80376f:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803775:	77 3a                	ja     8037b1 <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  803777:	48 89 de             	mov    %rbx,%rsi
+  80377a:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  803781:	00 00 00 
+  803784:	48 b8 53 12 80 00 00 	movabs $0x801253,%rax
+  80378b:	00 00 00 
+  80378e:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  803790:	ba 00 00 00 00       	mov    $0x0,%edx
+  803795:	be 00 00 00 00       	mov    $0x0,%esi
+  80379a:	bf 07 00 00 00       	mov    $0x7,%edi
+  80379f:	48 b8 ea 2a 80 00 00 	movabs $0x802aea,%rax
+  8037a6:	00 00 00 
+  8037a9:	ff d0                	call   *%rax
+}
+  8037ab:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8037af:	c9                   	leave
+  8037b0:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  8037b1:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8037b6:	eb f3                	jmp    8037ab <remove+0x54>
+
+00000000008037b8 <sync>:
+sync(void) {
+  8037b8:	55                   	push   %rbp
+  8037b9:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  8037bc:	48 b8 19 36 80 00 00 	movabs $0x803619,%rax
+  8037c3:	00 00 00 
+  8037c6:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  8037c8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8037cd:	be 00 00 00 00       	mov    $0x0,%esi
+  8037d2:	bf 08 00 00 00       	mov    $0x8,%edi
+  8037d7:	48 b8 ea 2a 80 00 00 	movabs $0x802aea,%rax
+  8037de:	00 00 00 
+  8037e1:	ff d0                	call   *%rax
+}
+  8037e3:	5d                   	pop    %rbp
+  8037e4:	c3                   	ret
+
+00000000008037e5 <fsync>:
+fsync(int fdnum) {
+  8037e5:	55                   	push   %rbp
+  8037e6:	48 89 e5             	mov    %rsp,%rbp
+  8037e9:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8037ed:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8037f1:	48 b8 93 1d 80 00 00 	movabs $0x801d93,%rax
+  8037f8:	00 00 00 
+  8037fb:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8037fd:	85 c0                	test   %eax,%eax
+  8037ff:	78 4b                	js     80384c <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803801:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803805:	48 b8 60 70 80 00 00 	movabs $0x807060,%rax
+  80380c:	00 00 00 
+  80380f:	8b 00                	mov    (%rax),%eax
+  803811:	39 02                	cmp    %eax,(%rdx)
+  803813:	75 39                	jne    80384e <fsync+0x69>
+    file_flush_buffers();
+  803815:	48 b8 19 36 80 00 00 	movabs $0x803619,%rax
+  80381c:	00 00 00 
+  80381f:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  803821:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803825:	8b 40 0c             	mov    0xc(%rax),%eax
+  803828:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  80382f:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  803831:	ba 00 00 00 00       	mov    $0x0,%edx
+  803836:	be 00 00 00 00       	mov    $0x0,%esi
+  80383b:	bf 0d 00 00 00       	mov    $0xd,%edi
+  803840:	48 b8 ea 2a 80 00 00 	movabs $0x802aea,%rax
+  803847:	00 00 00 
+  80384a:	ff d0                	call   *%rax
+}
+  80384c:	c9                   	leave
+  80384d:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80384e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803853:	eb f7                	jmp    80384c <fsync+0x67>
+
+0000000000803855 <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  803855:	55                   	push   %rbp
+  803856:	48 89 e5             	mov    %rsp,%rbp
+  803859:	53                   	push   %rbx
+  80385a:	48 83 ec 08          	sub    $0x8,%rsp
+  80385e:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  803861:	ba 00 00 00 00       	mov    $0x0,%edx
+  803866:	be 00 00 00 00       	mov    $0x0,%esi
+  80386b:	bf 0b 00 00 00       	mov    $0xb,%edi
+  803870:	48 b8 ea 2a 80 00 00 	movabs $0x802aea,%rax
+  803877:	00 00 00 
+  80387a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80387c:	85 c0                	test   %eax,%eax
+  80387e:	78 2d                	js     8038ad <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  803880:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803887:	00 00 00 
+  80388a:	48 8b 10             	mov    (%rax),%rdx
+  80388d:	48 89 13             	mov    %rdx,(%rbx)
+  803890:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  803894:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  803898:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80389c:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  8038a0:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8038a4:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  8038a8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8038ad:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8038b1:	c9                   	leave
+  8038b2:	c3                   	ret
+
+00000000008038b3 <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  8038b3:	55                   	push   %rbp
+  8038b4:	48 89 e5             	mov    %rsp,%rbp
+  8038b7:	53                   	push   %rbx
+  8038b8:	48 83 ec 08          	sub    $0x8,%rsp
+  8038bc:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  8038bf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8038c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8038c9:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8038ce:	48 b8 ea 2a 80 00 00 	movabs $0x802aea,%rax
+  8038d5:	00 00 00 
+  8038d8:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8038da:	85 c0                	test   %eax,%eax
+  8038dc:	78 3d                	js     80391b <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  8038de:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  8038e5:	00 00 00 
+  8038e8:	48 8b 10             	mov    (%rax),%rdx
+  8038eb:	48 89 13             	mov    %rdx,(%rbx)
+  8038ee:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8038f2:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  8038f6:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8038fa:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  8038fe:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  803902:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  803906:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  80390a:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  80390e:	48 8b 40 28          	mov    0x28(%rax),%rax
+  803912:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  803916:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80391b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80391f:	c9                   	leave
+  803920:	c3                   	ret
+
+0000000000803921 <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  803921:	55                   	push   %rbp
+  803922:	48 89 e5             	mov    %rsp,%rbp
+  803925:	41 57                	push   %r15
+  803927:	41 56                	push   %r14
+  803929:	41 55                	push   %r13
+  80392b:	41 54                	push   %r12
+  80392d:	53                   	push   %rbx
+  80392e:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  803932:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  803939:	00 
+  80393a:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  803941:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  803947:	0f 85 43 01 00 00    	jne    803a90 <munmap+0x16f>
+  80394d:	49 89 ff             	mov    %rdi,%r15
+  803950:	4c 39 f7             	cmp    %r14,%rdi
+  803953:	0f 87 37 01 00 00    	ja     803a90 <munmap+0x16f>
+  803959:	48 bb 00 20 82 00 00 	movabs $0x822000,%rbx
+  803960:	00 00 00 
+  803963:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  803969:	eb 2c                	jmp    803997 <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  80396b:	4c 39 f8             	cmp    %r15,%rax
+  80396e:	0f 83 85 00 00 00    	jae    8039f9 <munmap+0xd8>
+            m->mm_end = start;
+  803974:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  803979:	48 83 c3 18          	add    $0x18,%rbx
+  80397d:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  803984:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  80398b:	00 00 00 
+  80398e:	48 39 c3             	cmp    %rax,%rbx
+  803991:	0f 84 d0 00 00 00    	je     803a67 <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  803997:	49 89 dc             	mov    %rbx,%r12
+  80399a:	48 8b 03             	mov    (%rbx),%rax
+  80399d:	4c 39 f0             	cmp    %r14,%rax
+  8039a0:	73 d7                	jae    803979 <munmap+0x58>
+  8039a2:	48 85 c0             	test   %rax,%rax
+  8039a5:	74 d2                	je     803979 <munmap+0x58>
+  8039a7:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8039ab:	49 39 d7             	cmp    %rdx,%r15
+  8039ae:	73 c9                	jae    803979 <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  8039b0:	49 39 d6             	cmp    %rdx,%r14
+  8039b3:	73 b6                	jae    80396b <munmap+0x4a>
+  8039b5:	49 39 c7             	cmp    %rax,%r15
+  8039b8:	76 b1                	jbe    80396b <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  8039ba:	4c 89 ef             	mov    %r13,%rdi
+  8039bd:	48 b8 58 2a 80 00 00 	movabs $0x802a58,%rax
+  8039c4:	00 00 00 
+  8039c7:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  8039c9:	48 85 c0             	test   %rax,%rax
+  8039cc:	0f 84 c5 00 00 00    	je     803a97 <munmap+0x176>
+            *tail = *m;
+  8039d2:	48 8b 13             	mov    (%rbx),%rdx
+  8039d5:	48 89 10             	mov    %rdx,(%rax)
+  8039d8:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8039dc:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  8039e0:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  8039e4:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  8039e8:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  8039eb:	44 89 f2             	mov    %r14d,%edx
+  8039ee:	2b 13                	sub    (%rbx),%edx
+  8039f0:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  8039f3:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  8039f7:	eb 80                	jmp    803979 <munmap+0x58>
+        } else if (m->mm_end > end) {
+  8039f9:	49 39 d6             	cmp    %rdx,%r14
+  8039fc:	73 18                	jae    803a16 <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  8039fe:	44 89 f2             	mov    %r14d,%edx
+  803a01:	41 03 54 24 10       	add    0x10(%r12),%edx
+  803a06:	29 c2                	sub    %eax,%edx
+  803a08:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  803a0d:	4d 89 34 24          	mov    %r14,(%r12)
+  803a11:	e9 63 ff ff ff       	jmp    803979 <munmap+0x58>
+    m->mm_start = 0;
+  803a16:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  803a1d:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  803a1e:	4c 89 e6             	mov    %r12,%rsi
+  803a21:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  803a28:	00 00 00 
+  803a2b:	48 29 c6             	sub    %rax,%rsi
+  803a2e:	48 c1 fe 03          	sar    $0x3,%rsi
+  803a32:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  803a39:	aa aa aa 
+  803a3c:	48 0f af f0          	imul   %rax,%rsi
+  803a40:	48 c1 e6 0c          	shl    $0xc,%rsi
+  803a44:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  803a49:	48 01 c6             	add    %rax,%rsi
+  803a4c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a51:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a56:	48 b8 58 18 80 00 00 	movabs $0x801858,%rax
+  803a5d:	00 00 00 
+  803a60:	ff d0                	call   *%rax
+}
+  803a62:	e9 12 ff ff ff       	jmp    803979 <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  803a67:	4c 89 f2             	mov    %r14,%rdx
+  803a6a:	4c 29 fa             	sub    %r15,%rdx
+  803a6d:	4c 89 fe             	mov    %r15,%rsi
+  803a70:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a75:	48 b8 58 18 80 00 00 	movabs $0x801858,%rax
+  803a7c:	00 00 00 
+  803a7f:	ff d0                	call   *%rax
+}
+  803a81:	48 83 c4 08          	add    $0x8,%rsp
+  803a85:	5b                   	pop    %rbx
+  803a86:	41 5c                	pop    %r12
+  803a88:	41 5d                	pop    %r13
+  803a8a:	41 5e                	pop    %r14
+  803a8c:	41 5f                	pop    %r15
+  803a8e:	5d                   	pop    %rbp
+  803a8f:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  803a90:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803a95:	eb ea                	jmp    803a81 <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  803a97:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  803a9c:	eb e3                	jmp    803a81 <munmap+0x160>
+
+0000000000803a9e <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  803a9e:	55                   	push   %rbp
+  803a9f:	48 89 e5             	mov    %rsp,%rbp
+  803aa2:	41 57                	push   %r15
+  803aa4:	41 56                	push   %r14
+  803aa6:	41 55                	push   %r13
+  803aa8:	41 54                	push   %r12
+  803aaa:	53                   	push   %rbx
+  803aab:	48 83 ec 28          	sub    $0x28,%rsp
+  803aaf:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  803ab3:	49 89 f5             	mov    %rsi,%r13
+  803ab6:	41 89 d6             	mov    %edx,%r14d
+  803ab9:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  803abc:	41 89 cc             	mov    %ecx,%r12d
+  803abf:	44 89 c7             	mov    %r8d,%edi
+  803ac2:	44 89 cb             	mov    %r9d,%ebx
+  803ac5:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803ac9:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803acd:	48 b8 93 1d 80 00 00 	movabs $0x801d93,%rax
+  803ad4:	00 00 00 
+  803ad7:	ff d0                	call   *%rax
+  803ad9:	41 89 c7             	mov    %eax,%r15d
+  803adc:	85 c0                	test   %eax,%eax
+  803ade:	0f 88 ae 01 00 00    	js     803c92 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803ae4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803ae8:	48 ba 60 70 80 00 00 	movabs $0x807060,%rdx
+  803aef:	00 00 00 
+  803af2:	8b 32                	mov    (%rdx),%esi
+  803af4:	39 30                	cmp    %esi,(%rax)
+  803af6:	0f 85 7a 02 00 00    	jne    803d76 <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  803afc:	8b 40 08             	mov    0x8(%rax),%eax
+  803aff:	83 e0 03             	and    $0x3,%eax
+  803b02:	83 f8 01             	cmp    $0x1,%eax
+  803b05:	0f 84 76 02 00 00    	je     803d81 <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  803b0b:	4d 85 ed             	test   %r13,%r13
+  803b0e:	0f 84 78 02 00 00    	je     803d8c <mmap+0x2ee>
+  803b14:	85 db                	test   %ebx,%ebx
+  803b16:	0f 88 70 02 00 00    	js     803d8c <mmap+0x2ee>
+  803b1c:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  803b22:	41 89 df             	mov    %ebx,%r15d
+  803b25:	0f 85 6c 02 00 00    	jne    803d97 <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  803b2b:	44 89 f0             	mov    %r14d,%eax
+  803b2e:	83 e0 fd             	and    $0xfffffffd,%eax
+  803b31:	83 f8 04             	cmp    $0x4,%eax
+  803b34:	0f 85 68 02 00 00    	jne    803da2 <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  803b3a:	44 89 e1             	mov    %r12d,%ecx
+  803b3d:	83 e1 01             	and    $0x1,%ecx
+  803b40:	0f 95 c2             	setne  %dl
+  803b43:	44 89 e0             	mov    %r12d,%eax
+  803b46:	d1 e8                	shr    %eax
+  803b48:	83 f0 01             	xor    $0x1,%eax
+  803b4b:	83 e0 01             	and    $0x1,%eax
+  803b4e:	38 c2                	cmp    %al,%dl
+  803b50:	0f 85 57 02 00 00    	jne    803dad <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  803b56:	85 c9                	test   %ecx,%ecx
+  803b58:	74 0a                	je     803b64 <mmap+0xc6>
+  803b5a:	41 f6 c6 02          	test   $0x2,%r14b
+  803b5e:	0f 85 54 02 00 00    	jne    803db8 <mmap+0x31a>
+    file_flush_buffers();
+  803b64:	48 b8 19 36 80 00 00 	movabs $0x803619,%rax
+  803b6b:	00 00 00 
+  803b6e:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  803b70:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  803b77:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  803b7e:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803b82:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  803b85:	41 f6 c4 04          	test   $0x4,%r12b
+  803b89:	0f 84 15 01 00 00    	je     803ca4 <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  803b8f:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  803b92:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  803b98:	0f 85 25 02 00 00    	jne    803dc3 <mmap+0x325>
+  803b9e:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  803ba2:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  803ba9:	00 00 00 
+  803bac:	48 39 c2             	cmp    %rax,%rdx
+  803baf:	0f 82 19 02 00 00    	jb     803dce <mmap+0x330>
+  803bb5:	48 39 c7             	cmp    %rax,%rdi
+  803bb8:	0f 87 10 02 00 00    	ja     803dce <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  803bbe:	4c 89 ee             	mov    %r13,%rsi
+  803bc1:	48 b8 21 39 80 00 00 	movabs $0x803921,%rax
+  803bc8:	00 00 00 
+  803bcb:	ff d0                	call   *%rax
+  803bcd:	85 c0                	test   %eax,%eax
+  803bcf:	0f 88 04 02 00 00    	js     803dd9 <mmap+0x33b>
+    if (!handler) {
+  803bd5:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  803bdc:	00 00 00 
+  803bdf:	80 38 00             	cmpb   $0x0,(%rax)
+  803be2:	75 2b                	jne    803c0f <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  803be4:	48 bf b9 29 80 00 00 	movabs $0x8029b9,%rdi
+  803beb:	00 00 00 
+  803bee:	48 b8 97 54 80 00 00 	movabs $0x805497,%rax
+  803bf5:	00 00 00 
+  803bf8:	ff d0                	call   *%rax
+  803bfa:	85 c0                	test   %eax,%eax
+  803bfc:	0f 88 ea 01 00 00    	js     803dec <mmap+0x34e>
+        handler = 1;
+  803c02:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  803c09:	00 00 00 
+  803c0c:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  803c0f:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803c13:	48 b8 58 2a 80 00 00 	movabs $0x802a58,%rax
+  803c1a:	00 00 00 
+  803c1d:	ff d0                	call   *%rax
+  803c1f:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  803c22:	48 85 c0             	test   %rax,%rax
+  803c25:	0f 84 c9 01 00 00    	je     803df4 <mmap+0x356>
+    m->mm_start = va;
+  803c2b:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  803c2e:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  803c32:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  803c36:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  803c39:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  803c3d:	44 89 e0             	mov    %r12d,%eax
+  803c40:	c1 e0 06             	shl    $0x6,%eax
+  803c43:	25 80 00 00 00       	and    $0x80,%eax
+  803c48:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  803c4b:	09 f0                	or     %esi,%eax
+  803c4d:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  803c51:	41 f6 c4 08          	test   $0x8,%r12b
+  803c55:	74 31                	je     803c88 <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  803c57:	48 39 d3             	cmp    %rdx,%rbx
+  803c5a:	73 2c                	jae    803c88 <mmap+0x1ea>
+  803c5c:	ba 00 00 04 00       	mov    $0x40000,%edx
+  803c61:	48 89 de             	mov    %rbx,%rsi
+  803c64:	4c 89 f7             	mov    %r14,%rdi
+  803c67:	48 b8 a8 28 80 00 00 	movabs $0x8028a8,%rax
+  803c6e:	00 00 00 
+  803c71:	ff d0                	call   *%rax
+  803c73:	49 89 c4             	mov    %rax,%r12
+  803c76:	48 85 c0             	test   %rax,%rax
+  803c79:	0f 8e d7 00 00 00    	jle    803d56 <mmap+0x2b8>
+            va += n;
+  803c7f:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  803c82:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  803c86:	72 d4                	jb     803c5c <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  803c88:	49 8b 06             	mov    (%r14),%rax
+  803c8b:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  803c8f:	48 89 06             	mov    %rax,(%rsi)
+}
+  803c92:	44 89 f8             	mov    %r15d,%eax
+  803c95:	48 83 c4 28          	add    $0x28,%rsp
+  803c99:	5b                   	pop    %rbx
+  803c9a:	41 5c                	pop    %r12
+  803c9c:	41 5d                	pop    %r13
+  803c9e:	41 5e                	pop    %r14
+  803ca0:	41 5f                	pop    %r15
+  803ca2:	5d                   	pop    %rbp
+  803ca3:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803ca4:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  803cab:	00 00 00 
+  803cae:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  803cb1:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  803cb8:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803cbb:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  803cc0:	48 be 00 20 82 00 00 	movabs $0x822000,%rsi
+  803cc7:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803cca:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  803cd1:	00 00 00 
+  803cd4:	48 39 d7             	cmp    %rdx,%rdi
+  803cd7:	73 1c                	jae    803cf5 <mmap+0x257>
+        return -E_NO_MEM;
+  803cd9:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803cdf:	eb b1                	jmp    803c92 <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803ce1:	48 83 c0 01          	add    $0x1,%rax
+  803ce5:	48 83 f8 1f          	cmp    $0x1f,%rax
+  803ce9:	77 3f                	ja     803d2a <mmap+0x28c>
+  803ceb:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  803cf0:	48 39 d7             	cmp    %rdx,%rdi
+  803cf3:	72 2a                	jb     803d1f <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  803cf5:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  803cf9:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  803cfd:	48 39 d1             	cmp    %rdx,%rcx
+  803d00:	73 df                	jae    803ce1 <mmap+0x243>
+  803d02:	48 85 c9             	test   %rcx,%rcx
+  803d05:	74 da                	je     803ce1 <mmap+0x243>
+  803d07:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  803d0b:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  803d10:	48 39 d3             	cmp    %rdx,%rbx
+  803d13:	73 cc                	jae    803ce1 <mmap+0x243>
+            va = mmaps[i].mm_end;
+  803d15:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803d18:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d1d:	eb cc                	jmp    803ceb <mmap+0x24d>
+        return -E_NO_MEM;
+  803d1f:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803d25:	e9 68 ff ff ff       	jmp    803c92 <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  803d2a:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  803d2f:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  803d36:	00 00 00 
+  803d39:	48 39 c2             	cmp    %rax,%rdx
+  803d3c:	0f 82 9f 00 00 00    	jb     803de1 <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  803d42:	48 85 db             	test   %rbx,%rbx
+  803d45:	0f 85 8a fe ff ff    	jne    803bd5 <mmap+0x137>
+        return -E_NO_MEM;
+  803d4b:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803d51:	e9 3c ff ff ff       	jmp    803c92 <mmap+0x1f4>
+        if (n < 0) {
+  803d56:	0f 89 2c ff ff ff    	jns    803c88 <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  803d5c:	49 8b 3e             	mov    (%r14),%rdi
+  803d5f:	4c 89 ee             	mov    %r13,%rsi
+  803d62:	48 b8 21 39 80 00 00 	movabs $0x803921,%rax
+  803d69:	00 00 00 
+  803d6c:	ff d0                	call   *%rax
+            return n;
+  803d6e:	45 89 e7             	mov    %r12d,%r15d
+  803d71:	e9 1c ff ff ff       	jmp    803c92 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803d76:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803d7c:	e9 11 ff ff ff       	jmp    803c92 <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  803d81:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803d87:	e9 06 ff ff ff       	jmp    803c92 <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  803d8c:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803d92:	e9 fb fe ff ff       	jmp    803c92 <mmap+0x1f4>
+  803d97:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803d9d:	e9 f0 fe ff ff       	jmp    803c92 <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  803da2:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803da8:	e9 e5 fe ff ff       	jmp    803c92 <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  803dad:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803db3:	e9 da fe ff ff       	jmp    803c92 <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  803db8:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  803dbe:	e9 cf fe ff ff       	jmp    803c92 <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  803dc3:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803dc9:	e9 c4 fe ff ff       	jmp    803c92 <mmap+0x1f4>
+  803dce:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803dd4:	e9 b9 fe ff ff       	jmp    803c92 <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  803dd9:	41 89 c7             	mov    %eax,%r15d
+  803ddc:	e9 b1 fe ff ff       	jmp    803c92 <mmap+0x1f4>
+        return -E_NO_MEM;
+  803de1:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803de7:	e9 a6 fe ff ff       	jmp    803c92 <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  803dec:	41 89 c7             	mov    %eax,%r15d
+  803def:	e9 9e fe ff ff       	jmp    803c92 <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  803df4:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803dfa:	e9 93 fe ff ff       	jmp    803c92 <mmap+0x1f4>
+
+0000000000803dff <copy_shared_region>:
+    scring_unmap_region(0, UTEMP, USER_STACK_SIZE);
+    return 0;
+}
+
+static int
+copy_shared_region(void *start, void *end, void *arg) {
+  803dff:	55                   	push   %rbp
+  803e00:	48 89 e5             	mov    %rsp,%rbp
+  803e03:	41 55                	push   %r13
+  803e05:	41 54                	push   %r12
+  803e07:	53                   	push   %rbx
+  803e08:	48 83 ec 08          	sub    $0x8,%rsp
+  803e0c:	48 89 fb             	mov    %rdi,%rbx
+  803e0f:	49 89 f4             	mov    %rsi,%r12
+    envid_t child = *(envid_t *)arg;
+  803e12:	44 8b 2a             	mov    (%rdx),%r13d
+    scring_map_region(0, start, child, start, end - start, get_prot(start));
+  803e15:	48 b8 7b 4e 80 00 00 	movabs $0x804e7b,%rax
+  803e1c:	00 00 00 
+  803e1f:	ff d0                	call   *%rax
+  803e21:	41 89 c1             	mov    %eax,%r9d
+  803e24:	4d 89 e0             	mov    %r12,%r8
+  803e27:	49 29 d8             	sub    %rbx,%r8
+  803e2a:	48 89 d9             	mov    %rbx,%rcx
+  803e2d:	44 89 ea             	mov    %r13d,%edx
+  803e30:	48 89 de             	mov    %rbx,%rsi
+  803e33:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e38:	48 b8 f0 51 80 00 00 	movabs $0x8051f0,%rax
+  803e3f:	00 00 00 
+  803e42:	ff d0                	call   *%rax
+    return 0;
+}
+  803e44:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e49:	48 83 c4 08          	add    $0x8,%rsp
+  803e4d:	5b                   	pop    %rbx
+  803e4e:	41 5c                	pop    %r12
+  803e50:	41 5d                	pop    %r13
+  803e52:	5d                   	pop    %rbp
+  803e53:	c3                   	ret
+
+0000000000803e54 <spawn>:
+spawn(const char *prog, const char **argv) {
+  803e54:	55                   	push   %rbp
+  803e55:	48 89 e5             	mov    %rsp,%rbp
+  803e58:	41 57                	push   %r15
+  803e5a:	41 56                	push   %r14
+  803e5c:	41 55                	push   %r13
+  803e5e:	41 54                	push   %r12
+  803e60:	53                   	push   %rbx
+  803e61:	48 81 ec 08 03 00 00 	sub    $0x308,%rsp
+  803e68:	48 89 fb             	mov    %rdi,%rbx
+  803e6b:	49 89 f4             	mov    %rsi,%r12
+    file_flush_buffers();
+  803e6e:	48 b8 19 36 80 00 00 	movabs $0x803619,%rax
+  803e75:	00 00 00 
+  803e78:	ff d0                	call   *%rax
+    int fd = open(prog, O_RDONLY);
+  803e7a:	be 00 00 00 00       	mov    $0x0,%esi
+  803e7f:	48 89 df             	mov    %rbx,%rdi
+  803e82:	48 b8 58 35 80 00 00 	movabs $0x803558,%rax
+  803e89:	00 00 00 
+  803e8c:	ff d0                	call   *%rax
+  803e8e:	89 85 e4 fc ff ff    	mov    %eax,-0x31c(%rbp)
+    if (fd < 0) return fd;
+  803e94:	85 c0                	test   %eax,%eax
+  803e96:	0f 88 06 04 00 00    	js     8042a2 <spawn+0x44e>
+  803e9c:	89 c7                	mov    %eax,%edi
+    res = readn(fd, elf_buf, sizeof(elf_buf));
+  803e9e:	ba 00 02 00 00       	mov    $0x200,%edx
+  803ea3:	48 8d b5 d0 fd ff ff 	lea    -0x230(%rbp),%rsi
+  803eaa:	48 b8 34 21 80 00 00 	movabs $0x802134,%rax
+  803eb1:	00 00 00 
+  803eb4:	ff d0                	call   *%rax
+  803eb6:	89 c6                	mov    %eax,%esi
+    if (res != sizeof(elf_buf)) {
+  803eb8:	3d 00 02 00 00       	cmp    $0x200,%eax
+  803ebd:	0f 85 93 02 00 00    	jne    804156 <spawn+0x302>
+        elf->e_elf[1] != 1 /* little endian */ ||
+  803ec3:	48 b8 ff ff ff ff ff 	movabs $0xffffffffffffff,%rax
+  803eca:	ff ff 00 
+  803ecd:	48 23 85 d0 fd ff ff 	and    -0x230(%rbp),%rax
+    if (elf->e_magic != ELF_MAGIC ||
+  803ed4:	48 ba 7f 45 4c 46 02 	movabs $0x10102464c457f,%rdx
+  803edb:	01 01 00 
+  803ede:	48 39 d0             	cmp    %rdx,%rax
+  803ee1:	0f 85 ab 02 00 00    	jne    804192 <spawn+0x33e>
+        elf->e_type != ET_EXEC /* executable */ ||
+  803ee7:	81 bd e0 fd ff ff 02 	cmpl   $0x3e0002,-0x220(%rbp)
+  803eee:	00 3e 00 
+  803ef1:	0f 85 9b 02 00 00    	jne    804192 <spawn+0x33e>
+  803ef7:	b8 08 00 00 00       	mov    $0x8,%eax
+  803efc:	0f 05                	syscall
+  803efe:	41 89 c6             	mov    %eax,%r14d
+  803f01:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+    if ((int)(res = sys_exofork()) < 0) goto error2;
+  803f07:	85 c0                	test   %eax,%eax
+  803f09:	0f 88 75 03 00 00    	js     804284 <spawn+0x430>
+    envid_t child = res;
+  803f0f:	89 85 cc fd ff ff    	mov    %eax,-0x234(%rbp)
+    struct Trapframe child_tf = envs[ENVX(child)].env_tf;
+  803f15:	89 c2                	mov    %eax,%edx
+  803f17:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  803f1d:	48 89 d0             	mov    %rdx,%rax
+  803f20:	48 c1 e0 04          	shl    $0x4,%rax
+  803f24:	48 29 d0             	sub    %rdx,%rax
+  803f27:	48 c1 e0 05          	shl    $0x5,%rax
+  803f2b:	48 be 00 00 c0 1f 80 	movabs $0x801fc00000,%rsi
+  803f32:	00 00 00 
+  803f35:	48 01 c6             	add    %rax,%rsi
+  803f38:	48 8b 06             	mov    (%rsi),%rax
+  803f3b:	48 89 85 0c fd ff ff 	mov    %rax,-0x2f4(%rbp)
+  803f42:	48 8b 86 b8 00 00 00 	mov    0xb8(%rsi),%rax
+  803f49:	48 89 85 c4 fd ff ff 	mov    %rax,-0x23c(%rbp)
+  803f50:	48 8d bd 10 fd ff ff 	lea    -0x2f0(%rbp),%rdi
+  803f57:	48 c7 c1 fc ff ff ff 	mov    $0xfffffffffffffffc,%rcx
+  803f5e:	48 29 ce             	sub    %rcx,%rsi
+  803f61:	81 c1 c0 00 00 00    	add    $0xc0,%ecx
+  803f67:	c1 e9 03             	shr    $0x3,%ecx
+  803f6a:	89 c9                	mov    %ecx,%ecx
+  803f6c:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    child_tf.tf_rip = elf->e_entry;
+  803f6f:	48 8b 85 e8 fd ff ff 	mov    -0x218(%rbp),%rax
+  803f76:	48 89 85 a4 fd ff ff 	mov    %rax,-0x25c(%rbp)
+    for (argc = 0; argv[argc] != 0; argc++)
+  803f7d:	49 8b 3c 24          	mov    (%r12),%rdi
+  803f81:	48 85 ff             	test   %rdi,%rdi
+  803f84:	0f 84 d6 05 00 00    	je     804560 <spawn+0x70c>
+  803f8a:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    string_size = 0;
+  803f90:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        string_size += strlen(argv[argc]) + 1;
+  803f96:	48 bb 15 12 80 00 00 	movabs $0x801215,%rbx
+  803f9d:	00 00 00 
+  803fa0:	ff d3                	call   *%rbx
+  803fa2:	4c 01 f8             	add    %r15,%rax
+  803fa5:	4c 8d 78 01          	lea    0x1(%rax),%r15
+    for (argc = 0; argv[argc] != 0; argc++)
+  803fa9:	4c 89 ea             	mov    %r13,%rdx
+  803fac:	49 83 c5 01          	add    $0x1,%r13
+  803fb0:	4b 8b 7c ec f8       	mov    -0x8(%r12,%r13,8),%rdi
+  803fb5:	48 85 ff             	test   %rdi,%rdi
+  803fb8:	75 e6                	jne    803fa0 <spawn+0x14c>
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  803fba:	49 89 d5             	mov    %rdx,%r13
+  803fbd:	48 89 95 f8 fc ff ff 	mov    %rdx,-0x308(%rbp)
+  803fc4:	48 f7 d0             	not    %rax
+  803fc7:	48 8d 98 00 00 41 00 	lea    0x410000(%rax),%rbx
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  803fce:	49 89 df             	mov    %rbx,%r15
+  803fd1:	49 83 e7 f8          	and    $0xfffffffffffffff8,%r15
+  803fd5:	4c 89 bd e8 fc ff ff 	mov    %r15,-0x318(%rbp)
+  803fdc:	89 d0                	mov    %edx,%eax
+  803fde:	83 c0 01             	add    $0x1,%eax
+  803fe1:	48 98                	cltq
+  803fe3:	48 c1 e0 03          	shl    $0x3,%rax
+  803fe7:	49 29 c7             	sub    %rax,%r15
+  803fea:	4c 89 bd f0 fc ff ff 	mov    %r15,-0x310(%rbp)
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  803ff1:	49 8d 47 f0          	lea    -0x10(%r15),%rax
+  803ff5:	48 3d ff ff 3f 00    	cmp    $0x3fffff,%rax
+  803ffb:	0f 86 4f 05 00 00    	jbe    804550 <spawn+0x6fc>
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  804001:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804006:	ba 00 00 01 00       	mov    $0x10000,%edx
+  80400b:	be 00 00 40 00       	mov    $0x400000,%esi
+  804010:	48 b8 b2 17 80 00 00 	movabs $0x8017b2,%rax
+  804017:	00 00 00 
+  80401a:	ff d0                	call   *%rax
+  80401c:	85 c0                	test   %eax,%eax
+  80401e:	0f 88 31 05 00 00    	js     804555 <spawn+0x701>
+    for (i = 0; i < argc; i++) {
+  804024:	4c 89 e8             	mov    %r13,%rax
+  804027:	45 85 ed             	test   %r13d,%r13d
+  80402a:	7e 65                	jle    804091 <spawn+0x23d>
+  80402c:	4d 89 fd             	mov    %r15,%r13
+  80402f:	48 98                	cltq
+  804031:	49 8d 04 c7          	lea    (%r15,%rax,8),%rax
+        argv_store[i] = UTEMP2USTACK(string_store);
+  804035:	49 bf 00 70 fe ff 7f 	movabs $0x7ffffe7000,%r15
+  80403c:	00 00 00 
+        string_store += strlen(argv[i]) + 1;
+  80403f:	44 89 b5 e0 fc ff ff 	mov    %r14d,-0x320(%rbp)
+  804046:	49 89 c6             	mov    %rax,%r14
+        argv_store[i] = UTEMP2USTACK(string_store);
+  804049:	4a 8d 84 3b 00 00 c0 	lea    -0x400000(%rbx,%r15,1),%rax
+  804050:	ff 
+  804051:	49 89 45 00          	mov    %rax,0x0(%r13)
+        strcpy(string_store, argv[i]);
+  804055:	49 8b 34 24          	mov    (%r12),%rsi
+  804059:	48 89 df             	mov    %rbx,%rdi
+  80405c:	48 b8 53 12 80 00 00 	movabs $0x801253,%rax
+  804063:	00 00 00 
+  804066:	ff d0                	call   *%rax
+        string_store += strlen(argv[i]) + 1;
+  804068:	49 8b 3c 24          	mov    (%r12),%rdi
+  80406c:	48 b8 15 12 80 00 00 	movabs $0x801215,%rax
+  804073:	00 00 00 
+  804076:	ff d0                	call   *%rax
+  804078:	48 8d 5c 03 01       	lea    0x1(%rbx,%rax,1),%rbx
+    for (i = 0; i < argc; i++) {
+  80407d:	49 83 c5 08          	add    $0x8,%r13
+  804081:	49 83 c4 08          	add    $0x8,%r12
+  804085:	4d 39 ee             	cmp    %r13,%r14
+  804088:	75 bf                	jne    804049 <spawn+0x1f5>
+  80408a:	44 8b b5 e0 fc ff ff 	mov    -0x320(%rbp),%r14d
+    argv_store[argc] = 0;
+  804091:	48 8b 85 e8 fc ff ff 	mov    -0x318(%rbp),%rax
+  804098:	48 c7 40 f8 00 00 00 	movq   $0x0,-0x8(%rax)
+  80409f:	00 
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  8040a0:	48 81 fb 00 00 41 00 	cmp    $0x410000,%rbx
+  8040a7:	0f 85 2c 01 00 00    	jne    8041d9 <spawn+0x385>
+    argv_store[-1] = UTEMP2USTACK(argv_store);
+  8040ad:	48 b9 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rcx
+  8040b4:	00 00 00 
+  8040b7:	48 8b 9d f0 fc ff ff 	mov    -0x310(%rbp),%rbx
+  8040be:	48 8d 84 0b 00 00 c0 	lea    -0x400000(%rbx,%rcx,1),%rax
+  8040c5:	ff 
+  8040c6:	48 89 43 f8          	mov    %rax,-0x8(%rbx)
+    argv_store[-2] = argc;
+  8040ca:	48 8b 85 f8 fc ff ff 	mov    -0x308(%rbp),%rax
+  8040d1:	48 89 43 f0          	mov    %rax,-0x10(%rbx)
+    tf->tf_rsp = UTEMP2USTACK(&argv_store[-2]);
+  8040d5:	48 b8 f0 6f fe ff 7f 	movabs $0x7ffffe6ff0,%rax
+  8040dc:	00 00 00 
+  8040df:	48 8d 84 03 00 00 c0 	lea    -0x400000(%rbx,%rax,1),%rax
+  8040e6:	ff 
+  8040e7:	48 89 85 bc fd ff ff 	mov    %rax,-0x244(%rbp)
+    scring_map_region(0, UTEMP, child, (void *)(USER_STACK_TOP - USER_STACK_SIZE),
+  8040ee:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  8040f4:	41 b8 00 00 01 00    	mov    $0x10000,%r8d
+  8040fa:	44 89 f2             	mov    %r14d,%edx
+  8040fd:	be 00 00 40 00       	mov    $0x400000,%esi
+  804102:	bf 00 00 00 00       	mov    $0x0,%edi
+  804107:	48 b8 f0 51 80 00 00 	movabs $0x8051f0,%rax
+  80410e:	00 00 00 
+  804111:	ff d0                	call   *%rax
+    scring_unmap_region(0, UTEMP, USER_STACK_SIZE);
+  804113:	ba 00 00 01 00       	mov    $0x10000,%edx
+  804118:	be 00 00 40 00       	mov    $0x400000,%esi
+  80411d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804122:	48 b8 29 52 80 00 00 	movabs $0x805229,%rax
+  804129:	00 00 00 
+  80412c:	ff d0                	call   *%rax
+    struct Proghdr *ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+  80412e:	48 8b 85 f0 fd ff ff 	mov    -0x210(%rbp),%rax
+  804135:	4c 8d ac 05 d0 fd ff 	lea    -0x230(%rbp,%rax,1),%r13
+  80413c:	ff 
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  80413d:	66 83 bd 08 fe ff ff 	cmpw   $0x0,-0x1f8(%rbp)
+  804144:	00 
+  804145:	0f 84 5d 03 00 00    	je     8044a8 <spawn+0x654>
+  80414b:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  804151:	e9 1b 02 00 00       	jmp    804371 <spawn+0x51d>
+        cprintf("Wrong ELF header size or read error: %i\n", res);
+  804156:	48 bf 80 60 80 00 00 	movabs $0x806080,%rdi
+  80415d:	00 00 00 
+  804160:	b8 00 00 00 00       	mov    $0x0,%eax
+  804165:	48 ba 2e 09 80 00 00 	movabs $0x80092e,%rdx
+  80416c:	00 00 00 
+  80416f:	ff d2                	call   *%rdx
+        close(fd);
+  804171:	8b bd e4 fc ff ff    	mov    -0x31c(%rbp),%edi
+  804177:	48 b8 f8 1e 80 00 00 	movabs $0x801ef8,%rax
+  80417e:	00 00 00 
+  804181:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  804183:	c7 85 e4 fc ff ff ee 	movl   $0xffffffee,-0x31c(%rbp)
+  80418a:	ff ff ff 
+  80418d:	e9 10 01 00 00       	jmp    8042a2 <spawn+0x44e>
+        cprintf("Elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  804192:	ba 7f 45 4c 46       	mov    $0x464c457f,%edx
+  804197:	8b b5 d0 fd ff ff    	mov    -0x230(%rbp),%esi
+  80419d:	48 bf 37 61 80 00 00 	movabs $0x806137,%rdi
+  8041a4:	00 00 00 
+  8041a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041ac:	48 b9 2e 09 80 00 00 	movabs $0x80092e,%rcx
+  8041b3:	00 00 00 
+  8041b6:	ff d1                	call   *%rcx
+        close(fd);
+  8041b8:	8b bd e4 fc ff ff    	mov    -0x31c(%rbp),%edi
+  8041be:	48 b8 f8 1e 80 00 00 	movabs $0x801ef8,%rax
+  8041c5:	00 00 00 
+  8041c8:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  8041ca:	c7 85 e4 fc ff ff ee 	movl   $0xffffffee,-0x31c(%rbp)
+  8041d1:	ff ff ff 
+  8041d4:	e9 c9 00 00 00       	jmp    8042a2 <spawn+0x44e>
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  8041d9:	48 b9 b0 60 80 00 00 	movabs $0x8060b0,%rcx
+  8041e0:	00 00 00 
+  8041e3:	48 ba 51 61 80 00 00 	movabs $0x806151,%rdx
+  8041ea:	00 00 00 
+  8041ed:	be f9 00 00 00       	mov    $0xf9,%esi
+  8041f2:	48 bf 66 61 80 00 00 	movabs $0x806166,%rdi
+  8041f9:	00 00 00 
+  8041fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  804201:	49 b8 de 07 80 00 00 	movabs $0x8007de,%r8
+  804208:	00 00 00 
+  80420b:	41 ff d0             	call   *%r8
+    /* Map them to child */
+    /* Unmap them from parent */
+    size_t datasz = filesz;
+    filesz = ROUNDUP(va + filesz, PAGE_SIZE) - va;
+    if (memsz > filesz)
+        scring_alloc_region(child, (void *)va + filesz, memsz - filesz, perm);
+  80420e:	49 8d 14 06          	lea    (%r14,%rax,1),%rdx
+  804212:	48 29 f2             	sub    %rsi,%rdx
+  804215:	89 d9                	mov    %ebx,%ecx
+  804217:	8b bd dc fc ff ff    	mov    -0x324(%rbp),%edi
+  80421d:	48 b8 ba 51 80 00 00 	movabs $0x8051ba,%rax
+  804224:	00 00 00 
+  804227:	ff d0                	call   *%rax
+  804229:	e9 f0 01 00 00       	jmp    80441e <spawn+0x5ca>
+
+    /* Everything queued so far (including the unmap of
+     * the previous segment) has to be executed first */
+    res = scring_submit();
+    if (res < 0) {
+        cprintf("map_segment.sys_alloc_region failed: %i\n", res);
+  80422e:	89 c6                	mov    %eax,%esi
+  804230:	48 bf e0 60 80 00 00 	movabs $0x8060e0,%rdi
+  804237:	00 00 00 
+  80423a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80423f:	48 ba 2e 09 80 00 00 	movabs $0x80092e,%rdx
+  804246:	00 00 00 
+  804249:	ff d2                	call   *%rdx
+    scring_discard();
+  80424b:	48 b8 9a 51 80 00 00 	movabs $0x80519a,%rax
+  804252:	00 00 00 
+  804255:	ff d0                	call   *%rax
+    sys_unmap_region(0, UTEMP, USER_STACK_SIZE);
+  804257:	ba 00 00 01 00       	mov    $0x10000,%edx
+  80425c:	be 00 00 40 00       	mov    $0x400000,%esi
+  804261:	bf 00 00 00 00       	mov    $0x0,%edi
+  804266:	48 b8 58 18 80 00 00 	movabs $0x801858,%rax
+  80426d:	00 00 00 
+  804270:	ff d0                	call   *%rax
+    sys_env_destroy(child);
+  804272:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  804278:	48 b8 c2 16 80 00 00 	movabs $0x8016c2,%rax
+  80427f:	00 00 00 
+  804282:	ff d0                	call   *%rax
+    close(fd);
+  804284:	8b bd e4 fc ff ff    	mov    -0x31c(%rbp),%edi
+  80428a:	48 b8 f8 1e 80 00 00 	movabs $0x801ef8,%rax
+  804291:	00 00 00 
+  804294:	ff d0                	call   *%rax
+    return res;
+  804296:	8b 85 f0 fc ff ff    	mov    -0x310(%rbp),%eax
+  80429c:	89 85 e4 fc ff ff    	mov    %eax,-0x31c(%rbp)
+}
+  8042a2:	8b 85 e4 fc ff ff    	mov    -0x31c(%rbp),%eax
+  8042a8:	48 81 c4 08 03 00 00 	add    $0x308,%rsp
+  8042af:	5b                   	pop    %rbx
+  8042b0:	41 5c                	pop    %r12
+  8042b2:	41 5d                	pop    %r13
+  8042b4:	41 5e                	pop    %r14
+  8042b6:	41 5f                	pop    %r15
+  8042b8:	5d                   	pop    %rbp
+  8042b9:	c3                   	ret
+    /* Text pages stay shared with the block cache
+     * and with other instances of the program */
+    void *addr = UTEMP;
+    res = mmap(&addr, filesz, PROT_RW, MAP_PRIVATE | MAP_FIXED | MAP_POPULATE, fd, fileoffset);
+    if (res < 0) {
+        cprintf("map_segment.mmap failed: %i\n", res);
+  8042ba:	89 c6                	mov    %eax,%esi
+  8042bc:	48 bf 72 61 80 00 00 	movabs $0x806172,%rdi
+  8042c3:	00 00 00 
+  8042c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042cb:	48 ba 2e 09 80 00 00 	movabs $0x80092e,%rdx
+  8042d2:	00 00 00 
+  8042d5:	ff d2                	call   *%rdx
+        return res;
+  8042d7:	e9 6f ff ff ff       	jmp    80424b <spawn+0x3f7>
+    }
+
+    /* The rest of the last page belongs to bss */
+    if (memsz > datasz && filesz > datasz)
+        memset(UTEMP + datasz, 0, filesz - datasz);
+  8042dc:	4c 89 e2             	mov    %r12,%rdx
+  8042df:	48 8b 85 e8 fc ff ff 	mov    -0x318(%rbp),%rax
+  8042e6:	48 29 c2             	sub    %rax,%rdx
+  8042e9:	48 8d b8 00 00 40 00 	lea    0x400000(%rax),%rdi
+  8042f0:	be 00 00 00 00       	mov    $0x0,%esi
+  8042f5:	48 b8 9f 13 80 00 00 	movabs $0x80139f,%rax
+  8042fc:	00 00 00 
+  8042ff:	ff d0                	call   *%rax
+
+    scring_map_region(CURENVID, UTEMP, child, (void *)va, filesz, perm | PROT_LAZY);
+  804301:	80 cb 80             	or     $0x80,%bl
+  804304:	41 89 d9             	mov    %ebx,%r9d
+  804307:	4d 89 e0             	mov    %r12,%r8
+  80430a:	4c 89 f1             	mov    %r14,%rcx
+  80430d:	8b 95 dc fc ff ff    	mov    -0x324(%rbp),%edx
+  804313:	be 00 00 40 00       	mov    $0x400000,%esi
+  804318:	bf 00 00 00 00       	mov    $0x0,%edi
+  80431d:	48 b8 f0 51 80 00 00 	movabs $0x8051f0,%rax
+  804324:	00 00 00 
+  804327:	ff d0                	call   *%rax
+    res = scring_submit();
+  804329:	48 b8 4e 51 80 00 00 	movabs $0x80514e,%rax
+  804330:	00 00 00 
+  804333:	ff d0                	call   *%rax
+  804335:	89 c3                	mov    %eax,%ebx
+  804337:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+    munmap(UTEMP, filesz);
+  80433d:	4c 89 e6             	mov    %r12,%rsi
+  804340:	bf 00 00 40 00       	mov    $0x400000,%edi
+  804345:	48 b8 21 39 80 00 00 	movabs $0x803921,%rax
+  80434c:	00 00 00 
+  80434f:	ff d0                	call   *%rax
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  804351:	85 db                	test   %ebx,%ebx
+  804353:	0f 88 f2 fe ff ff    	js     80424b <spawn+0x3f7>
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  804359:	49 83 c7 01          	add    $0x1,%r15
+  80435d:	49 83 c5 38          	add    $0x38,%r13
+  804361:	0f b7 85 08 fe ff ff 	movzwl -0x1f8(%rbp),%eax
+  804368:	49 39 c7             	cmp    %rax,%r15
+  80436b:	0f 83 37 01 00 00    	jae    8044a8 <spawn+0x654>
+        if (ph->p_type != ELF_PROG_LOAD) continue;
+  804371:	41 83 7d 00 01       	cmpl   $0x1,0x0(%r13)
+  804376:	75 e1                	jne    804359 <spawn+0x505>
+        if (ph->p_flags & ELF_PROG_FLAG_WRITE) perm |= PROT_W;
+  804378:	41 8b 45 04          	mov    0x4(%r13),%eax
+  80437c:	89 c3                	mov    %eax,%ebx
+  80437e:	83 e3 02             	and    $0x2,%ebx
+        if (ph->p_flags & ELF_PROG_FLAG_READ) perm |= PROT_R;
+  804381:	89 da                	mov    %ebx,%edx
+  804383:	83 ca 04             	or     $0x4,%edx
+  804386:	a8 04                	test   $0x4,%al
+  804388:	0f 45 da             	cmovne %edx,%ebx
+        if (ph->p_flags & ELF_PROG_FLAG_EXEC) perm |= PROT_X;
+  80438b:	89 da                	mov    %ebx,%edx
+  80438d:	83 ca 01             	or     $0x1,%edx
+  804390:	a8 01                	test   $0x1,%al
+  804392:	0f 45 da             	cmovne %edx,%ebx
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  804395:	49 8b 45 08          	mov    0x8(%r13),%rax
+  804399:	89 85 e0 fc ff ff    	mov    %eax,-0x320(%rbp)
+  80439f:	49 8b 75 20          	mov    0x20(%r13),%rsi
+  8043a3:	48 89 b5 e8 fc ff ff 	mov    %rsi,-0x318(%rbp)
+  8043aa:	49 8b 7d 28          	mov    0x28(%r13),%rdi
+  8043ae:	48 89 bd f8 fc ff ff 	mov    %rdi,-0x308(%rbp)
+  8043b5:	4d 8b 75 10          	mov    0x10(%r13),%r14
+  8043b9:	8b 8d cc fd ff ff    	mov    -0x234(%rbp),%ecx
+  8043bf:	89 8d dc fc ff ff    	mov    %ecx,-0x324(%rbp)
+    if (res) {
+  8043c5:	44 89 f2             	mov    %r14d,%edx
+  8043c8:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8043ce:	74 22                	je     8043f2 <spawn+0x59e>
+        va -= res;
+  8043d0:	48 63 ca             	movslq %edx,%rcx
+  8043d3:	49 29 ce             	sub    %rcx,%r14
+        memsz += res;
+  8043d6:	48 01 cf             	add    %rcx,%rdi
+  8043d9:	48 89 bd f8 fc ff ff 	mov    %rdi,-0x308(%rbp)
+        filesz += res;
+  8043e0:	48 01 ce             	add    %rcx,%rsi
+  8043e3:	48 89 b5 e8 fc ff ff 	mov    %rsi,-0x318(%rbp)
+        fileoffset -= res;
+  8043ea:	29 d0                	sub    %edx,%eax
+  8043ec:	89 85 e0 fc ff ff    	mov    %eax,-0x320(%rbp)
+    filesz = ROUNDUP(va + filesz, PAGE_SIZE) - va;
+  8043f2:	48 8b 85 e8 fc ff ff 	mov    -0x318(%rbp),%rax
+  8043f9:	4a 8d b4 30 ff 0f 00 	lea    0xfff(%rax,%r14,1),%rsi
+  804400:	00 
+  804401:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  804408:	49 89 f4             	mov    %rsi,%r12
+  80440b:	4d 29 f4             	sub    %r14,%r12
+    if (memsz > filesz)
+  80440e:	48 8b 85 f8 fc ff ff 	mov    -0x308(%rbp),%rax
+  804415:	49 39 c4             	cmp    %rax,%r12
+  804418:	0f 82 f0 fd ff ff    	jb     80420e <spawn+0x3ba>
+    res = scring_submit();
+  80441e:	48 b8 4e 51 80 00 00 	movabs $0x80514e,%rax
+  804425:	00 00 00 
+  804428:	ff d0                	call   *%rax
+  80442a:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+    if (res < 0) {
+  804430:	85 c0                	test   %eax,%eax
+  804432:	0f 88 f6 fd ff ff    	js     80422e <spawn+0x3da>
+    if (!filesz) return 0;
+  804438:	4d 85 e4             	test   %r12,%r12
+  80443b:	0f 84 18 ff ff ff    	je     804359 <spawn+0x505>
+    void *addr = UTEMP;
+  804441:	48 c7 85 00 fd ff ff 	movq   $0x400000,-0x300(%rbp)
+  804448:	00 00 40 00 
+    res = mmap(&addr, filesz, PROT_RW, MAP_PRIVATE | MAP_FIXED | MAP_POPULATE, fd, fileoffset);
+  80444c:	44 8b 8d e0 fc ff ff 	mov    -0x320(%rbp),%r9d
+  804453:	44 8b 85 e4 fc ff ff 	mov    -0x31c(%rbp),%r8d
+  80445a:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  80445f:	ba 06 00 00 00       	mov    $0x6,%edx
+  804464:	4c 89 e6             	mov    %r12,%rsi
+  804467:	48 8d bd 00 fd ff ff 	lea    -0x300(%rbp),%rdi
+  80446e:	48 b8 9e 3a 80 00 00 	movabs $0x803a9e,%rax
+  804475:	00 00 00 
+  804478:	ff d0                	call   *%rax
+  80447a:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+    if (res < 0) {
+  804480:	85 c0                	test   %eax,%eax
+  804482:	0f 88 32 fe ff ff    	js     8042ba <spawn+0x466>
+    if (memsz > datasz && filesz > datasz)
+  804488:	48 8b 85 f8 fc ff ff 	mov    -0x308(%rbp),%rax
+  80448f:	49 39 c4             	cmp    %rax,%r12
+  804492:	49 0f 46 c4          	cmovbe %r12,%rax
+  804496:	48 39 85 e8 fc ff ff 	cmp    %rax,-0x318(%rbp)
+  80449d:	0f 83 5e fe ff ff    	jae    804301 <spawn+0x4ad>
+  8044a3:	e9 34 fe ff ff       	jmp    8042dc <spawn+0x488>
+    close(fd);
+  8044a8:	8b bd e4 fc ff ff    	mov    -0x31c(%rbp),%edi
+  8044ae:	48 b8 f8 1e 80 00 00 	movabs $0x801ef8,%rax
+  8044b5:	00 00 00 
+  8044b8:	ff d0                	call   *%rax
+    foreach_shared_region(copy_shared_region, &child);
+  8044ba:	48 8d b5 cc fd ff ff 	lea    -0x234(%rbp),%rsi
+  8044c1:	48 bf ff 3d 80 00 00 	movabs $0x803dff,%rdi
+  8044c8:	00 00 00 
+  8044cb:	48 b8 ef 4e 80 00 00 	movabs $0x804eef,%rax
+  8044d2:	00 00 00 
+  8044d5:	ff d0                	call   *%rax
+    scring_env_set_trapframe(child, &child_tf);
+  8044d7:	48 8d b5 0c fd ff ff 	lea    -0x2f4(%rbp),%rsi
+  8044de:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  8044e4:	48 b8 9a 52 80 00 00 	movabs $0x80529a,%rax
+  8044eb:	00 00 00 
+  8044ee:	ff d0                	call   *%rax
+    scring_env_set_status(child, ENV_RUNNABLE);
+  8044f0:	be 02 00 00 00       	mov    $0x2,%esi
+  8044f5:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  8044fb:	48 b8 62 52 80 00 00 	movabs $0x805262,%rax
+  804502:	00 00 00 
+  804505:	ff d0                	call   *%rax
+    if ((res = scring_submit()) < 0) {
+  804507:	48 b8 4e 51 80 00 00 	movabs $0x80514e,%rax
+  80450e:	00 00 00 
+  804511:	ff d0                	call   *%rax
+  804513:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+  804519:	85 c0                	test   %eax,%eax
+  80451b:	78 11                	js     80452e <spawn+0x6da>
+    return child;
+  80451d:	8b 85 cc fd ff ff    	mov    -0x234(%rbp),%eax
+  804523:	89 85 e4 fc ff ff    	mov    %eax,-0x31c(%rbp)
+  804529:	e9 74 fd ff ff       	jmp    8042a2 <spawn+0x44e>
+        cprintf("spawn: batched system call failed: %i\n", res);
+  80452e:	89 c6                	mov    %eax,%esi
+  804530:	48 bf 10 61 80 00 00 	movabs $0x806110,%rdi
+  804537:	00 00 00 
+  80453a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80453f:	48 ba 2e 09 80 00 00 	movabs $0x80092e,%rdx
+  804546:	00 00 00 
+  804549:	ff d2                	call   *%rdx
+        goto error;
+  80454b:	e9 fb fc ff ff       	jmp    80424b <spawn+0x3f7>
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  804550:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  804555:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+  80455b:	e9 eb fc ff ff       	jmp    80424b <spawn+0x3f7>
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  804560:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804565:	ba 00 00 01 00       	mov    $0x10000,%edx
+  80456a:	be 00 00 40 00       	mov    $0x400000,%esi
+  80456f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804574:	48 b8 b2 17 80 00 00 	movabs $0x8017b2,%rax
+  80457b:	00 00 00 
+  80457e:	ff d0                	call   *%rax
+  804580:	85 c0                	test   %eax,%eax
+  804582:	78 d1                	js     804555 <spawn+0x701>
+    for (argc = 0; argv[argc] != 0; argc++)
+  804584:	48 c7 85 f8 fc ff ff 	movq   $0x0,-0x308(%rbp)
+  80458b:	00 00 00 00 
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  80458f:	48 c7 85 f0 fc ff ff 	movq   $0x40fff8,-0x310(%rbp)
+  804596:	f8 ff 40 00 
+  80459a:	48 c7 85 e8 fc ff ff 	movq   $0x410000,-0x318(%rbp)
+  8045a1:	00 00 41 00 
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  8045a5:	bb 00 00 41 00       	mov    $0x410000,%ebx
+  8045aa:	e9 e2 fa ff ff       	jmp    804091 <spawn+0x23d>
+
+00000000008045af <spawnl>:
+spawnl(const char *prog, const char *arg0, ...) {
+  8045af:	55                   	push   %rbp
+  8045b0:	48 89 e5             	mov    %rsp,%rbp
+  8045b3:	48 83 ec 50          	sub    $0x50,%rsp
+  8045b7:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8045bb:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8045bf:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8045c3:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(vl, arg0);
+  8045c7:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8045ce:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8045d2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8045d6:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8045da:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int argc = 0;
+  8045de:	b9 00 00 00 00       	mov    $0x0,%ecx
+    while (va_arg(vl, void *) != NULL) argc++;
+  8045e3:	eb 15                	jmp    8045fa <spawnl+0x4b>
+  8045e5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8045e9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8045ed:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8045f1:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  8045f5:	74 1c                	je     804613 <spawnl+0x64>
+  8045f7:	83 c1 01             	add    $0x1,%ecx
+  8045fa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8045fd:	83 f8 2f             	cmp    $0x2f,%eax
+  804600:	77 e3                	ja     8045e5 <spawnl+0x36>
+  804602:	89 c2                	mov    %eax,%edx
+  804604:	4c 8d 55 d0          	lea    -0x30(%rbp),%r10
+  804608:	4c 01 d2             	add    %r10,%rdx
+  80460b:	83 c0 08             	add    $0x8,%eax
+  80460e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  804611:	eb de                	jmp    8045f1 <spawnl+0x42>
+    const char *argv[argc + 2];
+  804613:	8d 41 02             	lea    0x2(%rcx),%eax
+  804616:	48 98                	cltq
+  804618:	48 8d 04 c5 0f 00 00 	lea    0xf(,%rax,8),%rax
+  80461f:	00 
+  804620:	48 83 e0 f0          	and    $0xfffffffffffffff0,%rax
+  804624:	48 29 c4             	sub    %rax,%rsp
+  804627:	4c 8d 44 24 07       	lea    0x7(%rsp),%r8
+  80462c:	4c 89 c0             	mov    %r8,%rax
+  80462f:	48 c1 e8 03          	shr    $0x3,%rax
+  804633:	49 83 e0 f8          	and    $0xfffffffffffffff8,%r8
+    argv[0] = arg0;
+  804637:	48 89 34 c5 00 00 00 	mov    %rsi,0x0(,%rax,8)
+  80463e:	00 
+    argv[argc + 1] = NULL;
+  80463f:	8d 41 01             	lea    0x1(%rcx),%eax
+  804642:	48 98                	cltq
+  804644:	49 c7 04 c0 00 00 00 	movq   $0x0,(%r8,%rax,8)
+  80464b:	00 
+    va_start(vl, arg0);
+  80464c:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  804653:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804657:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80465b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80465f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    for (i = 0; i < argc; i++) {
+  804663:	85 c9                	test   %ecx,%ecx
+  804665:	74 41                	je     8046a8 <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  804667:	49 89 c1             	mov    %rax,%r9
+  80466a:	49 8d 40 08          	lea    0x8(%r8),%rax
+  80466e:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  804671:	49 8d 74 d0 10       	lea    0x10(%r8,%rdx,8),%rsi
+  804676:	eb 1b                	jmp    804693 <spawnl+0xe4>
+  804678:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80467c:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  804680:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  804684:	48 8b 11             	mov    (%rcx),%rdx
+  804687:	48 89 10             	mov    %rdx,(%rax)
+    for (i = 0; i < argc; i++) {
+  80468a:	48 83 c0 08          	add    $0x8,%rax
+  80468e:	48 39 f0             	cmp    %rsi,%rax
+  804691:	74 15                	je     8046a8 <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  804693:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  804696:	83 fa 2f             	cmp    $0x2f,%edx
+  804699:	77 dd                	ja     804678 <spawnl+0xc9>
+  80469b:	89 d1                	mov    %edx,%ecx
+  80469d:	4c 01 c9             	add    %r9,%rcx
+  8046a0:	83 c2 08             	add    $0x8,%edx
+  8046a3:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8046a6:	eb dc                	jmp    804684 <spawnl+0xd5>
+    return spawn(prog, argv);
+  8046a8:	4c 89 c6             	mov    %r8,%rsi
+  8046ab:	48 b8 54 3e 80 00 00 	movabs $0x803e54,%rax
+  8046b2:	00 00 00 
+  8046b5:	ff d0                	call   *%rax
+}
+  8046b7:	c9                   	leave
+  8046b8:	c3                   	ret
+
+00000000008046b9 <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8046b9:	55                   	push   %rbp
+  8046ba:	48 89 e5             	mov    %rsp,%rbp
+  8046bd:	41 54                	push   %r12
+  8046bf:	53                   	push   %rbx
+  8046c0:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8046c3:	48 b8 17 1d 80 00 00 	movabs $0x801d17,%rax
+  8046ca:	00 00 00 
+  8046cd:	ff d0                	call   *%rax
+  8046cf:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8046d2:	48 be 8f 61 80 00 00 	movabs $0x80618f,%rsi
+  8046d9:	00 00 00 
+  8046dc:	48 89 df             	mov    %rbx,%rdi
+  8046df:	48 b8 53 12 80 00 00 	movabs $0x801253,%rax
+  8046e6:	00 00 00 
+  8046e9:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8046eb:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8046f0:	41 2b 04 24          	sub    (%r12),%eax
+  8046f4:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8046fa:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  804701:	00 00 00 
+    stat->st_dev = &devpipe;
+  804704:	48 b8 a0 70 80 00 00 	movabs $0x8070a0,%rax
+  80470b:	00 00 00 
+  80470e:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  804715:	b8 00 00 00 00       	mov    $0x0,%eax
+  80471a:	5b                   	pop    %rbx
+  80471b:	41 5c                	pop    %r12
+  80471d:	5d                   	pop    %rbp
+  80471e:	c3                   	ret
+
+000000000080471f <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  80471f:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  804722:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  804728:	8b 17                	mov    (%rdi),%edx
+  80472a:	85 d2                	test   %edx,%edx
+  80472c:	75 01                	jne    80472f <pipe_wakeup+0x10>
+  80472e:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  80472f:	55                   	push   %rbp
+  804730:	48 89 e5             	mov    %rsp,%rbp
+  804733:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  804736:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  80473c:	be 00 04 00 00       	mov    $0x400,%esi
+  804741:	48 b8 3e 1b 80 00 00 	movabs $0x801b3e,%rax
+  804748:	00 00 00 
+  80474b:	ff d0                	call   *%rax
+}
+  80474d:	5d                   	pop    %rbp
+  80474e:	c3                   	ret
+
+000000000080474f <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80474f:	55                   	push   %rbp
+  804750:	48 89 e5             	mov    %rsp,%rbp
+  804753:	41 55                	push   %r13
+  804755:	41 54                	push   %r12
+  804757:	53                   	push   %rbx
+  804758:	48 83 ec 08          	sub    $0x8,%rsp
+  80475c:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80475f:	48 b8 17 1d 80 00 00 	movabs $0x801d17,%rax
+  804766:	00 00 00 
+  804769:	ff d0                	call   *%rax
+  80476b:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80476e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804773:	4c 89 e6             	mov    %r12,%rsi
+  804776:	bf 00 00 00 00       	mov    $0x0,%edi
+  80477b:	49 bc 58 18 80 00 00 	movabs $0x801858,%r12
+  804782:	00 00 00 
+  804785:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  804788:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  80478c:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  804790:	49 bd 1f 47 80 00 00 	movabs $0x80471f,%r13
+  804797:	00 00 00 
+  80479a:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  80479d:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  8047a1:	48 89 de             	mov    %rbx,%rsi
+  8047a4:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  8047a7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8047ac:	48 89 de             	mov    %rbx,%rsi
+  8047af:	bf 00 00 00 00       	mov    $0x0,%edi
+  8047b4:	41 ff d4             	call   *%r12
+  8047b7:	48 83 c4 08          	add    $0x8,%rsp
+  8047bb:	5b                   	pop    %rbx
+  8047bc:	41 5c                	pop    %r12
+  8047be:	41 5d                	pop    %r13
+  8047c0:	5d                   	pop    %rbp
+  8047c1:	c3                   	ret
+
+00000000008047c2 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  8047c2:	55                   	push   %rbp
+  8047c3:	48 89 e5             	mov    %rsp,%rbp
+  8047c6:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8047c9:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8047ce:	be 00 10 00 00       	mov    $0x1000,%esi
+  8047d3:	48 b8 9b 17 80 00 00 	movabs $0x80179b,%rax
+  8047da:	00 00 00 
+  8047dd:	ff d0                	call   *%rax
+  8047df:	85 c0                	test   %eax,%eax
+  8047e1:	0f 94 c0             	sete   %al
+  8047e4:	0f b6 c0             	movzbl %al,%eax
+}
+  8047e7:	5d                   	pop    %rbp
+  8047e8:	c3                   	ret
+
+00000000008047e9 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8047e9:	55                   	push   %rbp
+  8047ea:	48 89 e5             	mov    %rsp,%rbp
+  8047ed:	41 57                	push   %r15
+  8047ef:	41 56                	push   %r14
+  8047f1:	41 55                	push   %r13
+  8047f3:	41 54                	push   %r12
+  8047f5:	53                   	push   %rbx
+  8047f6:	48 83 ec 38          	sub    $0x38,%rsp
+  8047fa:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8047fe:	49 89 f4             	mov    %rsi,%r12
+  804801:	49 89 d7             	mov    %rdx,%r15
+  804804:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804808:	48 b8 17 1d 80 00 00 	movabs $0x801d17,%rax
+  80480f:	00 00 00 
+  804812:	ff d0                	call   *%rax
+  804814:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  804817:	4d 85 ff             	test   %r15,%r15
+  80481a:	0f 84 f1 00 00 00    	je     804911 <devpipe_write+0x128>
+  804820:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  804824:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  804828:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  80482c:	49 bd c2 47 80 00 00 	movabs $0x8047c2,%r13
+  804833:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  804836:	49 bf 1f 47 80 00 00 	movabs $0x80471f,%r15
+  80483d:	00 00 00 
+  804840:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  804844:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804848:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80484c:	8b 73 04             	mov    0x4(%rbx),%esi
+  80484f:	48 63 ce             	movslq %esi,%rcx
+  804852:	48 63 03             	movslq (%rbx),%rax
+  804855:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  80485b:	48 39 c1             	cmp    %rax,%rcx
+  80485e:	72 64                	jb     8048c4 <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  804860:	48 89 de             	mov    %rbx,%rsi
+  804863:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  804867:	41 ff d5             	call   *%r13
+  80486a:	85 c0                	test   %eax,%eax
+  80486c:	0f 85 b9 00 00 00    	jne    80492b <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  804872:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  804876:	4c 89 f7             	mov    %r14,%rdi
+  804879:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  80487c:	8b 43 04             	mov    0x4(%rbx),%eax
+  80487f:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  804886:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  80488d:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  804893:	8b 03                	mov    (%rbx),%eax
+  804895:	41 39 c4             	cmp    %eax,%r12d
+  804898:	75 b2                	jne    80484c <devpipe_write+0x63>
+  80489a:	48 89 de             	mov    %rbx,%rsi
+  80489d:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8048a1:	41 ff d5             	call   *%r13
+  8048a4:	85 c0                	test   %eax,%eax
+  8048a6:	75 a0                	jne    804848 <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  8048a8:	ba 0a 00 00 00       	mov    $0xa,%edx
+  8048ad:	44 89 e6             	mov    %r12d,%esi
+  8048b0:	48 89 df             	mov    %rbx,%rdi
+  8048b3:	48 b8 20 1b 80 00 00 	movabs $0x801b20,%rax
+  8048ba:	00 00 00 
+  8048bd:	ff d0                	call   *%rax
+  8048bf:	e9 7c ff ff ff       	jmp    804840 <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8048c4:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  8048c8:	41 0f b6 38          	movzbl (%r8),%edi
+  8048cc:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  8048d3:	80 80 80 
+  8048d6:	48 89 c8             	mov    %rcx,%rax
+  8048d9:	48 f7 e2             	mul    %rdx
+  8048dc:	48 c1 ea 0b          	shr    $0xb,%rdx
+  8048e0:	48 89 d0             	mov    %rdx,%rax
+  8048e3:	48 c1 e0 08          	shl    $0x8,%rax
+  8048e7:	48 29 d0             	sub    %rdx,%rax
+  8048ea:	48 c1 e0 04          	shl    $0x4,%rax
+  8048ee:	48 29 c1             	sub    %rax,%rcx
+  8048f1:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  8048f6:	83 c6 01             	add    $0x1,%esi
+  8048f9:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8048fc:	49 83 c0 01          	add    $0x1,%r8
+  804900:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  804904:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804908:	49 39 c0             	cmp    %rax,%r8
+  80490b:	0f 85 2f ff ff ff    	jne    804840 <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  804911:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  804915:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  804919:	48 b8 1f 47 80 00 00 	movabs $0x80471f,%rax
+  804920:	00 00 00 
+  804923:	ff d0                	call   *%rax
+    return n;
+  804925:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804929:	eb 05                	jmp    804930 <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  80492b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804930:	48 83 c4 38          	add    $0x38,%rsp
+  804934:	5b                   	pop    %rbx
+  804935:	41 5c                	pop    %r12
+  804937:	41 5d                	pop    %r13
+  804939:	41 5e                	pop    %r14
+  80493b:	41 5f                	pop    %r15
+  80493d:	5d                   	pop    %rbp
+  80493e:	c3                   	ret
+
+000000000080493f <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80493f:	55                   	push   %rbp
+  804940:	48 89 e5             	mov    %rsp,%rbp
+  804943:	41 57                	push   %r15
+  804945:	41 56                	push   %r14
+  804947:	41 55                	push   %r13
+  804949:	41 54                	push   %r12
+  80494b:	53                   	push   %rbx
+  80494c:	48 83 ec 28          	sub    $0x28,%rsp
+  804950:	49 89 fd             	mov    %rdi,%r13
+  804953:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  804957:	49 89 d4             	mov    %rdx,%r12
+  80495a:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80495e:	48 b8 17 1d 80 00 00 	movabs $0x801d17,%rax
+  804965:	00 00 00 
+  804968:	ff d0                	call   *%rax
+  80496a:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  80496d:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  804973:	49 bf c2 47 80 00 00 	movabs $0x8047c2,%r15
+  80497a:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  80497d:	4d 85 e4             	test   %r12,%r12
+  804980:	0f 84 d5 00 00 00    	je     804a5b <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  804986:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  80498a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80498e:	8b 03                	mov    (%rbx),%eax
+  804990:	3b 43 04             	cmp    0x4(%rbx),%eax
+  804993:	75 7a                	jne    804a0f <devpipe_read+0xd0>
+            if (i > 0) {
+  804995:	4d 85 f6             	test   %r14,%r14
+  804998:	75 50                	jne    8049ea <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  80499a:	48 89 de             	mov    %rbx,%rsi
+  80499d:	4c 89 ef             	mov    %r13,%rdi
+  8049a0:	41 ff d7             	call   *%r15
+  8049a3:	85 c0                	test   %eax,%eax
+  8049a5:	0f 85 c9 00 00 00    	jne    804a74 <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  8049ab:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  8049ae:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8049b5:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  8049bb:	8b 43 04             	mov    0x4(%rbx),%eax
+  8049be:	41 39 c4             	cmp    %eax,%r12d
+  8049c1:	75 cb                	jne    80498e <devpipe_read+0x4f>
+  8049c3:	48 89 de             	mov    %rbx,%rsi
+  8049c6:	4c 89 ef             	mov    %r13,%rdi
+  8049c9:	41 ff d7             	call   *%r15
+  8049cc:	85 c0                	test   %eax,%eax
+  8049ce:	75 be                	jne    80498e <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  8049d0:	ba 0a 00 00 00       	mov    $0xa,%edx
+  8049d5:	44 89 e6             	mov    %r12d,%esi
+  8049d8:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8049dc:	48 b8 20 1b 80 00 00 	movabs $0x801b20,%rax
+  8049e3:	00 00 00 
+  8049e6:	ff d0                	call   *%rax
+  8049e8:	eb a4                	jmp    80498e <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  8049ea:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  8049ee:	48 89 de             	mov    %rbx,%rsi
+  8049f1:	48 b8 1f 47 80 00 00 	movabs $0x80471f,%rax
+  8049f8:	00 00 00 
+  8049fb:	ff d0                	call   *%rax
+                return i;
+  8049fd:	4c 89 f0             	mov    %r14,%rax
+}
+  804a00:	48 83 c4 28          	add    $0x28,%rsp
+  804a04:	5b                   	pop    %rbx
+  804a05:	41 5c                	pop    %r12
+  804a07:	41 5d                	pop    %r13
+  804a09:	41 5e                	pop    %r14
+  804a0b:	41 5f                	pop    %r15
+  804a0d:	5d                   	pop    %rbp
+  804a0e:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  804a0f:	48 63 c8             	movslq %eax,%rcx
+  804a12:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  804a19:	80 80 80 
+  804a1c:	48 89 c8             	mov    %rcx,%rax
+  804a1f:	48 f7 e2             	mul    %rdx
+  804a22:	48 c1 ea 0b          	shr    $0xb,%rdx
+  804a26:	48 89 d0             	mov    %rdx,%rax
+  804a29:	48 c1 e0 08          	shl    $0x8,%rax
+  804a2d:	48 29 d0             	sub    %rdx,%rax
+  804a30:	48 c1 e0 04          	shl    $0x4,%rax
+  804a34:	48 89 c2             	mov    %rax,%rdx
+  804a37:	48 89 c8             	mov    %rcx,%rax
+  804a3a:	48 29 d0             	sub    %rdx,%rax
+  804a3d:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  804a42:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804a46:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  804a4a:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  804a4d:	49 83 c6 01          	add    $0x1,%r14
+  804a51:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  804a55:	0f 85 2b ff ff ff    	jne    804986 <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  804a5b:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  804a5f:	48 89 de             	mov    %rbx,%rsi
+  804a62:	48 b8 1f 47 80 00 00 	movabs $0x80471f,%rax
+  804a69:	00 00 00 
+  804a6c:	ff d0                	call   *%rax
+    return n;
+  804a6e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804a72:	eb 8c                	jmp    804a00 <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  804a74:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a79:	eb 85                	jmp    804a00 <devpipe_read+0xc1>
+
+0000000000804a7b <pipe>:
+pipe(int pfd[2]) {
+  804a7b:	55                   	push   %rbp
+  804a7c:	48 89 e5             	mov    %rsp,%rbp
+  804a7f:	41 55                	push   %r13
+  804a81:	41 54                	push   %r12
+  804a83:	53                   	push   %rbx
+  804a84:	48 83 ec 18          	sub    $0x18,%rsp
+  804a88:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804a8b:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  804a8f:	48 b8 33 1d 80 00 00 	movabs $0x801d33,%rax
+  804a96:	00 00 00 
+  804a99:	ff d0                	call   *%rax
+  804a9b:	89 c3                	mov    %eax,%ebx
+  804a9d:	85 c0                	test   %eax,%eax
+  804a9f:	0f 88 a0 01 00 00    	js     804c45 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  804aa5:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804aaa:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804aaf:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804ab3:	bf 00 00 00 00       	mov    $0x0,%edi
+  804ab8:	48 b8 b2 17 80 00 00 	movabs $0x8017b2,%rax
+  804abf:	00 00 00 
+  804ac2:	ff d0                	call   *%rax
+  804ac4:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804ac6:	85 c0                	test   %eax,%eax
+  804ac8:	0f 88 77 01 00 00    	js     804c45 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804ace:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  804ad2:	48 b8 33 1d 80 00 00 	movabs $0x801d33,%rax
+  804ad9:	00 00 00 
+  804adc:	ff d0                	call   *%rax
+  804ade:	89 c3                	mov    %eax,%ebx
+  804ae0:	85 c0                	test   %eax,%eax
+  804ae2:	0f 88 43 01 00 00    	js     804c2b <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  804ae8:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804aed:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804af2:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804af6:	bf 00 00 00 00       	mov    $0x0,%edi
+  804afb:	48 b8 b2 17 80 00 00 	movabs $0x8017b2,%rax
+  804b02:	00 00 00 
+  804b05:	ff d0                	call   *%rax
+  804b07:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804b09:	85 c0                	test   %eax,%eax
+  804b0b:	0f 88 1a 01 00 00    	js     804c2b <pipe+0x1b0>
+    va = fd2data(fd0);
+  804b11:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804b15:	48 b8 17 1d 80 00 00 	movabs $0x801d17,%rax
+  804b1c:	00 00 00 
+  804b1f:	ff d0                	call   *%rax
+  804b21:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  804b24:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804b29:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804b2e:	48 89 c6             	mov    %rax,%rsi
+  804b31:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b36:	48 b8 b2 17 80 00 00 	movabs $0x8017b2,%rax
+  804b3d:	00 00 00 
+  804b40:	ff d0                	call   *%rax
+  804b42:	89 c3                	mov    %eax,%ebx
+  804b44:	85 c0                	test   %eax,%eax
+  804b46:	0f 88 c5 00 00 00    	js     804c11 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  804b4c:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804b50:	48 b8 17 1d 80 00 00 	movabs $0x801d17,%rax
+  804b57:	00 00 00 
+  804b5a:	ff d0                	call   *%rax
+  804b5c:	48 89 c1             	mov    %rax,%rcx
+  804b5f:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  804b65:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804b6b:	ba 00 00 00 00       	mov    $0x0,%edx
+  804b70:	4c 89 ee             	mov    %r13,%rsi
+  804b73:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b78:	48 b8 08 18 80 00 00 	movabs $0x801808,%rax
+  804b7f:	00 00 00 
+  804b82:	ff d0                	call   *%rax
+  804b84:	89 c3                	mov    %eax,%ebx
+  804b86:	85 c0                	test   %eax,%eax
+  804b88:	78 6e                	js     804bf8 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804b8a:	be 00 10 00 00       	mov    $0x1000,%esi
+  804b8f:	4c 89 ef             	mov    %r13,%rdi
+  804b92:	48 b8 77 17 80 00 00 	movabs $0x801777,%rax
+  804b99:	00 00 00 
+  804b9c:	ff d0                	call   *%rax
+  804b9e:	83 f8 02             	cmp    $0x2,%eax
+  804ba1:	0f 85 ab 00 00 00    	jne    804c52 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  804ba7:	a1 a0 70 80 00 00 00 	movabs 0x8070a0,%eax
+  804bae:	00 00 
+  804bb0:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804bb4:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  804bb6:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804bba:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  804bc1:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804bc5:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  804bc7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804bcb:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  804bd2:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804bd6:	48 bb 05 1d 80 00 00 	movabs $0x801d05,%rbx
+  804bdd:	00 00 00 
+  804be0:	ff d3                	call   *%rbx
+  804be2:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  804be6:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804bea:	ff d3                	call   *%rbx
+  804bec:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  804bf1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804bf6:	eb 4d                	jmp    804c45 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  804bf8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804bfd:	4c 89 ee             	mov    %r13,%rsi
+  804c00:	bf 00 00 00 00       	mov    $0x0,%edi
+  804c05:	48 b8 58 18 80 00 00 	movabs $0x801858,%rax
+  804c0c:	00 00 00 
+  804c0f:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  804c11:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804c16:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804c1a:	bf 00 00 00 00       	mov    $0x0,%edi
+  804c1f:	48 b8 58 18 80 00 00 	movabs $0x801858,%rax
+  804c26:	00 00 00 
+  804c29:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  804c2b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804c30:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804c34:	bf 00 00 00 00       	mov    $0x0,%edi
+  804c39:	48 b8 58 18 80 00 00 	movabs $0x801858,%rax
+  804c40:	00 00 00 
+  804c43:	ff d0                	call   *%rax
+}
+  804c45:	89 d8                	mov    %ebx,%eax
+  804c47:	48 83 c4 18          	add    $0x18,%rsp
+  804c4b:	5b                   	pop    %rbx
+  804c4c:	41 5c                	pop    %r12
+  804c4e:	41 5d                	pop    %r13
+  804c50:	5d                   	pop    %rbp
+  804c51:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804c52:	48 b9 a8 61 80 00 00 	movabs $0x8061a8,%rcx
+  804c59:	00 00 00 
+  804c5c:	48 ba 51 61 80 00 00 	movabs $0x806151,%rdx
+  804c63:	00 00 00 
+  804c66:	be 50 00 00 00       	mov    $0x50,%esi
+  804c6b:	48 bf 96 61 80 00 00 	movabs $0x806196,%rdi
+  804c72:	00 00 00 
+  804c75:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c7a:	49 b8 de 07 80 00 00 	movabs $0x8007de,%r8
+  804c81:	00 00 00 
+  804c84:	41 ff d0             	call   *%r8
+
+0000000000804c87 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  804c87:	55                   	push   %rbp
+  804c88:	48 89 e5             	mov    %rsp,%rbp
+  804c8b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804c8f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804c93:	48 b8 93 1d 80 00 00 	movabs $0x801d93,%rax
+  804c9a:	00 00 00 
+  804c9d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804c9f:	85 c0                	test   %eax,%eax
+  804ca1:	78 23                	js     804cc6 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  804ca3:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804ca7:	48 b8 17 1d 80 00 00 	movabs $0x801d17,%rax
+  804cae:	00 00 00 
+  804cb1:	ff d0                	call   *%rax
+  804cb3:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  804cb6:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804cba:	48 b8 c2 47 80 00 00 	movabs $0x8047c2,%rax
+  804cc1:	00 00 00 
+  804cc4:	ff d0                	call   *%rax
+}
+  804cc6:	c9                   	leave
+  804cc7:	c3                   	ret
+
+0000000000804cc8 <wait>:
+#include <inc/lib.h>
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  804cc8:	55                   	push   %rbp
+  804cc9:	48 89 e5             	mov    %rsp,%rbp
+  804ccc:	41 56                	push   %r14
+  804cce:	41 55                	push   %r13
+  804cd0:	41 54                	push   %r12
+  804cd2:	53                   	push   %rbx
+    assert(envid != 0);
+  804cd3:	85 ff                	test   %edi,%edi
+  804cd5:	0f 84 b7 00 00 00    	je     804d92 <wait+0xca>
+  804cdb:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  804cde:	89 f9                	mov    %edi,%ecx
+  804ce0:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+
+    for (;;) {
+        uint32_t seq = env->env_wait_seq;
+  804ce6:	48 bf 00 00 c0 1f 80 	movabs $0x801fc00000,%rdi
+  804ced:	00 00 00 
+  804cf0:	45 89 e0             	mov    %r12d,%r8d
+  804cf3:	41 81 e0 ff 03 00 00 	and    $0x3ff,%r8d
+  804cfa:	4c 89 c0             	mov    %r8,%rax
+  804cfd:	48 c1 e0 04          	shl    $0x4,%rax
+  804d01:	48 89 c2             	mov    %rax,%rdx
+  804d04:	4c 29 c2             	sub    %r8,%rdx
+  804d07:	48 c1 e2 05          	shl    $0x5,%rdx
+  804d0b:	48 01 fa             	add    %rdi,%rdx
+  804d0e:	8b b2 b8 01 00 00    	mov    0x1b8(%rdx),%esi
+        if (env->env_id != envid || env->env_status == ENV_FREE) break;
+  804d14:	8b 82 c8 00 00 00    	mov    0xc8(%rdx),%eax
+  804d1a:	41 39 c4             	cmp    %eax,%r12d
+  804d1d:	75 6a                	jne    804d89 <wait+0xc1>
+
+        /* The kernel wakes us up when the environment is freed */
+        sys_futex_wait(&env->env_wait_seq, seq, 0);
+  804d1f:	48 63 d1             	movslq %ecx,%rdx
+  804d22:	48 89 d0             	mov    %rdx,%rax
+  804d25:	48 c1 e0 04          	shl    $0x4,%rax
+  804d29:	48 29 d0             	sub    %rdx,%rax
+  804d2c:	48 c1 e0 05          	shl    $0x5,%rax
+  804d30:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804d37:	00 00 00 
+  804d3a:	4c 8d b4 02 b8 01 00 	lea    0x1b8(%rdx,%rax,1),%r14
+  804d41:	00 
+        if (env->env_id != envid || env->env_status == ENV_FREE) break;
+  804d42:	48 63 c9             	movslq %ecx,%rcx
+  804d45:	48 89 c8             	mov    %rcx,%rax
+  804d48:	48 c1 e0 04          	shl    $0x4,%rax
+  804d4c:	48 29 c8             	sub    %rcx,%rax
+  804d4f:	48 c1 e0 05          	shl    $0x5,%rax
+  804d53:	48 89 d3             	mov    %rdx,%rbx
+  804d56:	48 01 c3             	add    %rax,%rbx
+        sys_futex_wait(&env->env_wait_seq, seq, 0);
+  804d59:	49 bd 20 1b 80 00 00 	movabs $0x801b20,%r13
+  804d60:	00 00 00 
+        if (env->env_id != envid || env->env_status == ENV_FREE) break;
+  804d63:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+  804d69:	85 c0                	test   %eax,%eax
+  804d6b:	74 1c                	je     804d89 <wait+0xc1>
+        sys_futex_wait(&env->env_wait_seq, seq, 0);
+  804d6d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804d72:	4c 89 f7             	mov    %r14,%rdi
+  804d75:	41 ff d5             	call   *%r13
+        uint32_t seq = env->env_wait_seq;
+  804d78:	8b b3 b8 01 00 00    	mov    0x1b8(%rbx),%esi
+        if (env->env_id != envid || env->env_status == ENV_FREE) break;
+  804d7e:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  804d84:	44 39 e0             	cmp    %r12d,%eax
+  804d87:	74 da                	je     804d63 <wait+0x9b>
+    }
+}
+  804d89:	5b                   	pop    %rbx
+  804d8a:	41 5c                	pop    %r12
+  804d8c:	41 5d                	pop    %r13
+  804d8e:	41 5e                	pop    %r14
+  804d90:	5d                   	pop    %rbp
+  804d91:	c3                   	ret
+    assert(envid != 0);
+  804d92:	48 b9 cc 61 80 00 00 	movabs $0x8061cc,%rcx
+  804d99:	00 00 00 
+  804d9c:	48 ba 51 61 80 00 00 	movabs $0x806151,%rdx
+  804da3:	00 00 00 
+  804da6:	be 06 00 00 00       	mov    $0x6,%esi
+  804dab:	48 bf d7 61 80 00 00 	movabs $0x8061d7,%rdi
+  804db2:	00 00 00 
+  804db5:	b8 00 00 00 00       	mov    $0x0,%eax
+  804dba:	49 b8 de 07 80 00 00 	movabs $0x8007de,%r8
+  804dc1:	00 00 00 
+  804dc4:	41 ff d0             	call   *%r8
+
+0000000000804dc7 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804dc7:	48 89 f8             	mov    %rdi,%rax
+  804dca:	48 c1 e8 27          	shr    $0x27,%rax
+  804dce:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804dd5:	01 00 00 
+  804dd8:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804ddc:	f6 c2 01             	test   $0x1,%dl
+  804ddf:	74 6d                	je     804e4e <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804de1:	48 89 f8             	mov    %rdi,%rax
+  804de4:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804de8:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804def:	01 00 00 
+  804df2:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804df6:	f6 c2 01             	test   $0x1,%dl
+  804df9:	74 62                	je     804e5d <get_uvpt_entry+0x96>
+  804dfb:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804e02:	01 00 00 
+  804e05:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804e09:	f6 c2 80             	test   $0x80,%dl
+  804e0c:	75 4f                	jne    804e5d <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804e0e:	48 89 f8             	mov    %rdi,%rax
+  804e11:	48 c1 e8 15          	shr    $0x15,%rax
+  804e15:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804e1c:	01 00 00 
+  804e1f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804e23:	f6 c2 01             	test   $0x1,%dl
+  804e26:	74 44                	je     804e6c <get_uvpt_entry+0xa5>
+  804e28:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804e2f:	01 00 00 
+  804e32:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804e36:	f6 c2 80             	test   $0x80,%dl
+  804e39:	75 31                	jne    804e6c <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  804e3b:	48 c1 ef 0c          	shr    $0xc,%rdi
+  804e3f:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804e46:	01 00 00 
+  804e49:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  804e4d:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804e4e:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804e55:	01 00 00 
+  804e58:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804e5c:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804e5d:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804e64:	01 00 00 
+  804e67:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804e6b:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804e6c:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804e73:	01 00 00 
+  804e76:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804e7a:	c3                   	ret
+
+0000000000804e7b <get_prot>:
+
+int
+get_prot(void *va) {
+  804e7b:	55                   	push   %rbp
+  804e7c:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804e7f:	48 b8 c7 4d 80 00 00 	movabs $0x804dc7,%rax
+  804e86:	00 00 00 
+  804e89:	ff d0                	call   *%rax
+  804e8b:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  804e8e:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  804e93:	89 c1                	mov    %eax,%ecx
+  804e95:	83 c9 04             	or     $0x4,%ecx
+  804e98:	f6 c2 01             	test   $0x1,%dl
+  804e9b:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  804e9e:	89 c1                	mov    %eax,%ecx
+  804ea0:	83 c9 02             	or     $0x2,%ecx
+  804ea3:	f6 c2 02             	test   $0x2,%dl
+  804ea6:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  804ea9:	89 c1                	mov    %eax,%ecx
+  804eab:	83 c9 01             	or     $0x1,%ecx
+  804eae:	48 85 d2             	test   %rdx,%rdx
+  804eb1:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804eb4:	89 c1                	mov    %eax,%ecx
+  804eb6:	83 c9 40             	or     $0x40,%ecx
+  804eb9:	f6 c6 04             	test   $0x4,%dh
+  804ebc:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804ebf:	5d                   	pop    %rbp
+  804ec0:	c3                   	ret
+
+0000000000804ec1 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804ec1:	55                   	push   %rbp
+  804ec2:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804ec5:	48 b8 c7 4d 80 00 00 	movabs $0x804dc7,%rax
+  804ecc:	00 00 00 
+  804ecf:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804ed1:	48 c1 e8 06          	shr    $0x6,%rax
+  804ed5:	83 e0 01             	and    $0x1,%eax
+}
+  804ed8:	5d                   	pop    %rbp
+  804ed9:	c3                   	ret
+
+0000000000804eda <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804eda:	55                   	push   %rbp
+  804edb:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804ede:	48 b8 c7 4d 80 00 00 	movabs $0x804dc7,%rax
+  804ee5:	00 00 00 
+  804ee8:	ff d0                	call   *%rax
+  804eea:	83 e0 01             	and    $0x1,%eax
+}
+  804eed:	5d                   	pop    %rbp
+  804eee:	c3                   	ret
+
+0000000000804eef <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  804eef:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  804ef6:	01 00 00 
+  804ef9:	a8 01                	test   $0x1,%al
+  804efb:	75 06                	jne    804f03 <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  804efd:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f02:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804f03:	55                   	push   %rbp
+  804f04:	48 89 e5             	mov    %rsp,%rbp
+  804f07:	41 57                	push   %r15
+  804f09:	41 56                	push   %r14
+  804f0b:	41 55                	push   %r13
+  804f0d:	41 54                	push   %r12
+  804f0f:	53                   	push   %rbx
+  804f10:	48 83 ec 28          	sub    $0x28,%rsp
+  804f14:	49 89 fe             	mov    %rdi,%r14
+  804f17:	49 89 f7             	mov    %rsi,%r15
+  804f1a:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  804f21:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  804f22:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  804f29:	01 00 00 
+  804f2c:	e9 ae 00 00 00       	jmp    804fdf <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  804f31:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804f38:	49 83 ec 01          	sub    $0x1,%r12
+  804f3c:	74 2d                	je     804f6b <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  804f3e:	48 89 d8             	mov    %rbx,%rax
+  804f41:	48 c1 e8 0c          	shr    $0xc,%rax
+  804f45:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  804f4a:	f6 c2 01             	test   $0x1,%dl
+  804f4d:	74 e2                	je     804f31 <foreach_shared_region+0x42>
+  804f4f:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  804f54:	f6 c4 04             	test   $0x4,%ah
+  804f57:	74 d8                	je     804f31 <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  804f59:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  804f60:	4c 89 fa             	mov    %r15,%rdx
+  804f63:	48 89 df             	mov    %rbx,%rdi
+  804f66:	41 ff d6             	call   *%r14
+  804f69:	eb c6                	jmp    804f31 <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  804f6b:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  804f72:	00 
+  804f73:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  804f78:	74 4a                	je     804fc4 <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  804f7a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804f7e:	48 c1 e8 15          	shr    $0x15,%rax
+  804f82:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  804f89:	01 00 00 
+  804f8c:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804f90:	a8 01                	test   $0x1,%al
+  804f92:	74 d7                	je     804f6b <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  804f94:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  804f98:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  804f9f:	48 39 c3             	cmp    %rax,%rbx
+  804fa2:	73 c7                	jae    804f6b <foreach_shared_region+0x7c>
+  804fa4:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  804fab:	48 39 d0             	cmp    %rdx,%rax
+  804fae:	4d 19 e4             	sbb    %r12,%r12
+  804fb1:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  804fb8:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  804fbf:	e9 7a ff ff ff       	jmp    804f3e <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  804fc4:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  804fcb:	40 
+  804fcc:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804fd0:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804fd7:	00 00 00 
+  804fda:	48 39 c1             	cmp    %rax,%rcx
+  804fdd:	74 50                	je     80502f <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  804fdf:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804fe3:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804fe7:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  804fee:	01 00 00 
+  804ff1:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804ff5:	a8 01                	test   $0x1,%al
+  804ff7:	74 cb                	je     804fc4 <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  804ff9:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804ffd:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  805004:	48 39 c1             	cmp    %rax,%rcx
+  805007:	73 bb                	jae    804fc4 <foreach_shared_region+0xd5>
+  805009:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  805010:	48 39 d0             	cmp    %rdx,%rax
+  805013:	48 19 c0             	sbb    %rax,%rax
+  805016:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  80501c:	48 05 00 02 00 00    	add    $0x200,%rax
+  805022:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  805026:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80502a:	e9 4b ff ff ff       	jmp    804f7a <foreach_shared_region+0x8b>
+  80502f:	b8 00 00 00 00       	mov    $0x0,%eax
+  805034:	48 83 c4 28          	add    $0x28,%rsp
+  805038:	5b                   	pop    %rbx
+  805039:	41 5c                	pop    %r12
+  80503b:	41 5d                	pop    %r13
+  80503d:	41 5e                	pop    %r14
+  80503f:	41 5f                	pop    %r15
+  805041:	5d                   	pop    %rbp
+  805042:	c3                   	ret
+
+0000000000805043 <ring_enter>:
+    }
+}
+#endif
+
+static int
+ring_enter(void) {
+  805043:	55                   	push   %rbp
+  805044:	48 89 e5             	mov    %rsp,%rbp
+    int res;
+
+    /* Forked children inherit the ring but not its registration */
+    if (thisenv->env_sc_ring != &ring &&
+  805047:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80504e:	00 00 00 
+  805051:	48 8b 90 c0 01 00 00 	mov    0x1c0(%rax),%rdx
+  805058:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  80505f:	00 00 00 
+  805062:	48 39 c2             	cmp    %rax,%rdx
+  805065:	74 13                	je     80507a <ring_enter+0x37>
+        (res = sys_ring_register(&ring)) < 0) goto out;
+  805067:	48 89 c7             	mov    %rax,%rdi
+  80506a:	48 b8 97 1a 80 00 00 	movabs $0x801a97,%rax
+  805071:	00 00 00 
+  805074:	ff d0                	call   *%rax
+    if (thisenv->env_sc_ring != &ring &&
+  805076:	85 c0                	test   %eax,%eax
+  805078:	78 0c                	js     805086 <ring_enter+0x43>
+
+#ifdef SANITIZE_USER_SHADOW_BASE
+    uint32_t head = ring.sr_head;
+#endif
+
+    res = sys_ring_enter();
+  80507a:	48 b8 f7 1a 80 00 00 	movabs $0x801af7,%rax
+  805081:	00 00 00 
+  805084:	ff d0                	call   *%rax
+    }
+#endif
+
+out:
+    /* Calls queued after the failed one are dropped */
+    ring.sr_tail = ring.sr_head;
+  805086:	48 ba 40 10 84 00 00 	movabs $0x841040,%rdx
+  80508d:	00 00 00 
+  805090:	8b 0a                	mov    (%rdx),%ecx
+  805092:	89 4a 04             	mov    %ecx,0x4(%rdx)
+    return res;
+}
+  805095:	5d                   	pop    %rbp
+  805096:	c3                   	ret
+
+0000000000805097 <scring_push>:
+
+/* Queue system call num, the ring is submitted
+ * automatically when it is full. Errors are reported
+ * by scring_submit(), calls queued after an error are dropped */
+void
+scring_push(uintptr_t num, uintptr_t a1, uintptr_t a2, uintptr_t a3, uintptr_t a4, uintptr_t a5, uintptr_t a6) {
+  805097:	55                   	push   %rbp
+  805098:	48 89 e5             	mov    %rsp,%rbp
+  80509b:	41 57                	push   %r15
+  80509d:	41 56                	push   %r14
+  80509f:	41 55                	push   %r13
+  8050a1:	41 54                	push   %r12
+  8050a3:	53                   	push   %rbx
+  8050a4:	48 83 ec 18          	sub    $0x18,%rsp
+  8050a8:	4c 89 4d c8          	mov    %r9,-0x38(%rbp)
+    if (pending_error) return;
+  8050ac:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  8050b3:	00 00 00 
+  8050b6:	83 38 00             	cmpl   $0x0,(%rax)
+  8050b9:	75 69                	jne    805124 <scring_push+0x8d>
+  8050bb:	49 89 ff             	mov    %rdi,%r15
+  8050be:	49 89 f6             	mov    %rsi,%r14
+  8050c1:	49 89 d5             	mov    %rdx,%r13
+  8050c4:	49 89 cc             	mov    %rcx,%r12
+  8050c7:	4c 89 c3             	mov    %r8,%rbx
+    if (ring.sr_tail - ring.sr_head == SCRING_SIZE &&
+  8050ca:	48 ba 40 10 84 00 00 	movabs $0x841040,%rdx
+  8050d1:	00 00 00 
+  8050d4:	8b 42 04             	mov    0x4(%rdx),%eax
+  8050d7:	8b 12                	mov    (%rdx),%edx
+  8050d9:	29 d0                	sub    %edx,%eax
+  8050db:	83 f8 20             	cmp    $0x20,%eax
+  8050de:	74 53                	je     805133 <scring_push+0x9c>
+        (pending_error = ring_enter()) < 0) return;
+
+    struct SyscallDesc *sd = &ring.sr_desc[ring.sr_tail % SCRING_SIZE];
+  8050e0:	48 ba 40 10 84 00 00 	movabs $0x841040,%rdx
+  8050e7:	00 00 00 
+  8050ea:	8b 42 04             	mov    0x4(%rdx),%eax
+    sd->sd_num = num;
+  8050ed:	83 e0 1f             	and    $0x1f,%eax
+  8050f0:	48 c1 e0 06          	shl    $0x6,%rax
+  8050f4:	48 01 d0             	add    %rdx,%rax
+  8050f7:	4c 89 78 08          	mov    %r15,0x8(%rax)
+    sd->sd_args[0] = a1;
+  8050fb:	4c 89 70 10          	mov    %r14,0x10(%rax)
+    sd->sd_args[1] = a2;
+  8050ff:	4c 89 68 18          	mov    %r13,0x18(%rax)
+    sd->sd_args[2] = a3;
+  805103:	4c 89 60 20          	mov    %r12,0x20(%rax)
+    sd->sd_args[3] = a4;
+  805107:	48 89 58 28          	mov    %rbx,0x28(%rax)
+    sd->sd_args[4] = a5;
+  80510b:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  80510f:	48 89 58 30          	mov    %rbx,0x30(%rax)
+    sd->sd_args[5] = a6;
+  805113:	48 8b 4d 10          	mov    0x10(%rbp),%rcx
+  805117:	48 89 48 38          	mov    %rcx,0x38(%rax)
+    ring.sr_tail++;
+  80511b:	8b 42 04             	mov    0x4(%rdx),%eax
+  80511e:	83 c0 01             	add    $0x1,%eax
+  805121:	89 42 04             	mov    %eax,0x4(%rdx)
+}
+  805124:	48 83 c4 18          	add    $0x18,%rsp
+  805128:	5b                   	pop    %rbx
+  805129:	41 5c                	pop    %r12
+  80512b:	41 5d                	pop    %r13
+  80512d:	41 5e                	pop    %r14
+  80512f:	41 5f                	pop    %r15
+  805131:	5d                   	pop    %rbp
+  805132:	c3                   	ret
+        (pending_error = ring_enter()) < 0) return;
+  805133:	48 b8 43 50 80 00 00 	movabs $0x805043,%rax
+  80513a:	00 00 00 
+  80513d:	ff d0                	call   *%rax
+  80513f:	a3 00 10 84 00 00 00 	movabs %eax,0x841000
+  805146:	00 00 
+    if (ring.sr_tail - ring.sr_head == SCRING_SIZE &&
+  805148:	85 c0                	test   %eax,%eax
+  80514a:	79 94                	jns    8050e0 <scring_push+0x49>
+  80514c:	eb d6                	jmp    805124 <scring_push+0x8d>
+
+000000000080514e <scring_submit>:
+
+/* Execute all queued calls.
+ * Returns 0 on success or the error of the first failed call */
+int
+scring_submit(void) {
+    int res = pending_error;
+  80514e:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  805155:	00 00 00 
+  805158:	8b 02                	mov    (%rdx),%eax
+    pending_error = 0;
+  80515a:	c7 02 00 00 00 00    	movl   $0x0,(%rdx)
+
+    if (res < 0)
+  805160:	85 c0                	test   %eax,%eax
+  805162:	78 14                	js     805178 <scring_submit+0x2a>
+        ring.sr_tail = ring.sr_head;
+    else if (ring.sr_tail != ring.sr_head)
+  805164:	48 ba 40 10 84 00 00 	movabs $0x841040,%rdx
+  80516b:	00 00 00 
+  80516e:	8b 4a 04             	mov    0x4(%rdx),%ecx
+  805171:	8b 12                	mov    (%rdx),%edx
+  805173:	39 d1                	cmp    %edx,%ecx
+  805175:	75 11                	jne    805188 <scring_submit+0x3a>
+        res = ring_enter();
+
+    return res;
+}
+  805177:	c3                   	ret
+        ring.sr_tail = ring.sr_head;
+  805178:	48 ba 40 10 84 00 00 	movabs $0x841040,%rdx
+  80517f:	00 00 00 
+  805182:	8b 0a                	mov    (%rdx),%ecx
+  805184:	89 4a 04             	mov    %ecx,0x4(%rdx)
+  805187:	c3                   	ret
+scring_submit(void) {
+  805188:	55                   	push   %rbp
+  805189:	48 89 e5             	mov    %rsp,%rbp
+        res = ring_enter();
+  80518c:	48 b8 43 50 80 00 00 	movabs $0x805043,%rax
+  805193:	00 00 00 
+  805196:	ff d0                	call   *%rax
+}
+  805198:	5d                   	pop    %rbp
+  805199:	c3                   	ret
+
+000000000080519a <scring_discard>:
+
+/* Drop all queued calls without executing them,
+ * along with an error scring_submit() would report */
+void
+scring_discard(void) {
+    pending_error = 0;
+  80519a:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  8051a1:	00 00 00 
+  8051a4:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    ring.sr_tail = ring.sr_head;
+  8051aa:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8051b1:	00 00 00 
+  8051b4:	8b 10                	mov    (%rax),%edx
+  8051b6:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  8051b9:	c3                   	ret
+
+00000000008051ba <scring_alloc_region>:
+
+void
+scring_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8051ba:	55                   	push   %rbp
+  8051bb:	48 89 e5             	mov    %rsp,%rbp
+  8051be:	48 89 f0             	mov    %rsi,%rax
+    scring_push(SYS_alloc_region, envid, (uintptr_t)va, size, perm, 0, 0);
+  8051c1:	48 63 f7             	movslq %edi,%rsi
+  8051c4:	48 83 ec 08          	sub    $0x8,%rsp
+  8051c8:	6a 00                	push   $0x0
+  8051ca:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8051d0:	4c 63 c1             	movslq %ecx,%r8
+  8051d3:	48 89 d1             	mov    %rdx,%rcx
+  8051d6:	48 89 c2             	mov    %rax,%rdx
+  8051d9:	bf 04 00 00 00       	mov    $0x4,%edi
+  8051de:	48 b8 97 50 80 00 00 	movabs $0x805097,%rax
+  8051e5:	00 00 00 
+  8051e8:	ff d0                	call   *%rax
+}
+  8051ea:	48 83 c4 10          	add    $0x10,%rsp
+  8051ee:	c9                   	leave
+  8051ef:	c3                   	ret
+
+00000000008051f0 <scring_map_region>:
+
+void
+scring_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8051f0:	55                   	push   %rbp
+  8051f1:	48 89 e5             	mov    %rsp,%rbp
+  8051f4:	48 89 f0             	mov    %rsi,%rax
+  8051f7:	49 89 ca             	mov    %rcx,%r10
+    scring_push(SYS_map_region, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8051fa:	48 63 ca             	movslq %edx,%rcx
+  8051fd:	48 63 f7             	movslq %edi,%rsi
+  805200:	48 83 ec 08          	sub    $0x8,%rsp
+  805204:	4d 63 c9             	movslq %r9d,%r9
+  805207:	41 51                	push   %r9
+  805209:	4d 89 c1             	mov    %r8,%r9
+  80520c:	4d 89 d0             	mov    %r10,%r8
+  80520f:	48 89 c2             	mov    %rax,%rdx
+  805212:	bf 05 00 00 00       	mov    $0x5,%edi
+  805217:	48 b8 97 50 80 00 00 	movabs $0x805097,%rax
+  80521e:	00 00 00 
+  805221:	ff d0                	call   *%rax
+}
+  805223:	48 83 c4 10          	add    $0x10,%rsp
+  805227:	c9                   	leave
+  805228:	c3                   	ret
+
+0000000000805229 <scring_unmap_region>:
+
+void
+scring_unmap_region(envid_t envid, void *va, size_t size) {
+  805229:	55                   	push   %rbp
+  80522a:	48 89 e5             	mov    %rsp,%rbp
+  80522d:	48 89 f0             	mov    %rsi,%rax
+  805230:	48 89 d1             	mov    %rdx,%rcx
+    scring_push(SYS_unmap_region, envid, (uintptr_t)va, size, 0, 0, 0);
+  805233:	48 63 f7             	movslq %edi,%rsi
+  805236:	48 83 ec 08          	sub    $0x8,%rsp
+  80523a:	6a 00                	push   $0x0
+  80523c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  805242:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  805248:	48 89 c2             	mov    %rax,%rdx
+  80524b:	bf 06 00 00 00       	mov    $0x6,%edi
+  805250:	48 b8 97 50 80 00 00 	movabs $0x805097,%rax
+  805257:	00 00 00 
+  80525a:	ff d0                	call   *%rax
+}
+  80525c:	48 83 c4 10          	add    $0x10,%rsp
+  805260:	c9                   	leave
+  805261:	c3                   	ret
+
+0000000000805262 <scring_env_set_status>:
+
+void
+scring_env_set_status(envid_t envid, int status) {
+  805262:	55                   	push   %rbp
+  805263:	48 89 e5             	mov    %rsp,%rbp
+    scring_push(SYS_env_set_status, envid, status, 0, 0, 0, 0);
+  805266:	48 63 d6             	movslq %esi,%rdx
+  805269:	48 63 f7             	movslq %edi,%rsi
+  80526c:	48 83 ec 08          	sub    $0x8,%rsp
+  805270:	6a 00                	push   $0x0
+  805272:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  805278:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80527e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805283:	bf 09 00 00 00       	mov    $0x9,%edi
+  805288:	48 b8 97 50 80 00 00 	movabs $0x805097,%rax
+  80528f:	00 00 00 
+  805292:	ff d0                	call   *%rax
+}
+  805294:	48 83 c4 10          	add    $0x10,%rsp
+  805298:	c9                   	leave
+  805299:	c3                   	ret
+
+000000000080529a <scring_env_set_trapframe>:
+
+void
+scring_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80529a:	55                   	push   %rbp
+  80529b:	48 89 e5             	mov    %rsp,%rbp
+  80529e:	48 89 f2             	mov    %rsi,%rdx
+    scring_push(SYS_env_set_trapframe, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8052a1:	48 63 f7             	movslq %edi,%rsi
+  8052a4:	48 83 ec 08          	sub    $0x8,%rsp
+  8052a8:	6a 00                	push   $0x0
+  8052aa:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8052b0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8052b6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8052bb:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8052c0:	48 b8 97 50 80 00 00 	movabs $0x805097,%rax
+  8052c7:	00 00 00 
+  8052ca:	ff d0                	call   *%rax
+}
+  8052cc:	48 83 c4 10          	add    $0x10,%rsp
+  8052d0:	c9                   	leave
+  8052d1:	c3                   	ret
+
+00000000008052d2 <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  8052d2:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  8052d8:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  8052df:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  8052e6:	c3                   	ret
+
+00000000008052e7 <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  8052e7:	8b 47 40             	mov    0x40(%rdi),%eax
+  8052ea:	8b 17                	mov    (%rdi),%edx
+  8052ec:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  8052ee:	83 f8 0f             	cmp    $0xf,%eax
+  8052f1:	77 13                	ja     805306 <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  8052f3:	8b 47 40             	mov    0x40(%rdi),%eax
+  8052f6:	83 e0 0f             	and    $0xf,%eax
+  8052f9:	48 c1 e0 09          	shl    $0x9,%rax
+  8052fd:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  805304:	00 
+  805305:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  805306:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80530b:	c3                   	ret
+
+000000000080530c <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  80530c:	8b 47 40             	mov    0x40(%rdi),%eax
+  80530f:	83 c0 01             	add    $0x1,%eax
+  805312:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  805315:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  80531b:	8b 57 04             	mov    0x4(%rdi),%edx
+  80531e:	b8 00 00 00 00       	mov    $0x0,%eax
+  805323:	85 d2                	test   %edx,%edx
+  805325:	75 04                	jne    80532b <chan_publish+0x1f>
+  805327:	83 e0 01             	and    $0x1,%eax
+}
+  80532a:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  80532b:	87 47 04             	xchg   %eax,0x4(%rdi)
+  80532e:	85 c0                	test   %eax,%eax
+  805330:	0f 95 c0             	setne  %al
+  805333:	0f b6 c0             	movzbl %al,%eax
+  805336:	eb ef                	jmp    805327 <chan_publish+0x1b>
+
+0000000000805338 <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  805338:	8b 47 40             	mov    0x40(%rdi),%eax
+  80533b:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  80533d:	29 d0                	sub    %edx,%eax
+  80533f:	83 e8 01             	sub    $0x1,%eax
+  805342:	83 f8 0f             	cmp    $0xf,%eax
+  805345:	77 12                	ja     805359 <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  805347:	8b 07                	mov    (%rdi),%eax
+  805349:	83 e0 0f             	and    $0xf,%eax
+  80534c:	48 c1 e0 09          	shl    $0x9,%rax
+  805350:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  805357:	00 
+  805358:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  805359:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80535e:	c3                   	ret
+
+000000000080535f <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  80535f:	8b 07                	mov    (%rdi),%eax
+  805361:	83 c0 01             	add    $0x1,%eax
+  805364:	89 07                	mov    %eax,(%rdi)
+}
+  805366:	c3                   	ret
+
+0000000000805367 <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  805367:	55                   	push   %rbp
+  805368:	48 89 e5             	mov    %rsp,%rbp
+  80536b:	53                   	push   %rbx
+  80536c:	48 83 ec 08          	sub    $0x8,%rsp
+  805370:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  805373:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  80537a:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  805380:	48 b8 38 53 80 00 00 	movabs $0x805338,%rax
+  805387:	00 00 00 
+  80538a:	ff d0                	call   *%rax
+  80538c:	48 85 c0             	test   %rax,%rax
+  80538f:	74 12                	je     8053a3 <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  805391:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  805398:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80539d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8053a1:	c9                   	leave
+  8053a2:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  8053a3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8053a8:	eb f3                	jmp    80539d <chan_arm+0x36>
+
+00000000008053aa <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  8053aa:	55                   	push   %rbp
+  8053ab:	48 89 e5             	mov    %rsp,%rbp
+  8053ae:	41 56                	push   %r14
+  8053b0:	41 55                	push   %r13
+  8053b2:	41 54                	push   %r12
+  8053b4:	53                   	push   %rbx
+  8053b5:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  8053b8:	49 bc 67 53 80 00 00 	movabs $0x805367,%r12
+  8053bf:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  8053c2:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  8053c6:	49 bd 20 1b 80 00 00 	movabs $0x801b20,%r13
+  8053cd:	00 00 00 
+    while (chan_arm(r))
+  8053d0:	eb 0d                	jmp    8053df <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  8053d2:	8b 33                	mov    (%rbx),%esi
+  8053d4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8053d9:	4c 89 f7             	mov    %r14,%rdi
+  8053dc:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  8053df:	48 89 df             	mov    %rbx,%rdi
+  8053e2:	41 ff d4             	call   *%r12
+  8053e5:	84 c0                	test   %al,%al
+  8053e7:	75 e9                	jne    8053d2 <chan_wait+0x28>
+}
+  8053e9:	5b                   	pop    %rbx
+  8053ea:	41 5c                	pop    %r12
+  8053ec:	41 5d                	pop    %r13
+  8053ee:	41 5e                	pop    %r14
+  8053f0:	5d                   	pop    %rbp
+  8053f1:	c3                   	ret
+
+00000000008053f2 <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  8053f2:	55                   	push   %rbp
+  8053f3:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  8053f6:	48 83 c7 40          	add    $0x40,%rdi
+  8053fa:	be 01 00 00 00       	mov    $0x1,%esi
+  8053ff:	48 b8 3e 1b 80 00 00 	movabs $0x801b3e,%rax
+  805406:	00 00 00 
+  805409:	ff d0                	call   *%rax
+}
+  80540b:	5d                   	pop    %rbp
+  80540c:	c3                   	ret
+
+000000000080540d <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  80540d:	55                   	push   %rbp
+  80540e:	48 89 e5             	mov    %rsp,%rbp
+  805411:	41 56                	push   %r14
+  805413:	41 55                	push   %r13
+  805415:	41 54                	push   %r12
+  805417:	53                   	push   %rbx
+  805418:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80541b:	48 b8 a8 18 84 00 00 	movabs $0x8418a8,%rax
+  805422:	00 00 00 
+  805425:	48 83 38 00          	cmpq   $0x0,(%rax)
+  805429:	74 27                	je     805452 <_handle_vectored_pagefault+0x45>
+  80542b:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  805430:	49 bd 60 18 84 00 00 	movabs $0x841860,%r13
+  805437:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80543a:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  80543d:	4c 89 e7             	mov    %r12,%rdi
+  805440:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  805445:	84 c0                	test   %al,%al
+  805447:	75 45                	jne    80548e <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805449:	48 83 c3 01          	add    $0x1,%rbx
+  80544d:	49 3b 1e             	cmp    (%r14),%rbx
+  805450:	72 eb                	jb     80543d <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  805452:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  805459:	00 
+  80545a:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  80545f:	4d 8b 04 24          	mov    (%r12),%r8
+  805463:	48 ba e8 61 80 00 00 	movabs $0x8061e8,%rdx
+  80546a:	00 00 00 
+  80546d:	be 1d 00 00 00       	mov    $0x1d,%esi
+  805472:	48 bf 18 62 80 00 00 	movabs $0x806218,%rdi
+  805479:	00 00 00 
+  80547c:	b8 00 00 00 00       	mov    $0x0,%eax
+  805481:	49 ba de 07 80 00 00 	movabs $0x8007de,%r10
+  805488:	00 00 00 
+  80548b:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  80548e:	5b                   	pop    %rbx
+  80548f:	41 5c                	pop    %r12
+  805491:	41 5d                	pop    %r13
+  805493:	41 5e                	pop    %r14
+  805495:	5d                   	pop    %rbp
+  805496:	c3                   	ret
+
+0000000000805497 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  805497:	55                   	push   %rbp
+  805498:	48 89 e5             	mov    %rsp,%rbp
+  80549b:	53                   	push   %rbx
+  80549c:	48 83 ec 08          	sub    $0x8,%rsp
+  8054a0:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  8054a3:	48 b8 a0 18 84 00 00 	movabs $0x8418a0,%rax
+  8054aa:	00 00 00 
+  8054ad:	80 38 00             	cmpb   $0x0,(%rax)
+  8054b0:	0f 84 84 00 00 00    	je     80553a <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8054b6:	48 b8 a8 18 84 00 00 	movabs $0x8418a8,%rax
+  8054bd:	00 00 00 
+  8054c0:	48 8b 10             	mov    (%rax),%rdx
+  8054c3:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  8054c8:	48 b9 60 18 84 00 00 	movabs $0x841860,%rcx
+  8054cf:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8054d2:	48 85 d2             	test   %rdx,%rdx
+  8054d5:	74 19                	je     8054f0 <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  8054d7:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  8054db:	0f 84 e8 00 00 00    	je     8055c9 <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8054e1:	48 83 c0 01          	add    $0x1,%rax
+  8054e5:	48 39 d0             	cmp    %rdx,%rax
+  8054e8:	75 ed                	jne    8054d7 <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  8054ea:	48 83 fa 08          	cmp    $0x8,%rdx
+  8054ee:	74 1c                	je     80550c <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8054f0:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8054f4:	48 a3 a8 18 84 00 00 	movabs %rax,0x8418a8
+  8054fb:	00 00 00 
+  8054fe:	48 b8 60 18 84 00 00 	movabs $0x841860,%rax
+  805505:	00 00 00 
+  805508:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  80550c:	48 b8 25 17 80 00 00 	movabs $0x801725,%rax
+  805513:	00 00 00 
+  805516:	ff d0                	call   *%rax
+  805518:	89 c7                	mov    %eax,%edi
+  80551a:	48 be 8f 56 80 00 00 	movabs $0x80568f,%rsi
+  805521:	00 00 00 
+  805524:	48 b8 70 19 80 00 00 	movabs $0x801970,%rax
+  80552b:	00 00 00 
+  80552e:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805530:	85 c0                	test   %eax,%eax
+  805532:	78 68                	js     80559c <add_pgfault_handler+0x105>
+    return res;
+}
+  805534:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  805538:	c9                   	leave
+  805539:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  80553a:	48 b8 25 17 80 00 00 	movabs $0x801725,%rax
+  805541:	00 00 00 
+  805544:	ff d0                	call   *%rax
+  805546:	89 c7                	mov    %eax,%edi
+  805548:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80554d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805552:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  805559:	00 00 00 
+  80555c:	48 b8 b2 17 80 00 00 	movabs $0x8017b2,%rax
+  805563:	00 00 00 
+  805566:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  805568:	48 ba a8 18 84 00 00 	movabs $0x8418a8,%rdx
+  80556f:	00 00 00 
+  805572:	48 8b 02             	mov    (%rdx),%rax
+  805575:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  805579:	48 89 0a             	mov    %rcx,(%rdx)
+  80557c:	48 ba 60 18 84 00 00 	movabs $0x841860,%rdx
+  805583:	00 00 00 
+  805586:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  80558a:	48 b8 a0 18 84 00 00 	movabs $0x8418a0,%rax
+  805591:	00 00 00 
+  805594:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  805597:	e9 70 ff ff ff       	jmp    80550c <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80559c:	89 c1                	mov    %eax,%ecx
+  80559e:	48 ba 26 62 80 00 00 	movabs $0x806226,%rdx
+  8055a5:	00 00 00 
+  8055a8:	be 3d 00 00 00       	mov    $0x3d,%esi
+  8055ad:	48 bf 18 62 80 00 00 	movabs $0x806218,%rdi
+  8055b4:	00 00 00 
+  8055b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8055bc:	49 b8 de 07 80 00 00 	movabs $0x8007de,%r8
+  8055c3:	00 00 00 
+  8055c6:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8055c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8055ce:	e9 61 ff ff ff       	jmp    805534 <add_pgfault_handler+0x9d>
+
+00000000008055d3 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  8055d3:	55                   	push   %rbp
+  8055d4:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  8055d7:	48 b8 a0 18 84 00 00 	movabs $0x8418a0,%rax
+  8055de:	00 00 00 
+  8055e1:	80 38 00             	cmpb   $0x0,(%rax)
+  8055e4:	74 33                	je     805619 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8055e6:	48 a1 a8 18 84 00 00 	movabs 0x8418a8,%rax
+  8055ed:	00 00 00 
+  8055f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  8055f5:	48 ba 60 18 84 00 00 	movabs $0x841860,%rdx
+  8055fc:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8055ff:	48 85 c0             	test   %rax,%rax
+  805602:	0f 84 85 00 00 00    	je     80568d <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  805608:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  80560c:	74 40                	je     80564e <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80560e:	48 83 c1 01          	add    $0x1,%rcx
+  805612:	48 39 c1             	cmp    %rax,%rcx
+  805615:	75 f1                	jne    805608 <remove_pgfault_handler+0x35>
+  805617:	eb 74                	jmp    80568d <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  805619:	48 b9 3e 62 80 00 00 	movabs $0x80623e,%rcx
+  805620:	00 00 00 
+  805623:	48 ba 51 61 80 00 00 	movabs $0x806151,%rdx
+  80562a:	00 00 00 
+  80562d:	be 43 00 00 00       	mov    $0x43,%esi
+  805632:	48 bf 18 62 80 00 00 	movabs $0x806218,%rdi
+  805639:	00 00 00 
+  80563c:	b8 00 00 00 00       	mov    $0x0,%eax
+  805641:	49 b8 de 07 80 00 00 	movabs $0x8007de,%r8
+  805648:	00 00 00 
+  80564b:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  80564e:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  805655:	00 
+  805656:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80565a:	48 29 ca             	sub    %rcx,%rdx
+  80565d:	48 b8 60 18 84 00 00 	movabs $0x841860,%rax
+  805664:	00 00 00 
+  805667:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  80566b:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  805670:	48 89 ce             	mov    %rcx,%rsi
+  805673:	48 b8 4d 14 80 00 00 	movabs $0x80144d,%rax
+  80567a:	00 00 00 
+  80567d:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  80567f:	48 b8 a8 18 84 00 00 	movabs $0x8418a8,%rax
+  805686:	00 00 00 
+  805689:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  80568d:	5d                   	pop    %rbp
+  80568e:	c3                   	ret
+
+000000000080568f <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  80568f:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  805692:	48 b8 0d 54 80 00 00 	movabs $0x80540d,%rax
+  805699:	00 00 00 
+    call *%rax
+  80569c:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  80569e:	41 5f                	pop    %r15
+	popq %r15
+  8056a0:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  8056a2:	41 5f                	pop    %r15
+	popq %r14
+  8056a4:	41 5e                	pop    %r14
+	popq %r13
+  8056a6:	41 5d                	pop    %r13
+	popq %r12
+  8056a8:	41 5c                	pop    %r12
+	popq %r11
+  8056aa:	41 5b                	pop    %r11
+	popq %r10
+  8056ac:	41 5a                	pop    %r10
+	popq %r9
+  8056ae:	41 59                	pop    %r9
+	popq %r8
+  8056b0:	41 58                	pop    %r8
+	popq %rsi
+  8056b2:	5e                   	pop    %rsi
+	popq %rdi
+  8056b3:	5f                   	pop    %rdi
+	popq %rbp
+  8056b4:	5d                   	pop    %rbp
+	popq %rdx
+  8056b5:	5a                   	pop    %rdx
+	popq %rcx
+  8056b6:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  8056b7:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  8056bc:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  8056c1:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  8056c5:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  8056c8:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  8056cd:	5b                   	pop    %rbx
+	popq %rax
+  8056ce:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  8056cf:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  8056d3:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  8056d4:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  8056d9:	c3                   	ret
+
+00000000008056da <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8056da:	55                   	push   %rbp
+  8056db:	48 89 e5             	mov    %rsp,%rbp
+  8056de:	41 55                	push   %r13
+  8056e0:	41 54                	push   %r12
+  8056e2:	53                   	push   %rbx
+  8056e3:	48 83 ec 08          	sub    $0x8,%rsp
+  8056e7:	49 89 fd             	mov    %rdi,%r13
+  8056ea:	48 89 f7             	mov    %rsi,%rdi
+  8056ed:	48 89 d3             	mov    %rdx,%rbx
+  8056f0:	49 89 cc             	mov    %rcx,%r12
+  8056f3:	4c 89 c2             	mov    %r8,%rdx
+  8056f6:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8056f9:	48 85 f6             	test   %rsi,%rsi
+  8056fc:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805703:	00 00 00 
+  805706:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  80570a:	be 00 10 00 00       	mov    $0x1000,%esi
+  80570f:	48 85 db             	test   %rbx,%rbx
+  805712:	74 03                	je     805717 <ipc_recv_futex+0x3d>
+  805714:	48 8b 33             	mov    (%rbx),%rsi
+  805717:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  80571b:	48 b8 fc 19 80 00 00 	movabs $0x8019fc,%rax
+  805722:	00 00 00 
+  805725:	ff d0                	call   *%rax
+    if (res < 0) {
+  805727:	85 c0                	test   %eax,%eax
+  805729:	78 75                	js     8057a0 <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  80572b:	4d 85 ed             	test   %r13,%r13
+  80572e:	74 14                	je     805744 <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  805730:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  805737:	00 00 00 
+  80573a:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  805740:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  805744:	4d 85 e4             	test   %r12,%r12
+  805747:	74 14                	je     80575d <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  805749:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  805750:	00 00 00 
+  805753:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  805759:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  80575d:	48 85 db             	test   %rbx,%rbx
+  805760:	74 23                	je     805785 <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  805762:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  805769:	00 00 00 
+  80576c:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  805772:	ba 00 00 00 00       	mov    $0x0,%edx
+  805777:	85 c9                	test   %ecx,%ecx
+  805779:	74 07                	je     805782 <ipc_recv_futex+0xa8>
+  80577b:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  805782:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  805785:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80578c:	00 00 00 
+  80578f:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  805795:	48 83 c4 08          	add    $0x8,%rsp
+  805799:	5b                   	pop    %rbx
+  80579a:	41 5c                	pop    %r12
+  80579c:	41 5d                	pop    %r13
+  80579e:	5d                   	pop    %rbp
+  80579f:	c3                   	ret
+        if (from_env_store != NULL) {
+  8057a0:	4d 85 ed             	test   %r13,%r13
+  8057a3:	74 08                	je     8057ad <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  8057a5:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8057ac:	00 
+        if (perm_store != NULL) {
+  8057ad:	4d 85 e4             	test   %r12,%r12
+  8057b0:	74 08                	je     8057ba <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  8057b2:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8057b9:	00 
+        if (size != NULL) {
+  8057ba:	48 85 db             	test   %rbx,%rbx
+  8057bd:	74 d6                	je     805795 <ipc_recv_futex+0xbb>
+            *size = 0;
+  8057bf:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  8057c6:	eb cd                	jmp    805795 <ipc_recv_futex+0xbb>
+
+00000000008057c8 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8057c8:	55                   	push   %rbp
+  8057c9:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  8057cc:	48 83 ec 08          	sub    $0x8,%rsp
+  8057d0:	6a 00                	push   $0x0
+  8057d2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8057d8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8057de:	48 b8 da 56 80 00 00 	movabs $0x8056da,%rax
+  8057e5:	00 00 00 
+  8057e8:	ff d0                	call   *%rax
+}
+  8057ea:	c9                   	leave
+  8057eb:	c3                   	ret
+
+00000000008057ec <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8057ec:	55                   	push   %rbp
+  8057ed:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8057f0:	48 85 d2             	test   %rdx,%rdx
+  8057f3:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8057fa:	00 00 00 
+  8057fd:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  805801:	89 f6                	mov    %esi,%esi
+  805803:	48 b8 e5 19 80 00 00 	movabs $0x8019e5,%rax
+  80580a:	00 00 00 
+  80580d:	ff d0                	call   *%rax
+    if (res < 0) {
+  80580f:	85 c0                	test   %eax,%eax
+  805811:	78 02                	js     805815 <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  805813:	5d                   	pop    %rbp
+  805814:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  805815:	89 c1                	mov    %eax,%ecx
+  805817:	48 ba 58 62 80 00 00 	movabs $0x806258,%rdx
+  80581e:	00 00 00 
+  805821:	be 50 00 00 00       	mov    $0x50,%esi
+  805826:	48 bf 6c 62 80 00 00 	movabs $0x80626c,%rdi
+  80582d:	00 00 00 
+  805830:	b8 00 00 00 00       	mov    $0x0,%eax
+  805835:	49 b8 de 07 80 00 00 	movabs $0x8007de,%r8
+  80583c:	00 00 00 
+  80583f:	41 ff d0             	call   *%r8
+
+0000000000805842 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  805842:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  805847:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80584e:	00 00 00 
+  805851:	48 89 d0             	mov    %rdx,%rax
+  805854:	48 c1 e0 04          	shl    $0x4,%rax
+  805858:	48 29 d0             	sub    %rdx,%rax
+  80585b:	48 c1 e0 05          	shl    $0x5,%rax
+  80585f:	48 01 c8             	add    %rcx,%rax
+  805862:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  805868:	39 f8                	cmp    %edi,%eax
+  80586a:	74 13                	je     80587f <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  80586c:	48 83 c2 01          	add    $0x1,%rdx
+  805870:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  805877:	75 d8                	jne    805851 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  805879:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80587e:	c3                   	ret
+            return envs[i].env_id;
+  80587f:	48 89 d0             	mov    %rdx,%rax
+  805882:	48 c1 e0 04          	shl    $0x4,%rax
+  805886:	48 29 d0             	sub    %rdx,%rax
+  805889:	48 c1 e0 05          	shl    $0x5,%rax
+  80588d:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  805894:	00 00 00 
+  805897:	48 01 d0             	add    %rdx,%rax
+  80589a:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8058a0:	c3                   	ret
+  8058a1:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000008058a8 <__rodata_start>:
+  8058a8:	73 68                	jae    805912 <__rodata_start+0x6a>
+  8058aa:	65 6c                	gs insb (%dx),%es:(%rdi)
+  8058ac:	6c                   	insb   (%dx),%es:(%rdi)
+  8058ad:	20 70 72             	and    %dh,0x72(%rax)
+  8058b0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8058b1:	64 75 63             	fs jne 805917 <__rodata_start+0x6f>
+  8058b4:	65 64 20 69 6e       	gs and %ch,%fs:0x6e(%rcx)
+  8058b9:	63 6f 72             	movsxd 0x72(%rdi),%ebp
+  8058bc:	72 65                	jb     805923 <__rodata_start+0x7b>
+  8058be:	63 74 20 6f          	movsxd 0x6f(%rax,%riz,1),%esi
+  8058c2:	75 74                	jne    805938 <__rodata_start+0x90>
+  8058c4:	70 75                	jo     80593b <__rodata_start+0x93>
+  8058c6:	74 2e                	je     8058f6 <__rodata_start+0x4e>
+  8058c8:	0a 00                	or     (%rax),%al
+  8058ca:	00 00                	add    %al,(%rax)
+  8058cc:	00 00                	add    %al,(%rax)
+  8058ce:	00 00                	add    %al,(%rax)
+  8058d0:	72 75                	jb     805947 <__rodata_start+0x9f>
+  8058d2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8058d3:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8058d4:	69 6e 67 20 73 68 20 	imul   $0x20687320,0x67(%rsi),%ebp
+  8058db:	2d 78 20 3c 20       	sub    $0x203c2078,%eax
+  8058e0:	74 65                	je     805947 <__rodata_start+0x9f>
+  8058e2:	73 74                	jae    805958 <__rodata_start+0xb0>
+  8058e4:	73 68                	jae    80594e <__rodata_start+0xa6>
+  8058e6:	65 6c                	gs insb (%dx),%es:(%rdi)
+  8058e8:	6c                   	insb   (%dx),%es:(%rdi)
+  8058e9:	2e 73 68             	jae,pn 805954 <__rodata_start+0xac>
+  8058ec:	20 7c 20 63          	and    %bh,0x63(%rax,%riz,1)
+  8058f0:	61                   	(bad)
+  8058f1:	74 0a                	je     8058fd <__rodata_start+0x55>
+  8058f3:	00 00                	add    %al,(%rax)
+  8058f5:	00 00                	add    %al,(%rax)
+  8058f7:	00 6f 70             	add    %ch,0x70(%rdi)
+  8058fa:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8058fc:	20 74 65 73          	and    %dh,0x73(%rbp,%riz,2)
+  805900:	74 73                	je     805975 <__rodata_start+0xcd>
+  805902:	68 65 6c 6c 2e       	push   $0x2e6c6c65
+  805907:	6b 65 79 20          	imul   $0x20,0x79(%rbp),%esp
+  80590b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80590d:	72 20                	jb     80592f <__rodata_start+0x87>
+  80590f:	72 65                	jb     805976 <__rodata_start+0xce>
+  805911:	61                   	(bad)
+  805912:	64 69 6e 67 3a 20 25 	imul   $0x6925203a,%fs:0x67(%rsi),%ebp
+  805919:	69 
+  80591a:	00 65 78             	add    %ah,0x78(%rbp)
+  80591d:	70 65                	jo     805984 <__rodata_start+0xdc>
+  80591f:	63 74 65 64          	movsxd 0x64(%rbp,%riz,2),%esi
+  805923:	3a 0a                	cmp    (%rdx),%cl
+  805925:	3d 3d 3d 0a 25       	cmp    $0x250a3d3d,%eax
+  80592a:	63 00                	movsxd (%rax),%eax
+  80592c:	3d 3d 3d 0a 67       	cmp    $0x670a3d3d,%eax
+  805931:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805932:	74 3a                	je     80596e <__rodata_start+0xc6>
+  805934:	0a 3d 3d 3d 0a 25    	or     0x250a3d3d(%rip),%bh        # 258a9677 <__bss_end+0x25067677>
+  80593a:	63 00                	movsxd (%rax),%eax
+  80593c:	3d 3d 3d 0a 00       	cmp    $0xa3d3d,%eax
+  805941:	74 65                	je     8059a8 <__rodata_start+0x100>
+  805943:	73 74                	jae    8059b9 <__rodata_start+0x111>
+  805945:	73 68                	jae    8059af <__rodata_start+0x107>
+  805947:	65 6c                	gs insb (%dx),%es:(%rdi)
+  805949:	6c                   	insb   (%dx),%es:(%rdi)
+  80594a:	2e 73 68             	jae,pn 8059b5 <__rodata_start+0x10d>
+  80594d:	00 6f 70             	add    %ch,0x70(%rdi)
+  805950:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  805952:	20 74 65 73          	and    %dh,0x73(%rbp,%riz,2)
+  805956:	74 73                	je     8059cb <__rodata_start+0x123>
+  805958:	68 65 6c 6c 2e       	push   $0x2e6c6c65
+  80595d:	73 68                	jae    8059c7 <__rodata_start+0x11f>
+  80595f:	3a 20                	cmp    (%rax),%ah
+  805961:	25 69 00 75 73       	and    $0x73750069,%eax
+  805966:	65 72 2f             	gs jb  805998 <__rodata_start+0xf0>
+  805969:	74 65                	je     8059d0 <__rodata_start+0x128>
+  80596b:	73 74                	jae    8059e1 <__rodata_start+0x139>
+  80596d:	73 68                	jae    8059d7 <__rodata_start+0x12f>
+  80596f:	65 6c                	gs insb (%dx),%es:(%rdi)
+  805971:	6c                   	insb   (%dx),%es:(%rdi)
+  805972:	2e 63 00             	cs movsxd (%rax),%eax
+  805975:	70 69                	jo     8059e0 <__rodata_start+0x138>
+  805977:	70 65                	jo     8059de <__rodata_start+0x136>
+  805979:	3a 20                	cmp    (%rax),%ah
+  80597b:	25 69 00 66 6f       	and    $0x6f660069,%eax
+  805980:	72 6b                	jb     8059ed <__rodata_start+0x145>
+  805982:	3a 20                	cmp    (%rax),%ah
+  805984:	25 69 00 2d 78       	and    $0x782d0069,%eax
+  805989:	00 2f                	add    %ch,(%rdi)
+  80598b:	73 68                	jae    8059f5 <__rodata_start+0x14d>
+  80598d:	00 73 70             	add    %dh,0x70(%rbx)
+  805990:	61                   	(bad)
+  805991:	77 6e                	ja     805a01 <__rodata_start+0x159>
+  805993:	3a 20                	cmp    (%rax),%ah
+  805995:	25 69 00 74 65       	and    $0x65740069,%eax
+  80599a:	73 74                	jae    805a10 <__rodata_start+0x168>
+  80599c:	73 68                	jae    805a06 <__rodata_start+0x15e>
+  80599e:	65 6c                	gs insb (%dx),%es:(%rdi)
+  8059a0:	6c                   	insb   (%dx),%es:(%rdi)
+  8059a1:	2e 6b 65 79 00       	cs imul $0x0,0x79(%rbp),%esp
+  8059a6:	72 65                	jb     805a0d <__rodata_start+0x165>
+  8059a8:	61                   	(bad)
+  8059a9:	64 69 6e 67 20 74 65 	imul   $0x73657420,%fs:0x67(%rsi),%ebp
+  8059b0:	73 
+  8059b1:	74 73                	je     805a26 <__rodata_start+0x17e>
+  8059b3:	68 65 6c 6c 2e       	push   $0x2e6c6c65
+  8059b8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8059b9:	75 74                	jne    805a2f <__rodata_start+0x187>
+  8059bb:	3a 20                	cmp    (%rax),%ah
+  8059bd:	25 69 00 72 65       	and    $0x65720069,%eax
+  8059c2:	61                   	(bad)
+  8059c3:	64 69 6e 67 20 74 65 	imul   $0x73657420,%fs:0x67(%rsi),%ebp
+  8059ca:	73 
+  8059cb:	74 73                	je     805a40 <__rodata_start+0x198>
+  8059cd:	68 65 6c 6c 2e       	push   $0x2e6c6c65
+  8059d2:	6b 65 79 3a          	imul   $0x3a,0x79(%rbp),%esp
+  8059d6:	20 25 69 00 73 68    	and    %ah,0x68730069(%rip)        # 68f35a45 <__bss_end+0x686f3a45>
+  8059dc:	65 6c                	gs insb (%dx),%es:(%rdi)
+  8059de:	6c                   	insb   (%dx),%es:(%rdi)
+  8059df:	20 72 61             	and    %dh,0x61(%rdx)
+  8059e2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8059e3:	20 63 6f             	and    %ah,0x6f(%rbx)
+  8059e6:	72 72                	jb     805a5a <__rodata_start+0x1b2>
+  8059e8:	65 63 74 6c 79       	movsxd %gs:0x79(%rsp,%rbp,2),%esi
+  8059ed:	0a 00                	or     (%rax),%al
+  8059ef:	3c 63                	cmp    $0x63,%al
+  8059f1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8059f2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8059f3:	73 3e                	jae    805a33 <__rodata_start+0x18b>
+  8059f5:	00 63 6f             	add    %ah,0x6f(%rbx)
+  8059f8:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8059f9:	73 00                	jae    8059fb <__rodata_start+0x153>
+  8059fb:	3c 75                	cmp    $0x75,%al
+  8059fd:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8059fe:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  805a02:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805a03:	3e 00 0f             	ds add %cl,(%rdi)
+  805a06:	1f                   	(bad)
+  805a07:	00 5b 25             	add    %bl,0x25(%rbx)
+  805a0a:	30 38                	xor    %bh,(%rax)
+  805a0c:	78 5d                	js     805a6b <__rodata_start+0x1c3>
+  805a0e:	20 75 73             	and    %dh,0x73(%rbp)
+  805a11:	65 72 20             	gs jb  805a34 <__rodata_start+0x18c>
+  805a14:	70 61                	jo     805a77 <__rodata_start+0x1cf>
+  805a16:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805a17:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  805a1e:	73 20                	jae    805a40 <__rodata_start+0x198>
+  805a20:	61                   	(bad)
+  805a21:	74 20                	je     805a43 <__rodata_start+0x19b>
+  805a23:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  805a28:	3a 20                	cmp    (%rax),%ah
+  805a2a:	00 30                	add    %dh,(%rax)
+  805a2c:	31 32                	xor    %esi,(%rdx)
+  805a2e:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  805a35:	41                   	rex.B
+  805a36:	42                   	rex.X
+  805a37:	43                   	rex.XB
+  805a38:	44                   	rex.R
+  805a39:	45                   	rex.RB
+  805a3a:	46 00 30             	rex.RX add %r14b,(%rax)
+  805a3d:	31 32                	xor    %esi,(%rdx)
+  805a3f:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  805a46:	61                   	(bad)
+  805a47:	62 63 64 65 66       	(bad)
+  805a4c:	00 28                	add    %ch,(%rax)
+  805a4e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805a4f:	75 6c                	jne    805abd <__rodata_start+0x215>
+  805a51:	6c                   	insb   (%dx),%es:(%rdi)
+  805a52:	29 00                	sub    %eax,(%rax)
+  805a54:	65 72 72             	gs jb  805ac9 <__rodata_start+0x221>
+  805a57:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805a58:	72 20                	jb     805a7a <__rodata_start+0x1d2>
+  805a5a:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  805a5f:	73 70                	jae    805ad1 <__rodata_start+0x229>
+  805a61:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  805a65:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  805a6c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805a6d:	72 00                	jb     805a6f <__rodata_start+0x1c7>
+  805a6f:	62 61 64 20 65       	(bad)
+  805a74:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805a75:	76 69                	jbe    805ae0 <__rodata_start+0x238>
+  805a77:	72 6f                	jb     805ae8 <__rodata_start+0x240>
+  805a79:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805a7a:	6d                   	insl   (%dx),%es:(%rdi)
+  805a7b:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  805a7d:	74 00                	je     805a7f <__rodata_start+0x1d7>
+  805a7f:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  805a86:	20 70 61             	and    %dh,0x61(%rax)
+  805a89:	72 61                	jb     805aec <__rodata_start+0x244>
+  805a8b:	6d                   	insl   (%dx),%es:(%rdi)
+  805a8c:	65 74 65             	gs je  805af4 <__rodata_start+0x24c>
+  805a8f:	72 00                	jb     805a91 <__rodata_start+0x1e9>
+  805a91:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805a92:	75 74                	jne    805b08 <__rodata_start+0x260>
+  805a94:	20 6f 66             	and    %ch,0x66(%rdi)
+  805a97:	20 6d 65             	and    %ch,0x65(%rbp)
+  805a9a:	6d                   	insl   (%dx),%es:(%rdi)
+  805a9b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805a9c:	72 79                	jb     805b17 <__rodata_start+0x26f>
+  805a9e:	00 6f 75             	add    %ch,0x75(%rdi)
+  805aa1:	74 20                	je     805ac3 <__rodata_start+0x21b>
+  805aa3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805aa4:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  805aa8:	76 69                	jbe    805b13 <__rodata_start+0x26b>
+  805aaa:	72 6f                	jb     805b1b <__rodata_start+0x273>
+  805aac:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805aad:	6d                   	insl   (%dx),%es:(%rdi)
+  805aae:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  805ab0:	74 73                	je     805b25 <__rodata_start+0x27d>
+  805ab2:	00 63 6f             	add    %ah,0x6f(%rbx)
+  805ab5:	72 72                	jb     805b29 <__rodata_start+0x281>
+  805ab7:	75 70                	jne    805b29 <__rodata_start+0x281>
+  805ab9:	74 65                	je     805b20 <__rodata_start+0x278>
+  805abb:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  805ac0:	75 67                	jne    805b29 <__rodata_start+0x281>
+  805ac2:	20 69 6e             	and    %ch,0x6e(%rcx)
+  805ac5:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  805ac7:	00 73 65             	add    %dh,0x65(%rbx)
+  805aca:	67 6d                	insl   (%dx),%es:(%edi)
+  805acc:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  805ace:	74 61                	je     805b31 <__rodata_start+0x289>
+  805ad0:	74 69                	je     805b3b <__rodata_start+0x293>
+  805ad2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805ad3:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805ad4:	20 66 61             	and    %ah,0x61(%rsi)
+  805ad7:	75 6c                	jne    805b45 <__rodata_start+0x29d>
+  805ad9:	74 00                	je     805adb <__rodata_start+0x233>
+  805adb:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  805ae2:	20 45 4c             	and    %al,0x4c(%rbp)
+  805ae5:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  805ae9:	61                   	(bad)
+  805aea:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  805aef:	20 73 75             	and    %dh,0x75(%rbx)
+  805af2:	63 68 20             	movsxd 0x20(%rax),%ebp
+  805af5:	73 79                	jae    805b70 <__rodata_start+0x2c8>
+  805af7:	73 74                	jae    805b6d <__rodata_start+0x2c5>
+  805af9:	65 6d                	gs insl (%dx),%es:(%rdi)
+  805afb:	20 63 61             	and    %ah,0x61(%rbx)
+  805afe:	6c                   	insb   (%dx),%es:(%rdi)
+  805aff:	6c                   	insb   (%dx),%es:(%rdi)
+  805b00:	00 65 6e             	add    %ah,0x6e(%rbp)
+  805b03:	74 72                	je     805b77 <__rodata_start+0x2cf>
+  805b05:	79 20                	jns    805b27 <__rodata_start+0x27f>
+  805b07:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805b08:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805b09:	74 20                	je     805b2b <__rodata_start+0x283>
+  805b0b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  805b0d:	75 6e                	jne    805b7d <__rodata_start+0x2d5>
+  805b0f:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  805b13:	76 20                	jbe    805b35 <__rodata_start+0x28d>
+  805b15:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  805b1c:	72 65                	jb     805b83 <__rodata_start+0x2db>
+  805b1e:	63 76 69             	movsxd 0x69(%rsi),%esi
+  805b21:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805b22:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  805b26:	65 78 70             	gs js  805b99 <__rodata_start+0x2f1>
+  805b29:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  805b2e:	20 65 6e             	and    %ah,0x6e(%rbp)
+  805b31:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  805b35:	20 66 69             	and    %ah,0x69(%rsi)
+  805b38:	6c                   	insb   (%dx),%es:(%rdi)
+  805b39:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  805b3d:	20 66 72             	and    %ah,0x72(%rsi)
+  805b40:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  805b45:	61                   	(bad)
+  805b46:	63 65 20             	movsxd 0x20(%rbp),%esp
+  805b49:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805b4a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805b4b:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  805b4f:	6b 00 74             	imul   $0x74,(%rax),%eax
+  805b52:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805b53:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805b54:	20 6d 61             	and    %ch,0x61(%rbp)
+  805b57:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805b58:	79 20                	jns    805b7a <__rodata_start+0x2d2>
+  805b5a:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  805b61:	72 65                	jb     805bc8 <__rodata_start+0x320>
+  805b63:	20 6f 70             	and    %ch,0x70(%rdi)
+  805b66:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  805b68:	00 66 69             	add    %ah,0x69(%rsi)
+  805b6b:	6c                   	insb   (%dx),%es:(%rdi)
+  805b6c:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  805b70:	20 62 6c             	and    %ah,0x6c(%rdx)
+  805b73:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805b74:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  805b77:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805b78:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805b79:	74 20                	je     805b9b <__rodata_start+0x2f3>
+  805b7b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  805b7d:	75 6e                	jne    805bed <__rodata_start+0x345>
+  805b7f:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  805b83:	76 61                	jbe    805be6 <__rodata_start+0x33e>
+  805b85:	6c                   	insb   (%dx),%es:(%rdi)
+  805b86:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  805b8d:	00 
+  805b8e:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  805b95:	72 65                	jb     805bfc <__rodata_start+0x354>
+  805b97:	61                   	(bad)
+  805b98:	64 79 20             	fs jns 805bbb <__rodata_start+0x313>
+  805b9b:	65 78 69             	gs js  805c07 <__rodata_start+0x35f>
+  805b9e:	73 74                	jae    805c14 <__rodata_start+0x36c>
+  805ba0:	73 00                	jae    805ba2 <__rodata_start+0x2fa>
+  805ba2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805ba3:	70 65                	jo     805c0a <__rodata_start+0x362>
+  805ba5:	72 61                	jb     805c08 <__rodata_start+0x360>
+  805ba7:	74 69                	je     805c12 <__rodata_start+0x36a>
+  805ba9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805baa:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805bab:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  805bae:	74 20                	je     805bd0 <__rodata_start+0x328>
+  805bb0:	73 75                	jae    805c27 <__rodata_start+0x37f>
+  805bb2:	70 70                	jo     805c24 <__rodata_start+0x37c>
+  805bb4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805bb5:	72 74                	jb     805c2b <__rodata_start+0x383>
+  805bb7:	65 64 00 74 72 79    	gs add %dh,%fs:0x79(%rdx,%rsi,2)
+  805bbd:	20 61 67             	and    %ah,0x67(%rcx)
+  805bc0:	61                   	(bad)
+  805bc1:	69 6e 00 74 69 6d 65 	imul   $0x656d6974,0x0(%rsi),%ebp
+  805bc8:	64 20 6f 75          	and    %ch,%fs:0x75(%rdi)
+  805bcc:	74 00                	je     805bce <__rodata_start+0x326>
+  805bce:	66 69 6c 65 20 69 73 	imul   $0x7369,0x20(%rbp,%riz,2),%bp
+  805bd5:	20 69 6e             	and    %ch,0x6e(%rcx)
+  805bd8:	20 75 73             	and    %dh,0x73(%rbp)
+  805bdb:	65 00 0f             	add    %cl,%gs:(%rdi)
+  805bde:	1f                   	(bad)
+  805bdf:	00 1b                	add    %bl,(%rbx)
+  805be1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  805be7:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805beb:	00 00                	add    %al,(%rax)
+  805bed:	00 00                	add    %al,(%rax)
+  805bef:	00 4c 11 80          	add    %cl,-0x80(%rcx,%rdx,1)
+  805bf3:	00 00                	add    %al,(%rax)
+  805bf5:	00 00                	add    %al,(%rax)
+  805bf7:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805bfb:	00 00                	add    %al,(%rax)
+  805bfd:	00 00                	add    %al,(%rax)
+  805bff:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805c03:	00 00                	add    %al,(%rax)
+  805c05:	00 00                	add    %al,(%rax)
+  805c07:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805c0b:	00 00                	add    %al,(%rax)
+  805c0d:	00 00                	add    %al,(%rax)
+  805c0f:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805c13:	00 00                	add    %al,(%rax)
+  805c15:	00 00                	add    %al,(%rax)
+  805c17:	00 3a                	add    %bh,(%rdx)
+  805c19:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  805c1f:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805c23:	00 00                	add    %al,(%rax)
+  805c25:	00 00                	add    %al,(%rax)
+  805c27:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805c2b:	00 00                	add    %al,(%rax)
+  805c2d:	00 00                	add    %al,(%rax)
+  805c2f:	00 2e                	add    %ch,(%rsi)
+  805c31:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  805c37:	00 a8 0b 80 00 00    	add    %ch,0x800b(%rax)
+  805c3d:	00 00                	add    %al,(%rax)
+  805c3f:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805c43:	00 00                	add    %al,(%rax)
+  805c45:	00 00                	add    %al,(%rax)
+  805c47:	00 2e                	add    %ch,(%rsi)
+  805c49:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  805c4f:	00 74 0b 80          	add    %dh,-0x80(%rbx,%rcx,1)
+  805c53:	00 00                	add    %al,(%rax)
+  805c55:	00 00                	add    %al,(%rax)
+  805c57:	00 74 0b 80          	add    %dh,-0x80(%rbx,%rcx,1)
+  805c5b:	00 00                	add    %al,(%rax)
+  805c5d:	00 00                	add    %al,(%rax)
+  805c5f:	00 74 0b 80          	add    %dh,-0x80(%rbx,%rcx,1)
+  805c63:	00 00                	add    %al,(%rax)
+  805c65:	00 00                	add    %al,(%rax)
+  805c67:	00 74 0b 80          	add    %dh,-0x80(%rbx,%rcx,1)
+  805c6b:	00 00                	add    %al,(%rax)
+  805c6d:	00 00                	add    %al,(%rax)
+  805c6f:	00 74 0b 80          	add    %dh,-0x80(%rbx,%rcx,1)
+  805c73:	00 00                	add    %al,(%rax)
+  805c75:	00 00                	add    %al,(%rax)
+  805c77:	00 74 0b 80          	add    %dh,-0x80(%rbx,%rcx,1)
+  805c7b:	00 00                	add    %al,(%rax)
+  805c7d:	00 00                	add    %al,(%rax)
+  805c7f:	00 74 0b 80          	add    %dh,-0x80(%rbx,%rcx,1)
+  805c83:	00 00                	add    %al,(%rax)
+  805c85:	00 00                	add    %al,(%rax)
+  805c87:	00 74 0b 80          	add    %dh,-0x80(%rbx,%rcx,1)
+  805c8b:	00 00                	add    %al,(%rax)
+  805c8d:	00 00                	add    %al,(%rax)
+  805c8f:	00 74 0b 80          	add    %dh,-0x80(%rbx,%rcx,1)
+  805c93:	00 00                	add    %al,(%rax)
+  805c95:	00 00                	add    %al,(%rax)
+  805c97:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805c9b:	00 00                	add    %al,(%rax)
+  805c9d:	00 00                	add    %al,(%rax)
+  805c9f:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805ca3:	00 00                	add    %al,(%rax)
+  805ca5:	00 00                	add    %al,(%rax)
+  805ca7:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805cab:	00 00                	add    %al,(%rax)
+  805cad:	00 00                	add    %al,(%rax)
+  805caf:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805cb3:	00 00                	add    %al,(%rax)
+  805cb5:	00 00                	add    %al,(%rax)
+  805cb7:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805cbb:	00 00                	add    %al,(%rax)
+  805cbd:	00 00                	add    %al,(%rax)
+  805cbf:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805cc3:	00 00                	add    %al,(%rax)
+  805cc5:	00 00                	add    %al,(%rax)
+  805cc7:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805ccb:	00 00                	add    %al,(%rax)
+  805ccd:	00 00                	add    %al,(%rax)
+  805ccf:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805cd3:	00 00                	add    %al,(%rax)
+  805cd5:	00 00                	add    %al,(%rax)
+  805cd7:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805cdb:	00 00                	add    %al,(%rax)
+  805cdd:	00 00                	add    %al,(%rax)
+  805cdf:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805ce3:	00 00                	add    %al,(%rax)
+  805ce5:	00 00                	add    %al,(%rax)
+  805ce7:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805ceb:	00 00                	add    %al,(%rax)
+  805ced:	00 00                	add    %al,(%rax)
+  805cef:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805cf3:	00 00                	add    %al,(%rax)
+  805cf5:	00 00                	add    %al,(%rax)
+  805cf7:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805cfb:	00 00                	add    %al,(%rax)
+  805cfd:	00 00                	add    %al,(%rax)
+  805cff:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805d03:	00 00                	add    %al,(%rax)
+  805d05:	00 00                	add    %al,(%rax)
+  805d07:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805d0b:	00 00                	add    %al,(%rax)
+  805d0d:	00 00                	add    %al,(%rax)
+  805d0f:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805d13:	00 00                	add    %al,(%rax)
+  805d15:	00 00                	add    %al,(%rax)
+  805d17:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805d1b:	00 00                	add    %al,(%rax)
+  805d1d:	00 00                	add    %al,(%rax)
+  805d1f:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805d23:	00 00                	add    %al,(%rax)
+  805d25:	00 00                	add    %al,(%rax)
+  805d27:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805d2b:	00 00                	add    %al,(%rax)
+  805d2d:	00 00                	add    %al,(%rax)
+  805d2f:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805d33:	00 00                	add    %al,(%rax)
+  805d35:	00 00                	add    %al,(%rax)
+  805d37:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805d3b:	00 00                	add    %al,(%rax)
+  805d3d:	00 00                	add    %al,(%rax)
+  805d3f:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805d43:	00 00                	add    %al,(%rax)
+  805d45:	00 00                	add    %al,(%rax)
+  805d47:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805d4b:	00 00                	add    %al,(%rax)
+  805d4d:	00 00                	add    %al,(%rax)
+  805d4f:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805d53:	00 00                	add    %al,(%rax)
+  805d55:	00 00                	add    %al,(%rax)
+  805d57:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805d5b:	00 00                	add    %al,(%rax)
+  805d5d:	00 00                	add    %al,(%rax)
+  805d5f:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805d63:	00 00                	add    %al,(%rax)
+  805d65:	00 00                	add    %al,(%rax)
+  805d67:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805d6b:	00 00                	add    %al,(%rax)
+  805d6d:	00 00                	add    %al,(%rax)
+  805d6f:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805d73:	00 00                	add    %al,(%rax)
+  805d75:	00 00                	add    %al,(%rax)
+  805d77:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805d7b:	00 00                	add    %al,(%rax)
+  805d7d:	00 00                	add    %al,(%rax)
+  805d7f:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805d83:	00 00                	add    %al,(%rax)
+  805d85:	00 00                	add    %al,(%rax)
+  805d87:	00 7f 10             	add    %bh,0x10(%rdi)
+  805d8a:	80 00 00             	addb   $0x0,(%rax)
+  805d8d:	00 00                	add    %al,(%rax)
+  805d8f:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805d93:	00 00                	add    %al,(%rax)
+  805d95:	00 00                	add    %al,(%rax)
+  805d97:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805d9b:	00 00                	add    %al,(%rax)
+  805d9d:	00 00                	add    %al,(%rax)
+  805d9f:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805da3:	00 00                	add    %al,(%rax)
+  805da5:	00 00                	add    %al,(%rax)
+  805da7:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805dab:	00 00                	add    %al,(%rax)
+  805dad:	00 00                	add    %al,(%rax)
+  805daf:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805db3:	00 00                	add    %al,(%rax)
+  805db5:	00 00                	add    %al,(%rax)
+  805db7:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805dbb:	00 00                	add    %al,(%rax)
+  805dbd:	00 00                	add    %al,(%rax)
+  805dbf:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805dc3:	00 00                	add    %al,(%rax)
+  805dc5:	00 00                	add    %al,(%rax)
+  805dc7:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805dcb:	00 00                	add    %al,(%rax)
+  805dcd:	00 00                	add    %al,(%rax)
+  805dcf:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805dd3:	00 00                	add    %al,(%rax)
+  805dd5:	00 00                	add    %al,(%rax)
+  805dd7:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805ddb:	00 00                	add    %al,(%rax)
+  805ddd:	00 00                	add    %al,(%rax)
+  805ddf:	00 cb                	add    %cl,%bl
+  805de1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  805de7:	00 9a 0d 80 00 00    	add    %bl,0x800d(%rdx)
+  805ded:	00 00                	add    %al,(%rax)
+  805def:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805df3:	00 00                	add    %al,(%rax)
+  805df5:	00 00                	add    %al,(%rax)
+  805df7:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805dfb:	00 00                	add    %al,(%rax)
+  805dfd:	00 00                	add    %al,(%rax)
+  805dff:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805e03:	00 00                	add    %al,(%rax)
+  805e05:	00 00                	add    %al,(%rax)
+  805e07:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805e0b:	00 00                	add    %al,(%rax)
+  805e0d:	00 00                	add    %al,(%rax)
+  805e0f:	00 fa                	add    %bh,%dl
+  805e11:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  805e17:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805e1b:	00 00                	add    %al,(%rax)
+  805e1d:	00 00                	add    %al,(%rax)
+  805e1f:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805e23:	00 00                	add    %al,(%rax)
+  805e25:	00 00                	add    %al,(%rax)
+  805e27:	00 c0                	add    %al,%al
+  805e29:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  805e2f:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805e33:	00 00                	add    %al,(%rax)
+  805e35:	00 00                	add    %al,(%rax)
+  805e37:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805e3b:	00 00                	add    %al,(%rax)
+  805e3d:	00 00                	add    %al,(%rax)
+  805e3f:	00 42 0f             	add    %al,0xf(%rdx)
+  805e42:	80 00 00             	addb   $0x0,(%rax)
+  805e45:	00 00                	add    %al,(%rax)
+  805e47:	00 0c 10             	add    %cl,(%rax,%rdx,1)
+  805e4a:	80 00 00             	addb   $0x0,(%rax)
+  805e4d:	00 00                	add    %al,(%rax)
+  805e4f:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805e53:	00 00                	add    %al,(%rax)
+  805e55:	00 00                	add    %al,(%rax)
+  805e57:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805e5b:	00 00                	add    %al,(%rax)
+  805e5d:	00 00                	add    %al,(%rax)
+  805e5f:	00 91 0c 80 00 00    	add    %dl,0x800c(%rcx)
+  805e65:	00 00                	add    %al,(%rax)
+  805e67:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805e6b:	00 00                	add    %al,(%rax)
+  805e6d:	00 00                	add    %al,(%rax)
+  805e6f:	00 6e 0e             	add    %ch,0xe(%rsi)
+  805e72:	80 00 00             	addb   $0x0,(%rax)
+  805e75:	00 00                	add    %al,(%rax)
+  805e77:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805e7b:	00 00                	add    %al,(%rax)
+  805e7d:	00 00                	add    %al,(%rax)
+  805e7f:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805e83:	00 00                	add    %al,(%rax)
+  805e85:	00 00                	add    %al,(%rax)
+  805e87:	00 7f 10             	add    %bh,0x10(%rdi)
+  805e8a:	80 00 00             	addb   $0x0,(%rax)
+  805e8d:	00 00                	add    %al,(%rax)
+  805e8f:	00 5c 11 80          	add    %bl,-0x80(%rcx,%rdx,1)
+  805e93:	00 00                	add    %al,(%rax)
+  805e95:	00 00                	add    %al,(%rax)
+  805e97:	00 24 0b             	add    %ah,(%rbx,%rcx,1)
+  805e9a:	80 00 00             	addb   $0x0,(%rax)
+  805e9d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000805ea0 <error_string>:
+	...
+  805ea8:	5d 5a 80 00 00 00 00 00 6f 5a 80 00 00 00 00 00     ]Z......oZ......
+  805eb8:	7f 5a 80 00 00 00 00 00 91 5a 80 00 00 00 00 00     .Z.......Z......
+  805ec8:	9f 5a 80 00 00 00 00 00 b3 5a 80 00 00 00 00 00     .Z.......Z......
+  805ed8:	c8 5a 80 00 00 00 00 00 db 5a 80 00 00 00 00 00     .Z.......Z......
+  805ee8:	ed 5a 80 00 00 00 00 00 01 5b 80 00 00 00 00 00     .Z.......[......
+  805ef8:	11 5b 80 00 00 00 00 00 24 5b 80 00 00 00 00 00     .[......$[......
+  805f08:	3b 5b 80 00 00 00 00 00 51 5b 80 00 00 00 00 00     ;[......Q[......
+  805f18:	69 5b 80 00 00 00 00 00 81 5b 80 00 00 00 00 00     i[.......[......
+  805f28:	8e 5b 80 00 00 00 00 00 58 5f 80 00 00 00 00 00     .[......X_......
+  805f38:	a2 5b 80 00 00 00 00 00 ba 5b 80 00 00 00 00 00     .[.......[......
+  805f48:	c4 5b 80 00 00 00 00 00 ce 5b 80 00 00 00 00 00     .[.......[......
+  805f58:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  805f68:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  805f78:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  805f88:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  805f98:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 73 66 6f     ib/syscall.c.sfo
+  805fa8:	72 6b 28 29 20 69 73 20 6e 6f 74 20 69 6d 70 6c     rk() is not impl
+  805fb8:	65 6d 65 6e 74 65 64 00 6c 69 62 2f 66 6f 72 6b     emented.lib/fork
+  805fc8:	2e 63 00 0f 1f 44 00 00 5b 25 30 38 78 5d 20 75     .c...D..[%08x] u
+  805fd8:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  805fe8:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  805ff8:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  806008:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  806018:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  806028:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  806038:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  806048:	0a 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806058:	84 00 00 00 00 00 66 90                             ......f.
+
+0000000000806060 <devtab>:
+  806060:	60 70 80 00 00 00 00 00 a0 70 80 00 00 00 00 00     `p.......p......
+  806070:	00 70 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .p..............
+  806080:	57 72 6f 6e 67 20 45 4c 46 20 68 65 61 64 65 72     Wrong ELF header
+  806090:	20 73 69 7a 65 20 6f 72 20 72 65 61 64 20 65 72      size or read er
+  8060a0:	72 6f 72 3a 20 25 69 0a 00 00 00 00 00 00 00 00     ror: %i.........
+  8060b0:	73 74 72 69 6e 67 5f 73 74 6f 72 65 20 3d 3d 20     string_store == 
+  8060c0:	28 63 68 61 72 20 2a 29 55 54 45 4d 50 20 2b 20     (char *)UTEMP + 
+  8060d0:	55 53 45 52 5f 53 54 41 43 4b 5f 53 49 5a 45 00     USER_STACK_SIZE.
+  8060e0:	6d 61 70 5f 73 65 67 6d 65 6e 74 2e 73 79 73 5f     map_segment.sys_
+  8060f0:	61 6c 6c 6f 63 5f 72 65 67 69 6f 6e 20 66 61 69     alloc_region fai
+  806100:	6c 65 64 3a 20 25 69 0a 00 00 00 00 00 00 00 00     led: %i.........
+  806110:	73 70 61 77 6e 3a 20 62 61 74 63 68 65 64 20 73     spawn: batched s
+  806120:	79 73 74 65 6d 20 63 61 6c 6c 20 66 61 69 6c 65     ystem call faile
+  806130:	64 3a 20 25 69 0a 00 45 6c 66 20 6d 61 67 69 63     d: %i..Elf magic
+  806140:	20 25 30 38 78 20 77 61 6e 74 20 25 30 38 78 0a      %08x want %08x.
+  806150:	00 61 73 73 65 72 74 69 6f 6e 20 66 61 69 6c 65     .assertion faile
+  806160:	64 3a 20 25 73 00 6c 69 62 2f 73 70 61 77 6e 2e     d: %s.lib/spawn.
+  806170:	63 00 6d 61 70 5f 73 65 67 6d 65 6e 74 2e 6d 6d     c.map_segment.mm
+  806180:	61 70 20 66 61 69 6c 65 64 3a 20 25 69 0a 00 3c     ap failed: %i..<
+  806190:	70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e 63     pipe>.lib/pipe.c
+  8061a0:	00 70 69 70 65 00 66 90 73 79 73 5f 72 65 67 69     .pipe.f.sys_regi
+  8061b0:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  8061c0:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 65 6e 76 69     _SIZE) == 2.envi
+  8061d0:	64 20 21 3d 20 30 00 6c 69 62 2f 77 61 69 74 2e     d != 0.lib/wait.
+  8061e0:	63 00 66 0f 1f 44 00 00 55 73 65 72 73 70 61 63     c.f..D..Userspac
+  8061f0:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  806200:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  806210:	65 72 72 3d 25 78 0a 00 6c 69 62 2f 70 67 66 61     err=%x..lib/pgfa
+  806220:	75 6c 74 2e 63 00 73 65 74 5f 70 67 66 61 75 6c     ult.c.set_pgfaul
+  806230:	74 5f 68 61 6e 64 6c 65 72 3a 20 25 69 00 5f 70     t_handler: %i._p
+  806240:	66 68 61 6e 64 6c 65 72 5f 69 6e 69 74 69 74 69     fhandler_inititi
+  806250:	61 6c 6c 69 7a 65 64 00 69 70 63 5f 73 65 6e 64     allized.ipc_send
+  806260:	20 65 72 72 6f 72 3a 20 25 69 0a 00 6c 69 62 2f      error: %i..lib/
+  806270:	69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00 00     ipc.c.f.........
+  806280:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806290:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8062a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8062b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8062c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8062d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8062e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8062f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806300:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806310:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806320:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806330:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806340:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806350:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806360:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806370:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806380:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806390:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8063a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8063b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8063c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8063d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8063e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8063f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806400:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806410:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806420:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806430:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806440:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806450:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806460:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806470:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806480:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806490:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8064a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8064b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8064c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8064d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8064e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8064f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806500:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806510:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806520:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806530:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806540:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806550:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806560:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806570:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806580:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806590:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8065a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8065b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8065c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8065d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8065e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8065f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806600:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806610:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806620:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806630:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806640:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806650:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806660:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806670:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806680:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806690:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8066a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8066b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8066c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8066d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8066e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8066f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806700:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806710:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806720:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806730:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806740:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806750:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806760:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806770:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806780:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806790:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8067a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8067b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8067c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8067d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8067e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8067f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806800:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806810:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806820:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806830:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806840:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806850:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806860:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806870:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806880:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806890:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8068a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8068b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8068c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8068d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8068e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8068f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806900:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806910:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806920:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806930:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806940:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806950:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806960:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806970:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806980:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806990:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8069a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8069b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8069c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8069d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8069e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8069f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806a00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806a10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806a20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806a30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806a40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806a50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806a60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806a70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806a80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806a90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806aa0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806ab0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806ac0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806ad0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806ae0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806af0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806b00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806b10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806b20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806b30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806b40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806b50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806b60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806b70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806b80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806b90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806ba0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806bb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806bc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806bd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806be0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806bf0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806c00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806c10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806c20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806c30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806c40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806c50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806c60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806c70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806c80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806c90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806ca0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806cb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806cc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806cd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806ce0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806cf0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806d00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806d10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806d20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806d30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806d40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806d50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806d60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806d70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806d80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806d90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806da0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806db0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806dc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806dd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806de0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806df0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806e00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806e10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806e20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806e30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806e40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806e50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806e60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806e70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806e80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806e90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806ea0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806eb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806ec0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806ed0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806ee0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806ef0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806f00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806f10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806f20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806f30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806f40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806f50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806f60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806f70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806f80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806f90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806fa0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806fb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806fc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806fd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806fe0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806ff0:	66 2e 0f 1f 84 00 00 00 00 00 66 0f 1f 44 00 00     f.........f..D..
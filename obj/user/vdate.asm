@@ -0,0 +1,8620 @@
+
+obj/user/vdate:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 5f 03 00 00       	call   800382 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/time.h>
+#include <inc/stdio.h>
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	53                   	push   %rbx
+  80002a:	48 83 ec 58          	sub    $0x58,%rsp
+    char time[20];
+    int now = vsys_gettime();
+  80002e:	48 b8 41 41 80 00 00 	movabs $0x804141,%rax
+  800035:	00 00 00 
+  800038:	ff d0                	call   *%rax
+  80003a:	41 89 c0             	mov    %eax,%r8d
+
+inline static void
+mktime(int time, struct tm *tm) {
+    // TODO Support negative timestamps
+
+    int year = 1970 + (time / (DAY * 366 + 1));
+  80003d:	48 63 f0             	movslq %eax,%rsi
+  800040:	48 69 f6 c1 40 fa 10 	imul   $0x10fa40c1,%rsi,%rsi
+  800047:	48 c1 fe 35          	sar    $0x35,%rsi
+  80004b:	c1 f8 1f             	sar    $0x1f,%eax
+  80004e:	29 c6                	sub    %eax,%esi
+  800050:	8d be b2 07 00 00    	lea    0x7b2(%rsi),%edi
+    while (time >= DAY * (Y2DAYS(year + 1) - Y2DAYS(1970))) year++;
+  800056:	81 c6 b3 07 00 00    	add    $0x7b3,%esi
+  80005c:	69 f6 6d 01 00 00    	imul   $0x16d,%esi,%esi
+  800062:	89 f9                	mov    %edi,%ecx
+  800064:	83 c7 01             	add    $0x1,%edi
+  800067:	8d 41 03             	lea    0x3(%rcx),%eax
+  80006a:	85 c9                	test   %ecx,%ecx
+  80006c:	0f 49 c1             	cmovns %ecx,%eax
+  80006f:	c1 f8 02             	sar    $0x2,%eax
+  800072:	01 f0                	add    %esi,%eax
+  800074:	48 63 d1             	movslq %ecx,%rdx
+  800077:	48 69 d2 1f 85 eb 51 	imul   $0x51eb851f,%rdx,%rdx
+  80007e:	48 89 d3             	mov    %rdx,%rbx
+  800081:	48 c1 fb 25          	sar    $0x25,%rbx
+  800085:	49 89 db             	mov    %rbx,%r11
+  800088:	41 89 c9             	mov    %ecx,%r9d
+  80008b:	41 c1 f9 1f          	sar    $0x1f,%r9d
+  80008f:	45 89 ca             	mov    %r9d,%r10d
+  800092:	41 29 da             	sub    %ebx,%r10d
+  800095:	44 01 d0             	add    %r10d,%eax
+  800098:	48 c1 fa 27          	sar    $0x27,%rdx
+  80009c:	44 29 ca             	sub    %r9d,%edx
+  80009f:	8d 84 10 59 05 f5 ff 	lea    -0xafaa7(%rax,%rdx,1),%eax
+  8000a6:	69 c0 80 51 01 00    	imul   $0x15180,%eax,%eax
+  8000ac:	81 c6 6d 01 00 00    	add    $0x16d,%esi
+  8000b2:	41 39 c0             	cmp    %eax,%r8d
+  8000b5:	7d ab                	jge    800062 <umain+0x3d>
+    tm->tm_year = year - 1900;
+    time -= DAY * (Y2DAYS(year) - Y2DAYS(1970));
+  8000b7:	69 f1 6d 01 00 00    	imul   $0x16d,%ecx,%esi
+  8000bd:	8d 41 02             	lea    0x2(%rcx),%eax
+  8000c0:	89 ca                	mov    %ecx,%edx
+  8000c2:	83 ea 01             	sub    $0x1,%edx
+  8000c5:	0f 49 c2             	cmovns %edx,%eax
+  8000c8:	c1 f8 02             	sar    $0x2,%eax
+  8000cb:	01 c6                	add    %eax,%esi
+  8000cd:	48 63 c2             	movslq %edx,%rax
+  8000d0:	48 69 c0 1f 85 eb 51 	imul   $0x51eb851f,%rax,%rax
+  8000d7:	48 89 c3             	mov    %rax,%rbx
+  8000da:	48 c1 fb 25          	sar    $0x25,%rbx
+  8000de:	c1 fa 1f             	sar    $0x1f,%edx
+  8000e1:	89 d7                	mov    %edx,%edi
+  8000e3:	29 df                	sub    %ebx,%edi
+  8000e5:	01 fe                	add    %edi,%esi
+  8000e7:	48 c1 f8 27          	sar    $0x27,%rax
+  8000eb:	29 d0                	sub    %edx,%eax
+  8000ed:	8d b4 06 59 05 f5 ff 	lea    -0xafaa7(%rsi,%rax,1),%esi
+  8000f4:	69 f6 80 ae fe ff    	imul   $0xfffeae80,%esi,%esi
+  8000fa:	44 01 c6             	add    %r8d,%esi
+
+    int month = time / (DAY * 32);
+    while (time >= DAY * (M2DAYS(month + 1, year))) month++;
+  8000fd:	4c 63 c9             	movslq %ecx,%r9
+  800100:	4d 69 c9 1f 85 eb 51 	imul   $0x51eb851f,%r9,%r9
+  800107:	4c 89 c8             	mov    %r9,%rax
+  80010a:	48 c1 f8 27          	sar    $0x27,%rax
+  80010e:	49 89 c2             	mov    %rax,%r10
+  800111:	89 c8                	mov    %ecx,%eax
+  800113:	c1 f8 1f             	sar    $0x1f,%eax
+  800116:	41 29 c2             	sub    %eax,%r10d
+  800119:	41 69 d2 90 01 00 00 	imul   $0x190,%r10d,%edx
+  800120:	41 89 ca             	mov    %ecx,%r10d
+  800123:	41 29 d2             	sub    %edx,%r10d
+  800126:	4d 89 d9             	mov    %r11,%r9
+  800129:	41 29 c1             	sub    %eax,%r9d
+  80012c:	41 6b c1 64          	imul   $0x64,%r9d,%eax
+  800130:	41 89 c9             	mov    %ecx,%r9d
+  800133:	41 29 c1             	sub    %eax,%r9d
+    int month = time / (DAY * 32);
+  800136:	48 63 d6             	movslq %esi,%rdx
+  800139:	48 69 d2 07 45 2e c2 	imul   $0xffffffffc22e4507,%rdx,%rdx
+  800140:	48 c1 ea 20          	shr    $0x20,%rdx
+  800144:	01 f2                	add    %esi,%edx
+  800146:	c1 fa 15             	sar    $0x15,%edx
+  800149:	89 f0                	mov    %esi,%eax
+  80014b:	c1 f8 1f             	sar    $0x1f,%eax
+  80014e:	29 c2                	sub    %eax,%edx
+  800150:	48 63 d2             	movslq %edx,%rdx
+    while (time >= DAY * (M2DAYS(month + 1, year))) month++;
+  800153:	41 89 cb             	mov    %ecx,%r11d
+  800156:	41 83 e3 03          	and    $0x3,%r11d
+  80015a:	44 89 cb             	mov    %r9d,%ebx
+  80015d:	eb 21                	jmp    800180 <umain+0x15b>
+  80015f:	85 d2                	test   %edx,%edx
+  800161:	40 0f 9f c7          	setg   %dil
+  800165:	40 0f b6 ff          	movzbl %dil,%edi
+  800169:	4c 8d 42 01          	lea    0x1(%rdx),%r8
+  80016d:	01 f8                	add    %edi,%eax
+  80016f:	69 c0 80 51 01 00    	imul   $0x15180,%eax,%eax
+  800175:	39 c6                	cmp    %eax,%esi
+  800177:	0f 8c 89 00 00 00    	jl     800206 <umain+0x1e1>
+  80017d:	4c 89 c2             	mov    %r8,%rdx
+  800180:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%rbp)
+  800187:	c7 45 ac 1f 00 00 00 	movl   $0x1f,-0x54(%rbp)
+  80018e:	c7 45 b0 3b 00 00 00 	movl   $0x3b,-0x50(%rbp)
+  800195:	c7 45 b4 5a 00 00 00 	movl   $0x5a,-0x4c(%rbp)
+  80019c:	c7 45 b8 78 00 00 00 	movl   $0x78,-0x48(%rbp)
+  8001a3:	c7 45 bc 97 00 00 00 	movl   $0x97,-0x44(%rbp)
+  8001aa:	c7 45 c0 b5 00 00 00 	movl   $0xb5,-0x40(%rbp)
+  8001b1:	c7 45 c4 d4 00 00 00 	movl   $0xd4,-0x3c(%rbp)
+  8001b8:	c7 45 c8 f3 00 00 00 	movl   $0xf3,-0x38(%rbp)
+  8001bf:	c7 45 cc 11 01 00 00 	movl   $0x111,-0x34(%rbp)
+  8001c6:	c7 45 d0 30 01 00 00 	movl   $0x130,-0x30(%rbp)
+  8001cd:	c7 45 d4 4e 01 00 00 	movl   $0x14e,-0x2c(%rbp)
+  8001d4:	c7 45 d8 6d 01 00 00 	movl   $0x16d,-0x28(%rbp)
+  8001db:	8b 44 95 ac          	mov    -0x54(%rbp,%rdx,4),%eax
+  8001df:	45 85 d2             	test   %r10d,%r10d
+  8001e2:	0f 84 77 ff ff ff    	je     80015f <umain+0x13a>
+  8001e8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001ed:	45 85 db             	test   %r11d,%r11d
+  8001f0:	0f 85 73 ff ff ff    	jne    800169 <umain+0x144>
+  8001f6:	89 df                	mov    %ebx,%edi
+  8001f8:	45 85 c9             	test   %r9d,%r9d
+  8001fb:	0f 84 68 ff ff ff    	je     800169 <umain+0x144>
+  800201:	e9 59 ff ff ff       	jmp    80015f <umain+0x13a>
+  800206:	89 d7                	mov    %edx,%edi
+    tm->tm_mon = month;
+    time -= DAY * M2DAYS(month, year);
+  800208:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%rbp)
+  80020f:	c7 45 ac 1f 00 00 00 	movl   $0x1f,-0x54(%rbp)
+  800216:	c7 45 b0 3b 00 00 00 	movl   $0x3b,-0x50(%rbp)
+  80021d:	c7 45 b4 5a 00 00 00 	movl   $0x5a,-0x4c(%rbp)
+  800224:	c7 45 b8 78 00 00 00 	movl   $0x78,-0x48(%rbp)
+  80022b:	c7 45 bc 97 00 00 00 	movl   $0x97,-0x44(%rbp)
+  800232:	c7 45 c0 b5 00 00 00 	movl   $0xb5,-0x40(%rbp)
+  800239:	c7 45 c4 d4 00 00 00 	movl   $0xd4,-0x3c(%rbp)
+  800240:	c7 45 c8 f3 00 00 00 	movl   $0xf3,-0x38(%rbp)
+  800247:	c7 45 cc 11 01 00 00 	movl   $0x111,-0x34(%rbp)
+  80024e:	c7 45 d0 30 01 00 00 	movl   $0x130,-0x30(%rbp)
+  800255:	c7 45 d4 4e 01 00 00 	movl   $0x14e,-0x2c(%rbp)
+  80025c:	c7 45 d8 6d 01 00 00 	movl   $0x16d,-0x28(%rbp)
+  800263:	48 63 c2             	movslq %edx,%rax
+  800266:	8b 44 85 a8          	mov    -0x58(%rbp,%rax,4),%eax
+  80026a:	45 85 d2             	test   %r10d,%r10d
+  80026d:	74 0e                	je     80027d <umain+0x258>
+  80026f:	f6 c1 03             	test   $0x3,%cl
+  800272:	0f 85 ff 00 00 00    	jne    800377 <umain+0x352>
+  800278:	45 85 c9             	test   %r9d,%r9d
+  80027b:	74 0b                	je     800288 <umain+0x263>
+  80027d:	83 ff 01             	cmp    $0x1,%edi
+  800280:	41 0f 9f c1          	setg   %r9b
+  800284:	45 0f b6 c9          	movzbl %r9b,%r9d
+  800288:	44 01 c8             	add    %r9d,%eax
+  80028b:	69 c0 80 51 01 00    	imul   $0x15180,%eax,%eax
+  800291:	29 c6                	sub    %eax,%esi
+
+    tm->tm_mday = time / DAY + 1;
+    time %= DAY;
+  800293:	48 63 c6             	movslq %esi,%rax
+  800296:	48 69 c0 07 45 2e c2 	imul   $0xffffffffc22e4507,%rax,%rax
+  80029d:	48 c1 e8 20          	shr    $0x20,%rax
+  8002a1:	01 f0                	add    %esi,%eax
+  8002a3:	c1 f8 10             	sar    $0x10,%eax
+  8002a6:	41 89 f3             	mov    %esi,%r11d
+  8002a9:	41 c1 fb 1f          	sar    $0x1f,%r11d
+  8002ad:	41 89 c2             	mov    %eax,%r10d
+  8002b0:	45 29 da             	sub    %r11d,%r10d
+  8002b3:	41 69 fa 80 51 01 00 	imul   $0x15180,%r10d,%edi
+  8002ba:	29 fe                	sub    %edi,%esi
+  8002bc:	41 89 f2             	mov    %esi,%r10d
+    tm->tm_hour = time / HOUR;
+    time %= HOUR;
+  8002bf:	48 63 f6             	movslq %esi,%rsi
+  8002c2:	48 69 f6 c5 b3 a2 91 	imul   $0xffffffff91a2b3c5,%rsi,%rsi
+  8002c9:	48 c1 ee 20          	shr    $0x20,%rsi
+  8002cd:	44 01 d6             	add    %r10d,%esi
+  8002d0:	c1 fe 0b             	sar    $0xb,%esi
+  8002d3:	41 89 f0             	mov    %esi,%r8d
+  8002d6:	45 89 d1             	mov    %r10d,%r9d
+  8002d9:	41 c1 f9 1f          	sar    $0x1f,%r9d
+  8002dd:	89 f7                	mov    %esi,%edi
+  8002df:	44 29 cf             	sub    %r9d,%edi
+  8002e2:	69 f7 10 0e 00 00    	imul   $0xe10,%edi,%esi
+  8002e8:	44 89 d7             	mov    %r10d,%edi
+  8002eb:	29 f7                	sub    %esi,%edi
+    tm->tm_mday = time / DAY + 1;
+  8002ed:	44 29 d8             	sub    %r11d,%eax
+  8002f0:	89 c6                	mov    %eax,%esi
+}
+
+inline static void
+snprint_datetime(char *buf, int size, struct tm *tm) {
+    assert(size >= 10 + 1 + 8 + 1);
+    snprintf(buf, size, "%04d-%02d-%02d %02d:%02d:%02d",
+  8002f2:	48 83 ec 08          	sub    $0x8,%rsp
+    time %= MINUTE;
+  8002f6:	48 63 c7             	movslq %edi,%rax
+  8002f9:	48 69 c0 89 88 88 88 	imul   $0xffffffff88888889,%rax,%rax
+  800300:	48 c1 e8 20          	shr    $0x20,%rax
+  800304:	01 f8                	add    %edi,%eax
+  800306:	c1 f8 05             	sar    $0x5,%eax
+  800309:	41 89 fa             	mov    %edi,%r10d
+  80030c:	41 c1 fa 1f          	sar    $0x1f,%r10d
+  800310:	44 29 d0             	sub    %r10d,%eax
+  800313:	44 6b d0 3c          	imul   $0x3c,%eax,%r10d
+  800317:	44 29 d7             	sub    %r10d,%edi
+    snprintf(buf, size, "%04d-%02d-%02d %02d:%02d:%02d",
+  80031a:	57                   	push   %rdi
+  80031b:	50                   	push   %rax
+    tm->tm_hour = time / HOUR;
+  80031c:	45 29 c8             	sub    %r9d,%r8d
+    snprintf(buf, size, "%04d-%02d-%02d %02d:%02d:%02d",
+  80031f:	41 50                	push   %r8
+  800321:	44 8d 4e 01          	lea    0x1(%rsi),%r9d
+  800325:	44 8d 42 01          	lea    0x1(%rdx),%r8d
+  800329:	48 ba e8 49 80 00 00 	movabs $0x8049e8,%rdx
+  800330:	00 00 00 
+  800333:	be 14 00 00 00       	mov    $0x14,%esi
+  800338:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  80033c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800341:	49 ba af 0d 80 00 00 	movabs $0x800daf,%r10
+  800348:	00 00 00 
+  80034b:	41 ff d2             	call   *%r10
+    struct tm tnow;
+
+    mktime(now, &tnow);
+
+    snprint_datetime(time, 20, &tnow);
+    cprintf("VDATE: %s\n", time);
+  80034e:	48 83 c4 20          	add    $0x20,%rsp
+  800352:	48 8d 75 dc          	lea    -0x24(%rbp),%rsi
+  800356:	48 bf 06 4a 80 00 00 	movabs $0x804a06,%rdi
+  80035d:	00 00 00 
+  800360:	b8 00 00 00 00       	mov    $0x0,%eax
+  800365:	48 ba 05 05 80 00 00 	movabs $0x800505,%rdx
+  80036c:	00 00 00 
+  80036f:	ff d2                	call   *%rdx
+}
+  800371:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800375:	c9                   	leave
+  800376:	c3                   	ret
+    time -= DAY * M2DAYS(month, year);
+  800377:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80037d:	e9 06 ff ff ff       	jmp    800288 <umain+0x263>
+
+0000000000800382 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800382:	55                   	push   %rbp
+  800383:	48 89 e5             	mov    %rsp,%rbp
+  800386:	41 56                	push   %r14
+  800388:	41 55                	push   %r13
+  80038a:	41 54                	push   %r12
+  80038c:	53                   	push   %rbx
+  80038d:	41 89 fd             	mov    %edi,%r13d
+  800390:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800393:	48 ba e0 60 80 00 00 	movabs $0x8060e0,%rdx
+  80039a:	00 00 00 
+  80039d:	48 b8 e0 60 80 00 00 	movabs $0x8060e0,%rax
+  8003a4:	00 00 00 
+  8003a7:	48 39 c2             	cmp    %rax,%rdx
+  8003aa:	73 17                	jae    8003c3 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8003ac:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8003af:	49 89 c4             	mov    %rax,%r12
+  8003b2:	48 83 c3 08          	add    $0x8,%rbx
+  8003b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003bb:	ff 53 f8             	call   *-0x8(%rbx)
+  8003be:	4c 39 e3             	cmp    %r12,%rbx
+  8003c1:	72 ef                	jb     8003b2 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8003c3:	48 b8 fc 12 80 00 00 	movabs $0x8012fc,%rax
+  8003ca:	00 00 00 
+  8003cd:	ff d0                	call   *%rax
+  8003cf:	89 c2                	mov    %eax,%edx
+  8003d1:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  8003d7:	48 89 d0             	mov    %rdx,%rax
+  8003da:	48 c1 e0 04          	shl    $0x4,%rax
+  8003de:	48 29 d0             	sub    %rdx,%rax
+  8003e1:	48 c1 e0 05          	shl    $0x5,%rax
+  8003e5:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8003ec:	00 00 00 
+  8003ef:	48 01 d0             	add    %rdx,%rax
+  8003f2:	48 a3 00 00 81 00 00 	movabs %rax,0x810000
+  8003f9:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8003fc:	45 85 ed             	test   %r13d,%r13d
+  8003ff:	7e 0d                	jle    80040e <libmain+0x8c>
+  800401:	49 8b 06             	mov    (%r14),%rax
+  800404:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  80040b:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80040e:	4c 89 f6             	mov    %r14,%rsi
+  800411:	44 89 ef             	mov    %r13d,%edi
+  800414:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80041b:	00 00 00 
+  80041e:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800420:	48 b8 35 04 80 00 00 	movabs $0x800435,%rax
+  800427:	00 00 00 
+  80042a:	ff d0                	call   *%rax
+#endif
+}
+  80042c:	5b                   	pop    %rbx
+  80042d:	41 5c                	pop    %r12
+  80042f:	41 5d                	pop    %r13
+  800431:	41 5e                	pop    %r14
+  800433:	5d                   	pop    %rbp
+  800434:	c3                   	ret
+
+0000000000800435 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800435:	55                   	push   %rbp
+  800436:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800439:	48 b8 e2 19 80 00 00 	movabs $0x8019e2,%rax
+  800440:	00 00 00 
+  800443:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800445:	bf 00 00 00 00       	mov    $0x0,%edi
+  80044a:	48 b8 99 12 80 00 00 	movabs $0x801299,%rax
+  800451:	00 00 00 
+  800454:	ff d0                	call   *%rax
+}
+  800456:	5d                   	pop    %rbp
+  800457:	c3                   	ret
+
+0000000000800458 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800458:	55                   	push   %rbp
+  800459:	48 89 e5             	mov    %rsp,%rbp
+  80045c:	53                   	push   %rbx
+  80045d:	48 83 ec 08          	sub    $0x8,%rsp
+  800461:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800464:	8b 06                	mov    (%rsi),%eax
+  800466:	8d 50 01             	lea    0x1(%rax),%edx
+  800469:	89 16                	mov    %edx,(%rsi)
+  80046b:	48 98                	cltq
+  80046d:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800472:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800478:	74 0a                	je     800484 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80047a:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80047e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800482:	c9                   	leave
+  800483:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800484:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800488:	be ff 00 00 00       	mov    $0xff,%esi
+  80048d:	48 b8 51 12 80 00 00 	movabs $0x801251,%rax
+  800494:	00 00 00 
+  800497:	ff d0                	call   *%rax
+        state->offset = 0;
+  800499:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80049f:	eb d9                	jmp    80047a <putch+0x22>
+
+00000000008004a1 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8004a1:	55                   	push   %rbp
+  8004a2:	48 89 e5             	mov    %rsp,%rbp
+  8004a5:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8004ac:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8004af:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8004b6:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8004bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004c0:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8004c3:	48 89 f1             	mov    %rsi,%rcx
+  8004c6:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8004cd:	48 bf 58 04 80 00 00 	movabs $0x800458,%rdi
+  8004d4:	00 00 00 
+  8004d7:	48 b8 55 06 80 00 00 	movabs $0x800655,%rax
+  8004de:	00 00 00 
+  8004e1:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8004e3:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8004ea:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8004f1:	48 b8 51 12 80 00 00 	movabs $0x801251,%rax
+  8004f8:	00 00 00 
+  8004fb:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8004fd:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800503:	c9                   	leave
+  800504:	c3                   	ret
+
+0000000000800505 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800505:	55                   	push   %rbp
+  800506:	48 89 e5             	mov    %rsp,%rbp
+  800509:	48 83 ec 50          	sub    $0x50,%rsp
+  80050d:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800511:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800515:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800519:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80051d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800521:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800528:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80052c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800530:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800534:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800538:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80053c:	48 b8 a1 04 80 00 00 	movabs $0x8004a1,%rax
+  800543:	00 00 00 
+  800546:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800548:	c9                   	leave
+  800549:	c3                   	ret
+
+000000000080054a <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80054a:	55                   	push   %rbp
+  80054b:	48 89 e5             	mov    %rsp,%rbp
+  80054e:	41 57                	push   %r15
+  800550:	41 56                	push   %r14
+  800552:	41 55                	push   %r13
+  800554:	41 54                	push   %r12
+  800556:	53                   	push   %rbx
+  800557:	48 83 ec 18          	sub    $0x18,%rsp
+  80055b:	49 89 fc             	mov    %rdi,%r12
+  80055e:	49 89 f5             	mov    %rsi,%r13
+  800561:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800565:	8b 45 10             	mov    0x10(%rbp),%eax
+  800568:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80056b:	41 89 cf             	mov    %ecx,%r15d
+  80056e:	4c 39 fa             	cmp    %r15,%rdx
+  800571:	73 5b                	jae    8005ce <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800573:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800577:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80057b:	85 db                	test   %ebx,%ebx
+  80057d:	7e 0e                	jle    80058d <print_num+0x43>
+            putch(padc, put_arg);
+  80057f:	4c 89 ee             	mov    %r13,%rsi
+  800582:	44 89 f7             	mov    %r14d,%edi
+  800585:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800588:	83 eb 01             	sub    $0x1,%ebx
+  80058b:	75 f2                	jne    80057f <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80058d:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800591:	48 b9 2c 4a 80 00 00 	movabs $0x804a2c,%rcx
+  800598:	00 00 00 
+  80059b:	48 b8 1b 4a 80 00 00 	movabs $0x804a1b,%rax
+  8005a2:	00 00 00 
+  8005a5:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8005a9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8005ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005b2:	49 f7 f7             	div    %r15
+  8005b5:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8005b9:	4c 89 ee             	mov    %r13,%rsi
+  8005bc:	41 ff d4             	call   *%r12
+}
+  8005bf:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8005c3:	5b                   	pop    %rbx
+  8005c4:	41 5c                	pop    %r12
+  8005c6:	41 5d                	pop    %r13
+  8005c8:	41 5e                	pop    %r14
+  8005ca:	41 5f                	pop    %r15
+  8005cc:	5d                   	pop    %rbp
+  8005cd:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8005ce:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8005d2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005d7:	49 f7 f7             	div    %r15
+  8005da:	48 83 ec 08          	sub    $0x8,%rsp
+  8005de:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8005e2:	52                   	push   %rdx
+  8005e3:	45 0f be c9          	movsbl %r9b,%r9d
+  8005e7:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8005eb:	48 89 c2             	mov    %rax,%rdx
+  8005ee:	48 b8 4a 05 80 00 00 	movabs $0x80054a,%rax
+  8005f5:	00 00 00 
+  8005f8:	ff d0                	call   *%rax
+  8005fa:	48 83 c4 10          	add    $0x10,%rsp
+  8005fe:	eb 8d                	jmp    80058d <print_num+0x43>
+
+0000000000800600 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800600:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800604:	48 8b 06             	mov    (%rsi),%rax
+  800607:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80060b:	73 0a                	jae    800617 <sprintputch+0x17>
+        *state->start++ = ch;
+  80060d:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800611:	48 89 16             	mov    %rdx,(%rsi)
+  800614:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800617:	c3                   	ret
+
+0000000000800618 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800618:	55                   	push   %rbp
+  800619:	48 89 e5             	mov    %rsp,%rbp
+  80061c:	48 83 ec 50          	sub    $0x50,%rsp
+  800620:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800624:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800628:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80062c:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800633:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800637:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80063b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80063f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800643:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800647:	48 b8 55 06 80 00 00 	movabs $0x800655,%rax
+  80064e:	00 00 00 
+  800651:	ff d0                	call   *%rax
+}
+  800653:	c9                   	leave
+  800654:	c3                   	ret
+
+0000000000800655 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800655:	55                   	push   %rbp
+  800656:	48 89 e5             	mov    %rsp,%rbp
+  800659:	41 57                	push   %r15
+  80065b:	41 56                	push   %r14
+  80065d:	41 55                	push   %r13
+  80065f:	41 54                	push   %r12
+  800661:	53                   	push   %rbx
+  800662:	48 83 ec 38          	sub    $0x38,%rsp
+  800666:	49 89 fe             	mov    %rdi,%r14
+  800669:	49 89 f5             	mov    %rsi,%r13
+  80066c:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80066f:	48 8b 01             	mov    (%rcx),%rax
+  800672:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800676:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80067a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80067e:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800682:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800686:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80068a:	0f b6 3b             	movzbl (%rbx),%edi
+  80068d:	40 80 ff 25          	cmp    $0x25,%dil
+  800691:	74 18                	je     8006ab <vprintfmt+0x56>
+            if (!ch) return;
+  800693:	40 84 ff             	test   %dil,%dil
+  800696:	0f 84 b1 06 00 00    	je     800d4d <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80069c:	40 0f b6 ff          	movzbl %dil,%edi
+  8006a0:	4c 89 ee             	mov    %r13,%rsi
+  8006a3:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8006a6:	4c 89 e3             	mov    %r12,%rbx
+  8006a9:	eb db                	jmp    800686 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8006ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8006b0:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8006b4:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8006b9:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8006bf:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8006c6:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8006ca:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8006cf:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8006d4:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8006d7:	83 e8 23             	sub    $0x23,%eax
+  8006da:	3c 57                	cmp    $0x57,%al
+  8006dc:	0f 87 51 06 00 00    	ja     800d33 <vprintfmt+0x6de>
+  8006e2:	0f b6 c0             	movzbl %al,%eax
+  8006e5:	48 b9 e0 4b 80 00 00 	movabs $0x804be0,%rcx
+  8006ec:	00 00 00 
+  8006ef:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8006f2:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8006f5:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8006f9:	eb cf                	jmp    8006ca <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8006fb:	49 89 dc             	mov    %rbx,%r12
+  8006fe:	be 01 00 00 00       	mov    $0x1,%esi
+  800703:	eb c5                	jmp    8006ca <vprintfmt+0x75>
+            padc = ch;
+  800705:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800709:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80070c:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80070f:	eb b9                	jmp    8006ca <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800711:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800714:	83 f8 2f             	cmp    $0x2f,%eax
+  800717:	77 24                	ja     80073d <vprintfmt+0xe8>
+  800719:	89 c1                	mov    %eax,%ecx
+  80071b:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  80071f:	83 c0 08             	add    $0x8,%eax
+  800722:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800725:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800728:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80072b:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80072f:	79 99                	jns    8006ca <vprintfmt+0x75>
+                width = precision;
+  800731:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800735:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80073b:	eb 8d                	jmp    8006ca <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80073d:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800741:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800745:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800749:	eb da                	jmp    800725 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80074b:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800750:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800754:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80075a:	3c 39                	cmp    $0x39,%al
+  80075c:	77 1c                	ja     80077a <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  80075e:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800762:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800766:	0f b6 c0             	movzbl %al,%eax
+  800769:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80076e:	0f b6 03             	movzbl (%rbx),%eax
+  800771:	3c 39                	cmp    $0x39,%al
+  800773:	76 e9                	jbe    80075e <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800775:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800778:	eb b1                	jmp    80072b <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80077a:	49 89 dc             	mov    %rbx,%r12
+  80077d:	eb ac                	jmp    80072b <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80077f:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800782:	85 c9                	test   %ecx,%ecx
+  800784:	b8 00 00 00 00       	mov    $0x0,%eax
+  800789:	0f 49 c1             	cmovns %ecx,%eax
+  80078c:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80078f:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800792:	e9 33 ff ff ff       	jmp    8006ca <vprintfmt+0x75>
+            lflag++;
+  800797:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80079a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80079d:	e9 28 ff ff ff       	jmp    8006ca <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8007a2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007a5:	83 f8 2f             	cmp    $0x2f,%eax
+  8007a8:	77 19                	ja     8007c3 <vprintfmt+0x16e>
+  8007aa:	89 c2                	mov    %eax,%edx
+  8007ac:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007b0:	83 c0 08             	add    $0x8,%eax
+  8007b3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007b6:	8b 3a                	mov    (%rdx),%edi
+  8007b8:	4c 89 ee             	mov    %r13,%rsi
+  8007bb:	41 ff d6             	call   *%r14
+            break;
+  8007be:	e9 c3 fe ff ff       	jmp    800686 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8007c3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007c7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007cb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007cf:	eb e5                	jmp    8007b6 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8007d1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007d4:	83 f8 2f             	cmp    $0x2f,%eax
+  8007d7:	77 5a                	ja     800833 <vprintfmt+0x1de>
+  8007d9:	89 c2                	mov    %eax,%edx
+  8007db:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007df:	83 c0 08             	add    $0x8,%eax
+  8007e2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8007e5:	8b 02                	mov    (%rdx),%eax
+  8007e7:	89 c1                	mov    %eax,%ecx
+  8007e9:	f7 d9                	neg    %ecx
+  8007eb:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8007ee:	83 f9 16             	cmp    $0x16,%ecx
+  8007f1:	7f 4e                	jg     800841 <vprintfmt+0x1ec>
+  8007f3:	48 63 c1             	movslq %ecx,%rax
+  8007f6:	48 ba a0 4e 80 00 00 	movabs $0x804ea0,%rdx
+  8007fd:	00 00 00 
+  800800:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800804:	48 85 c0             	test   %rax,%rax
+  800807:	74 38                	je     800841 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800809:	48 89 c1             	mov    %rax,%rcx
+  80080c:	48 ba 79 50 80 00 00 	movabs $0x805079,%rdx
+  800813:	00 00 00 
+  800816:	4c 89 ee             	mov    %r13,%rsi
+  800819:	4c 89 f7             	mov    %r14,%rdi
+  80081c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800821:	49 b8 18 06 80 00 00 	movabs $0x800618,%r8
+  800828:	00 00 00 
+  80082b:	41 ff d0             	call   *%r8
+  80082e:	e9 53 fe ff ff       	jmp    800686 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800833:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800837:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80083b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80083f:	eb a4                	jmp    8007e5 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800841:	48 ba 44 4a 80 00 00 	movabs $0x804a44,%rdx
+  800848:	00 00 00 
+  80084b:	4c 89 ee             	mov    %r13,%rsi
+  80084e:	4c 89 f7             	mov    %r14,%rdi
+  800851:	b8 00 00 00 00       	mov    $0x0,%eax
+  800856:	49 b8 18 06 80 00 00 	movabs $0x800618,%r8
+  80085d:	00 00 00 
+  800860:	41 ff d0             	call   *%r8
+  800863:	e9 1e fe ff ff       	jmp    800686 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800868:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80086b:	83 f8 2f             	cmp    $0x2f,%eax
+  80086e:	77 6c                	ja     8008dc <vprintfmt+0x287>
+  800870:	89 c2                	mov    %eax,%edx
+  800872:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800876:	83 c0 08             	add    $0x8,%eax
+  800879:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80087c:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  80087f:	48 85 d2             	test   %rdx,%rdx
+  800882:	48 b8 3d 4a 80 00 00 	movabs $0x804a3d,%rax
+  800889:	00 00 00 
+  80088c:	48 0f 45 c2          	cmovne %rdx,%rax
+  800890:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800894:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800898:	7e 06                	jle    8008a0 <vprintfmt+0x24b>
+  80089a:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80089e:	75 4a                	jne    8008ea <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8008a0:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8008a4:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8008a8:	0f b6 00             	movzbl (%rax),%eax
+  8008ab:	84 c0                	test   %al,%al
+  8008ad:	0f 85 9a 00 00 00    	jne    80094d <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8008b3:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8008b6:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8008ba:	85 c0                	test   %eax,%eax
+  8008bc:	0f 8e c4 fd ff ff    	jle    800686 <vprintfmt+0x31>
+  8008c2:	4c 89 ee             	mov    %r13,%rsi
+  8008c5:	bf 20 00 00 00       	mov    $0x20,%edi
+  8008ca:	41 ff d6             	call   *%r14
+  8008cd:	41 83 ec 01          	sub    $0x1,%r12d
+  8008d1:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8008d5:	75 eb                	jne    8008c2 <vprintfmt+0x26d>
+  8008d7:	e9 aa fd ff ff       	jmp    800686 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8008dc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008e0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008e4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008e8:	eb 92                	jmp    80087c <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8008ea:	49 63 f7             	movslq %r15d,%rsi
+  8008ed:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8008f1:	48 b8 07 0e 80 00 00 	movabs $0x800e07,%rax
+  8008f8:	00 00 00 
+  8008fb:	ff d0                	call   *%rax
+  8008fd:	48 89 c2             	mov    %rax,%rdx
+  800900:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800903:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800905:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800908:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80090b:	85 c0                	test   %eax,%eax
+  80090d:	7e 91                	jle    8008a0 <vprintfmt+0x24b>
+  80090f:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800914:	4c 89 ee             	mov    %r13,%rsi
+  800917:	44 89 e7             	mov    %r12d,%edi
+  80091a:	41 ff d6             	call   *%r14
+  80091d:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800921:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800924:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800927:	75 eb                	jne    800914 <vprintfmt+0x2bf>
+  800929:	e9 72 ff ff ff       	jmp    8008a0 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80092e:	0f b6 f8             	movzbl %al,%edi
+  800931:	4c 89 ee             	mov    %r13,%rsi
+  800934:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800937:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80093b:	49 83 c4 01          	add    $0x1,%r12
+  80093f:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800945:	84 c0                	test   %al,%al
+  800947:	0f 84 66 ff ff ff    	je     8008b3 <vprintfmt+0x25e>
+  80094d:	45 85 ff             	test   %r15d,%r15d
+  800950:	78 0a                	js     80095c <vprintfmt+0x307>
+  800952:	41 83 ef 01          	sub    $0x1,%r15d
+  800956:	0f 88 57 ff ff ff    	js     8008b3 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80095c:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800960:	74 cc                	je     80092e <vprintfmt+0x2d9>
+  800962:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800965:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80096a:	80 fa 5e             	cmp    $0x5e,%dl
+  80096d:	77 c2                	ja     800931 <vprintfmt+0x2dc>
+  80096f:	eb bd                	jmp    80092e <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800971:	40 84 f6             	test   %sil,%sil
+  800974:	75 26                	jne    80099c <vprintfmt+0x347>
+    switch (lflag) {
+  800976:	85 d2                	test   %edx,%edx
+  800978:	74 59                	je     8009d3 <vprintfmt+0x37e>
+  80097a:	83 fa 01             	cmp    $0x1,%edx
+  80097d:	74 7b                	je     8009fa <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  80097f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800982:	83 f8 2f             	cmp    $0x2f,%eax
+  800985:	0f 87 96 00 00 00    	ja     800a21 <vprintfmt+0x3cc>
+  80098b:	89 c2                	mov    %eax,%edx
+  80098d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800991:	83 c0 08             	add    $0x8,%eax
+  800994:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800997:	4c 8b 22             	mov    (%rdx),%r12
+  80099a:	eb 17                	jmp    8009b3 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  80099c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80099f:	83 f8 2f             	cmp    $0x2f,%eax
+  8009a2:	77 21                	ja     8009c5 <vprintfmt+0x370>
+  8009a4:	89 c2                	mov    %eax,%edx
+  8009a6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009aa:	83 c0 08             	add    $0x8,%eax
+  8009ad:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009b0:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8009b3:	4d 85 e4             	test   %r12,%r12
+  8009b6:	78 7a                	js     800a32 <vprintfmt+0x3dd>
+            num = i;
+  8009b8:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8009bb:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8009c0:	e9 50 02 00 00       	jmp    800c15 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009c5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009c9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009cd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009d1:	eb dd                	jmp    8009b0 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8009d3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009d6:	83 f8 2f             	cmp    $0x2f,%eax
+  8009d9:	77 11                	ja     8009ec <vprintfmt+0x397>
+  8009db:	89 c2                	mov    %eax,%edx
+  8009dd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009e1:	83 c0 08             	add    $0x8,%eax
+  8009e4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009e7:	4c 63 22             	movslq (%rdx),%r12
+  8009ea:	eb c7                	jmp    8009b3 <vprintfmt+0x35e>
+  8009ec:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009f0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009f4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009f8:	eb ed                	jmp    8009e7 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8009fa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009fd:	83 f8 2f             	cmp    $0x2f,%eax
+  800a00:	77 11                	ja     800a13 <vprintfmt+0x3be>
+  800a02:	89 c2                	mov    %eax,%edx
+  800a04:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a08:	83 c0 08             	add    $0x8,%eax
+  800a0b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a0e:	4c 8b 22             	mov    (%rdx),%r12
+  800a11:	eb a0                	jmp    8009b3 <vprintfmt+0x35e>
+  800a13:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a17:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a1b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a1f:	eb ed                	jmp    800a0e <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800a21:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a25:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a29:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a2d:	e9 65 ff ff ff       	jmp    800997 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800a32:	4c 89 ee             	mov    %r13,%rsi
+  800a35:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800a3a:	41 ff d6             	call   *%r14
+                i = -i;
+  800a3d:	49 f7 dc             	neg    %r12
+  800a40:	e9 73 ff ff ff       	jmp    8009b8 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800a45:	40 84 f6             	test   %sil,%sil
+  800a48:	75 32                	jne    800a7c <vprintfmt+0x427>
+    switch (lflag) {
+  800a4a:	85 d2                	test   %edx,%edx
+  800a4c:	74 5d                	je     800aab <vprintfmt+0x456>
+  800a4e:	83 fa 01             	cmp    $0x1,%edx
+  800a51:	0f 84 82 00 00 00    	je     800ad9 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800a57:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a5a:	83 f8 2f             	cmp    $0x2f,%eax
+  800a5d:	0f 87 a5 00 00 00    	ja     800b08 <vprintfmt+0x4b3>
+  800a63:	89 c2                	mov    %eax,%edx
+  800a65:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a69:	83 c0 08             	add    $0x8,%eax
+  800a6c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a6f:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a72:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a77:	e9 99 01 00 00       	jmp    800c15 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a7c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a7f:	83 f8 2f             	cmp    $0x2f,%eax
+  800a82:	77 19                	ja     800a9d <vprintfmt+0x448>
+  800a84:	89 c2                	mov    %eax,%edx
+  800a86:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a8a:	83 c0 08             	add    $0x8,%eax
+  800a8d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a90:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a93:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a98:	e9 78 01 00 00       	jmp    800c15 <vprintfmt+0x5c0>
+  800a9d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aa1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aa5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aa9:	eb e5                	jmp    800a90 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800aab:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aae:	83 f8 2f             	cmp    $0x2f,%eax
+  800ab1:	77 18                	ja     800acb <vprintfmt+0x476>
+  800ab3:	89 c2                	mov    %eax,%edx
+  800ab5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ab9:	83 c0 08             	add    $0x8,%eax
+  800abc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800abf:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800ac1:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800ac6:	e9 4a 01 00 00       	jmp    800c15 <vprintfmt+0x5c0>
+  800acb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800acf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ad3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ad7:	eb e6                	jmp    800abf <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800ad9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800adc:	83 f8 2f             	cmp    $0x2f,%eax
+  800adf:	77 19                	ja     800afa <vprintfmt+0x4a5>
+  800ae1:	89 c2                	mov    %eax,%edx
+  800ae3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ae7:	83 c0 08             	add    $0x8,%eax
+  800aea:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aed:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800af0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800af5:	e9 1b 01 00 00       	jmp    800c15 <vprintfmt+0x5c0>
+  800afa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800afe:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b02:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b06:	eb e5                	jmp    800aed <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800b08:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b0c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b10:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b14:	e9 56 ff ff ff       	jmp    800a6f <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800b19:	40 84 f6             	test   %sil,%sil
+  800b1c:	75 2e                	jne    800b4c <vprintfmt+0x4f7>
+    switch (lflag) {
+  800b1e:	85 d2                	test   %edx,%edx
+  800b20:	74 59                	je     800b7b <vprintfmt+0x526>
+  800b22:	83 fa 01             	cmp    $0x1,%edx
+  800b25:	74 7f                	je     800ba6 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800b27:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b2a:	83 f8 2f             	cmp    $0x2f,%eax
+  800b2d:	0f 87 9f 00 00 00    	ja     800bd2 <vprintfmt+0x57d>
+  800b33:	89 c2                	mov    %eax,%edx
+  800b35:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b39:	83 c0 08             	add    $0x8,%eax
+  800b3c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b3f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800b42:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b47:	e9 c9 00 00 00       	jmp    800c15 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b4c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b4f:	83 f8 2f             	cmp    $0x2f,%eax
+  800b52:	77 19                	ja     800b6d <vprintfmt+0x518>
+  800b54:	89 c2                	mov    %eax,%edx
+  800b56:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b5a:	83 c0 08             	add    $0x8,%eax
+  800b5d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b60:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800b63:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b68:	e9 a8 00 00 00       	jmp    800c15 <vprintfmt+0x5c0>
+  800b6d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b71:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b75:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b79:	eb e5                	jmp    800b60 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800b7b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b7e:	83 f8 2f             	cmp    $0x2f,%eax
+  800b81:	77 15                	ja     800b98 <vprintfmt+0x543>
+  800b83:	89 c2                	mov    %eax,%edx
+  800b85:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b89:	83 c0 08             	add    $0x8,%eax
+  800b8c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b8f:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800b91:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800b96:	eb 7d                	jmp    800c15 <vprintfmt+0x5c0>
+  800b98:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b9c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ba0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ba4:	eb e9                	jmp    800b8f <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800ba6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ba9:	83 f8 2f             	cmp    $0x2f,%eax
+  800bac:	77 16                	ja     800bc4 <vprintfmt+0x56f>
+  800bae:	89 c2                	mov    %eax,%edx
+  800bb0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bb4:	83 c0 08             	add    $0x8,%eax
+  800bb7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bba:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800bbd:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800bc2:	eb 51                	jmp    800c15 <vprintfmt+0x5c0>
+  800bc4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bc8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bcc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bd0:	eb e8                	jmp    800bba <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800bd2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bd6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bda:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bde:	e9 5c ff ff ff       	jmp    800b3f <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800be3:	4c 89 ee             	mov    %r13,%rsi
+  800be6:	bf 30 00 00 00       	mov    $0x30,%edi
+  800beb:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800bee:	4c 89 ee             	mov    %r13,%rsi
+  800bf1:	bf 78 00 00 00       	mov    $0x78,%edi
+  800bf6:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800bf9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bfc:	83 f8 2f             	cmp    $0x2f,%eax
+  800bff:	77 47                	ja     800c48 <vprintfmt+0x5f3>
+  800c01:	89 c2                	mov    %eax,%edx
+  800c03:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c07:	83 c0 08             	add    $0x8,%eax
+  800c0a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c0d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c10:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800c15:	48 83 ec 08          	sub    $0x8,%rsp
+  800c19:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800c1d:	0f 94 c0             	sete   %al
+  800c20:	0f b6 c0             	movzbl %al,%eax
+  800c23:	50                   	push   %rax
+  800c24:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800c29:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800c2d:	4c 89 ee             	mov    %r13,%rsi
+  800c30:	4c 89 f7             	mov    %r14,%rdi
+  800c33:	48 b8 4a 05 80 00 00 	movabs $0x80054a,%rax
+  800c3a:	00 00 00 
+  800c3d:	ff d0                	call   *%rax
+            break;
+  800c3f:	48 83 c4 10          	add    $0x10,%rsp
+  800c43:	e9 3e fa ff ff       	jmp    800686 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800c48:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c4c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c50:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c54:	eb b7                	jmp    800c0d <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800c56:	40 84 f6             	test   %sil,%sil
+  800c59:	75 2b                	jne    800c86 <vprintfmt+0x631>
+    switch (lflag) {
+  800c5b:	85 d2                	test   %edx,%edx
+  800c5d:	74 56                	je     800cb5 <vprintfmt+0x660>
+  800c5f:	83 fa 01             	cmp    $0x1,%edx
+  800c62:	74 7f                	je     800ce3 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800c64:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c67:	83 f8 2f             	cmp    $0x2f,%eax
+  800c6a:	0f 87 a2 00 00 00    	ja     800d12 <vprintfmt+0x6bd>
+  800c70:	89 c2                	mov    %eax,%edx
+  800c72:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c76:	83 c0 08             	add    $0x8,%eax
+  800c79:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c7c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c7f:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800c84:	eb 8f                	jmp    800c15 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800c86:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c89:	83 f8 2f             	cmp    $0x2f,%eax
+  800c8c:	77 19                	ja     800ca7 <vprintfmt+0x652>
+  800c8e:	89 c2                	mov    %eax,%edx
+  800c90:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c94:	83 c0 08             	add    $0x8,%eax
+  800c97:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c9a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c9d:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800ca2:	e9 6e ff ff ff       	jmp    800c15 <vprintfmt+0x5c0>
+  800ca7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cab:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800caf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cb3:	eb e5                	jmp    800c9a <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800cb5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cb8:	83 f8 2f             	cmp    $0x2f,%eax
+  800cbb:	77 18                	ja     800cd5 <vprintfmt+0x680>
+  800cbd:	89 c2                	mov    %eax,%edx
+  800cbf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cc3:	83 c0 08             	add    $0x8,%eax
+  800cc6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cc9:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800ccb:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800cd0:	e9 40 ff ff ff       	jmp    800c15 <vprintfmt+0x5c0>
+  800cd5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cd9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cdd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ce1:	eb e6                	jmp    800cc9 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800ce3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ce6:	83 f8 2f             	cmp    $0x2f,%eax
+  800ce9:	77 19                	ja     800d04 <vprintfmt+0x6af>
+  800ceb:	89 c2                	mov    %eax,%edx
+  800ced:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cf1:	83 c0 08             	add    $0x8,%eax
+  800cf4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cf7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800cfa:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800cff:	e9 11 ff ff ff       	jmp    800c15 <vprintfmt+0x5c0>
+  800d04:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d08:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d0c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d10:	eb e5                	jmp    800cf7 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800d12:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d16:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d1a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d1e:	e9 59 ff ff ff       	jmp    800c7c <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800d23:	4c 89 ee             	mov    %r13,%rsi
+  800d26:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d2b:	41 ff d6             	call   *%r14
+            break;
+  800d2e:	e9 53 f9 ff ff       	jmp    800686 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800d33:	4c 89 ee             	mov    %r13,%rsi
+  800d36:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d3b:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800d3e:	48 83 eb 01          	sub    $0x1,%rbx
+  800d42:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800d46:	75 f6                	jne    800d3e <vprintfmt+0x6e9>
+  800d48:	e9 39 f9 ff ff       	jmp    800686 <vprintfmt+0x31>
+}
+  800d4d:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800d51:	5b                   	pop    %rbx
+  800d52:	41 5c                	pop    %r12
+  800d54:	41 5d                	pop    %r13
+  800d56:	41 5e                	pop    %r14
+  800d58:	41 5f                	pop    %r15
+  800d5a:	5d                   	pop    %rbp
+  800d5b:	c3                   	ret
+
+0000000000800d5c <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800d5c:	55                   	push   %rbp
+  800d5d:	48 89 e5             	mov    %rsp,%rbp
+  800d60:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800d64:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800d68:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800d6d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800d71:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800d78:	48 85 ff             	test   %rdi,%rdi
+  800d7b:	74 2b                	je     800da8 <vsnprintf+0x4c>
+  800d7d:	48 85 f6             	test   %rsi,%rsi
+  800d80:	74 26                	je     800da8 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800d82:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800d86:	48 bf 00 06 80 00 00 	movabs $0x800600,%rdi
+  800d8d:	00 00 00 
+  800d90:	48 b8 55 06 80 00 00 	movabs $0x800655,%rax
+  800d97:	00 00 00 
+  800d9a:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800d9c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800da0:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800da3:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800da6:	c9                   	leave
+  800da7:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800da8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800dad:	eb f7                	jmp    800da6 <vsnprintf+0x4a>
+
+0000000000800daf <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800daf:	55                   	push   %rbp
+  800db0:	48 89 e5             	mov    %rsp,%rbp
+  800db3:	48 83 ec 50          	sub    $0x50,%rsp
+  800db7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800dbb:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800dbf:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800dc3:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800dca:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800dce:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dd2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800dd6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800dda:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800dde:	48 b8 5c 0d 80 00 00 	movabs $0x800d5c,%rax
+  800de5:	00 00 00 
+  800de8:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800dea:	c9                   	leave
+  800deb:	c3                   	ret
+
+0000000000800dec <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800dec:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800def:	74 10                	je     800e01 <strlen+0x15>
+    size_t n = 0;
+  800df1:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800df6:	48 83 c0 01          	add    $0x1,%rax
+  800dfa:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800dfe:	75 f6                	jne    800df6 <strlen+0xa>
+  800e00:	c3                   	ret
+    size_t n = 0;
+  800e01:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800e06:	c3                   	ret
+
+0000000000800e07 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800e07:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800e0a:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800e0f:	48 85 f6             	test   %rsi,%rsi
+  800e12:	74 11                	je     800e25 <strnlen+0x1e>
+  800e14:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800e18:	74 0c                	je     800e26 <strnlen+0x1f>
+  800e1a:	48 83 c2 01          	add    $0x1,%rdx
+  800e1e:	48 39 d0             	cmp    %rdx,%rax
+  800e21:	75 f1                	jne    800e14 <strnlen+0xd>
+  800e23:	eb 04                	jmp    800e29 <strnlen+0x22>
+  800e25:	c3                   	ret
+  800e26:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800e29:	c3                   	ret
+
+0000000000800e2a <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800e2a:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800e2d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e32:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800e36:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800e39:	48 83 c2 01          	add    $0x1,%rdx
+  800e3d:	84 c9                	test   %cl,%cl
+  800e3f:	75 f1                	jne    800e32 <strcpy+0x8>
+        ;
+    return res;
+}
+  800e41:	c3                   	ret
+
+0000000000800e42 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800e42:	55                   	push   %rbp
+  800e43:	48 89 e5             	mov    %rsp,%rbp
+  800e46:	41 54                	push   %r12
+  800e48:	53                   	push   %rbx
+  800e49:	48 89 fb             	mov    %rdi,%rbx
+  800e4c:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800e4f:	48 b8 ec 0d 80 00 00 	movabs $0x800dec,%rax
+  800e56:	00 00 00 
+  800e59:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800e5b:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800e5f:	4c 89 e6             	mov    %r12,%rsi
+  800e62:	48 b8 2a 0e 80 00 00 	movabs $0x800e2a,%rax
+  800e69:	00 00 00 
+  800e6c:	ff d0                	call   *%rax
+    return dst;
+}
+  800e6e:	48 89 d8             	mov    %rbx,%rax
+  800e71:	5b                   	pop    %rbx
+  800e72:	41 5c                	pop    %r12
+  800e74:	5d                   	pop    %rbp
+  800e75:	c3                   	ret
+
+0000000000800e76 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800e76:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800e79:	48 85 d2             	test   %rdx,%rdx
+  800e7c:	74 1f                	je     800e9d <strncpy+0x27>
+  800e7e:	48 01 fa             	add    %rdi,%rdx
+  800e81:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800e84:	48 83 c1 01          	add    $0x1,%rcx
+  800e88:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800e8c:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800e90:	41 80 f8 01          	cmp    $0x1,%r8b
+  800e94:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800e98:	48 39 ca             	cmp    %rcx,%rdx
+  800e9b:	75 e7                	jne    800e84 <strncpy+0xe>
+    }
+    return ret;
+}
+  800e9d:	c3                   	ret
+
+0000000000800e9e <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800e9e:	48 89 f8             	mov    %rdi,%rax
+  800ea1:	48 85 d2             	test   %rdx,%rdx
+  800ea4:	74 24                	je     800eca <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800ea6:	48 83 ea 01          	sub    $0x1,%rdx
+  800eaa:	74 1b                	je     800ec7 <strlcpy+0x29>
+  800eac:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800eb0:	0f b6 16             	movzbl (%rsi),%edx
+  800eb3:	84 d2                	test   %dl,%dl
+  800eb5:	74 10                	je     800ec7 <strlcpy+0x29>
+            *dst++ = *src++;
+  800eb7:	48 83 c6 01          	add    $0x1,%rsi
+  800ebb:	48 83 c0 01          	add    $0x1,%rax
+  800ebf:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800ec2:	48 39 c8             	cmp    %rcx,%rax
+  800ec5:	75 e9                	jne    800eb0 <strlcpy+0x12>
+        *dst = '\0';
+  800ec7:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800eca:	48 29 f8             	sub    %rdi,%rax
+}
+  800ecd:	c3                   	ret
+
+0000000000800ece <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800ece:	0f b6 07             	movzbl (%rdi),%eax
+  800ed1:	84 c0                	test   %al,%al
+  800ed3:	74 13                	je     800ee8 <strcmp+0x1a>
+  800ed5:	38 06                	cmp    %al,(%rsi)
+  800ed7:	75 0f                	jne    800ee8 <strcmp+0x1a>
+  800ed9:	48 83 c7 01          	add    $0x1,%rdi
+  800edd:	48 83 c6 01          	add    $0x1,%rsi
+  800ee1:	0f b6 07             	movzbl (%rdi),%eax
+  800ee4:	84 c0                	test   %al,%al
+  800ee6:	75 ed                	jne    800ed5 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800ee8:	0f b6 c0             	movzbl %al,%eax
+  800eeb:	0f b6 16             	movzbl (%rsi),%edx
+  800eee:	29 d0                	sub    %edx,%eax
+}
+  800ef0:	c3                   	ret
+
+0000000000800ef1 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800ef1:	48 85 d2             	test   %rdx,%rdx
+  800ef4:	74 1f                	je     800f15 <strncmp+0x24>
+  800ef6:	0f b6 07             	movzbl (%rdi),%eax
+  800ef9:	84 c0                	test   %al,%al
+  800efb:	74 1e                	je     800f1b <strncmp+0x2a>
+  800efd:	3a 06                	cmp    (%rsi),%al
+  800eff:	75 1a                	jne    800f1b <strncmp+0x2a>
+  800f01:	48 83 c7 01          	add    $0x1,%rdi
+  800f05:	48 83 c6 01          	add    $0x1,%rsi
+  800f09:	48 83 ea 01          	sub    $0x1,%rdx
+  800f0d:	75 e7                	jne    800ef6 <strncmp+0x5>
+
+    if (!n) return 0;
+  800f0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f14:	c3                   	ret
+  800f15:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f1a:	c3                   	ret
+  800f1b:	48 85 d2             	test   %rdx,%rdx
+  800f1e:	74 09                	je     800f29 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f20:	0f b6 07             	movzbl (%rdi),%eax
+  800f23:	0f b6 16             	movzbl (%rsi),%edx
+  800f26:	29 d0                	sub    %edx,%eax
+  800f28:	c3                   	ret
+    if (!n) return 0;
+  800f29:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f2e:	c3                   	ret
+
+0000000000800f2f <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800f2f:	0f b6 17             	movzbl (%rdi),%edx
+  800f32:	84 d2                	test   %dl,%dl
+  800f34:	74 18                	je     800f4e <strchr+0x1f>
+        if (*str == c) {
+  800f36:	0f be d2             	movsbl %dl,%edx
+  800f39:	39 f2                	cmp    %esi,%edx
+  800f3b:	74 17                	je     800f54 <strchr+0x25>
+    for (; *str; str++) {
+  800f3d:	48 83 c7 01          	add    $0x1,%rdi
+  800f41:	0f b6 17             	movzbl (%rdi),%edx
+  800f44:	84 d2                	test   %dl,%dl
+  800f46:	75 ee                	jne    800f36 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800f48:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f4d:	c3                   	ret
+  800f4e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f53:	c3                   	ret
+  800f54:	48 89 f8             	mov    %rdi,%rax
+}
+  800f57:	c3                   	ret
+
+0000000000800f58 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800f58:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800f5b:	0f b6 17             	movzbl (%rdi),%edx
+  800f5e:	84 d2                	test   %dl,%dl
+  800f60:	74 13                	je     800f75 <strfind+0x1d>
+  800f62:	0f be d2             	movsbl %dl,%edx
+  800f65:	39 f2                	cmp    %esi,%edx
+  800f67:	74 0b                	je     800f74 <strfind+0x1c>
+  800f69:	48 83 c0 01          	add    $0x1,%rax
+  800f6d:	0f b6 10             	movzbl (%rax),%edx
+  800f70:	84 d2                	test   %dl,%dl
+  800f72:	75 ee                	jne    800f62 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800f74:	c3                   	ret
+  800f75:	c3                   	ret
+
+0000000000800f76 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800f76:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800f79:	48 89 f8             	mov    %rdi,%rax
+  800f7c:	48 f7 d8             	neg    %rax
+  800f7f:	83 e0 07             	and    $0x7,%eax
+  800f82:	49 89 d1             	mov    %rdx,%r9
+  800f85:	49 29 c1             	sub    %rax,%r9
+  800f88:	78 36                	js     800fc0 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800f8a:	40 0f b6 c6          	movzbl %sil,%eax
+  800f8e:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800f95:	01 01 01 
+  800f98:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800f9c:	40 f6 c7 07          	test   $0x7,%dil
+  800fa0:	75 38                	jne    800fda <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800fa2:	4c 89 c9             	mov    %r9,%rcx
+  800fa5:	48 c1 f9 03          	sar    $0x3,%rcx
+  800fa9:	74 0c                	je     800fb7 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800fab:	fc                   	cld
+  800fac:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800faf:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800fb3:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800fb7:	4d 85 c9             	test   %r9,%r9
+  800fba:	75 45                	jne    801001 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800fbc:	4c 89 c0             	mov    %r8,%rax
+  800fbf:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800fc0:	48 85 d2             	test   %rdx,%rdx
+  800fc3:	74 f7                	je     800fbc <memset+0x46>
+  800fc5:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800fc8:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800fcb:	48 83 c0 01          	add    $0x1,%rax
+  800fcf:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800fd3:	48 39 c2             	cmp    %rax,%rdx
+  800fd6:	75 f3                	jne    800fcb <memset+0x55>
+  800fd8:	eb e2                	jmp    800fbc <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800fda:	40 f6 c7 01          	test   $0x1,%dil
+  800fde:	74 06                	je     800fe6 <memset+0x70>
+  800fe0:	88 07                	mov    %al,(%rdi)
+  800fe2:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800fe6:	40 f6 c7 02          	test   $0x2,%dil
+  800fea:	74 07                	je     800ff3 <memset+0x7d>
+  800fec:	66 89 07             	mov    %ax,(%rdi)
+  800fef:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800ff3:	40 f6 c7 04          	test   $0x4,%dil
+  800ff7:	74 a9                	je     800fa2 <memset+0x2c>
+  800ff9:	89 07                	mov    %eax,(%rdi)
+  800ffb:	48 83 c7 04          	add    $0x4,%rdi
+  800fff:	eb a1                	jmp    800fa2 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801001:	41 f6 c1 04          	test   $0x4,%r9b
+  801005:	74 06                	je     80100d <memset+0x97>
+  801007:	89 07                	mov    %eax,(%rdi)
+  801009:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80100d:	41 f6 c1 02          	test   $0x2,%r9b
+  801011:	74 07                	je     80101a <memset+0xa4>
+  801013:	66 89 07             	mov    %ax,(%rdi)
+  801016:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  80101a:	41 f6 c1 01          	test   $0x1,%r9b
+  80101e:	74 9c                	je     800fbc <memset+0x46>
+  801020:	88 07                	mov    %al,(%rdi)
+  801022:	eb 98                	jmp    800fbc <memset+0x46>
+
+0000000000801024 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  801024:	48 89 f8             	mov    %rdi,%rax
+  801027:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  80102a:	48 39 fe             	cmp    %rdi,%rsi
+  80102d:	73 3b                	jae    80106a <memmove+0x46>
+  80102f:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  801033:	48 39 d7             	cmp    %rdx,%rdi
+  801036:	73 32                	jae    80106a <memmove+0x46>
+        s += n;
+        d += n;
+  801038:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80103c:	48 89 d6             	mov    %rdx,%rsi
+  80103f:	48 09 fe             	or     %rdi,%rsi
+  801042:	48 09 ce             	or     %rcx,%rsi
+  801045:	40 f6 c6 07          	test   $0x7,%sil
+  801049:	75 12                	jne    80105d <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  80104b:	48 83 ef 08          	sub    $0x8,%rdi
+  80104f:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  801053:	48 c1 e9 03          	shr    $0x3,%rcx
+  801057:	fd                   	std
+  801058:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  80105b:	fc                   	cld
+  80105c:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  80105d:	48 83 ef 01          	sub    $0x1,%rdi
+  801061:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  801065:	fd                   	std
+  801066:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801068:	eb f1                	jmp    80105b <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80106a:	48 89 f2             	mov    %rsi,%rdx
+  80106d:	48 09 c2             	or     %rax,%rdx
+  801070:	48 09 ca             	or     %rcx,%rdx
+  801073:	f6 c2 07             	test   $0x7,%dl
+  801076:	75 0c                	jne    801084 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801078:	48 c1 e9 03          	shr    $0x3,%rcx
+  80107c:	48 89 c7             	mov    %rax,%rdi
+  80107f:	fc                   	cld
+  801080:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801083:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801084:	48 89 c7             	mov    %rax,%rdi
+  801087:	fc                   	cld
+  801088:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  80108a:	c3                   	ret
+
+000000000080108b <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80108b:	55                   	push   %rbp
+  80108c:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  80108f:	48 b8 24 10 80 00 00 	movabs $0x801024,%rax
+  801096:	00 00 00 
+  801099:	ff d0                	call   *%rax
+}
+  80109b:	5d                   	pop    %rbp
+  80109c:	c3                   	ret
+
+000000000080109d <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80109d:	55                   	push   %rbp
+  80109e:	48 89 e5             	mov    %rsp,%rbp
+  8010a1:	41 57                	push   %r15
+  8010a3:	41 56                	push   %r14
+  8010a5:	41 55                	push   %r13
+  8010a7:	41 54                	push   %r12
+  8010a9:	53                   	push   %rbx
+  8010aa:	48 83 ec 08          	sub    $0x8,%rsp
+  8010ae:	49 89 fe             	mov    %rdi,%r14
+  8010b1:	49 89 f7             	mov    %rsi,%r15
+  8010b4:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8010b7:	48 89 f7             	mov    %rsi,%rdi
+  8010ba:	48 b8 ec 0d 80 00 00 	movabs $0x800dec,%rax
+  8010c1:	00 00 00 
+  8010c4:	ff d0                	call   *%rax
+  8010c6:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8010c9:	48 89 de             	mov    %rbx,%rsi
+  8010cc:	4c 89 f7             	mov    %r14,%rdi
+  8010cf:	48 b8 07 0e 80 00 00 	movabs $0x800e07,%rax
+  8010d6:	00 00 00 
+  8010d9:	ff d0                	call   *%rax
+  8010db:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8010de:	48 39 c3             	cmp    %rax,%rbx
+  8010e1:	74 36                	je     801119 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8010e3:	48 89 d8             	mov    %rbx,%rax
+  8010e6:	4c 29 e8             	sub    %r13,%rax
+  8010e9:	49 39 c4             	cmp    %rax,%r12
+  8010ec:	73 31                	jae    80111f <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8010ee:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8010f3:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8010f7:	4c 89 fe             	mov    %r15,%rsi
+  8010fa:	48 b8 8b 10 80 00 00 	movabs $0x80108b,%rax
+  801101:	00 00 00 
+  801104:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801106:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80110a:	48 83 c4 08          	add    $0x8,%rsp
+  80110e:	5b                   	pop    %rbx
+  80110f:	41 5c                	pop    %r12
+  801111:	41 5d                	pop    %r13
+  801113:	41 5e                	pop    %r14
+  801115:	41 5f                	pop    %r15
+  801117:	5d                   	pop    %rbp
+  801118:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801119:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80111d:	eb eb                	jmp    80110a <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  80111f:	48 83 eb 01          	sub    $0x1,%rbx
+  801123:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801127:	48 89 da             	mov    %rbx,%rdx
+  80112a:	4c 89 fe             	mov    %r15,%rsi
+  80112d:	48 b8 8b 10 80 00 00 	movabs $0x80108b,%rax
+  801134:	00 00 00 
+  801137:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801139:	49 01 de             	add    %rbx,%r14
+  80113c:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801141:	eb c3                	jmp    801106 <strlcat+0x69>
+
+0000000000801143 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801143:	48 85 d2             	test   %rdx,%rdx
+  801146:	74 2d                	je     801175 <memcmp+0x32>
+  801148:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80114d:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801151:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801156:	44 38 c1             	cmp    %r8b,%cl
+  801159:	75 0f                	jne    80116a <memcmp+0x27>
+    while (n-- > 0) {
+  80115b:	48 83 c0 01          	add    $0x1,%rax
+  80115f:	48 39 c2             	cmp    %rax,%rdx
+  801162:	75 e9                	jne    80114d <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801164:	b8 00 00 00 00       	mov    $0x0,%eax
+  801169:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80116a:	0f b6 c1             	movzbl %cl,%eax
+  80116d:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801171:	44 29 c0             	sub    %r8d,%eax
+  801174:	c3                   	ret
+    return 0;
+  801175:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80117a:	c3                   	ret
+
+000000000080117b <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80117b:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80117f:	48 39 c7             	cmp    %rax,%rdi
+  801182:	73 0f                	jae    801193 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801184:	40 38 37             	cmp    %sil,(%rdi)
+  801187:	74 0e                	je     801197 <memfind+0x1c>
+    for (; src < end; src++) {
+  801189:	48 83 c7 01          	add    $0x1,%rdi
+  80118d:	48 39 f8             	cmp    %rdi,%rax
+  801190:	75 f2                	jne    801184 <memfind+0x9>
+  801192:	c3                   	ret
+  801193:	48 89 f8             	mov    %rdi,%rax
+  801196:	c3                   	ret
+  801197:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80119a:	c3                   	ret
+
+000000000080119b <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80119b:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80119e:	0f b6 37             	movzbl (%rdi),%esi
+  8011a1:	40 80 fe 20          	cmp    $0x20,%sil
+  8011a5:	74 06                	je     8011ad <strtol+0x12>
+  8011a7:	40 80 fe 09          	cmp    $0x9,%sil
+  8011ab:	75 13                	jne    8011c0 <strtol+0x25>
+  8011ad:	48 83 c7 01          	add    $0x1,%rdi
+  8011b1:	0f b6 37             	movzbl (%rdi),%esi
+  8011b4:	40 80 fe 20          	cmp    $0x20,%sil
+  8011b8:	74 f3                	je     8011ad <strtol+0x12>
+  8011ba:	40 80 fe 09          	cmp    $0x9,%sil
+  8011be:	74 ed                	je     8011ad <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8011c0:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8011c3:	83 e0 fd             	and    $0xfffffffd,%eax
+  8011c6:	3c 01                	cmp    $0x1,%al
+  8011c8:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8011cc:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8011d2:	75 0f                	jne    8011e3 <strtol+0x48>
+  8011d4:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8011d7:	74 14                	je     8011ed <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8011d9:	85 d2                	test   %edx,%edx
+  8011db:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8011e0:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8011e3:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8011e8:	4c 63 ca             	movslq %edx,%r9
+  8011eb:	eb 36                	jmp    801223 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8011ed:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8011f1:	74 0f                	je     801202 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8011f3:	85 d2                	test   %edx,%edx
+  8011f5:	75 ec                	jne    8011e3 <strtol+0x48>
+        s++;
+  8011f7:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8011fb:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801200:	eb e1                	jmp    8011e3 <strtol+0x48>
+        s += 2;
+  801202:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801206:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80120b:	eb d6                	jmp    8011e3 <strtol+0x48>
+            dig -= '0';
+  80120d:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801210:	44 0f b6 c1          	movzbl %cl,%r8d
+  801214:	41 39 d0             	cmp    %edx,%r8d
+  801217:	7d 21                	jge    80123a <strtol+0x9f>
+        val = val * base + dig;
+  801219:	49 0f af c1          	imul   %r9,%rax
+  80121d:	0f b6 c9             	movzbl %cl,%ecx
+  801220:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801223:	48 83 c7 01          	add    $0x1,%rdi
+  801227:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80122b:	80 f9 39             	cmp    $0x39,%cl
+  80122e:	76 dd                	jbe    80120d <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801230:	80 f9 7b             	cmp    $0x7b,%cl
+  801233:	77 05                	ja     80123a <strtol+0x9f>
+            dig -= 'a' - 10;
+  801235:	83 e9 57             	sub    $0x57,%ecx
+  801238:	eb d6                	jmp    801210 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  80123a:	4d 85 d2             	test   %r10,%r10
+  80123d:	74 03                	je     801242 <strtol+0xa7>
+  80123f:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801242:	48 89 c2             	mov    %rax,%rdx
+  801245:	48 f7 da             	neg    %rdx
+  801248:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80124c:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801250:	c3                   	ret
+
+0000000000801251 <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  801251:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801256:	ba 00 00 00 00       	mov    $0x0,%edx
+  80125b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801261:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801267:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  80126d:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80126f:	c3                   	ret
+
+0000000000801270 <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  801270:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801275:	bf 00 00 00 00       	mov    $0x0,%edi
+  80127a:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80127f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801284:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80128a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801290:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801296:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801298:	c3                   	ret
+
+0000000000801299 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801299:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80129c:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8012a1:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8012a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012ab:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8012b1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8012b7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8012bd:	0f 05                	syscall
+    if (check && ret > 0) {
+  8012bf:	48 85 c0             	test   %rax,%rax
+  8012c2:	7f 01                	jg     8012c5 <sys_env_destroy+0x2c>
+}
+  8012c4:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  8012c5:	55                   	push   %rbp
+  8012c6:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012c9:	49 89 c0             	mov    %rax,%r8
+  8012cc:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8012d1:	48 ba 78 4f 80 00 00 	movabs $0x804f78,%rdx
+  8012d8:	00 00 00 
+  8012db:	be 29 00 00 00       	mov    $0x29,%esi
+  8012e0:	48 bf 97 4f 80 00 00 	movabs $0x804f97,%rdi
+  8012e7:	00 00 00 
+  8012ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012ef:	49 b9 b1 44 80 00 00 	movabs $0x8044b1,%r9
+  8012f6:	00 00 00 
+  8012f9:	41 ff d1             	call   *%r9
+
+00000000008012fc <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  8012fc:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801301:	bf 00 00 00 00       	mov    $0x0,%edi
+  801306:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80130b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801310:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801316:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80131c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801322:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801324:	c3                   	ret
+
+0000000000801325 <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  801325:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80132a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80132f:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801334:	ba 00 00 00 00       	mov    $0x0,%edx
+  801339:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80133f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801345:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80134b:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80134d:	c3                   	ret
+
+000000000080134e <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  80134e:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801353:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  80135a:	00 00 00 
+  80135d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801363:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801369:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80136f:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801371:	c3                   	ret
+
+0000000000801372 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801372:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  801375:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80137a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801380:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801386:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801388:	c3                   	ret
+
+0000000000801389 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801389:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80138c:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801391:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801394:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80139a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013a0:	0f 05                	syscall
+    if (check && ret > 0) {
+  8013a2:	48 85 c0             	test   %rax,%rax
+  8013a5:	7f 01                	jg     8013a8 <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8013a7:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8013a8:	55                   	push   %rbp
+  8013a9:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013ac:	49 89 c0             	mov    %rax,%r8
+  8013af:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8013b4:	48 ba 78 4f 80 00 00 	movabs $0x804f78,%rdx
+  8013bb:	00 00 00 
+  8013be:	be 29 00 00 00       	mov    $0x29,%esi
+  8013c3:	48 bf 97 4f 80 00 00 	movabs $0x804f97,%rdi
+  8013ca:	00 00 00 
+  8013cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013d2:	49 b9 b1 44 80 00 00 	movabs $0x8044b1,%r9
+  8013d9:	00 00 00 
+  8013dc:	41 ff d1             	call   *%r9
+
+00000000008013df <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8013df:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8013e2:	48 63 d2             	movslq %edx,%rdx
+  8013e5:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8013e8:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013ed:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  8013f0:	0f 05                	syscall
+    if (check && ret > 0) {
+  8013f2:	48 85 c0             	test   %rax,%rax
+  8013f5:	7f 01                	jg     8013f8 <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8013f7:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8013f8:	55                   	push   %rbp
+  8013f9:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013fc:	49 89 c0             	mov    %rax,%r8
+  8013ff:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801404:	48 ba 78 4f 80 00 00 	movabs $0x804f78,%rdx
+  80140b:	00 00 00 
+  80140e:	be 29 00 00 00       	mov    $0x29,%esi
+  801413:	48 bf 97 4f 80 00 00 	movabs $0x804f97,%rdi
+  80141a:	00 00 00 
+  80141d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801422:	49 b9 b1 44 80 00 00 	movabs $0x8044b1,%r9
+  801429:	00 00 00 
+  80142c:	41 ff d1             	call   *%r9
+
+000000000080142f <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80142f:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801432:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801437:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80143d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801443:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801449:	0f 05                	syscall
+    if (check && ret > 0) {
+  80144b:	48 85 c0             	test   %rax,%rax
+  80144e:	7f 01                	jg     801451 <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801450:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801451:	55                   	push   %rbp
+  801452:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801455:	49 89 c0             	mov    %rax,%r8
+  801458:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80145d:	48 ba 78 4f 80 00 00 	movabs $0x804f78,%rdx
+  801464:	00 00 00 
+  801467:	be 29 00 00 00       	mov    $0x29,%esi
+  80146c:	48 bf 97 4f 80 00 00 	movabs $0x804f97,%rdi
+  801473:	00 00 00 
+  801476:	b8 00 00 00 00       	mov    $0x0,%eax
+  80147b:	49 b9 b1 44 80 00 00 	movabs $0x8044b1,%r9
+  801482:	00 00 00 
+  801485:	41 ff d1             	call   *%r9
+
+0000000000801488 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801488:	48 63 f6             	movslq %esi,%rsi
+  80148b:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80148e:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801493:	ba 00 00 00 00       	mov    $0x0,%edx
+  801498:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80149e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014a4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8014aa:	0f 05                	syscall
+    if (check && ret > 0) {
+  8014ac:	48 85 c0             	test   %rax,%rax
+  8014af:	7f 01                	jg     8014b2 <sys_env_set_status+0x2a>
+}
+  8014b1:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  8014b2:	55                   	push   %rbp
+  8014b3:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014b6:	49 89 c0             	mov    %rax,%r8
+  8014b9:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8014be:	48 ba 78 4f 80 00 00 	movabs $0x804f78,%rdx
+  8014c5:	00 00 00 
+  8014c8:	be 29 00 00 00       	mov    $0x29,%esi
+  8014cd:	48 bf 97 4f 80 00 00 	movabs $0x804f97,%rdi
+  8014d4:	00 00 00 
+  8014d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014dc:	49 b9 b1 44 80 00 00 	movabs $0x8044b1,%r9
+  8014e3:	00 00 00 
+  8014e6:	41 ff d1             	call   *%r9
+
+00000000008014e9 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8014e9:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8014ec:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8014f1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014f6:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014fc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801502:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801508:	0f 05                	syscall
+    if (check && ret > 0) {
+  80150a:	48 85 c0             	test   %rax,%rax
+  80150d:	7f 01                	jg     801510 <sys_env_set_trapframe+0x27>
+}
+  80150f:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801510:	55                   	push   %rbp
+  801511:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801514:	49 89 c0             	mov    %rax,%r8
+  801517:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80151c:	48 ba 78 4f 80 00 00 	movabs $0x804f78,%rdx
+  801523:	00 00 00 
+  801526:	be 29 00 00 00       	mov    $0x29,%esi
+  80152b:	48 bf 97 4f 80 00 00 	movabs $0x804f97,%rdi
+  801532:	00 00 00 
+  801535:	b8 00 00 00 00       	mov    $0x0,%eax
+  80153a:	49 b9 b1 44 80 00 00 	movabs $0x8044b1,%r9
+  801541:	00 00 00 
+  801544:	41 ff d1             	call   *%r9
+
+0000000000801547 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801547:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80154a:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80154f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801554:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80155a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801560:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801566:	0f 05                	syscall
+    if (check && ret > 0) {
+  801568:	48 85 c0             	test   %rax,%rax
+  80156b:	7f 01                	jg     80156e <sys_env_set_pgfault_upcall+0x27>
+}
+  80156d:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80156e:	55                   	push   %rbp
+  80156f:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801572:	49 89 c0             	mov    %rax,%r8
+  801575:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80157a:	48 ba 78 4f 80 00 00 	movabs $0x804f78,%rdx
+  801581:	00 00 00 
+  801584:	be 29 00 00 00       	mov    $0x29,%esi
+  801589:	48 bf 97 4f 80 00 00 	movabs $0x804f97,%rdi
+  801590:	00 00 00 
+  801593:	b8 00 00 00 00       	mov    $0x0,%eax
+  801598:	49 b9 b1 44 80 00 00 	movabs $0x8044b1,%r9
+  80159f:	00 00 00 
+  8015a2:	41 ff d1             	call   *%r9
+
+00000000008015a5 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8015a5:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8015a8:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8015ab:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8015b0:	4d 63 c0             	movslq %r8d,%r8
+  8015b3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8015b9:	0f 05                	syscall
+}
+  8015bb:	c3                   	ret
+
+00000000008015bc <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8015bc:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8015bf:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8015c2:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8015c7:	4d 63 c0             	movslq %r8d,%r8
+  8015ca:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8015d0:	0f 05                	syscall
+}
+  8015d2:	c3                   	ret
+
+00000000008015d3 <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  8015d3:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8015d8:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8015db:	45 89 c0             	mov    %r8d,%r8d
+  8015de:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8015e4:	0f 05                	syscall
+    if (check && ret > 0) {
+  8015e6:	48 85 c0             	test   %rax,%rax
+  8015e9:	7f 01                	jg     8015ec <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8015eb:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8015ec:	55                   	push   %rbp
+  8015ed:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015f0:	49 89 c0             	mov    %rax,%r8
+  8015f3:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8015f8:	48 ba 78 4f 80 00 00 	movabs $0x804f78,%rdx
+  8015ff:	00 00 00 
+  801602:	be 29 00 00 00       	mov    $0x29,%esi
+  801607:	48 bf 97 4f 80 00 00 	movabs $0x804f97,%rdi
+  80160e:	00 00 00 
+  801611:	b8 00 00 00 00       	mov    $0x0,%eax
+  801616:	49 b9 b1 44 80 00 00 	movabs $0x8044b1,%r9
+  80161d:	00 00 00 
+  801620:	41 ff d1             	call   *%r9
+
+0000000000801623 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  801623:	55                   	push   %rbp
+  801624:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  801627:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80162d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801632:	ba 00 00 00 00       	mov    $0x0,%edx
+  801637:	48 b8 d3 15 80 00 00 	movabs $0x8015d3,%rax
+  80163e:	00 00 00 
+  801641:	ff d0                	call   *%rax
+}
+  801643:	5d                   	pop    %rbp
+  801644:	c3                   	ret
+
+0000000000801645 <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  801645:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80164a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80164f:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801654:	ba 00 00 00 00       	mov    $0x0,%edx
+  801659:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80165f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801665:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80166b:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80166d:	c3                   	ret
+
+000000000080166e <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  80166e:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801673:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801678:	ba 00 00 00 00       	mov    $0x0,%edx
+  80167d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801683:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801689:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80168f:	0f 05                	syscall
+    if (check && ret > 0) {
+  801691:	48 85 c0             	test   %rax,%rax
+  801694:	7f 01                	jg     801697 <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  801696:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  801697:	55                   	push   %rbp
+  801698:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80169b:	49 89 c0             	mov    %rax,%r8
+  80169e:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8016a3:	48 ba 78 4f 80 00 00 	movabs $0x804f78,%rdx
+  8016aa:	00 00 00 
+  8016ad:	be 29 00 00 00       	mov    $0x29,%esi
+  8016b2:	48 bf 97 4f 80 00 00 	movabs $0x804f97,%rdi
+  8016b9:	00 00 00 
+  8016bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016c1:	49 b9 b1 44 80 00 00 	movabs $0x8044b1,%r9
+  8016c8:	00 00 00 
+  8016cb:	41 ff d1             	call   *%r9
+
+00000000008016ce <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  8016ce:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8016d3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8016d8:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8016dd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016e2:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8016e8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8016ee:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8016f4:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  8016f6:	c3                   	ret
+
+00000000008016f7 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  8016f7:	89 d2                	mov    %edx,%edx
+  8016f9:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  8016fb:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801700:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801706:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80170c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801712:	0f 05                	syscall
+}
+  801714:	c3                   	ret
+
+0000000000801715 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  801715:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  801718:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80171d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801722:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801728:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80172e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801734:	0f 05                	syscall
+}
+  801736:	c3                   	ret
+
+0000000000801737 <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  801737:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  80173a:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80173f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801744:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80174a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801750:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801756:	0f 05                	syscall
+}
+  801758:	c3                   	ret
+
+0000000000801759 <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  801759:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80175c:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801761:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801766:	ba 00 00 00 00       	mov    $0x0,%edx
+  80176b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801771:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801777:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80177d:	0f 05                	syscall
+    if (check && ret > 0) {
+  80177f:	48 85 c0             	test   %rax,%rax
+  801782:	7f 01                	jg     801785 <sys_irq_ack+0x2c>
+}
+  801784:	c3                   	ret
+sys_irq_ack(int irq) {
+  801785:	55                   	push   %rbp
+  801786:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801789:	49 89 c0             	mov    %rax,%r8
+  80178c:	b9 16 00 00 00       	mov    $0x16,%ecx
+  801791:	48 ba 78 4f 80 00 00 	movabs $0x804f78,%rdx
+  801798:	00 00 00 
+  80179b:	be 29 00 00 00       	mov    $0x29,%esi
+  8017a0:	48 bf 97 4f 80 00 00 	movabs $0x804f97,%rdi
+  8017a7:	00 00 00 
+  8017aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017af:	49 b9 b1 44 80 00 00 	movabs $0x8044b1,%r9
+  8017b6:	00 00 00 
+  8017b9:	41 ff d1             	call   *%r9
+
+00000000008017bc <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8017bc:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8017c3:	ff ff ff 
+  8017c6:	48 01 f8             	add    %rdi,%rax
+  8017c9:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8017cd:	c3                   	ret
+
+00000000008017ce <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8017ce:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8017d5:	ff ff ff 
+  8017d8:	48 01 f8             	add    %rdi,%rax
+  8017db:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8017df:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8017e5:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8017e9:	c3                   	ret
+
+00000000008017ea <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8017ea:	55                   	push   %rbp
+  8017eb:	48 89 e5             	mov    %rsp,%rbp
+  8017ee:	41 57                	push   %r15
+  8017f0:	41 56                	push   %r14
+  8017f2:	41 55                	push   %r13
+  8017f4:	41 54                	push   %r12
+  8017f6:	53                   	push   %rbx
+  8017f7:	48 83 ec 08          	sub    $0x8,%rsp
+  8017fb:	49 89 ff             	mov    %rdi,%r15
+  8017fe:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801803:	49 bd 79 3f 80 00 00 	movabs $0x803f79,%r13
+  80180a:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  80180d:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801813:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801816:	48 89 df             	mov    %rbx,%rdi
+  801819:	41 ff d5             	call   *%r13
+  80181c:	83 e0 04             	and    $0x4,%eax
+  80181f:	74 17                	je     801838 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801821:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801828:	4c 39 f3             	cmp    %r14,%rbx
+  80182b:	75 e6                	jne    801813 <fd_alloc+0x29>
+  80182d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801833:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801838:	4d 89 27             	mov    %r12,(%r15)
+}
+  80183b:	48 83 c4 08          	add    $0x8,%rsp
+  80183f:	5b                   	pop    %rbx
+  801840:	41 5c                	pop    %r12
+  801842:	41 5d                	pop    %r13
+  801844:	41 5e                	pop    %r14
+  801846:	41 5f                	pop    %r15
+  801848:	5d                   	pop    %rbp
+  801849:	c3                   	ret
+
+000000000080184a <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  80184a:	83 ff 1f             	cmp    $0x1f,%edi
+  80184d:	77 39                	ja     801888 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80184f:	55                   	push   %rbp
+  801850:	48 89 e5             	mov    %rsp,%rbp
+  801853:	41 54                	push   %r12
+  801855:	53                   	push   %rbx
+  801856:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801859:	48 63 df             	movslq %edi,%rbx
+  80185c:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801863:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801867:	48 89 df             	mov    %rbx,%rdi
+  80186a:	48 b8 79 3f 80 00 00 	movabs $0x803f79,%rax
+  801871:	00 00 00 
+  801874:	ff d0                	call   *%rax
+  801876:	a8 04                	test   $0x4,%al
+  801878:	74 14                	je     80188e <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  80187a:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  80187e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801883:	5b                   	pop    %rbx
+  801884:	41 5c                	pop    %r12
+  801886:	5d                   	pop    %rbp
+  801887:	c3                   	ret
+        return -E_INVAL;
+  801888:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80188d:	c3                   	ret
+        return -E_INVAL;
+  80188e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801893:	eb ee                	jmp    801883 <fd_lookup+0x39>
+
+0000000000801895 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801895:	55                   	push   %rbp
+  801896:	48 89 e5             	mov    %rsp,%rbp
+  801899:	41 54                	push   %r12
+  80189b:	53                   	push   %rbx
+  80189c:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  80189f:	48 b8 40 50 80 00 00 	movabs $0x805040,%rax
+  8018a6:	00 00 00 
+  8018a9:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  8018b0:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8018b3:	39 3b                	cmp    %edi,(%rbx)
+  8018b5:	74 47                	je     8018fe <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8018b7:	48 83 c0 08          	add    $0x8,%rax
+  8018bb:	48 8b 18             	mov    (%rax),%rbx
+  8018be:	48 85 db             	test   %rbx,%rbx
+  8018c1:	75 f0                	jne    8018b3 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8018c3:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8018ca:	00 00 00 
+  8018cd:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8018d3:	89 fa                	mov    %edi,%edx
+  8018d5:	48 bf a8 4f 80 00 00 	movabs $0x804fa8,%rdi
+  8018dc:	00 00 00 
+  8018df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018e4:	48 b9 05 05 80 00 00 	movabs $0x800505,%rcx
+  8018eb:	00 00 00 
+  8018ee:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8018f0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8018f5:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8018f9:	5b                   	pop    %rbx
+  8018fa:	41 5c                	pop    %r12
+  8018fc:	5d                   	pop    %rbp
+  8018fd:	c3                   	ret
+            return 0;
+  8018fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  801903:	eb f0                	jmp    8018f5 <dev_lookup+0x60>
+
+0000000000801905 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801905:	55                   	push   %rbp
+  801906:	48 89 e5             	mov    %rsp,%rbp
+  801909:	41 55                	push   %r13
+  80190b:	41 54                	push   %r12
+  80190d:	53                   	push   %rbx
+  80190e:	48 83 ec 18          	sub    $0x18,%rsp
+  801912:	48 89 fb             	mov    %rdi,%rbx
+  801915:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801918:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80191f:	ff ff ff 
+  801922:	48 01 df             	add    %rbx,%rdi
+  801925:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801929:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80192d:	48 b8 4a 18 80 00 00 	movabs $0x80184a,%rax
+  801934:	00 00 00 
+  801937:	ff d0                	call   *%rax
+  801939:	41 89 c5             	mov    %eax,%r13d
+  80193c:	85 c0                	test   %eax,%eax
+  80193e:	78 06                	js     801946 <fd_close+0x41>
+  801940:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801944:	74 1a                	je     801960 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801946:	45 84 e4             	test   %r12b,%r12b
+  801949:	b8 00 00 00 00       	mov    $0x0,%eax
+  80194e:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801952:	44 89 e8             	mov    %r13d,%eax
+  801955:	48 83 c4 18          	add    $0x18,%rsp
+  801959:	5b                   	pop    %rbx
+  80195a:	41 5c                	pop    %r12
+  80195c:	41 5d                	pop    %r13
+  80195e:	5d                   	pop    %rbp
+  80195f:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801960:	8b 3b                	mov    (%rbx),%edi
+  801962:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801966:	48 b8 95 18 80 00 00 	movabs $0x801895,%rax
+  80196d:	00 00 00 
+  801970:	ff d0                	call   *%rax
+  801972:	41 89 c5             	mov    %eax,%r13d
+  801975:	85 c0                	test   %eax,%eax
+  801977:	78 1b                	js     801994 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801979:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80197d:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801981:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801987:	48 85 c0             	test   %rax,%rax
+  80198a:	74 08                	je     801994 <fd_close+0x8f>
+  80198c:	48 89 df             	mov    %rbx,%rdi
+  80198f:	ff d0                	call   *%rax
+  801991:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801994:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801999:	48 89 de             	mov    %rbx,%rsi
+  80199c:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019a1:	48 b8 2f 14 80 00 00 	movabs $0x80142f,%rax
+  8019a8:	00 00 00 
+  8019ab:	ff d0                	call   *%rax
+    return res;
+  8019ad:	eb a3                	jmp    801952 <fd_close+0x4d>
+
+00000000008019af <close>:
+
+int
+close(int fdnum) {
+  8019af:	55                   	push   %rbp
+  8019b0:	48 89 e5             	mov    %rsp,%rbp
+  8019b3:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8019b7:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8019bb:	48 b8 4a 18 80 00 00 	movabs $0x80184a,%rax
+  8019c2:	00 00 00 
+  8019c5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8019c7:	85 c0                	test   %eax,%eax
+  8019c9:	78 15                	js     8019e0 <close+0x31>
+
+    return fd_close(fd, 1);
+  8019cb:	be 01 00 00 00       	mov    $0x1,%esi
+  8019d0:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8019d4:	48 b8 05 19 80 00 00 	movabs $0x801905,%rax
+  8019db:	00 00 00 
+  8019de:	ff d0                	call   *%rax
+}
+  8019e0:	c9                   	leave
+  8019e1:	c3                   	ret
+
+00000000008019e2 <close_all>:
+
+void
+close_all(void) {
+  8019e2:	55                   	push   %rbp
+  8019e3:	48 89 e5             	mov    %rsp,%rbp
+  8019e6:	41 54                	push   %r12
+  8019e8:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8019e9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019ee:	49 bc af 19 80 00 00 	movabs $0x8019af,%r12
+  8019f5:	00 00 00 
+  8019f8:	89 df                	mov    %ebx,%edi
+  8019fa:	41 ff d4             	call   *%r12
+  8019fd:	83 c3 01             	add    $0x1,%ebx
+  801a00:	83 fb 20             	cmp    $0x20,%ebx
+  801a03:	75 f3                	jne    8019f8 <close_all+0x16>
+}
+  801a05:	5b                   	pop    %rbx
+  801a06:	41 5c                	pop    %r12
+  801a08:	5d                   	pop    %rbp
+  801a09:	c3                   	ret
+
+0000000000801a0a <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801a0a:	55                   	push   %rbp
+  801a0b:	48 89 e5             	mov    %rsp,%rbp
+  801a0e:	41 57                	push   %r15
+  801a10:	41 56                	push   %r14
+  801a12:	41 55                	push   %r13
+  801a14:	41 54                	push   %r12
+  801a16:	53                   	push   %rbx
+  801a17:	48 83 ec 18          	sub    $0x18,%rsp
+  801a1b:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801a1e:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801a22:	48 b8 4a 18 80 00 00 	movabs $0x80184a,%rax
+  801a29:	00 00 00 
+  801a2c:	ff d0                	call   *%rax
+  801a2e:	89 c3                	mov    %eax,%ebx
+  801a30:	85 c0                	test   %eax,%eax
+  801a32:	0f 88 b8 00 00 00    	js     801af0 <dup+0xe6>
+    close(newfdnum);
+  801a38:	44 89 e7             	mov    %r12d,%edi
+  801a3b:	48 b8 af 19 80 00 00 	movabs $0x8019af,%rax
+  801a42:	00 00 00 
+  801a45:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801a47:	4d 63 ec             	movslq %r12d,%r13
+  801a4a:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801a51:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801a55:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801a59:	4c 89 ff             	mov    %r15,%rdi
+  801a5c:	49 be ce 17 80 00 00 	movabs $0x8017ce,%r14
+  801a63:	00 00 00 
+  801a66:	41 ff d6             	call   *%r14
+  801a69:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801a6c:	4c 89 ef             	mov    %r13,%rdi
+  801a6f:	41 ff d6             	call   *%r14
+  801a72:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801a75:	48 89 df             	mov    %rbx,%rdi
+  801a78:	48 b8 79 3f 80 00 00 	movabs $0x803f79,%rax
+  801a7f:	00 00 00 
+  801a82:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801a84:	a8 04                	test   $0x4,%al
+  801a86:	74 2b                	je     801ab3 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801a88:	41 89 c1             	mov    %eax,%r9d
+  801a8b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801a91:	4c 89 f1             	mov    %r14,%rcx
+  801a94:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a99:	48 89 de             	mov    %rbx,%rsi
+  801a9c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801aa1:	48 b8 df 13 80 00 00 	movabs $0x8013df,%rax
+  801aa8:	00 00 00 
+  801aab:	ff d0                	call   *%rax
+  801aad:	89 c3                	mov    %eax,%ebx
+  801aaf:	85 c0                	test   %eax,%eax
+  801ab1:	78 4e                	js     801b01 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801ab3:	4c 89 ff             	mov    %r15,%rdi
+  801ab6:	48 b8 79 3f 80 00 00 	movabs $0x803f79,%rax
+  801abd:	00 00 00 
+  801ac0:	ff d0                	call   *%rax
+  801ac2:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801ac5:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801acb:	4c 89 e9             	mov    %r13,%rcx
+  801ace:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ad3:	4c 89 fe             	mov    %r15,%rsi
+  801ad6:	bf 00 00 00 00       	mov    $0x0,%edi
+  801adb:	48 b8 df 13 80 00 00 	movabs $0x8013df,%rax
+  801ae2:	00 00 00 
+  801ae5:	ff d0                	call   *%rax
+  801ae7:	89 c3                	mov    %eax,%ebx
+  801ae9:	85 c0                	test   %eax,%eax
+  801aeb:	78 14                	js     801b01 <dup+0xf7>
+
+    return newfdnum;
+  801aed:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801af0:	89 d8                	mov    %ebx,%eax
+  801af2:	48 83 c4 18          	add    $0x18,%rsp
+  801af6:	5b                   	pop    %rbx
+  801af7:	41 5c                	pop    %r12
+  801af9:	41 5d                	pop    %r13
+  801afb:	41 5e                	pop    %r14
+  801afd:	41 5f                	pop    %r15
+  801aff:	5d                   	pop    %rbp
+  801b00:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801b01:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801b06:	4c 89 ee             	mov    %r13,%rsi
+  801b09:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b0e:	49 bc 2f 14 80 00 00 	movabs $0x80142f,%r12
+  801b15:	00 00 00 
+  801b18:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801b1b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801b20:	4c 89 f6             	mov    %r14,%rsi
+  801b23:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b28:	41 ff d4             	call   *%r12
+    return res;
+  801b2b:	eb c3                	jmp    801af0 <dup+0xe6>
+
+0000000000801b2d <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801b2d:	55                   	push   %rbp
+  801b2e:	48 89 e5             	mov    %rsp,%rbp
+  801b31:	41 56                	push   %r14
+  801b33:	41 55                	push   %r13
+  801b35:	41 54                	push   %r12
+  801b37:	53                   	push   %rbx
+  801b38:	48 83 ec 10          	sub    $0x10,%rsp
+  801b3c:	89 fb                	mov    %edi,%ebx
+  801b3e:	49 89 f4             	mov    %rsi,%r12
+  801b41:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b44:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801b48:	48 b8 4a 18 80 00 00 	movabs $0x80184a,%rax
+  801b4f:	00 00 00 
+  801b52:	ff d0                	call   *%rax
+  801b54:	85 c0                	test   %eax,%eax
+  801b56:	78 4c                	js     801ba4 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b58:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801b5c:	41 8b 3e             	mov    (%r14),%edi
+  801b5f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801b63:	48 b8 95 18 80 00 00 	movabs $0x801895,%rax
+  801b6a:	00 00 00 
+  801b6d:	ff d0                	call   *%rax
+  801b6f:	85 c0                	test   %eax,%eax
+  801b71:	78 35                	js     801ba8 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801b73:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801b77:	83 e0 03             	and    $0x3,%eax
+  801b7a:	83 f8 01             	cmp    $0x1,%eax
+  801b7d:	74 2d                	je     801bac <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801b7f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b83:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801b87:	48 85 c0             	test   %rax,%rax
+  801b8a:	74 56                	je     801be2 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801b8c:	4c 89 ea             	mov    %r13,%rdx
+  801b8f:	4c 89 e6             	mov    %r12,%rsi
+  801b92:	4c 89 f7             	mov    %r14,%rdi
+  801b95:	ff d0                	call   *%rax
+}
+  801b97:	48 83 c4 10          	add    $0x10,%rsp
+  801b9b:	5b                   	pop    %rbx
+  801b9c:	41 5c                	pop    %r12
+  801b9e:	41 5d                	pop    %r13
+  801ba0:	41 5e                	pop    %r14
+  801ba2:	5d                   	pop    %rbp
+  801ba3:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ba4:	48 98                	cltq
+  801ba6:	eb ef                	jmp    801b97 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ba8:	48 98                	cltq
+  801baa:	eb eb                	jmp    801b97 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801bac:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801bb3:	00 00 00 
+  801bb6:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801bbc:	89 da                	mov    %ebx,%edx
+  801bbe:	48 bf e9 4f 80 00 00 	movabs $0x804fe9,%rdi
+  801bc5:	00 00 00 
+  801bc8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bcd:	48 b9 05 05 80 00 00 	movabs $0x800505,%rcx
+  801bd4:	00 00 00 
+  801bd7:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801bd9:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801be0:	eb b5                	jmp    801b97 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801be2:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801be9:	eb ac                	jmp    801b97 <read+0x6a>
+
+0000000000801beb <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801beb:	55                   	push   %rbp
+  801bec:	48 89 e5             	mov    %rsp,%rbp
+  801bef:	41 57                	push   %r15
+  801bf1:	41 56                	push   %r14
+  801bf3:	41 55                	push   %r13
+  801bf5:	41 54                	push   %r12
+  801bf7:	53                   	push   %rbx
+  801bf8:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801bfc:	48 85 d2             	test   %rdx,%rdx
+  801bff:	74 54                	je     801c55 <readn+0x6a>
+  801c01:	41 89 fd             	mov    %edi,%r13d
+  801c04:	49 89 f6             	mov    %rsi,%r14
+  801c07:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801c0a:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801c0f:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801c14:	49 bf 2d 1b 80 00 00 	movabs $0x801b2d,%r15
+  801c1b:	00 00 00 
+  801c1e:	4c 89 e2             	mov    %r12,%rdx
+  801c21:	48 29 f2             	sub    %rsi,%rdx
+  801c24:	4c 01 f6             	add    %r14,%rsi
+  801c27:	44 89 ef             	mov    %r13d,%edi
+  801c2a:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801c2d:	85 c0                	test   %eax,%eax
+  801c2f:	78 20                	js     801c51 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801c31:	01 c3                	add    %eax,%ebx
+  801c33:	85 c0                	test   %eax,%eax
+  801c35:	74 08                	je     801c3f <readn+0x54>
+  801c37:	48 63 f3             	movslq %ebx,%rsi
+  801c3a:	4c 39 e6             	cmp    %r12,%rsi
+  801c3d:	72 df                	jb     801c1e <readn+0x33>
+    }
+    return res;
+  801c3f:	48 63 c3             	movslq %ebx,%rax
+}
+  801c42:	48 83 c4 08          	add    $0x8,%rsp
+  801c46:	5b                   	pop    %rbx
+  801c47:	41 5c                	pop    %r12
+  801c49:	41 5d                	pop    %r13
+  801c4b:	41 5e                	pop    %r14
+  801c4d:	41 5f                	pop    %r15
+  801c4f:	5d                   	pop    %rbp
+  801c50:	c3                   	ret
+        if (inc < 0) return inc;
+  801c51:	48 98                	cltq
+  801c53:	eb ed                	jmp    801c42 <readn+0x57>
+    int inc = 1, res = 0;
+  801c55:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c5a:	eb e3                	jmp    801c3f <readn+0x54>
+
+0000000000801c5c <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801c5c:	55                   	push   %rbp
+  801c5d:	48 89 e5             	mov    %rsp,%rbp
+  801c60:	41 56                	push   %r14
+  801c62:	41 55                	push   %r13
+  801c64:	41 54                	push   %r12
+  801c66:	53                   	push   %rbx
+  801c67:	48 83 ec 10          	sub    $0x10,%rsp
+  801c6b:	89 fb                	mov    %edi,%ebx
+  801c6d:	49 89 f4             	mov    %rsi,%r12
+  801c70:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c73:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c77:	48 b8 4a 18 80 00 00 	movabs $0x80184a,%rax
+  801c7e:	00 00 00 
+  801c81:	ff d0                	call   *%rax
+  801c83:	85 c0                	test   %eax,%eax
+  801c85:	78 47                	js     801cce <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c87:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801c8b:	41 8b 3e             	mov    (%r14),%edi
+  801c8e:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c92:	48 b8 95 18 80 00 00 	movabs $0x801895,%rax
+  801c99:	00 00 00 
+  801c9c:	ff d0                	call   *%rax
+  801c9e:	85 c0                	test   %eax,%eax
+  801ca0:	78 30                	js     801cd2 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ca2:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801ca7:	74 2d                	je     801cd6 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801ca9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801cad:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801cb1:	48 85 c0             	test   %rax,%rax
+  801cb4:	74 56                	je     801d0c <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801cb6:	4c 89 ea             	mov    %r13,%rdx
+  801cb9:	4c 89 e6             	mov    %r12,%rsi
+  801cbc:	4c 89 f7             	mov    %r14,%rdi
+  801cbf:	ff d0                	call   *%rax
+}
+  801cc1:	48 83 c4 10          	add    $0x10,%rsp
+  801cc5:	5b                   	pop    %rbx
+  801cc6:	41 5c                	pop    %r12
+  801cc8:	41 5d                	pop    %r13
+  801cca:	41 5e                	pop    %r14
+  801ccc:	5d                   	pop    %rbp
+  801ccd:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801cce:	48 98                	cltq
+  801cd0:	eb ef                	jmp    801cc1 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801cd2:	48 98                	cltq
+  801cd4:	eb eb                	jmp    801cc1 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801cd6:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801cdd:	00 00 00 
+  801ce0:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801ce6:	89 da                	mov    %ebx,%edx
+  801ce8:	48 bf 05 50 80 00 00 	movabs $0x805005,%rdi
+  801cef:	00 00 00 
+  801cf2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cf7:	48 b9 05 05 80 00 00 	movabs $0x800505,%rcx
+  801cfe:	00 00 00 
+  801d01:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801d03:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801d0a:	eb b5                	jmp    801cc1 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801d0c:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801d13:	eb ac                	jmp    801cc1 <write+0x65>
+
+0000000000801d15 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801d15:	55                   	push   %rbp
+  801d16:	48 89 e5             	mov    %rsp,%rbp
+  801d19:	41 54                	push   %r12
+  801d1b:	53                   	push   %rbx
+  801d1c:	48 83 ec 10          	sub    $0x10,%rsp
+  801d20:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d22:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801d26:	48 b8 4a 18 80 00 00 	movabs $0x80184a,%rax
+  801d2d:	00 00 00 
+  801d30:	ff d0                	call   *%rax
+  801d32:	85 c0                	test   %eax,%eax
+  801d34:	78 3e                	js     801d74 <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d36:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801d3a:	41 8b 3c 24          	mov    (%r12),%edi
+  801d3e:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801d42:	48 b8 95 18 80 00 00 	movabs $0x801895,%rax
+  801d49:	00 00 00 
+  801d4c:	ff d0                	call   *%rax
+  801d4e:	85 c0                	test   %eax,%eax
+  801d50:	78 22                	js     801d74 <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  801d52:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801d56:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801d5a:	48 85 c0             	test   %rax,%rax
+  801d5d:	74 0b                	je     801d6a <seek+0x55>
+  801d5f:	89 de                	mov    %ebx,%esi
+  801d61:	4c 89 e7             	mov    %r12,%rdi
+  801d64:	ff d0                	call   *%rax
+  801d66:	85 c0                	test   %eax,%eax
+  801d68:	78 0a                	js     801d74 <seek+0x5f>
+
+    fd->fd_offset = offset;
+  801d6a:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  801d6f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d74:	48 83 c4 10          	add    $0x10,%rsp
+  801d78:	5b                   	pop    %rbx
+  801d79:	41 5c                	pop    %r12
+  801d7b:	5d                   	pop    %rbp
+  801d7c:	c3                   	ret
+
+0000000000801d7d <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801d7d:	55                   	push   %rbp
+  801d7e:	48 89 e5             	mov    %rsp,%rbp
+  801d81:	41 55                	push   %r13
+  801d83:	41 54                	push   %r12
+  801d85:	53                   	push   %rbx
+  801d86:	48 83 ec 18          	sub    $0x18,%rsp
+  801d8a:	89 fb                	mov    %edi,%ebx
+  801d8c:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d8f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d93:	48 b8 4a 18 80 00 00 	movabs $0x80184a,%rax
+  801d9a:	00 00 00 
+  801d9d:	ff d0                	call   *%rax
+  801d9f:	85 c0                	test   %eax,%eax
+  801da1:	78 38                	js     801ddb <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801da3:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801da7:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801dab:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801daf:	48 b8 95 18 80 00 00 	movabs $0x801895,%rax
+  801db6:	00 00 00 
+  801db9:	ff d0                	call   *%rax
+  801dbb:	85 c0                	test   %eax,%eax
+  801dbd:	78 1c                	js     801ddb <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801dbf:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801dc4:	74 20                	je     801de6 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801dc6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801dca:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801dce:	48 85 c0             	test   %rax,%rax
+  801dd1:	74 47                	je     801e1a <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801dd3:	44 89 e6             	mov    %r12d,%esi
+  801dd6:	4c 89 ef             	mov    %r13,%rdi
+  801dd9:	ff d0                	call   *%rax
+}
+  801ddb:	48 83 c4 18          	add    $0x18,%rsp
+  801ddf:	5b                   	pop    %rbx
+  801de0:	41 5c                	pop    %r12
+  801de2:	41 5d                	pop    %r13
+  801de4:	5d                   	pop    %rbp
+  801de5:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801de6:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801ded:	00 00 00 
+  801df0:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801df6:	89 da                	mov    %ebx,%edx
+  801df8:	48 bf c8 4f 80 00 00 	movabs $0x804fc8,%rdi
+  801dff:	00 00 00 
+  801e02:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e07:	48 b9 05 05 80 00 00 	movabs $0x800505,%rcx
+  801e0e:	00 00 00 
+  801e11:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e13:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e18:	eb c1                	jmp    801ddb <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801e1a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801e1f:	eb ba                	jmp    801ddb <ftruncate+0x5e>
+
+0000000000801e21 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801e21:	55                   	push   %rbp
+  801e22:	48 89 e5             	mov    %rsp,%rbp
+  801e25:	41 54                	push   %r12
+  801e27:	53                   	push   %rbx
+  801e28:	48 83 ec 10          	sub    $0x10,%rsp
+  801e2c:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e2f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801e33:	48 b8 4a 18 80 00 00 	movabs $0x80184a,%rax
+  801e3a:	00 00 00 
+  801e3d:	ff d0                	call   *%rax
+  801e3f:	85 c0                	test   %eax,%eax
+  801e41:	78 4e                	js     801e91 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e43:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801e47:	41 8b 3c 24          	mov    (%r12),%edi
+  801e4b:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801e4f:	48 b8 95 18 80 00 00 	movabs $0x801895,%rax
+  801e56:	00 00 00 
+  801e59:	ff d0                	call   *%rax
+  801e5b:	85 c0                	test   %eax,%eax
+  801e5d:	78 32                	js     801e91 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801e5f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801e63:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801e68:	74 30                	je     801e9a <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801e6a:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801e6d:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801e74:	00 00 00 
+    stat->st_isdir = 0;
+  801e77:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801e7e:	00 00 00 
+    stat->st_dev = dev;
+  801e81:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801e88:	48 89 de             	mov    %rbx,%rsi
+  801e8b:	4c 89 e7             	mov    %r12,%rdi
+  801e8e:	ff 50 28             	call   *0x28(%rax)
+}
+  801e91:	48 83 c4 10          	add    $0x10,%rsp
+  801e95:	5b                   	pop    %rbx
+  801e96:	41 5c                	pop    %r12
+  801e98:	5d                   	pop    %rbp
+  801e99:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801e9a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801e9f:	eb f0                	jmp    801e91 <fstat+0x70>
+
+0000000000801ea1 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801ea1:	55                   	push   %rbp
+  801ea2:	48 89 e5             	mov    %rsp,%rbp
+  801ea5:	41 54                	push   %r12
+  801ea7:	53                   	push   %rbx
+  801ea8:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801eab:	be 00 00 00 00       	mov    $0x0,%esi
+  801eb0:	48 b8 0f 30 80 00 00 	movabs $0x80300f,%rax
+  801eb7:	00 00 00 
+  801eba:	ff d0                	call   *%rax
+  801ebc:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801ebe:	85 c0                	test   %eax,%eax
+  801ec0:	78 25                	js     801ee7 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801ec2:	4c 89 e6             	mov    %r12,%rsi
+  801ec5:	89 c7                	mov    %eax,%edi
+  801ec7:	48 b8 21 1e 80 00 00 	movabs $0x801e21,%rax
+  801ece:	00 00 00 
+  801ed1:	ff d0                	call   *%rax
+  801ed3:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801ed6:	89 df                	mov    %ebx,%edi
+  801ed8:	48 b8 af 19 80 00 00 	movabs $0x8019af,%rax
+  801edf:	00 00 00 
+  801ee2:	ff d0                	call   *%rax
+
+    return res;
+  801ee4:	44 89 e3             	mov    %r12d,%ebx
+}
+  801ee7:	89 d8                	mov    %ebx,%eax
+  801ee9:	5b                   	pop    %rbx
+  801eea:	41 5c                	pop    %r12
+  801eec:	5d                   	pop    %rbp
+  801eed:	c3                   	ret
+
+0000000000801eee <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  801eee:	48 b8 08 00 82 00 00 	movabs $0x820008,%rax
+  801ef5:	00 00 00 
+  801ef8:	83 38 00             	cmpl   $0x0,(%rax)
+  801efb:	74 0a                	je     801f07 <fsenv+0x19>
+    return envid;
+}
+  801efd:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  801f04:	00 00 
+  801f06:	c3                   	ret
+fsenv(void) {
+  801f07:	55                   	push   %rbp
+  801f08:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  801f0b:	bf 03 00 00 00       	mov    $0x3,%edi
+  801f10:	48 b8 89 49 80 00 00 	movabs $0x804989,%rax
+  801f17:	00 00 00 
+  801f1a:	ff d0                	call   *%rax
+  801f1c:	a3 08 00 82 00 00 00 	movabs %eax,0x820008
+  801f23:	00 00 
+}
+  801f25:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  801f2c:	00 00 
+  801f2e:	5d                   	pop    %rbp
+  801f2f:	c3                   	ret
+
+0000000000801f30 <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  801f30:	55                   	push   %rbp
+  801f31:	48 89 e5             	mov    %rsp,%rbp
+  801f34:	41 54                	push   %r12
+  801f36:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  801f37:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801f3c:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801f41:	48 89 de             	mov    %rbx,%rsi
+  801f44:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f49:	48 b8 2f 14 80 00 00 	movabs $0x80142f,%rax
+  801f50:	00 00 00 
+  801f53:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  801f55:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  801f5c:	00 00 00 
+  801f5f:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  801f65:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801f6a:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801f6f:	48 89 de             	mov    %rbx,%rsi
+  801f72:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f77:	48 b8 89 13 80 00 00 	movabs $0x801389,%rax
+  801f7e:	00 00 00 
+  801f81:	ff d0                	call   *%rax
+  801f83:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  801f85:	85 c0                	test   %eax,%eax
+  801f87:	0f 88 a2 00 00 00    	js     80202f <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  801f8d:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801f94:	00 00 00 
+  801f97:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801f9d:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801fa2:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  801fa4:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  801fa9:	49 bc 4b 41 80 00 00 	movabs $0x80414b,%r12
+  801fb0:	00 00 00 
+  801fb3:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  801fb6:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  801fbb:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  801fbe:	48 b8 ee 1e 80 00 00 	movabs $0x801eee,%rax
+  801fc5:	00 00 00 
+  801fc8:	ff d0                	call   *%rax
+  801fca:	89 c7                	mov    %eax,%edi
+  801fcc:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  801fd2:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  801fd7:	48 89 da             	mov    %rbx,%rdx
+  801fda:	be 09 00 00 00       	mov    $0x9,%esi
+  801fdf:	48 b8 33 49 80 00 00 	movabs $0x804933,%rax
+  801fe6:	00 00 00 
+  801fe9:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  801feb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ff0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ff5:	be 00 00 00 00       	mov    $0x0,%esi
+  801ffa:	bf 00 00 00 00       	mov    $0x0,%edi
+  801fff:	48 b8 0f 49 80 00 00 	movabs $0x80490f,%rax
+  802006:	00 00 00 
+  802009:	ff d0                	call   *%rax
+  80200b:	89 c3                	mov    %eax,%ebx
+  80200d:	85 c0                	test   %eax,%eax
+  80200f:	78 25                	js     802036 <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  802011:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  802018:	00 00 00 
+  80201b:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802021:	a3 00 26 82 00 00 00 	movabs %eax,0x822600
+  802028:	00 00 
+    return 0;
+  80202a:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  80202f:	89 d8                	mov    %ebx,%eax
+  802031:	5b                   	pop    %rbx
+  802032:	41 5c                	pop    %r12
+  802034:	5d                   	pop    %rbp
+  802035:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  802036:	ba 00 50 00 00       	mov    $0x5000,%edx
+  80203b:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  802040:	bf 00 00 00 00       	mov    $0x0,%edi
+  802045:	48 b8 2f 14 80 00 00 	movabs $0x80142f,%rax
+  80204c:	00 00 00 
+  80204f:	ff d0                	call   *%rax
+        return res;
+  802051:	eb dc                	jmp    80202f <fschan_setup+0xff>
+
+0000000000802053 <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  802053:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  80205a:	00 00 00 
+  80205d:	80 38 00             	cmpb   $0x0,(%rax)
+  802060:	74 55                	je     8020b7 <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802062:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  802069:	00 00 00 
+  80206c:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  802072:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802077:	48 ba 00 26 82 00 00 	movabs $0x822600,%rdx
+  80207e:	00 00 00 
+  802081:	3b 0a                	cmp    (%rdx),%ecx
+  802083:	75 01                	jne    802086 <fschan+0x33>
+}
+  802085:	c3                   	ret
+fschan(void) {
+  802086:	55                   	push   %rbp
+  802087:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  80208a:	48 b8 30 1f 80 00 00 	movabs $0x801f30,%rax
+  802091:	00 00 00 
+  802094:	ff d0                	call   *%rax
+  802096:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  802098:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  80209d:	85 d2                	test   %edx,%edx
+  80209f:	78 02                	js     8020a3 <fschan+0x50>
+}
+  8020a1:	5d                   	pop    %rbp
+  8020a2:	c3                   	ret
+        fschan_enabled = 0;
+  8020a3:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  8020aa:	00 00 00 
+  8020ad:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  8020b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020b5:	eb ea                	jmp    8020a1 <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  8020b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020bc:	c3                   	ret
+
+00000000008020bd <fbuf>:
+fbuf(struct Fd *fd) {
+  8020bd:	55                   	push   %rbp
+  8020be:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  8020c1:	48 b8 bc 17 80 00 00 	movabs $0x8017bc,%rax
+  8020c8:	00 00 00 
+  8020cb:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  8020cd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020d2:	48 83 f8 1f          	cmp    $0x1f,%rax
+  8020d6:	77 12                	ja     8020ea <fbuf+0x2d>
+  8020d8:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  8020dc:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8020e3:	00 00 00 
+  8020e6:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  8020ea:	48 89 d0             	mov    %rdx,%rax
+  8020ed:	5d                   	pop    %rbp
+  8020ee:	c3                   	ret
+
+00000000008020ef <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  8020ef:	55                   	push   %rbp
+  8020f0:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  8020f3:	48 83 c7 40          	add    $0x40,%rdi
+  8020f7:	48 b8 85 41 80 00 00 	movabs $0x804185,%rax
+  8020fe:	00 00 00 
+  802101:	ff d0                	call   *%rax
+  802103:	84 c0                	test   %al,%al
+  802105:	75 02                	jne    802109 <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  802107:	5d                   	pop    %rbp
+  802108:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  802109:	48 b8 ee 1e 80 00 00 	movabs $0x801eee,%rax
+  802110:	00 00 00 
+  802113:	ff d0                	call   *%rax
+  802115:	89 c7                	mov    %eax,%edi
+  802117:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80211d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802122:	ba 00 00 00 00       	mov    $0x0,%edx
+  802127:	be 0a 00 00 00       	mov    $0xa,%esi
+  80212c:	48 b8 33 49 80 00 00 	movabs $0x804933,%rax
+  802133:	00 00 00 
+  802136:	ff d0                	call   *%rax
+}
+  802138:	eb cd                	jmp    802107 <fschan_publish+0x18>
+
+000000000080213a <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  80213a:	55                   	push   %rbp
+  80213b:	48 89 e5             	mov    %rsp,%rbp
+  80213e:	41 57                	push   %r15
+  802140:	41 56                	push   %r14
+  802142:	41 55                	push   %r13
+  802144:	41 54                	push   %r12
+  802146:	53                   	push   %rbx
+  802147:	48 83 ec 48          	sub    $0x48,%rsp
+  80214b:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80214f:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  802153:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  802156:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  80215a:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  80215d:	48 ba 04 00 82 00 00 	movabs $0x820004,%rdx
+  802164:	00 00 00 
+  802167:	8b 02                	mov    (%rdx),%eax
+  802169:	83 c0 01             	add    $0x1,%eax
+  80216c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802171:	0f 44 c1             	cmove  %ecx,%eax
+  802174:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  802176:	4d 85 c0             	test   %r8,%r8
+  802179:	74 2c                	je     8021a7 <fschan_rw+0x6d>
+  80217b:	45 89 ce             	mov    %r9d,%r14d
+  80217e:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  802185:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  802189:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80218f:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  802196:	00 
+  802197:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80219d:	b8 01 00 00 00       	mov    $0x1,%eax
+  8021a2:	e9 41 01 00 00       	jmp    8022e8 <fschan_rw+0x1ae>
+  8021a7:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  8021ab:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8021af:	e9 9c 01 00 00       	jmp    802350 <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  8021b4:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8021b8:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  8021bb:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  8021be:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  8021c1:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  8021c5:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8021c9:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  8021cd:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  8021d1:	48 89 da             	mov    %rbx,%rdx
+  8021d4:	48 b8 8b 10 80 00 00 	movabs $0x80108b,%rax
+  8021db:	00 00 00 
+  8021de:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  8021e0:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8021e4:	48 b8 ef 20 80 00 00 	movabs $0x8020ef,%rax
+  8021eb:	00 00 00 
+  8021ee:	ff d0                	call   *%rax
+            queued += blk;
+  8021f0:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  8021f3:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  8021f7:	4d 39 fc             	cmp    %r15,%r12
+  8021fa:	73 6b                	jae    802267 <fschan_rw+0x12d>
+  8021fc:	41 83 fd 0f          	cmp    $0xf,%r13d
+  802200:	77 65                	ja     802267 <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  802202:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802206:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  80220a:	48 b8 60 41 80 00 00 	movabs $0x804160,%rax
+  802211:	00 00 00 
+  802214:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  802216:	4c 89 fb             	mov    %r15,%rbx
+  802219:	4c 29 e3             	sub    %r12,%rbx
+  80221c:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  802221:	48 39 d3             	cmp    %rdx,%rbx
+  802224:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  802228:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  80222c:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802230:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  802234:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  802237:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  802239:	48 b9 04 00 82 00 00 	movabs $0x820004,%rcx
+  802240:	00 00 00 
+  802243:	8b 09                	mov    (%rcx),%ecx
+  802245:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  802248:	83 fe 03             	cmp    $0x3,%esi
+  80224b:	0f 85 63 ff ff ff    	jne    8021b4 <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  802251:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802255:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  802258:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  80225b:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  80225e:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  802262:	e9 79 ff ff ff       	jmp    8021e0 <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  802267:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80226b:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  802272:	48 89 df             	mov    %rbx,%rdi
+  802275:	48 b8 23 42 80 00 00 	movabs $0x804223,%rax
+  80227c:	00 00 00 
+  80227f:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  802281:	48 89 df             	mov    %rbx,%rdi
+  802284:	48 b8 b1 41 80 00 00 	movabs $0x8041b1,%rax
+  80228b:	00 00 00 
+  80228e:	ff d0                	call   *%rax
+  802290:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  802294:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  802298:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  80229c:	75 25                	jne    8022c3 <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  80229e:	8b 40 04             	mov    0x4(%rax),%eax
+  8022a1:	85 c0                	test   %eax,%eax
+  8022a3:	0f 88 86 00 00 00    	js     80232f <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  8022a9:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  8022ad:	74 5b                	je     80230a <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  8022af:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8022b3:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  8022b7:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  8022bb:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  8022bf:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  8022c3:	48 89 df             	mov    %rbx,%rdi
+  8022c6:	48 b8 d8 41 80 00 00 	movabs $0x8041d8,%rax
+  8022cd:	00 00 00 
+  8022d0:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  8022d2:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  8022d6:	83 f0 01             	xor    $0x1,%eax
+  8022d9:	4d 39 fc             	cmp    %r15,%r12
+  8022dc:	0f 92 c2             	setb   %dl
+  8022df:	84 c2                	test   %al,%dl
+  8022e1:	75 05                	jne    8022e8 <fschan_rw+0x1ae>
+  8022e3:	45 85 ed             	test   %r13d,%r13d
+  8022e6:	74 50                	je     802338 <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  8022e8:	4d 39 fc             	cmp    %r15,%r12
+  8022eb:	0f 92 c1             	setb   %cl
+  8022ee:	41 83 fd 0f          	cmp    $0xf,%r13d
+  8022f2:	0f 96 c2             	setbe  %dl
+  8022f5:	84 d1                	test   %dl,%cl
+  8022f7:	0f 84 6a ff ff ff    	je     802267 <fschan_rw+0x12d>
+  8022fd:	84 c0                	test   %al,%al
+  8022ff:	0f 85 fd fe ff ff    	jne    802202 <fschan_rw+0xc8>
+  802305:	e9 5d ff ff ff       	jmp    802267 <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  80230a:	48 63 d0             	movslq %eax,%rdx
+  80230d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802311:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  802315:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802319:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  80231d:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  802321:	48 b8 8b 10 80 00 00 	movabs $0x80108b,%rax
+  802328:	00 00 00 
+  80232b:	ff d0                	call   *%rax
+  80232d:	eb 80                	jmp    8022af <fschan_rw+0x175>
+                err = msg->fm_res;
+  80232f:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  802332:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  802336:	eb 8b                	jmp    8022c3 <fschan_rw+0x189>
+    return done || !err ? done : err;
+  802338:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  80233d:	0f 85 68 fe ff ff    	jne    8021ab <fschan_rw+0x71>
+  802343:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  802346:	85 c0                	test   %eax,%eax
+  802348:	0f 84 5d fe ff ff    	je     8021ab <fschan_rw+0x71>
+  80234e:	48 98                	cltq
+}
+  802350:	48 83 c4 48          	add    $0x48,%rsp
+  802354:	5b                   	pop    %rbx
+  802355:	41 5c                	pop    %r12
+  802357:	41 5d                	pop    %r13
+  802359:	41 5e                	pop    %r14
+  80235b:	41 5f                	pop    %r15
+  80235d:	5d                   	pop    %rbp
+  80235e:	c3                   	ret
+
+000000000080235f <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  80235f:	55                   	push   %rbp
+  802360:	48 89 e5             	mov    %rsp,%rbp
+  802363:	41 56                	push   %r14
+  802365:	41 55                	push   %r13
+  802367:	41 54                	push   %r12
+  802369:	53                   	push   %rbx
+  80236a:	48 83 ec 10          	sub    $0x10,%rsp
+  80236e:	49 89 fe             	mov    %rdi,%r14
+  802371:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  802374:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  802378:	48 29 f3             	sub    %rsi,%rbx
+  80237b:	48 39 d3             	cmp    %rdx,%rbx
+  80237e:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  802382:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  802389:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  80238a:	bf 00 10 00 00       	mov    $0x1000,%edi
+  80238f:	49 bd d8 3f 80 00 00 	movabs $0x803fd8,%r13
+  802396:	00 00 00 
+  802399:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  8023a0:	76 1e                	jbe    8023c0 <mmap_fault+0x61>
+  8023a2:	4c 01 e7             	add    %r12,%rdi
+  8023a5:	41 ff d5             	call   *%r13
+  8023a8:	84 c0                	test   %al,%al
+  8023aa:	75 14                	jne    8023c0 <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  8023ac:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8023b0:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  8023b7:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  8023bb:	48 39 df             	cmp    %rbx,%rdi
+  8023be:	72 e2                	jb     8023a2 <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  8023c0:	48 bb 00 10 82 00 00 	movabs $0x821000,%rbx
+  8023c7:	00 00 00 
+  8023ca:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  8023d1:	00 00 00 
+  8023d4:	4c 89 f0             	mov    %r14,%rax
+  8023d7:	48 29 d0             	sub    %rdx,%rax
+  8023da:	48 c1 f8 03          	sar    $0x3,%rax
+  8023de:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  8023e5:	aa aa aa 
+  8023e8:	48 0f af c2          	imul   %rdx,%rax
+  8023ec:	48 c1 e0 0c          	shl    $0xc,%rax
+  8023f0:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  8023f5:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  8023f9:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  8023fb:	44 89 e0             	mov    %r12d,%eax
+  8023fe:	41 03 46 10          	add    0x10(%r14),%eax
+  802402:	41 2b 06             	sub    (%r14),%eax
+  802405:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  802408:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80240c:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  802410:	41 8b 46 14          	mov    0x14(%r14),%eax
+  802414:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  802417:	48 b8 ee 1e 80 00 00 	movabs $0x801eee,%rax
+  80241e:	00 00 00 
+  802421:	ff d0                	call   *%rax
+  802423:	89 c7                	mov    %eax,%edi
+  802425:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80242b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802430:	48 89 da             	mov    %rbx,%rdx
+  802433:	be 0f 00 00 00       	mov    $0xf,%esi
+  802438:	48 b8 33 49 80 00 00 	movabs $0x804933,%rax
+  80243f:	00 00 00 
+  802442:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  802444:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802449:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80244d:	4c 89 e6             	mov    %r12,%rsi
+  802450:	bf 00 00 00 00       	mov    $0x0,%edi
+  802455:	48 b8 0f 49 80 00 00 	movabs $0x80490f,%rax
+  80245c:	00 00 00 
+  80245f:	ff d0                	call   *%rax
+  802461:	48 98                	cltq
+}
+  802463:	48 83 c4 10          	add    $0x10,%rsp
+  802467:	5b                   	pop    %rbx
+  802468:	41 5c                	pop    %r12
+  80246a:	41 5d                	pop    %r13
+  80246c:	41 5e                	pop    %r14
+  80246e:	5d                   	pop    %rbp
+  80246f:	c3                   	ret
+
+0000000000802470 <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  802470:	48 8b 37             	mov    (%rdi),%rsi
+  802473:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  80247a:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  802481:	00 00 00 
+  802484:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802489:	eb 0f                	jmp    80249a <mmap_pgfault+0x2a>
+  80248b:	c3                   	ret
+  80248c:	48 83 c1 01          	add    $0x1,%rcx
+  802490:	48 83 c2 18          	add    $0x18,%rdx
+  802494:	48 83 f9 20          	cmp    $0x20,%rcx
+  802498:	74 6e                	je     802508 <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  80249a:	48 8b 02             	mov    (%rdx),%rax
+  80249d:	48 83 e8 01          	sub    $0x1,%rax
+  8024a1:	48 39 f0             	cmp    %rsi,%rax
+  8024a4:	73 e6                	jae    80248c <mmap_pgfault+0x1c>
+  8024a6:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  8024aa:	73 e0                	jae    80248c <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  8024ac:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  8024b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024b5:	f6 c2 01             	test   $0x1,%dl
+  8024b8:	75 d1                	jne    80248b <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  8024ba:	f6 c2 02             	test   $0x2,%dl
+  8024bd:	74 1a                	je     8024d9 <mmap_pgfault+0x69>
+  8024bf:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  8024c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024c8:	48 bf 00 20 82 00 00 	movabs $0x822000,%rdi
+  8024cf:	00 00 00 
+  8024d2:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  8024d7:	74 35                	je     80250e <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  8024d9:	55                   	push   %rbp
+  8024da:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  8024dd:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  8024e1:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8024e8:	00 00 00 
+  8024eb:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  8024ef:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8024f4:	48 b8 5f 23 80 00 00 	movabs $0x80235f,%rax
+  8024fb:	00 00 00 
+  8024fe:	ff d0                	call   *%rax
+  802500:	48 85 c0             	test   %rax,%rax
+  802503:	0f 9f c0             	setg   %al
+}
+  802506:	5d                   	pop    %rbp
+  802507:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  802508:	b8 00 00 00 00       	mov    $0x0,%eax
+  80250d:	c3                   	ret
+}
+  80250e:	c3                   	ret
+
+000000000080250f <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  80250f:	55                   	push   %rbp
+  802510:	48 89 e5             	mov    %rsp,%rbp
+  802513:	41 54                	push   %r12
+  802515:	53                   	push   %rbx
+  802516:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802519:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  802520:	00 00 00 
+  802523:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  802528:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80252c:	74 15                	je     802543 <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80252e:	48 83 c3 01          	add    $0x1,%rbx
+  802532:	48 83 c0 18          	add    $0x18,%rax
+  802536:	48 83 fb 20          	cmp    $0x20,%rbx
+  80253a:	75 ec                	jne    802528 <mmap_alloc+0x19>
+    return NULL;
+  80253c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802541:	eb 52                	jmp    802595 <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  802543:	4c 89 e7             	mov    %r12,%rdi
+  802546:	48 b8 79 3f 80 00 00 	movabs $0x803f79,%rax
+  80254d:	00 00 00 
+  802550:	ff d0                	call   *%rax
+  802552:	41 89 c1             	mov    %eax,%r9d
+  802555:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  80255c:	48 c1 e1 0c          	shl    $0xc,%rcx
+  802560:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802566:	ba 00 00 00 00       	mov    $0x0,%edx
+  80256b:	4c 89 e6             	mov    %r12,%rsi
+  80256e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802573:	48 b8 df 13 80 00 00 	movabs $0x8013df,%rax
+  80257a:	00 00 00 
+  80257d:	ff d0                	call   *%rax
+  80257f:	85 c0                	test   %eax,%eax
+  802581:	78 17                	js     80259a <mmap_alloc+0x8b>
+        return &mmaps[i];
+  802583:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  802587:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  80258e:	00 00 00 
+  802591:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  802595:	5b                   	pop    %rbx
+  802596:	41 5c                	pop    %r12
+  802598:	5d                   	pop    %rbp
+  802599:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  80259a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80259f:	eb f4                	jmp    802595 <mmap_alloc+0x86>
+
+00000000008025a1 <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  8025a1:	55                   	push   %rbp
+  8025a2:	48 89 e5             	mov    %rsp,%rbp
+  8025a5:	41 56                	push   %r14
+  8025a7:	41 55                	push   %r13
+  8025a9:	41 54                	push   %r12
+  8025ab:	53                   	push   %rbx
+  8025ac:	48 83 ec 10          	sub    $0x10,%rsp
+  8025b0:	41 89 fc             	mov    %edi,%r12d
+  8025b3:	49 89 f5             	mov    %rsi,%r13
+  8025b6:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  8025b9:	48 89 f0             	mov    %rsi,%rax
+  8025bc:	48 09 d0             	or     %rdx,%rax
+  8025bf:	75 0d                	jne    8025ce <fsipc+0x2d>
+  8025c1:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  8025c4:	83 f8 04             	cmp    $0x4,%eax
+  8025c7:	76 7d                	jbe    802646 <fsipc+0xa5>
+  8025c9:	83 ff 0d             	cmp    $0xd,%edi
+  8025cc:	74 78                	je     802646 <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  8025ce:	48 b8 ee 1e 80 00 00 	movabs $0x801eee,%rax
+  8025d5:	00 00 00 
+  8025d8:	ff d0                	call   *%rax
+  8025da:	89 c7                	mov    %eax,%edi
+  8025dc:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  8025e3:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  8025ea:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  8025f1:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8025f7:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  8025fe:	00 00 00 
+  802601:	44 89 e6             	mov    %r12d,%esi
+  802604:	48 b8 33 49 80 00 00 	movabs $0x804933,%rax
+  80260b:	00 00 00 
+  80260e:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  802610:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  802617:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  802618:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80261d:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802621:	4c 89 ee             	mov    %r13,%rsi
+  802624:	bf 00 00 00 00       	mov    $0x0,%edi
+  802629:	48 b8 0f 49 80 00 00 	movabs $0x80490f,%rax
+  802630:	00 00 00 
+  802633:	ff d0                	call   *%rax
+  802635:	89 c3                	mov    %eax,%ebx
+}
+  802637:	89 d8                	mov    %ebx,%eax
+  802639:	48 83 c4 10          	add    $0x10,%rsp
+  80263d:	5b                   	pop    %rbx
+  80263e:	41 5c                	pop    %r12
+  802640:	41 5d                	pop    %r13
+  802642:	41 5e                	pop    %r14
+  802644:	5d                   	pop    %rbp
+  802645:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  802646:	48 b8 53 20 80 00 00 	movabs $0x802053,%rax
+  80264d:	00 00 00 
+  802650:	ff d0                	call   *%rax
+  802652:	49 89 c6             	mov    %rax,%r14
+  802655:	48 85 c0             	test   %rax,%rax
+  802658:	0f 84 70 ff ff ff    	je     8025ce <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  80265e:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  802662:	48 b8 60 41 80 00 00 	movabs $0x804160,%rax
+  802669:	00 00 00 
+  80266c:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  80266e:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  802671:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  802678:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  80267c:	ba 10 00 00 00       	mov    $0x10,%edx
+  802681:	48 be 00 00 83 00 00 	movabs $0x830000,%rsi
+  802688:	00 00 00 
+  80268b:	48 b8 8b 10 80 00 00 	movabs $0x80108b,%rax
+  802692:	00 00 00 
+  802695:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  802697:	4c 89 f7             	mov    %r14,%rdi
+  80269a:	48 b8 ef 20 80 00 00 	movabs $0x8020ef,%rax
+  8026a1:	00 00 00 
+  8026a4:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  8026a6:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  8026ad:	4c 89 f7             	mov    %r14,%rdi
+  8026b0:	48 b8 23 42 80 00 00 	movabs $0x804223,%rax
+  8026b7:	00 00 00 
+  8026ba:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  8026bc:	4c 89 f7             	mov    %r14,%rdi
+  8026bf:	48 b8 b1 41 80 00 00 	movabs $0x8041b1,%rax
+  8026c6:	00 00 00 
+  8026c9:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  8026cb:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  8026ce:	41 83 fc 05          	cmp    $0x5,%r12d
+  8026d2:	75 04                	jne    8026d8 <fsipc+0x137>
+  8026d4:	85 db                	test   %ebx,%ebx
+  8026d6:	79 14                	jns    8026ec <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  8026d8:	4c 89 f7             	mov    %r14,%rdi
+  8026db:	48 b8 d8 41 80 00 00 	movabs $0x8041d8,%rax
+  8026e2:	00 00 00 
+  8026e5:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  8026e7:	e9 4b ff ff ff       	jmp    802637 <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  8026ec:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  8026f0:	ba 88 00 00 00       	mov    $0x88,%edx
+  8026f5:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  8026fc:	00 00 00 
+  8026ff:	48 b8 8b 10 80 00 00 	movabs $0x80108b,%rax
+  802706:	00 00 00 
+  802709:	ff d0                	call   *%rax
+  80270b:	eb cb                	jmp    8026d8 <fsipc+0x137>
+
+000000000080270d <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  80270d:	55                   	push   %rbp
+  80270e:	48 89 e5             	mov    %rsp,%rbp
+  802711:	41 57                	push   %r15
+  802713:	41 56                	push   %r14
+  802715:	41 55                	push   %r13
+  802717:	41 54                	push   %r12
+  802719:	53                   	push   %rbx
+  80271a:	48 83 ec 18          	sub    $0x18,%rsp
+  80271e:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  802722:	49 89 f6             	mov    %rsi,%r14
+  802725:	49 89 d4             	mov    %rdx,%r12
+  802728:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  80272b:	48 b8 53 20 80 00 00 	movabs $0x802053,%rax
+  802732:	00 00 00 
+  802735:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  802737:	48 85 c0             	test   %rax,%rax
+  80273a:	0f 85 96 00 00 00    	jne    8027d6 <devfile_write_direct+0xc9>
+    size_t write = 0;
+  802740:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802747:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802748:	49 bf 00 00 83 00 00 	movabs $0x830000,%r15
+  80274f:	00 00 00 
+    while (n) {
+  802752:	4d 85 e4             	test   %r12,%r12
+  802755:	74 79                	je     8027d0 <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802757:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  80275c:	49 39 dc             	cmp    %rbx,%r12
+  80275f:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  802763:	48 89 da             	mov    %rbx,%rdx
+  802766:	4c 89 f6             	mov    %r14,%rsi
+  802769:	48 bf 00 10 83 00 00 	movabs $0x831000,%rdi
+  802770:	00 00 00 
+  802773:	48 b8 8b 10 80 00 00 	movabs $0x80108b,%rax
+  80277a:	00 00 00 
+  80277d:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80277f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802783:	8b 40 0c             	mov    0xc(%rax),%eax
+  802786:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  802789:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  80278c:	44 01 e8             	add    %r13d,%eax
+  80278f:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  802793:	41 0f 44 c5          	cmove  %r13d,%eax
+  802797:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  80279b:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  80279f:	48 89 da             	mov    %rbx,%rdx
+  8027a2:	be 00 00 00 00       	mov    $0x0,%esi
+  8027a7:	bf 04 00 00 00       	mov    $0x4,%edi
+  8027ac:	48 b8 a1 25 80 00 00 	movabs $0x8025a1,%rax
+  8027b3:	00 00 00 
+  8027b6:	ff d0                	call   *%rax
+        if (res < 0)
+  8027b8:	85 c0                	test   %eax,%eax
+  8027ba:	78 4a                	js     802806 <devfile_write_direct+0xf9>
+        buf += res;
+  8027bc:	48 98                	cltq
+  8027be:	49 01 c6             	add    %rax,%r14
+        write += res;
+  8027c1:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  8027c5:	49 29 c4             	sub    %rax,%r12
+  8027c8:	75 8d                	jne    802757 <devfile_write_direct+0x4a>
+    return write;
+  8027ca:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8027ce:	eb 27                	jmp    8027f7 <devfile_write_direct+0xea>
+    size_t write = 0;
+  8027d0:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  8027d4:	eb f4                	jmp    8027ca <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  8027d6:	45 89 e9             	mov    %r13d,%r9d
+  8027d9:	4d 89 e0             	mov    %r12,%r8
+  8027dc:	4c 89 f1             	mov    %r14,%rcx
+  8027df:	ba 04 00 00 00       	mov    $0x4,%edx
+  8027e4:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8027e8:	48 89 c7             	mov    %rax,%rdi
+  8027eb:	48 b8 3a 21 80 00 00 	movabs $0x80213a,%rax
+  8027f2:	00 00 00 
+  8027f5:	ff d0                	call   *%rax
+}
+  8027f7:	48 83 c4 18          	add    $0x18,%rsp
+  8027fb:	5b                   	pop    %rbx
+  8027fc:	41 5c                	pop    %r12
+  8027fe:	41 5d                	pop    %r13
+  802800:	41 5e                	pop    %r14
+  802802:	41 5f                	pop    %r15
+  802804:	5d                   	pop    %rbp
+  802805:	c3                   	ret
+            return res;
+  802806:	48 98                	cltq
+  802808:	eb ed                	jmp    8027f7 <devfile_write_direct+0xea>
+
+000000000080280a <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  80280a:	55                   	push   %rbp
+  80280b:	48 89 e5             	mov    %rsp,%rbp
+  80280e:	41 54                	push   %r12
+  802810:	53                   	push   %rbx
+  802811:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  802814:	48 b8 bd 20 80 00 00 	movabs $0x8020bd,%rax
+  80281b:	00 00 00 
+  80281e:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  802820:	48 85 c0             	test   %rax,%rax
+  802823:	74 71                	je     802896 <fbuf_flush+0x8c>
+  802825:	48 89 c3             	mov    %rax,%rbx
+  802828:	b8 00 00 00 00       	mov    $0x0,%eax
+  80282d:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  802831:	75 05                	jne    802838 <fbuf_flush+0x2e>
+}
+  802833:	5b                   	pop    %rbx
+  802834:	41 5c                	pop    %r12
+  802836:	5d                   	pop    %rbp
+  802837:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  802838:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  80283b:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  80283f:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802846:	00 00 00 
+  802849:	48 89 de             	mov    %rbx,%rsi
+  80284c:	48 29 c6             	sub    %rax,%rsi
+  80284f:	48 c1 fe 03          	sar    $0x3,%rsi
+  802853:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  80285a:	aa aa aa 
+  80285d:	48 0f af f0          	imul   %rax,%rsi
+  802861:	48 c1 e6 0e          	shl    $0xe,%rsi
+  802865:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  80286a:	48 01 c6             	add    %rax,%rsi
+  80286d:	4c 89 e7             	mov    %r12,%rdi
+  802870:	48 b8 0d 27 80 00 00 	movabs $0x80270d,%rax
+  802877:	00 00 00 
+  80287a:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  80287c:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  802880:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802887:	00 
+    return res < 0 ? res : 0;
+  802888:	48 85 c0             	test   %rax,%rax
+  80288b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802890:	48 0f 4f c2          	cmovg  %rdx,%rax
+  802894:	eb 9d                	jmp    802833 <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  802896:	b8 00 00 00 00       	mov    $0x0,%eax
+  80289b:	eb 96                	jmp    802833 <fbuf_flush+0x29>
+
+000000000080289d <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  80289d:	55                   	push   %rbp
+  80289e:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  8028a1:	48 b8 0a 28 80 00 00 	movabs $0x80280a,%rax
+  8028a8:	00 00 00 
+  8028ab:	ff d0                	call   *%rax
+}
+  8028ad:	5d                   	pop    %rbp
+  8028ae:	c3                   	ret
+
+00000000008028af <devfile_write>:
+    if (!fd || !buf)
+  8028af:	48 85 ff             	test   %rdi,%rdi
+  8028b2:	0f 84 d3 01 00 00    	je     802a8b <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8028b8:	55                   	push   %rbp
+  8028b9:	48 89 e5             	mov    %rsp,%rbp
+  8028bc:	41 57                	push   %r15
+  8028be:	41 56                	push   %r14
+  8028c0:	41 55                	push   %r13
+  8028c2:	41 54                	push   %r12
+  8028c4:	53                   	push   %rbx
+  8028c5:	48 83 ec 08          	sub    $0x8,%rsp
+  8028c9:	49 89 fc             	mov    %rdi,%r12
+  8028cc:	49 89 f6             	mov    %rsi,%r14
+  8028cf:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  8028d2:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  8028d7:	48 85 f6             	test   %rsi,%rsi
+  8028da:	0f 84 9c 01 00 00    	je     802a7c <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  8028e0:	48 b8 bd 20 80 00 00 	movabs $0x8020bd,%rax
+  8028e7:	00 00 00 
+  8028ea:	ff d0                	call   *%rax
+  8028ec:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  8028ef:	48 85 c0             	test   %rax,%rax
+  8028f2:	0f 84 a2 00 00 00    	je     80299a <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  8028f8:	be 00 10 00 00       	mov    $0x1000,%esi
+  8028fd:	4c 89 e7             	mov    %r12,%rdi
+  802900:	48 b8 4e 13 80 00 00 	movabs $0x80134e,%rax
+  802907:	00 00 00 
+  80290a:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  80290c:	83 f8 02             	cmp    $0x2,%eax
+  80290f:	0f 8f 85 00 00 00    	jg     80299a <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  802915:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  80291c:	00 00 00 
+  80291f:	4d 89 ef             	mov    %r13,%r15
+  802922:	49 29 c7             	sub    %rax,%r15
+  802925:	49 c1 ff 03          	sar    $0x3,%r15
+  802929:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802930:	aa aa aa 
+  802933:	4c 0f af f8          	imul   %rax,%r15
+  802937:	49 c1 e7 0e          	shl    $0xe,%r15
+  80293b:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802940:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  802943:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802948:	0f 84 d7 00 00 00    	je     802a25 <devfile_write+0x176>
+  80294e:	49 8b 45 10          	mov    0x10(%r13),%rax
+  802952:	89 c2                	mov    %eax,%edx
+  802954:	41 03 55 0c          	add    0xc(%r13),%edx
+  802958:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  80295d:	75 0f                	jne    80296e <devfile_write+0xbf>
+  80295f:	48 01 d8             	add    %rbx,%rax
+  802962:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  802968:	0f 86 92 00 00 00    	jbe    802a00 <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  80296e:	4c 89 e7             	mov    %r12,%rdi
+  802971:	48 b8 0a 28 80 00 00 	movabs $0x80280a,%rax
+  802978:	00 00 00 
+  80297b:	ff d0                	call   *%rax
+  80297d:	85 c0                	test   %eax,%eax
+  80297f:	78 52                	js     8029d3 <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802981:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802988:	77 7f                	ja     802a09 <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  80298a:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  80298f:	0f 85 c2 00 00 00    	jne    802a57 <devfile_write+0x1a8>
+  802995:	e9 94 00 00 00       	jmp    802a2e <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  80299a:	4c 89 e7             	mov    %r12,%rdi
+  80299d:	48 b8 0a 28 80 00 00 	movabs $0x80280a,%rax
+  8029a4:	00 00 00 
+  8029a7:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  8029a9:	85 c0                	test   %eax,%eax
+  8029ab:	79 07                	jns    8029b4 <devfile_write+0x105>
+  8029ad:	48 98                	cltq
+  8029af:	e9 c8 00 00 00       	jmp    802a7c <devfile_write+0x1cd>
+  8029b4:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  8029b9:	48 89 da             	mov    %rbx,%rdx
+  8029bc:	4c 89 f6             	mov    %r14,%rsi
+  8029bf:	4c 89 e7             	mov    %r12,%rdi
+  8029c2:	48 b8 0d 27 80 00 00 	movabs $0x80270d,%rax
+  8029c9:	00 00 00 
+  8029cc:	ff d0                	call   *%rax
+  8029ce:	e9 a9 00 00 00       	jmp    802a7c <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  8029d3:	48 98                	cltq
+  8029d5:	e9 a2 00 00 00       	jmp    802a7c <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8029da:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8029df:	ba 00 40 00 00       	mov    $0x4000,%edx
+  8029e4:	4c 89 fe             	mov    %r15,%rsi
+  8029e7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029ec:	48 b8 89 13 80 00 00 	movabs $0x801389,%rax
+  8029f3:	00 00 00 
+  8029f6:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  8029f8:	85 c0                	test   %eax,%eax
+  8029fa:	79 45                	jns    802a41 <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8029fc:	48 98                	cltq
+  8029fe:	eb 7c                	jmp    802a7c <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802a00:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802a07:	76 4e                	jbe    802a57 <devfile_write+0x1a8>
+  802a09:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802a0e:	48 89 da             	mov    %rbx,%rdx
+  802a11:	4c 89 f6             	mov    %r14,%rsi
+  802a14:	4c 89 e7             	mov    %r12,%rdi
+  802a17:	48 b8 0d 27 80 00 00 	movabs $0x80270d,%rax
+  802a1e:	00 00 00 
+  802a21:	ff d0                	call   *%rax
+  802a23:	eb 57                	jmp    802a7c <devfile_write+0x1cd>
+  802a25:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802a2c:	77 db                	ja     802a09 <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  802a2e:	4c 89 ff             	mov    %r15,%rdi
+  802a31:	48 b8 d8 3f 80 00 00 	movabs $0x803fd8,%rax
+  802a38:	00 00 00 
+  802a3b:	ff d0                	call   *%rax
+  802a3d:	84 c0                	test   %al,%al
+  802a3f:	74 99                	je     8029da <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  802a41:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  802a46:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802a4b:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  802a4f:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  802a56:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  802a57:	4c 89 ff             	mov    %r15,%rdi
+  802a5a:	49 03 7d 10          	add    0x10(%r13),%rdi
+  802a5e:	48 89 da             	mov    %rbx,%rdx
+  802a61:	4c 89 f6             	mov    %r14,%rsi
+  802a64:	48 b8 8b 10 80 00 00 	movabs $0x80108b,%rax
+  802a6b:	00 00 00 
+  802a6e:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  802a70:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  802a74:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  802a79:	48 89 d8             	mov    %rbx,%rax
+}
+  802a7c:	48 83 c4 08          	add    $0x8,%rsp
+  802a80:	5b                   	pop    %rbx
+  802a81:	41 5c                	pop    %r12
+  802a83:	41 5d                	pop    %r13
+  802a85:	41 5e                	pop    %r14
+  802a87:	41 5f                	pop    %r15
+  802a89:	5d                   	pop    %rbp
+  802a8a:	c3                   	ret
+        return E_INVAL;
+  802a8b:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802a90:	c3                   	ret
+
+0000000000802a91 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802a91:	55                   	push   %rbp
+  802a92:	48 89 e5             	mov    %rsp,%rbp
+  802a95:	41 54                	push   %r12
+  802a97:	53                   	push   %rbx
+  802a98:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  802a9b:	48 b8 0a 28 80 00 00 	movabs $0x80280a,%rax
+  802aa2:	00 00 00 
+  802aa5:	ff d0                	call   *%rax
+  802aa7:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  802aaa:	48 89 df             	mov    %rbx,%rdi
+  802aad:	48 b8 bd 20 80 00 00 	movabs $0x8020bd,%rax
+  802ab4:	00 00 00 
+  802ab7:	ff d0                	call   *%rax
+  802ab9:	48 85 c0             	test   %rax,%rax
+  802abc:	74 17                	je     802ad5 <devfile_flush+0x44>
+  802abe:	48 89 df             	mov    %rbx,%rdi
+  802ac1:	48 b8 bd 20 80 00 00 	movabs $0x8020bd,%rax
+  802ac8:	00 00 00 
+  802acb:	ff d0                	call   *%rax
+  802acd:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  802ad4:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802ad5:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802ad8:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  802adf:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  802ae1:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ae6:	be 00 00 00 00       	mov    $0x0,%esi
+  802aeb:	bf 06 00 00 00       	mov    $0x6,%edi
+  802af0:	48 b8 a1 25 80 00 00 	movabs $0x8025a1,%rax
+  802af7:	00 00 00 
+  802afa:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802afc:	45 85 e4             	test   %r12d,%r12d
+  802aff:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802b03:	5b                   	pop    %rbx
+  802b04:	41 5c                	pop    %r12
+  802b06:	5d                   	pop    %rbp
+  802b07:	c3                   	ret
+
+0000000000802b08 <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  802b08:	55                   	push   %rbp
+  802b09:	48 89 e5             	mov    %rsp,%rbp
+  802b0c:	41 57                	push   %r15
+  802b0e:	41 56                	push   %r14
+  802b10:	41 55                	push   %r13
+  802b12:	41 54                	push   %r12
+  802b14:	53                   	push   %rbx
+  802b15:	48 83 ec 38          	sub    $0x38,%rsp
+  802b19:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  802b1d:	49 89 f7             	mov    %rsi,%r15
+  802b20:	48 89 d3             	mov    %rdx,%rbx
+  802b23:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  802b26:	48 b8 53 20 80 00 00 	movabs $0x802053,%rax
+  802b2d:	00 00 00 
+  802b30:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802b32:	48 85 c0             	test   %rax,%rax
+  802b35:	75 20                	jne    802b57 <devfile_read_direct+0x4f>
+    bool map = 1;
+  802b37:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  802b3c:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802b43:	00 
+    while (n) {
+  802b44:	48 85 db             	test   %rbx,%rbx
+  802b47:	0f 85 df 00 00 00    	jne    802c2c <devfile_read_direct+0x124>
+    size_t read = 0;
+  802b4d:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  802b51:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802b55:	eb 21                	jmp    802b78 <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802b57:	45 89 f1             	mov    %r14d,%r9d
+  802b5a:	49 89 d8             	mov    %rbx,%r8
+  802b5d:	4c 89 f9             	mov    %r15,%rcx
+  802b60:	ba 03 00 00 00       	mov    $0x3,%edx
+  802b65:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802b69:	48 89 c7             	mov    %rax,%rdi
+  802b6c:	48 b8 3a 21 80 00 00 	movabs $0x80213a,%rax
+  802b73:	00 00 00 
+  802b76:	ff d0                	call   *%rax
+}
+  802b78:	48 83 c4 38          	add    $0x38,%rsp
+  802b7c:	5b                   	pop    %rbx
+  802b7d:	41 5c                	pop    %r12
+  802b7f:	41 5d                	pop    %r13
+  802b81:	41 5e                	pop    %r14
+  802b83:	41 5f                	pop    %r15
+  802b85:	5d                   	pop    %rbp
+  802b86:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802b87:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802b8b:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802b91:	75 1e                	jne    802bb1 <devfile_read_direct+0xa9>
+  802b93:	e9 e2 00 00 00       	jmp    802c7a <devfile_read_direct+0x172>
+            if (!res) return read;
+  802b98:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802b9c:	eb da                	jmp    802b78 <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  802b9e:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  802ba2:	0f 85 d0 01 00 00    	jne    802d78 <devfile_read_direct+0x270>
+            map = 0;
+  802ba8:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802bac:	eb 03                	jmp    802bb1 <devfile_read_direct+0xa9>
+  802bae:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802bb1:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802bb6:	48 39 d3             	cmp    %rdx,%rbx
+  802bb9:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802bbd:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802bc1:	8b 40 0c             	mov    0xc(%rax),%eax
+  802bc4:	48 b9 00 00 83 00 00 	movabs $0x830000,%rcx
+  802bcb:	00 00 00 
+  802bce:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  802bd0:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  802bd4:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  802bd8:	be 00 00 00 00       	mov    $0x0,%esi
+  802bdd:	bf 03 00 00 00       	mov    $0x3,%edi
+  802be2:	48 b8 a1 25 80 00 00 	movabs $0x8025a1,%rax
+  802be9:	00 00 00 
+  802bec:	ff d0                	call   *%rax
+        if (res <= 0)
+  802bee:	85 c0                	test   %eax,%eax
+  802bf0:	0f 8e 63 01 00 00    	jle    802d59 <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  802bf6:	4c 63 e0             	movslq %eax,%r12
+  802bf9:	4c 89 e2             	mov    %r12,%rdx
+  802bfc:	48 be 00 10 83 00 00 	movabs $0x831000,%rsi
+  802c03:	00 00 00 
+  802c06:	4c 89 ff             	mov    %r15,%rdi
+  802c09:	48 b8 8b 10 80 00 00 	movabs $0x80108b,%rax
+  802c10:	00 00 00 
+  802c13:	ff d0                	call   *%rax
+        buf += res;
+  802c15:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  802c18:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  802c1b:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  802c1f:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  802c23:	48 85 db             	test   %rbx,%rbx
+  802c26:	0f 84 25 ff ff ff    	je     802b51 <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  802c2c:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  802c2f:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  802c33:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802c37:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802c3b:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  802c42:	0f 97 c2             	seta   %dl
+  802c45:	20 c2                	and    %al,%dl
+  802c47:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  802c4a:	0f 84 5e ff ff ff    	je     802bae <devfile_read_direct+0xa6>
+  802c50:	4c 89 fa             	mov    %r15,%rdx
+  802c53:	4d 89 fd             	mov    %r15,%r13
+  802c56:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  802c5d:	0f 85 4e ff ff ff    	jne    802bb1 <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  802c63:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802c67:	0f 84 1a ff ff ff    	je     802b87 <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802c6d:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802c74:	0f 85 37 ff ff ff    	jne    802bb1 <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  802c7a:	48 89 d8             	mov    %rbx,%rax
+  802c7d:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802c83:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802c88:	48 39 c8             	cmp    %rcx,%rax
+  802c8b:	48 0f 47 c1          	cmova  %rcx,%rax
+  802c8f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  802c93:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  802c97:	49 89 d4             	mov    %rdx,%r12
+  802c9a:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  802c9e:	48 b8 79 3f 80 00 00 	movabs $0x803f79,%rax
+  802ca5:	00 00 00 
+  802ca8:	ff d0                	call   *%rax
+  802caa:	a8 40                	test   $0x40,%al
+  802cac:	0f 85 b9 00 00 00    	jne    802d6b <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  802cb2:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  802cb9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802cbd:	49 39 c5             	cmp    %rax,%r13
+  802cc0:	72 d8                	jb     802c9a <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802cc2:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802cc6:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802ccd:	00 00 00 
+  802cd0:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802cd4:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  802cd7:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  802cd9:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  802cdd:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  802ce1:	48 b8 ee 1e 80 00 00 	movabs $0x801eee,%rax
+  802ce8:	00 00 00 
+  802ceb:	ff d0                	call   *%rax
+  802ced:	89 c7                	mov    %eax,%edi
+  802cef:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802cf5:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802cfa:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802d01:	00 00 00 
+  802d04:	be 0e 00 00 00       	mov    $0xe,%esi
+  802d09:	48 b8 33 49 80 00 00 	movabs $0x804933,%rax
+  802d10:	00 00 00 
+  802d13:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  802d15:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802d1a:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802d1e:	4c 89 fe             	mov    %r15,%rsi
+  802d21:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d26:	48 b8 0f 49 80 00 00 	movabs $0x80490f,%rax
+  802d2d:	00 00 00 
+  802d30:	ff d0                	call   *%rax
+  802d32:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  802d35:	48 85 d2             	test   %rdx,%rdx
+  802d38:	0f 84 5a fe ff ff    	je     802b98 <devfile_read_direct+0x90>
+            if (res > 0) {
+  802d3e:	0f 8e 5a fe ff ff    	jle    802b9e <devfile_read_direct+0x96>
+                buf += res;
+  802d44:	48 98                	cltq
+  802d46:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  802d49:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  802d4c:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  802d50:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  802d54:	e9 ca fe ff ff       	jmp    802c23 <devfile_read_direct+0x11b>
+            return res ? res : read;
+  802d59:	41 89 c5             	mov    %eax,%r13d
+  802d5c:	48 98                	cltq
+  802d5e:	45 85 ed             	test   %r13d,%r13d
+  802d61:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  802d66:	e9 0d fe ff ff       	jmp    802b78 <devfile_read_direct+0x70>
+            map = 0;
+  802d6b:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802d6f:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802d73:	e9 39 fe ff ff       	jmp    802bb1 <devfile_read_direct+0xa9>
+  802d78:	48 89 d0             	mov    %rdx,%rax
+  802d7b:	e9 f8 fd ff ff       	jmp    802b78 <devfile_read_direct+0x70>
+
+0000000000802d80 <devfile_read>:
+    if (!fd || !buf)
+  802d80:	48 85 ff             	test   %rdi,%rdi
+  802d83:	0f 84 21 02 00 00    	je     802faa <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802d89:	55                   	push   %rbp
+  802d8a:	48 89 e5             	mov    %rsp,%rbp
+  802d8d:	41 57                	push   %r15
+  802d8f:	41 56                	push   %r14
+  802d91:	41 55                	push   %r13
+  802d93:	41 54                	push   %r12
+  802d95:	53                   	push   %rbx
+  802d96:	48 83 ec 28          	sub    $0x28,%rsp
+  802d9a:	48 89 fb             	mov    %rdi,%rbx
+  802d9d:	49 89 f4             	mov    %rsi,%r12
+  802da0:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  802da3:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802da8:	48 85 f6             	test   %rsi,%rsi
+  802dab:	74 4b                	je     802df8 <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  802dad:	48 b8 bd 20 80 00 00 	movabs $0x8020bd,%rax
+  802db4:	00 00 00 
+  802db7:	ff d0                	call   *%rax
+  802db9:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802dbc:	48 85 c0             	test   %rax,%rax
+  802dbf:	74 22                	je     802de3 <devfile_read+0x63>
+  802dc1:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  802dc8:	77 19                	ja     802de3 <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802dca:	be 00 10 00 00       	mov    $0x1000,%esi
+  802dcf:	48 89 df             	mov    %rbx,%rdi
+  802dd2:	48 b8 4e 13 80 00 00 	movabs $0x80134e,%rax
+  802dd9:	00 00 00 
+  802ddc:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802dde:	83 f8 02             	cmp    $0x2,%eax
+  802de1:	7e 40                	jle    802e23 <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  802de3:	48 89 df             	mov    %rbx,%rdi
+  802de6:	48 b8 0a 28 80 00 00 	movabs $0x80280a,%rax
+  802ded:	00 00 00 
+  802df0:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802df2:	85 c0                	test   %eax,%eax
+  802df4:	79 11                	jns    802e07 <devfile_read+0x87>
+  802df6:	48 98                	cltq
+}
+  802df8:	48 83 c4 28          	add    $0x28,%rsp
+  802dfc:	5b                   	pop    %rbx
+  802dfd:	41 5c                	pop    %r12
+  802dff:	41 5d                	pop    %r13
+  802e01:	41 5e                	pop    %r14
+  802e03:	41 5f                	pop    %r15
+  802e05:	5d                   	pop    %rbp
+  802e06:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802e07:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802e0c:	4c 89 ea             	mov    %r13,%rdx
+  802e0f:	4c 89 e6             	mov    %r12,%rsi
+  802e12:	48 89 df             	mov    %rbx,%rdi
+  802e15:	48 b8 08 2b 80 00 00 	movabs $0x802b08,%rax
+  802e1c:	00 00 00 
+  802e1f:	ff d0                	call   *%rax
+  802e21:	eb d5                	jmp    802df8 <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  802e23:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802e27:	48 89 df             	mov    %rbx,%rdi
+  802e2a:	48 b8 0a 28 80 00 00 	movabs $0x80280a,%rax
+  802e31:	00 00 00 
+  802e34:	ff d0                	call   *%rax
+  802e36:	85 c0                	test   %eax,%eax
+  802e38:	0f 88 33 01 00 00    	js     802f71 <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  802e3e:	48 ba 00 23 82 00 00 	movabs $0x822300,%rdx
+  802e45:	00 00 00 
+  802e48:	4c 89 f0             	mov    %r14,%rax
+  802e4b:	48 29 d0             	sub    %rdx,%rax
+  802e4e:	48 c1 f8 03          	sar    $0x3,%rax
+  802e52:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  802e59:	aa aa aa 
+  802e5c:	48 0f af c2          	imul   %rdx,%rax
+  802e60:	48 c1 e0 0e          	shl    $0xe,%rax
+  802e64:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  802e68:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802e6b:	41 39 06             	cmp    %eax,(%r14)
+  802e6e:	75 0d                	jne    802e7d <devfile_read+0xfd>
+  802e70:	8b 43 10             	mov    0x10(%rbx),%eax
+  802e73:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  802e77:	0f 84 fb 00 00 00    	je     802f78 <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  802e7d:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802e82:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802e86:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  802e89:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e8d:	48 89 c7             	mov    %rax,%rdi
+  802e90:	48 b8 d8 3f 80 00 00 	movabs $0x803fd8,%rax
+  802e97:	00 00 00 
+  802e9a:	ff d0                	call   *%rax
+  802e9c:	84 c0                	test   %al,%al
+  802e9e:	75 27                	jne    802ec7 <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802ea0:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802ea5:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802eaa:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802eae:	bf 00 00 00 00       	mov    $0x0,%edi
+  802eb3:	48 b8 89 13 80 00 00 	movabs $0x801389,%rax
+  802eba:	00 00 00 
+  802ebd:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  802ebf:	85 c0                	test   %eax,%eax
+  802ec1:	0f 88 dc 00 00 00    	js     802fa3 <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  802ec7:	44 89 f8             	mov    %r15d,%eax
+  802eca:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802ecf:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  802ed1:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  802ed8:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  802ed9:	8b 43 10             	mov    0x10(%rbx),%eax
+  802edc:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  802ee0:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  802ee3:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802ee8:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802eec:	48 89 df             	mov    %rbx,%rdi
+  802eef:	48 b8 08 2b 80 00 00 	movabs $0x802b08,%rax
+  802ef6:	00 00 00 
+  802ef9:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  802efb:	48 85 c0             	test   %rax,%rax
+  802efe:	0f 88 f4 fe ff ff    	js     802df8 <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  802f04:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802f07:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  802f0a:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  802f0d:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  802f11:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  802f15:	48 63 d1             	movslq %ecx,%rdx
+  802f18:	48 01 d0             	add    %rdx,%rax
+  802f1b:	4d 63 ff             	movslq %r15d,%r15
+  802f1e:	4c 29 f8             	sub    %r15,%rax
+  802f21:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f26:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  802f2a:	48 85 c0             	test   %rax,%rax
+  802f2d:	0f 8e c5 fe ff ff    	jle    802df8 <devfile_read+0x78>
+    n = MIN(n, res);
+  802f33:	4c 39 e8             	cmp    %r13,%rax
+  802f36:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  802f3a:	8b 73 04             	mov    0x4(%rbx),%esi
+  802f3d:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  802f41:	48 63 f6             	movslq %esi,%rsi
+  802f44:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802f49:	48 01 c6             	add    %rax,%rsi
+  802f4c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f50:	48 01 c6             	add    %rax,%rsi
+  802f53:	4c 89 ea             	mov    %r13,%rdx
+  802f56:	4c 89 e7             	mov    %r12,%rdi
+  802f59:	48 b8 8b 10 80 00 00 	movabs $0x80108b,%rax
+  802f60:	00 00 00 
+  802f63:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  802f65:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  802f69:	4c 89 e8             	mov    %r13,%rax
+  802f6c:	e9 87 fe ff ff       	jmp    802df8 <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802f71:	48 98                	cltq
+  802f73:	e9 80 fe ff ff       	jmp    802df8 <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  802f78:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  802f7c:	41 39 d7             	cmp    %edx,%r15d
+  802f7f:	0f 8c f8 fe ff ff    	jl     802e7d <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  802f85:	49 8b 46 10          	mov    0x10(%r14),%rax
+  802f89:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  802f8c:	41 39 cf             	cmp    %ecx,%r15d
+  802f8f:	0f 8d e8 fe ff ff    	jge    802e7d <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  802f95:	4d 63 ff             	movslq %r15d,%r15
+  802f98:	4c 29 f8             	sub    %r15,%rax
+  802f9b:	48 63 d2             	movslq %edx,%rdx
+  802f9e:	48 01 d0             	add    %rdx,%rax
+  802fa1:	eb 87                	jmp    802f2a <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802fa3:	48 98                	cltq
+  802fa5:	e9 4e fe ff ff       	jmp    802df8 <devfile_read+0x78>
+        return E_INVAL;
+  802faa:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802faf:	c3                   	ret
+
+0000000000802fb0 <fs_channel>:
+fs_channel(bool enable) {
+  802fb0:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  802fb2:	a2 04 26 82 00 00 00 	movabs %al,0x822604
+  802fb9:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  802fbb:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fc0:	40 84 ff             	test   %dil,%dil
+  802fc3:	74 47                	je     80300c <fs_channel+0x5c>
+  802fc5:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  802fcc:	00 00 00 
+  802fcf:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  802fd5:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  802fdc:	00 00 00 
+  802fdf:	3b 08                	cmp    (%rax),%ecx
+  802fe1:	74 29                	je     80300c <fs_channel+0x5c>
+fs_channel(bool enable) {
+  802fe3:	55                   	push   %rbp
+  802fe4:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  802fe7:	48 b8 30 1f 80 00 00 	movabs $0x801f30,%rax
+  802fee:	00 00 00 
+  802ff1:	ff d0                	call   *%rax
+  802ff3:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  802ff5:	85 c0                	test   %eax,%eax
+  802ff7:	78 04                	js     802ffd <fs_channel+0x4d>
+}
+  802ff9:	89 d0                	mov    %edx,%eax
+  802ffb:	5d                   	pop    %rbp
+  802ffc:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  802ffd:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  803004:	00 00 00 
+  803007:	c6 00 00             	movb   $0x0,(%rax)
+  80300a:	eb ed                	jmp    802ff9 <fs_channel+0x49>
+}
+  80300c:	89 d0                	mov    %edx,%eax
+  80300e:	c3                   	ret
+
+000000000080300f <open>:
+open(const char *path, int mode) {
+  80300f:	55                   	push   %rbp
+  803010:	48 89 e5             	mov    %rsp,%rbp
+  803013:	41 55                	push   %r13
+  803015:	41 54                	push   %r12
+  803017:	53                   	push   %rbx
+  803018:	48 83 ec 18          	sub    $0x18,%rsp
+  80301c:	49 89 fc             	mov    %rdi,%r12
+  80301f:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803022:	48 b8 ec 0d 80 00 00 	movabs $0x800dec,%rax
+  803029:	00 00 00 
+  80302c:	ff d0                	call   *%rax
+  80302e:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803034:	0f 87 8f 00 00 00    	ja     8030c9 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80303a:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80303e:	48 b8 ea 17 80 00 00 	movabs $0x8017ea,%rax
+  803045:	00 00 00 
+  803048:	ff d0                	call   *%rax
+  80304a:	89 c3                	mov    %eax,%ebx
+  80304c:	85 c0                	test   %eax,%eax
+  80304e:	78 55                	js     8030a5 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  803050:	4c 89 e6             	mov    %r12,%rsi
+  803053:	48 bb 00 00 83 00 00 	movabs $0x830000,%rbx
+  80305a:	00 00 00 
+  80305d:	48 89 df             	mov    %rbx,%rdi
+  803060:	48 b8 2a 0e 80 00 00 	movabs $0x800e2a,%rax
+  803067:	00 00 00 
+  80306a:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  80306c:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  803073:	ba 00 00 00 00       	mov    $0x0,%edx
+  803078:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80307c:	bf 01 00 00 00       	mov    $0x1,%edi
+  803081:	48 b8 a1 25 80 00 00 	movabs $0x8025a1,%rax
+  803088:	00 00 00 
+  80308b:	ff d0                	call   *%rax
+  80308d:	89 c3                	mov    %eax,%ebx
+  80308f:	85 c0                	test   %eax,%eax
+  803091:	78 1f                	js     8030b2 <open+0xa3>
+    return fd2num(fd);
+  803093:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803097:	48 b8 bc 17 80 00 00 	movabs $0x8017bc,%rax
+  80309e:	00 00 00 
+  8030a1:	ff d0                	call   *%rax
+  8030a3:	89 c3                	mov    %eax,%ebx
+}
+  8030a5:	89 d8                	mov    %ebx,%eax
+  8030a7:	48 83 c4 18          	add    $0x18,%rsp
+  8030ab:	5b                   	pop    %rbx
+  8030ac:	41 5c                	pop    %r12
+  8030ae:	41 5d                	pop    %r13
+  8030b0:	5d                   	pop    %rbp
+  8030b1:	c3                   	ret
+        fd_close(fd, 0);
+  8030b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8030b7:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8030bb:	48 b8 05 19 80 00 00 	movabs $0x801905,%rax
+  8030c2:	00 00 00 
+  8030c5:	ff d0                	call   *%rax
+        return res;
+  8030c7:	eb dc                	jmp    8030a5 <open+0x96>
+        return -E_BAD_PATH;
+  8030c9:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8030ce:	eb d5                	jmp    8030a5 <open+0x96>
+
+00000000008030d0 <file_flush_buffers>:
+file_flush_buffers(void) {
+  8030d0:	55                   	push   %rbp
+  8030d1:	48 89 e5             	mov    %rsp,%rbp
+  8030d4:	41 56                	push   %r14
+  8030d6:	41 55                	push   %r13
+  8030d8:	41 54                	push   %r12
+  8030da:	53                   	push   %rbx
+  8030db:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  8030df:	49 bc 08 23 82 00 00 	movabs $0x822308,%r12
+  8030e6:	00 00 00 
+  8030e9:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  8030ee:	49 bd 4a 18 80 00 00 	movabs $0x80184a,%r13
+  8030f5:	00 00 00 
+  8030f8:	49 be 0a 28 80 00 00 	movabs $0x80280a,%r14
+  8030ff:	00 00 00 
+  803102:	eb 0c                	jmp    803110 <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  803104:	83 c3 01             	add    $0x1,%ebx
+  803107:	49 83 c4 18          	add    $0x18,%r12
+  80310b:	83 fb 20             	cmp    $0x20,%ebx
+  80310e:	74 1d                	je     80312d <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  803110:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  803115:	74 ed                	je     803104 <file_flush_buffers+0x34>
+  803117:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80311b:	89 df                	mov    %ebx,%edi
+  80311d:	41 ff d5             	call   *%r13
+  803120:	85 c0                	test   %eax,%eax
+  803122:	78 e0                	js     803104 <file_flush_buffers+0x34>
+  803124:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803128:	41 ff d6             	call   *%r14
+  80312b:	eb d7                	jmp    803104 <file_flush_buffers+0x34>
+}
+  80312d:	48 83 c4 10          	add    $0x10,%rsp
+  803131:	5b                   	pop    %rbx
+  803132:	41 5c                	pop    %r12
+  803134:	41 5d                	pop    %r13
+  803136:	41 5e                	pop    %r14
+  803138:	5d                   	pop    %rbp
+  803139:	c3                   	ret
+
+000000000080313a <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80313a:	55                   	push   %rbp
+  80313b:	48 89 e5             	mov    %rsp,%rbp
+  80313e:	41 54                	push   %r12
+  803140:	53                   	push   %rbx
+  803141:	49 89 fc             	mov    %rdi,%r12
+  803144:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  803146:	48 b8 d0 30 80 00 00 	movabs $0x8030d0,%rax
+  80314d:	00 00 00 
+  803150:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  803152:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803159:	00 00 00 
+  80315c:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  803161:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  803163:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  803166:	ba 00 00 00 00       	mov    $0x0,%edx
+  80316b:	be 00 00 00 00       	mov    $0x0,%esi
+  803170:	bf 02 00 00 00       	mov    $0x2,%edi
+  803175:	48 b8 a1 25 80 00 00 	movabs $0x8025a1,%rax
+  80317c:	00 00 00 
+  80317f:	ff d0                	call   *%rax
+}
+  803181:	5b                   	pop    %rbx
+  803182:	41 5c                	pop    %r12
+  803184:	5d                   	pop    %rbp
+  803185:	c3                   	ret
+
+0000000000803186 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803186:	55                   	push   %rbp
+  803187:	48 89 e5             	mov    %rsp,%rbp
+  80318a:	41 54                	push   %r12
+  80318c:	53                   	push   %rbx
+  80318d:	49 89 fc             	mov    %rdi,%r12
+  803190:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  803193:	48 b8 d0 30 80 00 00 	movabs $0x8030d0,%rax
+  80319a:	00 00 00 
+  80319d:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80319f:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  8031a4:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  8031ab:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  8031ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8031b7:	bf 05 00 00 00       	mov    $0x5,%edi
+  8031bc:	48 b8 a1 25 80 00 00 	movabs $0x8025a1,%rax
+  8031c3:	00 00 00 
+  8031c6:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8031c8:	85 c0                	test   %eax,%eax
+  8031ca:	78 3d                	js     803209 <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8031cc:	49 bc 00 00 83 00 00 	movabs $0x830000,%r12
+  8031d3:	00 00 00 
+  8031d6:	4c 89 e6             	mov    %r12,%rsi
+  8031d9:	48 89 df             	mov    %rbx,%rdi
+  8031dc:	48 b8 2a 0e 80 00 00 	movabs $0x800e2a,%rax
+  8031e3:	00 00 00 
+  8031e6:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8031e8:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8031ef:	00 
+  8031f0:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8031f6:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8031fd:	00 
+  8031fe:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  803204:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803209:	5b                   	pop    %rbx
+  80320a:	41 5c                	pop    %r12
+  80320c:	5d                   	pop    %rbp
+  80320d:	c3                   	ret
+
+000000000080320e <remove>:
+remove(const char *path) {
+  80320e:	55                   	push   %rbp
+  80320f:	48 89 e5             	mov    %rsp,%rbp
+  803212:	53                   	push   %rbx
+  803213:	48 83 ec 08          	sub    $0x8,%rsp
+  803217:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  80321a:	48 b8 ec 0d 80 00 00 	movabs $0x800dec,%rax
+  803221:	00 00 00 
+  803224:	ff d0                	call   *%rax
+  803226:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80322c:	77 3a                	ja     803268 <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  80322e:	48 89 de             	mov    %rbx,%rsi
+  803231:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  803238:	00 00 00 
+  80323b:	48 b8 2a 0e 80 00 00 	movabs $0x800e2a,%rax
+  803242:	00 00 00 
+  803245:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  803247:	ba 00 00 00 00       	mov    $0x0,%edx
+  80324c:	be 00 00 00 00       	mov    $0x0,%esi
+  803251:	bf 07 00 00 00       	mov    $0x7,%edi
+  803256:	48 b8 a1 25 80 00 00 	movabs $0x8025a1,%rax
+  80325d:	00 00 00 
+  803260:	ff d0                	call   *%rax
+}
+  803262:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803266:	c9                   	leave
+  803267:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  803268:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80326d:	eb f3                	jmp    803262 <remove+0x54>
+
+000000000080326f <sync>:
+sync(void) {
+  80326f:	55                   	push   %rbp
+  803270:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  803273:	48 b8 d0 30 80 00 00 	movabs $0x8030d0,%rax
+  80327a:	00 00 00 
+  80327d:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  80327f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803284:	be 00 00 00 00       	mov    $0x0,%esi
+  803289:	bf 08 00 00 00       	mov    $0x8,%edi
+  80328e:	48 b8 a1 25 80 00 00 	movabs $0x8025a1,%rax
+  803295:	00 00 00 
+  803298:	ff d0                	call   *%rax
+}
+  80329a:	5d                   	pop    %rbp
+  80329b:	c3                   	ret
+
+000000000080329c <fsync>:
+fsync(int fdnum) {
+  80329c:	55                   	push   %rbp
+  80329d:	48 89 e5             	mov    %rsp,%rbp
+  8032a0:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8032a4:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8032a8:	48 b8 4a 18 80 00 00 	movabs $0x80184a,%rax
+  8032af:	00 00 00 
+  8032b2:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8032b4:	85 c0                	test   %eax,%eax
+  8032b6:	78 4b                	js     803303 <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8032b8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8032bc:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  8032c3:	00 00 00 
+  8032c6:	8b 00                	mov    (%rax),%eax
+  8032c8:	39 02                	cmp    %eax,(%rdx)
+  8032ca:	75 39                	jne    803305 <fsync+0x69>
+    file_flush_buffers();
+  8032cc:	48 b8 d0 30 80 00 00 	movabs $0x8030d0,%rax
+  8032d3:	00 00 00 
+  8032d6:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  8032d8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8032dc:	8b 40 0c             	mov    0xc(%rax),%eax
+  8032df:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  8032e6:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  8032e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8032f2:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8032f7:	48 b8 a1 25 80 00 00 	movabs $0x8025a1,%rax
+  8032fe:	00 00 00 
+  803301:	ff d0                	call   *%rax
+}
+  803303:	c9                   	leave
+  803304:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803305:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80330a:	eb f7                	jmp    803303 <fsync+0x67>
+
+000000000080330c <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  80330c:	55                   	push   %rbp
+  80330d:	48 89 e5             	mov    %rsp,%rbp
+  803310:	53                   	push   %rbx
+  803311:	48 83 ec 08          	sub    $0x8,%rsp
+  803315:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  803318:	ba 00 00 00 00       	mov    $0x0,%edx
+  80331d:	be 00 00 00 00       	mov    $0x0,%esi
+  803322:	bf 0b 00 00 00       	mov    $0xb,%edi
+  803327:	48 b8 a1 25 80 00 00 	movabs $0x8025a1,%rax
+  80332e:	00 00 00 
+  803331:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803333:	85 c0                	test   %eax,%eax
+  803335:	78 2d                	js     803364 <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  803337:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  80333e:	00 00 00 
+  803341:	48 8b 10             	mov    (%rax),%rdx
+  803344:	48 89 13             	mov    %rdx,(%rbx)
+  803347:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80334b:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  80334f:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803353:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  803357:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80335b:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  80335f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803364:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803368:	c9                   	leave
+  803369:	c3                   	ret
+
+000000000080336a <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  80336a:	55                   	push   %rbp
+  80336b:	48 89 e5             	mov    %rsp,%rbp
+  80336e:	53                   	push   %rbx
+  80336f:	48 83 ec 08          	sub    $0x8,%rsp
+  803373:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  803376:	ba 00 00 00 00       	mov    $0x0,%edx
+  80337b:	be 00 00 00 00       	mov    $0x0,%esi
+  803380:	bf 0c 00 00 00       	mov    $0xc,%edi
+  803385:	48 b8 a1 25 80 00 00 	movabs $0x8025a1,%rax
+  80338c:	00 00 00 
+  80338f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803391:	85 c0                	test   %eax,%eax
+  803393:	78 3d                	js     8033d2 <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  803395:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  80339c:	00 00 00 
+  80339f:	48 8b 10             	mov    (%rax),%rdx
+  8033a2:	48 89 13             	mov    %rdx,(%rbx)
+  8033a5:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8033a9:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  8033ad:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8033b1:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  8033b5:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  8033b9:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  8033bd:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  8033c1:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  8033c5:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8033c9:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  8033cd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8033d2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8033d6:	c9                   	leave
+  8033d7:	c3                   	ret
+
+00000000008033d8 <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  8033d8:	55                   	push   %rbp
+  8033d9:	48 89 e5             	mov    %rsp,%rbp
+  8033dc:	41 57                	push   %r15
+  8033de:	41 56                	push   %r14
+  8033e0:	41 55                	push   %r13
+  8033e2:	41 54                	push   %r12
+  8033e4:	53                   	push   %rbx
+  8033e5:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  8033e9:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  8033f0:	00 
+  8033f1:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  8033f8:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8033fe:	0f 85 43 01 00 00    	jne    803547 <munmap+0x16f>
+  803404:	49 89 ff             	mov    %rdi,%r15
+  803407:	4c 39 f7             	cmp    %r14,%rdi
+  80340a:	0f 87 37 01 00 00    	ja     803547 <munmap+0x16f>
+  803410:	48 bb 00 20 82 00 00 	movabs $0x822000,%rbx
+  803417:	00 00 00 
+  80341a:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  803420:	eb 2c                	jmp    80344e <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  803422:	4c 39 f8             	cmp    %r15,%rax
+  803425:	0f 83 85 00 00 00    	jae    8034b0 <munmap+0xd8>
+            m->mm_end = start;
+  80342b:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  803430:	48 83 c3 18          	add    $0x18,%rbx
+  803434:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  80343b:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  803442:	00 00 00 
+  803445:	48 39 c3             	cmp    %rax,%rbx
+  803448:	0f 84 d0 00 00 00    	je     80351e <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  80344e:	49 89 dc             	mov    %rbx,%r12
+  803451:	48 8b 03             	mov    (%rbx),%rax
+  803454:	4c 39 f0             	cmp    %r14,%rax
+  803457:	73 d7                	jae    803430 <munmap+0x58>
+  803459:	48 85 c0             	test   %rax,%rax
+  80345c:	74 d2                	je     803430 <munmap+0x58>
+  80345e:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  803462:	49 39 d7             	cmp    %rdx,%r15
+  803465:	73 c9                	jae    803430 <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  803467:	49 39 d6             	cmp    %rdx,%r14
+  80346a:	73 b6                	jae    803422 <munmap+0x4a>
+  80346c:	49 39 c7             	cmp    %rax,%r15
+  80346f:	76 b1                	jbe    803422 <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  803471:	4c 89 ef             	mov    %r13,%rdi
+  803474:	48 b8 0f 25 80 00 00 	movabs $0x80250f,%rax
+  80347b:	00 00 00 
+  80347e:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  803480:	48 85 c0             	test   %rax,%rax
+  803483:	0f 84 c5 00 00 00    	je     80354e <munmap+0x176>
+            *tail = *m;
+  803489:	48 8b 13             	mov    (%rbx),%rdx
+  80348c:	48 89 10             	mov    %rdx,(%rax)
+  80348f:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  803493:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  803497:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  80349b:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  80349f:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  8034a2:	44 89 f2             	mov    %r14d,%edx
+  8034a5:	2b 13                	sub    (%rbx),%edx
+  8034a7:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  8034aa:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  8034ae:	eb 80                	jmp    803430 <munmap+0x58>
+        } else if (m->mm_end > end) {
+  8034b0:	49 39 d6             	cmp    %rdx,%r14
+  8034b3:	73 18                	jae    8034cd <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  8034b5:	44 89 f2             	mov    %r14d,%edx
+  8034b8:	41 03 54 24 10       	add    0x10(%r12),%edx
+  8034bd:	29 c2                	sub    %eax,%edx
+  8034bf:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  8034c4:	4d 89 34 24          	mov    %r14,(%r12)
+  8034c8:	e9 63 ff ff ff       	jmp    803430 <munmap+0x58>
+    m->mm_start = 0;
+  8034cd:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  8034d4:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  8034d5:	4c 89 e6             	mov    %r12,%rsi
+  8034d8:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8034df:	00 00 00 
+  8034e2:	48 29 c6             	sub    %rax,%rsi
+  8034e5:	48 c1 fe 03          	sar    $0x3,%rsi
+  8034e9:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8034f0:	aa aa aa 
+  8034f3:	48 0f af f0          	imul   %rax,%rsi
+  8034f7:	48 c1 e6 0c          	shl    $0xc,%rsi
+  8034fb:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  803500:	48 01 c6             	add    %rax,%rsi
+  803503:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803508:	bf 00 00 00 00       	mov    $0x0,%edi
+  80350d:	48 b8 2f 14 80 00 00 	movabs $0x80142f,%rax
+  803514:	00 00 00 
+  803517:	ff d0                	call   *%rax
+}
+  803519:	e9 12 ff ff ff       	jmp    803430 <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  80351e:	4c 89 f2             	mov    %r14,%rdx
+  803521:	4c 29 fa             	sub    %r15,%rdx
+  803524:	4c 89 fe             	mov    %r15,%rsi
+  803527:	bf 00 00 00 00       	mov    $0x0,%edi
+  80352c:	48 b8 2f 14 80 00 00 	movabs $0x80142f,%rax
+  803533:	00 00 00 
+  803536:	ff d0                	call   *%rax
+}
+  803538:	48 83 c4 08          	add    $0x8,%rsp
+  80353c:	5b                   	pop    %rbx
+  80353d:	41 5c                	pop    %r12
+  80353f:	41 5d                	pop    %r13
+  803541:	41 5e                	pop    %r14
+  803543:	41 5f                	pop    %r15
+  803545:	5d                   	pop    %rbp
+  803546:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  803547:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80354c:	eb ea                	jmp    803538 <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  80354e:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  803553:	eb e3                	jmp    803538 <munmap+0x160>
+
+0000000000803555 <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  803555:	55                   	push   %rbp
+  803556:	48 89 e5             	mov    %rsp,%rbp
+  803559:	41 57                	push   %r15
+  80355b:	41 56                	push   %r14
+  80355d:	41 55                	push   %r13
+  80355f:	41 54                	push   %r12
+  803561:	53                   	push   %rbx
+  803562:	48 83 ec 28          	sub    $0x28,%rsp
+  803566:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  80356a:	49 89 f5             	mov    %rsi,%r13
+  80356d:	41 89 d6             	mov    %edx,%r14d
+  803570:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  803573:	41 89 cc             	mov    %ecx,%r12d
+  803576:	44 89 c7             	mov    %r8d,%edi
+  803579:	44 89 cb             	mov    %r9d,%ebx
+  80357c:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803580:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803584:	48 b8 4a 18 80 00 00 	movabs $0x80184a,%rax
+  80358b:	00 00 00 
+  80358e:	ff d0                	call   *%rax
+  803590:	41 89 c7             	mov    %eax,%r15d
+  803593:	85 c0                	test   %eax,%eax
+  803595:	0f 88 ae 01 00 00    	js     803749 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80359b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80359f:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  8035a6:	00 00 00 
+  8035a9:	8b 32                	mov    (%rdx),%esi
+  8035ab:	39 30                	cmp    %esi,(%rax)
+  8035ad:	0f 85 7a 02 00 00    	jne    80382d <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  8035b3:	8b 40 08             	mov    0x8(%rax),%eax
+  8035b6:	83 e0 03             	and    $0x3,%eax
+  8035b9:	83 f8 01             	cmp    $0x1,%eax
+  8035bc:	0f 84 76 02 00 00    	je     803838 <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  8035c2:	4d 85 ed             	test   %r13,%r13
+  8035c5:	0f 84 78 02 00 00    	je     803843 <mmap+0x2ee>
+  8035cb:	85 db                	test   %ebx,%ebx
+  8035cd:	0f 88 70 02 00 00    	js     803843 <mmap+0x2ee>
+  8035d3:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  8035d9:	41 89 df             	mov    %ebx,%r15d
+  8035dc:	0f 85 6c 02 00 00    	jne    80384e <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  8035e2:	44 89 f0             	mov    %r14d,%eax
+  8035e5:	83 e0 fd             	and    $0xfffffffd,%eax
+  8035e8:	83 f8 04             	cmp    $0x4,%eax
+  8035eb:	0f 85 68 02 00 00    	jne    803859 <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  8035f1:	44 89 e1             	mov    %r12d,%ecx
+  8035f4:	83 e1 01             	and    $0x1,%ecx
+  8035f7:	0f 95 c2             	setne  %dl
+  8035fa:	44 89 e0             	mov    %r12d,%eax
+  8035fd:	d1 e8                	shr    %eax
+  8035ff:	83 f0 01             	xor    $0x1,%eax
+  803602:	83 e0 01             	and    $0x1,%eax
+  803605:	38 c2                	cmp    %al,%dl
+  803607:	0f 85 57 02 00 00    	jne    803864 <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  80360d:	85 c9                	test   %ecx,%ecx
+  80360f:	74 0a                	je     80361b <mmap+0xc6>
+  803611:	41 f6 c6 02          	test   $0x2,%r14b
+  803615:	0f 85 54 02 00 00    	jne    80386f <mmap+0x31a>
+    file_flush_buffers();
+  80361b:	48 b8 d0 30 80 00 00 	movabs $0x8030d0,%rax
+  803622:	00 00 00 
+  803625:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  803627:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  80362e:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  803635:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803639:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  80363c:	41 f6 c4 04          	test   $0x4,%r12b
+  803640:	0f 84 15 01 00 00    	je     80375b <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  803646:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  803649:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  80364f:	0f 85 25 02 00 00    	jne    80387a <mmap+0x325>
+  803655:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  803659:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  803660:	00 00 00 
+  803663:	48 39 c2             	cmp    %rax,%rdx
+  803666:	0f 82 19 02 00 00    	jb     803885 <mmap+0x330>
+  80366c:	48 39 c7             	cmp    %rax,%rdi
+  80366f:	0f 87 10 02 00 00    	ja     803885 <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  803675:	4c 89 ee             	mov    %r13,%rsi
+  803678:	48 b8 d8 33 80 00 00 	movabs $0x8033d8,%rax
+  80367f:	00 00 00 
+  803682:	ff d0                	call   *%rax
+  803684:	85 c0                	test   %eax,%eax
+  803686:	0f 88 04 02 00 00    	js     803890 <mmap+0x33b>
+    if (!handler) {
+  80368c:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  803693:	00 00 00 
+  803696:	80 38 00             	cmpb   $0x0,(%rax)
+  803699:	75 2b                	jne    8036c6 <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  80369b:	48 bf 70 24 80 00 00 	movabs $0x802470,%rdi
+  8036a2:	00 00 00 
+  8036a5:	48 b8 de 45 80 00 00 	movabs $0x8045de,%rax
+  8036ac:	00 00 00 
+  8036af:	ff d0                	call   *%rax
+  8036b1:	85 c0                	test   %eax,%eax
+  8036b3:	0f 88 ea 01 00 00    	js     8038a3 <mmap+0x34e>
+        handler = 1;
+  8036b9:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  8036c0:	00 00 00 
+  8036c3:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  8036c6:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8036ca:	48 b8 0f 25 80 00 00 	movabs $0x80250f,%rax
+  8036d1:	00 00 00 
+  8036d4:	ff d0                	call   *%rax
+  8036d6:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  8036d9:	48 85 c0             	test   %rax,%rax
+  8036dc:	0f 84 c9 01 00 00    	je     8038ab <mmap+0x356>
+    m->mm_start = va;
+  8036e2:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  8036e5:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  8036e9:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  8036ed:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  8036f0:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  8036f4:	44 89 e0             	mov    %r12d,%eax
+  8036f7:	c1 e0 06             	shl    $0x6,%eax
+  8036fa:	25 80 00 00 00       	and    $0x80,%eax
+  8036ff:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  803702:	09 f0                	or     %esi,%eax
+  803704:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  803708:	41 f6 c4 08          	test   $0x8,%r12b
+  80370c:	74 31                	je     80373f <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  80370e:	48 39 d3             	cmp    %rdx,%rbx
+  803711:	73 2c                	jae    80373f <mmap+0x1ea>
+  803713:	ba 00 00 04 00       	mov    $0x40000,%edx
+  803718:	48 89 de             	mov    %rbx,%rsi
+  80371b:	4c 89 f7             	mov    %r14,%rdi
+  80371e:	48 b8 5f 23 80 00 00 	movabs $0x80235f,%rax
+  803725:	00 00 00 
+  803728:	ff d0                	call   *%rax
+  80372a:	49 89 c4             	mov    %rax,%r12
+  80372d:	48 85 c0             	test   %rax,%rax
+  803730:	0f 8e d7 00 00 00    	jle    80380d <mmap+0x2b8>
+            va += n;
+  803736:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  803739:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  80373d:	72 d4                	jb     803713 <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  80373f:	49 8b 06             	mov    (%r14),%rax
+  803742:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  803746:	48 89 06             	mov    %rax,(%rsi)
+}
+  803749:	44 89 f8             	mov    %r15d,%eax
+  80374c:	48 83 c4 28          	add    $0x28,%rsp
+  803750:	5b                   	pop    %rbx
+  803751:	41 5c                	pop    %r12
+  803753:	41 5d                	pop    %r13
+  803755:	41 5e                	pop    %r14
+  803757:	41 5f                	pop    %r15
+  803759:	5d                   	pop    %rbp
+  80375a:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80375b:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  803762:	00 00 00 
+  803765:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  803768:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  80376f:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803772:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  803777:	48 be 00 20 82 00 00 	movabs $0x822000,%rsi
+  80377e:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803781:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  803788:	00 00 00 
+  80378b:	48 39 d7             	cmp    %rdx,%rdi
+  80378e:	73 1c                	jae    8037ac <mmap+0x257>
+        return -E_NO_MEM;
+  803790:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803796:	eb b1                	jmp    803749 <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803798:	48 83 c0 01          	add    $0x1,%rax
+  80379c:	48 83 f8 1f          	cmp    $0x1f,%rax
+  8037a0:	77 3f                	ja     8037e1 <mmap+0x28c>
+  8037a2:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  8037a7:	48 39 d7             	cmp    %rdx,%rdi
+  8037aa:	72 2a                	jb     8037d6 <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  8037ac:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  8037b0:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  8037b4:	48 39 d1             	cmp    %rdx,%rcx
+  8037b7:	73 df                	jae    803798 <mmap+0x243>
+  8037b9:	48 85 c9             	test   %rcx,%rcx
+  8037bc:	74 da                	je     803798 <mmap+0x243>
+  8037be:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  8037c2:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  8037c7:	48 39 d3             	cmp    %rdx,%rbx
+  8037ca:	73 cc                	jae    803798 <mmap+0x243>
+            va = mmaps[i].mm_end;
+  8037cc:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8037cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037d4:	eb cc                	jmp    8037a2 <mmap+0x24d>
+        return -E_NO_MEM;
+  8037d6:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8037dc:	e9 68 ff ff ff       	jmp    803749 <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  8037e1:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  8037e6:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  8037ed:	00 00 00 
+  8037f0:	48 39 c2             	cmp    %rax,%rdx
+  8037f3:	0f 82 9f 00 00 00    	jb     803898 <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  8037f9:	48 85 db             	test   %rbx,%rbx
+  8037fc:	0f 85 8a fe ff ff    	jne    80368c <mmap+0x137>
+        return -E_NO_MEM;
+  803802:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803808:	e9 3c ff ff ff       	jmp    803749 <mmap+0x1f4>
+        if (n < 0) {
+  80380d:	0f 89 2c ff ff ff    	jns    80373f <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  803813:	49 8b 3e             	mov    (%r14),%rdi
+  803816:	4c 89 ee             	mov    %r13,%rsi
+  803819:	48 b8 d8 33 80 00 00 	movabs $0x8033d8,%rax
+  803820:	00 00 00 
+  803823:	ff d0                	call   *%rax
+            return n;
+  803825:	45 89 e7             	mov    %r12d,%r15d
+  803828:	e9 1c ff ff ff       	jmp    803749 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80382d:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803833:	e9 11 ff ff ff       	jmp    803749 <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  803838:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80383e:	e9 06 ff ff ff       	jmp    803749 <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  803843:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803849:	e9 fb fe ff ff       	jmp    803749 <mmap+0x1f4>
+  80384e:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803854:	e9 f0 fe ff ff       	jmp    803749 <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  803859:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80385f:	e9 e5 fe ff ff       	jmp    803749 <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  803864:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80386a:	e9 da fe ff ff       	jmp    803749 <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  80386f:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  803875:	e9 cf fe ff ff       	jmp    803749 <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  80387a:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803880:	e9 c4 fe ff ff       	jmp    803749 <mmap+0x1f4>
+  803885:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80388b:	e9 b9 fe ff ff       	jmp    803749 <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  803890:	41 89 c7             	mov    %eax,%r15d
+  803893:	e9 b1 fe ff ff       	jmp    803749 <mmap+0x1f4>
+        return -E_NO_MEM;
+  803898:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80389e:	e9 a6 fe ff ff       	jmp    803749 <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  8038a3:	41 89 c7             	mov    %eax,%r15d
+  8038a6:	e9 9e fe ff ff       	jmp    803749 <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  8038ab:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8038b1:	e9 93 fe ff ff       	jmp    803749 <mmap+0x1f4>
+
+00000000008038b6 <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8038b6:	55                   	push   %rbp
+  8038b7:	48 89 e5             	mov    %rsp,%rbp
+  8038ba:	41 54                	push   %r12
+  8038bc:	53                   	push   %rbx
+  8038bd:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8038c0:	48 b8 ce 17 80 00 00 	movabs $0x8017ce,%rax
+  8038c7:	00 00 00 
+  8038ca:	ff d0                	call   *%rax
+  8038cc:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8038cf:	48 be 60 50 80 00 00 	movabs $0x805060,%rsi
+  8038d6:	00 00 00 
+  8038d9:	48 89 df             	mov    %rbx,%rdi
+  8038dc:	48 b8 2a 0e 80 00 00 	movabs $0x800e2a,%rax
+  8038e3:	00 00 00 
+  8038e6:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8038e8:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8038ed:	41 2b 04 24          	sub    (%r12),%eax
+  8038f1:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8038f7:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8038fe:	00 00 00 
+    stat->st_dev = &devpipe;
+  803901:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803908:	00 00 00 
+  80390b:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803912:	b8 00 00 00 00       	mov    $0x0,%eax
+  803917:	5b                   	pop    %rbx
+  803918:	41 5c                	pop    %r12
+  80391a:	5d                   	pop    %rbp
+  80391b:	c3                   	ret
+
+000000000080391c <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  80391c:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  80391f:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  803925:	8b 17                	mov    (%rdi),%edx
+  803927:	85 d2                	test   %edx,%edx
+  803929:	75 01                	jne    80392c <pipe_wakeup+0x10>
+  80392b:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  80392c:	55                   	push   %rbp
+  80392d:	48 89 e5             	mov    %rsp,%rbp
+  803930:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  803933:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  803939:	be 00 04 00 00       	mov    $0x400,%esi
+  80393e:	48 b8 15 17 80 00 00 	movabs $0x801715,%rax
+  803945:	00 00 00 
+  803948:	ff d0                	call   *%rax
+}
+  80394a:	5d                   	pop    %rbp
+  80394b:	c3                   	ret
+
+000000000080394c <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80394c:	55                   	push   %rbp
+  80394d:	48 89 e5             	mov    %rsp,%rbp
+  803950:	41 55                	push   %r13
+  803952:	41 54                	push   %r12
+  803954:	53                   	push   %rbx
+  803955:	48 83 ec 08          	sub    $0x8,%rsp
+  803959:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80395c:	48 b8 ce 17 80 00 00 	movabs $0x8017ce,%rax
+  803963:	00 00 00 
+  803966:	ff d0                	call   *%rax
+  803968:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80396b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803970:	4c 89 e6             	mov    %r12,%rsi
+  803973:	bf 00 00 00 00       	mov    $0x0,%edi
+  803978:	49 bc 2f 14 80 00 00 	movabs $0x80142f,%r12
+  80397f:	00 00 00 
+  803982:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803985:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803989:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  80398d:	49 bd 1c 39 80 00 00 	movabs $0x80391c,%r13
+  803994:	00 00 00 
+  803997:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  80399a:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  80399e:	48 89 de             	mov    %rbx,%rsi
+  8039a1:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  8039a4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8039a9:	48 89 de             	mov    %rbx,%rsi
+  8039ac:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039b1:	41 ff d4             	call   *%r12
+  8039b4:	48 83 c4 08          	add    $0x8,%rsp
+  8039b8:	5b                   	pop    %rbx
+  8039b9:	41 5c                	pop    %r12
+  8039bb:	41 5d                	pop    %r13
+  8039bd:	5d                   	pop    %rbp
+  8039be:	c3                   	ret
+
+00000000008039bf <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  8039bf:	55                   	push   %rbp
+  8039c0:	48 89 e5             	mov    %rsp,%rbp
+  8039c3:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8039c6:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8039cb:	be 00 10 00 00       	mov    $0x1000,%esi
+  8039d0:	48 b8 72 13 80 00 00 	movabs $0x801372,%rax
+  8039d7:	00 00 00 
+  8039da:	ff d0                	call   *%rax
+  8039dc:	85 c0                	test   %eax,%eax
+  8039de:	0f 94 c0             	sete   %al
+  8039e1:	0f b6 c0             	movzbl %al,%eax
+}
+  8039e4:	5d                   	pop    %rbp
+  8039e5:	c3                   	ret
+
+00000000008039e6 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8039e6:	55                   	push   %rbp
+  8039e7:	48 89 e5             	mov    %rsp,%rbp
+  8039ea:	41 57                	push   %r15
+  8039ec:	41 56                	push   %r14
+  8039ee:	41 55                	push   %r13
+  8039f0:	41 54                	push   %r12
+  8039f2:	53                   	push   %rbx
+  8039f3:	48 83 ec 38          	sub    $0x38,%rsp
+  8039f7:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8039fb:	49 89 f4             	mov    %rsi,%r12
+  8039fe:	49 89 d7             	mov    %rdx,%r15
+  803a01:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803a05:	48 b8 ce 17 80 00 00 	movabs $0x8017ce,%rax
+  803a0c:	00 00 00 
+  803a0f:	ff d0                	call   *%rax
+  803a11:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803a14:	4d 85 ff             	test   %r15,%r15
+  803a17:	0f 84 f1 00 00 00    	je     803b0e <devpipe_write+0x128>
+  803a1d:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  803a21:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  803a25:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  803a29:	49 bd bf 39 80 00 00 	movabs $0x8039bf,%r13
+  803a30:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803a33:	49 bf 1c 39 80 00 00 	movabs $0x80391c,%r15
+  803a3a:	00 00 00 
+  803a3d:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803a41:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803a45:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803a49:	8b 73 04             	mov    0x4(%rbx),%esi
+  803a4c:	48 63 ce             	movslq %esi,%rcx
+  803a4f:	48 63 03             	movslq (%rbx),%rax
+  803a52:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  803a58:	48 39 c1             	cmp    %rax,%rcx
+  803a5b:	72 64                	jb     803ac1 <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  803a5d:	48 89 de             	mov    %rbx,%rsi
+  803a60:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803a64:	41 ff d5             	call   *%r13
+  803a67:	85 c0                	test   %eax,%eax
+  803a69:	0f 85 b9 00 00 00    	jne    803b28 <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803a6f:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803a73:	4c 89 f7             	mov    %r14,%rdi
+  803a76:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  803a79:	8b 43 04             	mov    0x4(%rbx),%eax
+  803a7c:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  803a83:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803a8a:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803a90:	8b 03                	mov    (%rbx),%eax
+  803a92:	41 39 c4             	cmp    %eax,%r12d
+  803a95:	75 b2                	jne    803a49 <devpipe_write+0x63>
+  803a97:	48 89 de             	mov    %rbx,%rsi
+  803a9a:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803a9e:	41 ff d5             	call   *%r13
+  803aa1:	85 c0                	test   %eax,%eax
+  803aa3:	75 a0                	jne    803a45 <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803aa5:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803aaa:	44 89 e6             	mov    %r12d,%esi
+  803aad:	48 89 df             	mov    %rbx,%rdi
+  803ab0:	48 b8 f7 16 80 00 00 	movabs $0x8016f7,%rax
+  803ab7:	00 00 00 
+  803aba:	ff d0                	call   *%rax
+  803abc:	e9 7c ff ff ff       	jmp    803a3d <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803ac1:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  803ac5:	41 0f b6 38          	movzbl (%r8),%edi
+  803ac9:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803ad0:	80 80 80 
+  803ad3:	48 89 c8             	mov    %rcx,%rax
+  803ad6:	48 f7 e2             	mul    %rdx
+  803ad9:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803add:	48 89 d0             	mov    %rdx,%rax
+  803ae0:	48 c1 e0 08          	shl    $0x8,%rax
+  803ae4:	48 29 d0             	sub    %rdx,%rax
+  803ae7:	48 c1 e0 04          	shl    $0x4,%rax
+  803aeb:	48 29 c1             	sub    %rax,%rcx
+  803aee:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  803af3:	83 c6 01             	add    $0x1,%esi
+  803af6:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803af9:	49 83 c0 01          	add    $0x1,%r8
+  803afd:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  803b01:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803b05:	49 39 c0             	cmp    %rax,%r8
+  803b08:	0f 85 2f ff ff ff    	jne    803a3d <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803b0e:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803b12:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803b16:	48 b8 1c 39 80 00 00 	movabs $0x80391c,%rax
+  803b1d:	00 00 00 
+  803b20:	ff d0                	call   *%rax
+    return n;
+  803b22:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803b26:	eb 05                	jmp    803b2d <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  803b28:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803b2d:	48 83 c4 38          	add    $0x38,%rsp
+  803b31:	5b                   	pop    %rbx
+  803b32:	41 5c                	pop    %r12
+  803b34:	41 5d                	pop    %r13
+  803b36:	41 5e                	pop    %r14
+  803b38:	41 5f                	pop    %r15
+  803b3a:	5d                   	pop    %rbp
+  803b3b:	c3                   	ret
+
+0000000000803b3c <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803b3c:	55                   	push   %rbp
+  803b3d:	48 89 e5             	mov    %rsp,%rbp
+  803b40:	41 57                	push   %r15
+  803b42:	41 56                	push   %r14
+  803b44:	41 55                	push   %r13
+  803b46:	41 54                	push   %r12
+  803b48:	53                   	push   %rbx
+  803b49:	48 83 ec 28          	sub    $0x28,%rsp
+  803b4d:	49 89 fd             	mov    %rdi,%r13
+  803b50:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  803b54:	49 89 d4             	mov    %rdx,%r12
+  803b57:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803b5b:	48 b8 ce 17 80 00 00 	movabs $0x8017ce,%rax
+  803b62:	00 00 00 
+  803b65:	ff d0                	call   *%rax
+  803b67:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803b6a:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  803b70:	49 bf bf 39 80 00 00 	movabs $0x8039bf,%r15
+  803b77:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803b7a:	4d 85 e4             	test   %r12,%r12
+  803b7d:	0f 84 d5 00 00 00    	je     803c58 <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803b83:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803b87:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803b8b:	8b 03                	mov    (%rbx),%eax
+  803b8d:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803b90:	75 7a                	jne    803c0c <devpipe_read+0xd0>
+            if (i > 0) {
+  803b92:	4d 85 f6             	test   %r14,%r14
+  803b95:	75 50                	jne    803be7 <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  803b97:	48 89 de             	mov    %rbx,%rsi
+  803b9a:	4c 89 ef             	mov    %r13,%rdi
+  803b9d:	41 ff d7             	call   *%r15
+  803ba0:	85 c0                	test   %eax,%eax
+  803ba2:	0f 85 c9 00 00 00    	jne    803c71 <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803ba8:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  803bab:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803bb2:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803bb8:	8b 43 04             	mov    0x4(%rbx),%eax
+  803bbb:	41 39 c4             	cmp    %eax,%r12d
+  803bbe:	75 cb                	jne    803b8b <devpipe_read+0x4f>
+  803bc0:	48 89 de             	mov    %rbx,%rsi
+  803bc3:	4c 89 ef             	mov    %r13,%rdi
+  803bc6:	41 ff d7             	call   *%r15
+  803bc9:	85 c0                	test   %eax,%eax
+  803bcb:	75 be                	jne    803b8b <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803bcd:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803bd2:	44 89 e6             	mov    %r12d,%esi
+  803bd5:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803bd9:	48 b8 f7 16 80 00 00 	movabs $0x8016f7,%rax
+  803be0:	00 00 00 
+  803be3:	ff d0                	call   *%rax
+  803be5:	eb a4                	jmp    803b8b <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803be7:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803beb:	48 89 de             	mov    %rbx,%rsi
+  803bee:	48 b8 1c 39 80 00 00 	movabs $0x80391c,%rax
+  803bf5:	00 00 00 
+  803bf8:	ff d0                	call   *%rax
+                return i;
+  803bfa:	4c 89 f0             	mov    %r14,%rax
+}
+  803bfd:	48 83 c4 28          	add    $0x28,%rsp
+  803c01:	5b                   	pop    %rbx
+  803c02:	41 5c                	pop    %r12
+  803c04:	41 5d                	pop    %r13
+  803c06:	41 5e                	pop    %r14
+  803c08:	41 5f                	pop    %r15
+  803c0a:	5d                   	pop    %rbp
+  803c0b:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803c0c:	48 63 c8             	movslq %eax,%rcx
+  803c0f:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803c16:	80 80 80 
+  803c19:	48 89 c8             	mov    %rcx,%rax
+  803c1c:	48 f7 e2             	mul    %rdx
+  803c1f:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803c23:	48 89 d0             	mov    %rdx,%rax
+  803c26:	48 c1 e0 08          	shl    $0x8,%rax
+  803c2a:	48 29 d0             	sub    %rdx,%rax
+  803c2d:	48 c1 e0 04          	shl    $0x4,%rax
+  803c31:	48 89 c2             	mov    %rax,%rdx
+  803c34:	48 89 c8             	mov    %rcx,%rax
+  803c37:	48 29 d0             	sub    %rdx,%rax
+  803c3a:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  803c3f:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803c43:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  803c47:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803c4a:	49 83 c6 01          	add    $0x1,%r14
+  803c4e:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  803c52:	0f 85 2b ff ff ff    	jne    803b83 <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803c58:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803c5c:	48 89 de             	mov    %rbx,%rsi
+  803c5f:	48 b8 1c 39 80 00 00 	movabs $0x80391c,%rax
+  803c66:	00 00 00 
+  803c69:	ff d0                	call   *%rax
+    return n;
+  803c6b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803c6f:	eb 8c                	jmp    803bfd <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  803c71:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c76:	eb 85                	jmp    803bfd <devpipe_read+0xc1>
+
+0000000000803c78 <pipe>:
+pipe(int pfd[2]) {
+  803c78:	55                   	push   %rbp
+  803c79:	48 89 e5             	mov    %rsp,%rbp
+  803c7c:	41 55                	push   %r13
+  803c7e:	41 54                	push   %r12
+  803c80:	53                   	push   %rbx
+  803c81:	48 83 ec 18          	sub    $0x18,%rsp
+  803c85:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803c88:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803c8c:	48 b8 ea 17 80 00 00 	movabs $0x8017ea,%rax
+  803c93:	00 00 00 
+  803c96:	ff d0                	call   *%rax
+  803c98:	89 c3                	mov    %eax,%ebx
+  803c9a:	85 c0                	test   %eax,%eax
+  803c9c:	0f 88 a0 01 00 00    	js     803e42 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803ca2:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803ca7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803cac:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803cb0:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cb5:	48 b8 89 13 80 00 00 	movabs $0x801389,%rax
+  803cbc:	00 00 00 
+  803cbf:	ff d0                	call   *%rax
+  803cc1:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803cc3:	85 c0                	test   %eax,%eax
+  803cc5:	0f 88 77 01 00 00    	js     803e42 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803ccb:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803ccf:	48 b8 ea 17 80 00 00 	movabs $0x8017ea,%rax
+  803cd6:	00 00 00 
+  803cd9:	ff d0                	call   *%rax
+  803cdb:	89 c3                	mov    %eax,%ebx
+  803cdd:	85 c0                	test   %eax,%eax
+  803cdf:	0f 88 43 01 00 00    	js     803e28 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803ce5:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803cea:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803cef:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803cf3:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cf8:	48 b8 89 13 80 00 00 	movabs $0x801389,%rax
+  803cff:	00 00 00 
+  803d02:	ff d0                	call   *%rax
+  803d04:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803d06:	85 c0                	test   %eax,%eax
+  803d08:	0f 88 1a 01 00 00    	js     803e28 <pipe+0x1b0>
+    va = fd2data(fd0);
+  803d0e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803d12:	48 b8 ce 17 80 00 00 	movabs $0x8017ce,%rax
+  803d19:	00 00 00 
+  803d1c:	ff d0                	call   *%rax
+  803d1e:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803d21:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803d26:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d2b:	48 89 c6             	mov    %rax,%rsi
+  803d2e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d33:	48 b8 89 13 80 00 00 	movabs $0x801389,%rax
+  803d3a:	00 00 00 
+  803d3d:	ff d0                	call   *%rax
+  803d3f:	89 c3                	mov    %eax,%ebx
+  803d41:	85 c0                	test   %eax,%eax
+  803d43:	0f 88 c5 00 00 00    	js     803e0e <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803d49:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803d4d:	48 b8 ce 17 80 00 00 	movabs $0x8017ce,%rax
+  803d54:	00 00 00 
+  803d57:	ff d0                	call   *%rax
+  803d59:	48 89 c1             	mov    %rax,%rcx
+  803d5c:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803d62:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803d68:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d6d:	4c 89 ee             	mov    %r13,%rsi
+  803d70:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d75:	48 b8 df 13 80 00 00 	movabs $0x8013df,%rax
+  803d7c:	00 00 00 
+  803d7f:	ff d0                	call   *%rax
+  803d81:	89 c3                	mov    %eax,%ebx
+  803d83:	85 c0                	test   %eax,%eax
+  803d85:	78 6e                	js     803df5 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803d87:	be 00 10 00 00       	mov    $0x1000,%esi
+  803d8c:	4c 89 ef             	mov    %r13,%rdi
+  803d8f:	48 b8 4e 13 80 00 00 	movabs $0x80134e,%rax
+  803d96:	00 00 00 
+  803d99:	ff d0                	call   *%rax
+  803d9b:	83 f8 02             	cmp    $0x2,%eax
+  803d9e:	0f 85 ab 00 00 00    	jne    803e4f <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803da4:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803dab:	00 00 
+  803dad:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803db1:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803db3:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803db7:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803dbe:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803dc2:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803dc4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803dc8:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803dcf:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803dd3:	48 bb bc 17 80 00 00 	movabs $0x8017bc,%rbx
+  803dda:	00 00 00 
+  803ddd:	ff d3                	call   *%rbx
+  803ddf:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803de3:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803de7:	ff d3                	call   *%rbx
+  803de9:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803dee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803df3:	eb 4d                	jmp    803e42 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803df5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803dfa:	4c 89 ee             	mov    %r13,%rsi
+  803dfd:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e02:	48 b8 2f 14 80 00 00 	movabs $0x80142f,%rax
+  803e09:	00 00 00 
+  803e0c:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803e0e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803e13:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803e17:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e1c:	48 b8 2f 14 80 00 00 	movabs $0x80142f,%rax
+  803e23:	00 00 00 
+  803e26:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803e28:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803e2d:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803e31:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e36:	48 b8 2f 14 80 00 00 	movabs $0x80142f,%rax
+  803e3d:	00 00 00 
+  803e40:	ff d0                	call   *%rax
+}
+  803e42:	89 d8                	mov    %ebx,%eax
+  803e44:	48 83 c4 18          	add    $0x18,%rsp
+  803e48:	5b                   	pop    %rbx
+  803e49:	41 5c                	pop    %r12
+  803e4b:	41 5d                	pop    %r13
+  803e4d:	5d                   	pop    %rbp
+  803e4e:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803e4f:	48 b9 90 50 80 00 00 	movabs $0x805090,%rcx
+  803e56:	00 00 00 
+  803e59:	48 ba 67 50 80 00 00 	movabs $0x805067,%rdx
+  803e60:	00 00 00 
+  803e63:	be 50 00 00 00       	mov    $0x50,%esi
+  803e68:	48 bf 7c 50 80 00 00 	movabs $0x80507c,%rdi
+  803e6f:	00 00 00 
+  803e72:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e77:	49 b8 b1 44 80 00 00 	movabs $0x8044b1,%r8
+  803e7e:	00 00 00 
+  803e81:	41 ff d0             	call   *%r8
+
+0000000000803e84 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803e84:	55                   	push   %rbp
+  803e85:	48 89 e5             	mov    %rsp,%rbp
+  803e88:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803e8c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803e90:	48 b8 4a 18 80 00 00 	movabs $0x80184a,%rax
+  803e97:	00 00 00 
+  803e9a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803e9c:	85 c0                	test   %eax,%eax
+  803e9e:	78 23                	js     803ec3 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803ea0:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803ea4:	48 b8 ce 17 80 00 00 	movabs $0x8017ce,%rax
+  803eab:	00 00 00 
+  803eae:	ff d0                	call   *%rax
+  803eb0:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  803eb3:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803eb7:	48 b8 bf 39 80 00 00 	movabs $0x8039bf,%rax
+  803ebe:	00 00 00 
+  803ec1:	ff d0                	call   *%rax
+}
+  803ec3:	c9                   	leave
+  803ec4:	c3                   	ret
+
+0000000000803ec5 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803ec5:	48 89 f8             	mov    %rdi,%rax
+  803ec8:	48 c1 e8 27          	shr    $0x27,%rax
+  803ecc:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803ed3:	01 00 00 
+  803ed6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803eda:	f6 c2 01             	test   $0x1,%dl
+  803edd:	74 6d                	je     803f4c <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803edf:	48 89 f8             	mov    %rdi,%rax
+  803ee2:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803ee6:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803eed:	01 00 00 
+  803ef0:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803ef4:	f6 c2 01             	test   $0x1,%dl
+  803ef7:	74 62                	je     803f5b <get_uvpt_entry+0x96>
+  803ef9:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803f00:	01 00 00 
+  803f03:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803f07:	f6 c2 80             	test   $0x80,%dl
+  803f0a:	75 4f                	jne    803f5b <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803f0c:	48 89 f8             	mov    %rdi,%rax
+  803f0f:	48 c1 e8 15          	shr    $0x15,%rax
+  803f13:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803f1a:	01 00 00 
+  803f1d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803f21:	f6 c2 01             	test   $0x1,%dl
+  803f24:	74 44                	je     803f6a <get_uvpt_entry+0xa5>
+  803f26:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803f2d:	01 00 00 
+  803f30:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803f34:	f6 c2 80             	test   $0x80,%dl
+  803f37:	75 31                	jne    803f6a <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803f39:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803f3d:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803f44:	01 00 00 
+  803f47:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803f4b:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803f4c:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803f53:	01 00 00 
+  803f56:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803f5a:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803f5b:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803f62:	01 00 00 
+  803f65:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803f69:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803f6a:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803f71:	01 00 00 
+  803f74:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803f78:	c3                   	ret
+
+0000000000803f79 <get_prot>:
+
+int
+get_prot(void *va) {
+  803f79:	55                   	push   %rbp
+  803f7a:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803f7d:	48 b8 c5 3e 80 00 00 	movabs $0x803ec5,%rax
+  803f84:	00 00 00 
+  803f87:	ff d0                	call   *%rax
+  803f89:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803f8c:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803f91:	89 c1                	mov    %eax,%ecx
+  803f93:	83 c9 04             	or     $0x4,%ecx
+  803f96:	f6 c2 01             	test   $0x1,%dl
+  803f99:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803f9c:	89 c1                	mov    %eax,%ecx
+  803f9e:	83 c9 02             	or     $0x2,%ecx
+  803fa1:	f6 c2 02             	test   $0x2,%dl
+  803fa4:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803fa7:	89 c1                	mov    %eax,%ecx
+  803fa9:	83 c9 01             	or     $0x1,%ecx
+  803fac:	48 85 d2             	test   %rdx,%rdx
+  803faf:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803fb2:	89 c1                	mov    %eax,%ecx
+  803fb4:	83 c9 40             	or     $0x40,%ecx
+  803fb7:	f6 c6 04             	test   $0x4,%dh
+  803fba:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803fbd:	5d                   	pop    %rbp
+  803fbe:	c3                   	ret
+
+0000000000803fbf <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803fbf:	55                   	push   %rbp
+  803fc0:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803fc3:	48 b8 c5 3e 80 00 00 	movabs $0x803ec5,%rax
+  803fca:	00 00 00 
+  803fcd:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803fcf:	48 c1 e8 06          	shr    $0x6,%rax
+  803fd3:	83 e0 01             	and    $0x1,%eax
+}
+  803fd6:	5d                   	pop    %rbp
+  803fd7:	c3                   	ret
+
+0000000000803fd8 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803fd8:	55                   	push   %rbp
+  803fd9:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803fdc:	48 b8 c5 3e 80 00 00 	movabs $0x803ec5,%rax
+  803fe3:	00 00 00 
+  803fe6:	ff d0                	call   *%rax
+  803fe8:	83 e0 01             	and    $0x1,%eax
+}
+  803feb:	5d                   	pop    %rbp
+  803fec:	c3                   	ret
+
+0000000000803fed <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  803fed:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  803ff4:	01 00 00 
+  803ff7:	a8 01                	test   $0x1,%al
+  803ff9:	75 06                	jne    804001 <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  803ffb:	b8 00 00 00 00       	mov    $0x0,%eax
+  804000:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804001:	55                   	push   %rbp
+  804002:	48 89 e5             	mov    %rsp,%rbp
+  804005:	41 57                	push   %r15
+  804007:	41 56                	push   %r14
+  804009:	41 55                	push   %r13
+  80400b:	41 54                	push   %r12
+  80400d:	53                   	push   %rbx
+  80400e:	48 83 ec 28          	sub    $0x28,%rsp
+  804012:	49 89 fe             	mov    %rdi,%r14
+  804015:	49 89 f7             	mov    %rsi,%r15
+  804018:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  80401f:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  804020:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  804027:	01 00 00 
+  80402a:	e9 ae 00 00 00       	jmp    8040dd <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  80402f:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804036:	49 83 ec 01          	sub    $0x1,%r12
+  80403a:	74 2d                	je     804069 <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  80403c:	48 89 d8             	mov    %rbx,%rax
+  80403f:	48 c1 e8 0c          	shr    $0xc,%rax
+  804043:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  804048:	f6 c2 01             	test   $0x1,%dl
+  80404b:	74 e2                	je     80402f <foreach_shared_region+0x42>
+  80404d:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  804052:	f6 c4 04             	test   $0x4,%ah
+  804055:	74 d8                	je     80402f <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  804057:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  80405e:	4c 89 fa             	mov    %r15,%rdx
+  804061:	48 89 df             	mov    %rbx,%rdi
+  804064:	41 ff d6             	call   *%r14
+  804067:	eb c6                	jmp    80402f <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  804069:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  804070:	00 
+  804071:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  804076:	74 4a                	je     8040c2 <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  804078:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80407c:	48 c1 e8 15          	shr    $0x15,%rax
+  804080:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  804087:	01 00 00 
+  80408a:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  80408e:	a8 01                	test   $0x1,%al
+  804090:	74 d7                	je     804069 <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  804092:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  804096:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  80409d:	48 39 c3             	cmp    %rax,%rbx
+  8040a0:	73 c7                	jae    804069 <foreach_shared_region+0x7c>
+  8040a2:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  8040a9:	48 39 d0             	cmp    %rdx,%rax
+  8040ac:	4d 19 e4             	sbb    %r12,%r12
+  8040af:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  8040b6:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  8040bd:	e9 7a ff ff ff       	jmp    80403c <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  8040c2:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  8040c9:	40 
+  8040ca:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8040ce:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8040d5:	00 00 00 
+  8040d8:	48 39 c1             	cmp    %rax,%rcx
+  8040db:	74 50                	je     80412d <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  8040dd:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8040e1:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8040e5:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  8040ec:	01 00 00 
+  8040ef:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  8040f3:	a8 01                	test   $0x1,%al
+  8040f5:	74 cb                	je     8040c2 <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  8040f7:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8040fb:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  804102:	48 39 c1             	cmp    %rax,%rcx
+  804105:	73 bb                	jae    8040c2 <foreach_shared_region+0xd5>
+  804107:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  80410e:	48 39 d0             	cmp    %rdx,%rax
+  804111:	48 19 c0             	sbb    %rax,%rax
+  804114:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  80411a:	48 05 00 02 00 00    	add    $0x200,%rax
+  804120:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804124:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  804128:	e9 4b ff ff ff       	jmp    804078 <foreach_shared_region+0x8b>
+  80412d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804132:	48 83 c4 28          	add    $0x28,%rsp
+  804136:	5b                   	pop    %rbx
+  804137:	41 5c                	pop    %r12
+  804139:	41 5d                	pop    %r13
+  80413b:	41 5e                	pop    %r14
+  80413d:	41 5f                	pop    %r15
+  80413f:	5d                   	pop    %rbp
+  804140:	c3                   	ret
+
+0000000000804141 <vsys_gettime>:
+
+static inline uint64_t
+vsyscall(int num) {
+    // LAB 12: Your code here
+    if (num == VSYS_gettime) {
+        return vsys[num];
+  804141:	a1 00 f0 bf 1f 80 00 	movabs 0x801fbff000,%eax
+  804148:	00 00 
+}
+
+int
+vsys_gettime(void) {
+    return vsyscall(VSYS_gettime);
+}
+  80414a:	c3                   	ret
+
+000000000080414b <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  80414b:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  804151:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  804158:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  80415f:	c3                   	ret
+
+0000000000804160 <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  804160:	8b 47 40             	mov    0x40(%rdi),%eax
+  804163:	8b 17                	mov    (%rdi),%edx
+  804165:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  804167:	83 f8 0f             	cmp    $0xf,%eax
+  80416a:	77 13                	ja     80417f <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  80416c:	8b 47 40             	mov    0x40(%rdi),%eax
+  80416f:	83 e0 0f             	and    $0xf,%eax
+  804172:	48 c1 e0 09          	shl    $0x9,%rax
+  804176:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  80417d:	00 
+  80417e:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  80417f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804184:	c3                   	ret
+
+0000000000804185 <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  804185:	8b 47 40             	mov    0x40(%rdi),%eax
+  804188:	83 c0 01             	add    $0x1,%eax
+  80418b:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  80418e:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  804194:	8b 57 04             	mov    0x4(%rdi),%edx
+  804197:	b8 00 00 00 00       	mov    $0x0,%eax
+  80419c:	85 d2                	test   %edx,%edx
+  80419e:	75 04                	jne    8041a4 <chan_publish+0x1f>
+  8041a0:	83 e0 01             	and    $0x1,%eax
+}
+  8041a3:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  8041a4:	87 47 04             	xchg   %eax,0x4(%rdi)
+  8041a7:	85 c0                	test   %eax,%eax
+  8041a9:	0f 95 c0             	setne  %al
+  8041ac:	0f b6 c0             	movzbl %al,%eax
+  8041af:	eb ef                	jmp    8041a0 <chan_publish+0x1b>
+
+00000000008041b1 <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  8041b1:	8b 47 40             	mov    0x40(%rdi),%eax
+  8041b4:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  8041b6:	29 d0                	sub    %edx,%eax
+  8041b8:	83 e8 01             	sub    $0x1,%eax
+  8041bb:	83 f8 0f             	cmp    $0xf,%eax
+  8041be:	77 12                	ja     8041d2 <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  8041c0:	8b 07                	mov    (%rdi),%eax
+  8041c2:	83 e0 0f             	and    $0xf,%eax
+  8041c5:	48 c1 e0 09          	shl    $0x9,%rax
+  8041c9:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  8041d0:	00 
+  8041d1:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  8041d2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8041d7:	c3                   	ret
+
+00000000008041d8 <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  8041d8:	8b 07                	mov    (%rdi),%eax
+  8041da:	83 c0 01             	add    $0x1,%eax
+  8041dd:	89 07                	mov    %eax,(%rdi)
+}
+  8041df:	c3                   	ret
+
+00000000008041e0 <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  8041e0:	55                   	push   %rbp
+  8041e1:	48 89 e5             	mov    %rsp,%rbp
+  8041e4:	53                   	push   %rbx
+  8041e5:	48 83 ec 08          	sub    $0x8,%rsp
+  8041e9:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  8041ec:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8041f3:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  8041f9:	48 b8 b1 41 80 00 00 	movabs $0x8041b1,%rax
+  804200:	00 00 00 
+  804203:	ff d0                	call   *%rax
+  804205:	48 85 c0             	test   %rax,%rax
+  804208:	74 12                	je     80421c <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  80420a:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  804211:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804216:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80421a:	c9                   	leave
+  80421b:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  80421c:	b8 01 00 00 00       	mov    $0x1,%eax
+  804221:	eb f3                	jmp    804216 <chan_arm+0x36>
+
+0000000000804223 <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  804223:	55                   	push   %rbp
+  804224:	48 89 e5             	mov    %rsp,%rbp
+  804227:	41 56                	push   %r14
+  804229:	41 55                	push   %r13
+  80422b:	41 54                	push   %r12
+  80422d:	53                   	push   %rbx
+  80422e:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  804231:	49 bc e0 41 80 00 00 	movabs $0x8041e0,%r12
+  804238:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  80423b:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  80423f:	49 bd f7 16 80 00 00 	movabs $0x8016f7,%r13
+  804246:	00 00 00 
+    while (chan_arm(r))
+  804249:	eb 0d                	jmp    804258 <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  80424b:	8b 33                	mov    (%rbx),%esi
+  80424d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804252:	4c 89 f7             	mov    %r14,%rdi
+  804255:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  804258:	48 89 df             	mov    %rbx,%rdi
+  80425b:	41 ff d4             	call   *%r12
+  80425e:	84 c0                	test   %al,%al
+  804260:	75 e9                	jne    80424b <chan_wait+0x28>
+}
+  804262:	5b                   	pop    %rbx
+  804263:	41 5c                	pop    %r12
+  804265:	41 5d                	pop    %r13
+  804267:	41 5e                	pop    %r14
+  804269:	5d                   	pop    %rbp
+  80426a:	c3                   	ret
+
+000000000080426b <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  80426b:	55                   	push   %rbp
+  80426c:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  80426f:	48 83 c7 40          	add    $0x40,%rdi
+  804273:	be 01 00 00 00       	mov    $0x1,%esi
+  804278:	48 b8 15 17 80 00 00 	movabs $0x801715,%rax
+  80427f:	00 00 00 
+  804282:	ff d0                	call   *%rax
+}
+  804284:	5d                   	pop    %rbp
+  804285:	c3                   	ret
+
+0000000000804286 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804286:	b8 00 00 00 00       	mov    $0x0,%eax
+  80428b:	c3                   	ret
+
+000000000080428c <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80428c:	55                   	push   %rbp
+  80428d:	48 89 e5             	mov    %rsp,%rbp
+  804290:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804293:	48 be b4 50 80 00 00 	movabs $0x8050b4,%rsi
+  80429a:	00 00 00 
+  80429d:	48 b8 2a 0e 80 00 00 	movabs $0x800e2a,%rax
+  8042a4:	00 00 00 
+  8042a7:	ff d0                	call   *%rax
+    return 0;
+}
+  8042a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042ae:	5d                   	pop    %rbp
+  8042af:	c3                   	ret
+
+00000000008042b0 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8042b0:	55                   	push   %rbp
+  8042b1:	48 89 e5             	mov    %rsp,%rbp
+  8042b4:	41 57                	push   %r15
+  8042b6:	41 56                	push   %r14
+  8042b8:	41 55                	push   %r13
+  8042ba:	41 54                	push   %r12
+  8042bc:	53                   	push   %rbx
+  8042bd:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8042c4:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8042cb:	48 85 d2             	test   %rdx,%rdx
+  8042ce:	74 7a                	je     80434a <devcons_write+0x9a>
+  8042d0:	49 89 d6             	mov    %rdx,%r14
+  8042d3:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8042d9:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8042de:	49 bf 24 10 80 00 00 	movabs $0x801024,%r15
+  8042e5:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8042e8:	4c 89 f3             	mov    %r14,%rbx
+  8042eb:	48 29 f3             	sub    %rsi,%rbx
+  8042ee:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8042f3:	48 39 c3             	cmp    %rax,%rbx
+  8042f6:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8042fa:	4c 63 eb             	movslq %ebx,%r13
+  8042fd:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804304:	48 01 c6             	add    %rax,%rsi
+  804307:	4c 89 ea             	mov    %r13,%rdx
+  80430a:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804311:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  804314:	4c 89 ee             	mov    %r13,%rsi
+  804317:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80431e:	48 b8 51 12 80 00 00 	movabs $0x801251,%rax
+  804325:	00 00 00 
+  804328:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80432a:	41 01 dc             	add    %ebx,%r12d
+  80432d:	49 63 f4             	movslq %r12d,%rsi
+  804330:	4c 39 f6             	cmp    %r14,%rsi
+  804333:	72 b3                	jb     8042e8 <devcons_write+0x38>
+    return res;
+  804335:	49 63 c4             	movslq %r12d,%rax
+}
+  804338:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80433f:	5b                   	pop    %rbx
+  804340:	41 5c                	pop    %r12
+  804342:	41 5d                	pop    %r13
+  804344:	41 5e                	pop    %r14
+  804346:	41 5f                	pop    %r15
+  804348:	5d                   	pop    %rbp
+  804349:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80434a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804350:	eb e3                	jmp    804335 <devcons_write+0x85>
+
+0000000000804352 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804352:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804355:	ba 00 00 00 00       	mov    $0x0,%edx
+  80435a:	48 85 c0             	test   %rax,%rax
+  80435d:	74 55                	je     8043b4 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80435f:	55                   	push   %rbp
+  804360:	48 89 e5             	mov    %rsp,%rbp
+  804363:	41 55                	push   %r13
+  804365:	41 54                	push   %r12
+  804367:	53                   	push   %rbx
+  804368:	48 83 ec 08          	sub    $0x8,%rsp
+  80436c:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  80436f:	48 bb 70 12 80 00 00 	movabs $0x801270,%rbx
+  804376:	00 00 00 
+  804379:	49 bc 25 13 80 00 00 	movabs $0x801325,%r12
+  804380:	00 00 00 
+  804383:	eb 03                	jmp    804388 <devcons_read+0x36>
+  804385:	41 ff d4             	call   *%r12
+  804388:	ff d3                	call   *%rbx
+  80438a:	85 c0                	test   %eax,%eax
+  80438c:	74 f7                	je     804385 <devcons_read+0x33>
+    if (c < 0) return c;
+  80438e:	48 63 d0             	movslq %eax,%rdx
+  804391:	78 13                	js     8043a6 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  804393:	ba 00 00 00 00       	mov    $0x0,%edx
+  804398:	83 f8 04             	cmp    $0x4,%eax
+  80439b:	74 09                	je     8043a6 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  80439d:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8043a1:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8043a6:	48 89 d0             	mov    %rdx,%rax
+  8043a9:	48 83 c4 08          	add    $0x8,%rsp
+  8043ad:	5b                   	pop    %rbx
+  8043ae:	41 5c                	pop    %r12
+  8043b0:	41 5d                	pop    %r13
+  8043b2:	5d                   	pop    %rbp
+  8043b3:	c3                   	ret
+  8043b4:	48 89 d0             	mov    %rdx,%rax
+  8043b7:	c3                   	ret
+
+00000000008043b8 <cputchar>:
+cputchar(int ch) {
+  8043b8:	55                   	push   %rbp
+  8043b9:	48 89 e5             	mov    %rsp,%rbp
+  8043bc:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8043c0:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8043c4:	be 01 00 00 00       	mov    $0x1,%esi
+  8043c9:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8043cd:	48 b8 51 12 80 00 00 	movabs $0x801251,%rax
+  8043d4:	00 00 00 
+  8043d7:	ff d0                	call   *%rax
+}
+  8043d9:	c9                   	leave
+  8043da:	c3                   	ret
+
+00000000008043db <getchar>:
+getchar(void) {
+  8043db:	55                   	push   %rbp
+  8043dc:	48 89 e5             	mov    %rsp,%rbp
+  8043df:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8043e3:	ba 01 00 00 00       	mov    $0x1,%edx
+  8043e8:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8043ec:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043f1:	48 b8 2d 1b 80 00 00 	movabs $0x801b2d,%rax
+  8043f8:	00 00 00 
+  8043fb:	ff d0                	call   *%rax
+  8043fd:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8043ff:	85 c0                	test   %eax,%eax
+  804401:	78 06                	js     804409 <getchar+0x2e>
+  804403:	74 08                	je     80440d <getchar+0x32>
+  804405:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804409:	89 d0                	mov    %edx,%eax
+  80440b:	c9                   	leave
+  80440c:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  80440d:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  804412:	eb f5                	jmp    804409 <getchar+0x2e>
+
+0000000000804414 <iscons>:
+iscons(int fdnum) {
+  804414:	55                   	push   %rbp
+  804415:	48 89 e5             	mov    %rsp,%rbp
+  804418:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80441c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804420:	48 b8 4a 18 80 00 00 	movabs $0x80184a,%rax
+  804427:	00 00 00 
+  80442a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80442c:	85 c0                	test   %eax,%eax
+  80442e:	78 18                	js     804448 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  804430:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804434:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  80443b:	00 00 00 
+  80443e:	8b 00                	mov    (%rax),%eax
+  804440:	39 02                	cmp    %eax,(%rdx)
+  804442:	0f 94 c0             	sete   %al
+  804445:	0f b6 c0             	movzbl %al,%eax
+}
+  804448:	c9                   	leave
+  804449:	c3                   	ret
+
+000000000080444a <opencons>:
+opencons(void) {
+  80444a:	55                   	push   %rbp
+  80444b:	48 89 e5             	mov    %rsp,%rbp
+  80444e:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  804452:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  804456:	48 b8 ea 17 80 00 00 	movabs $0x8017ea,%rax
+  80445d:	00 00 00 
+  804460:	ff d0                	call   *%rax
+  804462:	85 c0                	test   %eax,%eax
+  804464:	78 49                	js     8044af <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  804466:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80446b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804470:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  804474:	bf 00 00 00 00       	mov    $0x0,%edi
+  804479:	48 b8 89 13 80 00 00 	movabs $0x801389,%rax
+  804480:	00 00 00 
+  804483:	ff d0                	call   *%rax
+  804485:	85 c0                	test   %eax,%eax
+  804487:	78 26                	js     8044af <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  804489:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80448d:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  804494:	00 00 
+  804496:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  804498:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80449c:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8044a3:	48 b8 bc 17 80 00 00 	movabs $0x8017bc,%rax
+  8044aa:	00 00 00 
+  8044ad:	ff d0                	call   *%rax
+}
+  8044af:	c9                   	leave
+  8044b0:	c3                   	ret
+
+00000000008044b1 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8044b1:	55                   	push   %rbp
+  8044b2:	48 89 e5             	mov    %rsp,%rbp
+  8044b5:	41 56                	push   %r14
+  8044b7:	41 55                	push   %r13
+  8044b9:	41 54                	push   %r12
+  8044bb:	53                   	push   %rbx
+  8044bc:	48 83 ec 50          	sub    $0x50,%rsp
+  8044c0:	49 89 fc             	mov    %rdi,%r12
+  8044c3:	41 89 f5             	mov    %esi,%r13d
+  8044c6:	48 89 d3             	mov    %rdx,%rbx
+  8044c9:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8044cd:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8044d1:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8044d5:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8044dc:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8044e0:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8044e4:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8044e8:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8044ec:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8044f3:	00 00 00 
+  8044f6:	4c 8b 30             	mov    (%rax),%r14
+  8044f9:	48 b8 fc 12 80 00 00 	movabs $0x8012fc,%rax
+  804500:	00 00 00 
+  804503:	ff d0                	call   *%rax
+  804505:	89 c6                	mov    %eax,%esi
+  804507:	45 89 e8             	mov    %r13d,%r8d
+  80450a:	4c 89 e1             	mov    %r12,%rcx
+  80450d:	4c 89 f2             	mov    %r14,%rdx
+  804510:	48 bf c0 50 80 00 00 	movabs $0x8050c0,%rdi
+  804517:	00 00 00 
+  80451a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80451f:	49 bc 05 05 80 00 00 	movabs $0x800505,%r12
+  804526:	00 00 00 
+  804529:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80452c:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  804530:	48 89 df             	mov    %rbx,%rdi
+  804533:	48 b8 a1 04 80 00 00 	movabs $0x8004a1,%rax
+  80453a:	00 00 00 
+  80453d:	ff d0                	call   *%rax
+    cprintf("\n");
+  80453f:	48 bf 03 50 80 00 00 	movabs $0x805003,%rdi
+  804546:	00 00 00 
+  804549:	b8 00 00 00 00       	mov    $0x0,%eax
+  80454e:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  804551:	cc                   	int3
+  804552:	eb fd                	jmp    804551 <_panic+0xa0>
+
+0000000000804554 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  804554:	55                   	push   %rbp
+  804555:	48 89 e5             	mov    %rsp,%rbp
+  804558:	41 56                	push   %r14
+  80455a:	41 55                	push   %r13
+  80455c:	41 54                	push   %r12
+  80455e:	53                   	push   %rbx
+  80455f:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804562:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  804569:	00 00 00 
+  80456c:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804570:	74 27                	je     804599 <_handle_vectored_pagefault+0x45>
+  804572:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  804577:	49 bd 00 10 84 00 00 	movabs $0x841000,%r13
+  80457e:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804581:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  804584:	4c 89 e7             	mov    %r12,%rdi
+  804587:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  80458c:	84 c0                	test   %al,%al
+  80458e:	75 45                	jne    8045d5 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804590:	48 83 c3 01          	add    $0x1,%rbx
+  804594:	49 3b 1e             	cmp    (%r14),%rbx
+  804597:	72 eb                	jb     804584 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  804599:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  8045a0:	00 
+  8045a1:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  8045a6:	4d 8b 04 24          	mov    (%r12),%r8
+  8045aa:	48 ba e8 50 80 00 00 	movabs $0x8050e8,%rdx
+  8045b1:	00 00 00 
+  8045b4:	be 1d 00 00 00       	mov    $0x1d,%esi
+  8045b9:	48 bf 18 51 80 00 00 	movabs $0x805118,%rdi
+  8045c0:	00 00 00 
+  8045c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045c8:	49 ba b1 44 80 00 00 	movabs $0x8044b1,%r10
+  8045cf:	00 00 00 
+  8045d2:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  8045d5:	5b                   	pop    %rbx
+  8045d6:	41 5c                	pop    %r12
+  8045d8:	41 5d                	pop    %r13
+  8045da:	41 5e                	pop    %r14
+  8045dc:	5d                   	pop    %rbp
+  8045dd:	c3                   	ret
+
+00000000008045de <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  8045de:	55                   	push   %rbp
+  8045df:	48 89 e5             	mov    %rsp,%rbp
+  8045e2:	53                   	push   %rbx
+  8045e3:	48 83 ec 08          	sub    $0x8,%rsp
+  8045e7:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  8045ea:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8045f1:	00 00 00 
+  8045f4:	80 38 00             	cmpb   $0x0,(%rax)
+  8045f7:	0f 84 84 00 00 00    	je     804681 <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8045fd:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  804604:	00 00 00 
+  804607:	48 8b 10             	mov    (%rax),%rdx
+  80460a:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  80460f:	48 b9 00 10 84 00 00 	movabs $0x841000,%rcx
+  804616:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804619:	48 85 d2             	test   %rdx,%rdx
+  80461c:	74 19                	je     804637 <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  80461e:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  804622:	0f 84 e8 00 00 00    	je     804710 <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804628:	48 83 c0 01          	add    $0x1,%rax
+  80462c:	48 39 d0             	cmp    %rdx,%rax
+  80462f:	75 ed                	jne    80461e <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  804631:	48 83 fa 08          	cmp    $0x8,%rdx
+  804635:	74 1c                	je     804653 <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  804637:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80463b:	48 a3 48 10 84 00 00 	movabs %rax,0x841048
+  804642:	00 00 00 
+  804645:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  80464c:	00 00 00 
+  80464f:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  804653:	48 b8 fc 12 80 00 00 	movabs $0x8012fc,%rax
+  80465a:	00 00 00 
+  80465d:	ff d0                	call   *%rax
+  80465f:	89 c7                	mov    %eax,%edi
+  804661:	48 be d6 47 80 00 00 	movabs $0x8047d6,%rsi
+  804668:	00 00 00 
+  80466b:	48 b8 47 15 80 00 00 	movabs $0x801547,%rax
+  804672:	00 00 00 
+  804675:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  804677:	85 c0                	test   %eax,%eax
+  804679:	78 68                	js     8046e3 <add_pgfault_handler+0x105>
+    return res;
+}
+  80467b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80467f:	c9                   	leave
+  804680:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  804681:	48 b8 fc 12 80 00 00 	movabs $0x8012fc,%rax
+  804688:	00 00 00 
+  80468b:	ff d0                	call   *%rax
+  80468d:	89 c7                	mov    %eax,%edi
+  80468f:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804694:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804699:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  8046a0:	00 00 00 
+  8046a3:	48 b8 89 13 80 00 00 	movabs $0x801389,%rax
+  8046aa:	00 00 00 
+  8046ad:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8046af:	48 ba 48 10 84 00 00 	movabs $0x841048,%rdx
+  8046b6:	00 00 00 
+  8046b9:	48 8b 02             	mov    (%rdx),%rax
+  8046bc:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8046c0:	48 89 0a             	mov    %rcx,(%rdx)
+  8046c3:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  8046ca:	00 00 00 
+  8046cd:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  8046d1:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8046d8:	00 00 00 
+  8046db:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  8046de:	e9 70 ff ff ff       	jmp    804653 <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8046e3:	89 c1                	mov    %eax,%ecx
+  8046e5:	48 ba 26 51 80 00 00 	movabs $0x805126,%rdx
+  8046ec:	00 00 00 
+  8046ef:	be 3d 00 00 00       	mov    $0x3d,%esi
+  8046f4:	48 bf 18 51 80 00 00 	movabs $0x805118,%rdi
+  8046fb:	00 00 00 
+  8046fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  804703:	49 b8 b1 44 80 00 00 	movabs $0x8044b1,%r8
+  80470a:	00 00 00 
+  80470d:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  804710:	b8 00 00 00 00       	mov    $0x0,%eax
+  804715:	e9 61 ff ff ff       	jmp    80467b <add_pgfault_handler+0x9d>
+
+000000000080471a <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  80471a:	55                   	push   %rbp
+  80471b:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  80471e:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  804725:	00 00 00 
+  804728:	80 38 00             	cmpb   $0x0,(%rax)
+  80472b:	74 33                	je     804760 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80472d:	48 a1 48 10 84 00 00 	movabs 0x841048,%rax
+  804734:	00 00 00 
+  804737:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  80473c:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  804743:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804746:	48 85 c0             	test   %rax,%rax
+  804749:	0f 84 85 00 00 00    	je     8047d4 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  80474f:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  804753:	74 40                	je     804795 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804755:	48 83 c1 01          	add    $0x1,%rcx
+  804759:	48 39 c1             	cmp    %rax,%rcx
+  80475c:	75 f1                	jne    80474f <remove_pgfault_handler+0x35>
+  80475e:	eb 74                	jmp    8047d4 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  804760:	48 b9 3e 51 80 00 00 	movabs $0x80513e,%rcx
+  804767:	00 00 00 
+  80476a:	48 ba 67 50 80 00 00 	movabs $0x805067,%rdx
+  804771:	00 00 00 
+  804774:	be 43 00 00 00       	mov    $0x43,%esi
+  804779:	48 bf 18 51 80 00 00 	movabs $0x805118,%rdi
+  804780:	00 00 00 
+  804783:	b8 00 00 00 00       	mov    $0x0,%eax
+  804788:	49 b8 b1 44 80 00 00 	movabs $0x8044b1,%r8
+  80478f:	00 00 00 
+  804792:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  804795:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  80479c:	00 
+  80479d:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8047a1:	48 29 ca             	sub    %rcx,%rdx
+  8047a4:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  8047ab:	00 00 00 
+  8047ae:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  8047b2:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  8047b7:	48 89 ce             	mov    %rcx,%rsi
+  8047ba:	48 b8 24 10 80 00 00 	movabs $0x801024,%rax
+  8047c1:	00 00 00 
+  8047c4:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  8047c6:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  8047cd:	00 00 00 
+  8047d0:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  8047d4:	5d                   	pop    %rbp
+  8047d5:	c3                   	ret
+
+00000000008047d6 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  8047d6:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  8047d9:	48 b8 54 45 80 00 00 	movabs $0x804554,%rax
+  8047e0:	00 00 00 
+    call *%rax
+  8047e3:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  8047e5:	41 5f                	pop    %r15
+	popq %r15
+  8047e7:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  8047e9:	41 5f                	pop    %r15
+	popq %r14
+  8047eb:	41 5e                	pop    %r14
+	popq %r13
+  8047ed:	41 5d                	pop    %r13
+	popq %r12
+  8047ef:	41 5c                	pop    %r12
+	popq %r11
+  8047f1:	41 5b                	pop    %r11
+	popq %r10
+  8047f3:	41 5a                	pop    %r10
+	popq %r9
+  8047f5:	41 59                	pop    %r9
+	popq %r8
+  8047f7:	41 58                	pop    %r8
+	popq %rsi
+  8047f9:	5e                   	pop    %rsi
+	popq %rdi
+  8047fa:	5f                   	pop    %rdi
+	popq %rbp
+  8047fb:	5d                   	pop    %rbp
+	popq %rdx
+  8047fc:	5a                   	pop    %rdx
+	popq %rcx
+  8047fd:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  8047fe:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  804803:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  804808:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  80480c:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  80480f:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  804814:	5b                   	pop    %rbx
+	popq %rax
+  804815:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  804816:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  80481a:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  80481b:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  804820:	c3                   	ret
+
+0000000000804821 <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  804821:	55                   	push   %rbp
+  804822:	48 89 e5             	mov    %rsp,%rbp
+  804825:	41 55                	push   %r13
+  804827:	41 54                	push   %r12
+  804829:	53                   	push   %rbx
+  80482a:	48 83 ec 08          	sub    $0x8,%rsp
+  80482e:	49 89 fd             	mov    %rdi,%r13
+  804831:	48 89 f7             	mov    %rsi,%rdi
+  804834:	48 89 d3             	mov    %rdx,%rbx
+  804837:	49 89 cc             	mov    %rcx,%r12
+  80483a:	4c 89 c2             	mov    %r8,%rdx
+  80483d:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804840:	48 85 f6             	test   %rsi,%rsi
+  804843:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80484a:	00 00 00 
+  80484d:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  804851:	be 00 10 00 00       	mov    $0x1000,%esi
+  804856:	48 85 db             	test   %rbx,%rbx
+  804859:	74 03                	je     80485e <ipc_recv_futex+0x3d>
+  80485b:	48 8b 33             	mov    (%rbx),%rsi
+  80485e:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  804862:	48 b8 d3 15 80 00 00 	movabs $0x8015d3,%rax
+  804869:	00 00 00 
+  80486c:	ff d0                	call   *%rax
+    if (res < 0) {
+  80486e:	85 c0                	test   %eax,%eax
+  804870:	78 75                	js     8048e7 <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  804872:	4d 85 ed             	test   %r13,%r13
+  804875:	74 14                	je     80488b <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  804877:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80487e:	00 00 00 
+  804881:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  804887:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  80488b:	4d 85 e4             	test   %r12,%r12
+  80488e:	74 14                	je     8048a4 <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  804890:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804897:	00 00 00 
+  80489a:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  8048a0:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  8048a4:	48 85 db             	test   %rbx,%rbx
+  8048a7:	74 23                	je     8048cc <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8048a9:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8048b0:	00 00 00 
+  8048b3:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  8048b9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8048be:	85 c9                	test   %ecx,%ecx
+  8048c0:	74 07                	je     8048c9 <ipc_recv_futex+0xa8>
+  8048c2:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  8048c9:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  8048cc:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8048d3:	00 00 00 
+  8048d6:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  8048dc:	48 83 c4 08          	add    $0x8,%rsp
+  8048e0:	5b                   	pop    %rbx
+  8048e1:	41 5c                	pop    %r12
+  8048e3:	41 5d                	pop    %r13
+  8048e5:	5d                   	pop    %rbp
+  8048e6:	c3                   	ret
+        if (from_env_store != NULL) {
+  8048e7:	4d 85 ed             	test   %r13,%r13
+  8048ea:	74 08                	je     8048f4 <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  8048ec:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8048f3:	00 
+        if (perm_store != NULL) {
+  8048f4:	4d 85 e4             	test   %r12,%r12
+  8048f7:	74 08                	je     804901 <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  8048f9:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804900:	00 
+        if (size != NULL) {
+  804901:	48 85 db             	test   %rbx,%rbx
+  804904:	74 d6                	je     8048dc <ipc_recv_futex+0xbb>
+            *size = 0;
+  804906:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  80490d:	eb cd                	jmp    8048dc <ipc_recv_futex+0xbb>
+
+000000000080490f <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80490f:	55                   	push   %rbp
+  804910:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  804913:	48 83 ec 08          	sub    $0x8,%rsp
+  804917:	6a 00                	push   $0x0
+  804919:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80491f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804925:	48 b8 21 48 80 00 00 	movabs $0x804821,%rax
+  80492c:	00 00 00 
+  80492f:	ff d0                	call   *%rax
+}
+  804931:	c9                   	leave
+  804932:	c3                   	ret
+
+0000000000804933 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  804933:	55                   	push   %rbp
+  804934:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804937:	48 85 d2             	test   %rdx,%rdx
+  80493a:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804941:	00 00 00 
+  804944:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  804948:	89 f6                	mov    %esi,%esi
+  80494a:	48 b8 bc 15 80 00 00 	movabs $0x8015bc,%rax
+  804951:	00 00 00 
+  804954:	ff d0                	call   *%rax
+    if (res < 0) {
+  804956:	85 c0                	test   %eax,%eax
+  804958:	78 02                	js     80495c <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  80495a:	5d                   	pop    %rbp
+  80495b:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  80495c:	89 c1                	mov    %eax,%ecx
+  80495e:	48 ba 58 51 80 00 00 	movabs $0x805158,%rdx
+  804965:	00 00 00 
+  804968:	be 50 00 00 00       	mov    $0x50,%esi
+  80496d:	48 bf 6c 51 80 00 00 	movabs $0x80516c,%rdi
+  804974:	00 00 00 
+  804977:	b8 00 00 00 00       	mov    $0x0,%eax
+  80497c:	49 b8 b1 44 80 00 00 	movabs $0x8044b1,%r8
+  804983:	00 00 00 
+  804986:	41 ff d0             	call   *%r8
+
+0000000000804989 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804989:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  80498e:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804995:	00 00 00 
+  804998:	48 89 d0             	mov    %rdx,%rax
+  80499b:	48 c1 e0 04          	shl    $0x4,%rax
+  80499f:	48 29 d0             	sub    %rdx,%rax
+  8049a2:	48 c1 e0 05          	shl    $0x5,%rax
+  8049a6:	48 01 c8             	add    %rcx,%rax
+  8049a9:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  8049af:	39 f8                	cmp    %edi,%eax
+  8049b1:	74 13                	je     8049c6 <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  8049b3:	48 83 c2 01          	add    $0x1,%rdx
+  8049b7:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  8049be:	75 d8                	jne    804998 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8049c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8049c5:	c3                   	ret
+            return envs[i].env_id;
+  8049c6:	48 89 d0             	mov    %rdx,%rax
+  8049c9:	48 c1 e0 04          	shl    $0x4,%rax
+  8049cd:	48 29 d0             	sub    %rdx,%rax
+  8049d0:	48 c1 e0 05          	shl    $0x5,%rax
+  8049d4:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8049db:	00 00 00 
+  8049de:	48 01 d0             	add    %rdx,%rax
+  8049e1:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8049e7:	c3                   	ret
+
+00000000008049e8 <__rodata_start>:
+  8049e8:	25 30 34 64 2d       	and    $0x2d643430,%eax
+  8049ed:	25 30 32 64 2d       	and    $0x2d643230,%eax
+  8049f2:	25 30 32 64 20       	and    $0x20643230,%eax
+  8049f7:	25 30 32 64 3a       	and    $0x3a643230,%eax
+  8049fc:	25 30 32 64 3a       	and    $0x3a643230,%eax
+  804a01:	25 30 32 64 00       	and    $0x643230,%eax
+  804a06:	56                   	push   %rsi
+  804a07:	44                   	rex.R
+  804a08:	41 54                	push   %r12
+  804a0a:	45 3a 20             	cmp    (%r8),%r12b
+  804a0d:	25 73 0a 00 3c       	and    $0x3c000a73,%eax
+  804a12:	75 6e                	jne    804a82 <__rodata_start+0x9a>
+  804a14:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  804a18:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a19:	3e 00 30             	ds add %dh,(%rax)
+  804a1c:	31 32                	xor    %esi,(%rdx)
+  804a1e:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  804a25:	41                   	rex.B
+  804a26:	42                   	rex.X
+  804a27:	43                   	rex.XB
+  804a28:	44                   	rex.R
+  804a29:	45                   	rex.RB
+  804a2a:	46 00 30             	rex.RX add %r14b,(%rax)
+  804a2d:	31 32                	xor    %esi,(%rdx)
+  804a2f:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  804a36:	61                   	(bad)
+  804a37:	62 63 64 65 66       	(bad)
+  804a3c:	00 28                	add    %ch,(%rax)
+  804a3e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a3f:	75 6c                	jne    804aad <__rodata_start+0xc5>
+  804a41:	6c                   	insb   (%dx),%es:(%rdi)
+  804a42:	29 00                	sub    %eax,(%rax)
+  804a44:	65 72 72             	gs jb  804ab9 <__rodata_start+0xd1>
+  804a47:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a48:	72 20                	jb     804a6a <__rodata_start+0x82>
+  804a4a:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  804a4f:	73 70                	jae    804ac1 <__rodata_start+0xd9>
+  804a51:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  804a55:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  804a5c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a5d:	72 00                	jb     804a5f <__rodata_start+0x77>
+  804a5f:	62 61 64 20 65       	(bad)
+  804a64:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a65:	76 69                	jbe    804ad0 <__rodata_start+0xe8>
+  804a67:	72 6f                	jb     804ad8 <__rodata_start+0xf0>
+  804a69:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a6a:	6d                   	insl   (%dx),%es:(%rdi)
+  804a6b:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804a6d:	74 00                	je     804a6f <__rodata_start+0x87>
+  804a6f:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  804a76:	20 70 61             	and    %dh,0x61(%rax)
+  804a79:	72 61                	jb     804adc <__rodata_start+0xf4>
+  804a7b:	6d                   	insl   (%dx),%es:(%rdi)
+  804a7c:	65 74 65             	gs je  804ae4 <__rodata_start+0xfc>
+  804a7f:	72 00                	jb     804a81 <__rodata_start+0x99>
+  804a81:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a82:	75 74                	jne    804af8 <__rodata_start+0x110>
+  804a84:	20 6f 66             	and    %ch,0x66(%rdi)
+  804a87:	20 6d 65             	and    %ch,0x65(%rbp)
+  804a8a:	6d                   	insl   (%dx),%es:(%rdi)
+  804a8b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a8c:	72 79                	jb     804b07 <__rodata_start+0x11f>
+  804a8e:	00 6f 75             	add    %ch,0x75(%rdi)
+  804a91:	74 20                	je     804ab3 <__rodata_start+0xcb>
+  804a93:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a94:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  804a98:	76 69                	jbe    804b03 <__rodata_start+0x11b>
+  804a9a:	72 6f                	jb     804b0b <__rodata_start+0x123>
+  804a9c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a9d:	6d                   	insl   (%dx),%es:(%rdi)
+  804a9e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804aa0:	74 73                	je     804b15 <__rodata_start+0x12d>
+  804aa2:	00 63 6f             	add    %ah,0x6f(%rbx)
+  804aa5:	72 72                	jb     804b19 <__rodata_start+0x131>
+  804aa7:	75 70                	jne    804b19 <__rodata_start+0x131>
+  804aa9:	74 65                	je     804b10 <__rodata_start+0x128>
+  804aab:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  804ab0:	75 67                	jne    804b19 <__rodata_start+0x131>
+  804ab2:	20 69 6e             	and    %ch,0x6e(%rcx)
+  804ab5:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804ab7:	00 73 65             	add    %dh,0x65(%rbx)
+  804aba:	67 6d                	insl   (%dx),%es:(%edi)
+  804abc:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804abe:	74 61                	je     804b21 <__rodata_start+0x139>
+  804ac0:	74 69                	je     804b2b <__rodata_start+0x143>
+  804ac2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804ac3:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804ac4:	20 66 61             	and    %ah,0x61(%rsi)
+  804ac7:	75 6c                	jne    804b35 <__rodata_start+0x14d>
+  804ac9:	74 00                	je     804acb <__rodata_start+0xe3>
+  804acb:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  804ad2:	20 45 4c             	and    %al,0x4c(%rbp)
+  804ad5:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  804ad9:	61                   	(bad)
+  804ada:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  804adf:	20 73 75             	and    %dh,0x75(%rbx)
+  804ae2:	63 68 20             	movsxd 0x20(%rax),%ebp
+  804ae5:	73 79                	jae    804b60 <__rodata_start+0x178>
+  804ae7:	73 74                	jae    804b5d <__rodata_start+0x175>
+  804ae9:	65 6d                	gs insl (%dx),%es:(%rdi)
+  804aeb:	20 63 61             	and    %ah,0x61(%rbx)
+  804aee:	6c                   	insb   (%dx),%es:(%rdi)
+  804aef:	6c                   	insb   (%dx),%es:(%rdi)
+  804af0:	00 65 6e             	add    %ah,0x6e(%rbp)
+  804af3:	74 72                	je     804b67 <__rodata_start+0x17f>
+  804af5:	79 20                	jns    804b17 <__rodata_start+0x12f>
+  804af7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804af8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804af9:	74 20                	je     804b1b <__rodata_start+0x133>
+  804afb:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804afd:	75 6e                	jne    804b6d <__rodata_start+0x185>
+  804aff:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  804b03:	76 20                	jbe    804b25 <__rodata_start+0x13d>
+  804b05:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  804b0c:	72 65                	jb     804b73 <__rodata_start+0x18b>
+  804b0e:	63 76 69             	movsxd 0x69(%rsi),%esi
+  804b11:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804b12:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  804b16:	65 78 70             	gs js  804b89 <__rodata_start+0x1a1>
+  804b19:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  804b1e:	20 65 6e             	and    %ah,0x6e(%rbp)
+  804b21:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  804b25:	20 66 69             	and    %ah,0x69(%rsi)
+  804b28:	6c                   	insb   (%dx),%es:(%rdi)
+  804b29:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  804b2d:	20 66 72             	and    %ah,0x72(%rsi)
+  804b30:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  804b35:	61                   	(bad)
+  804b36:	63 65 20             	movsxd 0x20(%rbp),%esp
+  804b39:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b3a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804b3b:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  804b3f:	6b 00 74             	imul   $0x74,(%rax),%eax
+  804b42:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b43:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b44:	20 6d 61             	and    %ch,0x61(%rbp)
+  804b47:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804b48:	79 20                	jns    804b6a <__rodata_start+0x182>
+  804b4a:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  804b51:	72 65                	jb     804bb8 <__rodata_start+0x1d0>
+  804b53:	20 6f 70             	and    %ch,0x70(%rdi)
+  804b56:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804b58:	00 66 69             	add    %ah,0x69(%rsi)
+  804b5b:	6c                   	insb   (%dx),%es:(%rdi)
+  804b5c:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  804b60:	20 62 6c             	and    %ah,0x6c(%rdx)
+  804b63:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b64:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  804b67:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804b68:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b69:	74 20                	je     804b8b <__rodata_start+0x1a3>
+  804b6b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804b6d:	75 6e                	jne    804bdd <__rodata_start+0x1f5>
+  804b6f:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  804b73:	76 61                	jbe    804bd6 <__rodata_start+0x1ee>
+  804b75:	6c                   	insb   (%dx),%es:(%rdi)
+  804b76:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  804b7d:	00 
+  804b7e:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  804b85:	72 65                	jb     804bec <__rodata_start+0x204>
+  804b87:	61                   	(bad)
+  804b88:	64 79 20             	fs jns 804bab <__rodata_start+0x1c3>
+  804b8b:	65 78 69             	gs js  804bf7 <__rodata_start+0x20f>
+  804b8e:	73 74                	jae    804c04 <__rodata_start+0x21c>
+  804b90:	73 00                	jae    804b92 <__rodata_start+0x1aa>
+  804b92:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b93:	70 65                	jo     804bfa <__rodata_start+0x212>
+  804b95:	72 61                	jb     804bf8 <__rodata_start+0x210>
+  804b97:	74 69                	je     804c02 <__rodata_start+0x21a>
+  804b99:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b9a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804b9b:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  804b9e:	74 20                	je     804bc0 <__rodata_start+0x1d8>
+  804ba0:	73 75                	jae    804c17 <__rodata_start+0x22f>
+  804ba2:	70 70                	jo     804c14 <__rodata_start+0x22c>
+  804ba4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804ba5:	72 74                	jb     804c1b <__rodata_start+0x233>
+  804ba7:	65 64 00 74 72 79    	gs add %dh,%fs:0x79(%rdx,%rsi,2)
+  804bad:	20 61 67             	and    %ah,0x67(%rcx)
+  804bb0:	61                   	(bad)
+  804bb1:	69 6e 00 74 69 6d 65 	imul   $0x656d6974,0x0(%rsi),%ebp
+  804bb8:	64 20 6f 75          	and    %ch,%fs:0x75(%rdi)
+  804bbc:	74 00                	je     804bbe <__rodata_start+0x1d6>
+  804bbe:	66 69 6c 65 20 69 73 	imul   $0x7369,0x20(%rbp,%riz,2),%bp
+  804bc5:	20 69 6e             	and    %ch,0x6e(%rcx)
+  804bc8:	20 75 73             	and    %dh,0x73(%rbp)
+  804bcb:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  804bcf:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  804bd6:	00 
+  804bd7:	66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+  804bde:	00 00 
+  804be0:	f2 06                	repnz (bad)
+  804be2:	80 00 00             	addb   $0x0,(%rax)
+  804be5:	00 00                	add    %al,(%rax)
+  804be7:	00 33                	add    %dh,(%rbx)
+  804be9:	0d 80 00 00 00       	or     $0x80,%eax
+  804bee:	00 00                	add    %al,(%rax)
+  804bf0:	23 0d 80 00 00 00    	and    0x80(%rip),%ecx        # 804c76 <__rodata_start+0x28e>
+  804bf6:	00 00                	add    %al,(%rax)
+  804bf8:	33 0d 80 00 00 00    	xor    0x80(%rip),%ecx        # 804c7e <__rodata_start+0x296>
+  804bfe:	00 00                	add    %al,(%rax)
+  804c00:	33 0d 80 00 00 00    	xor    0x80(%rip),%ecx        # 804c86 <__rodata_start+0x29e>
+  804c06:	00 00                	add    %al,(%rax)
+  804c08:	33 0d 80 00 00 00    	xor    0x80(%rip),%ecx        # 804c8e <__rodata_start+0x2a6>
+  804c0e:	00 00                	add    %al,(%rax)
+  804c10:	33 0d 80 00 00 00    	xor    0x80(%rip),%ecx        # 804c96 <__rodata_start+0x2ae>
+  804c16:	00 00                	add    %al,(%rax)
+  804c18:	11 07                	adc    %eax,(%rdi)
+  804c1a:	80 00 00             	addb   $0x0,(%rax)
+  804c1d:	00 00                	add    %al,(%rax)
+  804c1f:	00 33                	add    %dh,(%rbx)
+  804c21:	0d 80 00 00 00       	or     $0x80,%eax
+  804c26:	00 00                	add    %al,(%rax)
+  804c28:	33 0d 80 00 00 00    	xor    0x80(%rip),%ecx        # 804cae <__rodata_start+0x2c6>
+  804c2e:	00 00                	add    %al,(%rax)
+  804c30:	05 07 80 00 00       	add    $0x8007,%eax
+  804c35:	00 00                	add    %al,(%rax)
+  804c37:	00 7f 07             	add    %bh,0x7(%rdi)
+  804c3a:	80 00 00             	addb   $0x0,(%rax)
+  804c3d:	00 00                	add    %al,(%rax)
+  804c3f:	00 33                	add    %dh,(%rbx)
+  804c41:	0d 80 00 00 00       	or     $0x80,%eax
+  804c46:	00 00                	add    %al,(%rax)
+  804c48:	05 07 80 00 00       	add    $0x8007,%eax
+  804c4d:	00 00                	add    %al,(%rax)
+  804c4f:	00 4b 07             	add    %cl,0x7(%rbx)
+  804c52:	80 00 00             	addb   $0x0,(%rax)
+  804c55:	00 00                	add    %al,(%rax)
+  804c57:	00 4b 07             	add    %cl,0x7(%rbx)
+  804c5a:	80 00 00             	addb   $0x0,(%rax)
+  804c5d:	00 00                	add    %al,(%rax)
+  804c5f:	00 4b 07             	add    %cl,0x7(%rbx)
+  804c62:	80 00 00             	addb   $0x0,(%rax)
+  804c65:	00 00                	add    %al,(%rax)
+  804c67:	00 4b 07             	add    %cl,0x7(%rbx)
+  804c6a:	80 00 00             	addb   $0x0,(%rax)
+  804c6d:	00 00                	add    %al,(%rax)
+  804c6f:	00 4b 07             	add    %cl,0x7(%rbx)
+  804c72:	80 00 00             	addb   $0x0,(%rax)
+  804c75:	00 00                	add    %al,(%rax)
+  804c77:	00 4b 07             	add    %cl,0x7(%rbx)
+  804c7a:	80 00 00             	addb   $0x0,(%rax)
+  804c7d:	00 00                	add    %al,(%rax)
+  804c7f:	00 4b 07             	add    %cl,0x7(%rbx)
+  804c82:	80 00 00             	addb   $0x0,(%rax)
+  804c85:	00 00                	add    %al,(%rax)
+  804c87:	00 4b 07             	add    %cl,0x7(%rbx)
+  804c8a:	80 00 00             	addb   $0x0,(%rax)
+  804c8d:	00 00                	add    %al,(%rax)
+  804c8f:	00 4b 07             	add    %cl,0x7(%rbx)
+  804c92:	80 00 00             	addb   $0x0,(%rax)
+  804c95:	00 00                	add    %al,(%rax)
+  804c97:	00 33                	add    %dh,(%rbx)
+  804c99:	0d 80 00 00 00       	or     $0x80,%eax
+  804c9e:	00 00                	add    %al,(%rax)
+  804ca0:	33 0d 80 00 00 00    	xor    0x80(%rip),%ecx        # 804d26 <__rodata_start+0x33e>
+  804ca6:	00 00                	add    %al,(%rax)
+  804ca8:	33 0d 80 00 00 00    	xor    0x80(%rip),%ecx        # 804d2e <__rodata_start+0x346>
+  804cae:	00 00                	add    %al,(%rax)
+  804cb0:	33 0d 80 00 00 00    	xor    0x80(%rip),%ecx        # 804d36 <__rodata_start+0x34e>
+  804cb6:	00 00                	add    %al,(%rax)
+  804cb8:	33 0d 80 00 00 00    	xor    0x80(%rip),%ecx        # 804d3e <__rodata_start+0x356>
+  804cbe:	00 00                	add    %al,(%rax)
+  804cc0:	33 0d 80 00 00 00    	xor    0x80(%rip),%ecx        # 804d46 <__rodata_start+0x35e>
+  804cc6:	00 00                	add    %al,(%rax)
+  804cc8:	33 0d 80 00 00 00    	xor    0x80(%rip),%ecx        # 804d4e <__rodata_start+0x366>
+  804cce:	00 00                	add    %al,(%rax)
+  804cd0:	33 0d 80 00 00 00    	xor    0x80(%rip),%ecx        # 804d56 <__rodata_start+0x36e>
+  804cd6:	00 00                	add    %al,(%rax)
+  804cd8:	33 0d 80 00 00 00    	xor    0x80(%rip),%ecx        # 804d5e <__rodata_start+0x376>
+  804cde:	00 00                	add    %al,(%rax)
+  804ce0:	33 0d 80 00 00 00    	xor    0x80(%rip),%ecx        # 804d66 <__rodata_start+0x37e>
+  804ce6:	00 00                	add    %al,(%rax)
+  804ce8:	33 0d 80 00 00 00    	xor    0x80(%rip),%ecx        # 804d6e <__rodata_start+0x386>
+  804cee:	00 00                	add    %al,(%rax)
+  804cf0:	33 0d 80 00 00 00    	xor    0x80(%rip),%ecx        # 804d76 <__rodata_start+0x38e>
+  804cf6:	00 00                	add    %al,(%rax)
+  804cf8:	33 0d 80 00 00 00    	xor    0x80(%rip),%ecx        # 804d7e <__rodata_start+0x396>
+  804cfe:	00 00                	add    %al,(%rax)
+  804d00:	33 0d 80 00 00 00    	xor    0x80(%rip),%ecx        # 804d86 <__rodata_start+0x39e>
+  804d06:	00 00                	add    %al,(%rax)
+  804d08:	33 0d 80 00 00 00    	xor    0x80(%rip),%ecx        # 804d8e <__rodata_start+0x3a6>
+  804d0e:	00 00                	add    %al,(%rax)
+  804d10:	33 0d 80 00 00 00    	xor    0x80(%rip),%ecx        # 804d96 <__rodata_start+0x3ae>
+  804d16:	00 00                	add    %al,(%rax)
+  804d18:	33 0d 80 00 00 00    	xor    0x80(%rip),%ecx        # 804d9e <__rodata_start+0x3b6>
+  804d1e:	00 00                	add    %al,(%rax)
+  804d20:	33 0d 80 00 00 00    	xor    0x80(%rip),%ecx        # 804da6 <__rodata_start+0x3be>
+  804d26:	00 00                	add    %al,(%rax)
+  804d28:	33 0d 80 00 00 00    	xor    0x80(%rip),%ecx        # 804dae <__rodata_start+0x3c6>
+  804d2e:	00 00                	add    %al,(%rax)
+  804d30:	33 0d 80 00 00 00    	xor    0x80(%rip),%ecx        # 804db6 <__rodata_start+0x3ce>
+  804d36:	00 00                	add    %al,(%rax)
+  804d38:	33 0d 80 00 00 00    	xor    0x80(%rip),%ecx        # 804dbe <__rodata_start+0x3d6>
+  804d3e:	00 00                	add    %al,(%rax)
+  804d40:	33 0d 80 00 00 00    	xor    0x80(%rip),%ecx        # 804dc6 <__rodata_start+0x3de>
+  804d46:	00 00                	add    %al,(%rax)
+  804d48:	33 0d 80 00 00 00    	xor    0x80(%rip),%ecx        # 804dce <__rodata_start+0x3e6>
+  804d4e:	00 00                	add    %al,(%rax)
+  804d50:	33 0d 80 00 00 00    	xor    0x80(%rip),%ecx        # 804dd6 <__rodata_start+0x3ee>
+  804d56:	00 00                	add    %al,(%rax)
+  804d58:	33 0d 80 00 00 00    	xor    0x80(%rip),%ecx        # 804dde <__rodata_start+0x3f6>
+  804d5e:	00 00                	add    %al,(%rax)
+  804d60:	33 0d 80 00 00 00    	xor    0x80(%rip),%ecx        # 804de6 <__rodata_start+0x3fe>
+  804d66:	00 00                	add    %al,(%rax)
+  804d68:	33 0d 80 00 00 00    	xor    0x80(%rip),%ecx        # 804dee <__rodata_start+0x406>
+  804d6e:	00 00                	add    %al,(%rax)
+  804d70:	33 0d 80 00 00 00    	xor    0x80(%rip),%ecx        # 804df6 <__rodata_start+0x40e>
+  804d76:	00 00                	add    %al,(%rax)
+  804d78:	33 0d 80 00 00 00    	xor    0x80(%rip),%ecx        # 804dfe <__rodata_start+0x416>
+  804d7e:	00 00                	add    %al,(%rax)
+  804d80:	33 0d 80 00 00 00    	xor    0x80(%rip),%ecx        # 804e06 <__rodata_start+0x41e>
+  804d86:	00 00                	add    %al,(%rax)
+  804d88:	56                   	push   %rsi
+  804d89:	0c 80                	or     $0x80,%al
+  804d8b:	00 00                	add    %al,(%rax)
+  804d8d:	00 00                	add    %al,(%rax)
+  804d8f:	00 33                	add    %dh,(%rbx)
+  804d91:	0d 80 00 00 00       	or     $0x80,%eax
+  804d96:	00 00                	add    %al,(%rax)
+  804d98:	33 0d 80 00 00 00    	xor    0x80(%rip),%ecx        # 804e1e <__rodata_start+0x436>
+  804d9e:	00 00                	add    %al,(%rax)
+  804da0:	33 0d 80 00 00 00    	xor    0x80(%rip),%ecx        # 804e26 <__rodata_start+0x43e>
+  804da6:	00 00                	add    %al,(%rax)
+  804da8:	33 0d 80 00 00 00    	xor    0x80(%rip),%ecx        # 804e2e <__rodata_start+0x446>
+  804dae:	00 00                	add    %al,(%rax)
+  804db0:	33 0d 80 00 00 00    	xor    0x80(%rip),%ecx        # 804e36 <__rodata_start+0x44e>
+  804db6:	00 00                	add    %al,(%rax)
+  804db8:	33 0d 80 00 00 00    	xor    0x80(%rip),%ecx        # 804e3e <__rodata_start+0x456>
+  804dbe:	00 00                	add    %al,(%rax)
+  804dc0:	33 0d 80 00 00 00    	xor    0x80(%rip),%ecx        # 804e46 <__rodata_start+0x45e>
+  804dc6:	00 00                	add    %al,(%rax)
+  804dc8:	33 0d 80 00 00 00    	xor    0x80(%rip),%ecx        # 804e4e <__rodata_start+0x466>
+  804dce:	00 00                	add    %al,(%rax)
+  804dd0:	33 0d 80 00 00 00    	xor    0x80(%rip),%ecx        # 804e56 <__rodata_start+0x46e>
+  804dd6:	00 00                	add    %al,(%rax)
+  804dd8:	33 0d 80 00 00 00    	xor    0x80(%rip),%ecx        # 804e5e <__rodata_start+0x476>
+  804dde:	00 00                	add    %al,(%rax)
+  804de0:	a2 07 80 00 00 00 00 	movabs %al,0x7100000000008007
+  804de7:	00 71 
+  804de9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804def:	00 33                	add    %dh,(%rbx)
+  804df1:	0d 80 00 00 00       	or     $0x80,%eax
+  804df6:	00 00                	add    %al,(%rax)
+  804df8:	33 0d 80 00 00 00    	xor    0x80(%rip),%ecx        # 804e7e <__rodata_start+0x496>
+  804dfe:	00 00                	add    %al,(%rax)
+  804e00:	33 0d 80 00 00 00    	xor    0x80(%rip),%ecx        # 804e86 <__rodata_start+0x49e>
+  804e06:	00 00                	add    %al,(%rax)
+  804e08:	33 0d 80 00 00 00    	xor    0x80(%rip),%ecx        # 804e8e <__rodata_start+0x4a6>
+  804e0e:	00 00                	add    %al,(%rax)
+  804e10:	d1 07                	roll   (%rdi)
+  804e12:	80 00 00             	addb   $0x0,(%rax)
+  804e15:	00 00                	add    %al,(%rax)
+  804e17:	00 33                	add    %dh,(%rbx)
+  804e19:	0d 80 00 00 00       	or     $0x80,%eax
+  804e1e:	00 00                	add    %al,(%rax)
+  804e20:	33 0d 80 00 00 00    	xor    0x80(%rip),%ecx        # 804ea6 <error_string+0x6>
+  804e26:	00 00                	add    %al,(%rax)
+  804e28:	97                   	xchg   %eax,%edi
+  804e29:	07                   	(bad)
+  804e2a:	80 00 00             	addb   $0x0,(%rax)
+  804e2d:	00 00                	add    %al,(%rax)
+  804e2f:	00 33                	add    %dh,(%rbx)
+  804e31:	0d 80 00 00 00       	or     $0x80,%eax
+  804e36:	00 00                	add    %al,(%rax)
+  804e38:	33 0d 80 00 00 00    	xor    0x80(%rip),%ecx        # 804ebe <error_string+0x1e>
+  804e3e:	00 00                	add    %al,(%rax)
+  804e40:	19 0b                	sbb    %ecx,(%rbx)
+  804e42:	80 00 00             	addb   $0x0,(%rax)
+  804e45:	00 00                	add    %al,(%rax)
+  804e47:	00 e3                	add    %ah,%bl
+  804e49:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804e4f:	00 33                	add    %dh,(%rbx)
+  804e51:	0d 80 00 00 00       	or     $0x80,%eax
+  804e56:	00 00                	add    %al,(%rax)
+  804e58:	33 0d 80 00 00 00    	xor    0x80(%rip),%ecx        # 804ede <error_string+0x3e>
+  804e5e:	00 00                	add    %al,(%rax)
+  804e60:	68 08 80 00 00       	push   $0x8008
+  804e65:	00 00                	add    %al,(%rax)
+  804e67:	00 33                	add    %dh,(%rbx)
+  804e69:	0d 80 00 00 00       	or     $0x80,%eax
+  804e6e:	00 00                	add    %al,(%rax)
+  804e70:	45 0a 80 00 00 00 00 	or     0x0(%r8),%r8b
+  804e77:	00 33                	add    %dh,(%rbx)
+  804e79:	0d 80 00 00 00       	or     $0x80,%eax
+  804e7e:	00 00                	add    %al,(%rax)
+  804e80:	33 0d 80 00 00 00    	xor    0x80(%rip),%ecx        # 804f06 <error_string+0x66>
+  804e86:	00 00                	add    %al,(%rax)
+  804e88:	56                   	push   %rsi
+  804e89:	0c 80                	or     $0x80,%al
+  804e8b:	00 00                	add    %al,(%rax)
+  804e8d:	00 00                	add    %al,(%rax)
+  804e8f:	00 33                	add    %dh,(%rbx)
+  804e91:	0d 80 00 00 00       	or     $0x80,%eax
+  804e96:	00 00                	add    %al,(%rax)
+  804e98:	fb                   	sti
+  804e99:	06                   	(bad)
+  804e9a:	80 00 00             	addb   $0x0,(%rax)
+  804e9d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000804ea0 <error_string>:
+	...
+  804ea8:	4d 4a 80 00 00 00 00 00 5f 4a 80 00 00 00 00 00     MJ......_J......
+  804eb8:	6f 4a 80 00 00 00 00 00 81 4a 80 00 00 00 00 00     oJ.......J......
+  804ec8:	8f 4a 80 00 00 00 00 00 a3 4a 80 00 00 00 00 00     .J.......J......
+  804ed8:	b8 4a 80 00 00 00 00 00 cb 4a 80 00 00 00 00 00     .J.......J......
+  804ee8:	dd 4a 80 00 00 00 00 00 f1 4a 80 00 00 00 00 00     .J.......J......
+  804ef8:	01 4b 80 00 00 00 00 00 14 4b 80 00 00 00 00 00     .K.......K......
+  804f08:	2b 4b 80 00 00 00 00 00 41 4b 80 00 00 00 00 00     +K......AK......
+  804f18:	59 4b 80 00 00 00 00 00 71 4b 80 00 00 00 00 00     YK......qK......
+  804f28:	7e 4b 80 00 00 00 00 00 58 4f 80 00 00 00 00 00     ~K......XO......
+  804f38:	92 4b 80 00 00 00 00 00 aa 4b 80 00 00 00 00 00     .K.......K......
+  804f48:	b4 4b 80 00 00 00 00 00 be 4b 80 00 00 00 00 00     .K.......K......
+  804f58:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  804f68:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  804f78:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  804f88:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  804f98:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  804fa8:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  804fb8:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  804fc8:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  804fd8:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  804fe8:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  804ff8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  805008:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  805018:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  805028:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805038:	0f 1f 84 00 00 00 00 00                             ........
+
+0000000000805040 <devtab>:
+  805040:	20 60 80 00 00 00 00 00 60 60 80 00 00 00 00 00      `......``......
+  805050:	a0 60 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .`..............
+  805060:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  805070:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  805080:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  805090:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8050a0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8050b0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  8050c0:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  8050d0:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  8050e0:	3a 20 00 0f 1f 44 00 00 55 73 65 72 73 70 61 63     : ...D..Userspac
+  8050f0:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  805100:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  805110:	65 72 72 3d 25 78 0a 00 6c 69 62 2f 70 67 66 61     err=%x..lib/pgfa
+  805120:	75 6c 74 2e 63 00 73 65 74 5f 70 67 66 61 75 6c     ult.c.set_pgfaul
+  805130:	74 5f 68 61 6e 64 6c 65 72 3a 20 25 69 00 5f 70     t_handler: %i._p
+  805140:	66 68 61 6e 64 6c 65 72 5f 69 6e 69 74 69 74 69     fhandler_inititi
+  805150:	61 6c 6c 69 7a 65 64 00 69 70 63 5f 73 65 6e 64     allized.ipc_send
+  805160:	20 65 72 72 6f 72 3a 20 25 69 0a 00 6c 69 62 2f      error: %i..lib/
+  805170:	69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00 00     ipc.c.f.........
+  805180:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805190:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8051a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8051b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8051c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8051d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8051e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8051f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805200:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805210:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805220:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805230:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805240:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805250:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805260:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805270:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805280:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805290:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8052a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8052b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8052c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8052d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8052e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8052f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805300:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805310:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805320:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805330:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805340:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805350:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805360:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805370:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805380:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805390:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8053a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8053b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8053c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8053d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8053e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8053f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805400:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805410:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805420:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805430:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805440:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805450:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805460:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805470:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805480:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805490:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8054a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8054b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8054c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8054d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8054e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8054f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805500:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805510:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805520:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805530:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805540:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805550:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805560:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805570:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805580:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805590:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8055a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8055b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8055c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8055d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8055e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8055f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805600:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805610:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805620:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805630:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805640:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805650:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805660:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805670:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805680:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805690:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8056a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8056b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8056c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8056d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8056e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8056f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805700:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805710:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805720:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805730:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805740:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805750:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805760:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805770:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805780:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805790:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8057a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8057b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8057c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8057d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8057e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8057f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805800:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805810:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805820:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805830:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805840:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805850:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805860:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805870:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805880:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805890:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8058a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8058b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8058c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8058d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8058e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8058f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805900:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805910:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805920:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805930:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805940:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805950:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805960:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805970:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805980:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805990:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8059a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8059b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8059c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8059d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8059e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8059f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805aa0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ab0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ac0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ad0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ae0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805af0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ba0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805bb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805bc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805bd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805be0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805bf0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ca0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805cb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805cc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805cd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ce0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805cf0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805da0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805db0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805dc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805dd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805de0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805df0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ea0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805eb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ec0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ed0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ee0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ef0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805fa0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805fb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805fc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805fd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805fe0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ff0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 90     ....f.........f.
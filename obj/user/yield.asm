@@ -0,0 +1,8214 @@
+
+obj/user/yield:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 c6 00 00 00       	call   8000e9 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+/* yield the processor to other environments */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 08          	sub    $0x8,%rsp
+    cprintf("Hello, I am environment %08x.\n", thisenv->env_id);
+  800036:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80003d:	00 00 00 
+  800040:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800046:	48 bf 48 47 80 00 00 	movabs $0x804748,%rdi
+  80004d:	00 00 00 
+  800050:	b8 00 00 00 00       	mov    $0x0,%eax
+  800055:	48 ba 6c 02 80 00 00 	movabs $0x80026c,%rdx
+  80005c:	00 00 00 
+  80005f:	ff d2                	call   *%rdx
+    for (int i = 0; i < 5; i++) {
+  800061:	bb 00 00 00 00       	mov    $0x0,%ebx
+        sys_yield();
+  800066:	49 bf 8c 10 80 00 00 	movabs $0x80108c,%r15
+  80006d:	00 00 00 
+        cprintf("Back in environment %08x, iteration %d.\n",
+                thisenv->env_id, i);
+  800070:	49 be 00 00 81 00 00 	movabs $0x810000,%r14
+  800077:	00 00 00 
+        cprintf("Back in environment %08x, iteration %d.\n",
+  80007a:	49 bd 68 47 80 00 00 	movabs $0x804768,%r13
+  800081:	00 00 00 
+  800084:	49 bc 6c 02 80 00 00 	movabs $0x80026c,%r12
+  80008b:	00 00 00 
+        sys_yield();
+  80008e:	41 ff d7             	call   *%r15
+                thisenv->env_id, i);
+  800091:	49 8b 06             	mov    (%r14),%rax
+  800094:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("Back in environment %08x, iteration %d.\n",
+  80009a:	89 da                	mov    %ebx,%edx
+  80009c:	4c 89 ef             	mov    %r13,%rdi
+  80009f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a4:	41 ff d4             	call   *%r12
+    for (int i = 0; i < 5; i++) {
+  8000a7:	83 c3 01             	add    $0x1,%ebx
+  8000aa:	83 fb 05             	cmp    $0x5,%ebx
+  8000ad:	75 df                	jne    80008e <umain+0x69>
+    }
+    cprintf("All done in environment %08x.\n", thisenv->env_id);
+  8000af:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8000b6:	00 00 00 
+  8000b9:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8000bf:	48 bf 98 47 80 00 00 	movabs $0x804798,%rdi
+  8000c6:	00 00 00 
+  8000c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ce:	48 ba 6c 02 80 00 00 	movabs $0x80026c,%rdx
+  8000d5:	00 00 00 
+  8000d8:	ff d2                	call   *%rdx
+}
+  8000da:	48 83 c4 08          	add    $0x8,%rsp
+  8000de:	5b                   	pop    %rbx
+  8000df:	41 5c                	pop    %r12
+  8000e1:	41 5d                	pop    %r13
+  8000e3:	41 5e                	pop    %r14
+  8000e5:	41 5f                	pop    %r15
+  8000e7:	5d                   	pop    %rbp
+  8000e8:	c3                   	ret
+
+00000000008000e9 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8000e9:	55                   	push   %rbp
+  8000ea:	48 89 e5             	mov    %rsp,%rbp
+  8000ed:	41 56                	push   %r14
+  8000ef:	41 55                	push   %r13
+  8000f1:	41 54                	push   %r12
+  8000f3:	53                   	push   %rbx
+  8000f4:	41 89 fd             	mov    %edi,%r13d
+  8000f7:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8000fa:	48 ba e0 50 80 00 00 	movabs $0x8050e0,%rdx
+  800101:	00 00 00 
+  800104:	48 b8 e0 50 80 00 00 	movabs $0x8050e0,%rax
+  80010b:	00 00 00 
+  80010e:	48 39 c2             	cmp    %rax,%rdx
+  800111:	73 17                	jae    80012a <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800113:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800116:	49 89 c4             	mov    %rax,%r12
+  800119:	48 83 c3 08          	add    $0x8,%rbx
+  80011d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800122:	ff 53 f8             	call   *-0x8(%rbx)
+  800125:	4c 39 e3             	cmp    %r12,%rbx
+  800128:	72 ef                	jb     800119 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  80012a:	48 b8 63 10 80 00 00 	movabs $0x801063,%rax
+  800131:	00 00 00 
+  800134:	ff d0                	call   *%rax
+  800136:	89 c2                	mov    %eax,%edx
+  800138:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  80013e:	48 89 d0             	mov    %rdx,%rax
+  800141:	48 c1 e0 04          	shl    $0x4,%rax
+  800145:	48 29 d0             	sub    %rdx,%rax
+  800148:	48 c1 e0 05          	shl    $0x5,%rax
+  80014c:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800153:	00 00 00 
+  800156:	48 01 d0             	add    %rdx,%rax
+  800159:	48 a3 00 00 81 00 00 	movabs %rax,0x810000
+  800160:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800163:	45 85 ed             	test   %r13d,%r13d
+  800166:	7e 0d                	jle    800175 <libmain+0x8c>
+  800168:	49 8b 06             	mov    (%r14),%rax
+  80016b:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  800172:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800175:	4c 89 f6             	mov    %r14,%rsi
+  800178:	44 89 ef             	mov    %r13d,%edi
+  80017b:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800182:	00 00 00 
+  800185:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800187:	48 b8 9c 01 80 00 00 	movabs $0x80019c,%rax
+  80018e:	00 00 00 
+  800191:	ff d0                	call   *%rax
+#endif
+}
+  800193:	5b                   	pop    %rbx
+  800194:	41 5c                	pop    %r12
+  800196:	41 5d                	pop    %r13
+  800198:	41 5e                	pop    %r14
+  80019a:	5d                   	pop    %rbp
+  80019b:	c3                   	ret
+
+000000000080019c <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80019c:	55                   	push   %rbp
+  80019d:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8001a0:	48 b8 49 17 80 00 00 	movabs $0x801749,%rax
+  8001a7:	00 00 00 
+  8001aa:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8001ac:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001b1:	48 b8 00 10 80 00 00 	movabs $0x801000,%rax
+  8001b8:	00 00 00 
+  8001bb:	ff d0                	call   *%rax
+}
+  8001bd:	5d                   	pop    %rbp
+  8001be:	c3                   	ret
+
+00000000008001bf <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8001bf:	55                   	push   %rbp
+  8001c0:	48 89 e5             	mov    %rsp,%rbp
+  8001c3:	53                   	push   %rbx
+  8001c4:	48 83 ec 08          	sub    $0x8,%rsp
+  8001c8:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8001cb:	8b 06                	mov    (%rsi),%eax
+  8001cd:	8d 50 01             	lea    0x1(%rax),%edx
+  8001d0:	89 16                	mov    %edx,(%rsi)
+  8001d2:	48 98                	cltq
+  8001d4:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8001d9:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8001df:	74 0a                	je     8001eb <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8001e1:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8001e5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001e9:	c9                   	leave
+  8001ea:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8001eb:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8001ef:	be ff 00 00 00       	mov    $0xff,%esi
+  8001f4:	48 b8 b8 0f 80 00 00 	movabs $0x800fb8,%rax
+  8001fb:	00 00 00 
+  8001fe:	ff d0                	call   *%rax
+        state->offset = 0;
+  800200:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800206:	eb d9                	jmp    8001e1 <putch+0x22>
+
+0000000000800208 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800208:	55                   	push   %rbp
+  800209:	48 89 e5             	mov    %rsp,%rbp
+  80020c:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800213:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800216:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80021d:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800222:	b8 00 00 00 00       	mov    $0x0,%eax
+  800227:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80022a:	48 89 f1             	mov    %rsi,%rcx
+  80022d:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800234:	48 bf bf 01 80 00 00 	movabs $0x8001bf,%rdi
+  80023b:	00 00 00 
+  80023e:	48 b8 bc 03 80 00 00 	movabs $0x8003bc,%rax
+  800245:	00 00 00 
+  800248:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80024a:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800251:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800258:	48 b8 b8 0f 80 00 00 	movabs $0x800fb8,%rax
+  80025f:	00 00 00 
+  800262:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800264:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80026a:	c9                   	leave
+  80026b:	c3                   	ret
+
+000000000080026c <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80026c:	55                   	push   %rbp
+  80026d:	48 89 e5             	mov    %rsp,%rbp
+  800270:	48 83 ec 50          	sub    $0x50,%rsp
+  800274:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800278:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80027c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800280:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800284:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800288:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80028f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800293:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800297:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80029b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80029f:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8002a3:	48 b8 08 02 80 00 00 	movabs $0x800208,%rax
+  8002aa:	00 00 00 
+  8002ad:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8002af:	c9                   	leave
+  8002b0:	c3                   	ret
+
+00000000008002b1 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8002b1:	55                   	push   %rbp
+  8002b2:	48 89 e5             	mov    %rsp,%rbp
+  8002b5:	41 57                	push   %r15
+  8002b7:	41 56                	push   %r14
+  8002b9:	41 55                	push   %r13
+  8002bb:	41 54                	push   %r12
+  8002bd:	53                   	push   %rbx
+  8002be:	48 83 ec 18          	sub    $0x18,%rsp
+  8002c2:	49 89 fc             	mov    %rdi,%r12
+  8002c5:	49 89 f5             	mov    %rsi,%r13
+  8002c8:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8002cc:	8b 45 10             	mov    0x10(%rbp),%eax
+  8002cf:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8002d2:	41 89 cf             	mov    %ecx,%r15d
+  8002d5:	4c 39 fa             	cmp    %r15,%rdx
+  8002d8:	73 5b                	jae    800335 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8002da:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8002de:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8002e2:	85 db                	test   %ebx,%ebx
+  8002e4:	7e 0e                	jle    8002f4 <print_num+0x43>
+            putch(padc, put_arg);
+  8002e6:	4c 89 ee             	mov    %r13,%rsi
+  8002e9:	44 89 f7             	mov    %r14d,%edi
+  8002ec:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8002ef:	83 eb 01             	sub    $0x1,%ebx
+  8002f2:	75 f2                	jne    8002e6 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8002f4:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8002f8:	48 b9 d2 47 80 00 00 	movabs $0x8047d2,%rcx
+  8002ff:	00 00 00 
+  800302:	48 b8 c1 47 80 00 00 	movabs $0x8047c1,%rax
+  800309:	00 00 00 
+  80030c:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800310:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800314:	ba 00 00 00 00       	mov    $0x0,%edx
+  800319:	49 f7 f7             	div    %r15
+  80031c:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800320:	4c 89 ee             	mov    %r13,%rsi
+  800323:	41 ff d4             	call   *%r12
+}
+  800326:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80032a:	5b                   	pop    %rbx
+  80032b:	41 5c                	pop    %r12
+  80032d:	41 5d                	pop    %r13
+  80032f:	41 5e                	pop    %r14
+  800331:	41 5f                	pop    %r15
+  800333:	5d                   	pop    %rbp
+  800334:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800335:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800339:	ba 00 00 00 00       	mov    $0x0,%edx
+  80033e:	49 f7 f7             	div    %r15
+  800341:	48 83 ec 08          	sub    $0x8,%rsp
+  800345:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800349:	52                   	push   %rdx
+  80034a:	45 0f be c9          	movsbl %r9b,%r9d
+  80034e:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800352:	48 89 c2             	mov    %rax,%rdx
+  800355:	48 b8 b1 02 80 00 00 	movabs $0x8002b1,%rax
+  80035c:	00 00 00 
+  80035f:	ff d0                	call   *%rax
+  800361:	48 83 c4 10          	add    $0x10,%rsp
+  800365:	eb 8d                	jmp    8002f4 <print_num+0x43>
+
+0000000000800367 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800367:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80036b:	48 8b 06             	mov    (%rsi),%rax
+  80036e:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800372:	73 0a                	jae    80037e <sprintputch+0x17>
+        *state->start++ = ch;
+  800374:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800378:	48 89 16             	mov    %rdx,(%rsi)
+  80037b:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80037e:	c3                   	ret
+
+000000000080037f <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80037f:	55                   	push   %rbp
+  800380:	48 89 e5             	mov    %rsp,%rbp
+  800383:	48 83 ec 50          	sub    $0x50,%rsp
+  800387:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80038b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80038f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800393:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80039a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80039e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003a2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8003a6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8003aa:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8003ae:	48 b8 bc 03 80 00 00 	movabs $0x8003bc,%rax
+  8003b5:	00 00 00 
+  8003b8:	ff d0                	call   *%rax
+}
+  8003ba:	c9                   	leave
+  8003bb:	c3                   	ret
+
+00000000008003bc <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8003bc:	55                   	push   %rbp
+  8003bd:	48 89 e5             	mov    %rsp,%rbp
+  8003c0:	41 57                	push   %r15
+  8003c2:	41 56                	push   %r14
+  8003c4:	41 55                	push   %r13
+  8003c6:	41 54                	push   %r12
+  8003c8:	53                   	push   %rbx
+  8003c9:	48 83 ec 38          	sub    $0x38,%rsp
+  8003cd:	49 89 fe             	mov    %rdi,%r14
+  8003d0:	49 89 f5             	mov    %rsi,%r13
+  8003d3:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8003d6:	48 8b 01             	mov    (%rcx),%rax
+  8003d9:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8003dd:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8003e1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003e5:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8003e9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8003ed:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8003f1:	0f b6 3b             	movzbl (%rbx),%edi
+  8003f4:	40 80 ff 25          	cmp    $0x25,%dil
+  8003f8:	74 18                	je     800412 <vprintfmt+0x56>
+            if (!ch) return;
+  8003fa:	40 84 ff             	test   %dil,%dil
+  8003fd:	0f 84 b1 06 00 00    	je     800ab4 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800403:	40 0f b6 ff          	movzbl %dil,%edi
+  800407:	4c 89 ee             	mov    %r13,%rsi
+  80040a:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80040d:	4c 89 e3             	mov    %r12,%rbx
+  800410:	eb db                	jmp    8003ed <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800412:	be 00 00 00 00       	mov    $0x0,%esi
+  800417:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80041b:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800420:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800426:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80042d:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800431:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800436:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80043b:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80043e:	83 e8 23             	sub    $0x23,%eax
+  800441:	3c 57                	cmp    $0x57,%al
+  800443:	0f 87 51 06 00 00    	ja     800a9a <vprintfmt+0x6de>
+  800449:	0f b6 c0             	movzbl %al,%eax
+  80044c:	48 b9 80 49 80 00 00 	movabs $0x804980,%rcx
+  800453:	00 00 00 
+  800456:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800459:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80045c:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800460:	eb cf                	jmp    800431 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800462:	49 89 dc             	mov    %rbx,%r12
+  800465:	be 01 00 00 00       	mov    $0x1,%esi
+  80046a:	eb c5                	jmp    800431 <vprintfmt+0x75>
+            padc = ch;
+  80046c:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800470:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800473:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800476:	eb b9                	jmp    800431 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800478:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80047b:	83 f8 2f             	cmp    $0x2f,%eax
+  80047e:	77 24                	ja     8004a4 <vprintfmt+0xe8>
+  800480:	89 c1                	mov    %eax,%ecx
+  800482:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800486:	83 c0 08             	add    $0x8,%eax
+  800489:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80048c:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80048f:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800492:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800496:	79 99                	jns    800431 <vprintfmt+0x75>
+                width = precision;
+  800498:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80049c:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8004a2:	eb 8d                	jmp    800431 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8004a4:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8004a8:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8004ac:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004b0:	eb da                	jmp    80048c <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8004b2:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8004b7:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8004bb:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8004c1:	3c 39                	cmp    $0x39,%al
+  8004c3:	77 1c                	ja     8004e1 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8004c5:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8004c9:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8004cd:	0f b6 c0             	movzbl %al,%eax
+  8004d0:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8004d5:	0f b6 03             	movzbl (%rbx),%eax
+  8004d8:	3c 39                	cmp    $0x39,%al
+  8004da:	76 e9                	jbe    8004c5 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8004dc:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8004df:	eb b1                	jmp    800492 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8004e1:	49 89 dc             	mov    %rbx,%r12
+  8004e4:	eb ac                	jmp    800492 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8004e6:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8004e9:	85 c9                	test   %ecx,%ecx
+  8004eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004f0:	0f 49 c1             	cmovns %ecx,%eax
+  8004f3:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8004f6:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004f9:	e9 33 ff ff ff       	jmp    800431 <vprintfmt+0x75>
+            lflag++;
+  8004fe:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800501:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800504:	e9 28 ff ff ff       	jmp    800431 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800509:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80050c:	83 f8 2f             	cmp    $0x2f,%eax
+  80050f:	77 19                	ja     80052a <vprintfmt+0x16e>
+  800511:	89 c2                	mov    %eax,%edx
+  800513:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800517:	83 c0 08             	add    $0x8,%eax
+  80051a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80051d:	8b 3a                	mov    (%rdx),%edi
+  80051f:	4c 89 ee             	mov    %r13,%rsi
+  800522:	41 ff d6             	call   *%r14
+            break;
+  800525:	e9 c3 fe ff ff       	jmp    8003ed <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80052a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80052e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800532:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800536:	eb e5                	jmp    80051d <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800538:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80053b:	83 f8 2f             	cmp    $0x2f,%eax
+  80053e:	77 5a                	ja     80059a <vprintfmt+0x1de>
+  800540:	89 c2                	mov    %eax,%edx
+  800542:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800546:	83 c0 08             	add    $0x8,%eax
+  800549:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80054c:	8b 02                	mov    (%rdx),%eax
+  80054e:	89 c1                	mov    %eax,%ecx
+  800550:	f7 d9                	neg    %ecx
+  800552:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800555:	83 f9 16             	cmp    $0x16,%ecx
+  800558:	7f 4e                	jg     8005a8 <vprintfmt+0x1ec>
+  80055a:	48 63 c1             	movslq %ecx,%rax
+  80055d:	48 ba 40 4c 80 00 00 	movabs $0x804c40,%rdx
+  800564:	00 00 00 
+  800567:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80056b:	48 85 c0             	test   %rax,%rax
+  80056e:	74 38                	je     8005a8 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800570:	48 89 c1             	mov    %rax,%rcx
+  800573:	48 ba 19 4e 80 00 00 	movabs $0x804e19,%rdx
+  80057a:	00 00 00 
+  80057d:	4c 89 ee             	mov    %r13,%rsi
+  800580:	4c 89 f7             	mov    %r14,%rdi
+  800583:	b8 00 00 00 00       	mov    $0x0,%eax
+  800588:	49 b8 7f 03 80 00 00 	movabs $0x80037f,%r8
+  80058f:	00 00 00 
+  800592:	41 ff d0             	call   *%r8
+  800595:	e9 53 fe ff ff       	jmp    8003ed <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80059a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80059e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005a2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005a6:	eb a4                	jmp    80054c <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8005a8:	48 ba ea 47 80 00 00 	movabs $0x8047ea,%rdx
+  8005af:	00 00 00 
+  8005b2:	4c 89 ee             	mov    %r13,%rsi
+  8005b5:	4c 89 f7             	mov    %r14,%rdi
+  8005b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005bd:	49 b8 7f 03 80 00 00 	movabs $0x80037f,%r8
+  8005c4:	00 00 00 
+  8005c7:	41 ff d0             	call   *%r8
+  8005ca:	e9 1e fe ff ff       	jmp    8003ed <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8005cf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005d2:	83 f8 2f             	cmp    $0x2f,%eax
+  8005d5:	77 6c                	ja     800643 <vprintfmt+0x287>
+  8005d7:	89 c2                	mov    %eax,%edx
+  8005d9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005dd:	83 c0 08             	add    $0x8,%eax
+  8005e0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005e3:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8005e6:	48 85 d2             	test   %rdx,%rdx
+  8005e9:	48 b8 e3 47 80 00 00 	movabs $0x8047e3,%rax
+  8005f0:	00 00 00 
+  8005f3:	48 0f 45 c2          	cmovne %rdx,%rax
+  8005f7:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8005fb:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8005ff:	7e 06                	jle    800607 <vprintfmt+0x24b>
+  800601:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800605:	75 4a                	jne    800651 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800607:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80060b:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80060f:	0f b6 00             	movzbl (%rax),%eax
+  800612:	84 c0                	test   %al,%al
+  800614:	0f 85 9a 00 00 00    	jne    8006b4 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80061a:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80061d:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800621:	85 c0                	test   %eax,%eax
+  800623:	0f 8e c4 fd ff ff    	jle    8003ed <vprintfmt+0x31>
+  800629:	4c 89 ee             	mov    %r13,%rsi
+  80062c:	bf 20 00 00 00       	mov    $0x20,%edi
+  800631:	41 ff d6             	call   *%r14
+  800634:	41 83 ec 01          	sub    $0x1,%r12d
+  800638:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80063c:	75 eb                	jne    800629 <vprintfmt+0x26d>
+  80063e:	e9 aa fd ff ff       	jmp    8003ed <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800643:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800647:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80064b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80064f:	eb 92                	jmp    8005e3 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800651:	49 63 f7             	movslq %r15d,%rsi
+  800654:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800658:	48 b8 6e 0b 80 00 00 	movabs $0x800b6e,%rax
+  80065f:	00 00 00 
+  800662:	ff d0                	call   *%rax
+  800664:	48 89 c2             	mov    %rax,%rdx
+  800667:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80066a:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80066c:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80066f:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800672:	85 c0                	test   %eax,%eax
+  800674:	7e 91                	jle    800607 <vprintfmt+0x24b>
+  800676:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80067b:	4c 89 ee             	mov    %r13,%rsi
+  80067e:	44 89 e7             	mov    %r12d,%edi
+  800681:	41 ff d6             	call   *%r14
+  800684:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800688:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80068b:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80068e:	75 eb                	jne    80067b <vprintfmt+0x2bf>
+  800690:	e9 72 ff ff ff       	jmp    800607 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800695:	0f b6 f8             	movzbl %al,%edi
+  800698:	4c 89 ee             	mov    %r13,%rsi
+  80069b:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80069e:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8006a2:	49 83 c4 01          	add    $0x1,%r12
+  8006a6:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8006ac:	84 c0                	test   %al,%al
+  8006ae:	0f 84 66 ff ff ff    	je     80061a <vprintfmt+0x25e>
+  8006b4:	45 85 ff             	test   %r15d,%r15d
+  8006b7:	78 0a                	js     8006c3 <vprintfmt+0x307>
+  8006b9:	41 83 ef 01          	sub    $0x1,%r15d
+  8006bd:	0f 88 57 ff ff ff    	js     80061a <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8006c3:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8006c7:	74 cc                	je     800695 <vprintfmt+0x2d9>
+  8006c9:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8006cc:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8006d1:	80 fa 5e             	cmp    $0x5e,%dl
+  8006d4:	77 c2                	ja     800698 <vprintfmt+0x2dc>
+  8006d6:	eb bd                	jmp    800695 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8006d8:	40 84 f6             	test   %sil,%sil
+  8006db:	75 26                	jne    800703 <vprintfmt+0x347>
+    switch (lflag) {
+  8006dd:	85 d2                	test   %edx,%edx
+  8006df:	74 59                	je     80073a <vprintfmt+0x37e>
+  8006e1:	83 fa 01             	cmp    $0x1,%edx
+  8006e4:	74 7b                	je     800761 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8006e6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006e9:	83 f8 2f             	cmp    $0x2f,%eax
+  8006ec:	0f 87 96 00 00 00    	ja     800788 <vprintfmt+0x3cc>
+  8006f2:	89 c2                	mov    %eax,%edx
+  8006f4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006f8:	83 c0 08             	add    $0x8,%eax
+  8006fb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006fe:	4c 8b 22             	mov    (%rdx),%r12
+  800701:	eb 17                	jmp    80071a <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800703:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800706:	83 f8 2f             	cmp    $0x2f,%eax
+  800709:	77 21                	ja     80072c <vprintfmt+0x370>
+  80070b:	89 c2                	mov    %eax,%edx
+  80070d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800711:	83 c0 08             	add    $0x8,%eax
+  800714:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800717:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80071a:	4d 85 e4             	test   %r12,%r12
+  80071d:	78 7a                	js     800799 <vprintfmt+0x3dd>
+            num = i;
+  80071f:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800722:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800727:	e9 50 02 00 00       	jmp    80097c <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80072c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800730:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800734:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800738:	eb dd                	jmp    800717 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  80073a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80073d:	83 f8 2f             	cmp    $0x2f,%eax
+  800740:	77 11                	ja     800753 <vprintfmt+0x397>
+  800742:	89 c2                	mov    %eax,%edx
+  800744:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800748:	83 c0 08             	add    $0x8,%eax
+  80074b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80074e:	4c 63 22             	movslq (%rdx),%r12
+  800751:	eb c7                	jmp    80071a <vprintfmt+0x35e>
+  800753:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800757:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80075b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80075f:	eb ed                	jmp    80074e <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800761:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800764:	83 f8 2f             	cmp    $0x2f,%eax
+  800767:	77 11                	ja     80077a <vprintfmt+0x3be>
+  800769:	89 c2                	mov    %eax,%edx
+  80076b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80076f:	83 c0 08             	add    $0x8,%eax
+  800772:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800775:	4c 8b 22             	mov    (%rdx),%r12
+  800778:	eb a0                	jmp    80071a <vprintfmt+0x35e>
+  80077a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80077e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800782:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800786:	eb ed                	jmp    800775 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800788:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80078c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800790:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800794:	e9 65 ff ff ff       	jmp    8006fe <vprintfmt+0x342>
+                putch('-', put_arg);
+  800799:	4c 89 ee             	mov    %r13,%rsi
+  80079c:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8007a1:	41 ff d6             	call   *%r14
+                i = -i;
+  8007a4:	49 f7 dc             	neg    %r12
+  8007a7:	e9 73 ff ff ff       	jmp    80071f <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8007ac:	40 84 f6             	test   %sil,%sil
+  8007af:	75 32                	jne    8007e3 <vprintfmt+0x427>
+    switch (lflag) {
+  8007b1:	85 d2                	test   %edx,%edx
+  8007b3:	74 5d                	je     800812 <vprintfmt+0x456>
+  8007b5:	83 fa 01             	cmp    $0x1,%edx
+  8007b8:	0f 84 82 00 00 00    	je     800840 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8007be:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007c1:	83 f8 2f             	cmp    $0x2f,%eax
+  8007c4:	0f 87 a5 00 00 00    	ja     80086f <vprintfmt+0x4b3>
+  8007ca:	89 c2                	mov    %eax,%edx
+  8007cc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007d0:	83 c0 08             	add    $0x8,%eax
+  8007d3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007d6:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007d9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8007de:	e9 99 01 00 00       	jmp    80097c <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8007e3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007e6:	83 f8 2f             	cmp    $0x2f,%eax
+  8007e9:	77 19                	ja     800804 <vprintfmt+0x448>
+  8007eb:	89 c2                	mov    %eax,%edx
+  8007ed:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007f1:	83 c0 08             	add    $0x8,%eax
+  8007f4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007f7:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007fa:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8007ff:	e9 78 01 00 00       	jmp    80097c <vprintfmt+0x5c0>
+  800804:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800808:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80080c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800810:	eb e5                	jmp    8007f7 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800812:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800815:	83 f8 2f             	cmp    $0x2f,%eax
+  800818:	77 18                	ja     800832 <vprintfmt+0x476>
+  80081a:	89 c2                	mov    %eax,%edx
+  80081c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800820:	83 c0 08             	add    $0x8,%eax
+  800823:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800826:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800828:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80082d:	e9 4a 01 00 00       	jmp    80097c <vprintfmt+0x5c0>
+  800832:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800836:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80083a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80083e:	eb e6                	jmp    800826 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800840:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800843:	83 f8 2f             	cmp    $0x2f,%eax
+  800846:	77 19                	ja     800861 <vprintfmt+0x4a5>
+  800848:	89 c2                	mov    %eax,%edx
+  80084a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80084e:	83 c0 08             	add    $0x8,%eax
+  800851:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800854:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800857:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  80085c:	e9 1b 01 00 00       	jmp    80097c <vprintfmt+0x5c0>
+  800861:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800865:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800869:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80086d:	eb e5                	jmp    800854 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  80086f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800873:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800877:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80087b:	e9 56 ff ff ff       	jmp    8007d6 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800880:	40 84 f6             	test   %sil,%sil
+  800883:	75 2e                	jne    8008b3 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800885:	85 d2                	test   %edx,%edx
+  800887:	74 59                	je     8008e2 <vprintfmt+0x526>
+  800889:	83 fa 01             	cmp    $0x1,%edx
+  80088c:	74 7f                	je     80090d <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  80088e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800891:	83 f8 2f             	cmp    $0x2f,%eax
+  800894:	0f 87 9f 00 00 00    	ja     800939 <vprintfmt+0x57d>
+  80089a:	89 c2                	mov    %eax,%edx
+  80089c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008a0:	83 c0 08             	add    $0x8,%eax
+  8008a3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008a6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8008a9:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8008ae:	e9 c9 00 00 00       	jmp    80097c <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8008b3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008b6:	83 f8 2f             	cmp    $0x2f,%eax
+  8008b9:	77 19                	ja     8008d4 <vprintfmt+0x518>
+  8008bb:	89 c2                	mov    %eax,%edx
+  8008bd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008c1:	83 c0 08             	add    $0x8,%eax
+  8008c4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008c7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8008ca:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8008cf:	e9 a8 00 00 00       	jmp    80097c <vprintfmt+0x5c0>
+  8008d4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008d8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008dc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008e0:	eb e5                	jmp    8008c7 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8008e2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008e5:	83 f8 2f             	cmp    $0x2f,%eax
+  8008e8:	77 15                	ja     8008ff <vprintfmt+0x543>
+  8008ea:	89 c2                	mov    %eax,%edx
+  8008ec:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008f0:	83 c0 08             	add    $0x8,%eax
+  8008f3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008f6:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8008f8:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8008fd:	eb 7d                	jmp    80097c <vprintfmt+0x5c0>
+  8008ff:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800903:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800907:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80090b:	eb e9                	jmp    8008f6 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  80090d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800910:	83 f8 2f             	cmp    $0x2f,%eax
+  800913:	77 16                	ja     80092b <vprintfmt+0x56f>
+  800915:	89 c2                	mov    %eax,%edx
+  800917:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80091b:	83 c0 08             	add    $0x8,%eax
+  80091e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800921:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800924:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800929:	eb 51                	jmp    80097c <vprintfmt+0x5c0>
+  80092b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80092f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800933:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800937:	eb e8                	jmp    800921 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800939:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80093d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800941:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800945:	e9 5c ff ff ff       	jmp    8008a6 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  80094a:	4c 89 ee             	mov    %r13,%rsi
+  80094d:	bf 30 00 00 00       	mov    $0x30,%edi
+  800952:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800955:	4c 89 ee             	mov    %r13,%rsi
+  800958:	bf 78 00 00 00       	mov    $0x78,%edi
+  80095d:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800960:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800963:	83 f8 2f             	cmp    $0x2f,%eax
+  800966:	77 47                	ja     8009af <vprintfmt+0x5f3>
+  800968:	89 c2                	mov    %eax,%edx
+  80096a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80096e:	83 c0 08             	add    $0x8,%eax
+  800971:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800974:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800977:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  80097c:	48 83 ec 08          	sub    $0x8,%rsp
+  800980:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800984:	0f 94 c0             	sete   %al
+  800987:	0f b6 c0             	movzbl %al,%eax
+  80098a:	50                   	push   %rax
+  80098b:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800990:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800994:	4c 89 ee             	mov    %r13,%rsi
+  800997:	4c 89 f7             	mov    %r14,%rdi
+  80099a:	48 b8 b1 02 80 00 00 	movabs $0x8002b1,%rax
+  8009a1:	00 00 00 
+  8009a4:	ff d0                	call   *%rax
+            break;
+  8009a6:	48 83 c4 10          	add    $0x10,%rsp
+  8009aa:	e9 3e fa ff ff       	jmp    8003ed <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  8009af:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009b3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009b7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009bb:	eb b7                	jmp    800974 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  8009bd:	40 84 f6             	test   %sil,%sil
+  8009c0:	75 2b                	jne    8009ed <vprintfmt+0x631>
+    switch (lflag) {
+  8009c2:	85 d2                	test   %edx,%edx
+  8009c4:	74 56                	je     800a1c <vprintfmt+0x660>
+  8009c6:	83 fa 01             	cmp    $0x1,%edx
+  8009c9:	74 7f                	je     800a4a <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  8009cb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009ce:	83 f8 2f             	cmp    $0x2f,%eax
+  8009d1:	0f 87 a2 00 00 00    	ja     800a79 <vprintfmt+0x6bd>
+  8009d7:	89 c2                	mov    %eax,%edx
+  8009d9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009dd:	83 c0 08             	add    $0x8,%eax
+  8009e0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009e3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009e6:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8009eb:	eb 8f                	jmp    80097c <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009ed:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009f0:	83 f8 2f             	cmp    $0x2f,%eax
+  8009f3:	77 19                	ja     800a0e <vprintfmt+0x652>
+  8009f5:	89 c2                	mov    %eax,%edx
+  8009f7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009fb:	83 c0 08             	add    $0x8,%eax
+  8009fe:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a01:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a04:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a09:	e9 6e ff ff ff       	jmp    80097c <vprintfmt+0x5c0>
+  800a0e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a12:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a16:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a1a:	eb e5                	jmp    800a01 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800a1c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a1f:	83 f8 2f             	cmp    $0x2f,%eax
+  800a22:	77 18                	ja     800a3c <vprintfmt+0x680>
+  800a24:	89 c2                	mov    %eax,%edx
+  800a26:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a2a:	83 c0 08             	add    $0x8,%eax
+  800a2d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a30:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800a32:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800a37:	e9 40 ff ff ff       	jmp    80097c <vprintfmt+0x5c0>
+  800a3c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a40:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a44:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a48:	eb e6                	jmp    800a30 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800a4a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a4d:	83 f8 2f             	cmp    $0x2f,%eax
+  800a50:	77 19                	ja     800a6b <vprintfmt+0x6af>
+  800a52:	89 c2                	mov    %eax,%edx
+  800a54:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a58:	83 c0 08             	add    $0x8,%eax
+  800a5b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a5e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a61:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800a66:	e9 11 ff ff ff       	jmp    80097c <vprintfmt+0x5c0>
+  800a6b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a6f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a73:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a77:	eb e5                	jmp    800a5e <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800a79:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a7d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a81:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a85:	e9 59 ff ff ff       	jmp    8009e3 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800a8a:	4c 89 ee             	mov    %r13,%rsi
+  800a8d:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a92:	41 ff d6             	call   *%r14
+            break;
+  800a95:	e9 53 f9 ff ff       	jmp    8003ed <vprintfmt+0x31>
+            putch('%', put_arg);
+  800a9a:	4c 89 ee             	mov    %r13,%rsi
+  800a9d:	bf 25 00 00 00       	mov    $0x25,%edi
+  800aa2:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800aa5:	48 83 eb 01          	sub    $0x1,%rbx
+  800aa9:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800aad:	75 f6                	jne    800aa5 <vprintfmt+0x6e9>
+  800aaf:	e9 39 f9 ff ff       	jmp    8003ed <vprintfmt+0x31>
+}
+  800ab4:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800ab8:	5b                   	pop    %rbx
+  800ab9:	41 5c                	pop    %r12
+  800abb:	41 5d                	pop    %r13
+  800abd:	41 5e                	pop    %r14
+  800abf:	41 5f                	pop    %r15
+  800ac1:	5d                   	pop    %rbp
+  800ac2:	c3                   	ret
+
+0000000000800ac3 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800ac3:	55                   	push   %rbp
+  800ac4:	48 89 e5             	mov    %rsp,%rbp
+  800ac7:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800acb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800acf:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800ad4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800ad8:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800adf:	48 85 ff             	test   %rdi,%rdi
+  800ae2:	74 2b                	je     800b0f <vsnprintf+0x4c>
+  800ae4:	48 85 f6             	test   %rsi,%rsi
+  800ae7:	74 26                	je     800b0f <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800ae9:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800aed:	48 bf 67 03 80 00 00 	movabs $0x800367,%rdi
+  800af4:	00 00 00 
+  800af7:	48 b8 bc 03 80 00 00 	movabs $0x8003bc,%rax
+  800afe:	00 00 00 
+  800b01:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800b03:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b07:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800b0a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800b0d:	c9                   	leave
+  800b0e:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800b0f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b14:	eb f7                	jmp    800b0d <vsnprintf+0x4a>
+
+0000000000800b16 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800b16:	55                   	push   %rbp
+  800b17:	48 89 e5             	mov    %rsp,%rbp
+  800b1a:	48 83 ec 50          	sub    $0x50,%rsp
+  800b1e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800b22:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800b26:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800b2a:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800b31:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800b35:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b39:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800b3d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800b41:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800b45:	48 b8 c3 0a 80 00 00 	movabs $0x800ac3,%rax
+  800b4c:	00 00 00 
+  800b4f:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800b51:	c9                   	leave
+  800b52:	c3                   	ret
+
+0000000000800b53 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800b53:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800b56:	74 10                	je     800b68 <strlen+0x15>
+    size_t n = 0;
+  800b58:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800b5d:	48 83 c0 01          	add    $0x1,%rax
+  800b61:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800b65:	75 f6                	jne    800b5d <strlen+0xa>
+  800b67:	c3                   	ret
+    size_t n = 0;
+  800b68:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800b6d:	c3                   	ret
+
+0000000000800b6e <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800b6e:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800b71:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800b76:	48 85 f6             	test   %rsi,%rsi
+  800b79:	74 11                	je     800b8c <strnlen+0x1e>
+  800b7b:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800b7f:	74 0c                	je     800b8d <strnlen+0x1f>
+  800b81:	48 83 c2 01          	add    $0x1,%rdx
+  800b85:	48 39 d0             	cmp    %rdx,%rax
+  800b88:	75 f1                	jne    800b7b <strnlen+0xd>
+  800b8a:	eb 04                	jmp    800b90 <strnlen+0x22>
+  800b8c:	c3                   	ret
+  800b8d:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800b90:	c3                   	ret
+
+0000000000800b91 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800b91:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800b94:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b99:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800b9d:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800ba0:	48 83 c2 01          	add    $0x1,%rdx
+  800ba4:	84 c9                	test   %cl,%cl
+  800ba6:	75 f1                	jne    800b99 <strcpy+0x8>
+        ;
+    return res;
+}
+  800ba8:	c3                   	ret
+
+0000000000800ba9 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800ba9:	55                   	push   %rbp
+  800baa:	48 89 e5             	mov    %rsp,%rbp
+  800bad:	41 54                	push   %r12
+  800baf:	53                   	push   %rbx
+  800bb0:	48 89 fb             	mov    %rdi,%rbx
+  800bb3:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800bb6:	48 b8 53 0b 80 00 00 	movabs $0x800b53,%rax
+  800bbd:	00 00 00 
+  800bc0:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800bc2:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800bc6:	4c 89 e6             	mov    %r12,%rsi
+  800bc9:	48 b8 91 0b 80 00 00 	movabs $0x800b91,%rax
+  800bd0:	00 00 00 
+  800bd3:	ff d0                	call   *%rax
+    return dst;
+}
+  800bd5:	48 89 d8             	mov    %rbx,%rax
+  800bd8:	5b                   	pop    %rbx
+  800bd9:	41 5c                	pop    %r12
+  800bdb:	5d                   	pop    %rbp
+  800bdc:	c3                   	ret
+
+0000000000800bdd <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800bdd:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800be0:	48 85 d2             	test   %rdx,%rdx
+  800be3:	74 1f                	je     800c04 <strncpy+0x27>
+  800be5:	48 01 fa             	add    %rdi,%rdx
+  800be8:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800beb:	48 83 c1 01          	add    $0x1,%rcx
+  800bef:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800bf3:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800bf7:	41 80 f8 01          	cmp    $0x1,%r8b
+  800bfb:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800bff:	48 39 ca             	cmp    %rcx,%rdx
+  800c02:	75 e7                	jne    800beb <strncpy+0xe>
+    }
+    return ret;
+}
+  800c04:	c3                   	ret
+
+0000000000800c05 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800c05:	48 89 f8             	mov    %rdi,%rax
+  800c08:	48 85 d2             	test   %rdx,%rdx
+  800c0b:	74 24                	je     800c31 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800c0d:	48 83 ea 01          	sub    $0x1,%rdx
+  800c11:	74 1b                	je     800c2e <strlcpy+0x29>
+  800c13:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800c17:	0f b6 16             	movzbl (%rsi),%edx
+  800c1a:	84 d2                	test   %dl,%dl
+  800c1c:	74 10                	je     800c2e <strlcpy+0x29>
+            *dst++ = *src++;
+  800c1e:	48 83 c6 01          	add    $0x1,%rsi
+  800c22:	48 83 c0 01          	add    $0x1,%rax
+  800c26:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800c29:	48 39 c8             	cmp    %rcx,%rax
+  800c2c:	75 e9                	jne    800c17 <strlcpy+0x12>
+        *dst = '\0';
+  800c2e:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800c31:	48 29 f8             	sub    %rdi,%rax
+}
+  800c34:	c3                   	ret
+
+0000000000800c35 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800c35:	0f b6 07             	movzbl (%rdi),%eax
+  800c38:	84 c0                	test   %al,%al
+  800c3a:	74 13                	je     800c4f <strcmp+0x1a>
+  800c3c:	38 06                	cmp    %al,(%rsi)
+  800c3e:	75 0f                	jne    800c4f <strcmp+0x1a>
+  800c40:	48 83 c7 01          	add    $0x1,%rdi
+  800c44:	48 83 c6 01          	add    $0x1,%rsi
+  800c48:	0f b6 07             	movzbl (%rdi),%eax
+  800c4b:	84 c0                	test   %al,%al
+  800c4d:	75 ed                	jne    800c3c <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c4f:	0f b6 c0             	movzbl %al,%eax
+  800c52:	0f b6 16             	movzbl (%rsi),%edx
+  800c55:	29 d0                	sub    %edx,%eax
+}
+  800c57:	c3                   	ret
+
+0000000000800c58 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800c58:	48 85 d2             	test   %rdx,%rdx
+  800c5b:	74 1f                	je     800c7c <strncmp+0x24>
+  800c5d:	0f b6 07             	movzbl (%rdi),%eax
+  800c60:	84 c0                	test   %al,%al
+  800c62:	74 1e                	je     800c82 <strncmp+0x2a>
+  800c64:	3a 06                	cmp    (%rsi),%al
+  800c66:	75 1a                	jne    800c82 <strncmp+0x2a>
+  800c68:	48 83 c7 01          	add    $0x1,%rdi
+  800c6c:	48 83 c6 01          	add    $0x1,%rsi
+  800c70:	48 83 ea 01          	sub    $0x1,%rdx
+  800c74:	75 e7                	jne    800c5d <strncmp+0x5>
+
+    if (!n) return 0;
+  800c76:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c7b:	c3                   	ret
+  800c7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c81:	c3                   	ret
+  800c82:	48 85 d2             	test   %rdx,%rdx
+  800c85:	74 09                	je     800c90 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c87:	0f b6 07             	movzbl (%rdi),%eax
+  800c8a:	0f b6 16             	movzbl (%rsi),%edx
+  800c8d:	29 d0                	sub    %edx,%eax
+  800c8f:	c3                   	ret
+    if (!n) return 0;
+  800c90:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c95:	c3                   	ret
+
+0000000000800c96 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800c96:	0f b6 17             	movzbl (%rdi),%edx
+  800c99:	84 d2                	test   %dl,%dl
+  800c9b:	74 18                	je     800cb5 <strchr+0x1f>
+        if (*str == c) {
+  800c9d:	0f be d2             	movsbl %dl,%edx
+  800ca0:	39 f2                	cmp    %esi,%edx
+  800ca2:	74 17                	je     800cbb <strchr+0x25>
+    for (; *str; str++) {
+  800ca4:	48 83 c7 01          	add    $0x1,%rdi
+  800ca8:	0f b6 17             	movzbl (%rdi),%edx
+  800cab:	84 d2                	test   %dl,%dl
+  800cad:	75 ee                	jne    800c9d <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800caf:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cb4:	c3                   	ret
+  800cb5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cba:	c3                   	ret
+  800cbb:	48 89 f8             	mov    %rdi,%rax
+}
+  800cbe:	c3                   	ret
+
+0000000000800cbf <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800cbf:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800cc2:	0f b6 17             	movzbl (%rdi),%edx
+  800cc5:	84 d2                	test   %dl,%dl
+  800cc7:	74 13                	je     800cdc <strfind+0x1d>
+  800cc9:	0f be d2             	movsbl %dl,%edx
+  800ccc:	39 f2                	cmp    %esi,%edx
+  800cce:	74 0b                	je     800cdb <strfind+0x1c>
+  800cd0:	48 83 c0 01          	add    $0x1,%rax
+  800cd4:	0f b6 10             	movzbl (%rax),%edx
+  800cd7:	84 d2                	test   %dl,%dl
+  800cd9:	75 ee                	jne    800cc9 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800cdb:	c3                   	ret
+  800cdc:	c3                   	ret
+
+0000000000800cdd <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800cdd:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800ce0:	48 89 f8             	mov    %rdi,%rax
+  800ce3:	48 f7 d8             	neg    %rax
+  800ce6:	83 e0 07             	and    $0x7,%eax
+  800ce9:	49 89 d1             	mov    %rdx,%r9
+  800cec:	49 29 c1             	sub    %rax,%r9
+  800cef:	78 36                	js     800d27 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800cf1:	40 0f b6 c6          	movzbl %sil,%eax
+  800cf5:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800cfc:	01 01 01 
+  800cff:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800d03:	40 f6 c7 07          	test   $0x7,%dil
+  800d07:	75 38                	jne    800d41 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800d09:	4c 89 c9             	mov    %r9,%rcx
+  800d0c:	48 c1 f9 03          	sar    $0x3,%rcx
+  800d10:	74 0c                	je     800d1e <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800d12:	fc                   	cld
+  800d13:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800d16:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800d1a:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800d1e:	4d 85 c9             	test   %r9,%r9
+  800d21:	75 45                	jne    800d68 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800d23:	4c 89 c0             	mov    %r8,%rax
+  800d26:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800d27:	48 85 d2             	test   %rdx,%rdx
+  800d2a:	74 f7                	je     800d23 <memset+0x46>
+  800d2c:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800d2f:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800d32:	48 83 c0 01          	add    $0x1,%rax
+  800d36:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800d3a:	48 39 c2             	cmp    %rax,%rdx
+  800d3d:	75 f3                	jne    800d32 <memset+0x55>
+  800d3f:	eb e2                	jmp    800d23 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800d41:	40 f6 c7 01          	test   $0x1,%dil
+  800d45:	74 06                	je     800d4d <memset+0x70>
+  800d47:	88 07                	mov    %al,(%rdi)
+  800d49:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800d4d:	40 f6 c7 02          	test   $0x2,%dil
+  800d51:	74 07                	je     800d5a <memset+0x7d>
+  800d53:	66 89 07             	mov    %ax,(%rdi)
+  800d56:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800d5a:	40 f6 c7 04          	test   $0x4,%dil
+  800d5e:	74 a9                	je     800d09 <memset+0x2c>
+  800d60:	89 07                	mov    %eax,(%rdi)
+  800d62:	48 83 c7 04          	add    $0x4,%rdi
+  800d66:	eb a1                	jmp    800d09 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800d68:	41 f6 c1 04          	test   $0x4,%r9b
+  800d6c:	74 06                	je     800d74 <memset+0x97>
+  800d6e:	89 07                	mov    %eax,(%rdi)
+  800d70:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800d74:	41 f6 c1 02          	test   $0x2,%r9b
+  800d78:	74 07                	je     800d81 <memset+0xa4>
+  800d7a:	66 89 07             	mov    %ax,(%rdi)
+  800d7d:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800d81:	41 f6 c1 01          	test   $0x1,%r9b
+  800d85:	74 9c                	je     800d23 <memset+0x46>
+  800d87:	88 07                	mov    %al,(%rdi)
+  800d89:	eb 98                	jmp    800d23 <memset+0x46>
+
+0000000000800d8b <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800d8b:	48 89 f8             	mov    %rdi,%rax
+  800d8e:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800d91:	48 39 fe             	cmp    %rdi,%rsi
+  800d94:	73 3b                	jae    800dd1 <memmove+0x46>
+  800d96:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800d9a:	48 39 d7             	cmp    %rdx,%rdi
+  800d9d:	73 32                	jae    800dd1 <memmove+0x46>
+        s += n;
+        d += n;
+  800d9f:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800da3:	48 89 d6             	mov    %rdx,%rsi
+  800da6:	48 09 fe             	or     %rdi,%rsi
+  800da9:	48 09 ce             	or     %rcx,%rsi
+  800dac:	40 f6 c6 07          	test   $0x7,%sil
+  800db0:	75 12                	jne    800dc4 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800db2:	48 83 ef 08          	sub    $0x8,%rdi
+  800db6:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800dba:	48 c1 e9 03          	shr    $0x3,%rcx
+  800dbe:	fd                   	std
+  800dbf:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800dc2:	fc                   	cld
+  800dc3:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800dc4:	48 83 ef 01          	sub    $0x1,%rdi
+  800dc8:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800dcc:	fd                   	std
+  800dcd:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800dcf:	eb f1                	jmp    800dc2 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800dd1:	48 89 f2             	mov    %rsi,%rdx
+  800dd4:	48 09 c2             	or     %rax,%rdx
+  800dd7:	48 09 ca             	or     %rcx,%rdx
+  800dda:	f6 c2 07             	test   $0x7,%dl
+  800ddd:	75 0c                	jne    800deb <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800ddf:	48 c1 e9 03          	shr    $0x3,%rcx
+  800de3:	48 89 c7             	mov    %rax,%rdi
+  800de6:	fc                   	cld
+  800de7:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800dea:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800deb:	48 89 c7             	mov    %rax,%rdi
+  800dee:	fc                   	cld
+  800def:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800df1:	c3                   	ret
+
+0000000000800df2 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800df2:	55                   	push   %rbp
+  800df3:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800df6:	48 b8 8b 0d 80 00 00 	movabs $0x800d8b,%rax
+  800dfd:	00 00 00 
+  800e00:	ff d0                	call   *%rax
+}
+  800e02:	5d                   	pop    %rbp
+  800e03:	c3                   	ret
+
+0000000000800e04 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800e04:	55                   	push   %rbp
+  800e05:	48 89 e5             	mov    %rsp,%rbp
+  800e08:	41 57                	push   %r15
+  800e0a:	41 56                	push   %r14
+  800e0c:	41 55                	push   %r13
+  800e0e:	41 54                	push   %r12
+  800e10:	53                   	push   %rbx
+  800e11:	48 83 ec 08          	sub    $0x8,%rsp
+  800e15:	49 89 fe             	mov    %rdi,%r14
+  800e18:	49 89 f7             	mov    %rsi,%r15
+  800e1b:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800e1e:	48 89 f7             	mov    %rsi,%rdi
+  800e21:	48 b8 53 0b 80 00 00 	movabs $0x800b53,%rax
+  800e28:	00 00 00 
+  800e2b:	ff d0                	call   *%rax
+  800e2d:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800e30:	48 89 de             	mov    %rbx,%rsi
+  800e33:	4c 89 f7             	mov    %r14,%rdi
+  800e36:	48 b8 6e 0b 80 00 00 	movabs $0x800b6e,%rax
+  800e3d:	00 00 00 
+  800e40:	ff d0                	call   *%rax
+  800e42:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800e45:	48 39 c3             	cmp    %rax,%rbx
+  800e48:	74 36                	je     800e80 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800e4a:	48 89 d8             	mov    %rbx,%rax
+  800e4d:	4c 29 e8             	sub    %r13,%rax
+  800e50:	49 39 c4             	cmp    %rax,%r12
+  800e53:	73 31                	jae    800e86 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800e55:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800e5a:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e5e:	4c 89 fe             	mov    %r15,%rsi
+  800e61:	48 b8 f2 0d 80 00 00 	movabs $0x800df2,%rax
+  800e68:	00 00 00 
+  800e6b:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800e6d:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800e71:	48 83 c4 08          	add    $0x8,%rsp
+  800e75:	5b                   	pop    %rbx
+  800e76:	41 5c                	pop    %r12
+  800e78:	41 5d                	pop    %r13
+  800e7a:	41 5e                	pop    %r14
+  800e7c:	41 5f                	pop    %r15
+  800e7e:	5d                   	pop    %rbp
+  800e7f:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800e80:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800e84:	eb eb                	jmp    800e71 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800e86:	48 83 eb 01          	sub    $0x1,%rbx
+  800e8a:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e8e:	48 89 da             	mov    %rbx,%rdx
+  800e91:	4c 89 fe             	mov    %r15,%rsi
+  800e94:	48 b8 f2 0d 80 00 00 	movabs $0x800df2,%rax
+  800e9b:	00 00 00 
+  800e9e:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800ea0:	49 01 de             	add    %rbx,%r14
+  800ea3:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800ea8:	eb c3                	jmp    800e6d <strlcat+0x69>
+
+0000000000800eaa <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800eaa:	48 85 d2             	test   %rdx,%rdx
+  800ead:	74 2d                	je     800edc <memcmp+0x32>
+  800eaf:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800eb4:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800eb8:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800ebd:	44 38 c1             	cmp    %r8b,%cl
+  800ec0:	75 0f                	jne    800ed1 <memcmp+0x27>
+    while (n-- > 0) {
+  800ec2:	48 83 c0 01          	add    $0x1,%rax
+  800ec6:	48 39 c2             	cmp    %rax,%rdx
+  800ec9:	75 e9                	jne    800eb4 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800ecb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ed0:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800ed1:	0f b6 c1             	movzbl %cl,%eax
+  800ed4:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800ed8:	44 29 c0             	sub    %r8d,%eax
+  800edb:	c3                   	ret
+    return 0;
+  800edc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ee1:	c3                   	ret
+
+0000000000800ee2 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800ee2:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800ee6:	48 39 c7             	cmp    %rax,%rdi
+  800ee9:	73 0f                	jae    800efa <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800eeb:	40 38 37             	cmp    %sil,(%rdi)
+  800eee:	74 0e                	je     800efe <memfind+0x1c>
+    for (; src < end; src++) {
+  800ef0:	48 83 c7 01          	add    $0x1,%rdi
+  800ef4:	48 39 f8             	cmp    %rdi,%rax
+  800ef7:	75 f2                	jne    800eeb <memfind+0x9>
+  800ef9:	c3                   	ret
+  800efa:	48 89 f8             	mov    %rdi,%rax
+  800efd:	c3                   	ret
+  800efe:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800f01:	c3                   	ret
+
+0000000000800f02 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800f02:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800f05:	0f b6 37             	movzbl (%rdi),%esi
+  800f08:	40 80 fe 20          	cmp    $0x20,%sil
+  800f0c:	74 06                	je     800f14 <strtol+0x12>
+  800f0e:	40 80 fe 09          	cmp    $0x9,%sil
+  800f12:	75 13                	jne    800f27 <strtol+0x25>
+  800f14:	48 83 c7 01          	add    $0x1,%rdi
+  800f18:	0f b6 37             	movzbl (%rdi),%esi
+  800f1b:	40 80 fe 20          	cmp    $0x20,%sil
+  800f1f:	74 f3                	je     800f14 <strtol+0x12>
+  800f21:	40 80 fe 09          	cmp    $0x9,%sil
+  800f25:	74 ed                	je     800f14 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800f27:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800f2a:	83 e0 fd             	and    $0xfffffffd,%eax
+  800f2d:	3c 01                	cmp    $0x1,%al
+  800f2f:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f33:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800f39:	75 0f                	jne    800f4a <strtol+0x48>
+  800f3b:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800f3e:	74 14                	je     800f54 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800f40:	85 d2                	test   %edx,%edx
+  800f42:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f47:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800f4a:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800f4f:	4c 63 ca             	movslq %edx,%r9
+  800f52:	eb 36                	jmp    800f8a <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f54:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800f58:	74 0f                	je     800f69 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800f5a:	85 d2                	test   %edx,%edx
+  800f5c:	75 ec                	jne    800f4a <strtol+0x48>
+        s++;
+  800f5e:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800f62:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800f67:	eb e1                	jmp    800f4a <strtol+0x48>
+        s += 2;
+  800f69:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800f6d:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800f72:	eb d6                	jmp    800f4a <strtol+0x48>
+            dig -= '0';
+  800f74:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800f77:	44 0f b6 c1          	movzbl %cl,%r8d
+  800f7b:	41 39 d0             	cmp    %edx,%r8d
+  800f7e:	7d 21                	jge    800fa1 <strtol+0x9f>
+        val = val * base + dig;
+  800f80:	49 0f af c1          	imul   %r9,%rax
+  800f84:	0f b6 c9             	movzbl %cl,%ecx
+  800f87:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800f8a:	48 83 c7 01          	add    $0x1,%rdi
+  800f8e:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800f92:	80 f9 39             	cmp    $0x39,%cl
+  800f95:	76 dd                	jbe    800f74 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800f97:	80 f9 7b             	cmp    $0x7b,%cl
+  800f9a:	77 05                	ja     800fa1 <strtol+0x9f>
+            dig -= 'a' - 10;
+  800f9c:	83 e9 57             	sub    $0x57,%ecx
+  800f9f:	eb d6                	jmp    800f77 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800fa1:	4d 85 d2             	test   %r10,%r10
+  800fa4:	74 03                	je     800fa9 <strtol+0xa7>
+  800fa6:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800fa9:	48 89 c2             	mov    %rax,%rdx
+  800fac:	48 f7 da             	neg    %rdx
+  800faf:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800fb3:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800fb7:	c3                   	ret
+
+0000000000800fb8 <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  800fb8:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800fbd:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fc2:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800fc8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800fce:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  800fd4:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800fd6:	c3                   	ret
+
+0000000000800fd7 <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  800fd7:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800fdc:	bf 00 00 00 00       	mov    $0x0,%edi
+  800fe1:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800fe6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800feb:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800ff1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800ff7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800ffd:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800fff:	c3                   	ret
+
+0000000000801000 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801000:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801003:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801008:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80100d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801012:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801018:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80101e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801024:	0f 05                	syscall
+    if (check && ret > 0) {
+  801026:	48 85 c0             	test   %rax,%rax
+  801029:	7f 01                	jg     80102c <sys_env_destroy+0x2c>
+}
+  80102b:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  80102c:	55                   	push   %rbp
+  80102d:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801030:	49 89 c0             	mov    %rax,%r8
+  801033:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801038:	48 ba 18 4d 80 00 00 	movabs $0x804d18,%rdx
+  80103f:	00 00 00 
+  801042:	be 29 00 00 00       	mov    $0x29,%esi
+  801047:	48 bf 37 4d 80 00 00 	movabs $0x804d37,%rdi
+  80104e:	00 00 00 
+  801051:	b8 00 00 00 00       	mov    $0x0,%eax
+  801056:	49 b9 0e 42 80 00 00 	movabs $0x80420e,%r9
+  80105d:	00 00 00 
+  801060:	41 ff d1             	call   *%r9
+
+0000000000801063 <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  801063:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801068:	bf 00 00 00 00       	mov    $0x0,%edi
+  80106d:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801072:	ba 00 00 00 00       	mov    $0x0,%edx
+  801077:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80107d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801083:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801089:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80108b:	c3                   	ret
+
+000000000080108c <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  80108c:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801091:	bf 00 00 00 00       	mov    $0x0,%edi
+  801096:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80109b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010a0:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8010a6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8010ac:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8010b2:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8010b4:	c3                   	ret
+
+00000000008010b5 <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  8010b5:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8010ba:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  8010c1:	00 00 00 
+  8010c4:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8010ca:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8010d0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8010d6:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8010d8:	c3                   	ret
+
+00000000008010d9 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8010d9:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  8010dc:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8010e1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8010e7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8010ed:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8010ef:	c3                   	ret
+
+00000000008010f0 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8010f0:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8010f3:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8010f8:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8010fb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801101:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801107:	0f 05                	syscall
+    if (check && ret > 0) {
+  801109:	48 85 c0             	test   %rax,%rax
+  80110c:	7f 01                	jg     80110f <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80110e:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80110f:	55                   	push   %rbp
+  801110:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801113:	49 89 c0             	mov    %rax,%r8
+  801116:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80111b:	48 ba 18 4d 80 00 00 	movabs $0x804d18,%rdx
+  801122:	00 00 00 
+  801125:	be 29 00 00 00       	mov    $0x29,%esi
+  80112a:	48 bf 37 4d 80 00 00 	movabs $0x804d37,%rdi
+  801131:	00 00 00 
+  801134:	b8 00 00 00 00       	mov    $0x0,%eax
+  801139:	49 b9 0e 42 80 00 00 	movabs $0x80420e,%r9
+  801140:	00 00 00 
+  801143:	41 ff d1             	call   *%r9
+
+0000000000801146 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801146:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801149:	48 63 d2             	movslq %edx,%rdx
+  80114c:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80114f:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801154:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  801157:	0f 05                	syscall
+    if (check && ret > 0) {
+  801159:	48 85 c0             	test   %rax,%rax
+  80115c:	7f 01                	jg     80115f <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80115e:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80115f:	55                   	push   %rbp
+  801160:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801163:	49 89 c0             	mov    %rax,%r8
+  801166:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80116b:	48 ba 18 4d 80 00 00 	movabs $0x804d18,%rdx
+  801172:	00 00 00 
+  801175:	be 29 00 00 00       	mov    $0x29,%esi
+  80117a:	48 bf 37 4d 80 00 00 	movabs $0x804d37,%rdi
+  801181:	00 00 00 
+  801184:	b8 00 00 00 00       	mov    $0x0,%eax
+  801189:	49 b9 0e 42 80 00 00 	movabs $0x80420e,%r9
+  801190:	00 00 00 
+  801193:	41 ff d1             	call   *%r9
+
+0000000000801196 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801196:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801199:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80119e:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8011a4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011aa:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8011b0:	0f 05                	syscall
+    if (check && ret > 0) {
+  8011b2:	48 85 c0             	test   %rax,%rax
+  8011b5:	7f 01                	jg     8011b8 <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8011b7:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8011b8:	55                   	push   %rbp
+  8011b9:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011bc:	49 89 c0             	mov    %rax,%r8
+  8011bf:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8011c4:	48 ba 18 4d 80 00 00 	movabs $0x804d18,%rdx
+  8011cb:	00 00 00 
+  8011ce:	be 29 00 00 00       	mov    $0x29,%esi
+  8011d3:	48 bf 37 4d 80 00 00 	movabs $0x804d37,%rdi
+  8011da:	00 00 00 
+  8011dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011e2:	49 b9 0e 42 80 00 00 	movabs $0x80420e,%r9
+  8011e9:	00 00 00 
+  8011ec:	41 ff d1             	call   *%r9
+
+00000000008011ef <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8011ef:	48 63 f6             	movslq %esi,%rsi
+  8011f2:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8011f5:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8011fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011ff:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801205:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80120b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801211:	0f 05                	syscall
+    if (check && ret > 0) {
+  801213:	48 85 c0             	test   %rax,%rax
+  801216:	7f 01                	jg     801219 <sys_env_set_status+0x2a>
+}
+  801218:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  801219:	55                   	push   %rbp
+  80121a:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80121d:	49 89 c0             	mov    %rax,%r8
+  801220:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801225:	48 ba 18 4d 80 00 00 	movabs $0x804d18,%rdx
+  80122c:	00 00 00 
+  80122f:	be 29 00 00 00       	mov    $0x29,%esi
+  801234:	48 bf 37 4d 80 00 00 	movabs $0x804d37,%rdi
+  80123b:	00 00 00 
+  80123e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801243:	49 b9 0e 42 80 00 00 	movabs $0x80420e,%r9
+  80124a:	00 00 00 
+  80124d:	41 ff d1             	call   *%r9
+
+0000000000801250 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801250:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801253:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801258:	ba 00 00 00 00       	mov    $0x0,%edx
+  80125d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801263:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801269:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80126f:	0f 05                	syscall
+    if (check && ret > 0) {
+  801271:	48 85 c0             	test   %rax,%rax
+  801274:	7f 01                	jg     801277 <sys_env_set_trapframe+0x27>
+}
+  801276:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801277:	55                   	push   %rbp
+  801278:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80127b:	49 89 c0             	mov    %rax,%r8
+  80127e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801283:	48 ba 18 4d 80 00 00 	movabs $0x804d18,%rdx
+  80128a:	00 00 00 
+  80128d:	be 29 00 00 00       	mov    $0x29,%esi
+  801292:	48 bf 37 4d 80 00 00 	movabs $0x804d37,%rdi
+  801299:	00 00 00 
+  80129c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012a1:	49 b9 0e 42 80 00 00 	movabs $0x80420e,%r9
+  8012a8:	00 00 00 
+  8012ab:	41 ff d1             	call   *%r9
+
+00000000008012ae <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8012ae:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8012b1:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8012b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012bb:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8012c1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8012c7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8012cd:	0f 05                	syscall
+    if (check && ret > 0) {
+  8012cf:	48 85 c0             	test   %rax,%rax
+  8012d2:	7f 01                	jg     8012d5 <sys_env_set_pgfault_upcall+0x27>
+}
+  8012d4:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8012d5:	55                   	push   %rbp
+  8012d6:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012d9:	49 89 c0             	mov    %rax,%r8
+  8012dc:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8012e1:	48 ba 18 4d 80 00 00 	movabs $0x804d18,%rdx
+  8012e8:	00 00 00 
+  8012eb:	be 29 00 00 00       	mov    $0x29,%esi
+  8012f0:	48 bf 37 4d 80 00 00 	movabs $0x804d37,%rdi
+  8012f7:	00 00 00 
+  8012fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012ff:	49 b9 0e 42 80 00 00 	movabs $0x80420e,%r9
+  801306:	00 00 00 
+  801309:	41 ff d1             	call   *%r9
+
+000000000080130c <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80130c:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80130f:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801312:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801317:	4d 63 c0             	movslq %r8d,%r8
+  80131a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801320:	0f 05                	syscall
+}
+  801322:	c3                   	ret
+
+0000000000801323 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801323:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801326:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801329:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80132e:	4d 63 c0             	movslq %r8d,%r8
+  801331:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801337:	0f 05                	syscall
+}
+  801339:	c3                   	ret
+
+000000000080133a <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  80133a:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80133f:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801342:	45 89 c0             	mov    %r8d,%r8d
+  801345:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80134b:	0f 05                	syscall
+    if (check && ret > 0) {
+  80134d:	48 85 c0             	test   %rax,%rax
+  801350:	7f 01                	jg     801353 <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801352:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  801353:	55                   	push   %rbp
+  801354:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801357:	49 89 c0             	mov    %rax,%r8
+  80135a:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  80135f:	48 ba 18 4d 80 00 00 	movabs $0x804d18,%rdx
+  801366:	00 00 00 
+  801369:	be 29 00 00 00       	mov    $0x29,%esi
+  80136e:	48 bf 37 4d 80 00 00 	movabs $0x804d37,%rdi
+  801375:	00 00 00 
+  801378:	b8 00 00 00 00       	mov    $0x0,%eax
+  80137d:	49 b9 0e 42 80 00 00 	movabs $0x80420e,%r9
+  801384:	00 00 00 
+  801387:	41 ff d1             	call   *%r9
+
+000000000080138a <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  80138a:	55                   	push   %rbp
+  80138b:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  80138e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801394:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801399:	ba 00 00 00 00       	mov    $0x0,%edx
+  80139e:	48 b8 3a 13 80 00 00 	movabs $0x80133a,%rax
+  8013a5:	00 00 00 
+  8013a8:	ff d0                	call   *%rax
+}
+  8013aa:	5d                   	pop    %rbp
+  8013ab:	c3                   	ret
+
+00000000008013ac <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  8013ac:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8013b1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8013b6:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8013bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013c0:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013c6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013cc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013d2:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8013d4:	c3                   	ret
+
+00000000008013d5 <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  8013d5:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8013da:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8013df:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013e4:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013ea:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013f0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013f6:	0f 05                	syscall
+    if (check && ret > 0) {
+  8013f8:	48 85 c0             	test   %rax,%rax
+  8013fb:	7f 01                	jg     8013fe <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  8013fd:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  8013fe:	55                   	push   %rbp
+  8013ff:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801402:	49 89 c0             	mov    %rax,%r8
+  801405:	b9 10 00 00 00       	mov    $0x10,%ecx
+  80140a:	48 ba 18 4d 80 00 00 	movabs $0x804d18,%rdx
+  801411:	00 00 00 
+  801414:	be 29 00 00 00       	mov    $0x29,%esi
+  801419:	48 bf 37 4d 80 00 00 	movabs $0x804d37,%rdi
+  801420:	00 00 00 
+  801423:	b8 00 00 00 00       	mov    $0x0,%eax
+  801428:	49 b9 0e 42 80 00 00 	movabs $0x80420e,%r9
+  80142f:	00 00 00 
+  801432:	41 ff d1             	call   *%r9
+
+0000000000801435 <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  801435:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80143a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80143f:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801444:	ba 00 00 00 00       	mov    $0x0,%edx
+  801449:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80144f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801455:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80145b:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  80145d:	c3                   	ret
+
+000000000080145e <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  80145e:	89 d2                	mov    %edx,%edx
+  801460:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  801462:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801467:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80146d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801473:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801479:	0f 05                	syscall
+}
+  80147b:	c3                   	ret
+
+000000000080147c <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  80147c:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  80147f:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801484:	ba 00 00 00 00       	mov    $0x0,%edx
+  801489:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80148f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801495:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80149b:	0f 05                	syscall
+}
+  80149d:	c3                   	ret
+
+000000000080149e <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  80149e:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  8014a1:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8014a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014ab:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014b1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014b7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8014bd:	0f 05                	syscall
+}
+  8014bf:	c3                   	ret
+
+00000000008014c0 <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  8014c0:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8014c3:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8014c8:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8014cd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014d2:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014d8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014de:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8014e4:	0f 05                	syscall
+    if (check && ret > 0) {
+  8014e6:	48 85 c0             	test   %rax,%rax
+  8014e9:	7f 01                	jg     8014ec <sys_irq_ack+0x2c>
+}
+  8014eb:	c3                   	ret
+sys_irq_ack(int irq) {
+  8014ec:	55                   	push   %rbp
+  8014ed:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014f0:	49 89 c0             	mov    %rax,%r8
+  8014f3:	b9 16 00 00 00       	mov    $0x16,%ecx
+  8014f8:	48 ba 18 4d 80 00 00 	movabs $0x804d18,%rdx
+  8014ff:	00 00 00 
+  801502:	be 29 00 00 00       	mov    $0x29,%esi
+  801507:	48 bf 37 4d 80 00 00 	movabs $0x804d37,%rdi
+  80150e:	00 00 00 
+  801511:	b8 00 00 00 00       	mov    $0x0,%eax
+  801516:	49 b9 0e 42 80 00 00 	movabs $0x80420e,%r9
+  80151d:	00 00 00 
+  801520:	41 ff d1             	call   *%r9
+
+0000000000801523 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801523:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80152a:	ff ff ff 
+  80152d:	48 01 f8             	add    %rdi,%rax
+  801530:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801534:	c3                   	ret
+
+0000000000801535 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801535:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80153c:	ff ff ff 
+  80153f:	48 01 f8             	add    %rdi,%rax
+  801542:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801546:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  80154c:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801550:	c3                   	ret
+
+0000000000801551 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801551:	55                   	push   %rbp
+  801552:	48 89 e5             	mov    %rsp,%rbp
+  801555:	41 57                	push   %r15
+  801557:	41 56                	push   %r14
+  801559:	41 55                	push   %r13
+  80155b:	41 54                	push   %r12
+  80155d:	53                   	push   %rbx
+  80155e:	48 83 ec 08          	sub    $0x8,%rsp
+  801562:	49 89 ff             	mov    %rdi,%r15
+  801565:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  80156a:	49 bd e0 3c 80 00 00 	movabs $0x803ce0,%r13
+  801571:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801574:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  80157a:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  80157d:	48 89 df             	mov    %rbx,%rdi
+  801580:	41 ff d5             	call   *%r13
+  801583:	83 e0 04             	and    $0x4,%eax
+  801586:	74 17                	je     80159f <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801588:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80158f:	4c 39 f3             	cmp    %r14,%rbx
+  801592:	75 e6                	jne    80157a <fd_alloc+0x29>
+  801594:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  80159a:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  80159f:	4d 89 27             	mov    %r12,(%r15)
+}
+  8015a2:	48 83 c4 08          	add    $0x8,%rsp
+  8015a6:	5b                   	pop    %rbx
+  8015a7:	41 5c                	pop    %r12
+  8015a9:	41 5d                	pop    %r13
+  8015ab:	41 5e                	pop    %r14
+  8015ad:	41 5f                	pop    %r15
+  8015af:	5d                   	pop    %rbp
+  8015b0:	c3                   	ret
+
+00000000008015b1 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8015b1:	83 ff 1f             	cmp    $0x1f,%edi
+  8015b4:	77 39                	ja     8015ef <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8015b6:	55                   	push   %rbp
+  8015b7:	48 89 e5             	mov    %rsp,%rbp
+  8015ba:	41 54                	push   %r12
+  8015bc:	53                   	push   %rbx
+  8015bd:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8015c0:	48 63 df             	movslq %edi,%rbx
+  8015c3:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8015ca:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8015ce:	48 89 df             	mov    %rbx,%rdi
+  8015d1:	48 b8 e0 3c 80 00 00 	movabs $0x803ce0,%rax
+  8015d8:	00 00 00 
+  8015db:	ff d0                	call   *%rax
+  8015dd:	a8 04                	test   $0x4,%al
+  8015df:	74 14                	je     8015f5 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8015e1:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8015e5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015ea:	5b                   	pop    %rbx
+  8015eb:	41 5c                	pop    %r12
+  8015ed:	5d                   	pop    %rbp
+  8015ee:	c3                   	ret
+        return -E_INVAL;
+  8015ef:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8015f4:	c3                   	ret
+        return -E_INVAL;
+  8015f5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015fa:	eb ee                	jmp    8015ea <fd_lookup+0x39>
+
+00000000008015fc <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8015fc:	55                   	push   %rbp
+  8015fd:	48 89 e5             	mov    %rsp,%rbp
+  801600:	41 54                	push   %r12
+  801602:	53                   	push   %rbx
+  801603:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801606:	48 b8 e0 4d 80 00 00 	movabs $0x804de0,%rax
+  80160d:	00 00 00 
+  801610:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  801617:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  80161a:	39 3b                	cmp    %edi,(%rbx)
+  80161c:	74 47                	je     801665 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  80161e:	48 83 c0 08          	add    $0x8,%rax
+  801622:	48 8b 18             	mov    (%rax),%rbx
+  801625:	48 85 db             	test   %rbx,%rbx
+  801628:	75 f0                	jne    80161a <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80162a:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801631:	00 00 00 
+  801634:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80163a:	89 fa                	mov    %edi,%edx
+  80163c:	48 bf 48 4d 80 00 00 	movabs $0x804d48,%rdi
+  801643:	00 00 00 
+  801646:	b8 00 00 00 00       	mov    $0x0,%eax
+  80164b:	48 b9 6c 02 80 00 00 	movabs $0x80026c,%rcx
+  801652:	00 00 00 
+  801655:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801657:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  80165c:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801660:	5b                   	pop    %rbx
+  801661:	41 5c                	pop    %r12
+  801663:	5d                   	pop    %rbp
+  801664:	c3                   	ret
+            return 0;
+  801665:	b8 00 00 00 00       	mov    $0x0,%eax
+  80166a:	eb f0                	jmp    80165c <dev_lookup+0x60>
+
+000000000080166c <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  80166c:	55                   	push   %rbp
+  80166d:	48 89 e5             	mov    %rsp,%rbp
+  801670:	41 55                	push   %r13
+  801672:	41 54                	push   %r12
+  801674:	53                   	push   %rbx
+  801675:	48 83 ec 18          	sub    $0x18,%rsp
+  801679:	48 89 fb             	mov    %rdi,%rbx
+  80167c:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80167f:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801686:	ff ff ff 
+  801689:	48 01 df             	add    %rbx,%rdi
+  80168c:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801690:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801694:	48 b8 b1 15 80 00 00 	movabs $0x8015b1,%rax
+  80169b:	00 00 00 
+  80169e:	ff d0                	call   *%rax
+  8016a0:	41 89 c5             	mov    %eax,%r13d
+  8016a3:	85 c0                	test   %eax,%eax
+  8016a5:	78 06                	js     8016ad <fd_close+0x41>
+  8016a7:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8016ab:	74 1a                	je     8016c7 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8016ad:	45 84 e4             	test   %r12b,%r12b
+  8016b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016b5:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8016b9:	44 89 e8             	mov    %r13d,%eax
+  8016bc:	48 83 c4 18          	add    $0x18,%rsp
+  8016c0:	5b                   	pop    %rbx
+  8016c1:	41 5c                	pop    %r12
+  8016c3:	41 5d                	pop    %r13
+  8016c5:	5d                   	pop    %rbp
+  8016c6:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8016c7:	8b 3b                	mov    (%rbx),%edi
+  8016c9:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8016cd:	48 b8 fc 15 80 00 00 	movabs $0x8015fc,%rax
+  8016d4:	00 00 00 
+  8016d7:	ff d0                	call   *%rax
+  8016d9:	41 89 c5             	mov    %eax,%r13d
+  8016dc:	85 c0                	test   %eax,%eax
+  8016de:	78 1b                	js     8016fb <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8016e0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8016e4:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8016e8:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8016ee:	48 85 c0             	test   %rax,%rax
+  8016f1:	74 08                	je     8016fb <fd_close+0x8f>
+  8016f3:	48 89 df             	mov    %rbx,%rdi
+  8016f6:	ff d0                	call   *%rax
+  8016f8:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8016fb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801700:	48 89 de             	mov    %rbx,%rsi
+  801703:	bf 00 00 00 00       	mov    $0x0,%edi
+  801708:	48 b8 96 11 80 00 00 	movabs $0x801196,%rax
+  80170f:	00 00 00 
+  801712:	ff d0                	call   *%rax
+    return res;
+  801714:	eb a3                	jmp    8016b9 <fd_close+0x4d>
+
+0000000000801716 <close>:
+
+int
+close(int fdnum) {
+  801716:	55                   	push   %rbp
+  801717:	48 89 e5             	mov    %rsp,%rbp
+  80171a:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80171e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801722:	48 b8 b1 15 80 00 00 	movabs $0x8015b1,%rax
+  801729:	00 00 00 
+  80172c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80172e:	85 c0                	test   %eax,%eax
+  801730:	78 15                	js     801747 <close+0x31>
+
+    return fd_close(fd, 1);
+  801732:	be 01 00 00 00       	mov    $0x1,%esi
+  801737:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80173b:	48 b8 6c 16 80 00 00 	movabs $0x80166c,%rax
+  801742:	00 00 00 
+  801745:	ff d0                	call   *%rax
+}
+  801747:	c9                   	leave
+  801748:	c3                   	ret
+
+0000000000801749 <close_all>:
+
+void
+close_all(void) {
+  801749:	55                   	push   %rbp
+  80174a:	48 89 e5             	mov    %rsp,%rbp
+  80174d:	41 54                	push   %r12
+  80174f:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801750:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801755:	49 bc 16 17 80 00 00 	movabs $0x801716,%r12
+  80175c:	00 00 00 
+  80175f:	89 df                	mov    %ebx,%edi
+  801761:	41 ff d4             	call   *%r12
+  801764:	83 c3 01             	add    $0x1,%ebx
+  801767:	83 fb 20             	cmp    $0x20,%ebx
+  80176a:	75 f3                	jne    80175f <close_all+0x16>
+}
+  80176c:	5b                   	pop    %rbx
+  80176d:	41 5c                	pop    %r12
+  80176f:	5d                   	pop    %rbp
+  801770:	c3                   	ret
+
+0000000000801771 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801771:	55                   	push   %rbp
+  801772:	48 89 e5             	mov    %rsp,%rbp
+  801775:	41 57                	push   %r15
+  801777:	41 56                	push   %r14
+  801779:	41 55                	push   %r13
+  80177b:	41 54                	push   %r12
+  80177d:	53                   	push   %rbx
+  80177e:	48 83 ec 18          	sub    $0x18,%rsp
+  801782:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801785:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801789:	48 b8 b1 15 80 00 00 	movabs $0x8015b1,%rax
+  801790:	00 00 00 
+  801793:	ff d0                	call   *%rax
+  801795:	89 c3                	mov    %eax,%ebx
+  801797:	85 c0                	test   %eax,%eax
+  801799:	0f 88 b8 00 00 00    	js     801857 <dup+0xe6>
+    close(newfdnum);
+  80179f:	44 89 e7             	mov    %r12d,%edi
+  8017a2:	48 b8 16 17 80 00 00 	movabs $0x801716,%rax
+  8017a9:	00 00 00 
+  8017ac:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8017ae:	4d 63 ec             	movslq %r12d,%r13
+  8017b1:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8017b8:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8017bc:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8017c0:	4c 89 ff             	mov    %r15,%rdi
+  8017c3:	49 be 35 15 80 00 00 	movabs $0x801535,%r14
+  8017ca:	00 00 00 
+  8017cd:	41 ff d6             	call   *%r14
+  8017d0:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8017d3:	4c 89 ef             	mov    %r13,%rdi
+  8017d6:	41 ff d6             	call   *%r14
+  8017d9:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8017dc:	48 89 df             	mov    %rbx,%rdi
+  8017df:	48 b8 e0 3c 80 00 00 	movabs $0x803ce0,%rax
+  8017e6:	00 00 00 
+  8017e9:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8017eb:	a8 04                	test   $0x4,%al
+  8017ed:	74 2b                	je     80181a <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8017ef:	41 89 c1             	mov    %eax,%r9d
+  8017f2:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8017f8:	4c 89 f1             	mov    %r14,%rcx
+  8017fb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801800:	48 89 de             	mov    %rbx,%rsi
+  801803:	bf 00 00 00 00       	mov    $0x0,%edi
+  801808:	48 b8 46 11 80 00 00 	movabs $0x801146,%rax
+  80180f:	00 00 00 
+  801812:	ff d0                	call   *%rax
+  801814:	89 c3                	mov    %eax,%ebx
+  801816:	85 c0                	test   %eax,%eax
+  801818:	78 4e                	js     801868 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  80181a:	4c 89 ff             	mov    %r15,%rdi
+  80181d:	48 b8 e0 3c 80 00 00 	movabs $0x803ce0,%rax
+  801824:	00 00 00 
+  801827:	ff d0                	call   *%rax
+  801829:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  80182c:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801832:	4c 89 e9             	mov    %r13,%rcx
+  801835:	ba 00 00 00 00       	mov    $0x0,%edx
+  80183a:	4c 89 fe             	mov    %r15,%rsi
+  80183d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801842:	48 b8 46 11 80 00 00 	movabs $0x801146,%rax
+  801849:	00 00 00 
+  80184c:	ff d0                	call   *%rax
+  80184e:	89 c3                	mov    %eax,%ebx
+  801850:	85 c0                	test   %eax,%eax
+  801852:	78 14                	js     801868 <dup+0xf7>
+
+    return newfdnum;
+  801854:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801857:	89 d8                	mov    %ebx,%eax
+  801859:	48 83 c4 18          	add    $0x18,%rsp
+  80185d:	5b                   	pop    %rbx
+  80185e:	41 5c                	pop    %r12
+  801860:	41 5d                	pop    %r13
+  801862:	41 5e                	pop    %r14
+  801864:	41 5f                	pop    %r15
+  801866:	5d                   	pop    %rbp
+  801867:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801868:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80186d:	4c 89 ee             	mov    %r13,%rsi
+  801870:	bf 00 00 00 00       	mov    $0x0,%edi
+  801875:	49 bc 96 11 80 00 00 	movabs $0x801196,%r12
+  80187c:	00 00 00 
+  80187f:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801882:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801887:	4c 89 f6             	mov    %r14,%rsi
+  80188a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80188f:	41 ff d4             	call   *%r12
+    return res;
+  801892:	eb c3                	jmp    801857 <dup+0xe6>
+
+0000000000801894 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801894:	55                   	push   %rbp
+  801895:	48 89 e5             	mov    %rsp,%rbp
+  801898:	41 56                	push   %r14
+  80189a:	41 55                	push   %r13
+  80189c:	41 54                	push   %r12
+  80189e:	53                   	push   %rbx
+  80189f:	48 83 ec 10          	sub    $0x10,%rsp
+  8018a3:	89 fb                	mov    %edi,%ebx
+  8018a5:	49 89 f4             	mov    %rsi,%r12
+  8018a8:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8018ab:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8018af:	48 b8 b1 15 80 00 00 	movabs $0x8015b1,%rax
+  8018b6:	00 00 00 
+  8018b9:	ff d0                	call   *%rax
+  8018bb:	85 c0                	test   %eax,%eax
+  8018bd:	78 4c                	js     80190b <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8018bf:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8018c3:	41 8b 3e             	mov    (%r14),%edi
+  8018c6:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8018ca:	48 b8 fc 15 80 00 00 	movabs $0x8015fc,%rax
+  8018d1:	00 00 00 
+  8018d4:	ff d0                	call   *%rax
+  8018d6:	85 c0                	test   %eax,%eax
+  8018d8:	78 35                	js     80190f <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8018da:	41 8b 46 08          	mov    0x8(%r14),%eax
+  8018de:	83 e0 03             	and    $0x3,%eax
+  8018e1:	83 f8 01             	cmp    $0x1,%eax
+  8018e4:	74 2d                	je     801913 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8018e6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8018ea:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8018ee:	48 85 c0             	test   %rax,%rax
+  8018f1:	74 56                	je     801949 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8018f3:	4c 89 ea             	mov    %r13,%rdx
+  8018f6:	4c 89 e6             	mov    %r12,%rsi
+  8018f9:	4c 89 f7             	mov    %r14,%rdi
+  8018fc:	ff d0                	call   *%rax
+}
+  8018fe:	48 83 c4 10          	add    $0x10,%rsp
+  801902:	5b                   	pop    %rbx
+  801903:	41 5c                	pop    %r12
+  801905:	41 5d                	pop    %r13
+  801907:	41 5e                	pop    %r14
+  801909:	5d                   	pop    %rbp
+  80190a:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80190b:	48 98                	cltq
+  80190d:	eb ef                	jmp    8018fe <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80190f:	48 98                	cltq
+  801911:	eb eb                	jmp    8018fe <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801913:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80191a:	00 00 00 
+  80191d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801923:	89 da                	mov    %ebx,%edx
+  801925:	48 bf 89 4d 80 00 00 	movabs $0x804d89,%rdi
+  80192c:	00 00 00 
+  80192f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801934:	48 b9 6c 02 80 00 00 	movabs $0x80026c,%rcx
+  80193b:	00 00 00 
+  80193e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801940:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801947:	eb b5                	jmp    8018fe <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801949:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801950:	eb ac                	jmp    8018fe <read+0x6a>
+
+0000000000801952 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801952:	55                   	push   %rbp
+  801953:	48 89 e5             	mov    %rsp,%rbp
+  801956:	41 57                	push   %r15
+  801958:	41 56                	push   %r14
+  80195a:	41 55                	push   %r13
+  80195c:	41 54                	push   %r12
+  80195e:	53                   	push   %rbx
+  80195f:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801963:	48 85 d2             	test   %rdx,%rdx
+  801966:	74 54                	je     8019bc <readn+0x6a>
+  801968:	41 89 fd             	mov    %edi,%r13d
+  80196b:	49 89 f6             	mov    %rsi,%r14
+  80196e:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801971:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801976:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  80197b:	49 bf 94 18 80 00 00 	movabs $0x801894,%r15
+  801982:	00 00 00 
+  801985:	4c 89 e2             	mov    %r12,%rdx
+  801988:	48 29 f2             	sub    %rsi,%rdx
+  80198b:	4c 01 f6             	add    %r14,%rsi
+  80198e:	44 89 ef             	mov    %r13d,%edi
+  801991:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801994:	85 c0                	test   %eax,%eax
+  801996:	78 20                	js     8019b8 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801998:	01 c3                	add    %eax,%ebx
+  80199a:	85 c0                	test   %eax,%eax
+  80199c:	74 08                	je     8019a6 <readn+0x54>
+  80199e:	48 63 f3             	movslq %ebx,%rsi
+  8019a1:	4c 39 e6             	cmp    %r12,%rsi
+  8019a4:	72 df                	jb     801985 <readn+0x33>
+    }
+    return res;
+  8019a6:	48 63 c3             	movslq %ebx,%rax
+}
+  8019a9:	48 83 c4 08          	add    $0x8,%rsp
+  8019ad:	5b                   	pop    %rbx
+  8019ae:	41 5c                	pop    %r12
+  8019b0:	41 5d                	pop    %r13
+  8019b2:	41 5e                	pop    %r14
+  8019b4:	41 5f                	pop    %r15
+  8019b6:	5d                   	pop    %rbp
+  8019b7:	c3                   	ret
+        if (inc < 0) return inc;
+  8019b8:	48 98                	cltq
+  8019ba:	eb ed                	jmp    8019a9 <readn+0x57>
+    int inc = 1, res = 0;
+  8019bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019c1:	eb e3                	jmp    8019a6 <readn+0x54>
+
+00000000008019c3 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8019c3:	55                   	push   %rbp
+  8019c4:	48 89 e5             	mov    %rsp,%rbp
+  8019c7:	41 56                	push   %r14
+  8019c9:	41 55                	push   %r13
+  8019cb:	41 54                	push   %r12
+  8019cd:	53                   	push   %rbx
+  8019ce:	48 83 ec 10          	sub    $0x10,%rsp
+  8019d2:	89 fb                	mov    %edi,%ebx
+  8019d4:	49 89 f4             	mov    %rsi,%r12
+  8019d7:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8019da:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8019de:	48 b8 b1 15 80 00 00 	movabs $0x8015b1,%rax
+  8019e5:	00 00 00 
+  8019e8:	ff d0                	call   *%rax
+  8019ea:	85 c0                	test   %eax,%eax
+  8019ec:	78 47                	js     801a35 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8019ee:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8019f2:	41 8b 3e             	mov    (%r14),%edi
+  8019f5:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8019f9:	48 b8 fc 15 80 00 00 	movabs $0x8015fc,%rax
+  801a00:	00 00 00 
+  801a03:	ff d0                	call   *%rax
+  801a05:	85 c0                	test   %eax,%eax
+  801a07:	78 30                	js     801a39 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801a09:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801a0e:	74 2d                	je     801a3d <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801a10:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a14:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801a18:	48 85 c0             	test   %rax,%rax
+  801a1b:	74 56                	je     801a73 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801a1d:	4c 89 ea             	mov    %r13,%rdx
+  801a20:	4c 89 e6             	mov    %r12,%rsi
+  801a23:	4c 89 f7             	mov    %r14,%rdi
+  801a26:	ff d0                	call   *%rax
+}
+  801a28:	48 83 c4 10          	add    $0x10,%rsp
+  801a2c:	5b                   	pop    %rbx
+  801a2d:	41 5c                	pop    %r12
+  801a2f:	41 5d                	pop    %r13
+  801a31:	41 5e                	pop    %r14
+  801a33:	5d                   	pop    %rbp
+  801a34:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a35:	48 98                	cltq
+  801a37:	eb ef                	jmp    801a28 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801a39:	48 98                	cltq
+  801a3b:	eb eb                	jmp    801a28 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801a3d:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801a44:	00 00 00 
+  801a47:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801a4d:	89 da                	mov    %ebx,%edx
+  801a4f:	48 bf a5 4d 80 00 00 	movabs $0x804da5,%rdi
+  801a56:	00 00 00 
+  801a59:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a5e:	48 b9 6c 02 80 00 00 	movabs $0x80026c,%rcx
+  801a65:	00 00 00 
+  801a68:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801a6a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801a71:	eb b5                	jmp    801a28 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801a73:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801a7a:	eb ac                	jmp    801a28 <write+0x65>
+
+0000000000801a7c <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801a7c:	55                   	push   %rbp
+  801a7d:	48 89 e5             	mov    %rsp,%rbp
+  801a80:	41 54                	push   %r12
+  801a82:	53                   	push   %rbx
+  801a83:	48 83 ec 10          	sub    $0x10,%rsp
+  801a87:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a89:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801a8d:	48 b8 b1 15 80 00 00 	movabs $0x8015b1,%rax
+  801a94:	00 00 00 
+  801a97:	ff d0                	call   *%rax
+  801a99:	85 c0                	test   %eax,%eax
+  801a9b:	78 3e                	js     801adb <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801a9d:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801aa1:	41 8b 3c 24          	mov    (%r12),%edi
+  801aa5:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801aa9:	48 b8 fc 15 80 00 00 	movabs $0x8015fc,%rax
+  801ab0:	00 00 00 
+  801ab3:	ff d0                	call   *%rax
+  801ab5:	85 c0                	test   %eax,%eax
+  801ab7:	78 22                	js     801adb <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  801ab9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801abd:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801ac1:	48 85 c0             	test   %rax,%rax
+  801ac4:	74 0b                	je     801ad1 <seek+0x55>
+  801ac6:	89 de                	mov    %ebx,%esi
+  801ac8:	4c 89 e7             	mov    %r12,%rdi
+  801acb:	ff d0                	call   *%rax
+  801acd:	85 c0                	test   %eax,%eax
+  801acf:	78 0a                	js     801adb <seek+0x5f>
+
+    fd->fd_offset = offset;
+  801ad1:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  801ad6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801adb:	48 83 c4 10          	add    $0x10,%rsp
+  801adf:	5b                   	pop    %rbx
+  801ae0:	41 5c                	pop    %r12
+  801ae2:	5d                   	pop    %rbp
+  801ae3:	c3                   	ret
+
+0000000000801ae4 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801ae4:	55                   	push   %rbp
+  801ae5:	48 89 e5             	mov    %rsp,%rbp
+  801ae8:	41 55                	push   %r13
+  801aea:	41 54                	push   %r12
+  801aec:	53                   	push   %rbx
+  801aed:	48 83 ec 18          	sub    $0x18,%rsp
+  801af1:	89 fb                	mov    %edi,%ebx
+  801af3:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801af6:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801afa:	48 b8 b1 15 80 00 00 	movabs $0x8015b1,%rax
+  801b01:	00 00 00 
+  801b04:	ff d0                	call   *%rax
+  801b06:	85 c0                	test   %eax,%eax
+  801b08:	78 38                	js     801b42 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b0a:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801b0e:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801b12:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801b16:	48 b8 fc 15 80 00 00 	movabs $0x8015fc,%rax
+  801b1d:	00 00 00 
+  801b20:	ff d0                	call   *%rax
+  801b22:	85 c0                	test   %eax,%eax
+  801b24:	78 1c                	js     801b42 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801b26:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801b2b:	74 20                	je     801b4d <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801b2d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b31:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801b35:	48 85 c0             	test   %rax,%rax
+  801b38:	74 47                	je     801b81 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801b3a:	44 89 e6             	mov    %r12d,%esi
+  801b3d:	4c 89 ef             	mov    %r13,%rdi
+  801b40:	ff d0                	call   *%rax
+}
+  801b42:	48 83 c4 18          	add    $0x18,%rsp
+  801b46:	5b                   	pop    %rbx
+  801b47:	41 5c                	pop    %r12
+  801b49:	41 5d                	pop    %r13
+  801b4b:	5d                   	pop    %rbp
+  801b4c:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801b4d:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801b54:	00 00 00 
+  801b57:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801b5d:	89 da                	mov    %ebx,%edx
+  801b5f:	48 bf 68 4d 80 00 00 	movabs $0x804d68,%rdi
+  801b66:	00 00 00 
+  801b69:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b6e:	48 b9 6c 02 80 00 00 	movabs $0x80026c,%rcx
+  801b75:	00 00 00 
+  801b78:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801b7a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b7f:	eb c1                	jmp    801b42 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801b81:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801b86:	eb ba                	jmp    801b42 <ftruncate+0x5e>
+
+0000000000801b88 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801b88:	55                   	push   %rbp
+  801b89:	48 89 e5             	mov    %rsp,%rbp
+  801b8c:	41 54                	push   %r12
+  801b8e:	53                   	push   %rbx
+  801b8f:	48 83 ec 10          	sub    $0x10,%rsp
+  801b93:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b96:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801b9a:	48 b8 b1 15 80 00 00 	movabs $0x8015b1,%rax
+  801ba1:	00 00 00 
+  801ba4:	ff d0                	call   *%rax
+  801ba6:	85 c0                	test   %eax,%eax
+  801ba8:	78 4e                	js     801bf8 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801baa:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801bae:	41 8b 3c 24          	mov    (%r12),%edi
+  801bb2:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801bb6:	48 b8 fc 15 80 00 00 	movabs $0x8015fc,%rax
+  801bbd:	00 00 00 
+  801bc0:	ff d0                	call   *%rax
+  801bc2:	85 c0                	test   %eax,%eax
+  801bc4:	78 32                	js     801bf8 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801bc6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801bca:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801bcf:	74 30                	je     801c01 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801bd1:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801bd4:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801bdb:	00 00 00 
+    stat->st_isdir = 0;
+  801bde:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801be5:	00 00 00 
+    stat->st_dev = dev;
+  801be8:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801bef:	48 89 de             	mov    %rbx,%rsi
+  801bf2:	4c 89 e7             	mov    %r12,%rdi
+  801bf5:	ff 50 28             	call   *0x28(%rax)
+}
+  801bf8:	48 83 c4 10          	add    $0x10,%rsp
+  801bfc:	5b                   	pop    %rbx
+  801bfd:	41 5c                	pop    %r12
+  801bff:	5d                   	pop    %rbp
+  801c00:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801c01:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801c06:	eb f0                	jmp    801bf8 <fstat+0x70>
+
+0000000000801c08 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801c08:	55                   	push   %rbp
+  801c09:	48 89 e5             	mov    %rsp,%rbp
+  801c0c:	41 54                	push   %r12
+  801c0e:	53                   	push   %rbx
+  801c0f:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801c12:	be 00 00 00 00       	mov    $0x0,%esi
+  801c17:	48 b8 76 2d 80 00 00 	movabs $0x802d76,%rax
+  801c1e:	00 00 00 
+  801c21:	ff d0                	call   *%rax
+  801c23:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801c25:	85 c0                	test   %eax,%eax
+  801c27:	78 25                	js     801c4e <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801c29:	4c 89 e6             	mov    %r12,%rsi
+  801c2c:	89 c7                	mov    %eax,%edi
+  801c2e:	48 b8 88 1b 80 00 00 	movabs $0x801b88,%rax
+  801c35:	00 00 00 
+  801c38:	ff d0                	call   *%rax
+  801c3a:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801c3d:	89 df                	mov    %ebx,%edi
+  801c3f:	48 b8 16 17 80 00 00 	movabs $0x801716,%rax
+  801c46:	00 00 00 
+  801c49:	ff d0                	call   *%rax
+
+    return res;
+  801c4b:	44 89 e3             	mov    %r12d,%ebx
+}
+  801c4e:	89 d8                	mov    %ebx,%eax
+  801c50:	5b                   	pop    %rbx
+  801c51:	41 5c                	pop    %r12
+  801c53:	5d                   	pop    %rbp
+  801c54:	c3                   	ret
+
+0000000000801c55 <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  801c55:	48 b8 08 00 82 00 00 	movabs $0x820008,%rax
+  801c5c:	00 00 00 
+  801c5f:	83 38 00             	cmpl   $0x0,(%rax)
+  801c62:	74 0a                	je     801c6e <fsenv+0x19>
+    return envid;
+}
+  801c64:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  801c6b:	00 00 
+  801c6d:	c3                   	ret
+fsenv(void) {
+  801c6e:	55                   	push   %rbp
+  801c6f:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  801c72:	bf 03 00 00 00       	mov    $0x3,%edi
+  801c77:	48 b8 e6 46 80 00 00 	movabs $0x8046e6,%rax
+  801c7e:	00 00 00 
+  801c81:	ff d0                	call   *%rax
+  801c83:	a3 08 00 82 00 00 00 	movabs %eax,0x820008
+  801c8a:	00 00 
+}
+  801c8c:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  801c93:	00 00 
+  801c95:	5d                   	pop    %rbp
+  801c96:	c3                   	ret
+
+0000000000801c97 <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  801c97:	55                   	push   %rbp
+  801c98:	48 89 e5             	mov    %rsp,%rbp
+  801c9b:	41 54                	push   %r12
+  801c9d:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  801c9e:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801ca3:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801ca8:	48 89 de             	mov    %rbx,%rsi
+  801cab:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cb0:	48 b8 96 11 80 00 00 	movabs $0x801196,%rax
+  801cb7:	00 00 00 
+  801cba:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  801cbc:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  801cc3:	00 00 00 
+  801cc6:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  801ccc:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801cd1:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801cd6:	48 89 de             	mov    %rbx,%rsi
+  801cd9:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cde:	48 b8 f0 10 80 00 00 	movabs $0x8010f0,%rax
+  801ce5:	00 00 00 
+  801ce8:	ff d0                	call   *%rax
+  801cea:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  801cec:	85 c0                	test   %eax,%eax
+  801cee:	0f 88 a2 00 00 00    	js     801d96 <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  801cf4:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801cfb:	00 00 00 
+  801cfe:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801d04:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801d09:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  801d0b:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  801d10:	49 bc a8 3e 80 00 00 	movabs $0x803ea8,%r12
+  801d17:	00 00 00 
+  801d1a:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  801d1d:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  801d22:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  801d25:	48 b8 55 1c 80 00 00 	movabs $0x801c55,%rax
+  801d2c:	00 00 00 
+  801d2f:	ff d0                	call   *%rax
+  801d31:	89 c7                	mov    %eax,%edi
+  801d33:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  801d39:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  801d3e:	48 89 da             	mov    %rbx,%rdx
+  801d41:	be 09 00 00 00       	mov    $0x9,%esi
+  801d46:	48 b8 90 46 80 00 00 	movabs $0x804690,%rax
+  801d4d:	00 00 00 
+  801d50:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  801d52:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801d57:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d5c:	be 00 00 00 00       	mov    $0x0,%esi
+  801d61:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d66:	48 b8 6c 46 80 00 00 	movabs $0x80466c,%rax
+  801d6d:	00 00 00 
+  801d70:	ff d0                	call   *%rax
+  801d72:	89 c3                	mov    %eax,%ebx
+  801d74:	85 c0                	test   %eax,%eax
+  801d76:	78 25                	js     801d9d <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  801d78:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801d7f:	00 00 00 
+  801d82:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801d88:	a3 00 26 82 00 00 00 	movabs %eax,0x822600
+  801d8f:	00 00 
+    return 0;
+  801d91:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  801d96:	89 d8                	mov    %ebx,%eax
+  801d98:	5b                   	pop    %rbx
+  801d99:	41 5c                	pop    %r12
+  801d9b:	5d                   	pop    %rbp
+  801d9c:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  801d9d:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801da2:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  801da7:	bf 00 00 00 00       	mov    $0x0,%edi
+  801dac:	48 b8 96 11 80 00 00 	movabs $0x801196,%rax
+  801db3:	00 00 00 
+  801db6:	ff d0                	call   *%rax
+        return res;
+  801db8:	eb dc                	jmp    801d96 <fschan_setup+0xff>
+
+0000000000801dba <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  801dba:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  801dc1:	00 00 00 
+  801dc4:	80 38 00             	cmpb   $0x0,(%rax)
+  801dc7:	74 55                	je     801e1e <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801dc9:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801dd0:	00 00 00 
+  801dd3:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  801dd9:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801dde:	48 ba 00 26 82 00 00 	movabs $0x822600,%rdx
+  801de5:	00 00 00 
+  801de8:	3b 0a                	cmp    (%rdx),%ecx
+  801dea:	75 01                	jne    801ded <fschan+0x33>
+}
+  801dec:	c3                   	ret
+fschan(void) {
+  801ded:	55                   	push   %rbp
+  801dee:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801df1:	48 b8 97 1c 80 00 00 	movabs $0x801c97,%rax
+  801df8:	00 00 00 
+  801dfb:	ff d0                	call   *%rax
+  801dfd:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  801dff:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801e04:	85 d2                	test   %edx,%edx
+  801e06:	78 02                	js     801e0a <fschan+0x50>
+}
+  801e08:	5d                   	pop    %rbp
+  801e09:	c3                   	ret
+        fschan_enabled = 0;
+  801e0a:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  801e11:	00 00 00 
+  801e14:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  801e17:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e1c:	eb ea                	jmp    801e08 <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  801e1e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e23:	c3                   	ret
+
+0000000000801e24 <fbuf>:
+fbuf(struct Fd *fd) {
+  801e24:	55                   	push   %rbp
+  801e25:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  801e28:	48 b8 23 15 80 00 00 	movabs $0x801523,%rax
+  801e2f:	00 00 00 
+  801e32:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  801e34:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e39:	48 83 f8 1f          	cmp    $0x1f,%rax
+  801e3d:	77 12                	ja     801e51 <fbuf+0x2d>
+  801e3f:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  801e43:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  801e4a:	00 00 00 
+  801e4d:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  801e51:	48 89 d0             	mov    %rdx,%rax
+  801e54:	5d                   	pop    %rbp
+  801e55:	c3                   	ret
+
+0000000000801e56 <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  801e56:	55                   	push   %rbp
+  801e57:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  801e5a:	48 83 c7 40          	add    $0x40,%rdi
+  801e5e:	48 b8 e2 3e 80 00 00 	movabs $0x803ee2,%rax
+  801e65:	00 00 00 
+  801e68:	ff d0                	call   *%rax
+  801e6a:	84 c0                	test   %al,%al
+  801e6c:	75 02                	jne    801e70 <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  801e6e:	5d                   	pop    %rbp
+  801e6f:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  801e70:	48 b8 55 1c 80 00 00 	movabs $0x801c55,%rax
+  801e77:	00 00 00 
+  801e7a:	ff d0                	call   *%rax
+  801e7c:	89 c7                	mov    %eax,%edi
+  801e7e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e84:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e89:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e8e:	be 0a 00 00 00       	mov    $0xa,%esi
+  801e93:	48 b8 90 46 80 00 00 	movabs $0x804690,%rax
+  801e9a:	00 00 00 
+  801e9d:	ff d0                	call   *%rax
+}
+  801e9f:	eb cd                	jmp    801e6e <fschan_publish+0x18>
+
+0000000000801ea1 <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  801ea1:	55                   	push   %rbp
+  801ea2:	48 89 e5             	mov    %rsp,%rbp
+  801ea5:	41 57                	push   %r15
+  801ea7:	41 56                	push   %r14
+  801ea9:	41 55                	push   %r13
+  801eab:	41 54                	push   %r12
+  801ead:	53                   	push   %rbx
+  801eae:	48 83 ec 48          	sub    $0x48,%rsp
+  801eb2:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801eb6:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  801eba:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  801ebd:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  801ec1:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  801ec4:	48 ba 04 00 82 00 00 	movabs $0x820004,%rdx
+  801ecb:	00 00 00 
+  801ece:	8b 02                	mov    (%rdx),%eax
+  801ed0:	83 c0 01             	add    $0x1,%eax
+  801ed3:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801ed8:	0f 44 c1             	cmove  %ecx,%eax
+  801edb:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  801edd:	4d 85 c0             	test   %r8,%r8
+  801ee0:	74 2c                	je     801f0e <fschan_rw+0x6d>
+  801ee2:	45 89 ce             	mov    %r9d,%r14d
+  801ee5:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  801eec:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  801ef0:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801ef6:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  801efd:	00 
+  801efe:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801f04:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f09:	e9 41 01 00 00       	jmp    80204f <fschan_rw+0x1ae>
+  801f0e:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  801f12:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801f16:	e9 9c 01 00 00       	jmp    8020b7 <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  801f1b:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  801f1f:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  801f22:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  801f25:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  801f28:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  801f2c:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  801f30:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  801f34:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  801f38:	48 89 da             	mov    %rbx,%rdx
+  801f3b:	48 b8 f2 0d 80 00 00 	movabs $0x800df2,%rax
+  801f42:	00 00 00 
+  801f45:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  801f47:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801f4b:	48 b8 56 1e 80 00 00 	movabs $0x801e56,%rax
+  801f52:	00 00 00 
+  801f55:	ff d0                	call   *%rax
+            queued += blk;
+  801f57:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  801f5a:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  801f5e:	4d 39 fc             	cmp    %r15,%r12
+  801f61:	73 6b                	jae    801fce <fschan_rw+0x12d>
+  801f63:	41 83 fd 0f          	cmp    $0xf,%r13d
+  801f67:	77 65                	ja     801fce <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  801f69:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f6d:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  801f71:	48 b8 bd 3e 80 00 00 	movabs $0x803ebd,%rax
+  801f78:	00 00 00 
+  801f7b:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  801f7d:	4c 89 fb             	mov    %r15,%rbx
+  801f80:	4c 29 e3             	sub    %r12,%rbx
+  801f83:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  801f88:	48 39 d3             	cmp    %rdx,%rbx
+  801f8b:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  801f8f:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  801f93:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  801f97:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  801f9b:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  801f9e:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  801fa0:	48 b9 04 00 82 00 00 	movabs $0x820004,%rcx
+  801fa7:	00 00 00 
+  801faa:	8b 09                	mov    (%rcx),%ecx
+  801fac:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  801faf:	83 fe 03             	cmp    $0x3,%esi
+  801fb2:	0f 85 63 ff ff ff    	jne    801f1b <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  801fb8:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801fbc:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  801fbf:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  801fc2:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  801fc5:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  801fc9:	e9 79 ff ff ff       	jmp    801f47 <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  801fce:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801fd2:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  801fd9:	48 89 df             	mov    %rbx,%rdi
+  801fdc:	48 b8 80 3f 80 00 00 	movabs $0x803f80,%rax
+  801fe3:	00 00 00 
+  801fe6:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  801fe8:	48 89 df             	mov    %rbx,%rdi
+  801feb:	48 b8 0e 3f 80 00 00 	movabs $0x803f0e,%rax
+  801ff2:	00 00 00 
+  801ff5:	ff d0                	call   *%rax
+  801ff7:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  801ffb:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  801fff:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  802003:	75 25                	jne    80202a <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  802005:	8b 40 04             	mov    0x4(%rax),%eax
+  802008:	85 c0                	test   %eax,%eax
+  80200a:	0f 88 86 00 00 00    	js     802096 <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  802010:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  802014:	74 5b                	je     802071 <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  802016:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  80201a:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  80201e:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  802022:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  802026:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  80202a:	48 89 df             	mov    %rbx,%rdi
+  80202d:	48 b8 35 3f 80 00 00 	movabs $0x803f35,%rax
+  802034:	00 00 00 
+  802037:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  802039:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  80203d:	83 f0 01             	xor    $0x1,%eax
+  802040:	4d 39 fc             	cmp    %r15,%r12
+  802043:	0f 92 c2             	setb   %dl
+  802046:	84 c2                	test   %al,%dl
+  802048:	75 05                	jne    80204f <fschan_rw+0x1ae>
+  80204a:	45 85 ed             	test   %r13d,%r13d
+  80204d:	74 50                	je     80209f <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  80204f:	4d 39 fc             	cmp    %r15,%r12
+  802052:	0f 92 c1             	setb   %cl
+  802055:	41 83 fd 0f          	cmp    $0xf,%r13d
+  802059:	0f 96 c2             	setbe  %dl
+  80205c:	84 d1                	test   %dl,%cl
+  80205e:	0f 84 6a ff ff ff    	je     801fce <fschan_rw+0x12d>
+  802064:	84 c0                	test   %al,%al
+  802066:	0f 85 fd fe ff ff    	jne    801f69 <fschan_rw+0xc8>
+  80206c:	e9 5d ff ff ff       	jmp    801fce <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  802071:	48 63 d0             	movslq %eax,%rdx
+  802074:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802078:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  80207c:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802080:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  802084:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  802088:	48 b8 f2 0d 80 00 00 	movabs $0x800df2,%rax
+  80208f:	00 00 00 
+  802092:	ff d0                	call   *%rax
+  802094:	eb 80                	jmp    802016 <fschan_rw+0x175>
+                err = msg->fm_res;
+  802096:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  802099:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  80209d:	eb 8b                	jmp    80202a <fschan_rw+0x189>
+    return done || !err ? done : err;
+  80209f:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  8020a4:	0f 85 68 fe ff ff    	jne    801f12 <fschan_rw+0x71>
+  8020aa:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  8020ad:	85 c0                	test   %eax,%eax
+  8020af:	0f 84 5d fe ff ff    	je     801f12 <fschan_rw+0x71>
+  8020b5:	48 98                	cltq
+}
+  8020b7:	48 83 c4 48          	add    $0x48,%rsp
+  8020bb:	5b                   	pop    %rbx
+  8020bc:	41 5c                	pop    %r12
+  8020be:	41 5d                	pop    %r13
+  8020c0:	41 5e                	pop    %r14
+  8020c2:	41 5f                	pop    %r15
+  8020c4:	5d                   	pop    %rbp
+  8020c5:	c3                   	ret
+
+00000000008020c6 <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  8020c6:	55                   	push   %rbp
+  8020c7:	48 89 e5             	mov    %rsp,%rbp
+  8020ca:	41 56                	push   %r14
+  8020cc:	41 55                	push   %r13
+  8020ce:	41 54                	push   %r12
+  8020d0:	53                   	push   %rbx
+  8020d1:	48 83 ec 10          	sub    $0x10,%rsp
+  8020d5:	49 89 fe             	mov    %rdi,%r14
+  8020d8:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  8020db:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  8020df:	48 29 f3             	sub    %rsi,%rbx
+  8020e2:	48 39 d3             	cmp    %rdx,%rbx
+  8020e5:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  8020e9:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8020f0:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  8020f1:	bf 00 10 00 00       	mov    $0x1000,%edi
+  8020f6:	49 bd 3f 3d 80 00 00 	movabs $0x803d3f,%r13
+  8020fd:	00 00 00 
+  802100:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  802107:	76 1e                	jbe    802127 <mmap_fault+0x61>
+  802109:	4c 01 e7             	add    %r12,%rdi
+  80210c:	41 ff d5             	call   *%r13
+  80210f:	84 c0                	test   %al,%al
+  802111:	75 14                	jne    802127 <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  802113:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802117:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  80211e:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  802122:	48 39 df             	cmp    %rbx,%rdi
+  802125:	72 e2                	jb     802109 <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  802127:	48 bb 00 10 82 00 00 	movabs $0x821000,%rbx
+  80212e:	00 00 00 
+  802131:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  802138:	00 00 00 
+  80213b:	4c 89 f0             	mov    %r14,%rax
+  80213e:	48 29 d0             	sub    %rdx,%rax
+  802141:	48 c1 f8 03          	sar    $0x3,%rax
+  802145:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  80214c:	aa aa aa 
+  80214f:	48 0f af c2          	imul   %rdx,%rax
+  802153:	48 c1 e0 0c          	shl    $0xc,%rax
+  802157:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  80215c:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  802160:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  802162:	44 89 e0             	mov    %r12d,%eax
+  802165:	41 03 46 10          	add    0x10(%r14),%eax
+  802169:	41 2b 06             	sub    (%r14),%eax
+  80216c:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  80216f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802173:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  802177:	41 8b 46 14          	mov    0x14(%r14),%eax
+  80217b:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  80217e:	48 b8 55 1c 80 00 00 	movabs $0x801c55,%rax
+  802185:	00 00 00 
+  802188:	ff d0                	call   *%rax
+  80218a:	89 c7                	mov    %eax,%edi
+  80218c:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802192:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802197:	48 89 da             	mov    %rbx,%rdx
+  80219a:	be 0f 00 00 00       	mov    $0xf,%esi
+  80219f:	48 b8 90 46 80 00 00 	movabs $0x804690,%rax
+  8021a6:	00 00 00 
+  8021a9:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  8021ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021b0:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8021b4:	4c 89 e6             	mov    %r12,%rsi
+  8021b7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021bc:	48 b8 6c 46 80 00 00 	movabs $0x80466c,%rax
+  8021c3:	00 00 00 
+  8021c6:	ff d0                	call   *%rax
+  8021c8:	48 98                	cltq
+}
+  8021ca:	48 83 c4 10          	add    $0x10,%rsp
+  8021ce:	5b                   	pop    %rbx
+  8021cf:	41 5c                	pop    %r12
+  8021d1:	41 5d                	pop    %r13
+  8021d3:	41 5e                	pop    %r14
+  8021d5:	5d                   	pop    %rbp
+  8021d6:	c3                   	ret
+
+00000000008021d7 <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  8021d7:	48 8b 37             	mov    (%rdi),%rsi
+  8021da:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  8021e1:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  8021e8:	00 00 00 
+  8021eb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021f0:	eb 0f                	jmp    802201 <mmap_pgfault+0x2a>
+  8021f2:	c3                   	ret
+  8021f3:	48 83 c1 01          	add    $0x1,%rcx
+  8021f7:	48 83 c2 18          	add    $0x18,%rdx
+  8021fb:	48 83 f9 20          	cmp    $0x20,%rcx
+  8021ff:	74 6e                	je     80226f <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  802201:	48 8b 02             	mov    (%rdx),%rax
+  802204:	48 83 e8 01          	sub    $0x1,%rax
+  802208:	48 39 f0             	cmp    %rsi,%rax
+  80220b:	73 e6                	jae    8021f3 <mmap_pgfault+0x1c>
+  80220d:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  802211:	73 e0                	jae    8021f3 <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  802213:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  802217:	b8 00 00 00 00       	mov    $0x0,%eax
+  80221c:	f6 c2 01             	test   $0x1,%dl
+  80221f:	75 d1                	jne    8021f2 <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  802221:	f6 c2 02             	test   $0x2,%dl
+  802224:	74 1a                	je     802240 <mmap_pgfault+0x69>
+  802226:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  80222a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80222f:	48 bf 00 20 82 00 00 	movabs $0x822000,%rdi
+  802236:	00 00 00 
+  802239:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  80223e:	74 35                	je     802275 <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  802240:	55                   	push   %rbp
+  802241:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  802244:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  802248:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  80224f:	00 00 00 
+  802252:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  802256:	ba 00 00 01 00       	mov    $0x10000,%edx
+  80225b:	48 b8 c6 20 80 00 00 	movabs $0x8020c6,%rax
+  802262:	00 00 00 
+  802265:	ff d0                	call   *%rax
+  802267:	48 85 c0             	test   %rax,%rax
+  80226a:	0f 9f c0             	setg   %al
+}
+  80226d:	5d                   	pop    %rbp
+  80226e:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  80226f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802274:	c3                   	ret
+}
+  802275:	c3                   	ret
+
+0000000000802276 <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  802276:	55                   	push   %rbp
+  802277:	48 89 e5             	mov    %rsp,%rbp
+  80227a:	41 54                	push   %r12
+  80227c:	53                   	push   %rbx
+  80227d:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802280:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  802287:	00 00 00 
+  80228a:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  80228f:	48 83 38 00          	cmpq   $0x0,(%rax)
+  802293:	74 15                	je     8022aa <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802295:	48 83 c3 01          	add    $0x1,%rbx
+  802299:	48 83 c0 18          	add    $0x18,%rax
+  80229d:	48 83 fb 20          	cmp    $0x20,%rbx
+  8022a1:	75 ec                	jne    80228f <mmap_alloc+0x19>
+    return NULL;
+  8022a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022a8:	eb 52                	jmp    8022fc <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  8022aa:	4c 89 e7             	mov    %r12,%rdi
+  8022ad:	48 b8 e0 3c 80 00 00 	movabs $0x803ce0,%rax
+  8022b4:	00 00 00 
+  8022b7:	ff d0                	call   *%rax
+  8022b9:	41 89 c1             	mov    %eax,%r9d
+  8022bc:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  8022c3:	48 c1 e1 0c          	shl    $0xc,%rcx
+  8022c7:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8022cd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022d2:	4c 89 e6             	mov    %r12,%rsi
+  8022d5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022da:	48 b8 46 11 80 00 00 	movabs $0x801146,%rax
+  8022e1:	00 00 00 
+  8022e4:	ff d0                	call   *%rax
+  8022e6:	85 c0                	test   %eax,%eax
+  8022e8:	78 17                	js     802301 <mmap_alloc+0x8b>
+        return &mmaps[i];
+  8022ea:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  8022ee:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8022f5:	00 00 00 
+  8022f8:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  8022fc:	5b                   	pop    %rbx
+  8022fd:	41 5c                	pop    %r12
+  8022ff:	5d                   	pop    %rbp
+  802300:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  802301:	b8 00 00 00 00       	mov    $0x0,%eax
+  802306:	eb f4                	jmp    8022fc <mmap_alloc+0x86>
+
+0000000000802308 <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  802308:	55                   	push   %rbp
+  802309:	48 89 e5             	mov    %rsp,%rbp
+  80230c:	41 56                	push   %r14
+  80230e:	41 55                	push   %r13
+  802310:	41 54                	push   %r12
+  802312:	53                   	push   %rbx
+  802313:	48 83 ec 10          	sub    $0x10,%rsp
+  802317:	41 89 fc             	mov    %edi,%r12d
+  80231a:	49 89 f5             	mov    %rsi,%r13
+  80231d:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  802320:	48 89 f0             	mov    %rsi,%rax
+  802323:	48 09 d0             	or     %rdx,%rax
+  802326:	75 0d                	jne    802335 <fsipc+0x2d>
+  802328:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  80232b:	83 f8 04             	cmp    $0x4,%eax
+  80232e:	76 7d                	jbe    8023ad <fsipc+0xa5>
+  802330:	83 ff 0d             	cmp    $0xd,%edi
+  802333:	74 78                	je     8023ad <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  802335:	48 b8 55 1c 80 00 00 	movabs $0x801c55,%rax
+  80233c:	00 00 00 
+  80233f:	ff d0                	call   *%rax
+  802341:	89 c7                	mov    %eax,%edi
+  802343:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  80234a:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  802351:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  802358:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80235e:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802365:	00 00 00 
+  802368:	44 89 e6             	mov    %r12d,%esi
+  80236b:	48 b8 90 46 80 00 00 	movabs $0x804690,%rax
+  802372:	00 00 00 
+  802375:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  802377:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  80237e:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  80237f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802384:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802388:	4c 89 ee             	mov    %r13,%rsi
+  80238b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802390:	48 b8 6c 46 80 00 00 	movabs $0x80466c,%rax
+  802397:	00 00 00 
+  80239a:	ff d0                	call   *%rax
+  80239c:	89 c3                	mov    %eax,%ebx
+}
+  80239e:	89 d8                	mov    %ebx,%eax
+  8023a0:	48 83 c4 10          	add    $0x10,%rsp
+  8023a4:	5b                   	pop    %rbx
+  8023a5:	41 5c                	pop    %r12
+  8023a7:	41 5d                	pop    %r13
+  8023a9:	41 5e                	pop    %r14
+  8023ab:	5d                   	pop    %rbp
+  8023ac:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  8023ad:	48 b8 ba 1d 80 00 00 	movabs $0x801dba,%rax
+  8023b4:	00 00 00 
+  8023b7:	ff d0                	call   *%rax
+  8023b9:	49 89 c6             	mov    %rax,%r14
+  8023bc:	48 85 c0             	test   %rax,%rax
+  8023bf:	0f 84 70 ff ff ff    	je     802335 <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  8023c5:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  8023c9:	48 b8 bd 3e 80 00 00 	movabs $0x803ebd,%rax
+  8023d0:	00 00 00 
+  8023d3:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  8023d5:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  8023d8:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  8023df:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  8023e3:	ba 10 00 00 00       	mov    $0x10,%edx
+  8023e8:	48 be 00 00 83 00 00 	movabs $0x830000,%rsi
+  8023ef:	00 00 00 
+  8023f2:	48 b8 f2 0d 80 00 00 	movabs $0x800df2,%rax
+  8023f9:	00 00 00 
+  8023fc:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  8023fe:	4c 89 f7             	mov    %r14,%rdi
+  802401:	48 b8 56 1e 80 00 00 	movabs $0x801e56,%rax
+  802408:	00 00 00 
+  80240b:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  80240d:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  802414:	4c 89 f7             	mov    %r14,%rdi
+  802417:	48 b8 80 3f 80 00 00 	movabs $0x803f80,%rax
+  80241e:	00 00 00 
+  802421:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  802423:	4c 89 f7             	mov    %r14,%rdi
+  802426:	48 b8 0e 3f 80 00 00 	movabs $0x803f0e,%rax
+  80242d:	00 00 00 
+  802430:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  802432:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  802435:	41 83 fc 05          	cmp    $0x5,%r12d
+  802439:	75 04                	jne    80243f <fsipc+0x137>
+  80243b:	85 db                	test   %ebx,%ebx
+  80243d:	79 14                	jns    802453 <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  80243f:	4c 89 f7             	mov    %r14,%rdi
+  802442:	48 b8 35 3f 80 00 00 	movabs $0x803f35,%rax
+  802449:	00 00 00 
+  80244c:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  80244e:	e9 4b ff ff ff       	jmp    80239e <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  802453:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  802457:	ba 88 00 00 00       	mov    $0x88,%edx
+  80245c:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  802463:	00 00 00 
+  802466:	48 b8 f2 0d 80 00 00 	movabs $0x800df2,%rax
+  80246d:	00 00 00 
+  802470:	ff d0                	call   *%rax
+  802472:	eb cb                	jmp    80243f <fsipc+0x137>
+
+0000000000802474 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  802474:	55                   	push   %rbp
+  802475:	48 89 e5             	mov    %rsp,%rbp
+  802478:	41 57                	push   %r15
+  80247a:	41 56                	push   %r14
+  80247c:	41 55                	push   %r13
+  80247e:	41 54                	push   %r12
+  802480:	53                   	push   %rbx
+  802481:	48 83 ec 18          	sub    $0x18,%rsp
+  802485:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  802489:	49 89 f6             	mov    %rsi,%r14
+  80248c:	49 89 d4             	mov    %rdx,%r12
+  80248f:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  802492:	48 b8 ba 1d 80 00 00 	movabs $0x801dba,%rax
+  802499:	00 00 00 
+  80249c:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  80249e:	48 85 c0             	test   %rax,%rax
+  8024a1:	0f 85 96 00 00 00    	jne    80253d <devfile_write_direct+0xc9>
+    size_t write = 0;
+  8024a7:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8024ae:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8024af:	49 bf 00 00 83 00 00 	movabs $0x830000,%r15
+  8024b6:	00 00 00 
+    while (n) {
+  8024b9:	4d 85 e4             	test   %r12,%r12
+  8024bc:	74 79                	je     802537 <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  8024be:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  8024c3:	49 39 dc             	cmp    %rbx,%r12
+  8024c6:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  8024ca:	48 89 da             	mov    %rbx,%rdx
+  8024cd:	4c 89 f6             	mov    %r14,%rsi
+  8024d0:	48 bf 00 10 83 00 00 	movabs $0x831000,%rdi
+  8024d7:	00 00 00 
+  8024da:	48 b8 f2 0d 80 00 00 	movabs $0x800df2,%rax
+  8024e1:	00 00 00 
+  8024e4:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8024e6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8024ea:	8b 40 0c             	mov    0xc(%rax),%eax
+  8024ed:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  8024f0:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8024f3:	44 01 e8             	add    %r13d,%eax
+  8024f6:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  8024fa:	41 0f 44 c5          	cmove  %r13d,%eax
+  8024fe:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  802502:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  802506:	48 89 da             	mov    %rbx,%rdx
+  802509:	be 00 00 00 00       	mov    $0x0,%esi
+  80250e:	bf 04 00 00 00       	mov    $0x4,%edi
+  802513:	48 b8 08 23 80 00 00 	movabs $0x802308,%rax
+  80251a:	00 00 00 
+  80251d:	ff d0                	call   *%rax
+        if (res < 0)
+  80251f:	85 c0                	test   %eax,%eax
+  802521:	78 4a                	js     80256d <devfile_write_direct+0xf9>
+        buf += res;
+  802523:	48 98                	cltq
+  802525:	49 01 c6             	add    %rax,%r14
+        write += res;
+  802528:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  80252c:	49 29 c4             	sub    %rax,%r12
+  80252f:	75 8d                	jne    8024be <devfile_write_direct+0x4a>
+    return write;
+  802531:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802535:	eb 27                	jmp    80255e <devfile_write_direct+0xea>
+    size_t write = 0;
+  802537:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  80253b:	eb f4                	jmp    802531 <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  80253d:	45 89 e9             	mov    %r13d,%r9d
+  802540:	4d 89 e0             	mov    %r12,%r8
+  802543:	4c 89 f1             	mov    %r14,%rcx
+  802546:	ba 04 00 00 00       	mov    $0x4,%edx
+  80254b:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80254f:	48 89 c7             	mov    %rax,%rdi
+  802552:	48 b8 a1 1e 80 00 00 	movabs $0x801ea1,%rax
+  802559:	00 00 00 
+  80255c:	ff d0                	call   *%rax
+}
+  80255e:	48 83 c4 18          	add    $0x18,%rsp
+  802562:	5b                   	pop    %rbx
+  802563:	41 5c                	pop    %r12
+  802565:	41 5d                	pop    %r13
+  802567:	41 5e                	pop    %r14
+  802569:	41 5f                	pop    %r15
+  80256b:	5d                   	pop    %rbp
+  80256c:	c3                   	ret
+            return res;
+  80256d:	48 98                	cltq
+  80256f:	eb ed                	jmp    80255e <devfile_write_direct+0xea>
+
+0000000000802571 <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  802571:	55                   	push   %rbp
+  802572:	48 89 e5             	mov    %rsp,%rbp
+  802575:	41 54                	push   %r12
+  802577:	53                   	push   %rbx
+  802578:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  80257b:	48 b8 24 1e 80 00 00 	movabs $0x801e24,%rax
+  802582:	00 00 00 
+  802585:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  802587:	48 85 c0             	test   %rax,%rax
+  80258a:	74 71                	je     8025fd <fbuf_flush+0x8c>
+  80258c:	48 89 c3             	mov    %rax,%rbx
+  80258f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802594:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  802598:	75 05                	jne    80259f <fbuf_flush+0x2e>
+}
+  80259a:	5b                   	pop    %rbx
+  80259b:	41 5c                	pop    %r12
+  80259d:	5d                   	pop    %rbp
+  80259e:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  80259f:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  8025a2:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  8025a6:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8025ad:	00 00 00 
+  8025b0:	48 89 de             	mov    %rbx,%rsi
+  8025b3:	48 29 c6             	sub    %rax,%rsi
+  8025b6:	48 c1 fe 03          	sar    $0x3,%rsi
+  8025ba:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8025c1:	aa aa aa 
+  8025c4:	48 0f af f0          	imul   %rax,%rsi
+  8025c8:	48 c1 e6 0e          	shl    $0xe,%rsi
+  8025cc:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  8025d1:	48 01 c6             	add    %rax,%rsi
+  8025d4:	4c 89 e7             	mov    %r12,%rdi
+  8025d7:	48 b8 74 24 80 00 00 	movabs $0x802474,%rax
+  8025de:	00 00 00 
+  8025e1:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  8025e3:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  8025e7:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  8025ee:	00 
+    return res < 0 ? res : 0;
+  8025ef:	48 85 c0             	test   %rax,%rax
+  8025f2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025f7:	48 0f 4f c2          	cmovg  %rdx,%rax
+  8025fb:	eb 9d                	jmp    80259a <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  8025fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802602:	eb 96                	jmp    80259a <fbuf_flush+0x29>
+
+0000000000802604 <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  802604:	55                   	push   %rbp
+  802605:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  802608:	48 b8 71 25 80 00 00 	movabs $0x802571,%rax
+  80260f:	00 00 00 
+  802612:	ff d0                	call   *%rax
+}
+  802614:	5d                   	pop    %rbp
+  802615:	c3                   	ret
+
+0000000000802616 <devfile_write>:
+    if (!fd || !buf)
+  802616:	48 85 ff             	test   %rdi,%rdi
+  802619:	0f 84 d3 01 00 00    	je     8027f2 <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80261f:	55                   	push   %rbp
+  802620:	48 89 e5             	mov    %rsp,%rbp
+  802623:	41 57                	push   %r15
+  802625:	41 56                	push   %r14
+  802627:	41 55                	push   %r13
+  802629:	41 54                	push   %r12
+  80262b:	53                   	push   %rbx
+  80262c:	48 83 ec 08          	sub    $0x8,%rsp
+  802630:	49 89 fc             	mov    %rdi,%r12
+  802633:	49 89 f6             	mov    %rsi,%r14
+  802636:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  802639:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  80263e:	48 85 f6             	test   %rsi,%rsi
+  802641:	0f 84 9c 01 00 00    	je     8027e3 <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  802647:	48 b8 24 1e 80 00 00 	movabs $0x801e24,%rax
+  80264e:	00 00 00 
+  802651:	ff d0                	call   *%rax
+  802653:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  802656:	48 85 c0             	test   %rax,%rax
+  802659:	0f 84 a2 00 00 00    	je     802701 <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  80265f:	be 00 10 00 00       	mov    $0x1000,%esi
+  802664:	4c 89 e7             	mov    %r12,%rdi
+  802667:	48 b8 b5 10 80 00 00 	movabs $0x8010b5,%rax
+  80266e:	00 00 00 
+  802671:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  802673:	83 f8 02             	cmp    $0x2,%eax
+  802676:	0f 8f 85 00 00 00    	jg     802701 <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  80267c:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802683:	00 00 00 
+  802686:	4d 89 ef             	mov    %r13,%r15
+  802689:	49 29 c7             	sub    %rax,%r15
+  80268c:	49 c1 ff 03          	sar    $0x3,%r15
+  802690:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802697:	aa aa aa 
+  80269a:	4c 0f af f8          	imul   %rax,%r15
+  80269e:	49 c1 e7 0e          	shl    $0xe,%r15
+  8026a2:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  8026a7:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  8026aa:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  8026af:	0f 84 d7 00 00 00    	je     80278c <devfile_write+0x176>
+  8026b5:	49 8b 45 10          	mov    0x10(%r13),%rax
+  8026b9:	89 c2                	mov    %eax,%edx
+  8026bb:	41 03 55 0c          	add    0xc(%r13),%edx
+  8026bf:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  8026c4:	75 0f                	jne    8026d5 <devfile_write+0xbf>
+  8026c6:	48 01 d8             	add    %rbx,%rax
+  8026c9:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  8026cf:	0f 86 92 00 00 00    	jbe    802767 <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  8026d5:	4c 89 e7             	mov    %r12,%rdi
+  8026d8:	48 b8 71 25 80 00 00 	movabs $0x802571,%rax
+  8026df:	00 00 00 
+  8026e2:	ff d0                	call   *%rax
+  8026e4:	85 c0                	test   %eax,%eax
+  8026e6:	78 52                	js     80273a <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  8026e8:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  8026ef:	77 7f                	ja     802770 <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  8026f1:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  8026f6:	0f 85 c2 00 00 00    	jne    8027be <devfile_write+0x1a8>
+  8026fc:	e9 94 00 00 00       	jmp    802795 <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  802701:	4c 89 e7             	mov    %r12,%rdi
+  802704:	48 b8 71 25 80 00 00 	movabs $0x802571,%rax
+  80270b:	00 00 00 
+  80270e:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802710:	85 c0                	test   %eax,%eax
+  802712:	79 07                	jns    80271b <devfile_write+0x105>
+  802714:	48 98                	cltq
+  802716:	e9 c8 00 00 00       	jmp    8027e3 <devfile_write+0x1cd>
+  80271b:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802720:	48 89 da             	mov    %rbx,%rdx
+  802723:	4c 89 f6             	mov    %r14,%rsi
+  802726:	4c 89 e7             	mov    %r12,%rdi
+  802729:	48 b8 74 24 80 00 00 	movabs $0x802474,%rax
+  802730:	00 00 00 
+  802733:	ff d0                	call   *%rax
+  802735:	e9 a9 00 00 00       	jmp    8027e3 <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  80273a:	48 98                	cltq
+  80273c:	e9 a2 00 00 00       	jmp    8027e3 <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802741:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802746:	ba 00 40 00 00       	mov    $0x4000,%edx
+  80274b:	4c 89 fe             	mov    %r15,%rsi
+  80274e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802753:	48 b8 f0 10 80 00 00 	movabs $0x8010f0,%rax
+  80275a:	00 00 00 
+  80275d:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  80275f:	85 c0                	test   %eax,%eax
+  802761:	79 45                	jns    8027a8 <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802763:	48 98                	cltq
+  802765:	eb 7c                	jmp    8027e3 <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802767:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  80276e:	76 4e                	jbe    8027be <devfile_write+0x1a8>
+  802770:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802775:	48 89 da             	mov    %rbx,%rdx
+  802778:	4c 89 f6             	mov    %r14,%rsi
+  80277b:	4c 89 e7             	mov    %r12,%rdi
+  80277e:	48 b8 74 24 80 00 00 	movabs $0x802474,%rax
+  802785:	00 00 00 
+  802788:	ff d0                	call   *%rax
+  80278a:	eb 57                	jmp    8027e3 <devfile_write+0x1cd>
+  80278c:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802793:	77 db                	ja     802770 <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  802795:	4c 89 ff             	mov    %r15,%rdi
+  802798:	48 b8 3f 3d 80 00 00 	movabs $0x803d3f,%rax
+  80279f:	00 00 00 
+  8027a2:	ff d0                	call   *%rax
+  8027a4:	84 c0                	test   %al,%al
+  8027a6:	74 99                	je     802741 <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  8027a8:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  8027ad:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8027b2:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  8027b6:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  8027bd:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  8027be:	4c 89 ff             	mov    %r15,%rdi
+  8027c1:	49 03 7d 10          	add    0x10(%r13),%rdi
+  8027c5:	48 89 da             	mov    %rbx,%rdx
+  8027c8:	4c 89 f6             	mov    %r14,%rsi
+  8027cb:	48 b8 f2 0d 80 00 00 	movabs $0x800df2,%rax
+  8027d2:	00 00 00 
+  8027d5:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  8027d7:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  8027db:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  8027e0:	48 89 d8             	mov    %rbx,%rax
+}
+  8027e3:	48 83 c4 08          	add    $0x8,%rsp
+  8027e7:	5b                   	pop    %rbx
+  8027e8:	41 5c                	pop    %r12
+  8027ea:	41 5d                	pop    %r13
+  8027ec:	41 5e                	pop    %r14
+  8027ee:	41 5f                	pop    %r15
+  8027f0:	5d                   	pop    %rbp
+  8027f1:	c3                   	ret
+        return E_INVAL;
+  8027f2:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  8027f7:	c3                   	ret
+
+00000000008027f8 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8027f8:	55                   	push   %rbp
+  8027f9:	48 89 e5             	mov    %rsp,%rbp
+  8027fc:	41 54                	push   %r12
+  8027fe:	53                   	push   %rbx
+  8027ff:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  802802:	48 b8 71 25 80 00 00 	movabs $0x802571,%rax
+  802809:	00 00 00 
+  80280c:	ff d0                	call   *%rax
+  80280e:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  802811:	48 89 df             	mov    %rbx,%rdi
+  802814:	48 b8 24 1e 80 00 00 	movabs $0x801e24,%rax
+  80281b:	00 00 00 
+  80281e:	ff d0                	call   *%rax
+  802820:	48 85 c0             	test   %rax,%rax
+  802823:	74 17                	je     80283c <devfile_flush+0x44>
+  802825:	48 89 df             	mov    %rbx,%rdi
+  802828:	48 b8 24 1e 80 00 00 	movabs $0x801e24,%rax
+  80282f:	00 00 00 
+  802832:	ff d0                	call   *%rax
+  802834:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  80283b:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80283c:	8b 43 0c             	mov    0xc(%rbx),%eax
+  80283f:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  802846:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  802848:	ba 00 00 00 00       	mov    $0x0,%edx
+  80284d:	be 00 00 00 00       	mov    $0x0,%esi
+  802852:	bf 06 00 00 00       	mov    $0x6,%edi
+  802857:	48 b8 08 23 80 00 00 	movabs $0x802308,%rax
+  80285e:	00 00 00 
+  802861:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802863:	45 85 e4             	test   %r12d,%r12d
+  802866:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  80286a:	5b                   	pop    %rbx
+  80286b:	41 5c                	pop    %r12
+  80286d:	5d                   	pop    %rbp
+  80286e:	c3                   	ret
+
+000000000080286f <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  80286f:	55                   	push   %rbp
+  802870:	48 89 e5             	mov    %rsp,%rbp
+  802873:	41 57                	push   %r15
+  802875:	41 56                	push   %r14
+  802877:	41 55                	push   %r13
+  802879:	41 54                	push   %r12
+  80287b:	53                   	push   %rbx
+  80287c:	48 83 ec 38          	sub    $0x38,%rsp
+  802880:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  802884:	49 89 f7             	mov    %rsi,%r15
+  802887:	48 89 d3             	mov    %rdx,%rbx
+  80288a:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  80288d:	48 b8 ba 1d 80 00 00 	movabs $0x801dba,%rax
+  802894:	00 00 00 
+  802897:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802899:	48 85 c0             	test   %rax,%rax
+  80289c:	75 20                	jne    8028be <devfile_read_direct+0x4f>
+    bool map = 1;
+  80289e:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  8028a3:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  8028aa:	00 
+    while (n) {
+  8028ab:	48 85 db             	test   %rbx,%rbx
+  8028ae:	0f 85 df 00 00 00    	jne    802993 <devfile_read_direct+0x124>
+    size_t read = 0;
+  8028b4:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  8028b8:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8028bc:	eb 21                	jmp    8028df <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  8028be:	45 89 f1             	mov    %r14d,%r9d
+  8028c1:	49 89 d8             	mov    %rbx,%r8
+  8028c4:	4c 89 f9             	mov    %r15,%rcx
+  8028c7:	ba 03 00 00 00       	mov    $0x3,%edx
+  8028cc:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  8028d0:	48 89 c7             	mov    %rax,%rdi
+  8028d3:	48 b8 a1 1e 80 00 00 	movabs $0x801ea1,%rax
+  8028da:	00 00 00 
+  8028dd:	ff d0                	call   *%rax
+}
+  8028df:	48 83 c4 38          	add    $0x38,%rsp
+  8028e3:	5b                   	pop    %rbx
+  8028e4:	41 5c                	pop    %r12
+  8028e6:	41 5d                	pop    %r13
+  8028e8:	41 5e                	pop    %r14
+  8028ea:	41 5f                	pop    %r15
+  8028ec:	5d                   	pop    %rbp
+  8028ed:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  8028ee:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8028f2:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  8028f8:	75 1e                	jne    802918 <devfile_read_direct+0xa9>
+  8028fa:	e9 e2 00 00 00       	jmp    8029e1 <devfile_read_direct+0x172>
+            if (!res) return read;
+  8028ff:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802903:	eb da                	jmp    8028df <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  802905:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  802909:	0f 85 d0 01 00 00    	jne    802adf <devfile_read_direct+0x270>
+            map = 0;
+  80290f:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802913:	eb 03                	jmp    802918 <devfile_read_direct+0xa9>
+  802915:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802918:	ba 00 00 01 00       	mov    $0x10000,%edx
+  80291d:	48 39 d3             	cmp    %rdx,%rbx
+  802920:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802924:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802928:	8b 40 0c             	mov    0xc(%rax),%eax
+  80292b:	48 b9 00 00 83 00 00 	movabs $0x830000,%rcx
+  802932:	00 00 00 
+  802935:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  802937:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  80293b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  80293f:	be 00 00 00 00       	mov    $0x0,%esi
+  802944:	bf 03 00 00 00       	mov    $0x3,%edi
+  802949:	48 b8 08 23 80 00 00 	movabs $0x802308,%rax
+  802950:	00 00 00 
+  802953:	ff d0                	call   *%rax
+        if (res <= 0)
+  802955:	85 c0                	test   %eax,%eax
+  802957:	0f 8e 63 01 00 00    	jle    802ac0 <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  80295d:	4c 63 e0             	movslq %eax,%r12
+  802960:	4c 89 e2             	mov    %r12,%rdx
+  802963:	48 be 00 10 83 00 00 	movabs $0x831000,%rsi
+  80296a:	00 00 00 
+  80296d:	4c 89 ff             	mov    %r15,%rdi
+  802970:	48 b8 f2 0d 80 00 00 	movabs $0x800df2,%rax
+  802977:	00 00 00 
+  80297a:	ff d0                	call   *%rax
+        buf += res;
+  80297c:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  80297f:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  802982:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  802986:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  80298a:	48 85 db             	test   %rbx,%rbx
+  80298d:	0f 84 25 ff ff ff    	je     8028b8 <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  802993:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  802996:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  80299a:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  80299e:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  8029a2:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  8029a9:	0f 97 c2             	seta   %dl
+  8029ac:	20 c2                	and    %al,%dl
+  8029ae:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  8029b1:	0f 84 5e ff ff ff    	je     802915 <devfile_read_direct+0xa6>
+  8029b7:	4c 89 fa             	mov    %r15,%rdx
+  8029ba:	4d 89 fd             	mov    %r15,%r13
+  8029bd:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  8029c4:	0f 85 4e ff ff ff    	jne    802918 <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  8029ca:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8029ce:	0f 84 1a ff ff ff    	je     8028ee <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  8029d4:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  8029db:	0f 85 37 ff ff ff    	jne    802918 <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  8029e1:	48 89 d8             	mov    %rbx,%rax
+  8029e4:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8029ea:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  8029ef:	48 39 c8             	cmp    %rcx,%rax
+  8029f2:	48 0f 47 c1          	cmova  %rcx,%rax
+  8029f6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  8029fa:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  8029fe:	49 89 d4             	mov    %rdx,%r12
+  802a01:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  802a05:	48 b8 e0 3c 80 00 00 	movabs $0x803ce0,%rax
+  802a0c:	00 00 00 
+  802a0f:	ff d0                	call   *%rax
+  802a11:	a8 40                	test   $0x40,%al
+  802a13:	0f 85 b9 00 00 00    	jne    802ad2 <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  802a19:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  802a20:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a24:	49 39 c5             	cmp    %rax,%r13
+  802a27:	72 d8                	jb     802a01 <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802a29:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802a2d:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802a34:	00 00 00 
+  802a37:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802a3b:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  802a3e:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  802a40:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  802a44:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  802a48:	48 b8 55 1c 80 00 00 	movabs $0x801c55,%rax
+  802a4f:	00 00 00 
+  802a52:	ff d0                	call   *%rax
+  802a54:	89 c7                	mov    %eax,%edi
+  802a56:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802a5c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802a61:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802a68:	00 00 00 
+  802a6b:	be 0e 00 00 00       	mov    $0xe,%esi
+  802a70:	48 b8 90 46 80 00 00 	movabs $0x804690,%rax
+  802a77:	00 00 00 
+  802a7a:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  802a7c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a81:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802a85:	4c 89 fe             	mov    %r15,%rsi
+  802a88:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a8d:	48 b8 6c 46 80 00 00 	movabs $0x80466c,%rax
+  802a94:	00 00 00 
+  802a97:	ff d0                	call   *%rax
+  802a99:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  802a9c:	48 85 d2             	test   %rdx,%rdx
+  802a9f:	0f 84 5a fe ff ff    	je     8028ff <devfile_read_direct+0x90>
+            if (res > 0) {
+  802aa5:	0f 8e 5a fe ff ff    	jle    802905 <devfile_read_direct+0x96>
+                buf += res;
+  802aab:	48 98                	cltq
+  802aad:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  802ab0:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  802ab3:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  802ab7:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  802abb:	e9 ca fe ff ff       	jmp    80298a <devfile_read_direct+0x11b>
+            return res ? res : read;
+  802ac0:	41 89 c5             	mov    %eax,%r13d
+  802ac3:	48 98                	cltq
+  802ac5:	45 85 ed             	test   %r13d,%r13d
+  802ac8:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  802acd:	e9 0d fe ff ff       	jmp    8028df <devfile_read_direct+0x70>
+            map = 0;
+  802ad2:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802ad6:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802ada:	e9 39 fe ff ff       	jmp    802918 <devfile_read_direct+0xa9>
+  802adf:	48 89 d0             	mov    %rdx,%rax
+  802ae2:	e9 f8 fd ff ff       	jmp    8028df <devfile_read_direct+0x70>
+
+0000000000802ae7 <devfile_read>:
+    if (!fd || !buf)
+  802ae7:	48 85 ff             	test   %rdi,%rdi
+  802aea:	0f 84 21 02 00 00    	je     802d11 <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802af0:	55                   	push   %rbp
+  802af1:	48 89 e5             	mov    %rsp,%rbp
+  802af4:	41 57                	push   %r15
+  802af6:	41 56                	push   %r14
+  802af8:	41 55                	push   %r13
+  802afa:	41 54                	push   %r12
+  802afc:	53                   	push   %rbx
+  802afd:	48 83 ec 28          	sub    $0x28,%rsp
+  802b01:	48 89 fb             	mov    %rdi,%rbx
+  802b04:	49 89 f4             	mov    %rsi,%r12
+  802b07:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  802b0a:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802b0f:	48 85 f6             	test   %rsi,%rsi
+  802b12:	74 4b                	je     802b5f <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  802b14:	48 b8 24 1e 80 00 00 	movabs $0x801e24,%rax
+  802b1b:	00 00 00 
+  802b1e:	ff d0                	call   *%rax
+  802b20:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802b23:	48 85 c0             	test   %rax,%rax
+  802b26:	74 22                	je     802b4a <devfile_read+0x63>
+  802b28:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  802b2f:	77 19                	ja     802b4a <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802b31:	be 00 10 00 00       	mov    $0x1000,%esi
+  802b36:	48 89 df             	mov    %rbx,%rdi
+  802b39:	48 b8 b5 10 80 00 00 	movabs $0x8010b5,%rax
+  802b40:	00 00 00 
+  802b43:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802b45:	83 f8 02             	cmp    $0x2,%eax
+  802b48:	7e 40                	jle    802b8a <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  802b4a:	48 89 df             	mov    %rbx,%rdi
+  802b4d:	48 b8 71 25 80 00 00 	movabs $0x802571,%rax
+  802b54:	00 00 00 
+  802b57:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802b59:	85 c0                	test   %eax,%eax
+  802b5b:	79 11                	jns    802b6e <devfile_read+0x87>
+  802b5d:	48 98                	cltq
+}
+  802b5f:	48 83 c4 28          	add    $0x28,%rsp
+  802b63:	5b                   	pop    %rbx
+  802b64:	41 5c                	pop    %r12
+  802b66:	41 5d                	pop    %r13
+  802b68:	41 5e                	pop    %r14
+  802b6a:	41 5f                	pop    %r15
+  802b6c:	5d                   	pop    %rbp
+  802b6d:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802b6e:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802b73:	4c 89 ea             	mov    %r13,%rdx
+  802b76:	4c 89 e6             	mov    %r12,%rsi
+  802b79:	48 89 df             	mov    %rbx,%rdi
+  802b7c:	48 b8 6f 28 80 00 00 	movabs $0x80286f,%rax
+  802b83:	00 00 00 
+  802b86:	ff d0                	call   *%rax
+  802b88:	eb d5                	jmp    802b5f <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  802b8a:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802b8e:	48 89 df             	mov    %rbx,%rdi
+  802b91:	48 b8 71 25 80 00 00 	movabs $0x802571,%rax
+  802b98:	00 00 00 
+  802b9b:	ff d0                	call   *%rax
+  802b9d:	85 c0                	test   %eax,%eax
+  802b9f:	0f 88 33 01 00 00    	js     802cd8 <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  802ba5:	48 ba 00 23 82 00 00 	movabs $0x822300,%rdx
+  802bac:	00 00 00 
+  802baf:	4c 89 f0             	mov    %r14,%rax
+  802bb2:	48 29 d0             	sub    %rdx,%rax
+  802bb5:	48 c1 f8 03          	sar    $0x3,%rax
+  802bb9:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  802bc0:	aa aa aa 
+  802bc3:	48 0f af c2          	imul   %rdx,%rax
+  802bc7:	48 c1 e0 0e          	shl    $0xe,%rax
+  802bcb:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  802bcf:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802bd2:	41 39 06             	cmp    %eax,(%r14)
+  802bd5:	75 0d                	jne    802be4 <devfile_read+0xfd>
+  802bd7:	8b 43 10             	mov    0x10(%rbx),%eax
+  802bda:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  802bde:	0f 84 fb 00 00 00    	je     802cdf <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  802be4:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802be9:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802bed:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  802bf0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802bf4:	48 89 c7             	mov    %rax,%rdi
+  802bf7:	48 b8 3f 3d 80 00 00 	movabs $0x803d3f,%rax
+  802bfe:	00 00 00 
+  802c01:	ff d0                	call   *%rax
+  802c03:	84 c0                	test   %al,%al
+  802c05:	75 27                	jne    802c2e <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802c07:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802c0c:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802c11:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802c15:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c1a:	48 b8 f0 10 80 00 00 	movabs $0x8010f0,%rax
+  802c21:	00 00 00 
+  802c24:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  802c26:	85 c0                	test   %eax,%eax
+  802c28:	0f 88 dc 00 00 00    	js     802d0a <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  802c2e:	44 89 f8             	mov    %r15d,%eax
+  802c31:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802c36:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  802c38:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  802c3f:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  802c40:	8b 43 10             	mov    0x10(%rbx),%eax
+  802c43:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  802c47:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  802c4a:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802c4f:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802c53:	48 89 df             	mov    %rbx,%rdi
+  802c56:	48 b8 6f 28 80 00 00 	movabs $0x80286f,%rax
+  802c5d:	00 00 00 
+  802c60:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  802c62:	48 85 c0             	test   %rax,%rax
+  802c65:	0f 88 f4 fe ff ff    	js     802b5f <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  802c6b:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802c6e:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  802c71:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  802c74:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  802c78:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  802c7c:	48 63 d1             	movslq %ecx,%rdx
+  802c7f:	48 01 d0             	add    %rdx,%rax
+  802c82:	4d 63 ff             	movslq %r15d,%r15
+  802c85:	4c 29 f8             	sub    %r15,%rax
+  802c88:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c8d:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  802c91:	48 85 c0             	test   %rax,%rax
+  802c94:	0f 8e c5 fe ff ff    	jle    802b5f <devfile_read+0x78>
+    n = MIN(n, res);
+  802c9a:	4c 39 e8             	cmp    %r13,%rax
+  802c9d:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  802ca1:	8b 73 04             	mov    0x4(%rbx),%esi
+  802ca4:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  802ca8:	48 63 f6             	movslq %esi,%rsi
+  802cab:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802cb0:	48 01 c6             	add    %rax,%rsi
+  802cb3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802cb7:	48 01 c6             	add    %rax,%rsi
+  802cba:	4c 89 ea             	mov    %r13,%rdx
+  802cbd:	4c 89 e7             	mov    %r12,%rdi
+  802cc0:	48 b8 f2 0d 80 00 00 	movabs $0x800df2,%rax
+  802cc7:	00 00 00 
+  802cca:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  802ccc:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  802cd0:	4c 89 e8             	mov    %r13,%rax
+  802cd3:	e9 87 fe ff ff       	jmp    802b5f <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802cd8:	48 98                	cltq
+  802cda:	e9 80 fe ff ff       	jmp    802b5f <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  802cdf:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  802ce3:	41 39 d7             	cmp    %edx,%r15d
+  802ce6:	0f 8c f8 fe ff ff    	jl     802be4 <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  802cec:	49 8b 46 10          	mov    0x10(%r14),%rax
+  802cf0:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  802cf3:	41 39 cf             	cmp    %ecx,%r15d
+  802cf6:	0f 8d e8 fe ff ff    	jge    802be4 <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  802cfc:	4d 63 ff             	movslq %r15d,%r15
+  802cff:	4c 29 f8             	sub    %r15,%rax
+  802d02:	48 63 d2             	movslq %edx,%rdx
+  802d05:	48 01 d0             	add    %rdx,%rax
+  802d08:	eb 87                	jmp    802c91 <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802d0a:	48 98                	cltq
+  802d0c:	e9 4e fe ff ff       	jmp    802b5f <devfile_read+0x78>
+        return E_INVAL;
+  802d11:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802d16:	c3                   	ret
+
+0000000000802d17 <fs_channel>:
+fs_channel(bool enable) {
+  802d17:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  802d19:	a2 04 26 82 00 00 00 	movabs %al,0x822604
+  802d20:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  802d22:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d27:	40 84 ff             	test   %dil,%dil
+  802d2a:	74 47                	je     802d73 <fs_channel+0x5c>
+  802d2c:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  802d33:	00 00 00 
+  802d36:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  802d3c:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  802d43:	00 00 00 
+  802d46:	3b 08                	cmp    (%rax),%ecx
+  802d48:	74 29                	je     802d73 <fs_channel+0x5c>
+fs_channel(bool enable) {
+  802d4a:	55                   	push   %rbp
+  802d4b:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  802d4e:	48 b8 97 1c 80 00 00 	movabs $0x801c97,%rax
+  802d55:	00 00 00 
+  802d58:	ff d0                	call   *%rax
+  802d5a:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  802d5c:	85 c0                	test   %eax,%eax
+  802d5e:	78 04                	js     802d64 <fs_channel+0x4d>
+}
+  802d60:	89 d0                	mov    %edx,%eax
+  802d62:	5d                   	pop    %rbp
+  802d63:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  802d64:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  802d6b:	00 00 00 
+  802d6e:	c6 00 00             	movb   $0x0,(%rax)
+  802d71:	eb ed                	jmp    802d60 <fs_channel+0x49>
+}
+  802d73:	89 d0                	mov    %edx,%eax
+  802d75:	c3                   	ret
+
+0000000000802d76 <open>:
+open(const char *path, int mode) {
+  802d76:	55                   	push   %rbp
+  802d77:	48 89 e5             	mov    %rsp,%rbp
+  802d7a:	41 55                	push   %r13
+  802d7c:	41 54                	push   %r12
+  802d7e:	53                   	push   %rbx
+  802d7f:	48 83 ec 18          	sub    $0x18,%rsp
+  802d83:	49 89 fc             	mov    %rdi,%r12
+  802d86:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802d89:	48 b8 53 0b 80 00 00 	movabs $0x800b53,%rax
+  802d90:	00 00 00 
+  802d93:	ff d0                	call   *%rax
+  802d95:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802d9b:	0f 87 8f 00 00 00    	ja     802e30 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802da1:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802da5:	48 b8 51 15 80 00 00 	movabs $0x801551,%rax
+  802dac:	00 00 00 
+  802daf:	ff d0                	call   *%rax
+  802db1:	89 c3                	mov    %eax,%ebx
+  802db3:	85 c0                	test   %eax,%eax
+  802db5:	78 55                	js     802e0c <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  802db7:	4c 89 e6             	mov    %r12,%rsi
+  802dba:	48 bb 00 00 83 00 00 	movabs $0x830000,%rbx
+  802dc1:	00 00 00 
+  802dc4:	48 89 df             	mov    %rbx,%rdi
+  802dc7:	48 b8 91 0b 80 00 00 	movabs $0x800b91,%rax
+  802dce:	00 00 00 
+  802dd1:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802dd3:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  802dda:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ddf:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802de3:	bf 01 00 00 00       	mov    $0x1,%edi
+  802de8:	48 b8 08 23 80 00 00 	movabs $0x802308,%rax
+  802def:	00 00 00 
+  802df2:	ff d0                	call   *%rax
+  802df4:	89 c3                	mov    %eax,%ebx
+  802df6:	85 c0                	test   %eax,%eax
+  802df8:	78 1f                	js     802e19 <open+0xa3>
+    return fd2num(fd);
+  802dfa:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802dfe:	48 b8 23 15 80 00 00 	movabs $0x801523,%rax
+  802e05:	00 00 00 
+  802e08:	ff d0                	call   *%rax
+  802e0a:	89 c3                	mov    %eax,%ebx
+}
+  802e0c:	89 d8                	mov    %ebx,%eax
+  802e0e:	48 83 c4 18          	add    $0x18,%rsp
+  802e12:	5b                   	pop    %rbx
+  802e13:	41 5c                	pop    %r12
+  802e15:	41 5d                	pop    %r13
+  802e17:	5d                   	pop    %rbp
+  802e18:	c3                   	ret
+        fd_close(fd, 0);
+  802e19:	be 00 00 00 00       	mov    $0x0,%esi
+  802e1e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802e22:	48 b8 6c 16 80 00 00 	movabs $0x80166c,%rax
+  802e29:	00 00 00 
+  802e2c:	ff d0                	call   *%rax
+        return res;
+  802e2e:	eb dc                	jmp    802e0c <open+0x96>
+        return -E_BAD_PATH;
+  802e30:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802e35:	eb d5                	jmp    802e0c <open+0x96>
+
+0000000000802e37 <file_flush_buffers>:
+file_flush_buffers(void) {
+  802e37:	55                   	push   %rbp
+  802e38:	48 89 e5             	mov    %rsp,%rbp
+  802e3b:	41 56                	push   %r14
+  802e3d:	41 55                	push   %r13
+  802e3f:	41 54                	push   %r12
+  802e41:	53                   	push   %rbx
+  802e42:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  802e46:	49 bc 08 23 82 00 00 	movabs $0x822308,%r12
+  802e4d:	00 00 00 
+  802e50:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  802e55:	49 bd b1 15 80 00 00 	movabs $0x8015b1,%r13
+  802e5c:	00 00 00 
+  802e5f:	49 be 71 25 80 00 00 	movabs $0x802571,%r14
+  802e66:	00 00 00 
+  802e69:	eb 0c                	jmp    802e77 <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  802e6b:	83 c3 01             	add    $0x1,%ebx
+  802e6e:	49 83 c4 18          	add    $0x18,%r12
+  802e72:	83 fb 20             	cmp    $0x20,%ebx
+  802e75:	74 1d                	je     802e94 <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  802e77:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  802e7c:	74 ed                	je     802e6b <file_flush_buffers+0x34>
+  802e7e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802e82:	89 df                	mov    %ebx,%edi
+  802e84:	41 ff d5             	call   *%r13
+  802e87:	85 c0                	test   %eax,%eax
+  802e89:	78 e0                	js     802e6b <file_flush_buffers+0x34>
+  802e8b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802e8f:	41 ff d6             	call   *%r14
+  802e92:	eb d7                	jmp    802e6b <file_flush_buffers+0x34>
+}
+  802e94:	48 83 c4 10          	add    $0x10,%rsp
+  802e98:	5b                   	pop    %rbx
+  802e99:	41 5c                	pop    %r12
+  802e9b:	41 5d                	pop    %r13
+  802e9d:	41 5e                	pop    %r14
+  802e9f:	5d                   	pop    %rbp
+  802ea0:	c3                   	ret
+
+0000000000802ea1 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802ea1:	55                   	push   %rbp
+  802ea2:	48 89 e5             	mov    %rsp,%rbp
+  802ea5:	41 54                	push   %r12
+  802ea7:	53                   	push   %rbx
+  802ea8:	49 89 fc             	mov    %rdi,%r12
+  802eab:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  802ead:	48 b8 37 2e 80 00 00 	movabs $0x802e37,%rax
+  802eb4:	00 00 00 
+  802eb7:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802eb9:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  802ec0:	00 00 00 
+  802ec3:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  802ec8:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802eca:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  802ecd:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ed2:	be 00 00 00 00       	mov    $0x0,%esi
+  802ed7:	bf 02 00 00 00       	mov    $0x2,%edi
+  802edc:	48 b8 08 23 80 00 00 	movabs $0x802308,%rax
+  802ee3:	00 00 00 
+  802ee6:	ff d0                	call   *%rax
+}
+  802ee8:	5b                   	pop    %rbx
+  802ee9:	41 5c                	pop    %r12
+  802eeb:	5d                   	pop    %rbp
+  802eec:	c3                   	ret
+
+0000000000802eed <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802eed:	55                   	push   %rbp
+  802eee:	48 89 e5             	mov    %rsp,%rbp
+  802ef1:	41 54                	push   %r12
+  802ef3:	53                   	push   %rbx
+  802ef4:	49 89 fc             	mov    %rdi,%r12
+  802ef7:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  802efa:	48 b8 37 2e 80 00 00 	movabs $0x802e37,%rax
+  802f01:	00 00 00 
+  802f04:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802f06:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  802f0b:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  802f12:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  802f14:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f19:	be 00 00 00 00       	mov    $0x0,%esi
+  802f1e:	bf 05 00 00 00       	mov    $0x5,%edi
+  802f23:	48 b8 08 23 80 00 00 	movabs $0x802308,%rax
+  802f2a:	00 00 00 
+  802f2d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802f2f:	85 c0                	test   %eax,%eax
+  802f31:	78 3d                	js     802f70 <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802f33:	49 bc 00 00 83 00 00 	movabs $0x830000,%r12
+  802f3a:	00 00 00 
+  802f3d:	4c 89 e6             	mov    %r12,%rsi
+  802f40:	48 89 df             	mov    %rbx,%rdi
+  802f43:	48 b8 91 0b 80 00 00 	movabs $0x800b91,%rax
+  802f4a:	00 00 00 
+  802f4d:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802f4f:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802f56:	00 
+  802f57:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802f5d:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802f64:	00 
+  802f65:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802f6b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802f70:	5b                   	pop    %rbx
+  802f71:	41 5c                	pop    %r12
+  802f73:	5d                   	pop    %rbp
+  802f74:	c3                   	ret
+
+0000000000802f75 <remove>:
+remove(const char *path) {
+  802f75:	55                   	push   %rbp
+  802f76:	48 89 e5             	mov    %rsp,%rbp
+  802f79:	53                   	push   %rbx
+  802f7a:	48 83 ec 08          	sub    $0x8,%rsp
+  802f7e:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  802f81:	48 b8 53 0b 80 00 00 	movabs $0x800b53,%rax
+  802f88:	00 00 00 
+  802f8b:	ff d0                	call   *%rax
+  802f8d:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802f93:	77 3a                	ja     802fcf <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  802f95:	48 89 de             	mov    %rbx,%rsi
+  802f98:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  802f9f:	00 00 00 
+  802fa2:	48 b8 91 0b 80 00 00 	movabs $0x800b91,%rax
+  802fa9:	00 00 00 
+  802fac:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  802fae:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fb3:	be 00 00 00 00       	mov    $0x0,%esi
+  802fb8:	bf 07 00 00 00       	mov    $0x7,%edi
+  802fbd:	48 b8 08 23 80 00 00 	movabs $0x802308,%rax
+  802fc4:	00 00 00 
+  802fc7:	ff d0                	call   *%rax
+}
+  802fc9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802fcd:	c9                   	leave
+  802fce:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  802fcf:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  802fd4:	eb f3                	jmp    802fc9 <remove+0x54>
+
+0000000000802fd6 <sync>:
+sync(void) {
+  802fd6:	55                   	push   %rbp
+  802fd7:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  802fda:	48 b8 37 2e 80 00 00 	movabs $0x802e37,%rax
+  802fe1:	00 00 00 
+  802fe4:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  802fe6:	ba 00 00 00 00       	mov    $0x0,%edx
+  802feb:	be 00 00 00 00       	mov    $0x0,%esi
+  802ff0:	bf 08 00 00 00       	mov    $0x8,%edi
+  802ff5:	48 b8 08 23 80 00 00 	movabs $0x802308,%rax
+  802ffc:	00 00 00 
+  802fff:	ff d0                	call   *%rax
+}
+  803001:	5d                   	pop    %rbp
+  803002:	c3                   	ret
+
+0000000000803003 <fsync>:
+fsync(int fdnum) {
+  803003:	55                   	push   %rbp
+  803004:	48 89 e5             	mov    %rsp,%rbp
+  803007:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80300b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80300f:	48 b8 b1 15 80 00 00 	movabs $0x8015b1,%rax
+  803016:	00 00 00 
+  803019:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80301b:	85 c0                	test   %eax,%eax
+  80301d:	78 4b                	js     80306a <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80301f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803023:	48 b8 20 50 80 00 00 	movabs $0x805020,%rax
+  80302a:	00 00 00 
+  80302d:	8b 00                	mov    (%rax),%eax
+  80302f:	39 02                	cmp    %eax,(%rdx)
+  803031:	75 39                	jne    80306c <fsync+0x69>
+    file_flush_buffers();
+  803033:	48 b8 37 2e 80 00 00 	movabs $0x802e37,%rax
+  80303a:	00 00 00 
+  80303d:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  80303f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803043:	8b 40 0c             	mov    0xc(%rax),%eax
+  803046:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  80304d:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  80304f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803054:	be 00 00 00 00       	mov    $0x0,%esi
+  803059:	bf 0d 00 00 00       	mov    $0xd,%edi
+  80305e:	48 b8 08 23 80 00 00 	movabs $0x802308,%rax
+  803065:	00 00 00 
+  803068:	ff d0                	call   *%rax
+}
+  80306a:	c9                   	leave
+  80306b:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80306c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803071:	eb f7                	jmp    80306a <fsync+0x67>
+
+0000000000803073 <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  803073:	55                   	push   %rbp
+  803074:	48 89 e5             	mov    %rsp,%rbp
+  803077:	53                   	push   %rbx
+  803078:	48 83 ec 08          	sub    $0x8,%rsp
+  80307c:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  80307f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803084:	be 00 00 00 00       	mov    $0x0,%esi
+  803089:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80308e:	48 b8 08 23 80 00 00 	movabs $0x802308,%rax
+  803095:	00 00 00 
+  803098:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80309a:	85 c0                	test   %eax,%eax
+  80309c:	78 2d                	js     8030cb <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  80309e:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  8030a5:	00 00 00 
+  8030a8:	48 8b 10             	mov    (%rax),%rdx
+  8030ab:	48 89 13             	mov    %rdx,(%rbx)
+  8030ae:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8030b2:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  8030b6:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8030ba:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  8030be:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8030c2:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  8030c6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030cb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8030cf:	c9                   	leave
+  8030d0:	c3                   	ret
+
+00000000008030d1 <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  8030d1:	55                   	push   %rbp
+  8030d2:	48 89 e5             	mov    %rsp,%rbp
+  8030d5:	53                   	push   %rbx
+  8030d6:	48 83 ec 08          	sub    $0x8,%rsp
+  8030da:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  8030dd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030e2:	be 00 00 00 00       	mov    $0x0,%esi
+  8030e7:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8030ec:	48 b8 08 23 80 00 00 	movabs $0x802308,%rax
+  8030f3:	00 00 00 
+  8030f6:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8030f8:	85 c0                	test   %eax,%eax
+  8030fa:	78 3d                	js     803139 <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  8030fc:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803103:	00 00 00 
+  803106:	48 8b 10             	mov    (%rax),%rdx
+  803109:	48 89 13             	mov    %rdx,(%rbx)
+  80310c:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  803110:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  803114:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803118:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  80311c:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  803120:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  803124:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  803128:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  80312c:	48 8b 40 28          	mov    0x28(%rax),%rax
+  803130:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  803134:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803139:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80313d:	c9                   	leave
+  80313e:	c3                   	ret
+
+000000000080313f <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  80313f:	55                   	push   %rbp
+  803140:	48 89 e5             	mov    %rsp,%rbp
+  803143:	41 57                	push   %r15
+  803145:	41 56                	push   %r14
+  803147:	41 55                	push   %r13
+  803149:	41 54                	push   %r12
+  80314b:	53                   	push   %rbx
+  80314c:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  803150:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  803157:	00 
+  803158:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  80315f:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  803165:	0f 85 43 01 00 00    	jne    8032ae <munmap+0x16f>
+  80316b:	49 89 ff             	mov    %rdi,%r15
+  80316e:	4c 39 f7             	cmp    %r14,%rdi
+  803171:	0f 87 37 01 00 00    	ja     8032ae <munmap+0x16f>
+  803177:	48 bb 00 20 82 00 00 	movabs $0x822000,%rbx
+  80317e:	00 00 00 
+  803181:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  803187:	eb 2c                	jmp    8031b5 <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  803189:	4c 39 f8             	cmp    %r15,%rax
+  80318c:	0f 83 85 00 00 00    	jae    803217 <munmap+0xd8>
+            m->mm_end = start;
+  803192:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  803197:	48 83 c3 18          	add    $0x18,%rbx
+  80319b:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  8031a2:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8031a9:	00 00 00 
+  8031ac:	48 39 c3             	cmp    %rax,%rbx
+  8031af:	0f 84 d0 00 00 00    	je     803285 <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  8031b5:	49 89 dc             	mov    %rbx,%r12
+  8031b8:	48 8b 03             	mov    (%rbx),%rax
+  8031bb:	4c 39 f0             	cmp    %r14,%rax
+  8031be:	73 d7                	jae    803197 <munmap+0x58>
+  8031c0:	48 85 c0             	test   %rax,%rax
+  8031c3:	74 d2                	je     803197 <munmap+0x58>
+  8031c5:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8031c9:	49 39 d7             	cmp    %rdx,%r15
+  8031cc:	73 c9                	jae    803197 <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  8031ce:	49 39 d6             	cmp    %rdx,%r14
+  8031d1:	73 b6                	jae    803189 <munmap+0x4a>
+  8031d3:	49 39 c7             	cmp    %rax,%r15
+  8031d6:	76 b1                	jbe    803189 <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  8031d8:	4c 89 ef             	mov    %r13,%rdi
+  8031db:	48 b8 76 22 80 00 00 	movabs $0x802276,%rax
+  8031e2:	00 00 00 
+  8031e5:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  8031e7:	48 85 c0             	test   %rax,%rax
+  8031ea:	0f 84 c5 00 00 00    	je     8032b5 <munmap+0x176>
+            *tail = *m;
+  8031f0:	48 8b 13             	mov    (%rbx),%rdx
+  8031f3:	48 89 10             	mov    %rdx,(%rax)
+  8031f6:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8031fa:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  8031fe:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  803202:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  803206:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  803209:	44 89 f2             	mov    %r14d,%edx
+  80320c:	2b 13                	sub    (%rbx),%edx
+  80320e:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  803211:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  803215:	eb 80                	jmp    803197 <munmap+0x58>
+        } else if (m->mm_end > end) {
+  803217:	49 39 d6             	cmp    %rdx,%r14
+  80321a:	73 18                	jae    803234 <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  80321c:	44 89 f2             	mov    %r14d,%edx
+  80321f:	41 03 54 24 10       	add    0x10(%r12),%edx
+  803224:	29 c2                	sub    %eax,%edx
+  803226:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  80322b:	4d 89 34 24          	mov    %r14,(%r12)
+  80322f:	e9 63 ff ff ff       	jmp    803197 <munmap+0x58>
+    m->mm_start = 0;
+  803234:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  80323b:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  80323c:	4c 89 e6             	mov    %r12,%rsi
+  80323f:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  803246:	00 00 00 
+  803249:	48 29 c6             	sub    %rax,%rsi
+  80324c:	48 c1 fe 03          	sar    $0x3,%rsi
+  803250:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  803257:	aa aa aa 
+  80325a:	48 0f af f0          	imul   %rax,%rsi
+  80325e:	48 c1 e6 0c          	shl    $0xc,%rsi
+  803262:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  803267:	48 01 c6             	add    %rax,%rsi
+  80326a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80326f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803274:	48 b8 96 11 80 00 00 	movabs $0x801196,%rax
+  80327b:	00 00 00 
+  80327e:	ff d0                	call   *%rax
+}
+  803280:	e9 12 ff ff ff       	jmp    803197 <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  803285:	4c 89 f2             	mov    %r14,%rdx
+  803288:	4c 29 fa             	sub    %r15,%rdx
+  80328b:	4c 89 fe             	mov    %r15,%rsi
+  80328e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803293:	48 b8 96 11 80 00 00 	movabs $0x801196,%rax
+  80329a:	00 00 00 
+  80329d:	ff d0                	call   *%rax
+}
+  80329f:	48 83 c4 08          	add    $0x8,%rsp
+  8032a3:	5b                   	pop    %rbx
+  8032a4:	41 5c                	pop    %r12
+  8032a6:	41 5d                	pop    %r13
+  8032a8:	41 5e                	pop    %r14
+  8032aa:	41 5f                	pop    %r15
+  8032ac:	5d                   	pop    %rbp
+  8032ad:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  8032ae:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8032b3:	eb ea                	jmp    80329f <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  8032b5:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  8032ba:	eb e3                	jmp    80329f <munmap+0x160>
+
+00000000008032bc <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  8032bc:	55                   	push   %rbp
+  8032bd:	48 89 e5             	mov    %rsp,%rbp
+  8032c0:	41 57                	push   %r15
+  8032c2:	41 56                	push   %r14
+  8032c4:	41 55                	push   %r13
+  8032c6:	41 54                	push   %r12
+  8032c8:	53                   	push   %rbx
+  8032c9:	48 83 ec 28          	sub    $0x28,%rsp
+  8032cd:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8032d1:	49 89 f5             	mov    %rsi,%r13
+  8032d4:	41 89 d6             	mov    %edx,%r14d
+  8032d7:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  8032da:	41 89 cc             	mov    %ecx,%r12d
+  8032dd:	44 89 c7             	mov    %r8d,%edi
+  8032e0:	44 89 cb             	mov    %r9d,%ebx
+  8032e3:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8032e7:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8032eb:	48 b8 b1 15 80 00 00 	movabs $0x8015b1,%rax
+  8032f2:	00 00 00 
+  8032f5:	ff d0                	call   *%rax
+  8032f7:	41 89 c7             	mov    %eax,%r15d
+  8032fa:	85 c0                	test   %eax,%eax
+  8032fc:	0f 88 ae 01 00 00    	js     8034b0 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803302:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803306:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  80330d:	00 00 00 
+  803310:	8b 32                	mov    (%rdx),%esi
+  803312:	39 30                	cmp    %esi,(%rax)
+  803314:	0f 85 7a 02 00 00    	jne    803594 <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  80331a:	8b 40 08             	mov    0x8(%rax),%eax
+  80331d:	83 e0 03             	and    $0x3,%eax
+  803320:	83 f8 01             	cmp    $0x1,%eax
+  803323:	0f 84 76 02 00 00    	je     80359f <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  803329:	4d 85 ed             	test   %r13,%r13
+  80332c:	0f 84 78 02 00 00    	je     8035aa <mmap+0x2ee>
+  803332:	85 db                	test   %ebx,%ebx
+  803334:	0f 88 70 02 00 00    	js     8035aa <mmap+0x2ee>
+  80333a:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  803340:	41 89 df             	mov    %ebx,%r15d
+  803343:	0f 85 6c 02 00 00    	jne    8035b5 <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  803349:	44 89 f0             	mov    %r14d,%eax
+  80334c:	83 e0 fd             	and    $0xfffffffd,%eax
+  80334f:	83 f8 04             	cmp    $0x4,%eax
+  803352:	0f 85 68 02 00 00    	jne    8035c0 <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  803358:	44 89 e1             	mov    %r12d,%ecx
+  80335b:	83 e1 01             	and    $0x1,%ecx
+  80335e:	0f 95 c2             	setne  %dl
+  803361:	44 89 e0             	mov    %r12d,%eax
+  803364:	d1 e8                	shr    %eax
+  803366:	83 f0 01             	xor    $0x1,%eax
+  803369:	83 e0 01             	and    $0x1,%eax
+  80336c:	38 c2                	cmp    %al,%dl
+  80336e:	0f 85 57 02 00 00    	jne    8035cb <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  803374:	85 c9                	test   %ecx,%ecx
+  803376:	74 0a                	je     803382 <mmap+0xc6>
+  803378:	41 f6 c6 02          	test   $0x2,%r14b
+  80337c:	0f 85 54 02 00 00    	jne    8035d6 <mmap+0x31a>
+    file_flush_buffers();
+  803382:	48 b8 37 2e 80 00 00 	movabs $0x802e37,%rax
+  803389:	00 00 00 
+  80338c:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  80338e:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  803395:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  80339c:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8033a0:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  8033a3:	41 f6 c4 04          	test   $0x4,%r12b
+  8033a7:	0f 84 15 01 00 00    	je     8034c2 <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  8033ad:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  8033b0:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8033b6:	0f 85 25 02 00 00    	jne    8035e1 <mmap+0x325>
+  8033bc:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  8033c0:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  8033c7:	00 00 00 
+  8033ca:	48 39 c2             	cmp    %rax,%rdx
+  8033cd:	0f 82 19 02 00 00    	jb     8035ec <mmap+0x330>
+  8033d3:	48 39 c7             	cmp    %rax,%rdi
+  8033d6:	0f 87 10 02 00 00    	ja     8035ec <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  8033dc:	4c 89 ee             	mov    %r13,%rsi
+  8033df:	48 b8 3f 31 80 00 00 	movabs $0x80313f,%rax
+  8033e6:	00 00 00 
+  8033e9:	ff d0                	call   *%rax
+  8033eb:	85 c0                	test   %eax,%eax
+  8033ed:	0f 88 04 02 00 00    	js     8035f7 <mmap+0x33b>
+    if (!handler) {
+  8033f3:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  8033fa:	00 00 00 
+  8033fd:	80 38 00             	cmpb   $0x0,(%rax)
+  803400:	75 2b                	jne    80342d <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  803402:	48 bf d7 21 80 00 00 	movabs $0x8021d7,%rdi
+  803409:	00 00 00 
+  80340c:	48 b8 3b 43 80 00 00 	movabs $0x80433b,%rax
+  803413:	00 00 00 
+  803416:	ff d0                	call   *%rax
+  803418:	85 c0                	test   %eax,%eax
+  80341a:	0f 88 ea 01 00 00    	js     80360a <mmap+0x34e>
+        handler = 1;
+  803420:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  803427:	00 00 00 
+  80342a:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  80342d:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803431:	48 b8 76 22 80 00 00 	movabs $0x802276,%rax
+  803438:	00 00 00 
+  80343b:	ff d0                	call   *%rax
+  80343d:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  803440:	48 85 c0             	test   %rax,%rax
+  803443:	0f 84 c9 01 00 00    	je     803612 <mmap+0x356>
+    m->mm_start = va;
+  803449:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  80344c:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  803450:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  803454:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  803457:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  80345b:	44 89 e0             	mov    %r12d,%eax
+  80345e:	c1 e0 06             	shl    $0x6,%eax
+  803461:	25 80 00 00 00       	and    $0x80,%eax
+  803466:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  803469:	09 f0                	or     %esi,%eax
+  80346b:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  80346f:	41 f6 c4 08          	test   $0x8,%r12b
+  803473:	74 31                	je     8034a6 <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  803475:	48 39 d3             	cmp    %rdx,%rbx
+  803478:	73 2c                	jae    8034a6 <mmap+0x1ea>
+  80347a:	ba 00 00 04 00       	mov    $0x40000,%edx
+  80347f:	48 89 de             	mov    %rbx,%rsi
+  803482:	4c 89 f7             	mov    %r14,%rdi
+  803485:	48 b8 c6 20 80 00 00 	movabs $0x8020c6,%rax
+  80348c:	00 00 00 
+  80348f:	ff d0                	call   *%rax
+  803491:	49 89 c4             	mov    %rax,%r12
+  803494:	48 85 c0             	test   %rax,%rax
+  803497:	0f 8e d7 00 00 00    	jle    803574 <mmap+0x2b8>
+            va += n;
+  80349d:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  8034a0:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  8034a4:	72 d4                	jb     80347a <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  8034a6:	49 8b 06             	mov    (%r14),%rax
+  8034a9:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  8034ad:	48 89 06             	mov    %rax,(%rsi)
+}
+  8034b0:	44 89 f8             	mov    %r15d,%eax
+  8034b3:	48 83 c4 28          	add    $0x28,%rsp
+  8034b7:	5b                   	pop    %rbx
+  8034b8:	41 5c                	pop    %r12
+  8034ba:	41 5d                	pop    %r13
+  8034bc:	41 5e                	pop    %r14
+  8034be:	41 5f                	pop    %r15
+  8034c0:	5d                   	pop    %rbp
+  8034c1:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8034c2:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  8034c9:	00 00 00 
+  8034cc:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  8034cf:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  8034d6:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8034d9:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  8034de:	48 be 00 20 82 00 00 	movabs $0x822000,%rsi
+  8034e5:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8034e8:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  8034ef:	00 00 00 
+  8034f2:	48 39 d7             	cmp    %rdx,%rdi
+  8034f5:	73 1c                	jae    803513 <mmap+0x257>
+        return -E_NO_MEM;
+  8034f7:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8034fd:	eb b1                	jmp    8034b0 <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8034ff:	48 83 c0 01          	add    $0x1,%rax
+  803503:	48 83 f8 1f          	cmp    $0x1f,%rax
+  803507:	77 3f                	ja     803548 <mmap+0x28c>
+  803509:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  80350e:	48 39 d7             	cmp    %rdx,%rdi
+  803511:	72 2a                	jb     80353d <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  803513:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  803517:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  80351b:	48 39 d1             	cmp    %rdx,%rcx
+  80351e:	73 df                	jae    8034ff <mmap+0x243>
+  803520:	48 85 c9             	test   %rcx,%rcx
+  803523:	74 da                	je     8034ff <mmap+0x243>
+  803525:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  803529:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  80352e:	48 39 d3             	cmp    %rdx,%rbx
+  803531:	73 cc                	jae    8034ff <mmap+0x243>
+            va = mmaps[i].mm_end;
+  803533:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803536:	b8 00 00 00 00       	mov    $0x0,%eax
+  80353b:	eb cc                	jmp    803509 <mmap+0x24d>
+        return -E_NO_MEM;
+  80353d:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803543:	e9 68 ff ff ff       	jmp    8034b0 <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  803548:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  80354d:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  803554:	00 00 00 
+  803557:	48 39 c2             	cmp    %rax,%rdx
+  80355a:	0f 82 9f 00 00 00    	jb     8035ff <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  803560:	48 85 db             	test   %rbx,%rbx
+  803563:	0f 85 8a fe ff ff    	jne    8033f3 <mmap+0x137>
+        return -E_NO_MEM;
+  803569:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80356f:	e9 3c ff ff ff       	jmp    8034b0 <mmap+0x1f4>
+        if (n < 0) {
+  803574:	0f 89 2c ff ff ff    	jns    8034a6 <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  80357a:	49 8b 3e             	mov    (%r14),%rdi
+  80357d:	4c 89 ee             	mov    %r13,%rsi
+  803580:	48 b8 3f 31 80 00 00 	movabs $0x80313f,%rax
+  803587:	00 00 00 
+  80358a:	ff d0                	call   *%rax
+            return n;
+  80358c:	45 89 e7             	mov    %r12d,%r15d
+  80358f:	e9 1c ff ff ff       	jmp    8034b0 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803594:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80359a:	e9 11 ff ff ff       	jmp    8034b0 <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  80359f:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8035a5:	e9 06 ff ff ff       	jmp    8034b0 <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  8035aa:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8035b0:	e9 fb fe ff ff       	jmp    8034b0 <mmap+0x1f4>
+  8035b5:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8035bb:	e9 f0 fe ff ff       	jmp    8034b0 <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  8035c0:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8035c6:	e9 e5 fe ff ff       	jmp    8034b0 <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  8035cb:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8035d1:	e9 da fe ff ff       	jmp    8034b0 <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  8035d6:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  8035dc:	e9 cf fe ff ff       	jmp    8034b0 <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  8035e1:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8035e7:	e9 c4 fe ff ff       	jmp    8034b0 <mmap+0x1f4>
+  8035ec:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8035f2:	e9 b9 fe ff ff       	jmp    8034b0 <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  8035f7:	41 89 c7             	mov    %eax,%r15d
+  8035fa:	e9 b1 fe ff ff       	jmp    8034b0 <mmap+0x1f4>
+        return -E_NO_MEM;
+  8035ff:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803605:	e9 a6 fe ff ff       	jmp    8034b0 <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  80360a:	41 89 c7             	mov    %eax,%r15d
+  80360d:	e9 9e fe ff ff       	jmp    8034b0 <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  803612:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803618:	e9 93 fe ff ff       	jmp    8034b0 <mmap+0x1f4>
+
+000000000080361d <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80361d:	55                   	push   %rbp
+  80361e:	48 89 e5             	mov    %rsp,%rbp
+  803621:	41 54                	push   %r12
+  803623:	53                   	push   %rbx
+  803624:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803627:	48 b8 35 15 80 00 00 	movabs $0x801535,%rax
+  80362e:	00 00 00 
+  803631:	ff d0                	call   *%rax
+  803633:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803636:	48 be 00 4e 80 00 00 	movabs $0x804e00,%rsi
+  80363d:	00 00 00 
+  803640:	48 89 df             	mov    %rbx,%rdi
+  803643:	48 b8 91 0b 80 00 00 	movabs $0x800b91,%rax
+  80364a:	00 00 00 
+  80364d:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  80364f:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803654:	41 2b 04 24          	sub    (%r12),%eax
+  803658:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  80365e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803665:	00 00 00 
+    stat->st_dev = &devpipe;
+  803668:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  80366f:	00 00 00 
+  803672:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803679:	b8 00 00 00 00       	mov    $0x0,%eax
+  80367e:	5b                   	pop    %rbx
+  80367f:	41 5c                	pop    %r12
+  803681:	5d                   	pop    %rbp
+  803682:	c3                   	ret
+
+0000000000803683 <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  803683:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803686:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  80368c:	8b 17                	mov    (%rdi),%edx
+  80368e:	85 d2                	test   %edx,%edx
+  803690:	75 01                	jne    803693 <pipe_wakeup+0x10>
+  803692:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  803693:	55                   	push   %rbp
+  803694:	48 89 e5             	mov    %rsp,%rbp
+  803697:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  80369a:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  8036a0:	be 00 04 00 00       	mov    $0x400,%esi
+  8036a5:	48 b8 7c 14 80 00 00 	movabs $0x80147c,%rax
+  8036ac:	00 00 00 
+  8036af:	ff d0                	call   *%rax
+}
+  8036b1:	5d                   	pop    %rbp
+  8036b2:	c3                   	ret
+
+00000000008036b3 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8036b3:	55                   	push   %rbp
+  8036b4:	48 89 e5             	mov    %rsp,%rbp
+  8036b7:	41 55                	push   %r13
+  8036b9:	41 54                	push   %r12
+  8036bb:	53                   	push   %rbx
+  8036bc:	48 83 ec 08          	sub    $0x8,%rsp
+  8036c0:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8036c3:	48 b8 35 15 80 00 00 	movabs $0x801535,%rax
+  8036ca:	00 00 00 
+  8036cd:	ff d0                	call   *%rax
+  8036cf:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8036d2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8036d7:	4c 89 e6             	mov    %r12,%rsi
+  8036da:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036df:	49 bc 96 11 80 00 00 	movabs $0x801196,%r12
+  8036e6:	00 00 00 
+  8036e9:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8036ec:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  8036f0:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  8036f4:	49 bd 83 36 80 00 00 	movabs $0x803683,%r13
+  8036fb:	00 00 00 
+  8036fe:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803701:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803705:	48 89 de             	mov    %rbx,%rsi
+  803708:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  80370b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803710:	48 89 de             	mov    %rbx,%rsi
+  803713:	bf 00 00 00 00       	mov    $0x0,%edi
+  803718:	41 ff d4             	call   *%r12
+  80371b:	48 83 c4 08          	add    $0x8,%rsp
+  80371f:	5b                   	pop    %rbx
+  803720:	41 5c                	pop    %r12
+  803722:	41 5d                	pop    %r13
+  803724:	5d                   	pop    %rbp
+  803725:	c3                   	ret
+
+0000000000803726 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  803726:	55                   	push   %rbp
+  803727:	48 89 e5             	mov    %rsp,%rbp
+  80372a:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80372d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803732:	be 00 10 00 00       	mov    $0x1000,%esi
+  803737:	48 b8 d9 10 80 00 00 	movabs $0x8010d9,%rax
+  80373e:	00 00 00 
+  803741:	ff d0                	call   *%rax
+  803743:	85 c0                	test   %eax,%eax
+  803745:	0f 94 c0             	sete   %al
+  803748:	0f b6 c0             	movzbl %al,%eax
+}
+  80374b:	5d                   	pop    %rbp
+  80374c:	c3                   	ret
+
+000000000080374d <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80374d:	55                   	push   %rbp
+  80374e:	48 89 e5             	mov    %rsp,%rbp
+  803751:	41 57                	push   %r15
+  803753:	41 56                	push   %r14
+  803755:	41 55                	push   %r13
+  803757:	41 54                	push   %r12
+  803759:	53                   	push   %rbx
+  80375a:	48 83 ec 38          	sub    $0x38,%rsp
+  80375e:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803762:	49 89 f4             	mov    %rsi,%r12
+  803765:	49 89 d7             	mov    %rdx,%r15
+  803768:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80376c:	48 b8 35 15 80 00 00 	movabs $0x801535,%rax
+  803773:	00 00 00 
+  803776:	ff d0                	call   *%rax
+  803778:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  80377b:	4d 85 ff             	test   %r15,%r15
+  80377e:	0f 84 f1 00 00 00    	je     803875 <devpipe_write+0x128>
+  803784:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  803788:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  80378c:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  803790:	49 bd 26 37 80 00 00 	movabs $0x803726,%r13
+  803797:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  80379a:	49 bf 83 36 80 00 00 	movabs $0x803683,%r15
+  8037a1:	00 00 00 
+  8037a4:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  8037a8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8037ac:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8037b0:	8b 73 04             	mov    0x4(%rbx),%esi
+  8037b3:	48 63 ce             	movslq %esi,%rcx
+  8037b6:	48 63 03             	movslq (%rbx),%rax
+  8037b9:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  8037bf:	48 39 c1             	cmp    %rax,%rcx
+  8037c2:	72 64                	jb     803828 <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  8037c4:	48 89 de             	mov    %rbx,%rsi
+  8037c7:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8037cb:	41 ff d5             	call   *%r13
+  8037ce:	85 c0                	test   %eax,%eax
+  8037d0:	0f 85 b9 00 00 00    	jne    80388f <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8037d6:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8037da:	4c 89 f7             	mov    %r14,%rdi
+  8037dd:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  8037e0:	8b 43 04             	mov    0x4(%rbx),%eax
+  8037e3:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  8037ea:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8037f1:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  8037f7:	8b 03                	mov    (%rbx),%eax
+  8037f9:	41 39 c4             	cmp    %eax,%r12d
+  8037fc:	75 b2                	jne    8037b0 <devpipe_write+0x63>
+  8037fe:	48 89 de             	mov    %rbx,%rsi
+  803801:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803805:	41 ff d5             	call   *%r13
+  803808:	85 c0                	test   %eax,%eax
+  80380a:	75 a0                	jne    8037ac <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  80380c:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803811:	44 89 e6             	mov    %r12d,%esi
+  803814:	48 89 df             	mov    %rbx,%rdi
+  803817:	48 b8 5e 14 80 00 00 	movabs $0x80145e,%rax
+  80381e:	00 00 00 
+  803821:	ff d0                	call   *%rax
+  803823:	e9 7c ff ff ff       	jmp    8037a4 <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803828:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  80382c:	41 0f b6 38          	movzbl (%r8),%edi
+  803830:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803837:	80 80 80 
+  80383a:	48 89 c8             	mov    %rcx,%rax
+  80383d:	48 f7 e2             	mul    %rdx
+  803840:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803844:	48 89 d0             	mov    %rdx,%rax
+  803847:	48 c1 e0 08          	shl    $0x8,%rax
+  80384b:	48 29 d0             	sub    %rdx,%rax
+  80384e:	48 c1 e0 04          	shl    $0x4,%rax
+  803852:	48 29 c1             	sub    %rax,%rcx
+  803855:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  80385a:	83 c6 01             	add    $0x1,%esi
+  80385d:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803860:	49 83 c0 01          	add    $0x1,%r8
+  803864:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  803868:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80386c:	49 39 c0             	cmp    %rax,%r8
+  80386f:	0f 85 2f ff ff ff    	jne    8037a4 <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803875:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803879:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  80387d:	48 b8 83 36 80 00 00 	movabs $0x803683,%rax
+  803884:	00 00 00 
+  803887:	ff d0                	call   *%rax
+    return n;
+  803889:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80388d:	eb 05                	jmp    803894 <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  80388f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803894:	48 83 c4 38          	add    $0x38,%rsp
+  803898:	5b                   	pop    %rbx
+  803899:	41 5c                	pop    %r12
+  80389b:	41 5d                	pop    %r13
+  80389d:	41 5e                	pop    %r14
+  80389f:	41 5f                	pop    %r15
+  8038a1:	5d                   	pop    %rbp
+  8038a2:	c3                   	ret
+
+00000000008038a3 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8038a3:	55                   	push   %rbp
+  8038a4:	48 89 e5             	mov    %rsp,%rbp
+  8038a7:	41 57                	push   %r15
+  8038a9:	41 56                	push   %r14
+  8038ab:	41 55                	push   %r13
+  8038ad:	41 54                	push   %r12
+  8038af:	53                   	push   %rbx
+  8038b0:	48 83 ec 28          	sub    $0x28,%rsp
+  8038b4:	49 89 fd             	mov    %rdi,%r13
+  8038b7:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  8038bb:	49 89 d4             	mov    %rdx,%r12
+  8038be:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8038c2:	48 b8 35 15 80 00 00 	movabs $0x801535,%rax
+  8038c9:	00 00 00 
+  8038cc:	ff d0                	call   *%rax
+  8038ce:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8038d1:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  8038d7:	49 bf 26 37 80 00 00 	movabs $0x803726,%r15
+  8038de:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8038e1:	4d 85 e4             	test   %r12,%r12
+  8038e4:	0f 84 d5 00 00 00    	je     8039bf <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  8038ea:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  8038ee:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8038f2:	8b 03                	mov    (%rbx),%eax
+  8038f4:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8038f7:	75 7a                	jne    803973 <devpipe_read+0xd0>
+            if (i > 0) {
+  8038f9:	4d 85 f6             	test   %r14,%r14
+  8038fc:	75 50                	jne    80394e <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  8038fe:	48 89 de             	mov    %rbx,%rsi
+  803901:	4c 89 ef             	mov    %r13,%rdi
+  803904:	41 ff d7             	call   *%r15
+  803907:	85 c0                	test   %eax,%eax
+  803909:	0f 85 c9 00 00 00    	jne    8039d8 <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  80390f:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  803912:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803919:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  80391f:	8b 43 04             	mov    0x4(%rbx),%eax
+  803922:	41 39 c4             	cmp    %eax,%r12d
+  803925:	75 cb                	jne    8038f2 <devpipe_read+0x4f>
+  803927:	48 89 de             	mov    %rbx,%rsi
+  80392a:	4c 89 ef             	mov    %r13,%rdi
+  80392d:	41 ff d7             	call   *%r15
+  803930:	85 c0                	test   %eax,%eax
+  803932:	75 be                	jne    8038f2 <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803934:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803939:	44 89 e6             	mov    %r12d,%esi
+  80393c:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803940:	48 b8 5e 14 80 00 00 	movabs $0x80145e,%rax
+  803947:	00 00 00 
+  80394a:	ff d0                	call   *%rax
+  80394c:	eb a4                	jmp    8038f2 <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  80394e:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803952:	48 89 de             	mov    %rbx,%rsi
+  803955:	48 b8 83 36 80 00 00 	movabs $0x803683,%rax
+  80395c:	00 00 00 
+  80395f:	ff d0                	call   *%rax
+                return i;
+  803961:	4c 89 f0             	mov    %r14,%rax
+}
+  803964:	48 83 c4 28          	add    $0x28,%rsp
+  803968:	5b                   	pop    %rbx
+  803969:	41 5c                	pop    %r12
+  80396b:	41 5d                	pop    %r13
+  80396d:	41 5e                	pop    %r14
+  80396f:	41 5f                	pop    %r15
+  803971:	5d                   	pop    %rbp
+  803972:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803973:	48 63 c8             	movslq %eax,%rcx
+  803976:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  80397d:	80 80 80 
+  803980:	48 89 c8             	mov    %rcx,%rax
+  803983:	48 f7 e2             	mul    %rdx
+  803986:	48 c1 ea 0b          	shr    $0xb,%rdx
+  80398a:	48 89 d0             	mov    %rdx,%rax
+  80398d:	48 c1 e0 08          	shl    $0x8,%rax
+  803991:	48 29 d0             	sub    %rdx,%rax
+  803994:	48 c1 e0 04          	shl    $0x4,%rax
+  803998:	48 89 c2             	mov    %rax,%rdx
+  80399b:	48 89 c8             	mov    %rcx,%rax
+  80399e:	48 29 d0             	sub    %rdx,%rax
+  8039a1:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  8039a6:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8039aa:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  8039ae:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8039b1:	49 83 c6 01          	add    $0x1,%r14
+  8039b5:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  8039b9:	0f 85 2b ff ff ff    	jne    8038ea <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  8039bf:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  8039c3:	48 89 de             	mov    %rbx,%rsi
+  8039c6:	48 b8 83 36 80 00 00 	movabs $0x803683,%rax
+  8039cd:	00 00 00 
+  8039d0:	ff d0                	call   *%rax
+    return n;
+  8039d2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8039d6:	eb 8c                	jmp    803964 <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  8039d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039dd:	eb 85                	jmp    803964 <devpipe_read+0xc1>
+
+00000000008039df <pipe>:
+pipe(int pfd[2]) {
+  8039df:	55                   	push   %rbp
+  8039e0:	48 89 e5             	mov    %rsp,%rbp
+  8039e3:	41 55                	push   %r13
+  8039e5:	41 54                	push   %r12
+  8039e7:	53                   	push   %rbx
+  8039e8:	48 83 ec 18          	sub    $0x18,%rsp
+  8039ec:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8039ef:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8039f3:	48 b8 51 15 80 00 00 	movabs $0x801551,%rax
+  8039fa:	00 00 00 
+  8039fd:	ff d0                	call   *%rax
+  8039ff:	89 c3                	mov    %eax,%ebx
+  803a01:	85 c0                	test   %eax,%eax
+  803a03:	0f 88 a0 01 00 00    	js     803ba9 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803a09:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803a0e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a13:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803a17:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a1c:	48 b8 f0 10 80 00 00 	movabs $0x8010f0,%rax
+  803a23:	00 00 00 
+  803a26:	ff d0                	call   *%rax
+  803a28:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803a2a:	85 c0                	test   %eax,%eax
+  803a2c:	0f 88 77 01 00 00    	js     803ba9 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803a32:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803a36:	48 b8 51 15 80 00 00 	movabs $0x801551,%rax
+  803a3d:	00 00 00 
+  803a40:	ff d0                	call   *%rax
+  803a42:	89 c3                	mov    %eax,%ebx
+  803a44:	85 c0                	test   %eax,%eax
+  803a46:	0f 88 43 01 00 00    	js     803b8f <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803a4c:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803a51:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a56:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803a5a:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a5f:	48 b8 f0 10 80 00 00 	movabs $0x8010f0,%rax
+  803a66:	00 00 00 
+  803a69:	ff d0                	call   *%rax
+  803a6b:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803a6d:	85 c0                	test   %eax,%eax
+  803a6f:	0f 88 1a 01 00 00    	js     803b8f <pipe+0x1b0>
+    va = fd2data(fd0);
+  803a75:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803a79:	48 b8 35 15 80 00 00 	movabs $0x801535,%rax
+  803a80:	00 00 00 
+  803a83:	ff d0                	call   *%rax
+  803a85:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803a88:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803a8d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a92:	48 89 c6             	mov    %rax,%rsi
+  803a95:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a9a:	48 b8 f0 10 80 00 00 	movabs $0x8010f0,%rax
+  803aa1:	00 00 00 
+  803aa4:	ff d0                	call   *%rax
+  803aa6:	89 c3                	mov    %eax,%ebx
+  803aa8:	85 c0                	test   %eax,%eax
+  803aaa:	0f 88 c5 00 00 00    	js     803b75 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803ab0:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803ab4:	48 b8 35 15 80 00 00 	movabs $0x801535,%rax
+  803abb:	00 00 00 
+  803abe:	ff d0                	call   *%rax
+  803ac0:	48 89 c1             	mov    %rax,%rcx
+  803ac3:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803ac9:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803acf:	ba 00 00 00 00       	mov    $0x0,%edx
+  803ad4:	4c 89 ee             	mov    %r13,%rsi
+  803ad7:	bf 00 00 00 00       	mov    $0x0,%edi
+  803adc:	48 b8 46 11 80 00 00 	movabs $0x801146,%rax
+  803ae3:	00 00 00 
+  803ae6:	ff d0                	call   *%rax
+  803ae8:	89 c3                	mov    %eax,%ebx
+  803aea:	85 c0                	test   %eax,%eax
+  803aec:	78 6e                	js     803b5c <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803aee:	be 00 10 00 00       	mov    $0x1000,%esi
+  803af3:	4c 89 ef             	mov    %r13,%rdi
+  803af6:	48 b8 b5 10 80 00 00 	movabs $0x8010b5,%rax
+  803afd:	00 00 00 
+  803b00:	ff d0                	call   *%rax
+  803b02:	83 f8 02             	cmp    $0x2,%eax
+  803b05:	0f 85 ab 00 00 00    	jne    803bb6 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803b0b:	a1 60 50 80 00 00 00 	movabs 0x805060,%eax
+  803b12:	00 00 
+  803b14:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803b18:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803b1a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803b1e:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803b25:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803b29:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803b2b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803b2f:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803b36:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803b3a:	48 bb 23 15 80 00 00 	movabs $0x801523,%rbx
+  803b41:	00 00 00 
+  803b44:	ff d3                	call   *%rbx
+  803b46:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803b4a:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803b4e:	ff d3                	call   *%rbx
+  803b50:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803b55:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803b5a:	eb 4d                	jmp    803ba9 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803b5c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b61:	4c 89 ee             	mov    %r13,%rsi
+  803b64:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b69:	48 b8 96 11 80 00 00 	movabs $0x801196,%rax
+  803b70:	00 00 00 
+  803b73:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803b75:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b7a:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803b7e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b83:	48 b8 96 11 80 00 00 	movabs $0x801196,%rax
+  803b8a:	00 00 00 
+  803b8d:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803b8f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b94:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803b98:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b9d:	48 b8 96 11 80 00 00 	movabs $0x801196,%rax
+  803ba4:	00 00 00 
+  803ba7:	ff d0                	call   *%rax
+}
+  803ba9:	89 d8                	mov    %ebx,%eax
+  803bab:	48 83 c4 18          	add    $0x18,%rsp
+  803baf:	5b                   	pop    %rbx
+  803bb0:	41 5c                	pop    %r12
+  803bb2:	41 5d                	pop    %r13
+  803bb4:	5d                   	pop    %rbp
+  803bb5:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803bb6:	48 b9 30 4e 80 00 00 	movabs $0x804e30,%rcx
+  803bbd:	00 00 00 
+  803bc0:	48 ba 07 4e 80 00 00 	movabs $0x804e07,%rdx
+  803bc7:	00 00 00 
+  803bca:	be 50 00 00 00       	mov    $0x50,%esi
+  803bcf:	48 bf 1c 4e 80 00 00 	movabs $0x804e1c,%rdi
+  803bd6:	00 00 00 
+  803bd9:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bde:	49 b8 0e 42 80 00 00 	movabs $0x80420e,%r8
+  803be5:	00 00 00 
+  803be8:	41 ff d0             	call   *%r8
+
+0000000000803beb <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803beb:	55                   	push   %rbp
+  803bec:	48 89 e5             	mov    %rsp,%rbp
+  803bef:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803bf3:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803bf7:	48 b8 b1 15 80 00 00 	movabs $0x8015b1,%rax
+  803bfe:	00 00 00 
+  803c01:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803c03:	85 c0                	test   %eax,%eax
+  803c05:	78 23                	js     803c2a <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803c07:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803c0b:	48 b8 35 15 80 00 00 	movabs $0x801535,%rax
+  803c12:	00 00 00 
+  803c15:	ff d0                	call   *%rax
+  803c17:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  803c1a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803c1e:	48 b8 26 37 80 00 00 	movabs $0x803726,%rax
+  803c25:	00 00 00 
+  803c28:	ff d0                	call   *%rax
+}
+  803c2a:	c9                   	leave
+  803c2b:	c3                   	ret
+
+0000000000803c2c <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803c2c:	48 89 f8             	mov    %rdi,%rax
+  803c2f:	48 c1 e8 27          	shr    $0x27,%rax
+  803c33:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803c3a:	01 00 00 
+  803c3d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803c41:	f6 c2 01             	test   $0x1,%dl
+  803c44:	74 6d                	je     803cb3 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803c46:	48 89 f8             	mov    %rdi,%rax
+  803c49:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803c4d:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803c54:	01 00 00 
+  803c57:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803c5b:	f6 c2 01             	test   $0x1,%dl
+  803c5e:	74 62                	je     803cc2 <get_uvpt_entry+0x96>
+  803c60:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803c67:	01 00 00 
+  803c6a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803c6e:	f6 c2 80             	test   $0x80,%dl
+  803c71:	75 4f                	jne    803cc2 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803c73:	48 89 f8             	mov    %rdi,%rax
+  803c76:	48 c1 e8 15          	shr    $0x15,%rax
+  803c7a:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803c81:	01 00 00 
+  803c84:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803c88:	f6 c2 01             	test   $0x1,%dl
+  803c8b:	74 44                	je     803cd1 <get_uvpt_entry+0xa5>
+  803c8d:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803c94:	01 00 00 
+  803c97:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803c9b:	f6 c2 80             	test   $0x80,%dl
+  803c9e:	75 31                	jne    803cd1 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803ca0:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803ca4:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803cab:	01 00 00 
+  803cae:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803cb2:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803cb3:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803cba:	01 00 00 
+  803cbd:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803cc1:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803cc2:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803cc9:	01 00 00 
+  803ccc:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803cd0:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803cd1:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803cd8:	01 00 00 
+  803cdb:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803cdf:	c3                   	ret
+
+0000000000803ce0 <get_prot>:
+
+int
+get_prot(void *va) {
+  803ce0:	55                   	push   %rbp
+  803ce1:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803ce4:	48 b8 2c 3c 80 00 00 	movabs $0x803c2c,%rax
+  803ceb:	00 00 00 
+  803cee:	ff d0                	call   *%rax
+  803cf0:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803cf3:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803cf8:	89 c1                	mov    %eax,%ecx
+  803cfa:	83 c9 04             	or     $0x4,%ecx
+  803cfd:	f6 c2 01             	test   $0x1,%dl
+  803d00:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803d03:	89 c1                	mov    %eax,%ecx
+  803d05:	83 c9 02             	or     $0x2,%ecx
+  803d08:	f6 c2 02             	test   $0x2,%dl
+  803d0b:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803d0e:	89 c1                	mov    %eax,%ecx
+  803d10:	83 c9 01             	or     $0x1,%ecx
+  803d13:	48 85 d2             	test   %rdx,%rdx
+  803d16:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803d19:	89 c1                	mov    %eax,%ecx
+  803d1b:	83 c9 40             	or     $0x40,%ecx
+  803d1e:	f6 c6 04             	test   $0x4,%dh
+  803d21:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803d24:	5d                   	pop    %rbp
+  803d25:	c3                   	ret
+
+0000000000803d26 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803d26:	55                   	push   %rbp
+  803d27:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803d2a:	48 b8 2c 3c 80 00 00 	movabs $0x803c2c,%rax
+  803d31:	00 00 00 
+  803d34:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803d36:	48 c1 e8 06          	shr    $0x6,%rax
+  803d3a:	83 e0 01             	and    $0x1,%eax
+}
+  803d3d:	5d                   	pop    %rbp
+  803d3e:	c3                   	ret
+
+0000000000803d3f <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803d3f:	55                   	push   %rbp
+  803d40:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803d43:	48 b8 2c 3c 80 00 00 	movabs $0x803c2c,%rax
+  803d4a:	00 00 00 
+  803d4d:	ff d0                	call   *%rax
+  803d4f:	83 e0 01             	and    $0x1,%eax
+}
+  803d52:	5d                   	pop    %rbp
+  803d53:	c3                   	ret
+
+0000000000803d54 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  803d54:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  803d5b:	01 00 00 
+  803d5e:	a8 01                	test   $0x1,%al
+  803d60:	75 06                	jne    803d68 <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  803d62:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d67:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803d68:	55                   	push   %rbp
+  803d69:	48 89 e5             	mov    %rsp,%rbp
+  803d6c:	41 57                	push   %r15
+  803d6e:	41 56                	push   %r14
+  803d70:	41 55                	push   %r13
+  803d72:	41 54                	push   %r12
+  803d74:	53                   	push   %rbx
+  803d75:	48 83 ec 28          	sub    $0x28,%rsp
+  803d79:	49 89 fe             	mov    %rdi,%r14
+  803d7c:	49 89 f7             	mov    %rsi,%r15
+  803d7f:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  803d86:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  803d87:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  803d8e:	01 00 00 
+  803d91:	e9 ae 00 00 00       	jmp    803e44 <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  803d96:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803d9d:	49 83 ec 01          	sub    $0x1,%r12
+  803da1:	74 2d                	je     803dd0 <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  803da3:	48 89 d8             	mov    %rbx,%rax
+  803da6:	48 c1 e8 0c          	shr    $0xc,%rax
+  803daa:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  803daf:	f6 c2 01             	test   $0x1,%dl
+  803db2:	74 e2                	je     803d96 <foreach_shared_region+0x42>
+  803db4:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  803db9:	f6 c4 04             	test   $0x4,%ah
+  803dbc:	74 d8                	je     803d96 <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  803dbe:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803dc5:	4c 89 fa             	mov    %r15,%rdx
+  803dc8:	48 89 df             	mov    %rbx,%rdi
+  803dcb:	41 ff d6             	call   *%r14
+  803dce:	eb c6                	jmp    803d96 <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  803dd0:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  803dd7:	00 
+  803dd8:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  803ddd:	74 4a                	je     803e29 <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  803ddf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803de3:	48 c1 e8 15          	shr    $0x15,%rax
+  803de7:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  803dee:	01 00 00 
+  803df1:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  803df5:	a8 01                	test   $0x1,%al
+  803df7:	74 d7                	je     803dd0 <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  803df9:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  803dfd:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  803e04:	48 39 c3             	cmp    %rax,%rbx
+  803e07:	73 c7                	jae    803dd0 <foreach_shared_region+0x7c>
+  803e09:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  803e10:	48 39 d0             	cmp    %rdx,%rax
+  803e13:	4d 19 e4             	sbb    %r12,%r12
+  803e16:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  803e1d:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  803e24:	e9 7a ff ff ff       	jmp    803da3 <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  803e29:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  803e30:	40 
+  803e31:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803e35:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803e3c:	00 00 00 
+  803e3f:	48 39 c1             	cmp    %rax,%rcx
+  803e42:	74 50                	je     803e94 <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  803e44:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803e48:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803e4c:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  803e53:	01 00 00 
+  803e56:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  803e5a:	a8 01                	test   $0x1,%al
+  803e5c:	74 cb                	je     803e29 <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  803e5e:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803e62:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  803e69:	48 39 c1             	cmp    %rax,%rcx
+  803e6c:	73 bb                	jae    803e29 <foreach_shared_region+0xd5>
+  803e6e:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  803e75:	48 39 d0             	cmp    %rdx,%rax
+  803e78:	48 19 c0             	sbb    %rax,%rax
+  803e7b:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  803e81:	48 05 00 02 00 00    	add    $0x200,%rax
+  803e87:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803e8b:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803e8f:	e9 4b ff ff ff       	jmp    803ddf <foreach_shared_region+0x8b>
+  803e94:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e99:	48 83 c4 28          	add    $0x28,%rsp
+  803e9d:	5b                   	pop    %rbx
+  803e9e:	41 5c                	pop    %r12
+  803ea0:	41 5d                	pop    %r13
+  803ea2:	41 5e                	pop    %r14
+  803ea4:	41 5f                	pop    %r15
+  803ea6:	5d                   	pop    %rbp
+  803ea7:	c3                   	ret
+
+0000000000803ea8 <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  803ea8:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  803eae:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  803eb5:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  803ebc:	c3                   	ret
+
+0000000000803ebd <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  803ebd:	8b 47 40             	mov    0x40(%rdi),%eax
+  803ec0:	8b 17                	mov    (%rdi),%edx
+  803ec2:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  803ec4:	83 f8 0f             	cmp    $0xf,%eax
+  803ec7:	77 13                	ja     803edc <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  803ec9:	8b 47 40             	mov    0x40(%rdi),%eax
+  803ecc:	83 e0 0f             	and    $0xf,%eax
+  803ecf:	48 c1 e0 09          	shl    $0x9,%rax
+  803ed3:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  803eda:	00 
+  803edb:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  803edc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ee1:	c3                   	ret
+
+0000000000803ee2 <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  803ee2:	8b 47 40             	mov    0x40(%rdi),%eax
+  803ee5:	83 c0 01             	add    $0x1,%eax
+  803ee8:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803eeb:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  803ef1:	8b 57 04             	mov    0x4(%rdi),%edx
+  803ef4:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ef9:	85 d2                	test   %edx,%edx
+  803efb:	75 04                	jne    803f01 <chan_publish+0x1f>
+  803efd:	83 e0 01             	and    $0x1,%eax
+}
+  803f00:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  803f01:	87 47 04             	xchg   %eax,0x4(%rdi)
+  803f04:	85 c0                	test   %eax,%eax
+  803f06:	0f 95 c0             	setne  %al
+  803f09:	0f b6 c0             	movzbl %al,%eax
+  803f0c:	eb ef                	jmp    803efd <chan_publish+0x1b>
+
+0000000000803f0e <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  803f0e:	8b 47 40             	mov    0x40(%rdi),%eax
+  803f11:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  803f13:	29 d0                	sub    %edx,%eax
+  803f15:	83 e8 01             	sub    $0x1,%eax
+  803f18:	83 f8 0f             	cmp    $0xf,%eax
+  803f1b:	77 12                	ja     803f2f <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  803f1d:	8b 07                	mov    (%rdi),%eax
+  803f1f:	83 e0 0f             	and    $0xf,%eax
+  803f22:	48 c1 e0 09          	shl    $0x9,%rax
+  803f26:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  803f2d:	00 
+  803f2e:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  803f2f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f34:	c3                   	ret
+
+0000000000803f35 <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  803f35:	8b 07                	mov    (%rdi),%eax
+  803f37:	83 c0 01             	add    $0x1,%eax
+  803f3a:	89 07                	mov    %eax,(%rdi)
+}
+  803f3c:	c3                   	ret
+
+0000000000803f3d <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  803f3d:	55                   	push   %rbp
+  803f3e:	48 89 e5             	mov    %rsp,%rbp
+  803f41:	53                   	push   %rbx
+  803f42:	48 83 ec 08          	sub    $0x8,%rsp
+  803f46:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  803f49:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803f50:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  803f56:	48 b8 0e 3f 80 00 00 	movabs $0x803f0e,%rax
+  803f5d:	00 00 00 
+  803f60:	ff d0                	call   *%rax
+  803f62:	48 85 c0             	test   %rax,%rax
+  803f65:	74 12                	je     803f79 <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  803f67:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  803f6e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f73:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803f77:	c9                   	leave
+  803f78:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  803f79:	b8 01 00 00 00       	mov    $0x1,%eax
+  803f7e:	eb f3                	jmp    803f73 <chan_arm+0x36>
+
+0000000000803f80 <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  803f80:	55                   	push   %rbp
+  803f81:	48 89 e5             	mov    %rsp,%rbp
+  803f84:	41 56                	push   %r14
+  803f86:	41 55                	push   %r13
+  803f88:	41 54                	push   %r12
+  803f8a:	53                   	push   %rbx
+  803f8b:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  803f8e:	49 bc 3d 3f 80 00 00 	movabs $0x803f3d,%r12
+  803f95:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  803f98:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  803f9c:	49 bd 5e 14 80 00 00 	movabs $0x80145e,%r13
+  803fa3:	00 00 00 
+    while (chan_arm(r))
+  803fa6:	eb 0d                	jmp    803fb5 <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  803fa8:	8b 33                	mov    (%rbx),%esi
+  803faa:	ba 00 00 00 00       	mov    $0x0,%edx
+  803faf:	4c 89 f7             	mov    %r14,%rdi
+  803fb2:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  803fb5:	48 89 df             	mov    %rbx,%rdi
+  803fb8:	41 ff d4             	call   *%r12
+  803fbb:	84 c0                	test   %al,%al
+  803fbd:	75 e9                	jne    803fa8 <chan_wait+0x28>
+}
+  803fbf:	5b                   	pop    %rbx
+  803fc0:	41 5c                	pop    %r12
+  803fc2:	41 5d                	pop    %r13
+  803fc4:	41 5e                	pop    %r14
+  803fc6:	5d                   	pop    %rbp
+  803fc7:	c3                   	ret
+
+0000000000803fc8 <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  803fc8:	55                   	push   %rbp
+  803fc9:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  803fcc:	48 83 c7 40          	add    $0x40,%rdi
+  803fd0:	be 01 00 00 00       	mov    $0x1,%esi
+  803fd5:	48 b8 7c 14 80 00 00 	movabs $0x80147c,%rax
+  803fdc:	00 00 00 
+  803fdf:	ff d0                	call   *%rax
+}
+  803fe1:	5d                   	pop    %rbp
+  803fe2:	c3                   	ret
+
+0000000000803fe3 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803fe3:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fe8:	c3                   	ret
+
+0000000000803fe9 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803fe9:	55                   	push   %rbp
+  803fea:	48 89 e5             	mov    %rsp,%rbp
+  803fed:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803ff0:	48 be 54 4e 80 00 00 	movabs $0x804e54,%rsi
+  803ff7:	00 00 00 
+  803ffa:	48 b8 91 0b 80 00 00 	movabs $0x800b91,%rax
+  804001:	00 00 00 
+  804004:	ff d0                	call   *%rax
+    return 0;
+}
+  804006:	b8 00 00 00 00       	mov    $0x0,%eax
+  80400b:	5d                   	pop    %rbp
+  80400c:	c3                   	ret
+
+000000000080400d <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80400d:	55                   	push   %rbp
+  80400e:	48 89 e5             	mov    %rsp,%rbp
+  804011:	41 57                	push   %r15
+  804013:	41 56                	push   %r14
+  804015:	41 55                	push   %r13
+  804017:	41 54                	push   %r12
+  804019:	53                   	push   %rbx
+  80401a:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  804021:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  804028:	48 85 d2             	test   %rdx,%rdx
+  80402b:	74 7a                	je     8040a7 <devcons_write+0x9a>
+  80402d:	49 89 d6             	mov    %rdx,%r14
+  804030:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804036:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80403b:	49 bf 8b 0d 80 00 00 	movabs $0x800d8b,%r15
+  804042:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804045:	4c 89 f3             	mov    %r14,%rbx
+  804048:	48 29 f3             	sub    %rsi,%rbx
+  80404b:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804050:	48 39 c3             	cmp    %rax,%rbx
+  804053:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804057:	4c 63 eb             	movslq %ebx,%r13
+  80405a:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804061:	48 01 c6             	add    %rax,%rsi
+  804064:	4c 89 ea             	mov    %r13,%rdx
+  804067:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80406e:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  804071:	4c 89 ee             	mov    %r13,%rsi
+  804074:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80407b:	48 b8 b8 0f 80 00 00 	movabs $0x800fb8,%rax
+  804082:	00 00 00 
+  804085:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804087:	41 01 dc             	add    %ebx,%r12d
+  80408a:	49 63 f4             	movslq %r12d,%rsi
+  80408d:	4c 39 f6             	cmp    %r14,%rsi
+  804090:	72 b3                	jb     804045 <devcons_write+0x38>
+    return res;
+  804092:	49 63 c4             	movslq %r12d,%rax
+}
+  804095:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80409c:	5b                   	pop    %rbx
+  80409d:	41 5c                	pop    %r12
+  80409f:	41 5d                	pop    %r13
+  8040a1:	41 5e                	pop    %r14
+  8040a3:	41 5f                	pop    %r15
+  8040a5:	5d                   	pop    %rbp
+  8040a6:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8040a7:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8040ad:	eb e3                	jmp    804092 <devcons_write+0x85>
+
+00000000008040af <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8040af:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8040b2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8040b7:	48 85 c0             	test   %rax,%rax
+  8040ba:	74 55                	je     804111 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8040bc:	55                   	push   %rbp
+  8040bd:	48 89 e5             	mov    %rsp,%rbp
+  8040c0:	41 55                	push   %r13
+  8040c2:	41 54                	push   %r12
+  8040c4:	53                   	push   %rbx
+  8040c5:	48 83 ec 08          	sub    $0x8,%rsp
+  8040c9:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8040cc:	48 bb d7 0f 80 00 00 	movabs $0x800fd7,%rbx
+  8040d3:	00 00 00 
+  8040d6:	49 bc 8c 10 80 00 00 	movabs $0x80108c,%r12
+  8040dd:	00 00 00 
+  8040e0:	eb 03                	jmp    8040e5 <devcons_read+0x36>
+  8040e2:	41 ff d4             	call   *%r12
+  8040e5:	ff d3                	call   *%rbx
+  8040e7:	85 c0                	test   %eax,%eax
+  8040e9:	74 f7                	je     8040e2 <devcons_read+0x33>
+    if (c < 0) return c;
+  8040eb:	48 63 d0             	movslq %eax,%rdx
+  8040ee:	78 13                	js     804103 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8040f0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8040f5:	83 f8 04             	cmp    $0x4,%eax
+  8040f8:	74 09                	je     804103 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8040fa:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8040fe:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804103:	48 89 d0             	mov    %rdx,%rax
+  804106:	48 83 c4 08          	add    $0x8,%rsp
+  80410a:	5b                   	pop    %rbx
+  80410b:	41 5c                	pop    %r12
+  80410d:	41 5d                	pop    %r13
+  80410f:	5d                   	pop    %rbp
+  804110:	c3                   	ret
+  804111:	48 89 d0             	mov    %rdx,%rax
+  804114:	c3                   	ret
+
+0000000000804115 <cputchar>:
+cputchar(int ch) {
+  804115:	55                   	push   %rbp
+  804116:	48 89 e5             	mov    %rsp,%rbp
+  804119:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  80411d:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  804121:	be 01 00 00 00       	mov    $0x1,%esi
+  804126:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  80412a:	48 b8 b8 0f 80 00 00 	movabs $0x800fb8,%rax
+  804131:	00 00 00 
+  804134:	ff d0                	call   *%rax
+}
+  804136:	c9                   	leave
+  804137:	c3                   	ret
+
+0000000000804138 <getchar>:
+getchar(void) {
+  804138:	55                   	push   %rbp
+  804139:	48 89 e5             	mov    %rsp,%rbp
+  80413c:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  804140:	ba 01 00 00 00       	mov    $0x1,%edx
+  804145:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  804149:	bf 00 00 00 00       	mov    $0x0,%edi
+  80414e:	48 b8 94 18 80 00 00 	movabs $0x801894,%rax
+  804155:	00 00 00 
+  804158:	ff d0                	call   *%rax
+  80415a:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80415c:	85 c0                	test   %eax,%eax
+  80415e:	78 06                	js     804166 <getchar+0x2e>
+  804160:	74 08                	je     80416a <getchar+0x32>
+  804162:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804166:	89 d0                	mov    %edx,%eax
+  804168:	c9                   	leave
+  804169:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  80416a:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80416f:	eb f5                	jmp    804166 <getchar+0x2e>
+
+0000000000804171 <iscons>:
+iscons(int fdnum) {
+  804171:	55                   	push   %rbp
+  804172:	48 89 e5             	mov    %rsp,%rbp
+  804175:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804179:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80417d:	48 b8 b1 15 80 00 00 	movabs $0x8015b1,%rax
+  804184:	00 00 00 
+  804187:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804189:	85 c0                	test   %eax,%eax
+  80418b:	78 18                	js     8041a5 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80418d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804191:	48 b8 a0 50 80 00 00 	movabs $0x8050a0,%rax
+  804198:	00 00 00 
+  80419b:	8b 00                	mov    (%rax),%eax
+  80419d:	39 02                	cmp    %eax,(%rdx)
+  80419f:	0f 94 c0             	sete   %al
+  8041a2:	0f b6 c0             	movzbl %al,%eax
+}
+  8041a5:	c9                   	leave
+  8041a6:	c3                   	ret
+
+00000000008041a7 <opencons>:
+opencons(void) {
+  8041a7:	55                   	push   %rbp
+  8041a8:	48 89 e5             	mov    %rsp,%rbp
+  8041ab:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8041af:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8041b3:	48 b8 51 15 80 00 00 	movabs $0x801551,%rax
+  8041ba:	00 00 00 
+  8041bd:	ff d0                	call   *%rax
+  8041bf:	85 c0                	test   %eax,%eax
+  8041c1:	78 49                	js     80420c <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8041c3:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8041c8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8041cd:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8041d1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8041d6:	48 b8 f0 10 80 00 00 	movabs $0x8010f0,%rax
+  8041dd:	00 00 00 
+  8041e0:	ff d0                	call   *%rax
+  8041e2:	85 c0                	test   %eax,%eax
+  8041e4:	78 26                	js     80420c <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8041e6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8041ea:	a1 a0 50 80 00 00 00 	movabs 0x8050a0,%eax
+  8041f1:	00 00 
+  8041f3:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8041f5:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8041f9:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  804200:	48 b8 23 15 80 00 00 	movabs $0x801523,%rax
+  804207:	00 00 00 
+  80420a:	ff d0                	call   *%rax
+}
+  80420c:	c9                   	leave
+  80420d:	c3                   	ret
+
+000000000080420e <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80420e:	55                   	push   %rbp
+  80420f:	48 89 e5             	mov    %rsp,%rbp
+  804212:	41 56                	push   %r14
+  804214:	41 55                	push   %r13
+  804216:	41 54                	push   %r12
+  804218:	53                   	push   %rbx
+  804219:	48 83 ec 50          	sub    $0x50,%rsp
+  80421d:	49 89 fc             	mov    %rdi,%r12
+  804220:	41 89 f5             	mov    %esi,%r13d
+  804223:	48 89 d3             	mov    %rdx,%rbx
+  804226:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80422a:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80422e:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  804232:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  804239:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80423d:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  804241:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  804245:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  804249:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  804250:	00 00 00 
+  804253:	4c 8b 30             	mov    (%rax),%r14
+  804256:	48 b8 63 10 80 00 00 	movabs $0x801063,%rax
+  80425d:	00 00 00 
+  804260:	ff d0                	call   *%rax
+  804262:	89 c6                	mov    %eax,%esi
+  804264:	45 89 e8             	mov    %r13d,%r8d
+  804267:	4c 89 e1             	mov    %r12,%rcx
+  80426a:	4c 89 f2             	mov    %r14,%rdx
+  80426d:	48 bf 60 4e 80 00 00 	movabs $0x804e60,%rdi
+  804274:	00 00 00 
+  804277:	b8 00 00 00 00       	mov    $0x0,%eax
+  80427c:	49 bc 6c 02 80 00 00 	movabs $0x80026c,%r12
+  804283:	00 00 00 
+  804286:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  804289:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80428d:	48 89 df             	mov    %rbx,%rdi
+  804290:	48 b8 08 02 80 00 00 	movabs $0x800208,%rax
+  804297:	00 00 00 
+  80429a:	ff d0                	call   *%rax
+    cprintf("\n");
+  80429c:	48 bf a3 4d 80 00 00 	movabs $0x804da3,%rdi
+  8042a3:	00 00 00 
+  8042a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042ab:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8042ae:	cc                   	int3
+  8042af:	eb fd                	jmp    8042ae <_panic+0xa0>
+
+00000000008042b1 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  8042b1:	55                   	push   %rbp
+  8042b2:	48 89 e5             	mov    %rsp,%rbp
+  8042b5:	41 56                	push   %r14
+  8042b7:	41 55                	push   %r13
+  8042b9:	41 54                	push   %r12
+  8042bb:	53                   	push   %rbx
+  8042bc:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8042bf:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  8042c6:	00 00 00 
+  8042c9:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8042cd:	74 27                	je     8042f6 <_handle_vectored_pagefault+0x45>
+  8042cf:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  8042d4:	49 bd 00 10 84 00 00 	movabs $0x841000,%r13
+  8042db:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8042de:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  8042e1:	4c 89 e7             	mov    %r12,%rdi
+  8042e4:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  8042e9:	84 c0                	test   %al,%al
+  8042eb:	75 45                	jne    804332 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8042ed:	48 83 c3 01          	add    $0x1,%rbx
+  8042f1:	49 3b 1e             	cmp    (%r14),%rbx
+  8042f4:	72 eb                	jb     8042e1 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  8042f6:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  8042fd:	00 
+  8042fe:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  804303:	4d 8b 04 24          	mov    (%r12),%r8
+  804307:	48 ba 88 4e 80 00 00 	movabs $0x804e88,%rdx
+  80430e:	00 00 00 
+  804311:	be 1d 00 00 00       	mov    $0x1d,%esi
+  804316:	48 bf b8 4e 80 00 00 	movabs $0x804eb8,%rdi
+  80431d:	00 00 00 
+  804320:	b8 00 00 00 00       	mov    $0x0,%eax
+  804325:	49 ba 0e 42 80 00 00 	movabs $0x80420e,%r10
+  80432c:	00 00 00 
+  80432f:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  804332:	5b                   	pop    %rbx
+  804333:	41 5c                	pop    %r12
+  804335:	41 5d                	pop    %r13
+  804337:	41 5e                	pop    %r14
+  804339:	5d                   	pop    %rbp
+  80433a:	c3                   	ret
+
+000000000080433b <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  80433b:	55                   	push   %rbp
+  80433c:	48 89 e5             	mov    %rsp,%rbp
+  80433f:	53                   	push   %rbx
+  804340:	48 83 ec 08          	sub    $0x8,%rsp
+  804344:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  804347:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  80434e:	00 00 00 
+  804351:	80 38 00             	cmpb   $0x0,(%rax)
+  804354:	0f 84 84 00 00 00    	je     8043de <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80435a:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  804361:	00 00 00 
+  804364:	48 8b 10             	mov    (%rax),%rdx
+  804367:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  80436c:	48 b9 00 10 84 00 00 	movabs $0x841000,%rcx
+  804373:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804376:	48 85 d2             	test   %rdx,%rdx
+  804379:	74 19                	je     804394 <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  80437b:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  80437f:	0f 84 e8 00 00 00    	je     80446d <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804385:	48 83 c0 01          	add    $0x1,%rax
+  804389:	48 39 d0             	cmp    %rdx,%rax
+  80438c:	75 ed                	jne    80437b <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  80438e:	48 83 fa 08          	cmp    $0x8,%rdx
+  804392:	74 1c                	je     8043b0 <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  804394:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  804398:	48 a3 48 10 84 00 00 	movabs %rax,0x841048
+  80439f:	00 00 00 
+  8043a2:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  8043a9:	00 00 00 
+  8043ac:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  8043b0:	48 b8 63 10 80 00 00 	movabs $0x801063,%rax
+  8043b7:	00 00 00 
+  8043ba:	ff d0                	call   *%rax
+  8043bc:	89 c7                	mov    %eax,%edi
+  8043be:	48 be 33 45 80 00 00 	movabs $0x804533,%rsi
+  8043c5:	00 00 00 
+  8043c8:	48 b8 ae 12 80 00 00 	movabs $0x8012ae,%rax
+  8043cf:	00 00 00 
+  8043d2:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8043d4:	85 c0                	test   %eax,%eax
+  8043d6:	78 68                	js     804440 <add_pgfault_handler+0x105>
+    return res;
+}
+  8043d8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8043dc:	c9                   	leave
+  8043dd:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  8043de:	48 b8 63 10 80 00 00 	movabs $0x801063,%rax
+  8043e5:	00 00 00 
+  8043e8:	ff d0                	call   *%rax
+  8043ea:	89 c7                	mov    %eax,%edi
+  8043ec:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8043f1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8043f6:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  8043fd:	00 00 00 
+  804400:	48 b8 f0 10 80 00 00 	movabs $0x8010f0,%rax
+  804407:	00 00 00 
+  80440a:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  80440c:	48 ba 48 10 84 00 00 	movabs $0x841048,%rdx
+  804413:	00 00 00 
+  804416:	48 8b 02             	mov    (%rdx),%rax
+  804419:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80441d:	48 89 0a             	mov    %rcx,(%rdx)
+  804420:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  804427:	00 00 00 
+  80442a:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  80442e:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  804435:	00 00 00 
+  804438:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  80443b:	e9 70 ff ff ff       	jmp    8043b0 <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  804440:	89 c1                	mov    %eax,%ecx
+  804442:	48 ba c6 4e 80 00 00 	movabs $0x804ec6,%rdx
+  804449:	00 00 00 
+  80444c:	be 3d 00 00 00       	mov    $0x3d,%esi
+  804451:	48 bf b8 4e 80 00 00 	movabs $0x804eb8,%rdi
+  804458:	00 00 00 
+  80445b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804460:	49 b8 0e 42 80 00 00 	movabs $0x80420e,%r8
+  804467:	00 00 00 
+  80446a:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  80446d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804472:	e9 61 ff ff ff       	jmp    8043d8 <add_pgfault_handler+0x9d>
+
+0000000000804477 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  804477:	55                   	push   %rbp
+  804478:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  80447b:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  804482:	00 00 00 
+  804485:	80 38 00             	cmpb   $0x0,(%rax)
+  804488:	74 33                	je     8044bd <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80448a:	48 a1 48 10 84 00 00 	movabs 0x841048,%rax
+  804491:	00 00 00 
+  804494:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  804499:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  8044a0:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8044a3:	48 85 c0             	test   %rax,%rax
+  8044a6:	0f 84 85 00 00 00    	je     804531 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  8044ac:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  8044b0:	74 40                	je     8044f2 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8044b2:	48 83 c1 01          	add    $0x1,%rcx
+  8044b6:	48 39 c1             	cmp    %rax,%rcx
+  8044b9:	75 f1                	jne    8044ac <remove_pgfault_handler+0x35>
+  8044bb:	eb 74                	jmp    804531 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  8044bd:	48 b9 de 4e 80 00 00 	movabs $0x804ede,%rcx
+  8044c4:	00 00 00 
+  8044c7:	48 ba 07 4e 80 00 00 	movabs $0x804e07,%rdx
+  8044ce:	00 00 00 
+  8044d1:	be 43 00 00 00       	mov    $0x43,%esi
+  8044d6:	48 bf b8 4e 80 00 00 	movabs $0x804eb8,%rdi
+  8044dd:	00 00 00 
+  8044e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044e5:	49 b8 0e 42 80 00 00 	movabs $0x80420e,%r8
+  8044ec:	00 00 00 
+  8044ef:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  8044f2:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  8044f9:	00 
+  8044fa:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8044fe:	48 29 ca             	sub    %rcx,%rdx
+  804501:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  804508:	00 00 00 
+  80450b:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  80450f:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  804514:	48 89 ce             	mov    %rcx,%rsi
+  804517:	48 b8 8b 0d 80 00 00 	movabs $0x800d8b,%rax
+  80451e:	00 00 00 
+  804521:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  804523:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  80452a:	00 00 00 
+  80452d:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  804531:	5d                   	pop    %rbp
+  804532:	c3                   	ret
+
+0000000000804533 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  804533:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  804536:	48 b8 b1 42 80 00 00 	movabs $0x8042b1,%rax
+  80453d:	00 00 00 
+    call *%rax
+  804540:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  804542:	41 5f                	pop    %r15
+	popq %r15
+  804544:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  804546:	41 5f                	pop    %r15
+	popq %r14
+  804548:	41 5e                	pop    %r14
+	popq %r13
+  80454a:	41 5d                	pop    %r13
+	popq %r12
+  80454c:	41 5c                	pop    %r12
+	popq %r11
+  80454e:	41 5b                	pop    %r11
+	popq %r10
+  804550:	41 5a                	pop    %r10
+	popq %r9
+  804552:	41 59                	pop    %r9
+	popq %r8
+  804554:	41 58                	pop    %r8
+	popq %rsi
+  804556:	5e                   	pop    %rsi
+	popq %rdi
+  804557:	5f                   	pop    %rdi
+	popq %rbp
+  804558:	5d                   	pop    %rbp
+	popq %rdx
+  804559:	5a                   	pop    %rdx
+	popq %rcx
+  80455a:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  80455b:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  804560:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  804565:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  804569:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  80456c:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  804571:	5b                   	pop    %rbx
+	popq %rax
+  804572:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  804573:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  804577:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  804578:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  80457d:	c3                   	ret
+
+000000000080457e <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  80457e:	55                   	push   %rbp
+  80457f:	48 89 e5             	mov    %rsp,%rbp
+  804582:	41 55                	push   %r13
+  804584:	41 54                	push   %r12
+  804586:	53                   	push   %rbx
+  804587:	48 83 ec 08          	sub    $0x8,%rsp
+  80458b:	49 89 fd             	mov    %rdi,%r13
+  80458e:	48 89 f7             	mov    %rsi,%rdi
+  804591:	48 89 d3             	mov    %rdx,%rbx
+  804594:	49 89 cc             	mov    %rcx,%r12
+  804597:	4c 89 c2             	mov    %r8,%rdx
+  80459a:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80459d:	48 85 f6             	test   %rsi,%rsi
+  8045a0:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8045a7:	00 00 00 
+  8045aa:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  8045ae:	be 00 10 00 00       	mov    $0x1000,%esi
+  8045b3:	48 85 db             	test   %rbx,%rbx
+  8045b6:	74 03                	je     8045bb <ipc_recv_futex+0x3d>
+  8045b8:	48 8b 33             	mov    (%rbx),%rsi
+  8045bb:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  8045bf:	48 b8 3a 13 80 00 00 	movabs $0x80133a,%rax
+  8045c6:	00 00 00 
+  8045c9:	ff d0                	call   *%rax
+    if (res < 0) {
+  8045cb:	85 c0                	test   %eax,%eax
+  8045cd:	78 75                	js     804644 <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  8045cf:	4d 85 ed             	test   %r13,%r13
+  8045d2:	74 14                	je     8045e8 <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  8045d4:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8045db:	00 00 00 
+  8045de:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  8045e4:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  8045e8:	4d 85 e4             	test   %r12,%r12
+  8045eb:	74 14                	je     804601 <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  8045ed:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8045f4:	00 00 00 
+  8045f7:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  8045fd:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  804601:	48 85 db             	test   %rbx,%rbx
+  804604:	74 23                	je     804629 <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804606:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80460d:	00 00 00 
+  804610:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  804616:	ba 00 00 00 00       	mov    $0x0,%edx
+  80461b:	85 c9                	test   %ecx,%ecx
+  80461d:	74 07                	je     804626 <ipc_recv_futex+0xa8>
+  80461f:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  804626:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  804629:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804630:	00 00 00 
+  804633:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  804639:	48 83 c4 08          	add    $0x8,%rsp
+  80463d:	5b                   	pop    %rbx
+  80463e:	41 5c                	pop    %r12
+  804640:	41 5d                	pop    %r13
+  804642:	5d                   	pop    %rbp
+  804643:	c3                   	ret
+        if (from_env_store != NULL) {
+  804644:	4d 85 ed             	test   %r13,%r13
+  804647:	74 08                	je     804651 <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  804649:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804650:	00 
+        if (perm_store != NULL) {
+  804651:	4d 85 e4             	test   %r12,%r12
+  804654:	74 08                	je     80465e <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  804656:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80465d:	00 
+        if (size != NULL) {
+  80465e:	48 85 db             	test   %rbx,%rbx
+  804661:	74 d6                	je     804639 <ipc_recv_futex+0xbb>
+            *size = 0;
+  804663:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  80466a:	eb cd                	jmp    804639 <ipc_recv_futex+0xbb>
+
+000000000080466c <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80466c:	55                   	push   %rbp
+  80466d:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  804670:	48 83 ec 08          	sub    $0x8,%rsp
+  804674:	6a 00                	push   $0x0
+  804676:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80467c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804682:	48 b8 7e 45 80 00 00 	movabs $0x80457e,%rax
+  804689:	00 00 00 
+  80468c:	ff d0                	call   *%rax
+}
+  80468e:	c9                   	leave
+  80468f:	c3                   	ret
+
+0000000000804690 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  804690:	55                   	push   %rbp
+  804691:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804694:	48 85 d2             	test   %rdx,%rdx
+  804697:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80469e:	00 00 00 
+  8046a1:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  8046a5:	89 f6                	mov    %esi,%esi
+  8046a7:	48 b8 23 13 80 00 00 	movabs $0x801323,%rax
+  8046ae:	00 00 00 
+  8046b1:	ff d0                	call   *%rax
+    if (res < 0) {
+  8046b3:	85 c0                	test   %eax,%eax
+  8046b5:	78 02                	js     8046b9 <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  8046b7:	5d                   	pop    %rbp
+  8046b8:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  8046b9:	89 c1                	mov    %eax,%ecx
+  8046bb:	48 ba f8 4e 80 00 00 	movabs $0x804ef8,%rdx
+  8046c2:	00 00 00 
+  8046c5:	be 50 00 00 00       	mov    $0x50,%esi
+  8046ca:	48 bf 0c 4f 80 00 00 	movabs $0x804f0c,%rdi
+  8046d1:	00 00 00 
+  8046d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046d9:	49 b8 0e 42 80 00 00 	movabs $0x80420e,%r8
+  8046e0:	00 00 00 
+  8046e3:	41 ff d0             	call   *%r8
+
+00000000008046e6 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8046e6:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  8046eb:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8046f2:	00 00 00 
+  8046f5:	48 89 d0             	mov    %rdx,%rax
+  8046f8:	48 c1 e0 04          	shl    $0x4,%rax
+  8046fc:	48 29 d0             	sub    %rdx,%rax
+  8046ff:	48 c1 e0 05          	shl    $0x5,%rax
+  804703:	48 01 c8             	add    %rcx,%rax
+  804706:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  80470c:	39 f8                	cmp    %edi,%eax
+  80470e:	74 13                	je     804723 <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  804710:	48 83 c2 01          	add    $0x1,%rdx
+  804714:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  80471b:	75 d8                	jne    8046f5 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80471d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804722:	c3                   	ret
+            return envs[i].env_id;
+  804723:	48 89 d0             	mov    %rdx,%rax
+  804726:	48 c1 e0 04          	shl    $0x4,%rax
+  80472a:	48 29 d0             	sub    %rdx,%rax
+  80472d:	48 c1 e0 05          	shl    $0x5,%rax
+  804731:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804738:	00 00 00 
+  80473b:	48 01 d0             	add    %rdx,%rax
+  80473e:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804744:	c3                   	ret
+  804745:	0f 1f 00             	nopl   (%rax)
+
+0000000000804748 <__rodata_start>:
+  804748:	48                   	rex.W
+  804749:	65 6c                	gs insb (%dx),%es:(%rdi)
+  80474b:	6c                   	insb   (%dx),%es:(%rdi)
+  80474c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80474d:	2c 20                	sub    $0x20,%al
+  80474f:	49 20 61 6d          	rex.WB and %spl,0x6d(%r9)
+  804753:	20 65 6e             	and    %ah,0x6e(%rbp)
+  804756:	76 69                	jbe    8047c1 <__rodata_start+0x79>
+  804758:	72 6f                	jb     8047c9 <__rodata_start+0x81>
+  80475a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80475b:	6d                   	insl   (%dx),%es:(%rdi)
+  80475c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80475e:	74 20                	je     804780 <__rodata_start+0x38>
+  804760:	25 30 38 78 2e       	and    $0x2e783830,%eax
+  804765:	0a 00                	or     (%rax),%al
+  804767:	00 42 61             	add    %al,0x61(%rdx)
+  80476a:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  80476d:	69 6e 20 65 6e 76 69 	imul   $0x69766e65,0x20(%rsi),%ebp
+  804774:	72 6f                	jb     8047e5 <__rodata_start+0x9d>
+  804776:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804777:	6d                   	insl   (%dx),%es:(%rdi)
+  804778:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80477a:	74 20                	je     80479c <__rodata_start+0x54>
+  80477c:	25 30 38 78 2c       	and    $0x2c783830,%eax
+  804781:	20 69 74             	and    %ch,0x74(%rcx)
+  804784:	65 72 61             	gs jb  8047e8 <__rodata_start+0xa0>
+  804787:	74 69                	je     8047f2 <__rodata_start+0xaa>
+  804789:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80478a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80478b:	20 25 64 2e 0a 00    	and    %ah,0xa2e64(%rip)        # 8a75f5 <__bss_end+0x655f5>
+  804791:	00 00                	add    %al,(%rax)
+  804793:	00 00                	add    %al,(%rax)
+  804795:	00 00                	add    %al,(%rax)
+  804797:	00 41 6c             	add    %al,0x6c(%rcx)
+  80479a:	6c                   	insb   (%dx),%es:(%rdi)
+  80479b:	20 64 6f 6e          	and    %ah,0x6e(%rdi,%rbp,2)
+  80479f:	65 20 69 6e          	and    %ch,%gs:0x6e(%rcx)
+  8047a3:	20 65 6e             	and    %ah,0x6e(%rbp)
+  8047a6:	76 69                	jbe    804811 <__rodata_start+0xc9>
+  8047a8:	72 6f                	jb     804819 <__rodata_start+0xd1>
+  8047aa:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8047ab:	6d                   	insl   (%dx),%es:(%rdi)
+  8047ac:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8047ae:	74 20                	je     8047d0 <__rodata_start+0x88>
+  8047b0:	25 30 38 78 2e       	and    $0x2e783830,%eax
+  8047b5:	0a 00                	or     (%rax),%al
+  8047b7:	3c 75                	cmp    $0x75,%al
+  8047b9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8047ba:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8047be:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8047bf:	3e 00 30             	ds add %dh,(%rax)
+  8047c2:	31 32                	xor    %esi,(%rdx)
+  8047c4:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8047cb:	41                   	rex.B
+  8047cc:	42                   	rex.X
+  8047cd:	43                   	rex.XB
+  8047ce:	44                   	rex.R
+  8047cf:	45                   	rex.RB
+  8047d0:	46 00 30             	rex.RX add %r14b,(%rax)
+  8047d3:	31 32                	xor    %esi,(%rdx)
+  8047d5:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8047dc:	61                   	(bad)
+  8047dd:	62 63 64 65 66       	(bad)
+  8047e2:	00 28                	add    %ch,(%rax)
+  8047e4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8047e5:	75 6c                	jne    804853 <__rodata_start+0x10b>
+  8047e7:	6c                   	insb   (%dx),%es:(%rdi)
+  8047e8:	29 00                	sub    %eax,(%rax)
+  8047ea:	65 72 72             	gs jb  80485f <__rodata_start+0x117>
+  8047ed:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8047ee:	72 20                	jb     804810 <__rodata_start+0xc8>
+  8047f0:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  8047f5:	73 70                	jae    804867 <__rodata_start+0x11f>
+  8047f7:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  8047fb:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  804802:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804803:	72 00                	jb     804805 <__rodata_start+0xbd>
+  804805:	62 61 64 20 65       	(bad)
+  80480a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80480b:	76 69                	jbe    804876 <__rodata_start+0x12e>
+  80480d:	72 6f                	jb     80487e <__rodata_start+0x136>
+  80480f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804810:	6d                   	insl   (%dx),%es:(%rdi)
+  804811:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804813:	74 00                	je     804815 <__rodata_start+0xcd>
+  804815:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80481c:	20 70 61             	and    %dh,0x61(%rax)
+  80481f:	72 61                	jb     804882 <__rodata_start+0x13a>
+  804821:	6d                   	insl   (%dx),%es:(%rdi)
+  804822:	65 74 65             	gs je  80488a <__rodata_start+0x142>
+  804825:	72 00                	jb     804827 <__rodata_start+0xdf>
+  804827:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804828:	75 74                	jne    80489e <__rodata_start+0x156>
+  80482a:	20 6f 66             	and    %ch,0x66(%rdi)
+  80482d:	20 6d 65             	and    %ch,0x65(%rbp)
+  804830:	6d                   	insl   (%dx),%es:(%rdi)
+  804831:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804832:	72 79                	jb     8048ad <__rodata_start+0x165>
+  804834:	00 6f 75             	add    %ch,0x75(%rdi)
+  804837:	74 20                	je     804859 <__rodata_start+0x111>
+  804839:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80483a:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  80483e:	76 69                	jbe    8048a9 <__rodata_start+0x161>
+  804840:	72 6f                	jb     8048b1 <__rodata_start+0x169>
+  804842:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804843:	6d                   	insl   (%dx),%es:(%rdi)
+  804844:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804846:	74 73                	je     8048bb <__rodata_start+0x173>
+  804848:	00 63 6f             	add    %ah,0x6f(%rbx)
+  80484b:	72 72                	jb     8048bf <__rodata_start+0x177>
+  80484d:	75 70                	jne    8048bf <__rodata_start+0x177>
+  80484f:	74 65                	je     8048b6 <__rodata_start+0x16e>
+  804851:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  804856:	75 67                	jne    8048bf <__rodata_start+0x177>
+  804858:	20 69 6e             	and    %ch,0x6e(%rcx)
+  80485b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80485d:	00 73 65             	add    %dh,0x65(%rbx)
+  804860:	67 6d                	insl   (%dx),%es:(%edi)
+  804862:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804864:	74 61                	je     8048c7 <__rodata_start+0x17f>
+  804866:	74 69                	je     8048d1 <__rodata_start+0x189>
+  804868:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804869:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80486a:	20 66 61             	and    %ah,0x61(%rsi)
+  80486d:	75 6c                	jne    8048db <__rodata_start+0x193>
+  80486f:	74 00                	je     804871 <__rodata_start+0x129>
+  804871:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  804878:	20 45 4c             	and    %al,0x4c(%rbp)
+  80487b:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  80487f:	61                   	(bad)
+  804880:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  804885:	20 73 75             	and    %dh,0x75(%rbx)
+  804888:	63 68 20             	movsxd 0x20(%rax),%ebp
+  80488b:	73 79                	jae    804906 <__rodata_start+0x1be>
+  80488d:	73 74                	jae    804903 <__rodata_start+0x1bb>
+  80488f:	65 6d                	gs insl (%dx),%es:(%rdi)
+  804891:	20 63 61             	and    %ah,0x61(%rbx)
+  804894:	6c                   	insb   (%dx),%es:(%rdi)
+  804895:	6c                   	insb   (%dx),%es:(%rdi)
+  804896:	00 65 6e             	add    %ah,0x6e(%rbp)
+  804899:	74 72                	je     80490d <__rodata_start+0x1c5>
+  80489b:	79 20                	jns    8048bd <__rodata_start+0x175>
+  80489d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80489e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80489f:	74 20                	je     8048c1 <__rodata_start+0x179>
+  8048a1:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8048a3:	75 6e                	jne    804913 <__rodata_start+0x1cb>
+  8048a5:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  8048a9:	76 20                	jbe    8048cb <__rodata_start+0x183>
+  8048ab:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  8048b2:	72 65                	jb     804919 <__rodata_start+0x1d1>
+  8048b4:	63 76 69             	movsxd 0x69(%rsi),%esi
+  8048b7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8048b8:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  8048bc:	65 78 70             	gs js  80492f <__rodata_start+0x1e7>
+  8048bf:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  8048c4:	20 65 6e             	and    %ah,0x6e(%rbp)
+  8048c7:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  8048cb:	20 66 69             	and    %ah,0x69(%rsi)
+  8048ce:	6c                   	insb   (%dx),%es:(%rdi)
+  8048cf:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  8048d3:	20 66 72             	and    %ah,0x72(%rsi)
+  8048d6:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  8048db:	61                   	(bad)
+  8048dc:	63 65 20             	movsxd 0x20(%rbp),%esp
+  8048df:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8048e0:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8048e1:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  8048e5:	6b 00 74             	imul   $0x74,(%rax),%eax
+  8048e8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8048e9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8048ea:	20 6d 61             	and    %ch,0x61(%rbp)
+  8048ed:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8048ee:	79 20                	jns    804910 <__rodata_start+0x1c8>
+  8048f0:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  8048f7:	72 65                	jb     80495e <__rodata_start+0x216>
+  8048f9:	20 6f 70             	and    %ch,0x70(%rdi)
+  8048fc:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8048fe:	00 66 69             	add    %ah,0x69(%rsi)
+  804901:	6c                   	insb   (%dx),%es:(%rdi)
+  804902:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  804906:	20 62 6c             	and    %ah,0x6c(%rdx)
+  804909:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80490a:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  80490d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80490e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80490f:	74 20                	je     804931 <__rodata_start+0x1e9>
+  804911:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804913:	75 6e                	jne    804983 <__rodata_start+0x23b>
+  804915:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  804919:	76 61                	jbe    80497c <__rodata_start+0x234>
+  80491b:	6c                   	insb   (%dx),%es:(%rdi)
+  80491c:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  804923:	00 
+  804924:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  80492b:	72 65                	jb     804992 <__rodata_start+0x24a>
+  80492d:	61                   	(bad)
+  80492e:	64 79 20             	fs jns 804951 <__rodata_start+0x209>
+  804931:	65 78 69             	gs js  80499d <__rodata_start+0x255>
+  804934:	73 74                	jae    8049aa <__rodata_start+0x262>
+  804936:	73 00                	jae    804938 <__rodata_start+0x1f0>
+  804938:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804939:	70 65                	jo     8049a0 <__rodata_start+0x258>
+  80493b:	72 61                	jb     80499e <__rodata_start+0x256>
+  80493d:	74 69                	je     8049a8 <__rodata_start+0x260>
+  80493f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804940:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804941:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  804944:	74 20                	je     804966 <__rodata_start+0x21e>
+  804946:	73 75                	jae    8049bd <__rodata_start+0x275>
+  804948:	70 70                	jo     8049ba <__rodata_start+0x272>
+  80494a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80494b:	72 74                	jb     8049c1 <__rodata_start+0x279>
+  80494d:	65 64 00 74 72 79    	gs add %dh,%fs:0x79(%rdx,%rsi,2)
+  804953:	20 61 67             	and    %ah,0x67(%rcx)
+  804956:	61                   	(bad)
+  804957:	69 6e 00 74 69 6d 65 	imul   $0x656d6974,0x0(%rsi),%ebp
+  80495e:	64 20 6f 75          	and    %ch,%fs:0x75(%rdi)
+  804962:	74 00                	je     804964 <__rodata_start+0x21c>
+  804964:	66 69 6c 65 20 69 73 	imul   $0x7369,0x20(%rbp,%riz,2),%bp
+  80496b:	20 69 6e             	and    %ch,0x6e(%rcx)
+  80496e:	20 75 73             	and    %dh,0x73(%rbp)
+  804971:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  804975:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  80497c:	00 
+  80497d:	0f 1f 00             	nopl   (%rax)
+  804980:	59                   	pop    %rcx
+  804981:	04 80                	add    $0x80,%al
+  804983:	00 00                	add    %al,(%rax)
+  804985:	00 00                	add    %al,(%rax)
+  804987:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  80498d:	00 00                	add    %al,(%rax)
+  80498f:	00 8a 0a 80 00 00    	add    %cl,0x800a(%rdx)
+  804995:	00 00                	add    %al,(%rax)
+  804997:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  80499d:	00 00                	add    %al,(%rax)
+  80499f:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  8049a5:	00 00                	add    %al,(%rax)
+  8049a7:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  8049ad:	00 00                	add    %al,(%rax)
+  8049af:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  8049b5:	00 00                	add    %al,(%rax)
+  8049b7:	00 78 04             	add    %bh,0x4(%rax)
+  8049ba:	80 00 00             	addb   $0x0,(%rax)
+  8049bd:	00 00                	add    %al,(%rax)
+  8049bf:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  8049c5:	00 00                	add    %al,(%rax)
+  8049c7:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  8049cd:	00 00                	add    %al,(%rax)
+  8049cf:	00 6c 04 80          	add    %ch,-0x80(%rsp,%rax,1)
+  8049d3:	00 00                	add    %al,(%rax)
+  8049d5:	00 00                	add    %al,(%rax)
+  8049d7:	00 e6                	add    %ah,%dh
+  8049d9:	04 80                	add    $0x80,%al
+  8049db:	00 00                	add    %al,(%rax)
+  8049dd:	00 00                	add    %al,(%rax)
+  8049df:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  8049e5:	00 00                	add    %al,(%rax)
+  8049e7:	00 6c 04 80          	add    %ch,-0x80(%rsp,%rax,1)
+  8049eb:	00 00                	add    %al,(%rax)
+  8049ed:	00 00                	add    %al,(%rax)
+  8049ef:	00 b2 04 80 00 00    	add    %dh,0x8004(%rdx)
+  8049f5:	00 00                	add    %al,(%rax)
+  8049f7:	00 b2 04 80 00 00    	add    %dh,0x8004(%rdx)
+  8049fd:	00 00                	add    %al,(%rax)
+  8049ff:	00 b2 04 80 00 00    	add    %dh,0x8004(%rdx)
+  804a05:	00 00                	add    %al,(%rax)
+  804a07:	00 b2 04 80 00 00    	add    %dh,0x8004(%rdx)
+  804a0d:	00 00                	add    %al,(%rax)
+  804a0f:	00 b2 04 80 00 00    	add    %dh,0x8004(%rdx)
+  804a15:	00 00                	add    %al,(%rax)
+  804a17:	00 b2 04 80 00 00    	add    %dh,0x8004(%rdx)
+  804a1d:	00 00                	add    %al,(%rax)
+  804a1f:	00 b2 04 80 00 00    	add    %dh,0x8004(%rdx)
+  804a25:	00 00                	add    %al,(%rax)
+  804a27:	00 b2 04 80 00 00    	add    %dh,0x8004(%rdx)
+  804a2d:	00 00                	add    %al,(%rax)
+  804a2f:	00 b2 04 80 00 00    	add    %dh,0x8004(%rdx)
+  804a35:	00 00                	add    %al,(%rax)
+  804a37:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  804a3d:	00 00                	add    %al,(%rax)
+  804a3f:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  804a45:	00 00                	add    %al,(%rax)
+  804a47:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  804a4d:	00 00                	add    %al,(%rax)
+  804a4f:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  804a55:	00 00                	add    %al,(%rax)
+  804a57:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  804a5d:	00 00                	add    %al,(%rax)
+  804a5f:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  804a65:	00 00                	add    %al,(%rax)
+  804a67:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  804a6d:	00 00                	add    %al,(%rax)
+  804a6f:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  804a75:	00 00                	add    %al,(%rax)
+  804a77:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  804a7d:	00 00                	add    %al,(%rax)
+  804a7f:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  804a85:	00 00                	add    %al,(%rax)
+  804a87:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  804a8d:	00 00                	add    %al,(%rax)
+  804a8f:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  804a95:	00 00                	add    %al,(%rax)
+  804a97:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  804a9d:	00 00                	add    %al,(%rax)
+  804a9f:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  804aa5:	00 00                	add    %al,(%rax)
+  804aa7:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  804aad:	00 00                	add    %al,(%rax)
+  804aaf:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  804ab5:	00 00                	add    %al,(%rax)
+  804ab7:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  804abd:	00 00                	add    %al,(%rax)
+  804abf:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  804ac5:	00 00                	add    %al,(%rax)
+  804ac7:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  804acd:	00 00                	add    %al,(%rax)
+  804acf:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  804ad5:	00 00                	add    %al,(%rax)
+  804ad7:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  804add:	00 00                	add    %al,(%rax)
+  804adf:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  804ae5:	00 00                	add    %al,(%rax)
+  804ae7:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  804aed:	00 00                	add    %al,(%rax)
+  804aef:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  804af5:	00 00                	add    %al,(%rax)
+  804af7:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  804afd:	00 00                	add    %al,(%rax)
+  804aff:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  804b05:	00 00                	add    %al,(%rax)
+  804b07:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  804b0d:	00 00                	add    %al,(%rax)
+  804b0f:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  804b15:	00 00                	add    %al,(%rax)
+  804b17:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  804b1d:	00 00                	add    %al,(%rax)
+  804b1f:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  804b25:	00 00                	add    %al,(%rax)
+  804b27:	00 bd 09 80 00 00    	add    %bh,0x8009(%rbp)
+  804b2d:	00 00                	add    %al,(%rax)
+  804b2f:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  804b35:	00 00                	add    %al,(%rax)
+  804b37:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  804b3d:	00 00                	add    %al,(%rax)
+  804b3f:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  804b45:	00 00                	add    %al,(%rax)
+  804b47:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  804b4d:	00 00                	add    %al,(%rax)
+  804b4f:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  804b55:	00 00                	add    %al,(%rax)
+  804b57:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  804b5d:	00 00                	add    %al,(%rax)
+  804b5f:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  804b65:	00 00                	add    %al,(%rax)
+  804b67:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  804b6d:	00 00                	add    %al,(%rax)
+  804b6f:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  804b75:	00 00                	add    %al,(%rax)
+  804b77:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  804b7d:	00 00                	add    %al,(%rax)
+  804b7f:	00 09                	add    %cl,(%rcx)
+  804b81:	05 80 00 00 00       	add    $0x80,%eax
+  804b86:	00 00                	add    %al,(%rax)
+  804b88:	d8 06                	fadds  (%rsi)
+  804b8a:	80 00 00             	addb   $0x0,(%rax)
+  804b8d:	00 00                	add    %al,(%rax)
+  804b8f:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  804b95:	00 00                	add    %al,(%rax)
+  804b97:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  804b9d:	00 00                	add    %al,(%rax)
+  804b9f:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  804ba5:	00 00                	add    %al,(%rax)
+  804ba7:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  804bad:	00 00                	add    %al,(%rax)
+  804baf:	00 38                	add    %bh,(%rax)
+  804bb1:	05 80 00 00 00       	add    $0x80,%eax
+  804bb6:	00 00                	add    %al,(%rax)
+  804bb8:	9a                   	(bad)
+  804bb9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804bbf:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  804bc5:	00 00                	add    %al,(%rax)
+  804bc7:	00 fe                	add    %bh,%dh
+  804bc9:	04 80                	add    $0x80,%al
+  804bcb:	00 00                	add    %al,(%rax)
+  804bcd:	00 00                	add    %al,(%rax)
+  804bcf:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  804bd5:	00 00                	add    %al,(%rax)
+  804bd7:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  804bdd:	00 00                	add    %al,(%rax)
+  804bdf:	00 80 08 80 00 00    	add    %al,0x8008(%rax)
+  804be5:	00 00                	add    %al,(%rax)
+  804be7:	00 4a 09             	add    %cl,0x9(%rdx)
+  804bea:	80 00 00             	addb   $0x0,(%rax)
+  804bed:	00 00                	add    %al,(%rax)
+  804bef:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  804bf5:	00 00                	add    %al,(%rax)
+  804bf7:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  804bfd:	00 00                	add    %al,(%rax)
+  804bff:	00 cf                	add    %cl,%bh
+  804c01:	05 80 00 00 00       	add    $0x80,%eax
+  804c06:	00 00                	add    %al,(%rax)
+  804c08:	9a                   	(bad)
+  804c09:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c0f:	00 ac 07 80 00 00 00 	add    %ch,0x80(%rdi,%rax,1)
+  804c16:	00 00                	add    %al,(%rax)
+  804c18:	9a                   	(bad)
+  804c19:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c1f:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  804c25:	00 00                	add    %al,(%rax)
+  804c27:	00 bd 09 80 00 00    	add    %bh,0x8009(%rbp)
+  804c2d:	00 00                	add    %al,(%rax)
+  804c2f:	00 9a 0a 80 00 00    	add    %bl,0x800a(%rdx)
+  804c35:	00 00                	add    %al,(%rax)
+  804c37:	00 62 04             	add    %ah,0x4(%rdx)
+  804c3a:	80 00 00             	addb   $0x0,(%rax)
+  804c3d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000804c40 <error_string>:
+	...
+  804c48:	f3 47 80 00 00 00 00 00 05 48 80 00 00 00 00 00     .G.......H......
+  804c58:	15 48 80 00 00 00 00 00 27 48 80 00 00 00 00 00     .H......'H......
+  804c68:	35 48 80 00 00 00 00 00 49 48 80 00 00 00 00 00     5H......IH......
+  804c78:	5e 48 80 00 00 00 00 00 71 48 80 00 00 00 00 00     ^H......qH......
+  804c88:	83 48 80 00 00 00 00 00 97 48 80 00 00 00 00 00     .H.......H......
+  804c98:	a7 48 80 00 00 00 00 00 ba 48 80 00 00 00 00 00     .H.......H......
+  804ca8:	d1 48 80 00 00 00 00 00 e7 48 80 00 00 00 00 00     .H.......H......
+  804cb8:	ff 48 80 00 00 00 00 00 17 49 80 00 00 00 00 00     .H.......I......
+  804cc8:	24 49 80 00 00 00 00 00 f8 4c 80 00 00 00 00 00     $I.......L......
+  804cd8:	38 49 80 00 00 00 00 00 50 49 80 00 00 00 00 00     8I......PI......
+  804ce8:	5a 49 80 00 00 00 00 00 64 49 80 00 00 00 00 00     ZI......dI......
+  804cf8:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  804d08:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  804d18:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  804d28:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  804d38:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  804d48:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  804d58:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  804d68:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  804d78:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  804d88:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  804d98:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  804da8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  804db8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  804dc8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804dd8:	0f 1f 84 00 00 00 00 00                             ........
+
+0000000000804de0 <devtab>:
+  804de0:	20 50 80 00 00 00 00 00 60 50 80 00 00 00 00 00      P......`P......
+  804df0:	a0 50 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .P..............
+  804e00:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  804e10:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  804e20:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  804e30:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  804e40:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  804e50:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  804e60:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  804e70:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  804e80:	3a 20 00 0f 1f 44 00 00 55 73 65 72 73 70 61 63     : ...D..Userspac
+  804e90:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  804ea0:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  804eb0:	65 72 72 3d 25 78 0a 00 6c 69 62 2f 70 67 66 61     err=%x..lib/pgfa
+  804ec0:	75 6c 74 2e 63 00 73 65 74 5f 70 67 66 61 75 6c     ult.c.set_pgfaul
+  804ed0:	74 5f 68 61 6e 64 6c 65 72 3a 20 25 69 00 5f 70     t_handler: %i._p
+  804ee0:	66 68 61 6e 64 6c 65 72 5f 69 6e 69 74 69 74 69     fhandler_inititi
+  804ef0:	61 6c 6c 69 7a 65 64 00 69 70 63 5f 73 65 6e 64     allized.ipc_send
+  804f00:	20 65 72 72 6f 72 3a 20 25 69 0a 00 6c 69 62 2f      error: %i..lib/
+  804f10:	69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00 00     ipc.c.f.........
+  804f20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804fa0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804fb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804fc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804fd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804fe0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ff0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 40 00     ..f...........@.
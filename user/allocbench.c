@@ -0,0 +1,61 @@
+/* Block allocation cost: fill the disk with files of varying size
+ * until it runs out of space and report the number of cycles the
+ * file server spent per written block as the disk fills up.
+ * The image is left full, so run it with a disk snapshot */
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static char buf[FSIPC_DATA_SIZE];
+
+/* File sizes in blocks, used in turn */
+static const size_t sizes[] = {1, 3, 16, 2, 64, 7, 256, 1};
+
+/* Report after every so many blocks */
+#define PHASE_BLOCKS 2048
+
+void
+umain(int argc, char **argv) {
+    envid_t fsenv = ipc_find_env(ENV_TYPE_FS);
+    if (!fsenv) panic("no file server");
+    const volatile struct Env *fs = &envs[ENVX(fsenv)];
+
+    char path[MAXPATHLEN];
+    size_t nfiles = 0, nblocks = 0, phase_blocks = 0;
+    uint64_t fs_start = fs->env_cycles;
+    int res = 0;
+
+    memset(buf, 'x', sizeof(buf));
+    while (res >= 0) {
+        snprintf(path, sizeof(path), "/fill%u", (unsigned)nfiles);
+        int fd = open(path, O_RDWR | O_CREAT | O_TRUNC);
+        if (fd < 0) {
+            res = fd;
+            break;
+        }
+        nfiles++;
+
+        size_t left = sizes[nfiles % (sizeof(sizes) / sizeof(*sizes))] * BLKSIZE;
+        while (left && res >= 0) {
+            size_t n = MIN(left, sizeof(buf));
+            if ((res = write(fd, buf, n)) < 0) break;
+            if (!res) res = -E_NO_DISK;
+            left -= res;
+            nblocks += res / BLKSIZE;
+            phase_blocks += res / BLKSIZE;
+        }
+        close(fd);
+
+        if (phase_blocks >= PHASE_BLOCKS || res < 0) {
+            uint64_t fs_cycles = fs->env_cycles - fs_start;
+            cprintf("allocbench: %lu blocks in %lu files: %lu cycles per block\n",
+                    (unsigned long)nblocks, (unsigned long)nfiles,
+                    (unsigned long)(phase_blocks ? fs_cycles / phase_blocks : 0));
+            fs_start = fs->env_cycles;
+            phase_blocks = 0;
+        }
+    }
+
+    if (res != -E_NO_DISK) panic("allocbench: %i", res);
+    cprintf("allocbench: disk full after %lu blocks\n", (unsigned long)nblocks);
+}
@@ -1,6 +1,6 @@
 #include <inc/lib.h>
 
-char buf[8192];
+char buf[8192] __attribute__((aligned(PAGE_SIZE)));
 
 void
 cat(int f, char *s) {
@@ -0,0 +1,80 @@
+/* End-to-end sequential read throughput: run cat over /bigfile
+ * with its output going to a pipe and report MB/s. Run it right
+ * after boot, so that the file has to come from the disk.
+ * Then read the cached file with a buffer that is not page
+ * aligned, so the data is copied, and with one that is, so
+ * block cache pages are mapped instead */
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static char buf[8192];
+static char rbuf[FSMAP_MAX_SIZE + PAGE_SIZE] __attribute__((aligned(PAGE_SIZE)));
+
+static void
+bench_read(const char *name, char *dst, size_t n) {
+    int fd, res;
+    size_t total = 0;
+
+    if ((fd = open("/bigfile", O_RDONLY)) < 0) panic("open /bigfile: %i", fd);
+
+    uint64_t start = read_tsc();
+    while ((res = read(fd, dst, n)) > 0)
+        total += res;
+    uint64_t cycles = read_tsc() - start;
+
+    if (res < 0) panic("read /bigfile: %i", res);
+    close(fd);
+
+    uint64_t khz = vsys[VSYS_tsc_khz];
+    cprintf("catbench: %s reads: %lu MB/s, %lu.%02lu cycles per byte\n", name,
+            (unsigned long)(khz ? total * khz / cycles / 1000 : 0),
+            (unsigned long)(cycles / total), (unsigned long)(cycles * 100 / total % 100));
+}
+
+void
+umain(int argc, char **argv) {
+    int p[2], res;
+    struct DiskStat st0, st1;
+
+    if ((res = pipe(p)) < 0) panic("pipe: %i", res);
+    if ((res = disk_stat(&st0)) < 0) panic("disk_stat: %i", res);
+
+    uint64_t start = read_tsc();
+
+    envid_t child = fork();
+    if (child < 0) panic("fork: %i", child);
+    if (!child) {
+        dup(p[1], 1);
+        close(p[0]);
+        close(p[1]);
+        envid_t cat = spawnl("/cat", "cat", "/bigfile", (char *)0);
+        if (cat < 0) panic("spawn cat: %i", cat);
+        close(1);
+        wait(cat);
+        exit();
+    }
+
+    close(p[1]);
+    size_t total = 0;
+    while ((res = read(p[0], buf, sizeof(buf))) > 0)
+        total += res;
+    if (res < 0) panic("read: %i", res);
+    close(p[0]);
+    wait(child);
+
+    uint64_t cycles = read_tsc() - start;
+    if ((res = disk_stat(&st1)) < 0) panic("disk_stat: %i", res);
+
+    uint64_t khz = vsys[VSYS_tsc_khz];
+    cprintf("catbench: %lu KB, %lu MB/s, %lu read commands for %lu blocks\n",
+            (unsigned long)(total / 1024),
+            (unsigned long)(khz ? total * khz / cycles / 1000 : 0),
+            (unsigned long)(st1.ds_reads - st0.ds_reads),
+            (unsigned long)(st1.ds_read_blocks - st0.ds_read_blocks));
+    cprintf("catbench: %lu.%02lu cycles per byte\n",
+            (unsigned long)(cycles / total), (unsigned long)(cycles * 100 / total % 100));
+
+    bench_read("copied", rbuf + 64, FSMAP_MAX_SIZE);
+    bench_read("mapped", rbuf, FSMAP_MAX_SIZE);
+}
@@ -0,0 +1,56 @@
+/* Directory lookup cost: create NFILES empty files in one directory,
+ * open each of them and remove them again, and report the number of
+ * cycles per operation and the blocks the file server touched */
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define NFILES 10000
+
+static void
+name(char *path, int i) {
+    snprintf(path, MAXPATHLEN, "/dirbench%05d", i);
+}
+
+static void
+report(const char *op, uint64_t cycles, const volatile struct Env *fs,
+       uint64_t fs_start, struct CacheStat *cs0) {
+    struct CacheStat cs1;
+    int res = cache_stat(&cs1);
+    if (res < 0) panic("cache_stat: %i", res);
+
+    cprintf("dirbench: %s: %lu cycles per file, file server %lu, %lu block lookups per file\n",
+            op, (unsigned long)(cycles / NFILES), (unsigned long)((fs->env_cycles - fs_start) / NFILES),
+            (unsigned long)((cs1.cs_hits + cs1.cs_misses - cs0->cs_hits - cs0->cs_misses) / NFILES));
+}
+
+void
+umain(int argc, char **argv) {
+    char path[MAXPATHLEN];
+    struct CacheStat cs;
+    int fd, res;
+
+    envid_t fsenv = ipc_find_env(ENV_TYPE_FS);
+    if (!fsenv) panic("no file server");
+    const volatile struct Env *fs = &envs[ENVX(fsenv)];
+
+    for (int op = 0; op < 3; op++) {
+        if ((res = cache_stat(&cs)) < 0) panic("cache_stat: %i", res);
+        uint64_t fs_start = fs->env_cycles;
+        uint64_t start = read_tsc();
+
+        for (int i = 0; i < NFILES; i++) {
+            name(path, i);
+            if (op == 2) {
+                if ((res = remove(path)) < 0) panic("remove %s: %i", path, res);
+                continue;
+            }
+            if ((fd = open(path, op ? O_RDONLY : O_RDWR | O_CREAT | O_EXCL)) < 0)
+                panic("open %s: %i", path, fd);
+            close(fd);
+        }
+
+        report(op == 0 ? "create" : op == 1 ? "open" : "remove",
+               read_tsc() - start, fs, fs_start, &cs);
+    }
+}
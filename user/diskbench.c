@@ -0,0 +1,101 @@
+/* Disk throughput: read /bigfile sequentially and report MB/s,
+ * the number of cycles the file server spent per block and the
+ * number of disk commands issued. The first pass has to go to the
+ * disk, so run it right after boot, the second one is served from
+ * the block cache. Then write a file, fsync it and sync twice */
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static char buf[FSIPC_DATA_SIZE];
+
+#define WRITE_SIZE (512 * 1024)
+
+static void
+bench(const char *name, const volatile struct Env *fs) {
+    int fd, res;
+    size_t total = 0;
+    struct DiskStat st0, st1;
+
+    if ((fd = open("/bigfile", O_RDONLY)) < 0) panic("open /bigfile: %i", fd);
+
+    if ((res = disk_stat(&st0)) < 0) panic("disk_stat: %i", res);
+    uint64_t fs_start = fs->env_cycles;
+    uint64_t start = read_tsc();
+    while ((res = read(fd, buf, sizeof(buf))) > 0)
+        total += res;
+    uint64_t cycles = read_tsc() - start;
+    uint64_t fs_cycles = fs->env_cycles - fs_start;
+
+    if (res < 0) panic("read /bigfile: %i", res);
+    close(fd);
+    if ((res = disk_stat(&st1)) < 0) panic("disk_stat: %i", res);
+
+    uint64_t khz = vsys[VSYS_tsc_khz];
+    size_t nblocks = total / BLKSIZE;
+    cprintf("diskbench: %s: %lu KB, %lu MB/s, file server %lu cycles per block\n",
+            name, (unsigned long)(total / 1024),
+            (unsigned long)(khz ? total * khz / cycles / 1000 : 0),
+            (unsigned long)(nblocks ? fs_cycles / nblocks : 0));
+    cprintf("diskbench: %s: %lu read commands for %lu blocks\n", name,
+            (unsigned long)(st1.ds_reads - st0.ds_reads),
+            (unsigned long)(st1.ds_read_blocks - st0.ds_read_blocks));
+}
+
+static void
+bench_sync(void) {
+    int fd, res;
+    struct DiskStat st0, st1;
+
+    if ((fd = open("/diskbench", O_RDWR | O_CREAT | O_TRUNC)) < 0)
+        panic("open /diskbench: %i", fd);
+
+    memset(buf, 'x', sizeof(buf));
+    for (size_t n = 0; n < WRITE_SIZE; n += sizeof(buf))
+        if ((res = write(fd, buf, sizeof(buf))) != sizeof(buf))
+            panic("write /diskbench: %i", res);
+
+    if ((res = disk_stat(&st0)) < 0) panic("disk_stat: %i", res);
+    uint64_t start = read_tsc();
+    if ((res = fsync(fd)) < 0) panic("fsync: %i", res);
+    uint64_t cycles = read_tsc() - start;
+    if ((res = disk_stat(&st1)) < 0) panic("disk_stat: %i", res);
+    close(fd);
+
+    cprintf("diskbench: fsync: %lu Kcycles, %lu write commands for %lu blocks\n",
+            (unsigned long)(cycles / 1000),
+            (unsigned long)(st1.ds_writes - st0.ds_writes),
+            (unsigned long)(st1.ds_write_blocks - st0.ds_write_blocks));
+
+    /* The second sync finds the image clean */
+    for (int i = 0; i < 2; i++) {
+        if ((res = disk_stat(&st0)) < 0) panic("disk_stat: %i", res);
+        start = read_tsc();
+        sync();
+        cycles = read_tsc() - start;
+        if ((res = disk_stat(&st1)) < 0) panic("disk_stat: %i", res);
+
+        cprintf("diskbench: %s: %lu Kcycles, %lu write commands for %lu blocks\n",
+                i ? "clean sync" : "sync", (unsigned long)(cycles / 1000),
+                (unsigned long)(st1.ds_writes - st0.ds_writes),
+                (unsigned long)(st1.ds_write_blocks - st0.ds_write_blocks));
+    }
+}
+
+void
+umain(int argc, char **argv) {
+    envid_t fsenv = ipc_find_env(ENV_TYPE_FS);
+    if (!fsenv) panic("no file server");
+
+    bench("disk", &envs[ENVX(fsenv)]);
+    bench("cached", &envs[ENVX(fsenv)]);
+    bench_sync();
+
+    struct CacheStat cs;
+    int res = cache_stat(&cs);
+    if (res < 0) panic("cache_stat: %i", res);
+    cprintf("diskbench: cache: %lu hits, %lu misses, %lu read ahead, %lu evictions, %lu/%lu blocks\n",
+            (unsigned long)cs.cs_hits, (unsigned long)cs.cs_misses,
+            (unsigned long)cs.cs_readahead, (unsigned long)cs.cs_evictions,
+            (unsigned long)cs.cs_resident, (unsigned long)cs.cs_budget);
+}
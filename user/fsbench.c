@@ -0,0 +1,60 @@
+/* File system request throughput: read a file in small
+ * pieces with requests sent through IPC and through a
+ * channel, and report the average number of cycles per read */
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define FILE_SIZE (64 * 1024)
+#define NPASSES   8
+
+static char buf[FILE_SIZE];
+
+static void
+bench(int fd, const char *transport, size_t blk) {
+    uint64_t nreads = 0;
+
+    uint64_t start = read_tsc();
+    for (int i = 0; i < NPASSES; i++) {
+        seek(fd, 0);
+        for (;;) {
+            ssize_t res = read(fd, buf, blk);
+            if (res < 0) panic("read: %i", (int)res);
+            if (!res) break;
+            nreads++;
+        }
+    }
+    uint64_t cycles = read_tsc() - start;
+
+    cprintf("fsbench: %s: %u-byte reads: %lu cycles per read, %lu bytes per Kcycle\n",
+            transport, (unsigned)blk, (unsigned long)(cycles / nreads),
+            (unsigned long)(NPASSES * FILE_SIZE * 1000ULL / cycles));
+}
+
+static void
+bench_all(int fd, const char *transport) {
+    bench(fd, transport, 64);
+    bench(fd, transport, 512);
+    /* Pipelined over channels */
+    bench(fd, transport, 8192);
+}
+
+void
+umain(int argc, char **argv) {
+    int fd, res;
+
+    if ((fd = open("/fsbench", O_RDWR | O_CREAT | O_TRUNC)) < 0)
+        panic("open /fsbench: %i", fd);
+
+    memset(buf, 'x', sizeof(buf));
+    if ((res = write(fd, buf, sizeof(buf))) != sizeof(buf))
+        panic("write /fsbench: %i", res);
+
+    bench_all(fd, "ipc");
+
+    if ((res = fs_channel(1)) < 0) panic("fs_channel: %i", res);
+    bench_all(fd, "channel");
+    fs_channel(0);
+
+    close(fd);
+}
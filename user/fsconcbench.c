@@ -0,0 +1,80 @@
+/* Latency of cached reads while another client keeps the disk busy:
+ * read a small file that stays in the block cache over and over, first
+ * alone, then while a child streams /bigfile from the disk, and report
+ * the average and the worst number of cycles per read. The file server
+ * serves cached data while it waits for the disk, so both should stay
+ * close. /bigfile has to be read from the disk, so run this right after
+ * boot, before diskbench or catbench */
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+/* Reads this large bypass the client buffer of lib/file.c
+ * and always go to the file server */
+#define HOT_SIZE FSIPC_DATA_SIZE
+
+#define NREADS 256
+
+static char buf[FSIPC_DATA_SIZE];
+
+static void
+stream(void) {
+    int fd, res;
+    size_t total = 0;
+
+    if ((fd = open("/bigfile", O_RDONLY)) < 0) panic("open /bigfile: %i", fd);
+    while ((res = read(fd, buf, sizeof(buf))) > 0)
+        total += res;
+    if (res < 0) panic("read /bigfile: %i", res);
+    close(fd);
+
+    cprintf("fsconcbench: streamed %lu KB\n", (unsigned long)(total / 1024));
+}
+
+/* Read the hot file until n reads are done or, if child is
+ * not 0, until it exits, whichever comes later */
+static void
+bench(const char *name, int fd, envid_t child) {
+    uint64_t total = 0, worst = 0, nreads = 0;
+    const volatile struct Env *env = &envs[ENVX(child)];
+
+    while (nreads < NREADS || (child && env->env_id == child && env->env_status != ENV_FREE)) {
+        seek(fd, 0);
+        uint64_t start = read_tsc();
+        int res = read(fd, buf, HOT_SIZE);
+        uint64_t cycles = read_tsc() - start;
+        if (res != HOT_SIZE) panic("read /fsconcbench: %i", res);
+
+        total += cycles;
+        worst = MAX(worst, cycles);
+        nreads++;
+    }
+
+    cprintf("fsconcbench: %s: %lu reads, %lu cycles per read, %lu at worst\n",
+            name, (unsigned long)nreads, (unsigned long)(total / nreads),
+            (unsigned long)worst);
+}
+
+void
+umain(int argc, char **argv) {
+    int fd, res;
+
+    if ((fd = open("/fsconcbench", O_RDWR | O_CREAT | O_TRUNC)) < 0)
+        panic("open /fsconcbench: %i", fd);
+    memset(buf, 'x', HOT_SIZE);
+    if ((res = write(fd, buf, HOT_SIZE)) != HOT_SIZE)
+        panic("write /fsconcbench: %i", res);
+
+    bench("idle disk", fd, 0);
+
+    envid_t child = fork();
+    if (child < 0) panic("fork: %i", child);
+    if (!child) {
+        stream();
+        exit();
+    }
+
+    bench("busy disk", fd, child);
+    wait(child);
+    close(fd);
+}
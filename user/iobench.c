@@ -0,0 +1,53 @@
+/* Cost of small reads and writes: run cat and num over a text file
+ * with their output going to another file, and report the system
+ * calls and IPC messages they made and the number of requests the
+ * file server answered. num reads and writes one byte at a time.
+ * Build with CONFIG_FILE_BUF=0 to compare with unbuffered I/O */
+
+#include <inc/lib.h>
+
+#define NLINES 1024
+
+static void
+bench(const char *prog, const volatile struct Env *fs) {
+    int fd, res;
+
+    if ((fd = open("/iobench.out", O_WRONLY | O_CREAT | O_TRUNC)) < 0)
+        panic("open /iobench.out: %i", fd);
+    if ((res = dup(fd, 1)) < 0) panic("dup: %i", res);
+    close(fd);
+
+    uint64_t fs_replies = fs->env_ipc_sends;
+    envid_t child = spawnl(prog, prog, "/iobench.txt", (char *)0);
+    if (child < 0) panic("spawn %s: %i", prog, child);
+    close(1);
+    wait(child);
+
+    const volatile struct Env *env = &envs[ENVX(child)];
+    struct Stat st;
+    if ((res = stat("/iobench.out", &st)) < 0) panic("stat /iobench.out: %i", res);
+
+    cprintf("iobench: %s: %lu KB written, %lu system calls, %lu IPC messages, %lu file server requests\n",
+            prog, (unsigned long)(st.st_size / 1024), (unsigned long)env->env_syscalls,
+            (unsigned long)env->env_ipc_sends, (unsigned long)(fs->env_ipc_sends - fs_replies));
+}
+
+void
+umain(int argc, char **argv) {
+    int fd, res;
+    char line[64];
+
+    envid_t fsenv = ipc_find_env(ENV_TYPE_FS);
+    if (!fsenv) panic("no file server");
+
+    if ((fd = open("/iobench.txt", O_WRONLY | O_CREAT | O_TRUNC)) < 0)
+        panic("open /iobench.txt: %i", fd);
+    for (int i = 0; i < NLINES; i++) {
+        int n = snprintf(line, sizeof(line), "%d: the quick brown fox jumps over the lazy dog\n", i);
+        if ((res = write(fd, line, n)) != n) panic("write /iobench.txt: %i", res);
+    }
+    close(fd);
+
+    bench("/cat", &envs[ENVX(fsenv)]);
+    bench("/num", &envs[ENVX(fsenv)]);
+}
@@ -0,0 +1,54 @@
+/* Kernel lock contention benchmark: many environments
+ * allocate and unmap memory in their own address spaces
+ * and then flood the parent with IPC messages at once.
+ * Run with different CPUS=N and compare the cycle counts */
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define NWORKERS 8
+#define NALLOCS  2000
+#define NSENDS   500
+
+static void
+worker(envid_t parent) {
+    for (int i = 0; i < NALLOCS; i++) {
+        int res = sys_alloc_region(0, UTEMP, PAGE_SIZE, PROT_RW);
+        if (res < 0) panic("sys_alloc_region: %i", res);
+        /* Fault the page in to exercise the lazy allocation path too */
+        *(volatile int *)UTEMP = i;
+        sys_unmap_region(0, UTEMP, PAGE_SIZE);
+    }
+    ipc_send(parent, 0, NULL, 0, 0);
+
+    for (int i = 0; i < NSENDS; i++)
+        ipc_send(parent, i, NULL, 0, 0);
+}
+
+void
+umain(int argc, char **argv) {
+    envid_t parent = sys_getenvid();
+    int i;
+
+    uint64_t start = read_tsc();
+    for (i = 0; i < NWORKERS; i++) {
+        envid_t id = fork();
+        if (id < 0) panic("fork: %i", id);
+        if (!id) {
+            worker(parent);
+            return;
+        }
+    }
+
+    for (i = 0; i < NWORKERS; i++)
+        ipc_recv(NULL, NULL, NULL, NULL);
+    uint64_t alloc = read_tsc() - start;
+
+    start = read_tsc();
+    for (i = 0; i < NWORKERS * NSENDS; i++)
+        ipc_recv(NULL, NULL, NULL, NULL);
+    uint64_t ipc = read_tsc() - start;
+
+    cprintf("lockbench: %d workers: alloc %lu Mcycles, ipc %lu Mcycles\n",
+            NWORKERS, (unsigned long)(alloc / 1000000), (unsigned long)(ipc / 1000000));
+}
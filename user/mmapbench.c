@@ -0,0 +1,90 @@
+/* Memory-mapped file throughput: sum /bigfile read with read() and
+ * through shared and private mmap() mappings, and report cycles per
+ * byte. Then write to a private mapping, check that the file has not
+ * changed, and time spawning a program, whose segments are mapped */
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define NSPAWNS 8
+
+static char buf[FSIPC_DATA_SIZE];
+
+static void
+report(const char *name, uint64_t cycles, size_t total) {
+    cprintf("mmapbench: %s: %lu KB, %lu.%02lu cycles per byte\n", name,
+            (unsigned long)(total / 1024), (unsigned long)(cycles / total),
+            (unsigned long)(cycles * 100 / total % 100));
+}
+
+static uint64_t
+sum(const uint64_t *p, size_t n) {
+    uint64_t s = 0;
+    for (size_t i = 0; i < n / sizeof(*p); i++)
+        s += p[i];
+    return s;
+}
+
+static uint64_t
+bench_read(int fd, off_t size) {
+    uint64_t s = 0;
+    int res;
+
+    seek(fd, 0);
+    uint64_t start = read_tsc();
+    while ((res = read(fd, buf, sizeof(buf))) > 0)
+        s += sum((uint64_t *)buf, res);
+    report("read", read_tsc() - start, size);
+
+    if (res < 0) panic("read /bigfile: %i", res);
+    return s;
+}
+
+static uint64_t
+bench_mmap(int fd, off_t size, int prot, int flags, const char *name) {
+    void *addr = NULL;
+
+    uint64_t start = read_tsc();
+    int res = mmap(&addr, size, prot, flags, fd, 0);
+    if (res < 0) panic("mmap /bigfile: %i", res);
+    uint64_t s = sum(addr, size);
+    report(name, read_tsc() - start, size);
+
+    if (prot & PROT_W) {
+        memset(addr, 'x', PAGE_SIZE);
+        seek(fd, 0);
+        if ((res = readn(fd, buf, PAGE_SIZE)) != PAGE_SIZE) panic("read /bigfile: %i", res);
+        if (!memcmp(buf, addr, PAGE_SIZE)) panic("private mapping wrote to the file");
+    }
+
+    if ((res = munmap(addr, size)) < 0) panic("munmap: %i", res);
+    return s;
+}
+
+void
+umain(int argc, char **argv) {
+    int fd;
+    struct Stat st;
+
+    if ((fd = open("/bigfile", O_RDONLY)) < 0) panic("open /bigfile: %i", fd);
+    if (fstat(fd, &st) < 0) panic("fstat /bigfile");
+    off_t size = ROUNDDOWN(st.st_size, sizeof(uint64_t));
+
+    uint64_t s = bench_read(fd, size);
+    if (bench_mmap(fd, size, PROT_R, MAP_SHARED, "shared mmap") != s)
+        panic("shared mapping differs from the file");
+    if (bench_mmap(fd, size, PROT_RW, MAP_PRIVATE, "private mmap") != s)
+        panic("private mapping differs from the file");
+    if (bench_mmap(fd, size, PROT_R, MAP_SHARED | MAP_POPULATE, "populated mmap") != s)
+        panic("populated mapping differs from the file");
+    close(fd);
+
+    uint64_t start = read_tsc();
+    for (int i = 0; i < NSPAWNS; i++) {
+        envid_t child = spawnl("/hello", "hello", (char *)0);
+        if (child < 0) panic("spawn /hello: %i", child);
+        wait(child);
+    }
+    cprintf("mmapbench: spawn: %lu Kcycles\n",
+            (unsigned long)((read_tsc() - start) / NSPAWNS / 1000));
+}
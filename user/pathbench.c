@@ -0,0 +1,53 @@
+/* Path lookup cost: open a file DEPTH directories deep and a
+ * name missing from the deepest directory over and over and
+ * report the number of cycles per open() */
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define DEPTH  8
+#define NOPENS 1000
+
+static char dirs[DEPTH][MAXPATHLEN];
+static char leaf[MAXPATHLEN], missing[MAXPATHLEN];
+
+static void
+bench(const char *what, const char *path, int expect) {
+    uint64_t start = read_tsc();
+    for (int i = 0; i < NOPENS; i++) {
+        int fd = open(path, O_RDONLY);
+        if ((fd < 0 ? fd : 0) != expect) panic("open %s: %i", path, fd);
+        if (fd >= 0) close(fd);
+    }
+    uint64_t cycles = read_tsc() - start;
+
+    cprintf("pathbench: %s: %lu cycles per open\n", what, (unsigned long)(cycles / NOPENS));
+}
+
+void
+umain(int argc, char **argv) {
+    int fd;
+
+    for (int i = 0; i < DEPTH; i++) {
+        if (i)
+            snprintf(dirs[i], MAXPATHLEN, "%s/dir%d", dirs[i - 1], i);
+        else
+            strcpy(dirs[i], "/pathbench");
+        if ((fd = open(dirs[i], O_RDONLY | O_CREAT | O_MKDIR)) < 0)
+            panic("mkdir %s: %i", dirs[i], fd);
+        close(fd);
+    }
+    snprintf(leaf, MAXPATHLEN, "%s/leaf", dirs[DEPTH - 1]);
+    snprintf(missing, MAXPATHLEN, "%s/missing", dirs[DEPTH - 1]);
+    if ((fd = open(leaf, O_RDWR | O_CREAT)) < 0) panic("create %s: %i", leaf, fd);
+    close(fd);
+
+    bench("deep path", leaf, 0);
+    bench("missing deep path", missing, -E_NOT_FOUND);
+    bench("short path", "/pathbench", 0);
+
+    int res;
+    if ((res = remove(leaf)) < 0) panic("remove %s: %i", leaf, res);
+    for (int i = DEPTH - 1; i >= 0; i--)
+        if ((res = remove(dirs[i])) < 0) panic("remove %s: %i", dirs[i], res);
+}
@@ -0,0 +1,32 @@
+/* IPC round-trip latency: ping-pong a counter between two
+ * processes like pingpong does, but without printing,
+ * and report the average number of cycles per round trip */
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define NROUNDS 10000
+
+void
+umain(int argc, char **argv) {
+    envid_t who;
+
+    if ((who = fork()) == 0) {
+        /* Child just bounces the counter back */
+        for (;;) {
+            uint32_t i = ipc_recv(&who, 0, 0, 0);
+            ipc_send(who, i + 1, 0, 0, 0);
+            if (i + 1 >= NROUNDS) return;
+        }
+    }
+
+    uint64_t start = read_tsc();
+    for (uint32_t i = 0; i < NROUNDS;) {
+        ipc_send(who, i, 0, 0, 0);
+        i = ipc_recv(NULL, 0, 0, 0);
+    }
+    uint64_t cycles = read_tsc() - start;
+
+    cprintf("pingpongbench: %d round trips, %lu cycles per round trip\n",
+            NROUNDS, (unsigned long)(cycles / NROUNDS));
+}
@@ -0,0 +1,48 @@
+/* Measure yield-to-yield latency with 10, 100 and 1000
+ * runnable environments in the system */
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define NROUNDS 100
+#define NWARMUP 3
+
+static envid_t kids[1000];
+
+static void
+bench(int nenvs) {
+    int i, nkids;
+
+    /* We are runnable ourselves */
+    for (nkids = 0; nkids < nenvs - 1; nkids++) {
+        envid_t id = fork();
+        if (id < 0) break;
+        if (!id)
+            for (;;) sys_yield();
+        kids[nkids] = id;
+    }
+
+    /* Let children fault in their stacks */
+    for (i = 0; i < NWARMUP; i++)
+        sys_yield();
+
+    uint64_t start = read_tsc();
+    for (i = 0; i < NROUNDS; i++)
+        sys_yield();
+    uint64_t cycles = read_tsc() - start;
+
+    /* Every yield of ours lets each of the children yield once */
+    cprintf("schedbench: %d envs: %lu cycles/round, %lu cycles/yield\n",
+            nkids + 1, (unsigned long)(cycles / NROUNDS),
+            (unsigned long)(cycles / NROUNDS / (nkids + 1)));
+
+    for (i = 0; i < nkids; i++)
+        sys_env_destroy(kids[i]);
+}
+
+void
+umain(int argc, char **argv) {
+    bench(10);
+    bench(100);
+    bench(1000);
+}
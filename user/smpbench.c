@@ -0,0 +1,44 @@
+/* CPU-bound workers for SMP scaling test: each worker spins on
+ * integer arithmetic and reports back the set of CPUs it ran on.
+ * Run with different CPUS=N and compare the cycle counts */
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define NWORKERS 8
+#define NITERS   (1 << 24)
+
+static uint32_t
+work(void) {
+    volatile uint32_t x = 1;
+    uint32_t cpus = 0;
+
+    for (int i = 0; i < NITERS; i++) {
+        x = x * 1103515245 + 12345;
+        if (!(i & 0xFFFF)) cpus |= 1U << thisenv->env_cpunum;
+    }
+    return cpus;
+}
+
+void
+umain(int argc, char **argv) {
+    uint32_t cpus = 0;
+    int i;
+
+    uint64_t start = read_tsc();
+    for (i = 0; i < NWORKERS; i++) {
+        envid_t id = fork();
+        if (id < 0) panic("fork: %i", id);
+        if (!id) {
+            ipc_send(thisenv->env_parent_id, work(), NULL, 0, 0);
+            return;
+        }
+    }
+
+    for (i = 0; i < NWORKERS; i++)
+        cpus |= ipc_recv(NULL, NULL, NULL, NULL);
+    uint64_t cycles = read_tsc() - start;
+
+    cprintf("smpbench: %d workers used %d CPUs in %lu Mcycles\n",
+            NWORKERS, __builtin_popcount(cpus), (unsigned long)(cycles / 1000000));
+}
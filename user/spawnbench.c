@@ -0,0 +1,29 @@
+/* Cost of spawn(): memory set up of the child is batched
+ * through the system call ring, so the number of kernel
+ * entries per spawn does not grow with the number of segments
+ * and shared regions. File server requests are counted too */
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define NSPAWNS 20
+
+void
+umain(int argc, char **argv) {
+    uint64_t entries = 0, cycles = 0;
+
+    for (int i = 0; i < NSPAWNS; i++) {
+        uint64_t start_entries = thisenv->env_syscalls;
+        uint64_t start = read_tsc();
+
+        envid_t child = spawnl("hello", "hello", NULL);
+        if (child < 0) panic("spawn(hello): %i", child);
+
+        cycles += read_tsc() - start;
+        entries += thisenv->env_syscalls - start_entries;
+        wait(child);
+    }
+
+    cprintf("spawnbench: %lu kernel entries, %lu Kcycles per spawn\n",
+            (unsigned long)(entries / NSPAWNS), (unsigned long)(cycles / NSPAWNS / 1000));
+}
@@ -0,0 +1,36 @@
+/* Null system call latency: sys_getenvid() through the legacy
+ * T_SYSCALL trap gate and through SYSCALL/SYSRET, which
+ * lib/syscall.c uses */
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define NITERS 100000
+
+/* Old calling convention, arguments are passed in RDX, RCX, RBX, RDI, RSI and R8 */
+static envid_t
+getenvid_int(void) {
+    envid_t ret;
+    asm volatile("int %1"
+                 : "=a"(ret)
+                 : "i"(T_SYSCALL), "a"(SYS_getenvid)
+                 : "cc", "memory");
+    return ret;
+}
+
+void
+umain(int argc, char **argv) {
+    envid_t id = sys_getenvid();
+    if (getenvid_int() != id) panic("int $T_SYSCALL returned %08x instead of %08x", getenvid_int(), id);
+
+    uint64_t start = read_tsc();
+    for (int i = 0; i < NITERS; i++) getenvid_int();
+    uint64_t trap = read_tsc() - start;
+
+    start = read_tsc();
+    for (int i = 0; i < NITERS; i++) sys_getenvid();
+    uint64_t fast = read_tsc() - start;
+
+    cprintf("syscallbench: sys_getenvid takes %lu cycles with int, %lu cycles with syscall\n",
+            (unsigned long)(trap / NITERS), (unsigned long)(fast / NITERS));
+}
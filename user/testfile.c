@@ -4,6 +4,42 @@ const char *msg = "This is the NEW message of the day!\n\n";
 
 #define FVA ((struct Fd *)0xA000000)
 
+/* Large enough to need the double-indirect block */
+#define NBIGBLOCKS (NINDIRECT + NEXTENT * 3)
+
+static char blk[BLKSIZE];
+
+/* Write block i of a large file, tagged with its number and tag */
+static void
+big_write(int f, const char *path, int64_t i, int tag) {
+    int64_t r;
+
+    memset(blk, tag, sizeof(blk));
+    *(int64_t *)blk = i;
+    if ((r = write(f, blk, sizeof(blk))) != sizeof(blk))
+        panic("write %s@%ld: %ld", path, (long)(i * BLKSIZE), (long)r);
+}
+
+/* Check that the large file has nblocks blocks written by big_write() */
+static void
+big_check(int f, const char *path, int64_t nblocks, int tag) {
+    int64_t r;
+
+    seek(f, 0);
+    for (int64_t i = 0; i < nblocks; i++) {
+        if ((r = readn(f, blk, sizeof(blk))) < 0)
+            panic("read %s@%ld: %ld", path, (long)(i * BLKSIZE), (long)r);
+        if (r != sizeof(blk))
+            panic("read %s from %ld returned %ld < %d bytes",
+                  path, (long)(i * BLKSIZE), (long)r, (uint32_t)sizeof(blk));
+        if (*(int64_t *)blk != i || blk[sizeof(blk) - 1] != tag)
+            panic("read %s from %ld returned bad data %ld/%d",
+                  path, (long)(i * BLKSIZE), (long)*(int64_t *)blk, blk[sizeof(blk) - 1]);
+    }
+    if ((r = readn(f, blk, sizeof(blk))) != 0)
+        panic("read %s past %ld blocks returned %ld", path, (long)nblocks, (long)r);
+}
+
 static int
 xopen(const char *path, int mode) {
     extern union Fsipc fsipcbuf;
@@ -20,7 +56,7 @@ xopen(const char *path, int mode) {
 
 void
 umain(int argc, char **argv) {
-    int64_t r, f;
+    int64_t r, f, f2;
     struct Fd *fd;
     struct Fd fdcopy;
     struct Stat st;
@@ -97,30 +133,40 @@ umain(int argc, char **argv) {
         panic("open did not fill struct Fd correctly\n");
     cprintf("open is good\n");
 
-    /* Try files with indirect blocks */
-    if ((f = open("/big", O_WRONLY | O_CREAT)) < 0)
+    /* Try large files. Writing two files in turns keeps either from
+     * growing its extents, so both run out of them and go on to the
+     * indirect and the double-indirect block. The client buffer sends
+     * the writes a few blocks at a time, so each extent maps a run of
+     * blocks rather than a single one */
+    if ((f = open("/big", O_RDWR | O_CREAT | O_TRUNC)) < 0)
         panic("creat /big: %ld", (long)f);
-    memset(buf, 0, sizeof(buf));
-    for (int64_t i = 0; i < (NDIRECT * 3) * BLKSIZE; i += sizeof(buf)) {
-        *(int *)buf = i;
-        if ((r = write(f, buf, sizeof(buf))) < 0)
-            panic("write /big@%ld: %ld", (long)i, (long)r);
+    if ((f2 = open("/big2", O_RDWR | O_CREAT | O_TRUNC)) < 0)
+        panic("creat /big2: %ld", (long)f2);
+    for (int64_t i = 0; i < NBIGBLOCKS; i++) {
+        big_write(f, "/big", i, 1);
+        big_write(f2, "/big2", i, 2);
     }
-    close(f);
+    big_check(f, "/big", NBIGBLOCKS, 1);
+    big_check(f2, "/big2", NBIGBLOCKS, 2);
+    cprintf("large file is good\n");
 
-    if ((f = open("/big", O_RDONLY)) < 0)
-        panic("open /big: %ld", (long)f);
-    for (int64_t i = 0; i < (NDIRECT * 3) * BLKSIZE; i += sizeof(buf)) {
-        *(int *)buf = i;
-        if ((r = readn(f, buf, sizeof(buf))) < 0)
-            panic("read /big@%ld: %ld", (long)i, (long)r);
-        if (r != sizeof(buf))
-            panic("read /big from %ld returned %ld < %d bytes",
-                  (long)i, (long)r, (uint32_t)sizeof(buf));
-        if (*(int *)buf != i)
-            panic("read /big from %ld returned bad data %d",
-                  (long)i, *(int *)buf);
-    }
+    /* Free the double-indirect block of /big and the second half of
+     * its indirect one, which stays in use whatever the extents map,
+     * and all of /big2, then reuse the freed blocks */
+    if ((r = ftruncate(f, NINDIRECT / 2 * BLKSIZE)) < 0)
+        panic("ftruncate /big: %ld", (long)r);
+    close(f2);
+    if ((r = remove("/big2")) < 0)
+        panic("remove /big2: %ld", (long)r);
+    if ((f2 = open("/big2", O_RDWR | O_CREAT | O_TRUNC)) < 0)
+        panic("creat /big2: %ld", (long)f2);
+    for (int64_t i = 0; i < NBIGBLOCKS; i++)
+        big_write(f2, "/big2", i, 3);
+    big_check(f, "/big", NINDIRECT / 2, 1);
+    big_check(f2, "/big2", NBIGBLOCKS, 3);
     close(f);
-    cprintf("large file is good\n");
+    close(f2);
+    if ((r = remove("/big2")) < 0)
+        panic("remove /big2: %ld", (long)r);
+    cprintf("large file free is good\n");
 }
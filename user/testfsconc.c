@@ -0,0 +1,104 @@
+/* Concurrent reads through a shared file descriptor: children of one
+ * environment read /bigfile through the Fd they inherit, so each piece
+ * of the file has to go to exactly one of them, however the file server
+ * interleaves their requests while it waits for the disk. /bigfile is
+ * made of numbered LINE_SIZE byte lines (see fs/Makefrag), which tells
+ * where a piece came from. Large reads go to the server directly, reads
+ * of one line go through the client buffer of lib/file.c, which must
+ * not hand out the same data in two readers */
+
+#include <inc/lib.h>
+
+#define NREADERS  4
+#define LINE_SIZE 32
+#define PIECE     FSIPC_DATA_SIZE
+#define NPIECES   (2097152 / PIECE)
+
+/* Times each piece was read, shared with the readers */
+#define SEEN ((volatile uint32_t *)0x0A000000)
+
+/* Lines read one at a time, and the times each of them was read */
+#define NLINES     8192
+#define LINES_SEEN ((volatile uint8_t *)0x0A001000)
+
+static char buf[PIECE] __attribute__((aligned(PAGE_SIZE)));
+
+static void
+reader(int fd) {
+    char line[LINE_SIZE + 1];
+    int res;
+
+    while ((res = read(fd, buf, PIECE)) > 0) {
+        if (res != PIECE) panic("short read: %i", res);
+
+        long first = strtol(buf + LINE_SIZE - 8, NULL, 10);
+        if (first % (PIECE / LINE_SIZE)) panic("piece starts at line %ld", first);
+        for (size_t i = 0; i < PIECE / LINE_SIZE; i++) {
+            snprintf(line, sizeof(line), "JOS disk benchmark data %07ld\n", first + (long)i);
+            if (memcmp(buf + i * LINE_SIZE, line, LINE_SIZE))
+                panic("line %ld of the piece at line %ld is wrong", (long)i, first);
+        }
+        __atomic_fetch_add(&SEEN[first / (PIECE / LINE_SIZE)], 1, __ATOMIC_RELAXED);
+    }
+    if (res < 0) panic("read /bigfile: %i", res);
+}
+
+/* Read the first NLINES lines one at a time. Lines are handed out in
+ * order, so the others are all taken once one past them comes back */
+static void
+line_reader(int fd) {
+    char line[LINE_SIZE + 1], want[LINE_SIZE + 1];
+    int res;
+
+    while ((res = read(fd, line, LINE_SIZE)) > 0) {
+        if (res != LINE_SIZE) panic("short line read: %i", res);
+
+        long n = strtol(line + LINE_SIZE - 8, NULL, 10);
+        snprintf(want, sizeof(want), "JOS disk benchmark data %07ld\n", n);
+        if (memcmp(line, want, LINE_SIZE)) panic("line %ld is wrong", n);
+        if (n >= NLINES) return;
+        __atomic_fetch_add(&LINES_SEEN[n], 1, __ATOMIC_RELAXED);
+    }
+    if (res < 0) panic("read /bigfile: %i", res);
+}
+
+/* Run NREADERS children of fn sharing a fresh descriptor of /bigfile */
+static void
+run_readers(void (*fn)(int)) {
+    envid_t readers[NREADERS];
+    int fd;
+
+    if ((fd = open("/bigfile", O_RDONLY)) < 0) panic("open /bigfile: %i", fd);
+
+    for (size_t i = 0; i < NREADERS; i++) {
+        if ((readers[i] = fork()) < 0) panic("fork: %i", readers[i]);
+        if (!readers[i]) {
+            fn(fd);
+            exit();
+        }
+    }
+    for (size_t i = 0; i < NREADERS; i++)
+        wait(readers[i]);
+    close(fd);
+}
+
+void
+umain(int argc, char **argv) {
+    int res;
+
+    if ((res = sys_alloc_region(0, (void *)SEEN, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0)
+        panic("sys_alloc_region: %i", res);
+    if ((res = sys_alloc_region(0, (void *)LINES_SEEN, ROUNDUP(NLINES, PAGE_SIZE), PROT_RW | PROT_SHARE)) < 0)
+        panic("sys_alloc_region: %i", res);
+
+    /* Not read before, so the readers wait for the disk */
+    run_readers(reader);
+    for (size_t i = 0; i < NPIECES; i++)
+        if (SEEN[i] != 1) panic("piece %lu was read %u times", (unsigned long)i, SEEN[i]);
+    cprintf("concurrent shared fd reads are good\n");
+
+    run_readers(line_reader);
+    for (size_t i = 0; i < NLINES; i++)
+        if (LINES_SEEN[i] != 1) panic("line %lu was read %u times", (unsigned long)i, LINES_SEEN[i]);
+    cprintf("concurrent small shared fd reads are good\n");
+}